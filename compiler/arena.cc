@@ -0,0 +1,84 @@
+// vi: set ts=2 shiftwidth=2 expandtab:
+//
+// VNPForth - Compiled native Forth for x86 Linux
+// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <set>
+#include <vector>
+
+#include "arena.h"
+
+// Free all chunks.  Every object must have been released by now.
+Arena::~Arena ()
+{
+  assert (allocations_ == 0);
+  for (size_t i = 0; i < chunks_.size (); ++i)
+    ::operator delete (chunks_[i]);
+}
+
+// Return memory for an object of size bytes, aligned for any type that an
+// object may contain.  Objects may not be larger than a chunk.
+void *
+Arena::allocate (size_t size)
+{
+  const size_t alignment = 2 * sizeof (void *) > sizeof (double)
+                           ? 2 * sizeof (void *) : sizeof (double);
+  size = (size + alignment - 1) / alignment * alignment;
+  assert (size <= chunk_size_);
+
+  if (offset_ + size > chunk_size_)
+    {
+      if (chunks_used_ == chunks_.size ())
+        chunks_.push_back (static_cast<char *> (::operator new (chunk_size_)));
+      ++chunks_used_;
+      offset_ = 0;
+    }
+
+  void * memory = chunks_[chunks_used_ - 1] + offset_;
+  offset_ += size;
+  ++allocations_;
+#ifndef NDEBUG
+  live_.insert (memory);
+#endif
+  return memory;
+}
+
+// Note the release of one object, and rewind once none remain.
+void
+Arena::release (void * memory)
+{
+  assert (allocations_ > 0);
+#ifndef NDEBUG
+  const size_t erased = live_.erase (memory);
+  assert (erased == 1);
+#else
+  (void) memory;
+#endif
+
+  if (--allocations_ == 0)
+    {
+#ifndef NDEBUG
+      assert (live_.empty ());
+#endif
+      chunks_used_ = 0;
+      offset_ = chunk_size_;
+    }
+}
@@ -0,0 +1,59 @@
+// vi: set ts=2 shiftwidth=2 expandtab:
+//
+// VNPForth - Compiled native Forth for x86 Linux
+// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef VNPFORTH_ARENA_H
+#define VNPFORTH_ARENA_H
+
+#include <cstddef>
+#include <set>
+#include <vector>
+
+// Arena allocator, for many small objects that are released together.  It
+// hands out memory sequentially from large chunks.  Releasing an object
+// frees nothing by itself; once every object allocated is released, the
+// arena rewinds, and reuses its chunks for the next objects.  Unless built
+// with NDEBUG, it also tracks each object it hands out, so that it can
+// assert that no object is released twice or outlives a rewind.
+class Arena
+{
+public:
+  explicit Arena (size_t chunk_size)
+    : chunk_size_ (chunk_size), chunks_used_ (0), offset_ (chunk_size),
+      allocations_ (0) { }
+  ~Arena ();
+
+  void * allocate (size_t size);
+  void release (void * memory);
+
+private:
+  Arena (const Arena & arena);
+  Arena & operator= (const Arena & arena);
+
+  const size_t chunk_size_;
+  std::vector<char *> chunks_;
+  size_t chunks_used_;
+  size_t offset_;
+  size_t allocations_;
+#ifndef NDEBUG
+  std::set<const void *> live_;
+#endif
+};
+
+#endif
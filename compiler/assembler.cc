@@ -0,0 +1,2920 @@
+// vi: set ts=2 shiftwidth=2 expandtab:
+//
+// VNPForth - Compiled native Forth for x86 Linux
+// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+#include <elf.h>
+
+#include "assembler.h"
+
+// The assembler works in three stages.  Parsing turns each statement into
+// a fragment of its section: fixed bytes with fixups for any expressions
+// that need symbol values, a branch whose size is not yet known, or an
+// alignment.  Layout then assigns addresses, lengthening short branches
+// whose targets are out of range until nothing changes, as GNU as does.
+// Finally, fixups become either values or relocations, and the sections,
+// symbols and relocations are written out as an ELF object.
+namespace {
+
+// Raised for anything outside the supported subset, and for any error.
+class Unsupported { };
+
+void
+unsupported ()
+{
+  throw Unsupported ();
+}
+
+// Relocation modifiers that can follow a symbol, as in name@PLT.
+enum Modifier { NO_MODIFIER, GOT, GOTOFF, PLT };
+
+struct AsmSymbol;
+
+// Expression tree node.  Binary operators are single characters, with
+// '<' and '>' standing for the shifts '<<' and '>>'.
+struct Node
+{
+  enum Kind { NUMBER, SYMBOL, DOT, NEGATE, COMPLEMENT, BINARY };
+
+  Kind kind;
+  long long number;
+  AsmSymbol * symbol;
+  Modifier modifier;
+  char op;
+  const Node * left;
+  const Node * right;
+};
+
+// Assembler symbol.  A label is located by its section and the index of
+// the fragment that follows it.  Binding is -1 until .globl or .weak.
+struct AsmSymbol
+{
+  enum State { UNDEFINED, LABEL, EQUATED, COMMON };
+
+  AsmSymbol (const std::string & name)
+    : name_ (name), state_ (UNDEFINED), section_ (0), fragment_ (0),
+      equation_ (0), size_ (0), common_size_ (0), common_alignment_ (0),
+      binding_ (-1), type_ (STT_NOTYPE), relocated_ (false),
+      evaluating_ (false), index_ (0)
+  {
+    temporary_ = name.compare (0, 2, ".L") == 0 || name[0] == '\002';
+  }
+
+  // True for symbols that relocations must reference directly, rather
+  // than through their section.
+  inline bool
+  external () const
+  {
+    return state_ != LABEL || binding_ == STB_GLOBAL || binding_ == STB_WEAK;
+  }
+
+  std::string name_;
+  State state_;
+  size_t section_;
+  size_t fragment_;
+  const Node * equation_;
+  const Node * size_;
+  long long common_size_;
+  long long common_alignment_;
+  int binding_;
+  int type_;
+  bool temporary_;
+  bool relocated_;
+  bool evaluating_;
+  size_t index_;
+};
+
+// Evaluated expression, the addend plus the address of add, less that of
+// sub.  A value with neither symbol is absolute.
+struct Value
+{
+  long long addend;
+  const AsmSymbol * add;
+  const AsmSymbol * sub;
+  Modifier modifier;
+};
+
+// Field within a fragment that holds an expression's value.  GOT32X is the
+// relaxable form of a GOT reference, used for loads, calls, and jumps.
+struct Fixup
+{
+  size_t offset;
+  int size;
+  const Node * expression;
+  bool pc_relative;
+  bool got32x;
+};
+
+// Section fragment, fixed bytes, a relaxable branch, or an alignment.
+// Fixed bytes from data directives, rather than instructions, are data.
+struct Fragment
+{
+  enum Kind { FIXED, BRANCH, ALIGN };
+
+  Fragment (Kind kind)
+    : kind_ (kind), opcode_ (0), target_ (0), long_form_ (false),
+      relaxable_ (false), alignment_ (1), nop_fill_ (false), fill_ (0),
+      data_ (false), address_ (0), size_ (0) { }
+
+  Kind kind_;
+  std::vector<unsigned char> bytes_;
+  std::vector<Fixup> fixups_;
+  unsigned char opcode_;
+  const Node * target_;
+  bool long_form_;
+  bool relaxable_;
+  size_t alignment_;
+  bool nop_fill_;
+  unsigned char fill_;
+  bool data_;
+  size_t address_;
+  size_t size_;
+};
+
+// Relocation, against a symbol, or if none, the symbol of section.
+struct Relocation
+{
+  size_t offset;
+  const AsmSymbol * symbol;
+  size_t section;
+  unsigned char type;
+};
+
+// Output section, its fragments, and when laid out, contents and relocations.
+struct Section
+{
+  Section (const std::string & name, Elf32_Word type, Elf32_Word flags)
+    : name_ (name), type_ (type), flags_ (flags), entsize_ (0),
+      alignment_ (1), link_ (0), symbol_ (false), index_ (0),
+      rel_index_ (0), first_symbol_ (0) { }
+
+  // Address of the fragment at index, or of the section end.
+  inline size_t
+  address (size_t index) const
+  {
+    if (index < fragments_.size ())
+      return fragments_[index].address_;
+    return fragments_.empty ()
+           ? 0 : fragments_.back ().address_ + fragments_.back ().size_;
+  }
+
+  std::string name_;
+  Elf32_Word type_;
+  Elf32_Word flags_;
+  Elf32_Word entsize_;
+  size_t alignment_;
+  size_t link_;
+  std::vector<Fragment> fragments_;
+  std::vector<unsigned char> contents_;
+  std::vector<Relocation> relocations_;
+  bool symbol_;
+  size_t index_;
+  size_t rel_index_;
+  size_t first_symbol_;
+};
+
+// Instruction operand.  A bare expression, such as a branch target, is a
+// memory operand with no base or index.
+struct Operand
+{
+  enum Kind { REGISTER, FPU_REGISTER, IMMEDIATE, MEMORY };
+
+  Kind kind;
+  int reg;
+  int size;
+  const Node * expression;
+  int base;
+  int index;
+  int scale;
+  bool indirect;
+};
+
+// Register names, numbers, and sizes.
+struct RegisterName
+{
+  const char * name;
+  int number;
+  int size;
+};
+
+const RegisterName REGISTERS[] = {
+  { "eax", 0, 4 }, { "ecx", 1, 4 }, { "edx", 2, 4 }, { "ebx", 3, 4 },
+  { "esp", 4, 4 }, { "ebp", 5, 4 }, { "esi", 6, 4 }, { "edi", 7, 4 },
+  { "ax", 0, 2 }, { "cx", 1, 2 }, { "dx", 2, 2 }, { "bx", 3, 2 },
+  { "sp", 4, 2 }, { "bp", 5, 2 }, { "si", 6, 2 }, { "di", 7, 2 },
+  { "al", 0, 1 }, { "cl", 1, 1 }, { "dl", 2, 1 }, { "bl", 3, 1 },
+  { "ah", 4, 1 }, { "ch", 5, 1 }, { "dh", 6, 1 }, { "bh", 7, 1 },
+  { 0, 0, 0 }
+};
+
+const int EAX = 0, ECX = 1, ESP = 4, EBP = 5;
+
+// Condition code suffixes for jcc, setcc, and cmovcc.
+struct ConditionName
+{
+  const char * name;
+  int code;
+};
+
+const ConditionName CONDITIONS[] = {
+  { "o", 0x0 }, { "no", 0x1 }, { "b", 0x2 }, { "c", 0x2 }, { "nae", 0x2 },
+  { "ae", 0x3 }, { "nb", 0x3 }, { "nc", 0x3 }, { "e", 0x4 }, { "z", 0x4 },
+  { "ne", 0x5 }, { "nz", 0x5 }, { "be", 0x6 }, { "na", 0x6 }, { "a", 0x7 },
+  { "nbe", 0x7 }, { "s", 0x8 }, { "ns", 0x9 }, { "p", 0xa }, { "pe", 0xa },
+  { "np", 0xb }, { "po", 0xb }, { "l", 0xc }, { "nge", 0xc }, { "ge", 0xd },
+  { "nl", 0xd }, { "le", 0xe }, { "ng", 0xe }, { "g", 0xf }, { "nle", 0xf },
+  { 0, 0 }
+};
+
+// Instructions without operands, and their encodings.
+struct SimpleInstruction
+{
+  const char * name;
+  const char * encoding;
+};
+
+const SimpleInstruction SIMPLE_INSTRUCTIONS[] = {
+  { "ret", "\xc3" }, { "leave", "\xc9" }, { "nop", "\x90" },
+  { "hlt", "\xf4" }, { "cltd", "\x99" }, { "cdq", "\x99" },
+  { "cwtl", "\x98" }, { "cwde", "\x98" }, { "cbtw", "\x66\x98" },
+  { "cwtd", "\x66\x99" }, { "clc", "\xf8" }, { "stc", "\xf9" },
+  { "cmc", "\xf5" }, { "cld", "\xfc" }, { "std", "\xfd" },
+  { "cli", "\xfa" }, { "sti", "\xfb" }, { "sahf", "\x9e" },
+  { "lahf", "\x9f" }, { "pushf", "\x9c" }, { "pushfl", "\x9c" },
+  { "popf", "\x9d" }, { "popfl", "\x9d" }, { "pusha", "\x60" },
+  { "pushal", "\x60" }, { "popa", "\x61" }, { "popal", "\x61" },
+  { "int3", "\xcc" }, { "movsb", "\xa4" }, { "movsw", "\x66\xa5" },
+  { "movsl", "\xa5" }, { "cmpsb", "\xa6" }, { "cmpsl", "\xa7" },
+  { "stosb", "\xaa" }, { "stosw", "\x66\xab" }, { "stosl", "\xab" },
+  { "lodsb", "\xac" }, { "lodsl", "\xad" }, { "scasb", "\xae" },
+  { "scasl", "\xaf" }, { "xlat", "\xd7" }, { "wait", "\x9b" },
+  { "fwait", "\x9b" }, { "ud2", "\x0f\x0b" }, { "rdtsc", "\x0f\x31" },
+  { "cpuid", "\x0f\xa2" }, { "f2xm1", "\xd9\xf0" }, { "fabs", "\xd9\xe1" },
+  { "fchs", "\xd9\xe0" }, { "fclex", "\x9b\xdb\xe2" },
+  { "fnclex", "\xdb\xe2" }, { "fcos", "\xd9\xff" },
+  { "fdecstp", "\xd9\xf6" }, { "fincstp", "\xd9\xf7" },
+  { "finit", "\x9b\xdb\xe3" }, { "fninit", "\xdb\xe3" },
+  { "fld1", "\xd9\xe8" }, { "fldl2e", "\xd9\xea" }, { "fldl2t", "\xd9\xe9" },
+  { "fldlg2", "\xd9\xec" }, { "fldln2", "\xd9\xed" }, { "fldpi", "\xd9\xeb" },
+  { "fldz", "\xd9\xee" }, { "fnop", "\xd9\xd0" }, { "fpatan", "\xd9\xf3" },
+  { "fprem", "\xd9\xf8" }, { "fprem1", "\xd9\xf5" }, { "fptan", "\xd9\xf2" },
+  { "frndint", "\xd9\xfc" }, { "fscale", "\xd9\xfd" }, { "fsin", "\xd9\xfe" },
+  { "fsincos", "\xd9\xfb" }, { "fsqrt", "\xd9\xfa" }, { "ftst", "\xd9\xe4" },
+  { "fxam", "\xd9\xe5" }, { "fxtract", "\xd9\xf4" }, { "fyl2x", "\xd9\xf1" },
+  { "fyl2xp1", "\xd9\xf9" }, { "fcompp", "\xde\xd9" },
+  { "fucompp", "\xda\xe9" }, { "faddp", "\xde\xc1" }, { "fmulp", "\xde\xc9" },
+  { "fxch", "\xd9\xc9" }, { "fcom", "\xd8\xd1" }, { "fcomp", "\xd8\xd9" },
+  { "fucom", "\xdd\xe1" }, { "fucomp", "\xdd\xe9" },
+  { 0, 0 }
+};
+
+// Floating point instructions with a memory operand.  Opcode prefix is
+// the fwait that the non-'n' forms of control and status stores add.
+struct FloatInstruction
+{
+  const char * name;
+  int prefix;
+  int opcode;
+  int digit;
+};
+
+const FloatInstruction FLOAT_INSTRUCTIONS[] = {
+  { "flds", 0, 0xd9, 0 }, { "fldl", 0, 0xdd, 0 }, { "fldt", 0, 0xdb, 5 },
+  { "fsts", 0, 0xd9, 2 }, { "fstl", 0, 0xdd, 2 }, { "fstps", 0, 0xd9, 3 },
+  { "fstpl", 0, 0xdd, 3 }, { "fstpt", 0, 0xdb, 7 }, { "filds", 0, 0xdf, 0 },
+  { "fildl", 0, 0xdb, 0 }, { "fildll", 0, 0xdf, 5 }, { "fildq", 0, 0xdf, 5 },
+  { "fists", 0, 0xdf, 2 }, { "fistl", 0, 0xdb, 2 }, { "fistps", 0, 0xdf, 3 },
+  { "fistpl", 0, 0xdb, 3 }, { "fistpll", 0, 0xdf, 7 },
+  { "fistpq", 0, 0xdf, 7 }, { "fadds", 0, 0xd8, 0 }, { "faddl", 0, 0xdc, 0 },
+  { "fmuls", 0, 0xd8, 1 }, { "fmull", 0, 0xdc, 1 }, { "fcoms", 0, 0xd8, 2 },
+  { "fcoml", 0, 0xdc, 2 }, { "fcomps", 0, 0xd8, 3 }, { "fcompl", 0, 0xdc, 3 },
+  { "fsubs", 0, 0xd8, 4 }, { "fsubl", 0, 0xdc, 4 }, { "fsubrs", 0, 0xd8, 5 },
+  { "fsubrl", 0, 0xdc, 5 }, { "fdivs", 0, 0xd8, 6 }, { "fdivl", 0, 0xdc, 6 },
+  { "fdivrs", 0, 0xd8, 7 }, { "fdivrl", 0, 0xdc, 7 },
+  { "fiaddl", 0, 0xda, 0 }, { "fimull", 0, 0xda, 1 },
+  { "fisubl", 0, 0xda, 4 }, { "fidivl", 0, 0xda, 6 },
+  { "fldcw", 0, 0xd9, 5 }, { "fnstcw", 0, 0xd9, 7 },
+  { "fstcw", 0x9b, 0xd9, 7 }, { "fnstsw", 0, 0xdd, 7 },
+  { "fstsw", 0x9b, 0xdd, 7 }, { "fldenv", 0, 0xd9, 4 },
+  { "fnstenv", 0, 0xd9, 6 },
+  { 0, 0, 0, 0 }
+};
+
+// Floating point instructions with an %st(i) operand, and their encodings.
+struct FloatRegisterInstruction
+{
+  const char * name;
+  int opcode;
+  int base;
+};
+
+const FloatRegisterInstruction FLOAT_REGISTER_INSTRUCTIONS[] = {
+  { "fld", 0xd9, 0xc0 }, { "fst", 0xdd, 0xd0 }, { "fstp", 0xdd, 0xd8 },
+  { "fxch", 0xd9, 0xc8 }, { "fcom", 0xd8, 0xd0 }, { "fcomp", 0xd8, 0xd8 },
+  { "fucom", 0xdd, 0xe0 }, { "fucomp", 0xdd, 0xe8 }, { "ffree", 0xdd, 0xc0 },
+  { 0, 0, 0 }
+};
+
+// Arithmetic group, and F6/F7 group instructions, with their ModRM digits.
+const char * const ARITHMETIC[] = {
+  "add", "or", "adc", "sbb", "and", "sub", "xor", "cmp", 0
+};
+
+const char * const UNARY[] = {
+  "", "", "not", "neg", "mul", "imul", "div", "idiv", 0
+};
+
+const char * const SHIFTS[] = {
+  "rol", "ror", "rcl", "rcr", "shl", "shr", "sal", "sar", 0
+};
+
+const int SHIFT_DIGITS[] = { 0, 1, 2, 3, 4, 5, 4, 7 };
+
+// Return the index of name in a null terminated list, or -1.
+int
+find (const char * const * list, const std::string & name)
+{
+  for (int i = 0; list[i]; ++i)
+    {
+      if (name == list[i])
+        return i;
+    }
+  return -1;
+}
+
+// Small helpers for characters, numbers, and little-endian output.
+inline bool
+is_symbol_start (char c)
+{
+  return std::isalpha (static_cast<unsigned char>(c)) || c == '_' || c == '.';
+}
+
+inline bool
+is_symbol_char (char c)
+{
+  return std::isalnum (static_cast<unsigned char>(c))
+         || c == '_' || c == '.' || c == '$';
+}
+
+inline bool
+fits8 (long long value)
+{
+  return value >= -128 && value <= 127;
+}
+
+// Truncate value to size bytes, then sign extend it back.
+long long
+sign_extend (long long value, int size)
+{
+  const int shift = 64 - size * 8;
+  return static_cast<long long>(static_cast<unsigned long long>(value)
+                                << shift) >> shift;
+}
+
+void
+put (std::vector<unsigned char> & bytes, size_t offset,
+     unsigned long long value, int size)
+{
+  for (int i = 0; i < size; ++i)
+    bytes[offset + i] = static_cast<unsigned char>(value >> (i * 8));
+}
+
+void
+append (std::vector<unsigned char> & bytes,
+        unsigned long long value, int size)
+{
+  bytes.resize (bytes.size () + size);
+  put (bytes, bytes.size () - size, value, size);
+}
+
+std::string
+trim (const std::string & str)
+{
+  const size_t first = str.find_first_not_of (" \t\r\n");
+  if (first == str.npos)
+    return "";
+  return str.substr (first, str.find_last_not_of (" \t\r\n") - first + 1);
+}
+
+// Split arguments at commas outside of strings and brackets.
+std::vector<std::string>
+split (const std::string & text)
+{
+  std::vector<std::string> args;
+  std::string arg;
+  bool quoted = false;
+  int depth = 0;
+
+  for (size_t i = 0; i < text.size (); ++i)
+    {
+      char c = text[i];
+      if (quoted)
+        {
+          if (c == '\\' && i + 1 < text.size ())
+            arg += text[i], c = text[++i];
+          else if (c == '"')
+            quoted = false;
+        }
+      else if (c == '"')
+        quoted = true;
+      else if (c == '(' || c == '[')
+        depth++;
+      else if (c == ')' || c == ']')
+        depth--;
+      else if (c == ',' && depth == 0)
+        {
+          args.push_back (trim (arg));
+          arg.clear ();
+          continue;
+        }
+      arg += c;
+    }
+
+  if (!trim (arg).empty () || !args.empty ())
+    args.push_back (trim (arg));
+  return args;
+}
+
+// Decode a quoted string argument, with C-style escapes.
+std::string
+unquote (const std::string & text)
+{
+  if (text.size () < 2 || text[0] != '"' || text[text.size () - 1] != '"')
+    unsupported ();
+
+  std::string str;
+  for (size_t i = 1; i < text.size () - 1; ++i)
+    {
+      char c = text[i];
+      if (c == '"')
+        unsupported ();
+      if (c != '\\')
+        {
+          str += c;
+          continue;
+        }
+
+      c = text[++i];
+      if (c >= '0' && c <= '7')
+        {
+          int value = 0;
+          for (int n = 0; n < 3 && text[i] >= '0' && text[i] <= '7'; ++n)
+            value = value * 8 + (text[i++] - '0');
+          str += static_cast<char>(value);
+          i--;
+        }
+      else if (c == 'x')
+        {
+          int value = 0;
+          while (std::isxdigit (static_cast<unsigned char>(text[i + 1])))
+            {
+              const char d = std::tolower (text[++i]);
+              value = value * 16 + (std::isdigit (d) ? d - '0' : d - 'a' + 10);
+            }
+          str += static_cast<char>(value);
+        }
+      else
+        {
+          const char * const escapes = "n\nt\tr\rb\bf\f\\\\\"\"";
+          const char * e = std::strchr (escapes, c);
+          if (!e || (e - escapes) % 2 != 0)
+            unsupported ();
+          str += e[1];
+        }
+    }
+  return str;
+}
+
+// ELF string table.  A string that is the tail of another is not stored
+// separately, as GNU as does, so that .rel.text also provides .text.
+// Handle zero is the empty string.
+class StringTable
+{
+public:
+  StringTable ()
+    : strings_ (1) { }
+
+  inline size_t
+  add (const std::string & str)
+  {
+    strings_.push_back (str);
+    return strings_.size () - 1;
+  }
+
+  void finalize ();
+
+  inline Elf32_Word
+  offset (size_t handle) const
+  {
+    return offsets_[handle];
+  }
+
+  inline const std::string &
+  data () const
+  {
+    return data_;
+  }
+
+private:
+  std::vector<std::string> strings_;
+  std::vector<Elf32_Word> offsets_;
+  std::string data_;
+};
+
+// Compare strings from their ends, sorting longer ones first if one is the
+// tail of the other.
+struct ReverseGreater
+{
+  const std::vector<std::string> * strings;
+
+  bool
+  operator() (size_t left, size_t right) const
+  {
+    const std::string & l = (*strings)[left];
+    const std::string & r = (*strings)[right];
+    return std::lexicographical_compare (r.rbegin (), r.rend (),
+                                         l.rbegin (), l.rend ());
+  }
+};
+
+// Lay out the table.  In descending order of reversed strings, any string
+// that is the tail of another immediately follows one that it ends.
+void
+StringTable::finalize ()
+{
+  std::vector<size_t> order;
+  for (size_t i = 1; i < strings_.size (); ++i)
+    order.push_back (i);
+  const ReverseGreater greater = { &strings_ };
+  std::stable_sort (order.begin (), order.end (), greater);
+
+  std::vector<size_t> owner (strings_.size (), 0);
+  size_t last = 0;
+  for (size_t i = 0; i < order.size (); ++i)
+    {
+      const std::string & str = strings_[order[i]];
+      const std::string & previous = strings_[last];
+      if (last && previous.size () >= str.size ()
+          && previous.compare (previous.size () - str.size (),
+                               str.size (), str) == 0)
+        owner[order[i]] = last;
+      else
+        owner[order[i]] = last = order[i];
+    }
+
+  data_.assign (1, '\0');
+  offsets_.assign (strings_.size (), 0);
+  for (size_t i = 1; i < strings_.size (); ++i)
+    {
+      if (owner[i] == i)
+        {
+          offsets_[i] = data_.size ();
+          data_ += strings_[i] + '\0';
+        }
+    }
+  for (size_t i = 1; i < strings_.size (); ++i)
+    offsets_[i] = offsets_[owner[i]]
+                  + strings_[owner[i]].size () - strings_[i].size ();
+}
+
+// Assembler state, from parsed statements through to the ELF object.
+class Assembly
+{
+public:
+  Assembly ();
+
+  void parse (const std::string & assembly);
+  void layout ();
+  void write (const std::string & object_path);
+
+private:
+  Assembly (const Assembly & assembly);
+  Assembly & operator= (const Assembly & assembly);
+
+  // Parsing.
+  void statement (const std::string & text);
+  void directive (const std::string & name,
+                  const std::vector<std::string> & args);
+  void instruction (const std::string & mnemonic,
+                    const std::vector<std::string> & args);
+  bool general_instruction (const std::string & name, int suffix,
+                            const std::vector<Operand> & operands);
+
+  // Expressions.
+  const Node * expression (const std::string & text);
+  const Node * additive (const std::string & text, size_t & pos);
+  const Node * bitwise (const std::string & text, size_t & pos);
+  const Node * multiplicative (const std::string & text, size_t & pos);
+  const Node * unary (const std::string & text, size_t & pos);
+  const Node * primary (const std::string & text, size_t & pos);
+  const Node * node (Node::Kind kind, char op,
+                     const Node * left, const Node * right);
+  bool constant (const Node * node, long long * value) const;
+  long long constant (const std::string & text);
+  Value evaluate (const Node * node, const AsmSymbol * dot);
+
+  // Symbols and sections.
+  AsmSymbol * symbol (const std::string & name);
+  std::string numeric_label (const std::string & digits, char direction);
+  void define_label (const std::string & name);
+  size_t section (const std::string & name, Elf32_Word type,
+                  Elf32_Word flags);
+  size_t address (const AsmSymbol * symbol) const;
+  bool local_to (const AsmSymbol * symbol, size_t section) const;
+
+  // Encoding.
+  Operand operand (const std::string & text);
+  Fragment & begin_instruction ();
+  void modrm (Fragment & fragment, int reg, const Operand & rm,
+              bool got32x = false);
+  void field (Fragment & fragment, const Node * expression, int size,
+              bool pc_relative, bool got32x = false);
+  void immediate (Fragment & fragment, const Operand & imm, int size);
+  void branch (unsigned char opcode, const Operand & target);
+  void stab (const std::string & str, const std::vector<std::string> & args);
+
+  // Layout and output.
+  void resolve (size_t section);
+  void relocate (Section & section, size_t offset, const Value & value,
+                 unsigned char type, long long addend, int size,
+                 bool keeps_label = false);
+
+  std::deque<Node> nodes_;
+  std::deque<AsmSymbol> symbols_;
+  std::map<std::string, AsmSymbol *> symbol_map_;
+  std::map<std::string, int> numeric_labels_;
+  std::vector<AsmSymbol *> kept_labels_;
+  std::vector<Section> sections_;
+  std::vector<unsigned char> prefixes_;
+  size_t current_;
+
+  std::string file_name_;
+  size_t stab_;
+  size_t stabstr_;
+  size_t comment_;
+};
+
+Assembly::Assembly ()
+  : current_ (0), stab_ (0), stabstr_ (0), comment_ (0)
+{
+  section (".text", SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR);
+  section (".data", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE);
+  section (".bss", SHT_NOBITS, SHF_ALLOC | SHF_WRITE);
+  current_ = 0;
+}
+
+// Find or create a section, and return its index.
+size_t
+Assembly::section (const std::string & name, Elf32_Word type,
+                   Elf32_Word flags)
+{
+  for (size_t i = 0; i < sections_.size (); ++i)
+    {
+      if (sections_[i].name_ == name)
+        return i;
+    }
+
+  sections_.push_back (Section (name, type, flags));
+  sections_.back ().first_symbol_ = symbols_.size ();
+  return sections_.size () - 1;
+}
+
+// Find or create a symbol.
+AsmSymbol *
+Assembly::symbol (const std::string & name)
+{
+  std::map<std::string, AsmSymbol *>::iterator iter = symbol_map_.find (name);
+  if (iter != symbol_map_.end ())
+    return iter->second;
+
+  symbols_.push_back (AsmSymbol (name));
+  symbol_map_[name] = &symbols_.back ();
+  return &symbols_.back ();
+}
+
+// Return the internal name for a numeric local label, "1b" or "1f" when
+// referenced, or a new instance when defined (direction zero).
+std::string
+Assembly::numeric_label (const std::string & digits, char direction)
+{
+  int & count = numeric_labels_[digits];
+  if (direction == 0)
+    count++;
+
+  const int instance = count + (direction == 'f' ? 1 : 0);
+  std::string name = "\002" + digits + "\002";
+  for (int n = instance; ; n /= 10)
+    {
+      name += static_cast<char>('0' + n % 10);
+      if (n < 10)
+        break;
+    }
+  return name;
+}
+
+void
+Assembly::define_label (const std::string & name)
+{
+  AsmSymbol * label = symbol (name);
+  if (label->state_ != AsmSymbol::UNDEFINED)
+    unsupported ();
+
+  label->state_ = AsmSymbol::LABEL;
+  label->section_ = current_;
+  label->fragment_ = sections_[current_].fragments_.size ();
+}
+
+// Expression parsing, by recursive descent.  Precedence follows GNU as,
+// where the bitwise operators bind tighter than addition and subtraction.
+const Node *
+Assembly::node (Node::Kind kind, char op,
+                const Node * left, const Node * right)
+{
+  Node n = { kind, 0, 0, NO_MODIFIER, op, left, right };
+  nodes_.push_back (n);
+  return &nodes_.back ();
+}
+
+const Node *
+Assembly::expression (const std::string & text)
+{
+  size_t pos = 0;
+  const Node * result = additive (text, pos);
+  while (pos < text.size () && std::isspace (text[pos]))
+    pos++;
+  if (pos != text.size ())
+    unsupported ();
+  return result;
+}
+
+// Return the next non-space character of text at pos, or NUL at the end.
+inline char
+peek (const std::string & text, size_t & pos)
+{
+  while (pos < text.size () && std::isspace (text[pos]))
+    pos++;
+  return pos < text.size () ? text[pos] : '\0';
+}
+
+const Node *
+Assembly::additive (const std::string & text, size_t & pos)
+{
+  const Node * left = bitwise (text, pos);
+  for (char c = peek (text, pos); c == '+' || c == '-'; c = peek (text, pos))
+    {
+      pos++;
+      left = node (Node::BINARY, c, left, bitwise (text, pos));
+    }
+  return left;
+}
+
+const Node *
+Assembly::bitwise (const std::string & text, size_t & pos)
+{
+  const Node * left = multiplicative (text, pos);
+  for (char c = peek (text, pos);
+       c == '&' || c == '|' || c == '^'; c = peek (text, pos))
+    {
+      pos++;
+      left = node (Node::BINARY, c, left, multiplicative (text, pos));
+    }
+  return left;
+}
+
+const Node *
+Assembly::multiplicative (const std::string & text, size_t & pos)
+{
+  const Node * left = unary (text, pos);
+  for (char c = peek (text, pos);
+       c == '*' || c == '/' || c == '%' || c == '<' || c == '>';
+       c = peek (text, pos))
+    {
+      pos++;
+      if (c == '<' || c == '>')
+        {
+          if (pos >= text.size () || text[pos] != c)
+            unsupported ();
+          pos++;
+        }
+      left = node (Node::BINARY, c, left, unary (text, pos));
+    }
+  return left;
+}
+
+const Node *
+Assembly::unary (const std::string & text, size_t & pos)
+{
+  const char c = peek (text, pos);
+  if (c == '-' || c == '~')
+    {
+      pos++;
+      return node (c == '-' ? Node::NEGATE : Node::COMPLEMENT, c,
+                   unary (text, pos), 0);
+    }
+  if (c == '+')
+    {
+      pos++;
+      return unary (text, pos);
+    }
+  return primary (text, pos);
+}
+
+const Node *
+Assembly::primary (const std::string & text, size_t & pos)
+{
+  const char c = peek (text, pos);
+
+  if (c == '(' || c == '[')
+    {
+      pos++;
+      const Node * inner = additive (text, pos);
+      if (peek (text, pos) != (c == '(' ? ')' : ']'))
+        unsupported ();
+      pos++;
+      return inner;
+    }
+
+  Node n = { Node::NUMBER, 0, 0, NO_MODIFIER, 0, 0, 0 };
+
+  if (std::isdigit (c))
+    {
+      size_t end = pos;
+      while (end < text.size () && std::isalnum (text[end]))
+        end++;
+      const std::string token = text.substr (pos, end - pos);
+      pos = end;
+
+      // A numeric local label reference, such as 1b or 2f.
+      const char last = token[token.size () - 1];
+      if ((last == 'b' || last == 'f')
+          && token.find_first_not_of ("0123456789") == token.size () - 1)
+        {
+          n.kind = Node::SYMBOL;
+          const std::string digits = token.substr (0, token.size () - 1);
+          n.symbol = symbol (numeric_label (digits, last));
+          nodes_.push_back (n);
+          return &nodes_.back ();
+        }
+
+      int base = 10;
+      size_t start = 0;
+      if (token.size () > 2 && token[0] == '0'
+          && (token[1] == 'x' || token[1] == 'X'))
+        base = 16, start = 2;
+      else if (token.size () > 2 && token[0] == '0'
+               && (token[1] == 'b' || token[1] == 'B'))
+        base = 2, start = 2;
+      else if (token.size () > 1 && token[0] == '0')
+        base = 8, start = 1;
+
+      for (size_t i = start; i < token.size (); ++i)
+        {
+          const char d = std::tolower (token[i]);
+          const int digit = std::isdigit (d) ? d - '0'
+                            : (std::isalpha (d) ? d - 'a' + 10 : 99);
+          if (digit >= base)
+            unsupported ();
+          n.number = n.number * base + digit;
+        }
+    }
+  else if (c == '\'' && pos + 1 < text.size ())
+    {
+      n.number = static_cast<unsigned char>(text[pos + 1]);
+      pos += 2;
+      if (pos < text.size () && text[pos] == '\'')
+        pos++;
+    }
+  else if (c == '.' && (pos + 1 >= text.size ()
+                        || !is_symbol_char (text[pos + 1])))
+    {
+      pos++;
+      n.kind = Node::DOT;
+    }
+  else if (is_symbol_start (c))
+    {
+      size_t end = pos;
+      while (end < text.size () && is_symbol_char (text[end]))
+        end++;
+      n.kind = Node::SYMBOL;
+      n.symbol = symbol (text.substr (pos, end - pos));
+      pos = end;
+
+      if (pos < text.size () && text[pos] == '@')
+        {
+          end = ++pos;
+          while (end < text.size () && std::isalnum (text[end]))
+            end++;
+          const std::string modifier = text.substr (pos, end - pos);
+          pos = end;
+
+          if (modifier == "GOT")
+            n.modifier = GOT;
+          else if (modifier == "GOTOFF")
+            n.modifier = GOTOFF;
+          else if (modifier == "PLT")
+            n.modifier = PLT;
+          else
+            unsupported ();
+        }
+    }
+  else
+    unsupported ();
+
+  nodes_.push_back (n);
+  return &nodes_.back ();
+}
+
+// Return true and the value if an expression contains no symbols.
+bool
+Assembly::constant (const Node * node, long long * value) const
+{
+  long long left = 0, right = 0;
+
+  switch (node->kind)
+    {
+    case Node::NUMBER:
+      *value = node->number;
+      return true;
+
+    case Node::NEGATE:
+    case Node::COMPLEMENT:
+      if (!constant (node->left, &left))
+        return false;
+      *value = node->kind == Node::NEGATE ? -left : ~left;
+      return true;
+
+    case Node::BINARY:
+      if (!constant (node->left, &left) || !constant (node->right, &right))
+        return false;
+      switch (node->op)
+        {
+        case '+': *value = left + right; return true;
+        case '-': *value = left - right; return true;
+        case '*': *value = left * right; return true;
+        case '&': *value = left & right; return true;
+        case '|': *value = left | right; return true;
+        case '^': *value = left ^ right; return true;
+        case '<': *value = left << right; return true;
+        case '>': *value = left >> right; return true;
+        case '/':
+        case '%':
+          if (right == 0)
+            unsupported ();
+          *value = node->op == '/' ? left / right : left % right;
+          return true;
+        }
+      return false;
+
+    default:
+      return false;
+    }
+}
+
+long long
+Assembly::constant (const std::string & text)
+{
+  long long value;
+  if (!constant (expression (text), &value))
+    unsupported ();
+  return value;
+}
+
+// Address of a label, within its section.
+size_t
+Assembly::address (const AsmSymbol * symbol) const
+{
+  return sections_[symbol->section_].address (symbol->fragment_);
+}
+
+// True if symbol is a label whose address is fixed within section.
+bool
+Assembly::local_to (const AsmSymbol * symbol, size_t section) const
+{
+  return !symbol->external () && symbol->section_ == section;
+}
+
+// Evaluate an expression, using current layout addresses.  A difference of
+// labels in the same section is absolute; anything else that is not a
+// symbol plus or minus a constant is unsupported.
+Value
+Assembly::evaluate (const Node * node, const AsmSymbol * dot)
+{
+  Value value = { 0, 0, 0, NO_MODIFIER };
+
+  switch (node->kind)
+    {
+    case Node::NUMBER:
+      value.addend = node->number;
+      break;
+
+    case Node::DOT:
+      if (!dot)
+        unsupported ();
+      value.add = dot;
+      break;
+
+    case Node::SYMBOL:
+      if (node->symbol->state_ == AsmSymbol::EQUATED)
+        {
+          AsmSymbol * equated = node->symbol;
+          if (equated->evaluating_ || node->modifier != NO_MODIFIER)
+            unsupported ();
+          equated->evaluating_ = true;
+          value = evaluate (equated->equation_, 0);
+          equated->evaluating_ = false;
+        }
+      else
+        {
+          value.add = node->symbol;
+          value.modifier = node->modifier;
+        }
+      break;
+
+    case Node::NEGATE:
+    case Node::COMPLEMENT:
+      value = evaluate (node->left, dot);
+      if (value.add || value.sub || value.modifier != NO_MODIFIER)
+        unsupported ();
+      value.addend = node->kind == Node::NEGATE
+                     ? -value.addend : ~value.addend;
+      break;
+
+    case Node::BINARY:
+      {
+        const Value left = evaluate (node->left, dot);
+        const Value right = evaluate (node->right, dot);
+
+        if (node->op == '+')
+          {
+            if ((left.add && right.add) || (left.sub && right.sub)
+                || (left.modifier && right.modifier))
+              unsupported ();
+            value.addend = left.addend + right.addend;
+            value.add = left.add ? left.add : right.add;
+            value.sub = left.sub ? left.sub : right.sub;
+            value.modifier = left.modifier ? left.modifier : right.modifier;
+          }
+        else if (node->op == '-')
+          {
+            if ((left.add && right.sub) || (left.sub && right.add)
+                || right.modifier)
+              unsupported ();
+            value.addend = left.addend - right.addend;
+            value.add = left.add ? left.add : right.sub;
+            value.sub = left.sub ? left.sub : right.add;
+            value.modifier = left.modifier;
+          }
+        else
+          {
+            if (left.add || left.sub || right.add || right.sub
+                || left.modifier || right.modifier)
+              unsupported ();
+            const Node l = { Node::NUMBER, left.addend, 0,
+                             NO_MODIFIER, 0, 0, 0 };
+            const Node r = { Node::NUMBER, right.addend, 0,
+                             NO_MODIFIER, 0, 0, 0 };
+            const Node n = { Node::BINARY, 0, 0, NO_MODIFIER, node->op,
+                             &l, &r };
+            constant (&n, &value.addend);
+          }
+      }
+      break;
+    }
+
+  // Reduce a difference of two labels in the same section to a constant.
+  if (value.add && value.sub)
+    {
+      if (value.modifier != NO_MODIFIER
+          || value.add->state_ != AsmSymbol::LABEL
+          || value.sub->state_ != AsmSymbol::LABEL
+          || value.add->section_ != value.sub->section_)
+        unsupported ();
+      value.addend += static_cast<long long>(address (value.add))
+                      - static_cast<long long>(address (value.sub));
+      value.add = value.sub = 0;
+    }
+  return value;
+}
+
+// Split the text into statements, at newlines and semicolons, and with
+// comments removed.  A '#' starts a comment anywhere, and a '/' at the
+// start of a line makes the whole line a comment.
+void
+Assembly::parse (const std::string & assembly)
+{
+  std::string text;
+  bool quoted = false, comment = false, line_start = true;
+
+  for (size_t i = 0; i <= assembly.size (); ++i)
+    {
+      char c = i < assembly.size () ? assembly[i] : '\n';
+
+      if (c == '\n')
+        {
+          statement (text);
+          text.clear ();
+          quoted = comment = false;
+          line_start = true;
+          continue;
+        }
+      if (comment)
+        continue;
+
+      if (quoted)
+        {
+          if (c == '\\' && i + 1 < assembly.size ())
+            text += c, c = assembly[++i];
+          else if (c == '"')
+            quoted = false;
+        }
+      else if (c == '"')
+        quoted = true;
+      else if (c == '#' || (c == '/' && line_start))
+        {
+          comment = true;
+          continue;
+        }
+      else if (c == ';')
+        {
+          statement (text);
+          text.clear ();
+          continue;
+        }
+
+      if (!std::isspace (c))
+        line_start = false;
+      text += c;
+    }
+}
+
+// Handle one statement, any labels, then an assignment, a directive, or an
+// instruction.
+void
+Assembly::statement (const std::string & text)
+{
+  std::string s = trim (text);
+
+  for (;;)
+    {
+      size_t n = 0;
+      if (!s.empty () && std::isdigit (s[0]))
+        {
+          while (n < s.size () && std::isdigit (s[n]))
+            n++;
+          if (n < s.size () && s[n] == ':')
+            {
+              define_label (numeric_label (s.substr (0, n), 0));
+              s = trim (s.substr (n + 1));
+              continue;
+            }
+          break;
+        }
+
+      if (s.empty () || !is_symbol_start (s[0]))
+        break;
+      while (n < s.size () && is_symbol_char (s[n]))
+        n++;
+
+      const size_t next = s.find_first_not_of (" \t", n);
+      if (n < s.size () && s[n] == ':')
+        {
+          define_label (s.substr (0, n));
+          s = trim (s.substr (n + 1));
+          continue;
+        }
+      if (next != s.npos && s[next] == '='
+          && (next + 1 >= s.size () || s[next + 1] != '='))
+        {
+          AsmSymbol * equated = symbol (s.substr (0, n));
+          if (equated->state_ == AsmSymbol::LABEL
+              || equated->state_ == AsmSymbol::COMMON)
+            unsupported ();
+          equated->state_ = AsmSymbol::EQUATED;
+          equated->equation_ = expression (s.substr (next + 1));
+          return;
+        }
+      break;
+    }
+
+  if (s.empty ())
+    return;
+
+  const size_t space = s.find_first_of (" \t");
+  const std::string name = s.substr (0, space);
+  const std::string rest = space == s.npos ? "" : trim (s.substr (space));
+
+  if (name[0] == '.')
+    directive (name, split (rest));
+  else if (name == "rep" || name == "repe" || name == "repz"
+           || name == "repne" || name == "repnz" || name == "lock")
+    {
+      prefixes_.push_back (name == "lock" ? 0xf0
+                           : (name == "repne" || name == "repnz" ? 0xf2
+                                                                 : 0xf3));
+      statement (rest);
+      if (!prefixes_.empty ())
+        unsupported ();
+    }
+  else
+    instruction (name, split (rest));
+}
+
+// Handle an assembler directive.
+void
+Assembly::directive (const std::string & name,
+                     const std::vector<std::string> & args)
+{
+  Section * current = &sections_[current_];
+
+  if (name == ".text" || name == ".data" || name == ".bss")
+    {
+      if (!args.empty ())
+        unsupported ();
+      current_ = name == ".text" ? 0 : (name == ".data" ? 1 : 2);
+    }
+  else if (name == ".section")
+    {
+      if (args.empty ())
+        unsupported ();
+      const std::string & section_name = args[0];
+
+      Elf32_Word type = SHT_PROGBITS, flags = 0, entsize = 0;
+      if (section_name.compare (0, 5, ".text") == 0)
+        flags = SHF_ALLOC | SHF_EXECINSTR;
+      else if (section_name.compare (0, 5, ".data") == 0)
+        flags = SHF_ALLOC | SHF_WRITE;
+      else if (section_name.compare (0, 4, ".bss") == 0)
+        type = SHT_NOBITS, flags = SHF_ALLOC | SHF_WRITE;
+      else if (section_name.compare (0, 7, ".rodata") == 0)
+        flags = SHF_ALLOC;
+      else if (section_name.compare (0, 5, ".note") == 0)
+        type = SHT_NOTE;
+
+      if (args.size () > 1)
+        {
+          flags = 0;
+          const std::string attributes = unquote (args[1]);
+          for (size_t i = 0; i < attributes.size (); ++i)
+            {
+              switch (attributes[i])
+                {
+                case 'a': flags |= SHF_ALLOC; break;
+                case 'w': flags |= SHF_WRITE; break;
+                case 'x': flags |= SHF_EXECINSTR; break;
+                case 'M': flags |= SHF_MERGE; break;
+                case 'S': flags |= SHF_STRINGS; break;
+                default: unsupported ();
+                }
+            }
+        }
+      if (args.size () > 2)
+        {
+          if (args[2] == "@progbits")
+            type = SHT_PROGBITS;
+          else if (args[2] == "@nobits")
+            type = SHT_NOBITS;
+          else if (args[2] == "@note")
+            type = SHT_NOTE;
+          else
+            unsupported ();
+        }
+      if (args.size () > 3)
+        entsize = constant (args[3]);
+      if (args.size () > 4 || ((flags & SHF_MERGE) && !entsize))
+        unsupported ();
+
+      current_ = section (section_name, type, flags);
+      if (sections_[current_].type_ != type
+          || sections_[current_].flags_ != flags)
+        unsupported ();
+      sections_[current_].entsize_ = entsize;
+    }
+  else if (name == ".file")
+    {
+      if (args.size () != 1)
+        unsupported ();
+      file_name_ = unquote (args[0]);
+    }
+  else if (name == ".version")
+    {
+      if (args.size () != 1)
+        unsupported ();
+      const std::string version = unquote (args[0]);
+
+      // An ELF note, named by the version string, with no descriptor.
+      Section & note = sections_[section (".note", SHT_NOTE, 0)];
+      note.alignment_ = 4;
+      Fragment fragment (Fragment::FIXED);
+      append (fragment.bytes_, version.size () + 1, 4);
+      append (fragment.bytes_, 0, 4);
+      append (fragment.bytes_, 1, 4);
+      fragment.bytes_.insert (fragment.bytes_.end (),
+                              version.begin (), version.end ());
+      fragment.bytes_.resize ((fragment.bytes_.size () + 4) & ~3, 0);
+      note.fragments_.push_back (fragment);
+    }
+  else if (name == ".ident")
+    {
+      if (args.size () != 1)
+        unsupported ();
+      const std::string ident = unquote (args[0]);
+
+      if (!comment_)
+        {
+          comment_ = section (".comment", SHT_PROGBITS,
+                              SHF_MERGE | SHF_STRINGS);
+          sections_[comment_].entsize_ = 1;
+          Fragment empty (Fragment::FIXED);
+          empty.bytes_.push_back (0);
+          sections_[comment_].fragments_.push_back (empty);
+        }
+      Fragment fragment (Fragment::FIXED);
+      fragment.bytes_.assign (ident.begin (), ident.end ());
+      fragment.bytes_.push_back (0);
+      sections_[comment_].fragments_.push_back (fragment);
+    }
+  else if (name == ".globl" || name == ".global" || name == ".weak"
+           || name == ".local")
+    {
+      for (size_t i = 0; i < args.size (); ++i)
+        {
+          AsmSymbol * declared = symbol (args[i]);
+          if (name == ".weak")
+            declared->binding_ = STB_WEAK;
+          else if (name == ".local")
+            declared->binding_ = STB_LOCAL;
+          else if (declared->binding_ != STB_WEAK)
+            declared->binding_ = STB_GLOBAL;
+        }
+    }
+  else if (name == ".type")
+    {
+      if (args.size () != 2)
+        unsupported ();
+      AsmSymbol * typed = symbol (args[0]);
+      if (args[1] == "@function" || args[1] == "STT_FUNC")
+        typed->type_ = STT_FUNC;
+      else if (args[1] == "@object" || args[1] == "STT_OBJECT")
+        typed->type_ = STT_OBJECT;
+      else if (args[1] == "@notype" || args[1] == "STT_NOTYPE")
+        typed->type_ = STT_NOTYPE;
+      else
+        unsupported ();
+    }
+  else if (name == ".size")
+    {
+      if (args.size () != 2)
+        unsupported ();
+      symbol (args[0])->size_ = expression (args[1]);
+    }
+  else if (name == ".comm")
+    {
+      if (args.size () < 2 || args.size () > 3)
+        unsupported ();
+      AsmSymbol * common = symbol (args[0]);
+      if (common->state_ != AsmSymbol::UNDEFINED)
+        unsupported ();
+
+      common->state_ = AsmSymbol::COMMON;
+      common->type_ = STT_OBJECT;
+      common->common_size_ = constant (args[1]);
+      common->common_alignment_ = args.size () > 2 ? constant (args[2]) : 1;
+      if (args.size () < 3)
+        {
+          while (common->common_alignment_ < 16
+                 && common->common_alignment_ * 2 <= common->common_size_)
+            common->common_alignment_ *= 2;
+        }
+    }
+  else if (name == ".align" || name == ".balign" || name == ".p2align")
+    {
+      if (args.empty () || args.size () > 2)
+        unsupported ();
+      long long alignment = constant (args[0]);
+      if (name == ".p2align")
+        alignment = 1LL << alignment;
+      if (alignment < 1 || (alignment & (alignment - 1)))
+        unsupported ();
+
+      Fragment fragment (Fragment::ALIGN);
+      fragment.alignment_ = alignment;
+      fragment.nop_fill_ = (current->flags_ & SHF_EXECINSTR)
+                           && args.size () < 2;
+      fragment.fill_ = args.size () > 1 ? constant (args[1]) : 0;
+      current->fragments_.push_back (fragment);
+      if (current->alignment_ < static_cast<size_t>(alignment))
+        current->alignment_ = alignment;
+    }
+  else if (name == ".string" || name == ".asciz" || name == ".ascii")
+    {
+      Fragment fragment (Fragment::FIXED);
+      for (size_t i = 0; i < args.size (); ++i)
+        {
+          const std::string str = unquote (args[i]);
+          fragment.bytes_.insert (fragment.bytes_.end (),
+                                  str.begin (), str.end ());
+          if (name != ".ascii")
+            fragment.bytes_.push_back (0);
+        }
+      current->fragments_.push_back (fragment);
+    }
+  else if (name == ".byte" || name == ".short" || name == ".value"
+           || name == ".word" || name == ".long" || name == ".int")
+    {
+      const int size = name == ".byte" ? 1 : (name == ".long"
+                                              || name == ".int" ? 4 : 2);
+      Fragment fragment (Fragment::FIXED);
+      fragment.data_ = true;
+      for (size_t i = 0; i < args.size (); ++i)
+        field (fragment, expression (args[i]), size, false);
+      current->fragments_.push_back (fragment);
+    }
+  else if (name == ".zero" || name == ".skip" || name == ".space")
+    {
+      if (args.empty () || args.size () > 2)
+        unsupported ();
+      Fragment fragment (Fragment::FIXED);
+      fragment.bytes_.resize (constant (args[0]),
+                              args.size () > 1 ? constant (args[1]) : 0);
+      current->fragments_.push_back (fragment);
+    }
+  else if (name == ".stabs")
+    {
+      if (args.empty ())
+        unsupported ();
+      stab (unquote (args[0]),
+            std::vector<std::string> (args.begin () + 1, args.end ()));
+    }
+  else if (name == ".stabn")
+    stab ("", args);
+  else if (name == ".set" || name == ".equ")
+    {
+      if (args.size () != 2)
+        unsupported ();
+      statement (args[0] + "=" + args[1]);
+    }
+  else
+    unsupported ();
+}
+
+// Add a stabs debugging entry.  The .stab section begins with a header
+// entry giving the count of entries and the size of .stabstr, whose first
+// string is the source file name.
+void
+Assembly::stab (const std::string & str, const std::vector<std::string> & args)
+{
+  if (args.size () != 4)
+    unsupported ();
+
+  if (!stab_)
+    {
+      if (file_name_.empty ())
+        unsupported ();
+
+      stab_ = section (".stab", SHT_PROGBITS, 0);
+      stabstr_ = section (".stabstr", SHT_STRTAB, 0);
+      sections_[stab_].entsize_ = 12;
+      sections_[stab_].alignment_ = 4;
+      sections_[stab_].link_ = stabstr_;
+
+      Fragment header (Fragment::FIXED);
+      header.bytes_.resize (12, 0);
+      sections_[stab_].fragments_.push_back (header);
+
+      Fragment strings (Fragment::FIXED);
+      strings.bytes_.push_back (0);
+      strings.bytes_.insert (strings.bytes_.end (),
+                             file_name_.begin (), file_name_.end ());
+      strings.bytes_.push_back (0);
+      sections_[stabstr_].fragments_.push_back (strings);
+    }
+
+  std::vector<unsigned char> & strings
+      = sections_[stabstr_].fragments_.back ().bytes_;
+  const size_t strx = str.empty () ? 0 : strings.size ();
+  if (!str.empty ())
+    {
+      strings.insert (strings.end (), str.begin (), str.end ());
+      strings.push_back (0);
+    }
+
+  Fragment entry (Fragment::FIXED);
+  append (entry.bytes_, strx, 4);
+  append (entry.bytes_, constant (args[0]), 1);
+  append (entry.bytes_, constant (args[1]), 1);
+  append (entry.bytes_, constant (args[2]), 2);
+  field (entry, expression (args[3]), 4, false);
+  sections_[stab_].fragments_.push_back (entry);
+}
+
+// Parse an instruction operand.
+Operand
+Assembly::operand (const std::string & text)
+{
+  Operand op = { Operand::MEMORY, 0, 0, 0, -1, -1, 1, false };
+  std::string s = text;
+
+  if (!s.empty () && s[0] == '*')
+    {
+      op.indirect = true;
+      s = trim (s.substr (1));
+    }
+  if (s.empty ())
+    unsupported ();
+
+  if (s[0] == '%')
+    {
+      const std::string name = s.substr (1);
+      if (name == "st" || name == "st(0)")
+        {
+          op.kind = Operand::FPU_REGISTER;
+          return op;
+        }
+      if (name.size () == 5 && name.compare (0, 3, "st(") == 0
+          && name[3] >= '0' && name[3] <= '7' && name[4] == ')')
+        {
+          op.kind = Operand::FPU_REGISTER;
+          op.reg = name[3] - '0';
+          return op;
+        }
+
+      for (int i = 0; REGISTERS[i].name; ++i)
+        {
+          if (name == REGISTERS[i].name)
+            {
+              op.kind = Operand::REGISTER;
+              op.reg = REGISTERS[i].number;
+              op.size = REGISTERS[i].size;
+              return op;
+            }
+        }
+      unsupported ();
+    }
+
+  if (s[0] == '$')
+    {
+      if (op.indirect)
+        unsupported ();
+      op.kind = Operand::IMMEDIATE;
+      op.expression = expression (s.substr (1));
+      return op;
+    }
+
+  // Memory, with an optional (base,index,scale) after any displacement.
+  size_t open = s.npos;
+  if (s[s.size () - 1] == ')')
+    {
+      int depth = 0;
+      for (size_t i = s.size (); i-- > 0; )
+        {
+          if (s[i] == ')')
+            depth++;
+          else if (s[i] == '(' && --depth == 0)
+            {
+              open = i;
+              break;
+            }
+        }
+      const std::string inner = trim (s.substr (open + 1));
+      if (open == s.npos || (inner[0] != '%' && inner[0] != ','))
+        open = s.npos;
+    }
+
+  if (open != s.npos)
+    {
+      const std::vector<std::string> parts
+          = split (s.substr (open + 1, s.size () - open - 2));
+      if (parts.empty () || parts.size () > 3)
+        unsupported ();
+
+      for (size_t i = 0; i < parts.size () && i < 2; ++i)
+        {
+          if (parts[i].empty ())
+            continue;
+          const Operand reg = operand (parts[i]);
+          if (reg.kind != Operand::REGISTER || reg.size != 4)
+            unsupported ();
+          (i == 0 ? op.base : op.index) = reg.reg;
+        }
+      if (parts.size () > 2)
+        {
+          op.scale = constant (parts[2]);
+          if (op.scale != 1 && op.scale != 2
+              && op.scale != 4 && op.scale != 8)
+            unsupported ();
+        }
+      if (op.index == ESP || (parts.size () > 1 && op.index < 0))
+        unsupported ();
+      s = trim (s.substr (0, open));
+    }
+
+  if (!s.empty ())
+    op.expression = expression (s);
+  else if (open == s.npos)
+    unsupported ();
+  return op;
+}
+
+// Start an instruction's fixed fragment, with any pending prefixes.
+Fragment &
+Assembly::begin_instruction ()
+{
+  Section & current = sections_[current_];
+  current.fragments_.push_back (Fragment (Fragment::FIXED));
+  current.fragments_.back ().bytes_ = prefixes_;
+  prefixes_.clear ();
+  return current.fragments_.back ();
+}
+
+// Add an expression field to a fragment, as a value now if constant, or
+// otherwise as a fixup to be resolved once the layout is known.
+void
+Assembly::field (Fragment & fragment, const Node * expression, int size,
+                 bool pc_relative, bool got32x)
+{
+  long long value;
+  if (!pc_relative && constant (expression, &value))
+    {
+      append (fragment.bytes_, value, size);
+      return;
+    }
+
+  const Fixup fixup = { fragment.bytes_.size (), size, expression,
+                        pc_relative, got32x };
+  fragment.fixups_.push_back (fixup);
+  append (fragment.bytes_, 0, size);
+}
+
+void
+Assembly::immediate (Fragment & fragment, const Operand & imm, int size)
+{
+  if (imm.kind != Operand::IMMEDIATE)
+    unsupported ();
+  field (fragment, imm.expression, size, false);
+}
+
+// Encode a ModRM byte, and any SIB byte and displacement, for a register
+// field of reg and the register or memory operand rm.
+void
+Assembly::modrm (Fragment & fragment, int reg, const Operand & rm,
+                 bool got32x)
+{
+  std::vector<unsigned char> & bytes = fragment.bytes_;
+
+  if (rm.kind == Operand::REGISTER)
+    {
+      bytes.push_back (0xc0 | reg << 3 | rm.reg);
+      return;
+    }
+  if (rm.kind != Operand::MEMORY)
+    unsupported ();
+
+  long long disp = 0;
+  const bool known = !rm.expression || constant (rm.expression, &disp);
+
+  if (rm.base < 0 && rm.index < 0)
+    {
+      bytes.push_back (0x05 | reg << 3);
+      field (fragment, rm.expression, 4, false, got32x);
+      return;
+    }
+
+  int mod = 2;
+  if (rm.base < 0)
+    mod = 0;
+  else if (known && disp == 0 && rm.base != EBP)
+    mod = 0;
+  else if (known && fits8 (disp))
+    mod = 1;
+
+  if (rm.index >= 0 || rm.base == ESP)
+    {
+      const int scale = rm.scale == 8 ? 3 : rm.scale / 2;
+      bytes.push_back (mod << 6 | reg << 3 | 4);
+      bytes.push_back (scale << 6 | (rm.index >= 0 ? rm.index : 4) << 3
+                       | (rm.base >= 0 ? rm.base : 5));
+    }
+  else
+    bytes.push_back (mod << 6 | reg << 3 | rm.base);
+
+  if (mod == 1)
+    append (bytes, disp, 1);
+  else if (mod == 2 || rm.base < 0)
+    {
+      if (rm.expression)
+        field (fragment, rm.expression, 4, false, got32x);
+      else
+        append (bytes, 0, 4);
+    }
+}
+
+// Add a relaxable branch, jmp or jcc.  Its size is set during layout.
+void
+Assembly::branch (unsigned char opcode, const Operand & target)
+{
+  if (target.kind != Operand::MEMORY || target.indirect
+      || target.base >= 0 || target.index >= 0 || !prefixes_.empty ())
+    unsupported ();
+
+  Fragment fragment (Fragment::BRANCH);
+  fragment.opcode_ = opcode;
+  fragment.target_ = target.expression;
+  sections_[current_].fragments_.push_back (fragment);
+}
+
+// Handle an instruction, by way of its operands and mnemonic tables.
+void
+Assembly::instruction (const std::string & mnemonic,
+                       const std::vector<std::string> & args)
+{
+  std::vector<Operand> operands;
+  for (size_t i = 0; i < args.size (); ++i)
+    operands.push_back (operand (args[i]));
+
+  // Instructions without operands.
+  for (int i = 0; SIMPLE_INSTRUCTIONS[i].name; ++i)
+    {
+      if (mnemonic == SIMPLE_INSTRUCTIONS[i].name && operands.empty ())
+        {
+          Fragment & fragment = begin_instruction ();
+          const char * encoding = SIMPLE_INSTRUCTIONS[i].encoding;
+          fragment.bytes_.insert (fragment.bytes_.end (), encoding,
+                                  encoding + std::strlen (encoding));
+          return;
+        }
+    }
+
+  // Floating point, with memory or %st(i) operands.
+  for (int i = 0; FLOAT_INSTRUCTIONS[i].name; ++i)
+    {
+      const FloatInstruction & fi = FLOAT_INSTRUCTIONS[i];
+      if (mnemonic != fi.name)
+        continue;
+
+      if (operands.size () != 1)
+        unsupported ();
+      Fragment & fragment = begin_instruction ();
+      if (fi.prefix)
+        fragment.bytes_.push_back (fi.prefix);
+
+      if ((mnemonic == "fnstsw" || mnemonic == "fstsw")
+          && operands[0].kind == Operand::REGISTER)
+        {
+          if (operands[0].reg != EAX || operands[0].size != 2)
+            unsupported ();
+          fragment.bytes_.push_back (0xdf);
+          fragment.bytes_.push_back (0xe0);
+          return;
+        }
+      if (operands[0].kind != Operand::MEMORY || operands[0].indirect)
+        unsupported ();
+      fragment.bytes_.push_back (fi.opcode);
+      modrm (fragment, fi.digit, operands[0]);
+      return;
+    }
+
+  for (int i = 0; FLOAT_REGISTER_INSTRUCTIONS[i].name; ++i)
+    {
+      const FloatRegisterInstruction & fi = FLOAT_REGISTER_INSTRUCTIONS[i];
+      if (mnemonic != fi.name)
+        continue;
+
+      if (operands.size () != 1 || operands[0].kind != Operand::FPU_REGISTER)
+        unsupported ();
+      Fragment & fragment = begin_instruction ();
+      fragment.bytes_.push_back (fi.opcode);
+      fragment.bytes_.push_back (fi.base + operands[0].reg);
+      return;
+    }
+
+  if ((mnemonic == "fadd" || mnemonic == "fmul" || mnemonic == "faddp"
+       || mnemonic == "fmulp") && operands.size () == 2
+      && operands[0].kind == Operand::FPU_REGISTER
+      && operands[1].kind == Operand::FPU_REGISTER)
+    {
+      // Of the two operands, one must be %st.
+      const bool popping = mnemonic[mnemonic.size () - 1] == 'p';
+      const int base = mnemonic.compare (0, 4, "fadd") == 0 ? 0xc0 : 0xc8;
+      Fragment & fragment = begin_instruction ();
+      if (operands[1].reg == 0 && !popping)
+        {
+          fragment.bytes_.push_back (0xd8);
+          fragment.bytes_.push_back (base + operands[0].reg);
+        }
+      else if (operands[0].reg == 0)
+        {
+          fragment.bytes_.push_back (popping ? 0xde : 0xdc);
+          fragment.bytes_.push_back (base + operands[1].reg);
+        }
+      else
+        unsupported ();
+      return;
+    }
+
+  // Conditional jumps, sets, and moves.
+  for (int i = 0; CONDITIONS[i].name; ++i)
+    {
+      const std::string condition = CONDITIONS[i].name;
+      const int code = CONDITIONS[i].code;
+
+      if (mnemonic == "j" + condition)
+        {
+          if (operands.size () != 1)
+            unsupported ();
+          branch (0x70 | code, operands[0]);
+          return;
+        }
+      if (mnemonic == "set" + condition)
+        {
+          if (operands.size () != 1
+              || (operands[0].kind == Operand::REGISTER
+                  && operands[0].size != 1))
+            unsupported ();
+          Fragment & fragment = begin_instruction ();
+          fragment.bytes_.push_back (0x0f);
+          fragment.bytes_.push_back (0x90 | code);
+          modrm (fragment, 0, operands[0]);
+          return;
+        }
+      if (mnemonic == "cmov" + condition
+          || mnemonic == "cmov" + condition + "l")
+        {
+          if (operands.size () != 2 || operands[1].kind != Operand::REGISTER
+              || operands[1].size != 4
+              || (operands[0].kind == Operand::REGISTER
+                  && operands[0].size != 4))
+            unsupported ();
+          Fragment & fragment = begin_instruction ();
+          fragment.bytes_.push_back (0x0f);
+          fragment.bytes_.push_back (0x40 | code);
+          modrm (fragment, operands[1].reg, operands[0]);
+          return;
+        }
+    }
+
+  // Everything else, with an optional b, w, or l size suffix.
+  if (general_instruction (mnemonic, 0, operands))
+    return;
+
+  const char last = mnemonic.empty () ? '\0' : mnemonic[mnemonic.size () - 1];
+  const int suffix = last == 'b' ? 1
+                     : (last == 'w' ? 2 : (last == 'l' ? 4 : 0));
+  if (suffix
+      && general_instruction (mnemonic.substr (0, mnemonic.size () - 1),
+                              suffix, operands))
+    return;
+
+  unsupported ();
+}
+
+// Handle instructions whose operand size comes from a suffix or from their
+// register operands.  Return false if the mnemonic is not one of these.
+bool
+Assembly::general_instruction (const std::string & name, int suffix,
+                               const std::vector<Operand> & operands)
+{
+  const size_t count = operands.size ();
+
+  // Operand size, from any suffix, else registers, else the default.
+  int size = suffix;
+  for (size_t i = 0; i < count; ++i)
+    {
+      const Operand & op = operands[i];
+      if (op.kind == Operand::FPU_REGISTER
+          || (op.kind == Operand::MEMORY && op.indirect))
+        unsupported ();
+      if (op.kind != Operand::REGISTER)
+        continue;
+
+      // Shift counts in %cl, and movzx/movsx sources, are not sized.
+      if ((find (SHIFTS, name) >= 0 && i == 0 && count == 2)
+          || name.compare (0, 4, "movz") == 0
+          || name.compare (0, 4, "movs") == 0)
+        continue;
+
+      if (size && size != op.size)
+        unsupported ();
+      size = op.size;
+    }
+  if (!size)
+    size = 4;
+
+  const bool word = size == 2;
+  const int wide = size == 1 ? 0 : 1;
+
+  // Direct and indirect calls and jumps.
+  if (name == "call" || name == "jmp")
+    {
+      if (count != 1 || (suffix && suffix != 4))
+        return false;
+      const Operand & target = operands[0];
+
+      if (target.kind == Operand::REGISTER || target.indirect)
+        {
+          if (target.kind == Operand::REGISTER
+              && (!target.indirect || target.size != 4))
+            unsupported ();
+          Fragment & fragment = begin_instruction ();
+          fragment.bytes_.push_back (0xff);
+          modrm (fragment, name == "call" ? 2 : 4, target, true);
+        }
+      else if (name == "call")
+        {
+          if (target.base >= 0 || target.index >= 0)
+            unsupported ();
+          Fragment & fragment = begin_instruction ();
+          fragment.bytes_.push_back (0xe8);
+          field (fragment, target.expression, 4, true);
+        }
+      else
+        branch (0xeb, target);
+      return true;
+    }
+
+  if (name == "loop" || name == "loope" || name == "loopz"
+      || name == "loopne" || name == "loopnz" || name == "jecxz")
+    {
+      if (count != 1 || suffix)
+        return false;
+      branch (name == "jecxz" ? 0xe3
+              : (name == "loop" ? 0xe2
+                 : (name == "loope" || name == "loopz" ? 0xe1 : 0xe0)),
+              operands[0]);
+      return true;
+    }
+
+  if (name == "int" || name == "ret")
+    {
+      if (count != 1 || suffix || operands[0].kind != Operand::IMMEDIATE)
+        return false;
+      Fragment & fragment = begin_instruction ();
+      fragment.bytes_.push_back (name == "int" ? 0xcd : 0xc2);
+      immediate (fragment, operands[0], name == "int" ? 1 : 2);
+      return true;
+    }
+
+  // Arithmetic group.
+  const int arithmetic = find (ARITHMETIC, name);
+  if (arithmetic >= 0)
+    {
+      if (count != 2 || operands[1].kind == Operand::IMMEDIATE)
+        unsupported ();
+      const Operand & src = operands[0];
+      const Operand & dst = operands[1];
+
+      Fragment & fragment = begin_instruction ();
+      if (word)
+        fragment.bytes_.push_back (0x66);
+
+      if (src.kind == Operand::IMMEDIATE)
+        {
+          long long value;
+          const bool known = constant (src.expression, &value);
+
+          if (size == 1)
+            {
+              if (dst.kind == Operand::REGISTER && dst.reg == EAX)
+                fragment.bytes_.push_back (0x04 | arithmetic << 3);
+              else
+                {
+                  fragment.bytes_.push_back (0x80);
+                  modrm (fragment, arithmetic, dst);
+                }
+              immediate (fragment, src, 1);
+            }
+          else if (known && fits8 (sign_extend (value, size)))
+            {
+              fragment.bytes_.push_back (0x83);
+              modrm (fragment, arithmetic, dst);
+              append (fragment.bytes_, value, 1);
+            }
+          else
+            {
+              if (dst.kind == Operand::REGISTER && dst.reg == EAX)
+                fragment.bytes_.push_back (0x05 | arithmetic << 3);
+              else
+                {
+                  fragment.bytes_.push_back (0x81);
+                  modrm (fragment, arithmetic, dst);
+                }
+              immediate (fragment, src, size);
+            }
+        }
+      else if (src.kind == Operand::REGISTER)
+        {
+          fragment.bytes_.push_back (arithmetic << 3 | wide);
+          modrm (fragment, src.reg, dst);
+        }
+      else if (dst.kind == Operand::REGISTER)
+        {
+          fragment.bytes_.push_back (arithmetic << 3 | 2 | wide);
+          modrm (fragment, dst.reg, src, true);
+        }
+      else
+        unsupported ();
+      return true;
+    }
+
+  if (name == "mov")
+    {
+      if (count != 2 || operands[1].kind == Operand::IMMEDIATE)
+        unsupported ();
+      const Operand & src = operands[0];
+      const Operand & dst = operands[1];
+
+      Fragment & fragment = begin_instruction ();
+      if (word)
+        fragment.bytes_.push_back (0x66);
+
+      // The accumulator has short forms for absolute addresses.
+      const Operand & reg = src.kind == Operand::REGISTER ? src : dst;
+      const Operand & mem = src.kind == Operand::REGISTER ? dst : src;
+      if (reg.kind == Operand::REGISTER && reg.reg == EAX
+          && mem.kind == Operand::MEMORY && mem.base < 0 && mem.index < 0
+          && (!mem.expression || !mem.expression->modifier))
+        {
+          fragment.bytes_.push_back ((&mem == &dst ? 0xa2 : 0xa0) | wide);
+          field (fragment, mem.expression, 4, false);
+          return true;
+        }
+
+      if (src.kind == Operand::IMMEDIATE)
+        {
+          if (dst.kind == Operand::REGISTER)
+            fragment.bytes_.push_back ((size == 1 ? 0xb0 : 0xb8) | dst.reg);
+          else
+            {
+              fragment.bytes_.push_back (0xc6 | wide);
+              modrm (fragment, 0, dst);
+            }
+          immediate (fragment, src, size);
+        }
+      else if (src.kind == Operand::REGISTER)
+        {
+          fragment.bytes_.push_back (0x88 | wide);
+          modrm (fragment, src.reg, dst);
+        }
+      else if (dst.kind == Operand::REGISTER)
+        {
+          fragment.bytes_.push_back (0x8a | wide);
+          modrm (fragment, dst.reg, src, true);
+        }
+      else
+        unsupported ();
+      return true;
+    }
+
+  if (name == "test")
+    {
+      if (count != 2 || operands[1].kind == Operand::IMMEDIATE)
+        unsupported ();
+      const Operand & src = operands[0];
+      const Operand & dst = operands[1];
+
+      Fragment & fragment = begin_instruction ();
+      if (word)
+        fragment.bytes_.push_back (0x66);
+
+      if (src.kind == Operand::IMMEDIATE)
+        {
+          if (dst.kind == Operand::REGISTER && dst.reg == EAX)
+            fragment.bytes_.push_back (0xa8 | wide);
+          else
+            {
+              fragment.bytes_.push_back (0xf6 | wide);
+              modrm (fragment, 0, dst);
+            }
+          immediate (fragment, src, size);
+        }
+      else if (src.kind == Operand::REGISTER)
+        {
+          fragment.bytes_.push_back (0x84 | wide);
+          modrm (fragment, src.reg, dst);
+        }
+      else if (dst.kind == Operand::REGISTER)
+        {
+          fragment.bytes_.push_back (0x84 | wide);
+          modrm (fragment, dst.reg, src, true);
+        }
+      else
+        unsupported ();
+      return true;
+    }
+
+  if (name == "xchg")
+    {
+      if (count != 2)
+        unsupported ();
+      const Operand & a = operands[0];
+      const Operand & b = operands[1];
+
+      Fragment & fragment = begin_instruction ();
+      if (word)
+        fragment.bytes_.push_back (0x66);
+
+      if (size != 1 && a.kind == Operand::REGISTER
+          && b.kind == Operand::REGISTER && (a.reg == EAX || b.reg == EAX))
+        fragment.bytes_.push_back (0x90 | (a.reg == EAX ? b.reg : a.reg));
+      else if (a.kind == Operand::REGISTER)
+        {
+          fragment.bytes_.push_back (0x86 | wide);
+          modrm (fragment, a.reg, b);
+        }
+      else if (b.kind == Operand::REGISTER)
+        {
+          fragment.bytes_.push_back (0x86 | wide);
+          modrm (fragment, b.reg, a);
+        }
+      else
+        unsupported ();
+      return true;
+    }
+
+  if (name == "lea")
+    {
+      if (count != 2 || operands[0].kind != Operand::MEMORY
+          || operands[1].kind != Operand::REGISTER || size == 1)
+        unsupported ();
+      Fragment & fragment = begin_instruction ();
+      if (word)
+        fragment.bytes_.push_back (0x66);
+      fragment.bytes_.push_back (0x8d);
+      modrm (fragment, operands[1].reg, operands[0]);
+      return true;
+    }
+
+  if (name == "push" || name == "pop")
+    {
+      if (count != 1 || size == 1)
+        unsupported ();
+      const Operand & op = operands[0];
+      const bool push = name == "push";
+
+      Fragment & fragment = begin_instruction ();
+      if (word)
+        fragment.bytes_.push_back (0x66);
+
+      if (op.kind == Operand::REGISTER)
+        fragment.bytes_.push_back ((push ? 0x50 : 0x58) | op.reg);
+      else if (op.kind == Operand::IMMEDIATE)
+        {
+          long long value;
+          if (!push)
+            unsupported ();
+          if (constant (op.expression, &value) && fits8 (value))
+            {
+              fragment.bytes_.push_back (0x6a);
+              append (fragment.bytes_, value, 1);
+            }
+          else
+            {
+              fragment.bytes_.push_back (0x68);
+              immediate (fragment, op, size);
+            }
+        }
+      else
+        {
+          fragment.bytes_.push_back (push ? 0xff : 0x8f);
+          modrm (fragment, push ? 6 : 0, op);
+        }
+      return true;
+    }
+
+  if (name == "inc" || name == "dec")
+    {
+      if (count != 1 || operands[0].kind == Operand::IMMEDIATE)
+        unsupported ();
+      const Operand & op = operands[0];
+      const int digit = name == "inc" ? 0 : 1;
+
+      Fragment & fragment = begin_instruction ();
+      if (word)
+        fragment.bytes_.push_back (0x66);
+
+      if (op.kind == Operand::REGISTER && size != 1)
+        fragment.bytes_.push_back ((digit ? 0x48 : 0x40) | op.reg);
+      else
+        {
+          fragment.bytes_.push_back (0xfe | wide);
+          modrm (fragment, digit, op);
+        }
+      return true;
+    }
+
+  const int unary = find (UNARY, name);
+  if (unary >= 2 && count == 1)
+    {
+      if (operands[0].kind == Operand::IMMEDIATE)
+        unsupported ();
+      Fragment & fragment = begin_instruction ();
+      if (word)
+        fragment.bytes_.push_back (0x66);
+      fragment.bytes_.push_back (0xf6 | wide);
+      modrm (fragment, unary, operands[0]);
+      return true;
+    }
+
+  if (name == "imul" && (count == 2 || count == 3))
+    {
+      const Operand & dst = operands[count - 1];
+      if (dst.kind != Operand::REGISTER || size == 1)
+        unsupported ();
+
+      Fragment & fragment = begin_instruction ();
+      if (word)
+        fragment.bytes_.push_back (0x66);
+
+      if (operands[0].kind == Operand::IMMEDIATE)
+        {
+          const Operand & src = count == 3 ? operands[1] : dst;
+          long long value;
+          const bool known = constant (operands[0].expression, &value);
+          const bool short_form = known && fits8 (sign_extend (value, size));
+
+          fragment.bytes_.push_back (short_form ? 0x6b : 0x69);
+          modrm (fragment, dst.reg, src);
+          if (short_form)
+            append (fragment.bytes_, value, 1);
+          else
+            immediate (fragment, operands[0], size);
+        }
+      else if (count == 2)
+        {
+          fragment.bytes_.push_back (0x0f);
+          fragment.bytes_.push_back (0xaf);
+          modrm (fragment, dst.reg, operands[0]);
+        }
+      else
+        unsupported ();
+      return true;
+    }
+
+  const int shift = find (SHIFTS, name);
+  if (shift >= 0)
+    {
+      if (count < 1 || count > 2 || operands[count - 1].kind
+                                    == Operand::IMMEDIATE)
+        unsupported ();
+      const Operand & dst = operands[count - 1];
+      const int digit = SHIFT_DIGITS[shift];
+
+      Fragment & fragment = begin_instruction ();
+      if (word)
+        fragment.bytes_.push_back (0x66);
+
+      long long value = 1;
+      if (count == 1
+          || (operands[0].kind == Operand::IMMEDIATE
+              && constant (operands[0].expression, &value) && value == 1))
+        {
+          fragment.bytes_.push_back (0xd0 | wide);
+          modrm (fragment, digit, dst);
+        }
+      else if (operands[0].kind == Operand::IMMEDIATE)
+        {
+          fragment.bytes_.push_back (0xc0 | wide);
+          modrm (fragment, digit, dst);
+          immediate (fragment, operands[0], 1);
+        }
+      else if (operands[0].kind == Operand::REGISTER
+               && operands[0].reg == ECX && operands[0].size == 1)
+        {
+          fragment.bytes_.push_back (0xd2 | wide);
+          modrm (fragment, digit, dst);
+        }
+      else
+        unsupported ();
+      return true;
+    }
+
+  // Zero and sign extensions, movzbl, movsbl, movzwl, movswl and so on.
+  if ((name.compare (0, 4, "movz") == 0 || name.compare (0, 4, "movs") == 0)
+      && name.size () == 5 && count == 2)
+    {
+      const int from = name[4] == 'b' ? 1 : (name[4] == 'w' ? 2 : 0);
+      const Operand & src = operands[0];
+      const Operand & dst = operands[1];
+      if (!from || !suffix || suffix <= from
+          || dst.kind != Operand::REGISTER || dst.size != suffix
+          || src.kind == Operand::IMMEDIATE
+          || (src.kind == Operand::REGISTER && src.size != from))
+        unsupported ();
+
+      Fragment & fragment = begin_instruction ();
+      if (suffix == 2)
+        fragment.bytes_.push_back (0x66);
+      fragment.bytes_.push_back (0x0f);
+      fragment.bytes_.push_back ((name[3] == 'z' ? 0xb6 : 0xbe)
+                                 | (from == 2 ? 1 : 0));
+      modrm (fragment, dst.reg, src);
+      return true;
+    }
+
+  return false;
+}
+
+// Assign addresses to fragments, growing branches until all fit.
+void
+Assembly::layout ()
+{
+  // Branches to labels in their own section may be short, others need
+  // relocations and so are always long.  As with GNU as, a global label
+  // counts, since code that is not position independent cannot have it
+  // preempted, but a weak one does not.
+  for (size_t s = 0; s < sections_.size (); ++s)
+    {
+      std::vector<Fragment> & fragments = sections_[s].fragments_;
+      for (size_t i = 0; i < fragments.size (); ++i)
+        {
+          Fragment & fragment = fragments[i];
+          if (fragment.kind_ != Fragment::BRANCH)
+            continue;
+
+          const Node * target = fragment.target_;
+          fragment.relaxable_ = target->kind == Node::SYMBOL
+                                && target->modifier == NO_MODIFIER
+                                && target->symbol->state_ == AsmSymbol::LABEL
+                                && target->symbol->section_ == s
+                                && target->symbol->binding_ != STB_WEAK;
+          fragment.long_form_ = !fragment.relaxable_;
+          if (fragment.long_form_ && (fragment.opcode_ & 0xf0) == 0xe0
+              && fragment.opcode_ != 0xeb)
+            unsupported ();
+        }
+    }
+
+  for (bool changed = true; changed; )
+    {
+      changed = false;
+
+      for (size_t s = 0; s < sections_.size (); ++s)
+        {
+          std::vector<Fragment> & fragments = sections_[s].fragments_;
+          size_t address = 0;
+
+          for (size_t i = 0; i < fragments.size (); ++i)
+            {
+              Fragment & fragment = fragments[i];
+              fragment.address_ = address;
+
+              switch (fragment.kind_)
+                {
+                case Fragment::FIXED:
+                  fragment.size_ = fragment.bytes_.size ();
+                  break;
+                case Fragment::BRANCH:
+                  fragment.size_ = !fragment.long_form_
+                                   ? 2 : (fragment.opcode_ == 0xeb ? 5 : 6);
+                  break;
+                case Fragment::ALIGN:
+                  fragment.size_ = (fragment.alignment_
+                                    - address % fragment.alignment_)
+                                   % fragment.alignment_;
+                  break;
+                }
+              address += fragment.size_;
+            }
+        }
+
+      for (size_t s = 0; s < sections_.size (); ++s)
+        {
+          std::vector<Fragment> & fragments = sections_[s].fragments_;
+          for (size_t i = 0; i < fragments.size (); ++i)
+            {
+              Fragment & fragment = fragments[i];
+              if (fragment.kind_ != Fragment::BRANCH || fragment.long_form_)
+                continue;
+
+              const long long displacement
+                  = static_cast<long long>(address (fragment.target_->symbol))
+                    - static_cast<long long>(fragment.address_ + 2);
+              if (!fits8 (displacement))
+                {
+                  if ((fragment.opcode_ & 0xf0) == 0xe0
+                      && fragment.opcode_ != 0xeb)
+                    unsupported ();
+                  fragment.long_form_ = changed = true;
+                }
+            }
+        }
+    }
+
+  for (size_t s = 0; s < sections_.size (); ++s)
+    resolve (s);
+}
+
+// Record a relocation, against a symbol or its section, and return in the
+// contents the addend that REL relocations hold in place.  Where the
+// relocation keeps its label, a temporary label goes into the symbol table.
+void
+Assembly::relocate (Section & section, size_t offset, const Value & value,
+                    unsigned char type, long long addend, int size,
+                    bool keeps_label)
+{
+  if (size != 4 || value.sub || !value.add
+      || (value.add->temporary_ && value.add->state_ != AsmSymbol::LABEL))
+    unsupported ();
+
+  AsmSymbol * target = const_cast<AsmSymbol *>(value.add);
+  if (target->state_ == AsmSymbol::EQUATED || target->name_ == ".")
+    unsupported ();
+
+  // GOT and PLT relocations always name their symbol, others against a
+  // local label use its section unless they keep the label.
+  Relocation relocation = { offset, 0, 0, type };
+  if (target->external () || type == R_386_GOT32 || type == R_386_GOT32X
+      || type == R_386_PLT32 || type == R_386_GOTPC || keeps_label)
+    {
+      if (target->temporary_ && !keeps_label)
+        unsupported ();
+      if (target->temporary_ && !target->relocated_)
+        kept_labels_.push_back (target);
+      target->relocated_ = true;
+      relocation.symbol = target;
+    }
+  else
+    {
+      addend += address (target);
+      relocation.section = target->section_;
+      sections_[target->section_].symbol_ = true;
+    }
+
+  put (section.contents_, offset, addend, size);
+  section.relocations_.push_back (relocation);
+}
+
+// Build a section's contents, applying fixups and noting relocations.  Like
+// GNU as, which makes them while relaxing, relocations for branches follow
+// all others.
+void
+Assembly::resolve (size_t s)
+{
+  Section & section = sections_[s];
+  std::vector<unsigned char> & contents = section.contents_;
+  std::vector<Relocation> branches;
+
+  for (size_t i = 0; i < section.fragments_.size (); ++i)
+    {
+      const Fragment & fragment = section.fragments_[i];
+      const size_t base = contents.size ();
+
+      if (fragment.kind_ == Fragment::ALIGN)
+        {
+          size_t remaining = fragment.size_;
+          if (!fragment.nop_fill_)
+            contents.resize (base + remaining, fragment.fill_);
+
+          // Fill code with the same no-op sequences as GNU as for i386.
+          static const char * const nops[] = {
+            "", "\x90", "\x66\x90", "\x8d\x76\x00", "\x8d\x74\x26\x00", 0,
+            "\x8d\xb6\x00\x00\x00\x00", "\x8d\xb4\x26\x00\x00\x00\x00"
+          };
+          while (fragment.nop_fill_ && remaining > 0)
+            {
+              const size_t n = remaining >= 7 ? 7 : (remaining == 5 ? 4
+                                                     : remaining);
+              contents.insert (contents.end (), nops[n], nops[n] + n);
+              remaining -= n;
+            }
+          continue;
+        }
+
+      AsmSymbol dot (".");
+      dot.state_ = AsmSymbol::LABEL;
+      dot.section_ = s;
+      dot.fragment_ = i;
+      dot.binding_ = STB_LOCAL;
+
+      if (fragment.kind_ == Fragment::BRANCH)
+        {
+          const unsigned char opcode = fragment.opcode_;
+          const Value target = evaluate (fragment.target_, &dot);
+          const int size = fragment.long_form_ ? 4 : 1;
+
+          if (!fragment.long_form_)
+            contents.push_back (opcode);
+          else if (opcode == 0xeb)
+            contents.push_back (0xe9);
+          else
+            {
+              contents.push_back (0x0f);
+              contents.push_back (opcode + 0x10);
+            }
+          const size_t offset = contents.size ();
+          append (contents, 0, size);
+
+          if (fragment.relaxable_)
+            put (contents, offset, address (target.add) + target.addend
+                                   - (offset + size), size);
+          else
+            {
+              relocate (section, offset, target,
+                        target.modifier == PLT ? R_386_PLT32 : R_386_PC32,
+                        target.addend - size, size);
+              branches.push_back (section.relocations_.back ());
+              section.relocations_.pop_back ();
+            }
+          continue;
+        }
+
+      contents.insert (contents.end (), fragment.bytes_.begin (),
+                       fragment.bytes_.end ());
+
+      for (size_t f = 0; f < fragment.fixups_.size (); ++f)
+        {
+          const Fixup & fixup = fragment.fixups_[f];
+          const Value value = evaluate (fixup.expression, &dot);
+          const size_t offset = base + fixup.offset;
+
+          if (fixup.pc_relative)
+            {
+              if (value.add && !value.sub
+                  && (!value.modifier || value.modifier == PLT)
+                  && local_to (value.add, s))
+                put (contents, offset, address (value.add) + value.addend
+                                       - (offset + fixup.size), fixup.size);
+              else if (value.modifier == NO_MODIFIER
+                       || value.modifier == PLT)
+                relocate (section, offset, value,
+                          value.modifier == PLT ? R_386_PLT32 : R_386_PC32,
+                          value.addend - fixup.size, fixup.size);
+              else
+                unsupported ();
+            }
+          else if (!value.add && !value.sub)
+            put (contents, offset, value.addend, fixup.size);
+          else if (value.add->name_ == "_GLOBAL_OFFSET_TABLE_")
+            {
+              if (value.modifier != NO_MODIFIER)
+                unsupported ();
+              relocate (section, offset, value, R_386_GOTPC,
+                        value.addend + (offset - base), fixup.size);
+            }
+          else
+            {
+              // GNU as keeps the label of a GOTOFF relocation from data,
+              // such as a jump table entry, but not from an instruction.
+              unsigned char type = R_386_32;
+              if (value.modifier == GOT)
+                type = fixup.got32x ? R_386_GOT32X : R_386_GOT32;
+              else if (value.modifier == GOTOFF)
+                type = R_386_GOTOFF;
+              else if (value.modifier == PLT)
+                unsupported ();
+              relocate (section, offset, value, type, value.addend,
+                        fixup.size,
+                        fragment.data_ && value.modifier == GOTOFF);
+            }
+        }
+    }
+
+  section.relocations_.insert (section.relocations_.end (),
+                               branches.begin (), branches.end ());
+}
+
+// Write the ELF object.  Each section with relocations is followed by its
+// .rel section, then come the symbol and string tables.
+void
+Assembly::write (const std::string & object_path)
+{
+  if (!prefixes_.empty ())
+    unsupported ();
+
+  // Complete the stabs header, now that the counts are known.
+  if (stab_)
+    {
+      Section & stab = sections_[stab_];
+      put (stab.contents_, 0, 1, 4);
+      put (stab.contents_, 6, stab.fragments_.size () - 1, 2);
+      put (stab.contents_, 8, sections_[stabstr_].contents_.size (), 4);
+    }
+
+  StringTable shstrtab;
+  size_t index = 1;
+  for (size_t s = 0; s < sections_.size (); ++s)
+    {
+      sections_[s].index_ = index++;
+      if (!sections_[s].relocations_.empty ())
+        sections_[s].rel_index_ = index++;
+    }
+  const size_t symtab_index = index++;
+  const size_t strtab_index = index++;
+  const size_t shstrtab_index = index++;
+
+  // Symbol table: locals, being the file, sections referenced by
+  // relocations, and local labels, then globals, in order of creation.
+  std::vector<Elf32_Sym> symtab;
+  StringTable strtab;
+  const Elf32_Sym null_symbol = { 0, 0, 0, 0, 0, 0 };
+  symtab.push_back (null_symbol);
+
+  if (!file_name_.empty ())
+    {
+      Elf32_Sym file = { static_cast<Elf32_Word>(strtab.add (file_name_)),
+                         0, 0, ELF32_ST_INFO (STB_LOCAL, STT_FILE), 0,
+                         SHN_ABS };
+      symtab.push_back (file);
+    }
+
+  // Section symbols go among the locals in the order that their sections
+  // were created, as GNU as places them.
+  std::vector<size_t> section_symbols (sections_.size (), 0);
+  size_t next_section = 0;
+
+  size_t first_global = 0;
+  for (int pass = 0; pass < 2; ++pass)
+    {
+      // Temporary labels that relocations keep follow the other locals.
+      // GNU as makes full symbols of those that short branches target as
+      // it relaxes, so they come first, then the rest in the order that
+      // relocations first name them.
+      std::vector<AsmSymbol *> kept;
+      for (size_t s = 0; pass == 1 && s < sections_.size (); ++s)
+        for (size_t i = 0; i < sections_[s].fragments_.size (); ++i)
+          {
+            const Fragment & fragment = sections_[s].fragments_[i];
+            AsmSymbol * target = fragment.relaxable_
+                                 ? fragment.target_->symbol : 0;
+            if (target && target->temporary_ && target->relocated_
+                && std::find (kept.begin (), kept.end (), target)
+                   == kept.end ())
+              kept.push_back (target);
+          }
+      for (size_t k = 0; pass == 1 && k < kept_labels_.size (); ++k)
+        if (std::find (kept.begin (), kept.end (), kept_labels_[k])
+            == kept.end ())
+          kept.push_back (kept_labels_[k]);
+
+      for (size_t k = 0; k < kept.size (); ++k)
+        {
+          AsmSymbol & sym = *kept[k];
+          const Elf32_Sym entry = {
+            static_cast<Elf32_Word>(strtab.add (sym.name_)),
+            static_cast<Elf32_Addr>(address (&sym)), 0,
+            ELF32_ST_INFO (STB_LOCAL, STT_NOTYPE), 0,
+            static_cast<Elf32_Half>(sections_[sym.section_].index_) };
+          sym.index_ = symtab.size ();
+          symtab.push_back (entry);
+        }
+      if (pass == 1)
+        first_global = symtab.size ();
+
+      for (std::deque<AsmSymbol>::iterator iter = symbols_.begin ();
+           iter <= symbols_.end (); ++iter)
+        {
+          for (; pass == 0 && next_section < sections_.size ()
+                 && (iter == symbols_.end ()
+                     || sections_[next_section].first_symbol_
+                        <= static_cast<size_t>(iter - symbols_.begin ()));
+               ++next_section)
+            {
+              if (!sections_[next_section].symbol_)
+                continue;
+              Elf32_Sym section_symbol = {
+                0, 0, 0, ELF32_ST_INFO (STB_LOCAL, STT_SECTION), 0,
+                static_cast<Elf32_Half>(sections_[next_section].index_) };
+              section_symbols[next_section] = symtab.size ();
+              symtab.push_back (section_symbol);
+            }
+          if (iter == symbols_.end ())
+            break;
+
+          AsmSymbol & sym = *iter;
+          if (sym.temporary_)
+            {
+              if (sym.state_ != AsmSymbol::LABEL
+                  && sym.state_ != AsmSymbol::EQUATED
+                  && (sym.relocated_ || sym.binding_ >= 0))
+                unsupported ();
+              continue;
+            }
+          if (sym.state_ == AsmSymbol::UNDEFINED
+              && !sym.relocated_ && sym.binding_ < 0)
+            continue;
+
+          int binding = sym.binding_;
+          if (binding < 0)
+            binding = (sym.state_ == AsmSymbol::UNDEFINED
+                       || sym.state_ == AsmSymbol::COMMON)
+                      ? STB_GLOBAL : STB_LOCAL;
+          if ((binding == STB_LOCAL) != (pass == 0))
+            continue;
+
+          Elf32_Sym entry = { static_cast<Elf32_Word>(strtab.add (sym.name_)),
+                              0, 0, ELF32_ST_INFO (binding, sym.type_), 0,
+                              SHN_UNDEF };
+
+          if (sym.state_ == AsmSymbol::LABEL)
+            {
+              entry.st_value = address (&sym);
+              entry.st_shndx = sections_[sym.section_].index_;
+            }
+          else if (sym.state_ == AsmSymbol::COMMON)
+            {
+              entry.st_value = sym.common_alignment_;
+              entry.st_size = sym.common_size_;
+              entry.st_shndx = SHN_COMMON;
+            }
+          else if (sym.state_ == AsmSymbol::EQUATED)
+            {
+              const Value value = evaluate (sym.equation_, 0);
+              if (value.add || value.sub || value.modifier)
+                unsupported ();
+              entry.st_value = value.addend;
+              entry.st_shndx = SHN_ABS;
+            }
+          else if (binding == STB_LOCAL)
+            unsupported ();
+
+          if (sym.size_)
+            {
+              const Value value = evaluate (sym.size_, 0);
+              if (value.add || value.sub || value.modifier)
+                unsupported ();
+              entry.st_size = value.addend;
+            }
+
+          sym.index_ = symtab.size ();
+          symtab.push_back (entry);
+        }
+    }
+
+  strtab.finalize ();
+  for (size_t i = 0; i < symtab.size (); ++i)
+    symtab[i].st_name = strtab.offset (symtab[i].st_name);
+
+  // Lay out the file: header, section contents, symbol and string tables,
+  // relocations, then section headers.
+  std::vector<unsigned char> image (sizeof (Elf32_Ehdr), 0);
+  std::vector<Elf32_Shdr> headers (shstrtab_index + 1);
+  std::memset (&headers[0], 0, headers.size () * sizeof (Elf32_Shdr));
+
+  // GNU as names its own tables before the sections.
+  Elf32_Shdr & symtab_header = headers[symtab_index];
+  Elf32_Shdr & strtab_header = headers[strtab_index];
+  Elf32_Shdr & shstrtab_header = headers[shstrtab_index];
+  symtab_header.sh_name = shstrtab.add (".symtab");
+  strtab_header.sh_name = shstrtab.add (".strtab");
+  shstrtab_header.sh_name = shstrtab.add (".shstrtab");
+
+  for (size_t s = 0; s < sections_.size (); ++s)
+    {
+      Section & section = sections_[s];
+      Elf32_Shdr & header = headers[section.index_];
+
+      header.sh_name = shstrtab.add (section.name_);
+      header.sh_type = section.type_;
+      header.sh_flags = section.flags_;
+      header.sh_addralign = section.alignment_;
+      header.sh_entsize = section.entsize_;
+      header.sh_size = section.contents_.size ();
+      if (section.link_)
+        header.sh_link = sections_[section.link_].index_;
+
+      image.resize ((image.size () + section.alignment_ - 1)
+                    & ~(section.alignment_ - 1), 0);
+      header.sh_offset = image.size ();
+      if (section.type_ != SHT_NOBITS)
+        image.insert (image.end (), section.contents_.begin (),
+                      section.contents_.end ());
+
+      if (section.relocations_.empty ())
+        continue;
+
+      Elf32_Shdr & rel = headers[section.rel_index_];
+      rel.sh_name = shstrtab.add (".rel" + section.name_);
+      rel.sh_type = SHT_REL;
+      rel.sh_flags = SHF_INFO_LINK;
+      rel.sh_link = symtab_index;
+      rel.sh_info = section.index_;
+      rel.sh_addralign = 4;
+      rel.sh_entsize = sizeof (Elf32_Rel);
+    }
+
+  image.resize ((image.size () + 3) & ~3, 0);
+  symtab_header.sh_type = SHT_SYMTAB;
+  symtab_header.sh_offset = image.size ();
+  symtab_header.sh_size = symtab.size () * sizeof (Elf32_Sym);
+  symtab_header.sh_link = strtab_index;
+  symtab_header.sh_info = first_global;
+  symtab_header.sh_addralign = 4;
+  symtab_header.sh_entsize = sizeof (Elf32_Sym);
+  const unsigned char * symbols
+      = reinterpret_cast<const unsigned char *>(&symtab[0]);
+  image.insert (image.end (), symbols, symbols + symtab_header.sh_size);
+
+  strtab_header.sh_type = SHT_STRTAB;
+  strtab_header.sh_offset = image.size ();
+  strtab_header.sh_size = strtab.data ().size ();
+  strtab_header.sh_addralign = 1;
+  image.insert (image.end (), strtab.data ().begin (),
+                strtab.data ().end ());
+
+  // Relocation sections follow the symbol and string tables, as GNU as
+  // places them.
+  for (size_t s = 0; s < sections_.size (); ++s)
+    {
+      const Section & section = sections_[s];
+      if (section.relocations_.empty ())
+        continue;
+
+      image.resize ((image.size () + 3) & ~3, 0);
+      Elf32_Shdr & rel = headers[section.rel_index_];
+      rel.sh_offset = image.size ();
+      rel.sh_size = section.relocations_.size () * sizeof (Elf32_Rel);
+
+      for (size_t r = 0; r < section.relocations_.size (); ++r)
+        {
+          const Relocation & relocation = section.relocations_[r];
+          const size_t symbol_index = relocation.symbol
+                                      ? relocation.symbol->index_
+                                      : section_symbols[relocation.section];
+          append (image, relocation.offset, 4);
+          append (image, ELF32_R_INFO (symbol_index, relocation.type), 4);
+        }
+    }
+
+  shstrtab.finalize ();
+  for (size_t h = 0; h < headers.size (); ++h)
+    headers[h].sh_name = shstrtab.offset (headers[h].sh_name);
+  shstrtab_header.sh_type = SHT_STRTAB;
+  shstrtab_header.sh_offset = image.size ();
+  shstrtab_header.sh_size = shstrtab.data ().size ();
+  shstrtab_header.sh_addralign = 1;
+  image.insert (image.end (), shstrtab.data ().begin (),
+                shstrtab.data ().end ());
+
+  image.resize ((image.size () + 3) & ~3, 0);
+  Elf32_Ehdr elf_header;
+  std::memset (&elf_header, 0, sizeof (elf_header));
+  std::memcpy (elf_header.e_ident, ELFMAG, SELFMAG);
+  elf_header.e_ident[EI_CLASS] = ELFCLASS32;
+  elf_header.e_ident[EI_DATA] = ELFDATA2LSB;
+  elf_header.e_ident[EI_VERSION] = EV_CURRENT;
+  elf_header.e_ident[EI_OSABI] = ELFOSABI_SYSV;
+  elf_header.e_type = ET_REL;
+  elf_header.e_machine = EM_386;
+  elf_header.e_version = EV_CURRENT;
+  elf_header.e_shoff = image.size ();
+  elf_header.e_ehsize = sizeof (Elf32_Ehdr);
+  elf_header.e_shentsize = sizeof (Elf32_Shdr);
+  elf_header.e_shnum = headers.size ();
+  elf_header.e_shstrndx = shstrtab_index;
+  std::memcpy (&image[0], &elf_header, sizeof (elf_header));
+
+  const unsigned char * section_headers
+      = reinterpret_cast<const unsigned char *>(&headers[0]);
+  image.insert (image.end (), section_headers,
+                section_headers + headers.size () * sizeof (Elf32_Shdr));
+
+  std::ofstream outs (object_path.c_str (), std::ios::out | std::ios::binary);
+  outs.write (reinterpret_cast<const char *>(&image[0]), image.size ());
+  outs.close ();
+  if (!outs)
+    unsupported ();
+}
+
+} // namespace
+
+// Assemble into an object file, returning false if the assembly text uses
+// anything not supported here, or on error.
+bool
+Assembler::assemble (const std::string & assembly,
+                     const std::string & object_path)
+{
+  try
+    {
+      Assembly object;
+      object.parse (assembly);
+      object.layout ();
+      object.write (object_path);
+      return true;
+    }
+  catch (Unsupported)
+    {
+      return false;
+    }
+}
@@ -0,0 +1,40 @@
+// vi: set ts=2 shiftwidth=2 expandtab:
+//
+// VNPForth - Compiled native Forth for x86 Linux
+// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef VNPFORTH_ASSEMBLER_H
+#define VNPFORTH_ASSEMBLER_H
+
+#include <string>
+
+// Integrated assembler, translates x86 assembly text directly into an ELF32
+// relocatable object file, without running an external assembler.  It
+// accepts the subset of GNU as AT&T syntax that code generation and typical
+// CODE words use.  Assemble returns false on anything outside that subset,
+// and on any error, in which case the caller should fall back to 'as'.
+class Assembler {
+public:
+  static bool assemble (const std::string & assembly,
+                        const std::string & object_path);
+
+private:
+  Assembler ();
+};
+
+#endif
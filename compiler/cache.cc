@@ -0,0 +1,403 @@
+// vi: set ts=2 shiftwidth=2 expandtab:
+//
+// VNPForth - Compiled native Forth for x86 Linux
+// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <utime.h>
+
+#include "cache.h"
+#include "cmdline.h"
+#include "options.h"
+
+// Helpers for hashing, files, and the cache statistics.
+namespace {
+
+// SHA-1 message digest, returned as a hex string.
+std::string
+sha1 (const std::string & message)
+{
+  unsigned int h[5] = { 0x67452301, 0xefcdab89, 0x98badcfe,
+                        0x10325476, 0xc3d2e1f0 };
+
+  std::string data = message;
+  const unsigned long long bits = message.size () * 8ULL;
+  data += static_cast<char>(0x80);
+  while (data.size () % 64 != 56)
+    data += '\0';
+  for (int i = 7; i >= 0; --i)
+    data += static_cast<char>(bits >> (i * 8));
+
+  for (size_t block = 0; block < data.size (); block += 64)
+    {
+      unsigned int w[80];
+      for (int i = 0; i < 16; ++i)
+        {
+          w[i] = 0;
+          for (int j = 0; j < 4; ++j)
+            w[i] = w[i] << 8
+                   | static_cast<unsigned char>(data[block + i * 4 + j]);
+        }
+      for (int i = 16; i < 80; ++i)
+        {
+          const unsigned int x = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+          w[i] = x << 1 | x >> 31;
+        }
+
+      unsigned int a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+      for (int i = 0; i < 80; ++i)
+        {
+          unsigned int f, k;
+          if (i < 20)
+            f = (b & c) | (~b & d), k = 0x5a827999;
+          else if (i < 40)
+            f = b ^ c ^ d, k = 0x6ed9eba1;
+          else if (i < 60)
+            f = (b & c) | (b & d) | (c & d), k = 0x8f1bbcdc;
+          else
+            f = b ^ c ^ d, k = 0xca62c1d6;
+
+          const unsigned int t = (a << 5 | a >> 27) + f + e + k + w[i];
+          e = d;
+          d = c;
+          c = b << 30 | b >> 2;
+          b = a;
+          a = t;
+        }
+      h[0] += a, h[1] += b, h[2] += c, h[3] += d, h[4] += e;
+    }
+
+  std::string digest;
+  for (int i = 0; i < 5; ++i)
+    {
+      char hex[9];
+      std::sprintf (hex, "%08x", h[i]);
+      digest += hex;
+    }
+  return digest;
+}
+
+// Read a whole file into data, returning false if it cannot be read.
+bool
+read_file (const std::string & path, std::string * data)
+{
+  std::ifstream ins (path.c_str (), std::ios::in | std::ios::binary);
+  if (!ins)
+    return false;
+
+  std::ostringstream contents;
+  contents << ins.rdbuf ();
+  *data = contents.str ();
+  return !ins.bad ();
+}
+
+bool
+write_file (const std::string & path, const std::string & data)
+{
+  std::ofstream outs (path.c_str (), std::ios::out | std::ios::binary);
+  outs.write (data.data (), data.size ());
+  outs.close ();
+  return !!outs;
+}
+
+// Output files that an entry holds, by suffix, for the given options.
+std::vector<std::string>
+output_suffixes (const Options & options)
+{
+  std::vector<std::string> suffixes;
+  suffixes.push_back (".o");
+  if (options.save_intermediate ())
+    suffixes.push_back (".p");
+  if (options.save_assembly ())
+    suffixes.push_back (".s");
+  return suffixes;
+}
+
+// Path of the entry for key, in a subdirectory named by its first two
+// characters, so that no one directory grows too large.
+std::string
+entry_path (const Options & options, const std::string & key)
+{
+  return options.cache_directory () + '/' + key.substr (0, 2)
+         + '/' + key.substr (2);
+}
+
+// Hit and miss counters, in the file 'stats' at the top of the cache.
+// The file is locked while it is updated, for concurrent compilations.
+void
+update_statistics (const Options & options, int hits, int misses,
+                   long * total_hits = 0, long * total_misses = 0)
+{
+  mkdir (options.cache_directory ().c_str (), 0777);
+  const std::string path = options.cache_directory () + "/stats";
+  const int fd = open (path.c_str (), O_RDWR | O_CREAT, 0666);
+  if (fd == -1)
+    return;
+  flock (fd, LOCK_EX);
+
+  char buffer[128];
+  const ssize_t count = read (fd, buffer, sizeof (buffer) - 1);
+  buffer[count > 0 ? count : 0] = '\0';
+
+  long hit_count = 0, miss_count = 0;
+  std::sscanf (buffer, "hits %ld misses %ld", &hit_count, &miss_count);
+  hit_count += hits;
+  miss_count += misses;
+
+  if (hits || misses)
+    {
+      std::sprintf (buffer, "hits %ld misses %ld\n", hit_count, miss_count);
+      if (ftruncate (fd, 0) == 0 && lseek (fd, 0, SEEK_SET) == 0
+          && write (fd, buffer, std::strlen (buffer)) == -1)
+        hit_count = miss_count = 0;
+    }
+
+  if (total_hits)
+    *total_hits = hit_count;
+  if (total_misses)
+    *total_misses = miss_count;
+  close (fd);
+}
+
+// Find all entries, as modification time, size, and path.
+typedef std::pair<std::pair<time_t, off_t>, std::string> Entry;
+
+std::vector<Entry>
+list_entries (const Options & options)
+{
+  std::vector<Entry> entries;
+
+  DIR * top = opendir (options.cache_directory ().c_str ());
+  if (!top)
+    return entries;
+
+  for (struct dirent * sub = readdir (top); sub; sub = readdir (top))
+    {
+      const std::string subname = sub->d_name;
+      if (subname.size () != 2 || subname[0] == '.')
+        continue;
+
+      const std::string subpath = options.cache_directory () + '/' + subname;
+      DIR * dir = opendir (subpath.c_str ());
+      if (!dir)
+        continue;
+
+      for (struct dirent * file = readdir (dir); file; file = readdir (dir))
+        {
+          const std::string path = subpath + '/' + file->d_name;
+          struct stat statbuf;
+          if (file->d_name[0] != '.' && stat (path.c_str (), &statbuf) == 0
+              && S_ISREG (statbuf.st_mode))
+            entries.push_back (Entry (std::make_pair (statbuf.st_mtime,
+                                                      statbuf.st_size), path));
+        }
+      closedir (dir);
+    }
+  closedir (top);
+
+  return entries;
+}
+
+// Remove the least recently used entries until the cache fits its limit.
+void
+evict (const Options & options)
+{
+  std::vector<Entry> entries = list_entries (options);
+
+  unsigned long long total = 0;
+  for (size_t i = 0; i < entries.size (); ++i)
+    total += entries[i].first.second;
+  if (total <= options.cache_size ())
+    return;
+
+  std::sort (entries.begin (), entries.end ());
+  for (size_t i = 0; i < entries.size () && total > options.cache_size (); ++i)
+    {
+      if (unlink (entries[i].second.c_str ()) == 0)
+        total -= entries[i].first.second;
+    }
+}
+
+} // namespace
+
+// Return the key for compiling source with the given command line, or an
+// empty string if the source cannot be read.  The compiler binary's size and
+// time stand in for its build, since STAMP only dates this module.
+std::string
+Cache::key (const std::string & source, const CommandLine & commandline)
+{
+  const Options options = commandline.get_options ();
+
+  std::string text;
+  if (options.trace_parser () || !read_file (source, &text))
+    return "";
+
+  std::ostringstream keydata;
+  keydata << "VNPForth 1.5 cache/" << STAMP << '\n';
+
+  struct stat statbuf;
+  if (stat ("/proc/self/exe", &statbuf) == 0)
+    keydata << statbuf.st_size << ' ' << statbuf.st_mtime << '\n';
+
+  char cwd[4096];
+  keydata << (getcwd (cwd, sizeof (cwd)) ? cwd : "") << '\n'
+          << source << '\n'
+          << options.include_debugging () << options.include_profiling ()
+          << options.weak_functions () << options.position_independent ()
+          << options.optimize_level () << options.save_intermediate ()
+          << options.save_assembly () << options.stack_register ()
+          << options.tos_register () << options.target_x86_64 ()
+          << options.external_assembler () << '\n';
+
+  const std::map<std::string, bool> & passes = options.pass_flags ();
+  for (std::map<std::string, bool>::const_iterator
+         iter = passes.begin (); iter != passes.end (); ++iter)
+    keydata << (iter->second ? "-f" : "-fno-") << iter->first << '\n';
+
+  const std::set<std::string> * definitions = commandline.get_definitions ();
+  for (std::set<std::string>::const_iterator
+         iter = definitions->begin (); iter != definitions->end (); ++iter)
+    keydata << *iter << '\n';
+
+  keydata << text.size () << '\n' << text;
+  return sha1 (keydata.str ());
+}
+
+// Restore the output files of a cached compilation, and return the stored
+// diagnostics.  Returns false, and counts a miss, if there is no entry.
+bool
+Cache::restore (const std::string & key, const std::string & base,
+                const CommandLine & commandline, std::string * diagnostics)
+{
+  const Options options = commandline.get_options ();
+  const std::string path = entry_path (options, key);
+
+  // An entry is a series of suffix and length lines, each followed by that
+  // many bytes of data.  The diagnostics have the suffix "-".
+  std::string entry;
+  std::vector<std::pair<std::string, std::string> > parts;
+  if (read_file (path, &entry))
+    {
+      std::istringstream ins (entry);
+      std::string suffix;
+      size_t length;
+      while (ins >> suffix >> length && ins.get () == '\n')
+        {
+          std::string data (length, '\0');
+          if (length > 0 && !ins.read (&data[0], length))
+            break;
+          parts.push_back (std::make_pair (suffix, data));
+        }
+    }
+
+  const std::vector<std::string> suffixes = output_suffixes (options);
+  if (parts.size () != suffixes.size () + 1)
+    {
+      update_statistics (options, 0, 1);
+      return false;
+    }
+
+  for (size_t i = 0; i < parts.size (); ++i)
+    {
+      if (parts[i].first == "-")
+        *diagnostics = parts[i].second;
+      else if (!write_file (base + parts[i].first, parts[i].second))
+        {
+          update_statistics (options, 0, 1);
+          return false;
+        }
+    }
+
+  // Mark the entry as recently used.
+  utime (path.c_str (), 0);
+  update_statistics (options, 1, 0);
+  return true;
+}
+
+// Store the output files and diagnostics of a successful compilation, then
+// evict old entries if the cache has grown too large.  Errors are ignored,
+// since the cache is only an optimization.
+void
+Cache::store (const std::string & key, const std::string & base,
+              const CommandLine & commandline, const std::string & diagnostics)
+{
+  const Options options = commandline.get_options ();
+
+  std::ostringstream entry;
+  const std::vector<std::string> suffixes = output_suffixes (options);
+  for (size_t i = 0; i < suffixes.size (); ++i)
+    {
+      std::string data;
+      if (!read_file (base + suffixes[i], &data))
+        return;
+      entry << suffixes[i] << ' ' << data.size () << '\n' << data;
+    }
+  entry << "- " << diagnostics.size () << '\n' << diagnostics;
+
+  // Write to a temporary file and rename, so that entries are never seen
+  // partly written.
+  const std::string path = entry_path (options, key);
+  mkdir (path.substr (0, path.find_last_of ('/')).c_str (), 0777);
+
+  std::ostringstream temporary;
+  temporary << path << ".tmp" << getpid ();
+  if (!write_file (temporary.str (), entry.str ())
+      || rename (temporary.str ().c_str (), path.c_str ()) == -1)
+    {
+      unlink (temporary.str ().c_str ());
+      return;
+    }
+
+  evict (options);
+}
+
+// Print the cache counters, entries, and size.
+void
+Cache::print_statistics (const CommandLine & commandline, std::ostream & outs)
+{
+  const Options options = commandline.get_options ();
+
+  long hits, misses;
+  update_statistics (options, 0, 0, &hits, &misses);
+
+  const std::vector<Entry> entries = list_entries (options);
+  unsigned long long total = 0;
+  for (size_t i = 0; i < entries.size (); ++i)
+    total += entries[i].first.second;
+
+  outs << commandline.get_program_name () << ": cache "
+       << options.cache_directory () << ": "
+       << hits << " hits, " << misses << " misses, "
+       << entries.size () << " entries, "
+       << total << " of " << options.cache_size () << " bytes" << std::endl;
+}
@@ -0,0 +1,51 @@
+// vi: set ts=2 shiftwidth=2 expandtab:
+//
+// VNPForth - Compiled native Forth for x86 Linux
+// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef VNPFORTH_CACHE_H
+#define VNPFORTH_CACHE_H
+
+#include <ostream>
+#include <string>
+
+class CommandLine;
+
+// On-disk compile cache.  Entries are keyed by a hash of the source text,
+// its path and the working directory, the options and definitions, and the
+// compiler build, and hold the output files and diagnostics of a successful
+// compilation.  Least recently used entries are removed to keep the cache
+// within its size limit.  An empty key means the source is not cacheable.
+class Cache {
+public:
+  static std::string key (const std::string & source,
+                          const CommandLine & commandline);
+  static bool restore (const std::string & key, const std::string & base,
+                       const CommandLine & commandline,
+                       std::string * diagnostics);
+  static void store (const std::string & key, const std::string & base,
+                     const CommandLine & commandline,
+                     const std::string & diagnostics);
+  static void print_statistics (const CommandLine & commandline,
+                                std::ostream & outs);
+
+private:
+  Cache ();
+};
+
+#endif
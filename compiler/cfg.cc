@@ -0,0 +1,284 @@
+// vi: set ts=2 shiftwidth=2 expandtab:
+//
+// VNPForth - Compiled native Forth for x86 Linux
+// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "cfg.h"
+#include "opcode.h"
+
+const size_t ControlFlowGraph::NONE = static_cast<size_t> (-1);
+
+// Build the graph for the opcodes from begin up to but not including end,
+// normally those between a definition's start and end opcodes.
+ControlFlowGraph::ControlFlowGraph (const std::vector<Opcode *> & opcodes,
+                                    size_t begin, size_t end)
+  : opcodes_ (opcodes), begin_ (begin), end_ (end)
+{
+  find_blocks ();
+  link_blocks ();
+  find_reachable ();
+}
+
+// Return the block that starts with a label, or NONE if not found.
+size_t
+ControlFlowGraph::find_label_block (int label) const
+{
+  const std::map<int, size_t>::const_iterator found
+      = label_blocks_.find (label);
+  return found != label_blocks_.end () ? found->second : NONE;
+}
+
+// Return true if control may run off the end of a block into the next,
+// or for the last block, out of the definition.
+bool
+ControlFlowGraph::falls_through (size_t block) const
+{
+  for (size_t i = blocks_[block].end; i > blocks_[block].begin; --i)
+    {
+      const Opcode * opcode = opcodes_[i - 1];
+      if (!opcode->is_noop_opcode ())
+        return !(opcode->is_jump_opcode ()
+                 || opcode->is_jump_table_opcode ()
+                 || opcode->is_tail_call_opcode ());
+    }
+  return true;
+}
+
+// Return the immediate dominator of a block, or NONE if unreachable.
+size_t
+ControlFlowGraph::get_immediate_dominator (size_t block) const
+{
+  if (dominators_.empty ())
+    find_dominators ();
+  return dominators_[block];
+}
+
+// Return true if every path from the entry to block passes through
+// dominator.  Each reachable block dominates itself.
+bool
+ControlFlowGraph::dominates (size_t dominator, size_t block) const
+{
+  if (!is_reachable (block))
+    return false;
+
+  if (dominators_.empty ())
+    find_dominators ();
+  while (block != dominator && block != 0)
+    block = dominators_[block];
+  return block == dominator;
+}
+
+// Split the opcodes into blocks.  Consecutive labels, and any no-ops ahead
+// of them, share a block.
+void
+ControlFlowGraph::find_blocks ()
+{
+  bool is_empty = true;
+
+  for (size_t i = begin_; i < end_; ++i)
+    {
+      const Opcode * opcode = opcodes_[i];
+
+      if (blocks_.empty ()
+          || (opcode->is_label_opcode () && !is_empty))
+        {
+          Block block;
+          block.begin = i;
+          block.end = i;
+          blocks_.push_back (block);
+          is_empty = true;
+        }
+
+      blocks_.back ().end = i + 1;
+      if (const LabelOpcode * label = opcode->is_label_opcode ())
+        label_blocks_[label->get_label ().get_value ()] = blocks_.size () - 1;
+      else if (!opcode->is_noop_opcode ())
+        is_empty = false;
+
+      if ((opcode->is_branching_opcode () || opcode->is_tail_call_opcode ())
+          && i + 1 < end_)
+        {
+          Block block;
+          block.begin = i + 1;
+          block.end = i + 1;
+          blocks_.push_back (block);
+          is_empty = true;
+        }
+    }
+}
+
+// Add the edges from each block's last opcode to its possible successors.
+void
+ControlFlowGraph::link_blocks ()
+{
+  for (size_t b = 0; b < blocks_.size (); ++b)
+    {
+      std::vector<int> labels;
+      const Opcode * last = 0;
+      for (size_t i = blocks_[b].end; i > blocks_[b].begin && !last; --i)
+        {
+          if (!opcodes_[i - 1]->is_noop_opcode ())
+            last = opcodes_[i - 1];
+        }
+
+      const BranchingOpcode * branch = last ? last->is_branching_opcode () : 0;
+      if (branch)
+        labels.push_back (branch->get_label ().get_value ());
+      if (const JumpTableOpcode * table = last ? last->is_jump_table_opcode ()
+                                               : 0)
+        {
+          const std::vector<Label> & targets = table->get_targets ();
+          for (size_t j = 0; j < targets.size (); ++j)
+            labels.push_back (targets[j].get_value ());
+        }
+
+      std::vector<size_t> & successors = blocks_[b].successors;
+      for (size_t j = 0; j < labels.size (); ++j)
+        {
+          const size_t target = find_label_block (labels[j]);
+          if (target != NONE)
+            successors.push_back (target);
+        }
+      if (falls_through (b) && b + 1 < blocks_.size ())
+        successors.push_back (b + 1);
+
+      std::sort (successors.begin (), successors.end ());
+      successors.erase (std::unique (successors.begin (), successors.end ()),
+                        successors.end ());
+      for (size_t j = 0; j < successors.size (); ++j)
+        blocks_[successors[j]].predecessors.push_back (b);
+    }
+}
+
+// Mark each block that some path from the entry block reaches.
+void
+ControlFlowGraph::find_reachable ()
+{
+  reachable_.assign (blocks_.size (), false);
+  if (blocks_.empty ())
+    return;
+
+  std::vector<size_t> stack (1, 0);
+  reachable_[0] = true;
+  while (!stack.empty ())
+    {
+      const std::vector<size_t> & successors
+          = blocks_[stack.back ()].successors;
+      stack.pop_back ();
+
+      for (size_t j = 0; j < successors.size (); ++j)
+        {
+          if (!reachable_[successors[j]])
+            {
+              reachable_[successors[j]] = true;
+              stack.push_back (successors[j]);
+            }
+        }
+    }
+}
+
+// Find each block's immediate dominator by iterating to a fixed point over
+// blocks in reverse postorder.  The entry block is its own dominator, and
+// blocks not reachable from the entry have none.
+void
+ControlFlowGraph::find_dominators () const
+{
+  dominators_.assign (blocks_.size (), NONE);
+  if (blocks_.empty ())
+    return;
+
+  // Number blocks in postorder with an explicit depth first search stack
+  // of blocks and the index of the next successor of each to visit.
+  std::vector<size_t> postorder;
+  std::vector<size_t> numbers (blocks_.size (), NONE);
+  std::vector<bool> visited (blocks_.size (), false);
+  std::vector<std::pair<size_t, size_t> > stack;
+
+  stack.push_back (std::make_pair (static_cast<size_t> (0),
+                                   static_cast<size_t> (0)));
+  visited[0] = true;
+  while (!stack.empty ())
+    {
+      const size_t block = stack.back ().first;
+      const std::vector<size_t> & successors = blocks_[block].successors;
+
+      if (stack.back ().second < successors.size ())
+        {
+          const size_t next = successors[stack.back ().second++];
+          if (!visited[next])
+            {
+              visited[next] = true;
+              stack.push_back (std::make_pair (next,
+                                               static_cast<size_t> (0)));
+            }
+          continue;
+        }
+
+      numbers[block] = postorder.size ();
+      postorder.push_back (block);
+      stack.pop_back ();
+    }
+
+  dominators_[0] = 0;
+  bool is_changed = true;
+  while (is_changed)
+    {
+      is_changed = false;
+      for (size_t k = postorder.size (); k-- > 0; )
+        {
+          const size_t block = postorder[k];
+          if (block == 0)
+            continue;
+
+          // Intersect the dominators of processed predecessors.
+          size_t dominator = NONE;
+          const std::vector<size_t> & predecessors
+              = blocks_[block].predecessors;
+          for (size_t j = 0; j < predecessors.size (); ++j)
+            {
+              size_t other = predecessors[j];
+              if (dominators_[other] == NONE)
+                continue;
+              if (dominator == NONE)
+                {
+                  dominator = other;
+                  continue;
+                }
+
+              while (dominator != other)
+                {
+                  while (numbers[dominator] < numbers[other])
+                    dominator = dominators_[dominator];
+                  while (numbers[other] < numbers[dominator])
+                    other = dominators_[other];
+                }
+            }
+
+          if (dominators_[block] != dominator)
+            {
+              dominators_[block] = dominator;
+              is_changed = true;
+            }
+        }
+    }
+}
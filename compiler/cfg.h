@@ -0,0 +1,95 @@
+// vi: set ts=2 shiftwidth=2 expandtab:
+//
+// VNPForth - Compiled native Forth for x86 Linux
+// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef VNPFORTH_CFG_H
+#define VNPFORTH_CFG_H
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+class Opcode;
+
+// Control flow graph of one definition's opcodes.  Each basic block is a
+// range of opcode indexes, starting at the definition's first opcode, at
+// a label, or after a branch or tail call, and ending before the next such
+// start.  Block 0 is the entry block.  Blocks link to the blocks that may
+// run next, and each block reachable from the entry has an immediate
+// dominator, the entry being its own.  Dominators are found only when
+// first asked for, as few passes need them.  The graph refers to opcodes
+// by index, so any change to the opcode vector other than an in-place
+// replacement makes it stale.
+class ControlFlowGraph
+{
+public:
+  ControlFlowGraph (const std::vector<Opcode *> & opcodes,
+                    size_t begin, size_t end);
+
+  struct Block
+  {
+    size_t begin;
+    size_t end;
+    std::vector<size_t> successors;
+    std::vector<size_t> predecessors;
+  };
+
+  static const size_t NONE;
+
+  inline size_t
+  get_block_count () const
+  {
+    return blocks_.size ();
+  }
+
+  inline const Block &
+  get_block (size_t block) const
+  {
+    return blocks_[block];
+  }
+
+  size_t find_label_block (int label) const;
+  bool falls_through (size_t block) const;
+
+  inline bool
+  is_reachable (size_t block) const
+  {
+    return reachable_[block];
+  }
+
+  size_t get_immediate_dominator (size_t block) const;
+
+  bool dominates (size_t dominator, size_t block) const;
+
+private:
+  void find_blocks ();
+  void link_blocks ();
+  void find_reachable ();
+  void find_dominators () const;
+
+  const std::vector<Opcode *> & opcodes_;
+  const size_t begin_;
+  const size_t end_;
+  std::vector<Block> blocks_;
+  std::map<int, size_t> label_blocks_;
+  std::vector<bool> reachable_;
+  mutable std::vector<size_t> dominators_;
+};
+
+#endif
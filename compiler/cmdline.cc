@@ -27,6 +27,7 @@
 
 #include "options.h"
 #include "cmdline.h"
+#include "optable.h"
 #include "util.h"
 
 // Constructor parses and builds options flags and argument vector.  There
@@ -46,7 +47,7 @@ CommandLine::CommandLine (int argc, char * const * argv)
     }
 
   int c;
-  while ((c = getopt (argc, argv, ":gp::f:wOPSsMXD:U:#vh")) != -1)
+  while ((c = getopt (argc, argv, ":gp::f:m:j:C:wO::PSsMXD:U:#vh")) != -1)
     {
       switch (c)
         {
@@ -64,20 +65,84 @@ CommandLine::CommandLine (int argc, char * const * argv)
           options_.profiling_flag_ = true;
           break;
         case 'f':
-          if (std::string (optarg) != "PIC" && std::string (optarg) != "pic")
+          if (std::string (optarg) == "PIC" || std::string (optarg) == "pic")
+            options_.PIC_flag_ = true;
+          else if (std::string (optarg) == "stack-register")
+            options_.stack_register_flag_ = true;
+          else if (std::string (optarg) == "tos-register")
+            options_.tos_register_flag_ = true;
+          else if (std::string (optarg) == "no-integrated-as")
+            options_.external_as_flag_ = true;
+          else if (std::string (optarg).compare (0, 3, "no-") == 0
+                   && OpcodeTable::is_optimization_pass (optarg + 3))
+            options_.pass_flags_[optarg + 3] = false;
+          else if (OpcodeTable::is_optimization_pass (optarg))
+            options_.pass_flags_[optarg] = true;
+          else if (std::string (optarg) == "cache-stats")
+            options_.cache_stats_flag_ = true;
+          else if (std::string (optarg).compare (0, 11, "cache-size=") == 0
+                   && std::string (optarg).size () > 11
+                   && std::string (optarg).find_first_not_of ("0123456789", 11)
+                      == std::string::npos)
+            options_.cache_size_ = std::strtoull (optarg + 11, 0, 10) << 20;
+          else
             {
               std::cerr << program_name_ << ": invalid option -- -f"
                         << optarg << std::endl;
               usage ();
               std::exit (EXIT_FAILURE);
             }
-          options_.PIC_flag_ = true;
+          break;
+        case 'm':
+          if (std::string (optarg) == "64")
+            {
+              options_.x86_64_flag_ = true;
+              definitions_.insert ("x86_64");
+            }
+          else if (std::string (optarg) == "32")
+            {
+              options_.x86_64_flag_ = false;
+              definitions_.erase ("x86_64");
+            }
+          else
+            {
+              std::cerr << program_name_ << ": invalid option -- -m"
+                        << optarg << std::endl;
+              usage ();
+              std::exit (EXIT_FAILURE);
+            }
+          break;
+        case 'j':
+          options_.jobs_ = std::atoi (optarg);
+          if (options_.jobs_ < 1
+              || std::string (optarg).find_first_not_of ("0123456789")
+                 != std::string::npos)
+            {
+              std::cerr << program_name_ << ": invalid option -- -j"
+                        << optarg << std::endl;
+              usage ();
+              std::exit (EXIT_FAILURE);
+            }
+          break;
+        case 'C':
+          options_.cache_directory_ = optarg;
           break;
         case 'w':
           options_.weak_flag_ = true;
           break;
         case 'O':
-          options_.optimize_flag_ = true;
+          if (!optarg)
+            options_.optimize_level_ = 2;
+          else if (std::string (optarg).size () == 1
+                   && optarg[0] >= '0' && optarg[0] <= '3')
+            options_.optimize_level_ = optarg[0] - '0';
+          else
+            {
+              std::cerr << program_name_ << ": invalid option -- -O"
+                        << optarg << std::endl;
+              usage ();
+              std::exit (EXIT_FAILURE);
+            }
           break;
         case 'P':
           options_.intermediate_flag_ = true;
@@ -119,7 +184,8 @@ CommandLine::CommandLine (int argc, char * const * argv)
         }
     }
 
-  if (optind >= argc)
+  if (optind >= argc
+      && !(options_.cache_stats_flag_ && !options_.cache_directory_.empty ()))
     {
       std::cerr << program_name_ << ": no "
           << (options_.mangle_flag_
@@ -137,7 +203,12 @@ CommandLine::CommandLine (int argc, char * const * argv)
 
   if ((options_.mangle_flag_ || options_.demangle_flag_)
       && (options_.debugging_flag_ || options_.profiling_flag_
-           || options_.PIC_flag_ || options_.optimize_flag_
+           || options_.PIC_flag_ || options_.stack_register_flag_
+           || options_.tos_register_flag_ || options_.x86_64_flag_
+           || options_.external_as_flag_
+           || options_.jobs_ > 1
+           || !options_.cache_directory_.empty () || options_.cache_stats_flag_
+           || options_.optimize_level_ > 0 || !options_.pass_flags_.empty ()
            || options_.intermediate_flag_ || options_.assembly_flag_
            || !definitions_.empty ()))
     {
@@ -184,7 +255,37 @@ CommandLine::help ()
       << std::endl
       << " -fPIC,-fpic Generate position independent code, for shared libraries"
       << std::endl
-      << " -O          Optimize generated code (modest optimization only)"
+      << " -fstack-register"
+      << std::endl
+      << "             Keep the data stack index in a register, inline push/pop"
+      << std::endl
+      << " -ftos-register"
+      << std::endl
+      << "             Keep the top of the data stack in a register where possible"
+      << std::endl
+      << " -fno-integrated-as"
+      << std::endl
+      << "             Always run 'as' to assemble, instead of writing objects"
+      << std::endl
+      << " -fcache-size=<megabytes>"
+      << std::endl
+      << "             Limit the compile cache size, 64 megabytes by default"
+      << std::endl
+      << " -fcache-stats"
+      << std::endl
+      << "             Print compile cache hit and miss counts, and its size"
+      << std::endl
+      << " -m32,-m64   Generate code for x86 (the default) or x86_64"
+      << std::endl
+      << " -j<jobs>    Compile up to this many source files at once"
+      << std::endl
+      << " -C<dir>     Reuse earlier output from a compile cache in dir"
+      << std::endl
+      << " -O[<level>] Optimize generated code, at level 1 to 3, 2 by default"
+      << std::endl
+      << " -f<pass>,-fno-<pass>"
+      << std::endl
+      << "             Run or skip an optimization pass, whatever the level"
       << std::endl
       << " -P          Write out intermediate file (.p) during compilation"
       << std::endl
@@ -47,15 +47,31 @@
 // concentrated here to keep cpu-specific code in a single module.
 
 // Stack and register definitions.
-const Stack Stack::DATA = Stack (
-    "D", Mangler::mangle ("_dpush"), Mangler::mangle ("_dpop"));
-const Stack Stack::RETURN = Stack (
-    "R", Mangler::mangle ("_rpush"), Mangler::mangle ("_rpop"));
-const Stack Stack::FLOAT = Stack (
-    "F", Mangler::mangle ("_fpush"), Mangler::mangle ("_fpop"));
-
-const Register Register::R0 = Register ("0", "%eax");
-const Register Register::R1 = Register ("1", "%edx");
+const Stack::Names Stack::NAMES[] = {
+  { "D", Mangler::mangle ("_dpush"), Mangler::mangle ("_dpop") },
+  { "R", Mangler::mangle ("_rpush"), Mangler::mangle ("_rpop") },
+  { "F", Mangler::mangle ("_fpush"), Mangler::mangle ("_fpop") }
+};
+
+const Stack Stack::DATA = Stack (0);
+const Stack Stack::RETURN = Stack (1);
+const Stack Stack::FLOAT = Stack (2);
+
+// On x86_64, R3 and R4 are caller-saved, so definitions need not preserve
+// them as they do %esi and %edi on x86.
+const Register::Names Register::NAMES[] = {
+  { "0", "%eax", "%rax" },
+  { "1", "%edx", "%rdx" },
+  { "2", "%ecx", "%rcx" },
+  { "3", "%esi", "%r8" },
+  { "4", "%edi", "%r9" }
+};
+
+const Register Register::R0 = Register (0);
+const Register Register::R1 = Register (1);
+const Register Register::R2 = Register (2);
+const Register Register::R3 = Register (3);
+const Register Register::R4 = Register (4);
 
 // Convenience namespace for stab types.
 namespace Stabtype { enum { VOID = 1, CELL = 2, UCELL = 3, CHAR = 4 }; }
@@ -63,7 +79,62 @@ namespace Stabtype { enum { VOID = 1, CELL = 2, UCELL = 3, CHAR = 4 }; }
 // Debug constant, and hack to suppress unused arguments warnings.
 namespace {
 
-const int CELL_SIZE = sizeof (int);
+const int CELL_SIZE = 4;
+const int CELL_SIZE_X86_64 = 8;
+
+// Data stack layout, from runtime/dstack.ft, for -fstack-register code.
+// _dstack there allots DATA_STACK_CELLS, of which the top DATA_STACK_RESERVE
+// are kept for exception handling, and the 4080 that remain are the size
+// that its push and pop check, and that runtime/environ.ft reports as
+// stack-cells; change all of these together.  The index register holds
+// the count of cells on the data stack.  Checks on stack bounds are
+// deferred, but forced after a number of pushes, fewer than the reserve,
+// so that the reserve limits overrun.
+const int DATA_STACK_CELLS = 4096;
+const int DATA_STACK_RESERVE = 16;
+const int DATA_STACK_SIZE = DATA_STACK_CELLS - DATA_STACK_RESERVE;
+const int DATA_STACK_PUSHES_UNCHECKED = 8;
+const Register & STACK_INDEX_REGISTER = Register::R2;
+
+// Scratch register for x86_64 addressing.  Nothing else uses it, so it
+// needs no saving.
+const std::string SCRATCH_REGISTER_X86_64 = "%r11";
+
+// Target dependent cell size, and register and operand names.
+inline int
+cell_size (const Options & options)
+{
+  return options.target_x86_64 () ? CELL_SIZE_X86_64 : CELL_SIZE;
+}
+
+inline const std::string
+cpu_name (const Register & reg, const Options & options)
+{
+  return options.target_x86_64 ()
+         ? reg.get_cpu_name_x86_64 () : reg.get_cpu_name ();
+}
+
+// Return the x86_64 name for an x86 register outside the Register class,
+// for example %ebp, if compiling for x86_64.
+inline const std::string
+target_name (const std::string & name, const Options & options)
+{
+  return options.target_x86_64 () ? "%r" + name.substr (2) : name;
+}
+
+// Return an operand addressing a symbol's global offset table entry, for
+// PIC code, and one addressing the symbol itself, for non-PIC code.
+inline const std::string
+got_operand (const std::string & name, const Options & options)
+{
+  return name + (options.target_x86_64 () ? "@GOTPCREL(%rip)" : "@GOT(%ebx)");
+}
+
+inline const std::string
+symbol_operand (const std::string & name, const Options & options)
+{
+  return options.target_x86_64 () ? name + "(%rip)" : name;
+}
 
 inline void
 args_unused (std::ostream & outs, const Options & options)
@@ -209,10 +280,11 @@ CountedStringData::generate (std::ostream & outs) const
 void
 SymbolTable::generate (std::ostream & outs, const Options & options) const
 {
-  for (SymbolTableIterator iter = symbols_.begin ();
-      iter != symbols_.end (); ++iter)
+  const SymbolTableStore symbols = sorted_symbols ();
+  for (SymbolTableIterator iter = symbols.begin ();
+      iter != symbols.end (); ++iter)
     {
-      iter->second->generate (outs, options);
+      (*iter)->generate (outs, options);
     }
 }
 
@@ -234,8 +306,9 @@ VariableSymbol::generate (std::ostream & outs, const Options & options) const
       outs << '"' << ",40,0,0," << get_name () << std::endl;
     }
 
-  const int bytes = (units_ == CELL) ? size_ * CELL_SIZE : size_;
-  const int alignment = (bytes >= 32) ? 32 : ((units_ == CELL) ? CELL_SIZE : 1);
+  const int cell = cell_size (options);
+  const int bytes = (units_ == CELL) ? size_ * cell : size_;
+  const int alignment = (bytes >= 32) ? 32 : ((units_ == CELL) ? cell : 1);
 
   outs << "\t.comm  " << get_name ()
        << ',' << bytes << ',' << alignment << std::endl;
@@ -252,7 +325,8 @@ ConstantSymbol::generate (std::ostream & outs, const Options & options) const
     }
 
   outs << "\t.comm  " << get_name ()
-       << ',' << CELL_SIZE << ',' << CELL_SIZE << std::endl;
+       << ',' << cell_size (options) << ',' << cell_size (options)
+       << std::endl;
 }
 
 void
@@ -267,6 +341,394 @@ namespace {
 const Symbol * current_definition = 0;
 int current_opcode_sequence = 0;
 
+// Data stack index register state.  The register is live only inside
+// non-code definitions compiled with -fstack-register.  After a call it is
+// stale until next needed, and after a push or pop it is dirty until next
+// written back.  Track pushes and pops made since the last bounds check,
+// to decide when to check again.
+bool stack_register_live = false;
+bool stack_register_stale = false;
+bool stack_register_dirty = false;
+bool stack_register_popped = false;
+int stack_register_pushes = 0;
+int stack_check_sequence = 0;
+
+// Top of stack cache state.  The cache is live only inside non-code
+// definitions compiled with -ftos-register.  A data stack push is held
+// back while its value remains in the pushed register, so that a
+// following pop can take it from there.
+bool tos_register_live = false;
+const PushOpcode * tos_register_pending = 0;
+
+// Callee-saved registers that the current non-code definition uses to hold
+// data stack cells, and so must preserve.
+std::vector<const Register *> saved_registers;
+
+// Count of machine stack frame slots that the current non-code definition
+// uses to hold return stack cells.
+int frame_slots = 0;
+
+// True if the current non-code definition is a leaf that runs without a
+// frame.  It saves %ebx only if x86 PIC code needs it for the global
+// offset table.
+bool frameless = false;
+
+const std::string MANGLED_DSTACK = Mangler::mangle ("_dstack");
+const std::string MANGLED_DSINDEX = Mangler::mangle ("_dsindex");
+const std::string MANGLED_DSCHECK = Mangler::mangle ("_dscheck");
+
+// Emit a data stack bounds check if any push or pop happened since the
+// last one.  An unsigned compare catches both overflow and underflow.
+// _dscheck raises the appropriate exception, or returns if the runtime is
+// already handling a stack exception.
+void
+generate_stack_check (std::ostream & outs, const Options & options)
+{
+  if (!stack_register_live
+      || (!stack_register_popped && stack_register_pushes == 0))
+    return;
+
+  const int sequence = stack_check_sequence++;
+
+  outs << "\tcmp $" << DATA_STACK_SIZE << ','
+       << cpu_name (STACK_INDEX_REGISTER, options) << std::endl
+       << "\tjbe .LDS" << sequence << std::endl
+       << "\tcall " << MANGLED_DSCHECK
+       << (options.position_independent () ? "@PLT" : "") << std::endl
+       << ".LDS" << sequence << ':' << std::endl;
+
+  stack_register_popped = false;
+  stack_register_pushes = 0;
+}
+
+// Write the data stack index register back to _dsindex, for a call, or
+// for return from the definition.  Registers %eax and %edx are free here.
+void
+generate_stack_writeback (std::ostream & outs, const Options & options)
+{
+  if (!stack_register_dirty)
+    return;
+
+  generate_stack_check (outs, options);
+
+  const std::string index = cpu_name (STACK_INDEX_REGISTER, options);
+
+  if (options.position_independent ())
+    {
+      const std::string scratch = options.target_x86_64 ()
+                                  ? SCRATCH_REGISTER_X86_64 : "%eax";
+
+      outs << "\tmov " << got_operand (MANGLED_DSINDEX, options) << ','
+           << scratch << std::endl
+           << "\tmov " << index << ",(" << scratch << ')' << std::endl;
+    }
+  else
+    {
+      outs << "\tmov " << index << ','
+           << symbol_operand (MANGLED_DSINDEX, options) << std::endl;
+    }
+
+  stack_register_dirty = false;
+}
+
+// Load the data stack index register from _dsindex if stale, on first use
+// after definition entry or a call.
+void
+generate_stack_reload (std::ostream & outs, const Options & options)
+{
+  if (!stack_register_stale)
+    return;
+
+  const std::string index = cpu_name (STACK_INDEX_REGISTER, options);
+
+  if (options.position_independent ())
+    {
+      outs << "\tmov " << got_operand (MANGLED_DSINDEX, options) << ','
+           << index << std::endl
+           << "\tmov (" << index << ")," << index << std::endl;
+    }
+  else
+    {
+      outs << "\tmov " << symbol_operand (MANGLED_DSINDEX, options) << ','
+           << index << std::endl;
+    }
+
+  stack_register_stale = false;
+}
+
+// Return the name of a scratch register that is not the one given.
+inline const std::string
+other_register (const Register & reg, const Options & options)
+{
+  return reg.equals (Register::R0)
+         ? cpu_name (Register::R1, options) : cpu_name (Register::R0, options);
+}
+
+// Push a register onto a stack, inline through the data stack index
+// register if live, otherwise by calling the runtime.
+void
+generate_push (std::ostream & outs, const Options & options,
+               const Register & reg, const Stack & stack)
+{
+  // Inline data stack push, through the index register.  Check bounds
+  // first if the index may have gone negative, or if too many pushes are
+  // outstanding.
+  if (stack_register_live && stack.equals (Stack::DATA))
+    {
+      generate_stack_reload (outs, options);
+      if (stack_register_popped
+          || stack_register_pushes >= DATA_STACK_PUSHES_UNCHECKED)
+        generate_stack_check (outs, options);
+
+      const std::string index = cpu_name (STACK_INDEX_REGISTER, options);
+
+      if (options.target_x86_64 ())
+        {
+          const std::string & scratch = SCRATCH_REGISTER_X86_64;
+
+          if (options.position_independent ())
+            {
+              outs << "\tmov " << got_operand (MANGLED_DSTACK, options) << ','
+                   << scratch << std::endl;
+            }
+          else
+            {
+              outs << "\tlea " << symbol_operand (MANGLED_DSTACK, options)
+                   << ',' << scratch << std::endl;
+            }
+          outs << "\tmov " << cpu_name (reg, options) << ",(" << scratch
+               << ',' << index << ',' << CELL_SIZE_X86_64 << ')' << std::endl;
+        }
+      else if (options.position_independent ())
+        {
+          const std::string scratch = other_register (reg, options);
+
+          outs << "\tpush " << scratch << std::endl
+               << "\tmov " << got_operand (MANGLED_DSTACK, options) << ','
+               << scratch << std::endl
+               << "\tmov " << cpu_name (reg, options) << ",(" << scratch << ','
+               << index << ',' << CELL_SIZE << ')' << std::endl
+               << "\tpop " << scratch << std::endl;
+        }
+      else
+        {
+          outs << "\tmov " << cpu_name (reg, options) << ',' << MANGLED_DSTACK
+               << "(," << index << ',' << CELL_SIZE << ')' << std::endl;
+        }
+      outs << "\tinc " << index << std::endl;
+
+      stack_register_dirty = true;
+      ++stack_register_pushes;
+      return;
+    }
+
+  const std::string accumulator = cpu_name (Register::R0, options);
+  const bool need_exchange = !reg.equals (Register::R0);
+
+  if (need_exchange)
+    {
+      outs << "\txchg " << cpu_name (reg, options) << ',' << accumulator
+           << std::endl;
+    }
+
+  outs << "\tcall " << stack.get_push_function ()
+       << (options.position_independent () ? "@PLT" : "") << std::endl;
+
+  if (need_exchange)
+    {
+      outs << "\txchg " << accumulator << ',' << cpu_name (reg, options)
+           << std::endl;
+    }
+}
+
+// Pop a stack into a register, inline through the data stack index
+// register if live, otherwise by calling the runtime.
+void
+generate_pop (std::ostream & outs, const Options & options,
+              const Register & reg, const Stack & stack)
+{
+  // Inline data stack pop, through the index register.  Underflow shows
+  // up as a negative index at the next bounds check.
+  if (stack_register_live && stack.equals (Stack::DATA))
+    {
+      generate_stack_reload (outs, options);
+
+      const std::string index = cpu_name (STACK_INDEX_REGISTER, options);
+      const std::string target = cpu_name (reg, options);
+
+      outs << "\tdec " << index << std::endl;
+      if (options.position_independent ())
+        {
+          outs << "\tmov " << got_operand (MANGLED_DSTACK, options) << ','
+               << target << std::endl
+               << "\tmov (" << target << ',' << index << ','
+               << cell_size (options) << ")," << target << std::endl;
+        }
+      else if (options.target_x86_64 ())
+        {
+          outs << "\tlea " << symbol_operand (MANGLED_DSTACK, options) << ','
+               << target << std::endl
+               << "\tmov (" << target << ',' << index << ','
+               << CELL_SIZE_X86_64 << ")," << target << std::endl;
+        }
+      else
+        {
+          outs << "\tmov " << MANGLED_DSTACK << "(," << index << ','
+               << CELL_SIZE << ")," << target << std::endl;
+        }
+
+      stack_register_dirty = true;
+      stack_register_popped = true;
+      return;
+    }
+
+  const std::string accumulator = cpu_name (Register::R0, options);
+  const bool need_exchange = !reg.equals (Register::R0);
+
+  if (need_exchange)
+    {
+      outs << "\txchg " << cpu_name (reg, options) << ',' << accumulator
+           << std::endl;
+    }
+
+  outs << "\tcall " << stack.get_pop_function ()
+       << (options.position_independent () ? "@PLT" : "") << std::endl;
+
+  if (need_exchange)
+    {
+      outs << "\txchg " << accumulator << ',' << cpu_name (reg, options)
+           << std::endl;
+    }
+}
+
+// Find the callee-saved stack slot registers used in the definition that
+// starts at begin.  Only opcodes that do not call or branch can write one.
+// The x86_64 stack slot registers are all caller-saved.
+void
+find_saved_registers (std::vector<Opcode *>::const_iterator begin,
+                      std::vector<Opcode *>::const_iterator end,
+                      const Options & options)
+{
+  saved_registers.clear ();
+  if (options.target_x86_64 ())
+    return;
+
+  const Register * callee_saved[] = { &Register::R3, &Register::R4 };
+  for (size_t i = 0; i < sizeof (callee_saved) / sizeof (*callee_saved); ++i)
+    {
+      const Register & reg = *callee_saved[i];
+
+      for (std::vector<Opcode *>::const_iterator iter = begin + 1;
+           iter != end && !(*iter)->is_enddefine_opcode (); ++iter)
+        {
+          const Opcode * opcode = *iter;
+          const bool is_register_opcode = !(opcode->is_call_opcode ()
+                                            || opcode->is_branching_opcode ()
+                                            || opcode->is_label_opcode ()
+                                            || opcode->is_assembly_opcode ());
+
+          if (is_register_opcode && opcode->modifies_register (reg))
+            {
+              saved_registers.push_back (&reg);
+              break;
+            }
+        }
+    }
+}
+
+// Find the count of return stack frame slots used in the definition that
+// starts at begin.
+void
+find_frame_slots (std::vector<Opcode *>::const_iterator begin,
+                  std::vector<Opcode *>::const_iterator end)
+{
+  frame_slots = 0;
+
+  for (std::vector<Opcode *>::const_iterator iter = begin + 1;
+       iter != end && !(*iter)->is_enddefine_opcode (); ++iter)
+    {
+      if (const FrameOpcode * frame = (*iter)->is_frame_opcode ())
+        frame_slots = std::max (frame_slots, frame->get_slot () + 1);
+    }
+}
+
+// Decide whether the definition that starts at begin may run without a
+// frame.  When optimizing, leaf definitions qualify, those that make no
+// calls, hold no return stack cells in frame slots, and have no inline
+// assembly.  Calls to the runtime's stack push and pop functions do not
+// count, as they need nothing of the caller's frame.  Exception unwinding
+// never stops in a leaf, as CATCH and its callers all make calls.  Main,
+// and profiled code, always have frames.  Call after find_frame_slots.
+void
+find_frameless (std::vector<Opcode *>::const_iterator begin,
+                std::vector<Opcode *>::const_iterator end,
+                const Options & options)
+{
+  const Symbol * symbol = (*begin)->is_define_opcode ()->get_symbol ();
+
+  frameless = options.optimize_code () && !options.include_profiling ()
+              && !symbol->is_codeword_symbol ()
+              && symbol->get_name () != "main" && !frame_slots;
+
+  for (std::vector<Opcode *>::const_iterator iter = begin + 1;
+       frameless && iter != end && !(*iter)->is_enddefine_opcode (); ++iter)
+    frameless = !((*iter)->is_call_opcode ()
+                  || (*iter)->is_assembly_opcode ());
+}
+
+// Return true if the current definition saves %ebx.
+inline bool
+saves_ebx (const Options & options)
+{
+  return !frameless
+         || (options.position_independent () && !options.target_x86_64 ());
+}
+
+// Return the operand that addresses a frame slot.  Slots lie below the
+// saved %ebx and any saved stack slot registers.
+const std::string
+frame_operand (int slot, const Options & options)
+{
+  std::ostringstream operand;
+  operand << '-' << cell_size (options) * (2 + saved_registers.size () + slot)
+          << '(' << target_name ("%ebp", options) << ')';
+  return operand.str ();
+}
+
+// Release the frame of a non-code definition, restoring the registers that
+// it saved, ready to return or to jump to a tail call.
+void
+generate_frame_release (std::ostream & outs, const Options & options)
+{
+  if (frame_slots)
+    {
+      const size_t offset = cell_size (options)
+                            * (1 + saved_registers.size ());
+      outs << "\tlea -" << offset << '(' << target_name ("%ebp", options)
+           << ")," << target_name ("%esp", options) << std::endl;
+    }
+
+  for (size_t i = saved_registers.size (); i > 0; --i)
+    outs << "\tpop " << cpu_name (*saved_registers[i - 1], options)
+         << std::endl;
+  if (saves_ebx (options))
+    outs << "\tpop " << target_name ("%ebx", options) << std::endl;
+  if (!frameless)
+    outs << "\tleave" << std::endl;
+}
+
+// Write out any data stack push deferred by the top of stack cache.
+void
+generate_tos_flush (std::ostream & outs, const Options & options)
+{
+  if (tos_register_pending)
+    {
+      generate_push (outs, options, tos_register_pending->get_register (),
+                     tos_register_pending->get_stack ());
+      tos_register_pending = 0;
+    }
+}
+
 } // namespace
 
 void
@@ -274,12 +736,40 @@ OpcodeTable::generate (std::ostream & outs, const Options & options) const
 {
   current_definition = 0;
   current_opcode_sequence = 0;
+  stack_register_live = false;
+  stack_check_sequence = 0;
+  tos_register_live = false;
+  tos_register_pending = 0;
   int current_line = -1;
 
   for (size_t i = 0; i < opcodes_.size (); ++i)
     {
       const Opcode * opcode = opcodes_[i];
 
+      if (opcode->is_define_opcode ())
+        {
+          find_saved_registers (opcodes_.begin () + i, opcodes_.end (),
+                                options);
+          find_frame_slots (opcodes_.begin () + i, opcodes_.end ());
+          find_frameless (opcodes_.begin () + i, opcodes_.end (), options);
+        }
+
+      // Write out a cached top of stack before any opcode that may change
+      // its register, or that joins control flow.  A data stack pop takes
+      // the cached value itself.
+      if (tos_register_pending)
+        {
+          const PopOpcode * pop = opcode->is_pop_opcode ();
+          const bool takes_cached = pop
+                                    && pop->get_stack ().equals (Stack::DATA);
+
+          if (!takes_cached
+              && (opcode->is_label_opcode () || opcode->is_branching_opcode ()
+                  || opcode->modifies_register
+                       (tos_register_pending->get_register ())))
+            generate_tos_flush (outs, options);
+        }
+
       // Write opcode debugging data for line number if required.
       if (options.include_debugging () && current_line != opcode->get_line ())
         {
@@ -300,6 +790,17 @@ OpcodeTable::generate (std::ostream & outs, const Options & options) const
             }
         }
 
+      // Labels and branches join control flow, so bring the data stack
+      // index register to a loaded and checked state before either.  A
+      // label may be reached from a branch with unwritten pushes or pops.
+      if (opcode->is_label_opcode () || opcode->is_branching_opcode ())
+        {
+          generate_stack_check (outs, options);
+          generate_stack_reload (outs, options);
+          if (opcode->is_label_opcode ())
+            stack_register_dirty = stack_register_live;
+        }
+
       // Generate opcode assembly.
       opcode->generate (outs, options);
 
@@ -311,10 +812,43 @@ OpcodeTable::generate (std::ostream & outs, const Options & options) const
 void
 CallOpcode::generate (std::ostream & outs, const Options & options) const
 {
+  if (stack_register_live)
+    {
+      generate_stack_writeback (outs, options);
+      stack_register_stale = true;
+    }
+
   outs << "\tcall " << symbol_->get_name ()
        << (options.position_independent () ? "@PLT" : "") << std::endl;
 }
 
+void
+TailCallOpcode::generate (std::ostream & outs, const Options & options) const
+{
+  if (stack_register_live)
+    {
+      generate_stack_writeback (outs, options);
+      stack_register_stale = true;
+    }
+
+  const std::string & name = get_symbol ()->get_name ();
+
+  // An x86 PLT entry needs %ebx to address the global offset table, but
+  // releasing the frame restores the caller's %ebx, so jump through the
+  // global offset table instead.
+  if (options.position_independent () && !options.target_x86_64 ())
+    {
+      outs << "\tmov " << got_operand (name, options) << ",%ecx" << std::endl;
+      generate_frame_release (outs, options);
+      outs << "\tjmp *%ecx" << std::endl;
+      return;
+    }
+
+  generate_frame_release (outs, options);
+  outs << "\tjmp " << name
+       << (options.position_independent () ? "@PLT" : "") << std::endl;
+}
+
 void
 DefineOpcode::generate (std::ostream & outs, const Options & options) const
 {
@@ -348,8 +882,12 @@ DefineOpcode::generate (std::ostream & outs, const Options & options) const
            << ".LMa" << current_opcode_sequence << ':' << std::endl;
     }
 
-  outs << "\tpush %ebp" << std::endl
-       << "\tmov %esp,%ebp" << std::endl;
+  if (!frameless)
+    {
+      outs << "\tpush " << target_name ("%ebp", options) << std::endl
+           << "\tmov " << target_name ("%esp", options) << ','
+           << target_name ("%ebp", options) << std::endl;
+    }
 
   // Preserve registers.  Careful reading of the Intel ABI reveals that it's
   // necessary only to preserve selected registers, and as we don't even use
@@ -357,9 +895,9 @@ DefineOpcode::generate (std::ostream & outs, const Options & options) const
   if (symbol_->is_codeword_symbol ())
     {
       // Always push %ebx first, to match the non-codeword layout.
-      outs << "\tpush %ebx" << std::endl
-           << "\tpush %edi" << std::endl
-           << "\tpush %esi" << std::endl;
+      outs << "\tpush " << target_name ("%ebx", options) << std::endl
+           << "\tpush " << target_name ("%edi", options) << std::endl
+           << "\tpush " << target_name ("%esi", options) << std::endl;
     }
   else
     {
@@ -367,26 +905,78 @@ DefineOpcode::generate (std::ostream & outs, const Options & options) const
       // anyway.  This makes the part of the stack frame used by stack
       // unwinding is same in both PIC and non-PIC forth words, and means
       // exceptions can handle both seamlessly.  Wastes a little execution
-      // time and text space in non-PIC executables.
-      outs << "\tpush %ebx" << std::endl;
+      // time and text space in non-PIC executables.  Leaves without a
+      // frame are never unwound, so skip it there.
+      if (saves_ebx (options))
+        outs << "\tpush " << target_name ("%ebx", options) << std::endl;
+
+      // Also preserve any registers used to hold data stack cells.
+      for (size_t i = 0; i < saved_registers.size (); ++i)
+        {
+          outs << "\tpush " << cpu_name (*saved_registers[i], options)
+               << std::endl;
+        }
+
+      // Reserve frame slots for return stack cells, in whole 16 byte
+      // units so that the stack keeps its alignment.
+      if (frame_slots)
+        {
+          const int bytes = (frame_slots * cell_size (options) + 15) & ~15;
+          outs << "\tsub $" << bytes << ',' << target_name ("%esp", options)
+               << std::endl;
+        }
     }
 
   const int symbol_id = symbol_->get_id ();
 
-  if (options.position_independent ())
+  // x86_64 addresses the global offset table relative to %rip, so needs
+  // no %ebx setup.
+  if (options.position_independent () && !options.target_x86_64 ())
     {
       outs << "\tcall .Lpic" << symbol_id << std::endl
            << ".Lpic" << symbol_id << ':' << std::endl
            << "\tpop %ebx" << std::endl
            << "\tadd $_GLOBAL_OFFSET_TABLE_"
            << "+[.-.Lpic" << symbol_id << "],%ebx" << std::endl;
-
-      // Write a label usable for PIC compilation flag checking.
-      outs << "0:" << std::endl;
     }
 
+  // Write a label usable for PIC compilation flag checking.
+  if (options.position_independent ())
+    outs << "0:" << std::endl;
+
   // Set up the library's argc, argv, and envp from the main function.
-  if (symbol_name == "main")
+  // On x86_64 these arrive in registers.
+  if (symbol_name == "main" && options.target_x86_64 ())
+    {
+      static std::map<std::string, std::string> registered;
+
+      if (registered.empty ())
+        {
+          registered["%rdi"] = Mangler::mangle ("_argc");
+          registered["%rsi"] = Mangler::mangle ("_argv");
+          registered["%rdx"] = Mangler::mangle ("_envp");
+        }
+
+      for (std::map<std::string, std::string>::const_iterator
+             iter = registered.begin (); iter != registered.end (); ++iter)
+        {
+          const std::string & symbol_name = iter->second;
+
+          if (options.position_independent ())
+            {
+              outs << "\tmov " << got_operand (symbol_name, options) << ','
+                   << SCRATCH_REGISTER_X86_64 << std::endl
+                   << "\tmov " << iter->first << ",("
+                   << SCRATCH_REGISTER_X86_64 << ')' << std::endl;
+            }
+          else
+            {
+              outs << "\tmov " << iter->first << ','
+                   << symbol_operand (symbol_name, options) << std::endl;
+            }
+        }
+    }
+  else if (symbol_name == "main")
     {
       static std::map<int, std::string> stacked;
 
@@ -413,7 +1003,15 @@ DefineOpcode::generate (std::ostream & outs, const Options & options) const
         }
     }
 
-  if (options.include_profiling ())
+  // x86_64 mcount finds its own counters.
+  if (options.include_profiling () && options.target_x86_64 ())
+    {
+      if (options.position_independent ())
+        outs << "\tcall *mcount@GOTPCREL(%rip)" << std::endl;
+      else
+        outs << "\tcall mcount" << std::endl;
+    }
+  else if (options.include_profiling ())
     {
       outs << ".data" << std::endl
            << "\t.align 4" << std::endl
@@ -448,6 +1046,20 @@ DefineOpcode::generate (std::ostream & outs, const Options & options) const
   if (symbol_->is_codeword_symbol ())
     outs << "#APP" << std::endl;
 
+  // Code words use the runtime push and pop functions, so the data stack
+  // index register is only for ordinary definitions.
+  if (options.stack_register () && !symbol_->is_codeword_symbol ())
+    {
+      stack_register_live = true;
+      stack_register_stale = true;
+      stack_register_dirty = false;
+      stack_register_popped = false;
+      stack_register_pushes = 0;
+    }
+
+  tos_register_live = options.tos_register ()
+                      && !symbol_->is_codeword_symbol ();
+
   current_definition = symbol_;
 }
 
@@ -457,6 +1069,15 @@ EndDefineOpcode::generate (std::ostream & outs, const Options & options) const
   if (symbol_->is_codeword_symbol ())
     outs << "#NO_APP" << std::endl;
 
+  generate_tos_flush (outs, options);
+  tos_register_live = false;
+
+  if (stack_register_live)
+    {
+      generate_stack_writeback (outs, options);
+      stack_register_live = false;
+    }
+
   const std::string & symbol_name = symbol_->get_name ();
   const int symbol_id = symbol_->get_id ();
 
@@ -472,16 +1093,16 @@ EndDefineOpcode::generate (std::ostream & outs, const Options & options) const
   // Restore registers.
   if (symbol_->is_codeword_symbol ())
     {
-      outs << "\tpop %esi" << std::endl
-           << "\tpop %edi" << std::endl
-           << "\tpop %ebx" << std::endl;
+      outs << "\tpop " << target_name ("%esi", options) << std::endl
+           << "\tpop " << target_name ("%edi", options) << std::endl
+           << "\tpop " << target_name ("%ebx", options) << std::endl
+           << "\tleave" << std::endl;
     }
   else
-    outs << "\tpop %ebx" << std::endl;
+    generate_frame_release (outs, options);
 
   // Function postamble.
-  outs << "\tleave" << std::endl
-       << "\tret" << std::endl;
+  outs << "\tret" << std::endl;
 
   outs << ".Lfe" << symbol_id << ':' << std::endl
        << "\t.size\t " << symbol_name << ",.Lfe" << symbol_id << '-'
@@ -518,36 +1139,40 @@ AssemblyOpcode::generate (std::ostream & outs, const Options & options) const
 void
 LoadValueOpcode::generate (std::ostream & outs, const Options & options) const
 {
-  const int value = value_.get_value ();
+  const long long value = value_.get_value ();
 
   if (options.optimize_code ()
       && (value == 1 || value == -1 || value == 0))
     {
-      outs << "\txor " << reg_.get_cpu_name () << ','
-           << reg_.get_cpu_name () << std::endl;
+      outs << "\txor " << cpu_name (reg_, options) << ','
+           << cpu_name (reg_, options) << std::endl;
       switch (value)
         {
         case  1:
-          outs << "\tinc " << reg_.get_cpu_name () << std::endl;
+          outs << "\tinc " << cpu_name (reg_, options) << std::endl;
           break;
         case -1:
-          outs << "\tdec " << reg_.get_cpu_name () << std::endl;
+          outs << "\tdec " << cpu_name (reg_, options) << std::endl;
           break;
         case  0:
           break;
         }
     }
+  else if (!value_.is_immediate ())
+    {
+      outs << "\tmovabs $" << value << ',' << cpu_name (reg_, options)
+           << std::endl;
+    }
   else
-    outs << "\tmov $" << value << ',' << reg_.get_cpu_name () << std::endl;
+    outs << "\tmov $" << value << ',' << cpu_name (reg_, options) << std::endl;
 }
 
 void
 LoadRegisterOpcode::generate (std::ostream & outs,
                               const Options & options) const
 {
-  args_unused (options);
-  outs << "\tmov " << with_.get_cpu_name () << ','
-       << reg_.get_cpu_name () << std::endl;
+  outs << "\tmov " << cpu_name (with_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
 }
 
 void
@@ -555,13 +1180,13 @@ LoadSymbolOpcode::generate (std::ostream & outs, const Options & options) const
 {
   if (options.position_independent ())
     {
-      outs << "\tmov " << symbol_->get_name () << "@GOT(%ebx),"
-           << reg_.get_cpu_name () << std::endl;
+      outs << "\tmov " << got_operand (symbol_->get_name (), options) << ','
+           << cpu_name (reg_, options) << std::endl;
     }
   else
     {
-      outs << "\tlea " << symbol_->get_name () << ','
-           << reg_.get_cpu_name () << std::endl;
+      outs << "\tlea " << symbol_operand (symbol_->get_name (), options) << ','
+           << cpu_name (reg_, options) << std::endl;
     }
 }
 
@@ -569,31 +1194,49 @@ void
 LoadSymbolIndirectOpcode::generate (std::ostream & outs,
                                     const Options & options) const
 {
-  if (options.position_independent ())
+  if (options.position_independent ()
+      && (stack_register_live || options.target_x86_64 ()))
+    {
+      outs << "\tmov " << got_operand (symbol_->get_name (), options) << ','
+           << cpu_name (reg_, options) << std::endl
+           << "\tmov (" << cpu_name (reg_, options) << "),"
+           << cpu_name (reg_, options) << std::endl;
+    }
+  else if (options.position_independent ())
     {
       outs << "\tmov " << symbol_->get_name () << "@GOT(%ebx),%ecx"
            << std::endl
-           << "\tmov (%ecx)," << reg_.get_cpu_name () << std::endl;
+           << "\tmov (%ecx)," << cpu_name (reg_, options) << std::endl;
+    }
+  else if (options.target_x86_64 ())
+    {
+      outs << "\tmov " << symbol_operand (symbol_->get_name (), options) << ','
+           << cpu_name (reg_, options) << std::endl;
     }
   else
     {
       outs << "\tmov (" << symbol_->get_name () << "),"
-           << reg_.get_cpu_name () << std::endl;
+           << cpu_name (reg_, options) << std::endl;
     }
 }
 
 void
 LoadDataOpcode::generate (std::ostream & outs, const Options & options) const
 {
-  if (options.position_independent ())
+  if (options.target_x86_64 ())
+    {
+      outs << "\tlea .LC" << data_->get_id () << "(%rip),"
+           << cpu_name (reg_, options) << std::endl;
+    }
+  else if (options.position_independent ())
     {
       outs << "\tlea .LC" << data_->get_id () << "@GOTOFF(%ebx),"
-           << reg_.get_cpu_name () << std::endl;
+           << cpu_name (reg_, options) << std::endl;
     }
   else
     {
       outs << "\tlea .LC" << data_->get_id () << ','
-           << reg_.get_cpu_name () << std::endl;
+           << cpu_name (reg_, options) << std::endl;
     }
 }
 
@@ -601,15 +1244,38 @@ void
 StoreSymbolIndirectOpcode::generate (std::ostream & outs,
                                      const Options & options) const
 {
-  if (options.position_independent ())
+  if (options.position_independent () && options.target_x86_64 ())
+    {
+      outs << "\tmov " << got_operand (symbol_->get_name (), options) << ','
+           << SCRATCH_REGISTER_X86_64 << std::endl
+           << "\tmov " << cpu_name (reg_, options) << ",("
+           << SCRATCH_REGISTER_X86_64 << ')' << std::endl;
+    }
+  else if (options.position_independent () && stack_register_live)
+    {
+      const std::string scratch = other_register (reg_, options);
+
+      outs << "\tpush " << scratch << std::endl
+           << "\tmov " << symbol_->get_name () << "@GOT(%ebx),"
+           << scratch << std::endl
+           << "\tmov " << cpu_name (reg_, options) << ",(" << scratch << ')'
+           << std::endl
+           << "\tpop " << scratch << std::endl;
+    }
+  else if (options.position_independent ())
     {
       outs << "\tmov " << symbol_->get_name () << "@GOT(%ebx),%ecx"
            << std::endl
-           << "\tmov " << reg_.get_cpu_name () << ",(%ecx)" << std::endl;
+           << "\tmov " << cpu_name (reg_, options) << ",(%ecx)" << std::endl;
+    }
+  else if (options.target_x86_64 ())
+    {
+      outs << "\tmov " << cpu_name (reg_, options) << ','
+           << symbol_operand (symbol_->get_name (), options) << std::endl;
     }
   else
     {
-      outs << "\tmov " << reg_.get_cpu_name () << ",("
+      outs << "\tmov " << cpu_name (reg_, options) << ",("
            << symbol_->get_name () << ')' << std::endl;
     }
 }
@@ -617,31 +1283,50 @@ StoreSymbolIndirectOpcode::generate (std::ostream & outs,
 void
 PushOpcode::generate (std::ostream & outs, const Options & options) const
 {
-  const bool need_exchange = !(reg_.get_cpu_name () == "%eax");
-
-  if (need_exchange)
-    outs << "\txchg " << reg_.get_cpu_name () << ",%eax" << std::endl;
-
-  outs << "\tcall " << stack_.get_push_function ()
-       << (options.position_independent () ? "@PLT" : "") << std::endl;
+  // Defer a data stack push while the top of stack cache is live.
+  if (tos_register_live && stack_.equals (Stack::DATA))
+    {
+      generate_tos_flush (outs, options);
+      tos_register_pending = this;
+      return;
+    }
 
-  if (need_exchange)
-    outs << "\txchg %eax," << reg_.get_cpu_name () << std::endl;
+  generate_push (outs, options, reg_, stack_);
 }
 
 void
 PopOpcode::generate (std::ostream & outs, const Options & options) const
 {
-  const bool need_exchange = !(reg_.get_cpu_name () == "%eax");
+  // Take a data stack pop from any cached top of stack.
+  if (tos_register_pending && stack_.equals (Stack::DATA))
+    {
+      const Register & cached = tos_register_pending->get_register ();
 
-  if (need_exchange)
-    outs << "\txchg " << reg_.get_cpu_name () << ",%eax" << std::endl;
+      if (!cached.equals (reg_))
+        {
+          outs << "\tmov " << cpu_name (cached, options) << ','
+               << cpu_name (reg_, options) << std::endl;
+        }
 
-  outs << "\tcall " << stack_.get_pop_function ()
-       << (options.position_independent () ? "@PLT" : "") << std::endl;
+      tos_register_pending = 0;
+      return;
+    }
 
-  if (need_exchange)
-    outs << "\txchg %eax," << reg_.get_cpu_name () << std::endl;
+  generate_pop (outs, options, reg_, stack_);
+}
+
+void
+LoadFrameOpcode::generate (std::ostream & outs, const Options & options) const
+{
+  outs << "\tmov " << frame_operand (slot_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
+}
+
+void
+StoreFrameOpcode::generate (std::ostream & outs, const Options & options) const
+{
+  outs << "\tmov " << cpu_name (reg_, options) << ','
+       << frame_operand (slot_, options) << std::endl;
 }
 
 void
@@ -655,26 +1340,25 @@ AddValueOpcode::generate (std::ostream & outs, const Options & options) const
       switch (value)
         {
         case  1:
-          outs << "\tinc " << reg_.get_cpu_name () << std::endl;
+          outs << "\tinc " << cpu_name (reg_, options) << std::endl;
           break;
         case -1:
-          outs << "\tdec " << reg_.get_cpu_name () << std::endl;
+          outs << "\tdec " << cpu_name (reg_, options) << std::endl;
           break;
         case  0:
           break;
         }
     }
   else
-    outs << "\tadd $" << value << ',' << reg_.get_cpu_name () << std::endl;
+    outs << "\tadd $" << value << ',' << cpu_name (reg_, options) << std::endl;
 }
 
 void
 AddRegisterOpcode::generate (std::ostream & outs,
                              const Options & options) const
 {
-  args_unused (options);
-  outs << "\tadd " << increment_.get_cpu_name () << ','
-       << reg_.get_cpu_name () << std::endl;
+  outs << "\tadd " << cpu_name (increment_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
 }
 
 void
@@ -689,26 +1373,306 @@ SubtractValueOpcode::generate (std::ostream & outs,
       switch (value)
         {
         case  1:
-          outs << "\tdec " << reg_.get_cpu_name () << std::endl;
+          outs << "\tdec " << cpu_name (reg_, options) << std::endl;
           break;
         case -1:
-          outs << "\tinc " << reg_.get_cpu_name () << std::endl;
+          outs << "\tinc " << cpu_name (reg_, options) << std::endl;
           break;
         case  0:
           break;
         }
     }
   else
-    outs << "\tsub $" << value << ',' << reg_.get_cpu_name () << std::endl;
+    outs << "\tsub $" << value << ',' << cpu_name (reg_, options) << std::endl;
 }
 
 void
 SubtractRegisterOpcode::generate (std::ostream & outs,
                                   const Options & options) const
 {
-  args_unused (options);
-  outs << "\tsub " << decrement_.get_cpu_name () << ','
-       << reg_.get_cpu_name () << std::endl;
+  outs << "\tsub " << cpu_name (decrement_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
+}
+
+void
+AndRegisterOpcode::generate (std::ostream & outs,
+                             const Options & options) const
+{
+  outs << "\tand " << cpu_name (with_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
+}
+
+void
+OrRegisterOpcode::generate (std::ostream & outs,
+                            const Options & options) const
+{
+  outs << "\tor " << cpu_name (with_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
+}
+
+void
+XorRegisterOpcode::generate (std::ostream & outs,
+                             const Options & options) const
+{
+  outs << "\txor " << cpu_name (with_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
+}
+
+void
+NegateOpcode::generate (std::ostream & outs, const Options & options) const
+{
+  outs << "\tneg " << cpu_name (reg_, options) << std::endl;
+}
+
+void
+InvertOpcode::generate (std::ostream & outs, const Options & options) const
+{
+  outs << "\tnot " << cpu_name (reg_, options) << std::endl;
+}
+
+// Shift counts must be in %cl.  Exchange the count into %ecx for the shift,
+// and back again afterwards, so that both registers keep their values.
+void
+ShiftLeftRegisterOpcode::generate (std::ostream & outs,
+                                   const Options & options) const
+{
+  const std::string ecx = cpu_name (Register::R2, options);
+
+  outs << "\txchg " << cpu_name (count_, options) << ',' << ecx << std::endl
+       << "\tshl %cl," << cpu_name (reg_, options) << std::endl
+       << "\txchg " << cpu_name (count_, options) << ',' << ecx << std::endl;
+}
+
+void
+ShiftRightRegisterOpcode::generate (std::ostream & outs,
+                                    const Options & options) const
+{
+  const std::string ecx = cpu_name (Register::R2, options);
+
+  outs << "\txchg " << cpu_name (count_, options) << ',' << ecx << std::endl
+       << "\tshr %cl," << cpu_name (reg_, options) << std::endl
+       << "\txchg " << cpu_name (count_, options) << ',' << ecx << std::endl;
+}
+
+namespace {
+
+// Return the base two logarithm of value if it is a power of two, or -1.
+int
+power_of_two (unsigned long long value)
+{
+  int log = 0;
+  while (value > 1 && !(value & 1))
+    value >>= 1, ++log;
+  return value == 1 ? log : -1;
+}
+
+// Compute the multiplier and shift for signed division of a bits wide
+// cell by divisor, not a power of two, using the method of Hacker's
+// Delight, section 10-4.
+void
+signed_magic (unsigned long long divisor, int bits,
+              long long * multiplier, int * shift)
+{
+  const unsigned long long mask = bits == 64 ? ~0ULL : (1ULL << bits) - 1;
+  const unsigned long long sign = 1ULL << (bits - 1);
+  const unsigned long long anc = sign - 1 - sign % divisor;
+
+  unsigned long long q1 = sign / anc, r1 = sign - q1 * anc;
+  unsigned long long q2 = sign / divisor, r2 = sign - q2 * divisor;
+  unsigned long long delta;
+  int p = bits - 1;
+  do
+    {
+      ++p;
+      q1 = (q1 << 1) & mask, r1 <<= 1;
+      if (r1 >= anc)
+        ++q1, r1 -= anc;
+      q2 = (q2 << 1) & mask, r2 <<= 1;
+      if (r2 >= divisor)
+        ++q2, r2 -= divisor;
+      delta = divisor - r2;
+    }
+  while (q1 < delta || (q1 == delta && r1 == 0));
+
+  const unsigned long long magic = (q2 + 1) & mask;
+  *multiplier = magic & sign && bits == 32
+                ? static_cast<long long> (magic) - (1LL << 32)
+                : static_cast<long long> (magic);
+  *shift = p - bits;
+}
+
+} // namespace
+
+// Multiply by a power of two with a shift, by 3, 5 or 9 times a power of
+// two with lea and a shift, and by anything else with imul.
+void
+MultiplyValueOpcode::generate (std::ostream & outs,
+                               const Options & options) const
+{
+  const std::string & reg = cpu_name (reg_, options);
+  const int value = value_.get_value ();
+
+  if (value == 0)
+    {
+      outs << "\txor " << reg << ',' << reg << std::endl;
+      return;
+    }
+  if (value == -1)
+    {
+      outs << "\tneg " << reg << std::endl;
+      return;
+    }
+
+  int shift = value > 0 ? power_of_two (value) : -1;
+  if (shift < 0 && value > 0)
+    {
+      int factor = value;
+      shift = 0;
+      while (!(factor & 1))
+        factor >>= 1, ++shift;
+
+      if (factor == 3 || factor == 5 || factor == 9)
+        {
+          outs << "\tlea (" << reg << ',' << reg << ',' << factor - 1
+               << ")," << reg << std::endl;
+        }
+      else
+        shift = -1;
+    }
+
+  if (shift < 0)
+    {
+      outs << "\timul $" << value << ',' << reg << ',' << reg << std::endl;
+      return;
+    }
+
+  if (shift == 1)
+    outs << "\tadd " << reg << ',' << reg << std::endl;
+  else if (shift > 1)
+    outs << "\tshl $" << shift << ',' << reg << std::endl;
+}
+
+// Divide by a power of two with shifts, biasing negative dividends so that
+// the quotient truncates toward zero.  Divide by anything else by taking
+// the high cell of a multiply by a fixed point reciprocal, then adding one
+// to the quotient of a negative dividend.  Remainders subtract the product
+// of the quotient and divisor from the dividend.
+void
+DivideValueOpcode::generate (std::ostream & outs,
+                             const Options & options) const
+{
+  const int bits = cell_size (options) * 8;
+  const std::string & eax = cpu_name (Register::R0, options);
+  const std::string & edx = cpu_name (Register::R1, options);
+  const std::string & esp = target_name ("%esp", options);
+
+  const long long value = value_.get_value ();
+  const unsigned long long divisor = value < 0 ? -value : value;
+  const int log = power_of_two (divisor);
+
+  if (log == 0)
+    {
+      if (is_remainder_)
+        outs << "\txor " << eax << ',' << eax << std::endl;
+      else if (value < 0)
+        outs << "\tneg " << eax << std::endl;
+      return;
+    }
+
+  if (log > 0)
+    {
+      outs << "\tmov " << eax << ',' << edx << std::endl
+           << "\tsar $" << bits - 1 << ',' << edx << std::endl
+           << "\tshr $" << bits - log << ',' << edx << std::endl
+           << "\tadd " << edx << ',' << eax << std::endl;
+      if (is_remainder_)
+        {
+          outs << "\tand $" << divisor - 1 << ',' << eax << std::endl
+               << "\tsub " << edx << ',' << eax << std::endl;
+        }
+      else
+        {
+          outs << "\tsar $" << log << ',' << eax << std::endl;
+          if (value < 0)
+            outs << "\tneg " << eax << std::endl;
+        }
+      return;
+    }
+
+  long long multiplier;
+  int shift;
+  signed_magic (divisor, bits, &multiplier, &shift);
+
+  outs << "\tpush " << eax << std::endl
+       << "\tmov $" << multiplier << ',' << edx << std::endl
+       << "\timul " << edx << std::endl;
+  if (multiplier < 0)
+    outs << "\tadd (" << esp << ")," << edx << std::endl;
+  if (shift)
+    outs << "\tsar $" << shift << ',' << edx << std::endl;
+  outs << "\tmov (" << esp << ")," << eax << std::endl
+       << "\tshr $" << bits - 1 << ',' << eax << std::endl
+       << "\tadd " << eax << ',' << edx << std::endl;
+
+  if (is_remainder_)
+    {
+      outs << "\timul $" << divisor << ',' << edx << ',' << edx << std::endl
+           << "\tpop " << eax << std::endl
+           << "\tsub " << edx << ',' << eax << std::endl;
+    }
+  else
+    {
+      outs << "\tmov " << edx << ',' << eax << std::endl
+           << "\tadd $" << cell_size (options) << ',' << esp << std::endl;
+      if (value < 0)
+        outs << "\tneg " << eax << std::endl;
+    }
+}
+
+namespace {
+
+// Return the setcc and jcc suffix for a condition.
+const char *
+condition_suffix (Condition condition)
+{
+  static const char * const suffixes[] = { "e", "ne", "l", "g", "le", "ge",
+                                           "b", "a", "be", "ae" };
+  return suffixes[condition];
+}
+
+// Set a register to a Forth flag from the condition codes, by setting its
+// low byte, zero extending, and negating.
+void
+generate_set_flag (std::ostream & outs, const Options & options,
+                   const Register & reg, Condition condition)
+{
+  assert (reg.equals (Register::R0) || reg.equals (Register::R1)
+          || reg.equals (Register::R2));
+
+  const std::string byte = "%" + reg.get_cpu_name ().substr (2, 1) + 'l';
+  outs << "\tset" << condition_suffix (condition) << ' ' << byte << std::endl
+       << "\tmovzbl " << byte << ',' << reg.get_cpu_name () << std::endl
+       << "\tneg " << cpu_name (reg, options) << std::endl;
+}
+
+} // namespace
+
+void
+CompareRegisterOpcode::generate (std::ostream & outs,
+                                 const Options & options) const
+{
+  outs << "\tcmp " << cpu_name (with_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
+  generate_set_flag (outs, options, reg_, condition_);
+}
+
+void
+CompareZeroOpcode::generate (std::ostream & outs,
+                             const Options & options) const
+{
+  outs << "\ttest " << cpu_name (reg_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
+  generate_set_flag (outs, options, reg_, condition_);
 }
 
 void
@@ -721,9 +1685,8 @@ JumpOpcode::generate (std::ostream & outs, const Options & options) const
 void
 JumpZeroOpcode::generate (std::ostream & outs, const Options & options) const
 {
-  args_unused (options);
-  outs << "\ttest " << reg_.get_cpu_name () << ','
-       << reg_.get_cpu_name () << std::endl;
+  outs << "\ttest " << cpu_name (reg_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
   outs << "\tje .L" << label_.get_value () << std::endl;
 }
 
@@ -731,9 +1694,8 @@ void
 JumpNonZeroOpcode::generate (std::ostream & outs,
                              const Options & options) const
 {
-  args_unused (options);
-  outs << "\ttest " << reg_.get_cpu_name () << ','
-       << reg_.get_cpu_name () << std::endl;
+  outs << "\ttest " << cpu_name (reg_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
   outs << "\tjne .L" << label_.get_value () << std::endl;
 }
 
@@ -741,9 +1703,8 @@ void
 JumpGreaterZeroOpcode::generate (std::ostream & outs,
                                  const Options & options) const
 {
-  args_unused (options);
-  outs << "\ttest " << reg_.get_cpu_name () << ','
-       << reg_.get_cpu_name () << std::endl;
+  outs << "\ttest " << cpu_name (reg_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
   outs << "\tjg .L" << label_.get_value () << std::endl;
 }
 
@@ -751,9 +1712,8 @@ void
 JumpLessZeroOpcode::generate (std::ostream & outs,
                               const Options & options) const
 {
-  args_unused (options);
-  outs << "\ttest " << reg_.get_cpu_name () << ','
-       << reg_.get_cpu_name () << std::endl;
+  outs << "\ttest " << cpu_name (reg_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
   outs << "\tjl .L" << label_.get_value () << std::endl;
 }
 
@@ -761,9 +1721,8 @@ void
 JumpGreaterEqualZeroOpcode::generate (std::ostream & outs,
                                       const Options & options) const
 {
-  args_unused (options);
-  outs << "\ttest " << reg_.get_cpu_name () << ','
-       << reg_.get_cpu_name () << std::endl;
+  outs << "\ttest " << cpu_name (reg_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
   outs << "\tjge .L" << label_.get_value () << std::endl;
 }
 
@@ -771,18 +1730,16 @@ void
 JumpLessEqualZeroOpcode::generate (std::ostream & outs,
                                    const Options & options) const
 {
-  args_unused (options);
-  outs << "\ttest " << reg_.get_cpu_name () << ','
-       << reg_.get_cpu_name () << std::endl;
+  outs << "\ttest " << cpu_name (reg_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
   outs << "\tjle .L" << label_.get_value () << std::endl;
 }
 
 void
 JumpEqualOpcode::generate (std::ostream & outs, const Options & options) const
 {
-  args_unused (options);
-  outs << "\tcmp " << reg1_.get_cpu_name () << ','
-       << reg2_.get_cpu_name () << std::endl;
+  outs << "\tcmp " << cpu_name (reg1_, options) << ','
+       << cpu_name (reg2_, options) << std::endl;
   outs << "\tje .L" << label_.get_value () << std::endl;
 }
 
@@ -790,12 +1747,74 @@ void
 JumpNotEqualOpcode::generate (std::ostream & outs,
                               const Options & options) const
 {
-  args_unused (options);
-  outs << "\tcmp " << reg1_.get_cpu_name () << ','
-       << reg2_.get_cpu_name () << std::endl;
+  outs << "\tcmp " << cpu_name (reg1_, options) << ','
+       << cpu_name (reg2_, options) << std::endl;
   outs << "\tjne .L" << label_.get_value () << std::endl;
 }
 
+void
+JumpCompareOpcode::generate (std::ostream & outs,
+                             const Options & options) const
+{
+  outs << "\tcmp " << cpu_name (with_, options) << ','
+       << cpu_name (reg_, options) << std::endl;
+  outs << "\tj" << condition_suffix (condition_)
+       << " .L" << label_.get_value () << std::endl;
+}
+
+// Range check the index, then jump through a read-only table.  x86_64
+// tables hold offsets from the table, so suit both PIC and non-PIC code.
+// PIC x86 tables hold offsets from the global offset table in %ebx.
+void
+JumpTableOpcode::generate (std::ostream & outs,
+                           const Options & options) const
+{
+  const std::string & reg = cpu_name (reg_, options);
+  const int table = label_.get_value ();
+
+  if (base_.get_value ())
+    outs << "\tsub $" << base_.get_value () << ',' << reg << std::endl;
+  outs << "\tcmp $" << targets_.size () - 1 << ',' << reg << std::endl
+       << "\tja .L" << table << std::endl;
+
+  if (options.target_x86_64 ())
+    {
+      const std::string & scratch = cpu_name (Register::R1, options);
+      outs << "\tlea .LT" << table << "(%rip)," << scratch << std::endl
+           << "\tmovslq (" << scratch << ',' << reg << ",4),"
+           << reg << std::endl
+           << "\tadd " << scratch << ',' << reg << std::endl
+           << "\tjmp *" << reg << std::endl;
+    }
+  else if (options.position_independent ())
+    {
+      outs << "\tmov .LT" << table << "@GOTOFF(%ebx," << reg << ",4),"
+           << reg << std::endl
+           << "\tadd %ebx," << reg << std::endl
+           << "\tjmp *" << reg << std::endl;
+    }
+  else
+    {
+      outs << "\tmov .LT" << table << "(," << reg << ",4)," << reg
+           << std::endl
+           << "\tjmp *" << reg << std::endl;
+    }
+
+  outs << ".section\t.rodata" << std::endl
+       << "\t.align 4" << std::endl
+       << ".LT" << table << ':' << std::endl;
+  for (size_t i = 0; i < targets_.size (); ++i)
+    {
+      outs << "\t.long .L" << targets_[i].get_value ();
+      if (options.target_x86_64 ())
+        outs << "-.LT" << table;
+      else if (options.position_independent ())
+        outs << "@GOTOFF";
+      outs << std::endl;
+    }
+  outs << ".text" << std::endl;
+}
+
 void
 NoOpOpcode::generate (std::ostream & outs, const Options & options) const
 {
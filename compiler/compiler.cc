@@ -25,10 +25,15 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <sstream>
+#include <streambuf>
 #include <string>
 #include <vector>
 #include <unistd.h>
+#include <sys/wait.h>
 
+#include "assembler.h"
+#include "cache.h"
 #include "cmdline.h"
 #include "mangler.h"
 #include "program.h"
@@ -52,9 +57,97 @@ demangle (const std::string & name)
 // Program exit status.
 int exit_status = EXIT_SUCCESS;
 
-// Compile the given source file using command line options.
+// Write assembly text to path, reporting any error.
+bool
+write_assembly (const std::string & path, const std::string & assembly,
+                const CommandLine * commandline)
+{
+  std::ofstream outs (path.c_str ());
+  if (outs)
+    {
+      outs << assembly;
+      outs.close ();
+    }
+  if (!outs)
+    {
+      std::cerr << commandline->get_program_name () << ": "
+                << path << ": " << std::strerror (errno) << std::endl;
+      return false;
+    }
+  return true;
+}
+
+// Stream buffer that copies output to another buffer, and keeps a copy.
+class TeeBuffer : public std::streambuf
+{
+public:
+  TeeBuffer (std::streambuf * buffer)
+    : buffer_ (buffer) { }
+
+  inline const std::string &
+  get_copy () const
+  {
+    return copy_;
+  }
+
+protected:
+  virtual int
+  overflow (int c)
+  {
+    if (c == traits_type::eof ())
+      return traits_type::not_eof (c);
+    copy_ += traits_type::to_char_type (c);
+    return buffer_->sputc (traits_type::to_char_type (c));
+  }
+
+  virtual std::streamsize
+  xsputn (const char * s, std::streamsize n)
+  {
+    copy_.append (s, n);
+    return buffer_->sputn (s, n);
+  }
+
+  virtual int
+  sync ()
+  {
+    return buffer_->pubsync ();
+  }
+
+private:
+  std::streambuf * buffer_;
+  std::string copy_;
+};
+
+// Capture everything written to std::cerr while in scope.
+class DiagnosticsCapture
+{
+public:
+  DiagnosticsCapture ()
+    : tee_ (std::cerr.rdbuf ()), original_ (std::cerr.rdbuf (&tee_)) { }
+
+  ~DiagnosticsCapture ()
+  {
+    std::cerr.rdbuf (original_);
+  }
+
+  inline const std::string &
+  get_diagnostics () const
+  {
+    return tee_.get_copy ();
+  }
+
+private:
+  DiagnosticsCapture (const DiagnosticsCapture & capture);
+  DiagnosticsCapture & operator= (const DiagnosticsCapture & capture);
+
+  TeeBuffer tee_;
+  std::streambuf * original_;
+};
+
+// Translate the given source file into output files named from base.
 void
-compile (const std::string source, const CommandLine * commandline)
+translate (const std::string & source, const std::string & base,
+           const CommandLine * commandline)
 {
   // Create a program from the source file and options.
   Program program;
@@ -64,17 +157,13 @@ compile (const std::string source, const CommandLine * commandline)
       return;
     }
 
-  // Find the base name of the source.
-  const std::string::size_type slash = source.find_last_of ('/');
-  const std::string::size_type dot = source.find_last_of ('.');
-
-  std::string base = source;
-  if (dot < source.size () && (dot > slash || slash > source.size ()))
-    base.erase (dot, base.size ());
-
-  // Write an intermediate listing if requested.
+  // Create the assembly translation.  This comes first so that the
+  // intermediate listing can include any peephole rewrites.
   const Options options = commandline->get_options ();
+  std::ostringstream assembly;
+  program.generate (assembly);
 
+  // Write an intermediate listing if requested.
   if (options.save_intermediate ())
     {
       const std::string & path = base + ".p";
@@ -90,21 +179,31 @@ compile (const std::string source, const CommandLine * commandline)
       outs.close ();
     }
 
-  // Create and write assembly translation.
+  // Write out the assembly translation if requested.
   const std::string & path = base + ".s";
-  std::ofstream outs (path.c_str ());
-  if (!outs)
+  if (options.save_assembly ()
+      && !write_assembly (path, assembly.str (), commandline))
+    {
+      exit_status = EXIT_FAILURE;
+      return;
+    }
+
+  // Assemble directly into an object file where possible, otherwise run
+  // 'as' on the assembly file.
+  if (!options.target_x86_64 () && !options.external_assembler ()
+      && Assembler::assemble (assembly.str (), base + ".o"))
+    return;
+
+  if (!options.save_assembly ()
+      && !write_assembly (path, assembly.str (), commandline))
     {
-      std::cerr << commandline->get_program_name () << ": "
-                << path << ": " << std::strerror (errno) << std::endl;
       exit_status = EXIT_FAILURE;
       return;
     }
-  program.generate (outs);
-  outs.close ();
 
-  // Assemble into an object file.
-  const std::string & as = std::string ("as --32 -o ") + base + ".o " + path;
+  const std::string & as = std::string (options.target_x86_64 ()
+                                        ? "as --64 -o " : "as --32 -o ")
+                            + base + ".o " + path;
   const int status = system (as.c_str ());
   if (status != EXIT_SUCCESS)
     {
@@ -119,6 +218,98 @@ compile (const std::string source, const CommandLine * commandline)
     unlink (path.c_str ());
 }
 
+// Compile the given source file using command line options.  With a cache,
+// reuse the output of an identical earlier compilation if there is one, and
+// otherwise store this one's output once it succeeds.
+void
+compile (const std::string source, const CommandLine * commandline)
+{
+  // Find the base name of the source.
+  const std::string::size_type slash = source.find_last_of ('/');
+  const std::string::size_type dot = source.find_last_of ('.');
+
+  std::string base = source;
+  if (dot < source.size () && (dot > slash || slash > source.size ()))
+    base.erase (dot, base.size ());
+
+  const std::string key = commandline->get_options ().use_cache ()
+                          ? Cache::key (source, *commandline) : "";
+  if (key.empty ())
+    {
+      translate (source, base, commandline);
+      return;
+    }
+
+  std::string diagnostics;
+  if (Cache::restore (key, base, *commandline, &diagnostics))
+    {
+      std::cerr << diagnostics;
+      return;
+    }
+
+  const int status = exit_status;
+  exit_status = EXIT_SUCCESS;
+  {
+    DiagnosticsCapture capture;
+    translate (source, base, commandline);
+    diagnostics = capture.get_diagnostics ();
+  }
+
+  if (exit_status == EXIT_SUCCESS)
+    Cache::store (key, base, *commandline, diagnostics);
+  if (status != EXIT_SUCCESS)
+    exit_status = status;
+}
+
+// Compile the given source files in up to jobs child processes at once.
+// The parser is reentrant, but the id counters that number symbols and
+// data, the opcode arena, and the std::cerr capture for the cache are
+// global, so a process per source keeps each compilation independent and
+// its output the same as a serial compile.  If fork fails, compile the
+// source here.
+void
+compile_parallel (const std::vector<std::string> & sources,
+                  const CommandLine * commandline, int jobs)
+{
+  int running = 0;
+  std::vector<std::string>::const_iterator source = sources.begin ();
+
+  while (source != sources.end () || running > 0)
+    {
+      if (source != sources.end () && running < jobs)
+        {
+          std::cout.flush ();
+          std::cerr.flush ();
+
+          const pid_t pid = fork ();
+          if (pid == 0)
+            {
+              compile (*source, commandline);
+              std::exit (exit_status);
+            }
+
+          if (pid < 0)
+            compile (*source, commandline);
+          else
+            running++;
+          ++source;
+          continue;
+        }
+
+      int status;
+      if (wait (&status) == -1)
+        {
+          std::cerr << commandline->get_program_name () << ": wait: "
+                    << std::strerror (errno) << std::endl;
+          exit_status = EXIT_FAILURE;
+          return;
+        }
+      running--;
+      if (!WIFEXITED (status) || WEXITSTATUS (status) != EXIT_SUCCESS)
+        exit_status = EXIT_FAILURE;
+    }
+}
+
 } // namespace
 
 // Main program.
@@ -142,10 +333,18 @@ int main (int argc, char * const * argv)
           return EXIT_SUCCESS;
         }
 
-      // Otherwise, compile each named source file.
+      // Otherwise, compile each named source file, in parallel if asked.
       const std::vector<std::string> sources = commandline.get_arguments ();
-      std::for_each (sources.begin (), sources.end (),
-                     std::bind2nd (std::ptr_fun (compile), &commandline));
+      const int jobs = commandline.get_options ().parallel_jobs ();
+      if (jobs > 1 && sources.size () > 1)
+        compile_parallel (sources, &commandline, jobs);
+      else
+        std::for_each (sources.begin (), sources.end (),
+                       std::bind2nd (std::ptr_fun (compile), &commandline));
+
+      if (commandline.get_options ().cache_statistics ()
+          && commandline.get_options ().use_cache ())
+        Cache::print_statistics (commandline, std::cerr);
       return exit_status;
     }
 
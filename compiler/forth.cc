@@ -1,2560 +0,0 @@
-#line 2 "forth.cc"
-
-#line 4 "forth.cc"
-
-#define  YY_INT_ALIGNED short int
-
-/* A lexical scanner generated by flex */
-
-#define FLEX_SCANNER
-#define YY_FLEX_MAJOR_VERSION 2
-#define YY_FLEX_MINOR_VERSION 5
-#define YY_FLEX_SUBMINOR_VERSION 35
-#if YY_FLEX_SUBMINOR_VERSION > 0
-#define FLEX_BETA
-#endif
-
-/* First, we deal with  platform-specific or compiler-specific issues. */
-
-/* begin standard C headers. */
-#include <stdio.h>
-#include <string.h>
-#include <errno.h>
-#include <stdlib.h>
-
-/* end standard C headers. */
-
-/* flex integer type definitions */
-
-#ifndef FLEXINT_H
-#define FLEXINT_H
-
-/* C99 systems have <inttypes.h>. Non-C99 systems may or may not. */
-
-#if defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
-
-/* C99 says to define __STDC_LIMIT_MACROS before including stdint.h,
- * if you want the limit (max/min) macros for int types. 
- */
-#ifndef __STDC_LIMIT_MACROS
-#define __STDC_LIMIT_MACROS 1
-#endif
-
-#include <inttypes.h>
-typedef int8_t flex_int8_t;
-typedef uint8_t flex_uint8_t;
-typedef int16_t flex_int16_t;
-typedef uint16_t flex_uint16_t;
-typedef int32_t flex_int32_t;
-typedef uint32_t flex_uint32_t;
-#else
-typedef signed char flex_int8_t;
-typedef short int flex_int16_t;
-typedef int flex_int32_t;
-typedef unsigned char flex_uint8_t; 
-typedef unsigned short int flex_uint16_t;
-typedef unsigned int flex_uint32_t;
-
-/* Limits of integral types. */
-#ifndef INT8_MIN
-#define INT8_MIN               (-128)
-#endif
-#ifndef INT16_MIN
-#define INT16_MIN              (-32767-1)
-#endif
-#ifndef INT32_MIN
-#define INT32_MIN              (-2147483647-1)
-#endif
-#ifndef INT8_MAX
-#define INT8_MAX               (127)
-#endif
-#ifndef INT16_MAX
-#define INT16_MAX              (32767)
-#endif
-#ifndef INT32_MAX
-#define INT32_MAX              (2147483647)
-#endif
-#ifndef UINT8_MAX
-#define UINT8_MAX              (255U)
-#endif
-#ifndef UINT16_MAX
-#define UINT16_MAX             (65535U)
-#endif
-#ifndef UINT32_MAX
-#define UINT32_MAX             (4294967295U)
-#endif
-
-#endif /* ! C99 */
-
-#endif /* ! FLEXINT_H */
-
-#ifdef __cplusplus
-
-/* The "const" storage-class-modifier is valid. */
-#define YY_USE_CONST
-
-#else	/* ! __cplusplus */
-
-/* C99 requires __STDC__ to be defined as 1. */
-#if defined (__STDC__)
-
-#define YY_USE_CONST
-
-#endif	/* defined (__STDC__) */
-#endif	/* ! __cplusplus */
-
-#ifdef YY_USE_CONST
-#define yyconst const
-#else
-#define yyconst
-#endif
-
-/* Returned upon end-of-file. */
-#define YY_NULL 0
-
-/* Promotes a possibly negative, possibly signed char to an unsigned
- * integer for use as an array index.  If the signed char is negative,
- * we want to instead treat it as an 8-bit unsigned char, hence the
- * double cast.
- */
-#define YY_SC_TO_UI(c) ((unsigned int) (unsigned char) c)
-
-/* Enter a start condition.  This macro really ought to take a parameter,
- * but we do it the disgusting crufty way forced on us by the ()-less
- * definition of BEGIN.
- */
-#define BEGIN (yy_start) = 1 + 2 *
-
-/* Translate the current start state into a value that can be later handed
- * to BEGIN to return to the state.  The YYSTATE alias is for lex
- * compatibility.
- */
-#define YY_START (((yy_start) - 1) / 2)
-#define YYSTATE YY_START
-
-/* Action number for EOF rule of a given start state. */
-#define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
-
-/* Special action meaning "start processing a new file". */
-#define YY_NEW_FILE yyrestart(yyin  )
-
-#define YY_END_OF_BUFFER_CHAR 0
-
-/* Size of default input buffer. */
-#ifndef YY_BUF_SIZE
-#ifdef __ia64__
-/* On IA-64, the buffer size is 16k, not 8k.
- * Moreover, YY_BUF_SIZE is 2*YY_READ_BUF_SIZE in the general case.
- * Ditto for the __ia64__ case accordingly.
- */
-#define YY_BUF_SIZE 32768
-#else
-#define YY_BUF_SIZE 16384
-#endif /* __ia64__ */
-#endif
-
-/* The state buf must be large enough to hold one state per character in the main buffer.
- */
-#define YY_STATE_BUF_SIZE   ((YY_BUF_SIZE + 2) * sizeof(yy_state_type))
-
-#ifndef YY_TYPEDEF_YY_BUFFER_STATE
-#define YY_TYPEDEF_YY_BUFFER_STATE
-typedef struct yy_buffer_state *YY_BUFFER_STATE;
-#endif
-
-extern int yyleng;
-
-extern FILE *yyin, *yyout;
-
-#define EOB_ACT_CONTINUE_SCAN 0
-#define EOB_ACT_END_OF_FILE 1
-#define EOB_ACT_LAST_MATCH 2
-
-    #define YY_LESS_LINENO(n)
-    
-/* Return all but the first "n" matched characters back to the input stream. */
-#define yyless(n) \
-	do \
-		{ \
-		/* Undo effects of setting up yytext. */ \
-        int yyless_macro_arg = (n); \
-        YY_LESS_LINENO(yyless_macro_arg);\
-		*yy_cp = (yy_hold_char); \
-		YY_RESTORE_YY_MORE_OFFSET \
-		(yy_c_buf_p) = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
-		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
-		} \
-	while ( 0 )
-
-#define unput(c) yyunput( c, (yytext_ptr)  )
-
-#ifndef YY_TYPEDEF_YY_SIZE_T
-#define YY_TYPEDEF_YY_SIZE_T
-typedef size_t yy_size_t;
-#endif
-
-#ifndef YY_STRUCT_YY_BUFFER_STATE
-#define YY_STRUCT_YY_BUFFER_STATE
-struct yy_buffer_state
-	{
-	FILE *yy_input_file;
-
-	char *yy_ch_buf;		/* input buffer */
-	char *yy_buf_pos;		/* current position in input buffer */
-
-	/* Size of input buffer in bytes, not including room for EOB
-	 * characters.
-	 */
-	yy_size_t yy_buf_size;
-
-	/* Number of characters read into yy_ch_buf, not including EOB
-	 * characters.
-	 */
-	int yy_n_chars;
-
-	/* Whether we "own" the buffer - i.e., we know we created it,
-	 * and can realloc() it to grow it, and should free() it to
-	 * delete it.
-	 */
-	int yy_is_our_buffer;
-
-	/* Whether this is an "interactive" input source; if so, and
-	 * if we're using stdio for input, then we want to use getc()
-	 * instead of fread(), to make sure we stop fetching input after
-	 * each newline.
-	 */
-	int yy_is_interactive;
-
-	/* Whether we're considered to be at the beginning of a line.
-	 * If so, '^' rules will be active on the next match, otherwise
-	 * not.
-	 */
-	int yy_at_bol;
-
-    int yy_bs_lineno; /**< The line count. */
-    int yy_bs_column; /**< The column count. */
-    
-	/* Whether to try to fill the input buffer when we reach the
-	 * end of it.
-	 */
-	int yy_fill_buffer;
-
-	int yy_buffer_status;
-
-#define YY_BUFFER_NEW 0
-#define YY_BUFFER_NORMAL 1
-	/* When an EOF's been seen but there's still some text to process
-	 * then we mark the buffer as YY_EOF_PENDING, to indicate that we
-	 * shouldn't try reading from the input source any more.  We might
-	 * still have a bunch of tokens to match, though, because of
-	 * possible backing-up.
-	 *
-	 * When we actually see the EOF, we change the status to "new"
-	 * (via yyrestart()), so that the user can continue scanning by
-	 * just pointing yyin at a new input file.
-	 */
-#define YY_BUFFER_EOF_PENDING 2
-
-	};
-#endif /* !YY_STRUCT_YY_BUFFER_STATE */
-
-/* Stack of input buffers. */
-static size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
-static size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
-static YY_BUFFER_STATE * yy_buffer_stack = 0; /**< Stack as an array. */
-
-/* We provide macros for accessing buffer states in case in the
- * future we want to put the buffer states in a more general
- * "scanner state".
- *
- * Returns the top of the stack, or NULL.
- */
-#define YY_CURRENT_BUFFER ( (yy_buffer_stack) \
-                          ? (yy_buffer_stack)[(yy_buffer_stack_top)] \
-                          : NULL)
-
-/* Same as previous macro, but useful when we know that the buffer stack is not
- * NULL or when we need an lvalue. For internal use only.
- */
-#define YY_CURRENT_BUFFER_LVALUE (yy_buffer_stack)[(yy_buffer_stack_top)]
-
-/* yy_hold_char holds the character lost when yytext is formed. */
-static char yy_hold_char;
-static int yy_n_chars;		/* number of characters read into yy_ch_buf */
-int yyleng;
-
-/* Points to current character in buffer. */
-static char *yy_c_buf_p = (char *) 0;
-static int yy_init = 0;		/* whether we need to initialize */
-static int yy_start = 0;	/* start state number */
-
-/* Flag which is used to allow yywrap()'s to do buffer switches
- * instead of setting up a fresh yyin.  A bit of a hack ...
- */
-static int yy_did_buffer_switch_on_eof;
-
-void yyrestart (FILE *input_file  );
-void yy_switch_to_buffer (YY_BUFFER_STATE new_buffer  );
-YY_BUFFER_STATE yy_create_buffer (FILE *file,int size  );
-void yy_delete_buffer (YY_BUFFER_STATE b  );
-void yy_flush_buffer (YY_BUFFER_STATE b  );
-void yypush_buffer_state (YY_BUFFER_STATE new_buffer  );
-void yypop_buffer_state (void );
-
-static void yyensure_buffer_stack (void );
-static void yy_load_buffer_state (void );
-static void yy_init_buffer (YY_BUFFER_STATE b,FILE *file  );
-
-#define YY_FLUSH_BUFFER yy_flush_buffer(YY_CURRENT_BUFFER )
-
-YY_BUFFER_STATE yy_scan_buffer (char *base,yy_size_t size  );
-YY_BUFFER_STATE yy_scan_string (yyconst char *yy_str  );
-YY_BUFFER_STATE yy_scan_bytes (yyconst char *bytes,int len  );
-
-void *yyalloc (yy_size_t  );
-void *yyrealloc (void *,yy_size_t  );
-void yyfree (void *  );
-
-#define yy_new_buffer yy_create_buffer
-
-#define yy_set_interactive(is_interactive) \
-	{ \
-	if ( ! YY_CURRENT_BUFFER ){ \
-        yyensure_buffer_stack (); \
-		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer(yyin,YY_BUF_SIZE ); \
-	} \
-	YY_CURRENT_BUFFER_LVALUE->yy_is_interactive = is_interactive; \
-	}
-
-#define yy_set_bol(at_bol) \
-	{ \
-	if ( ! YY_CURRENT_BUFFER ){\
-        yyensure_buffer_stack (); \
-		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer(yyin,YY_BUF_SIZE ); \
-	} \
-	YY_CURRENT_BUFFER_LVALUE->yy_at_bol = at_bol; \
-	}
-
-#define YY_AT_BOL() (YY_CURRENT_BUFFER_LVALUE->yy_at_bol)
-
-/* Begin user sect3 */
-
-typedef unsigned char YY_CHAR;
-
-FILE *yyin = (FILE *) 0, *yyout = (FILE *) 0;
-
-typedef int yy_state_type;
-
-extern int yylineno;
-
-int yylineno = 1;
-
-extern char *yytext;
-#define yytext_ptr yytext
-
-static yy_state_type yy_get_previous_state (void );
-static yy_state_type yy_try_NUL_trans (yy_state_type current_state  );
-static int yy_get_next_buffer (void );
-static void yy_fatal_error (yyconst char msg[]  );
-
-/* Done after the current pattern has been matched and before the
- * corresponding action - sets up yytext.
- */
-#define YY_DO_BEFORE_ACTION \
-	(yytext_ptr) = yy_bp; \
-	yyleng = (size_t) (yy_cp - yy_bp); \
-	(yy_hold_char) = *yy_cp; \
-	*yy_cp = '\0'; \
-	(yy_c_buf_p) = yy_cp;
-
-#define YY_NUM_RULES 81
-#define YY_END_OF_BUFFER 82
-/* This struct is not used in this scanner,
-   but its presence is necessary. */
-struct yy_trans_info
-	{
-	flex_int32_t yy_verify;
-	flex_int32_t yy_nxt;
-	};
-static yyconst flex_int16_t yy_acclist[429] =
-    {   0,
-       82,   80,   81,   71,   80,   81,    1,   78,   81,   79,
-       80,   81,   79,   80,   81,   79,   80,   81,   79,   80,
-       81,   79,   80,   81,   79,   80,   81,   79,   80,   81,
-       79,   80,   81,   79,   80,   81,   79,   80,   81,    2,
-       79,   80,   81,    2,   79,   80,   81,   23,   79,   80,
-       81,   24,   79,   80,   81,   79,   80,   81,   79,   80,
-       81,   79,   80,   81,   79,   80,   81,   79,   80,   81,
-       79,   80,   81,   79,   80,   81,   79,   80,   81,   79,
-       80,   81,   79,   80,   81,   79,   80,   81,   79,   80,
-       81,   79,   80,   81,   79,   80,   81,   79,   80,   81,
-
-       79,   80,   81,   79,   80,   81,   79,   80,   81,   70,
-       81,   58,   70,   81,    1,   81,   58,   69,   70,   81,
-       59,   70,   81,   65,   70,   81,   60,   65,   70,   81,
-        1,   64,   81,   60,   65,   69,   70,   81,   65,   70,
-       81,   65,   70,   81,   68,   70,   81,    1,   66,   81,
-       69,   70,   81,   68,   70,   81,   77,   81,    1,   76,
-       81,   75,   77,   81,   71,   79,    7,   79,    8,   79,
-        9,   79,    6,   79,   21,   79,   74,   79,   79,   79,
-       79,    2,   79,    2,   79,   79,   79,   79,   11,   79,
-       79,   10,   79,   79,   79,   79,   79,   79,   79,   79,
-
-       79,   79,   79,   79,   79,   79,   79,   36,   79,   79,
-       79,   79,   79,   79,   32,   79,   79,   79,   48,   79,
-       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
-       79,   72,   58,   59,   60,   62,   68,   68,   12,   21,
-       79,   79,   11,   79,    5,   79,   10,   79,   10,   79,
-        4,   79,    3,   79,   79,   37,   79,   79,   79,   79,
-       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
-       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
-       79,   79,   79,   79,   79,   79,   73,   63,   61,   68,
-       79,   16,   18,   79,   79,   79,   79,   79,   79,   15,
-
-       47,   79,   79,   57,   79,   79,   79,   33,   79,   79,
-       79,   79,   25,   79,   79,   79,   79,   38,   79,   79,
-       79,   14,   34,   79,   79,   79,   79,   79,   79,   79,
-       79,   79,   79,   68,   39,   79,   79,   79,   79,   44,
-       79,   29,   79,   42,   79,   79,   79,   79,   35,   79,
-       49,   79,   79,   79,   40,   79,   79,   79,   43,   79,
-       79,   45,   79,   13,   79,   79,   79,   79,   79,   79,
-       68,   79,   41,   79,   79,   19,   79,   28,   79,   79,
-       79,   79,   79,   46,   79,   79,   79,   54,   79,   79,
-       79,   79,   55,   79,   68,   22,   79,   79,   50,   79,
-
-       79,   79,   51,   79,   79,   56,   79,   52,   79,   79,
-       68,   17,   31,   79,   79,   79,   27,   79,   20,   79,
-       67,   68,   30,   79,   26,   79,   53,   79
-    } ;
-
-static yyconst flex_int16_t yy_accept[300] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    2,    4,    7,   10,   13,   16,   19,   22,   25,
-       28,   31,   34,   37,   40,   44,   48,   52,   56,   59,
-       62,   65,   68,   71,   74,   77,   80,   83,   86,   89,
-       92,   95,   98,  101,  104,  107,  110,  112,  115,  117,
-      121,  124,  127,  131,  134,  139,  142,  145,  148,  151,
-      154,  157,  159,  162,  165,  166,  167,  169,  171,  173,
-      175,  175,  177,  178,  179,  180,  181,  182,  184,  186,
-      187,  188,  189,  191,  192,  194,  195,  196,  197,  198,
-      199,  200,  201,  202,  203,  204,  205,  206,  207,  208,
-
-      210,  211,  212,  213,  214,  215,  217,  218,  219,  221,
-      222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
-      232,  232,  233,  234,  235,  236,  236,  236,  237,  238,
-      239,  240,  242,  243,  243,  243,  245,  247,  249,  251,
-      253,  255,  256,  258,  259,  260,  261,  262,  263,  263,
-      264,  265,  266,  267,  268,  269,  270,  271,  272,  273,
-      274,  275,  276,  277,  277,  278,  279,  280,  281,  282,
-      283,  284,  285,  286,  287,  287,  288,  288,  289,  289,
-      290,  291,  292,  292,  293,  293,  294,  295,  296,  297,
-      298,  299,  300,  300,  301,  303,  304,  306,  307,  308,
-
-      310,  311,  312,  313,  315,  316,  317,  318,  320,  321,
-      322,  322,  323,  325,  326,  327,  328,  328,  329,  330,
-      331,  332,  333,  334,  335,  337,  338,  339,  340,  342,
-      344,  346,  346,  347,  348,  349,  351,  353,  354,  355,
-      357,  358,  359,  361,  362,  364,  365,  366,  367,  368,
-      369,  370,  371,  372,  373,  375,  376,  377,  378,  380,
-      381,  382,  383,  384,  386,  387,  388,  390,  391,  392,
-      393,  395,  396,  398,  398,  399,  401,  402,  403,  405,
-      406,  406,  408,  410,  411,  412,  412,  413,  415,  416,
-      417,  419,  420,  421,  423,  425,  427,  429,  429
-
-    } ;
-
-static yyconst flex_int32_t yy_ec[256] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
-        1,    1,    4,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    5,    6,    7,    8,    9,   10,   11,   12,   13,
-       14,    6,   15,    6,   16,   17,    6,   18,   19,   20,
-       20,   20,   20,   20,   20,   21,   21,   22,   23,    6,
-        6,    6,   24,    6,   25,   26,   27,   28,   29,   30,
-       31,   32,   33,    6,    6,   34,   35,   36,   37,   38,
-        6,   39,   40,   41,   42,   43,   44,   45,    6,    6,
-       46,   47,   48,    6,    6,    6,   49,   50,   51,   52,
-
-       53,   54,   55,   56,   57,    6,    6,   58,   59,   60,
-       61,   62,    6,   63,   64,   65,   66,   67,   68,   69,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6
-    } ;
-
-static yyconst flex_int32_t yy_meta[70] =
-    {   0,
-        1,    2,    3,    4,    2,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5
-    } ;
-
-static yyconst flex_int16_t yy_base[319] =
-    {   0,
-        0,    0,   69,   74,   78,   82,   85,   89,   87,   91,
-      692,  751,   94,  751,    0,   88,  125,   84,   92,  115,
-      119,  148,  152,  109,  190,  154,   68,    0,  160,  167,
-       86,  189,  103,  196,  138,  170,  200,  190,  202,  680,
-      201,  198,  211,  207,  235,  128,  751,  132,  751,  181,
-        0,  751,  244,  751,  265,  269,  275,    0,  751,  751,
-      206,  751,  751,  751,  279,    0,  275,    0,  108,  283,
-      285,  650,  751,  287,    0,  129,  291,    0,  287,  238,
-      655,  312,  300,  184,  307,  315,  339,  254,  293,  302,
-      301,  314,  312,  316,  654,  309,  325,  344,  322,    0,
-
-      312,  333,  344,  341,  354,    0,  356,  345,    0,  356,
-      653,  355,  345,  348,  362,  609,  365,  364,  369,  377,
-      653,  751,  338,    0,  410,  639,  649,  751,    0,  385,
-      423,    0,  379,  644,  634,  423,  279,  411,  427,  416,
-        0,  390,    0,  413,  400,  416,  414,  420,  637,  425,
-      416,  427,  417,  433,  430,  433,  420,  428,  426,  424,
-      430,  427,  442,  413,  436,  441,  453,  453,  495,  476,
-      462,  475,  476,  476,  414,  751,  331,  751,  341,  751,
-      325,  468,  329,  751,  271,  751,  482,  465,  468,  476,
-      472,  478,  275,  751,    0,  515,    0,  474,  475,    0,
-
-      496,  492,  493,    0,  484,  501,  506,    0,  502,  518,
-      265,  751,    0,  510,  524,  521,  549,  513,  526,  523,
-      528,  524,  525,  535,    0,  528,  535,  206,    0,    0,
-        0,  567,  541,  541,  535,    0,    0,  536,  553,    0,
-      542,  542,    0,  563,    0,  591,  149,  147,  561,  562,
-      569,  144,  561,  571,    0,  185,  606,  567,    0,  575,
-      580,  583,  583,    0,  580,  615,    0,  139,  136,  589,
-        0,  595,    0,  142,  584,    0,  590,  596,    0,  602,
-      630,    0,    0,  607,  610,  134,  751,    0,  599,  612,
-        0,  641,   87,    0,    0,    0,    0,  751,  665,  670,
-
-      675,  680,   95,  684,   92,  689,  693,  698,  703,  708,
-      713,  718,  723,  728,  732,  736,  741,  745
-    } ;
-
-static yyconst flex_int16_t yy_def[319] =
-    {   0,
-      298,    1,  299,  299,  300,  300,  301,  301,  302,  302,
-      298,  298,  298,  298,  303,  303,  303,  303,  303,  304,
-      303,  303,  303,  303,  303,   25,  303,  303,  303,  303,
-      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
-      303,  303,  303,  303,  303,  303,  298,  298,  298,  298,
-      305,  298,  298,  298,  298,  298,  298,  306,  298,  298,
-      306,  298,  298,  298,  298,  303,  303,   17,  303,  303,
-      307,  303,  298,  303,   17,  303,  303,   25,   25,  303,
-      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
-      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
-
-      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
-      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
-      308,  298,  298,  305,  298,  309,  310,  298,  306,  306,
-      307,  303,  303,  311,  312,  303,  303,  303,  303,  303,
-       87,  303,  303,  303,  303,  303,  303,  303,  313,  303,
-      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
-      303,  303,  303,  314,  303,  303,  303,  303,  303,  303,
-      303,  303,  303,  303,  308,  298,  309,  298,  310,  298,
-      306,  303,  311,  298,  312,  298,  303,  303,  303,  303,
-      303,  303,  313,  298,  303,  303,  303,  303,  303,  303,
-
-      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
-      314,  298,  303,  303,  303,  303,  315,  303,  303,  303,
-      303,  303,  303,  306,  303,  303,  303,  303,  303,  303,
-      303,  316,  303,  303,  303,  303,  303,  303,  303,  303,
-      303,  303,  303,  303,  303,  315,  303,  303,  303,  303,
-      303,  303,  306,  303,  303,  303,  316,  303,  303,  303,
-      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
-      303,  306,  303,  317,  303,  303,  303,  303,  303,  303,
-      318,  303,  303,  303,  306,  317,  298,  303,  303,  303,
-      303,  318,  303,  306,  303,  303,  303,    0,  298,  298,
-
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-      298,  298,  298,  298,  298,  298,  298,  298
-    } ;
-
-static yyconst flex_int16_t yy_nxt[821] =
-    {   0,
-       12,   13,   14,   13,   13,   15,   15,   16,   17,   18,
-       19,   20,   21,   15,   22,   23,   24,   25,   26,   26,
-       26,   27,   28,   29,   30,   31,   32,   33,   34,   35,
-       15,   15,   36,   37,   15,   15,   38,   15,   39,   40,
-       41,   42,   43,   44,   15,   45,   46,   15,   30,   31,
-       32,   33,   34,   35,   15,   15,   36,   37,   15,   15,
-       38,   15,   39,   40,   41,   42,   43,   44,   15,   47,
-       48,   49,   50,   48,   47,   48,   49,   50,   48,   53,
-       54,   55,   53,   53,   54,   55,   53,   59,   60,   63,
-       56,   59,   60,   63,   56,   65,  124,   65,   65,   66,
-
-       64,   69,   69,   88,   64,   67,   67,   67,   67,   70,
-       70,   70,   70,   61,   94,   81,   71,   61,   71,   71,
-       73,   82,   73,   73,   57,   69,   69,   88,   57,  121,
-      122,  121,  121,  123,  297,  123,  123,   61,   94,  100,
-      287,   61,   68,   68,   68,   68,   69,   69,  287,   68,
-       68,   68,   68,   68,   68,   74,   75,   76,   77,   74,
-       75,   76,   77,  100,  104,   78,   79,   79,   79,   78,
-       79,   79,   79,   68,   68,   68,   68,   68,   68,   66,
-      105,   80,  123,  283,  123,  123,  282,   89,  104,  274,
-       66,  271,   91,   90,  267,   95,  266,   92,   66,  106,
-
-       93,  137,  137,   66,  105,   80,   83,   79,   79,   79,
-       79,   89,  256,   96,   66,   84,   91,   90,   85,  109,
-       97,   92,   66,  106,   93,   98,   86,   99,  107,  101,
-      110,  102,  112,  113,   87,  114,  108,   96,  115,   84,
-      103,  130,   85,  109,   97,  125,  116,  125,  125,   98,
-       86,   99,  107,  101,  110,  102,  112,  113,   87,  114,
-      108,  117,  115,  118,  103,  130,  125,  119,  125,  125,
-      126,  212,  126,  126,  133,  120,  127,  128,  127,  127,
-       65,  194,   65,   65,  186,  117,   71,  118,   71,   71,
-      142,  119,   67,   67,   67,   67,  137,  137,  133,  120,
-
-       70,   70,   70,   70,   67,   67,   67,   67,   70,   70,
-       70,   70,   66,  135,  142,  135,  135,  136,  136,  136,
-      136,  138,  138,   66,  139,  139,  139,  139,   85,  143,
-      144,   66,  140,  140,  140,  184,   66,  145,  146,  123,
-      224,  123,  123,  180,  178,  147,  148,   66,  150,  151,
-      154,  155,   85,  143,  144,   66,  141,  141,  141,  141,
-      156,  145,  146,  141,  141,  141,  141,  141,  141,  147,
-      148,  152,  150,  151,  154,  155,  157,  158,  159,  153,
-      160,  161,  162,  165,  156,  166,  167,  141,  141,  141,
-      141,  141,  141,  163,  168,  152,  170,  171,  173,  172,
-
-      157,  158,  159,  153,  160,  161,  162,  165,  174,  166,
-      167,  125,  181,  125,  125,  182,  176,  163,  168,  212,
-      170,  171,  173,  172,  298,  187,  298,  298,  139,  139,
-      139,  139,  174,  140,  140,  140,  181,  188,  189,  182,
-      136,  136,  136,  136,  139,  139,  139,  139,  190,  187,
-      191,   85,  192,  195,  196,  197,  198,  199,  200,  201,
-      204,  188,  189,  205,  206,  202,  207,  208,  209,  203,
-      210,  213,  190,  214,  191,   85,  192,  195,  196,  197,
-      198,  199,  200,  201,  204,  215,  216,  205,  206,  202,
-      207,  208,  209,  203,  210,  213,  217,  214,  217,  217,
-
-      218,  219,  220,  221,  223,  225,  226,  227,  228,  215,
-      216,  229,  230,  231,  233,  234,  232,  222,  232,  232,
-      235,  236,  237,  238,  218,  219,  220,  221,  223,  225,
-      226,  227,  228,  239,  240,  229,  230,  231,  233,  234,
-      241,  222,  242,  243,  235,  236,  237,  238,  244,  245,
-      217,  247,  217,  217,  248,  249,  250,  239,  240,  251,
-      252,  253,  254,  255,  241,  258,  242,  243,  232,  259,
-      232,  232,  244,  245,  260,  247,  261,  262,  248,  249,
-      250,  263,  264,  251,  252,  253,  254,  255,  265,  258,
-      268,  269,  298,  259,  298,  298,  270,  272,  260,  273,
-
-      261,  262,  275,  276,  277,  263,  264,  298,  278,  298,
-      298,  279,  265,  280,  268,  269,  281,  284,  281,  281,
-      270,  272,  285,  273,  288,  289,  275,  276,  277,  290,
-      291,  281,  278,  281,  281,  279,  293,  280,  294,  295,
-      296,  284,  298,  194,  298,  298,  285,  186,  288,  289,
-      184,  180,  178,  290,  291,  176,  169,  164,  149,  134,
-      293,  132,  294,  295,  296,   51,   51,   51,   51,   51,
-       52,   52,   52,   52,   52,   58,   58,   58,   58,   58,
-       62,   62,   62,   62,   62,   72,  111,   72,   72,  129,
-      129,  298,  298,  129,  131,  298,  131,  131,  175,  175,
-
-      175,  175,  175,  177,  177,  177,  177,  177,  179,  179,
-      179,  179,  179,  183,  183,  298,  183,  183,  185,  185,
-      298,  185,  185,  193,  193,  298,  193,  193,  211,  211,
-      298,  211,  211,  246,  298,  246,  246,  257,  298,  257,
-      257,  286,  286,  298,  286,  286,  292,  298,  292,  292,
-       11,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298
-    } ;
-
-static yyconst flex_int16_t yy_chk[821] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
-        3,    3,    3,    3,    4,    4,    4,    4,    4,    5,
-        5,    5,    5,    6,    6,    6,    6,    7,    7,    9,
-        5,    8,    8,   10,    6,   13,  305,   13,   13,  303,
-
-        9,   18,   18,   27,   10,   16,   16,   16,   16,   19,
-       19,   19,   19,    7,   31,   24,   20,    8,   20,   20,
-       21,   24,   21,   21,    5,   69,   69,   27,    6,   46,
-       46,   46,   46,   48,  293,   48,   48,    7,   31,   33,
-      286,    8,   17,   17,   17,   17,   76,   76,  274,   17,
-       17,   17,   17,   17,   17,   22,   22,   22,   22,   23,
-       23,   23,   23,   33,   35,   22,   22,   22,   22,   23,
-       23,   23,   23,   17,   17,   17,   17,   17,   17,   26,
-       35,   22,   50,  269,   50,   50,  268,   29,   35,  256,
-       26,  252,   30,   29,  248,   32,  247,   30,   26,   36,
-
-       30,   84,   84,   26,   35,   22,   25,   25,   25,   25,
-       25,   29,  228,   32,   26,   25,   30,   29,   25,   38,
-       32,   30,   26,   36,   30,   32,   25,   32,   37,   34,
-       39,   34,   41,   42,   25,   43,   37,   32,   44,   25,
-       34,   61,   25,   38,   32,   53,   45,   53,   53,   32,
-       25,   32,   37,   34,   39,   34,   41,   42,   25,   43,
-       37,   45,   44,   45,   34,   61,   55,   45,   55,   55,
-       56,  211,   56,   56,   80,   45,   57,   57,   57,   57,
-       65,  193,   65,   65,  185,   45,   71,   45,   71,   71,
-       88,   45,   67,   67,   67,   67,  137,  137,   80,   45,
-
-       70,   70,   70,   70,   74,   74,   74,   74,   77,   77,
-       77,   77,   79,   82,   88,   82,   82,   83,   83,   83,
-       83,   85,   85,   79,   85,   85,   85,   85,   83,   89,
-       90,   79,   86,   86,   86,  183,   79,   91,   92,  123,
-      181,  123,  123,  179,  177,   93,   94,   79,   96,   97,
-       99,  101,   83,   89,   90,   79,   87,   87,   87,   87,
-      102,   91,   92,   87,   87,   87,   87,   87,   87,   93,
-       94,   98,   96,   97,   99,  101,  103,  104,  105,   98,
-      107,  108,  110,  112,  102,  113,  114,   87,   87,   87,
-       87,   87,   87,  110,  115,   98,  117,  118,  119,  118,
-
-      103,  104,  105,   98,  107,  108,  110,  112,  120,  113,
-      114,  125,  130,  125,  125,  133,  175,  110,  115,  164,
-      117,  118,  119,  118,  131,  142,  131,  131,  138,  138,
-      138,  138,  120,  140,  140,  140,  130,  144,  145,  133,
-      136,  136,  136,  136,  139,  139,  139,  139,  146,  142,
-      147,  136,  148,  150,  151,  152,  153,  154,  155,  156,
-      157,  144,  145,  158,  159,  156,  160,  161,  162,  156,
-      163,  165,  146,  166,  147,  136,  148,  150,  151,  152,
-      153,  154,  155,  156,  157,  167,  168,  158,  159,  156,
-      160,  161,  162,  156,  163,  165,  169,  166,  169,  169,
-
-      170,  171,  172,  173,  174,  182,  187,  188,  189,  167,
-      168,  190,  191,  192,  198,  199,  196,  173,  196,  196,
-      201,  202,  203,  205,  170,  171,  172,  173,  174,  182,
-      187,  188,  189,  206,  207,  190,  191,  192,  198,  199,
-      209,  173,  210,  214,  201,  202,  203,  205,  215,  216,
-      217,  218,  217,  217,  219,  220,  221,  206,  207,  222,
-      223,  224,  226,  227,  209,  233,  210,  214,  232,  234,
-      232,  232,  215,  216,  235,  218,  238,  239,  219,  220,
-      221,  241,  242,  222,  223,  224,  226,  227,  244,  233,
-      249,  250,  246,  234,  246,  246,  251,  253,  235,  254,
-
-      238,  239,  258,  260,  261,  241,  242,  257,  262,  257,
-      257,  263,  244,  265,  249,  250,  266,  270,  266,  266,
-      251,  253,  272,  254,  275,  277,  258,  260,  261,  278,
-      280,  281,  262,  281,  281,  263,  284,  265,  285,  289,
-      290,  270,  292,  149,  292,  292,  272,  135,  275,  277,
-      134,  127,  126,  278,  280,  121,  116,  111,   95,   81,
-      284,   72,  285,  289,  290,  299,  299,  299,  299,  299,
-      300,  300,  300,  300,  300,  301,  301,  301,  301,  301,
-      302,  302,  302,  302,  302,  304,   40,  304,  304,  306,
-      306,   11,    0,  306,  307,    0,  307,  307,  308,  308,
-
-      308,  308,  308,  309,  309,  309,  309,  309,  310,  310,
-      310,  310,  310,  311,  311,    0,  311,  311,  312,  312,
-        0,  312,  312,  313,  313,    0,  313,  313,  314,  314,
-        0,  314,  314,  315,    0,  315,  315,  316,    0,  316,
-      316,  317,  317,    0,  317,  317,  318,    0,  318,  318,
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-      298,  298,  298,  298,  298,  298,  298,  298,  298,  298
-    } ;
-
-extern int yy_flex_debug;
-int yy_flex_debug = 0;
-
-static yy_state_type *yy_state_buf=0, *yy_state_ptr=0;
-static char *yy_full_match;
-static int yy_lp;
-#define REJECT \
-{ \
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */ \
-yy_cp = (yy_full_match); /* restore poss. backed-over text */ \
-++(yy_lp); \
-goto find_rule; \
-}
-
-#define yymore() yymore_used_but_not_detected
-#define YY_MORE_ADJ 0
-#define YY_RESTORE_YY_MORE_OFFSET
-char *yytext;
-#line 1 "forth.l"
-#line 2 "forth.l"
-// vi: set ts=2 shiftwidth=2 expandtab:
-//
-// VNPForth - Compiled native Forth for x86 Linux
-// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
-//
-// This program is free software; you can redistribute it and/or
-// modify it under the terms of the GNU General Public License
-// as published by the Free Software Foundation; either version 2
-// of the License, or (at your option) any later version.
-//
-// This program is distributed in the hope that it will be useful,
-// but WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-// GNU General Public License for more details.
-//
-// You should have received a copy of the GNU General Public License
-// along with this program; if not, write to the Free Software
-// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
-//
-
-#include <iomanip>
-#include <iostream>
-#include <sstream>
-
-#include "parser.h"
-
-#define YYSTYPE char *
-#include "forth.tab.hh"
-
-// External definition of active parser for non-OO yacc/lex code.
-extern Parser * parser_;
-
-#define RETURN_WITH_LVALUE(X) \
-    do { yylval = yytext; return (X); } while (0)
-
-namespace {
-
-std::ostream &
-yycharacter (std::ostream & outs)
-{
-  std::ostringstream ss;
-  ss.fill ('0');
-  ss << "0x" << std::hex << std::setw (2)
-     << static_cast<int>(static_cast<unsigned char>(*yytext)) \
-     << std::dec;
-  outs << ss.str ();
-  return outs;
-}
-
-} // namespace
-
-
-#line 851 "forth.cc"
-
-#define INITIAL 0
-#define code1 1
-#define code2 2
-#define code3 3
-#define comment 4
-
-#ifndef YY_NO_UNISTD_H
-/* Special case for "unistd.h", since it is non-ANSI. We include it way
- * down here because we want the user's section 1 to have been scanned first.
- * The user has a chance to override it with an option.
- */
-#include <unistd.h>
-#endif
-
-#ifndef YY_EXTRA_TYPE
-#define YY_EXTRA_TYPE void *
-#endif
-
-static int yy_init_globals (void );
-
-/* Accessor methods to globals.
-   These are made visible to non-reentrant scanners for convenience. */
-
-int yylex_destroy (void );
-
-int yyget_debug (void );
-
-void yyset_debug (int debug_flag  );
-
-YY_EXTRA_TYPE yyget_extra (void );
-
-void yyset_extra (YY_EXTRA_TYPE user_defined  );
-
-FILE *yyget_in (void );
-
-void yyset_in  (FILE * in_str  );
-
-FILE *yyget_out (void );
-
-void yyset_out  (FILE * out_str  );
-
-int yyget_leng (void );
-
-char *yyget_text (void );
-
-int yyget_lineno (void );
-
-void yyset_lineno (int line_number  );
-
-/* Macros after this point can all be overridden by user definitions in
- * section 1.
- */
-
-#ifndef YY_SKIP_YYWRAP
-#ifdef __cplusplus
-extern "C" int yywrap (void );
-#else
-extern int yywrap (void );
-#endif
-#endif
-
-    static void yyunput (int c,char *buf_ptr  );
-    
-#ifndef yytext_ptr
-static void yy_flex_strncpy (char *,yyconst char *,int );
-#endif
-
-#ifdef YY_NEED_STRLEN
-static int yy_flex_strlen (yyconst char * );
-#endif
-
-#ifndef YY_NO_INPUT
-
-#ifdef __cplusplus
-static int yyinput (void );
-#else
-static int input (void );
-#endif
-
-#endif
-
-/* Amount of stuff to slurp up with each read. */
-#ifndef YY_READ_BUF_SIZE
-#ifdef __ia64__
-/* On IA-64, the buffer size is 16k, not 8k */
-#define YY_READ_BUF_SIZE 16384
-#else
-#define YY_READ_BUF_SIZE 8192
-#endif /* __ia64__ */
-#endif
-
-/* Copy whatever the last rule matched to the standard output. */
-#ifndef ECHO
-/* This used to be an fputs(), but since the string might contain NUL's,
- * we now use fwrite().
- */
-#define ECHO do { if (fwrite( yytext, yyleng, 1, yyout )) {} } while (0)
-#endif
-
-/* Gets input and stuffs it into "buf".  number of characters read, or YY_NULL,
- * is returned in "result".
- */
-#ifndef YY_INPUT
-#define YY_INPUT(buf,result,max_size) \
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_is_interactive ) \
-		{ \
-		int c = '*'; \
-		size_t n; \
-		for ( n = 0; n < max_size && \
-			     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
-			buf[n] = (char) c; \
-		if ( c == '\n' ) \
-			buf[n++] = (char) c; \
-		if ( c == EOF && ferror( yyin ) ) \
-			YY_FATAL_ERROR( "input in flex scanner failed" ); \
-		result = n; \
-		} \
-	else \
-		{ \
-		errno=0; \
-		while ( (result = fread(buf, 1, max_size, yyin))==0 && ferror(yyin)) \
-			{ \
-			if( errno != EINTR) \
-				{ \
-				YY_FATAL_ERROR( "input in flex scanner failed" ); \
-				break; \
-				} \
-			errno=0; \
-			clearerr(yyin); \
-			} \
-		}\
-\
-
-#endif
-
-/* No semi-colon after return; correct usage is to write "yyterminate();" -
- * we don't want an extra ';' after the "return" because that will cause
- * some compilers to complain about unreachable statements.
- */
-#ifndef yyterminate
-#define yyterminate() return YY_NULL
-#endif
-
-/* Number of entries by which start-condition stack grows. */
-#ifndef YY_START_STACK_INCR
-#define YY_START_STACK_INCR 25
-#endif
-
-/* Report a fatal error. */
-#ifndef YY_FATAL_ERROR
-#define YY_FATAL_ERROR(msg) yy_fatal_error( msg )
-#endif
-
-/* end tables serialization structures and prototypes */
-
-/* Default declaration of generated scanner - a define so the user can
- * easily add parameters.
- */
-#ifndef YY_DECL
-#define YY_DECL_IS_OURS 1
-
-extern int yylex (void);
-
-#define YY_DECL int yylex (void)
-#endif /* !YY_DECL */
-
-/* Code executed at the beginning of each rule, after yytext and yyleng
- * have been set up.
- */
-#ifndef YY_USER_ACTION
-#define YY_USER_ACTION
-#endif
-
-/* Code executed at the end of each rule. */
-#ifndef YY_BREAK
-#define YY_BREAK break;
-#endif
-
-#define YY_RULE_SETUP \
-	YY_USER_ACTION
-
-/** The main scanner function which does all the work.
- */
-YY_DECL
-{
-	register yy_state_type yy_current_state;
-	register char *yy_cp, *yy_bp;
-	register int yy_act;
-    
-#line 64 "forth.l"
-
-
-#line 1045 "forth.cc"
-
-	if ( !(yy_init) )
-		{
-		(yy_init) = 1;
-
-#ifdef YY_USER_INIT
-		YY_USER_INIT;
-#endif
-
-        /* Create the reject buffer large enough to save one state per allowed character. */
-        if ( ! (yy_state_buf) )
-            (yy_state_buf) = (yy_state_type *)yyalloc(YY_STATE_BUF_SIZE  );
-            if ( ! (yy_state_buf) )
-                YY_FATAL_ERROR( "out of dynamic memory in yylex()" );
-
-		if ( ! (yy_start) )
-			(yy_start) = 1;	/* first start state */
-
-		if ( ! yyin )
-			yyin = stdin;
-
-		if ( ! yyout )
-			yyout = stdout;
-
-		if ( ! YY_CURRENT_BUFFER ) {
-			yyensure_buffer_stack ();
-			YY_CURRENT_BUFFER_LVALUE =
-				yy_create_buffer(yyin,YY_BUF_SIZE );
-		}
-
-		yy_load_buffer_state( );
-		}
-
-	while ( 1 )		/* loops until end-of-file is reached */
-		{
-		yy_cp = (yy_c_buf_p);
-
-		/* Support of yytext. */
-		*yy_cp = (yy_hold_char);
-
-		/* yy_bp points to the position in yy_ch_buf of the start of
-		 * the current run.
-		 */
-		yy_bp = yy_cp;
-
-		yy_current_state = (yy_start);
-
-		(yy_state_ptr) = (yy_state_buf);
-		*(yy_state_ptr)++ = yy_current_state;
-
-yy_match:
-		do
-			{
-			register YY_CHAR yy_c = yy_ec[YY_SC_TO_UI(*yy_cp)];
-			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-				{
-				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 299 )
-					yy_c = yy_meta[(unsigned int) yy_c];
-				}
-			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-			*(yy_state_ptr)++ = yy_current_state;
-			++yy_cp;
-			}
-		while ( yy_base[yy_current_state] != 751 );
-
-yy_find_action:
-		yy_current_state = *--(yy_state_ptr);
-		(yy_lp) = yy_accept[yy_current_state];
-find_rule: /* we branch to this label when backing up */
-		for ( ; ; ) /* until we find what rule we matched */
-			{
-			if ( (yy_lp) && (yy_lp) < yy_accept[yy_current_state + 1] )
-				{
-				yy_act = yy_acclist[(yy_lp)];
-					{
-					(yy_full_match) = yy_cp;
-					break;
-					}
-				}
-			--yy_cp;
-			yy_current_state = *--(yy_state_ptr);
-			(yy_lp) = yy_accept[yy_current_state];
-			}
-
-		YY_DO_BEFORE_ACTION;
-
-do_action:	/* This label is used only to access EOF actions. */
-
-		switch ( yy_act )
-	{ /* beginning of action switch */
-case 1:
-/* rule 1 can match eol */
-YY_RULE_SETUP
-#line 66 "forth.l"
-parser_->next_line (); REJECT;
-	YY_BREAK
-case 2:
-YY_RULE_SETUP
-#line 68 "forth.l"
-RETURN_WITH_LVALUE(INTEGER_LITERAL);
-	YY_BREAK
-case 3:
-YY_RULE_SETUP
-#line 69 "forth.l"
-RETURN_WITH_LVALUE(INTEGER_LITERAL);
-	YY_BREAK
-case 4:
-YY_RULE_SETUP
-#line 70 "forth.l"
-RETURN_WITH_LVALUE(INTEGER_LITERAL);
-	YY_BREAK
-case 5:
-YY_RULE_SETUP
-#line 71 "forth.l"
-RETURN_WITH_LVALUE(INTEGER_LITERAL);
-	YY_BREAK
-case 6:
-YY_RULE_SETUP
-#line 73 "forth.l"
-RETURN_WITH_LVALUE(INTEGER_LITERAL);
-	YY_BREAK
-case 7:
-YY_RULE_SETUP
-#line 74 "forth.l"
-RETURN_WITH_LVALUE(INTEGER_LITERAL);
-	YY_BREAK
-case 8:
-YY_RULE_SETUP
-#line 75 "forth.l"
-RETURN_WITH_LVALUE(INTEGER_LITERAL);
-	YY_BREAK
-case 9:
-YY_RULE_SETUP
-#line 76 "forth.l"
-RETURN_WITH_LVALUE(INTEGER_LITERAL);
-	YY_BREAK
-case 10:
-YY_RULE_SETUP
-#line 78 "forth.l"
-{
-                                  RETURN_WITH_LVALUE(FLOAT_LITERAL); }
-	YY_BREAK
-case 11:
-YY_RULE_SETUP
-#line 81 "forth.l"
-RETURN_WITH_LVALUE(FLOAT_LITERAL);
-	YY_BREAK
-case 12:
-YY_RULE_SETUP
-#line 83 "forth.l"
-RETURN_WITH_LVALUE(OBJECT_ADDRESS);
-	YY_BREAK
-case 13:
-YY_RULE_SETUP
-#line 84 "forth.l"
-RETURN_WITH_LVALUE(OBJECT_ADDRESS);
-	YY_BREAK
-case 14:
-YY_RULE_SETUP
-#line 86 "forth.l"
-RETURN_WITH_LVALUE(STRING_LITERAL);
-	YY_BREAK
-case 15:
-YY_RULE_SETUP
-#line 87 "forth.l"
-RETURN_WITH_LVALUE(CSTRING);
-	YY_BREAK
-case 16:
-YY_RULE_SETUP
-#line 88 "forth.l"
-RETURN_WITH_LVALUE(PSTRING);
-	YY_BREAK
-case 17:
-YY_RULE_SETUP
-#line 89 "forth.l"
-RETURN_WITH_LVALUE(ASTRING);
-	YY_BREAK
-case 18:
-YY_RULE_SETUP
-#line 91 "forth.l"
-RETURN_WITH_LVALUE(DOTPARENSTRING);
-	YY_BREAK
-case 19:
-YY_RULE_SETUP
-#line 93 "forth.l"
-RETURN_WITH_LVALUE(CHAR_LITERAL);
-	YY_BREAK
-case 20:
-YY_RULE_SETUP
-#line 94 "forth.l"
-RETURN_WITH_LVALUE(CHAR_LITERAL);
-	YY_BREAK
-case 21:
-YY_RULE_SETUP
-#line 96 "forth.l"
-RETURN_WITH_LVALUE(CHAR_LITERAL);
-	YY_BREAK
-case 22:
-YY_RULE_SETUP
-#line 98 "forth.l"
-RETURN_WITH_LVALUE(NONAME);
-	YY_BREAK
-case 23:
-YY_RULE_SETUP
-#line 99 "forth.l"
-RETURN_WITH_LVALUE(':');
-	YY_BREAK
-case 24:
-YY_RULE_SETUP
-#line 100 "forth.l"
-RETURN_WITH_LVALUE(';');
-	YY_BREAK
-case 25:
-YY_RULE_SETUP
-#line 101 "forth.l"
-RETURN_WITH_LVALUE(EXIT);
-	YY_BREAK
-case 26:
-YY_RULE_SETUP
-#line 103 "forth.l"
-RETURN_WITH_LVALUE(FVARIABLE);
-	YY_BREAK
-case 27:
-YY_RULE_SETUP
-#line 104 "forth.l"
-RETURN_WITH_LVALUE(VARIABLE);
-	YY_BREAK
-case 28:
-YY_RULE_SETUP
-#line 105 "forth.l"
-RETURN_WITH_LVALUE(CREATE);
-	YY_BREAK
-case 29:
-YY_RULE_SETUP
-#line 106 "forth.l"
-RETURN_WITH_LVALUE(ALLOT);
-	YY_BREAK
-case 30:
-YY_RULE_SETUP
-#line 107 "forth.l"
-RETURN_WITH_LVALUE(FCONSTANT);
-	YY_BREAK
-case 31:
-YY_RULE_SETUP
-#line 108 "forth.l"
-RETURN_WITH_LVALUE(CONSTANT);
-	YY_BREAK
-case 32:
-YY_RULE_SETUP
-#line 110 "forth.l"
-RETURN_WITH_LVALUE(IF);
-	YY_BREAK
-case 33:
-YY_RULE_SETUP
-#line 111 "forth.l"
-RETURN_WITH_LVALUE(ELSE);
-	YY_BREAK
-case 34:
-YY_RULE_SETUP
-#line 112 "forth.l"
-RETURN_WITH_LVALUE(THEN);
-	YY_BREAK
-case 35:
-YY_RULE_SETUP
-#line 113 "forth.l"
-RETURN_WITH_LVALUE(ENDIF);
-	YY_BREAK
-case 36:
-YY_RULE_SETUP
-#line 115 "forth.l"
-RETURN_WITH_LVALUE(DO);
-	YY_BREAK
-case 37:
-YY_RULE_SETUP
-#line 116 "forth.l"
-RETURN_WITH_LVALUE(QUERY_DO);
-	YY_BREAK
-case 38:
-YY_RULE_SETUP
-#line 117 "forth.l"
-RETURN_WITH_LVALUE(LOOP);
-	YY_BREAK
-case 39:
-YY_RULE_SETUP
-#line 118 "forth.l"
-RETURN_WITH_LVALUE(PLUS_LOOP);
-	YY_BREAK
-case 40:
-YY_RULE_SETUP
-#line 119 "forth.l"
-RETURN_WITH_LVALUE(LEAVE);
-	YY_BREAK
-case 41:
-YY_RULE_SETUP
-#line 120 "forth.l"
-RETURN_WITH_LVALUE(QUERY_LEAVE);
-	YY_BREAK
-case 42:
-YY_RULE_SETUP
-#line 122 "forth.l"
-RETURN_WITH_LVALUE(BEGIN_);
-	YY_BREAK
-case 43:
-YY_RULE_SETUP
-#line 123 "forth.l"
-RETURN_WITH_LVALUE(UNTIL);
-	YY_BREAK
-case 44:
-YY_RULE_SETUP
-#line 124 "forth.l"
-RETURN_WITH_LVALUE(AGAIN);
-	YY_BREAK
-case 45:
-YY_RULE_SETUP
-#line 125 "forth.l"
-RETURN_WITH_LVALUE(WHILE);
-	YY_BREAK
-case 46:
-YY_RULE_SETUP
-#line 126 "forth.l"
-RETURN_WITH_LVALUE(REPEAT);
-	YY_BREAK
-case 47:
-YY_RULE_SETUP
-#line 128 "forth.l"
-RETURN_WITH_LVALUE(CASE);
-	YY_BREAK
-case 48:
-YY_RULE_SETUP
-#line 129 "forth.l"
-RETURN_WITH_LVALUE(OF);
-	YY_BREAK
-case 49:
-YY_RULE_SETUP
-#line 130 "forth.l"
-RETURN_WITH_LVALUE(ENDOF);
-	YY_BREAK
-case 50:
-YY_RULE_SETUP
-#line 131 "forth.l"
-RETURN_WITH_LVALUE(ENDCASE);
-	YY_BREAK
-case 51:
-YY_RULE_SETUP
-#line 133 "forth.l"
-RETURN_WITH_LVALUE(RECURSE);
-	YY_BREAK
-case 52:
-YY_RULE_SETUP
-#line 135 "forth.l"
-RETURN_WITH_LVALUE(COND_IFDEF);
-	YY_BREAK
-case 53:
-YY_RULE_SETUP
-#line 136 "forth.l"
-RETURN_WITH_LVALUE(COND_IFUNDEF);
-	YY_BREAK
-case 54:
-YY_RULE_SETUP
-#line 137 "forth.l"
-RETURN_WITH_LVALUE(COND_ELSE);
-	YY_BREAK
-case 55:
-YY_RULE_SETUP
-#line 138 "forth.l"
-RETURN_WITH_LVALUE(COND_THEN);
-	YY_BREAK
-case 56:
-YY_RULE_SETUP
-#line 139 "forth.l"
-RETURN_WITH_LVALUE(COND_ENDIF);
-	YY_BREAK
-case 57:
-YY_RULE_SETUP
-#line 141 "forth.l"
-BEGIN(code1); RETURN_WITH_LVALUE(CODE);
-	YY_BREAK
-
-case 58:
-YY_RULE_SETUP
-#line 143 "forth.l"
-
-	YY_BREAK
-case 59:
-YY_RULE_SETUP
-#line 144 "forth.l"
-BEGIN(code2); RETURN_WITH_LVALUE(WORD);
-	YY_BREAK
-
-
-case 60:
-YY_RULE_SETUP
-#line 147 "forth.l"
-
-	YY_BREAK
-case 61:
-/* rule 61 can match eol */
-YY_RULE_SETUP
-#line 148 "forth.l"
-BEGIN(code3); parser_->next_line ();
-	YY_BREAK
-case 62:
-/* rule 62 can match eol */
-YY_RULE_SETUP
-#line 149 "forth.l"
-BEGIN(code3); parser_->next_line ();
-	YY_BREAK
-case 63:
-/* rule 63 can match eol */
-YY_RULE_SETUP
-#line 150 "forth.l"
-
-	YY_BREAK
-case 64:
-/* rule 64 can match eol */
-YY_RULE_SETUP
-#line 151 "forth.l"
-BEGIN(code3);
-	YY_BREAK
-case 65:
-YY_RULE_SETUP
-#line 152 "forth.l"
-{ BEGIN(INITIAL);
-                                    parser_->parse_error ()
-                                      << "expected newline here" << std::endl; }
-	YY_BREAK
-
-
-case 66:
-/* rule 66 can match eol */
-YY_RULE_SETUP
-#line 157 "forth.l"
-
-	YY_BREAK
-case 67:
-YY_RULE_SETUP
-#line 158 "forth.l"
-BEGIN(INITIAL); RETURN_WITH_LVALUE(END_CODE);
-	YY_BREAK
-case 68:
-YY_RULE_SETUP
-#line 159 "forth.l"
-RETURN_WITH_LVALUE(ASM);
-	YY_BREAK
-
-case 69:
-YY_RULE_SETUP
-#line 161 "forth.l"
-
-	YY_BREAK
-case 70:
-YY_RULE_SETUP
-#line 162 "forth.l"
-{ BEGIN(INITIAL);
-                                    parser_->parse_error ()
-                                        << "unknown character '"
-                                        << yycharacter <<  "'" << std::endl; }
-	YY_BREAK
-case YY_STATE_EOF(code1):
-case YY_STATE_EOF(code2):
-case YY_STATE_EOF(code3):
-#line 166 "forth.l"
-{ BEGIN(INITIAL);
-                                    parser_->parse_error ()
-                                        << "unexpected EOF in CODE...ENDCODE"
-                                        << std::endl;
-                                    yyterminate (); }
-	YY_BREAK
-case 71:
-YY_RULE_SETUP
-#line 172 "forth.l"
-
-	YY_BREAK
-case 72:
-/* rule 72 can match eol */
-YY_RULE_SETUP
-#line 173 "forth.l"
-parser_->next_line ();
-	YY_BREAK
-case 73:
-/* rule 73 can match eol */
-YY_RULE_SETUP
-#line 174 "forth.l"
-parser_->next_line ();
-	YY_BREAK
-case 74:
-YY_RULE_SETUP
-#line 175 "forth.l"
-BEGIN(comment);
-	YY_BREAK
-
-case 75:
-YY_RULE_SETUP
-#line 177 "forth.l"
-BEGIN(INITIAL);
-	YY_BREAK
-case 76:
-/* rule 76 can match eol */
-YY_RULE_SETUP
-#line 178 "forth.l"
-
-	YY_BREAK
-case 77:
-YY_RULE_SETUP
-#line 179 "forth.l"
-
-	YY_BREAK
-
-case YY_STATE_EOF(comment):
-#line 181 "forth.l"
-{ BEGIN(INITIAL);
-                                    parser_->parse_error ()
-                                        << "unexpected EOF in comment"
-                                        << std::endl;
-                                    yyterminate (); }
-	YY_BREAK
-case 78:
-/* rule 78 can match eol */
-YY_RULE_SETUP
-#line 186 "forth.l"
-
-	YY_BREAK
-case 79:
-YY_RULE_SETUP
-#line 188 "forth.l"
-RETURN_WITH_LVALUE(WORD);
-	YY_BREAK
-case 80:
-YY_RULE_SETUP
-#line 190 "forth.l"
-{ parser_->parse_error ()
-                                        << "unknown character '"
-                                        << yycharacter <<  "'" << std::endl; }
-	YY_BREAK
-case 81:
-YY_RULE_SETUP
-#line 194 "forth.l"
-ECHO;
-	YY_BREAK
-#line 1586 "forth.cc"
-			case YY_STATE_EOF(INITIAL):
-				yyterminate();
-
-	case YY_END_OF_BUFFER:
-		{
-		/* Amount of text matched not including the EOB char. */
-		int yy_amount_of_matched_text = (int) (yy_cp - (yytext_ptr)) - 1;
-
-		/* Undo the effects of YY_DO_BEFORE_ACTION. */
-		*yy_cp = (yy_hold_char);
-		YY_RESTORE_YY_MORE_OFFSET
-
-		if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_NEW )
-			{
-			/* We're scanning a new file or input source.  It's
-			 * possible that this happened because the user
-			 * just pointed yyin at a new source and called
-			 * yylex().  If so, then we have to assure
-			 * consistency between YY_CURRENT_BUFFER and our
-			 * globals.  Here is the right place to do so, because
-			 * this is the first action (other than possibly a
-			 * back-up) that will match for the new input source.
-			 */
-			(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-			YY_CURRENT_BUFFER_LVALUE->yy_input_file = yyin;
-			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status = YY_BUFFER_NORMAL;
-			}
-
-		/* Note that here we test for yy_c_buf_p "<=" to the position
-		 * of the first EOB in the buffer, since yy_c_buf_p will
-		 * already have been incremented past the NUL character
-		 * (since all states make transitions on EOB to the
-		 * end-of-buffer state).  Contrast this with the test
-		 * in input().
-		 */
-		if ( (yy_c_buf_p) <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
-			{ /* This was really a NUL. */
-			yy_state_type yy_next_state;
-
-			(yy_c_buf_p) = (yytext_ptr) + yy_amount_of_matched_text;
-
-			yy_current_state = yy_get_previous_state(  );
-
-			/* Okay, we're now positioned to make the NUL
-			 * transition.  We couldn't have
-			 * yy_get_previous_state() go ahead and do it
-			 * for us because it doesn't know how to deal
-			 * with the possibility of jamming (and we don't
-			 * want to build jamming into it because then it
-			 * will run more slowly).
-			 */
-
-			yy_next_state = yy_try_NUL_trans( yy_current_state );
-
-			yy_bp = (yytext_ptr) + YY_MORE_ADJ;
-
-			if ( yy_next_state )
-				{
-				/* Consume the NUL. */
-				yy_cp = ++(yy_c_buf_p);
-				yy_current_state = yy_next_state;
-				goto yy_match;
-				}
-
-			else
-				{
-				yy_cp = (yy_c_buf_p);
-				goto yy_find_action;
-				}
-			}
-
-		else switch ( yy_get_next_buffer(  ) )
-			{
-			case EOB_ACT_END_OF_FILE:
-				{
-				(yy_did_buffer_switch_on_eof) = 0;
-
-				if ( yywrap( ) )
-					{
-					/* Note: because we've taken care in
-					 * yy_get_next_buffer() to have set up
-					 * yytext, we can now set up
-					 * yy_c_buf_p so that if some total
-					 * hoser (like flex itself) wants to
-					 * call the scanner after we return the
-					 * YY_NULL, it'll still work - another
-					 * YY_NULL will get returned.
-					 */
-					(yy_c_buf_p) = (yytext_ptr) + YY_MORE_ADJ;
-
-					yy_act = YY_STATE_EOF(YY_START);
-					goto do_action;
-					}
-
-				else
-					{
-					if ( ! (yy_did_buffer_switch_on_eof) )
-						YY_NEW_FILE;
-					}
-				break;
-				}
-
-			case EOB_ACT_CONTINUE_SCAN:
-				(yy_c_buf_p) =
-					(yytext_ptr) + yy_amount_of_matched_text;
-
-				yy_current_state = yy_get_previous_state(  );
-
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
-				goto yy_match;
-
-			case EOB_ACT_LAST_MATCH:
-				(yy_c_buf_p) =
-				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)];
-
-				yy_current_state = yy_get_previous_state(  );
-
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
-				goto yy_find_action;
-			}
-		break;
-		}
-
-	default:
-		YY_FATAL_ERROR(
-			"fatal flex scanner internal error--no action found" );
-	} /* end of action switch */
-		} /* end of scanning one token */
-} /* end of yylex */
-
-/* yy_get_next_buffer - try to read in a new buffer
- *
- * Returns a code representing an action:
- *	EOB_ACT_LAST_MATCH -
- *	EOB_ACT_CONTINUE_SCAN - continue scanning from current position
- *	EOB_ACT_END_OF_FILE - end of file
- */
-static int yy_get_next_buffer (void)
-{
-    	register char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
-	register char *source = (yytext_ptr);
-	register int number_to_move, i;
-	int ret_val;
-
-	if ( (yy_c_buf_p) > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] )
-		YY_FATAL_ERROR(
-		"fatal flex scanner internal error--end of buffer missed" );
-
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_fill_buffer == 0 )
-		{ /* Don't try to fill the buffer, so this is an EOF. */
-		if ( (yy_c_buf_p) - (yytext_ptr) - YY_MORE_ADJ == 1 )
-			{
-			/* We matched a single character, the EOB, so
-			 * treat this as a final EOF.
-			 */
-			return EOB_ACT_END_OF_FILE;
-			}
-
-		else
-			{
-			/* We matched some text prior to the EOB, first
-			 * process it.
-			 */
-			return EOB_ACT_LAST_MATCH;
-			}
-		}
-
-	/* Try to read more data. */
-
-	/* First move last chars to start of buffer. */
-	number_to_move = (int) ((yy_c_buf_p) - (yytext_ptr)) - 1;
-
-	for ( i = 0; i < number_to_move; ++i )
-		*(dest++) = *(source++);
-
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_EOF_PENDING )
-		/* don't do the read, it's not guaranteed to return an EOF,
-		 * just force an EOF
-		 */
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars) = 0;
-
-	else
-		{
-			int num_to_read =
-			YY_CURRENT_BUFFER_LVALUE->yy_buf_size - number_to_move - 1;
-
-		while ( num_to_read <= 0 )
-			{ /* Not enough room in the buffer - grow it. */
-
-			YY_FATAL_ERROR(
-"input buffer overflow, can't enlarge buffer because scanner uses REJECT" );
-
-			}
-
-		if ( num_to_read > YY_READ_BUF_SIZE )
-			num_to_read = YY_READ_BUF_SIZE;
-
-		/* Read in more data. */
-		YY_INPUT( (&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move]),
-			(yy_n_chars), (size_t) num_to_read );
-
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
-		}
-
-	if ( (yy_n_chars) == 0 )
-		{
-		if ( number_to_move == YY_MORE_ADJ )
-			{
-			ret_val = EOB_ACT_END_OF_FILE;
-			yyrestart(yyin  );
-			}
-
-		else
-			{
-			ret_val = EOB_ACT_LAST_MATCH;
-			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status =
-				YY_BUFFER_EOF_PENDING;
-			}
-		}
-
-	else
-		ret_val = EOB_ACT_CONTINUE_SCAN;
-
-	if ((yy_size_t) ((yy_n_chars) + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
-		/* Extend the array by 50%, plus the number we really need. */
-		yy_size_t new_size = (yy_n_chars) + number_to_move + ((yy_n_chars) >> 1);
-		YY_CURRENT_BUFFER_LVALUE->yy_ch_buf = (char *) yyrealloc((void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf,new_size  );
-		if ( ! YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
-			YY_FATAL_ERROR( "out of dynamic memory in yy_get_next_buffer()" );
-	}
-
-	(yy_n_chars) += number_to_move;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] = YY_END_OF_BUFFER_CHAR;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] = YY_END_OF_BUFFER_CHAR;
-
-	(yytext_ptr) = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
-
-	return ret_val;
-}
-
-/* yy_get_previous_state - get the state just before the EOB char was reached */
-
-    static yy_state_type yy_get_previous_state (void)
-{
-	register yy_state_type yy_current_state;
-	register char *yy_cp;
-    
-	yy_current_state = (yy_start);
-
-	(yy_state_ptr) = (yy_state_buf);
-	*(yy_state_ptr)++ = yy_current_state;
-
-	for ( yy_cp = (yytext_ptr) + YY_MORE_ADJ; yy_cp < (yy_c_buf_p); ++yy_cp )
-		{
-		register YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 1);
-		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-			{
-			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 299 )
-				yy_c = yy_meta[(unsigned int) yy_c];
-			}
-		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-		*(yy_state_ptr)++ = yy_current_state;
-		}
-
-	return yy_current_state;
-}
-
-/* yy_try_NUL_trans - try to make a transition on the NUL character
- *
- * synopsis
- *	next_state = yy_try_NUL_trans( current_state );
- */
-    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state )
-{
-	register int yy_is_jam;
-    
-	register YY_CHAR yy_c = 1;
-	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-		{
-		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 299 )
-			yy_c = yy_meta[(unsigned int) yy_c];
-		}
-	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 298);
-	if ( ! yy_is_jam )
-		*(yy_state_ptr)++ = yy_current_state;
-
-	return yy_is_jam ? 0 : yy_current_state;
-}
-
-    static void yyunput (int c, register char * yy_bp )
-{
-	register char *yy_cp;
-    
-    yy_cp = (yy_c_buf_p);
-
-	/* undo effects of setting up yytext */
-	*yy_cp = (yy_hold_char);
-
-	if ( yy_cp < YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + 2 )
-		{ /* need to shift things up to make room */
-		/* +2 for EOB chars. */
-		register int number_to_move = (yy_n_chars) + 2;
-		register char *dest = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[
-					YY_CURRENT_BUFFER_LVALUE->yy_buf_size + 2];
-		register char *source =
-				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move];
-
-		while ( source > YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
-			*--dest = *--source;
-
-		yy_cp += (int) (dest - source);
-		yy_bp += (int) (dest - source);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars =
-			(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_buf_size;
-
-		if ( yy_cp < YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + 2 )
-			YY_FATAL_ERROR( "flex scanner push-back overflow" );
-		}
-
-	*--yy_cp = (char) c;
-
-	(yytext_ptr) = yy_bp;
-	(yy_hold_char) = *yy_cp;
-	(yy_c_buf_p) = yy_cp;
-}
-
-#ifndef YY_NO_INPUT
-#ifdef __cplusplus
-    static int yyinput (void)
-#else
-    static int input  (void)
-#endif
-
-{
-	int c;
-    
-	*(yy_c_buf_p) = (yy_hold_char);
-
-	if ( *(yy_c_buf_p) == YY_END_OF_BUFFER_CHAR )
-		{
-		/* yy_c_buf_p now points to the character we want to return.
-		 * If this occurs *before* the EOB characters, then it's a
-		 * valid NUL; if not, then we've hit the end of the buffer.
-		 */
-		if ( (yy_c_buf_p) < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
-			/* This was really a NUL. */
-			*(yy_c_buf_p) = '\0';
-
-		else
-			{ /* need more input */
-			int offset = (yy_c_buf_p) - (yytext_ptr);
-			++(yy_c_buf_p);
-
-			switch ( yy_get_next_buffer(  ) )
-				{
-				case EOB_ACT_LAST_MATCH:
-					/* This happens because yy_g_n_b()
-					 * sees that we've accumulated a
-					 * token and flags that we need to
-					 * try matching the token before
-					 * proceeding.  But for input(),
-					 * there's no matching to consider.
-					 * So convert the EOB_ACT_LAST_MATCH
-					 * to EOB_ACT_END_OF_FILE.
-					 */
-
-					/* Reset buffer status. */
-					yyrestart(yyin );
-
-					/*FALLTHROUGH*/
-
-				case EOB_ACT_END_OF_FILE:
-					{
-					if ( yywrap( ) )
-						return EOF;
-
-					if ( ! (yy_did_buffer_switch_on_eof) )
-						YY_NEW_FILE;
-#ifdef __cplusplus
-					return yyinput();
-#else
-					return input();
-#endif
-					}
-
-				case EOB_ACT_CONTINUE_SCAN:
-					(yy_c_buf_p) = (yytext_ptr) + offset;
-					break;
-				}
-			}
-		}
-
-	c = *(unsigned char *) (yy_c_buf_p);	/* cast for 8-bit char's */
-	*(yy_c_buf_p) = '\0';	/* preserve yytext */
-	(yy_hold_char) = *++(yy_c_buf_p);
-
-	return c;
-}
-#endif	/* ifndef YY_NO_INPUT */
-
-/** Immediately switch to a different input stream.
- * @param input_file A readable stream.
- * 
- * @note This function does not reset the start condition to @c INITIAL .
- */
-    void yyrestart  (FILE * input_file )
-{
-    
-	if ( ! YY_CURRENT_BUFFER ){
-        yyensure_buffer_stack ();
-		YY_CURRENT_BUFFER_LVALUE =
-            yy_create_buffer(yyin,YY_BUF_SIZE );
-	}
-
-	yy_init_buffer(YY_CURRENT_BUFFER,input_file );
-	yy_load_buffer_state( );
-}
-
-/** Switch to a different input buffer.
- * @param new_buffer The new input buffer.
- * 
- */
-    void yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer )
-{
-    
-	/* TODO. We should be able to replace this entire function body
-	 * with
-	 *		yypop_buffer_state();
-	 *		yypush_buffer_state(new_buffer);
-     */
-	yyensure_buffer_stack ();
-	if ( YY_CURRENT_BUFFER == new_buffer )
-		return;
-
-	if ( YY_CURRENT_BUFFER )
-		{
-		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
-		}
-
-	YY_CURRENT_BUFFER_LVALUE = new_buffer;
-	yy_load_buffer_state( );
-
-	/* We don't actually know whether we did this switch during
-	 * EOF (yywrap()) processing, but the only time this flag
-	 * is looked at is after yywrap() is called, so it's safe
-	 * to go ahead and always set it.
-	 */
-	(yy_did_buffer_switch_on_eof) = 1;
-}
-
-static void yy_load_buffer_state  (void)
-{
-    	(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-	(yytext_ptr) = (yy_c_buf_p) = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
-	yyin = YY_CURRENT_BUFFER_LVALUE->yy_input_file;
-	(yy_hold_char) = *(yy_c_buf_p);
-}
-
-/** Allocate and initialize an input buffer state.
- * @param file A readable stream.
- * @param size The character buffer size in bytes. When in doubt, use @c YY_BUF_SIZE.
- * 
- * @return the allocated buffer state.
- */
-    YY_BUFFER_STATE yy_create_buffer  (FILE * file, int  size )
-{
-	YY_BUFFER_STATE b;
-    
-	b = (YY_BUFFER_STATE) yyalloc(sizeof( struct yy_buffer_state )  );
-	if ( ! b )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
-
-	b->yy_buf_size = size;
-
-	/* yy_ch_buf has to be 2 characters longer than the size given because
-	 * we need to put in 2 end-of-buffer characters.
-	 */
-	b->yy_ch_buf = (char *) yyalloc(b->yy_buf_size + 2  );
-	if ( ! b->yy_ch_buf )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
-
-	b->yy_is_our_buffer = 1;
-
-	yy_init_buffer(b,file );
-
-	return b;
-}
-
-/** Destroy the buffer.
- * @param b a buffer created with yy_create_buffer()
- * 
- */
-    void yy_delete_buffer (YY_BUFFER_STATE  b )
-{
-    
-	if ( ! b )
-		return;
-
-	if ( b == YY_CURRENT_BUFFER ) /* Not sure if we should pop here. */
-		YY_CURRENT_BUFFER_LVALUE = (YY_BUFFER_STATE) 0;
-
-	if ( b->yy_is_our_buffer )
-		yyfree((void *) b->yy_ch_buf  );
-
-	yyfree((void *) b  );
-}
-
-#ifndef __cplusplus
-extern int isatty (int );
-#endif /* __cplusplus */
-    
-/* Initializes or reinitializes a buffer.
- * This function is sometimes called more than once on the same buffer,
- * such as during a yyrestart() or at EOF.
- */
-    static void yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file )
-
-{
-	int oerrno = errno;
-    
-	yy_flush_buffer(b );
-
-	b->yy_input_file = file;
-	b->yy_fill_buffer = 1;
-
-    /* If b is the current buffer, then yy_init_buffer was _probably_
-     * called from yyrestart() or through yy_get_next_buffer.
-     * In that case, we don't want to reset the lineno or column.
-     */
-    if (b != YY_CURRENT_BUFFER){
-        b->yy_bs_lineno = 1;
-        b->yy_bs_column = 0;
-    }
-
-        b->yy_is_interactive = file ? (isatty( fileno(file) ) > 0) : 0;
-    
-	errno = oerrno;
-}
-
-/** Discard all buffered characters. On the next scan, YY_INPUT will be called.
- * @param b the buffer state to be flushed, usually @c YY_CURRENT_BUFFER.
- * 
- */
-    void yy_flush_buffer (YY_BUFFER_STATE  b )
-{
-    	if ( ! b )
-		return;
-
-	b->yy_n_chars = 0;
-
-	/* We always need two end-of-buffer characters.  The first causes
-	 * a transition to the end-of-buffer state.  The second causes
-	 * a jam in that state.
-	 */
-	b->yy_ch_buf[0] = YY_END_OF_BUFFER_CHAR;
-	b->yy_ch_buf[1] = YY_END_OF_BUFFER_CHAR;
-
-	b->yy_buf_pos = &b->yy_ch_buf[0];
-
-	b->yy_at_bol = 1;
-	b->yy_buffer_status = YY_BUFFER_NEW;
-
-	if ( b == YY_CURRENT_BUFFER )
-		yy_load_buffer_state( );
-}
-
-/** Pushes the new state onto the stack. The new state becomes
- *  the current state. This function will allocate the stack
- *  if necessary.
- *  @param new_buffer The new state.
- *  
- */
-void yypush_buffer_state (YY_BUFFER_STATE new_buffer )
-{
-    	if (new_buffer == NULL)
-		return;
-
-	yyensure_buffer_stack();
-
-	/* This block is copied from yy_switch_to_buffer. */
-	if ( YY_CURRENT_BUFFER )
-		{
-		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
-		}
-
-	/* Only push if top exists. Otherwise, replace top. */
-	if (YY_CURRENT_BUFFER)
-		(yy_buffer_stack_top)++;
-	YY_CURRENT_BUFFER_LVALUE = new_buffer;
-
-	/* copied from yy_switch_to_buffer. */
-	yy_load_buffer_state( );
-	(yy_did_buffer_switch_on_eof) = 1;
-}
-
-/** Removes and deletes the top of the stack, if present.
- *  The next element becomes the new top.
- *  
- */
-void yypop_buffer_state (void)
-{
-    	if (!YY_CURRENT_BUFFER)
-		return;
-
-	yy_delete_buffer(YY_CURRENT_BUFFER );
-	YY_CURRENT_BUFFER_LVALUE = NULL;
-	if ((yy_buffer_stack_top) > 0)
-		--(yy_buffer_stack_top);
-
-	if (YY_CURRENT_BUFFER) {
-		yy_load_buffer_state( );
-		(yy_did_buffer_switch_on_eof) = 1;
-	}
-}
-
-/* Allocates the stack if it does not exist.
- *  Guarantees space for at least one push.
- */
-static void yyensure_buffer_stack (void)
-{
-	int num_to_alloc;
-    
-	if (!(yy_buffer_stack)) {
-
-		/* First allocation is just for 2 elements, since we don't know if this
-		 * scanner will even need a stack. We use 2 instead of 1 to avoid an
-		 * immediate realloc on the next call.
-         */
-		num_to_alloc = 1;
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyalloc
-								(num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
-			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
-								  
-		memset((yy_buffer_stack), 0, num_to_alloc * sizeof(struct yy_buffer_state*));
-				
-		(yy_buffer_stack_max) = num_to_alloc;
-		(yy_buffer_stack_top) = 0;
-		return;
-	}
-
-	if ((yy_buffer_stack_top) >= ((yy_buffer_stack_max)) - 1){
-
-		/* Increase the buffer to prepare for a possible push. */
-		int grow_size = 8 /* arbitrary grow size */;
-
-		num_to_alloc = (yy_buffer_stack_max) + grow_size;
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyrealloc
-								((yy_buffer_stack),
-								num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
-			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
-
-		/* zero only the new slots.*/
-		memset((yy_buffer_stack) + (yy_buffer_stack_max), 0, grow_size * sizeof(struct yy_buffer_state*));
-		(yy_buffer_stack_max) = num_to_alloc;
-	}
-}
-
-/** Setup the input buffer state to scan directly from a user-specified character buffer.
- * @param base the character buffer
- * @param size the size in bytes of the character buffer
- * 
- * @return the newly allocated buffer state object. 
- */
-YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
-{
-	YY_BUFFER_STATE b;
-    
-	if ( size < 2 ||
-	     base[size-2] != YY_END_OF_BUFFER_CHAR ||
-	     base[size-1] != YY_END_OF_BUFFER_CHAR )
-		/* They forgot to leave room for the EOB's. */
-		return 0;
-
-	b = (YY_BUFFER_STATE) yyalloc(sizeof( struct yy_buffer_state )  );
-	if ( ! b )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
-
-	b->yy_buf_size = size - 2;	/* "- 2" to take care of EOB's */
-	b->yy_buf_pos = b->yy_ch_buf = base;
-	b->yy_is_our_buffer = 0;
-	b->yy_input_file = 0;
-	b->yy_n_chars = b->yy_buf_size;
-	b->yy_is_interactive = 0;
-	b->yy_at_bol = 1;
-	b->yy_fill_buffer = 0;
-	b->yy_buffer_status = YY_BUFFER_NEW;
-
-	yy_switch_to_buffer(b  );
-
-	return b;
-}
-
-/** Setup the input buffer state to scan a string. The next call to yylex() will
- * scan from a @e copy of @a str.
- * @param yystr a NUL-terminated string to scan
- * 
- * @return the newly allocated buffer state object.
- * @note If you want to scan bytes that may contain NUL values, then use
- *       yy_scan_bytes() instead.
- */
-YY_BUFFER_STATE yy_scan_string (yyconst char * yystr )
-{
-    
-	return yy_scan_bytes(yystr,strlen(yystr) );
-}
-
-/** Setup the input buffer state to scan the given bytes. The next call to yylex() will
- * scan from a @e copy of @a bytes.
- * @param yybytes the byte buffer to scan
- * @param _yybytes_len the number of bytes in the buffer pointed to by @a bytes.
- * 
- * @return the newly allocated buffer state object.
- */
-YY_BUFFER_STATE yy_scan_bytes  (yyconst char * yybytes, int  _yybytes_len )
-{
-	YY_BUFFER_STATE b;
-	char *buf;
-	yy_size_t n;
-	int i;
-    
-	/* Get memory for full buffer, including space for trailing EOB's. */
-	n = _yybytes_len + 2;
-	buf = (char *) yyalloc(n  );
-	if ( ! buf )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
-
-	for ( i = 0; i < _yybytes_len; ++i )
-		buf[i] = yybytes[i];
-
-	buf[_yybytes_len] = buf[_yybytes_len+1] = YY_END_OF_BUFFER_CHAR;
-
-	b = yy_scan_buffer(buf,n );
-	if ( ! b )
-		YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
-
-	/* It's okay to grow etc. this buffer, and we should throw it
-	 * away when we're done.
-	 */
-	b->yy_is_our_buffer = 1;
-
-	return b;
-}
-
-#ifndef YY_EXIT_FAILURE
-#define YY_EXIT_FAILURE 2
-#endif
-
-static void yy_fatal_error (yyconst char* msg )
-{
-    	(void) fprintf( stderr, "%s\n", msg );
-	exit( YY_EXIT_FAILURE );
-}
-
-/* Redefine yyless() so it works in section 3 code. */
-
-#undef yyless
-#define yyless(n) \
-	do \
-		{ \
-		/* Undo effects of setting up yytext. */ \
-        int yyless_macro_arg = (n); \
-        YY_LESS_LINENO(yyless_macro_arg);\
-		yytext[yyleng] = (yy_hold_char); \
-		(yy_c_buf_p) = yytext + yyless_macro_arg; \
-		(yy_hold_char) = *(yy_c_buf_p); \
-		*(yy_c_buf_p) = '\0'; \
-		yyleng = yyless_macro_arg; \
-		} \
-	while ( 0 )
-
-/* Accessor  methods (get/set functions) to struct members. */
-
-/** Get the current line number.
- * 
- */
-int yyget_lineno  (void)
-{
-        
-    return yylineno;
-}
-
-/** Get the input stream.
- * 
- */
-FILE *yyget_in  (void)
-{
-        return yyin;
-}
-
-/** Get the output stream.
- * 
- */
-FILE *yyget_out  (void)
-{
-        return yyout;
-}
-
-/** Get the length of the current token.
- * 
- */
-int yyget_leng  (void)
-{
-        return yyleng;
-}
-
-/** Get the current token.
- * 
- */
-
-char *yyget_text  (void)
-{
-        return yytext;
-}
-
-/** Set the current line number.
- * @param line_number
- * 
- */
-void yyset_lineno (int  line_number )
-{
-    
-    yylineno = line_number;
-}
-
-/** Set the input stream. This does not discard the current
- * input buffer.
- * @param in_str A readable stream.
- * 
- * @see yy_switch_to_buffer
- */
-void yyset_in (FILE *  in_str )
-{
-        yyin = in_str ;
-}
-
-void yyset_out (FILE *  out_str )
-{
-        yyout = out_str ;
-}
-
-int yyget_debug  (void)
-{
-        return yy_flex_debug;
-}
-
-void yyset_debug (int  bdebug )
-{
-        yy_flex_debug = bdebug ;
-}
-
-static int yy_init_globals (void)
-{
-        /* Initialization is the same as for the non-reentrant scanner.
-     * This function is called from yylex_destroy(), so don't allocate here.
-     */
-
-    (yy_buffer_stack) = 0;
-    (yy_buffer_stack_top) = 0;
-    (yy_buffer_stack_max) = 0;
-    (yy_c_buf_p) = (char *) 0;
-    (yy_init) = 0;
-    (yy_start) = 0;
-
-    (yy_state_buf) = 0;
-    (yy_state_ptr) = 0;
-    (yy_full_match) = 0;
-    (yy_lp) = 0;
-
-/* Defined in main.c */
-#ifdef YY_STDINIT
-    yyin = stdin;
-    yyout = stdout;
-#else
-    yyin = (FILE *) 0;
-    yyout = (FILE *) 0;
-#endif
-
-    /* For future reference: Set errno on error, since we are called by
-     * yylex_init()
-     */
-    return 0;
-}
-
-/* yylex_destroy is for both reentrant and non-reentrant scanners. */
-int yylex_destroy  (void)
-{
-    
-    /* Pop the buffer stack, destroying each element. */
-	while(YY_CURRENT_BUFFER){
-		yy_delete_buffer(YY_CURRENT_BUFFER  );
-		YY_CURRENT_BUFFER_LVALUE = NULL;
-		yypop_buffer_state();
-	}
-
-	/* Destroy the stack itself. */
-	yyfree((yy_buffer_stack) );
-	(yy_buffer_stack) = NULL;
-
-    yyfree ( (yy_state_buf) );
-    (yy_state_buf)  = NULL;
-
-    /* Reset the globals. This is important in a non-reentrant scanner so the next time
-     * yylex() is called, initialization will occur. */
-    yy_init_globals( );
-
-    return 0;
-}
-
-/*
- * Internal utility routines.
- */
-
-#ifndef yytext_ptr
-static void yy_flex_strncpy (char* s1, yyconst char * s2, int n )
-{
-	register int i;
-	for ( i = 0; i < n; ++i )
-		s1[i] = s2[i];
-}
-#endif
-
-#ifdef YY_NEED_STRLEN
-static int yy_flex_strlen (yyconst char * s )
-{
-	register int n;
-	for ( n = 0; s[n]; ++n )
-		;
-
-	return n;
-}
-#endif
-
-void *yyalloc (yy_size_t  size )
-{
-	return (void *) malloc( size );
-}
-
-void *yyrealloc  (void * ptr, yy_size_t  size )
-{
-	/* The cast to (char *) in the following accommodates both
-	 * implementations that use char* generic pointers, and those
-	 * that use void* generic pointers.  It works with the latter
-	 * because both ANSI C and C++ allow castless assignment from
-	 * any pointer type to void*, and deal with argument conversions
-	 * as though doing an assignment.
-	 */
-	return (void *) realloc( (char *) ptr, size );
-}
-
-void yyfree (void * ptr )
-{
-	free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
-}
-
-#define YYTABLES_NAME "yytables"
-
-#line 194 "forth.l"
-
-
-
@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2011 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,17 +45,17 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.5"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
 
 /* Pure parsers.  */
-#define YYPURE 0
+#define YYPURE 2
 
 /* Push parsers.  */
 #define YYPUSH 0
@@ -58,14 +63,10 @@
 /* Pull parsers.  */
 #define YYPULL 1
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
-
 
 
-/* Copy the first part of user declarations.  */
 
-/* Line 268 of yacc.c  */
+/* First part of user prologue.  */
 #line 1 "forth.y"
 
 // vi: set ts=2 shiftwidth=2 expandtab:
@@ -93,12 +94,8 @@
 
 #include "parser.h"
 
-#define YYSTYPE char *
+#define YYSTYPE const char *
 #define YYERROR_VERBOSE 1
-extern int yylex ();
-
-// External definition of active parser for non-OO yacc/lex code.
-extern Parser * parser_;
 
 // Macro to cause yyparse to abort if the maximum number of allowable errors
 // has been exceeded.  This is an icky thing to have to do, but the closed
@@ -108,9 +105,9 @@ extern Parser * parser_;
 // the time that happens.  All in all, rather unpleasant.
 #define MNE                                               \
   do {                                                    \
-    if (parser_->excessive_errors ())                     \
+    if (parser->excessive_errors ())                      \
       {                                                   \
-        parser_->parse_error ()                           \
+        parser->parse_error ()                            \
             << "too many errors, giving up" << std::endl; \
         YYABORT;                                          \
       }                                                   \
@@ -120,196 +117,238 @@ extern Parser * parser_;
 // conditional processing indicates that the code being parsed is inactive.
 #define P(TERMINAL_HANDLER)                               \
   do {                                                    \
-    if (parser_->cond_state ())                           \
+    if (parser->cond_state ())                            \
       {                                                   \
         TERMINAL_HANDLER;                                 \
       }                                                   \
   } while (0)
 
-// yyerror function links to the parser's error reporting.
+// yylex and yyerror functions link to the parser's scanner and error
+// reporting.  The parser is pure, so all parse state is in yyparse's
+// frame and the Parser it is given.
 namespace {
 
-void yyerror (const char * message)
+int yylex (const char ** text, Parser * parser)
+{
+  return parser->scan (text);
+}
+
+void yyerror (Parser * parser, const char * message)
 {
-  parser_->parse_error () << message << std::endl;
+  parser->parse_error () << message << std::endl;
 }
 
 } // namespace
 
 
+#line 145 "forth.tab.cc"
 
-/* Line 268 of yacc.c  */
-#line 143 "forth.tab.cc"
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
-#endif
+#include "forth.tab.hh"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_VARIABLE = 3,                   /* VARIABLE  */
+  YYSYMBOL_FVARIABLE = 4,                  /* FVARIABLE  */
+  YYSYMBOL_CONSTANT = 5,                   /* CONSTANT  */
+  YYSYMBOL_FCONSTANT = 6,                  /* FCONSTANT  */
+  YYSYMBOL_CREATE = 7,                     /* CREATE  */
+  YYSYMBOL_ALLOT = 8,                      /* ALLOT  */
+  YYSYMBOL_NONAME = 9,                     /* NONAME  */
+  YYSYMBOL_EXIT = 10,                      /* EXIT  */
+  YYSYMBOL_IF = 11,                        /* IF  */
+  YYSYMBOL_THEN = 12,                      /* THEN  */
+  YYSYMBOL_ENDIF = 13,                     /* ENDIF  */
+  YYSYMBOL_ELSE = 14,                      /* ELSE  */
+  YYSYMBOL_DO = 15,                        /* DO  */
+  YYSYMBOL_QUERY_DO = 16,                  /* "?DO"  */
+  YYSYMBOL_LOOP = 17,                      /* LOOP  */
+  YYSYMBOL_PLUS_LOOP = 18,                 /* "+LOOP"  */
+  YYSYMBOL_LEAVE = 19,                     /* LEAVE  */
+  YYSYMBOL_QUERY_LEAVE = 20,               /* "?LEAVE"  */
+  YYSYMBOL_BEGIN_ = 21,                    /* "BEGIN"  */
+  YYSYMBOL_UNTIL = 22,                     /* UNTIL  */
+  YYSYMBOL_WHILE = 23,                     /* WHILE  */
+  YYSYMBOL_REPEAT = 24,                    /* REPEAT  */
+  YYSYMBOL_AGAIN = 25,                     /* AGAIN  */
+  YYSYMBOL_CASE = 26,                      /* CASE  */
+  YYSYMBOL_OF = 27,                        /* OF  */
+  YYSYMBOL_ENDOF = 28,                     /* ENDOF  */
+  YYSYMBOL_ENDCASE = 29,                   /* ENDCASE  */
+  YYSYMBOL_RECURSE = 30,                   /* RECURSE  */
+  YYSYMBOL_PSTRING = 31,                   /* "print string"  */
+  YYSYMBOL_CSTRING = 32,                   /* "counted string"  */
+  YYSYMBOL_ASTRING = 33,                   /* "abort string"  */
+  YYSYMBOL_DOTPARENSTRING = 34,            /* "compilation comment"  */
+  YYSYMBOL_INTEGER_LITERAL = 35,           /* "integer"  */
+  YYSYMBOL_STRING_LITERAL = 36,            /* "literal string"  */
+  YYSYMBOL_FLOAT_LITERAL = 37,             /* "float"  */
+  YYSYMBOL_CHAR_LITERAL = 38,              /* "char literal"  */
+  YYSYMBOL_OBJECT_ADDRESS = 39,            /* "address"  */
+  YYSYMBOL_WORD = 40,                      /* "word"  */
+  YYSYMBOL_CODE = 41,                      /* CODE  */
+  YYSYMBOL_ASM = 42,                       /* "assembler string"  */
+  YYSYMBOL_END_CODE = 43,                  /* "END-CODE"  */
+  YYSYMBOL_COND_IFDEF = 44,                /* "[IFDEF]"  */
+  YYSYMBOL_COND_IFUNDEF = 45,              /* "[IFUNDEF]"  */
+  YYSYMBOL_COND_ELSE = 46,                 /* "[ELSE]"  */
+  YYSYMBOL_COND_THEN = 47,                 /* "[THEN]"  */
+  YYSYMBOL_COND_ENDIF = 48,                /* "[ENDIF]"  */
+  YYSYMBOL_49_ = 49,                       /* ':'  */
+  YYSYMBOL_50_ = 50,                       /* ';'  */
+  YYSYMBOL_YYACCEPT = 51,                  /* $accept  */
+  YYSYMBOL_program = 52,                   /* program  */
+  YYSYMBOL_elements = 53,                  /* elements  */
+  YYSYMBOL_element = 54,                   /* element  */
+  YYSYMBOL_declaration = 55,               /* declaration  */
+  YYSYMBOL_statements = 56,                /* statements  */
+  YYSYMBOL_definition = 57,                /* definition  */
+  YYSYMBOL_semicolon_ = 58,                /* semicolon_  */
+  YYSYMBOL_definedword = 59,               /* definedword  */
+  YYSYMBOL_noname = 60,                    /* noname  */
+  YYSYMBOL_codeword = 61,                  /* codeword  */
+  YYSYMBOL_codes = 62,                     /* codes  */
+  YYSYMBOL_code = 63,                      /* code  */
+  YYSYMBOL_end_code_ = 64,                 /* end_code_  */
+  YYSYMBOL_statement = 65,                 /* statement  */
+  YYSYMBOL_conditional = 66,               /* conditional  */
+  YYSYMBOL_if_statement = 67,              /* if_statement  */
+  YYSYMBOL_if_ = 68,                       /* if_  */
+  YYSYMBOL_then_endif_ = 69,               /* then_endif_  */
+  YYSYMBOL_else_ = 70,                     /* else_  */
+  YYSYMBOL_do_loop = 71,                   /* do_loop  */
+  YYSYMBOL_do_ = 72,                       /* do_  */
+  YYSYMBOL_loop_ = 73,                     /* loop_  */
+  YYSYMBOL_plus_loop_ = 74,                /* plus_loop_  */
+  YYSYMBOL_do_leave = 75,                  /* do_leave  */
+  YYSYMBOL_begin_loop = 76,                /* begin_loop  */
+  YYSYMBOL_begin_ = 77,                    /* begin_  */
+  YYSYMBOL_until_ = 78,                    /* until_  */
+  YYSYMBOL_repeat_again_ = 79,             /* repeat_again_  */
+  YYSYMBOL_begin_while = 80,               /* begin_while  */
+  YYSYMBOL_case_statement = 81,            /* case_statement  */
+  YYSYMBOL_casebody = 82,                  /* casebody  */
+  YYSYMBOL_caseclause = 83,                /* caseclause  */
+  YYSYMBOL_case_ = 84,                     /* case_  */
+  YYSYMBOL_endcase_ = 85,                  /* endcase_  */
+  YYSYMBOL_of_ = 86,                       /* of_  */
+  YYSYMBOL_endof_ = 87,                    /* endof_  */
+  YYSYMBOL_recurse = 88                    /* recurse  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
 
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
 
 
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     END = 0,
-     VARIABLE = 258,
-     FVARIABLE = 259,
-     CONSTANT = 260,
-     FCONSTANT = 261,
-     CREATE = 262,
-     ALLOT = 263,
-     NONAME = 264,
-     EXIT = 265,
-     IF = 266,
-     THEN = 267,
-     ENDIF = 268,
-     ELSE = 269,
-     DO = 270,
-     QUERY_DO = 271,
-     LOOP = 272,
-     PLUS_LOOP = 273,
-     LEAVE = 274,
-     QUERY_LEAVE = 275,
-     BEGIN_ = 276,
-     UNTIL = 277,
-     WHILE = 278,
-     REPEAT = 279,
-     AGAIN = 280,
-     CASE = 281,
-     OF = 282,
-     ENDOF = 283,
-     ENDCASE = 284,
-     RECURSE = 285,
-     PSTRING = 286,
-     CSTRING = 287,
-     ASTRING = 288,
-     DOTPARENSTRING = 289,
-     INTEGER_LITERAL = 290,
-     STRING_LITERAL = 291,
-     FLOAT_LITERAL = 292,
-     CHAR_LITERAL = 293,
-     OBJECT_ADDRESS = 294,
-     WORD = 295,
-     CODE = 296,
-     ASM = 297,
-     END_CODE = 298,
-     COND_IFDEF = 299,
-     COND_IFUNDEF = 300,
-     COND_ELSE = 301,
-     COND_THEN = 302,
-     COND_ENDIF = 303
-   };
-#endif
-/* Tokens.  */
-#define END 0
-#define VARIABLE 258
-#define FVARIABLE 259
-#define CONSTANT 260
-#define FCONSTANT 261
-#define CREATE 262
-#define ALLOT 263
-#define NONAME 264
-#define EXIT 265
-#define IF 266
-#define THEN 267
-#define ENDIF 268
-#define ELSE 269
-#define DO 270
-#define QUERY_DO 271
-#define LOOP 272
-#define PLUS_LOOP 273
-#define LEAVE 274
-#define QUERY_LEAVE 275
-#define BEGIN_ 276
-#define UNTIL 277
-#define WHILE 278
-#define REPEAT 279
-#define AGAIN 280
-#define CASE 281
-#define OF 282
-#define ENDOF 283
-#define ENDCASE 284
-#define RECURSE 285
-#define PSTRING 286
-#define CSTRING 287
-#define ASTRING 288
-#define DOTPARENSTRING 289
-#define INTEGER_LITERAL 290
-#define STRING_LITERAL 291
-#define FLOAT_LITERAL 292
-#define CHAR_LITERAL 293
-#define OBJECT_ADDRESS 294
-#define WORD 295
-#define CODE 296
-#define ASM 297
-#define END_CODE 298
-#define COND_IFDEF 299
-#define COND_IFUNDEF 300
-#define COND_ELSE 301
-#define COND_THEN 302
-#define COND_ENDIF 303
-
-
-
-
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef int YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+#ifdef short
+# undef short
 #endif
 
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
-
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-/* Line 343 of yacc.c  */
-#line 283 "forth.tab.cc"
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-typedef signed char yytype_int8;
-#else
-typedef short int yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -317,55 +356,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
 #endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -382,9 +472,9 @@ YYID (yyi)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
 #     ifndef EXIT_SUCCESS
 #      define EXIT_SUCCESS 0
 #     endif
@@ -394,8 +484,8 @@ YYID (yyi)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -411,7 +501,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -419,40 +509,37 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -462,35 +549,35 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
 #if defined YYCOPY_NEEDED && YYCOPY_NEEDED
-/* Copy COUNT objects from FROM to TO.  The source and destination do
+/* Copy COUNT objects from SRC to DST.  The source and destination do
    not overlap.  */
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
@@ -506,18 +593,23 @@ union yyalloc
 #define YYNNTS  38
 /* YYNRULES -- Number of rules.  */
 #define YYNRULES  82
-/* YYNRULES -- Number of states.  */
+/* YYNSTATES -- Number of states.  */
 #define YYNSTATES  116
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   303
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -553,160 +645,71 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint8 yyprhs[] =
-{
-       0,     0,     3,     6,     7,    10,    12,    14,    16,    19,
-      22,    25,    28,    31,    37,    42,    43,    46,    51,    55,
-      60,    62,    64,    66,    68,    70,    73,    75,    77,    79,
-      81,    83,    85,    87,    89,    91,    93,    95,    97,    99,
-     101,   103,   105,   107,   109,   111,   113,   115,   117,   120,
-     123,   125,   127,   129,   133,   139,   141,   143,   145,   147,
-     151,   155,   157,   159,   161,   163,   165,   167,   171,   175,
-     177,   179,   181,   183,   185,   190,   192,   195,   200,   202,
-     204,   206,   208
-};
-
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int8 yyrhs[] =
-{
-      52,     0,    -1,    53,     0,    -1,    -1,    53,    54,    -1,
-      57,    -1,    55,    -1,    65,    -1,     1,    40,    -1,     3,
-      40,    -1,     4,    40,    -1,     5,    40,    -1,     6,    40,
-      -1,     7,    40,    35,    40,     8,    -1,     7,    40,    35,
-       8,    -1,    -1,    56,    65,    -1,    49,    59,    56,    58,
-      -1,    60,    56,    58,    -1,    41,    61,    62,    64,    -1,
-      50,    -1,    40,    -1,     9,    -1,    40,    -1,    63,    -1,
-      62,    63,    -1,    42,    -1,    43,    -1,    66,    -1,    67,
-      -1,    71,    -1,    75,    -1,    76,    -1,    80,    -1,    81,
-      -1,    88,    -1,    10,    -1,    31,    -1,    32,    -1,    33,
-      -1,    34,    -1,    35,    -1,    37,    -1,    36,    -1,    38,
-      -1,    39,    -1,     8,    -1,    40,    -1,    44,    40,    -1,
-      45,    40,    -1,    47,    -1,    48,    -1,    46,    -1,    68,
-      56,    69,    -1,    68,    56,    70,    56,    69,    -1,    11,
-      -1,    12,    -1,    13,    -1,    14,    -1,    72,    56,    73,
-      -1,    72,    56,    74,    -1,    15,    -1,    16,    -1,    17,
-      -1,    18,    -1,    19,    -1,    20,    -1,    77,    56,    78,
-      -1,    77,    56,    79,    -1,    21,    -1,    22,    -1,    24,
-      -1,    25,    -1,    23,    -1,    84,    82,    56,    85,    -1,
-      83,    -1,    82,    83,    -1,    56,    86,    56,    87,    -1,
-      26,    -1,    29,    -1,    27,    -1,    28,    -1,    30,    -1
-};
-
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint8 yyrline[] =
 {
-       0,    97,    97,   100,   101,   104,   105,   106,   107,   110,
-     111,   112,   113,   114,   116,   120,   121,   124,   125,   126,
-     128,   130,   132,   134,   136,   137,   139,   141,   144,   145,
-     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
-     156,   157,   158,   159,   160,   161,   162,   163,   166,   167,
-     168,   169,   170,   173,   174,   176,   178,   179,   181,   184,
-     185,   187,   188,   190,   192,   194,   195,   198,   199,   201,
-     203,   205,   206,   208,   211,   213,   214,   216,   218,   220,
-     222,   224,   227
+       0,   103,   103,   106,   107,   110,   111,   112,   113,   116,
+     117,   118,   119,   120,   122,   126,   127,   130,   131,   132,
+     134,   136,   138,   140,   142,   143,   145,   147,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   172,   173,
+     174,   175,   176,   179,   180,   182,   184,   185,   187,   190,
+     191,   193,   194,   196,   198,   200,   201,   204,   205,   207,
+     209,   211,   212,   214,   217,   219,   220,   222,   224,   226,
+     228,   230,   233
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "\"end of file\"", "error", "$undefined", "VARIABLE", "FVARIABLE",
-  "CONSTANT", "FCONSTANT", "CREATE", "ALLOT", "NONAME", "EXIT", "IF",
-  "THEN", "ENDIF", "ELSE", "DO", "\"?DO\"", "LOOP", "\"+LOOP\"", "LEAVE",
-  "\"?LEAVE\"", "\"BEGIN\"", "UNTIL", "WHILE", "REPEAT", "AGAIN", "CASE",
-  "OF", "ENDOF", "ENDCASE", "RECURSE", "\"print string\"",
-  "\"counted string\"", "\"abort string\"", "\"compilation comment\"",
-  "\"integer\"", "\"literal string\"", "\"float\"", "\"char literal\"",
-  "\"address\"", "\"word\"", "CODE", "\"assembler string\"",
-  "\"END-CODE\"", "\"[IFDEF]\"", "\"[IFUNDEF]\"", "\"[ELSE]\"",
-  "\"[THEN]\"", "\"[ENDIF]\"", "':'", "';'", "$accept", "program",
-  "elements", "element", "declaration", "statements", "definition",
-  "semicolon_", "definedword", "noname", "codeword", "codes", "code",
-  "end_code_", "statement", "conditional", "if_statement", "if_",
+  "\"end of file\"", "error", "\"invalid token\"", "VARIABLE",
+  "FVARIABLE", "CONSTANT", "FCONSTANT", "CREATE", "ALLOT", "NONAME",
+  "EXIT", "IF", "THEN", "ENDIF", "ELSE", "DO", "\"?DO\"", "LOOP",
+  "\"+LOOP\"", "LEAVE", "\"?LEAVE\"", "\"BEGIN\"", "UNTIL", "WHILE",
+  "REPEAT", "AGAIN", "CASE", "OF", "ENDOF", "ENDCASE", "RECURSE",
+  "\"print string\"", "\"counted string\"", "\"abort string\"",
+  "\"compilation comment\"", "\"integer\"", "\"literal string\"",
+  "\"float\"", "\"char literal\"", "\"address\"", "\"word\"", "CODE",
+  "\"assembler string\"", "\"END-CODE\"", "\"[IFDEF]\"", "\"[IFUNDEF]\"",
+  "\"[ELSE]\"", "\"[THEN]\"", "\"[ENDIF]\"", "':'", "';'", "$accept",
+  "program", "elements", "element", "declaration", "statements",
+  "definition", "semicolon_", "definedword", "noname", "codeword", "codes",
+  "code", "end_code_", "statement", "conditional", "if_statement", "if_",
   "then_endif_", "else_", "do_loop", "do_", "loop_", "plus_loop_",
   "do_leave", "begin_loop", "begin_", "until_", "repeat_again_",
   "begin_while", "case_statement", "casebody", "caseclause", "case_",
-  "endcase_", "of_", "endof_", "recurse", 0
+  "endcase_", "of_", "endof_", "recurse", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,    58,
-      59
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
-{
-       0,    51,    52,    53,    53,    54,    54,    54,    54,    55,
-      55,    55,    55,    55,    55,    56,    56,    57,    57,    57,
-      58,    59,    60,    61,    62,    62,    63,    64,    65,    65,
-      65,    65,    65,    65,    65,    65,    65,    65,    65,    65,
-      65,    65,    65,    65,    65,    65,    65,    65,    66,    66,
-      66,    66,    66,    67,    67,    68,    69,    69,    70,    71,
-      71,    72,    72,    73,    74,    75,    75,    76,    76,    77,
-      78,    79,    79,    80,    81,    82,    82,    83,    84,    85,
-      86,    87,    88
-};
+#define YYPACT_NINF (-84)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
-{
-       0,     2,     2,     0,     2,     1,     1,     1,     2,     2,
-       2,     2,     2,     5,     4,     0,     2,     4,     3,     4,
-       1,     1,     1,     1,     1,     2,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
-       1,     1,     1,     3,     5,     1,     1,     1,     1,     3,
-       3,     1,     1,     1,     1,     1,     1,     3,     3,     1,
-       1,     1,     1,     1,     4,     1,     2,     4,     1,     1,
-       1,     1,     1
-};
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint8 yydefact[] =
-{
-       3,     0,     0,     1,     2,     0,     0,     0,     0,     0,
-       0,    46,    22,    36,    55,    61,    62,    65,    66,    69,
-      73,    78,    82,    37,    38,    39,    40,    41,    43,    42,
-      44,    45,    47,     0,     0,     0,    52,    50,    51,     0,
-       4,     6,     5,    15,     7,    28,    29,    15,    30,    15,
-      31,    32,    15,    33,    34,    15,    35,     8,     9,    10,
-      11,    12,     0,    23,     0,    48,    49,    21,    15,     0,
-       0,     0,     0,     0,    15,    75,     0,    26,     0,    24,
-       0,    20,    18,    16,    56,    57,    58,    53,    15,    63,
-      64,    59,    60,    70,    71,    72,    67,    68,    80,    15,
-       0,    76,    14,     0,    27,    25,    19,    17,     0,     0,
-      79,    74,    13,    54,    81,    77
-};
+#define YYTABLE_NINF (-1)
 
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int8 yydefgoto[] =
-{
-      -1,     1,     2,    40,    41,    69,    42,    82,    68,    43,
-      64,    78,    79,   106,    83,    45,    46,    47,    87,    88,
-      48,    49,    91,    92,    50,    51,    52,    96,    97,    53,
-      54,    74,    75,    55,   111,    99,   115,    56
-};
+#define yytable_value_is_error(Yyn) \
+  0
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -84
 static const yytype_int16 yypact[] =
 {
      -84,     1,    28,   -84,   -84,   -34,   -33,   -31,   -29,   -28,
@@ -723,6 +726,25 @@ static const yytype_int16 yypact[] =
      -84,   -84,   -84,   -84,   -84,   -84
 };
 
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       3,     0,     0,     1,     2,     0,     0,     0,     0,     0,
+       0,    46,    22,    36,    55,    61,    62,    65,    66,    69,
+      73,    78,    82,    37,    38,    39,    40,    41,    43,    42,
+      44,    45,    47,     0,     0,     0,    52,    50,    51,     0,
+       4,     6,     5,    15,     7,    28,    29,    15,    30,    15,
+      31,    32,    15,    33,    34,    15,    35,     8,     9,    10,
+      11,    12,     0,    23,     0,    48,    49,    21,    15,     0,
+       0,     0,     0,     0,    15,    75,     0,    26,     0,    24,
+       0,    20,    18,    16,    56,    57,    58,    53,    15,    63,
+      64,    59,    60,    70,    71,    72,    67,    68,    80,    15,
+       0,    76,    14,     0,    27,    25,    19,    17,     0,     0,
+      79,    74,    13,    54,    81,    77
+};
+
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
@@ -732,11 +754,19 @@ static const yytype_int8 yypgoto[] =
      -84,   -84,   -48,   -84,   -84,   -84,   -84,   -84
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     1,     2,    40,    41,    69,    42,    82,    68,    43,
+      64,    78,    79,   106,    83,    45,    46,    47,    87,    88,
+      48,    49,    91,    92,    50,    51,    52,    96,    97,    53,
+      54,    74,    75,    55,   111,    99,   115,    56
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -1
-static const yytype_uint8 yytable[] =
+static const yytype_int8 yytable[] =
 {
       70,     3,    71,    77,   104,    72,    57,    58,    73,    59,
      102,    60,    61,    62,    63,    65,    66,    67,    76,   112,
@@ -781,12 +811,6 @@ static const yytype_uint8 yytable[] =
        0,    34,    35,    36,    37,    38
 };
 
-#define yypact_value_is_default(yystate) \
-  ((yystate) == (-84))
-
-#define yytable_value_is_error(yytable_value) \
-  YYID (0)
-
 static const yytype_int8 yycheck[] =
 {
       47,     0,    49,    42,    43,    52,    40,    40,    55,    40,
@@ -832,9 +856,9 @@ static const yytype_int8 yycheck[] =
       -1,    44,    45,    46,    47,    48
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
        0,    52,    53,     0,     0,     1,     3,     4,     5,     6,
        7,     8,     9,    10,    11,    15,    16,    19,    20,    21,
@@ -850,94 +874,69 @@ static const yytype_uint8 yystos[] =
       29,    85,     8,    69,    28,    87
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    51,    52,    53,    53,    54,    54,    54,    54,    55,
+      55,    55,    55,    55,    55,    56,    56,    57,    57,    57,
+      58,    59,    60,    61,    62,    62,    63,    64,    65,    65,
+      65,    65,    65,    65,    65,    65,    65,    65,    65,    65,
+      65,    65,    65,    65,    65,    65,    65,    65,    66,    66,
+      66,    66,    66,    67,    67,    68,    69,    69,    70,    71,
+      71,    72,    72,    73,    74,    75,    75,    76,    76,    77,
+      78,    79,    79,    80,    81,    82,    82,    83,    84,    85,
+      86,    87,    88
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     2,     0,     2,     1,     1,     1,     2,     2,
+       2,     2,     2,     5,     4,     0,     2,     4,     3,     4,
+       1,     1,     1,     1,     1,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
+       1,     1,     1,     3,     5,     1,     1,     1,     1,     3,
+       3,     1,     1,     1,     1,     1,     1,     3,     3,     1,
+       1,     1,     1,     1,     4,     1,     2,     4,     1,     1,
+       1,     1,     1
+};
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
 
+enum { YYENOMEM = -2 };
 
-/* This macro is provided for backward compatibility. */
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (parser, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -947,80 +946,59 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, parser); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, Parser * parser)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (parser);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, Parser * parser)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, parser);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1028,16 +1006,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
 static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1048,63 +1018,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, Parser * parser)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], parser);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, parser); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -1120,365 +1083,84 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (0, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  YYSIZE_T yysize1;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = 0;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-                if (! (yysize <= yysize1
-                       && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                  return 2;
-                yysize = yysize1;
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
-
-  yysize1 = yysize + yystrlen (yyformat);
-  if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-    return 2;
-  yysize = yysize1;
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, Parser * parser)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
+  YY_USE (parser);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-  switch (yytype)
-    {
-
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/* Prevent warnings from -Wmissing-prototypes.  */
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
 
 
-/* The lookahead symbol.  */
-int yychar;
-
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
-
-/* Number of syntax errors so far.  */
-int yynerrs;
 
 
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
 int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
+yyparse (Parser * parser)
 {
-    int yystate;
-    /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
 
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
-       Refer to the stacks thru separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -1486,111 +1168,107 @@ yyparse ()
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yytoken = 0;
-  yyss = yyssa;
-  yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-  yyssp = yyss;
-  yyvsp = yyvs;
-
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -1601,18 +1279,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, parser);
     }
 
-  if (yychar <= YYEOF)
+  if (yychar <= END)
     {
-      yychar = yytoken = YYEOF;
+      yychar = END;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1640,13 +1329,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1661,14 +1350,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -1681,369 +1370,317 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-
-/* Line 1806 of yacc.c  */
-#line 97 "forth.y"
-    { MNE; parser_->f_end_of_file (); }
+  case 2: /* program: elements "end of file"  */
+#line 103 "forth.y"
+                               { MNE; parser->f_end_of_file (); }
+#line 1377 "forth.tab.cc"
     break;
 
-  case 8:
-
-/* Line 1806 of yacc.c  */
-#line 107 "forth.y"
-    { MNE; yyerrok; }
-    break;
-
-  case 9:
-
-/* Line 1806 of yacc.c  */
-#line 110 "forth.y"
-    { MNE; P(parser_->f_definedvariable ((yyvsp[(2) - (2)]))); }
-    break;
-
-  case 10:
-
-/* Line 1806 of yacc.c  */
-#line 111 "forth.y"
-    { MNE; P(parser_->f_definedvariable ((yyvsp[(2) - (2)]))); }
-    break;
-
-  case 11:
-
-/* Line 1806 of yacc.c  */
-#line 112 "forth.y"
-    { MNE; P(parser_->f_definedconstant ((yyvsp[(2) - (2)]))); }
-    break;
-
-  case 12:
-
-/* Line 1806 of yacc.c  */
+  case 8: /* element: error "word"  */
 #line 113 "forth.y"
-    { MNE; P(parser_->f_definedfconstant ((yyvsp[(2) - (2)]))); }
-    break;
-
-  case 13:
-
-/* Line 1806 of yacc.c  */
-#line 114 "forth.y"
-    { MNE;
-                                      P(parser_->f_definedarray ((yyvsp[(2) - (5)]), (yyvsp[(3) - (5)]), (yyvsp[(4) - (5)]))); }
+                             { MNE; yyerrok; }
+#line 1383 "forth.tab.cc"
     break;
 
-  case 14:
-
-/* Line 1806 of yacc.c  */
+  case 9: /* declaration: VARIABLE "word"  */
 #line 116 "forth.y"
-    { MNE;
-                                      P(parser_->f_definedarray ((yyvsp[(2) - (4)]), (yyvsp[(3) - (4)]))); }
+                                { MNE; P(parser->f_definedvariable (yyvsp[0])); }
+#line 1389 "forth.tab.cc"
     break;
 
-  case 20:
-
-/* Line 1806 of yacc.c  */
-#line 128 "forth.y"
-    { MNE; P(parser_->f_semicolon ()); }
+  case 10: /* declaration: FVARIABLE "word"  */
+#line 117 "forth.y"
+                                 { MNE; P(parser->f_definedvariable (yyvsp[0])); }
+#line 1395 "forth.tab.cc"
     break;
 
-  case 21:
-
-/* Line 1806 of yacc.c  */
-#line 130 "forth.y"
-    { MNE; P(parser_->f_definedword ((yyvsp[(1) - (1)]))); }
+  case 11: /* declaration: CONSTANT "word"  */
+#line 118 "forth.y"
+                                { MNE; P(parser->f_definedconstant (yyvsp[0])); }
+#line 1401 "forth.tab.cc"
     break;
 
-  case 22:
-
-/* Line 1806 of yacc.c  */
-#line 132 "forth.y"
-    { MNE; P(parser_->f_nonameword ()); }
+  case 12: /* declaration: FCONSTANT "word"  */
+#line 119 "forth.y"
+                                 { MNE; P(parser->f_definedfconstant (yyvsp[0])); }
+#line 1407 "forth.tab.cc"
     break;
 
-  case 23:
-
-/* Line 1806 of yacc.c  */
-#line 134 "forth.y"
-    { MNE; P(parser_->f_codeword ((yyvsp[(1) - (1)]))); }
-    break;
-
-  case 26:
-
-/* Line 1806 of yacc.c  */
-#line 139 "forth.y"
-    { MNE; P(parser_->f_code ((yyvsp[(1) - (1)]))); }
+  case 13: /* declaration: CREATE "word" "integer" "word" ALLOT  */
+#line 120 "forth.y"
+                                                         { MNE;
+                                      P(parser->f_definedarray (yyvsp[-3], yyvsp[-2], yyvsp[-1])); }
+#line 1414 "forth.tab.cc"
     break;
 
-  case 27:
-
-/* Line 1806 of yacc.c  */
-#line 141 "forth.y"
-    { MNE; P(parser_->f_end_code ()); }
+  case 14: /* declaration: CREATE "word" "integer" ALLOT  */
+#line 122 "forth.y"
+                                                    { MNE;
+                                      P(parser->f_definedarray (yyvsp[-2], yyvsp[-1])); }
+#line 1421 "forth.tab.cc"
     break;
 
-  case 36:
-
-/* Line 1806 of yacc.c  */
-#line 152 "forth.y"
-    { MNE; P(parser_->f_exit ()); }
+  case 20: /* semicolon_: ';'  */
+#line 134 "forth.y"
+                      { MNE; P(parser->f_semicolon ()); }
+#line 1427 "forth.tab.cc"
     break;
 
-  case 37:
-
-/* Line 1806 of yacc.c  */
-#line 153 "forth.y"
-    { MNE; P(parser_->f_pstring ((yyvsp[(1) - (1)]))); }
+  case 21: /* definedword: "word"  */
+#line 136 "forth.y"
+                       { MNE; P(parser->f_definedword (yyvsp[0])); }
+#line 1433 "forth.tab.cc"
     break;
 
-  case 38:
-
-/* Line 1806 of yacc.c  */
-#line 154 "forth.y"
-    { MNE; P(parser_->f_cstring ((yyvsp[(1) - (1)]))); }
+  case 22: /* noname: NONAME  */
+#line 138 "forth.y"
+                         { MNE; P(parser->f_nonameword ()); }
+#line 1439 "forth.tab.cc"
     break;
 
-  case 39:
-
-/* Line 1806 of yacc.c  */
-#line 155 "forth.y"
-    { MNE; P(parser_->f_astring ((yyvsp[(1) - (1)]))); }
+  case 23: /* codeword: "word"  */
+#line 140 "forth.y"
+                       { MNE; P(parser->f_codeword (yyvsp[0])); }
+#line 1445 "forth.tab.cc"
     break;
 
-  case 40:
-
-/* Line 1806 of yacc.c  */
-#line 156 "forth.y"
-    { MNE; P(parser_->f_dotparenstring ((yyvsp[(1) - (1)]))); }
+  case 26: /* code: "assembler string"  */
+#line 145 "forth.y"
+                      { MNE; P(parser->f_code (yyvsp[0])); }
+#line 1451 "forth.tab.cc"
     break;
 
-  case 41:
-
-/* Line 1806 of yacc.c  */
-#line 157 "forth.y"
-    { MNE; P(parser_->f_integer_literal ((yyvsp[(1) - (1)]))); }
+  case 27: /* end_code_: "END-CODE"  */
+#line 147 "forth.y"
+                           { MNE; P(parser->f_end_code ()); }
+#line 1457 "forth.tab.cc"
     break;
 
-  case 42:
-
-/* Line 1806 of yacc.c  */
+  case 36: /* statement: EXIT  */
 #line 158 "forth.y"
-    { MNE; P(parser_->f_float_literal ((yyvsp[(1) - (1)]))); }
+                       { MNE; P(parser->f_exit ()); }
+#line 1463 "forth.tab.cc"
     break;
 
-  case 43:
-
-/* Line 1806 of yacc.c  */
+  case 37: /* statement: "print string"  */
 #line 159 "forth.y"
-    { MNE; P(parser_->f_string_literal ((yyvsp[(1) - (1)]))); }
+                          { MNE; P(parser->f_pstring (yyvsp[0])); }
+#line 1469 "forth.tab.cc"
     break;
 
-  case 44:
-
-/* Line 1806 of yacc.c  */
+  case 38: /* statement: "counted string"  */
 #line 160 "forth.y"
-    { MNE; P(parser_->f_char_literal ((yyvsp[(1) - (1)]))); }
+                          { MNE; P(parser->f_cstring (yyvsp[0])); }
+#line 1475 "forth.tab.cc"
     break;
 
-  case 45:
-
-/* Line 1806 of yacc.c  */
+  case 39: /* statement: "abort string"  */
 #line 161 "forth.y"
-    { MNE; P(parser_->f_object_address ((yyvsp[(1) - (1)]))); }
+                          { MNE; P(parser->f_astring (yyvsp[0])); }
+#line 1481 "forth.tab.cc"
     break;
 
-  case 46:
-
-/* Line 1806 of yacc.c  */
+  case 40: /* statement: "compilation comment"  */
 #line 162 "forth.y"
-    { MNE; P(parser_->f_word ((yyvsp[(1) - (1)]))); }
+                                 { MNE; P(parser->f_dotparenstring (yyvsp[0])); }
+#line 1487 "forth.tab.cc"
     break;
 
-  case 47:
-
-/* Line 1806 of yacc.c  */
+  case 41: /* statement: "integer"  */
 #line 163 "forth.y"
-    { MNE; P(parser_->f_word ((yyvsp[(1) - (1)]))); }
+                                  { MNE; P(parser->f_integer_literal (yyvsp[0])); }
+#line 1493 "forth.tab.cc"
+    break;
+
+  case 42: /* statement: "float"  */
+#line 164 "forth.y"
+                                { MNE; P(parser->f_float_literal (yyvsp[0])); }
+#line 1499 "forth.tab.cc"
     break;
 
-  case 48:
+  case 43: /* statement: "literal string"  */
+#line 165 "forth.y"
+                                 { MNE; P(parser->f_string_literal (yyvsp[0])); }
+#line 1505 "forth.tab.cc"
+    break;
 
-/* Line 1806 of yacc.c  */
+  case 44: /* statement: "char literal"  */
 #line 166 "forth.y"
-    { MNE; parser_->f_cond_ifdef ((yyvsp[(1) - (2)]), false); }
+                               { MNE; P(parser->f_char_literal (yyvsp[0])); }
+#line 1511 "forth.tab.cc"
     break;
 
-  case 49:
-
-/* Line 1806 of yacc.c  */
+  case 45: /* statement: "address"  */
 #line 167 "forth.y"
-    { MNE; parser_->f_cond_ifdef ((yyvsp[(1) - (2)]), true); }
+                                 { MNE; P(parser->f_object_address (yyvsp[0])); }
+#line 1517 "forth.tab.cc"
     break;
 
-  case 50:
-
-/* Line 1806 of yacc.c  */
+  case 46: /* statement: ALLOT  */
 #line 168 "forth.y"
-    { MNE; parser_->f_cond_then_endif (false); }
+                        { MNE; P(parser->f_word (yyvsp[0])); }
+#line 1523 "forth.tab.cc"
     break;
 
-  case 51:
-
-/* Line 1806 of yacc.c  */
+  case 47: /* statement: "word"  */
 #line 169 "forth.y"
-    { MNE; parser_->f_cond_then_endif (true); }
+                        { MNE; P(parser->f_word (yyvsp[0])); }
+#line 1529 "forth.tab.cc"
     break;
 
-  case 52:
-
-/* Line 1806 of yacc.c  */
-#line 170 "forth.y"
-    { MNE; parser_->f_cond_else (); }
+  case 48: /* conditional: "[IFDEF]" "word"  */
+#line 172 "forth.y"
+                                  { MNE; parser->f_cond_ifdef (yyvsp[-1], false); }
+#line 1535 "forth.tab.cc"
     break;
 
-  case 55:
-
-/* Line 1806 of yacc.c  */
-#line 176 "forth.y"
-    { MNE; P(parser_->f_if ()); }
+  case 49: /* conditional: "[IFUNDEF]" "word"  */
+#line 173 "forth.y"
+                                    { MNE; parser->f_cond_ifdef (yyvsp[-1], true); }
+#line 1541 "forth.tab.cc"
     break;
 
-  case 56:
-
-/* Line 1806 of yacc.c  */
-#line 178 "forth.y"
-    { MNE; P(parser_->f_then_endif ()); }
+  case 50: /* conditional: "[THEN]"  */
+#line 174 "forth.y"
+                            { MNE; parser->f_cond_then_endif (false); }
+#line 1547 "forth.tab.cc"
     break;
 
-  case 57:
-
-/* Line 1806 of yacc.c  */
-#line 179 "forth.y"
-    { MNE; P(parser_->f_then_endif ()); }
+  case 51: /* conditional: "[ENDIF]"  */
+#line 175 "forth.y"
+                             { MNE; parser->f_cond_then_endif (true); }
+#line 1553 "forth.tab.cc"
     break;
 
-  case 58:
-
-/* Line 1806 of yacc.c  */
-#line 181 "forth.y"
-    { MNE; P(parser_->f_else ()); }
+  case 52: /* conditional: "[ELSE]"  */
+#line 176 "forth.y"
+                            { MNE; parser->f_cond_else (); }
+#line 1559 "forth.tab.cc"
     break;
 
-  case 61:
-
-/* Line 1806 of yacc.c  */
-#line 187 "forth.y"
-    { MNE; P(parser_->f_do ()); }
+  case 55: /* if_: IF  */
+#line 182 "forth.y"
+                     { MNE; P(parser->f_if ()); }
+#line 1565 "forth.tab.cc"
     break;
 
-  case 62:
-
-/* Line 1806 of yacc.c  */
-#line 188 "forth.y"
-    { MNE; P(parser_->f_query_do ()); }
+  case 56: /* then_endif_: THEN  */
+#line 184 "forth.y"
+                       { MNE; P(parser->f_then_endif ()); }
+#line 1571 "forth.tab.cc"
     break;
 
-  case 63:
-
-/* Line 1806 of yacc.c  */
-#line 190 "forth.y"
-    { MNE; P(parser_->f_loop ()); }
+  case 57: /* then_endif_: ENDIF  */
+#line 185 "forth.y"
+                        { MNE; P(parser->f_then_endif ()); }
+#line 1577 "forth.tab.cc"
     break;
 
-  case 64:
-
-/* Line 1806 of yacc.c  */
-#line 192 "forth.y"
-    { MNE; P(parser_->f_plus_loop ()); }
+  case 58: /* else_: ELSE  */
+#line 187 "forth.y"
+                       { MNE; P(parser->f_else ()); }
+#line 1583 "forth.tab.cc"
     break;
 
-  case 65:
+  case 61: /* do_: DO  */
+#line 193 "forth.y"
+                     { MNE; P(parser->f_do ()); }
+#line 1589 "forth.tab.cc"
+    break;
 
-/* Line 1806 of yacc.c  */
+  case 62: /* do_: "?DO"  */
 #line 194 "forth.y"
-    { MNE; P(parser_->f_leave ()); }
+                           { MNE; P(parser->f_query_do ()); }
+#line 1595 "forth.tab.cc"
     break;
 
-  case 66:
+  case 63: /* loop_: LOOP  */
+#line 196 "forth.y"
+                       { MNE; P(parser->f_loop ()); }
+#line 1601 "forth.tab.cc"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 195 "forth.y"
-    { MNE; P(parser_->f_query_leave ()); }
+  case 64: /* plus_loop_: "+LOOP"  */
+#line 198 "forth.y"
+                            { MNE; P(parser->f_plus_loop ()); }
+#line 1607 "forth.tab.cc"
     break;
 
-  case 69:
+  case 65: /* do_leave: LEAVE  */
+#line 200 "forth.y"
+                        { MNE; P(parser->f_leave ()); }
+#line 1613 "forth.tab.cc"
+    break;
 
-/* Line 1806 of yacc.c  */
+  case 66: /* do_leave: "?LEAVE"  */
 #line 201 "forth.y"
-    { MNE; P(parser_->f_begin ()); }
+                              { MNE; P(parser->f_query_leave ()); }
+#line 1619 "forth.tab.cc"
     break;
 
-  case 70:
-
-/* Line 1806 of yacc.c  */
-#line 203 "forth.y"
-    { MNE; P(parser_->f_until ()); }
+  case 69: /* begin_: "BEGIN"  */
+#line 207 "forth.y"
+                         { MNE; P(parser->f_begin ()); }
+#line 1625 "forth.tab.cc"
     break;
 
-  case 71:
-
-/* Line 1806 of yacc.c  */
-#line 205 "forth.y"
-    { MNE; P(parser_->f_repeat_again ()); }
+  case 70: /* until_: UNTIL  */
+#line 209 "forth.y"
+                        { MNE; P(parser->f_until ()); }
+#line 1631 "forth.tab.cc"
     break;
 
-  case 72:
-
-/* Line 1806 of yacc.c  */
-#line 206 "forth.y"
-    { MNE; P(parser_->f_repeat_again ()); }
+  case 71: /* repeat_again_: REPEAT  */
+#line 211 "forth.y"
+                         { MNE; P(parser->f_repeat_again ()); }
+#line 1637 "forth.tab.cc"
     break;
 
-  case 73:
-
-/* Line 1806 of yacc.c  */
-#line 208 "forth.y"
-    { MNE; P(parser_->f_while ()); }
+  case 72: /* repeat_again_: AGAIN  */
+#line 212 "forth.y"
+                        { MNE; P(parser->f_repeat_again ()); }
+#line 1643 "forth.tab.cc"
     break;
 
-  case 78:
-
-/* Line 1806 of yacc.c  */
-#line 218 "forth.y"
-    { MNE; P(parser_->f_case ()); }
+  case 73: /* begin_while: WHILE  */
+#line 214 "forth.y"
+                        { MNE; P(parser->f_while ()); }
+#line 1649 "forth.tab.cc"
     break;
 
-  case 79:
-
-/* Line 1806 of yacc.c  */
-#line 220 "forth.y"
-    { MNE; P(parser_->f_endcase ()); }
+  case 78: /* case_: CASE  */
+#line 224 "forth.y"
+                       { MNE; P(parser->f_case ()); }
+#line 1655 "forth.tab.cc"
     break;
 
-  case 80:
-
-/* Line 1806 of yacc.c  */
-#line 222 "forth.y"
-    { MNE; P(parser_->f_of ()); }
+  case 79: /* endcase_: ENDCASE  */
+#line 226 "forth.y"
+                          { MNE; P(parser->f_endcase ()); }
+#line 1661 "forth.tab.cc"
     break;
 
-  case 81:
-
-/* Line 1806 of yacc.c  */
-#line 224 "forth.y"
-    { MNE; P(parser_->f_endof ()); }
+  case 80: /* of_: OF  */
+#line 228 "forth.y"
+                     { MNE; P(parser->f_of ()); }
+#line 1667 "forth.tab.cc"
     break;
 
-  case 82:
+  case 81: /* endof_: ENDOF  */
+#line 230 "forth.y"
+                        { MNE; P(parser->f_endof ()); }
+#line 1673 "forth.tab.cc"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 227 "forth.y"
-    { MNE; P(parser_->f_recurse ()); }
+  case 82: /* recurse: RECURSE  */
+#line 233 "forth.y"
+                          { MNE; P(parser->f_recurse ()); }
+#line 1679 "forth.tab.cc"
     break;
 
 
+#line 1683 "forth.tab.cc"
 
-/* Line 1806 of yacc.c  */
-#line 2047 "forth.tab.cc"
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -2057,96 +1694,58 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
+      yyerror (parser, YY_("syntax error"));
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
-
-      if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+         error, discard it.  */
+
+      if (yychar <= END)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == END)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, parser);
+          yychar = YYEMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -2158,14 +1757,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -2178,39 +1776,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, parser);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -2221,59 +1822,55 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined(yyoverflow) || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
+  yyerror (parser, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval);
+                  yytoken, &yylval, parser);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, parser);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
 
+  return yyresult;
+}
 
-
-/* Line 2067 of yacc.c  */
-#line 229 "forth.y"
-
+#line 235 "forth.y"
 
@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2011 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,68 +27,87 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_FORTH_TAB_HH_INCLUDED
+# define YY_YY_FORTH_TAB_HH_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
 
-/* Tokens.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     END = 0,
-     VARIABLE = 258,
-     FVARIABLE = 259,
-     CONSTANT = 260,
-     FCONSTANT = 261,
-     CREATE = 262,
-     ALLOT = 263,
-     NONAME = 264,
-     EXIT = 265,
-     IF = 266,
-     THEN = 267,
-     ENDIF = 268,
-     ELSE = 269,
-     DO = 270,
-     QUERY_DO = 271,
-     LOOP = 272,
-     PLUS_LOOP = 273,
-     LEAVE = 274,
-     QUERY_LEAVE = 275,
-     BEGIN_ = 276,
-     UNTIL = 277,
-     WHILE = 278,
-     REPEAT = 279,
-     AGAIN = 280,
-     CASE = 281,
-     OF = 282,
-     ENDOF = 283,
-     ENDCASE = 284,
-     RECURSE = 285,
-     PSTRING = 286,
-     CSTRING = 287,
-     ASTRING = 288,
-     DOTPARENSTRING = 289,
-     INTEGER_LITERAL = 290,
-     STRING_LITERAL = 291,
-     FLOAT_LITERAL = 292,
-     CHAR_LITERAL = 293,
-     OBJECT_ADDRESS = 294,
-     WORD = 295,
-     CODE = 296,
-     ASM = 297,
-     END_CODE = 298,
-     COND_IFDEF = 299,
-     COND_IFUNDEF = 300,
-     COND_ELSE = 301,
-     COND_THEN = 302,
-     COND_ENDIF = 303
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    END = 0,                       /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    VARIABLE = 258,                /* VARIABLE  */
+    FVARIABLE = 259,               /* FVARIABLE  */
+    CONSTANT = 260,                /* CONSTANT  */
+    FCONSTANT = 261,               /* FCONSTANT  */
+    CREATE = 262,                  /* CREATE  */
+    ALLOT = 263,                   /* ALLOT  */
+    NONAME = 264,                  /* NONAME  */
+    EXIT = 265,                    /* EXIT  */
+    IF = 266,                      /* IF  */
+    THEN = 267,                    /* THEN  */
+    ENDIF = 268,                   /* ENDIF  */
+    ELSE = 269,                    /* ELSE  */
+    DO = 270,                      /* DO  */
+    QUERY_DO = 271,                /* "?DO"  */
+    LOOP = 272,                    /* LOOP  */
+    PLUS_LOOP = 273,               /* "+LOOP"  */
+    LEAVE = 274,                   /* LEAVE  */
+    QUERY_LEAVE = 275,             /* "?LEAVE"  */
+    BEGIN_ = 276,                  /* "BEGIN"  */
+    UNTIL = 277,                   /* UNTIL  */
+    WHILE = 278,                   /* WHILE  */
+    REPEAT = 279,                  /* REPEAT  */
+    AGAIN = 280,                   /* AGAIN  */
+    CASE = 281,                    /* CASE  */
+    OF = 282,                      /* OF  */
+    ENDOF = 283,                   /* ENDOF  */
+    ENDCASE = 284,                 /* ENDCASE  */
+    RECURSE = 285,                 /* RECURSE  */
+    PSTRING = 286,                 /* "print string"  */
+    CSTRING = 287,                 /* "counted string"  */
+    ASTRING = 288,                 /* "abort string"  */
+    DOTPARENSTRING = 289,          /* "compilation comment"  */
+    INTEGER_LITERAL = 290,         /* "integer"  */
+    STRING_LITERAL = 291,          /* "literal string"  */
+    FLOAT_LITERAL = 292,           /* "float"  */
+    CHAR_LITERAL = 293,            /* "char literal"  */
+    OBJECT_ADDRESS = 294,          /* "address"  */
+    WORD = 295,                    /* "word"  */
+    CODE = 296,                    /* CODE  */
+    ASM = 297,                     /* "assembler string"  */
+    END_CODE = 298,                /* "END-CODE"  */
+    COND_IFDEF = 299,              /* "[IFDEF]"  */
+    COND_IFUNDEF = 300,            /* "[IFUNDEF]"  */
+    COND_ELSE = 301,               /* "[ELSE]"  */
+    COND_THEN = 302,               /* "[THEN]"  */
+    COND_ENDIF = 303               /* "[ENDIF]"  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
 #define END 0
+#define YYerror 256
+#define YYUNDEF 257
 #define VARIABLE 258
 #define FVARIABLE 259
 #define CONSTANT 260
@@ -135,16 +155,17 @@
 #define COND_THEN 302
 #define COND_ENDIF 303
 
-
-
-
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 typedef int YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
-extern YYSTYPE yylval;
 
 
+
+int yyparse (Parser * parser);
+
+
+#endif /* !YY_YY_FORTH_TAB_HH_INCLUDED  */
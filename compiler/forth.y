@@ -24,12 +24,8 @@
 
 #include "parser.h"
 
-#define YYSTYPE char *
+#define YYSTYPE const char *
 #define YYERROR_VERBOSE 1
-extern int yylex ();
-
-// External definition of active parser for non-OO yacc/lex code.
-extern Parser * parser_;
 
 // Macro to cause yyparse to abort if the maximum number of allowable errors
 // has been exceeded.  This is an icky thing to have to do, but the closed
@@ -39,9 +35,9 @@ extern Parser * parser_;
 // the time that happens.  All in all, rather unpleasant.
 #define MNE                                               \
   do {                                                    \
-    if (parser_->excessive_errors ())                     \
+    if (parser->excessive_errors ())                      \
       {                                                   \
-        parser_->parse_error ()                           \
+        parser->parse_error ()                            \
             << "too many errors, giving up" << std::endl; \
         YYABORT;                                          \
       }                                                   \
@@ -51,18 +47,25 @@ extern Parser * parser_;
 // conditional processing indicates that the code being parsed is inactive.
 #define P(TERMINAL_HANDLER)                               \
   do {                                                    \
-    if (parser_->cond_state ())                           \
+    if (parser->cond_state ())                            \
       {                                                   \
         TERMINAL_HANDLER;                                 \
       }                                                   \
   } while (0)
 
-// yyerror function links to the parser's error reporting.
+// yylex and yyerror functions link to the parser's scanner and error
+// reporting.  The parser is pure, so all parse state is in yyparse's
+// frame and the Parser it is given.
 namespace {
 
-void yyerror (const char * message)
+int yylex (const char ** text, Parser * parser)
+{
+  return parser->scan (text);
+}
+
+void yyerror (Parser * parser, const char * message)
 {
-  parser_->parse_error () << message << std::endl;
+  parser->parse_error () << message << std::endl;
 }
 
 } // namespace
@@ -70,6 +73,9 @@ void yyerror (const char * message)
 %}
 
 %debug
+%define api.pure full
+%parse-param {Parser * parser}
+%lex-param {Parser * parser}
 %token VARIABLE FVARIABLE CONSTANT FCONSTANT
 %token CREATE ALLOT
 %token NONAME EXIT
@@ -94,7 +100,7 @@ void yyerror (const char * message)
 %token END 0 "end of file"
 
 %%
-program:          elements END { MNE; parser_->f_end_of_file (); }
+program:          elements END { MNE; parser->f_end_of_file (); }
                 ;
 
 elements:
@@ -107,14 +113,14 @@ element:          definition
                 | error WORD { MNE; yyerrok; }
                 ;
 
-declaration:      VARIABLE WORD { MNE; P(parser_->f_definedvariable ($2)); }
-                | FVARIABLE WORD { MNE; P(parser_->f_definedvariable ($2)); }
-                | CONSTANT WORD { MNE; P(parser_->f_definedconstant ($2)); }
-                | FCONSTANT WORD { MNE; P(parser_->f_definedfconstant ($2)); }
+declaration:      VARIABLE WORD { MNE; P(parser->f_definedvariable ($2)); }
+                | FVARIABLE WORD { MNE; P(parser->f_definedvariable ($2)); }
+                | CONSTANT WORD { MNE; P(parser->f_definedconstant ($2)); }
+                | FCONSTANT WORD { MNE; P(parser->f_definedfconstant ($2)); }
                 | CREATE WORD INTEGER_LITERAL WORD ALLOT { MNE;
-                                      P(parser_->f_definedarray ($2, $3, $4)); }
+                                      P(parser->f_definedarray ($2, $3, $4)); }
                 | CREATE WORD INTEGER_LITERAL ALLOT { MNE;
-                                      P(parser_->f_definedarray ($2, $3)); }
+                                      P(parser->f_definedarray ($2, $3)); }
                 ;
 
 statements:
@@ -125,20 +131,20 @@ definition:       ':' definedword statements semicolon_
                 | noname statements semicolon_
                 | CODE codeword codes end_code_
                 ;
-semicolon_:       ';' { MNE; P(parser_->f_semicolon ()); }
+semicolon_:       ';' { MNE; P(parser->f_semicolon ()); }
                 ;
-definedword:      WORD { MNE; P(parser_->f_definedword ($1)); }
+definedword:      WORD { MNE; P(parser->f_definedword ($1)); }
                 ;
-noname:           NONAME { MNE; P(parser_->f_nonameword ()); }
+noname:           NONAME { MNE; P(parser->f_nonameword ()); }
                 ;
-codeword:         WORD { MNE; P(parser_->f_codeword ($1)); }
+codeword:         WORD { MNE; P(parser->f_codeword ($1)); }
                 ;
 codes:            code
                 | codes code
                 ;
-code:             ASM { MNE; P(parser_->f_code ($1)); }
+code:             ASM { MNE; P(parser->f_code ($1)); }
                 ;
-end_code_:        END_CODE { MNE; P(parser_->f_end_code ()); }
+end_code_:        END_CODE { MNE; P(parser->f_end_code ()); }
                 ;
 
 statement:        conditional
@@ -149,63 +155,63 @@ statement:        conditional
                 | begin_while
                 | case_statement
                 | recurse
-                | EXIT { MNE; P(parser_->f_exit ()); }
-                | PSTRING { MNE; P(parser_->f_pstring ($1)); }
-                | CSTRING { MNE; P(parser_->f_cstring ($1)); }
-                | ASTRING { MNE; P(parser_->f_astring ($1)); }
-                | DOTPARENSTRING { MNE; P(parser_->f_dotparenstring ($1)); }
-                | INTEGER_LITERAL { MNE; P(parser_->f_integer_literal ($1)); }
-                | FLOAT_LITERAL { MNE; P(parser_->f_float_literal ($1)); }
-                | STRING_LITERAL { MNE; P(parser_->f_string_literal ($1)); }
-                | CHAR_LITERAL { MNE; P(parser_->f_char_literal ($1)); }
-                | OBJECT_ADDRESS { MNE; P(parser_->f_object_address ($1)); }
-                | ALLOT { MNE; P(parser_->f_word ($1)); }
-                | WORD  { MNE; P(parser_->f_word ($1)); }
-                ;
-
-conditional:      COND_IFDEF WORD { MNE; parser_->f_cond_ifdef ($1, false); }
-                | COND_IFUNDEF WORD { MNE; parser_->f_cond_ifdef ($1, true); }
-                | COND_THEN { MNE; parser_->f_cond_then_endif (false); }
-                | COND_ENDIF { MNE; parser_->f_cond_then_endif (true); }
-                | COND_ELSE { MNE; parser_->f_cond_else (); }
+                | EXIT { MNE; P(parser->f_exit ()); }
+                | PSTRING { MNE; P(parser->f_pstring ($1)); }
+                | CSTRING { MNE; P(parser->f_cstring ($1)); }
+                | ASTRING { MNE; P(parser->f_astring ($1)); }
+                | DOTPARENSTRING { MNE; P(parser->f_dotparenstring ($1)); }
+                | INTEGER_LITERAL { MNE; P(parser->f_integer_literal ($1)); }
+                | FLOAT_LITERAL { MNE; P(parser->f_float_literal ($1)); }
+                | STRING_LITERAL { MNE; P(parser->f_string_literal ($1)); }
+                | CHAR_LITERAL { MNE; P(parser->f_char_literal ($1)); }
+                | OBJECT_ADDRESS { MNE; P(parser->f_object_address ($1)); }
+                | ALLOT { MNE; P(parser->f_word ($1)); }
+                | WORD  { MNE; P(parser->f_word ($1)); }
+                ;
+
+conditional:      COND_IFDEF WORD { MNE; parser->f_cond_ifdef ($1, false); }
+                | COND_IFUNDEF WORD { MNE; parser->f_cond_ifdef ($1, true); }
+                | COND_THEN { MNE; parser->f_cond_then_endif (false); }
+                | COND_ENDIF { MNE; parser->f_cond_then_endif (true); }
+                | COND_ELSE { MNE; parser->f_cond_else (); }
                 ;
 
 if_statement:     if_ statements then_endif_
                 | if_ statements else_ statements then_endif_
                 ;
-if_:              IF { MNE; P(parser_->f_if ()); }
+if_:              IF { MNE; P(parser->f_if ()); }
                 ;
-then_endif_:      THEN { MNE; P(parser_->f_then_endif ()); }
-                | ENDIF { MNE; P(parser_->f_then_endif ()); }
+then_endif_:      THEN { MNE; P(parser->f_then_endif ()); }
+                | ENDIF { MNE; P(parser->f_then_endif ()); }
                 ;
-else_:            ELSE { MNE; P(parser_->f_else ()); }
+else_:            ELSE { MNE; P(parser->f_else ()); }
                 ;
 
 do_loop:          do_ statements loop_
                 | do_ statements plus_loop_
                 ;
-do_:              DO { MNE; P(parser_->f_do ()); }
-                | QUERY_DO { MNE; P(parser_->f_query_do ()); }
+do_:              DO { MNE; P(parser->f_do ()); }
+                | QUERY_DO { MNE; P(parser->f_query_do ()); }
                 ;
-loop_:            LOOP { MNE; P(parser_->f_loop ()); }
+loop_:            LOOP { MNE; P(parser->f_loop ()); }
                 ;
-plus_loop_:       PLUS_LOOP { MNE; P(parser_->f_plus_loop ()); }
+plus_loop_:       PLUS_LOOP { MNE; P(parser->f_plus_loop ()); }
                 ;
-do_leave:         LEAVE { MNE; P(parser_->f_leave ()); }
-                | QUERY_LEAVE { MNE; P(parser_->f_query_leave ()); }
+do_leave:         LEAVE { MNE; P(parser->f_leave ()); }
+                | QUERY_LEAVE { MNE; P(parser->f_query_leave ()); }
                 ;
 
 begin_loop:       begin_ statements until_
                 | begin_ statements repeat_again_
                 ;
-begin_:           BEGIN_ { MNE; P(parser_->f_begin ()); }
+begin_:           BEGIN_ { MNE; P(parser->f_begin ()); }
                 ;
-until_:           UNTIL { MNE; P(parser_->f_until ()); }
+until_:           UNTIL { MNE; P(parser->f_until ()); }
                 ;
-repeat_again_:    REPEAT { MNE; P(parser_->f_repeat_again ()); }
-                | AGAIN { MNE; P(parser_->f_repeat_again ()); }
+repeat_again_:    REPEAT { MNE; P(parser->f_repeat_again ()); }
+                | AGAIN { MNE; P(parser->f_repeat_again ()); }
                 ;
-begin_while:      WHILE { MNE; P(parser_->f_while ()); }
+begin_while:      WHILE { MNE; P(parser->f_while ()); }
                 ;
 
 case_statement:   case_ casebody statements endcase_
@@ -215,15 +221,15 @@ casebody:         caseclause
                 ;
 caseclause:       statements of_ statements endof_
                 ;
-case_:            CASE { MNE; P(parser_->f_case ()); }
+case_:            CASE { MNE; P(parser->f_case ()); }
                 ;
-endcase_:         ENDCASE { MNE; P(parser_->f_endcase ()); }
+endcase_:         ENDCASE { MNE; P(parser->f_endcase ()); }
                 ;
-of_:              OF { MNE; P(parser_->f_of ()); }
+of_:              OF { MNE; P(parser->f_of ()); }
                 ;
-endof_:           ENDOF { MNE; P(parser_->f_endof ()); }
+endof_:           ENDOF { MNE; P(parser->f_endof ()); }
                 ;
 
-recurse:          RECURSE { MNE; P(parser_->f_recurse ()); }
+recurse:          RECURSE { MNE; P(parser->f_recurse ()); }
                 ;
 %%
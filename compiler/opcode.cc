@@ -22,11 +22,40 @@
 #include <sstream>
 #include <string>
 
+#include "arena.h"
 #include "data.h"
 #include "opcode.h"
 #include "optable.h"
 #include "util.h"
 
+// Opcode allocation.  A module has many small opcodes, all deleted when
+// the opcode table clears, so they come from an arena that rewinds once
+// none remain.
+namespace {
+
+const size_t OPCODE_ARENA_CHUNK_SIZE = 256 * 1024;
+
+Arena &
+opcode_arena ()
+{
+  static Arena arena (OPCODE_ARENA_CHUNK_SIZE);
+  return arena;
+}
+
+} // namespace
+
+void *
+Opcode::operator new (size_t size)
+{
+  return opcode_arena ().allocate (size);
+}
+
+void
+Opcode::operator delete (void * memory)
+{
+  opcode_arena ().release (memory);
+}
+
 // Opcode constructor, auto-adds to the given opcode table, if any.
 Opcode::Opcode (int line, OpcodeTable * optable)
   : line_ (line), optimizes_ (0)
@@ -60,6 +89,13 @@ CallOpcode::create_list_specific () const
   return std::string ("  call Sym_") + to_string (symbol_->get_id ());
 }
 
+const std::string
+TailCallOpcode::create_list_specific () const
+{
+  return std::string ("  tail call Sym_")
+         + to_string (get_symbol ()->get_id ());
+}
+
 const std::string
 DefineOpcode::create_list_specific () const
 {
@@ -140,6 +176,20 @@ PopOpcode::create_list_specific () const
          + " = Stack_" + stack_.get_name ();
 }
 
+const std::string
+LoadFrameOpcode::create_list_specific () const
+{
+  return std::string ("  Reg_") + reg_.get_name ()
+         + " = Frame_" + to_string (slot_);
+}
+
+const std::string
+StoreFrameOpcode::create_list_specific () const
+{
+  return std::string ("  Frame_") + to_string (slot_)
+         + " = Reg_" + reg_.get_name ();
+}
+
 const std::string
 AddValueOpcode::create_list_specific () const
 {
@@ -168,6 +218,98 @@ SubtractRegisterOpcode::create_list_specific () const
          + " -= Reg_" + decrement_.get_name ();
 }
 
+const std::string
+AndRegisterOpcode::create_list_specific () const
+{
+  return std::string ("  Reg_") + reg_.get_name ()
+         + " &= Reg_" + with_.get_name ();
+}
+
+const std::string
+OrRegisterOpcode::create_list_specific () const
+{
+  return std::string ("  Reg_") + reg_.get_name ()
+         + " |= Reg_" + with_.get_name ();
+}
+
+const std::string
+XorRegisterOpcode::create_list_specific () const
+{
+  return std::string ("  Reg_") + reg_.get_name ()
+         + " ^= Reg_" + with_.get_name ();
+}
+
+const std::string
+NegateOpcode::create_list_specific () const
+{
+  return std::string ("  Reg_") + reg_.get_name ()
+         + " = -Reg_" + reg_.get_name ();
+}
+
+const std::string
+InvertOpcode::create_list_specific () const
+{
+  return std::string ("  Reg_") + reg_.get_name ()
+         + " = ~Reg_" + reg_.get_name ();
+}
+
+const std::string
+MultiplyValueOpcode::create_list_specific () const
+{
+  return std::string ("  Reg_") + reg_.get_name ()
+         + " *= " + to_string (value_.get_value ());
+}
+
+const std::string
+DivideValueOpcode::create_list_specific () const
+{
+  return std::string ("  Reg_0 ") + (is_remainder_ ? "%= " : "/= ")
+         + to_string (value_.get_value ());
+}
+
+const std::string
+ShiftLeftRegisterOpcode::create_list_specific () const
+{
+  return std::string ("  Reg_") + reg_.get_name ()
+         + " <<= Reg_" + count_.get_name ();
+}
+
+const std::string
+ShiftRightRegisterOpcode::create_list_specific () const
+{
+  return std::string ("  Reg_") + reg_.get_name ()
+         + " >>= Reg_" + count_.get_name ();
+}
+
+namespace {
+
+// Return the listing operator for a comparison condition.
+const std::string
+condition_operator (Condition condition)
+{
+  static const char * const operators[] = { "==", "!=", "<", ">", "<=", ">=",
+                                            "u<", "u>", "u<=", "u>=" };
+  return operators[condition];
+}
+
+} // namespace
+
+const std::string
+CompareRegisterOpcode::create_list_specific () const
+{
+  return std::string ("  Reg_") + reg_.get_name ()
+         + " = Reg_" + reg_.get_name () + ' '
+         + condition_operator (condition_) + " Reg_" + with_.get_name ();
+}
+
+const std::string
+CompareZeroOpcode::create_list_specific () const
+{
+  return std::string ("  Reg_") + reg_.get_name ()
+         + " = Reg_" + reg_.get_name () + ' '
+         + condition_operator (condition_) + " 0";
+}
+
 const std::string
 JumpOpcode::create_list_specific () const
 {
@@ -232,6 +374,25 @@ JumpNotEqualOpcode::create_list_specific () const
          + " goto Label_" + to_string (label_.get_value ());
 }
 
+const std::string
+JumpCompareOpcode::create_list_specific () const
+{
+  return std::string ("  if Reg_") + reg_.get_name () + ' '
+         + condition_operator (condition_) + " Reg_" + with_.get_name ()
+         + " goto Label_" + to_string (label_.get_value ());
+}
+
+const std::string
+JumpTableOpcode::create_list_specific () const
+{
+  std::string list = std::string ("  switch Reg_") + reg_.get_name ()
+                     + " - " + to_string (base_.get_value ()) + " goto";
+  for (size_t i = 0; i < targets_.size (); ++i)
+    list += (i ? ", Label_" : " Label_")
+            + to_string (targets_[i].get_value ());
+  return list + " else Label_" + to_string (label_.get_value ());
+}
+
 const std::string
 NoOpOpcode::create_list_specific () const
 {
@@ -21,7 +21,9 @@
 #ifndef VNPFORTH_OPCODE_H
 #define VNPFORTH_OPCODE_H
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #include "operand.h"
 #include "register.h"
@@ -32,12 +34,23 @@ class Data;
 class OpcodeTable;
 class Options;
 class CallOpcode;
+class TailCallOpcode;
 class BranchingOpcode;
 class JumpOpcode;
+class JumpZeroOpcode;
+class JumpNonZeroOpcode;
+class JumpNotEqualOpcode;
+class JumpTableOpcode;
 class NoOpOpcode;
 class LabelOpcode;
+class LoadValueOpcode;
+class LoadRegisterOpcode;
+class LoadSymbolOpcode;
+class LoadSymbolIndirectOpcode;
+class StoreSymbolIndirectOpcode;
 class PushOpcode;
 class PopOpcode;
+class FrameOpcode;
 class DefineOpcode;
 class EndDefineOpcode;
 class AssemblyOpcode;
@@ -49,6 +62,11 @@ class Opcode
 public:
   virtual ~Opcode () { }
 
+  // Opcodes come from an arena, and the opcode table that collects them
+  // deletes them all together.
+  static void * operator new (size_t size);
+  static void operator delete (void * memory);
+
   const std::string create_list_entry () const;
 
   inline void
@@ -75,6 +93,12 @@ public:
     return 0;
   }
 
+  virtual inline const TailCallOpcode *
+  is_tail_call_opcode () const
+  {
+    return 0;
+  }
+
   virtual inline const BranchingOpcode *
   is_branching_opcode () const
   {
@@ -87,6 +111,30 @@ public:
     return 0;
   }
 
+  virtual inline const JumpZeroOpcode *
+  is_jump_zero_opcode () const
+  {
+    return 0;
+  }
+
+  virtual inline const JumpNonZeroOpcode *
+  is_jump_nonzero_opcode () const
+  {
+    return 0;
+  }
+
+  virtual inline const JumpNotEqualOpcode *
+  is_jump_not_equal_opcode () const
+  {
+    return 0;
+  }
+
+  virtual inline const JumpTableOpcode *
+  is_jump_table_opcode () const
+  {
+    return 0;
+  }
+
   virtual inline const NoOpOpcode *
   is_noop_opcode () const
   {
@@ -99,6 +147,36 @@ public:
     return 0;
   }
 
+  virtual inline const LoadValueOpcode *
+  is_load_value_opcode () const
+  {
+    return 0;
+  }
+
+  virtual inline const LoadRegisterOpcode *
+  is_load_register_opcode () const
+  {
+    return 0;
+  }
+
+  virtual inline const LoadSymbolOpcode *
+  is_load_symbol_opcode () const
+  {
+    return 0;
+  }
+
+  virtual inline const LoadSymbolIndirectOpcode *
+  is_load_symbol_indirect_opcode () const
+  {
+    return 0;
+  }
+
+  virtual inline const StoreSymbolIndirectOpcode *
+  is_store_symbol_indirect_opcode () const
+  {
+    return 0;
+  }
+
   virtual inline const PushOpcode *
   is_push_opcode () const
   {
@@ -111,6 +189,12 @@ public:
     return 0;
   }
 
+  virtual inline const FrameOpcode *
+  is_frame_opcode () const
+  {
+    return 0;
+  }
+
   virtual inline const DefineOpcode *
   is_define_opcode () const
   {
@@ -129,6 +213,14 @@ public:
     return 0;
   }
 
+  // Returns true if the opcode may change the value held in a register.
+  // Opcodes that do not override this are assumed to change any register.
+  virtual inline bool
+  modifies_register (const Register &) const
+  {
+    return true;
+  }
+
 protected:
   Opcode (int line, OpcodeTable * optable = 0);
 
@@ -170,6 +262,27 @@ private:
   const Symbol * symbol_;
 };
 
+// Call in tail position, releasing the caller's frame then jumping to the
+// callee, which returns directly to the caller's caller.
+class TailCallOpcode: public CallOpcode
+{
+public:
+  TailCallOpcode (const CallableSymbol * symbol,
+                  int line, OpcodeTable * optable = 0)
+    : CallOpcode (symbol, line, optable) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline const TailCallOpcode *
+  is_tail_call_opcode () const
+  {
+    return this;
+  }
+
+protected:
+  const std::string create_list_specific () const;
+};
+
 class DefineOpcode: public Opcode
 {
 public:
@@ -276,8 +389,32 @@ public:
                    const Value value, int line, OpcodeTable * optable = 0)
     : Opcode (line, optable), reg_ (reg), value_ (value) { }
 
+  inline const Register &
+  get_register () const
+  {
+    return reg_;
+  }
+
+  inline const Value &
+  get_value () const
+  {
+    return value_;
+  }
+
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+  inline const LoadValueOpcode *
+  is_load_value_opcode () const
+  {
+    return this;
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -292,8 +429,32 @@ public:
                       int line, OpcodeTable * optable = 0)
     : Opcode (line, optable), reg_ (reg), with_ (with) { }
 
+  inline const Register &
+  get_register () const
+  {
+    return reg_;
+  }
+
+  inline const Register &
+  get_with () const
+  {
+    return with_;
+  }
+
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+  inline const LoadRegisterOpcode *
+  is_load_register_opcode () const
+  {
+    return this;
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -308,8 +469,32 @@ public:
                     const Symbol * symbol, int line, OpcodeTable * optable = 0)
     : Opcode (line, optable), reg_ (reg), symbol_ (symbol) { }
 
+  inline const Register &
+  get_register () const
+  {
+    return reg_;
+  }
+
+  inline const Symbol *
+  get_symbol () const
+  {
+    return symbol_;
+  }
+
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+  inline const LoadSymbolOpcode *
+  is_load_symbol_opcode () const
+  {
+    return this;
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -324,8 +509,32 @@ public:
                             int line, OpcodeTable * optable = 0)
     : Opcode (line, optable), reg_ (reg), symbol_ (symbol) { }
 
+  inline const Register &
+  get_register () const
+  {
+    return reg_;
+  }
+
+  inline const Symbol *
+  get_symbol () const
+  {
+    return symbol_;
+  }
+
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+  inline const LoadSymbolIndirectOpcode *
+  is_load_symbol_indirect_opcode () const
+  {
+    return this;
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -342,6 +551,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -356,8 +571,32 @@ public:
                              int line, OpcodeTable * optable = 0)
     : Opcode (line, optable), reg_ (reg), symbol_ (symbol) { }
 
+  inline const Register &
+  get_register () const
+  {
+    return reg_;
+  }
+
+  inline const Symbol *
+  get_symbol () const
+  {
+    return symbol_;
+  }
+
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register &) const
+  {
+    return false;
+  }
+
+  inline const StoreSymbolIndirectOpcode *
+  is_store_symbol_indirect_opcode () const
+  {
+    return this;
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -386,6 +625,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register &) const
+  {
+    return false;
+  }
+
   inline const PushOpcode *
   is_push_opcode () const
   {
@@ -420,6 +665,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
   inline const PopOpcode *
   is_pop_opcode () const
   {
@@ -433,6 +684,90 @@ private:
   const Stack stack_;
 };
 
+// Return stack cells held in slots of the machine stack frame.  Slot
+// numbers count downwards in memory from the frame's saved registers.
+class FrameOpcode: public Opcode
+{
+public:
+  inline const FrameOpcode *
+  is_frame_opcode () const
+  {
+    return this;
+  }
+
+  inline const Register &
+  get_register () const
+  {
+    return reg_;
+  }
+
+  inline int
+  get_slot () const
+  {
+    return slot_;
+  }
+
+  virtual bool is_load () const = 0;
+
+protected:
+  FrameOpcode (const Register & reg, int slot,
+               int line, OpcodeTable * optable = 0)
+    : Opcode (line, optable), reg_ (reg), slot_ (slot) { }
+
+  const Register reg_;
+  const int slot_;
+};
+
+class LoadFrameOpcode: public FrameOpcode
+{
+public:
+  LoadFrameOpcode (const Register & reg, int slot,
+                   int line, OpcodeTable * optable = 0)
+    : FrameOpcode (reg, slot, line, optable) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  is_load () const
+  {
+    return true;
+  }
+
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+protected:
+  const std::string create_list_specific () const;
+};
+
+class StoreFrameOpcode: public FrameOpcode
+{
+public:
+  StoreFrameOpcode (const Register & reg, int slot,
+                    int line, OpcodeTable * optable = 0)
+    : FrameOpcode (reg, slot, line, optable) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  is_load () const
+  {
+    return false;
+  }
+
+  inline bool
+  modifies_register (const Register &) const
+  {
+    return false;
+  }
+
+protected:
+  const std::string create_list_specific () const;
+};
+
 // Add and subtract.
 class AddValueOpcode: public Opcode
 {
@@ -443,6 +778,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -459,6 +800,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -475,6 +822,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -491,6 +844,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -498,6 +857,258 @@ private:
   const Register decrement_;
 };
 
+// Logic, negation and shifts.
+class AndRegisterOpcode: public Opcode
+{
+public:
+  AndRegisterOpcode (const Register & reg, const Register & with,
+                     int line, OpcodeTable * optable = 0)
+    : Opcode (line, optable), reg_ (reg), with_ (with) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Register reg_;
+  const Register with_;
+};
+
+class OrRegisterOpcode: public Opcode
+{
+public:
+  OrRegisterOpcode (const Register & reg, const Register & with,
+                    int line, OpcodeTable * optable = 0)
+    : Opcode (line, optable), reg_ (reg), with_ (with) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Register reg_;
+  const Register with_;
+};
+
+class XorRegisterOpcode: public Opcode
+{
+public:
+  XorRegisterOpcode (const Register & reg, const Register & with,
+                     int line, OpcodeTable * optable = 0)
+    : Opcode (line, optable), reg_ (reg), with_ (with) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Register reg_;
+  const Register with_;
+};
+
+class NegateOpcode: public Opcode
+{
+public:
+  NegateOpcode (const Register & reg, int line, OpcodeTable * optable = 0)
+    : Opcode (line, optable), reg_ (reg) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Register reg_;
+};
+
+class InvertOpcode: public Opcode
+{
+public:
+  InvertOpcode (const Register & reg, int line, OpcodeTable * optable = 0)
+    : Opcode (line, optable), reg_ (reg) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Register reg_;
+};
+
+// Shifts take their count from a register other than %ecx, and preserve
+// it, so that they do not disturb %ecx's use for the data stack index.
+class ShiftLeftRegisterOpcode: public Opcode
+{
+public:
+  ShiftLeftRegisterOpcode (const Register & reg, const Register & count,
+                           int line, OpcodeTable * optable = 0)
+    : Opcode (line, optable), reg_ (reg), count_ (count) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Register reg_;
+  const Register count_;
+};
+
+class ShiftRightRegisterOpcode: public Opcode
+{
+public:
+  ShiftRightRegisterOpcode (const Register & reg, const Register & count,
+                            int line, OpcodeTable * optable = 0)
+    : Opcode (line, optable), reg_ (reg), count_ (count) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Register reg_;
+  const Register count_;
+};
+
+// Comparisons, setting a register to a Forth flag, -1 if the condition
+// holds and 0 otherwise.  Only registers with byte forms are usable.
+// Multiply a register by a constant, using shifts and lea where cheaper.
+class MultiplyValueOpcode: public Opcode
+{
+public:
+  MultiplyValueOpcode (const Register & reg,
+                       const Value value, int line, OpcodeTable * optable = 0)
+    : Opcode (line, optable), reg_ (reg), value_ (value) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Register reg_;
+  const Value value_;
+};
+
+// Divide Reg_0 by a constant, leaving the quotient or the remainder of
+// symmetric division, as from SM/REM, in Reg_0.  Uses Reg_1 as scratch.
+class DivideValueOpcode: public Opcode
+{
+public:
+  DivideValueOpcode (const Value value, bool is_remainder,
+                     int line, OpcodeTable * optable = 0)
+    : Opcode (line, optable), value_ (value), is_remainder_ (is_remainder) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg.equals (Register::R0) || reg.equals (Register::R1);
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Value value_;
+  const bool is_remainder_;
+};
+
+enum Condition { EQUAL, NOT_EQUAL, LESS, GREATER, LESS_EQUAL, GREATER_EQUAL,
+                 BELOW, ABOVE, BELOW_EQUAL, ABOVE_EQUAL };
+
+class CompareRegisterOpcode: public Opcode
+{
+public:
+  CompareRegisterOpcode (const Register & reg, const Register & with,
+                         Condition condition,
+                         int line, OpcodeTable * optable = 0)
+    : Opcode (line, optable), reg_ (reg), with_ (with),
+      condition_ (condition) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Register reg_;
+  const Register with_;
+  const Condition condition_;
+};
+
+class CompareZeroOpcode: public Opcode
+{
+public:
+  CompareZeroOpcode (const Register & reg, Condition condition,
+                     int line, OpcodeTable * optable = 0)
+    : Opcode (line, optable), reg_ (reg), condition_ (condition) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline bool
+  modifies_register (const Register & reg) const
+  {
+    return reg_.equals (reg);
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Register reg_;
+  const Condition condition_;
+};
+
 // Branches.
 class BranchingOpcode: public Opcode
 {
@@ -514,6 +1125,9 @@ public:
     return label_;
   }
 
+  // Return a copy of the branch that goes to label instead.
+  virtual BranchingOpcode * retarget (const Label & label) const = 0;
+
 protected:
   BranchingOpcode (const Label & label, int line, OpcodeTable * optable = 0)
     : Opcode (line, optable), label_ (label) { }
@@ -529,6 +1143,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline BranchingOpcode *
+  retarget (const Label & label) const
+  {
+    return new JumpOpcode (label, get_line ());
+  }
+
   inline const JumpOpcode *
   is_jump_opcode () const
   {
@@ -546,8 +1166,26 @@ public:
                   const Label & label, int line, OpcodeTable * optable = 0)
     : BranchingOpcode (label, line, optable), reg_ (reg) { }
 
+  inline const Register &
+  get_register () const
+  {
+    return reg_;
+  }
+
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline BranchingOpcode *
+  retarget (const Label & label) const
+  {
+    return new JumpZeroOpcode (reg_, label, get_line ());
+  }
+
+  inline const JumpZeroOpcode *
+  is_jump_zero_opcode () const
+  {
+    return this;
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -561,8 +1199,26 @@ public:
                      const Label & label, int line, OpcodeTable * optable = 0)
     : BranchingOpcode (label, line, optable), reg_ (reg) { }
 
+  inline const Register &
+  get_register () const
+  {
+    return reg_;
+  }
+
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline BranchingOpcode *
+  retarget (const Label & label) const
+  {
+    return new JumpNonZeroOpcode (reg_, label, get_line ());
+  }
+
+  inline const JumpNonZeroOpcode *
+  is_jump_nonzero_opcode () const
+  {
+    return this;
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -578,6 +1234,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline BranchingOpcode *
+  retarget (const Label & label) const
+  {
+    return new JumpGreaterZeroOpcode (reg_, label, get_line ());
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -593,6 +1255,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline BranchingOpcode *
+  retarget (const Label & label) const
+  {
+    return new JumpLessZeroOpcode (reg_, label, get_line ());
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -608,6 +1276,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline BranchingOpcode *
+  retarget (const Label & label) const
+  {
+    return new JumpGreaterEqualZeroOpcode (reg_, label, get_line ());
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -623,6 +1297,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline BranchingOpcode *
+  retarget (const Label & label) const
+  {
+    return new JumpLessEqualZeroOpcode (reg_, label, get_line ());
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -638,6 +1318,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline BranchingOpcode *
+  retarget (const Label & label) const
+  {
+    return new JumpEqualOpcode (reg1_, reg2_, label, get_line ());
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -652,8 +1338,32 @@ public:
                       const Label & label, int line, OpcodeTable * optable = 0)
     : BranchingOpcode (label, line, optable), reg1_ (reg1), reg2_ (reg2) { }
 
+  inline const Register &
+  get_register1 () const
+  {
+    return reg1_;
+  }
+
+  inline const Register &
+  get_register2 () const
+  {
+    return reg2_;
+  }
+
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline BranchingOpcode *
+  retarget (const Label & label) const
+  {
+    return new JumpNotEqualOpcode (reg1_, reg2_, label, get_line ());
+  }
+
+  inline const JumpNotEqualOpcode *
+  is_jump_not_equal_opcode () const
+  {
+    return this;
+  }
+
 protected:
   const std::string create_list_specific () const;
 private:
@@ -661,6 +1371,75 @@ private:
   const Register reg2_;
 };
 
+// Compare two registers and branch if the condition holds.
+class JumpCompareOpcode: public BranchingOpcode
+{
+public:
+  JumpCompareOpcode (const Register & reg, const Register & with,
+                     Condition condition, const Label & label,
+                     int line, OpcodeTable * optable = 0)
+    : BranchingOpcode (label, line, optable), reg_ (reg), with_ (with),
+      condition_ (condition) { }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline BranchingOpcode *
+  retarget (const Label & label) const
+  {
+    return new JumpCompareOpcode (reg_, with_, condition_, label,
+                                  get_line ());
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Register reg_;
+  const Register with_;
+  const Condition condition_;
+};
+
+// Jump through a table of labels, indexed by a register less a base value.
+// Indexes outside the table branch to the default label, which is the one
+// that retargeting changes.  Modifies the indexing register, and on x86_64
+// also uses Reg_1 as scratch.
+class JumpTableOpcode: public BranchingOpcode
+{
+public:
+  JumpTableOpcode (const Register & reg, const Value & base,
+                   const std::vector<Label> & targets, const Label & label,
+                   int line, OpcodeTable * optable = 0)
+    : BranchingOpcode (label, line, optable), reg_ (reg), base_ (base),
+      targets_ (targets) { }
+
+  inline const std::vector<Label> &
+  get_targets () const
+  {
+    return targets_;
+  }
+
+  void generate (std::ostream & outs, const Options & options) const;
+
+  inline BranchingOpcode *
+  retarget (const Label & label) const
+  {
+    return new JumpTableOpcode (reg_, base_, targets_, label,
+                                get_line ());
+  }
+
+  inline const JumpTableOpcode *
+  is_jump_table_opcode () const
+  {
+    return this;
+  }
+
+protected:
+  const std::string create_list_specific () const;
+private:
+  const Register reg_;
+  const Value base_;
+  const std::vector<Label> targets_;
+};
+
 // No-op, used for optimizing out opcodes.
 class NoOpOpcode: public Opcode
 {
@@ -670,6 +1449,12 @@ public:
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  inline bool
+  modifies_register (const Register &) const
+  {
+    return false;
+  }
+
   inline const NoOpOpcode *
   is_noop_opcode () const
   {
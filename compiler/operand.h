@@ -21,20 +21,29 @@
 #ifndef VNPFORTH_OPERAND_H
 #define VNPFORTH_OPERAND_H
 
-// Simple valued operands.
+#include <climits>
+
+// Simple valued operands.  Values hold a whole cell of either target.
 class Value
 {
 public:
-  explicit Value (int value)
+  explicit Value (long long value)
     : value_ (value) { }
 
-  int get_value () const
+  long long get_value () const
   {
     return value_;
   }
 
+  // Return true if the value fits the sign-extended 32 bit immediate
+  // operand of x86_64 instructions other than mov.
+  bool is_immediate () const
+  {
+    return value_ >= INT_MIN && value_ <= INT_MAX;
+  }
+
 private:
-  const int value_;
+  const long long value_;
 };
 
 class Label
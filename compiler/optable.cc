@@ -45,6 +45,8 @@ OpcodeTable::clear ()
                  opcode_collection_.end (), dispose);
   opcodes_.clear ();
   opcode_collection_.clear ();
+  inline_hints_.clear ();
+  defined_symbols_.clear ();
 }
 
 OpcodeTable::~OpcodeTable ()
@@ -59,7 +61,7 @@ void
 OpcodeTable::add (Opcode * opcode)
 {
   opcodes_.push_back (opcode);
-  opcode_collection_.insert (opcode);
+  opcode_collection_.push_back (opcode);
 }
 
 // Pretty-print to create the opcode table listing.
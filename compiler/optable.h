@@ -22,11 +22,13 @@
 #define VNPFORTH_OPCODETABLE_H
 
 #include <iostream>
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
 
 class Options;
+class Symbol;
 class SymbolTable;
 class Opcode;
 
@@ -35,7 +37,7 @@ class Opcode;
 class OpcodeTable
 {
 public:
-  OpcodeTable () { }
+  OpcodeTable () : inline_budget_ (0) { }
   ~OpcodeTable ();
 
   void add (Opcode * opcode);
@@ -48,12 +50,24 @@ public:
     return opcodes_.empty ();
   }
 
+  // Note that a word should always, or never, be inlined.
+  inline void
+  set_inline_hint (const Symbol * symbol, bool is_inline)
+  {
+    inline_hints_[symbol] = is_inline;
+  }
+
   void synthesize_main (const SymbolTable & symtable);
   void unreachable_check (const std::string & source_path) const;
-  void optimize_code (const std::string & source_path);
+  void optimize_code (const std::string & source_path,
+                      const Options & options);
 
   void generate (std::ostream & outs, const Options & options) const;
 
+  static bool is_optimization_pass (const std::string & name);
+  static bool is_pass_enabled (const std::string & name,
+                               const Options & options);
+
 private:
   OpcodeTable (const OpcodeTable & table);
   OpcodeTable & operator= (const OpcodeTable & table);
@@ -62,19 +76,57 @@ private:
   typedef OpcodeTableStore::const_iterator OpcodeTableIterator;
   typedef OpcodeTableStore::iterator OpcodeTableIterator_mutable;
 
+  // Optimization passes, named for -f<name> and -fno-<name>, with the
+  // lowest -O level that runs each.  Local passes see one definition at
+  // a time, module passes all definitions.  Expansions run once local and
+  // module passes settle, then final passes run once each.
+  enum PassScope { LOCAL, MODULE, EXPANSION, FINAL };
+
+  struct Pass
+  {
+    const char * name;
+    int level;
+    PassScope scope;
+    int (OpcodeTable::*run) (const Options & options);
+  };
+
+  static const Pass PASSES[];
+
+  int run_passes (PassScope scope, const Options & options);
+  int run_on_definition (OpcodeTableStore * definition, PassScope scope,
+                         const Options & options);
+  bool settle_definition (OpcodeTableStore * definition,
+                          const Options & options);
+
+  const std::set<const Symbol *> & get_defined_symbols ();
   void replace_with (OpcodeTableIterator_mutable iter, Opcode * replacement);
   void replace_with_nop (OpcodeTableIterator_mutable iter);
-  int remove_unreachable_code ();
-  int remove_unnecessary_jumps ();
-  int remove_useless_calls ();
-  int inline_booleans ();
-  int inline_small_functions ();
-  int replace_adjacent_push_pop_pairs ();
-  int relocate_suboptimal_labels ();
-  int remove_unnecessary_labels ();
+  int remove_unreachable_code (const Options & options);
+  int remove_unnecessary_jumps (const Options & options);
+  int remove_useless_calls (const Options & options);
+  int inline_booleans (const Options & options);
+  int inline_constants (const Options & options);
+  int remove_redundant_accesses (const Options & options);
+  int fold_constants (const Options & options);
+  int inline_functions (const Options & options);
+  int replace_adjacent_push_pop_pairs (const Options & options);
+  int relocate_suboptimal_labels (const Options & options);
+  int merge_blocks (const Options & options);
+  int remove_unnecessary_labels (const Options & options);
+  int reduce_strength (const Options & options);
+  int expand_intrinsics (const Options & options);
+  int expand_variable_accesses (const Options & options);
+  int allocate_rstack_frames (const Options & options);
+  int eliminate_tail_calls (const Options & options);
+  int dispatch_case_selections (const Options & options);
+  int allocate_stack_registers (const Options & options);
+  int hoist_loop_invariants (const Options & options);
 
   OpcodeTableStore opcodes_;
-  std::set<Opcode *> opcode_collection_;
+  OpcodeTableStore opcode_collection_;
+  std::map<const Symbol *, bool> inline_hints_;
+  std::set<const Symbol *> defined_symbols_;
+  int inline_budget_;
 };
 
 #endif
@@ -19,31 +19,126 @@
 //
 
 #include <algorithm>
+#include <cassert>
+#include <climits>
 #include <functional>
 #include <iostream>
 #include <map>
 #include <set>
 #include <vector>
 
+#include "cfg.h"
 #include "mangler.h"
 #include "opcode.h"
 #include "operand.h"
 #include "optable.h"
+#include "options.h"
 #include "register.h"
 #include "stack.h"
 
-// Definition of "small" function, limit on optimization iterations, and
-// pre-defined mangled names for true/false inlining.
+// Definition of "small" function, inlining cost model limits, limit on
+// optimization iterations, pre-defined mangled names for true/false
+// inlining, and helpers for matching opcode sequences.
 namespace {
 
 const int SMALL_FUNCTION_OPCODE_LIMIT = 10;
+const int INLINE_OPCODE_LIMIT = 12;
+const int INLINE_LOOP_BONUS = 12;
+const int INLINE_OPCODE_MAXIMUM = 48;
+const int INLINE_GROWTH_PERCENT = 50;
+const int INLINE_GROWTH_MINIMUM = 64;
 const int ITERATIONS_LIMIT = 32;
 
 static const std::string MANGLED_TRUE = Mangler::mangle ("TRUE");
 static const std::string MANGLED_FALSE = Mangler::mangle ("FALSE");
 
+// Return the first opcode index from index that is not a no-op.
+size_t
+skip_noops (const std::vector<Opcode *> & opcodes, size_t index)
+{
+  while (index < opcodes.size () && opcodes[index]->is_noop_opcode ())
+    ++index;
+  return index;
+}
+
+// Return true if the opcode pops or pushes reg on the data stack.
+bool
+is_data_pop (const Opcode * opcode, const Register & reg)
+{
+  const PopOpcode * pop = opcode->is_pop_opcode ();
+  return pop && pop->get_stack ().equals (Stack::DATA)
+         && pop->get_register ().equals (reg);
+}
+
+bool
+is_data_push (const Opcode * opcode, const Register & reg)
+{
+  const PushOpcode * push = opcode->is_push_opcode ();
+  return push && push->get_stack ().equals (Stack::DATA)
+         && push->get_register ().equals (reg);
+}
+
+// Return the index of the end of the definition starting at index.
+size_t
+find_definition_end (const std::vector<Opcode *> & opcodes, size_t index)
+{
+  while (index < opcodes.size () && !opcodes[index]->is_enddefine_opcode ())
+    ++index;
+  return index;
+}
+
+// Return true if an opcode may change any register, so that no value can
+// stay in a register across it: calls, inline assembly, and the floating
+// point stack push and pop functions.
+bool
+clobbers_registers (const Opcode * opcode)
+{
+  const PushOpcode * push = opcode->is_push_opcode ();
+  const PopOpcode * pop = opcode->is_pop_opcode ();
+
+  return opcode->is_call_opcode ()
+         || opcode->is_assembly_opcode ()
+         || (push && push->get_stack ().equals (Stack::FLOAT))
+         || (pop && pop->get_stack ().equals (Stack::FLOAT));
+}
+
+// Words that inspect their caller's frame, so may not be tail called, nor
+// inlined into another word.
+const char * const FRAME_INSPECTORS[] = { "_(ehcontext)", 0 };
+
+bool
+is_frame_inspector (const Symbol * symbol)
+{
+  const std::string word = Mangler::demangle (symbol->get_name ());
+  for (int i = 0; FRAME_INSPECTORS[i]; ++i)
+    {
+      if (word == FRAME_INSPECTORS[i])
+        return true;
+    }
+  return false;
+}
+
 } // namespace
 
+// Return the symbols of all words that the program defines.  Calls to any
+// of these may not be to the runtime's word of the same name.  Definitions
+// do not change once parsed and main synthesized, so the first call notes
+// them for the rest, including those that see only a single definition.
+const std::set<const Symbol *> &
+OpcodeTable::get_defined_symbols ()
+{
+  if (!defined_symbols_.empty ())
+    return defined_symbols_;
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      const DefineOpcode * define = opcodes_[i]->is_define_opcode ();
+      if (define)
+        defined_symbols_.insert (define->get_symbol ());
+    }
+  return defined_symbols_;
+}
+
 // Convenience functions to replace an opcode with something else.
 void
 OpcodeTable::replace_with (OpcodeTableIterator_mutable iter,
@@ -51,7 +146,7 @@ OpcodeTable::replace_with (OpcodeTableIterator_mutable iter,
 {
   replacement->set_optimizes (*iter);
   *iter = replacement;
-  opcode_collection_.insert (replacement);
+  opcode_collection_.push_back (replacement);
 }
 
 void
@@ -61,44 +156,45 @@ OpcodeTable::replace_with_nop (OpcodeTableIterator_mutable iter)
   replace_with (iter, new NoOpOpcode (opcode->get_line ()));
 }
 
-// Remove unreachable code that can never be executed.
+// Remove code that no path from the start of its definition reaches,
+// labels included.
 int
-OpcodeTable::remove_unreachable_code ()
+OpcodeTable::remove_unreachable_code (const Options &)
 {
   int optimizations = 0;
 
-  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
-       iter != opcodes_.end (); )
+  for (size_t i = 0; i < opcodes_.size (); ++i)
     {
-      // Find the next unconditional jump.
-      const OpcodeTableIterator_mutable first =
-          std::find_if (iter, opcodes_.end (),
-                        std::mem_fun (&Opcode::is_jump_opcode));
-      if (first == opcodes_.end ())
-        break;
+      if (!opcodes_[i]->is_define_opcode ())
+        continue;
 
-      // Replace any non-no-op between here and the next label with a no-op.
-      // Remember to break on definition end.
-      for (iter = first + 1; iter != opcodes_.end (); ++iter)
+      const size_t end = find_definition_end (opcodes_, i);
+      const ControlFlowGraph cfg (opcodes_, i + 1, end);
+
+      for (size_t b = 0; b < cfg.get_block_count (); ++b)
         {
-          const Opcode * opcode = *iter;
+          if (cfg.is_reachable (b))
+            continue;
 
-          if (opcode->is_label_opcode () || opcode->is_enddefine_opcode ())
-            break;
-          else if (!opcode->is_noop_opcode ())
+          const ControlFlowGraph::Block & block = cfg.get_block (b);
+          for (size_t j = block.begin; j < block.end; ++j)
             {
-              replace_with_nop (iter);
-              ++optimizations;
+              if (!opcodes_[j]->is_noop_opcode ())
+                {
+                  replace_with_nop (opcodes_.begin () + j);
+                  ++optimizations;
+                }
             }
         }
+      i = end;
     }
 
-    return optimizations;
+  return optimizations;
 }
 
 // Replace jumps over nothing or to the next instruction with a no-op.
 int
-OpcodeTable::remove_unnecessary_jumps ()
+OpcodeTable::remove_unnecessary_jumps (const Options &)
 {
   int optimizations = 0;
 
@@ -138,7 +234,7 @@ OpcodeTable::remove_unnecessary_jumps ()
 
 // Replace calls to empty functions with a no-op.
 int
-OpcodeTable::remove_useless_calls ()
+OpcodeTable::remove_useless_calls (const Options &)
 {
   int optimizations = 0;
 
@@ -202,7 +298,7 @@ OpcodeTable::remove_useless_calls ()
 // Inline any 'true' or 'false' booleans.  Eliminates a call just to obtain
 // a constant 0 or -1.
 int
-OpcodeTable::inline_booleans ()
+OpcodeTable::inline_booleans (const Options &)
 {
   int optimizations = 0;
 
@@ -233,11 +329,11 @@ OpcodeTable::inline_booleans ()
                                         name == MANGLED_TRUE
                                                 ? Value (-1) : Value (0),
                                         opcode->get_line ());
-              opcode_collection_.insert (op);
+              opcode_collection_.push_back (op);
               inlined.push_back (op);
               op = new PushOpcode (Register::R0,
                                    Stack::DATA, opcode->get_line ());
-              opcode_collection_.insert (op);
+              opcode_collection_.push_back (op);
               inlined.push_back (op);
 
               ++optimizations;
@@ -256,83 +352,492 @@ OpcodeTable::inline_booleans ()
   return optimizations;
 }
 
-// Inline any small straight-line functions.
+// Replace loads of integer constants whose values are known at compile
+// time with the values themselves.  CONSTANT stores the cell it pops into
+// the constant's symbol once, from top level code that runs before any
+// use can, so a store whose popped cell is a literal fixes the value.  The
+// store itself stays, so that the constant's cell remains valid.
 int
-OpcodeTable::inline_small_functions ()
+OpcodeTable::inline_constants (const Options &)
 {
   int optimizations = 0;
 
-  // Identify definitions that are straight-line basic-block only, and
-  // count their executable opcodes.
-  std::set<const Symbol *> inline_candidates;
-  const Symbol * current_definition = 0;
-  int executable_opcodes = 0;
-  bool is_not_candidate = false;
-
-  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
-       iter != opcodes_.end (); ++iter)
+  // Find each constant stored from a literal, through a push and pop or
+  // with the pair already removed.
+  std::map<const Symbol *, long long> values;
+  for (size_t i = 0; i < opcodes_.size (); ++i)
     {
-      const Opcode * opcode = *iter;
+      const StoreSymbolIndirectOpcode * store
+          = opcodes_[i]->is_store_symbol_indirect_opcode ();
+      if (!(store && store->get_symbol ()->is_intconstant_symbol ()))
+        continue;
 
-      if (opcode->is_define_opcode ())
+      const Register & reg = store->get_register ();
+      size_t j = i;
+      while (j > 0 && opcodes_[--j]->is_noop_opcode ())
+        ;
+
+      if (is_data_pop (opcodes_[j], reg))
         {
-          current_definition = opcode->is_define_opcode ()->get_symbol ();
-          executable_opcodes = 0;
-          is_not_candidate = false;
+          while (j > 0 && opcodes_[--j]->is_noop_opcode ())
+            ;
+          if (!is_data_push (opcodes_[j], reg))
+            continue;
+          while (j > 0 && opcodes_[--j]->is_noop_opcode ())
+            ;
         }
-      else if (opcode->is_enddefine_opcode ())
-        {
-          if (!is_not_candidate)
-            inline_candidates.insert (current_definition);
 
-          current_definition = 0;
-        }
-      else if (current_definition)
-        {
-          const bool is_branching = opcode->is_branching_opcode ();
-          is_not_candidate |= is_branching;
+      const LoadValueOpcode * load = opcodes_[j]->is_load_value_opcode ();
+      if (load && load->get_register ().equals (reg))
+        values[store->get_symbol ()] = load->get_value ().get_value ();
+    }
 
-          const bool is_assembly = opcode->is_assembly_opcode ();
-          is_not_candidate |= is_assembly;
+  if (values.empty ())
+    return optimizations;
 
-          const bool is_executable = !(opcode->is_label_opcode ()
-                                       || opcode->is_noop_opcode ());
-          executable_opcodes += is_executable ? 1 : 0;
-          is_not_candidate |= executable_opcodes > SMALL_FUNCTION_OPCODE_LIMIT;
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      const LoadSymbolIndirectOpcode * load
+          = opcodes_[i]->is_load_symbol_indirect_opcode ();
+      if (!load)
+        continue;
+
+      const std::map<const Symbol *, long long>::const_iterator found
+          = values.find (load->get_symbol ());
+      if (found != values.end ())
+        {
+          replace_with (opcodes_.begin () + i,
+                        new LoadValueOpcode (load->get_register (),
+                                             Value (found->second),
+                                             load->get_line ()));
+          ++optimizations;
         }
     }
 
-  // Build splices for small definitions.
-  std::map<const Symbol *, OpcodeTableStore> splices;
-  current_definition = 0;
+  return optimizations;
+}
+
+// Helpers for constant folding.
+namespace {
+
+// Return the number of cell arguments of a word that can be evaluated at
+// compile time, or zero if it cannot.
+int
+fold_arity (const std::string & word)
+{
+  static const char * const unary[] = { "negate", "invert", "abs", "1+",
+                                        "1-", "2*", "2/", "cells", "cell+",
+                                        "chars", "char+", 0 };
+  static const char * const binary[] = { "+", "-", "*", "and", "or", "xor",
+                                         "lshift", "rshift", "min", "max",
+                                         0 };
+
+  for (int i = 0; unary[i]; ++i)
+    {
+      if (word == unary[i])
+        return 1;
+    }
+  for (int i = 0; binary[i]; ++i)
+    {
+      if (word == binary[i])
+        return 2;
+    }
+  return 0;
+}
+
+// Return value wrapped to a signed cell of bits width.
+long long
+wrap_to_cell (unsigned long long value, int bits)
+{
+  if (bits == 32)
+    {
+      const unsigned long long low = value & 0xffffffffULL;
+      return low & 0x80000000ULL
+             ? static_cast<long long> (low) - 0x100000000LL
+             : static_cast<long long> (low);
+    }
+  return static_cast<long long> (value);
+}
 
-  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
-       iter != opcodes_.end (); ++iter)
+// Evaluate word on arguments, in stack order, for a cell of bits width.
+// Return false for shifts whose result the target leaves undefined.
+bool
+evaluate (const std::string & word, const std::vector<long long> & args,
+          int bits, long long * result)
+{
+  const unsigned long long mask = bits == 32 ? 0xffffffffULL : ~0ULL;
+  const long long cell = bits / 8;
+  const long long a = args[0];
+  const long long b = args.size () > 1 ? args[1] : 0;
+  const unsigned long long ua = static_cast<unsigned long long> (a);
+  const unsigned long long ub = static_cast<unsigned long long> (b);
+
+  unsigned long long value;
+  if (word == "negate")
+    value = 0 - ua;
+  else if (word == "invert")
+    value = ~ua;
+  else if (word == "abs")
+    value = a < 0 ? 0 - ua : ua;
+  else if (word == "1+" || word == "char+")
+    value = ua + 1;
+  else if (word == "1-")
+    value = ua - 1;
+  else if (word == "2*")
+    value = ua << 1;
+  else if (word == "2/")
+    value = a < 0 ? ~(~ua >> 1) : ua >> 1;
+  else if (word == "cells")
+    value = ua * cell;
+  else if (word == "cell+")
+    value = ua + cell;
+  else if (word == "chars")
+    value = ua;
+  else if (word == "+")
+    value = ua + ub;
+  else if (word == "-")
+    value = ua - ub;
+  else if (word == "*")
+    value = ua * ub;
+  else if (word == "and")
+    value = ua & ub;
+  else if (word == "or")
+    value = ua | ub;
+  else if (word == "xor")
+    value = ua ^ ub;
+  else if (word == "lshift" || word == "rshift")
     {
-      Opcode * opcode = *iter;
+      if (b < 0 || b >= bits)
+        return false;
+      value = word == "lshift" ? ua << b : (ua & mask) >> b;
+    }
+  else if (word == "min")
+    value = a < b ? ua : ub;
+  else if (word == "max")
+    value = a > b ? ua : ub;
+  else
+    return false;
+
+  *result = wrap_to_cell (value, bits);
+  return true;
+}
 
-      if (opcode->is_define_opcode ())
-        {
-          const Symbol * defining = opcode->is_define_opcode ()->get_symbol ();
-          if (inline_candidates.find (defining) != inline_candidates.end ())
-            current_definition = defining;
-        }
-      else if (opcode->is_enddefine_opcode ())
+} // namespace
+
+// Evaluate calls to pure arithmetic and logic words whose arguments are all
+// pushed literals, and push the result as a single literal instead.  Folded
+// results stay available as literals, so chains fold in a single pass.
+// Words that the program defines are left alone.
+int
+OpcodeTable::fold_constants (const Options & options)
+{
+  int optimizations = 0;
+  const int bits = options.target_x86_64 () ? 64 : 32;
+
+  const std::set<const Symbol *> & defined = get_defined_symbols ();
+
+  // Stack of consecutively pushed literals, as load and push indexes.
+  std::vector<std::pair<size_t, size_t> > literals;
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      const Opcode * opcode = opcodes_[i];
+      if (opcode->is_noop_opcode ())
+        continue;
+
+      // Note a value loaded into a register and pushed onto the data stack.
+      const LoadValueOpcode * load = opcode->is_load_value_opcode ();
+      if (load)
         {
-          current_definition = 0;
+          size_t j = i + 1;
+          while (j < opcodes_.size () && opcodes_[j]->is_noop_opcode ())
+            ++j;
+
+          const PushOpcode * push = j < opcodes_.size ()
+                                    ? opcodes_[j]->is_push_opcode () : 0;
+          if (push && push->get_stack ().equals (Stack::DATA)
+              && push->get_register ().equals (load->get_register ()))
+            {
+              literals.push_back (std::make_pair (i, j));
+              i = j;
+            }
+          else
+            literals.clear ();
+          continue;
         }
-      else if (current_definition)
+
+      // Fold a call to a foldable word with enough literal arguments.
+      const CallOpcode * call = opcode->is_call_opcode ();
+      const size_t arity = call
+          && defined.find (call->get_symbol ()) == defined.end ()
+          ? fold_arity (Mangler::demangle (call->get_symbol ()->get_name ()))
+          : 0;
+
+      if (arity > 0 && literals.size () >= arity)
         {
-          const bool is_executable = !(opcode->is_label_opcode ()
-                                       || opcode->is_noop_opcode ());
-          if (is_executable)
-            splices[current_definition].push_back (opcode);
+          const size_t base = literals.size () - arity;
+          std::vector<long long> args;
+          for (size_t k = base; k < literals.size (); ++k)
+            {
+              const Opcode * literal = opcodes_[literals[k].first];
+              args.push_back (literal->is_load_value_opcode ()
+                                  ->get_value ().get_value ());
+            }
+
+          const std::string word =
+              Mangler::demangle (call->get_symbol ()->get_name ());
+          long long result;
+          if (evaluate (word, args, bits, &result))
+            {
+              const LoadValueOpcode * first =
+                  opcodes_[literals[base].first]->is_load_value_opcode ();
+              replace_with (opcodes_.begin () + literals[base].first,
+                            new LoadValueOpcode (first->get_register (),
+                                                 Value (result),
+                                                 first->get_line ()));
+
+              for (size_t k = base + 1; k < literals.size (); ++k)
+                {
+                  replace_with_nop (opcodes_.begin () + literals[k].first);
+                  replace_with_nop (opcodes_.begin () + literals[k].second);
+                }
+              replace_with_nop (opcodes_.begin () + i);
+
+              literals.resize (base + 1);
+              ++optimizations;
+              continue;
+            }
         }
+
+      literals.clear ();
     }
 
-  // Build a new opcode vector with inlining.  Add a nop optimizing out
+  return optimizations;
+}
+
+// Intrinsic words, and the opcodes that implement them.
+namespace {
+
+enum IntrinsicKind { ADD, SUBTRACT, AND, OR, XOR, SHIFT_LEFT, SHIFT_RIGHT,
+                     COMPARE, NEGATE, INVERT, INCREMENT, DECREMENT,
+                     CELL_INCREMENT, DOUBLE, COMPARE_ZERO };
+
+struct Intrinsic
+{
+  const char * word;
+  IntrinsicKind kind;
+  Condition condition;
+};
+
+const Intrinsic INTRINSICS[] = {
+  { "+", ADD, EQUAL }, { "-", SUBTRACT, EQUAL }, { "and", AND, EQUAL },
+  { "or", OR, EQUAL }, { "xor", XOR, EQUAL },
+  { "lshift", SHIFT_LEFT, EQUAL }, { "rshift", SHIFT_RIGHT, EQUAL },
+  { "=", COMPARE, EQUAL }, { "<>", COMPARE, NOT_EQUAL },
+  { "<", COMPARE, LESS }, { ">", COMPARE, GREATER },
+  { "<=", COMPARE, LESS_EQUAL }, { ">=", COMPARE, GREATER_EQUAL },
+  { "u<", COMPARE, BELOW }, { "u>", COMPARE, ABOVE },
+  { "u<=", COMPARE, BELOW_EQUAL }, { "u>=", COMPARE, ABOVE_EQUAL },
+  { "negate", NEGATE, EQUAL }, { "invert", INVERT, EQUAL },
+  { "1+", INCREMENT, EQUAL }, { "1-", DECREMENT, EQUAL },
+  { "cell+", CELL_INCREMENT, EQUAL }, { "2*", DOUBLE, EQUAL },
+  { "0=", COMPARE_ZERO, EQUAL }, { "0<>", COMPARE_ZERO, NOT_EQUAL },
+  { "0<", COMPARE_ZERO, LESS }, { "0>", COMPARE_ZERO, GREATER },
+  { 0, ADD, EQUAL }
+};
+
+// Return the intrinsic for a word, or null if it has none.
+const Intrinsic *
+find_intrinsic (const std::string & word)
+{
+  for (int i = 0; INTRINSICS[i].word; ++i)
+    {
+      if (word == INTRINSICS[i].word)
+        return INTRINSICS + i;
+    }
+  return 0;
+}
+
+// Return opcodes that implement an intrinsic.  Binary intrinsics pop their
+// second argument into R1 and their first into R0, and unary ones pop into
+// R0.  All leave the result in R0 and push it.
+std::vector<Opcode *>
+expand_intrinsic (const Intrinsic & intrinsic, int line, int cell_size)
+{
+  std::vector<Opcode *> opcodes;
+  const Register & r0 = Register::R0;
+  const Register & r1 = Register::R1;
+
+  Opcode * operation = 0;
+  switch (intrinsic.kind)
+    {
+    case ADD:
+      operation = new AddRegisterOpcode (r0, r1, line);
+      break;
+    case SUBTRACT:
+      operation = new SubtractRegisterOpcode (r0, r1, line);
+      break;
+    case AND:
+      operation = new AndRegisterOpcode (r0, r1, line);
+      break;
+    case OR:
+      operation = new OrRegisterOpcode (r0, r1, line);
+      break;
+    case XOR:
+      operation = new XorRegisterOpcode (r0, r1, line);
+      break;
+    case SHIFT_LEFT:
+      operation = new ShiftLeftRegisterOpcode (r0, r1, line);
+      break;
+    case SHIFT_RIGHT:
+      operation = new ShiftRightRegisterOpcode (r0, r1, line);
+      break;
+    case COMPARE:
+      operation = new CompareRegisterOpcode (r0, r1,
+                                             intrinsic.condition, line);
+      break;
+    case NEGATE:
+      operation = new NegateOpcode (r0, line);
+      break;
+    case INVERT:
+      operation = new InvertOpcode (r0, line);
+      break;
+    case INCREMENT:
+      operation = new AddValueOpcode (r0, Value (1), line);
+      break;
+    case DECREMENT:
+      operation = new SubtractValueOpcode (r0, Value (1), line);
+      break;
+    case CELL_INCREMENT:
+      operation = new AddValueOpcode (r0, Value (cell_size), line);
+      break;
+    case DOUBLE:
+      operation = new AddRegisterOpcode (r0, r0, line);
+      break;
+    case COMPARE_ZERO:
+      operation = new CompareZeroOpcode (r0, intrinsic.condition, line);
+      break;
+    }
+
+  const bool is_binary = intrinsic.kind < NEGATE;
+  if (is_binary)
+    opcodes.push_back (new PopOpcode (r1, Stack::DATA, line));
+  opcodes.push_back (new PopOpcode (r0, Stack::DATA, line));
+  opcodes.push_back (operation);
+  opcodes.push_back (new PushOpcode (r0, Stack::DATA, line));
+  return opcodes;
+}
+
+// Return the condition that holds when a condition does not.
+Condition
+invert_condition (Condition condition)
+{
+  static const Condition inverses[] = { NOT_EQUAL, EQUAL, GREATER_EQUAL,
+                                        LESS_EQUAL, GREATER, LESS,
+                                        ABOVE_EQUAL, BELOW_EQUAL,
+                                        ABOVE, BELOW };
+  return inverses[condition];
+}
+
+// Find a branch on a comparison's flag, as from IF, WHILE or UNTIL, where
+// the comparison at iter is followed by a pop of its flag into R0 and a
+// branch on R0, ignoring no-ops.  Return the branch, and set the condition
+// under which the branch is taken, or return end if there is none.
+std::vector<Opcode *>::iterator
+find_flag_branch (std::vector<Opcode *>::iterator iter,
+                  std::vector<Opcode *>::iterator end,
+                  Condition condition, Condition * taken)
+{
+  const Register & r0 = Register::R0;
+
+  do
+    ++iter;
+  while (iter != end && (*iter)->is_noop_opcode ());
+  const PopOpcode * pop = iter != end ? (*iter)->is_pop_opcode () : 0;
+  if (!(pop && pop->get_stack ().equals (Stack::DATA)
+        && pop->get_register ().equals (r0)))
+    return end;
+
+  do
+    ++iter;
+  while (iter != end && (*iter)->is_noop_opcode ());
+  if (iter == end)
+    return end;
+
+  const JumpZeroOpcode * zero = (*iter)->is_jump_zero_opcode ();
+  const JumpNonZeroOpcode * nonzero = (*iter)->is_jump_nonzero_opcode ();
+  if (zero && zero->get_register ().equals (r0))
+    *taken = invert_condition (condition);
+  else if (nonzero && nonzero->get_register ().equals (r0))
+    *taken = condition;
+  else
+    return end;
+
+  return iter;
+}
+
+// Return opcodes that implement a comparison intrinsic fused with a branch
+// on its flag, so that the flag is never set.  The branch goes to label if
+// the given condition holds.
+std::vector<Opcode *>
+expand_compare_branch (const Intrinsic & intrinsic, Condition condition,
+                       const Label & label, int line)
+{
+  std::vector<Opcode *> opcodes;
+  const Register & r0 = Register::R0;
+  const Register & r1 = Register::R1;
+
+  if (intrinsic.kind == COMPARE)
+    {
+      opcodes.push_back (new PopOpcode (r1, Stack::DATA, line));
+      opcodes.push_back (new PopOpcode (r0, Stack::DATA, line));
+      opcodes.push_back (new JumpCompareOpcode (r0, r1, condition,
+                                                label, line));
+      return opcodes;
+    }
+
+  // Comparisons with zero are signed only.
+  opcodes.push_back (new PopOpcode (r0, Stack::DATA, line));
+  switch (condition)
+    {
+    case EQUAL:
+      opcodes.push_back (new JumpZeroOpcode (r0, label, line));
+      break;
+    case NOT_EQUAL:
+      opcodes.push_back (new JumpNonZeroOpcode (r0, label, line));
+      break;
+    case LESS:
+      opcodes.push_back (new JumpLessZeroOpcode (r0, label, line));
+      break;
+    case GREATER:
+      opcodes.push_back (new JumpGreaterZeroOpcode (r0, label, line));
+      break;
+    case LESS_EQUAL:
+      opcodes.push_back (new JumpLessEqualZeroOpcode (r0, label, line));
+      break;
+    default:
+      assert (condition == GREATER_EQUAL);
+      opcodes.push_back (new JumpGreaterEqualZeroOpcode (r0, label, line));
+      break;
+    }
+  return opcodes;
+}
+
+} // namespace
+
+// Replace calls to intrinsic arithmetic, logic and comparison words with
+// inline opcodes.  Words that the program defines are left alone.  Where a
+// comparison's flag goes straight to a branch, compare and branch directly.
+int
+OpcodeTable::expand_intrinsics (const Options & options)
+{
+  int optimizations = 0;
+  const int cell_size = options.target_x86_64 () ? 8 : 4;
+  const std::set<const Symbol *> & defined = get_defined_symbols ();
+
+  // Build a new opcode vector with expansions.  Add a nop optimizing out
   // the call as an indicator we can find in the intermediate output file.
-  OpcodeTableStore inlined;
+  OpcodeTableStore expanded;
 
   for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
        iter != opcodes_.end (); ++iter)
@@ -340,280 +845,2485 @@ OpcodeTable::inline_small_functions ()
       Opcode * opcode = *iter;
 
       const CallOpcode * call = opcode->is_call_opcode ();
+      const Intrinsic * intrinsic = 0;
+      if (call && defined.find (call->get_symbol ()) == defined.end ())
+        {
+          const Symbol * symbol = call->get_symbol ();
+          intrinsic = find_intrinsic (Mangler::demangle (symbol->get_name ()));
+        }
+
+      Condition taken = EQUAL;
+      OpcodeTableIterator_mutable branch = opcodes_.end ();
+      if (intrinsic
+          && (intrinsic->kind == COMPARE || intrinsic->kind == COMPARE_ZERO))
+        branch = find_flag_branch (iter, opcodes_.end (),
+                                   intrinsic->condition, &taken);
 
-      if (call && splices.find (call->get_symbol ()) != splices.end ())
+      if (branch != opcodes_.end ())
         {
+          const Label label = (*branch)->is_branching_opcode ()->get_label ();
+
           // Important: after replace_with_nop, opcode != *iter.
           replace_with_nop (iter);
-          inlined.push_back (*iter);
+          expanded.push_back (*iter);
 
-          const Symbol * symbol = call->get_symbol ();
-          inlined.insert (inlined.end (),
-                          splices[symbol].begin (), splices[symbol].end ());
+          const std::vector<Opcode *> opcodes =
+              expand_compare_branch (*intrinsic, taken, label,
+                                     opcode->get_line ());
+          opcode_collection_.insert (opcode_collection_.end (),
+                                     opcodes.begin (), opcodes.end ());
+          expanded.insert (expanded.end (), opcodes.begin (), opcodes.end ());
+
+          // Carry over no-ops, and remove the flag's pop and branch.
+          while (iter != branch)
+            {
+              ++iter;
+              if (!(*iter)->is_noop_opcode ())
+                replace_with_nop (iter);
+              expanded.push_back (*iter);
+            }
+
+          ++optimizations;
+        }
+      else if (intrinsic)
+        {
+          // Important: after replace_with_nop, opcode != *iter.
+          replace_with_nop (iter);
+          expanded.push_back (*iter);
+
+          const std::vector<Opcode *> opcodes =
+              expand_intrinsic (*intrinsic, opcode->get_line (), cell_size);
+          opcode_collection_.insert (opcode_collection_.end (),
+                                     opcodes.begin (), opcodes.end ());
+          expanded.insert (expanded.end (), opcodes.begin (), opcodes.end ());
 
           ++optimizations;
         }
       else
-        inlined.push_back (opcode);
+        expanded.push_back (opcode);
     }
 
   // Replace the old opcode vector with the new one.
   if (optimizations)
-    opcodes_.assign (inlined.begin (), inlined.end ());
+    opcodes_.assign (expanded.begin (), expanded.end ());
 
   return optimizations;
 }
 
-// Replace amenable adjacent push-pop pairs with a shorter representation.
-int
-OpcodeTable::replace_adjacent_push_pop_pairs ()
-{
-  int optimizations = 0;
-
-  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
-       iter != opcodes_.end (); )
-    {
-      // Find the next push opcode.
-      const OpcodeTableIterator_mutable first =
-          std::find_if (iter, opcodes_.end (),
-                        std::mem_fun (&Opcode::is_push_opcode));
-      if (first == opcodes_.end ())
-        break;
-
-      // Find the non-no-op opcode following this one.
-      const OpcodeTableIterator_mutable second =
-          std::find_if (first + 1, opcodes_.end (),
-                        std::not1 (std::mem_fun (&Opcode::is_noop_opcode)));
-      if (second == opcodes_.end ())
-        break;
+namespace {
 
-      const PushOpcode * push = (*first)->is_push_opcode ();
-      const PopOpcode * pop = (*second)->is_pop_opcode ();
+// Runtime words that multiply or divide by their second argument, where
+// a literal second argument allows a cheaper operation than the call.
+enum ReductionKind { MULTIPLY, DIVIDE, REMAINDER };
 
-      // If we have a push-pop pair then there may be something to optimize.
-      // Replace if the pop pops the stack just pushed.
-      if (pop && push->get_stack ().equals (pop->get_stack ()))
-        {
-          // Either eliminate or transform into register to register move.
-          // Always eliminate the second opcode of the pair.
-          Opcode * opcode;
-          if (push->get_register ().equals (pop->get_register ()))
-            opcode = new NoOpOpcode (push->get_line ());
-          else
-            opcode = new LoadRegisterOpcode (pop->get_register (),
-                                             push->get_register (),
-                                             push->get_line ());
-          replace_with (first, opcode);
-          replace_with_nop (second);
+struct Reduction
+{
+  const char * word;
+  ReductionKind kind;
+};
 
-          ++optimizations;
-        }
+const Reduction REDUCTIONS[] = {
+  { "*", MULTIPLY }, { "/", DIVIDE }, { "mod", REMAINDER }, { 0, MULTIPLY }
+};
 
-      iter = second;
+// Return the reduction for a word, or null if it has none.
+const Reduction *
+find_reduction (const std::string & word)
+{
+  for (int i = 0; REDUCTIONS[i].word; ++i)
+    {
+      if (word == REDUCTIONS[i].word)
+        return REDUCTIONS + i;
     }
+  return 0;
+}
 
-  return optimizations;
+// Return opcodes that apply operation to the top of the data stack.
+std::vector<Opcode *>
+expand_reduction (Opcode * operation, int line)
+{
+  std::vector<Opcode *> opcodes;
+  opcodes.push_back (new PopOpcode (Register::R0, Stack::DATA, line));
+  opcodes.push_back (operation);
+  opcodes.push_back (new PushOpcode (Register::R0, Stack::DATA, line));
+  return opcodes;
 }
 
-// Relocate any suboptimal labels to more optimal positions.
+} // namespace
+
+// Replace multiplication and division by literal values, and CELLS, with
+// inline shifts, lea, or multiplication by a reciprocal.  Division keeps
+// the symmetric semantics of the runtime's / and MOD.  Division by zero,
+// and by -1, which overflows on the most negative cell, still calls the
+// runtime so that it throws or traps just as it would unoptimized.
 int
-OpcodeTable::relocate_suboptimal_labels ()
+OpcodeTable::reduce_strength (const Options & options)
 {
   int optimizations = 0;
+  const int cell_size = options.target_x86_64 () ? 8 : 4;
+  const std::set<const Symbol *> & defined = get_defined_symbols ();
 
-  // Find labels whose directly following opcode is an unconditional goto.
-  // Handle only forwards branches to avoid possible infinite loop issues.
-  // These are the common cases, arising from conditionals and loop leave.
-  std::map<int, int> relocations;
-  std::map<int, int> label_lines;
-  const LabelOpcode * current_label = 0;
+  OpcodeTableStore reduced;
 
-  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
-       iter != opcodes_.end (); ++iter)
+  for (size_t i = 0; i < opcodes_.size (); ++i)
     {
-      Opcode * opcode = *iter;
+      Opcode * opcode = opcodes_[i];
+      reduced.push_back (opcode);
 
-      if (opcode->is_label_opcode ())
+      // Find a call, directly or after a pushed literal, to a runtime word.
+      const LoadValueOpcode * load = opcode->is_load_value_opcode ();
+      size_t push = i, call = i;
+      if (load)
         {
-          current_label = opcode->is_label_opcode ();
-
-          const int value = current_label->get_label ().get_value ();
-          label_lines[value] = opcode->get_line ();
+          push = skip_noops (opcodes_, i + 1);
+          call = skip_noops (opcodes_, push + 1);
+          if (call >= opcodes_.size ()
+              || !is_data_push (opcodes_[push], load->get_register ()))
+            continue;
         }
 
-      else if (opcode->is_jump_opcode ())
-        {
-          if (current_label) {
-            const JumpOpcode * jump_opcode = opcode->is_jump_opcode ();
-            const Label & label = jump_opcode->get_label ();
+      const CallOpcode * called = opcodes_[call]->is_call_opcode ();
+      if (!called || defined.find (called->get_symbol ()) != defined.end ())
+        continue;
 
-            // Pick up only forwards branches.
-            const int value = current_label->get_label ().get_value ();
-            if (label.get_value () > value)
-              relocations[value] = label.get_value ();
-          }
+      const std::string word = Mangler::demangle (called->get_symbol ()
+                                                  ->get_name ());
+      const int line = opcodes_[call]->get_line ();
+      Opcode * operation = 0;
 
-          current_label = 0;
+      if (!load && word == "cells")
+        operation = new MultiplyValueOpcode (Register::R0,
+                                             Value (cell_size), line);
+      else if (load)
+        {
+          const Reduction * reduction = load->get_value ().is_immediate ()
+                                        ? find_reduction (word) : 0;
+          const int value = load->get_value ().get_value ();
+
+          if (reduction && reduction->kind == MULTIPLY)
+            operation = new MultiplyValueOpcode (Register::R0,
+                                                 Value (value), line);
+          else if (reduction && value != 0 && value != -1
+                   && value != INT_MIN)
+            operation = new DivideValueOpcode (Value (value),
+                                               reduction->kind == REMAINDER,
+                                               line);
         }
+      if (!operation)
+        continue;
 
-      else if (!opcode->is_noop_opcode ())
-        current_label = 0;
-    }
-
-  // Advance each suboptimal label as far forwards as possible.
-  for (std::map<int, int>::const_iterator iter = relocations.begin ();
-       iter != relocations.end (); ++iter)
-    {
-      const int value = iter->first;
-      const int relocation = iter->second;
+      // Replace the literal and the call, carrying over no-ops.
+      reduced.pop_back ();
+      for (size_t j = i; j < call; ++j)
+        {
+          if (!opcodes_[j]->is_noop_opcode ())
+            replace_with_nop (opcodes_.begin () + j);
+          reduced.push_back (opcodes_[j]);
+        }
+      replace_with_nop (opcodes_.begin () + call);
+      reduced.push_back (opcodes_[call]);
 
-      int forwards = relocation;
-      while (relocations.find (forwards) != relocations.end ())
-        forwards = relocations[forwards];
+      const std::vector<Opcode *> opcodes = expand_reduction (operation,
+                                                              line);
+      opcode_collection_.insert (opcode_collection_.end (),
+                                 opcodes.begin (), opcodes.end ());
+      reduced.insert (reduced.end (), opcodes.begin (), opcodes.end ());
 
-      relocations[value] = forwards;
+      i = call;
+      ++optimizations;
     }
 
-  // Build splices to relocate these labels.
-  std::map<int, OpcodeTableStore> splices;
-  for (std::map<int, int>::const_iterator iter = relocations.begin ();
-       iter != relocations.end (); ++iter)
-    {
-      const int value = iter->first;
-      const int relocation = iter->second;
+  if (optimizations)
+    opcodes_.assign (reduced.begin (), reduced.end ());
+
+  return optimizations;
+}
+
+namespace {
+
+// Runtime words that fetch from or store to a variable whose address is
+// pushed just ahead of the call.
+enum AccessKind { FETCH, STORE, ADD_STORE };
+
+struct Access
+{
+  const char * word;
+  AccessKind kind;
+};
+
+const Access ACCESSES[] = {
+  { "@", FETCH }, { "!", STORE }, { "+!", ADD_STORE }, { 0, FETCH }
+};
+
+// Return the access for a word, or null if it has none.
+const Access *
+find_access (const std::string & word)
+{
+  for (int i = 0; ACCESSES[i].word; ++i)
+    {
+      if (word == ACCESSES[i].word)
+        return ACCESSES + i;
+    }
+  return 0;
+}
+
+// Runtime variables that hold the data stack and its index.  Stack cells
+// may be in registers, and the index stale, until a call, so these are
+// read and written only through calls.
+const char * const STACK_VARIABLES[] = { "_dsindex", "_dstack", 0 };
+
+// Return true if a variable holds the data stack or its index.
+bool
+is_stack_variable (const Symbol * symbol)
+{
+  const std::string name = Mangler::demangle (symbol->get_name ());
+  for (int i = 0; STACK_VARIABLES[i]; ++i)
+    {
+      if (name == STACK_VARIABLES[i])
+        return true;
+    }
+  return false;
+}
+
+// Return opcodes that access a variable's cell directly.
+std::vector<Opcode *>
+expand_access (const Access & access, const Symbol * symbol, int line)
+{
+  std::vector<Opcode *> opcodes;
+  const Register & r0 = Register::R0;
+  const Register & r1 = Register::R1;
+
+  switch (access.kind)
+    {
+    case FETCH:
+      opcodes.push_back (new LoadSymbolIndirectOpcode (r0, symbol, line));
+      opcodes.push_back (new PushOpcode (r0, Stack::DATA, line));
+      break;
+    case STORE:
+      opcodes.push_back (new PopOpcode (r0, Stack::DATA, line));
+      opcodes.push_back (new StoreSymbolIndirectOpcode (r0, symbol, line));
+      break;
+    case ADD_STORE:
+      opcodes.push_back (new PopOpcode (r0, Stack::DATA, line));
+      opcodes.push_back (new LoadSymbolIndirectOpcode (r1, symbol, line));
+      opcodes.push_back (new AddRegisterOpcode (r0, r1, line));
+      opcodes.push_back (new StoreSymbolIndirectOpcode (r0, symbol, line));
+      break;
+    }
+  return opcodes;
+}
+
+} // namespace
+
+// Replace calls to the runtime's @, ! and +! on a variable named just
+// ahead of the call with loads and stores of the variable's cell.  The
+// data stack's own variables are left alone.
+int
+OpcodeTable::expand_variable_accesses (const Options &)
+{
+  int optimizations = 0;
+  const std::set<const Symbol *> & defined = get_defined_symbols ();
+
+  OpcodeTableStore expanded;
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      Opcode * opcode = opcodes_[i];
+      expanded.push_back (opcode);
+
+      const LoadSymbolOpcode * load = opcode->is_load_symbol_opcode ();
+      if (!(load && load->get_symbol ()->is_variable_symbol ()
+            && !is_stack_variable (load->get_symbol ())))
+        continue;
+
+      const size_t push = skip_noops (opcodes_, i + 1);
+      const size_t call = skip_noops (opcodes_, push + 1);
+      if (call >= opcodes_.size ()
+          || !is_data_push (opcodes_[push], load->get_register ()))
+        continue;
+
+      const CallOpcode * called = opcodes_[call]->is_call_opcode ();
+      if (!called || defined.find (called->get_symbol ()) != defined.end ())
+        continue;
+
+      const Access * access = find_access (Mangler::demangle (
+                                  called->get_symbol ()->get_name ()));
+      if (!access)
+        continue;
+
+      // Replace the address push and the call, carrying over no-ops.
+      expanded.pop_back ();
+      for (size_t j = i; j <= call; ++j)
+        {
+          if (!opcodes_[j]->is_noop_opcode ())
+            replace_with_nop (opcodes_.begin () + j);
+          expanded.push_back (opcodes_[j]);
+        }
+
+      const std::vector<Opcode *> opcodes =
+          expand_access (*access, load->get_symbol (),
+                         opcodes_[call]->get_line ());
+      opcode_collection_.insert (opcode_collection_.end (),
+                                 opcodes.begin (), opcodes.end ());
+      expanded.insert (expanded.end (), opcodes.begin (), opcodes.end ());
+
+      i = call;
+      ++optimizations;
+    }
+
+  if (optimizations)
+    opcodes_.assign (expanded.begin (), expanded.end ());
+
+  return optimizations;
+}
+
+namespace {
+
+// Return true if an opcode ends the straight-line code over which a
+// register is known to hold a copy of a variable's cell.
+bool
+is_access_block_boundary (const Opcode * opcode)
+{
+  return opcode->is_label_opcode ()
+         || opcode->is_branching_opcode ()
+         || opcode->is_define_opcode ()
+         || opcode->is_enddefine_opcode ()
+         || clobbers_registers (opcode);
+}
+
+} // namespace
+
+// Remove redundant loads and stores of variable and constant cells within
+// basic blocks.  A load of a cell that a register already holds, from an
+// earlier load or a store, becomes a register copy or goes, and a store
+// of the value a cell already holds goes.  A store that a later one to
+// the same variable overwrites before any load of it also goes.  Calls may
+// read or write any variable, and so end a block, as do inline assembly,
+// labels and branches.
+int
+OpcodeTable::remove_redundant_accesses (const Options &)
+{
+  int optimizations = 0;
+
+  static const Register * const registers[] = {
+    &Register::R0, &Register::R1, &Register::R2, &Register::R3, &Register::R4
+  };
+  static const size_t count = sizeof (registers) / sizeof (registers[0]);
+
+  // The symbol whose cell each register holds, and the last store to each
+  // variable not yet followed by a load.
+  const Symbol * holds[count] = { 0 };
+  std::map<const Symbol *, size_t> stores;
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      const Opcode * opcode = opcodes_[i];
+      if (opcode->is_noop_opcode ())
+        continue;
+
+      if (is_access_block_boundary (opcode))
+        {
+          std::fill (holds, holds + count, static_cast<const Symbol *> (0));
+          stores.clear ();
+          continue;
+        }
+
+      const LoadSymbolIndirectOpcode * load
+          = opcode->is_load_symbol_indirect_opcode ();
+      const StoreSymbolIndirectOpcode * store
+          = opcode->is_store_symbol_indirect_opcode ();
+      const Symbol * symbol = load ? load->get_symbol ()
+                              : store ? store->get_symbol () : 0;
+      const Register * reg = load ? &load->get_register ()
+                             : store ? &store->get_register () : 0;
+
+      size_t holder = count, target = count;
+      for (size_t k = 0; k < count; ++k)
+        {
+          if (symbol && holds[k] == symbol && holder == count)
+            holder = k;
+          if (reg && registers[k]->equals (*reg))
+            target = k;
+        }
+
+      if (symbol && symbol->is_floatconstant_symbol ())
+        {
+          load = 0;
+          store = 0;
+        }
+
+      // A load that becomes a copy or goes no longer reads the cell.
+      if (load && holder == target)
+        {
+          replace_with_nop (opcodes_.begin () + i);
+          ++optimizations;
+          continue;
+        }
+      if (load && holder < count)
+        {
+          replace_with (opcodes_.begin () + i,
+                        new LoadRegisterOpcode (*reg, *registers[holder],
+                                                load->get_line ()));
+          holds[target] = symbol;
+          ++optimizations;
+          continue;
+        }
+
+      if (store && !symbol->is_variable_symbol ())
+        store = 0;
+      if (store && holds[target] == symbol)
+        {
+          replace_with_nop (opcodes_.begin () + i);
+          ++optimizations;
+          continue;
+        }
+      if (store)
+        {
+          const std::map<const Symbol *, size_t>::iterator earlier
+              = stores.find (symbol);
+          if (earlier != stores.end ())
+            {
+              replace_with_nop (opcodes_.begin () + earlier->second);
+              ++optimizations;
+            }
+          stores[symbol] = i;
+
+          for (size_t k = 0; k < count; ++k)
+            {
+              if (holds[k] == symbol || registers[k]->equals (Register::R2))
+                holds[k] = 0;
+            }
+          holds[target] = symbol;
+          continue;
+        }
+
+      // Forget registers that this opcode changes.  In PIC code, cell
+      // loads and stores may also use R2 to address the cell.
+      for (size_t k = 0; k < count; ++k)
+        {
+          if (opcode->modifies_register (*registers[k])
+              || (symbol && registers[k]->equals (Register::R2)))
+            holds[k] = 0;
+        }
+      if (load)
+        {
+          holds[target] = symbol;
+          stores.erase (symbol);
+        }
+    }
+
+  return optimizations;
+}
+
+namespace {
+
+// A definition's body, as spliced in place of calls to it, with the count
+// of its executable opcodes.
+struct InlineBody
+{
+  std::vector<Opcode *> opcodes;
+  int size;
+  bool is_branching;
+};
+
+// Return the number of loops enclosing each opcode, where a loop runs from
+// a label to the last branch back to it.
+std::vector<int>
+find_loop_depths (const std::vector<Opcode *> & opcodes)
+{
+  std::map<int, size_t> labels;
+  std::map<size_t, size_t> loops;
+  for (size_t i = 0; i < opcodes.size (); ++i)
+    {
+      const Opcode * opcode = opcodes[i];
+
+      if (const LabelOpcode * label = opcode->is_label_opcode ())
+        labels[label->get_label ().get_value ()] = i;
+      else if (const BranchingOpcode * branch = opcode->is_branching_opcode ())
+        {
+          const std::map<int, size_t>::const_iterator found =
+              labels.find (branch->get_label ().get_value ());
+          if (found != labels.end ())
+            loops[found->second] = i;
+        }
+    }
+
+  std::vector<int> depths (opcodes.size () + 1, 0);
+  for (std::map<size_t, size_t>::const_iterator
+       iter = loops.begin (); iter != loops.end (); ++iter)
+    {
+      ++depths[iter->first];
+      --depths[iter->second + 1];
+    }
+  for (size_t i = 1; i < depths.size (); ++i)
+    depths[i] += depths[i - 1];
+  return depths;
+}
+
+// Return the words that can call themselves, directly or through other
+// words in calls.  These are the words in call graph cycles, found as the
+// strongly connected components of Tarjan's algorithm, iterating with an
+// explicit stack of words and their next callee to visit.
+std::set<const Symbol *>
+find_recursive_words (const std::map<const Symbol *,
+                                     std::set<const Symbol *> > & calls)
+{
+  typedef std::map<const Symbol *, std::set<const Symbol *> > CallGraph;
+  typedef std::set<const Symbol *>::const_iterator CalleeIterator;
+
+  std::map<const Symbol *, int> indexes, lowlinks;
+  std::vector<const Symbol *> components;
+  std::set<const Symbol *> is_on_components;
+  std::vector<std::pair<CallGraph::const_iterator, CalleeIterator> > stack;
+  std::set<const Symbol *> recursive;
+  int next_index = 0;
+
+  for (CallGraph::const_iterator
+       root = calls.begin (); root != calls.end (); ++root)
+    {
+      if (indexes.find (root->first) != indexes.end ())
+        continue;
+
+      stack.push_back (std::make_pair (root, root->second.begin ()));
+      indexes[root->first] = lowlinks[root->first] = next_index++;
+      components.push_back (root->first);
+      is_on_components.insert (root->first);
+
+      while (!stack.empty ())
+        {
+          const CallGraph::const_iterator word = stack.back ().first;
+          const Symbol * symbol = word->first;
+          CalleeIterator & callee = stack.back ().second;
+
+          if (callee != word->second.end ())
+            {
+              const Symbol * next = *callee++;
+              if (next == symbol)
+                recursive.insert (symbol);
+
+              const CallGraph::const_iterator found = calls.find (next);
+              if (found == calls.end ())
+                continue;
+
+              if (indexes.find (next) == indexes.end ())
+                {
+                  stack.push_back (std::make_pair (found,
+                                                   found->second.begin ()));
+                  indexes[next] = lowlinks[next] = next_index++;
+                  components.push_back (next);
+                  is_on_components.insert (next);
+                }
+              else if (is_on_components.find (next)
+                       != is_on_components.end ())
+                lowlinks[symbol] = std::min (lowlinks[symbol], indexes[next]);
+              continue;
+            }
+
+          // All callees visited; pop a component rooted here, noting it
+          // if it has more than one word.
+          stack.pop_back ();
+          if (!stack.empty ())
+            {
+              const Symbol * caller = stack.back ().first->first;
+              lowlinks[caller] = std::min (lowlinks[caller],
+                                           lowlinks[symbol]);
+            }
+          if (lowlinks[symbol] != indexes[symbol])
+            continue;
+
+          const bool is_cycle = components.back () != symbol;
+          const Symbol * member = 0;
+          do
+            {
+              member = components.back ();
+              components.pop_back ();
+              is_on_components.erase (member);
+              if (is_cycle)
+                recursive.insert (member);
+            }
+          while (member != symbol);
+        }
+    }
+  return recursive;
+}
+
+} // namespace
+
+// Inline functions where the cost model allows.  Small straight-line
+// definitions always inline, as a call costs about as much as the body.
+// Others inline where their size is within a limit that rises with the
+// loop nesting depth of the call, while the module's growth budget lasts;
+// a word hinted inline inlines regardless.  At -O3, the limit and budget
+// are twice as large.  Labels in branching bodies are
+// cloned, so that each copy branches within itself.
+int
+OpcodeTable::inline_functions (const Options & options)
+{
+  int optimizations = 0;
+
+  // Collect definition bodies and the words each calls, noting those that
+  // may not be inlined, and find the next free label.
+  std::map<const Symbol *, InlineBody> bodies;
+  std::map<const Symbol *, std::set<const Symbol *> > calls;
+  std::set<const Symbol *> excluded;
+  const Symbol * current_definition = 0;
+  int next_label = 0;
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      Opcode * opcode = opcodes_[i];
+
+      if (const LabelOpcode * label = opcode->is_label_opcode ())
+        {
+          const int value = label->get_label ().get_value ();
+          next_label = std::max (next_label, value + 1);
+        }
+
+      if (const DefineOpcode * define = opcode->is_define_opcode ())
+        {
+          current_definition = define->get_symbol ();
+          bodies[current_definition].size = 0;
+          bodies[current_definition].is_branching = false;
+          calls[current_definition];
+        }
+      else if (opcode->is_enddefine_opcode ())
+        {
+          current_definition = 0;
+        }
+      else if (current_definition && !opcode->is_noop_opcode ())
+        {
+          InlineBody & body = bodies[current_definition];
+          body.opcodes.push_back (opcode);
+          if (opcode->is_label_opcode ())
+            continue;
+
+          ++body.size;
+          body.is_branching |= opcode->is_branching_opcode () != 0;
+
+          if (opcode->is_assembly_opcode ()
+              || opcode->is_jump_table_opcode ()
+              || opcode->is_tail_call_opcode ())
+            excluded.insert (current_definition);
+
+          if (const CallOpcode * call = opcode->is_call_opcode ())
+            {
+              calls[current_definition].insert (call->get_symbol ());
+              if (is_frame_inspector (call->get_symbol ()))
+                excluded.insert (current_definition);
+            }
+        }
+    }
+
+  const std::set<const Symbol *> recursive = find_recursive_words (calls);
+  excluded.insert (recursive.begin (), recursive.end ());
+  for (std::map<const Symbol *, bool>::const_iterator
+       iter = inline_hints_.begin (); iter != inline_hints_.end (); ++iter)
+    {
+      if (!iter->second)
+        excluded.insert (iter->first);
+    }
+
+  // Build a new opcode vector with inlining.  Add a nop optimizing out
+  // the call as an indicator we can find in the intermediate output file.
+  const std::vector<int> depths = find_loop_depths (opcodes_);
+  const int maximum = options.optimize_level () > 2
+                      ? 2 * INLINE_OPCODE_MAXIMUM : INLINE_OPCODE_MAXIMUM;
+  OpcodeTableStore inlined;
+
+  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
+       iter != opcodes_.end (); ++iter)
+    {
+      Opcode * opcode = *iter;
+
+      const CallOpcode * call = opcode->is_call_opcode ();
+      const Symbol * symbol = call ? call->get_symbol () : 0;
+      const std::map<const Symbol *, InlineBody>::const_iterator found =
+          symbol ? bodies.find (symbol) : bodies.end ();
+
+      if (found == bodies.end () || excluded.find (symbol) != excluded.end ())
+        {
+          inlined.push_back (opcode);
+          continue;
+        }
+
+      // Charge anything but a small straight-line body to the budget.
+      const InlineBody & body = found->second;
+      if (body.is_branching || body.size > SMALL_FUNCTION_OPCODE_LIMIT)
+        {
+          const int depth = depths[iter - opcodes_.begin ()];
+          const int limit = std::min (INLINE_OPCODE_LIMIT
+                                      + depth * INLINE_LOOP_BONUS,
+                                      maximum);
+          const int growth = body.size - 1;
+
+          const std::map<const Symbol *, bool>::const_iterator hint =
+              inline_hints_.find (symbol);
+          if ((hint == inline_hints_.end () || !hint->second)
+              && (body.size > limit || growth > inline_budget_))
+            {
+              inlined.push_back (opcode);
+              continue;
+            }
+          inline_budget_ = std::max (inline_budget_ - growth, 0);
+        }
+
+      // Important: after replace_with_nop, opcode != *iter.
+      replace_with_nop (iter);
+      inlined.push_back (*iter);
+
+      const size_t start = inlined.size ();
+      std::map<int, Label> clones;
+      for (size_t i = 0; i < body.opcodes.size (); ++i)
+        {
+          Opcode * splice = body.opcodes[i];
+
+          if (const LabelOpcode * label = splice->is_label_opcode ())
+            {
+              if (!body.is_branching)
+                continue;
+
+              const Label clone (next_label++);
+              clones.insert (std::make_pair (label->get_label ().get_value (),
+                                             clone));
+              splice = new LabelOpcode (clone, splice->get_line ());
+              opcode_collection_.push_back (splice);
+            }
+          inlined.push_back (splice);
+        }
+
+      // Retarget branches to the cloned labels, which may follow them.
+      for (size_t i = start; i < inlined.size (); ++i)
+        {
+          const BranchingOpcode * branch = inlined[i]->is_branching_opcode ();
+          if (!branch)
+            continue;
+
+          const std::map<int, Label>::const_iterator clone =
+              clones.find (branch->get_label ().get_value ());
+          if (clone != clones.end ())
+            {
+              inlined[i] = branch->retarget (clone->second);
+              opcode_collection_.push_back (inlined[i]);
+            }
+        }
+
+      ++optimizations;
+    }
+
+  // Replace the old opcode vector with the new one.
+  if (optimizations)
+    opcodes_.assign (inlined.begin (), inlined.end ());
+
+  return optimizations;
+}
+
+// Replace amenable adjacent push-pop pairs with a shorter representation.
+int
+OpcodeTable::replace_adjacent_push_pop_pairs (const Options &)
+{
+  int optimizations = 0;
+
+  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
+       iter != opcodes_.end (); )
+    {
+      // Find the next push opcode.
+      const OpcodeTableIterator_mutable first =
+          std::find_if (iter, opcodes_.end (),
+                        std::mem_fun (&Opcode::is_push_opcode));
+      if (first == opcodes_.end ())
+        break;
+
+      // Find the non-no-op opcode following this one.
+      const OpcodeTableIterator_mutable second =
+          std::find_if (first + 1, opcodes_.end (),
+                        std::not1 (std::mem_fun (&Opcode::is_noop_opcode)));
+      if (second == opcodes_.end ())
+        break;
+
+      const PushOpcode * push = (*first)->is_push_opcode ();
+      const PopOpcode * pop = (*second)->is_pop_opcode ();
+
+      // If we have a push-pop pair then there may be something to optimize.
+      // Replace if the pop pops the stack just pushed.
+      if (pop && push->get_stack ().equals (pop->get_stack ()))
+        {
+          // Either eliminate or transform into register to register move.
+          // Always eliminate the second opcode of the pair.
+          Opcode * opcode;
+          if (push->get_register ().equals (pop->get_register ()))
+            opcode = new NoOpOpcode (push->get_line ());
+          else
+            opcode = new LoadRegisterOpcode (pop->get_register (),
+                                             push->get_register (),
+                                             push->get_line ());
+          replace_with (first, opcode);
+          replace_with_nop (second);
+
+          ++optimizations;
+        }
+
+      iter = second;
+    }
+
+  return optimizations;
+}
+
+// Thread jumps through labels that lead straight to an unconditional
+// jump, conditional branches and backward jumps included, by relocating
+// each such label to the jump's destination.  Labels on a chain of jumps
+// that loops back on itself stay where they are.
+int
+OpcodeTable::relocate_suboptimal_labels (const Options &)
+{
+  int optimizations = 0;
+
+  // Find blocks holding only labels and an unconditional jump.
+  std::map<int, int> relocations;
+  std::map<int, int> label_lines;
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      if (!opcodes_[i]->is_define_opcode ())
+        continue;
+
+      const size_t end = find_definition_end (opcodes_, i);
+      const ControlFlowGraph cfg (opcodes_, i + 1, end);
+
+      for (size_t b = 0; b < cfg.get_block_count (); ++b)
+        {
+          const ControlFlowGraph::Block & block = cfg.get_block (b);
+          std::vector<const Opcode *> labels;
+          const JumpOpcode * jump = 0;
+
+          size_t j = block.begin;
+          for (; j < block.end; ++j)
+            {
+              const Opcode * opcode = opcodes_[j];
+              if (opcode->is_label_opcode ())
+                labels.push_back (opcode);
+              else if (!opcode->is_noop_opcode ())
+                break;
+            }
+          if (j < block.end)
+            jump = opcodes_[j]->is_jump_opcode ();
+          if (!jump || skip_noops (opcodes_, j + 1) < block.end)
+            continue;
+
+          for (size_t k = 0; k < labels.size (); ++k)
+            {
+              const int value = labels[k]->is_label_opcode ()
+                                ->get_label ().get_value ();
+              relocations[value] = jump->get_label ().get_value ();
+              label_lines[value] = labels[k]->get_line ();
+            }
+        }
+      i = end;
+    }
+
+  // Advance each suboptimal label as far forwards as possible, leaving
+  // any whose chain of jumps forms a cycle.
+  std::set<int> cycles;
+  for (std::map<int, int>::const_iterator iter = relocations.begin ();
+       iter != relocations.end (); ++iter)
+    {
+      const int value = iter->first;
+      std::set<int> visited;
+      visited.insert (value);
+
+      int forwards = iter->second;
+      while (relocations.find (forwards) != relocations.end ()
+             && visited.insert (forwards).second)
+        forwards = relocations[forwards];
+
+      if (visited.count (forwards))
+        cycles.insert (value);
+      else
+        relocations[value] = forwards;
+    }
+  for (std::set<int>::const_iterator iter = cycles.begin ();
+       iter != cycles.end (); ++iter)
+    relocations.erase (*iter);
+
+  // Build splices to relocate these labels.
+  std::map<int, OpcodeTableStore> splices;
+  for (std::map<int, int>::const_iterator iter = relocations.begin ();
+       iter != relocations.end (); ++iter)
+    {
+      const int value = iter->first;
+      const int relocation = iter->second;
 
       Opcode * opcode = new LabelOpcode (Label (value), label_lines[value]);
-      opcode_collection_.insert (opcode);
+      opcode_collection_.push_back (opcode);
       splices[relocation].push_back (opcode);
     }
 
-  // Build a new opcode vector with suboptimal labels relocated.  Leave a
-  // no-op marker at the old location.
-  OpcodeTableStore relocated;
+  // Build a new opcode vector with suboptimal labels relocated.  Leave a
+  // no-op marker at the old location.
+  OpcodeTableStore relocated;
+
+  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
+       iter != opcodes_.end (); ++iter)
+    {
+      Opcode * opcode = *iter;
+
+      const LabelOpcode * label = opcode->is_label_opcode ();
+      if (label)
+        {
+          const int value = label->get_label ().get_value ();
+          bool is_suboptimal_or_spliced = false;
+
+          if (relocations.find (value) != relocations.end ())
+            {
+              // Important: after replace_with_nop, opcode != *iter.
+              replace_with_nop (iter);
+              relocated.push_back (*iter);
+              is_suboptimal_or_spliced = true;
+            }
+
+          if (splices.find (value) != splices.end ())
+            {
+              relocated.insert (relocated.end (),
+                                splices[value].begin (), splices[value].end ());
+              relocated.push_back (opcode);
+              is_suboptimal_or_spliced = true;
+            }
+
+          if (is_suboptimal_or_spliced)
+            ++optimizations;
+          else
+            relocated.push_back (opcode);
+        }
+      else
+        relocated.push_back (opcode);
+    }
+
+  // Replace the old opcode vector with the new one.
+  if (optimizations)
+    opcodes_.assign (relocated.begin (), relocated.end ());
+
+  return optimizations;
+}
+
+// Remove any labels for which there is no jump.
+int
+OpcodeTable::remove_unnecessary_labels (const Options &)
+{
+  int optimizations = 0;
+
+  // Identify all currently used labels.
+  std::set<int> used_labels;
+
+  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
+       iter != opcodes_.end (); )
+    {
+      // Find the next branching opcode.
+      const OpcodeTableIterator_mutable first =
+          std::find_if (iter, opcodes_.end (),
+                        std::mem_fun (&Opcode::is_branching_opcode));
+      if (first == opcodes_.end ())
+        break;
+
+      const Opcode * opcode = *first;
+      const BranchingOpcode * branch = opcode->is_branching_opcode ();
+
+      const Label & label = branch->get_label ();
+      used_labels.insert (label.get_value ());
+
+      iter = first + 1;
+    }
+
+  // Optimize away any labels not referenced.
+  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
+       iter != opcodes_.end (); )
+    {
+      // Find the next label opcode.
+      const OpcodeTableIterator_mutable first =
+          std::find_if (iter, opcodes_.end (),
+                        std::mem_fun (&Opcode::is_label_opcode));
+      if (first == opcodes_.end ())
+        break;
+
+      const Opcode * opcode = *first;
+      const LabelOpcode * label_op = opcode->is_label_opcode ();
+
+      // If no branch uses it, replace it with a no-op.
+      const Label & label = label_op->get_label ();
+      if (used_labels.find (label.get_value ()) == used_labels.end ())
+        {
+          replace_with_nop (first);
+          ++optimizations;
+        }
+
+      iter = first + 1;
+    }
+
+  return optimizations;
+}
+
+// Merge blocks reached only by an unconditional jump into the block that
+// jumps, by moving each to follow its jump, where the moved block ends in
+// a jump of its own and so does not rely on what follows it.  The jump
+// to the moved block and its label then go as unnecessary.
+int
+OpcodeTable::merge_blocks (const Options &)
+{
+  int optimizations = 0;
+
+  // Find the blocks to move, keyed by the index of the jump to each.
+  std::map<size_t, std::pair<size_t, size_t> > moves;
+  std::vector<bool> is_moved (opcodes_.size (), false);
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      if (!opcodes_[i]->is_define_opcode ())
+        continue;
+
+      const size_t end = find_definition_end (opcodes_, i);
+      const ControlFlowGraph cfg (opcodes_, i + 1, end);
+
+      for (size_t b = 1; b < cfg.get_block_count (); ++b)
+        {
+          const ControlFlowGraph::Block & block = cfg.get_block (b);
+          if (!cfg.is_reachable (b) || cfg.falls_through (b)
+              || block.predecessors.size () != 1
+              || block.predecessors[0] + 1 == b
+              || block.predecessors[0] == b)
+            continue;
+
+          // The predecessor must reach this block only by its jump.
+          const ControlFlowGraph::Block & from
+              = cfg.get_block (block.predecessors[0]);
+          size_t jump = from.end;
+          while (jump > from.begin && opcodes_[jump - 1]->is_noop_opcode ())
+            --jump;
+          if (!(jump > from.begin && opcodes_[--jump]->is_jump_opcode ()))
+            continue;
+
+          moves[jump] = std::make_pair (block.begin, block.end);
+          for (size_t j = block.begin; j < block.end; ++j)
+            is_moved[j] = true;
+          ++optimizations;
+        }
+      i = end;
+    }
+
+  if (!optimizations)
+    return optimizations;
+
+  // Rebuild the opcode vector, emitting each moved block after the jump
+  // to it.  A moved block is reachable only through its one predecessor,
+  // so moves chain but never form a cycle.
+  OpcodeTableStore merged;
+  std::vector<std::pair<size_t, size_t> > pending;
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      if (is_moved[i])
+        continue;
+
+      pending.push_back (std::make_pair (i, i + 1));
+      while (!pending.empty ())
+        {
+          std::pair<size_t, size_t> & range = pending.back ();
+          if (range.first == range.second)
+            {
+              pending.pop_back ();
+              continue;
+            }
+
+          const size_t j = range.first++;
+          merged.push_back (opcodes_[j]);
+
+          const std::map<size_t, std::pair<size_t, size_t> >::const_iterator
+              move = moves.find (j);
+          if (move != moves.end ())
+            pending.push_back (move->second);
+        }
+    }
+  opcodes_.assign (merged.begin (), merged.end ());
+
+  return optimizations;
+}
+
+namespace {
+
+// Runtime return stack words that frame slot allocation rewrites.  Each
+// moves cells from the data stack to the return stack, fetches cells from
+// a depth into the return stack, then drops cells from the return stack.
+struct ReturnWord
+{
+  const char * word;
+  int to_return;
+  int fetch;
+  int fetch_depth;
+  int drop;
+};
+
+const ReturnWord RETURN_WORDS[] = {
+  { ">r", 1, 0, 0, 0 }, { "r>", 0, 1, 1, 1 }, { "r@", 0, 1, 1, 0 },
+  { "rdrop", 0, 0, 0, 1 }, { "2>r", 2, 0, 0, 0 }, { "2r>", 0, 2, 2, 2 },
+  { "2r@", 0, 2, 2, 0 }, { "2rdrop", 0, 0, 0, 2 },
+  { "i", 0, 1, 1, 0 }, { "j", 0, 1, 3, 0 }, { "k", 0, 1, 5, 0 },
+  { "unloop", 0, 0, 0, 2 },
+  { 0, 0, 0, 0, 0 }
+};
+
+// Return the return stack word for a call, or null if it is not one.
+const ReturnWord *
+find_return_word (const CallOpcode * call,
+                  const std::set<const Symbol *> & defined)
+{
+  if (defined.find (call->get_symbol ()) != defined.end ())
+    return 0;
+
+  const Symbol * symbol = call->get_symbol ();
+  const std::string word = Mangler::demangle (symbol->get_name ());
+  for (int i = 0; RETURN_WORDS[i].word; ++i)
+    {
+      if (word == RETURN_WORDS[i].word)
+        return RETURN_WORDS + i;
+    }
+  return 0;
+}
+
+// Return true if a call may use return stack cells that its caller holds.
+// A call to a program word may only if that word is not clean.  Words
+// from other modules and the runtime, I and R@ among them, may always.
+bool
+is_return_observer (const Symbol * symbol,
+                    const std::set<const Symbol *> & defined,
+                    const std::set<const Symbol *> & clean)
+{
+  if (defined.find (symbol) != defined.end ())
+    return clean.find (symbol) == clean.end ();
+  return true;
+}
+
+// Static return stack use of a definition.  For a balanced definition,
+// depths holds the depth before each return stack push, pop, and word.
+// Calls made with nothing on the return stack are outer calls, others
+// inner calls.
+struct ReturnStackUse
+{
+  bool is_balanced;
+  bool is_used;
+  std::map<size_t, int> depths;
+  std::set<const Symbol *> outer_calls;
+  std::set<const Symbol *> inner_calls;
+};
+
+// Simulate return stack depth through the definition that opcodes begin
+// at.  The definition is balanced if every path agrees on the depth at each
+// label, never pops an empty stack, and returns with the stack empty.
+ReturnStackUse
+find_return_stack_use (const std::vector<Opcode *> & opcodes, size_t begin,
+                       const std::set<const Symbol *> & defined)
+{
+  ReturnStackUse use;
+  use.is_balanced = false;
+  use.is_used = false;
+
+  std::set<int> targets;
+  for (size_t i = begin + 1; !opcodes[i]->is_enddefine_opcode (); ++i)
+    {
+      if (const BranchingOpcode * branch = opcodes[i]->is_branching_opcode ())
+        targets.insert (branch->get_label ().get_value ());
+    }
+
+  // Depth is -1 where code is unreachable.
+  std::map<int, int> label_depths;
+  int depth = 0;
+
+  for (size_t i = begin + 1; ; ++i)
+    {
+      const Opcode * opcode = opcodes[i];
+
+      if (const LabelOpcode * label = opcode->is_label_opcode ())
+        {
+          const int value = label->get_label ().get_value ();
+          const std::map<int, int>::const_iterator found =
+              label_depths.find (value);
+
+          if (found != label_depths.end ())
+            {
+              if (depth >= 0 && depth != found->second)
+                return use;
+              depth = found->second;
+            }
+          else if (depth < 0 && targets.find (value) != targets.end ())
+            return use;
+
+          if (depth >= 0)
+            label_depths[value] = depth;
+          continue;
+        }
+
+      if (opcode->is_enddefine_opcode ())
+        {
+          use.is_balanced = depth <= 0;
+          return use;
+        }
+
+      const PushOpcode * push = opcode->is_push_opcode ();
+      const PopOpcode * pop = opcode->is_pop_opcode ();
+      const CallOpcode * call = opcode->is_call_opcode ();
+      const ReturnWord * word = call ? find_return_word (call, defined) : 0;
+
+      const bool is_return_push = push
+                                  && push->get_stack ().equals (Stack::RETURN);
+      const bool is_return_pop = pop
+                                 && pop->get_stack ().equals (Stack::RETURN);
+
+      if (opcode->is_assembly_opcode ())
+        return use;
+
+      if (depth < 0)
+        {
+          if (is_return_push || is_return_pop || word)
+            return use;
+          continue;
+        }
+
+      if (is_return_push || is_return_pop || word)
+        {
+          use.depths[i] = depth;
+          use.is_used = true;
+        }
+
+      if (is_return_push)
+        ++depth;
+      else if (is_return_pop)
+        {
+          if (depth == 0)
+            return use;
+          --depth;
+        }
+      else if (word)
+        {
+          if (depth < word->fetch_depth || depth < word->drop)
+            return use;
+          depth += word->to_return - word->drop;
+        }
+      else if (call)
+        {
+          if (depth == 0)
+            use.outer_calls.insert (call->get_symbol ());
+          else
+            use.inner_calls.insert (call->get_symbol ());
+        }
+      else if (const BranchingOpcode * branch = opcode->is_branching_opcode ())
+        {
+          const int value = branch->get_label ().get_value ();
+          const std::map<int, int>::const_iterator found =
+              label_depths.find (value);
+
+          if (found != label_depths.end () && found->second != depth)
+            return use;
+          label_depths[value] = depth;
+
+          if (opcode->is_jump_opcode ())
+            depth = -1;
+        }
+    }
+}
+
+// Return opcodes that implement a return stack word with frame slots,
+// given the return stack depth before it.
+std::vector<Opcode *>
+expand_return_word (const ReturnWord & word, int depth, int line)
+{
+  std::vector<Opcode *> opcodes;
+  const Register & r0 = Register::R0;
+  const Register & r1 = Register::R1;
+
+  if (word.to_return == 2)
+    opcodes.push_back (new PopOpcode (r1, Stack::DATA, line));
+  if (word.to_return)
+    {
+      opcodes.push_back (new PopOpcode (r0, Stack::DATA, line));
+      opcodes.push_back (new StoreFrameOpcode (r0, depth, line));
+    }
+  if (word.to_return == 2)
+    opcodes.push_back (new StoreFrameOpcode (r1, depth + 1, line));
+
+  if (word.fetch)
+    {
+      const int slot = depth - word.fetch_depth;
+      opcodes.push_back (new LoadFrameOpcode (r0, slot, line));
+      if (word.fetch == 2)
+        opcodes.push_back (new LoadFrameOpcode (r1, slot + 1, line));
+      opcodes.push_back (new PushOpcode (r0, Stack::DATA, line));
+      if (word.fetch == 2)
+        opcodes.push_back (new PushOpcode (r1, Stack::DATA, line));
+    }
+
+  return opcodes;
+}
+
+} // namespace
+
+// Hold return stack cells in machine stack frame slots, for definitions
+// whose return stack depth is known statically at every point.  This
+// covers DO loop indexes and limits, and balanced >R and R> pairs.  Return
+// stack pushes and pops become frame stores and loads, and calls to I, J,
+// K, UNLOOP and the runtime's other return stack words become direct frame
+// accesses.  A definition may not hold cells in its frame if, while it
+// holds any, it calls a word that may reach into its caller's return stack
+// cells.  Words that the program defines may do so unless they are clean,
+// that is, balanced and calling only clean words themselves.  Words from
+// anywhere else may always do so.
+int
+OpcodeTable::allocate_rstack_frames (const Options &)
+{
+  int optimizations = 0;
+  const std::set<const Symbol *> & defined = get_defined_symbols ();
+
+  // Find return stack use in each non-code definition.
+  std::map<const Symbol *, ReturnStackUse> uses;
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      const DefineOpcode * define = opcodes_[i]->is_define_opcode ();
+      if (define && !define->get_symbol ()->is_codeword_symbol ())
+        uses[define->get_symbol ()] = find_return_stack_use (opcodes_, i,
+                                                             defined);
+    }
+
+  // Find clean definitions, starting from all balanced ones and discarding
+  // any that call words not clean, until no more change.
+  std::set<const Symbol *> clean;
+  for (std::map<const Symbol *, ReturnStackUse>::const_iterator
+         iter = uses.begin (); iter != uses.end (); ++iter)
+    {
+      if (iter->second.is_balanced)
+        clean.insert (iter->first);
+    }
+
+  bool is_changed;
+  do
+    {
+      is_changed = false;
+      for (std::map<const Symbol *, ReturnStackUse>::const_iterator
+             iter = uses.begin (); iter != uses.end (); ++iter)
+        {
+          if (clean.find (iter->first) == clean.end ())
+            continue;
+
+          std::set<const Symbol *> calls = iter->second.outer_calls;
+          calls.insert (iter->second.inner_calls.begin (),
+                        iter->second.inner_calls.end ());
+
+          for (std::set<const Symbol *>::const_iterator
+                 call = calls.begin (); call != calls.end (); ++call)
+            {
+              if (is_return_observer (*call, defined, clean))
+                {
+                  clean.erase (iter->first);
+                  is_changed = true;
+                  break;
+                }
+            }
+        }
+    }
+  while (is_changed);
+
+  // Rewrite return stack use in balanced definitions that make no inner
+  // calls to words that may reach into their return stack cells.
+  std::set<size_t> rewrites;
+  for (std::map<const Symbol *, ReturnStackUse>::const_iterator
+         iter = uses.begin (); iter != uses.end (); ++iter)
+    {
+      const ReturnStackUse & use = iter->second;
+      if (!(use.is_balanced && use.is_used))
+        continue;
+
+      bool is_rewritable = true;
+      for (std::set<const Symbol *>::const_iterator
+             call = use.inner_calls.begin ();
+           call != use.inner_calls.end () && is_rewritable; ++call)
+        is_rewritable = !is_return_observer (*call, defined, clean);
+
+      if (!is_rewritable)
+        continue;
+
+      for (std::map<size_t, int>::const_iterator
+             depth = use.depths.begin (); depth != use.depths.end (); ++depth)
+        rewrites.insert (depth->first);
+    }
+
+  // Build a new opcode vector with frame slot accesses.  Add a nop
+  // optimizing out each return stack word call as an indicator we can find
+  // in the intermediate output file.
+  OpcodeTableStore rewritten;
+  std::map<size_t, int> depths;
+  for (std::map<const Symbol *, ReturnStackUse>::const_iterator
+         iter = uses.begin (); iter != uses.end (); ++iter)
+    depths.insert (iter->second.depths.begin (), iter->second.depths.end ());
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      if (rewrites.find (i) == rewrites.end ())
+        {
+          rewritten.push_back (opcodes_[i]);
+          continue;
+        }
+
+      const Opcode * opcode = opcodes_[i];
+      const int depth = depths[i];
+      const int line = opcode->get_line ();
+
+      if (const PushOpcode * push = opcode->is_push_opcode ())
+        {
+          replace_with (opcodes_.begin () + i,
+                        new StoreFrameOpcode (push->get_register (),
+                                              depth, line));
+          rewritten.push_back (opcodes_[i]);
+        }
+      else if (const PopOpcode * pop = opcode->is_pop_opcode ())
+        {
+          replace_with (opcodes_.begin () + i,
+                        new LoadFrameOpcode (pop->get_register (),
+                                             depth - 1, line));
+          rewritten.push_back (opcodes_[i]);
+        }
+      else
+        {
+          const ReturnWord * word =
+              find_return_word (opcode->is_call_opcode (), defined);
+
+          // Important: after replace_with_nop, opcode != opcodes_[i].
+          replace_with_nop (opcodes_.begin () + i);
+          rewritten.push_back (opcodes_[i]);
+
+          const std::vector<Opcode *> opcodes =
+              expand_return_word (*word, depth, line);
+          opcode_collection_.insert (opcode_collection_.end (),
+                                     opcodes.begin (), opcodes.end ());
+          rewritten.insert (rewritten.end (),
+                            opcodes.begin (), opcodes.end ());
+        }
+
+      ++optimizations;
+    }
+
+  // Replace the old opcode vector with the new one.
+  if (optimizations)
+    opcodes_.assign (rewritten.begin (), rewritten.end ());
+
+  // DO loops pop and push back their limit, and pop both cells to discard
+  // them, so remove stores of a register to the slot it was just loaded
+  // from, and loads to a register that the next frame load overwrites.
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      const FrameOpcode * frame = opcodes_[i]->is_frame_opcode ();
+      if (!frame)
+        continue;
+
+      const Register & reg = frame->get_register ();
+      if (frame->is_load ())
+        {
+          size_t k = i + 1;
+          while (k < opcodes_.size () && opcodes_[k]->is_noop_opcode ())
+            ++k;
+
+          const FrameOpcode * next = k < opcodes_.size ()
+                                     ? opcodes_[k]->is_frame_opcode () : 0;
+          if (next && next->is_load () && next->get_register ().equals (reg))
+            {
+              replace_with_nop (opcodes_.begin () + i);
+              ++optimizations;
+            }
+          continue;
+        }
+
+      for (size_t k = i; k > 0; --k)
+        {
+          const Opcode * opcode = opcodes_[k - 1];
+          const FrameOpcode * previous = opcode->is_frame_opcode ();
+
+          if (previous && previous->get_slot () == frame->get_slot ())
+            {
+              if (previous->is_load ()
+                  && previous->get_register ().equals (reg))
+                {
+                  replace_with_nop (opcodes_.begin () + i);
+                  ++optimizations;
+                }
+              break;
+            }
+
+          if (opcode->is_label_opcode () || opcode->is_define_opcode ()
+              || opcode->modifies_register (reg))
+            break;
+        }
+    }
+
+  return optimizations;
+}
+
+namespace {
+
+// Return true if nothing but the end of its definition follows the opcode
+// at index, through any labels, no-ops and unconditional jumps.
+bool
+is_tail_position (const std::vector<Opcode *> & opcodes, size_t index,
+                  const std::map<int, size_t> & labels)
+{
+  size_t i = index + 1;
+  for (size_t steps = 0; steps < opcodes.size (); ++steps)
+    {
+      const Opcode * opcode = opcodes[i];
+
+      if (opcode->is_enddefine_opcode ())
+        return true;
+
+      if (const JumpOpcode * jump = opcode->is_jump_opcode ())
+        {
+          const std::map<int, size_t>::const_iterator found =
+              labels.find (jump->get_label ().get_value ());
+          if (found == labels.end ())
+            return false;
+          i = found->second;
+        }
+      else if (opcode->is_label_opcode () || opcode->is_noop_opcode ())
+        ++i;
+      else
+        return false;
+    }
+  return false;
+}
+
+// Return true if a word may be tail called.
+bool
+is_tail_callable (const Symbol * symbol)
+{
+  return symbol->is_callable_symbol () && !is_frame_inspector (symbol);
+}
+
+} // namespace
+
+// Replace calls in tail position with jumps.  A call from a definition to
+// itself, as from RECURSE, jumps back to the start of its body, reusing
+// the frame.  Other calls release the frame first, so that the callee
+// returns directly to the caller's caller.
+int
+OpcodeTable::eliminate_tail_calls (const Options &)
+{
+  int optimizations = 0;
+
+  // Find each label's position, and the next unused label value.
+  std::map<int, size_t> labels;
+  int next_label = 0;
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      if (const LabelOpcode * label = opcodes_[i]->is_label_opcode ())
+        {
+          const int value = label->get_label ().get_value ();
+          labels[value] = i;
+          next_label = std::max (next_label, value + 1);
+        }
+    }
+
+  // Replace tail calls, noting definitions that need a body label.
+  std::map<size_t, int> body_labels;
+  const Symbol * current_definition = 0;
+  size_t define_index = 0;
+  bool is_codeword = false;
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      const Opcode * opcode = opcodes_[i];
+
+      if (const DefineOpcode * define = opcode->is_define_opcode ())
+        {
+          current_definition = define->get_symbol ();
+          is_codeword = current_definition->is_codeword_symbol ();
+          define_index = i;
+          continue;
+        }
+
+      const CallOpcode * call = opcode->is_call_opcode ();
+      if (is_codeword || !call || !is_tail_position (opcodes_, i, labels))
+        continue;
+
+      const Symbol * symbol = call->get_symbol ();
+      if (symbol == current_definition)
+        {
+          if (body_labels.find (define_index) == body_labels.end ())
+            body_labels[define_index] = next_label++;
+          replace_with (opcodes_.begin () + i,
+                        new JumpOpcode (Label (body_labels[define_index]),
+                                        opcode->get_line ()));
+        }
+      else if (is_tail_callable (symbol))
+        replace_with (opcodes_.begin () + i,
+                      new TailCallOpcode (symbol->is_callable_symbol (),
+                                          opcode->get_line ()));
+      else
+        continue;
+
+      ++optimizations;
+    }
+
+  // Insert body labels after their definitions' starts.
+  if (!body_labels.empty ())
+    {
+      OpcodeTableStore labelled;
+      for (size_t i = 0; i < opcodes_.size (); ++i)
+        {
+          labelled.push_back (opcodes_[i]);
+          if (body_labels.find (i) != body_labels.end ())
+            {
+              Opcode * label = new LabelOpcode (Label (body_labels[i]),
+                                                opcodes_[i]->get_line ());
+              opcode_collection_.push_back (label);
+              labelled.push_back (label);
+            }
+        }
+      opcodes_.assign (labelled.begin (), labelled.end ());
+    }
+
+  return optimizations;
+}
+
+namespace {
+
+// CASE selections with at least this many literal OF values dispatch
+// directly to the matching clause rather than testing each in turn.
+const size_t CASE_DISPATCH_MINIMUM = 4;
+
+// Values spanning no more than this many times their count dispatch
+// through a jump table.  Sparser values use a binary decision tree, whose
+// leaves test up to a few values in turn.
+const long long CASE_TABLE_DENSITY = 3;
+const size_t CASE_TREE_LEAF = 3;
+
+// The opcodes of one OF clause testing a literal value.  From begin to
+// peek loads the literal into Reg_1, and from peek to branch copies the
+// selector into Reg_0, leaving it stacked, then branches if unequal.
+struct CaseClause
+{
+  size_t begin;
+  size_t peek;
+  size_t branch;
+  int value;
+};
+
+// Match the opcodes of "literal OF" at index, whether as parsed, or with
+// the literal's push and pop already paired into a register move.
+bool
+match_case_clause (const std::vector<Opcode *> & opcodes, size_t index,
+                   CaseClause * clause)
+{
+  const Register & r0 = Register::R0;
+  const Register & r1 = Register::R1;
+
+  size_t i = skip_noops (opcodes, index);
+  const LoadValueOpcode * load = opcodes[i]->is_load_value_opcode ();
+  if (!(load && load->get_register ().equals (r0)))
+    return false;
+
+  if (!load->get_value ().is_immediate ())
+    return false;
+
+  clause->begin = i;
+  clause->value = load->get_value ().get_value ();
+
+  i = skip_noops (opcodes, i + 1);
+  const LoadRegisterOpcode * move = opcodes[i]->is_load_register_opcode ();
+  if (move && move->get_register ().equals (r1)
+      && move->get_with ().equals (r0))
+    i = skip_noops (opcodes, i + 1);
+  else if (is_data_push (opcodes[i], r0))
+    {
+      i = skip_noops (opcodes, i + 1);
+      if (!is_data_pop (opcodes[i], r1))
+        return false;
+      i = skip_noops (opcodes, i + 1);
+    }
+  else
+    return false;
+
+  clause->peek = i;
+  if (!is_data_pop (opcodes[i], r0))
+    return false;
+  i = skip_noops (opcodes, i + 1);
+  if (!is_data_push (opcodes[i], r0))
+    return false;
+
+  i = skip_noops (opcodes, i + 1);
+  const JumpNotEqualOpcode * branch = opcodes[i]->is_jump_not_equal_opcode ();
+  if (!(branch && branch->get_register1 ().equals (r0)
+        && branch->get_register2 ().equals (r1)))
+    return false;
+
+  clause->branch = i;
+  return true;
+}
+
+// Append a binary decision tree over the sorted values and their clause
+// labels from begin to end, on the selector in Reg_0, to tree.
+void
+build_case_tree (const std::vector<std::pair<int, int> > & cases,
+                 size_t begin, size_t end, const Label & otherwise,
+                 int line, int * next_label, std::vector<Opcode *> * tree)
+{
+  const Register & r0 = Register::R0;
+  const Register & r1 = Register::R1;
 
-  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
-       iter != opcodes_.end (); ++iter)
+  if (end - begin <= CASE_TREE_LEAF)
     {
-      Opcode * opcode = *iter;
+      for (size_t i = begin; i < end; ++i)
+        {
+          tree->push_back (new LoadValueOpcode (r1, Value (cases[i].first),
+                                                line));
+          tree->push_back (new JumpCompareOpcode (r0, r1, EQUAL,
+                                                  Label (cases[i].second),
+                                                  line));
+        }
+      tree->push_back (new JumpOpcode (otherwise, line));
+      return;
+    }
 
-      const LabelOpcode * label = opcode->is_label_opcode ();
-      if (label)
+  const size_t middle = begin + (end - begin) / 2;
+  const Label lower (*next_label);
+  ++*next_label;
+
+  tree->push_back (new LoadValueOpcode (r1, Value (cases[middle].first),
+                                        line));
+  tree->push_back (new JumpCompareOpcode (r0, r1, LESS, lower, line));
+  build_case_tree (cases, middle, end, otherwise, line, next_label, tree);
+  tree->push_back (new LabelOpcode (lower, line));
+  build_case_tree (cases, begin, middle, otherwise, line, next_label, tree);
+}
+
+} // namespace
+
+// Replace chains of OF clauses testing literal values with a direct
+// dispatch on the selector.  Each clause's failing test branches to a
+// label reached from nowhere else, where the next clause's test follows
+// an unconditional jump from the end of the previous clause.  Dense
+// values dispatch through a jump table, sparse ones through a decision
+// tree.  The first clause's peek at the selector is kept, so that clause
+// bodies and the default code still find it stacked, as before.
+int
+OpcodeTable::dispatch_case_selections (const Options &)
+{
+  int optimizations = 0;
+
+  // Find each label's position and branch count, and the next unused
+  // label value.
+  std::map<int, size_t> labels;
+  std::map<int, int> references;
+  int next_label = 0;
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      if (const LabelOpcode * label = opcodes_[i]->is_label_opcode ())
         {
           const int value = label->get_label ().get_value ();
-          bool is_suboptimal_or_spliced = false;
+          labels[value] = i;
+          next_label = std::max (next_label, value + 1);
+        }
+      else if (const BranchingOpcode * branch
+                   = opcodes_[i]->is_branching_opcode ())
+        ++references[branch->get_label ().get_value ()];
+    }
 
-          if (relocations.find (value) != relocations.end ())
+  // Dispatch opcodes to insert ahead of each lowered chain's first branch.
+  std::map<size_t, std::vector<Opcode *> > dispatches;
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      CaseClause clause;
+      if (!match_case_clause (opcodes_, i, &clause))
+        continue;
+
+      // Follow the chain through each failing test's target label.
+      std::vector<CaseClause> clauses (1, clause);
+      for (;;)
+        {
+          const BranchingOpcode * branch
+              = opcodes_[clauses.back ().branch]->is_branching_opcode ();
+          const int value = branch->get_label ().get_value ();
+          const size_t target = labels[value];
+          if (references[value] != 1 || target <= clauses.back ().branch)
+            break;
+
+          size_t before = target - 1;
+          while (opcodes_[before]->is_noop_opcode ())
+            --before;
+          if (!opcodes_[before]->is_jump_opcode ()
+              || !match_case_clause (opcodes_, target + 1, &clause))
+            break;
+          clauses.push_back (clause);
+        }
+
+      if (clauses.size () < CASE_DISPATCH_MINIMUM)
+        continue;
+
+      // Turn each clause's test into an entry label, noting values in
+      // order, with the first clause taking any duplicated value.
+      const int line = opcodes_[clauses[0].branch]->get_line ();
+      const Label otherwise
+          = opcodes_[clauses.back ().branch]->is_branching_opcode ()
+            ->get_label ();
+      std::map<int, int> entries;
+
+      for (size_t j = 0; j < clauses.size (); ++j)
+        {
+          const size_t end = j ? clauses[j].branch : clauses[j].peek;
+          for (size_t k = clauses[j].begin; k < end; ++k)
             {
-              // Important: after replace_with_nop, opcode != *iter.
-              replace_with_nop (iter);
-              relocated.push_back (*iter);
-              is_suboptimal_or_spliced = true;
+              if (!opcodes_[k]->is_noop_opcode ())
+                replace_with_nop (opcodes_.begin () + k);
             }
 
-          if (splices.find (value) != splices.end ())
+          const int entry = next_label++;
+          replace_with (opcodes_.begin () + clauses[j].branch,
+                        new LabelOpcode (Label (entry),
+                                         opcodes_[clauses[j].branch]
+                                         ->get_line ()));
+          entries.insert (std::make_pair (clauses[j].value, entry));
+        }
+
+      const std::vector<std::pair<int, int> > cases (entries.begin (),
+                                                     entries.end ());
+      const long long low = cases.front ().first;
+      const long long span = cases.back ().first - low + 1;
+
+      std::vector<Opcode *> & dispatch = dispatches[clauses[0].branch];
+      if (span <= CASE_TABLE_DENSITY * static_cast<long long> (cases.size ()))
+        {
+          std::vector<int> values (span, otherwise.get_value ());
+          for (size_t j = 0; j < cases.size (); ++j)
+            values[cases[j].first - low] = cases[j].second;
+
+          std::vector<Label> targets;
+          for (size_t j = 0; j < values.size (); ++j)
+            targets.push_back (Label (values[j]));
+          dispatch.push_back (new JumpTableOpcode (Register::R0,
+                                                   Value (cases[0].first),
+                                                   targets, otherwise, line));
+        }
+      else
+        build_case_tree (cases, 0, cases.size (), otherwise,
+                         line, &next_label, &dispatch);
+
+      ++optimizations;
+    }
+
+  // Insert dispatches ahead of the entry labels for their first clauses.
+  if (!dispatches.empty ())
+    {
+      OpcodeTableStore dispatched;
+      for (size_t i = 0; i < opcodes_.size (); ++i)
+        {
+          const std::map<size_t, std::vector<Opcode *> >::const_iterator
+              found = dispatches.find (i);
+          if (found != dispatches.end ())
             {
-              relocated.insert (relocated.end (),
-                                splices[value].begin (), splices[value].end ());
-              relocated.push_back (opcode);
-              is_suboptimal_or_spliced = true;
+              const std::vector<Opcode *> & dispatch = found->second;
+              for (size_t j = 0; j < dispatch.size (); ++j)
+                {
+                  opcode_collection_.push_back (dispatch[j]);
+                  dispatched.push_back (dispatch[j]);
+                }
             }
+          dispatched.push_back (opcodes_[i]);
+        }
+      opcodes_.assign (dispatched.begin (), dispatched.end ());
+    }
 
-          if (is_suboptimal_or_spliced)
-            ++optimizations;
+  return optimizations;
+}
+
+// Return true if the opcode ends a basic block for data stack register
+// allocation.  Calls, inline assembly, and the floating point stack push
+// and pop functions may use the data stack or any register.
+namespace {
+
+bool
+is_stack_block_boundary (const Opcode * opcode)
+{
+  const PushOpcode * push = opcode->is_push_opcode ();
+  const PopOpcode * pop = opcode->is_pop_opcode ();
+
+  return opcode->is_label_opcode ()
+         || opcode->is_branching_opcode ()
+         || opcode->is_call_opcode ()
+         || opcode->is_assembly_opcode ()
+         || opcode->is_define_opcode ()
+         || opcode->is_enddefine_opcode ()
+         || (push && push->get_stack ().equals (Stack::FLOAT))
+         || (pop && pop->get_stack ().equals (Stack::FLOAT));
+}
+
+} // namespace
+
+// Keep data stack cells in registers within basic blocks.  Simulate the
+// data stack across each block to pair each push with the pop that takes
+// its cell.  Where nothing between the two changes the pushed register,
+// forward the register directly.  Otherwise hold the cell in a free stack
+// slot register for its lifetime.  Cells still stacked at the end of the
+// block, and pairs for which no slot register is free, stay in memory.
+int
+OpcodeTable::allocate_stack_registers (const Options & options)
+{
+  int optimizations = 0;
+
+  // %ecx serves as a scratch register in PIC code, and as the data stack
+  // index with -fstack-register, so is usable only without either.
+  std::vector<const Register *> free_slots;
+  free_slots.push_back (&Register::R4);
+  free_slots.push_back (&Register::R3);
+  if (!(options.position_independent () || options.stack_register ()))
+    free_slots.push_back (&Register::R2);
+
+  // Pair pushes and pops within each block, skipping code words.
+  std::map<size_t, size_t> pairs;
+  std::vector<size_t> stacked;
+  bool is_codeword = false;
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      const Opcode * opcode = opcodes_[i];
+
+      if (opcode->is_define_opcode ())
+        {
+          const Symbol * symbol = opcode->is_define_opcode ()->get_symbol ();
+          is_codeword = symbol->is_codeword_symbol ();
+        }
+
+      if (is_codeword || is_stack_block_boundary (opcode))
+        {
+          stacked.clear ();
+          continue;
+        }
+
+      const PushOpcode * push = opcode->is_push_opcode ();
+      const PopOpcode * pop = opcode->is_pop_opcode ();
+
+      if (push && push->get_stack ().equals (Stack::DATA))
+        stacked.push_back (i);
+      else if (pop && pop->get_stack ().equals (Stack::DATA)
+               && !stacked.empty ())
+        {
+          pairs[stacked.back ()] = i;
+          stacked.pop_back ();
+        }
+    }
+
+  // Rewrite each pair, allocating slot registers in opcode order.  Pairs
+  // nest, so a slot freed at a pop is never still in use by another pair.
+  std::map<size_t, const Register *> slot_releases;
+
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      if (slot_releases.find (i) != slot_releases.end ())
+        {
+          free_slots.push_back (slot_releases[i]);
+          slot_releases.erase (i);
+        }
+
+      if (pairs.find (i) == pairs.end ())
+        continue;
+
+      const size_t j = pairs[i];
+      const PushOpcode * push = opcodes_[i]->is_push_opcode ();
+      const PopOpcode * pop = opcodes_[j]->is_pop_opcode ();
+      const Register & reg = push->get_register ();
+
+      bool is_forwardable = true;
+      for (size_t k = i + 1; k < j && is_forwardable; ++k)
+        is_forwardable = !opcodes_[k]->modifies_register (reg);
+
+      if (is_forwardable)
+        {
+          Opcode * opcode;
+          if (reg.equals (pop->get_register ()))
+            opcode = new NoOpOpcode (pop->get_line ());
           else
-            relocated.push_back (opcode);
+            opcode = new LoadRegisterOpcode (pop->get_register (), reg,
+                                             pop->get_line ());
+          replace_with_nop (opcodes_.begin () + i);
+          replace_with (opcodes_.begin () + j, opcode);
+        }
+      else if (!free_slots.empty ())
+        {
+          const Register * slot = free_slots.back ();
+          free_slots.pop_back ();
+          slot_releases[j] = slot;
+
+          replace_with (opcodes_.begin () + i,
+                        new LoadRegisterOpcode (*slot, reg,
+                                                push->get_line ()));
+          replace_with (opcodes_.begin () + j,
+                        new LoadRegisterOpcode (pop->get_register (), *slot,
+                                                pop->get_line ()));
         }
       else
-        relocated.push_back (opcode);
-    }
+        continue;
 
-  // Replace the old opcode vector with the new one.
-  if (optimizations)
-    opcodes_.assign (relocated.begin (), relocated.end ());
+      ++optimizations;
+    }
 
   return optimizations;
 }
 
-// Remove any labels for which there is no jump.
+namespace {
+
+// Return a key naming the memory that an opcode loads a register from,
+// if it is a candidate for hoisting, otherwise an empty string.  Frame
+// slots and constants load from memory.  Symbol addresses are immediates
+// except in PIC code, where they load from the global offset table.
+std::string
+invariant_load (const Opcode * opcode, bool is_pic)
+{
+  const FrameOpcode * frame = opcode->is_frame_opcode ();
+  if (frame && frame->is_load ())
+    return "frame " + to_string (frame->get_slot ());
+
+  if (const LoadSymbolIndirectOpcode * load
+          = opcode->is_load_symbol_indirect_opcode ())
+    return "cell " + load->get_symbol ()->get_name ();
+
+  const LoadSymbolOpcode * load = opcode->is_load_symbol_opcode ();
+  if (load && is_pic)
+    return "address " + load->get_symbol ()->get_name ();
+
+  return std::string ();
+}
+
+// Return a key naming the memory that an opcode stores into, matching the
+// keys of invariant_load, or an empty string.
+std::string
+invariant_store (const Opcode * opcode)
+{
+  const FrameOpcode * frame = opcode->is_frame_opcode ();
+  if (frame && !frame->is_load ())
+    return "frame " + to_string (frame->get_slot ());
+
+  if (const StoreSymbolIndirectOpcode * store
+          = opcode->is_store_symbol_indirect_opcode ())
+    return "cell " + store->get_symbol ()->get_name ();
+
+  return std::string ();
+}
+
+// Return a copy of a hoistable load, loading into reg instead.
+Opcode *
+retarget_load (const Opcode * opcode, const Register & reg)
+{
+  const int line = opcode->get_line ();
+
+  if (const FrameOpcode * frame = opcode->is_frame_opcode ())
+    return new LoadFrameOpcode (reg, frame->get_slot (), line);
+  if (const LoadSymbolIndirectOpcode * load
+          = opcode->is_load_symbol_indirect_opcode ())
+    return new LoadSymbolIndirectOpcode (reg, load->get_symbol (), line);
+
+  const LoadSymbolOpcode * load = opcode->is_load_symbol_opcode ();
+  return new LoadSymbolOpcode (reg, load->get_symbol (), line);
+}
+
+// Return the register that a hoistable load loads.
+const Register &
+load_register (const Opcode * opcode)
+{
+  if (const FrameOpcode * frame = opcode->is_frame_opcode ())
+    return frame->get_register ();
+  if (const LoadSymbolIndirectOpcode * load
+          = opcode->is_load_symbol_indirect_opcode ())
+    return load->get_register ();
+  return opcode->is_load_symbol_opcode ()->get_register ();
+}
+
+} // namespace
+
+// Hoist loads of loop invariant memory out of loops.  A loop is the code
+// from a label to the last branch back to it, entered only by falling
+// into its label.  Where a loop neither calls nor runs anything else that
+// may change any register, each frame slot, constant or PIC symbol address
+// that it loads and never stores is loaded once into a free stack slot
+// register ahead of the loop, and copied from there inside it.  Runs after
+// data stack register allocation, whose slot registers never live across
+// a label, so a slot register that nothing in a loop writes is free there.
+// Only loads are hoisted.  Data stack cells that a loop reads through
+// OVER, SWAP or PICK stay put, because those are calls, and a loop that
+// calls anything is left alone.
 int
-OpcodeTable::remove_unnecessary_labels ()
+OpcodeTable::hoist_loop_invariants (const Options & options)
 {
   int optimizations = 0;
+  const bool is_pic = options.position_independent ();
+
+  std::vector<const Register *> slots;
+  slots.push_back (&Register::R4);
+  slots.push_back (&Register::R3);
+  if (!(is_pic || options.stack_register ()))
+    slots.push_back (&Register::R2);
+
+  // Find each label's position, and the opcodes that branch to it.
+  std::map<int, size_t> labels;
+  std::map<int, std::vector<size_t> > sources;
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      const Opcode * opcode = opcodes_[i];
 
-  // Identify all currently used labels.
-  std::set<int> used_labels;
+      if (const LabelOpcode * label = opcode->is_label_opcode ())
+        labels[label->get_label ().get_value ()] = i;
+      else if (const BranchingOpcode * branch = opcode->is_branching_opcode ())
+        sources[branch->get_label ().get_value ()].push_back (i);
 
-  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
-       iter != opcodes_.end (); )
+      if (const JumpTableOpcode * table = opcode->is_jump_table_opcode ())
+        {
+          const std::vector<Label> & targets = table->get_targets ();
+          for (size_t j = 0; j < targets.size (); ++j)
+            sources[targets[j].get_value ()].push_back (i);
+        }
+    }
+
+  // Find each loop, as its header index and the index of its last branch
+  // back, in code words excepted.
+  std::map<size_t, size_t> loops;
+  bool is_codeword = false;
+  for (size_t i = 0; i < opcodes_.size (); ++i)
     {
-      // Find the next branching opcode.
-      const OpcodeTableIterator_mutable first =
-          std::find_if (iter, opcodes_.end (),
-                        std::mem_fun (&Opcode::is_branching_opcode));
-      if (first == opcodes_.end ())
-        break;
+      const Opcode * opcode = opcodes_[i];
 
-      const Opcode * opcode = *first;
-      const BranchingOpcode * branch = opcode->is_branching_opcode ();
+      if (const DefineOpcode * define = opcode->is_define_opcode ())
+        is_codeword = define->get_symbol ()->is_codeword_symbol ();
 
-      const Label & label = branch->get_label ();
-      used_labels.insert (label.get_value ());
+      const BranchingOpcode * branch = opcode->is_branching_opcode ();
+      if (is_codeword || !branch)
+        continue;
 
-      iter = first + 1;
+      const std::map<int, size_t>::const_iterator header
+          = labels.find (branch->get_label ().get_value ());
+      if (header != labels.end () && header->second < i)
+        loops[header->second] = i;
     }
 
-  // Optimize away any labels not referenced.
-  for (OpcodeTableIterator_mutable iter = opcodes_.begin ();
-       iter != opcodes_.end (); )
-    {
-      // Find the next label opcode.
-      const OpcodeTableIterator_mutable first =
-          std::find_if (iter, opcodes_.end (),
-                        std::mem_fun (&Opcode::is_label_opcode));
-      if (first == opcodes_.end ())
-        break;
+  // Registers taken by hoisted loads, with the loops that they span.
+  std::vector<std::pair<std::pair<size_t, size_t>, const Register *> > taken;
+  std::map<size_t, std::vector<Opcode *> > preheaders;
 
-      const Opcode * opcode = *first;
-      const LabelOpcode * label_op = opcode->is_label_opcode ();
+  for (std::map<size_t, size_t>::const_iterator loop = loops.begin ();
+       loop != loops.end (); ++loop)
+    {
+      const size_t header = loop->first, end = loop->second;
+
+      // Reject loops that can be entered other than through the header,
+      // that the header can be branched to from outside, or that contain
+      // anything that may change registers.
+      bool is_hoistable = true;
+      std::set<std::string> stored;
+      for (size_t i = header; i <= end && is_hoistable; ++i)
+        {
+          const Opcode * opcode = opcodes_[i];
+          if (clobbers_registers (opcode) || opcode->is_define_opcode ()
+              || opcode->is_enddefine_opcode ())
+            is_hoistable = false;
+          else if (const LabelOpcode * label = opcode->is_label_opcode ())
+            {
+              const std::vector<size_t> & from
+                  = sources[label->get_label ().get_value ()];
+              for (size_t j = 0; j < from.size (); ++j)
+                is_hoistable &= from[j] >= header && from[j] <= end;
+            }
+          else if (!invariant_store (opcode).empty ())
+            stored.insert (invariant_store (opcode));
+        }
+      if (!is_hoistable)
+        continue;
+
+      // Find slot registers that nothing in the loop writes, and that no
+      // hoist into an overlapping loop has taken.  Labels and branches
+      // write no slot register.
+      std::vector<const Register *> free;
+      for (size_t j = 0; j < slots.size (); ++j)
+        {
+          bool is_free = true;
+          for (size_t i = header; i <= end && is_free; ++i)
+            is_free = opcodes_[i]->is_label_opcode ()
+                      || opcodes_[i]->is_branching_opcode ()
+                      || !opcodes_[i]->modifies_register (*slots[j]);
+          for (size_t k = 0; k < taken.size () && is_free; ++k)
+            is_free = !(taken[k].second == slots[j]
+                        && taken[k].first.first <= end
+                        && taken[k].first.second >= header);
+          if (is_free)
+            free.push_back (slots[j]);
+        }
 
-      // If no branch uses it, replace it with a no-op.
-      const Label & label = label_op->get_label ();
-      if (used_labels.find (label.get_value ()) == used_labels.end ())
+      // Give each invariant load a register, in loop order, until none
+      // remain free.
+      std::map<std::string, const Register *> hoisted;
+      for (size_t i = header; i <= end; ++i)
         {
-          replace_with_nop (first);
+          const std::string key = invariant_load (opcodes_[i], is_pic);
+          if (key.empty () || stored.count (key))
+            continue;
+
+          if (hoisted.find (key) == hoisted.end ())
+            {
+              if (free.empty ())
+                continue;
+              const Register * reg = free.back ();
+              free.pop_back ();
+              hoisted[key] = reg;
+
+              taken.push_back (std::make_pair (std::make_pair (header, end),
+                                               reg));
+              preheaders[header].push_back (retarget_load (opcodes_[i],
+                                                           *reg));
+            }
+
+          replace_with (opcodes_.begin () + i,
+                        new LoadRegisterOpcode (load_register (opcodes_[i]),
+                                                *hoisted[key],
+                                                opcodes_[i]->get_line ()));
           ++optimizations;
         }
+    }
 
-      iter = first + 1;
+  // Insert the hoisted loads ahead of their loop headers.
+  if (!preheaders.empty ())
+    {
+      OpcodeTableStore hoisted;
+      for (size_t i = 0; i < opcodes_.size (); ++i)
+        {
+          const std::map<size_t, std::vector<Opcode *> >::const_iterator
+              found = preheaders.find (i);
+          if (found != preheaders.end ())
+            {
+              const std::vector<Opcode *> & loads = found->second;
+              for (size_t j = 0; j < loads.size (); ++j)
+                {
+                  opcode_collection_.push_back (loads[j]);
+                  hoisted.push_back (loads[j]);
+                }
+            }
+          hoisted.push_back (opcodes_[i]);
+        }
+      opcodes_.assign (hoisted.begin (), hoisted.end ());
     }
 
   return optimizations;
 }
 
-// Run all optimizers in sequence, and iterate until no more optimizations.
+const OpcodeTable::Pass OpcodeTable::PASSES[] = {
+  { "unreachable-code", 1, LOCAL, &OpcodeTable::remove_unreachable_code },
+  { "jumps", 1, LOCAL, &OpcodeTable::remove_unnecessary_jumps },
+  { "useless-calls", 1, MODULE, &OpcodeTable::remove_useless_calls },
+  { "inline-booleans", 1, LOCAL, &OpcodeTable::inline_booleans },
+  { "inline-constants", 2, MODULE, &OpcodeTable::inline_constants },
+  { "redundant-accesses", 2, LOCAL, &OpcodeTable::remove_redundant_accesses },
+  { "fold-constants", 1, LOCAL, &OpcodeTable::fold_constants },
+  { "inline-functions", 2, MODULE, &OpcodeTable::inline_functions },
+  { "push-pop-pairs", 1, LOCAL,
+    &OpcodeTable::replace_adjacent_push_pop_pairs },
+  { "thread-jumps", 1, LOCAL, &OpcodeTable::relocate_suboptimal_labels },
+  { "merge-blocks", 1, LOCAL, &OpcodeTable::merge_blocks },
+  { "unused-labels", 1, LOCAL, &OpcodeTable::remove_unnecessary_labels },
+  { "strength-reduction", 1, EXPANSION, &OpcodeTable::reduce_strength },
+  { "intrinsics", 1, EXPANSION, &OpcodeTable::expand_intrinsics },
+  { "variable-accesses", 2, EXPANSION,
+    &OpcodeTable::expand_variable_accesses },
+  { "rstack-frames", 2, FINAL, &OpcodeTable::allocate_rstack_frames },
+  { "tail-calls", 2, FINAL, &OpcodeTable::eliminate_tail_calls },
+  { "unreachable-tails", 1, FINAL, &OpcodeTable::remove_unreachable_code },
+  { "case-dispatch", 2, FINAL, &OpcodeTable::dispatch_case_selections },
+  { "stack-registers", 2, FINAL, &OpcodeTable::allocate_stack_registers },
+  { "loop-invariants", 3, FINAL, &OpcodeTable::hoist_loop_invariants },
+  { "peephole", 1, FINAL, 0 },
+  { 0, 0, LOCAL, 0 }
+};
+
+// Return true if name is that of an optimization pass, and if so, whether
+// it runs with the given options.  The peephole pass has no function here,
+// as it runs on generated assembly.
+bool
+OpcodeTable::is_optimization_pass (const std::string & name)
+{
+  for (int i = 0; PASSES[i].level; ++i)
+    {
+      if (name == PASSES[i].name)
+        return true;
+    }
+  return false;
+}
+
+bool
+OpcodeTable::is_pass_enabled (const std::string & name,
+                              const Options & options)
+{
+  for (int i = 0; PASSES[i].level; ++i)
+    {
+      if (name == PASSES[i].name)
+        return options.use_pass (name, PASSES[i].level);
+    }
+  return false;
+}
+
+// Run each enabled pass of the given scope once, in table order.
+int
+OpcodeTable::run_passes (PassScope scope, const Options & options)
+{
+  int optimizations = 0;
+  for (int i = 0; PASSES[i].level; ++i)
+    {
+      const Pass & pass = PASSES[i];
+      if (pass.scope == scope && pass.run
+          && options.use_pass (pass.name, pass.level))
+        optimizations += (this->*pass.run) (options);
+    }
+  return optimizations;
+}
+
+// Run passes on a single definition, by narrowing the opcodes to it for
+// their duration.
+int
+OpcodeTable::run_on_definition (OpcodeTableStore * definition,
+                                PassScope scope, const Options & options)
+{
+  opcodes_.swap (*definition);
+  const int optimizations = run_passes (scope, options);
+  opcodes_.swap (*definition);
+  return optimizations;
+}
+
+// Run local passes on a definition until no more optimizations.  Return
+// false if that takes too many iterations.
+bool
+OpcodeTable::settle_definition (OpcodeTableStore * definition,
+                                const Options & options)
+{
+  for (int iterations = 0; iterations < ITERATIONS_LIMIT; ++iterations)
+    {
+      if (!run_on_definition (definition, LOCAL, options))
+        return true;
+    }
+  return false;
+}
+
+namespace {
+
+typedef std::vector<std::vector<Opcode *> > DefinitionStore;
+
+// Split opcodes into definitions, each from its start to its end, and the
+// runs of any other opcodes between them.
+DefinitionStore
+split_definitions (const std::vector<Opcode *> & opcodes)
+{
+  DefinitionStore definitions;
+  for (size_t i = 0; i < opcodes.size (); ++i)
+    {
+      if (definitions.empty () || opcodes[i]->is_define_opcode ()
+          || definitions.back ().back ()->is_enddefine_opcode ())
+        definitions.push_back (std::vector<Opcode *> ());
+      definitions.back ().push_back (opcodes[i]);
+    }
+  return definitions;
+}
+
+// Rejoin split definitions into a single opcode vector.
 void
-OpcodeTable::optimize_code (const std::string & source_path)
+join_definitions (const DefinitionStore & definitions,
+                  std::vector<Opcode *> * opcodes)
 {
-  int is_optimizing = 0;
-  int iterations = 0;
-  do
+  opcodes->clear ();
+  for (size_t i = 0; i < definitions.size (); ++i)
+    opcodes->insert (opcodes->end (),
+                     definitions[i].begin (), definitions[i].end ());
+}
+
+} // namespace
+
+// Optimize with a worklist of definitions.  Settle each changed definition
+// under the local passes, then run module passes, and repeat for the
+// definitions that these change.  When nothing changes, reduce strength
+// and expand intrinsics and variable accesses once, so that constant
+// folding sees calls first, and repeat for the definitions that changed.
+// Finally, allocate return stack frame slots, eliminate tail calls,
+// dispatch case selections, allocate data stack registers, and hoist loop
+// invariants, once only.
+void
+OpcodeTable::optimize_code (const std::string & source_path,
+                            const Options & options)
+{
+  get_defined_symbols ();
+
+  // Let inlining grow the module's executable opcodes by only so much.
+  int executable_opcodes = 0;
+  for (size_t i = 0; i < opcodes_.size (); ++i)
+    {
+      const Opcode * opcode = opcodes_[i];
+      if (!(opcode->is_label_opcode () || opcode->is_noop_opcode ()))
+        ++executable_opcodes;
+    }
+  const int growth_percent = options.optimize_level () > 2
+                             ? 2 * INLINE_GROWTH_PERCENT
+                             : INLINE_GROWTH_PERCENT;
+  inline_budget_ = std::max (executable_opcodes * growth_percent / 100,
+                             INLINE_GROWTH_MINIMUM);
+
+  DefinitionStore definitions = split_definitions (opcodes_);
+  std::vector<bool> is_changed (definitions.size (), true);
+  bool is_expanded = false;
+  bool is_limited = false;
+
+  for (int rounds = 0; ; ++rounds)
     {
-      is_optimizing = remove_unreachable_code ()
-                      + remove_unnecessary_jumps ()
-                      + remove_useless_calls ()
-                      + inline_booleans ()
-                      + inline_small_functions ()
-                      + replace_adjacent_push_pop_pairs ()
-                      + relocate_suboptimal_labels ()
-                      + remove_unnecessary_labels ();
-      ++iterations;
+      for (size_t i = 0; i < definitions.size (); ++i)
+        {
+          if (is_changed[i])
+            is_limited |= !settle_definition (&definitions[i], options);
+          is_changed[i] = false;
+        }
+      join_definitions (definitions, &opcodes_);
+
+      if (rounds >= ITERATIONS_LIMIT)
+        {
+          is_limited = true;
+          break;
+        }
+
+      int optimizations = run_passes (MODULE, options);
+      if (optimizations)
+        {
+          const DefinitionStore updated = split_definitions (opcodes_);
+          is_changed.assign (updated.size (), updated.size ()
+                                              != definitions.size ());
+          for (size_t i = 0; i < updated.size (); ++i)
+            {
+              if (i < definitions.size () && updated[i] != definitions[i])
+                is_changed[i] = true;
+            }
+          definitions = updated;
+        }
+      else if (!is_expanded)
+        {
+          for (size_t i = 0; i < definitions.size (); ++i)
+            {
+              const int expansions = run_on_definition (&definitions[i],
+                                                        EXPANSION, options);
+              is_changed[i] = expansions > 0;
+              optimizations += expansions;
+            }
+          is_expanded = true;
+        }
+
+      if (!optimizations)
+        break;
     }
-  while (is_optimizing && iterations < ITERATIONS_LIMIT);
 
-  if (iterations >= ITERATIONS_LIMIT)
+  if (is_limited)
     {
       std::cerr << source_path
                 << ": warning: optimization limit reached after "
                 << ITERATIONS_LIMIT << " iterations" << std::endl;
     }
+
+  run_passes (FINAL, options);
 }
@@ -21,6 +21,9 @@
 #ifndef VNPFORTH_OPTIONS_H
 #define VNPFORTH_OPTIONS_H
 
+#include <map>
+#include <string>
+
 class CommandLine;
 
 // Generalized control options and flags.
@@ -32,9 +35,12 @@ public:
   inline
   Options ()
     : debugging_flag_ (false), profiling_flag_ (false), weak_flag_ (false),
-      PIC_flag_ (false), optimize_flag_ (false), intermediate_flag_ (false),
+      PIC_flag_ (false), optimize_level_ (0), intermediate_flag_ (false),
       assembly_flag_ (false), mangle_flag_ (false), demangle_flag_ (false),
-      trace_parser_flag_ (false) { }
+      trace_parser_flag_ (false), stack_register_flag_ (false),
+      tos_register_flag_ (false), x86_64_flag_ (false),
+      external_as_flag_ (false), jobs_ (1), cache_stats_flag_ (false),
+      cache_size_ (64ULL << 20) { }
 
   inline bool
   include_debugging () const
@@ -63,7 +69,31 @@ public:
   inline bool
   optimize_code () const
   {
-    return optimize_flag_;
+    return optimize_level_ > 0;
+  }
+
+  inline int
+  optimize_level () const
+  {
+    return optimize_level_;
+  }
+
+  // Return true if the named optimization pass runs, by default from the
+  // given optimization level up, or as -f<name> or -fno-<name> directs.
+  inline bool
+  use_pass (const std::string & name, int level) const
+  {
+    const std::map<std::string, bool>::const_iterator found
+        = pass_flags_.find (name);
+    if (found != pass_flags_.end ())
+      return optimize_level_ > 0 && found->second;
+    return optimize_level_ >= level;
+  }
+
+  inline const std::map<std::string, bool> &
+  pass_flags () const
+  {
+    return pass_flags_;
   }
 
   inline bool
@@ -96,17 +126,80 @@ public:
     return trace_parser_flag_;
   }
 
+  inline bool
+  stack_register () const
+  {
+    return stack_register_flag_;
+  }
+
+  inline bool
+  tos_register () const
+  {
+    return tos_register_flag_;
+  }
+
+  inline bool
+  target_x86_64 () const
+  {
+    return x86_64_flag_;
+  }
+
+  inline bool
+  external_assembler () const
+  {
+    return external_as_flag_;
+  }
+
+  inline int
+  parallel_jobs () const
+  {
+    return jobs_;
+  }
+
+  inline bool
+  use_cache () const
+  {
+    return !cache_directory_.empty ();
+  }
+
+  inline const std::string &
+  cache_directory () const
+  {
+    return cache_directory_;
+  }
+
+  inline unsigned long long
+  cache_size () const
+  {
+    return cache_size_;
+  }
+
+  inline bool
+  cache_statistics () const
+  {
+    return cache_stats_flag_;
+  }
+
 private:
   bool debugging_flag_;
   bool profiling_flag_;
   bool weak_flag_;
   bool PIC_flag_;
-  bool optimize_flag_;
+  int optimize_level_;
   bool intermediate_flag_;
   bool assembly_flag_;
   bool mangle_flag_;
   bool demangle_flag_;
   bool trace_parser_flag_;
+  bool stack_register_flag_;
+  bool tos_register_flag_;
+  bool x86_64_flag_;
+  bool external_as_flag_;
+  std::map<std::string, bool> pass_flags_;
+  int jobs_;
+  bool cache_stats_flag_;
+  std::string cache_directory_;
+  unsigned long long cache_size_;
 };
 
 #endif
@@ -37,19 +37,14 @@
 #include "operand.h"
 #include "optable.h"
 #include "parser.h"
+#include "scanner.h"
 #include "symbol.h"
 #include "symtable.h"
 #include "util.h"
 
-// Stub yywrap() to avoid linking libfl.
-extern "C" int yywrap (void) { return 1; }
-
-// Global declaration of pointer to active parser, linked to by yacc/lex
-// modules, and external declaration of the bits of yacc/lex we call/use.
-Parser * parser_ = 0;
-extern void yyrestart (std::FILE *);
-extern int yyparse ();
-extern const char * yylval;
+// External declaration of the bits of yacc we call/use.  The parser is
+// pure, so that parsers are independent; only the trace flag is shared.
+extern int yyparse (Parser * parser);
 extern int yydebug;
 
 // Static count of max tolerable errors before giving up.
@@ -60,7 +55,8 @@ bool
 Parser::parse (const std::string & source_path,
                std::FILE * stream, DataTable * dattable,
                SymbolTable * symtable, OpcodeTable * optable,
-               const std::set<std::string> * definitions, bool trace_parser)
+               const std::set<std::string> * definitions, int cell_bits,
+               bool trace_parser)
 {
   source_path_ = source_path;
 
@@ -68,17 +64,21 @@ Parser::parse (const std::string & source_path,
   symtable_ = symtable;
   optable_ = optable;
   definitions_ = definitions;
+  cell_bits_ = cell_bits;
 
   parse_setup ();
 
-  parser_ = this;
-  yyrestart (stream);
-  yydebug = trace_parser;
-  const int parse_status = yyparse ();
-  parser_ = 0;
-  yydebug = 0;
+  Scanner scanner (stream, this);
+  scanner_ = &scanner;
+
+  token_text_ = 0;
+  if (trace_parser)
+    yydebug = 1;
+  const int parse_status = yyparse (this);
+  token_text_ = 0;
 
   parse_cleanup ();
+  scanner_ = 0;
 
   dattable_ = 0;
   symtable_ = 0;
@@ -88,14 +88,25 @@ Parser::parse (const std::string & source_path,
   return (parse_status == 0) && (error_count_ == 0);
 }
 
+// Return the next token and its text, for the yacc module.  Note the text
+// for error reports.
+int
+Parser::scan (const char ** text)
+{
+  const int token = scanner_->scan (text);
+  token_text_ = *text;
+  return token;
+}
+
 // Parser error reporting, called from yacc/lex or internally only.
 std::ostream &
 Parser::parse_error ()
 {
   ++error_count_;
   std::cerr << source_path_ << ':';
-  if (parser_ && yylval)
-    std::cerr << line_number_ << ": error: near '" << trim (yylval) << "', ";
+  if (token_text_)
+    std::cerr << line_number_ << ": error: near '" << trim (token_text_)
+              << "', ";
   else
     std::cerr << " error: ";
   return std::cerr;
@@ -105,8 +116,9 @@ std::ostream &
 Parser::parse_warning ()
 {
   std::cerr << source_path_ << ':';
-  if (parser_ && yylval)
-    std::cerr << line_number_ << ": warning: near '" << trim (yylval) << "', ";
+  if (token_text_)
+    std::cerr << line_number_ << ": warning: near '" << trim (token_text_)
+              << "', ";
   else
     std::cerr << " warning: ";
   return std::cerr;
@@ -118,6 +130,7 @@ Parser::parse_setup ()
   line_number_ = 1;
   error_count_ = 0;
   current_definition_ = 0;
+  last_definition_ = 0;
 
   label_sequence_ = 1;
   exit_label_ = 0;
@@ -157,85 +170,92 @@ Parser::parse_cleanup ()
     }
 }
 
-// Strto[u]l wrappers, explicitly overflow values that fit long but not int
-// and add support for non-decimal literal prefixes.
+// Strto[u]ll wrappers, explicitly overflow values that fit long long but
+// not a cell of the given bits width, and add support for non-decimal
+// literal prefixes.
 namespace {
 
-long
-to_long (bool negative, const std::string & str, int base)
+long long
+to_long_long (bool negative, const std::string & str, int base)
 {
   errno = 0;
   const std::string repr = std::string (negative ? "-" : "") + str;
-  return std::strtol (repr.c_str (), 0, base);
+  return std::strtoll (repr.c_str (), 0, base);
 }
 
-int
-to_int (const std::string & str)
+long long
+to_cell (const std::string & str, int bits)
 {
   const char * ss = str.c_str ();
 
   const bool negative = (ss[0] == '-');
   ss += (ss[0] == '-' || ss[0] == '+') ? 1 : 0;
 
-  long value = 0;
+  long long value = 0;
   switch (ss[0])
     {
-    case '%': value = to_long (negative, ss + 1, 2); break;
-    case '$': value = to_long (negative, ss + 1, 16); break;
+    case '%': value = to_long_long (negative, ss + 1, 2); break;
+    case '$': value = to_long_long (negative, ss + 1, 16); break;
     case '&':
-    case '#': value = to_long (negative, ss + 1, 10); break;
+    case '#': value = to_long_long (negative, ss + 1, 10); break;
     case '0':
       switch (ss[1])
         {
-        case 'b': case 'B': value = to_long (negative, ss + 2, 2); break;
-        case 'o': case 'O': value = to_long (negative, ss + 2, 8); break;
-        case 'x': case 'X': value = to_long (negative, ss + 2, 16); break;
-        default: value = to_long (negative, ss, 10); break;
+        case 'b': case 'B': value = to_long_long (negative, ss + 2, 2); break;
+        case 'o': case 'O': value = to_long_long (negative, ss + 2, 8); break;
+        case 'x': case 'X':
+          value = to_long_long (negative, ss + 2, 16);
+          break;
+        default: value = to_long_long (negative, ss, 10); break;
         }
         break;
-    default: value = to_long (negative, ss, 10); break;
+    default: value = to_long_long (negative, ss, 10); break;
     }
 
-  errno = value > INT_MAX || value < INT_MIN ? ERANGE : errno;
+  if (bits == 32)
+    errno = value > INT_MAX || value < INT_MIN ? ERANGE : errno;
   return value;
 }
 
-unsigned long
-to_ulong (bool negative, const std::string & str, int base)
+unsigned long long
+to_ulong_long (bool negative, const std::string & str, int base)
 {
   errno = 0;
   const std::string repr = std::string (negative ? "-" : "") + str;
-  return std::strtoul (repr.c_str (), 0, base);
+  return std::strtoull (repr.c_str (), 0, base);
 }
 
-unsigned int
-to_uint (const std::string & str)
+unsigned long long
+to_ucell (const std::string & str, int bits)
 {
   const char * ss = str.c_str ();
 
   const bool negative = (ss[0] == '-');
   ss += (ss[0] == '-' || ss[0] == '+') ? 1 : 0;
 
-  unsigned long value = 0;
+  unsigned long long value = 0;
   switch (ss[0])
     {
-    case '%': value = to_ulong (negative, ss + 1, 2); break;
-    case '$': value = to_ulong (negative, ss + 1, 16); break;
+    case '%': value = to_ulong_long (negative, ss + 1, 2); break;
+    case '$': value = to_ulong_long (negative, ss + 1, 16); break;
     case '&':
-    case '#': value = to_ulong (negative, ss + 1, 10); break;
+    case '#': value = to_ulong_long (negative, ss + 1, 10); break;
     case '0':
       switch (ss[1])
         {
-        case 'b': case 'B': value = to_ulong (negative, ss + 2, 2); break;
-        case 'o': case 'O': value = to_ulong (negative, ss + 2, 8); break;
-        case 'x': case 'X': value = to_ulong (negative, ss + 2, 16); break;
-        default: value = to_ulong (negative, ss, 10); break;
+        case 'b': case 'B': value = to_ulong_long (negative, ss + 2, 2); break;
+        case 'o': case 'O': value = to_ulong_long (negative, ss + 2, 8); break;
+        case 'x': case 'X':
+          value = to_ulong_long (negative, ss + 2, 16);
+          break;
+        default: value = to_ulong_long (negative, ss, 10); break;
         }
         break;
-    default: value = to_ulong (negative, ss, 10); break;
+    default: value = to_ulong_long (negative, ss, 10); break;
     }
 
-  errno = value > UINT_MAX ? ERANGE : errno;
+  if (bits == 32)
+    errno = value > UINT_MAX ? ERANGE : errno;
   return value;
 }
 
@@ -375,7 +395,7 @@ Parser::f_definedarray (const std::string & s,
       return;
     }
 
-  const int size = to_int (ssize);
+  const int size = to_cell (ssize, 32);
   if (errno == ERANGE)
     {
       std::istringstream ins2 (ssize);
@@ -520,6 +540,7 @@ Parser::f_semicolon ()
   new EndDefineOpcode (current_definition_, line_number_, optable_);
 
   const Symbol * symbol = current_definition_;
+  last_definition_ = current_definition_;
   current_definition_ = 0;
 
   if (symbol->is_anonword_symbol ())
@@ -648,6 +669,23 @@ Parser::f_dotparenstring (const std::string & s)
 void
 Parser::f_word (const std::string & s)
 {
+  // Outside a definition, INLINE and NOINLINE hint whether to inline the
+  // most recent definition, unless the program defines words so named.
+  const std::string ss = to_lower (s);
+  if (!current_definition_ && (ss == "inline" || ss == "noinline"))
+    {
+      const Symbol * symbol = symtable_->lookup (s);
+      if (!symbol || !symbol->is_definable_symbol ())
+        {
+          if (last_definition_)
+            optable_->set_inline_hint (last_definition_, ss == "inline");
+          else
+            parse_error () << "'" << s << "' follows no definition"
+                << std::endl;
+          return;
+        }
+    }
+
   detect_main ();
 
   const Symbol * symbol = symtable_->lookup (s);
@@ -728,18 +766,12 @@ Parser::f_char_literal (const std::string & s)
   new PushOpcode (Register::R0, Stack::DATA, line_number_, optable_);
 }
 
+// Accept integer literals that fit a target cell, signed or unsigned, and
+// hold unsigned ones as the signed cell with the same bits.
 void
 Parser::f_integer_literal (const std::string & s)
 {
-  if (INT_MIN != (1 << 31))
-    parse_error () << "internal error: int is not four bytes" << std::endl;
-
-  union {
-    int i;
-    unsigned int u;
-  } literal;
-
-  literal.i = to_int (s);
+  long long literal = to_cell (s, cell_bits_);
   if (errno == ERANGE)
     {
       if (s[0] == '-')
@@ -748,18 +780,21 @@ Parser::f_integer_literal (const std::string & s)
               << "integer literal '" << s << "' out of range" << std::endl;
           return;
         }
-      literal.u = to_uint (s);
+      const unsigned long long value = to_ucell (s, cell_bits_);
       if (errno == ERANGE)
         {
           parse_error ()
               << "integer literal '" << s << "' out of range" << std::endl;
           return;
         }
+      literal = cell_bits_ == 32 && value > INT_MAX
+                ? static_cast<long long> (value) - 0x100000000LL
+                : static_cast<long long> (value);
     }
 
   detect_main ();
   new LoadValueOpcode (Register::R0,
-                       Value (literal.i), line_number_, optable_);
+                       Value (literal), line_number_, optable_);
   new PushOpcode (Register::R0, Stack::DATA, line_number_, optable_);
 }
 
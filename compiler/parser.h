@@ -36,6 +36,7 @@ class SymbolTable;
 class OpcodeTable;
 class CommandLine;
 class DefinableSymbol;
+class Scanner;
 
 // Parser, builds a program from source.
 class Parser
@@ -45,16 +46,20 @@ public:
 
   inline
   Parser ()
-    : dattable_ (0), symtable_ (0), optable_ (0), line_number_ (0),
-      error_count_ (0), current_definition_ (0), label_sequence_ (0),
+    : dattable_ (0), symtable_ (0), optable_ (0), scanner_ (0),
+      cell_bits_ (32), token_text_ (0), line_number_ (0), error_count_ (0),
+      current_definition_ (0), last_definition_ (0), label_sequence_ (0),
       exit_label_ (0), implicit_main_ (false) { }
 
   bool parse (const std::string & source_path,
               std::FILE * stream, DataTable * dattable,
               SymbolTable * symtable, OpcodeTable * optable,
-              const std::set<std::string> * definitions, bool trace_parser);
+              const std::set<std::string> * definitions, int cell_bits,
+              bool trace_parser);
 
   // Parser terminals, public to be callable by non-OO yacc/lex modules.
+  int scan (const char ** text);
+
   inline void
   next_line ()
   {
@@ -126,11 +131,15 @@ private:
   SymbolTable * symtable_;
   OpcodeTable * optable_;
   const std::set<std::string> * definitions_;
+  Scanner * scanner_;
+  int cell_bits_;
+  const char * token_text_;
 
   int line_number_;
   int error_count_;
 
   const DefinableSymbol * current_definition_;
+  const DefinableSymbol * last_definition_;
 
   int label_sequence_;
   int exit_label_;
@@ -0,0 +1,599 @@
+// vi: set ts=2 shiftwidth=2 expandtab:
+//
+// VNPForth - Compiled native Forth for x86 Linux
+// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <cctype>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "options.h"
+#include "peephole.h"
+#include "util.h"
+
+// Helpers for parsing and matching assembly lines.
+namespace {
+
+// Split instruction operands at commas not inside parentheses.
+std::vector<std::string>
+split_operands (const std::string & str)
+{
+  std::vector<std::string> operands;
+  if (trim (str).empty ())
+    return operands;
+
+  int depth = 0;
+  std::string operand;
+  for (std::string::size_type i = 0; i < str.size (); ++i)
+    {
+      const char c = str[i];
+      if (c == ',' && depth == 0)
+        {
+          operands.push_back (trim (operand));
+          operand.clear ();
+          continue;
+        }
+
+      if (c == '(')
+        depth++;
+      else if (c == ')')
+        depth--;
+      operand += c;
+    }
+  operands.push_back (trim (operand));
+  return operands;
+}
+
+// Return the register family of a register operand, for example "ax" for
+// any of %rax, %eax, %ax, %al and %ah, or "" if not a register.
+std::string
+register_family (const std::string & operand)
+{
+  if (operand.size () < 3 || operand[0] != '%')
+    return "";
+
+  std::string name = operand.substr (1);
+  for (std::string::size_type i = 0; i < name.size (); ++i)
+    {
+      if (!std::isalnum (static_cast<unsigned char> (name[i])))
+        return "";
+    }
+
+  if (name[0] == 'r' && std::isdigit (static_cast<unsigned char> (name[1])))
+    {
+      const char last = name[name.size () - 1];
+      if (last == 'd' || last == 'w' || last == 'b')
+        name.erase (name.size () - 1);
+      return name;
+    }
+
+  if (name.size () == 3 && (name[0] == 'r' || name[0] == 'e'))
+    return name.substr (1);
+  if (name.size () == 3 && name[2] == 'l')
+    return name.substr (0, 2);
+  if (name.size () == 2 && (name[1] == 'l' || name[1] == 'h')
+      && name[0] >= 'a' && name[0] <= 'd')
+    return std::string (1, name[0]) + 'x';
+  return name;
+}
+
+// Return true if operand text refers to any register in family.
+bool
+mentions_family (const std::string & operand, const std::string & family)
+{
+  std::string::size_type percent = operand.find ('%');
+  while (percent != std::string::npos)
+    {
+      std::string::size_type end = percent + 1;
+      while (end < operand.size ()
+             && std::isalnum (static_cast<unsigned char> (operand[end])))
+        end++;
+
+      if (register_family (operand.substr (percent, end - percent)) == family)
+        return true;
+      percent = operand.find ('%', end);
+    }
+  return false;
+}
+
+// Return the mnemonic with any l or q operand size suffix removed, for the
+// given set of base mnemonics, or "" if it is not one of them.
+std::string
+base_mnemonic (const std::string & mnemonic, const char * const * bases)
+{
+  for (int i = 0; bases[i]; ++i)
+    {
+      const std::string base = bases[i];
+      if (mnemonic == base || mnemonic == base + 'l' || mnemonic == base + 'q')
+        return base;
+    }
+  return "";
+}
+
+const char * const MOVES[] = { "mov", "lea", 0 };
+const char * const FLAG_SETTERS[] = { "add", "sub", "and", "or", "xor",
+                                      "inc", "dec", "neg", 0 };
+const char * const EXCHANGES[] = { "xchg", 0 };
+
+// Instructions with no implicit register operands.
+const char * const EXPLICIT[] = { "mov", "lea", "add", "sub", "and", "or",
+                                  "xor", "inc", "dec", "neg", "not", "cmp",
+                                  "test", "shl", "shr", "sar", "xchg", 0 };
+
+// Return true for conditional jumps that test only the zero or sign flags.
+bool
+is_zero_sign_jump (const std::string & mnemonic)
+{
+  return mnemonic == "je" || mnemonic == "jne" || mnemonic == "jz"
+         || mnemonic == "jnz" || mnemonic == "js" || mnemonic == "jns";
+}
+
+// Return true if operand is a call target of the named runtime stack
+// function, PIC or not.
+bool
+is_runtime_call (const std::string & operand, const std::string & name)
+{
+  return operand == "v4_" + name || operand == "v4_" + name + "@PLT";
+}
+
+bool
+is_push_call (const std::string & operand)
+{
+  return is_runtime_call (operand, "_rpush")
+         || is_runtime_call (operand, "_dpush");
+}
+
+bool
+is_pop_call (const std::string & operand)
+{
+  return is_runtime_call (operand, "_rpop")
+         || is_runtime_call (operand, "_dpop");
+}
+
+// Return true if text is a numeric local label, as used by code words.
+bool
+is_numeric (const std::string & text)
+{
+  for (std::string::size_type i = 0; i < text.size (); ++i)
+    {
+      if (!std::isdigit (static_cast<unsigned char> (text[i])))
+        return false;
+    }
+  return !text.empty ();
+}
+
+} // namespace
+
+// Parse assembly text into lines.  Anything between #APP and #NO_APP is
+// code word assembly, and along with comments and assignments is opaque.
+void
+Peephole::parse (const std::string & assembly)
+{
+  lines_.clear ();
+
+  std::istringstream ins (assembly);
+  std::string text, function;
+  bool in_app = false;
+
+  while (std::getline (ins, text))
+    {
+      Line line;
+      line.text = text;
+      line.deleted = false;
+
+      const std::string trimmed = trim (text);
+      const std::string::size_type space = trimmed.find_first_of (" \t");
+
+      if (trimmed == "#APP" || trimmed == "#NO_APP")
+        {
+          in_app = trimmed == "#APP";
+          line.kind = OPAQUE;
+        }
+      else if (in_app || trimmed[0] == '#'
+               || (trimmed[0] != '.'
+                   && trimmed.find_first_of (";=") != std::string::npos))
+        line.kind = OPAQUE;
+      else if (trimmed.empty ())
+        line.kind = BLANK;
+      else if (trimmed[trimmed.size () - 1] == ':'
+               && space == std::string::npos)
+        {
+          line.kind = LABEL;
+          line.name = trimmed.substr (0, trimmed.size () - 1);
+          if (line.name[0] != '.' && !is_numeric (line.name))
+            function = line.name;
+        }
+      else
+        {
+          line.kind = trimmed[0] == '.' ? DIRECTIVE : INSTRUCTION;
+          line.name = trimmed.substr (0, space);
+          if (space != std::string::npos)
+            line.operands = split_operands (trimmed.substr (space));
+        }
+
+      line.function = function;
+      lines_.push_back (line);
+    }
+}
+
+// Find all labels referenced other than by debugging and symbol sizing
+// directives.  Only these labels can be the target of a jump.
+void
+Peephole::find_references ()
+{
+  references_.clear ();
+
+  for (size_t i = 0; i < lines_.size (); ++i)
+    {
+      const Line & line = lines_[i];
+      if (line.kind == BLANK || line.kind == LABEL
+          || (line.kind == DIRECTIVE
+              && (line.name == ".stabs" || line.name == ".stabn"
+                  || line.name == ".size" || line.name == ".type")))
+        continue;
+
+      const std::string & text = line.text;
+      std::string::size_type start = 0;
+      while (start < text.size ())
+        {
+          const unsigned char c = text[start];
+          if (!(std::isalpha (c) || c == '_' || c == '.'))
+            {
+              start++;
+              continue;
+            }
+
+          std::string::size_type end = start + 1;
+          while (end < text.size ()
+                 && (std::isalnum (static_cast<unsigned char> (text[end]))
+                     || text[end] == '_' || text[end] == '.'))
+            end++;
+          references_.insert (text.substr (start, end - start));
+          start = end;
+        }
+    }
+}
+
+// Return true if line is a label that control may arrive at other than by
+// falling into it.
+bool
+Peephole::is_join (const Line & line) const
+{
+  return line.kind == LABEL
+         && (is_numeric (line.name) || references_.count (line.name) > 0);
+}
+
+// Return true if line neither generates code nor is a jump target.
+bool
+Peephole::is_transparent (const Line & line) const
+{
+  return line.deleted || line.kind == BLANK
+         || (line.kind == LABEL && !is_join (line))
+         || (line.kind == DIRECTIVE
+             && (line.name == ".stabs" || line.name == ".stabn"));
+}
+
+// Return true if operand is a register of the target's full word size.
+// Moves between these are the only ones free of side effects.
+bool
+Peephole::is_full_register (const std::string & operand) const
+{
+  return operand.size () == 4 && operand[0] == '%'
+         && operand[1] == (x86_64_ ? 'r' : 'e')
+         && !register_family (operand).empty ();
+}
+
+// Return the index of the next line after index that is not transparent,
+// or the number of lines if there is none.
+size_t
+Peephole::next_code (size_t index) const
+{
+  size_t next = index + 1;
+  while (next < lines_.size () && is_transparent (lines_[next]))
+    next++;
+  return next;
+}
+
+// Return true if the accumulator is overwritten after index before it is
+// read, on the straight-line path that follows.  Labels do not matter here,
+// since only the code that follows them is of interest.
+bool
+Peephole::is_accumulator_dead (size_t index) const
+{
+  for (size_t i = index + 1; i < lines_.size (); ++i)
+    {
+      const Line & line = lines_[i];
+      if (is_transparent (line) || line.kind == LABEL)
+        continue;
+      if (line.kind != INSTRUCTION)
+        return false;
+
+      const std::vector<std::string> & operands = line.operands;
+      if (line.name == "call")
+        return operands.size () == 1 && is_pop_call (operands[0]);
+
+      // A 32 bit move clears the top half of %rax, so either size will do.
+      if (operands.size () == 2
+          && (operands[1] == "%eax" || operands[1] == "%rax"))
+        {
+          if (base_mnemonic (line.name, MOVES) == "mov")
+            return !mentions_family (operands[0], "ax");
+          if (base_mnemonic (line.name, FLAG_SETTERS) == "xor"
+              && operands[0] == operands[1])
+            return true;
+        }
+
+      // Step over instructions that leave the accumulator alone.
+      if (base_mnemonic (line.name, EXPLICIT).empty ())
+        return false;
+      for (size_t j = 0; j < operands.size (); ++j)
+        {
+          if (mentions_family (operands[j], "ax"))
+            return false;
+        }
+    }
+  return false;
+}
+
+// Replace a line with new instruction text.
+void
+Peephole::rewrite (size_t index, const std::string & text)
+{
+  Line & line = lines_[index];
+  const std::string::size_type space = text.find (' ');
+
+  line.text = '\t' + text;
+  line.name = text.substr (0, space);
+  line.operands = split_operands (text.substr (space));
+}
+
+// Note a rewrite for the listing.
+void
+Peephole::record (const std::string & rule, const std::string & before,
+                  const std::string & after, const std::string & function)
+{
+  std::ostringstream entry;
+  entry << "  " << (function.empty () ? "-" : function) << ": " << rule
+        << ": " << before << " => " << (after.empty () ? "(none)" : after);
+  rewrites_.push_back (entry.str ());
+}
+
+// mov %R,%R, a no-op for full word registers.
+bool
+Peephole::self_move (size_t index)
+{
+  Line & line = lines_[index];
+  if (base_mnemonic (line.name, MOVES) != "mov" || line.operands.size () != 2
+      || line.operands[0] != line.operands[1]
+      || !is_full_register (line.operands[0]))
+    return false;
+
+  line.deleted = true;
+  record ("self-move", trim (line.text), "", line.function);
+  return true;
+}
+
+// mov %A,%B followed by mov %B,%A; the second move changes nothing.
+bool
+Peephole::move_back (size_t index)
+{
+  const Line & line = lines_[index];
+  if (base_mnemonic (line.name, MOVES) != "mov" || line.operands.size () != 2
+      || !is_full_register (line.operands[0])
+      || !is_full_register (line.operands[1]))
+    return false;
+
+  const size_t next = next_code (index);
+  if (next == lines_.size ())
+    return false;
+
+  Line & back = lines_[next];
+  if (back.kind != INSTRUCTION || base_mnemonic (back.name, MOVES) != "mov"
+      || back.operands.size () != 2
+      || back.operands[0] != line.operands[1]
+      || back.operands[1] != line.operands[0])
+    return false;
+
+  back.deleted = true;
+  record ("move-back", trim (line.text) + "; " + trim (back.text),
+          trim (line.text), line.function);
+  return true;
+}
+
+// xchg %D,%A; call push or pop; xchg %A,%D, used to push from or pop into
+// a register other than the accumulator.  Where the accumulator is dead
+// afterwards, a move either before a push or after a pop does the same.
+bool
+Peephole::exchange_call (size_t index)
+{
+  Line & first = lines_[index];
+  if (base_mnemonic (first.name, EXCHANGES).empty ()
+      || first.operands.size () != 2
+      || !is_full_register (first.operands[0])
+      || !is_full_register (first.operands[1]))
+    return false;
+
+  std::string accumulator, other;
+  if (register_family (first.operands[0]) == "ax")
+    accumulator = first.operands[0], other = first.operands[1];
+  else if (register_family (first.operands[1]) == "ax")
+    accumulator = first.operands[1], other = first.operands[0];
+  else
+    return false;
+
+  const size_t call = next_code (index);
+  if (call == lines_.size () || lines_[call].kind != INSTRUCTION
+      || lines_[call].name != "call" || lines_[call].operands.size () != 1)
+    return false;
+
+  const std::string & target = lines_[call].operands[0];
+  const bool push = is_push_call (target);
+  if (!push && !is_pop_call (target))
+    return false;
+
+  const size_t last = next_code (call);
+  if (last == lines_.size ()
+      || base_mnemonic (lines_[last].name, EXCHANGES).empty ()
+      || lines_[last].operands.size () != 2
+      || !((lines_[last].operands[0] == accumulator
+            && lines_[last].operands[1] == other)
+           || (lines_[last].operands[0] == other
+               && lines_[last].operands[1] == accumulator))
+      || !is_accumulator_dead (last))
+    return false;
+
+  const std::string before = trim (first.text) + "; "
+                             + trim (lines_[call].text) + "; "
+                             + trim (lines_[last].text);
+  if (push)
+    {
+      rewrite (index, "mov " + other + ',' + accumulator);
+      lines_[last].deleted = true;
+      record ("exchange-push", before,
+              trim (first.text) + "; " + trim (lines_[call].text),
+              first.function);
+    }
+  else
+    {
+      first.deleted = true;
+      rewrite (last, "mov " + accumulator + ',' + other);
+      record ("exchange-pop", before,
+              trim (lines_[call].text) + "; " + trim (lines_[last].text),
+              first.function);
+    }
+  return true;
+}
+
+// test %R,%R before a zero or sign flag jump, where an arithmetic or logic
+// instruction on R has already set the flags, with only moves between.
+bool
+Peephole::redundant_test (size_t index)
+{
+  Line & test = lines_[index];
+  if (test.name != "test" || test.operands.size () != 2
+      || test.operands[0] != test.operands[1]
+      || register_family (test.operands[0]).empty ())
+    return false;
+
+  const size_t jump = next_code (index);
+  if (jump == lines_.size () || lines_[jump].kind != INSTRUCTION
+      || !is_zero_sign_jump (lines_[jump].name))
+    return false;
+
+  const std::string & reg = test.operands[0];
+  const std::string family = register_family (reg);
+  for (size_t i = index; i-- > 0;)
+    {
+      const Line & line = lines_[i];
+      if (is_transparent (line))
+        continue;
+      if (line.kind != INSTRUCTION || line.operands.empty ())
+        return false;
+
+      const std::string & destination = line.operands.back ();
+      if (!base_mnemonic (line.name, FLAG_SETTERS).empty ())
+        {
+          if (destination != reg)
+            return false;
+
+          test.deleted = true;
+          record ("redundant-test", trim (test.text), "", test.function);
+          return true;
+        }
+
+      if (base_mnemonic (line.name, MOVES).empty ()
+          || register_family (destination) == family)
+        return false;
+    }
+  return false;
+}
+
+// jmp L immediately followed by label L.
+bool
+Peephole::jump_next (size_t index)
+{
+  Line & jump = lines_[index];
+  if (jump.name != "jmp" || jump.operands.size () != 1)
+    return false;
+
+  for (size_t i = index + 1; i < lines_.size (); ++i)
+    {
+      const Line & line = lines_[i];
+      if (line.kind == LABEL && line.name == jump.operands[0])
+        {
+          jump.deleted = true;
+          record ("jump-next", trim (jump.text), "", jump.function);
+          return true;
+        }
+      if (!is_transparent (line) && line.kind != LABEL)
+        return false;
+    }
+  return false;
+}
+
+// Parse assembly and apply rewrites until none remain.
+void
+Peephole::optimize (const std::string & assembly, const Options & options)
+{
+  x86_64_ = options.target_x86_64 ();
+  rewrites_.clear ();
+
+  parse (assembly);
+  find_references ();
+
+  bool changed = true;
+  while (changed)
+    {
+      changed = false;
+      for (size_t i = 0; i < lines_.size (); ++i)
+        {
+          if (lines_[i].deleted || lines_[i].kind != INSTRUCTION)
+            continue;
+
+          changed |= self_move (i)
+                     || move_back (i)
+                     || exchange_call (i)
+                     || redundant_test (i)
+                     || jump_next (i);
+        }
+    }
+}
+
+void
+Peephole::generate (std::ostream & outs) const
+{
+  for (size_t i = 0; i < lines_.size (); ++i)
+    {
+      if (!lines_[i].deleted)
+        outs << lines_[i].text << std::endl;
+    }
+}
+
+void
+Peephole::create_listing (std::ostream & outs) const
+{
+  if (rewrites_.empty ())
+    return;
+
+  outs << "Peephole rewrites:" << std::endl;
+  for (size_t i = 0; i < rewrites_.size (); ++i)
+    outs << rewrites_[i] << std::endl;
+  outs << std::endl;
+}
@@ -0,0 +1,83 @@
+// vi: set ts=2 shiftwidth=2 expandtab:
+//
+// VNPForth - Compiled native Forth for x86 Linux
+// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef VNPFORTH_PEEPHOLE_H
+#define VNPFORTH_PEEPHOLE_H
+
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "options.h"
+
+// Assembly level peephole optimizer.  Generated assembly is parsed into a
+// list of labels, directives and instructions, and short instruction
+// sequences that code generation leaves behind at opcode boundaries are
+// rewritten.  Code words' inline assembly is left untouched.  Each rewrite
+// is recorded for the intermediate listing.
+class Peephole
+{
+public:
+  Peephole () : x86_64_ (false) { }
+
+  void optimize (const std::string & assembly, const Options & options);
+  void generate (std::ostream & outs) const;
+  void create_listing (std::ostream & outs) const;
+
+private:
+  enum Kind { BLANK, LABEL, DIRECTIVE, INSTRUCTION, OPAQUE };
+
+  struct Line
+  {
+    std::string text;
+    Kind kind;
+    std::string name;
+    std::vector<std::string> operands;
+    std::string function;
+    bool deleted;
+  };
+
+  void parse (const std::string & assembly);
+  void find_references ();
+
+  bool is_join (const Line & line) const;
+  bool is_transparent (const Line & line) const;
+  bool is_full_register (const std::string & operand) const;
+  bool is_accumulator_dead (size_t index) const;
+  size_t next_code (size_t index) const;
+
+  bool self_move (size_t index);
+  bool move_back (size_t index);
+  bool exchange_call (size_t index);
+  bool redundant_test (size_t index);
+  bool jump_next (size_t index);
+
+  void rewrite (size_t index, const std::string & text);
+  void record (const std::string & rule, const std::string & before,
+               const std::string & after, const std::string & function);
+
+  bool x86_64_;
+  std::vector<Line> lines_;
+  std::set<std::string> references_;
+  std::vector<std::string> rewrites_;
+};
+
+#endif
@@ -23,6 +23,7 @@
 #include <cstring>
 #include <ctime>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include "cmdline.h"
@@ -30,6 +31,7 @@
 #include "optable.h"
 #include "options.h"
 #include "parser.h"
+#include "peephole.h"
 #include "program.h"
 #include "srcfile.h"
 #include "symtable.h"
@@ -58,6 +60,7 @@ Program::build (const std::string & source_path,
   const int status = parser.parse (source_path, source.get_stream (),
                                    &datatable_, &symtable_, &optable_,
                                    commandline.get_definitions (),
+                                   options_.target_x86_64 () ? 64 : 32,
                                    options_.trace_parser ());
 
   optable_.unreachable_check (source_path);
@@ -66,20 +69,32 @@ Program::build (const std::string & source_path,
     optable_.synthesize_main (symtable_);
 
   if (status && options_.optimize_code ())
-    optable_.optimize_code (source_path);
+    optable_.optimize_code (source_path, options_);
 
   return status;
 }
 
-// Front end to assembly code generation.
+// Front end to assembly code generation.  When optimizing, and unless
+// switched off, pass the assembly through the peephole optimizer on its
+// way out.
 void
-Program::generate (std::ostream & outs) const
+Program::generate (std::ostream & outs)
 {
-  generate_preamble (outs);
-  datatable_.generate (outs);
-  symtable_.generate (outs, options_);
-  optable_.generate (outs, options_);
-  generate_postamble (outs);
+  std::ostringstream assembly;
+  generate_preamble (assembly);
+  datatable_.generate (assembly);
+  symtable_.generate (assembly, options_);
+  optable_.generate (assembly, options_);
+  generate_postamble (assembly);
+
+  if (!OpcodeTable::is_pass_enabled ("peephole", options_))
+    {
+      outs << assembly.str ();
+      return;
+    }
+
+  peephole_.optimize (assembly.str (), options_);
+  peephole_.generate (outs);
 }
 
 // Pretty-print function to create intermediate store listing.
@@ -100,6 +115,9 @@ Program::create_listing (std::ostream & outs) const
        << (options_.include_profiling () ? " profile" : "")
        << (options_.weak_functions () ? " weak" : "")
        << (options_.position_independent () ? " PIC" : "")
+       << (options_.stack_register () ? " stack-register" : "")
+       << (options_.tos_register () ? " tos-register" : "")
+       << (options_.target_x86_64 () ? " x86_64" : "")
        << (options_.optimize_code () ? " optimize" : "")
        << (options_.save_intermediate () ? " intermediate" : "")
        << (options_.save_assembly () ? " assembly" : "")
@@ -108,4 +126,5 @@ Program::create_listing (std::ostream & outs) const
   datatable_.create_listing (outs);
   symtable_.create_listing (outs);
   optable_.create_listing (outs);
+  peephole_.create_listing (outs);
 }
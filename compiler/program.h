@@ -26,6 +26,7 @@
 
 #include "dattable.h"
 #include "optable.h"
+#include "peephole.h"
 #include "symtable.h"
 
 class CommandLine;
@@ -75,7 +76,7 @@ public:
     return options_;
   }
 
-  void generate (std::ostream & outs) const;
+  void generate (std::ostream & outs);
 
 private:
   Program (const Program & program);
@@ -89,6 +90,7 @@ private:
   DataTable datatable_;
   SymbolTable symtable_;
   OpcodeTable optable_;
+  Peephole peephole_;
 
   Options options_;
 };
@@ -23,38 +23,59 @@
 
 #include <string>
 
-// Register class, defines two registers, R0 and R1.
+// Register class, defines two working registers, R0 and R1, and three
+// registers, R2 to R4, for holding data stack cells within a basic block.
+// Each has a cpu name for x86, and another for x86_64.  A register holds
+// only its index into a table of these names, so that opcodes carrying
+// registers stay small and compare them cheaply.
 class Register
 {
 public:
-  inline const std::string
+  inline const std::string &
   get_name () const
   {
-    return name_;
+    return NAMES[id_].name;
   }
 
-  inline const std::string
+  inline const std::string &
   get_cpu_name () const
   {
-    return cpu_name_;
+    return NAMES[id_].cpu_name;
+  }
+
+  inline const std::string &
+  get_cpu_name_x86_64 () const
+  {
+    return NAMES[id_].cpu_name_x86_64;
   }
 
   inline bool
   equals (const Register & reg) const
   {
-    return name_ == reg.name_;
+    return id_ == reg.id_;
   }
 
   static const Register R0;
   static const Register R1;
+  static const Register R2;
+  static const Register R3;
+  static const Register R4;
 
 private:
-  inline
-  Register (const std::string & name, const std::string & cpu_name)
-    : name_ (name), cpu_name_ (cpu_name) { }
+  struct Names
+  {
+    const std::string name;
+    const std::string cpu_name;
+    const std::string cpu_name_x86_64;
+  };
+
+  static const Names NAMES[];
+
+  explicit inline
+  Register (int id)
+    : id_ (id) { }
 
-  const std::string name_;
-  const std::string cpu_name_;
+  const int id_;
 };
 
 #endif
@@ -0,0 +1,741 @@
+// vi: set ts=2 shiftwidth=2 expandtab:
+//
+// VNPForth - Compiled native Forth for x86 Linux
+// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <vector>
+
+#include "parser.h"
+#include "scanner.h"
+
+#define YYSTYPE const char *
+#include "forth.tab.hh"
+
+// Character classes, and the case insensitive comparison of source text
+// with an uppercase keyword.
+namespace {
+
+inline bool
+is_space (char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline bool
+is_word_character (char c)
+{
+  return static_cast<unsigned char>(c) > ' ';
+}
+
+inline bool
+is_digit (char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+inline bool
+is_hex_digit (char c)
+{
+  return is_digit (c) || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f');
+}
+
+inline bool
+is_octal_digit (char c)
+{
+  return c >= '0' && c <= '7';
+}
+
+inline bool
+is_binary_digit (char c)
+{
+  return c == '0' || c == '1';
+}
+
+inline char
+to_upper (char c)
+{
+  return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+}
+
+bool
+is_same_word (const char * start, const char * end, const char * keyword)
+{
+  for (; start < end; ++start, ++keyword)
+    {
+      if (*keyword == '\0' || to_upper (*start) != *keyword)
+        return false;
+    }
+  return *keyword == '\0';
+}
+
+std::string
+character_code (char c)
+{
+  std::ostringstream ss;
+  ss.fill ('0');
+  ss << "0x" << std::hex << std::setw (2)
+     << static_cast<int>(static_cast<unsigned char>(c));
+  return ss.str ();
+}
+
+} // namespace
+
+// Number and keyword recognition, for a word running from start up to but
+// not including end.  A word is a number or keyword only if it is one in
+// its entirety.
+namespace {
+
+bool
+is_all (const char * start, const char * end, bool (*is_class) (char))
+{
+  if (start == end)
+    return false;
+
+  for (; start < end; ++start)
+    {
+      if (!is_class (*start))
+        return false;
+    }
+  return true;
+}
+
+// Decimal, 0x hex, 0o octal, and 0b binary, and the &, #, $, and % prefixed
+// decimal, hex, and binary forms, each with an optional sign.
+bool
+is_integer (const char * start, const char * end)
+{
+  if (*start == '-' || *start == '+')
+    ++start;
+  if (start == end)
+    return false;
+
+  if (end - start > 2 && start[0] == '0')
+    {
+      switch (to_upper (start[1]))
+        {
+        case 'X':
+          return is_all (start + 2, end, is_hex_digit);
+        case 'O':
+          return is_all (start + 2, end, is_octal_digit);
+        case 'B':
+          return is_all (start + 2, end, is_binary_digit);
+        }
+    }
+
+  switch (*start)
+    {
+    case '&':
+    case '#':
+      return is_all (start + 1, end, is_digit);
+    case '$':
+      return is_all (start + 1, end, is_hex_digit);
+    case '%':
+      return is_all (start + 1, end, is_binary_digit);
+    default:
+      return is_all (start, end, is_digit);
+    }
+}
+
+// Digits with a point and optional fraction, an exponent, or both; the
+// exponent may omit its sign and digits.
+bool
+is_float (const char * start, const char * end)
+{
+  if (*start == '-' || *start == '+')
+    ++start;
+  if (start == end || !is_digit (*start))
+    return false;
+
+  while (start < end && is_digit (*start))
+    ++start;
+
+  bool is_fractional = false;
+  if (start < end && *start == '.')
+    {
+      is_fractional = true;
+      for (++start; start < end && is_digit (*start); )
+        ++start;
+    }
+
+  if (start == end)
+    return is_fractional;
+  if (to_upper (*start) != 'E')
+    return false;
+
+  ++start;
+  if (start < end && (*start == '-' || *start == '+'))
+    ++start;
+  while (start < end && is_digit (*start))
+    ++start;
+  return start == end;
+}
+
+struct Keyword
+{
+  const char * text;
+  size_t length;
+  int token;
+};
+
+#define KEYWORD(TEXT, TOKEN) { TEXT, sizeof (TEXT) - 1, TOKEN }
+
+const Keyword KEYWORDS[] = {
+  KEYWORD (":NONAME", NONAME), KEYWORD (":", ':'), KEYWORD (";", ';'),
+  KEYWORD ("EXIT", EXIT),
+  KEYWORD ("FVARIABLE", FVARIABLE), KEYWORD ("VARIABLE", VARIABLE),
+  KEYWORD ("CREATE", CREATE), KEYWORD ("ALLOT", ALLOT),
+  KEYWORD ("FCONSTANT", FCONSTANT), KEYWORD ("CONSTANT", CONSTANT),
+  KEYWORD ("IF", IF), KEYWORD ("ELSE", ELSE), KEYWORD ("THEN", THEN),
+  KEYWORD ("ENDIF", ENDIF),
+  KEYWORD ("DO", DO), KEYWORD ("?DO", QUERY_DO), KEYWORD ("LOOP", LOOP),
+  KEYWORD ("+LOOP", PLUS_LOOP), KEYWORD ("LEAVE", LEAVE),
+  KEYWORD ("?LEAVE", QUERY_LEAVE),
+  KEYWORD ("BEGIN", BEGIN_), KEYWORD ("UNTIL", UNTIL),
+  KEYWORD ("AGAIN", AGAIN), KEYWORD ("WHILE", WHILE),
+  KEYWORD ("REPEAT", REPEAT),
+  KEYWORD ("CASE", CASE), KEYWORD ("OF", OF), KEYWORD ("ENDOF", ENDOF),
+  KEYWORD ("ENDCASE", ENDCASE),
+  KEYWORD ("RECURSE", RECURSE),
+  KEYWORD ("[IFDEF]", COND_IFDEF), KEYWORD ("[IFUNDEF]", COND_IFUNDEF),
+  KEYWORD ("[ELSE]", COND_ELSE), KEYWORD ("[THEN]", COND_THEN),
+  KEYWORD ("[ENDIF]", COND_ENDIF),
+  KEYWORD ("CODE", CODE),
+  { 0, 0, 0 }
+};
+
+#undef KEYWORD
+
+// Keywords hashed on length and first and last characters into buckets,
+// built on first use, so that most words are rejected after one hash.
+const size_t KEYWORD_BUCKETS = 128;
+
+inline size_t
+hash_keyword (const char * start, const char * end)
+{
+  return (static_cast<size_t>(end - start) * 31
+          + static_cast<unsigned char>(to_upper (*start)) * 7
+          + static_cast<unsigned char>(to_upper (end[-1]))) % KEYWORD_BUCKETS;
+}
+
+struct KeywordBuckets
+{
+  std::vector<const Keyword *> buckets[KEYWORD_BUCKETS];
+};
+
+KeywordBuckets
+build_keyword_buckets ()
+{
+  KeywordBuckets keywords;
+
+  for (const Keyword * keyword = KEYWORDS; keyword->text; ++keyword)
+    {
+      const char * end = keyword->text + keyword->length;
+      keywords.buckets[hash_keyword (keyword->text, end)].push_back (keyword);
+    }
+  return keywords;
+}
+
+// Return the keyword's token, or 0 if the word is not a keyword.
+int
+find_keyword (const char * start, const char * end)
+{
+  static const KeywordBuckets keywords = build_keyword_buckets ();
+
+  const std::vector<const Keyword *> & bucket
+      = keywords.buckets[hash_keyword (start, end)];
+  for (size_t i = 0; i < bucket.size (); ++i)
+    {
+      if (is_same_word (start, end, bucket[i]->text))
+        return bucket[i]->token;
+    }
+  return 0;
+}
+
+// Return true if a word starting with c might take in the source after it,
+// as comments, strings, character literals, and addresses do.
+inline bool
+is_opening_character (char c)
+{
+  switch (c)
+    {
+    case '\\': case '(': case '\'': case '[': case '.':
+    case 'A': case 'a': case 'C': case 'c': case 'S': case 's':
+      return true;
+    default:
+      return false;
+    }
+}
+
+// Words that open strings running to a closing character on the same
+// line, and whether the word must be followed by a space rather than by
+// any blank.
+struct StringOpener
+{
+  const char * text;
+  char closing;
+  bool needs_space;
+  int token;
+};
+
+const StringOpener STRING_OPENERS[] = {
+  { "S\"", '"', true, STRING_LITERAL },
+  { "C\"", '"', true, CSTRING },
+  { ".\"", '"', true, PSTRING },
+  { "ABORT\"", '"', true, ASTRING },
+  { ".(", ')', false, DOTPARENSTRING },
+  { 0, '\0', false, 0 }
+};
+
+// Returned by the scanning functions that consume source without finding
+// a token, to scan on.
+const int CONTINUE = -1;
+
+} // namespace
+
+// Construct the scanner over a stream's source, and destructor.
+Scanner::Scanner (std::FILE * stream, Parser * parser)
+  : parser_ (parser), buffer_ (0), mapped_size_ (0), cursor_ (0), end_ (0),
+    held_ (0), held_character_ ('\0'), state_ (INITIAL)
+{
+  load (stream);
+}
+
+Scanner::~Scanner ()
+{
+  if (mapped_size_ > 0)
+    munmap (buffer_, mapped_size_);
+}
+
+// Map a regular file privately, so that tokens can be terminated in place,
+// into a reservation one byte larger than the file.  The byte past the end
+// of the file is then always mapped and zero, and is the sentinel.  Other
+// streams, and any that fail to map, are read into a copy instead.
+void
+Scanner::load (std::FILE * stream)
+{
+  const int descriptor = fileno (stream);
+
+  struct stat statbuf;
+  if (fstat (descriptor, &statbuf) == 0
+      && S_ISREG (statbuf.st_mode) && statbuf.st_size > 0)
+    {
+      const size_t size = statbuf.st_size;
+      void * reservation = mmap (0, size + 1, PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (reservation != MAP_FAILED)
+        {
+          if (mmap (reservation, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_FIXED, descriptor, 0) != MAP_FAILED)
+            {
+              buffer_ = static_cast<char *>(reservation);
+              mapped_size_ = size + 1;
+              cursor_ = buffer_;
+              end_ = buffer_ + size;
+              return;
+            }
+          munmap (reservation, size + 1);
+        }
+    }
+
+  char chunk[BUFSIZ];
+  size_t count;
+  while ((count = std::fread (chunk, 1, sizeof (chunk), stream)) > 0)
+    copy_.insert (copy_.end (), chunk, chunk + count);
+
+  const size_t size = copy_.size ();
+  copy_.push_back ('\0');
+  buffer_ = &copy_[0];
+  cursor_ = buffer_;
+  end_ = buffer_ + size;
+}
+
+// Terminate the source at end, remembering the character replaced, and
+// restore it.  The last token, or a bad character being reported, stays
+// terminated until the scanner next moves on.
+void
+Scanner::hold (char * end)
+{
+  held_ = end;
+  held_character_ = *end;
+  *end = '\0';
+}
+
+void
+Scanner::release ()
+{
+  if (held_)
+    {
+      *held_ = held_character_;
+      held_ = 0;
+    }
+}
+
+// Return a token running from the cursor up to end.
+int
+Scanner::token (char * end, int type, const char ** text)
+{
+  *text = cursor_;
+  cursor_ = end;
+  hold (end);
+  return type;
+}
+
+// Report and skip a character that cannot start a token, or that should not
+// follow a CODE word's name, and report an unexpected end of the source,
+// which ends the token stream.
+void
+Scanner::unknown_character ()
+{
+  hold (cursor_ + 1);
+  parser_->parse_error ()
+      << "unknown character '" << character_code (*cursor_) << "'"
+      << std::endl;
+  release ();
+
+  state_ = INITIAL;
+  ++cursor_;
+}
+
+void
+Scanner::unexpected_character ()
+{
+  hold (cursor_ + 1);
+  parser_->parse_error () << "expected newline here" << std::endl;
+  release ();
+
+  state_ = INITIAL;
+  ++cursor_;
+}
+
+int
+Scanner::unexpected_end (const char * what, const char ** text)
+{
+  *text = end_;
+  parser_->parse_error () << "unexpected EOF in " << what << std::endl;
+
+  state_ = INITIAL;
+  return 0;
+}
+
+// Return the next token, 0 at the end of the source.
+int
+Scanner::scan (const char ** text)
+{
+  release ();
+
+  int type = CONTINUE;
+  while (type == CONTINUE)
+    {
+      switch (state_)
+        {
+        case INITIAL:
+          type = scan_initial (text);
+          break;
+        case COMMENT:
+          type = scan_comment (text);
+          break;
+        case CODE_NAME:
+          type = scan_code_name (text);
+          break;
+        case CODE_HEADER:
+          type = scan_code_header (text);
+          break;
+        case CODE_BODY:
+          type = scan_code_body (text);
+          break;
+        }
+    }
+  return type;
+}
+
+// Skip spaces and newlines to the next word, and scan it.
+int
+Scanner::scan_initial (const char ** text)
+{
+  for (;;)
+    {
+      const char c = *cursor_;
+
+      if (is_word_character (c))
+        {
+          char * end = cursor_ + 1;
+          while (is_word_character (*end))
+            ++end;
+          return scan_word (end, text);
+        }
+
+      if (c == '\n')
+        parser_->next_line ();
+      else if (!is_space (c))
+        {
+          if (cursor_ == end_)
+            return 0;
+          unknown_character ();
+          continue;
+        }
+      ++cursor_;
+    }
+}
+
+// Classify the word from the cursor up to end.  Words that open comments,
+// strings, character literals, and addresses take in the source after
+// them; other words are numbers, keywords, or plain words.
+int
+Scanner::scan_word (char * end, const char ** text)
+{
+  char * const start = cursor_;
+  const size_t length = end - start;
+
+  if (is_opening_character (*start))
+    {
+      const int type = scan_opening_word (end, text);
+      if (type != 0)
+        return type;
+    }
+
+  if (is_integer (start, end))
+    return token (end, INTEGER_LITERAL, text);
+  if (is_float (start, end))
+    return token (end, FLOAT_LITERAL, text);
+  if (*start == '\'' && (length == 2 || (length == 3 && start[2] == '\'')))
+    return token (end, CHAR_LITERAL, text);
+
+  const int keyword = find_keyword (start, end);
+  if (keyword == CODE)
+    state_ = CODE_NAME;
+  return token (end, keyword ? keyword : WORD, text);
+}
+
+// Scan a word that may open a comment, string, character literal, or
+// address, returning 0 if it opens none of them.
+int
+Scanner::scan_opening_word (char * end, const char ** text)
+{
+  char * const start = cursor_;
+  const size_t length = end - start;
+  const char next = *end;
+
+  if (length == 1 && *start == '\\' && (next == '\n' || is_space (next)))
+    {
+      char * newline
+          = static_cast<char *>(std::memchr (end, '\n', end_ - end));
+      if (!newline)
+        return 0;
+
+      parser_->next_line ();
+      cursor_ = newline + 1;
+      return CONTINUE;
+    }
+
+  if (!is_space (next))
+    return 0;
+
+  if (length == 1 && *start == '(')
+    {
+      state_ = COMMENT;
+      cursor_ = end + 1;
+      return CONTINUE;
+    }
+
+  int type = 0;
+  if (is_same_word (start, end, "'") || is_same_word (start, end, "[']"))
+    type = OBJECT_ADDRESS;
+  else if (is_same_word (start, end, "CHAR")
+           || is_same_word (start, end, "[CHAR]"))
+    type = CHAR_LITERAL;
+
+  if (type)
+    {
+      char * name = end;
+      while (is_space (*name))
+        ++name;
+      if (!is_word_character (*name))
+        return 0;
+
+      while (is_word_character (*name))
+        ++name;
+      return token (name, type, text);
+    }
+
+  for (const StringOpener * opener = STRING_OPENERS; opener->text; ++opener)
+    {
+      if (!is_same_word (start, end, opener->text)
+          || (opener->needs_space && next != ' '))
+        continue;
+
+      char * string = end + 1;
+      while (string < end_ && *string != opener->closing && *string != '\n')
+        ++string;
+      if (string < end_ && *string == opener->closing)
+        return token (string + 1, opener->token, text);
+      break;
+    }
+  return 0;
+}
+
+// Skip a comment, through its closing parenthesis.
+int
+Scanner::scan_comment (const char ** text)
+{
+  for (;;)
+    {
+      const char c = *cursor_;
+
+      if (c == ')')
+        {
+          state_ = INITIAL;
+          ++cursor_;
+          return CONTINUE;
+        }
+
+      if (c == '\n')
+        parser_->next_line ();
+      else if (cursor_ == end_)
+        return unexpected_end ("comment", text);
+      ++cursor_;
+    }
+}
+
+// Scan a CODE word's name, then skip to the end of its line, allowing only
+// spaces and comments after the name.
+int
+Scanner::scan_code_name (const char ** text)
+{
+  for (;;)
+    {
+      const char c = *cursor_;
+
+      if (is_word_character (c))
+        {
+          char * end = cursor_ + 1;
+          while (is_word_character (*end))
+            ++end;
+          state_ = CODE_HEADER;
+          return token (end, WORD, text);
+        }
+
+      if (c == '\n')
+        parser_->next_line ();
+      else if (!is_space (c))
+        {
+          if (cursor_ == end_)
+            return unexpected_end ("CODE...ENDCODE", text);
+          unknown_character ();
+          return CONTINUE;
+        }
+      ++cursor_;
+    }
+}
+
+int
+Scanner::scan_code_header (const char ** text)
+{
+  for (;;)
+    {
+      char * const start = cursor_;
+      const char c = *start;
+
+      if (is_space (c))
+        {
+          ++cursor_;
+          continue;
+        }
+
+      if (c == '\n')
+        {
+          parser_->next_line ();
+          state_ = CODE_BODY;
+          ++cursor_;
+          return CONTINUE;
+        }
+
+      if (c == '\\' && (start[1] == '\n' || is_space (start[1])))
+        {
+          char * newline = static_cast<char *>(std::memchr (start + 1, '\n',
+                                                            end_ - start - 1));
+          if (newline)
+            {
+              parser_->next_line ();
+              state_ = CODE_BODY;
+              cursor_ = newline + 1;
+              return CONTINUE;
+            }
+        }
+
+      if (c == '(' && is_space (start[1]))
+        {
+          char * closing = static_cast<char *>(std::memchr (start + 2, ')',
+                                                            end_ - start - 2));
+          if (closing)
+            {
+              for (char * i = start + 2; i < closing; ++i)
+                {
+                  if (*i == '\n')
+                    parser_->next_line ();
+                }
+              cursor_ = closing + 1;
+              continue;
+            }
+        }
+
+      if (cursor_ == end_)
+        return unexpected_end ("CODE...ENDCODE", text);
+      unexpected_character ();
+      return CONTINUE;
+    }
+}
+
+// Scan a CODE word's assembler, a line at a time, up to END-CODE alone on
+// a line.
+int
+Scanner::scan_code_body (const char ** text)
+{
+  for (;;)
+    {
+      const char c = *cursor_;
+
+      if (c == '\n')
+        parser_->next_line ();
+      else if (c != '\r')
+        {
+          if (cursor_ == end_)
+            return unexpected_end ("CODE...ENDCODE", text);
+
+          char * end = cursor_ + 1;
+          while (end < end_ && *end != '\n' && *end != '\r')
+            ++end;
+
+          if (is_same_word (cursor_, end, "END-CODE"))
+            {
+              state_ = INITIAL;
+              return token (end, END_CODE, text);
+            }
+          return token (end, ASM, text);
+        }
+      ++cursor_;
+    }
+}
@@ -0,0 +1,79 @@
+// vi: set ts=2 shiftwidth=2 expandtab:
+//
+// VNPForth - Compiled native Forth for x86 Linux
+// Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef VNPFORTH_SCANNER_H
+#define VNPFORTH_SCANNER_H
+
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+class Parser;
+
+// Scanner, splits Forth source into tokens for the yacc parser.  The whole
+// source sits in one buffer, mapped from the file where possible, with a
+// NUL sentinel after its end.  Token text stays in place, terminated by
+// overwriting the character after it until the next scan restores it, so
+// that terminals may read on past their own token as they always have.
+// All scanning state is in the object, so scanners are independent.
+class Scanner
+{
+public:
+  Scanner (std::FILE * stream, Parser * parser);
+  ~Scanner ();
+
+  int scan (const char ** text);
+
+private:
+  Scanner (const Scanner & scanner);
+  Scanner & operator= (const Scanner & scanner);
+
+  // Scanning states; a CODE word's name, the rest of its first line, and
+  // its assembler lines, and inside a comment.
+  enum State { INITIAL, CODE_NAME, CODE_HEADER, CODE_BODY, COMMENT };
+
+  void load (std::FILE * stream);
+  void hold (char * end);
+  void release ();
+  int token (char * end, int type, const char ** text);
+  void unknown_character ();
+  void unexpected_character ();
+  int unexpected_end (const char * what, const char ** text);
+
+  int scan_initial (const char ** text);
+  int scan_word (char * end, const char ** text);
+  int scan_opening_word (char * end, const char ** text);
+  int scan_comment (const char ** text);
+  int scan_code_name (const char ** text);
+  int scan_code_header (const char ** text);
+  int scan_code_body (const char ** text);
+
+  Parser * const parser_;
+  char * buffer_;
+  size_t mapped_size_;
+  std::vector<char> copy_;
+  char * cursor_;
+  char * end_;
+  char * held_;
+  char held_character_;
+  State state_;
+};
+
+#endif
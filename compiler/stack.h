@@ -24,31 +24,32 @@
 #include <string>
 
 // Stack class, defines three stacks, and their push and pop functions.
+// As with registers, a stack holds only its index into a table of names.
 class Stack
 {
 public:
-  inline const
-  std::string get_name () const
+  inline const std::string &
+  get_name () const
   {
-    return name_;
+    return NAMES[id_].name;
   }
 
-  inline const std::string
+  inline const std::string &
   get_push_function () const
   {
-    return push_function_;
+    return NAMES[id_].push_function;
   }
 
-  inline const std::string
+  inline const std::string &
   get_pop_function () const
   {
-    return pop_function_;
+    return NAMES[id_].pop_function;
   }
 
   inline bool
   equals (const Stack & stack) const
   {
-    return name_ == stack.name_;
+    return id_ == stack.id_;
   }
 
   static const Stack DATA;
@@ -56,15 +57,20 @@ public:
   static const Stack FLOAT;
 
 private:
-  inline
-  Stack (const std::string & name,
-         const std::string & push_function, const std::string & pop_function)
-    : name_ (name),
-      push_function_ (push_function), pop_function_ (pop_function) { }
+  struct Names
+  {
+    const std::string name;
+    const std::string push_function;
+    const std::string pop_function;
+  };
+
+  static const Names NAMES[];
+
+  explicit inline
+  Stack (int id)
+    : id_ (id) { }
 
-  const std::string name_;
-  const std::string push_function_;
-  const std::string pop_function_;
+  const int id_;
 };
 
 #endif
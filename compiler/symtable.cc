@@ -20,22 +20,19 @@
 
 #include <algorithm>
 #include <cassert>
-#include <functional>
 #include <string>
 
 #include "mangler.h"
 #include "symbol.h"
 #include "symtable.h"
 
-typedef std::pair<const std::string, const Symbol *> SymTablePair;
-
 // Delete all symbol objects in the table, and destructor.
 namespace {
 
 void
-dispose (SymTablePair pair)
+dispose (const Symbol * symbol)
 {
-  delete pair.second;
+  delete symbol;
 }
 
 } // namespace
@@ -45,6 +42,8 @@ SymbolTable::clear ()
 {
   std::for_each (symbols_.begin (), symbols_.end (), dispose);
   symbols_.clear ();
+  names_.clear ();
+  name_slots_.clear ();
 }
 
 SymbolTable::~SymbolTable ()
@@ -52,45 +51,124 @@ SymbolTable::~SymbolTable ()
   clear ();
 }
 
+// Name hashing and interning.  The first lookup of a name interns it, and
+// mangles it once, so that later lookups of the same name cost one hash
+// and a single string comparison, with no further mangling.
+namespace {
+
+const size_t INITIAL_NAME_SLOTS = 1024;
+
+// FNV-1a hash of a string.
+size_t
+hash_name (const std::string & text)
+{
+  size_t hash = 2166136261u;
+  for (size_t i = 0; i < text.size (); ++i)
+    hash = (hash ^ static_cast<unsigned char> (text[i])) * 16777619u;
+  return hash;
+}
+
+} // namespace
+
+SymbolTable::Name *
+SymbolTable::intern (const std::string & text) const
+{
+  if (2 * (names_.size () + 1) > name_slots_.size ())
+    grow_names ();
+
+  const size_t hash = hash_name (text);
+  const size_t mask = name_slots_.size () - 1;
+  size_t slot = hash & mask;
+  for (; name_slots_[slot]; slot = (slot + 1) & mask)
+    {
+      Name * name = name_slots_[slot];
+      if (name->hash == hash && name->text == text)
+        return name;
+    }
+
+  const Name name = { text, hash, 0, 0 };
+  names_.push_back (name);
+  name_slots_[slot] = &names_.back ();
+  return name_slots_[slot];
+}
+
+// Double the names table, or create it if empty, and rehash every name.
+// Names stay where they are, so pointers to them remain valid.
+void
+SymbolTable::grow_names () const
+{
+  const size_t size = name_slots_.empty ()
+                      ? INITIAL_NAME_SLOTS : 2 * name_slots_.size ();
+  const size_t mask = size - 1;
+
+  name_slots_.assign (size, 0);
+  for (std::deque<Name>::iterator iter = names_.begin ();
+       iter != names_.end (); ++iter)
+    {
+      size_t slot = iter->hash & mask;
+      while (name_slots_[slot])
+        slot = (slot + 1) & mask;
+      name_slots_[slot] = &*iter;
+    }
+}
+
+const SymbolTable::Name *
+SymbolTable::intern_mangled (Name * name) const
+{
+  if (!name->mangled)
+    name->mangled = intern (Mangler::mangle (name->text));
+
+  return name->mangled;
+}
+
 // Add and lookup symbols; name lookup mangles before searching, as symbol
 // names are always mangled on symbol construction.
 void
 SymbolTable::add (const Symbol * symbol)
 {
-  assert (symbols_.find (symbol->get_name ()) == symbols_.end ());
+  Name * name = intern (symbol->get_name ());
+  assert (!name->symbol);
 
-  symbols_[symbol->get_name ()] = symbol;
+  name->symbol = symbol;
+  symbols_.push_back (symbol);
 }
 
 const Symbol *
 SymbolTable::lookup (const std::string & name) const
 {
-  const SymbolTableIterator iter = symbols_.find (Mangler::mangle (name));
-  if (iter == symbols_.end ())
-    return 0;
-
-  return iter->second;
+  return intern_mangled (intern (name))->symbol;
 }
 
-// Pretty-print to create the symbol table listing.
+// Return symbols ordered by name, for stable listings and output.
 namespace {
 
-void
-print_out (SymTablePair pair, std::ostream & outs)
+bool
+is_name_less (const Symbol * lhs, const Symbol * rhs)
 {
-  outs << pair.second->create_list_entry ();
+  return lhs->get_name () < rhs->get_name ();
 }
 
 } // namespace
 
+SymbolTable::SymbolTableStore
+SymbolTable::sorted_symbols () const
+{
+  SymbolTableStore symbols = symbols_;
+  std::sort (symbols.begin (), symbols.end (), is_name_less);
+  return symbols;
+}
+
+// Pretty-print to create the symbol table listing.
 void
 SymbolTable::create_listing (std::ostream & outs) const
 {
   if (symbols_.empty ())
     return;
 
+  const SymbolTableStore symbols = sorted_symbols ();
   outs << "Symbols:" << std::endl;
-  std::for_each (symbols_.begin (), symbols_.end (),
-                 std::bind2nd (std::ptr_fun (print_out), outs));
+  for (SymbolTableIterator iter = symbols.begin ();
+       iter != symbols.end (); ++iter)
+    outs << (*iter)->create_list_entry ();
   outs << std::endl;
 }
@@ -21,15 +21,18 @@
 #ifndef VNPFORTH_SYMBOLTABLE_H
 #define VNPFORTH_SYMBOLTABLE_H
 
+#include <cstddef>
+#include <deque>
 #include <iostream>
-#include <map>
 #include <string>
+#include <vector>
 
 class Options;
 class Symbol;
 
-// Symbol table, aggregates symbol pointers into a map.  The map takes
-// ownership of symbols, and deletes them in its destructor.
+// Symbol table, aggregates symbol pointers and finds them by name through
+// a table of interned names.  The table takes ownership of symbols, and
+// deletes them in its destructor.
 class SymbolTable
 {
 public:
@@ -53,10 +56,32 @@ private:
   SymbolTable (const SymbolTable & table);
   SymbolTable & operator= (const SymbolTable & table);
 
-  typedef std::map<const std::string, const Symbol *> SymbolTableStore;
+  typedef std::vector<const Symbol *> SymbolTableStore;
   typedef SymbolTableStore::const_iterator SymbolTableIterator;
 
+  // An interned name, held once however often it is looked up.  A name
+  // may be both a source name, linking to its mangled name's entry, and
+  // a mangled name, linking to the symbol that has it.  Entries never
+  // move, so once found they compare by address.
+  struct Name
+  {
+    std::string text;
+    size_t hash;
+    const Name * mangled;
+    const Symbol * symbol;
+  };
+
+  Name * intern (const std::string & text) const;
+  const Name * intern_mangled (Name * name) const;
+  void grow_names () const;
+  SymbolTableStore sorted_symbols () const;
+
+  // Insertion order symbols, and an open addressing hash table, always a
+  // power of two in size and at most half full, of interned names.
+  // Lookups intern the names they search for, so names are mutable.
   SymbolTableStore symbols_;
+  mutable std::deque<Name> names_;
+  mutable std::vector<Name *> name_slots_;
 };
 
 #endif
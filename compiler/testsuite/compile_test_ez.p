@@ -0,0 +1,5 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: compile_test_ez
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug PIC optimize intermediate assembly
+
@@ -0,0 +1,16 @@
+	.file	"compile_test_fa"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/compiler/testsuite/",100,0,0,Ltext0
+.stabs	"compile_test_fa",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
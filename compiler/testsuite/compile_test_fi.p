@@ -0,0 +1,14 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: compile_test_fi
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug PIC optimize intermediate assembly
+
+Symbols:
+     1 Sym_0 word "v4_w"
+
+Intermediate code:
+     1 function Sym_0 {
+     1   no-op
+           optimizes label Label_1
+     1 }
+
@@ -0,0 +1,24 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: compile_test_fk
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug PIC optimize intermediate assembly
+
+Symbols:
+     1 Sym_0 word "main"
+     1 Sym_1 constant "v4_c"
+
+Intermediate code:
+     1 function Sym_0 {
+     1   Reg_0 = 0
+     1   no-op
+           optimizes   Stack_D = Reg_0
+     1   no-op
+           optimizes   Reg_0 = Stack_D
+     1   *(Sym_1) = Reg_0
+     1   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_1)
+     1   Stack_D = Reg_0
+     1   no-op
+           optimizes label Label_0
+     1 }
+
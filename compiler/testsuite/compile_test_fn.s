@@ -0,0 +1,61 @@
+	.file	"compile_test_fn"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/compiler/testsuite/",100,0,0,Ltext0
+.stabs	"compile_test_fn",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,1,.LMa0-main
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+	mov 8(%ebp),%eax
+	mov v4__argc@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov 12(%ebp),%eax
+	mov v4__argv@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov 16(%ebp),%eax
+	mov v4__envp@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.stabn 68,0,1,.LMb0-main
+.LMb0:
+.LBB0:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L1
+.L1:
+.L2:
+.LBE0:
+.stabn 68,0,1,.LM7-main
+.LM7:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 main,.Lfe0-main
+.stabn	192,0,0,.LBB0-main
+.stabn	224,0,0,.LBE0-main
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,67 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: compile_test_fv
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug PIC optimize intermediate assembly
+
+Symbols:
+     1 Sym_0 word "main"
+
+Intermediate code:
+     1 function Sym_0 {
+     1   Reg_1 = Stack_D
+     1   Reg_0 = Stack_D
+     1   if Reg_0 == Reg_1 goto Label_1
+     1   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+     1   Reg_0 = Reg_1
+           optimizes   Stack_R = Reg_1
+     1   no-op
+           optimizes label Label_2
+     1   no-op
+           optimizes   goto Label_3
+     1   no-op
+           optimizes   Reg_0 = Stack_D
+     1   no-op
+           optimizes   Reg_1 = Stack_R
+     1   no-op
+           optimizes   Reg_1 += Reg_0
+     1   no-op
+           optimizes   if Reg_0 < 0 goto Label_4
+     1   no-op
+           optimizes   Reg_0 = Stack_R
+     1   no-op
+           optimizes   Stack_R = Reg_0
+     1   no-op
+           optimizes   Stack_R = Reg_1
+     1   no-op
+           optimizes   Reg_1 -= Reg_0
+     1   no-op
+           optimizes   if Reg_1 < 0 goto Label_2
+     1   no-op
+           optimizes   goto Label_3
+     1   no-op
+           optimizes label Label_4
+     1   no-op
+           optimizes   Reg_0 = Stack_R
+     1   no-op
+           optimizes   Stack_R = Reg_0
+     1   no-op
+           optimizes   Stack_R = Reg_1
+     1   no-op
+           optimizes   Reg_1 -= Reg_0
+     1   no-op
+           optimizes   if Reg_1 >= 0 goto Label_2
+     1   no-op
+           optimizes label Label_3
+     1   no-op
+           optimizes   Reg_0 = Stack_R
+     1   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+     1 label Label_1
+     1   no-op
+           optimizes label Label_0
+     1 }
+
+Peephole rewrites:
+  main: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+
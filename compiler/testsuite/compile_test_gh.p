@@ -0,0 +1,27 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: compile_test_gh
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug PIC optimize intermediate assembly
+
+Data:
+     1 Data_0 string[1] "\012"
+
+Symbols:
+     1 Sym_1 word "main"
+     1 Sym_0 external "v4__abortquote"
+
+Intermediate code:
+     1 function Sym_1 {
+     1   Reg_0 = Stack_D
+     1   if Reg_0 == 0 goto Label_1
+     1   Reg_0 = Data_0
+     1   Stack_D = Reg_0
+     1   Reg_0 = 1
+     1   Stack_D = Reg_0
+     1   tail call Sym_0
+           optimizes   call Sym_0
+     1 label Label_1
+     1   no-op
+           optimizes label Label_0
+     1 }
+
@@ -0,0 +1,21 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: compile_test_gj
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug PIC optimize intermediate assembly
+
+Data:
+     1 Data_0 string[0] ""
+
+Symbols:
+     1 Sym_0 word "main"
+
+Intermediate code:
+     1 function Sym_0 {
+     1   Reg_0 = Data_0
+     1   Stack_D = Reg_0
+     1   Reg_0 = 0
+     1   Stack_D = Reg_0
+     1   no-op
+           optimizes label Label_0
+     1 }
+
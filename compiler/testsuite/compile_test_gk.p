@@ -0,0 +1,17 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: compile_test_gk
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug PIC optimize intermediate assembly
+
+Symbols:
+     1 Sym_0 word "main"
+     1 Sym_1 external "v4_char"
+
+Intermediate code:
+     1 function Sym_0 {
+     1   tail call Sym_1
+           optimizes   call Sym_1
+     1   no-op
+           optimizes label Label_0
+     1 }
+
@@ -0,0 +1,16 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: compile_test_go
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug PIC optimize intermediate assembly
+
+Symbols:
+     1 Sym_0 word "main"
+
+Intermediate code:
+     1 function Sym_0 {
+     1   Reg_0 = 104
+     1   Stack_D = Reg_0
+     1   no-op
+           optimizes label Label_0
+     1 }
+
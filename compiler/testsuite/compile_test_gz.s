@@ -0,0 +1,85 @@
+	.file	"compile_test_gz"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/compiler/testsuite/",100,0,0,Ltext0
+.stabs	"compile_test_gz",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_0:F1",36,0,0,v4_0
+	.type	v4_0,@function
+v4_0:
+.stabn 68,0,1,.LMa0-v4_0
+.LMa0:
+	push %ebx
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,1,.LMb0-v4_0
+.LMb0:
+.LBB0:
+.LBE0:
+.stabn 68,0,1,.LM2-v4_0
+.LM2:
+	pop %ebx
+	ret
+.Lfe0:
+	.size	 v4_0,.Lfe0-v4_0
+.stabn	192,0,0,.LBB0-v4_0
+.stabn	224,0,0,.LBE0-v4_0
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_0
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,1,.LMa3-main
+.LMa3:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic1
+.Lpic1:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic1],%ebx
+0:
+	mov 8(%ebp),%eax
+	mov v4__argc@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov 12(%ebp),%eax
+	mov v4__argv@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov 16(%ebp),%eax
+	mov v4__envp@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.stabn 68,0,1,.LMb3-main
+.LMb3:
+.LBB1:
+	mov v4_0@GOT(%ebx),%eax
+	call v4__dpush@PLT
+.LBE1:
+.stabn 68,0,1,.LM7-main
+.LM7:
+	pop %ebx
+	leave
+	ret
+.Lfe1:
+	.size	 main,.Lfe1-main
+.stabn	192,0,0,.LBB1-main
+.stabn	224,0,0,.LBE1-main
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,17 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: compile_test_hb
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug PIC optimize intermediate assembly
+
+Symbols:
+     1 Sym_0 word "main"
+     1 Sym_1 external "v4_Store_Quote_Hash_Dollar_Percent_Amp_Tick_Paren_Closeparen_Star_Plus_Comma_Minus_Dot_Slash_Colon_Semicolon_Less_Equals_Greater_Question_Fetch_Leftbracket_Backslash_Rightbracket_Caret__Backtick_Leftbrace_Or_Rightbrace_Tilde"
+
+Intermediate code:
+     1 function Sym_0 {
+     1   tail call Sym_1
+           optimizes   call Sym_1
+     1   no-op
+           optimizes label Label_0
+     1 }
+
@@ -0,0 +1,8 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: compile_test_hn
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug PIC optimize intermediate assembly
+
+Symbols:
+     1 Sym_0 variable Char[2147483647] "v4_x"
+
@@ -0,0 +1,268 @@
+VNPForth 1.5 [build x86_64/20261017065336]
+Source: cat.ft
+Compiled: Sat Oct 17 06:53:57 2026
+Flags: debug optimize intermediate assembly
+
+Data:
+    27 Data_3 string[22] " [ file [ file ... ] ]"
+    34 Data_5 string[6] "--help"
+    33 Data_4 string[2] "-h"
+    51 Data_7 string[2] ": "
+    27 Data_2 string[7] "Usage: "
+    59 Data_8 string[3] "dup"
+    51 Data_6 string[4] "open"
+    15 Data_0 string[4] "read"
+    21 Data_1 string[5] "write"
+
+Symbols:
+    32 Sym_17 word "main"
+    13 Sym_5 external "v4_Equals"
+    68 Sym_29 external "v4_Fetch"
+    58 Sym_28 external "v4_Less_Greater"
+    38 Sym_23 external "v4_Store"
+    56 Sym_26 external "v4__close"
+    57 Sym_27 external "v4__dup"
+    16 Sym_9 external "v4__exit"
+    49 Sym_25 external "v4__open"
+    12 Sym_3 external "v4__read"
+    27 Sym_14 external "v4__type"
+    19 Sym_12 external "v4__write"
+    27 Sym_15 external "v4_arg"
+    32 Sym_18 external "v4_argc"
+    33 Sym_19 external "v4_compare"
+    15 Sym_8 external "v4_cr"
+    14 Sym_6 external "v4_drop"
+    13 Sym_4 external "v4_dup"
+    48 Sym_24 external "v4_i"
+    34 Sym_21 external "v4_or"
+    15 Sym_7 external "v4_pperror"
+     8 Sym_0 variable Char[1024] "v4_read_Minusbuf"
+    38 Sym_22 variable Cell "v4_status"
+    12 Sym_2 external "v4_stdin"
+    19 Sym_11 external "v4_stdout"
+    27 Sym_16 external "v4_type"
+    26 Sym_13 word "v4_usage"
+    10 Sym_1 word "v4_xfer_Minusbytes"
+    33 Sym_20 external "v4_z0_Equals"
+    18 Sym_10 external "v4_z0_Greater"
+
+Intermediate code:
+    10 function Sym_1 {
+    11 label Label_2
+    12   Reg_0 = 1024
+    12   Stack_D = Reg_0
+    12   Reg_0 = Sym_0
+    12   Stack_D = Reg_0
+    12   call Sym_2
+    12   call Sym_3
+    13   call Sym_4
+    13   Reg_0 = -1
+    13   Stack_D = Reg_0
+    13   call Sym_5
+    13   Reg_0 = Stack_D
+    13   if Reg_0 == 0 goto Label_4
+    14   call Sym_6
+    15   Reg_0 = Data_0
+    15   Stack_D = Reg_0
+    15   Reg_0 = 4
+    15   Stack_D = Reg_0
+    15   call Sym_7
+    15   call Sym_8
+    16   Reg_0 = 1
+    16   Stack_D = Reg_0
+    16   call Sym_9
+    17 label Label_4
+    18   call Sym_4
+    18   call Sym_10
+    18   Reg_0 = Stack_D
+    18   if Reg_0 == 0 goto Label_3
+    19   Reg_0 = Sym_0
+    19   Stack_D = Reg_0
+    19   call Sym_11
+    19   call Sym_12
+    20   Reg_0 = -1
+    20   Stack_D = Reg_0
+    20   call Sym_5
+    20   Reg_0 = Stack_D
+    20   if Reg_0 == 0 goto Label_5
+    21   Reg_0 = Data_1
+    21   Stack_D = Reg_0
+    21   Reg_0 = 5
+    21   Stack_D = Reg_0
+    21   call Sym_7
+    21   call Sym_8
+    22   Reg_0 = 1
+    22   Stack_D = Reg_0
+    22   call Sym_9
+    23 label Label_5
+    24   goto Label_2
+    24 label Label_3
+    24   call Sym_6
+    24   no-op
+           optimizes label Label_1
+    24 }
+
+    26 function Sym_13 {
+    27   Reg_0 = Data_2
+    27   Stack_D = Reg_0
+    27   Reg_0 = 7
+    27   Stack_D = Reg_0
+    27   call Sym_14
+    27   Reg_0 = 0
+    27   Stack_D = Reg_0
+    27   call Sym_15
+    27   call Sym_16
+    27   Reg_0 = Data_3
+    27   Stack_D = Reg_0
+    27   Reg_0 = 22
+    27   Stack_D = Reg_0
+    27   call Sym_14
+    27   call Sym_8
+    27   no-op
+           optimizes label Label_6
+    27 }
+
+    32 function Sym_17 {
+    32   call Sym_18
+    32   Reg_0 = 2
+    32   Stack_D = Reg_0
+    32   call Sym_5
+    32   Reg_0 = Stack_D
+    32   if Reg_0 == 0 goto Label_7
+    33   Reg_0 = 1
+    33   Stack_D = Reg_0
+    33   call Sym_15
+    33   Reg_0 = Data_4
+    33   Stack_D = Reg_0
+    33   Reg_0 = 2
+    33   Stack_D = Reg_0
+    33   call Sym_19
+    33   call Sym_20
+    34   Reg_0 = 1
+    34   Stack_D = Reg_0
+    34   call Sym_15
+    34   Reg_0 = Data_5
+    34   Stack_D = Reg_0
+    34   Reg_0 = 6
+    34   Stack_D = Reg_0
+    34   call Sym_19
+    34   call Sym_20
+    34   call Sym_21
+    34   Reg_0 = Stack_D
+    34   if Reg_0 == 0 goto Label_8
+    35   call Sym_13
+    35   Reg_0 = 0
+    35   Stack_D = Reg_0
+    35   call Sym_9
+    36 label Label_8
+    36 label Label_7
+    38   Reg_0 = 0
+    38   Stack_D = Reg_0
+    38   Reg_0 = Sym_22
+    38   Stack_D = Reg_0
+    38   call Sym_23
+    41   call Sym_18
+    41   Reg_0 = 1
+    41   Stack_D = Reg_0
+    41   call Sym_5
+    41   Reg_0 = Stack_D
+    41   if Reg_0 == 0 goto Label_9
+    42   call Sym_1
+    43   Reg_0 = 0
+    43   Stack_D = Reg_0
+    43   call Sym_9
+    44 label Label_9
+    47   call Sym_18
+    47   Reg_0 = 1
+    47   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    47   no-op
+           optimizes   Reg_1 = Stack_D
+    47   Reg_0 = Stack_D
+    47   Stack_R = Reg_0
+    47   Stack_R = Reg_1
+    47 label Label_11
+    48   Reg_0 = 0
+    48   Stack_D = Reg_0
+    48   Reg_0 = 0
+    48   Stack_D = Reg_0
+    48   call Sym_24
+    48   call Sym_15
+    48   call Sym_6
+    49   call Sym_25
+    50   call Sym_4
+    50   Reg_0 = -1
+    50   Stack_D = Reg_0
+    50   call Sym_5
+    50   Reg_0 = Stack_D
+    50   if Reg_0 == 0 goto Label_13
+    51   Reg_0 = Data_6
+    51   Stack_D = Reg_0
+    51   Reg_0 = 4
+    51   Stack_D = Reg_0
+    51   call Sym_7
+    51   Reg_0 = Data_7
+    51   Stack_D = Reg_0
+    51   Reg_0 = 2
+    51   Stack_D = Reg_0
+    51   call Sym_14
+    52   call Sym_24
+    52   call Sym_15
+    52   call Sym_16
+    52   call Sym_8
+    53   Reg_0 = 1
+    53   Stack_D = Reg_0
+    53   Reg_0 = Sym_22
+    53   Stack_D = Reg_0
+    53   call Sym_23
+    54   call Sym_6
+    55   goto Label_14
+    55 label Label_13
+    56   call Sym_2
+    56   call Sym_26
+    56   call Sym_6
+    57   call Sym_4
+    57   call Sym_27
+    58   call Sym_2
+    58   call Sym_28
+    58   Reg_0 = Stack_D
+    58   if Reg_0 == 0 goto Label_15
+    59   Reg_0 = Data_8
+    59   Stack_D = Reg_0
+    59   Reg_0 = 3
+    59   Stack_D = Reg_0
+    59   call Sym_7
+    59   call Sym_8
+    60   Reg_0 = 1
+    60   Stack_D = Reg_0
+    60   Reg_0 = Sym_22
+    60   Stack_D = Reg_0
+    60   call Sym_23
+    61   goto Label_16
+    61 label Label_15
+    62   call Sym_1
+    63 label Label_16
+    64   call Sym_26
+    64   call Sym_6
+    65 label Label_14
+    66   Reg_1 = Stack_R
+    66   Reg_1 += 1
+    66   Reg_0 = Stack_R
+    66   Stack_R = Reg_0
+    66   Stack_R = Reg_1
+    66   Reg_1 -= Reg_0
+    66   if Reg_1 != 0 goto Label_11
+    66   no-op
+           optimizes label Label_12
+    66   Reg_0 = Stack_R
+    66   Reg_0 = Stack_R
+    66   no-op
+           optimizes label Label_10
+    68   Reg_0 = Sym_22
+    68   Stack_D = Reg_0
+    68   call Sym_29
+    68   call Sym_6
+    68   no-op
+           optimizes label Label_0
+    68 }
+
@@ -0,0 +1,422 @@
+	.file	"cat.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/demos/",100,0,0,Ltext0
+.stabs	"cat.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC3:
+	.string " [ file [ file ... ] ]"
+.LC5:
+	.string "--help"
+.LC4:
+	.string "-h"
+.LC7:
+	.string ": "
+.LC2:
+	.string "Usage: "
+.LC8:
+	.string "dup"
+.LC6:
+	.string "open"
+.LC0:
+	.string "read"
+.LC1:
+	.string "write"
+.stabs	"v4_read_Minusbuf:Gar2;0;1023;4",40,0,0,v4_read_Minusbuf
+	.comm  v4_read_Minusbuf,1024,32
+.stabs	"v4_status:G2",40,0,0,v4_status
+	.comm  v4_status,4,4
+.text
+	.align 4
+.stabs "v4_xfer_Minusbytes:F1",36,0,0,v4_xfer_Minusbytes
+.globl v4_xfer_Minusbytes
+	.type	v4_xfer_Minusbytes,@function
+v4_xfer_Minusbytes:
+.stabn 68,0,10,.LMa0-v4_xfer_Minusbytes
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,10,.LMb0-v4_xfer_Minusbytes
+.LMb0:
+.LBB1:
+.L2:
+.stabn 68,0,12,.LM2-v4_xfer_Minusbytes
+.LM2:
+	mov $1024,%eax
+	call v4__dpush
+	lea v4_read_Minusbuf,%eax
+	call v4__dpush
+	call v4_stdin
+	call v4__read
+.stabn 68,0,13,.LM8-v4_xfer_Minusbytes
+.LM8:
+	call v4_dup
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Equals
+	call v4__dpop
+	test %eax,%eax
+	je .L4
+.stabn 68,0,14,.LM14-v4_xfer_Minusbytes
+.LM14:
+	call v4_drop
+.stabn 68,0,15,.LM15-v4_xfer_Minusbytes
+.LM15:
+	lea .LC0,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_pperror
+	call v4_cr
+.stabn 68,0,16,.LM21-v4_xfer_Minusbytes
+.LM21:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4__exit
+.L4:
+.stabn 68,0,18,.LM25-v4_xfer_Minusbytes
+.LM25:
+	call v4_dup
+	call v4_z0_Greater
+	call v4__dpop
+	test %eax,%eax
+	je .L3
+.stabn 68,0,19,.LM29-v4_xfer_Minusbytes
+.LM29:
+	lea v4_read_Minusbuf,%eax
+	call v4__dpush
+	call v4_stdout
+	call v4__write
+.stabn 68,0,20,.LM33-v4_xfer_Minusbytes
+.LM33:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Equals
+	call v4__dpop
+	test %eax,%eax
+	je .L5
+.stabn 68,0,21,.LM38-v4_xfer_Minusbytes
+.LM38:
+	lea .LC1,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_pperror
+	call v4_cr
+.stabn 68,0,22,.LM44-v4_xfer_Minusbytes
+.LM44:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4__exit
+.L5:
+.stabn 68,0,24,.LM48-v4_xfer_Minusbytes
+.LM48:
+	jmp .L2
+.L3:
+	call v4_drop
+.LBE1:
+.stabn 68,0,24,.LM52-v4_xfer_Minusbytes
+.LM52:
+	pop %ebx
+	leave
+	ret
+.Lfe1:
+	.size	 v4_xfer_Minusbytes,.Lfe1-v4_xfer_Minusbytes
+.stabn	192,0,0,.LBB1-v4_xfer_Minusbytes
+.stabn	224,0,0,.LBE1-v4_xfer_Minusbytes
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4_xfer_Minusbytes
+.text
+	.align 4
+.stabs "v4_usage:F1",36,0,0,v4_usage
+.globl v4_usage
+	.type	v4_usage,@function
+v4_usage:
+.stabn 68,0,26,.LMa53-v4_usage
+.LMa53:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,26,.LMb53-v4_usage
+.LMb53:
+.LBB13:
+.stabn 68,0,27,.LM54-v4_usage
+.LM54:
+	lea .LC2,%eax
+	call v4__dpush
+	mov $7,%eax
+	call v4__dpush
+	call v4__type
+	xor %eax,%eax
+	call v4__dpush
+	call v4_arg
+	call v4_type
+	lea .LC3,%eax
+	call v4__dpush
+	mov $22,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.LBE13:
+.stabn 68,0,27,.LM70-v4_usage
+.LM70:
+	pop %ebx
+	leave
+	ret
+.Lfe13:
+	.size	 v4_usage,.Lfe13-v4_usage
+.stabn	192,0,0,.LBB13-v4_usage
+.stabn	224,0,0,.LBE13-v4_usage
+.Lscope13:
+.stabs	"",36,0,0,.Lscope13-v4_usage
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,32,.LMa71-main
+.LMa71:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,32,.LMb71-main
+.LMb71:
+.LBB17:
+	call v4_argc
+	mov $2,%eax
+	call v4__dpush
+	call v4_Equals
+	call v4__dpop
+	test %eax,%eax
+	je .L7
+.stabn 68,0,33,.LM78-main
+.LM78:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	lea .LC4,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_compare
+	call v4_z0_Equals
+.stabn 68,0,34,.LM87-main
+.LM87:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	lea .LC5,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_compare
+	call v4_z0_Equals
+	call v4_or
+	call v4__dpop
+	test %eax,%eax
+	je .L8
+.stabn 68,0,35,.LM99-main
+.LM99:
+	call v4_usage
+	xor %eax,%eax
+	call v4__dpush
+	call v4__exit
+.L8:
+.L7:
+.stabn 68,0,38,.LM105-main
+.LM105:
+	xor %eax,%eax
+	call v4__dpush
+	lea v4_status,%eax
+	call v4__dpush
+	call v4_Store
+.stabn 68,0,41,.LM110-main
+.LM110:
+	call v4_argc
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Equals
+	call v4__dpop
+	test %eax,%eax
+	je .L9
+.stabn 68,0,42,.LM116-main
+.LM116:
+	call v4_xfer_Minusbytes
+.stabn 68,0,43,.LM117-main
+.LM117:
+	xor %eax,%eax
+	call v4__dpush
+	call v4__exit
+.L9:
+.stabn 68,0,47,.LM121-main
+.LM121:
+	call v4_argc
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	call v4__dpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L11:
+.stabn 68,0,48,.LM129-main
+.LM129:
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_i
+	call v4_arg
+	call v4_drop
+.stabn 68,0,49,.LM136-main
+.LM136:
+	call v4__open
+.stabn 68,0,50,.LM137-main
+.LM137:
+	call v4_dup
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Equals
+	call v4__dpop
+	test %eax,%eax
+	je .L13
+.stabn 68,0,51,.LM143-main
+.LM143:
+	lea .LC6,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_pperror
+	lea .LC7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,52,.LM153-main
+.LM153:
+	call v4_i
+	call v4_arg
+	call v4_type
+	call v4_cr
+.stabn 68,0,53,.LM157-main
+.LM157:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	lea v4_status,%eax
+	call v4__dpush
+	call v4_Store
+.stabn 68,0,54,.LM162-main
+.LM162:
+	call v4_drop
+.stabn 68,0,55,.LM163-main
+.LM163:
+	jmp .L14
+.L13:
+.stabn 68,0,56,.LM165-main
+.LM165:
+	call v4_stdin
+	call v4__close
+	call v4_drop
+.stabn 68,0,57,.LM168-main
+.LM168:
+	call v4_dup
+	call v4__dup
+.stabn 68,0,58,.LM170-main
+.LM170:
+	call v4_stdin
+	call v4_Less_Greater
+	call v4__dpop
+	test %eax,%eax
+	je .L15
+.stabn 68,0,59,.LM174-main
+.LM174:
+	lea .LC8,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_pperror
+	call v4_cr
+.stabn 68,0,60,.LM180-main
+.LM180:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	lea v4_status,%eax
+	call v4__dpush
+	call v4_Store
+.stabn 68,0,61,.LM185-main
+.LM185:
+	jmp .L16
+.L15:
+.stabn 68,0,62,.LM187-main
+.LM187:
+	call v4_xfer_Minusbytes
+.L16:
+.stabn 68,0,64,.LM189-main
+.LM189:
+	call v4__close
+	call v4_drop
+.L14:
+.stabn 68,0,66,.LM192-main
+.LM192:
+	xchg %edx,%eax
+	call v4__rpop
+	xchg %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	test %edx,%edx
+	jne .L11
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,68,.LM203-main
+.LM203:
+	lea v4_status,%eax
+	call v4__dpush
+	call v4_Fetch
+	call v4_drop
+.LBE17:
+.stabn 68,0,68,.LM208-main
+.LM208:
+	pop %ebx
+	leave
+	ret
+.Lfe17:
+	.size	 main,.Lfe17-main
+.stabn	192,0,0,.LBB17-main
+.stabn	224,0,0,.LBE17-main
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 06:53:37, Linux"
@@ -0,0 +1,1568 @@
+VNPForth 1.5 [build x86_64/20261017065336]
+Source: features.ft
+Compiled: Sat Oct 17 06:53:57 2026
+Flags: debug optimize intermediate assembly
+
+Data:
+   136 Data_70 cstring[7] "abcdefg"
+   120 Data_63 cstring[17] "abcdefghijklmnopq"
+    36 Data_20 cstring[10] "c-abcdefgh"
+    37 Data_22 synonym Data_20
+    93 Data_40 string[5] "' is "
+    75 Data_30 string[2] ", "
+    95 Data_43 string[11] "-123.456e-7"
+    96 Data_45 string[5] "-1e99"
+    97 Data_47 string[5] "1.0ex"
+    97 Data_46 string[3] "1.x"
+    95 Data_42 string[9] "123.456e7"
+    96 Data_44 string[4] "1e99"
+   112 Data_57 string[12] "Abort '...' "
+   111 Data_55 string[12] "Abort, quit "
+    25 Data_10 string[20] "All lowercase call: "
+    26 Data_11 string[20] "All uppercase call: "
+    80 Data_34 string[18] "Allocate  1 byte: "
+    77 Data_31 string[19] "Allocate 23 bytes: "
+    46 Data_24 string[22] "Anonymous function one"
+    47 Data_25 string[22] "Anonymous function two"
+   136 Data_69 string[10] "C-string: "
+    70 Data_28 string[9] "Clock is "
+    29 Data_14 string[21] "Direct unicode call: "
+   115 Data_60 string[14] "Division by 0 "
+   121 Data_64 string[18] "Dump code start is"
+    94 Data_41 string[3] "Err"
+   181 Data_84 string[21] "FAKEVAR ' address is "
+   179 Data_82 string[19] "FAKEVAR address is "
+   106 Data_52 string[14] "Fibonacci  10 "
+   105 Data_51 string[14] "Fibonacci -10 "
+    42 Data_23 string[11] "Fibonacci: "
+    34 Data_15 string[20] "First occurrence is "
+    36 Data_19 synonym Data_15
+    93 Data_39 string[7] "Float '"
+   116 Data_61 string[15] "Float / by 0.0 "
+    84 Data_37 string[14] "Free invalid: "
+    79 Data_33 string[6] "Free: "
+    81 Data_35 synonym Data_33
+   151 Data_74 string[9] "MYVAR is "
+   153 Data_75 string[13] "MYVAR is now "
+    63 Data_26 string[18] "Mutual recursion: "
+    64 Data_27 synonym Data_26
+    24 Data_9 string[13] "Normal call: "
+    90 Data_38 string[6] "Pi is "
+   167 Data_77 string[16] "Program argc is "
+   168 Data_78 string[16] "Program argv is "
+   169 Data_79 string[16] "Program envp is "
+   180 Data_83 string[21] "REALVAR ' address is "
+   178 Data_81 string[19] "REALVAR address is "
+   144 Data_73 string[24] "Real value of vMYVAR is "
+    83 Data_36 string[16] "Resize invalid: "
+    78 Data_32 string[19] "Resize to 9 bytes: "
+   137 Data_71 string[10] "S-string: "
+    35 Data_17 string[26] "Second occurrence is also "
+    37 Data_21 synonym Data_17
+    99 Data_48 string[23] "Square root of -1.0 is "
+   123 Data_66 string[14] "Stack base is "
+   122 Data_65 string[8] "Stack is"
+   187 Data_85 string[9] "Stack is "
+   114 Data_59 string[15] "Stack overflow "
+   113 Data_58 string[16] "Stack underflow "
+   120 Data_62 string[9] "String is"
+    27 Data_12 string[16] "Unmangled call: "
+    17 Data_5 string[22] "Value of $0F0F0F0F is "
+    15 Data_3 string[21] "Value of %0101... is "
+    13 Data_2 string[32] "Value of 0b1010... 0B0101... is "
+    18 Data_6 string[32] "Value of 0o1234567 0O1234567 is "
+    16 Data_4 string[34] "Value of 0xF0F0F0F0 0X0F0F0F0F is "
+    19 Data_7 string[31] "Value of 123 &123 #123 0123 is "
+   177 Data_80 string[20] "Value of FAKEVAR is "
+   129 Data_67 string[17] "Value of ZERO is "
+   131 Data_68 string[21] "Value of ZERO is now "
+   161 Data_76 string[34] "Value pushed is the unpredictable "
+     8 Data_0 string[31] "[ifdef] Conditional compilation"
+     9 Data_1 string[33] "[ifundef] Conditional compilation"
+   137 Data_72 string[7] "abcdefg"
+   111 Data_56 string[4] "and "
+    74 Data_29 string[12] "bytes, addr "
+    23 Data_8 string[21] "name mangled function"
+   108 Data_53 string[13] "not printed!\012"
+   104 Data_50 string[3] "ok "
+    34 Data_16 string[10] "s-abcdefgh"
+    35 Data_18 synonym Data_16
+   104 Data_49 string[17] "throws exception "
+   110 Data_54 synonym Data_49
+    28 Data_13 string[22] "unicode named function"
+
+Symbols:
+     8 Sym_1 word "main"
+    46 Sym_20 anonword "v4_20"
+    47 Sym_22 anonword "v4_22"
+    58 Sym_29 anonword "v4_29"
+    14 Sym_3 external "v4_Dot"
+    23 Sym_4 word "v4_Dot_mangled"
+    75 Sym_37 word "v4_Dota"
+   135 Sym_79 word "v4_Dotallchars"
+    74 Sym_35 word "v4_Dotalloc"
+    92 Sym_52 word "v4_Dotc"
+    76 Sym_39 word "v4_Dotf"
+    33 Sym_6 word "v4_Dothex"
+   122 Sym_75 external "v4_Dots"
+    33 Sym_8 external "v4_Fetch"
+    93 Sym_55 external "v4_Greaterfloat"
+    33 Sym_9 external "v4_Greaterr"
+    56 Sym_28 external "v4_Minus"
+    41 Sym_18 external "v4_Plus"
+   123 Sym_77 external "v4_Question"
+   104 Sym_62 external "v4_Questiondup"
+   115 Sym_69 external "v4_Slash"
+    33 Sym_12 external "v4_Store"
+    75 Sym_38 external "v4___Dotarena"
+   108 Sym_64 external "v4__abortquote"
+    82 Sym_44 external "v4__allocdefrag"
+    74 Sym_36 external "v4__allocsize"
+    82 Sym_43 external "v4__arena"
+   167 Sym_88 external "v4__argc"
+   168 Sym_89 external "v4__argv"
+   160 Sym_87 external "v4__dpush"
+   186 Sym_93 external "v4__dstack"
+   169 Sym_90 external "v4__envp"
+   143 Sym_84 variable Cell "v4__imyvar"
+    69 Sym_34 external "v4__time"
+     8 Sym_0 external "v4__type"
+   142 Sym_83 variable Cell "v4__vmyvar"
+   111 Sym_67 external "v4_abort"
+   108 Sym_63 word "v4_aborts"
+    77 Sym_40 external "v4_allocate"
+    51 Sym_23 variable Cell "v4_am"
+   191 Sym_96 external "v4_and"
+    33 Sym_7 external "v4_base"
+   135 Sym_81 external "v4_c_Fetch"
+   104 Sym_61 external "v4_catch"
+   135 Sym_80 external "v4_chars"
+    68 Sym_33 variable Cell "v4_clock"
+   136 Sym_82 external "v4_count"
+     8 Sym_2 external "v4_cr"
+   191 Sym_94 external "v4_depth"
+    62 Sym_32 external "v4_drop"
+   120 Sym_74 external "v4_dump"
+    41 Sym_14 external "v4_dup"
+    46 Sym_21 external "v4_execute"
+    54 Sym_25 word "v4_f"
+    90 Sym_49 external "v4_f_Dot"
+    89 Sym_48 external "v4_f_Plus"
+   116 Sym_71 external "v4_f_Slash"
+   174 Sym_92 word "v4_fakevar"
+   191 Sym_97 external "v4_fdepth"
+   116 Sym_72 external "v4_fdrop"
+    89 Sym_46 external "v4_fdup"
+    90 Sym_51 external "v4_fe_Dot"
+    41 Sym_13 word "v4_fib"
+    79 Sym_42 external "v4_free"
+    90 Sym_50 external "v4_fs_Dot"
+    89 Sym_47 external "v4_fsin"
+    99 Sym_56 external "v4_fsqrt"
+    33 Sym_10 external "v4_hex"
+    42 Sym_19 external "v4_i"
+   192 Sym_98 external "v4_invert"
+    52 Sym_24 word "v4_m"
+   145 Sym_85 word "v4_myvar"
+    62 Sym_31 external "v4_over"
+   109 Sym_65 word "v4_overflow"
+    88 Sym_45 word "v4_pi"
+   111 Sym_68 external "v4_quit"
+    33 Sym_11 external "v4_r_Greater"
+   191 Sym_95 external "v4_rdepth"
+   173 Sym_91 variable Cell "v4_realvar"
+    78 Sym_41 external "v4_resize"
+    62 Sym_30 word "v4_run"
+   103 Sym_57 word "v4_sfib"
+   123 Sym_76 external "v4_sp0"
+   120 Sym_73 external "v4_strlen"
+    41 Sym_17 external "v4_swap"
+   103 Sym_59 external "v4_throw"
+   148 Sym_86 external "v4_true"
+   110 Sym_66 word "v4_try"
+    93 Sym_54 external "v4_type"
+    41 Sym_15 external "v4_u_Less"
+    28 Sym_5 word "v4_xC2_xA3"
+    55 Sym_26 external "v4_z0_Equals"
+   103 Sym_58 external "v4_z0_Less"
+    41 Sym_16 external "v4_z1_Minus"
+    55 Sym_27 external "v4_z1_Plus"
+   104 Sym_60 word "v4_z1try"
+   115 Sym_70 external "v4_z2drop"
+    93 Sym_53 external "v4_z2dup"
+   128 Sym_78 constant "v4_zero"
+
+Intermediate code:
+    23 function Sym_4 {
+    23   Reg_0 = Data_8
+    23   Stack_D = Reg_0
+    23   Reg_0 = 21
+    23   Stack_D = Reg_0
+    23   call Sym_0
+    23   no-op
+           optimizes label Label_1
+    23 }
+
+    28 function Sym_5 {
+    28   Reg_0 = Data_13
+    28   Stack_D = Reg_0
+    28   Reg_0 = 22
+    28   Stack_D = Reg_0
+    28   call Sym_0
+    28   no-op
+           optimizes label Label_2
+    28 }
+
+    33 function Sym_6 {
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+    33   no-op
+           optimizes label Label_3
+    33 }
+
+    41 function Sym_13 {
+    41   call Sym_14
+    41   Reg_0 = 2
+    41   Stack_D = Reg_0
+    41   call Sym_15
+    41   Reg_0 = Stack_D
+    41   if Reg_0 == 0 goto Label_5
+    41   goto Label_4
+    41 label Label_5
+    41   call Sym_16
+    41   call Sym_14
+    41   call Sym_13
+    41   call Sym_17
+    41   call Sym_16
+    41   call Sym_13
+    41   call Sym_18
+    41 label Label_4
+    41 }
+
+    46 function Sym_20 {
+    46   Reg_0 = Data_24
+    46   Stack_D = Reg_0
+    46   Reg_0 = 22
+    46   Stack_D = Reg_0
+    46   call Sym_0
+    46   call Sym_2
+    46   no-op
+           optimizes label Label_9
+    46 }
+
+    47 function Sym_22 {
+    47   Reg_0 = Data_25
+    47   Stack_D = Reg_0
+    47   Reg_0 = 22
+    47   Stack_D = Reg_0
+    47   call Sym_0
+    47   call Sym_2
+    47   no-op
+           optimizes label Label_10
+    47 }
+
+    52 function Sym_24 {
+    52   Reg_0 = Sym_23
+    52   Stack_D = Reg_0
+    52   call Sym_8
+    52   call Sym_21
+    52   no-op
+           optimizes label Label_11
+    52 }
+
+    54 function Sym_25 {
+    55   call Sym_14
+    55   call Sym_26
+    55   Reg_0 = Stack_D
+    55   if Reg_0 == 0 goto Label_13
+    55   call Sym_27
+    55   goto Label_12
+    55 label Label_13
+    56   call Sym_14
+    56   call Sym_16
+    56   call Sym_25
+    56   no-op
+           optimizes   call Sym_24
+    52   Reg_0 = Sym_23
+    52   Stack_D = Reg_0
+    52   call Sym_8
+    52   call Sym_21
+    56   call Sym_28
+    56 label Label_12
+    56 }
+
+    58 function Sym_29 {
+    59   call Sym_14
+    59   call Sym_26
+    59   Reg_0 = Stack_D
+    59   if Reg_0 == 0 goto Label_15
+    59   goto Label_14
+    59 label Label_15
+    60   call Sym_14
+    60   call Sym_16
+    60   call Sym_29
+    60   call Sym_25
+    60   call Sym_28
+    60 label Label_14
+    60 }
+
+    62 function Sym_30 {
+    62   Reg_0 = 0
+    62   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    62   no-op
+           optimizes   Reg_1 = Stack_D
+    62   Reg_0 = Stack_D
+    62   Stack_R = Reg_0
+    62   Stack_R = Reg_1
+    62 label Label_18
+    62   call Sym_19
+    62   call Sym_31
+    62   call Sym_21
+    62   call Sym_3
+    62   Reg_1 = Stack_R
+    62   Reg_1 += 1
+    62   Reg_0 = Stack_R
+    62   Stack_R = Reg_0
+    62   Stack_R = Reg_1
+    62   Reg_1 -= Reg_0
+    62   if Reg_1 != 0 goto Label_18
+    62   no-op
+           optimizes label Label_19
+    62   Reg_0 = Stack_R
+    62   Reg_0 = Stack_R
+    62   no-op
+           optimizes label Label_17
+    62   call Sym_32
+    62   call Sym_2
+    62   no-op
+           optimizes label Label_16
+    62 }
+
+    74 function Sym_35 {
+    74   call Sym_14
+    74   call Sym_36
+    74   call Sym_3
+    74   Reg_0 = Data_29
+    74   Stack_D = Reg_0
+    74   Reg_0 = 12
+    74   Stack_D = Reg_0
+    74   call Sym_0
+    74   call Sym_14
+    74   no-op
+           optimizes   call Sym_6
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+    74   no-op
+           optimizes label Label_20
+    74 }
+
+    75 function Sym_37 {
+    75   call Sym_3
+    75   Reg_0 = Data_30
+    75   Stack_D = Reg_0
+    75   Reg_0 = 2
+    75   Stack_D = Reg_0
+    75   call Sym_0
+    75   no-op
+           optimizes   call Sym_35
+    74   call Sym_14
+    74   call Sym_36
+    74   call Sym_3
+    74   Reg_0 = Data_29
+    74   Stack_D = Reg_0
+    74   Reg_0 = 12
+    74   Stack_D = Reg_0
+    74   call Sym_0
+    74   call Sym_14
+    74   no-op
+           optimizes   call Sym_6
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+    75   call Sym_2
+    75   call Sym_38
+    75   no-op
+           optimizes label Label_21
+    75 }
+
+    76 function Sym_39 {
+    76   call Sym_3
+    76   call Sym_2
+    76   call Sym_38
+    76   no-op
+           optimizes label Label_22
+    76 }
+
+    88 function Sym_45 {
+    89   Reg_0 = 0
+    89   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    89   no-op
+           optimizes   Reg_1 = Stack_D
+    89   Reg_0 = Stack_D
+    89   if Reg_0 == Reg_1 goto Label_24
+    89   Stack_R = Reg_0
+    89   Stack_R = Reg_1
+    89 label Label_25
+    89   call Sym_46
+    89   call Sym_47
+    89   call Sym_48
+    89   Reg_1 = Stack_R
+    89   Reg_1 += 1
+    89   Reg_0 = Stack_R
+    89   Stack_R = Reg_0
+    89   Stack_R = Reg_1
+    89   Reg_1 -= Reg_0
+    89   if Reg_1 != 0 goto Label_25
+    89   no-op
+           optimizes label Label_26
+    89   Reg_0 = Stack_R
+    89   Reg_0 = Stack_R
+    89 label Label_24
+    89   no-op
+           optimizes label Label_23
+    89 }
+
+    92 function Sym_52 {
+    93   Reg_0 = Data_39
+    93   Stack_D = Reg_0
+    93   Reg_0 = 7
+    93   Stack_D = Reg_0
+    93   call Sym_0
+    93   call Sym_53
+    93   call Sym_54
+    93   Reg_0 = Data_40
+    93   Stack_D = Reg_0
+    93   Reg_0 = 5
+    93   Stack_D = Reg_0
+    93   call Sym_0
+    93   call Sym_55
+    94   Reg_0 = Stack_D
+    94   if Reg_0 == 0 goto Label_28
+    94   call Sym_46
+    94   call Sym_46
+    94   call Sym_49
+    94   call Sym_50
+    94   call Sym_51
+    94   goto Label_29
+    94 label Label_28
+    94   Reg_0 = Data_41
+    94   Stack_D = Reg_0
+    94   Reg_0 = 3
+    94   Stack_D = Reg_0
+    94   call Sym_0
+    94 label Label_29
+    94   no-op
+           optimizes label Label_27
+    94 }
+
+   103 function Sym_57 {
+   103   call Sym_14
+   103   call Sym_58
+   103   Reg_0 = Stack_D
+   103   if Reg_0 == 0 goto Label_31
+   103   Reg_0 = -24
+   103   Stack_D = Reg_0
+   103   call Sym_59
+   103 label Label_31
+   103   call Sym_13
+   103   no-op
+           optimizes label Label_30
+   103 }
+
+   104 function Sym_60 {
+   104   call Sym_61
+   104   call Sym_62
+   104   Reg_0 = Stack_D
+   104   if Reg_0 == 0 goto Label_33
+   104   Reg_0 = Data_49
+   104   Stack_D = Reg_0
+   104   Reg_0 = 17
+   104   Stack_D = Reg_0
+   104   call Sym_0
+   104   call Sym_3
+   104   call Sym_32
+   104   goto Label_34
+   104 label Label_33
+   104   Reg_0 = Data_50
+   104   Stack_D = Reg_0
+   104   Reg_0 = 3
+   104   Stack_D = Reg_0
+   104   call Sym_0
+   104   call Sym_3
+   104 label Label_34
+   104   no-op
+           optimizes label Label_32
+   104 }
+
+   108 function Sym_63 {
+   108   Reg_0 = 1
+   108   no-op
+           optimizes   Stack_D = Reg_0
+   108   no-op
+           optimizes   Reg_0 = Stack_D
+   108   if Reg_0 == 0 goto Label_36
+   108   Reg_0 = Data_53
+   108   Stack_D = Reg_0
+   108   Reg_0 = 13
+   108   Stack_D = Reg_0
+   108   call Sym_64
+   108 label Label_36
+   108   no-op
+           optimizes label Label_35
+   108 }
+
+   109 function Sym_65 {
+   109 label Label_38
+   109   Reg_0 = 0
+   109   Stack_D = Reg_0
+   109   goto Label_38
+   109   no-op
+           optimizes label Label_39
+   109   no-op
+           optimizes label Label_37
+   109 }
+
+   110 function Sym_66 {
+   110   call Sym_61
+   110   Reg_0 = Data_54
+   110   Stack_D = Reg_0
+   110   Reg_0 = 17
+   110   Stack_D = Reg_0
+   110   call Sym_0
+   110   call Sym_3
+   110   no-op
+           optimizes label Label_40
+   110 }
+
+   135 function Sym_79 {
+   135   call Sym_27
+   135   Reg_0 = 0
+   135   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   135   no-op
+           optimizes   Reg_1 = Stack_D
+   135   Reg_0 = Stack_D
+   135   if Reg_0 == Reg_1 goto Label_42
+   135   Stack_R = Reg_0
+   135   Stack_R = Reg_1
+   135 label Label_43
+   135   call Sym_14
+   135   call Sym_19
+   135   call Sym_80
+   135   call Sym_18
+   135   call Sym_81
+   135   call Sym_3
+   135   Reg_1 = Stack_R
+   135   Reg_1 += 1
+   135   Reg_0 = Stack_R
+   135   Stack_R = Reg_0
+   135   Stack_R = Reg_1
+   135   Reg_1 -= Reg_0
+   135   if Reg_1 != 0 goto Label_43
+   135   no-op
+           optimizes label Label_44
+   135   Reg_0 = Stack_R
+   135   Reg_0 = Stack_R
+   135 label Label_42
+   135   no-op
+           optimizes label Label_41
+   135 }
+
+   145 function Sym_85 {
+   146   Reg_0 = Sym_84
+   146   Stack_D = Reg_0
+   146   call Sym_8
+   146   call Sym_26
+   146   Reg_0 = Stack_D
+   146   if Reg_0 == 0 goto Label_46
+   147   Reg_0 = 12345
+   147   Stack_D = Reg_0
+   147   Reg_0 = Sym_83
+   147   Stack_D = Reg_0
+   147   call Sym_12
+   148   no-op
+           optimizes   call Sym_86
+   148   Reg_0 = -1
+   148   Stack_D = Reg_0
+   148   Reg_0 = Sym_84
+   148   Stack_D = Reg_0
+   148   call Sym_12
+   149 label Label_46
+   149   Reg_0 = Sym_83
+   149   Stack_D = Reg_0
+   149   no-op
+           optimizes label Label_45
+   149 }
+
+   174 function Sym_92 {
+   174   Reg_0 = Sym_91
+   174   Stack_D = Reg_0
+   174   no-op
+           optimizes label Label_47
+   174 }
+
+     8 function Sym_1 {
+     8   Reg_0 = Data_0
+     8   Stack_D = Reg_0
+     8   Reg_0 = 31
+     8   Stack_D = Reg_0
+     8   call Sym_0
+     8   call Sym_2
+     9   Reg_0 = Data_1
+     9   Stack_D = Reg_0
+     9   Reg_0 = 33
+     9   Stack_D = Reg_0
+     9   call Sym_0
+     9   call Sym_2
+    13   Reg_0 = Data_2
+    13   Stack_D = Reg_0
+    13   Reg_0 = 32
+    13   Stack_D = Reg_0
+    13   call Sym_0
+    14   Reg_0 = -1431655766
+    14   Stack_D = Reg_0
+    14   call Sym_3
+    14   Reg_0 = 1431655765
+    14   Stack_D = Reg_0
+    14   call Sym_3
+    14   call Sym_2
+    15   Reg_0 = Data_3
+    15   Stack_D = Reg_0
+    15   Reg_0 = 21
+    15   Stack_D = Reg_0
+    15   call Sym_0
+    15   Reg_0 = 1431655765
+    15   Stack_D = Reg_0
+    15   call Sym_3
+    15   call Sym_2
+    16   Reg_0 = Data_4
+    16   Stack_D = Reg_0
+    16   Reg_0 = 34
+    16   Stack_D = Reg_0
+    16   call Sym_0
+    16   Reg_0 = -252645136
+    16   Stack_D = Reg_0
+    16   call Sym_3
+    16   Reg_0 = 252645135
+    16   Stack_D = Reg_0
+    16   call Sym_3
+    16   call Sym_2
+    17   Reg_0 = Data_5
+    17   Stack_D = Reg_0
+    17   Reg_0 = 22
+    17   Stack_D = Reg_0
+    17   call Sym_0
+    17   Reg_0 = 252645135
+    17   Stack_D = Reg_0
+    17   call Sym_3
+    17   call Sym_2
+    18   Reg_0 = Data_6
+    18   Stack_D = Reg_0
+    18   Reg_0 = 32
+    18   Stack_D = Reg_0
+    18   call Sym_0
+    18   Reg_0 = 342391
+    18   Stack_D = Reg_0
+    18   call Sym_3
+    18   Reg_0 = 342391
+    18   Stack_D = Reg_0
+    18   call Sym_3
+    18   call Sym_2
+    19   Reg_0 = Data_7
+    19   Stack_D = Reg_0
+    19   Reg_0 = 31
+    19   Stack_D = Reg_0
+    19   call Sym_0
+    19   Reg_0 = 123
+    19   Stack_D = Reg_0
+    19   call Sym_3
+    19   Reg_0 = 123
+    19   Stack_D = Reg_0
+    19   call Sym_3
+    19   Reg_0 = 123
+    19   Stack_D = Reg_0
+    19   call Sym_3
+    19   Reg_0 = 123
+    19   Stack_D = Reg_0
+    19   call Sym_3
+    19   call Sym_2
+    24   Reg_0 = Data_9
+    24   Stack_D = Reg_0
+    24   Reg_0 = 13
+    24   Stack_D = Reg_0
+    24   call Sym_0
+    24   no-op
+           optimizes   call Sym_4
+    23   Reg_0 = Data_8
+    23   Stack_D = Reg_0
+    23   Reg_0 = 21
+    23   Stack_D = Reg_0
+    23   call Sym_0
+    24   call Sym_2
+    25   Reg_0 = Data_10
+    25   Stack_D = Reg_0
+    25   Reg_0 = 20
+    25   Stack_D = Reg_0
+    25   call Sym_0
+    25   no-op
+           optimizes   call Sym_4
+    23   Reg_0 = Data_8
+    23   Stack_D = Reg_0
+    23   Reg_0 = 21
+    23   Stack_D = Reg_0
+    23   call Sym_0
+    25   call Sym_2
+    26   Reg_0 = Data_11
+    26   Stack_D = Reg_0
+    26   Reg_0 = 20
+    26   Stack_D = Reg_0
+    26   call Sym_0
+    26   no-op
+           optimizes   call Sym_4
+    23   Reg_0 = Data_8
+    23   Stack_D = Reg_0
+    23   Reg_0 = 21
+    23   Stack_D = Reg_0
+    23   call Sym_0
+    26   call Sym_2
+    27   Reg_0 = Data_12
+    27   Stack_D = Reg_0
+    27   Reg_0 = 16
+    27   Stack_D = Reg_0
+    27   call Sym_0
+    27   no-op
+           optimizes   call Sym_4
+    23   Reg_0 = Data_8
+    23   Stack_D = Reg_0
+    23   Reg_0 = 21
+    23   Stack_D = Reg_0
+    23   call Sym_0
+    27   call Sym_2
+    29   Reg_0 = Data_14
+    29   Stack_D = Reg_0
+    29   Reg_0 = 21
+    29   Stack_D = Reg_0
+    29   call Sym_0
+    29   no-op
+           optimizes   call Sym_5
+    28   Reg_0 = Data_13
+    28   Stack_D = Reg_0
+    28   Reg_0 = 22
+    28   Stack_D = Reg_0
+    28   call Sym_0
+    29   call Sym_2
+    34   Reg_0 = Data_15
+    34   Stack_D = Reg_0
+    34   Reg_0 = 20
+    34   Stack_D = Reg_0
+    34   call Sym_0
+    34   Reg_0 = Data_16
+    34   Stack_D = Reg_0
+    34   Reg_0 = 10
+    34   Stack_D = Reg_0
+    34   call Sym_3
+    34   no-op
+           optimizes   call Sym_6
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+    34   call Sym_2
+    35   Reg_0 = Data_17
+    35   Stack_D = Reg_0
+    35   Reg_0 = 26
+    35   Stack_D = Reg_0
+    35   call Sym_0
+    35   Reg_0 = Data_18
+    35   Stack_D = Reg_0
+    35   Reg_0 = 10
+    35   Stack_D = Reg_0
+    35   call Sym_3
+    35   no-op
+           optimizes   call Sym_6
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+    35   call Sym_2
+    36   Reg_0 = Data_19
+    36   Stack_D = Reg_0
+    36   Reg_0 = 20
+    36   Stack_D = Reg_0
+    36   call Sym_0
+    36   Reg_0 = Data_20
+    36   Stack_D = Reg_0
+    36   no-op
+           optimizes   call Sym_6
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+    36   call Sym_2
+    37   Reg_0 = Data_21
+    37   Stack_D = Reg_0
+    37   Reg_0 = 26
+    37   Stack_D = Reg_0
+    37   call Sym_0
+    37   Reg_0 = Data_22
+    37   Stack_D = Reg_0
+    37   no-op
+           optimizes   call Sym_6
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+    37   call Sym_2
+    42   Reg_0 = Data_23
+    42   Stack_D = Reg_0
+    42   Reg_0 = 11
+    42   Stack_D = Reg_0
+    42   call Sym_0
+    42   Reg_0 = 20
+    42   Stack_D = Reg_0
+    42   Reg_0 = 0
+    42   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    42   no-op
+           optimizes   Reg_1 = Stack_D
+    42   Reg_0 = Stack_D
+    42   Stack_R = Reg_0
+    42   Stack_R = Reg_1
+    42 label Label_7
+    42   call Sym_19
+    42   call Sym_13
+    42   call Sym_3
+    42   Reg_1 = Stack_R
+    42   Reg_1 += 1
+    42   Reg_0 = Stack_R
+    42   Stack_R = Reg_0
+    42   Stack_R = Reg_1
+    42   Reg_1 -= Reg_0
+    42   if Reg_1 != 0 goto Label_7
+    42   no-op
+           optimizes label Label_8
+    42   Reg_0 = Stack_R
+    42   Reg_0 = Stack_R
+    42   no-op
+           optimizes label Label_6
+    42   call Sym_2
+    46   Reg_0 = Sym_20
+    46   Stack_D = Reg_0
+    46   call Sym_21
+    47   Reg_0 = Sym_22
+    47   Stack_D = Reg_0
+    47   call Sym_21
+    60   Reg_0 = Sym_29
+    60   Stack_D = Reg_0
+    60   Reg_0 = Sym_23
+    60   Stack_D = Reg_0
+    60   call Sym_12
+    63   Reg_0 = Data_26
+    63   Stack_D = Reg_0
+    63   Reg_0 = 18
+    63   Stack_D = Reg_0
+    63   call Sym_0
+    63   Reg_0 = Sym_24
+    63   Stack_D = Reg_0
+    63   Reg_0 = 20
+    63   Stack_D = Reg_0
+    63   call Sym_30
+    64   Reg_0 = Data_27
+    64   Stack_D = Reg_0
+    64   Reg_0 = 18
+    64   Stack_D = Reg_0
+    64   call Sym_0
+    64   Reg_0 = Sym_25
+    64   Stack_D = Reg_0
+    64   Reg_0 = 20
+    64   Stack_D = Reg_0
+    64   call Sym_30
+    69   Reg_0 = Sym_33
+    69   Stack_D = Reg_0
+    69   call Sym_34
+    69   call Sym_32
+    70   Reg_0 = Data_28
+    70   Stack_D = Reg_0
+    70   Reg_0 = 9
+    70   Stack_D = Reg_0
+    70   call Sym_0
+    70   Reg_0 = Sym_33
+    70   Stack_D = Reg_0
+    70   call Sym_8
+    70   call Sym_3
+    70   call Sym_2
+    77   Reg_0 = Data_31
+    77   Stack_D = Reg_0
+    77   Reg_0 = 19
+    77   Stack_D = Reg_0
+    77   call Sym_0
+    77   Reg_0 = 23
+    77   Stack_D = Reg_0
+    77   call Sym_40
+    77   no-op
+           optimizes   call Sym_37
+    75   call Sym_3
+    75   Reg_0 = Data_30
+    75   Stack_D = Reg_0
+    75   Reg_0 = 2
+    75   Stack_D = Reg_0
+    75   call Sym_0
+    75   call Sym_35
+    75   call Sym_2
+    75   call Sym_38
+    78   Reg_0 = Data_32
+    78   Stack_D = Reg_0
+    78   Reg_0 = 19
+    78   Stack_D = Reg_0
+    78   call Sym_0
+    78   Reg_0 = 9
+    78   Stack_D = Reg_0
+    78   call Sym_41
+    78   no-op
+           optimizes   call Sym_37
+    75   call Sym_3
+    75   Reg_0 = Data_30
+    75   Stack_D = Reg_0
+    75   Reg_0 = 2
+    75   Stack_D = Reg_0
+    75   call Sym_0
+    75   call Sym_35
+    75   call Sym_2
+    75   call Sym_38
+    79   Reg_0 = Data_33
+    79   Stack_D = Reg_0
+    79   Reg_0 = 6
+    79   Stack_D = Reg_0
+    79   call Sym_0
+    79   call Sym_42
+    79   no-op
+           optimizes   call Sym_39
+    76   call Sym_3
+    76   call Sym_2
+    76   call Sym_38
+    80   Reg_0 = Data_34
+    80   Stack_D = Reg_0
+    80   Reg_0 = 18
+    80   Stack_D = Reg_0
+    80   call Sym_0
+    80   Reg_0 = 1
+    80   Stack_D = Reg_0
+    80   call Sym_40
+    80   no-op
+           optimizes   call Sym_37
+    75   call Sym_3
+    75   Reg_0 = Data_30
+    75   Stack_D = Reg_0
+    75   Reg_0 = 2
+    75   Stack_D = Reg_0
+    75   call Sym_0
+    75   call Sym_35
+    75   call Sym_2
+    75   call Sym_38
+    81   Reg_0 = Data_35
+    81   Stack_D = Reg_0
+    81   Reg_0 = 6
+    81   Stack_D = Reg_0
+    81   call Sym_0
+    81   call Sym_42
+    81   no-op
+           optimizes   call Sym_39
+    76   call Sym_3
+    76   call Sym_2
+    76   call Sym_38
+    82   call Sym_43
+    82   call Sym_44
+    82   call Sym_38
+    83   Reg_0 = Data_36
+    83   Stack_D = Reg_0
+    83   Reg_0 = 16
+    83   Stack_D = Reg_0
+    83   call Sym_0
+    83   Reg_0 = 1
+    83   Stack_D = Reg_0
+    83   Reg_0 = 1
+    83   Stack_D = Reg_0
+    83   call Sym_41
+    83   call Sym_3
+    83   call Sym_3
+    83   call Sym_2
+    84   Reg_0 = Data_37
+    84   Stack_D = Reg_0
+    84   Reg_0 = 14
+    84   Stack_D = Reg_0
+    84   call Sym_0
+    84   Reg_0 = 1
+    84   Stack_D = Reg_0
+    84   call Sym_42
+    84   call Sym_3
+    84   call Sym_2
+    90   Reg_0 = Data_38
+    90   Stack_D = Reg_0
+    90   Reg_0 = 6
+    90   Stack_D = Reg_0
+    90   call Sym_0
+    90   Reg_0 = 100
+    90   Stack_D = Reg_0
+    90   Reg_0 = 1077936128
+    90   Stack_F = Reg_0
+    90   call Sym_45
+    90   call Sym_46
+    90   call Sym_46
+    90   call Sym_49
+    90   call Sym_50
+    90   call Sym_51
+    90   call Sym_2
+    95   Reg_0 = Data_42
+    95   Stack_D = Reg_0
+    95   Reg_0 = 9
+    95   Stack_D = Reg_0
+    95   call Sym_52
+    95   call Sym_2
+    95   Reg_0 = Data_43
+    95   Stack_D = Reg_0
+    95   Reg_0 = 11
+    95   Stack_D = Reg_0
+    95   call Sym_52
+    95   call Sym_2
+    96   Reg_0 = Data_44
+    96   Stack_D = Reg_0
+    96   Reg_0 = 4
+    96   Stack_D = Reg_0
+    96   call Sym_52
+    96   call Sym_2
+    96   Reg_0 = Data_45
+    96   Stack_D = Reg_0
+    96   Reg_0 = 5
+    96   Stack_D = Reg_0
+    96   call Sym_52
+    96   call Sym_2
+    97   Reg_0 = Data_46
+    97   Stack_D = Reg_0
+    97   Reg_0 = 3
+    97   Stack_D = Reg_0
+    97   call Sym_52
+    97   call Sym_2
+    97   Reg_0 = Data_47
+    97   Stack_D = Reg_0
+    97   Reg_0 = 5
+    97   Stack_D = Reg_0
+    97   call Sym_52
+    97   call Sym_2
+    99   Reg_0 = Data_48
+    99   Stack_D = Reg_0
+    99   Reg_0 = 23
+    99   Stack_D = Reg_0
+    99   call Sym_0
+    99   Reg_0 = -1082130432
+    99   Stack_F = Reg_0
+    99   call Sym_56
+    99   call Sym_46
+    99   call Sym_46
+    99   call Sym_49
+    99   call Sym_50
+    99   call Sym_51
+    99   call Sym_2
+   105   Reg_0 = Data_51
+   105   Stack_D = Reg_0
+   105   Reg_0 = 14
+   105   Stack_D = Reg_0
+   105   call Sym_0
+   105   Reg_0 = -10
+   105   Stack_D = Reg_0
+   105   Reg_0 = Sym_57
+   105   Stack_D = Reg_0
+   105   call Sym_60
+   105   call Sym_2
+   106   Reg_0 = Data_52
+   106   Stack_D = Reg_0
+   106   Reg_0 = 14
+   106   Stack_D = Reg_0
+   106   call Sym_0
+   106   Reg_0 = 10
+   106   Stack_D = Reg_0
+   106   Reg_0 = Sym_57
+   106   Stack_D = Reg_0
+   106   call Sym_60
+   106   call Sym_2
+   111   Reg_0 = Data_55
+   111   Stack_D = Reg_0
+   111   Reg_0 = 12
+   111   Stack_D = Reg_0
+   111   call Sym_0
+   111   Reg_0 = Sym_67
+   111   Stack_D = Reg_0
+   111   no-op
+           optimizes   call Sym_66
+   110   call Sym_61
+   110   Reg_0 = Data_54
+   110   Stack_D = Reg_0
+   110   Reg_0 = 17
+   110   Stack_D = Reg_0
+   110   call Sym_0
+   110   call Sym_3
+   111   Reg_0 = Data_56
+   111   Stack_D = Reg_0
+   111   Reg_0 = 4
+   111   Stack_D = Reg_0
+   111   call Sym_0
+   111   Reg_0 = Sym_68
+   111   Stack_D = Reg_0
+   111   no-op
+           optimizes   call Sym_66
+   110   call Sym_61
+   110   Reg_0 = Data_54
+   110   Stack_D = Reg_0
+   110   Reg_0 = 17
+   110   Stack_D = Reg_0
+   110   call Sym_0
+   110   call Sym_3
+   111   call Sym_2
+   112   Reg_0 = Data_57
+   112   Stack_D = Reg_0
+   112   Reg_0 = 12
+   112   Stack_D = Reg_0
+   112   call Sym_0
+   112   Reg_0 = Sym_63
+   112   Stack_D = Reg_0
+   112   no-op
+           optimizes   call Sym_66
+   110   call Sym_61
+   110   Reg_0 = Data_54
+   110   Stack_D = Reg_0
+   110   Reg_0 = 17
+   110   Stack_D = Reg_0
+   110   call Sym_0
+   110   call Sym_3
+   112   call Sym_2
+   113   Reg_0 = Data_58
+   113   Stack_D = Reg_0
+   113   Reg_0 = 16
+   113   Stack_D = Reg_0
+   113   call Sym_0
+   113   Reg_0 = Sym_32
+   113   Stack_D = Reg_0
+   113   no-op
+           optimizes   call Sym_66
+   110   call Sym_61
+   110   Reg_0 = Data_54
+   110   Stack_D = Reg_0
+   110   Reg_0 = 17
+   110   Stack_D = Reg_0
+   110   call Sym_0
+   110   call Sym_3
+   113   call Sym_2
+   114   Reg_0 = Data_59
+   114   Stack_D = Reg_0
+   114   Reg_0 = 15
+   114   Stack_D = Reg_0
+   114   call Sym_0
+   114   Reg_0 = Sym_65
+   114   Stack_D = Reg_0
+   114   no-op
+           optimizes   call Sym_66
+   110   call Sym_61
+   110   Reg_0 = Data_54
+   110   Stack_D = Reg_0
+   110   Reg_0 = 17
+   110   Stack_D = Reg_0
+   110   call Sym_0
+   110   call Sym_3
+   114   call Sym_2
+   115   Reg_0 = Data_60
+   115   Stack_D = Reg_0
+   115   Reg_0 = 14
+   115   Stack_D = Reg_0
+   115   call Sym_0
+   115   Reg_0 = 1
+   115   Stack_D = Reg_0
+   115   Reg_0 = 0
+   115   Stack_D = Reg_0
+   115   Reg_0 = Sym_69
+   115   Stack_D = Reg_0
+   115   no-op
+           optimizes   call Sym_66
+   110   call Sym_61
+   110   Reg_0 = Data_54
+   110   Stack_D = Reg_0
+   110   Reg_0 = 17
+   110   Stack_D = Reg_0
+   110   call Sym_0
+   110   call Sym_3
+   115   call Sym_70
+   115   call Sym_2
+   116   Reg_0 = Data_61
+   116   Stack_D = Reg_0
+   116   Reg_0 = 15
+   116   Stack_D = Reg_0
+   116   call Sym_0
+   116   Reg_0 = 1065353216
+   116   Stack_F = Reg_0
+   116   Reg_0 = 0
+   116   Stack_F = Reg_0
+   116   Reg_0 = Sym_71
+   116   Stack_D = Reg_0
+   116   no-op
+           optimizes   call Sym_66
+   110   call Sym_61
+   110   Reg_0 = Data_54
+   110   Stack_D = Reg_0
+   110   Reg_0 = 17
+   110   Stack_D = Reg_0
+   110   call Sym_0
+   110   call Sym_3
+   116   call Sym_72
+   116   call Sym_72
+   116   call Sym_2
+   120   Reg_0 = Data_62
+   120   Stack_D = Reg_0
+   120   Reg_0 = 9
+   120   Stack_D = Reg_0
+   120   call Sym_0
+   120   call Sym_2
+   120   Reg_0 = Data_63
+   120   Stack_D = Reg_0
+   120   call Sym_73
+   120   call Sym_27
+   120   call Sym_74
+   121   Reg_0 = Data_64
+   121   Stack_D = Reg_0
+   121   Reg_0 = 18
+   121   Stack_D = Reg_0
+   121   call Sym_0
+   121   call Sym_2
+   121   Reg_0 = Sym_74
+   121   Stack_D = Reg_0
+   121   Reg_0 = 32
+   121   Stack_D = Reg_0
+   121   call Sym_74
+   122   Reg_0 = Data_65
+   122   Stack_D = Reg_0
+   122   Reg_0 = 8
+   122   Stack_D = Reg_0
+   122   call Sym_0
+   122   Reg_0 = 1
+   122   Stack_D = Reg_0
+   122   Reg_0 = 2
+   122   Stack_D = Reg_0
+   122   Reg_0 = 3
+   122   Stack_D = Reg_0
+   122   call Sym_75
+   122   call Sym_2
+   123   Reg_0 = Data_66
+   123   Stack_D = Reg_0
+   123   Reg_0 = 14
+   123   Stack_D = Reg_0
+   123   call Sym_0
+   123   call Sym_76
+   123   call Sym_77
+   123   call Sym_2
+   124   call Sym_32
+   124   call Sym_70
+   128   Reg_0 = 0
+   128   no-op
+           optimizes   Stack_D = Reg_0
+   128   no-op
+           optimizes   Reg_0 = Stack_D
+   128   *(Sym_78) = Reg_0
+   129   Reg_0 = Data_67
+   129   Stack_D = Reg_0
+   129   Reg_0 = 17
+   129   Stack_D = Reg_0
+   129   call Sym_0
+   129   Reg_0 = *(Sym_78)
+   129   Stack_D = Reg_0
+   129   call Sym_3
+   129   call Sym_2
+   130   Reg_0 = 1
+   130   Stack_D = Reg_0
+   130   Reg_0 = Sym_78
+   130   Stack_D = Reg_0
+   130   call Sym_12
+   131   Reg_0 = Data_68
+   131   Stack_D = Reg_0
+   131   Reg_0 = 21
+   131   Stack_D = Reg_0
+   131   call Sym_0
+   131   Reg_0 = *(Sym_78)
+   131   Stack_D = Reg_0
+   131   call Sym_3
+   131   call Sym_2
+   136   Reg_0 = Data_69
+   136   Stack_D = Reg_0
+   136   Reg_0 = 10
+   136   Stack_D = Reg_0
+   136   call Sym_0
+   136   Reg_0 = Data_70
+   136   Stack_D = Reg_0
+   136   call Sym_82
+   136   call Sym_79
+   136   call Sym_2
+   136   call Sym_32
+   137   Reg_0 = Data_71
+   137   Stack_D = Reg_0
+   137   Reg_0 = 10
+   137   Stack_D = Reg_0
+   137   call Sym_0
+   137   Reg_0 = Data_72
+   137   Stack_D = Reg_0
+   137   Reg_0 = 7
+   137   Stack_D = Reg_0
+   137   call Sym_79
+   137   call Sym_2
+   137   call Sym_32
+   144   Reg_0 = Data_73
+   144   Stack_D = Reg_0
+   144   Reg_0 = 24
+   144   Stack_D = Reg_0
+   144   call Sym_0
+   144   Reg_0 = Sym_83
+   144   Stack_D = Reg_0
+   144   call Sym_8
+   144   call Sym_3
+   144   call Sym_2
+   151   Reg_0 = Data_74
+   151   Stack_D = Reg_0
+   151   Reg_0 = 9
+   151   Stack_D = Reg_0
+   151   call Sym_0
+   151   call Sym_85
+   151   call Sym_8
+   151   call Sym_3
+   151   call Sym_2
+   152   Reg_0 = 54321
+   152   Stack_D = Reg_0
+   152   call Sym_85
+   152   call Sym_12
+   153   Reg_0 = Data_75
+   153   Stack_D = Reg_0
+   153   Reg_0 = 13
+   153   Stack_D = Reg_0
+   153   call Sym_0
+   153   call Sym_85
+   153   call Sym_8
+   153   call Sym_3
+   153   call Sym_2
+   160   call Sym_87
+   161   Reg_0 = Data_76
+   161   Stack_D = Reg_0
+   161   Reg_0 = 34
+   161   Stack_D = Reg_0
+   161   call Sym_0
+   161   call Sym_3
+   161   call Sym_2
+   167   Reg_0 = Sym_88
+   167   Stack_D = Reg_0
+   167   call Sym_8
+   167   Reg_0 = Data_77
+   167   Stack_D = Reg_0
+   167   Reg_0 = 16
+   167   Stack_D = Reg_0
+   167   call Sym_0
+   167   call Sym_3
+   167   call Sym_2
+   168   Reg_0 = Sym_89
+   168   Stack_D = Reg_0
+   168   call Sym_8
+   168   Reg_0 = Data_78
+   168   Stack_D = Reg_0
+   168   Reg_0 = 16
+   168   Stack_D = Reg_0
+   168   call Sym_0
+   168   no-op
+           optimizes   call Sym_6
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+   168   call Sym_2
+   169   Reg_0 = Sym_90
+   169   Stack_D = Reg_0
+   169   call Sym_8
+   169   Reg_0 = Data_79
+   169   Stack_D = Reg_0
+   169   Reg_0 = 16
+   169   Stack_D = Reg_0
+   169   call Sym_0
+   169   no-op
+           optimizes   call Sym_6
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+   169   call Sym_2
+   175   Reg_0 = -99
+   175   Stack_D = Reg_0
+   175   no-op
+           optimizes   call Sym_92
+   174   Reg_0 = Sym_91
+   174   Stack_D = Reg_0
+   175   call Sym_12
+   175   no-op
+           optimizes   call Sym_92
+   174   Reg_0 = Sym_91
+   174   Stack_D = Reg_0
+   175   call Sym_8
+   177   Reg_0 = Data_80
+   177   Stack_D = Reg_0
+   177   Reg_0 = 20
+   177   Stack_D = Reg_0
+   177   call Sym_0
+   177   call Sym_3
+   177   call Sym_2
+   178   Reg_0 = Sym_91
+   178   Stack_D = Reg_0
+   178   Reg_0 = Data_81
+   178   Stack_D = Reg_0
+   178   Reg_0 = 19
+   178   Stack_D = Reg_0
+   178   call Sym_0
+   178   no-op
+           optimizes   call Sym_6
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+   178   call Sym_2
+   179   no-op
+           optimizes   call Sym_92
+   174   Reg_0 = Sym_91
+   174   Stack_D = Reg_0
+   179   Reg_0 = Data_82
+   179   Stack_D = Reg_0
+   179   Reg_0 = 19
+   179   Stack_D = Reg_0
+   179   call Sym_0
+   179   no-op
+           optimizes   call Sym_6
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+   179   call Sym_2
+   180   Reg_0 = Sym_91
+   180   Stack_D = Reg_0
+   180   Reg_0 = Data_83
+   180   Stack_D = Reg_0
+   180   Reg_0 = 21
+   180   Stack_D = Reg_0
+   180   call Sym_0
+   180   no-op
+           optimizes   call Sym_6
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+   180   call Sym_2
+   181   Reg_0 = Sym_92
+   181   Stack_D = Reg_0
+   181   Reg_0 = Data_84
+   181   Stack_D = Reg_0
+   181   Reg_0 = 21
+   181   Stack_D = Reg_0
+   181   call Sym_0
+   181   no-op
+           optimizes   call Sym_6
+    33   call Sym_7
+    33   call Sym_8
+    33   call Sym_9
+    33   call Sym_10
+    33   call Sym_3
+    33   call Sym_11
+    33   call Sym_7
+    33   call Sym_12
+   181   call Sym_2
+   185   Reg_0 = 1
+   185   Stack_D = Reg_0
+   185   Reg_0 = 2
+   185   Stack_D = Reg_0
+   185   Reg_0 = 3
+   185   Stack_D = Reg_0
+   185   Reg_0 = 4
+   185   Stack_D = Reg_0
+   185   Reg_0 = 5
+   185   Stack_D = Reg_0
+   186   Reg_0 = -99
+   186   Stack_D = Reg_0
+   186   Reg_0 = Sym_93
+   186   Stack_D = Reg_0
+   186   call Sym_12
+   187   Reg_0 = Data_85
+   187   Stack_D = Reg_0
+   187   Reg_0 = 9
+   187   Stack_D = Reg_0
+   187   call Sym_0
+   187   call Sym_3
+   187   call Sym_3
+   187   call Sym_3
+   187   call Sym_3
+   187   call Sym_3
+   187   call Sym_2
+   191   call Sym_94
+   191   call Sym_26
+   191   call Sym_95
+   191   call Sym_26
+   191   call Sym_96
+   191   call Sym_97
+   191   call Sym_26
+   191   call Sym_96
+   192   call Sym_98
+   192   call Sym_32
+   192   no-op
+           optimizes label Label_0
+   192 }
+
@@ -0,0 +1,2316 @@
+	.file	"features.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/demos/",100,0,0,Ltext0
+.stabs	"features.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC70:
+	.string "\007abcdefg"
+.LC63:
+	.string "\021abcdefghijklmnopq"
+.LC20:
+.LC22:
+	.string "\012c-abcdefgh"
+.LC40:
+	.string "' is "
+.LC30:
+	.string ", "
+.LC43:
+	.string "-123.456e-7"
+.LC45:
+	.string "-1e99"
+.LC47:
+	.string "1.0ex"
+.LC46:
+	.string "1.x"
+.LC42:
+	.string "123.456e7"
+.LC44:
+	.string "1e99"
+.LC57:
+	.string "Abort '...' "
+.LC55:
+	.string "Abort, quit "
+.LC10:
+	.string "All lowercase call: "
+.LC11:
+	.string "All uppercase call: "
+.LC34:
+	.string "Allocate  1 byte: "
+.LC31:
+	.string "Allocate 23 bytes: "
+.LC24:
+	.string "Anonymous function one"
+.LC25:
+	.string "Anonymous function two"
+.LC69:
+	.string "C-string: "
+.LC28:
+	.string "Clock is "
+.LC14:
+	.string "Direct unicode call: "
+.LC60:
+	.string "Division by 0 "
+.LC64:
+	.string "Dump code start is"
+.LC41:
+	.string "Err"
+.LC84:
+	.string "FAKEVAR ' address is "
+.LC82:
+	.string "FAKEVAR address is "
+.LC52:
+	.string "Fibonacci  10 "
+.LC51:
+	.string "Fibonacci -10 "
+.LC23:
+	.string "Fibonacci: "
+.LC15:
+.LC19:
+	.string "First occurrence is "
+.LC39:
+	.string "Float '"
+.LC61:
+	.string "Float / by 0.0 "
+.LC37:
+	.string "Free invalid: "
+.LC33:
+.LC35:
+	.string "Free: "
+.LC74:
+	.string "MYVAR is "
+.LC75:
+	.string "MYVAR is now "
+.LC26:
+.LC27:
+	.string "Mutual recursion: "
+.LC9:
+	.string "Normal call: "
+.LC38:
+	.string "Pi is "
+.LC77:
+	.string "Program argc is "
+.LC78:
+	.string "Program argv is "
+.LC79:
+	.string "Program envp is "
+.LC83:
+	.string "REALVAR ' address is "
+.LC81:
+	.string "REALVAR address is "
+.LC73:
+	.string "Real value of vMYVAR is "
+.LC36:
+	.string "Resize invalid: "
+.LC32:
+	.string "Resize to 9 bytes: "
+.LC71:
+	.string "S-string: "
+.LC17:
+.LC21:
+	.string "Second occurrence is also "
+.LC48:
+	.string "Square root of -1.0 is "
+.LC66:
+	.string "Stack base is "
+.LC65:
+	.string "Stack is"
+.LC85:
+	.string "Stack is "
+.LC59:
+	.string "Stack overflow "
+.LC58:
+	.string "Stack underflow "
+.LC62:
+	.string "String is"
+.LC12:
+	.string "Unmangled call: "
+.LC5:
+	.string "Value of $0F0F0F0F is "
+.LC3:
+	.string "Value of %0101... is "
+.LC2:
+	.string "Value of 0b1010... 0B0101... is "
+.LC6:
+	.string "Value of 0o1234567 0O1234567 is "
+.LC4:
+	.string "Value of 0xF0F0F0F0 0X0F0F0F0F is "
+.LC7:
+	.string "Value of 123 &123 #123 0123 is "
+.LC80:
+	.string "Value of FAKEVAR is "
+.LC67:
+	.string "Value of ZERO is "
+.LC68:
+	.string "Value of ZERO is now "
+.LC76:
+	.string "Value pushed is the unpredictable "
+.LC0:
+	.string "[ifdef] Conditional compilation"
+.LC1:
+	.string "[ifundef] Conditional compilation"
+.LC72:
+	.string "abcdefg"
+.LC56:
+	.string "and "
+.LC29:
+	.string "bytes, addr "
+.LC8:
+	.string "name mangled function"
+.LC53:
+	.string "not printed!\012"
+.LC50:
+	.string "ok "
+.LC16:
+.LC18:
+	.string "s-abcdefgh"
+.LC49:
+.LC54:
+	.string "throws exception "
+.LC13:
+	.string "unicode named function"
+.stabs	"v4__imyvar:G2",40,0,0,v4__imyvar
+	.comm  v4__imyvar,4,4
+.stabs	"v4__vmyvar:G2",40,0,0,v4__vmyvar
+	.comm  v4__vmyvar,4,4
+.stabs	"v4_am:G2",40,0,0,v4_am
+	.comm  v4_am,4,4
+.stabs	"v4_clock:G2",40,0,0,v4_clock
+	.comm  v4_clock,4,4
+.stabs	"v4_realvar:G2",40,0,0,v4_realvar
+	.comm  v4_realvar,4,4
+.stabs	"v4_zero:G2",40,0,0,v4_zero
+	.comm  v4_zero,4,4
+.text
+	.align 4
+.stabs "v4_Dot_mangled:F1",36,0,0,v4_Dot_mangled
+.globl v4_Dot_mangled
+	.type	v4_Dot_mangled,@function
+v4_Dot_mangled:
+.stabn 68,0,23,.LMa0-v4_Dot_mangled
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,23,.LMb0-v4_Dot_mangled
+.LMb0:
+.LBB4:
+	lea .LC8,%eax
+	call v4__dpush
+	mov $21,%eax
+	call v4__dpush
+	call v4__type
+.LBE4:
+.stabn 68,0,23,.LM7-v4_Dot_mangled
+.LM7:
+	pop %ebx
+	leave
+	ret
+.Lfe4:
+	.size	 v4_Dot_mangled,.Lfe4-v4_Dot_mangled
+.stabn	192,0,0,.LBB4-v4_Dot_mangled
+.stabn	224,0,0,.LBE4-v4_Dot_mangled
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4_Dot_mangled
+.text
+	.align 4
+.stabs "v4_xC2_xA3:F1",36,0,0,v4_xC2_xA3
+.globl v4_xC2_xA3
+	.type	v4_xC2_xA3,@function
+v4_xC2_xA3:
+.stabn 68,0,28,.LMa8-v4_xC2_xA3
+.LMa8:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,28,.LMb8-v4_xC2_xA3
+.LMb8:
+.LBB5:
+	lea .LC13,%eax
+	call v4__dpush
+	mov $22,%eax
+	call v4__dpush
+	call v4__type
+.LBE5:
+.stabn 68,0,28,.LM15-v4_xC2_xA3
+.LM15:
+	pop %ebx
+	leave
+	ret
+.Lfe5:
+	.size	 v4_xC2_xA3,.Lfe5-v4_xC2_xA3
+.stabn	192,0,0,.LBB5-v4_xC2_xA3
+.stabn	224,0,0,.LBE5-v4_xC2_xA3
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4_xC2_xA3
+.text
+	.align 4
+.stabs "v4_Dothex:F1",36,0,0,v4_Dothex
+.globl v4_Dothex
+	.type	v4_Dothex,@function
+v4_Dothex:
+.stabn 68,0,33,.LMa16-v4_Dothex
+.LMa16:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,33,.LMb16-v4_Dothex
+.LMb16:
+.LBB6:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.LBE6:
+.stabn 68,0,33,.LM26-v4_Dothex
+.LM26:
+	pop %ebx
+	leave
+	ret
+.Lfe6:
+	.size	 v4_Dothex,.Lfe6-v4_Dothex
+.stabn	192,0,0,.LBB6-v4_Dothex
+.stabn	224,0,0,.LBE6-v4_Dothex
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4_Dothex
+.text
+	.align 4
+.stabs "v4_fib:F1",36,0,0,v4_fib
+.globl v4_fib
+	.type	v4_fib,@function
+v4_fib:
+.stabn 68,0,41,.LMa27-v4_fib
+.LMa27:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,41,.LMb27-v4_fib
+.LMb27:
+.LBB13:
+	call v4_dup
+	mov $2,%eax
+	call v4__dpush
+	call v4_u_Less
+	call v4__dpop
+	test %eax,%eax
+	je .L5
+	jmp .L4
+.L5:
+	call v4_z1_Minus
+	call v4_dup
+	call v4_fib
+	call v4_swap
+	call v4_z1_Minus
+	call v4_fib
+	call v4_Plus
+.L4:
+.LBE13:
+.stabn 68,0,41,.LM44-v4_fib
+.LM44:
+	pop %ebx
+	leave
+	ret
+.Lfe13:
+	.size	 v4_fib,.Lfe13-v4_fib
+.stabn	192,0,0,.LBB13-v4_fib
+.stabn	224,0,0,.LBE13-v4_fib
+.Lscope13:
+.stabs	"",36,0,0,.Lscope13-v4_fib
+.text
+	.align 4
+.stabs "v4_20:F1",36,0,0,v4_20
+	.type	v4_20,@function
+v4_20:
+.stabn 68,0,46,.LMa45-v4_20
+.LMa45:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,46,.LMb45-v4_20
+.LMb45:
+.LBB20:
+	lea .LC24,%eax
+	call v4__dpush
+	mov $22,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.LBE20:
+.stabn 68,0,46,.LM53-v4_20
+.LM53:
+	pop %ebx
+	leave
+	ret
+.Lfe20:
+	.size	 v4_20,.Lfe20-v4_20
+.stabn	192,0,0,.LBB20-v4_20
+.stabn	224,0,0,.LBE20-v4_20
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4_20
+.text
+	.align 4
+.stabs "v4_22:F1",36,0,0,v4_22
+	.type	v4_22,@function
+v4_22:
+.stabn 68,0,47,.LMa54-v4_22
+.LMa54:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,47,.LMb54-v4_22
+.LMb54:
+.LBB22:
+	lea .LC25,%eax
+	call v4__dpush
+	mov $22,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.LBE22:
+.stabn 68,0,47,.LM62-v4_22
+.LM62:
+	pop %ebx
+	leave
+	ret
+.Lfe22:
+	.size	 v4_22,.Lfe22-v4_22
+.stabn	192,0,0,.LBB22-v4_22
+.stabn	224,0,0,.LBE22-v4_22
+.Lscope22:
+.stabs	"",36,0,0,.Lscope22-v4_22
+.text
+	.align 4
+.stabs "v4_m:F1",36,0,0,v4_m
+.globl v4_m
+	.type	v4_m,@function
+v4_m:
+.stabn 68,0,52,.LMa63-v4_m
+.LMa63:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,52,.LMb63-v4_m
+.LMb63:
+.LBB24:
+	lea v4_am,%eax
+	call v4__dpush
+	call v4_Fetch
+	call v4_execute
+.LBE24:
+.stabn 68,0,52,.LM69-v4_m
+.LM69:
+	pop %ebx
+	leave
+	ret
+.Lfe24:
+	.size	 v4_m,.Lfe24-v4_m
+.stabn	192,0,0,.LBB24-v4_m
+.stabn	224,0,0,.LBE24-v4_m
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4_m
+.text
+	.align 4
+.stabs "v4_f:F1",36,0,0,v4_f
+.globl v4_f
+	.type	v4_f,@function
+v4_f:
+.stabn 68,0,54,.LMa70-v4_f
+.LMa70:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,54,.LMb70-v4_f
+.LMb70:
+.LBB25:
+.stabn 68,0,55,.LM71-v4_f
+.LM71:
+	call v4_dup
+	call v4_z0_Equals
+	call v4__dpop
+	test %eax,%eax
+	je .L13
+	call v4_z1_Plus
+	jmp .L12
+.L13:
+.stabn 68,0,56,.LM78-v4_f
+.LM78:
+	call v4_dup
+	call v4_z1_Minus
+	call v4_f
+.stabn 68,0,52,.LM82-v4_f
+.LM82:
+	lea v4_am,%eax
+	call v4__dpush
+	call v4_Fetch
+	call v4_execute
+.stabn 68,0,56,.LM86-v4_f
+.LM86:
+	call v4_Minus
+.L12:
+.LBE25:
+.stabn 68,0,56,.LM88-v4_f
+.LM88:
+	pop %ebx
+	leave
+	ret
+.Lfe25:
+	.size	 v4_f,.Lfe25-v4_f
+.stabn	192,0,0,.LBB25-v4_f
+.stabn	224,0,0,.LBE25-v4_f
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4_f
+.text
+	.align 4
+.stabs "v4_29:F1",36,0,0,v4_29
+	.type	v4_29,@function
+v4_29:
+.stabn 68,0,58,.LMa89-v4_29
+.LMa89:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,58,.LMb89-v4_29
+.LMb89:
+.LBB29:
+.stabn 68,0,59,.LM90-v4_29
+.LM90:
+	call v4_dup
+	call v4_z0_Equals
+	call v4__dpop
+	test %eax,%eax
+	je .L15
+	jmp .L14
+.L15:
+.stabn 68,0,60,.LM96-v4_29
+.LM96:
+	call v4_dup
+	call v4_z1_Minus
+	call v4_29
+	call v4_f
+	call v4_Minus
+.L14:
+.LBE29:
+.stabn 68,0,60,.LM102-v4_29
+.LM102:
+	pop %ebx
+	leave
+	ret
+.Lfe29:
+	.size	 v4_29,.Lfe29-v4_29
+.stabn	192,0,0,.LBB29-v4_29
+.stabn	224,0,0,.LBE29-v4_29
+.Lscope29:
+.stabs	"",36,0,0,.Lscope29-v4_29
+.text
+	.align 4
+.stabs "v4_run:F1",36,0,0,v4_run
+.globl v4_run
+	.type	v4_run,@function
+v4_run:
+.stabn 68,0,62,.LMa103-v4_run
+.LMa103:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,62,.LMb103-v4_run
+.LMb103:
+.LBB30:
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L18:
+	call v4_i
+	call v4_over
+	call v4_execute
+	call v4_Dot
+	xchg %edx,%eax
+	call v4__rpop
+	xchg %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	test %edx,%edx
+	jne .L18
+	call v4__rpop
+	call v4__rpop
+	call v4_drop
+	call v4_cr
+.LBE30:
+.stabn 68,0,62,.LM129-v4_run
+.LM129:
+	pop %ebx
+	leave
+	ret
+.Lfe30:
+	.size	 v4_run,.Lfe30-v4_run
+.stabn	192,0,0,.LBB30-v4_run
+.stabn	224,0,0,.LBE30-v4_run
+.Lscope30:
+.stabs	"",36,0,0,.Lscope30-v4_run
+.text
+	.align 4
+.stabs "v4_Dotalloc:F1",36,0,0,v4_Dotalloc
+.globl v4_Dotalloc
+	.type	v4_Dotalloc,@function
+v4_Dotalloc:
+.stabn 68,0,74,.LMa130-v4_Dotalloc
+.LMa130:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,74,.LMb130-v4_Dotalloc
+.LMb130:
+.LBB35:
+	call v4_dup
+	call v4__allocsize
+	call v4_Dot
+	lea .LC29,%eax
+	call v4__dpush
+	mov $12,%eax
+	call v4__dpush
+	call v4__type
+	call v4_dup
+.stabn 68,0,33,.LM141-v4_Dotalloc
+.LM141:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.LBE35:
+.stabn 68,0,74,.LM150-v4_Dotalloc
+.LM150:
+	pop %ebx
+	leave
+	ret
+.Lfe35:
+	.size	 v4_Dotalloc,.Lfe35-v4_Dotalloc
+.stabn	192,0,0,.LBB35-v4_Dotalloc
+.stabn	224,0,0,.LBE35-v4_Dotalloc
+.Lscope35:
+.stabs	"",36,0,0,.Lscope35-v4_Dotalloc
+.text
+	.align 4
+.stabs "v4_Dota:F1",36,0,0,v4_Dota
+.globl v4_Dota
+	.type	v4_Dota,@function
+v4_Dota:
+.stabn 68,0,75,.LMa151-v4_Dota
+.LMa151:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,75,.LMb151-v4_Dota
+.LMb151:
+.LBB37:
+	call v4_Dot
+	lea .LC30,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,74,.LM159-v4_Dota
+.LM159:
+	call v4_dup
+	call v4__allocsize
+	call v4_Dot
+	lea .LC29,%eax
+	call v4__dpush
+	mov $12,%eax
+	call v4__dpush
+	call v4__type
+	call v4_dup
+.stabn 68,0,33,.LM169-v4_Dota
+.LM169:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,75,.LM177-v4_Dota
+.LM177:
+	call v4_cr
+	call v4___Dotarena
+.LBE37:
+.stabn 68,0,75,.LM180-v4_Dota
+.LM180:
+	pop %ebx
+	leave
+	ret
+.Lfe37:
+	.size	 v4_Dota,.Lfe37-v4_Dota
+.stabn	192,0,0,.LBB37-v4_Dota
+.stabn	224,0,0,.LBE37-v4_Dota
+.Lscope37:
+.stabs	"",36,0,0,.Lscope37-v4_Dota
+.text
+	.align 4
+.stabs "v4_Dotf:F1",36,0,0,v4_Dotf
+.globl v4_Dotf
+	.type	v4_Dotf,@function
+v4_Dotf:
+.stabn 68,0,76,.LMa181-v4_Dotf
+.LMa181:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,76,.LMb181-v4_Dotf
+.LMb181:
+.LBB39:
+	call v4_Dot
+	call v4_cr
+	call v4___Dotarena
+.LBE39:
+.stabn 68,0,76,.LM186-v4_Dotf
+.LM186:
+	pop %ebx
+	leave
+	ret
+.Lfe39:
+	.size	 v4_Dotf,.Lfe39-v4_Dotf
+.stabn	192,0,0,.LBB39-v4_Dotf
+.stabn	224,0,0,.LBE39-v4_Dotf
+.Lscope39:
+.stabs	"",36,0,0,.Lscope39-v4_Dotf
+.text
+	.align 4
+.stabs "v4_pi:F1",36,0,0,v4_pi
+.globl v4_pi
+	.type	v4_pi,@function
+v4_pi:
+.stabn 68,0,88,.LMa187-v4_pi
+.LMa187:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,88,.LMb187-v4_pi
+.LMb187:
+.LBB45:
+.stabn 68,0,89,.LM188-v4_pi
+.LM188:
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %eax,%edx
+	je .L24
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L25:
+	call v4_fdup
+	call v4_fsin
+	call v4_f_Plus
+	xchg %edx,%eax
+	call v4__rpop
+	xchg %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	test %edx,%edx
+	jne .L25
+	call v4__rpop
+	call v4__rpop
+.L24:
+.LBE45:
+.stabn 68,0,89,.LM211-v4_pi
+.LM211:
+	pop %ebx
+	leave
+	ret
+.Lfe45:
+	.size	 v4_pi,.Lfe45-v4_pi
+.stabn	192,0,0,.LBB45-v4_pi
+.stabn	224,0,0,.LBE45-v4_pi
+.Lscope45:
+.stabs	"",36,0,0,.Lscope45-v4_pi
+.text
+	.align 4
+.stabs "v4_Dotc:F1",36,0,0,v4_Dotc
+.globl v4_Dotc
+	.type	v4_Dotc,@function
+v4_Dotc:
+.stabn 68,0,92,.LMa212-v4_Dotc
+.LMa212:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,92,.LMb212-v4_Dotc
+.LMb212:
+.LBB52:
+.stabn 68,0,93,.LM213-v4_Dotc
+.LM213:
+	lea .LC39,%eax
+	call v4__dpush
+	mov $7,%eax
+	call v4__dpush
+	call v4__type
+	call v4_z2dup
+	call v4_type
+	lea .LC40,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Greaterfloat
+.stabn 68,0,94,.LM226-v4_Dotc
+.LM226:
+	call v4__dpop
+	test %eax,%eax
+	je .L28
+	call v4_fdup
+	call v4_fdup
+	call v4_f_Dot
+	call v4_fs_Dot
+	call v4_fe_Dot
+	jmp .L29
+.L28:
+	lea .LC41,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4__type
+.L29:
+.LBE52:
+.stabn 68,0,94,.LM242-v4_Dotc
+.LM242:
+	pop %ebx
+	leave
+	ret
+.Lfe52:
+	.size	 v4_Dotc,.Lfe52-v4_Dotc
+.stabn	192,0,0,.LBB52-v4_Dotc
+.stabn	224,0,0,.LBE52-v4_Dotc
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4_Dotc
+.text
+	.align 4
+.stabs "v4_sfib:F1",36,0,0,v4_sfib
+.globl v4_sfib
+	.type	v4_sfib,@function
+v4_sfib:
+.stabn 68,0,103,.LMa243-v4_sfib
+.LMa243:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,103,.LMb243-v4_sfib
+.LMb243:
+.LBB57:
+	call v4_dup
+	call v4_z0_Less
+	call v4__dpop
+	test %eax,%eax
+	je .L31
+	mov $-24,%eax
+	call v4__dpush
+	call v4_throw
+.L31:
+	call v4_fib
+.LBE57:
+.stabn 68,0,103,.LM254-v4_sfib
+.LM254:
+	pop %ebx
+	leave
+	ret
+.Lfe57:
+	.size	 v4_sfib,.Lfe57-v4_sfib
+.stabn	192,0,0,.LBB57-v4_sfib
+.stabn	224,0,0,.LBE57-v4_sfib
+.Lscope57:
+.stabs	"",36,0,0,.Lscope57-v4_sfib
+.text
+	.align 4
+.stabs "v4_z1try:F1",36,0,0,v4_z1try
+.globl v4_z1try
+	.type	v4_z1try,@function
+v4_z1try:
+.stabn 68,0,104,.LMa255-v4_z1try
+.LMa255:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,104,.LMb255-v4_z1try
+.LMb255:
+.LBB60:
+	call v4_catch
+	call v4_Questiondup
+	call v4__dpop
+	test %eax,%eax
+	je .L33
+	lea .LC49,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+	call v4_drop
+	jmp .L34
+.L33:
+	lea .LC50,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+.L34:
+.LBE60:
+.stabn 68,0,104,.LM277-v4_z1try
+.LM277:
+	pop %ebx
+	leave
+	ret
+.Lfe60:
+	.size	 v4_z1try,.Lfe60-v4_z1try
+.stabn	192,0,0,.LBB60-v4_z1try
+.stabn	224,0,0,.LBE60-v4_z1try
+.Lscope60:
+.stabs	"",36,0,0,.Lscope60-v4_z1try
+.text
+	.align 4
+.stabs "v4_aborts:F1",36,0,0,v4_aborts
+.globl v4_aborts
+	.type	v4_aborts,@function
+v4_aborts:
+.stabn 68,0,108,.LMa278-v4_aborts
+.LMa278:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,108,.LMb278-v4_aborts
+.LMb278:
+.LBB63:
+	xor %eax,%eax
+	inc %eax
+	test %eax,%eax
+	je .L36
+	lea .LC53,%eax
+	call v4__dpush
+	mov $13,%eax
+	call v4__dpush
+	call v4__abortquote
+.L36:
+.LBE63:
+.stabn 68,0,108,.LM290-v4_aborts
+.LM290:
+	pop %ebx
+	leave
+	ret
+.Lfe63:
+	.size	 v4_aborts,.Lfe63-v4_aborts
+.stabn	192,0,0,.LBB63-v4_aborts
+.stabn	224,0,0,.LBE63-v4_aborts
+.Lscope63:
+.stabs	"",36,0,0,.Lscope63-v4_aborts
+.text
+	.align 4
+.stabs "v4_overflow:F1",36,0,0,v4_overflow
+.globl v4_overflow
+	.type	v4_overflow,@function
+v4_overflow:
+.stabn 68,0,109,.LMa291-v4_overflow
+.LMa291:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,109,.LMb291-v4_overflow
+.LMb291:
+.LBB65:
+.L38:
+	xor %eax,%eax
+	call v4__dpush
+	jmp .L38
+.LBE65:
+.stabn 68,0,109,.LM298-v4_overflow
+.LM298:
+	pop %ebx
+	leave
+	ret
+.Lfe65:
+	.size	 v4_overflow,.Lfe65-v4_overflow
+.stabn	192,0,0,.LBB65-v4_overflow
+.stabn	224,0,0,.LBE65-v4_overflow
+.Lscope65:
+.stabs	"",36,0,0,.Lscope65-v4_overflow
+.text
+	.align 4
+.stabs "v4_try:F1",36,0,0,v4_try
+.globl v4_try
+	.type	v4_try,@function
+v4_try:
+.stabn 68,0,110,.LMa299-v4_try
+.LMa299:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,110,.LMb299-v4_try
+.LMb299:
+.LBB66:
+	call v4_catch
+	lea .LC54,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+.LBE66:
+.stabn 68,0,110,.LM308-v4_try
+.LM308:
+	pop %ebx
+	leave
+	ret
+.Lfe66:
+	.size	 v4_try,.Lfe66-v4_try
+.stabn	192,0,0,.LBB66-v4_try
+.stabn	224,0,0,.LBE66-v4_try
+.Lscope66:
+.stabs	"",36,0,0,.Lscope66-v4_try
+.text
+	.align 4
+.stabs "v4_Dotallchars:F1",36,0,0,v4_Dotallchars
+.globl v4_Dotallchars
+	.type	v4_Dotallchars,@function
+v4_Dotallchars:
+.stabn 68,0,135,.LMa309-v4_Dotallchars
+.LMa309:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,135,.LMb309-v4_Dotallchars
+.LMb309:
+.LBB79:
+	call v4_z1_Plus
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %eax,%edx
+	je .L42
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L43:
+	call v4_dup
+	call v4_i
+	call v4_chars
+	call v4_Plus
+	call v4_c_Fetch
+	call v4_Dot
+	xchg %edx,%eax
+	call v4__rpop
+	xchg %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	test %edx,%edx
+	jne .L43
+	call v4__rpop
+	call v4__rpop
+.L42:
+.LBE79:
+.stabn 68,0,135,.LM337-v4_Dotallchars
+.LM337:
+	pop %ebx
+	leave
+	ret
+.Lfe79:
+	.size	 v4_Dotallchars,.Lfe79-v4_Dotallchars
+.stabn	192,0,0,.LBB79-v4_Dotallchars
+.stabn	224,0,0,.LBE79-v4_Dotallchars
+.Lscope79:
+.stabs	"",36,0,0,.Lscope79-v4_Dotallchars
+.text
+	.align 4
+.stabs "v4_myvar:F1",36,0,0,v4_myvar
+.globl v4_myvar
+	.type	v4_myvar,@function
+v4_myvar:
+.stabn 68,0,145,.LMa338-v4_myvar
+.LMa338:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,145,.LMb338-v4_myvar
+.LMb338:
+.LBB85:
+.stabn 68,0,146,.LM339-v4_myvar
+.LM339:
+	lea v4__imyvar,%eax
+	call v4__dpush
+	call v4_Fetch
+	call v4_z0_Equals
+	call v4__dpop
+	test %eax,%eax
+	je .L46
+.stabn 68,0,147,.LM345-v4_myvar
+.LM345:
+	mov $12345,%eax
+	call v4__dpush
+	lea v4__vmyvar,%eax
+	call v4__dpush
+	call v4_Store
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	lea v4__imyvar,%eax
+	call v4__dpush
+	call v4_Store
+.L46:
+	lea v4__vmyvar,%eax
+	call v4__dpush
+.LBE85:
+.stabn 68,0,149,.LM360-v4_myvar
+.LM360:
+	pop %ebx
+	leave
+	ret
+.Lfe85:
+	.size	 v4_myvar,.Lfe85-v4_myvar
+.stabn	192,0,0,.LBB85-v4_myvar
+.stabn	224,0,0,.LBE85-v4_myvar
+.Lscope85:
+.stabs	"",36,0,0,.Lscope85-v4_myvar
+.text
+	.align 4
+.stabs "v4_fakevar:F1",36,0,0,v4_fakevar
+.globl v4_fakevar
+	.type	v4_fakevar,@function
+v4_fakevar:
+.stabn 68,0,174,.LMa361-v4_fakevar
+.LMa361:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,174,.LMb361-v4_fakevar
+.LMb361:
+.LBB92:
+	lea v4_realvar,%eax
+	call v4__dpush
+.LBE92:
+.stabn 68,0,174,.LM365-v4_fakevar
+.LM365:
+	pop %ebx
+	leave
+	ret
+.Lfe92:
+	.size	 v4_fakevar,.Lfe92-v4_fakevar
+.stabn	192,0,0,.LBB92-v4_fakevar
+.stabn	224,0,0,.LBE92-v4_fakevar
+.Lscope92:
+.stabs	"",36,0,0,.Lscope92-v4_fakevar
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,8,.LMa366-main
+.LMa366:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,8,.LMb366-main
+.LMb366:
+.LBB1:
+	lea .LC0,%eax
+	call v4__dpush
+	mov $31,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,9,.LM373-main
+.LM373:
+	lea .LC1,%eax
+	call v4__dpush
+	mov $33,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,13,.LM379-main
+.LM379:
+	lea .LC2,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,14,.LM384-main
+.LM384:
+	mov $-1431655766,%eax
+	call v4__dpush
+	call v4_Dot
+	mov $1431655765,%eax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,15,.LM391-main
+.LM391:
+	lea .LC3,%eax
+	call v4__dpush
+	mov $21,%eax
+	call v4__dpush
+	call v4__type
+	mov $1431655765,%eax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,16,.LM400-main
+.LM400:
+	lea .LC4,%eax
+	call v4__dpush
+	mov $34,%eax
+	call v4__dpush
+	call v4__type
+	mov $-252645136,%eax
+	call v4__dpush
+	call v4_Dot
+	mov $252645135,%eax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,17,.LM412-main
+.LM412:
+	lea .LC5,%eax
+	call v4__dpush
+	mov $22,%eax
+	call v4__dpush
+	call v4__type
+	mov $252645135,%eax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,18,.LM421-main
+.LM421:
+	lea .LC6,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	call v4__type
+	mov $342391,%eax
+	call v4__dpush
+	call v4_Dot
+	mov $342391,%eax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,19,.LM433-main
+.LM433:
+	lea .LC7,%eax
+	call v4__dpush
+	mov $31,%eax
+	call v4__dpush
+	call v4__type
+	mov $123,%eax
+	call v4__dpush
+	call v4_Dot
+	mov $123,%eax
+	call v4__dpush
+	call v4_Dot
+	mov $123,%eax
+	call v4__dpush
+	call v4_Dot
+	mov $123,%eax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,24,.LM451-main
+.LM451:
+	lea .LC9,%eax
+	call v4__dpush
+	mov $13,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,23,.LM457-main
+.LM457:
+	lea .LC8,%eax
+	call v4__dpush
+	mov $21,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,24,.LM462-main
+.LM462:
+	call v4_cr
+.stabn 68,0,25,.LM463-main
+.LM463:
+	lea .LC10,%eax
+	call v4__dpush
+	mov $20,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,23,.LM469-main
+.LM469:
+	lea .LC8,%eax
+	call v4__dpush
+	mov $21,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,25,.LM474-main
+.LM474:
+	call v4_cr
+.stabn 68,0,26,.LM475-main
+.LM475:
+	lea .LC11,%eax
+	call v4__dpush
+	mov $20,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,23,.LM481-main
+.LM481:
+	lea .LC8,%eax
+	call v4__dpush
+	mov $21,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,26,.LM486-main
+.LM486:
+	call v4_cr
+.stabn 68,0,27,.LM487-main
+.LM487:
+	lea .LC12,%eax
+	call v4__dpush
+	mov $16,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,23,.LM493-main
+.LM493:
+	lea .LC8,%eax
+	call v4__dpush
+	mov $21,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,27,.LM498-main
+.LM498:
+	call v4_cr
+.stabn 68,0,29,.LM499-main
+.LM499:
+	lea .LC14,%eax
+	call v4__dpush
+	mov $21,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,28,.LM505-main
+.LM505:
+	lea .LC13,%eax
+	call v4__dpush
+	mov $22,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,29,.LM510-main
+.LM510:
+	call v4_cr
+.stabn 68,0,34,.LM511-main
+.LM511:
+	lea .LC15,%eax
+	call v4__dpush
+	mov $20,%eax
+	call v4__dpush
+	call v4__type
+	lea .LC16,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	call v4_Dot
+.stabn 68,0,33,.LM522-main
+.LM522:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,34,.LM530-main
+.LM530:
+	call v4_cr
+.stabn 68,0,35,.LM531-main
+.LM531:
+	lea .LC17,%eax
+	call v4__dpush
+	mov $26,%eax
+	call v4__dpush
+	call v4__type
+	lea .LC18,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	call v4_Dot
+.stabn 68,0,33,.LM542-main
+.LM542:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,35,.LM550-main
+.LM550:
+	call v4_cr
+.stabn 68,0,36,.LM551-main
+.LM551:
+	lea .LC19,%eax
+	call v4__dpush
+	mov $20,%eax
+	call v4__dpush
+	call v4__type
+	lea .LC20,%eax
+	call v4__dpush
+.stabn 68,0,33,.LM559-main
+.LM559:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,36,.LM567-main
+.LM567:
+	call v4_cr
+.stabn 68,0,37,.LM568-main
+.LM568:
+	lea .LC21,%eax
+	call v4__dpush
+	mov $26,%eax
+	call v4__dpush
+	call v4__type
+	lea .LC22,%eax
+	call v4__dpush
+.stabn 68,0,33,.LM576-main
+.LM576:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,37,.LM584-main
+.LM584:
+	call v4_cr
+.stabn 68,0,42,.LM585-main
+.LM585:
+	lea .LC23,%eax
+	call v4__dpush
+	mov $11,%eax
+	call v4__dpush
+	call v4__type
+	mov $20,%eax
+	call v4__dpush
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L7:
+	call v4_i
+	call v4_fib
+	call v4_Dot
+	xchg %edx,%eax
+	call v4__rpop
+	xchg %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	test %edx,%edx
+	jne .L7
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,46,.LM614-main
+.LM614:
+	lea v4_20,%eax
+	call v4__dpush
+	call v4_execute
+.stabn 68,0,47,.LM617-main
+.LM617:
+	lea v4_22,%eax
+	call v4__dpush
+	call v4_execute
+.stabn 68,0,60,.LM620-main
+.LM620:
+	lea v4_29,%eax
+	call v4__dpush
+	lea v4_am,%eax
+	call v4__dpush
+	call v4_Store
+.stabn 68,0,63,.LM625-main
+.LM625:
+	lea .LC26,%eax
+	call v4__dpush
+	mov $18,%eax
+	call v4__dpush
+	call v4__type
+	lea v4_m,%eax
+	call v4__dpush
+	mov $20,%eax
+	call v4__dpush
+	call v4_run
+.stabn 68,0,64,.LM635-main
+.LM635:
+	lea .LC27,%eax
+	call v4__dpush
+	mov $18,%eax
+	call v4__dpush
+	call v4__type
+	lea v4_f,%eax
+	call v4__dpush
+	mov $20,%eax
+	call v4__dpush
+	call v4_run
+.stabn 68,0,69,.LM645-main
+.LM645:
+	lea v4_clock,%eax
+	call v4__dpush
+	call v4__time
+	call v4_drop
+.stabn 68,0,70,.LM649-main
+.LM649:
+	lea .LC28,%eax
+	call v4__dpush
+	mov $9,%eax
+	call v4__dpush
+	call v4__type
+	lea v4_clock,%eax
+	call v4__dpush
+	call v4_Fetch
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,77,.LM659-main
+.LM659:
+	lea .LC31,%eax
+	call v4__dpush
+	mov $19,%eax
+	call v4__dpush
+	call v4__type
+	mov $23,%eax
+	call v4__dpush
+	call v4_allocate
+.stabn 68,0,75,.LM668-main
+.LM668:
+	call v4_Dot
+	lea .LC30,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dotalloc
+	call v4_cr
+	call v4___Dotarena
+.stabn 68,0,78,.LM677-main
+.LM677:
+	lea .LC32,%eax
+	call v4__dpush
+	mov $19,%eax
+	call v4__dpush
+	call v4__type
+	mov $9,%eax
+	call v4__dpush
+	call v4_resize
+.stabn 68,0,75,.LM686-main
+.LM686:
+	call v4_Dot
+	lea .LC30,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dotalloc
+	call v4_cr
+	call v4___Dotarena
+.stabn 68,0,79,.LM695-main
+.LM695:
+	lea .LC33,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4__type
+	call v4_free
+.stabn 68,0,76,.LM702-main
+.LM702:
+	call v4_Dot
+	call v4_cr
+	call v4___Dotarena
+.stabn 68,0,80,.LM705-main
+.LM705:
+	lea .LC34,%eax
+	call v4__dpush
+	mov $18,%eax
+	call v4__dpush
+	call v4__type
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_allocate
+.stabn 68,0,75,.LM714-main
+.LM714:
+	call v4_Dot
+	lea .LC30,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dotalloc
+	call v4_cr
+	call v4___Dotarena
+.stabn 68,0,81,.LM723-main
+.LM723:
+	lea .LC35,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4__type
+	call v4_free
+.stabn 68,0,76,.LM730-main
+.LM730:
+	call v4_Dot
+	call v4_cr
+	call v4___Dotarena
+.stabn 68,0,82,.LM733-main
+.LM733:
+	call v4__arena
+	call v4__allocdefrag
+	call v4___Dotarena
+.stabn 68,0,83,.LM736-main
+.LM736:
+	lea .LC36,%eax
+	call v4__dpush
+	mov $16,%eax
+	call v4__dpush
+	call v4__type
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_resize
+	call v4_Dot
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,84,.LM749-main
+.LM749:
+	lea .LC37,%eax
+	call v4__dpush
+	mov $14,%eax
+	call v4__dpush
+	call v4__type
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_free
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,90,.LM759-main
+.LM759:
+	lea .LC38,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4__type
+	mov $100,%eax
+	call v4__dpush
+	mov $1077936128,%eax
+	call v4__fpush
+	call v4_pi
+	call v4_fdup
+	call v4_fdup
+	call v4_f_Dot
+	call v4_fs_Dot
+	call v4_fe_Dot
+	call v4_cr
+.stabn 68,0,95,.LM775-main
+.LM775:
+	lea .LC42,%eax
+	call v4__dpush
+	mov $9,%eax
+	call v4__dpush
+	call v4_Dotc
+	call v4_cr
+	lea .LC43,%eax
+	call v4__dpush
+	mov $11,%eax
+	call v4__dpush
+	call v4_Dotc
+	call v4_cr
+.stabn 68,0,96,.LM787-main
+.LM787:
+	lea .LC44,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_Dotc
+	call v4_cr
+	lea .LC45,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_Dotc
+	call v4_cr
+.stabn 68,0,97,.LM799-main
+.LM799:
+	lea .LC46,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_Dotc
+	call v4_cr
+	lea .LC47,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_Dotc
+	call v4_cr
+.stabn 68,0,99,.LM811-main
+.LM811:
+	lea .LC48,%eax
+	call v4__dpush
+	mov $23,%eax
+	call v4__dpush
+	call v4__type
+	mov $-1082130432,%eax
+	call v4__fpush
+	call v4_fsqrt
+	call v4_fdup
+	call v4_fdup
+	call v4_f_Dot
+	call v4_fs_Dot
+	call v4_fe_Dot
+	call v4_cr
+.stabn 68,0,105,.LM825-main
+.LM825:
+	lea .LC51,%eax
+	call v4__dpush
+	mov $14,%eax
+	call v4__dpush
+	call v4__type
+	mov $-10,%eax
+	call v4__dpush
+	lea v4_sfib,%eax
+	call v4__dpush
+	call v4_z1try
+	call v4_cr
+.stabn 68,0,106,.LM836-main
+.LM836:
+	lea .LC52,%eax
+	call v4__dpush
+	mov $14,%eax
+	call v4__dpush
+	call v4__type
+	mov $10,%eax
+	call v4__dpush
+	lea v4_sfib,%eax
+	call v4__dpush
+	call v4_z1try
+	call v4_cr
+.stabn 68,0,111,.LM847-main
+.LM847:
+	lea .LC55,%eax
+	call v4__dpush
+	mov $12,%eax
+	call v4__dpush
+	call v4__type
+	lea v4_abort,%eax
+	call v4__dpush
+.stabn 68,0,110,.LM855-main
+.LM855:
+	call v4_catch
+	lea .LC54,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+.stabn 68,0,111,.LM862-main
+.LM862:
+	lea .LC56,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4__type
+	lea v4_quit,%eax
+	call v4__dpush
+.stabn 68,0,110,.LM870-main
+.LM870:
+	call v4_catch
+	lea .LC54,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+.stabn 68,0,111,.LM877-main
+.LM877:
+	call v4_cr
+.stabn 68,0,112,.LM878-main
+.LM878:
+	lea .LC57,%eax
+	call v4__dpush
+	mov $12,%eax
+	call v4__dpush
+	call v4__type
+	lea v4_aborts,%eax
+	call v4__dpush
+.stabn 68,0,110,.LM886-main
+.LM886:
+	call v4_catch
+	lea .LC54,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+.stabn 68,0,112,.LM893-main
+.LM893:
+	call v4_cr
+.stabn 68,0,113,.LM894-main
+.LM894:
+	lea .LC58,%eax
+	call v4__dpush
+	mov $16,%eax
+	call v4__dpush
+	call v4__type
+	lea v4_drop,%eax
+	call v4__dpush
+.stabn 68,0,110,.LM902-main
+.LM902:
+	call v4_catch
+	lea .LC54,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+.stabn 68,0,113,.LM909-main
+.LM909:
+	call v4_cr
+.stabn 68,0,114,.LM910-main
+.LM910:
+	lea .LC59,%eax
+	call v4__dpush
+	mov $15,%eax
+	call v4__dpush
+	call v4__type
+	lea v4_overflow,%eax
+	call v4__dpush
+.stabn 68,0,110,.LM918-main
+.LM918:
+	call v4_catch
+	lea .LC54,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+.stabn 68,0,114,.LM925-main
+.LM925:
+	call v4_cr
+.stabn 68,0,115,.LM926-main
+.LM926:
+	lea .LC60,%eax
+	call v4__dpush
+	mov $14,%eax
+	call v4__dpush
+	call v4__type
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	lea v4_Slash,%eax
+	call v4__dpush
+.stabn 68,0,110,.LM938-main
+.LM938:
+	call v4_catch
+	lea .LC54,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+.stabn 68,0,115,.LM945-main
+.LM945:
+	call v4_z2drop
+	call v4_cr
+.stabn 68,0,116,.LM947-main
+.LM947:
+	lea .LC61,%eax
+	call v4__dpush
+	mov $15,%eax
+	call v4__dpush
+	call v4__type
+	mov $1065353216,%eax
+	call v4__fpush
+	xor %eax,%eax
+	call v4__fpush
+	lea v4_f_Slash,%eax
+	call v4__dpush
+.stabn 68,0,110,.LM959-main
+.LM959:
+	call v4_catch
+	lea .LC54,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+.stabn 68,0,116,.LM966-main
+.LM966:
+	call v4_fdrop
+	call v4_fdrop
+	call v4_cr
+.stabn 68,0,120,.LM969-main
+.LM969:
+	lea .LC62,%eax
+	call v4__dpush
+	mov $9,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+	lea .LC63,%eax
+	call v4__dpush
+	call v4_strlen
+	call v4_z1_Plus
+	call v4_dump
+.stabn 68,0,121,.LM980-main
+.LM980:
+	lea .LC64,%eax
+	call v4__dpush
+	mov $18,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+	lea v4_dump,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	call v4_dump
+.stabn 68,0,122,.LM991-main
+.LM991:
+	lea .LC65,%eax
+	call v4__dpush
+	mov $8,%eax
+	call v4__dpush
+	call v4__type
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_Dots
+	call v4_cr
+.stabn 68,0,123,.LM1004-main
+.LM1004:
+	lea .LC66,%eax
+	call v4__dpush
+	mov $14,%eax
+	call v4__dpush
+	call v4__type
+	call v4_sp0
+	call v4_Question
+	call v4_cr
+.stabn 68,0,124,.LM1012-main
+.LM1012:
+	call v4_drop
+	call v4_z2drop
+.stabn 68,0,128,.LM1014-main
+.LM1014:
+	xor %eax,%eax
+	mov %eax,(v4_zero)
+.stabn 68,0,129,.LM1018-main
+.LM1018:
+	lea .LC67,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	call v4__type
+	mov (v4_zero),%eax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,130,.LM1027-main
+.LM1027:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	lea v4_zero,%eax
+	call v4__dpush
+	call v4_Store
+.stabn 68,0,131,.LM1032-main
+.LM1032:
+	lea .LC68,%eax
+	call v4__dpush
+	mov $21,%eax
+	call v4__dpush
+	call v4__type
+	mov (v4_zero),%eax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,136,.LM1041-main
+.LM1041:
+	lea .LC69,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	call v4__type
+	lea .LC70,%eax
+	call v4__dpush
+	call v4_count
+	call v4_Dotallchars
+	call v4_cr
+	call v4_drop
+.stabn 68,0,137,.LM1052-main
+.LM1052:
+	lea .LC71,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	call v4__type
+	lea .LC72,%eax
+	call v4__dpush
+	mov $7,%eax
+	call v4__dpush
+	call v4_Dotallchars
+	call v4_cr
+	call v4_drop
+.stabn 68,0,144,.LM1064-main
+.LM1064:
+	lea .LC73,%eax
+	call v4__dpush
+	mov $24,%eax
+	call v4__dpush
+	call v4__type
+	lea v4__vmyvar,%eax
+	call v4__dpush
+	call v4_Fetch
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,151,.LM1074-main
+.LM1074:
+	lea .LC74,%eax
+	call v4__dpush
+	mov $9,%eax
+	call v4__dpush
+	call v4__type
+	call v4_myvar
+	call v4_Fetch
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,152,.LM1083-main
+.LM1083:
+	mov $54321,%eax
+	call v4__dpush
+	call v4_myvar
+	call v4_Store
+.stabn 68,0,153,.LM1087-main
+.LM1087:
+	lea .LC75,%eax
+	call v4__dpush
+	mov $13,%eax
+	call v4__dpush
+	call v4__type
+	call v4_myvar
+	call v4_Fetch
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,160,.LM1096-main
+.LM1096:
+	call v4__dpush
+.stabn 68,0,161,.LM1097-main
+.LM1097:
+	lea .LC76,%eax
+	call v4__dpush
+	mov $34,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,167,.LM1104-main
+.LM1104:
+	lea v4__argc,%eax
+	call v4__dpush
+	call v4_Fetch
+	lea .LC77,%eax
+	call v4__dpush
+	mov $16,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,168,.LM1114-main
+.LM1114:
+	lea v4__argv,%eax
+	call v4__dpush
+	call v4_Fetch
+	lea .LC78,%eax
+	call v4__dpush
+	mov $16,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,33,.LM1123-main
+.LM1123:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,168,.LM1131-main
+.LM1131:
+	call v4_cr
+.stabn 68,0,169,.LM1132-main
+.LM1132:
+	lea v4__envp,%eax
+	call v4__dpush
+	call v4_Fetch
+	lea .LC79,%eax
+	call v4__dpush
+	mov $16,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,33,.LM1141-main
+.LM1141:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,169,.LM1149-main
+.LM1149:
+	call v4_cr
+.stabn 68,0,175,.LM1150-main
+.LM1150:
+	mov $-99,%eax
+	call v4__dpush
+.stabn 68,0,174,.LM1153-main
+.LM1153:
+	lea v4_realvar,%eax
+	call v4__dpush
+.stabn 68,0,175,.LM1155-main
+.LM1155:
+	call v4_Store
+.stabn 68,0,174,.LM1157-main
+.LM1157:
+	lea v4_realvar,%eax
+	call v4__dpush
+.stabn 68,0,175,.LM1159-main
+.LM1159:
+	call v4_Fetch
+.stabn 68,0,177,.LM1160-main
+.LM1160:
+	lea .LC80,%eax
+	call v4__dpush
+	mov $20,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,178,.LM1167-main
+.LM1167:
+	lea v4_realvar,%eax
+	call v4__dpush
+	lea .LC81,%eax
+	call v4__dpush
+	mov $19,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,33,.LM1175-main
+.LM1175:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,178,.LM1183-main
+.LM1183:
+	call v4_cr
+.stabn 68,0,174,.LM1185-main
+.LM1185:
+	lea v4_realvar,%eax
+	call v4__dpush
+.stabn 68,0,179,.LM1187-main
+.LM1187:
+	lea .LC82,%eax
+	call v4__dpush
+	mov $19,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,33,.LM1193-main
+.LM1193:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,179,.LM1201-main
+.LM1201:
+	call v4_cr
+.stabn 68,0,180,.LM1202-main
+.LM1202:
+	lea v4_realvar,%eax
+	call v4__dpush
+	lea .LC83,%eax
+	call v4__dpush
+	mov $21,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,33,.LM1210-main
+.LM1210:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,180,.LM1218-main
+.LM1218:
+	call v4_cr
+.stabn 68,0,181,.LM1219-main
+.LM1219:
+	lea v4_fakevar,%eax
+	call v4__dpush
+	lea .LC84,%eax
+	call v4__dpush
+	mov $21,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,33,.LM1227-main
+.LM1227:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_Dot
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,181,.LM1235-main
+.LM1235:
+	call v4_cr
+.stabn 68,0,185,.LM1236-main
+.LM1236:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+.stabn 68,0,186,.LM1246-main
+.LM1246:
+	mov $-99,%eax
+	call v4__dpush
+	lea v4__dstack,%eax
+	call v4__dpush
+	call v4_Store
+.stabn 68,0,187,.LM1251-main
+.LM1251:
+	lea .LC85,%eax
+	call v4__dpush
+	mov $9,%eax
+	call v4__dpush
+	call v4__type
+	call v4_Dot
+	call v4_Dot
+	call v4_Dot
+	call v4_Dot
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,191,.LM1262-main
+.LM1262:
+	call v4_depth
+	call v4_z0_Equals
+	call v4_rdepth
+	call v4_z0_Equals
+	call v4_and
+	call v4_fdepth
+	call v4_z0_Equals
+	call v4_and
+.stabn 68,0,192,.LM1270-main
+.LM1270:
+	call v4_invert
+	call v4_drop
+.LBE1:
+.stabn 68,0,192,.LM1273-main
+.LM1273:
+	pop %ebx
+	leave
+	ret
+.Lfe1:
+	.size	 main,.Lfe1-main
+.stabn	192,0,0,.LBB1-main
+.stabn	224,0,0,.LBE1-main
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 06:53:37, Linux"
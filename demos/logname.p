@@ -0,0 +1,67 @@
+VNPForth 1.5 [build x86_64/20261017065336]
+Source: logname.ft
+Compiled: Sat Oct 17 06:53:57 2026
+Flags: debug optimize intermediate assembly
+
+Data:
+    20 Data_0 string[4] "%s\n"
+
+Symbols:
+    13 Sym_5 external "geteuid"
+    14 Sym_6 external "getpwuid"
+    20 Sym_8 word "main"
+     9 Sym_1 external "printf"
+    16 Sym_7 external "v4_Fetch"
+     9 Sym_2 external "v4_cexecute"
+     9 Sym_3 external "v4_drop"
+    12 Sym_4 word "v4_getlogin"
+     8 Sym_0 word "v4_printf"
+
+Intermediate code:
+     8 function Sym_0 {
+     9   Reg_0 = Sym_1
+     9   Stack_D = Reg_0
+     9   call Sym_2
+     9   call Sym_3
+     9   no-op
+           optimizes label Label_1
+     9 }
+
+    12 function Sym_4 {
+    13   Reg_0 = 0
+    13   Stack_D = Reg_0
+    13   Reg_0 = Sym_5
+    13   Stack_D = Reg_0
+    13   call Sym_2
+    14   Reg_0 = 1
+    14   Stack_D = Reg_0
+    14   Reg_0 = Sym_6
+    14   Stack_D = Reg_0
+    14   call Sym_2
+    16   call Sym_7
+    16   no-op
+           optimizes label Label_2
+    16 }
+
+    20 function Sym_8 {
+    20   Reg_0 = Data_0
+    20   Stack_D = Reg_0
+    20   Reg_0 = 4
+    20   Stack_D = Reg_0
+    20   call Sym_3
+    20   call Sym_4
+    21   Reg_0 = 2
+    21   Stack_D = Reg_0
+    21   no-op
+           optimizes   call Sym_0
+     9   Reg_0 = Sym_1
+     9   Stack_D = Reg_0
+     9   call Sym_2
+     9   call Sym_3
+    23   Reg_0 = 0
+    23   Stack_D = Reg_0
+    23   call Sym_3
+    23   no-op
+           optimizes label Label_0
+    23 }
+
@@ -0,0 +1,148 @@
+	.file	"logname.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/demos/",100,0,0,Ltext0
+.stabs	"logname.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC0:
+	.string "%s\n"
+.text
+	.align 4
+.stabs "v4_printf:F1",36,0,0,v4_printf
+.globl v4_printf
+	.type	v4_printf,@function
+v4_printf:
+.stabn 68,0,8,.LMa0-v4_printf
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,8,.LMb0-v4_printf
+.LMb0:
+.LBB0:
+.stabn 68,0,9,.LM1-v4_printf
+.LM1:
+	lea printf,%eax
+	call v4__dpush
+	call v4_cexecute
+	call v4_drop
+.LBE0:
+.stabn 68,0,9,.LM6-v4_printf
+.LM6:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_printf,.Lfe0-v4_printf
+.stabn	192,0,0,.LBB0-v4_printf
+.stabn	224,0,0,.LBE0-v4_printf
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_printf
+.text
+	.align 4
+.stabs "v4_getlogin:F1",36,0,0,v4_getlogin
+.globl v4_getlogin
+	.type	v4_getlogin,@function
+v4_getlogin:
+.stabn 68,0,12,.LMa7-v4_getlogin
+.LMa7:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,12,.LMb7-v4_getlogin
+.LMb7:
+.LBB4:
+.stabn 68,0,13,.LM8-v4_getlogin
+.LM8:
+	xor %eax,%eax
+	call v4__dpush
+	lea geteuid,%eax
+	call v4__dpush
+	call v4_cexecute
+.stabn 68,0,14,.LM13-v4_getlogin
+.LM13:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	lea getpwuid,%eax
+	call v4__dpush
+	call v4_cexecute
+.stabn 68,0,16,.LM18-v4_getlogin
+.LM18:
+	call v4_Fetch
+.LBE4:
+.stabn 68,0,16,.LM20-v4_getlogin
+.LM20:
+	pop %ebx
+	leave
+	ret
+.Lfe4:
+	.size	 v4_getlogin,.Lfe4-v4_getlogin
+.stabn	192,0,0,.LBB4-v4_getlogin
+.stabn	224,0,0,.LBE4-v4_getlogin
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4_getlogin
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,20,.LMa21-main
+.LMa21:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,20,.LMb21-main
+.LMb21:
+.LBB8:
+	lea .LC0,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_drop
+	call v4_getlogin
+.stabn 68,0,21,.LM28-main
+.LM28:
+	mov $2,%eax
+	call v4__dpush
+.stabn 68,0,9,.LM31-main
+.LM31:
+	lea printf,%eax
+	call v4__dpush
+	call v4_cexecute
+	call v4_drop
+.stabn 68,0,23,.LM35-main
+.LM35:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_drop
+.LBE8:
+.stabn 68,0,23,.LM39-main
+.LM39:
+	pop %ebx
+	leave
+	ret
+.Lfe8:
+	.size	 main,.Lfe8-main
+.stabn	192,0,0,.LBB8-main
+.stabn	224,0,0,.LBE8-main
+.Lscope8:
+.stabs	"",36,0,0,.Lscope8-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 06:53:37, Linux"
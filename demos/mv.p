@@ -0,0 +1,274 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: mv.ft
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug optimize intermediate assembly
+
+Data:
+    10 Data_1 string[19] " source destination"
+    17 Data_3 string[6] "--help"
+    30 Data_6 string[2] "->"
+    16 Data_2 string[2] "-h"
+    29 Data_5 string[2] ": "
+    39 Data_9 synonym Data_5
+    10 Data_0 string[7] "Usage: "
+    29 Data_4 string[4] "link"
+    35 Data_7 string[2] "mv"
+    39 Data_8 string[6] "unlink"
+
+Symbols:
+    15 Sym_5 word "main"
+    15 Sym_7 external "v4_Equals"
+    20 Sym_12 external "v4_Less_Greater"
+    35 Sym_17 external "v4_Minus"
+    35 Sym_16 external "v4_Plus"
+    18 Sym_11 external "v4__exit"
+    27 Sym_14 external "v4__link"
+    10 Sym_1 external "v4__type"
+    37 Sym_18 external "v4__unlink"
+    10 Sym_2 external "v4_arg"
+    15 Sym_6 external "v4_argc"
+    16 Sym_8 external "v4_compare"
+    10 Sym_4 external "v4_cr"
+    25 Sym_13 external "v4_drop"
+    17 Sym_10 external "v4_or"
+    29 Sym_15 external "v4_pperror"
+    10 Sym_3 external "v4_type"
+     9 Sym_0 word "v4_usage"
+    16 Sym_9 external "v4_z0_Equals"
+
+Intermediate code:
+     9 function Sym_0 {
+    10   Reg_0 = Data_0
+    10   Stack_D = Reg_0
+    10   Reg_0 = 7
+    10   Stack_D = Reg_0
+    10   call Sym_1
+    10   Reg_0 = 0
+    10   Stack_D = Reg_0
+    10   call Sym_2
+    10   call Sym_3
+    10   Reg_0 = Data_1
+    10   Stack_D = Reg_0
+    10   Reg_0 = 19
+    10   Stack_D = Reg_0
+    10   call Sym_1
+    10   tail call Sym_4
+           optimizes   call Sym_4
+    10   no-op
+           optimizes label Label_1
+    10 }
+
+    15 function Sym_5 {
+    15   call Sym_6
+    15   Reg_0 = 2
+    15   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    15   no-op
+           optimizes   call Sym_7
+    15   no-op
+           optimizes   Reg_1 = Stack_D
+    15   Reg_0 = Stack_D
+    15   if Reg_0 != Reg_1 goto Label_2
+    15   no-op
+           optimizes   Reg_0 = Stack_D
+    15   no-op
+           optimizes   if Reg_0 == 0 goto Label_2
+    16   Reg_0 = 1
+    16   Stack_D = Reg_0
+    16   call Sym_2
+    16   Reg_0 = Data_2
+    16   Stack_D = Reg_0
+    16   Reg_0 = 2
+    16   Stack_D = Reg_0
+    16   call Sym_8
+    16   no-op
+           optimizes   call Sym_9
+    16   Reg_0 = Stack_D
+    16   Reg_0 = Reg_0 == 0
+    16   Stack_D = Reg_0
+    17   Reg_0 = 1
+    17   Stack_D = Reg_0
+    17   call Sym_2
+    17   Reg_0 = Data_3
+    17   Stack_D = Reg_0
+    17   Reg_0 = 6
+    17   Stack_D = Reg_0
+    17   call Sym_8
+    17   no-op
+           optimizes   call Sym_9
+    17   Reg_0 = Stack_D
+    17   Reg_0 = Reg_0 == 0
+    17   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    17   no-op
+           optimizes   call Sym_10
+    17   no-op
+           optimizes   Reg_1 = Stack_D
+    17   Reg_0 = Stack_D
+    17   Reg_0 |= Reg_1
+    17   no-op
+           optimizes   Stack_D = Reg_0
+    17   no-op
+           optimizes   Reg_0 = Stack_D
+    17   if Reg_0 == 0 goto Label_3
+    18   call Sym_0
+    18   Reg_0 = 0
+    18   Stack_D = Reg_0
+    18   call Sym_11
+    19 label Label_3
+    19 label Label_2
+    20   call Sym_6
+    20   Reg_0 = 3
+    20   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    20   no-op
+           optimizes   call Sym_12
+    20   no-op
+           optimizes   Reg_1 = Stack_D
+    20   Reg_0 = Stack_D
+    20   if Reg_0 == Reg_1 goto Label_4
+    20   no-op
+           optimizes   Reg_0 = Stack_D
+    20   no-op
+           optimizes   if Reg_0 == 0 goto Label_4
+    21   call Sym_0
+    21   Reg_0 = 1
+    21   Stack_D = Reg_0
+    21   call Sym_11
+    22 label Label_4
+    25   Reg_0 = 2
+    25   Stack_D = Reg_0
+    25   call Sym_2
+    25   call Sym_13
+    26   Reg_0 = 1
+    26   Stack_D = Reg_0
+    26   call Sym_2
+    26   call Sym_13
+    27   call Sym_14
+    28   Reg_0 = -1
+    28   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    28   no-op
+           optimizes   call Sym_7
+    28   no-op
+           optimizes   Reg_1 = Stack_D
+    28   Reg_0 = Stack_D
+    28   if Reg_0 != Reg_1 goto Label_5
+    28   no-op
+           optimizes   Reg_0 = Stack_D
+    28   no-op
+           optimizes   if Reg_0 == 0 goto Label_5
+    29   Reg_0 = Data_4
+    29   Stack_D = Reg_0
+    29   Reg_0 = 4
+    29   Stack_D = Reg_0
+    29   call Sym_15
+    29   Reg_0 = Data_5
+    29   Stack_D = Reg_0
+    29   Reg_0 = 2
+    29   Stack_D = Reg_0
+    29   call Sym_1
+    30   Reg_0 = 1
+    30   Stack_D = Reg_0
+    30   call Sym_2
+    30   call Sym_3
+    30   Reg_0 = Data_6
+    30   Stack_D = Reg_0
+    30   Reg_0 = 2
+    30   Stack_D = Reg_0
+    30   call Sym_1
+    30   Reg_0 = 2
+    30   Stack_D = Reg_0
+    30   call Sym_2
+    30   call Sym_3
+    30   call Sym_4
+    31   Reg_0 = 1
+    31   Stack_D = Reg_0
+    31   call Sym_11
+    32 label Label_5
+    35   Reg_0 = 0
+    35   Stack_D = Reg_0
+    35   call Sym_2
+    35   no-op
+           optimizes   call Sym_16
+    35   Reg_1 = Stack_D
+    35   Reg_0 = Stack_D
+    35   Reg_0 += Reg_1
+    35   Reg_2 = Reg_0
+           optimizes   Stack_D = Reg_0
+    35   Reg_0 = 2
+    35   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_17
+    35   no-op
+           optimizes   Reg_1 = Stack_D
+    35   Reg_0 = Reg_2
+           optimizes   Reg_0 = Stack_D
+    35   Reg_0 -= Reg_1
+    35   Stack_D = Reg_0
+    35   Reg_0 = 2
+    35   Stack_D = Reg_0
+    35   Reg_0 = Data_7
+    35   Stack_D = Reg_0
+    35   Reg_0 = 2
+    35   Stack_D = Reg_0
+    35   call Sym_8
+    35   no-op
+           optimizes   call Sym_9
+    35   Reg_0 = Stack_D
+    35   if Reg_0 != 0 goto Label_6
+    35   no-op
+           optimizes   Reg_0 = Stack_D
+    35   no-op
+           optimizes   if Reg_0 == 0 goto Label_6
+    36   Reg_0 = 1
+    36   Stack_D = Reg_0
+    36   call Sym_2
+    36   call Sym_13
+    37   call Sym_18
+    38   Reg_0 = -1
+    38   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    38   no-op
+           optimizes   call Sym_7
+    38   no-op
+           optimizes   Reg_1 = Stack_D
+    38   Reg_0 = Stack_D
+    38   if Reg_0 != Reg_1 goto Label_7
+    38   no-op
+           optimizes   Reg_0 = Stack_D
+    38   no-op
+           optimizes   if Reg_0 == 0 goto Label_7
+    39   Reg_0 = Data_8
+    39   Stack_D = Reg_0
+    39   Reg_0 = 6
+    39   Stack_D = Reg_0
+    39   call Sym_15
+    39   Reg_0 = Data_9
+    39   Stack_D = Reg_0
+    39   Reg_0 = 2
+    39   Stack_D = Reg_0
+    39   call Sym_1
+    40   Reg_0 = 1
+    40   Stack_D = Reg_0
+    40   call Sym_2
+    40   call Sym_3
+    40   call Sym_4
+    41   Reg_0 = 1
+    41   Stack_D = Reg_0
+    41   call Sym_11
+    42 label Label_7
+    43 label Label_6
+    45   Reg_0 = 0
+    45   Stack_D = Reg_0
+    45   tail call Sym_13
+           optimizes   call Sym_13
+    45   no-op
+           optimizes label Label_0
+    45 }
+
+Peephole rewrites:
+  main: redundant-test: test %eax,%eax => (none)
+  main: exchange-pop: xchg %edx,%eax; call v4__dpop; xchg %eax,%edx => call v4__dpop; mov %eax,%edx
+
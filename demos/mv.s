@@ -0,0 +1,318 @@
+	.file	"mv.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/demos/",100,0,0,Ltext0
+.stabs	"mv.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC1:
+	.string " source destination"
+.LC3:
+	.string "--help"
+.LC6:
+	.string "->"
+.LC2:
+	.string "-h"
+.LC5:
+.LC9:
+	.string ": "
+.LC0:
+	.string "Usage: "
+.LC4:
+	.string "link"
+.LC7:
+	.string "mv"
+.LC8:
+	.string "unlink"
+.text
+	.align 4
+.stabs "v4_usage:F1",36,0,0,v4_usage
+.globl v4_usage
+	.type	v4_usage,@function
+v4_usage:
+.stabn 68,0,9,.LMa0-v4_usage
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,9,.LMb0-v4_usage
+.LMb0:
+.LBB0:
+.stabn 68,0,10,.LM1-v4_usage
+.LM1:
+	lea .LC0,%eax
+	call v4__dpush
+	mov $7,%eax
+	call v4__dpush
+	call v4__type
+	xor %eax,%eax
+	call v4__dpush
+	call v4_arg
+	call v4_type
+	lea .LC1,%eax
+	call v4__dpush
+	mov $19,%eax
+	call v4__dpush
+	call v4__type
+	pop %ebx
+	leave
+	jmp v4_cr
+.LBE0:
+.stabn 68,0,10,.LM17-v4_usage
+.LM17:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_usage,.Lfe0-v4_usage
+.stabn	192,0,0,.LBB0-v4_usage
+.stabn	224,0,0,.LBE0-v4_usage
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_usage
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,15,.LMa18-main
+.LMa18:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,15,.LMb18-main
+.LMb18:
+.LBB5:
+	call v4_argc
+	mov $2,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L2
+.stabn 68,0,16,.LM28-main
+.LM28:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	lea .LC2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_compare
+	call v4__dpop
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+.stabn 68,0,17,.LM40-main
+.LM40:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	lea .LC3,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_compare
+	call v4__dpop
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	call v4__dpop
+	or %edx,%eax
+	je .L3
+.stabn 68,0,18,.LM59-main
+.LM59:
+	call v4_usage
+	xor %eax,%eax
+	call v4__dpush
+	call v4__exit
+.L3:
+.L2:
+.stabn 68,0,20,.LM65-main
+.LM65:
+	call v4_argc
+	mov $3,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	je .L4
+.stabn 68,0,21,.LM74-main
+.LM74:
+	call v4_usage
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4__exit
+.L4:
+.stabn 68,0,25,.LM79-main
+.LM79:
+	mov $2,%eax
+	call v4__dpush
+	call v4_arg
+	call v4_drop
+.stabn 68,0,26,.LM83-main
+.LM83:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	call v4_drop
+.stabn 68,0,27,.LM87-main
+.LM87:
+	call v4__link
+.stabn 68,0,28,.LM88-main
+.LM88:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L5
+.stabn 68,0,29,.LM96-main
+.LM96:
+	lea .LC4,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_pperror
+	lea .LC5,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,30,.LM106-main
+.LM106:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	call v4_type
+	lea .LC6,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4__type
+	mov $2,%eax
+	call v4__dpush
+	call v4_arg
+	call v4_type
+	call v4_cr
+.stabn 68,0,31,.LM120-main
+.LM120:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4__exit
+.L5:
+.stabn 68,0,35,.LM124-main
+.LM124:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_arg
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	mov %eax,%ecx
+	mov $2,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	sub %edx,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	lea .LC7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_compare
+	call v4__dpop
+	test %eax,%eax
+	jne .L6
+.stabn 68,0,36,.LM151-main
+.LM151:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	call v4_drop
+.stabn 68,0,37,.LM155-main
+.LM155:
+	call v4__unlink
+.stabn 68,0,38,.LM156-main
+.LM156:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L7
+.stabn 68,0,39,.LM164-main
+.LM164:
+	lea .LC8,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_pperror
+	lea .LC9,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,40,.LM174-main
+.LM174:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	call v4_type
+	call v4_cr
+.stabn 68,0,41,.LM179-main
+.LM179:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4__exit
+.L7:
+.L6:
+.stabn 68,0,45,.LM184-main
+.LM184:
+	xor %eax,%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE5:
+.stabn 68,0,45,.LM188-main
+.LM188:
+	pop %ebx
+	leave
+	ret
+.Lfe5:
+	.size	 main,.Lfe5-main
+.stabn	192,0,0,.LBB5-main
+.stabn	224,0,0,.LBE5-main
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
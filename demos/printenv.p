@@ -0,0 +1,248 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: printenv.ft
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug optimize intermediate assembly
+
+Data:
+    11 Data_1 string[30] " [ variable [ variable ... ] ]"
+    18 Data_3 string[6] "--help"
+    17 Data_2 string[2] "-h"
+    11 Data_0 string[7] "Usage: "
+
+Symbols:
+     8 Sym_0 word "main"
+    16 Sym_8 external "v4_Equals"
+    26 Sym_15 external "v4_Fetch"
+    27 Sym_16 external "v4_Less_Greater"
+    34 Sym_21 external "v4_Store"
+    19 Sym_12 external "v4__exit"
+    11 Sym_3 external "v4__type"
+    11 Sym_4 external "v4_arg"
+    16 Sym_7 external "v4_argc"
+    29 Sym_18 external "v4_cell_Plus"
+    17 Sym_9 external "v4_compare"
+    11 Sym_6 external "v4_cr"
+    30 Sym_19 external "v4_drop"
+    26 Sym_14 external "v4_dup"
+    24 Sym_13 external "v4_envp"
+    38 Sym_23 external "v4_getenv"
+    38 Sym_22 external "v4_i"
+     8 Sym_1 constant "v4_null"
+    18 Sym_11 external "v4_or"
+    34 Sym_20 variable Cell "v4_status"
+    28 Sym_17 external "v4_strlen"
+    11 Sym_5 external "v4_type"
+    10 Sym_2 word "v4_usage"
+    17 Sym_10 external "v4_z0_Equals"
+
+Intermediate code:
+    10 function Sym_2 {
+    11   Reg_0 = Data_0
+    11   Stack_D = Reg_0
+    11   Reg_0 = 7
+    11   Stack_D = Reg_0
+    11   call Sym_3
+    11   Reg_0 = 0
+    11   Stack_D = Reg_0
+    11   call Sym_4
+    11   call Sym_5
+    11   Reg_0 = Data_1
+    11   Stack_D = Reg_0
+    11   Reg_0 = 30
+    11   Stack_D = Reg_0
+    11   call Sym_3
+    11   tail call Sym_6
+           optimizes   call Sym_6
+    11   no-op
+           optimizes label Label_1
+    11 }
+
+     8 function Sym_0 {
+     8   Reg_0 = 0
+     8   no-op
+           optimizes   Stack_D = Reg_0
+     8   no-op
+           optimizes   Reg_0 = Stack_D
+     8   *(Sym_1) = Reg_0
+    16   call Sym_7
+    16   Reg_0 = 2
+    16   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    16   no-op
+           optimizes   call Sym_8
+    16   no-op
+           optimizes   Reg_1 = Stack_D
+    16   Reg_0 = Stack_D
+    16   if Reg_0 != Reg_1 goto Label_2
+    16   no-op
+           optimizes   Reg_0 = Stack_D
+    16   no-op
+           optimizes   if Reg_0 == 0 goto Label_2
+    17   Reg_0 = 1
+    17   Stack_D = Reg_0
+    17   call Sym_4
+    17   Reg_0 = Data_2
+    17   Stack_D = Reg_0
+    17   Reg_0 = 2
+    17   Stack_D = Reg_0
+    17   call Sym_9
+    17   no-op
+           optimizes   call Sym_10
+    17   Reg_0 = Stack_D
+    17   Reg_0 = Reg_0 == 0
+    17   Stack_D = Reg_0
+    18   Reg_0 = 1
+    18   Stack_D = Reg_0
+    18   call Sym_4
+    18   Reg_0 = Data_3
+    18   Stack_D = Reg_0
+    18   Reg_0 = 6
+    18   Stack_D = Reg_0
+    18   call Sym_9
+    18   no-op
+           optimizes   call Sym_10
+    18   Reg_0 = Stack_D
+    18   Reg_0 = Reg_0 == 0
+    18   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    18   no-op
+           optimizes   call Sym_11
+    18   no-op
+           optimizes   Reg_1 = Stack_D
+    18   Reg_0 = Stack_D
+    18   Reg_0 |= Reg_1
+    18   no-op
+           optimizes   Stack_D = Reg_0
+    18   no-op
+           optimizes   Reg_0 = Stack_D
+    18   if Reg_0 == 0 goto Label_3
+    19   call Sym_2
+    19   Reg_0 = 0
+    19   Stack_D = Reg_0
+    19   call Sym_12
+    20 label Label_3
+    20 label Label_2
+    23   call Sym_7
+    23   Reg_0 = 1
+    23   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    23   no-op
+           optimizes   call Sym_8
+    23   no-op
+           optimizes   Reg_1 = Stack_D
+    23   Reg_0 = Stack_D
+    23   if Reg_0 != Reg_1 goto Label_4
+    23   no-op
+           optimizes   Reg_0 = Stack_D
+    23   no-op
+           optimizes   if Reg_0 == 0 goto Label_4
+    24   call Sym_13
+    25 label Label_5
+    26   call Sym_14
+    26   call Sym_15
+    27   call Sym_14
+    27   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_1)
+    27   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    27   no-op
+           optimizes   call Sym_16
+    27   no-op
+           optimizes   Reg_1 = Stack_D
+    27   Reg_0 = Stack_D
+    27   if Reg_0 == Reg_1 goto Label_6
+    27   no-op
+           optimizes   Reg_0 = Stack_D
+    27   no-op
+           optimizes   if Reg_0 == 0 goto Label_6
+    28   call Sym_17
+    28   call Sym_5
+    28   call Sym_6
+    29   no-op
+           optimizes   call Sym_18
+    29   Reg_0 = Stack_D
+    29   Reg_0 += 4
+    29   Stack_D = Reg_0
+    30   goto Label_5
+    30 label Label_6
+    30   call Sym_19
+    31   Reg_0 = 0
+    31   Stack_D = Reg_0
+    31   call Sym_12
+    32 label Label_4
+    34   Reg_0 = 0
+    34   no-op
+           optimizes   Stack_D = Reg_0
+    34   no-op
+           optimizes   Reg_0 = Sym_20
+    34   no-op
+           optimizes   Stack_D = Reg_0
+    34   no-op
+           optimizes   call Sym_21
+    34   no-op
+           optimizes   Reg_0 = Stack_D
+    34   *(Sym_20) = Reg_0
+    37   call Sym_7
+    37   Reg_0 = 1
+    37   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    37   no-op
+           optimizes   Reg_1 = Stack_D
+    37   Reg_0 = Stack_D
+    37   Stack_R = Reg_0
+    37   Stack_R = Reg_1
+    37 label Label_8
+    38   call Sym_22
+    38   call Sym_4
+    38   call Sym_23
+    38   Reg_0 = Stack_D
+    38   if Reg_0 == 0 goto Label_10
+    39   call Sym_5
+    39   call Sym_6
+    40   goto Label_11
+    40 label Label_10
+    41   Reg_0 = 1
+    41   no-op
+           optimizes   Stack_D = Reg_0
+    41   no-op
+           optimizes   Reg_0 = Sym_20
+    41   no-op
+           optimizes   Stack_D = Reg_0
+    41   no-op
+           optimizes   call Sym_21
+    41   no-op
+           optimizes   Reg_0 = Stack_D
+    41   *(Sym_20) = Reg_0
+    42 label Label_11
+    43   Reg_1 = Stack_R
+    43   Reg_1 += 1
+    43   Reg_0 = Stack_R
+    43   Stack_R = Reg_0
+    43   Stack_R = Reg_1
+    43   Reg_1 -= Reg_0
+    43   if Reg_1 != 0 goto Label_8
+    43   no-op
+           optimizes label Label_9
+    43   Reg_0 = Stack_R
+    43   Reg_0 = Stack_R
+    43   no-op
+           optimizes label Label_7
+    46   no-op
+           optimizes   Reg_0 = Sym_20
+    46   no-op
+           optimizes   Stack_D = Reg_0
+    46   no-op
+           optimizes   call Sym_15
+    46   Reg_0 = *(Sym_20)
+    46   Stack_D = Reg_0
+    46   tail call Sym_19
+           optimizes   call Sym_19
+    46   no-op
+           optimizes label Label_0
+    46 }
+
+Peephole rewrites:
+  main: redundant-test: test %eax,%eax => (none)
+  main: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  main: redundant-test: test %edx,%edx => (none)
+
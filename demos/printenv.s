@@ -0,0 +1,262 @@
+	.file	"printenv.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/demos/",100,0,0,Ltext0
+.stabs	"printenv.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC1:
+	.string " [ variable [ variable ... ] ]"
+.LC3:
+	.string "--help"
+.LC2:
+	.string "-h"
+.LC0:
+	.string "Usage: "
+.stabs	"v4_null:G2",40,0,0,v4_null
+	.comm  v4_null,4,4
+.stabs	"v4_status:G2",40,0,0,v4_status
+	.comm  v4_status,4,4
+.text
+	.align 4
+.stabs "v4_usage:F1",36,0,0,v4_usage
+.globl v4_usage
+	.type	v4_usage,@function
+v4_usage:
+.stabn 68,0,10,.LMa0-v4_usage
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,10,.LMb0-v4_usage
+.LMb0:
+.LBB2:
+.stabn 68,0,11,.LM1-v4_usage
+.LM1:
+	lea .LC0,%eax
+	call v4__dpush
+	mov $7,%eax
+	call v4__dpush
+	call v4__type
+	xor %eax,%eax
+	call v4__dpush
+	call v4_arg
+	call v4_type
+	lea .LC1,%eax
+	call v4__dpush
+	mov $30,%eax
+	call v4__dpush
+	call v4__type
+	pop %ebx
+	leave
+	jmp v4_cr
+.LBE2:
+.stabn 68,0,11,.LM17-v4_usage
+.LM17:
+	pop %ebx
+	leave
+	ret
+.Lfe2:
+	.size	 v4_usage,.Lfe2-v4_usage
+.stabn	192,0,0,.LBB2-v4_usage
+.stabn	224,0,0,.LBE2-v4_usage
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4_usage
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,8,.LMa18-main
+.LMa18:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,8,.LMb18-main
+.LMb18:
+.LBB0:
+	xor %eax,%eax
+	mov %eax,(v4_null)
+.stabn 68,0,16,.LM23-main
+.LM23:
+	call v4_argc
+	mov $2,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L2
+.stabn 68,0,17,.LM32-main
+.LM32:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	lea .LC2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_compare
+	call v4__dpop
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+.stabn 68,0,18,.LM44-main
+.LM44:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	lea .LC3,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_compare
+	call v4__dpop
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	call v4__dpop
+	or %edx,%eax
+	je .L3
+.stabn 68,0,19,.LM63-main
+.LM63:
+	call v4_usage
+	xor %eax,%eax
+	call v4__dpush
+	call v4__exit
+.L3:
+.L2:
+.stabn 68,0,23,.LM69-main
+.LM69:
+	call v4_argc
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L4
+.stabn 68,0,24,.LM78-main
+.LM78:
+	call v4_envp
+.L5:
+.stabn 68,0,26,.LM80-main
+.LM80:
+	call v4_dup
+	call v4_Fetch
+.stabn 68,0,27,.LM82-main
+.LM82:
+	call v4_dup
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	je .L6
+.stabn 68,0,28,.LM91-main
+.LM91:
+	call v4_strlen
+	call v4_type
+	call v4_cr
+	call v4__dpop
+	add $4,%eax
+	call v4__dpush
+.stabn 68,0,30,.LM98-main
+.LM98:
+	jmp .L5
+.L6:
+	call v4_drop
+.stabn 68,0,31,.LM101-main
+.LM101:
+	xor %eax,%eax
+	call v4__dpush
+	call v4__exit
+.L4:
+.stabn 68,0,34,.LM105-main
+.LM105:
+	xor %eax,%eax
+	mov %eax,(v4_status)
+.stabn 68,0,37,.LM112-main
+.LM112:
+	call v4_argc
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	call v4__dpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L8:
+.stabn 68,0,38,.LM120-main
+.LM120:
+	call v4_i
+	call v4_arg
+	call v4_getenv
+	call v4__dpop
+	test %eax,%eax
+	je .L10
+.stabn 68,0,39,.LM125-main
+.LM125:
+	call v4_type
+	call v4_cr
+.stabn 68,0,40,.LM127-main
+.LM127:
+	jmp .L11
+.L10:
+.stabn 68,0,41,.LM129-main
+.LM129:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,(v4_status)
+.L11:
+.stabn 68,0,43,.LM137-main
+.LM137:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L8
+	call v4__rpop
+	call v4__rpop
+	mov (v4_status),%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE0:
+.stabn 68,0,46,.LM155-main
+.LM155:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 main,.Lfe0-main
+.stabn	192,0,0,.LBB0-main
+.stabn	224,0,0,.LBE0-main
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,132 @@
+VNPForth 1.5 [build x86_64/20261017065336]
+Source: reimann_.ft
+Compiled: Sat Oct 17 06:53:57 2026
+Flags: debug optimize intermediate assembly
+
+Symbols:
+    16 Sym_9 external "v4_drop"
+    13 Sym_1 external "v4_dup"
+    24 Sym_13 external "v4_f_Plus"
+    19 Sym_11 external "v4_f_Slash"
+    14 Sym_6 external "v4_f_Star"
+    15 Sym_8 external "v4_fdrop"
+    14 Sym_4 external "v4_fdup"
+    12 Sym_0 word "v4_fexp"
+    14 Sym_5 external "v4_fover"
+    15 Sym_7 external "v4_fswap"
+    21 Sym_12 word "v4_reimann_Minuszeta"
+    13 Sym_2 external "v4_z0_Less_Greater"
+    18 Sym_10 word "v4_z1_Dot0_Slash"
+    14 Sym_3 external "v4_z1_Minus"
+    28 Sym_14 external "v4_z2drop"
+
+Intermediate code:
+    12 function Sym_0 {
+    13   call Sym_1
+    13   call Sym_2
+    13   Reg_0 = Stack_D
+    13   if Reg_0 == 0 goto Label_2
+    14   call Sym_3
+    14   call Sym_4
+    14   Reg_0 = 0
+    14   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    14   no-op
+           optimizes   Reg_1 = Stack_D
+    14   Reg_0 = Stack_D
+    14   if Reg_0 == Reg_1 goto Label_3
+    14   Stack_R = Reg_0
+    14   Stack_R = Reg_1
+    14 label Label_4
+    14   call Sym_5
+    14   call Sym_6
+    14   Reg_1 = Stack_R
+    14   Reg_1 += 1
+    14   Reg_0 = Stack_R
+    14   Stack_R = Reg_0
+    14   Stack_R = Reg_1
+    14   Reg_1 -= Reg_0
+    14   if Reg_1 != 0 goto Label_4
+    14   no-op
+           optimizes label Label_5
+    14   Reg_0 = Stack_R
+    14   Reg_0 = Stack_R
+    14 label Label_3
+    15   call Sym_7
+    15   call Sym_8
+    16   goto Label_6
+    16 label Label_2
+    16   call Sym_9
+    16   call Sym_8
+    16   Reg_0 = 1065353216
+    16   Stack_F = Reg_0
+    16 label Label_6
+    16   no-op
+           optimizes label Label_1
+    16 }
+
+    18 function Sym_10 {
+    19   Reg_0 = 1065353216
+    19   Stack_F = Reg_0
+    19   call Sym_7
+    19   call Sym_11
+    19   no-op
+           optimizes label Label_7
+    19 }
+
+    21 function Sym_12 {
+    22   call Sym_1
+    22   call Sym_2
+    22   Reg_0 = Stack_D
+    22   if Reg_0 == 0 goto Label_9
+    23   Reg_0 = 0
+    23   Stack_F = Reg_0
+    23   call Sym_4
+    23   Reg_0 = 0
+    23   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    23   no-op
+           optimizes   Reg_1 = Stack_D
+    23   Reg_0 = Stack_D
+    23   Stack_R = Reg_0
+    23   Stack_R = Reg_1
+    23 label Label_11
+    24   call Sym_7
+    24   Reg_0 = 1065353216
+    24   Stack_F = Reg_0
+    24   call Sym_13
+    24   call Sym_7
+    25   call Sym_5
+    25   call Sym_1
+    25   call Sym_0
+    25   no-op
+           optimizes   call Sym_10
+    19   Reg_0 = 1065353216
+    19   Stack_F = Reg_0
+    19   call Sym_7
+    19   call Sym_11
+    25   call Sym_13
+    26   Reg_1 = Stack_R
+    26   Reg_1 += 1
+    26   Reg_0 = Stack_R
+    26   Stack_R = Reg_0
+    26   Stack_R = Reg_1
+    26   Reg_1 -= Reg_0
+    26   if Reg_1 != 0 goto Label_11
+    26   no-op
+           optimizes label Label_12
+    26   Reg_0 = Stack_R
+    26   Reg_0 = Stack_R
+    26   no-op
+           optimizes label Label_10
+    27   call Sym_9
+    28   goto Label_13
+    28 label Label_9
+    28   call Sym_14
+    28   Reg_0 = 0
+    28   Stack_F = Reg_0
+    28 label Label_13
+    28   no-op
+           optimizes label Label_8
+    28 }
+
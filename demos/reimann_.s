@@ -0,0 +1,219 @@
+	.file	"reimann_.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/demos/",100,0,0,Ltext0
+.stabs	"reimann_.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_fexp:F1",36,0,0,v4_fexp
+.globl v4_fexp
+	.type	v4_fexp,@function
+v4_fexp:
+.stabn 68,0,12,.LMa0-v4_fexp
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,12,.LMb0-v4_fexp
+.LMb0:
+.LBB0:
+.stabn 68,0,13,.LM1-v4_fexp
+.LM1:
+	call v4_dup
+	call v4_z0_Less_Greater
+	call v4__dpop
+	test %eax,%eax
+	je .L2
+.stabn 68,0,14,.LM5-v4_fexp
+.LM5:
+	call v4_z1_Minus
+	call v4_fdup
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %eax,%edx
+	je .L3
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L4:
+	call v4_fover
+	call v4_f_Star
+	xchg %edx,%eax
+	call v4__rpop
+	xchg %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	test %edx,%edx
+	jne .L4
+	call v4__rpop
+	call v4__rpop
+.L3:
+.stabn 68,0,15,.LM28-v4_fexp
+.LM28:
+	call v4_fswap
+	call v4_fdrop
+.stabn 68,0,16,.LM30-v4_fexp
+.LM30:
+	jmp .L6
+.L2:
+	call v4_drop
+	call v4_fdrop
+	mov $1065353216,%eax
+	call v4__fpush
+.L6:
+.LBE0:
+.stabn 68,0,16,.LM38-v4_fexp
+.LM38:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_fexp,.Lfe0-v4_fexp
+.stabn	192,0,0,.LBB0-v4_fexp
+.stabn	224,0,0,.LBE0-v4_fexp
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_fexp
+.text
+	.align 4
+.stabs "v4_z1_Dot0_Slash:F1",36,0,0,v4_z1_Dot0_Slash
+.globl v4_z1_Dot0_Slash
+	.type	v4_z1_Dot0_Slash,@function
+v4_z1_Dot0_Slash:
+.stabn 68,0,18,.LMa39-v4_z1_Dot0_Slash
+.LMa39:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,18,.LMb39-v4_z1_Dot0_Slash
+.LMb39:
+.LBB10:
+.stabn 68,0,19,.LM40-v4_z1_Dot0_Slash
+.LM40:
+	mov $1065353216,%eax
+	call v4__fpush
+	call v4_fswap
+	call v4_f_Slash
+.LBE10:
+.stabn 68,0,19,.LM45-v4_z1_Dot0_Slash
+.LM45:
+	pop %ebx
+	leave
+	ret
+.Lfe10:
+	.size	 v4_z1_Dot0_Slash,.Lfe10-v4_z1_Dot0_Slash
+.stabn	192,0,0,.LBB10-v4_z1_Dot0_Slash
+.stabn	224,0,0,.LBE10-v4_z1_Dot0_Slash
+.Lscope10:
+.stabs	"",36,0,0,.Lscope10-v4_z1_Dot0_Slash
+.text
+	.align 4
+.stabs "v4_reimann_Minuszeta:F1",36,0,0,v4_reimann_Minuszeta
+.globl v4_reimann_Minuszeta
+	.type	v4_reimann_Minuszeta,@function
+v4_reimann_Minuszeta:
+.stabn 68,0,21,.LMa46-v4_reimann_Minuszeta
+.LMa46:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,21,.LMb46-v4_reimann_Minuszeta
+.LMb46:
+.LBB12:
+.stabn 68,0,22,.LM47-v4_reimann_Minuszeta
+.LM47:
+	call v4_dup
+	call v4_z0_Less_Greater
+	call v4__dpop
+	test %eax,%eax
+	je .L9
+.stabn 68,0,23,.LM51-v4_reimann_Minuszeta
+.LM51:
+	xor %eax,%eax
+	call v4__fpush
+	call v4_fdup
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L11:
+.stabn 68,0,24,.LM61-v4_reimann_Minuszeta
+.LM61:
+	call v4_fswap
+	mov $1065353216,%eax
+	call v4__fpush
+	call v4_f_Plus
+	call v4_fswap
+.stabn 68,0,25,.LM66-v4_reimann_Minuszeta
+.LM66:
+	call v4_fover
+	call v4_dup
+	call v4_fexp
+.stabn 68,0,19,.LM70-v4_reimann_Minuszeta
+.LM70:
+	mov $1065353216,%eax
+	call v4__fpush
+	call v4_fswap
+	call v4_f_Slash
+.stabn 68,0,25,.LM74-v4_reimann_Minuszeta
+.LM74:
+	call v4_f_Plus
+.stabn 68,0,26,.LM75-v4_reimann_Minuszeta
+.LM75:
+	xchg %edx,%eax
+	call v4__rpop
+	xchg %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	test %edx,%edx
+	jne .L11
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,27,.LM86-v4_reimann_Minuszeta
+.LM86:
+	call v4_drop
+.stabn 68,0,28,.LM87-v4_reimann_Minuszeta
+.LM87:
+	jmp .L13
+.L9:
+	call v4_z2drop
+	xor %eax,%eax
+	call v4__fpush
+.L13:
+.LBE12:
+.stabn 68,0,28,.LM94-v4_reimann_Minuszeta
+.LM94:
+	pop %ebx
+	leave
+	ret
+.Lfe12:
+	.size	 v4_reimann_Minuszeta,.Lfe12-v4_reimann_Minuszeta
+.stabn	192,0,0,.LBB12-v4_reimann_Minuszeta
+.stabn	224,0,0,.LBE12-v4_reimann_Minuszeta
+.Lscope12:
+.stabs	"",36,0,0,.Lscope12-v4_reimann_Minuszeta
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 06:53:37, Linux"
@@ -0,0 +1,233 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: rm.ft
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug optimize intermediate assembly
+
+Data:
+     9 Data_1 string[22] " [ file [ file ... ] ]"
+    16 Data_3 string[6] "--help"
+    15 Data_2 string[2] "-h"
+    29 Data_5 string[2] ": "
+     9 Data_0 string[7] "Usage: "
+    29 Data_4 string[6] "unlink"
+
+Symbols:
+    14 Sym_5 word "main"
+    14 Sym_7 external "v4_Equals"
+    35 Sym_19 external "v4_Fetch"
+    19 Sym_12 external "v4_Less"
+    23 Sym_14 external "v4_Store"
+    17 Sym_11 external "v4__exit"
+     9 Sym_1 external "v4__type"
+    27 Sym_17 external "v4__unlink"
+     9 Sym_2 external "v4_arg"
+    14 Sym_6 external "v4_argc"
+    15 Sym_8 external "v4_compare"
+     9 Sym_4 external "v4_cr"
+    26 Sym_16 external "v4_drop"
+    26 Sym_15 external "v4_i"
+    16 Sym_10 external "v4_or"
+    29 Sym_18 external "v4_pperror"
+    23 Sym_13 variable Cell "v4_status"
+     9 Sym_3 external "v4_type"
+     8 Sym_0 word "v4_usage"
+    15 Sym_9 external "v4_z0_Equals"
+
+Intermediate code:
+     8 function Sym_0 {
+     9   Reg_0 = Data_0
+     9   Stack_D = Reg_0
+     9   Reg_0 = 7
+     9   Stack_D = Reg_0
+     9   call Sym_1
+     9   Reg_0 = 0
+     9   Stack_D = Reg_0
+     9   call Sym_2
+     9   call Sym_3
+     9   Reg_0 = Data_1
+     9   Stack_D = Reg_0
+     9   Reg_0 = 22
+     9   Stack_D = Reg_0
+     9   call Sym_1
+     9   tail call Sym_4
+           optimizes   call Sym_4
+     9   no-op
+           optimizes label Label_1
+     9 }
+
+    14 function Sym_5 {
+    14   call Sym_6
+    14   Reg_0 = 2
+    14   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    14   no-op
+           optimizes   call Sym_7
+    14   no-op
+           optimizes   Reg_1 = Stack_D
+    14   Reg_0 = Stack_D
+    14   if Reg_0 != Reg_1 goto Label_2
+    14   no-op
+           optimizes   Reg_0 = Stack_D
+    14   no-op
+           optimizes   if Reg_0 == 0 goto Label_2
+    15   Reg_0 = 1
+    15   Stack_D = Reg_0
+    15   call Sym_2
+    15   Reg_0 = Data_2
+    15   Stack_D = Reg_0
+    15   Reg_0 = 2
+    15   Stack_D = Reg_0
+    15   call Sym_8
+    15   no-op
+           optimizes   call Sym_9
+    15   Reg_0 = Stack_D
+    15   Reg_0 = Reg_0 == 0
+    15   Stack_D = Reg_0
+    16   Reg_0 = 1
+    16   Stack_D = Reg_0
+    16   call Sym_2
+    16   Reg_0 = Data_3
+    16   Stack_D = Reg_0
+    16   Reg_0 = 6
+    16   Stack_D = Reg_0
+    16   call Sym_8
+    16   no-op
+           optimizes   call Sym_9
+    16   Reg_0 = Stack_D
+    16   Reg_0 = Reg_0 == 0
+    16   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    16   no-op
+           optimizes   call Sym_10
+    16   no-op
+           optimizes   Reg_1 = Stack_D
+    16   Reg_0 = Stack_D
+    16   Reg_0 |= Reg_1
+    16   no-op
+           optimizes   Stack_D = Reg_0
+    16   no-op
+           optimizes   Reg_0 = Stack_D
+    16   if Reg_0 == 0 goto Label_3
+    17   call Sym_0
+    17   Reg_0 = 0
+    17   Stack_D = Reg_0
+    17   call Sym_11
+    18 label Label_3
+    18 label Label_2
+    19   call Sym_6
+    19   Reg_0 = 2
+    19   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    19   no-op
+           optimizes   call Sym_12
+    19   no-op
+           optimizes   Reg_1 = Stack_D
+    19   Reg_0 = Stack_D
+    19   if Reg_0 >= Reg_1 goto Label_4
+    19   no-op
+           optimizes   Reg_0 = Stack_D
+    19   no-op
+           optimizes   if Reg_0 == 0 goto Label_4
+    20   call Sym_0
+    20   Reg_0 = 1
+    20   Stack_D = Reg_0
+    20   call Sym_11
+    21 label Label_4
+    23   Reg_0 = 0
+    23   no-op
+           optimizes   Stack_D = Reg_0
+    23   no-op
+           optimizes   Reg_0 = Sym_13
+    23   no-op
+           optimizes   Stack_D = Reg_0
+    23   no-op
+           optimizes   call Sym_14
+    23   no-op
+           optimizes   Reg_0 = Stack_D
+    23   *(Sym_13) = Reg_0
+    25   call Sym_6
+    25   Reg_0 = 1
+    25   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    25   no-op
+           optimizes   Reg_1 = Stack_D
+    25   Reg_0 = Stack_D
+    25   Stack_R = Reg_0
+    25   Stack_R = Reg_1
+    25 label Label_6
+    26   call Sym_15
+    26   call Sym_2
+    26   call Sym_16
+    27   call Sym_17
+    28   Reg_0 = -1
+    28   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    28   no-op
+           optimizes   call Sym_7
+    28   no-op
+           optimizes   Reg_1 = Stack_D
+    28   Reg_0 = Stack_D
+    28   if Reg_0 != Reg_1 goto Label_8
+    28   no-op
+           optimizes   Reg_0 = Stack_D
+    28   no-op
+           optimizes   if Reg_0 == 0 goto Label_8
+    29   Reg_0 = Data_4
+    29   Stack_D = Reg_0
+    29   Reg_0 = 6
+    29   Stack_D = Reg_0
+    29   call Sym_18
+    29   Reg_0 = Data_5
+    29   Stack_D = Reg_0
+    29   Reg_0 = 2
+    29   Stack_D = Reg_0
+    29   call Sym_1
+    30   call Sym_15
+    30   call Sym_2
+    30   call Sym_3
+    30   call Sym_4
+    31   Reg_0 = 1
+    31   no-op
+           optimizes   Stack_D = Reg_0
+    31   no-op
+           optimizes   Reg_0 = Sym_13
+    31   no-op
+           optimizes   Stack_D = Reg_0
+    31   no-op
+           optimizes   call Sym_14
+    31   no-op
+           optimizes   Reg_0 = Stack_D
+    31   *(Sym_13) = Reg_0
+    32 label Label_8
+    33   Reg_1 = Stack_R
+    33   Reg_1 += 1
+    33   Reg_0 = Stack_R
+    33   Stack_R = Reg_0
+    33   Stack_R = Reg_1
+    33   Reg_1 -= Reg_0
+    33   if Reg_1 != 0 goto Label_6
+    33   no-op
+           optimizes label Label_7
+    33   Reg_0 = Stack_R
+    33   Reg_0 = Stack_R
+    33   no-op
+           optimizes label Label_5
+    35   no-op
+           optimizes   Reg_0 = Sym_13
+    35   no-op
+           optimizes   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_19
+    35   Reg_0 = *(Sym_13)
+    35   Stack_D = Reg_0
+    35   tail call Sym_16
+           optimizes   call Sym_16
+    35   no-op
+           optimizes label Label_0
+    35 }
+
+Peephole rewrites:
+  main: redundant-test: test %eax,%eax => (none)
+  main: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  main: redundant-test: test %edx,%edx => (none)
+
@@ -0,0 +1,250 @@
+	.file	"rm.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/demos/",100,0,0,Ltext0
+.stabs	"rm.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC1:
+	.string " [ file [ file ... ] ]"
+.LC3:
+	.string "--help"
+.LC2:
+	.string "-h"
+.LC5:
+	.string ": "
+.LC0:
+	.string "Usage: "
+.LC4:
+	.string "unlink"
+.stabs	"v4_status:G2",40,0,0,v4_status
+	.comm  v4_status,4,4
+.text
+	.align 4
+.stabs "v4_usage:F1",36,0,0,v4_usage
+.globl v4_usage
+	.type	v4_usage,@function
+v4_usage:
+.stabn 68,0,8,.LMa0-v4_usage
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,8,.LMb0-v4_usage
+.LMb0:
+.LBB0:
+.stabn 68,0,9,.LM1-v4_usage
+.LM1:
+	lea .LC0,%eax
+	call v4__dpush
+	mov $7,%eax
+	call v4__dpush
+	call v4__type
+	xor %eax,%eax
+	call v4__dpush
+	call v4_arg
+	call v4_type
+	lea .LC1,%eax
+	call v4__dpush
+	mov $22,%eax
+	call v4__dpush
+	call v4__type
+	pop %ebx
+	leave
+	jmp v4_cr
+.LBE0:
+.stabn 68,0,9,.LM17-v4_usage
+.LM17:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_usage,.Lfe0-v4_usage
+.stabn	192,0,0,.LBB0-v4_usage
+.stabn	224,0,0,.LBE0-v4_usage
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_usage
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,14,.LMa18-main
+.LMa18:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,14,.LMb18-main
+.LMb18:
+.LBB5:
+	call v4_argc
+	mov $2,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L2
+.stabn 68,0,15,.LM28-main
+.LM28:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	lea .LC2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_compare
+	call v4__dpop
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+.stabn 68,0,16,.LM40-main
+.LM40:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	lea .LC3,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_compare
+	call v4__dpop
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	call v4__dpop
+	or %edx,%eax
+	je .L3
+.stabn 68,0,17,.LM59-main
+.LM59:
+	call v4_usage
+	xor %eax,%eax
+	call v4__dpush
+	call v4__exit
+.L3:
+.L2:
+.stabn 68,0,19,.LM65-main
+.LM65:
+	call v4_argc
+	mov $2,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L4
+.stabn 68,0,20,.LM74-main
+.LM74:
+	call v4_usage
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4__exit
+.L4:
+.stabn 68,0,23,.LM79-main
+.LM79:
+	xor %eax,%eax
+	mov %eax,(v4_status)
+.stabn 68,0,25,.LM86-main
+.LM86:
+	call v4_argc
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	call v4__dpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L6:
+.stabn 68,0,26,.LM94-main
+.LM94:
+	call v4_i
+	call v4_arg
+	call v4_drop
+.stabn 68,0,27,.LM97-main
+.LM97:
+	call v4__unlink
+.stabn 68,0,28,.LM98-main
+.LM98:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L8
+.stabn 68,0,29,.LM106-main
+.LM106:
+	lea .LC4,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_pperror
+	lea .LC5,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,30,.LM116-main
+.LM116:
+	call v4_i
+	call v4_arg
+	call v4_type
+	call v4_cr
+.stabn 68,0,31,.LM120-main
+.LM120:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,(v4_status)
+.L8:
+.stabn 68,0,33,.LM128-main
+.LM128:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L6
+	call v4__rpop
+	call v4__rpop
+	mov (v4_status),%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE5:
+.stabn 68,0,35,.LM146-main
+.LM146:
+	pop %ebx
+	leave
+	ret
+.Lfe5:
+	.size	 main,.Lfe5-main
+.stabn	192,0,0,.LBB5-main
+.stabn	224,0,0,.LBE5-main
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
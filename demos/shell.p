@@ -0,0 +1,526 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: shell.ft
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug optimize intermediate assembly
+
+Data:
+    25 Data_0 string[5] "4th> "
+    74 Data_2 string[4] "exec"
+    64 Data_1 string[4] "exit"
+    79 Data_3 string[4] "fork"
+    84 Data_4 string[4] "wait"
+
+Symbols:
+    10 Sym_0 word "main"
+    14 Sym_6 external "v4_Equals"
+    72 Sym_40 external "v4_Fetch"
+    26 Sym_19 external "v4_Greaterr"
+    17 Sym_10 external "v4_Minustrailing"
+    20 Sym_14 external "v4_Slashstring"
+    36 Sym_24 external "v4_Store"
+    73 Sym_41 external "v4__execve"
+    75 Sym_44 external "v4__exit"
+    65 Sym_38 external "v4__fork"
+    25 Sym_16 external "v4__type"
+    83 Sym_45 external "v4__waitpid"
+    26 Sym_18 external "v4_accept"
+    14 Sym_5 external "v4_bl"
+    19 Sym_13 external "v4_c_Fetch"
+    41 Sym_26 external "v4_c_Store"
+    48 Sym_31 external "v4_cell_Plus"
+    52 Sym_32 external "v4_char_Plus"
+    56 Sym_34 variable Char[1024] "v4_cmd"
+    64 Sym_36 external "v4_compare"
+    74 Sym_43 external "v4_cr"
+    54 Sym_33 external "v4_drop"
+    14 Sym_4 external "v4_dup"
+    70 Sym_39 external "v4_envp"
+    57 Sym_35 variable Cell[256] "v4_exec_Minusargv"
+    23 Sym_15 word "v4_getline"
+    43 Sym_27 external "v4_i"
+    13 Sym_3 word "v4_is_Minusspace"
+    11 Sym_2 constant "v4_null"
+    14 Sym_8 external "v4_or"
+    19 Sym_12 external "v4_over"
+    74 Sym_42 external "v4_perror"
+    26 Sym_20 external "v4_r_Greater"
+    37 Sym_25 external "v4_rot"
+    14 Sym_7 external "v4_swap"
+    10 Sym_1 constant "v4_tab"
+    35 Sym_23 word "v4_tokenize"
+    16 Sym_9 word "v4_trimstring"
+    43 Sym_29 external "v4_true"
+    43 Sym_28 external "v4_z0_Equals"
+    19 Sym_11 external "v4_z0_Greater"
+    64 Sym_37 external "v4_z0_Less_Greater"
+    44 Sym_30 external "v4_z1_Minus"
+    29 Sym_22 external "v4_z2drop"
+    26 Sym_17 external "v4_z2dup"
+    29 Sym_21 external "v4_z2swap"
+
+Intermediate code:
+    13 function Sym_3 {
+    14   call Sym_4
+    14   call Sym_5
+    14   no-op
+           optimizes   call Sym_6
+    14   Reg_1 = Stack_D
+    14   Reg_0 = Stack_D
+    14   Reg_0 = Reg_0 == Reg_1
+    14   Stack_D = Reg_0
+    14   call Sym_7
+    14   Reg_0 = 9
+           optimizes   Reg_0 = *(Sym_1)
+    14   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    14   no-op
+           optimizes   call Sym_6
+    14   no-op
+           optimizes   Reg_1 = Stack_D
+    14   Reg_0 = Stack_D
+    14   Reg_0 = Reg_0 == Reg_1
+    14   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    14   no-op
+           optimizes   call Sym_8
+    14   no-op
+           optimizes   Reg_1 = Stack_D
+    14   Reg_0 = Stack_D
+    14   Reg_0 |= Reg_1
+    14   Stack_D = Reg_0
+    14   no-op
+           optimizes label Label_1
+    14 }
+
+    16 function Sym_9 {
+    17   call Sym_10
+    18 label Label_3
+    19   call Sym_4
+    19   no-op
+           optimizes   call Sym_11
+    19   Reg_0 = Stack_D
+    19   if Reg_0 <= 0 goto Label_4
+    19   no-op
+           optimizes   Reg_0 = Stack_D
+    19   no-op
+           optimizes   if Reg_0 == 0 goto Label_4
+    19   call Sym_12
+    19   call Sym_13
+    19   call Sym_5
+    19   no-op
+           optimizes   call Sym_6
+    19   Reg_1 = Stack_D
+    19   Reg_0 = Stack_D
+    19   if Reg_0 != Reg_1 goto Label_4
+    19   no-op
+           optimizes   Reg_0 = Stack_D
+    19   no-op
+           optimizes   if Reg_0 == 0 goto Label_4
+    20   Reg_0 = 1
+    20   Stack_D = Reg_0
+    20   call Sym_14
+    21   goto Label_3
+    21 label Label_4
+    21   no-op
+           optimizes label Label_2
+    21 }
+
+    23 function Sym_15 {
+    24 label Label_6
+    25   Reg_0 = Data_0
+    25   Stack_D = Reg_0
+    25   Reg_0 = 5
+    25   Stack_D = Reg_0
+    25   call Sym_16
+    26   call Sym_17
+    26   call Sym_18
+    26   call Sym_19
+    26   call Sym_12
+    26   call Sym_20
+    27   no-op
+           optimizes   call Sym_9
+    17   call Sym_10
+    18 label Label_24
+    19   call Sym_4
+    19   no-op
+           optimizes   call Sym_11
+    19   Reg_0 = Stack_D
+    19   if Reg_0 <= 0 goto Label_25
+    19   no-op
+           optimizes   Reg_0 = Stack_D
+    19   no-op
+           optimizes   if Reg_0 == 0 goto Label_25
+    19   call Sym_12
+    19   call Sym_13
+    19   call Sym_5
+    19   no-op
+           optimizes   call Sym_6
+    19   Reg_1 = Stack_D
+    19   Reg_0 = Stack_D
+    19   if Reg_0 != Reg_1 goto Label_25
+    19   no-op
+           optimizes   Reg_0 = Stack_D
+    19   no-op
+           optimizes   if Reg_0 == 0 goto Label_25
+    20   Reg_0 = 1
+    20   Stack_D = Reg_0
+    20   call Sym_14
+    21   goto Label_24
+    21 label Label_25
+    28   call Sym_4
+    28   no-op
+           optimizes   call Sym_11
+    28   Reg_0 = Stack_D
+    28   if Reg_0 <= 0 goto Label_8
+    28   no-op
+           optimizes   Reg_0 = Stack_D
+    28   no-op
+           optimizes   if Reg_0 == 0 goto Label_8
+    29   call Sym_21
+    29   tail call Sym_22
+           optimizes   call Sym_22
+    30   no-op
+           optimizes   goto Label_5
+    31 label Label_8
+    32   call Sym_22
+    33   goto Label_6
+    33   no-op
+           optimizes label Label_7
+    33   no-op
+           optimizes label Label_5
+    33 }
+
+    35 function Sym_23 {
+    36   call Sym_4
+    36   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_2)
+    36   Stack_D = Reg_0
+    36   call Sym_7
+    36   call Sym_24
+    37   call Sym_25
+    37   call Sym_25
+    38   Reg_0 = 0
+    38   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    38   no-op
+           optimizes   Reg_1 = Stack_D
+    38   Reg_0 = Stack_D
+    38   if Reg_0 == Reg_1 goto Label_10
+    38   Stack_R = Reg_0
+    38   Stack_R = Reg_1
+    38 label Label_11
+    39   call Sym_4
+    39   call Sym_13
+    40   no-op
+           optimizes   call Sym_3
+    14   call Sym_4
+    14   call Sym_5
+    14   no-op
+           optimizes   call Sym_6
+    14   Reg_1 = Stack_D
+    14   Reg_0 = Stack_D
+    14   Reg_0 = Reg_0 == Reg_1
+    14   Stack_D = Reg_0
+    14   call Sym_7
+    14   Reg_0 = 9
+           optimizes   Reg_0 = *(Sym_1)
+    14   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    14   no-op
+           optimizes   call Sym_6
+    14   no-op
+           optimizes   Reg_1 = Stack_D
+    14   Reg_0 = Stack_D
+    14   Reg_0 = Reg_0 == Reg_1
+    14   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    14   no-op
+           optimizes   call Sym_8
+    14   no-op
+           optimizes   Reg_1 = Stack_D
+    14   Reg_0 = Stack_D
+    14   Reg_0 |= Reg_1
+    14   no-op
+           optimizes   Stack_D = Reg_0
+    40   no-op
+           optimizes   Reg_0 = Stack_D
+    40   if Reg_0 == 0 goto Label_13
+    41   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_2)
+    41   Stack_D = Reg_0
+    41   call Sym_12
+    41   call Sym_26
+    42   goto Label_14
+    42 label Label_13
+    43   call Sym_27
+    43   no-op
+           optimizes   call Sym_28
+    43   Reg_0 = Stack_D
+    43   if Reg_0 != 0 goto Label_15
+    43   no-op
+           optimizes   Reg_0 = Stack_D
+    43   no-op
+           optimizes   if Reg_0 == 0 goto Label_15
+    43   no-op
+           optimizes   call Sym_29
+    43   Reg_0 = -1
+    43   Stack_D = Reg_0
+    43   goto Label_16
+    43 label Label_15
+    44   call Sym_4
+    44   no-op
+           optimizes   call Sym_30
+    44   Reg_0 = Stack_D
+    44   Reg_0 -= 1
+    44   Stack_D = Reg_0
+    44   call Sym_13
+    44   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_2)
+    44   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    44   no-op
+           optimizes   call Sym_6
+    44   no-op
+           optimizes   Reg_1 = Stack_D
+    44   Reg_0 = Stack_D
+    44   Reg_0 = Reg_0 == Reg_1
+    44   Stack_D = Reg_0
+    45 label Label_16
+    46   Reg_0 = Stack_D
+    46   if Reg_0 == 0 goto Label_17
+    47   call Sym_17
+    47   call Sym_7
+    47   call Sym_24
+    48   call Sym_19
+    48   no-op
+           optimizes   call Sym_31
+    48   Reg_0 = Stack_D
+    48   Reg_0 += 4
+    48   Stack_D = Reg_0
+    49   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_2)
+    49   Stack_D = Reg_0
+    49   call Sym_12
+    49   call Sym_24
+    49   call Sym_20
+    50 label Label_17
+    51 label Label_14
+    52   call Sym_32
+    53   Reg_1 = Stack_R
+    53   Reg_1 += 1
+    53   Reg_0 = Stack_R
+    53   Stack_R = Reg_0
+    53   Stack_R = Reg_1
+    53   Reg_1 -= Reg_0
+    53   if Reg_1 != 0 goto Label_11
+    53   no-op
+           optimizes label Label_12
+    53   Reg_0 = Stack_R
+    53   Reg_0 = Stack_R
+    53 label Label_10
+    54   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_2)
+    54   Stack_D = Reg_0
+    54   call Sym_7
+    54   call Sym_26
+    54   tail call Sym_33
+           optimizes   call Sym_33
+    54   no-op
+           optimizes label Label_9
+    54 }
+
+    10 function Sym_0 {
+    10   Reg_0 = 9
+    10   no-op
+           optimizes   Stack_D = Reg_0
+    10   no-op
+           optimizes   Reg_0 = Stack_D
+    10   *(Sym_1) = Reg_0
+    11   Reg_0 = 0
+    11   no-op
+           optimizes   Stack_D = Reg_0
+    11   no-op
+           optimizes   Reg_0 = Stack_D
+    11   *(Sym_2) = Reg_0
+    61 label Label_18
+    62   Reg_0 = Sym_34
+    62   Stack_D = Reg_0
+    62   Reg_0 = 1024
+    62   Stack_D = Reg_0
+    62   no-op
+           optimizes   call Sym_15
+    24 label Label_26
+    25   Reg_0 = Data_0
+    25   Stack_D = Reg_0
+    25   Reg_0 = 5
+    25   Stack_D = Reg_0
+    25   call Sym_16
+    26   call Sym_17
+    26   call Sym_18
+    26   call Sym_19
+    26   call Sym_12
+    26   call Sym_20
+    27   no-op
+           optimizes   call Sym_9
+    17   call Sym_10
+    18 label Label_29
+    19   call Sym_4
+    19   no-op
+           optimizes   call Sym_11
+    19   Reg_0 = Stack_D
+    19   if Reg_0 <= 0 goto Label_30
+    19   no-op
+           optimizes   Reg_0 = Stack_D
+    19   no-op
+           optimizes   if Reg_0 == 0 goto Label_30
+    19   call Sym_12
+    19   call Sym_13
+    19   call Sym_5
+    19   no-op
+           optimizes   call Sym_6
+    19   Reg_1 = Stack_D
+    19   Reg_0 = Stack_D
+    19   if Reg_0 != Reg_1 goto Label_30
+    19   no-op
+           optimizes   Reg_0 = Stack_D
+    19   no-op
+           optimizes   if Reg_0 == 0 goto Label_30
+    20   Reg_0 = 1
+    20   Stack_D = Reg_0
+    20   call Sym_14
+    21   goto Label_29
+    21 label Label_30
+    28   call Sym_4
+    28   no-op
+           optimizes   call Sym_11
+    28   Reg_0 = Stack_D
+    28   if Reg_0 <= 0 goto Label_27
+    28   no-op
+           optimizes   Reg_0 = Stack_D
+    28   no-op
+           optimizes   if Reg_0 == 0 goto Label_27
+    29   call Sym_21
+    29   call Sym_22
+    30   goto Label_28
+    31 label Label_27
+    32   call Sym_22
+    33   goto Label_26
+    33 label Label_28
+    64   call Sym_17
+    64   Reg_0 = Data_1
+    64   Stack_D = Reg_0
+    64   Reg_0 = 4
+    64   Stack_D = Reg_0
+    64   call Sym_36
+    64   no-op
+           optimizes   call Sym_37
+    64   Reg_0 = Stack_D
+    64   if Reg_0 == 0 goto Label_19
+    64   no-op
+           optimizes   Reg_0 = Stack_D
+    64   no-op
+           optimizes   if Reg_0 == 0 goto Label_19
+    65   call Sym_38
+    66   Reg_0 = 0
+    66   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    66   no-op
+           optimizes   Reg_1 = Stack_D
+    66   Reg_0 = Stack_D
+    66   Stack_D = Reg_0
+    66   if Reg_0 != Reg_1 goto Label_21
+    68   call Sym_33
+    69   Reg_0 = Sym_35
+    69   Stack_D = Reg_0
+    69   call Sym_23
+    70   call Sym_39
+    71   Reg_0 = Sym_35
+    71   Stack_D = Reg_0
+    72   no-op
+           optimizes   Reg_0 = Sym_35
+    72   no-op
+           optimizes   Stack_D = Reg_0
+    72   no-op
+           optimizes   call Sym_40
+    72   Reg_0 = *(Sym_35)
+    72   Stack_D = Reg_0
+    73   call Sym_41
+    73   call Sym_33
+    74   Reg_0 = Data_2
+    74   Stack_D = Reg_0
+    74   Reg_0 = 4
+    74   Stack_D = Reg_0
+    74   call Sym_42
+    74   call Sym_43
+    75   Reg_0 = 127
+    75   Stack_D = Reg_0
+    75   call Sym_44
+    76   goto Label_20
+    76 label Label_21
+    77   Reg_0 = -1
+    77   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    77   no-op
+           optimizes   Reg_1 = Stack_D
+    77   Reg_0 = Stack_D
+    77   Stack_D = Reg_0
+    77   if Reg_0 != Reg_1 goto Label_22
+    79   Reg_0 = Data_3
+    79   Stack_D = Reg_0
+    79   Reg_0 = 4
+    79   Stack_D = Reg_0
+    79   call Sym_42
+    79   call Sym_43
+    80   goto Label_20
+    80 label Label_22
+    82   call Sym_4
+    82   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_2)
+    82   Stack_D = Reg_0
+    82   no-op
+           optimizes   Reg_0 = *(Sym_2)
+    82   Stack_D = Reg_0
+    82   call Sym_25
+    83   call Sym_45
+    83   no-op
+           optimizes   call Sym_28
+    83   Reg_0 = Stack_D
+    83   if Reg_0 != 0 goto Label_23
+    83   no-op
+           optimizes   Reg_0 = Stack_D
+    83   no-op
+           optimizes   if Reg_0 == 0 goto Label_23
+    84   Reg_0 = Data_4
+    84   Stack_D = Reg_0
+    84   Reg_0 = 4
+    84   Stack_D = Reg_0
+    84   call Sym_42
+    84   call Sym_43
+    85   Reg_0 = 1
+    85   Stack_D = Reg_0
+    85   call Sym_44
+    86 label Label_23
+    87 label Label_20
+    87   Reg_0 = Stack_D
+    87   call Sym_22
+    88   goto Label_18
+    88 label Label_19
+    88   call Sym_22
+    90   Reg_0 = 0
+    90   Stack_D = Reg_0
+    90   tail call Sym_33
+           optimizes   call Sym_33
+    90   no-op
+           optimizes label Label_0
+    90 }
+
+Peephole rewrites:
+  v4_is_Minusspace: exchange-pop: xchg %edx,%eax; call v4__dpop; xchg %eax,%edx => call v4__dpop; mov %eax,%edx
+  v4_trimstring: exchange-pop: xchg %edx,%eax; call v4__dpop; xchg %eax,%edx => call v4__dpop; mov %eax,%edx
+  v4_getline: exchange-pop: xchg %edx,%eax; call v4__dpop; xchg %eax,%edx => call v4__dpop; mov %eax,%edx
+  v4_tokenize: exchange-pop: xchg %edx,%eax; call v4__dpop; xchg %eax,%edx => call v4__dpop; mov %eax,%edx
+  v4_tokenize: redundant-test: test %eax,%eax => (none)
+  v4_tokenize: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_tokenize: redundant-test: test %edx,%edx => (none)
+  main: exchange-pop: xchg %edx,%eax; call v4__dpop; xchg %eax,%edx => call v4__dpop; mov %eax,%edx
+
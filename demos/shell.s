@@ -0,0 +1,626 @@
+	.file	"shell.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/demos/",100,0,0,Ltext0
+.stabs	"shell.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC0:
+	.string "4th> "
+.LC2:
+	.string "exec"
+.LC1:
+	.string "exit"
+.LC3:
+	.string "fork"
+.LC4:
+	.string "wait"
+.stabs	"v4_cmd:Gar2;0;1023;4",40,0,0,v4_cmd
+	.comm  v4_cmd,1024,32
+.stabs	"v4_exec_Minusargv:Gar2;0;255;2",40,0,0,v4_exec_Minusargv
+	.comm  v4_exec_Minusargv,1024,32
+.stabs	"v4_null:G2",40,0,0,v4_null
+	.comm  v4_null,4,4
+.stabs	"v4_tab:G2",40,0,0,v4_tab
+	.comm  v4_tab,4,4
+.text
+	.align 4
+.stabs "v4_is_Minusspace:F1",36,0,0,v4_is_Minusspace
+.globl v4_is_Minusspace
+	.type	v4_is_Minusspace,@function
+v4_is_Minusspace:
+.stabn 68,0,13,.LMa0-v4_is_Minusspace
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,13,.LMb0-v4_is_Minusspace
+.LMb0:
+.LBB3:
+.stabn 68,0,14,.LM1-v4_is_Minusspace
+.LM1:
+	call v4_dup
+	call v4_bl
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_swap
+	mov $9,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	call v4__dpop
+	or %edx,%eax
+	call v4__dpush
+.LBE3:
+.stabn 68,0,14,.LM22-v4_is_Minusspace
+.LM22:
+	pop %ebx
+	leave
+	ret
+.Lfe3:
+	.size	 v4_is_Minusspace,.Lfe3-v4_is_Minusspace
+.stabn	192,0,0,.LBB3-v4_is_Minusspace
+.stabn	224,0,0,.LBE3-v4_is_Minusspace
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4_is_Minusspace
+.text
+	.align 4
+.stabs "v4_trimstring:F1",36,0,0,v4_trimstring
+.globl v4_trimstring
+	.type	v4_trimstring,@function
+v4_trimstring:
+.stabn 68,0,16,.LMa23-v4_trimstring
+.LMa23:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,16,.LMb23-v4_trimstring
+.LMb23:
+.LBB9:
+.stabn 68,0,17,.LM24-v4_trimstring
+.LM24:
+	call v4_Minustrailing
+.L3:
+.stabn 68,0,19,.LM26-v4_trimstring
+.LM26:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jle .L4
+	call v4_over
+	call v4_c_Fetch
+	call v4_bl
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L4
+.stabn 68,0,20,.LM41-v4_trimstring
+.LM41:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Slashstring
+.stabn 68,0,21,.LM44-v4_trimstring
+.LM44:
+	jmp .L3
+.L4:
+.LBE9:
+.stabn 68,0,21,.LM47-v4_trimstring
+.LM47:
+	pop %ebx
+	leave
+	ret
+.Lfe9:
+	.size	 v4_trimstring,.Lfe9-v4_trimstring
+.stabn	192,0,0,.LBB9-v4_trimstring
+.stabn	224,0,0,.LBE9-v4_trimstring
+.Lscope9:
+.stabs	"",36,0,0,.Lscope9-v4_trimstring
+.text
+	.align 4
+.stabs "v4_getline:F1",36,0,0,v4_getline
+.globl v4_getline
+	.type	v4_getline,@function
+v4_getline:
+.stabn 68,0,23,.LMa48-v4_getline
+.LMa48:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,23,.LMb48-v4_getline
+.LMb48:
+.LBB15:
+.L6:
+.stabn 68,0,25,.LM50-v4_getline
+.LM50:
+	lea .LC0,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,26,.LM55-v4_getline
+.LM55:
+	call v4_z2dup
+	call v4_accept
+	call v4_Greaterr
+	call v4_over
+	call v4_r_Greater
+.stabn 68,0,17,.LM61-v4_getline
+.LM61:
+	call v4_Minustrailing
+.L24:
+.stabn 68,0,19,.LM63-v4_getline
+.LM63:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jle .L25
+	call v4_over
+	call v4_c_Fetch
+	call v4_bl
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L25
+.stabn 68,0,20,.LM78-v4_getline
+.LM78:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Slashstring
+.stabn 68,0,21,.LM81-v4_getline
+.LM81:
+	jmp .L24
+.L25:
+.stabn 68,0,28,.LM83-v4_getline
+.LM83:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jle .L8
+.stabn 68,0,29,.LM89-v4_getline
+.LM89:
+	call v4_z2swap
+	pop %ebx
+	leave
+	jmp v4_z2drop
+.L8:
+.stabn 68,0,32,.LM93-v4_getline
+.LM93:
+	call v4_z2drop
+.stabn 68,0,33,.LM94-v4_getline
+.LM94:
+	jmp .L6
+.LBE15:
+.stabn 68,0,33,.LM97-v4_getline
+.LM97:
+	pop %ebx
+	leave
+	ret
+.Lfe15:
+	.size	 v4_getline,.Lfe15-v4_getline
+.stabn	192,0,0,.LBB15-v4_getline
+.stabn	224,0,0,.LBE15-v4_getline
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4_getline
+.text
+	.align 4
+.stabs "v4_tokenize:F1",36,0,0,v4_tokenize
+.globl v4_tokenize
+	.type	v4_tokenize,@function
+v4_tokenize:
+.stabn 68,0,35,.LMa98-v4_tokenize
+.LMa98:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,35,.LMb98-v4_tokenize
+.LMb98:
+.LBB23:
+.stabn 68,0,36,.LM99-v4_tokenize
+.LM99:
+	call v4_dup
+	xor %eax,%eax
+	call v4__dpush
+	call v4_swap
+	call v4_Store
+.stabn 68,0,37,.LM104-v4_tokenize
+.LM104:
+	call v4_rot
+	call v4_rot
+.stabn 68,0,38,.LM106-v4_tokenize
+.LM106:
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %eax,%edx
+	je .L10
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L11:
+.stabn 68,0,39,.LM114-v4_tokenize
+.LM114:
+	call v4_dup
+	call v4_c_Fetch
+.stabn 68,0,14,.LM117-v4_tokenize
+.LM117:
+	call v4_dup
+	call v4_bl
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_swap
+	mov $9,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	call v4__dpop
+	or %edx,%eax
+	je .L13
+.stabn 68,0,41,.LM139-v4_tokenize
+.LM139:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_over
+	call v4_c_Store
+.stabn 68,0,42,.LM143-v4_tokenize
+.LM143:
+	jmp .L14
+.L13:
+.stabn 68,0,43,.LM145-v4_tokenize
+.LM145:
+	call v4_i
+	call v4__dpop
+	test %eax,%eax
+	jne .L15
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	jmp .L16
+.L15:
+.stabn 68,0,44,.LM156-v4_tokenize
+.LM156:
+	call v4_dup
+	call v4__dpop
+	dec %eax
+	call v4__dpush
+	call v4_c_Fetch
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+.L16:
+.stabn 68,0,46,.LM170-v4_tokenize
+.LM170:
+	call v4__dpop
+	test %eax,%eax
+	je .L17
+.stabn 68,0,47,.LM172-v4_tokenize
+.LM172:
+	call v4_z2dup
+	call v4_swap
+	call v4_Store
+.stabn 68,0,48,.LM175-v4_tokenize
+.LM175:
+	call v4_Greaterr
+	call v4__dpop
+	add $4,%eax
+	call v4__dpush
+.stabn 68,0,49,.LM180-v4_tokenize
+.LM180:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_over
+	call v4_Store
+	call v4_r_Greater
+.L17:
+.L14:
+.stabn 68,0,52,.LM187-v4_tokenize
+.LM187:
+	call v4_char_Plus
+.stabn 68,0,53,.LM188-v4_tokenize
+.LM188:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L11
+	call v4__rpop
+	call v4__rpop
+.L10:
+.stabn 68,0,54,.LM199-v4_tokenize
+.LM199:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_swap
+	call v4_c_Store
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE23:
+.stabn 68,0,54,.LM205-v4_tokenize
+.LM205:
+	pop %ebx
+	leave
+	ret
+.Lfe23:
+	.size	 v4_tokenize,.Lfe23-v4_tokenize
+.stabn	192,0,0,.LBB23-v4_tokenize
+.stabn	224,0,0,.LBE23-v4_tokenize
+.Lscope23:
+.stabs	"",36,0,0,.Lscope23-v4_tokenize
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,10,.LMa206-main
+.LMa206:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,10,.LMb206-main
+.LMb206:
+.LBB0:
+	mov $9,%eax
+	mov %eax,(v4_tab)
+.stabn 68,0,11,.LM211-main
+.LM211:
+	xor %eax,%eax
+	mov %eax,(v4_null)
+.L18:
+.stabn 68,0,62,.LM216-main
+.LM216:
+	lea v4_cmd,%eax
+	call v4__dpush
+	mov $1024,%eax
+	call v4__dpush
+.L26:
+.stabn 68,0,25,.LM222-main
+.LM222:
+	lea .LC0,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,26,.LM227-main
+.LM227:
+	call v4_z2dup
+	call v4_accept
+	call v4_Greaterr
+	call v4_over
+	call v4_r_Greater
+.stabn 68,0,17,.LM233-main
+.LM233:
+	call v4_Minustrailing
+.L29:
+.stabn 68,0,19,.LM235-main
+.LM235:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jle .L30
+	call v4_over
+	call v4_c_Fetch
+	call v4_bl
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L30
+.stabn 68,0,20,.LM250-main
+.LM250:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Slashstring
+.stabn 68,0,21,.LM253-main
+.LM253:
+	jmp .L29
+.L30:
+.stabn 68,0,28,.LM255-main
+.LM255:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jle .L27
+.stabn 68,0,29,.LM261-main
+.LM261:
+	call v4_z2swap
+	call v4_z2drop
+.stabn 68,0,30,.LM263-main
+.LM263:
+	jmp .L28
+.L27:
+.stabn 68,0,32,.LM265-main
+.LM265:
+	call v4_z2drop
+.stabn 68,0,33,.LM266-main
+.LM266:
+	jmp .L26
+.L28:
+.stabn 68,0,64,.LM268-main
+.LM268:
+	call v4_z2dup
+	lea .LC1,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_compare
+	call v4__dpop
+	test %eax,%eax
+	je .L19
+.stabn 68,0,65,.LM279-main
+.LM279:
+	call v4__fork
+.stabn 68,0,66,.LM280-main
+.LM280:
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	call v4__dpush
+	cmp %eax,%edx
+	jne .L21
+.stabn 68,0,68,.LM286-main
+.LM286:
+	call v4_drop
+.stabn 68,0,69,.LM287-main
+.LM287:
+	lea v4_exec_Minusargv,%eax
+	call v4__dpush
+	call v4_tokenize
+.stabn 68,0,70,.LM290-main
+.LM290:
+	call v4_envp
+.stabn 68,0,71,.LM291-main
+.LM291:
+	lea v4_exec_Minusargv,%eax
+	call v4__dpush
+	mov (v4_exec_Minusargv),%eax
+	call v4__dpush
+.stabn 68,0,73,.LM298-main
+.LM298:
+	call v4__execve
+	call v4_drop
+.stabn 68,0,74,.LM300-main
+.LM300:
+	lea .LC2,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_perror
+	call v4_cr
+.stabn 68,0,75,.LM306-main
+.LM306:
+	mov $127,%eax
+	call v4__dpush
+	call v4__exit
+.stabn 68,0,76,.LM309-main
+.LM309:
+	jmp .L20
+.L21:
+.stabn 68,0,77,.LM311-main
+.LM311:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	call v4__dpop
+	call v4__dpush
+	cmp %eax,%edx
+	jne .L22
+.stabn 68,0,79,.LM317-main
+.LM317:
+	lea .LC3,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_perror
+	call v4_cr
+.stabn 68,0,80,.LM323-main
+.LM323:
+	jmp .L20
+.L22:
+.stabn 68,0,82,.LM325-main
+.LM325:
+	call v4_dup
+	xor %eax,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_rot
+.stabn 68,0,83,.LM331-main
+.LM331:
+	call v4__waitpid
+	call v4__dpop
+	test %eax,%eax
+	jne .L23
+.stabn 68,0,84,.LM337-main
+.LM337:
+	lea .LC4,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_perror
+	call v4_cr
+.stabn 68,0,85,.LM343-main
+.LM343:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4__exit
+.L23:
+.L20:
+	call v4__dpop
+	call v4_z2drop
+.stabn 68,0,88,.LM350-main
+.LM350:
+	jmp .L18
+.L19:
+	call v4_z2drop
+.stabn 68,0,90,.LM353-main
+.LM353:
+	xor %eax,%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE0:
+.stabn 68,0,90,.LM357-main
+.LM357:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 main,.Lfe0-main
+.stabn	192,0,0,.LBB0-main
+.stabn	224,0,0,.LBE0-main
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,244 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: sleep.ft
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug optimize intermediate assembly
+
+Data:
+    23 Data_2 string[8] " seconds"
+    30 Data_4 string[6] "--help"
+    29 Data_3 string[2] "-h"
+    41 Data_5 string[23] ": invalid time interval"
+    23 Data_1 string[7] "Usage: "
+    18 Data_0 string[9] "nanosleep"
+
+Symbols:
+     8 Sym_0 word "main"
+    17 Sym_7 external "v4_Equals"
+    38 Sym_21 external "v4_Greaternumber"
+    33 Sym_19 external "v4_Less_Greater"
+    15 Sym_4 external "v4_Store"
+    19 Sym_10 external "v4__exit"
+    16 Sym_6 external "v4__nanosleep"
+    23 Sym_12 external "v4__type"
+    23 Sym_13 external "v4_arg"
+    28 Sym_15 external "v4_argc"
+    15 Sym_5 external "v4_cell_Plus"
+    29 Sym_16 external "v4_compare"
+    18 Sym_9 external "v4_cr"
+    44 Sym_24 external "v4_d_Greaters"
+    44 Sym_23 external "v4_drop"
+     8 Sym_1 constant "v4_null"
+    30 Sym_18 external "v4_or"
+    18 Sym_8 external "v4_pperror"
+    12 Sym_2 variable Cell[2] "v4_req"
+    38 Sym_20 external "v4_s_Greaterd"
+    14 Sym_3 word "v4_sleep"
+    23 Sym_14 external "v4_type"
+    22 Sym_11 word "v4_usage"
+    29 Sym_17 external "v4_z0_Equals"
+    39 Sym_22 external "v4_z0_Less_Greater"
+
+Intermediate code:
+    14 function Sym_3 {
+    15   no-op
+           optimizes   Reg_0 = Sym_2
+    15   no-op
+           optimizes   Stack_D = Reg_0
+    15   no-op
+           optimizes   call Sym_4
+    15   Reg_0 = Stack_D
+    15   *(Sym_2) = Reg_0
+    15   Reg_0 = 0
+    15   Stack_D = Reg_0
+    15   Reg_0 = Sym_2
+    15   no-op
+           optimizes   Stack_D = Reg_0
+    15   no-op
+           optimizes   call Sym_5
+    15   no-op
+           optimizes   Reg_0 = Stack_D
+    15   Reg_0 += 4
+    15   Stack_D = Reg_0
+    15   call Sym_4
+    16   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_1)
+    16   Stack_D = Reg_0
+    16   Reg_0 = Sym_2
+    16   Stack_D = Reg_0
+    16   call Sym_6
+    17   Reg_0 = -1
+    17   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    17   no-op
+           optimizes   call Sym_7
+    17   no-op
+           optimizes   Reg_1 = Stack_D
+    17   Reg_0 = Stack_D
+    17   if Reg_0 != Reg_1 goto Label_2
+    17   no-op
+           optimizes   Reg_0 = Stack_D
+    17   no-op
+           optimizes   if Reg_0 == 0 goto Label_2
+    18   Reg_0 = Data_0
+    18   Stack_D = Reg_0
+    18   Reg_0 = 9
+    18   Stack_D = Reg_0
+    18   call Sym_8
+    18   call Sym_9
+    19   Reg_0 = 1
+    19   Stack_D = Reg_0
+    19   tail call Sym_10
+           optimizes   call Sym_10
+    20 label Label_2
+    20   no-op
+           optimizes label Label_1
+    20 }
+
+    22 function Sym_11 {
+    23   Reg_0 = Data_1
+    23   Stack_D = Reg_0
+    23   Reg_0 = 7
+    23   Stack_D = Reg_0
+    23   call Sym_12
+    23   Reg_0 = 0
+    23   Stack_D = Reg_0
+    23   call Sym_13
+    23   call Sym_14
+    23   Reg_0 = Data_2
+    23   Stack_D = Reg_0
+    23   Reg_0 = 8
+    23   Stack_D = Reg_0
+    23   call Sym_12
+    23   tail call Sym_9
+           optimizes   call Sym_9
+    23   no-op
+           optimizes label Label_3
+    23 }
+
+     8 function Sym_0 {
+     8   Reg_0 = 0
+     8   no-op
+           optimizes   Stack_D = Reg_0
+     8   no-op
+           optimizes   Reg_0 = Stack_D
+     8   *(Sym_1) = Reg_0
+    28   call Sym_15
+    28   Reg_0 = 2
+    28   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    28   no-op
+           optimizes   call Sym_7
+    28   no-op
+           optimizes   Reg_1 = Stack_D
+    28   Reg_0 = Stack_D
+    28   if Reg_0 != Reg_1 goto Label_4
+    28   no-op
+           optimizes   Reg_0 = Stack_D
+    28   no-op
+           optimizes   if Reg_0 == 0 goto Label_4
+    29   Reg_0 = 1
+    29   Stack_D = Reg_0
+    29   call Sym_13
+    29   Reg_0 = Data_3
+    29   Stack_D = Reg_0
+    29   Reg_0 = 2
+    29   Stack_D = Reg_0
+    29   call Sym_16
+    29   no-op
+           optimizes   call Sym_17
+    29   Reg_0 = Stack_D
+    29   Reg_0 = Reg_0 == 0
+    29   Stack_D = Reg_0
+    30   Reg_0 = 1
+    30   Stack_D = Reg_0
+    30   call Sym_13
+    30   Reg_0 = Data_4
+    30   Stack_D = Reg_0
+    30   Reg_0 = 6
+    30   Stack_D = Reg_0
+    30   call Sym_16
+    30   no-op
+           optimizes   call Sym_17
+    30   Reg_0 = Stack_D
+    30   Reg_0 = Reg_0 == 0
+    30   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    30   no-op
+           optimizes   call Sym_18
+    30   no-op
+           optimizes   Reg_1 = Stack_D
+    30   Reg_0 = Stack_D
+    30   Reg_0 |= Reg_1
+    30   no-op
+           optimizes   Stack_D = Reg_0
+    30   no-op
+           optimizes   Reg_0 = Stack_D
+    30   if Reg_0 == 0 goto Label_5
+    31   call Sym_11
+    31   Reg_0 = 0
+    31   Stack_D = Reg_0
+    31   call Sym_10
+    32 label Label_5
+    32 label Label_4
+    33   call Sym_15
+    33   Reg_0 = 2
+    33   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    33   no-op
+           optimizes   call Sym_19
+    33   no-op
+           optimizes   Reg_1 = Stack_D
+    33   Reg_0 = Stack_D
+    33   if Reg_0 == Reg_1 goto Label_6
+    33   no-op
+           optimizes   Reg_0 = Stack_D
+    33   no-op
+           optimizes   if Reg_0 == 0 goto Label_6
+    34   call Sym_11
+    34   Reg_0 = 1
+    34   Stack_D = Reg_0
+    34   call Sym_10
+    35 label Label_6
+    38   Reg_0 = 0
+    38   Stack_D = Reg_0
+    38   call Sym_20
+    38   Reg_0 = 1
+    38   Stack_D = Reg_0
+    38   call Sym_13
+    38   call Sym_21
+    39   no-op
+           optimizes   call Sym_22
+    39   Reg_0 = Stack_D
+    39   if Reg_0 == 0 goto Label_7
+    39   no-op
+           optimizes   Reg_0 = Stack_D
+    39   no-op
+           optimizes   if Reg_0 == 0 goto Label_7
+    40   Reg_0 = 0
+    40   Stack_D = Reg_0
+    40   call Sym_13
+    40   call Sym_14
+    41   Reg_0 = Data_5
+    41   Stack_D = Reg_0
+    41   Reg_0 = 23
+    41   Stack_D = Reg_0
+    41   call Sym_12
+    42   call Sym_9
+    42   Reg_0 = 1
+    42   Stack_D = Reg_0
+    42   call Sym_10
+    43 label Label_7
+    44   call Sym_23
+    44   call Sym_24
+    45   call Sym_3
+    47   Reg_0 = 0
+    47   Stack_D = Reg_0
+    47   tail call Sym_23
+           optimizes   call Sym_23
+    47   no-op
+           optimizes label Label_0
+    47 }
+
+Peephole rewrites:
+  main: redundant-test: test %eax,%eax => (none)
+
@@ -0,0 +1,295 @@
+	.file	"sleep.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/demos/",100,0,0,Ltext0
+.stabs	"sleep.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC2:
+	.string " seconds"
+.LC4:
+	.string "--help"
+.LC3:
+	.string "-h"
+.LC5:
+	.string ": invalid time interval"
+.LC1:
+	.string "Usage: "
+.LC0:
+	.string "nanosleep"
+.stabs	"v4_null:G2",40,0,0,v4_null
+	.comm  v4_null,4,4
+.stabs	"v4_req:Gar2;0;1;2",40,0,0,v4_req
+	.comm  v4_req,8,4
+.text
+	.align 4
+.stabs "v4_sleep:F1",36,0,0,v4_sleep
+.globl v4_sleep
+	.type	v4_sleep,@function
+v4_sleep:
+.stabn 68,0,14,.LMa0-v4_sleep
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,14,.LMb0-v4_sleep
+.LMb0:
+.LBB3:
+	call v4__dpop
+	mov %eax,(v4_req)
+	xor %eax,%eax
+	call v4__dpush
+	lea v4_req,%eax
+	add $4,%eax
+	call v4__dpush
+	call v4_Store
+.stabn 68,0,16,.LM15-v4_sleep
+.LM15:
+	xor %eax,%eax
+	call v4__dpush
+	lea v4_req,%eax
+	call v4__dpush
+	call v4__nanosleep
+.stabn 68,0,17,.LM20-v4_sleep
+.LM20:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L2
+.stabn 68,0,18,.LM28-v4_sleep
+.LM28:
+	lea .LC0,%eax
+	call v4__dpush
+	mov $9,%eax
+	call v4__dpush
+	call v4_pperror
+	call v4_cr
+.stabn 68,0,19,.LM34-v4_sleep
+.LM34:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4__exit
+.L2:
+.LBE3:
+.stabn 68,0,20,.LM39-v4_sleep
+.LM39:
+	pop %ebx
+	leave
+	ret
+.Lfe3:
+	.size	 v4_sleep,.Lfe3-v4_sleep
+.stabn	192,0,0,.LBB3-v4_sleep
+.stabn	224,0,0,.LBE3-v4_sleep
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4_sleep
+.text
+	.align 4
+.stabs "v4_usage:F1",36,0,0,v4_usage
+.globl v4_usage
+	.type	v4_usage,@function
+v4_usage:
+.stabn 68,0,22,.LMa40-v4_usage
+.LMa40:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,22,.LMb40-v4_usage
+.LMb40:
+.LBB11:
+.stabn 68,0,23,.LM41-v4_usage
+.LM41:
+	lea .LC1,%eax
+	call v4__dpush
+	mov $7,%eax
+	call v4__dpush
+	call v4__type
+	xor %eax,%eax
+	call v4__dpush
+	call v4_arg
+	call v4_type
+	lea .LC2,%eax
+	call v4__dpush
+	mov $8,%eax
+	call v4__dpush
+	call v4__type
+	pop %ebx
+	leave
+	jmp v4_cr
+.LBE11:
+.stabn 68,0,23,.LM57-v4_usage
+.LM57:
+	pop %ebx
+	leave
+	ret
+.Lfe11:
+	.size	 v4_usage,.Lfe11-v4_usage
+.stabn	192,0,0,.LBB11-v4_usage
+.stabn	224,0,0,.LBE11-v4_usage
+.Lscope11:
+.stabs	"",36,0,0,.Lscope11-v4_usage
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,8,.LMa58-main
+.LMa58:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,8,.LMb58-main
+.LMb58:
+.LBB0:
+	xor %eax,%eax
+	mov %eax,(v4_null)
+.stabn 68,0,28,.LM63-main
+.LM63:
+	call v4_argc
+	mov $2,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L4
+.stabn 68,0,29,.LM72-main
+.LM72:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	lea .LC3,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_compare
+	call v4__dpop
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+.stabn 68,0,30,.LM84-main
+.LM84:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	lea .LC4,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_compare
+	call v4__dpop
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	call v4__dpop
+	or %edx,%eax
+	je .L5
+.stabn 68,0,31,.LM103-main
+.LM103:
+	call v4_usage
+	xor %eax,%eax
+	call v4__dpush
+	call v4__exit
+.L5:
+.L4:
+.stabn 68,0,33,.LM109-main
+.LM109:
+	call v4_argc
+	mov $2,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	je .L6
+.stabn 68,0,34,.LM118-main
+.LM118:
+	call v4_usage
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4__exit
+.L6:
+.stabn 68,0,38,.LM123-main
+.LM123:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_arg
+	call v4_Greaternumber
+	call v4__dpop
+	test %eax,%eax
+	je .L7
+.stabn 68,0,40,.LM135-main
+.LM135:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_arg
+	call v4_type
+.stabn 68,0,41,.LM139-main
+.LM139:
+	lea .LC5,%eax
+	call v4__dpush
+	mov $23,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,42,.LM144-main
+.LM144:
+	call v4_cr
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4__exit
+.L7:
+.stabn 68,0,44,.LM149-main
+.LM149:
+	call v4_drop
+	call v4_d_Greaters
+.stabn 68,0,45,.LM151-main
+.LM151:
+	call v4_sleep
+.stabn 68,0,47,.LM152-main
+.LM152:
+	xor %eax,%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE0:
+.stabn 68,0,47,.LM156-main
+.LM156:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 main,.Lfe0-main
+.stabn	192,0,0,.LBB0-main
+.stabn	224,0,0,.LBE0-main
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,33 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: _dlmain.pp
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+    56 Sym_0 codeword "v4__dl_main"
+
+Intermediate code:
+    56 function Sym_0 {
+    57   asm (    lea .L_message@GOTOFF(%ebx),%ecx)
+    58   asm (    lea .L_message_end@GOTOFF(%ebx),%edx)
+    59   asm (    sub %ecx,%edx)
+    61   asm (    mov $1,%ebx)
+    62   asm (    mov $4,%eax)
+    63   asm (    int $0x80)
+    65   asm (    xor %ebx,%ebx)
+    66   asm (    mov $1,%eax)
+    67   asm (    int $0x80)
+    69   asm (    .section .rodata)
+    70   asm (    .L_message:)
+    71   asm (    .ascii "\nforthlib version 1.5 [build x86/1792234989]\n")
+    72   asm (    .ascii "Copyright (C) 2005-2013  Simon Baldwin\n\n")
+    73   asm (    .ascii "This program comes with ABSOLUTELY NO WARRANTY; for details\n")
+    74   asm (    .ascii "please see the file 'COPYING' supplied with the source code.\n")
+    75   asm (    .ascii "This is free software, and you are welcome to redistribute it\n")
+    76   asm (    .ascii "under certain conditions; again, see 'COPYING' for details.\n")
+    77   asm (    .ascii "This program is released under the GNU General Public License.\n")
+    78   asm (    .L_message_end:)
+    79   asm (    .text)
+    81   asm (    forth_pic.=0b-0b)
+    82 }
+
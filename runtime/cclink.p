@@ -0,0 +1,42 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: cclink.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+   145 Sym_2 codeword "v4_c_pop"
+   137 Sym_1 codeword "v4_c_push"
+   103 Sym_0 codeword "v4_cexecute"
+
+Intermediate code:
+   103 function Sym_0 {
+   104   asm (    call v4__dpop@PLT)
+   105   asm (    mov %eax,%esi)
+   106   asm (    call v4__dpop@PLT)
+   107   asm (    mov %eax,%edi)
+   109   asm (    test %eax,%eax)
+   110   asm (    jz 2f)
+   112   asm (    mov %eax,%ecx)
+   113   asm (1:)
+   114   asm (    call v4__dpop@PLT)
+   115   asm (    push %eax)
+   116   asm (    loop 1b)
+   118   asm (2:)
+   119   asm (    call *%esi)
+   120   asm (    call v4__dpush@PLT)
+   122   asm (    shl $2,%edi)
+   123   asm (    add %edi,%esp)
+   125   asm (    forth_pic.=0b-0b)
+   126 }
+
+   137 function Sym_1 {
+   138   asm (    mov 8(%ebp),%eax)
+   139   asm (    call v4__dpush@PLT)
+   141   asm (    forth_pic.=0b-0b)
+   142 }
+
+   145 function Sym_2 {
+   146   asm (    call v4__dpop@PLT)
+   148   asm (    forth_pic.=0b-0b)
+   149 }
+
@@ -0,0 +1,149 @@
+	.file	"cclink.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"cclink.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_cexecute:F1",36,0,0,v4_cexecute
+	.weak v4_cexecute
+	.type	v4_cexecute,@function
+v4_cexecute:
+.stabn 68,0,103,.LMa0-v4_cexecute
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,103,.LMb0-v4_cexecute
+.LMb0:
+.LBB0:
+#APP
+    call v4__dpop@PLT
+    mov %eax,%esi
+    call v4__dpop@PLT
+    mov %eax,%edi
+    test %eax,%eax
+    jz 2f
+    mov %eax,%ecx
+1:
+    call v4__dpop@PLT
+    push %eax
+    loop 1b
+2:
+    call *%esi
+    call v4__dpush@PLT
+    shl $2,%edi
+    add %edi,%esp
+    forth_pic.=0b-0b
+#NO_APP
+.LBE0:
+.stabn 68,0,126,.LM18-v4_cexecute
+.LM18:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_cexecute,.Lfe0-v4_cexecute
+.stabn	192,0,0,.LBB0-v4_cexecute
+.stabn	224,0,0,.LBE0-v4_cexecute
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_cexecute
+.text
+	.align 4
+.stabs "v4_c_push:F1",36,0,0,v4_c_push
+	.weak v4_c_push
+	.type	v4_c_push,@function
+v4_c_push:
+.stabn 68,0,137,.LMa19-v4_c_push
+.LMa19:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic1
+.Lpic1:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic1],%ebx
+0:
+.stabn 68,0,137,.LMb19-v4_c_push
+.LMb19:
+.LBB1:
+#APP
+    mov 8(%ebp),%eax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE1:
+.stabn 68,0,142,.LM23-v4_c_push
+.LM23:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe1:
+	.size	 v4_c_push,.Lfe1-v4_c_push
+.stabn	192,0,0,.LBB1-v4_c_push
+.stabn	224,0,0,.LBE1-v4_c_push
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4_c_push
+.text
+	.align 4
+.stabs "v4_c_pop:F1",36,0,0,v4_c_pop
+	.weak v4_c_pop
+	.type	v4_c_pop,@function
+v4_c_pop:
+.stabn 68,0,145,.LMa24-v4_c_pop
+.LMa24:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic2
+.Lpic2:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic2],%ebx
+0:
+.stabn 68,0,145,.LMb24-v4_c_pop
+.LMb24:
+.LBB2:
+#APP
+    call v4__dpop@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE2:
+.stabn 68,0,149,.LM27-v4_c_pop
+.LM27:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe2:
+	.size	 v4_c_pop,.Lfe2-v4_c_pop
+.stabn	192,0,0,.LBB2-v4_c_pop
+.stabn	224,0,0,.LBE2-v4_c_pop
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4_c_pop
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,237 @@
+	.file	"cells.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"cells.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_cell:F1",36,0,0,v4_cell
+	.weak v4_cell
+	.type	v4_cell,@function
+v4_cell:
+.stabn 68,0,26,.LMa0-v4_cell
+.LMa0:
+	push %ebx
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,26,.LMb0-v4_cell
+.LMb0:
+.LBB0:
+	mov $4,%eax
+	call v4__dpush@PLT
+.LBE0:
+.stabn 68,0,26,.LM4-v4_cell
+.LM4:
+	pop %ebx
+	ret
+.Lfe0:
+	.size	 v4_cell,.Lfe0-v4_cell
+.stabn	192,0,0,.LBB0-v4_cell
+.stabn	224,0,0,.LBE0-v4_cell
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_cell
+.text
+	.align 4
+.stabs "v4_cells:F1",36,0,0,v4_cells
+	.weak v4_cells
+	.type	v4_cells,@function
+v4_cells:
+.stabn 68,0,29,.LMa5-v4_cells
+.LMa5:
+	push %ebx
+	call .Lpic1
+.Lpic1:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic1],%ebx
+0:
+.stabn 68,0,29,.LMb5-v4_cells
+.LMb5:
+.LBB1:
+	call v4__dpop@PLT
+	shl $2,%eax
+	call v4__dpush@PLT
+.LBE1:
+.stabn 68,0,29,.LM14-v4_cells
+.LM14:
+	pop %ebx
+	ret
+.Lfe1:
+	.size	 v4_cells,.Lfe1-v4_cells
+.stabn	192,0,0,.LBB1-v4_cells
+.stabn	224,0,0,.LBE1-v4_cells
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4_cells
+.text
+	.align 4
+.stabs "v4_cell_Plus:F1",36,0,0,v4_cell_Plus
+	.weak v4_cell_Plus
+	.type	v4_cell_Plus,@function
+v4_cell_Plus:
+.stabn 68,0,30,.LMa15-v4_cell_Plus
+.LMa15:
+	push %ebx
+	call .Lpic3
+.Lpic3:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic3],%ebx
+0:
+.stabn 68,0,30,.LMb15-v4_cell_Plus
+.LMb15:
+.LBB3:
+.stabn 68,0,26,.LM17-v4_cell_Plus
+.LM17:
+	mov $4,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+.LBE3:
+.stabn 68,0,30,.LM25-v4_cell_Plus
+.LM25:
+	pop %ebx
+	ret
+.Lfe3:
+	.size	 v4_cell_Plus,.Lfe3-v4_cell_Plus
+.stabn	192,0,0,.LBB3-v4_cell_Plus
+.stabn	224,0,0,.LBE3-v4_cell_Plus
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4_cell_Plus
+.text
+	.align 4
+.stabs "v4_cell_Minus:F1",36,0,0,v4_cell_Minus
+	.weak v4_cell_Minus
+	.type	v4_cell_Minus,@function
+v4_cell_Minus:
+.stabn 68,0,31,.LMa26-v4_cell_Minus
+.LMa26:
+	push %ebx
+	call .Lpic5
+.Lpic5:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic5],%ebx
+0:
+.stabn 68,0,31,.LMb26-v4_cell_Minus
+.LMb26:
+.LBB5:
+.stabn 68,0,26,.LM28-v4_cell_Minus
+.LM28:
+	mov $4,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.LBE5:
+.stabn 68,0,31,.LM36-v4_cell_Minus
+.LM36:
+	pop %ebx
+	ret
+.Lfe5:
+	.size	 v4_cell_Minus,.Lfe5-v4_cell_Minus
+.stabn	192,0,0,.LBB5-v4_cell_Minus
+.stabn	224,0,0,.LBE5-v4_cell_Minus
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4_cell_Minus
+.text
+	.align 4
+.stabs "v4_chars:F1",36,0,0,v4_chars
+	.weak v4_chars
+	.type	v4_chars,@function
+v4_chars:
+.stabn 68,0,33,.LMa37-v4_chars
+.LMa37:
+	push %ebx
+	call .Lpic7
+.Lpic7:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic7],%ebx
+0:
+.stabn 68,0,33,.LMb37-v4_chars
+.LMb37:
+.LBB7:
+.LBE7:
+.stabn 68,0,33,.LM39-v4_chars
+.LM39:
+	pop %ebx
+	ret
+.Lfe7:
+	.size	 v4_chars,.Lfe7-v4_chars
+.stabn	192,0,0,.LBB7-v4_chars
+.stabn	224,0,0,.LBE7-v4_chars
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_chars
+.text
+	.align 4
+.stabs "v4_char_Plus:F1",36,0,0,v4_char_Plus
+	.weak v4_char_Plus
+	.type	v4_char_Plus,@function
+v4_char_Plus:
+.stabn 68,0,34,.LMa40-v4_char_Plus
+.LMa40:
+	push %ebx
+	call .Lpic8
+.Lpic8:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic8],%ebx
+0:
+.stabn 68,0,34,.LMb40-v4_char_Plus
+.LMb40:
+.LBB8:
+	call v4__dpop@PLT
+	inc %eax
+	call v4__dpush@PLT
+.LBE8:
+.stabn 68,0,34,.LM46-v4_char_Plus
+.LM46:
+	pop %ebx
+	ret
+.Lfe8:
+	.size	 v4_char_Plus,.Lfe8-v4_char_Plus
+.stabn	192,0,0,.LBB8-v4_char_Plus
+.stabn	224,0,0,.LBE8-v4_char_Plus
+.Lscope8:
+.stabs	"",36,0,0,.Lscope8-v4_char_Plus
+.text
+	.align 4
+.stabs "v4_char_Minus:F1",36,0,0,v4_char_Minus
+	.weak v4_char_Minus
+	.type	v4_char_Minus,@function
+v4_char_Minus:
+.stabn 68,0,35,.LMa47-v4_char_Minus
+.LMa47:
+	push %ebx
+	call .Lpic10
+.Lpic10:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic10],%ebx
+0:
+.stabn 68,0,35,.LMb47-v4_char_Minus
+.LMb47:
+.LBB10:
+	call v4__dpop@PLT
+	dec %eax
+	call v4__dpush@PLT
+.LBE10:
+.stabn 68,0,35,.LM53-v4_char_Minus
+.LM53:
+	pop %ebx
+	ret
+.Lfe10:
+	.size	 v4_char_Minus,.Lfe10-v4_char_Minus
+.stabn	192,0,0,.LBB10-v4_char_Minus
+.stabn	224,0,0,.LBE10-v4_char_Minus
+.Lscope10:
+.stabs	"",36,0,0,.Lscope10-v4_char_Minus
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
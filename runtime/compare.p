@@ -0,0 +1,483 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: compare.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+    52 Sym_7 word "v4_Equals"
+    70 Sym_18 word "v4_Greater"
+    79 Sym_22 word "v4_Greater_Equals"
+    89 Sym_27 external "v4_Greaterr"
+    67 Sym_17 word "v4_Less"
+    76 Sym_21 word "v4_Less_Equals"
+    73 Sym_20 word "v4_Less_Greater"
+    56 Sym_12 external "v4_Minus"
+    50 Sym_6 external "v4_drop"
+    50 Sym_5 external "v4_dup"
+    47 Sym_3 external "v4_invert"
+    82 Sym_23 word "v4_max"
+    85 Sym_24 word "v4_min"
+    56 Sym_11 external "v4_nip"
+    89 Sym_26 external "v4_over"
+    89 Sym_28 external "v4_r_Greater"
+    59 Sym_14 external "v4_swap"
+    58 Sym_13 word "v4_u_Greater"
+    64 Sym_16 word "v4_u_Greater_Equals"
+    55 Sym_9 word "v4_u_Less"
+    61 Sym_15 word "v4_u_Less_Equals"
+    88 Sym_25 word "v4_within"
+    53 Sym_8 external "v4_xor"
+    43 Sym_1 word "v4_z0_Equals"
+    49 Sym_4 word "v4_z0_Greater"
+    34 Sym_0 codeword "v4_z0_Less"
+    46 Sym_2 word "v4_z0_Less_Greater"
+    71 Sym_19 external "v4_z2drop"
+    56 Sym_10 external "v4_z2dup"
+
+Intermediate code:
+    34 function Sym_0 {
+    35   asm (    call v4__dpop@PLT)
+    36   asm (    sar $31,%eax)
+    37   asm (    call v4__dpush@PLT)
+    39   asm (    forth_pic.=0b-0b)
+    40 }
+
+    43 function Sym_1 {
+    44   Reg_0 = Stack_D
+    44   if Reg_0 == 0 goto Label_2
+    44   Reg_0 = 0
+    44   Stack_D = Reg_0
+    44   goto Label_1
+    44 label Label_2
+    44   Reg_0 = -1
+    44   Stack_D = Reg_0
+    44 label Label_1
+    44 }
+
+    46 function Sym_2 {
+    47   no-op
+           optimizes   call Sym_1
+    44   Reg_0 = Stack_D
+    44   if Reg_0 == 0 goto Label_23
+    44   Reg_0 = 0
+    44   Stack_D = Reg_0
+    44   goto Label_24
+    44 label Label_23
+    44   Reg_0 = -1
+    44   Stack_D = Reg_0
+    44 label Label_24
+    47   no-op
+           optimizes   call Sym_3
+    47   Reg_0 = Stack_D
+    47   Reg_0 = ~Reg_0
+    47   Stack_D = Reg_0
+    47   no-op
+           optimizes label Label_3
+    47 }
+
+    49 function Sym_4 {
+    50   call Sym_5
+    50   call Sym_0
+    50   Reg_0 = Stack_D
+    50   if Reg_0 == 0 goto Label_5
+    50   call Sym_6
+    50   Reg_0 = 0
+    50   Stack_D = Reg_0
+    50   goto Label_4
+    50 label Label_5
+    50   no-op
+           optimizes   call Sym_2
+    47   call Sym_1
+    47   no-op
+           optimizes   call Sym_3
+    47   Reg_0 = Stack_D
+    47   Reg_0 = ~Reg_0
+    47   Stack_D = Reg_0
+    50 label Label_4
+    50 }
+
+    52 function Sym_7 {
+    53   no-op
+           optimizes   call Sym_8
+    53   Reg_1 = Stack_D
+    53   Reg_0 = Stack_D
+    53   Reg_0 ^= Reg_1
+    53   no-op
+           optimizes   Stack_D = Reg_0
+    53   no-op
+           optimizes   call Sym_1
+    44   no-op
+           optimizes   Reg_0 = Stack_D
+    44   if Reg_0 == 0 goto Label_25
+    44   Reg_0 = 0
+    44   Stack_D = Reg_0
+    44   goto Label_26
+    44 label Label_25
+    44   Reg_0 = -1
+    44   Stack_D = Reg_0
+    44 label Label_26
+    53   no-op
+           optimizes label Label_6
+    53 }
+
+    55 function Sym_9 {
+    56   call Sym_10
+    56   no-op
+           optimizes   call Sym_8
+    56   Reg_1 = Stack_D
+    56   Reg_0 = Stack_D
+    56   Reg_0 ^= Reg_1
+    56   Stack_D = Reg_0
+    56   call Sym_0
+    56   Reg_0 = Stack_D
+    56   if Reg_0 == 0 goto Label_8
+    56   call Sym_11
+    56   tail call Sym_0
+           optimizes   call Sym_0
+    56   no-op
+           optimizes   goto Label_7
+    56 label Label_8
+    56   no-op
+           optimizes   call Sym_12
+    56   Reg_1 = Stack_D
+    56   Reg_0 = Stack_D
+    56   Reg_0 -= Reg_1
+    56   Stack_D = Reg_0
+    56   tail call Sym_0
+           optimizes   call Sym_0
+    56   no-op
+           optimizes label Label_7
+    56 }
+
+    58 function Sym_13 {
+    59   call Sym_14
+    59   no-op
+           optimizes   call Sym_9
+    56   call Sym_10
+    56   no-op
+           optimizes   call Sym_8
+    56   Reg_1 = Stack_D
+    56   Reg_0 = Stack_D
+    56   Reg_0 ^= Reg_1
+    56   Stack_D = Reg_0
+    56   call Sym_0
+    56   Reg_0 = Stack_D
+    56   if Reg_0 == 0 goto Label_27
+    56   call Sym_11
+    56   tail call Sym_0
+           optimizes   call Sym_0
+    56   no-op
+           optimizes   goto Label_28
+    56 label Label_27
+    56   no-op
+           optimizes   call Sym_12
+    56   Reg_1 = Stack_D
+    56   Reg_0 = Stack_D
+    56   Reg_0 -= Reg_1
+    56   Stack_D = Reg_0
+    56   tail call Sym_0
+           optimizes   call Sym_0
+    56   no-op
+           optimizes label Label_28
+    59   no-op
+           optimizes label Label_9
+    59 }
+
+    61 function Sym_15 {
+    62   no-op
+           optimizes   call Sym_13
+    59   call Sym_14
+    59   call Sym_9
+    62   no-op
+           optimizes   call Sym_3
+    62   Reg_0 = Stack_D
+    62   Reg_0 = ~Reg_0
+    62   Stack_D = Reg_0
+    62   no-op
+           optimizes label Label_10
+    62 }
+
+    64 function Sym_16 {
+    65   no-op
+           optimizes   call Sym_9
+    56   call Sym_10
+    56   no-op
+           optimizes   call Sym_8
+    56   Reg_1 = Stack_D
+    56   Reg_0 = Stack_D
+    56   Reg_0 ^= Reg_1
+    56   Stack_D = Reg_0
+    56   call Sym_0
+    56   Reg_0 = Stack_D
+    56   if Reg_0 == 0 goto Label_29
+    56   call Sym_11
+    56   call Sym_0
+    56   goto Label_30
+    56 label Label_29
+    56   no-op
+           optimizes   call Sym_12
+    56   Reg_1 = Stack_D
+    56   Reg_0 = Stack_D
+    56   Reg_0 -= Reg_1
+    56   Stack_D = Reg_0
+    56   call Sym_0
+    56 label Label_30
+    65   no-op
+           optimizes   call Sym_3
+    65   Reg_0 = Stack_D
+    65   Reg_0 = ~Reg_0
+    65   Stack_D = Reg_0
+    65   no-op
+           optimizes label Label_11
+    65 }
+
+    67 function Sym_17 {
+    68   call Sym_10
+    68   no-op
+           optimizes   call Sym_8
+    68   Reg_1 = Stack_D
+    68   Reg_0 = Stack_D
+    68   Reg_0 ^= Reg_1
+    68   Stack_D = Reg_0
+    68   call Sym_0
+    68   Reg_0 = Stack_D
+    68   if Reg_0 == 0 goto Label_13
+    68   call Sym_6
+    68   tail call Sym_0
+           optimizes   call Sym_0
+    68   no-op
+           optimizes   goto Label_12
+    68 label Label_13
+    68   no-op
+           optimizes   call Sym_12
+    68   Reg_1 = Stack_D
+    68   Reg_0 = Stack_D
+    68   Reg_0 -= Reg_1
+    68   Stack_D = Reg_0
+    68   tail call Sym_0
+           optimizes   call Sym_0
+    68   no-op
+           optimizes label Label_12
+    68 }
+
+    70 function Sym_18 {
+    71   call Sym_10
+    71   no-op
+           optimizes   call Sym_8
+    71   Reg_1 = Stack_D
+    71   Reg_0 = Stack_D
+    71   Reg_0 ^= Reg_1
+    71   no-op
+           optimizes   Stack_D = Reg_0
+    71   no-op
+           optimizes   call Sym_1
+    44   no-op
+           optimizes   Reg_0 = Stack_D
+    44   if Reg_0 == 0 goto Label_31
+    44   Reg_0 = 0
+    44   Stack_D = Reg_0
+    44   goto Label_32
+    44 label Label_31
+    44   Reg_0 = -1
+    44   Stack_D = Reg_0
+    44 label Label_32
+    71   Reg_0 = Stack_D
+    71   if Reg_0 == 0 goto Label_15
+    71   call Sym_19
+    71   Reg_0 = 0
+    71   Stack_D = Reg_0
+    71   goto Label_14
+    71 label Label_15
+    71   call Sym_14
+    71   no-op
+           optimizes   call Sym_17
+    68   call Sym_10
+    68   no-op
+           optimizes   call Sym_8
+    68   Reg_1 = Stack_D
+    68   Reg_0 = Stack_D
+    68   Reg_0 ^= Reg_1
+    68   Stack_D = Reg_0
+    68   call Sym_0
+    68   Reg_0 = Stack_D
+    68   if Reg_0 == 0 goto Label_33
+    68   call Sym_6
+    68   tail call Sym_0
+           optimizes   call Sym_0
+    68   no-op
+           optimizes   goto Label_34
+    68 label Label_33
+    68   no-op
+           optimizes   call Sym_12
+    68   Reg_1 = Stack_D
+    68   Reg_0 = Stack_D
+    68   Reg_0 -= Reg_1
+    68   Stack_D = Reg_0
+    68   tail call Sym_0
+           optimizes   call Sym_0
+    68 label Label_34
+    71 label Label_14
+    71 }
+
+    73 function Sym_20 {
+    74   no-op
+           optimizes   call Sym_7
+    53   no-op
+           optimizes   call Sym_8
+    53   Reg_1 = Stack_D
+    53   Reg_0 = Stack_D
+    53   Reg_0 ^= Reg_1
+    53   Stack_D = Reg_0
+    53   call Sym_1
+    74   no-op
+           optimizes   call Sym_3
+    74   Reg_0 = Stack_D
+    74   Reg_0 = ~Reg_0
+    74   Stack_D = Reg_0
+    74   no-op
+           optimizes label Label_16
+    74 }
+
+    76 function Sym_21 {
+    77   no-op
+           optimizes   call Sym_18
+    71   call Sym_10
+    71   no-op
+           optimizes   call Sym_8
+    71   Reg_1 = Stack_D
+    71   Reg_0 = Stack_D
+    71   Reg_0 ^= Reg_1
+    71   Stack_D = Reg_0
+    71   call Sym_1
+    71   Reg_0 = Stack_D
+    71   if Reg_0 == 0 goto Label_35
+    71   call Sym_19
+    71   Reg_0 = 0
+    71   Stack_D = Reg_0
+    71   goto Label_36
+    71 label Label_35
+    71   call Sym_14
+    71   call Sym_17
+    71 label Label_36
+    77   no-op
+           optimizes   call Sym_3
+    77   Reg_0 = Stack_D
+    77   Reg_0 = ~Reg_0
+    77   Stack_D = Reg_0
+    77   no-op
+           optimizes label Label_17
+    77 }
+
+    79 function Sym_22 {
+    80   no-op
+           optimizes   call Sym_17
+    68   call Sym_10
+    68   no-op
+           optimizes   call Sym_8
+    68   Reg_1 = Stack_D
+    68   Reg_0 = Stack_D
+    68   Reg_0 ^= Reg_1
+    68   Stack_D = Reg_0
+    68   call Sym_0
+    68   Reg_0 = Stack_D
+    68   if Reg_0 == 0 goto Label_37
+    68   call Sym_6
+    68   call Sym_0
+    68   goto Label_38
+    68 label Label_37
+    68   no-op
+           optimizes   call Sym_12
+    68   Reg_1 = Stack_D
+    68   Reg_0 = Stack_D
+    68   Reg_0 -= Reg_1
+    68   Stack_D = Reg_0
+    68   call Sym_0
+    68 label Label_38
+    80   no-op
+           optimizes   call Sym_3
+    80   Reg_0 = Stack_D
+    80   Reg_0 = ~Reg_0
+    80   Stack_D = Reg_0
+    80   no-op
+           optimizes label Label_18
+    80 }
+
+    82 function Sym_23 {
+    83   call Sym_10
+    83   call Sym_17
+    83   Reg_0 = Stack_D
+    83   if Reg_0 == 0 goto Label_20
+    83   call Sym_14
+    83 label Label_20
+    83   tail call Sym_6
+           optimizes   call Sym_6
+    83   no-op
+           optimizes label Label_19
+    83 }
+
+    85 function Sym_24 {
+    86   call Sym_10
+    86   call Sym_14
+    86   call Sym_17
+    86   Reg_0 = Stack_D
+    86   if Reg_0 == 0 goto Label_22
+    86   call Sym_14
+    86 label Label_22
+    86   tail call Sym_6
+           optimizes   call Sym_6
+    86   no-op
+           optimizes label Label_21
+    86 }
+
+    88 function Sym_25 {
+    89   call Sym_26
+    89   no-op
+           optimizes   call Sym_12
+    89   Reg_1 = Stack_D
+    89   Reg_0 = Stack_D
+    89   Reg_0 -= Reg_1
+    89   no-op
+           optimizes   Stack_D = Reg_0
+    89   no-op
+           optimizes   call Sym_27
+    89   no-op
+           optimizes   Reg_0 = Stack_D
+    89   Frame_0 = Reg_0
+    89   no-op
+           optimizes   call Sym_12
+    89   Reg_1 = Stack_D
+    89   Reg_0 = Stack_D
+    89   Reg_0 -= Reg_1
+    89   Stack_D = Reg_0
+    89   no-op
+           optimizes   call Sym_28
+    89   Reg_0 = Frame_0
+    89   Stack_D = Reg_0
+    89   tail call Sym_9
+           optimizes   call Sym_9
+    89   no-op
+           optimizes label Label_23
+    89 }
+
+Peephole rewrites:
+  v4_Equals: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_Equals: redundant-test: test %eax,%eax => (none)
+  v4_u_Less: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_u_Less: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_u_Greater: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_u_Greater: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_u_Greater_Equals: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_u_Greater_Equals: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_Less: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_Less: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_Greater: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_Greater: redundant-test: test %eax,%eax => (none)
+  v4_Greater: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_Greater: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_Less_Greater: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_Less_Equals: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_Greater_Equals: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_Greater_Equals: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_within: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_within: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+
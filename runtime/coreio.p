@@ -0,0 +1,525 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: coreio.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+    55 Sym_28 external "v4_Equals"
+    33 Sym_6 external "v4_Fetch"
+    37 Sym_16 external "v4_Plus"
+    34 Sym_10 external "v4_Store"
+    30 Sym_3 variable Cell[3] "v4___Parenfds_Closeparen"
+    45 Sym_19 word "v4___Parenfile_Minusexecute_Closeparen"
+    32 Sym_4 word "v4___Parengetfd_Closeparen"
+    54 Sym_25 word "v4___Pareniosys_Closeparen"
+    55 Sym_27 external "v4__post_syscall"
+    55 Sym_26 external "v4__syscall"
+    69 Sym_39 word "v4_bl"
+    35 Sym_11 external "v4_cell_Plus"
+    37 Sym_15 external "v4_cells"
+    78 Sym_42 word "v4_cr"
+    67 Sym_38 external "v4_drop"
+    33 Sym_5 external "v4_dup"
+    66 Sym_37 word "v4_emit"
+    46 Sym_21 external "v4_execute"
+    48 Sym_23 word "v4_infile_Minusexecute"
+    39 Sym_17 word "v4_infile_Minusid"
+    33 Sym_7 external "v4_invert"
+    57 Sym_32 word "v4_key"
+    55 Sym_30 external "v4_or"
+    51 Sym_24 word "v4_outfile_Minusexecute"
+    42 Sym_18 word "v4_outfile_Minusid"
+    34 Sym_9 external "v4_over"
+    35 Sym_12 external "v4_rot"
+    58 Sym_33 external "v4_sp_Fetch"
+    72 Sym_40 word "v4_space"
+    75 Sym_41 word "v4_spaces"
+    28 Sym_2 word "v4_stderr"
+    26 Sym_0 word "v4_stdin"
+    27 Sym_1 word "v4_stdout"
+    37 Sym_14 external "v4_swap"
+    55 Sym_31 external "v4_throw"
+    34 Sym_8 external "v4_true"
+    61 Sym_34 word "v4_type"
+    55 Sym_29 external "v4_z0_Equals"
+    62 Sym_35 external "v4_z0_Greater"
+    46 Sym_20 external "v4_z2_Greaterr"
+    35 Sym_13 external "v4_z2_Store"
+    64 Sym_36 external "v4_z2drop"
+    46 Sym_22 external "v4_z2r_Greater"
+
+Intermediate code:
+    26 function Sym_0 {
+    26   Reg_0 = 0
+    26   Stack_D = Reg_0
+    26   no-op
+           optimizes label Label_1
+    26 }
+
+    27 function Sym_1 {
+    27   Reg_0 = 1
+    27   Stack_D = Reg_0
+    27   no-op
+           optimizes label Label_2
+    27 }
+
+    28 function Sym_2 {
+    28   Reg_0 = 2
+    28   Stack_D = Reg_0
+    28   no-op
+           optimizes label Label_3
+    28 }
+
+    32 function Sym_4 {
+    33   Reg_0 = Sym_3
+    33   Stack_D = Reg_0
+    33   call Sym_5
+    33   call Sym_6
+    33   no-op
+           optimizes   call Sym_7
+    33   Reg_0 = Stack_D
+    33   Reg_0 = ~Reg_0
+    33   no-op
+           optimizes   Stack_D = Reg_0
+    33   no-op
+           optimizes   Reg_0 = Stack_D
+    33   if Reg_0 == 0 goto Label_5
+    34   no-op
+           optimizes   call Sym_8
+    34   Reg_0 = -1
+    34   Stack_D = Reg_0
+    34   call Sym_9
+    34   call Sym_10
+    35   call Sym_5
+    35   no-op
+           optimizes   call Sym_11
+    35   Reg_0 = Stack_D
+    35   Reg_0 += 4
+    35   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_1
+    27   Reg_0 = 1
+    27   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_0
+    26   Reg_0 = 0
+    26   Stack_D = Reg_0
+    35   call Sym_12
+    35   call Sym_13
+    36 label Label_5
+    37   call Sym_14
+    37   no-op
+           optimizes   call Sym_15
+    37   Reg_0 = Stack_D
+    37   Reg_0 *= 4
+    37   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    37   no-op
+           optimizes   call Sym_16
+    37   no-op
+           optimizes   Reg_1 = Stack_D
+    37   Reg_0 = Stack_D
+    37   Reg_0 += Reg_1
+    37   Stack_D = Reg_0
+    37   no-op
+           optimizes label Label_4
+    37 }
+
+    39 function Sym_17 {
+    40   Reg_0 = 1
+    40   Stack_D = Reg_0
+    40   tail call Sym_4
+           optimizes   call Sym_4
+    40   no-op
+           optimizes label Label_6
+    40 }
+
+    42 function Sym_18 {
+    43   Reg_0 = 2
+    43   Stack_D = Reg_0
+    43   tail call Sym_4
+           optimizes   call Sym_4
+    43   no-op
+           optimizes label Label_7
+    43 }
+
+    45 function Sym_19 {
+    46   call Sym_5
+    46   call Sym_6
+    46   call Sym_9
+    46   call Sym_20
+    46   call Sym_10
+    46   call Sym_21
+    46   call Sym_22
+    46   tail call Sym_10
+           optimizes   call Sym_10
+    46   no-op
+           optimizes label Label_8
+    46 }
+
+    48 function Sym_23 {
+    49   no-op
+           optimizes   call Sym_17
+    40   Reg_0 = 1
+    40   Stack_D = Reg_0
+    40   call Sym_4
+    49   no-op
+           optimizes   call Sym_19
+    46   call Sym_5
+    46   call Sym_6
+    46   call Sym_9
+    46   call Sym_20
+    46   call Sym_10
+    46   call Sym_21
+    46   call Sym_22
+    46   tail call Sym_10
+           optimizes   call Sym_10
+    49   no-op
+           optimizes label Label_9
+    49 }
+
+    51 function Sym_24 {
+    52   no-op
+           optimizes   call Sym_18
+    43   Reg_0 = 2
+    43   Stack_D = Reg_0
+    43   call Sym_4
+    52   no-op
+           optimizes   call Sym_19
+    46   call Sym_5
+    46   call Sym_6
+    46   call Sym_9
+    46   call Sym_20
+    46   call Sym_10
+    46   call Sym_21
+    46   call Sym_22
+    46   tail call Sym_10
+           optimizes   call Sym_10
+    52   no-op
+           optimizes label Label_10
+    52 }
+
+    54 function Sym_25 {
+    55   Reg_0 = 3
+    55   Stack_D = Reg_0
+    55   call Sym_26
+    55   call Sym_27
+    55   call Sym_5
+    55   Reg_0 = -1
+    55   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    55   no-op
+           optimizes   call Sym_28
+    55   no-op
+           optimizes   Reg_1 = Stack_D
+    55   Reg_0 = Stack_D
+    55   Reg_0 = Reg_0 == Reg_1
+    55   Stack_D = Reg_0
+    55   call Sym_14
+    55   no-op
+           optimizes   call Sym_29
+    55   Reg_0 = Stack_D
+    55   Reg_0 = Reg_0 == 0
+    55   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    55   no-op
+           optimizes   call Sym_30
+    55   no-op
+           optimizes   Reg_1 = Stack_D
+    55   Reg_0 = Stack_D
+    55   Reg_0 |= Reg_1
+    55   no-op
+           optimizes   Stack_D = Reg_0
+    55   no-op
+           optimizes   Reg_0 = Stack_D
+    55   if Reg_0 == 0 goto Label_12
+    55   Reg_0 = -57
+    55   Stack_D = Reg_0
+    55   tail call Sym_31
+           optimizes   call Sym_31
+    55 label Label_12
+    55   no-op
+           optimizes label Label_11
+    55 }
+
+    57 function Sym_32 {
+    58   Reg_0 = 0
+    58   Stack_D = Reg_0
+    58   call Sym_33
+    58   Reg_0 = 1
+    58   Stack_D = Reg_0
+    59   call Sym_14
+    59   no-op
+           optimizes   call Sym_17
+    40   Reg_0 = 1
+    40   Stack_D = Reg_0
+    40   call Sym_4
+    59   call Sym_6
+    59   Reg_0 = 3
+    59   Stack_D = Reg_0
+    59   tail call Sym_25
+           optimizes   call Sym_25
+    59   no-op
+           optimizes label Label_13
+    59 }
+
+    61 function Sym_34 {
+    62   call Sym_5
+    62   no-op
+           optimizes   call Sym_35
+    62   Reg_0 = Stack_D
+    62   if Reg_0 <= 0 goto Label_15
+    62   no-op
+           optimizes   Reg_0 = Stack_D
+    62   no-op
+           optimizes   if Reg_0 == 0 goto Label_15
+    63   call Sym_14
+    63   no-op
+           optimizes   call Sym_18
+    43   Reg_0 = 2
+    43   Stack_D = Reg_0
+    43   call Sym_4
+    63   call Sym_6
+    63   Reg_0 = 4
+    63   Stack_D = Reg_0
+    63   tail call Sym_25
+           optimizes   call Sym_25
+    64   no-op
+           optimizes   goto Label_16
+    64 label Label_15
+    64   tail call Sym_36
+           optimizes   call Sym_36
+    64   no-op
+           optimizes label Label_16
+    64   no-op
+           optimizes label Label_14
+    64 }
+
+    66 function Sym_37 {
+    67   call Sym_33
+    67   Reg_0 = 1
+    67   Stack_D = Reg_0
+    67   no-op
+           optimizes   call Sym_34
+    62   call Sym_5
+    62   no-op
+           optimizes   call Sym_35
+    62   Reg_0 = Stack_D
+    62   if Reg_0 <= 0 goto Label_23
+    62   no-op
+           optimizes   Reg_0 = Stack_D
+    62   no-op
+           optimizes   if Reg_0 == 0 goto Label_23
+    63   call Sym_14
+    63   no-op
+           optimizes   call Sym_18
+    43   Reg_0 = 2
+    43   Stack_D = Reg_0
+    43   call Sym_4
+    63   call Sym_6
+    63   Reg_0 = 4
+    63   Stack_D = Reg_0
+    63   call Sym_25
+    64   goto Label_24
+    64 label Label_23
+    64   call Sym_36
+    64 label Label_24
+    67   tail call Sym_38
+           optimizes   call Sym_38
+    67   no-op
+           optimizes label Label_17
+    67 }
+
+    69 function Sym_39 {
+    70   Reg_0 = 32
+    70   Stack_D = Reg_0
+    70   no-op
+           optimizes label Label_18
+    70 }
+
+    72 function Sym_40 {
+    73   no-op
+           optimizes   call Sym_39
+    70   Reg_0 = 32
+    70   Stack_D = Reg_0
+    73   no-op
+           optimizes   call Sym_37
+    67   call Sym_33
+    67   Reg_0 = 1
+    67   Stack_D = Reg_0
+    67   call Sym_34
+    67   tail call Sym_38
+           optimizes   call Sym_38
+    73   no-op
+           optimizes label Label_19
+    73 }
+
+    75 function Sym_41 {
+    76   Reg_0 = 0
+    76   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    76   no-op
+           optimizes   Reg_1 = Stack_D
+    76   Reg_0 = Stack_D
+    76   if Reg_0 == Reg_1 goto Label_21
+    76   Stack_R = Reg_0
+    76   Stack_R = Reg_1
+    76 label Label_22
+    76   no-op
+           optimizes   call Sym_40
+    73   no-op
+           optimizes   call Sym_39
+    70   Reg_0 = 32
+    70   Stack_D = Reg_0
+    73   no-op
+           optimizes   call Sym_37
+    67   call Sym_33
+    67   Reg_0 = 1
+    67   Stack_D = Reg_0
+    62   call Sym_5
+    62   no-op
+           optimizes   call Sym_35
+    62   Reg_0 = Stack_D
+    62   if Reg_0 <= 0 goto Label_25
+    62   no-op
+           optimizes   Reg_0 = Stack_D
+    62   no-op
+           optimizes   if Reg_0 == 0 goto Label_25
+    63   call Sym_14
+    63   no-op
+           optimizes   call Sym_18
+    43   Reg_0 = 2
+    43   Stack_D = Reg_0
+    43   no-op
+           optimizes   call Sym_4
+    33   Reg_0 = Sym_3
+    33   Stack_D = Reg_0
+    33   call Sym_5
+    33   call Sym_6
+    33   no-op
+           optimizes   call Sym_7
+    33   Reg_0 = Stack_D
+    33   Reg_0 = ~Reg_0
+    33   no-op
+           optimizes   Stack_D = Reg_0
+    33   no-op
+           optimizes   Reg_0 = Stack_D
+    33   if Reg_0 == 0 goto Label_28
+    34   Reg_0 = -1
+    34   Stack_D = Reg_0
+    34   call Sym_9
+    34   call Sym_10
+    35   call Sym_5
+    35   no-op
+           optimizes   call Sym_11
+    35   Reg_0 = Stack_D
+    35   Reg_0 += 4
+    35   Stack_D = Reg_0
+    27   Reg_0 = 1
+    27   Stack_D = Reg_0
+    26   Reg_0 = 0
+    26   Stack_D = Reg_0
+    35   call Sym_12
+    35   call Sym_13
+    36 label Label_28
+    37   call Sym_14
+    37   no-op
+           optimizes   call Sym_15
+    37   Reg_0 = Stack_D
+    37   Reg_0 *= 4
+    37   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    37   no-op
+           optimizes   call Sym_16
+    37   no-op
+           optimizes   Reg_1 = Stack_D
+    37   Reg_0 = Stack_D
+    37   Reg_0 += Reg_1
+    37   Stack_D = Reg_0
+    63   call Sym_6
+    63   Reg_0 = 4
+    63   Stack_D = Reg_0
+    63   no-op
+           optimizes   call Sym_25
+    55   Reg_0 = 3
+    55   Stack_D = Reg_0
+    55   call Sym_26
+    55   call Sym_27
+    55   call Sym_5
+    55   Reg_0 = -1
+    55   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    55   no-op
+           optimizes   call Sym_28
+    55   no-op
+           optimizes   Reg_1 = Stack_D
+    55   Reg_0 = Stack_D
+    55   Reg_0 = Reg_0 == Reg_1
+    55   Stack_D = Reg_0
+    55   call Sym_14
+    55   no-op
+           optimizes   call Sym_29
+    55   Reg_0 = Stack_D
+    55   Reg_0 = Reg_0 == 0
+    55   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    55   no-op
+           optimizes   call Sym_30
+    55   no-op
+           optimizes   Reg_1 = Stack_D
+    55   Reg_0 = Stack_D
+    55   Reg_0 |= Reg_1
+    55   no-op
+           optimizes   Stack_D = Reg_0
+    55   no-op
+           optimizes   Reg_0 = Stack_D
+    55   if Reg_0 == 0 goto Label_27
+    55   Reg_0 = -57
+    55   Stack_D = Reg_0
+    55   call Sym_31
+    55   no-op
+           optimizes label Label_27
+    64   goto Label_26
+    64 label Label_25
+    64   call Sym_36
+    55 label Label_27
+    64 label Label_26
+    67   call Sym_38
+    76   Reg_1 = Stack_R
+    76   Reg_1 += 1
+    76   Reg_0 = Stack_R
+    76   Stack_R = Reg_0
+    76   Stack_R = Reg_1
+    76   Reg_1 -= Reg_0
+    76   if Reg_1 != 0 goto Label_22
+    76   no-op
+           optimizes label Label_23
+    76   Reg_0 = Stack_R
+    76   Reg_0 = Stack_R
+    76 label Label_21
+    76   no-op
+           optimizes label Label_20
+    76 }
+
+    78 function Sym_42 {
+    79   Reg_0 = 10
+    79   Stack_D = Reg_0
+    79   no-op
+           optimizes   call Sym_37
+    67   call Sym_33
+    67   Reg_0 = 1
+    67   Stack_D = Reg_0
+    67   call Sym_34
+    67   tail call Sym_38
+           optimizes   call Sym_38
+    79   no-op
+           optimizes label Label_24
+    79 }
+
+Peephole rewrites:
+  v4___Pareniosys_Closeparen: redundant-test: test %eax,%eax => (none)
+  v4_spaces: exchange-push: xchg %edx,%eax; call v4__rpush@PLT; xchg %eax,%edx => mov %edx,%eax; call v4__rpush@PLT
+  v4_spaces: redundant-test: test %eax,%eax => (none)
+  v4_spaces: exchange-pop: xchg %edx,%eax; call v4__rpop@PLT; xchg %eax,%edx => call v4__rpop@PLT; mov %eax,%edx
+  v4_spaces: redundant-test: test %edx,%edx => (none)
+
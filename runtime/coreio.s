@@ -0,0 +1,949 @@
+	.file	"coreio.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"coreio.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.stabs	"v4___Parenfds_Closeparen:Gar2;0;2;2",40,0,0,v4___Parenfds_Closeparen
+	.comm  v4___Parenfds_Closeparen,12,4
+.text
+	.align 4
+.stabs "v4_stdin:F1",36,0,0,v4_stdin
+	.weak v4_stdin
+	.type	v4_stdin,@function
+v4_stdin:
+.stabn 68,0,26,.LMa0-v4_stdin
+.LMa0:
+	push %ebx
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,26,.LMb0-v4_stdin
+.LMb0:
+.LBB0:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.LBE0:
+.stabn 68,0,26,.LM4-v4_stdin
+.LM4:
+	pop %ebx
+	ret
+.Lfe0:
+	.size	 v4_stdin,.Lfe0-v4_stdin
+.stabn	192,0,0,.LBB0-v4_stdin
+.stabn	224,0,0,.LBE0-v4_stdin
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_stdin
+.text
+	.align 4
+.stabs "v4_stdout:F1",36,0,0,v4_stdout
+	.weak v4_stdout
+	.type	v4_stdout,@function
+v4_stdout:
+.stabn 68,0,27,.LMa5-v4_stdout
+.LMa5:
+	push %ebx
+	call .Lpic1
+.Lpic1:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic1],%ebx
+0:
+.stabn 68,0,27,.LMb5-v4_stdout
+.LMb5:
+.LBB1:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+.LBE1:
+.stabn 68,0,27,.LM9-v4_stdout
+.LM9:
+	pop %ebx
+	ret
+.Lfe1:
+	.size	 v4_stdout,.Lfe1-v4_stdout
+.stabn	192,0,0,.LBB1-v4_stdout
+.stabn	224,0,0,.LBE1-v4_stdout
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4_stdout
+.text
+	.align 4
+.stabs "v4_stderr:F1",36,0,0,v4_stderr
+	.weak v4_stderr
+	.type	v4_stderr,@function
+v4_stderr:
+.stabn 68,0,28,.LMa10-v4_stderr
+.LMa10:
+	push %ebx
+	call .Lpic2
+.Lpic2:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic2],%ebx
+0:
+.stabn 68,0,28,.LMb10-v4_stderr
+.LMb10:
+.LBB2:
+	mov $2,%eax
+	call v4__dpush@PLT
+.LBE2:
+.stabn 68,0,28,.LM14-v4_stderr
+.LM14:
+	pop %ebx
+	ret
+.Lfe2:
+	.size	 v4_stderr,.Lfe2-v4_stderr
+.stabn	192,0,0,.LBB2-v4_stderr
+.stabn	224,0,0,.LBE2-v4_stderr
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4_stderr
+.text
+	.align 4
+.stabs "v4___Parengetfd_Closeparen:F1",36,0,0,v4___Parengetfd_Closeparen
+	.weak v4___Parengetfd_Closeparen
+	.type	v4___Parengetfd_Closeparen,@function
+v4___Parengetfd_Closeparen:
+.stabn 68,0,32,.LMa15-v4___Parengetfd_Closeparen
+.LMa15:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic4
+.Lpic4:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic4],%ebx
+0:
+.stabn 68,0,32,.LMb15-v4___Parengetfd_Closeparen
+.LMb15:
+.LBB4:
+.stabn 68,0,33,.LM16-v4___Parengetfd_Closeparen
+.LM16:
+	mov v4___Parenfds_Closeparen@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	not %eax
+	test %eax,%eax
+	je .L5
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	call v4_Store@PLT
+.stabn 68,0,35,.LM31-v4___Parengetfd_Closeparen
+.LM31:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	add $4,%eax
+	call v4__dpush@PLT
+.stabn 68,0,27,.LM37-v4___Parengetfd_Closeparen
+.LM37:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+.stabn 68,0,26,.LM40-v4___Parengetfd_Closeparen
+.LM40:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.stabn 68,0,35,.LM42-v4___Parengetfd_Closeparen
+.LM42:
+	call v4_rot@PLT
+	call v4_z2_Store@PLT
+.L5:
+.stabn 68,0,37,.LM45-v4___Parengetfd_Closeparen
+.LM45:
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	shl $2,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+.LBE4:
+.stabn 68,0,37,.LM56-v4___Parengetfd_Closeparen
+.LM56:
+	pop %ebx
+	leave
+	ret
+.Lfe4:
+	.size	 v4___Parengetfd_Closeparen,.Lfe4-v4___Parengetfd_Closeparen
+.stabn	192,0,0,.LBB4-v4___Parengetfd_Closeparen
+.stabn	224,0,0,.LBE4-v4___Parengetfd_Closeparen
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4___Parengetfd_Closeparen
+.text
+	.align 4
+.stabs "v4_infile_Minusid:F1",36,0,0,v4_infile_Minusid
+	.weak v4_infile_Minusid
+	.type	v4_infile_Minusid,@function
+v4_infile_Minusid:
+.stabn 68,0,39,.LMa57-v4_infile_Minusid
+.LMa57:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic17
+.Lpic17:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic17],%ebx
+0:
+.stabn 68,0,39,.LMb57-v4_infile_Minusid
+.LMb57:
+.LBB17:
+.stabn 68,0,40,.LM58-v4_infile_Minusid
+.LM58:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	mov v4___Parengetfd_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE17:
+.stabn 68,0,40,.LM62-v4_infile_Minusid
+.LM62:
+	pop %ebx
+	leave
+	ret
+.Lfe17:
+	.size	 v4_infile_Minusid,.Lfe17-v4_infile_Minusid
+.stabn	192,0,0,.LBB17-v4_infile_Minusid
+.stabn	224,0,0,.LBE17-v4_infile_Minusid
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-v4_infile_Minusid
+.text
+	.align 4
+.stabs "v4_outfile_Minusid:F1",36,0,0,v4_outfile_Minusid
+	.weak v4_outfile_Minusid
+	.type	v4_outfile_Minusid,@function
+v4_outfile_Minusid:
+.stabn 68,0,42,.LMa63-v4_outfile_Minusid
+.LMa63:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic18
+.Lpic18:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic18],%ebx
+0:
+.stabn 68,0,42,.LMb63-v4_outfile_Minusid
+.LMb63:
+.LBB18:
+.stabn 68,0,43,.LM64-v4_outfile_Minusid
+.LM64:
+	mov $2,%eax
+	call v4__dpush@PLT
+	mov v4___Parengetfd_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE18:
+.stabn 68,0,43,.LM68-v4_outfile_Minusid
+.LM68:
+	pop %ebx
+	leave
+	ret
+.Lfe18:
+	.size	 v4_outfile_Minusid,.Lfe18-v4_outfile_Minusid
+.stabn	192,0,0,.LBB18-v4_outfile_Minusid
+.stabn	224,0,0,.LBE18-v4_outfile_Minusid
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4_outfile_Minusid
+.text
+	.align 4
+.stabs "v4___Parenfile_Minusexecute_Closeparen:F1",36,0,0,v4___Parenfile_Minusexecute_Closeparen
+	.weak v4___Parenfile_Minusexecute_Closeparen
+	.type	v4___Parenfile_Minusexecute_Closeparen,@function
+v4___Parenfile_Minusexecute_Closeparen:
+.stabn 68,0,45,.LMa69-v4___Parenfile_Minusexecute_Closeparen
+.LMa69:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic19
+.Lpic19:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic19],%ebx
+0:
+.stabn 68,0,45,.LMb69-v4___Parenfile_Minusexecute_Closeparen
+.LMb69:
+.LBB19:
+.stabn 68,0,46,.LM70-v4___Parenfile_Minusexecute_Closeparen
+.LM70:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4_over@PLT
+	call v4_z2_Greaterr@PLT
+	call v4_Store@PLT
+	call v4_execute@PLT
+	call v4_z2r_Greater@PLT
+	mov v4_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE19:
+.stabn 68,0,46,.LM79-v4___Parenfile_Minusexecute_Closeparen
+.LM79:
+	pop %ebx
+	leave
+	ret
+.Lfe19:
+	.size	 v4___Parenfile_Minusexecute_Closeparen,.Lfe19-v4___Parenfile_Minusexecute_Closeparen
+.stabn	192,0,0,.LBB19-v4___Parenfile_Minusexecute_Closeparen
+.stabn	224,0,0,.LBE19-v4___Parenfile_Minusexecute_Closeparen
+.Lscope19:
+.stabs	"",36,0,0,.Lscope19-v4___Parenfile_Minusexecute_Closeparen
+.text
+	.align 4
+.stabs "v4_infile_Minusexecute:F1",36,0,0,v4_infile_Minusexecute
+	.weak v4_infile_Minusexecute
+	.type	v4_infile_Minusexecute,@function
+v4_infile_Minusexecute:
+.stabn 68,0,48,.LMa80-v4_infile_Minusexecute
+.LMa80:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic23
+.Lpic23:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic23],%ebx
+0:
+.stabn 68,0,48,.LMb80-v4_infile_Minusexecute
+.LMb80:
+.LBB23:
+.stabn 68,0,40,.LM82-v4_infile_Minusexecute
+.LM82:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4___Parengetfd_Closeparen@PLT
+.stabn 68,0,46,.LM86-v4_infile_Minusexecute
+.LM86:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4_over@PLT
+	call v4_z2_Greaterr@PLT
+	call v4_Store@PLT
+	call v4_execute@PLT
+	call v4_z2r_Greater@PLT
+	mov v4_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE23:
+.stabn 68,0,49,.LM95-v4_infile_Minusexecute
+.LM95:
+	pop %ebx
+	leave
+	ret
+.Lfe23:
+	.size	 v4_infile_Minusexecute,.Lfe23-v4_infile_Minusexecute
+.stabn	192,0,0,.LBB23-v4_infile_Minusexecute
+.stabn	224,0,0,.LBE23-v4_infile_Minusexecute
+.Lscope23:
+.stabs	"",36,0,0,.Lscope23-v4_infile_Minusexecute
+.text
+	.align 4
+.stabs "v4_outfile_Minusexecute:F1",36,0,0,v4_outfile_Minusexecute
+	.weak v4_outfile_Minusexecute
+	.type	v4_outfile_Minusexecute,@function
+v4_outfile_Minusexecute:
+.stabn 68,0,51,.LMa96-v4_outfile_Minusexecute
+.LMa96:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic24
+.Lpic24:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic24],%ebx
+0:
+.stabn 68,0,51,.LMb96-v4_outfile_Minusexecute
+.LMb96:
+.LBB24:
+.stabn 68,0,43,.LM98-v4_outfile_Minusexecute
+.LM98:
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4___Parengetfd_Closeparen@PLT
+.stabn 68,0,46,.LM102-v4_outfile_Minusexecute
+.LM102:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4_over@PLT
+	call v4_z2_Greaterr@PLT
+	call v4_Store@PLT
+	call v4_execute@PLT
+	call v4_z2r_Greater@PLT
+	mov v4_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE24:
+.stabn 68,0,52,.LM111-v4_outfile_Minusexecute
+.LM111:
+	pop %ebx
+	leave
+	ret
+.Lfe24:
+	.size	 v4_outfile_Minusexecute,.Lfe24-v4_outfile_Minusexecute
+.stabn	192,0,0,.LBB24-v4_outfile_Minusexecute
+.stabn	224,0,0,.LBE24-v4_outfile_Minusexecute
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4_outfile_Minusexecute
+.text
+	.align 4
+.stabs "v4___Pareniosys_Closeparen:F1",36,0,0,v4___Pareniosys_Closeparen
+	.weak v4___Pareniosys_Closeparen
+	.type	v4___Pareniosys_Closeparen,@function
+v4___Pareniosys_Closeparen:
+.stabn 68,0,54,.LMa112-v4___Pareniosys_Closeparen
+.LMa112:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic25
+.Lpic25:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic25],%ebx
+0:
+.stabn 68,0,54,.LMb112-v4___Pareniosys_Closeparen
+.LMb112:
+.LBB25:
+.stabn 68,0,55,.LM113-v4___Pareniosys_Closeparen
+.LM113:
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	call v4__post_syscall@PLT
+	call v4_dup@PLT
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	or %edx,%eax
+	je .L12
+	mov $-57,%eax
+	call v4__dpush@PLT
+	mov v4_throw@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.L12:
+.LBE25:
+.stabn 68,0,55,.LM142-v4___Pareniosys_Closeparen
+.LM142:
+	pop %ebx
+	leave
+	ret
+.Lfe25:
+	.size	 v4___Pareniosys_Closeparen,.Lfe25-v4___Pareniosys_Closeparen
+.stabn	192,0,0,.LBB25-v4___Pareniosys_Closeparen
+.stabn	224,0,0,.LBE25-v4___Pareniosys_Closeparen
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4___Pareniosys_Closeparen
+.text
+	.align 4
+.stabs "v4_key:F1",36,0,0,v4_key
+	.weak v4_key
+	.type	v4_key,@function
+v4_key:
+.stabn 68,0,57,.LMa143-v4_key
+.LMa143:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic32
+.Lpic32:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic32],%ebx
+0:
+.stabn 68,0,57,.LMb143-v4_key
+.LMb143:
+.LBB32:
+.stabn 68,0,58,.LM144-v4_key
+.LM144:
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4_sp_Fetch@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+.stabn 68,0,59,.LM149-v4_key
+.LM149:
+	call v4_swap@PLT
+.stabn 68,0,40,.LM151-v4_key
+.LM151:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4___Parengetfd_Closeparen@PLT
+.stabn 68,0,59,.LM154-v4_key
+.LM154:
+	call v4_Fetch@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	mov v4___Pareniosys_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE32:
+.stabn 68,0,59,.LM159-v4_key
+.LM159:
+	pop %ebx
+	leave
+	ret
+.Lfe32:
+	.size	 v4_key,.Lfe32-v4_key
+.stabn	192,0,0,.LBB32-v4_key
+.stabn	224,0,0,.LBE32-v4_key
+.Lscope32:
+.stabs	"",36,0,0,.Lscope32-v4_key
+.text
+	.align 4
+.stabs "v4_type:F1",36,0,0,v4_type
+	.weak v4_type
+	.type	v4_type,@function
+v4_type:
+.stabn 68,0,61,.LMa160-v4_type
+.LMa160:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic34
+.Lpic34:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic34],%ebx
+0:
+.stabn 68,0,61,.LMb160-v4_type
+.LMb160:
+.LBB34:
+.stabn 68,0,62,.LM161-v4_type
+.LM161:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jle .L15
+.stabn 68,0,63,.LM167-v4_type
+.LM167:
+	call v4_swap@PLT
+.stabn 68,0,43,.LM169-v4_type
+.LM169:
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4___Parengetfd_Closeparen@PLT
+.stabn 68,0,63,.LM172-v4_type
+.LM172:
+	call v4_Fetch@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+	mov v4___Pareniosys_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.L15:
+	mov v4_z2drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE34:
+.stabn 68,0,64,.LM181-v4_type
+.LM181:
+	pop %ebx
+	leave
+	ret
+.Lfe34:
+	.size	 v4_type,.Lfe34-v4_type
+.stabn	192,0,0,.LBB34-v4_type
+.stabn	224,0,0,.LBE34-v4_type
+.Lscope34:
+.stabs	"",36,0,0,.Lscope34-v4_type
+.text
+	.align 4
+.stabs "v4_emit:F1",36,0,0,v4_emit
+	.weak v4_emit
+	.type	v4_emit,@function
+v4_emit:
+.stabn 68,0,66,.LMa182-v4_emit
+.LMa182:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic37
+.Lpic37:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic37],%ebx
+0:
+.stabn 68,0,66,.LMb182-v4_emit
+.LMb182:
+.LBB37:
+.stabn 68,0,67,.LM183-v4_emit
+.LM183:
+	call v4_sp_Fetch@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+.stabn 68,0,62,.LM187-v4_emit
+.LM187:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jle .L23
+.stabn 68,0,63,.LM193-v4_emit
+.LM193:
+	call v4_swap@PLT
+.stabn 68,0,43,.LM195-v4_emit
+.LM195:
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4___Parengetfd_Closeparen@PLT
+.stabn 68,0,63,.LM198-v4_emit
+.LM198:
+	call v4_Fetch@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4___Pareniosys_Closeparen@PLT
+.stabn 68,0,64,.LM202-v4_emit
+.LM202:
+	jmp .L24
+.L23:
+	call v4_z2drop@PLT
+.L24:
+.stabn 68,0,67,.LM206-v4_emit
+.LM206:
+	mov v4_drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE37:
+.stabn 68,0,67,.LM208-v4_emit
+.LM208:
+	pop %ebx
+	leave
+	ret
+.Lfe37:
+	.size	 v4_emit,.Lfe37-v4_emit
+.stabn	192,0,0,.LBB37-v4_emit
+.stabn	224,0,0,.LBE37-v4_emit
+.Lscope37:
+.stabs	"",36,0,0,.Lscope37-v4_emit
+.text
+	.align 4
+.stabs "v4_bl:F1",36,0,0,v4_bl
+	.weak v4_bl
+	.type	v4_bl,@function
+v4_bl:
+.stabn 68,0,69,.LMa209-v4_bl
+.LMa209:
+	push %ebx
+	call .Lpic39
+.Lpic39:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic39],%ebx
+0:
+.stabn 68,0,69,.LMb209-v4_bl
+.LMb209:
+.LBB39:
+.stabn 68,0,70,.LM210-v4_bl
+.LM210:
+	mov $32,%eax
+	call v4__dpush@PLT
+.LBE39:
+.stabn 68,0,70,.LM213-v4_bl
+.LM213:
+	pop %ebx
+	ret
+.Lfe39:
+	.size	 v4_bl,.Lfe39-v4_bl
+.stabn	192,0,0,.LBB39-v4_bl
+.stabn	224,0,0,.LBE39-v4_bl
+.Lscope39:
+.stabs	"",36,0,0,.Lscope39-v4_bl
+.text
+	.align 4
+.stabs "v4_space:F1",36,0,0,v4_space
+	.weak v4_space
+	.type	v4_space,@function
+v4_space:
+.stabn 68,0,72,.LMa214-v4_space
+.LMa214:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic40
+.Lpic40:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic40],%ebx
+0:
+.stabn 68,0,72,.LMb214-v4_space
+.LMb214:
+.LBB40:
+.stabn 68,0,70,.LM216-v4_space
+.LM216:
+	mov $32,%eax
+	call v4__dpush@PLT
+.stabn 68,0,67,.LM219-v4_space
+.LM219:
+	call v4_sp_Fetch@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4_type@PLT
+	mov v4_drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE40:
+.stabn 68,0,73,.LM225-v4_space
+.LM225:
+	pop %ebx
+	leave
+	ret
+.Lfe40:
+	.size	 v4_space,.Lfe40-v4_space
+.stabn	192,0,0,.LBB40-v4_space
+.stabn	224,0,0,.LBE40-v4_space
+.Lscope40:
+.stabs	"",36,0,0,.Lscope40-v4_space
+.text
+	.align 4
+.stabs "v4_spaces:F1",36,0,0,v4_spaces
+	.weak v4_spaces
+	.type	v4_spaces,@function
+v4_spaces:
+.stabn 68,0,75,.LMa226-v4_spaces
+.LMa226:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic41
+.Lpic41:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic41],%ebx
+0:
+.stabn 68,0,75,.LMb226-v4_spaces
+.LMb226:
+.LBB41:
+.stabn 68,0,76,.LM227-v4_spaces
+.LM227:
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %eax,%edx
+	je .L21
+	call v4__rpush@PLT
+	mov %edx,%eax
+	call v4__rpush@PLT
+.L22:
+.stabn 68,0,70,.LM237-v4_spaces
+.LM237:
+	mov $32,%eax
+	call v4__dpush@PLT
+.stabn 68,0,67,.LM240-v4_spaces
+.LM240:
+	call v4_sp_Fetch@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+.stabn 68,0,62,.LM243-v4_spaces
+.LM243:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jle .L25
+.stabn 68,0,63,.LM249-v4_spaces
+.LM249:
+	call v4_swap@PLT
+.stabn 68,0,43,.LM251-v4_spaces
+.LM251:
+	mov $2,%eax
+	call v4__dpush@PLT
+.stabn 68,0,33,.LM254-v4_spaces
+.LM254:
+	mov v4___Parenfds_Closeparen@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	not %eax
+	test %eax,%eax
+	je .L28
+.stabn 68,0,34,.LM264-v4_spaces
+.LM264:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	call v4_Store@PLT
+.stabn 68,0,35,.LM268-v4_spaces
+.LM268:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	add $4,%eax
+	call v4__dpush@PLT
+.stabn 68,0,27,.LM273-v4_spaces
+.LM273:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+.stabn 68,0,26,.LM275-v4_spaces
+.LM275:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.stabn 68,0,35,.LM277-v4_spaces
+.LM277:
+	call v4_rot@PLT
+	call v4_z2_Store@PLT
+.L28:
+.stabn 68,0,37,.LM280-v4_spaces
+.LM280:
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	shl $2,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,63,.LM290-v4_spaces
+.LM290:
+	call v4_Fetch@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+.stabn 68,0,55,.LM294-v4_spaces
+.LM294:
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	call v4__post_syscall@PLT
+	call v4_dup@PLT
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	or %edx,%eax
+	je .L27
+	mov $-57,%eax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.stabn 68,0,64,.LM322-v4_spaces
+.LM322:
+	jmp .L26
+.L25:
+	call v4_z2drop@PLT
+.L27:
+.L26:
+.stabn 68,0,67,.LM327-v4_spaces
+.LM327:
+	call v4_drop@PLT
+.stabn 68,0,76,.LM328-v4_spaces
+.LM328:
+	call v4__rpop@PLT
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L22
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.L21:
+.LBE41:
+.stabn 68,0,76,.LM340-v4_spaces
+.LM340:
+	pop %ebx
+	leave
+	ret
+.Lfe41:
+	.size	 v4_spaces,.Lfe41-v4_spaces
+.stabn	192,0,0,.LBB41-v4_spaces
+.stabn	224,0,0,.LBE41-v4_spaces
+.Lscope41:
+.stabs	"",36,0,0,.Lscope41-v4_spaces
+.text
+	.align 4
+.stabs "v4_cr:F1",36,0,0,v4_cr
+	.weak v4_cr
+	.type	v4_cr,@function
+v4_cr:
+.stabn 68,0,78,.LMa341-v4_cr
+.LMa341:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic42
+.Lpic42:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic42],%ebx
+0:
+.stabn 68,0,78,.LMb341-v4_cr
+.LMb341:
+.LBB42:
+.stabn 68,0,79,.LM342-v4_cr
+.LM342:
+	mov $10,%eax
+	call v4__dpush@PLT
+.stabn 68,0,67,.LM345-v4_cr
+.LM345:
+	call v4_sp_Fetch@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4_type@PLT
+	mov v4_drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE42:
+.stabn 68,0,79,.LM351-v4_cr
+.LM351:
+	pop %ebx
+	leave
+	ret
+.Lfe42:
+	.size	 v4_cr,.Lfe42-v4_cr
+.stabn	192,0,0,.LBB42-v4_cr
+.stabn	224,0,0,.LBE42-v4_cr
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4_cr
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
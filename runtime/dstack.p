@@ -0,0 +1,1203 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: dstack.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+   159 Sym_6 external "v4_Fetch"
+   172 Sym_20 external "v4_Greaterr"
+   168 Sym_13 external "v4_Minus"
+   192 Sym_28 word "v4_Minusrot"
+   165 Sym_11 external "v4_Plus"
+   183 Sym_25 word "v4_Questiondup"
+   168 Sym_16 external "v4_Slash"
+   168 Sym_17 external "v4_Store"
+   170 Sym_18 variable Cell "v4___Parenswap_Closeparen"
+    85 Sym_3 codeword "v4__dpop"
+    58 Sym_2 codeword "v4__dpush"
+   134 Sym_4 codeword "v4__dscheck"
+    30 Sym_1 variable Cell "v4__dsindex"
+    25 Sym_0 variable Cell[4096] "v4__dstack"
+   168 Sym_15 external "v4_cell"
+   168 Sym_14 external "v4_cell_Plus"
+   165 Sym_10 external "v4_cells"
+   158 Sym_5 word "v4_depth"
+   174 Sym_22 word "v4_drop"
+   177 Sym_23 word "v4_dup"
+   186 Sym_26 word "v4_nip"
+   180 Sym_24 word "v4_over"
+   198 Sym_30 word "v4_pick"
+   172 Sym_21 external "v4_r_Greater"
+   201 Sym_32 word "v4_roll"
+   189 Sym_27 word "v4_rot"
+   161 Sym_7 word "v4_sp0"
+   164 Sym_8 word "v4_sp_Fetch"
+   167 Sym_12 word "v4_sp_Store"
+   171 Sym_19 word "v4_swap"
+   195 Sym_29 word "v4_tuck"
+   165 Sym_9 external "v4_z1_Minus"
+   199 Sym_31 external "v4_z1_Plus"
+   220 Sym_37 external "v4_z2_Greaterr"
+   210 Sym_33 word "v4_z2drop"
+   213 Sym_34 word "v4_z2dup"
+   216 Sym_35 word "v4_z2over"
+   220 Sym_38 external "v4_z2r_Greater"
+   219 Sym_36 word "v4_z2swap"
+
+Intermediate code:
+    58 function Sym_2 {
+    59   asm (    push %ecx)
+    60   asm (    push %edx)
+    61   asm (    mov $4080,%ecx)
+    62   asm (    mov v4__dstack@GOT(%ebx),%edi)
+    63   asm (    mov v4__dsindex@GOT(%ebx),%esi)
+    64   asm (    mov $-3,%edx)
+    65   asm (    call v4__push@PLT)
+    66   asm (    pop %edx)
+    67   asm (    pop %ecx)
+    69   asm (    forth_pic.=0b-0b)
+    70 }
+
+    85 function Sym_3 {
+    86   asm (    push %edx)
+    87   asm (    mov v4__dstack@GOT(%ebx),%edi)
+    88   asm (    mov v4__dsindex@GOT(%ebx),%esi)
+    89   asm (    mov $-4,%edx)
+    90   asm (    call v4__pop@PLT)
+    91   asm (    pop %edx)
+    93   asm (    forth_pic.=0b-0b)
+    94 }
+
+   134 function Sym_4 {
+   135   asm (    push %eax)
+   136   asm (    push %edx)
+   137   asm (    mov v4__dsindex@GOT(%ebx),%esi)
+   138   asm (    test %ecx,%ecx)
+   139   asm (    jns 1f)
+   141   asm (    movl $0,(%esi))
+   142   asm (    mov $-4,%eax)
+   143   asm (    call v4__dpush@PLT)
+   144   asm (    call v4_throw@PLT)
+   146   asm (1:)
+   148   asm (    mov %ecx,(%esi))
+   149   asm (    mov $-3,%edx)
+   150   asm (    call v4__starteh@PLT)
+   151   asm (    pop %edx)
+   152   asm (    pop %eax)
+   154   asm (    forth_pic.=0b-0b)
+   155 }
+
+   158 function Sym_5 {
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   tail call Sym_6
+           optimizes   call Sym_6
+   159   no-op
+           optimizes label Label_1
+   159 }
+
+   161 function Sym_7 {
+   162   Reg_0 = Sym_0
+   162   Stack_D = Reg_0
+   162   no-op
+           optimizes label Label_2
+   162 }
+
+   164 function Sym_8 {
+   165   no-op
+           optimizes   call Sym_5
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   165   no-op
+           optimizes   call Sym_9
+   165   Reg_0 = Stack_D
+   165   Reg_0 -= 1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_10
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 *= 4
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_7
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_11
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   Stack_D = Reg_0
+   165   no-op
+           optimizes label Label_3
+   165 }
+
+   167 function Sym_12 {
+   168   no-op
+           optimizes   call Sym_7
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   168   no-op
+           optimizes   call Sym_13
+   168   no-op
+           optimizes   Reg_1 = Stack_D
+   168   Reg_0 = Stack_D
+   168   Reg_0 -= Reg_1
+   168   no-op
+           optimizes   Stack_D = Reg_0
+   168   no-op
+           optimizes   call Sym_14
+   168   no-op
+           optimizes   Reg_0 = Stack_D
+   168   Reg_0 += 4
+   168   Stack_D = Reg_0
+   168   call Sym_15
+   168   call Sym_16
+   168   Reg_0 = Sym_1
+   168   Stack_D = Reg_0
+   168   tail call Sym_17
+           optimizes   call Sym_17
+   168   no-op
+           optimizes label Label_4
+   168 }
+
+   171 function Sym_19 {
+   172   no-op
+           optimizes   call Sym_20
+   172   Reg_0 = Stack_D
+   172   Frame_0 = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   no-op
+           optimizes   call Sym_21
+   172   Reg_0 = Frame_0
+   172   Stack_D = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   Stack_D = Reg_0
+   172   no-op
+           optimizes label Label_5
+   172 }
+
+   174 function Sym_22 {
+   175   Reg_0 = Stack_D
+   175   no-op
+           optimizes   if Reg_0 == 0 goto Label_7
+   175   no-op
+           optimizes label Label_7
+   175   no-op
+           optimizes label Label_6
+   175 }
+
+   177 function Sym_23 {
+   178   no-op
+           optimizes   call Sym_8
+   165   no-op
+           optimizes   call Sym_5
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   165   no-op
+           optimizes   call Sym_9
+   165   Reg_0 = Stack_D
+   165   Reg_0 -= 1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_10
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 *= 4
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_7
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_11
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   Stack_D = Reg_0
+   178   tail call Sym_6
+           optimizes   call Sym_6
+   178   no-op
+           optimizes label Label_8
+   178 }
+
+   180 function Sym_24 {
+   181   no-op
+           optimizes   call Sym_8
+   165   no-op
+           optimizes   call Sym_5
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   165   no-op
+           optimizes   call Sym_9
+   165   Reg_0 = Stack_D
+   165   Reg_0 -= 1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_10
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 *= 4
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_7
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_11
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   181   Reg_0 = 4
+           optimizes   Reg_0 = 0
+   181   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   181   no-op
+           optimizes   call Sym_14
+   181   no-op
+           optimizes   call Sym_13
+   181   no-op
+           optimizes   Reg_1 = Stack_D
+   181   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   181   Reg_0 -= Reg_1
+   181   Stack_D = Reg_0
+   181   tail call Sym_6
+           optimizes   call Sym_6
+   181   no-op
+           optimizes label Label_9
+   181 }
+
+   183 function Sym_25 {
+   184   no-op
+           optimizes   call Sym_23
+   178   no-op
+           optimizes   call Sym_8
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   165   no-op
+           optimizes   call Sym_9
+   165   Reg_0 = Stack_D
+   165   Reg_0 -= 1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_10
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 *= 4
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_11
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   Stack_D = Reg_0
+   178   call Sym_6
+   184   Reg_0 = Stack_D
+   184   if Reg_0 == 0 goto Label_11
+   184   no-op
+           optimizes   call Sym_23
+   178   no-op
+           optimizes   call Sym_8
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   165   no-op
+           optimizes   call Sym_9
+   165   Reg_0 = Stack_D
+   165   Reg_0 -= 1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_10
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 *= 4
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_11
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   Stack_D = Reg_0
+   178   tail call Sym_6
+           optimizes   call Sym_6
+   184 label Label_11
+   184   no-op
+           optimizes label Label_10
+   184 }
+
+   186 function Sym_26 {
+   187   no-op
+           optimizes   call Sym_19
+   172   no-op
+           optimizes   call Sym_20
+   172   Reg_0 = Stack_D
+   172   Frame_0 = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   no-op
+           optimizes   call Sym_21
+   172   Reg_0 = Frame_0
+   172   Stack_D = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   187   no-op
+           optimizes   call Sym_22
+   175   no-op
+           optimizes   Reg_0 = Stack_D
+   187   no-op
+           optimizes label Label_12
+   187 }
+
+   189 function Sym_27 {
+   190   no-op
+           optimizes   call Sym_20
+   190   Reg_0 = Stack_D
+   190   Frame_0 = Reg_0
+   190   no-op
+           optimizes   call Sym_19
+   172   no-op
+           optimizes   call Sym_20
+   172   Reg_0 = Stack_D
+   172   Frame_1 = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   no-op
+           optimizes   call Sym_21
+   172   Reg_0 = Frame_1
+   172   Stack_D = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   190   no-op
+           optimizes   call Sym_21
+   190   Reg_0 = Frame_0
+   190   no-op
+           optimizes   Stack_D = Reg_0
+   190   no-op
+           optimizes   call Sym_19
+   172   no-op
+           optimizes   call Sym_20
+   172   no-op
+           optimizes   Reg_0 = Stack_D
+   172   Frame_0 = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   no-op
+           optimizes   call Sym_21
+   172   Reg_0 = Frame_0
+   172   Stack_D = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   Stack_D = Reg_0
+   190   no-op
+           optimizes label Label_13
+   190 }
+
+   192 function Sym_28 {
+   193   no-op
+           optimizes   call Sym_27
+   190   no-op
+           optimizes   call Sym_20
+   190   Reg_0 = Stack_D
+   190   Frame_0 = Reg_0
+   190   no-op
+           optimizes   call Sym_19
+   172   no-op
+           optimizes   call Sym_20
+   172   Reg_0 = Stack_D
+   172   Frame_1 = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   no-op
+           optimizes   call Sym_21
+   172   Reg_0 = Frame_1
+   172   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   Reg_4 = Reg_0
+           optimizes   Stack_D = Reg_0
+   190   no-op
+           optimizes   call Sym_21
+   190   Reg_0 = Frame_0
+   190   no-op
+           optimizes   Stack_D = Reg_0
+   190   no-op
+           optimizes   call Sym_19
+   172   no-op
+           optimizes   call Sym_20
+   172   no-op
+           optimizes   Reg_0 = Stack_D
+   172   Frame_0 = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Reg_4
+           optimizes   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   no-op
+           optimizes   call Sym_21
+   172   Reg_0 = Frame_0
+   172   Reg_4 = Reg_0
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   193   no-op
+           optimizes   call Sym_27
+   190   no-op
+           optimizes   call Sym_20
+   190   no-op
+           optimizes   Reg_0 = Stack_D
+   190   Frame_0 = Reg_0
+   190   no-op
+           optimizes   call Sym_19
+   172   no-op
+           optimizes   call Sym_20
+   172   Reg_0 = Reg_4
+           optimizes   Reg_0 = Stack_D
+   172   Frame_1 = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   no-op
+           optimizes   call Sym_21
+   172   Reg_0 = Frame_1
+   172   Stack_D = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   190   no-op
+           optimizes   call Sym_21
+   190   Reg_0 = Frame_0
+   190   no-op
+           optimizes   Stack_D = Reg_0
+   190   no-op
+           optimizes   call Sym_19
+   172   no-op
+           optimizes   call Sym_20
+   172   no-op
+           optimizes   Reg_0 = Stack_D
+   172   Frame_0 = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   no-op
+           optimizes   call Sym_21
+   172   Reg_0 = Frame_0
+   172   Stack_D = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   Stack_D = Reg_0
+   193   no-op
+           optimizes label Label_14
+   193 }
+
+   195 function Sym_29 {
+   196   no-op
+           optimizes   call Sym_19
+   172   no-op
+           optimizes   call Sym_20
+   172   Reg_0 = Stack_D
+   172   Frame_0 = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   no-op
+           optimizes   call Sym_21
+   172   Reg_0 = Frame_0
+   172   Stack_D = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   Stack_D = Reg_0
+   196   no-op
+           optimizes   call Sym_24
+   181   no-op
+           optimizes   call Sym_8
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   165   no-op
+           optimizes   call Sym_9
+   165   Reg_0 = Stack_D
+   165   Reg_0 -= 1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_10
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 *= 4
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_11
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   181   Reg_0 = 4
+           optimizes   Reg_0 = 0
+   181   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   181   no-op
+           optimizes   call Sym_13
+   181   no-op
+           optimizes   Reg_1 = Stack_D
+   181   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   181   Reg_0 -= Reg_1
+   181   Stack_D = Reg_0
+   181   tail call Sym_6
+           optimizes   call Sym_6
+   196   no-op
+           optimizes label Label_15
+   196 }
+
+   198 function Sym_30 {
+   199   no-op
+           optimizes   call Sym_31
+   199   Reg_0 = Stack_D
+   199   Reg_0 += 1
+   199   no-op
+           optimizes   Stack_D = Reg_0
+   199   no-op
+           optimizes   call Sym_10
+   199   no-op
+           optimizes   Reg_0 = Stack_D
+   199   Reg_0 *= 4
+   199   Stack_D = Reg_0
+   199   no-op
+           optimizes   call Sym_8
+   165   no-op
+           optimizes   call Sym_5
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   165   no-op
+           optimizes   call Sym_9
+   165   Reg_0 = Stack_D
+   165   Reg_0 -= 1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_10
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 *= 4
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_7
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_11
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   199   no-op
+           optimizes   call Sym_19
+   172   no-op
+           optimizes   call Sym_20
+   172   no-op
+           optimizes   Reg_0 = Stack_D
+   172   Frame_0 = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   no-op
+           optimizes   call Sym_21
+   172   Reg_0 = Frame_0
+   172   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   199   no-op
+           optimizes   call Sym_13
+   199   no-op
+           optimizes   Reg_1 = Stack_D
+   199   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   199   Reg_0 -= Reg_1
+   199   Stack_D = Reg_0
+   199   tail call Sym_6
+           optimizes   call Sym_6
+   199   no-op
+           optimizes label Label_16
+   199 }
+
+   201 function Sym_32 {
+   202   no-op
+           optimizes   call Sym_23
+   178   no-op
+           optimizes   call Sym_8
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   165   no-op
+           optimizes   call Sym_9
+   165   Reg_0 = Stack_D
+   165   Reg_0 -= 1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_10
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 *= 4
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_11
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   Stack_D = Reg_0
+   178   call Sym_6
+   202   Reg_0 = Stack_D
+   202   if Reg_0 == 0 goto Label_18
+   203   no-op
+           optimizes   call Sym_19
+   172   call Sym_20
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   call Sym_21
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   Stack_D = Reg_0
+   203   call Sym_20
+   204   no-op
+           optimizes   call Sym_9
+   204   Reg_0 = Stack_D
+   204   Reg_0 -= 1
+   204   Stack_D = Reg_0
+   204   call Sym_32
+   205   call Sym_21
+   205   no-op
+           optimizes   call Sym_19
+   172   call Sym_20
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   call Sym_21
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   Stack_D = Reg_0
+   206   goto Label_19
+   206 label Label_18
+   207   no-op
+           optimizes   call Sym_22
+   175   Reg_0 = Stack_D
+   208 label Label_19
+   208   no-op
+           optimizes label Label_17
+   208 }
+
+   210 function Sym_33 {
+   211   no-op
+           optimizes   call Sym_22
+   175   Reg_0 = Stack_D
+   211   no-op
+           optimizes   call Sym_22
+   175   Reg_0 = Stack_D
+   211   no-op
+           optimizes label Label_20
+   211 }
+
+   213 function Sym_34 {
+   214   no-op
+           optimizes   call Sym_24
+   181   no-op
+           optimizes   call Sym_8
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   165   no-op
+           optimizes   call Sym_9
+   165   Reg_0 = Stack_D
+   165   Reg_0 -= 1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_10
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 *= 4
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_11
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   181   Reg_0 = 4
+           optimizes   Reg_0 = 0
+   181   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   181   no-op
+           optimizes   call Sym_13
+   181   no-op
+           optimizes   Reg_1 = Stack_D
+   181   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   181   Reg_0 -= Reg_1
+   181   Stack_D = Reg_0
+   181   call Sym_6
+   214   no-op
+           optimizes   call Sym_24
+   181   no-op
+           optimizes   call Sym_8
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   165   no-op
+           optimizes   call Sym_9
+   165   Reg_0 = Stack_D
+   165   Reg_0 -= 1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_10
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 *= 4
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_11
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   181   Reg_0 = 4
+           optimizes   Reg_0 = 0
+   181   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   181   no-op
+           optimizes   call Sym_13
+   181   no-op
+           optimizes   Reg_1 = Stack_D
+   181   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   181   Reg_0 -= Reg_1
+   181   Stack_D = Reg_0
+   181   tail call Sym_6
+           optimizes   call Sym_6
+   214   no-op
+           optimizes label Label_21
+   214 }
+
+   216 function Sym_35 {
+   217   Reg_0 = 16
+           optimizes   Reg_0 = 4
+   217   Stack_D = Reg_0
+   217   no-op
+           optimizes   call Sym_30
+   199   no-op
+           optimizes   call Sym_31
+   199   no-op
+           optimizes   call Sym_10
+   199   no-op
+           optimizes   call Sym_8
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   165   no-op
+           optimizes   call Sym_9
+   165   Reg_0 = Stack_D
+   165   Reg_0 -= 1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_10
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 *= 4
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_11
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   199   no-op
+           optimizes   call Sym_19
+   172   no-op
+           optimizes   call Sym_20
+   172   no-op
+           optimizes   Reg_0 = Stack_D
+   172   Frame_0 = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   no-op
+           optimizes   call Sym_21
+   172   Reg_0 = Frame_0
+   172   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   199   no-op
+           optimizes   call Sym_13
+   199   no-op
+           optimizes   Reg_1 = Stack_D
+   199   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   199   Reg_0 -= Reg_1
+   199   Stack_D = Reg_0
+   199   call Sym_6
+   217   Reg_0 = 16
+           optimizes   Reg_0 = 4
+   217   Stack_D = Reg_0
+   217   no-op
+           optimizes   call Sym_30
+   199   no-op
+           optimizes   call Sym_31
+   199   no-op
+           optimizes   call Sym_10
+   199   no-op
+           optimizes   call Sym_8
+   159   Reg_0 = Sym_1
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   165   no-op
+           optimizes   call Sym_9
+   165   Reg_0 = Stack_D
+   165   Reg_0 -= 1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_10
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 *= 4
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   162   Reg_0 = Sym_0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_11
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   no-op
+           optimizes   Stack_D = Reg_0
+   199   no-op
+           optimizes   call Sym_19
+   172   no-op
+           optimizes   call Sym_20
+   172   no-op
+           optimizes   Reg_0 = Stack_D
+   172   Frame_0 = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_17
+   172   Reg_0 = Stack_D
+   172   *(Sym_18) = Reg_0
+   172   no-op
+           optimizes   call Sym_21
+   172   Reg_0 = Frame_0
+   172   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   Reg_0 = Sym_18
+   172   no-op
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_6
+   172   Reg_0 = *(Sym_18)
+   172   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   199   no-op
+           optimizes   call Sym_13
+   199   no-op
+           optimizes   Reg_1 = Stack_D
+   199   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   199   Reg_0 -= Reg_1
+   199   Stack_D = Reg_0
+   199   tail call Sym_6
+           optimizes   call Sym_6
+   217   no-op
+           optimizes label Label_22
+   217 }
+
+   219 function Sym_36 {
+   220   no-op
+           optimizes   call Sym_35
+   217   Reg_0 = 3
+   217   Stack_D = Reg_0
+   217   call Sym_30
+   217   Reg_0 = 3
+   217   Stack_D = Reg_0
+   217   call Sym_30
+   220   no-op
+           optimizes   call Sym_37
+   220   Reg_1 = Stack_D
+   220   Reg_0 = Stack_D
+   220   Frame_0 = Reg_0
+   220   Frame_1 = Reg_1
+   220   no-op
+           optimizes   call Sym_37
+   220   Reg_1 = Stack_D
+   220   Reg_0 = Stack_D
+   220   Frame_2 = Reg_0
+   220   Frame_3 = Reg_1
+   220   no-op
+           optimizes   call Sym_33
+   211   no-op
+           optimizes   call Sym_22
+   175   Reg_0 = Stack_D
+   211   no-op
+           optimizes   call Sym_22
+   175   Reg_0 = Stack_D
+   220   no-op
+           optimizes   call Sym_38
+   220   Reg_0 = Frame_2
+   220   Reg_1 = Frame_3
+   220   Stack_D = Reg_0
+   220   Stack_D = Reg_1
+   220   no-op
+           optimizes   call Sym_38
+   220   Reg_0 = Frame_0
+   220   Reg_1 = Frame_1
+   220   Stack_D = Reg_0
+   220   Stack_D = Reg_1
+   220   no-op
+           optimizes label Label_23
+   220 }
+
+Peephole rewrites:
+  v4_z2swap: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_z2swap: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_z2swap: exchange-push: xchg %edx,%eax; call v4__dpush@PLT; xchg %eax,%edx => mov %edx,%eax; call v4__dpush@PLT
+
@@ -0,0 +1,1315 @@
+	.file	"dstack.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"dstack.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.stabs	"v4___Parenswap_Closeparen:G2",40,0,0,v4___Parenswap_Closeparen
+	.comm  v4___Parenswap_Closeparen,4,4
+.stabs	"v4__dsindex:G2",40,0,0,v4__dsindex
+	.comm  v4__dsindex,4,4
+.stabs	"v4__dstack:Gar2;0;4095;2",40,0,0,v4__dstack
+	.comm  v4__dstack,16384,32
+.text
+	.align 4
+.stabs "v4__dpush:F1",36,0,0,v4__dpush
+	.weak v4__dpush
+	.type	v4__dpush,@function
+v4__dpush:
+.stabn 68,0,58,.LMa0-v4__dpush
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic2
+.Lpic2:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic2],%ebx
+0:
+.stabn 68,0,58,.LMb0-v4__dpush
+.LMb0:
+.LBB2:
+#APP
+    push %ecx
+    push %edx
+    mov $4080,%ecx
+    mov v4__dstack@GOT(%ebx),%edi
+    mov v4__dsindex@GOT(%ebx),%esi
+    mov $-3,%edx
+    call v4__push@PLT
+    pop %edx
+    pop %ecx
+    forth_pic.=0b-0b
+#NO_APP
+.LBE2:
+.stabn 68,0,70,.LM11-v4__dpush
+.LM11:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe2:
+	.size	 v4__dpush,.Lfe2-v4__dpush
+.stabn	192,0,0,.LBB2-v4__dpush
+.stabn	224,0,0,.LBE2-v4__dpush
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4__dpush
+.text
+	.align 4
+.stabs "v4__dpop:F1",36,0,0,v4__dpop
+	.weak v4__dpop
+	.type	v4__dpop,@function
+v4__dpop:
+.stabn 68,0,85,.LMa12-v4__dpop
+.LMa12:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic3
+.Lpic3:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic3],%ebx
+0:
+.stabn 68,0,85,.LMb12-v4__dpop
+.LMb12:
+.LBB3:
+#APP
+    push %edx
+    mov v4__dstack@GOT(%ebx),%edi
+    mov v4__dsindex@GOT(%ebx),%esi
+    mov $-4,%edx
+    call v4__pop@PLT
+    pop %edx
+    forth_pic.=0b-0b
+#NO_APP
+.LBE3:
+.stabn 68,0,94,.LM20-v4__dpop
+.LM20:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe3:
+	.size	 v4__dpop,.Lfe3-v4__dpop
+.stabn	192,0,0,.LBB3-v4__dpop
+.stabn	224,0,0,.LBE3-v4__dpop
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4__dpop
+.text
+	.align 4
+.stabs "v4__dscheck:F1",36,0,0,v4__dscheck
+	.weak v4__dscheck
+	.type	v4__dscheck,@function
+v4__dscheck:
+.stabn 68,0,134,.LMa21-v4__dscheck
+.LMa21:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic4
+.Lpic4:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic4],%ebx
+0:
+.stabn 68,0,134,.LMb21-v4__dscheck
+.LMb21:
+.LBB4:
+#APP
+    push %eax
+    push %edx
+    mov v4__dsindex@GOT(%ebx),%esi
+    test %ecx,%ecx
+    jns 1f
+    movl $0,(%esi)
+    mov $-4,%eax
+    call v4__dpush@PLT
+    call v4_throw@PLT
+1:
+    mov %ecx,(%esi)
+    mov $-3,%edx
+    call v4__starteh@PLT
+    pop %edx
+    pop %eax
+    forth_pic.=0b-0b
+#NO_APP
+.LBE4:
+.stabn 68,0,155,.LM38-v4__dscheck
+.LM38:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe4:
+	.size	 v4__dscheck,.Lfe4-v4__dscheck
+.stabn	192,0,0,.LBB4-v4__dscheck
+.stabn	224,0,0,.LBE4-v4__dscheck
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4__dscheck
+.text
+	.align 4
+.stabs "v4_depth:F1",36,0,0,v4_depth
+	.weak v4_depth
+	.type	v4_depth,@function
+v4_depth:
+.stabn 68,0,158,.LMa39-v4_depth
+.LMa39:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic5
+.Lpic5:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic5],%ebx
+0:
+.stabn 68,0,158,.LMb39-v4_depth
+.LMb39:
+.LBB5:
+.stabn 68,0,159,.LM40-v4_depth
+.LM40:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	mov v4_Fetch@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE5:
+.stabn 68,0,159,.LM44-v4_depth
+.LM44:
+	pop %ebx
+	leave
+	ret
+.Lfe5:
+	.size	 v4_depth,.Lfe5-v4_depth
+.stabn	192,0,0,.LBB5-v4_depth
+.stabn	224,0,0,.LBE5-v4_depth
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4_depth
+.text
+	.align 4
+.stabs "v4_sp0:F1",36,0,0,v4_sp0
+	.weak v4_sp0
+	.type	v4_sp0,@function
+v4_sp0:
+.stabn 68,0,161,.LMa45-v4_sp0
+.LMa45:
+	push %ebx
+	call .Lpic7
+.Lpic7:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic7],%ebx
+0:
+.stabn 68,0,161,.LMb45-v4_sp0
+.LMb45:
+.LBB7:
+.stabn 68,0,162,.LM46-v4_sp0
+.LM46:
+	mov v4__dstack@GOT(%ebx),%eax
+	call v4__dpush@PLT
+.LBE7:
+.stabn 68,0,162,.LM49-v4_sp0
+.LM49:
+	pop %ebx
+	ret
+.Lfe7:
+	.size	 v4_sp0,.Lfe7-v4_sp0
+.stabn	192,0,0,.LBB7-v4_sp0
+.stabn	224,0,0,.LBE7-v4_sp0
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_sp0
+.text
+	.align 4
+.stabs "v4_sp_Fetch:F1",36,0,0,v4_sp_Fetch
+	.weak v4_sp_Fetch
+	.type	v4_sp_Fetch,@function
+v4_sp_Fetch:
+.stabn 68,0,164,.LMa50-v4_sp_Fetch
+.LMa50:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic8
+.Lpic8:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic8],%ebx
+0:
+.stabn 68,0,164,.LMb50-v4_sp_Fetch
+.LMb50:
+.LBB8:
+.stabn 68,0,159,.LM52-v4_sp_Fetch
+.LM52:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	dec %eax
+	shl $2,%eax
+	mov %eax,%esi
+.stabn 68,0,162,.LM64-v4_sp_Fetch
+.LM64:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+.LBE8:
+.stabn 68,0,165,.LM72-v4_sp_Fetch
+.LM72:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe8:
+	.size	 v4_sp_Fetch,.Lfe8-v4_sp_Fetch
+.stabn	192,0,0,.LBB8-v4_sp_Fetch
+.stabn	224,0,0,.LBE8-v4_sp_Fetch
+.Lscope8:
+.stabs	"",36,0,0,.Lscope8-v4_sp_Fetch
+.text
+	.align 4
+.stabs "v4_sp_Store:F1",36,0,0,v4_sp_Store
+	.weak v4_sp_Store
+	.type	v4_sp_Store,@function
+v4_sp_Store:
+.stabn 68,0,167,.LMa73-v4_sp_Store
+.LMa73:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic12
+.Lpic12:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic12],%ebx
+0:
+.stabn 68,0,167,.LMb73-v4_sp_Store
+.LMb73:
+.LBB12:
+.stabn 68,0,162,.LM75-v4_sp_Store
+.LM75:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	add $4,%eax
+	call v4__dpush@PLT
+	call v4_cell@PLT
+	call v4_Slash@PLT
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	mov v4_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE12:
+.stabn 68,0,168,.LM92-v4_sp_Store
+.LM92:
+	pop %ebx
+	leave
+	ret
+.Lfe12:
+	.size	 v4_sp_Store,.Lfe12-v4_sp_Store
+.stabn	192,0,0,.LBB12-v4_sp_Store
+.stabn	224,0,0,.LBE12-v4_sp_Store
+.Lscope12:
+.stabs	"",36,0,0,.Lscope12-v4_sp_Store
+.text
+	.align 4
+.stabs "v4_swap:F1",36,0,0,v4_swap
+	.weak v4_swap
+	.type	v4_swap,@function
+v4_swap:
+.stabn 68,0,171,.LMa93-v4_swap
+.LMa93:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+	call .Lpic19
+.Lpic19:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic19],%ebx
+0:
+.stabn 68,0,171,.LMb93-v4_swap
+.LMb93:
+.LBB19:
+	call v4__dpop@PLT
+	mov %eax,-8(%ebp)
+	call v4__dpop@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov -8(%ebp),%eax
+	call v4__dpush@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+.LBE19:
+.stabn 68,0,172,.LM111-v4_swap
+.LM111:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe19:
+	.size	 v4_swap,.Lfe19-v4_swap
+.stabn	192,0,0,.LBB19-v4_swap
+.stabn	224,0,0,.LBE19-v4_swap
+.Lscope19:
+.stabs	"",36,0,0,.Lscope19-v4_swap
+.text
+	.align 4
+.stabs "v4_drop:F1",36,0,0,v4_drop
+	.weak v4_drop
+	.type	v4_drop,@function
+v4_drop:
+.stabn 68,0,174,.LMa112-v4_drop
+.LMa112:
+	push %ebx
+	call .Lpic22
+.Lpic22:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic22],%ebx
+0:
+.stabn 68,0,174,.LMb112-v4_drop
+.LMb112:
+.LBB22:
+.stabn 68,0,175,.LM113-v4_drop
+.LM113:
+	call v4__dpop@PLT
+.LBE22:
+.stabn 68,0,175,.LM117-v4_drop
+.LM117:
+	pop %ebx
+	ret
+.Lfe22:
+	.size	 v4_drop,.Lfe22-v4_drop
+.stabn	192,0,0,.LBB22-v4_drop
+.stabn	224,0,0,.LBE22-v4_drop
+.Lscope22:
+.stabs	"",36,0,0,.Lscope22-v4_drop
+.text
+	.align 4
+.stabs "v4_dup:F1",36,0,0,v4_dup
+	.weak v4_dup
+	.type	v4_dup,@function
+v4_dup:
+.stabn 68,0,177,.LMa118-v4_dup
+.LMa118:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic23
+.Lpic23:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic23],%ebx
+0:
+.stabn 68,0,177,.LMb118-v4_dup
+.LMb118:
+.LBB23:
+.stabn 68,0,159,.LM121-v4_dup
+.LM121:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	dec %eax
+	shl $2,%eax
+	mov %eax,%esi
+.stabn 68,0,162,.LM133-v4_dup
+.LM133:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,178,.LM140-v4_dup
+.LM140:
+	mov v4_Fetch@GOT(%ebx),%ecx
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE23:
+.stabn 68,0,178,.LM142-v4_dup
+.LM142:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe23:
+	.size	 v4_dup,.Lfe23-v4_dup
+.stabn	192,0,0,.LBB23-v4_dup
+.stabn	224,0,0,.LBE23-v4_dup
+.Lscope23:
+.stabs	"",36,0,0,.Lscope23-v4_dup
+.text
+	.align 4
+.stabs "v4_over:F1",36,0,0,v4_over
+	.weak v4_over
+	.type	v4_over,@function
+v4_over:
+.stabn 68,0,180,.LMa143-v4_over
+.LMa143:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic24
+.Lpic24:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic24],%ebx
+0:
+.stabn 68,0,180,.LMb143-v4_over
+.LMb143:
+.LBB24:
+.stabn 68,0,159,.LM146-v4_over
+.LM146:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	dec %eax
+	shl $2,%eax
+	mov %eax,%esi
+.stabn 68,0,162,.LM158-v4_over
+.LM158:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov %eax,%esi
+.stabn 68,0,181,.LM165-v4_over
+.LM165:
+	mov $4,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	sub %edx,%eax
+	call v4__dpush@PLT
+	mov v4_Fetch@GOT(%ebx),%ecx
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE24:
+.stabn 68,0,181,.LM175-v4_over
+.LM175:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe24:
+	.size	 v4_over,.Lfe24-v4_over
+.stabn	192,0,0,.LBB24-v4_over
+.stabn	224,0,0,.LBE24-v4_over
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4_over
+.text
+	.align 4
+.stabs "v4_Questiondup:F1",36,0,0,v4_Questiondup
+	.weak v4_Questiondup
+	.type	v4_Questiondup,@function
+v4_Questiondup:
+.stabn 68,0,183,.LMa176-v4_Questiondup
+.LMa176:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic25
+.Lpic25:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic25],%ebx
+0:
+.stabn 68,0,183,.LMb176-v4_Questiondup
+.LMb176:
+.LBB25:
+.stabn 68,0,159,.LM179-v4_Questiondup
+.LM179:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	dec %eax
+	shl $2,%eax
+	mov %eax,%esi
+.stabn 68,0,162,.LM190-v4_Questiondup
+.LM190:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,178,.LM197-v4_Questiondup
+.LM197:
+	call v4_Fetch@PLT
+.stabn 68,0,184,.LM198-v4_Questiondup
+.LM198:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L11
+.stabn 68,0,159,.LM202-v4_Questiondup
+.LM202:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	dec %eax
+	shl $2,%eax
+	mov %eax,%esi
+.stabn 68,0,162,.LM213-v4_Questiondup
+.LM213:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,178,.LM220-v4_Questiondup
+.LM220:
+	mov v4_Fetch@GOT(%ebx),%ecx
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.L11:
+.LBE25:
+.stabn 68,0,184,.LM223-v4_Questiondup
+.LM223:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe25:
+	.size	 v4_Questiondup,.Lfe25-v4_Questiondup
+.stabn	192,0,0,.LBB25-v4_Questiondup
+.stabn	224,0,0,.LBE25-v4_Questiondup
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4_Questiondup
+.text
+	.align 4
+.stabs "v4_nip:F1",36,0,0,v4_nip
+	.weak v4_nip
+	.type	v4_nip,@function
+v4_nip:
+.stabn 68,0,186,.LMa224-v4_nip
+.LMa224:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+	call .Lpic26
+.Lpic26:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic26],%ebx
+0:
+.stabn 68,0,186,.LMb224-v4_nip
+.LMb224:
+.LBB26:
+	call v4__dpop@PLT
+	mov %eax,-8(%ebp)
+	call v4__dpop@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov -8(%ebp),%eax
+	call v4__dpush@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+.LBE26:
+.stabn 68,0,187,.LM245-v4_nip
+.LM245:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe26:
+	.size	 v4_nip,.Lfe26-v4_nip
+.stabn	192,0,0,.LBB26-v4_nip
+.stabn	224,0,0,.LBE26-v4_nip
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4_nip
+.text
+	.align 4
+.stabs "v4_rot:F1",36,0,0,v4_rot
+	.weak v4_rot
+	.type	v4_rot,@function
+v4_rot:
+.stabn 68,0,189,.LMa246-v4_rot
+.LMa246:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+	call .Lpic27
+.Lpic27:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic27],%ebx
+0:
+.stabn 68,0,189,.LMb246-v4_rot
+.LMb246:
+.LBB27:
+	call v4__dpop@PLT
+	mov %eax,-12(%ebp)
+	call v4__dpop@PLT
+	mov %eax,-16(%ebp)
+	call v4__dpop@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov -16(%ebp),%eax
+	call v4__dpush@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	mov %eax,%esi
+	mov -12(%ebp),%eax
+	mov %eax,-12(%ebp)
+	mov %esi,%eax
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov -12(%ebp),%eax
+	call v4__dpush@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+.LBE27:
+.stabn 68,0,190,.LM288-v4_rot
+.LM288:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe27:
+	.size	 v4_rot,.Lfe27-v4_rot
+.stabn	192,0,0,.LBB27-v4_rot
+.stabn	224,0,0,.LBE27-v4_rot
+.Lscope27:
+.stabs	"",36,0,0,.Lscope27-v4_rot
+.text
+	.align 4
+.stabs "v4_Minusrot:F1",36,0,0,v4_Minusrot
+	.weak v4_Minusrot
+	.type	v4_Minusrot,@function
+v4_Minusrot:
+.stabn 68,0,192,.LMa289-v4_Minusrot
+.LMa289:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	push %edi
+	sub $16,%esp
+	call .Lpic28
+.Lpic28:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic28],%ebx
+0:
+.stabn 68,0,192,.LMb289-v4_Minusrot
+.LMb289:
+.LBB28:
+	call v4__dpop@PLT
+	mov %eax,-16(%ebp)
+	call v4__dpop@PLT
+	mov %eax,-20(%ebp)
+	call v4__dpop@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov -20(%ebp),%eax
+	mov %eax,%esi
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	mov %eax,%edi
+	mov -16(%ebp),%eax
+	mov %eax,-16(%ebp)
+	mov %edi,%eax
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov -16(%ebp),%eax
+	mov %eax,%edi
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	mov %eax,-16(%ebp)
+	mov %edi,%eax
+	mov %eax,-20(%ebp)
+	mov %esi,%eax
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov -20(%ebp),%eax
+	call v4__dpush@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	mov %eax,%esi
+	mov -16(%ebp),%eax
+	mov %eax,-16(%ebp)
+	mov %esi,%eax
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov -16(%ebp),%eax
+	call v4__dpush@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+.LBE28:
+.stabn 68,0,193,.LM373-v4_Minusrot
+.LM373:
+	lea -12(%ebp),%esp
+	pop %edi
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe28:
+	.size	 v4_Minusrot,.Lfe28-v4_Minusrot
+.stabn	192,0,0,.LBB28-v4_Minusrot
+.stabn	224,0,0,.LBE28-v4_Minusrot
+.Lscope28:
+.stabs	"",36,0,0,.Lscope28-v4_Minusrot
+.text
+	.align 4
+.stabs "v4_tuck:F1",36,0,0,v4_tuck
+	.weak v4_tuck
+	.type	v4_tuck,@function
+v4_tuck:
+.stabn 68,0,195,.LMa374-v4_tuck
+.LMa374:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+	call .Lpic29
+.Lpic29:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic29],%ebx
+0:
+.stabn 68,0,195,.LMb374-v4_tuck
+.LMb374:
+.LBB29:
+	call v4__dpop@PLT
+	mov %eax,-12(%ebp)
+	call v4__dpop@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov -12(%ebp),%eax
+	call v4__dpush@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+.stabn 68,0,159,.LM394-v4_tuck
+.LM394:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	dec %eax
+	shl $2,%eax
+	mov %eax,%esi
+.stabn 68,0,162,.LM405-v4_tuck
+.LM405:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov %eax,%esi
+.stabn 68,0,181,.LM412-v4_tuck
+.LM412:
+	mov $4,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	sub %edx,%eax
+	call v4__dpush@PLT
+	mov v4_Fetch@GOT(%ebx),%ecx
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE29:
+.stabn 68,0,196,.LM421-v4_tuck
+.LM421:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe29:
+	.size	 v4_tuck,.Lfe29-v4_tuck
+.stabn	192,0,0,.LBB29-v4_tuck
+.stabn	224,0,0,.LBE29-v4_tuck
+.Lscope29:
+.stabs	"",36,0,0,.Lscope29-v4_tuck
+.text
+	.align 4
+.stabs "v4_pick:F1",36,0,0,v4_pick
+	.weak v4_pick
+	.type	v4_pick,@function
+v4_pick:
+.stabn 68,0,198,.LMa422-v4_pick
+.LMa422:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+	call .Lpic30
+.Lpic30:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic30],%ebx
+0:
+.stabn 68,0,198,.LMb422-v4_pick
+.LMb422:
+.LBB30:
+	call v4__dpop@PLT
+	inc %eax
+	shl $2,%eax
+	call v4__dpush@PLT
+.stabn 68,0,159,.LM433-v4_pick
+.LM433:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	dec %eax
+	shl $2,%eax
+	mov %eax,%esi
+.stabn 68,0,162,.LM445-v4_pick
+.LM445:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov %eax,-12(%ebp)
+	call v4__dpop@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov -12(%ebp),%eax
+	mov %eax,%esi
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	sub %edx,%eax
+	call v4__dpush@PLT
+	mov v4_Fetch@GOT(%ebx),%ecx
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE30:
+.stabn 68,0,199,.LM476-v4_pick
+.LM476:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe30:
+	.size	 v4_pick,.Lfe30-v4_pick
+.stabn	192,0,0,.LBB30-v4_pick
+.stabn	224,0,0,.LBE30-v4_pick
+.Lscope30:
+.stabs	"",36,0,0,.Lscope30-v4_pick
+.text
+	.align 4
+.stabs "v4_roll:F1",36,0,0,v4_roll
+	.weak v4_roll
+	.type	v4_roll,@function
+v4_roll:
+.stabn 68,0,201,.LMa477-v4_roll
+.LMa477:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic32
+.Lpic32:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic32],%ebx
+0:
+.stabn 68,0,201,.LMb477-v4_roll
+.LMb477:
+.LBB32:
+.stabn 68,0,159,.LM480-v4_roll
+.LM480:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	dec %eax
+	shl $2,%eax
+	mov %eax,%esi
+.stabn 68,0,162,.LM491-v4_roll
+.LM491:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,178,.LM498-v4_roll
+.LM498:
+	call v4_Fetch@PLT
+.stabn 68,0,202,.LM499-v4_roll
+.LM499:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L18
+.stabn 68,0,172,.LM502-v4_roll
+.LM502:
+	call v4_Greaterr@PLT
+	call v4__dpop@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	call v4_r_Greater@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+.stabn 68,0,203,.LM514-v4_roll
+.LM514:
+	call v4_Greaterr@PLT
+	call v4__dpop@PLT
+	dec %eax
+	call v4__dpush@PLT
+	call v4_roll@PLT
+.stabn 68,0,205,.LM520-v4_roll
+.LM520:
+	call v4_r_Greater@PLT
+.stabn 68,0,172,.LM522-v4_roll
+.LM522:
+	call v4_Greaterr@PLT
+	call v4__dpop@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	call v4_r_Greater@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+.stabn 68,0,206,.LM534-v4_roll
+.LM534:
+	jmp .L19
+.L18:
+.stabn 68,0,175,.LM537-v4_roll
+.LM537:
+	call v4__dpop@PLT
+.L19:
+.LBE32:
+.stabn 68,0,208,.LM540-v4_roll
+.LM540:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe32:
+	.size	 v4_roll,.Lfe32-v4_roll
+.stabn	192,0,0,.LBB32-v4_roll
+.stabn	224,0,0,.LBE32-v4_roll
+.Lscope32:
+.stabs	"",36,0,0,.Lscope32-v4_roll
+.text
+	.align 4
+.stabs "v4_z2drop:F1",36,0,0,v4_z2drop
+	.weak v4_z2drop
+	.type	v4_z2drop,@function
+v4_z2drop:
+.stabn 68,0,210,.LMa541-v4_z2drop
+.LMa541:
+	push %ebx
+	call .Lpic33
+.Lpic33:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic33],%ebx
+0:
+.stabn 68,0,210,.LMb541-v4_z2drop
+.LMb541:
+.LBB33:
+.stabn 68,0,175,.LM543-v4_z2drop
+.LM543:
+	call v4__dpop@PLT
+.stabn 68,0,175,.LM545-v4_z2drop
+.LM545:
+	call v4__dpop@PLT
+.LBE33:
+.stabn 68,0,211,.LM547-v4_z2drop
+.LM547:
+	pop %ebx
+	ret
+.Lfe33:
+	.size	 v4_z2drop,.Lfe33-v4_z2drop
+.stabn	192,0,0,.LBB33-v4_z2drop
+.stabn	224,0,0,.LBE33-v4_z2drop
+.Lscope33:
+.stabs	"",36,0,0,.Lscope33-v4_z2drop
+.text
+	.align 4
+.stabs "v4_z2dup:F1",36,0,0,v4_z2dup
+	.weak v4_z2dup
+	.type	v4_z2dup,@function
+v4_z2dup:
+.stabn 68,0,213,.LMa548-v4_z2dup
+.LMa548:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic34
+.Lpic34:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic34],%ebx
+0:
+.stabn 68,0,213,.LMb548-v4_z2dup
+.LMb548:
+.LBB34:
+.stabn 68,0,159,.LM551-v4_z2dup
+.LM551:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	dec %eax
+	shl $2,%eax
+	mov %eax,%esi
+.stabn 68,0,162,.LM562-v4_z2dup
+.LM562:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov %eax,%esi
+.stabn 68,0,181,.LM569-v4_z2dup
+.LM569:
+	mov $4,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	sub %edx,%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+.stabn 68,0,159,.LM579-v4_z2dup
+.LM579:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	dec %eax
+	shl $2,%eax
+	mov %eax,%esi
+.stabn 68,0,162,.LM590-v4_z2dup
+.LM590:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov %eax,%esi
+.stabn 68,0,181,.LM597-v4_z2dup
+.LM597:
+	mov $4,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	sub %edx,%eax
+	call v4__dpush@PLT
+	mov v4_Fetch@GOT(%ebx),%ecx
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE34:
+.stabn 68,0,214,.LM606-v4_z2dup
+.LM606:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe34:
+	.size	 v4_z2dup,.Lfe34-v4_z2dup
+.stabn	192,0,0,.LBB34-v4_z2dup
+.stabn	224,0,0,.LBE34-v4_z2dup
+.Lscope34:
+.stabs	"",36,0,0,.Lscope34-v4_z2dup
+.text
+	.align 4
+.stabs "v4_z2over:F1",36,0,0,v4_z2over
+	.weak v4_z2over
+	.type	v4_z2over,@function
+v4_z2over:
+.stabn 68,0,216,.LMa607-v4_z2over
+.LMa607:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+	call .Lpic35
+.Lpic35:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic35],%ebx
+0:
+.stabn 68,0,216,.LMb607-v4_z2over
+.LMb607:
+.LBB35:
+.stabn 68,0,217,.LM608-v4_z2over
+.LM608:
+	mov $16,%eax
+	call v4__dpush@PLT
+.stabn 68,0,159,.LM614-v4_z2over
+.LM614:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	dec %eax
+	shl $2,%eax
+	mov %eax,%esi
+.stabn 68,0,162,.LM625-v4_z2over
+.LM625:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov %eax,-12(%ebp)
+	call v4__dpop@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov -12(%ebp),%eax
+	mov %eax,%esi
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	sub %edx,%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+.stabn 68,0,217,.LM655-v4_z2over
+.LM655:
+	mov $16,%eax
+	call v4__dpush@PLT
+.stabn 68,0,159,.LM661-v4_z2over
+.LM661:
+	mov v4__dsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	dec %eax
+	shl $2,%eax
+	mov %eax,%esi
+.stabn 68,0,162,.LM672-v4_z2over
+.LM672:
+	mov v4__dstack@GOT(%ebx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov %eax,-12(%ebp)
+	call v4__dpop@PLT
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov -12(%ebp),%eax
+	mov %eax,%esi
+	mov v4___Parenswap_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	sub %edx,%eax
+	call v4__dpush@PLT
+	mov v4_Fetch@GOT(%ebx),%ecx
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE35:
+.stabn 68,0,217,.LM703-v4_z2over
+.LM703:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe35:
+	.size	 v4_z2over,.Lfe35-v4_z2over
+.stabn	192,0,0,.LBB35-v4_z2over
+.stabn	224,0,0,.LBE35-v4_z2over
+.Lscope35:
+.stabs	"",36,0,0,.Lscope35-v4_z2over
+.text
+	.align 4
+.stabs "v4_z2swap:F1",36,0,0,v4_z2swap
+	.weak v4_z2swap
+	.type	v4_z2swap,@function
+v4_z2swap:
+.stabn 68,0,219,.LMa704-v4_z2swap
+.LMa704:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+	call .Lpic36
+.Lpic36:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic36],%ebx
+0:
+.stabn 68,0,219,.LMb704-v4_z2swap
+.LMb704:
+.LBB36:
+.stabn 68,0,217,.LM706-v4_z2swap
+.LM706:
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4_pick@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4_pick@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	mov %eax,-16(%ebp)
+	mov %edx,-20(%ebp)
+.stabn 68,0,175,.LM724-v4_z2swap
+.LM724:
+	call v4__dpop@PLT
+.stabn 68,0,175,.LM726-v4_z2swap
+.LM726:
+	call v4__dpop@PLT
+	mov -16(%ebp),%eax
+	mov -20(%ebp),%edx
+	call v4__dpush@PLT
+	mov %edx,%eax
+	call v4__dpush@PLT
+	mov -8(%ebp),%eax
+	mov -12(%ebp),%edx
+	call v4__dpush@PLT
+	xchg %edx,%eax
+	call v4__dpush@PLT
+	xchg %eax,%edx
+.LBE36:
+.stabn 68,0,220,.LM738-v4_z2swap
+.LM738:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe36:
+	.size	 v4_z2swap,.Lfe36-v4_z2swap
+.stabn	192,0,0,.LBB36-v4_z2swap
+.stabn	224,0,0,.LBE36-v4_z2swap
+.Lscope36:
+.stabs	"",36,0,0,.Lscope36-v4_z2swap
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
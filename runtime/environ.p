@@ -0,0 +1,1241 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: environ.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Data:
+    49 Data_22 string[7] "#locals"
+    27 Data_0 string[15] "/counted-string"
+    28 Data_1 string[5] "/hold"
+    29 Data_2 string[4] "/pad"
+    30 Data_3 string[17] "address-unit-bits"
+    31 Data_4 string[5] "block"
+    32 Data_5 string[9] "block-ext"
+    33 Data_6 string[4] "core"
+    34 Data_7 string[8] "core-ext"
+    35 Data_8 string[6] "double"
+    36 Data_9 string[10] "double-ext"
+    37 Data_10 string[9] "exception"
+    38 Data_11 string[13] "exception-ext"
+    39 Data_12 string[8] "facility"
+    40 Data_13 string[12] "facility-ext"
+    41 Data_14 string[4] "file"
+    42 Data_15 string[8] "file-ext"
+    43 Data_16 string[8] "floating"
+    44 Data_17 string[12] "floating-ext"
+    45 Data_18 string[14] "floating-stack"
+    46 Data_19 string[7] "floored"
+    47 Data_20 string[6] "locals"
+    48 Data_21 string[10] "locals-ext"
+    50 Data_23 string[8] "max-char"
+    51 Data_24 string[5] "max-d"
+    53 Data_25 string[9] "max-float"
+    54 Data_26 string[5] "max-n"
+    55 Data_27 string[5] "max-u"
+    56 Data_28 string[6] "max-ud"
+    57 Data_29 string[12] "memory-alloc"
+    58 Data_30 string[16] "memory-alloc-ext"
+    59 Data_31 string[18] "return-stack-cells"
+    60 Data_32 string[12] "search-order"
+    61 Data_33 string[16] "search-order-ext"
+    62 Data_34 string[11] "stack-cells"
+    63 Data_35 string[6] "string"
+    64 Data_36 string[10] "string-ext"
+    65 Data_37 string[5] "tools"
+    66 Data_38 string[9] "tools-ext"
+    68 Data_40 string[8] "vnpforth"
+    67 Data_39 string[9] "wordlists"
+
+Symbols:
+    59 Sym_11 external "v4_Minus"
+    23 Sym_0 word "v4___Parenenvironment_Question_Closeparen"
+    24 Sym_2 external "v4_comparei"
+    51 Sym_9 external "v4_dup"
+    26 Sym_7 word "v4_environment_Question"
+    24 Sym_6 external "v4_false"
+    51 Sym_8 external "v4_invert"
+    51 Sym_10 external "v4_rshift"
+    24 Sym_5 external "v4_true"
+    24 Sym_3 external "v4_z0_Equals"
+    24 Sym_4 external "v4_z2drop"
+    24 Sym_1 external "v4_z2over"
+
+Intermediate code:
+    23 function Sym_0 {
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_2
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_2
+    24   call Sym_4
+    24   no-op
+           optimizes   call Sym_5
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_3
+    24 label Label_2
+    24   no-op
+           optimizes   call Sym_6
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_3
+    24   no-op
+           optimizes label Label_1
+    24 }
+
+    26 function Sym_7 {
+    27   Reg_0 = Data_0
+    27   Stack_D = Reg_0
+    27   Reg_0 = 15
+    27   Stack_D = Reg_0
+    27   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_46
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_46
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_47
+    24 label Label_46
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_47
+    27   Reg_0 = Stack_D
+    27   if Reg_0 == 0 goto Label_5
+    27   Reg_0 = 255
+    27   Stack_D = Reg_0
+    27   no-op
+           optimizes   call Sym_5
+    27   Reg_0 = -1
+    27   Stack_D = Reg_0
+    27   goto Label_4
+    27 label Label_5
+    28   Reg_0 = Data_1
+    28   Stack_D = Reg_0
+    28   Reg_0 = 5
+    28   Stack_D = Reg_0
+    28   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_48
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_48
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_49
+    24 label Label_48
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_49
+    28   Reg_0 = Stack_D
+    28   if Reg_0 == 0 goto Label_6
+    28   Reg_0 = 84
+    28   Stack_D = Reg_0
+    28   no-op
+           optimizes   call Sym_5
+    28   Reg_0 = -1
+    28   Stack_D = Reg_0
+    28   goto Label_4
+    28 label Label_6
+    29   Reg_0 = Data_2
+    29   Stack_D = Reg_0
+    29   Reg_0 = 4
+    29   Stack_D = Reg_0
+    29   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_50
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_50
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_51
+    24 label Label_50
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_51
+    29   Reg_0 = Stack_D
+    29   if Reg_0 == 0 goto Label_7
+    29   Reg_0 = 84
+    29   Stack_D = Reg_0
+    29   no-op
+           optimizes   call Sym_5
+    29   Reg_0 = -1
+    29   Stack_D = Reg_0
+    29   goto Label_4
+    29 label Label_7
+    30   Reg_0 = Data_3
+    30   Stack_D = Reg_0
+    30   Reg_0 = 17
+    30   Stack_D = Reg_0
+    30   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_52
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_52
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_53
+    24 label Label_52
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_53
+    30   Reg_0 = Stack_D
+    30   if Reg_0 == 0 goto Label_8
+    30   Reg_0 = 8
+    30   Stack_D = Reg_0
+    30   no-op
+           optimizes   call Sym_5
+    30   Reg_0 = -1
+    30   Stack_D = Reg_0
+    30   goto Label_4
+    30 label Label_8
+    31   Reg_0 = Data_4
+    31   Stack_D = Reg_0
+    31   Reg_0 = 5
+    31   Stack_D = Reg_0
+    31   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_54
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_54
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_55
+    24 label Label_54
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_55
+    31   Reg_0 = Stack_D
+    31   if Reg_0 == 0 goto Label_9
+    31   no-op
+           optimizes   call Sym_6
+    31   Reg_0 = 0
+    31   Stack_D = Reg_0
+    31   no-op
+           optimizes   call Sym_5
+    31   Reg_0 = -1
+    31   Stack_D = Reg_0
+    31   goto Label_4
+    31 label Label_9
+    32   Reg_0 = Data_5
+    32   Stack_D = Reg_0
+    32   Reg_0 = 9
+    32   Stack_D = Reg_0
+    32   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_56
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_56
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_57
+    24 label Label_56
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_57
+    32   Reg_0 = Stack_D
+    32   if Reg_0 == 0 goto Label_10
+    32   no-op
+           optimizes   call Sym_6
+    32   Reg_0 = 0
+    32   Stack_D = Reg_0
+    32   no-op
+           optimizes   call Sym_5
+    32   Reg_0 = -1
+    32   Stack_D = Reg_0
+    32   goto Label_4
+    32 label Label_10
+    33   Reg_0 = Data_6
+    33   Stack_D = Reg_0
+    33   Reg_0 = 4
+    33   Stack_D = Reg_0
+    33   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_58
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_58
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_59
+    24 label Label_58
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_59
+    33   Reg_0 = Stack_D
+    33   if Reg_0 == 0 goto Label_11
+    33   no-op
+           optimizes   call Sym_5
+    33   Reg_0 = -1
+    33   Stack_D = Reg_0
+    33   no-op
+           optimizes   call Sym_5
+    33   Reg_0 = -1
+    33   Stack_D = Reg_0
+    33   goto Label_4
+    33 label Label_11
+    34   Reg_0 = Data_7
+    34   Stack_D = Reg_0
+    34   Reg_0 = 8
+    34   Stack_D = Reg_0
+    34   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_60
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_60
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_61
+    24 label Label_60
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_61
+    34   Reg_0 = Stack_D
+    34   if Reg_0 == 0 goto Label_12
+    34   no-op
+           optimizes   call Sym_6
+    34   Reg_0 = 0
+    34   Stack_D = Reg_0
+    34   no-op
+           optimizes   call Sym_5
+    34   Reg_0 = -1
+    34   Stack_D = Reg_0
+    34   goto Label_4
+    34 label Label_12
+    35   Reg_0 = Data_8
+    35   Stack_D = Reg_0
+    35   Reg_0 = 6
+    35   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_62
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_62
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_63
+    24 label Label_62
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_63
+    35   Reg_0 = Stack_D
+    35   if Reg_0 == 0 goto Label_13
+    35   no-op
+           optimizes   call Sym_6
+    35   Reg_0 = 0
+    35   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_5
+    35   Reg_0 = -1
+    35   Stack_D = Reg_0
+    35   goto Label_4
+    35 label Label_13
+    36   Reg_0 = Data_9
+    36   Stack_D = Reg_0
+    36   Reg_0 = 10
+    36   Stack_D = Reg_0
+    36   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_64
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_64
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_65
+    24 label Label_64
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_65
+    36   Reg_0 = Stack_D
+    36   if Reg_0 == 0 goto Label_14
+    36   no-op
+           optimizes   call Sym_6
+    36   Reg_0 = 0
+    36   Stack_D = Reg_0
+    36   no-op
+           optimizes   call Sym_5
+    36   Reg_0 = -1
+    36   Stack_D = Reg_0
+    36   goto Label_4
+    36 label Label_14
+    37   Reg_0 = Data_10
+    37   Stack_D = Reg_0
+    37   Reg_0 = 9
+    37   Stack_D = Reg_0
+    37   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_66
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_66
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_67
+    24 label Label_66
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_67
+    37   Reg_0 = Stack_D
+    37   if Reg_0 == 0 goto Label_15
+    37   no-op
+           optimizes   call Sym_5
+    37   Reg_0 = -1
+    37   Stack_D = Reg_0
+    37   no-op
+           optimizes   call Sym_5
+    37   Reg_0 = -1
+    37   Stack_D = Reg_0
+    37   goto Label_4
+    37 label Label_15
+    38   Reg_0 = Data_11
+    38   Stack_D = Reg_0
+    38   Reg_0 = 13
+    38   Stack_D = Reg_0
+    38   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_68
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_68
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_69
+    24 label Label_68
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_69
+    38   Reg_0 = Stack_D
+    38   if Reg_0 == 0 goto Label_16
+    38   no-op
+           optimizes   call Sym_5
+    38   Reg_0 = -1
+    38   Stack_D = Reg_0
+    38   no-op
+           optimizes   call Sym_5
+    38   Reg_0 = -1
+    38   Stack_D = Reg_0
+    38   goto Label_4
+    38 label Label_16
+    39   Reg_0 = Data_12
+    39   Stack_D = Reg_0
+    39   Reg_0 = 8
+    39   Stack_D = Reg_0
+    39   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_70
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_70
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_71
+    24 label Label_70
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_71
+    39   Reg_0 = Stack_D
+    39   if Reg_0 == 0 goto Label_17
+    39   no-op
+           optimizes   call Sym_6
+    39   Reg_0 = 0
+    39   Stack_D = Reg_0
+    39   no-op
+           optimizes   call Sym_5
+    39   Reg_0 = -1
+    39   Stack_D = Reg_0
+    39   goto Label_4
+    39 label Label_17
+    40   Reg_0 = Data_13
+    40   Stack_D = Reg_0
+    40   Reg_0 = 12
+    40   Stack_D = Reg_0
+    40   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_72
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_72
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_73
+    24 label Label_72
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_73
+    40   Reg_0 = Stack_D
+    40   if Reg_0 == 0 goto Label_18
+    40   no-op
+           optimizes   call Sym_6
+    40   Reg_0 = 0
+    40   Stack_D = Reg_0
+    40   no-op
+           optimizes   call Sym_5
+    40   Reg_0 = -1
+    40   Stack_D = Reg_0
+    40   goto Label_4
+    40 label Label_18
+    41   Reg_0 = Data_14
+    41   Stack_D = Reg_0
+    41   Reg_0 = 4
+    41   Stack_D = Reg_0
+    41   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_74
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_74
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_75
+    24 label Label_74
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_75
+    41   Reg_0 = Stack_D
+    41   if Reg_0 == 0 goto Label_19
+    41   no-op
+           optimizes   call Sym_6
+    41   Reg_0 = 0
+    41   Stack_D = Reg_0
+    41   no-op
+           optimizes   call Sym_5
+    41   Reg_0 = -1
+    41   Stack_D = Reg_0
+    41   goto Label_4
+    41 label Label_19
+    42   Reg_0 = Data_15
+    42   Stack_D = Reg_0
+    42   Reg_0 = 8
+    42   Stack_D = Reg_0
+    42   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_76
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_76
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_77
+    24 label Label_76
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_77
+    42   Reg_0 = Stack_D
+    42   if Reg_0 == 0 goto Label_20
+    42   no-op
+           optimizes   call Sym_6
+    42   Reg_0 = 0
+    42   Stack_D = Reg_0
+    42   no-op
+           optimizes   call Sym_5
+    42   Reg_0 = -1
+    42   Stack_D = Reg_0
+    42   goto Label_4
+    42 label Label_20
+    43   Reg_0 = Data_16
+    43   Stack_D = Reg_0
+    43   Reg_0 = 8
+    43   Stack_D = Reg_0
+    43   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_78
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_78
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_79
+    24 label Label_78
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_79
+    43   Reg_0 = Stack_D
+    43   if Reg_0 == 0 goto Label_21
+    43   no-op
+           optimizes   call Sym_5
+    43   Reg_0 = -1
+    43   Stack_D = Reg_0
+    43   no-op
+           optimizes   call Sym_5
+    43   Reg_0 = -1
+    43   Stack_D = Reg_0
+    43   goto Label_4
+    43 label Label_21
+    44   Reg_0 = Data_17
+    44   Stack_D = Reg_0
+    44   Reg_0 = 12
+    44   Stack_D = Reg_0
+    44   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_80
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_80
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_81
+    24 label Label_80
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_81
+    44   Reg_0 = Stack_D
+    44   if Reg_0 == 0 goto Label_22
+    44   no-op
+           optimizes   call Sym_6
+    44   Reg_0 = 0
+    44   Stack_D = Reg_0
+    44   no-op
+           optimizes   call Sym_5
+    44   Reg_0 = -1
+    44   Stack_D = Reg_0
+    44   goto Label_4
+    44 label Label_22
+    45   Reg_0 = Data_18
+    45   Stack_D = Reg_0
+    45   Reg_0 = 14
+    45   Stack_D = Reg_0
+    45   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_82
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_82
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_83
+    24 label Label_82
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_83
+    45   Reg_0 = Stack_D
+    45   if Reg_0 == 0 goto Label_23
+    45   Reg_0 = 6
+    45   Stack_D = Reg_0
+    45   no-op
+           optimizes   call Sym_5
+    45   Reg_0 = -1
+    45   Stack_D = Reg_0
+    45   goto Label_4
+    45 label Label_23
+    46   Reg_0 = Data_19
+    46   Stack_D = Reg_0
+    46   Reg_0 = 7
+    46   Stack_D = Reg_0
+    46   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_84
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_84
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_85
+    24 label Label_84
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_85
+    46   Reg_0 = Stack_D
+    46   if Reg_0 == 0 goto Label_24
+    46   no-op
+           optimizes   call Sym_6
+    46   Reg_0 = 0
+    46   Stack_D = Reg_0
+    46   no-op
+           optimizes   call Sym_5
+    46   Reg_0 = -1
+    46   Stack_D = Reg_0
+    46   goto Label_4
+    46 label Label_24
+    47   Reg_0 = Data_20
+    47   Stack_D = Reg_0
+    47   Reg_0 = 6
+    47   Stack_D = Reg_0
+    47   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_86
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_86
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_87
+    24 label Label_86
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_87
+    47   Reg_0 = Stack_D
+    47   if Reg_0 == 0 goto Label_25
+    47   no-op
+           optimizes   call Sym_6
+    47   Reg_0 = 0
+    47   Stack_D = Reg_0
+    47   no-op
+           optimizes   call Sym_5
+    47   Reg_0 = -1
+    47   Stack_D = Reg_0
+    47   goto Label_4
+    47 label Label_25
+    48   Reg_0 = Data_21
+    48   Stack_D = Reg_0
+    48   Reg_0 = 10
+    48   Stack_D = Reg_0
+    48   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   no-op
+           optimizes   call Sym_3
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_88
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_88
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_89
+    24 label Label_88
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_89
+    48   Reg_0 = Stack_D
+    48   if Reg_0 == 0 goto Label_26
+    48   no-op
+           optimizes   call Sym_6
+    48   Reg_0 = 0
+    48   Stack_D = Reg_0
+    48   no-op
+           optimizes   call Sym_5
+    48   Reg_0 = -1
+    48   Stack_D = Reg_0
+    48   goto Label_4
+    48 label Label_26
+    49   Reg_0 = Data_22
+    49   Stack_D = Reg_0
+    49   Reg_0 = 7
+    49   Stack_D = Reg_0
+    49   no-op
+           optimizes   call Sym_0
+    24   call Sym_1
+    24   call Sym_2
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_90
+    24   call Sym_4
+    24   Reg_0 = -1
+    24   Stack_D = Reg_0
+    24   goto Label_91
+    24 label Label_90
+    24   Reg_0 = 0
+    24   Stack_D = Reg_0
+    24 label Label_91
+    49   Reg_0 = Stack_D
+    49   if Reg_0 == 0 goto Label_27
+    49   Reg_0 = 0
+    49   Stack_D = Reg_0
+    49   no-op
+           optimizes   call Sym_5
+    49   Reg_0 = -1
+    49   Stack_D = Reg_0
+    49   goto Label_4
+    49 label Label_27
+    50   Reg_0 = Data_23
+    50   Stack_D = Reg_0
+    50   Reg_0 = 8
+    50   Stack_D = Reg_0
+    50   call Sym_0
+    50   Reg_0 = Stack_D
+    50   if Reg_0 == 0 goto Label_28
+    50   Reg_0 = 255
+    50   Stack_D = Reg_0
+    50   no-op
+           optimizes   call Sym_5
+    50   Reg_0 = -1
+    50   Stack_D = Reg_0
+    50   goto Label_4
+    50 label Label_28
+    51   Reg_0 = Data_24
+    51   Stack_D = Reg_0
+    51   Reg_0 = 5
+    51   Stack_D = Reg_0
+    51   call Sym_0
+    51   Reg_0 = Stack_D
+    51   if Reg_0 == 0 goto Label_29
+    51   Reg_0 = -1
+           optimizes   Reg_0 = 0
+    51   Stack_D = Reg_0
+    51   no-op
+           optimizes   call Sym_8
+    51   call Sym_9
+    51   Reg_0 = 1
+    51   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    51   no-op
+           optimizes   call Sym_10
+    51   no-op
+           optimizes   Reg_1 = Stack_D
+    51   Reg_0 = Stack_D
+    51   Reg_0 >>= Reg_1
+    51   Stack_D = Reg_0
+    52   no-op
+           optimizes   call Sym_5
+    52   Reg_0 = -1
+    52   Stack_D = Reg_0
+    52   goto Label_4
+    52 label Label_29
+    53   Reg_0 = Data_25
+    53   Stack_D = Reg_0
+    53   Reg_0 = 9
+    53   Stack_D = Reg_0
+    53   call Sym_0
+    53   Reg_0 = Stack_D
+    53   if Reg_0 == 0 goto Label_30
+    53   Reg_0 = 2139095022
+    53   Stack_F = Reg_0
+    53   no-op
+           optimizes   call Sym_5
+    53   Reg_0 = -1
+    53   Stack_D = Reg_0
+    53   goto Label_4
+    53 label Label_30
+    54   Reg_0 = Data_26
+    54   Stack_D = Reg_0
+    54   Reg_0 = 5
+    54   Stack_D = Reg_0
+    54   call Sym_0
+    54   Reg_0 = Stack_D
+    54   if Reg_0 == 0 goto Label_31
+    54   Reg_0 = 2147483647
+           optimizes   Reg_0 = -1
+    54   Stack_D = Reg_0
+    54   no-op
+           optimizes   call Sym_8
+    54   no-op
+           optimizes   Reg_0 = 1
+    54   no-op
+           optimizes   Stack_D = Reg_0
+    54   no-op
+           optimizes   call Sym_10
+    54   no-op
+           optimizes   call Sym_5
+    54   Reg_0 = -1
+    54   Stack_D = Reg_0
+    54   goto Label_4
+    54 label Label_31
+    55   Reg_0 = Data_27
+    55   Stack_D = Reg_0
+    55   Reg_0 = 5
+    55   Stack_D = Reg_0
+    55   call Sym_0
+    55   Reg_0 = Stack_D
+    55   if Reg_0 == 0 goto Label_32
+    55   Reg_0 = -1
+           optimizes   Reg_0 = 0
+    55   Stack_D = Reg_0
+    55   no-op
+           optimizes   call Sym_8
+    55   no-op
+           optimizes   call Sym_5
+    55   Reg_0 = -1
+    55   Stack_D = Reg_0
+    55   goto Label_4
+    55 label Label_32
+    56   Reg_0 = Data_28
+    56   Stack_D = Reg_0
+    56   Reg_0 = 6
+    56   Stack_D = Reg_0
+    56   call Sym_0
+    56   Reg_0 = Stack_D
+    56   if Reg_0 == 0 goto Label_33
+    56   Reg_0 = -1
+           optimizes   Reg_0 = 0
+    56   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_8
+    56   call Sym_9
+    56   no-op
+           optimizes   call Sym_5
+    56   Reg_0 = -1
+    56   Stack_D = Reg_0
+    56   goto Label_4
+    56 label Label_33
+    57   Reg_0 = Data_29
+    57   Stack_D = Reg_0
+    57   Reg_0 = 12
+    57   Stack_D = Reg_0
+    57   call Sym_0
+    57   Reg_0 = Stack_D
+    57   if Reg_0 == 0 goto Label_34
+    57   no-op
+           optimizes   call Sym_5
+    57   Reg_0 = -1
+    57   Stack_D = Reg_0
+    57   no-op
+           optimizes   call Sym_5
+    57   Reg_0 = -1
+    57   Stack_D = Reg_0
+    57   goto Label_4
+    57 label Label_34
+    58   Reg_0 = Data_30
+    58   Stack_D = Reg_0
+    58   Reg_0 = 16
+    58   Stack_D = Reg_0
+    58   call Sym_0
+    58   Reg_0 = Stack_D
+    58   if Reg_0 == 0 goto Label_35
+    58   no-op
+           optimizes   call Sym_5
+    58   Reg_0 = -1
+    58   Stack_D = Reg_0
+    58   no-op
+           optimizes   call Sym_5
+    58   Reg_0 = -1
+    58   Stack_D = Reg_0
+    58   goto Label_4
+    58 label Label_35
+    59   Reg_0 = Data_31
+    59   Stack_D = Reg_0
+    59   Reg_0 = 18
+    59   Stack_D = Reg_0
+    59   call Sym_0
+    59   Reg_0 = Stack_D
+    59   if Reg_0 == 0 goto Label_36
+    59   Reg_0 = 2032
+           optimizes   Reg_0 = 2048
+    59   Stack_D = Reg_0
+    59   no-op
+           optimizes   Reg_0 = 16
+    59   no-op
+           optimizes   Stack_D = Reg_0
+    59   no-op
+           optimizes   call Sym_11
+    59   no-op
+           optimizes   call Sym_5
+    59   Reg_0 = -1
+    59   Stack_D = Reg_0
+    59   goto Label_4
+    59 label Label_36
+    60   Reg_0 = Data_32
+    60   Stack_D = Reg_0
+    60   Reg_0 = 12
+    60   Stack_D = Reg_0
+    60   call Sym_0
+    60   Reg_0 = Stack_D
+    60   if Reg_0 == 0 goto Label_37
+    60   no-op
+           optimizes   call Sym_6
+    60   Reg_0 = 0
+    60   Stack_D = Reg_0
+    60   no-op
+           optimizes   call Sym_5
+    60   Reg_0 = -1
+    60   Stack_D = Reg_0
+    60   goto Label_4
+    60 label Label_37
+    61   Reg_0 = Data_33
+    61   Stack_D = Reg_0
+    61   Reg_0 = 16
+    61   Stack_D = Reg_0
+    61   call Sym_0
+    61   Reg_0 = Stack_D
+    61   if Reg_0 == 0 goto Label_38
+    61   no-op
+           optimizes   call Sym_6
+    61   Reg_0 = 0
+    61   Stack_D = Reg_0
+    61   no-op
+           optimizes   call Sym_5
+    61   Reg_0 = -1
+    61   Stack_D = Reg_0
+    61   goto Label_4
+    61 label Label_38
+    62   Reg_0 = Data_34
+    62   Stack_D = Reg_0
+    62   Reg_0 = 11
+    62   Stack_D = Reg_0
+    62   call Sym_0
+    62   Reg_0 = Stack_D
+    62   if Reg_0 == 0 goto Label_39
+    62   Reg_0 = 4080
+           optimizes   Reg_0 = 4096
+    62   Stack_D = Reg_0
+    62   no-op
+           optimizes   Reg_0 = 16
+    62   no-op
+           optimizes   Stack_D = Reg_0
+    62   no-op
+           optimizes   call Sym_11
+    62   no-op
+           optimizes   call Sym_5
+    62   Reg_0 = -1
+    62   Stack_D = Reg_0
+    62   goto Label_4
+    62 label Label_39
+    63   Reg_0 = Data_35
+    63   Stack_D = Reg_0
+    63   Reg_0 = 6
+    63   Stack_D = Reg_0
+    63   call Sym_0
+    63   Reg_0 = Stack_D
+    63   if Reg_0 == 0 goto Label_40
+    63   no-op
+           optimizes   call Sym_5
+    63   Reg_0 = -1
+    63   Stack_D = Reg_0
+    63   no-op
+           optimizes   call Sym_5
+    63   Reg_0 = -1
+    63   Stack_D = Reg_0
+    63   goto Label_4
+    63 label Label_40
+    64   Reg_0 = Data_36
+    64   Stack_D = Reg_0
+    64   Reg_0 = 10
+    64   Stack_D = Reg_0
+    64   call Sym_0
+    64   Reg_0 = Stack_D
+    64   if Reg_0 == 0 goto Label_41
+    64   no-op
+           optimizes   call Sym_5
+    64   Reg_0 = -1
+    64   Stack_D = Reg_0
+    64   no-op
+           optimizes   call Sym_5
+    64   Reg_0 = -1
+    64   Stack_D = Reg_0
+    64   goto Label_4
+    64 label Label_41
+    65   Reg_0 = Data_37
+    65   Stack_D = Reg_0
+    65   Reg_0 = 5
+    65   Stack_D = Reg_0
+    65   call Sym_0
+    65   Reg_0 = Stack_D
+    65   if Reg_0 == 0 goto Label_42
+    65   no-op
+           optimizes   call Sym_5
+    65   Reg_0 = -1
+    65   Stack_D = Reg_0
+    65   no-op
+           optimizes   call Sym_5
+    65   Reg_0 = -1
+    65   Stack_D = Reg_0
+    65   goto Label_4
+    65 label Label_42
+    66   Reg_0 = Data_38
+    66   Stack_D = Reg_0
+    66   Reg_0 = 9
+    66   Stack_D = Reg_0
+    66   call Sym_0
+    66   Reg_0 = Stack_D
+    66   if Reg_0 == 0 goto Label_43
+    66   no-op
+           optimizes   call Sym_6
+    66   Reg_0 = 0
+    66   Stack_D = Reg_0
+    66   no-op
+           optimizes   call Sym_5
+    66   Reg_0 = -1
+    66   Stack_D = Reg_0
+    66   goto Label_4
+    66 label Label_43
+    67   Reg_0 = Data_39
+    67   Stack_D = Reg_0
+    67   Reg_0 = 9
+    67   Stack_D = Reg_0
+    67   call Sym_0
+    67   Reg_0 = Stack_D
+    67   if Reg_0 == 0 goto Label_44
+    67   Reg_0 = 0
+    67   Stack_D = Reg_0
+    67   no-op
+           optimizes   call Sym_5
+    67   Reg_0 = -1
+    67   Stack_D = Reg_0
+    67   goto Label_4
+    67 label Label_44
+    68   Reg_0 = Data_40
+    68   Stack_D = Reg_0
+    68   Reg_0 = 8
+    68   Stack_D = Reg_0
+    68   call Sym_0
+    68   Reg_0 = Stack_D
+    68   if Reg_0 == 0 goto Label_45
+    68   no-op
+           optimizes   call Sym_5
+    68   Reg_0 = -1
+    68   Stack_D = Reg_0
+    68   no-op
+           optimizes   call Sym_5
+    68   Reg_0 = -1
+    68   Stack_D = Reg_0
+    68   goto Label_4
+    68 label Label_45
+    69   call Sym_4
+    69   no-op
+           optimizes   call Sym_6
+    69   Reg_0 = 0
+    69   Stack_D = Reg_0
+    69 label Label_4
+    69 }
+
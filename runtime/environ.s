@@ -0,0 +1,1294 @@
+	.file	"environ.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"environ.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC22:
+	.string "#locals"
+.LC0:
+	.string "/counted-string"
+.LC1:
+	.string "/hold"
+.LC2:
+	.string "/pad"
+.LC3:
+	.string "address-unit-bits"
+.LC4:
+	.string "block"
+.LC5:
+	.string "block-ext"
+.LC6:
+	.string "core"
+.LC7:
+	.string "core-ext"
+.LC8:
+	.string "double"
+.LC9:
+	.string "double-ext"
+.LC10:
+	.string "exception"
+.LC11:
+	.string "exception-ext"
+.LC12:
+	.string "facility"
+.LC13:
+	.string "facility-ext"
+.LC14:
+	.string "file"
+.LC15:
+	.string "file-ext"
+.LC16:
+	.string "floating"
+.LC17:
+	.string "floating-ext"
+.LC18:
+	.string "floating-stack"
+.LC19:
+	.string "floored"
+.LC20:
+	.string "locals"
+.LC21:
+	.string "locals-ext"
+.LC23:
+	.string "max-char"
+.LC24:
+	.string "max-d"
+.LC25:
+	.string "max-float"
+.LC26:
+	.string "max-n"
+.LC27:
+	.string "max-u"
+.LC28:
+	.string "max-ud"
+.LC29:
+	.string "memory-alloc"
+.LC30:
+	.string "memory-alloc-ext"
+.LC31:
+	.string "return-stack-cells"
+.LC32:
+	.string "search-order"
+.LC33:
+	.string "search-order-ext"
+.LC34:
+	.string "stack-cells"
+.LC35:
+	.string "string"
+.LC36:
+	.string "string-ext"
+.LC37:
+	.string "tools"
+.LC38:
+	.string "tools-ext"
+.LC40:
+	.string "vnpforth"
+.LC39:
+	.string "wordlists"
+.text
+	.align 4
+.stabs "v4___Parenenvironment_Question_Closeparen:F1",36,0,0,v4___Parenenvironment_Question_Closeparen
+	.weak v4___Parenenvironment_Question_Closeparen
+	.type	v4___Parenenvironment_Question_Closeparen,@function
+v4___Parenenvironment_Question_Closeparen:
+.stabn 68,0,23,.LMa0-v4___Parenenvironment_Question_Closeparen
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,23,.LMb0-v4___Parenenvironment_Question_Closeparen
+.LMb0:
+.LBB0:
+.stabn 68,0,24,.LM1-v4___Parenenvironment_Question_Closeparen
+.LM1:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L2
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L3
+.L2:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L3:
+.LBE0:
+.stabn 68,0,24,.LM19-v4___Parenenvironment_Question_Closeparen
+.LM19:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4___Parenenvironment_Question_Closeparen,.Lfe0-v4___Parenenvironment_Question_Closeparen
+.stabn	192,0,0,.LBB0-v4___Parenenvironment_Question_Closeparen
+.stabn	224,0,0,.LBE0-v4___Parenenvironment_Question_Closeparen
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4___Parenenvironment_Question_Closeparen
+.text
+	.align 4
+.stabs "v4_environment_Question:F1",36,0,0,v4_environment_Question
+	.weak v4_environment_Question
+	.type	v4_environment_Question,@function
+v4_environment_Question:
+.stabn 68,0,26,.LMa20-v4_environment_Question
+.LMa20:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic7
+.Lpic7:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic7],%ebx
+0:
+.stabn 68,0,26,.LMb20-v4_environment_Question
+.LMb20:
+.LBB7:
+.stabn 68,0,27,.LM21-v4_environment_Question
+.LM21:
+	lea .LC0@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $15,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM26-v4_environment_Question
+.LM26:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L46
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L47
+.L46:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L47:
+.stabn 68,0,27,.LM41-v4_environment_Question
+.LM41:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L5
+	mov $255,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L5:
+.stabn 68,0,28,.LM50-v4_environment_Question
+.LM50:
+	lea .LC1@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $5,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM55-v4_environment_Question
+.LM55:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L48
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L49
+.L48:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L49:
+.stabn 68,0,28,.LM70-v4_environment_Question
+.LM70:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L6
+	mov $84,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L6:
+.stabn 68,0,29,.LM79-v4_environment_Question
+.LM79:
+	lea .LC2@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM84-v4_environment_Question
+.LM84:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L50
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L51
+.L50:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L51:
+.stabn 68,0,29,.LM99-v4_environment_Question
+.LM99:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L7
+	mov $84,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L7:
+.stabn 68,0,30,.LM108-v4_environment_Question
+.LM108:
+	lea .LC3@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $17,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM113-v4_environment_Question
+.LM113:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L52
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L53
+.L52:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L53:
+.stabn 68,0,30,.LM128-v4_environment_Question
+.LM128:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L8
+	mov $8,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L8:
+.stabn 68,0,31,.LM137-v4_environment_Question
+.LM137:
+	lea .LC4@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $5,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM142-v4_environment_Question
+.LM142:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L54
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L55
+.L54:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L55:
+.stabn 68,0,31,.LM157-v4_environment_Question
+.LM157:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L9
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L9:
+.stabn 68,0,32,.LM167-v4_environment_Question
+.LM167:
+	lea .LC5@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $9,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM172-v4_environment_Question
+.LM172:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L56
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L57
+.L56:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L57:
+.stabn 68,0,32,.LM187-v4_environment_Question
+.LM187:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L10
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L10:
+.stabn 68,0,33,.LM197-v4_environment_Question
+.LM197:
+	lea .LC6@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM202-v4_environment_Question
+.LM202:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L58
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L59
+.L58:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L59:
+.stabn 68,0,33,.LM217-v4_environment_Question
+.LM217:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L11
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L11:
+.stabn 68,0,34,.LM227-v4_environment_Question
+.LM227:
+	lea .LC7@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $8,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM232-v4_environment_Question
+.LM232:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L60
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L61
+.L60:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L61:
+.stabn 68,0,34,.LM247-v4_environment_Question
+.LM247:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L12
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L12:
+.stabn 68,0,35,.LM257-v4_environment_Question
+.LM257:
+	lea .LC8@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $6,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM262-v4_environment_Question
+.LM262:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L62
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L63
+.L62:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L63:
+.stabn 68,0,35,.LM277-v4_environment_Question
+.LM277:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L13
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L13:
+.stabn 68,0,36,.LM287-v4_environment_Question
+.LM287:
+	lea .LC9@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $10,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM292-v4_environment_Question
+.LM292:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L64
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L65
+.L64:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L65:
+.stabn 68,0,36,.LM307-v4_environment_Question
+.LM307:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L14
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L14:
+.stabn 68,0,37,.LM317-v4_environment_Question
+.LM317:
+	lea .LC10@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $9,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM322-v4_environment_Question
+.LM322:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L66
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L67
+.L66:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L67:
+.stabn 68,0,37,.LM337-v4_environment_Question
+.LM337:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L15
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L15:
+.stabn 68,0,38,.LM347-v4_environment_Question
+.LM347:
+	lea .LC11@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $13,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM352-v4_environment_Question
+.LM352:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L68
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L69
+.L68:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L69:
+.stabn 68,0,38,.LM367-v4_environment_Question
+.LM367:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L16
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L16:
+.stabn 68,0,39,.LM377-v4_environment_Question
+.LM377:
+	lea .LC12@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $8,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM382-v4_environment_Question
+.LM382:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L70
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L71
+.L70:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L71:
+.stabn 68,0,39,.LM397-v4_environment_Question
+.LM397:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L17
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L17:
+.stabn 68,0,40,.LM407-v4_environment_Question
+.LM407:
+	lea .LC13@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $12,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM412-v4_environment_Question
+.LM412:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L72
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L73
+.L72:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L73:
+.stabn 68,0,40,.LM427-v4_environment_Question
+.LM427:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L18
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L18:
+.stabn 68,0,41,.LM437-v4_environment_Question
+.LM437:
+	lea .LC14@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM442-v4_environment_Question
+.LM442:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L74
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L75
+.L74:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L75:
+.stabn 68,0,41,.LM457-v4_environment_Question
+.LM457:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L19
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L19:
+.stabn 68,0,42,.LM467-v4_environment_Question
+.LM467:
+	lea .LC15@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $8,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM472-v4_environment_Question
+.LM472:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L76
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L77
+.L76:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L77:
+.stabn 68,0,42,.LM487-v4_environment_Question
+.LM487:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L20
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L20:
+.stabn 68,0,43,.LM497-v4_environment_Question
+.LM497:
+	lea .LC16@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $8,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM502-v4_environment_Question
+.LM502:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L78
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L79
+.L78:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L79:
+.stabn 68,0,43,.LM517-v4_environment_Question
+.LM517:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L21
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L21:
+.stabn 68,0,44,.LM527-v4_environment_Question
+.LM527:
+	lea .LC17@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $12,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM532-v4_environment_Question
+.LM532:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L80
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L81
+.L80:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L81:
+.stabn 68,0,44,.LM547-v4_environment_Question
+.LM547:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L22
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L22:
+.stabn 68,0,45,.LM557-v4_environment_Question
+.LM557:
+	lea .LC18@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $14,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM562-v4_environment_Question
+.LM562:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L82
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L83
+.L82:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L83:
+.stabn 68,0,45,.LM577-v4_environment_Question
+.LM577:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L23
+	mov $6,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L23:
+.stabn 68,0,46,.LM586-v4_environment_Question
+.LM586:
+	lea .LC19@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $7,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM591-v4_environment_Question
+.LM591:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L84
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L85
+.L84:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L85:
+.stabn 68,0,46,.LM606-v4_environment_Question
+.LM606:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L24
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L24:
+.stabn 68,0,47,.LM616-v4_environment_Question
+.LM616:
+	lea .LC20@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $6,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM621-v4_environment_Question
+.LM621:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L86
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L87
+.L86:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L87:
+.stabn 68,0,47,.LM636-v4_environment_Question
+.LM636:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L25
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L25:
+.stabn 68,0,48,.LM646-v4_environment_Question
+.LM646:
+	lea .LC21@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $10,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM651-v4_environment_Question
+.LM651:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L88
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L89
+.L88:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L89:
+.stabn 68,0,48,.LM666-v4_environment_Question
+.LM666:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L26
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L26:
+.stabn 68,0,49,.LM676-v4_environment_Question
+.LM676:
+	lea .LC22@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $7,%eax
+	call v4__dpush@PLT
+.stabn 68,0,24,.LM681-v4_environment_Question
+.LM681:
+	call v4_z2over@PLT
+	call v4_comparei@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L90
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L91
+.L90:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L91:
+.stabn 68,0,49,.LM693-v4_environment_Question
+.LM693:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L27
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L27:
+.stabn 68,0,50,.LM702-v4_environment_Question
+.LM702:
+	lea .LC23@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $8,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L28
+	mov $255,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L28:
+.stabn 68,0,51,.LM716-v4_environment_Question
+.LM716:
+	lea .LC24@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $5,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L29
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	xchg %edx,%ecx
+	shr %cl,%eax
+	xchg %edx,%ecx
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L29:
+.stabn 68,0,53,.LM739-v4_environment_Question
+.LM739:
+	lea .LC25@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $9,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L30
+	mov $2139095022,%eax
+	call v4__fpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L30:
+.stabn 68,0,54,.LM753-v4_environment_Question
+.LM753:
+	lea .LC26@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $5,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L31
+	mov $2147483647,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L31:
+.stabn 68,0,55,.LM771-v4_environment_Question
+.LM771:
+	lea .LC27@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $5,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L32
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L32:
+.stabn 68,0,56,.LM786-v4_environment_Question
+.LM786:
+	lea .LC28@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $6,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L33
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L33:
+.stabn 68,0,57,.LM802-v4_environment_Question
+.LM802:
+	lea .LC29@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $12,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L34
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L34:
+.stabn 68,0,58,.LM817-v4_environment_Question
+.LM817:
+	lea .LC30@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $16,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L35
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L35:
+.stabn 68,0,59,.LM832-v4_environment_Question
+.LM832:
+	lea .LC31@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $18,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L36
+	mov $2032,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L36:
+.stabn 68,0,60,.LM849-v4_environment_Question
+.LM849:
+	lea .LC32@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $12,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L37
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L37:
+.stabn 68,0,61,.LM864-v4_environment_Question
+.LM864:
+	lea .LC33@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $16,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L38
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L38:
+.stabn 68,0,62,.LM879-v4_environment_Question
+.LM879:
+	lea .LC34@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $11,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L39
+	mov $4080,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L39:
+.stabn 68,0,63,.LM896-v4_environment_Question
+.LM896:
+	lea .LC35@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $6,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L40
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L40:
+.stabn 68,0,64,.LM911-v4_environment_Question
+.LM911:
+	lea .LC36@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $10,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L41
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L41:
+.stabn 68,0,65,.LM926-v4_environment_Question
+.LM926:
+	lea .LC37@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $5,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L42
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L42:
+.stabn 68,0,66,.LM941-v4_environment_Question
+.LM941:
+	lea .LC38@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $9,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L43
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L43:
+.stabn 68,0,67,.LM956-v4_environment_Question
+.LM956:
+	lea .LC39@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $9,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L44
+	xor %eax,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L44:
+.stabn 68,0,68,.LM970-v4_environment_Question
+.LM970:
+	lea .LC40@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $8,%eax
+	call v4__dpush@PLT
+	call v4___Parenenvironment_Question_Closeparen@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L45
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L4
+.L45:
+.stabn 68,0,69,.LM985-v4_environment_Question
+.LM985:
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L4:
+.LBE7:
+.stabn 68,0,69,.LM990-v4_environment_Question
+.LM990:
+	pop %ebx
+	leave
+	ret
+.Lfe7:
+	.size	 v4_environment_Question,.Lfe7-v4_environment_Question
+.stabn	192,0,0,.LBB7-v4_environment_Question
+.stabn	224,0,0,.LBE7-v4_environment_Question
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_environment_Question
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,1004 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: errno.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+    31 Sym_6 word "v4__e2big"
+    37 Sym_12 word "v4__eacces"
+   122 Sym_97 word "v4__eaddrinuse"
+   123 Sym_98 word "v4__eaddrnotavail"
+    92 Sym_67 word "v4__eadv"
+   121 Sym_96 word "v4__eafnosupport"
+    35 Sym_10 word "v4__eagain"
+   138 Sym_113 word "v4__ealready"
+    76 Sym_51 word "v4__ebade"
+    33 Sym_8 word "v4__ebadf"
+   101 Sym_76 word "v4__ebadfd"
+    98 Sym_73 word "v4__ebadmsg"
+    77 Sym_52 word "v4__ebadr"
+    80 Sym_55 word "v4__ebadrqc"
+    81 Sym_56 word "v4__ebadslt"
+    83 Sym_58 word "v4__ebfont"
+    40 Sym_15 word "v4__ebusy"
+    34 Sym_9 word "v4__echild"
+    68 Sym_43 word "v4__echrng"
+    94 Sym_69 word "v4__ecomm"
+   127 Sym_102 word "v4__econnaborted"
+   135 Sym_110 word "v4__econnrefused"
+   128 Sym_103 word "v4__econnreset"
+    59 Sym_34 word "v4__edeadlk"
+    82 Sym_57 word "v4__edeadlock"
+   113 Sym_88 word "v4__edestaddrreq"
+    57 Sym_32 word "v4__edom"
+    97 Sym_72 word "v4__edotdot"
+   146 Sym_121 word "v4__edquot"
+    41 Sym_16 word "v4__eexist"
+    38 Sym_13 word "v4__efault"
+    51 Sym_26 word "v4__efbig"
+   136 Sym_111 word "v4__ehostdown"
+   137 Sym_112 word "v4__ehostunreach"
+    67 Sym_42 word "v4__eidrm"
+   108 Sym_83 word "v4__eilseq"
+   139 Sym_114 word "v4__einprogress"
+    28 Sym_3 word "v4__eintr"
+    46 Sym_21 word "v4__einval"
+    29 Sym_4 word "v4__eio"
+   130 Sym_105 word "v4__eisconn"
+    45 Sym_20 word "v4__eisdir"
+   144 Sym_119 word "v4__eisnam"
+    75 Sym_50 word "v4__el2hlt"
+    69 Sym_44 word "v4__el2nsync"
+    70 Sym_45 word "v4__el3hlt"
+    71 Sym_46 word "v4__el3rst"
+   103 Sym_78 word "v4__elibacc"
+   104 Sym_79 word "v4__elibbad"
+   107 Sym_82 word "v4__elibexec"
+   106 Sym_81 word "v4__elibmax"
+   105 Sym_80 word "v4__elibscn"
+    72 Sym_47 word "v4__elnrng"
+    64 Sym_39 word "v4__eloop"
+   148 Sym_123 word "v4__emediumtype"
+    48 Sym_23 word "v4__emfile"
+    55 Sym_30 word "v4__emlink"
+   114 Sym_89 word "v4__emsgsize"
+    96 Sym_71 word "v4__emultihop"
+    60 Sym_35 word "v4__enametoolong"
+   143 Sym_118 word "v4__enavail"
+   124 Sym_99 word "v4__enetdown"
+   126 Sym_101 word "v4__enetreset"
+   125 Sym_100 word "v4__enetunreach"
+    47 Sym_22 word "v4__enfile"
+    79 Sym_54 word "v4__enoano"
+   129 Sym_104 word "v4__enobufs"
+    74 Sym_49 word "v4__enocsi"
+    85 Sym_60 word "v4__enodata"
+    43 Sym_18 word "v4__enodev"
+    26 Sym_1 word "v4__enoent"
+    32 Sym_7 word "v4__enoexec"
+    61 Sym_36 word "v4__enolck"
+    91 Sym_66 word "v4__enolink"
+   147 Sym_122 word "v4__enomedium"
+    36 Sym_11 word "v4__enomem"
+    66 Sym_41 word "v4__enomsg"
+    88 Sym_63 word "v4__enonet"
+    89 Sym_64 word "v4__enopkg"
+   116 Sym_91 word "v4__enoprotoopt"
+    52 Sym_27 word "v4__enospc"
+    87 Sym_62 word "v4__enosr"
+    84 Sym_59 word "v4__enostr"
+    62 Sym_37 word "v4__enosys"
+    39 Sym_14 word "v4__enotblk"
+   131 Sym_106 word "v4__enotconn"
+    44 Sym_19 word "v4__enotdir"
+    63 Sym_38 word "v4__enotempty"
+   142 Sym_117 word "v4__enotnam"
+   112 Sym_87 word "v4__enotsock"
+    49 Sym_24 word "v4__enotty"
+   100 Sym_75 word "v4__enotuniq"
+    30 Sym_5 word "v4__enxio"
+   119 Sym_94 word "v4__eopnotsupp"
+    99 Sym_74 word "v4__eoverflow"
+    25 Sym_0 word "v4__eperm"
+   120 Sym_95 word "v4__epfnosupport"
+    56 Sym_31 word "v4__epipe"
+    95 Sym_70 word "v4__eproto"
+   117 Sym_92 word "v4__eprotonosupport"
+   115 Sym_90 word "v4__eprototype"
+    58 Sym_33 word "v4__erange"
+   102 Sym_77 word "v4__eremchg"
+    90 Sym_65 word "v4__eremote"
+   145 Sym_120 word "v4__eremoteio"
+   109 Sym_84 word "v4__erestart"
+    54 Sym_29 word "v4__erofs"
+   132 Sym_107 word "v4__eshutdown"
+   118 Sym_93 word "v4__esocktnosupport"
+    53 Sym_28 word "v4__espipe"
+    27 Sym_2 word "v4__esrch"
+    93 Sym_68 word "v4__esrmnt"
+   140 Sym_115 word "v4__estale"
+   110 Sym_85 word "v4__estrpipe"
+    86 Sym_61 word "v4__etime"
+   134 Sym_109 word "v4__etimedout"
+   133 Sym_108 word "v4__etoomanyrefs"
+    50 Sym_25 word "v4__etxtbsy"
+   141 Sym_116 word "v4__euclean"
+    73 Sym_48 word "v4__eunatch"
+   111 Sym_86 word "v4__eusers"
+    65 Sym_40 word "v4__ewouldblock"
+    42 Sym_17 word "v4__exdev"
+    78 Sym_53 word "v4__exfull"
+
+Intermediate code:
+    25 function Sym_0 {
+    25   Reg_0 = 1
+    25   Stack_D = Reg_0
+    25   no-op
+           optimizes label Label_1
+    25 }
+
+    26 function Sym_1 {
+    26   Reg_0 = 2
+    26   Stack_D = Reg_0
+    26   no-op
+           optimizes label Label_2
+    26 }
+
+    27 function Sym_2 {
+    27   Reg_0 = 3
+    27   Stack_D = Reg_0
+    27   no-op
+           optimizes label Label_3
+    27 }
+
+    28 function Sym_3 {
+    28   Reg_0 = 4
+    28   Stack_D = Reg_0
+    28   no-op
+           optimizes label Label_4
+    28 }
+
+    29 function Sym_4 {
+    29   Reg_0 = 5
+    29   Stack_D = Reg_0
+    29   no-op
+           optimizes label Label_5
+    29 }
+
+    30 function Sym_5 {
+    30   Reg_0 = 6
+    30   Stack_D = Reg_0
+    30   no-op
+           optimizes label Label_6
+    30 }
+
+    31 function Sym_6 {
+    31   Reg_0 = 7
+    31   Stack_D = Reg_0
+    31   no-op
+           optimizes label Label_7
+    31 }
+
+    32 function Sym_7 {
+    32   Reg_0 = 8
+    32   Stack_D = Reg_0
+    32   no-op
+           optimizes label Label_8
+    32 }
+
+    33 function Sym_8 {
+    33   Reg_0 = 9
+    33   Stack_D = Reg_0
+    33   no-op
+           optimizes label Label_9
+    33 }
+
+    34 function Sym_9 {
+    34   Reg_0 = 10
+    34   Stack_D = Reg_0
+    34   no-op
+           optimizes label Label_10
+    34 }
+
+    35 function Sym_10 {
+    35   Reg_0 = 11
+    35   Stack_D = Reg_0
+    35   no-op
+           optimizes label Label_11
+    35 }
+
+    36 function Sym_11 {
+    36   Reg_0 = 12
+    36   Stack_D = Reg_0
+    36   no-op
+           optimizes label Label_12
+    36 }
+
+    37 function Sym_12 {
+    37   Reg_0 = 13
+    37   Stack_D = Reg_0
+    37   no-op
+           optimizes label Label_13
+    37 }
+
+    38 function Sym_13 {
+    38   Reg_0 = 14
+    38   Stack_D = Reg_0
+    38   no-op
+           optimizes label Label_14
+    38 }
+
+    39 function Sym_14 {
+    39   Reg_0 = 15
+    39   Stack_D = Reg_0
+    39   no-op
+           optimizes label Label_15
+    39 }
+
+    40 function Sym_15 {
+    40   Reg_0 = 16
+    40   Stack_D = Reg_0
+    40   no-op
+           optimizes label Label_16
+    40 }
+
+    41 function Sym_16 {
+    41   Reg_0 = 17
+    41   Stack_D = Reg_0
+    41   no-op
+           optimizes label Label_17
+    41 }
+
+    42 function Sym_17 {
+    42   Reg_0 = 18
+    42   Stack_D = Reg_0
+    42   no-op
+           optimizes label Label_18
+    42 }
+
+    43 function Sym_18 {
+    43   Reg_0 = 19
+    43   Stack_D = Reg_0
+    43   no-op
+           optimizes label Label_19
+    43 }
+
+    44 function Sym_19 {
+    44   Reg_0 = 20
+    44   Stack_D = Reg_0
+    44   no-op
+           optimizes label Label_20
+    44 }
+
+    45 function Sym_20 {
+    45   Reg_0 = 21
+    45   Stack_D = Reg_0
+    45   no-op
+           optimizes label Label_21
+    45 }
+
+    46 function Sym_21 {
+    46   Reg_0 = 22
+    46   Stack_D = Reg_0
+    46   no-op
+           optimizes label Label_22
+    46 }
+
+    47 function Sym_22 {
+    47   Reg_0 = 23
+    47   Stack_D = Reg_0
+    47   no-op
+           optimizes label Label_23
+    47 }
+
+    48 function Sym_23 {
+    48   Reg_0 = 24
+    48   Stack_D = Reg_0
+    48   no-op
+           optimizes label Label_24
+    48 }
+
+    49 function Sym_24 {
+    49   Reg_0 = 25
+    49   Stack_D = Reg_0
+    49   no-op
+           optimizes label Label_25
+    49 }
+
+    50 function Sym_25 {
+    50   Reg_0 = 26
+    50   Stack_D = Reg_0
+    50   no-op
+           optimizes label Label_26
+    50 }
+
+    51 function Sym_26 {
+    51   Reg_0 = 27
+    51   Stack_D = Reg_0
+    51   no-op
+           optimizes label Label_27
+    51 }
+
+    52 function Sym_27 {
+    52   Reg_0 = 28
+    52   Stack_D = Reg_0
+    52   no-op
+           optimizes label Label_28
+    52 }
+
+    53 function Sym_28 {
+    53   Reg_0 = 29
+    53   Stack_D = Reg_0
+    53   no-op
+           optimizes label Label_29
+    53 }
+
+    54 function Sym_29 {
+    54   Reg_0 = 30
+    54   Stack_D = Reg_0
+    54   no-op
+           optimizes label Label_30
+    54 }
+
+    55 function Sym_30 {
+    55   Reg_0 = 31
+    55   Stack_D = Reg_0
+    55   no-op
+           optimizes label Label_31
+    55 }
+
+    56 function Sym_31 {
+    56   Reg_0 = 32
+    56   Stack_D = Reg_0
+    56   no-op
+           optimizes label Label_32
+    56 }
+
+    57 function Sym_32 {
+    57   Reg_0 = 33
+    57   Stack_D = Reg_0
+    57   no-op
+           optimizes label Label_33
+    57 }
+
+    58 function Sym_33 {
+    58   Reg_0 = 34
+    58   Stack_D = Reg_0
+    58   no-op
+           optimizes label Label_34
+    58 }
+
+    59 function Sym_34 {
+    59   Reg_0 = 35
+    59   Stack_D = Reg_0
+    59   no-op
+           optimizes label Label_35
+    59 }
+
+    60 function Sym_35 {
+    60   Reg_0 = 36
+    60   Stack_D = Reg_0
+    60   no-op
+           optimizes label Label_36
+    60 }
+
+    61 function Sym_36 {
+    61   Reg_0 = 37
+    61   Stack_D = Reg_0
+    61   no-op
+           optimizes label Label_37
+    61 }
+
+    62 function Sym_37 {
+    62   Reg_0 = 38
+    62   Stack_D = Reg_0
+    62   no-op
+           optimizes label Label_38
+    62 }
+
+    63 function Sym_38 {
+    63   Reg_0 = 39
+    63   Stack_D = Reg_0
+    63   no-op
+           optimizes label Label_39
+    63 }
+
+    64 function Sym_39 {
+    64   Reg_0 = 40
+    64   Stack_D = Reg_0
+    64   no-op
+           optimizes label Label_40
+    64 }
+
+    65 function Sym_40 {
+    65   no-op
+           optimizes   call Sym_10
+    35   Reg_0 = 11
+    35   Stack_D = Reg_0
+    65   no-op
+           optimizes label Label_41
+    65 }
+
+    66 function Sym_41 {
+    66   Reg_0 = 42
+    66   Stack_D = Reg_0
+    66   no-op
+           optimizes label Label_42
+    66 }
+
+    67 function Sym_42 {
+    67   Reg_0 = 43
+    67   Stack_D = Reg_0
+    67   no-op
+           optimizes label Label_43
+    67 }
+
+    68 function Sym_43 {
+    68   Reg_0 = 44
+    68   Stack_D = Reg_0
+    68   no-op
+           optimizes label Label_44
+    68 }
+
+    69 function Sym_44 {
+    69   Reg_0 = 45
+    69   Stack_D = Reg_0
+    69   no-op
+           optimizes label Label_45
+    69 }
+
+    70 function Sym_45 {
+    70   Reg_0 = 46
+    70   Stack_D = Reg_0
+    70   no-op
+           optimizes label Label_46
+    70 }
+
+    71 function Sym_46 {
+    71   Reg_0 = 47
+    71   Stack_D = Reg_0
+    71   no-op
+           optimizes label Label_47
+    71 }
+
+    72 function Sym_47 {
+    72   Reg_0 = 48
+    72   Stack_D = Reg_0
+    72   no-op
+           optimizes label Label_48
+    72 }
+
+    73 function Sym_48 {
+    73   Reg_0 = 49
+    73   Stack_D = Reg_0
+    73   no-op
+           optimizes label Label_49
+    73 }
+
+    74 function Sym_49 {
+    74   Reg_0 = 50
+    74   Stack_D = Reg_0
+    74   no-op
+           optimizes label Label_50
+    74 }
+
+    75 function Sym_50 {
+    75   Reg_0 = 51
+    75   Stack_D = Reg_0
+    75   no-op
+           optimizes label Label_51
+    75 }
+
+    76 function Sym_51 {
+    76   Reg_0 = 52
+    76   Stack_D = Reg_0
+    76   no-op
+           optimizes label Label_52
+    76 }
+
+    77 function Sym_52 {
+    77   Reg_0 = 53
+    77   Stack_D = Reg_0
+    77   no-op
+           optimizes label Label_53
+    77 }
+
+    78 function Sym_53 {
+    78   Reg_0 = 54
+    78   Stack_D = Reg_0
+    78   no-op
+           optimizes label Label_54
+    78 }
+
+    79 function Sym_54 {
+    79   Reg_0 = 55
+    79   Stack_D = Reg_0
+    79   no-op
+           optimizes label Label_55
+    79 }
+
+    80 function Sym_55 {
+    80   Reg_0 = 56
+    80   Stack_D = Reg_0
+    80   no-op
+           optimizes label Label_56
+    80 }
+
+    81 function Sym_56 {
+    81   Reg_0 = 57
+    81   Stack_D = Reg_0
+    81   no-op
+           optimizes label Label_57
+    81 }
+
+    82 function Sym_57 {
+    82   no-op
+           optimizes   call Sym_34
+    59   Reg_0 = 35
+    59   Stack_D = Reg_0
+    82   no-op
+           optimizes label Label_58
+    82 }
+
+    83 function Sym_58 {
+    83   Reg_0 = 59
+    83   Stack_D = Reg_0
+    83   no-op
+           optimizes label Label_59
+    83 }
+
+    84 function Sym_59 {
+    84   Reg_0 = 60
+    84   Stack_D = Reg_0
+    84   no-op
+           optimizes label Label_60
+    84 }
+
+    85 function Sym_60 {
+    85   Reg_0 = 61
+    85   Stack_D = Reg_0
+    85   no-op
+           optimizes label Label_61
+    85 }
+
+    86 function Sym_61 {
+    86   Reg_0 = 62
+    86   Stack_D = Reg_0
+    86   no-op
+           optimizes label Label_62
+    86 }
+
+    87 function Sym_62 {
+    87   Reg_0 = 63
+    87   Stack_D = Reg_0
+    87   no-op
+           optimizes label Label_63
+    87 }
+
+    88 function Sym_63 {
+    88   Reg_0 = 64
+    88   Stack_D = Reg_0
+    88   no-op
+           optimizes label Label_64
+    88 }
+
+    89 function Sym_64 {
+    89   Reg_0 = 65
+    89   Stack_D = Reg_0
+    89   no-op
+           optimizes label Label_65
+    89 }
+
+    90 function Sym_65 {
+    90   Reg_0 = 66
+    90   Stack_D = Reg_0
+    90   no-op
+           optimizes label Label_66
+    90 }
+
+    91 function Sym_66 {
+    91   Reg_0 = 67
+    91   Stack_D = Reg_0
+    91   no-op
+           optimizes label Label_67
+    91 }
+
+    92 function Sym_67 {
+    92   Reg_0 = 68
+    92   Stack_D = Reg_0
+    92   no-op
+           optimizes label Label_68
+    92 }
+
+    93 function Sym_68 {
+    93   Reg_0 = 69
+    93   Stack_D = Reg_0
+    93   no-op
+           optimizes label Label_69
+    93 }
+
+    94 function Sym_69 {
+    94   Reg_0 = 70
+    94   Stack_D = Reg_0
+    94   no-op
+           optimizes label Label_70
+    94 }
+
+    95 function Sym_70 {
+    95   Reg_0 = 71
+    95   Stack_D = Reg_0
+    95   no-op
+           optimizes label Label_71
+    95 }
+
+    96 function Sym_71 {
+    96   Reg_0 = 72
+    96   Stack_D = Reg_0
+    96   no-op
+           optimizes label Label_72
+    96 }
+
+    97 function Sym_72 {
+    97   Reg_0 = 73
+    97   Stack_D = Reg_0
+    97   no-op
+           optimizes label Label_73
+    97 }
+
+    98 function Sym_73 {
+    98   Reg_0 = 74
+    98   Stack_D = Reg_0
+    98   no-op
+           optimizes label Label_74
+    98 }
+
+    99 function Sym_74 {
+    99   Reg_0 = 75
+    99   Stack_D = Reg_0
+    99   no-op
+           optimizes label Label_75
+    99 }
+
+   100 function Sym_75 {
+   100   Reg_0 = 76
+   100   Stack_D = Reg_0
+   100   no-op
+           optimizes label Label_76
+   100 }
+
+   101 function Sym_76 {
+   101   Reg_0 = 77
+   101   Stack_D = Reg_0
+   101   no-op
+           optimizes label Label_77
+   101 }
+
+   102 function Sym_77 {
+   102   Reg_0 = 78
+   102   Stack_D = Reg_0
+   102   no-op
+           optimizes label Label_78
+   102 }
+
+   103 function Sym_78 {
+   103   Reg_0 = 79
+   103   Stack_D = Reg_0
+   103   no-op
+           optimizes label Label_79
+   103 }
+
+   104 function Sym_79 {
+   104   Reg_0 = 80
+   104   Stack_D = Reg_0
+   104   no-op
+           optimizes label Label_80
+   104 }
+
+   105 function Sym_80 {
+   105   Reg_0 = 81
+   105   Stack_D = Reg_0
+   105   no-op
+           optimizes label Label_81
+   105 }
+
+   106 function Sym_81 {
+   106   Reg_0 = 82
+   106   Stack_D = Reg_0
+   106   no-op
+           optimizes label Label_82
+   106 }
+
+   107 function Sym_82 {
+   107   Reg_0 = 83
+   107   Stack_D = Reg_0
+   107   no-op
+           optimizes label Label_83
+   107 }
+
+   108 function Sym_83 {
+   108   Reg_0 = 84
+   108   Stack_D = Reg_0
+   108   no-op
+           optimizes label Label_84
+   108 }
+
+   109 function Sym_84 {
+   109   Reg_0 = 85
+   109   Stack_D = Reg_0
+   109   no-op
+           optimizes label Label_85
+   109 }
+
+   110 function Sym_85 {
+   110   Reg_0 = 86
+   110   Stack_D = Reg_0
+   110   no-op
+           optimizes label Label_86
+   110 }
+
+   111 function Sym_86 {
+   111   Reg_0 = 87
+   111   Stack_D = Reg_0
+   111   no-op
+           optimizes label Label_87
+   111 }
+
+   112 function Sym_87 {
+   112   Reg_0 = 88
+   112   Stack_D = Reg_0
+   112   no-op
+           optimizes label Label_88
+   112 }
+
+   113 function Sym_88 {
+   113   Reg_0 = 89
+   113   Stack_D = Reg_0
+   113   no-op
+           optimizes label Label_89
+   113 }
+
+   114 function Sym_89 {
+   114   Reg_0 = 90
+   114   Stack_D = Reg_0
+   114   no-op
+           optimizes label Label_90
+   114 }
+
+   115 function Sym_90 {
+   115   Reg_0 = 91
+   115   Stack_D = Reg_0
+   115   no-op
+           optimizes label Label_91
+   115 }
+
+   116 function Sym_91 {
+   116   Reg_0 = 92
+   116   Stack_D = Reg_0
+   116   no-op
+           optimizes label Label_92
+   116 }
+
+   117 function Sym_92 {
+   117   Reg_0 = 93
+   117   Stack_D = Reg_0
+   117   no-op
+           optimizes label Label_93
+   117 }
+
+   118 function Sym_93 {
+   118   Reg_0 = 94
+   118   Stack_D = Reg_0
+   118   no-op
+           optimizes label Label_94
+   118 }
+
+   119 function Sym_94 {
+   119   Reg_0 = 95
+   119   Stack_D = Reg_0
+   119   no-op
+           optimizes label Label_95
+   119 }
+
+   120 function Sym_95 {
+   120   Reg_0 = 96
+   120   Stack_D = Reg_0
+   120   no-op
+           optimizes label Label_96
+   120 }
+
+   121 function Sym_96 {
+   121   Reg_0 = 97
+   121   Stack_D = Reg_0
+   121   no-op
+           optimizes label Label_97
+   121 }
+
+   122 function Sym_97 {
+   122   Reg_0 = 98
+   122   Stack_D = Reg_0
+   122   no-op
+           optimizes label Label_98
+   122 }
+
+   123 function Sym_98 {
+   123   Reg_0 = 99
+   123   Stack_D = Reg_0
+   123   no-op
+           optimizes label Label_99
+   123 }
+
+   124 function Sym_99 {
+   124   Reg_0 = 100
+   124   Stack_D = Reg_0
+   124   no-op
+           optimizes label Label_100
+   124 }
+
+   125 function Sym_100 {
+   125   Reg_0 = 101
+   125   Stack_D = Reg_0
+   125   no-op
+           optimizes label Label_101
+   125 }
+
+   126 function Sym_101 {
+   126   Reg_0 = 102
+   126   Stack_D = Reg_0
+   126   no-op
+           optimizes label Label_102
+   126 }
+
+   127 function Sym_102 {
+   127   Reg_0 = 103
+   127   Stack_D = Reg_0
+   127   no-op
+           optimizes label Label_103
+   127 }
+
+   128 function Sym_103 {
+   128   Reg_0 = 104
+   128   Stack_D = Reg_0
+   128   no-op
+           optimizes label Label_104
+   128 }
+
+   129 function Sym_104 {
+   129   Reg_0 = 105
+   129   Stack_D = Reg_0
+   129   no-op
+           optimizes label Label_105
+   129 }
+
+   130 function Sym_105 {
+   130   Reg_0 = 106
+   130   Stack_D = Reg_0
+   130   no-op
+           optimizes label Label_106
+   130 }
+
+   131 function Sym_106 {
+   131   Reg_0 = 107
+   131   Stack_D = Reg_0
+   131   no-op
+           optimizes label Label_107
+   131 }
+
+   132 function Sym_107 {
+   132   Reg_0 = 108
+   132   Stack_D = Reg_0
+   132   no-op
+           optimizes label Label_108
+   132 }
+
+   133 function Sym_108 {
+   133   Reg_0 = 109
+   133   Stack_D = Reg_0
+   133   no-op
+           optimizes label Label_109
+   133 }
+
+   134 function Sym_109 {
+   134   Reg_0 = 110
+   134   Stack_D = Reg_0
+   134   no-op
+           optimizes label Label_110
+   134 }
+
+   135 function Sym_110 {
+   135   Reg_0 = 111
+   135   Stack_D = Reg_0
+   135   no-op
+           optimizes label Label_111
+   135 }
+
+   136 function Sym_111 {
+   136   Reg_0 = 112
+   136   Stack_D = Reg_0
+   136   no-op
+           optimizes label Label_112
+   136 }
+
+   137 function Sym_112 {
+   137   Reg_0 = 113
+   137   Stack_D = Reg_0
+   137   no-op
+           optimizes label Label_113
+   137 }
+
+   138 function Sym_113 {
+   138   Reg_0 = 114
+   138   Stack_D = Reg_0
+   138   no-op
+           optimizes label Label_114
+   138 }
+
+   139 function Sym_114 {
+   139   Reg_0 = 115
+   139   Stack_D = Reg_0
+   139   no-op
+           optimizes label Label_115
+   139 }
+
+   140 function Sym_115 {
+   140   Reg_0 = 116
+   140   Stack_D = Reg_0
+   140   no-op
+           optimizes label Label_116
+   140 }
+
+   141 function Sym_116 {
+   141   Reg_0 = 117
+   141   Stack_D = Reg_0
+   141   no-op
+           optimizes label Label_117
+   141 }
+
+   142 function Sym_117 {
+   142   Reg_0 = 118
+   142   Stack_D = Reg_0
+   142   no-op
+           optimizes label Label_118
+   142 }
+
+   143 function Sym_118 {
+   143   Reg_0 = 119
+   143   Stack_D = Reg_0
+   143   no-op
+           optimizes label Label_119
+   143 }
+
+   144 function Sym_119 {
+   144   Reg_0 = 120
+   144   Stack_D = Reg_0
+   144   no-op
+           optimizes label Label_120
+   144 }
+
+   145 function Sym_120 {
+   145   Reg_0 = 121
+   145   Stack_D = Reg_0
+   145   no-op
+           optimizes label Label_121
+   145 }
+
+   146 function Sym_121 {
+   146   Reg_0 = 122
+   146   Stack_D = Reg_0
+   146   no-op
+           optimizes label Label_122
+   146 }
+
+   147 function Sym_122 {
+   147   Reg_0 = 123
+   147   Stack_D = Reg_0
+   147   no-op
+           optimizes label Label_123
+   147 }
+
+   148 function Sym_123 {
+   148   Reg_0 = 124
+   148   Stack_D = Reg_0
+   148   no-op
+           optimizes label Label_124
+   148 }
+
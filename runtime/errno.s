@@ -0,0 +1,3741 @@
+	.file	"errno.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"errno.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4__eperm:F1",36,0,0,v4__eperm
+	.weak v4__eperm
+	.type	v4__eperm,@function
+v4__eperm:
+.stabn 68,0,25,.LMa0-v4__eperm
+.LMa0:
+	push %ebx
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,25,.LMb0-v4__eperm
+.LMb0:
+.LBB0:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+.LBE0:
+.stabn 68,0,25,.LM4-v4__eperm
+.LM4:
+	pop %ebx
+	ret
+.Lfe0:
+	.size	 v4__eperm,.Lfe0-v4__eperm
+.stabn	192,0,0,.LBB0-v4__eperm
+.stabn	224,0,0,.LBE0-v4__eperm
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4__eperm
+.text
+	.align 4
+.stabs "v4__enoent:F1",36,0,0,v4__enoent
+	.weak v4__enoent
+	.type	v4__enoent,@function
+v4__enoent:
+.stabn 68,0,26,.LMa5-v4__enoent
+.LMa5:
+	push %ebx
+	call .Lpic1
+.Lpic1:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic1],%ebx
+0:
+.stabn 68,0,26,.LMb5-v4__enoent
+.LMb5:
+.LBB1:
+	mov $2,%eax
+	call v4__dpush@PLT
+.LBE1:
+.stabn 68,0,26,.LM9-v4__enoent
+.LM9:
+	pop %ebx
+	ret
+.Lfe1:
+	.size	 v4__enoent,.Lfe1-v4__enoent
+.stabn	192,0,0,.LBB1-v4__enoent
+.stabn	224,0,0,.LBE1-v4__enoent
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4__enoent
+.text
+	.align 4
+.stabs "v4__esrch:F1",36,0,0,v4__esrch
+	.weak v4__esrch
+	.type	v4__esrch,@function
+v4__esrch:
+.stabn 68,0,27,.LMa10-v4__esrch
+.LMa10:
+	push %ebx
+	call .Lpic2
+.Lpic2:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic2],%ebx
+0:
+.stabn 68,0,27,.LMb10-v4__esrch
+.LMb10:
+.LBB2:
+	mov $3,%eax
+	call v4__dpush@PLT
+.LBE2:
+.stabn 68,0,27,.LM14-v4__esrch
+.LM14:
+	pop %ebx
+	ret
+.Lfe2:
+	.size	 v4__esrch,.Lfe2-v4__esrch
+.stabn	192,0,0,.LBB2-v4__esrch
+.stabn	224,0,0,.LBE2-v4__esrch
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4__esrch
+.text
+	.align 4
+.stabs "v4__eintr:F1",36,0,0,v4__eintr
+	.weak v4__eintr
+	.type	v4__eintr,@function
+v4__eintr:
+.stabn 68,0,28,.LMa15-v4__eintr
+.LMa15:
+	push %ebx
+	call .Lpic3
+.Lpic3:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic3],%ebx
+0:
+.stabn 68,0,28,.LMb15-v4__eintr
+.LMb15:
+.LBB3:
+	mov $4,%eax
+	call v4__dpush@PLT
+.LBE3:
+.stabn 68,0,28,.LM19-v4__eintr
+.LM19:
+	pop %ebx
+	ret
+.Lfe3:
+	.size	 v4__eintr,.Lfe3-v4__eintr
+.stabn	192,0,0,.LBB3-v4__eintr
+.stabn	224,0,0,.LBE3-v4__eintr
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4__eintr
+.text
+	.align 4
+.stabs "v4__eio:F1",36,0,0,v4__eio
+	.weak v4__eio
+	.type	v4__eio,@function
+v4__eio:
+.stabn 68,0,29,.LMa20-v4__eio
+.LMa20:
+	push %ebx
+	call .Lpic4
+.Lpic4:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic4],%ebx
+0:
+.stabn 68,0,29,.LMb20-v4__eio
+.LMb20:
+.LBB4:
+	mov $5,%eax
+	call v4__dpush@PLT
+.LBE4:
+.stabn 68,0,29,.LM24-v4__eio
+.LM24:
+	pop %ebx
+	ret
+.Lfe4:
+	.size	 v4__eio,.Lfe4-v4__eio
+.stabn	192,0,0,.LBB4-v4__eio
+.stabn	224,0,0,.LBE4-v4__eio
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4__eio
+.text
+	.align 4
+.stabs "v4__enxio:F1",36,0,0,v4__enxio
+	.weak v4__enxio
+	.type	v4__enxio,@function
+v4__enxio:
+.stabn 68,0,30,.LMa25-v4__enxio
+.LMa25:
+	push %ebx
+	call .Lpic5
+.Lpic5:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic5],%ebx
+0:
+.stabn 68,0,30,.LMb25-v4__enxio
+.LMb25:
+.LBB5:
+	mov $6,%eax
+	call v4__dpush@PLT
+.LBE5:
+.stabn 68,0,30,.LM29-v4__enxio
+.LM29:
+	pop %ebx
+	ret
+.Lfe5:
+	.size	 v4__enxio,.Lfe5-v4__enxio
+.stabn	192,0,0,.LBB5-v4__enxio
+.stabn	224,0,0,.LBE5-v4__enxio
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4__enxio
+.text
+	.align 4
+.stabs "v4__e2big:F1",36,0,0,v4__e2big
+	.weak v4__e2big
+	.type	v4__e2big,@function
+v4__e2big:
+.stabn 68,0,31,.LMa30-v4__e2big
+.LMa30:
+	push %ebx
+	call .Lpic6
+.Lpic6:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic6],%ebx
+0:
+.stabn 68,0,31,.LMb30-v4__e2big
+.LMb30:
+.LBB6:
+	mov $7,%eax
+	call v4__dpush@PLT
+.LBE6:
+.stabn 68,0,31,.LM34-v4__e2big
+.LM34:
+	pop %ebx
+	ret
+.Lfe6:
+	.size	 v4__e2big,.Lfe6-v4__e2big
+.stabn	192,0,0,.LBB6-v4__e2big
+.stabn	224,0,0,.LBE6-v4__e2big
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4__e2big
+.text
+	.align 4
+.stabs "v4__enoexec:F1",36,0,0,v4__enoexec
+	.weak v4__enoexec
+	.type	v4__enoexec,@function
+v4__enoexec:
+.stabn 68,0,32,.LMa35-v4__enoexec
+.LMa35:
+	push %ebx
+	call .Lpic7
+.Lpic7:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic7],%ebx
+0:
+.stabn 68,0,32,.LMb35-v4__enoexec
+.LMb35:
+.LBB7:
+	mov $8,%eax
+	call v4__dpush@PLT
+.LBE7:
+.stabn 68,0,32,.LM39-v4__enoexec
+.LM39:
+	pop %ebx
+	ret
+.Lfe7:
+	.size	 v4__enoexec,.Lfe7-v4__enoexec
+.stabn	192,0,0,.LBB7-v4__enoexec
+.stabn	224,0,0,.LBE7-v4__enoexec
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4__enoexec
+.text
+	.align 4
+.stabs "v4__ebadf:F1",36,0,0,v4__ebadf
+	.weak v4__ebadf
+	.type	v4__ebadf,@function
+v4__ebadf:
+.stabn 68,0,33,.LMa40-v4__ebadf
+.LMa40:
+	push %ebx
+	call .Lpic8
+.Lpic8:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic8],%ebx
+0:
+.stabn 68,0,33,.LMb40-v4__ebadf
+.LMb40:
+.LBB8:
+	mov $9,%eax
+	call v4__dpush@PLT
+.LBE8:
+.stabn 68,0,33,.LM44-v4__ebadf
+.LM44:
+	pop %ebx
+	ret
+.Lfe8:
+	.size	 v4__ebadf,.Lfe8-v4__ebadf
+.stabn	192,0,0,.LBB8-v4__ebadf
+.stabn	224,0,0,.LBE8-v4__ebadf
+.Lscope8:
+.stabs	"",36,0,0,.Lscope8-v4__ebadf
+.text
+	.align 4
+.stabs "v4__echild:F1",36,0,0,v4__echild
+	.weak v4__echild
+	.type	v4__echild,@function
+v4__echild:
+.stabn 68,0,34,.LMa45-v4__echild
+.LMa45:
+	push %ebx
+	call .Lpic9
+.Lpic9:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic9],%ebx
+0:
+.stabn 68,0,34,.LMb45-v4__echild
+.LMb45:
+.LBB9:
+	mov $10,%eax
+	call v4__dpush@PLT
+.LBE9:
+.stabn 68,0,34,.LM49-v4__echild
+.LM49:
+	pop %ebx
+	ret
+.Lfe9:
+	.size	 v4__echild,.Lfe9-v4__echild
+.stabn	192,0,0,.LBB9-v4__echild
+.stabn	224,0,0,.LBE9-v4__echild
+.Lscope9:
+.stabs	"",36,0,0,.Lscope9-v4__echild
+.text
+	.align 4
+.stabs "v4__eagain:F1",36,0,0,v4__eagain
+	.weak v4__eagain
+	.type	v4__eagain,@function
+v4__eagain:
+.stabn 68,0,35,.LMa50-v4__eagain
+.LMa50:
+	push %ebx
+	call .Lpic10
+.Lpic10:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic10],%ebx
+0:
+.stabn 68,0,35,.LMb50-v4__eagain
+.LMb50:
+.LBB10:
+	mov $11,%eax
+	call v4__dpush@PLT
+.LBE10:
+.stabn 68,0,35,.LM54-v4__eagain
+.LM54:
+	pop %ebx
+	ret
+.Lfe10:
+	.size	 v4__eagain,.Lfe10-v4__eagain
+.stabn	192,0,0,.LBB10-v4__eagain
+.stabn	224,0,0,.LBE10-v4__eagain
+.Lscope10:
+.stabs	"",36,0,0,.Lscope10-v4__eagain
+.text
+	.align 4
+.stabs "v4__enomem:F1",36,0,0,v4__enomem
+	.weak v4__enomem
+	.type	v4__enomem,@function
+v4__enomem:
+.stabn 68,0,36,.LMa55-v4__enomem
+.LMa55:
+	push %ebx
+	call .Lpic11
+.Lpic11:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic11],%ebx
+0:
+.stabn 68,0,36,.LMb55-v4__enomem
+.LMb55:
+.LBB11:
+	mov $12,%eax
+	call v4__dpush@PLT
+.LBE11:
+.stabn 68,0,36,.LM59-v4__enomem
+.LM59:
+	pop %ebx
+	ret
+.Lfe11:
+	.size	 v4__enomem,.Lfe11-v4__enomem
+.stabn	192,0,0,.LBB11-v4__enomem
+.stabn	224,0,0,.LBE11-v4__enomem
+.Lscope11:
+.stabs	"",36,0,0,.Lscope11-v4__enomem
+.text
+	.align 4
+.stabs "v4__eacces:F1",36,0,0,v4__eacces
+	.weak v4__eacces
+	.type	v4__eacces,@function
+v4__eacces:
+.stabn 68,0,37,.LMa60-v4__eacces
+.LMa60:
+	push %ebx
+	call .Lpic12
+.Lpic12:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic12],%ebx
+0:
+.stabn 68,0,37,.LMb60-v4__eacces
+.LMb60:
+.LBB12:
+	mov $13,%eax
+	call v4__dpush@PLT
+.LBE12:
+.stabn 68,0,37,.LM64-v4__eacces
+.LM64:
+	pop %ebx
+	ret
+.Lfe12:
+	.size	 v4__eacces,.Lfe12-v4__eacces
+.stabn	192,0,0,.LBB12-v4__eacces
+.stabn	224,0,0,.LBE12-v4__eacces
+.Lscope12:
+.stabs	"",36,0,0,.Lscope12-v4__eacces
+.text
+	.align 4
+.stabs "v4__efault:F1",36,0,0,v4__efault
+	.weak v4__efault
+	.type	v4__efault,@function
+v4__efault:
+.stabn 68,0,38,.LMa65-v4__efault
+.LMa65:
+	push %ebx
+	call .Lpic13
+.Lpic13:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic13],%ebx
+0:
+.stabn 68,0,38,.LMb65-v4__efault
+.LMb65:
+.LBB13:
+	mov $14,%eax
+	call v4__dpush@PLT
+.LBE13:
+.stabn 68,0,38,.LM69-v4__efault
+.LM69:
+	pop %ebx
+	ret
+.Lfe13:
+	.size	 v4__efault,.Lfe13-v4__efault
+.stabn	192,0,0,.LBB13-v4__efault
+.stabn	224,0,0,.LBE13-v4__efault
+.Lscope13:
+.stabs	"",36,0,0,.Lscope13-v4__efault
+.text
+	.align 4
+.stabs "v4__enotblk:F1",36,0,0,v4__enotblk
+	.weak v4__enotblk
+	.type	v4__enotblk,@function
+v4__enotblk:
+.stabn 68,0,39,.LMa70-v4__enotblk
+.LMa70:
+	push %ebx
+	call .Lpic14
+.Lpic14:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic14],%ebx
+0:
+.stabn 68,0,39,.LMb70-v4__enotblk
+.LMb70:
+.LBB14:
+	mov $15,%eax
+	call v4__dpush@PLT
+.LBE14:
+.stabn 68,0,39,.LM74-v4__enotblk
+.LM74:
+	pop %ebx
+	ret
+.Lfe14:
+	.size	 v4__enotblk,.Lfe14-v4__enotblk
+.stabn	192,0,0,.LBB14-v4__enotblk
+.stabn	224,0,0,.LBE14-v4__enotblk
+.Lscope14:
+.stabs	"",36,0,0,.Lscope14-v4__enotblk
+.text
+	.align 4
+.stabs "v4__ebusy:F1",36,0,0,v4__ebusy
+	.weak v4__ebusy
+	.type	v4__ebusy,@function
+v4__ebusy:
+.stabn 68,0,40,.LMa75-v4__ebusy
+.LMa75:
+	push %ebx
+	call .Lpic15
+.Lpic15:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic15],%ebx
+0:
+.stabn 68,0,40,.LMb75-v4__ebusy
+.LMb75:
+.LBB15:
+	mov $16,%eax
+	call v4__dpush@PLT
+.LBE15:
+.stabn 68,0,40,.LM79-v4__ebusy
+.LM79:
+	pop %ebx
+	ret
+.Lfe15:
+	.size	 v4__ebusy,.Lfe15-v4__ebusy
+.stabn	192,0,0,.LBB15-v4__ebusy
+.stabn	224,0,0,.LBE15-v4__ebusy
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4__ebusy
+.text
+	.align 4
+.stabs "v4__eexist:F1",36,0,0,v4__eexist
+	.weak v4__eexist
+	.type	v4__eexist,@function
+v4__eexist:
+.stabn 68,0,41,.LMa80-v4__eexist
+.LMa80:
+	push %ebx
+	call .Lpic16
+.Lpic16:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic16],%ebx
+0:
+.stabn 68,0,41,.LMb80-v4__eexist
+.LMb80:
+.LBB16:
+	mov $17,%eax
+	call v4__dpush@PLT
+.LBE16:
+.stabn 68,0,41,.LM84-v4__eexist
+.LM84:
+	pop %ebx
+	ret
+.Lfe16:
+	.size	 v4__eexist,.Lfe16-v4__eexist
+.stabn	192,0,0,.LBB16-v4__eexist
+.stabn	224,0,0,.LBE16-v4__eexist
+.Lscope16:
+.stabs	"",36,0,0,.Lscope16-v4__eexist
+.text
+	.align 4
+.stabs "v4__exdev:F1",36,0,0,v4__exdev
+	.weak v4__exdev
+	.type	v4__exdev,@function
+v4__exdev:
+.stabn 68,0,42,.LMa85-v4__exdev
+.LMa85:
+	push %ebx
+	call .Lpic17
+.Lpic17:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic17],%ebx
+0:
+.stabn 68,0,42,.LMb85-v4__exdev
+.LMb85:
+.LBB17:
+	mov $18,%eax
+	call v4__dpush@PLT
+.LBE17:
+.stabn 68,0,42,.LM89-v4__exdev
+.LM89:
+	pop %ebx
+	ret
+.Lfe17:
+	.size	 v4__exdev,.Lfe17-v4__exdev
+.stabn	192,0,0,.LBB17-v4__exdev
+.stabn	224,0,0,.LBE17-v4__exdev
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-v4__exdev
+.text
+	.align 4
+.stabs "v4__enodev:F1",36,0,0,v4__enodev
+	.weak v4__enodev
+	.type	v4__enodev,@function
+v4__enodev:
+.stabn 68,0,43,.LMa90-v4__enodev
+.LMa90:
+	push %ebx
+	call .Lpic18
+.Lpic18:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic18],%ebx
+0:
+.stabn 68,0,43,.LMb90-v4__enodev
+.LMb90:
+.LBB18:
+	mov $19,%eax
+	call v4__dpush@PLT
+.LBE18:
+.stabn 68,0,43,.LM94-v4__enodev
+.LM94:
+	pop %ebx
+	ret
+.Lfe18:
+	.size	 v4__enodev,.Lfe18-v4__enodev
+.stabn	192,0,0,.LBB18-v4__enodev
+.stabn	224,0,0,.LBE18-v4__enodev
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4__enodev
+.text
+	.align 4
+.stabs "v4__enotdir:F1",36,0,0,v4__enotdir
+	.weak v4__enotdir
+	.type	v4__enotdir,@function
+v4__enotdir:
+.stabn 68,0,44,.LMa95-v4__enotdir
+.LMa95:
+	push %ebx
+	call .Lpic19
+.Lpic19:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic19],%ebx
+0:
+.stabn 68,0,44,.LMb95-v4__enotdir
+.LMb95:
+.LBB19:
+	mov $20,%eax
+	call v4__dpush@PLT
+.LBE19:
+.stabn 68,0,44,.LM99-v4__enotdir
+.LM99:
+	pop %ebx
+	ret
+.Lfe19:
+	.size	 v4__enotdir,.Lfe19-v4__enotdir
+.stabn	192,0,0,.LBB19-v4__enotdir
+.stabn	224,0,0,.LBE19-v4__enotdir
+.Lscope19:
+.stabs	"",36,0,0,.Lscope19-v4__enotdir
+.text
+	.align 4
+.stabs "v4__eisdir:F1",36,0,0,v4__eisdir
+	.weak v4__eisdir
+	.type	v4__eisdir,@function
+v4__eisdir:
+.stabn 68,0,45,.LMa100-v4__eisdir
+.LMa100:
+	push %ebx
+	call .Lpic20
+.Lpic20:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic20],%ebx
+0:
+.stabn 68,0,45,.LMb100-v4__eisdir
+.LMb100:
+.LBB20:
+	mov $21,%eax
+	call v4__dpush@PLT
+.LBE20:
+.stabn 68,0,45,.LM104-v4__eisdir
+.LM104:
+	pop %ebx
+	ret
+.Lfe20:
+	.size	 v4__eisdir,.Lfe20-v4__eisdir
+.stabn	192,0,0,.LBB20-v4__eisdir
+.stabn	224,0,0,.LBE20-v4__eisdir
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4__eisdir
+.text
+	.align 4
+.stabs "v4__einval:F1",36,0,0,v4__einval
+	.weak v4__einval
+	.type	v4__einval,@function
+v4__einval:
+.stabn 68,0,46,.LMa105-v4__einval
+.LMa105:
+	push %ebx
+	call .Lpic21
+.Lpic21:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic21],%ebx
+0:
+.stabn 68,0,46,.LMb105-v4__einval
+.LMb105:
+.LBB21:
+	mov $22,%eax
+	call v4__dpush@PLT
+.LBE21:
+.stabn 68,0,46,.LM109-v4__einval
+.LM109:
+	pop %ebx
+	ret
+.Lfe21:
+	.size	 v4__einval,.Lfe21-v4__einval
+.stabn	192,0,0,.LBB21-v4__einval
+.stabn	224,0,0,.LBE21-v4__einval
+.Lscope21:
+.stabs	"",36,0,0,.Lscope21-v4__einval
+.text
+	.align 4
+.stabs "v4__enfile:F1",36,0,0,v4__enfile
+	.weak v4__enfile
+	.type	v4__enfile,@function
+v4__enfile:
+.stabn 68,0,47,.LMa110-v4__enfile
+.LMa110:
+	push %ebx
+	call .Lpic22
+.Lpic22:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic22],%ebx
+0:
+.stabn 68,0,47,.LMb110-v4__enfile
+.LMb110:
+.LBB22:
+	mov $23,%eax
+	call v4__dpush@PLT
+.LBE22:
+.stabn 68,0,47,.LM114-v4__enfile
+.LM114:
+	pop %ebx
+	ret
+.Lfe22:
+	.size	 v4__enfile,.Lfe22-v4__enfile
+.stabn	192,0,0,.LBB22-v4__enfile
+.stabn	224,0,0,.LBE22-v4__enfile
+.Lscope22:
+.stabs	"",36,0,0,.Lscope22-v4__enfile
+.text
+	.align 4
+.stabs "v4__emfile:F1",36,0,0,v4__emfile
+	.weak v4__emfile
+	.type	v4__emfile,@function
+v4__emfile:
+.stabn 68,0,48,.LMa115-v4__emfile
+.LMa115:
+	push %ebx
+	call .Lpic23
+.Lpic23:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic23],%ebx
+0:
+.stabn 68,0,48,.LMb115-v4__emfile
+.LMb115:
+.LBB23:
+	mov $24,%eax
+	call v4__dpush@PLT
+.LBE23:
+.stabn 68,0,48,.LM119-v4__emfile
+.LM119:
+	pop %ebx
+	ret
+.Lfe23:
+	.size	 v4__emfile,.Lfe23-v4__emfile
+.stabn	192,0,0,.LBB23-v4__emfile
+.stabn	224,0,0,.LBE23-v4__emfile
+.Lscope23:
+.stabs	"",36,0,0,.Lscope23-v4__emfile
+.text
+	.align 4
+.stabs "v4__enotty:F1",36,0,0,v4__enotty
+	.weak v4__enotty
+	.type	v4__enotty,@function
+v4__enotty:
+.stabn 68,0,49,.LMa120-v4__enotty
+.LMa120:
+	push %ebx
+	call .Lpic24
+.Lpic24:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic24],%ebx
+0:
+.stabn 68,0,49,.LMb120-v4__enotty
+.LMb120:
+.LBB24:
+	mov $25,%eax
+	call v4__dpush@PLT
+.LBE24:
+.stabn 68,0,49,.LM124-v4__enotty
+.LM124:
+	pop %ebx
+	ret
+.Lfe24:
+	.size	 v4__enotty,.Lfe24-v4__enotty
+.stabn	192,0,0,.LBB24-v4__enotty
+.stabn	224,0,0,.LBE24-v4__enotty
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4__enotty
+.text
+	.align 4
+.stabs "v4__etxtbsy:F1",36,0,0,v4__etxtbsy
+	.weak v4__etxtbsy
+	.type	v4__etxtbsy,@function
+v4__etxtbsy:
+.stabn 68,0,50,.LMa125-v4__etxtbsy
+.LMa125:
+	push %ebx
+	call .Lpic25
+.Lpic25:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic25],%ebx
+0:
+.stabn 68,0,50,.LMb125-v4__etxtbsy
+.LMb125:
+.LBB25:
+	mov $26,%eax
+	call v4__dpush@PLT
+.LBE25:
+.stabn 68,0,50,.LM129-v4__etxtbsy
+.LM129:
+	pop %ebx
+	ret
+.Lfe25:
+	.size	 v4__etxtbsy,.Lfe25-v4__etxtbsy
+.stabn	192,0,0,.LBB25-v4__etxtbsy
+.stabn	224,0,0,.LBE25-v4__etxtbsy
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4__etxtbsy
+.text
+	.align 4
+.stabs "v4__efbig:F1",36,0,0,v4__efbig
+	.weak v4__efbig
+	.type	v4__efbig,@function
+v4__efbig:
+.stabn 68,0,51,.LMa130-v4__efbig
+.LMa130:
+	push %ebx
+	call .Lpic26
+.Lpic26:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic26],%ebx
+0:
+.stabn 68,0,51,.LMb130-v4__efbig
+.LMb130:
+.LBB26:
+	mov $27,%eax
+	call v4__dpush@PLT
+.LBE26:
+.stabn 68,0,51,.LM134-v4__efbig
+.LM134:
+	pop %ebx
+	ret
+.Lfe26:
+	.size	 v4__efbig,.Lfe26-v4__efbig
+.stabn	192,0,0,.LBB26-v4__efbig
+.stabn	224,0,0,.LBE26-v4__efbig
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4__efbig
+.text
+	.align 4
+.stabs "v4__enospc:F1",36,0,0,v4__enospc
+	.weak v4__enospc
+	.type	v4__enospc,@function
+v4__enospc:
+.stabn 68,0,52,.LMa135-v4__enospc
+.LMa135:
+	push %ebx
+	call .Lpic27
+.Lpic27:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic27],%ebx
+0:
+.stabn 68,0,52,.LMb135-v4__enospc
+.LMb135:
+.LBB27:
+	mov $28,%eax
+	call v4__dpush@PLT
+.LBE27:
+.stabn 68,0,52,.LM139-v4__enospc
+.LM139:
+	pop %ebx
+	ret
+.Lfe27:
+	.size	 v4__enospc,.Lfe27-v4__enospc
+.stabn	192,0,0,.LBB27-v4__enospc
+.stabn	224,0,0,.LBE27-v4__enospc
+.Lscope27:
+.stabs	"",36,0,0,.Lscope27-v4__enospc
+.text
+	.align 4
+.stabs "v4__espipe:F1",36,0,0,v4__espipe
+	.weak v4__espipe
+	.type	v4__espipe,@function
+v4__espipe:
+.stabn 68,0,53,.LMa140-v4__espipe
+.LMa140:
+	push %ebx
+	call .Lpic28
+.Lpic28:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic28],%ebx
+0:
+.stabn 68,0,53,.LMb140-v4__espipe
+.LMb140:
+.LBB28:
+	mov $29,%eax
+	call v4__dpush@PLT
+.LBE28:
+.stabn 68,0,53,.LM144-v4__espipe
+.LM144:
+	pop %ebx
+	ret
+.Lfe28:
+	.size	 v4__espipe,.Lfe28-v4__espipe
+.stabn	192,0,0,.LBB28-v4__espipe
+.stabn	224,0,0,.LBE28-v4__espipe
+.Lscope28:
+.stabs	"",36,0,0,.Lscope28-v4__espipe
+.text
+	.align 4
+.stabs "v4__erofs:F1",36,0,0,v4__erofs
+	.weak v4__erofs
+	.type	v4__erofs,@function
+v4__erofs:
+.stabn 68,0,54,.LMa145-v4__erofs
+.LMa145:
+	push %ebx
+	call .Lpic29
+.Lpic29:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic29],%ebx
+0:
+.stabn 68,0,54,.LMb145-v4__erofs
+.LMb145:
+.LBB29:
+	mov $30,%eax
+	call v4__dpush@PLT
+.LBE29:
+.stabn 68,0,54,.LM149-v4__erofs
+.LM149:
+	pop %ebx
+	ret
+.Lfe29:
+	.size	 v4__erofs,.Lfe29-v4__erofs
+.stabn	192,0,0,.LBB29-v4__erofs
+.stabn	224,0,0,.LBE29-v4__erofs
+.Lscope29:
+.stabs	"",36,0,0,.Lscope29-v4__erofs
+.text
+	.align 4
+.stabs "v4__emlink:F1",36,0,0,v4__emlink
+	.weak v4__emlink
+	.type	v4__emlink,@function
+v4__emlink:
+.stabn 68,0,55,.LMa150-v4__emlink
+.LMa150:
+	push %ebx
+	call .Lpic30
+.Lpic30:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic30],%ebx
+0:
+.stabn 68,0,55,.LMb150-v4__emlink
+.LMb150:
+.LBB30:
+	mov $31,%eax
+	call v4__dpush@PLT
+.LBE30:
+.stabn 68,0,55,.LM154-v4__emlink
+.LM154:
+	pop %ebx
+	ret
+.Lfe30:
+	.size	 v4__emlink,.Lfe30-v4__emlink
+.stabn	192,0,0,.LBB30-v4__emlink
+.stabn	224,0,0,.LBE30-v4__emlink
+.Lscope30:
+.stabs	"",36,0,0,.Lscope30-v4__emlink
+.text
+	.align 4
+.stabs "v4__epipe:F1",36,0,0,v4__epipe
+	.weak v4__epipe
+	.type	v4__epipe,@function
+v4__epipe:
+.stabn 68,0,56,.LMa155-v4__epipe
+.LMa155:
+	push %ebx
+	call .Lpic31
+.Lpic31:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic31],%ebx
+0:
+.stabn 68,0,56,.LMb155-v4__epipe
+.LMb155:
+.LBB31:
+	mov $32,%eax
+	call v4__dpush@PLT
+.LBE31:
+.stabn 68,0,56,.LM159-v4__epipe
+.LM159:
+	pop %ebx
+	ret
+.Lfe31:
+	.size	 v4__epipe,.Lfe31-v4__epipe
+.stabn	192,0,0,.LBB31-v4__epipe
+.stabn	224,0,0,.LBE31-v4__epipe
+.Lscope31:
+.stabs	"",36,0,0,.Lscope31-v4__epipe
+.text
+	.align 4
+.stabs "v4__edom:F1",36,0,0,v4__edom
+	.weak v4__edom
+	.type	v4__edom,@function
+v4__edom:
+.stabn 68,0,57,.LMa160-v4__edom
+.LMa160:
+	push %ebx
+	call .Lpic32
+.Lpic32:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic32],%ebx
+0:
+.stabn 68,0,57,.LMb160-v4__edom
+.LMb160:
+.LBB32:
+	mov $33,%eax
+	call v4__dpush@PLT
+.LBE32:
+.stabn 68,0,57,.LM164-v4__edom
+.LM164:
+	pop %ebx
+	ret
+.Lfe32:
+	.size	 v4__edom,.Lfe32-v4__edom
+.stabn	192,0,0,.LBB32-v4__edom
+.stabn	224,0,0,.LBE32-v4__edom
+.Lscope32:
+.stabs	"",36,0,0,.Lscope32-v4__edom
+.text
+	.align 4
+.stabs "v4__erange:F1",36,0,0,v4__erange
+	.weak v4__erange
+	.type	v4__erange,@function
+v4__erange:
+.stabn 68,0,58,.LMa165-v4__erange
+.LMa165:
+	push %ebx
+	call .Lpic33
+.Lpic33:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic33],%ebx
+0:
+.stabn 68,0,58,.LMb165-v4__erange
+.LMb165:
+.LBB33:
+	mov $34,%eax
+	call v4__dpush@PLT
+.LBE33:
+.stabn 68,0,58,.LM169-v4__erange
+.LM169:
+	pop %ebx
+	ret
+.Lfe33:
+	.size	 v4__erange,.Lfe33-v4__erange
+.stabn	192,0,0,.LBB33-v4__erange
+.stabn	224,0,0,.LBE33-v4__erange
+.Lscope33:
+.stabs	"",36,0,0,.Lscope33-v4__erange
+.text
+	.align 4
+.stabs "v4__edeadlk:F1",36,0,0,v4__edeadlk
+	.weak v4__edeadlk
+	.type	v4__edeadlk,@function
+v4__edeadlk:
+.stabn 68,0,59,.LMa170-v4__edeadlk
+.LMa170:
+	push %ebx
+	call .Lpic34
+.Lpic34:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic34],%ebx
+0:
+.stabn 68,0,59,.LMb170-v4__edeadlk
+.LMb170:
+.LBB34:
+	mov $35,%eax
+	call v4__dpush@PLT
+.LBE34:
+.stabn 68,0,59,.LM174-v4__edeadlk
+.LM174:
+	pop %ebx
+	ret
+.Lfe34:
+	.size	 v4__edeadlk,.Lfe34-v4__edeadlk
+.stabn	192,0,0,.LBB34-v4__edeadlk
+.stabn	224,0,0,.LBE34-v4__edeadlk
+.Lscope34:
+.stabs	"",36,0,0,.Lscope34-v4__edeadlk
+.text
+	.align 4
+.stabs "v4__enametoolong:F1",36,0,0,v4__enametoolong
+	.weak v4__enametoolong
+	.type	v4__enametoolong,@function
+v4__enametoolong:
+.stabn 68,0,60,.LMa175-v4__enametoolong
+.LMa175:
+	push %ebx
+	call .Lpic35
+.Lpic35:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic35],%ebx
+0:
+.stabn 68,0,60,.LMb175-v4__enametoolong
+.LMb175:
+.LBB35:
+	mov $36,%eax
+	call v4__dpush@PLT
+.LBE35:
+.stabn 68,0,60,.LM179-v4__enametoolong
+.LM179:
+	pop %ebx
+	ret
+.Lfe35:
+	.size	 v4__enametoolong,.Lfe35-v4__enametoolong
+.stabn	192,0,0,.LBB35-v4__enametoolong
+.stabn	224,0,0,.LBE35-v4__enametoolong
+.Lscope35:
+.stabs	"",36,0,0,.Lscope35-v4__enametoolong
+.text
+	.align 4
+.stabs "v4__enolck:F1",36,0,0,v4__enolck
+	.weak v4__enolck
+	.type	v4__enolck,@function
+v4__enolck:
+.stabn 68,0,61,.LMa180-v4__enolck
+.LMa180:
+	push %ebx
+	call .Lpic36
+.Lpic36:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic36],%ebx
+0:
+.stabn 68,0,61,.LMb180-v4__enolck
+.LMb180:
+.LBB36:
+	mov $37,%eax
+	call v4__dpush@PLT
+.LBE36:
+.stabn 68,0,61,.LM184-v4__enolck
+.LM184:
+	pop %ebx
+	ret
+.Lfe36:
+	.size	 v4__enolck,.Lfe36-v4__enolck
+.stabn	192,0,0,.LBB36-v4__enolck
+.stabn	224,0,0,.LBE36-v4__enolck
+.Lscope36:
+.stabs	"",36,0,0,.Lscope36-v4__enolck
+.text
+	.align 4
+.stabs "v4__enosys:F1",36,0,0,v4__enosys
+	.weak v4__enosys
+	.type	v4__enosys,@function
+v4__enosys:
+.stabn 68,0,62,.LMa185-v4__enosys
+.LMa185:
+	push %ebx
+	call .Lpic37
+.Lpic37:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic37],%ebx
+0:
+.stabn 68,0,62,.LMb185-v4__enosys
+.LMb185:
+.LBB37:
+	mov $38,%eax
+	call v4__dpush@PLT
+.LBE37:
+.stabn 68,0,62,.LM189-v4__enosys
+.LM189:
+	pop %ebx
+	ret
+.Lfe37:
+	.size	 v4__enosys,.Lfe37-v4__enosys
+.stabn	192,0,0,.LBB37-v4__enosys
+.stabn	224,0,0,.LBE37-v4__enosys
+.Lscope37:
+.stabs	"",36,0,0,.Lscope37-v4__enosys
+.text
+	.align 4
+.stabs "v4__enotempty:F1",36,0,0,v4__enotempty
+	.weak v4__enotempty
+	.type	v4__enotempty,@function
+v4__enotempty:
+.stabn 68,0,63,.LMa190-v4__enotempty
+.LMa190:
+	push %ebx
+	call .Lpic38
+.Lpic38:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic38],%ebx
+0:
+.stabn 68,0,63,.LMb190-v4__enotempty
+.LMb190:
+.LBB38:
+	mov $39,%eax
+	call v4__dpush@PLT
+.LBE38:
+.stabn 68,0,63,.LM194-v4__enotempty
+.LM194:
+	pop %ebx
+	ret
+.Lfe38:
+	.size	 v4__enotempty,.Lfe38-v4__enotempty
+.stabn	192,0,0,.LBB38-v4__enotempty
+.stabn	224,0,0,.LBE38-v4__enotempty
+.Lscope38:
+.stabs	"",36,0,0,.Lscope38-v4__enotempty
+.text
+	.align 4
+.stabs "v4__eloop:F1",36,0,0,v4__eloop
+	.weak v4__eloop
+	.type	v4__eloop,@function
+v4__eloop:
+.stabn 68,0,64,.LMa195-v4__eloop
+.LMa195:
+	push %ebx
+	call .Lpic39
+.Lpic39:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic39],%ebx
+0:
+.stabn 68,0,64,.LMb195-v4__eloop
+.LMb195:
+.LBB39:
+	mov $40,%eax
+	call v4__dpush@PLT
+.LBE39:
+.stabn 68,0,64,.LM199-v4__eloop
+.LM199:
+	pop %ebx
+	ret
+.Lfe39:
+	.size	 v4__eloop,.Lfe39-v4__eloop
+.stabn	192,0,0,.LBB39-v4__eloop
+.stabn	224,0,0,.LBE39-v4__eloop
+.Lscope39:
+.stabs	"",36,0,0,.Lscope39-v4__eloop
+.text
+	.align 4
+.stabs "v4__ewouldblock:F1",36,0,0,v4__ewouldblock
+	.weak v4__ewouldblock
+	.type	v4__ewouldblock,@function
+v4__ewouldblock:
+.stabn 68,0,65,.LMa200-v4__ewouldblock
+.LMa200:
+	push %ebx
+	call .Lpic40
+.Lpic40:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic40],%ebx
+0:
+.stabn 68,0,65,.LMb200-v4__ewouldblock
+.LMb200:
+.LBB40:
+.stabn 68,0,35,.LM202-v4__ewouldblock
+.LM202:
+	mov $11,%eax
+	call v4__dpush@PLT
+.LBE40:
+.stabn 68,0,65,.LM205-v4__ewouldblock
+.LM205:
+	pop %ebx
+	ret
+.Lfe40:
+	.size	 v4__ewouldblock,.Lfe40-v4__ewouldblock
+.stabn	192,0,0,.LBB40-v4__ewouldblock
+.stabn	224,0,0,.LBE40-v4__ewouldblock
+.Lscope40:
+.stabs	"",36,0,0,.Lscope40-v4__ewouldblock
+.text
+	.align 4
+.stabs "v4__enomsg:F1",36,0,0,v4__enomsg
+	.weak v4__enomsg
+	.type	v4__enomsg,@function
+v4__enomsg:
+.stabn 68,0,66,.LMa206-v4__enomsg
+.LMa206:
+	push %ebx
+	call .Lpic41
+.Lpic41:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic41],%ebx
+0:
+.stabn 68,0,66,.LMb206-v4__enomsg
+.LMb206:
+.LBB41:
+	mov $42,%eax
+	call v4__dpush@PLT
+.LBE41:
+.stabn 68,0,66,.LM210-v4__enomsg
+.LM210:
+	pop %ebx
+	ret
+.Lfe41:
+	.size	 v4__enomsg,.Lfe41-v4__enomsg
+.stabn	192,0,0,.LBB41-v4__enomsg
+.stabn	224,0,0,.LBE41-v4__enomsg
+.Lscope41:
+.stabs	"",36,0,0,.Lscope41-v4__enomsg
+.text
+	.align 4
+.stabs "v4__eidrm:F1",36,0,0,v4__eidrm
+	.weak v4__eidrm
+	.type	v4__eidrm,@function
+v4__eidrm:
+.stabn 68,0,67,.LMa211-v4__eidrm
+.LMa211:
+	push %ebx
+	call .Lpic42
+.Lpic42:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic42],%ebx
+0:
+.stabn 68,0,67,.LMb211-v4__eidrm
+.LMb211:
+.LBB42:
+	mov $43,%eax
+	call v4__dpush@PLT
+.LBE42:
+.stabn 68,0,67,.LM215-v4__eidrm
+.LM215:
+	pop %ebx
+	ret
+.Lfe42:
+	.size	 v4__eidrm,.Lfe42-v4__eidrm
+.stabn	192,0,0,.LBB42-v4__eidrm
+.stabn	224,0,0,.LBE42-v4__eidrm
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4__eidrm
+.text
+	.align 4
+.stabs "v4__echrng:F1",36,0,0,v4__echrng
+	.weak v4__echrng
+	.type	v4__echrng,@function
+v4__echrng:
+.stabn 68,0,68,.LMa216-v4__echrng
+.LMa216:
+	push %ebx
+	call .Lpic43
+.Lpic43:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic43],%ebx
+0:
+.stabn 68,0,68,.LMb216-v4__echrng
+.LMb216:
+.LBB43:
+	mov $44,%eax
+	call v4__dpush@PLT
+.LBE43:
+.stabn 68,0,68,.LM220-v4__echrng
+.LM220:
+	pop %ebx
+	ret
+.Lfe43:
+	.size	 v4__echrng,.Lfe43-v4__echrng
+.stabn	192,0,0,.LBB43-v4__echrng
+.stabn	224,0,0,.LBE43-v4__echrng
+.Lscope43:
+.stabs	"",36,0,0,.Lscope43-v4__echrng
+.text
+	.align 4
+.stabs "v4__el2nsync:F1",36,0,0,v4__el2nsync
+	.weak v4__el2nsync
+	.type	v4__el2nsync,@function
+v4__el2nsync:
+.stabn 68,0,69,.LMa221-v4__el2nsync
+.LMa221:
+	push %ebx
+	call .Lpic44
+.Lpic44:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic44],%ebx
+0:
+.stabn 68,0,69,.LMb221-v4__el2nsync
+.LMb221:
+.LBB44:
+	mov $45,%eax
+	call v4__dpush@PLT
+.LBE44:
+.stabn 68,0,69,.LM225-v4__el2nsync
+.LM225:
+	pop %ebx
+	ret
+.Lfe44:
+	.size	 v4__el2nsync,.Lfe44-v4__el2nsync
+.stabn	192,0,0,.LBB44-v4__el2nsync
+.stabn	224,0,0,.LBE44-v4__el2nsync
+.Lscope44:
+.stabs	"",36,0,0,.Lscope44-v4__el2nsync
+.text
+	.align 4
+.stabs "v4__el3hlt:F1",36,0,0,v4__el3hlt
+	.weak v4__el3hlt
+	.type	v4__el3hlt,@function
+v4__el3hlt:
+.stabn 68,0,70,.LMa226-v4__el3hlt
+.LMa226:
+	push %ebx
+	call .Lpic45
+.Lpic45:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic45],%ebx
+0:
+.stabn 68,0,70,.LMb226-v4__el3hlt
+.LMb226:
+.LBB45:
+	mov $46,%eax
+	call v4__dpush@PLT
+.LBE45:
+.stabn 68,0,70,.LM230-v4__el3hlt
+.LM230:
+	pop %ebx
+	ret
+.Lfe45:
+	.size	 v4__el3hlt,.Lfe45-v4__el3hlt
+.stabn	192,0,0,.LBB45-v4__el3hlt
+.stabn	224,0,0,.LBE45-v4__el3hlt
+.Lscope45:
+.stabs	"",36,0,0,.Lscope45-v4__el3hlt
+.text
+	.align 4
+.stabs "v4__el3rst:F1",36,0,0,v4__el3rst
+	.weak v4__el3rst
+	.type	v4__el3rst,@function
+v4__el3rst:
+.stabn 68,0,71,.LMa231-v4__el3rst
+.LMa231:
+	push %ebx
+	call .Lpic46
+.Lpic46:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic46],%ebx
+0:
+.stabn 68,0,71,.LMb231-v4__el3rst
+.LMb231:
+.LBB46:
+	mov $47,%eax
+	call v4__dpush@PLT
+.LBE46:
+.stabn 68,0,71,.LM235-v4__el3rst
+.LM235:
+	pop %ebx
+	ret
+.Lfe46:
+	.size	 v4__el3rst,.Lfe46-v4__el3rst
+.stabn	192,0,0,.LBB46-v4__el3rst
+.stabn	224,0,0,.LBE46-v4__el3rst
+.Lscope46:
+.stabs	"",36,0,0,.Lscope46-v4__el3rst
+.text
+	.align 4
+.stabs "v4__elnrng:F1",36,0,0,v4__elnrng
+	.weak v4__elnrng
+	.type	v4__elnrng,@function
+v4__elnrng:
+.stabn 68,0,72,.LMa236-v4__elnrng
+.LMa236:
+	push %ebx
+	call .Lpic47
+.Lpic47:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic47],%ebx
+0:
+.stabn 68,0,72,.LMb236-v4__elnrng
+.LMb236:
+.LBB47:
+	mov $48,%eax
+	call v4__dpush@PLT
+.LBE47:
+.stabn 68,0,72,.LM240-v4__elnrng
+.LM240:
+	pop %ebx
+	ret
+.Lfe47:
+	.size	 v4__elnrng,.Lfe47-v4__elnrng
+.stabn	192,0,0,.LBB47-v4__elnrng
+.stabn	224,0,0,.LBE47-v4__elnrng
+.Lscope47:
+.stabs	"",36,0,0,.Lscope47-v4__elnrng
+.text
+	.align 4
+.stabs "v4__eunatch:F1",36,0,0,v4__eunatch
+	.weak v4__eunatch
+	.type	v4__eunatch,@function
+v4__eunatch:
+.stabn 68,0,73,.LMa241-v4__eunatch
+.LMa241:
+	push %ebx
+	call .Lpic48
+.Lpic48:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic48],%ebx
+0:
+.stabn 68,0,73,.LMb241-v4__eunatch
+.LMb241:
+.LBB48:
+	mov $49,%eax
+	call v4__dpush@PLT
+.LBE48:
+.stabn 68,0,73,.LM245-v4__eunatch
+.LM245:
+	pop %ebx
+	ret
+.Lfe48:
+	.size	 v4__eunatch,.Lfe48-v4__eunatch
+.stabn	192,0,0,.LBB48-v4__eunatch
+.stabn	224,0,0,.LBE48-v4__eunatch
+.Lscope48:
+.stabs	"",36,0,0,.Lscope48-v4__eunatch
+.text
+	.align 4
+.stabs "v4__enocsi:F1",36,0,0,v4__enocsi
+	.weak v4__enocsi
+	.type	v4__enocsi,@function
+v4__enocsi:
+.stabn 68,0,74,.LMa246-v4__enocsi
+.LMa246:
+	push %ebx
+	call .Lpic49
+.Lpic49:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic49],%ebx
+0:
+.stabn 68,0,74,.LMb246-v4__enocsi
+.LMb246:
+.LBB49:
+	mov $50,%eax
+	call v4__dpush@PLT
+.LBE49:
+.stabn 68,0,74,.LM250-v4__enocsi
+.LM250:
+	pop %ebx
+	ret
+.Lfe49:
+	.size	 v4__enocsi,.Lfe49-v4__enocsi
+.stabn	192,0,0,.LBB49-v4__enocsi
+.stabn	224,0,0,.LBE49-v4__enocsi
+.Lscope49:
+.stabs	"",36,0,0,.Lscope49-v4__enocsi
+.text
+	.align 4
+.stabs "v4__el2hlt:F1",36,0,0,v4__el2hlt
+	.weak v4__el2hlt
+	.type	v4__el2hlt,@function
+v4__el2hlt:
+.stabn 68,0,75,.LMa251-v4__el2hlt
+.LMa251:
+	push %ebx
+	call .Lpic50
+.Lpic50:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic50],%ebx
+0:
+.stabn 68,0,75,.LMb251-v4__el2hlt
+.LMb251:
+.LBB50:
+	mov $51,%eax
+	call v4__dpush@PLT
+.LBE50:
+.stabn 68,0,75,.LM255-v4__el2hlt
+.LM255:
+	pop %ebx
+	ret
+.Lfe50:
+	.size	 v4__el2hlt,.Lfe50-v4__el2hlt
+.stabn	192,0,0,.LBB50-v4__el2hlt
+.stabn	224,0,0,.LBE50-v4__el2hlt
+.Lscope50:
+.stabs	"",36,0,0,.Lscope50-v4__el2hlt
+.text
+	.align 4
+.stabs "v4__ebade:F1",36,0,0,v4__ebade
+	.weak v4__ebade
+	.type	v4__ebade,@function
+v4__ebade:
+.stabn 68,0,76,.LMa256-v4__ebade
+.LMa256:
+	push %ebx
+	call .Lpic51
+.Lpic51:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic51],%ebx
+0:
+.stabn 68,0,76,.LMb256-v4__ebade
+.LMb256:
+.LBB51:
+	mov $52,%eax
+	call v4__dpush@PLT
+.LBE51:
+.stabn 68,0,76,.LM260-v4__ebade
+.LM260:
+	pop %ebx
+	ret
+.Lfe51:
+	.size	 v4__ebade,.Lfe51-v4__ebade
+.stabn	192,0,0,.LBB51-v4__ebade
+.stabn	224,0,0,.LBE51-v4__ebade
+.Lscope51:
+.stabs	"",36,0,0,.Lscope51-v4__ebade
+.text
+	.align 4
+.stabs "v4__ebadr:F1",36,0,0,v4__ebadr
+	.weak v4__ebadr
+	.type	v4__ebadr,@function
+v4__ebadr:
+.stabn 68,0,77,.LMa261-v4__ebadr
+.LMa261:
+	push %ebx
+	call .Lpic52
+.Lpic52:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic52],%ebx
+0:
+.stabn 68,0,77,.LMb261-v4__ebadr
+.LMb261:
+.LBB52:
+	mov $53,%eax
+	call v4__dpush@PLT
+.LBE52:
+.stabn 68,0,77,.LM265-v4__ebadr
+.LM265:
+	pop %ebx
+	ret
+.Lfe52:
+	.size	 v4__ebadr,.Lfe52-v4__ebadr
+.stabn	192,0,0,.LBB52-v4__ebadr
+.stabn	224,0,0,.LBE52-v4__ebadr
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4__ebadr
+.text
+	.align 4
+.stabs "v4__exfull:F1",36,0,0,v4__exfull
+	.weak v4__exfull
+	.type	v4__exfull,@function
+v4__exfull:
+.stabn 68,0,78,.LMa266-v4__exfull
+.LMa266:
+	push %ebx
+	call .Lpic53
+.Lpic53:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic53],%ebx
+0:
+.stabn 68,0,78,.LMb266-v4__exfull
+.LMb266:
+.LBB53:
+	mov $54,%eax
+	call v4__dpush@PLT
+.LBE53:
+.stabn 68,0,78,.LM270-v4__exfull
+.LM270:
+	pop %ebx
+	ret
+.Lfe53:
+	.size	 v4__exfull,.Lfe53-v4__exfull
+.stabn	192,0,0,.LBB53-v4__exfull
+.stabn	224,0,0,.LBE53-v4__exfull
+.Lscope53:
+.stabs	"",36,0,0,.Lscope53-v4__exfull
+.text
+	.align 4
+.stabs "v4__enoano:F1",36,0,0,v4__enoano
+	.weak v4__enoano
+	.type	v4__enoano,@function
+v4__enoano:
+.stabn 68,0,79,.LMa271-v4__enoano
+.LMa271:
+	push %ebx
+	call .Lpic54
+.Lpic54:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic54],%ebx
+0:
+.stabn 68,0,79,.LMb271-v4__enoano
+.LMb271:
+.LBB54:
+	mov $55,%eax
+	call v4__dpush@PLT
+.LBE54:
+.stabn 68,0,79,.LM275-v4__enoano
+.LM275:
+	pop %ebx
+	ret
+.Lfe54:
+	.size	 v4__enoano,.Lfe54-v4__enoano
+.stabn	192,0,0,.LBB54-v4__enoano
+.stabn	224,0,0,.LBE54-v4__enoano
+.Lscope54:
+.stabs	"",36,0,0,.Lscope54-v4__enoano
+.text
+	.align 4
+.stabs "v4__ebadrqc:F1",36,0,0,v4__ebadrqc
+	.weak v4__ebadrqc
+	.type	v4__ebadrqc,@function
+v4__ebadrqc:
+.stabn 68,0,80,.LMa276-v4__ebadrqc
+.LMa276:
+	push %ebx
+	call .Lpic55
+.Lpic55:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic55],%ebx
+0:
+.stabn 68,0,80,.LMb276-v4__ebadrqc
+.LMb276:
+.LBB55:
+	mov $56,%eax
+	call v4__dpush@PLT
+.LBE55:
+.stabn 68,0,80,.LM280-v4__ebadrqc
+.LM280:
+	pop %ebx
+	ret
+.Lfe55:
+	.size	 v4__ebadrqc,.Lfe55-v4__ebadrqc
+.stabn	192,0,0,.LBB55-v4__ebadrqc
+.stabn	224,0,0,.LBE55-v4__ebadrqc
+.Lscope55:
+.stabs	"",36,0,0,.Lscope55-v4__ebadrqc
+.text
+	.align 4
+.stabs "v4__ebadslt:F1",36,0,0,v4__ebadslt
+	.weak v4__ebadslt
+	.type	v4__ebadslt,@function
+v4__ebadslt:
+.stabn 68,0,81,.LMa281-v4__ebadslt
+.LMa281:
+	push %ebx
+	call .Lpic56
+.Lpic56:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic56],%ebx
+0:
+.stabn 68,0,81,.LMb281-v4__ebadslt
+.LMb281:
+.LBB56:
+	mov $57,%eax
+	call v4__dpush@PLT
+.LBE56:
+.stabn 68,0,81,.LM285-v4__ebadslt
+.LM285:
+	pop %ebx
+	ret
+.Lfe56:
+	.size	 v4__ebadslt,.Lfe56-v4__ebadslt
+.stabn	192,0,0,.LBB56-v4__ebadslt
+.stabn	224,0,0,.LBE56-v4__ebadslt
+.Lscope56:
+.stabs	"",36,0,0,.Lscope56-v4__ebadslt
+.text
+	.align 4
+.stabs "v4__edeadlock:F1",36,0,0,v4__edeadlock
+	.weak v4__edeadlock
+	.type	v4__edeadlock,@function
+v4__edeadlock:
+.stabn 68,0,82,.LMa286-v4__edeadlock
+.LMa286:
+	push %ebx
+	call .Lpic57
+.Lpic57:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic57],%ebx
+0:
+.stabn 68,0,82,.LMb286-v4__edeadlock
+.LMb286:
+.LBB57:
+.stabn 68,0,59,.LM288-v4__edeadlock
+.LM288:
+	mov $35,%eax
+	call v4__dpush@PLT
+.LBE57:
+.stabn 68,0,82,.LM291-v4__edeadlock
+.LM291:
+	pop %ebx
+	ret
+.Lfe57:
+	.size	 v4__edeadlock,.Lfe57-v4__edeadlock
+.stabn	192,0,0,.LBB57-v4__edeadlock
+.stabn	224,0,0,.LBE57-v4__edeadlock
+.Lscope57:
+.stabs	"",36,0,0,.Lscope57-v4__edeadlock
+.text
+	.align 4
+.stabs "v4__ebfont:F1",36,0,0,v4__ebfont
+	.weak v4__ebfont
+	.type	v4__ebfont,@function
+v4__ebfont:
+.stabn 68,0,83,.LMa292-v4__ebfont
+.LMa292:
+	push %ebx
+	call .Lpic58
+.Lpic58:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic58],%ebx
+0:
+.stabn 68,0,83,.LMb292-v4__ebfont
+.LMb292:
+.LBB58:
+	mov $59,%eax
+	call v4__dpush@PLT
+.LBE58:
+.stabn 68,0,83,.LM296-v4__ebfont
+.LM296:
+	pop %ebx
+	ret
+.Lfe58:
+	.size	 v4__ebfont,.Lfe58-v4__ebfont
+.stabn	192,0,0,.LBB58-v4__ebfont
+.stabn	224,0,0,.LBE58-v4__ebfont
+.Lscope58:
+.stabs	"",36,0,0,.Lscope58-v4__ebfont
+.text
+	.align 4
+.stabs "v4__enostr:F1",36,0,0,v4__enostr
+	.weak v4__enostr
+	.type	v4__enostr,@function
+v4__enostr:
+.stabn 68,0,84,.LMa297-v4__enostr
+.LMa297:
+	push %ebx
+	call .Lpic59
+.Lpic59:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic59],%ebx
+0:
+.stabn 68,0,84,.LMb297-v4__enostr
+.LMb297:
+.LBB59:
+	mov $60,%eax
+	call v4__dpush@PLT
+.LBE59:
+.stabn 68,0,84,.LM301-v4__enostr
+.LM301:
+	pop %ebx
+	ret
+.Lfe59:
+	.size	 v4__enostr,.Lfe59-v4__enostr
+.stabn	192,0,0,.LBB59-v4__enostr
+.stabn	224,0,0,.LBE59-v4__enostr
+.Lscope59:
+.stabs	"",36,0,0,.Lscope59-v4__enostr
+.text
+	.align 4
+.stabs "v4__enodata:F1",36,0,0,v4__enodata
+	.weak v4__enodata
+	.type	v4__enodata,@function
+v4__enodata:
+.stabn 68,0,85,.LMa302-v4__enodata
+.LMa302:
+	push %ebx
+	call .Lpic60
+.Lpic60:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic60],%ebx
+0:
+.stabn 68,0,85,.LMb302-v4__enodata
+.LMb302:
+.LBB60:
+	mov $61,%eax
+	call v4__dpush@PLT
+.LBE60:
+.stabn 68,0,85,.LM306-v4__enodata
+.LM306:
+	pop %ebx
+	ret
+.Lfe60:
+	.size	 v4__enodata,.Lfe60-v4__enodata
+.stabn	192,0,0,.LBB60-v4__enodata
+.stabn	224,0,0,.LBE60-v4__enodata
+.Lscope60:
+.stabs	"",36,0,0,.Lscope60-v4__enodata
+.text
+	.align 4
+.stabs "v4__etime:F1",36,0,0,v4__etime
+	.weak v4__etime
+	.type	v4__etime,@function
+v4__etime:
+.stabn 68,0,86,.LMa307-v4__etime
+.LMa307:
+	push %ebx
+	call .Lpic61
+.Lpic61:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic61],%ebx
+0:
+.stabn 68,0,86,.LMb307-v4__etime
+.LMb307:
+.LBB61:
+	mov $62,%eax
+	call v4__dpush@PLT
+.LBE61:
+.stabn 68,0,86,.LM311-v4__etime
+.LM311:
+	pop %ebx
+	ret
+.Lfe61:
+	.size	 v4__etime,.Lfe61-v4__etime
+.stabn	192,0,0,.LBB61-v4__etime
+.stabn	224,0,0,.LBE61-v4__etime
+.Lscope61:
+.stabs	"",36,0,0,.Lscope61-v4__etime
+.text
+	.align 4
+.stabs "v4__enosr:F1",36,0,0,v4__enosr
+	.weak v4__enosr
+	.type	v4__enosr,@function
+v4__enosr:
+.stabn 68,0,87,.LMa312-v4__enosr
+.LMa312:
+	push %ebx
+	call .Lpic62
+.Lpic62:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic62],%ebx
+0:
+.stabn 68,0,87,.LMb312-v4__enosr
+.LMb312:
+.LBB62:
+	mov $63,%eax
+	call v4__dpush@PLT
+.LBE62:
+.stabn 68,0,87,.LM316-v4__enosr
+.LM316:
+	pop %ebx
+	ret
+.Lfe62:
+	.size	 v4__enosr,.Lfe62-v4__enosr
+.stabn	192,0,0,.LBB62-v4__enosr
+.stabn	224,0,0,.LBE62-v4__enosr
+.Lscope62:
+.stabs	"",36,0,0,.Lscope62-v4__enosr
+.text
+	.align 4
+.stabs "v4__enonet:F1",36,0,0,v4__enonet
+	.weak v4__enonet
+	.type	v4__enonet,@function
+v4__enonet:
+.stabn 68,0,88,.LMa317-v4__enonet
+.LMa317:
+	push %ebx
+	call .Lpic63
+.Lpic63:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic63],%ebx
+0:
+.stabn 68,0,88,.LMb317-v4__enonet
+.LMb317:
+.LBB63:
+	mov $64,%eax
+	call v4__dpush@PLT
+.LBE63:
+.stabn 68,0,88,.LM321-v4__enonet
+.LM321:
+	pop %ebx
+	ret
+.Lfe63:
+	.size	 v4__enonet,.Lfe63-v4__enonet
+.stabn	192,0,0,.LBB63-v4__enonet
+.stabn	224,0,0,.LBE63-v4__enonet
+.Lscope63:
+.stabs	"",36,0,0,.Lscope63-v4__enonet
+.text
+	.align 4
+.stabs "v4__enopkg:F1",36,0,0,v4__enopkg
+	.weak v4__enopkg
+	.type	v4__enopkg,@function
+v4__enopkg:
+.stabn 68,0,89,.LMa322-v4__enopkg
+.LMa322:
+	push %ebx
+	call .Lpic64
+.Lpic64:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic64],%ebx
+0:
+.stabn 68,0,89,.LMb322-v4__enopkg
+.LMb322:
+.LBB64:
+	mov $65,%eax
+	call v4__dpush@PLT
+.LBE64:
+.stabn 68,0,89,.LM326-v4__enopkg
+.LM326:
+	pop %ebx
+	ret
+.Lfe64:
+	.size	 v4__enopkg,.Lfe64-v4__enopkg
+.stabn	192,0,0,.LBB64-v4__enopkg
+.stabn	224,0,0,.LBE64-v4__enopkg
+.Lscope64:
+.stabs	"",36,0,0,.Lscope64-v4__enopkg
+.text
+	.align 4
+.stabs "v4__eremote:F1",36,0,0,v4__eremote
+	.weak v4__eremote
+	.type	v4__eremote,@function
+v4__eremote:
+.stabn 68,0,90,.LMa327-v4__eremote
+.LMa327:
+	push %ebx
+	call .Lpic65
+.Lpic65:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic65],%ebx
+0:
+.stabn 68,0,90,.LMb327-v4__eremote
+.LMb327:
+.LBB65:
+	mov $66,%eax
+	call v4__dpush@PLT
+.LBE65:
+.stabn 68,0,90,.LM331-v4__eremote
+.LM331:
+	pop %ebx
+	ret
+.Lfe65:
+	.size	 v4__eremote,.Lfe65-v4__eremote
+.stabn	192,0,0,.LBB65-v4__eremote
+.stabn	224,0,0,.LBE65-v4__eremote
+.Lscope65:
+.stabs	"",36,0,0,.Lscope65-v4__eremote
+.text
+	.align 4
+.stabs "v4__enolink:F1",36,0,0,v4__enolink
+	.weak v4__enolink
+	.type	v4__enolink,@function
+v4__enolink:
+.stabn 68,0,91,.LMa332-v4__enolink
+.LMa332:
+	push %ebx
+	call .Lpic66
+.Lpic66:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic66],%ebx
+0:
+.stabn 68,0,91,.LMb332-v4__enolink
+.LMb332:
+.LBB66:
+	mov $67,%eax
+	call v4__dpush@PLT
+.LBE66:
+.stabn 68,0,91,.LM336-v4__enolink
+.LM336:
+	pop %ebx
+	ret
+.Lfe66:
+	.size	 v4__enolink,.Lfe66-v4__enolink
+.stabn	192,0,0,.LBB66-v4__enolink
+.stabn	224,0,0,.LBE66-v4__enolink
+.Lscope66:
+.stabs	"",36,0,0,.Lscope66-v4__enolink
+.text
+	.align 4
+.stabs "v4__eadv:F1",36,0,0,v4__eadv
+	.weak v4__eadv
+	.type	v4__eadv,@function
+v4__eadv:
+.stabn 68,0,92,.LMa337-v4__eadv
+.LMa337:
+	push %ebx
+	call .Lpic67
+.Lpic67:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic67],%ebx
+0:
+.stabn 68,0,92,.LMb337-v4__eadv
+.LMb337:
+.LBB67:
+	mov $68,%eax
+	call v4__dpush@PLT
+.LBE67:
+.stabn 68,0,92,.LM341-v4__eadv
+.LM341:
+	pop %ebx
+	ret
+.Lfe67:
+	.size	 v4__eadv,.Lfe67-v4__eadv
+.stabn	192,0,0,.LBB67-v4__eadv
+.stabn	224,0,0,.LBE67-v4__eadv
+.Lscope67:
+.stabs	"",36,0,0,.Lscope67-v4__eadv
+.text
+	.align 4
+.stabs "v4__esrmnt:F1",36,0,0,v4__esrmnt
+	.weak v4__esrmnt
+	.type	v4__esrmnt,@function
+v4__esrmnt:
+.stabn 68,0,93,.LMa342-v4__esrmnt
+.LMa342:
+	push %ebx
+	call .Lpic68
+.Lpic68:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic68],%ebx
+0:
+.stabn 68,0,93,.LMb342-v4__esrmnt
+.LMb342:
+.LBB68:
+	mov $69,%eax
+	call v4__dpush@PLT
+.LBE68:
+.stabn 68,0,93,.LM346-v4__esrmnt
+.LM346:
+	pop %ebx
+	ret
+.Lfe68:
+	.size	 v4__esrmnt,.Lfe68-v4__esrmnt
+.stabn	192,0,0,.LBB68-v4__esrmnt
+.stabn	224,0,0,.LBE68-v4__esrmnt
+.Lscope68:
+.stabs	"",36,0,0,.Lscope68-v4__esrmnt
+.text
+	.align 4
+.stabs "v4__ecomm:F1",36,0,0,v4__ecomm
+	.weak v4__ecomm
+	.type	v4__ecomm,@function
+v4__ecomm:
+.stabn 68,0,94,.LMa347-v4__ecomm
+.LMa347:
+	push %ebx
+	call .Lpic69
+.Lpic69:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic69],%ebx
+0:
+.stabn 68,0,94,.LMb347-v4__ecomm
+.LMb347:
+.LBB69:
+	mov $70,%eax
+	call v4__dpush@PLT
+.LBE69:
+.stabn 68,0,94,.LM351-v4__ecomm
+.LM351:
+	pop %ebx
+	ret
+.Lfe69:
+	.size	 v4__ecomm,.Lfe69-v4__ecomm
+.stabn	192,0,0,.LBB69-v4__ecomm
+.stabn	224,0,0,.LBE69-v4__ecomm
+.Lscope69:
+.stabs	"",36,0,0,.Lscope69-v4__ecomm
+.text
+	.align 4
+.stabs "v4__eproto:F1",36,0,0,v4__eproto
+	.weak v4__eproto
+	.type	v4__eproto,@function
+v4__eproto:
+.stabn 68,0,95,.LMa352-v4__eproto
+.LMa352:
+	push %ebx
+	call .Lpic70
+.Lpic70:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic70],%ebx
+0:
+.stabn 68,0,95,.LMb352-v4__eproto
+.LMb352:
+.LBB70:
+	mov $71,%eax
+	call v4__dpush@PLT
+.LBE70:
+.stabn 68,0,95,.LM356-v4__eproto
+.LM356:
+	pop %ebx
+	ret
+.Lfe70:
+	.size	 v4__eproto,.Lfe70-v4__eproto
+.stabn	192,0,0,.LBB70-v4__eproto
+.stabn	224,0,0,.LBE70-v4__eproto
+.Lscope70:
+.stabs	"",36,0,0,.Lscope70-v4__eproto
+.text
+	.align 4
+.stabs "v4__emultihop:F1",36,0,0,v4__emultihop
+	.weak v4__emultihop
+	.type	v4__emultihop,@function
+v4__emultihop:
+.stabn 68,0,96,.LMa357-v4__emultihop
+.LMa357:
+	push %ebx
+	call .Lpic71
+.Lpic71:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic71],%ebx
+0:
+.stabn 68,0,96,.LMb357-v4__emultihop
+.LMb357:
+.LBB71:
+	mov $72,%eax
+	call v4__dpush@PLT
+.LBE71:
+.stabn 68,0,96,.LM361-v4__emultihop
+.LM361:
+	pop %ebx
+	ret
+.Lfe71:
+	.size	 v4__emultihop,.Lfe71-v4__emultihop
+.stabn	192,0,0,.LBB71-v4__emultihop
+.stabn	224,0,0,.LBE71-v4__emultihop
+.Lscope71:
+.stabs	"",36,0,0,.Lscope71-v4__emultihop
+.text
+	.align 4
+.stabs "v4__edotdot:F1",36,0,0,v4__edotdot
+	.weak v4__edotdot
+	.type	v4__edotdot,@function
+v4__edotdot:
+.stabn 68,0,97,.LMa362-v4__edotdot
+.LMa362:
+	push %ebx
+	call .Lpic72
+.Lpic72:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic72],%ebx
+0:
+.stabn 68,0,97,.LMb362-v4__edotdot
+.LMb362:
+.LBB72:
+	mov $73,%eax
+	call v4__dpush@PLT
+.LBE72:
+.stabn 68,0,97,.LM366-v4__edotdot
+.LM366:
+	pop %ebx
+	ret
+.Lfe72:
+	.size	 v4__edotdot,.Lfe72-v4__edotdot
+.stabn	192,0,0,.LBB72-v4__edotdot
+.stabn	224,0,0,.LBE72-v4__edotdot
+.Lscope72:
+.stabs	"",36,0,0,.Lscope72-v4__edotdot
+.text
+	.align 4
+.stabs "v4__ebadmsg:F1",36,0,0,v4__ebadmsg
+	.weak v4__ebadmsg
+	.type	v4__ebadmsg,@function
+v4__ebadmsg:
+.stabn 68,0,98,.LMa367-v4__ebadmsg
+.LMa367:
+	push %ebx
+	call .Lpic73
+.Lpic73:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic73],%ebx
+0:
+.stabn 68,0,98,.LMb367-v4__ebadmsg
+.LMb367:
+.LBB73:
+	mov $74,%eax
+	call v4__dpush@PLT
+.LBE73:
+.stabn 68,0,98,.LM371-v4__ebadmsg
+.LM371:
+	pop %ebx
+	ret
+.Lfe73:
+	.size	 v4__ebadmsg,.Lfe73-v4__ebadmsg
+.stabn	192,0,0,.LBB73-v4__ebadmsg
+.stabn	224,0,0,.LBE73-v4__ebadmsg
+.Lscope73:
+.stabs	"",36,0,0,.Lscope73-v4__ebadmsg
+.text
+	.align 4
+.stabs "v4__eoverflow:F1",36,0,0,v4__eoverflow
+	.weak v4__eoverflow
+	.type	v4__eoverflow,@function
+v4__eoverflow:
+.stabn 68,0,99,.LMa372-v4__eoverflow
+.LMa372:
+	push %ebx
+	call .Lpic74
+.Lpic74:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic74],%ebx
+0:
+.stabn 68,0,99,.LMb372-v4__eoverflow
+.LMb372:
+.LBB74:
+	mov $75,%eax
+	call v4__dpush@PLT
+.LBE74:
+.stabn 68,0,99,.LM376-v4__eoverflow
+.LM376:
+	pop %ebx
+	ret
+.Lfe74:
+	.size	 v4__eoverflow,.Lfe74-v4__eoverflow
+.stabn	192,0,0,.LBB74-v4__eoverflow
+.stabn	224,0,0,.LBE74-v4__eoverflow
+.Lscope74:
+.stabs	"",36,0,0,.Lscope74-v4__eoverflow
+.text
+	.align 4
+.stabs "v4__enotuniq:F1",36,0,0,v4__enotuniq
+	.weak v4__enotuniq
+	.type	v4__enotuniq,@function
+v4__enotuniq:
+.stabn 68,0,100,.LMa377-v4__enotuniq
+.LMa377:
+	push %ebx
+	call .Lpic75
+.Lpic75:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic75],%ebx
+0:
+.stabn 68,0,100,.LMb377-v4__enotuniq
+.LMb377:
+.LBB75:
+	mov $76,%eax
+	call v4__dpush@PLT
+.LBE75:
+.stabn 68,0,100,.LM381-v4__enotuniq
+.LM381:
+	pop %ebx
+	ret
+.Lfe75:
+	.size	 v4__enotuniq,.Lfe75-v4__enotuniq
+.stabn	192,0,0,.LBB75-v4__enotuniq
+.stabn	224,0,0,.LBE75-v4__enotuniq
+.Lscope75:
+.stabs	"",36,0,0,.Lscope75-v4__enotuniq
+.text
+	.align 4
+.stabs "v4__ebadfd:F1",36,0,0,v4__ebadfd
+	.weak v4__ebadfd
+	.type	v4__ebadfd,@function
+v4__ebadfd:
+.stabn 68,0,101,.LMa382-v4__ebadfd
+.LMa382:
+	push %ebx
+	call .Lpic76
+.Lpic76:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic76],%ebx
+0:
+.stabn 68,0,101,.LMb382-v4__ebadfd
+.LMb382:
+.LBB76:
+	mov $77,%eax
+	call v4__dpush@PLT
+.LBE76:
+.stabn 68,0,101,.LM386-v4__ebadfd
+.LM386:
+	pop %ebx
+	ret
+.Lfe76:
+	.size	 v4__ebadfd,.Lfe76-v4__ebadfd
+.stabn	192,0,0,.LBB76-v4__ebadfd
+.stabn	224,0,0,.LBE76-v4__ebadfd
+.Lscope76:
+.stabs	"",36,0,0,.Lscope76-v4__ebadfd
+.text
+	.align 4
+.stabs "v4__eremchg:F1",36,0,0,v4__eremchg
+	.weak v4__eremchg
+	.type	v4__eremchg,@function
+v4__eremchg:
+.stabn 68,0,102,.LMa387-v4__eremchg
+.LMa387:
+	push %ebx
+	call .Lpic77
+.Lpic77:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic77],%ebx
+0:
+.stabn 68,0,102,.LMb387-v4__eremchg
+.LMb387:
+.LBB77:
+	mov $78,%eax
+	call v4__dpush@PLT
+.LBE77:
+.stabn 68,0,102,.LM391-v4__eremchg
+.LM391:
+	pop %ebx
+	ret
+.Lfe77:
+	.size	 v4__eremchg,.Lfe77-v4__eremchg
+.stabn	192,0,0,.LBB77-v4__eremchg
+.stabn	224,0,0,.LBE77-v4__eremchg
+.Lscope77:
+.stabs	"",36,0,0,.Lscope77-v4__eremchg
+.text
+	.align 4
+.stabs "v4__elibacc:F1",36,0,0,v4__elibacc
+	.weak v4__elibacc
+	.type	v4__elibacc,@function
+v4__elibacc:
+.stabn 68,0,103,.LMa392-v4__elibacc
+.LMa392:
+	push %ebx
+	call .Lpic78
+.Lpic78:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic78],%ebx
+0:
+.stabn 68,0,103,.LMb392-v4__elibacc
+.LMb392:
+.LBB78:
+	mov $79,%eax
+	call v4__dpush@PLT
+.LBE78:
+.stabn 68,0,103,.LM396-v4__elibacc
+.LM396:
+	pop %ebx
+	ret
+.Lfe78:
+	.size	 v4__elibacc,.Lfe78-v4__elibacc
+.stabn	192,0,0,.LBB78-v4__elibacc
+.stabn	224,0,0,.LBE78-v4__elibacc
+.Lscope78:
+.stabs	"",36,0,0,.Lscope78-v4__elibacc
+.text
+	.align 4
+.stabs "v4__elibbad:F1",36,0,0,v4__elibbad
+	.weak v4__elibbad
+	.type	v4__elibbad,@function
+v4__elibbad:
+.stabn 68,0,104,.LMa397-v4__elibbad
+.LMa397:
+	push %ebx
+	call .Lpic79
+.Lpic79:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic79],%ebx
+0:
+.stabn 68,0,104,.LMb397-v4__elibbad
+.LMb397:
+.LBB79:
+	mov $80,%eax
+	call v4__dpush@PLT
+.LBE79:
+.stabn 68,0,104,.LM401-v4__elibbad
+.LM401:
+	pop %ebx
+	ret
+.Lfe79:
+	.size	 v4__elibbad,.Lfe79-v4__elibbad
+.stabn	192,0,0,.LBB79-v4__elibbad
+.stabn	224,0,0,.LBE79-v4__elibbad
+.Lscope79:
+.stabs	"",36,0,0,.Lscope79-v4__elibbad
+.text
+	.align 4
+.stabs "v4__elibscn:F1",36,0,0,v4__elibscn
+	.weak v4__elibscn
+	.type	v4__elibscn,@function
+v4__elibscn:
+.stabn 68,0,105,.LMa402-v4__elibscn
+.LMa402:
+	push %ebx
+	call .Lpic80
+.Lpic80:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic80],%ebx
+0:
+.stabn 68,0,105,.LMb402-v4__elibscn
+.LMb402:
+.LBB80:
+	mov $81,%eax
+	call v4__dpush@PLT
+.LBE80:
+.stabn 68,0,105,.LM406-v4__elibscn
+.LM406:
+	pop %ebx
+	ret
+.Lfe80:
+	.size	 v4__elibscn,.Lfe80-v4__elibscn
+.stabn	192,0,0,.LBB80-v4__elibscn
+.stabn	224,0,0,.LBE80-v4__elibscn
+.Lscope80:
+.stabs	"",36,0,0,.Lscope80-v4__elibscn
+.text
+	.align 4
+.stabs "v4__elibmax:F1",36,0,0,v4__elibmax
+	.weak v4__elibmax
+	.type	v4__elibmax,@function
+v4__elibmax:
+.stabn 68,0,106,.LMa407-v4__elibmax
+.LMa407:
+	push %ebx
+	call .Lpic81
+.Lpic81:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic81],%ebx
+0:
+.stabn 68,0,106,.LMb407-v4__elibmax
+.LMb407:
+.LBB81:
+	mov $82,%eax
+	call v4__dpush@PLT
+.LBE81:
+.stabn 68,0,106,.LM411-v4__elibmax
+.LM411:
+	pop %ebx
+	ret
+.Lfe81:
+	.size	 v4__elibmax,.Lfe81-v4__elibmax
+.stabn	192,0,0,.LBB81-v4__elibmax
+.stabn	224,0,0,.LBE81-v4__elibmax
+.Lscope81:
+.stabs	"",36,0,0,.Lscope81-v4__elibmax
+.text
+	.align 4
+.stabs "v4__elibexec:F1",36,0,0,v4__elibexec
+	.weak v4__elibexec
+	.type	v4__elibexec,@function
+v4__elibexec:
+.stabn 68,0,107,.LMa412-v4__elibexec
+.LMa412:
+	push %ebx
+	call .Lpic82
+.Lpic82:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic82],%ebx
+0:
+.stabn 68,0,107,.LMb412-v4__elibexec
+.LMb412:
+.LBB82:
+	mov $83,%eax
+	call v4__dpush@PLT
+.LBE82:
+.stabn 68,0,107,.LM416-v4__elibexec
+.LM416:
+	pop %ebx
+	ret
+.Lfe82:
+	.size	 v4__elibexec,.Lfe82-v4__elibexec
+.stabn	192,0,0,.LBB82-v4__elibexec
+.stabn	224,0,0,.LBE82-v4__elibexec
+.Lscope82:
+.stabs	"",36,0,0,.Lscope82-v4__elibexec
+.text
+	.align 4
+.stabs "v4__eilseq:F1",36,0,0,v4__eilseq
+	.weak v4__eilseq
+	.type	v4__eilseq,@function
+v4__eilseq:
+.stabn 68,0,108,.LMa417-v4__eilseq
+.LMa417:
+	push %ebx
+	call .Lpic83
+.Lpic83:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic83],%ebx
+0:
+.stabn 68,0,108,.LMb417-v4__eilseq
+.LMb417:
+.LBB83:
+	mov $84,%eax
+	call v4__dpush@PLT
+.LBE83:
+.stabn 68,0,108,.LM421-v4__eilseq
+.LM421:
+	pop %ebx
+	ret
+.Lfe83:
+	.size	 v4__eilseq,.Lfe83-v4__eilseq
+.stabn	192,0,0,.LBB83-v4__eilseq
+.stabn	224,0,0,.LBE83-v4__eilseq
+.Lscope83:
+.stabs	"",36,0,0,.Lscope83-v4__eilseq
+.text
+	.align 4
+.stabs "v4__erestart:F1",36,0,0,v4__erestart
+	.weak v4__erestart
+	.type	v4__erestart,@function
+v4__erestart:
+.stabn 68,0,109,.LMa422-v4__erestart
+.LMa422:
+	push %ebx
+	call .Lpic84
+.Lpic84:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic84],%ebx
+0:
+.stabn 68,0,109,.LMb422-v4__erestart
+.LMb422:
+.LBB84:
+	mov $85,%eax
+	call v4__dpush@PLT
+.LBE84:
+.stabn 68,0,109,.LM426-v4__erestart
+.LM426:
+	pop %ebx
+	ret
+.Lfe84:
+	.size	 v4__erestart,.Lfe84-v4__erestart
+.stabn	192,0,0,.LBB84-v4__erestart
+.stabn	224,0,0,.LBE84-v4__erestart
+.Lscope84:
+.stabs	"",36,0,0,.Lscope84-v4__erestart
+.text
+	.align 4
+.stabs "v4__estrpipe:F1",36,0,0,v4__estrpipe
+	.weak v4__estrpipe
+	.type	v4__estrpipe,@function
+v4__estrpipe:
+.stabn 68,0,110,.LMa427-v4__estrpipe
+.LMa427:
+	push %ebx
+	call .Lpic85
+.Lpic85:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic85],%ebx
+0:
+.stabn 68,0,110,.LMb427-v4__estrpipe
+.LMb427:
+.LBB85:
+	mov $86,%eax
+	call v4__dpush@PLT
+.LBE85:
+.stabn 68,0,110,.LM431-v4__estrpipe
+.LM431:
+	pop %ebx
+	ret
+.Lfe85:
+	.size	 v4__estrpipe,.Lfe85-v4__estrpipe
+.stabn	192,0,0,.LBB85-v4__estrpipe
+.stabn	224,0,0,.LBE85-v4__estrpipe
+.Lscope85:
+.stabs	"",36,0,0,.Lscope85-v4__estrpipe
+.text
+	.align 4
+.stabs "v4__eusers:F1",36,0,0,v4__eusers
+	.weak v4__eusers
+	.type	v4__eusers,@function
+v4__eusers:
+.stabn 68,0,111,.LMa432-v4__eusers
+.LMa432:
+	push %ebx
+	call .Lpic86
+.Lpic86:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic86],%ebx
+0:
+.stabn 68,0,111,.LMb432-v4__eusers
+.LMb432:
+.LBB86:
+	mov $87,%eax
+	call v4__dpush@PLT
+.LBE86:
+.stabn 68,0,111,.LM436-v4__eusers
+.LM436:
+	pop %ebx
+	ret
+.Lfe86:
+	.size	 v4__eusers,.Lfe86-v4__eusers
+.stabn	192,0,0,.LBB86-v4__eusers
+.stabn	224,0,0,.LBE86-v4__eusers
+.Lscope86:
+.stabs	"",36,0,0,.Lscope86-v4__eusers
+.text
+	.align 4
+.stabs "v4__enotsock:F1",36,0,0,v4__enotsock
+	.weak v4__enotsock
+	.type	v4__enotsock,@function
+v4__enotsock:
+.stabn 68,0,112,.LMa437-v4__enotsock
+.LMa437:
+	push %ebx
+	call .Lpic87
+.Lpic87:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic87],%ebx
+0:
+.stabn 68,0,112,.LMb437-v4__enotsock
+.LMb437:
+.LBB87:
+	mov $88,%eax
+	call v4__dpush@PLT
+.LBE87:
+.stabn 68,0,112,.LM441-v4__enotsock
+.LM441:
+	pop %ebx
+	ret
+.Lfe87:
+	.size	 v4__enotsock,.Lfe87-v4__enotsock
+.stabn	192,0,0,.LBB87-v4__enotsock
+.stabn	224,0,0,.LBE87-v4__enotsock
+.Lscope87:
+.stabs	"",36,0,0,.Lscope87-v4__enotsock
+.text
+	.align 4
+.stabs "v4__edestaddrreq:F1",36,0,0,v4__edestaddrreq
+	.weak v4__edestaddrreq
+	.type	v4__edestaddrreq,@function
+v4__edestaddrreq:
+.stabn 68,0,113,.LMa442-v4__edestaddrreq
+.LMa442:
+	push %ebx
+	call .Lpic88
+.Lpic88:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic88],%ebx
+0:
+.stabn 68,0,113,.LMb442-v4__edestaddrreq
+.LMb442:
+.LBB88:
+	mov $89,%eax
+	call v4__dpush@PLT
+.LBE88:
+.stabn 68,0,113,.LM446-v4__edestaddrreq
+.LM446:
+	pop %ebx
+	ret
+.Lfe88:
+	.size	 v4__edestaddrreq,.Lfe88-v4__edestaddrreq
+.stabn	192,0,0,.LBB88-v4__edestaddrreq
+.stabn	224,0,0,.LBE88-v4__edestaddrreq
+.Lscope88:
+.stabs	"",36,0,0,.Lscope88-v4__edestaddrreq
+.text
+	.align 4
+.stabs "v4__emsgsize:F1",36,0,0,v4__emsgsize
+	.weak v4__emsgsize
+	.type	v4__emsgsize,@function
+v4__emsgsize:
+.stabn 68,0,114,.LMa447-v4__emsgsize
+.LMa447:
+	push %ebx
+	call .Lpic89
+.Lpic89:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic89],%ebx
+0:
+.stabn 68,0,114,.LMb447-v4__emsgsize
+.LMb447:
+.LBB89:
+	mov $90,%eax
+	call v4__dpush@PLT
+.LBE89:
+.stabn 68,0,114,.LM451-v4__emsgsize
+.LM451:
+	pop %ebx
+	ret
+.Lfe89:
+	.size	 v4__emsgsize,.Lfe89-v4__emsgsize
+.stabn	192,0,0,.LBB89-v4__emsgsize
+.stabn	224,0,0,.LBE89-v4__emsgsize
+.Lscope89:
+.stabs	"",36,0,0,.Lscope89-v4__emsgsize
+.text
+	.align 4
+.stabs "v4__eprototype:F1",36,0,0,v4__eprototype
+	.weak v4__eprototype
+	.type	v4__eprototype,@function
+v4__eprototype:
+.stabn 68,0,115,.LMa452-v4__eprototype
+.LMa452:
+	push %ebx
+	call .Lpic90
+.Lpic90:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic90],%ebx
+0:
+.stabn 68,0,115,.LMb452-v4__eprototype
+.LMb452:
+.LBB90:
+	mov $91,%eax
+	call v4__dpush@PLT
+.LBE90:
+.stabn 68,0,115,.LM456-v4__eprototype
+.LM456:
+	pop %ebx
+	ret
+.Lfe90:
+	.size	 v4__eprototype,.Lfe90-v4__eprototype
+.stabn	192,0,0,.LBB90-v4__eprototype
+.stabn	224,0,0,.LBE90-v4__eprototype
+.Lscope90:
+.stabs	"",36,0,0,.Lscope90-v4__eprototype
+.text
+	.align 4
+.stabs "v4__enoprotoopt:F1",36,0,0,v4__enoprotoopt
+	.weak v4__enoprotoopt
+	.type	v4__enoprotoopt,@function
+v4__enoprotoopt:
+.stabn 68,0,116,.LMa457-v4__enoprotoopt
+.LMa457:
+	push %ebx
+	call .Lpic91
+.Lpic91:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic91],%ebx
+0:
+.stabn 68,0,116,.LMb457-v4__enoprotoopt
+.LMb457:
+.LBB91:
+	mov $92,%eax
+	call v4__dpush@PLT
+.LBE91:
+.stabn 68,0,116,.LM461-v4__enoprotoopt
+.LM461:
+	pop %ebx
+	ret
+.Lfe91:
+	.size	 v4__enoprotoopt,.Lfe91-v4__enoprotoopt
+.stabn	192,0,0,.LBB91-v4__enoprotoopt
+.stabn	224,0,0,.LBE91-v4__enoprotoopt
+.Lscope91:
+.stabs	"",36,0,0,.Lscope91-v4__enoprotoopt
+.text
+	.align 4
+.stabs "v4__eprotonosupport:F1",36,0,0,v4__eprotonosupport
+	.weak v4__eprotonosupport
+	.type	v4__eprotonosupport,@function
+v4__eprotonosupport:
+.stabn 68,0,117,.LMa462-v4__eprotonosupport
+.LMa462:
+	push %ebx
+	call .Lpic92
+.Lpic92:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic92],%ebx
+0:
+.stabn 68,0,117,.LMb462-v4__eprotonosupport
+.LMb462:
+.LBB92:
+	mov $93,%eax
+	call v4__dpush@PLT
+.LBE92:
+.stabn 68,0,117,.LM466-v4__eprotonosupport
+.LM466:
+	pop %ebx
+	ret
+.Lfe92:
+	.size	 v4__eprotonosupport,.Lfe92-v4__eprotonosupport
+.stabn	192,0,0,.LBB92-v4__eprotonosupport
+.stabn	224,0,0,.LBE92-v4__eprotonosupport
+.Lscope92:
+.stabs	"",36,0,0,.Lscope92-v4__eprotonosupport
+.text
+	.align 4
+.stabs "v4__esocktnosupport:F1",36,0,0,v4__esocktnosupport
+	.weak v4__esocktnosupport
+	.type	v4__esocktnosupport,@function
+v4__esocktnosupport:
+.stabn 68,0,118,.LMa467-v4__esocktnosupport
+.LMa467:
+	push %ebx
+	call .Lpic93
+.Lpic93:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic93],%ebx
+0:
+.stabn 68,0,118,.LMb467-v4__esocktnosupport
+.LMb467:
+.LBB93:
+	mov $94,%eax
+	call v4__dpush@PLT
+.LBE93:
+.stabn 68,0,118,.LM471-v4__esocktnosupport
+.LM471:
+	pop %ebx
+	ret
+.Lfe93:
+	.size	 v4__esocktnosupport,.Lfe93-v4__esocktnosupport
+.stabn	192,0,0,.LBB93-v4__esocktnosupport
+.stabn	224,0,0,.LBE93-v4__esocktnosupport
+.Lscope93:
+.stabs	"",36,0,0,.Lscope93-v4__esocktnosupport
+.text
+	.align 4
+.stabs "v4__eopnotsupp:F1",36,0,0,v4__eopnotsupp
+	.weak v4__eopnotsupp
+	.type	v4__eopnotsupp,@function
+v4__eopnotsupp:
+.stabn 68,0,119,.LMa472-v4__eopnotsupp
+.LMa472:
+	push %ebx
+	call .Lpic94
+.Lpic94:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic94],%ebx
+0:
+.stabn 68,0,119,.LMb472-v4__eopnotsupp
+.LMb472:
+.LBB94:
+	mov $95,%eax
+	call v4__dpush@PLT
+.LBE94:
+.stabn 68,0,119,.LM476-v4__eopnotsupp
+.LM476:
+	pop %ebx
+	ret
+.Lfe94:
+	.size	 v4__eopnotsupp,.Lfe94-v4__eopnotsupp
+.stabn	192,0,0,.LBB94-v4__eopnotsupp
+.stabn	224,0,0,.LBE94-v4__eopnotsupp
+.Lscope94:
+.stabs	"",36,0,0,.Lscope94-v4__eopnotsupp
+.text
+	.align 4
+.stabs "v4__epfnosupport:F1",36,0,0,v4__epfnosupport
+	.weak v4__epfnosupport
+	.type	v4__epfnosupport,@function
+v4__epfnosupport:
+.stabn 68,0,120,.LMa477-v4__epfnosupport
+.LMa477:
+	push %ebx
+	call .Lpic95
+.Lpic95:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic95],%ebx
+0:
+.stabn 68,0,120,.LMb477-v4__epfnosupport
+.LMb477:
+.LBB95:
+	mov $96,%eax
+	call v4__dpush@PLT
+.LBE95:
+.stabn 68,0,120,.LM481-v4__epfnosupport
+.LM481:
+	pop %ebx
+	ret
+.Lfe95:
+	.size	 v4__epfnosupport,.Lfe95-v4__epfnosupport
+.stabn	192,0,0,.LBB95-v4__epfnosupport
+.stabn	224,0,0,.LBE95-v4__epfnosupport
+.Lscope95:
+.stabs	"",36,0,0,.Lscope95-v4__epfnosupport
+.text
+	.align 4
+.stabs "v4__eafnosupport:F1",36,0,0,v4__eafnosupport
+	.weak v4__eafnosupport
+	.type	v4__eafnosupport,@function
+v4__eafnosupport:
+.stabn 68,0,121,.LMa482-v4__eafnosupport
+.LMa482:
+	push %ebx
+	call .Lpic96
+.Lpic96:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic96],%ebx
+0:
+.stabn 68,0,121,.LMb482-v4__eafnosupport
+.LMb482:
+.LBB96:
+	mov $97,%eax
+	call v4__dpush@PLT
+.LBE96:
+.stabn 68,0,121,.LM486-v4__eafnosupport
+.LM486:
+	pop %ebx
+	ret
+.Lfe96:
+	.size	 v4__eafnosupport,.Lfe96-v4__eafnosupport
+.stabn	192,0,0,.LBB96-v4__eafnosupport
+.stabn	224,0,0,.LBE96-v4__eafnosupport
+.Lscope96:
+.stabs	"",36,0,0,.Lscope96-v4__eafnosupport
+.text
+	.align 4
+.stabs "v4__eaddrinuse:F1",36,0,0,v4__eaddrinuse
+	.weak v4__eaddrinuse
+	.type	v4__eaddrinuse,@function
+v4__eaddrinuse:
+.stabn 68,0,122,.LMa487-v4__eaddrinuse
+.LMa487:
+	push %ebx
+	call .Lpic97
+.Lpic97:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic97],%ebx
+0:
+.stabn 68,0,122,.LMb487-v4__eaddrinuse
+.LMb487:
+.LBB97:
+	mov $98,%eax
+	call v4__dpush@PLT
+.LBE97:
+.stabn 68,0,122,.LM491-v4__eaddrinuse
+.LM491:
+	pop %ebx
+	ret
+.Lfe97:
+	.size	 v4__eaddrinuse,.Lfe97-v4__eaddrinuse
+.stabn	192,0,0,.LBB97-v4__eaddrinuse
+.stabn	224,0,0,.LBE97-v4__eaddrinuse
+.Lscope97:
+.stabs	"",36,0,0,.Lscope97-v4__eaddrinuse
+.text
+	.align 4
+.stabs "v4__eaddrnotavail:F1",36,0,0,v4__eaddrnotavail
+	.weak v4__eaddrnotavail
+	.type	v4__eaddrnotavail,@function
+v4__eaddrnotavail:
+.stabn 68,0,123,.LMa492-v4__eaddrnotavail
+.LMa492:
+	push %ebx
+	call .Lpic98
+.Lpic98:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic98],%ebx
+0:
+.stabn 68,0,123,.LMb492-v4__eaddrnotavail
+.LMb492:
+.LBB98:
+	mov $99,%eax
+	call v4__dpush@PLT
+.LBE98:
+.stabn 68,0,123,.LM496-v4__eaddrnotavail
+.LM496:
+	pop %ebx
+	ret
+.Lfe98:
+	.size	 v4__eaddrnotavail,.Lfe98-v4__eaddrnotavail
+.stabn	192,0,0,.LBB98-v4__eaddrnotavail
+.stabn	224,0,0,.LBE98-v4__eaddrnotavail
+.Lscope98:
+.stabs	"",36,0,0,.Lscope98-v4__eaddrnotavail
+.text
+	.align 4
+.stabs "v4__enetdown:F1",36,0,0,v4__enetdown
+	.weak v4__enetdown
+	.type	v4__enetdown,@function
+v4__enetdown:
+.stabn 68,0,124,.LMa497-v4__enetdown
+.LMa497:
+	push %ebx
+	call .Lpic99
+.Lpic99:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic99],%ebx
+0:
+.stabn 68,0,124,.LMb497-v4__enetdown
+.LMb497:
+.LBB99:
+	mov $100,%eax
+	call v4__dpush@PLT
+.LBE99:
+.stabn 68,0,124,.LM501-v4__enetdown
+.LM501:
+	pop %ebx
+	ret
+.Lfe99:
+	.size	 v4__enetdown,.Lfe99-v4__enetdown
+.stabn	192,0,0,.LBB99-v4__enetdown
+.stabn	224,0,0,.LBE99-v4__enetdown
+.Lscope99:
+.stabs	"",36,0,0,.Lscope99-v4__enetdown
+.text
+	.align 4
+.stabs "v4__enetunreach:F1",36,0,0,v4__enetunreach
+	.weak v4__enetunreach
+	.type	v4__enetunreach,@function
+v4__enetunreach:
+.stabn 68,0,125,.LMa502-v4__enetunreach
+.LMa502:
+	push %ebx
+	call .Lpic100
+.Lpic100:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic100],%ebx
+0:
+.stabn 68,0,125,.LMb502-v4__enetunreach
+.LMb502:
+.LBB100:
+	mov $101,%eax
+	call v4__dpush@PLT
+.LBE100:
+.stabn 68,0,125,.LM506-v4__enetunreach
+.LM506:
+	pop %ebx
+	ret
+.Lfe100:
+	.size	 v4__enetunreach,.Lfe100-v4__enetunreach
+.stabn	192,0,0,.LBB100-v4__enetunreach
+.stabn	224,0,0,.LBE100-v4__enetunreach
+.Lscope100:
+.stabs	"",36,0,0,.Lscope100-v4__enetunreach
+.text
+	.align 4
+.stabs "v4__enetreset:F1",36,0,0,v4__enetreset
+	.weak v4__enetreset
+	.type	v4__enetreset,@function
+v4__enetreset:
+.stabn 68,0,126,.LMa507-v4__enetreset
+.LMa507:
+	push %ebx
+	call .Lpic101
+.Lpic101:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic101],%ebx
+0:
+.stabn 68,0,126,.LMb507-v4__enetreset
+.LMb507:
+.LBB101:
+	mov $102,%eax
+	call v4__dpush@PLT
+.LBE101:
+.stabn 68,0,126,.LM511-v4__enetreset
+.LM511:
+	pop %ebx
+	ret
+.Lfe101:
+	.size	 v4__enetreset,.Lfe101-v4__enetreset
+.stabn	192,0,0,.LBB101-v4__enetreset
+.stabn	224,0,0,.LBE101-v4__enetreset
+.Lscope101:
+.stabs	"",36,0,0,.Lscope101-v4__enetreset
+.text
+	.align 4
+.stabs "v4__econnaborted:F1",36,0,0,v4__econnaborted
+	.weak v4__econnaborted
+	.type	v4__econnaborted,@function
+v4__econnaborted:
+.stabn 68,0,127,.LMa512-v4__econnaborted
+.LMa512:
+	push %ebx
+	call .Lpic102
+.Lpic102:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic102],%ebx
+0:
+.stabn 68,0,127,.LMb512-v4__econnaborted
+.LMb512:
+.LBB102:
+	mov $103,%eax
+	call v4__dpush@PLT
+.LBE102:
+.stabn 68,0,127,.LM516-v4__econnaborted
+.LM516:
+	pop %ebx
+	ret
+.Lfe102:
+	.size	 v4__econnaborted,.Lfe102-v4__econnaborted
+.stabn	192,0,0,.LBB102-v4__econnaborted
+.stabn	224,0,0,.LBE102-v4__econnaborted
+.Lscope102:
+.stabs	"",36,0,0,.Lscope102-v4__econnaborted
+.text
+	.align 4
+.stabs "v4__econnreset:F1",36,0,0,v4__econnreset
+	.weak v4__econnreset
+	.type	v4__econnreset,@function
+v4__econnreset:
+.stabn 68,0,128,.LMa517-v4__econnreset
+.LMa517:
+	push %ebx
+	call .Lpic103
+.Lpic103:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic103],%ebx
+0:
+.stabn 68,0,128,.LMb517-v4__econnreset
+.LMb517:
+.LBB103:
+	mov $104,%eax
+	call v4__dpush@PLT
+.LBE103:
+.stabn 68,0,128,.LM521-v4__econnreset
+.LM521:
+	pop %ebx
+	ret
+.Lfe103:
+	.size	 v4__econnreset,.Lfe103-v4__econnreset
+.stabn	192,0,0,.LBB103-v4__econnreset
+.stabn	224,0,0,.LBE103-v4__econnreset
+.Lscope103:
+.stabs	"",36,0,0,.Lscope103-v4__econnreset
+.text
+	.align 4
+.stabs "v4__enobufs:F1",36,0,0,v4__enobufs
+	.weak v4__enobufs
+	.type	v4__enobufs,@function
+v4__enobufs:
+.stabn 68,0,129,.LMa522-v4__enobufs
+.LMa522:
+	push %ebx
+	call .Lpic104
+.Lpic104:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic104],%ebx
+0:
+.stabn 68,0,129,.LMb522-v4__enobufs
+.LMb522:
+.LBB104:
+	mov $105,%eax
+	call v4__dpush@PLT
+.LBE104:
+.stabn 68,0,129,.LM526-v4__enobufs
+.LM526:
+	pop %ebx
+	ret
+.Lfe104:
+	.size	 v4__enobufs,.Lfe104-v4__enobufs
+.stabn	192,0,0,.LBB104-v4__enobufs
+.stabn	224,0,0,.LBE104-v4__enobufs
+.Lscope104:
+.stabs	"",36,0,0,.Lscope104-v4__enobufs
+.text
+	.align 4
+.stabs "v4__eisconn:F1",36,0,0,v4__eisconn
+	.weak v4__eisconn
+	.type	v4__eisconn,@function
+v4__eisconn:
+.stabn 68,0,130,.LMa527-v4__eisconn
+.LMa527:
+	push %ebx
+	call .Lpic105
+.Lpic105:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic105],%ebx
+0:
+.stabn 68,0,130,.LMb527-v4__eisconn
+.LMb527:
+.LBB105:
+	mov $106,%eax
+	call v4__dpush@PLT
+.LBE105:
+.stabn 68,0,130,.LM531-v4__eisconn
+.LM531:
+	pop %ebx
+	ret
+.Lfe105:
+	.size	 v4__eisconn,.Lfe105-v4__eisconn
+.stabn	192,0,0,.LBB105-v4__eisconn
+.stabn	224,0,0,.LBE105-v4__eisconn
+.Lscope105:
+.stabs	"",36,0,0,.Lscope105-v4__eisconn
+.text
+	.align 4
+.stabs "v4__enotconn:F1",36,0,0,v4__enotconn
+	.weak v4__enotconn
+	.type	v4__enotconn,@function
+v4__enotconn:
+.stabn 68,0,131,.LMa532-v4__enotconn
+.LMa532:
+	push %ebx
+	call .Lpic106
+.Lpic106:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic106],%ebx
+0:
+.stabn 68,0,131,.LMb532-v4__enotconn
+.LMb532:
+.LBB106:
+	mov $107,%eax
+	call v4__dpush@PLT
+.LBE106:
+.stabn 68,0,131,.LM536-v4__enotconn
+.LM536:
+	pop %ebx
+	ret
+.Lfe106:
+	.size	 v4__enotconn,.Lfe106-v4__enotconn
+.stabn	192,0,0,.LBB106-v4__enotconn
+.stabn	224,0,0,.LBE106-v4__enotconn
+.Lscope106:
+.stabs	"",36,0,0,.Lscope106-v4__enotconn
+.text
+	.align 4
+.stabs "v4__eshutdown:F1",36,0,0,v4__eshutdown
+	.weak v4__eshutdown
+	.type	v4__eshutdown,@function
+v4__eshutdown:
+.stabn 68,0,132,.LMa537-v4__eshutdown
+.LMa537:
+	push %ebx
+	call .Lpic107
+.Lpic107:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic107],%ebx
+0:
+.stabn 68,0,132,.LMb537-v4__eshutdown
+.LMb537:
+.LBB107:
+	mov $108,%eax
+	call v4__dpush@PLT
+.LBE107:
+.stabn 68,0,132,.LM541-v4__eshutdown
+.LM541:
+	pop %ebx
+	ret
+.Lfe107:
+	.size	 v4__eshutdown,.Lfe107-v4__eshutdown
+.stabn	192,0,0,.LBB107-v4__eshutdown
+.stabn	224,0,0,.LBE107-v4__eshutdown
+.Lscope107:
+.stabs	"",36,0,0,.Lscope107-v4__eshutdown
+.text
+	.align 4
+.stabs "v4__etoomanyrefs:F1",36,0,0,v4__etoomanyrefs
+	.weak v4__etoomanyrefs
+	.type	v4__etoomanyrefs,@function
+v4__etoomanyrefs:
+.stabn 68,0,133,.LMa542-v4__etoomanyrefs
+.LMa542:
+	push %ebx
+	call .Lpic108
+.Lpic108:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic108],%ebx
+0:
+.stabn 68,0,133,.LMb542-v4__etoomanyrefs
+.LMb542:
+.LBB108:
+	mov $109,%eax
+	call v4__dpush@PLT
+.LBE108:
+.stabn 68,0,133,.LM546-v4__etoomanyrefs
+.LM546:
+	pop %ebx
+	ret
+.Lfe108:
+	.size	 v4__etoomanyrefs,.Lfe108-v4__etoomanyrefs
+.stabn	192,0,0,.LBB108-v4__etoomanyrefs
+.stabn	224,0,0,.LBE108-v4__etoomanyrefs
+.Lscope108:
+.stabs	"",36,0,0,.Lscope108-v4__etoomanyrefs
+.text
+	.align 4
+.stabs "v4__etimedout:F1",36,0,0,v4__etimedout
+	.weak v4__etimedout
+	.type	v4__etimedout,@function
+v4__etimedout:
+.stabn 68,0,134,.LMa547-v4__etimedout
+.LMa547:
+	push %ebx
+	call .Lpic109
+.Lpic109:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic109],%ebx
+0:
+.stabn 68,0,134,.LMb547-v4__etimedout
+.LMb547:
+.LBB109:
+	mov $110,%eax
+	call v4__dpush@PLT
+.LBE109:
+.stabn 68,0,134,.LM551-v4__etimedout
+.LM551:
+	pop %ebx
+	ret
+.Lfe109:
+	.size	 v4__etimedout,.Lfe109-v4__etimedout
+.stabn	192,0,0,.LBB109-v4__etimedout
+.stabn	224,0,0,.LBE109-v4__etimedout
+.Lscope109:
+.stabs	"",36,0,0,.Lscope109-v4__etimedout
+.text
+	.align 4
+.stabs "v4__econnrefused:F1",36,0,0,v4__econnrefused
+	.weak v4__econnrefused
+	.type	v4__econnrefused,@function
+v4__econnrefused:
+.stabn 68,0,135,.LMa552-v4__econnrefused
+.LMa552:
+	push %ebx
+	call .Lpic110
+.Lpic110:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic110],%ebx
+0:
+.stabn 68,0,135,.LMb552-v4__econnrefused
+.LMb552:
+.LBB110:
+	mov $111,%eax
+	call v4__dpush@PLT
+.LBE110:
+.stabn 68,0,135,.LM556-v4__econnrefused
+.LM556:
+	pop %ebx
+	ret
+.Lfe110:
+	.size	 v4__econnrefused,.Lfe110-v4__econnrefused
+.stabn	192,0,0,.LBB110-v4__econnrefused
+.stabn	224,0,0,.LBE110-v4__econnrefused
+.Lscope110:
+.stabs	"",36,0,0,.Lscope110-v4__econnrefused
+.text
+	.align 4
+.stabs "v4__ehostdown:F1",36,0,0,v4__ehostdown
+	.weak v4__ehostdown
+	.type	v4__ehostdown,@function
+v4__ehostdown:
+.stabn 68,0,136,.LMa557-v4__ehostdown
+.LMa557:
+	push %ebx
+	call .Lpic111
+.Lpic111:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic111],%ebx
+0:
+.stabn 68,0,136,.LMb557-v4__ehostdown
+.LMb557:
+.LBB111:
+	mov $112,%eax
+	call v4__dpush@PLT
+.LBE111:
+.stabn 68,0,136,.LM561-v4__ehostdown
+.LM561:
+	pop %ebx
+	ret
+.Lfe111:
+	.size	 v4__ehostdown,.Lfe111-v4__ehostdown
+.stabn	192,0,0,.LBB111-v4__ehostdown
+.stabn	224,0,0,.LBE111-v4__ehostdown
+.Lscope111:
+.stabs	"",36,0,0,.Lscope111-v4__ehostdown
+.text
+	.align 4
+.stabs "v4__ehostunreach:F1",36,0,0,v4__ehostunreach
+	.weak v4__ehostunreach
+	.type	v4__ehostunreach,@function
+v4__ehostunreach:
+.stabn 68,0,137,.LMa562-v4__ehostunreach
+.LMa562:
+	push %ebx
+	call .Lpic112
+.Lpic112:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic112],%ebx
+0:
+.stabn 68,0,137,.LMb562-v4__ehostunreach
+.LMb562:
+.LBB112:
+	mov $113,%eax
+	call v4__dpush@PLT
+.LBE112:
+.stabn 68,0,137,.LM566-v4__ehostunreach
+.LM566:
+	pop %ebx
+	ret
+.Lfe112:
+	.size	 v4__ehostunreach,.Lfe112-v4__ehostunreach
+.stabn	192,0,0,.LBB112-v4__ehostunreach
+.stabn	224,0,0,.LBE112-v4__ehostunreach
+.Lscope112:
+.stabs	"",36,0,0,.Lscope112-v4__ehostunreach
+.text
+	.align 4
+.stabs "v4__ealready:F1",36,0,0,v4__ealready
+	.weak v4__ealready
+	.type	v4__ealready,@function
+v4__ealready:
+.stabn 68,0,138,.LMa567-v4__ealready
+.LMa567:
+	push %ebx
+	call .Lpic113
+.Lpic113:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic113],%ebx
+0:
+.stabn 68,0,138,.LMb567-v4__ealready
+.LMb567:
+.LBB113:
+	mov $114,%eax
+	call v4__dpush@PLT
+.LBE113:
+.stabn 68,0,138,.LM571-v4__ealready
+.LM571:
+	pop %ebx
+	ret
+.Lfe113:
+	.size	 v4__ealready,.Lfe113-v4__ealready
+.stabn	192,0,0,.LBB113-v4__ealready
+.stabn	224,0,0,.LBE113-v4__ealready
+.Lscope113:
+.stabs	"",36,0,0,.Lscope113-v4__ealready
+.text
+	.align 4
+.stabs "v4__einprogress:F1",36,0,0,v4__einprogress
+	.weak v4__einprogress
+	.type	v4__einprogress,@function
+v4__einprogress:
+.stabn 68,0,139,.LMa572-v4__einprogress
+.LMa572:
+	push %ebx
+	call .Lpic114
+.Lpic114:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic114],%ebx
+0:
+.stabn 68,0,139,.LMb572-v4__einprogress
+.LMb572:
+.LBB114:
+	mov $115,%eax
+	call v4__dpush@PLT
+.LBE114:
+.stabn 68,0,139,.LM576-v4__einprogress
+.LM576:
+	pop %ebx
+	ret
+.Lfe114:
+	.size	 v4__einprogress,.Lfe114-v4__einprogress
+.stabn	192,0,0,.LBB114-v4__einprogress
+.stabn	224,0,0,.LBE114-v4__einprogress
+.Lscope114:
+.stabs	"",36,0,0,.Lscope114-v4__einprogress
+.text
+	.align 4
+.stabs "v4__estale:F1",36,0,0,v4__estale
+	.weak v4__estale
+	.type	v4__estale,@function
+v4__estale:
+.stabn 68,0,140,.LMa577-v4__estale
+.LMa577:
+	push %ebx
+	call .Lpic115
+.Lpic115:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic115],%ebx
+0:
+.stabn 68,0,140,.LMb577-v4__estale
+.LMb577:
+.LBB115:
+	mov $116,%eax
+	call v4__dpush@PLT
+.LBE115:
+.stabn 68,0,140,.LM581-v4__estale
+.LM581:
+	pop %ebx
+	ret
+.Lfe115:
+	.size	 v4__estale,.Lfe115-v4__estale
+.stabn	192,0,0,.LBB115-v4__estale
+.stabn	224,0,0,.LBE115-v4__estale
+.Lscope115:
+.stabs	"",36,0,0,.Lscope115-v4__estale
+.text
+	.align 4
+.stabs "v4__euclean:F1",36,0,0,v4__euclean
+	.weak v4__euclean
+	.type	v4__euclean,@function
+v4__euclean:
+.stabn 68,0,141,.LMa582-v4__euclean
+.LMa582:
+	push %ebx
+	call .Lpic116
+.Lpic116:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic116],%ebx
+0:
+.stabn 68,0,141,.LMb582-v4__euclean
+.LMb582:
+.LBB116:
+	mov $117,%eax
+	call v4__dpush@PLT
+.LBE116:
+.stabn 68,0,141,.LM586-v4__euclean
+.LM586:
+	pop %ebx
+	ret
+.Lfe116:
+	.size	 v4__euclean,.Lfe116-v4__euclean
+.stabn	192,0,0,.LBB116-v4__euclean
+.stabn	224,0,0,.LBE116-v4__euclean
+.Lscope116:
+.stabs	"",36,0,0,.Lscope116-v4__euclean
+.text
+	.align 4
+.stabs "v4__enotnam:F1",36,0,0,v4__enotnam
+	.weak v4__enotnam
+	.type	v4__enotnam,@function
+v4__enotnam:
+.stabn 68,0,142,.LMa587-v4__enotnam
+.LMa587:
+	push %ebx
+	call .Lpic117
+.Lpic117:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic117],%ebx
+0:
+.stabn 68,0,142,.LMb587-v4__enotnam
+.LMb587:
+.LBB117:
+	mov $118,%eax
+	call v4__dpush@PLT
+.LBE117:
+.stabn 68,0,142,.LM591-v4__enotnam
+.LM591:
+	pop %ebx
+	ret
+.Lfe117:
+	.size	 v4__enotnam,.Lfe117-v4__enotnam
+.stabn	192,0,0,.LBB117-v4__enotnam
+.stabn	224,0,0,.LBE117-v4__enotnam
+.Lscope117:
+.stabs	"",36,0,0,.Lscope117-v4__enotnam
+.text
+	.align 4
+.stabs "v4__enavail:F1",36,0,0,v4__enavail
+	.weak v4__enavail
+	.type	v4__enavail,@function
+v4__enavail:
+.stabn 68,0,143,.LMa592-v4__enavail
+.LMa592:
+	push %ebx
+	call .Lpic118
+.Lpic118:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic118],%ebx
+0:
+.stabn 68,0,143,.LMb592-v4__enavail
+.LMb592:
+.LBB118:
+	mov $119,%eax
+	call v4__dpush@PLT
+.LBE118:
+.stabn 68,0,143,.LM596-v4__enavail
+.LM596:
+	pop %ebx
+	ret
+.Lfe118:
+	.size	 v4__enavail,.Lfe118-v4__enavail
+.stabn	192,0,0,.LBB118-v4__enavail
+.stabn	224,0,0,.LBE118-v4__enavail
+.Lscope118:
+.stabs	"",36,0,0,.Lscope118-v4__enavail
+.text
+	.align 4
+.stabs "v4__eisnam:F1",36,0,0,v4__eisnam
+	.weak v4__eisnam
+	.type	v4__eisnam,@function
+v4__eisnam:
+.stabn 68,0,144,.LMa597-v4__eisnam
+.LMa597:
+	push %ebx
+	call .Lpic119
+.Lpic119:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic119],%ebx
+0:
+.stabn 68,0,144,.LMb597-v4__eisnam
+.LMb597:
+.LBB119:
+	mov $120,%eax
+	call v4__dpush@PLT
+.LBE119:
+.stabn 68,0,144,.LM601-v4__eisnam
+.LM601:
+	pop %ebx
+	ret
+.Lfe119:
+	.size	 v4__eisnam,.Lfe119-v4__eisnam
+.stabn	192,0,0,.LBB119-v4__eisnam
+.stabn	224,0,0,.LBE119-v4__eisnam
+.Lscope119:
+.stabs	"",36,0,0,.Lscope119-v4__eisnam
+.text
+	.align 4
+.stabs "v4__eremoteio:F1",36,0,0,v4__eremoteio
+	.weak v4__eremoteio
+	.type	v4__eremoteio,@function
+v4__eremoteio:
+.stabn 68,0,145,.LMa602-v4__eremoteio
+.LMa602:
+	push %ebx
+	call .Lpic120
+.Lpic120:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic120],%ebx
+0:
+.stabn 68,0,145,.LMb602-v4__eremoteio
+.LMb602:
+.LBB120:
+	mov $121,%eax
+	call v4__dpush@PLT
+.LBE120:
+.stabn 68,0,145,.LM606-v4__eremoteio
+.LM606:
+	pop %ebx
+	ret
+.Lfe120:
+	.size	 v4__eremoteio,.Lfe120-v4__eremoteio
+.stabn	192,0,0,.LBB120-v4__eremoteio
+.stabn	224,0,0,.LBE120-v4__eremoteio
+.Lscope120:
+.stabs	"",36,0,0,.Lscope120-v4__eremoteio
+.text
+	.align 4
+.stabs "v4__edquot:F1",36,0,0,v4__edquot
+	.weak v4__edquot
+	.type	v4__edquot,@function
+v4__edquot:
+.stabn 68,0,146,.LMa607-v4__edquot
+.LMa607:
+	push %ebx
+	call .Lpic121
+.Lpic121:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic121],%ebx
+0:
+.stabn 68,0,146,.LMb607-v4__edquot
+.LMb607:
+.LBB121:
+	mov $122,%eax
+	call v4__dpush@PLT
+.LBE121:
+.stabn 68,0,146,.LM611-v4__edquot
+.LM611:
+	pop %ebx
+	ret
+.Lfe121:
+	.size	 v4__edquot,.Lfe121-v4__edquot
+.stabn	192,0,0,.LBB121-v4__edquot
+.stabn	224,0,0,.LBE121-v4__edquot
+.Lscope121:
+.stabs	"",36,0,0,.Lscope121-v4__edquot
+.text
+	.align 4
+.stabs "v4__enomedium:F1",36,0,0,v4__enomedium
+	.weak v4__enomedium
+	.type	v4__enomedium,@function
+v4__enomedium:
+.stabn 68,0,147,.LMa612-v4__enomedium
+.LMa612:
+	push %ebx
+	call .Lpic122
+.Lpic122:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic122],%ebx
+0:
+.stabn 68,0,147,.LMb612-v4__enomedium
+.LMb612:
+.LBB122:
+	mov $123,%eax
+	call v4__dpush@PLT
+.LBE122:
+.stabn 68,0,147,.LM616-v4__enomedium
+.LM616:
+	pop %ebx
+	ret
+.Lfe122:
+	.size	 v4__enomedium,.Lfe122-v4__enomedium
+.stabn	192,0,0,.LBB122-v4__enomedium
+.stabn	224,0,0,.LBE122-v4__enomedium
+.Lscope122:
+.stabs	"",36,0,0,.Lscope122-v4__enomedium
+.text
+	.align 4
+.stabs "v4__emediumtype:F1",36,0,0,v4__emediumtype
+	.weak v4__emediumtype
+	.type	v4__emediumtype,@function
+v4__emediumtype:
+.stabn 68,0,148,.LMa617-v4__emediumtype
+.LMa617:
+	push %ebx
+	call .Lpic123
+.Lpic123:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic123],%ebx
+0:
+.stabn 68,0,148,.LMb617-v4__emediumtype
+.LMb617:
+.LBB123:
+	mov $124,%eax
+	call v4__dpush@PLT
+.LBE123:
+.stabn 68,0,148,.LM621-v4__emediumtype
+.LM621:
+	pop %ebx
+	ret
+.Lfe123:
+	.size	 v4__emediumtype,.Lfe123-v4__emediumtype
+.stabn	192,0,0,.LBB123-v4__emediumtype
+.stabn	224,0,0,.LBE123-v4__emediumtype
+.Lscope123:
+.stabs	"",36,0,0,.Lscope123-v4__emediumtype
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,636 @@
+	.file	"except.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"except.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC1:
+	.string ": "
+.LC16:
+	.string "Internal error: double exception, abort forced"
+.LC0:
+	.string "Uncaught exception at "
+.LC2:
+	.string "abort"
+.LC8:
+	.string "division by zero"
+.LC15:
+	.string "exception code "
+.LC10:
+	.string "floating-point divide by zero"
+.LC11:
+	.string "floating-point stack overflow"
+.LC12:
+	.string "floating-point stack underflow"
+.LC13:
+	.string "i/o error"
+.LC9:
+	.string "invalid numeric argument"
+.LC14:
+	.string "out of memory"
+.LC3:
+	.string "quoted abort"
+.LC6:
+	.string "return stack overflow"
+.LC7:
+	.string "return stack underflow (uncatchable)"
+.LC4:
+	.string "stack overflow"
+.LC5:
+	.string "stack underflow"
+.stabs	"v4___Parenehflag_Closeparen:G2",40,0,0,v4___Parenehflag_Closeparen
+	.comm  v4___Parenehflag_Closeparen,4,4
+.stabs	"v4___Parenehhandler_Closeparen:G2",40,0,0,v4___Parenehhandler_Closeparen
+	.comm  v4___Parenehhandler_Closeparen,4,4
+.text
+	.align 4
+.stabs "v4___Parenehrestore_Closeparen:F1",36,0,0,v4___Parenehrestore_Closeparen
+	.weak v4___Parenehrestore_Closeparen
+	.type	v4___Parenehrestore_Closeparen,@function
+v4___Parenehrestore_Closeparen:
+.stabn 68,0,72,.LMa0-v4___Parenehrestore_Closeparen
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,72,.LMb0-v4___Parenehrestore_Closeparen
+.LMb0:
+.LBB0:
+#APP
+    call v4__dpop@PLT
+    mov -4(%eax),%ebx
+    mov (%eax),%ebp
+    lea 8(%eax),%esp
+    mov 4(%eax),%eax
+    jmp *%eax
+    forth_pic.=0b-0b
+#NO_APP
+.LBE0:
+.stabn 68,0,82,.LM8-v4___Parenehrestore_Closeparen
+.LM8:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4___Parenehrestore_Closeparen,.Lfe0-v4___Parenehrestore_Closeparen
+.stabn	192,0,0,.LBB0-v4___Parenehrestore_Closeparen
+.stabn	224,0,0,.LBE0-v4___Parenehrestore_Closeparen
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4___Parenehrestore_Closeparen
+.text
+	.align 4
+.stabs "v4___Parenehcontext_Closeparen:F1",36,0,0,v4___Parenehcontext_Closeparen
+	.weak v4___Parenehcontext_Closeparen
+	.type	v4___Parenehcontext_Closeparen,@function
+v4___Parenehcontext_Closeparen:
+.stabn 68,0,93,.LMa9-v4___Parenehcontext_Closeparen
+.LMa9:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic1
+.Lpic1:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic1],%ebx
+0:
+.stabn 68,0,93,.LMb9-v4___Parenehcontext_Closeparen
+.LMb9:
+.LBB1:
+#APP
+    mov (%ebp),%eax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE1:
+.stabn 68,0,98,.LM13-v4___Parenehcontext_Closeparen
+.LM13:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe1:
+	.size	 v4___Parenehcontext_Closeparen,.Lfe1-v4___Parenehcontext_Closeparen
+.stabn	192,0,0,.LBB1-v4___Parenehcontext_Closeparen
+.stabn	224,0,0,.LBE1-v4___Parenehcontext_Closeparen
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4___Parenehcontext_Closeparen
+.text
+	.align 4
+.stabs "v4__getehhandler:F1",36,0,0,v4__getehhandler
+	.weak v4__getehhandler
+	.type	v4__getehhandler,@function
+v4__getehhandler:
+.stabn 68,0,103,.LMa14-v4__getehhandler
+.LMa14:
+	push %ebx
+	call .Lpic3
+.Lpic3:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic3],%ebx
+0:
+.stabn 68,0,103,.LMb14-v4__getehhandler
+.LMb14:
+.LBB3:
+	mov v4___Parenehhandler_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+.LBE3:
+.stabn 68,0,104,.LM21-v4__getehhandler
+.LM21:
+	pop %ebx
+	ret
+.Lfe3:
+	.size	 v4__getehhandler,.Lfe3-v4__getehhandler
+.stabn	192,0,0,.LBB3-v4__getehhandler
+.stabn	224,0,0,.LBE3-v4__getehhandler
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4__getehhandler
+.text
+	.align 4
+.stabs "v4_catch:F1",36,0,0,v4_catch
+	.weak v4_catch
+	.type	v4_catch,@function
+v4_catch:
+.stabn 68,0,106,.LMa22-v4_catch
+.LMa22:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic5
+.Lpic5:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic5],%ebx
+0:
+.stabn 68,0,106,.LMb22-v4_catch
+.LMb22:
+.LBB5:
+.stabn 68,0,107,.LM23-v4_catch
+.LM23:
+	call v4_sp_Fetch@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,108,.LM25-v4_catch
+.LM25:
+	call v4__fp_Fetch@PLT
+	call v4_Greaterr@PLT
+	mov v4___Parenehhandler_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,110,.LM33-v4_catch
+.LM33:
+	call v4___Parenehcontext_Closeparen@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,111,.LM35-v4_catch
+.LM35:
+	call v4_rp_Fetch@PLT
+	call v4__dpop@PLT
+	mov v4___Parenehhandler_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.stabn 68,0,113,.LM41-v4_catch
+.LM41:
+	call v4_execute@PLT
+.stabn 68,0,115,.LM42-v4_catch
+.LM42:
+	call v4_rdrop@PLT
+.stabn 68,0,116,.LM43-v4_catch
+.LM43:
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	mov v4___Parenehhandler_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.stabn 68,0,117,.LM49-v4_catch
+.LM49:
+	call v4_z2rdrop@PLT
+.stabn 68,0,118,.LM50-v4_catch
+.LM50:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.LBE5:
+.stabn 68,0,118,.LM53-v4_catch
+.LM53:
+	pop %ebx
+	leave
+	ret
+.Lfe5:
+	.size	 v4_catch,.Lfe5-v4_catch
+.stabn	192,0,0,.LBB5-v4_catch
+.stabn	224,0,0,.LBE5-v4_catch
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4_catch
+.text
+	.align 4
+.stabs "v4___Parenehuncaught_Closeparen:F1",36,0,0,v4___Parenehuncaught_Closeparen
+	.weak v4___Parenehuncaught_Closeparen
+	.type	v4___Parenehuncaught_Closeparen,@function
+v4___Parenehuncaught_Closeparen:
+.stabn 68,0,120,.LMa54-v4___Parenehuncaught_Closeparen
+.LMa54:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic15
+.Lpic15:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic15],%ebx
+0:
+.stabn 68,0,120,.LMb54-v4___Parenehuncaught_Closeparen
+.LMb54:
+.LBB15:
+.stabn 68,0,121,.LM55-v4___Parenehuncaught_Closeparen
+.LM55:
+	call v4_dup@PLT
+	mov $-6,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	jne .L4
+.stabn 68,0,122,.LM64-v4___Parenehuncaught_Closeparen
+.LM64:
+	xor %eax,%eax
+	mov v4___Parenehhandler_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.L4:
+	mov v4___Parenehhandler_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	test %eax,%eax
+	je .L5
+	jmp .L3
+.L5:
+.stabn 68,0,126,.LM81-v4___Parenehuncaught_Closeparen
+.LM81:
+	call v4_dup@PLT
+	mov $-56,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	jne .L6
+	call v4_drop@PLT
+	call v4__quit@PLT
+.L6:
+.stabn 68,0,128,.LM93-v4___Parenehuncaught_Closeparen
+.LM93:
+	call v4_stderr@PLT
+	call v4_outfile_Minusid@PLT
+	call v4_Store@PLT
+.stabn 68,0,130,.LM96-v4___Parenehuncaught_Closeparen
+.LM96:
+	call v4_cr@PLT
+	lea .LC0@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $22,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.stabn 68,0,131,.LM102-v4___Parenehuncaught_Closeparen
+.LM102:
+	call v4___Parenehcontext_Closeparen@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	add $4,%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+.stabn 68,0,133,.LM109-v4___Parenehuncaught_Closeparen
+.LM109:
+	call v4_hex@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4_Dotr@PLT
+	lea .LC1@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	mov $-10,%edx
+	cmp %edx,%eax
+	jl .L37
+	mov $-4,%edx
+	cmp %edx,%eax
+	jl .L38
+	mov $-2,%edx
+	cmp %edx,%eax
+	jl .L39
+	mov $-2,%edx
+	cmp %edx,%eax
+	je .L25
+	xor %edx,%edx
+	dec %edx
+	cmp %edx,%eax
+	je .L24
+	jmp .L20
+.L39:
+	mov $-4,%edx
+	cmp %edx,%eax
+	je .L27
+	mov $-3,%edx
+	cmp %edx,%eax
+	je .L26
+	jmp .L20
+.L38:
+	mov $-10,%edx
+	cmp %edx,%eax
+	je .L30
+	mov $-6,%edx
+	cmp %edx,%eax
+	je .L29
+	mov $-5,%edx
+	cmp %edx,%eax
+	je .L28
+	jmp .L20
+.L37:
+	mov $-44,%edx
+	cmp %edx,%eax
+	jl .L40
+	mov $-44,%edx
+	cmp %edx,%eax
+	je .L33
+	mov $-42,%edx
+	cmp %edx,%eax
+	je .L32
+	mov $-24,%edx
+	cmp %edx,%eax
+	je .L31
+	jmp .L20
+.L40:
+	mov $-2048,%edx
+	cmp %edx,%eax
+	je .L36
+	mov $-57,%edx
+	cmp %edx,%eax
+	je .L35
+	mov $-45,%edx
+	cmp %edx,%eax
+	je .L34
+	jmp .L20
+.L24:
+	lea .LC2@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $5,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L8:
+.L25:
+	lea .LC3@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $12,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L9:
+.L26:
+	lea .LC4@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $14,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L10:
+.L27:
+	lea .LC5@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $15,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L11:
+.L28:
+	lea .LC6@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $21,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L12:
+.L29:
+	lea .LC7@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $36,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L13:
+.L30:
+	lea .LC8@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $16,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L14:
+.L31:
+	lea .LC9@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $24,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L15:
+.L32:
+	lea .LC10@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $29,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L16:
+.L33:
+	lea .LC11@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $29,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L17:
+.L34:
+	lea .LC12@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $30,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L18:
+.L35:
+	lea .LC13@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $9,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L19:
+.L36:
+	lea .LC14@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $13,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L7
+.L20:
+.stabn 68,0,150,.LM330-v4___Parenehuncaught_Closeparen
+.LM330:
+	lea .LC15@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $15,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.stabn 68,0,151,.LM335-v4___Parenehuncaught_Closeparen
+.LM335:
+	call v4_decimal@PLT
+	call v4_dup@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4_Dotr@PLT
+.L7:
+	call v4__dpop@PLT
+	call v4_cr@PLT
+	mov v4__abort@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.L3:
+.LBE15:
+.stabn 68,0,153,.LM345-v4___Parenehuncaught_Closeparen
+.LM345:
+	pop %ebx
+	leave
+	ret
+.Lfe15:
+	.size	 v4___Parenehuncaught_Closeparen,.Lfe15-v4___Parenehuncaught_Closeparen
+.stabn	192,0,0,.LBB15-v4___Parenehuncaught_Closeparen
+.stabn	224,0,0,.LBE15-v4___Parenehuncaught_Closeparen
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4___Parenehuncaught_Closeparen
+.text
+	.align 4
+.stabs "v4_throw:F1",36,0,0,v4_throw
+	.weak v4_throw
+	.type	v4_throw,@function
+v4_throw:
+.stabn 68,0,157,.LMa346-v4_throw
+.LMa346:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic30
+.Lpic30:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic30],%ebx
+0:
+.stabn 68,0,157,.LMb346-v4_throw
+.LMb346:
+.LBB30:
+.stabn 68,0,158,.LM347-v4_throw
+.LM347:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L22
+	mov v4___Parenehflag_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	test %eax,%eax
+	je .L23
+.stabn 68,0,160,.LM357-v4_throw
+.LM357:
+	call v4_cr@PLT
+	lea .LC16@GOTOFF(%ebx),%eax
+	call v4__dpush@PLT
+	mov $46,%eax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.stabn 68,0,161,.LM363-v4_throw
+.LM363:
+	call v4_cr@PLT
+	call v4__abort@PLT
+.L23:
+.stabn 68,0,163,.LM366-v4_throw
+.LM366:
+	call v4__setstackeh@PLT
+	xor %eax,%eax
+	dec %eax
+	mov v4___Parenehflag_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.stabn 68,0,166,.LM375-v4_throw
+.LM375:
+	call v4___Parenehuncaught_Closeparen@PLT
+	mov v4___Parenehhandler_Closeparen@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+	call v4_rp_Store@PLT
+.stabn 68,0,169,.LM382-v4_throw
+.LM382:
+	call v4_r_Greater@PLT
+.stabn 68,0,170,.LM383-v4_throw
+.LM383:
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	mov v4___Parenehhandler_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.stabn 68,0,171,.LM389-v4_throw
+.LM389:
+	call v4_r_Greater@PLT
+	call v4__fp_Store@PLT
+.stabn 68,0,172,.LM391-v4_throw
+.LM391:
+	call v4_r_Greater@PLT
+	call v4_rot@PLT
+	call v4_rot@PLT
+	call v4_z2_Greaterr@PLT
+.stabn 68,0,173,.LM395-v4_throw
+.LM395:
+	call v4_sp_Store@PLT
+	call v4_drop@PLT
+.stabn 68,0,174,.LM397-v4_throw
+.LM397:
+	call v4_z2r_Greater@PLT
+.stabn 68,0,176,.LM398-v4_throw
+.LM398:
+	call v4__clrstackeh@PLT
+	xor %eax,%eax
+	mov v4___Parenehflag_Closeparen@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.stabn 68,0,179,.LM407-v4_throw
+.LM407:
+	mov v4___Parenehrestore_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.L22:
+	mov v4_drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE30:
+.stabn 68,0,180,.LM413-v4_throw
+.LM413:
+	pop %ebx
+	leave
+	ret
+.Lfe30:
+	.size	 v4_throw,.Lfe30-v4_throw
+.stabn	192,0,0,.LBB30-v4_throw
+.stabn	224,0,0,.LBE30-v4_throw
+.Lscope30:
+.stabs	"",36,0,0,.Lscope30-v4_throw
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
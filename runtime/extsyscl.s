@@ -0,0 +1,2550 @@
+	.file	"extsyscl.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"extsyscl.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4__ptrace:F1",36,0,0,v4__ptrace
+	.weak v4__ptrace
+	.type	v4__ptrace,@function
+v4__ptrace:
+.stabn 68,0,28,.LMa0-v4__ptrace
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,28,.LMb0-v4__ptrace
+.LMb0:
+.LBB0:
+	mov $26,%eax
+	call v4__dpush@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE0:
+.stabn 68,0,28,.LM8-v4__ptrace
+.LM8:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4__ptrace,.Lfe0-v4__ptrace
+.stabn	192,0,0,.LBB0-v4__ptrace
+.stabn	224,0,0,.LBE0-v4__ptrace
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4__ptrace
+.text
+	.align 4
+.stabs "v4__sync:F1",36,0,0,v4__sync
+	.weak v4__sync
+	.type	v4__sync,@function
+v4__sync:
+.stabn 68,0,29,.LMa9-v4__sync
+.LMa9:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic3
+.Lpic3:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic3],%ebx
+0:
+.stabn 68,0,29,.LMb9-v4__sync
+.LMb9:
+.LBB3:
+	mov $36,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE3:
+.stabn 68,0,29,.LM17-v4__sync
+.LM17:
+	pop %ebx
+	leave
+	ret
+.Lfe3:
+	.size	 v4__sync,.Lfe3-v4__sync
+.stabn	192,0,0,.LBB3-v4__sync
+.stabn	224,0,0,.LBE3-v4__sync
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4__sync
+.text
+	.align 4
+.stabs "v4__acct:F1",36,0,0,v4__acct
+	.weak v4__acct
+	.type	v4__acct,@function
+v4__acct:
+.stabn 68,0,30,.LMa18-v4__acct
+.LMa18:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic4
+.Lpic4:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic4],%ebx
+0:
+.stabn 68,0,30,.LMb18-v4__acct
+.LMb18:
+.LBB4:
+	mov $51,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE4:
+.stabn 68,0,30,.LM26-v4__acct
+.LM26:
+	pop %ebx
+	leave
+	ret
+.Lfe4:
+	.size	 v4__acct,.Lfe4-v4__acct
+.stabn	192,0,0,.LBB4-v4__acct
+.stabn	224,0,0,.LBE4-v4__acct
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4__acct
+.text
+	.align 4
+.stabs "v4__umount:F1",36,0,0,v4__umount
+	.weak v4__umount
+	.type	v4__umount,@function
+v4__umount:
+.stabn 68,0,31,.LMa27-v4__umount
+.LMa27:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic5
+.Lpic5:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic5],%ebx
+0:
+.stabn 68,0,31,.LMb27-v4__umount
+.LMb27:
+.LBB5:
+	mov $52,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE5:
+.stabn 68,0,31,.LM35-v4__umount
+.LM35:
+	pop %ebx
+	leave
+	ret
+.Lfe5:
+	.size	 v4__umount,.Lfe5-v4__umount
+.stabn	192,0,0,.LBB5-v4__umount
+.stabn	224,0,0,.LBE5-v4__umount
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4__umount
+.text
+	.align 4
+.stabs "v4__ustat:F1",36,0,0,v4__ustat
+	.weak v4__ustat
+	.type	v4__ustat,@function
+v4__ustat:
+.stabn 68,0,32,.LMa36-v4__ustat
+.LMa36:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic6
+.Lpic6:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic6],%ebx
+0:
+.stabn 68,0,32,.LMb36-v4__ustat
+.LMb36:
+.LBB6:
+	mov $62,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE6:
+.stabn 68,0,32,.LM44-v4__ustat
+.LM44:
+	pop %ebx
+	leave
+	ret
+.Lfe6:
+	.size	 v4__ustat,.Lfe6-v4__ustat
+.stabn	192,0,0,.LBB6-v4__ustat
+.stabn	224,0,0,.LBE6-v4__ustat
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4__ustat
+.text
+	.align 4
+.stabs "v4__sgetmask:F1",36,0,0,v4__sgetmask
+	.weak v4__sgetmask
+	.type	v4__sgetmask,@function
+v4__sgetmask:
+.stabn 68,0,33,.LMa45-v4__sgetmask
+.LMa45:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic7
+.Lpic7:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic7],%ebx
+0:
+.stabn 68,0,33,.LMb45-v4__sgetmask
+.LMb45:
+.LBB7:
+	mov $68,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE7:
+.stabn 68,0,33,.LM53-v4__sgetmask
+.LM53:
+	pop %ebx
+	leave
+	ret
+.Lfe7:
+	.size	 v4__sgetmask,.Lfe7-v4__sgetmask
+.stabn	192,0,0,.LBB7-v4__sgetmask
+.stabn	224,0,0,.LBE7-v4__sgetmask
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4__sgetmask
+.text
+	.align 4
+.stabs "v4__ssetmask:F1",36,0,0,v4__ssetmask
+	.weak v4__ssetmask
+	.type	v4__ssetmask,@function
+v4__ssetmask:
+.stabn 68,0,34,.LMa54-v4__ssetmask
+.LMa54:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic8
+.Lpic8:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic8],%ebx
+0:
+.stabn 68,0,34,.LMb54-v4__ssetmask
+.LMb54:
+.LBB8:
+	mov $69,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE8:
+.stabn 68,0,34,.LM62-v4__ssetmask
+.LM62:
+	pop %ebx
+	leave
+	ret
+.Lfe8:
+	.size	 v4__ssetmask,.Lfe8-v4__ssetmask
+.stabn	192,0,0,.LBB8-v4__ssetmask
+.stabn	224,0,0,.LBE8-v4__ssetmask
+.Lscope8:
+.stabs	"",36,0,0,.Lscope8-v4__ssetmask
+.text
+	.align 4
+.stabs "v4__sethostname:F1",36,0,0,v4__sethostname
+	.weak v4__sethostname
+	.type	v4__sethostname,@function
+v4__sethostname:
+.stabn 68,0,35,.LMa63-v4__sethostname
+.LMa63:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic9
+.Lpic9:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic9],%ebx
+0:
+.stabn 68,0,35,.LMb63-v4__sethostname
+.LMb63:
+.LBB9:
+	mov $74,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE9:
+.stabn 68,0,35,.LM71-v4__sethostname
+.LM71:
+	pop %ebx
+	leave
+	ret
+.Lfe9:
+	.size	 v4__sethostname,.Lfe9-v4__sethostname
+.stabn	192,0,0,.LBB9-v4__sethostname
+.stabn	224,0,0,.LBE9-v4__sethostname
+.Lscope9:
+.stabs	"",36,0,0,.Lscope9-v4__sethostname
+.text
+	.align 4
+.stabs "v4__setrlimit:F1",36,0,0,v4__setrlimit
+	.weak v4__setrlimit
+	.type	v4__setrlimit,@function
+v4__setrlimit:
+.stabn 68,0,36,.LMa72-v4__setrlimit
+.LMa72:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic10
+.Lpic10:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic10],%ebx
+0:
+.stabn 68,0,36,.LMb72-v4__setrlimit
+.LMb72:
+.LBB10:
+	mov $75,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE10:
+.stabn 68,0,36,.LM80-v4__setrlimit
+.LM80:
+	pop %ebx
+	leave
+	ret
+.Lfe10:
+	.size	 v4__setrlimit,.Lfe10-v4__setrlimit
+.stabn	192,0,0,.LBB10-v4__setrlimit
+.stabn	224,0,0,.LBE10-v4__setrlimit
+.Lscope10:
+.stabs	"",36,0,0,.Lscope10-v4__setrlimit
+.text
+	.align 4
+.stabs "v4__getrusage:F1",36,0,0,v4__getrusage
+	.weak v4__getrusage
+	.type	v4__getrusage,@function
+v4__getrusage:
+.stabn 68,0,37,.LMa81-v4__getrusage
+.LMa81:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic11
+.Lpic11:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic11],%ebx
+0:
+.stabn 68,0,37,.LMb81-v4__getrusage
+.LMb81:
+.LBB11:
+	mov $77,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE11:
+.stabn 68,0,37,.LM89-v4__getrusage
+.LM89:
+	pop %ebx
+	leave
+	ret
+.Lfe11:
+	.size	 v4__getrusage,.Lfe11-v4__getrusage
+.stabn	192,0,0,.LBB11-v4__getrusage
+.stabn	224,0,0,.LBE11-v4__getrusage
+.Lscope11:
+.stabs	"",36,0,0,.Lscope11-v4__getrusage
+.text
+	.align 4
+.stabs "v4__gettimeofday:F1",36,0,0,v4__gettimeofday
+	.weak v4__gettimeofday
+	.type	v4__gettimeofday,@function
+v4__gettimeofday:
+.stabn 68,0,38,.LMa90-v4__gettimeofday
+.LMa90:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic12
+.Lpic12:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic12],%ebx
+0:
+.stabn 68,0,38,.LMb90-v4__gettimeofday
+.LMb90:
+.LBB12:
+	mov $78,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE12:
+.stabn 68,0,38,.LM98-v4__gettimeofday
+.LM98:
+	pop %ebx
+	leave
+	ret
+.Lfe12:
+	.size	 v4__gettimeofday,.Lfe12-v4__gettimeofday
+.stabn	192,0,0,.LBB12-v4__gettimeofday
+.stabn	224,0,0,.LBE12-v4__gettimeofday
+.Lscope12:
+.stabs	"",36,0,0,.Lscope12-v4__gettimeofday
+.text
+	.align 4
+.stabs "v4__settimeofday:F1",36,0,0,v4__settimeofday
+	.weak v4__settimeofday
+	.type	v4__settimeofday,@function
+v4__settimeofday:
+.stabn 68,0,39,.LMa99-v4__settimeofday
+.LMa99:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic13
+.Lpic13:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic13],%ebx
+0:
+.stabn 68,0,39,.LMb99-v4__settimeofday
+.LMb99:
+.LBB13:
+	mov $79,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE13:
+.stabn 68,0,39,.LM107-v4__settimeofday
+.LM107:
+	pop %ebx
+	leave
+	ret
+.Lfe13:
+	.size	 v4__settimeofday,.Lfe13-v4__settimeofday
+.stabn	192,0,0,.LBB13-v4__settimeofday
+.stabn	224,0,0,.LBE13-v4__settimeofday
+.Lscope13:
+.stabs	"",36,0,0,.Lscope13-v4__settimeofday
+.text
+	.align 4
+.stabs "v4__getgroups16:F1",36,0,0,v4__getgroups16
+	.weak v4__getgroups16
+	.type	v4__getgroups16,@function
+v4__getgroups16:
+.stabn 68,0,40,.LMa108-v4__getgroups16
+.LMa108:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic14
+.Lpic14:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic14],%ebx
+0:
+.stabn 68,0,40,.LMb108-v4__getgroups16
+.LMb108:
+.LBB14:
+	mov $80,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE14:
+.stabn 68,0,40,.LM116-v4__getgroups16
+.LM116:
+	pop %ebx
+	leave
+	ret
+.Lfe14:
+	.size	 v4__getgroups16,.Lfe14-v4__getgroups16
+.stabn	192,0,0,.LBB14-v4__getgroups16
+.stabn	224,0,0,.LBE14-v4__getgroups16
+.Lscope14:
+.stabs	"",36,0,0,.Lscope14-v4__getgroups16
+.text
+	.align 4
+.stabs "v4__setgroups16:F1",36,0,0,v4__setgroups16
+	.weak v4__setgroups16
+	.type	v4__setgroups16,@function
+v4__setgroups16:
+.stabn 68,0,41,.LMa117-v4__setgroups16
+.LMa117:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic15
+.Lpic15:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic15],%ebx
+0:
+.stabn 68,0,41,.LMb117-v4__setgroups16
+.LMb117:
+.LBB15:
+	mov $81,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE15:
+.stabn 68,0,41,.LM125-v4__setgroups16
+.LM125:
+	pop %ebx
+	leave
+	ret
+.Lfe15:
+	.size	 v4__setgroups16,.Lfe15-v4__setgroups16
+.stabn	192,0,0,.LBB15-v4__setgroups16
+.stabn	224,0,0,.LBE15-v4__setgroups16
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4__setgroups16
+.text
+	.align 4
+.stabs "v4__uselib:F1",36,0,0,v4__uselib
+	.weak v4__uselib
+	.type	v4__uselib,@function
+v4__uselib:
+.stabn 68,0,42,.LMa126-v4__uselib
+.LMa126:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic16
+.Lpic16:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic16],%ebx
+0:
+.stabn 68,0,42,.LMb126-v4__uselib
+.LMb126:
+.LBB16:
+	mov $86,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE16:
+.stabn 68,0,42,.LM134-v4__uselib
+.LM134:
+	pop %ebx
+	leave
+	ret
+.Lfe16:
+	.size	 v4__uselib,.Lfe16-v4__uselib
+.stabn	192,0,0,.LBB16-v4__uselib
+.stabn	224,0,0,.LBE16-v4__uselib
+.Lscope16:
+.stabs	"",36,0,0,.Lscope16-v4__uselib
+.text
+	.align 4
+.stabs "v4__swapon:F1",36,0,0,v4__swapon
+	.weak v4__swapon
+	.type	v4__swapon,@function
+v4__swapon:
+.stabn 68,0,43,.LMa135-v4__swapon
+.LMa135:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic17
+.Lpic17:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic17],%ebx
+0:
+.stabn 68,0,43,.LMb135-v4__swapon
+.LMb135:
+.LBB17:
+	mov $87,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE17:
+.stabn 68,0,43,.LM143-v4__swapon
+.LM143:
+	pop %ebx
+	leave
+	ret
+.Lfe17:
+	.size	 v4__swapon,.Lfe17-v4__swapon
+.stabn	192,0,0,.LBB17-v4__swapon
+.stabn	224,0,0,.LBE17-v4__swapon
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-v4__swapon
+.text
+	.align 4
+.stabs "v4__reboot:F1",36,0,0,v4__reboot
+	.weak v4__reboot
+	.type	v4__reboot,@function
+v4__reboot:
+.stabn 68,0,44,.LMa144-v4__reboot
+.LMa144:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic18
+.Lpic18:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic18],%ebx
+0:
+.stabn 68,0,44,.LMb144-v4__reboot
+.LMb144:
+.LBB18:
+	mov $88,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE18:
+.stabn 68,0,44,.LM152-v4__reboot
+.LM152:
+	pop %ebx
+	leave
+	ret
+.Lfe18:
+	.size	 v4__reboot,.Lfe18-v4__reboot
+.stabn	192,0,0,.LBB18-v4__reboot
+.stabn	224,0,0,.LBE18-v4__reboot
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4__reboot
+.text
+	.align 4
+.stabs "v4__statfs:F1",36,0,0,v4__statfs
+	.weak v4__statfs
+	.type	v4__statfs,@function
+v4__statfs:
+.stabn 68,0,45,.LMa153-v4__statfs
+.LMa153:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic19
+.Lpic19:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic19],%ebx
+0:
+.stabn 68,0,45,.LMb153-v4__statfs
+.LMb153:
+.LBB19:
+	mov $99,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE19:
+.stabn 68,0,45,.LM161-v4__statfs
+.LM161:
+	pop %ebx
+	leave
+	ret
+.Lfe19:
+	.size	 v4__statfs,.Lfe19-v4__statfs
+.stabn	192,0,0,.LBB19-v4__statfs
+.stabn	224,0,0,.LBE19-v4__statfs
+.Lscope19:
+.stabs	"",36,0,0,.Lscope19-v4__statfs
+.text
+	.align 4
+.stabs "v4__fstatfs:F1",36,0,0,v4__fstatfs
+	.weak v4__fstatfs
+	.type	v4__fstatfs,@function
+v4__fstatfs:
+.stabn 68,0,46,.LMa162-v4__fstatfs
+.LMa162:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic20
+.Lpic20:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic20],%ebx
+0:
+.stabn 68,0,46,.LMb162-v4__fstatfs
+.LMb162:
+.LBB20:
+	mov $100,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE20:
+.stabn 68,0,46,.LM170-v4__fstatfs
+.LM170:
+	pop %ebx
+	leave
+	ret
+.Lfe20:
+	.size	 v4__fstatfs,.Lfe20-v4__fstatfs
+.stabn	192,0,0,.LBB20-v4__fstatfs
+.stabn	224,0,0,.LBE20-v4__fstatfs
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4__fstatfs
+.text
+	.align 4
+.stabs "v4__ioperm:F1",36,0,0,v4__ioperm
+	.weak v4__ioperm
+	.type	v4__ioperm,@function
+v4__ioperm:
+.stabn 68,0,47,.LMa171-v4__ioperm
+.LMa171:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic21
+.Lpic21:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic21],%ebx
+0:
+.stabn 68,0,47,.LMb171-v4__ioperm
+.LMb171:
+.LBB21:
+	mov $101,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE21:
+.stabn 68,0,47,.LM179-v4__ioperm
+.LM179:
+	pop %ebx
+	leave
+	ret
+.Lfe21:
+	.size	 v4__ioperm,.Lfe21-v4__ioperm
+.stabn	192,0,0,.LBB21-v4__ioperm
+.stabn	224,0,0,.LBE21-v4__ioperm
+.Lscope21:
+.stabs	"",36,0,0,.Lscope21-v4__ioperm
+.text
+	.align 4
+.stabs "v4__iopl:F1",36,0,0,v4__iopl
+	.weak v4__iopl
+	.type	v4__iopl,@function
+v4__iopl:
+.stabn 68,0,48,.LMa180-v4__iopl
+.LMa180:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic22
+.Lpic22:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic22],%ebx
+0:
+.stabn 68,0,48,.LMb180-v4__iopl
+.LMb180:
+.LBB22:
+	mov $110,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE22:
+.stabn 68,0,48,.LM188-v4__iopl
+.LM188:
+	pop %ebx
+	leave
+	ret
+.Lfe22:
+	.size	 v4__iopl,.Lfe22-v4__iopl
+.stabn	192,0,0,.LBB22-v4__iopl
+.stabn	224,0,0,.LBE22-v4__iopl
+.Lscope22:
+.stabs	"",36,0,0,.Lscope22-v4__iopl
+.text
+	.align 4
+.stabs "v4__vhangup:F1",36,0,0,v4__vhangup
+	.weak v4__vhangup
+	.type	v4__vhangup,@function
+v4__vhangup:
+.stabn 68,0,49,.LMa189-v4__vhangup
+.LMa189:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic23
+.Lpic23:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic23],%ebx
+0:
+.stabn 68,0,49,.LMb189-v4__vhangup
+.LMb189:
+.LBB23:
+	mov $111,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE23:
+.stabn 68,0,49,.LM197-v4__vhangup
+.LM197:
+	pop %ebx
+	leave
+	ret
+.Lfe23:
+	.size	 v4__vhangup,.Lfe23-v4__vhangup
+.stabn	192,0,0,.LBB23-v4__vhangup
+.stabn	224,0,0,.LBE23-v4__vhangup
+.Lscope23:
+.stabs	"",36,0,0,.Lscope23-v4__vhangup
+.text
+	.align 4
+.stabs "v4__swapoff:F1",36,0,0,v4__swapoff
+	.weak v4__swapoff
+	.type	v4__swapoff,@function
+v4__swapoff:
+.stabn 68,0,50,.LMa198-v4__swapoff
+.LMa198:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic24
+.Lpic24:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic24],%ebx
+0:
+.stabn 68,0,50,.LMb198-v4__swapoff
+.LMb198:
+.LBB24:
+	mov $115,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE24:
+.stabn 68,0,50,.LM206-v4__swapoff
+.LM206:
+	pop %ebx
+	leave
+	ret
+.Lfe24:
+	.size	 v4__swapoff,.Lfe24-v4__swapoff
+.stabn	192,0,0,.LBB24-v4__swapoff
+.stabn	224,0,0,.LBE24-v4__swapoff
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4__swapoff
+.text
+	.align 4
+.stabs "v4__setdomainname:F1",36,0,0,v4__setdomainname
+	.weak v4__setdomainname
+	.type	v4__setdomainname,@function
+v4__setdomainname:
+.stabn 68,0,51,.LMa207-v4__setdomainname
+.LMa207:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic25
+.Lpic25:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic25],%ebx
+0:
+.stabn 68,0,51,.LMb207-v4__setdomainname
+.LMb207:
+.LBB25:
+	mov $121,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE25:
+.stabn 68,0,51,.LM215-v4__setdomainname
+.LM215:
+	pop %ebx
+	leave
+	ret
+.Lfe25:
+	.size	 v4__setdomainname,.Lfe25-v4__setdomainname
+.stabn	192,0,0,.LBB25-v4__setdomainname
+.stabn	224,0,0,.LBE25-v4__setdomainname
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4__setdomainname
+.text
+	.align 4
+.stabs "v4__modify_ldt:F1",36,0,0,v4__modify_ldt
+	.weak v4__modify_ldt
+	.type	v4__modify_ldt,@function
+v4__modify_ldt:
+.stabn 68,0,52,.LMa216-v4__modify_ldt
+.LMa216:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic26
+.Lpic26:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic26],%ebx
+0:
+.stabn 68,0,52,.LMb216-v4__modify_ldt
+.LMb216:
+.LBB26:
+	mov $123,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE26:
+.stabn 68,0,52,.LM224-v4__modify_ldt
+.LM224:
+	pop %ebx
+	leave
+	ret
+.Lfe26:
+	.size	 v4__modify_ldt,.Lfe26-v4__modify_ldt
+.stabn	192,0,0,.LBB26-v4__modify_ldt
+.stabn	224,0,0,.LBE26-v4__modify_ldt
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4__modify_ldt
+.text
+	.align 4
+.stabs "v4__adjtimex:F1",36,0,0,v4__adjtimex
+	.weak v4__adjtimex
+	.type	v4__adjtimex,@function
+v4__adjtimex:
+.stabn 68,0,53,.LMa225-v4__adjtimex
+.LMa225:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic27
+.Lpic27:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic27],%ebx
+0:
+.stabn 68,0,53,.LMb225-v4__adjtimex
+.LMb225:
+.LBB27:
+	mov $124,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE27:
+.stabn 68,0,53,.LM233-v4__adjtimex
+.LM233:
+	pop %ebx
+	leave
+	ret
+.Lfe27:
+	.size	 v4__adjtimex,.Lfe27-v4__adjtimex
+.stabn	192,0,0,.LBB27-v4__adjtimex
+.stabn	224,0,0,.LBE27-v4__adjtimex
+.Lscope27:
+.stabs	"",36,0,0,.Lscope27-v4__adjtimex
+.text
+	.align 4
+.stabs "v4__mprotect:F1",36,0,0,v4__mprotect
+	.weak v4__mprotect
+	.type	v4__mprotect,@function
+v4__mprotect:
+.stabn 68,0,54,.LMa234-v4__mprotect
+.LMa234:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic28
+.Lpic28:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic28],%ebx
+0:
+.stabn 68,0,54,.LMb234-v4__mprotect
+.LMb234:
+.LBB28:
+	mov $125,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE28:
+.stabn 68,0,54,.LM242-v4__mprotect
+.LM242:
+	pop %ebx
+	leave
+	ret
+.Lfe28:
+	.size	 v4__mprotect,.Lfe28-v4__mprotect
+.stabn	192,0,0,.LBB28-v4__mprotect
+.stabn	224,0,0,.LBE28-v4__mprotect
+.Lscope28:
+.stabs	"",36,0,0,.Lscope28-v4__mprotect
+.text
+	.align 4
+.stabs "v4__create_module:F1",36,0,0,v4__create_module
+	.weak v4__create_module
+	.type	v4__create_module,@function
+v4__create_module:
+.stabn 68,0,55,.LMa243-v4__create_module
+.LMa243:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic29
+.Lpic29:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic29],%ebx
+0:
+.stabn 68,0,55,.LMb243-v4__create_module
+.LMb243:
+.LBB29:
+	mov $127,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE29:
+.stabn 68,0,55,.LM251-v4__create_module
+.LM251:
+	pop %ebx
+	leave
+	ret
+.Lfe29:
+	.size	 v4__create_module,.Lfe29-v4__create_module
+.stabn	192,0,0,.LBB29-v4__create_module
+.stabn	224,0,0,.LBE29-v4__create_module
+.Lscope29:
+.stabs	"",36,0,0,.Lscope29-v4__create_module
+.text
+	.align 4
+.stabs "v4__init_module:F1",36,0,0,v4__init_module
+	.weak v4__init_module
+	.type	v4__init_module,@function
+v4__init_module:
+.stabn 68,0,56,.LMa252-v4__init_module
+.LMa252:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic30
+.Lpic30:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic30],%ebx
+0:
+.stabn 68,0,56,.LMb252-v4__init_module
+.LMb252:
+.LBB30:
+	mov $128,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE30:
+.stabn 68,0,56,.LM260-v4__init_module
+.LM260:
+	pop %ebx
+	leave
+	ret
+.Lfe30:
+	.size	 v4__init_module,.Lfe30-v4__init_module
+.stabn	192,0,0,.LBB30-v4__init_module
+.stabn	224,0,0,.LBE30-v4__init_module
+.Lscope30:
+.stabs	"",36,0,0,.Lscope30-v4__init_module
+.text
+	.align 4
+.stabs "v4__delete_module:F1",36,0,0,v4__delete_module
+	.weak v4__delete_module
+	.type	v4__delete_module,@function
+v4__delete_module:
+.stabn 68,0,57,.LMa261-v4__delete_module
+.LMa261:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic31
+.Lpic31:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic31],%ebx
+0:
+.stabn 68,0,57,.LMb261-v4__delete_module
+.LMb261:
+.LBB31:
+	mov $129,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE31:
+.stabn 68,0,57,.LM269-v4__delete_module
+.LM269:
+	pop %ebx
+	leave
+	ret
+.Lfe31:
+	.size	 v4__delete_module,.Lfe31-v4__delete_module
+.stabn	192,0,0,.LBB31-v4__delete_module
+.stabn	224,0,0,.LBE31-v4__delete_module
+.Lscope31:
+.stabs	"",36,0,0,.Lscope31-v4__delete_module
+.text
+	.align 4
+.stabs "v4__get_kernel_syms:F1",36,0,0,v4__get_kernel_syms
+	.weak v4__get_kernel_syms
+	.type	v4__get_kernel_syms,@function
+v4__get_kernel_syms:
+.stabn 68,0,58,.LMa270-v4__get_kernel_syms
+.LMa270:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic32
+.Lpic32:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic32],%ebx
+0:
+.stabn 68,0,58,.LMb270-v4__get_kernel_syms
+.LMb270:
+.LBB32:
+	mov $130,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE32:
+.stabn 68,0,58,.LM278-v4__get_kernel_syms
+.LM278:
+	pop %ebx
+	leave
+	ret
+.Lfe32:
+	.size	 v4__get_kernel_syms,.Lfe32-v4__get_kernel_syms
+.stabn	192,0,0,.LBB32-v4__get_kernel_syms
+.stabn	224,0,0,.LBE32-v4__get_kernel_syms
+.Lscope32:
+.stabs	"",36,0,0,.Lscope32-v4__get_kernel_syms
+.text
+	.align 4
+.stabs "v4__quotactl:F1",36,0,0,v4__quotactl
+	.weak v4__quotactl
+	.type	v4__quotactl,@function
+v4__quotactl:
+.stabn 68,0,59,.LMa279-v4__quotactl
+.LMa279:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic33
+.Lpic33:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic33],%ebx
+0:
+.stabn 68,0,59,.LMb279-v4__quotactl
+.LMb279:
+.LBB33:
+	mov $131,%eax
+	call v4__dpush@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE33:
+.stabn 68,0,59,.LM287-v4__quotactl
+.LM287:
+	pop %ebx
+	leave
+	ret
+.Lfe33:
+	.size	 v4__quotactl,.Lfe33-v4__quotactl
+.stabn	192,0,0,.LBB33-v4__quotactl
+.stabn	224,0,0,.LBE33-v4__quotactl
+.Lscope33:
+.stabs	"",36,0,0,.Lscope33-v4__quotactl
+.text
+	.align 4
+.stabs "v4__bdflush:F1",36,0,0,v4__bdflush
+	.weak v4__bdflush
+	.type	v4__bdflush,@function
+v4__bdflush:
+.stabn 68,0,60,.LMa288-v4__bdflush
+.LMa288:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic34
+.Lpic34:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic34],%ebx
+0:
+.stabn 68,0,60,.LMb288-v4__bdflush
+.LMb288:
+.LBB34:
+	mov $134,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE34:
+.stabn 68,0,60,.LM296-v4__bdflush
+.LM296:
+	pop %ebx
+	leave
+	ret
+.Lfe34:
+	.size	 v4__bdflush,.Lfe34-v4__bdflush
+.stabn	192,0,0,.LBB34-v4__bdflush
+.stabn	224,0,0,.LBE34-v4__bdflush
+.Lscope34:
+.stabs	"",36,0,0,.Lscope34-v4__bdflush
+.text
+	.align 4
+.stabs "v4__sysfs:F1",36,0,0,v4__sysfs
+	.weak v4__sysfs
+	.type	v4__sysfs,@function
+v4__sysfs:
+.stabn 68,0,61,.LMa297-v4__sysfs
+.LMa297:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic35
+.Lpic35:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic35],%ebx
+0:
+.stabn 68,0,61,.LMb297-v4__sysfs
+.LMb297:
+.LBB35:
+	mov $135,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE35:
+.stabn 68,0,61,.LM305-v4__sysfs
+.LM305:
+	pop %ebx
+	leave
+	ret
+.Lfe35:
+	.size	 v4__sysfs,.Lfe35-v4__sysfs
+.stabn	192,0,0,.LBB35-v4__sysfs
+.stabn	224,0,0,.LBE35-v4__sysfs
+.Lscope35:
+.stabs	"",36,0,0,.Lscope35-v4__sysfs
+.text
+	.align 4
+.stabs "v4__getsid:F1",36,0,0,v4__getsid
+	.weak v4__getsid
+	.type	v4__getsid,@function
+v4__getsid:
+.stabn 68,0,62,.LMa306-v4__getsid
+.LMa306:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic36
+.Lpic36:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic36],%ebx
+0:
+.stabn 68,0,62,.LMb306-v4__getsid
+.LMb306:
+.LBB36:
+	mov $147,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE36:
+.stabn 68,0,62,.LM314-v4__getsid
+.LM314:
+	pop %ebx
+	leave
+	ret
+.Lfe36:
+	.size	 v4__getsid,.Lfe36-v4__getsid
+.stabn	192,0,0,.LBB36-v4__getsid
+.stabn	224,0,0,.LBE36-v4__getsid
+.Lscope36:
+.stabs	"",36,0,0,.Lscope36-v4__getsid
+.text
+	.align 4
+.stabs "v4__fdatasync:F1",36,0,0,v4__fdatasync
+	.weak v4__fdatasync
+	.type	v4__fdatasync,@function
+v4__fdatasync:
+.stabn 68,0,63,.LMa315-v4__fdatasync
+.LMa315:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic37
+.Lpic37:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic37],%ebx
+0:
+.stabn 68,0,63,.LMb315-v4__fdatasync
+.LMb315:
+.LBB37:
+	mov $148,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE37:
+.stabn 68,0,63,.LM323-v4__fdatasync
+.LM323:
+	pop %ebx
+	leave
+	ret
+.Lfe37:
+	.size	 v4__fdatasync,.Lfe37-v4__fdatasync
+.stabn	192,0,0,.LBB37-v4__fdatasync
+.stabn	224,0,0,.LBE37-v4__fdatasync
+.Lscope37:
+.stabs	"",36,0,0,.Lscope37-v4__fdatasync
+.text
+	.align 4
+.stabs "v4__sysctl:F1",36,0,0,v4__sysctl
+	.weak v4__sysctl
+	.type	v4__sysctl,@function
+v4__sysctl:
+.stabn 68,0,64,.LMa324-v4__sysctl
+.LMa324:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic38
+.Lpic38:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic38],%ebx
+0:
+.stabn 68,0,64,.LMb324-v4__sysctl
+.LMb324:
+.LBB38:
+	mov $149,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE38:
+.stabn 68,0,64,.LM332-v4__sysctl
+.LM332:
+	pop %ebx
+	leave
+	ret
+.Lfe38:
+	.size	 v4__sysctl,.Lfe38-v4__sysctl
+.stabn	192,0,0,.LBB38-v4__sysctl
+.stabn	224,0,0,.LBE38-v4__sysctl
+.Lscope38:
+.stabs	"",36,0,0,.Lscope38-v4__sysctl
+.text
+	.align 4
+.stabs "v4__mlock:F1",36,0,0,v4__mlock
+	.weak v4__mlock
+	.type	v4__mlock,@function
+v4__mlock:
+.stabn 68,0,65,.LMa333-v4__mlock
+.LMa333:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic39
+.Lpic39:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic39],%ebx
+0:
+.stabn 68,0,65,.LMb333-v4__mlock
+.LMb333:
+.LBB39:
+	mov $150,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE39:
+.stabn 68,0,65,.LM341-v4__mlock
+.LM341:
+	pop %ebx
+	leave
+	ret
+.Lfe39:
+	.size	 v4__mlock,.Lfe39-v4__mlock
+.stabn	192,0,0,.LBB39-v4__mlock
+.stabn	224,0,0,.LBE39-v4__mlock
+.Lscope39:
+.stabs	"",36,0,0,.Lscope39-v4__mlock
+.text
+	.align 4
+.stabs "v4__munlock:F1",36,0,0,v4__munlock
+	.weak v4__munlock
+	.type	v4__munlock,@function
+v4__munlock:
+.stabn 68,0,66,.LMa342-v4__munlock
+.LMa342:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic40
+.Lpic40:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic40],%ebx
+0:
+.stabn 68,0,66,.LMb342-v4__munlock
+.LMb342:
+.LBB40:
+	mov $151,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE40:
+.stabn 68,0,66,.LM350-v4__munlock
+.LM350:
+	pop %ebx
+	leave
+	ret
+.Lfe40:
+	.size	 v4__munlock,.Lfe40-v4__munlock
+.stabn	192,0,0,.LBB40-v4__munlock
+.stabn	224,0,0,.LBE40-v4__munlock
+.Lscope40:
+.stabs	"",36,0,0,.Lscope40-v4__munlock
+.text
+	.align 4
+.stabs "v4__mlockall:F1",36,0,0,v4__mlockall
+	.weak v4__mlockall
+	.type	v4__mlockall,@function
+v4__mlockall:
+.stabn 68,0,67,.LMa351-v4__mlockall
+.LMa351:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic41
+.Lpic41:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic41],%ebx
+0:
+.stabn 68,0,67,.LMb351-v4__mlockall
+.LMb351:
+.LBB41:
+	mov $152,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE41:
+.stabn 68,0,67,.LM359-v4__mlockall
+.LM359:
+	pop %ebx
+	leave
+	ret
+.Lfe41:
+	.size	 v4__mlockall,.Lfe41-v4__mlockall
+.stabn	192,0,0,.LBB41-v4__mlockall
+.stabn	224,0,0,.LBE41-v4__mlockall
+.Lscope41:
+.stabs	"",36,0,0,.Lscope41-v4__mlockall
+.text
+	.align 4
+.stabs "v4__munlockall:F1",36,0,0,v4__munlockall
+	.weak v4__munlockall
+	.type	v4__munlockall,@function
+v4__munlockall:
+.stabn 68,0,68,.LMa360-v4__munlockall
+.LMa360:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic42
+.Lpic42:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic42],%ebx
+0:
+.stabn 68,0,68,.LMb360-v4__munlockall
+.LMb360:
+.LBB42:
+	mov $153,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE42:
+.stabn 68,0,68,.LM368-v4__munlockall
+.LM368:
+	pop %ebx
+	leave
+	ret
+.Lfe42:
+	.size	 v4__munlockall,.Lfe42-v4__munlockall
+.stabn	192,0,0,.LBB42-v4__munlockall
+.stabn	224,0,0,.LBE42-v4__munlockall
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4__munlockall
+.text
+	.align 4
+.stabs "v4__sched_setparam:F1",36,0,0,v4__sched_setparam
+	.weak v4__sched_setparam
+	.type	v4__sched_setparam,@function
+v4__sched_setparam:
+.stabn 68,0,69,.LMa369-v4__sched_setparam
+.LMa369:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic43
+.Lpic43:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic43],%ebx
+0:
+.stabn 68,0,69,.LMb369-v4__sched_setparam
+.LMb369:
+.LBB43:
+	mov $154,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE43:
+.stabn 68,0,69,.LM377-v4__sched_setparam
+.LM377:
+	pop %ebx
+	leave
+	ret
+.Lfe43:
+	.size	 v4__sched_setparam,.Lfe43-v4__sched_setparam
+.stabn	192,0,0,.LBB43-v4__sched_setparam
+.stabn	224,0,0,.LBE43-v4__sched_setparam
+.Lscope43:
+.stabs	"",36,0,0,.Lscope43-v4__sched_setparam
+.text
+	.align 4
+.stabs "v4__sched_getparam:F1",36,0,0,v4__sched_getparam
+	.weak v4__sched_getparam
+	.type	v4__sched_getparam,@function
+v4__sched_getparam:
+.stabn 68,0,70,.LMa378-v4__sched_getparam
+.LMa378:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic44
+.Lpic44:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic44],%ebx
+0:
+.stabn 68,0,70,.LMb378-v4__sched_getparam
+.LMb378:
+.LBB44:
+	mov $155,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE44:
+.stabn 68,0,70,.LM386-v4__sched_getparam
+.LM386:
+	pop %ebx
+	leave
+	ret
+.Lfe44:
+	.size	 v4__sched_getparam,.Lfe44-v4__sched_getparam
+.stabn	192,0,0,.LBB44-v4__sched_getparam
+.stabn	224,0,0,.LBE44-v4__sched_getparam
+.Lscope44:
+.stabs	"",36,0,0,.Lscope44-v4__sched_getparam
+.text
+	.align 4
+.stabs "v4__sched_setscheduler:F1",36,0,0,v4__sched_setscheduler
+	.weak v4__sched_setscheduler
+	.type	v4__sched_setscheduler,@function
+v4__sched_setscheduler:
+.stabn 68,0,71,.LMa387-v4__sched_setscheduler
+.LMa387:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic45
+.Lpic45:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic45],%ebx
+0:
+.stabn 68,0,71,.LMb387-v4__sched_setscheduler
+.LMb387:
+.LBB45:
+	mov $156,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE45:
+.stabn 68,0,71,.LM395-v4__sched_setscheduler
+.LM395:
+	pop %ebx
+	leave
+	ret
+.Lfe45:
+	.size	 v4__sched_setscheduler,.Lfe45-v4__sched_setscheduler
+.stabn	192,0,0,.LBB45-v4__sched_setscheduler
+.stabn	224,0,0,.LBE45-v4__sched_setscheduler
+.Lscope45:
+.stabs	"",36,0,0,.Lscope45-v4__sched_setscheduler
+.text
+	.align 4
+.stabs "v4__sched_getscheduler:F1",36,0,0,v4__sched_getscheduler
+	.weak v4__sched_getscheduler
+	.type	v4__sched_getscheduler,@function
+v4__sched_getscheduler:
+.stabn 68,0,72,.LMa396-v4__sched_getscheduler
+.LMa396:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic46
+.Lpic46:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic46],%ebx
+0:
+.stabn 68,0,72,.LMb396-v4__sched_getscheduler
+.LMb396:
+.LBB46:
+	mov $157,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE46:
+.stabn 68,0,72,.LM404-v4__sched_getscheduler
+.LM404:
+	pop %ebx
+	leave
+	ret
+.Lfe46:
+	.size	 v4__sched_getscheduler,.Lfe46-v4__sched_getscheduler
+.stabn	192,0,0,.LBB46-v4__sched_getscheduler
+.stabn	224,0,0,.LBE46-v4__sched_getscheduler
+.Lscope46:
+.stabs	"",36,0,0,.Lscope46-v4__sched_getscheduler
+.text
+	.align 4
+.stabs "v4__sched_yield:F1",36,0,0,v4__sched_yield
+	.weak v4__sched_yield
+	.type	v4__sched_yield,@function
+v4__sched_yield:
+.stabn 68,0,73,.LMa405-v4__sched_yield
+.LMa405:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic47
+.Lpic47:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic47],%ebx
+0:
+.stabn 68,0,73,.LMb405-v4__sched_yield
+.LMb405:
+.LBB47:
+	mov $158,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE47:
+.stabn 68,0,73,.LM413-v4__sched_yield
+.LM413:
+	pop %ebx
+	leave
+	ret
+.Lfe47:
+	.size	 v4__sched_yield,.Lfe47-v4__sched_yield
+.stabn	192,0,0,.LBB47-v4__sched_yield
+.stabn	224,0,0,.LBE47-v4__sched_yield
+.Lscope47:
+.stabs	"",36,0,0,.Lscope47-v4__sched_yield
+.text
+	.align 4
+.stabs "v4__sched_get_priority_max:F1",36,0,0,v4__sched_get_priority_max
+	.weak v4__sched_get_priority_max
+	.type	v4__sched_get_priority_max,@function
+v4__sched_get_priority_max:
+.stabn 68,0,74,.LMa414-v4__sched_get_priority_max
+.LMa414:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic48
+.Lpic48:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic48],%ebx
+0:
+.stabn 68,0,74,.LMb414-v4__sched_get_priority_max
+.LMb414:
+.LBB48:
+	mov $159,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE48:
+.stabn 68,0,74,.LM422-v4__sched_get_priority_max
+.LM422:
+	pop %ebx
+	leave
+	ret
+.Lfe48:
+	.size	 v4__sched_get_priority_max,.Lfe48-v4__sched_get_priority_max
+.stabn	192,0,0,.LBB48-v4__sched_get_priority_max
+.stabn	224,0,0,.LBE48-v4__sched_get_priority_max
+.Lscope48:
+.stabs	"",36,0,0,.Lscope48-v4__sched_get_priority_max
+.text
+	.align 4
+.stabs "v4__sched_get_priority_min:F1",36,0,0,v4__sched_get_priority_min
+	.weak v4__sched_get_priority_min
+	.type	v4__sched_get_priority_min,@function
+v4__sched_get_priority_min:
+.stabn 68,0,75,.LMa423-v4__sched_get_priority_min
+.LMa423:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic49
+.Lpic49:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic49],%ebx
+0:
+.stabn 68,0,75,.LMb423-v4__sched_get_priority_min
+.LMb423:
+.LBB49:
+	mov $160,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE49:
+.stabn 68,0,75,.LM431-v4__sched_get_priority_min
+.LM431:
+	pop %ebx
+	leave
+	ret
+.Lfe49:
+	.size	 v4__sched_get_priority_min,.Lfe49-v4__sched_get_priority_min
+.stabn	192,0,0,.LBB49-v4__sched_get_priority_min
+.stabn	224,0,0,.LBE49-v4__sched_get_priority_min
+.Lscope49:
+.stabs	"",36,0,0,.Lscope49-v4__sched_get_priority_min
+.text
+	.align 4
+.stabs "v4__sched_rr_get_interval:F1",36,0,0,v4__sched_rr_get_interval
+	.weak v4__sched_rr_get_interval
+	.type	v4__sched_rr_get_interval,@function
+v4__sched_rr_get_interval:
+.stabn 68,0,76,.LMa432-v4__sched_rr_get_interval
+.LMa432:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic50
+.Lpic50:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic50],%ebx
+0:
+.stabn 68,0,76,.LMb432-v4__sched_rr_get_interval
+.LMb432:
+.LBB50:
+	mov $161,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE50:
+.stabn 68,0,76,.LM440-v4__sched_rr_get_interval
+.LM440:
+	pop %ebx
+	leave
+	ret
+.Lfe50:
+	.size	 v4__sched_rr_get_interval,.Lfe50-v4__sched_rr_get_interval
+.stabn	192,0,0,.LBB50-v4__sched_rr_get_interval
+.stabn	224,0,0,.LBE50-v4__sched_rr_get_interval
+.Lscope50:
+.stabs	"",36,0,0,.Lscope50-v4__sched_rr_get_interval
+.text
+	.align 4
+.stabs "v4__vm86:F1",36,0,0,v4__vm86
+	.weak v4__vm86
+	.type	v4__vm86,@function
+v4__vm86:
+.stabn 68,0,77,.LMa441-v4__vm86
+.LMa441:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic51
+.Lpic51:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic51],%ebx
+0:
+.stabn 68,0,77,.LMb441-v4__vm86
+.LMb441:
+.LBB51:
+	mov $166,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE51:
+.stabn 68,0,77,.LM449-v4__vm86
+.LM449:
+	pop %ebx
+	leave
+	ret
+.Lfe51:
+	.size	 v4__vm86,.Lfe51-v4__vm86
+.stabn	192,0,0,.LBB51-v4__vm86
+.stabn	224,0,0,.LBE51-v4__vm86
+.Lscope51:
+.stabs	"",36,0,0,.Lscope51-v4__vm86
+.text
+	.align 4
+.stabs "v4__query_module:F1",36,0,0,v4__query_module
+	.weak v4__query_module
+	.type	v4__query_module,@function
+v4__query_module:
+.stabn 68,0,78,.LMa450-v4__query_module
+.LMa450:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic52
+.Lpic52:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic52],%ebx
+0:
+.stabn 68,0,78,.LMb450-v4__query_module
+.LMb450:
+.LBB52:
+	mov $167,%eax
+	call v4__dpush@PLT
+	mov $5,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE52:
+.stabn 68,0,78,.LM458-v4__query_module
+.LM458:
+	pop %ebx
+	leave
+	ret
+.Lfe52:
+	.size	 v4__query_module,.Lfe52-v4__query_module
+.stabn	192,0,0,.LBB52-v4__query_module
+.stabn	224,0,0,.LBE52-v4__query_module
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4__query_module
+.text
+	.align 4
+.stabs "v4__nfsservctl:F1",36,0,0,v4__nfsservctl
+	.weak v4__nfsservctl
+	.type	v4__nfsservctl,@function
+v4__nfsservctl:
+.stabn 68,0,79,.LMa459-v4__nfsservctl
+.LMa459:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic53
+.Lpic53:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic53],%ebx
+0:
+.stabn 68,0,79,.LMb459-v4__nfsservctl
+.LMb459:
+.LBB53:
+	mov $169,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE53:
+.stabn 68,0,79,.LM467-v4__nfsservctl
+.LM467:
+	pop %ebx
+	leave
+	ret
+.Lfe53:
+	.size	 v4__nfsservctl,.Lfe53-v4__nfsservctl
+.stabn	192,0,0,.LBB53-v4__nfsservctl
+.stabn	224,0,0,.LBE53-v4__nfsservctl
+.Lscope53:
+.stabs	"",36,0,0,.Lscope53-v4__nfsservctl
+.text
+	.align 4
+.stabs "v4__prctl:F1",36,0,0,v4__prctl
+	.weak v4__prctl
+	.type	v4__prctl,@function
+v4__prctl:
+.stabn 68,0,80,.LMa468-v4__prctl
+.LMa468:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic54
+.Lpic54:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic54],%ebx
+0:
+.stabn 68,0,80,.LMb468-v4__prctl
+.LMb468:
+.LBB54:
+	mov $172,%eax
+	call v4__dpush@PLT
+	mov $5,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE54:
+.stabn 68,0,80,.LM476-v4__prctl
+.LM476:
+	pop %ebx
+	leave
+	ret
+.Lfe54:
+	.size	 v4__prctl,.Lfe54-v4__prctl
+.stabn	192,0,0,.LBB54-v4__prctl
+.stabn	224,0,0,.LBE54-v4__prctl
+.Lscope54:
+.stabs	"",36,0,0,.Lscope54-v4__prctl
+.text
+	.align 4
+.stabs "v4__capget:F1",36,0,0,v4__capget
+	.weak v4__capget
+	.type	v4__capget,@function
+v4__capget:
+.stabn 68,0,81,.LMa477-v4__capget
+.LMa477:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic55
+.Lpic55:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic55],%ebx
+0:
+.stabn 68,0,81,.LMb477-v4__capget
+.LMb477:
+.LBB55:
+	mov $184,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE55:
+.stabn 68,0,81,.LM485-v4__capget
+.LM485:
+	pop %ebx
+	leave
+	ret
+.Lfe55:
+	.size	 v4__capget,.Lfe55-v4__capget
+.stabn	192,0,0,.LBB55-v4__capget
+.stabn	224,0,0,.LBE55-v4__capget
+.Lscope55:
+.stabs	"",36,0,0,.Lscope55-v4__capget
+.text
+	.align 4
+.stabs "v4__capset:F1",36,0,0,v4__capset
+	.weak v4__capset
+	.type	v4__capset,@function
+v4__capset:
+.stabn 68,0,82,.LMa486-v4__capset
+.LMa486:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic56
+.Lpic56:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic56],%ebx
+0:
+.stabn 68,0,82,.LMb486-v4__capset
+.LMb486:
+.LBB56:
+	mov $185,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE56:
+.stabn 68,0,82,.LM494-v4__capset
+.LM494:
+	pop %ebx
+	leave
+	ret
+.Lfe56:
+	.size	 v4__capset,.Lfe56-v4__capset
+.stabn	192,0,0,.LBB56-v4__capset
+.stabn	224,0,0,.LBE56-v4__capset
+.Lscope56:
+.stabs	"",36,0,0,.Lscope56-v4__capset
+.text
+	.align 4
+.stabs "v4__truncate64:F1",36,0,0,v4__truncate64
+	.weak v4__truncate64
+	.type	v4__truncate64,@function
+v4__truncate64:
+.stabn 68,0,83,.LMa495-v4__truncate64
+.LMa495:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic57
+.Lpic57:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic57],%ebx
+0:
+.stabn 68,0,83,.LMb495-v4__truncate64
+.LMb495:
+.LBB57:
+	mov $193,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE57:
+.stabn 68,0,83,.LM503-v4__truncate64
+.LM503:
+	pop %ebx
+	leave
+	ret
+.Lfe57:
+	.size	 v4__truncate64,.Lfe57-v4__truncate64
+.stabn	192,0,0,.LBB57-v4__truncate64
+.stabn	224,0,0,.LBE57-v4__truncate64
+.Lscope57:
+.stabs	"",36,0,0,.Lscope57-v4__truncate64
+.text
+	.align 4
+.stabs "v4__ftruncate64:F1",36,0,0,v4__ftruncate64
+	.weak v4__ftruncate64
+	.type	v4__ftruncate64,@function
+v4__ftruncate64:
+.stabn 68,0,84,.LMa504-v4__ftruncate64
+.LMa504:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic58
+.Lpic58:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic58],%ebx
+0:
+.stabn 68,0,84,.LMb504-v4__ftruncate64
+.LMb504:
+.LBB58:
+	mov $194,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE58:
+.stabn 68,0,84,.LM512-v4__ftruncate64
+.LM512:
+	pop %ebx
+	leave
+	ret
+.Lfe58:
+	.size	 v4__ftruncate64,.Lfe58-v4__ftruncate64
+.stabn	192,0,0,.LBB58-v4__ftruncate64
+.stabn	224,0,0,.LBE58-v4__ftruncate64
+.Lscope58:
+.stabs	"",36,0,0,.Lscope58-v4__ftruncate64
+.text
+	.align 4
+.stabs "v4__stat64:F1",36,0,0,v4__stat64
+	.weak v4__stat64
+	.type	v4__stat64,@function
+v4__stat64:
+.stabn 68,0,85,.LMa513-v4__stat64
+.LMa513:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic59
+.Lpic59:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic59],%ebx
+0:
+.stabn 68,0,85,.LMb513-v4__stat64
+.LMb513:
+.LBB59:
+	mov $195,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE59:
+.stabn 68,0,85,.LM521-v4__stat64
+.LM521:
+	pop %ebx
+	leave
+	ret
+.Lfe59:
+	.size	 v4__stat64,.Lfe59-v4__stat64
+.stabn	192,0,0,.LBB59-v4__stat64
+.stabn	224,0,0,.LBE59-v4__stat64
+.Lscope59:
+.stabs	"",36,0,0,.Lscope59-v4__stat64
+.text
+	.align 4
+.stabs "v4__lstat64:F1",36,0,0,v4__lstat64
+	.weak v4__lstat64
+	.type	v4__lstat64,@function
+v4__lstat64:
+.stabn 68,0,86,.LMa522-v4__lstat64
+.LMa522:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic60
+.Lpic60:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic60],%ebx
+0:
+.stabn 68,0,86,.LMb522-v4__lstat64
+.LMb522:
+.LBB60:
+	mov $196,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE60:
+.stabn 68,0,86,.LM530-v4__lstat64
+.LM530:
+	pop %ebx
+	leave
+	ret
+.Lfe60:
+	.size	 v4__lstat64,.Lfe60-v4__lstat64
+.stabn	192,0,0,.LBB60-v4__lstat64
+.stabn	224,0,0,.LBE60-v4__lstat64
+.Lscope60:
+.stabs	"",36,0,0,.Lscope60-v4__lstat64
+.text
+	.align 4
+.stabs "v4__fstat64:F1",36,0,0,v4__fstat64
+	.weak v4__fstat64
+	.type	v4__fstat64,@function
+v4__fstat64:
+.stabn 68,0,87,.LMa531-v4__fstat64
+.LMa531:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic61
+.Lpic61:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic61],%ebx
+0:
+.stabn 68,0,87,.LMb531-v4__fstat64
+.LMb531:
+.LBB61:
+	mov $197,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE61:
+.stabn 68,0,87,.LM539-v4__fstat64
+.LM539:
+	pop %ebx
+	leave
+	ret
+.Lfe61:
+	.size	 v4__fstat64,.Lfe61-v4__fstat64
+.stabn	192,0,0,.LBB61-v4__fstat64
+.stabn	224,0,0,.LBE61-v4__fstat64
+.Lscope61:
+.stabs	"",36,0,0,.Lscope61-v4__fstat64
+.text
+	.align 4
+.stabs "v4__pivot_root:F1",36,0,0,v4__pivot_root
+	.weak v4__pivot_root
+	.type	v4__pivot_root,@function
+v4__pivot_root:
+.stabn 68,0,90,.LMa540-v4__pivot_root
+.LMa540:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic62
+.Lpic62:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic62],%ebx
+0:
+.stabn 68,0,90,.LMb540-v4__pivot_root
+.LMb540:
+.LBB62:
+	mov $217,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE62:
+.stabn 68,0,90,.LM548-v4__pivot_root
+.LM548:
+	pop %ebx
+	leave
+	ret
+.Lfe62:
+	.size	 v4__pivot_root,.Lfe62-v4__pivot_root
+.stabn	192,0,0,.LBB62-v4__pivot_root
+.stabn	224,0,0,.LBE62-v4__pivot_root
+.Lscope62:
+.stabs	"",36,0,0,.Lscope62-v4__pivot_root
+.text
+	.align 4
+.stabs "v4__mincore:F1",36,0,0,v4__mincore
+	.weak v4__mincore
+	.type	v4__mincore,@function
+v4__mincore:
+.stabn 68,0,91,.LMa549-v4__mincore
+.LMa549:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic63
+.Lpic63:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic63],%ebx
+0:
+.stabn 68,0,91,.LMb549-v4__mincore
+.LMb549:
+.LBB63:
+	mov $218,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE63:
+.stabn 68,0,91,.LM557-v4__mincore
+.LM557:
+	pop %ebx
+	leave
+	ret
+.Lfe63:
+	.size	 v4__mincore,.Lfe63-v4__mincore
+.stabn	192,0,0,.LBB63-v4__mincore
+.stabn	224,0,0,.LBE63-v4__mincore
+.Lscope63:
+.stabs	"",36,0,0,.Lscope63-v4__mincore
+.text
+	.align 4
+.stabs "v4__madvise:F1",36,0,0,v4__madvise
+	.weak v4__madvise
+	.type	v4__madvise,@function
+v4__madvise:
+.stabn 68,0,92,.LMa558-v4__madvise
+.LMa558:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic64
+.Lpic64:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic64],%ebx
+0:
+.stabn 68,0,92,.LMb558-v4__madvise
+.LMb558:
+.LBB64:
+	mov $219,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE64:
+.stabn 68,0,92,.LM566-v4__madvise
+.LM566:
+	pop %ebx
+	leave
+	ret
+.Lfe64:
+	.size	 v4__madvise,.Lfe64-v4__madvise
+.stabn	192,0,0,.LBB64-v4__madvise
+.stabn	224,0,0,.LBE64-v4__madvise
+.Lscope64:
+.stabs	"",36,0,0,.Lscope64-v4__madvise
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,3091 @@
+	.file	"float.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"float.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.stabs	"v4__finit:G2",40,0,0,v4__finit
+	.comm  v4__finit,4,4
+.stabs	"v4__fsindex:G2",40,0,0,v4__fsindex
+	.comm  v4__fsindex,4,4
+.stabs	"v4__fstemp:G2",40,0,0,v4__fstemp
+	.comm  v4__fstemp,4,4
+.text
+	.align 4
+.stabs "v4__fpuinit:F1",36,0,0,v4__fpuinit
+	.weak v4__fpuinit
+	.type	v4__fpuinit,@function
+v4__fpuinit:
+.stabn 68,0,71,.LMa0-v4__fpuinit
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic3
+.Lpic3:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic3],%ebx
+0:
+.stabn 68,0,71,.LMb0-v4__fpuinit
+.LMb0:
+.LBB3:
+#APP
+    mov v4__finit@GOT(%ebx),%edi
+    cmp $0,(%edi)
+    ja 1f
+    finit
+    incl (%edi)
+1:
+    forth_pic.=0b-0b
+#NO_APP
+.LBE3:
+.stabn 68,0,81,.LM8-v4__fpuinit
+.LM8:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe3:
+	.size	 v4__fpuinit,.Lfe3-v4__fpuinit
+.stabn	192,0,0,.LBB3-v4__fpuinit
+.stabn	224,0,0,.LBE3-v4__fpuinit
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4__fpuinit
+.text
+	.align 4
+.stabs "v4__fpush:F1",36,0,0,v4__fpush
+	.weak v4__fpush
+	.type	v4__fpush,@function
+v4__fpush:
+.stabn 68,0,106,.LMa9-v4__fpush
+.LMa9:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic4
+.Lpic4:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic4],%ebx
+0:
+.stabn 68,0,106,.LMb9-v4__fpush
+.LMb9:
+.LBB4:
+#APP
+    call v4__fpuinit@PLT
+    mov v4__fsindex@GOT(%ebx),%esi
+    cmpl $6,(%esi)
+    jb 1f
+    mov $-44,%eax
+    call v4__dpush@PLT
+    call v4_throw@PLT
+1:
+    mov v4__fstemp@GOT(%ebx),%edi
+    mov %eax,(%edi)
+    flds (%edi)
+    incl (%esi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE4:
+.stabn 68,0,125,.LM23-v4__fpush
+.LM23:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe4:
+	.size	 v4__fpush,.Lfe4-v4__fpush
+.stabn	192,0,0,.LBB4-v4__fpush
+.stabn	224,0,0,.LBE4-v4__fpush
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4__fpush
+.text
+	.align 4
+.stabs "v4__fpop:F1",36,0,0,v4__fpop
+	.weak v4__fpop
+	.type	v4__fpop,@function
+v4__fpop:
+.stabn 68,0,148,.LMa24-v4__fpop
+.LMa24:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic5
+.Lpic5:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic5],%ebx
+0:
+.stabn 68,0,148,.LMb24-v4__fpop
+.LMb24:
+.LBB5:
+#APP
+    mov v4__fsindex@GOT(%ebx),%esi
+    cmpl $0,(%esi)
+    ja 1f
+    mov $-45,%eax
+    call v4__dpush@PLT
+    call v4_throw@PLT
+1:
+    decl (%esi)
+    mov v4__fstemp@GOT(%ebx),%edi
+    fstps (%edi)
+    mov (%edi),%eax
+    forth_pic.=0b-0b
+#NO_APP
+.LBE5:
+.stabn 68,0,165,.LM37-v4__fpop
+.LM37:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe5:
+	.size	 v4__fpop,.Lfe5-v4__fpop
+.stabn	192,0,0,.LBB5-v4__fpop
+.stabn	224,0,0,.LBE5-v4__fpop
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4__fpop
+.text
+	.align 4
+.stabs "v4__fcheck:F1",36,0,0,v4__fcheck
+	.weak v4__fcheck
+	.type	v4__fcheck,@function
+v4__fcheck:
+.stabn 68,0,190,.LMa38-v4__fcheck
+.LMa38:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic6
+.Lpic6:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic6],%ebx
+0:
+.stabn 68,0,190,.LMb38-v4__fcheck
+.LMb38:
+.LBB6:
+#APP
+    mov v4__fsindex@GOT(%ebx),%esi
+    cmpl $0,(%esi)
+    ja 1f
+    mov $-45,%eax
+    call v4__dpush@PLT
+    call v4_throw@PLT
+1:
+    forth_pic.=0b-0b
+#NO_APP
+.LBE6:
+.stabn 68,0,202,.LM47-v4__fcheck
+.LM47:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe6:
+	.size	 v4__fcheck,.Lfe6-v4__fcheck
+.stabn	192,0,0,.LBB6-v4__fcheck
+.stabn	224,0,0,.LBE6-v4__fcheck
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4__fcheck
+.text
+	.align 4
+.stabs "v4_float:F1",36,0,0,v4_float
+	.weak v4_float
+	.type	v4_float,@function
+v4_float:
+.stabn 68,0,205,.LMa48-v4_float
+.LMa48:
+	push %ebx
+	call .Lpic7
+.Lpic7:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic7],%ebx
+0:
+.stabn 68,0,205,.LMb48-v4_float
+.LMb48:
+.LBB7:
+	mov $4,%eax
+	call v4__dpush@PLT
+.LBE7:
+.stabn 68,0,205,.LM52-v4_float
+.LM52:
+	pop %ebx
+	ret
+.Lfe7:
+	.size	 v4_float,.Lfe7-v4_float
+.stabn	192,0,0,.LBB7-v4_float
+.stabn	224,0,0,.LBE7-v4_float
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_float
+.text
+	.align 4
+.stabs "v4_floats:F1",36,0,0,v4_floats
+	.weak v4_floats
+	.type	v4_floats,@function
+v4_floats:
+.stabn 68,0,207,.LMa53-v4_floats
+.LMa53:
+	push %ebx
+	call .Lpic8
+.Lpic8:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic8],%ebx
+0:
+.stabn 68,0,207,.LMb53-v4_floats
+.LMb53:
+.LBB8:
+	call v4__dpop@PLT
+	shl $2,%eax
+	call v4__dpush@PLT
+.LBE8:
+.stabn 68,0,207,.LM62-v4_floats
+.LM62:
+	pop %ebx
+	ret
+.Lfe8:
+	.size	 v4_floats,.Lfe8-v4_floats
+.stabn	192,0,0,.LBB8-v4_floats
+.stabn	224,0,0,.LBE8-v4_floats
+.Lscope8:
+.stabs	"",36,0,0,.Lscope8-v4_floats
+.text
+	.align 4
+.stabs "v4_float_Plus:F1",36,0,0,v4_float_Plus
+	.weak v4_float_Plus
+	.type	v4_float_Plus,@function
+v4_float_Plus:
+.stabn 68,0,208,.LMa63-v4_float_Plus
+.LMa63:
+	push %ebx
+	call .Lpic10
+.Lpic10:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic10],%ebx
+0:
+.stabn 68,0,208,.LMb63-v4_float_Plus
+.LMb63:
+.LBB10:
+.stabn 68,0,205,.LM65-v4_float_Plus
+.LM65:
+	mov $4,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+.LBE10:
+.stabn 68,0,208,.LM73-v4_float_Plus
+.LM73:
+	pop %ebx
+	ret
+.Lfe10:
+	.size	 v4_float_Plus,.Lfe10-v4_float_Plus
+.stabn	192,0,0,.LBB10-v4_float_Plus
+.stabn	224,0,0,.LBE10-v4_float_Plus
+.Lscope10:
+.stabs	"",36,0,0,.Lscope10-v4_float_Plus
+.text
+	.align 4
+.stabs "v4_float_Minus:F1",36,0,0,v4_float_Minus
+	.weak v4_float_Minus
+	.type	v4_float_Minus,@function
+v4_float_Minus:
+.stabn 68,0,209,.LMa74-v4_float_Minus
+.LMa74:
+	push %ebx
+	call .Lpic12
+.Lpic12:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic12],%ebx
+0:
+.stabn 68,0,209,.LMb74-v4_float_Minus
+.LMb74:
+.LBB12:
+.stabn 68,0,205,.LM76-v4_float_Minus
+.LM76:
+	mov $4,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.LBE12:
+.stabn 68,0,209,.LM84-v4_float_Minus
+.LM84:
+	pop %ebx
+	ret
+.Lfe12:
+	.size	 v4_float_Minus,.Lfe12-v4_float_Minus
+.stabn	192,0,0,.LBB12-v4_float_Minus
+.stabn	224,0,0,.LBE12-v4_float_Minus
+.Lscope12:
+.stabs	"",36,0,0,.Lscope12-v4_float_Minus
+.text
+	.align 4
+.stabs "v4_Greaterf:F1",36,0,0,v4_Greaterf
+	.weak v4_Greaterf
+	.type	v4_Greaterf,@function
+v4_Greaterf:
+.stabn 68,0,211,.LMa85-v4_Greaterf
+.LMa85:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic14
+.Lpic14:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic14],%ebx
+0:
+.stabn 68,0,211,.LMb85-v4_Greaterf
+.LMb85:
+.LBB14:
+#APP
+    call v4__dpop@PLT
+    call v4__fpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE14:
+.stabn 68,0,216,.LM89-v4_Greaterf
+.LM89:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe14:
+	.size	 v4_Greaterf,.Lfe14-v4_Greaterf
+.stabn	192,0,0,.LBB14-v4_Greaterf
+.stabn	224,0,0,.LBE14-v4_Greaterf
+.Lscope14:
+.stabs	"",36,0,0,.Lscope14-v4_Greaterf
+.text
+	.align 4
+.stabs "v4_f_Greater:F1",36,0,0,v4_f_Greater
+	.weak v4_f_Greater
+	.type	v4_f_Greater,@function
+v4_f_Greater:
+.stabn 68,0,218,.LMa90-v4_f_Greater
+.LMa90:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic15
+.Lpic15:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic15],%ebx
+0:
+.stabn 68,0,218,.LMb90-v4_f_Greater
+.LMb90:
+.LBB15:
+#APP
+    call v4__fpop@PLT
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE15:
+.stabn 68,0,223,.LM94-v4_f_Greater
+.LM94:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe15:
+	.size	 v4_f_Greater,.Lfe15-v4_f_Greater
+.stabn	192,0,0,.LBB15-v4_f_Greater
+.stabn	224,0,0,.LBE15-v4_f_Greater
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4_f_Greater
+.text
+	.align 4
+.stabs "v4_f_Greaterd:F1",36,0,0,v4_f_Greaterd
+	.weak v4_f_Greaterd
+	.type	v4_f_Greaterd,@function
+v4_f_Greaterd:
+.stabn 68,0,250,.LMa95-v4_f_Greaterd
+.LMa95:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic16
+.Lpic16:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic16],%ebx
+0:
+.stabn 68,0,250,.LMb95-v4_f_Greaterd
+.LMb95:
+.LBB16:
+#APP
+    call v4__fcheck@PLT
+    mov v4__fstemp@GOT(%ebx),%edi
+    fnstcw (%edi)
+    mov (%edi),%esi
+    mov %esi,%eax
+    mov $12,%ah
+    mov %eax,(%edi)
+    fldcw (%edi)
+    fistl (%edi)
+    mov (%edi),%eax
+    mov %esi,(%edi)
+    fldcw (%edi)
+    call v4__dpush@PLT
+    sar $31,%eax
+    call v4__dpush@PLT
+    call v4__fpop@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE16:
+.stabn 68,0,271,.LM113-v4_f_Greaterd
+.LM113:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe16:
+	.size	 v4_f_Greaterd,.Lfe16-v4_f_Greaterd
+.stabn	192,0,0,.LBB16-v4_f_Greaterd
+.stabn	224,0,0,.LBE16-v4_f_Greaterd
+.Lscope16:
+.stabs	"",36,0,0,.Lscope16-v4_f_Greaterd
+.text
+	.align 4
+.stabs "v4_d_Greaterf:F1",36,0,0,v4_d_Greaterf
+	.weak v4_d_Greaterf
+	.type	v4_d_Greaterf,@function
+v4_d_Greaterf:
+.stabn 68,0,291,.LMa114-v4_d_Greaterf
+.LMa114:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic17
+.Lpic17:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic17],%ebx
+0:
+.stabn 68,0,291,.LMb114-v4_d_Greaterf
+.LMb114:
+.LBB17:
+#APP
+    call v4__fpuinit@PLT
+    call v4__dpop@PLT
+    call v4__dpop@PLT
+    mov v4__fstemp@GOT(%ebx),%edi
+    mov %eax,(%edi)
+    fildl (%edi)
+    fstps (%edi)
+    mov (%edi),%eax
+    call v4__fpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE17:
+.stabn 68,0,305,.LM125-v4_d_Greaterf
+.LM125:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe17:
+	.size	 v4_d_Greaterf,.Lfe17-v4_d_Greaterf
+.stabn	192,0,0,.LBB17-v4_d_Greaterf
+.stabn	224,0,0,.LBE17-v4_d_Greaterf
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-v4_d_Greaterf
+.text
+	.align 4
+.stabs "v4__fp_Fetch:F1",36,0,0,v4__fp_Fetch
+	.weak v4__fp_Fetch
+	.type	v4__fp_Fetch,@function
+v4__fp_Fetch:
+.stabn 68,0,308,.LMa126-v4__fp_Fetch
+.LMa126:
+	push %ebx
+	call .Lpic18
+.Lpic18:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic18],%ebx
+0:
+.stabn 68,0,308,.LMb126-v4__fp_Fetch
+.LMb126:
+.LBB18:
+	mov v4__fsindex@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+.LBE18:
+.stabn 68,0,309,.LM133-v4__fp_Fetch
+.LM133:
+	pop %ebx
+	ret
+.Lfe18:
+	.size	 v4__fp_Fetch,.Lfe18-v4__fp_Fetch
+.stabn	192,0,0,.LBB18-v4__fp_Fetch
+.stabn	224,0,0,.LBE18-v4__fp_Fetch
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4__fp_Fetch
+.text
+	.align 4
+.stabs "v4__fp_Store:F1",36,0,0,v4__fp_Store
+	.weak v4__fp_Store
+	.type	v4__fp_Store,@function
+v4__fp_Store:
+.stabn 68,0,311,.LMa134-v4__fp_Store
+.LMa134:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic20
+.Lpic20:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic20],%ebx
+0:
+.stabn 68,0,311,.LMb134-v4__fp_Store
+.LMb134:
+.LBB20:
+.stabn 68,0,312,.LM135-v4__fp_Store
+.LM135:
+	mov v4__fsindex@GOT(%ebx),%eax
+	call v4__dpush@PLT
+.L7:
+	call v4_z2dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	jge .L8
+	call v4_f_Greater@PLT
+	call v4_drop@PLT
+	jmp .L7
+.L8:
+.L9:
+	call v4_z2dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	jle .L10
+	xor %eax,%eax
+	call v4__fpush@PLT
+	jmp .L9
+.L10:
+.stabn 68,0,315,.LM163-v4__fp_Store
+.LM163:
+	mov v4_z2drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE20:
+.stabn 68,0,315,.LM165-v4__fp_Store
+.LM165:
+	pop %ebx
+	leave
+	ret
+.Lfe20:
+	.size	 v4__fp_Store,.Lfe20-v4__fp_Store
+.stabn	192,0,0,.LBB20-v4__fp_Store
+.stabn	224,0,0,.LBE20-v4__fp_Store
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4__fp_Store
+.text
+	.align 4
+.stabs "v4_fdepth:F1",36,0,0,v4_fdepth
+	.weak v4_fdepth
+	.type	v4_fdepth,@function
+v4_fdepth:
+.stabn 68,0,317,.LMa166-v4_fdepth
+.LMa166:
+	push %ebx
+	call .Lpic26
+.Lpic26:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic26],%ebx
+0:
+.stabn 68,0,317,.LMb166-v4_fdepth
+.LMb166:
+.LBB26:
+	mov v4__fsindex@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+.LBE26:
+.stabn 68,0,318,.LM173-v4_fdepth
+.LM173:
+	pop %ebx
+	ret
+.Lfe26:
+	.size	 v4_fdepth,.Lfe26-v4_fdepth
+.stabn	192,0,0,.LBB26-v4_fdepth
+.stabn	224,0,0,.LBE26-v4_fdepth
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4_fdepth
+.text
+	.align 4
+.stabs "v4_f_Store:F1",36,0,0,v4_f_Store
+	.weak v4_f_Store
+	.type	v4_f_Store,@function
+v4_f_Store:
+.stabn 68,0,320,.LMa174-v4_f_Store
+.LMa174:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic27
+.Lpic27:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic27],%ebx
+0:
+.stabn 68,0,320,.LMb174-v4_f_Store
+.LMb174:
+.LBB27:
+.stabn 68,0,321,.LM175-v4_f_Store
+.LM175:
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	mov v4_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE27:
+.stabn 68,0,321,.LM179-v4_f_Store
+.LM179:
+	pop %ebx
+	leave
+	ret
+.Lfe27:
+	.size	 v4_f_Store,.Lfe27-v4_f_Store
+.stabn	192,0,0,.LBB27-v4_f_Store
+.stabn	224,0,0,.LBE27-v4_f_Store
+.Lscope27:
+.stabs	"",36,0,0,.Lscope27-v4_f_Store
+.text
+	.align 4
+.stabs "v4_f_Fetch:F1",36,0,0,v4_f_Fetch
+	.weak v4_f_Fetch
+	.type	v4_f_Fetch,@function
+v4_f_Fetch:
+.stabn 68,0,323,.LMa180-v4_f_Fetch
+.LMa180:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic30
+.Lpic30:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic30],%ebx
+0:
+.stabn 68,0,323,.LMb180-v4_f_Fetch
+.LMb180:
+.LBB30:
+.stabn 68,0,324,.LM181-v4_f_Fetch
+.LM181:
+	call v4_Fetch@PLT
+	mov v4_Greaterf@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE30:
+.stabn 68,0,324,.LM184-v4_f_Fetch
+.LM184:
+	pop %ebx
+	leave
+	ret
+.Lfe30:
+	.size	 v4_f_Fetch,.Lfe30-v4_f_Fetch
+.stabn	192,0,0,.LBB30-v4_f_Fetch
+.stabn	224,0,0,.LBE30-v4_f_Fetch
+.Lscope30:
+.stabs	"",36,0,0,.Lscope30-v4_f_Fetch
+.text
+	.align 4
+.stabs "v4_fdrop:F1",36,0,0,v4_fdrop
+	.weak v4_fdrop
+	.type	v4_fdrop,@function
+v4_fdrop:
+.stabn 68,0,326,.LMa185-v4_fdrop
+.LMa185:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic31
+.Lpic31:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic31],%ebx
+0:
+.stabn 68,0,326,.LMb185-v4_fdrop
+.LMb185:
+.LBB31:
+.stabn 68,0,327,.LM186-v4_fdrop
+.LM186:
+	call v4_f_Greater@PLT
+	mov v4_drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE31:
+.stabn 68,0,327,.LM189-v4_fdrop
+.LM189:
+	pop %ebx
+	leave
+	ret
+.Lfe31:
+	.size	 v4_fdrop,.Lfe31-v4_fdrop
+.stabn	192,0,0,.LBB31-v4_fdrop
+.stabn	224,0,0,.LBE31-v4_fdrop
+.Lscope31:
+.stabs	"",36,0,0,.Lscope31-v4_fdrop
+.text
+	.align 4
+.stabs "v4_fswap:F1",36,0,0,v4_fswap
+	.weak v4_fswap
+	.type	v4_fswap,@function
+v4_fswap:
+.stabn 68,0,329,.LMa190-v4_fswap
+.LMa190:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic32
+.Lpic32:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic32],%ebx
+0:
+.stabn 68,0,329,.LMb190-v4_fswap
+.LMb190:
+.LBB32:
+.stabn 68,0,330,.LM191-v4_fswap
+.LM191:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	mov v4_Greaterf@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE32:
+.stabn 68,0,330,.LM197-v4_fswap
+.LM197:
+	pop %ebx
+	leave
+	ret
+.Lfe32:
+	.size	 v4_fswap,.Lfe32-v4_fswap
+.stabn	192,0,0,.LBB32-v4_fswap
+.stabn	224,0,0,.LBE32-v4_fswap
+.Lscope32:
+.stabs	"",36,0,0,.Lscope32-v4_fswap
+.text
+	.align 4
+.stabs "v4_fdup:F1",36,0,0,v4_fdup
+	.weak v4_fdup
+	.type	v4_fdup,@function
+v4_fdup:
+.stabn 68,0,332,.LMa198-v4_fdup
+.LMa198:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic33
+.Lpic33:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic33],%ebx
+0:
+.stabn 68,0,332,.LMb198-v4_fdup
+.LMb198:
+.LBB33:
+.stabn 68,0,333,.LM199-v4_fdup
+.LM199:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	mov v4_Greaterf@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE33:
+.stabn 68,0,333,.LM204-v4_fdup
+.LM204:
+	pop %ebx
+	leave
+	ret
+.Lfe33:
+	.size	 v4_fdup,.Lfe33-v4_fdup
+.stabn	192,0,0,.LBB33-v4_fdup
+.stabn	224,0,0,.LBE33-v4_fdup
+.Lscope33:
+.stabs	"",36,0,0,.Lscope33-v4_fdup
+.text
+	.align 4
+.stabs "v4_fover:F1",36,0,0,v4_fover
+	.weak v4_fover
+	.type	v4_fover,@function
+v4_fover:
+.stabn 68,0,335,.LMa205-v4_fover
+.LMa205:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic35
+.Lpic35:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic35],%ebx
+0:
+.stabn 68,0,335,.LMb205-v4_fover
+.LMb205:
+.LBB35:
+.stabn 68,0,336,.LM206-v4_fover
+.LM206:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM208-v4_fover
+.LM208:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM212-v4_fover
+.LM212:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM214-v4_fover
+.LM214:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	mov v4_Greaterf@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE35:
+.stabn 68,0,336,.LM220-v4_fover
+.LM220:
+	pop %ebx
+	leave
+	ret
+.Lfe35:
+	.size	 v4_fover,.Lfe35-v4_fover
+.stabn	192,0,0,.LBB35-v4_fover
+.stabn	224,0,0,.LBE35-v4_fover
+.Lscope35:
+.stabs	"",36,0,0,.Lscope35-v4_fover
+.text
+	.align 4
+.stabs "v4_frot:F1",36,0,0,v4_frot
+	.weak v4_frot
+	.type	v4_frot,@function
+v4_frot:
+.stabn 68,0,338,.LMa221-v4_frot
+.LMa221:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic36
+.Lpic36:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic36],%ebx
+0:
+.stabn 68,0,338,.LMb221-v4_frot
+.LMb221:
+.LBB36:
+.stabn 68,0,339,.LM222-v4_frot
+.LM222:
+	call v4_f_Greater@PLT
+.stabn 68,0,330,.LM224-v4_frot
+.LM224:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM229-v4_frot
+.LM229:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM231-v4_frot
+.LM231:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	mov v4_Greaterf@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE36:
+.stabn 68,0,339,.LM237-v4_frot
+.LM237:
+	pop %ebx
+	leave
+	ret
+.Lfe36:
+	.size	 v4_frot,.Lfe36-v4_frot
+.stabn	192,0,0,.LBB36-v4_frot
+.stabn	224,0,0,.LBE36-v4_frot
+.Lscope36:
+.stabs	"",36,0,0,.Lscope36-v4_frot
+.text
+	.align 4
+.stabs "v4_faligned:F1",36,0,0,v4_faligned
+	.weak v4_faligned
+	.type	v4_faligned,@function
+v4_faligned:
+.stabn 68,0,341,.LMa238-v4_faligned
+.LMa238:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic37
+.Lpic37:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic37],%ebx
+0:
+.stabn 68,0,341,.LMb238-v4_faligned
+.LMb238:
+.LBB37:
+.stabn 68,0,342,.LM239-v4_faligned
+.LM239:
+	mov v4_aligned@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE37:
+.stabn 68,0,342,.LM241-v4_faligned
+.LM241:
+	pop %ebx
+	leave
+	ret
+.Lfe37:
+	.size	 v4_faligned,.Lfe37-v4_faligned
+.stabn	192,0,0,.LBB37-v4_faligned
+.stabn	224,0,0,.LBE37-v4_faligned
+.Lscope37:
+.stabs	"",36,0,0,.Lscope37-v4_faligned
+.text
+	.align 4
+.stabs "v4_f0_Less:F1",36,0,0,v4_f0_Less
+	.weak v4_f0_Less
+	.type	v4_f0_Less,@function
+v4_f0_Less:
+.stabn 68,0,359,.LMa242-v4_f0_Less
+.LMa242:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic39
+.Lpic39:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic39],%ebx
+0:
+.stabn 68,0,359,.LMb242-v4_f0_Less
+.LMb242:
+.LBB39:
+#APP
+    call v4__fcheck@PLT
+    ftst
+    fnstsw %ax
+    and $0x0100,%ax
+    shl $23,%eax
+    sar $31,%eax
+    call v4__dpush@PLT
+    call v4__fpop@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE39:
+.stabn 68,0,370,.LM252-v4_f0_Less
+.LM252:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe39:
+	.size	 v4_f0_Less,.Lfe39-v4_f0_Less
+.stabn	192,0,0,.LBB39-v4_f0_Less
+.stabn	224,0,0,.LBE39-v4_f0_Less
+.Lscope39:
+.stabs	"",36,0,0,.Lscope39-v4_f0_Less
+.text
+	.align 4
+.stabs "v4_f0_Equals:F1",36,0,0,v4_f0_Equals
+	.weak v4_f0_Equals
+	.type	v4_f0_Equals,@function
+v4_f0_Equals:
+.stabn 68,0,388,.LMa253-v4_f0_Equals
+.LMa253:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic40
+.Lpic40:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic40],%ebx
+0:
+.stabn 68,0,388,.LMb253-v4_f0_Equals
+.LMb253:
+.LBB40:
+#APP
+    call v4__fcheck@PLT
+    ftst
+    fnstsw %ax
+    and $0x4000,%ax
+    shl $17,%eax
+    sar $31,%eax
+    call v4__dpush@PLT
+    call v4__fpop@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE40:
+.stabn 68,0,399,.LM263-v4_f0_Equals
+.LM263:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe40:
+	.size	 v4_f0_Equals,.Lfe40-v4_f0_Equals
+.stabn	192,0,0,.LBB40-v4_f0_Equals
+.stabn	224,0,0,.LBE40-v4_f0_Equals
+.Lscope40:
+.stabs	"",36,0,0,.Lscope40-v4_f0_Equals
+.text
+	.align 4
+.stabs "v4___Parenf_Greater_Closeparen:F1",36,0,0,v4___Parenf_Greater_Closeparen
+	.weak v4___Parenf_Greater_Closeparen
+	.type	v4___Parenf_Greater_Closeparen,@function
+v4___Parenf_Greater_Closeparen:
+.stabn 68,0,422,.LMa264-v4___Parenf_Greater_Closeparen
+.LMa264:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic41
+.Lpic41:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic41],%ebx
+0:
+.stabn 68,0,422,.LMb264-v4___Parenf_Greater_Closeparen
+.LMb264:
+.LBB41:
+#APP
+    call v4__fpop@PLT
+    call v4__fcheck@PLT
+    call v4__fpush@PLT
+    fcompp
+    fnstsw %ax
+    and $0x0100,%ax
+    shl $23,%eax
+    sar $31,%eax
+    call v4__dpush@PLT
+    mov v4__fsindex@GOT(%ebx),%esi
+    sub $2,(%esi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE41:
+.stabn 68,0,438,.LM277-v4___Parenf_Greater_Closeparen
+.LM277:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe41:
+	.size	 v4___Parenf_Greater_Closeparen,.Lfe41-v4___Parenf_Greater_Closeparen
+.stabn	192,0,0,.LBB41-v4___Parenf_Greater_Closeparen
+.stabn	224,0,0,.LBE41-v4___Parenf_Greater_Closeparen
+.Lscope41:
+.stabs	"",36,0,0,.Lscope41-v4___Parenf_Greater_Closeparen
+.text
+	.align 4
+.stabs "v4_f_Less:F1",36,0,0,v4_f_Less
+	.weak v4_f_Less
+	.type	v4_f_Less,@function
+v4_f_Less:
+.stabn 68,0,441,.LMa278-v4_f_Less
+.LMa278:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic42
+.Lpic42:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic42],%ebx
+0:
+.stabn 68,0,441,.LMb278-v4_f_Less
+.LMb278:
+.LBB42:
+.stabn 68,0,330,.LM280-v4_f_Less
+.LM280:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,442,.LM285-v4_f_Less
+.LM285:
+	mov v4___Parenf_Greater_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE42:
+.stabn 68,0,442,.LM287-v4_f_Less
+.LM287:
+	pop %ebx
+	leave
+	ret
+.Lfe42:
+	.size	 v4_f_Less,.Lfe42-v4_f_Less
+.stabn	192,0,0,.LBB42-v4_f_Less
+.stabn	224,0,0,.LBE42-v4_f_Less
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4_f_Less
+.text
+	.align 4
+.stabs "v4_f_Plus:F1",36,0,0,v4_f_Plus
+	.weak v4_f_Plus
+	.type	v4_f_Plus,@function
+v4_f_Plus:
+.stabn 68,0,455,.LMa288-v4_f_Plus
+.LMa288:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic43
+.Lpic43:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic43],%ebx
+0:
+.stabn 68,0,455,.LMb288-v4_f_Plus
+.LMb288:
+.LBB43:
+#APP
+    call v4__fpop@PLT
+    mov v4__fstemp@GOT(%ebx),%edi
+    mov %eax,(%edi)
+    call v4__fcheck@PLT
+    fadds (%edi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE43:
+.stabn 68,0,463,.LM295-v4_f_Plus
+.LM295:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe43:
+	.size	 v4_f_Plus,.Lfe43-v4_f_Plus
+.stabn	192,0,0,.LBB43-v4_f_Plus
+.stabn	224,0,0,.LBE43-v4_f_Plus
+.Lscope43:
+.stabs	"",36,0,0,.Lscope43-v4_f_Plus
+.text
+	.align 4
+.stabs "v4_f_Minus:F1",36,0,0,v4_f_Minus
+	.weak v4_f_Minus
+	.type	v4_f_Minus,@function
+v4_f_Minus:
+.stabn 68,0,477,.LMa296-v4_f_Minus
+.LMa296:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic44
+.Lpic44:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic44],%ebx
+0:
+.stabn 68,0,477,.LMb296-v4_f_Minus
+.LMb296:
+.LBB44:
+#APP
+    call v4__fpop@PLT
+    mov v4__fstemp@GOT(%ebx),%edi
+    mov %eax,(%edi)
+    call v4__fcheck@PLT
+    fsubs (%edi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE44:
+.stabn 68,0,485,.LM303-v4_f_Minus
+.LM303:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe44:
+	.size	 v4_f_Minus,.Lfe44-v4_f_Minus
+.stabn	192,0,0,.LBB44-v4_f_Minus
+.stabn	224,0,0,.LBE44-v4_f_Minus
+.Lscope44:
+.stabs	"",36,0,0,.Lscope44-v4_f_Minus
+.text
+	.align 4
+.stabs "v4_f_Star:F1",36,0,0,v4_f_Star
+	.weak v4_f_Star
+	.type	v4_f_Star,@function
+v4_f_Star:
+.stabn 68,0,499,.LMa304-v4_f_Star
+.LMa304:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic45
+.Lpic45:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic45],%ebx
+0:
+.stabn 68,0,499,.LMb304-v4_f_Star
+.LMb304:
+.LBB45:
+#APP
+    call v4__fpop@PLT
+    mov v4__fstemp@GOT(%ebx),%edi
+    mov %eax,(%edi)
+    call v4__fcheck@PLT
+    fmuls (%edi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE45:
+.stabn 68,0,507,.LM311-v4_f_Star
+.LM311:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe45:
+	.size	 v4_f_Star,.Lfe45-v4_f_Star
+.stabn	192,0,0,.LBB45-v4_f_Star
+.stabn	224,0,0,.LBE45-v4_f_Star
+.Lscope45:
+.stabs	"",36,0,0,.Lscope45-v4_f_Star
+.text
+	.align 4
+.stabs "v4___Parenf_Slash_Closeparen:F1",36,0,0,v4___Parenf_Slash_Closeparen
+	.weak v4___Parenf_Slash_Closeparen
+	.type	v4___Parenf_Slash_Closeparen,@function
+v4___Parenf_Slash_Closeparen:
+.stabn 68,0,521,.LMa312-v4___Parenf_Slash_Closeparen
+.LMa312:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic46
+.Lpic46:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic46],%ebx
+0:
+.stabn 68,0,521,.LMb312-v4___Parenf_Slash_Closeparen
+.LMb312:
+.LBB46:
+#APP
+    call v4__fpop@PLT
+    mov v4__fstemp@GOT(%ebx),%edi
+    mov %eax,(%edi)
+    call v4__fcheck@PLT
+    fdivs (%edi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE46:
+.stabn 68,0,529,.LM319-v4___Parenf_Slash_Closeparen
+.LM319:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe46:
+	.size	 v4___Parenf_Slash_Closeparen,.Lfe46-v4___Parenf_Slash_Closeparen
+.stabn	192,0,0,.LBB46-v4___Parenf_Slash_Closeparen
+.stabn	224,0,0,.LBE46-v4___Parenf_Slash_Closeparen
+.Lscope46:
+.stabs	"",36,0,0,.Lscope46-v4___Parenf_Slash_Closeparen
+.text
+	.align 4
+.stabs "v4_f_Slash:F1",36,0,0,v4_f_Slash
+	.weak v4_f_Slash
+	.type	v4_f_Slash,@function
+v4_f_Slash:
+.stabn 68,0,532,.LMa320-v4_f_Slash
+.LMa320:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic47
+.Lpic47:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic47],%ebx
+0:
+.stabn 68,0,532,.LMb320-v4_f_Slash
+.LMb320:
+.LBB47:
+.stabn 68,0,333,.LM322-v4_f_Slash
+.LM322:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,533,.LM326-v4_f_Slash
+.LM326:
+	call v4_f0_Equals@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L22
+	mov $-42,%eax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.L22:
+	mov v4___Parenf_Slash_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE47:
+.stabn 68,0,533,.LM335-v4_f_Slash
+.LM335:
+	pop %ebx
+	leave
+	ret
+.Lfe47:
+	.size	 v4_f_Slash,.Lfe47-v4_f_Slash
+.stabn	192,0,0,.LBB47-v4_f_Slash
+.stabn	224,0,0,.LBE47-v4_f_Slash
+.Lscope47:
+.stabs	"",36,0,0,.Lscope47-v4_f_Slash
+.text
+	.align 4
+.stabs "v4_fabs:F1",36,0,0,v4_fabs
+	.weak v4_fabs
+	.type	v4_fabs,@function
+v4_fabs:
+.stabn 68,0,535,.LMa336-v4_fabs
+.LMa336:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic49
+.Lpic49:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic49],%ebx
+0:
+.stabn 68,0,535,.LMb336-v4_fabs
+.LMb336:
+.LBB49:
+#APP
+    call v4__fcheck@PLT
+    fabs
+    forth_pic.=0b-0b
+#NO_APP
+.LBE49:
+.stabn 68,0,540,.LM340-v4_fabs
+.LM340:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe49:
+	.size	 v4_fabs,.Lfe49-v4_fabs
+.stabn	192,0,0,.LBB49-v4_fabs
+.stabn	224,0,0,.LBE49-v4_fabs
+.Lscope49:
+.stabs	"",36,0,0,.Lscope49-v4_fabs
+.text
+	.align 4
+.stabs "v4_fround:F1",36,0,0,v4_fround
+	.weak v4_fround
+	.type	v4_fround,@function
+v4_fround:
+.stabn 68,0,542,.LMa341-v4_fround
+.LMa341:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic50
+.Lpic50:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic50],%ebx
+0:
+.stabn 68,0,542,.LMb341-v4_fround
+.LMb341:
+.LBB50:
+#APP
+    call v4__fcheck@PLT
+    frndint
+    forth_pic.=0b-0b
+#NO_APP
+.LBE50:
+.stabn 68,0,547,.LM345-v4_fround
+.LM345:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe50:
+	.size	 v4_fround,.Lfe50-v4_fround
+.stabn	192,0,0,.LBB50-v4_fround
+.stabn	224,0,0,.LBE50-v4_fround
+.Lscope50:
+.stabs	"",36,0,0,.Lscope50-v4_fround
+.text
+	.align 4
+.stabs "v4_fnegate:F1",36,0,0,v4_fnegate
+	.weak v4_fnegate
+	.type	v4_fnegate,@function
+v4_fnegate:
+.stabn 68,0,549,.LMa346-v4_fnegate
+.LMa346:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic51
+.Lpic51:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic51],%ebx
+0:
+.stabn 68,0,549,.LMb346-v4_fnegate
+.LMb346:
+.LBB51:
+#APP
+    call v4__fcheck@PLT
+    fchs
+    forth_pic.=0b-0b
+#NO_APP
+.LBE51:
+.stabn 68,0,554,.LM350-v4_fnegate
+.LM350:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe51:
+	.size	 v4_fnegate,.Lfe51-v4_fnegate
+.stabn	192,0,0,.LBB51-v4_fnegate
+.stabn	224,0,0,.LBE51-v4_fnegate
+.Lscope51:
+.stabs	"",36,0,0,.Lscope51-v4_fnegate
+.text
+	.align 4
+.stabs "v4_f_Tilde:F1",36,0,0,v4_f_Tilde
+	.weak v4_f_Tilde
+	.type	v4_f_Tilde,@function
+v4_f_Tilde:
+.stabn 68,0,556,.LMa351-v4_f_Tilde
+.LMa351:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic52
+.Lpic52:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic52],%ebx
+0:
+.stabn 68,0,556,.LMb351-v4_f_Tilde
+.LMb351:
+.LBB52:
+.stabn 68,0,333,.LM353-v4_f_Tilde
+.LM353:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,557,.LM357-v4_f_Tilde
+.LM357:
+	call v4_f0_Equals@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L24
+.stabn 68,0,327,.LM361-v4_f_Tilde
+.LM361:
+	call v4_f_Greater@PLT
+	call v4_drop@PLT
+.stabn 68,0,558,.LM363-v4_f_Tilde
+.LM363:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush@PLT
+.stabn 68,0,560,.LM370-v4_f_Tilde
+.LM370:
+	jmp .L25
+.L24:
+.stabn 68,0,333,.LM373-v4_f_Tilde
+.LM373:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,560,.LM377-v4_f_Tilde
+.LM377:
+	call v4_f0_Less@PLT
+	call v4__dpop@PLT
+	not %eax
+	test %eax,%eax
+	je .L26
+.stabn 68,0,339,.LM385-v4_f_Tilde
+.LM385:
+	call v4_f_Greater@PLT
+.stabn 68,0,330,.LM387-v4_f_Tilde
+.LM387:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM392-v4_f_Tilde
+.LM392:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM394-v4_f_Tilde
+.LM394:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM400-v4_f_Tilde
+.LM400:
+	call v4_f_Greater@PLT
+.stabn 68,0,330,.LM402-v4_f_Tilde
+.LM402:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM407-v4_f_Tilde
+.LM407:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM409-v4_f_Tilde
+.LM409:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,561,.LM414-v4_f_Tilde
+.LM414:
+	call v4_f_Minus@PLT
+	call v4_fabs@PLT
+.stabn 68,0,330,.LM417-v4_f_Tilde
+.LM417:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM424-v4_f_Tilde
+.LM424:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,442,.LM429-v4_f_Tilde
+.LM429:
+	mov v4___Parenf_Greater_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.L26:
+.stabn 68,0,564,.LM432-v4_f_Tilde
+.LM432:
+	call v4_fabs@PLT
+.stabn 68,0,339,.LM434-v4_f_Tilde
+.LM434:
+	call v4_f_Greater@PLT
+.stabn 68,0,330,.LM436-v4_f_Tilde
+.LM436:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM441-v4_f_Tilde
+.LM441:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM443-v4_f_Tilde
+.LM443:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM449-v4_f_Tilde
+.LM449:
+	call v4_f_Greater@PLT
+.stabn 68,0,330,.LM451-v4_f_Tilde
+.LM451:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM456-v4_f_Tilde
+.LM456:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM458-v4_f_Tilde
+.LM458:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM464-v4_f_Tilde
+.LM464:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM466-v4_f_Tilde
+.LM466:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM470-v4_f_Tilde
+.LM470:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM472-v4_f_Tilde
+.LM472:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM478-v4_f_Tilde
+.LM478:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM480-v4_f_Tilde
+.LM480:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM484-v4_f_Tilde
+.LM484:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM486-v4_f_Tilde
+.LM486:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,565,.LM491-v4_f_Tilde
+.LM491:
+	call v4_f_Minus@PLT
+	call v4_fabs@PLT
+	call v4_f_Greater@PLT
+.stabn 68,0,566,.LM494-v4_f_Tilde
+.LM494:
+	call v4_fabs@PLT
+.stabn 68,0,330,.LM496-v4_f_Tilde
+.LM496:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,566,.LM501-v4_f_Tilde
+.LM501:
+	call v4_fabs@PLT
+	call v4_f_Plus@PLT
+	call v4_f_Star@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM506-v4_f_Tilde
+.LM506:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM513-v4_f_Tilde
+.LM513:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,442,.LM518-v4_f_Tilde
+.LM518:
+	mov v4___Parenf_Greater_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.L27:
+.L25:
+.LBE52:
+.stabn 68,0,568,.LM522-v4_f_Tilde
+.LM522:
+	pop %ebx
+	leave
+	ret
+.Lfe52:
+	.size	 v4_f_Tilde,.Lfe52-v4_f_Tilde
+.stabn	192,0,0,.LBB52-v4_f_Tilde
+.stabn	224,0,0,.LBE52-v4_f_Tilde
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4_f_Tilde
+.text
+	.align 4
+.stabs "v4_fmax:F1",36,0,0,v4_fmax
+	.weak v4_fmax
+	.type	v4_fmax,@function
+v4_fmax:
+.stabn 68,0,570,.LMa523-v4_fmax
+.LMa523:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic55
+.Lpic55:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic55],%ebx
+0:
+.stabn 68,0,570,.LMb523-v4_fmax
+.LMb523:
+.LBB55:
+.stabn 68,0,336,.LM525-v4_fmax
+.LM525:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM527-v4_fmax
+.LM527:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM531-v4_fmax
+.LM531:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM533-v4_fmax
+.LM533:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM539-v4_fmax
+.LM539:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM541-v4_fmax
+.LM541:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM545-v4_fmax
+.LM545:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM547-v4_fmax
+.LM547:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM554-v4_fmax
+.LM554:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,442,.LM559-v4_fmax
+.LM559:
+	call v4___Parenf_Greater_Closeparen@PLT
+.stabn 68,0,571,.LM560-v4_fmax
+.LM560:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L29
+.stabn 68,0,330,.LM563-v4_fmax
+.LM563:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.L29:
+.stabn 68,0,327,.LM570-v4_fmax
+.LM570:
+	call v4_f_Greater@PLT
+	mov v4_drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE55:
+.stabn 68,0,571,.LM573-v4_fmax
+.LM573:
+	pop %ebx
+	leave
+	ret
+.Lfe55:
+	.size	 v4_fmax,.Lfe55-v4_fmax
+.stabn	192,0,0,.LBB55-v4_fmax
+.stabn	224,0,0,.LBE55-v4_fmax
+.Lscope55:
+.stabs	"",36,0,0,.Lscope55-v4_fmax
+.text
+	.align 4
+.stabs "v4_fmin:F1",36,0,0,v4_fmin
+	.weak v4_fmin
+	.type	v4_fmin,@function
+v4_fmin:
+.stabn 68,0,573,.LMa574-v4_fmin
+.LMa574:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic56
+.Lpic56:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic56],%ebx
+0:
+.stabn 68,0,573,.LMb574-v4_fmin
+.LMb574:
+.LBB56:
+.stabn 68,0,336,.LM576-v4_fmin
+.LM576:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM578-v4_fmin
+.LM578:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM582-v4_fmin
+.LM582:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM584-v4_fmin
+.LM584:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM590-v4_fmin
+.LM590:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM592-v4_fmin
+.LM592:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM596-v4_fmin
+.LM596:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM598-v4_fmin
+.LM598:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM604-v4_fmin
+.LM604:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM611-v4_fmin
+.LM611:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,442,.LM616-v4_fmin
+.LM616:
+	call v4___Parenf_Greater_Closeparen@PLT
+.stabn 68,0,574,.LM617-v4_fmin
+.LM617:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L31
+.stabn 68,0,330,.LM620-v4_fmin
+.LM620:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.L31:
+.stabn 68,0,327,.LM627-v4_fmin
+.LM627:
+	call v4_f_Greater@PLT
+	mov v4_drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE56:
+.stabn 68,0,574,.LM630-v4_fmin
+.LM630:
+	pop %ebx
+	leave
+	ret
+.Lfe56:
+	.size	 v4_fmin,.Lfe56-v4_fmin
+.stabn	192,0,0,.LBB56-v4_fmin
+.stabn	224,0,0,.LBE56-v4_fmin
+.Lscope56:
+.stabs	"",36,0,0,.Lscope56-v4_fmin
+.text
+	.align 4
+.stabs "v4_fsqrt:F1",36,0,0,v4_fsqrt
+	.weak v4_fsqrt
+	.type	v4_fsqrt,@function
+v4_fsqrt:
+.stabn 68,0,576,.LMa631-v4_fsqrt
+.LMa631:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic57
+.Lpic57:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic57],%ebx
+0:
+.stabn 68,0,576,.LMb631-v4_fsqrt
+.LMb631:
+.LBB57:
+#APP
+    call v4__fcheck@PLT
+    fsqrt
+    forth_pic.=0b-0b
+#NO_APP
+.LBE57:
+.stabn 68,0,581,.LM635-v4_fsqrt
+.LM635:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe57:
+	.size	 v4_fsqrt,.Lfe57-v4_fsqrt
+.stabn	192,0,0,.LBB57-v4_fsqrt
+.stabn	224,0,0,.LBE57-v4_fsqrt
+.Lscope57:
+.stabs	"",36,0,0,.Lscope57-v4_fsqrt
+.text
+	.align 4
+.stabs "v4_fsin:F1",36,0,0,v4_fsin
+	.weak v4_fsin
+	.type	v4_fsin,@function
+v4_fsin:
+.stabn 68,0,583,.LMa636-v4_fsin
+.LMa636:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic58
+.Lpic58:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic58],%ebx
+0:
+.stabn 68,0,583,.LMb636-v4_fsin
+.LMb636:
+.LBB58:
+#APP
+    call v4__fcheck@PLT
+    fsin
+    forth_pic.=0b-0b
+#NO_APP
+.LBE58:
+.stabn 68,0,588,.LM640-v4_fsin
+.LM640:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe58:
+	.size	 v4_fsin,.Lfe58-v4_fsin
+.stabn	192,0,0,.LBB58-v4_fsin
+.stabn	224,0,0,.LBE58-v4_fsin
+.Lscope58:
+.stabs	"",36,0,0,.Lscope58-v4_fsin
+.text
+	.align 4
+.stabs "v4_fcos:F1",36,0,0,v4_fcos
+	.weak v4_fcos
+	.type	v4_fcos,@function
+v4_fcos:
+.stabn 68,0,590,.LMa641-v4_fcos
+.LMa641:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic59
+.Lpic59:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic59],%ebx
+0:
+.stabn 68,0,590,.LMb641-v4_fcos
+.LMb641:
+.LBB59:
+#APP
+    call v4__fcheck@PLT
+    fcos
+    forth_pic.=0b-0b
+#NO_APP
+.LBE59:
+.stabn 68,0,595,.LM645-v4_fcos
+.LM645:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe59:
+	.size	 v4_fcos,.Lfe59-v4_fcos
+.stabn	192,0,0,.LBB59-v4_fcos
+.stabn	224,0,0,.LBE59-v4_fcos
+.Lscope59:
+.stabs	"",36,0,0,.Lscope59-v4_fcos
+.text
+	.align 4
+.stabs "v4_fsincos:F1",36,0,0,v4_fsincos
+	.weak v4_fsincos
+	.type	v4_fsincos,@function
+v4_fsincos:
+.stabn 68,0,597,.LMa646-v4_fsincos
+.LMa646:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic60
+.Lpic60:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic60],%ebx
+0:
+.stabn 68,0,597,.LMb646-v4_fsincos
+.LMb646:
+.LBB60:
+#APP
+    call v4__fcheck@PLT
+    fsincos
+    forth_pic.=0b-0b
+#NO_APP
+.LBE60:
+.stabn 68,0,602,.LM650-v4_fsincos
+.LM650:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe60:
+	.size	 v4_fsincos,.Lfe60-v4_fsincos
+.stabn	192,0,0,.LBB60-v4_fsincos
+.stabn	224,0,0,.LBE60-v4_fsincos
+.Lscope60:
+.stabs	"",36,0,0,.Lscope60-v4_fsincos
+.text
+	.align 4
+.stabs "v4_ftan:F1",36,0,0,v4_ftan
+	.weak v4_ftan
+	.type	v4_ftan,@function
+v4_ftan:
+.stabn 68,0,604,.LMa651-v4_ftan
+.LMa651:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic61
+.Lpic61:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic61],%ebx
+0:
+.stabn 68,0,604,.LMb651-v4_ftan
+.LMb651:
+.LBB61:
+.stabn 68,0,605,.LM652-v4_ftan
+.LM652:
+	call v4_fsincos@PLT
+.stabn 68,0,333,.LM655-v4_ftan
+.LM655:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,533,.LM659-v4_ftan
+.LM659:
+	call v4_f0_Equals@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L32
+	mov $-42,%eax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.L32:
+	mov v4___Parenf_Slash_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE61:
+.stabn 68,0,605,.LM668-v4_ftan
+.LM668:
+	pop %ebx
+	leave
+	ret
+.Lfe61:
+	.size	 v4_ftan,.Lfe61-v4_ftan
+.stabn	192,0,0,.LBB61-v4_ftan
+.stabn	224,0,0,.LBE61-v4_ftan
+.Lscope61:
+.stabs	"",36,0,0,.Lscope61-v4_ftan
+.text
+	.align 4
+.stabs "v4___Parenfyl2x_Closeparen:F1",36,0,0,v4___Parenfyl2x_Closeparen
+	.weak v4___Parenfyl2x_Closeparen
+	.type	v4___Parenfyl2x_Closeparen,@function
+v4___Parenfyl2x_Closeparen:
+.stabn 68,0,620,.LMa669-v4___Parenfyl2x_Closeparen
+.LMa669:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic62
+.Lpic62:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic62],%ebx
+0:
+.stabn 68,0,620,.LMb669-v4___Parenfyl2x_Closeparen
+.LMb669:
+.LBB62:
+#APP
+    call v4__fpop@PLT
+    call v4__fcheck@PLT
+    call v4__fpush@PLT
+    fyl2x
+    mov v4__fsindex@GOT(%ebx),%esi
+    decl (%esi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE62:
+.stabn 68,0,630,.LM677-v4___Parenfyl2x_Closeparen
+.LM677:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe62:
+	.size	 v4___Parenfyl2x_Closeparen,.Lfe62-v4___Parenfyl2x_Closeparen
+.stabn	192,0,0,.LBB62-v4___Parenfyl2x_Closeparen
+.stabn	224,0,0,.LBE62-v4___Parenfyl2x_Closeparen
+.Lscope62:
+.stabs	"",36,0,0,.Lscope62-v4___Parenfyl2x_Closeparen
+.text
+	.align 4
+.stabs "v4___Parenflog2_Closeparen:F1",36,0,0,v4___Parenflog2_Closeparen
+	.weak v4___Parenflog2_Closeparen
+	.type	v4___Parenflog2_Closeparen,@function
+v4___Parenflog2_Closeparen:
+.stabn 68,0,633,.LMa678-v4___Parenflog2_Closeparen
+.LMa678:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic63
+.Lpic63:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic63],%ebx
+0:
+.stabn 68,0,633,.LMb678-v4___Parenflog2_Closeparen
+.LMb678:
+.LBB63:
+.stabn 68,0,634,.LM679-v4___Parenflog2_Closeparen
+.LM679:
+	mov $1065353216,%eax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM682-v4___Parenflog2_Closeparen
+.LM682:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,634,.LM687-v4___Parenflog2_Closeparen
+.LM687:
+	mov v4___Parenfyl2x_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE63:
+.stabn 68,0,634,.LM689-v4___Parenflog2_Closeparen
+.LM689:
+	pop %ebx
+	leave
+	ret
+.Lfe63:
+	.size	 v4___Parenflog2_Closeparen,.Lfe63-v4___Parenflog2_Closeparen
+.stabn	192,0,0,.LBB63-v4___Parenflog2_Closeparen
+.stabn	224,0,0,.LBE63-v4___Parenflog2_Closeparen
+.Lscope63:
+.stabs	"",36,0,0,.Lscope63-v4___Parenflog2_Closeparen
+.text
+	.align 4
+.stabs "v4_fln:F1",36,0,0,v4_fln
+	.weak v4_fln
+	.type	v4_fln,@function
+v4_fln:
+.stabn 68,0,636,.LMa690-v4_fln
+.LMa690:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic64
+.Lpic64:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic64],%ebx
+0:
+.stabn 68,0,636,.LMb690-v4_fln
+.LMb690:
+.LBB64:
+.stabn 68,0,634,.LM692-v4_fln
+.LM692:
+	mov $1065353216,%eax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM695-v4_fln
+.LM695:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,634,.LM700-v4_fln
+.LM700:
+	call v4___Parenfyl2x_Closeparen@PLT
+.stabn 68,0,637,.LM701-v4_fln
+.LM701:
+	mov $1060205080,%eax
+	call v4__fpush@PLT
+	mov v4_f_Star@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE64:
+.stabn 68,0,637,.LM705-v4_fln
+.LM705:
+	pop %ebx
+	leave
+	ret
+.Lfe64:
+	.size	 v4_fln,.Lfe64-v4_fln
+.stabn	192,0,0,.LBB64-v4_fln
+.stabn	224,0,0,.LBE64-v4_fln
+.Lscope64:
+.stabs	"",36,0,0,.Lscope64-v4_fln
+.text
+	.align 4
+.stabs "v4_flnp1:F1",36,0,0,v4_flnp1
+	.weak v4_flnp1
+	.type	v4_flnp1,@function
+v4_flnp1:
+.stabn 68,0,639,.LMa706-v4_flnp1
+.LMa706:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic65
+.Lpic65:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic65],%ebx
+0:
+.stabn 68,0,639,.LMb706-v4_flnp1
+.LMb706:
+.LBB65:
+.stabn 68,0,640,.LM707-v4_flnp1
+.LM707:
+	mov $1065353216,%eax
+	call v4__fpush@PLT
+	call v4_f_Plus@PLT
+.stabn 68,0,634,.LM712-v4_flnp1
+.LM712:
+	mov $1065353216,%eax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM714-v4_flnp1
+.LM714:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,634,.LM719-v4_flnp1
+.LM719:
+	call v4___Parenfyl2x_Closeparen@PLT
+.stabn 68,0,637,.LM720-v4_flnp1
+.LM720:
+	mov $1060205080,%eax
+	call v4__fpush@PLT
+	mov v4_f_Star@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE65:
+.stabn 68,0,640,.LM724-v4_flnp1
+.LM724:
+	pop %ebx
+	leave
+	ret
+.Lfe65:
+	.size	 v4_flnp1,.Lfe65-v4_flnp1
+.stabn	192,0,0,.LBB65-v4_flnp1
+.stabn	224,0,0,.LBE65-v4_flnp1
+.Lscope65:
+.stabs	"",36,0,0,.Lscope65-v4_flnp1
+.text
+	.align 4
+.stabs "v4_flog:F1",36,0,0,v4_flog
+	.weak v4_flog
+	.type	v4_flog,@function
+v4_flog:
+.stabn 68,0,642,.LMa725-v4_flog
+.LMa725:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic66
+.Lpic66:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic66],%ebx
+0:
+.stabn 68,0,642,.LMb725-v4_flog
+.LMb725:
+.LBB66:
+.stabn 68,0,634,.LM727-v4_flog
+.LM727:
+	mov $1065353216,%eax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM730-v4_flog
+.LM730:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,634,.LM735-v4_flog
+.LM735:
+	call v4___Parenfyl2x_Closeparen@PLT
+.stabn 68,0,643,.LM736-v4_flog
+.LM736:
+	mov $1050288283,%eax
+	call v4__fpush@PLT
+	mov v4_f_Star@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE66:
+.stabn 68,0,643,.LM740-v4_flog
+.LM740:
+	pop %ebx
+	leave
+	ret
+.Lfe66:
+	.size	 v4_flog,.Lfe66-v4_flog
+.stabn	192,0,0,.LBB66-v4_flog
+.stabn	224,0,0,.LBE66-v4_flog
+.Lscope66:
+.stabs	"",36,0,0,.Lscope66-v4_flog
+.text
+	.align 4
+.stabs "v4___Parenf2xm1_Closeparen:F1",36,0,0,v4___Parenf2xm1_Closeparen
+	.weak v4___Parenf2xm1_Closeparen
+	.type	v4___Parenf2xm1_Closeparen,@function
+v4___Parenf2xm1_Closeparen:
+.stabn 68,0,645,.LMa741-v4___Parenf2xm1_Closeparen
+.LMa741:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic67
+.Lpic67:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic67],%ebx
+0:
+.stabn 68,0,645,.LMb741-v4___Parenf2xm1_Closeparen
+.LMb741:
+.LBB67:
+#APP
+    call v4__fcheck@PLT
+    f2xm1
+    forth_pic.=0b-0b
+#NO_APP
+.LBE67:
+.stabn 68,0,650,.LM745-v4___Parenf2xm1_Closeparen
+.LM745:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe67:
+	.size	 v4___Parenf2xm1_Closeparen,.Lfe67-v4___Parenf2xm1_Closeparen
+.stabn	192,0,0,.LBB67-v4___Parenf2xm1_Closeparen
+.stabn	224,0,0,.LBE67-v4___Parenf2xm1_Closeparen
+.Lscope67:
+.stabs	"",36,0,0,.Lscope67-v4___Parenf2xm1_Closeparen
+.text
+	.align 4
+.stabs "v4___Parenfscale_Closeparen:F1",36,0,0,v4___Parenfscale_Closeparen
+	.weak v4___Parenfscale_Closeparen
+	.type	v4___Parenfscale_Closeparen,@function
+v4___Parenfscale_Closeparen:
+.stabn 68,0,652,.LMa746-v4___Parenfscale_Closeparen
+.LMa746:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic68
+.Lpic68:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic68],%ebx
+0:
+.stabn 68,0,652,.LMb746-v4___Parenfscale_Closeparen
+.LMb746:
+.LBB68:
+#APP
+    call v4__fpop@PLT
+    call v4__fcheck@PLT
+    call v4__fpush@PLT
+    fscale
+    forth_pic.=0b-0b
+#NO_APP
+.LBE68:
+.stabn 68,0,659,.LM752-v4___Parenfscale_Closeparen
+.LM752:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe68:
+	.size	 v4___Parenfscale_Closeparen,.Lfe68-v4___Parenfscale_Closeparen
+.stabn	192,0,0,.LBB68-v4___Parenfscale_Closeparen
+.stabn	224,0,0,.LBE68-v4___Parenfscale_Closeparen
+.Lscope68:
+.stabs	"",36,0,0,.Lscope68-v4___Parenfscale_Closeparen
+.text
+	.align 4
+.stabs "v4_f_Star_Star:F1",36,0,0,v4_f_Star_Star
+	.weak v4_f_Star_Star
+	.type	v4_f_Star_Star,@function
+v4_f_Star_Star:
+.stabn 68,0,661,.LMa753-v4_f_Star_Star
+.LMa753:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic69
+.Lpic69:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic69],%ebx
+0:
+.stabn 68,0,661,.LMb753-v4_f_Star_Star
+.LMb753:
+.LBB69:
+.stabn 68,0,330,.LM755-v4_f_Star_Star
+.LM755:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,634,.LM761-v4_f_Star_Star
+.LM761:
+	mov $1065353216,%eax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM764-v4_f_Star_Star
+.LM764:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,634,.LM769-v4_f_Star_Star
+.LM769:
+	call v4___Parenfyl2x_Closeparen@PLT
+.stabn 68,0,662,.LM770-v4_f_Star_Star
+.LM770:
+	call v4_f_Star@PLT
+.stabn 68,0,333,.LM772-v4_f_Star_Star
+.LM772:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,663,.LM776-v4_f_Star_Star
+.LM776:
+	call v4_f_Greaterd@PLT
+	call v4_d_Greaterf@PLT
+.stabn 68,0,330,.LM779-v4_f_Star_Star
+.LM779:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM785-v4_f_Star_Star
+.LM785:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM787-v4_f_Star_Star
+.LM787:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM791-v4_f_Star_Star
+.LM791:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM793-v4_f_Star_Star
+.LM793:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,664,.LM798-v4_f_Star_Star
+.LM798:
+	call v4_f_Minus@PLT
+.stabn 68,0,665,.LM799-v4_f_Star_Star
+.LM799:
+	call v4___Parenf2xm1_Closeparen@PLT
+	mov $1065353216,%eax
+	call v4__fpush@PLT
+	call v4_f_Plus@PLT
+.stabn 68,0,666,.LM803-v4_f_Star_Star
+.LM803:
+	call v4___Parenfscale_Closeparen@PLT
+.stabn 68,0,330,.LM805-v4_f_Star_Star
+.LM805:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,327,.LM811-v4_f_Star_Star
+.LM811:
+	call v4_f_Greater@PLT
+	mov v4_drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE69:
+.stabn 68,0,667,.LM814-v4_f_Star_Star
+.LM814:
+	pop %ebx
+	leave
+	ret
+.Lfe69:
+	.size	 v4_f_Star_Star,.Lfe69-v4_f_Star_Star
+.stabn	192,0,0,.LBB69-v4_f_Star_Star
+.stabn	224,0,0,.LBE69-v4_f_Star_Star
+.Lscope69:
+.stabs	"",36,0,0,.Lscope69-v4_f_Star_Star
+.text
+	.align 4
+.stabs "v4_fexp:F1",36,0,0,v4_fexp
+	.weak v4_fexp
+	.type	v4_fexp,@function
+v4_fexp:
+.stabn 68,0,669,.LMa815-v4_fexp
+.LMa815:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic70
+.Lpic70:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic70],%ebx
+0:
+.stabn 68,0,669,.LMb815-v4_fexp
+.LMb815:
+.LBB70:
+.stabn 68,0,670,.LM816-v4_fexp
+.LM816:
+	mov $1076754516,%eax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM819-v4_fexp
+.LM819:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,670,.LM824-v4_fexp
+.LM824:
+	mov v4_f_Star_Star@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE70:
+.stabn 68,0,670,.LM826-v4_fexp
+.LM826:
+	pop %ebx
+	leave
+	ret
+.Lfe70:
+	.size	 v4_fexp,.Lfe70-v4_fexp
+.stabn	192,0,0,.LBB70-v4_fexp
+.stabn	224,0,0,.LBE70-v4_fexp
+.Lscope70:
+.stabs	"",36,0,0,.Lscope70-v4_fexp
+.text
+	.align 4
+.stabs "v4_fexpm1:F1",36,0,0,v4_fexpm1
+	.weak v4_fexpm1
+	.type	v4_fexpm1,@function
+v4_fexpm1:
+.stabn 68,0,672,.LMa827-v4_fexpm1
+.LMa827:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic71
+.Lpic71:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic71],%ebx
+0:
+.stabn 68,0,672,.LMb827-v4_fexpm1
+.LMb827:
+.LBB71:
+.stabn 68,0,670,.LM829-v4_fexpm1
+.LM829:
+	mov $1076754516,%eax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM832-v4_fexpm1
+.LM832:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,670,.LM837-v4_fexpm1
+.LM837:
+	call v4_f_Star_Star@PLT
+.stabn 68,0,673,.LM838-v4_fexpm1
+.LM838:
+	mov $1065353216,%eax
+	call v4__fpush@PLT
+	mov v4_f_Minus@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE71:
+.stabn 68,0,673,.LM842-v4_fexpm1
+.LM842:
+	pop %ebx
+	leave
+	ret
+.Lfe71:
+	.size	 v4_fexpm1,.Lfe71-v4_fexpm1
+.stabn	192,0,0,.LBB71-v4_fexpm1
+.stabn	224,0,0,.LBE71-v4_fexpm1
+.Lscope71:
+.stabs	"",36,0,0,.Lscope71-v4_fexpm1
+.text
+	.align 4
+.stabs "v4_falog:F1",36,0,0,v4_falog
+	.weak v4_falog
+	.type	v4_falog,@function
+v4_falog:
+.stabn 68,0,675,.LMa843-v4_falog
+.LMa843:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic72
+.Lpic72:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic72],%ebx
+0:
+.stabn 68,0,675,.LMb843-v4_falog
+.LMb843:
+.LBB72:
+.stabn 68,0,676,.LM844-v4_falog
+.LM844:
+	mov $1092616192,%eax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM847-v4_falog
+.LM847:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,670,.LM853-v4_falog
+.LM853:
+	mov $1076754516,%eax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM856-v4_falog
+.LM856:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,670,.LM861-v4_falog
+.LM861:
+	mov v4_f_Star_Star@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE72:
+.stabn 68,0,676,.LM863-v4_falog
+.LM863:
+	pop %ebx
+	leave
+	ret
+.Lfe72:
+	.size	 v4_falog,.Lfe72-v4_falog
+.stabn	192,0,0,.LBB72-v4_falog
+.stabn	224,0,0,.LBE72-v4_falog
+.Lscope72:
+.stabs	"",36,0,0,.Lscope72-v4_falog
+.text
+	.align 4
+.stabs "v4_sf_Store:F1",36,0,0,v4_sf_Store
+	.weak v4_sf_Store
+	.type	v4_sf_Store,@function
+v4_sf_Store:
+.stabn 68,0,678,.LMa864-v4_sf_Store
+.LMa864:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic73
+.Lpic73:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic73],%ebx
+0:
+.stabn 68,0,678,.LMb864-v4_sf_Store
+.LMb864:
+.LBB73:
+.stabn 68,0,321,.LM866-v4_sf_Store
+.LM866:
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	mov v4_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE73:
+.stabn 68,0,679,.LM870-v4_sf_Store
+.LM870:
+	pop %ebx
+	leave
+	ret
+.Lfe73:
+	.size	 v4_sf_Store,.Lfe73-v4_sf_Store
+.stabn	192,0,0,.LBB73-v4_sf_Store
+.stabn	224,0,0,.LBE73-v4_sf_Store
+.Lscope73:
+.stabs	"",36,0,0,.Lscope73-v4_sf_Store
+.text
+	.align 4
+.stabs "v4_sf_Fetch:F1",36,0,0,v4_sf_Fetch
+	.weak v4_sf_Fetch
+	.type	v4_sf_Fetch,@function
+v4_sf_Fetch:
+.stabn 68,0,681,.LMa871-v4_sf_Fetch
+.LMa871:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic74
+.Lpic74:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic74],%ebx
+0:
+.stabn 68,0,681,.LMb871-v4_sf_Fetch
+.LMb871:
+.LBB74:
+.stabn 68,0,324,.LM873-v4_sf_Fetch
+.LM873:
+	call v4_Fetch@PLT
+	mov v4_Greaterf@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE74:
+.stabn 68,0,682,.LM876-v4_sf_Fetch
+.LM876:
+	pop %ebx
+	leave
+	ret
+.Lfe74:
+	.size	 v4_sf_Fetch,.Lfe74-v4_sf_Fetch
+.stabn	192,0,0,.LBB74-v4_sf_Fetch
+.stabn	224,0,0,.LBE74-v4_sf_Fetch
+.Lscope74:
+.stabs	"",36,0,0,.Lscope74-v4_sf_Fetch
+.text
+	.align 4
+.stabs "v4_sfaligned:F1",36,0,0,v4_sfaligned
+	.weak v4_sfaligned
+	.type	v4_sfaligned,@function
+v4_sfaligned:
+.stabn 68,0,684,.LMa877-v4_sfaligned
+.LMa877:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic75
+.Lpic75:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic75],%ebx
+0:
+.stabn 68,0,684,.LMb877-v4_sfaligned
+.LMb877:
+.LBB75:
+.stabn 68,0,342,.LM879-v4_sfaligned
+.LM879:
+	mov v4_aligned@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE75:
+.stabn 68,0,685,.LM881-v4_sfaligned
+.LM881:
+	pop %ebx
+	leave
+	ret
+.Lfe75:
+	.size	 v4_sfaligned,.Lfe75-v4_sfaligned
+.stabn	192,0,0,.LBB75-v4_sfaligned
+.stabn	224,0,0,.LBE75-v4_sfaligned
+.Lscope75:
+.stabs	"",36,0,0,.Lscope75-v4_sfaligned
+.text
+	.align 4
+.stabs "v4_sfloat:F1",36,0,0,v4_sfloat
+	.weak v4_sfloat
+	.type	v4_sfloat,@function
+v4_sfloat:
+.stabn 68,0,687,.LMa882-v4_sfloat
+.LMa882:
+	push %ebx
+	call .Lpic76
+.Lpic76:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic76],%ebx
+0:
+.stabn 68,0,687,.LMb882-v4_sfloat
+.LMb882:
+.LBB76:
+.stabn 68,0,205,.LM884-v4_sfloat
+.LM884:
+	mov $4,%eax
+	call v4__dpush@PLT
+.LBE76:
+.stabn 68,0,687,.LM887-v4_sfloat
+.LM887:
+	pop %ebx
+	ret
+.Lfe76:
+	.size	 v4_sfloat,.Lfe76-v4_sfloat
+.stabn	192,0,0,.LBB76-v4_sfloat
+.stabn	224,0,0,.LBE76-v4_sfloat
+.Lscope76:
+.stabs	"",36,0,0,.Lscope76-v4_sfloat
+.text
+	.align 4
+.stabs "v4_sfloats:F1",36,0,0,v4_sfloats
+	.weak v4_sfloats
+	.type	v4_sfloats,@function
+v4_sfloats:
+.stabn 68,0,688,.LMa888-v4_sfloats
+.LMa888:
+	push %ebx
+	call .Lpic77
+.Lpic77:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic77],%ebx
+0:
+.stabn 68,0,688,.LMb888-v4_sfloats
+.LMb888:
+.LBB77:
+	call v4__dpop@PLT
+	shl $2,%eax
+	call v4__dpush@PLT
+.LBE77:
+.stabn 68,0,688,.LM898-v4_sfloats
+.LM898:
+	pop %ebx
+	ret
+.Lfe77:
+	.size	 v4_sfloats,.Lfe77-v4_sfloats
+.stabn	192,0,0,.LBB77-v4_sfloats
+.stabn	224,0,0,.LBE77-v4_sfloats
+.Lscope77:
+.stabs	"",36,0,0,.Lscope77-v4_sfloats
+.text
+	.align 4
+.stabs "v4_sfloat_Plus:F1",36,0,0,v4_sfloat_Plus
+	.weak v4_sfloat_Plus
+	.type	v4_sfloat_Plus,@function
+v4_sfloat_Plus:
+.stabn 68,0,689,.LMa899-v4_sfloat_Plus
+.LMa899:
+	push %ebx
+	call .Lpic78
+.Lpic78:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic78],%ebx
+0:
+.stabn 68,0,689,.LMb899-v4_sfloat_Plus
+.LMb899:
+.LBB78:
+.stabn 68,0,205,.LM902-v4_sfloat_Plus
+.LM902:
+	mov $4,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+.LBE78:
+.stabn 68,0,689,.LM910-v4_sfloat_Plus
+.LM910:
+	pop %ebx
+	ret
+.Lfe78:
+	.size	 v4_sfloat_Plus,.Lfe78-v4_sfloat_Plus
+.stabn	192,0,0,.LBB78-v4_sfloat_Plus
+.stabn	224,0,0,.LBE78-v4_sfloat_Plus
+.Lscope78:
+.stabs	"",36,0,0,.Lscope78-v4_sfloat_Plus
+.text
+	.align 4
+.stabs "v4_sfloat_Minus:F1",36,0,0,v4_sfloat_Minus
+	.weak v4_sfloat_Minus
+	.type	v4_sfloat_Minus,@function
+v4_sfloat_Minus:
+.stabn 68,0,690,.LMa911-v4_sfloat_Minus
+.LMa911:
+	push %ebx
+	call .Lpic79
+.Lpic79:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic79],%ebx
+0:
+.stabn 68,0,690,.LMb911-v4_sfloat_Minus
+.LMb911:
+.LBB79:
+.stabn 68,0,205,.LM914-v4_sfloat_Minus
+.LM914:
+	mov $4,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.LBE79:
+.stabn 68,0,690,.LM922-v4_sfloat_Minus
+.LM922:
+	pop %ebx
+	ret
+.Lfe79:
+	.size	 v4_sfloat_Minus,.Lfe79-v4_sfloat_Minus
+.stabn	192,0,0,.LBB79-v4_sfloat_Minus
+.stabn	224,0,0,.LBE79-v4_sfloat_Minus
+.Lscope79:
+.stabs	"",36,0,0,.Lscope79-v4_sfloat_Minus
+.text
+	.align 4
+.stabs "v4_fliteral:F1",36,0,0,v4_fliteral
+	.weak v4_fliteral
+	.type	v4_fliteral,@function
+v4_fliteral:
+.stabn 68,0,692,.LMa923-v4_fliteral
+.LMa923:
+	push %ebx
+	call .Lpic80
+.Lpic80:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic80],%ebx
+0:
+.stabn 68,0,692,.LMb923-v4_fliteral
+.LMb923:
+.LBB80:
+.LBE80:
+.stabn 68,0,692,.LM925-v4_fliteral
+.LM925:
+	pop %ebx
+	ret
+.Lfe80:
+	.size	 v4_fliteral,.Lfe80-v4_fliteral
+.stabn	192,0,0,.LBB80-v4_fliteral
+.stabn	224,0,0,.LBE80-v4_fliteral
+.Lscope80:
+.stabs	"",36,0,0,.Lscope80-v4_fliteral
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,2956 @@
+/*
+ * VNPForth - Compiled native Forth for x86 Linux
+ * Copyright (C) 2005-2013  Simon Baldwin (simon_baldwin@yahoo.com)
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ *
+ * forthlib.h - Header and definitions for the VNPForth runtime library.
+ *
+ */
+
+#ifndef V4_FORTHLIB_H
+#define V4_FORTHLIB_H
+
+/* Enable use with C++. */
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#ifndef NO_VNPFORTH_v4__dl_main
+/* _dl_main: (--) Print library version and copyright, and exit */
+extern void v4__dl_main (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_cell
+/* cell: (-- n) Size of a cell */
+extern void v4_cell (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_cells
+/* cells: (n -- a) Convert n to cell offset */
+extern void v4_cells (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_cell_Plus
+/* cell+: (a -- a) Advance a by 1 cell */
+extern void v4_cell_Plus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_cell_Minus
+/* cell-: (a -- a) Regress a by 1 cell */
+extern void v4_cell_Minus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_chars
+/* chars: (n -- a) Convert n to char offset */
+extern void v4_chars (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_char_Plus
+/* char+: (a -- a) Advance a by 1 char */
+extern void v4_char_Plus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_char_Minus
+/* char-: (a -- a) Regress a by 1 char */
+extern void v4_char_Minus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__dstack
+/* _dstack: Forth data stack, 4080 cells */
+extern int v4__dstack[4096];
+#endif
+
+#ifndef NO_VNPFORTH_v4_depth
+/* depth: (-- n) Return the depth of the stack */
+extern void v4_depth (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sp0
+/* sp0: ( -- a) Return the address of the data stack base */
+extern void v4_sp0 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sp_Fetch
+/* sp@: (-- a) Return the effective address of the data stack pointer */
+extern void v4_sp_Fetch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sp_Store
+/* sp!: (a --) Set stack pointer to a, obtained previously with SP@ */
+extern void v4_sp_Store (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_swap
+/* swap: (w1 w2 -- w2 w1) Swap the top two items of the stack */
+extern void v4_swap (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_drop
+/* drop: (w --) Drop an item from the data stack */
+extern void v4_drop (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_dup
+/* dup: (w -- w w) Duplicate the top item of the stack */
+extern void v4_dup (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_over
+/* over: (w1 w2 -- w1 w2 w1) Duplicate w1 onto the top of the stack */
+extern void v4_over (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Questiondup
+/* ?dup: (w -- w w | 0) Duplicate w if nonzero */
+extern void v4_Questiondup (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_nip
+/* nip: (w1 w2 -- w2) Remove the item under the top of the stack */
+extern void v4_nip (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_rot
+/* rot: (w1 w2 w3 -- w2 w3 w1) Rotate the top three stacked items */
+extern void v4_rot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Minusrot
+/* -rot: (w1 w2 w3 -- w3 w1 w2) Counter-rotate the top three stacked items */
+extern void v4_Minusrot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_tuck
+/* tuck: (w1 w2 -- w2 w1 w2) Tuck the top item under its underling */
+extern void v4_tuck (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_pick
+/* pick: (wn wn-1 ... w0 x -- wn wn-1 ... w0 wx) Pick item x from the stack */
+extern void v4_pick (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_roll
+/* roll: (wn wn-1 ... w0 n -- wn-1 ... w0 wn) Roll top n stack items */
+extern void v4_roll (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z2drop
+/* 2drop: (w1 w2 --) Drop the top two items */
+extern void v4_z2drop (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z2dup
+/* 2dup: (w1 w2 -- w1 w2 w1 w2) Duplicate the top two items */
+extern void v4_z2dup (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z2over
+/* 2over: (w1 w2 w3 w4 -- w1 w2 w3 w4 w1 w2) Copy w1 w2 over w3 w4 */
+extern void v4_z2over (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z2swap
+/* 2swap: (w1 w2 w3 w4 -- w3 w4 w1 w2) Swap the top two pairs of items */
+extern void v4_z2swap (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__rstack
+/* _rstack: Forth return stack, 2032 cells */
+extern int v4__rstack[2048];
+#endif
+
+#ifndef NO_VNPFORTH_v4_Greaterr
+/* >r: (w --) (R: -- w) Transfer w from the data to the return stack */
+extern void v4_Greaterr (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_r_Greater
+/* r>: (-- w) (R: w --) Transfer w from the return to the data stack */
+extern void v4_r_Greater (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_rdepth
+/* rdepth: (-- n) Return the current depth of the return stack */
+extern void v4_rdepth (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_rp0
+/* rp0: ( -- a) Return the return stack base pointer */
+extern void v4_rp0 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_rp_Fetch
+/* rp@: (-- a) Return the return stack effective current pointer */
+extern void v4_rp_Fetch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_rp_Store
+/* rp!: (a --) Set return stack pointer, obtained previously with RP@ */
+extern void v4_rp_Store (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_r_Fetch
+/* r@: (-- w) Return the value on the current return stack top */
+extern void v4_r_Fetch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_rdrop
+/* rdrop: (R: w --) Drop an item from the return stack */
+extern void v4_rdrop (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z2_Greaterr
+/* 2>r: (w1 w2 --) (R: -- w1 w2) Transfer a pair of values from data */
+extern void v4_z2_Greaterr (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z2r_Greater
+/* 2r>: (-- w1 w2) (R: w1 w2 --) Transfer a pair of values to data */
+extern void v4_z2r_Greater (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z2r_Fetch
+/* 2r@: (-- w1 w2) (R: w1 w2 -- w1 w2) Get the top two return stack values */
+extern void v4_z2r_Fetch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z2rdrop
+/* 2rdrop: (R: w1 w2 --) Drop two items from the return stack */
+extern void v4_z2rdrop (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_execute
+/* execute: (xt --) Call function at address xt */
+extern void v4_execute (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Store
+/* !: (w a --) Store w at address a */
+extern void v4_Store (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Fetch
+/* @: (a -- w) Fetch w from address a */
+extern void v4_Fetch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_c_Store
+/* c!: (c a --) Store character c at address a */
+extern void v4_c_Store (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_c_Fetch
+/* c@: (a -- c) Fetch character c from address a */
+extern void v4_c_Fetch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_w_Store
+/* w!: (w a --) Store half word w at address a */
+extern void v4_w_Store (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_w_Fetch
+/* w@: (a -- w) Fetch half word w from address a */
+extern void v4_w_Fetch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Plus_Store
+/* +!: (n a --) Add n to the number at address a */
+extern void v4_Plus_Store (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z2_Store
+/* 2!: (w1 w2 a --) Store w1 w2 in consecutive words at address a */
+extern void v4_z2_Store (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z2_Fetch
+/* 2@: (a -- w1 w2) Fetch w1 w2 from consecutive words at address a */
+extern void v4_z2_Fetch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fill
+/* fill: (a u ch --) Fill addresses a to a+u with character ch */
+extern void v4_fill (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_move
+/* move: (a1 a2 u --) Copy u characters from a1 to a2 */
+extern void v4_move (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_erase
+/* erase: (a u --) Fill u characters, from a to a+u, with zeroes */
+extern void v4_erase (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_aligned
+/* aligned: (a -- aa) Return first aligned address greater than or equal to a */
+extern void v4_aligned (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_and
+/* and: (w1 w2 -- w) Return logical AND of w1 w2 */
+extern void v4_and (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_or
+/* or: (w1 w2 -- w) Return the logical OR of w1 w2 */
+extern void v4_or (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_xor
+/* xor: (w1 w2 -- w) Return the logical XOR of w1 w2 */
+extern void v4_xor (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_lshift
+/* lshift: (w u -- w) Left shift w by u bits */
+extern void v4_lshift (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_rshift
+/* rshift: (w u -- w) Right shift w by u bits */
+extern void v4_rshift (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_invert
+/* invert: (w -- w) Invert each bit in w */
+extern void v4_invert (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_false
+/* false: --  0 */
+extern void v4_false (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_true
+/* true: -- -1 */
+extern void v4_true (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z1_Plus
+/* 1+: (n -- n+1) Increment n */
+extern void v4_z1_Plus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z1_Minus
+/* 1-: (n -- n-1) Decrement n */
+extern void v4_z1_Minus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_um_Plus
+/* um+: (u1 u2 -- ur cy) Add u1 to u2 giving ur and cy */
+extern void v4_um_Plus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_um_Star
+/* um*: (u1 u2 -- ur cy) Multiply u1 by u2 giving double result */
+extern void v4_um_Star (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_um_Slashmod
+/* um/mod: (udl udh un -- ur uq) Divide udh:udl by un, leaving ur and uq */
+extern void v4_um_Slashmod (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sm_Slashrem
+/* sm/rem: (dl dh n -- r q) Divide dh:dl by n, leaving r and q */
+extern void v4_sm_Slashrem (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Plus
+/* +: (u1 u2 -- ur) Add u1 to u2, ignoring carry */
+extern void v4_Plus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fm_Slashmod
+/* fm/mod: (dl dh n -- r q) Floored division of dh:dl by n, leaving r and q */
+extern void v4_fm_Slashmod (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_negate
+/* negate: (n -- -n) Change sign of n */
+extern void v4_negate (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_dnegate
+/* dnegate: (d -- -d) Change sign of d */
+extern void v4_dnegate (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Minus
+/* -: (w1 w2 -- wr) Subtract w2 from w1, giving wr */
+extern void v4_Minus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_abs
+/* abs: (n -- u) Obtain absolute value of n */
+extern void v4_abs (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_m_Star
+/* m*: (n1 n2 -- d) Multiply n1 by n2, giving d */
+extern void v4_m_Star (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Star
+/* *: (n1 n2 -- n) Multiply n1 by n2, ignoring overflow */
+extern void v4_Star (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_m_Slashmod
+/* m/mod: (dl dh n -- r q) Division of dh:dl by n, leaving r and q */
+extern void v4_m_Slashmod (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_s_Greaterd
+/* s>d: (n -- d) Convert signed n to double d */
+extern void v4_s_Greaterd (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_d_Greaters
+/* d>s: (d -- n) Convert double d to signed n */
+extern void v4_d_Greaters (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Slashmod
+/* /mod: (n1 n2 -- r q) Divide n1 by n2, return remainder and quotient */
+extern void v4_Slashmod (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_mod
+/* mod: (n1 n2 -- n) Return the remainder of dividing n1 by n2 */
+extern void v4_mod (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Slash
+/* /: (n1 n2 -- n) Divide n1 by n2 */
+extern void v4_Slash (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Star_Slashmod
+/* * /mod: (n1 n2 n3 -- n4 n5) Return remainder and quotient of n1 * n2 / n3 */
+extern void v4_Star_Slashmod (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Star_Slash
+/* * /: (n1 n2 n3 -- n) Return n1 * n2 / n3 */
+extern void v4_Star_Slash (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z2_Star
+/* 2*: (n -- n*2) Double n */
+extern void v4_z2_Star (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z2_Slash
+/* 2/: (n -- n/2) Halve n, leaving MSB unchanged */
+extern void v4_z2_Slash (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z0_Less
+/* 0<: (n -- t) Return true if n < 0 */
+extern void v4_z0_Less (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z0_Equals
+/* 0=: (w -- t) Return true if w = 0 */
+extern void v4_z0_Equals (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z0_Less_Greater
+/* 0<>: (n -- t) Return true if n != 0 */
+extern void v4_z0_Less_Greater (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_z0_Greater
+/* 0>: (n -- t) Return true if n > 0 */
+extern void v4_z0_Greater (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Equals
+/* =: (w1 w2 -- t) Return true if w1 = w2 */
+extern void v4_Equals (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_u_Less
+/* u<: (u1 u2 -- t) Return true if u1 < u2 */
+extern void v4_u_Less (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_u_Greater
+/* u>: (u1 u2 -- t) Return true if u1 > u2 */
+extern void v4_u_Greater (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_u_Less_Equals
+/* u<=: (u1 u2 -- t) Return true if u1 <= u2 */
+extern void v4_u_Less_Equals (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_u_Greater_Equals
+/* u>=: (u1 u2 -- t) Return true if u1 >= u2 */
+extern void v4_u_Greater_Equals (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Less
+/* <: (n1 n2 -- t) Return true if n1 < n2 */
+extern void v4_Less (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Greater
+/* >: (n1 n2 -- t) Return true if n1 > n2 */
+extern void v4_Greater (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Less_Greater
+/* <>: (n1 n2 -- t) Return true if n1 != n2 */
+extern void v4_Less_Greater (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Less_Equals
+/* <=: (n1 n2 -- t) Return true if n1 <= n2 */
+extern void v4_Less_Equals (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Greater_Equals
+/* >=: (n1 n2 -- t) Return true if n1 >= n2 */
+extern void v4_Greater_Equals (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_max
+/* max: (n1 n2 -- n) Return the larger of n1 n2 */
+extern void v4_max (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_min
+/* min: (n1 n2 -- n) Return the smaller of n1 n2 */
+extern void v4_min (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_within
+/* within: (u ul uh -- t) Return true if u lies between ul and uh */
+extern void v4_within (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_stdin
+/* stdin: (-- 0) System stdin file descriptor */
+extern void v4_stdin (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_stdout
+/* stdout: (-- 1) System stdout file descriptor */
+extern void v4_stdout (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_stderr
+/* stderr: (-- 2) System stderr file descriptor */
+extern void v4_stderr (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_infile_Minusid
+/* infile-id: (-- a) Return infile id address, initialized to stdin */
+extern void v4_infile_Minusid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_outfile_Minusid
+/* outfile-id: (-- a) Return outfile id address, initialized to stdout */
+extern void v4_outfile_Minusid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_infile_Minusexecute
+/* infile-execute: (xt file-id --) Execute xt with input from file-id */
+extern void v4_infile_Minusexecute (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_outfile_Minusexecute
+/* outfile-execute: (xt file-id --) Execute xt with output to file-id */
+extern void v4_outfile_Minusexecute (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_key
+/* key: (-- c) Read c from infile-id */
+extern void v4_key (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_type
+/* type: (a u --) Print string of length u at a to outfile-id */
+extern void v4_type (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_emit
+/* emit: (c --) Send c to outfile-id */
+extern void v4_emit (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_bl
+/* bl: (-- c) ASCII space character */
+extern void v4_bl (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_space
+/* space: (--) Write one space to outfile-id */
+extern void v4_space (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_spaces
+/* spaces: (n --) Write n spaces to outfile-id */
+extern void v4_spaces (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_cr
+/* cr: (--) Write carriage return to outfile-id */
+extern void v4_cr (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_accept
+/* accept: (a n -- n) Read in up to n characters to a, return count */
+extern void v4_accept (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_count
+/* count: (a -- a+1 n) Convert counted string into address and count */
+extern void v4_count (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__hldbuf
+/* _hldbuf: Conversion output buffer, 148 chars */
+extern char v4__hldbuf[148];
+#endif
+
+#ifndef NO_VNPFORTH_v4_hld
+/* hld: Hold pointer into conversion buffer */
+extern int v4_hld;
+#endif
+
+#ifndef NO_VNPFORTH_v4__base
+/* _base: Underlying current I/O numeric base */
+extern int v4__base;
+#endif
+
+#ifndef NO_VNPFORTH_v4__ansi
+/* _ansi: Underlying variable for _strictansi */
+extern int v4__ansi;
+#endif
+
+#ifndef NO_VNPFORTH_v4__strictansi
+/* _strictansi: (-- a) Strict ansi flag, if true use uppercase for # */
+extern void v4__strictansi (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_base
+/* base: (-- a) Initialize BASE to 10 if not yet set, return address */
+extern void v4_base (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Less_Hash
+/* <#: (--) Set HLD to the end of the conv buffer */
+extern void v4_Less_Hash (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_hold
+/* hold: (c --) Decrement HLD, and place c in the conv buffer */
+extern void v4_hold (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Hash
+/* #: (ud -- ud) Put last digit of ud into the buffer, return ud/BASE */
+extern void v4_Hash (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Hashs
+/* #s: (ud -- 0 0) Place all digits of ud in the conv buffer, return 0 0 */
+extern void v4_Hashs (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sign
+/* sign: (n --) Append '-' to the conv buffer if n is negative */
+extern void v4_sign (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Hash_Greater
+/* #>: (w w -- b u) Return the conv buffer as a string and char count */
+extern void v4_Hash_Greater (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_hex
+/* hex: (--) Set base 16 */
+extern void v4_hex (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_decimal
+/* decimal: (--) Set base 10 */
+extern void v4_decimal (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_octal
+/* octal: (--) Set base 8 */
+extern void v4_octal (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_u_Dotr
+/* u.r: (u n --) print u unsigned right-justified width n, in base BASE */
+extern void v4_u_Dotr (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Dotr
+/* .r: (w n --) Print w, signed if BASE=10 otherwise unsigned, width n */
+extern void v4_Dotr (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_u_Dot
+/* u.: (u --) Print u unsigned, in base BASE */
+extern void v4_u_Dot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Dot
+/* .: (w --) Print w, signed if BASE=10 otherwise unsigned */
+extern void v4_Dot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Greaternumber
+/* >number: (ud1 c-addr1 u1 -- ud2 c-addr2 u2) Convert string to number */
+extern void v4_Greaternumber (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_toupper
+/* toupper: (c -- uc) Convert c to uppercase, if within a-z */
+extern void v4_toupper (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_tolower
+/* tolower: (c -- lc) Convert c to lowercase, if within A-Z */
+extern void v4_tolower (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_strlen
+/* strlen: (c-addr -- c-addr u) Return addr, length of null-terminated string */
+extern void v4_strlen (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_convert
+/* convert: (ud1 c-addr1 -- ud2 c-addr2) Convert string to number, obsolete */
+extern void v4_convert (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__precision
+/* _precision: Underlying precision variable */
+extern int v4__precision;
+#endif
+
+#ifndef NO_VNPFORTH_v4__fsbuf
+/* _fsbuf: Float conversion buffer, 8 chars */
+extern char v4__fsbuf[8];
+#endif
+
+#ifndef NO_VNPFORTH_v4_precision
+/* precision: (-- u) Initialize PRECISION to 8 if not yet set, return value */
+extern void v4_precision (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_set_Minusprecision
+/* set-precision: (u --) Set PRECISION, limits at 1 and 8 */
+extern void v4_set_Minusprecision (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_represent
+/* represent: (c-addr u -- exp neg valid) (F: r --) Represent r as u chars */
+extern void v4_represent (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fs_Dot
+/* fs.: (F: r --) Print r in scientific notation */
+extern void v4_fs_Dot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fe_Dot
+/* fe.: (F: r --) Print r in engineering notation */
+extern void v4_fe_Dot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f_Dot
+/* f.: (F: r --) Print r in fixed point notation */
+extern void v4_f_Dot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Greaterfloat
+/* >float: (c-addr u -- true | false) (F: -- r |) Convert string to float */
+extern void v4_Greaterfloat (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_bounds
+/* bounds: (addr1 n --- addr2 addr1) Convert addr1 to bounds for DO LOOP */
+extern void v4_bounds (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_i
+/* i: (-- n) Inner DO loop index value */
+extern void v4_i (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_j
+/* j: (-- n) Next DO loop index value */
+extern void v4_j (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_k
+/* k: (-- n) Next DO loop index value */
+extern void v4_k (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_unloop
+/* unloop: (R: w w --) Discard DO loop return stack values for EXIT */
+extern void v4_unloop (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Minustrailing
+/* -trailing: (c-addr u1 -- c-addr u2) Remove trailing spaces */
+extern void v4_Minustrailing (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Slashstring
+/* /string: (c-addr1 u1 n -- c-addr2 u2) Adjust c-addr1 by n characters */
+extern void v4_Slashstring (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_blank
+/* blank: (c-addr u --) Store space in u chars beginning at c-addr */
+extern void v4_blank (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_cmove
+/* cmove: (c-addr1 c-addr2 u --) Copy u chars from c-addr1 to c-addr2 */
+extern void v4_cmove (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_cmove_Greater
+/* cmove>: (c-addr1 c-addr2 u --) Reverse copy from c-addr1 to c-addr2 */
+extern void v4_cmove_Greater (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_compare
+/* compare: (c-addr1 u1 c-addr2 u2 -- -1 | 0 | 1) Compare two strings */
+extern void v4_compare (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_comparei
+/* comparei: (c-addr1 u1 c-addr2 u2 -- -1 | 0 | 1) Compare strings, no case */
+extern void v4_comparei (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_search
+/* search: (c-addr1 u1 c-addr2 u2 -- a u flag) Search for c-addr2 in c-addr1 */
+extern void v4_search (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_searchi
+/* searchi: (c-addr1 u1 c-addr2 u2 -- a u flag) Search, no case */
+extern void v4_searchi (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sliteral
+/* sliteral: (--) Null definition for compatibility */
+extern void v4_sliteral (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_catch
+/* catch: (xt -- 0 | exc_code) Catch exceptions raised by THROW */
+extern void v4_catch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_throw
+/* throw: (??? exc_code -- ??? exc_code) Raise exception exc_code for CATCH */
+extern void v4_throw (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Dots
+/* .s: (w1 ... wn --) Print the contents of the data stack */
+extern void v4_Dots (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Question
+/* ?: (a-addr --) Display the value stored at a-addr */
+extern void v4_Question (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_dump
+/* dump: (addr u --) Display u bytes starting at addr */
+extern void v4_dump (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_see
+/* see: (--) Null definition for compatibility */
+extern void v4_see (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_words
+/* words: (--) Null definition for compatibility */
+extern void v4_words (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__arenap
+/* _arenap: Pointer to the allocation arena */
+extern int v4__arenap;
+#endif
+
+#ifndef NO_VNPFORTH_v4__allocb
+/* _allocb: (addr1 -- addr2) Change data segment, abort on failure */
+extern void v4__allocb (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__arena
+/* _arena: (-- addr) Return the address of the allocation arena */
+extern void v4__arena (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__allocsize
+/* _allocsize: (addr -- n|0) Get the size of the block for addr, 0 on error) */
+extern void v4__allocsize (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4___Dotarena
+/* _.arena: (--) Print the allocation arena */
+extern void v4___Dotarena (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__allocdefrag
+/* _allocdefrag: (addr --) Coalesce adjacent free blocks into this block */
+extern void v4__allocdefrag (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__allocslot
+/* _allocslot: (n addr1 -- n addr2) Locate a block to hold n bytes */
+extern void v4__allocslot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_allocate
+/* allocate: (n -- addr 0 | code) Allocate n bytes, return addr and 0 or errno */
+extern void v4_allocate (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_free
+/* free: (addr -- 0 | code) Free memory at addr, return 0 or errno */
+extern void v4_free (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_resize
+/* resize: (addr1 n -- addr2 0 | code) Resize, return new addr and 0 or errno */
+extern void v4_resize (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_argc
+/* argc: (-- n) Returns a count of command line arguments */
+extern void v4_argc (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_argv
+/* argv: (-- a) The process arguments, an array of C-style strings */
+extern void v4_argv (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_envp
+/* envp: (-- a) The process environment, an array of C-style strings */
+extern void v4_envp (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_arg
+/* arg: (n -- a n | X 0) Returns command line argument at n, X 0 if none */
+extern void v4_arg (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__abort
+/* _abort: (--) (R: --) Abort the program with core dump, uncatchable */
+extern void v4__abort (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_abort
+/* abort: (--) (R: --) Abort the program with core dump, catchable */
+extern void v4_abort (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__quit
+/* _quit: (--) (R: --) Exit the program, uncatchable */
+extern void v4__quit (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_quit
+/* quit: (--) (R: --) Exit the program, catchable */
+extern void v4_quit (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_pad
+/* pad: PAD transient region, 84 chars */
+extern char v4_pad[84];
+#endif
+
+#ifndef NO_VNPFORTH_v4__state
+/* _state: Underlying variable for STATE */
+extern int v4__state;
+#endif
+
+#ifndef NO_VNPFORTH_v4_state
+/* state: (-- a-addr) Return address of STATE */
+extern void v4_state (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Leftbracket
+/* [: (--) Null definition for compatibility */
+extern void v4_Leftbracket (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Rightbracket
+/* ]: (--) Null definition for compatibility */
+extern void v4_Rightbracket (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_literal
+/* literal: (--) Null definition for compatibility */
+extern void v4_literal (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_immediate
+/* immediate: (--) Null definition for compatibility */
+extern void v4_immediate (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__here
+/* _here: Underlying variable for HERE */
+extern int v4__here;
+#endif
+
+#ifndef NO_VNPFORTH_v4_here
+/* here: (-- addr) Return address of the current HERE region */
+extern void v4_here (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Comma
+/* ,: (x --) Store x in the current HERE region */
+extern void v4_Comma (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_c_Comma
+/* c,: (c --) Store c in the current HERE region */
+extern void v4_c_Comma (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_align
+/* align: (--) Align the current HERE data space pointer */
+extern void v4_align (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_unused
+/* unused: (-- u) Null definition, for compatibility */
+extern void v4_unused (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_environment_Question
+/* environment?: (c-addr u -- false | i|n|f|d|u true) Query the environment */
+extern void v4_environment_Question (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_float
+/* float: (-- n) Size of a float */
+extern void v4_float (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_floats
+/* floats: (n -- a) Convert n to float offset */
+extern void v4_floats (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_float_Plus
+/* float+: (a -- a) Advance a by one float */
+extern void v4_float_Plus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_float_Minus
+/* float-: (a -- a) Regress a by one float */
+extern void v4_float_Minus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_Greaterf
+/* >f: (w --) (F: -- r) Transfer w from the data to the FP stack */
+extern void v4_Greaterf (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f_Greater
+/* f>: (-- w) (F: r --) Transfer r from the FP to the data stack */
+extern void v4_f_Greater (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f_Greaterd
+/* f>d: (-- d) (F: r --) Copy integral part of r into dl, sign extend dh */
+extern void v4_f_Greaterd (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_d_Greaterf
+/* d>f: (d --) (F: -- r) Copy dl into integral part of r, ignore dh */
+extern void v4_d_Greaterf (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fdepth
+/* fdepth: (-- n) Return the depth of the FP stack */
+extern void v4_fdepth (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f_Store
+/* f!: (f-addr --) (F: r --) Store r at address f-addr */
+extern void v4_f_Store (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f_Fetch
+/* f@: (f-addr --) (F: -- r) Fetch r from address f-addr */
+extern void v4_f_Fetch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fdrop
+/* fdrop: (F: r --) Drop an item from the FP stack */
+extern void v4_fdrop (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fswap
+/* fswap: (F: r1 r2 -- r2 r1) Swap the top two items of the FP stack */
+extern void v4_fswap (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fdup
+/* fdup: (F: r -- r r) Duplicate the top item of the FP stack */
+extern void v4_fdup (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fover
+/* fover: (F: r1 r2 -- r1 r2 r1) Duplicate r1 onto the top of the FP stack */
+extern void v4_fover (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_frot
+/* frot: (F: r1 r2 r3 -- r2 r3 r1) Rotate the top three FP stacked items */
+extern void v4_frot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_faligned
+/* faligned: (a -- aa) First float aligned address greater than or equal to a */
+extern void v4_faligned (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f0_Less
+/* f0<: (-- t) (F: r --) Return true if and only if r is less than 0.0 */
+extern void v4_f0_Less (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f0_Equals
+/* f0=: (-- t) (F: r --) Return true if and only if r is equal to 0.0 */
+extern void v4_f0_Equals (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f_Less
+/* f<: (-- t) (F: r1 r2 --) Return true if and only if r1 is less than r2 */
+extern void v4_f_Less (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f_Plus
+/* f+: (F: r1 r2 -- r) Add r1 to r2 */
+extern void v4_f_Plus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f_Minus
+/* f-: (F: r1 r2 -- r) Subtract r2 from r1 */
+extern void v4_f_Minus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f_Star
+/* f*: (F: r1 r2 -- r) Multiply r1 by r2 */
+extern void v4_f_Star (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f_Slash
+/* f/: (F: r1 r2 -- r) Divide r1 by r2 */
+extern void v4_f_Slash (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fabs
+/* fabs: (F: -r|+r -- +r) Negate r if r is negative */
+extern void v4_fabs (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fround
+/* fround: (F: r -- r) Round r to an integral value */
+extern void v4_fround (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fnegate
+/* fnegate: (F: r -- -r) Negate r */
+extern void v4_fnegate (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f_Tilde
+/* f~: (-- flag) (F: r1 r2 r3 --) Compare close, exact, or relative */
+extern void v4_f_Tilde (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fmax
+/* fmax: (F: r1 r2 -- r) Return the larger of r1 r2 */
+extern void v4_fmax (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fmin
+/* fmin: (F: r1 r2 -- r) Return the smaller of r1 r2 */
+extern void v4_fmin (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fsqrt
+/* fsqrt: (F: r -- r^0.5) Calculate the square root of r */
+extern void v4_fsqrt (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fsin
+/* fsin: (F: r -- r) Calculate the sin of r */
+extern void v4_fsin (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fcos
+/* fcos: (F: r -- r) Calculate the cos of r */
+extern void v4_fcos (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fsincos
+/* fsincos: (F: r -- rs rc) Calculate the sin and cos of r */
+extern void v4_fsincos (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_ftan
+/* ftan: (F: r -- r) Calculate the tan of r */
+extern void v4_ftan (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fln
+/* fln: (F: r1 -- r2) Calculate the natural logarithm of r1 */
+extern void v4_fln (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_flnp1
+/* flnp1: (F: r1 -- r2) Calculate the natural logarithm of one plus r1 */
+extern void v4_flnp1 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_flog
+/* flog: (F: r1 -- r2) Calculate the base-ten logarithm of r1 */
+extern void v4_flog (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_f_Star_Star
+/* f**: (F: r1 r2 -- r3) Raise r1 to the power r2, giving the product r3 */
+extern void v4_f_Star_Star (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fexp
+/* fexp: (F: r1 -- r2) Raise e to the power r1, giving r2 */
+extern void v4_fexp (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fexpm1
+/* fexpm1: (F: r1 -- r2) Raise e to the power r1 and subtract one, giving r2 */
+extern void v4_fexpm1 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_falog
+/* falog: (F: r1 -- r2) Raise ten to the power r1, giving r2 */
+extern void v4_falog (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sf_Store
+/* sf!: (sf-addr --) (F: r --) Store r at sf-addr, 32 bits IEEE */
+extern void v4_sf_Store (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sf_Fetch
+/* sf@: (sf-addr --) (F: -- r) Fetch r from address sf-addr, 32 bits IEEE */
+extern void v4_sf_Fetch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sfaligned
+/* sfaligned: (a -- aa) First single float aligned address >= a */
+extern void v4_sfaligned (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sfloat
+/* sfloat: (-- n) Size of a single float */
+extern void v4_sfloat (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sfloats
+/* sfloats: (n -- a) Convert n to single float offset */
+extern void v4_sfloats (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sfloat_Plus
+/* sfloat+: (a -- a) Advance a by one single float */
+extern void v4_sfloat_Plus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_sfloat_Minus
+/* sfloat-: (a -- a) Regress a by one single float */
+extern void v4_sfloat_Minus (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_fliteral
+/* fliteral: (--) Null definition for compatibility */
+extern void v4_fliteral (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_getenv
+/* getenv: (c-addr u -- false | c-addr u true) Get process env variable value */
+extern void v4_getenv (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_cexecute
+/* cexecute: (a1 ... aN N xt -- status) Call 'C' func xt with N arguments */
+extern void v4_cexecute (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_c_push
+/* c_push: (-- w) Push a word from 'C' onto the Forth data stack */
+extern void v4_c_push (int);
+#endif
+
+#ifndef NO_VNPFORTH_v4_c_pop
+/* c_pop: (w --) Pop the Forth top of data stack into eax for 'C' */
+extern int v4_c_pop (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__atexit
+/* _atexit: System _atexit handler address */
+extern int v4__atexit;
+#endif
+
+#ifndef NO_VNPFORTH__start
+/* _start: (--) Forth program entry point, invoked by Linux exec */
+extern void _start (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__syscall
+/* _syscall: (a1 ... aN X N -- status) Call syscall X with N arguments */
+extern void v4__syscall (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__errno
+/* _errno: Underlying variable for ERRNO */
+extern int v4__errno;
+#endif
+
+#ifndef NO_VNPFORTH_v4__post_syscall
+/* _post_syscall: (r -- r | -1) Returns r, or sets ERRNO and returns -1 */
+extern void v4__post_syscall (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_errno
+/* errno: (-- a) Returns the value of the ERRNO variable */
+extern void v4_errno (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_strerror
+/* strerror: (e -- a u | X 0) Return system error code's string description */
+extern void v4_strerror (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_perror
+/* perror: (s-addr u --) Print error message for the current ERRNO */
+extern void v4_perror (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4_pperror
+/* pperror: (s-addr u --) Print error message, prefixed with 0 arg */
+extern void v4_pperror (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__exit
+/* _exit: a1 -- */
+extern void v4__exit (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__fork
+/* _fork: -- r */
+extern void v4__fork (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__read
+/* _read: a1 a2 a3 -- r */
+extern void v4__read (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__write
+/* _write: a1 a2 a3 -- r */
+extern void v4__write (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__open
+/* _open: a1 a2 a3 -- r */
+extern void v4__open (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__close
+/* _close: a1 -- r */
+extern void v4__close (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__waitpid
+/* _waitpid: a1 a2 a3 -- r */
+extern void v4__waitpid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__creat
+/* _creat: a1 a2 -- r */
+extern void v4__creat (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__link
+/* _link: a1 a2 -- r */
+extern void v4__link (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__unlink
+/* _unlink: a1 -- r */
+extern void v4__unlink (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__execve
+/* _execve: a1 a2 a3 -- r */
+extern void v4__execve (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__chdir
+/* _chdir: a1 -- r */
+extern void v4__chdir (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__time
+/* _time: a1 -- r */
+extern void v4__time (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__mknod
+/* _mknod: a1 a2 a3 -- r */
+extern void v4__mknod (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__chmod
+/* _chmod: a1 a2 -- r */
+extern void v4__chmod (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__lchown16
+/* _lchown16: a1 a2 a3 -- r */
+extern void v4__lchown16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__lseek
+/* _lseek: a1 a2 a3 -- r */
+extern void v4__lseek (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getpid
+/* _getpid: -- r */
+extern void v4__getpid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__mount
+/* _mount: a1 a2 a3 a4 a5 -- r */
+extern void v4__mount (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setuid16
+/* _setuid16: a1 -- r */
+extern void v4__setuid16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getuid16
+/* _getuid16: -- r */
+extern void v4__getuid16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__stime
+/* _stime: a1 -- r */
+extern void v4__stime (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__alarm
+/* _alarm: a1 -- r */
+extern void v4__alarm (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__pause
+/* _pause: -- r */
+extern void v4__pause (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__utime
+/* _utime: a1 a2 -- r */
+extern void v4__utime (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__access
+/* _access: a1 a2 -- r */
+extern void v4__access (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__nice
+/* _nice: a1 -- r */
+extern void v4__nice (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__kill
+/* _kill: a1 a2 -- r */
+extern void v4__kill (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__rename
+/* _rename: a1 a2 -- r */
+extern void v4__rename (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__mkdir
+/* _mkdir: a1 a2 -- r */
+extern void v4__mkdir (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__rmdir
+/* _rmdir: a1 -- r */
+extern void v4__rmdir (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__dup
+/* _dup: a1 -- r */
+extern void v4__dup (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__pipe
+/* _pipe: a1 -- r */
+extern void v4__pipe (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__times
+/* _times: a1 -- r */
+extern void v4__times (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__brk
+/* _brk: a1 -- r */
+extern void v4__brk (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setgid16
+/* _setgid16: a1 -- r */
+extern void v4__setgid16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getgid16
+/* _getgid16: -- r */
+extern void v4__getgid16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__signal
+/* _signal: a1 a2 -- r */
+extern void v4__signal (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__geteuid16
+/* _geteuid16: -- r */
+extern void v4__geteuid16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getegid16
+/* _getegid16: -- r */
+extern void v4__getegid16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ioctl
+/* _ioctl: a1 a2 a3 -- r */
+extern void v4__ioctl (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__fcntl
+/* _fcntl: a1 a2 a3 -- r */
+extern void v4__fcntl (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setpgid
+/* _setpgid: a1 a2 -- r */
+extern void v4__setpgid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__umask
+/* _umask: a1 -- r */
+extern void v4__umask (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__chroot
+/* _chroot: a1 -- r */
+extern void v4__chroot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__dup2
+/* _dup2: a1 a2 -- r */
+extern void v4__dup2 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getppid
+/* _getppid: -- r */
+extern void v4__getppid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getpgrp
+/* _getpgrp: -- r */
+extern void v4__getpgrp (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setsid
+/* _setsid: -- r */
+extern void v4__setsid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setreuid16
+/* _setreuid16: a1 a2 -- r */
+extern void v4__setreuid16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setregid16
+/* _setregid16: a1 a2 -- r */
+extern void v4__setregid16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__symlink
+/* _symlink: a1 a2 -- r */
+extern void v4__symlink (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__readlink
+/* _readlink: a1 a2 a3 -- r */
+extern void v4__readlink (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__readdir
+/* _readdir: a1 -- r */
+extern void v4__readdir (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__munmap
+/* _munmap: a1 a2 -- r */
+extern void v4__munmap (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__truncate
+/* _truncate: a1 a2 -- r */
+extern void v4__truncate (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ftruncate
+/* _ftruncate: a1 a2 -- r */
+extern void v4__ftruncate (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__fchmod
+/* _fchmod: a1 a2 -- r */
+extern void v4__fchmod (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__fchown16
+/* _fchown16: a1 a2 a3 -- r */
+extern void v4__fchown16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getpriority
+/* _getpriority: a1 a2 -- r */
+extern void v4__getpriority (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setpriority
+/* _setpriority: a1 a2 a3 -- r */
+extern void v4__setpriority (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__socketcall
+/* _socketcall: a1 -- r */
+extern void v4__socketcall (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__syslog
+/* _syslog: a1 a2 a3 -- r */
+extern void v4__syslog (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setitimer
+/* _setitimer: a1 a2 a3 -- r */
+extern void v4__setitimer (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getitimer
+/* _getitimer: a1 a2 -- r */
+extern void v4__getitimer (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__stat
+/* _stat: a1 a2 -- r */
+extern void v4__stat (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__lstat
+/* _lstat: a1 a2 -- r */
+extern void v4__lstat (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__fstat
+/* _fstat: a1 a2 -- r */
+extern void v4__fstat (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__uname
+/* _uname: a1 -- r */
+extern void v4__uname (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__wait4
+/* _wait4: a1 a2 a3 a4 -- r */
+extern void v4__wait4 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sysinfo
+/* _sysinfo: a1 -- r */
+extern void v4__sysinfo (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ipc
+/* _ipc: a1 -- r */
+extern void v4__ipc (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__fsync
+/* _fsync: a1 -- r */
+extern void v4__fsync (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__clone
+/* _clone: a1 a2 -- r */
+extern void v4__clone (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__new_uname
+/* _new_uname: a1 -- r */
+extern void v4__new_uname (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getpgid
+/* _getpgid: a1 -- r */
+extern void v4__getpgid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__fchdir
+/* _fchdir: a1 -- r */
+extern void v4__fchdir (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__personality
+/* _personality: a1 -- r */
+extern void v4__personality (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setfsuid
+/* _setfsuid: a1 -- r */
+extern void v4__setfsuid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setfsgid
+/* _setfsgid: a1 -- r */
+extern void v4__setfsgid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__llseek
+/* _llseek: a1 a2 a3 a4 a5 -- r */
+extern void v4__llseek (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getdents
+/* _getdents: a1 a2 a3 -- r */
+extern void v4__getdents (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__select
+/* _select: a1 a2 a3 a4 a5 -- r */
+extern void v4__select (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__flock
+/* _flock: a1 a2 -- r */
+extern void v4__flock (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__msync
+/* _msync: a1 a2 a3 -- r */
+extern void v4__msync (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__readv
+/* _readv: a1 a2 a3 -- r */
+extern void v4__readv (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__writev
+/* _writev: a1 a2 a3 -- r */
+extern void v4__writev (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__nanosleep
+/* _nanosleep: a1 a2 -- r */
+extern void v4__nanosleep (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__mremap
+/* _mremap: a1 a2 a3 a4 -- r */
+extern void v4__mremap (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setresuid16
+/* _setresuid16: a1 a2 a3 -- r */
+extern void v4__setresuid16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getresuid16
+/* _getresuid16: a1 a2 a3 -- r */
+extern void v4__getresuid16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__poll
+/* _poll: a1 a2 a3 -- r */
+extern void v4__poll (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setresgid16
+/* _setresgid16: a1 a2 a3 -- r */
+extern void v4__setresgid16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getresgid16
+/* _getresgid16: a1 a2 a3 -- r */
+extern void v4__getresgid16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sigret
+/* _sigret: -- r */
+extern void v4__sigret (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sigaction
+/* _sigaction: a1 a2 a3 -- r */
+extern void v4__sigaction (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sigprocmask
+/* _sigprocmask: a1 a2 a3 a4 -- r */
+extern void v4__sigprocmask (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sigpending
+/* _sigpending: a1 -- r */
+extern void v4__sigpending (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sigtimedwait
+/* _sigtimedwait: a1 a2 a3 a4 -- r */
+extern void v4__sigtimedwait (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sigqueueinfo
+/* _sigqueueinfo: a1 a2 a3 -- r */
+extern void v4__sigqueueinfo (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sigsuspend
+/* _sigsuspend: a1 a2 -- r */
+extern void v4__sigsuspend (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__pread
+/* _pread: a1 a2 a3 a4 -- r */
+extern void v4__pread (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__pwrite
+/* _pwrite: a1 a2 a3 a4 -- r */
+extern void v4__pwrite (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__chown16
+/* _chown16: a1 a2 a3 -- r */
+extern void v4__chown16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getcwd
+/* _getcwd: a1 a2 -- r */
+extern void v4__getcwd (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sigaltstack
+/* _sigaltstack: -- r */
+extern void v4__sigaltstack (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sendfile
+/* _sendfile: a1 a2 a3 a4 -- r */
+extern void v4__sendfile (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__vfork
+/* _vfork: -- r */
+extern void v4__vfork (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getrlimit
+/* _getrlimit: a1 a2 -- r */
+extern void v4__getrlimit (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__mmap2
+/* _mmap2: a1 a2 a3 a4 a5 a6 -- r */
+extern void v4__mmap2 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__lchown
+/* _lchown: a1 a2 a3 -- r */
+extern void v4__lchown (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getuid
+/* _getuid: -- r */
+extern void v4__getuid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getgid
+/* _getgid: -- r */
+extern void v4__getgid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__geteuid
+/* _geteuid: -- r */
+extern void v4__geteuid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getegid
+/* _getegid: -- r */
+extern void v4__getegid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setreuid
+/* _setreuid: a1 a2 -- r */
+extern void v4__setreuid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setregid
+/* _setregid: a1 a2 -- r */
+extern void v4__setregid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getgroups
+/* _getgroups: a1 a2 -- r */
+extern void v4__getgroups (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setgroups
+/* _setgroups: a1 a2 -- r */
+extern void v4__setgroups (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__fchown
+/* _fchown: a1 a2 a3 -- r */
+extern void v4__fchown (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setresuid
+/* _setresuid: a1 a2 a3 -- r */
+extern void v4__setresuid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getresuid
+/* _getresuid: a1 a2 a3 -- r */
+extern void v4__getresuid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setresgid
+/* _setresgid: a1 a2 a3 -- r */
+extern void v4__setresgid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getresgid
+/* _getresgid: a1 a2 a3 -- r */
+extern void v4__getresgid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__chown
+/* _chown: a1 a2 a3 -- r */
+extern void v4__chown (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setuid
+/* _setuid: a1 -- r */
+extern void v4__setuid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setgid
+/* _setgid: a1 -- r */
+extern void v4__setgid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ptrace
+/* _ptrace: a1 a2 a3 a4 -- r */
+extern void v4__ptrace (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sync
+/* _sync: -- r */
+extern void v4__sync (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__acct
+/* _acct: -- r */
+extern void v4__acct (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__umount
+/* _umount: -- r */
+extern void v4__umount (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ustat
+/* _ustat: -- r */
+extern void v4__ustat (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sgetmask
+/* _sgetmask: -- r */
+extern void v4__sgetmask (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ssetmask
+/* _ssetmask: a1 -- r */
+extern void v4__ssetmask (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sethostname
+/* _sethostname: a1 a2 -- r */
+extern void v4__sethostname (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setrlimit
+/* _setrlimit: a1 a2 -- r */
+extern void v4__setrlimit (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getrusage
+/* _getrusage: a1 a2 -- r */
+extern void v4__getrusage (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__gettimeofday
+/* _gettimeofday: a1 a2 -- r */
+extern void v4__gettimeofday (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__settimeofday
+/* _settimeofday: a1 a2 -- r */
+extern void v4__settimeofday (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getgroups16
+/* _getgroups16: a1 a2 -- r */
+extern void v4__getgroups16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setgroups16
+/* _setgroups16: a1 a2 -- r */
+extern void v4__setgroups16 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__uselib
+/* _uselib: a1 -- r */
+extern void v4__uselib (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__swapon
+/* _swapon: a1 -- r */
+extern void v4__swapon (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__reboot
+/* _reboot: a1 a2 a3 -- r */
+extern void v4__reboot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__statfs
+/* _statfs: a1 a2 -- r */
+extern void v4__statfs (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__fstatfs
+/* _fstatfs: a1 a2 -- r */
+extern void v4__fstatfs (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ioperm
+/* _ioperm: a1 a2 a3 -- r */
+extern void v4__ioperm (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__iopl
+/* _iopl: a1 -- r */
+extern void v4__iopl (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__vhangup
+/* _vhangup: -- r */
+extern void v4__vhangup (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__swapoff
+/* _swapoff: a1 -- r */
+extern void v4__swapoff (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__setdomainname
+/* _setdomainname: a1 -- r */
+extern void v4__setdomainname (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__modify_ldt
+/* _modify_ldt: -- r */
+extern void v4__modify_ldt (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__adjtimex
+/* _adjtimex: -- r */
+extern void v4__adjtimex (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__mprotect
+/* _mprotect: a1 a2 a3 -- r */
+extern void v4__mprotect (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__create_module
+/* _create_module: -- r */
+extern void v4__create_module (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__init_module
+/* _init_module: -- r */
+extern void v4__init_module (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__delete_module
+/* _delete_module: -- r */
+extern void v4__delete_module (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__get_kernel_syms
+/* _get_kernel_syms: -- r */
+extern void v4__get_kernel_syms (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__quotactl
+/* _quotactl: a1 a2 a3 a4 -- r */
+extern void v4__quotactl (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__bdflush
+/* _bdflush: -- r */
+extern void v4__bdflush (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sysfs
+/* _sysfs: a1 -- r */
+extern void v4__sysfs (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__getsid
+/* _getsid: a1 -- r */
+extern void v4__getsid (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__fdatasync
+/* _fdatasync: a1 -- r */
+extern void v4__fdatasync (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sysctl
+/* _sysctl: a1 -- r */
+extern void v4__sysctl (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__mlock
+/* _mlock: a1 a2 -- r */
+extern void v4__mlock (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__munlock
+/* _munlock: a1 a2 -- r */
+extern void v4__munlock (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__mlockall
+/* _mlockall: a1 -- r */
+extern void v4__mlockall (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__munlockall
+/* _munlockall: -- r */
+extern void v4__munlockall (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sched_setparam
+/* _sched_setparam: a1 a2 -- r */
+extern void v4__sched_setparam (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sched_getparam
+/* _sched_getparam: a1 a2 -- r */
+extern void v4__sched_getparam (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sched_setscheduler
+/* _sched_setscheduler: a1 a2 a3 -- r */
+extern void v4__sched_setscheduler (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sched_getscheduler
+/* _sched_getscheduler: a1 -- r */
+extern void v4__sched_getscheduler (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sched_yield
+/* _sched_yield: -- r */
+extern void v4__sched_yield (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sched_get_priority_max
+/* _sched_get_priority_max: a1 -- r */
+extern void v4__sched_get_priority_max (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sched_get_priority_min
+/* _sched_get_priority_min: a1 -- r */
+extern void v4__sched_get_priority_min (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__sched_rr_get_interval
+/* _sched_rr_get_interval: a1 a2 -- r */
+extern void v4__sched_rr_get_interval (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__vm86
+/* _vm86: a1 a2 -- r */
+extern void v4__vm86 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__query_module
+/* _query_module: a1 a2 a3 a4 a5 -- r */
+extern void v4__query_module (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__nfsservctl
+/* _nfsservctl: a1 a2 a3 -- r */
+extern void v4__nfsservctl (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__prctl
+/* _prctl: a1 a2 a3 a4 a5 -- r */
+extern void v4__prctl (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__capget
+/* _capget: a1 a2 -- r */
+extern void v4__capget (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__capset
+/* _capset: a1 a2 -- r */
+extern void v4__capset (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__truncate64
+/* _truncate64: a1 a2 a3 -- r */
+extern void v4__truncate64 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ftruncate64
+/* _ftruncate64: a1 a2 a3 -- r */
+extern void v4__ftruncate64 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__stat64
+/* _stat64: a1 a2 -- r */
+extern void v4__stat64 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__lstat64
+/* _lstat64: a1 a2 -- r */
+extern void v4__lstat64 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__fstat64
+/* _fstat64: a1 a2 -- r */
+extern void v4__fstat64 (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__pivot_root
+/* _pivot_root: a1 a2 -- r */
+extern void v4__pivot_root (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__mincore
+/* _mincore: a1 a2 a3 -- r */
+extern void v4__mincore (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__madvise
+/* _madvise: a1 a2 a3 -- r */
+extern void v4__madvise (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eperm
+/* _eperm: (--   1) Operation not permitted */
+extern void v4__eperm (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enoent
+/* _enoent: (--   2) No such file or directory */
+extern void v4__enoent (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__esrch
+/* _esrch: (--   3) No such process */
+extern void v4__esrch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eintr
+/* _eintr: (--   4) Interrupted system call */
+extern void v4__eintr (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eio
+/* _eio: (--   5) I/O error */
+extern void v4__eio (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enxio
+/* _enxio: (--   6) No such device or address */
+extern void v4__enxio (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__e2big
+/* _e2big: (--   7) Arg list too long */
+extern void v4__e2big (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enoexec
+/* _enoexec: (--   8) Exec format error */
+extern void v4__enoexec (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ebadf
+/* _ebadf: (--   9) Bad file number */
+extern void v4__ebadf (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__echild
+/* _echild: (--  10) No child processes */
+extern void v4__echild (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eagain
+/* _eagain: (--  11) Try again */
+extern void v4__eagain (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enomem
+/* _enomem: (--  12) Out of memory */
+extern void v4__enomem (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eacces
+/* _eacces: (--  13) Permission denied */
+extern void v4__eacces (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__efault
+/* _efault: (--  14) Bad address */
+extern void v4__efault (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enotblk
+/* _enotblk: (--  15) Block device required */
+extern void v4__enotblk (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ebusy
+/* _ebusy: (--  16) Device or resource busy */
+extern void v4__ebusy (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eexist
+/* _eexist: (--  17) File exists */
+extern void v4__eexist (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__exdev
+/* _exdev: (--  18) Cross-device link */
+extern void v4__exdev (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enodev
+/* _enodev: (--  19) No such device */
+extern void v4__enodev (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enotdir
+/* _enotdir: (--  20) Not a directory */
+extern void v4__enotdir (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eisdir
+/* _eisdir: (--  21) Is a directory */
+extern void v4__eisdir (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__einval
+/* _einval: (--  22) Invalid argument */
+extern void v4__einval (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enfile
+/* _enfile: (--  23) File table overflow */
+extern void v4__enfile (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__emfile
+/* _emfile: (--  24) Too many open files */
+extern void v4__emfile (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enotty
+/* _enotty: (--  25) Not a typewriter */
+extern void v4__enotty (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__etxtbsy
+/* _etxtbsy: (--  26) Text file busy */
+extern void v4__etxtbsy (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__efbig
+/* _efbig: (--  27) File too large */
+extern void v4__efbig (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enospc
+/* _enospc: (--  28) No space left on device */
+extern void v4__enospc (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__espipe
+/* _espipe: (--  29) Illegal seek */
+extern void v4__espipe (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__erofs
+/* _erofs: (--  30) Read-only file system */
+extern void v4__erofs (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__emlink
+/* _emlink: (--  31) Too many links */
+extern void v4__emlink (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__epipe
+/* _epipe: (--  32) Broken pipe */
+extern void v4__epipe (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__edom
+/* _edom: (--  33) Math argument out of domain of func */
+extern void v4__edom (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__erange
+/* _erange: (--  34) Math result not representable */
+extern void v4__erange (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__edeadlk
+/* _edeadlk: (--  35) Resource deadlock would occur */
+extern void v4__edeadlk (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enametoolong
+/* _enametoolong: (--  36) File name too long */
+extern void v4__enametoolong (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enolck
+/* _enolck: (--  37) No record locks available */
+extern void v4__enolck (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enosys
+/* _enosys: (--  38) Function not implemented */
+extern void v4__enosys (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enotempty
+/* _enotempty: (--  39) Directory not empty */
+extern void v4__enotempty (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eloop
+/* _eloop: (--  40) Too many symbolic links encountered */
+extern void v4__eloop (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ewouldblock
+/* _ewouldblock: (-- _EAGAIN) Operation would block */
+extern void v4__ewouldblock (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enomsg
+/* _enomsg: (--  42) No message of desired type */
+extern void v4__enomsg (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eidrm
+/* _eidrm: (--  43) Identifier removed */
+extern void v4__eidrm (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__echrng
+/* _echrng: (--  44) Channel number out of range */
+extern void v4__echrng (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__el2nsync
+/* _el2nsync: (--  45) Level 2 not synchronized */
+extern void v4__el2nsync (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__el3hlt
+/* _el3hlt: (--  46) Level 3 halted */
+extern void v4__el3hlt (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__el3rst
+/* _el3rst: (--  47) Level 3 reset */
+extern void v4__el3rst (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__elnrng
+/* _elnrng: (--  48) Link number out of range */
+extern void v4__elnrng (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eunatch
+/* _eunatch: (--  49) Protocol driver not attached */
+extern void v4__eunatch (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enocsi
+/* _enocsi: (--  50) No CSI structure available */
+extern void v4__enocsi (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__el2hlt
+/* _el2hlt: (--  51) Level 2 halted */
+extern void v4__el2hlt (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ebade
+/* _ebade: (--  52) Invalid exchange */
+extern void v4__ebade (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ebadr
+/* _ebadr: (--  53) Invalid request descriptor */
+extern void v4__ebadr (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__exfull
+/* _exfull: (--  54) Exchange full */
+extern void v4__exfull (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enoano
+/* _enoano: (--  55) No anode */
+extern void v4__enoano (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ebadrqc
+/* _ebadrqc: (--  56) Invalid request code */
+extern void v4__ebadrqc (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ebadslt
+/* _ebadslt: (--  57) Invalid slot */
+extern void v4__ebadslt (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__edeadlock
+/* _edeadlock: (-- _EDEADLK) Resource deadlck would occur */
+extern void v4__edeadlock (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ebfont
+/* _ebfont: (--  59) Bad font file format */
+extern void v4__ebfont (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enostr
+/* _enostr: (--  60) Device not a stream */
+extern void v4__enostr (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enodata
+/* _enodata: (--  61) No data available */
+extern void v4__enodata (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__etime
+/* _etime: (--  62) Timer expired */
+extern void v4__etime (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enosr
+/* _enosr: (--  63) Out of streams resources */
+extern void v4__enosr (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enonet
+/* _enonet: (--  64) Machine is not on the network */
+extern void v4__enonet (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enopkg
+/* _enopkg: (--  65) Package not installed */
+extern void v4__enopkg (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eremote
+/* _eremote: (--  66) Object is remote */
+extern void v4__eremote (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enolink
+/* _enolink: (--  67) Link has been severed */
+extern void v4__enolink (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eadv
+/* _eadv: (--  68) Advertise error */
+extern void v4__eadv (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__esrmnt
+/* _esrmnt: (--  69) Srmount error */
+extern void v4__esrmnt (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ecomm
+/* _ecomm: (--  70) Communication error on send */
+extern void v4__ecomm (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eproto
+/* _eproto: (--  71) Protocol error */
+extern void v4__eproto (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__emultihop
+/* _emultihop: (--  72) Multihop attempted */
+extern void v4__emultihop (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__edotdot
+/* _edotdot: (--  73) RFS specific error */
+extern void v4__edotdot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ebadmsg
+/* _ebadmsg: (--  74) Not a data message */
+extern void v4__ebadmsg (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eoverflow
+/* _eoverflow: (--  75) Value too large for defined data type */
+extern void v4__eoverflow (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enotuniq
+/* _enotuniq: (--  76) Name not unique on network */
+extern void v4__enotuniq (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ebadfd
+/* _ebadfd: (--  77) File descriptor in bad state */
+extern void v4__ebadfd (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eremchg
+/* _eremchg: (--  78) Remote address changed */
+extern void v4__eremchg (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__elibacc
+/* _elibacc: (--  79) Can not access a needed shared library */
+extern void v4__elibacc (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__elibbad
+/* _elibbad: (--  80) Accessing a corrupted shared library */
+extern void v4__elibbad (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__elibscn
+/* _elibscn: (--  81) .lib section in a.out corrupted */
+extern void v4__elibscn (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__elibmax
+/* _elibmax: (--  82) Attempting to link in too many shared libs */
+extern void v4__elibmax (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__elibexec
+/* _elibexec: (--  83) Cannot exec a shared library directly */
+extern void v4__elibexec (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eilseq
+/* _eilseq: (--  84) Illegal byte sequence */
+extern void v4__eilseq (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__erestart
+/* _erestart: (--  85) Interrupted sys call should be restarted */
+extern void v4__erestart (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__estrpipe
+/* _estrpipe: (--  86) Streams pipe error */
+extern void v4__estrpipe (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eusers
+/* _eusers: (--  87) Too many users */
+extern void v4__eusers (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enotsock
+/* _enotsock: (--  88) Socket operation on non-socket */
+extern void v4__enotsock (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__edestaddrreq
+/* _edestaddrreq: (--  89) Destination address required */
+extern void v4__edestaddrreq (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__emsgsize
+/* _emsgsize: (--  90) Message too long */
+extern void v4__emsgsize (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eprototype
+/* _eprototype: (--  91) Protocol wrong type for socket */
+extern void v4__eprototype (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enoprotoopt
+/* _enoprotoopt: (--  92) Protocol not available */
+extern void v4__enoprotoopt (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eprotonosupport
+/* _eprotonosupport: (--  93) Protocol not supported */
+extern void v4__eprotonosupport (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__esocktnosupport
+/* _esocktnosupport: (--  94) Socket type not supported */
+extern void v4__esocktnosupport (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eopnotsupp
+/* _eopnotsupp: (--  95) Operation not supported on transport endpt */
+extern void v4__eopnotsupp (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__epfnosupport
+/* _epfnosupport: (--  96) Protocol family not supported */
+extern void v4__epfnosupport (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eafnosupport
+/* _eafnosupport: (--  97) Address family not supported by protocol */
+extern void v4__eafnosupport (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eaddrinuse
+/* _eaddrinuse: (--  98) Address already in use */
+extern void v4__eaddrinuse (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eaddrnotavail
+/* _eaddrnotavail: (--  99) Cannot assign requested address */
+extern void v4__eaddrnotavail (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enetdown
+/* _enetdown: (-- 100) Network is down */
+extern void v4__enetdown (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enetunreach
+/* _enetunreach: (-- 101) Network is unreachable */
+extern void v4__enetunreach (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enetreset
+/* _enetreset: (-- 102) Network dropped connection because of reset */
+extern void v4__enetreset (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__econnaborted
+/* _econnaborted: (-- 103) Software caused connection abort */
+extern void v4__econnaborted (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__econnreset
+/* _econnreset: (-- 104) Connection reset by peer */
+extern void v4__econnreset (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enobufs
+/* _enobufs: (-- 105) No buffer space available */
+extern void v4__enobufs (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eisconn
+/* _eisconn: (-- 106) Transport endpoint is already connected */
+extern void v4__eisconn (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enotconn
+/* _enotconn: (-- 107) Transport endpoint is not connected */
+extern void v4__enotconn (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eshutdown
+/* _eshutdown: (-- 108) Cannot send after transport endpoint shtdn */
+extern void v4__eshutdown (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__etoomanyrefs
+/* _etoomanyrefs: (-- 109) Too many references: cannot splice */
+extern void v4__etoomanyrefs (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__etimedout
+/* _etimedout: (-- 110) Connection timed out */
+extern void v4__etimedout (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__econnrefused
+/* _econnrefused: (-- 111) Connection refused */
+extern void v4__econnrefused (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ehostdown
+/* _ehostdown: (-- 112) Host is down */
+extern void v4__ehostdown (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ehostunreach
+/* _ehostunreach: (-- 113) No route to host */
+extern void v4__ehostunreach (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__ealready
+/* _ealready: (-- 114) Operation already in progress */
+extern void v4__ealready (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__einprogress
+/* _einprogress: (-- 115) Operation now in progress */
+extern void v4__einprogress (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__estale
+/* _estale: (-- 116) Stale NFS file handle */
+extern void v4__estale (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__euclean
+/* _euclean: (-- 117) Structure needs cleaning */
+extern void v4__euclean (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enotnam
+/* _enotnam: (-- 118) Not a XENIX named type file */
+extern void v4__enotnam (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enavail
+/* _enavail: (-- 119) No XENIX semaphores available */
+extern void v4__enavail (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eisnam
+/* _eisnam: (-- 120) Is a named type file */
+extern void v4__eisnam (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__eremoteio
+/* _eremoteio: (-- 121) Remote I/O error */
+extern void v4__eremoteio (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__edquot
+/* _edquot: (-- 122) Quota exceeded */
+extern void v4__edquot (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__enomedium
+/* _enomedium: (-- 123) No medium found */
+extern void v4__enomedium (void);
+#endif
+
+#ifndef NO_VNPFORTH_v4__emediumtype
+/* _emediumtype: (-- 124) Wrong medium type */
+extern void v4__emediumtype (void);
+#endif
+
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+#endif /* V4_FORTHLIB_H */
@@ -0,0 +1,37 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: forthrt1.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+    69 Sym_1 codeword "_start"
+    35 Sym_0 variable Cell "v4__atexit"
+
+Intermediate code:
+    69 function Sym_1 {
+    70   asm (    mov %edx,v4__atexit)
+    72   asm (    mov 4(%ebp),%eax)
+    74   asm (    mov %ebp,%ebx)
+    75   asm (    add $8,%ebx)
+    77   asm (    mov %eax,%ecx)
+    78   asm (    inc %ecx)
+    79   asm (    shl $2,%ecx)
+    80   asm (    add %ebx,%ecx)
+    82   asm (    xor %ebp,%ebp)
+    84   asm (    push %ecx)
+    85   asm (    push %ebx)
+    86   asm (    push %eax)
+    88   asm (    call main)
+    89   asm (    sub $12,%esp)
+    91   asm (    mov v4__atexit,%edx)
+    92   asm (    test %edx,%edx)
+    93   asm (    jz 1f)
+    94   asm (    push %eax)
+    95   asm (    call *%edx)
+    96   asm (    pop %eax)
+    97   asm (1:)
+    99   asm (    mov %eax,%ebx)
+   100   asm (    mov $1,%eax)
+   101   asm (    int $0x80)
+   103 }
+
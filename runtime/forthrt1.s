@@ -0,0 +1,79 @@
+	.file	"forthrt1.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"forthrt1.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.stabs	"v4__atexit:G2",40,0,0,v4__atexit
+	.comm  v4__atexit,4,4
+.text
+	.align 4
+.stabs "_start:F1",36,0,0,_start
+	.weak _start
+	.type	_start,@function
+_start:
+.stabn 68,0,69,.LMa0-_start
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic1
+.Lpic1:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic1],%ebx
+0:
+.stabn 68,0,69,.LMb0-_start
+.LMb0:
+.LBB1:
+#APP
+    mov %edx,v4__atexit
+    mov 4(%ebp),%eax
+    mov %ebp,%ebx
+    add $8,%ebx
+    mov %eax,%ecx
+    inc %ecx
+    shl $2,%ecx
+    add %ebx,%ecx
+    xor %ebp,%ebp
+    push %ecx
+    push %ebx
+    push %eax
+    call main
+    sub $12,%esp
+    mov v4__atexit,%edx
+    test %edx,%edx
+    jz 1f
+    push %eax
+    call *%edx
+    pop %eax
+1:
+    mov %eax,%ebx
+    mov $1,%eax
+    int $0x80
+#NO_APP
+.LBE1:
+.stabn 68,0,103,.LM25-_start
+.LM25:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe1:
+	.size	 _start,.Lfe1-_start
+.stabn	192,0,0,.LBB1-_start
+.stabn	224,0,0,.LBE1-_start
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-_start
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,1506 @@
+	.file	"io.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"io.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.stabs	"v4__ansi:G2",40,0,0,v4__ansi
+	.comm  v4__ansi,4,4
+.stabs	"v4__base:G2",40,0,0,v4__base
+	.comm  v4__base,4,4
+.stabs	"v4__hldbuf:Gar2;0;147;4",40,0,0,v4__hldbuf
+	.comm  v4__hldbuf,148,32
+.stabs	"v4_hld:G2",40,0,0,v4_hld
+	.comm  v4_hld,4,4
+.text
+	.align 4
+.stabs "v4_accept:F1",36,0,0,v4_accept
+	.weak v4_accept
+	.type	v4_accept,@function
+v4_accept:
+.stabn 68,0,26,.LMa0-v4_accept
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,26,.LMb0-v4_accept
+.LMb0:
+.LBB0:
+.stabn 68,0,27,.LM1-v4_accept
+.LM1:
+	call v4_tuck@PLT
+.stabn 68,0,28,.LM2-v4_accept
+.LM2:
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %eax,%edx
+	je .L2
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+.L3:
+.stabn 68,0,29,.LM10-v4_accept
+.LM10:
+	call v4_key@PLT
+	call v4_dup@PLT
+	mov $10,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	jne .L5
+.stabn 68,0,30,.LM20-v4_accept
+.LM20:
+	call v4_z2drop@PLT
+	call v4_drop@PLT
+.stabn 68,0,31,.LM22-v4_accept
+.LM22:
+	call v4_i@PLT
+	mov v4_unloop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.L5:
+.stabn 68,0,33,.LM26-v4_accept
+.LM26:
+	call v4_over@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Store@PLT
+.stabn 68,0,34,.LM34-v4_accept
+.LM34:
+	call v4__rpop@PLT
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L3
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.L2:
+	mov v4_drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE0:
+.stabn 68,0,34,.LM47-v4_accept
+.LM47:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_accept,.Lfe0-v4_accept
+.stabn	192,0,0,.LBB0-v4_accept
+.stabn	224,0,0,.LBE0-v4_accept
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_accept
+.text
+	.align 4
+.stabs "v4_count:F1",36,0,0,v4_count
+	.weak v4_count
+	.type	v4_count,@function
+v4_count:
+.stabn 68,0,36,.LMa48-v4_count
+.LMa48:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic12
+.Lpic12:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic12],%ebx
+0:
+.stabn 68,0,36,.LMb48-v4_count
+.LMb48:
+.LBB12:
+.stabn 68,0,37,.LM49-v4_count
+.LM49:
+	call v4_dup@PLT
+	call v4_c_Fetch@PLT
+	call v4_swap@PLT
+	call v4_char_Plus@PLT
+	mov v4_swap@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE12:
+.stabn 68,0,37,.LM55-v4_count
+.LM55:
+	pop %ebx
+	leave
+	ret
+.Lfe12:
+	.size	 v4_count,.Lfe12-v4_count
+.stabn	192,0,0,.LBB12-v4_count
+.stabn	224,0,0,.LBE12-v4_count
+.Lscope12:
+.stabs	"",36,0,0,.Lscope12-v4_count
+.text
+	.align 4
+.stabs "v4__strictansi:F1",36,0,0,v4__strictansi
+	.weak v4__strictansi
+	.type	v4__strictansi,@function
+v4__strictansi:
+.stabn 68,0,44,.LMa56-v4__strictansi
+.LMa56:
+	push %ebx
+	call .Lpic20
+.Lpic20:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic20],%ebx
+0:
+.stabn 68,0,44,.LMb56-v4__strictansi
+.LMb56:
+.LBB20:
+.stabn 68,0,45,.LM57-v4__strictansi
+.LM57:
+	mov v4__ansi@GOT(%ebx),%eax
+	call v4__dpush@PLT
+.LBE20:
+.stabn 68,0,45,.LM60-v4__strictansi
+.LM60:
+	pop %ebx
+	ret
+.Lfe20:
+	.size	 v4__strictansi,.Lfe20-v4__strictansi
+.stabn	192,0,0,.LBB20-v4__strictansi
+.stabn	224,0,0,.LBE20-v4__strictansi
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4__strictansi
+.text
+	.align 4
+.stabs "v4_base:F1",36,0,0,v4_base
+	.weak v4_base
+	.type	v4_base,@function
+v4_base:
+.stabn 68,0,47,.LMa61-v4_base
+.LMa61:
+	push %ebx
+	call .Lpic21
+.Lpic21:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic21],%ebx
+0:
+.stabn 68,0,47,.LMb61-v4_base
+.LMb61:
+.LBB21:
+	mov v4__base@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	test %eax,%eax
+	jne .L9
+.stabn 68,0,49,.LM72-v4_base
+.LM72:
+	mov $10,%eax
+	mov v4__base@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.L9:
+	mov v4__base@GOT(%ebx),%eax
+	call v4__dpush@PLT
+.LBE21:
+.stabn 68,0,50,.LM83-v4_base
+.LM83:
+	pop %ebx
+	ret
+.Lfe21:
+	.size	 v4_base,.Lfe21-v4_base
+.stabn	192,0,0,.LBB21-v4_base
+.stabn	224,0,0,.LBE21-v4_base
+.Lscope21:
+.stabs	"",36,0,0,.Lscope21-v4_base
+.text
+	.align 4
+.stabs "v4_Less_Hash:F1",36,0,0,v4_Less_Hash
+	.weak v4_Less_Hash
+	.type	v4_Less_Hash,@function
+v4_Less_Hash:
+.stabn 68,0,52,.LMa84-v4_Less_Hash
+.LMa84:
+	push %ebx
+	push %esi
+	call .Lpic25
+.Lpic25:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic25],%ebx
+0:
+.stabn 68,0,52,.LMb84-v4_Less_Hash
+.LMb84:
+.LBB25:
+.stabn 68,0,53,.LM85-v4_Less_Hash
+.LM85:
+	mov v4__hldbuf@GOT(%ebx),%eax
+	mov %eax,%esi
+	mov $148,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov v4_hld@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.LBE25:
+.stabn 68,0,53,.LM100-v4_Less_Hash
+.LM100:
+	pop %esi
+	pop %ebx
+	ret
+.Lfe25:
+	.size	 v4_Less_Hash,.Lfe25-v4_Less_Hash
+.stabn	192,0,0,.LBB25-v4_Less_Hash
+.stabn	224,0,0,.LBE25-v4_Less_Hash
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4_Less_Hash
+.text
+	.align 4
+.stabs "v4_hold:F1",36,0,0,v4_hold
+	.weak v4_hold
+	.type	v4_hold,@function
+v4_hold:
+.stabn 68,0,55,.LMa101-v4_hold
+.LMa101:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic26
+.Lpic26:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic26],%ebx
+0:
+.stabn 68,0,55,.LMb101-v4_hold
+.LMb101:
+.LBB26:
+	mov v4_hld@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	dec %eax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	mov v4_hld@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov v4_c_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE26:
+.stabn 68,0,56,.LM119-v4_hold
+.LM119:
+	pop %ebx
+	leave
+	ret
+.Lfe26:
+	.size	 v4_hold,.Lfe26-v4_hold
+.stabn	192,0,0,.LBB26-v4_hold
+.stabn	224,0,0,.LBE26-v4_hold
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4_hold
+.text
+	.align 4
+.stabs "v4_Hash:F1",36,0,0,v4_Hash
+	.weak v4_Hash
+	.type	v4_Hash,@function
+v4_Hash:
+.stabn 68,0,58,.LMa120-v4_Hash
+.LMa120:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic28
+.Lpic28:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic28],%ebx
+0:
+.stabn 68,0,58,.LMb120-v4_Hash
+.LMb120:
+.LBB28:
+.stabn 68,0,48,.LM122-v4_Hash
+.LM122:
+	mov v4__base@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	test %eax,%eax
+	jne .L56
+.stabn 68,0,49,.LM124-v4_Hash
+.LM124:
+	mov $10,%eax
+	mov v4__base@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.L56:
+	mov v4__base@GOT(%ebx),%eax
+	call v4__dpush@PLT
+.stabn 68,0,59,.LM129-v4_Hash
+.LM129:
+	call v4_Fetch@PLT
+	call v4_um_Slashmod@PLT
+	call v4_swap@PLT
+.stabn 68,0,60,.LM132-v4_Hash
+.LM132:
+	call v4_dup@PLT
+	mov $9,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	jle .L13
+	mov v4__ansi@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	test %eax,%eax
+	je .L14
+	mov $65,%eax
+	call v4__dpush@PLT
+	jmp .L15
+.L14:
+	mov $97,%eax
+	call v4__dpush@PLT
+.L15:
+	call v4__dpop@PLT
+	dec %eax
+	mov %eax,%esi
+	mov $57,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	sub %edx,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+.L13:
+.stabn 68,0,65,.LM173-v4_Hash
+.LM173:
+	mov $48,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	mov v4_hld@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	dec %eax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	mov v4_hld@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	call v4_c_Store@PLT
+.stabn 68,0,65,.LM197-v4_Hash
+.LM197:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.LBE28:
+.stabn 68,0,65,.LM200-v4_Hash
+.LM200:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe28:
+	.size	 v4_Hash,.Lfe28-v4_Hash
+.stabn	192,0,0,.LBB28-v4_Hash
+.stabn	224,0,0,.LBE28-v4_Hash
+.Lscope28:
+.stabs	"",36,0,0,.Lscope28-v4_Hash
+.text
+	.align 4
+.stabs "v4_Hashs:F1",36,0,0,v4_Hashs
+	.weak v4_Hashs
+	.type	v4_Hashs,@function
+v4_Hashs:
+.stabn 68,0,67,.LMa201-v4_Hashs
+.LMa201:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic32
+.Lpic32:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic32],%ebx
+0:
+.stabn 68,0,67,.LMb201-v4_Hashs
+.LMb201:
+.LBB32:
+.L17:
+.stabn 68,0,69,.LM203-v4_Hashs
+.LM203:
+	call v4_Hash@PLT
+.stabn 68,0,70,.LM204-v4_Hashs
+.LM204:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	or %edx,%eax
+	test %eax,%eax
+	jle .L18
+.stabn 68,0,71,.LM215-v4_Hashs
+.LM215:
+	jmp .L17
+.L18:
+.LBE32:
+.stabn 68,0,71,.LM218-v4_Hashs
+.LM218:
+	pop %ebx
+	leave
+	ret
+.Lfe32:
+	.size	 v4_Hashs,.Lfe32-v4_Hashs
+.stabn	192,0,0,.LBB32-v4_Hashs
+.stabn	224,0,0,.LBE32-v4_Hashs
+.Lscope32:
+.stabs	"",36,0,0,.Lscope32-v4_Hashs
+.text
+	.align 4
+.stabs "v4_sign:F1",36,0,0,v4_sign
+	.weak v4_sign
+	.type	v4_sign,@function
+v4_sign:
+.stabn 68,0,73,.LMa219-v4_sign
+.LMa219:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic36
+.Lpic36:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic36],%ebx
+0:
+.stabn 68,0,73,.LMb219-v4_sign
+.LMb219:
+.LBB36:
+	call v4__dpop@PLT
+	test %eax,%eax
+	jge .L20
+.stabn 68,0,75,.LM225-v4_sign
+.LM225:
+	mov $45,%eax
+	call v4__dpush@PLT
+	mov v4_hld@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	dec %eax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	mov v4_hld@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	mov v4_c_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.L20:
+.LBE36:
+.stabn 68,0,76,.LM246-v4_sign
+.LM246:
+	pop %ebx
+	leave
+	ret
+.Lfe36:
+	.size	 v4_sign,.Lfe36-v4_sign
+.stabn	192,0,0,.LBB36-v4_sign
+.stabn	224,0,0,.LBE36-v4_sign
+.Lscope36:
+.stabs	"",36,0,0,.Lscope36-v4_sign
+.text
+	.align 4
+.stabs "v4_Hash_Greater:F1",36,0,0,v4_Hash_Greater
+	.weak v4_Hash_Greater
+	.type	v4_Hash_Greater,@function
+v4_Hash_Greater:
+.stabn 68,0,78,.LMa247-v4_Hash_Greater
+.LMa247:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic38
+.Lpic38:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic38],%ebx
+0:
+.stabn 68,0,78,.LMb247-v4_Hash_Greater
+.LMb247:
+.LBB38:
+.stabn 68,0,79,.LM248-v4_Hash_Greater
+.LM248:
+	call v4_z2drop@PLT
+	mov v4_hld@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+	mov v4__hldbuf@GOT(%ebx),%eax
+	mov %eax,%esi
+	mov $148,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.LBE38:
+.stabn 68,0,79,.LM270-v4_Hash_Greater
+.LM270:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe38:
+	.size	 v4_Hash_Greater,.Lfe38-v4_Hash_Greater
+.stabn	192,0,0,.LBB38-v4_Hash_Greater
+.stabn	224,0,0,.LBE38-v4_Hash_Greater
+.Lscope38:
+.stabs	"",36,0,0,.Lscope38-v4_Hash_Greater
+.text
+	.align 4
+.stabs "v4_hex:F1",36,0,0,v4_hex
+	.weak v4_hex
+	.type	v4_hex,@function
+v4_hex:
+.stabn 68,0,81,.LMa271-v4_hex
+.LMa271:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic39
+.Lpic39:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic39],%ebx
+0:
+.stabn 68,0,81,.LMb271-v4_hex
+.LMb271:
+.LBB39:
+	mov $16,%eax
+	call v4__dpush@PLT
+.stabn 68,0,48,.LM275-v4_hex
+.LM275:
+	mov v4__base@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	test %eax,%eax
+	jne .L57
+.stabn 68,0,49,.LM277-v4_hex
+.LM277:
+	mov $10,%eax
+	mov v4__base@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.L57:
+	mov v4__base@GOT(%ebx),%eax
+	call v4__dpush@PLT
+.stabn 68,0,81,.LM282-v4_hex
+.LM282:
+	mov v4_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE39:
+.stabn 68,0,81,.LM284-v4_hex
+.LM284:
+	pop %ebx
+	leave
+	ret
+.Lfe39:
+	.size	 v4_hex,.Lfe39-v4_hex
+.stabn	192,0,0,.LBB39-v4_hex
+.stabn	224,0,0,.LBE39-v4_hex
+.Lscope39:
+.stabs	"",36,0,0,.Lscope39-v4_hex
+.text
+	.align 4
+.stabs "v4_decimal:F1",36,0,0,v4_decimal
+	.weak v4_decimal
+	.type	v4_decimal,@function
+v4_decimal:
+.stabn 68,0,82,.LMa285-v4_decimal
+.LMa285:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic40
+.Lpic40:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic40],%ebx
+0:
+.stabn 68,0,82,.LMb285-v4_decimal
+.LMb285:
+.LBB40:
+	mov $10,%eax
+	call v4__dpush@PLT
+.stabn 68,0,48,.LM289-v4_decimal
+.LM289:
+	mov v4__base@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	test %eax,%eax
+	jne .L58
+.stabn 68,0,49,.LM291-v4_decimal
+.LM291:
+	mov $10,%eax
+	mov v4__base@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.L58:
+	mov v4__base@GOT(%ebx),%eax
+	call v4__dpush@PLT
+.stabn 68,0,82,.LM296-v4_decimal
+.LM296:
+	mov v4_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE40:
+.stabn 68,0,82,.LM298-v4_decimal
+.LM298:
+	pop %ebx
+	leave
+	ret
+.Lfe40:
+	.size	 v4_decimal,.Lfe40-v4_decimal
+.stabn	192,0,0,.LBB40-v4_decimal
+.stabn	224,0,0,.LBE40-v4_decimal
+.Lscope40:
+.stabs	"",36,0,0,.Lscope40-v4_decimal
+.text
+	.align 4
+.stabs "v4_octal:F1",36,0,0,v4_octal
+	.weak v4_octal
+	.type	v4_octal,@function
+v4_octal:
+.stabn 68,0,83,.LMa299-v4_octal
+.LMa299:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic41
+.Lpic41:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic41],%ebx
+0:
+.stabn 68,0,83,.LMb299-v4_octal
+.LMb299:
+.LBB41:
+	mov $8,%eax
+	call v4__dpush@PLT
+.stabn 68,0,48,.LM303-v4_octal
+.LM303:
+	mov v4__base@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	test %eax,%eax
+	jne .L59
+.stabn 68,0,49,.LM305-v4_octal
+.LM305:
+	mov $10,%eax
+	mov v4__base@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.L59:
+	mov v4__base@GOT(%ebx),%eax
+	call v4__dpush@PLT
+.stabn 68,0,83,.LM310-v4_octal
+.LM310:
+	mov v4_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE41:
+.stabn 68,0,83,.LM312-v4_octal
+.LM312:
+	pop %ebx
+	leave
+	ret
+.Lfe41:
+	.size	 v4_octal,.Lfe41-v4_octal
+.stabn	192,0,0,.LBB41-v4_octal
+.stabn	224,0,0,.LBE41-v4_octal
+.Lscope41:
+.stabs	"",36,0,0,.Lscope41-v4_octal
+.text
+	.align 4
+.stabs "v4_u_Dotr:F1",36,0,0,v4_u_Dotr
+	.weak v4_u_Dotr
+	.type	v4_u_Dotr,@function
+v4_u_Dotr:
+.stabn 68,0,85,.LMa313-v4_u_Dotr
+.LMa313:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic42
+.Lpic42:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic42],%ebx
+0:
+.stabn 68,0,85,.LMb313-v4_u_Dotr
+.LMb313:
+.LBB42:
+.stabn 68,0,86,.LM314-v4_u_Dotr
+.LM314:
+	call v4_Greaterr@PLT
+.stabn 68,0,53,.LM316-v4_u_Dotr
+.LM316:
+	mov v4__hldbuf@GOT(%ebx),%eax
+	mov %eax,%esi
+	mov $148,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov v4_hld@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.stabn 68,0,86,.LM330-v4_u_Dotr
+.LM330:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L49:
+.stabn 68,0,69,.LM334-v4_u_Dotr
+.LM334:
+	call v4_Hash@PLT
+.stabn 68,0,70,.LM335-v4_u_Dotr
+.LM335:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	or %edx,%eax
+	test %eax,%eax
+	jle .L50
+.stabn 68,0,71,.LM346-v4_u_Dotr
+.LM346:
+	jmp .L49
+.L50:
+.stabn 68,0,79,.LM349-v4_u_Dotr
+.LM349:
+	call v4_z2drop@PLT
+	mov v4_hld@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+	mov v4__hldbuf@GOT(%ebx),%eax
+	mov %eax,%esi
+	mov $148,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,86,.LM370-v4_u_Dotr
+.LM370:
+	call v4_dup@PLT
+	call v4_r_Greater@PLT
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,87,.LM378-v4_u_Dotr
+.LM378:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jle .L26
+	call v4_spaces@PLT
+	jmp .L27
+.L26:
+	call v4_drop@PLT
+.L27:
+	mov v4_type@GOT(%ebx),%ecx
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE42:
+.stabn 68,0,87,.LM391-v4_u_Dotr
+.LM391:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe42:
+	.size	 v4_u_Dotr,.Lfe42-v4_u_Dotr
+.stabn	192,0,0,.LBB42-v4_u_Dotr
+.stabn	224,0,0,.LBE42-v4_u_Dotr
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4_u_Dotr
+.text
+	.align 4
+.stabs "v4_Dotr:F1",36,0,0,v4_Dotr
+	.weak v4_Dotr
+	.type	v4_Dotr,@function
+v4_Dotr:
+.stabn 68,0,89,.LMa392-v4_Dotr
+.LMa392:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic47
+.Lpic47:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic47],%ebx
+0:
+.stabn 68,0,89,.LMb392-v4_Dotr
+.LMb392:
+.LBB47:
+.stabn 68,0,90,.LM393-v4_Dotr
+.LM393:
+	call v4_Greaterr@PLT
+.stabn 68,0,48,.LM395-v4_Dotr
+.LM395:
+	mov v4__base@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	test %eax,%eax
+	jne .L60
+.stabn 68,0,49,.LM397-v4_Dotr
+.LM397:
+	mov $10,%eax
+	mov v4__base@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.L60:
+	mov v4__base@GOT(%ebx),%eax
+	call v4__dpush@PLT
+.stabn 68,0,90,.LM402-v4_Dotr
+.LM402:
+	call v4_Fetch@PLT
+	mov $10,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	xor %edx,%eax
+	je .L29
+.stabn 68,0,91,.LM412-v4_Dotr
+.LM412:
+	call v4_r_Greater@PLT
+	mov v4_u_Dotr@GOT(%ebx),%ecx
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.L29:
+.stabn 68,0,93,.LM416-v4_Dotr
+.LM416:
+	call v4_dup@PLT
+	call v4_Greaterr@PLT
+	call v4_abs@PLT
+.stabn 68,0,53,.LM420-v4_Dotr
+.LM420:
+	mov v4__hldbuf@GOT(%ebx),%eax
+	mov %eax,%esi
+	mov $148,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov v4_hld@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.stabn 68,0,93,.LM434-v4_Dotr
+.LM434:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L51:
+.stabn 68,0,69,.LM438-v4_Dotr
+.LM438:
+	call v4_Hash@PLT
+.stabn 68,0,70,.LM439-v4_Dotr
+.LM439:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	or %edx,%eax
+	test %eax,%eax
+	jle .L52
+.stabn 68,0,71,.LM450-v4_Dotr
+.LM450:
+	jmp .L51
+.L52:
+.stabn 68,0,93,.LM452-v4_Dotr
+.LM452:
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jge .L53
+.stabn 68,0,75,.LM459-v4_Dotr
+.LM459:
+	mov $45,%eax
+	call v4__dpush@PLT
+	mov v4_hld@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	dec %eax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	mov v4_hld@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+	call v4_c_Store@PLT
+.L53:
+.stabn 68,0,79,.LM480-v4_Dotr
+.LM480:
+	call v4_z2drop@PLT
+	mov v4_hld@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+	mov v4__hldbuf@GOT(%ebx),%eax
+	mov %eax,%esi
+	mov $148,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,94,.LM501-v4_Dotr
+.LM501:
+	call v4_dup@PLT
+	call v4_r_Greater@PLT
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,95,.LM509-v4_Dotr
+.LM509:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jle .L30
+	call v4_spaces@PLT
+	jmp .L31
+.L30:
+	call v4_drop@PLT
+.L31:
+	mov v4_type@GOT(%ebx),%ecx
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE47:
+.stabn 68,0,95,.LM522-v4_Dotr
+.LM522:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe47:
+	.size	 v4_Dotr,.Lfe47-v4_Dotr
+.stabn	192,0,0,.LBB47-v4_Dotr
+.stabn	224,0,0,.LBE47-v4_Dotr
+.Lscope47:
+.stabs	"",36,0,0,.Lscope47-v4_Dotr
+.text
+	.align 4
+.stabs "v4_u_Dot:F1",36,0,0,v4_u_Dot
+	.weak v4_u_Dot
+	.type	v4_u_Dot,@function
+v4_u_Dot:
+.stabn 68,0,97,.LMa523-v4_u_Dot
+.LMa523:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic50
+.Lpic50:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic50],%ebx
+0:
+.stabn 68,0,97,.LMb523-v4_u_Dot
+.LMb523:
+.LBB50:
+.stabn 68,0,98,.LM524-v4_u_Dot
+.LM524:
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4_u_Dotr@PLT
+	mov v4_space@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE50:
+.stabn 68,0,98,.LM529-v4_u_Dot
+.LM529:
+	pop %ebx
+	leave
+	ret
+.Lfe50:
+	.size	 v4_u_Dot,.Lfe50-v4_u_Dot
+.stabn	192,0,0,.LBB50-v4_u_Dot
+.stabn	224,0,0,.LBE50-v4_u_Dot
+.Lscope50:
+.stabs	"",36,0,0,.Lscope50-v4_u_Dot
+.text
+	.align 4
+.stabs "v4_Dot:F1",36,0,0,v4_Dot
+	.weak v4_Dot
+	.type	v4_Dot,@function
+v4_Dot:
+.stabn 68,0,100,.LMa530-v4_Dot
+.LMa530:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic52
+.Lpic52:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic52],%ebx
+0:
+.stabn 68,0,100,.LMb530-v4_Dot
+.LMb530:
+.LBB52:
+.stabn 68,0,101,.LM531-v4_Dot
+.LM531:
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4_Dotr@PLT
+	mov v4_space@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE52:
+.stabn 68,0,101,.LM536-v4_Dot
+.LM536:
+	pop %ebx
+	leave
+	ret
+.Lfe52:
+	.size	 v4_Dot,.Lfe52-v4_Dot
+.stabn	192,0,0,.LBB52-v4_Dot
+.stabn	224,0,0,.LBE52-v4_Dot
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4_Dot
+.text
+	.align 4
+.stabs "v4_Greaternumber:F1",36,0,0,v4_Greaternumber
+	.weak v4_Greaternumber
+	.type	v4_Greaternumber,@function
+v4_Greaternumber:
+.stabn 68,0,103,.LMa537-v4_Greaternumber
+.LMa537:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic53
+.Lpic53:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic53],%ebx
+0:
+.stabn 68,0,103,.LMb537-v4_Greaternumber
+.LMb537:
+.LBB53:
+.L35:
+.stabn 68,0,105,.LM539-v4_Greaternumber
+.LM539:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jle .L36
+.stabn 68,0,106,.LM545-v4_Greaternumber
+.LM545:
+	call v4_over@PLT
+	call v4_c_Fetch@PLT
+.stabn 68,0,107,.LM547-v4_Greaternumber
+.LM547:
+	call v4_dup@PLT
+	mov $97,%eax
+	call v4__dpush@PLT
+	mov $123,%eax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L37
+.stabn 68,0,108,.LM556-v4_Greaternumber
+.LM556:
+	mov $97,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	mov %eax,%esi
+	mov $65,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+.L37:
+.stabn 68,0,110,.LM571-v4_Greaternumber
+.LM571:
+	call v4_dup@PLT
+	mov $48,%eax
+	call v4__dpush@PLT
+	mov $58,%eax
+	call v4__dpush@PLT
+	call v4_within@PLT
+.stabn 68,0,111,.LM578-v4_Greaternumber
+.LM578:
+	call v4_over@PLT
+	mov $65,%eax
+	call v4__dpush@PLT
+	mov $91,%eax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	or %edx,%eax
+	not %eax
+	test %eax,%eax
+	je .L38
+.stabn 68,0,112,.LM596-v4_Greaternumber
+.LM596:
+	mov v4_drop@GOT(%ebx),%ecx
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.L38:
+.stabn 68,0,114,.LM599-v4_Greaternumber
+.LM599:
+	call v4_dup@PLT
+	mov $57,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	jle .L39
+.stabn 68,0,115,.LM608-v4_Greaternumber
+.LM608:
+	mov $65,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	mov %eax,%esi
+	mov $10,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,116,.LM622-v4_Greaternumber
+.LM622:
+	jmp .L40
+.L39:
+.stabn 68,0,117,.LM624-v4_Greaternumber
+.LM624:
+	mov $48,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.L40:
+.stabn 68,0,119,.LM632-v4_Greaternumber
+.LM632:
+	call v4_dup@PLT
+	mov v4__base@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	test %eax,%eax
+	jne .L54
+.stabn 68,0,49,.LM644-v4_Greaternumber
+.LM644:
+	mov $10,%eax
+	mov v4__base@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.L54:
+	mov v4__base@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	not %eax
+	test %eax,%eax
+	je .L41
+.stabn 68,0,120,.LM668-v4_Greaternumber
+.LM668:
+	mov v4_drop@GOT(%ebx),%ecx
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.L41:
+.stabn 68,0,122,.LM671-v4_Greaternumber
+.LM671:
+	call v4_swap@PLT
+	call v4_Greaterr@PLT
+	call v4_swap@PLT
+	call v4_Greaterr@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,123,.LM676-v4_Greaternumber
+.LM676:
+	call v4_drop@PLT
+	mov v4__base@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	test %eax,%eax
+	jne .L55
+.stabn 68,0,49,.LM688-v4_Greaternumber
+.LM688:
+	mov $10,%eax
+	mov v4__base@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.L55:
+	mov v4__base@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+	call v4_um_Star@PLT
+	call v4_drop@PLT
+	call v4_r_Greater@PLT
+	call v4_um_Plus@PLT
+.stabn 68,0,124,.LM705-v4_Greaternumber
+.LM705:
+	call v4_r_Greater@PLT
+	call v4_char_Plus@PLT
+.stabn 68,0,125,.LM707-v4_Greaternumber
+.LM707:
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	dec %eax
+	call v4__dpush@PLT
+.stabn 68,0,126,.LM712-v4_Greaternumber
+.LM712:
+	jmp .L35
+.L36:
+.L34:
+.LBE53:
+.stabn 68,0,126,.LM715-v4_Greaternumber
+.LM715:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe53:
+	.size	 v4_Greaternumber,.Lfe53-v4_Greaternumber
+.stabn	192,0,0,.LBB53-v4_Greaternumber
+.stabn	224,0,0,.LBE53-v4_Greaternumber
+.Lscope53:
+.stabs	"",36,0,0,.Lscope53-v4_Greaternumber
+.text
+	.align 4
+.stabs "v4_toupper:F1",36,0,0,v4_toupper
+	.weak v4_toupper
+	.type	v4_toupper,@function
+v4_toupper:
+.stabn 68,0,128,.LMa716-v4_toupper
+.LMa716:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic60
+.Lpic60:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic60],%ebx
+0:
+.stabn 68,0,128,.LMb716-v4_toupper
+.LMb716:
+.LBB60:
+.stabn 68,0,129,.LM717-v4_toupper
+.LM717:
+	call v4_dup@PLT
+	mov $97,%eax
+	call v4__dpush@PLT
+	mov $123,%eax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L43
+	mov $97,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	mov %eax,%esi
+	mov $65,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+.L43:
+.LBE60:
+.stabn 68,0,129,.LM742-v4_toupper
+.LM742:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe60:
+	.size	 v4_toupper,.Lfe60-v4_toupper
+.stabn	192,0,0,.LBB60-v4_toupper
+.stabn	224,0,0,.LBE60-v4_toupper
+.Lscope60:
+.stabs	"",36,0,0,.Lscope60-v4_toupper
+.text
+	.align 4
+.stabs "v4_tolower:F1",36,0,0,v4_tolower
+	.weak v4_tolower
+	.type	v4_tolower,@function
+v4_tolower:
+.stabn 68,0,131,.LMa743-v4_tolower
+.LMa743:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic61
+.Lpic61:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic61],%ebx
+0:
+.stabn 68,0,131,.LMb743-v4_tolower
+.LMb743:
+.LBB61:
+.stabn 68,0,132,.LM744-v4_tolower
+.LM744:
+	call v4_dup@PLT
+	mov $65,%eax
+	call v4__dpush@PLT
+	mov $91,%eax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L45
+	mov $65,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	mov %eax,%esi
+	mov $97,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+.L45:
+.LBE61:
+.stabn 68,0,132,.LM769-v4_tolower
+.LM769:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe61:
+	.size	 v4_tolower,.Lfe61-v4_tolower
+.stabn	192,0,0,.LBB61-v4_tolower
+.stabn	224,0,0,.LBE61-v4_tolower
+.Lscope61:
+.stabs	"",36,0,0,.Lscope61-v4_tolower
+.text
+	.align 4
+.stabs "v4_strlen:F1",36,0,0,v4_strlen
+	.weak v4_strlen
+	.type	v4_strlen,@function
+v4_strlen:
+.stabn 68,0,134,.LMa770-v4_strlen
+.LMa770:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic62
+.Lpic62:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic62],%ebx
+0:
+.stabn 68,0,134,.LMb770-v4_strlen
+.LMb770:
+.LBB62:
+.stabn 68,0,135,.LM771-v4_strlen
+.LM771:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L47:
+.stabn 68,0,136,.LM774-v4_strlen
+.LM774:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	not %eax
+	test %eax,%eax
+	je .L48
+	call v4__dpop@PLT
+	inc %eax
+	call v4__dpush@PLT
+.stabn 68,0,138,.LM795-v4_strlen
+.LM795:
+	jmp .L47
+.L48:
+.LBE62:
+.stabn 68,0,138,.LM798-v4_strlen
+.LM798:
+	pop %ebx
+	leave
+	ret
+.Lfe62:
+	.size	 v4_strlen,.Lfe62-v4_strlen
+.stabn	192,0,0,.LBB62-v4_strlen
+.stabn	224,0,0,.LBE62-v4_strlen
+.Lscope62:
+.stabs	"",36,0,0,.Lscope62-v4_strlen
+.text
+	.align 4
+.stabs "v4_convert:F1",36,0,0,v4_convert
+	.weak v4_convert
+	.type	v4_convert,@function
+v4_convert:
+.stabn 68,0,140,.LMa799-v4_convert
+.LMa799:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic63
+.Lpic63:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic63],%ebx
+0:
+.stabn 68,0,140,.LMb799-v4_convert
+.LMb799:
+.LBB63:
+.stabn 68,0,141,.LM800-v4_convert
+.LM800:
+	call v4_char_Plus@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	call v4_Greaternumber@PLT
+	mov v4_drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE63:
+.stabn 68,0,141,.LM806-v4_convert
+.LM806:
+	pop %ebx
+	leave
+	ret
+.Lfe63:
+	.size	 v4_convert,.Lfe63-v4_convert
+.stabn	192,0,0,.LBB63-v4_convert
+.stabn	224,0,0,.LBE63-v4_convert
+.Lscope63:
+.stabs	"",36,0,0,.Lscope63-v4_convert
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
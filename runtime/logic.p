@@ -0,0 +1,84 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: logic.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+    36 Sym_0 codeword "v4_and"
+   138 Sym_6 word "v4_false"
+   135 Sym_5 word "v4_invert"
+   102 Sym_3 codeword "v4_lshift"
+    58 Sym_1 codeword "v4_or"
+   124 Sym_4 codeword "v4_rshift"
+   139 Sym_7 word "v4_true"
+    80 Sym_2 codeword "v4_xor"
+
+Intermediate code:
+    36 function Sym_0 {
+    37   asm (    call v4__dpop@PLT)
+    38   asm (    mov %eax,%edi)
+    39   asm (    call v4__dpop@PLT)
+    40   asm (    and %edi,%eax)
+    41   asm (    call v4__dpush@PLT)
+    43   asm (    forth_pic.=0b-0b)
+    44 }
+
+    58 function Sym_1 {
+    59   asm (    call v4__dpop@PLT)
+    60   asm (    mov %eax,%edi)
+    61   asm (    call v4__dpop@PLT)
+    62   asm (    or %edi,%eax)
+    63   asm (    call v4__dpush@PLT)
+    65   asm (    forth_pic.=0b-0b)
+    66 }
+
+    80 function Sym_2 {
+    81   asm (    call v4__dpop@PLT)
+    82   asm (    mov %eax,%edi)
+    83   asm (    call v4__dpop@PLT)
+    84   asm (    xor %edi,%eax)
+    85   asm (    call v4__dpush@PLT)
+    87   asm (    forth_pic.=0b-0b)
+    88 }
+
+   102 function Sym_3 {
+   103   asm (    call v4__dpop@PLT)
+   104   asm (    mov %eax,%ecx)
+   105   asm (    call v4__dpop@PLT)
+   106   asm (    shl %cl,%eax)
+   107   asm (    call v4__dpush@PLT)
+   109   asm (    forth_pic.=0b-0b)
+   110 }
+
+   124 function Sym_4 {
+   125   asm (    call v4__dpop@PLT)
+   126   asm (    mov %eax,%ecx)
+   127   asm (    call v4__dpop@PLT)
+   128   asm (    shr %cl,%eax)
+   129   asm (    call v4__dpush@PLT)
+   131   asm (    forth_pic.=0b-0b)
+   132 }
+
+   135 function Sym_5 {
+   136   Reg_0 = -1
+   136   Stack_D = Reg_0
+   136   tail call Sym_2
+           optimizes   call Sym_2
+   136   no-op
+           optimizes label Label_1
+   136 }
+
+   138 function Sym_6 {
+   138   Reg_0 = 0
+   138   Stack_D = Reg_0
+   138   no-op
+           optimizes label Label_2
+   138 }
+
+   139 function Sym_7 {
+   139   Reg_0 = -1
+   139   Stack_D = Reg_0
+   139   no-op
+           optimizes label Label_3
+   139 }
+
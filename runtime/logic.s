@@ -0,0 +1,332 @@
+	.file	"logic.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"logic.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_and:F1",36,0,0,v4_and
+	.weak v4_and
+	.type	v4_and,@function
+v4_and:
+.stabn 68,0,36,.LMa0-v4_and
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,36,.LMb0-v4_and
+.LMb0:
+.LBB0:
+#APP
+    call v4__dpop@PLT
+    mov %eax,%edi
+    call v4__dpop@PLT
+    and %edi,%eax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE0:
+.stabn 68,0,44,.LM7-v4_and
+.LM7:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_and,.Lfe0-v4_and
+.stabn	192,0,0,.LBB0-v4_and
+.stabn	224,0,0,.LBE0-v4_and
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_and
+.text
+	.align 4
+.stabs "v4_or:F1",36,0,0,v4_or
+	.weak v4_or
+	.type	v4_or,@function
+v4_or:
+.stabn 68,0,58,.LMa8-v4_or
+.LMa8:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic1
+.Lpic1:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic1],%ebx
+0:
+.stabn 68,0,58,.LMb8-v4_or
+.LMb8:
+.LBB1:
+#APP
+    call v4__dpop@PLT
+    mov %eax,%edi
+    call v4__dpop@PLT
+    or %edi,%eax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE1:
+.stabn 68,0,66,.LM15-v4_or
+.LM15:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe1:
+	.size	 v4_or,.Lfe1-v4_or
+.stabn	192,0,0,.LBB1-v4_or
+.stabn	224,0,0,.LBE1-v4_or
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4_or
+.text
+	.align 4
+.stabs "v4_xor:F1",36,0,0,v4_xor
+	.weak v4_xor
+	.type	v4_xor,@function
+v4_xor:
+.stabn 68,0,80,.LMa16-v4_xor
+.LMa16:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic2
+.Lpic2:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic2],%ebx
+0:
+.stabn 68,0,80,.LMb16-v4_xor
+.LMb16:
+.LBB2:
+#APP
+    call v4__dpop@PLT
+    mov %eax,%edi
+    call v4__dpop@PLT
+    xor %edi,%eax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE2:
+.stabn 68,0,88,.LM23-v4_xor
+.LM23:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe2:
+	.size	 v4_xor,.Lfe2-v4_xor
+.stabn	192,0,0,.LBB2-v4_xor
+.stabn	224,0,0,.LBE2-v4_xor
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4_xor
+.text
+	.align 4
+.stabs "v4_lshift:F1",36,0,0,v4_lshift
+	.weak v4_lshift
+	.type	v4_lshift,@function
+v4_lshift:
+.stabn 68,0,102,.LMa24-v4_lshift
+.LMa24:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic3
+.Lpic3:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic3],%ebx
+0:
+.stabn 68,0,102,.LMb24-v4_lshift
+.LMb24:
+.LBB3:
+#APP
+    call v4__dpop@PLT
+    mov %eax,%ecx
+    call v4__dpop@PLT
+    shl %cl,%eax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE3:
+.stabn 68,0,110,.LM31-v4_lshift
+.LM31:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe3:
+	.size	 v4_lshift,.Lfe3-v4_lshift
+.stabn	192,0,0,.LBB3-v4_lshift
+.stabn	224,0,0,.LBE3-v4_lshift
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4_lshift
+.text
+	.align 4
+.stabs "v4_rshift:F1",36,0,0,v4_rshift
+	.weak v4_rshift
+	.type	v4_rshift,@function
+v4_rshift:
+.stabn 68,0,124,.LMa32-v4_rshift
+.LMa32:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic4
+.Lpic4:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic4],%ebx
+0:
+.stabn 68,0,124,.LMb32-v4_rshift
+.LMb32:
+.LBB4:
+#APP
+    call v4__dpop@PLT
+    mov %eax,%ecx
+    call v4__dpop@PLT
+    shr %cl,%eax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE4:
+.stabn 68,0,132,.LM39-v4_rshift
+.LM39:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe4:
+	.size	 v4_rshift,.Lfe4-v4_rshift
+.stabn	192,0,0,.LBB4-v4_rshift
+.stabn	224,0,0,.LBE4-v4_rshift
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4_rshift
+.text
+	.align 4
+.stabs "v4_invert:F1",36,0,0,v4_invert
+	.weak v4_invert
+	.type	v4_invert,@function
+v4_invert:
+.stabn 68,0,135,.LMa40-v4_invert
+.LMa40:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic5
+.Lpic5:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic5],%ebx
+0:
+.stabn 68,0,135,.LMb40-v4_invert
+.LMb40:
+.LBB5:
+.stabn 68,0,136,.LM41-v4_invert
+.LM41:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	mov v4_xor@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE5:
+.stabn 68,0,136,.LM45-v4_invert
+.LM45:
+	pop %ebx
+	leave
+	ret
+.Lfe5:
+	.size	 v4_invert,.Lfe5-v4_invert
+.stabn	192,0,0,.LBB5-v4_invert
+.stabn	224,0,0,.LBE5-v4_invert
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4_invert
+.text
+	.align 4
+.stabs "v4_false:F1",36,0,0,v4_false
+	.weak v4_false
+	.type	v4_false,@function
+v4_false:
+.stabn 68,0,138,.LMa46-v4_false
+.LMa46:
+	push %ebx
+	call .Lpic6
+.Lpic6:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic6],%ebx
+0:
+.stabn 68,0,138,.LMb46-v4_false
+.LMb46:
+.LBB6:
+	xor %eax,%eax
+	call v4__dpush@PLT
+.LBE6:
+.stabn 68,0,138,.LM50-v4_false
+.LM50:
+	pop %ebx
+	ret
+.Lfe6:
+	.size	 v4_false,.Lfe6-v4_false
+.stabn	192,0,0,.LBB6-v4_false
+.stabn	224,0,0,.LBE6-v4_false
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4_false
+.text
+	.align 4
+.stabs "v4_true:F1",36,0,0,v4_true
+	.weak v4_true
+	.type	v4_true,@function
+v4_true:
+.stabn 68,0,139,.LMa51-v4_true
+.LMa51:
+	push %ebx
+	call .Lpic7
+.Lpic7:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic7],%ebx
+0:
+.stabn 68,0,139,.LMb51-v4_true
+.LMb51:
+.LBB7:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+.LBE7:
+.stabn 68,0,139,.LM55-v4_true
+.LM55:
+	pop %ebx
+	ret
+.Lfe7:
+	.size	 v4_true,.Lfe7-v4_true
+.stabn	192,0,0,.LBB7-v4_true
+.stabn	224,0,0,.LBE7-v4_true
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_true
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
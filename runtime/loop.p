@@ -0,0 +1,91 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: loop.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+    30 Sym_8 external "v4_Greaterr"
+    24 Sym_2 external "v4_Plus"
+    23 Sym_0 word "v4_bounds"
+    26 Sym_4 word "v4_i"
+    29 Sym_6 word "v4_j"
+    32 Sym_9 word "v4_k"
+    24 Sym_1 external "v4_over"
+    27 Sym_5 external "v4_r_Fetch"
+    30 Sym_7 external "v4_r_Greater"
+    24 Sym_3 external "v4_swap"
+    35 Sym_10 word "v4_unloop"
+    36 Sym_11 external "v4_z2drop"
+
+Intermediate code:
+    23 function Sym_0 {
+    24   call Sym_1
+    24   no-op
+           optimizes   call Sym_2
+    24   Reg_1 = Stack_D
+    24   Reg_0 = Stack_D
+    24   Reg_0 += Reg_1
+    24   Stack_D = Reg_0
+    24   tail call Sym_3
+           optimizes   call Sym_3
+    24   no-op
+           optimizes label Label_1
+    24 }
+
+    26 function Sym_4 {
+    27   tail call Sym_5
+           optimizes   call Sym_5
+    27   no-op
+           optimizes label Label_2
+    27 }
+
+    29 function Sym_6 {
+    30   call Sym_7
+    30   call Sym_7
+    30   no-op
+           optimizes   call Sym_4
+    27   call Sym_5
+    30   call Sym_3
+    30   call Sym_8
+    30   call Sym_3
+    30   tail call Sym_8
+           optimizes   call Sym_8
+    30   no-op
+           optimizes label Label_3
+    30 }
+
+    32 function Sym_9 {
+    33   call Sym_7
+    33   call Sym_7
+    33   no-op
+           optimizes   call Sym_6
+    30   call Sym_7
+    30   call Sym_7
+    30   no-op
+           optimizes   call Sym_4
+    27   call Sym_5
+    30   call Sym_3
+    30   call Sym_8
+    30   call Sym_3
+    30   call Sym_8
+    33   call Sym_3
+    33   call Sym_8
+    33   call Sym_3
+    33   tail call Sym_8
+           optimizes   call Sym_8
+    33   no-op
+           optimizes label Label_4
+    33 }
+
+    35 function Sym_10 {
+    36   call Sym_7
+    36   call Sym_7
+    36   tail call Sym_11
+           optimizes   call Sym_11
+    36   no-op
+           optimizes label Label_5
+    36 }
+
+Peephole rewrites:
+  v4_bounds: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+
@@ -0,0 +1,239 @@
+	.file	"loop.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"loop.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_bounds:F1",36,0,0,v4_bounds
+	.weak v4_bounds
+	.type	v4_bounds,@function
+v4_bounds:
+.stabn 68,0,23,.LMa0-v4_bounds
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,23,.LMb0-v4_bounds
+.LMb0:
+.LBB0:
+.stabn 68,0,24,.LM1-v4_bounds
+.LM1:
+	call v4_over@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	mov v4_swap@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE0:
+.stabn 68,0,24,.LM9-v4_bounds
+.LM9:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_bounds,.Lfe0-v4_bounds
+.stabn	192,0,0,.LBB0-v4_bounds
+.stabn	224,0,0,.LBE0-v4_bounds
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_bounds
+.text
+	.align 4
+.stabs "v4_i:F1",36,0,0,v4_i
+	.weak v4_i
+	.type	v4_i,@function
+v4_i:
+.stabn 68,0,26,.LMa10-v4_i
+.LMa10:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic4
+.Lpic4:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic4],%ebx
+0:
+.stabn 68,0,26,.LMb10-v4_i
+.LMb10:
+.LBB4:
+.stabn 68,0,27,.LM11-v4_i
+.LM11:
+	mov v4_r_Fetch@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE4:
+.stabn 68,0,27,.LM13-v4_i
+.LM13:
+	pop %ebx
+	leave
+	ret
+.Lfe4:
+	.size	 v4_i,.Lfe4-v4_i
+.stabn	192,0,0,.LBB4-v4_i
+.stabn	224,0,0,.LBE4-v4_i
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4_i
+.text
+	.align 4
+.stabs "v4_j:F1",36,0,0,v4_j
+	.weak v4_j
+	.type	v4_j,@function
+v4_j:
+.stabn 68,0,29,.LMa14-v4_j
+.LMa14:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic6
+.Lpic6:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic6],%ebx
+0:
+.stabn 68,0,29,.LMb14-v4_j
+.LMb14:
+.LBB6:
+.stabn 68,0,30,.LM15-v4_j
+.LM15:
+	call v4_r_Greater@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,27,.LM18-v4_j
+.LM18:
+	call v4_r_Fetch@PLT
+.stabn 68,0,30,.LM19-v4_j
+.LM19:
+	call v4_swap@PLT
+	call v4_Greaterr@PLT
+	call v4_swap@PLT
+	mov v4_Greaterr@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE6:
+.stabn 68,0,30,.LM24-v4_j
+.LM24:
+	pop %ebx
+	leave
+	ret
+.Lfe6:
+	.size	 v4_j,.Lfe6-v4_j
+.stabn	192,0,0,.LBB6-v4_j
+.stabn	224,0,0,.LBE6-v4_j
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4_j
+.text
+	.align 4
+.stabs "v4_k:F1",36,0,0,v4_k
+	.weak v4_k
+	.type	v4_k,@function
+v4_k:
+.stabn 68,0,32,.LMa25-v4_k
+.LMa25:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic9
+.Lpic9:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic9],%ebx
+0:
+.stabn 68,0,32,.LMb25-v4_k
+.LMb25:
+.LBB9:
+.stabn 68,0,33,.LM26-v4_k
+.LM26:
+	call v4_r_Greater@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,30,.LM29-v4_k
+.LM29:
+	call v4_r_Greater@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,27,.LM32-v4_k
+.LM32:
+	call v4_r_Fetch@PLT
+.stabn 68,0,30,.LM33-v4_k
+.LM33:
+	call v4_swap@PLT
+	call v4_Greaterr@PLT
+	call v4_swap@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,33,.LM37-v4_k
+.LM37:
+	call v4_swap@PLT
+	call v4_Greaterr@PLT
+	call v4_swap@PLT
+	mov v4_Greaterr@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE9:
+.stabn 68,0,33,.LM42-v4_k
+.LM42:
+	pop %ebx
+	leave
+	ret
+.Lfe9:
+	.size	 v4_k,.Lfe9-v4_k
+.stabn	192,0,0,.LBB9-v4_k
+.stabn	224,0,0,.LBE9-v4_k
+.Lscope9:
+.stabs	"",36,0,0,.Lscope9-v4_k
+.text
+	.align 4
+.stabs "v4_unloop:F1",36,0,0,v4_unloop
+	.weak v4_unloop
+	.type	v4_unloop,@function
+v4_unloop:
+.stabn 68,0,35,.LMa43-v4_unloop
+.LMa43:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic10
+.Lpic10:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic10],%ebx
+0:
+.stabn 68,0,35,.LMb43-v4_unloop
+.LMb43:
+.LBB10:
+.stabn 68,0,36,.LM44-v4_unloop
+.LM44:
+	call v4_r_Greater@PLT
+	call v4_r_Greater@PLT
+	mov v4_z2drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE10:
+.stabn 68,0,36,.LM48-v4_unloop
+.LM48:
+	pop %ebx
+	leave
+	ret
+.Lfe10:
+	.size	 v4_unloop,.Lfe10-v4_unloop
+.stabn	192,0,0,.LBB10-v4_unloop
+.stabn	224,0,0,.LBE10-v4_unloop
+.Lscope10:
+.stabs	"",36,0,0,.Lscope10-v4_unloop
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,432 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: memory.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+    70 Sym_2 codeword "v4_Fetch"
+   181 Sym_22 external "v4_Greaterr"
+   181 Sym_23 external "v4_Minus"
+   164 Sym_10 external "v4_Plus"
+   163 Sym_7 word "v4_Plus_Store"
+    51 Sym_1 codeword "v4_Store"
+   200 Sym_30 word "v4_aligned"
+   201 Sym_32 external "v4_and"
+   110 Sym_4 codeword "v4_c_Fetch"
+    89 Sym_3 codeword "v4_c_Store"
+   167 Sym_12 external "v4_cell_Plus"
+   201 Sym_31 external "v4_cells"
+   177 Sym_19 external "v4_drop"
+   170 Sym_14 external "v4_dup"
+   197 Sym_29 word "v4_erase"
+    33 Sym_0 codeword "v4_execute"
+   172 Sym_15 word "v4_fill"
+   175 Sym_18 external "v4_i"
+   179 Sym_21 word "v4_move"
+   164 Sym_9 external "v4_over"
+   181 Sym_24 external "v4_r_Fetch"
+   185 Sym_28 external "v4_r_Greater"
+   164 Sym_8 external "v4_swap"
+   152 Sym_6 codeword "v4_w_Fetch"
+   131 Sym_5 codeword "v4_w_Store"
+   173 Sym_16 external "v4_z0_Greater"
+   181 Sym_26 external "v4_z0_Less"
+   183 Sym_27 external "v4_z1_Minus"
+   181 Sym_25 external "v4_z1_Plus"
+   169 Sym_13 word "v4_z2_Fetch"
+   166 Sym_11 word "v4_z2_Store"
+   177 Sym_20 external "v4_z2drop"
+   175 Sym_17 external "v4_z2dup"
+
+Intermediate code:
+    33 function Sym_0 {
+    34   asm (    call v4__dpop@PLT)
+    35   asm (    call *%eax)
+    37   asm (    forth_pic.=0b-0b)
+    38 }
+
+    51 function Sym_1 {
+    52   asm (    call v4__dpop@PLT)
+    53   asm (    mov %eax,%edi)
+    54   asm (    call v4__dpop@PLT)
+    55   asm (    mov %eax,(%edi))
+    57   asm (    forth_pic.=0b-0b)
+    58 }
+
+    70 function Sym_2 {
+    71   asm (    call v4__dpop@PLT)
+    72   asm (    mov (%eax),%eax)
+    73   asm (    call v4__dpush@PLT)
+    75   asm (    forth_pic.=0b-0b)
+    76 }
+
+    89 function Sym_3 {
+    90   asm (    call v4__dpop@PLT)
+    91   asm (    mov %eax,%edi)
+    92   asm (    call v4__dpop@PLT)
+    93   asm (    mov %al,(%edi))
+    95   asm (    forth_pic.=0b-0b)
+    96 }
+
+   110 function Sym_4 {
+   111   asm (    call v4__dpop@PLT)
+   112   asm (    mov %eax,%edi)
+   113   asm (    xor %eax,%eax)
+   114   asm (    mov (%edi),%al)
+   115   asm (    call v4__dpush@PLT)
+   117   asm (    forth_pic.=0b-0b)
+   118 }
+
+   131 function Sym_5 {
+   132   asm (    call v4__dpop@PLT)
+   133   asm (    mov %eax,%edi)
+   134   asm (    call v4__dpop@PLT)
+   135   asm (    mov %ax,(%edi))
+   137   asm (    forth_pic.=0b-0b)
+   138 }
+
+   152 function Sym_6 {
+   153   asm (    call v4__dpop@PLT)
+   154   asm (    mov %eax,%edi)
+   155   asm (    xor %eax,%eax)
+   156   asm (    mov (%edi),%ax)
+   157   asm (    call v4__dpush@PLT)
+   159   asm (    forth_pic.=0b-0b)
+   160 }
+
+   163 function Sym_7 {
+   164   call Sym_8
+   164   call Sym_9
+   164   call Sym_2
+   164   no-op
+           optimizes   call Sym_10
+   164   Reg_1 = Stack_D
+   164   Reg_0 = Stack_D
+   164   Reg_0 += Reg_1
+   164   Stack_D = Reg_0
+   164   call Sym_8
+   164   tail call Sym_1
+           optimizes   call Sym_1
+   164   no-op
+           optimizes label Label_1
+   164 }
+
+   166 function Sym_11 {
+   167   call Sym_8
+   167   call Sym_9
+   167   call Sym_1
+   167   no-op
+           optimizes   call Sym_12
+   167   Reg_0 = Stack_D
+   167   Reg_0 += 4
+   167   Stack_D = Reg_0
+   167   tail call Sym_1
+           optimizes   call Sym_1
+   167   no-op
+           optimizes label Label_2
+   167 }
+
+   169 function Sym_13 {
+   170   call Sym_14
+   170   no-op
+           optimizes   call Sym_12
+   170   Reg_0 = Stack_D
+   170   Reg_0 += 4
+   170   Stack_D = Reg_0
+   170   call Sym_2
+   170   call Sym_8
+   170   tail call Sym_2
+           optimizes   call Sym_2
+   170   no-op
+           optimizes label Label_3
+   170 }
+
+   172 function Sym_15 {
+   173   call Sym_8
+   173   call Sym_14
+   173   no-op
+           optimizes   call Sym_16
+   173   Reg_0 = Stack_D
+   173   if Reg_0 <= 0 goto Label_5
+   173   no-op
+           optimizes   Reg_0 = Stack_D
+   173   no-op
+           optimizes   if Reg_0 == 0 goto Label_5
+   174   Reg_0 = 0
+   174   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   174   no-op
+           optimizes   Reg_1 = Stack_D
+   174   Reg_0 = Stack_D
+   174   if Reg_0 == Reg_1 goto Label_6
+   174   Stack_R = Reg_0
+   174   Stack_R = Reg_1
+   174 label Label_7
+   175   call Sym_17
+   175   call Sym_8
+   175   call Sym_18
+   175   no-op
+           optimizes   call Sym_10
+   175   Reg_1 = Stack_D
+   175   Reg_0 = Stack_D
+   175   Reg_0 += Reg_1
+   175   Stack_D = Reg_0
+   175   call Sym_3
+   176   Reg_1 = Stack_R
+   176   Reg_1 += 1
+   176   Reg_0 = Stack_R
+   176   Stack_R = Reg_0
+   176   Stack_R = Reg_1
+   176   Reg_1 -= Reg_0
+   176   if Reg_1 != 0 goto Label_7
+   176   no-op
+           optimizes label Label_8
+   176   Reg_0 = Stack_R
+   176   Reg_0 = Stack_R
+   176   no-op
+           optimizes label Label_6
+   177   goto Label_9
+   177 label Label_5
+   177   call Sym_19
+   176 label Label_6
+   177 label Label_9
+   177   tail call Sym_20
+           optimizes   call Sym_20
+   177   no-op
+           optimizes label Label_4
+   177 }
+
+   179 function Sym_21 {
+   180   call Sym_14
+   180   no-op
+           optimizes   call Sym_16
+   180   Reg_0 = Stack_D
+   180   if Reg_0 <= 0 goto Label_11
+   180   no-op
+           optimizes   Reg_0 = Stack_D
+   180   no-op
+           optimizes   if Reg_0 == 0 goto Label_11
+   181   call Sym_22
+   181   call Sym_17
+   181   no-op
+           optimizes   call Sym_23
+   181   Reg_1 = Stack_D
+   181   Reg_0 = Stack_D
+   181   Reg_0 -= Reg_1
+   181   Stack_D = Reg_0
+   181   call Sym_24
+   181   no-op
+           optimizes   call Sym_23
+   181   Reg_1 = Stack_D
+   181   Reg_0 = Stack_D
+   181   Reg_0 -= Reg_1
+   181   no-op
+           optimizes   Stack_D = Reg_0
+   181   no-op
+           optimizes   call Sym_25
+   181   no-op
+           optimizes   Reg_0 = Stack_D
+   181   Reg_0 += 1
+   181   no-op
+           optimizes   Stack_D = Reg_0
+   181   no-op
+           optimizes   call Sym_26
+   181   no-op
+           optimizes   Reg_0 = Stack_D
+   181   if Reg_0 >= 0 goto Label_12
+   182   no-op
+           optimizes   Reg_0 = Stack_D
+   182   no-op
+           optimizes   if Reg_0 == 0 goto Label_12
+   183   call Sym_8
+   183   call Sym_24
+   183   no-op
+           optimizes   call Sym_10
+   183   Reg_1 = Stack_D
+   183   Reg_0 = Stack_D
+   183   Reg_0 += Reg_1
+   183   no-op
+           optimizes   Stack_D = Reg_0
+   183   no-op
+           optimizes   call Sym_27
+   183   no-op
+           optimizes   Reg_0 = Stack_D
+   183   Reg_0 -= 1
+   183   Stack_D = Reg_0
+   184   call Sym_8
+   184   call Sym_24
+   184   no-op
+           optimizes   call Sym_10
+   184   Reg_1 = Stack_D
+   184   Reg_0 = Stack_D
+   184   Reg_0 += Reg_1
+   184   no-op
+           optimizes   Stack_D = Reg_0
+   184   no-op
+           optimizes   call Sym_27
+   184   no-op
+           optimizes   Reg_0 = Stack_D
+   184   Reg_0 -= 1
+   184   Stack_D = Reg_0
+   185   call Sym_28
+   185   Reg_0 = 0
+   185   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   185   no-op
+           optimizes   Reg_1 = Stack_D
+   185   Reg_0 = Stack_D
+   185   if Reg_0 == Reg_1 goto Label_13
+   185   Stack_R = Reg_0
+   185   Stack_R = Reg_1
+   185 label Label_14
+   186   call Sym_17
+   186   call Sym_8
+   186   call Sym_18
+   186   no-op
+           optimizes   call Sym_23
+   186   Reg_1 = Stack_D
+   186   Reg_0 = Stack_D
+   186   Reg_0 -= Reg_1
+   186   Stack_D = Reg_0
+   186   call Sym_4
+   187   call Sym_8
+   187   call Sym_18
+   187   no-op
+           optimizes   call Sym_23
+   187   Reg_1 = Stack_D
+   187   Reg_0 = Stack_D
+   187   Reg_0 -= Reg_1
+   187   Stack_D = Reg_0
+   187   call Sym_3
+   188   Reg_1 = Stack_R
+   188   Reg_1 += 1
+   188   Reg_0 = Stack_R
+   188   Stack_R = Reg_0
+   188   Stack_R = Reg_1
+   188   Reg_1 -= Reg_0
+   188   if Reg_1 != 0 goto Label_14
+   188   no-op
+           optimizes label Label_15
+   188   Reg_0 = Stack_R
+   188   Reg_0 = Stack_R
+   188   no-op
+           optimizes label Label_13
+   189   goto Label_16
+   189 label Label_12
+   190   call Sym_28
+   190   Reg_0 = 0
+   190   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   190   no-op
+           optimizes   Reg_1 = Stack_D
+   190   Reg_0 = Stack_D
+   190   if Reg_0 == Reg_1 goto Label_17
+   190   Stack_R = Reg_0
+   190   Stack_R = Reg_1
+   190 label Label_18
+   191   call Sym_17
+   191   call Sym_8
+   191   call Sym_18
+   191   no-op
+           optimizes   call Sym_10
+   191   Reg_1 = Stack_D
+   191   Reg_0 = Stack_D
+   191   Reg_0 += Reg_1
+   191   Stack_D = Reg_0
+   191   call Sym_4
+   192   call Sym_8
+   192   call Sym_18
+   192   no-op
+           optimizes   call Sym_10
+   192   Reg_1 = Stack_D
+   192   Reg_0 = Stack_D
+   192   Reg_0 += Reg_1
+   192   Stack_D = Reg_0
+   192   call Sym_3
+   193   Reg_1 = Stack_R
+   193   Reg_1 += 1
+   193   Reg_0 = Stack_R
+   193   Stack_R = Reg_0
+   193   Stack_R = Reg_1
+   193   Reg_1 -= Reg_0
+   193   if Reg_1 != 0 goto Label_18
+   193   no-op
+           optimizes label Label_19
+   193   Reg_0 = Stack_R
+   193   Reg_0 = Stack_R
+   193   no-op
+           optimizes label Label_17
+   194   no-op
+           optimizes label Label_16
+   195   goto Label_20
+   195 label Label_11
+   195   call Sym_19
+   188 label Label_13
+   194 label Label_16
+   193 label Label_17
+   195 label Label_20
+   195   tail call Sym_20
+           optimizes   call Sym_20
+   195   no-op
+           optimizes label Label_10
+   195 }
+
+   197 function Sym_29 {
+   198   Reg_0 = 0
+   198   Stack_D = Reg_0
+   198   tail call Sym_15
+           optimizes   call Sym_15
+   198   no-op
+           optimizes label Label_21
+   198 }
+
+   200 function Sym_30 {
+   201   no-op
+           optimizes   call Sym_12
+   201   Reg_0 = Stack_D
+   201   Reg_0 += 4
+   201   no-op
+           optimizes   Stack_D = Reg_0
+   201   no-op
+           optimizes   call Sym_27
+   201   no-op
+           optimizes   Reg_0 = Stack_D
+   201   Reg_0 -= 1
+   201   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   201   Reg_0 = -4
+           optimizes   Reg_0 = -1
+   201   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   201   no-op
+           optimizes   call Sym_31
+   201   no-op
+           optimizes   call Sym_32
+   201   no-op
+           optimizes   Reg_1 = Stack_D
+   201   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   201   Reg_0 &= Reg_1
+   201   Stack_D = Reg_0
+   201   no-op
+           optimizes label Label_22
+   201 }
+
+Peephole rewrites:
+  v4_Plus_Store: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_fill: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_fill: exchange-pop: xchg %edx,%eax; call v4__rpop@PLT; xchg %eax,%edx => call v4__rpop@PLT; mov %eax,%edx
+  v4_fill: redundant-test: test %edx,%edx => (none)
+  v4_move: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_move: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_move: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_move: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_move: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_move: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_move: exchange-pop: xchg %edx,%eax; call v4__rpop@PLT; xchg %eax,%edx => call v4__rpop@PLT; mov %eax,%edx
+  v4_move: redundant-test: test %edx,%edx => (none)
+  v4_move: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_move: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_move: exchange-pop: xchg %edx,%eax; call v4__rpop@PLT; xchg %eax,%edx => call v4__rpop@PLT; mov %eax,%edx
+  v4_move: redundant-test: test %edx,%edx => (none)
+
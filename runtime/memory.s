@@ -0,0 +1,792 @@
+	.file	"memory.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"memory.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_execute:F1",36,0,0,v4_execute
+	.weak v4_execute
+	.type	v4_execute,@function
+v4_execute:
+.stabn 68,0,33,.LMa0-v4_execute
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,33,.LMb0-v4_execute
+.LMb0:
+.LBB0:
+#APP
+    call v4__dpop@PLT
+    call *%eax
+    forth_pic.=0b-0b
+#NO_APP
+.LBE0:
+.stabn 68,0,38,.LM4-v4_execute
+.LM4:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_execute,.Lfe0-v4_execute
+.stabn	192,0,0,.LBB0-v4_execute
+.stabn	224,0,0,.LBE0-v4_execute
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_execute
+.text
+	.align 4
+.stabs "v4_Store:F1",36,0,0,v4_Store
+	.weak v4_Store
+	.type	v4_Store,@function
+v4_Store:
+.stabn 68,0,51,.LMa5-v4_Store
+.LMa5:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic1
+.Lpic1:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic1],%ebx
+0:
+.stabn 68,0,51,.LMb5-v4_Store
+.LMb5:
+.LBB1:
+#APP
+    call v4__dpop@PLT
+    mov %eax,%edi
+    call v4__dpop@PLT
+    mov %eax,(%edi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE1:
+.stabn 68,0,58,.LM11-v4_Store
+.LM11:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe1:
+	.size	 v4_Store,.Lfe1-v4_Store
+.stabn	192,0,0,.LBB1-v4_Store
+.stabn	224,0,0,.LBE1-v4_Store
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4_Store
+.text
+	.align 4
+.stabs "v4_Fetch:F1",36,0,0,v4_Fetch
+	.weak v4_Fetch
+	.type	v4_Fetch,@function
+v4_Fetch:
+.stabn 68,0,70,.LMa12-v4_Fetch
+.LMa12:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic2
+.Lpic2:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic2],%ebx
+0:
+.stabn 68,0,70,.LMb12-v4_Fetch
+.LMb12:
+.LBB2:
+#APP
+    call v4__dpop@PLT
+    mov (%eax),%eax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE2:
+.stabn 68,0,76,.LM17-v4_Fetch
+.LM17:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe2:
+	.size	 v4_Fetch,.Lfe2-v4_Fetch
+.stabn	192,0,0,.LBB2-v4_Fetch
+.stabn	224,0,0,.LBE2-v4_Fetch
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4_Fetch
+.text
+	.align 4
+.stabs "v4_c_Store:F1",36,0,0,v4_c_Store
+	.weak v4_c_Store
+	.type	v4_c_Store,@function
+v4_c_Store:
+.stabn 68,0,89,.LMa18-v4_c_Store
+.LMa18:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic3
+.Lpic3:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic3],%ebx
+0:
+.stabn 68,0,89,.LMb18-v4_c_Store
+.LMb18:
+.LBB3:
+#APP
+    call v4__dpop@PLT
+    mov %eax,%edi
+    call v4__dpop@PLT
+    mov %al,(%edi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE3:
+.stabn 68,0,96,.LM24-v4_c_Store
+.LM24:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe3:
+	.size	 v4_c_Store,.Lfe3-v4_c_Store
+.stabn	192,0,0,.LBB3-v4_c_Store
+.stabn	224,0,0,.LBE3-v4_c_Store
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4_c_Store
+.text
+	.align 4
+.stabs "v4_c_Fetch:F1",36,0,0,v4_c_Fetch
+	.weak v4_c_Fetch
+	.type	v4_c_Fetch,@function
+v4_c_Fetch:
+.stabn 68,0,110,.LMa25-v4_c_Fetch
+.LMa25:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic4
+.Lpic4:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic4],%ebx
+0:
+.stabn 68,0,110,.LMb25-v4_c_Fetch
+.LMb25:
+.LBB4:
+#APP
+    call v4__dpop@PLT
+    mov %eax,%edi
+    xor %eax,%eax
+    mov (%edi),%al
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE4:
+.stabn 68,0,118,.LM32-v4_c_Fetch
+.LM32:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe4:
+	.size	 v4_c_Fetch,.Lfe4-v4_c_Fetch
+.stabn	192,0,0,.LBB4-v4_c_Fetch
+.stabn	224,0,0,.LBE4-v4_c_Fetch
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4_c_Fetch
+.text
+	.align 4
+.stabs "v4_w_Store:F1",36,0,0,v4_w_Store
+	.weak v4_w_Store
+	.type	v4_w_Store,@function
+v4_w_Store:
+.stabn 68,0,131,.LMa33-v4_w_Store
+.LMa33:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic5
+.Lpic5:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic5],%ebx
+0:
+.stabn 68,0,131,.LMb33-v4_w_Store
+.LMb33:
+.LBB5:
+#APP
+    call v4__dpop@PLT
+    mov %eax,%edi
+    call v4__dpop@PLT
+    mov %ax,(%edi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE5:
+.stabn 68,0,138,.LM39-v4_w_Store
+.LM39:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe5:
+	.size	 v4_w_Store,.Lfe5-v4_w_Store
+.stabn	192,0,0,.LBB5-v4_w_Store
+.stabn	224,0,0,.LBE5-v4_w_Store
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4_w_Store
+.text
+	.align 4
+.stabs "v4_w_Fetch:F1",36,0,0,v4_w_Fetch
+	.weak v4_w_Fetch
+	.type	v4_w_Fetch,@function
+v4_w_Fetch:
+.stabn 68,0,152,.LMa40-v4_w_Fetch
+.LMa40:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic6
+.Lpic6:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic6],%ebx
+0:
+.stabn 68,0,152,.LMb40-v4_w_Fetch
+.LMb40:
+.LBB6:
+#APP
+    call v4__dpop@PLT
+    mov %eax,%edi
+    xor %eax,%eax
+    mov (%edi),%ax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE6:
+.stabn 68,0,160,.LM47-v4_w_Fetch
+.LM47:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe6:
+	.size	 v4_w_Fetch,.Lfe6-v4_w_Fetch
+.stabn	192,0,0,.LBB6-v4_w_Fetch
+.stabn	224,0,0,.LBE6-v4_w_Fetch
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4_w_Fetch
+.text
+	.align 4
+.stabs "v4_Plus_Store:F1",36,0,0,v4_Plus_Store
+	.weak v4_Plus_Store
+	.type	v4_Plus_Store,@function
+v4_Plus_Store:
+.stabn 68,0,163,.LMa48-v4_Plus_Store
+.LMa48:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic7
+.Lpic7:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic7],%ebx
+0:
+.stabn 68,0,163,.LMb48-v4_Plus_Store
+.LMb48:
+.LBB7:
+.stabn 68,0,164,.LM49-v4_Plus_Store
+.LM49:
+	call v4_swap@PLT
+	call v4_over@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	mov v4_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE7:
+.stabn 68,0,164,.LM60-v4_Plus_Store
+.LM60:
+	pop %ebx
+	leave
+	ret
+.Lfe7:
+	.size	 v4_Plus_Store,.Lfe7-v4_Plus_Store
+.stabn	192,0,0,.LBB7-v4_Plus_Store
+.stabn	224,0,0,.LBE7-v4_Plus_Store
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_Plus_Store
+.text
+	.align 4
+.stabs "v4_z2_Store:F1",36,0,0,v4_z2_Store
+	.weak v4_z2_Store
+	.type	v4_z2_Store,@function
+v4_z2_Store:
+.stabn 68,0,166,.LMa61-v4_z2_Store
+.LMa61:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic11
+.Lpic11:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic11],%ebx
+0:
+.stabn 68,0,166,.LMb61-v4_z2_Store
+.LMb61:
+.LBB11:
+.stabn 68,0,167,.LM62-v4_z2_Store
+.LM62:
+	call v4_swap@PLT
+	call v4_over@PLT
+	call v4_Store@PLT
+	call v4__dpop@PLT
+	add $4,%eax
+	call v4__dpush@PLT
+	mov v4_Store@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE11:
+.stabn 68,0,167,.LM71-v4_z2_Store
+.LM71:
+	pop %ebx
+	leave
+	ret
+.Lfe11:
+	.size	 v4_z2_Store,.Lfe11-v4_z2_Store
+.stabn	192,0,0,.LBB11-v4_z2_Store
+.stabn	224,0,0,.LBE11-v4_z2_Store
+.Lscope11:
+.stabs	"",36,0,0,.Lscope11-v4_z2_Store
+.text
+	.align 4
+.stabs "v4_z2_Fetch:F1",36,0,0,v4_z2_Fetch
+	.weak v4_z2_Fetch
+	.type	v4_z2_Fetch,@function
+v4_z2_Fetch:
+.stabn 68,0,169,.LMa72-v4_z2_Fetch
+.LMa72:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic13
+.Lpic13:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic13],%ebx
+0:
+.stabn 68,0,169,.LMb72-v4_z2_Fetch
+.LMb72:
+.LBB13:
+.stabn 68,0,170,.LM73-v4_z2_Fetch
+.LM73:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	add $4,%eax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4_swap@PLT
+	mov v4_Fetch@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE13:
+.stabn 68,0,170,.LM82-v4_z2_Fetch
+.LM82:
+	pop %ebx
+	leave
+	ret
+.Lfe13:
+	.size	 v4_z2_Fetch,.Lfe13-v4_z2_Fetch
+.stabn	192,0,0,.LBB13-v4_z2_Fetch
+.stabn	224,0,0,.LBE13-v4_z2_Fetch
+.Lscope13:
+.stabs	"",36,0,0,.Lscope13-v4_z2_Fetch
+.text
+	.align 4
+.stabs "v4_fill:F1",36,0,0,v4_fill
+	.weak v4_fill
+	.type	v4_fill,@function
+v4_fill:
+.stabn 68,0,172,.LMa83-v4_fill
+.LMa83:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic15
+.Lpic15:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic15],%ebx
+0:
+.stabn 68,0,172,.LMb83-v4_fill
+.LMb83:
+.LBB15:
+.stabn 68,0,173,.LM84-v4_fill
+.LM84:
+	call v4_swap@PLT
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jle .L5
+.stabn 68,0,174,.LM91-v4_fill
+.LM91:
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %eax,%edx
+	je .L6
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+.L7:
+.stabn 68,0,175,.LM99-v4_fill
+.LM99:
+	call v4_z2dup@PLT
+	call v4_swap@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Store@PLT
+.stabn 68,0,176,.LM108-v4_fill
+.LM108:
+	call v4__rpop@PLT
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L7
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.stabn 68,0,177,.LM119-v4_fill
+.LM119:
+	jmp .L9
+.L5:
+	call v4_drop@PLT
+.L6:
+.L9:
+	mov v4_z2drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE15:
+.stabn 68,0,177,.LM126-v4_fill
+.LM126:
+	pop %ebx
+	leave
+	ret
+.Lfe15:
+	.size	 v4_fill,.Lfe15-v4_fill
+.stabn	192,0,0,.LBB15-v4_fill
+.stabn	224,0,0,.LBE15-v4_fill
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4_fill
+.text
+	.align 4
+.stabs "v4_move:F1",36,0,0,v4_move
+	.weak v4_move
+	.type	v4_move,@function
+v4_move:
+.stabn 68,0,179,.LMa127-v4_move
+.LMa127:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic21
+.Lpic21:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic21],%ebx
+0:
+.stabn 68,0,179,.LMb127-v4_move
+.LMb127:
+.LBB21:
+.stabn 68,0,180,.LM128-v4_move
+.LM128:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jle .L11
+.stabn 68,0,181,.LM134-v4_move
+.LM134:
+	call v4_Greaterr@PLT
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+	call v4_r_Fetch@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	inc %eax
+	test %eax,%eax
+	jge .L12
+.stabn 68,0,183,.LM156-v4_move
+.LM156:
+	call v4_swap@PLT
+	call v4_r_Fetch@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	dec %eax
+	call v4__dpush@PLT
+.stabn 68,0,184,.LM167-v4_move
+.LM167:
+	call v4_swap@PLT
+	call v4_r_Fetch@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	dec %eax
+	call v4__dpush@PLT
+.stabn 68,0,185,.LM178-v4_move
+.LM178:
+	call v4_r_Greater@PLT
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %eax,%edx
+	je .L13
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+.L14:
+.stabn 68,0,186,.LM187-v4_move
+.LM187:
+	call v4_z2dup@PLT
+	call v4_swap@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+.stabn 68,0,187,.LM196-v4_move
+.LM196:
+	call v4_swap@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Store@PLT
+.stabn 68,0,188,.LM204-v4_move
+.LM204:
+	call v4__rpop@PLT
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L14
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.stabn 68,0,189,.LM215-v4_move
+.LM215:
+	jmp .L16
+.L12:
+.stabn 68,0,190,.LM217-v4_move
+.LM217:
+	call v4_r_Greater@PLT
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %eax,%edx
+	je .L17
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+.L18:
+.stabn 68,0,191,.LM226-v4_move
+.LM226:
+	call v4_z2dup@PLT
+	call v4_swap@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+.stabn 68,0,192,.LM235-v4_move
+.LM235:
+	call v4_swap@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Store@PLT
+.stabn 68,0,193,.LM243-v4_move
+.LM243:
+	call v4__rpop@PLT
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L18
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.stabn 68,0,195,.LM255-v4_move
+.LM255:
+	jmp .L20
+.L11:
+	call v4_drop@PLT
+.L13:
+.L16:
+.L17:
+.L20:
+	mov v4_z2drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE21:
+.stabn 68,0,195,.LM264-v4_move
+.LM264:
+	pop %ebx
+	leave
+	ret
+.Lfe21:
+	.size	 v4_move,.Lfe21-v4_move
+.stabn	192,0,0,.LBB21-v4_move
+.stabn	224,0,0,.LBE21-v4_move
+.Lscope21:
+.stabs	"",36,0,0,.Lscope21-v4_move
+.text
+	.align 4
+.stabs "v4_erase:F1",36,0,0,v4_erase
+	.weak v4_erase
+	.type	v4_erase,@function
+v4_erase:
+.stabn 68,0,197,.LMa265-v4_erase
+.LMa265:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic29
+.Lpic29:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic29],%ebx
+0:
+.stabn 68,0,197,.LMb265-v4_erase
+.LMb265:
+.LBB29:
+.stabn 68,0,198,.LM266-v4_erase
+.LM266:
+	xor %eax,%eax
+	call v4__dpush@PLT
+	mov v4_fill@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE29:
+.stabn 68,0,198,.LM270-v4_erase
+.LM270:
+	pop %ebx
+	leave
+	ret
+.Lfe29:
+	.size	 v4_erase,.Lfe29-v4_erase
+.stabn	192,0,0,.LBB29-v4_erase
+.stabn	224,0,0,.LBE29-v4_erase
+.Lscope29:
+.stabs	"",36,0,0,.Lscope29-v4_erase
+.text
+	.align 4
+.stabs "v4_aligned:F1",36,0,0,v4_aligned
+	.weak v4_aligned
+	.type	v4_aligned,@function
+v4_aligned:
+.stabn 68,0,200,.LMa271-v4_aligned
+.LMa271:
+	push %ebx
+	push %esi
+	call .Lpic30
+.Lpic30:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic30],%ebx
+0:
+.stabn 68,0,200,.LMb271-v4_aligned
+.LMb271:
+.LBB30:
+	call v4__dpop@PLT
+	add $4,%eax
+	dec %eax
+	mov %eax,%esi
+	mov $-4,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	and %edx,%eax
+	call v4__dpush@PLT
+.LBE30:
+.stabn 68,0,201,.LM289-v4_aligned
+.LM289:
+	pop %esi
+	pop %ebx
+	ret
+.Lfe30:
+	.size	 v4_aligned,.Lfe30-v4_aligned
+.stabn	192,0,0,.LBB30-v4_aligned
+.stabn	224,0,0,.LBE30-v4_aligned
+.Lscope30:
+.stabs	"",36,0,0,.Lscope30-v4_aligned
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
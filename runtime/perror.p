@@ -0,0 +1,2103 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: perror.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Data:
+   150 Data_125 string[0] ""
+   105 Data_80 string[31] ".lib section in a.out corrupted"
+   155 Data_126 string[2] ": "
+   165 Data_128 synonym Data_126
+   104 Data_79 string[36] "Accessing a corrupted shared library"
+   122 Data_97 string[22] "Address already in use"
+   121 Data_96 string[40] "Address family not supported by protocol"
+    92 Data_67 string[15] "Advertise error"
+    31 Data_6 string[17] "Arg list too long"
+   106 Data_81 string[42] "Attempting to link in too many shared libs"
+    38 Data_13 string[11] "Bad address"
+    33 Data_8 string[15] "Bad file number"
+    83 Data_58 string[20] "Bad font file format"
+    39 Data_14 string[21] "Block device required"
+    56 Data_31 string[11] "Broken pipe"
+   103 Data_78 string[38] "Can not access a needed shared library"
+   123 Data_98 string[31] "Cannot assign requested address"
+   107 Data_82 string[37] "Cannot exec a shared library directly"
+   132 Data_107 string[42] "Cannot send after transport endpoint shtdn"
+    68 Data_43 string[27] "Channel number out of range"
+    94 Data_69 string[27] "Communication error on send"
+   135 Data_110 string[18] "Connection refused"
+   128 Data_103 string[24] "Connection reset by peer"
+   134 Data_109 string[20] "Connection timed out"
+    42 Data_17 string[17] "Cross-device link"
+   113 Data_88 string[28] "Destination address required"
+    84 Data_59 string[19] "Device not a stream"
+    40 Data_15 string[23] "Device or resource busy"
+    63 Data_38 string[19] "Directory not empty"
+    78 Data_53 string[13] "Exchange full"
+    32 Data_7 string[17] "Exec format error"
+   101 Data_76 string[28] "File descriptor in bad state"
+    41 Data_16 string[11] "File exists"
+    60 Data_35 string[18] "File name too long"
+    47 Data_22 string[19] "File table overflow"
+    51 Data_26 string[14] "File too large"
+    62 Data_37 string[24] "Function not implemented"
+   136 Data_111 string[12] "Host is down"
+    29 Data_4 string[9] "I/O error"
+    67 Data_42 string[18] "Identifier removed"
+   108 Data_83 string[21] "Illegal byte sequence"
+    53 Data_28 string[12] "Illegal seek"
+   109 Data_84 string[40] "Interrupted sys call should be restarted"
+    28 Data_3 string[23] "Interrupted system call"
+    46 Data_21 string[16] "Invalid argument"
+    76 Data_51 string[16] "Invalid exchange"
+    80 Data_55 string[20] "Invalid request code"
+    77 Data_52 string[26] "Invalid request descriptor"
+    81 Data_56 string[12] "Invalid slot"
+    45 Data_20 string[14] "Is a directory"
+   144 Data_119 string[20] "Is a named type file"
+    75 Data_50 string[14] "Level 2 halted"
+    69 Data_44 string[24] "Level 2 not synchronized"
+    70 Data_45 string[14] "Level 3 halted"
+    71 Data_46 string[13] "Level 3 reset"
+    91 Data_66 string[21] "Link has been severed"
+    72 Data_47 string[24] "Link number out of range"
+    88 Data_63 string[29] "Machine is not on the network"
+    57 Data_32 string[35] "Math argument out of domain of func"
+    58 Data_33 string[29] "Math result not representable"
+   114 Data_89 string[16] "Message too long"
+    96 Data_71 string[18] "Multihop attempted"
+   100 Data_75 string[26] "Name not unique on network"
+   126 Data_101 string[43] "Network dropped connection because of reset"
+   124 Data_99 string[15] "Network is down"
+   125 Data_100 string[22] "Network is unreachable"
+    74 Data_49 string[26] "No CSI structure available"
+   143 Data_118 string[29] "No XENIX semaphores available"
+    79 Data_54 string[8] "No anode"
+   129 Data_104 string[25] "No buffer space available"
+    34 Data_9 string[18] "No child processes"
+    85 Data_60 string[17] "No data available"
+   147 Data_122 string[15] "No medium found"
+    66 Data_41 string[26] "No message of desired type"
+    61 Data_36 string[25] "No record locks available"
+   137 Data_112 string[16] "No route to host"
+    52 Data_27 string[23] "No space left on device"
+    43 Data_18 string[14] "No such device"
+    30 Data_5 string[25] "No such device or address"
+    26 Data_1 string[25] "No such file or directory"
+    27 Data_2 string[15] "No such process"
+   142 Data_117 string[27] "Not a XENIX named type file"
+    98 Data_73 string[18] "Not a data message"
+    44 Data_19 string[15] "Not a directory"
+    49 Data_24 string[16] "Not a typewriter"
+    90 Data_65 string[16] "Object is remote"
+   138 Data_113 string[29] "Operation already in progress"
+    25 Data_0 string[23] "Operation not permitted"
+   119 Data_94 string[42] "Operation not supported on transport endpt"
+   139 Data_114 string[25] "Operation now in progress"
+    65 Data_40 string[21] "Operation would block"
+    36 Data_11 string[13] "Out of memory"
+    87 Data_62 string[24] "Out of streams resources"
+    89 Data_64 string[21] "Package not installed"
+    37 Data_12 string[17] "Permission denied"
+    73 Data_48 string[28] "Protocol driver not attached"
+    95 Data_70 string[14] "Protocol error"
+   120 Data_95 string[29] "Protocol family not supported"
+   116 Data_91 string[22] "Protocol not available"
+   117 Data_92 string[22] "Protocol not supported"
+   115 Data_90 string[30] "Protocol wrong type for socket"
+   146 Data_121 string[14] "Quota exceeded"
+    97 Data_72 string[18] "RFS specific error"
+    54 Data_29 string[21] "Read-only file system"
+   145 Data_120 string[16] "Remote I/O error"
+   102 Data_77 string[22] "Remote address changed"
+    82 Data_57 string[28] "Resource deadlck would occur"
+    59 Data_34 string[29] "Resource deadlock would occur"
+   112 Data_87 string[30] "Socket operation on non-socket"
+   118 Data_93 string[25] "Socket type not supported"
+   127 Data_102 string[32] "Software caused connection abort"
+    93 Data_68 string[13] "Srmount error"
+   140 Data_115 string[21] "Stale NFS file handle"
+   110 Data_85 string[18] "Streams pipe error"
+   141 Data_116 string[24] "Structure needs cleaning"
+   149 Data_124 string[7] "Success"
+   161 Data_127 string[18] "System error code "
+    50 Data_25 string[14] "Text file busy"
+    86 Data_61 string[13] "Timer expired"
+    55 Data_30 string[14] "Too many links"
+    48 Data_23 string[19] "Too many open files"
+   133 Data_108 string[34] "Too many references: cannot splice"
+    64 Data_39 string[35] "Too many symbolic links encountered"
+   111 Data_86 string[14] "Too many users"
+   130 Data_105 string[39] "Transport endpoint is already connected"
+   131 Data_106 string[35] "Transport endpoint is not connected"
+    35 Data_10 string[9] "Try again"
+    99 Data_74 string[37] "Value too large for defined data type"
+   148 Data_123 string[17] "Wrong medium type"
+
+Symbols:
+   161 Sym_133 external "v4_Dotr"
+   154 Sym_129 external "v4_Questiondup"
+    31 Sym_7 external "v4__e2big"
+    37 Sym_13 external "v4__eacces"
+   122 Sym_98 external "v4__eaddrinuse"
+   123 Sym_99 external "v4__eaddrnotavail"
+    92 Sym_68 external "v4__eadv"
+   121 Sym_97 external "v4__eafnosupport"
+    35 Sym_11 external "v4__eagain"
+   138 Sym_114 external "v4__ealready"
+    76 Sym_52 external "v4__ebade"
+    33 Sym_9 external "v4__ebadf"
+   101 Sym_77 external "v4__ebadfd"
+    98 Sym_74 external "v4__ebadmsg"
+    77 Sym_53 external "v4__ebadr"
+    80 Sym_56 external "v4__ebadrqc"
+    81 Sym_57 external "v4__ebadslt"
+    83 Sym_59 external "v4__ebfont"
+    40 Sym_16 external "v4__ebusy"
+    34 Sym_10 external "v4__echild"
+    68 Sym_44 external "v4__echrng"
+    94 Sym_70 external "v4__ecomm"
+   127 Sym_103 external "v4__econnaborted"
+   135 Sym_111 external "v4__econnrefused"
+   128 Sym_104 external "v4__econnreset"
+    59 Sym_35 external "v4__edeadlk"
+    82 Sym_58 external "v4__edeadlock"
+   113 Sym_89 external "v4__edestaddrreq"
+    57 Sym_33 external "v4__edom"
+    97 Sym_73 external "v4__edotdot"
+   146 Sym_122 external "v4__edquot"
+    41 Sym_17 external "v4__eexist"
+    38 Sym_14 external "v4__efault"
+    51 Sym_27 external "v4__efbig"
+   136 Sym_112 external "v4__ehostdown"
+   137 Sym_113 external "v4__ehostunreach"
+    67 Sym_43 external "v4__eidrm"
+   108 Sym_84 external "v4__eilseq"
+   139 Sym_115 external "v4__einprogress"
+    28 Sym_4 external "v4__eintr"
+    46 Sym_22 external "v4__einval"
+    29 Sym_5 external "v4__eio"
+   130 Sym_106 external "v4__eisconn"
+    45 Sym_21 external "v4__eisdir"
+   144 Sym_120 external "v4__eisnam"
+    75 Sym_51 external "v4__el2hlt"
+    69 Sym_45 external "v4__el2nsync"
+    70 Sym_46 external "v4__el3hlt"
+    71 Sym_47 external "v4__el3rst"
+   103 Sym_79 external "v4__elibacc"
+   104 Sym_80 external "v4__elibbad"
+   107 Sym_83 external "v4__elibexec"
+   106 Sym_82 external "v4__elibmax"
+   105 Sym_81 external "v4__elibscn"
+    72 Sym_48 external "v4__elnrng"
+    64 Sym_40 external "v4__eloop"
+   148 Sym_124 external "v4__emediumtype"
+    48 Sym_24 external "v4__emfile"
+    55 Sym_31 external "v4__emlink"
+   114 Sym_90 external "v4__emsgsize"
+    96 Sym_72 external "v4__emultihop"
+    60 Sym_36 external "v4__enametoolong"
+   143 Sym_119 external "v4__enavail"
+   124 Sym_100 external "v4__enetdown"
+   126 Sym_102 external "v4__enetreset"
+   125 Sym_101 external "v4__enetunreach"
+    47 Sym_23 external "v4__enfile"
+    79 Sym_55 external "v4__enoano"
+   129 Sym_105 external "v4__enobufs"
+    74 Sym_50 external "v4__enocsi"
+    85 Sym_61 external "v4__enodata"
+    43 Sym_19 external "v4__enodev"
+    26 Sym_2 external "v4__enoent"
+    32 Sym_8 external "v4__enoexec"
+    61 Sym_37 external "v4__enolck"
+    91 Sym_67 external "v4__enolink"
+   147 Sym_123 external "v4__enomedium"
+    36 Sym_12 external "v4__enomem"
+    66 Sym_42 external "v4__enomsg"
+    88 Sym_64 external "v4__enonet"
+    89 Sym_65 external "v4__enopkg"
+   116 Sym_92 external "v4__enoprotoopt"
+    52 Sym_28 external "v4__enospc"
+    87 Sym_63 external "v4__enosr"
+    84 Sym_60 external "v4__enostr"
+    62 Sym_38 external "v4__enosys"
+    39 Sym_15 external "v4__enotblk"
+   131 Sym_107 external "v4__enotconn"
+    44 Sym_20 external "v4__enotdir"
+    63 Sym_39 external "v4__enotempty"
+   142 Sym_118 external "v4__enotnam"
+   112 Sym_88 external "v4__enotsock"
+    49 Sym_25 external "v4__enotty"
+   100 Sym_76 external "v4__enotuniq"
+    30 Sym_6 external "v4__enxio"
+   119 Sym_95 external "v4__eopnotsupp"
+    99 Sym_75 external "v4__eoverflow"
+    25 Sym_1 external "v4__eperm"
+   120 Sym_96 external "v4__epfnosupport"
+    56 Sym_32 external "v4__epipe"
+    95 Sym_71 external "v4__eproto"
+   117 Sym_93 external "v4__eprotonosupport"
+   115 Sym_91 external "v4__eprototype"
+    58 Sym_34 external "v4__erange"
+   102 Sym_78 external "v4__eremchg"
+    90 Sym_66 external "v4__eremote"
+   145 Sym_121 external "v4__eremoteio"
+   109 Sym_85 external "v4__erestart"
+    54 Sym_30 external "v4__erofs"
+   132 Sym_108 external "v4__eshutdown"
+   118 Sym_94 external "v4__esocktnosupport"
+    53 Sym_29 external "v4__espipe"
+    27 Sym_3 external "v4__esrch"
+    93 Sym_69 external "v4__esrmnt"
+   140 Sym_116 external "v4__estale"
+   110 Sym_86 external "v4__estrpipe"
+    86 Sym_62 external "v4__etime"
+   134 Sym_110 external "v4__etimedout"
+   133 Sym_109 external "v4__etoomanyrefs"
+    50 Sym_26 external "v4__etxtbsy"
+   141 Sym_117 external "v4__euclean"
+    73 Sym_49 external "v4__eunatch"
+   111 Sym_87 external "v4__eusers"
+    65 Sym_41 external "v4__ewouldblock"
+    42 Sym_18 external "v4__exdev"
+    78 Sym_54 external "v4__exfull"
+   155 Sym_131 external "v4__type"
+   165 Sym_135 external "v4_arg"
+   151 Sym_126 external "v4_drop"
+   157 Sym_132 external "v4_errno"
+   153 Sym_128 word "v4_perror"
+   164 Sym_134 word "v4_pperror"
+    23 Sym_0 word "v4_strerror"
+   155 Sym_130 external "v4_type"
+   151 Sym_125 external "v4_z2_Greaterr"
+   151 Sym_127 external "v4_z2r_Greater"
+
+Intermediate code:
+    23 function Sym_0 {
+    25   call Sym_1
+    25   Reg_1 = Stack_D
+    25   Reg_0 = Stack_D
+    25   Stack_D = Reg_0
+    25   if Reg_0 != Reg_1 goto Label_3
+    25   Reg_0 = Data_0
+    25   Stack_D = Reg_0
+    25   Reg_0 = 23
+    25   Stack_D = Reg_0
+    25   Reg_0 = 0
+    25   Stack_D = Reg_0
+    25   goto Label_2
+    25 label Label_3
+    26   call Sym_2
+    26   Reg_1 = Stack_D
+    26   Reg_0 = Stack_D
+    26   Stack_D = Reg_0
+    26   if Reg_0 != Reg_1 goto Label_4
+    26   Reg_0 = Data_1
+    26   Stack_D = Reg_0
+    26   Reg_0 = 25
+    26   Stack_D = Reg_0
+    26   Reg_0 = 0
+    26   Stack_D = Reg_0
+    26   goto Label_2
+    26 label Label_4
+    27   call Sym_3
+    27   Reg_1 = Stack_D
+    27   Reg_0 = Stack_D
+    27   Stack_D = Reg_0
+    27   if Reg_0 != Reg_1 goto Label_5
+    27   Reg_0 = Data_2
+    27   Stack_D = Reg_0
+    27   Reg_0 = 15
+    27   Stack_D = Reg_0
+    27   Reg_0 = 0
+    27   Stack_D = Reg_0
+    27   goto Label_2
+    27 label Label_5
+    28   call Sym_4
+    28   Reg_1 = Stack_D
+    28   Reg_0 = Stack_D
+    28   Stack_D = Reg_0
+    28   if Reg_0 != Reg_1 goto Label_6
+    28   Reg_0 = Data_3
+    28   Stack_D = Reg_0
+    28   Reg_0 = 23
+    28   Stack_D = Reg_0
+    28   Reg_0 = 0
+    28   Stack_D = Reg_0
+    28   goto Label_2
+    28 label Label_6
+    29   call Sym_5
+    29   Reg_1 = Stack_D
+    29   Reg_0 = Stack_D
+    29   Stack_D = Reg_0
+    29   if Reg_0 != Reg_1 goto Label_7
+    29   Reg_0 = Data_4
+    29   Stack_D = Reg_0
+    29   Reg_0 = 9
+    29   Stack_D = Reg_0
+    29   Reg_0 = 0
+    29   Stack_D = Reg_0
+    29   goto Label_2
+    29 label Label_7
+    30   call Sym_6
+    30   Reg_1 = Stack_D
+    30   Reg_0 = Stack_D
+    30   Stack_D = Reg_0
+    30   if Reg_0 != Reg_1 goto Label_8
+    30   Reg_0 = Data_5
+    30   Stack_D = Reg_0
+    30   Reg_0 = 25
+    30   Stack_D = Reg_0
+    30   Reg_0 = 0
+    30   Stack_D = Reg_0
+    30   goto Label_2
+    30 label Label_8
+    31   call Sym_7
+    31   Reg_1 = Stack_D
+    31   Reg_0 = Stack_D
+    31   Stack_D = Reg_0
+    31   if Reg_0 != Reg_1 goto Label_9
+    31   Reg_0 = Data_6
+    31   Stack_D = Reg_0
+    31   Reg_0 = 17
+    31   Stack_D = Reg_0
+    31   Reg_0 = 0
+    31   Stack_D = Reg_0
+    31   goto Label_2
+    31 label Label_9
+    32   call Sym_8
+    32   Reg_1 = Stack_D
+    32   Reg_0 = Stack_D
+    32   Stack_D = Reg_0
+    32   if Reg_0 != Reg_1 goto Label_10
+    32   Reg_0 = Data_7
+    32   Stack_D = Reg_0
+    32   Reg_0 = 17
+    32   Stack_D = Reg_0
+    32   Reg_0 = 0
+    32   Stack_D = Reg_0
+    32   goto Label_2
+    32 label Label_10
+    33   call Sym_9
+    33   Reg_1 = Stack_D
+    33   Reg_0 = Stack_D
+    33   Stack_D = Reg_0
+    33   if Reg_0 != Reg_1 goto Label_11
+    33   Reg_0 = Data_8
+    33   Stack_D = Reg_0
+    33   Reg_0 = 15
+    33   Stack_D = Reg_0
+    33   Reg_0 = 0
+    33   Stack_D = Reg_0
+    33   goto Label_2
+    33 label Label_11
+    34   call Sym_10
+    34   Reg_1 = Stack_D
+    34   Reg_0 = Stack_D
+    34   Stack_D = Reg_0
+    34   if Reg_0 != Reg_1 goto Label_12
+    34   Reg_0 = Data_9
+    34   Stack_D = Reg_0
+    34   Reg_0 = 18
+    34   Stack_D = Reg_0
+    34   Reg_0 = 0
+    34   Stack_D = Reg_0
+    34   goto Label_2
+    34 label Label_12
+    35   call Sym_11
+    35   Reg_1 = Stack_D
+    35   Reg_0 = Stack_D
+    35   Stack_D = Reg_0
+    35   if Reg_0 != Reg_1 goto Label_13
+    35   Reg_0 = Data_10
+    35   Stack_D = Reg_0
+    35   Reg_0 = 9
+    35   Stack_D = Reg_0
+    35   Reg_0 = 0
+    35   Stack_D = Reg_0
+    35   goto Label_2
+    35 label Label_13
+    36   call Sym_12
+    36   Reg_1 = Stack_D
+    36   Reg_0 = Stack_D
+    36   Stack_D = Reg_0
+    36   if Reg_0 != Reg_1 goto Label_14
+    36   Reg_0 = Data_11
+    36   Stack_D = Reg_0
+    36   Reg_0 = 13
+    36   Stack_D = Reg_0
+    36   Reg_0 = 0
+    36   Stack_D = Reg_0
+    36   goto Label_2
+    36 label Label_14
+    37   call Sym_13
+    37   Reg_1 = Stack_D
+    37   Reg_0 = Stack_D
+    37   Stack_D = Reg_0
+    37   if Reg_0 != Reg_1 goto Label_15
+    37   Reg_0 = Data_12
+    37   Stack_D = Reg_0
+    37   Reg_0 = 17
+    37   Stack_D = Reg_0
+    37   Reg_0 = 0
+    37   Stack_D = Reg_0
+    37   goto Label_2
+    37 label Label_15
+    38   call Sym_14
+    38   Reg_1 = Stack_D
+    38   Reg_0 = Stack_D
+    38   Stack_D = Reg_0
+    38   if Reg_0 != Reg_1 goto Label_16
+    38   Reg_0 = Data_13
+    38   Stack_D = Reg_0
+    38   Reg_0 = 11
+    38   Stack_D = Reg_0
+    38   Reg_0 = 0
+    38   Stack_D = Reg_0
+    38   goto Label_2
+    38 label Label_16
+    39   call Sym_15
+    39   Reg_1 = Stack_D
+    39   Reg_0 = Stack_D
+    39   Stack_D = Reg_0
+    39   if Reg_0 != Reg_1 goto Label_17
+    39   Reg_0 = Data_14
+    39   Stack_D = Reg_0
+    39   Reg_0 = 21
+    39   Stack_D = Reg_0
+    39   Reg_0 = 0
+    39   Stack_D = Reg_0
+    39   goto Label_2
+    39 label Label_17
+    40   call Sym_16
+    40   Reg_1 = Stack_D
+    40   Reg_0 = Stack_D
+    40   Stack_D = Reg_0
+    40   if Reg_0 != Reg_1 goto Label_18
+    40   Reg_0 = Data_15
+    40   Stack_D = Reg_0
+    40   Reg_0 = 23
+    40   Stack_D = Reg_0
+    40   Reg_0 = 0
+    40   Stack_D = Reg_0
+    40   goto Label_2
+    40 label Label_18
+    41   call Sym_17
+    41   Reg_1 = Stack_D
+    41   Reg_0 = Stack_D
+    41   Stack_D = Reg_0
+    41   if Reg_0 != Reg_1 goto Label_19
+    41   Reg_0 = Data_16
+    41   Stack_D = Reg_0
+    41   Reg_0 = 11
+    41   Stack_D = Reg_0
+    41   Reg_0 = 0
+    41   Stack_D = Reg_0
+    41   goto Label_2
+    41 label Label_19
+    42   call Sym_18
+    42   Reg_1 = Stack_D
+    42   Reg_0 = Stack_D
+    42   Stack_D = Reg_0
+    42   if Reg_0 != Reg_1 goto Label_20
+    42   Reg_0 = Data_17
+    42   Stack_D = Reg_0
+    42   Reg_0 = 17
+    42   Stack_D = Reg_0
+    42   Reg_0 = 0
+    42   Stack_D = Reg_0
+    42   goto Label_2
+    42 label Label_20
+    43   call Sym_19
+    43   Reg_1 = Stack_D
+    43   Reg_0 = Stack_D
+    43   Stack_D = Reg_0
+    43   if Reg_0 != Reg_1 goto Label_21
+    43   Reg_0 = Data_18
+    43   Stack_D = Reg_0
+    43   Reg_0 = 14
+    43   Stack_D = Reg_0
+    43   Reg_0 = 0
+    43   Stack_D = Reg_0
+    43   goto Label_2
+    43 label Label_21
+    44   call Sym_20
+    44   Reg_1 = Stack_D
+    44   Reg_0 = Stack_D
+    44   Stack_D = Reg_0
+    44   if Reg_0 != Reg_1 goto Label_22
+    44   Reg_0 = Data_19
+    44   Stack_D = Reg_0
+    44   Reg_0 = 15
+    44   Stack_D = Reg_0
+    44   Reg_0 = 0
+    44   Stack_D = Reg_0
+    44   goto Label_2
+    44 label Label_22
+    45   call Sym_21
+    45   Reg_1 = Stack_D
+    45   Reg_0 = Stack_D
+    45   Stack_D = Reg_0
+    45   if Reg_0 != Reg_1 goto Label_23
+    45   Reg_0 = Data_20
+    45   Stack_D = Reg_0
+    45   Reg_0 = 14
+    45   Stack_D = Reg_0
+    45   Reg_0 = 0
+    45   Stack_D = Reg_0
+    45   goto Label_2
+    45 label Label_23
+    46   call Sym_22
+    46   Reg_1 = Stack_D
+    46   Reg_0 = Stack_D
+    46   Stack_D = Reg_0
+    46   if Reg_0 != Reg_1 goto Label_24
+    46   Reg_0 = Data_21
+    46   Stack_D = Reg_0
+    46   Reg_0 = 16
+    46   Stack_D = Reg_0
+    46   Reg_0 = 0
+    46   Stack_D = Reg_0
+    46   goto Label_2
+    46 label Label_24
+    47   call Sym_23
+    47   Reg_1 = Stack_D
+    47   Reg_0 = Stack_D
+    47   Stack_D = Reg_0
+    47   if Reg_0 != Reg_1 goto Label_25
+    47   Reg_0 = Data_22
+    47   Stack_D = Reg_0
+    47   Reg_0 = 19
+    47   Stack_D = Reg_0
+    47   Reg_0 = 0
+    47   Stack_D = Reg_0
+    47   goto Label_2
+    47 label Label_25
+    48   call Sym_24
+    48   Reg_1 = Stack_D
+    48   Reg_0 = Stack_D
+    48   Stack_D = Reg_0
+    48   if Reg_0 != Reg_1 goto Label_26
+    48   Reg_0 = Data_23
+    48   Stack_D = Reg_0
+    48   Reg_0 = 19
+    48   Stack_D = Reg_0
+    48   Reg_0 = 0
+    48   Stack_D = Reg_0
+    48   goto Label_2
+    48 label Label_26
+    49   call Sym_25
+    49   Reg_1 = Stack_D
+    49   Reg_0 = Stack_D
+    49   Stack_D = Reg_0
+    49   if Reg_0 != Reg_1 goto Label_27
+    49   Reg_0 = Data_24
+    49   Stack_D = Reg_0
+    49   Reg_0 = 16
+    49   Stack_D = Reg_0
+    49   Reg_0 = 0
+    49   Stack_D = Reg_0
+    49   goto Label_2
+    49 label Label_27
+    50   call Sym_26
+    50   Reg_1 = Stack_D
+    50   Reg_0 = Stack_D
+    50   Stack_D = Reg_0
+    50   if Reg_0 != Reg_1 goto Label_28
+    50   Reg_0 = Data_25
+    50   Stack_D = Reg_0
+    50   Reg_0 = 14
+    50   Stack_D = Reg_0
+    50   Reg_0 = 0
+    50   Stack_D = Reg_0
+    50   goto Label_2
+    50 label Label_28
+    51   call Sym_27
+    51   Reg_1 = Stack_D
+    51   Reg_0 = Stack_D
+    51   Stack_D = Reg_0
+    51   if Reg_0 != Reg_1 goto Label_29
+    51   Reg_0 = Data_26
+    51   Stack_D = Reg_0
+    51   Reg_0 = 14
+    51   Stack_D = Reg_0
+    51   Reg_0 = 0
+    51   Stack_D = Reg_0
+    51   goto Label_2
+    51 label Label_29
+    52   call Sym_28
+    52   Reg_1 = Stack_D
+    52   Reg_0 = Stack_D
+    52   Stack_D = Reg_0
+    52   if Reg_0 != Reg_1 goto Label_30
+    52   Reg_0 = Data_27
+    52   Stack_D = Reg_0
+    52   Reg_0 = 23
+    52   Stack_D = Reg_0
+    52   Reg_0 = 0
+    52   Stack_D = Reg_0
+    52   goto Label_2
+    52 label Label_30
+    53   call Sym_29
+    53   Reg_1 = Stack_D
+    53   Reg_0 = Stack_D
+    53   Stack_D = Reg_0
+    53   if Reg_0 != Reg_1 goto Label_31
+    53   Reg_0 = Data_28
+    53   Stack_D = Reg_0
+    53   Reg_0 = 12
+    53   Stack_D = Reg_0
+    53   Reg_0 = 0
+    53   Stack_D = Reg_0
+    53   goto Label_2
+    53 label Label_31
+    54   call Sym_30
+    54   Reg_1 = Stack_D
+    54   Reg_0 = Stack_D
+    54   Stack_D = Reg_0
+    54   if Reg_0 != Reg_1 goto Label_32
+    54   Reg_0 = Data_29
+    54   Stack_D = Reg_0
+    54   Reg_0 = 21
+    54   Stack_D = Reg_0
+    54   Reg_0 = 0
+    54   Stack_D = Reg_0
+    54   goto Label_2
+    54 label Label_32
+    55   call Sym_31
+    55   Reg_1 = Stack_D
+    55   Reg_0 = Stack_D
+    55   Stack_D = Reg_0
+    55   if Reg_0 != Reg_1 goto Label_33
+    55   Reg_0 = Data_30
+    55   Stack_D = Reg_0
+    55   Reg_0 = 14
+    55   Stack_D = Reg_0
+    55   Reg_0 = 0
+    55   Stack_D = Reg_0
+    55   goto Label_2
+    55 label Label_33
+    56   call Sym_32
+    56   Reg_1 = Stack_D
+    56   Reg_0 = Stack_D
+    56   Stack_D = Reg_0
+    56   if Reg_0 != Reg_1 goto Label_34
+    56   Reg_0 = Data_31
+    56   Stack_D = Reg_0
+    56   Reg_0 = 11
+    56   Stack_D = Reg_0
+    56   Reg_0 = 0
+    56   Stack_D = Reg_0
+    56   goto Label_2
+    56 label Label_34
+    57   call Sym_33
+    57   Reg_1 = Stack_D
+    57   Reg_0 = Stack_D
+    57   Stack_D = Reg_0
+    57   if Reg_0 != Reg_1 goto Label_35
+    57   Reg_0 = Data_32
+    57   Stack_D = Reg_0
+    57   Reg_0 = 35
+    57   Stack_D = Reg_0
+    57   Reg_0 = 0
+    57   Stack_D = Reg_0
+    57   goto Label_2
+    57 label Label_35
+    58   call Sym_34
+    58   Reg_1 = Stack_D
+    58   Reg_0 = Stack_D
+    58   Stack_D = Reg_0
+    58   if Reg_0 != Reg_1 goto Label_36
+    58   Reg_0 = Data_33
+    58   Stack_D = Reg_0
+    58   Reg_0 = 29
+    58   Stack_D = Reg_0
+    58   Reg_0 = 0
+    58   Stack_D = Reg_0
+    58   goto Label_2
+    58 label Label_36
+    59   call Sym_35
+    59   Reg_1 = Stack_D
+    59   Reg_0 = Stack_D
+    59   Stack_D = Reg_0
+    59   if Reg_0 != Reg_1 goto Label_37
+    59   Reg_0 = Data_34
+    59   Stack_D = Reg_0
+    59   Reg_0 = 29
+    59   Stack_D = Reg_0
+    59   Reg_0 = 0
+    59   Stack_D = Reg_0
+    59   goto Label_2
+    59 label Label_37
+    60   call Sym_36
+    60   Reg_1 = Stack_D
+    60   Reg_0 = Stack_D
+    60   Stack_D = Reg_0
+    60   if Reg_0 != Reg_1 goto Label_38
+    60   Reg_0 = Data_35
+    60   Stack_D = Reg_0
+    60   Reg_0 = 18
+    60   Stack_D = Reg_0
+    60   Reg_0 = 0
+    60   Stack_D = Reg_0
+    60   goto Label_2
+    60 label Label_38
+    61   call Sym_37
+    61   Reg_1 = Stack_D
+    61   Reg_0 = Stack_D
+    61   Stack_D = Reg_0
+    61   if Reg_0 != Reg_1 goto Label_39
+    61   Reg_0 = Data_36
+    61   Stack_D = Reg_0
+    61   Reg_0 = 25
+    61   Stack_D = Reg_0
+    61   Reg_0 = 0
+    61   Stack_D = Reg_0
+    61   goto Label_2
+    61 label Label_39
+    62   call Sym_38
+    62   Reg_1 = Stack_D
+    62   Reg_0 = Stack_D
+    62   Stack_D = Reg_0
+    62   if Reg_0 != Reg_1 goto Label_40
+    62   Reg_0 = Data_37
+    62   Stack_D = Reg_0
+    62   Reg_0 = 24
+    62   Stack_D = Reg_0
+    62   Reg_0 = 0
+    62   Stack_D = Reg_0
+    62   goto Label_2
+    62 label Label_40
+    63   call Sym_39
+    63   Reg_1 = Stack_D
+    63   Reg_0 = Stack_D
+    63   Stack_D = Reg_0
+    63   if Reg_0 != Reg_1 goto Label_41
+    63   Reg_0 = Data_38
+    63   Stack_D = Reg_0
+    63   Reg_0 = 19
+    63   Stack_D = Reg_0
+    63   Reg_0 = 0
+    63   Stack_D = Reg_0
+    63   goto Label_2
+    63 label Label_41
+    64   call Sym_40
+    64   Reg_1 = Stack_D
+    64   Reg_0 = Stack_D
+    64   Stack_D = Reg_0
+    64   if Reg_0 != Reg_1 goto Label_42
+    64   Reg_0 = Data_39
+    64   Stack_D = Reg_0
+    64   Reg_0 = 35
+    64   Stack_D = Reg_0
+    64   Reg_0 = 0
+    64   Stack_D = Reg_0
+    64   goto Label_2
+    64 label Label_42
+    65   call Sym_41
+    65   Reg_1 = Stack_D
+    65   Reg_0 = Stack_D
+    65   Stack_D = Reg_0
+    65   if Reg_0 != Reg_1 goto Label_43
+    65   Reg_0 = Data_40
+    65   Stack_D = Reg_0
+    65   Reg_0 = 21
+    65   Stack_D = Reg_0
+    65   Reg_0 = 0
+    65   Stack_D = Reg_0
+    65   goto Label_2
+    65 label Label_43
+    66   call Sym_42
+    66   Reg_1 = Stack_D
+    66   Reg_0 = Stack_D
+    66   Stack_D = Reg_0
+    66   if Reg_0 != Reg_1 goto Label_44
+    66   Reg_0 = Data_41
+    66   Stack_D = Reg_0
+    66   Reg_0 = 26
+    66   Stack_D = Reg_0
+    66   Reg_0 = 0
+    66   Stack_D = Reg_0
+    66   goto Label_2
+    66 label Label_44
+    67   call Sym_43
+    67   Reg_1 = Stack_D
+    67   Reg_0 = Stack_D
+    67   Stack_D = Reg_0
+    67   if Reg_0 != Reg_1 goto Label_45
+    67   Reg_0 = Data_42
+    67   Stack_D = Reg_0
+    67   Reg_0 = 18
+    67   Stack_D = Reg_0
+    67   Reg_0 = 0
+    67   Stack_D = Reg_0
+    67   goto Label_2
+    67 label Label_45
+    68   call Sym_44
+    68   Reg_1 = Stack_D
+    68   Reg_0 = Stack_D
+    68   Stack_D = Reg_0
+    68   if Reg_0 != Reg_1 goto Label_46
+    68   Reg_0 = Data_43
+    68   Stack_D = Reg_0
+    68   Reg_0 = 27
+    68   Stack_D = Reg_0
+    68   Reg_0 = 0
+    68   Stack_D = Reg_0
+    68   goto Label_2
+    68 label Label_46
+    69   call Sym_45
+    69   Reg_1 = Stack_D
+    69   Reg_0 = Stack_D
+    69   Stack_D = Reg_0
+    69   if Reg_0 != Reg_1 goto Label_47
+    69   Reg_0 = Data_44
+    69   Stack_D = Reg_0
+    69   Reg_0 = 24
+    69   Stack_D = Reg_0
+    69   Reg_0 = 0
+    69   Stack_D = Reg_0
+    69   goto Label_2
+    69 label Label_47
+    70   call Sym_46
+    70   Reg_1 = Stack_D
+    70   Reg_0 = Stack_D
+    70   Stack_D = Reg_0
+    70   if Reg_0 != Reg_1 goto Label_48
+    70   Reg_0 = Data_45
+    70   Stack_D = Reg_0
+    70   Reg_0 = 14
+    70   Stack_D = Reg_0
+    70   Reg_0 = 0
+    70   Stack_D = Reg_0
+    70   goto Label_2
+    70 label Label_48
+    71   call Sym_47
+    71   Reg_1 = Stack_D
+    71   Reg_0 = Stack_D
+    71   Stack_D = Reg_0
+    71   if Reg_0 != Reg_1 goto Label_49
+    71   Reg_0 = Data_46
+    71   Stack_D = Reg_0
+    71   Reg_0 = 13
+    71   Stack_D = Reg_0
+    71   Reg_0 = 0
+    71   Stack_D = Reg_0
+    71   goto Label_2
+    71 label Label_49
+    72   call Sym_48
+    72   Reg_1 = Stack_D
+    72   Reg_0 = Stack_D
+    72   Stack_D = Reg_0
+    72   if Reg_0 != Reg_1 goto Label_50
+    72   Reg_0 = Data_47
+    72   Stack_D = Reg_0
+    72   Reg_0 = 24
+    72   Stack_D = Reg_0
+    72   Reg_0 = 0
+    72   Stack_D = Reg_0
+    72   goto Label_2
+    72 label Label_50
+    73   call Sym_49
+    73   Reg_1 = Stack_D
+    73   Reg_0 = Stack_D
+    73   Stack_D = Reg_0
+    73   if Reg_0 != Reg_1 goto Label_51
+    73   Reg_0 = Data_48
+    73   Stack_D = Reg_0
+    73   Reg_0 = 28
+    73   Stack_D = Reg_0
+    73   Reg_0 = 0
+    73   Stack_D = Reg_0
+    73   goto Label_2
+    73 label Label_51
+    74   call Sym_50
+    74   Reg_1 = Stack_D
+    74   Reg_0 = Stack_D
+    74   Stack_D = Reg_0
+    74   if Reg_0 != Reg_1 goto Label_52
+    74   Reg_0 = Data_49
+    74   Stack_D = Reg_0
+    74   Reg_0 = 26
+    74   Stack_D = Reg_0
+    74   Reg_0 = 0
+    74   Stack_D = Reg_0
+    74   goto Label_2
+    74 label Label_52
+    75   call Sym_51
+    75   Reg_1 = Stack_D
+    75   Reg_0 = Stack_D
+    75   Stack_D = Reg_0
+    75   if Reg_0 != Reg_1 goto Label_53
+    75   Reg_0 = Data_50
+    75   Stack_D = Reg_0
+    75   Reg_0 = 14
+    75   Stack_D = Reg_0
+    75   Reg_0 = 0
+    75   Stack_D = Reg_0
+    75   goto Label_2
+    75 label Label_53
+    76   call Sym_52
+    76   Reg_1 = Stack_D
+    76   Reg_0 = Stack_D
+    76   Stack_D = Reg_0
+    76   if Reg_0 != Reg_1 goto Label_54
+    76   Reg_0 = Data_51
+    76   Stack_D = Reg_0
+    76   Reg_0 = 16
+    76   Stack_D = Reg_0
+    76   Reg_0 = 0
+    76   Stack_D = Reg_0
+    76   goto Label_2
+    76 label Label_54
+    77   call Sym_53
+    77   Reg_1 = Stack_D
+    77   Reg_0 = Stack_D
+    77   Stack_D = Reg_0
+    77   if Reg_0 != Reg_1 goto Label_55
+    77   Reg_0 = Data_52
+    77   Stack_D = Reg_0
+    77   Reg_0 = 26
+    77   Stack_D = Reg_0
+    77   Reg_0 = 0
+    77   Stack_D = Reg_0
+    77   goto Label_2
+    77 label Label_55
+    78   call Sym_54
+    78   Reg_1 = Stack_D
+    78   Reg_0 = Stack_D
+    78   Stack_D = Reg_0
+    78   if Reg_0 != Reg_1 goto Label_56
+    78   Reg_0 = Data_53
+    78   Stack_D = Reg_0
+    78   Reg_0 = 13
+    78   Stack_D = Reg_0
+    78   Reg_0 = 0
+    78   Stack_D = Reg_0
+    78   goto Label_2
+    78 label Label_56
+    79   call Sym_55
+    79   Reg_1 = Stack_D
+    79   Reg_0 = Stack_D
+    79   Stack_D = Reg_0
+    79   if Reg_0 != Reg_1 goto Label_57
+    79   Reg_0 = Data_54
+    79   Stack_D = Reg_0
+    79   Reg_0 = 8
+    79   Stack_D = Reg_0
+    79   Reg_0 = 0
+    79   Stack_D = Reg_0
+    79   goto Label_2
+    79 label Label_57
+    80   call Sym_56
+    80   Reg_1 = Stack_D
+    80   Reg_0 = Stack_D
+    80   Stack_D = Reg_0
+    80   if Reg_0 != Reg_1 goto Label_58
+    80   Reg_0 = Data_55
+    80   Stack_D = Reg_0
+    80   Reg_0 = 20
+    80   Stack_D = Reg_0
+    80   Reg_0 = 0
+    80   Stack_D = Reg_0
+    80   goto Label_2
+    80 label Label_58
+    81   call Sym_57
+    81   Reg_1 = Stack_D
+    81   Reg_0 = Stack_D
+    81   Stack_D = Reg_0
+    81   if Reg_0 != Reg_1 goto Label_59
+    81   Reg_0 = Data_56
+    81   Stack_D = Reg_0
+    81   Reg_0 = 12
+    81   Stack_D = Reg_0
+    81   Reg_0 = 0
+    81   Stack_D = Reg_0
+    81   goto Label_2
+    81 label Label_59
+    82   call Sym_58
+    82   Reg_1 = Stack_D
+    82   Reg_0 = Stack_D
+    82   Stack_D = Reg_0
+    82   if Reg_0 != Reg_1 goto Label_60
+    82   Reg_0 = Data_57
+    82   Stack_D = Reg_0
+    82   Reg_0 = 28
+    82   Stack_D = Reg_0
+    82   Reg_0 = 0
+    82   Stack_D = Reg_0
+    82   goto Label_2
+    82 label Label_60
+    83   call Sym_59
+    83   Reg_1 = Stack_D
+    83   Reg_0 = Stack_D
+    83   Stack_D = Reg_0
+    83   if Reg_0 != Reg_1 goto Label_61
+    83   Reg_0 = Data_58
+    83   Stack_D = Reg_0
+    83   Reg_0 = 20
+    83   Stack_D = Reg_0
+    83   Reg_0 = 0
+    83   Stack_D = Reg_0
+    83   goto Label_2
+    83 label Label_61
+    84   call Sym_60
+    84   Reg_1 = Stack_D
+    84   Reg_0 = Stack_D
+    84   Stack_D = Reg_0
+    84   if Reg_0 != Reg_1 goto Label_62
+    84   Reg_0 = Data_59
+    84   Stack_D = Reg_0
+    84   Reg_0 = 19
+    84   Stack_D = Reg_0
+    84   Reg_0 = 0
+    84   Stack_D = Reg_0
+    84   goto Label_2
+    84 label Label_62
+    85   call Sym_61
+    85   Reg_1 = Stack_D
+    85   Reg_0 = Stack_D
+    85   Stack_D = Reg_0
+    85   if Reg_0 != Reg_1 goto Label_63
+    85   Reg_0 = Data_60
+    85   Stack_D = Reg_0
+    85   Reg_0 = 17
+    85   Stack_D = Reg_0
+    85   Reg_0 = 0
+    85   Stack_D = Reg_0
+    85   goto Label_2
+    85 label Label_63
+    86   call Sym_62
+    86   Reg_1 = Stack_D
+    86   Reg_0 = Stack_D
+    86   Stack_D = Reg_0
+    86   if Reg_0 != Reg_1 goto Label_64
+    86   Reg_0 = Data_61
+    86   Stack_D = Reg_0
+    86   Reg_0 = 13
+    86   Stack_D = Reg_0
+    86   Reg_0 = 0
+    86   Stack_D = Reg_0
+    86   goto Label_2
+    86 label Label_64
+    87   call Sym_63
+    87   Reg_1 = Stack_D
+    87   Reg_0 = Stack_D
+    87   Stack_D = Reg_0
+    87   if Reg_0 != Reg_1 goto Label_65
+    87   Reg_0 = Data_62
+    87   Stack_D = Reg_0
+    87   Reg_0 = 24
+    87   Stack_D = Reg_0
+    87   Reg_0 = 0
+    87   Stack_D = Reg_0
+    87   goto Label_2
+    87 label Label_65
+    88   call Sym_64
+    88   Reg_1 = Stack_D
+    88   Reg_0 = Stack_D
+    88   Stack_D = Reg_0
+    88   if Reg_0 != Reg_1 goto Label_66
+    88   Reg_0 = Data_63
+    88   Stack_D = Reg_0
+    88   Reg_0 = 29
+    88   Stack_D = Reg_0
+    88   Reg_0 = 0
+    88   Stack_D = Reg_0
+    88   goto Label_2
+    88 label Label_66
+    89   call Sym_65
+    89   Reg_1 = Stack_D
+    89   Reg_0 = Stack_D
+    89   Stack_D = Reg_0
+    89   if Reg_0 != Reg_1 goto Label_67
+    89   Reg_0 = Data_64
+    89   Stack_D = Reg_0
+    89   Reg_0 = 21
+    89   Stack_D = Reg_0
+    89   Reg_0 = 0
+    89   Stack_D = Reg_0
+    89   goto Label_2
+    89 label Label_67
+    90   call Sym_66
+    90   Reg_1 = Stack_D
+    90   Reg_0 = Stack_D
+    90   Stack_D = Reg_0
+    90   if Reg_0 != Reg_1 goto Label_68
+    90   Reg_0 = Data_65
+    90   Stack_D = Reg_0
+    90   Reg_0 = 16
+    90   Stack_D = Reg_0
+    90   Reg_0 = 0
+    90   Stack_D = Reg_0
+    90   goto Label_2
+    90 label Label_68
+    91   call Sym_67
+    91   Reg_1 = Stack_D
+    91   Reg_0 = Stack_D
+    91   Stack_D = Reg_0
+    91   if Reg_0 != Reg_1 goto Label_69
+    91   Reg_0 = Data_66
+    91   Stack_D = Reg_0
+    91   Reg_0 = 21
+    91   Stack_D = Reg_0
+    91   Reg_0 = 0
+    91   Stack_D = Reg_0
+    91   goto Label_2
+    91 label Label_69
+    92   call Sym_68
+    92   Reg_1 = Stack_D
+    92   Reg_0 = Stack_D
+    92   Stack_D = Reg_0
+    92   if Reg_0 != Reg_1 goto Label_70
+    92   Reg_0 = Data_67
+    92   Stack_D = Reg_0
+    92   Reg_0 = 15
+    92   Stack_D = Reg_0
+    92   Reg_0 = 0
+    92   Stack_D = Reg_0
+    92   goto Label_2
+    92 label Label_70
+    93   call Sym_69
+    93   Reg_1 = Stack_D
+    93   Reg_0 = Stack_D
+    93   Stack_D = Reg_0
+    93   if Reg_0 != Reg_1 goto Label_71
+    93   Reg_0 = Data_68
+    93   Stack_D = Reg_0
+    93   Reg_0 = 13
+    93   Stack_D = Reg_0
+    93   Reg_0 = 0
+    93   Stack_D = Reg_0
+    93   goto Label_2
+    93 label Label_71
+    94   call Sym_70
+    94   Reg_1 = Stack_D
+    94   Reg_0 = Stack_D
+    94   Stack_D = Reg_0
+    94   if Reg_0 != Reg_1 goto Label_72
+    94   Reg_0 = Data_69
+    94   Stack_D = Reg_0
+    94   Reg_0 = 27
+    94   Stack_D = Reg_0
+    94   Reg_0 = 0
+    94   Stack_D = Reg_0
+    94   goto Label_2
+    94 label Label_72
+    95   call Sym_71
+    95   Reg_1 = Stack_D
+    95   Reg_0 = Stack_D
+    95   Stack_D = Reg_0
+    95   if Reg_0 != Reg_1 goto Label_73
+    95   Reg_0 = Data_70
+    95   Stack_D = Reg_0
+    95   Reg_0 = 14
+    95   Stack_D = Reg_0
+    95   Reg_0 = 0
+    95   Stack_D = Reg_0
+    95   goto Label_2
+    95 label Label_73
+    96   call Sym_72
+    96   Reg_1 = Stack_D
+    96   Reg_0 = Stack_D
+    96   Stack_D = Reg_0
+    96   if Reg_0 != Reg_1 goto Label_74
+    96   Reg_0 = Data_71
+    96   Stack_D = Reg_0
+    96   Reg_0 = 18
+    96   Stack_D = Reg_0
+    96   Reg_0 = 0
+    96   Stack_D = Reg_0
+    96   goto Label_2
+    96 label Label_74
+    97   call Sym_73
+    97   Reg_1 = Stack_D
+    97   Reg_0 = Stack_D
+    97   Stack_D = Reg_0
+    97   if Reg_0 != Reg_1 goto Label_75
+    97   Reg_0 = Data_72
+    97   Stack_D = Reg_0
+    97   Reg_0 = 18
+    97   Stack_D = Reg_0
+    97   Reg_0 = 0
+    97   Stack_D = Reg_0
+    97   goto Label_2
+    97 label Label_75
+    98   call Sym_74
+    98   Reg_1 = Stack_D
+    98   Reg_0 = Stack_D
+    98   Stack_D = Reg_0
+    98   if Reg_0 != Reg_1 goto Label_76
+    98   Reg_0 = Data_73
+    98   Stack_D = Reg_0
+    98   Reg_0 = 18
+    98   Stack_D = Reg_0
+    98   Reg_0 = 0
+    98   Stack_D = Reg_0
+    98   goto Label_2
+    98 label Label_76
+    99   call Sym_75
+    99   Reg_1 = Stack_D
+    99   Reg_0 = Stack_D
+    99   Stack_D = Reg_0
+    99   if Reg_0 != Reg_1 goto Label_77
+    99   Reg_0 = Data_74
+    99   Stack_D = Reg_0
+    99   Reg_0 = 37
+    99   Stack_D = Reg_0
+    99   Reg_0 = 0
+    99   Stack_D = Reg_0
+    99   goto Label_2
+    99 label Label_77
+   100   call Sym_76
+   100   Reg_1 = Stack_D
+   100   Reg_0 = Stack_D
+   100   Stack_D = Reg_0
+   100   if Reg_0 != Reg_1 goto Label_78
+   100   Reg_0 = Data_75
+   100   Stack_D = Reg_0
+   100   Reg_0 = 26
+   100   Stack_D = Reg_0
+   100   Reg_0 = 0
+   100   Stack_D = Reg_0
+   100   goto Label_2
+   100 label Label_78
+   101   call Sym_77
+   101   Reg_1 = Stack_D
+   101   Reg_0 = Stack_D
+   101   Stack_D = Reg_0
+   101   if Reg_0 != Reg_1 goto Label_79
+   101   Reg_0 = Data_76
+   101   Stack_D = Reg_0
+   101   Reg_0 = 28
+   101   Stack_D = Reg_0
+   101   Reg_0 = 0
+   101   Stack_D = Reg_0
+   101   goto Label_2
+   101 label Label_79
+   102   call Sym_78
+   102   Reg_1 = Stack_D
+   102   Reg_0 = Stack_D
+   102   Stack_D = Reg_0
+   102   if Reg_0 != Reg_1 goto Label_80
+   102   Reg_0 = Data_77
+   102   Stack_D = Reg_0
+   102   Reg_0 = 22
+   102   Stack_D = Reg_0
+   102   Reg_0 = 0
+   102   Stack_D = Reg_0
+   102   goto Label_2
+   102 label Label_80
+   103   call Sym_79
+   103   Reg_1 = Stack_D
+   103   Reg_0 = Stack_D
+   103   Stack_D = Reg_0
+   103   if Reg_0 != Reg_1 goto Label_81
+   103   Reg_0 = Data_78
+   103   Stack_D = Reg_0
+   103   Reg_0 = 38
+   103   Stack_D = Reg_0
+   103   Reg_0 = 0
+   103   Stack_D = Reg_0
+   103   goto Label_2
+   103 label Label_81
+   104   call Sym_80
+   104   Reg_1 = Stack_D
+   104   Reg_0 = Stack_D
+   104   Stack_D = Reg_0
+   104   if Reg_0 != Reg_1 goto Label_82
+   104   Reg_0 = Data_79
+   104   Stack_D = Reg_0
+   104   Reg_0 = 36
+   104   Stack_D = Reg_0
+   104   Reg_0 = 0
+   104   Stack_D = Reg_0
+   104   goto Label_2
+   104 label Label_82
+   105   call Sym_81
+   105   Reg_1 = Stack_D
+   105   Reg_0 = Stack_D
+   105   Stack_D = Reg_0
+   105   if Reg_0 != Reg_1 goto Label_83
+   105   Reg_0 = Data_80
+   105   Stack_D = Reg_0
+   105   Reg_0 = 31
+   105   Stack_D = Reg_0
+   105   Reg_0 = 0
+   105   Stack_D = Reg_0
+   105   goto Label_2
+   105 label Label_83
+   106   call Sym_82
+   106   Reg_1 = Stack_D
+   106   Reg_0 = Stack_D
+   106   Stack_D = Reg_0
+   106   if Reg_0 != Reg_1 goto Label_84
+   106   Reg_0 = Data_81
+   106   Stack_D = Reg_0
+   106   Reg_0 = 42
+   106   Stack_D = Reg_0
+   106   Reg_0 = 0
+   106   Stack_D = Reg_0
+   106   goto Label_2
+   106 label Label_84
+   107   call Sym_83
+   107   Reg_1 = Stack_D
+   107   Reg_0 = Stack_D
+   107   Stack_D = Reg_0
+   107   if Reg_0 != Reg_1 goto Label_85
+   107   Reg_0 = Data_82
+   107   Stack_D = Reg_0
+   107   Reg_0 = 37
+   107   Stack_D = Reg_0
+   107   Reg_0 = 0
+   107   Stack_D = Reg_0
+   107   goto Label_2
+   107 label Label_85
+   108   call Sym_84
+   108   Reg_1 = Stack_D
+   108   Reg_0 = Stack_D
+   108   Stack_D = Reg_0
+   108   if Reg_0 != Reg_1 goto Label_86
+   108   Reg_0 = Data_83
+   108   Stack_D = Reg_0
+   108   Reg_0 = 21
+   108   Stack_D = Reg_0
+   108   Reg_0 = 0
+   108   Stack_D = Reg_0
+   108   goto Label_2
+   108 label Label_86
+   109   call Sym_85
+   109   Reg_1 = Stack_D
+   109   Reg_0 = Stack_D
+   109   Stack_D = Reg_0
+   109   if Reg_0 != Reg_1 goto Label_87
+   109   Reg_0 = Data_84
+   109   Stack_D = Reg_0
+   109   Reg_0 = 40
+   109   Stack_D = Reg_0
+   109   Reg_0 = 0
+   109   Stack_D = Reg_0
+   109   goto Label_2
+   109 label Label_87
+   110   call Sym_86
+   110   Reg_1 = Stack_D
+   110   Reg_0 = Stack_D
+   110   Stack_D = Reg_0
+   110   if Reg_0 != Reg_1 goto Label_88
+   110   Reg_0 = Data_85
+   110   Stack_D = Reg_0
+   110   Reg_0 = 18
+   110   Stack_D = Reg_0
+   110   Reg_0 = 0
+   110   Stack_D = Reg_0
+   110   goto Label_2
+   110 label Label_88
+   111   call Sym_87
+   111   Reg_1 = Stack_D
+   111   Reg_0 = Stack_D
+   111   Stack_D = Reg_0
+   111   if Reg_0 != Reg_1 goto Label_89
+   111   Reg_0 = Data_86
+   111   Stack_D = Reg_0
+   111   Reg_0 = 14
+   111   Stack_D = Reg_0
+   111   Reg_0 = 0
+   111   Stack_D = Reg_0
+   111   goto Label_2
+   111 label Label_89
+   112   call Sym_88
+   112   Reg_1 = Stack_D
+   112   Reg_0 = Stack_D
+   112   Stack_D = Reg_0
+   112   if Reg_0 != Reg_1 goto Label_90
+   112   Reg_0 = Data_87
+   112   Stack_D = Reg_0
+   112   Reg_0 = 30
+   112   Stack_D = Reg_0
+   112   Reg_0 = 0
+   112   Stack_D = Reg_0
+   112   goto Label_2
+   112 label Label_90
+   113   call Sym_89
+   113   Reg_1 = Stack_D
+   113   Reg_0 = Stack_D
+   113   Stack_D = Reg_0
+   113   if Reg_0 != Reg_1 goto Label_91
+   113   Reg_0 = Data_88
+   113   Stack_D = Reg_0
+   113   Reg_0 = 28
+   113   Stack_D = Reg_0
+   113   Reg_0 = 0
+   113   Stack_D = Reg_0
+   113   goto Label_2
+   113 label Label_91
+   114   call Sym_90
+   114   Reg_1 = Stack_D
+   114   Reg_0 = Stack_D
+   114   Stack_D = Reg_0
+   114   if Reg_0 != Reg_1 goto Label_92
+   114   Reg_0 = Data_89
+   114   Stack_D = Reg_0
+   114   Reg_0 = 16
+   114   Stack_D = Reg_0
+   114   Reg_0 = 0
+   114   Stack_D = Reg_0
+   114   goto Label_2
+   114 label Label_92
+   115   call Sym_91
+   115   Reg_1 = Stack_D
+   115   Reg_0 = Stack_D
+   115   Stack_D = Reg_0
+   115   if Reg_0 != Reg_1 goto Label_93
+   115   Reg_0 = Data_90
+   115   Stack_D = Reg_0
+   115   Reg_0 = 30
+   115   Stack_D = Reg_0
+   115   Reg_0 = 0
+   115   Stack_D = Reg_0
+   115   goto Label_2
+   115 label Label_93
+   116   call Sym_92
+   116   Reg_1 = Stack_D
+   116   Reg_0 = Stack_D
+   116   Stack_D = Reg_0
+   116   if Reg_0 != Reg_1 goto Label_94
+   116   Reg_0 = Data_91
+   116   Stack_D = Reg_0
+   116   Reg_0 = 22
+   116   Stack_D = Reg_0
+   116   Reg_0 = 0
+   116   Stack_D = Reg_0
+   116   goto Label_2
+   116 label Label_94
+   117   call Sym_93
+   117   Reg_1 = Stack_D
+   117   Reg_0 = Stack_D
+   117   Stack_D = Reg_0
+   117   if Reg_0 != Reg_1 goto Label_95
+   117   Reg_0 = Data_92
+   117   Stack_D = Reg_0
+   117   Reg_0 = 22
+   117   Stack_D = Reg_0
+   117   Reg_0 = 0
+   117   Stack_D = Reg_0
+   117   goto Label_2
+   117 label Label_95
+   118   call Sym_94
+   118   Reg_1 = Stack_D
+   118   Reg_0 = Stack_D
+   118   Stack_D = Reg_0
+   118   if Reg_0 != Reg_1 goto Label_96
+   118   Reg_0 = Data_93
+   118   Stack_D = Reg_0
+   118   Reg_0 = 25
+   118   Stack_D = Reg_0
+   118   Reg_0 = 0
+   118   Stack_D = Reg_0
+   118   goto Label_2
+   118 label Label_96
+   119   call Sym_95
+   119   Reg_1 = Stack_D
+   119   Reg_0 = Stack_D
+   119   Stack_D = Reg_0
+   119   if Reg_0 != Reg_1 goto Label_97
+   119   Reg_0 = Data_94
+   119   Stack_D = Reg_0
+   119   Reg_0 = 42
+   119   Stack_D = Reg_0
+   119   Reg_0 = 0
+   119   Stack_D = Reg_0
+   119   goto Label_2
+   119 label Label_97
+   120   call Sym_96
+   120   Reg_1 = Stack_D
+   120   Reg_0 = Stack_D
+   120   Stack_D = Reg_0
+   120   if Reg_0 != Reg_1 goto Label_98
+   120   Reg_0 = Data_95
+   120   Stack_D = Reg_0
+   120   Reg_0 = 29
+   120   Stack_D = Reg_0
+   120   Reg_0 = 0
+   120   Stack_D = Reg_0
+   120   goto Label_2
+   120 label Label_98
+   121   call Sym_97
+   121   Reg_1 = Stack_D
+   121   Reg_0 = Stack_D
+   121   Stack_D = Reg_0
+   121   if Reg_0 != Reg_1 goto Label_99
+   121   Reg_0 = Data_96
+   121   Stack_D = Reg_0
+   121   Reg_0 = 40
+   121   Stack_D = Reg_0
+   121   Reg_0 = 0
+   121   Stack_D = Reg_0
+   121   goto Label_2
+   121 label Label_99
+   122   call Sym_98
+   122   Reg_1 = Stack_D
+   122   Reg_0 = Stack_D
+   122   Stack_D = Reg_0
+   122   if Reg_0 != Reg_1 goto Label_100
+   122   Reg_0 = Data_97
+   122   Stack_D = Reg_0
+   122   Reg_0 = 22
+   122   Stack_D = Reg_0
+   122   Reg_0 = 0
+   122   Stack_D = Reg_0
+   122   goto Label_2
+   122 label Label_100
+   123   call Sym_99
+   123   Reg_1 = Stack_D
+   123   Reg_0 = Stack_D
+   123   Stack_D = Reg_0
+   123   if Reg_0 != Reg_1 goto Label_101
+   123   Reg_0 = Data_98
+   123   Stack_D = Reg_0
+   123   Reg_0 = 31
+   123   Stack_D = Reg_0
+   123   Reg_0 = 0
+   123   Stack_D = Reg_0
+   123   goto Label_2
+   123 label Label_101
+   124   call Sym_100
+   124   Reg_1 = Stack_D
+   124   Reg_0 = Stack_D
+   124   Stack_D = Reg_0
+   124   if Reg_0 != Reg_1 goto Label_102
+   124   Reg_0 = Data_99
+   124   Stack_D = Reg_0
+   124   Reg_0 = 15
+   124   Stack_D = Reg_0
+   124   Reg_0 = 0
+   124   Stack_D = Reg_0
+   124   goto Label_2
+   124 label Label_102
+   125   call Sym_101
+   125   Reg_1 = Stack_D
+   125   Reg_0 = Stack_D
+   125   Stack_D = Reg_0
+   125   if Reg_0 != Reg_1 goto Label_103
+   125   Reg_0 = Data_100
+   125   Stack_D = Reg_0
+   125   Reg_0 = 22
+   125   Stack_D = Reg_0
+   125   Reg_0 = 0
+   125   Stack_D = Reg_0
+   125   goto Label_2
+   125 label Label_103
+   126   call Sym_102
+   126   Reg_1 = Stack_D
+   126   Reg_0 = Stack_D
+   126   Stack_D = Reg_0
+   126   if Reg_0 != Reg_1 goto Label_104
+   126   Reg_0 = Data_101
+   126   Stack_D = Reg_0
+   126   Reg_0 = 43
+   126   Stack_D = Reg_0
+   126   Reg_0 = 0
+   126   Stack_D = Reg_0
+   126   goto Label_2
+   126 label Label_104
+   127   call Sym_103
+   127   Reg_1 = Stack_D
+   127   Reg_0 = Stack_D
+   127   Stack_D = Reg_0
+   127   if Reg_0 != Reg_1 goto Label_105
+   127   Reg_0 = Data_102
+   127   Stack_D = Reg_0
+   127   Reg_0 = 32
+   127   Stack_D = Reg_0
+   127   Reg_0 = 0
+   127   Stack_D = Reg_0
+   127   goto Label_2
+   127 label Label_105
+   128   call Sym_104
+   128   Reg_1 = Stack_D
+   128   Reg_0 = Stack_D
+   128   Stack_D = Reg_0
+   128   if Reg_0 != Reg_1 goto Label_106
+   128   Reg_0 = Data_103
+   128   Stack_D = Reg_0
+   128   Reg_0 = 24
+   128   Stack_D = Reg_0
+   128   Reg_0 = 0
+   128   Stack_D = Reg_0
+   128   goto Label_2
+   128 label Label_106
+   129   call Sym_105
+   129   Reg_1 = Stack_D
+   129   Reg_0 = Stack_D
+   129   Stack_D = Reg_0
+   129   if Reg_0 != Reg_1 goto Label_107
+   129   Reg_0 = Data_104
+   129   Stack_D = Reg_0
+   129   Reg_0 = 25
+   129   Stack_D = Reg_0
+   129   Reg_0 = 0
+   129   Stack_D = Reg_0
+   129   goto Label_2
+   129 label Label_107
+   130   call Sym_106
+   130   Reg_1 = Stack_D
+   130   Reg_0 = Stack_D
+   130   Stack_D = Reg_0
+   130   if Reg_0 != Reg_1 goto Label_108
+   130   Reg_0 = Data_105
+   130   Stack_D = Reg_0
+   130   Reg_0 = 39
+   130   Stack_D = Reg_0
+   130   Reg_0 = 0
+   130   Stack_D = Reg_0
+   130   goto Label_2
+   130 label Label_108
+   131   call Sym_107
+   131   Reg_1 = Stack_D
+   131   Reg_0 = Stack_D
+   131   Stack_D = Reg_0
+   131   if Reg_0 != Reg_1 goto Label_109
+   131   Reg_0 = Data_106
+   131   Stack_D = Reg_0
+   131   Reg_0 = 35
+   131   Stack_D = Reg_0
+   131   Reg_0 = 0
+   131   Stack_D = Reg_0
+   131   goto Label_2
+   131 label Label_109
+   132   call Sym_108
+   132   Reg_1 = Stack_D
+   132   Reg_0 = Stack_D
+   132   Stack_D = Reg_0
+   132   if Reg_0 != Reg_1 goto Label_110
+   132   Reg_0 = Data_107
+   132   Stack_D = Reg_0
+   132   Reg_0 = 42
+   132   Stack_D = Reg_0
+   132   Reg_0 = 0
+   132   Stack_D = Reg_0
+   132   goto Label_2
+   132 label Label_110
+   133   call Sym_109
+   133   Reg_1 = Stack_D
+   133   Reg_0 = Stack_D
+   133   Stack_D = Reg_0
+   133   if Reg_0 != Reg_1 goto Label_111
+   133   Reg_0 = Data_108
+   133   Stack_D = Reg_0
+   133   Reg_0 = 34
+   133   Stack_D = Reg_0
+   133   Reg_0 = 0
+   133   Stack_D = Reg_0
+   133   goto Label_2
+   133 label Label_111
+   134   call Sym_110
+   134   Reg_1 = Stack_D
+   134   Reg_0 = Stack_D
+   134   Stack_D = Reg_0
+   134   if Reg_0 != Reg_1 goto Label_112
+   134   Reg_0 = Data_109
+   134   Stack_D = Reg_0
+   134   Reg_0 = 20
+   134   Stack_D = Reg_0
+   134   Reg_0 = 0
+   134   Stack_D = Reg_0
+   134   goto Label_2
+   134 label Label_112
+   135   call Sym_111
+   135   Reg_1 = Stack_D
+   135   Reg_0 = Stack_D
+   135   Stack_D = Reg_0
+   135   if Reg_0 != Reg_1 goto Label_113
+   135   Reg_0 = Data_110
+   135   Stack_D = Reg_0
+   135   Reg_0 = 18
+   135   Stack_D = Reg_0
+   135   Reg_0 = 0
+   135   Stack_D = Reg_0
+   135   goto Label_2
+   135 label Label_113
+   136   call Sym_112
+   136   Reg_1 = Stack_D
+   136   Reg_0 = Stack_D
+   136   Stack_D = Reg_0
+   136   if Reg_0 != Reg_1 goto Label_114
+   136   Reg_0 = Data_111
+   136   Stack_D = Reg_0
+   136   Reg_0 = 12
+   136   Stack_D = Reg_0
+   136   Reg_0 = 0
+   136   Stack_D = Reg_0
+   136   goto Label_2
+   136 label Label_114
+   137   call Sym_113
+   137   Reg_1 = Stack_D
+   137   Reg_0 = Stack_D
+   137   Stack_D = Reg_0
+   137   if Reg_0 != Reg_1 goto Label_115
+   137   Reg_0 = Data_112
+   137   Stack_D = Reg_0
+   137   Reg_0 = 16
+   137   Stack_D = Reg_0
+   137   Reg_0 = 0
+   137   Stack_D = Reg_0
+   137   goto Label_2
+   137 label Label_115
+   138   call Sym_114
+   138   Reg_1 = Stack_D
+   138   Reg_0 = Stack_D
+   138   Stack_D = Reg_0
+   138   if Reg_0 != Reg_1 goto Label_116
+   138   Reg_0 = Data_113
+   138   Stack_D = Reg_0
+   138   Reg_0 = 29
+   138   Stack_D = Reg_0
+   138   Reg_0 = 0
+   138   Stack_D = Reg_0
+   138   goto Label_2
+   138 label Label_116
+   139   call Sym_115
+   139   Reg_1 = Stack_D
+   139   Reg_0 = Stack_D
+   139   Stack_D = Reg_0
+   139   if Reg_0 != Reg_1 goto Label_117
+   139   Reg_0 = Data_114
+   139   Stack_D = Reg_0
+   139   Reg_0 = 25
+   139   Stack_D = Reg_0
+   139   Reg_0 = 0
+   139   Stack_D = Reg_0
+   139   goto Label_2
+   139 label Label_117
+   140   call Sym_116
+   140   Reg_1 = Stack_D
+   140   Reg_0 = Stack_D
+   140   Stack_D = Reg_0
+   140   if Reg_0 != Reg_1 goto Label_118
+   140   Reg_0 = Data_115
+   140   Stack_D = Reg_0
+   140   Reg_0 = 21
+   140   Stack_D = Reg_0
+   140   Reg_0 = 0
+   140   Stack_D = Reg_0
+   140   goto Label_2
+   140 label Label_118
+   141   call Sym_117
+   141   Reg_1 = Stack_D
+   141   Reg_0 = Stack_D
+   141   Stack_D = Reg_0
+   141   if Reg_0 != Reg_1 goto Label_119
+   141   Reg_0 = Data_116
+   141   Stack_D = Reg_0
+   141   Reg_0 = 24
+   141   Stack_D = Reg_0
+   141   Reg_0 = 0
+   141   Stack_D = Reg_0
+   141   goto Label_2
+   141 label Label_119
+   142   call Sym_118
+   142   Reg_1 = Stack_D
+   142   Reg_0 = Stack_D
+   142   Stack_D = Reg_0
+   142   if Reg_0 != Reg_1 goto Label_120
+   142   Reg_0 = Data_117
+   142   Stack_D = Reg_0
+   142   Reg_0 = 27
+   142   Stack_D = Reg_0
+   142   Reg_0 = 0
+   142   Stack_D = Reg_0
+   142   goto Label_2
+   142 label Label_120
+   143   call Sym_119
+   143   Reg_1 = Stack_D
+   143   Reg_0 = Stack_D
+   143   Stack_D = Reg_0
+   143   if Reg_0 != Reg_1 goto Label_121
+   143   Reg_0 = Data_118
+   143   Stack_D = Reg_0
+   143   Reg_0 = 29
+   143   Stack_D = Reg_0
+   143   Reg_0 = 0
+   143   Stack_D = Reg_0
+   143   goto Label_2
+   143 label Label_121
+   144   call Sym_120
+   144   Reg_1 = Stack_D
+   144   Reg_0 = Stack_D
+   144   Stack_D = Reg_0
+   144   if Reg_0 != Reg_1 goto Label_122
+   144   Reg_0 = Data_119
+   144   Stack_D = Reg_0
+   144   Reg_0 = 20
+   144   Stack_D = Reg_0
+   144   Reg_0 = 0
+   144   Stack_D = Reg_0
+   144   goto Label_2
+   144 label Label_122
+   145   call Sym_121
+   145   Reg_1 = Stack_D
+   145   Reg_0 = Stack_D
+   145   Stack_D = Reg_0
+   145   if Reg_0 != Reg_1 goto Label_123
+   145   Reg_0 = Data_120
+   145   Stack_D = Reg_0
+   145   Reg_0 = 16
+   145   Stack_D = Reg_0
+   145   Reg_0 = 0
+   145   Stack_D = Reg_0
+   145   goto Label_2
+   145 label Label_123
+   146   call Sym_122
+   146   Reg_1 = Stack_D
+   146   Reg_0 = Stack_D
+   146   Stack_D = Reg_0
+   146   if Reg_0 != Reg_1 goto Label_124
+   146   Reg_0 = Data_121
+   146   Stack_D = Reg_0
+   146   Reg_0 = 14
+   146   Stack_D = Reg_0
+   146   Reg_0 = 0
+   146   Stack_D = Reg_0
+   146   goto Label_2
+   146 label Label_124
+   147   call Sym_123
+   147   Reg_1 = Stack_D
+   147   Reg_0 = Stack_D
+   147   Stack_D = Reg_0
+   147   if Reg_0 != Reg_1 goto Label_125
+   147   Reg_0 = Data_122
+   147   Stack_D = Reg_0
+   147   Reg_0 = 15
+   147   Stack_D = Reg_0
+   147   Reg_0 = 0
+   147   Stack_D = Reg_0
+   147   goto Label_2
+   147 label Label_125
+   148   call Sym_124
+   148   Reg_1 = Stack_D
+   148   Reg_0 = Stack_D
+   148   Stack_D = Reg_0
+   148   if Reg_0 != Reg_1 goto Label_126
+   148   Reg_0 = Data_123
+   148   Stack_D = Reg_0
+   148   Reg_0 = 17
+   148   Stack_D = Reg_0
+   148   Reg_0 = 0
+   148   Stack_D = Reg_0
+   148   goto Label_2
+   148 label Label_126
+   149   Reg_0 = 0
+   149   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   149   no-op
+           optimizes   Reg_1 = Stack_D
+   149   Reg_0 = Stack_D
+   149   Stack_D = Reg_0
+   149   if Reg_0 != Reg_1 goto Label_127
+   149   Reg_0 = Data_124
+   149   Stack_D = Reg_0
+   149   Reg_0 = 7
+   149   Stack_D = Reg_0
+   149   Reg_0 = 0
+   149   Stack_D = Reg_0
+   149   goto Label_2
+   149 label Label_127
+   150   Reg_0 = Data_125
+   150   Stack_D = Reg_0
+   150   Reg_0 = 0
+   150   Stack_D = Reg_0
+   150   Reg_0 = 0
+   150   Stack_D = Reg_0
+   150 label Label_2
+   150   Reg_0 = Stack_D
+   151   call Sym_125
+   151   call Sym_126
+   151   tail call Sym_127
+           optimizes   call Sym_127
+   151   no-op
+           optimizes label Label_1
+   151 }
+
+   153 function Sym_128 {
+   154   call Sym_129
+   154   Reg_0 = Stack_D
+   154   if Reg_0 == 0 goto Label_129
+   155   call Sym_130
+   155   Reg_0 = Data_126
+   155   Stack_D = Reg_0
+   155   Reg_0 = 2
+   155   Stack_D = Reg_0
+   155   call Sym_131
+   156   goto Label_130
+   156 label Label_129
+   156   call Sym_126
+   156 label Label_130
+   157   call Sym_132
+   157   call Sym_0
+   157   call Sym_129
+   157   Reg_0 = Stack_D
+   157   if Reg_0 == 0 goto Label_131
+   158   tail call Sym_130
+           optimizes   call Sym_130
+   159   no-op
+           optimizes   goto Label_132
+   159 label Label_131
+   160   call Sym_126
+   161   Reg_0 = Data_127
+   161   Stack_D = Reg_0
+   161   Reg_0 = 18
+   161   Stack_D = Reg_0
+   161   call Sym_131
+   161   call Sym_132
+   161   Reg_0 = 0
+   161   Stack_D = Reg_0
+   161   tail call Sym_133
+           optimizes   call Sym_133
+   162   no-op
+           optimizes label Label_132
+   162   no-op
+           optimizes label Label_128
+   162 }
+
+   164 function Sym_134 {
+   165   Reg_0 = 0
+   165   Stack_D = Reg_0
+   165   call Sym_135
+   165   call Sym_130
+   165   Reg_0 = Data_128
+   165   Stack_D = Reg_0
+   165   Reg_0 = 2
+   165   Stack_D = Reg_0
+   165   call Sym_131
+   165   tail call Sym_128
+           optimizes   call Sym_128
+   165   no-op
+           optimizes label Label_133
+   165 }
+
+Peephole rewrites:
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_strerror: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+
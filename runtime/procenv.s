@@ -0,0 +1,280 @@
+	.file	"procenv.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"procenv.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4___Parenenvstr_Equals_Closeparen:F1",36,0,0,v4___Parenenvstr_Equals_Closeparen
+	.weak v4___Parenenvstr_Equals_Closeparen
+	.type	v4___Parenenvstr_Equals_Closeparen,@function
+v4___Parenenvstr_Equals_Closeparen:
+.stabn 68,0,24,.LMa0-v4___Parenenvstr_Equals_Closeparen
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,24,.LMb0-v4___Parenenvstr_Equals_Closeparen
+.LMb0:
+.LBB0:
+.stabn 68,0,25,.LM1-v4___Parenenvstr_Equals_Closeparen
+.LM1:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+	mov $61,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	not %eax
+	test %eax,%eax
+	je .L2
+.stabn 68,0,26,.LM21-v4___Parenenvstr_Equals_Closeparen
+.LM21:
+	call v4_z2drop@PLT
+	call v4_drop@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	jmp .L1
+.L2:
+.stabn 68,0,28,.LM28-v4___Parenenvstr_Equals_Closeparen
+.LM28:
+	call v4_swap@PLT
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %eax,%edx
+	je .L3
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+.L4:
+.stabn 68,0,29,.LM37-v4___Parenenvstr_Equals_Closeparen
+.LM37:
+	call v4_over@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+.stabn 68,0,30,.LM45-v4___Parenenvstr_Equals_Closeparen
+.LM45:
+	call v4_dup@PLT
+	mov $61,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	jne .L6
+.stabn 68,0,31,.LM54-v4___Parenenvstr_Equals_Closeparen
+.LM54:
+	call v4_z2drop@PLT
+	call v4_drop@PLT
+	call v4_unloop@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	jmp .L1
+.L6:
+.stabn 68,0,33,.LM62-v4___Parenenvstr_Equals_Closeparen
+.LM62:
+	call v4_over@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	not %eax
+	test %eax,%eax
+	je .L7
+.stabn 68,0,34,.LM81-v4___Parenenvstr_Equals_Closeparen
+.LM81:
+	call v4_z2drop@PLT
+	call v4_unloop@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	jmp .L1
+.L7:
+.stabn 68,0,36,.LM88-v4___Parenenvstr_Equals_Closeparen
+.LM88:
+	call v4__rpop@PLT
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L4
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.L3:
+.stabn 68,0,37,.LM99-v4___Parenenvstr_Equals_Closeparen
+.LM99:
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+.L1:
+.LBE0:
+.stabn 68,0,37,.LM104-v4___Parenenvstr_Equals_Closeparen
+.LM104:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4___Parenenvstr_Equals_Closeparen,.Lfe0-v4___Parenenvstr_Equals_Closeparen
+.stabn	192,0,0,.LBB0-v4___Parenenvstr_Equals_Closeparen
+.stabn	224,0,0,.LBE0-v4___Parenenvstr_Equals_Closeparen
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4___Parenenvstr_Equals_Closeparen
+.text
+	.align 4
+.stabs "v4_getenv:F1",36,0,0,v4_getenv
+	.weak v4_getenv
+	.type	v4_getenv,@function
+v4_getenv:
+.stabn 68,0,39,.LMa105-v4_getenv
+.LMa105:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic15
+.Lpic15:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic15],%ebx
+0:
+.stabn 68,0,39,.LMb105-v4_getenv
+.LMb105:
+.LBB15:
+.stabn 68,0,40,.LM106-v4_getenv
+.LM106:
+	call v4_envp@PLT
+.L9:
+.stabn 68,0,42,.LM108-v4_getenv
+.LM108:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+.stabn 68,0,43,.LM110-v4_getenv
+.LM110:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L11
+.stabn 68,0,44,.LM116-v4_getenv
+.LM116:
+	call v4_z2drop@PLT
+	call v4_z2drop@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	jmp .L8
+.L11:
+.stabn 68,0,46,.LM123-v4_getenv
+.LM123:
+	call v4_swap@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,47,.LM125-v4_getenv
+.LM125:
+	call v4_Greaterr@PLT
+	call v4_z2dup@PLT
+	call v4_r_Greater@PLT
+	call v4___Parenenvstr_Equals_Closeparen@PLT
+.stabn 68,0,48,.LM129-v4_getenv
+.LM129:
+	call v4_r_Greater@PLT
+	call v4_swap@PLT
+.stabn 68,0,49,.LM131-v4_getenv
+.LM131:
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L12
+.stabn 68,0,50,.LM133-v4_getenv
+.LM133:
+	call v4_rot@PLT
+	call v4_rot@PLT
+	call v4_z2drop@PLT
+	call v4_Fetch@PLT
+.L13:
+.stabn 68,0,52,.LM138-v4_getenv
+.LM138:
+	call v4_dup@PLT
+	call v4_c_Fetch@PLT
+	mov $61,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	not %eax
+	test %eax,%eax
+	je .L14
+.stabn 68,0,53,.LM153-v4_getenv
+.LM153:
+	call v4_char_Plus@PLT
+.stabn 68,0,54,.LM154-v4_getenv
+.LM154:
+	jmp .L13
+.L14:
+.stabn 68,0,55,.LM156-v4_getenv
+.LM156:
+	call v4_char_Plus@PLT
+	call v4_strlen@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L8
+.L12:
+	call v4__dpop@PLT
+	add $4,%eax
+	call v4__dpush@PLT
+.stabn 68,0,58,.LM167-v4_getenv
+.LM167:
+	jmp .L9
+.L8:
+.LBE15:
+.stabn 68,0,58,.LM170-v4_getenv
+.LM170:
+	pop %ebx
+	leave
+	ret
+.Lfe15:
+	.size	 v4_getenv,.Lfe15-v4_getenv
+.stabn	192,0,0,.LBB15-v4_getenv
+.stabn	224,0,0,.LBE15-v4_getenv
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4_getenv
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,94 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: stack.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+    65 Sym_3 external "v4_Store"
+    67 Sym_4 word "v4__clrstackeh"
+   194 Sym_8 codeword "v4__pop"
+   147 Sym_7 codeword "v4__push"
+    64 Sym_1 word "v4__setstackeh"
+    62 Sym_0 variable Cell "v4__stackeh"
+   100 Sym_6 codeword "v4__starteh"
+    68 Sym_5 external "v4_false"
+    65 Sym_2 external "v4_true"
+
+Intermediate code:
+    64 function Sym_1 {
+    65   no-op
+           optimizes   call Sym_2
+    65   Reg_0 = -1
+    65   no-op
+           optimizes   Stack_D = Reg_0
+    65   no-op
+           optimizes   Reg_0 = Sym_0
+    65   no-op
+           optimizes   Stack_D = Reg_0
+    65   no-op
+           optimizes   call Sym_3
+    65   no-op
+           optimizes   Reg_0 = Stack_D
+    65   *(Sym_0) = Reg_0
+    65   no-op
+           optimizes label Label_1
+    65 }
+
+    67 function Sym_4 {
+    68   no-op
+           optimizes   call Sym_5
+    68   Reg_0 = 0
+    68   no-op
+           optimizes   Stack_D = Reg_0
+    68   no-op
+           optimizes   Reg_0 = Sym_0
+    68   no-op
+           optimizes   Stack_D = Reg_0
+    68   no-op
+           optimizes   call Sym_3
+    68   no-op
+           optimizes   Reg_0 = Stack_D
+    68   *(Sym_0) = Reg_0
+    68   no-op
+           optimizes label Label_2
+    68 }
+
+   100 function Sym_6 {
+   101   asm (    mov v4__stackeh@GOT(%ebx),%esi)
+   102   asm (    mov (%esi),%edi)
+   103   asm (    test %edi,%edi)
+   104   asm (    jnz 1f)
+   106   asm (    movl $-1,(%esi))
+   107   asm (    mov %edx,%eax)
+   108   asm (    call v4__dpush@PLT)
+   109   asm (    call v4_throw@PLT)
+   111   asm (1:)
+   113   asm (    forth_pic.=0b-0b)
+   114 }
+
+   147 function Sym_7 {
+   148   asm (    cmp %ecx,(%esi))
+   149   asm (    jb 1f)
+   150   asm (    call v4__starteh@PLT)
+   151   asm (1:)
+   153   asm (    push %esi)
+   154   asm (    mov (%esi),%esi)
+   155   asm (    mov %eax,(%edi,%esi,4))
+   156   asm (    pop %esi)
+   157   asm (    incl (%esi))
+   159   asm (    forth_pic.=0b-0b)
+   160 }
+
+   194 function Sym_8 {
+   195   asm (    cmp $0,(%esi))
+   196   asm (    ja 1f)
+   198   asm (    mov %edx,%eax)
+   199   asm (    call v4__dpush@PLT)
+   200   asm (    call v4_throw@PLT)
+   202   asm (1:)
+   204   asm (    decl (%esi))
+   205   asm (    mov (%esi),%esi)
+   206   asm (    mov (%edi,%esi,4),%eax)
+   208   asm (    forth_pic.=0b-0b)
+   209 }
+
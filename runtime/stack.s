@@ -0,0 +1,222 @@
+	.file	"stack.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"stack.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.stabs	"v4__stackeh:G2",40,0,0,v4__stackeh
+	.comm  v4__stackeh,4,4
+.text
+	.align 4
+.stabs "v4__setstackeh:F1",36,0,0,v4__setstackeh
+	.weak v4__setstackeh
+	.type	v4__setstackeh,@function
+v4__setstackeh:
+.stabn 68,0,64,.LMa0-v4__setstackeh
+.LMa0:
+	push %ebx
+	call .Lpic1
+.Lpic1:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic1],%ebx
+0:
+.stabn 68,0,64,.LMb0-v4__setstackeh
+.LMb0:
+.LBB1:
+	xor %eax,%eax
+	dec %eax
+	mov v4__stackeh@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.LBE1:
+.stabn 68,0,65,.LM10-v4__setstackeh
+.LM10:
+	pop %ebx
+	ret
+.Lfe1:
+	.size	 v4__setstackeh,.Lfe1-v4__setstackeh
+.stabn	192,0,0,.LBB1-v4__setstackeh
+.stabn	224,0,0,.LBE1-v4__setstackeh
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4__setstackeh
+.text
+	.align 4
+.stabs "v4__clrstackeh:F1",36,0,0,v4__clrstackeh
+	.weak v4__clrstackeh
+	.type	v4__clrstackeh,@function
+v4__clrstackeh:
+.stabn 68,0,67,.LMa11-v4__clrstackeh
+.LMa11:
+	push %ebx
+	call .Lpic4
+.Lpic4:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic4],%ebx
+0:
+.stabn 68,0,67,.LMb11-v4__clrstackeh
+.LMb11:
+.LBB4:
+	xor %eax,%eax
+	mov v4__stackeh@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.LBE4:
+.stabn 68,0,68,.LM21-v4__clrstackeh
+.LM21:
+	pop %ebx
+	ret
+.Lfe4:
+	.size	 v4__clrstackeh,.Lfe4-v4__clrstackeh
+.stabn	192,0,0,.LBB4-v4__clrstackeh
+.stabn	224,0,0,.LBE4-v4__clrstackeh
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4__clrstackeh
+.text
+	.align 4
+.stabs "v4__starteh:F1",36,0,0,v4__starteh
+	.weak v4__starteh
+	.type	v4__starteh,@function
+v4__starteh:
+.stabn 68,0,100,.LMa22-v4__starteh
+.LMa22:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic6
+.Lpic6:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic6],%ebx
+0:
+.stabn 68,0,100,.LMb22-v4__starteh
+.LMb22:
+.LBB6:
+#APP
+    mov v4__stackeh@GOT(%ebx),%esi
+    mov (%esi),%edi
+    test %edi,%edi
+    jnz 1f
+    movl $-1,(%esi)
+    mov %edx,%eax
+    call v4__dpush@PLT
+    call v4_throw@PLT
+1:
+    forth_pic.=0b-0b
+#NO_APP
+.LBE6:
+.stabn 68,0,114,.LM33-v4__starteh
+.LM33:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe6:
+	.size	 v4__starteh,.Lfe6-v4__starteh
+.stabn	192,0,0,.LBB6-v4__starteh
+.stabn	224,0,0,.LBE6-v4__starteh
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4__starteh
+.text
+	.align 4
+.stabs "v4__push:F1",36,0,0,v4__push
+	.weak v4__push
+	.type	v4__push,@function
+v4__push:
+.stabn 68,0,147,.LMa34-v4__push
+.LMa34:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic7
+.Lpic7:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic7],%ebx
+0:
+.stabn 68,0,147,.LMb34-v4__push
+.LMb34:
+.LBB7:
+#APP
+    cmp %ecx,(%esi)
+    jb 1f
+    call v4__starteh@PLT
+1:
+    push %esi
+    mov (%esi),%esi
+    mov %eax,(%edi,%esi,4)
+    pop %esi
+    incl (%esi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE7:
+.stabn 68,0,160,.LM45-v4__push
+.LM45:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe7:
+	.size	 v4__push,.Lfe7-v4__push
+.stabn	192,0,0,.LBB7-v4__push
+.stabn	224,0,0,.LBE7-v4__push
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4__push
+.text
+	.align 4
+.stabs "v4__pop:F1",36,0,0,v4__pop
+	.weak v4__pop
+	.type	v4__pop,@function
+v4__pop:
+.stabn 68,0,194,.LMa46-v4__pop
+.LMa46:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic8
+.Lpic8:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic8],%ebx
+0:
+.stabn 68,0,194,.LMb46-v4__pop
+.LMb46:
+.LBB8:
+#APP
+    cmp $0,(%esi)
+    ja 1f
+    mov %edx,%eax
+    call v4__dpush@PLT
+    call v4_throw@PLT
+1:
+    decl (%esi)
+    mov (%esi),%esi
+    mov (%edi,%esi,4),%eax
+    forth_pic.=0b-0b
+#NO_APP
+.LBE8:
+.stabn 68,0,209,.LM57-v4__pop
+.LM57:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe8:
+	.size	 v4__pop,.Lfe8-v4__pop
+.stabn	192,0,0,.LBB8-v4__pop
+.stabn	224,0,0,.LBE8-v4__pop
+.Lscope8:
+.stabs	"",36,0,0,.Lscope8-v4__pop
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
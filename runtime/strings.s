@@ -0,0 +1,1007 @@
+	.file	"strings.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"strings.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_Minustrailing:F1",36,0,0,v4_Minustrailing
+	.weak v4_Minustrailing
+	.type	v4_Minustrailing,@function
+v4_Minustrailing:
+.stabn 68,0,23,.LMa0-v4_Minustrailing
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,23,.LMb0-v4_Minustrailing
+.LMb0:
+.LBB0:
+.L2:
+.stabn 68,0,25,.LM2-v4_Minustrailing
+.LM2:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	dec %eax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+.stabn 68,0,26,.LM13-v4_Minustrailing
+.LM13:
+	call v4_bl@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %edx,%eax
+	jne .L3
+	call v4__dpop@PLT
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L2
+.L3:
+.LBE0:
+.stabn 68,0,27,.LM27-v4_Minustrailing
+.LM27:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_Minustrailing,.Lfe0-v4_Minustrailing
+.stabn	192,0,0,.LBB0-v4_Minustrailing
+.stabn	224,0,0,.LBE0-v4_Minustrailing
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_Minustrailing
+.text
+	.align 4
+.stabs "v4_Slashstring:F1",36,0,0,v4_Slashstring
+	.weak v4_Slashstring
+	.type	v4_Slashstring,@function
+v4_Slashstring:
+.stabn 68,0,29,.LMa28-v4_Slashstring
+.LMa28:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic7
+.Lpic7:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic7],%ebx
+0:
+.stabn 68,0,29,.LMb28-v4_Slashstring
+.LMb28:
+.LBB7:
+.stabn 68,0,30,.LM29-v4_Slashstring
+.LM29:
+	call v4_swap@PLT
+	call v4_Greaterr@PLT
+	call v4_dup@PLT
+	call v4_Greaterr@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_z2r_Greater@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.LBE7:
+.stabn 68,0,30,.LM45-v4_Slashstring
+.LM45:
+	pop %ebx
+	leave
+	ret
+.Lfe7:
+	.size	 v4_Slashstring,.Lfe7-v4_Slashstring
+.stabn	192,0,0,.LBB7-v4_Slashstring
+.stabn	224,0,0,.LBE7-v4_Slashstring
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_Slashstring
+.text
+	.align 4
+.stabs "v4_blank:F1",36,0,0,v4_blank
+	.weak v4_blank
+	.type	v4_blank,@function
+v4_blank:
+.stabn 68,0,32,.LMa46-v4_blank
+.LMa46:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic13
+.Lpic13:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic13],%ebx
+0:
+.stabn 68,0,32,.LMb46-v4_blank
+.LMb46:
+.LBB13:
+.stabn 68,0,33,.LM47-v4_blank
+.LM47:
+	call v4_bl@PLT
+	mov v4_fill@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE13:
+.stabn 68,0,33,.LM50-v4_blank
+.LM50:
+	pop %ebx
+	leave
+	ret
+.Lfe13:
+	.size	 v4_blank,.Lfe13-v4_blank
+.stabn	192,0,0,.LBB13-v4_blank
+.stabn	224,0,0,.LBE13-v4_blank
+.Lscope13:
+.stabs	"",36,0,0,.Lscope13-v4_blank
+.text
+	.align 4
+.stabs "v4_cmove:F1",36,0,0,v4_cmove
+	.weak v4_cmove
+	.type	v4_cmove,@function
+v4_cmove:
+.stabn 68,0,35,.LMa51-v4_cmove
+.LMa51:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic15
+.Lpic15:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic15],%ebx
+0:
+.stabn 68,0,35,.LMb51-v4_cmove
+.LMb51:
+.LBB15:
+.stabn 68,0,36,.LM52-v4_cmove
+.LM52:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jle .L7
+.stabn 68,0,37,.LM58-v4_cmove
+.LM58:
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+.L9:
+.stabn 68,0,38,.LM65-v4_cmove
+.LM65:
+	call v4_over@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+.stabn 68,0,39,.LM73-v4_cmove
+.LM73:
+	call v4_over@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Store@PLT
+.stabn 68,0,40,.LM81-v4_cmove
+.LM81:
+	call v4__rpop@PLT
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L9
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.stabn 68,0,41,.LM92-v4_cmove
+.LM92:
+	jmp .L11
+.L7:
+	call v4_drop@PLT
+.L11:
+	mov v4_z2drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE15:
+.stabn 68,0,41,.LM99-v4_cmove
+.LM99:
+	pop %ebx
+	leave
+	ret
+.Lfe15:
+	.size	 v4_cmove,.Lfe15-v4_cmove
+.stabn	192,0,0,.LBB15-v4_cmove
+.stabn	224,0,0,.LBE15-v4_cmove
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4_cmove
+.text
+	.align 4
+.stabs "v4_cmove_Greater:F1",36,0,0,v4_cmove_Greater
+	.weak v4_cmove_Greater
+	.type	v4_cmove_Greater,@function
+v4_cmove_Greater:
+.stabn 68,0,43,.LMa100-v4_cmove_Greater
+.LMa100:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic22
+.Lpic22:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic22],%ebx
+0:
+.stabn 68,0,43,.LMb100-v4_cmove_Greater
+.LMb100:
+.LBB22:
+.stabn 68,0,44,.LM101-v4_cmove_Greater
+.LM101:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jle .L13
+.stabn 68,0,45,.LM107-v4_cmove_Greater
+.LM107:
+	call v4_dup@PLT
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+.L15:
+.stabn 68,0,46,.LM115-v4_cmove_Greater
+.LM115:
+	call v4_i@PLT
+	call v4_swap@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,47,.LM118-v4_cmove_Greater
+.LM118:
+	call v4_r_Fetch@PLT
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	dec %eax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,48,.LM130-v4_cmove_Greater
+.LM130:
+	call v4_over@PLT
+	call v4_r_Fetch@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+.stabn 68,0,49,.LM138-v4_cmove_Greater
+.LM138:
+	call v4_over@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Store@PLT
+.stabn 68,0,50,.LM146-v4_cmove_Greater
+.LM146:
+	call v4_r_Greater@PLT
+.stabn 68,0,51,.LM147-v4_cmove_Greater
+.LM147:
+	call v4__rpop@PLT
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L15
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+	call v4_drop@PLT
+.stabn 68,0,52,.LM159-v4_cmove_Greater
+.LM159:
+	jmp .L17
+.L13:
+	call v4_drop@PLT
+.L17:
+	mov v4_z2drop@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE22:
+.stabn 68,0,52,.LM165-v4_cmove_Greater
+.LM165:
+	pop %ebx
+	leave
+	ret
+.Lfe22:
+	.size	 v4_cmove_Greater,.Lfe22-v4_cmove_Greater
+.stabn	192,0,0,.LBB22-v4_cmove_Greater
+.stabn	224,0,0,.LBE22-v4_cmove_Greater
+.Lscope22:
+.stabs	"",36,0,0,.Lscope22-v4_cmove_Greater
+.text
+	.align 4
+.stabs "v4___Parencompare_Closeparen:F1",36,0,0,v4___Parencompare_Closeparen
+	.weak v4___Parencompare_Closeparen
+	.type	v4___Parencompare_Closeparen,@function
+v4___Parencompare_Closeparen:
+.stabn 68,0,54,.LMa166-v4___Parencompare_Closeparen
+.LMa166:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic25
+.Lpic25:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic25],%ebx
+0:
+.stabn 68,0,54,.LMb166-v4___Parencompare_Closeparen
+.LMb166:
+.LBB25:
+.stabn 68,0,55,.LM167-v4___Parencompare_Closeparen
+.LM167:
+	mov $4,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush@PLT
+	mov %edx,%eax
+	call v4__rpush@PLT
+.L20:
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4_roll@PLT
+	call v4__rpop@PLT
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L20
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.stabn 68,0,56,.LM190-v4___Parencompare_Closeparen
+.LM190:
+	call v4_rot@PLT
+	call v4_z2dup@PLT
+	call v4_min@PLT
+	call v4_Greaterr@PLT
+	call v4_rot@PLT
+	call v4_rot@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,57,.LM197-v4___Parencompare_Closeparen
+.LM197:
+	call v4_swap@PLT
+	call v4_Greaterr@PLT
+	call v4_rot@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,58,.LM201-v4___Parencompare_Closeparen
+.LM201:
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	cmp %eax,%edx
+	je .L22
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+.L23:
+.stabn 68,0,59,.LM209-v4___Parencompare_Closeparen
+.LM209:
+	call v4_over@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+.stabn 68,0,60,.LM217-v4___Parencompare_Closeparen
+.LM217:
+	call v4_over@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+.stabn 68,0,61,.LM225-v4___Parencompare_Closeparen
+.LM225:
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4_pick@PLT
+	call v4_execute@PLT
+.stabn 68,0,62,.LM229-v4___Parencompare_Closeparen
+.LM229:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L25
+	call v4__dpop@PLT
+	test %eax,%eax
+	jge .L26
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L27
+.L26:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+.L27:
+.stabn 68,0,64,.LM247-v4___Parencompare_Closeparen
+.LM247:
+	call v4_z2rdrop@PLT
+	call v4_Greaterr@PLT
+	call v4_drop@PLT
+	call v4_z2drop@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,65,.LM252-v4___Parencompare_Closeparen
+.LM252:
+	mov v4_unloop@GOT(%ebx),%ecx
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.L25:
+	call v4_drop@PLT
+.stabn 68,0,67,.LM256-v4___Parencompare_Closeparen
+.LM256:
+	call v4__rpop@PLT
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L23
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.L22:
+	call v4_z2drop@PLT
+	call v4_drop@PLT
+.stabn 68,0,68,.LM269-v4___Parencompare_Closeparen
+.LM269:
+	call v4_z2r_Greater@PLT
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,69,.LM276-v4___Parencompare_Closeparen
+.LM276:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jge .L28
+	call v4_drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	jmp .L18
+.L28:
+.stabn 68,0,70,.LM287-v4___Parencompare_Closeparen
+.LM287:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jle .L29
+	call v4_drop@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+.L29:
+.L18:
+.LBE25:
+.stabn 68,0,70,.LM299-v4___Parencompare_Closeparen
+.LM299:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe25:
+	.size	 v4___Parencompare_Closeparen,.Lfe25-v4___Parencompare_Closeparen
+.stabn	192,0,0,.LBB25-v4___Parencompare_Closeparen
+.stabn	224,0,0,.LBE25-v4___Parencompare_Closeparen
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4___Parencompare_Closeparen
+.text
+	.align 4
+.stabs "v4___Parencuc_Closeparen:F1",36,0,0,v4___Parencuc_Closeparen
+	.weak v4___Parencuc_Closeparen
+	.type	v4___Parencuc_Closeparen,@function
+v4___Parencuc_Closeparen:
+.stabn 68,0,72,.LMa300-v4___Parencuc_Closeparen
+.LMa300:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic35
+.Lpic35:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic35],%ebx
+0:
+.stabn 68,0,72,.LMb300-v4___Parencuc_Closeparen
+.LMb300:
+.LBB35:
+.stabn 68,0,73,.LM301-v4___Parencuc_Closeparen
+.LM301:
+	call v4_dup@PLT
+	mov $97,%eax
+	call v4__dpush@PLT
+	mov $123,%eax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L31
+	mov $97,%eax
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	mov %eax,%esi
+	mov $65,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	call v4__dpush@PLT
+.L31:
+.LBE35:
+.stabn 68,0,73,.LM326-v4___Parencuc_Closeparen
+.LM326:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe35:
+	.size	 v4___Parencuc_Closeparen,.Lfe35-v4___Parencuc_Closeparen
+.stabn	192,0,0,.LBB35-v4___Parencuc_Closeparen
+.stabn	224,0,0,.LBE35-v4___Parencuc_Closeparen
+.Lscope35:
+.stabs	"",36,0,0,.Lscope35-v4___Parencuc_Closeparen
+.text
+	.align 4
+.stabs "v4___Parencidiff_Closeparen:F1",36,0,0,v4___Parencidiff_Closeparen
+	.weak v4___Parencidiff_Closeparen
+	.type	v4___Parencidiff_Closeparen,@function
+v4___Parencidiff_Closeparen:
+.stabn 68,0,75,.LMa327-v4___Parencidiff_Closeparen
+.LMa327:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic38
+.Lpic38:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic38],%ebx
+0:
+.stabn 68,0,75,.LMb327-v4___Parencidiff_Closeparen
+.LMb327:
+.LBB38:
+.stabn 68,0,76,.LM328-v4___Parencidiff_Closeparen
+.LM328:
+	call v4_Greaterr@PLT
+	call v4___Parencuc_Closeparen@PLT
+	call v4_r_Greater@PLT
+	call v4___Parencuc_Closeparen@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.LBE38:
+.stabn 68,0,76,.LM338-v4___Parencidiff_Closeparen
+.LM338:
+	pop %ebx
+	leave
+	ret
+.Lfe38:
+	.size	 v4___Parencidiff_Closeparen,.Lfe38-v4___Parencidiff_Closeparen
+.stabn	192,0,0,.LBB38-v4___Parencidiff_Closeparen
+.stabn	224,0,0,.LBE38-v4___Parencidiff_Closeparen
+.Lscope38:
+.stabs	"",36,0,0,.Lscope38-v4___Parencidiff_Closeparen
+.text
+	.align 4
+.stabs "v4_compare:F1",36,0,0,v4_compare
+	.weak v4_compare
+	.type	v4_compare,@function
+v4_compare:
+.stabn 68,0,78,.LMa339-v4_compare
+.LMa339:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic39
+.Lpic39:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic39],%ebx
+0:
+.stabn 68,0,78,.LMb339-v4_compare
+.LMb339:
+.LBB39:
+.stabn 68,0,79,.LM340-v4_compare
+.LM340:
+	mov v4_Minus@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	mov v4___Parencompare_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE39:
+.stabn 68,0,79,.LM344-v4_compare
+.LM344:
+	pop %ebx
+	leave
+	ret
+.Lfe39:
+	.size	 v4_compare,.Lfe39-v4_compare
+.stabn	192,0,0,.LBB39-v4_compare
+.stabn	224,0,0,.LBE39-v4_compare
+.Lscope39:
+.stabs	"",36,0,0,.Lscope39-v4_compare
+.text
+	.align 4
+.stabs "v4_comparei:F1",36,0,0,v4_comparei
+	.weak v4_comparei
+	.type	v4_comparei,@function
+v4_comparei:
+.stabn 68,0,81,.LMa345-v4_comparei
+.LMa345:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic40
+.Lpic40:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic40],%ebx
+0:
+.stabn 68,0,81,.LMb345-v4_comparei
+.LMb345:
+.LBB40:
+.stabn 68,0,82,.LM346-v4_comparei
+.LM346:
+	mov v4___Parencidiff_Closeparen@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	mov v4___Parencompare_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE40:
+.stabn 68,0,82,.LM350-v4_comparei
+.LM350:
+	pop %ebx
+	leave
+	ret
+.Lfe40:
+	.size	 v4_comparei,.Lfe40-v4_comparei
+.stabn	192,0,0,.LBB40-v4_comparei
+.stabn	224,0,0,.LBE40-v4_comparei
+.Lscope40:
+.stabs	"",36,0,0,.Lscope40-v4_comparei
+.text
+	.align 4
+.stabs "v4___Parensearch_Closeparen:F1",36,0,0,v4___Parensearch_Closeparen
+	.weak v4___Parensearch_Closeparen
+	.type	v4___Parensearch_Closeparen,@function
+v4___Parensearch_Closeparen:
+.stabn 68,0,84,.LMa351-v4___Parensearch_Closeparen
+.LMa351:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	call .Lpic41
+.Lpic41:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic41],%ebx
+0:
+.stabn 68,0,84,.LMb351-v4___Parensearch_Closeparen
+.LMb351:
+.LBB41:
+.stabn 68,0,85,.LM352-v4___Parensearch_Closeparen
+.LM352:
+	mov $4,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush@PLT
+	mov %edx,%eax
+	call v4__rpush@PLT
+.L37:
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4_roll@PLT
+	call v4__rpop@PLT
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L37
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.stabn 68,0,86,.LM375-v4___Parensearch_Closeparen
+.LM375:
+	call v4_dup@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4_pick@PLT
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,87,.LM385-v4___Parensearch_Closeparen
+.LM385:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jge .L39
+.stabn 68,0,88,.LM391-v4___Parensearch_Closeparen
+.LM391:
+	call v4_drop@PLT
+	call v4_z2drop@PLT
+	call v4_rot@PLT
+	call v4_drop@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	jmp .L35
+.L39:
+	call v4__dpop@PLT
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush@PLT
+	mov %edx,%eax
+	call v4__rpush@PLT
+.L41:
+.stabn 68,0,91,.LM411-v4___Parensearch_Closeparen
+.LM411:
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4_pick@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	call v4_z2over@PLT
+.stabn 68,0,92,.LM422-v4___Parensearch_Closeparen
+.LM422:
+	mov $8,%eax
+	call v4__dpush@PLT
+	call v4_pick@PLT
+	call v4_execute@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	jne .L43
+.stabn 68,0,94,.LM431-v4___Parensearch_Closeparen
+.LM431:
+	call v4_z2drop@PLT
+	call v4_swap@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	add %edx,%eax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %eax,%edx
+	call v4__dpop@PLT
+	sub %edx,%eax
+	call v4__dpush@PLT
+.stabn 68,0,95,.LM446-v4___Parensearch_Closeparen
+.LM446:
+	call v4_rot@PLT
+	call v4_drop@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	mov v4_unloop@GOT(%ebx),%ecx
+	pop %esi
+	pop %ebx
+	leave
+	jmp *%ecx
+.L43:
+.stabn 68,0,97,.LM454-v4___Parensearch_Closeparen
+.LM454:
+	call v4__rpop@PLT
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %edx,%eax
+	call v4__rpush@PLT
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L41
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.stabn 68,0,98,.LM465-v4___Parensearch_Closeparen
+.LM465:
+	call v4_z2drop@PLT
+	call v4_drop@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+.L35:
+.LBE41:
+.stabn 68,0,98,.LM471-v4___Parensearch_Closeparen
+.LM471:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe41:
+	.size	 v4___Parensearch_Closeparen,.Lfe41-v4___Parensearch_Closeparen
+.stabn	192,0,0,.LBB41-v4___Parensearch_Closeparen
+.stabn	224,0,0,.LBE41-v4___Parensearch_Closeparen
+.Lscope41:
+.stabs	"",36,0,0,.Lscope41-v4___Parensearch_Closeparen
+.text
+	.align 4
+.stabs "v4_search:F1",36,0,0,v4_search
+	.weak v4_search
+	.type	v4_search,@function
+v4_search:
+.stabn 68,0,100,.LMa472-v4_search
+.LMa472:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic46
+.Lpic46:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic46],%ebx
+0:
+.stabn 68,0,100,.LMb472-v4_search
+.LMb472:
+.LBB46:
+.stabn 68,0,101,.LM473-v4_search
+.LM473:
+	mov v4_compare@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	mov v4___Parensearch_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE46:
+.stabn 68,0,101,.LM477-v4_search
+.LM477:
+	pop %ebx
+	leave
+	ret
+.Lfe46:
+	.size	 v4_search,.Lfe46-v4_search
+.stabn	192,0,0,.LBB46-v4_search
+.stabn	224,0,0,.LBE46-v4_search
+.Lscope46:
+.stabs	"",36,0,0,.Lscope46-v4_search
+.text
+	.align 4
+.stabs "v4_searchi:F1",36,0,0,v4_searchi
+	.weak v4_searchi
+	.type	v4_searchi,@function
+v4_searchi:
+.stabn 68,0,103,.LMa478-v4_searchi
+.LMa478:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic47
+.Lpic47:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic47],%ebx
+0:
+.stabn 68,0,103,.LMb478-v4_searchi
+.LMb478:
+.LBB47:
+.stabn 68,0,104,.LM479-v4_searchi
+.LM479:
+	mov v4_comparei@GOT(%ebx),%eax
+	call v4__dpush@PLT
+	mov v4___Parensearch_Closeparen@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE47:
+.stabn 68,0,104,.LM483-v4_searchi
+.LM483:
+	pop %ebx
+	leave
+	ret
+.Lfe47:
+	.size	 v4_searchi,.Lfe47-v4_searchi
+.stabn	192,0,0,.LBB47-v4_searchi
+.stabn	224,0,0,.LBE47-v4_searchi
+.Lscope47:
+.stabs	"",36,0,0,.Lscope47-v4_searchi
+.text
+	.align 4
+.stabs "v4_sliteral:F1",36,0,0,v4_sliteral
+	.weak v4_sliteral
+	.type	v4_sliteral,@function
+v4_sliteral:
+.stabn 68,0,106,.LMa484-v4_sliteral
+.LMa484:
+	push %ebx
+	call .Lpic48
+.Lpic48:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic48],%ebx
+0:
+.stabn 68,0,106,.LMb484-v4_sliteral
+.LMb484:
+.LBB48:
+.LBE48:
+.stabn 68,0,106,.LM486-v4_sliteral
+.LM486:
+	pop %ebx
+	ret
+.Lfe48:
+	.size	 v4_sliteral,.Lfe48-v4_sliteral
+.stabn	192,0,0,.LBB48-v4_sliteral
+.stabn	224,0,0,.LBE48-v4_sliteral
+.Lscope48:
+.stabs	"",36,0,0,.Lscope48-v4_sliteral
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,106 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: syscall.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+   220 Sym_8 external "v4_Fetch"
+   215 Sym_6 external "v4_Store"
+   212 Sym_1 variable Cell "v4__errno"
+   213 Sym_2 word "v4__post_syscall"
+   153 Sym_0 codeword "v4__syscall"
+   214 Sym_3 external "v4_dup"
+   219 Sym_7 word "v4_errno"
+   215 Sym_5 external "v4_negate"
+   214 Sym_4 external "v4_within"
+
+Intermediate code:
+   153 function Sym_0 {
+   154   asm (    call v4__dpop@PLT)
+   155   asm (    cmp $7,%eax)
+   156   asm (    jb 9f)
+   157   asm (    mov $-24,%eax)
+   158   asm (    call v4__dpush@PLT)
+   159   asm (    call v4_throw@PLT)
+   161   asm (9:)
+   162   asm (    mov %eax,%edi)
+   164   asm (    push %ebx)
+   165   asm (    push %ebp)
+   167   asm (    mov %eax,%ecx)
+   168   asm (    inc %ecx)
+   169   asm (8:)
+   170   asm (    call v4__dpop@PLT)
+   171   asm (    push %eax)
+   172   asm (    loop 8b)
+   174   asm (    mov %edi,%eax)
+   176   asm (    cmp $6,%eax)
+   177   asm (    jb 6f)
+   178   asm (    pop %ebp)
+   179   asm (6:  cmp $5,%eax)
+   180   asm (    jb 5f)
+   181   asm (    pop %edi)
+   182   asm (5:  cmp $4,%eax)
+   183   asm (    jb 4f)
+   184   asm (    pop %esi)
+   185   asm (4:  cmp $3,%eax)
+   186   asm (    jb 3f)
+   187   asm (    pop %edx)
+   188   asm (3:  cmp $2,%eax)
+   189   asm (    jb 2f)
+   190   asm (    pop %ecx)
+   191   asm (2:  cmp $1,%eax)
+   192   asm (    jb 1f)
+   193   asm (    pop %ebx)
+   194   asm (1:)
+   196   asm (    pop %eax)
+   197   asm (    int $0x80)
+   199   asm (    pop %ebp)
+   200   asm (    pop %ebx)
+   202   asm (    call v4__dpush@PLT)
+   204   asm (    forth_pic.=0b-0b)
+   205 }
+
+   213 function Sym_2 {
+   214   call Sym_3
+   214   Reg_0 = -125
+   214   Stack_D = Reg_0
+   214   Reg_0 = -1
+   214   Stack_D = Reg_0
+   214   call Sym_4
+   214   Reg_0 = Stack_D
+   214   if Reg_0 == 0 goto Label_2
+   215   no-op
+           optimizes   call Sym_5
+   215   Reg_0 = Stack_D
+   215   Reg_0 = -Reg_0
+   215   no-op
+           optimizes   Stack_D = Reg_0
+   215   no-op
+           optimizes   Reg_0 = Sym_1
+   215   no-op
+           optimizes   Stack_D = Reg_0
+   215   no-op
+           optimizes   call Sym_6
+   215   no-op
+           optimizes   Reg_0 = Stack_D
+   215   *(Sym_1) = Reg_0
+   216   Reg_0 = -1
+   216   Stack_D = Reg_0
+   217 label Label_2
+   217   no-op
+           optimizes label Label_1
+   217 }
+
+   219 function Sym_7 {
+   220   no-op
+           optimizes   Reg_0 = Sym_1
+   220   no-op
+           optimizes   Stack_D = Reg_0
+   220   no-op
+           optimizes   call Sym_8
+   220   Reg_0 = *(Sym_1)
+   220   Stack_D = Reg_0
+   220   no-op
+           optimizes label Label_3
+   220 }
+
@@ -0,0 +1,181 @@
+	.file	"syscall.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"syscall.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.stabs	"v4__errno:G2",40,0,0,v4__errno
+	.comm  v4__errno,4,4
+.text
+	.align 4
+.stabs "v4__syscall:F1",36,0,0,v4__syscall
+	.weak v4__syscall
+	.type	v4__syscall,@function
+v4__syscall:
+.stabn 68,0,153,.LMa0-v4__syscall
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %edi
+	push %esi
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,153,.LMb0-v4__syscall
+.LMb0:
+.LBB0:
+#APP
+    call v4__dpop@PLT
+    cmp $7,%eax
+    jb 9f
+    mov $-24,%eax
+    call v4__dpush@PLT
+    call v4_throw@PLT
+9:
+    mov %eax,%edi
+    push %ebx
+    push %ebp
+    mov %eax,%ecx
+    inc %ecx
+8:
+    call v4__dpop@PLT
+    push %eax
+    loop 8b
+    mov %edi,%eax
+    cmp $6,%eax
+    jb 6f
+    pop %ebp
+6:  cmp $5,%eax
+    jb 5f
+    pop %edi
+5:  cmp $4,%eax
+    jb 4f
+    pop %esi
+4:  cmp $3,%eax
+    jb 3f
+    pop %edx
+3:  cmp $2,%eax
+    jb 2f
+    pop %ecx
+2:  cmp $1,%eax
+    jb 1f
+    pop %ebx
+1:
+    pop %eax
+    int $0x80
+    pop %ebp
+    pop %ebx
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE0:
+.stabn 68,0,205,.LM43-v4__syscall
+.LM43:
+	pop %esi
+	pop %edi
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4__syscall,.Lfe0-v4__syscall
+.stabn	192,0,0,.LBB0-v4__syscall
+.stabn	224,0,0,.LBE0-v4__syscall
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4__syscall
+.text
+	.align 4
+.stabs "v4__post_syscall:F1",36,0,0,v4__post_syscall
+	.weak v4__post_syscall
+	.type	v4__post_syscall,@function
+v4__post_syscall:
+.stabn 68,0,213,.LMa44-v4__post_syscall
+.LMa44:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic2
+.Lpic2:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic2],%ebx
+0:
+.stabn 68,0,213,.LMb44-v4__post_syscall
+.LMb44:
+.LBB2:
+.stabn 68,0,214,.LM45-v4__post_syscall
+.LM45:
+	call v4_dup@PLT
+	mov $-125,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %eax,%eax
+	je .L2
+	call v4__dpop@PLT
+	neg %eax
+	mov v4__errno@GOT(%ebx),%ecx
+	mov %eax,(%ecx)
+.stabn 68,0,216,.LM62-v4__post_syscall
+.LM62:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush@PLT
+.L2:
+.LBE2:
+.stabn 68,0,217,.LM66-v4__post_syscall
+.LM66:
+	pop %ebx
+	leave
+	ret
+.Lfe2:
+	.size	 v4__post_syscall,.Lfe2-v4__post_syscall
+.stabn	192,0,0,.LBB2-v4__post_syscall
+.stabn	224,0,0,.LBE2-v4__post_syscall
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4__post_syscall
+.text
+	.align 4
+.stabs "v4_errno:F1",36,0,0,v4_errno
+	.weak v4_errno
+	.type	v4_errno,@function
+v4_errno:
+.stabn 68,0,219,.LMa67-v4_errno
+.LMa67:
+	push %ebx
+	call .Lpic7
+.Lpic7:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic7],%ebx
+0:
+.stabn 68,0,219,.LMb67-v4_errno
+.LMb67:
+.LBB7:
+	mov v4__errno@GOT(%ebx),%ecx
+	mov (%ecx),%eax
+	call v4__dpush@PLT
+.LBE7:
+.stabn 68,0,220,.LM74-v4_errno
+.LM74:
+	pop %ebx
+	ret
+.Lfe7:
+	.size	 v4_errno,.Lfe7-v4_errno
+.stabn	192,0,0,.LBB7-v4_errno
+.stabn	224,0,0,.LBE7-v4_errno
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_errno
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,1661 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: syscalls.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Symbols:
+    57 Sym_27 word "v4__access"
+    54 Sym_24 word "v4__alarm"
+    66 Sym_36 word "v4__brk"
+    43 Sym_13 word "v4__chdir"
+    46 Sym_16 word "v4__chmod"
+   156 Sym_126 word "v4__chown"
+   135 Sym_105 word "v4__chown16"
+    76 Sym_46 word "v4__chroot"
+   105 Sym_75 word "v4__clone"
+    37 Sym_7 word "v4__close"
+    39 Sym_9 word "v4__creat"
+    63 Sym_33 word "v4__dup"
+    77 Sym_47 word "v4__dup2"
+    42 Sym_12 word "v4__execve"
+    32 Sym_0 word "v4__exit"
+   108 Sym_78 word "v4__fchdir"
+    89 Sym_59 word "v4__fchmod"
+   151 Sym_121 word "v4__fchown"
+    90 Sym_60 word "v4__fchown16"
+    73 Sym_43 word "v4__fcntl"
+   115 Sym_85 word "v4__flock"
+    33 Sym_3 word "v4__fork"
+    99 Sym_69 word "v4__fstat"
+   104 Sym_74 word "v4__fsync"
+    88 Sym_58 word "v4__ftruncate"
+   136 Sym_106 word "v4__getcwd"
+   113 Sym_83 word "v4__getdents"
+   146 Sym_116 word "v4__getegid"
+    71 Sym_41 word "v4__getegid16"
+   145 Sym_115 word "v4__geteuid"
+    70 Sym_40 word "v4__geteuid16"
+   144 Sym_114 word "v4__getgid"
+    68 Sym_38 word "v4__getgid16"
+   149 Sym_119 word "v4__getgroups"
+    96 Sym_66 word "v4__getitimer"
+   107 Sym_77 word "v4__getpgid"
+    79 Sym_49 word "v4__getpgrp"
+    49 Sym_19 word "v4__getpid"
+    78 Sym_48 word "v4__getppid"
+    91 Sym_61 word "v4__getpriority"
+   155 Sym_125 word "v4__getresgid"
+   125 Sym_95 word "v4__getresgid16"
+   153 Sym_123 word "v4__getresuid"
+   122 Sym_92 word "v4__getresuid16"
+   140 Sym_110 word "v4__getrlimit"
+   143 Sym_113 word "v4__getuid"
+    52 Sym_22 word "v4__getuid16"
+    72 Sym_42 word "v4__ioctl"
+   103 Sym_73 word "v4__ipc"
+    59 Sym_29 word "v4__kill"
+   142 Sym_112 word "v4__lchown"
+    47 Sym_17 word "v4__lchown16"
+    40 Sym_10 word "v4__link"
+   112 Sym_82 word "v4__llseek"
+    48 Sym_18 word "v4__lseek"
+    98 Sym_68 word "v4__lstat"
+    61 Sym_31 word "v4__mkdir"
+    45 Sym_15 word "v4__mknod"
+   141 Sym_111 word "v4__mmap2"
+    50 Sym_20 word "v4__mount"
+   120 Sym_90 word "v4__mremap"
+   116 Sym_86 word "v4__msync"
+    86 Sym_56 word "v4__munmap"
+   119 Sym_89 word "v4__nanosleep"
+   106 Sym_76 word "v4__new_uname"
+    58 Sym_28 word "v4__nice"
+    36 Sym_6 word "v4__open"
+    55 Sym_25 word "v4__pause"
+   109 Sym_79 word "v4__personality"
+    64 Sym_34 word "v4__pipe"
+   123 Sym_93 word "v4__poll"
+    32 Sym_2 external "v4__post_syscall"
+   133 Sym_103 word "v4__pread"
+   134 Sym_104 word "v4__pwrite"
+    34 Sym_4 word "v4__read"
+    85 Sym_55 word "v4__readdir"
+    84 Sym_54 word "v4__readlink"
+   117 Sym_87 word "v4__readv"
+    60 Sym_30 word "v4__rename"
+    62 Sym_32 word "v4__rmdir"
+   114 Sym_84 word "v4__select"
+   138 Sym_108 word "v4__sendfile"
+   111 Sym_81 word "v4__setfsgid"
+   110 Sym_80 word "v4__setfsuid"
+   158 Sym_128 word "v4__setgid"
+    67 Sym_37 word "v4__setgid16"
+   150 Sym_120 word "v4__setgroups"
+    95 Sym_65 word "v4__setitimer"
+    74 Sym_44 word "v4__setpgid"
+    92 Sym_62 word "v4__setpriority"
+   148 Sym_118 word "v4__setregid"
+    82 Sym_52 word "v4__setregid16"
+   154 Sym_124 word "v4__setresgid"
+   124 Sym_94 word "v4__setresgid16"
+   152 Sym_122 word "v4__setresuid"
+   121 Sym_91 word "v4__setresuid16"
+   147 Sym_117 word "v4__setreuid"
+    81 Sym_51 word "v4__setreuid16"
+    80 Sym_50 word "v4__setsid"
+   157 Sym_127 word "v4__setuid"
+    51 Sym_21 word "v4__setuid16"
+   127 Sym_97 word "v4__sigaction"
+   137 Sym_107 word "v4__sigaltstack"
+    69 Sym_39 word "v4__signal"
+   129 Sym_99 word "v4__sigpending"
+   128 Sym_98 word "v4__sigprocmask"
+   131 Sym_101 word "v4__sigqueueinfo"
+   126 Sym_96 word "v4__sigret"
+   132 Sym_102 word "v4__sigsuspend"
+   130 Sym_100 word "v4__sigtimedwait"
+    93 Sym_63 word "v4__socketcall"
+    97 Sym_67 word "v4__stat"
+    53 Sym_23 word "v4__stime"
+    83 Sym_53 word "v4__symlink"
+    32 Sym_1 external "v4__syscall"
+   102 Sym_72 word "v4__sysinfo"
+    94 Sym_64 word "v4__syslog"
+    44 Sym_14 word "v4__time"
+    65 Sym_35 word "v4__times"
+    87 Sym_57 word "v4__truncate"
+    75 Sym_45 word "v4__umask"
+   100 Sym_70 word "v4__uname"
+    41 Sym_11 word "v4__unlink"
+    56 Sym_26 word "v4__utime"
+   139 Sym_109 word "v4__vfork"
+   101 Sym_71 word "v4__wait4"
+    38 Sym_8 word "v4__waitpid"
+    35 Sym_5 word "v4__write"
+   118 Sym_88 word "v4__writev"
+
+Intermediate code:
+    32 function Sym_0 {
+    32   Reg_0 = 1
+    32   Stack_D = Reg_0
+    32   Reg_0 = 1
+    32   Stack_D = Reg_0
+    32   call Sym_1
+    32   tail call Sym_2
+           optimizes   call Sym_2
+    32   no-op
+           optimizes label Label_1
+    32 }
+
+    33 function Sym_3 {
+    33   Reg_0 = 2
+    33   Stack_D = Reg_0
+    33   Reg_0 = 0
+    33   Stack_D = Reg_0
+    33   call Sym_1
+    33   tail call Sym_2
+           optimizes   call Sym_2
+    33   no-op
+           optimizes label Label_2
+    33 }
+
+    34 function Sym_4 {
+    34   Reg_0 = 3
+    34   Stack_D = Reg_0
+    34   Reg_0 = 3
+    34   Stack_D = Reg_0
+    34   call Sym_1
+    34   tail call Sym_2
+           optimizes   call Sym_2
+    34   no-op
+           optimizes label Label_3
+    34 }
+
+    35 function Sym_5 {
+    35   Reg_0 = 4
+    35   Stack_D = Reg_0
+    35   Reg_0 = 3
+    35   Stack_D = Reg_0
+    35   call Sym_1
+    35   tail call Sym_2
+           optimizes   call Sym_2
+    35   no-op
+           optimizes label Label_4
+    35 }
+
+    36 function Sym_6 {
+    36   Reg_0 = 5
+    36   Stack_D = Reg_0
+    36   Reg_0 = 3
+    36   Stack_D = Reg_0
+    36   call Sym_1
+    36   tail call Sym_2
+           optimizes   call Sym_2
+    36   no-op
+           optimizes label Label_5
+    36 }
+
+    37 function Sym_7 {
+    37   Reg_0 = 6
+    37   Stack_D = Reg_0
+    37   Reg_0 = 1
+    37   Stack_D = Reg_0
+    37   call Sym_1
+    37   tail call Sym_2
+           optimizes   call Sym_2
+    37   no-op
+           optimizes label Label_6
+    37 }
+
+    38 function Sym_8 {
+    38   Reg_0 = 7
+    38   Stack_D = Reg_0
+    38   Reg_0 = 3
+    38   Stack_D = Reg_0
+    38   call Sym_1
+    38   tail call Sym_2
+           optimizes   call Sym_2
+    38   no-op
+           optimizes label Label_7
+    38 }
+
+    39 function Sym_9 {
+    39   Reg_0 = 8
+    39   Stack_D = Reg_0
+    39   Reg_0 = 2
+    39   Stack_D = Reg_0
+    39   call Sym_1
+    39   tail call Sym_2
+           optimizes   call Sym_2
+    39   no-op
+           optimizes label Label_8
+    39 }
+
+    40 function Sym_10 {
+    40   Reg_0 = 9
+    40   Stack_D = Reg_0
+    40   Reg_0 = 2
+    40   Stack_D = Reg_0
+    40   call Sym_1
+    40   tail call Sym_2
+           optimizes   call Sym_2
+    40   no-op
+           optimizes label Label_9
+    40 }
+
+    41 function Sym_11 {
+    41   Reg_0 = 10
+    41   Stack_D = Reg_0
+    41   Reg_0 = 1
+    41   Stack_D = Reg_0
+    41   call Sym_1
+    41   tail call Sym_2
+           optimizes   call Sym_2
+    41   no-op
+           optimizes label Label_10
+    41 }
+
+    42 function Sym_12 {
+    42   Reg_0 = 11
+    42   Stack_D = Reg_0
+    42   Reg_0 = 3
+    42   Stack_D = Reg_0
+    42   call Sym_1
+    42   tail call Sym_2
+           optimizes   call Sym_2
+    42   no-op
+           optimizes label Label_11
+    42 }
+
+    43 function Sym_13 {
+    43   Reg_0 = 12
+    43   Stack_D = Reg_0
+    43   Reg_0 = 1
+    43   Stack_D = Reg_0
+    43   call Sym_1
+    43   tail call Sym_2
+           optimizes   call Sym_2
+    43   no-op
+           optimizes label Label_12
+    43 }
+
+    44 function Sym_14 {
+    44   Reg_0 = 13
+    44   Stack_D = Reg_0
+    44   Reg_0 = 1
+    44   Stack_D = Reg_0
+    44   call Sym_1
+    44   tail call Sym_2
+           optimizes   call Sym_2
+    44   no-op
+           optimizes label Label_13
+    44 }
+
+    45 function Sym_15 {
+    45   Reg_0 = 14
+    45   Stack_D = Reg_0
+    45   Reg_0 = 3
+    45   Stack_D = Reg_0
+    45   call Sym_1
+    45   tail call Sym_2
+           optimizes   call Sym_2
+    45   no-op
+           optimizes label Label_14
+    45 }
+
+    46 function Sym_16 {
+    46   Reg_0 = 15
+    46   Stack_D = Reg_0
+    46   Reg_0 = 2
+    46   Stack_D = Reg_0
+    46   call Sym_1
+    46   tail call Sym_2
+           optimizes   call Sym_2
+    46   no-op
+           optimizes label Label_15
+    46 }
+
+    47 function Sym_17 {
+    47   Reg_0 = 16
+    47   Stack_D = Reg_0
+    47   Reg_0 = 3
+    47   Stack_D = Reg_0
+    47   call Sym_1
+    47   tail call Sym_2
+           optimizes   call Sym_2
+    47   no-op
+           optimizes label Label_16
+    47 }
+
+    48 function Sym_18 {
+    48   Reg_0 = 19
+    48   Stack_D = Reg_0
+    48   Reg_0 = 3
+    48   Stack_D = Reg_0
+    48   call Sym_1
+    48   tail call Sym_2
+           optimizes   call Sym_2
+    48   no-op
+           optimizes label Label_17
+    48 }
+
+    49 function Sym_19 {
+    49   Reg_0 = 20
+    49   Stack_D = Reg_0
+    49   Reg_0 = 0
+    49   Stack_D = Reg_0
+    49   call Sym_1
+    49   tail call Sym_2
+           optimizes   call Sym_2
+    49   no-op
+           optimizes label Label_18
+    49 }
+
+    50 function Sym_20 {
+    50   Reg_0 = 21
+    50   Stack_D = Reg_0
+    50   Reg_0 = 5
+    50   Stack_D = Reg_0
+    50   call Sym_1
+    50   tail call Sym_2
+           optimizes   call Sym_2
+    50   no-op
+           optimizes label Label_19
+    50 }
+
+    51 function Sym_21 {
+    51   Reg_0 = 23
+    51   Stack_D = Reg_0
+    51   Reg_0 = 1
+    51   Stack_D = Reg_0
+    51   call Sym_1
+    51   tail call Sym_2
+           optimizes   call Sym_2
+    51   no-op
+           optimizes label Label_20
+    51 }
+
+    52 function Sym_22 {
+    52   Reg_0 = 24
+    52   Stack_D = Reg_0
+    52   Reg_0 = 0
+    52   Stack_D = Reg_0
+    52   call Sym_1
+    52   tail call Sym_2
+           optimizes   call Sym_2
+    52   no-op
+           optimizes label Label_21
+    52 }
+
+    53 function Sym_23 {
+    53   Reg_0 = 25
+    53   Stack_D = Reg_0
+    53   Reg_0 = 1
+    53   Stack_D = Reg_0
+    53   call Sym_1
+    53   tail call Sym_2
+           optimizes   call Sym_2
+    53   no-op
+           optimizes label Label_22
+    53 }
+
+    54 function Sym_24 {
+    54   Reg_0 = 27
+    54   Stack_D = Reg_0
+    54   Reg_0 = 1
+    54   Stack_D = Reg_0
+    54   call Sym_1
+    54   tail call Sym_2
+           optimizes   call Sym_2
+    54   no-op
+           optimizes label Label_23
+    54 }
+
+    55 function Sym_25 {
+    55   Reg_0 = 29
+    55   Stack_D = Reg_0
+    55   Reg_0 = 0
+    55   Stack_D = Reg_0
+    55   call Sym_1
+    55   tail call Sym_2
+           optimizes   call Sym_2
+    55   no-op
+           optimizes label Label_24
+    55 }
+
+    56 function Sym_26 {
+    56   Reg_0 = 30
+    56   Stack_D = Reg_0
+    56   Reg_0 = 2
+    56   Stack_D = Reg_0
+    56   call Sym_1
+    56   tail call Sym_2
+           optimizes   call Sym_2
+    56   no-op
+           optimizes label Label_25
+    56 }
+
+    57 function Sym_27 {
+    57   Reg_0 = 33
+    57   Stack_D = Reg_0
+    57   Reg_0 = 2
+    57   Stack_D = Reg_0
+    57   call Sym_1
+    57   tail call Sym_2
+           optimizes   call Sym_2
+    57   no-op
+           optimizes label Label_26
+    57 }
+
+    58 function Sym_28 {
+    58   Reg_0 = 34
+    58   Stack_D = Reg_0
+    58   Reg_0 = 1
+    58   Stack_D = Reg_0
+    58   call Sym_1
+    58   tail call Sym_2
+           optimizes   call Sym_2
+    58   no-op
+           optimizes label Label_27
+    58 }
+
+    59 function Sym_29 {
+    59   Reg_0 = 37
+    59   Stack_D = Reg_0
+    59   Reg_0 = 2
+    59   Stack_D = Reg_0
+    59   call Sym_1
+    59   tail call Sym_2
+           optimizes   call Sym_2
+    59   no-op
+           optimizes label Label_28
+    59 }
+
+    60 function Sym_30 {
+    60   Reg_0 = 38
+    60   Stack_D = Reg_0
+    60   Reg_0 = 2
+    60   Stack_D = Reg_0
+    60   call Sym_1
+    60   tail call Sym_2
+           optimizes   call Sym_2
+    60   no-op
+           optimizes label Label_29
+    60 }
+
+    61 function Sym_31 {
+    61   Reg_0 = 39
+    61   Stack_D = Reg_0
+    61   Reg_0 = 2
+    61   Stack_D = Reg_0
+    61   call Sym_1
+    61   tail call Sym_2
+           optimizes   call Sym_2
+    61   no-op
+           optimizes label Label_30
+    61 }
+
+    62 function Sym_32 {
+    62   Reg_0 = 40
+    62   Stack_D = Reg_0
+    62   Reg_0 = 1
+    62   Stack_D = Reg_0
+    62   call Sym_1
+    62   tail call Sym_2
+           optimizes   call Sym_2
+    62   no-op
+           optimizes label Label_31
+    62 }
+
+    63 function Sym_33 {
+    63   Reg_0 = 41
+    63   Stack_D = Reg_0
+    63   Reg_0 = 1
+    63   Stack_D = Reg_0
+    63   call Sym_1
+    63   tail call Sym_2
+           optimizes   call Sym_2
+    63   no-op
+           optimizes label Label_32
+    63 }
+
+    64 function Sym_34 {
+    64   Reg_0 = 42
+    64   Stack_D = Reg_0
+    64   Reg_0 = 1
+    64   Stack_D = Reg_0
+    64   call Sym_1
+    64   tail call Sym_2
+           optimizes   call Sym_2
+    64   no-op
+           optimizes label Label_33
+    64 }
+
+    65 function Sym_35 {
+    65   Reg_0 = 43
+    65   Stack_D = Reg_0
+    65   Reg_0 = 1
+    65   Stack_D = Reg_0
+    65   call Sym_1
+    65   tail call Sym_2
+           optimizes   call Sym_2
+    65   no-op
+           optimizes label Label_34
+    65 }
+
+    66 function Sym_36 {
+    66   Reg_0 = 45
+    66   Stack_D = Reg_0
+    66   Reg_0 = 1
+    66   Stack_D = Reg_0
+    66   call Sym_1
+    66   tail call Sym_2
+           optimizes   call Sym_2
+    66   no-op
+           optimizes label Label_35
+    66 }
+
+    67 function Sym_37 {
+    67   Reg_0 = 46
+    67   Stack_D = Reg_0
+    67   Reg_0 = 1
+    67   Stack_D = Reg_0
+    67   call Sym_1
+    67   tail call Sym_2
+           optimizes   call Sym_2
+    67   no-op
+           optimizes label Label_36
+    67 }
+
+    68 function Sym_38 {
+    68   Reg_0 = 47
+    68   Stack_D = Reg_0
+    68   Reg_0 = 0
+    68   Stack_D = Reg_0
+    68   call Sym_1
+    68   tail call Sym_2
+           optimizes   call Sym_2
+    68   no-op
+           optimizes label Label_37
+    68 }
+
+    69 function Sym_39 {
+    69   Reg_0 = 48
+    69   Stack_D = Reg_0
+    69   Reg_0 = 2
+    69   Stack_D = Reg_0
+    69   call Sym_1
+    69   tail call Sym_2
+           optimizes   call Sym_2
+    69   no-op
+           optimizes label Label_38
+    69 }
+
+    70 function Sym_40 {
+    70   Reg_0 = 49
+    70   Stack_D = Reg_0
+    70   Reg_0 = 0
+    70   Stack_D = Reg_0
+    70   call Sym_1
+    70   tail call Sym_2
+           optimizes   call Sym_2
+    70   no-op
+           optimizes label Label_39
+    70 }
+
+    71 function Sym_41 {
+    71   Reg_0 = 50
+    71   Stack_D = Reg_0
+    71   Reg_0 = 0
+    71   Stack_D = Reg_0
+    71   call Sym_1
+    71   tail call Sym_2
+           optimizes   call Sym_2
+    71   no-op
+           optimizes label Label_40
+    71 }
+
+    72 function Sym_42 {
+    72   Reg_0 = 54
+    72   Stack_D = Reg_0
+    72   Reg_0 = 3
+    72   Stack_D = Reg_0
+    72   call Sym_1
+    72   tail call Sym_2
+           optimizes   call Sym_2
+    72   no-op
+           optimizes label Label_41
+    72 }
+
+    73 function Sym_43 {
+    73   Reg_0 = 55
+    73   Stack_D = Reg_0
+    73   Reg_0 = 3
+    73   Stack_D = Reg_0
+    73   call Sym_1
+    73   tail call Sym_2
+           optimizes   call Sym_2
+    73   no-op
+           optimizes label Label_42
+    73 }
+
+    74 function Sym_44 {
+    74   Reg_0 = 57
+    74   Stack_D = Reg_0
+    74   Reg_0 = 2
+    74   Stack_D = Reg_0
+    74   call Sym_1
+    74   tail call Sym_2
+           optimizes   call Sym_2
+    74   no-op
+           optimizes label Label_43
+    74 }
+
+    75 function Sym_45 {
+    75   Reg_0 = 60
+    75   Stack_D = Reg_0
+    75   Reg_0 = 1
+    75   Stack_D = Reg_0
+    75   call Sym_1
+    75   tail call Sym_2
+           optimizes   call Sym_2
+    75   no-op
+           optimizes label Label_44
+    75 }
+
+    76 function Sym_46 {
+    76   Reg_0 = 61
+    76   Stack_D = Reg_0
+    76   Reg_0 = 1
+    76   Stack_D = Reg_0
+    76   call Sym_1
+    76   tail call Sym_2
+           optimizes   call Sym_2
+    76   no-op
+           optimizes label Label_45
+    76 }
+
+    77 function Sym_47 {
+    77   Reg_0 = 63
+    77   Stack_D = Reg_0
+    77   Reg_0 = 2
+    77   Stack_D = Reg_0
+    77   call Sym_1
+    77   tail call Sym_2
+           optimizes   call Sym_2
+    77   no-op
+           optimizes label Label_46
+    77 }
+
+    78 function Sym_48 {
+    78   Reg_0 = 64
+    78   Stack_D = Reg_0
+    78   Reg_0 = 0
+    78   Stack_D = Reg_0
+    78   call Sym_1
+    78   tail call Sym_2
+           optimizes   call Sym_2
+    78   no-op
+           optimizes label Label_47
+    78 }
+
+    79 function Sym_49 {
+    79   Reg_0 = 65
+    79   Stack_D = Reg_0
+    79   Reg_0 = 0
+    79   Stack_D = Reg_0
+    79   call Sym_1
+    79   tail call Sym_2
+           optimizes   call Sym_2
+    79   no-op
+           optimizes label Label_48
+    79 }
+
+    80 function Sym_50 {
+    80   Reg_0 = 66
+    80   Stack_D = Reg_0
+    80   Reg_0 = 0
+    80   Stack_D = Reg_0
+    80   call Sym_1
+    80   tail call Sym_2
+           optimizes   call Sym_2
+    80   no-op
+           optimizes label Label_49
+    80 }
+
+    81 function Sym_51 {
+    81   Reg_0 = 70
+    81   Stack_D = Reg_0
+    81   Reg_0 = 2
+    81   Stack_D = Reg_0
+    81   call Sym_1
+    81   tail call Sym_2
+           optimizes   call Sym_2
+    81   no-op
+           optimizes label Label_50
+    81 }
+
+    82 function Sym_52 {
+    82   Reg_0 = 71
+    82   Stack_D = Reg_0
+    82   Reg_0 = 2
+    82   Stack_D = Reg_0
+    82   call Sym_1
+    82   tail call Sym_2
+           optimizes   call Sym_2
+    82   no-op
+           optimizes label Label_51
+    82 }
+
+    83 function Sym_53 {
+    83   Reg_0 = 83
+    83   Stack_D = Reg_0
+    83   Reg_0 = 2
+    83   Stack_D = Reg_0
+    83   call Sym_1
+    83   tail call Sym_2
+           optimizes   call Sym_2
+    83   no-op
+           optimizes label Label_52
+    83 }
+
+    84 function Sym_54 {
+    84   Reg_0 = 85
+    84   Stack_D = Reg_0
+    84   Reg_0 = 3
+    84   Stack_D = Reg_0
+    84   call Sym_1
+    84   tail call Sym_2
+           optimizes   call Sym_2
+    84   no-op
+           optimizes label Label_53
+    84 }
+
+    85 function Sym_55 {
+    85   Reg_0 = 89
+    85   Stack_D = Reg_0
+    85   Reg_0 = 1
+    85   Stack_D = Reg_0
+    85   call Sym_1
+    85   tail call Sym_2
+           optimizes   call Sym_2
+    85   no-op
+           optimizes label Label_54
+    85 }
+
+    86 function Sym_56 {
+    86   Reg_0 = 91
+    86   Stack_D = Reg_0
+    86   Reg_0 = 2
+    86   Stack_D = Reg_0
+    86   call Sym_1
+    86   tail call Sym_2
+           optimizes   call Sym_2
+    86   no-op
+           optimizes label Label_55
+    86 }
+
+    87 function Sym_57 {
+    87   Reg_0 = 92
+    87   Stack_D = Reg_0
+    87   Reg_0 = 2
+    87   Stack_D = Reg_0
+    87   call Sym_1
+    87   tail call Sym_2
+           optimizes   call Sym_2
+    87   no-op
+           optimizes label Label_56
+    87 }
+
+    88 function Sym_58 {
+    88   Reg_0 = 93
+    88   Stack_D = Reg_0
+    88   Reg_0 = 2
+    88   Stack_D = Reg_0
+    88   call Sym_1
+    88   tail call Sym_2
+           optimizes   call Sym_2
+    88   no-op
+           optimizes label Label_57
+    88 }
+
+    89 function Sym_59 {
+    89   Reg_0 = 94
+    89   Stack_D = Reg_0
+    89   Reg_0 = 2
+    89   Stack_D = Reg_0
+    89   call Sym_1
+    89   tail call Sym_2
+           optimizes   call Sym_2
+    89   no-op
+           optimizes label Label_58
+    89 }
+
+    90 function Sym_60 {
+    90   Reg_0 = 95
+    90   Stack_D = Reg_0
+    90   Reg_0 = 3
+    90   Stack_D = Reg_0
+    90   call Sym_1
+    90   tail call Sym_2
+           optimizes   call Sym_2
+    90   no-op
+           optimizes label Label_59
+    90 }
+
+    91 function Sym_61 {
+    91   Reg_0 = 96
+    91   Stack_D = Reg_0
+    91   Reg_0 = 2
+    91   Stack_D = Reg_0
+    91   call Sym_1
+    91   tail call Sym_2
+           optimizes   call Sym_2
+    91   no-op
+           optimizes label Label_60
+    91 }
+
+    92 function Sym_62 {
+    92   Reg_0 = 97
+    92   Stack_D = Reg_0
+    92   Reg_0 = 3
+    92   Stack_D = Reg_0
+    92   call Sym_1
+    92   tail call Sym_2
+           optimizes   call Sym_2
+    92   no-op
+           optimizes label Label_61
+    92 }
+
+    93 function Sym_63 {
+    93   Reg_0 = 102
+    93   Stack_D = Reg_0
+    93   Reg_0 = 1
+    93   Stack_D = Reg_0
+    93   call Sym_1
+    93   tail call Sym_2
+           optimizes   call Sym_2
+    93   no-op
+           optimizes label Label_62
+    93 }
+
+    94 function Sym_64 {
+    94   Reg_0 = 103
+    94   Stack_D = Reg_0
+    94   Reg_0 = 3
+    94   Stack_D = Reg_0
+    94   call Sym_1
+    94   tail call Sym_2
+           optimizes   call Sym_2
+    94   no-op
+           optimizes label Label_63
+    94 }
+
+    95 function Sym_65 {
+    95   Reg_0 = 104
+    95   Stack_D = Reg_0
+    95   Reg_0 = 3
+    95   Stack_D = Reg_0
+    95   call Sym_1
+    95   tail call Sym_2
+           optimizes   call Sym_2
+    95   no-op
+           optimizes label Label_64
+    95 }
+
+    96 function Sym_66 {
+    96   Reg_0 = 105
+    96   Stack_D = Reg_0
+    96   Reg_0 = 2
+    96   Stack_D = Reg_0
+    96   call Sym_1
+    96   tail call Sym_2
+           optimizes   call Sym_2
+    96   no-op
+           optimizes label Label_65
+    96 }
+
+    97 function Sym_67 {
+    97   Reg_0 = 106
+    97   Stack_D = Reg_0
+    97   Reg_0 = 2
+    97   Stack_D = Reg_0
+    97   call Sym_1
+    97   tail call Sym_2
+           optimizes   call Sym_2
+    97   no-op
+           optimizes label Label_66
+    97 }
+
+    98 function Sym_68 {
+    98   Reg_0 = 107
+    98   Stack_D = Reg_0
+    98   Reg_0 = 2
+    98   Stack_D = Reg_0
+    98   call Sym_1
+    98   tail call Sym_2
+           optimizes   call Sym_2
+    98   no-op
+           optimizes label Label_67
+    98 }
+
+    99 function Sym_69 {
+    99   Reg_0 = 108
+    99   Stack_D = Reg_0
+    99   Reg_0 = 2
+    99   Stack_D = Reg_0
+    99   call Sym_1
+    99   tail call Sym_2
+           optimizes   call Sym_2
+    99   no-op
+           optimizes label Label_68
+    99 }
+
+   100 function Sym_70 {
+   100   Reg_0 = 109
+   100   Stack_D = Reg_0
+   100   Reg_0 = 1
+   100   Stack_D = Reg_0
+   100   call Sym_1
+   100   tail call Sym_2
+           optimizes   call Sym_2
+   100   no-op
+           optimizes label Label_69
+   100 }
+
+   101 function Sym_71 {
+   101   Reg_0 = 114
+   101   Stack_D = Reg_0
+   101   Reg_0 = 4
+   101   Stack_D = Reg_0
+   101   call Sym_1
+   101   tail call Sym_2
+           optimizes   call Sym_2
+   101   no-op
+           optimizes label Label_70
+   101 }
+
+   102 function Sym_72 {
+   102   Reg_0 = 116
+   102   Stack_D = Reg_0
+   102   Reg_0 = 1
+   102   Stack_D = Reg_0
+   102   call Sym_1
+   102   tail call Sym_2
+           optimizes   call Sym_2
+   102   no-op
+           optimizes label Label_71
+   102 }
+
+   103 function Sym_73 {
+   103   Reg_0 = 117
+   103   Stack_D = Reg_0
+   103   Reg_0 = 1
+   103   Stack_D = Reg_0
+   103   call Sym_1
+   103   tail call Sym_2
+           optimizes   call Sym_2
+   103   no-op
+           optimizes label Label_72
+   103 }
+
+   104 function Sym_74 {
+   104   Reg_0 = 118
+   104   Stack_D = Reg_0
+   104   Reg_0 = 1
+   104   Stack_D = Reg_0
+   104   call Sym_1
+   104   tail call Sym_2
+           optimizes   call Sym_2
+   104   no-op
+           optimizes label Label_73
+   104 }
+
+   105 function Sym_75 {
+   105   Reg_0 = 120
+   105   Stack_D = Reg_0
+   105   Reg_0 = 2
+   105   Stack_D = Reg_0
+   105   call Sym_1
+   105   tail call Sym_2
+           optimizes   call Sym_2
+   105   no-op
+           optimizes label Label_74
+   105 }
+
+   106 function Sym_76 {
+   106   Reg_0 = 122
+   106   Stack_D = Reg_0
+   106   Reg_0 = 1
+   106   Stack_D = Reg_0
+   106   call Sym_1
+   106   tail call Sym_2
+           optimizes   call Sym_2
+   106   no-op
+           optimizes label Label_75
+   106 }
+
+   107 function Sym_77 {
+   107   Reg_0 = 132
+   107   Stack_D = Reg_0
+   107   Reg_0 = 1
+   107   Stack_D = Reg_0
+   107   call Sym_1
+   107   tail call Sym_2
+           optimizes   call Sym_2
+   107   no-op
+           optimizes label Label_76
+   107 }
+
+   108 function Sym_78 {
+   108   Reg_0 = 133
+   108   Stack_D = Reg_0
+   108   Reg_0 = 1
+   108   Stack_D = Reg_0
+   108   call Sym_1
+   108   tail call Sym_2
+           optimizes   call Sym_2
+   108   no-op
+           optimizes label Label_77
+   108 }
+
+   109 function Sym_79 {
+   109   Reg_0 = 136
+   109   Stack_D = Reg_0
+   109   Reg_0 = 1
+   109   Stack_D = Reg_0
+   109   call Sym_1
+   109   tail call Sym_2
+           optimizes   call Sym_2
+   109   no-op
+           optimizes label Label_78
+   109 }
+
+   110 function Sym_80 {
+   110   Reg_0 = 138
+   110   Stack_D = Reg_0
+   110   Reg_0 = 1
+   110   Stack_D = Reg_0
+   110   call Sym_1
+   110   tail call Sym_2
+           optimizes   call Sym_2
+   110   no-op
+           optimizes label Label_79
+   110 }
+
+   111 function Sym_81 {
+   111   Reg_0 = 139
+   111   Stack_D = Reg_0
+   111   Reg_0 = 1
+   111   Stack_D = Reg_0
+   111   call Sym_1
+   111   tail call Sym_2
+           optimizes   call Sym_2
+   111   no-op
+           optimizes label Label_80
+   111 }
+
+   112 function Sym_82 {
+   112   Reg_0 = 140
+   112   Stack_D = Reg_0
+   112   Reg_0 = 5
+   112   Stack_D = Reg_0
+   112   call Sym_1
+   112   tail call Sym_2
+           optimizes   call Sym_2
+   112   no-op
+           optimizes label Label_81
+   112 }
+
+   113 function Sym_83 {
+   113   Reg_0 = 141
+   113   Stack_D = Reg_0
+   113   Reg_0 = 3
+   113   Stack_D = Reg_0
+   113   call Sym_1
+   113   tail call Sym_2
+           optimizes   call Sym_2
+   113   no-op
+           optimizes label Label_82
+   113 }
+
+   114 function Sym_84 {
+   114   Reg_0 = 142
+   114   Stack_D = Reg_0
+   114   Reg_0 = 5
+   114   Stack_D = Reg_0
+   114   call Sym_1
+   114   tail call Sym_2
+           optimizes   call Sym_2
+   114   no-op
+           optimizes label Label_83
+   114 }
+
+   115 function Sym_85 {
+   115   Reg_0 = 143
+   115   Stack_D = Reg_0
+   115   Reg_0 = 2
+   115   Stack_D = Reg_0
+   115   call Sym_1
+   115   tail call Sym_2
+           optimizes   call Sym_2
+   115   no-op
+           optimizes label Label_84
+   115 }
+
+   116 function Sym_86 {
+   116   Reg_0 = 144
+   116   Stack_D = Reg_0
+   116   Reg_0 = 3
+   116   Stack_D = Reg_0
+   116   call Sym_1
+   116   tail call Sym_2
+           optimizes   call Sym_2
+   116   no-op
+           optimizes label Label_85
+   116 }
+
+   117 function Sym_87 {
+   117   Reg_0 = 145
+   117   Stack_D = Reg_0
+   117   Reg_0 = 3
+   117   Stack_D = Reg_0
+   117   call Sym_1
+   117   tail call Sym_2
+           optimizes   call Sym_2
+   117   no-op
+           optimizes label Label_86
+   117 }
+
+   118 function Sym_88 {
+   118   Reg_0 = 146
+   118   Stack_D = Reg_0
+   118   Reg_0 = 3
+   118   Stack_D = Reg_0
+   118   call Sym_1
+   118   tail call Sym_2
+           optimizes   call Sym_2
+   118   no-op
+           optimizes label Label_87
+   118 }
+
+   119 function Sym_89 {
+   119   Reg_0 = 162
+   119   Stack_D = Reg_0
+   119   Reg_0 = 2
+   119   Stack_D = Reg_0
+   119   call Sym_1
+   119   tail call Sym_2
+           optimizes   call Sym_2
+   119   no-op
+           optimizes label Label_88
+   119 }
+
+   120 function Sym_90 {
+   120   Reg_0 = 163
+   120   Stack_D = Reg_0
+   120   Reg_0 = 4
+   120   Stack_D = Reg_0
+   120   call Sym_1
+   120   tail call Sym_2
+           optimizes   call Sym_2
+   120   no-op
+           optimizes label Label_89
+   120 }
+
+   121 function Sym_91 {
+   121   Reg_0 = 164
+   121   Stack_D = Reg_0
+   121   Reg_0 = 3
+   121   Stack_D = Reg_0
+   121   call Sym_1
+   121   tail call Sym_2
+           optimizes   call Sym_2
+   121   no-op
+           optimizes label Label_90
+   121 }
+
+   122 function Sym_92 {
+   122   Reg_0 = 165
+   122   Stack_D = Reg_0
+   122   Reg_0 = 3
+   122   Stack_D = Reg_0
+   122   call Sym_1
+   122   tail call Sym_2
+           optimizes   call Sym_2
+   122   no-op
+           optimizes label Label_91
+   122 }
+
+   123 function Sym_93 {
+   123   Reg_0 = 168
+   123   Stack_D = Reg_0
+   123   Reg_0 = 3
+   123   Stack_D = Reg_0
+   123   call Sym_1
+   123   tail call Sym_2
+           optimizes   call Sym_2
+   123   no-op
+           optimizes label Label_92
+   123 }
+
+   124 function Sym_94 {
+   124   Reg_0 = 170
+   124   Stack_D = Reg_0
+   124   Reg_0 = 3
+   124   Stack_D = Reg_0
+   124   call Sym_1
+   124   tail call Sym_2
+           optimizes   call Sym_2
+   124   no-op
+           optimizes label Label_93
+   124 }
+
+   125 function Sym_95 {
+   125   Reg_0 = 171
+   125   Stack_D = Reg_0
+   125   Reg_0 = 3
+   125   Stack_D = Reg_0
+   125   call Sym_1
+   125   tail call Sym_2
+           optimizes   call Sym_2
+   125   no-op
+           optimizes label Label_94
+   125 }
+
+   126 function Sym_96 {
+   126   Reg_0 = 173
+   126   Stack_D = Reg_0
+   126   Reg_0 = 0
+   126   Stack_D = Reg_0
+   126   call Sym_1
+   126   tail call Sym_2
+           optimizes   call Sym_2
+   126   no-op
+           optimizes label Label_95
+   126 }
+
+   127 function Sym_97 {
+   127   Reg_0 = 174
+   127   Stack_D = Reg_0
+   127   Reg_0 = 3
+   127   Stack_D = Reg_0
+   127   call Sym_1
+   127   tail call Sym_2
+           optimizes   call Sym_2
+   127   no-op
+           optimizes label Label_96
+   127 }
+
+   128 function Sym_98 {
+   128   Reg_0 = 175
+   128   Stack_D = Reg_0
+   128   Reg_0 = 4
+   128   Stack_D = Reg_0
+   128   call Sym_1
+   128   tail call Sym_2
+           optimizes   call Sym_2
+   128   no-op
+           optimizes label Label_97
+   128 }
+
+   129 function Sym_99 {
+   129   Reg_0 = 176
+   129   Stack_D = Reg_0
+   129   Reg_0 = 1
+   129   Stack_D = Reg_0
+   129   call Sym_1
+   129   tail call Sym_2
+           optimizes   call Sym_2
+   129   no-op
+           optimizes label Label_98
+   129 }
+
+   130 function Sym_100 {
+   130   Reg_0 = 177
+   130   Stack_D = Reg_0
+   130   Reg_0 = 4
+   130   Stack_D = Reg_0
+   130   call Sym_1
+   130   tail call Sym_2
+           optimizes   call Sym_2
+   130   no-op
+           optimizes label Label_99
+   130 }
+
+   131 function Sym_101 {
+   131   Reg_0 = 178
+   131   Stack_D = Reg_0
+   131   Reg_0 = 3
+   131   Stack_D = Reg_0
+   131   call Sym_1
+   131   tail call Sym_2
+           optimizes   call Sym_2
+   131   no-op
+           optimizes label Label_100
+   131 }
+
+   132 function Sym_102 {
+   132   Reg_0 = 179
+   132   Stack_D = Reg_0
+   132   Reg_0 = 2
+   132   Stack_D = Reg_0
+   132   call Sym_1
+   132   tail call Sym_2
+           optimizes   call Sym_2
+   132   no-op
+           optimizes label Label_101
+   132 }
+
+   133 function Sym_103 {
+   133   Reg_0 = 180
+   133   Stack_D = Reg_0
+   133   Reg_0 = 4
+   133   Stack_D = Reg_0
+   133   call Sym_1
+   133   tail call Sym_2
+           optimizes   call Sym_2
+   133   no-op
+           optimizes label Label_102
+   133 }
+
+   134 function Sym_104 {
+   134   Reg_0 = 181
+   134   Stack_D = Reg_0
+   134   Reg_0 = 4
+   134   Stack_D = Reg_0
+   134   call Sym_1
+   134   tail call Sym_2
+           optimizes   call Sym_2
+   134   no-op
+           optimizes label Label_103
+   134 }
+
+   135 function Sym_105 {
+   135   Reg_0 = 182
+   135   Stack_D = Reg_0
+   135   Reg_0 = 3
+   135   Stack_D = Reg_0
+   135   call Sym_1
+   135   tail call Sym_2
+           optimizes   call Sym_2
+   135   no-op
+           optimizes label Label_104
+   135 }
+
+   136 function Sym_106 {
+   136   Reg_0 = 183
+   136   Stack_D = Reg_0
+   136   Reg_0 = 2
+   136   Stack_D = Reg_0
+   136   call Sym_1
+   136   tail call Sym_2
+           optimizes   call Sym_2
+   136   no-op
+           optimizes label Label_105
+   136 }
+
+   137 function Sym_107 {
+   137   Reg_0 = 186
+   137   Stack_D = Reg_0
+   137   Reg_0 = 0
+   137   Stack_D = Reg_0
+   137   call Sym_1
+   137   tail call Sym_2
+           optimizes   call Sym_2
+   137   no-op
+           optimizes label Label_106
+   137 }
+
+   138 function Sym_108 {
+   138   Reg_0 = 187
+   138   Stack_D = Reg_0
+   138   Reg_0 = 4
+   138   Stack_D = Reg_0
+   138   call Sym_1
+   138   tail call Sym_2
+           optimizes   call Sym_2
+   138   no-op
+           optimizes label Label_107
+   138 }
+
+   139 function Sym_109 {
+   139   Reg_0 = 190
+   139   Stack_D = Reg_0
+   139   Reg_0 = 0
+   139   Stack_D = Reg_0
+   139   call Sym_1
+   139   tail call Sym_2
+           optimizes   call Sym_2
+   139   no-op
+           optimizes label Label_108
+   139 }
+
+   140 function Sym_110 {
+   140   Reg_0 = 191
+   140   Stack_D = Reg_0
+   140   Reg_0 = 2
+   140   Stack_D = Reg_0
+   140   call Sym_1
+   140   tail call Sym_2
+           optimizes   call Sym_2
+   140   no-op
+           optimizes label Label_109
+   140 }
+
+   141 function Sym_111 {
+   141   Reg_0 = 192
+   141   Stack_D = Reg_0
+   141   Reg_0 = 6
+   141   Stack_D = Reg_0
+   141   call Sym_1
+   141   tail call Sym_2
+           optimizes   call Sym_2
+   141   no-op
+           optimizes label Label_110
+   141 }
+
+   142 function Sym_112 {
+   142   Reg_0 = 198
+   142   Stack_D = Reg_0
+   142   Reg_0 = 3
+   142   Stack_D = Reg_0
+   142   call Sym_1
+   142   tail call Sym_2
+           optimizes   call Sym_2
+   142   no-op
+           optimizes label Label_111
+   142 }
+
+   143 function Sym_113 {
+   143   Reg_0 = 199
+   143   Stack_D = Reg_0
+   143   Reg_0 = 0
+   143   Stack_D = Reg_0
+   143   call Sym_1
+   143   tail call Sym_2
+           optimizes   call Sym_2
+   143   no-op
+           optimizes label Label_112
+   143 }
+
+   144 function Sym_114 {
+   144   Reg_0 = 200
+   144   Stack_D = Reg_0
+   144   Reg_0 = 0
+   144   Stack_D = Reg_0
+   144   call Sym_1
+   144   tail call Sym_2
+           optimizes   call Sym_2
+   144   no-op
+           optimizes label Label_113
+   144 }
+
+   145 function Sym_115 {
+   145   Reg_0 = 201
+   145   Stack_D = Reg_0
+   145   Reg_0 = 0
+   145   Stack_D = Reg_0
+   145   call Sym_1
+   145   tail call Sym_2
+           optimizes   call Sym_2
+   145   no-op
+           optimizes label Label_114
+   145 }
+
+   146 function Sym_116 {
+   146   Reg_0 = 202
+   146   Stack_D = Reg_0
+   146   Reg_0 = 0
+   146   Stack_D = Reg_0
+   146   call Sym_1
+   146   tail call Sym_2
+           optimizes   call Sym_2
+   146   no-op
+           optimizes label Label_115
+   146 }
+
+   147 function Sym_117 {
+   147   Reg_0 = 203
+   147   Stack_D = Reg_0
+   147   Reg_0 = 2
+   147   Stack_D = Reg_0
+   147   call Sym_1
+   147   tail call Sym_2
+           optimizes   call Sym_2
+   147   no-op
+           optimizes label Label_116
+   147 }
+
+   148 function Sym_118 {
+   148   Reg_0 = 204
+   148   Stack_D = Reg_0
+   148   Reg_0 = 2
+   148   Stack_D = Reg_0
+   148   call Sym_1
+   148   tail call Sym_2
+           optimizes   call Sym_2
+   148   no-op
+           optimizes label Label_117
+   148 }
+
+   149 function Sym_119 {
+   149   Reg_0 = 205
+   149   Stack_D = Reg_0
+   149   Reg_0 = 2
+   149   Stack_D = Reg_0
+   149   call Sym_1
+   149   tail call Sym_2
+           optimizes   call Sym_2
+   149   no-op
+           optimizes label Label_118
+   149 }
+
+   150 function Sym_120 {
+   150   Reg_0 = 206
+   150   Stack_D = Reg_0
+   150   Reg_0 = 2
+   150   Stack_D = Reg_0
+   150   call Sym_1
+   150   tail call Sym_2
+           optimizes   call Sym_2
+   150   no-op
+           optimizes label Label_119
+   150 }
+
+   151 function Sym_121 {
+   151   Reg_0 = 207
+   151   Stack_D = Reg_0
+   151   Reg_0 = 3
+   151   Stack_D = Reg_0
+   151   call Sym_1
+   151   tail call Sym_2
+           optimizes   call Sym_2
+   151   no-op
+           optimizes label Label_120
+   151 }
+
+   152 function Sym_122 {
+   152   Reg_0 = 208
+   152   Stack_D = Reg_0
+   152   Reg_0 = 3
+   152   Stack_D = Reg_0
+   152   call Sym_1
+   152   tail call Sym_2
+           optimizes   call Sym_2
+   152   no-op
+           optimizes label Label_121
+   152 }
+
+   153 function Sym_123 {
+   153   Reg_0 = 209
+   153   Stack_D = Reg_0
+   153   Reg_0 = 3
+   153   Stack_D = Reg_0
+   153   call Sym_1
+   153   tail call Sym_2
+           optimizes   call Sym_2
+   153   no-op
+           optimizes label Label_122
+   153 }
+
+   154 function Sym_124 {
+   154   Reg_0 = 210
+   154   Stack_D = Reg_0
+   154   Reg_0 = 3
+   154   Stack_D = Reg_0
+   154   call Sym_1
+   154   tail call Sym_2
+           optimizes   call Sym_2
+   154   no-op
+           optimizes label Label_123
+   154 }
+
+   155 function Sym_125 {
+   155   Reg_0 = 211
+   155   Stack_D = Reg_0
+   155   Reg_0 = 3
+   155   Stack_D = Reg_0
+   155   call Sym_1
+   155   tail call Sym_2
+           optimizes   call Sym_2
+   155   no-op
+           optimizes label Label_124
+   155 }
+
+   156 function Sym_126 {
+   156   Reg_0 = 212
+   156   Stack_D = Reg_0
+   156   Reg_0 = 3
+   156   Stack_D = Reg_0
+   156   call Sym_1
+   156   tail call Sym_2
+           optimizes   call Sym_2
+   156   no-op
+           optimizes label Label_125
+   156 }
+
+   157 function Sym_127 {
+   157   Reg_0 = 213
+   157   Stack_D = Reg_0
+   157   Reg_0 = 1
+   157   Stack_D = Reg_0
+   157   call Sym_1
+   157   tail call Sym_2
+           optimizes   call Sym_2
+   157   no-op
+           optimizes label Label_126
+   157 }
+
+   158 function Sym_128 {
+   158   Reg_0 = 214
+   158   Stack_D = Reg_0
+   158   Reg_0 = 1
+   158   Stack_D = Reg_0
+   158   call Sym_1
+   158   tail call Sym_2
+           optimizes   call Sym_2
+   158   no-op
+           optimizes label Label_127
+   158 }
+
@@ -0,0 +1,5129 @@
+	.file	"syscalls.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/",100,0,0,Ltext0
+.stabs	"syscalls.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4__exit:F1",36,0,0,v4__exit
+	.weak v4__exit
+	.type	v4__exit,@function
+v4__exit:
+.stabn 68,0,32,.LMa0-v4__exit
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic0
+.Lpic0:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic0],%ebx
+0:
+.stabn 68,0,32,.LMb0-v4__exit
+.LMb0:
+.LBB0:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE0:
+.stabn 68,0,32,.LM8-v4__exit
+.LM8:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4__exit,.Lfe0-v4__exit
+.stabn	192,0,0,.LBB0-v4__exit
+.stabn	224,0,0,.LBE0-v4__exit
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4__exit
+.text
+	.align 4
+.stabs "v4__fork:F1",36,0,0,v4__fork
+	.weak v4__fork
+	.type	v4__fork,@function
+v4__fork:
+.stabn 68,0,33,.LMa9-v4__fork
+.LMa9:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic3
+.Lpic3:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic3],%ebx
+0:
+.stabn 68,0,33,.LMb9-v4__fork
+.LMb9:
+.LBB3:
+	mov $2,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE3:
+.stabn 68,0,33,.LM17-v4__fork
+.LM17:
+	pop %ebx
+	leave
+	ret
+.Lfe3:
+	.size	 v4__fork,.Lfe3-v4__fork
+.stabn	192,0,0,.LBB3-v4__fork
+.stabn	224,0,0,.LBE3-v4__fork
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4__fork
+.text
+	.align 4
+.stabs "v4__read:F1",36,0,0,v4__read
+	.weak v4__read
+	.type	v4__read,@function
+v4__read:
+.stabn 68,0,34,.LMa18-v4__read
+.LMa18:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic4
+.Lpic4:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic4],%ebx
+0:
+.stabn 68,0,34,.LMb18-v4__read
+.LMb18:
+.LBB4:
+	mov $3,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE4:
+.stabn 68,0,34,.LM26-v4__read
+.LM26:
+	pop %ebx
+	leave
+	ret
+.Lfe4:
+	.size	 v4__read,.Lfe4-v4__read
+.stabn	192,0,0,.LBB4-v4__read
+.stabn	224,0,0,.LBE4-v4__read
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4__read
+.text
+	.align 4
+.stabs "v4__write:F1",36,0,0,v4__write
+	.weak v4__write
+	.type	v4__write,@function
+v4__write:
+.stabn 68,0,35,.LMa27-v4__write
+.LMa27:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic5
+.Lpic5:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic5],%ebx
+0:
+.stabn 68,0,35,.LMb27-v4__write
+.LMb27:
+.LBB5:
+	mov $4,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE5:
+.stabn 68,0,35,.LM35-v4__write
+.LM35:
+	pop %ebx
+	leave
+	ret
+.Lfe5:
+	.size	 v4__write,.Lfe5-v4__write
+.stabn	192,0,0,.LBB5-v4__write
+.stabn	224,0,0,.LBE5-v4__write
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4__write
+.text
+	.align 4
+.stabs "v4__open:F1",36,0,0,v4__open
+	.weak v4__open
+	.type	v4__open,@function
+v4__open:
+.stabn 68,0,36,.LMa36-v4__open
+.LMa36:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic6
+.Lpic6:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic6],%ebx
+0:
+.stabn 68,0,36,.LMb36-v4__open
+.LMb36:
+.LBB6:
+	mov $5,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE6:
+.stabn 68,0,36,.LM44-v4__open
+.LM44:
+	pop %ebx
+	leave
+	ret
+.Lfe6:
+	.size	 v4__open,.Lfe6-v4__open
+.stabn	192,0,0,.LBB6-v4__open
+.stabn	224,0,0,.LBE6-v4__open
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4__open
+.text
+	.align 4
+.stabs "v4__close:F1",36,0,0,v4__close
+	.weak v4__close
+	.type	v4__close,@function
+v4__close:
+.stabn 68,0,37,.LMa45-v4__close
+.LMa45:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic7
+.Lpic7:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic7],%ebx
+0:
+.stabn 68,0,37,.LMb45-v4__close
+.LMb45:
+.LBB7:
+	mov $6,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE7:
+.stabn 68,0,37,.LM53-v4__close
+.LM53:
+	pop %ebx
+	leave
+	ret
+.Lfe7:
+	.size	 v4__close,.Lfe7-v4__close
+.stabn	192,0,0,.LBB7-v4__close
+.stabn	224,0,0,.LBE7-v4__close
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4__close
+.text
+	.align 4
+.stabs "v4__waitpid:F1",36,0,0,v4__waitpid
+	.weak v4__waitpid
+	.type	v4__waitpid,@function
+v4__waitpid:
+.stabn 68,0,38,.LMa54-v4__waitpid
+.LMa54:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic8
+.Lpic8:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic8],%ebx
+0:
+.stabn 68,0,38,.LMb54-v4__waitpid
+.LMb54:
+.LBB8:
+	mov $7,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE8:
+.stabn 68,0,38,.LM62-v4__waitpid
+.LM62:
+	pop %ebx
+	leave
+	ret
+.Lfe8:
+	.size	 v4__waitpid,.Lfe8-v4__waitpid
+.stabn	192,0,0,.LBB8-v4__waitpid
+.stabn	224,0,0,.LBE8-v4__waitpid
+.Lscope8:
+.stabs	"",36,0,0,.Lscope8-v4__waitpid
+.text
+	.align 4
+.stabs "v4__creat:F1",36,0,0,v4__creat
+	.weak v4__creat
+	.type	v4__creat,@function
+v4__creat:
+.stabn 68,0,39,.LMa63-v4__creat
+.LMa63:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic9
+.Lpic9:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic9],%ebx
+0:
+.stabn 68,0,39,.LMb63-v4__creat
+.LMb63:
+.LBB9:
+	mov $8,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE9:
+.stabn 68,0,39,.LM71-v4__creat
+.LM71:
+	pop %ebx
+	leave
+	ret
+.Lfe9:
+	.size	 v4__creat,.Lfe9-v4__creat
+.stabn	192,0,0,.LBB9-v4__creat
+.stabn	224,0,0,.LBE9-v4__creat
+.Lscope9:
+.stabs	"",36,0,0,.Lscope9-v4__creat
+.text
+	.align 4
+.stabs "v4__link:F1",36,0,0,v4__link
+	.weak v4__link
+	.type	v4__link,@function
+v4__link:
+.stabn 68,0,40,.LMa72-v4__link
+.LMa72:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic10
+.Lpic10:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic10],%ebx
+0:
+.stabn 68,0,40,.LMb72-v4__link
+.LMb72:
+.LBB10:
+	mov $9,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE10:
+.stabn 68,0,40,.LM80-v4__link
+.LM80:
+	pop %ebx
+	leave
+	ret
+.Lfe10:
+	.size	 v4__link,.Lfe10-v4__link
+.stabn	192,0,0,.LBB10-v4__link
+.stabn	224,0,0,.LBE10-v4__link
+.Lscope10:
+.stabs	"",36,0,0,.Lscope10-v4__link
+.text
+	.align 4
+.stabs "v4__unlink:F1",36,0,0,v4__unlink
+	.weak v4__unlink
+	.type	v4__unlink,@function
+v4__unlink:
+.stabn 68,0,41,.LMa81-v4__unlink
+.LMa81:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic11
+.Lpic11:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic11],%ebx
+0:
+.stabn 68,0,41,.LMb81-v4__unlink
+.LMb81:
+.LBB11:
+	mov $10,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE11:
+.stabn 68,0,41,.LM89-v4__unlink
+.LM89:
+	pop %ebx
+	leave
+	ret
+.Lfe11:
+	.size	 v4__unlink,.Lfe11-v4__unlink
+.stabn	192,0,0,.LBB11-v4__unlink
+.stabn	224,0,0,.LBE11-v4__unlink
+.Lscope11:
+.stabs	"",36,0,0,.Lscope11-v4__unlink
+.text
+	.align 4
+.stabs "v4__execve:F1",36,0,0,v4__execve
+	.weak v4__execve
+	.type	v4__execve,@function
+v4__execve:
+.stabn 68,0,42,.LMa90-v4__execve
+.LMa90:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic12
+.Lpic12:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic12],%ebx
+0:
+.stabn 68,0,42,.LMb90-v4__execve
+.LMb90:
+.LBB12:
+	mov $11,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE12:
+.stabn 68,0,42,.LM98-v4__execve
+.LM98:
+	pop %ebx
+	leave
+	ret
+.Lfe12:
+	.size	 v4__execve,.Lfe12-v4__execve
+.stabn	192,0,0,.LBB12-v4__execve
+.stabn	224,0,0,.LBE12-v4__execve
+.Lscope12:
+.stabs	"",36,0,0,.Lscope12-v4__execve
+.text
+	.align 4
+.stabs "v4__chdir:F1",36,0,0,v4__chdir
+	.weak v4__chdir
+	.type	v4__chdir,@function
+v4__chdir:
+.stabn 68,0,43,.LMa99-v4__chdir
+.LMa99:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic13
+.Lpic13:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic13],%ebx
+0:
+.stabn 68,0,43,.LMb99-v4__chdir
+.LMb99:
+.LBB13:
+	mov $12,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE13:
+.stabn 68,0,43,.LM107-v4__chdir
+.LM107:
+	pop %ebx
+	leave
+	ret
+.Lfe13:
+	.size	 v4__chdir,.Lfe13-v4__chdir
+.stabn	192,0,0,.LBB13-v4__chdir
+.stabn	224,0,0,.LBE13-v4__chdir
+.Lscope13:
+.stabs	"",36,0,0,.Lscope13-v4__chdir
+.text
+	.align 4
+.stabs "v4__time:F1",36,0,0,v4__time
+	.weak v4__time
+	.type	v4__time,@function
+v4__time:
+.stabn 68,0,44,.LMa108-v4__time
+.LMa108:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic14
+.Lpic14:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic14],%ebx
+0:
+.stabn 68,0,44,.LMb108-v4__time
+.LMb108:
+.LBB14:
+	mov $13,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE14:
+.stabn 68,0,44,.LM116-v4__time
+.LM116:
+	pop %ebx
+	leave
+	ret
+.Lfe14:
+	.size	 v4__time,.Lfe14-v4__time
+.stabn	192,0,0,.LBB14-v4__time
+.stabn	224,0,0,.LBE14-v4__time
+.Lscope14:
+.stabs	"",36,0,0,.Lscope14-v4__time
+.text
+	.align 4
+.stabs "v4__mknod:F1",36,0,0,v4__mknod
+	.weak v4__mknod
+	.type	v4__mknod,@function
+v4__mknod:
+.stabn 68,0,45,.LMa117-v4__mknod
+.LMa117:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic15
+.Lpic15:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic15],%ebx
+0:
+.stabn 68,0,45,.LMb117-v4__mknod
+.LMb117:
+.LBB15:
+	mov $14,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE15:
+.stabn 68,0,45,.LM125-v4__mknod
+.LM125:
+	pop %ebx
+	leave
+	ret
+.Lfe15:
+	.size	 v4__mknod,.Lfe15-v4__mknod
+.stabn	192,0,0,.LBB15-v4__mknod
+.stabn	224,0,0,.LBE15-v4__mknod
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4__mknod
+.text
+	.align 4
+.stabs "v4__chmod:F1",36,0,0,v4__chmod
+	.weak v4__chmod
+	.type	v4__chmod,@function
+v4__chmod:
+.stabn 68,0,46,.LMa126-v4__chmod
+.LMa126:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic16
+.Lpic16:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic16],%ebx
+0:
+.stabn 68,0,46,.LMb126-v4__chmod
+.LMb126:
+.LBB16:
+	mov $15,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE16:
+.stabn 68,0,46,.LM134-v4__chmod
+.LM134:
+	pop %ebx
+	leave
+	ret
+.Lfe16:
+	.size	 v4__chmod,.Lfe16-v4__chmod
+.stabn	192,0,0,.LBB16-v4__chmod
+.stabn	224,0,0,.LBE16-v4__chmod
+.Lscope16:
+.stabs	"",36,0,0,.Lscope16-v4__chmod
+.text
+	.align 4
+.stabs "v4__lchown16:F1",36,0,0,v4__lchown16
+	.weak v4__lchown16
+	.type	v4__lchown16,@function
+v4__lchown16:
+.stabn 68,0,47,.LMa135-v4__lchown16
+.LMa135:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic17
+.Lpic17:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic17],%ebx
+0:
+.stabn 68,0,47,.LMb135-v4__lchown16
+.LMb135:
+.LBB17:
+	mov $16,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE17:
+.stabn 68,0,47,.LM143-v4__lchown16
+.LM143:
+	pop %ebx
+	leave
+	ret
+.Lfe17:
+	.size	 v4__lchown16,.Lfe17-v4__lchown16
+.stabn	192,0,0,.LBB17-v4__lchown16
+.stabn	224,0,0,.LBE17-v4__lchown16
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-v4__lchown16
+.text
+	.align 4
+.stabs "v4__lseek:F1",36,0,0,v4__lseek
+	.weak v4__lseek
+	.type	v4__lseek,@function
+v4__lseek:
+.stabn 68,0,48,.LMa144-v4__lseek
+.LMa144:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic18
+.Lpic18:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic18],%ebx
+0:
+.stabn 68,0,48,.LMb144-v4__lseek
+.LMb144:
+.LBB18:
+	mov $19,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE18:
+.stabn 68,0,48,.LM152-v4__lseek
+.LM152:
+	pop %ebx
+	leave
+	ret
+.Lfe18:
+	.size	 v4__lseek,.Lfe18-v4__lseek
+.stabn	192,0,0,.LBB18-v4__lseek
+.stabn	224,0,0,.LBE18-v4__lseek
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4__lseek
+.text
+	.align 4
+.stabs "v4__getpid:F1",36,0,0,v4__getpid
+	.weak v4__getpid
+	.type	v4__getpid,@function
+v4__getpid:
+.stabn 68,0,49,.LMa153-v4__getpid
+.LMa153:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic19
+.Lpic19:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic19],%ebx
+0:
+.stabn 68,0,49,.LMb153-v4__getpid
+.LMb153:
+.LBB19:
+	mov $20,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE19:
+.stabn 68,0,49,.LM161-v4__getpid
+.LM161:
+	pop %ebx
+	leave
+	ret
+.Lfe19:
+	.size	 v4__getpid,.Lfe19-v4__getpid
+.stabn	192,0,0,.LBB19-v4__getpid
+.stabn	224,0,0,.LBE19-v4__getpid
+.Lscope19:
+.stabs	"",36,0,0,.Lscope19-v4__getpid
+.text
+	.align 4
+.stabs "v4__mount:F1",36,0,0,v4__mount
+	.weak v4__mount
+	.type	v4__mount,@function
+v4__mount:
+.stabn 68,0,50,.LMa162-v4__mount
+.LMa162:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic20
+.Lpic20:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic20],%ebx
+0:
+.stabn 68,0,50,.LMb162-v4__mount
+.LMb162:
+.LBB20:
+	mov $21,%eax
+	call v4__dpush@PLT
+	mov $5,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE20:
+.stabn 68,0,50,.LM170-v4__mount
+.LM170:
+	pop %ebx
+	leave
+	ret
+.Lfe20:
+	.size	 v4__mount,.Lfe20-v4__mount
+.stabn	192,0,0,.LBB20-v4__mount
+.stabn	224,0,0,.LBE20-v4__mount
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4__mount
+.text
+	.align 4
+.stabs "v4__setuid16:F1",36,0,0,v4__setuid16
+	.weak v4__setuid16
+	.type	v4__setuid16,@function
+v4__setuid16:
+.stabn 68,0,51,.LMa171-v4__setuid16
+.LMa171:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic21
+.Lpic21:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic21],%ebx
+0:
+.stabn 68,0,51,.LMb171-v4__setuid16
+.LMb171:
+.LBB21:
+	mov $23,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE21:
+.stabn 68,0,51,.LM179-v4__setuid16
+.LM179:
+	pop %ebx
+	leave
+	ret
+.Lfe21:
+	.size	 v4__setuid16,.Lfe21-v4__setuid16
+.stabn	192,0,0,.LBB21-v4__setuid16
+.stabn	224,0,0,.LBE21-v4__setuid16
+.Lscope21:
+.stabs	"",36,0,0,.Lscope21-v4__setuid16
+.text
+	.align 4
+.stabs "v4__getuid16:F1",36,0,0,v4__getuid16
+	.weak v4__getuid16
+	.type	v4__getuid16,@function
+v4__getuid16:
+.stabn 68,0,52,.LMa180-v4__getuid16
+.LMa180:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic22
+.Lpic22:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic22],%ebx
+0:
+.stabn 68,0,52,.LMb180-v4__getuid16
+.LMb180:
+.LBB22:
+	mov $24,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE22:
+.stabn 68,0,52,.LM188-v4__getuid16
+.LM188:
+	pop %ebx
+	leave
+	ret
+.Lfe22:
+	.size	 v4__getuid16,.Lfe22-v4__getuid16
+.stabn	192,0,0,.LBB22-v4__getuid16
+.stabn	224,0,0,.LBE22-v4__getuid16
+.Lscope22:
+.stabs	"",36,0,0,.Lscope22-v4__getuid16
+.text
+	.align 4
+.stabs "v4__stime:F1",36,0,0,v4__stime
+	.weak v4__stime
+	.type	v4__stime,@function
+v4__stime:
+.stabn 68,0,53,.LMa189-v4__stime
+.LMa189:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic23
+.Lpic23:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic23],%ebx
+0:
+.stabn 68,0,53,.LMb189-v4__stime
+.LMb189:
+.LBB23:
+	mov $25,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE23:
+.stabn 68,0,53,.LM197-v4__stime
+.LM197:
+	pop %ebx
+	leave
+	ret
+.Lfe23:
+	.size	 v4__stime,.Lfe23-v4__stime
+.stabn	192,0,0,.LBB23-v4__stime
+.stabn	224,0,0,.LBE23-v4__stime
+.Lscope23:
+.stabs	"",36,0,0,.Lscope23-v4__stime
+.text
+	.align 4
+.stabs "v4__alarm:F1",36,0,0,v4__alarm
+	.weak v4__alarm
+	.type	v4__alarm,@function
+v4__alarm:
+.stabn 68,0,54,.LMa198-v4__alarm
+.LMa198:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic24
+.Lpic24:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic24],%ebx
+0:
+.stabn 68,0,54,.LMb198-v4__alarm
+.LMb198:
+.LBB24:
+	mov $27,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE24:
+.stabn 68,0,54,.LM206-v4__alarm
+.LM206:
+	pop %ebx
+	leave
+	ret
+.Lfe24:
+	.size	 v4__alarm,.Lfe24-v4__alarm
+.stabn	192,0,0,.LBB24-v4__alarm
+.stabn	224,0,0,.LBE24-v4__alarm
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4__alarm
+.text
+	.align 4
+.stabs "v4__pause:F1",36,0,0,v4__pause
+	.weak v4__pause
+	.type	v4__pause,@function
+v4__pause:
+.stabn 68,0,55,.LMa207-v4__pause
+.LMa207:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic25
+.Lpic25:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic25],%ebx
+0:
+.stabn 68,0,55,.LMb207-v4__pause
+.LMb207:
+.LBB25:
+	mov $29,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE25:
+.stabn 68,0,55,.LM215-v4__pause
+.LM215:
+	pop %ebx
+	leave
+	ret
+.Lfe25:
+	.size	 v4__pause,.Lfe25-v4__pause
+.stabn	192,0,0,.LBB25-v4__pause
+.stabn	224,0,0,.LBE25-v4__pause
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4__pause
+.text
+	.align 4
+.stabs "v4__utime:F1",36,0,0,v4__utime
+	.weak v4__utime
+	.type	v4__utime,@function
+v4__utime:
+.stabn 68,0,56,.LMa216-v4__utime
+.LMa216:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic26
+.Lpic26:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic26],%ebx
+0:
+.stabn 68,0,56,.LMb216-v4__utime
+.LMb216:
+.LBB26:
+	mov $30,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE26:
+.stabn 68,0,56,.LM224-v4__utime
+.LM224:
+	pop %ebx
+	leave
+	ret
+.Lfe26:
+	.size	 v4__utime,.Lfe26-v4__utime
+.stabn	192,0,0,.LBB26-v4__utime
+.stabn	224,0,0,.LBE26-v4__utime
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4__utime
+.text
+	.align 4
+.stabs "v4__access:F1",36,0,0,v4__access
+	.weak v4__access
+	.type	v4__access,@function
+v4__access:
+.stabn 68,0,57,.LMa225-v4__access
+.LMa225:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic27
+.Lpic27:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic27],%ebx
+0:
+.stabn 68,0,57,.LMb225-v4__access
+.LMb225:
+.LBB27:
+	mov $33,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE27:
+.stabn 68,0,57,.LM233-v4__access
+.LM233:
+	pop %ebx
+	leave
+	ret
+.Lfe27:
+	.size	 v4__access,.Lfe27-v4__access
+.stabn	192,0,0,.LBB27-v4__access
+.stabn	224,0,0,.LBE27-v4__access
+.Lscope27:
+.stabs	"",36,0,0,.Lscope27-v4__access
+.text
+	.align 4
+.stabs "v4__nice:F1",36,0,0,v4__nice
+	.weak v4__nice
+	.type	v4__nice,@function
+v4__nice:
+.stabn 68,0,58,.LMa234-v4__nice
+.LMa234:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic28
+.Lpic28:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic28],%ebx
+0:
+.stabn 68,0,58,.LMb234-v4__nice
+.LMb234:
+.LBB28:
+	mov $34,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE28:
+.stabn 68,0,58,.LM242-v4__nice
+.LM242:
+	pop %ebx
+	leave
+	ret
+.Lfe28:
+	.size	 v4__nice,.Lfe28-v4__nice
+.stabn	192,0,0,.LBB28-v4__nice
+.stabn	224,0,0,.LBE28-v4__nice
+.Lscope28:
+.stabs	"",36,0,0,.Lscope28-v4__nice
+.text
+	.align 4
+.stabs "v4__kill:F1",36,0,0,v4__kill
+	.weak v4__kill
+	.type	v4__kill,@function
+v4__kill:
+.stabn 68,0,59,.LMa243-v4__kill
+.LMa243:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic29
+.Lpic29:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic29],%ebx
+0:
+.stabn 68,0,59,.LMb243-v4__kill
+.LMb243:
+.LBB29:
+	mov $37,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE29:
+.stabn 68,0,59,.LM251-v4__kill
+.LM251:
+	pop %ebx
+	leave
+	ret
+.Lfe29:
+	.size	 v4__kill,.Lfe29-v4__kill
+.stabn	192,0,0,.LBB29-v4__kill
+.stabn	224,0,0,.LBE29-v4__kill
+.Lscope29:
+.stabs	"",36,0,0,.Lscope29-v4__kill
+.text
+	.align 4
+.stabs "v4__rename:F1",36,0,0,v4__rename
+	.weak v4__rename
+	.type	v4__rename,@function
+v4__rename:
+.stabn 68,0,60,.LMa252-v4__rename
+.LMa252:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic30
+.Lpic30:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic30],%ebx
+0:
+.stabn 68,0,60,.LMb252-v4__rename
+.LMb252:
+.LBB30:
+	mov $38,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE30:
+.stabn 68,0,60,.LM260-v4__rename
+.LM260:
+	pop %ebx
+	leave
+	ret
+.Lfe30:
+	.size	 v4__rename,.Lfe30-v4__rename
+.stabn	192,0,0,.LBB30-v4__rename
+.stabn	224,0,0,.LBE30-v4__rename
+.Lscope30:
+.stabs	"",36,0,0,.Lscope30-v4__rename
+.text
+	.align 4
+.stabs "v4__mkdir:F1",36,0,0,v4__mkdir
+	.weak v4__mkdir
+	.type	v4__mkdir,@function
+v4__mkdir:
+.stabn 68,0,61,.LMa261-v4__mkdir
+.LMa261:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic31
+.Lpic31:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic31],%ebx
+0:
+.stabn 68,0,61,.LMb261-v4__mkdir
+.LMb261:
+.LBB31:
+	mov $39,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE31:
+.stabn 68,0,61,.LM269-v4__mkdir
+.LM269:
+	pop %ebx
+	leave
+	ret
+.Lfe31:
+	.size	 v4__mkdir,.Lfe31-v4__mkdir
+.stabn	192,0,0,.LBB31-v4__mkdir
+.stabn	224,0,0,.LBE31-v4__mkdir
+.Lscope31:
+.stabs	"",36,0,0,.Lscope31-v4__mkdir
+.text
+	.align 4
+.stabs "v4__rmdir:F1",36,0,0,v4__rmdir
+	.weak v4__rmdir
+	.type	v4__rmdir,@function
+v4__rmdir:
+.stabn 68,0,62,.LMa270-v4__rmdir
+.LMa270:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic32
+.Lpic32:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic32],%ebx
+0:
+.stabn 68,0,62,.LMb270-v4__rmdir
+.LMb270:
+.LBB32:
+	mov $40,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE32:
+.stabn 68,0,62,.LM278-v4__rmdir
+.LM278:
+	pop %ebx
+	leave
+	ret
+.Lfe32:
+	.size	 v4__rmdir,.Lfe32-v4__rmdir
+.stabn	192,0,0,.LBB32-v4__rmdir
+.stabn	224,0,0,.LBE32-v4__rmdir
+.Lscope32:
+.stabs	"",36,0,0,.Lscope32-v4__rmdir
+.text
+	.align 4
+.stabs "v4__dup:F1",36,0,0,v4__dup
+	.weak v4__dup
+	.type	v4__dup,@function
+v4__dup:
+.stabn 68,0,63,.LMa279-v4__dup
+.LMa279:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic33
+.Lpic33:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic33],%ebx
+0:
+.stabn 68,0,63,.LMb279-v4__dup
+.LMb279:
+.LBB33:
+	mov $41,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE33:
+.stabn 68,0,63,.LM287-v4__dup
+.LM287:
+	pop %ebx
+	leave
+	ret
+.Lfe33:
+	.size	 v4__dup,.Lfe33-v4__dup
+.stabn	192,0,0,.LBB33-v4__dup
+.stabn	224,0,0,.LBE33-v4__dup
+.Lscope33:
+.stabs	"",36,0,0,.Lscope33-v4__dup
+.text
+	.align 4
+.stabs "v4__pipe:F1",36,0,0,v4__pipe
+	.weak v4__pipe
+	.type	v4__pipe,@function
+v4__pipe:
+.stabn 68,0,64,.LMa288-v4__pipe
+.LMa288:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic34
+.Lpic34:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic34],%ebx
+0:
+.stabn 68,0,64,.LMb288-v4__pipe
+.LMb288:
+.LBB34:
+	mov $42,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE34:
+.stabn 68,0,64,.LM296-v4__pipe
+.LM296:
+	pop %ebx
+	leave
+	ret
+.Lfe34:
+	.size	 v4__pipe,.Lfe34-v4__pipe
+.stabn	192,0,0,.LBB34-v4__pipe
+.stabn	224,0,0,.LBE34-v4__pipe
+.Lscope34:
+.stabs	"",36,0,0,.Lscope34-v4__pipe
+.text
+	.align 4
+.stabs "v4__times:F1",36,0,0,v4__times
+	.weak v4__times
+	.type	v4__times,@function
+v4__times:
+.stabn 68,0,65,.LMa297-v4__times
+.LMa297:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic35
+.Lpic35:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic35],%ebx
+0:
+.stabn 68,0,65,.LMb297-v4__times
+.LMb297:
+.LBB35:
+	mov $43,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE35:
+.stabn 68,0,65,.LM305-v4__times
+.LM305:
+	pop %ebx
+	leave
+	ret
+.Lfe35:
+	.size	 v4__times,.Lfe35-v4__times
+.stabn	192,0,0,.LBB35-v4__times
+.stabn	224,0,0,.LBE35-v4__times
+.Lscope35:
+.stabs	"",36,0,0,.Lscope35-v4__times
+.text
+	.align 4
+.stabs "v4__brk:F1",36,0,0,v4__brk
+	.weak v4__brk
+	.type	v4__brk,@function
+v4__brk:
+.stabn 68,0,66,.LMa306-v4__brk
+.LMa306:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic36
+.Lpic36:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic36],%ebx
+0:
+.stabn 68,0,66,.LMb306-v4__brk
+.LMb306:
+.LBB36:
+	mov $45,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE36:
+.stabn 68,0,66,.LM314-v4__brk
+.LM314:
+	pop %ebx
+	leave
+	ret
+.Lfe36:
+	.size	 v4__brk,.Lfe36-v4__brk
+.stabn	192,0,0,.LBB36-v4__brk
+.stabn	224,0,0,.LBE36-v4__brk
+.Lscope36:
+.stabs	"",36,0,0,.Lscope36-v4__brk
+.text
+	.align 4
+.stabs "v4__setgid16:F1",36,0,0,v4__setgid16
+	.weak v4__setgid16
+	.type	v4__setgid16,@function
+v4__setgid16:
+.stabn 68,0,67,.LMa315-v4__setgid16
+.LMa315:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic37
+.Lpic37:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic37],%ebx
+0:
+.stabn 68,0,67,.LMb315-v4__setgid16
+.LMb315:
+.LBB37:
+	mov $46,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE37:
+.stabn 68,0,67,.LM323-v4__setgid16
+.LM323:
+	pop %ebx
+	leave
+	ret
+.Lfe37:
+	.size	 v4__setgid16,.Lfe37-v4__setgid16
+.stabn	192,0,0,.LBB37-v4__setgid16
+.stabn	224,0,0,.LBE37-v4__setgid16
+.Lscope37:
+.stabs	"",36,0,0,.Lscope37-v4__setgid16
+.text
+	.align 4
+.stabs "v4__getgid16:F1",36,0,0,v4__getgid16
+	.weak v4__getgid16
+	.type	v4__getgid16,@function
+v4__getgid16:
+.stabn 68,0,68,.LMa324-v4__getgid16
+.LMa324:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic38
+.Lpic38:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic38],%ebx
+0:
+.stabn 68,0,68,.LMb324-v4__getgid16
+.LMb324:
+.LBB38:
+	mov $47,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE38:
+.stabn 68,0,68,.LM332-v4__getgid16
+.LM332:
+	pop %ebx
+	leave
+	ret
+.Lfe38:
+	.size	 v4__getgid16,.Lfe38-v4__getgid16
+.stabn	192,0,0,.LBB38-v4__getgid16
+.stabn	224,0,0,.LBE38-v4__getgid16
+.Lscope38:
+.stabs	"",36,0,0,.Lscope38-v4__getgid16
+.text
+	.align 4
+.stabs "v4__signal:F1",36,0,0,v4__signal
+	.weak v4__signal
+	.type	v4__signal,@function
+v4__signal:
+.stabn 68,0,69,.LMa333-v4__signal
+.LMa333:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic39
+.Lpic39:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic39],%ebx
+0:
+.stabn 68,0,69,.LMb333-v4__signal
+.LMb333:
+.LBB39:
+	mov $48,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE39:
+.stabn 68,0,69,.LM341-v4__signal
+.LM341:
+	pop %ebx
+	leave
+	ret
+.Lfe39:
+	.size	 v4__signal,.Lfe39-v4__signal
+.stabn	192,0,0,.LBB39-v4__signal
+.stabn	224,0,0,.LBE39-v4__signal
+.Lscope39:
+.stabs	"",36,0,0,.Lscope39-v4__signal
+.text
+	.align 4
+.stabs "v4__geteuid16:F1",36,0,0,v4__geteuid16
+	.weak v4__geteuid16
+	.type	v4__geteuid16,@function
+v4__geteuid16:
+.stabn 68,0,70,.LMa342-v4__geteuid16
+.LMa342:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic40
+.Lpic40:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic40],%ebx
+0:
+.stabn 68,0,70,.LMb342-v4__geteuid16
+.LMb342:
+.LBB40:
+	mov $49,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE40:
+.stabn 68,0,70,.LM350-v4__geteuid16
+.LM350:
+	pop %ebx
+	leave
+	ret
+.Lfe40:
+	.size	 v4__geteuid16,.Lfe40-v4__geteuid16
+.stabn	192,0,0,.LBB40-v4__geteuid16
+.stabn	224,0,0,.LBE40-v4__geteuid16
+.Lscope40:
+.stabs	"",36,0,0,.Lscope40-v4__geteuid16
+.text
+	.align 4
+.stabs "v4__getegid16:F1",36,0,0,v4__getegid16
+	.weak v4__getegid16
+	.type	v4__getegid16,@function
+v4__getegid16:
+.stabn 68,0,71,.LMa351-v4__getegid16
+.LMa351:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic41
+.Lpic41:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic41],%ebx
+0:
+.stabn 68,0,71,.LMb351-v4__getegid16
+.LMb351:
+.LBB41:
+	mov $50,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE41:
+.stabn 68,0,71,.LM359-v4__getegid16
+.LM359:
+	pop %ebx
+	leave
+	ret
+.Lfe41:
+	.size	 v4__getegid16,.Lfe41-v4__getegid16
+.stabn	192,0,0,.LBB41-v4__getegid16
+.stabn	224,0,0,.LBE41-v4__getegid16
+.Lscope41:
+.stabs	"",36,0,0,.Lscope41-v4__getegid16
+.text
+	.align 4
+.stabs "v4__ioctl:F1",36,0,0,v4__ioctl
+	.weak v4__ioctl
+	.type	v4__ioctl,@function
+v4__ioctl:
+.stabn 68,0,72,.LMa360-v4__ioctl
+.LMa360:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic42
+.Lpic42:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic42],%ebx
+0:
+.stabn 68,0,72,.LMb360-v4__ioctl
+.LMb360:
+.LBB42:
+	mov $54,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE42:
+.stabn 68,0,72,.LM368-v4__ioctl
+.LM368:
+	pop %ebx
+	leave
+	ret
+.Lfe42:
+	.size	 v4__ioctl,.Lfe42-v4__ioctl
+.stabn	192,0,0,.LBB42-v4__ioctl
+.stabn	224,0,0,.LBE42-v4__ioctl
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4__ioctl
+.text
+	.align 4
+.stabs "v4__fcntl:F1",36,0,0,v4__fcntl
+	.weak v4__fcntl
+	.type	v4__fcntl,@function
+v4__fcntl:
+.stabn 68,0,73,.LMa369-v4__fcntl
+.LMa369:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic43
+.Lpic43:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic43],%ebx
+0:
+.stabn 68,0,73,.LMb369-v4__fcntl
+.LMb369:
+.LBB43:
+	mov $55,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE43:
+.stabn 68,0,73,.LM377-v4__fcntl
+.LM377:
+	pop %ebx
+	leave
+	ret
+.Lfe43:
+	.size	 v4__fcntl,.Lfe43-v4__fcntl
+.stabn	192,0,0,.LBB43-v4__fcntl
+.stabn	224,0,0,.LBE43-v4__fcntl
+.Lscope43:
+.stabs	"",36,0,0,.Lscope43-v4__fcntl
+.text
+	.align 4
+.stabs "v4__setpgid:F1",36,0,0,v4__setpgid
+	.weak v4__setpgid
+	.type	v4__setpgid,@function
+v4__setpgid:
+.stabn 68,0,74,.LMa378-v4__setpgid
+.LMa378:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic44
+.Lpic44:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic44],%ebx
+0:
+.stabn 68,0,74,.LMb378-v4__setpgid
+.LMb378:
+.LBB44:
+	mov $57,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE44:
+.stabn 68,0,74,.LM386-v4__setpgid
+.LM386:
+	pop %ebx
+	leave
+	ret
+.Lfe44:
+	.size	 v4__setpgid,.Lfe44-v4__setpgid
+.stabn	192,0,0,.LBB44-v4__setpgid
+.stabn	224,0,0,.LBE44-v4__setpgid
+.Lscope44:
+.stabs	"",36,0,0,.Lscope44-v4__setpgid
+.text
+	.align 4
+.stabs "v4__umask:F1",36,0,0,v4__umask
+	.weak v4__umask
+	.type	v4__umask,@function
+v4__umask:
+.stabn 68,0,75,.LMa387-v4__umask
+.LMa387:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic45
+.Lpic45:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic45],%ebx
+0:
+.stabn 68,0,75,.LMb387-v4__umask
+.LMb387:
+.LBB45:
+	mov $60,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE45:
+.stabn 68,0,75,.LM395-v4__umask
+.LM395:
+	pop %ebx
+	leave
+	ret
+.Lfe45:
+	.size	 v4__umask,.Lfe45-v4__umask
+.stabn	192,0,0,.LBB45-v4__umask
+.stabn	224,0,0,.LBE45-v4__umask
+.Lscope45:
+.stabs	"",36,0,0,.Lscope45-v4__umask
+.text
+	.align 4
+.stabs "v4__chroot:F1",36,0,0,v4__chroot
+	.weak v4__chroot
+	.type	v4__chroot,@function
+v4__chroot:
+.stabn 68,0,76,.LMa396-v4__chroot
+.LMa396:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic46
+.Lpic46:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic46],%ebx
+0:
+.stabn 68,0,76,.LMb396-v4__chroot
+.LMb396:
+.LBB46:
+	mov $61,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE46:
+.stabn 68,0,76,.LM404-v4__chroot
+.LM404:
+	pop %ebx
+	leave
+	ret
+.Lfe46:
+	.size	 v4__chroot,.Lfe46-v4__chroot
+.stabn	192,0,0,.LBB46-v4__chroot
+.stabn	224,0,0,.LBE46-v4__chroot
+.Lscope46:
+.stabs	"",36,0,0,.Lscope46-v4__chroot
+.text
+	.align 4
+.stabs "v4__dup2:F1",36,0,0,v4__dup2
+	.weak v4__dup2
+	.type	v4__dup2,@function
+v4__dup2:
+.stabn 68,0,77,.LMa405-v4__dup2
+.LMa405:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic47
+.Lpic47:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic47],%ebx
+0:
+.stabn 68,0,77,.LMb405-v4__dup2
+.LMb405:
+.LBB47:
+	mov $63,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE47:
+.stabn 68,0,77,.LM413-v4__dup2
+.LM413:
+	pop %ebx
+	leave
+	ret
+.Lfe47:
+	.size	 v4__dup2,.Lfe47-v4__dup2
+.stabn	192,0,0,.LBB47-v4__dup2
+.stabn	224,0,0,.LBE47-v4__dup2
+.Lscope47:
+.stabs	"",36,0,0,.Lscope47-v4__dup2
+.text
+	.align 4
+.stabs "v4__getppid:F1",36,0,0,v4__getppid
+	.weak v4__getppid
+	.type	v4__getppid,@function
+v4__getppid:
+.stabn 68,0,78,.LMa414-v4__getppid
+.LMa414:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic48
+.Lpic48:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic48],%ebx
+0:
+.stabn 68,0,78,.LMb414-v4__getppid
+.LMb414:
+.LBB48:
+	mov $64,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE48:
+.stabn 68,0,78,.LM422-v4__getppid
+.LM422:
+	pop %ebx
+	leave
+	ret
+.Lfe48:
+	.size	 v4__getppid,.Lfe48-v4__getppid
+.stabn	192,0,0,.LBB48-v4__getppid
+.stabn	224,0,0,.LBE48-v4__getppid
+.Lscope48:
+.stabs	"",36,0,0,.Lscope48-v4__getppid
+.text
+	.align 4
+.stabs "v4__getpgrp:F1",36,0,0,v4__getpgrp
+	.weak v4__getpgrp
+	.type	v4__getpgrp,@function
+v4__getpgrp:
+.stabn 68,0,79,.LMa423-v4__getpgrp
+.LMa423:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic49
+.Lpic49:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic49],%ebx
+0:
+.stabn 68,0,79,.LMb423-v4__getpgrp
+.LMb423:
+.LBB49:
+	mov $65,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE49:
+.stabn 68,0,79,.LM431-v4__getpgrp
+.LM431:
+	pop %ebx
+	leave
+	ret
+.Lfe49:
+	.size	 v4__getpgrp,.Lfe49-v4__getpgrp
+.stabn	192,0,0,.LBB49-v4__getpgrp
+.stabn	224,0,0,.LBE49-v4__getpgrp
+.Lscope49:
+.stabs	"",36,0,0,.Lscope49-v4__getpgrp
+.text
+	.align 4
+.stabs "v4__setsid:F1",36,0,0,v4__setsid
+	.weak v4__setsid
+	.type	v4__setsid,@function
+v4__setsid:
+.stabn 68,0,80,.LMa432-v4__setsid
+.LMa432:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic50
+.Lpic50:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic50],%ebx
+0:
+.stabn 68,0,80,.LMb432-v4__setsid
+.LMb432:
+.LBB50:
+	mov $66,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE50:
+.stabn 68,0,80,.LM440-v4__setsid
+.LM440:
+	pop %ebx
+	leave
+	ret
+.Lfe50:
+	.size	 v4__setsid,.Lfe50-v4__setsid
+.stabn	192,0,0,.LBB50-v4__setsid
+.stabn	224,0,0,.LBE50-v4__setsid
+.Lscope50:
+.stabs	"",36,0,0,.Lscope50-v4__setsid
+.text
+	.align 4
+.stabs "v4__setreuid16:F1",36,0,0,v4__setreuid16
+	.weak v4__setreuid16
+	.type	v4__setreuid16,@function
+v4__setreuid16:
+.stabn 68,0,81,.LMa441-v4__setreuid16
+.LMa441:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic51
+.Lpic51:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic51],%ebx
+0:
+.stabn 68,0,81,.LMb441-v4__setreuid16
+.LMb441:
+.LBB51:
+	mov $70,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE51:
+.stabn 68,0,81,.LM449-v4__setreuid16
+.LM449:
+	pop %ebx
+	leave
+	ret
+.Lfe51:
+	.size	 v4__setreuid16,.Lfe51-v4__setreuid16
+.stabn	192,0,0,.LBB51-v4__setreuid16
+.stabn	224,0,0,.LBE51-v4__setreuid16
+.Lscope51:
+.stabs	"",36,0,0,.Lscope51-v4__setreuid16
+.text
+	.align 4
+.stabs "v4__setregid16:F1",36,0,0,v4__setregid16
+	.weak v4__setregid16
+	.type	v4__setregid16,@function
+v4__setregid16:
+.stabn 68,0,82,.LMa450-v4__setregid16
+.LMa450:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic52
+.Lpic52:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic52],%ebx
+0:
+.stabn 68,0,82,.LMb450-v4__setregid16
+.LMb450:
+.LBB52:
+	mov $71,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE52:
+.stabn 68,0,82,.LM458-v4__setregid16
+.LM458:
+	pop %ebx
+	leave
+	ret
+.Lfe52:
+	.size	 v4__setregid16,.Lfe52-v4__setregid16
+.stabn	192,0,0,.LBB52-v4__setregid16
+.stabn	224,0,0,.LBE52-v4__setregid16
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4__setregid16
+.text
+	.align 4
+.stabs "v4__symlink:F1",36,0,0,v4__symlink
+	.weak v4__symlink
+	.type	v4__symlink,@function
+v4__symlink:
+.stabn 68,0,83,.LMa459-v4__symlink
+.LMa459:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic53
+.Lpic53:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic53],%ebx
+0:
+.stabn 68,0,83,.LMb459-v4__symlink
+.LMb459:
+.LBB53:
+	mov $83,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE53:
+.stabn 68,0,83,.LM467-v4__symlink
+.LM467:
+	pop %ebx
+	leave
+	ret
+.Lfe53:
+	.size	 v4__symlink,.Lfe53-v4__symlink
+.stabn	192,0,0,.LBB53-v4__symlink
+.stabn	224,0,0,.LBE53-v4__symlink
+.Lscope53:
+.stabs	"",36,0,0,.Lscope53-v4__symlink
+.text
+	.align 4
+.stabs "v4__readlink:F1",36,0,0,v4__readlink
+	.weak v4__readlink
+	.type	v4__readlink,@function
+v4__readlink:
+.stabn 68,0,84,.LMa468-v4__readlink
+.LMa468:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic54
+.Lpic54:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic54],%ebx
+0:
+.stabn 68,0,84,.LMb468-v4__readlink
+.LMb468:
+.LBB54:
+	mov $85,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE54:
+.stabn 68,0,84,.LM476-v4__readlink
+.LM476:
+	pop %ebx
+	leave
+	ret
+.Lfe54:
+	.size	 v4__readlink,.Lfe54-v4__readlink
+.stabn	192,0,0,.LBB54-v4__readlink
+.stabn	224,0,0,.LBE54-v4__readlink
+.Lscope54:
+.stabs	"",36,0,0,.Lscope54-v4__readlink
+.text
+	.align 4
+.stabs "v4__readdir:F1",36,0,0,v4__readdir
+	.weak v4__readdir
+	.type	v4__readdir,@function
+v4__readdir:
+.stabn 68,0,85,.LMa477-v4__readdir
+.LMa477:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic55
+.Lpic55:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic55],%ebx
+0:
+.stabn 68,0,85,.LMb477-v4__readdir
+.LMb477:
+.LBB55:
+	mov $89,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE55:
+.stabn 68,0,85,.LM485-v4__readdir
+.LM485:
+	pop %ebx
+	leave
+	ret
+.Lfe55:
+	.size	 v4__readdir,.Lfe55-v4__readdir
+.stabn	192,0,0,.LBB55-v4__readdir
+.stabn	224,0,0,.LBE55-v4__readdir
+.Lscope55:
+.stabs	"",36,0,0,.Lscope55-v4__readdir
+.text
+	.align 4
+.stabs "v4__munmap:F1",36,0,0,v4__munmap
+	.weak v4__munmap
+	.type	v4__munmap,@function
+v4__munmap:
+.stabn 68,0,86,.LMa486-v4__munmap
+.LMa486:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic56
+.Lpic56:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic56],%ebx
+0:
+.stabn 68,0,86,.LMb486-v4__munmap
+.LMb486:
+.LBB56:
+	mov $91,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE56:
+.stabn 68,0,86,.LM494-v4__munmap
+.LM494:
+	pop %ebx
+	leave
+	ret
+.Lfe56:
+	.size	 v4__munmap,.Lfe56-v4__munmap
+.stabn	192,0,0,.LBB56-v4__munmap
+.stabn	224,0,0,.LBE56-v4__munmap
+.Lscope56:
+.stabs	"",36,0,0,.Lscope56-v4__munmap
+.text
+	.align 4
+.stabs "v4__truncate:F1",36,0,0,v4__truncate
+	.weak v4__truncate
+	.type	v4__truncate,@function
+v4__truncate:
+.stabn 68,0,87,.LMa495-v4__truncate
+.LMa495:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic57
+.Lpic57:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic57],%ebx
+0:
+.stabn 68,0,87,.LMb495-v4__truncate
+.LMb495:
+.LBB57:
+	mov $92,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE57:
+.stabn 68,0,87,.LM503-v4__truncate
+.LM503:
+	pop %ebx
+	leave
+	ret
+.Lfe57:
+	.size	 v4__truncate,.Lfe57-v4__truncate
+.stabn	192,0,0,.LBB57-v4__truncate
+.stabn	224,0,0,.LBE57-v4__truncate
+.Lscope57:
+.stabs	"",36,0,0,.Lscope57-v4__truncate
+.text
+	.align 4
+.stabs "v4__ftruncate:F1",36,0,0,v4__ftruncate
+	.weak v4__ftruncate
+	.type	v4__ftruncate,@function
+v4__ftruncate:
+.stabn 68,0,88,.LMa504-v4__ftruncate
+.LMa504:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic58
+.Lpic58:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic58],%ebx
+0:
+.stabn 68,0,88,.LMb504-v4__ftruncate
+.LMb504:
+.LBB58:
+	mov $93,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE58:
+.stabn 68,0,88,.LM512-v4__ftruncate
+.LM512:
+	pop %ebx
+	leave
+	ret
+.Lfe58:
+	.size	 v4__ftruncate,.Lfe58-v4__ftruncate
+.stabn	192,0,0,.LBB58-v4__ftruncate
+.stabn	224,0,0,.LBE58-v4__ftruncate
+.Lscope58:
+.stabs	"",36,0,0,.Lscope58-v4__ftruncate
+.text
+	.align 4
+.stabs "v4__fchmod:F1",36,0,0,v4__fchmod
+	.weak v4__fchmod
+	.type	v4__fchmod,@function
+v4__fchmod:
+.stabn 68,0,89,.LMa513-v4__fchmod
+.LMa513:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic59
+.Lpic59:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic59],%ebx
+0:
+.stabn 68,0,89,.LMb513-v4__fchmod
+.LMb513:
+.LBB59:
+	mov $94,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE59:
+.stabn 68,0,89,.LM521-v4__fchmod
+.LM521:
+	pop %ebx
+	leave
+	ret
+.Lfe59:
+	.size	 v4__fchmod,.Lfe59-v4__fchmod
+.stabn	192,0,0,.LBB59-v4__fchmod
+.stabn	224,0,0,.LBE59-v4__fchmod
+.Lscope59:
+.stabs	"",36,0,0,.Lscope59-v4__fchmod
+.text
+	.align 4
+.stabs "v4__fchown16:F1",36,0,0,v4__fchown16
+	.weak v4__fchown16
+	.type	v4__fchown16,@function
+v4__fchown16:
+.stabn 68,0,90,.LMa522-v4__fchown16
+.LMa522:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic60
+.Lpic60:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic60],%ebx
+0:
+.stabn 68,0,90,.LMb522-v4__fchown16
+.LMb522:
+.LBB60:
+	mov $95,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE60:
+.stabn 68,0,90,.LM530-v4__fchown16
+.LM530:
+	pop %ebx
+	leave
+	ret
+.Lfe60:
+	.size	 v4__fchown16,.Lfe60-v4__fchown16
+.stabn	192,0,0,.LBB60-v4__fchown16
+.stabn	224,0,0,.LBE60-v4__fchown16
+.Lscope60:
+.stabs	"",36,0,0,.Lscope60-v4__fchown16
+.text
+	.align 4
+.stabs "v4__getpriority:F1",36,0,0,v4__getpriority
+	.weak v4__getpriority
+	.type	v4__getpriority,@function
+v4__getpriority:
+.stabn 68,0,91,.LMa531-v4__getpriority
+.LMa531:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic61
+.Lpic61:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic61],%ebx
+0:
+.stabn 68,0,91,.LMb531-v4__getpriority
+.LMb531:
+.LBB61:
+	mov $96,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE61:
+.stabn 68,0,91,.LM539-v4__getpriority
+.LM539:
+	pop %ebx
+	leave
+	ret
+.Lfe61:
+	.size	 v4__getpriority,.Lfe61-v4__getpriority
+.stabn	192,0,0,.LBB61-v4__getpriority
+.stabn	224,0,0,.LBE61-v4__getpriority
+.Lscope61:
+.stabs	"",36,0,0,.Lscope61-v4__getpriority
+.text
+	.align 4
+.stabs "v4__setpriority:F1",36,0,0,v4__setpriority
+	.weak v4__setpriority
+	.type	v4__setpriority,@function
+v4__setpriority:
+.stabn 68,0,92,.LMa540-v4__setpriority
+.LMa540:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic62
+.Lpic62:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic62],%ebx
+0:
+.stabn 68,0,92,.LMb540-v4__setpriority
+.LMb540:
+.LBB62:
+	mov $97,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE62:
+.stabn 68,0,92,.LM548-v4__setpriority
+.LM548:
+	pop %ebx
+	leave
+	ret
+.Lfe62:
+	.size	 v4__setpriority,.Lfe62-v4__setpriority
+.stabn	192,0,0,.LBB62-v4__setpriority
+.stabn	224,0,0,.LBE62-v4__setpriority
+.Lscope62:
+.stabs	"",36,0,0,.Lscope62-v4__setpriority
+.text
+	.align 4
+.stabs "v4__socketcall:F1",36,0,0,v4__socketcall
+	.weak v4__socketcall
+	.type	v4__socketcall,@function
+v4__socketcall:
+.stabn 68,0,93,.LMa549-v4__socketcall
+.LMa549:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic63
+.Lpic63:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic63],%ebx
+0:
+.stabn 68,0,93,.LMb549-v4__socketcall
+.LMb549:
+.LBB63:
+	mov $102,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE63:
+.stabn 68,0,93,.LM557-v4__socketcall
+.LM557:
+	pop %ebx
+	leave
+	ret
+.Lfe63:
+	.size	 v4__socketcall,.Lfe63-v4__socketcall
+.stabn	192,0,0,.LBB63-v4__socketcall
+.stabn	224,0,0,.LBE63-v4__socketcall
+.Lscope63:
+.stabs	"",36,0,0,.Lscope63-v4__socketcall
+.text
+	.align 4
+.stabs "v4__syslog:F1",36,0,0,v4__syslog
+	.weak v4__syslog
+	.type	v4__syslog,@function
+v4__syslog:
+.stabn 68,0,94,.LMa558-v4__syslog
+.LMa558:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic64
+.Lpic64:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic64],%ebx
+0:
+.stabn 68,0,94,.LMb558-v4__syslog
+.LMb558:
+.LBB64:
+	mov $103,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE64:
+.stabn 68,0,94,.LM566-v4__syslog
+.LM566:
+	pop %ebx
+	leave
+	ret
+.Lfe64:
+	.size	 v4__syslog,.Lfe64-v4__syslog
+.stabn	192,0,0,.LBB64-v4__syslog
+.stabn	224,0,0,.LBE64-v4__syslog
+.Lscope64:
+.stabs	"",36,0,0,.Lscope64-v4__syslog
+.text
+	.align 4
+.stabs "v4__setitimer:F1",36,0,0,v4__setitimer
+	.weak v4__setitimer
+	.type	v4__setitimer,@function
+v4__setitimer:
+.stabn 68,0,95,.LMa567-v4__setitimer
+.LMa567:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic65
+.Lpic65:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic65],%ebx
+0:
+.stabn 68,0,95,.LMb567-v4__setitimer
+.LMb567:
+.LBB65:
+	mov $104,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE65:
+.stabn 68,0,95,.LM575-v4__setitimer
+.LM575:
+	pop %ebx
+	leave
+	ret
+.Lfe65:
+	.size	 v4__setitimer,.Lfe65-v4__setitimer
+.stabn	192,0,0,.LBB65-v4__setitimer
+.stabn	224,0,0,.LBE65-v4__setitimer
+.Lscope65:
+.stabs	"",36,0,0,.Lscope65-v4__setitimer
+.text
+	.align 4
+.stabs "v4__getitimer:F1",36,0,0,v4__getitimer
+	.weak v4__getitimer
+	.type	v4__getitimer,@function
+v4__getitimer:
+.stabn 68,0,96,.LMa576-v4__getitimer
+.LMa576:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic66
+.Lpic66:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic66],%ebx
+0:
+.stabn 68,0,96,.LMb576-v4__getitimer
+.LMb576:
+.LBB66:
+	mov $105,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE66:
+.stabn 68,0,96,.LM584-v4__getitimer
+.LM584:
+	pop %ebx
+	leave
+	ret
+.Lfe66:
+	.size	 v4__getitimer,.Lfe66-v4__getitimer
+.stabn	192,0,0,.LBB66-v4__getitimer
+.stabn	224,0,0,.LBE66-v4__getitimer
+.Lscope66:
+.stabs	"",36,0,0,.Lscope66-v4__getitimer
+.text
+	.align 4
+.stabs "v4__stat:F1",36,0,0,v4__stat
+	.weak v4__stat
+	.type	v4__stat,@function
+v4__stat:
+.stabn 68,0,97,.LMa585-v4__stat
+.LMa585:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic67
+.Lpic67:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic67],%ebx
+0:
+.stabn 68,0,97,.LMb585-v4__stat
+.LMb585:
+.LBB67:
+	mov $106,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE67:
+.stabn 68,0,97,.LM593-v4__stat
+.LM593:
+	pop %ebx
+	leave
+	ret
+.Lfe67:
+	.size	 v4__stat,.Lfe67-v4__stat
+.stabn	192,0,0,.LBB67-v4__stat
+.stabn	224,0,0,.LBE67-v4__stat
+.Lscope67:
+.stabs	"",36,0,0,.Lscope67-v4__stat
+.text
+	.align 4
+.stabs "v4__lstat:F1",36,0,0,v4__lstat
+	.weak v4__lstat
+	.type	v4__lstat,@function
+v4__lstat:
+.stabn 68,0,98,.LMa594-v4__lstat
+.LMa594:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic68
+.Lpic68:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic68],%ebx
+0:
+.stabn 68,0,98,.LMb594-v4__lstat
+.LMb594:
+.LBB68:
+	mov $107,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE68:
+.stabn 68,0,98,.LM602-v4__lstat
+.LM602:
+	pop %ebx
+	leave
+	ret
+.Lfe68:
+	.size	 v4__lstat,.Lfe68-v4__lstat
+.stabn	192,0,0,.LBB68-v4__lstat
+.stabn	224,0,0,.LBE68-v4__lstat
+.Lscope68:
+.stabs	"",36,0,0,.Lscope68-v4__lstat
+.text
+	.align 4
+.stabs "v4__fstat:F1",36,0,0,v4__fstat
+	.weak v4__fstat
+	.type	v4__fstat,@function
+v4__fstat:
+.stabn 68,0,99,.LMa603-v4__fstat
+.LMa603:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic69
+.Lpic69:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic69],%ebx
+0:
+.stabn 68,0,99,.LMb603-v4__fstat
+.LMb603:
+.LBB69:
+	mov $108,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE69:
+.stabn 68,0,99,.LM611-v4__fstat
+.LM611:
+	pop %ebx
+	leave
+	ret
+.Lfe69:
+	.size	 v4__fstat,.Lfe69-v4__fstat
+.stabn	192,0,0,.LBB69-v4__fstat
+.stabn	224,0,0,.LBE69-v4__fstat
+.Lscope69:
+.stabs	"",36,0,0,.Lscope69-v4__fstat
+.text
+	.align 4
+.stabs "v4__uname:F1",36,0,0,v4__uname
+	.weak v4__uname
+	.type	v4__uname,@function
+v4__uname:
+.stabn 68,0,100,.LMa612-v4__uname
+.LMa612:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic70
+.Lpic70:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic70],%ebx
+0:
+.stabn 68,0,100,.LMb612-v4__uname
+.LMb612:
+.LBB70:
+	mov $109,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE70:
+.stabn 68,0,100,.LM620-v4__uname
+.LM620:
+	pop %ebx
+	leave
+	ret
+.Lfe70:
+	.size	 v4__uname,.Lfe70-v4__uname
+.stabn	192,0,0,.LBB70-v4__uname
+.stabn	224,0,0,.LBE70-v4__uname
+.Lscope70:
+.stabs	"",36,0,0,.Lscope70-v4__uname
+.text
+	.align 4
+.stabs "v4__wait4:F1",36,0,0,v4__wait4
+	.weak v4__wait4
+	.type	v4__wait4,@function
+v4__wait4:
+.stabn 68,0,101,.LMa621-v4__wait4
+.LMa621:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic71
+.Lpic71:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic71],%ebx
+0:
+.stabn 68,0,101,.LMb621-v4__wait4
+.LMb621:
+.LBB71:
+	mov $114,%eax
+	call v4__dpush@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE71:
+.stabn 68,0,101,.LM629-v4__wait4
+.LM629:
+	pop %ebx
+	leave
+	ret
+.Lfe71:
+	.size	 v4__wait4,.Lfe71-v4__wait4
+.stabn	192,0,0,.LBB71-v4__wait4
+.stabn	224,0,0,.LBE71-v4__wait4
+.Lscope71:
+.stabs	"",36,0,0,.Lscope71-v4__wait4
+.text
+	.align 4
+.stabs "v4__sysinfo:F1",36,0,0,v4__sysinfo
+	.weak v4__sysinfo
+	.type	v4__sysinfo,@function
+v4__sysinfo:
+.stabn 68,0,102,.LMa630-v4__sysinfo
+.LMa630:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic72
+.Lpic72:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic72],%ebx
+0:
+.stabn 68,0,102,.LMb630-v4__sysinfo
+.LMb630:
+.LBB72:
+	mov $116,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE72:
+.stabn 68,0,102,.LM638-v4__sysinfo
+.LM638:
+	pop %ebx
+	leave
+	ret
+.Lfe72:
+	.size	 v4__sysinfo,.Lfe72-v4__sysinfo
+.stabn	192,0,0,.LBB72-v4__sysinfo
+.stabn	224,0,0,.LBE72-v4__sysinfo
+.Lscope72:
+.stabs	"",36,0,0,.Lscope72-v4__sysinfo
+.text
+	.align 4
+.stabs "v4__ipc:F1",36,0,0,v4__ipc
+	.weak v4__ipc
+	.type	v4__ipc,@function
+v4__ipc:
+.stabn 68,0,103,.LMa639-v4__ipc
+.LMa639:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic73
+.Lpic73:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic73],%ebx
+0:
+.stabn 68,0,103,.LMb639-v4__ipc
+.LMb639:
+.LBB73:
+	mov $117,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE73:
+.stabn 68,0,103,.LM647-v4__ipc
+.LM647:
+	pop %ebx
+	leave
+	ret
+.Lfe73:
+	.size	 v4__ipc,.Lfe73-v4__ipc
+.stabn	192,0,0,.LBB73-v4__ipc
+.stabn	224,0,0,.LBE73-v4__ipc
+.Lscope73:
+.stabs	"",36,0,0,.Lscope73-v4__ipc
+.text
+	.align 4
+.stabs "v4__fsync:F1",36,0,0,v4__fsync
+	.weak v4__fsync
+	.type	v4__fsync,@function
+v4__fsync:
+.stabn 68,0,104,.LMa648-v4__fsync
+.LMa648:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic74
+.Lpic74:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic74],%ebx
+0:
+.stabn 68,0,104,.LMb648-v4__fsync
+.LMb648:
+.LBB74:
+	mov $118,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE74:
+.stabn 68,0,104,.LM656-v4__fsync
+.LM656:
+	pop %ebx
+	leave
+	ret
+.Lfe74:
+	.size	 v4__fsync,.Lfe74-v4__fsync
+.stabn	192,0,0,.LBB74-v4__fsync
+.stabn	224,0,0,.LBE74-v4__fsync
+.Lscope74:
+.stabs	"",36,0,0,.Lscope74-v4__fsync
+.text
+	.align 4
+.stabs "v4__clone:F1",36,0,0,v4__clone
+	.weak v4__clone
+	.type	v4__clone,@function
+v4__clone:
+.stabn 68,0,105,.LMa657-v4__clone
+.LMa657:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic75
+.Lpic75:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic75],%ebx
+0:
+.stabn 68,0,105,.LMb657-v4__clone
+.LMb657:
+.LBB75:
+	mov $120,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE75:
+.stabn 68,0,105,.LM665-v4__clone
+.LM665:
+	pop %ebx
+	leave
+	ret
+.Lfe75:
+	.size	 v4__clone,.Lfe75-v4__clone
+.stabn	192,0,0,.LBB75-v4__clone
+.stabn	224,0,0,.LBE75-v4__clone
+.Lscope75:
+.stabs	"",36,0,0,.Lscope75-v4__clone
+.text
+	.align 4
+.stabs "v4__new_uname:F1",36,0,0,v4__new_uname
+	.weak v4__new_uname
+	.type	v4__new_uname,@function
+v4__new_uname:
+.stabn 68,0,106,.LMa666-v4__new_uname
+.LMa666:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic76
+.Lpic76:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic76],%ebx
+0:
+.stabn 68,0,106,.LMb666-v4__new_uname
+.LMb666:
+.LBB76:
+	mov $122,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE76:
+.stabn 68,0,106,.LM674-v4__new_uname
+.LM674:
+	pop %ebx
+	leave
+	ret
+.Lfe76:
+	.size	 v4__new_uname,.Lfe76-v4__new_uname
+.stabn	192,0,0,.LBB76-v4__new_uname
+.stabn	224,0,0,.LBE76-v4__new_uname
+.Lscope76:
+.stabs	"",36,0,0,.Lscope76-v4__new_uname
+.text
+	.align 4
+.stabs "v4__getpgid:F1",36,0,0,v4__getpgid
+	.weak v4__getpgid
+	.type	v4__getpgid,@function
+v4__getpgid:
+.stabn 68,0,107,.LMa675-v4__getpgid
+.LMa675:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic77
+.Lpic77:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic77],%ebx
+0:
+.stabn 68,0,107,.LMb675-v4__getpgid
+.LMb675:
+.LBB77:
+	mov $132,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE77:
+.stabn 68,0,107,.LM683-v4__getpgid
+.LM683:
+	pop %ebx
+	leave
+	ret
+.Lfe77:
+	.size	 v4__getpgid,.Lfe77-v4__getpgid
+.stabn	192,0,0,.LBB77-v4__getpgid
+.stabn	224,0,0,.LBE77-v4__getpgid
+.Lscope77:
+.stabs	"",36,0,0,.Lscope77-v4__getpgid
+.text
+	.align 4
+.stabs "v4__fchdir:F1",36,0,0,v4__fchdir
+	.weak v4__fchdir
+	.type	v4__fchdir,@function
+v4__fchdir:
+.stabn 68,0,108,.LMa684-v4__fchdir
+.LMa684:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic78
+.Lpic78:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic78],%ebx
+0:
+.stabn 68,0,108,.LMb684-v4__fchdir
+.LMb684:
+.LBB78:
+	mov $133,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE78:
+.stabn 68,0,108,.LM692-v4__fchdir
+.LM692:
+	pop %ebx
+	leave
+	ret
+.Lfe78:
+	.size	 v4__fchdir,.Lfe78-v4__fchdir
+.stabn	192,0,0,.LBB78-v4__fchdir
+.stabn	224,0,0,.LBE78-v4__fchdir
+.Lscope78:
+.stabs	"",36,0,0,.Lscope78-v4__fchdir
+.text
+	.align 4
+.stabs "v4__personality:F1",36,0,0,v4__personality
+	.weak v4__personality
+	.type	v4__personality,@function
+v4__personality:
+.stabn 68,0,109,.LMa693-v4__personality
+.LMa693:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic79
+.Lpic79:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic79],%ebx
+0:
+.stabn 68,0,109,.LMb693-v4__personality
+.LMb693:
+.LBB79:
+	mov $136,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE79:
+.stabn 68,0,109,.LM701-v4__personality
+.LM701:
+	pop %ebx
+	leave
+	ret
+.Lfe79:
+	.size	 v4__personality,.Lfe79-v4__personality
+.stabn	192,0,0,.LBB79-v4__personality
+.stabn	224,0,0,.LBE79-v4__personality
+.Lscope79:
+.stabs	"",36,0,0,.Lscope79-v4__personality
+.text
+	.align 4
+.stabs "v4__setfsuid:F1",36,0,0,v4__setfsuid
+	.weak v4__setfsuid
+	.type	v4__setfsuid,@function
+v4__setfsuid:
+.stabn 68,0,110,.LMa702-v4__setfsuid
+.LMa702:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic80
+.Lpic80:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic80],%ebx
+0:
+.stabn 68,0,110,.LMb702-v4__setfsuid
+.LMb702:
+.LBB80:
+	mov $138,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE80:
+.stabn 68,0,110,.LM710-v4__setfsuid
+.LM710:
+	pop %ebx
+	leave
+	ret
+.Lfe80:
+	.size	 v4__setfsuid,.Lfe80-v4__setfsuid
+.stabn	192,0,0,.LBB80-v4__setfsuid
+.stabn	224,0,0,.LBE80-v4__setfsuid
+.Lscope80:
+.stabs	"",36,0,0,.Lscope80-v4__setfsuid
+.text
+	.align 4
+.stabs "v4__setfsgid:F1",36,0,0,v4__setfsgid
+	.weak v4__setfsgid
+	.type	v4__setfsgid,@function
+v4__setfsgid:
+.stabn 68,0,111,.LMa711-v4__setfsgid
+.LMa711:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic81
+.Lpic81:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic81],%ebx
+0:
+.stabn 68,0,111,.LMb711-v4__setfsgid
+.LMb711:
+.LBB81:
+	mov $139,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE81:
+.stabn 68,0,111,.LM719-v4__setfsgid
+.LM719:
+	pop %ebx
+	leave
+	ret
+.Lfe81:
+	.size	 v4__setfsgid,.Lfe81-v4__setfsgid
+.stabn	192,0,0,.LBB81-v4__setfsgid
+.stabn	224,0,0,.LBE81-v4__setfsgid
+.Lscope81:
+.stabs	"",36,0,0,.Lscope81-v4__setfsgid
+.text
+	.align 4
+.stabs "v4__llseek:F1",36,0,0,v4__llseek
+	.weak v4__llseek
+	.type	v4__llseek,@function
+v4__llseek:
+.stabn 68,0,112,.LMa720-v4__llseek
+.LMa720:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic82
+.Lpic82:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic82],%ebx
+0:
+.stabn 68,0,112,.LMb720-v4__llseek
+.LMb720:
+.LBB82:
+	mov $140,%eax
+	call v4__dpush@PLT
+	mov $5,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE82:
+.stabn 68,0,112,.LM728-v4__llseek
+.LM728:
+	pop %ebx
+	leave
+	ret
+.Lfe82:
+	.size	 v4__llseek,.Lfe82-v4__llseek
+.stabn	192,0,0,.LBB82-v4__llseek
+.stabn	224,0,0,.LBE82-v4__llseek
+.Lscope82:
+.stabs	"",36,0,0,.Lscope82-v4__llseek
+.text
+	.align 4
+.stabs "v4__getdents:F1",36,0,0,v4__getdents
+	.weak v4__getdents
+	.type	v4__getdents,@function
+v4__getdents:
+.stabn 68,0,113,.LMa729-v4__getdents
+.LMa729:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic83
+.Lpic83:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic83],%ebx
+0:
+.stabn 68,0,113,.LMb729-v4__getdents
+.LMb729:
+.LBB83:
+	mov $141,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE83:
+.stabn 68,0,113,.LM737-v4__getdents
+.LM737:
+	pop %ebx
+	leave
+	ret
+.Lfe83:
+	.size	 v4__getdents,.Lfe83-v4__getdents
+.stabn	192,0,0,.LBB83-v4__getdents
+.stabn	224,0,0,.LBE83-v4__getdents
+.Lscope83:
+.stabs	"",36,0,0,.Lscope83-v4__getdents
+.text
+	.align 4
+.stabs "v4__select:F1",36,0,0,v4__select
+	.weak v4__select
+	.type	v4__select,@function
+v4__select:
+.stabn 68,0,114,.LMa738-v4__select
+.LMa738:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic84
+.Lpic84:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic84],%ebx
+0:
+.stabn 68,0,114,.LMb738-v4__select
+.LMb738:
+.LBB84:
+	mov $142,%eax
+	call v4__dpush@PLT
+	mov $5,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE84:
+.stabn 68,0,114,.LM746-v4__select
+.LM746:
+	pop %ebx
+	leave
+	ret
+.Lfe84:
+	.size	 v4__select,.Lfe84-v4__select
+.stabn	192,0,0,.LBB84-v4__select
+.stabn	224,0,0,.LBE84-v4__select
+.Lscope84:
+.stabs	"",36,0,0,.Lscope84-v4__select
+.text
+	.align 4
+.stabs "v4__flock:F1",36,0,0,v4__flock
+	.weak v4__flock
+	.type	v4__flock,@function
+v4__flock:
+.stabn 68,0,115,.LMa747-v4__flock
+.LMa747:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic85
+.Lpic85:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic85],%ebx
+0:
+.stabn 68,0,115,.LMb747-v4__flock
+.LMb747:
+.LBB85:
+	mov $143,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE85:
+.stabn 68,0,115,.LM755-v4__flock
+.LM755:
+	pop %ebx
+	leave
+	ret
+.Lfe85:
+	.size	 v4__flock,.Lfe85-v4__flock
+.stabn	192,0,0,.LBB85-v4__flock
+.stabn	224,0,0,.LBE85-v4__flock
+.Lscope85:
+.stabs	"",36,0,0,.Lscope85-v4__flock
+.text
+	.align 4
+.stabs "v4__msync:F1",36,0,0,v4__msync
+	.weak v4__msync
+	.type	v4__msync,@function
+v4__msync:
+.stabn 68,0,116,.LMa756-v4__msync
+.LMa756:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic86
+.Lpic86:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic86],%ebx
+0:
+.stabn 68,0,116,.LMb756-v4__msync
+.LMb756:
+.LBB86:
+	mov $144,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE86:
+.stabn 68,0,116,.LM764-v4__msync
+.LM764:
+	pop %ebx
+	leave
+	ret
+.Lfe86:
+	.size	 v4__msync,.Lfe86-v4__msync
+.stabn	192,0,0,.LBB86-v4__msync
+.stabn	224,0,0,.LBE86-v4__msync
+.Lscope86:
+.stabs	"",36,0,0,.Lscope86-v4__msync
+.text
+	.align 4
+.stabs "v4__readv:F1",36,0,0,v4__readv
+	.weak v4__readv
+	.type	v4__readv,@function
+v4__readv:
+.stabn 68,0,117,.LMa765-v4__readv
+.LMa765:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic87
+.Lpic87:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic87],%ebx
+0:
+.stabn 68,0,117,.LMb765-v4__readv
+.LMb765:
+.LBB87:
+	mov $145,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE87:
+.stabn 68,0,117,.LM773-v4__readv
+.LM773:
+	pop %ebx
+	leave
+	ret
+.Lfe87:
+	.size	 v4__readv,.Lfe87-v4__readv
+.stabn	192,0,0,.LBB87-v4__readv
+.stabn	224,0,0,.LBE87-v4__readv
+.Lscope87:
+.stabs	"",36,0,0,.Lscope87-v4__readv
+.text
+	.align 4
+.stabs "v4__writev:F1",36,0,0,v4__writev
+	.weak v4__writev
+	.type	v4__writev,@function
+v4__writev:
+.stabn 68,0,118,.LMa774-v4__writev
+.LMa774:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic88
+.Lpic88:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic88],%ebx
+0:
+.stabn 68,0,118,.LMb774-v4__writev
+.LMb774:
+.LBB88:
+	mov $146,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE88:
+.stabn 68,0,118,.LM782-v4__writev
+.LM782:
+	pop %ebx
+	leave
+	ret
+.Lfe88:
+	.size	 v4__writev,.Lfe88-v4__writev
+.stabn	192,0,0,.LBB88-v4__writev
+.stabn	224,0,0,.LBE88-v4__writev
+.Lscope88:
+.stabs	"",36,0,0,.Lscope88-v4__writev
+.text
+	.align 4
+.stabs "v4__nanosleep:F1",36,0,0,v4__nanosleep
+	.weak v4__nanosleep
+	.type	v4__nanosleep,@function
+v4__nanosleep:
+.stabn 68,0,119,.LMa783-v4__nanosleep
+.LMa783:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic89
+.Lpic89:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic89],%ebx
+0:
+.stabn 68,0,119,.LMb783-v4__nanosleep
+.LMb783:
+.LBB89:
+	mov $162,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE89:
+.stabn 68,0,119,.LM791-v4__nanosleep
+.LM791:
+	pop %ebx
+	leave
+	ret
+.Lfe89:
+	.size	 v4__nanosleep,.Lfe89-v4__nanosleep
+.stabn	192,0,0,.LBB89-v4__nanosleep
+.stabn	224,0,0,.LBE89-v4__nanosleep
+.Lscope89:
+.stabs	"",36,0,0,.Lscope89-v4__nanosleep
+.text
+	.align 4
+.stabs "v4__mremap:F1",36,0,0,v4__mremap
+	.weak v4__mremap
+	.type	v4__mremap,@function
+v4__mremap:
+.stabn 68,0,120,.LMa792-v4__mremap
+.LMa792:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic90
+.Lpic90:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic90],%ebx
+0:
+.stabn 68,0,120,.LMb792-v4__mremap
+.LMb792:
+.LBB90:
+	mov $163,%eax
+	call v4__dpush@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE90:
+.stabn 68,0,120,.LM800-v4__mremap
+.LM800:
+	pop %ebx
+	leave
+	ret
+.Lfe90:
+	.size	 v4__mremap,.Lfe90-v4__mremap
+.stabn	192,0,0,.LBB90-v4__mremap
+.stabn	224,0,0,.LBE90-v4__mremap
+.Lscope90:
+.stabs	"",36,0,0,.Lscope90-v4__mremap
+.text
+	.align 4
+.stabs "v4__setresuid16:F1",36,0,0,v4__setresuid16
+	.weak v4__setresuid16
+	.type	v4__setresuid16,@function
+v4__setresuid16:
+.stabn 68,0,121,.LMa801-v4__setresuid16
+.LMa801:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic91
+.Lpic91:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic91],%ebx
+0:
+.stabn 68,0,121,.LMb801-v4__setresuid16
+.LMb801:
+.LBB91:
+	mov $164,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE91:
+.stabn 68,0,121,.LM809-v4__setresuid16
+.LM809:
+	pop %ebx
+	leave
+	ret
+.Lfe91:
+	.size	 v4__setresuid16,.Lfe91-v4__setresuid16
+.stabn	192,0,0,.LBB91-v4__setresuid16
+.stabn	224,0,0,.LBE91-v4__setresuid16
+.Lscope91:
+.stabs	"",36,0,0,.Lscope91-v4__setresuid16
+.text
+	.align 4
+.stabs "v4__getresuid16:F1",36,0,0,v4__getresuid16
+	.weak v4__getresuid16
+	.type	v4__getresuid16,@function
+v4__getresuid16:
+.stabn 68,0,122,.LMa810-v4__getresuid16
+.LMa810:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic92
+.Lpic92:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic92],%ebx
+0:
+.stabn 68,0,122,.LMb810-v4__getresuid16
+.LMb810:
+.LBB92:
+	mov $165,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE92:
+.stabn 68,0,122,.LM818-v4__getresuid16
+.LM818:
+	pop %ebx
+	leave
+	ret
+.Lfe92:
+	.size	 v4__getresuid16,.Lfe92-v4__getresuid16
+.stabn	192,0,0,.LBB92-v4__getresuid16
+.stabn	224,0,0,.LBE92-v4__getresuid16
+.Lscope92:
+.stabs	"",36,0,0,.Lscope92-v4__getresuid16
+.text
+	.align 4
+.stabs "v4__poll:F1",36,0,0,v4__poll
+	.weak v4__poll
+	.type	v4__poll,@function
+v4__poll:
+.stabn 68,0,123,.LMa819-v4__poll
+.LMa819:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic93
+.Lpic93:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic93],%ebx
+0:
+.stabn 68,0,123,.LMb819-v4__poll
+.LMb819:
+.LBB93:
+	mov $168,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE93:
+.stabn 68,0,123,.LM827-v4__poll
+.LM827:
+	pop %ebx
+	leave
+	ret
+.Lfe93:
+	.size	 v4__poll,.Lfe93-v4__poll
+.stabn	192,0,0,.LBB93-v4__poll
+.stabn	224,0,0,.LBE93-v4__poll
+.Lscope93:
+.stabs	"",36,0,0,.Lscope93-v4__poll
+.text
+	.align 4
+.stabs "v4__setresgid16:F1",36,0,0,v4__setresgid16
+	.weak v4__setresgid16
+	.type	v4__setresgid16,@function
+v4__setresgid16:
+.stabn 68,0,124,.LMa828-v4__setresgid16
+.LMa828:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic94
+.Lpic94:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic94],%ebx
+0:
+.stabn 68,0,124,.LMb828-v4__setresgid16
+.LMb828:
+.LBB94:
+	mov $170,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE94:
+.stabn 68,0,124,.LM836-v4__setresgid16
+.LM836:
+	pop %ebx
+	leave
+	ret
+.Lfe94:
+	.size	 v4__setresgid16,.Lfe94-v4__setresgid16
+.stabn	192,0,0,.LBB94-v4__setresgid16
+.stabn	224,0,0,.LBE94-v4__setresgid16
+.Lscope94:
+.stabs	"",36,0,0,.Lscope94-v4__setresgid16
+.text
+	.align 4
+.stabs "v4__getresgid16:F1",36,0,0,v4__getresgid16
+	.weak v4__getresgid16
+	.type	v4__getresgid16,@function
+v4__getresgid16:
+.stabn 68,0,125,.LMa837-v4__getresgid16
+.LMa837:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic95
+.Lpic95:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic95],%ebx
+0:
+.stabn 68,0,125,.LMb837-v4__getresgid16
+.LMb837:
+.LBB95:
+	mov $171,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE95:
+.stabn 68,0,125,.LM845-v4__getresgid16
+.LM845:
+	pop %ebx
+	leave
+	ret
+.Lfe95:
+	.size	 v4__getresgid16,.Lfe95-v4__getresgid16
+.stabn	192,0,0,.LBB95-v4__getresgid16
+.stabn	224,0,0,.LBE95-v4__getresgid16
+.Lscope95:
+.stabs	"",36,0,0,.Lscope95-v4__getresgid16
+.text
+	.align 4
+.stabs "v4__sigret:F1",36,0,0,v4__sigret
+	.weak v4__sigret
+	.type	v4__sigret,@function
+v4__sigret:
+.stabn 68,0,126,.LMa846-v4__sigret
+.LMa846:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic96
+.Lpic96:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic96],%ebx
+0:
+.stabn 68,0,126,.LMb846-v4__sigret
+.LMb846:
+.LBB96:
+	mov $173,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE96:
+.stabn 68,0,126,.LM854-v4__sigret
+.LM854:
+	pop %ebx
+	leave
+	ret
+.Lfe96:
+	.size	 v4__sigret,.Lfe96-v4__sigret
+.stabn	192,0,0,.LBB96-v4__sigret
+.stabn	224,0,0,.LBE96-v4__sigret
+.Lscope96:
+.stabs	"",36,0,0,.Lscope96-v4__sigret
+.text
+	.align 4
+.stabs "v4__sigaction:F1",36,0,0,v4__sigaction
+	.weak v4__sigaction
+	.type	v4__sigaction,@function
+v4__sigaction:
+.stabn 68,0,127,.LMa855-v4__sigaction
+.LMa855:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic97
+.Lpic97:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic97],%ebx
+0:
+.stabn 68,0,127,.LMb855-v4__sigaction
+.LMb855:
+.LBB97:
+	mov $174,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE97:
+.stabn 68,0,127,.LM863-v4__sigaction
+.LM863:
+	pop %ebx
+	leave
+	ret
+.Lfe97:
+	.size	 v4__sigaction,.Lfe97-v4__sigaction
+.stabn	192,0,0,.LBB97-v4__sigaction
+.stabn	224,0,0,.LBE97-v4__sigaction
+.Lscope97:
+.stabs	"",36,0,0,.Lscope97-v4__sigaction
+.text
+	.align 4
+.stabs "v4__sigprocmask:F1",36,0,0,v4__sigprocmask
+	.weak v4__sigprocmask
+	.type	v4__sigprocmask,@function
+v4__sigprocmask:
+.stabn 68,0,128,.LMa864-v4__sigprocmask
+.LMa864:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic98
+.Lpic98:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic98],%ebx
+0:
+.stabn 68,0,128,.LMb864-v4__sigprocmask
+.LMb864:
+.LBB98:
+	mov $175,%eax
+	call v4__dpush@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE98:
+.stabn 68,0,128,.LM872-v4__sigprocmask
+.LM872:
+	pop %ebx
+	leave
+	ret
+.Lfe98:
+	.size	 v4__sigprocmask,.Lfe98-v4__sigprocmask
+.stabn	192,0,0,.LBB98-v4__sigprocmask
+.stabn	224,0,0,.LBE98-v4__sigprocmask
+.Lscope98:
+.stabs	"",36,0,0,.Lscope98-v4__sigprocmask
+.text
+	.align 4
+.stabs "v4__sigpending:F1",36,0,0,v4__sigpending
+	.weak v4__sigpending
+	.type	v4__sigpending,@function
+v4__sigpending:
+.stabn 68,0,129,.LMa873-v4__sigpending
+.LMa873:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic99
+.Lpic99:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic99],%ebx
+0:
+.stabn 68,0,129,.LMb873-v4__sigpending
+.LMb873:
+.LBB99:
+	mov $176,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE99:
+.stabn 68,0,129,.LM881-v4__sigpending
+.LM881:
+	pop %ebx
+	leave
+	ret
+.Lfe99:
+	.size	 v4__sigpending,.Lfe99-v4__sigpending
+.stabn	192,0,0,.LBB99-v4__sigpending
+.stabn	224,0,0,.LBE99-v4__sigpending
+.Lscope99:
+.stabs	"",36,0,0,.Lscope99-v4__sigpending
+.text
+	.align 4
+.stabs "v4__sigtimedwait:F1",36,0,0,v4__sigtimedwait
+	.weak v4__sigtimedwait
+	.type	v4__sigtimedwait,@function
+v4__sigtimedwait:
+.stabn 68,0,130,.LMa882-v4__sigtimedwait
+.LMa882:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic100
+.Lpic100:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic100],%ebx
+0:
+.stabn 68,0,130,.LMb882-v4__sigtimedwait
+.LMb882:
+.LBB100:
+	mov $177,%eax
+	call v4__dpush@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE100:
+.stabn 68,0,130,.LM890-v4__sigtimedwait
+.LM890:
+	pop %ebx
+	leave
+	ret
+.Lfe100:
+	.size	 v4__sigtimedwait,.Lfe100-v4__sigtimedwait
+.stabn	192,0,0,.LBB100-v4__sigtimedwait
+.stabn	224,0,0,.LBE100-v4__sigtimedwait
+.Lscope100:
+.stabs	"",36,0,0,.Lscope100-v4__sigtimedwait
+.text
+	.align 4
+.stabs "v4__sigqueueinfo:F1",36,0,0,v4__sigqueueinfo
+	.weak v4__sigqueueinfo
+	.type	v4__sigqueueinfo,@function
+v4__sigqueueinfo:
+.stabn 68,0,131,.LMa891-v4__sigqueueinfo
+.LMa891:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic101
+.Lpic101:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic101],%ebx
+0:
+.stabn 68,0,131,.LMb891-v4__sigqueueinfo
+.LMb891:
+.LBB101:
+	mov $178,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE101:
+.stabn 68,0,131,.LM899-v4__sigqueueinfo
+.LM899:
+	pop %ebx
+	leave
+	ret
+.Lfe101:
+	.size	 v4__sigqueueinfo,.Lfe101-v4__sigqueueinfo
+.stabn	192,0,0,.LBB101-v4__sigqueueinfo
+.stabn	224,0,0,.LBE101-v4__sigqueueinfo
+.Lscope101:
+.stabs	"",36,0,0,.Lscope101-v4__sigqueueinfo
+.text
+	.align 4
+.stabs "v4__sigsuspend:F1",36,0,0,v4__sigsuspend
+	.weak v4__sigsuspend
+	.type	v4__sigsuspend,@function
+v4__sigsuspend:
+.stabn 68,0,132,.LMa900-v4__sigsuspend
+.LMa900:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic102
+.Lpic102:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic102],%ebx
+0:
+.stabn 68,0,132,.LMb900-v4__sigsuspend
+.LMb900:
+.LBB102:
+	mov $179,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE102:
+.stabn 68,0,132,.LM908-v4__sigsuspend
+.LM908:
+	pop %ebx
+	leave
+	ret
+.Lfe102:
+	.size	 v4__sigsuspend,.Lfe102-v4__sigsuspend
+.stabn	192,0,0,.LBB102-v4__sigsuspend
+.stabn	224,0,0,.LBE102-v4__sigsuspend
+.Lscope102:
+.stabs	"",36,0,0,.Lscope102-v4__sigsuspend
+.text
+	.align 4
+.stabs "v4__pread:F1",36,0,0,v4__pread
+	.weak v4__pread
+	.type	v4__pread,@function
+v4__pread:
+.stabn 68,0,133,.LMa909-v4__pread
+.LMa909:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic103
+.Lpic103:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic103],%ebx
+0:
+.stabn 68,0,133,.LMb909-v4__pread
+.LMb909:
+.LBB103:
+	mov $180,%eax
+	call v4__dpush@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE103:
+.stabn 68,0,133,.LM917-v4__pread
+.LM917:
+	pop %ebx
+	leave
+	ret
+.Lfe103:
+	.size	 v4__pread,.Lfe103-v4__pread
+.stabn	192,0,0,.LBB103-v4__pread
+.stabn	224,0,0,.LBE103-v4__pread
+.Lscope103:
+.stabs	"",36,0,0,.Lscope103-v4__pread
+.text
+	.align 4
+.stabs "v4__pwrite:F1",36,0,0,v4__pwrite
+	.weak v4__pwrite
+	.type	v4__pwrite,@function
+v4__pwrite:
+.stabn 68,0,134,.LMa918-v4__pwrite
+.LMa918:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic104
+.Lpic104:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic104],%ebx
+0:
+.stabn 68,0,134,.LMb918-v4__pwrite
+.LMb918:
+.LBB104:
+	mov $181,%eax
+	call v4__dpush@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE104:
+.stabn 68,0,134,.LM926-v4__pwrite
+.LM926:
+	pop %ebx
+	leave
+	ret
+.Lfe104:
+	.size	 v4__pwrite,.Lfe104-v4__pwrite
+.stabn	192,0,0,.LBB104-v4__pwrite
+.stabn	224,0,0,.LBE104-v4__pwrite
+.Lscope104:
+.stabs	"",36,0,0,.Lscope104-v4__pwrite
+.text
+	.align 4
+.stabs "v4__chown16:F1",36,0,0,v4__chown16
+	.weak v4__chown16
+	.type	v4__chown16,@function
+v4__chown16:
+.stabn 68,0,135,.LMa927-v4__chown16
+.LMa927:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic105
+.Lpic105:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic105],%ebx
+0:
+.stabn 68,0,135,.LMb927-v4__chown16
+.LMb927:
+.LBB105:
+	mov $182,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE105:
+.stabn 68,0,135,.LM935-v4__chown16
+.LM935:
+	pop %ebx
+	leave
+	ret
+.Lfe105:
+	.size	 v4__chown16,.Lfe105-v4__chown16
+.stabn	192,0,0,.LBB105-v4__chown16
+.stabn	224,0,0,.LBE105-v4__chown16
+.Lscope105:
+.stabs	"",36,0,0,.Lscope105-v4__chown16
+.text
+	.align 4
+.stabs "v4__getcwd:F1",36,0,0,v4__getcwd
+	.weak v4__getcwd
+	.type	v4__getcwd,@function
+v4__getcwd:
+.stabn 68,0,136,.LMa936-v4__getcwd
+.LMa936:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic106
+.Lpic106:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic106],%ebx
+0:
+.stabn 68,0,136,.LMb936-v4__getcwd
+.LMb936:
+.LBB106:
+	mov $183,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE106:
+.stabn 68,0,136,.LM944-v4__getcwd
+.LM944:
+	pop %ebx
+	leave
+	ret
+.Lfe106:
+	.size	 v4__getcwd,.Lfe106-v4__getcwd
+.stabn	192,0,0,.LBB106-v4__getcwd
+.stabn	224,0,0,.LBE106-v4__getcwd
+.Lscope106:
+.stabs	"",36,0,0,.Lscope106-v4__getcwd
+.text
+	.align 4
+.stabs "v4__sigaltstack:F1",36,0,0,v4__sigaltstack
+	.weak v4__sigaltstack
+	.type	v4__sigaltstack,@function
+v4__sigaltstack:
+.stabn 68,0,137,.LMa945-v4__sigaltstack
+.LMa945:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic107
+.Lpic107:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic107],%ebx
+0:
+.stabn 68,0,137,.LMb945-v4__sigaltstack
+.LMb945:
+.LBB107:
+	mov $186,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE107:
+.stabn 68,0,137,.LM953-v4__sigaltstack
+.LM953:
+	pop %ebx
+	leave
+	ret
+.Lfe107:
+	.size	 v4__sigaltstack,.Lfe107-v4__sigaltstack
+.stabn	192,0,0,.LBB107-v4__sigaltstack
+.stabn	224,0,0,.LBE107-v4__sigaltstack
+.Lscope107:
+.stabs	"",36,0,0,.Lscope107-v4__sigaltstack
+.text
+	.align 4
+.stabs "v4__sendfile:F1",36,0,0,v4__sendfile
+	.weak v4__sendfile
+	.type	v4__sendfile,@function
+v4__sendfile:
+.stabn 68,0,138,.LMa954-v4__sendfile
+.LMa954:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic108
+.Lpic108:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic108],%ebx
+0:
+.stabn 68,0,138,.LMb954-v4__sendfile
+.LMb954:
+.LBB108:
+	mov $187,%eax
+	call v4__dpush@PLT
+	mov $4,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE108:
+.stabn 68,0,138,.LM962-v4__sendfile
+.LM962:
+	pop %ebx
+	leave
+	ret
+.Lfe108:
+	.size	 v4__sendfile,.Lfe108-v4__sendfile
+.stabn	192,0,0,.LBB108-v4__sendfile
+.stabn	224,0,0,.LBE108-v4__sendfile
+.Lscope108:
+.stabs	"",36,0,0,.Lscope108-v4__sendfile
+.text
+	.align 4
+.stabs "v4__vfork:F1",36,0,0,v4__vfork
+	.weak v4__vfork
+	.type	v4__vfork,@function
+v4__vfork:
+.stabn 68,0,139,.LMa963-v4__vfork
+.LMa963:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic109
+.Lpic109:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic109],%ebx
+0:
+.stabn 68,0,139,.LMb963-v4__vfork
+.LMb963:
+.LBB109:
+	mov $190,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE109:
+.stabn 68,0,139,.LM971-v4__vfork
+.LM971:
+	pop %ebx
+	leave
+	ret
+.Lfe109:
+	.size	 v4__vfork,.Lfe109-v4__vfork
+.stabn	192,0,0,.LBB109-v4__vfork
+.stabn	224,0,0,.LBE109-v4__vfork
+.Lscope109:
+.stabs	"",36,0,0,.Lscope109-v4__vfork
+.text
+	.align 4
+.stabs "v4__getrlimit:F1",36,0,0,v4__getrlimit
+	.weak v4__getrlimit
+	.type	v4__getrlimit,@function
+v4__getrlimit:
+.stabn 68,0,140,.LMa972-v4__getrlimit
+.LMa972:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic110
+.Lpic110:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic110],%ebx
+0:
+.stabn 68,0,140,.LMb972-v4__getrlimit
+.LMb972:
+.LBB110:
+	mov $191,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE110:
+.stabn 68,0,140,.LM980-v4__getrlimit
+.LM980:
+	pop %ebx
+	leave
+	ret
+.Lfe110:
+	.size	 v4__getrlimit,.Lfe110-v4__getrlimit
+.stabn	192,0,0,.LBB110-v4__getrlimit
+.stabn	224,0,0,.LBE110-v4__getrlimit
+.Lscope110:
+.stabs	"",36,0,0,.Lscope110-v4__getrlimit
+.text
+	.align 4
+.stabs "v4__mmap2:F1",36,0,0,v4__mmap2
+	.weak v4__mmap2
+	.type	v4__mmap2,@function
+v4__mmap2:
+.stabn 68,0,141,.LMa981-v4__mmap2
+.LMa981:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic111
+.Lpic111:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic111],%ebx
+0:
+.stabn 68,0,141,.LMb981-v4__mmap2
+.LMb981:
+.LBB111:
+	mov $192,%eax
+	call v4__dpush@PLT
+	mov $6,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE111:
+.stabn 68,0,141,.LM989-v4__mmap2
+.LM989:
+	pop %ebx
+	leave
+	ret
+.Lfe111:
+	.size	 v4__mmap2,.Lfe111-v4__mmap2
+.stabn	192,0,0,.LBB111-v4__mmap2
+.stabn	224,0,0,.LBE111-v4__mmap2
+.Lscope111:
+.stabs	"",36,0,0,.Lscope111-v4__mmap2
+.text
+	.align 4
+.stabs "v4__lchown:F1",36,0,0,v4__lchown
+	.weak v4__lchown
+	.type	v4__lchown,@function
+v4__lchown:
+.stabn 68,0,142,.LMa990-v4__lchown
+.LMa990:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic112
+.Lpic112:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic112],%ebx
+0:
+.stabn 68,0,142,.LMb990-v4__lchown
+.LMb990:
+.LBB112:
+	mov $198,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE112:
+.stabn 68,0,142,.LM998-v4__lchown
+.LM998:
+	pop %ebx
+	leave
+	ret
+.Lfe112:
+	.size	 v4__lchown,.Lfe112-v4__lchown
+.stabn	192,0,0,.LBB112-v4__lchown
+.stabn	224,0,0,.LBE112-v4__lchown
+.Lscope112:
+.stabs	"",36,0,0,.Lscope112-v4__lchown
+.text
+	.align 4
+.stabs "v4__getuid:F1",36,0,0,v4__getuid
+	.weak v4__getuid
+	.type	v4__getuid,@function
+v4__getuid:
+.stabn 68,0,143,.LMa999-v4__getuid
+.LMa999:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic113
+.Lpic113:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic113],%ebx
+0:
+.stabn 68,0,143,.LMb999-v4__getuid
+.LMb999:
+.LBB113:
+	mov $199,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE113:
+.stabn 68,0,143,.LM1007-v4__getuid
+.LM1007:
+	pop %ebx
+	leave
+	ret
+.Lfe113:
+	.size	 v4__getuid,.Lfe113-v4__getuid
+.stabn	192,0,0,.LBB113-v4__getuid
+.stabn	224,0,0,.LBE113-v4__getuid
+.Lscope113:
+.stabs	"",36,0,0,.Lscope113-v4__getuid
+.text
+	.align 4
+.stabs "v4__getgid:F1",36,0,0,v4__getgid
+	.weak v4__getgid
+	.type	v4__getgid,@function
+v4__getgid:
+.stabn 68,0,144,.LMa1008-v4__getgid
+.LMa1008:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic114
+.Lpic114:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic114],%ebx
+0:
+.stabn 68,0,144,.LMb1008-v4__getgid
+.LMb1008:
+.LBB114:
+	mov $200,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE114:
+.stabn 68,0,144,.LM1016-v4__getgid
+.LM1016:
+	pop %ebx
+	leave
+	ret
+.Lfe114:
+	.size	 v4__getgid,.Lfe114-v4__getgid
+.stabn	192,0,0,.LBB114-v4__getgid
+.stabn	224,0,0,.LBE114-v4__getgid
+.Lscope114:
+.stabs	"",36,0,0,.Lscope114-v4__getgid
+.text
+	.align 4
+.stabs "v4__geteuid:F1",36,0,0,v4__geteuid
+	.weak v4__geteuid
+	.type	v4__geteuid,@function
+v4__geteuid:
+.stabn 68,0,145,.LMa1017-v4__geteuid
+.LMa1017:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic115
+.Lpic115:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic115],%ebx
+0:
+.stabn 68,0,145,.LMb1017-v4__geteuid
+.LMb1017:
+.LBB115:
+	mov $201,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE115:
+.stabn 68,0,145,.LM1025-v4__geteuid
+.LM1025:
+	pop %ebx
+	leave
+	ret
+.Lfe115:
+	.size	 v4__geteuid,.Lfe115-v4__geteuid
+.stabn	192,0,0,.LBB115-v4__geteuid
+.stabn	224,0,0,.LBE115-v4__geteuid
+.Lscope115:
+.stabs	"",36,0,0,.Lscope115-v4__geteuid
+.text
+	.align 4
+.stabs "v4__getegid:F1",36,0,0,v4__getegid
+	.weak v4__getegid
+	.type	v4__getegid,@function
+v4__getegid:
+.stabn 68,0,146,.LMa1026-v4__getegid
+.LMa1026:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic116
+.Lpic116:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic116],%ebx
+0:
+.stabn 68,0,146,.LMb1026-v4__getegid
+.LMb1026:
+.LBB116:
+	mov $202,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE116:
+.stabn 68,0,146,.LM1034-v4__getegid
+.LM1034:
+	pop %ebx
+	leave
+	ret
+.Lfe116:
+	.size	 v4__getegid,.Lfe116-v4__getegid
+.stabn	192,0,0,.LBB116-v4__getegid
+.stabn	224,0,0,.LBE116-v4__getegid
+.Lscope116:
+.stabs	"",36,0,0,.Lscope116-v4__getegid
+.text
+	.align 4
+.stabs "v4__setreuid:F1",36,0,0,v4__setreuid
+	.weak v4__setreuid
+	.type	v4__setreuid,@function
+v4__setreuid:
+.stabn 68,0,147,.LMa1035-v4__setreuid
+.LMa1035:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic117
+.Lpic117:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic117],%ebx
+0:
+.stabn 68,0,147,.LMb1035-v4__setreuid
+.LMb1035:
+.LBB117:
+	mov $203,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE117:
+.stabn 68,0,147,.LM1043-v4__setreuid
+.LM1043:
+	pop %ebx
+	leave
+	ret
+.Lfe117:
+	.size	 v4__setreuid,.Lfe117-v4__setreuid
+.stabn	192,0,0,.LBB117-v4__setreuid
+.stabn	224,0,0,.LBE117-v4__setreuid
+.Lscope117:
+.stabs	"",36,0,0,.Lscope117-v4__setreuid
+.text
+	.align 4
+.stabs "v4__setregid:F1",36,0,0,v4__setregid
+	.weak v4__setregid
+	.type	v4__setregid,@function
+v4__setregid:
+.stabn 68,0,148,.LMa1044-v4__setregid
+.LMa1044:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic118
+.Lpic118:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic118],%ebx
+0:
+.stabn 68,0,148,.LMb1044-v4__setregid
+.LMb1044:
+.LBB118:
+	mov $204,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE118:
+.stabn 68,0,148,.LM1052-v4__setregid
+.LM1052:
+	pop %ebx
+	leave
+	ret
+.Lfe118:
+	.size	 v4__setregid,.Lfe118-v4__setregid
+.stabn	192,0,0,.LBB118-v4__setregid
+.stabn	224,0,0,.LBE118-v4__setregid
+.Lscope118:
+.stabs	"",36,0,0,.Lscope118-v4__setregid
+.text
+	.align 4
+.stabs "v4__getgroups:F1",36,0,0,v4__getgroups
+	.weak v4__getgroups
+	.type	v4__getgroups,@function
+v4__getgroups:
+.stabn 68,0,149,.LMa1053-v4__getgroups
+.LMa1053:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic119
+.Lpic119:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic119],%ebx
+0:
+.stabn 68,0,149,.LMb1053-v4__getgroups
+.LMb1053:
+.LBB119:
+	mov $205,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE119:
+.stabn 68,0,149,.LM1061-v4__getgroups
+.LM1061:
+	pop %ebx
+	leave
+	ret
+.Lfe119:
+	.size	 v4__getgroups,.Lfe119-v4__getgroups
+.stabn	192,0,0,.LBB119-v4__getgroups
+.stabn	224,0,0,.LBE119-v4__getgroups
+.Lscope119:
+.stabs	"",36,0,0,.Lscope119-v4__getgroups
+.text
+	.align 4
+.stabs "v4__setgroups:F1",36,0,0,v4__setgroups
+	.weak v4__setgroups
+	.type	v4__setgroups,@function
+v4__setgroups:
+.stabn 68,0,150,.LMa1062-v4__setgroups
+.LMa1062:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic120
+.Lpic120:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic120],%ebx
+0:
+.stabn 68,0,150,.LMb1062-v4__setgroups
+.LMb1062:
+.LBB120:
+	mov $206,%eax
+	call v4__dpush@PLT
+	mov $2,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE120:
+.stabn 68,0,150,.LM1070-v4__setgroups
+.LM1070:
+	pop %ebx
+	leave
+	ret
+.Lfe120:
+	.size	 v4__setgroups,.Lfe120-v4__setgroups
+.stabn	192,0,0,.LBB120-v4__setgroups
+.stabn	224,0,0,.LBE120-v4__setgroups
+.Lscope120:
+.stabs	"",36,0,0,.Lscope120-v4__setgroups
+.text
+	.align 4
+.stabs "v4__fchown:F1",36,0,0,v4__fchown
+	.weak v4__fchown
+	.type	v4__fchown,@function
+v4__fchown:
+.stabn 68,0,151,.LMa1071-v4__fchown
+.LMa1071:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic121
+.Lpic121:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic121],%ebx
+0:
+.stabn 68,0,151,.LMb1071-v4__fchown
+.LMb1071:
+.LBB121:
+	mov $207,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE121:
+.stabn 68,0,151,.LM1079-v4__fchown
+.LM1079:
+	pop %ebx
+	leave
+	ret
+.Lfe121:
+	.size	 v4__fchown,.Lfe121-v4__fchown
+.stabn	192,0,0,.LBB121-v4__fchown
+.stabn	224,0,0,.LBE121-v4__fchown
+.Lscope121:
+.stabs	"",36,0,0,.Lscope121-v4__fchown
+.text
+	.align 4
+.stabs "v4__setresuid:F1",36,0,0,v4__setresuid
+	.weak v4__setresuid
+	.type	v4__setresuid,@function
+v4__setresuid:
+.stabn 68,0,152,.LMa1080-v4__setresuid
+.LMa1080:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic122
+.Lpic122:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic122],%ebx
+0:
+.stabn 68,0,152,.LMb1080-v4__setresuid
+.LMb1080:
+.LBB122:
+	mov $208,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE122:
+.stabn 68,0,152,.LM1088-v4__setresuid
+.LM1088:
+	pop %ebx
+	leave
+	ret
+.Lfe122:
+	.size	 v4__setresuid,.Lfe122-v4__setresuid
+.stabn	192,0,0,.LBB122-v4__setresuid
+.stabn	224,0,0,.LBE122-v4__setresuid
+.Lscope122:
+.stabs	"",36,0,0,.Lscope122-v4__setresuid
+.text
+	.align 4
+.stabs "v4__getresuid:F1",36,0,0,v4__getresuid
+	.weak v4__getresuid
+	.type	v4__getresuid,@function
+v4__getresuid:
+.stabn 68,0,153,.LMa1089-v4__getresuid
+.LMa1089:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic123
+.Lpic123:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic123],%ebx
+0:
+.stabn 68,0,153,.LMb1089-v4__getresuid
+.LMb1089:
+.LBB123:
+	mov $209,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE123:
+.stabn 68,0,153,.LM1097-v4__getresuid
+.LM1097:
+	pop %ebx
+	leave
+	ret
+.Lfe123:
+	.size	 v4__getresuid,.Lfe123-v4__getresuid
+.stabn	192,0,0,.LBB123-v4__getresuid
+.stabn	224,0,0,.LBE123-v4__getresuid
+.Lscope123:
+.stabs	"",36,0,0,.Lscope123-v4__getresuid
+.text
+	.align 4
+.stabs "v4__setresgid:F1",36,0,0,v4__setresgid
+	.weak v4__setresgid
+	.type	v4__setresgid,@function
+v4__setresgid:
+.stabn 68,0,154,.LMa1098-v4__setresgid
+.LMa1098:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic124
+.Lpic124:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic124],%ebx
+0:
+.stabn 68,0,154,.LMb1098-v4__setresgid
+.LMb1098:
+.LBB124:
+	mov $210,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE124:
+.stabn 68,0,154,.LM1106-v4__setresgid
+.LM1106:
+	pop %ebx
+	leave
+	ret
+.Lfe124:
+	.size	 v4__setresgid,.Lfe124-v4__setresgid
+.stabn	192,0,0,.LBB124-v4__setresgid
+.stabn	224,0,0,.LBE124-v4__setresgid
+.Lscope124:
+.stabs	"",36,0,0,.Lscope124-v4__setresgid
+.text
+	.align 4
+.stabs "v4__getresgid:F1",36,0,0,v4__getresgid
+	.weak v4__getresgid
+	.type	v4__getresgid,@function
+v4__getresgid:
+.stabn 68,0,155,.LMa1107-v4__getresgid
+.LMa1107:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic125
+.Lpic125:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic125],%ebx
+0:
+.stabn 68,0,155,.LMb1107-v4__getresgid
+.LMb1107:
+.LBB125:
+	mov $211,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE125:
+.stabn 68,0,155,.LM1115-v4__getresgid
+.LM1115:
+	pop %ebx
+	leave
+	ret
+.Lfe125:
+	.size	 v4__getresgid,.Lfe125-v4__getresgid
+.stabn	192,0,0,.LBB125-v4__getresgid
+.stabn	224,0,0,.LBE125-v4__getresgid
+.Lscope125:
+.stabs	"",36,0,0,.Lscope125-v4__getresgid
+.text
+	.align 4
+.stabs "v4__chown:F1",36,0,0,v4__chown
+	.weak v4__chown
+	.type	v4__chown,@function
+v4__chown:
+.stabn 68,0,156,.LMa1116-v4__chown
+.LMa1116:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic126
+.Lpic126:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic126],%ebx
+0:
+.stabn 68,0,156,.LMb1116-v4__chown
+.LMb1116:
+.LBB126:
+	mov $212,%eax
+	call v4__dpush@PLT
+	mov $3,%eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE126:
+.stabn 68,0,156,.LM1124-v4__chown
+.LM1124:
+	pop %ebx
+	leave
+	ret
+.Lfe126:
+	.size	 v4__chown,.Lfe126-v4__chown
+.stabn	192,0,0,.LBB126-v4__chown
+.stabn	224,0,0,.LBE126-v4__chown
+.Lscope126:
+.stabs	"",36,0,0,.Lscope126-v4__chown
+.text
+	.align 4
+.stabs "v4__setuid:F1",36,0,0,v4__setuid
+	.weak v4__setuid
+	.type	v4__setuid,@function
+v4__setuid:
+.stabn 68,0,157,.LMa1125-v4__setuid
+.LMa1125:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic127
+.Lpic127:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic127],%ebx
+0:
+.stabn 68,0,157,.LMb1125-v4__setuid
+.LMb1125:
+.LBB127:
+	mov $213,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE127:
+.stabn 68,0,157,.LM1133-v4__setuid
+.LM1133:
+	pop %ebx
+	leave
+	ret
+.Lfe127:
+	.size	 v4__setuid,.Lfe127-v4__setuid
+.stabn	192,0,0,.LBB127-v4__setuid
+.stabn	224,0,0,.LBE127-v4__setuid
+.Lscope127:
+.stabs	"",36,0,0,.Lscope127-v4__setuid
+.text
+	.align 4
+.stabs "v4__setgid:F1",36,0,0,v4__setgid
+	.weak v4__setgid
+	.type	v4__setgid,@function
+v4__setgid:
+.stabn 68,0,158,.LMa1134-v4__setgid
+.LMa1134:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	call .Lpic128
+.Lpic128:
+	pop %ebx
+	add $_GLOBAL_OFFSET_TABLE_+[.-.Lpic128],%ebx
+0:
+.stabn 68,0,158,.LMb1134-v4__setgid
+.LMb1134:
+.LBB128:
+	mov $214,%eax
+	call v4__dpush@PLT
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+	mov v4__post_syscall@GOT(%ebx),%ecx
+	pop %ebx
+	leave
+	jmp *%ecx
+.LBE128:
+.stabn 68,0,158,.LM1142-v4__setgid
+.LM1142:
+	pop %ebx
+	leave
+	ret
+.Lfe128:
+	.size	 v4__setgid,.Lfe128-v4__setgid
+.stabn	192,0,0,.LBB128-v4__setgid
+.stabn	224,0,0,.LBE128-v4__setgid
+.Lscope128:
+.stabs	"",36,0,0,.Lscope128-v4__setgid
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,13949 @@
+	.file	"core.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/testsuite/",100,0,0,Ltext0
+.stabs	"core.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC32:
+	.string "  SIGNED: "
+.LC18:
+	.string "--"
+.LC19:
+	.string "01"
+.LC20:
+	.string "1"
+.LC21:
+	.string "10"
+.LC17:
+	.string "BA"
+.LC29:
+	.string "LINE 1"
+.LC30:
+	.string "LINE 2"
+.LC35:
+	.string "PLEASE TYPE UP TO 80 CHARACTERS:"
+.LC36:
+	.string "RECEIVED: "
+.LC13:
+	.string "TESTING ' ['] FIND EXECUTE IMMEDIATE COUNT LITERAL POSTPONE STATE"
+.LC2:
+	.string "TESTING 2* 2/ LSHIFT RSHIFT"
+.LC16:
+	.string "TESTING <# # #S #> HOLD SIGN BASE >NUMBER HEX DECIMAL"
+.LC6:
+	.string "TESTING >R R> R@"
+.LC7:
+	.string "TESTING ADD/SUBTRACT: + - 1+ 1- ABS NEGATE"
+.LC1:
+	.string "TESTING BOOLEANS: INVERT AND OR XOR"
+.LC4:
+	.string "TESTING CELL WIDTH LITERALS"
+.LC11:
+	.string "TESTING CHAR [CHAR] [ ] BL S_quotes"
+.LC3:
+	.string "TESTING COMPARISONS: 0= = 0< < > U< U> U<= U>= MIN MAX"
+.LC0:
+	.string "TESTING CORE WORDS"
+.LC9:
+	.string "TESTING DIVIDE: FM/MOD SM/REM UM/MOD */ */MOD / /MOD MOD"
+.LC15:
+	.string "TESTING DO LOOP +LOOP I J UNLOOP LEAVE EXIT"
+.LC22:
+	.string "TESTING FILL MOVE"
+.LC10:
+	.string "TESTING HERE , @ ! CELL+ CELLS C, C@ C! CHARS 2@ 2! ALIGN ALIGNED +! ALLOT"
+.LC14:
+	.string "TESTING IF ELSE THEN BEGIN WHILE REPEAT UNTIL RECURSE"
+.LC34:
+	.string "TESTING INPUT: ACCEPT"
+.LC8:
+	.string "TESTING MULTIPLY: S>D * M* UM*"
+.LC23:
+	.string "TESTING OUTPUT: . ._quote CR EMIT SPACE SPACES TYPE U."
+.LC5:
+	.string "TESTING STACK OPS: 2DROP 2DUP 2OVER 2SWAP ?DUP DEPTH DROP DUP OVER ROT SWAP"
+.LC33:
+	.string "UNSIGNED: "
+.LC12:
+	.string "XY"
+.LC27:
+	.string "YOU SHOULD SEE 0-5 SEPARATED BY TWO SPACES:"
+.LC25:
+	.string "YOU SHOULD SEE 0-9 (WITH NO SPACES):"
+.LC24:
+	.string "YOU SHOULD SEE 0-9 SEPARATED BY A SPACE:"
+.LC26:
+	.string "YOU SHOULD SEE A-G SEPARATED BY A SPACE:"
+.LC31:
+	.string "YOU SHOULD SEE THE NUMBER RANGES OF SIGNED AND UNSIGNED NUMBERS:"
+.LC28:
+	.string "YOU SHOULD SEE TWO SEPARATE LINES:"
+.stabs	"v4_Hashbits_Minusud:G2",40,0,0,v4_Hashbits_Minusud
+	.comm  v4_Hashbits_Minusud,4,4
+.stabs	"v4_Lessfalse_Greater:G2",40,0,0,v4_Lessfalse_Greater
+	.comm  v4_Lessfalse_Greater,4,4
+.stabs	"v4_Lesstrue_Greater:G2",40,0,0,v4_Lesstrue_Greater
+	.comm  v4_Lesstrue_Greater,4,4
+.stabs	"v4_abuf:Gar2;0;79;4",40,0,0,v4_abuf
+	.comm  v4_abuf,80,32
+.stabs	"v4_fbuf:Gar2;0;2;4",40,0,0,v4_fbuf
+	.comm  v4_fbuf,3,1
+.stabs	"v4_gn_Minusbuf:Gar2;0;9;4",40,0,0,v4_gn_Minusbuf
+	.comm  v4_gn_Minusbuf,10,1
+.stabs	"v4_hbuf:Gar2;0;255;4",40,0,0,v4_hbuf
+	.comm  v4_hbuf,256,32
+.stabs	"v4_max_Minusbase:G2",40,0,0,v4_max_Minusbase
+	.comm  v4_max_Minusbase,4,4
+.stabs	"v4_max_Minusint:G2",40,0,0,v4_max_Minusint
+	.comm  v4_max_Minusint,4,4
+.stabs	"v4_max_Minusuint:G2",40,0,0,v4_max_Minusuint
+	.comm  v4_max_Minusuint,4,4
+.stabs	"v4_mid_Minusuint:G2",40,0,0,v4_mid_Minusuint
+	.comm  v4_mid_Minusuint,4,4
+.stabs	"v4_mid_Minusuint_Plus1:G2",40,0,0,v4_mid_Minusuint_Plus1
+	.comm  v4_mid_Minusuint_Plus1,4,4
+.stabs	"v4_min_Minusint:G2",40,0,0,v4_min_Minusint
+	.comm  v4_min_Minusint,4,4
+.stabs	"v4_msb:G2",40,0,0,v4_msb
+	.comm  v4_msb,4,4
+.stabs	"v4_sbuf:Gar2;0;2;4",40,0,0,v4_sbuf
+	.comm  v4_sbuf,3,1
+.stabs	"v4_x:G2",40,0,0,v4_x
+	.comm  v4_x,4,4
+.stabs	"v4_z0s:G2",40,0,0,v4_z0s
+	.comm  v4_z0s,4,4
+.stabs	"v4_z1s:G2",40,0,0,v4_z1s
+	.comm  v4_z1s,4,4
+.stabs	"v4_z1st:G2",40,0,0,v4_z1st
+	.comm  v4_z1st,4,4
+.stabs	"v4_z1stc:G2",40,0,0,v4_z1stc
+	.comm  v4_z1stc,4,4
+.stabs	"v4_z2nd:G2",40,0,0,v4_z2nd
+	.comm  v4_z2nd,4,4
+.stabs	"v4_z2ndc:G2",40,0,0,v4_z2ndc
+	.comm  v4_z2ndc,4,4
+.text
+	.align 4
+.stabs "v4_find_Minusmsb:F1",36,0,0,v4_find_Minusmsb
+.globl v4_find_Minusmsb
+	.type	v4_find_Minusmsb,@function
+v4_find_Minusmsb:
+.stabn 68,0,53,.LMa0-v4_find_Minusmsb
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,53,.LMb0-v4_find_Minusmsb
+.LMb0:
+.LBB15:
+.stabn 68,0,54,.LM1-v4_find_Minusmsb
+.LM1:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.L2:
+	call v4_dup
+	call v4__dpop
+	add %eax,%eax
+	je .L3
+	call v4__dpop
+	add %eax,%eax
+	call v4__dpush
+	jmp .L2
+.L3:
+.LBE15:
+.stabn 68,0,54,.LM18-v4_find_Minusmsb
+.LM18:
+	pop %ebx
+	leave
+	ret
+.Lfe15:
+	.size	 v4_find_Minusmsb,.Lfe15-v4_find_Minusmsb
+.stabn	192,0,0,.LBB15-v4_find_Minusmsb
+.stabn	224,0,0,.LBE15-v4_find_Minusmsb
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4_find_Minusmsb
+.text
+	.align 4
+.stabs "v4_gr1:F1",36,0,0,v4_gr1
+.globl v4_gr1
+	.type	v4_gr1,@function
+v4_gr1:
+.stabn 68,0,262,.LMa19-v4_gr1
+.LMa19:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,262,.LMb19-v4_gr1
+.LMb19:
+.LBB52:
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	mov -8(%ebp),%eax
+	call v4__dpush
+.LBE52:
+.stabn 68,0,262,.LM27-v4_gr1
+.LM27:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe52:
+	.size	 v4_gr1,.Lfe52-v4_gr1
+.stabn	192,0,0,.LBB52-v4_gr1
+.stabn	224,0,0,.LBE52-v4_gr1
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4_gr1
+.text
+	.align 4
+.stabs "v4_gr2:F1",36,0,0,v4_gr2
+.globl v4_gr2
+	.type	v4_gr2,@function
+v4_gr2:
+.stabn 68,0,263,.LMa28-v4_gr2
+.LMa28:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,263,.LMb28-v4_gr2
+.LMb28:
+.LBB55:
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	mov -8(%ebp),%eax
+	call v4__dpush
+	mov -8(%ebp),%eax
+	call v4__dpush
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE55:
+.stabn 68,0,263,.LM40-v4_gr2
+.LM40:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe55:
+	.size	 v4_gr2,.Lfe55-v4_gr2
+.stabn	192,0,0,.LBB55-v4_gr2
+.stabn	224,0,0,.LBE55-v4_gr2
+.Lscope55:
+.stabs	"",36,0,0,.Lscope55-v4_gr2
+.text
+	.align 4
+.stabs "v4_t_Slashmod:F1",36,0,0,v4_t_Slashmod
+.globl v4_t_Slashmod
+	.type	v4_t_Slashmod,@function
+v4_t_Slashmod:
+.stabn 68,0,459,.LMa41-v4_t_Slashmod
+.LMa41:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,459,.LMb41-v4_t_Slashmod
+.LMb41:
+.LBB69:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	pop %ebx
+	leave
+	jmp v4_sm_Slashrem
+.LBE69:
+.stabn 68,0,459,.LM47-v4_t_Slashmod
+.LM47:
+	pop %ebx
+	leave
+	ret
+.Lfe69:
+	.size	 v4_t_Slashmod,.Lfe69-v4_t_Slashmod
+.stabn	192,0,0,.LBB69-v4_t_Slashmod
+.stabn	224,0,0,.LBE69-v4_t_Slashmod
+.Lscope69:
+.stabs	"",36,0,0,.Lscope69-v4_t_Slashmod
+.text
+	.align 4
+.stabs "v4_t_Slash:F1",36,0,0,v4_t_Slash
+.globl v4_t_Slash
+	.type	v4_t_Slash,@function
+v4_t_Slash:
+.stabn 68,0,460,.LMa48-v4_t_Slash
+.LMa48:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,460,.LMb48-v4_t_Slash
+.LMb48:
+.LBB70:
+.stabn 68,0,459,.LM50-v4_t_Slash
+.LM50:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM54-v4_t_Slash
+.LM54:
+	call v4_swap
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE70:
+.stabn 68,0,460,.LM57-v4_t_Slash
+.LM57:
+	pop %ebx
+	leave
+	ret
+.Lfe70:
+	.size	 v4_t_Slash,.Lfe70-v4_t_Slash
+.stabn	192,0,0,.LBB70-v4_t_Slash
+.stabn	224,0,0,.LBE70-v4_t_Slash
+.Lscope70:
+.stabs	"",36,0,0,.Lscope70-v4_t_Slash
+.text
+	.align 4
+.stabs "v4_tmod:F1",36,0,0,v4_tmod
+.globl v4_tmod
+	.type	v4_tmod,@function
+v4_tmod:
+.stabn 68,0,461,.LMa58-v4_tmod
+.LMa58:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,461,.LMb58-v4_tmod
+.LMb58:
+.LBB71:
+.stabn 68,0,459,.LM60-v4_tmod
+.LM60:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM64-v4_tmod
+.LM64:
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE71:
+.stabn 68,0,461,.LM66-v4_tmod
+.LM66:
+	pop %ebx
+	leave
+	ret
+.Lfe71:
+	.size	 v4_tmod,.Lfe71-v4_tmod
+.stabn	192,0,0,.LBB71-v4_tmod
+.stabn	224,0,0,.LBE71-v4_tmod
+.Lscope71:
+.stabs	"",36,0,0,.Lscope71-v4_tmod
+.text
+	.align 4
+.stabs "v4_t_Star_Slashmod:F1",36,0,0,v4_t_Star_Slashmod
+.globl v4_t_Star_Slashmod
+	.type	v4_t_Star_Slashmod,@function
+v4_t_Star_Slashmod:
+.stabn 68,0,462,.LMa67-v4_t_Star_Slashmod
+.LMa67:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,462,.LMb67-v4_t_Star_Slashmod
+.LMb67:
+.LBB72:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	pop %ebx
+	leave
+	jmp v4_sm_Slashrem
+.LBE72:
+.stabn 68,0,462,.LM73-v4_t_Star_Slashmod
+.LM73:
+	pop %ebx
+	leave
+	ret
+.Lfe72:
+	.size	 v4_t_Star_Slashmod,.Lfe72-v4_t_Star_Slashmod
+.stabn	192,0,0,.LBB72-v4_t_Star_Slashmod
+.stabn	224,0,0,.LBE72-v4_t_Star_Slashmod
+.Lscope72:
+.stabs	"",36,0,0,.Lscope72-v4_t_Star_Slashmod
+.text
+	.align 4
+.stabs "v4_t_Star_Slash:F1",36,0,0,v4_t_Star_Slash
+.globl v4_t_Star_Slash
+	.type	v4_t_Star_Slash,@function
+v4_t_Star_Slash:
+.stabn 68,0,463,.LMa74-v4_t_Star_Slash
+.LMa74:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,463,.LMb74-v4_t_Star_Slash
+.LMb74:
+.LBB73:
+.stabn 68,0,462,.LM76-v4_t_Star_Slash
+.LM76:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM80-v4_t_Star_Slash
+.LM80:
+	call v4_swap
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE73:
+.stabn 68,0,463,.LM83-v4_t_Star_Slash
+.LM83:
+	pop %ebx
+	leave
+	ret
+.Lfe73:
+	.size	 v4_t_Star_Slash,.Lfe73-v4_t_Star_Slash
+.stabn	192,0,0,.LBB73-v4_t_Star_Slash
+.stabn	224,0,0,.LBE73-v4_t_Star_Slash
+.Lscope73:
+.stabs	"",36,0,0,.Lscope73-v4_t_Star_Slash
+.text
+	.align 4
+.stabs "v4_gc1:F1",36,0,0,v4_gc1
+.globl v4_gc1
+	.type	v4_gc1,@function
+v4_gc1:
+.stabn 68,0,633,.LMa84-v4_gc1
+.LMa84:
+.stabn 68,0,633,.LMb84-v4_gc1
+.LMb84:
+.LBB102:
+	mov $88,%eax
+	call v4__dpush
+.LBE102:
+.stabn 68,0,633,.LM88-v4_gc1
+.LM88:
+	ret
+.Lfe102:
+	.size	 v4_gc1,.Lfe102-v4_gc1
+.stabn	192,0,0,.LBB102-v4_gc1
+.stabn	224,0,0,.LBE102-v4_gc1
+.Lscope102:
+.stabs	"",36,0,0,.Lscope102-v4_gc1
+.text
+	.align 4
+.stabs "v4_gc2:F1",36,0,0,v4_gc2
+.globl v4_gc2
+	.type	v4_gc2,@function
+v4_gc2:
+.stabn 68,0,634,.LMa89-v4_gc2
+.LMa89:
+.stabn 68,0,634,.LMb89-v4_gc2
+.LMb89:
+.LBB103:
+	mov $72,%eax
+	call v4__dpush
+.LBE103:
+.stabn 68,0,634,.LM93-v4_gc2
+.LM93:
+	ret
+.Lfe103:
+	.size	 v4_gc2,.Lfe103-v4_gc2
+.stabn	192,0,0,.LBB103-v4_gc2
+.stabn	224,0,0,.LBE103-v4_gc2
+.Lscope103:
+.stabs	"",36,0,0,.Lscope103-v4_gc2
+.text
+	.align 4
+.stabs "v4_gc3:F1",36,0,0,v4_gc3
+.globl v4_gc3
+	.type	v4_gc3,@function
+v4_gc3:
+.stabn 68,0,637,.LMa94-v4_gc3
+.LMa94:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,637,.LMb94-v4_gc3
+.LMb94:
+.LBB104:
+	call v4_Leftbracket
+.stabn 68,0,633,.LM97-v4_gc3
+.LM97:
+	mov $88,%eax
+	call v4__dpush
+.stabn 68,0,637,.LM99-v4_gc3
+.LM99:
+	call v4_Rightbracket
+	pop %ebx
+	leave
+	jmp v4_literal
+.LBE104:
+.stabn 68,0,637,.LM102-v4_gc3
+.LM102:
+	pop %ebx
+	leave
+	ret
+.Lfe104:
+	.size	 v4_gc3,.Lfe104-v4_gc3
+.stabn	192,0,0,.LBB104-v4_gc3
+.stabn	224,0,0,.LBE104-v4_gc3
+.Lscope104:
+.stabs	"",36,0,0,.Lscope104-v4_gc3
+.text
+	.align 4
+.stabs "v4_gc4:F1",36,0,0,v4_gc4
+.globl v4_gc4
+	.type	v4_gc4,@function
+v4_gc4:
+.stabn 68,0,639,.LMa103-v4_gc4
+.LMa103:
+.stabn 68,0,639,.LMb103-v4_gc4
+.LMb103:
+.LBB108:
+	lea .LC12,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+.LBE108:
+.stabn 68,0,639,.LM109-v4_gc4
+.LM109:
+	ret
+.Lfe108:
+	.size	 v4_gc4,.Lfe108-v4_gc4
+.stabn	192,0,0,.LBB108-v4_gc4
+.stabn	224,0,0,.LBE108-v4_gc4
+.Lscope108:
+.stabs	"",36,0,0,.Lscope108-v4_gc4
+.text
+	.align 4
+.stabs "v4_gt1:F1",36,0,0,v4_gt1
+.globl v4_gt1
+	.type	v4_gt1,@function
+v4_gt1:
+.stabn 68,0,646,.LMa110-v4_gt1
+.LMa110:
+.stabn 68,0,646,.LMb110-v4_gt1
+.LMb110:
+.LBB109:
+	mov $123,%eax
+	call v4__dpush
+.LBE109:
+.stabn 68,0,646,.LM114-v4_gt1
+.LM114:
+	ret
+.Lfe109:
+	.size	 v4_gt1,.Lfe109-v4_gt1
+.stabn	192,0,0,.LBB109-v4_gt1
+.stabn	224,0,0,.LBE109-v4_gt1
+.Lscope109:
+.stabs	"",36,0,0,.Lscope109-v4_gt1
+.text
+	.align 4
+.stabs "v4_gt2:F1",36,0,0,v4_gt2
+.globl v4_gt2
+	.type	v4_gt2,@function
+v4_gt2:
+.stabn 68,0,648,.LMa115-v4_gt2
+.LMa115:
+.stabn 68,0,648,.LMb115-v4_gt2
+.LMb115:
+.LBB110:
+	lea v4_gt1,%eax
+	call v4__dpush
+.LBE110:
+.stabn 68,0,648,.LM119-v4_gt2
+.LM119:
+	ret
+.Lfe110:
+	.size	 v4_gt2,.Lfe110-v4_gt2
+.stabn	192,0,0,.LBB110-v4_gt2
+.stabn	224,0,0,.LBE110-v4_gt2
+.Lscope110:
+.stabs	"",36,0,0,.Lscope110-v4_gt2
+.text
+	.align 4
+.stabs "v4_gt8:F1",36,0,0,v4_gt8
+.globl v4_gt8
+	.type	v4_gt8,@function
+v4_gt8:
+.stabn 68,0,666,.LMa120-v4_gt8
+.LMa120:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,666,.LMb120-v4_gt8
+.LMb120:
+.LBB112:
+	call v4_state
+	pop %ebx
+	leave
+	jmp v4_Fetch
+.LBE112:
+.stabn 68,0,666,.LM124-v4_gt8
+.LM124:
+	pop %ebx
+	leave
+	ret
+.Lfe112:
+	.size	 v4_gt8,.Lfe112-v4_gt8
+.stabn	192,0,0,.LBB112-v4_gt8
+.stabn	224,0,0,.LBE112-v4_gt8
+.Lscope112:
+.stabs	"",36,0,0,.Lscope112-v4_gt8
+.text
+	.align 4
+.stabs "v4_gt9:F1",36,0,0,v4_gt9
+.globl v4_gt9
+	.type	v4_gt9,@function
+v4_gt9:
+.stabn 68,0,668,.LMa125-v4_gt9
+.LMa125:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,668,.LMb125-v4_gt9
+.LMb125:
+.LBB114:
+	lea v4_gt8,%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_literal
+.LBE114:
+.stabn 68,0,668,.LM130-v4_gt9
+.LM130:
+	pop %ebx
+	leave
+	ret
+.Lfe114:
+	.size	 v4_gt9,.Lfe114-v4_gt9
+.stabn	192,0,0,.LBB114-v4_gt9
+.stabn	224,0,0,.LBE114-v4_gt9
+.Lscope114:
+.stabs	"",36,0,0,.Lscope114-v4_gt9
+.text
+	.align 4
+.stabs "v4_gi1:F1",36,0,0,v4_gi1
+.globl v4_gi1
+	.type	v4_gi1,@function
+v4_gi1:
+.stabn 68,0,674,.LMa131-v4_gi1
+.LMa131:
+.stabn 68,0,674,.LMb131-v4_gi1
+.LMb131:
+.LBB115:
+	call v4__dpop
+	test %eax,%eax
+	je .L20
+	mov $123,%eax
+	call v4__dpush
+.L20:
+.LBE115:
+.stabn 68,0,674,.LM138-v4_gi1
+.LM138:
+	ret
+.Lfe115:
+	.size	 v4_gi1,.Lfe115-v4_gi1
+.stabn	192,0,0,.LBB115-v4_gi1
+.stabn	224,0,0,.LBE115-v4_gi1
+.Lscope115:
+.stabs	"",36,0,0,.Lscope115-v4_gi1
+.text
+	.align 4
+.stabs "v4_gi2:F1",36,0,0,v4_gi2
+.globl v4_gi2
+	.type	v4_gi2,@function
+v4_gi2:
+.stabn 68,0,675,.LMa139-v4_gi2
+.LMa139:
+.stabn 68,0,675,.LMb139-v4_gi2
+.LMb139:
+.LBB116:
+	call v4__dpop
+	test %eax,%eax
+	je .L22
+	mov $123,%eax
+	call v4__dpush
+	jmp .L23
+.L22:
+	mov $234,%eax
+	call v4__dpush
+.L23:
+.LBE116:
+.stabn 68,0,675,.LM150-v4_gi2
+.LM150:
+	ret
+.Lfe116:
+	.size	 v4_gi2,.Lfe116-v4_gi2
+.stabn	192,0,0,.LBB116-v4_gi2
+.stabn	224,0,0,.LBE116-v4_gi2
+.Lscope116:
+.stabs	"",36,0,0,.Lscope116-v4_gi2
+.text
+	.align 4
+.stabs "v4_gi3:F1",36,0,0,v4_gi3
+.globl v4_gi3
+	.type	v4_gi3,@function
+v4_gi3:
+.stabn 68,0,683,.LMa151-v4_gi3
+.LMa151:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,683,.LMb151-v4_gi3
+.LMb151:
+.LBB117:
+.L25:
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L26
+	call v4_dup
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	jmp .L25
+.L26:
+.LBE117:
+.stabn 68,0,683,.LM170-v4_gi3
+.LM170:
+	pop %ebx
+	leave
+	ret
+.Lfe117:
+	.size	 v4_gi3,.Lfe117-v4_gi3
+.stabn	192,0,0,.LBB117-v4_gi3
+.stabn	224,0,0,.LBE117-v4_gi3
+.Lscope117:
+.stabs	"",36,0,0,.Lscope117-v4_gi3
+.text
+	.align 4
+.stabs "v4_gi4:F1",36,0,0,v4_gi4
+.globl v4_gi4
+	.type	v4_gi4,@function
+v4_gi4:
+.stabn 68,0,689,.LMa171-v4_gi4
+.LMa171:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,689,.LMb171-v4_gi4
+.LMb171:
+.LBB118:
+.L28:
+	call v4_dup
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L28
+.LBE118:
+.stabn 68,0,689,.LM189-v4_gi4
+.LM189:
+	pop %ebx
+	leave
+	ret
+.Lfe118:
+	.size	 v4_gi4,.Lfe118-v4_gi4
+.stabn	192,0,0,.LBB118-v4_gi4
+.stabn	224,0,0,.LBE118-v4_gi4
+.Lscope118:
+.stabs	"",36,0,0,.Lscope118-v4_gi4
+.text
+	.align 4
+.stabs "v4_gi5:F1",36,0,0,v4_gi5
+.globl v4_gi5
+	.type	v4_gi5,@function
+v4_gi5:
+.stabn 68,0,694,.LMa190-v4_gi5
+.LMa190:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,694,.LMb190-v4_gi5
+.LMb190:
+.LBB119:
+.L31:
+	call v4_dup
+	mov $2,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L32
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L32
+	call v4_dup
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	jmp .L31
+.L32:
+.LBE119:
+.stabn 68,0,694,.LM218-v4_gi5
+.LM218:
+	pop %ebx
+	leave
+	ret
+.Lfe119:
+	.size	 v4_gi5,.Lfe119-v4_gi5
+.stabn	192,0,0,.LBB119-v4_gi5
+.stabn	224,0,0,.LBE119-v4_gi5
+.Lscope119:
+.stabs	"",36,0,0,.Lscope119-v4_gi5
+.text
+	.align 4
+.stabs "v4_gi6:F1",36,0,0,v4_gi6
+.globl v4_gi6
+	.type	v4_gi6,@function
+v4_gi6:
+.stabn 68,0,701,.LMa219-v4_gi6
+.LMa219:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,701,.LMb219-v4_gi6
+.LMb219:
+.LBB120:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	je .L34
+	call v4_dup
+	call v4_Greaterr
+	call v4__dpop
+	dec %eax
+	call v4__dpush
+	call v4_gi6
+	pop %ebx
+	leave
+	jmp v4_r_Greater
+.L34:
+.LBE120:
+.stabn 68,0,701,.LM233-v4_gi6
+.LM233:
+	pop %ebx
+	leave
+	ret
+.Lfe120:
+	.size	 v4_gi6,.Lfe120-v4_gi6
+.stabn	192,0,0,.LBB120-v4_gi6
+.stabn	224,0,0,.LBE120-v4_gi6
+.Lscope120:
+.stabs	"",36,0,0,.Lscope120-v4_gi6
+.text
+	.align 4
+.stabs "v4_gd1:F1",36,0,0,v4_gd1
+.globl v4_gd1
+	.type	v4_gd1,@function
+v4_gd1:
+.stabn 68,0,711,.LMa234-v4_gd1
+.LMa234:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,711,.LMb234-v4_gd1
+.LMb234:
+.LBB121:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L37:
+	mov -12(%ebp),%eax
+	call v4__dpush
+	mov -12(%ebp),%edx
+	inc %edx
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	jne .L37
+	mov -8(%ebp),%eax
+.LBE121:
+.stabn 68,0,711,.LM255-v4_gd1
+.LM255:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe121:
+	.size	 v4_gd1,.Lfe121-v4_gd1
+.stabn	192,0,0,.LBB121-v4_gd1
+.stabn	224,0,0,.LBE121-v4_gd1
+.Lscope121:
+.stabs	"",36,0,0,.Lscope121-v4_gd1
+.text
+	.align 4
+.stabs "v4_gd2:F1",36,0,0,v4_gd2
+.globl v4_gd2
+	.type	v4_gd2,@function
+v4_gd2:
+.stabn 68,0,716,.LMa256-v4_gd2
+.LMa256:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,716,.LMb256-v4_gd2
+.LMb256:
+.LBB123:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L41:
+	mov -12(%ebp),%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	mov -12(%ebp),%edx
+	add %eax,%edx
+	test %eax,%eax
+	jl .L43
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	test %edx,%edx
+	jl .L41
+	jmp .L42
+.L43:
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	test %edx,%edx
+	jge .L41
+.L42:
+	mov -8(%ebp),%eax
+.LBE123:
+.stabn 68,0,716,.LM288-v4_gd2
+.LM288:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe123:
+	.size	 v4_gd2,.Lfe123-v4_gd2
+.stabn	192,0,0,.LBB123-v4_gd2
+.stabn	224,0,0,.LBE123-v4_gd2
+.Lscope123:
+.stabs	"",36,0,0,.Lscope123-v4_gd2
+.text
+	.align 4
+.stabs "v4_gd3:F1",36,0,0,v4_gd3
+.globl v4_gd3
+	.type	v4_gd3,@function
+v4_gd3:
+.stabn 68,0,721,.LMa289-v4_gd3
+.LMa289:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,721,.LMb289-v4_gd3
+.LMb289:
+.LBB124:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L46:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	mov %eax,-16(%ebp)
+	mov %edx,-20(%ebp)
+.L49:
+	mov -12(%ebp),%eax
+	call v4__dpush
+	mov -20(%ebp),%edx
+	inc %edx
+	mov -16(%ebp),%eax
+	mov %edx,-20(%ebp)
+	sub %eax,%edx
+	jne .L49
+	mov -16(%ebp),%eax
+	mov -12(%ebp),%edx
+	inc %edx
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	jne .L46
+	mov -8(%ebp),%eax
+.LBE124:
+.stabn 68,0,721,.LM330-v4_gd3
+.LM330:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe124:
+	.size	 v4_gd3,.Lfe124-v4_gd3
+.stabn	192,0,0,.LBB124-v4_gd3
+.stabn	224,0,0,.LBE124-v4_gd3
+.Lscope124:
+.stabs	"",36,0,0,.Lscope124-v4_gd3
+.text
+	.align 4
+.stabs "v4_gd4:F1",36,0,0,v4_gd4
+.globl v4_gd4
+	.type	v4_gd4,@function
+v4_gd4:
+.stabn 68,0,726,.LMa331-v4_gd4
+.LMa331:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,726,.LMb331-v4_gd4
+.LMb331:
+.LBB126:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L53:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	mov %eax,-16(%ebp)
+	mov %edx,-20(%ebp)
+.L56:
+	mov -12(%ebp),%eax
+	call v4__dpush
+	mov -20(%ebp),%edx
+	inc %edx
+	mov -16(%ebp),%eax
+	mov %edx,-20(%ebp)
+	sub %eax,%edx
+	jne .L56
+	mov -16(%ebp),%eax
+	xor %eax,%eax
+	dec %eax
+	mov -12(%ebp),%edx
+	add %eax,%edx
+	test %eax,%eax
+	jl .L58
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	test %edx,%edx
+	jl .L53
+	jmp .L54
+.L58:
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	test %edx,%edx
+	jge .L53
+.L54:
+	mov -8(%ebp),%eax
+.LBE126:
+.stabn 68,0,726,.LM383-v4_gd4
+.LM383:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe126:
+	.size	 v4_gd4,.Lfe126-v4_gd4
+.stabn	192,0,0,.LBB126-v4_gd4
+.stabn	224,0,0,.LBE126-v4_gd4
+.Lscope126:
+.stabs	"",36,0,0,.Lscope126-v4_gd4
+.text
+	.align 4
+.stabs "v4_gd5:F1",36,0,0,v4_gd5
+.globl v4_gd5
+	.type	v4_gd5,@function
+v4_gd5:
+.stabn 68,0,731,.LMa384-v4_gd5
+.LMa384:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,731,.LMb384-v4_gd5
+.LMb384:
+.LBB127:
+	mov $123,%eax
+	call v4__dpush
+	call v4_swap
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L61:
+	call v4_i
+	mov $4,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L63
+	call v4_drop
+	mov $234,%eax
+	call v4__dpush
+	jmp .L62
+.L63:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L61
+.L62:
+	call v4__rpop
+	call v4__rpop
+.LBE127:
+.stabn 68,0,731,.LM421-v4_gd5
+.LM421:
+	pop %ebx
+	leave
+	ret
+.Lfe127:
+	.size	 v4_gd5,.Lfe127-v4_gd5
+.stabn	192,0,0,.LBB127-v4_gd5
+.stabn	224,0,0,.LBE127-v4_gd5
+.Lscope127:
+.stabs	"",36,0,0,.Lscope127-v4_gd5
+.text
+	.align 4
+.stabs "v4_gd6:F1",36,0,0,v4_gd6
+.globl v4_gd6
+	.type	v4_gd6,@function
+v4_gd6:
+.stabn 68,0,736,.LMa422-v4_gd6
+.LMa422:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,736,.LMb422-v4_gd6
+.LMb422:
+.LBB128:
+.stabn 68,0,737,.LM423-v4_gd6
+.LM423:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_swap
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L66:
+	mov -12(%ebp),%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	mov %eax,-16(%ebp)
+	mov %edx,-20(%ebp)
+.L69:
+	mov -20(%ebp),%eax
+	mov %eax,%ecx
+	mov -12(%ebp),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	mov %eax,%ecx
+	mov $3,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jne .L71
+	mov -20(%ebp),%eax
+	call v4__dpush
+	mov -12(%ebp),%eax
+	call v4__dpush
+	jmp .L64
+.L71:
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	mov -20(%ebp),%edx
+	inc %edx
+	mov -16(%ebp),%eax
+	mov %edx,-20(%ebp)
+	sub %eax,%edx
+	jne .L69
+	mov -16(%ebp),%eax
+.stabn 68,0,739,.LM491-v4_gd6
+.LM491:
+	mov -12(%ebp),%edx
+	inc %edx
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	jne .L66
+	mov -8(%ebp),%eax
+.L64:
+.LBE128:
+.stabn 68,0,739,.LM503-v4_gd6
+.LM503:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe128:
+	.size	 v4_gd6,.Lfe128-v4_gd6
+.stabn	192,0,0,.LBB128-v4_gd6
+.stabn	224,0,0,.LBE128-v4_gd6
+.Lscope128:
+.stabs	"",36,0,0,.Lscope128-v4_gd6
+.text
+	.align 4
+.stabs "v4_s_Equals:F1",36,0,0,v4_s_Equals
+.globl v4_s_Equals
+	.type	v4_s_Equals,@function
+v4_s_Equals:
+.stabn 68,0,826,.LMa504-v4_s_Equals
+.LMa504:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,826,.LMb504-v4_s_Equals
+.LMb504:
+.LBB130:
+.stabn 68,0,827,.LM505-v4_s_Equals
+.LM505:
+	call v4_Greaterr
+	call v4_swap
+	call v4_r_Fetch
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L73
+.stabn 68,0,828,.LM514-v4_s_Equals
+.LM514:
+	call v4_r_Greater
+	call v4_Questiondup
+	call v4__dpop
+	test %eax,%eax
+	je .L74
+.stabn 68,0,829,.LM518-v4_s_Equals
+.LM518:
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L76:
+.stabn 68,0,830,.LM525-v4_s_Equals
+.LM525:
+	call v4_over
+	call v4_c_Fetch
+	call v4_over
+	call v4_c_Fetch
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	sub %edx,%eax
+	je .L78
+	call v4_z2drop
+	xor %eax,%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_unloop
+.L78:
+.stabn 68,0,831,.LM542-v4_s_Equals
+.LM542:
+	call v4_swap
+	call v4_char_Plus
+	call v4_swap
+	call v4_char_Plus
+.stabn 68,0,832,.LM546-v4_s_Equals
+.LM546:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L76
+	call v4__rpop
+	call v4__rpop
+.L74:
+.stabn 68,0,834,.LM558-v4_s_Equals
+.LM558:
+	call v4_z2drop
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,835,.LM561-v4_s_Equals
+.LM561:
+	jmp .L79
+.L73:
+.stabn 68,0,836,.LM563-v4_s_Equals
+.LM563:
+	call v4_r_Greater
+	call v4_drop
+	call v4_z2drop
+	xor %eax,%eax
+	call v4__dpush
+.L79:
+.L72:
+.LBE130:
+.stabn 68,0,837,.LM570-v4_s_Equals
+.LM570:
+	pop %ebx
+	leave
+	ret
+.Lfe130:
+	.size	 v4_s_Equals,.Lfe130-v4_s_Equals
+.stabn	192,0,0,.LBB130-v4_s_Equals
+.stabn	224,0,0,.LBE130-v4_s_Equals
+.Lscope130:
+.stabs	"",36,0,0,.Lscope130-v4_s_Equals
+.text
+	.align 4
+.stabs "v4_gp1:F1",36,0,0,v4_gp1
+.globl v4_gp1
+	.type	v4_gp1,@function
+v4_gp1:
+.stabn 68,0,839,.LMa571-v4_gp1
+.LMa571:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,839,.LMb571-v4_gp1
+.LMb571:
+.LBB131:
+	call v4_Less_Hash
+	mov $65,%eax
+	call v4__dpush
+	call v4_hold
+	mov $66,%eax
+	call v4__dpush
+	call v4_hold
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Hash_Greater
+	lea .LC17,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_s_Equals
+.LBE131:
+.stabn 68,0,839,.LM590-v4_gp1
+.LM590:
+	pop %ebx
+	leave
+	ret
+.Lfe131:
+	.size	 v4_gp1,.Lfe131-v4_gp1
+.stabn	192,0,0,.LBB131-v4_gp1
+.stabn	224,0,0,.LBE131-v4_gp1
+.Lscope131:
+.stabs	"",36,0,0,.Lscope131-v4_gp1
+.text
+	.align 4
+.stabs "v4_gp2:F1",36,0,0,v4_gp2
+.globl v4_gp2
+	.type	v4_gp2,@function
+v4_gp2:
+.stabn 68,0,842,.LMa591-v4_gp2
+.LMa591:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,842,.LMb591-v4_gp2
+.LMb591:
+.LBB135:
+	call v4_Less_Hash
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_sign
+	xor %eax,%eax
+	call v4__dpush
+	call v4_sign
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_sign
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Hash_Greater
+	lea .LC18,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_s_Equals
+.LBE135:
+.stabn 68,0,842,.LM613-v4_gp2
+.LM613:
+	pop %ebx
+	leave
+	ret
+.Lfe135:
+	.size	 v4_gp2,.Lfe135-v4_gp2
+.stabn	192,0,0,.LBB135-v4_gp2
+.stabn	224,0,0,.LBE135-v4_gp2
+.Lscope135:
+.stabs	"",36,0,0,.Lscope135-v4_gp2
+.text
+	.align 4
+.stabs "v4_gp3:F1",36,0,0,v4_gp3
+.globl v4_gp3
+	.type	v4_gp3,@function
+v4_gp3:
+.stabn 68,0,845,.LMa614-v4_gp3
+.LMa614:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,845,.LMb614-v4_gp3
+.LMb614:
+.LBB137:
+	call v4_Less_Hash
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Hash
+	call v4_Hash
+	call v4_Hash_Greater
+	lea .LC19,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_s_Equals
+.LBE137:
+.stabn 68,0,845,.LM629-v4_gp3
+.LM629:
+	pop %ebx
+	leave
+	ret
+.Lfe137:
+	.size	 v4_gp3,.Lfe137-v4_gp3
+.stabn	192,0,0,.LBB137-v4_gp3
+.stabn	224,0,0,.LBE137-v4_gp3
+.Lscope137:
+.stabs	"",36,0,0,.Lscope137-v4_gp3
+.text
+	.align 4
+.stabs "v4_gp4:F1",36,0,0,v4_gp4
+.globl v4_gp4
+	.type	v4_gp4,@function
+v4_gp4:
+.stabn 68,0,848,.LMa630-v4_gp4
+.LMa630:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,848,.LMb630-v4_gp4
+.LMb630:
+.LBB139:
+	call v4_Less_Hash
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Hashs
+	call v4_Hash_Greater
+	lea .LC20,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_s_Equals
+.LBE139:
+.stabn 68,0,848,.LM644-v4_gp4
+.LM644:
+	pop %ebx
+	leave
+	ret
+.Lfe139:
+	.size	 v4_gp4,.Lfe139-v4_gp4
+.stabn	192,0,0,.LBB139-v4_gp4
+.stabn	224,0,0,.LBE139-v4_gp4
+.Lscope139:
+.stabs	"",36,0,0,.Lscope139-v4_gp4
+.text
+	.align 4
+.stabs "v4_count_Minusbits:F1",36,0,0,v4_count_Minusbits
+.globl v4_count_Minusbits
+	.type	v4_count_Minusbits,@function
+v4_count_Minusbits:
+.stabn 68,0,852,.LMa645-v4_count_Minusbits
+.LMa645:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,852,.LMb645-v4_count_Minusbits
+.LMb645:
+.LBB142:
+.stabn 68,0,853,.LM646-v4_count_Minusbits
+.LM646:
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.L85:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	je .L86
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	mov -8(%ebp),%eax
+	add %eax,%eax
+	call v4__dpush
+	jmp .L85
+.L86:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE142:
+.stabn 68,0,853,.LM673-v4_count_Minusbits
+.LM673:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe142:
+	.size	 v4_count_Minusbits,.Lfe142-v4_count_Minusbits
+.stabn	192,0,0,.LBB142-v4_count_Minusbits
+.stabn	224,0,0,.LBE142-v4_count_Minusbits
+.Lscope142:
+.stabs	"",36,0,0,.Lscope142-v4_count_Minusbits
+.text
+	.align 4
+.stabs "v4_gp5:F1",36,0,0,v4_gp5
+.globl v4_gp5
+	.type	v4_gp5,@function
+v4_gp5:
+.stabn 68,0,856,.LMa674-v4_gp5
+.LMa674:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,856,.LMb674-v4_gp5
+.LMb674:
+.LBB144:
+.stabn 68,0,857,.LM675-v4_gp5
+.LM675:
+	call v4_base
+	call v4_Fetch
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,858,.LM679-v4_gp5
+.LM679:
+	mov $37,%eax
+	mov %eax,%ecx
+	mov $2,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L89:
+.stabn 68,0,859,.LM689-v4_gp5
+.LM689:
+	call v4_i
+	call v4_base
+	call v4_Store
+.stabn 68,0,860,.LM692-v4_gp5
+.LM692:
+	call v4_i
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+	lea .LC21,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_s_Equals
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	and %edx,%eax
+	call v4__dpush
+.stabn 68,0,861,.LM708-v4_gp5
+.LM708:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L89
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,862,.LM719-v4_gp5
+.LM719:
+	call v4_swap
+	call v4_base
+	pop %ebx
+	leave
+	jmp v4_Store
+.LBE144:
+.stabn 68,0,862,.LM723-v4_gp5
+.LM723:
+	pop %ebx
+	leave
+	ret
+.Lfe144:
+	.size	 v4_gp5,.Lfe144-v4_gp5
+.stabn	192,0,0,.LBB144-v4_gp5
+.stabn	224,0,0,.LBE144-v4_gp5
+.Lscope144:
+.stabs	"",36,0,0,.Lscope144-v4_gp5
+.text
+	.align 4
+.stabs "v4_gp6:F1",36,0,0,v4_gp6
+.globl v4_gp6
+	.type	v4_gp6,@function
+v4_gp6:
+.stabn 68,0,865,.LMa724-v4_gp6
+.LMa724:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,865,.LMb724-v4_gp6
+.LMb724:
+.LBB146:
+.stabn 68,0,866,.LM725-v4_gp6
+.LM725:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	mov $2,%eax
+	call v4__dpush
+	call v4_base
+	call v4_Store
+.stabn 68,0,868,.LM732-v4_gp6
+.LM732:
+	call v4_Less_Hash
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Hashs
+	call v4_z2drop
+.stabn 68,0,869,.LM739-v4_gp6
+.LM739:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,870,.LM745-v4_gp6
+.LM745:
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,871,.LM748-v4_gp6
+.LM748:
+	call v4_dup
+	mov (v4_Hashbits_Minusud),%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_swap
+.stabn 68,0,872,.LM757-v4_gp6
+.LM757:
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L93:
+.stabn 68,0,873,.LM764-v4_gp6
+.LM764:
+	call v4_over
+	call v4_c_Fetch
+	mov $49,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	call v4__dpop
+	and %edx,%eax
+	call v4__dpush
+.stabn 68,0,874,.LM778-v4_gp6
+.LM778:
+	call v4_Greaterr
+	call v4_char_Plus
+	call v4_r_Greater
+.stabn 68,0,875,.LM781-v4_gp6
+.LM781:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L93
+	call v4__rpop
+	call v4__rpop
+	call v4_swap
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE146:
+.stabn 68,0,875,.LM795-v4_gp6
+.LM795:
+	pop %ebx
+	leave
+	ret
+.Lfe146:
+	.size	 v4_gp6,.Lfe146-v4_gp6
+.stabn	192,0,0,.LBB146-v4_gp6
+.stabn	224,0,0,.LBE146-v4_gp6
+.Lscope146:
+.stabs	"",36,0,0,.Lscope146-v4_gp6
+.text
+	.align 4
+.stabs "v4_gp7:F1",36,0,0,v4_gp7
+.globl v4_gp7
+	.type	v4_gp7,@function
+v4_gp7:
+.stabn 68,0,900,.LMa796-v4_gp7
+.LMa796:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,900,.LMb796-v4_gp7
+.LMb796:
+.LBB147:
+.stabn 68,0,901,.LM797-v4_gp7
+.LM797:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	mov $36,%eax
+	call v4__dpush
+	call v4_base
+	call v4_Store
+.stabn 68,0,902,.LM804-v4_gp7
+.LM804:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,903,.LM806-v4_gp7
+.LM806:
+	mov $10,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L97:
+.stabn 68,0,904,.LM815-v4_gp7
+.LM815:
+	call v4_i
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,905,.LM821-v4_gp7
+.LM821:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_swap
+	call v4_c_Fetch
+	mov $48,%eax
+	call v4__dpush
+	call v4_i
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	call v4__dpop
+	and %edx,%eax
+	mov %eax,%edx
+	call v4__dpop
+	and %edx,%eax
+	call v4__dpush
+.stabn 68,0,906,.LM853-v4_gp7
+.LM853:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L97
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,907,.LM864-v4_gp7
+.LM864:
+	mov $36,%eax
+	mov %eax,%ecx
+	mov $10,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L100:
+.stabn 68,0,908,.LM873-v4_gp7
+.LM873:
+	call v4_i
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,909,.LM879-v4_gp7
+.LM879:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_swap
+	call v4_c_Fetch
+	mov $65,%eax
+	call v4__dpush
+	call v4_i
+	mov $10,%eax
+	mov %eax,%edx
+	call v4__dpop
+	sub %edx,%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	call v4__dpop
+	and %edx,%eax
+	mov %eax,%edx
+	call v4__dpop
+	and %edx,%eax
+	call v4__dpush
+.stabn 68,0,910,.LM918-v4_gp7
+.LM918:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L100
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,911,.LM929-v4_gp7
+.LM929:
+	call v4_r_Greater
+	call v4_base
+	pop %ebx
+	leave
+	jmp v4_Store
+.LBE147:
+.stabn 68,0,911,.LM933-v4_gp7
+.LM933:
+	pop %ebx
+	leave
+	ret
+.Lfe147:
+	.size	 v4_gp7,.Lfe147-v4_gp7
+.stabn	192,0,0,.LBB147-v4_gp7
+.stabn	224,0,0,.LBE147-v4_gp7
+.Lscope147:
+.stabs	"",36,0,0,.Lscope147-v4_gp7
+.text
+	.align 4
+.stabs "v4_gn_Minusstring:F1",36,0,0,v4_gn_Minusstring
+.globl v4_gn_Minusstring
+	.type	v4_gn_Minusstring,@function
+v4_gn_Minusstring:
+.stabn 68,0,919,.LMa934-v4_gn_Minusstring
+.LMa934:
+.stabn 68,0,919,.LMb934-v4_gn_Minusstring
+.LMb934:
+.LBB149:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.LBE149:
+.stabn 68,0,919,.LM940-v4_gn_Minusstring
+.LM940:
+	ret
+.Lfe149:
+	.size	 v4_gn_Minusstring,.Lfe149-v4_gn_Minusstring
+.stabn	192,0,0,.LBB149-v4_gn_Minusstring
+.stabn	224,0,0,.LBE149-v4_gn_Minusstring
+.Lscope149:
+.stabs	"",36,0,0,.Lscope149-v4_gn_Minusstring
+.text
+	.align 4
+.stabs "v4_gn_Minusconsumed:F1",36,0,0,v4_gn_Minusconsumed
+.globl v4_gn_Minusconsumed
+	.type	v4_gn_Minusconsumed,@function
+v4_gn_Minusconsumed:
+.stabn 68,0,920,.LMa941-v4_gn_Minusconsumed
+.LMa941:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,920,.LMb941-v4_gn_Minusconsumed
+.LMb941:
+.LBB150:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	xor %eax,%eax
+	call v4__dpush
+.LBE150:
+.stabn 68,0,920,.LM948-v4_gn_Minusconsumed
+.LM948:
+	pop %ebx
+	leave
+	ret
+.Lfe150:
+	.size	 v4_gn_Minusconsumed,.Lfe150-v4_gn_Minusconsumed
+.stabn	192,0,0,.LBB150-v4_gn_Minusconsumed
+.stabn	224,0,0,.LBE150-v4_gn_Minusconsumed
+.Lscope150:
+.stabs	"",36,0,0,.Lscope150-v4_gn_Minusconsumed
+.text
+	.align 4
+.stabs "v4_gn_Tick:F1",36,0,0,v4_gn_Tick
+.globl v4_gn_Tick
+	.type	v4_gn_Tick,@function
+v4_gn_Tick:
+.stabn 68,0,922,.LMa949-v4_gn_Tick
+.LMa949:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,922,.LMb949-v4_gn_Tick
+.LMb949:
+.LBB151:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM954-v4_gn_Tick
+.LM954:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.LBE151:
+.stabn 68,0,922,.LM959-v4_gn_Tick
+.LM959:
+	pop %ebx
+	leave
+	ret
+.Lfe151:
+	.size	 v4_gn_Tick,.Lfe151-v4_gn_Tick
+.stabn	192,0,0,.LBB151-v4_gn_Tick
+.stabn	224,0,0,.LBE151-v4_gn_Tick
+.Lscope151:
+.stabs	"",36,0,0,.Lscope151-v4_gn_Tick
+.text
+	.align 4
+.stabs "v4_Greaternumber_Minusbased:F1",36,0,0,v4_Greaternumber_Minusbased
+.globl v4_Greaternumber_Minusbased
+	.type	v4_Greaternumber_Minusbased,@function
+v4_Greaternumber_Minusbased:
+.stabn 68,0,931,.LMa960-v4_Greaternumber_Minusbased
+.LMa960:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,931,.LMb960-v4_Greaternumber_Minusbased
+.LMb960:
+.LBB153:
+.stabn 68,0,932,.LM961-v4_Greaternumber_Minusbased
+.LM961:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	pop %ebx
+	leave
+	jmp v4_Store
+.LBE153:
+.stabn 68,0,932,.LM971-v4_Greaternumber_Minusbased
+.LM971:
+	pop %ebx
+	leave
+	ret
+.Lfe153:
+	.size	 v4_Greaternumber_Minusbased,.Lfe153-v4_Greaternumber_Minusbased
+.stabn	192,0,0,.LBB153-v4_Greaternumber_Minusbased
+.stabn	224,0,0,.LBE153-v4_Greaternumber_Minusbased
+.Lscope153:
+.stabs	"",36,0,0,.Lscope153-v4_Greaternumber_Minusbased
+.text
+	.align 4
+.stabs "v4_gn1:F1",36,0,0,v4_gn1
+.globl v4_gn1
+	.type	v4_gn1,@function
+v4_gn1:
+.stabn 68,0,941,.LMa972-v4_gn1
+.LMa972:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,941,.LMb972-v4_gn1
+.LMb972:
+.LBB154:
+.stabn 68,0,942,.LM973-v4_gn1
+.LM973:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+.stabn 68,0,943,.LM978-v4_gn1
+.LM978:
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,944,.LM981-v4_gn1
+.LM981:
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_z2swap
+	call v4_Greaternumber
+	call v4_swap
+	call v4_drop
+.stabn 68,0,945,.LM989-v4_gn1
+.LM989:
+	call v4_r_Greater
+	call v4_base
+	pop %ebx
+	leave
+	jmp v4_Store
+.LBE154:
+.stabn 68,0,945,.LM993-v4_gn1
+.LM993:
+	pop %ebx
+	leave
+	ret
+.Lfe154:
+	.size	 v4_gn1,.Lfe154-v4_gn1
+.stabn	192,0,0,.LBB154-v4_gn1
+.stabn	224,0,0,.LBE154-v4_gn1
+.Lscope154:
+.stabs	"",36,0,0,.Lscope154-v4_gn1
+.text
+	.align 4
+.stabs "v4_gn2:F1",36,0,0,v4_gn2
+.globl v4_gn2
+	.type	v4_gn2,@function
+v4_gn2:
+.stabn 68,0,953,.LMa994-v4_gn2
+.LMa994:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,953,.LMb994-v4_gn2
+.LMb994:
+.LBB155:
+.stabn 68,0,954,.LM995-v4_gn2
+.LM995:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_base
+	call v4_Fetch
+	call v4_decimal
+	call v4_base
+	call v4_Fetch
+	call v4_r_Greater
+	call v4_base
+	pop %ebx
+	leave
+	jmp v4_Store
+.LBE155:
+.stabn 68,0,954,.LM1008-v4_gn2
+.LM1008:
+	pop %ebx
+	leave
+	ret
+.Lfe155:
+	.size	 v4_gn2,.Lfe155-v4_gn2
+.stabn	192,0,0,.LBB155-v4_gn2
+.stabn	224,0,0,.LBE155-v4_gn2
+.Lscope155:
+.stabs	"",36,0,0,.Lscope155-v4_gn2
+.text
+	.align 4
+.stabs "v4_seebuf:F1",36,0,0,v4_seebuf
+.globl v4_seebuf
+	.type	v4_seebuf,@function
+v4_seebuf:
+.stabn 68,0,965,.LMa1009-v4_seebuf
+.LMa1009:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,965,.LMb1009-v4_seebuf
+.LMb1009:
+.LBB160:
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	pop %ebx
+	leave
+	jmp v4_c_Fetch
+.LBE160:
+.stabn 68,0,965,.LM1023-v4_seebuf
+.LM1023:
+	pop %ebx
+	leave
+	ret
+.Lfe160:
+	.size	 v4_seebuf,.Lfe160-v4_seebuf
+.stabn	192,0,0,.LBB160-v4_seebuf
+.stabn	224,0,0,.LBE160-v4_seebuf
+.Lscope160:
+.stabs	"",36,0,0,.Lscope160-v4_seebuf
+.text
+	.align 4
+.stabs "v4_output_Minustest:F1",36,0,0,v4_output_Minustest
+.globl v4_output_Minustest
+	.type	v4_output_Minustest,@function
+v4_output_Minustest:
+.stabn 68,0,997,.LMa1024-v4_output_Minustest
+.LMa1024:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,997,.LMb1024-v4_output_Minustest
+.LMb1024:
+.LBB163:
+.stabn 68,0,998,.LM1025-v4_output_Minustest
+.LM1025:
+	lea .LC24,%eax
+	call v4__dpush
+	mov $40,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,999,.LM1031-v4_output_Minustest
+.LM1031:
+	mov $10,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L111:
+	call v4_i
+	call v4_Dot
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L111
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1000,.LM1055-v4_output_Minustest
+.LM1055:
+	lea .LC25,%eax
+	call v4__dpush
+	mov $36,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1001,.LM1061-v4_output_Minustest
+.LM1061:
+	mov $58,%eax
+	mov %eax,%ecx
+	mov $48,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L114:
+	call v4_i
+	xor %eax,%eax
+	call v4__dpush
+	call v4_spaces
+	call v4_emit
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L114
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1002,.LM1088-v4_output_Minustest
+.LM1088:
+	lea .LC26,%eax
+	call v4__dpush
+	mov $40,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1003,.LM1094-v4_output_Minustest
+.LM1094:
+	mov $72,%eax
+	mov %eax,%ecx
+	mov $65,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L117:
+	call v4_i
+	call v4_emit
+	call v4_space
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L117
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1004,.LM1119-v4_output_Minustest
+.LM1119:
+	lea .LC27,%eax
+	call v4__dpush
+	mov $43,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1005,.LM1125-v4_output_Minustest
+.LM1125:
+	mov $6,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L120:
+	call v4_i
+	mov $48,%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	call v4__dpush
+	call v4_emit
+	mov $2,%eax
+	call v4__dpush
+	call v4_spaces
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L120
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1006,.LM1159-v4_output_Minustest
+.LM1159:
+	lea .LC28,%eax
+	call v4__dpush
+	mov $34,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1007,.LM1165-v4_output_Minustest
+.LM1165:
+	lea .LC29,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_type
+	call v4_cr
+	lea .LC30,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_type
+	call v4_cr
+.stabn 68,0,1008,.LM1177-v4_output_Minustest
+.LM1177:
+	lea .LC31,%eax
+	call v4__dpush
+	mov $64,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1009,.LM1183-v4_output_Minustest
+.LM1183:
+	lea .LC32,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	call v4__type
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Dot
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,1010,.LM1195-v4_output_Minustest
+.LM1195:
+	lea .LC33,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	call v4__type
+	xor %eax,%eax
+	call v4__dpush
+	call v4_u_Dot
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_u_Dot
+	pop %ebx
+	leave
+	jmp v4_cr
+.LBE163:
+.stabn 68,0,1011,.LM1208-v4_output_Minustest
+.LM1208:
+	pop %ebx
+	leave
+	ret
+.Lfe163:
+	.size	 v4_output_Minustest,.Lfe163-v4_output_Minustest
+.stabn	192,0,0,.LBB163-v4_output_Minustest
+.stabn	224,0,0,.LBE163-v4_output_Minustest
+.Lscope163:
+.stabs	"",36,0,0,.Lscope163-v4_output_Minustest
+.text
+	.align 4
+.stabs "v4_accept_Minustest:F1",36,0,0,v4_accept_Minustest
+.globl v4_accept_Minustest
+	.type	v4_accept_Minustest,@function
+v4_accept_Minustest:
+.stabn 68,0,1020,.LMa1209-v4_accept_Minustest
+.LMa1209:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,1020,.LMb1209-v4_accept_Minustest
+.LMb1209:
+.LBB171:
+.stabn 68,0,1021,.LM1210-v4_accept_Minustest
+.LM1210:
+	call v4_cr
+	lea .LC35,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1022,.LM1217-v4_accept_Minustest
+.LM1217:
+	lea v4_abuf,%eax
+	call v4__dpush
+	mov $80,%eax
+	call v4__dpush
+	call v4_accept
+.stabn 68,0,1023,.LM1222-v4_accept_Minustest
+.LM1222:
+	call v4_cr
+	lea .LC36,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	call v4__type
+	mov $34,%eax
+	call v4__dpush
+	call v4_emit
+.stabn 68,0,1024,.LM1231-v4_accept_Minustest
+.LM1231:
+	lea v4_abuf,%eax
+	call v4__dpush
+	call v4_swap
+	call v4_type
+	mov $34,%eax
+	call v4__dpush
+	call v4_emit
+	pop %ebx
+	leave
+	jmp v4_cr
+.LBE171:
+.stabn 68,0,1025,.LM1240-v4_accept_Minustest
+.LM1240:
+	pop %ebx
+	leave
+	ret
+.Lfe171:
+	.size	 v4_accept_Minustest,.Lfe171-v4_accept_Minustest
+.stabn	192,0,0,.LBB171-v4_accept_Minustest
+.stabn	224,0,0,.LBE171-v4_accept_Minustest
+.Lscope171:
+.stabs	"",36,0,0,.Lscope171-v4_accept_Minustest
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,13,.LMa1241-main
+.LMa1241:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,13,.LMb1241-main
+.LMb1241:
+.LBB1:
+	lea .LC0,%eax
+	call v4__dpush
+	mov $18,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4__strictansi
+	call v4_Store
+.stabn 68,0,19,.LM1253-main
+.LM1253:
+	lea .LC1,%eax
+	call v4__dpush
+	mov $35,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,21,.LM1259-main
+.LM1259:
+	mov $180,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,22,.LM1271-main
+.LM1271:
+	mov $190,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,23,.LM1283-main
+.LM1283:
+	mov $200,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,24,.LM1295-main
+.LM1295:
+	mov $210,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,26,.LM1307-main
+.LM1307:
+	mov $230,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,27,.LM1320-main
+.LM1320:
+	mov $240,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,29,.LM1333-main
+.LM1333:
+	xor %eax,%eax
+	mov %eax,(v4_z0s)
+.stabn 68,0,30,.LM1337-main
+.LM1337:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,(v4_z1s)
+.stabn 68,0,32,.LM1342-main
+.LM1342:
+	mov $290,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,33,.LM1352-main
+.LM1352:
+	mov $300,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,35,.LM1362-main
+.LM1362:
+	mov $320,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%edx
+	and %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,36,.LM1378-main
+.LM1378:
+	mov $330,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,37,.LM1390-main
+.LM1390:
+	mov $340,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,38,.LM1402-main
+.LM1402:
+	mov $350,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	and %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,40,.LM1418-main
+.LM1418:
+	mov $370,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%edx
+	or %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,41,.LM1434-main
+.LM1434:
+	mov $380,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,42,.LM1446-main
+.LM1446:
+	mov $390,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,43,.LM1458-main
+.LM1458:
+	mov $400,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	or %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,45,.LM1474-main
+.LM1474:
+	mov $420,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%edx
+	xor %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,46,.LM1490-main
+.LM1490:
+	mov $430,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,47,.LM1502-main
+.LM1502:
+	mov $440,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,48,.LM1514-main
+.LM1514:
+	mov $450,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	xor %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,51,.LM1530-main
+.LM1530:
+	lea .LC2,%eax
+	call v4__dpush
+	mov $27,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,54,.LM1537-main
+.LM1537:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.L121:
+	call v4_dup
+	call v4__dpop
+	add %eax,%eax
+	je .L122
+	call v4__dpop
+	add %eax,%eax
+	call v4__dpush
+	jmp .L121
+.L122:
+.stabn 68,0,55,.LM1553-main
+.LM1553:
+	call v4__dpop
+	mov %eax,(v4_msb)
+.stabn 68,0,57,.LM1555-main
+.LM1555:
+	mov $540,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,58,.LM1565-main
+.LM1565:
+	mov $550,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,59,.LM1575-main
+.LM1575:
+	mov $560,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $32768,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $32768,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,60,.LM1585-main
+.LM1585:
+	mov $570,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,61,.LM1600-main
+.LM1600:
+	mov $580,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_msb),%eax
+	add %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,63,.LM1613-main
+.LM1613:
+	mov $600,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,64,.LM1623-main
+.LM1623:
+	mov $610,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,65,.LM1633-main
+.LM1633:
+	mov $620,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $8192,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $8192,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,66,.LM1643-main
+.LM1643:
+	mov $630,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,67,.LM1655-main
+.LM1655:
+	mov $640,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,68,.LM1670-main
+.LM1670:
+	mov $650,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_msb),%eax
+	call v4__dpush
+	call v4_z2_Slash
+	mov (v4_msb),%eax
+	mov %eax,%edx
+	call v4__dpop
+	and %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov (v4_msb),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,70,.LM1687-main
+.LM1687:
+	mov $670,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,71,.LM1699-main
+.LM1699:
+	mov $680,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,72,.LM1711-main
+.LM1711:
+	mov $690,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $4,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,73,.LM1723-main
+.LM1723:
+	mov $700,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $32768,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $32768,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,74,.LM1735-main
+.LM1735:
+	mov $710,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,75,.LM1752-main
+.LM1752:
+	mov $720,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_msb),%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	xchg %edx,%ecx
+	shl %cl,%eax
+	xchg %edx,%ecx
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,77,.LM1768-main
+.LM1768:
+	mov $740,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,78,.LM1780-main
+.LM1780:
+	mov $750,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,79,.LM1792-main
+.LM1792:
+	mov $760,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,80,.LM1804-main
+.LM1804:
+	mov $770,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,81,.LM1816-main
+.LM1816:
+	mov $780,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,82,.LM1828-main
+.LM1828:
+	mov $790,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_msb),%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	xchg %edx,%ecx
+	shr %cl,%eax
+	xchg %edx,%ecx
+	mov %eax,%ecx
+	mov (v4_msb),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	and %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,83,.LM1851-main
+.LM1851:
+	mov $800,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_msb),%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	xchg %edx,%ecx
+	shr %cl,%eax
+	xchg %edx,%ecx
+	add %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov (v4_msb),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,86,.LM1871-main
+.LM1871:
+	lea .LC3,%eax
+	call v4__dpush
+	mov $54,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,87,.LM1877-main
+.LM1877:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,(v4_max_Minusuint)
+.stabn 68,0,88,.LM1882-main
+.LM1882:
+	mov $2147483647,%eax
+	mov %eax,(v4_max_Minusint)
+.stabn 68,0,89,.LM1890-main
+.LM1890:
+	mov $-2147483648,%eax
+	mov %eax,(v4_min_Minusint)
+.stabn 68,0,90,.LM1899-main
+.LM1899:
+	mov $2147483647,%eax
+	mov %eax,(v4_mid_Minusuint)
+.stabn 68,0,91,.LM1907-main
+.LM1907:
+	mov $-2147483648,%eax
+	mov %eax,(v4_mid_Minusuint_Plus1)
+.stabn 68,0,93,.LM1916-main
+.LM1916:
+	xor %eax,%eax
+	mov %eax,(v4_Lessfalse_Greater)
+.stabn 68,0,94,.LM1920-main
+.LM1920:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,(v4_Lesstrue_Greater)
+.stabn 68,0,96,.LM1924-main
+.LM1924:
+	mov $930,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,97,.LM1929-main
+.LM1929:
+	mov $940,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,98,.LM1942-main
+.LM1942:
+	mov $950,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,99,.LM1955-main
+.LM1955:
+	mov $960,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,100,.LM1968-main
+.LM1968:
+	mov $970,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,101,.LM1981-main
+.LM1981:
+	mov $980,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,102,.LM1994-main
+.LM1994:
+	mov $990,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,103,.LM2007-main
+.LM2007:
+	mov $1000,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,105,.LM2020-main
+.LM2020:
+	mov $1020,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,106,.LM2036-main
+.LM2036:
+	mov $1030,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,107,.LM2052-main
+.LM2052:
+	mov $1040,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,108,.LM2068-main
+.LM2068:
+	mov $1050,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,109,.LM2084-main
+.LM2084:
+	mov $1060,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,110,.LM2100-main
+.LM2100:
+	mov $1070,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,111,.LM2116-main
+.LM2116:
+	mov $1080,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,113,.LM2132-main
+.LM2132:
+	mov $1100,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	test %eax,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,114,.LM2145-main
+.LM2145:
+	mov $1110,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	test %eax,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,115,.LM2158-main
+.LM2158:
+	mov $1120,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	test %eax,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,116,.LM2171-main
+.LM2171:
+	mov $1130,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	test %eax,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,117,.LM2184-main
+.LM2184:
+	mov $1140,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	test %eax,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,119,.LM2197-main
+.LM2197:
+	mov $1160,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,120,.LM2213-main
+.LM2213:
+	mov $1170,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	mov $2,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,121,.LM2229-main
+.LM2229:
+	mov $1180,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,122,.LM2245-main
+.LM2245:
+	mov $1190,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,123,.LM2261-main
+.LM2261:
+	mov $1200,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,124,.LM2277-main
+.LM2277:
+	mov $1210,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%ecx
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,125,.LM2293-main
+.LM2293:
+	mov $1220,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,126,.LM2309-main
+.LM2309:
+	mov $1230,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,127,.LM2325-main
+.LM2325:
+	mov $1240,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,128,.LM2341-main
+.LM2341:
+	mov $1250,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,129,.LM2357-main
+.LM2357:
+	mov $1260,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,130,.LM2373-main
+.LM2373:
+	mov $1270,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,131,.LM2389-main
+.LM2389:
+	mov $1280,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,132,.LM2405-main
+.LM2405:
+	mov $1290,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,133,.LM2421-main
+.LM2421:
+	mov $1300,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%ecx
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,134,.LM2437-main
+.LM2437:
+	mov $1310,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,136,.LM2453-main
+.LM2453:
+	mov $1330,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,137,.LM2469-main
+.LM2469:
+	mov $1340,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	mov $2,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,138,.LM2485-main
+.LM2485:
+	mov $1350,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,139,.LM2501-main
+.LM2501:
+	mov $1360,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,140,.LM2517-main
+.LM2517:
+	mov $1370,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,141,.LM2533-main
+.LM2533:
+	mov $1380,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%ecx
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,142,.LM2549-main
+.LM2549:
+	mov $1390,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,143,.LM2565-main
+.LM2565:
+	mov $1400,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,144,.LM2581-main
+.LM2581:
+	mov $1410,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,145,.LM2597-main
+.LM2597:
+	mov $1420,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,146,.LM2613-main
+.LM2613:
+	mov $1430,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,147,.LM2629-main
+.LM2629:
+	mov $1440,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,148,.LM2645-main
+.LM2645:
+	mov $1450,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,149,.LM2661-main
+.LM2661:
+	mov $1460,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,150,.LM2677-main
+.LM2677:
+	mov $1470,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%ecx
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,151,.LM2693-main
+.LM2693:
+	mov $1480,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,153,.LM2709-main
+.LM2709:
+	mov $1500,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,154,.LM2725-main
+.LM2725:
+	mov $1510,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	mov $2,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,155,.LM2741-main
+.LM2741:
+	mov $1520,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,156,.LM2757-main
+.LM2757:
+	mov $1530,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,157,.LM2773-main
+.LM2773:
+	mov $1540,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,158,.LM2789-main
+.LM2789:
+	mov $1550,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,159,.LM2805-main
+.LM2805:
+	mov $1560,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,160,.LM2821-main
+.LM2821:
+	mov $1570,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,161,.LM2837-main
+.LM2837:
+	mov $1580,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,162,.LM2853-main
+.LM2853:
+	mov $1590,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,163,.LM2869-main
+.LM2869:
+	mov $1600,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,164,.LM2885-main
+.LM2885:
+	mov $1610,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%ecx
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,165,.LM2901-main
+.LM2901:
+	mov $1611,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%ecx
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	seta %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,166,.LM2917-main
+.LM2917:
+	mov $1612,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%ecx
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	seta %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,167,.LM2933-main
+.LM2933:
+	mov $1613,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%ecx
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	seta %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,168,.LM2949-main
+.LM2949:
+	mov $1614,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	cmp %edx,%eax
+	seta %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,169,.LM2965-main
+.LM2965:
+	mov $1615,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%ecx
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setbe %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,170,.LM2981-main
+.LM2981:
+	mov $1616,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%ecx
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setbe %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,171,.LM2997-main
+.LM2997:
+	mov $1617,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	cmp %edx,%eax
+	setbe %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,172,.LM3013-main
+.LM3013:
+	mov $1618,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setbe %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,173,.LM3029-main
+.LM3029:
+	mov $1619,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%ecx
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setae %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,174,.LM3045-main
+.LM3045:
+	mov $1620,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%ecx
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setae %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,175,.LM3061-main
+.LM3061:
+	mov $1621,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	cmp %edx,%eax
+	setae %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,176,.LM3077-main
+.LM3077:
+	mov $1622,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setae %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,177,.LM3093-main
+.LM3093:
+	mov $1623,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	lea v4_u_Greater,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,178,.LM3107-main
+.LM3107:
+	mov $1624,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	lea v4_u_Greater,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,179,.LM3121-main
+.LM3121:
+	mov $1625,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	lea v4_u_Less_Equals,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,180,.LM3135-main
+.LM3135:
+	mov $1626,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	lea v4_u_Less_Equals,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,181,.LM3149-main
+.LM3149:
+	mov $1627,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	lea v4_u_Greater_Equals,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,182,.LM3163-main
+.LM3163:
+	mov $1628,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	lea v4_u_Greater_Equals,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,184,.LM3177-main
+.LM3177:
+	mov $1630,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,185,.LM3189-main
+.LM3189:
+	mov $1640,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,186,.LM3201-main
+.LM3201:
+	mov $1650,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,187,.LM3213-main
+.LM3213:
+	mov $1660,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,188,.LM3225-main
+.LM3225:
+	mov $1670,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,189,.LM3237-main
+.LM3237:
+	mov $1680,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,190,.LM3249-main
+.LM3249:
+	mov $1690,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,191,.LM3261-main
+.LM3261:
+	mov $1700,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,192,.LM3273-main
+.LM3273:
+	mov $1710,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,193,.LM3285-main
+.LM3285:
+	mov $1720,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,194,.LM3297-main
+.LM3297:
+	mov $1730,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,195,.LM3309-main
+.LM3309:
+	mov $1740,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,196,.LM3321-main
+.LM3321:
+	mov $1750,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,197,.LM3333-main
+.LM3333:
+	mov $1760,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,198,.LM3345-main
+.LM3345:
+	mov $1770,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,199,.LM3357-main
+.LM3357:
+	mov $1780,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,201,.LM3369-main
+.LM3369:
+	mov $1800,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,202,.LM3381-main
+.LM3381:
+	mov $1810,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,203,.LM3393-main
+.LM3393:
+	mov $1820,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,204,.LM3405-main
+.LM3405:
+	mov $1830,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,205,.LM3417-main
+.LM3417:
+	mov $1840,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,206,.LM3429-main
+.LM3429:
+	mov $1850,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,207,.LM3441-main
+.LM3441:
+	mov $1860,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,208,.LM3453-main
+.LM3453:
+	mov $1870,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,209,.LM3465-main
+.LM3465:
+	mov $1880,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,210,.LM3477-main
+.LM3477:
+	mov $1890,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,211,.LM3489-main
+.LM3489:
+	mov $1900,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,212,.LM3501-main
+.LM3501:
+	mov $1910,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,213,.LM3513-main
+.LM3513:
+	mov $1920,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,214,.LM3525-main
+.LM3525:
+	mov $1930,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,215,.LM3537-main
+.LM3537:
+	mov $1940,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,216,.LM3549-main
+.LM3549:
+	mov $1950,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,219,.LM3561-main
+.LM3561:
+	lea .LC4,%eax
+	call v4__dpush
+	mov $27,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,232,.LM3567-main
+.LM3567:
+	mov $1960,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,233,.LM3576-main
+.LM3576:
+	mov $1961,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,234,.LM3585-main
+.LM3585:
+	mov $1962,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,235,.LM3594-main
+.LM3594:
+	mov $1963,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,236,.LM3603-main
+.LM3603:
+	mov $1964,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,240,.LM3613-main
+.LM3613:
+	lea .LC5,%eax
+	call v4__dpush
+	mov $75,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,242,.LM3619-main
+.LM3619:
+	mov $2000,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_z2drop
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,243,.LM3629-main
+.LM3629:
+	mov $2010,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_z2dup
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,244,.LM3647-main
+.LM3647:
+	mov $2020,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_z2over
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,245,.LM3673-main
+.LM3673:
+	mov $2030,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_z2swap
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,246,.LM3695-main
+.LM3695:
+	mov $2040,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Questiondup
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,247,.LM3705-main
+.LM3705:
+	mov $2050,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Questiondup
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,248,.LM3717-main
+.LM3717:
+	mov $2060,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Questiondup
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,249,.LM3729-main
+.LM3729:
+	mov $2070,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_depth
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,250,.LM3737-main
+.LM3737:
+	mov $2080,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_depth
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,251,.LM3749-main
+.LM3749:
+	mov $2090,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_depth
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,252,.LM3765-main
+.LM3765:
+	mov $2100,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_drop
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,253,.LM3773-main
+.LM3773:
+	mov $2110,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_drop
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,254,.LM3785-main
+.LM3785:
+	mov $2120,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_dup
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,255,.LM3797-main
+.LM3797:
+	mov $2130,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_over
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,256,.LM3813-main
+.LM3813:
+	mov $2140,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_rot
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,257,.LM3831-main
+.LM3831:
+	mov $2150,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_swap
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,260,.LM3845-main
+.LM3845:
+	lea .LC6,%eax
+	call v4__dpush
+	mov $16,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,262,.LM3851-main
+.LM3851:
+	mov $2200,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,263,.LM3856-main
+.LM3856:
+	mov $2210,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,264,.LM3861-main
+.LM3861:
+	mov $2220,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $123,%eax
+	call v4__dpush
+.stabn 68,0,262,.LM3867-main
+.LM3867:
+	call v4_Greaterr
+	call v4_r_Greater
+.stabn 68,0,264,.LM3869-main
+.LM3869:
+	call v4_Minus_Greater
+	mov $123,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,265,.LM3873-main
+.LM3873:
+	mov $2230,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $123,%eax
+	call v4__dpush
+.stabn 68,0,263,.LM3879-main
+.LM3879:
+	call v4_Greaterr
+	call v4_r_Fetch
+	call v4_r_Greater
+	call v4_drop
+.stabn 68,0,265,.LM3883-main
+.LM3883:
+	call v4_Minus_Greater
+	mov $123,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,268,.LM3887-main
+.LM3887:
+	lea .LC7,%eax
+	call v4__dpush
+	mov $42,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,270,.LM3893-main
+.LM3893:
+	mov $2280,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,271,.LM3905-main
+.LM3905:
+	mov $2290,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,272,.LM3917-main
+.LM3917:
+	mov $2300,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-5,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,273,.LM3929-main
+.LM3929:
+	mov $2310,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-5,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,274,.LM3941-main
+.LM3941:
+	mov $2320,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,275,.LM3953-main
+.LM3953:
+	mov $2330,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,276,.LM3965-main
+.LM3965:
+	mov $2340,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,277,.LM3977-main
+.LM3977:
+	mov $2350,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,278,.LM3989-main
+.LM3989:
+	mov $2360,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,279,.LM4001-main
+.LM4001:
+	mov $2370,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,281,.LM4013-main
+.LM4013:
+	mov $2390,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-5,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,282,.LM4025-main
+.LM4025:
+	mov $2400,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,283,.LM4037-main
+.LM4037:
+	mov $2410,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,284,.LM4049-main
+.LM4049:
+	mov $2420,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-5,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,285,.LM4061-main
+.LM4061:
+	mov $2430,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,286,.LM4073-main
+.LM4073:
+	mov $2440,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,287,.LM4085-main
+.LM4085:
+	mov $2450,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,288,.LM4097-main
+.LM4097:
+	mov $2460,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,289,.LM4109-main
+.LM4109:
+	mov $2470,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,290,.LM4121-main
+.LM4121:
+	mov $2480,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,292,.LM4133-main
+.LM4133:
+	mov $2500,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,293,.LM4143-main
+.LM4143:
+	mov $2510,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,294,.LM4153-main
+.LM4153:
+	mov $2520,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,295,.LM4163-main
+.LM4163:
+	mov $2530,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,297,.LM4173-main
+.LM4173:
+	mov $2550,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,298,.LM4183-main
+.LM4183:
+	mov $2560,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,299,.LM4193-main
+.LM4193:
+	mov $2570,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,300,.LM4203-main
+.LM4203:
+	mov $2580,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,302,.LM4213-main
+.LM4213:
+	mov $2600,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,303,.LM4223-main
+.LM4223:
+	mov $2610,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,304,.LM4233-main
+.LM4233:
+	mov $2620,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,305,.LM4243-main
+.LM4243:
+	mov $2630,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,306,.LM4253-main
+.LM4253:
+	mov $2640,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,308,.LM4263-main
+.LM4263:
+	mov $2660,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,309,.LM4273-main
+.LM4273:
+	mov $2670,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,310,.LM4283-main
+.LM4283:
+	mov $2680,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,311,.LM4293-main
+.LM4293:
+	mov $2690,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,314,.LM4303-main
+.LM4303:
+	lea .LC8,%eax
+	call v4__dpush
+	mov $30,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,316,.LM4309-main
+.LM4309:
+	mov $2740,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,317,.LM4321-main
+.LM4321:
+	mov $2750,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,318,.LM4333-main
+.LM4333:
+	mov $2760,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,319,.LM4345-main
+.LM4345:
+	mov $2770,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,320,.LM4357-main
+.LM4357:
+	mov $2780,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,321,.LM4369-main
+.LM4369:
+	mov $2790,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,322,.LM4381-main
+.LM4381:
+	mov $2800,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,324,.LM4393-main
+.LM4393:
+	mov $2820,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,325,.LM4406-main
+.LM4406:
+	mov $2830,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,326,.LM4419-main
+.LM4419:
+	mov $2840,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,327,.LM4432-main
+.LM4432:
+	mov $2850,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,328,.LM4445-main
+.LM4445:
+	mov $2860,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,329,.LM4458-main
+.LM4458:
+	mov $2870,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $9,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,330,.LM4471-main
+.LM4471:
+	mov $2880,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-3,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-9,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,331,.LM4484-main
+.LM4484:
+	mov $2890,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-9,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,332,.LM4497-main
+.LM4497:
+	mov $2900,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-3,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $9,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,333,.LM4510-main
+.LM4510:
+	mov $2910,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,334,.LM4523-main
+.LM4523:
+	mov $2920,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,335,.LM4536-main
+.LM4536:
+	mov $2930,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,336,.LM4550-main
+.LM4550:
+	mov $2940,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,337,.LM4563-main
+.LM4563:
+	mov $2950,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,338,.LM4576-main
+.LM4576:
+	mov $2960,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,339,.LM4593-main
+.LM4593:
+	mov $2970,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov (v4_msb),%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	xchg %edx,%ecx
+	shr %cl,%eax
+	xchg %edx,%ecx
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,340,.LM4614-main
+.LM4614:
+	mov $2980,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov (v4_msb),%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_z2_Slash
+	call v4_Rightbrace
+.stabn 68,0,341,.LM4629-main
+.LM4629:
+	mov $2990,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov (v4_msb),%eax
+	call v4__dpush
+	call v4_z2_Slash
+	call v4__dpop
+	not %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,343,.LM4648-main
+.LM4648:
+	mov $3010,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,344,.LM4660-main
+.LM4660:
+	mov $3020,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,345,.LM4672-main
+.LM4672:
+	mov $3030,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,346,.LM4684-main
+.LM4684:
+	mov $3040,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,347,.LM4696-main
+.LM4696:
+	mov $3050,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,348,.LM4708-main
+.LM4708:
+	mov $3060,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $9,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $9,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,349,.LM4720-main
+.LM4720:
+	mov $3070,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-9,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-9,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,350,.LM4732-main
+.LM4732:
+	mov $3080,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-9,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-9,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,351,.LM4744-main
+.LM4744:
+	mov $3090,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $9,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $9,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,353,.LM4756-main
+.LM4756:
+	mov $3110,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,354,.LM4771-main
+.LM4771:
+	mov $3120,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,355,.LM4786-main
+.LM4786:
+	mov $3130,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,357,.LM4804-main
+.LM4804:
+	mov $3150,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,358,.LM4818-main
+.LM4818:
+	mov $3160,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,359,.LM4832-main
+.LM4832:
+	mov $3170,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,360,.LM4846-main
+.LM4846:
+	mov $3180,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,361,.LM4860-main
+.LM4860:
+	mov $3190,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,362,.LM4874-main
+.LM4874:
+	mov $3200,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $9,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,364,.LM4888-main
+.LM4888:
+	mov $3220,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $1073741824,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,365,.LM4905-main
+.LM4905:
+	mov $3230,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,366,.LM4919-main
+.LM4919:
+	mov $3240,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,367,.LM4933-main
+.LM4933:
+	mov $3250,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,368,.LM4950-main
+.LM4950:
+	mov $3260,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,371,.LM4965-main
+.LM4965:
+	lea .LC9,%eax
+	call v4__dpush
+	mov $56,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,373,.LM4971-main
+.LM4971:
+	mov $3310,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,374,.LM4986-main
+.LM4986:
+	mov $3320,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,375,.LM5001-main
+.LM5001:
+	mov $3330,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,376,.LM5016-main
+.LM5016:
+	mov $3340,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,377,.LM5031-main
+.LM5031:
+	mov $3350,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,378,.LM5046-main
+.LM5046:
+	mov $3360,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,379,.LM5061-main
+.LM5061:
+	mov $3370,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,380,.LM5076-main
+.LM5076:
+	mov $3380,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,381,.LM5091-main
+.LM5091:
+	mov $3390,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,382,.LM5106-main
+.LM5106:
+	mov $3400,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,383,.LM5121-main
+.LM5121:
+	mov $3410,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $2,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,384,.LM5136-main
+.LM5136:
+	mov $3420,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,385,.LM5151-main
+.LM5151:
+	mov $3430,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-2,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,386,.LM5166-main
+.LM5166:
+	mov $3440,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $3,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,387,.LM5181-main
+.LM5181:
+	mov $3450,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-3,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,388,.LM5196-main
+.LM5196:
+	mov $3460,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $3,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,389,.LM5211-main
+.LM5211:
+	mov $3470,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-3,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,390,.LM5226-main
+.LM5226:
+	mov $3480,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,391,.LM5241-main
+.LM5241:
+	mov $3490,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,392,.LM5256-main
+.LM5256:
+	mov $3500,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,393,.LM5271-main
+.LM5271:
+	mov $3510,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,394,.LM5286-main
+.LM5286:
+	mov $3520,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,395,.LM5302-main
+.LM5302:
+	mov $3530,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_m_Star
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,396,.LM5319-main
+.LM5319:
+	mov $3540,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,397,.LM5336-main
+.LM5336:
+	mov $3550,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $2,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,398,.LM5353-main
+.LM5353:
+	mov $3560,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,399,.LM5370-main
+.LM5370:
+	mov $3570,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,400,.LM5387-main
+.LM5387:
+	mov $3580,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,401,.LM5404-main
+.LM5404:
+	mov $3590,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $2,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,402,.LM5421-main
+.LM5421:
+	mov $3600,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,403,.LM5438-main
+.LM5438:
+	mov $3610,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_m_Star
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,404,.LM5455-main
+.LM5455:
+	mov $3620,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,405,.LM5472-main
+.LM5472:
+	mov $3630,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,406,.LM5489-main
+.LM5489:
+	mov $3640,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_m_Star
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,408,.LM5506-main
+.LM5506:
+	mov $3660,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,409,.LM5521-main
+.LM5521:
+	mov $3670,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,410,.LM5536-main
+.LM5536:
+	mov $3680,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,411,.LM5551-main
+.LM5551:
+	mov $3690,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,412,.LM5566-main
+.LM5566:
+	mov $3700,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,413,.LM5581-main
+.LM5581:
+	mov $3710,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,414,.LM5596-main
+.LM5596:
+	mov $3720,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,415,.LM5611-main
+.LM5611:
+	mov $3730,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,416,.LM5626-main
+.LM5626:
+	mov $3740,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,417,.LM5641-main
+.LM5641:
+	mov $3750,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,418,.LM5656-main
+.LM5656:
+	mov $3760,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $2,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,419,.LM5671-main
+.LM5671:
+	mov $3770,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,420,.LM5686-main
+.LM5686:
+	mov $3780,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-2,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,421,.LM5701-main
+.LM5701:
+	mov $3790,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $3,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,422,.LM5716-main
+.LM5716:
+	mov $3800,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-3,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,423,.LM5731-main
+.LM5731:
+	mov $3810,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $3,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,424,.LM5746-main
+.LM5746:
+	mov $3820,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-3,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,425,.LM5761-main
+.LM5761:
+	mov $3830,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,426,.LM5776-main
+.LM5776:
+	mov $3840,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,427,.LM5791-main
+.LM5791:
+	mov $3850,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,428,.LM5806-main
+.LM5806:
+	mov $3860,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,429,.LM5821-main
+.LM5821:
+	mov $3870,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,430,.LM5837-main
+.LM5837:
+	mov $3880,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $2,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,431,.LM5854-main
+.LM5854:
+	mov $3890,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,432,.LM5871-main
+.LM5871:
+	mov $3900,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $2,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,433,.LM5888-main
+.LM5888:
+	mov $3910,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,434,.LM5905-main
+.LM5905:
+	mov $3920,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_m_Star
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,435,.LM5922-main
+.LM5922:
+	mov $3930,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,436,.LM5939-main
+.LM5939:
+	mov $3940,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_m_Star
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,437,.LM5956-main
+.LM5956:
+	mov $3950,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_m_Star
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,439,.LM5973-main
+.LM5973:
+	mov $3970,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,440,.LM5989-main
+.LM5989:
+	mov $3980,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,441,.LM6005-main
+.LM6005:
+	mov $3990,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,442,.LM6021-main
+.LM6021:
+	mov $4000,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,443,.LM6037-main
+.LM6037:
+	mov $4010,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_um_Star
+	mov $2,%eax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,444,.LM6054-main
+.LM6054:
+	mov $4020,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_um_Star
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,445,.LM6071-main
+.LM6071:
+	mov $4030,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4__dpush
+	call v4_um_Star
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,465,.LM6088-main
+.LM6088:
+	mov $4280,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6102-main
+.LM6102:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,465,.LM6106-main
+.LM6106:
+	call v4_Rightbrace
+.stabn 68,0,466,.LM6107-main
+.LM6107:
+	mov $4290,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6121-main
+.LM6121:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,466,.LM6125-main
+.LM6125:
+	call v4_Rightbrace
+.stabn 68,0,467,.LM6126-main
+.LM6126:
+	mov $4300,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6140-main
+.LM6140:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,467,.LM6144-main
+.LM6144:
+	call v4_Rightbrace
+.stabn 68,0,468,.LM6145-main
+.LM6145:
+	mov $4310,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6159-main
+.LM6159:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,468,.LM6163-main
+.LM6163:
+	call v4_Rightbrace
+.stabn 68,0,469,.LM6164-main
+.LM6164:
+	mov $4320,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6178-main
+.LM6178:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,469,.LM6182-main
+.LM6182:
+	call v4_Rightbrace
+.stabn 68,0,470,.LM6183-main
+.LM6183:
+	mov $4330,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6197-main
+.LM6197:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,470,.LM6201-main
+.LM6201:
+	call v4_Rightbrace
+.stabn 68,0,471,.LM6202-main
+.LM6202:
+	mov $4340,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6216-main
+.LM6216:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,471,.LM6220-main
+.LM6220:
+	call v4_Rightbrace
+.stabn 68,0,472,.LM6221-main
+.LM6221:
+	mov $4350,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6235-main
+.LM6235:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,472,.LM6239-main
+.LM6239:
+	call v4_Rightbrace
+.stabn 68,0,473,.LM6240-main
+.LM6240:
+	mov $4360,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6254-main
+.LM6254:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,473,.LM6258-main
+.LM6258:
+	call v4_Rightbrace
+.stabn 68,0,474,.LM6259-main
+.LM6259:
+	mov $4370,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6273-main
+.LM6273:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,474,.LM6277-main
+.LM6277:
+	call v4_Rightbrace
+.stabn 68,0,475,.LM6278-main
+.LM6278:
+	mov $4380,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM6292-main
+.LM6292:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,475,.LM6296-main
+.LM6296:
+	call v4_Rightbrace
+.stabn 68,0,476,.LM6297-main
+.LM6297:
+	mov $4390,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6311-main
+.LM6311:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,476,.LM6315-main
+.LM6315:
+	call v4_Rightbrace
+.stabn 68,0,477,.LM6316-main
+.LM6316:
+	mov $4400,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM6330-main
+.LM6330:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,477,.LM6334-main
+.LM6334:
+	call v4_Rightbrace
+.stabn 68,0,478,.LM6335-main
+.LM6335:
+	mov $4410,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM6349-main
+.LM6349:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,478,.LM6353-main
+.LM6353:
+	call v4_Rightbrace
+.stabn 68,0,479,.LM6354-main
+.LM6354:
+	mov $4420,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM6368-main
+.LM6368:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,479,.LM6372-main
+.LM6372:
+	call v4_Rightbrace
+.stabn 68,0,480,.LM6373-main
+.LM6373:
+	mov $4430,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM6387-main
+.LM6387:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,480,.LM6391-main
+.LM6391:
+	call v4_Rightbrace
+.stabn 68,0,481,.LM6392-main
+.LM6392:
+	mov $4440,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM6406-main
+.LM6406:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,481,.LM6410-main
+.LM6410:
+	call v4_Rightbrace
+.stabn 68,0,482,.LM6411-main
+.LM6411:
+	mov $4450,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6425-main
+.LM6425:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,482,.LM6429-main
+.LM6429:
+	call v4_Rightbrace
+.stabn 68,0,483,.LM6430-main
+.LM6430:
+	mov $4460,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6444-main
+.LM6444:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,483,.LM6448-main
+.LM6448:
+	call v4_Rightbrace
+.stabn 68,0,484,.LM6449-main
+.LM6449:
+	mov $4470,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,459,.LM6463-main
+.LM6463:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,484,.LM6467-main
+.LM6467:
+	call v4_Rightbrace
+.stabn 68,0,485,.LM6468-main
+.LM6468:
+	mov $4480,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,459,.LM6482-main
+.LM6482:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,485,.LM6486-main
+.LM6486:
+	call v4_Rightbrace
+.stabn 68,0,487,.LM6487-main
+.LM6487:
+	mov $4500,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6505-main
+.LM6505:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6509-main
+.LM6509:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,487,.LM6511-main
+.LM6511:
+	call v4_Rightbrace
+.stabn 68,0,488,.LM6512-main
+.LM6512:
+	mov $4510,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6530-main
+.LM6530:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6534-main
+.LM6534:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,488,.LM6536-main
+.LM6536:
+	call v4_Rightbrace
+.stabn 68,0,489,.LM6537-main
+.LM6537:
+	mov $4520,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6555-main
+.LM6555:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6559-main
+.LM6559:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,489,.LM6561-main
+.LM6561:
+	call v4_Rightbrace
+.stabn 68,0,490,.LM6562-main
+.LM6562:
+	mov $4530,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6580-main
+.LM6580:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6584-main
+.LM6584:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,490,.LM6586-main
+.LM6586:
+	call v4_Rightbrace
+.stabn 68,0,491,.LM6587-main
+.LM6587:
+	mov $4540,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6605-main
+.LM6605:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6609-main
+.LM6609:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,491,.LM6611-main
+.LM6611:
+	call v4_Rightbrace
+.stabn 68,0,492,.LM6612-main
+.LM6612:
+	mov $4550,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6627-main
+.LM6627:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6631-main
+.LM6631:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,492,.LM6633-main
+.LM6633:
+	call v4_Rightbrace
+.stabn 68,0,493,.LM6634-main
+.LM6634:
+	mov $4560,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6649-main
+.LM6649:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6653-main
+.LM6653:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,493,.LM6655-main
+.LM6655:
+	call v4_Rightbrace
+.stabn 68,0,494,.LM6656-main
+.LM6656:
+	mov $4570,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6671-main
+.LM6671:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6675-main
+.LM6675:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,494,.LM6677-main
+.LM6677:
+	call v4_Rightbrace
+.stabn 68,0,495,.LM6678-main
+.LM6678:
+	mov $4580,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6693-main
+.LM6693:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6697-main
+.LM6697:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,495,.LM6699-main
+.LM6699:
+	call v4_Rightbrace
+.stabn 68,0,496,.LM6700-main
+.LM6700:
+	mov $4590,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6715-main
+.LM6715:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6719-main
+.LM6719:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,496,.LM6721-main
+.LM6721:
+	call v4_Rightbrace
+.stabn 68,0,497,.LM6722-main
+.LM6722:
+	mov $4600,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $31,%edx
+	add %edx,%eax
+	sar $1,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM6740-main
+.LM6740:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6744-main
+.LM6744:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,497,.LM6746-main
+.LM6746:
+	call v4_Rightbrace
+.stabn 68,0,498,.LM6747-main
+.LM6747:
+	mov $4610,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6762-main
+.LM6762:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6766-main
+.LM6766:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,498,.LM6768-main
+.LM6768:
+	call v4_Rightbrace
+.stabn 68,0,499,.LM6769-main
+.LM6769:
+	mov $4620,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $31,%edx
+	add %edx,%eax
+	sar $1,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM6787-main
+.LM6787:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6791-main
+.LM6791:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,499,.LM6793-main
+.LM6793:
+	call v4_Rightbrace
+.stabn 68,0,500,.LM6794-main
+.LM6794:
+	mov $4630,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM6812-main
+.LM6812:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6816-main
+.LM6816:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,500,.LM6818-main
+.LM6818:
+	call v4_Rightbrace
+.stabn 68,0,501,.LM6819-main
+.LM6819:
+	mov $4640,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM6837-main
+.LM6837:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6841-main
+.LM6841:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,501,.LM6843-main
+.LM6843:
+	call v4_Rightbrace
+.stabn 68,0,502,.LM6844-main
+.LM6844:
+	mov $4650,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-7,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM6862-main
+.LM6862:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6866-main
+.LM6866:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,502,.LM6868-main
+.LM6868:
+	call v4_Rightbrace
+.stabn 68,0,503,.LM6869-main
+.LM6869:
+	mov $4660,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-7,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM6887-main
+.LM6887:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6891-main
+.LM6891:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,503,.LM6893-main
+.LM6893:
+	call v4_Rightbrace
+.stabn 68,0,504,.LM6894-main
+.LM6894:
+	mov $4670,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6912-main
+.LM6912:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6916-main
+.LM6916:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,504,.LM6918-main
+.LM6918:
+	call v4_Rightbrace
+.stabn 68,0,505,.LM6919-main
+.LM6919:
+	mov $4680,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM6937-main
+.LM6937:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6941-main
+.LM6941:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,505,.LM6943-main
+.LM6943:
+	call v4_Rightbrace
+.stabn 68,0,506,.LM6944-main
+.LM6944:
+	mov $4690,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,459,.LM6959-main
+.LM6959:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6963-main
+.LM6963:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,506,.LM6965-main
+.LM6965:
+	call v4_Rightbrace
+.stabn 68,0,507,.LM6966-main
+.LM6966:
+	mov $4700,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,459,.LM6981-main
+.LM6981:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6985-main
+.LM6985:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,507,.LM6987-main
+.LM6987:
+	call v4_Rightbrace
+.stabn 68,0,509,.LM6988-main
+.LM6988:
+	mov $4720,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7006-main
+.LM7006:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7010-main
+.LM7010:
+	call v4_drop
+.stabn 68,0,509,.LM7011-main
+.LM7011:
+	call v4_Rightbrace
+.stabn 68,0,510,.LM7012-main
+.LM7012:
+	mov $4730,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7030-main
+.LM7030:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7034-main
+.LM7034:
+	call v4_drop
+.stabn 68,0,510,.LM7035-main
+.LM7035:
+	call v4_Rightbrace
+.stabn 68,0,511,.LM7036-main
+.LM7036:
+	mov $4740,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7054-main
+.LM7054:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7058-main
+.LM7058:
+	call v4_drop
+.stabn 68,0,511,.LM7059-main
+.LM7059:
+	call v4_Rightbrace
+.stabn 68,0,512,.LM7060-main
+.LM7060:
+	mov $4750,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7078-main
+.LM7078:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7082-main
+.LM7082:
+	call v4_drop
+.stabn 68,0,512,.LM7083-main
+.LM7083:
+	call v4_Rightbrace
+.stabn 68,0,513,.LM7084-main
+.LM7084:
+	mov $4760,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7102-main
+.LM7102:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7106-main
+.LM7106:
+	call v4_drop
+.stabn 68,0,513,.LM7107-main
+.LM7107:
+	call v4_Rightbrace
+.stabn 68,0,514,.LM7108-main
+.LM7108:
+	mov $4770,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7123-main
+.LM7123:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7127-main
+.LM7127:
+	call v4_drop
+.stabn 68,0,514,.LM7128-main
+.LM7128:
+	call v4_Rightbrace
+.stabn 68,0,515,.LM7129-main
+.LM7129:
+	mov $4780,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7144-main
+.LM7144:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7148-main
+.LM7148:
+	call v4_drop
+.stabn 68,0,515,.LM7149-main
+.LM7149:
+	call v4_Rightbrace
+.stabn 68,0,516,.LM7150-main
+.LM7150:
+	mov $4790,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7165-main
+.LM7165:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7169-main
+.LM7169:
+	call v4_drop
+.stabn 68,0,516,.LM7170-main
+.LM7170:
+	call v4_Rightbrace
+.stabn 68,0,517,.LM7171-main
+.LM7171:
+	mov $4800,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7186-main
+.LM7186:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7190-main
+.LM7190:
+	call v4_drop
+.stabn 68,0,517,.LM7191-main
+.LM7191:
+	call v4_Rightbrace
+.stabn 68,0,518,.LM7192-main
+.LM7192:
+	mov $4810,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7207-main
+.LM7207:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7211-main
+.LM7211:
+	call v4_drop
+.stabn 68,0,518,.LM7212-main
+.LM7212:
+	call v4_Rightbrace
+.stabn 68,0,519,.LM7213-main
+.LM7213:
+	mov $4820,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $31,%edx
+	add %edx,%eax
+	and $1,%eax
+	sub %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM7231-main
+.LM7231:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7235-main
+.LM7235:
+	call v4_drop
+.stabn 68,0,519,.LM7236-main
+.LM7236:
+	call v4_Rightbrace
+.stabn 68,0,520,.LM7237-main
+.LM7237:
+	mov $4830,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7252-main
+.LM7252:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7256-main
+.LM7256:
+	call v4_drop
+.stabn 68,0,520,.LM7257-main
+.LM7257:
+	call v4_Rightbrace
+.stabn 68,0,521,.LM7258-main
+.LM7258:
+	mov $4840,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $31,%edx
+	add %edx,%eax
+	and $1,%eax
+	sub %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM7276-main
+.LM7276:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7280-main
+.LM7280:
+	call v4_drop
+.stabn 68,0,521,.LM7281-main
+.LM7281:
+	call v4_Rightbrace
+.stabn 68,0,522,.LM7282-main
+.LM7282:
+	mov $4850,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $3,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM7300-main
+.LM7300:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7304-main
+.LM7304:
+	call v4_drop
+.stabn 68,0,522,.LM7305-main
+.LM7305:
+	call v4_Rightbrace
+.stabn 68,0,523,.LM7306-main
+.LM7306:
+	mov $4860,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $3,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM7324-main
+.LM7324:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7328-main
+.LM7328:
+	call v4_drop
+.stabn 68,0,523,.LM7329-main
+.LM7329:
+	call v4_Rightbrace
+.stabn 68,0,524,.LM7330-main
+.LM7330:
+	mov $4870,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $3,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-7,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM7348-main
+.LM7348:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7352-main
+.LM7352:
+	call v4_drop
+.stabn 68,0,524,.LM7353-main
+.LM7353:
+	call v4_Rightbrace
+.stabn 68,0,525,.LM7354-main
+.LM7354:
+	mov $4880,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $3,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-7,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+.stabn 68,0,459,.LM7372-main
+.LM7372:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7376-main
+.LM7376:
+	call v4_drop
+.stabn 68,0,525,.LM7377-main
+.LM7377:
+	call v4_Rightbrace
+.stabn 68,0,526,.LM7378-main
+.LM7378:
+	mov $4890,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7396-main
+.LM7396:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7400-main
+.LM7400:
+	call v4_drop
+.stabn 68,0,526,.LM7401-main
+.LM7401:
+	call v4_Rightbrace
+.stabn 68,0,527,.LM7402-main
+.LM7402:
+	mov $4900,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,459,.LM7420-main
+.LM7420:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7424-main
+.LM7424:
+	call v4_drop
+.stabn 68,0,527,.LM7425-main
+.LM7425:
+	call v4_Rightbrace
+.stabn 68,0,528,.LM7426-main
+.LM7426:
+	mov $4910,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,459,.LM7441-main
+.LM7441:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7445-main
+.LM7445:
+	call v4_drop
+.stabn 68,0,528,.LM7446-main
+.LM7446:
+	call v4_Rightbrace
+.stabn 68,0,529,.LM7447-main
+.LM7447:
+	mov $4920,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,459,.LM7462-main
+.LM7462:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7466-main
+.LM7466:
+	call v4_drop
+.stabn 68,0,529,.LM7467-main
+.LM7467:
+	call v4_Rightbrace
+.stabn 68,0,531,.LM7468-main
+.LM7468:
+	mov $4940,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,462,.LM7487-main
+.LM7487:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7491-main
+.LM7491:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,531,.LM7493-main
+.LM7493:
+	call v4_Rightbrace
+.stabn 68,0,532,.LM7494-main
+.LM7494:
+	mov $4950,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,462,.LM7513-main
+.LM7513:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7517-main
+.LM7517:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,532,.LM7519-main
+.LM7519:
+	call v4_Rightbrace
+.stabn 68,0,533,.LM7520-main
+.LM7520:
+	mov $4960,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,462,.LM7539-main
+.LM7539:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7543-main
+.LM7543:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,533,.LM7545-main
+.LM7545:
+	call v4_Rightbrace
+.stabn 68,0,534,.LM7546-main
+.LM7546:
+	mov $4970,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,462,.LM7565-main
+.LM7565:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7569-main
+.LM7569:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,534,.LM7571-main
+.LM7571:
+	call v4_Rightbrace
+.stabn 68,0,535,.LM7572-main
+.LM7572:
+	mov $4980,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,462,.LM7591-main
+.LM7591:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7595-main
+.LM7595:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,535,.LM7597-main
+.LM7597:
+	call v4_Rightbrace
+.stabn 68,0,536,.LM7598-main
+.LM7598:
+	mov $4990,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,462,.LM7617-main
+.LM7617:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7621-main
+.LM7621:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,536,.LM7623-main
+.LM7623:
+	call v4_Rightbrace
+.stabn 68,0,537,.LM7624-main
+.LM7624:
+	mov $5000,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,462,.LM7643-main
+.LM7643:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7647-main
+.LM7647:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,537,.LM7649-main
+.LM7649:
+	call v4_Rightbrace
+.stabn 68,0,538,.LM7650-main
+.LM7650:
+	mov $5010,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,462,.LM7669-main
+.LM7669:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7673-main
+.LM7673:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,538,.LM7675-main
+.LM7675:
+	call v4_Rightbrace
+.stabn 68,0,539,.LM7676-main
+.LM7676:
+	mov $5020,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,462,.LM7695-main
+.LM7695:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7699-main
+.LM7699:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,539,.LM7701-main
+.LM7701:
+	call v4_Rightbrace
+.stabn 68,0,540,.LM7702-main
+.LM7702:
+	mov $5030,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,462,.LM7721-main
+.LM7721:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7725-main
+.LM7725:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,540,.LM7727-main
+.LM7727:
+	call v4_Rightbrace
+.stabn 68,0,541,.LM7728-main
+.LM7728:
+	mov $5040,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM7747-main
+.LM7747:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7751-main
+.LM7751:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,541,.LM7753-main
+.LM7753:
+	call v4_Rightbrace
+.stabn 68,0,542,.LM7754-main
+.LM7754:
+	mov $5050,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,462,.LM7773-main
+.LM7773:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7777-main
+.LM7777:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,542,.LM7779-main
+.LM7779:
+	call v4_Rightbrace
+.stabn 68,0,543,.LM7780-main
+.LM7780:
+	mov $5060,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM7799-main
+.LM7799:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7803-main
+.LM7803:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,543,.LM7805-main
+.LM7805:
+	call v4_Rightbrace
+.stabn 68,0,544,.LM7806-main
+.LM7806:
+	mov $5070,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM7825-main
+.LM7825:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7829-main
+.LM7829:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,544,.LM7831-main
+.LM7831:
+	call v4_Rightbrace
+.stabn 68,0,545,.LM7832-main
+.LM7832:
+	mov $5080,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM7851-main
+.LM7851:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7855-main
+.LM7855:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,545,.LM7857-main
+.LM7857:
+	call v4_Rightbrace
+.stabn 68,0,546,.LM7858-main
+.LM7858:
+	mov $5090,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM7877-main
+.LM7877:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7881-main
+.LM7881:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,546,.LM7883-main
+.LM7883:
+	call v4_Rightbrace
+.stabn 68,0,547,.LM7884-main
+.LM7884:
+	mov $5100,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM7903-main
+.LM7903:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7907-main
+.LM7907:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,547,.LM7909-main
+.LM7909:
+	call v4_Rightbrace
+.stabn 68,0,548,.LM7910-main
+.LM7910:
+	mov $5110,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM7929-main
+.LM7929:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7933-main
+.LM7933:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,548,.LM7935-main
+.LM7935:
+	call v4_Rightbrace
+.stabn 68,0,549,.LM7936-main
+.LM7936:
+	mov $5120,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM7955-main
+.LM7955:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7959-main
+.LM7959:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,549,.LM7961-main
+.LM7961:
+	call v4_Rightbrace
+.stabn 68,0,551,.LM7962-main
+.LM7962:
+	mov $5140,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,462,.LM7980-main
+.LM7980:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,551,.LM7984-main
+.LM7984:
+	call v4_Rightbrace
+.stabn 68,0,552,.LM7985-main
+.LM7985:
+	mov $5150,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,462,.LM8003-main
+.LM8003:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,552,.LM8007-main
+.LM8007:
+	call v4_Rightbrace
+.stabn 68,0,553,.LM8008-main
+.LM8008:
+	mov $5160,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,462,.LM8026-main
+.LM8026:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,553,.LM8030-main
+.LM8030:
+	call v4_Rightbrace
+.stabn 68,0,554,.LM8031-main
+.LM8031:
+	mov $5170,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,462,.LM8049-main
+.LM8049:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,554,.LM8053-main
+.LM8053:
+	call v4_Rightbrace
+.stabn 68,0,555,.LM8054-main
+.LM8054:
+	mov $5180,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,462,.LM8072-main
+.LM8072:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,555,.LM8076-main
+.LM8076:
+	call v4_Rightbrace
+.stabn 68,0,556,.LM8077-main
+.LM8077:
+	mov $5190,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,462,.LM8095-main
+.LM8095:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,556,.LM8099-main
+.LM8099:
+	call v4_Rightbrace
+.stabn 68,0,557,.LM8100-main
+.LM8100:
+	mov $5200,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,462,.LM8118-main
+.LM8118:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,557,.LM8122-main
+.LM8122:
+	call v4_Rightbrace
+.stabn 68,0,558,.LM8123-main
+.LM8123:
+	mov $5210,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,462,.LM8141-main
+.LM8141:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,558,.LM8145-main
+.LM8145:
+	call v4_Rightbrace
+.stabn 68,0,559,.LM8146-main
+.LM8146:
+	mov $5220,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,462,.LM8164-main
+.LM8164:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,559,.LM8168-main
+.LM8168:
+	call v4_Rightbrace
+.stabn 68,0,560,.LM8169-main
+.LM8169:
+	mov $5230,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,462,.LM8187-main
+.LM8187:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,560,.LM8191-main
+.LM8191:
+	call v4_Rightbrace
+.stabn 68,0,561,.LM8192-main
+.LM8192:
+	mov $5240,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM8210-main
+.LM8210:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,561,.LM8214-main
+.LM8214:
+	call v4_Rightbrace
+.stabn 68,0,562,.LM8215-main
+.LM8215:
+	mov $5250,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+.stabn 68,0,462,.LM8233-main
+.LM8233:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,562,.LM8237-main
+.LM8237:
+	call v4_Rightbrace
+.stabn 68,0,563,.LM8238-main
+.LM8238:
+	mov $5260,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-2,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM8256-main
+.LM8256:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,563,.LM8260-main
+.LM8260:
+	call v4_Rightbrace
+.stabn 68,0,564,.LM8261-main
+.LM8261:
+	mov $5270,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM8279-main
+.LM8279:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,564,.LM8283-main
+.LM8283:
+	call v4_Rightbrace
+.stabn 68,0,565,.LM8284-main
+.LM8284:
+	mov $5280,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM8302-main
+.LM8302:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,565,.LM8306-main
+.LM8306:
+	call v4_Rightbrace
+.stabn 68,0,566,.LM8307-main
+.LM8307:
+	mov $5290,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM8325-main
+.LM8325:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,566,.LM8329-main
+.LM8329:
+	call v4_Rightbrace
+.stabn 68,0,567,.LM8330-main
+.LM8330:
+	mov $5300,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM8348-main
+.LM8348:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,567,.LM8352-main
+.LM8352:
+	call v4_Rightbrace
+.stabn 68,0,568,.LM8353-main
+.LM8353:
+	mov $5310,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM8371-main
+.LM8371:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,568,.LM8375-main
+.LM8375:
+	call v4_Rightbrace
+.stabn 68,0,569,.LM8376-main
+.LM8376:
+	mov $5320,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+.stabn 68,0,462,.LM8394-main
+.LM8394:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,569,.LM8398-main
+.LM8398:
+	call v4_Rightbrace
+.stabn 68,0,572,.LM8399-main
+.LM8399:
+	lea .LC10,%eax
+	call v4__dpush
+	mov $74,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,583,.LM8405-main
+.LM8405:
+	lea v4_hbuf,%eax
+	call v4__dpush
+	lea v4__here,%eax
+	call v4__dpush
+	call v4_Store
+.stabn 68,0,585,.LM8410-main
+.LM8410:
+	call v4_here
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Comma
+.stabn 68,0,586,.LM8414-main
+.LM8414:
+	call v4_here
+	mov $2,%eax
+	call v4__dpush
+	call v4_Comma
+.stabn 68,0,587,.LM8418-main
+.LM8418:
+	call v4__dpop
+	mov %eax,(v4_z2nd)
+.stabn 68,0,588,.LM8420-main
+.LM8420:
+	call v4__dpop
+	mov %eax,(v4_z1st)
+.stabn 68,0,589,.LM8422-main
+.LM8422:
+	mov $5490,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	mov %eax,%ecx
+	mov (v4_z2nd),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,590,.LM8438-main
+.LM8438:
+	mov $5500,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	add $4,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov (v4_z2nd),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,591,.LM8451-main
+.LM8451:
+	mov $5510,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	mov %eax,%ecx
+	mov $4,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov (v4_z2nd),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,592,.LM8468-main
+.LM8468:
+	mov $5520,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	call v4__dpush
+	call v4_Fetch
+	mov (v4_z2nd),%eax
+	call v4__dpush
+	call v4_Fetch
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,593,.LM8483-main
+.LM8483:
+	mov $5530,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+	mov (v4_z1st),%eax
+	call v4__dpush
+	call v4_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,594,.LM8493-main
+.LM8493:
+	mov $5540,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	call v4__dpush
+	call v4_Fetch
+	mov (v4_z2nd),%eax
+	call v4__dpush
+	call v4_Fetch
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,595,.LM8508-main
+.LM8508:
+	mov $5550,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%eax
+	call v4__dpush
+	mov (v4_z2nd),%eax
+	call v4__dpush
+	call v4_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,596,.LM8518-main
+.LM8518:
+	mov $5560,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	call v4__dpush
+	call v4_Fetch
+	mov (v4_z2nd),%eax
+	call v4__dpush
+	call v4_Fetch
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,597,.LM8533-main
+.LM8533:
+	mov $5570,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	call v4__dpush
+	call v4_z2_Fetch
+	call v4_Minus_Greater
+	mov $6,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,598,.LM8545-main
+.LM8545:
+	mov $5580,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov (v4_z1st),%eax
+	call v4__dpush
+	call v4_z2_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,599,.LM8557-main
+.LM8557:
+	mov $5590,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	call v4__dpush
+	call v4_z2_Fetch
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,601,.LM8569-main
+.LM8569:
+	call v4_here
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_c_Comma
+.stabn 68,0,602,.LM8573-main
+.LM8573:
+	call v4_here
+	mov $2,%eax
+	call v4__dpush
+	call v4_c_Comma
+.stabn 68,0,603,.LM8577-main
+.LM8577:
+	call v4__dpop
+	mov %eax,(v4_z2ndc)
+.stabn 68,0,604,.LM8579-main
+.LM8579:
+	call v4__dpop
+	mov %eax,(v4_z1stc)
+.stabn 68,0,605,.LM8581-main
+.LM8581:
+	mov $5650,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1stc),%eax
+	mov %eax,%ecx
+	mov (v4_z2ndc),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,606,.LM8597-main
+.LM8597:
+	mov $5660,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1stc),%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_Minus_Greater
+	mov (v4_z2ndc),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,607,.LM8607-main
+.LM8607:
+	mov $5670,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1stc),%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov (v4_z2ndc),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,608,.LM8624-main
+.LM8624:
+	mov $5680,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1stc),%eax
+	call v4__dpush
+	call v4_c_Fetch
+	mov (v4_z2ndc),%eax
+	call v4__dpush
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,609,.LM8639-main
+.LM8639:
+	mov $5690,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+	mov (v4_z1stc),%eax
+	call v4__dpush
+	call v4_c_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,610,.LM8649-main
+.LM8649:
+	mov $5700,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1stc),%eax
+	call v4__dpush
+	call v4_c_Fetch
+	mov (v4_z2ndc),%eax
+	call v4__dpush
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,611,.LM8664-main
+.LM8664:
+	mov $5710,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	call v4__dpush
+	mov (v4_z2ndc),%eax
+	call v4__dpush
+	call v4_c_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,612,.LM8674-main
+.LM8674:
+	mov $5720,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1stc),%eax
+	call v4__dpush
+	call v4_c_Fetch
+	mov (v4_z2ndc),%eax
+	call v4__dpush
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,614,.LM8689-main
+.LM8689:
+	call v4_align
+.stabn 68,0,615,.LM8690-main
+.LM8690:
+	call v4_here
+	xor %eax,%eax
+	call v4__dpush
+	call v4_c_Comma
+	call v4_align
+	mov $123,%eax
+	call v4__dpush
+	call v4_Comma
+	call v4__dpop
+	mov %eax,(v4_x)
+.stabn 68,0,617,.LM8700-main
+.LM8700:
+	mov $5750,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_x),%eax
+	inc %eax
+	call v4__dpush
+	call v4_aligned
+	call v4_Fetch
+	call v4_Minus_Greater
+	mov $123,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,620,.LM8715-main
+.LM8715:
+	mov $5780,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,622,.LM8732-main
+.LM8732:
+	mov $5800,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	mov (v4_z1st),%eax
+	call v4__dpush
+	call v4_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,623,.LM8742-main
+.LM8742:
+	mov $5810,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov (v4_z1st),%eax
+	call v4__dpush
+	call v4_Plus_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,624,.LM8752-main
+.LM8752:
+	mov $5820,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	call v4__dpush
+	call v4_Fetch
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,625,.LM8762-main
+.LM8762:
+	mov $5830,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov (v4_z1st),%eax
+	call v4__dpush
+	call v4_Plus_Store
+	mov (v4_z1st),%eax
+	call v4__dpush
+	call v4_Fetch
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,628,.LM8777-main
+.LM8777:
+	lea .LC11,%eax
+	call v4__dpush
+	mov $35,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,630,.LM8783-main
+.LM8783:
+	mov $5880,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_bl
+	call v4_Minus_Greater
+	mov $32,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,631,.LM8791-main
+.LM8791:
+	mov $5890,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $88,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $88,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,632,.LM8800-main
+.LM8800:
+	mov $5900,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $72,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $72,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,633,.LM8809-main
+.LM8809:
+	mov $5910,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,634,.LM8814-main
+.LM8814:
+	mov $5920,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,635,.LM8819-main
+.LM8819:
+	mov $5930,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,633,.LM8823-main
+.LM8823:
+	mov $88,%eax
+	call v4__dpush
+.stabn 68,0,635,.LM8825-main
+.LM8825:
+	call v4_Minus_Greater
+	mov $88,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,636,.LM8829-main
+.LM8829:
+	mov $5940,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,634,.LM8833-main
+.LM8833:
+	mov $72,%eax
+	call v4__dpush
+.stabn 68,0,636,.LM8835-main
+.LM8835:
+	call v4_Minus_Greater
+	mov $72,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,637,.LM8839-main
+.LM8839:
+	mov $5950,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,638,.LM8844-main
+.LM8844:
+	mov $5960,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,637,.LM8848-main
+.LM8848:
+	call v4_Leftbracket
+.stabn 68,0,633,.LM8850-main
+.LM8850:
+	mov $88,%eax
+	call v4__dpush
+.stabn 68,0,637,.LM8852-main
+.LM8852:
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,638,.LM8854-main
+.LM8854:
+	call v4_Minus_Greater
+	mov $88,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,639,.LM8858-main
+.LM8858:
+	mov $5970,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,640,.LM8863-main
+.LM8863:
+	mov $5980,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,639,.LM8867-main
+.LM8867:
+	lea .LC12,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+.stabn 68,0,640,.LM8871-main
+.LM8871:
+	call v4_swap
+	call v4_drop
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,641,.LM8877-main
+.LM8877:
+	mov $5990,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,639,.LM8881-main
+.LM8881:
+	lea .LC12,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+.stabn 68,0,641,.LM8885-main
+.LM8885:
+	call v4_drop
+	call v4_dup
+	call v4_c_Fetch
+	call v4_swap
+	call v4_char_Plus
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	mov $88,%eax
+	call v4__dpush
+	mov $89,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,644,.LM8897-main
+.LM8897:
+	lea .LC13,%eax
+	call v4__dpush
+	mov $65,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,646,.LM8903-main
+.LM8903:
+	mov $6040,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,647,.LM8908-main
+.LM8908:
+	mov $6050,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_gt1,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	mov $123,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,648,.LM8918-main
+.LM8918:
+	mov $6060,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_immediate
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,649,.LM8924-main
+.LM8924:
+	mov $6070,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,648,.LM8928-main
+.LM8928:
+	lea v4_gt1,%eax
+	call v4__dpush
+.stabn 68,0,649,.LM8930-main
+.LM8930:
+	call v4_execute
+	call v4_Minus_Greater
+	mov $123,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,666,.LM8935-main
+.LM8935:
+	mov $6240,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_immediate
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,667,.LM8941-main
+.LM8941:
+	mov $6250,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,666,.LM8945-main
+.LM8945:
+	call v4_state
+	call v4_Fetch
+.stabn 68,0,667,.LM8947-main
+.LM8947:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,668,.LM8951-main
+.LM8951:
+	mov $6260,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,669,.LM8956-main
+.LM8956:
+	mov $6270,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,668,.LM8960-main
+.LM8960:
+	lea v4_gt8,%eax
+	call v4__dpush
+	call v4_literal
+	call v4__dpop
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,672,.LM8971-main
+.LM8971:
+	lea .LC14,%eax
+	call v4__dpush
+	mov $53,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,674,.LM8977-main
+.LM8977:
+	mov $6320,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,675,.LM8982-main
+.LM8982:
+	mov $6330,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,676,.LM8987-main
+.LM8987:
+	mov $6340,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	je .L123
+	mov $123,%eax
+	call v4__dpush
+.L123:
+.stabn 68,0,676,.LM8998-main
+.LM8998:
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,677,.LM9000-main
+.LM9000:
+	mov $6350,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	je .L124
+	mov $123,%eax
+	call v4__dpush
+.L124:
+.stabn 68,0,677,.LM9011-main
+.LM9011:
+	call v4_Minus_Greater
+	mov $123,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,678,.LM9015-main
+.LM9015:
+	mov $6360,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	je .L125
+	mov $123,%eax
+	call v4__dpush
+.L125:
+.stabn 68,0,678,.LM9026-main
+.LM9026:
+	call v4_Minus_Greater
+	mov $123,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,679,.LM9030-main
+.LM9030:
+	mov $6370,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	je .L126
+	mov $123,%eax
+	call v4__dpush
+	jmp .L127
+.L126:
+	mov $234,%eax
+	call v4__dpush
+.L127:
+.stabn 68,0,679,.LM9045-main
+.LM9045:
+	call v4_Minus_Greater
+	mov $234,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,680,.LM9049-main
+.LM9049:
+	mov $6380,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	je .L128
+	mov $123,%eax
+	call v4__dpush
+	jmp .L129
+.L128:
+	mov $234,%eax
+	call v4__dpush
+.L129:
+.stabn 68,0,680,.LM9064-main
+.LM9064:
+	call v4_Minus_Greater
+	mov $123,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,681,.LM9068-main
+.LM9068:
+	mov $6390,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	je .L130
+	mov $123,%eax
+	call v4__dpush
+.L130:
+.stabn 68,0,681,.LM9079-main
+.LM9079:
+	call v4_Minus_Greater
+	mov $123,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,683,.LM9083-main
+.LM9083:
+	mov $6410,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,684,.LM9088-main
+.LM9088:
+	mov $6420,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+.L131:
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L132
+	call v4_dup
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	jmp .L131
+.L132:
+.stabn 68,0,684,.LM9111-main
+.LM9111:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,685,.LM9125-main
+.LM9125:
+	mov $6430,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	call v4__dpush
+.L133:
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L134
+	call v4_dup
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	jmp .L133
+.L134:
+.stabn 68,0,685,.LM9148-main
+.LM9148:
+	call v4_Minus_Greater
+	mov $4,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,686,.LM9154-main
+.LM9154:
+	mov $6440,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+.L135:
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L136
+	call v4_dup
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	jmp .L135
+.L136:
+.stabn 68,0,686,.LM9177-main
+.LM9177:
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,687,.LM9181-main
+.LM9181:
+	mov $6450,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%eax
+	call v4__dpush
+.L137:
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L138
+	call v4_dup
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	jmp .L137
+.L138:
+.stabn 68,0,687,.LM9204-main
+.LM9204:
+	call v4_Minus_Greater
+	mov $6,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,689,.LM9208-main
+.LM9208:
+	mov $6470,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,690,.LM9213-main
+.LM9213:
+	mov $6480,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+.L139:
+	call v4_dup
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L139
+.stabn 68,0,690,.LM9234-main
+.LM9234:
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,691,.LM9244-main
+.LM9244:
+	mov $6490,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+.L140:
+	call v4_dup
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L140
+.stabn 68,0,691,.LM9265-main
+.LM9265:
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,692,.LM9271-main
+.LM9271:
+	mov $6500,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%eax
+	call v4__dpush
+.L141:
+	call v4_dup
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L141
+.stabn 68,0,692,.LM9292-main
+.LM9292:
+	call v4_Minus_Greater
+	mov $6,%eax
+	call v4__dpush
+	mov $7,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,694,.LM9298-main
+.LM9298:
+	mov $6520,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,695,.LM9303-main
+.LM9303:
+	mov $6530,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_gi5
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,696,.LM9313-main
+.LM9313:
+	mov $6540,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,697,.LM9323-main
+.LM9323:
+	mov $6550,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,698,.LM9337-main
+.LM9337:
+	mov $6560,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	call v4__dpush
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $4,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,699,.LM9349-main
+.LM9349:
+	mov $6570,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,701,.LM9359-main
+.LM9359:
+	mov $6600,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,702,.LM9364-main
+.LM9364:
+	mov $6610,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,703,.LM9374-main
+.LM9374:
+	mov $6620,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,704,.LM9386-main
+.LM9386:
+	mov $6630,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,705,.LM9400-main
+.LM9400:
+	mov $6640,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,706,.LM9416-main
+.LM9416:
+	mov $6650,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	call v4__dpush
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,709,.LM9434-main
+.LM9434:
+	lea .LC15,%eax
+	call v4__dpush
+	mov $43,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,711,.LM9440-main
+.LM9440:
+	mov $6700,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,712,.LM9445-main
+.LM9445:
+	mov $6710,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_gd1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,713,.LM9461-main
+.LM9461:
+	mov $6720,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_gd1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,714,.LM9477-main
+.LM9477:
+	mov $6730,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_gd1
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,716,.LM9489-main
+.LM9489:
+	mov $6750,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,717,.LM9494-main
+.LM9494:
+	mov $6760,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_gd2
+	call v4_Minus_Greater
+	mov $4,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,718,.LM9512-main
+.LM9512:
+	mov $6770,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_gd2
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,719,.LM9530-main
+.LM9530:
+	mov $6780,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_gd2
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,721,.LM9544-main
+.LM9544:
+	mov $6800,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,722,.LM9549-main
+.LM9549:
+	mov $6810,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_gd3
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,723,.LM9565-main
+.LM9565:
+	mov $6820,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_gd3
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,724,.LM9581-main
+.LM9581:
+	mov $6830,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_gd3
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,726,.LM9593-main
+.LM9593:
+	mov $6850,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,727,.LM9598-main
+.LM9598:
+	mov $6860,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_gd4
+	call v4_Minus_Greater
+	mov $4,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,728,.LM9616-main
+.LM9616:
+	mov $6870,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_gd4
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,729,.LM9634-main
+.LM9634:
+	mov $6880,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	call v4__dpush
+	mov $-2147483648,%eax
+	call v4__dpush
+	call v4_gd4
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	call v4__dpush
+	mov $2147483647,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,731,.LM9648-main
+.LM9648:
+	mov $6900,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,732,.LM9653-main
+.LM9653:
+	mov $6910,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_gd5
+	call v4_Minus_Greater
+	mov $123,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,733,.LM9663-main
+.LM9663:
+	mov $6920,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+	call v4_gd5
+	call v4_Minus_Greater
+	mov $123,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,734,.LM9673-main
+.LM9673:
+	mov $6930,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%eax
+	call v4__dpush
+	call v4_gd5
+	call v4_Minus_Greater
+	mov $234,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,736,.LM9683-main
+.LM9683:
+	mov $6950,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,739,.LM9686-main
+.LM9686:
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,740,.LM9688-main
+.LM9688:
+	mov $6990,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_gd6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,741,.LM9698-main
+.LM9698:
+	mov $7000,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	call v4_gd6
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,742,.LM9708-main
+.LM9708:
+	mov $7010,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+	call v4_gd6
+	call v4_Minus_Greater
+	mov $4,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,824,.LM9722-main
+.LM9722:
+	lea .LC16,%eax
+	call v4__dpush
+	mov $53,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,840,.LM9728-main
+.LM9728:
+	mov $7990,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_gp1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,843,.LM9736-main
+.LM9736:
+	mov $8020,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_gp2
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,846,.LM9744-main
+.LM9744:
+	mov $8050,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_gp3
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,849,.LM9752-main
+.LM9752:
+	mov $8080,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,848,.LM9756-main
+.LM9756:
+	call v4_Less_Hash
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Hashs
+	call v4_Hash_Greater
+	lea .LC20,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_s_Equals
+.stabn 68,0,849,.LM9768-main
+.LM9768:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,851,.LM9772-main
+.LM9772:
+	mov $36,%eax
+	mov %eax,(v4_max_Minusbase)
+.stabn 68,0,854,.LM9776-main
+.LM9776:
+	call v4_count_Minusbits
+	call v4__dpop
+	add %eax,%eax
+	mov %eax,(v4_Hashbits_Minusud)
+.stabn 68,0,863,.LM9783-main
+.LM9783:
+	mov $8220,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_gp5
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,876,.LM9791-main
+.LM9791:
+	mov $8330,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_gp6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,912,.LM9799-main
+.LM9799:
+	mov $8690,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_gp7
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,924,.LM9807-main
+.LM9807:
+	mov $8800,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $48,%eax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9820-main
+.LM9820:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM9824-main
+.LM9824:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,924,.LM9828-main
+.LM9828:
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,920,.LM9835-main
+.LM9835:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,924,.LM9840-main
+.LM9840:
+	call v4_Rightbrace
+.stabn 68,0,925,.LM9841-main
+.LM9841:
+	mov $8810,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $49,%eax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9854-main
+.LM9854:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM9858-main
+.LM9858:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,925,.LM9862-main
+.LM9862:
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,920,.LM9869-main
+.LM9869:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,925,.LM9874-main
+.LM9874:
+	call v4_Rightbrace
+.stabn 68,0,926,.LM9875-main
+.LM9875:
+	mov $8820,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $49,%eax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9888-main
+.LM9888:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM9892-main
+.LM9892:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,926,.LM9896-main
+.LM9896:
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	call v4_base
+	call v4_Fetch
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,920,.LM9907-main
+.LM9907:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,926,.LM9912-main
+.LM9912:
+	call v4_Rightbrace
+.stabn 68,0,927,.LM9913-main
+.LM9913:
+	mov $8830,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $45,%eax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9926-main
+.LM9926:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM9930-main
+.LM9930:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,927,.LM9934-main
+.LM9934:
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,919,.LM9941-main
+.LM9941:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,927,.LM9945-main
+.LM9945:
+	call v4_Rightbrace
+.stabn 68,0,928,.LM9946-main
+.LM9946:
+	mov $8840,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $43,%eax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9959-main
+.LM9959:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM9963-main
+.LM9963:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,928,.LM9967-main
+.LM9967:
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,919,.LM9974-main
+.LM9974:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,928,.LM9978-main
+.LM9978:
+	call v4_Rightbrace
+.stabn 68,0,929,.LM9979-main
+.LM9979:
+	mov $8850,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $46,%eax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9992-main
+.LM9992:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM9996-main
+.LM9996:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,929,.LM10000-main
+.LM10000:
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,919,.LM10007-main
+.LM10007:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,929,.LM10011-main
+.LM10011:
+	call v4_Rightbrace
+.stabn 68,0,934,.LM10012-main
+.LM10012:
+	mov $8900,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $50,%eax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10025-main
+.LM10025:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10029-main
+.LM10029:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,934,.LM10033-main
+.LM10033:
+	mov $16,%eax
+	call v4__dpush
+.stabn 68,0,932,.LM10036-main
+.LM10036:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,934,.LM10045-main
+.LM10045:
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,920,.LM10051-main
+.LM10051:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,934,.LM10056-main
+.LM10056:
+	call v4_Rightbrace
+.stabn 68,0,935,.LM10057-main
+.LM10057:
+	mov $8910,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $50,%eax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10070-main
+.LM10070:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10074-main
+.LM10074:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,935,.LM10078-main
+.LM10078:
+	mov $2,%eax
+	call v4__dpush
+.stabn 68,0,932,.LM10081-main
+.LM10081:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,935,.LM10090-main
+.LM10090:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,919,.LM10096-main
+.LM10096:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,935,.LM10100-main
+.LM10100:
+	call v4_Rightbrace
+.stabn 68,0,936,.LM10101-main
+.LM10101:
+	mov $8920,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $70,%eax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10114-main
+.LM10114:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10118-main
+.LM10118:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,936,.LM10122-main
+.LM10122:
+	mov $16,%eax
+	call v4__dpush
+.stabn 68,0,932,.LM10125-main
+.LM10125:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,936,.LM10134-main
+.LM10134:
+	call v4_Minus_Greater
+	mov $15,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,920,.LM10140-main
+.LM10140:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,936,.LM10145-main
+.LM10145:
+	call v4_Rightbrace
+.stabn 68,0,937,.LM10146-main
+.LM10146:
+	mov $8930,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $71,%eax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10159-main
+.LM10159:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10163-main
+.LM10163:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,937,.LM10167-main
+.LM10167:
+	mov $16,%eax
+	call v4__dpush
+.stabn 68,0,932,.LM10170-main
+.LM10170:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,937,.LM10179-main
+.LM10179:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,919,.LM10185-main
+.LM10185:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,937,.LM10189-main
+.LM10189:
+	call v4_Rightbrace
+.stabn 68,0,938,.LM10190-main
+.LM10190:
+	mov $8940,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $71,%eax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10203-main
+.LM10203:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10207-main
+.LM10207:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,938,.LM10211-main
+.LM10211:
+	mov $36,%eax
+	call v4__dpush
+.stabn 68,0,932,.LM10214-main
+.LM10214:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,938,.LM10223-main
+.LM10223:
+	call v4_Minus_Greater
+	mov $16,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,920,.LM10229-main
+.LM10229:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,938,.LM10234-main
+.LM10234:
+	call v4_Rightbrace
+.stabn 68,0,939,.LM10235-main
+.LM10235:
+	mov $8950,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $90,%eax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10248-main
+.LM10248:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10252-main
+.LM10252:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,939,.LM10256-main
+.LM10256:
+	mov $36,%eax
+	call v4__dpush
+.stabn 68,0,932,.LM10259-main
+.LM10259:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,939,.LM10268-main
+.LM10268:
+	call v4_Minus_Greater
+	mov $35,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,920,.LM10274-main
+.LM10274:
+	lea v4_gn_Minusbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,939,.LM10279-main
+.LM10279:
+	call v4_Rightbrace
+.stabn 68,0,946,.LM10280-main
+.LM10280:
+	mov $9020,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,947,.LM10298-main
+.LM10298:
+	mov $9030,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,949,.LM10316-main
+.LM10316:
+	mov $9050,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	mov $36,%eax
+	call v4__dpush
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,950,.LM10334-main
+.LM10334:
+	mov $9060,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	mov $36,%eax
+	call v4__dpush
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,955,.LM10352-main
+.LM10352:
+	mov $9110,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,954,.LM10356-main
+.LM10356:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_base
+	call v4_Fetch
+	call v4_decimal
+	call v4_base
+	call v4_Fetch
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,955,.LM10368-main
+.LM10368:
+	call v4_Minus_Greater
+	mov $16,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,958,.LM10374-main
+.LM10374:
+	lea .LC22,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,964,.LM10380-main
+.LM10380:
+	mov $18,%eax
+	call v4__dpush
+	lea v4_sbuf,%eax
+	call v4__dpush
+	call v4_c_Store
+	mov $52,%eax
+	call v4__dpush
+	lea v4_sbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Store
+	mov $86,%eax
+	call v4__dpush
+	lea v4_sbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Store
+.stabn 68,0,967,.LM10398-main
+.LM10398:
+	mov $9220,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_fbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	call v4_fill
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,968,.LM10410-main
+.LM10410:
+	mov $9230,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10414-main
+.LM10414:
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,968,.LM10426-main
+.LM10426:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,970,.LM10434-main
+.LM10434:
+	mov $9250,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_fbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	call v4_fill
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,971,.LM10446-main
+.LM10446:
+	mov $9260,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10450-main
+.LM10450:
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,971,.LM10462-main
+.LM10462:
+	call v4_Minus_Greater
+	mov $32,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,973,.LM10470-main
+.LM10470:
+	mov $9280,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_fbuf,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	call v4_fill
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,974,.LM10482-main
+.LM10482:
+	mov $9290,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10486-main
+.LM10486:
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,974,.LM10498-main
+.LM10498:
+	call v4_Minus_Greater
+	mov $32,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,976,.LM10506-main
+.LM10506:
+	mov $9310,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_fbuf,%eax
+	call v4__dpush
+	lea v4_fbuf,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,977,.LM10519-main
+.LM10519:
+	mov $9320,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10523-main
+.LM10523:
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,977,.LM10535-main
+.LM10535:
+	call v4_Minus_Greater
+	mov $32,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,979,.LM10543-main
+.LM10543:
+	mov $9340,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_sbuf,%eax
+	call v4__dpush
+	lea v4_fbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,980,.LM10556-main
+.LM10556:
+	mov $9350,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10560-main
+.LM10560:
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,980,.LM10572-main
+.LM10572:
+	call v4_Minus_Greater
+	mov $32,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,982,.LM10580-main
+.LM10580:
+	mov $9370,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_sbuf,%eax
+	call v4__dpush
+	lea v4_fbuf,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,983,.LM10593-main
+.LM10593:
+	mov $9380,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10597-main
+.LM10597:
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,983,.LM10609-main
+.LM10609:
+	call v4_Minus_Greater
+	mov $18,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	mov $32,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,985,.LM10617-main
+.LM10617:
+	mov $9400,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_sbuf,%eax
+	call v4__dpush
+	lea v4_fbuf,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,986,.LM10630-main
+.LM10630:
+	mov $9410,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10634-main
+.LM10634:
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,986,.LM10646-main
+.LM10646:
+	call v4_Minus_Greater
+	mov $18,%eax
+	call v4__dpush
+	mov $52,%eax
+	call v4__dpush
+	mov $86,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,988,.LM10654-main
+.LM10654:
+	mov $9430,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_fbuf,%eax
+	call v4__dpush
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	mov $2,%eax
+	call v4__dpush
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,989,.LM10668-main
+.LM10668:
+	mov $9440,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10672-main
+.LM10672:
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,989,.LM10684-main
+.LM10684:
+	call v4_Minus_Greater
+	mov $18,%eax
+	call v4__dpush
+	mov $18,%eax
+	call v4__dpush
+	mov $52,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,991,.LM10692-main
+.LM10692:
+	mov $9460,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	lea v4_fbuf,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,992,.LM10706-main
+.LM10706:
+	mov $9470,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10710-main
+.LM10710:
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,992,.LM10722-main
+.LM10722:
+	call v4_Minus_Greater
+	mov $18,%eax
+	call v4__dpush
+	mov $52,%eax
+	call v4__dpush
+	mov $52,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,995,.LM10730-main
+.LM10730:
+	lea .LC23,%eax
+	call v4__dpush
+	mov $54,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1013,.LM10736-main
+.LM10736:
+	mov $9680,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_output_Minustest
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,1016,.LM10742-main
+.LM10742:
+	lea .LC34,%eax
+	call v4__dpush
+	mov $21,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1027,.LM10748-main
+.LM10748:
+	mov $9820,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_accept_Minustest
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,1037,.LM10754-main
+.LM10754:
+	call v4_test_Minusstatus
+	call v4_Fetch
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE1:
+.stabn 68,0,1037,.LM10758-main
+.LM10758:
+	pop %ebx
+	leave
+	ret
+.Lfe1:
+	.size	 main,.Lfe1-main
+.stabn	192,0,0,.LBB1-main
+.stabn	224,0,0,.LBE1-main
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,13312 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: corestk.ft
+Compiled: Sat Oct 17 11:02:36 2026
+Flags: debug stack-register optimize intermediate assembly
+
+Data:
+  1009 Data_32 string[10] "  SIGNED: "
+   842 Data_18 string[2] "--"
+   845 Data_19 string[2] "01"
+   848 Data_20 string[1] "1"
+   860 Data_21 string[2] "10"
+   839 Data_17 string[2] "BA"
+  1007 Data_29 string[6] "LINE 1"
+  1007 Data_30 string[6] "LINE 2"
+  1021 Data_35 string[32] "PLEASE TYPE UP TO 80 CHARACTERS:"
+  1023 Data_36 string[10] "RECEIVED: "
+   644 Data_13 string[65] "TESTING ' ['] FIND EXECUTE IMMEDIATE COUNT LITERAL POSTPONE STATE"
+    51 Data_2 string[27] "TESTING 2* 2/ LSHIFT RSHIFT"
+   824 Data_16 string[53] "TESTING <# # #S #> HOLD SIGN BASE >NUMBER HEX DECIMAL"
+   260 Data_6 string[16] "TESTING >R R> R@"
+   268 Data_7 string[42] "TESTING ADD/SUBTRACT: + - 1+ 1- ABS NEGATE"
+    19 Data_1 string[35] "TESTING BOOLEANS: INVERT AND OR XOR"
+   219 Data_4 string[27] "TESTING CELL WIDTH LITERALS"
+   628 Data_11 string[35] "TESTING CHAR [CHAR] [ ] BL S_quotes"
+    86 Data_3 string[54] "TESTING COMPARISONS: 0= = 0< < > U< U> U<= U>= MIN MAX"
+    13 Data_0 string[18] "TESTING CORE WORDS"
+   371 Data_9 string[56] "TESTING DIVIDE: FM/MOD SM/REM UM/MOD */ */MOD / /MOD MOD"
+   709 Data_15 string[43] "TESTING DO LOOP +LOOP I J UNLOOP LEAVE EXIT"
+   958 Data_22 string[17] "TESTING FILL MOVE"
+   572 Data_10 string[74] "TESTING HERE , @ ! CELL+ CELLS C, C@ C! CHARS 2@ 2! ALIGN ALIGNED +! ALLOT"
+   672 Data_14 string[53] "TESTING IF ELSE THEN BEGIN WHILE REPEAT UNTIL RECURSE"
+  1016 Data_34 string[21] "TESTING INPUT: ACCEPT"
+   314 Data_8 string[30] "TESTING MULTIPLY: S>D * M* UM*"
+   995 Data_23 string[54] "TESTING OUTPUT: . ._quote CR EMIT SPACE SPACES TYPE U."
+   240 Data_5 string[75] "TESTING STACK OPS: 2DROP 2DUP 2OVER 2SWAP ?DUP DEPTH DROP DUP OVER ROT SWAP"
+  1010 Data_33 string[10] "UNSIGNED: "
+   639 Data_12 string[2] "XY"
+  1004 Data_27 string[43] "YOU SHOULD SEE 0-5 SEPARATED BY TWO SPACES:"
+  1000 Data_25 string[36] "YOU SHOULD SEE 0-9 (WITH NO SPACES):"
+   998 Data_24 string[40] "YOU SHOULD SEE 0-9 SEPARATED BY A SPACE:"
+  1002 Data_26 string[40] "YOU SHOULD SEE A-G SEPARATED BY A SPACE:"
+  1008 Data_31 string[64] "YOU SHOULD SEE THE NUMBER RANGES OF SIGNED AND UNSIGNED NUMBERS:"
+  1006 Data_28 string[34] "YOU SHOULD SEE TWO SEPARATE LINES:"
+
+Symbols:
+    13 Sym_1 word "main"
+   585 Sym_82 external "v4_Comma"
+   999 Sym_164 external "v4_Dot"
+   105 Sym_30 external "v4_Equals"
+   592 Sym_87 external "v4_Fetch"
+   136 Sym_33 external "v4_Greater"
+   924 Sym_152 external "v4_Greaternumber"
+   931 Sym_153 word "v4_Greaternumber_Minusbased"
+   262 Sym_53 external "v4_Greaterr"
+   845 Sym_138 external "v4_Hash"
+   839 Sym_134 external "v4_Hash_Greater"
+   854 Sym_143 constant "v4_Hashbits_Minusud"
+   848 Sym_140 external "v4_Hashs"
+    21 Sym_6 external "v4_Leftbrace"
+   637 Sym_105 external "v4_Leftbracket"
+   119 Sym_32 external "v4_Less"
+   839 Sym_132 external "v4_Less_Hash"
+    93 Sym_27 constant "v4_Lessfalse_Greater"
+    94 Sym_28 constant "v4_Lesstrue_Greater"
+   281 Sym_58 external "v4_Minus"
+    21 Sym_8 external "v4_Minus_Greater"
+   270 Sym_57 external "v4_Plus"
+   623 Sym_100 external "v4_Plus_Store"
+   246 Sym_46 external "v4_Questiondup"
+    21 Sym_9 external "v4_Rightbrace"
+   637 Sym_106 external "v4_Rightbracket"
+   487 Sym_75 external "v4_Slash"
+   465 Sym_74 external "v4_Slashmod"
+   343 Sym_64 external "v4_Star"
+   531 Sym_77 external "v4_Star_Slash"
+   551 Sym_78 external "v4_Star_Slashmod"
+    16 Sym_5 external "v4_Store"
+   583 Sym_80 external "v4__here"
+    16 Sym_4 external "v4__strictansi"
+    13 Sym_0 external "v4__type"
+   308 Sym_61 external "v4_abs"
+  1018 Sym_170 variable Char[80] "v4_abuf"
+  1022 Sym_172 external "v4_accept"
+  1020 Sym_171 word "v4_accept_Minustest"
+   614 Sym_97 external "v4_align"
+   617 Sym_99 external "v4_aligned"
+    21 Sym_7 external "v4_and"
+   857 Sym_145 external "v4_base"
+   630 Sym_101 external "v4_bl"
+   601 Sym_90 external "v4_c_Comma"
+   608 Sym_95 external "v4_c_Fetch"
+   609 Sym_96 external "v4_c_Store"
+   590 Sym_85 external "v4_cell_Plus"
+   591 Sym_86 external "v4_cells"
+   606 Sym_93 external "v4_char_Plus"
+   607 Sym_94 external "v4_chars"
+   852 Sym_142 word "v4_count_Minusbits"
+    13 Sym_2 external "v4_cr"
+   954 Sym_157 external "v4_decimal"
+   249 Sym_47 external "v4_depth"
+   252 Sym_48 external "v4_drop"
+    54 Sym_16 external "v4_dup"
+  1001 Sym_166 external "v4_emit"
+   177 Sym_38 external "v4_execute"
+   962 Sym_158 variable Char[3] "v4_fbuf"
+   967 Sym_161 external "v4_fill"
+    53 Sym_15 word "v4_find_Minusmsb"
+   373 Sym_66 external "v4_fm_Slashmod"
+   633 Sym_102 word "v4_gc1"
+   634 Sym_103 word "v4_gc2"
+   637 Sym_104 word "v4_gc3"
+   639 Sym_108 word "v4_gc4"
+   711 Sym_121 word "v4_gd1"
+   716 Sym_123 word "v4_gd2"
+   721 Sym_124 word "v4_gd3"
+   726 Sym_126 word "v4_gd4"
+   731 Sym_127 word "v4_gd5"
+   736 Sym_128 word "v4_gd6"
+   674 Sym_115 word "v4_gi1"
+   675 Sym_116 word "v4_gi2"
+   683 Sym_117 word "v4_gi3"
+   689 Sym_118 word "v4_gi4"
+   694 Sym_119 word "v4_gi5"
+   701 Sym_120 word "v4_gi6"
+   941 Sym_154 word "v4_gn1"
+   953 Sym_155 word "v4_gn2"
+   918 Sym_148 variable Char[10] "v4_gn_Minusbuf"
+   920 Sym_150 word "v4_gn_Minusconsumed"
+   919 Sym_149 word "v4_gn_Minusstring"
+   922 Sym_151 word "v4_gn_Tick"
+   839 Sym_131 word "v4_gp1"
+   842 Sym_135 word "v4_gp2"
+   845 Sym_137 word "v4_gp3"
+   848 Sym_139 word "v4_gp4"
+   856 Sym_144 word "v4_gp5"
+   865 Sym_146 word "v4_gp6"
+   900 Sym_147 word "v4_gp7"
+   262 Sym_52 word "v4_gr1"
+   263 Sym_55 word "v4_gr2"
+   646 Sym_109 word "v4_gt1"
+   648 Sym_110 word "v4_gt2"
+   666 Sym_112 word "v4_gt8"
+   668 Sym_114 word "v4_gt9"
+   583 Sym_79 variable Char[256] "v4_hbuf"
+   585 Sym_81 external "v4_here"
+   954 Sym_156 external "v4_hex"
+   839 Sym_133 external "v4_hold"
+   711 Sym_122 external "v4_i"
+   648 Sym_111 external "v4_immediate"
+    26 Sym_10 external "v4_invert"
+   721 Sym_125 external "v4_j"
+   637 Sym_107 external "v4_literal"
+    70 Sym_20 external "v4_lshift"
+   324 Sym_63 external "v4_m_Star"
+   201 Sym_40 external "v4_max"
+   851 Sym_141 constant "v4_max_Minusbase"
+    88 Sym_23 constant "v4_max_Minusint"
+    87 Sym_22 constant "v4_max_Minusuint"
+    90 Sym_25 constant "v4_mid_Minusuint"
+    91 Sym_26 constant "v4_mid_Minusuint_Plus1"
+   184 Sym_39 external "v4_min"
+    89 Sym_24 constant "v4_min_Minusint"
+   509 Sym_76 external "v4_mod"
+   976 Sym_162 external "v4_move"
+    55 Sym_18 constant "v4_msb"
+   302 Sym_60 external "v4_negate"
+    40 Sym_13 external "v4_or"
+   997 Sym_163 word "v4_output_Minustest"
+   255 Sym_49 external "v4_over"
+   263 Sym_56 external "v4_r_Fetch"
+   262 Sym_54 external "v4_r_Greater"
+   256 Sym_50 external "v4_rot"
+    77 Sym_21 external "v4_rshift"
+   826 Sym_130 word "v4_s_Equals"
+   316 Sym_62 external "v4_s_Greaterd"
+   963 Sym_159 variable Char[3] "v4_sbuf"
+   965 Sym_160 word "v4_seebuf"
+   842 Sym_136 external "v4_sign"
+   408 Sym_67 external "v4_sm_Slashrem"
+  1003 Sym_167 external "v4_space"
+  1001 Sym_165 external "v4_spaces"
+   666 Sym_113 external "v4_state"
+   257 Sym_51 external "v4_swap"
+   460 Sym_70 word "v4_t_Slash"
+   459 Sym_69 word "v4_t_Slashmod"
+   463 Sym_73 word "v4_t_Star_Slash"
+   462 Sym_72 word "v4_t_Star_Slashmod"
+  1037 Sym_173 external "v4_test_Minusstatus"
+   461 Sym_71 word "v4_tmod"
+    16 Sym_3 external "v4_true"
+  1007 Sym_168 external "v4_type"
+  1010 Sym_169 external "v4_u_Dot"
+   165 Sym_35 external "v4_u_Greater"
+   173 Sym_37 external "v4_u_Greater_Equals"
+   153 Sym_34 external "v4_u_Less"
+   169 Sym_36 external "v4_u_Less_Equals"
+   439 Sym_68 external "v4_um_Slashmod"
+   357 Sym_65 external "v4_um_Star"
+   738 Sym_129 external "v4_unloop"
+   615 Sym_98 constant "v4_x"
+    45 Sym_14 external "v4_xor"
+    97 Sym_29 external "v4_z0_Equals"
+   113 Sym_31 external "v4_z0_Less"
+    29 Sym_11 constant "v4_z0s"
+   297 Sym_59 external "v4_z1_Minus"
+   236 Sym_41 external "v4_z1_Plus"
+    30 Sym_12 constant "v4_z1s"
+   588 Sym_84 constant "v4_z1st"
+   604 Sym_92 constant "v4_z1stc"
+   597 Sym_88 external "v4_z2_Fetch"
+    63 Sym_19 external "v4_z2_Slash"
+    54 Sym_17 external "v4_z2_Star"
+   598 Sym_89 external "v4_z2_Store"
+   242 Sym_42 external "v4_z2drop"
+   243 Sym_43 external "v4_z2dup"
+   587 Sym_83 constant "v4_z2nd"
+   603 Sym_91 constant "v4_z2ndc"
+   244 Sym_44 external "v4_z2over"
+   245 Sym_45 external "v4_z2swap"
+
+Intermediate code:
+    53 function Sym_15 {
+    54   Reg_0 = 1
+    54   Stack_D = Reg_0
+    54 label Label_2
+    54   call Sym_16
+    54   no-op
+           optimizes   call Sym_17
+    54   Reg_0 = Stack_D
+    54   Reg_0 += Reg_0
+    54   no-op
+           optimizes   Stack_D = Reg_0
+    54   no-op
+           optimizes   Reg_0 = Stack_D
+    54   if Reg_0 == 0 goto Label_3
+    54   no-op
+           optimizes   call Sym_17
+    54   Reg_0 = Stack_D
+    54   Reg_0 += Reg_0
+    54   Stack_D = Reg_0
+    54   goto Label_2
+    54 label Label_3
+    54   no-op
+           optimizes label Label_1
+    54 }
+
+   262 function Sym_52 {
+   262   no-op
+           optimizes   call Sym_53
+   262   Reg_0 = Stack_D
+   262   Frame_0 = Reg_0
+   262   no-op
+           optimizes   call Sym_54
+   262   Reg_0 = Frame_0
+   262   Stack_D = Reg_0
+   262   no-op
+           optimizes label Label_4
+   262 }
+
+   263 function Sym_55 {
+   263   no-op
+           optimizes   call Sym_53
+   263   Reg_0 = Stack_D
+   263   Frame_0 = Reg_0
+   263   no-op
+           optimizes   call Sym_56
+   263   Reg_0 = Frame_0
+   263   Stack_D = Reg_0
+   263   no-op
+           optimizes   call Sym_54
+   263   Reg_0 = Frame_0
+   263   Stack_D = Reg_0
+   263   tail call Sym_48
+           optimizes   call Sym_48
+   263   no-op
+           optimizes label Label_5
+   263 }
+
+   459 function Sym_69 {
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   tail call Sym_67
+           optimizes   call Sym_67
+   459   no-op
+           optimizes label Label_6
+   459 }
+
+   460 function Sym_70 {
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   tail call Sym_48
+           optimizes   call Sym_48
+   460   no-op
+           optimizes label Label_7
+   460 }
+
+   461 function Sym_71 {
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   tail call Sym_48
+           optimizes   call Sym_48
+   461   no-op
+           optimizes label Label_8
+   461 }
+
+   462 function Sym_72 {
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   tail call Sym_67
+           optimizes   call Sym_67
+   462   no-op
+           optimizes label Label_9
+   462 }
+
+   463 function Sym_73 {
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   tail call Sym_48
+           optimizes   call Sym_48
+   463   no-op
+           optimizes label Label_10
+   463 }
+
+   633 function Sym_102 {
+   633   Reg_0 = 88
+   633   Stack_D = Reg_0
+   633   no-op
+           optimizes label Label_11
+   633 }
+
+   634 function Sym_103 {
+   634   Reg_0 = 72
+   634   Stack_D = Reg_0
+   634   no-op
+           optimizes label Label_12
+   634 }
+
+   637 function Sym_104 {
+   637   call Sym_105
+   637   no-op
+           optimizes   call Sym_102
+   633   Reg_0 = 88
+   633   Stack_D = Reg_0
+   637   call Sym_106
+   637   tail call Sym_107
+           optimizes   call Sym_107
+   637   no-op
+           optimizes label Label_13
+   637 }
+
+   639 function Sym_108 {
+   639   Reg_0 = Data_12
+   639   Stack_D = Reg_0
+   639   Reg_0 = 2
+   639   Stack_D = Reg_0
+   639   no-op
+           optimizes label Label_14
+   639 }
+
+   646 function Sym_109 {
+   646   Reg_0 = 123
+   646   Stack_D = Reg_0
+   646   no-op
+           optimizes label Label_15
+   646 }
+
+   648 function Sym_110 {
+   648   Reg_0 = Sym_109
+   648   Stack_D = Reg_0
+   648   no-op
+           optimizes label Label_16
+   648 }
+
+   666 function Sym_112 {
+   666   call Sym_113
+   666   tail call Sym_87
+           optimizes   call Sym_87
+   666   no-op
+           optimizes label Label_17
+   666 }
+
+   668 function Sym_114 {
+   668   Reg_0 = Sym_112
+   668   Stack_D = Reg_0
+   668   tail call Sym_107
+           optimizes   call Sym_107
+   668   no-op
+           optimizes label Label_18
+   668 }
+
+   674 function Sym_115 {
+   674   Reg_0 = Stack_D
+   674   if Reg_0 == 0 goto Label_20
+   674   Reg_0 = 123
+   674   Stack_D = Reg_0
+   674 label Label_20
+   674   no-op
+           optimizes label Label_19
+   674 }
+
+   675 function Sym_116 {
+   675   Reg_0 = Stack_D
+   675   if Reg_0 == 0 goto Label_22
+   675   Reg_0 = 123
+   675   Stack_D = Reg_0
+   675   goto Label_23
+   675 label Label_22
+   675   Reg_0 = 234
+   675   Stack_D = Reg_0
+   675 label Label_23
+   675   no-op
+           optimizes label Label_21
+   675 }
+
+   683 function Sym_117 {
+   683 label Label_25
+   683   call Sym_16
+   683   Reg_0 = 5
+   683   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   683   no-op
+           optimizes   call Sym_32
+   683   no-op
+           optimizes   Reg_1 = Stack_D
+   683   Reg_0 = Stack_D
+   683   if Reg_0 >= Reg_1 goto Label_26
+   683   no-op
+           optimizes   Reg_0 = Stack_D
+   683   no-op
+           optimizes   if Reg_0 == 0 goto Label_26
+   683   call Sym_16
+   683   no-op
+           optimizes   call Sym_41
+   683   Reg_0 = Stack_D
+   683   Reg_0 += 1
+   683   Stack_D = Reg_0
+   683   goto Label_25
+   683 label Label_26
+   683   no-op
+           optimizes label Label_24
+   683 }
+
+   689 function Sym_118 {
+   689 label Label_28
+   689   call Sym_16
+   689   no-op
+           optimizes   call Sym_41
+   689   Reg_0 = Stack_D
+   689   Reg_0 += 1
+   689   Stack_D = Reg_0
+   689   call Sym_16
+   689   Reg_0 = 5
+   689   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   689   no-op
+           optimizes   call Sym_33
+   689   no-op
+           optimizes   Reg_1 = Stack_D
+   689   Reg_0 = Stack_D
+   689   if Reg_0 <= Reg_1 goto Label_28
+   689   no-op
+           optimizes   Reg_0 = Stack_D
+   689   no-op
+           optimizes   if Reg_0 == 0 goto Label_28
+   689   no-op
+           optimizes label Label_29
+   689   no-op
+           optimizes label Label_27
+   689 }
+
+   694 function Sym_119 {
+   694 label Label_31
+   694   call Sym_16
+   694   Reg_0 = 2
+   694   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   694   no-op
+           optimizes   call Sym_33
+   694   no-op
+           optimizes   Reg_1 = Stack_D
+   694   Reg_0 = Stack_D
+   694   if Reg_0 <= Reg_1 goto Label_32
+   694   no-op
+           optimizes   Reg_0 = Stack_D
+   694   no-op
+           optimizes   if Reg_0 == 0 goto Label_32
+   694   call Sym_16
+   694   Reg_0 = 5
+   694   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   694   no-op
+           optimizes   call Sym_32
+   694   no-op
+           optimizes   Reg_1 = Stack_D
+   694   Reg_0 = Stack_D
+   694   if Reg_0 >= Reg_1 goto Label_32
+   694   no-op
+           optimizes   Reg_0 = Stack_D
+   694   no-op
+           optimizes   if Reg_0 == 0 goto Label_32
+   694   call Sym_16
+   694   no-op
+           optimizes   call Sym_41
+   694   Reg_0 = Stack_D
+   694   Reg_0 += 1
+   694   Stack_D = Reg_0
+   694   goto Label_31
+   694 label Label_32
+   694   no-op
+           optimizes label Label_30
+   694 }
+
+   701 function Sym_120 {
+   701   call Sym_16
+   701   Reg_0 = Stack_D
+   701   if Reg_0 == 0 goto Label_34
+   701   call Sym_16
+   701   call Sym_53
+   701   no-op
+           optimizes   call Sym_59
+   701   Reg_0 = Stack_D
+   701   Reg_0 -= 1
+   701   Stack_D = Reg_0
+   701   call Sym_120
+   701   tail call Sym_54
+           optimizes   call Sym_54
+   701 label Label_34
+   701   no-op
+           optimizes label Label_33
+   701 }
+
+   711 function Sym_121 {
+   711   Reg_1 = Stack_D
+   711   Reg_0 = Stack_D
+   711   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+   711   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   711 label Label_37
+   711   no-op
+           optimizes   call Sym_122
+   711   Reg_0 = Frame_1
+   711   Stack_D = Reg_0
+   711   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+   711   Reg_1 += 1
+   711   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   711   no-op
+           optimizes   Frame_0 = Reg_0
+   711   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   711   Reg_1 -= Reg_0
+   711   if Reg_1 != 0 goto Label_37
+   711   no-op
+           optimizes label Label_38
+   711   no-op
+           optimizes   Reg_0 = Frame_1
+   711   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   711   no-op
+           optimizes label Label_36
+   711   no-op
+           optimizes label Label_35
+   711 }
+
+   716 function Sym_123 {
+   716   Reg_1 = Stack_D
+   716   Reg_0 = Stack_D
+   716   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+   716   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   716 label Label_41
+   716   no-op
+           optimizes   call Sym_122
+   716   Reg_0 = Frame_1
+   716   Stack_D = Reg_0
+   716   Reg_0 = -1
+   716   no-op
+           optimizes   Stack_D = Reg_0
+   716   no-op
+           optimizes   Reg_0 = Stack_D
+   716   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+   716   Reg_1 += Reg_0
+   716   if Reg_0 < 0 goto Label_43
+   716   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   716   no-op
+           optimizes   Frame_0 = Reg_0
+   716   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   716   Reg_1 -= Reg_0
+   716   if Reg_1 < 0 goto Label_41
+   716   goto Label_42
+   716 label Label_43
+   716   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   716   no-op
+           optimizes   Frame_0 = Reg_0
+   716   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   716   Reg_1 -= Reg_0
+   716   if Reg_1 >= 0 goto Label_41
+   716 label Label_42
+   716   no-op
+           optimizes   Reg_0 = Frame_1
+   716   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   716   no-op
+           optimizes label Label_40
+   716   no-op
+           optimizes label Label_39
+   716 }
+
+   721 function Sym_124 {
+   721   Reg_1 = Stack_D
+   721   Reg_0 = Stack_D
+   721   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+   721   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   721 label Label_46
+   721   Reg_0 = 1
+   721   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   721   Reg_0 = 0
+   721   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   721   no-op
+           optimizes   Reg_1 = Stack_D
+   721   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   721   Frame_2 = Reg_0
+           optimizes   Stack_R = Reg_0
+   721   Frame_3 = Reg_1
+           optimizes   Stack_R = Reg_1
+   721 label Label_49
+   721   no-op
+           optimizes   call Sym_125
+   721   Reg_0 = Frame_1
+   721   Stack_D = Reg_0
+   721   Reg_1 = Frame_3
+           optimizes   Reg_1 = Stack_R
+   721   Reg_1 += 1
+   721   Reg_0 = Frame_2
+           optimizes   Reg_0 = Stack_R
+   721   no-op
+           optimizes   Frame_2 = Reg_0
+   721   Frame_3 = Reg_1
+           optimizes   Stack_R = Reg_1
+   721   Reg_1 -= Reg_0
+   721   if Reg_1 != 0 goto Label_49
+   721   no-op
+           optimizes label Label_50
+   721   no-op
+           optimizes   Reg_0 = Frame_3
+   721   Reg_0 = Frame_2
+           optimizes   Reg_0 = Stack_R
+   721   no-op
+           optimizes label Label_48
+   721   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+   721   Reg_1 += 1
+   721   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   721   no-op
+           optimizes   Frame_0 = Reg_0
+   721   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   721   Reg_1 -= Reg_0
+   721   if Reg_1 != 0 goto Label_46
+   721   no-op
+           optimizes label Label_47
+   721   no-op
+           optimizes   Reg_0 = Frame_1
+   721   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   721   no-op
+           optimizes label Label_45
+   721   no-op
+           optimizes label Label_44
+   721 }
+
+   726 function Sym_126 {
+   726   Reg_1 = Stack_D
+   726   Reg_0 = Stack_D
+   726   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+   726   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   726 label Label_53
+   726   Reg_0 = 1
+   726   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   726   Reg_0 = 0
+   726   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   726   no-op
+           optimizes   Reg_1 = Stack_D
+   726   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   726   Frame_2 = Reg_0
+           optimizes   Stack_R = Reg_0
+   726   Frame_3 = Reg_1
+           optimizes   Stack_R = Reg_1
+   726 label Label_56
+   726   no-op
+           optimizes   call Sym_125
+   726   Reg_0 = Frame_1
+   726   Stack_D = Reg_0
+   726   Reg_1 = Frame_3
+           optimizes   Reg_1 = Stack_R
+   726   Reg_1 += 1
+   726   Reg_0 = Frame_2
+           optimizes   Reg_0 = Stack_R
+   726   no-op
+           optimizes   Frame_2 = Reg_0
+   726   Frame_3 = Reg_1
+           optimizes   Stack_R = Reg_1
+   726   Reg_1 -= Reg_0
+   726   if Reg_1 != 0 goto Label_56
+   726   no-op
+           optimizes label Label_57
+   726   no-op
+           optimizes   Reg_0 = Frame_3
+   726   Reg_0 = Frame_2
+           optimizes   Reg_0 = Stack_R
+   726   no-op
+           optimizes label Label_55
+   726   Reg_0 = -1
+   726   no-op
+           optimizes   Stack_D = Reg_0
+   726   no-op
+           optimizes   Reg_0 = Stack_D
+   726   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+   726   Reg_1 += Reg_0
+   726   if Reg_0 < 0 goto Label_58
+   726   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   726   no-op
+           optimizes   Frame_0 = Reg_0
+   726   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   726   Reg_1 -= Reg_0
+   726   if Reg_1 < 0 goto Label_53
+   726   goto Label_54
+   726 label Label_58
+   726   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   726   no-op
+           optimizes   Frame_0 = Reg_0
+   726   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   726   Reg_1 -= Reg_0
+   726   if Reg_1 >= 0 goto Label_53
+   726 label Label_54
+   726   no-op
+           optimizes   Reg_0 = Frame_1
+   726   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   726   no-op
+           optimizes label Label_52
+   726   no-op
+           optimizes label Label_51
+   726 }
+
+   731 function Sym_127 {
+   731   Reg_0 = 123
+   731   Stack_D = Reg_0
+   731   call Sym_51
+   731   Reg_0 = 0
+   731   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   731   no-op
+           optimizes   Reg_1 = Stack_D
+   731   Reg_0 = Stack_D
+   731   Stack_R = Reg_0
+   731   Stack_R = Reg_1
+   731 label Label_61
+   731   call Sym_122
+   731   Reg_0 = 4
+   731   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   731   no-op
+           optimizes   call Sym_33
+   731   no-op
+           optimizes   Reg_1 = Stack_D
+   731   Reg_0 = Stack_D
+   731   if Reg_0 <= Reg_1 goto Label_63
+   731   no-op
+           optimizes   Reg_0 = Stack_D
+   731   no-op
+           optimizes   if Reg_0 == 0 goto Label_63
+   731   call Sym_48
+   731   Reg_0 = 234
+   731   Stack_D = Reg_0
+   731   goto Label_62
+   731 label Label_63
+   731   Reg_1 = Stack_R
+   731   Reg_1 += 1
+   731   Reg_0 = Stack_R
+   731   Stack_R = Reg_0
+   731   Stack_R = Reg_1
+   731   Reg_1 -= Reg_0
+   731   if Reg_1 != 0 goto Label_61
+   731 label Label_62
+   731   Reg_0 = Stack_R
+   731   Reg_0 = Stack_R
+   731   no-op
+           optimizes label Label_60
+   731   no-op
+           optimizes label Label_59
+   731 }
+
+   736 function Sym_128 {
+   737   Reg_0 = 0
+   737   Stack_D = Reg_0
+   737   call Sym_51
+   737   Reg_0 = 0
+   737   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   737   no-op
+           optimizes   Reg_1 = Stack_D
+   737   Reg_0 = Stack_D
+   737   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+   737   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   737 label Label_66
+   738   no-op
+           optimizes   call Sym_122
+   738   Reg_0 = Frame_1
+   738   no-op
+           optimizes   Stack_D = Reg_0
+   738   no-op
+           optimizes   call Sym_41
+   738   no-op
+           optimizes   Reg_0 = Stack_D
+   738   Reg_0 += 1
+   738   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   738   Reg_0 = 0
+   738   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   738   no-op
+           optimizes   Reg_1 = Stack_D
+   738   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   738   Frame_2 = Reg_0
+           optimizes   Stack_R = Reg_0
+   738   Frame_3 = Reg_1
+           optimizes   Stack_R = Reg_1
+   738 label Label_69
+   738   no-op
+           optimizes   call Sym_122
+   738   Reg_0 = Frame_3
+   738   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   738   no-op
+           optimizes   call Sym_125
+   738   Reg_0 = Frame_1
+   738   no-op
+           optimizes   Stack_D = Reg_0
+   738   no-op
+           optimizes   call Sym_57
+   738   Reg_1 = Reg_0
+           optimizes   Reg_1 = Stack_D
+   738   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   738   Reg_0 += Reg_1
+   738   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   738   Reg_0 = 3
+   738   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   738   no-op
+           optimizes   call Sym_30
+   738   no-op
+           optimizes   Reg_1 = Stack_D
+   738   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   738   if Reg_0 != Reg_1 goto Label_71
+   738   no-op
+           optimizes   Reg_0 = Stack_D
+   738   no-op
+           optimizes   if Reg_0 == 0 goto Label_71
+   738   no-op
+           optimizes   call Sym_122
+   738   Reg_0 = Frame_3
+   738   Stack_D = Reg_0
+   738   no-op
+           optimizes   call Sym_129
+   738   no-op
+           optimizes   call Sym_122
+   738   Reg_0 = Frame_1
+   738   Stack_D = Reg_0
+   738   no-op
+           optimizes   call Sym_129
+   738   goto Label_64
+   738 label Label_71
+   738   no-op
+           optimizes   call Sym_41
+   738   Reg_0 = Stack_D
+   738   Reg_0 += 1
+   738   Stack_D = Reg_0
+   738   Reg_1 = Frame_3
+           optimizes   Reg_1 = Stack_R
+   738   Reg_1 += 1
+   738   Reg_0 = Frame_2
+           optimizes   Reg_0 = Stack_R
+   738   no-op
+           optimizes   Frame_2 = Reg_0
+   738   Frame_3 = Reg_1
+           optimizes   Stack_R = Reg_1
+   738   Reg_1 -= Reg_0
+   738   if Reg_1 != 0 goto Label_69
+   738   no-op
+           optimizes label Label_70
+   738   no-op
+           optimizes   Reg_0 = Frame_3
+   738   Reg_0 = Frame_2
+           optimizes   Reg_0 = Stack_R
+   738   no-op
+           optimizes label Label_68
+   739   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+   739   Reg_1 += 1
+   739   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   739   no-op
+           optimizes   Frame_0 = Reg_0
+   739   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   739   Reg_1 -= Reg_0
+   739   if Reg_1 != 0 goto Label_66
+   739   no-op
+           optimizes label Label_67
+   739   no-op
+           optimizes   Reg_0 = Frame_1
+   739   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   739   no-op
+           optimizes label Label_65
+   739 label Label_64
+   739 }
+
+   826 function Sym_130 {
+   827   call Sym_53
+   827   call Sym_51
+   827   call Sym_56
+   827   no-op
+           optimizes   call Sym_30
+   827   Reg_1 = Stack_D
+   827   Reg_0 = Stack_D
+   827   if Reg_0 != Reg_1 goto Label_73
+   827   no-op
+           optimizes   Reg_0 = Stack_D
+   827   no-op
+           optimizes   if Reg_0 == 0 goto Label_73
+   828   call Sym_54
+   828   call Sym_46
+   828   Reg_0 = Stack_D
+   828   if Reg_0 == 0 goto Label_74
+   829   Reg_0 = 0
+   829   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   829   no-op
+           optimizes   Reg_1 = Stack_D
+   829   Reg_0 = Stack_D
+   829   Stack_R = Reg_0
+   829   Stack_R = Reg_1
+   829 label Label_76
+   830   call Sym_49
+   830   call Sym_95
+   830   call Sym_49
+   830   call Sym_95
+   830   no-op
+           optimizes   call Sym_58
+   830   Reg_1 = Stack_D
+   830   Reg_0 = Stack_D
+   830   Reg_0 -= Reg_1
+   830   no-op
+           optimizes   Stack_D = Reg_0
+   830   no-op
+           optimizes   Reg_0 = Stack_D
+   830   if Reg_0 == 0 goto Label_78
+   830   call Sym_42
+   830   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   830   Stack_D = Reg_0
+   830   tail call Sym_129
+           optimizes   call Sym_129
+   830   no-op
+           optimizes   goto Label_72
+   830 label Label_78
+   831   call Sym_51
+   831   call Sym_93
+   831   call Sym_51
+   831   call Sym_93
+   832   Reg_1 = Stack_R
+   832   Reg_1 += 1
+   832   Reg_0 = Stack_R
+   832   Stack_R = Reg_0
+   832   Stack_R = Reg_1
+   832   Reg_1 -= Reg_0
+   832   if Reg_1 != 0 goto Label_76
+   832   no-op
+           optimizes label Label_77
+   832   Reg_0 = Stack_R
+   832   Reg_0 = Stack_R
+   832   no-op
+           optimizes label Label_75
+   833 label Label_74
+   834   call Sym_42
+   834   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   834   Stack_D = Reg_0
+   835   goto Label_79
+   835 label Label_73
+   836   call Sym_54
+   836   call Sym_48
+   836   call Sym_42
+   836   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   836   Stack_D = Reg_0
+   837 label Label_79
+   837 label Label_72
+   837 }
+
+   839 function Sym_131 {
+   839   call Sym_132
+   839   Reg_0 = 65
+   839   Stack_D = Reg_0
+   839   call Sym_133
+   839   Reg_0 = 66
+   839   Stack_D = Reg_0
+   839   call Sym_133
+   839   Reg_0 = 0
+   839   Stack_D = Reg_0
+   839   Reg_0 = 0
+   839   Stack_D = Reg_0
+   839   call Sym_134
+   839   Reg_0 = Data_17
+   839   Stack_D = Reg_0
+   839   Reg_0 = 2
+   839   Stack_D = Reg_0
+   839   tail call Sym_130
+           optimizes   call Sym_130
+   839   no-op
+           optimizes label Label_80
+   839 }
+
+   842 function Sym_135 {
+   842   call Sym_132
+   842   Reg_0 = -1
+   842   Stack_D = Reg_0
+   842   call Sym_136
+   842   Reg_0 = 0
+   842   Stack_D = Reg_0
+   842   call Sym_136
+   842   Reg_0 = -1
+   842   Stack_D = Reg_0
+   842   call Sym_136
+   842   Reg_0 = 0
+   842   Stack_D = Reg_0
+   842   Reg_0 = 0
+   842   Stack_D = Reg_0
+   842   call Sym_134
+   842   Reg_0 = Data_18
+   842   Stack_D = Reg_0
+   842   Reg_0 = 2
+   842   Stack_D = Reg_0
+   842   tail call Sym_130
+           optimizes   call Sym_130
+   842   no-op
+           optimizes label Label_81
+   842 }
+
+   845 function Sym_137 {
+   845   call Sym_132
+   845   Reg_0 = 1
+   845   Stack_D = Reg_0
+   845   Reg_0 = 0
+   845   Stack_D = Reg_0
+   845   call Sym_138
+   845   call Sym_138
+   845   call Sym_134
+   845   Reg_0 = Data_19
+   845   Stack_D = Reg_0
+   845   Reg_0 = 2
+   845   Stack_D = Reg_0
+   845   tail call Sym_130
+           optimizes   call Sym_130
+   845   no-op
+           optimizes label Label_82
+   845 }
+
+   848 function Sym_139 {
+   848   call Sym_132
+   848   Reg_0 = 1
+   848   Stack_D = Reg_0
+   848   Reg_0 = 0
+   848   Stack_D = Reg_0
+   848   call Sym_140
+   848   call Sym_134
+   848   Reg_0 = Data_20
+   848   Stack_D = Reg_0
+   848   Reg_0 = 1
+   848   Stack_D = Reg_0
+   848   tail call Sym_130
+           optimizes   call Sym_130
+   848   no-op
+           optimizes label Label_83
+   848 }
+
+   852 function Sym_142 {
+   853   Reg_0 = 0
+   853   Stack_D = Reg_0
+   853   Reg_0 = -1
+           optimizes   Reg_0 = 0
+   853   Stack_D = Reg_0
+   853   no-op
+           optimizes   call Sym_10
+   853 label Label_85
+   853   call Sym_16
+   853   Reg_0 = Stack_D
+   853   if Reg_0 == 0 goto Label_86
+   853   no-op
+           optimizes   call Sym_53
+   853   Reg_0 = Stack_D
+   853   Frame_0 = Reg_0
+   853   no-op
+           optimizes   call Sym_41
+   853   Reg_0 = Stack_D
+   853   Reg_0 += 1
+   853   Stack_D = Reg_0
+   853   no-op
+           optimizes   call Sym_54
+   853   Reg_0 = Frame_0
+   853   no-op
+           optimizes   Stack_D = Reg_0
+   853   no-op
+           optimizes   call Sym_17
+   853   no-op
+           optimizes   Reg_0 = Stack_D
+   853   Reg_0 += Reg_0
+   853   Stack_D = Reg_0
+   853   goto Label_85
+   853 label Label_86
+   853   tail call Sym_48
+           optimizes   call Sym_48
+   853   no-op
+           optimizes label Label_84
+   853 }
+
+   856 function Sym_144 {
+   857   call Sym_145
+   857   call Sym_87
+   857   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   857   Stack_D = Reg_0
+   858   Reg_0 = 37
+           optimizes   Reg_0 = 36
+   858   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   858   no-op
+           optimizes   call Sym_41
+   858   Reg_0 = 2
+   858   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   858   no-op
+           optimizes   Reg_1 = Stack_D
+   858   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   858   Stack_R = Reg_0
+   858   Stack_R = Reg_1
+   858 label Label_89
+   859   call Sym_122
+   859   call Sym_145
+   859   call Sym_5
+   860   call Sym_122
+   860   Reg_0 = 0
+   860   Stack_D = Reg_0
+   860   call Sym_132
+   860   call Sym_140
+   860   call Sym_134
+   860   Reg_0 = Data_21
+   860   Stack_D = Reg_0
+   860   Reg_0 = 2
+   860   Stack_D = Reg_0
+   860   call Sym_130
+   860   no-op
+           optimizes   call Sym_7
+   860   Reg_1 = Stack_D
+   860   Reg_0 = Stack_D
+   860   Reg_0 &= Reg_1
+   860   Stack_D = Reg_0
+   861   Reg_1 = Stack_R
+   861   Reg_1 += 1
+   861   Reg_0 = Stack_R
+   861   Stack_R = Reg_0
+   861   Stack_R = Reg_1
+   861   Reg_1 -= Reg_0
+   861   if Reg_1 != 0 goto Label_89
+   861   no-op
+           optimizes label Label_90
+   861   Reg_0 = Stack_R
+   861   Reg_0 = Stack_R
+   861   no-op
+           optimizes label Label_88
+   862   call Sym_51
+   862   call Sym_145
+   862   tail call Sym_5
+           optimizes   call Sym_5
+   862   no-op
+           optimizes label Label_87
+   862 }
+
+   865 function Sym_146 {
+   866   call Sym_145
+   866   call Sym_87
+   866   call Sym_53
+   866   Reg_0 = 2
+   866   Stack_D = Reg_0
+   866   call Sym_145
+   866   call Sym_5
+   868   call Sym_132
+   868   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   868   Stack_D = Reg_0
+   868   Reg_0 = 0
+   868   Stack_D = Reg_0
+   868   call Sym_140
+   868   call Sym_42
+   869   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   869   Stack_D = Reg_0
+   869   Reg_0 = 0
+   869   Stack_D = Reg_0
+   869   call Sym_140
+   869   call Sym_134
+   870   call Sym_54
+   870   call Sym_145
+   870   call Sym_5
+   871   call Sym_16
+   871   Reg_0 = *(Sym_143)
+   871   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   871   no-op
+           optimizes   call Sym_30
+   871   no-op
+           optimizes   Reg_1 = Stack_D
+   871   Reg_0 = Stack_D
+   871   Reg_0 = Reg_0 == Reg_1
+   871   Stack_D = Reg_0
+   871   call Sym_51
+   872   Reg_0 = 0
+   872   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   872   no-op
+           optimizes   Reg_1 = Stack_D
+   872   Reg_0 = Stack_D
+   872   Stack_R = Reg_0
+   872   Stack_R = Reg_1
+   872 label Label_93
+   873   call Sym_49
+   873   call Sym_95
+   873   Reg_0 = 49
+   873   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   873   no-op
+           optimizes   call Sym_30
+   873   no-op
+           optimizes   Reg_1 = Stack_D
+   873   Reg_0 = Stack_D
+   873   Reg_0 = Reg_0 == Reg_1
+   873   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   873   no-op
+           optimizes   call Sym_7
+   873   no-op
+           optimizes   Reg_1 = Stack_D
+   873   Reg_0 = Stack_D
+   873   Reg_0 &= Reg_1
+   873   Stack_D = Reg_0
+   874   call Sym_53
+   874   call Sym_93
+   874   call Sym_54
+   875   Reg_1 = Stack_R
+   875   Reg_1 += 1
+   875   Reg_0 = Stack_R
+   875   Stack_R = Reg_0
+   875   Stack_R = Reg_1
+   875   Reg_1 -= Reg_0
+   875   if Reg_1 != 0 goto Label_93
+   875   no-op
+           optimizes label Label_94
+   875   Reg_0 = Stack_R
+   875   Reg_0 = Stack_R
+   875   no-op
+           optimizes label Label_92
+   875   call Sym_51
+   875   tail call Sym_48
+           optimizes   call Sym_48
+   875   no-op
+           optimizes label Label_91
+   875 }
+
+   900 function Sym_147 {
+   901   call Sym_145
+   901   call Sym_87
+   901   call Sym_53
+   901   Reg_0 = 36
+           optimizes   Reg_0 = *(Sym_141)
+   901   Stack_D = Reg_0
+   901   call Sym_145
+   901   call Sym_5
+   902   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   902   Stack_D = Reg_0
+   903   Reg_0 = 10
+   903   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   903   Reg_0 = 0
+   903   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   903   no-op
+           optimizes   Reg_1 = Stack_D
+   903   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   903   Stack_R = Reg_0
+   903   Stack_R = Reg_1
+   903 label Label_97
+   904   call Sym_122
+   904   Reg_0 = 0
+   904   Stack_D = Reg_0
+   904   call Sym_132
+   904   call Sym_140
+   904   call Sym_134
+   905   Reg_0 = 1
+   905   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   905   no-op
+           optimizes   call Sym_30
+   905   no-op
+           optimizes   Reg_1 = Stack_D
+   905   Reg_0 = Stack_D
+   905   Reg_0 = Reg_0 == Reg_1
+   905   Stack_D = Reg_0
+   905   call Sym_51
+   905   call Sym_95
+   905   Reg_0 = 48
+   905   Stack_D = Reg_0
+   905   call Sym_122
+   905   no-op
+           optimizes   call Sym_57
+   905   Reg_1 = Stack_D
+   905   Reg_0 = Stack_D
+   905   Reg_0 += Reg_1
+   905   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   905   no-op
+           optimizes   call Sym_30
+   905   no-op
+           optimizes   Reg_1 = Stack_D
+   905   Reg_0 = Stack_D
+   905   Reg_0 = Reg_0 == Reg_1
+   905   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   905   no-op
+           optimizes   call Sym_7
+   905   no-op
+           optimizes   Reg_1 = Stack_D
+   905   Reg_0 = Stack_D
+   905   Reg_0 &= Reg_1
+   905   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   905   no-op
+           optimizes   call Sym_7
+   905   no-op
+           optimizes   Reg_1 = Stack_D
+   905   Reg_0 = Stack_D
+   905   Reg_0 &= Reg_1
+   905   Stack_D = Reg_0
+   906   Reg_1 = Stack_R
+   906   Reg_1 += 1
+   906   Reg_0 = Stack_R
+   906   Stack_R = Reg_0
+   906   Stack_R = Reg_1
+   906   Reg_1 -= Reg_0
+   906   if Reg_1 != 0 goto Label_97
+   906   no-op
+           optimizes label Label_98
+   906   Reg_0 = Stack_R
+   906   Reg_0 = Stack_R
+   906   no-op
+           optimizes label Label_96
+   907   Reg_0 = 36
+           optimizes   Reg_0 = *(Sym_141)
+   907   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   907   Reg_0 = 10
+   907   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   907   no-op
+           optimizes   Reg_1 = Stack_D
+   907   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   907   Stack_R = Reg_0
+   907   Stack_R = Reg_1
+   907 label Label_100
+   908   call Sym_122
+   908   Reg_0 = 0
+   908   Stack_D = Reg_0
+   908   call Sym_132
+   908   call Sym_140
+   908   call Sym_134
+   909   Reg_0 = 1
+   909   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   909   no-op
+           optimizes   call Sym_30
+   909   no-op
+           optimizes   Reg_1 = Stack_D
+   909   Reg_0 = Stack_D
+   909   Reg_0 = Reg_0 == Reg_1
+   909   Stack_D = Reg_0
+   909   call Sym_51
+   909   call Sym_95
+   909   Reg_0 = 65
+   909   Stack_D = Reg_0
+   909   call Sym_122
+   909   Reg_0 = 10
+   909   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   909   no-op
+           optimizes   call Sym_58
+   909   no-op
+           optimizes   Reg_1 = Stack_D
+   909   Reg_0 = Stack_D
+   909   Reg_0 -= Reg_1
+   909   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   909   no-op
+           optimizes   call Sym_57
+   909   no-op
+           optimizes   Reg_1 = Stack_D
+   909   Reg_0 = Stack_D
+   909   Reg_0 += Reg_1
+   909   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   909   no-op
+           optimizes   call Sym_30
+   909   no-op
+           optimizes   Reg_1 = Stack_D
+   909   Reg_0 = Stack_D
+   909   Reg_0 = Reg_0 == Reg_1
+   909   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   909   no-op
+           optimizes   call Sym_7
+   909   no-op
+           optimizes   Reg_1 = Stack_D
+   909   Reg_0 = Stack_D
+   909   Reg_0 &= Reg_1
+   909   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   909   no-op
+           optimizes   call Sym_7
+   909   no-op
+           optimizes   Reg_1 = Stack_D
+   909   Reg_0 = Stack_D
+   909   Reg_0 &= Reg_1
+   909   Stack_D = Reg_0
+   910   Reg_1 = Stack_R
+   910   Reg_1 += 1
+   910   Reg_0 = Stack_R
+   910   Stack_R = Reg_0
+   910   Stack_R = Reg_1
+   910   Reg_1 -= Reg_0
+   910   if Reg_1 != 0 goto Label_100
+   910   no-op
+           optimizes label Label_101
+   910   Reg_0 = Stack_R
+   910   Reg_0 = Stack_R
+   910   no-op
+           optimizes label Label_99
+   911   call Sym_54
+   911   call Sym_145
+   911   tail call Sym_5
+           optimizes   call Sym_5
+   911   no-op
+           optimizes label Label_95
+   911 }
+
+   919 function Sym_149 {
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   919   no-op
+           optimizes label Label_102
+   919 }
+
+   920 function Sym_150 {
+   920   Reg_0 = Sym_148
+   920   Stack_D = Reg_0
+   920   call Sym_93
+   920   Reg_0 = 0
+   920   Stack_D = Reg_0
+   920   no-op
+           optimizes label Label_103
+   920 }
+
+   922 function Sym_151 {
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   922   no-op
+           optimizes label Label_104
+   922 }
+
+   931 function Sym_153 {
+   932   call Sym_145
+   932   call Sym_87
+   932   call Sym_53
+   932   call Sym_145
+   932   call Sym_5
+   932   call Sym_152
+   932   call Sym_54
+   932   call Sym_145
+   932   tail call Sym_5
+           optimizes   call Sym_5
+   932   no-op
+           optimizes label Label_105
+   932 }
+
+   941 function Sym_154 {
+   942   call Sym_145
+   942   call Sym_87
+   942   call Sym_53
+   942   call Sym_145
+   942   call Sym_5
+   943   call Sym_132
+   943   call Sym_140
+   943   call Sym_134
+   944   Reg_0 = 0
+   944   Stack_D = Reg_0
+   944   Reg_0 = 0
+   944   Stack_D = Reg_0
+   944   call Sym_45
+   944   call Sym_152
+   944   call Sym_51
+   944   call Sym_48
+   945   call Sym_54
+   945   call Sym_145
+   945   tail call Sym_5
+           optimizes   call Sym_5
+   945   no-op
+           optimizes label Label_106
+   945 }
+
+   953 function Sym_155 {
+   954   call Sym_145
+   954   call Sym_87
+   954   call Sym_53
+   954   call Sym_156
+   954   call Sym_145
+   954   call Sym_87
+   954   call Sym_157
+   954   call Sym_145
+   954   call Sym_87
+   954   call Sym_54
+   954   call Sym_145
+   954   tail call Sym_5
+           optimizes   call Sym_5
+   954   no-op
+           optimizes label Label_107
+   954 }
+
+   965 function Sym_160 {
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_93
+   965   tail call Sym_95
+           optimizes   call Sym_95
+   965   no-op
+           optimizes label Label_108
+   965 }
+
+   997 function Sym_163 {
+   998   Reg_0 = Data_24
+   998   Stack_D = Reg_0
+   998   Reg_0 = 40
+   998   Stack_D = Reg_0
+   998   call Sym_0
+   998   call Sym_2
+   999   Reg_0 = 10
+           optimizes   Reg_0 = 9
+   999   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   999   no-op
+           optimizes   call Sym_41
+   999   Reg_0 = 0
+   999   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   999   no-op
+           optimizes   Reg_1 = Stack_D
+   999   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   999   Stack_R = Reg_0
+   999   Stack_R = Reg_1
+   999 label Label_111
+   999   call Sym_122
+   999   call Sym_164
+   999   Reg_1 = Stack_R
+   999   Reg_1 += 1
+   999   Reg_0 = Stack_R
+   999   Stack_R = Reg_0
+   999   Stack_R = Reg_1
+   999   Reg_1 -= Reg_0
+   999   if Reg_1 != 0 goto Label_111
+   999   no-op
+           optimizes label Label_112
+   999   Reg_0 = Stack_R
+   999   Reg_0 = Stack_R
+   999   no-op
+           optimizes label Label_110
+   999   call Sym_2
+  1000   Reg_0 = Data_25
+  1000   Stack_D = Reg_0
+  1000   Reg_0 = 36
+  1000   Stack_D = Reg_0
+  1000   call Sym_0
+  1000   call Sym_2
+  1001   Reg_0 = 58
+           optimizes   Reg_0 = 57
+  1001   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+  1001   no-op
+           optimizes   call Sym_41
+  1001   Reg_0 = 48
+  1001   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+  1001   no-op
+           optimizes   Reg_1 = Stack_D
+  1001   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+  1001   Stack_R = Reg_0
+  1001   Stack_R = Reg_1
+  1001 label Label_114
+  1001   call Sym_122
+  1001   Reg_0 = 0
+  1001   Stack_D = Reg_0
+  1001   call Sym_165
+  1001   call Sym_166
+  1001   Reg_1 = Stack_R
+  1001   Reg_1 += 1
+  1001   Reg_0 = Stack_R
+  1001   Stack_R = Reg_0
+  1001   Stack_R = Reg_1
+  1001   Reg_1 -= Reg_0
+  1001   if Reg_1 != 0 goto Label_114
+  1001   no-op
+           optimizes label Label_115
+  1001   Reg_0 = Stack_R
+  1001   Reg_0 = Stack_R
+  1001   no-op
+           optimizes label Label_113
+  1001   call Sym_2
+  1002   Reg_0 = Data_26
+  1002   Stack_D = Reg_0
+  1002   Reg_0 = 40
+  1002   Stack_D = Reg_0
+  1002   call Sym_0
+  1002   call Sym_2
+  1003   Reg_0 = 72
+           optimizes   Reg_0 = 71
+  1003   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+  1003   no-op
+           optimizes   call Sym_41
+  1003   Reg_0 = 65
+  1003   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+  1003   no-op
+           optimizes   Reg_1 = Stack_D
+  1003   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+  1003   Stack_R = Reg_0
+  1003   Stack_R = Reg_1
+  1003 label Label_117
+  1003   call Sym_122
+  1003   call Sym_166
+  1003   call Sym_167
+  1003   Reg_1 = Stack_R
+  1003   Reg_1 += 1
+  1003   Reg_0 = Stack_R
+  1003   Stack_R = Reg_0
+  1003   Stack_R = Reg_1
+  1003   Reg_1 -= Reg_0
+  1003   if Reg_1 != 0 goto Label_117
+  1003   no-op
+           optimizes label Label_118
+  1003   Reg_0 = Stack_R
+  1003   Reg_0 = Stack_R
+  1003   no-op
+           optimizes label Label_116
+  1003   call Sym_2
+  1004   Reg_0 = Data_27
+  1004   Stack_D = Reg_0
+  1004   Reg_0 = 43
+  1004   Stack_D = Reg_0
+  1004   call Sym_0
+  1004   call Sym_2
+  1005   Reg_0 = 6
+           optimizes   Reg_0 = 5
+  1005   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+  1005   no-op
+           optimizes   call Sym_41
+  1005   Reg_0 = 0
+  1005   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+  1005   no-op
+           optimizes   Reg_1 = Stack_D
+  1005   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+  1005   Stack_R = Reg_0
+  1005   Stack_R = Reg_1
+  1005 label Label_120
+  1005   call Sym_122
+  1005   Reg_0 = 48
+  1005   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+  1005   no-op
+           optimizes   call Sym_57
+  1005   no-op
+           optimizes   Reg_1 = Stack_D
+  1005   Reg_0 = Stack_D
+  1005   Reg_0 += Reg_1
+  1005   Stack_D = Reg_0
+  1005   call Sym_166
+  1005   Reg_0 = 2
+  1005   Stack_D = Reg_0
+  1005   call Sym_165
+  1005   Reg_1 = Stack_R
+  1005   Reg_1 += 1
+  1005   Reg_0 = Stack_R
+  1005   Stack_R = Reg_0
+  1005   Stack_R = Reg_1
+  1005   Reg_1 -= Reg_0
+  1005   if Reg_1 != 0 goto Label_120
+  1005   no-op
+           optimizes label Label_121
+  1005   Reg_0 = Stack_R
+  1005   Reg_0 = Stack_R
+  1005   no-op
+           optimizes label Label_119
+  1005   call Sym_2
+  1006   Reg_0 = Data_28
+  1006   Stack_D = Reg_0
+  1006   Reg_0 = 34
+  1006   Stack_D = Reg_0
+  1006   call Sym_0
+  1006   call Sym_2
+  1007   Reg_0 = Data_29
+  1007   Stack_D = Reg_0
+  1007   Reg_0 = 6
+  1007   Stack_D = Reg_0
+  1007   call Sym_168
+  1007   call Sym_2
+  1007   Reg_0 = Data_30
+  1007   Stack_D = Reg_0
+  1007   Reg_0 = 6
+  1007   Stack_D = Reg_0
+  1007   call Sym_168
+  1007   call Sym_2
+  1008   Reg_0 = Data_31
+  1008   Stack_D = Reg_0
+  1008   Reg_0 = 64
+  1008   Stack_D = Reg_0
+  1008   call Sym_0
+  1008   call Sym_2
+  1009   Reg_0 = Data_32
+  1009   Stack_D = Reg_0
+  1009   Reg_0 = 10
+  1009   Stack_D = Reg_0
+  1009   call Sym_0
+  1009   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+  1009   Stack_D = Reg_0
+  1009   call Sym_164
+  1009   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+  1009   Stack_D = Reg_0
+  1009   call Sym_164
+  1009   call Sym_2
+  1010   Reg_0 = Data_33
+  1010   Stack_D = Reg_0
+  1010   Reg_0 = 10
+  1010   Stack_D = Reg_0
+  1010   call Sym_0
+  1010   Reg_0 = 0
+  1010   Stack_D = Reg_0
+  1010   call Sym_169
+  1010   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+  1010   Stack_D = Reg_0
+  1010   call Sym_169
+  1010   tail call Sym_2
+           optimizes   call Sym_2
+  1011   no-op
+           optimizes label Label_109
+  1011 }
+
+  1020 function Sym_171 {
+  1021   call Sym_2
+  1021   Reg_0 = Data_35
+  1021   Stack_D = Reg_0
+  1021   Reg_0 = 32
+  1021   Stack_D = Reg_0
+  1021   call Sym_0
+  1021   call Sym_2
+  1022   Reg_0 = Sym_170
+  1022   Stack_D = Reg_0
+  1022   Reg_0 = 80
+  1022   Stack_D = Reg_0
+  1022   call Sym_172
+  1023   call Sym_2
+  1023   Reg_0 = Data_36
+  1023   Stack_D = Reg_0
+  1023   Reg_0 = 10
+  1023   Stack_D = Reg_0
+  1023   call Sym_0
+  1023   Reg_0 = 34
+  1023   Stack_D = Reg_0
+  1023   call Sym_166
+  1024   Reg_0 = Sym_170
+  1024   Stack_D = Reg_0
+  1024   call Sym_51
+  1024   call Sym_168
+  1024   Reg_0 = 34
+  1024   Stack_D = Reg_0
+  1024   call Sym_166
+  1024   tail call Sym_2
+           optimizes   call Sym_2
+  1025   no-op
+           optimizes label Label_122
+  1025 }
+
+    13 function Sym_1 {
+    13   Reg_0 = Data_0
+    13   Stack_D = Reg_0
+    13   Reg_0 = 18
+    13   Stack_D = Reg_0
+    13   call Sym_0
+    13   call Sym_2
+    16   no-op
+           optimizes   call Sym_3
+    16   Reg_0 = -1
+    16   Stack_D = Reg_0
+    16   call Sym_4
+    16   call Sym_5
+    19   Reg_0 = Data_1
+    19   Stack_D = Reg_0
+    19   Reg_0 = 35
+    19   Stack_D = Reg_0
+    19   call Sym_0
+    19   call Sym_2
+    21   Reg_0 = 180
+    21   Stack_D = Reg_0
+    21   call Sym_6
+    21   Reg_0 = 0
+           optimizes   Reg_0 = 0
+    21   Stack_D = Reg_0
+    21   no-op
+           optimizes   Reg_0 = 0
+    21   no-op
+           optimizes   Stack_D = Reg_0
+    21   no-op
+           optimizes   call Sym_7
+    21   call Sym_8
+    21   Reg_0 = 0
+    21   Stack_D = Reg_0
+    21   call Sym_9
+    22   Reg_0 = 190
+    22   Stack_D = Reg_0
+    22   call Sym_6
+    22   Reg_0 = 0
+           optimizes   Reg_0 = 0
+    22   Stack_D = Reg_0
+    22   no-op
+           optimizes   Reg_0 = 1
+    22   no-op
+           optimizes   Stack_D = Reg_0
+    22   no-op
+           optimizes   call Sym_7
+    22   call Sym_8
+    22   Reg_0 = 0
+    22   Stack_D = Reg_0
+    22   call Sym_9
+    23   Reg_0 = 200
+    23   Stack_D = Reg_0
+    23   call Sym_6
+    23   Reg_0 = 0
+           optimizes   Reg_0 = 1
+    23   Stack_D = Reg_0
+    23   no-op
+           optimizes   Reg_0 = 0
+    23   no-op
+           optimizes   Stack_D = Reg_0
+    23   no-op
+           optimizes   call Sym_7
+    23   call Sym_8
+    23   Reg_0 = 0
+    23   Stack_D = Reg_0
+    23   call Sym_9
+    24   Reg_0 = 210
+    24   Stack_D = Reg_0
+    24   call Sym_6
+    24   Reg_0 = 1
+           optimizes   Reg_0 = 1
+    24   Stack_D = Reg_0
+    24   no-op
+           optimizes   Reg_0 = 1
+    24   no-op
+           optimizes   Stack_D = Reg_0
+    24   no-op
+           optimizes   call Sym_7
+    24   call Sym_8
+    24   Reg_0 = 1
+    24   Stack_D = Reg_0
+    24   call Sym_9
+    26   Reg_0 = 230
+    26   Stack_D = Reg_0
+    26   call Sym_6
+    26   Reg_0 = 1
+           optimizes   Reg_0 = -1
+    26   Stack_D = Reg_0
+    26   no-op
+           optimizes   call Sym_10
+    26   no-op
+           optimizes   Reg_0 = 1
+    26   no-op
+           optimizes   Stack_D = Reg_0
+    26   no-op
+           optimizes   call Sym_7
+    26   call Sym_8
+    26   Reg_0 = 1
+    26   Stack_D = Reg_0
+    26   call Sym_9
+    27   Reg_0 = 240
+    27   Stack_D = Reg_0
+    27   call Sym_6
+    27   Reg_0 = 0
+           optimizes   Reg_0 = -2
+    27   Stack_D = Reg_0
+    27   no-op
+           optimizes   call Sym_10
+    27   no-op
+           optimizes   Reg_0 = 1
+    27   no-op
+           optimizes   Stack_D = Reg_0
+    27   no-op
+           optimizes   call Sym_7
+    27   call Sym_8
+    27   Reg_0 = 0
+    27   Stack_D = Reg_0
+    27   call Sym_9
+    29   Reg_0 = 0
+    29   no-op
+           optimizes   Stack_D = Reg_0
+    29   no-op
+           optimizes   Reg_0 = Stack_D
+    29   *(Sym_11) = Reg_0
+    30   Reg_0 = -1
+           optimizes   Reg_0 = 0
+    30   no-op
+           optimizes   Stack_D = Reg_0
+    30   no-op
+           optimizes   call Sym_10
+    30   no-op
+           optimizes   Reg_0 = Stack_D
+    30   *(Sym_12) = Reg_0
+    32   Reg_0 = 290
+    32   Stack_D = Reg_0
+    32   call Sym_6
+    32   Reg_0 = -1
+           optimizes   Reg_0 = 0
+    32   Stack_D = Reg_0
+    32   no-op
+           optimizes   call Sym_10
+    32   call Sym_8
+    32   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+    32   Stack_D = Reg_0
+    32   call Sym_9
+    33   Reg_0 = 300
+    33   Stack_D = Reg_0
+    33   call Sym_6
+    33   Reg_0 = 0
+           optimizes   Reg_0 = -1
+    33   Stack_D = Reg_0
+    33   no-op
+           optimizes   call Sym_10
+    33   call Sym_8
+    33   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_11)
+    33   Stack_D = Reg_0
+    33   call Sym_9
+    35   Reg_0 = 320
+    35   Stack_D = Reg_0
+    35   call Sym_6
+    35   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_11)
+    35   no-op
+           optimizes   Stack_D = Reg_0
+    35   no-op
+           optimizes   Reg_0 = *(Sym_11)
+    35   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_7
+    35   no-op
+           optimizes   Reg_1 = Stack_D
+    35   no-op
+           optimizes   Reg_0 = Stack_D
+    35   Reg_0 &= Reg_1
+    35   Stack_D = Reg_0
+    35   call Sym_8
+    35   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_11)
+    35   Stack_D = Reg_0
+    35   call Sym_9
+    36   Reg_0 = 330
+    36   Stack_D = Reg_0
+    36   call Sym_6
+    36   Reg_0 = 0
+           optimizes   Reg_0 = 0
+    36   Stack_D = Reg_0
+    36   no-op
+           optimizes   Reg_0 = -1
+    36   no-op
+           optimizes   Stack_D = Reg_0
+    36   no-op
+           optimizes   call Sym_7
+    36   call Sym_8
+    36   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_11)
+    36   Stack_D = Reg_0
+    36   call Sym_9
+    37   Reg_0 = 340
+    37   Stack_D = Reg_0
+    37   call Sym_6
+    37   Reg_0 = 0
+           optimizes   Reg_0 = -1
+    37   Stack_D = Reg_0
+    37   no-op
+           optimizes   Reg_0 = 0
+    37   no-op
+           optimizes   Stack_D = Reg_0
+    37   no-op
+           optimizes   call Sym_7
+    37   call Sym_8
+    37   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_11)
+    37   Stack_D = Reg_0
+    37   call Sym_9
+    38   Reg_0 = 350
+    38   Stack_D = Reg_0
+    38   call Sym_6
+    38   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+    38   no-op
+           optimizes   Stack_D = Reg_0
+    38   no-op
+           optimizes   Reg_0 = *(Sym_12)
+    38   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    38   no-op
+           optimizes   call Sym_7
+    38   no-op
+           optimizes   Reg_1 = Stack_D
+    38   no-op
+           optimizes   Reg_0 = Stack_D
+    38   Reg_0 &= Reg_1
+    38   Stack_D = Reg_0
+    38   call Sym_8
+    38   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+    38   Stack_D = Reg_0
+    38   call Sym_9
+    40   Reg_0 = 370
+    40   Stack_D = Reg_0
+    40   call Sym_6
+    40   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_11)
+    40   no-op
+           optimizes   Stack_D = Reg_0
+    40   no-op
+           optimizes   Reg_0 = *(Sym_11)
+    40   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    40   no-op
+           optimizes   call Sym_13
+    40   no-op
+           optimizes   Reg_1 = Stack_D
+    40   no-op
+           optimizes   Reg_0 = Stack_D
+    40   Reg_0 |= Reg_1
+    40   Stack_D = Reg_0
+    40   call Sym_8
+    40   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_11)
+    40   Stack_D = Reg_0
+    40   call Sym_9
+    41   Reg_0 = 380
+    41   Stack_D = Reg_0
+    41   call Sym_6
+    41   Reg_0 = -1
+           optimizes   Reg_0 = 0
+    41   Stack_D = Reg_0
+    41   no-op
+           optimizes   Reg_0 = -1
+    41   no-op
+           optimizes   Stack_D = Reg_0
+    41   no-op
+           optimizes   call Sym_13
+    41   call Sym_8
+    41   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+    41   Stack_D = Reg_0
+    41   call Sym_9
+    42   Reg_0 = 390
+    42   Stack_D = Reg_0
+    42   call Sym_6
+    42   Reg_0 = -1
+           optimizes   Reg_0 = -1
+    42   Stack_D = Reg_0
+    42   no-op
+           optimizes   Reg_0 = 0
+    42   no-op
+           optimizes   Stack_D = Reg_0
+    42   no-op
+           optimizes   call Sym_13
+    42   call Sym_8
+    42   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+    42   Stack_D = Reg_0
+    42   call Sym_9
+    43   Reg_0 = 400
+    43   Stack_D = Reg_0
+    43   call Sym_6
+    43   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+    43   no-op
+           optimizes   Stack_D = Reg_0
+    43   no-op
+           optimizes   Reg_0 = *(Sym_12)
+    43   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    43   no-op
+           optimizes   call Sym_13
+    43   no-op
+           optimizes   Reg_1 = Stack_D
+    43   no-op
+           optimizes   Reg_0 = Stack_D
+    43   Reg_0 |= Reg_1
+    43   Stack_D = Reg_0
+    43   call Sym_8
+    43   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+    43   Stack_D = Reg_0
+    43   call Sym_9
+    45   Reg_0 = 420
+    45   Stack_D = Reg_0
+    45   call Sym_6
+    45   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_11)
+    45   no-op
+           optimizes   Stack_D = Reg_0
+    45   no-op
+           optimizes   Reg_0 = *(Sym_11)
+    45   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    45   no-op
+           optimizes   call Sym_14
+    45   no-op
+           optimizes   Reg_1 = Stack_D
+    45   no-op
+           optimizes   Reg_0 = Stack_D
+    45   Reg_0 ^= Reg_1
+    45   Stack_D = Reg_0
+    45   call Sym_8
+    45   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_11)
+    45   Stack_D = Reg_0
+    45   call Sym_9
+    46   Reg_0 = 430
+    46   Stack_D = Reg_0
+    46   call Sym_6
+    46   Reg_0 = -1
+           optimizes   Reg_0 = 0
+    46   Stack_D = Reg_0
+    46   no-op
+           optimizes   Reg_0 = -1
+    46   no-op
+           optimizes   Stack_D = Reg_0
+    46   no-op
+           optimizes   call Sym_14
+    46   call Sym_8
+    46   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+    46   Stack_D = Reg_0
+    46   call Sym_9
+    47   Reg_0 = 440
+    47   Stack_D = Reg_0
+    47   call Sym_6
+    47   Reg_0 = -1
+           optimizes   Reg_0 = -1
+    47   Stack_D = Reg_0
+    47   no-op
+           optimizes   Reg_0 = 0
+    47   no-op
+           optimizes   Stack_D = Reg_0
+    47   no-op
+           optimizes   call Sym_14
+    47   call Sym_8
+    47   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+    47   Stack_D = Reg_0
+    47   call Sym_9
+    48   Reg_0 = 450
+    48   Stack_D = Reg_0
+    48   call Sym_6
+    48   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+    48   no-op
+           optimizes   Stack_D = Reg_0
+    48   no-op
+           optimizes   Reg_0 = *(Sym_12)
+    48   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    48   no-op
+           optimizes   call Sym_14
+    48   no-op
+           optimizes   Reg_1 = Stack_D
+    48   no-op
+           optimizes   Reg_0 = Stack_D
+    48   Reg_0 ^= Reg_1
+    48   Stack_D = Reg_0
+    48   call Sym_8
+    48   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_11)
+    48   Stack_D = Reg_0
+    48   call Sym_9
+    51   Reg_0 = Data_2
+    51   Stack_D = Reg_0
+    51   Reg_0 = 27
+    51   Stack_D = Reg_0
+    51   call Sym_0
+    51   call Sym_2
+    55   no-op
+           optimizes   call Sym_15
+    54   Reg_0 = 1
+    54   Stack_D = Reg_0
+    54 label Label_121
+    54   call Sym_16
+    54   no-op
+           optimizes   call Sym_17
+    54   Reg_0 = Stack_D
+    54   Reg_0 += Reg_0
+    54   no-op
+           optimizes   Stack_D = Reg_0
+    54   no-op
+           optimizes   Reg_0 = Stack_D
+    54   if Reg_0 == 0 goto Label_122
+    54   no-op
+           optimizes   call Sym_17
+    54   Reg_0 = Stack_D
+    54   Reg_0 += Reg_0
+    54   Stack_D = Reg_0
+    54   goto Label_121
+    54 label Label_122
+    55   Reg_0 = Stack_D
+    55   *(Sym_18) = Reg_0
+    57   Reg_0 = 540
+    57   Stack_D = Reg_0
+    57   call Sym_6
+    57   Reg_0 = 0
+           optimizes   Reg_0 = 0
+    57   Stack_D = Reg_0
+    57   no-op
+           optimizes   call Sym_17
+    57   call Sym_8
+    57   Reg_0 = 0
+    57   Stack_D = Reg_0
+    57   call Sym_9
+    58   Reg_0 = 550
+    58   Stack_D = Reg_0
+    58   call Sym_6
+    58   Reg_0 = 2
+           optimizes   Reg_0 = 1
+    58   Stack_D = Reg_0
+    58   no-op
+           optimizes   call Sym_17
+    58   call Sym_8
+    58   Reg_0 = 2
+    58   Stack_D = Reg_0
+    58   call Sym_9
+    59   Reg_0 = 560
+    59   Stack_D = Reg_0
+    59   call Sym_6
+    59   Reg_0 = 32768
+           optimizes   Reg_0 = 16384
+    59   Stack_D = Reg_0
+    59   no-op
+           optimizes   call Sym_17
+    59   call Sym_8
+    59   Reg_0 = 32768
+    59   Stack_D = Reg_0
+    59   call Sym_9
+    60   Reg_0 = 570
+    60   Stack_D = Reg_0
+    60   call Sym_6
+    60   Reg_0 = -1
+           optimizes   Reg_0 = -2
+    60   Stack_D = Reg_0
+    60   no-op
+           optimizes   call Sym_10
+    60   no-op
+           optimizes   call Sym_17
+    60   no-op
+           optimizes   Reg_0 = 1
+    60   no-op
+           optimizes   Stack_D = Reg_0
+    60   no-op
+           optimizes   call Sym_14
+    60   call Sym_8
+    60   Reg_0 = -1
+           optimizes   Reg_0 = 0
+    60   Stack_D = Reg_0
+    60   no-op
+           optimizes   call Sym_10
+    60   call Sym_9
+    61   Reg_0 = 580
+    61   Stack_D = Reg_0
+    61   call Sym_6
+    61   Reg_0 = *(Sym_18)
+    61   no-op
+           optimizes   Stack_D = Reg_0
+    61   no-op
+           optimizes   call Sym_17
+    61   no-op
+           optimizes   Reg_0 = Stack_D
+    61   Reg_0 += Reg_0
+    61   Stack_D = Reg_0
+    61   call Sym_8
+    61   Reg_0 = 0
+    61   Stack_D = Reg_0
+    61   call Sym_9
+    63   Reg_0 = 600
+    63   Stack_D = Reg_0
+    63   call Sym_6
+    63   Reg_0 = 0
+           optimizes   Reg_0 = 0
+    63   Stack_D = Reg_0
+    63   no-op
+           optimizes   call Sym_19
+    63   call Sym_8
+    63   Reg_0 = 0
+    63   Stack_D = Reg_0
+    63   call Sym_9
+    64   Reg_0 = 610
+    64   Stack_D = Reg_0
+    64   call Sym_6
+    64   Reg_0 = 0
+           optimizes   Reg_0 = 1
+    64   Stack_D = Reg_0
+    64   no-op
+           optimizes   call Sym_19
+    64   call Sym_8
+    64   Reg_0 = 0
+    64   Stack_D = Reg_0
+    64   call Sym_9
+    65   Reg_0 = 620
+    65   Stack_D = Reg_0
+    65   call Sym_6
+    65   Reg_0 = 8192
+           optimizes   Reg_0 = 16384
+    65   Stack_D = Reg_0
+    65   no-op
+           optimizes   call Sym_19
+    65   call Sym_8
+    65   Reg_0 = 8192
+    65   Stack_D = Reg_0
+    65   call Sym_9
+    66   Reg_0 = 630
+    66   Stack_D = Reg_0
+    66   call Sym_6
+    66   Reg_0 = -1
+           optimizes   Reg_0 = -1
+    66   Stack_D = Reg_0
+    66   no-op
+           optimizes   call Sym_10
+    66   no-op
+           optimizes   call Sym_19
+    66   call Sym_8
+    66   Reg_0 = -1
+           optimizes   Reg_0 = 0
+    66   Stack_D = Reg_0
+    66   no-op
+           optimizes   call Sym_10
+    66   call Sym_9
+    67   Reg_0 = 640
+    67   Stack_D = Reg_0
+    67   call Sym_6
+    67   Reg_0 = -1
+           optimizes   Reg_0 = -2
+    67   Stack_D = Reg_0
+    67   no-op
+           optimizes   call Sym_10
+    67   no-op
+           optimizes   Reg_0 = 1
+    67   no-op
+           optimizes   Stack_D = Reg_0
+    67   no-op
+           optimizes   call Sym_14
+    67   no-op
+           optimizes   call Sym_19
+    67   call Sym_8
+    67   Reg_0 = -1
+           optimizes   Reg_0 = 0
+    67   Stack_D = Reg_0
+    67   no-op
+           optimizes   call Sym_10
+    67   call Sym_9
+    68   Reg_0 = 650
+    68   Stack_D = Reg_0
+    68   call Sym_6
+    68   Reg_0 = *(Sym_18)
+    68   Stack_D = Reg_0
+    68   call Sym_19
+    68   Reg_0 = *(Sym_18)
+    68   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    68   no-op
+           optimizes   call Sym_7
+    68   no-op
+           optimizes   Reg_1 = Stack_D
+    68   Reg_0 = Stack_D
+    68   Reg_0 &= Reg_1
+    68   Stack_D = Reg_0
+    68   call Sym_8
+    68   Reg_0 = *(Sym_18)
+    68   Stack_D = Reg_0
+    68   call Sym_9
+    70   Reg_0 = 670
+    70   Stack_D = Reg_0
+    70   call Sym_6
+    70   Reg_0 = 1
+           optimizes   Reg_0 = 1
+    70   Stack_D = Reg_0
+    70   no-op
+           optimizes   Reg_0 = 0
+    70   no-op
+           optimizes   Stack_D = Reg_0
+    70   no-op
+           optimizes   call Sym_20
+    70   call Sym_8
+    70   Reg_0 = 1
+    70   Stack_D = Reg_0
+    70   call Sym_9
+    71   Reg_0 = 680
+    71   Stack_D = Reg_0
+    71   call Sym_6
+    71   Reg_0 = 2
+           optimizes   Reg_0 = 1
+    71   Stack_D = Reg_0
+    71   no-op
+           optimizes   Reg_0 = 1
+    71   no-op
+           optimizes   Stack_D = Reg_0
+    71   no-op
+           optimizes   call Sym_20
+    71   call Sym_8
+    71   Reg_0 = 2
+    71   Stack_D = Reg_0
+    71   call Sym_9
+    72   Reg_0 = 690
+    72   Stack_D = Reg_0
+    72   call Sym_6
+    72   Reg_0 = 4
+           optimizes   Reg_0 = 1
+    72   Stack_D = Reg_0
+    72   no-op
+           optimizes   Reg_0 = 2
+    72   no-op
+           optimizes   Stack_D = Reg_0
+    72   no-op
+           optimizes   call Sym_20
+    72   call Sym_8
+    72   Reg_0 = 4
+    72   Stack_D = Reg_0
+    72   call Sym_9
+    73   Reg_0 = 700
+    73   Stack_D = Reg_0
+    73   call Sym_6
+    73   Reg_0 = 32768
+           optimizes   Reg_0 = 1
+    73   Stack_D = Reg_0
+    73   no-op
+           optimizes   Reg_0 = 15
+    73   no-op
+           optimizes   Stack_D = Reg_0
+    73   no-op
+           optimizes   call Sym_20
+    73   call Sym_8
+    73   Reg_0 = 32768
+    73   Stack_D = Reg_0
+    73   call Sym_9
+    74   Reg_0 = 710
+    74   Stack_D = Reg_0
+    74   call Sym_6
+    74   Reg_0 = -1
+           optimizes   Reg_0 = -2
+    74   Stack_D = Reg_0
+    74   no-op
+           optimizes   call Sym_10
+    74   no-op
+           optimizes   Reg_0 = 1
+    74   no-op
+           optimizes   Stack_D = Reg_0
+    74   no-op
+           optimizes   call Sym_20
+    74   no-op
+           optimizes   Reg_0 = 1
+    74   no-op
+           optimizes   Stack_D = Reg_0
+    74   no-op
+           optimizes   call Sym_14
+    74   call Sym_8
+    74   Reg_0 = -1
+           optimizes   Reg_0 = 0
+    74   Stack_D = Reg_0
+    74   no-op
+           optimizes   call Sym_10
+    74   call Sym_9
+    75   Reg_0 = 720
+    75   Stack_D = Reg_0
+    75   call Sym_6
+    75   Reg_0 = *(Sym_18)
+    75   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    75   Reg_0 = 1
+    75   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    75   no-op
+           optimizes   call Sym_20
+    75   no-op
+           optimizes   Reg_1 = Stack_D
+    75   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    75   Reg_0 <<= Reg_1
+    75   Stack_D = Reg_0
+    75   call Sym_8
+    75   Reg_0 = 0
+    75   Stack_D = Reg_0
+    75   call Sym_9
+    77   Reg_0 = 740
+    77   Stack_D = Reg_0
+    77   call Sym_6
+    77   Reg_0 = 1
+           optimizes   Reg_0 = 1
+    77   Stack_D = Reg_0
+    77   no-op
+           optimizes   Reg_0 = 0
+    77   no-op
+           optimizes   Stack_D = Reg_0
+    77   no-op
+           optimizes   call Sym_21
+    77   call Sym_8
+    77   Reg_0 = 1
+    77   Stack_D = Reg_0
+    77   call Sym_9
+    78   Reg_0 = 750
+    78   Stack_D = Reg_0
+    78   call Sym_6
+    78   Reg_0 = 0
+           optimizes   Reg_0 = 1
+    78   Stack_D = Reg_0
+    78   no-op
+           optimizes   Reg_0 = 1
+    78   no-op
+           optimizes   Stack_D = Reg_0
+    78   no-op
+           optimizes   call Sym_21
+    78   call Sym_8
+    78   Reg_0 = 0
+    78   Stack_D = Reg_0
+    78   call Sym_9
+    79   Reg_0 = 760
+    79   Stack_D = Reg_0
+    79   call Sym_6
+    79   Reg_0 = 1
+           optimizes   Reg_0 = 2
+    79   Stack_D = Reg_0
+    79   no-op
+           optimizes   Reg_0 = 1
+    79   no-op
+           optimizes   Stack_D = Reg_0
+    79   no-op
+           optimizes   call Sym_21
+    79   call Sym_8
+    79   Reg_0 = 1
+    79   Stack_D = Reg_0
+    79   call Sym_9
+    80   Reg_0 = 770
+    80   Stack_D = Reg_0
+    80   call Sym_6
+    80   Reg_0 = 1
+           optimizes   Reg_0 = 4
+    80   Stack_D = Reg_0
+    80   no-op
+           optimizes   Reg_0 = 2
+    80   no-op
+           optimizes   Stack_D = Reg_0
+    80   no-op
+           optimizes   call Sym_21
+    80   call Sym_8
+    80   Reg_0 = 1
+    80   Stack_D = Reg_0
+    80   call Sym_9
+    81   Reg_0 = 780
+    81   Stack_D = Reg_0
+    81   call Sym_6
+    81   Reg_0 = 1
+           optimizes   Reg_0 = 32768
+    81   Stack_D = Reg_0
+    81   no-op
+           optimizes   Reg_0 = 15
+    81   no-op
+           optimizes   Stack_D = Reg_0
+    81   no-op
+           optimizes   call Sym_21
+    81   call Sym_8
+    81   Reg_0 = 1
+    81   Stack_D = Reg_0
+    81   call Sym_9
+    82   Reg_0 = 790
+    82   Stack_D = Reg_0
+    82   call Sym_6
+    82   Reg_0 = *(Sym_18)
+    82   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    82   Reg_0 = 1
+    82   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    82   no-op
+           optimizes   call Sym_21
+    82   no-op
+           optimizes   Reg_1 = Stack_D
+    82   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    82   Reg_0 >>= Reg_1
+    82   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    82   Reg_0 = *(Sym_18)
+    82   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    82   no-op
+           optimizes   call Sym_7
+    82   no-op
+           optimizes   Reg_1 = Stack_D
+    82   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    82   Reg_0 &= Reg_1
+    82   Stack_D = Reg_0
+    82   call Sym_8
+    82   Reg_0 = 0
+    82   Stack_D = Reg_0
+    82   call Sym_9
+    83   Reg_0 = 800
+    83   Stack_D = Reg_0
+    83   call Sym_6
+    83   Reg_0 = *(Sym_18)
+    83   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    83   Reg_0 = 1
+    83   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    83   no-op
+           optimizes   call Sym_21
+    83   no-op
+           optimizes   Reg_1 = Stack_D
+    83   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    83   Reg_0 >>= Reg_1
+    83   no-op
+           optimizes   Stack_D = Reg_0
+    83   no-op
+           optimizes   call Sym_17
+    83   no-op
+           optimizes   Reg_0 = Stack_D
+    83   Reg_0 += Reg_0
+    83   Stack_D = Reg_0
+    83   call Sym_8
+    83   Reg_0 = *(Sym_18)
+    83   Stack_D = Reg_0
+    83   call Sym_9
+    86   Reg_0 = Data_3
+    86   Stack_D = Reg_0
+    86   Reg_0 = 54
+    86   Stack_D = Reg_0
+    86   call Sym_0
+    86   call Sym_2
+    87   Reg_0 = -1
+           optimizes   Reg_0 = 0
+    87   no-op
+           optimizes   Stack_D = Reg_0
+    87   no-op
+           optimizes   call Sym_10
+    87   no-op
+           optimizes   Reg_0 = Stack_D
+    87   *(Sym_22) = Reg_0
+    88   Reg_0 = 2147483647
+           optimizes   Reg_0 = -1
+    88   no-op
+           optimizes   Stack_D = Reg_0
+    88   no-op
+           optimizes   call Sym_10
+    88   no-op
+           optimizes   Reg_0 = 1
+    88   no-op
+           optimizes   Stack_D = Reg_0
+    88   no-op
+           optimizes   call Sym_21
+    88   no-op
+           optimizes   Reg_0 = Stack_D
+    88   *(Sym_23) = Reg_0
+    89   Reg_0 = -2147483648
+           optimizes   Reg_0 = 2147483647
+    89   no-op
+           optimizes   Stack_D = Reg_0
+    89   no-op
+           optimizes   call Sym_10
+    89   no-op
+           optimizes   Reg_0 = 1
+    89   no-op
+           optimizes   Stack_D = Reg_0
+    89   no-op
+           optimizes   call Sym_21
+    89   no-op
+           optimizes   call Sym_10
+    89   no-op
+           optimizes   Reg_0 = Stack_D
+    89   *(Sym_24) = Reg_0
+    90   Reg_0 = 2147483647
+           optimizes   Reg_0 = -1
+    90   no-op
+           optimizes   Stack_D = Reg_0
+    90   no-op
+           optimizes   call Sym_10
+    90   no-op
+           optimizes   Reg_0 = 1
+    90   no-op
+           optimizes   Stack_D = Reg_0
+    90   no-op
+           optimizes   call Sym_21
+    90   no-op
+           optimizes   Reg_0 = Stack_D
+    90   *(Sym_25) = Reg_0
+    91   Reg_0 = -2147483648
+           optimizes   Reg_0 = 2147483647
+    91   no-op
+           optimizes   Stack_D = Reg_0
+    91   no-op
+           optimizes   call Sym_10
+    91   no-op
+           optimizes   Reg_0 = 1
+    91   no-op
+           optimizes   Stack_D = Reg_0
+    91   no-op
+           optimizes   call Sym_21
+    91   no-op
+           optimizes   call Sym_10
+    91   no-op
+           optimizes   Reg_0 = Stack_D
+    91   *(Sym_26) = Reg_0
+    93   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_11)
+    93   no-op
+           optimizes   Stack_D = Reg_0
+    93   no-op
+           optimizes   Reg_0 = Stack_D
+    93   *(Sym_27) = Reg_0
+    94   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+    94   no-op
+           optimizes   Stack_D = Reg_0
+    94   no-op
+           optimizes   Reg_0 = Stack_D
+    94   *(Sym_28) = Reg_0
+    96   Reg_0 = 930
+    96   Stack_D = Reg_0
+    96   call Sym_6
+    96   call Sym_8
+    96   call Sym_9
+    97   Reg_0 = 940
+    97   Stack_D = Reg_0
+    97   call Sym_6
+    97   Reg_0 = 0
+    97   no-op
+           optimizes   Stack_D = Reg_0
+    97   no-op
+           optimizes   call Sym_29
+    97   no-op
+           optimizes   Reg_0 = Stack_D
+    97   Reg_0 = Reg_0 == 0
+    97   Stack_D = Reg_0
+    97   call Sym_8
+    97   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+    97   Stack_D = Reg_0
+    97   call Sym_9
+    98   Reg_0 = 950
+    98   Stack_D = Reg_0
+    98   call Sym_6
+    98   Reg_0 = 1
+    98   no-op
+           optimizes   Stack_D = Reg_0
+    98   no-op
+           optimizes   call Sym_29
+    98   no-op
+           optimizes   Reg_0 = Stack_D
+    98   Reg_0 = Reg_0 == 0
+    98   Stack_D = Reg_0
+    98   call Sym_8
+    98   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+    98   Stack_D = Reg_0
+    98   call Sym_9
+    99   Reg_0 = 960
+    99   Stack_D = Reg_0
+    99   call Sym_6
+    99   Reg_0 = 2
+    99   no-op
+           optimizes   Stack_D = Reg_0
+    99   no-op
+           optimizes   call Sym_29
+    99   no-op
+           optimizes   Reg_0 = Stack_D
+    99   Reg_0 = Reg_0 == 0
+    99   Stack_D = Reg_0
+    99   call Sym_8
+    99   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+    99   Stack_D = Reg_0
+    99   call Sym_9
+   100   Reg_0 = 970
+   100   Stack_D = Reg_0
+   100   call Sym_6
+   100   Reg_0 = -1
+   100   no-op
+           optimizes   Stack_D = Reg_0
+   100   no-op
+           optimizes   call Sym_29
+   100   no-op
+           optimizes   Reg_0 = Stack_D
+   100   Reg_0 = Reg_0 == 0
+   100   Stack_D = Reg_0
+   100   call Sym_8
+   100   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   100   Stack_D = Reg_0
+   100   call Sym_9
+   101   Reg_0 = 980
+   101   Stack_D = Reg_0
+   101   call Sym_6
+   101   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   101   no-op
+           optimizes   Stack_D = Reg_0
+   101   no-op
+           optimizes   call Sym_29
+   101   no-op
+           optimizes   Reg_0 = Stack_D
+   101   Reg_0 = Reg_0 == 0
+   101   Stack_D = Reg_0
+   101   call Sym_8
+   101   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   101   Stack_D = Reg_0
+   101   call Sym_9
+   102   Reg_0 = 990
+   102   Stack_D = Reg_0
+   102   call Sym_6
+   102   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   102   no-op
+           optimizes   Stack_D = Reg_0
+   102   no-op
+           optimizes   call Sym_29
+   102   no-op
+           optimizes   Reg_0 = Stack_D
+   102   Reg_0 = Reg_0 == 0
+   102   Stack_D = Reg_0
+   102   call Sym_8
+   102   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   102   Stack_D = Reg_0
+   102   call Sym_9
+   103   Reg_0 = 1000
+   103   Stack_D = Reg_0
+   103   call Sym_6
+   103   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   103   no-op
+           optimizes   Stack_D = Reg_0
+   103   no-op
+           optimizes   call Sym_29
+   103   no-op
+           optimizes   Reg_0 = Stack_D
+   103   Reg_0 = Reg_0 == 0
+   103   Stack_D = Reg_0
+   103   call Sym_8
+   103   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   103   Stack_D = Reg_0
+   103   call Sym_9
+   105   Reg_0 = 1020
+   105   Stack_D = Reg_0
+   105   call Sym_6
+   105   Reg_0 = 0
+   105   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   105   Reg_0 = 0
+   105   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   105   no-op
+           optimizes   call Sym_30
+   105   no-op
+           optimizes   Reg_1 = Stack_D
+   105   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   105   Reg_0 = Reg_0 == Reg_1
+   105   Stack_D = Reg_0
+   105   call Sym_8
+   105   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   105   Stack_D = Reg_0
+   105   call Sym_9
+   106   Reg_0 = 1030
+   106   Stack_D = Reg_0
+   106   call Sym_6
+   106   Reg_0 = 1
+   106   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   106   Reg_0 = 1
+   106   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   106   no-op
+           optimizes   call Sym_30
+   106   no-op
+           optimizes   Reg_1 = Stack_D
+   106   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   106   Reg_0 = Reg_0 == Reg_1
+   106   Stack_D = Reg_0
+   106   call Sym_8
+   106   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   106   Stack_D = Reg_0
+   106   call Sym_9
+   107   Reg_0 = 1040
+   107   Stack_D = Reg_0
+   107   call Sym_6
+   107   Reg_0 = -1
+   107   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   107   Reg_0 = -1
+   107   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   107   no-op
+           optimizes   call Sym_30
+   107   no-op
+           optimizes   Reg_1 = Stack_D
+   107   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   107   Reg_0 = Reg_0 == Reg_1
+   107   Stack_D = Reg_0
+   107   call Sym_8
+   107   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   107   Stack_D = Reg_0
+   107   call Sym_9
+   108   Reg_0 = 1050
+   108   Stack_D = Reg_0
+   108   call Sym_6
+   108   Reg_0 = 1
+   108   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   108   Reg_0 = 0
+   108   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   108   no-op
+           optimizes   call Sym_30
+   108   no-op
+           optimizes   Reg_1 = Stack_D
+   108   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   108   Reg_0 = Reg_0 == Reg_1
+   108   Stack_D = Reg_0
+   108   call Sym_8
+   108   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   108   Stack_D = Reg_0
+   108   call Sym_9
+   109   Reg_0 = 1060
+   109   Stack_D = Reg_0
+   109   call Sym_6
+   109   Reg_0 = -1
+   109   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   109   Reg_0 = 0
+   109   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   109   no-op
+           optimizes   call Sym_30
+   109   no-op
+           optimizes   Reg_1 = Stack_D
+   109   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   109   Reg_0 = Reg_0 == Reg_1
+   109   Stack_D = Reg_0
+   109   call Sym_8
+   109   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   109   Stack_D = Reg_0
+   109   call Sym_9
+   110   Reg_0 = 1070
+   110   Stack_D = Reg_0
+   110   call Sym_6
+   110   Reg_0 = 0
+   110   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   110   Reg_0 = 1
+   110   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   110   no-op
+           optimizes   call Sym_30
+   110   no-op
+           optimizes   Reg_1 = Stack_D
+   110   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   110   Reg_0 = Reg_0 == Reg_1
+   110   Stack_D = Reg_0
+   110   call Sym_8
+   110   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   110   Stack_D = Reg_0
+   110   call Sym_9
+   111   Reg_0 = 1080
+   111   Stack_D = Reg_0
+   111   call Sym_6
+   111   Reg_0 = 0
+   111   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   111   Reg_0 = -1
+   111   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   111   no-op
+           optimizes   call Sym_30
+   111   no-op
+           optimizes   Reg_1 = Stack_D
+   111   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   111   Reg_0 = Reg_0 == Reg_1
+   111   Stack_D = Reg_0
+   111   call Sym_8
+   111   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   111   Stack_D = Reg_0
+   111   call Sym_9
+   113   Reg_0 = 1100
+   113   Stack_D = Reg_0
+   113   call Sym_6
+   113   Reg_0 = 0
+   113   no-op
+           optimizes   Stack_D = Reg_0
+   113   no-op
+           optimizes   call Sym_31
+   113   no-op
+           optimizes   Reg_0 = Stack_D
+   113   Reg_0 = Reg_0 < 0
+   113   Stack_D = Reg_0
+   113   call Sym_8
+   113   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   113   Stack_D = Reg_0
+   113   call Sym_9
+   114   Reg_0 = 1110
+   114   Stack_D = Reg_0
+   114   call Sym_6
+   114   Reg_0 = -1
+   114   no-op
+           optimizes   Stack_D = Reg_0
+   114   no-op
+           optimizes   call Sym_31
+   114   no-op
+           optimizes   Reg_0 = Stack_D
+   114   Reg_0 = Reg_0 < 0
+   114   Stack_D = Reg_0
+   114   call Sym_8
+   114   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   114   Stack_D = Reg_0
+   114   call Sym_9
+   115   Reg_0 = 1120
+   115   Stack_D = Reg_0
+   115   call Sym_6
+   115   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   115   no-op
+           optimizes   Stack_D = Reg_0
+   115   no-op
+           optimizes   call Sym_31
+   115   no-op
+           optimizes   Reg_0 = Stack_D
+   115   Reg_0 = Reg_0 < 0
+   115   Stack_D = Reg_0
+   115   call Sym_8
+   115   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   115   Stack_D = Reg_0
+   115   call Sym_9
+   116   Reg_0 = 1130
+   116   Stack_D = Reg_0
+   116   call Sym_6
+   116   Reg_0 = 1
+   116   no-op
+           optimizes   Stack_D = Reg_0
+   116   no-op
+           optimizes   call Sym_31
+   116   no-op
+           optimizes   Reg_0 = Stack_D
+   116   Reg_0 = Reg_0 < 0
+   116   Stack_D = Reg_0
+   116   call Sym_8
+   116   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   116   Stack_D = Reg_0
+   116   call Sym_9
+   117   Reg_0 = 1140
+   117   Stack_D = Reg_0
+   117   call Sym_6
+   117   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   117   no-op
+           optimizes   Stack_D = Reg_0
+   117   no-op
+           optimizes   call Sym_31
+   117   no-op
+           optimizes   Reg_0 = Stack_D
+   117   Reg_0 = Reg_0 < 0
+   117   Stack_D = Reg_0
+   117   call Sym_8
+   117   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   117   Stack_D = Reg_0
+   117   call Sym_9
+   119   Reg_0 = 1160
+   119   Stack_D = Reg_0
+   119   call Sym_6
+   119   Reg_0 = 0
+   119   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   119   Reg_0 = 1
+   119   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   119   no-op
+           optimizes   call Sym_32
+   119   no-op
+           optimizes   Reg_1 = Stack_D
+   119   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   119   Reg_0 = Reg_0 < Reg_1
+   119   Stack_D = Reg_0
+   119   call Sym_8
+   119   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   119   Stack_D = Reg_0
+   119   call Sym_9
+   120   Reg_0 = 1170
+   120   Stack_D = Reg_0
+   120   call Sym_6
+   120   Reg_0 = 1
+   120   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   120   Reg_0 = 2
+   120   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   120   no-op
+           optimizes   call Sym_32
+   120   no-op
+           optimizes   Reg_1 = Stack_D
+   120   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   120   Reg_0 = Reg_0 < Reg_1
+   120   Stack_D = Reg_0
+   120   call Sym_8
+   120   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   120   Stack_D = Reg_0
+   120   call Sym_9
+   121   Reg_0 = 1180
+   121   Stack_D = Reg_0
+   121   call Sym_6
+   121   Reg_0 = -1
+   121   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   121   Reg_0 = 0
+   121   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   121   no-op
+           optimizes   call Sym_32
+   121   no-op
+           optimizes   Reg_1 = Stack_D
+   121   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   121   Reg_0 = Reg_0 < Reg_1
+   121   Stack_D = Reg_0
+   121   call Sym_8
+   121   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   121   Stack_D = Reg_0
+   121   call Sym_9
+   122   Reg_0 = 1190
+   122   Stack_D = Reg_0
+   122   call Sym_6
+   122   Reg_0 = -1
+   122   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   122   Reg_0 = 1
+   122   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   122   no-op
+           optimizes   call Sym_32
+   122   no-op
+           optimizes   Reg_1 = Stack_D
+   122   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   122   Reg_0 = Reg_0 < Reg_1
+   122   Stack_D = Reg_0
+   122   call Sym_8
+   122   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   122   Stack_D = Reg_0
+   122   call Sym_9
+   123   Reg_0 = 1200
+   123   Stack_D = Reg_0
+   123   call Sym_6
+   123   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   123   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   123   Reg_0 = 0
+   123   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   123   no-op
+           optimizes   call Sym_32
+   123   no-op
+           optimizes   Reg_1 = Stack_D
+   123   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   123   Reg_0 = Reg_0 < Reg_1
+   123   Stack_D = Reg_0
+   123   call Sym_8
+   123   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   123   Stack_D = Reg_0
+   123   call Sym_9
+   124   Reg_0 = 1210
+   124   Stack_D = Reg_0
+   124   call Sym_6
+   124   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   124   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   124   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   124   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   124   no-op
+           optimizes   call Sym_32
+   124   no-op
+           optimizes   Reg_1 = Stack_D
+   124   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   124   Reg_0 = Reg_0 < Reg_1
+   124   Stack_D = Reg_0
+   124   call Sym_8
+   124   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   124   Stack_D = Reg_0
+   124   call Sym_9
+   125   Reg_0 = 1220
+   125   Stack_D = Reg_0
+   125   call Sym_6
+   125   Reg_0 = 0
+   125   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   125   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   125   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   125   no-op
+           optimizes   call Sym_32
+   125   no-op
+           optimizes   Reg_1 = Stack_D
+   125   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   125   Reg_0 = Reg_0 < Reg_1
+   125   Stack_D = Reg_0
+   125   call Sym_8
+   125   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   125   Stack_D = Reg_0
+   125   call Sym_9
+   126   Reg_0 = 1230
+   126   Stack_D = Reg_0
+   126   call Sym_6
+   126   Reg_0 = 0
+   126   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   126   Reg_0 = 0
+   126   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   126   no-op
+           optimizes   call Sym_32
+   126   no-op
+           optimizes   Reg_1 = Stack_D
+   126   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   126   Reg_0 = Reg_0 < Reg_1
+   126   Stack_D = Reg_0
+   126   call Sym_8
+   126   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   126   Stack_D = Reg_0
+   126   call Sym_9
+   127   Reg_0 = 1240
+   127   Stack_D = Reg_0
+   127   call Sym_6
+   127   Reg_0 = 1
+   127   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   127   Reg_0 = 1
+   127   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   127   no-op
+           optimizes   call Sym_32
+   127   no-op
+           optimizes   Reg_1 = Stack_D
+   127   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   127   Reg_0 = Reg_0 < Reg_1
+   127   Stack_D = Reg_0
+   127   call Sym_8
+   127   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   127   Stack_D = Reg_0
+   127   call Sym_9
+   128   Reg_0 = 1250
+   128   Stack_D = Reg_0
+   128   call Sym_6
+   128   Reg_0 = 1
+   128   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   128   Reg_0 = 0
+   128   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   128   no-op
+           optimizes   call Sym_32
+   128   no-op
+           optimizes   Reg_1 = Stack_D
+   128   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   128   Reg_0 = Reg_0 < Reg_1
+   128   Stack_D = Reg_0
+   128   call Sym_8
+   128   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   128   Stack_D = Reg_0
+   128   call Sym_9
+   129   Reg_0 = 1260
+   129   Stack_D = Reg_0
+   129   call Sym_6
+   129   Reg_0 = 2
+   129   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   129   Reg_0 = 1
+   129   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   129   no-op
+           optimizes   call Sym_32
+   129   no-op
+           optimizes   Reg_1 = Stack_D
+   129   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   129   Reg_0 = Reg_0 < Reg_1
+   129   Stack_D = Reg_0
+   129   call Sym_8
+   129   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   129   Stack_D = Reg_0
+   129   call Sym_9
+   130   Reg_0 = 1270
+   130   Stack_D = Reg_0
+   130   call Sym_6
+   130   Reg_0 = 0
+   130   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   130   Reg_0 = -1
+   130   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   130   no-op
+           optimizes   call Sym_32
+   130   no-op
+           optimizes   Reg_1 = Stack_D
+   130   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   130   Reg_0 = Reg_0 < Reg_1
+   130   Stack_D = Reg_0
+   130   call Sym_8
+   130   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   130   Stack_D = Reg_0
+   130   call Sym_9
+   131   Reg_0 = 1280
+   131   Stack_D = Reg_0
+   131   call Sym_6
+   131   Reg_0 = 1
+   131   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   131   Reg_0 = -1
+   131   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   131   no-op
+           optimizes   call Sym_32
+   131   no-op
+           optimizes   Reg_1 = Stack_D
+   131   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   131   Reg_0 = Reg_0 < Reg_1
+   131   Stack_D = Reg_0
+   131   call Sym_8
+   131   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   131   Stack_D = Reg_0
+   131   call Sym_9
+   132   Reg_0 = 1290
+   132   Stack_D = Reg_0
+   132   call Sym_6
+   132   Reg_0 = 0
+   132   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   132   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   132   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   132   no-op
+           optimizes   call Sym_32
+   132   no-op
+           optimizes   Reg_1 = Stack_D
+   132   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   132   Reg_0 = Reg_0 < Reg_1
+   132   Stack_D = Reg_0
+   132   call Sym_8
+   132   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   132   Stack_D = Reg_0
+   132   call Sym_9
+   133   Reg_0 = 1300
+   133   Stack_D = Reg_0
+   133   call Sym_6
+   133   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   133   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   133   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   133   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   133   no-op
+           optimizes   call Sym_32
+   133   no-op
+           optimizes   Reg_1 = Stack_D
+   133   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   133   Reg_0 = Reg_0 < Reg_1
+   133   Stack_D = Reg_0
+   133   call Sym_8
+   133   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   133   Stack_D = Reg_0
+   133   call Sym_9
+   134   Reg_0 = 1310
+   134   Stack_D = Reg_0
+   134   call Sym_6
+   134   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   134   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   134   Reg_0 = 0
+   134   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   134   no-op
+           optimizes   call Sym_32
+   134   no-op
+           optimizes   Reg_1 = Stack_D
+   134   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   134   Reg_0 = Reg_0 < Reg_1
+   134   Stack_D = Reg_0
+   134   call Sym_8
+   134   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   134   Stack_D = Reg_0
+   134   call Sym_9
+   136   Reg_0 = 1330
+   136   Stack_D = Reg_0
+   136   call Sym_6
+   136   Reg_0 = 0
+   136   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   136   Reg_0 = 1
+   136   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   136   no-op
+           optimizes   call Sym_33
+   136   no-op
+           optimizes   Reg_1 = Stack_D
+   136   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   136   Reg_0 = Reg_0 > Reg_1
+   136   Stack_D = Reg_0
+   136   call Sym_8
+   136   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   136   Stack_D = Reg_0
+   136   call Sym_9
+   137   Reg_0 = 1340
+   137   Stack_D = Reg_0
+   137   call Sym_6
+   137   Reg_0 = 1
+   137   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   137   Reg_0 = 2
+   137   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   137   no-op
+           optimizes   call Sym_33
+   137   no-op
+           optimizes   Reg_1 = Stack_D
+   137   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   137   Reg_0 = Reg_0 > Reg_1
+   137   Stack_D = Reg_0
+   137   call Sym_8
+   137   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   137   Stack_D = Reg_0
+   137   call Sym_9
+   138   Reg_0 = 1350
+   138   Stack_D = Reg_0
+   138   call Sym_6
+   138   Reg_0 = -1
+   138   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   138   Reg_0 = 0
+   138   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   138   no-op
+           optimizes   call Sym_33
+   138   no-op
+           optimizes   Reg_1 = Stack_D
+   138   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   138   Reg_0 = Reg_0 > Reg_1
+   138   Stack_D = Reg_0
+   138   call Sym_8
+   138   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   138   Stack_D = Reg_0
+   138   call Sym_9
+   139   Reg_0 = 1360
+   139   Stack_D = Reg_0
+   139   call Sym_6
+   139   Reg_0 = -1
+   139   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   139   Reg_0 = 1
+   139   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   139   no-op
+           optimizes   call Sym_33
+   139   no-op
+           optimizes   Reg_1 = Stack_D
+   139   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   139   Reg_0 = Reg_0 > Reg_1
+   139   Stack_D = Reg_0
+   139   call Sym_8
+   139   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   139   Stack_D = Reg_0
+   139   call Sym_9
+   140   Reg_0 = 1370
+   140   Stack_D = Reg_0
+   140   call Sym_6
+   140   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   140   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   140   Reg_0 = 0
+   140   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   140   no-op
+           optimizes   call Sym_33
+   140   no-op
+           optimizes   Reg_1 = Stack_D
+   140   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   140   Reg_0 = Reg_0 > Reg_1
+   140   Stack_D = Reg_0
+   140   call Sym_8
+   140   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   140   Stack_D = Reg_0
+   140   call Sym_9
+   141   Reg_0 = 1380
+   141   Stack_D = Reg_0
+   141   call Sym_6
+   141   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   141   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   141   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   141   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   141   no-op
+           optimizes   call Sym_33
+   141   no-op
+           optimizes   Reg_1 = Stack_D
+   141   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   141   Reg_0 = Reg_0 > Reg_1
+   141   Stack_D = Reg_0
+   141   call Sym_8
+   141   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   141   Stack_D = Reg_0
+   141   call Sym_9
+   142   Reg_0 = 1390
+   142   Stack_D = Reg_0
+   142   call Sym_6
+   142   Reg_0 = 0
+   142   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   142   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   142   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   142   no-op
+           optimizes   call Sym_33
+   142   no-op
+           optimizes   Reg_1 = Stack_D
+   142   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   142   Reg_0 = Reg_0 > Reg_1
+   142   Stack_D = Reg_0
+   142   call Sym_8
+   142   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   142   Stack_D = Reg_0
+   142   call Sym_9
+   143   Reg_0 = 1400
+   143   Stack_D = Reg_0
+   143   call Sym_6
+   143   Reg_0 = 0
+   143   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   143   Reg_0 = 0
+   143   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   143   no-op
+           optimizes   call Sym_33
+   143   no-op
+           optimizes   Reg_1 = Stack_D
+   143   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   143   Reg_0 = Reg_0 > Reg_1
+   143   Stack_D = Reg_0
+   143   call Sym_8
+   143   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   143   Stack_D = Reg_0
+   143   call Sym_9
+   144   Reg_0 = 1410
+   144   Stack_D = Reg_0
+   144   call Sym_6
+   144   Reg_0 = 1
+   144   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   144   Reg_0 = 1
+   144   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   144   no-op
+           optimizes   call Sym_33
+   144   no-op
+           optimizes   Reg_1 = Stack_D
+   144   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   144   Reg_0 = Reg_0 > Reg_1
+   144   Stack_D = Reg_0
+   144   call Sym_8
+   144   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   144   Stack_D = Reg_0
+   144   call Sym_9
+   145   Reg_0 = 1420
+   145   Stack_D = Reg_0
+   145   call Sym_6
+   145   Reg_0 = 1
+   145   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   145   Reg_0 = 0
+   145   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   145   no-op
+           optimizes   call Sym_33
+   145   no-op
+           optimizes   Reg_1 = Stack_D
+   145   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   145   Reg_0 = Reg_0 > Reg_1
+   145   Stack_D = Reg_0
+   145   call Sym_8
+   145   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   145   Stack_D = Reg_0
+   145   call Sym_9
+   146   Reg_0 = 1430
+   146   Stack_D = Reg_0
+   146   call Sym_6
+   146   Reg_0 = 2
+   146   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   146   Reg_0 = 1
+   146   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   146   no-op
+           optimizes   call Sym_33
+   146   no-op
+           optimizes   Reg_1 = Stack_D
+   146   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   146   Reg_0 = Reg_0 > Reg_1
+   146   Stack_D = Reg_0
+   146   call Sym_8
+   146   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   146   Stack_D = Reg_0
+   146   call Sym_9
+   147   Reg_0 = 1440
+   147   Stack_D = Reg_0
+   147   call Sym_6
+   147   Reg_0 = 0
+   147   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   147   Reg_0 = -1
+   147   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   147   no-op
+           optimizes   call Sym_33
+   147   no-op
+           optimizes   Reg_1 = Stack_D
+   147   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   147   Reg_0 = Reg_0 > Reg_1
+   147   Stack_D = Reg_0
+   147   call Sym_8
+   147   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   147   Stack_D = Reg_0
+   147   call Sym_9
+   148   Reg_0 = 1450
+   148   Stack_D = Reg_0
+   148   call Sym_6
+   148   Reg_0 = 1
+   148   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   148   Reg_0 = -1
+   148   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   148   no-op
+           optimizes   call Sym_33
+   148   no-op
+           optimizes   Reg_1 = Stack_D
+   148   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   148   Reg_0 = Reg_0 > Reg_1
+   148   Stack_D = Reg_0
+   148   call Sym_8
+   148   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   148   Stack_D = Reg_0
+   148   call Sym_9
+   149   Reg_0 = 1460
+   149   Stack_D = Reg_0
+   149   call Sym_6
+   149   Reg_0 = 0
+   149   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   149   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   149   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   149   no-op
+           optimizes   call Sym_33
+   149   no-op
+           optimizes   Reg_1 = Stack_D
+   149   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   149   Reg_0 = Reg_0 > Reg_1
+   149   Stack_D = Reg_0
+   149   call Sym_8
+   149   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   149   Stack_D = Reg_0
+   149   call Sym_9
+   150   Reg_0 = 1470
+   150   Stack_D = Reg_0
+   150   call Sym_6
+   150   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   150   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   150   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   150   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   150   no-op
+           optimizes   call Sym_33
+   150   no-op
+           optimizes   Reg_1 = Stack_D
+   150   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   150   Reg_0 = Reg_0 > Reg_1
+   150   Stack_D = Reg_0
+   150   call Sym_8
+   150   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   150   Stack_D = Reg_0
+   150   call Sym_9
+   151   Reg_0 = 1480
+   151   Stack_D = Reg_0
+   151   call Sym_6
+   151   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   151   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   151   Reg_0 = 0
+   151   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   151   no-op
+           optimizes   call Sym_33
+   151   no-op
+           optimizes   Reg_1 = Stack_D
+   151   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   151   Reg_0 = Reg_0 > Reg_1
+   151   Stack_D = Reg_0
+   151   call Sym_8
+   151   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   151   Stack_D = Reg_0
+   151   call Sym_9
+   153   Reg_0 = 1500
+   153   Stack_D = Reg_0
+   153   call Sym_6
+   153   Reg_0 = 0
+   153   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   153   Reg_0 = 1
+   153   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   153   no-op
+           optimizes   call Sym_34
+   153   no-op
+           optimizes   Reg_1 = Stack_D
+   153   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   153   Reg_0 = Reg_0 u< Reg_1
+   153   Stack_D = Reg_0
+   153   call Sym_8
+   153   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   153   Stack_D = Reg_0
+   153   call Sym_9
+   154   Reg_0 = 1510
+   154   Stack_D = Reg_0
+   154   call Sym_6
+   154   Reg_0 = 1
+   154   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   154   Reg_0 = 2
+   154   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   154   no-op
+           optimizes   call Sym_34
+   154   no-op
+           optimizes   Reg_1 = Stack_D
+   154   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   154   Reg_0 = Reg_0 u< Reg_1
+   154   Stack_D = Reg_0
+   154   call Sym_8
+   154   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   154   Stack_D = Reg_0
+   154   call Sym_9
+   155   Reg_0 = 1520
+   155   Stack_D = Reg_0
+   155   call Sym_6
+   155   Reg_0 = 0
+   155   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   155   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   155   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   155   no-op
+           optimizes   call Sym_34
+   155   no-op
+           optimizes   Reg_1 = Stack_D
+   155   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   155   Reg_0 = Reg_0 u< Reg_1
+   155   Stack_D = Reg_0
+   155   call Sym_8
+   155   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   155   Stack_D = Reg_0
+   155   call Sym_9
+   156   Reg_0 = 1530
+   156   Stack_D = Reg_0
+   156   call Sym_6
+   156   Reg_0 = 0
+   156   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   156   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   156   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   156   no-op
+           optimizes   call Sym_34
+   156   no-op
+           optimizes   Reg_1 = Stack_D
+   156   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   156   Reg_0 = Reg_0 u< Reg_1
+   156   Stack_D = Reg_0
+   156   call Sym_8
+   156   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   156   Stack_D = Reg_0
+   156   call Sym_9
+   157   Reg_0 = 1540
+   157   Stack_D = Reg_0
+   157   call Sym_6
+   157   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   157   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   157   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   157   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   157   no-op
+           optimizes   call Sym_34
+   157   no-op
+           optimizes   Reg_1 = Stack_D
+   157   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   157   Reg_0 = Reg_0 u< Reg_1
+   157   Stack_D = Reg_0
+   157   call Sym_8
+   157   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   157   Stack_D = Reg_0
+   157   call Sym_9
+   158   Reg_0 = 1550
+   158   Stack_D = Reg_0
+   158   call Sym_6
+   158   Reg_0 = 0
+   158   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   158   Reg_0 = 0
+   158   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   158   no-op
+           optimizes   call Sym_34
+   158   no-op
+           optimizes   Reg_1 = Stack_D
+   158   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   158   Reg_0 = Reg_0 u< Reg_1
+   158   Stack_D = Reg_0
+   158   call Sym_8
+   158   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   158   Stack_D = Reg_0
+   158   call Sym_9
+   159   Reg_0 = 1560
+   159   Stack_D = Reg_0
+   159   call Sym_6
+   159   Reg_0 = 1
+   159   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   159   Reg_0 = 1
+   159   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   159   no-op
+           optimizes   call Sym_34
+   159   no-op
+           optimizes   Reg_1 = Stack_D
+   159   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   159   Reg_0 = Reg_0 u< Reg_1
+   159   Stack_D = Reg_0
+   159   call Sym_8
+   159   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   159   Stack_D = Reg_0
+   159   call Sym_9
+   160   Reg_0 = 1570
+   160   Stack_D = Reg_0
+   160   call Sym_6
+   160   Reg_0 = 1
+   160   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   160   Reg_0 = 0
+   160   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   160   no-op
+           optimizes   call Sym_34
+   160   no-op
+           optimizes   Reg_1 = Stack_D
+   160   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   160   Reg_0 = Reg_0 u< Reg_1
+   160   Stack_D = Reg_0
+   160   call Sym_8
+   160   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   160   Stack_D = Reg_0
+   160   call Sym_9
+   161   Reg_0 = 1580
+   161   Stack_D = Reg_0
+   161   call Sym_6
+   161   Reg_0 = 2
+   161   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   161   Reg_0 = 1
+   161   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   161   no-op
+           optimizes   call Sym_34
+   161   no-op
+           optimizes   Reg_1 = Stack_D
+   161   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   161   Reg_0 = Reg_0 u< Reg_1
+   161   Stack_D = Reg_0
+   161   call Sym_8
+   161   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   161   Stack_D = Reg_0
+   161   call Sym_9
+   162   Reg_0 = 1590
+   162   Stack_D = Reg_0
+   162   call Sym_6
+   162   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   162   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   162   Reg_0 = 0
+   162   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   162   no-op
+           optimizes   call Sym_34
+   162   no-op
+           optimizes   Reg_1 = Stack_D
+   162   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   162   Reg_0 = Reg_0 u< Reg_1
+   162   Stack_D = Reg_0
+   162   call Sym_8
+   162   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   162   Stack_D = Reg_0
+   162   call Sym_9
+   163   Reg_0 = 1600
+   163   Stack_D = Reg_0
+   163   call Sym_6
+   163   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   163   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   163   Reg_0 = 0
+   163   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   163   no-op
+           optimizes   call Sym_34
+   163   no-op
+           optimizes   Reg_1 = Stack_D
+   163   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   163   Reg_0 = Reg_0 u< Reg_1
+   163   Stack_D = Reg_0
+   163   call Sym_8
+   163   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   163   Stack_D = Reg_0
+   163   call Sym_9
+   164   Reg_0 = 1610
+   164   Stack_D = Reg_0
+   164   call Sym_6
+   164   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   164   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   164   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   164   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   164   no-op
+           optimizes   call Sym_34
+   164   no-op
+           optimizes   Reg_1 = Stack_D
+   164   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   164   Reg_0 = Reg_0 u< Reg_1
+   164   Stack_D = Reg_0
+   164   call Sym_8
+   164   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   164   Stack_D = Reg_0
+   164   call Sym_9
+   165   Reg_0 = 1611
+   165   Stack_D = Reg_0
+   165   call Sym_6
+   165   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   165   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   165   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   165   no-op
+           optimizes   call Sym_35
+   165   no-op
+           optimizes   Reg_1 = Stack_D
+   165   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   165   Reg_0 = Reg_0 u> Reg_1
+   165   Stack_D = Reg_0
+   165   call Sym_8
+   165   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   165   Stack_D = Reg_0
+   165   call Sym_9
+   166   Reg_0 = 1612
+   166   Stack_D = Reg_0
+   166   call Sym_6
+   166   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   166   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   166   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   166   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   166   no-op
+           optimizes   call Sym_35
+   166   no-op
+           optimizes   Reg_1 = Stack_D
+   166   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   166   Reg_0 = Reg_0 u> Reg_1
+   166   Stack_D = Reg_0
+   166   call Sym_8
+   166   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   166   Stack_D = Reg_0
+   166   call Sym_9
+   167   Reg_0 = 1613
+   167   Stack_D = Reg_0
+   167   call Sym_6
+   167   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   167   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   167   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   167   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   167   no-op
+           optimizes   call Sym_35
+   167   no-op
+           optimizes   Reg_1 = Stack_D
+   167   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   167   Reg_0 = Reg_0 u> Reg_1
+   167   Stack_D = Reg_0
+   167   call Sym_8
+   167   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   167   Stack_D = Reg_0
+   167   call Sym_9
+   168   Reg_0 = 1614
+   168   Stack_D = Reg_0
+   168   call Sym_6
+   168   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   168   no-op
+           optimizes   Stack_D = Reg_0
+   168   no-op
+           optimizes   Reg_0 = *(Sym_24)
+   168   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   168   no-op
+           optimizes   call Sym_35
+   168   no-op
+           optimizes   Reg_1 = Stack_D
+   168   no-op
+           optimizes   Reg_0 = Stack_D
+   168   Reg_0 = Reg_0 u> Reg_1
+   168   Stack_D = Reg_0
+   168   call Sym_8
+   168   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   168   Stack_D = Reg_0
+   168   call Sym_9
+   169   Reg_0 = 1615
+   169   Stack_D = Reg_0
+   169   call Sym_6
+   169   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   169   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   169   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   169   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   169   no-op
+           optimizes   call Sym_36
+   169   no-op
+           optimizes   Reg_1 = Stack_D
+   169   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   169   Reg_0 = Reg_0 u<= Reg_1
+   169   Stack_D = Reg_0
+   169   call Sym_8
+   169   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   169   Stack_D = Reg_0
+   169   call Sym_9
+   170   Reg_0 = 1616
+   170   Stack_D = Reg_0
+   170   call Sym_6
+   170   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   170   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   170   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   170   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   170   no-op
+           optimizes   call Sym_36
+   170   no-op
+           optimizes   Reg_1 = Stack_D
+   170   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   170   Reg_0 = Reg_0 u<= Reg_1
+   170   Stack_D = Reg_0
+   170   call Sym_8
+   170   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   170   Stack_D = Reg_0
+   170   call Sym_9
+   171   Reg_0 = 1617
+   171   Stack_D = Reg_0
+   171   call Sym_6
+   171   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   171   no-op
+           optimizes   Stack_D = Reg_0
+   171   no-op
+           optimizes   Reg_0 = *(Sym_24)
+   171   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   171   no-op
+           optimizes   call Sym_36
+   171   no-op
+           optimizes   Reg_1 = Stack_D
+   171   no-op
+           optimizes   Reg_0 = Stack_D
+   171   Reg_0 = Reg_0 u<= Reg_1
+   171   Stack_D = Reg_0
+   171   call Sym_8
+   171   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   171   Stack_D = Reg_0
+   171   call Sym_9
+   172   Reg_0 = 1618
+   172   Stack_D = Reg_0
+   172   call Sym_6
+   172   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   172   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   172   Reg_0 = 0
+   172   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_36
+   172   no-op
+           optimizes   Reg_1 = Stack_D
+   172   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   172   Reg_0 = Reg_0 u<= Reg_1
+   172   Stack_D = Reg_0
+   172   call Sym_8
+   172   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   172   Stack_D = Reg_0
+   172   call Sym_9
+   173   Reg_0 = 1619
+   173   Stack_D = Reg_0
+   173   call Sym_6
+   173   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   173   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   173   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   173   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   173   no-op
+           optimizes   call Sym_37
+   173   no-op
+           optimizes   Reg_1 = Stack_D
+   173   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   173   Reg_0 = Reg_0 u>= Reg_1
+   173   Stack_D = Reg_0
+   173   call Sym_8
+   173   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   173   Stack_D = Reg_0
+   173   call Sym_9
+   174   Reg_0 = 1620
+   174   Stack_D = Reg_0
+   174   call Sym_6
+   174   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   174   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   174   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   174   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   174   no-op
+           optimizes   call Sym_37
+   174   no-op
+           optimizes   Reg_1 = Stack_D
+   174   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   174   Reg_0 = Reg_0 u>= Reg_1
+   174   Stack_D = Reg_0
+   174   call Sym_8
+   174   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   174   Stack_D = Reg_0
+   174   call Sym_9
+   175   Reg_0 = 1621
+   175   Stack_D = Reg_0
+   175   call Sym_6
+   175   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   175   no-op
+           optimizes   Stack_D = Reg_0
+   175   no-op
+           optimizes   Reg_0 = *(Sym_24)
+   175   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   175   no-op
+           optimizes   call Sym_37
+   175   no-op
+           optimizes   Reg_1 = Stack_D
+   175   no-op
+           optimizes   Reg_0 = Stack_D
+   175   Reg_0 = Reg_0 u>= Reg_1
+   175   Stack_D = Reg_0
+   175   call Sym_8
+   175   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   175   Stack_D = Reg_0
+   175   call Sym_9
+   176   Reg_0 = 1622
+   176   Stack_D = Reg_0
+   176   call Sym_6
+   176   Reg_0 = 0
+   176   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   176   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   176   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   176   no-op
+           optimizes   call Sym_37
+   176   no-op
+           optimizes   Reg_1 = Stack_D
+   176   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   176   Reg_0 = Reg_0 u>= Reg_1
+   176   Stack_D = Reg_0
+   176   call Sym_8
+   176   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   176   Stack_D = Reg_0
+   176   call Sym_9
+   177   Reg_0 = 1623
+   177   Stack_D = Reg_0
+   177   call Sym_6
+   177   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   177   Stack_D = Reg_0
+   177   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   177   Stack_D = Reg_0
+   177   Reg_0 = Sym_35
+   177   Stack_D = Reg_0
+   177   call Sym_38
+   177   call Sym_8
+   177   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   177   Stack_D = Reg_0
+   177   call Sym_9
+   178   Reg_0 = 1624
+   178   Stack_D = Reg_0
+   178   call Sym_6
+   178   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   178   Stack_D = Reg_0
+   178   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   178   Stack_D = Reg_0
+   178   Reg_0 = Sym_35
+   178   Stack_D = Reg_0
+   178   call Sym_38
+   178   call Sym_8
+   178   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   178   Stack_D = Reg_0
+   178   call Sym_9
+   179   Reg_0 = 1625
+   179   Stack_D = Reg_0
+   179   call Sym_6
+   179   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   179   Stack_D = Reg_0
+   179   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   179   Stack_D = Reg_0
+   179   Reg_0 = Sym_36
+   179   Stack_D = Reg_0
+   179   call Sym_38
+   179   call Sym_8
+   179   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   179   Stack_D = Reg_0
+   179   call Sym_9
+   180   Reg_0 = 1626
+   180   Stack_D = Reg_0
+   180   call Sym_6
+   180   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   180   Stack_D = Reg_0
+   180   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   180   Stack_D = Reg_0
+   180   Reg_0 = Sym_36
+   180   Stack_D = Reg_0
+   180   call Sym_38
+   180   call Sym_8
+   180   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   180   Stack_D = Reg_0
+   180   call Sym_9
+   181   Reg_0 = 1627
+   181   Stack_D = Reg_0
+   181   call Sym_6
+   181   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   181   Stack_D = Reg_0
+   181   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   181   Stack_D = Reg_0
+   181   Reg_0 = Sym_37
+   181   Stack_D = Reg_0
+   181   call Sym_38
+   181   call Sym_8
+   181   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   181   Stack_D = Reg_0
+   181   call Sym_9
+   182   Reg_0 = 1628
+   182   Stack_D = Reg_0
+   182   call Sym_6
+   182   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   182   Stack_D = Reg_0
+   182   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   182   Stack_D = Reg_0
+   182   Reg_0 = Sym_37
+   182   Stack_D = Reg_0
+   182   call Sym_38
+   182   call Sym_8
+   182   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   182   Stack_D = Reg_0
+   182   call Sym_9
+   184   Reg_0 = 1630
+   184   Stack_D = Reg_0
+   184   call Sym_6
+   184   Reg_0 = 0
+           optimizes   Reg_0 = 0
+   184   Stack_D = Reg_0
+   184   no-op
+           optimizes   Reg_0 = 1
+   184   no-op
+           optimizes   Stack_D = Reg_0
+   184   no-op
+           optimizes   call Sym_39
+   184   call Sym_8
+   184   Reg_0 = 0
+   184   Stack_D = Reg_0
+   184   call Sym_9
+   185   Reg_0 = 1640
+   185   Stack_D = Reg_0
+   185   call Sym_6
+   185   Reg_0 = 1
+           optimizes   Reg_0 = 1
+   185   Stack_D = Reg_0
+   185   no-op
+           optimizes   Reg_0 = 2
+   185   no-op
+           optimizes   Stack_D = Reg_0
+   185   no-op
+           optimizes   call Sym_39
+   185   call Sym_8
+   185   Reg_0 = 1
+   185   Stack_D = Reg_0
+   185   call Sym_9
+   186   Reg_0 = 1650
+   186   Stack_D = Reg_0
+   186   call Sym_6
+   186   Reg_0 = -1
+           optimizes   Reg_0 = -1
+   186   Stack_D = Reg_0
+   186   no-op
+           optimizes   Reg_0 = 0
+   186   no-op
+           optimizes   Stack_D = Reg_0
+   186   no-op
+           optimizes   call Sym_39
+   186   call Sym_8
+   186   Reg_0 = -1
+   186   Stack_D = Reg_0
+   186   call Sym_9
+   187   Reg_0 = 1660
+   187   Stack_D = Reg_0
+   187   call Sym_6
+   187   Reg_0 = -1
+           optimizes   Reg_0 = -1
+   187   Stack_D = Reg_0
+   187   no-op
+           optimizes   Reg_0 = 1
+   187   no-op
+           optimizes   Stack_D = Reg_0
+   187   no-op
+           optimizes   call Sym_39
+   187   call Sym_8
+   187   Reg_0 = -1
+   187   Stack_D = Reg_0
+   187   call Sym_9
+   188   Reg_0 = 1670
+   188   Stack_D = Reg_0
+   188   call Sym_6
+   188   Reg_0 = -2147483648
+           optimizes   Reg_0 = -2147483648
+   188   Stack_D = Reg_0
+   188   no-op
+           optimizes   Reg_0 = 0
+   188   no-op
+           optimizes   Stack_D = Reg_0
+   188   no-op
+           optimizes   call Sym_39
+   188   call Sym_8
+   188   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   188   Stack_D = Reg_0
+   188   call Sym_9
+   189   Reg_0 = 1680
+   189   Stack_D = Reg_0
+   189   call Sym_6
+   189   Reg_0 = -2147483648
+           optimizes   Reg_0 = -2147483648
+   189   Stack_D = Reg_0
+   189   no-op
+           optimizes   Reg_0 = 2147483647
+   189   no-op
+           optimizes   Stack_D = Reg_0
+   189   no-op
+           optimizes   call Sym_39
+   189   call Sym_8
+   189   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   189   Stack_D = Reg_0
+   189   call Sym_9
+   190   Reg_0 = 1690
+   190   Stack_D = Reg_0
+   190   call Sym_6
+   190   Reg_0 = 0
+           optimizes   Reg_0 = 0
+   190   Stack_D = Reg_0
+   190   no-op
+           optimizes   Reg_0 = 2147483647
+   190   no-op
+           optimizes   Stack_D = Reg_0
+   190   no-op
+           optimizes   call Sym_39
+   190   call Sym_8
+   190   Reg_0 = 0
+   190   Stack_D = Reg_0
+   190   call Sym_9
+   191   Reg_0 = 1700
+   191   Stack_D = Reg_0
+   191   call Sym_6
+   191   Reg_0 = 0
+           optimizes   Reg_0 = 0
+   191   Stack_D = Reg_0
+   191   no-op
+           optimizes   Reg_0 = 0
+   191   no-op
+           optimizes   Stack_D = Reg_0
+   191   no-op
+           optimizes   call Sym_39
+   191   call Sym_8
+   191   Reg_0 = 0
+   191   Stack_D = Reg_0
+   191   call Sym_9
+   192   Reg_0 = 1710
+   192   Stack_D = Reg_0
+   192   call Sym_6
+   192   Reg_0 = 1
+           optimizes   Reg_0 = 1
+   192   Stack_D = Reg_0
+   192   no-op
+           optimizes   Reg_0 = 1
+   192   no-op
+           optimizes   Stack_D = Reg_0
+   192   no-op
+           optimizes   call Sym_39
+   192   call Sym_8
+   192   Reg_0 = 1
+   192   Stack_D = Reg_0
+   192   call Sym_9
+   193   Reg_0 = 1720
+   193   Stack_D = Reg_0
+   193   call Sym_6
+   193   Reg_0 = 0
+           optimizes   Reg_0 = 1
+   193   Stack_D = Reg_0
+   193   no-op
+           optimizes   Reg_0 = 0
+   193   no-op
+           optimizes   Stack_D = Reg_0
+   193   no-op
+           optimizes   call Sym_39
+   193   call Sym_8
+   193   Reg_0 = 0
+   193   Stack_D = Reg_0
+   193   call Sym_9
+   194   Reg_0 = 1730
+   194   Stack_D = Reg_0
+   194   call Sym_6
+   194   Reg_0 = 1
+           optimizes   Reg_0 = 2
+   194   Stack_D = Reg_0
+   194   no-op
+           optimizes   Reg_0 = 1
+   194   no-op
+           optimizes   Stack_D = Reg_0
+   194   no-op
+           optimizes   call Sym_39
+   194   call Sym_8
+   194   Reg_0 = 1
+   194   Stack_D = Reg_0
+   194   call Sym_9
+   195   Reg_0 = 1740
+   195   Stack_D = Reg_0
+   195   call Sym_6
+   195   Reg_0 = -1
+           optimizes   Reg_0 = 0
+   195   Stack_D = Reg_0
+   195   no-op
+           optimizes   Reg_0 = -1
+   195   no-op
+           optimizes   Stack_D = Reg_0
+   195   no-op
+           optimizes   call Sym_39
+   195   call Sym_8
+   195   Reg_0 = -1
+   195   Stack_D = Reg_0
+   195   call Sym_9
+   196   Reg_0 = 1750
+   196   Stack_D = Reg_0
+   196   call Sym_6
+   196   Reg_0 = -1
+           optimizes   Reg_0 = 1
+   196   Stack_D = Reg_0
+   196   no-op
+           optimizes   Reg_0 = -1
+   196   no-op
+           optimizes   Stack_D = Reg_0
+   196   no-op
+           optimizes   call Sym_39
+   196   call Sym_8
+   196   Reg_0 = -1
+   196   Stack_D = Reg_0
+   196   call Sym_9
+   197   Reg_0 = 1760
+   197   Stack_D = Reg_0
+   197   call Sym_6
+   197   Reg_0 = -2147483648
+           optimizes   Reg_0 = 0
+   197   Stack_D = Reg_0
+   197   no-op
+           optimizes   Reg_0 = -2147483648
+   197   no-op
+           optimizes   Stack_D = Reg_0
+   197   no-op
+           optimizes   call Sym_39
+   197   call Sym_8
+   197   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   197   Stack_D = Reg_0
+   197   call Sym_9
+   198   Reg_0 = 1770
+   198   Stack_D = Reg_0
+   198   call Sym_6
+   198   Reg_0 = -2147483648
+           optimizes   Reg_0 = 2147483647
+   198   Stack_D = Reg_0
+   198   no-op
+           optimizes   Reg_0 = -2147483648
+   198   no-op
+           optimizes   Stack_D = Reg_0
+   198   no-op
+           optimizes   call Sym_39
+   198   call Sym_8
+   198   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   198   Stack_D = Reg_0
+   198   call Sym_9
+   199   Reg_0 = 1780
+   199   Stack_D = Reg_0
+   199   call Sym_6
+   199   Reg_0 = 0
+           optimizes   Reg_0 = 2147483647
+   199   Stack_D = Reg_0
+   199   no-op
+           optimizes   Reg_0 = 0
+   199   no-op
+           optimizes   Stack_D = Reg_0
+   199   no-op
+           optimizes   call Sym_39
+   199   call Sym_8
+   199   Reg_0 = 0
+   199   Stack_D = Reg_0
+   199   call Sym_9
+   201   Reg_0 = 1800
+   201   Stack_D = Reg_0
+   201   call Sym_6
+   201   Reg_0 = 1
+           optimizes   Reg_0 = 0
+   201   Stack_D = Reg_0
+   201   no-op
+           optimizes   Reg_0 = 1
+   201   no-op
+           optimizes   Stack_D = Reg_0
+   201   no-op
+           optimizes   call Sym_40
+   201   call Sym_8
+   201   Reg_0 = 1
+   201   Stack_D = Reg_0
+   201   call Sym_9
+   202   Reg_0 = 1810
+   202   Stack_D = Reg_0
+   202   call Sym_6
+   202   Reg_0 = 2
+           optimizes   Reg_0 = 1
+   202   Stack_D = Reg_0
+   202   no-op
+           optimizes   Reg_0 = 2
+   202   no-op
+           optimizes   Stack_D = Reg_0
+   202   no-op
+           optimizes   call Sym_40
+   202   call Sym_8
+   202   Reg_0 = 2
+   202   Stack_D = Reg_0
+   202   call Sym_9
+   203   Reg_0 = 1820
+   203   Stack_D = Reg_0
+   203   call Sym_6
+   203   Reg_0 = 0
+           optimizes   Reg_0 = -1
+   203   Stack_D = Reg_0
+   203   no-op
+           optimizes   Reg_0 = 0
+   203   no-op
+           optimizes   Stack_D = Reg_0
+   203   no-op
+           optimizes   call Sym_40
+   203   call Sym_8
+   203   Reg_0 = 0
+   203   Stack_D = Reg_0
+   203   call Sym_9
+   204   Reg_0 = 1830
+   204   Stack_D = Reg_0
+   204   call Sym_6
+   204   Reg_0 = 1
+           optimizes   Reg_0 = -1
+   204   Stack_D = Reg_0
+   204   no-op
+           optimizes   Reg_0 = 1
+   204   no-op
+           optimizes   Stack_D = Reg_0
+   204   no-op
+           optimizes   call Sym_40
+   204   call Sym_8
+   204   Reg_0 = 1
+   204   Stack_D = Reg_0
+   204   call Sym_9
+   205   Reg_0 = 1840
+   205   Stack_D = Reg_0
+   205   call Sym_6
+   205   Reg_0 = 0
+           optimizes   Reg_0 = -2147483648
+   205   Stack_D = Reg_0
+   205   no-op
+           optimizes   Reg_0 = 0
+   205   no-op
+           optimizes   Stack_D = Reg_0
+   205   no-op
+           optimizes   call Sym_40
+   205   call Sym_8
+   205   Reg_0 = 0
+   205   Stack_D = Reg_0
+   205   call Sym_9
+   206   Reg_0 = 1850
+   206   Stack_D = Reg_0
+   206   call Sym_6
+   206   Reg_0 = 2147483647
+           optimizes   Reg_0 = -2147483648
+   206   Stack_D = Reg_0
+   206   no-op
+           optimizes   Reg_0 = 2147483647
+   206   no-op
+           optimizes   Stack_D = Reg_0
+   206   no-op
+           optimizes   call Sym_40
+   206   call Sym_8
+   206   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   206   Stack_D = Reg_0
+   206   call Sym_9
+   207   Reg_0 = 1860
+   207   Stack_D = Reg_0
+   207   call Sym_6
+   207   Reg_0 = 2147483647
+           optimizes   Reg_0 = 0
+   207   Stack_D = Reg_0
+   207   no-op
+           optimizes   Reg_0 = 2147483647
+   207   no-op
+           optimizes   Stack_D = Reg_0
+   207   no-op
+           optimizes   call Sym_40
+   207   call Sym_8
+   207   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   207   Stack_D = Reg_0
+   207   call Sym_9
+   208   Reg_0 = 1870
+   208   Stack_D = Reg_0
+   208   call Sym_6
+   208   Reg_0 = 0
+           optimizes   Reg_0 = 0
+   208   Stack_D = Reg_0
+   208   no-op
+           optimizes   Reg_0 = 0
+   208   no-op
+           optimizes   Stack_D = Reg_0
+   208   no-op
+           optimizes   call Sym_40
+   208   call Sym_8
+   208   Reg_0 = 0
+   208   Stack_D = Reg_0
+   208   call Sym_9
+   209   Reg_0 = 1880
+   209   Stack_D = Reg_0
+   209   call Sym_6
+   209   Reg_0 = 1
+           optimizes   Reg_0 = 1
+   209   Stack_D = Reg_0
+   209   no-op
+           optimizes   Reg_0 = 1
+   209   no-op
+           optimizes   Stack_D = Reg_0
+   209   no-op
+           optimizes   call Sym_40
+   209   call Sym_8
+   209   Reg_0 = 1
+   209   Stack_D = Reg_0
+   209   call Sym_9
+   210   Reg_0 = 1890
+   210   Stack_D = Reg_0
+   210   call Sym_6
+   210   Reg_0 = 1
+           optimizes   Reg_0 = 1
+   210   Stack_D = Reg_0
+   210   no-op
+           optimizes   Reg_0 = 0
+   210   no-op
+           optimizes   Stack_D = Reg_0
+   210   no-op
+           optimizes   call Sym_40
+   210   call Sym_8
+   210   Reg_0 = 1
+   210   Stack_D = Reg_0
+   210   call Sym_9
+   211   Reg_0 = 1900
+   211   Stack_D = Reg_0
+   211   call Sym_6
+   211   Reg_0 = 2
+           optimizes   Reg_0 = 2
+   211   Stack_D = Reg_0
+   211   no-op
+           optimizes   Reg_0 = 1
+   211   no-op
+           optimizes   Stack_D = Reg_0
+   211   no-op
+           optimizes   call Sym_40
+   211   call Sym_8
+   211   Reg_0 = 2
+   211   Stack_D = Reg_0
+   211   call Sym_9
+   212   Reg_0 = 1910
+   212   Stack_D = Reg_0
+   212   call Sym_6
+   212   Reg_0 = 0
+           optimizes   Reg_0 = 0
+   212   Stack_D = Reg_0
+   212   no-op
+           optimizes   Reg_0 = -1
+   212   no-op
+           optimizes   Stack_D = Reg_0
+   212   no-op
+           optimizes   call Sym_40
+   212   call Sym_8
+   212   Reg_0 = 0
+   212   Stack_D = Reg_0
+   212   call Sym_9
+   213   Reg_0 = 1920
+   213   Stack_D = Reg_0
+   213   call Sym_6
+   213   Reg_0 = 1
+           optimizes   Reg_0 = 1
+   213   Stack_D = Reg_0
+   213   no-op
+           optimizes   Reg_0 = -1
+   213   no-op
+           optimizes   Stack_D = Reg_0
+   213   no-op
+           optimizes   call Sym_40
+   213   call Sym_8
+   213   Reg_0 = 1
+   213   Stack_D = Reg_0
+   213   call Sym_9
+   214   Reg_0 = 1930
+   214   Stack_D = Reg_0
+   214   call Sym_6
+   214   Reg_0 = 0
+           optimizes   Reg_0 = 0
+   214   Stack_D = Reg_0
+   214   no-op
+           optimizes   Reg_0 = -2147483648
+   214   no-op
+           optimizes   Stack_D = Reg_0
+   214   no-op
+           optimizes   call Sym_40
+   214   call Sym_8
+   214   Reg_0 = 0
+   214   Stack_D = Reg_0
+   214   call Sym_9
+   215   Reg_0 = 1940
+   215   Stack_D = Reg_0
+   215   call Sym_6
+   215   Reg_0 = 2147483647
+           optimizes   Reg_0 = 2147483647
+   215   Stack_D = Reg_0
+   215   no-op
+           optimizes   Reg_0 = -2147483648
+   215   no-op
+           optimizes   Stack_D = Reg_0
+   215   no-op
+           optimizes   call Sym_40
+   215   call Sym_8
+   215   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   215   Stack_D = Reg_0
+   215   call Sym_9
+   216   Reg_0 = 1950
+   216   Stack_D = Reg_0
+   216   call Sym_6
+   216   Reg_0 = 2147483647
+           optimizes   Reg_0 = 2147483647
+   216   Stack_D = Reg_0
+   216   no-op
+           optimizes   Reg_0 = 0
+   216   no-op
+           optimizes   Stack_D = Reg_0
+   216   no-op
+           optimizes   call Sym_40
+   216   call Sym_8
+   216   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   216   Stack_D = Reg_0
+   216   call Sym_9
+   219   Reg_0 = Data_4
+   219   Stack_D = Reg_0
+   219   Reg_0 = 27
+   219   Stack_D = Reg_0
+   219   call Sym_0
+   219   call Sym_2
+   232   Reg_0 = 1960
+   232   Stack_D = Reg_0
+   232   call Sym_6
+   232   Reg_0 = 2147483647
+   232   Stack_D = Reg_0
+   232   call Sym_8
+   232   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   232   Stack_D = Reg_0
+   232   call Sym_9
+   233   Reg_0 = 1961
+   233   Stack_D = Reg_0
+   233   call Sym_6
+   233   Reg_0 = -2147483648
+   233   Stack_D = Reg_0
+   233   call Sym_8
+   233   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   233   Stack_D = Reg_0
+   233   call Sym_9
+   234   Reg_0 = 1962
+   234   Stack_D = Reg_0
+   234   call Sym_6
+   234   Reg_0 = -1
+   234   Stack_D = Reg_0
+   234   call Sym_8
+   234   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   234   Stack_D = Reg_0
+   234   call Sym_9
+   235   Reg_0 = 1963
+   235   Stack_D = Reg_0
+   235   call Sym_6
+   235   Reg_0 = -1
+   235   Stack_D = Reg_0
+   235   call Sym_8
+   235   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   235   Stack_D = Reg_0
+   235   call Sym_9
+   236   Reg_0 = 1964
+   236   Stack_D = Reg_0
+   236   call Sym_6
+   236   Reg_0 = -2147483648
+           optimizes   Reg_0 = 2147483647
+   236   Stack_D = Reg_0
+   236   no-op
+           optimizes   call Sym_41
+   236   call Sym_8
+   236   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   236   Stack_D = Reg_0
+   236   call Sym_9
+   240   Reg_0 = Data_5
+   240   Stack_D = Reg_0
+   240   Reg_0 = 75
+   240   Stack_D = Reg_0
+   240   call Sym_0
+   240   call Sym_2
+   242   Reg_0 = 2000
+   242   Stack_D = Reg_0
+   242   call Sym_6
+   242   Reg_0 = 1
+   242   Stack_D = Reg_0
+   242   Reg_0 = 2
+   242   Stack_D = Reg_0
+   242   call Sym_42
+   242   call Sym_8
+   242   call Sym_9
+   243   Reg_0 = 2010
+   243   Stack_D = Reg_0
+   243   call Sym_6
+   243   Reg_0 = 1
+   243   Stack_D = Reg_0
+   243   Reg_0 = 2
+   243   Stack_D = Reg_0
+   243   call Sym_43
+   243   call Sym_8
+   243   Reg_0 = 1
+   243   Stack_D = Reg_0
+   243   Reg_0 = 2
+   243   Stack_D = Reg_0
+   243   Reg_0 = 1
+   243   Stack_D = Reg_0
+   243   Reg_0 = 2
+   243   Stack_D = Reg_0
+   243   call Sym_9
+   244   Reg_0 = 2020
+   244   Stack_D = Reg_0
+   244   call Sym_6
+   244   Reg_0 = 1
+   244   Stack_D = Reg_0
+   244   Reg_0 = 2
+   244   Stack_D = Reg_0
+   244   Reg_0 = 3
+   244   Stack_D = Reg_0
+   244   Reg_0 = 4
+   244   Stack_D = Reg_0
+   244   call Sym_44
+   244   call Sym_8
+   244   Reg_0 = 1
+   244   Stack_D = Reg_0
+   244   Reg_0 = 2
+   244   Stack_D = Reg_0
+   244   Reg_0 = 3
+   244   Stack_D = Reg_0
+   244   Reg_0 = 4
+   244   Stack_D = Reg_0
+   244   Reg_0 = 1
+   244   Stack_D = Reg_0
+   244   Reg_0 = 2
+   244   Stack_D = Reg_0
+   244   call Sym_9
+   245   Reg_0 = 2030
+   245   Stack_D = Reg_0
+   245   call Sym_6
+   245   Reg_0 = 1
+   245   Stack_D = Reg_0
+   245   Reg_0 = 2
+   245   Stack_D = Reg_0
+   245   Reg_0 = 3
+   245   Stack_D = Reg_0
+   245   Reg_0 = 4
+   245   Stack_D = Reg_0
+   245   call Sym_45
+   245   call Sym_8
+   245   Reg_0 = 3
+   245   Stack_D = Reg_0
+   245   Reg_0 = 4
+   245   Stack_D = Reg_0
+   245   Reg_0 = 1
+   245   Stack_D = Reg_0
+   245   Reg_0 = 2
+   245   Stack_D = Reg_0
+   245   call Sym_9
+   246   Reg_0 = 2040
+   246   Stack_D = Reg_0
+   246   call Sym_6
+   246   Reg_0 = 0
+   246   Stack_D = Reg_0
+   246   call Sym_46
+   246   call Sym_8
+   246   Reg_0 = 0
+   246   Stack_D = Reg_0
+   246   call Sym_9
+   247   Reg_0 = 2050
+   247   Stack_D = Reg_0
+   247   call Sym_6
+   247   Reg_0 = 1
+   247   Stack_D = Reg_0
+   247   call Sym_46
+   247   call Sym_8
+   247   Reg_0 = 1
+   247   Stack_D = Reg_0
+   247   Reg_0 = 1
+   247   Stack_D = Reg_0
+   247   call Sym_9
+   248   Reg_0 = 2060
+   248   Stack_D = Reg_0
+   248   call Sym_6
+   248   Reg_0 = -1
+   248   Stack_D = Reg_0
+   248   call Sym_46
+   248   call Sym_8
+   248   Reg_0 = -1
+   248   Stack_D = Reg_0
+   248   Reg_0 = -1
+   248   Stack_D = Reg_0
+   248   call Sym_9
+   249   Reg_0 = 2070
+   249   Stack_D = Reg_0
+   249   call Sym_6
+   249   call Sym_47
+   249   call Sym_8
+   249   Reg_0 = 0
+   249   Stack_D = Reg_0
+   249   call Sym_9
+   250   Reg_0 = 2080
+   250   Stack_D = Reg_0
+   250   call Sym_6
+   250   Reg_0 = 0
+   250   Stack_D = Reg_0
+   250   call Sym_47
+   250   call Sym_8
+   250   Reg_0 = 0
+   250   Stack_D = Reg_0
+   250   Reg_0 = 1
+   250   Stack_D = Reg_0
+   250   call Sym_9
+   251   Reg_0 = 2090
+   251   Stack_D = Reg_0
+   251   call Sym_6
+   251   Reg_0 = 0
+   251   Stack_D = Reg_0
+   251   Reg_0 = 1
+   251   Stack_D = Reg_0
+   251   call Sym_47
+   251   call Sym_8
+   251   Reg_0 = 0
+   251   Stack_D = Reg_0
+   251   Reg_0 = 1
+   251   Stack_D = Reg_0
+   251   Reg_0 = 2
+   251   Stack_D = Reg_0
+   251   call Sym_9
+   252   Reg_0 = 2100
+   252   Stack_D = Reg_0
+   252   call Sym_6
+   252   Reg_0 = 0
+   252   Stack_D = Reg_0
+   252   call Sym_48
+   252   call Sym_8
+   252   call Sym_9
+   253   Reg_0 = 2110
+   253   Stack_D = Reg_0
+   253   call Sym_6
+   253   Reg_0 = 1
+   253   Stack_D = Reg_0
+   253   Reg_0 = 2
+   253   Stack_D = Reg_0
+   253   call Sym_48
+   253   call Sym_8
+   253   Reg_0 = 1
+   253   Stack_D = Reg_0
+   253   call Sym_9
+   254   Reg_0 = 2120
+   254   Stack_D = Reg_0
+   254   call Sym_6
+   254   Reg_0 = 1
+   254   Stack_D = Reg_0
+   254   call Sym_16
+   254   call Sym_8
+   254   Reg_0 = 1
+   254   Stack_D = Reg_0
+   254   Reg_0 = 1
+   254   Stack_D = Reg_0
+   254   call Sym_9
+   255   Reg_0 = 2130
+   255   Stack_D = Reg_0
+   255   call Sym_6
+   255   Reg_0 = 1
+   255   Stack_D = Reg_0
+   255   Reg_0 = 2
+   255   Stack_D = Reg_0
+   255   call Sym_49
+   255   call Sym_8
+   255   Reg_0 = 1
+   255   Stack_D = Reg_0
+   255   Reg_0 = 2
+   255   Stack_D = Reg_0
+   255   Reg_0 = 1
+   255   Stack_D = Reg_0
+   255   call Sym_9
+   256   Reg_0 = 2140
+   256   Stack_D = Reg_0
+   256   call Sym_6
+   256   Reg_0 = 1
+   256   Stack_D = Reg_0
+   256   Reg_0 = 2
+   256   Stack_D = Reg_0
+   256   Reg_0 = 3
+   256   Stack_D = Reg_0
+   256   call Sym_50
+   256   call Sym_8
+   256   Reg_0 = 2
+   256   Stack_D = Reg_0
+   256   Reg_0 = 3
+   256   Stack_D = Reg_0
+   256   Reg_0 = 1
+   256   Stack_D = Reg_0
+   256   call Sym_9
+   257   Reg_0 = 2150
+   257   Stack_D = Reg_0
+   257   call Sym_6
+   257   Reg_0 = 1
+   257   Stack_D = Reg_0
+   257   Reg_0 = 2
+   257   Stack_D = Reg_0
+   257   call Sym_51
+   257   call Sym_8
+   257   Reg_0 = 2
+   257   Stack_D = Reg_0
+   257   Reg_0 = 1
+   257   Stack_D = Reg_0
+   257   call Sym_9
+   260   Reg_0 = Data_6
+   260   Stack_D = Reg_0
+   260   Reg_0 = 16
+   260   Stack_D = Reg_0
+   260   call Sym_0
+   260   call Sym_2
+   262   Reg_0 = 2200
+   262   Stack_D = Reg_0
+   262   call Sym_6
+   262   call Sym_8
+   262   call Sym_9
+   263   Reg_0 = 2210
+   263   Stack_D = Reg_0
+   263   call Sym_6
+   263   call Sym_8
+   263   call Sym_9
+   264   Reg_0 = 2220
+   264   Stack_D = Reg_0
+   264   call Sym_6
+   264   Reg_0 = 123
+   264   Stack_D = Reg_0
+   264   no-op
+           optimizes   call Sym_52
+   262   call Sym_53
+   262   call Sym_54
+   264   call Sym_8
+   264   Reg_0 = 123
+   264   Stack_D = Reg_0
+   264   call Sym_9
+   265   Reg_0 = 2230
+   265   Stack_D = Reg_0
+   265   call Sym_6
+   265   Reg_0 = 123
+   265   Stack_D = Reg_0
+   265   no-op
+           optimizes   call Sym_55
+   263   call Sym_53
+   263   call Sym_56
+   263   call Sym_54
+   263   call Sym_48
+   265   call Sym_8
+   265   Reg_0 = 123
+   265   Stack_D = Reg_0
+   265   call Sym_9
+   268   Reg_0 = Data_7
+   268   Stack_D = Reg_0
+   268   Reg_0 = 42
+   268   Stack_D = Reg_0
+   268   call Sym_0
+   268   call Sym_2
+   270   Reg_0 = 2280
+   270   Stack_D = Reg_0
+   270   call Sym_6
+   270   Reg_0 = 5
+           optimizes   Reg_0 = 0
+   270   Stack_D = Reg_0
+   270   no-op
+           optimizes   Reg_0 = 5
+   270   no-op
+           optimizes   Stack_D = Reg_0
+   270   no-op
+           optimizes   call Sym_57
+   270   call Sym_8
+   270   Reg_0 = 5
+   270   Stack_D = Reg_0
+   270   call Sym_9
+   271   Reg_0 = 2290
+   271   Stack_D = Reg_0
+   271   call Sym_6
+   271   Reg_0 = 5
+           optimizes   Reg_0 = 5
+   271   Stack_D = Reg_0
+   271   no-op
+           optimizes   Reg_0 = 0
+   271   no-op
+           optimizes   Stack_D = Reg_0
+   271   no-op
+           optimizes   call Sym_57
+   271   call Sym_8
+   271   Reg_0 = 5
+   271   Stack_D = Reg_0
+   271   call Sym_9
+   272   Reg_0 = 2300
+   272   Stack_D = Reg_0
+   272   call Sym_6
+   272   Reg_0 = -5
+           optimizes   Reg_0 = 0
+   272   Stack_D = Reg_0
+   272   no-op
+           optimizes   Reg_0 = -5
+   272   no-op
+           optimizes   Stack_D = Reg_0
+   272   no-op
+           optimizes   call Sym_57
+   272   call Sym_8
+   272   Reg_0 = -5
+   272   Stack_D = Reg_0
+   272   call Sym_9
+   273   Reg_0 = 2310
+   273   Stack_D = Reg_0
+   273   call Sym_6
+   273   Reg_0 = -5
+           optimizes   Reg_0 = -5
+   273   Stack_D = Reg_0
+   273   no-op
+           optimizes   Reg_0 = 0
+   273   no-op
+           optimizes   Stack_D = Reg_0
+   273   no-op
+           optimizes   call Sym_57
+   273   call Sym_8
+   273   Reg_0 = -5
+   273   Stack_D = Reg_0
+   273   call Sym_9
+   274   Reg_0 = 2320
+   274   Stack_D = Reg_0
+   274   call Sym_6
+   274   Reg_0 = 3
+           optimizes   Reg_0 = 1
+   274   Stack_D = Reg_0
+   274   no-op
+           optimizes   Reg_0 = 2
+   274   no-op
+           optimizes   Stack_D = Reg_0
+   274   no-op
+           optimizes   call Sym_57
+   274   call Sym_8
+   274   Reg_0 = 3
+   274   Stack_D = Reg_0
+   274   call Sym_9
+   275   Reg_0 = 2330
+   275   Stack_D = Reg_0
+   275   call Sym_6
+   275   Reg_0 = -1
+           optimizes   Reg_0 = 1
+   275   Stack_D = Reg_0
+   275   no-op
+           optimizes   Reg_0 = -2
+   275   no-op
+           optimizes   Stack_D = Reg_0
+   275   no-op
+           optimizes   call Sym_57
+   275   call Sym_8
+   275   Reg_0 = -1
+   275   Stack_D = Reg_0
+   275   call Sym_9
+   276   Reg_0 = 2340
+   276   Stack_D = Reg_0
+   276   call Sym_6
+   276   Reg_0 = 1
+           optimizes   Reg_0 = -1
+   276   Stack_D = Reg_0
+   276   no-op
+           optimizes   Reg_0 = 2
+   276   no-op
+           optimizes   Stack_D = Reg_0
+   276   no-op
+           optimizes   call Sym_57
+   276   call Sym_8
+   276   Reg_0 = 1
+   276   Stack_D = Reg_0
+   276   call Sym_9
+   277   Reg_0 = 2350
+   277   Stack_D = Reg_0
+   277   call Sym_6
+   277   Reg_0 = -3
+           optimizes   Reg_0 = -1
+   277   Stack_D = Reg_0
+   277   no-op
+           optimizes   Reg_0 = -2
+   277   no-op
+           optimizes   Stack_D = Reg_0
+   277   no-op
+           optimizes   call Sym_57
+   277   call Sym_8
+   277   Reg_0 = -3
+   277   Stack_D = Reg_0
+   277   call Sym_9
+   278   Reg_0 = 2360
+   278   Stack_D = Reg_0
+   278   call Sym_6
+   278   Reg_0 = 0
+           optimizes   Reg_0 = -1
+   278   Stack_D = Reg_0
+   278   no-op
+           optimizes   Reg_0 = 1
+   278   no-op
+           optimizes   Stack_D = Reg_0
+   278   no-op
+           optimizes   call Sym_57
+   278   call Sym_8
+   278   Reg_0 = 0
+   278   Stack_D = Reg_0
+   278   call Sym_9
+   279   Reg_0 = 2370
+   279   Stack_D = Reg_0
+   279   call Sym_6
+   279   Reg_0 = -2147483648
+           optimizes   Reg_0 = 2147483647
+   279   Stack_D = Reg_0
+   279   no-op
+           optimizes   Reg_0 = 1
+   279   no-op
+           optimizes   Stack_D = Reg_0
+   279   no-op
+           optimizes   call Sym_57
+   279   call Sym_8
+   279   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   279   Stack_D = Reg_0
+   279   call Sym_9
+   281   Reg_0 = 2390
+   281   Stack_D = Reg_0
+   281   call Sym_6
+   281   Reg_0 = -5
+           optimizes   Reg_0 = 0
+   281   Stack_D = Reg_0
+   281   no-op
+           optimizes   Reg_0 = 5
+   281   no-op
+           optimizes   Stack_D = Reg_0
+   281   no-op
+           optimizes   call Sym_58
+   281   call Sym_8
+   281   Reg_0 = -5
+   281   Stack_D = Reg_0
+   281   call Sym_9
+   282   Reg_0 = 2400
+   282   Stack_D = Reg_0
+   282   call Sym_6
+   282   Reg_0 = 5
+           optimizes   Reg_0 = 5
+   282   Stack_D = Reg_0
+   282   no-op
+           optimizes   Reg_0 = 0
+   282   no-op
+           optimizes   Stack_D = Reg_0
+   282   no-op
+           optimizes   call Sym_58
+   282   call Sym_8
+   282   Reg_0 = 5
+   282   Stack_D = Reg_0
+   282   call Sym_9
+   283   Reg_0 = 2410
+   283   Stack_D = Reg_0
+   283   call Sym_6
+   283   Reg_0 = 5
+           optimizes   Reg_0 = 0
+   283   Stack_D = Reg_0
+   283   no-op
+           optimizes   Reg_0 = -5
+   283   no-op
+           optimizes   Stack_D = Reg_0
+   283   no-op
+           optimizes   call Sym_58
+   283   call Sym_8
+   283   Reg_0 = 5
+   283   Stack_D = Reg_0
+   283   call Sym_9
+   284   Reg_0 = 2420
+   284   Stack_D = Reg_0
+   284   call Sym_6
+   284   Reg_0 = -5
+           optimizes   Reg_0 = -5
+   284   Stack_D = Reg_0
+   284   no-op
+           optimizes   Reg_0 = 0
+   284   no-op
+           optimizes   Stack_D = Reg_0
+   284   no-op
+           optimizes   call Sym_58
+   284   call Sym_8
+   284   Reg_0 = -5
+   284   Stack_D = Reg_0
+   284   call Sym_9
+   285   Reg_0 = 2430
+   285   Stack_D = Reg_0
+   285   call Sym_6
+   285   Reg_0 = -1
+           optimizes   Reg_0 = 1
+   285   Stack_D = Reg_0
+   285   no-op
+           optimizes   Reg_0 = 2
+   285   no-op
+           optimizes   Stack_D = Reg_0
+   285   no-op
+           optimizes   call Sym_58
+   285   call Sym_8
+   285   Reg_0 = -1
+   285   Stack_D = Reg_0
+   285   call Sym_9
+   286   Reg_0 = 2440
+   286   Stack_D = Reg_0
+   286   call Sym_6
+   286   Reg_0 = 3
+           optimizes   Reg_0 = 1
+   286   Stack_D = Reg_0
+   286   no-op
+           optimizes   Reg_0 = -2
+   286   no-op
+           optimizes   Stack_D = Reg_0
+   286   no-op
+           optimizes   call Sym_58
+   286   call Sym_8
+   286   Reg_0 = 3
+   286   Stack_D = Reg_0
+   286   call Sym_9
+   287   Reg_0 = 2450
+   287   Stack_D = Reg_0
+   287   call Sym_6
+   287   Reg_0 = -3
+           optimizes   Reg_0 = -1
+   287   Stack_D = Reg_0
+   287   no-op
+           optimizes   Reg_0 = 2
+   287   no-op
+           optimizes   Stack_D = Reg_0
+   287   no-op
+           optimizes   call Sym_58
+   287   call Sym_8
+   287   Reg_0 = -3
+   287   Stack_D = Reg_0
+   287   call Sym_9
+   288   Reg_0 = 2460
+   288   Stack_D = Reg_0
+   288   call Sym_6
+   288   Reg_0 = 1
+           optimizes   Reg_0 = -1
+   288   Stack_D = Reg_0
+   288   no-op
+           optimizes   Reg_0 = -2
+   288   no-op
+           optimizes   Stack_D = Reg_0
+   288   no-op
+           optimizes   call Sym_58
+   288   call Sym_8
+   288   Reg_0 = 1
+   288   Stack_D = Reg_0
+   288   call Sym_9
+   289   Reg_0 = 2470
+   289   Stack_D = Reg_0
+   289   call Sym_6
+   289   Reg_0 = -1
+           optimizes   Reg_0 = 0
+   289   Stack_D = Reg_0
+   289   no-op
+           optimizes   Reg_0 = 1
+   289   no-op
+           optimizes   Stack_D = Reg_0
+   289   no-op
+           optimizes   call Sym_58
+   289   call Sym_8
+   289   Reg_0 = -1
+   289   Stack_D = Reg_0
+   289   call Sym_9
+   290   Reg_0 = 2480
+   290   Stack_D = Reg_0
+   290   call Sym_6
+   290   Reg_0 = 2147483647
+           optimizes   Reg_0 = -2147483648
+   290   Stack_D = Reg_0
+   290   no-op
+           optimizes   Reg_0 = 1
+   290   no-op
+           optimizes   Stack_D = Reg_0
+   290   no-op
+           optimizes   call Sym_58
+   290   call Sym_8
+   290   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   290   Stack_D = Reg_0
+   290   call Sym_9
+   292   Reg_0 = 2500
+   292   Stack_D = Reg_0
+   292   call Sym_6
+   292   Reg_0 = 1
+           optimizes   Reg_0 = 0
+   292   Stack_D = Reg_0
+   292   no-op
+           optimizes   call Sym_41
+   292   call Sym_8
+   292   Reg_0 = 1
+   292   Stack_D = Reg_0
+   292   call Sym_9
+   293   Reg_0 = 2510
+   293   Stack_D = Reg_0
+   293   call Sym_6
+   293   Reg_0 = 0
+           optimizes   Reg_0 = -1
+   293   Stack_D = Reg_0
+   293   no-op
+           optimizes   call Sym_41
+   293   call Sym_8
+   293   Reg_0 = 0
+   293   Stack_D = Reg_0
+   293   call Sym_9
+   294   Reg_0 = 2520
+   294   Stack_D = Reg_0
+   294   call Sym_6
+   294   Reg_0 = 2
+           optimizes   Reg_0 = 1
+   294   Stack_D = Reg_0
+   294   no-op
+           optimizes   call Sym_41
+   294   call Sym_8
+   294   Reg_0 = 2
+   294   Stack_D = Reg_0
+   294   call Sym_9
+   295   Reg_0 = 2530
+   295   Stack_D = Reg_0
+   295   call Sym_6
+   295   Reg_0 = -2147483648
+           optimizes   Reg_0 = 2147483647
+   295   Stack_D = Reg_0
+   295   no-op
+           optimizes   call Sym_41
+   295   call Sym_8
+   295   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   295   Stack_D = Reg_0
+   295   call Sym_9
+   297   Reg_0 = 2550
+   297   Stack_D = Reg_0
+   297   call Sym_6
+   297   Reg_0 = 1
+           optimizes   Reg_0 = 2
+   297   Stack_D = Reg_0
+   297   no-op
+           optimizes   call Sym_59
+   297   call Sym_8
+   297   Reg_0 = 1
+   297   Stack_D = Reg_0
+   297   call Sym_9
+   298   Reg_0 = 2560
+   298   Stack_D = Reg_0
+   298   call Sym_6
+   298   Reg_0 = 0
+           optimizes   Reg_0 = 1
+   298   Stack_D = Reg_0
+   298   no-op
+           optimizes   call Sym_59
+   298   call Sym_8
+   298   Reg_0 = 0
+   298   Stack_D = Reg_0
+   298   call Sym_9
+   299   Reg_0 = 2570
+   299   Stack_D = Reg_0
+   299   call Sym_6
+   299   Reg_0 = -1
+           optimizes   Reg_0 = 0
+   299   Stack_D = Reg_0
+   299   no-op
+           optimizes   call Sym_59
+   299   call Sym_8
+   299   Reg_0 = -1
+   299   Stack_D = Reg_0
+   299   call Sym_9
+   300   Reg_0 = 2580
+   300   Stack_D = Reg_0
+   300   call Sym_6
+   300   Reg_0 = 2147483647
+           optimizes   Reg_0 = -2147483648
+   300   Stack_D = Reg_0
+   300   no-op
+           optimizes   call Sym_59
+   300   call Sym_8
+   300   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   300   Stack_D = Reg_0
+   300   call Sym_9
+   302   Reg_0 = 2600
+   302   Stack_D = Reg_0
+   302   call Sym_6
+   302   Reg_0 = 0
+           optimizes   Reg_0 = 0
+   302   Stack_D = Reg_0
+   302   no-op
+           optimizes   call Sym_60
+   302   call Sym_8
+   302   Reg_0 = 0
+   302   Stack_D = Reg_0
+   302   call Sym_9
+   303   Reg_0 = 2610
+   303   Stack_D = Reg_0
+   303   call Sym_6
+   303   Reg_0 = -1
+           optimizes   Reg_0 = 1
+   303   Stack_D = Reg_0
+   303   no-op
+           optimizes   call Sym_60
+   303   call Sym_8
+   303   Reg_0 = -1
+   303   Stack_D = Reg_0
+   303   call Sym_9
+   304   Reg_0 = 2620
+   304   Stack_D = Reg_0
+   304   call Sym_6
+   304   Reg_0 = 1
+           optimizes   Reg_0 = -1
+   304   Stack_D = Reg_0
+   304   no-op
+           optimizes   call Sym_60
+   304   call Sym_8
+   304   Reg_0 = 1
+   304   Stack_D = Reg_0
+   304   call Sym_9
+   305   Reg_0 = 2630
+   305   Stack_D = Reg_0
+   305   call Sym_6
+   305   Reg_0 = -2
+           optimizes   Reg_0 = 2
+   305   Stack_D = Reg_0
+   305   no-op
+           optimizes   call Sym_60
+   305   call Sym_8
+   305   Reg_0 = -2
+   305   Stack_D = Reg_0
+   305   call Sym_9
+   306   Reg_0 = 2640
+   306   Stack_D = Reg_0
+   306   call Sym_6
+   306   Reg_0 = 2
+           optimizes   Reg_0 = -2
+   306   Stack_D = Reg_0
+   306   no-op
+           optimizes   call Sym_60
+   306   call Sym_8
+   306   Reg_0 = 2
+   306   Stack_D = Reg_0
+   306   call Sym_9
+   308   Reg_0 = 2660
+   308   Stack_D = Reg_0
+   308   call Sym_6
+   308   Reg_0 = 0
+           optimizes   Reg_0 = 0
+   308   Stack_D = Reg_0
+   308   no-op
+           optimizes   call Sym_61
+   308   call Sym_8
+   308   Reg_0 = 0
+   308   Stack_D = Reg_0
+   308   call Sym_9
+   309   Reg_0 = 2670
+   309   Stack_D = Reg_0
+   309   call Sym_6
+   309   Reg_0 = 1
+           optimizes   Reg_0 = 1
+   309   Stack_D = Reg_0
+   309   no-op
+           optimizes   call Sym_61
+   309   call Sym_8
+   309   Reg_0 = 1
+   309   Stack_D = Reg_0
+   309   call Sym_9
+   310   Reg_0 = 2680
+   310   Stack_D = Reg_0
+   310   call Sym_6
+   310   Reg_0 = 1
+           optimizes   Reg_0 = -1
+   310   Stack_D = Reg_0
+   310   no-op
+           optimizes   call Sym_61
+   310   call Sym_8
+   310   Reg_0 = 1
+   310   Stack_D = Reg_0
+   310   call Sym_9
+   311   Reg_0 = 2690
+   311   Stack_D = Reg_0
+   311   call Sym_6
+   311   Reg_0 = -2147483648
+           optimizes   Reg_0 = -2147483648
+   311   Stack_D = Reg_0
+   311   no-op
+           optimizes   call Sym_61
+   311   call Sym_8
+   311   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   311   Stack_D = Reg_0
+   311   call Sym_9
+   314   Reg_0 = Data_8
+   314   Stack_D = Reg_0
+   314   Reg_0 = 30
+   314   Stack_D = Reg_0
+   314   call Sym_0
+   314   call Sym_2
+   316   Reg_0 = 2740
+   316   Stack_D = Reg_0
+   316   call Sym_6
+   316   Reg_0 = 0
+   316   Stack_D = Reg_0
+   316   call Sym_62
+   316   call Sym_8
+   316   Reg_0 = 0
+   316   Stack_D = Reg_0
+   316   Reg_0 = 0
+   316   Stack_D = Reg_0
+   316   call Sym_9
+   317   Reg_0 = 2750
+   317   Stack_D = Reg_0
+   317   call Sym_6
+   317   Reg_0 = 1
+   317   Stack_D = Reg_0
+   317   call Sym_62
+   317   call Sym_8
+   317   Reg_0 = 1
+   317   Stack_D = Reg_0
+   317   Reg_0 = 0
+   317   Stack_D = Reg_0
+   317   call Sym_9
+   318   Reg_0 = 2760
+   318   Stack_D = Reg_0
+   318   call Sym_6
+   318   Reg_0 = 2
+   318   Stack_D = Reg_0
+   318   call Sym_62
+   318   call Sym_8
+   318   Reg_0 = 2
+   318   Stack_D = Reg_0
+   318   Reg_0 = 0
+   318   Stack_D = Reg_0
+   318   call Sym_9
+   319   Reg_0 = 2770
+   319   Stack_D = Reg_0
+   319   call Sym_6
+   319   Reg_0 = -1
+   319   Stack_D = Reg_0
+   319   call Sym_62
+   319   call Sym_8
+   319   Reg_0 = -1
+   319   Stack_D = Reg_0
+   319   Reg_0 = -1
+   319   Stack_D = Reg_0
+   319   call Sym_9
+   320   Reg_0 = 2780
+   320   Stack_D = Reg_0
+   320   call Sym_6
+   320   Reg_0 = -2
+   320   Stack_D = Reg_0
+   320   call Sym_62
+   320   call Sym_8
+   320   Reg_0 = -2
+   320   Stack_D = Reg_0
+   320   Reg_0 = -1
+   320   Stack_D = Reg_0
+   320   call Sym_9
+   321   Reg_0 = 2790
+   321   Stack_D = Reg_0
+   321   call Sym_6
+   321   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   321   Stack_D = Reg_0
+   321   call Sym_62
+   321   call Sym_8
+   321   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   321   Stack_D = Reg_0
+   321   Reg_0 = -1
+   321   Stack_D = Reg_0
+   321   call Sym_9
+   322   Reg_0 = 2800
+   322   Stack_D = Reg_0
+   322   call Sym_6
+   322   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   322   Stack_D = Reg_0
+   322   call Sym_62
+   322   call Sym_8
+   322   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   322   Stack_D = Reg_0
+   322   Reg_0 = 0
+   322   Stack_D = Reg_0
+   322   call Sym_9
+   324   Reg_0 = 2820
+   324   Stack_D = Reg_0
+   324   call Sym_6
+   324   Reg_0 = 0
+   324   Stack_D = Reg_0
+   324   Reg_0 = 0
+   324   Stack_D = Reg_0
+   324   call Sym_63
+   324   call Sym_8
+   324   Reg_0 = 0
+   324   Stack_D = Reg_0
+   324   call Sym_62
+   324   call Sym_9
+   325   Reg_0 = 2830
+   325   Stack_D = Reg_0
+   325   call Sym_6
+   325   Reg_0 = 0
+   325   Stack_D = Reg_0
+   325   Reg_0 = 1
+   325   Stack_D = Reg_0
+   325   call Sym_63
+   325   call Sym_8
+   325   Reg_0 = 0
+   325   Stack_D = Reg_0
+   325   call Sym_62
+   325   call Sym_9
+   326   Reg_0 = 2840
+   326   Stack_D = Reg_0
+   326   call Sym_6
+   326   Reg_0 = 1
+   326   Stack_D = Reg_0
+   326   Reg_0 = 0
+   326   Stack_D = Reg_0
+   326   call Sym_63
+   326   call Sym_8
+   326   Reg_0 = 0
+   326   Stack_D = Reg_0
+   326   call Sym_62
+   326   call Sym_9
+   327   Reg_0 = 2850
+   327   Stack_D = Reg_0
+   327   call Sym_6
+   327   Reg_0 = 1
+   327   Stack_D = Reg_0
+   327   Reg_0 = 2
+   327   Stack_D = Reg_0
+   327   call Sym_63
+   327   call Sym_8
+   327   Reg_0 = 2
+   327   Stack_D = Reg_0
+   327   call Sym_62
+   327   call Sym_9
+   328   Reg_0 = 2860
+   328   Stack_D = Reg_0
+   328   call Sym_6
+   328   Reg_0 = 2
+   328   Stack_D = Reg_0
+   328   Reg_0 = 1
+   328   Stack_D = Reg_0
+   328   call Sym_63
+   328   call Sym_8
+   328   Reg_0 = 2
+   328   Stack_D = Reg_0
+   328   call Sym_62
+   328   call Sym_9
+   329   Reg_0 = 2870
+   329   Stack_D = Reg_0
+   329   call Sym_6
+   329   Reg_0 = 3
+   329   Stack_D = Reg_0
+   329   Reg_0 = 3
+   329   Stack_D = Reg_0
+   329   call Sym_63
+   329   call Sym_8
+   329   Reg_0 = 9
+   329   Stack_D = Reg_0
+   329   call Sym_62
+   329   call Sym_9
+   330   Reg_0 = 2880
+   330   Stack_D = Reg_0
+   330   call Sym_6
+   330   Reg_0 = -3
+   330   Stack_D = Reg_0
+   330   Reg_0 = 3
+   330   Stack_D = Reg_0
+   330   call Sym_63
+   330   call Sym_8
+   330   Reg_0 = -9
+   330   Stack_D = Reg_0
+   330   call Sym_62
+   330   call Sym_9
+   331   Reg_0 = 2890
+   331   Stack_D = Reg_0
+   331   call Sym_6
+   331   Reg_0 = 3
+   331   Stack_D = Reg_0
+   331   Reg_0 = -3
+   331   Stack_D = Reg_0
+   331   call Sym_63
+   331   call Sym_8
+   331   Reg_0 = -9
+   331   Stack_D = Reg_0
+   331   call Sym_62
+   331   call Sym_9
+   332   Reg_0 = 2900
+   332   Stack_D = Reg_0
+   332   call Sym_6
+   332   Reg_0 = -3
+   332   Stack_D = Reg_0
+   332   Reg_0 = -3
+   332   Stack_D = Reg_0
+   332   call Sym_63
+   332   call Sym_8
+   332   Reg_0 = 9
+   332   Stack_D = Reg_0
+   332   call Sym_62
+   332   call Sym_9
+   333   Reg_0 = 2910
+   333   Stack_D = Reg_0
+   333   call Sym_6
+   333   Reg_0 = 0
+   333   Stack_D = Reg_0
+   333   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   333   Stack_D = Reg_0
+   333   call Sym_63
+   333   call Sym_8
+   333   Reg_0 = 0
+   333   Stack_D = Reg_0
+   333   call Sym_62
+   333   call Sym_9
+   334   Reg_0 = 2920
+   334   Stack_D = Reg_0
+   334   call Sym_6
+   334   Reg_0 = 1
+   334   Stack_D = Reg_0
+   334   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   334   Stack_D = Reg_0
+   334   call Sym_63
+   334   call Sym_8
+   334   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   334   Stack_D = Reg_0
+   334   call Sym_62
+   334   call Sym_9
+   335   Reg_0 = 2930
+   335   Stack_D = Reg_0
+   335   call Sym_6
+   335   Reg_0 = 2
+   335   Stack_D = Reg_0
+   335   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   335   Stack_D = Reg_0
+   335   call Sym_63
+   335   call Sym_8
+   335   Reg_0 = 0
+   335   Stack_D = Reg_0
+   335   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+   335   Stack_D = Reg_0
+   335   call Sym_9
+   336   Reg_0 = 2940
+   336   Stack_D = Reg_0
+   336   call Sym_6
+   336   Reg_0 = 0
+   336   Stack_D = Reg_0
+   336   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   336   Stack_D = Reg_0
+   336   call Sym_63
+   336   call Sym_8
+   336   Reg_0 = 0
+   336   Stack_D = Reg_0
+   336   call Sym_62
+   336   call Sym_9
+   337   Reg_0 = 2950
+   337   Stack_D = Reg_0
+   337   call Sym_6
+   337   Reg_0 = 1
+   337   Stack_D = Reg_0
+   337   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   337   Stack_D = Reg_0
+   337   call Sym_63
+   337   call Sym_8
+   337   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   337   Stack_D = Reg_0
+   337   call Sym_62
+   337   call Sym_9
+   338   Reg_0 = 2960
+   338   Stack_D = Reg_0
+   338   call Sym_6
+   338   Reg_0 = 2
+   338   Stack_D = Reg_0
+   338   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   338   Stack_D = Reg_0
+   338   call Sym_63
+   338   call Sym_8
+   338   Reg_0 = -2
+           optimizes   Reg_0 = 2147483647
+   338   Stack_D = Reg_0
+   338   no-op
+           optimizes   Reg_0 = 1
+   338   no-op
+           optimizes   Stack_D = Reg_0
+   338   no-op
+           optimizes   call Sym_20
+   338   Reg_0 = 0
+   338   Stack_D = Reg_0
+   338   call Sym_9
+   339   Reg_0 = 2970
+   339   Stack_D = Reg_0
+   339   call Sym_6
+   339   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   339   Stack_D = Reg_0
+   339   no-op
+           optimizes   Reg_0 = *(Sym_24)
+   339   Stack_D = Reg_0
+   339   call Sym_63
+   339   call Sym_8
+   339   Reg_0 = 0
+   339   Stack_D = Reg_0
+   339   Reg_0 = *(Sym_18)
+   339   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   339   Reg_0 = 1
+   339   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   339   no-op
+           optimizes   call Sym_21
+   339   no-op
+           optimizes   Reg_1 = Stack_D
+   339   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   339   Reg_0 >>= Reg_1
+   339   Stack_D = Reg_0
+   339   call Sym_9
+   340   Reg_0 = 2980
+   340   Stack_D = Reg_0
+   340   call Sym_6
+   340   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   340   Stack_D = Reg_0
+   340   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   340   Stack_D = Reg_0
+   340   call Sym_63
+   340   call Sym_8
+   340   Reg_0 = *(Sym_18)
+   340   Stack_D = Reg_0
+   340   no-op
+           optimizes   Reg_0 = *(Sym_18)
+   340   Stack_D = Reg_0
+   340   call Sym_19
+   340   call Sym_9
+   341   Reg_0 = 2990
+   341   Stack_D = Reg_0
+   341   call Sym_6
+   341   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   341   Stack_D = Reg_0
+   341   no-op
+           optimizes   Reg_0 = *(Sym_23)
+   341   Stack_D = Reg_0
+   341   call Sym_63
+   341   call Sym_8
+   341   Reg_0 = 1
+   341   Stack_D = Reg_0
+   341   Reg_0 = *(Sym_18)
+   341   Stack_D = Reg_0
+   341   call Sym_19
+   341   no-op
+           optimizes   call Sym_10
+   341   Reg_0 = Stack_D
+   341   Reg_0 = ~Reg_0
+   341   Stack_D = Reg_0
+   341   call Sym_9
+   343   Reg_0 = 3010
+   343   Stack_D = Reg_0
+   343   call Sym_6
+   343   Reg_0 = 0
+           optimizes   Reg_0 = 0
+   343   Stack_D = Reg_0
+   343   no-op
+           optimizes   Reg_0 = 0
+   343   no-op
+           optimizes   Stack_D = Reg_0
+   343   no-op
+           optimizes   call Sym_64
+   343   call Sym_8
+   343   Reg_0 = 0
+   343   Stack_D = Reg_0
+   343   call Sym_9
+   344   Reg_0 = 3020
+   344   Stack_D = Reg_0
+   344   call Sym_6
+   344   Reg_0 = 0
+           optimizes   Reg_0 = 0
+   344   Stack_D = Reg_0
+   344   no-op
+           optimizes   Reg_0 = 1
+   344   no-op
+           optimizes   Stack_D = Reg_0
+   344   no-op
+           optimizes   call Sym_64
+   344   call Sym_8
+   344   Reg_0 = 0
+   344   Stack_D = Reg_0
+   344   call Sym_9
+   345   Reg_0 = 3030
+   345   Stack_D = Reg_0
+   345   call Sym_6
+   345   Reg_0 = 0
+           optimizes   Reg_0 = 1
+   345   Stack_D = Reg_0
+   345   no-op
+           optimizes   Reg_0 = 0
+   345   no-op
+           optimizes   Stack_D = Reg_0
+   345   no-op
+           optimizes   call Sym_64
+   345   call Sym_8
+   345   Reg_0 = 0
+   345   Stack_D = Reg_0
+   345   call Sym_9
+   346   Reg_0 = 3040
+   346   Stack_D = Reg_0
+   346   call Sym_6
+   346   Reg_0 = 2
+           optimizes   Reg_0 = 1
+   346   Stack_D = Reg_0
+   346   no-op
+           optimizes   Reg_0 = 2
+   346   no-op
+           optimizes   Stack_D = Reg_0
+   346   no-op
+           optimizes   call Sym_64
+   346   call Sym_8
+   346   Reg_0 = 2
+   346   Stack_D = Reg_0
+   346   call Sym_9
+   347   Reg_0 = 3050
+   347   Stack_D = Reg_0
+   347   call Sym_6
+   347   Reg_0 = 2
+           optimizes   Reg_0 = 2
+   347   Stack_D = Reg_0
+   347   no-op
+           optimizes   Reg_0 = 1
+   347   no-op
+           optimizes   Stack_D = Reg_0
+   347   no-op
+           optimizes   call Sym_64
+   347   call Sym_8
+   347   Reg_0 = 2
+   347   Stack_D = Reg_0
+   347   call Sym_9
+   348   Reg_0 = 3060
+   348   Stack_D = Reg_0
+   348   call Sym_6
+   348   Reg_0 = 9
+           optimizes   Reg_0 = 3
+   348   Stack_D = Reg_0
+   348   no-op
+           optimizes   Reg_0 = 3
+   348   no-op
+           optimizes   Stack_D = Reg_0
+   348   no-op
+           optimizes   call Sym_64
+   348   call Sym_8
+   348   Reg_0 = 9
+   348   Stack_D = Reg_0
+   348   call Sym_9
+   349   Reg_0 = 3070
+   349   Stack_D = Reg_0
+   349   call Sym_6
+   349   Reg_0 = -9
+           optimizes   Reg_0 = -3
+   349   Stack_D = Reg_0
+   349   no-op
+           optimizes   Reg_0 = 3
+   349   no-op
+           optimizes   Stack_D = Reg_0
+   349   no-op
+           optimizes   call Sym_64
+   349   call Sym_8
+   349   Reg_0 = -9
+   349   Stack_D = Reg_0
+   349   call Sym_9
+   350   Reg_0 = 3080
+   350   Stack_D = Reg_0
+   350   call Sym_6
+   350   Reg_0 = -9
+           optimizes   Reg_0 = 3
+   350   Stack_D = Reg_0
+   350   no-op
+           optimizes   Reg_0 = -3
+   350   no-op
+           optimizes   Stack_D = Reg_0
+   350   no-op
+           optimizes   call Sym_64
+   350   call Sym_8
+   350   Reg_0 = -9
+   350   Stack_D = Reg_0
+   350   call Sym_9
+   351   Reg_0 = 3090
+   351   Stack_D = Reg_0
+   351   call Sym_6
+   351   Reg_0 = 9
+           optimizes   Reg_0 = -3
+   351   Stack_D = Reg_0
+   351   no-op
+           optimizes   Reg_0 = -3
+   351   no-op
+           optimizes   Stack_D = Reg_0
+   351   no-op
+           optimizes   call Sym_64
+   351   call Sym_8
+   351   Reg_0 = 9
+   351   Stack_D = Reg_0
+   351   call Sym_9
+   353   Reg_0 = 3110
+   353   Stack_D = Reg_0
+   353   call Sym_6
+   353   Reg_0 = -2147483648
+           optimizes   Reg_0 = 1073741824
+   353   Stack_D = Reg_0
+   353   no-op
+           optimizes   Reg_0 = 1
+   353   no-op
+           optimizes   Stack_D = Reg_0
+   353   no-op
+           optimizes   call Sym_21
+   353   no-op
+           optimizes   Reg_0 = 2
+   353   no-op
+           optimizes   Stack_D = Reg_0
+   353   no-op
+           optimizes   call Sym_64
+   353   call Sym_8
+   353   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   353   Stack_D = Reg_0
+   353   call Sym_9
+   354   Reg_0 = 3120
+   354   Stack_D = Reg_0
+   354   call Sym_6
+   354   Reg_0 = -2147483648
+           optimizes   Reg_0 = 536870912
+   354   Stack_D = Reg_0
+   354   no-op
+           optimizes   Reg_0 = 2
+   354   no-op
+           optimizes   Stack_D = Reg_0
+   354   no-op
+           optimizes   call Sym_21
+   354   no-op
+           optimizes   Reg_0 = 4
+   354   no-op
+           optimizes   Stack_D = Reg_0
+   354   no-op
+           optimizes   call Sym_64
+   354   call Sym_8
+   354   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   354   Stack_D = Reg_0
+   354   call Sym_9
+   355   Reg_0 = 3130
+   355   Stack_D = Reg_0
+   355   call Sym_6
+   355   Reg_0 = -2147483648
+           optimizes   Reg_0 = -1073741824
+   355   Stack_D = Reg_0
+   355   no-op
+           optimizes   Reg_0 = 1
+   355   no-op
+           optimizes   Stack_D = Reg_0
+   355   no-op
+           optimizes   call Sym_21
+   355   no-op
+           optimizes   Reg_0 = -2147483648
+   355   no-op
+           optimizes   Stack_D = Reg_0
+   355   no-op
+           optimizes   call Sym_13
+   355   no-op
+           optimizes   Reg_0 = 2
+   355   no-op
+           optimizes   Stack_D = Reg_0
+   355   no-op
+           optimizes   call Sym_64
+   355   call Sym_8
+   355   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   355   Stack_D = Reg_0
+   355   call Sym_9
+   357   Reg_0 = 3150
+   357   Stack_D = Reg_0
+   357   call Sym_6
+   357   Reg_0 = 0
+   357   Stack_D = Reg_0
+   357   Reg_0 = 0
+   357   Stack_D = Reg_0
+   357   call Sym_65
+   357   call Sym_8
+   357   Reg_0 = 0
+   357   Stack_D = Reg_0
+   357   Reg_0 = 0
+   357   Stack_D = Reg_0
+   357   call Sym_9
+   358   Reg_0 = 3160
+   358   Stack_D = Reg_0
+   358   call Sym_6
+   358   Reg_0 = 0
+   358   Stack_D = Reg_0
+   358   Reg_0 = 1
+   358   Stack_D = Reg_0
+   358   call Sym_65
+   358   call Sym_8
+   358   Reg_0 = 0
+   358   Stack_D = Reg_0
+   358   Reg_0 = 0
+   358   Stack_D = Reg_0
+   358   call Sym_9
+   359   Reg_0 = 3170
+   359   Stack_D = Reg_0
+   359   call Sym_6
+   359   Reg_0 = 1
+   359   Stack_D = Reg_0
+   359   Reg_0 = 0
+   359   Stack_D = Reg_0
+   359   call Sym_65
+   359   call Sym_8
+   359   Reg_0 = 0
+   359   Stack_D = Reg_0
+   359   Reg_0 = 0
+   359   Stack_D = Reg_0
+   359   call Sym_9
+   360   Reg_0 = 3180
+   360   Stack_D = Reg_0
+   360   call Sym_6
+   360   Reg_0 = 1
+   360   Stack_D = Reg_0
+   360   Reg_0 = 2
+   360   Stack_D = Reg_0
+   360   call Sym_65
+   360   call Sym_8
+   360   Reg_0 = 2
+   360   Stack_D = Reg_0
+   360   Reg_0 = 0
+   360   Stack_D = Reg_0
+   360   call Sym_9
+   361   Reg_0 = 3190
+   361   Stack_D = Reg_0
+   361   call Sym_6
+   361   Reg_0 = 2
+   361   Stack_D = Reg_0
+   361   Reg_0 = 1
+   361   Stack_D = Reg_0
+   361   call Sym_65
+   361   call Sym_8
+   361   Reg_0 = 2
+   361   Stack_D = Reg_0
+   361   Reg_0 = 0
+   361   Stack_D = Reg_0
+   361   call Sym_9
+   362   Reg_0 = 3200
+   362   Stack_D = Reg_0
+   362   call Sym_6
+   362   Reg_0 = 3
+   362   Stack_D = Reg_0
+   362   Reg_0 = 3
+   362   Stack_D = Reg_0
+   362   call Sym_65
+   362   call Sym_8
+   362   Reg_0 = 9
+   362   Stack_D = Reg_0
+   362   Reg_0 = 0
+   362   Stack_D = Reg_0
+   362   call Sym_9
+   364   Reg_0 = 3220
+   364   Stack_D = Reg_0
+   364   call Sym_6
+   364   Reg_0 = 1073741824
+           optimizes   Reg_0 = -2147483648
+   364   Stack_D = Reg_0
+   364   no-op
+           optimizes   Reg_0 = 1
+   364   no-op
+           optimizes   Stack_D = Reg_0
+   364   no-op
+           optimizes   call Sym_21
+   364   Reg_0 = 2
+   364   Stack_D = Reg_0
+   364   call Sym_65
+   364   call Sym_8
+   364   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   364   Stack_D = Reg_0
+   364   Reg_0 = 0
+   364   Stack_D = Reg_0
+   364   call Sym_9
+   365   Reg_0 = 3230
+   365   Stack_D = Reg_0
+   365   call Sym_6
+   365   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   365   Stack_D = Reg_0
+   365   Reg_0 = 2
+   365   Stack_D = Reg_0
+   365   call Sym_65
+   365   call Sym_8
+   365   Reg_0 = 0
+   365   Stack_D = Reg_0
+   365   Reg_0 = 1
+   365   Stack_D = Reg_0
+   365   call Sym_9
+   366   Reg_0 = 3240
+   366   Stack_D = Reg_0
+   366   call Sym_6
+   366   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   366   Stack_D = Reg_0
+   366   Reg_0 = 4
+   366   Stack_D = Reg_0
+   366   call Sym_65
+   366   call Sym_8
+   366   Reg_0 = 0
+   366   Stack_D = Reg_0
+   366   Reg_0 = 2
+   366   Stack_D = Reg_0
+   366   call Sym_9
+   367   Reg_0 = 3250
+   367   Stack_D = Reg_0
+   367   call Sym_6
+   367   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+   367   Stack_D = Reg_0
+   367   Reg_0 = 2
+   367   Stack_D = Reg_0
+   367   call Sym_65
+   367   call Sym_8
+   367   Reg_0 = -2
+           optimizes   Reg_0 = -1
+   367   Stack_D = Reg_0
+   367   no-op
+           optimizes   Reg_0 = 1
+   367   no-op
+           optimizes   Stack_D = Reg_0
+   367   no-op
+           optimizes   call Sym_20
+   367   Reg_0 = 1
+   367   Stack_D = Reg_0
+   367   call Sym_9
+   368   Reg_0 = 3260
+   368   Stack_D = Reg_0
+   368   call Sym_6
+   368   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   368   Stack_D = Reg_0
+   368   no-op
+           optimizes   Reg_0 = *(Sym_22)
+   368   Stack_D = Reg_0
+   368   call Sym_65
+   368   call Sym_8
+   368   Reg_0 = 1
+   368   Stack_D = Reg_0
+   368   Reg_0 = -2
+           optimizes   Reg_0 = 1
+   368   Stack_D = Reg_0
+   368   no-op
+           optimizes   call Sym_10
+   368   call Sym_9
+   371   Reg_0 = Data_9
+   371   Stack_D = Reg_0
+   371   Reg_0 = 56
+   371   Stack_D = Reg_0
+   371   call Sym_0
+   371   call Sym_2
+   373   Reg_0 = 3310
+   373   Stack_D = Reg_0
+   373   call Sym_6
+   373   Reg_0 = 0
+   373   Stack_D = Reg_0
+   373   call Sym_62
+   373   Reg_0 = 1
+   373   Stack_D = Reg_0
+   373   call Sym_66
+   373   call Sym_8
+   373   Reg_0 = 0
+   373   Stack_D = Reg_0
+   373   Reg_0 = 0
+   373   Stack_D = Reg_0
+   373   call Sym_9
+   374   Reg_0 = 3320
+   374   Stack_D = Reg_0
+   374   call Sym_6
+   374   Reg_0 = 1
+   374   Stack_D = Reg_0
+   374   call Sym_62
+   374   Reg_0 = 1
+   374   Stack_D = Reg_0
+   374   call Sym_66
+   374   call Sym_8
+   374   Reg_0 = 0
+   374   Stack_D = Reg_0
+   374   Reg_0 = 1
+   374   Stack_D = Reg_0
+   374   call Sym_9
+   375   Reg_0 = 3330
+   375   Stack_D = Reg_0
+   375   call Sym_6
+   375   Reg_0 = 2
+   375   Stack_D = Reg_0
+   375   call Sym_62
+   375   Reg_0 = 1
+   375   Stack_D = Reg_0
+   375   call Sym_66
+   375   call Sym_8
+   375   Reg_0 = 0
+   375   Stack_D = Reg_0
+   375   Reg_0 = 2
+   375   Stack_D = Reg_0
+   375   call Sym_9
+   376   Reg_0 = 3340
+   376   Stack_D = Reg_0
+   376   call Sym_6
+   376   Reg_0 = -1
+   376   Stack_D = Reg_0
+   376   call Sym_62
+   376   Reg_0 = 1
+   376   Stack_D = Reg_0
+   376   call Sym_66
+   376   call Sym_8
+   376   Reg_0 = 0
+   376   Stack_D = Reg_0
+   376   Reg_0 = -1
+   376   Stack_D = Reg_0
+   376   call Sym_9
+   377   Reg_0 = 3350
+   377   Stack_D = Reg_0
+   377   call Sym_6
+   377   Reg_0 = -2
+   377   Stack_D = Reg_0
+   377   call Sym_62
+   377   Reg_0 = 1
+   377   Stack_D = Reg_0
+   377   call Sym_66
+   377   call Sym_8
+   377   Reg_0 = 0
+   377   Stack_D = Reg_0
+   377   Reg_0 = -2
+   377   Stack_D = Reg_0
+   377   call Sym_9
+   378   Reg_0 = 3360
+   378   Stack_D = Reg_0
+   378   call Sym_6
+   378   Reg_0 = 0
+   378   Stack_D = Reg_0
+   378   call Sym_62
+   378   Reg_0 = -1
+   378   Stack_D = Reg_0
+   378   call Sym_66
+   378   call Sym_8
+   378   Reg_0 = 0
+   378   Stack_D = Reg_0
+   378   Reg_0 = 0
+   378   Stack_D = Reg_0
+   378   call Sym_9
+   379   Reg_0 = 3370
+   379   Stack_D = Reg_0
+   379   call Sym_6
+   379   Reg_0 = 1
+   379   Stack_D = Reg_0
+   379   call Sym_62
+   379   Reg_0 = -1
+   379   Stack_D = Reg_0
+   379   call Sym_66
+   379   call Sym_8
+   379   Reg_0 = 0
+   379   Stack_D = Reg_0
+   379   Reg_0 = -1
+   379   Stack_D = Reg_0
+   379   call Sym_9
+   380   Reg_0 = 3380
+   380   Stack_D = Reg_0
+   380   call Sym_6
+   380   Reg_0 = 2
+   380   Stack_D = Reg_0
+   380   call Sym_62
+   380   Reg_0 = -1
+   380   Stack_D = Reg_0
+   380   call Sym_66
+   380   call Sym_8
+   380   Reg_0 = 0
+   380   Stack_D = Reg_0
+   380   Reg_0 = -2
+   380   Stack_D = Reg_0
+   380   call Sym_9
+   381   Reg_0 = 3390
+   381   Stack_D = Reg_0
+   381   call Sym_6
+   381   Reg_0 = -1
+   381   Stack_D = Reg_0
+   381   call Sym_62
+   381   Reg_0 = -1
+   381   Stack_D = Reg_0
+   381   call Sym_66
+   381   call Sym_8
+   381   Reg_0 = 0
+   381   Stack_D = Reg_0
+   381   Reg_0 = 1
+   381   Stack_D = Reg_0
+   381   call Sym_9
+   382   Reg_0 = 3400
+   382   Stack_D = Reg_0
+   382   call Sym_6
+   382   Reg_0 = -2
+   382   Stack_D = Reg_0
+   382   call Sym_62
+   382   Reg_0 = -1
+   382   Stack_D = Reg_0
+   382   call Sym_66
+   382   call Sym_8
+   382   Reg_0 = 0
+   382   Stack_D = Reg_0
+   382   Reg_0 = 2
+   382   Stack_D = Reg_0
+   382   call Sym_9
+   383   Reg_0 = 3410
+   383   Stack_D = Reg_0
+   383   call Sym_6
+   383   Reg_0 = 2
+   383   Stack_D = Reg_0
+   383   call Sym_62
+   383   Reg_0 = 2
+   383   Stack_D = Reg_0
+   383   call Sym_66
+   383   call Sym_8
+   383   Reg_0 = 0
+   383   Stack_D = Reg_0
+   383   Reg_0 = 1
+   383   Stack_D = Reg_0
+   383   call Sym_9
+   384   Reg_0 = 3420
+   384   Stack_D = Reg_0
+   384   call Sym_6
+   384   Reg_0 = -1
+   384   Stack_D = Reg_0
+   384   call Sym_62
+   384   Reg_0 = -1
+   384   Stack_D = Reg_0
+   384   call Sym_66
+   384   call Sym_8
+   384   Reg_0 = 0
+   384   Stack_D = Reg_0
+   384   Reg_0 = 1
+   384   Stack_D = Reg_0
+   384   call Sym_9
+   385   Reg_0 = 3430
+   385   Stack_D = Reg_0
+   385   call Sym_6
+   385   Reg_0 = -2
+   385   Stack_D = Reg_0
+   385   call Sym_62
+   385   Reg_0 = -2
+   385   Stack_D = Reg_0
+   385   call Sym_66
+   385   call Sym_8
+   385   Reg_0 = 0
+   385   Stack_D = Reg_0
+   385   Reg_0 = 1
+   385   Stack_D = Reg_0
+   385   call Sym_9
+   386   Reg_0 = 3440
+   386   Stack_D = Reg_0
+   386   call Sym_6
+   386   Reg_0 = 7
+   386   Stack_D = Reg_0
+   386   call Sym_62
+   386   Reg_0 = 3
+   386   Stack_D = Reg_0
+   386   call Sym_66
+   386   call Sym_8
+   386   Reg_0 = 1
+   386   Stack_D = Reg_0
+   386   Reg_0 = 2
+   386   Stack_D = Reg_0
+   386   call Sym_9
+   387   Reg_0 = 3450
+   387   Stack_D = Reg_0
+   387   call Sym_6
+   387   Reg_0 = 7
+   387   Stack_D = Reg_0
+   387   call Sym_62
+   387   Reg_0 = -3
+   387   Stack_D = Reg_0
+   387   call Sym_66
+   387   call Sym_8
+   387   Reg_0 = -2
+   387   Stack_D = Reg_0
+   387   Reg_0 = -3
+   387   Stack_D = Reg_0
+   387   call Sym_9
+   388   Reg_0 = 3460
+   388   Stack_D = Reg_0
+   388   call Sym_6
+   388   Reg_0 = -7
+   388   Stack_D = Reg_0
+   388   call Sym_62
+   388   Reg_0 = 3
+   388   Stack_D = Reg_0
+   388   call Sym_66
+   388   call Sym_8
+   388   Reg_0 = 2
+   388   Stack_D = Reg_0
+   388   Reg_0 = -3
+   388   Stack_D = Reg_0
+   388   call Sym_9
+   389   Reg_0 = 3470
+   389   Stack_D = Reg_0
+   389   call Sym_6
+   389   Reg_0 = -7
+   389   Stack_D = Reg_0
+   389   call Sym_62
+   389   Reg_0 = -3
+   389   Stack_D = Reg_0
+   389   call Sym_66
+   389   call Sym_8
+   389   Reg_0 = -1
+   389   Stack_D = Reg_0
+   389   Reg_0 = 2
+   389   Stack_D = Reg_0
+   389   call Sym_9
+   390   Reg_0 = 3480
+   390   Stack_D = Reg_0
+   390   call Sym_6
+   390   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   390   Stack_D = Reg_0
+   390   call Sym_62
+   390   Reg_0 = 1
+   390   Stack_D = Reg_0
+   390   call Sym_66
+   390   call Sym_8
+   390   Reg_0 = 0
+   390   Stack_D = Reg_0
+   390   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   390   Stack_D = Reg_0
+   390   call Sym_9
+   391   Reg_0 = 3490
+   391   Stack_D = Reg_0
+   391   call Sym_6
+   391   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   391   Stack_D = Reg_0
+   391   call Sym_62
+   391   Reg_0 = 1
+   391   Stack_D = Reg_0
+   391   call Sym_66
+   391   call Sym_8
+   391   Reg_0 = 0
+   391   Stack_D = Reg_0
+   391   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   391   Stack_D = Reg_0
+   391   call Sym_9
+   392   Reg_0 = 3500
+   392   Stack_D = Reg_0
+   392   call Sym_6
+   392   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   392   Stack_D = Reg_0
+   392   call Sym_62
+   392   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   392   Stack_D = Reg_0
+   392   call Sym_66
+   392   call Sym_8
+   392   Reg_0 = 0
+   392   Stack_D = Reg_0
+   392   Reg_0 = 1
+   392   Stack_D = Reg_0
+   392   call Sym_9
+   393   Reg_0 = 3510
+   393   Stack_D = Reg_0
+   393   call Sym_6
+   393   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   393   Stack_D = Reg_0
+   393   call Sym_62
+   393   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   393   Stack_D = Reg_0
+   393   call Sym_66
+   393   call Sym_8
+   393   Reg_0 = 0
+   393   Stack_D = Reg_0
+   393   Reg_0 = 1
+   393   Stack_D = Reg_0
+   393   call Sym_9
+   394   Reg_0 = 3520
+   394   Stack_D = Reg_0
+   394   call Sym_6
+   394   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+   394   Stack_D = Reg_0
+   394   Reg_0 = 1
+   394   Stack_D = Reg_0
+   394   Reg_0 = 4
+   394   Stack_D = Reg_0
+   394   call Sym_66
+   394   call Sym_8
+   394   Reg_0 = 3
+   394   Stack_D = Reg_0
+   394   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   394   Stack_D = Reg_0
+   394   call Sym_9
+   395   Reg_0 = 3530
+   395   Stack_D = Reg_0
+   395   call Sym_6
+   395   Reg_0 = 1
+   395   Stack_D = Reg_0
+   395   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   395   Stack_D = Reg_0
+   395   call Sym_63
+   395   Reg_0 = 1
+   395   Stack_D = Reg_0
+   395   call Sym_66
+   395   call Sym_8
+   395   Reg_0 = 0
+   395   Stack_D = Reg_0
+   395   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   395   Stack_D = Reg_0
+   395   call Sym_9
+   396   Reg_0 = 3540
+   396   Stack_D = Reg_0
+   396   call Sym_6
+   396   Reg_0 = 1
+   396   Stack_D = Reg_0
+   396   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   396   Stack_D = Reg_0
+   396   call Sym_63
+   396   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   396   Stack_D = Reg_0
+   396   call Sym_66
+   396   call Sym_8
+   396   Reg_0 = 0
+   396   Stack_D = Reg_0
+   396   Reg_0 = 1
+   396   Stack_D = Reg_0
+   396   call Sym_9
+   397   Reg_0 = 3550
+   397   Stack_D = Reg_0
+   397   call Sym_6
+   397   Reg_0 = 2
+   397   Stack_D = Reg_0
+   397   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   397   Stack_D = Reg_0
+   397   call Sym_63
+   397   Reg_0 = 2
+   397   Stack_D = Reg_0
+   397   call Sym_66
+   397   call Sym_8
+   397   Reg_0 = 0
+   397   Stack_D = Reg_0
+   397   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   397   Stack_D = Reg_0
+   397   call Sym_9
+   398   Reg_0 = 3560
+   398   Stack_D = Reg_0
+   398   call Sym_6
+   398   Reg_0 = 2
+   398   Stack_D = Reg_0
+   398   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   398   Stack_D = Reg_0
+   398   call Sym_63
+   398   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   398   Stack_D = Reg_0
+   398   call Sym_66
+   398   call Sym_8
+   398   Reg_0 = 0
+   398   Stack_D = Reg_0
+   398   Reg_0 = 2
+   398   Stack_D = Reg_0
+   398   call Sym_9
+   399   Reg_0 = 3570
+   399   Stack_D = Reg_0
+   399   call Sym_6
+   399   Reg_0 = 1
+   399   Stack_D = Reg_0
+   399   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   399   Stack_D = Reg_0
+   399   call Sym_63
+   399   Reg_0 = 1
+   399   Stack_D = Reg_0
+   399   call Sym_66
+   399   call Sym_8
+   399   Reg_0 = 0
+   399   Stack_D = Reg_0
+   399   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   399   Stack_D = Reg_0
+   399   call Sym_9
+   400   Reg_0 = 3580
+   400   Stack_D = Reg_0
+   400   call Sym_6
+   400   Reg_0 = 1
+   400   Stack_D = Reg_0
+   400   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   400   Stack_D = Reg_0
+   400   call Sym_63
+   400   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   400   Stack_D = Reg_0
+   400   call Sym_66
+   400   call Sym_8
+   400   Reg_0 = 0
+   400   Stack_D = Reg_0
+   400   Reg_0 = 1
+   400   Stack_D = Reg_0
+   400   call Sym_9
+   401   Reg_0 = 3590
+   401   Stack_D = Reg_0
+   401   call Sym_6
+   401   Reg_0 = 2
+   401   Stack_D = Reg_0
+   401   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   401   Stack_D = Reg_0
+   401   call Sym_63
+   401   Reg_0 = 2
+   401   Stack_D = Reg_0
+   401   call Sym_66
+   401   call Sym_8
+   401   Reg_0 = 0
+   401   Stack_D = Reg_0
+   401   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   401   Stack_D = Reg_0
+   401   call Sym_9
+   402   Reg_0 = 3600
+   402   Stack_D = Reg_0
+   402   call Sym_6
+   402   Reg_0 = 2
+   402   Stack_D = Reg_0
+   402   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   402   Stack_D = Reg_0
+   402   call Sym_63
+   402   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   402   Stack_D = Reg_0
+   402   call Sym_66
+   402   call Sym_8
+   402   Reg_0 = 0
+   402   Stack_D = Reg_0
+   402   Reg_0 = 2
+   402   Stack_D = Reg_0
+   402   call Sym_9
+   403   Reg_0 = 3610
+   403   Stack_D = Reg_0
+   403   call Sym_6
+   403   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   403   Stack_D = Reg_0
+   403   no-op
+           optimizes   Reg_0 = *(Sym_24)
+   403   Stack_D = Reg_0
+   403   call Sym_63
+   403   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   403   Stack_D = Reg_0
+   403   call Sym_66
+   403   call Sym_8
+   403   Reg_0 = 0
+   403   Stack_D = Reg_0
+   403   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   403   Stack_D = Reg_0
+   403   call Sym_9
+   404   Reg_0 = 3620
+   404   Stack_D = Reg_0
+   404   call Sym_6
+   404   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   404   Stack_D = Reg_0
+   404   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   404   Stack_D = Reg_0
+   404   call Sym_63
+   404   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   404   Stack_D = Reg_0
+   404   call Sym_66
+   404   call Sym_8
+   404   Reg_0 = 0
+   404   Stack_D = Reg_0
+   404   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   404   Stack_D = Reg_0
+   404   call Sym_9
+   405   Reg_0 = 3630
+   405   Stack_D = Reg_0
+   405   call Sym_6
+   405   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   405   Stack_D = Reg_0
+   405   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   405   Stack_D = Reg_0
+   405   call Sym_63
+   405   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   405   Stack_D = Reg_0
+   405   call Sym_66
+   405   call Sym_8
+   405   Reg_0 = 0
+   405   Stack_D = Reg_0
+   405   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   405   Stack_D = Reg_0
+   405   call Sym_9
+   406   Reg_0 = 3640
+   406   Stack_D = Reg_0
+   406   call Sym_6
+   406   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   406   Stack_D = Reg_0
+   406   no-op
+           optimizes   Reg_0 = *(Sym_23)
+   406   Stack_D = Reg_0
+   406   call Sym_63
+   406   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   406   Stack_D = Reg_0
+   406   call Sym_66
+   406   call Sym_8
+   406   Reg_0 = 0
+   406   Stack_D = Reg_0
+   406   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   406   Stack_D = Reg_0
+   406   call Sym_9
+   408   Reg_0 = 3660
+   408   Stack_D = Reg_0
+   408   call Sym_6
+   408   Reg_0 = 0
+   408   Stack_D = Reg_0
+   408   call Sym_62
+   408   Reg_0 = 1
+   408   Stack_D = Reg_0
+   408   call Sym_67
+   408   call Sym_8
+   408   Reg_0 = 0
+   408   Stack_D = Reg_0
+   408   Reg_0 = 0
+   408   Stack_D = Reg_0
+   408   call Sym_9
+   409   Reg_0 = 3670
+   409   Stack_D = Reg_0
+   409   call Sym_6
+   409   Reg_0 = 1
+   409   Stack_D = Reg_0
+   409   call Sym_62
+   409   Reg_0 = 1
+   409   Stack_D = Reg_0
+   409   call Sym_67
+   409   call Sym_8
+   409   Reg_0 = 0
+   409   Stack_D = Reg_0
+   409   Reg_0 = 1
+   409   Stack_D = Reg_0
+   409   call Sym_9
+   410   Reg_0 = 3680
+   410   Stack_D = Reg_0
+   410   call Sym_6
+   410   Reg_0 = 2
+   410   Stack_D = Reg_0
+   410   call Sym_62
+   410   Reg_0 = 1
+   410   Stack_D = Reg_0
+   410   call Sym_67
+   410   call Sym_8
+   410   Reg_0 = 0
+   410   Stack_D = Reg_0
+   410   Reg_0 = 2
+   410   Stack_D = Reg_0
+   410   call Sym_9
+   411   Reg_0 = 3690
+   411   Stack_D = Reg_0
+   411   call Sym_6
+   411   Reg_0 = -1
+   411   Stack_D = Reg_0
+   411   call Sym_62
+   411   Reg_0 = 1
+   411   Stack_D = Reg_0
+   411   call Sym_67
+   411   call Sym_8
+   411   Reg_0 = 0
+   411   Stack_D = Reg_0
+   411   Reg_0 = -1
+   411   Stack_D = Reg_0
+   411   call Sym_9
+   412   Reg_0 = 3700
+   412   Stack_D = Reg_0
+   412   call Sym_6
+   412   Reg_0 = -2
+   412   Stack_D = Reg_0
+   412   call Sym_62
+   412   Reg_0 = 1
+   412   Stack_D = Reg_0
+   412   call Sym_67
+   412   call Sym_8
+   412   Reg_0 = 0
+   412   Stack_D = Reg_0
+   412   Reg_0 = -2
+   412   Stack_D = Reg_0
+   412   call Sym_9
+   413   Reg_0 = 3710
+   413   Stack_D = Reg_0
+   413   call Sym_6
+   413   Reg_0 = 0
+   413   Stack_D = Reg_0
+   413   call Sym_62
+   413   Reg_0 = -1
+   413   Stack_D = Reg_0
+   413   call Sym_67
+   413   call Sym_8
+   413   Reg_0 = 0
+   413   Stack_D = Reg_0
+   413   Reg_0 = 0
+   413   Stack_D = Reg_0
+   413   call Sym_9
+   414   Reg_0 = 3720
+   414   Stack_D = Reg_0
+   414   call Sym_6
+   414   Reg_0 = 1
+   414   Stack_D = Reg_0
+   414   call Sym_62
+   414   Reg_0 = -1
+   414   Stack_D = Reg_0
+   414   call Sym_67
+   414   call Sym_8
+   414   Reg_0 = 0
+   414   Stack_D = Reg_0
+   414   Reg_0 = -1
+   414   Stack_D = Reg_0
+   414   call Sym_9
+   415   Reg_0 = 3730
+   415   Stack_D = Reg_0
+   415   call Sym_6
+   415   Reg_0 = 2
+   415   Stack_D = Reg_0
+   415   call Sym_62
+   415   Reg_0 = -1
+   415   Stack_D = Reg_0
+   415   call Sym_67
+   415   call Sym_8
+   415   Reg_0 = 0
+   415   Stack_D = Reg_0
+   415   Reg_0 = -2
+   415   Stack_D = Reg_0
+   415   call Sym_9
+   416   Reg_0 = 3740
+   416   Stack_D = Reg_0
+   416   call Sym_6
+   416   Reg_0 = -1
+   416   Stack_D = Reg_0
+   416   call Sym_62
+   416   Reg_0 = -1
+   416   Stack_D = Reg_0
+   416   call Sym_67
+   416   call Sym_8
+   416   Reg_0 = 0
+   416   Stack_D = Reg_0
+   416   Reg_0 = 1
+   416   Stack_D = Reg_0
+   416   call Sym_9
+   417   Reg_0 = 3750
+   417   Stack_D = Reg_0
+   417   call Sym_6
+   417   Reg_0 = -2
+   417   Stack_D = Reg_0
+   417   call Sym_62
+   417   Reg_0 = -1
+   417   Stack_D = Reg_0
+   417   call Sym_67
+   417   call Sym_8
+   417   Reg_0 = 0
+   417   Stack_D = Reg_0
+   417   Reg_0 = 2
+   417   Stack_D = Reg_0
+   417   call Sym_9
+   418   Reg_0 = 3760
+   418   Stack_D = Reg_0
+   418   call Sym_6
+   418   Reg_0 = 2
+   418   Stack_D = Reg_0
+   418   call Sym_62
+   418   Reg_0 = 2
+   418   Stack_D = Reg_0
+   418   call Sym_67
+   418   call Sym_8
+   418   Reg_0 = 0
+   418   Stack_D = Reg_0
+   418   Reg_0 = 1
+   418   Stack_D = Reg_0
+   418   call Sym_9
+   419   Reg_0 = 3770
+   419   Stack_D = Reg_0
+   419   call Sym_6
+   419   Reg_0 = -1
+   419   Stack_D = Reg_0
+   419   call Sym_62
+   419   Reg_0 = -1
+   419   Stack_D = Reg_0
+   419   call Sym_67
+   419   call Sym_8
+   419   Reg_0 = 0
+   419   Stack_D = Reg_0
+   419   Reg_0 = 1
+   419   Stack_D = Reg_0
+   419   call Sym_9
+   420   Reg_0 = 3780
+   420   Stack_D = Reg_0
+   420   call Sym_6
+   420   Reg_0 = -2
+   420   Stack_D = Reg_0
+   420   call Sym_62
+   420   Reg_0 = -2
+   420   Stack_D = Reg_0
+   420   call Sym_67
+   420   call Sym_8
+   420   Reg_0 = 0
+   420   Stack_D = Reg_0
+   420   Reg_0 = 1
+   420   Stack_D = Reg_0
+   420   call Sym_9
+   421   Reg_0 = 3790
+   421   Stack_D = Reg_0
+   421   call Sym_6
+   421   Reg_0 = 7
+   421   Stack_D = Reg_0
+   421   call Sym_62
+   421   Reg_0 = 3
+   421   Stack_D = Reg_0
+   421   call Sym_67
+   421   call Sym_8
+   421   Reg_0 = 1
+   421   Stack_D = Reg_0
+   421   Reg_0 = 2
+   421   Stack_D = Reg_0
+   421   call Sym_9
+   422   Reg_0 = 3800
+   422   Stack_D = Reg_0
+   422   call Sym_6
+   422   Reg_0 = 7
+   422   Stack_D = Reg_0
+   422   call Sym_62
+   422   Reg_0 = -3
+   422   Stack_D = Reg_0
+   422   call Sym_67
+   422   call Sym_8
+   422   Reg_0 = 1
+   422   Stack_D = Reg_0
+   422   Reg_0 = -2
+   422   Stack_D = Reg_0
+   422   call Sym_9
+   423   Reg_0 = 3810
+   423   Stack_D = Reg_0
+   423   call Sym_6
+   423   Reg_0 = -7
+   423   Stack_D = Reg_0
+   423   call Sym_62
+   423   Reg_0 = 3
+   423   Stack_D = Reg_0
+   423   call Sym_67
+   423   call Sym_8
+   423   Reg_0 = -1
+   423   Stack_D = Reg_0
+   423   Reg_0 = -2
+   423   Stack_D = Reg_0
+   423   call Sym_9
+   424   Reg_0 = 3820
+   424   Stack_D = Reg_0
+   424   call Sym_6
+   424   Reg_0 = -7
+   424   Stack_D = Reg_0
+   424   call Sym_62
+   424   Reg_0 = -3
+   424   Stack_D = Reg_0
+   424   call Sym_67
+   424   call Sym_8
+   424   Reg_0 = -1
+   424   Stack_D = Reg_0
+   424   Reg_0 = 2
+   424   Stack_D = Reg_0
+   424   call Sym_9
+   425   Reg_0 = 3830
+   425   Stack_D = Reg_0
+   425   call Sym_6
+   425   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   425   Stack_D = Reg_0
+   425   call Sym_62
+   425   Reg_0 = 1
+   425   Stack_D = Reg_0
+   425   call Sym_67
+   425   call Sym_8
+   425   Reg_0 = 0
+   425   Stack_D = Reg_0
+   425   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   425   Stack_D = Reg_0
+   425   call Sym_9
+   426   Reg_0 = 3840
+   426   Stack_D = Reg_0
+   426   call Sym_6
+   426   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   426   Stack_D = Reg_0
+   426   call Sym_62
+   426   Reg_0 = 1
+   426   Stack_D = Reg_0
+   426   call Sym_67
+   426   call Sym_8
+   426   Reg_0 = 0
+   426   Stack_D = Reg_0
+   426   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   426   Stack_D = Reg_0
+   426   call Sym_9
+   427   Reg_0 = 3850
+   427   Stack_D = Reg_0
+   427   call Sym_6
+   427   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   427   Stack_D = Reg_0
+   427   call Sym_62
+   427   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   427   Stack_D = Reg_0
+   427   call Sym_67
+   427   call Sym_8
+   427   Reg_0 = 0
+   427   Stack_D = Reg_0
+   427   Reg_0 = 1
+   427   Stack_D = Reg_0
+   427   call Sym_9
+   428   Reg_0 = 3860
+   428   Stack_D = Reg_0
+   428   call Sym_6
+   428   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   428   Stack_D = Reg_0
+   428   call Sym_62
+   428   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   428   Stack_D = Reg_0
+   428   call Sym_67
+   428   call Sym_8
+   428   Reg_0 = 0
+   428   Stack_D = Reg_0
+   428   Reg_0 = 1
+   428   Stack_D = Reg_0
+   428   call Sym_9
+   429   Reg_0 = 3870
+   429   Stack_D = Reg_0
+   429   call Sym_6
+   429   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_12)
+   429   Stack_D = Reg_0
+   429   Reg_0 = 1
+   429   Stack_D = Reg_0
+   429   Reg_0 = 4
+   429   Stack_D = Reg_0
+   429   call Sym_67
+   429   call Sym_8
+   429   Reg_0 = 3
+   429   Stack_D = Reg_0
+   429   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   429   Stack_D = Reg_0
+   429   call Sym_9
+   430   Reg_0 = 3880
+   430   Stack_D = Reg_0
+   430   call Sym_6
+   430   Reg_0 = 2
+   430   Stack_D = Reg_0
+   430   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   430   Stack_D = Reg_0
+   430   call Sym_63
+   430   Reg_0 = 2
+   430   Stack_D = Reg_0
+   430   call Sym_67
+   430   call Sym_8
+   430   Reg_0 = 0
+   430   Stack_D = Reg_0
+   430   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   430   Stack_D = Reg_0
+   430   call Sym_9
+   431   Reg_0 = 3890
+   431   Stack_D = Reg_0
+   431   call Sym_6
+   431   Reg_0 = 2
+   431   Stack_D = Reg_0
+   431   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   431   Stack_D = Reg_0
+   431   call Sym_63
+   431   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   431   Stack_D = Reg_0
+   431   call Sym_67
+   431   call Sym_8
+   431   Reg_0 = 0
+   431   Stack_D = Reg_0
+   431   Reg_0 = 2
+   431   Stack_D = Reg_0
+   431   call Sym_9
+   432   Reg_0 = 3900
+   432   Stack_D = Reg_0
+   432   call Sym_6
+   432   Reg_0 = 2
+   432   Stack_D = Reg_0
+   432   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   432   Stack_D = Reg_0
+   432   call Sym_63
+   432   Reg_0 = 2
+   432   Stack_D = Reg_0
+   432   call Sym_67
+   432   call Sym_8
+   432   Reg_0 = 0
+   432   Stack_D = Reg_0
+   432   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   432   Stack_D = Reg_0
+   432   call Sym_9
+   433   Reg_0 = 3910
+   433   Stack_D = Reg_0
+   433   call Sym_6
+   433   Reg_0 = 2
+   433   Stack_D = Reg_0
+   433   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   433   Stack_D = Reg_0
+   433   call Sym_63
+   433   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   433   Stack_D = Reg_0
+   433   call Sym_67
+   433   call Sym_8
+   433   Reg_0 = 0
+   433   Stack_D = Reg_0
+   433   Reg_0 = 2
+   433   Stack_D = Reg_0
+   433   call Sym_9
+   434   Reg_0 = 3920
+   434   Stack_D = Reg_0
+   434   call Sym_6
+   434   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   434   Stack_D = Reg_0
+   434   no-op
+           optimizes   Reg_0 = *(Sym_24)
+   434   Stack_D = Reg_0
+   434   call Sym_63
+   434   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   434   Stack_D = Reg_0
+   434   call Sym_67
+   434   call Sym_8
+   434   Reg_0 = 0
+   434   Stack_D = Reg_0
+   434   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   434   Stack_D = Reg_0
+   434   call Sym_9
+   435   Reg_0 = 3930
+   435   Stack_D = Reg_0
+   435   call Sym_6
+   435   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   435   Stack_D = Reg_0
+   435   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   435   Stack_D = Reg_0
+   435   call Sym_63
+   435   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   435   Stack_D = Reg_0
+   435   call Sym_67
+   435   call Sym_8
+   435   Reg_0 = 0
+   435   Stack_D = Reg_0
+   435   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   435   Stack_D = Reg_0
+   435   call Sym_9
+   436   Reg_0 = 3940
+   436   Stack_D = Reg_0
+   436   call Sym_6
+   436   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   436   Stack_D = Reg_0
+   436   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   436   Stack_D = Reg_0
+   436   call Sym_63
+   436   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   436   Stack_D = Reg_0
+   436   call Sym_67
+   436   call Sym_8
+   436   Reg_0 = 0
+   436   Stack_D = Reg_0
+   436   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   436   Stack_D = Reg_0
+   436   call Sym_9
+   437   Reg_0 = 3950
+   437   Stack_D = Reg_0
+   437   call Sym_6
+   437   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   437   Stack_D = Reg_0
+   437   no-op
+           optimizes   Reg_0 = *(Sym_23)
+   437   Stack_D = Reg_0
+   437   call Sym_63
+   437   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   437   Stack_D = Reg_0
+   437   call Sym_67
+   437   call Sym_8
+   437   Reg_0 = 0
+   437   Stack_D = Reg_0
+   437   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   437   Stack_D = Reg_0
+   437   call Sym_9
+   439   Reg_0 = 3970
+   439   Stack_D = Reg_0
+   439   call Sym_6
+   439   Reg_0 = 0
+   439   Stack_D = Reg_0
+   439   Reg_0 = 0
+   439   Stack_D = Reg_0
+   439   Reg_0 = 1
+   439   Stack_D = Reg_0
+   439   call Sym_68
+   439   call Sym_8
+   439   Reg_0 = 0
+   439   Stack_D = Reg_0
+   439   Reg_0 = 0
+   439   Stack_D = Reg_0
+   439   call Sym_9
+   440   Reg_0 = 3980
+   440   Stack_D = Reg_0
+   440   call Sym_6
+   440   Reg_0 = 1
+   440   Stack_D = Reg_0
+   440   Reg_0 = 0
+   440   Stack_D = Reg_0
+   440   Reg_0 = 1
+   440   Stack_D = Reg_0
+   440   call Sym_68
+   440   call Sym_8
+   440   Reg_0 = 0
+   440   Stack_D = Reg_0
+   440   Reg_0 = 1
+   440   Stack_D = Reg_0
+   440   call Sym_9
+   441   Reg_0 = 3990
+   441   Stack_D = Reg_0
+   441   call Sym_6
+   441   Reg_0 = 1
+   441   Stack_D = Reg_0
+   441   Reg_0 = 0
+   441   Stack_D = Reg_0
+   441   Reg_0 = 2
+   441   Stack_D = Reg_0
+   441   call Sym_68
+   441   call Sym_8
+   441   Reg_0 = 1
+   441   Stack_D = Reg_0
+   441   Reg_0 = 0
+   441   Stack_D = Reg_0
+   441   call Sym_9
+   442   Reg_0 = 4000
+   442   Stack_D = Reg_0
+   442   call Sym_6
+   442   Reg_0 = 3
+   442   Stack_D = Reg_0
+   442   Reg_0 = 0
+   442   Stack_D = Reg_0
+   442   Reg_0 = 2
+   442   Stack_D = Reg_0
+   442   call Sym_68
+   442   call Sym_8
+   442   Reg_0 = 1
+   442   Stack_D = Reg_0
+   442   Reg_0 = 1
+   442   Stack_D = Reg_0
+   442   call Sym_9
+   443   Reg_0 = 4010
+   443   Stack_D = Reg_0
+   443   call Sym_6
+   443   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   443   Stack_D = Reg_0
+   443   Reg_0 = 2
+   443   Stack_D = Reg_0
+   443   call Sym_65
+   443   Reg_0 = 2
+   443   Stack_D = Reg_0
+   443   call Sym_68
+   443   call Sym_8
+   443   Reg_0 = 0
+   443   Stack_D = Reg_0
+   443   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   443   Stack_D = Reg_0
+   443   call Sym_9
+   444   Reg_0 = 4020
+   444   Stack_D = Reg_0
+   444   call Sym_6
+   444   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   444   Stack_D = Reg_0
+   444   Reg_0 = 2
+   444   Stack_D = Reg_0
+   444   call Sym_65
+   444   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   444   Stack_D = Reg_0
+   444   call Sym_68
+   444   call Sym_8
+   444   Reg_0 = 0
+   444   Stack_D = Reg_0
+   444   Reg_0 = 2
+   444   Stack_D = Reg_0
+   444   call Sym_9
+   445   Reg_0 = 4030
+   445   Stack_D = Reg_0
+   445   call Sym_6
+   445   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   445   Stack_D = Reg_0
+   445   no-op
+           optimizes   Reg_0 = *(Sym_22)
+   445   Stack_D = Reg_0
+   445   call Sym_65
+   445   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   445   Stack_D = Reg_0
+   445   call Sym_68
+   445   call Sym_8
+   445   Reg_0 = 0
+   445   Stack_D = Reg_0
+   445   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   445   Stack_D = Reg_0
+   445   call Sym_9
+   465   Reg_0 = 4280
+   465   Stack_D = Reg_0
+   465   call Sym_6
+   465   Reg_0 = 0
+   465   Stack_D = Reg_0
+   465   Reg_0 = 1
+   465   Stack_D = Reg_0
+   465   call Sym_74
+   465   call Sym_8
+   465   Reg_0 = 0
+   465   Stack_D = Reg_0
+   465   Reg_0 = 1
+   465   Stack_D = Reg_0
+   465   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   465   call Sym_9
+   466   Reg_0 = 4290
+   466   Stack_D = Reg_0
+   466   call Sym_6
+   466   Reg_0 = 1
+   466   Stack_D = Reg_0
+   466   Reg_0 = 1
+   466   Stack_D = Reg_0
+   466   call Sym_74
+   466   call Sym_8
+   466   Reg_0 = 1
+   466   Stack_D = Reg_0
+   466   Reg_0 = 1
+   466   Stack_D = Reg_0
+   466   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   466   call Sym_9
+   467   Reg_0 = 4300
+   467   Stack_D = Reg_0
+   467   call Sym_6
+   467   Reg_0 = 2
+   467   Stack_D = Reg_0
+   467   Reg_0 = 1
+   467   Stack_D = Reg_0
+   467   call Sym_74
+   467   call Sym_8
+   467   Reg_0 = 2
+   467   Stack_D = Reg_0
+   467   Reg_0 = 1
+   467   Stack_D = Reg_0
+   467   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   467   call Sym_9
+   468   Reg_0 = 4310
+   468   Stack_D = Reg_0
+   468   call Sym_6
+   468   Reg_0 = -1
+   468   Stack_D = Reg_0
+   468   Reg_0 = 1
+   468   Stack_D = Reg_0
+   468   call Sym_74
+   468   call Sym_8
+   468   Reg_0 = -1
+   468   Stack_D = Reg_0
+   468   Reg_0 = 1
+   468   Stack_D = Reg_0
+   468   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   468   call Sym_9
+   469   Reg_0 = 4320
+   469   Stack_D = Reg_0
+   469   call Sym_6
+   469   Reg_0 = -2
+   469   Stack_D = Reg_0
+   469   Reg_0 = 1
+   469   Stack_D = Reg_0
+   469   call Sym_74
+   469   call Sym_8
+   469   Reg_0 = -2
+   469   Stack_D = Reg_0
+   469   Reg_0 = 1
+   469   Stack_D = Reg_0
+   469   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   469   call Sym_9
+   470   Reg_0 = 4330
+   470   Stack_D = Reg_0
+   470   call Sym_6
+   470   Reg_0 = 0
+   470   Stack_D = Reg_0
+   470   Reg_0 = -1
+   470   Stack_D = Reg_0
+   470   call Sym_74
+   470   call Sym_8
+   470   Reg_0 = 0
+   470   Stack_D = Reg_0
+   470   Reg_0 = -1
+   470   Stack_D = Reg_0
+   470   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   470   call Sym_9
+   471   Reg_0 = 4340
+   471   Stack_D = Reg_0
+   471   call Sym_6
+   471   Reg_0 = 1
+   471   Stack_D = Reg_0
+   471   Reg_0 = -1
+   471   Stack_D = Reg_0
+   471   call Sym_74
+   471   call Sym_8
+   471   Reg_0 = 1
+   471   Stack_D = Reg_0
+   471   Reg_0 = -1
+   471   Stack_D = Reg_0
+   471   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   471   call Sym_9
+   472   Reg_0 = 4350
+   472   Stack_D = Reg_0
+   472   call Sym_6
+   472   Reg_0 = 2
+   472   Stack_D = Reg_0
+   472   Reg_0 = -1
+   472   Stack_D = Reg_0
+   472   call Sym_74
+   472   call Sym_8
+   472   Reg_0 = 2
+   472   Stack_D = Reg_0
+   472   Reg_0 = -1
+   472   Stack_D = Reg_0
+   472   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   472   call Sym_9
+   473   Reg_0 = 4360
+   473   Stack_D = Reg_0
+   473   call Sym_6
+   473   Reg_0 = -1
+   473   Stack_D = Reg_0
+   473   Reg_0 = -1
+   473   Stack_D = Reg_0
+   473   call Sym_74
+   473   call Sym_8
+   473   Reg_0 = -1
+   473   Stack_D = Reg_0
+   473   Reg_0 = -1
+   473   Stack_D = Reg_0
+   473   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   473   call Sym_9
+   474   Reg_0 = 4370
+   474   Stack_D = Reg_0
+   474   call Sym_6
+   474   Reg_0 = -2
+   474   Stack_D = Reg_0
+   474   Reg_0 = -1
+   474   Stack_D = Reg_0
+   474   call Sym_74
+   474   call Sym_8
+   474   Reg_0 = -2
+   474   Stack_D = Reg_0
+   474   Reg_0 = -1
+   474   Stack_D = Reg_0
+   474   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   474   call Sym_9
+   475   Reg_0 = 4380
+   475   Stack_D = Reg_0
+   475   call Sym_6
+   475   Reg_0 = 2
+   475   Stack_D = Reg_0
+   475   Reg_0 = 2
+   475   Stack_D = Reg_0
+   475   call Sym_74
+   475   call Sym_8
+   475   Reg_0 = 2
+   475   Stack_D = Reg_0
+   475   Reg_0 = 2
+   475   Stack_D = Reg_0
+   475   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   475   call Sym_9
+   476   Reg_0 = 4390
+   476   Stack_D = Reg_0
+   476   call Sym_6
+   476   Reg_0 = -1
+   476   Stack_D = Reg_0
+   476   Reg_0 = -1
+   476   Stack_D = Reg_0
+   476   call Sym_74
+   476   call Sym_8
+   476   Reg_0 = -1
+   476   Stack_D = Reg_0
+   476   Reg_0 = -1
+   476   Stack_D = Reg_0
+   476   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   476   call Sym_9
+   477   Reg_0 = 4400
+   477   Stack_D = Reg_0
+   477   call Sym_6
+   477   Reg_0 = -2
+   477   Stack_D = Reg_0
+   477   Reg_0 = -2
+   477   Stack_D = Reg_0
+   477   call Sym_74
+   477   call Sym_8
+   477   Reg_0 = -2
+   477   Stack_D = Reg_0
+   477   Reg_0 = -2
+   477   Stack_D = Reg_0
+   477   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   477   call Sym_9
+   478   Reg_0 = 4410
+   478   Stack_D = Reg_0
+   478   call Sym_6
+   478   Reg_0 = 7
+   478   Stack_D = Reg_0
+   478   Reg_0 = 3
+   478   Stack_D = Reg_0
+   478   call Sym_74
+   478   call Sym_8
+   478   Reg_0 = 7
+   478   Stack_D = Reg_0
+   478   Reg_0 = 3
+   478   Stack_D = Reg_0
+   478   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   478   call Sym_9
+   479   Reg_0 = 4420
+   479   Stack_D = Reg_0
+   479   call Sym_6
+   479   Reg_0 = 7
+   479   Stack_D = Reg_0
+   479   Reg_0 = -3
+   479   Stack_D = Reg_0
+   479   call Sym_74
+   479   call Sym_8
+   479   Reg_0 = 7
+   479   Stack_D = Reg_0
+   479   Reg_0 = -3
+   479   Stack_D = Reg_0
+   479   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   479   call Sym_9
+   480   Reg_0 = 4430
+   480   Stack_D = Reg_0
+   480   call Sym_6
+   480   Reg_0 = -7
+   480   Stack_D = Reg_0
+   480   Reg_0 = 3
+   480   Stack_D = Reg_0
+   480   call Sym_74
+   480   call Sym_8
+   480   Reg_0 = -7
+   480   Stack_D = Reg_0
+   480   Reg_0 = 3
+   480   Stack_D = Reg_0
+   480   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   480   call Sym_9
+   481   Reg_0 = 4440
+   481   Stack_D = Reg_0
+   481   call Sym_6
+   481   Reg_0 = -7
+   481   Stack_D = Reg_0
+   481   Reg_0 = -3
+   481   Stack_D = Reg_0
+   481   call Sym_74
+   481   call Sym_8
+   481   Reg_0 = -7
+   481   Stack_D = Reg_0
+   481   Reg_0 = -3
+   481   Stack_D = Reg_0
+   481   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   481   call Sym_9
+   482   Reg_0 = 4450
+   482   Stack_D = Reg_0
+   482   call Sym_6
+   482   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   482   Stack_D = Reg_0
+   482   Reg_0 = 1
+   482   Stack_D = Reg_0
+   482   call Sym_74
+   482   call Sym_8
+   482   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   482   Stack_D = Reg_0
+   482   Reg_0 = 1
+   482   Stack_D = Reg_0
+   482   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   482   call Sym_9
+   483   Reg_0 = 4460
+   483   Stack_D = Reg_0
+   483   call Sym_6
+   483   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   483   Stack_D = Reg_0
+   483   Reg_0 = 1
+   483   Stack_D = Reg_0
+   483   call Sym_74
+   483   call Sym_8
+   483   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   483   Stack_D = Reg_0
+   483   Reg_0 = 1
+   483   Stack_D = Reg_0
+   483   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   483   call Sym_9
+   484   Reg_0 = 4470
+   484   Stack_D = Reg_0
+   484   call Sym_6
+   484   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   484   Stack_D = Reg_0
+   484   no-op
+           optimizes   Reg_0 = *(Sym_23)
+   484   Stack_D = Reg_0
+   484   call Sym_74
+   484   call Sym_8
+   484   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   484   Stack_D = Reg_0
+   484   no-op
+           optimizes   Reg_0 = *(Sym_23)
+   484   Stack_D = Reg_0
+   484   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   484   call Sym_9
+   485   Reg_0 = 4480
+   485   Stack_D = Reg_0
+   485   call Sym_6
+   485   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   485   Stack_D = Reg_0
+   485   no-op
+           optimizes   Reg_0 = *(Sym_24)
+   485   Stack_D = Reg_0
+   485   call Sym_74
+   485   call Sym_8
+   485   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   485   Stack_D = Reg_0
+   485   no-op
+           optimizes   Reg_0 = *(Sym_24)
+   485   Stack_D = Reg_0
+   485   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   485   call Sym_9
+   487   Reg_0 = 4500
+   487   Stack_D = Reg_0
+   487   call Sym_6
+   487   Reg_0 = 0
+   487   no-op
+           optimizes   Stack_D = Reg_0
+   487   no-op
+           optimizes   Reg_0 = 1
+   487   no-op
+           optimizes   Stack_D = Reg_0
+   487   no-op
+           optimizes   call Sym_75
+   487   no-op
+           optimizes   Reg_0 = Stack_D
+   487   Reg_0 /= 1
+   487   Stack_D = Reg_0
+   487   call Sym_8
+   487   Reg_0 = 0
+   487   Stack_D = Reg_0
+   487   Reg_0 = 1
+   487   Stack_D = Reg_0
+   487   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   487   call Sym_9
+   488   Reg_0 = 4510
+   488   Stack_D = Reg_0
+   488   call Sym_6
+   488   Reg_0 = 1
+   488   no-op
+           optimizes   Stack_D = Reg_0
+   488   no-op
+           optimizes   Reg_0 = 1
+   488   no-op
+           optimizes   Stack_D = Reg_0
+   488   no-op
+           optimizes   call Sym_75
+   488   no-op
+           optimizes   Reg_0 = Stack_D
+   488   Reg_0 /= 1
+   488   Stack_D = Reg_0
+   488   call Sym_8
+   488   Reg_0 = 1
+   488   Stack_D = Reg_0
+   488   Reg_0 = 1
+   488   Stack_D = Reg_0
+   488   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   488   call Sym_9
+   489   Reg_0 = 4520
+   489   Stack_D = Reg_0
+   489   call Sym_6
+   489   Reg_0 = 2
+   489   no-op
+           optimizes   Stack_D = Reg_0
+   489   no-op
+           optimizes   Reg_0 = 1
+   489   no-op
+           optimizes   Stack_D = Reg_0
+   489   no-op
+           optimizes   call Sym_75
+   489   no-op
+           optimizes   Reg_0 = Stack_D
+   489   Reg_0 /= 1
+   489   Stack_D = Reg_0
+   489   call Sym_8
+   489   Reg_0 = 2
+   489   Stack_D = Reg_0
+   489   Reg_0 = 1
+   489   Stack_D = Reg_0
+   489   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   489   call Sym_9
+   490   Reg_0 = 4530
+   490   Stack_D = Reg_0
+   490   call Sym_6
+   490   Reg_0 = -1
+   490   no-op
+           optimizes   Stack_D = Reg_0
+   490   no-op
+           optimizes   Reg_0 = 1
+   490   no-op
+           optimizes   Stack_D = Reg_0
+   490   no-op
+           optimizes   call Sym_75
+   490   no-op
+           optimizes   Reg_0 = Stack_D
+   490   Reg_0 /= 1
+   490   Stack_D = Reg_0
+   490   call Sym_8
+   490   Reg_0 = -1
+   490   Stack_D = Reg_0
+   490   Reg_0 = 1
+   490   Stack_D = Reg_0
+   490   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   490   call Sym_9
+   491   Reg_0 = 4540
+   491   Stack_D = Reg_0
+   491   call Sym_6
+   491   Reg_0 = -2
+   491   no-op
+           optimizes   Stack_D = Reg_0
+   491   no-op
+           optimizes   Reg_0 = 1
+   491   no-op
+           optimizes   Stack_D = Reg_0
+   491   no-op
+           optimizes   call Sym_75
+   491   no-op
+           optimizes   Reg_0 = Stack_D
+   491   Reg_0 /= 1
+   491   Stack_D = Reg_0
+   491   call Sym_8
+   491   Reg_0 = -2
+   491   Stack_D = Reg_0
+   491   Reg_0 = 1
+   491   Stack_D = Reg_0
+   491   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   491   call Sym_9
+   492   Reg_0 = 4550
+   492   Stack_D = Reg_0
+   492   call Sym_6
+   492   Reg_0 = 0
+   492   no-op
+           optimizes   Stack_D = Reg_0
+   492   no-op
+           optimizes   Reg_0 = -1
+   492   no-op
+           optimizes   Stack_D = Reg_0
+   492   no-op
+           optimizes   call Sym_75
+   492   no-op
+           optimizes   Reg_0 = Stack_D
+   492   Reg_0 /= -1
+   492   Stack_D = Reg_0
+   492   call Sym_8
+   492   Reg_0 = 0
+   492   Stack_D = Reg_0
+   492   Reg_0 = -1
+   492   Stack_D = Reg_0
+   492   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   492   call Sym_9
+   493   Reg_0 = 4560
+   493   Stack_D = Reg_0
+   493   call Sym_6
+   493   Reg_0 = 1
+   493   no-op
+           optimizes   Stack_D = Reg_0
+   493   no-op
+           optimizes   Reg_0 = -1
+   493   no-op
+           optimizes   Stack_D = Reg_0
+   493   no-op
+           optimizes   call Sym_75
+   493   no-op
+           optimizes   Reg_0 = Stack_D
+   493   Reg_0 /= -1
+   493   Stack_D = Reg_0
+   493   call Sym_8
+   493   Reg_0 = 1
+   493   Stack_D = Reg_0
+   493   Reg_0 = -1
+   493   Stack_D = Reg_0
+   493   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   493   call Sym_9
+   494   Reg_0 = 4570
+   494   Stack_D = Reg_0
+   494   call Sym_6
+   494   Reg_0 = 2
+   494   no-op
+           optimizes   Stack_D = Reg_0
+   494   no-op
+           optimizes   Reg_0 = -1
+   494   no-op
+           optimizes   Stack_D = Reg_0
+   494   no-op
+           optimizes   call Sym_75
+   494   no-op
+           optimizes   Reg_0 = Stack_D
+   494   Reg_0 /= -1
+   494   Stack_D = Reg_0
+   494   call Sym_8
+   494   Reg_0 = 2
+   494   Stack_D = Reg_0
+   494   Reg_0 = -1
+   494   Stack_D = Reg_0
+   494   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   494   call Sym_9
+   495   Reg_0 = 4580
+   495   Stack_D = Reg_0
+   495   call Sym_6
+   495   Reg_0 = -1
+   495   no-op
+           optimizes   Stack_D = Reg_0
+   495   no-op
+           optimizes   Reg_0 = -1
+   495   no-op
+           optimizes   Stack_D = Reg_0
+   495   no-op
+           optimizes   call Sym_75
+   495   no-op
+           optimizes   Reg_0 = Stack_D
+   495   Reg_0 /= -1
+   495   Stack_D = Reg_0
+   495   call Sym_8
+   495   Reg_0 = -1
+   495   Stack_D = Reg_0
+   495   Reg_0 = -1
+   495   Stack_D = Reg_0
+   495   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   495   call Sym_9
+   496   Reg_0 = 4590
+   496   Stack_D = Reg_0
+   496   call Sym_6
+   496   Reg_0 = -2
+   496   no-op
+           optimizes   Stack_D = Reg_0
+   496   no-op
+           optimizes   Reg_0 = -1
+   496   no-op
+           optimizes   Stack_D = Reg_0
+   496   no-op
+           optimizes   call Sym_75
+   496   no-op
+           optimizes   Reg_0 = Stack_D
+   496   Reg_0 /= -1
+   496   Stack_D = Reg_0
+   496   call Sym_8
+   496   Reg_0 = -2
+   496   Stack_D = Reg_0
+   496   Reg_0 = -1
+   496   Stack_D = Reg_0
+   496   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   496   call Sym_9
+   497   Reg_0 = 4600
+   497   Stack_D = Reg_0
+   497   call Sym_6
+   497   Reg_0 = 2
+   497   no-op
+           optimizes   Stack_D = Reg_0
+   497   no-op
+           optimizes   Reg_0 = 2
+   497   no-op
+           optimizes   Stack_D = Reg_0
+   497   no-op
+           optimizes   call Sym_75
+   497   no-op
+           optimizes   Reg_0 = Stack_D
+   497   Reg_0 /= 2
+   497   Stack_D = Reg_0
+   497   call Sym_8
+   497   Reg_0 = 2
+   497   Stack_D = Reg_0
+   497   Reg_0 = 2
+   497   Stack_D = Reg_0
+   497   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   497   call Sym_9
+   498   Reg_0 = 4610
+   498   Stack_D = Reg_0
+   498   call Sym_6
+   498   Reg_0 = -1
+   498   no-op
+           optimizes   Stack_D = Reg_0
+   498   no-op
+           optimizes   Reg_0 = -1
+   498   no-op
+           optimizes   Stack_D = Reg_0
+   498   no-op
+           optimizes   call Sym_75
+   498   no-op
+           optimizes   Reg_0 = Stack_D
+   498   Reg_0 /= -1
+   498   Stack_D = Reg_0
+   498   call Sym_8
+   498   Reg_0 = -1
+   498   Stack_D = Reg_0
+   498   Reg_0 = -1
+   498   Stack_D = Reg_0
+   498   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   498   call Sym_9
+   499   Reg_0 = 4620
+   499   Stack_D = Reg_0
+   499   call Sym_6
+   499   Reg_0 = -2
+   499   no-op
+           optimizes   Stack_D = Reg_0
+   499   no-op
+           optimizes   Reg_0 = -2
+   499   no-op
+           optimizes   Stack_D = Reg_0
+   499   no-op
+           optimizes   call Sym_75
+   499   no-op
+           optimizes   Reg_0 = Stack_D
+   499   Reg_0 /= -2
+   499   Stack_D = Reg_0
+   499   call Sym_8
+   499   Reg_0 = -2
+   499   Stack_D = Reg_0
+   499   Reg_0 = -2
+   499   Stack_D = Reg_0
+   499   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   499   call Sym_9
+   500   Reg_0 = 4630
+   500   Stack_D = Reg_0
+   500   call Sym_6
+   500   Reg_0 = 7
+   500   no-op
+           optimizes   Stack_D = Reg_0
+   500   no-op
+           optimizes   Reg_0 = 3
+   500   no-op
+           optimizes   Stack_D = Reg_0
+   500   no-op
+           optimizes   call Sym_75
+   500   no-op
+           optimizes   Reg_0 = Stack_D
+   500   Reg_0 /= 3
+   500   Stack_D = Reg_0
+   500   call Sym_8
+   500   Reg_0 = 7
+   500   Stack_D = Reg_0
+   500   Reg_0 = 3
+   500   Stack_D = Reg_0
+   500   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   500   call Sym_9
+   501   Reg_0 = 4640
+   501   Stack_D = Reg_0
+   501   call Sym_6
+   501   Reg_0 = 7
+   501   no-op
+           optimizes   Stack_D = Reg_0
+   501   no-op
+           optimizes   Reg_0 = -3
+   501   no-op
+           optimizes   Stack_D = Reg_0
+   501   no-op
+           optimizes   call Sym_75
+   501   no-op
+           optimizes   Reg_0 = Stack_D
+   501   Reg_0 /= -3
+   501   Stack_D = Reg_0
+   501   call Sym_8
+   501   Reg_0 = 7
+   501   Stack_D = Reg_0
+   501   Reg_0 = -3
+   501   Stack_D = Reg_0
+   501   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   501   call Sym_9
+   502   Reg_0 = 4650
+   502   Stack_D = Reg_0
+   502   call Sym_6
+   502   Reg_0 = -7
+   502   no-op
+           optimizes   Stack_D = Reg_0
+   502   no-op
+           optimizes   Reg_0 = 3
+   502   no-op
+           optimizes   Stack_D = Reg_0
+   502   no-op
+           optimizes   call Sym_75
+   502   no-op
+           optimizes   Reg_0 = Stack_D
+   502   Reg_0 /= 3
+   502   Stack_D = Reg_0
+   502   call Sym_8
+   502   Reg_0 = -7
+   502   Stack_D = Reg_0
+   502   Reg_0 = 3
+   502   Stack_D = Reg_0
+   502   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   502   call Sym_9
+   503   Reg_0 = 4660
+   503   Stack_D = Reg_0
+   503   call Sym_6
+   503   Reg_0 = -7
+   503   no-op
+           optimizes   Stack_D = Reg_0
+   503   no-op
+           optimizes   Reg_0 = -3
+   503   no-op
+           optimizes   Stack_D = Reg_0
+   503   no-op
+           optimizes   call Sym_75
+   503   no-op
+           optimizes   Reg_0 = Stack_D
+   503   Reg_0 /= -3
+   503   Stack_D = Reg_0
+   503   call Sym_8
+   503   Reg_0 = -7
+   503   Stack_D = Reg_0
+   503   Reg_0 = -3
+   503   Stack_D = Reg_0
+   503   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   503   call Sym_9
+   504   Reg_0 = 4670
+   504   Stack_D = Reg_0
+   504   call Sym_6
+   504   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   504   no-op
+           optimizes   Stack_D = Reg_0
+   504   no-op
+           optimizes   Reg_0 = 1
+   504   no-op
+           optimizes   Stack_D = Reg_0
+   504   no-op
+           optimizes   call Sym_75
+   504   no-op
+           optimizes   Reg_0 = Stack_D
+   504   Reg_0 /= 1
+   504   Stack_D = Reg_0
+   504   call Sym_8
+   504   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   504   Stack_D = Reg_0
+   504   Reg_0 = 1
+   504   Stack_D = Reg_0
+   504   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   504   call Sym_9
+   505   Reg_0 = 4680
+   505   Stack_D = Reg_0
+   505   call Sym_6
+   505   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   505   no-op
+           optimizes   Stack_D = Reg_0
+   505   no-op
+           optimizes   Reg_0 = 1
+   505   no-op
+           optimizes   Stack_D = Reg_0
+   505   no-op
+           optimizes   call Sym_75
+   505   no-op
+           optimizes   Reg_0 = Stack_D
+   505   Reg_0 /= 1
+   505   Stack_D = Reg_0
+   505   call Sym_8
+   505   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   505   Stack_D = Reg_0
+   505   Reg_0 = 1
+   505   Stack_D = Reg_0
+   505   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   505   call Sym_9
+   506   Reg_0 = 4690
+   506   Stack_D = Reg_0
+   506   call Sym_6
+   506   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   506   Stack_D = Reg_0
+   506   no-op
+           optimizes   Reg_0 = *(Sym_23)
+   506   Stack_D = Reg_0
+   506   call Sym_75
+   506   call Sym_8
+   506   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   506   Stack_D = Reg_0
+   506   no-op
+           optimizes   Reg_0 = *(Sym_23)
+   506   Stack_D = Reg_0
+   506   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   506   call Sym_9
+   507   Reg_0 = 4700
+   507   Stack_D = Reg_0
+   507   call Sym_6
+   507   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   507   Stack_D = Reg_0
+   507   no-op
+           optimizes   Reg_0 = *(Sym_24)
+   507   Stack_D = Reg_0
+   507   call Sym_75
+   507   call Sym_8
+   507   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   507   Stack_D = Reg_0
+   507   no-op
+           optimizes   Reg_0 = *(Sym_24)
+   507   Stack_D = Reg_0
+   507   no-op
+           optimizes   call Sym_70
+   460   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   460   call Sym_51
+   460   call Sym_48
+   507   call Sym_9
+   509   Reg_0 = 4720
+   509   Stack_D = Reg_0
+   509   call Sym_6
+   509   Reg_0 = 0
+   509   no-op
+           optimizes   Stack_D = Reg_0
+   509   no-op
+           optimizes   Reg_0 = 1
+   509   no-op
+           optimizes   Stack_D = Reg_0
+   509   no-op
+           optimizes   call Sym_76
+   509   no-op
+           optimizes   Reg_0 = Stack_D
+   509   Reg_0 %= 1
+   509   Stack_D = Reg_0
+   509   call Sym_8
+   509   Reg_0 = 0
+   509   Stack_D = Reg_0
+   509   Reg_0 = 1
+   509   Stack_D = Reg_0
+   509   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   509   call Sym_9
+   510   Reg_0 = 4730
+   510   Stack_D = Reg_0
+   510   call Sym_6
+   510   Reg_0 = 1
+   510   no-op
+           optimizes   Stack_D = Reg_0
+   510   no-op
+           optimizes   Reg_0 = 1
+   510   no-op
+           optimizes   Stack_D = Reg_0
+   510   no-op
+           optimizes   call Sym_76
+   510   no-op
+           optimizes   Reg_0 = Stack_D
+   510   Reg_0 %= 1
+   510   Stack_D = Reg_0
+   510   call Sym_8
+   510   Reg_0 = 1
+   510   Stack_D = Reg_0
+   510   Reg_0 = 1
+   510   Stack_D = Reg_0
+   510   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   510   call Sym_9
+   511   Reg_0 = 4740
+   511   Stack_D = Reg_0
+   511   call Sym_6
+   511   Reg_0 = 2
+   511   no-op
+           optimizes   Stack_D = Reg_0
+   511   no-op
+           optimizes   Reg_0 = 1
+   511   no-op
+           optimizes   Stack_D = Reg_0
+   511   no-op
+           optimizes   call Sym_76
+   511   no-op
+           optimizes   Reg_0 = Stack_D
+   511   Reg_0 %= 1
+   511   Stack_D = Reg_0
+   511   call Sym_8
+   511   Reg_0 = 2
+   511   Stack_D = Reg_0
+   511   Reg_0 = 1
+   511   Stack_D = Reg_0
+   511   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   511   call Sym_9
+   512   Reg_0 = 4750
+   512   Stack_D = Reg_0
+   512   call Sym_6
+   512   Reg_0 = -1
+   512   no-op
+           optimizes   Stack_D = Reg_0
+   512   no-op
+           optimizes   Reg_0 = 1
+   512   no-op
+           optimizes   Stack_D = Reg_0
+   512   no-op
+           optimizes   call Sym_76
+   512   no-op
+           optimizes   Reg_0 = Stack_D
+   512   Reg_0 %= 1
+   512   Stack_D = Reg_0
+   512   call Sym_8
+   512   Reg_0 = -1
+   512   Stack_D = Reg_0
+   512   Reg_0 = 1
+   512   Stack_D = Reg_0
+   512   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   512   call Sym_9
+   513   Reg_0 = 4760
+   513   Stack_D = Reg_0
+   513   call Sym_6
+   513   Reg_0 = -2
+   513   no-op
+           optimizes   Stack_D = Reg_0
+   513   no-op
+           optimizes   Reg_0 = 1
+   513   no-op
+           optimizes   Stack_D = Reg_0
+   513   no-op
+           optimizes   call Sym_76
+   513   no-op
+           optimizes   Reg_0 = Stack_D
+   513   Reg_0 %= 1
+   513   Stack_D = Reg_0
+   513   call Sym_8
+   513   Reg_0 = -2
+   513   Stack_D = Reg_0
+   513   Reg_0 = 1
+   513   Stack_D = Reg_0
+   513   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   513   call Sym_9
+   514   Reg_0 = 4770
+   514   Stack_D = Reg_0
+   514   call Sym_6
+   514   Reg_0 = 0
+   514   no-op
+           optimizes   Stack_D = Reg_0
+   514   no-op
+           optimizes   Reg_0 = -1
+   514   no-op
+           optimizes   Stack_D = Reg_0
+   514   no-op
+           optimizes   call Sym_76
+   514   no-op
+           optimizes   Reg_0 = Stack_D
+   514   Reg_0 %= -1
+   514   Stack_D = Reg_0
+   514   call Sym_8
+   514   Reg_0 = 0
+   514   Stack_D = Reg_0
+   514   Reg_0 = -1
+   514   Stack_D = Reg_0
+   514   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   514   call Sym_9
+   515   Reg_0 = 4780
+   515   Stack_D = Reg_0
+   515   call Sym_6
+   515   Reg_0 = 1
+   515   no-op
+           optimizes   Stack_D = Reg_0
+   515   no-op
+           optimizes   Reg_0 = -1
+   515   no-op
+           optimizes   Stack_D = Reg_0
+   515   no-op
+           optimizes   call Sym_76
+   515   no-op
+           optimizes   Reg_0 = Stack_D
+   515   Reg_0 %= -1
+   515   Stack_D = Reg_0
+   515   call Sym_8
+   515   Reg_0 = 1
+   515   Stack_D = Reg_0
+   515   Reg_0 = -1
+   515   Stack_D = Reg_0
+   515   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   515   call Sym_9
+   516   Reg_0 = 4790
+   516   Stack_D = Reg_0
+   516   call Sym_6
+   516   Reg_0 = 2
+   516   no-op
+           optimizes   Stack_D = Reg_0
+   516   no-op
+           optimizes   Reg_0 = -1
+   516   no-op
+           optimizes   Stack_D = Reg_0
+   516   no-op
+           optimizes   call Sym_76
+   516   no-op
+           optimizes   Reg_0 = Stack_D
+   516   Reg_0 %= -1
+   516   Stack_D = Reg_0
+   516   call Sym_8
+   516   Reg_0 = 2
+   516   Stack_D = Reg_0
+   516   Reg_0 = -1
+   516   Stack_D = Reg_0
+   516   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   516   call Sym_9
+   517   Reg_0 = 4800
+   517   Stack_D = Reg_0
+   517   call Sym_6
+   517   Reg_0 = -1
+   517   no-op
+           optimizes   Stack_D = Reg_0
+   517   no-op
+           optimizes   Reg_0 = -1
+   517   no-op
+           optimizes   Stack_D = Reg_0
+   517   no-op
+           optimizes   call Sym_76
+   517   no-op
+           optimizes   Reg_0 = Stack_D
+   517   Reg_0 %= -1
+   517   Stack_D = Reg_0
+   517   call Sym_8
+   517   Reg_0 = -1
+   517   Stack_D = Reg_0
+   517   Reg_0 = -1
+   517   Stack_D = Reg_0
+   517   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   517   call Sym_9
+   518   Reg_0 = 4810
+   518   Stack_D = Reg_0
+   518   call Sym_6
+   518   Reg_0 = -2
+   518   no-op
+           optimizes   Stack_D = Reg_0
+   518   no-op
+           optimizes   Reg_0 = -1
+   518   no-op
+           optimizes   Stack_D = Reg_0
+   518   no-op
+           optimizes   call Sym_76
+   518   no-op
+           optimizes   Reg_0 = Stack_D
+   518   Reg_0 %= -1
+   518   Stack_D = Reg_0
+   518   call Sym_8
+   518   Reg_0 = -2
+   518   Stack_D = Reg_0
+   518   Reg_0 = -1
+   518   Stack_D = Reg_0
+   518   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   518   call Sym_9
+   519   Reg_0 = 4820
+   519   Stack_D = Reg_0
+   519   call Sym_6
+   519   Reg_0 = 2
+   519   no-op
+           optimizes   Stack_D = Reg_0
+   519   no-op
+           optimizes   Reg_0 = 2
+   519   no-op
+           optimizes   Stack_D = Reg_0
+   519   no-op
+           optimizes   call Sym_76
+   519   no-op
+           optimizes   Reg_0 = Stack_D
+   519   Reg_0 %= 2
+   519   Stack_D = Reg_0
+   519   call Sym_8
+   519   Reg_0 = 2
+   519   Stack_D = Reg_0
+   519   Reg_0 = 2
+   519   Stack_D = Reg_0
+   519   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   519   call Sym_9
+   520   Reg_0 = 4830
+   520   Stack_D = Reg_0
+   520   call Sym_6
+   520   Reg_0 = -1
+   520   no-op
+           optimizes   Stack_D = Reg_0
+   520   no-op
+           optimizes   Reg_0 = -1
+   520   no-op
+           optimizes   Stack_D = Reg_0
+   520   no-op
+           optimizes   call Sym_76
+   520   no-op
+           optimizes   Reg_0 = Stack_D
+   520   Reg_0 %= -1
+   520   Stack_D = Reg_0
+   520   call Sym_8
+   520   Reg_0 = -1
+   520   Stack_D = Reg_0
+   520   Reg_0 = -1
+   520   Stack_D = Reg_0
+   520   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   520   call Sym_9
+   521   Reg_0 = 4840
+   521   Stack_D = Reg_0
+   521   call Sym_6
+   521   Reg_0 = -2
+   521   no-op
+           optimizes   Stack_D = Reg_0
+   521   no-op
+           optimizes   Reg_0 = -2
+   521   no-op
+           optimizes   Stack_D = Reg_0
+   521   no-op
+           optimizes   call Sym_76
+   521   no-op
+           optimizes   Reg_0 = Stack_D
+   521   Reg_0 %= -2
+   521   Stack_D = Reg_0
+   521   call Sym_8
+   521   Reg_0 = -2
+   521   Stack_D = Reg_0
+   521   Reg_0 = -2
+   521   Stack_D = Reg_0
+   521   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   521   call Sym_9
+   522   Reg_0 = 4850
+   522   Stack_D = Reg_0
+   522   call Sym_6
+   522   Reg_0 = 7
+   522   no-op
+           optimizes   Stack_D = Reg_0
+   522   no-op
+           optimizes   Reg_0 = 3
+   522   no-op
+           optimizes   Stack_D = Reg_0
+   522   no-op
+           optimizes   call Sym_76
+   522   no-op
+           optimizes   Reg_0 = Stack_D
+   522   Reg_0 %= 3
+   522   Stack_D = Reg_0
+   522   call Sym_8
+   522   Reg_0 = 7
+   522   Stack_D = Reg_0
+   522   Reg_0 = 3
+   522   Stack_D = Reg_0
+   522   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   522   call Sym_9
+   523   Reg_0 = 4860
+   523   Stack_D = Reg_0
+   523   call Sym_6
+   523   Reg_0 = 7
+   523   no-op
+           optimizes   Stack_D = Reg_0
+   523   no-op
+           optimizes   Reg_0 = -3
+   523   no-op
+           optimizes   Stack_D = Reg_0
+   523   no-op
+           optimizes   call Sym_76
+   523   no-op
+           optimizes   Reg_0 = Stack_D
+   523   Reg_0 %= -3
+   523   Stack_D = Reg_0
+   523   call Sym_8
+   523   Reg_0 = 7
+   523   Stack_D = Reg_0
+   523   Reg_0 = -3
+   523   Stack_D = Reg_0
+   523   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   523   call Sym_9
+   524   Reg_0 = 4870
+   524   Stack_D = Reg_0
+   524   call Sym_6
+   524   Reg_0 = -7
+   524   no-op
+           optimizes   Stack_D = Reg_0
+   524   no-op
+           optimizes   Reg_0 = 3
+   524   no-op
+           optimizes   Stack_D = Reg_0
+   524   no-op
+           optimizes   call Sym_76
+   524   no-op
+           optimizes   Reg_0 = Stack_D
+   524   Reg_0 %= 3
+   524   Stack_D = Reg_0
+   524   call Sym_8
+   524   Reg_0 = -7
+   524   Stack_D = Reg_0
+   524   Reg_0 = 3
+   524   Stack_D = Reg_0
+   524   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   524   call Sym_9
+   525   Reg_0 = 4880
+   525   Stack_D = Reg_0
+   525   call Sym_6
+   525   Reg_0 = -7
+   525   no-op
+           optimizes   Stack_D = Reg_0
+   525   no-op
+           optimizes   Reg_0 = -3
+   525   no-op
+           optimizes   Stack_D = Reg_0
+   525   no-op
+           optimizes   call Sym_76
+   525   no-op
+           optimizes   Reg_0 = Stack_D
+   525   Reg_0 %= -3
+   525   Stack_D = Reg_0
+   525   call Sym_8
+   525   Reg_0 = -7
+   525   Stack_D = Reg_0
+   525   Reg_0 = -3
+   525   Stack_D = Reg_0
+   525   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   525   call Sym_9
+   526   Reg_0 = 4890
+   526   Stack_D = Reg_0
+   526   call Sym_6
+   526   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   526   no-op
+           optimizes   Stack_D = Reg_0
+   526   no-op
+           optimizes   Reg_0 = 1
+   526   no-op
+           optimizes   Stack_D = Reg_0
+   526   no-op
+           optimizes   call Sym_76
+   526   no-op
+           optimizes   Reg_0 = Stack_D
+   526   Reg_0 %= 1
+   526   Stack_D = Reg_0
+   526   call Sym_8
+   526   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   526   Stack_D = Reg_0
+   526   Reg_0 = 1
+   526   Stack_D = Reg_0
+   526   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   526   call Sym_9
+   527   Reg_0 = 4900
+   527   Stack_D = Reg_0
+   527   call Sym_6
+   527   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   527   no-op
+           optimizes   Stack_D = Reg_0
+   527   no-op
+           optimizes   Reg_0 = 1
+   527   no-op
+           optimizes   Stack_D = Reg_0
+   527   no-op
+           optimizes   call Sym_76
+   527   no-op
+           optimizes   Reg_0 = Stack_D
+   527   Reg_0 %= 1
+   527   Stack_D = Reg_0
+   527   call Sym_8
+   527   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   527   Stack_D = Reg_0
+   527   Reg_0 = 1
+   527   Stack_D = Reg_0
+   527   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   527   call Sym_9
+   528   Reg_0 = 4910
+   528   Stack_D = Reg_0
+   528   call Sym_6
+   528   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   528   Stack_D = Reg_0
+   528   no-op
+           optimizes   Reg_0 = *(Sym_23)
+   528   Stack_D = Reg_0
+   528   call Sym_76
+   528   call Sym_8
+   528   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   528   Stack_D = Reg_0
+   528   no-op
+           optimizes   Reg_0 = *(Sym_23)
+   528   Stack_D = Reg_0
+   528   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   528   call Sym_9
+   529   Reg_0 = 4920
+   529   Stack_D = Reg_0
+   529   call Sym_6
+   529   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   529   Stack_D = Reg_0
+   529   no-op
+           optimizes   Reg_0 = *(Sym_24)
+   529   Stack_D = Reg_0
+   529   call Sym_76
+   529   call Sym_8
+   529   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   529   Stack_D = Reg_0
+   529   no-op
+           optimizes   Reg_0 = *(Sym_24)
+   529   Stack_D = Reg_0
+   529   no-op
+           optimizes   call Sym_71
+   461   no-op
+           optimizes   call Sym_69
+   459   call Sym_53
+   459   call Sym_62
+   459   call Sym_54
+   459   call Sym_67
+   461   call Sym_48
+   529   call Sym_9
+   531   Reg_0 = 4940
+   531   Stack_D = Reg_0
+   531   call Sym_6
+   531   Reg_0 = 0
+   531   Stack_D = Reg_0
+   531   Reg_0 = 2
+   531   Stack_D = Reg_0
+   531   Reg_0 = 1
+   531   Stack_D = Reg_0
+   531   call Sym_77
+   531   call Sym_8
+   531   Reg_0 = 0
+   531   Stack_D = Reg_0
+   531   Reg_0 = 2
+   531   Stack_D = Reg_0
+   531   Reg_0 = 1
+   531   Stack_D = Reg_0
+   531   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   531   call Sym_9
+   532   Reg_0 = 4950
+   532   Stack_D = Reg_0
+   532   call Sym_6
+   532   Reg_0 = 1
+   532   Stack_D = Reg_0
+   532   Reg_0 = 2
+   532   Stack_D = Reg_0
+   532   Reg_0 = 1
+   532   Stack_D = Reg_0
+   532   call Sym_77
+   532   call Sym_8
+   532   Reg_0 = 1
+   532   Stack_D = Reg_0
+   532   Reg_0 = 2
+   532   Stack_D = Reg_0
+   532   Reg_0 = 1
+   532   Stack_D = Reg_0
+   532   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   532   call Sym_9
+   533   Reg_0 = 4960
+   533   Stack_D = Reg_0
+   533   call Sym_6
+   533   Reg_0 = 2
+   533   Stack_D = Reg_0
+   533   Reg_0 = 2
+   533   Stack_D = Reg_0
+   533   Reg_0 = 1
+   533   Stack_D = Reg_0
+   533   call Sym_77
+   533   call Sym_8
+   533   Reg_0 = 2
+   533   Stack_D = Reg_0
+   533   Reg_0 = 2
+   533   Stack_D = Reg_0
+   533   Reg_0 = 1
+   533   Stack_D = Reg_0
+   533   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   533   call Sym_9
+   534   Reg_0 = 4970
+   534   Stack_D = Reg_0
+   534   call Sym_6
+   534   Reg_0 = -1
+   534   Stack_D = Reg_0
+   534   Reg_0 = 2
+   534   Stack_D = Reg_0
+   534   Reg_0 = 1
+   534   Stack_D = Reg_0
+   534   call Sym_77
+   534   call Sym_8
+   534   Reg_0 = -1
+   534   Stack_D = Reg_0
+   534   Reg_0 = 2
+   534   Stack_D = Reg_0
+   534   Reg_0 = 1
+   534   Stack_D = Reg_0
+   534   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   534   call Sym_9
+   535   Reg_0 = 4980
+   535   Stack_D = Reg_0
+   535   call Sym_6
+   535   Reg_0 = -2
+   535   Stack_D = Reg_0
+   535   Reg_0 = 2
+   535   Stack_D = Reg_0
+   535   Reg_0 = 1
+   535   Stack_D = Reg_0
+   535   call Sym_77
+   535   call Sym_8
+   535   Reg_0 = -2
+   535   Stack_D = Reg_0
+   535   Reg_0 = 2
+   535   Stack_D = Reg_0
+   535   Reg_0 = 1
+   535   Stack_D = Reg_0
+   535   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   535   call Sym_9
+   536   Reg_0 = 4990
+   536   Stack_D = Reg_0
+   536   call Sym_6
+   536   Reg_0 = 0
+   536   Stack_D = Reg_0
+   536   Reg_0 = 2
+   536   Stack_D = Reg_0
+   536   Reg_0 = -1
+   536   Stack_D = Reg_0
+   536   call Sym_77
+   536   call Sym_8
+   536   Reg_0 = 0
+   536   Stack_D = Reg_0
+   536   Reg_0 = 2
+   536   Stack_D = Reg_0
+   536   Reg_0 = -1
+   536   Stack_D = Reg_0
+   536   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   536   call Sym_9
+   537   Reg_0 = 5000
+   537   Stack_D = Reg_0
+   537   call Sym_6
+   537   Reg_0 = 1
+   537   Stack_D = Reg_0
+   537   Reg_0 = 2
+   537   Stack_D = Reg_0
+   537   Reg_0 = -1
+   537   Stack_D = Reg_0
+   537   call Sym_77
+   537   call Sym_8
+   537   Reg_0 = 1
+   537   Stack_D = Reg_0
+   537   Reg_0 = 2
+   537   Stack_D = Reg_0
+   537   Reg_0 = -1
+   537   Stack_D = Reg_0
+   537   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   537   call Sym_9
+   538   Reg_0 = 5010
+   538   Stack_D = Reg_0
+   538   call Sym_6
+   538   Reg_0 = 2
+   538   Stack_D = Reg_0
+   538   Reg_0 = 2
+   538   Stack_D = Reg_0
+   538   Reg_0 = -1
+   538   Stack_D = Reg_0
+   538   call Sym_77
+   538   call Sym_8
+   538   Reg_0 = 2
+   538   Stack_D = Reg_0
+   538   Reg_0 = 2
+   538   Stack_D = Reg_0
+   538   Reg_0 = -1
+   538   Stack_D = Reg_0
+   538   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   538   call Sym_9
+   539   Reg_0 = 5020
+   539   Stack_D = Reg_0
+   539   call Sym_6
+   539   Reg_0 = -1
+   539   Stack_D = Reg_0
+   539   Reg_0 = 2
+   539   Stack_D = Reg_0
+   539   Reg_0 = -1
+   539   Stack_D = Reg_0
+   539   call Sym_77
+   539   call Sym_8
+   539   Reg_0 = -1
+   539   Stack_D = Reg_0
+   539   Reg_0 = 2
+   539   Stack_D = Reg_0
+   539   Reg_0 = -1
+   539   Stack_D = Reg_0
+   539   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   539   call Sym_9
+   540   Reg_0 = 5030
+   540   Stack_D = Reg_0
+   540   call Sym_6
+   540   Reg_0 = -2
+   540   Stack_D = Reg_0
+   540   Reg_0 = 2
+   540   Stack_D = Reg_0
+   540   Reg_0 = -1
+   540   Stack_D = Reg_0
+   540   call Sym_77
+   540   call Sym_8
+   540   Reg_0 = -2
+   540   Stack_D = Reg_0
+   540   Reg_0 = 2
+   540   Stack_D = Reg_0
+   540   Reg_0 = -1
+   540   Stack_D = Reg_0
+   540   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   540   call Sym_9
+   541   Reg_0 = 5040
+   541   Stack_D = Reg_0
+   541   call Sym_6
+   541   Reg_0 = 2
+   541   Stack_D = Reg_0
+   541   Reg_0 = 2
+   541   Stack_D = Reg_0
+   541   Reg_0 = 2
+   541   Stack_D = Reg_0
+   541   call Sym_77
+   541   call Sym_8
+   541   Reg_0 = 2
+   541   Stack_D = Reg_0
+   541   Reg_0 = 2
+   541   Stack_D = Reg_0
+   541   Reg_0 = 2
+   541   Stack_D = Reg_0
+   541   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   541   call Sym_9
+   542   Reg_0 = 5050
+   542   Stack_D = Reg_0
+   542   call Sym_6
+   542   Reg_0 = -1
+   542   Stack_D = Reg_0
+   542   Reg_0 = 2
+   542   Stack_D = Reg_0
+   542   Reg_0 = -1
+   542   Stack_D = Reg_0
+   542   call Sym_77
+   542   call Sym_8
+   542   Reg_0 = -1
+   542   Stack_D = Reg_0
+   542   Reg_0 = 2
+   542   Stack_D = Reg_0
+   542   Reg_0 = -1
+   542   Stack_D = Reg_0
+   542   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   542   call Sym_9
+   543   Reg_0 = 5060
+   543   Stack_D = Reg_0
+   543   call Sym_6
+   543   Reg_0 = -2
+   543   Stack_D = Reg_0
+   543   Reg_0 = 2
+   543   Stack_D = Reg_0
+   543   Reg_0 = -2
+   543   Stack_D = Reg_0
+   543   call Sym_77
+   543   call Sym_8
+   543   Reg_0 = -2
+   543   Stack_D = Reg_0
+   543   Reg_0 = 2
+   543   Stack_D = Reg_0
+   543   Reg_0 = -2
+   543   Stack_D = Reg_0
+   543   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   543   call Sym_9
+   544   Reg_0 = 5070
+   544   Stack_D = Reg_0
+   544   call Sym_6
+   544   Reg_0 = 7
+   544   Stack_D = Reg_0
+   544   Reg_0 = 2
+   544   Stack_D = Reg_0
+   544   Reg_0 = 3
+   544   Stack_D = Reg_0
+   544   call Sym_77
+   544   call Sym_8
+   544   Reg_0 = 7
+   544   Stack_D = Reg_0
+   544   Reg_0 = 2
+   544   Stack_D = Reg_0
+   544   Reg_0 = 3
+   544   Stack_D = Reg_0
+   544   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   544   call Sym_9
+   545   Reg_0 = 5080
+   545   Stack_D = Reg_0
+   545   call Sym_6
+   545   Reg_0 = 7
+   545   Stack_D = Reg_0
+   545   Reg_0 = 2
+   545   Stack_D = Reg_0
+   545   Reg_0 = -3
+   545   Stack_D = Reg_0
+   545   call Sym_77
+   545   call Sym_8
+   545   Reg_0 = 7
+   545   Stack_D = Reg_0
+   545   Reg_0 = 2
+   545   Stack_D = Reg_0
+   545   Reg_0 = -3
+   545   Stack_D = Reg_0
+   545   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   545   call Sym_9
+   546   Reg_0 = 5090
+   546   Stack_D = Reg_0
+   546   call Sym_6
+   546   Reg_0 = -7
+   546   Stack_D = Reg_0
+   546   Reg_0 = 2
+   546   Stack_D = Reg_0
+   546   Reg_0 = 3
+   546   Stack_D = Reg_0
+   546   call Sym_77
+   546   call Sym_8
+   546   Reg_0 = -7
+   546   Stack_D = Reg_0
+   546   Reg_0 = 2
+   546   Stack_D = Reg_0
+   546   Reg_0 = 3
+   546   Stack_D = Reg_0
+   546   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   546   call Sym_9
+   547   Reg_0 = 5100
+   547   Stack_D = Reg_0
+   547   call Sym_6
+   547   Reg_0 = -7
+   547   Stack_D = Reg_0
+   547   Reg_0 = 2
+   547   Stack_D = Reg_0
+   547   Reg_0 = -3
+   547   Stack_D = Reg_0
+   547   call Sym_77
+   547   call Sym_8
+   547   Reg_0 = -7
+   547   Stack_D = Reg_0
+   547   Reg_0 = 2
+   547   Stack_D = Reg_0
+   547   Reg_0 = -3
+   547   Stack_D = Reg_0
+   547   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   547   call Sym_9
+   548   Reg_0 = 5110
+   548   Stack_D = Reg_0
+   548   call Sym_6
+   548   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   548   Stack_D = Reg_0
+   548   Reg_0 = 2
+   548   Stack_D = Reg_0
+   548   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   548   Stack_D = Reg_0
+   548   call Sym_77
+   548   call Sym_8
+   548   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   548   Stack_D = Reg_0
+   548   Reg_0 = 2
+   548   Stack_D = Reg_0
+   548   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   548   Stack_D = Reg_0
+   548   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   548   call Sym_9
+   549   Reg_0 = 5120
+   549   Stack_D = Reg_0
+   549   call Sym_6
+   549   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   549   Stack_D = Reg_0
+   549   Reg_0 = 2
+   549   Stack_D = Reg_0
+   549   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   549   Stack_D = Reg_0
+   549   call Sym_77
+   549   call Sym_8
+   549   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   549   Stack_D = Reg_0
+   549   Reg_0 = 2
+   549   Stack_D = Reg_0
+   549   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   549   Stack_D = Reg_0
+   549   no-op
+           optimizes   call Sym_73
+   463   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   463   call Sym_51
+   463   call Sym_48
+   549   call Sym_9
+   551   Reg_0 = 5140
+   551   Stack_D = Reg_0
+   551   call Sym_6
+   551   Reg_0 = 0
+   551   Stack_D = Reg_0
+   551   Reg_0 = 2
+   551   Stack_D = Reg_0
+   551   Reg_0 = 1
+   551   Stack_D = Reg_0
+   551   call Sym_78
+   551   call Sym_8
+   551   Reg_0 = 0
+   551   Stack_D = Reg_0
+   551   Reg_0 = 2
+   551   Stack_D = Reg_0
+   551   Reg_0 = 1
+   551   Stack_D = Reg_0
+   551   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   551   call Sym_9
+   552   Reg_0 = 5150
+   552   Stack_D = Reg_0
+   552   call Sym_6
+   552   Reg_0 = 1
+   552   Stack_D = Reg_0
+   552   Reg_0 = 2
+   552   Stack_D = Reg_0
+   552   Reg_0 = 1
+   552   Stack_D = Reg_0
+   552   call Sym_78
+   552   call Sym_8
+   552   Reg_0 = 1
+   552   Stack_D = Reg_0
+   552   Reg_0 = 2
+   552   Stack_D = Reg_0
+   552   Reg_0 = 1
+   552   Stack_D = Reg_0
+   552   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   552   call Sym_9
+   553   Reg_0 = 5160
+   553   Stack_D = Reg_0
+   553   call Sym_6
+   553   Reg_0 = 2
+   553   Stack_D = Reg_0
+   553   Reg_0 = 2
+   553   Stack_D = Reg_0
+   553   Reg_0 = 1
+   553   Stack_D = Reg_0
+   553   call Sym_78
+   553   call Sym_8
+   553   Reg_0 = 2
+   553   Stack_D = Reg_0
+   553   Reg_0 = 2
+   553   Stack_D = Reg_0
+   553   Reg_0 = 1
+   553   Stack_D = Reg_0
+   553   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   553   call Sym_9
+   554   Reg_0 = 5170
+   554   Stack_D = Reg_0
+   554   call Sym_6
+   554   Reg_0 = -1
+   554   Stack_D = Reg_0
+   554   Reg_0 = 2
+   554   Stack_D = Reg_0
+   554   Reg_0 = 1
+   554   Stack_D = Reg_0
+   554   call Sym_78
+   554   call Sym_8
+   554   Reg_0 = -1
+   554   Stack_D = Reg_0
+   554   Reg_0 = 2
+   554   Stack_D = Reg_0
+   554   Reg_0 = 1
+   554   Stack_D = Reg_0
+   554   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   554   call Sym_9
+   555   Reg_0 = 5180
+   555   Stack_D = Reg_0
+   555   call Sym_6
+   555   Reg_0 = -2
+   555   Stack_D = Reg_0
+   555   Reg_0 = 2
+   555   Stack_D = Reg_0
+   555   Reg_0 = 1
+   555   Stack_D = Reg_0
+   555   call Sym_78
+   555   call Sym_8
+   555   Reg_0 = -2
+   555   Stack_D = Reg_0
+   555   Reg_0 = 2
+   555   Stack_D = Reg_0
+   555   Reg_0 = 1
+   555   Stack_D = Reg_0
+   555   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   555   call Sym_9
+   556   Reg_0 = 5190
+   556   Stack_D = Reg_0
+   556   call Sym_6
+   556   Reg_0 = 0
+   556   Stack_D = Reg_0
+   556   Reg_0 = 2
+   556   Stack_D = Reg_0
+   556   Reg_0 = -1
+   556   Stack_D = Reg_0
+   556   call Sym_78
+   556   call Sym_8
+   556   Reg_0 = 0
+   556   Stack_D = Reg_0
+   556   Reg_0 = 2
+   556   Stack_D = Reg_0
+   556   Reg_0 = -1
+   556   Stack_D = Reg_0
+   556   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   556   call Sym_9
+   557   Reg_0 = 5200
+   557   Stack_D = Reg_0
+   557   call Sym_6
+   557   Reg_0 = 1
+   557   Stack_D = Reg_0
+   557   Reg_0 = 2
+   557   Stack_D = Reg_0
+   557   Reg_0 = -1
+   557   Stack_D = Reg_0
+   557   call Sym_78
+   557   call Sym_8
+   557   Reg_0 = 1
+   557   Stack_D = Reg_0
+   557   Reg_0 = 2
+   557   Stack_D = Reg_0
+   557   Reg_0 = -1
+   557   Stack_D = Reg_0
+   557   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   557   call Sym_9
+   558   Reg_0 = 5210
+   558   Stack_D = Reg_0
+   558   call Sym_6
+   558   Reg_0 = 2
+   558   Stack_D = Reg_0
+   558   Reg_0 = 2
+   558   Stack_D = Reg_0
+   558   Reg_0 = -1
+   558   Stack_D = Reg_0
+   558   call Sym_78
+   558   call Sym_8
+   558   Reg_0 = 2
+   558   Stack_D = Reg_0
+   558   Reg_0 = 2
+   558   Stack_D = Reg_0
+   558   Reg_0 = -1
+   558   Stack_D = Reg_0
+   558   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   558   call Sym_9
+   559   Reg_0 = 5220
+   559   Stack_D = Reg_0
+   559   call Sym_6
+   559   Reg_0 = -1
+   559   Stack_D = Reg_0
+   559   Reg_0 = 2
+   559   Stack_D = Reg_0
+   559   Reg_0 = -1
+   559   Stack_D = Reg_0
+   559   call Sym_78
+   559   call Sym_8
+   559   Reg_0 = -1
+   559   Stack_D = Reg_0
+   559   Reg_0 = 2
+   559   Stack_D = Reg_0
+   559   Reg_0 = -1
+   559   Stack_D = Reg_0
+   559   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   559   call Sym_9
+   560   Reg_0 = 5230
+   560   Stack_D = Reg_0
+   560   call Sym_6
+   560   Reg_0 = -2
+   560   Stack_D = Reg_0
+   560   Reg_0 = 2
+   560   Stack_D = Reg_0
+   560   Reg_0 = -1
+   560   Stack_D = Reg_0
+   560   call Sym_78
+   560   call Sym_8
+   560   Reg_0 = -2
+   560   Stack_D = Reg_0
+   560   Reg_0 = 2
+   560   Stack_D = Reg_0
+   560   Reg_0 = -1
+   560   Stack_D = Reg_0
+   560   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   560   call Sym_9
+   561   Reg_0 = 5240
+   561   Stack_D = Reg_0
+   561   call Sym_6
+   561   Reg_0 = 2
+   561   Stack_D = Reg_0
+   561   Reg_0 = 2
+   561   Stack_D = Reg_0
+   561   Reg_0 = 2
+   561   Stack_D = Reg_0
+   561   call Sym_78
+   561   call Sym_8
+   561   Reg_0 = 2
+   561   Stack_D = Reg_0
+   561   Reg_0 = 2
+   561   Stack_D = Reg_0
+   561   Reg_0 = 2
+   561   Stack_D = Reg_0
+   561   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   561   call Sym_9
+   562   Reg_0 = 5250
+   562   Stack_D = Reg_0
+   562   call Sym_6
+   562   Reg_0 = -1
+   562   Stack_D = Reg_0
+   562   Reg_0 = 2
+   562   Stack_D = Reg_0
+   562   Reg_0 = -1
+   562   Stack_D = Reg_0
+   562   call Sym_78
+   562   call Sym_8
+   562   Reg_0 = -1
+   562   Stack_D = Reg_0
+   562   Reg_0 = 2
+   562   Stack_D = Reg_0
+   562   Reg_0 = -1
+   562   Stack_D = Reg_0
+   562   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   562   call Sym_9
+   563   Reg_0 = 5260
+   563   Stack_D = Reg_0
+   563   call Sym_6
+   563   Reg_0 = -2
+   563   Stack_D = Reg_0
+   563   Reg_0 = 2
+   563   Stack_D = Reg_0
+   563   Reg_0 = -2
+   563   Stack_D = Reg_0
+   563   call Sym_78
+   563   call Sym_8
+   563   Reg_0 = -2
+   563   Stack_D = Reg_0
+   563   Reg_0 = 2
+   563   Stack_D = Reg_0
+   563   Reg_0 = -2
+   563   Stack_D = Reg_0
+   563   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   563   call Sym_9
+   564   Reg_0 = 5270
+   564   Stack_D = Reg_0
+   564   call Sym_6
+   564   Reg_0 = 7
+   564   Stack_D = Reg_0
+   564   Reg_0 = 2
+   564   Stack_D = Reg_0
+   564   Reg_0 = 3
+   564   Stack_D = Reg_0
+   564   call Sym_78
+   564   call Sym_8
+   564   Reg_0 = 7
+   564   Stack_D = Reg_0
+   564   Reg_0 = 2
+   564   Stack_D = Reg_0
+   564   Reg_0 = 3
+   564   Stack_D = Reg_0
+   564   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   564   call Sym_9
+   565   Reg_0 = 5280
+   565   Stack_D = Reg_0
+   565   call Sym_6
+   565   Reg_0 = 7
+   565   Stack_D = Reg_0
+   565   Reg_0 = 2
+   565   Stack_D = Reg_0
+   565   Reg_0 = -3
+   565   Stack_D = Reg_0
+   565   call Sym_78
+   565   call Sym_8
+   565   Reg_0 = 7
+   565   Stack_D = Reg_0
+   565   Reg_0 = 2
+   565   Stack_D = Reg_0
+   565   Reg_0 = -3
+   565   Stack_D = Reg_0
+   565   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   565   call Sym_9
+   566   Reg_0 = 5290
+   566   Stack_D = Reg_0
+   566   call Sym_6
+   566   Reg_0 = -7
+   566   Stack_D = Reg_0
+   566   Reg_0 = 2
+   566   Stack_D = Reg_0
+   566   Reg_0 = 3
+   566   Stack_D = Reg_0
+   566   call Sym_78
+   566   call Sym_8
+   566   Reg_0 = -7
+   566   Stack_D = Reg_0
+   566   Reg_0 = 2
+   566   Stack_D = Reg_0
+   566   Reg_0 = 3
+   566   Stack_D = Reg_0
+   566   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   566   call Sym_9
+   567   Reg_0 = 5300
+   567   Stack_D = Reg_0
+   567   call Sym_6
+   567   Reg_0 = -7
+   567   Stack_D = Reg_0
+   567   Reg_0 = 2
+   567   Stack_D = Reg_0
+   567   Reg_0 = -3
+   567   Stack_D = Reg_0
+   567   call Sym_78
+   567   call Sym_8
+   567   Reg_0 = -7
+   567   Stack_D = Reg_0
+   567   Reg_0 = 2
+   567   Stack_D = Reg_0
+   567   Reg_0 = -3
+   567   Stack_D = Reg_0
+   567   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   567   call Sym_9
+   568   Reg_0 = 5310
+   568   Stack_D = Reg_0
+   568   call Sym_6
+   568   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   568   Stack_D = Reg_0
+   568   Reg_0 = 2
+   568   Stack_D = Reg_0
+   568   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   568   Stack_D = Reg_0
+   568   call Sym_78
+   568   call Sym_8
+   568   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   568   Stack_D = Reg_0
+   568   Reg_0 = 2
+   568   Stack_D = Reg_0
+   568   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_23)
+   568   Stack_D = Reg_0
+   568   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   568   call Sym_9
+   569   Reg_0 = 5320
+   569   Stack_D = Reg_0
+   569   call Sym_6
+   569   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   569   Stack_D = Reg_0
+   569   Reg_0 = 2
+   569   Stack_D = Reg_0
+   569   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   569   Stack_D = Reg_0
+   569   call Sym_78
+   569   call Sym_8
+   569   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   569   Stack_D = Reg_0
+   569   Reg_0 = 2
+   569   Stack_D = Reg_0
+   569   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_24)
+   569   Stack_D = Reg_0
+   569   no-op
+           optimizes   call Sym_72
+   462   call Sym_53
+   462   call Sym_63
+   462   call Sym_54
+   462   call Sym_67
+   569   call Sym_9
+   572   Reg_0 = Data_10
+   572   Stack_D = Reg_0
+   572   Reg_0 = 74
+   572   Stack_D = Reg_0
+   572   call Sym_0
+   572   call Sym_2
+   583   Reg_0 = Sym_79
+   583   Stack_D = Reg_0
+   583   Reg_0 = Sym_80
+   583   Stack_D = Reg_0
+   583   call Sym_5
+   585   call Sym_81
+   585   Reg_0 = 1
+   585   Stack_D = Reg_0
+   585   call Sym_82
+   586   call Sym_81
+   586   Reg_0 = 2
+   586   Stack_D = Reg_0
+   586   call Sym_82
+   587   Reg_0 = Stack_D
+   587   *(Sym_83) = Reg_0
+   588   Reg_0 = Stack_D
+   588   *(Sym_84) = Reg_0
+   589   Reg_0 = 5490
+   589   Stack_D = Reg_0
+   589   call Sym_6
+   589   Reg_0 = *(Sym_84)
+   589   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   589   Reg_0 = *(Sym_83)
+   589   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   589   no-op
+           optimizes   call Sym_34
+   589   no-op
+           optimizes   Reg_1 = Stack_D
+   589   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   589   Reg_0 = Reg_0 u< Reg_1
+   589   Stack_D = Reg_0
+   589   call Sym_8
+   589   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   589   Stack_D = Reg_0
+   589   call Sym_9
+   590   Reg_0 = 5500
+   590   Stack_D = Reg_0
+   590   call Sym_6
+   590   Reg_0 = *(Sym_84)
+   590   no-op
+           optimizes   Stack_D = Reg_0
+   590   no-op
+           optimizes   call Sym_85
+   590   no-op
+           optimizes   Reg_0 = Stack_D
+   590   Reg_0 += 4
+   590   Stack_D = Reg_0
+   590   call Sym_8
+   590   Reg_0 = *(Sym_83)
+   590   Stack_D = Reg_0
+   590   call Sym_9
+   591   Reg_0 = 5510
+   591   Stack_D = Reg_0
+   591   call Sym_6
+   591   Reg_0 = *(Sym_84)
+   591   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   591   Reg_0 = 4
+           optimizes   Reg_0 = 1
+   591   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   591   no-op
+           optimizes   call Sym_86
+   591   no-op
+           optimizes   call Sym_57
+   591   no-op
+           optimizes   Reg_1 = Stack_D
+   591   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   591   Reg_0 += Reg_1
+   591   Stack_D = Reg_0
+   591   call Sym_8
+   591   Reg_0 = *(Sym_83)
+   591   Stack_D = Reg_0
+   591   call Sym_9
+   592   Reg_0 = 5520
+   592   Stack_D = Reg_0
+   592   call Sym_6
+   592   Reg_0 = *(Sym_84)
+   592   Stack_D = Reg_0
+   592   call Sym_87
+   592   Reg_0 = *(Sym_83)
+   592   Stack_D = Reg_0
+   592   call Sym_87
+   592   call Sym_8
+   592   Reg_0 = 1
+   592   Stack_D = Reg_0
+   592   Reg_0 = 2
+   592   Stack_D = Reg_0
+   592   call Sym_9
+   593   Reg_0 = 5530
+   593   Stack_D = Reg_0
+   593   call Sym_6
+   593   Reg_0 = 5
+   593   Stack_D = Reg_0
+   593   Reg_0 = *(Sym_84)
+   593   Stack_D = Reg_0
+   593   call Sym_5
+   593   call Sym_8
+   593   call Sym_9
+   594   Reg_0 = 5540
+   594   Stack_D = Reg_0
+   594   call Sym_6
+   594   Reg_0 = *(Sym_84)
+   594   Stack_D = Reg_0
+   594   call Sym_87
+   594   Reg_0 = *(Sym_83)
+   594   Stack_D = Reg_0
+   594   call Sym_87
+   594   call Sym_8
+   594   Reg_0 = 5
+   594   Stack_D = Reg_0
+   594   Reg_0 = 2
+   594   Stack_D = Reg_0
+   594   call Sym_9
+   595   Reg_0 = 5550
+   595   Stack_D = Reg_0
+   595   call Sym_6
+   595   Reg_0 = 6
+   595   Stack_D = Reg_0
+   595   Reg_0 = *(Sym_83)
+   595   Stack_D = Reg_0
+   595   call Sym_5
+   595   call Sym_8
+   595   call Sym_9
+   596   Reg_0 = 5560
+   596   Stack_D = Reg_0
+   596   call Sym_6
+   596   Reg_0 = *(Sym_84)
+   596   Stack_D = Reg_0
+   596   call Sym_87
+   596   Reg_0 = *(Sym_83)
+   596   Stack_D = Reg_0
+   596   call Sym_87
+   596   call Sym_8
+   596   Reg_0 = 5
+   596   Stack_D = Reg_0
+   596   Reg_0 = 6
+   596   Stack_D = Reg_0
+   596   call Sym_9
+   597   Reg_0 = 5570
+   597   Stack_D = Reg_0
+   597   call Sym_6
+   597   Reg_0 = *(Sym_84)
+   597   Stack_D = Reg_0
+   597   call Sym_88
+   597   call Sym_8
+   597   Reg_0 = 6
+   597   Stack_D = Reg_0
+   597   Reg_0 = 5
+   597   Stack_D = Reg_0
+   597   call Sym_9
+   598   Reg_0 = 5580
+   598   Stack_D = Reg_0
+   598   call Sym_6
+   598   Reg_0 = 2
+   598   Stack_D = Reg_0
+   598   Reg_0 = 1
+   598   Stack_D = Reg_0
+   598   Reg_0 = *(Sym_84)
+   598   Stack_D = Reg_0
+   598   call Sym_89
+   598   call Sym_8
+   598   call Sym_9
+   599   Reg_0 = 5590
+   599   Stack_D = Reg_0
+   599   call Sym_6
+   599   Reg_0 = *(Sym_84)
+   599   Stack_D = Reg_0
+   599   call Sym_88
+   599   call Sym_8
+   599   Reg_0 = 2
+   599   Stack_D = Reg_0
+   599   Reg_0 = 1
+   599   Stack_D = Reg_0
+   599   call Sym_9
+   601   call Sym_81
+   601   Reg_0 = 1
+   601   Stack_D = Reg_0
+   601   call Sym_90
+   602   call Sym_81
+   602   Reg_0 = 2
+   602   Stack_D = Reg_0
+   602   call Sym_90
+   603   Reg_0 = Stack_D
+   603   *(Sym_91) = Reg_0
+   604   Reg_0 = Stack_D
+   604   *(Sym_92) = Reg_0
+   605   Reg_0 = 5650
+   605   Stack_D = Reg_0
+   605   call Sym_6
+   605   Reg_0 = *(Sym_92)
+   605   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   605   Reg_0 = *(Sym_91)
+   605   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   605   no-op
+           optimizes   call Sym_34
+   605   no-op
+           optimizes   Reg_1 = Stack_D
+   605   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   605   Reg_0 = Reg_0 u< Reg_1
+   605   Stack_D = Reg_0
+   605   call Sym_8
+   605   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   605   Stack_D = Reg_0
+   605   call Sym_9
+   606   Reg_0 = 5660
+   606   Stack_D = Reg_0
+   606   call Sym_6
+   606   Reg_0 = *(Sym_92)
+   606   Stack_D = Reg_0
+   606   call Sym_93
+   606   call Sym_8
+   606   Reg_0 = *(Sym_91)
+   606   Stack_D = Reg_0
+   606   call Sym_9
+   607   Reg_0 = 5670
+   607   Stack_D = Reg_0
+   607   call Sym_6
+   607   Reg_0 = *(Sym_92)
+   607   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   607   Reg_0 = 1
+           optimizes   Reg_0 = 1
+   607   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   607   no-op
+           optimizes   call Sym_94
+   607   no-op
+           optimizes   call Sym_57
+   607   no-op
+           optimizes   Reg_1 = Stack_D
+   607   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   607   Reg_0 += Reg_1
+   607   Stack_D = Reg_0
+   607   call Sym_8
+   607   Reg_0 = *(Sym_91)
+   607   Stack_D = Reg_0
+   607   call Sym_9
+   608   Reg_0 = 5680
+   608   Stack_D = Reg_0
+   608   call Sym_6
+   608   Reg_0 = *(Sym_92)
+   608   Stack_D = Reg_0
+   608   call Sym_95
+   608   Reg_0 = *(Sym_91)
+   608   Stack_D = Reg_0
+   608   call Sym_95
+   608   call Sym_8
+   608   Reg_0 = 1
+   608   Stack_D = Reg_0
+   608   Reg_0 = 2
+   608   Stack_D = Reg_0
+   608   call Sym_9
+   609   Reg_0 = 5690
+   609   Stack_D = Reg_0
+   609   call Sym_6
+   609   Reg_0 = 3
+   609   Stack_D = Reg_0
+   609   Reg_0 = *(Sym_92)
+   609   Stack_D = Reg_0
+   609   call Sym_96
+   609   call Sym_8
+   609   call Sym_9
+   610   Reg_0 = 5700
+   610   Stack_D = Reg_0
+   610   call Sym_6
+   610   Reg_0 = *(Sym_92)
+   610   Stack_D = Reg_0
+   610   call Sym_95
+   610   Reg_0 = *(Sym_91)
+   610   Stack_D = Reg_0
+   610   call Sym_95
+   610   call Sym_8
+   610   Reg_0 = 3
+   610   Stack_D = Reg_0
+   610   Reg_0 = 2
+   610   Stack_D = Reg_0
+   610   call Sym_9
+   611   Reg_0 = 5710
+   611   Stack_D = Reg_0
+   611   call Sym_6
+   611   Reg_0 = 4
+   611   Stack_D = Reg_0
+   611   Reg_0 = *(Sym_91)
+   611   Stack_D = Reg_0
+   611   call Sym_96
+   611   call Sym_8
+   611   call Sym_9
+   612   Reg_0 = 5720
+   612   Stack_D = Reg_0
+   612   call Sym_6
+   612   Reg_0 = *(Sym_92)
+   612   Stack_D = Reg_0
+   612   call Sym_95
+   612   Reg_0 = *(Sym_91)
+   612   Stack_D = Reg_0
+   612   call Sym_95
+   612   call Sym_8
+   612   Reg_0 = 3
+   612   Stack_D = Reg_0
+   612   Reg_0 = 4
+   612   Stack_D = Reg_0
+   612   call Sym_9
+   614   call Sym_97
+   615   call Sym_81
+   615   Reg_0 = 0
+   615   Stack_D = Reg_0
+   615   call Sym_90
+   615   call Sym_97
+   615   Reg_0 = 123
+   615   Stack_D = Reg_0
+   615   call Sym_82
+   615   Reg_0 = Stack_D
+   615   *(Sym_98) = Reg_0
+   617   Reg_0 = 5750
+   617   Stack_D = Reg_0
+   617   call Sym_6
+   617   Reg_0 = *(Sym_98)
+   617   no-op
+           optimizes   Stack_D = Reg_0
+   617   no-op
+           optimizes   call Sym_41
+   617   no-op
+           optimizes   Reg_0 = Stack_D
+   617   Reg_0 += 1
+   617   Stack_D = Reg_0
+   617   call Sym_99
+   617   call Sym_87
+   617   call Sym_8
+   617   Reg_0 = 123
+   617   Stack_D = Reg_0
+   617   call Sym_9
+   620   Reg_0 = 5780
+   620   Stack_D = Reg_0
+   620   call Sym_6
+   620   Reg_0 = 4
+           optimizes   Reg_0 = 1
+   620   no-op
+           optimizes   Stack_D = Reg_0
+   620   no-op
+           optimizes   call Sym_86
+   620   no-op
+           optimizes   Reg_0 = 1
+   620   no-op
+           optimizes   Stack_D = Reg_0
+   620   no-op
+           optimizes   call Sym_94
+   620   no-op
+           optimizes   call Sym_76
+   620   no-op
+           optimizes   Reg_0 = Stack_D
+   620   Reg_0 %= 1
+   620   Stack_D = Reg_0
+   620   call Sym_8
+   620   Reg_0 = 0
+   620   Stack_D = Reg_0
+   620   call Sym_9
+   622   Reg_0 = 5800
+   622   Stack_D = Reg_0
+   622   call Sym_6
+   622   Reg_0 = 0
+   622   Stack_D = Reg_0
+   622   Reg_0 = *(Sym_84)
+   622   Stack_D = Reg_0
+   622   call Sym_5
+   622   call Sym_8
+   622   call Sym_9
+   623   Reg_0 = 5810
+   623   Stack_D = Reg_0
+   623   call Sym_6
+   623   Reg_0 = 1
+   623   Stack_D = Reg_0
+   623   Reg_0 = *(Sym_84)
+   623   Stack_D = Reg_0
+   623   call Sym_100
+   623   call Sym_8
+   623   call Sym_9
+   624   Reg_0 = 5820
+   624   Stack_D = Reg_0
+   624   call Sym_6
+   624   Reg_0 = *(Sym_84)
+   624   Stack_D = Reg_0
+   624   call Sym_87
+   624   call Sym_8
+   624   Reg_0 = 1
+   624   Stack_D = Reg_0
+   624   call Sym_9
+   625   Reg_0 = 5830
+   625   Stack_D = Reg_0
+   625   call Sym_6
+   625   Reg_0 = -1
+   625   Stack_D = Reg_0
+   625   Reg_0 = *(Sym_84)
+   625   Stack_D = Reg_0
+   625   call Sym_100
+   625   Reg_0 = *(Sym_84)
+   625   Stack_D = Reg_0
+   625   call Sym_87
+   625   call Sym_8
+   625   Reg_0 = 0
+   625   Stack_D = Reg_0
+   625   call Sym_9
+   628   Reg_0 = Data_11
+   628   Stack_D = Reg_0
+   628   Reg_0 = 35
+   628   Stack_D = Reg_0
+   628   call Sym_0
+   628   call Sym_2
+   630   Reg_0 = 5880
+   630   Stack_D = Reg_0
+   630   call Sym_6
+   630   call Sym_101
+   630   call Sym_8
+   630   Reg_0 = 32
+   630   Stack_D = Reg_0
+   630   call Sym_9
+   631   Reg_0 = 5890
+   631   Stack_D = Reg_0
+   631   call Sym_6
+   631   Reg_0 = 88
+   631   Stack_D = Reg_0
+   631   call Sym_8
+   631   Reg_0 = 88
+   631   Stack_D = Reg_0
+   631   call Sym_9
+   632   Reg_0 = 5900
+   632   Stack_D = Reg_0
+   632   call Sym_6
+   632   Reg_0 = 72
+   632   Stack_D = Reg_0
+   632   call Sym_8
+   632   Reg_0 = 72
+   632   Stack_D = Reg_0
+   632   call Sym_9
+   633   Reg_0 = 5910
+   633   Stack_D = Reg_0
+   633   call Sym_6
+   633   call Sym_8
+   633   call Sym_9
+   634   Reg_0 = 5920
+   634   Stack_D = Reg_0
+   634   call Sym_6
+   634   call Sym_8
+   634   call Sym_9
+   635   Reg_0 = 5930
+   635   Stack_D = Reg_0
+   635   call Sym_6
+   635   no-op
+           optimizes   call Sym_102
+   633   Reg_0 = 88
+   633   Stack_D = Reg_0
+   635   call Sym_8
+   635   Reg_0 = 88
+   635   Stack_D = Reg_0
+   635   call Sym_9
+   636   Reg_0 = 5940
+   636   Stack_D = Reg_0
+   636   call Sym_6
+   636   no-op
+           optimizes   call Sym_103
+   634   Reg_0 = 72
+   634   Stack_D = Reg_0
+   636   call Sym_8
+   636   Reg_0 = 72
+   636   Stack_D = Reg_0
+   636   call Sym_9
+   637   Reg_0 = 5950
+   637   Stack_D = Reg_0
+   637   call Sym_6
+   637   call Sym_8
+   637   call Sym_9
+   638   Reg_0 = 5960
+   638   Stack_D = Reg_0
+   638   call Sym_6
+   638   no-op
+           optimizes   call Sym_104
+   637   call Sym_105
+   637   no-op
+           optimizes   call Sym_102
+   633   Reg_0 = 88
+   633   Stack_D = Reg_0
+   637   call Sym_106
+   637   call Sym_107
+   638   call Sym_8
+   638   Reg_0 = 88
+   638   Stack_D = Reg_0
+   638   call Sym_9
+   639   Reg_0 = 5970
+   639   Stack_D = Reg_0
+   639   call Sym_6
+   639   call Sym_8
+   639   call Sym_9
+   640   Reg_0 = 5980
+   640   Stack_D = Reg_0
+   640   call Sym_6
+   640   no-op
+           optimizes   call Sym_108
+   639   Reg_0 = Data_12
+   639   Stack_D = Reg_0
+   639   Reg_0 = 2
+   639   Stack_D = Reg_0
+   640   call Sym_51
+   640   call Sym_48
+   640   call Sym_8
+   640   Reg_0 = 2
+   640   Stack_D = Reg_0
+   640   call Sym_9
+   641   Reg_0 = 5990
+   641   Stack_D = Reg_0
+   641   call Sym_6
+   641   no-op
+           optimizes   call Sym_108
+   639   Reg_0 = Data_12
+   639   Stack_D = Reg_0
+   639   Reg_0 = 2
+   639   Stack_D = Reg_0
+   641   call Sym_48
+   641   call Sym_16
+   641   call Sym_95
+   641   call Sym_51
+   641   call Sym_93
+   641   call Sym_95
+   641   call Sym_8
+   641   Reg_0 = 88
+   641   Stack_D = Reg_0
+   641   Reg_0 = 89
+   641   Stack_D = Reg_0
+   641   call Sym_9
+   644   Reg_0 = Data_13
+   644   Stack_D = Reg_0
+   644   Reg_0 = 65
+   644   Stack_D = Reg_0
+   644   call Sym_0
+   644   call Sym_2
+   646   Reg_0 = 6040
+   646   Stack_D = Reg_0
+   646   call Sym_6
+   646   call Sym_8
+   646   call Sym_9
+   647   Reg_0 = 6050
+   647   Stack_D = Reg_0
+   647   call Sym_6
+   647   Reg_0 = Sym_109
+   647   Stack_D = Reg_0
+   647   call Sym_38
+   647   call Sym_8
+   647   Reg_0 = 123
+   647   Stack_D = Reg_0
+   647   call Sym_9
+   648   Reg_0 = 6060
+   648   Stack_D = Reg_0
+   648   call Sym_6
+   648   call Sym_111
+   648   call Sym_8
+   648   call Sym_9
+   649   Reg_0 = 6070
+   649   Stack_D = Reg_0
+   649   call Sym_6
+   649   no-op
+           optimizes   call Sym_110
+   648   Reg_0 = Sym_109
+   648   Stack_D = Reg_0
+   649   call Sym_38
+   649   call Sym_8
+   649   Reg_0 = 123
+   649   Stack_D = Reg_0
+   649   call Sym_9
+   666   Reg_0 = 6240
+   666   Stack_D = Reg_0
+   666   call Sym_6
+   666   call Sym_111
+   666   call Sym_8
+   666   call Sym_9
+   667   Reg_0 = 6250
+   667   Stack_D = Reg_0
+   667   call Sym_6
+   667   no-op
+           optimizes   call Sym_112
+   666   call Sym_113
+   666   call Sym_87
+   667   call Sym_8
+   667   Reg_0 = 0
+   667   Stack_D = Reg_0
+   667   call Sym_9
+   668   Reg_0 = 6260
+   668   Stack_D = Reg_0
+   668   call Sym_6
+   668   call Sym_8
+   668   call Sym_9
+   669   Reg_0 = 6270
+   669   Stack_D = Reg_0
+   669   call Sym_6
+   669   no-op
+           optimizes   call Sym_114
+   668   Reg_0 = Sym_112
+   668   Stack_D = Reg_0
+   668   call Sym_107
+   669   no-op
+           optimizes   call Sym_29
+   669   Reg_0 = Stack_D
+   669   Reg_0 = Reg_0 == 0
+   669   Stack_D = Reg_0
+   669   call Sym_8
+   669   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_27)
+   669   Stack_D = Reg_0
+   669   call Sym_9
+   672   Reg_0 = Data_14
+   672   Stack_D = Reg_0
+   672   Reg_0 = 53
+   672   Stack_D = Reg_0
+   672   call Sym_0
+   672   call Sym_2
+   674   Reg_0 = 6320
+   674   Stack_D = Reg_0
+   674   call Sym_6
+   674   call Sym_8
+   674   call Sym_9
+   675   Reg_0 = 6330
+   675   Stack_D = Reg_0
+   675   call Sym_6
+   675   call Sym_8
+   675   call Sym_9
+   676   Reg_0 = 6340
+   676   Stack_D = Reg_0
+   676   call Sym_6
+   676   Reg_0 = 0
+   676   no-op
+           optimizes   Stack_D = Reg_0
+   676   no-op
+           optimizes   call Sym_115
+   674   no-op
+           optimizes   Reg_0 = Stack_D
+   674   if Reg_0 == 0 goto Label_123
+   674   Reg_0 = 123
+   674   Stack_D = Reg_0
+   674 label Label_123
+   676   call Sym_8
+   676   call Sym_9
+   677   Reg_0 = 6350
+   677   Stack_D = Reg_0
+   677   call Sym_6
+   677   Reg_0 = 1
+   677   no-op
+           optimizes   Stack_D = Reg_0
+   677   no-op
+           optimizes   call Sym_115
+   674   no-op
+           optimizes   Reg_0 = Stack_D
+   674   if Reg_0 == 0 goto Label_124
+   674   Reg_0 = 123
+   674   Stack_D = Reg_0
+   674 label Label_124
+   677   call Sym_8
+   677   Reg_0 = 123
+   677   Stack_D = Reg_0
+   677   call Sym_9
+   678   Reg_0 = 6360
+   678   Stack_D = Reg_0
+   678   call Sym_6
+   678   Reg_0 = -1
+   678   no-op
+           optimizes   Stack_D = Reg_0
+   678   no-op
+           optimizes   call Sym_115
+   674   no-op
+           optimizes   Reg_0 = Stack_D
+   674   if Reg_0 == 0 goto Label_125
+   674   Reg_0 = 123
+   674   Stack_D = Reg_0
+   674 label Label_125
+   678   call Sym_8
+   678   Reg_0 = 123
+   678   Stack_D = Reg_0
+   678   call Sym_9
+   679   Reg_0 = 6370
+   679   Stack_D = Reg_0
+   679   call Sym_6
+   679   Reg_0 = 0
+   679   no-op
+           optimizes   Stack_D = Reg_0
+   679   no-op
+           optimizes   call Sym_116
+   675   no-op
+           optimizes   Reg_0 = Stack_D
+   675   if Reg_0 == 0 goto Label_126
+   675   Reg_0 = 123
+   675   Stack_D = Reg_0
+   675   goto Label_127
+   675 label Label_126
+   675   Reg_0 = 234
+   675   Stack_D = Reg_0
+   675 label Label_127
+   679   call Sym_8
+   679   Reg_0 = 234
+   679   Stack_D = Reg_0
+   679   call Sym_9
+   680   Reg_0 = 6380
+   680   Stack_D = Reg_0
+   680   call Sym_6
+   680   Reg_0 = 1
+   680   no-op
+           optimizes   Stack_D = Reg_0
+   680   no-op
+           optimizes   call Sym_116
+   675   no-op
+           optimizes   Reg_0 = Stack_D
+   675   if Reg_0 == 0 goto Label_128
+   675   Reg_0 = 123
+   675   Stack_D = Reg_0
+   675   goto Label_129
+   675 label Label_128
+   675   Reg_0 = 234
+   675   Stack_D = Reg_0
+   675 label Label_129
+   680   call Sym_8
+   680   Reg_0 = 123
+   680   Stack_D = Reg_0
+   680   call Sym_9
+   681   Reg_0 = 6390
+   681   Stack_D = Reg_0
+   681   call Sym_6
+   681   Reg_0 = -1
+   681   no-op
+           optimizes   Stack_D = Reg_0
+   681   no-op
+           optimizes   call Sym_115
+   674   no-op
+           optimizes   Reg_0 = Stack_D
+   674   if Reg_0 == 0 goto Label_130
+   674   Reg_0 = 123
+   674   Stack_D = Reg_0
+   674 label Label_130
+   681   call Sym_8
+   681   Reg_0 = 123
+   681   Stack_D = Reg_0
+   681   call Sym_9
+   683   Reg_0 = 6410
+   683   Stack_D = Reg_0
+   683   call Sym_6
+   683   call Sym_8
+   683   call Sym_9
+   684   Reg_0 = 6420
+   684   Stack_D = Reg_0
+   684   call Sym_6
+   684   Reg_0 = 0
+   684   Stack_D = Reg_0
+   684   no-op
+           optimizes   call Sym_117
+   683 label Label_131
+   683   call Sym_16
+   683   Reg_0 = 5
+   683   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   683   no-op
+           optimizes   call Sym_32
+   683   no-op
+           optimizes   Reg_1 = Stack_D
+   683   Reg_0 = Stack_D
+   683   if Reg_0 >= Reg_1 goto Label_132
+   683   no-op
+           optimizes   Reg_0 = Stack_D
+   683   no-op
+           optimizes   if Reg_0 == 0 goto Label_132
+   683   call Sym_16
+   683   no-op
+           optimizes   call Sym_41
+   683   Reg_0 = Stack_D
+   683   Reg_0 += 1
+   683   Stack_D = Reg_0
+   683   goto Label_131
+   683 label Label_132
+   684   call Sym_8
+   684   Reg_0 = 0
+   684   Stack_D = Reg_0
+   684   Reg_0 = 1
+   684   Stack_D = Reg_0
+   684   Reg_0 = 2
+   684   Stack_D = Reg_0
+   684   Reg_0 = 3
+   684   Stack_D = Reg_0
+   684   Reg_0 = 4
+   684   Stack_D = Reg_0
+   684   Reg_0 = 5
+   684   Stack_D = Reg_0
+   684   call Sym_9
+   685   Reg_0 = 6430
+   685   Stack_D = Reg_0
+   685   call Sym_6
+   685   Reg_0 = 4
+   685   Stack_D = Reg_0
+   685   no-op
+           optimizes   call Sym_117
+   683 label Label_133
+   683   call Sym_16
+   683   Reg_0 = 5
+   683   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   683   no-op
+           optimizes   call Sym_32
+   683   no-op
+           optimizes   Reg_1 = Stack_D
+   683   Reg_0 = Stack_D
+   683   if Reg_0 >= Reg_1 goto Label_134
+   683   no-op
+           optimizes   Reg_0 = Stack_D
+   683   no-op
+           optimizes   if Reg_0 == 0 goto Label_134
+   683   call Sym_16
+   683   no-op
+           optimizes   call Sym_41
+   683   Reg_0 = Stack_D
+   683   Reg_0 += 1
+   683   Stack_D = Reg_0
+   683   goto Label_133
+   683 label Label_134
+   685   call Sym_8
+   685   Reg_0 = 4
+   685   Stack_D = Reg_0
+   685   Reg_0 = 5
+   685   Stack_D = Reg_0
+   685   call Sym_9
+   686   Reg_0 = 6440
+   686   Stack_D = Reg_0
+   686   call Sym_6
+   686   Reg_0 = 5
+   686   Stack_D = Reg_0
+   686   no-op
+           optimizes   call Sym_117
+   683 label Label_135
+   683   call Sym_16
+   683   Reg_0 = 5
+   683   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   683   no-op
+           optimizes   call Sym_32
+   683   no-op
+           optimizes   Reg_1 = Stack_D
+   683   Reg_0 = Stack_D
+   683   if Reg_0 >= Reg_1 goto Label_136
+   683   no-op
+           optimizes   Reg_0 = Stack_D
+   683   no-op
+           optimizes   if Reg_0 == 0 goto Label_136
+   683   call Sym_16
+   683   no-op
+           optimizes   call Sym_41
+   683   Reg_0 = Stack_D
+   683   Reg_0 += 1
+   683   Stack_D = Reg_0
+   683   goto Label_135
+   683 label Label_136
+   686   call Sym_8
+   686   Reg_0 = 5
+   686   Stack_D = Reg_0
+   686   call Sym_9
+   687   Reg_0 = 6450
+   687   Stack_D = Reg_0
+   687   call Sym_6
+   687   Reg_0 = 6
+   687   Stack_D = Reg_0
+   687   no-op
+           optimizes   call Sym_117
+   683 label Label_137
+   683   call Sym_16
+   683   Reg_0 = 5
+   683   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   683   no-op
+           optimizes   call Sym_32
+   683   no-op
+           optimizes   Reg_1 = Stack_D
+   683   Reg_0 = Stack_D
+   683   if Reg_0 >= Reg_1 goto Label_138
+   683   no-op
+           optimizes   Reg_0 = Stack_D
+   683   no-op
+           optimizes   if Reg_0 == 0 goto Label_138
+   683   call Sym_16
+   683   no-op
+           optimizes   call Sym_41
+   683   Reg_0 = Stack_D
+   683   Reg_0 += 1
+   683   Stack_D = Reg_0
+   683   goto Label_137
+   683 label Label_138
+   687   call Sym_8
+   687   Reg_0 = 6
+   687   Stack_D = Reg_0
+   687   call Sym_9
+   689   Reg_0 = 6470
+   689   Stack_D = Reg_0
+   689   call Sym_6
+   689   call Sym_8
+   689   call Sym_9
+   690   Reg_0 = 6480
+   690   Stack_D = Reg_0
+   690   call Sym_6
+   690   Reg_0 = 3
+   690   Stack_D = Reg_0
+   690   no-op
+           optimizes   call Sym_118
+   689 label Label_139
+   689   call Sym_16
+   689   no-op
+           optimizes   call Sym_41
+   689   Reg_0 = Stack_D
+   689   Reg_0 += 1
+   689   Stack_D = Reg_0
+   689   call Sym_16
+   689   Reg_0 = 5
+   689   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   689   no-op
+           optimizes   call Sym_33
+   689   no-op
+           optimizes   Reg_1 = Stack_D
+   689   Reg_0 = Stack_D
+   689   if Reg_0 <= Reg_1 goto Label_139
+   689   no-op
+           optimizes   Reg_0 = Stack_D
+   689   no-op
+           optimizes   if Reg_0 == 0 goto Label_139
+   690   call Sym_8
+   690   Reg_0 = 3
+   690   Stack_D = Reg_0
+   690   Reg_0 = 4
+   690   Stack_D = Reg_0
+   690   Reg_0 = 5
+   690   Stack_D = Reg_0
+   690   Reg_0 = 6
+   690   Stack_D = Reg_0
+   690   call Sym_9
+   691   Reg_0 = 6490
+   691   Stack_D = Reg_0
+   691   call Sym_6
+   691   Reg_0 = 5
+   691   Stack_D = Reg_0
+   691   no-op
+           optimizes   call Sym_118
+   689 label Label_140
+   689   call Sym_16
+   689   no-op
+           optimizes   call Sym_41
+   689   Reg_0 = Stack_D
+   689   Reg_0 += 1
+   689   Stack_D = Reg_0
+   689   call Sym_16
+   689   Reg_0 = 5
+   689   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   689   no-op
+           optimizes   call Sym_33
+   689   no-op
+           optimizes   Reg_1 = Stack_D
+   689   Reg_0 = Stack_D
+   689   if Reg_0 <= Reg_1 goto Label_140
+   689   no-op
+           optimizes   Reg_0 = Stack_D
+   689   no-op
+           optimizes   if Reg_0 == 0 goto Label_140
+   691   call Sym_8
+   691   Reg_0 = 5
+   691   Stack_D = Reg_0
+   691   Reg_0 = 6
+   691   Stack_D = Reg_0
+   691   call Sym_9
+   692   Reg_0 = 6500
+   692   Stack_D = Reg_0
+   692   call Sym_6
+   692   Reg_0 = 6
+   692   Stack_D = Reg_0
+   692   no-op
+           optimizes   call Sym_118
+   689 label Label_141
+   689   call Sym_16
+   689   no-op
+           optimizes   call Sym_41
+   689   Reg_0 = Stack_D
+   689   Reg_0 += 1
+   689   Stack_D = Reg_0
+   689   call Sym_16
+   689   Reg_0 = 5
+   689   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   689   no-op
+           optimizes   call Sym_33
+   689   no-op
+           optimizes   Reg_1 = Stack_D
+   689   Reg_0 = Stack_D
+   689   if Reg_0 <= Reg_1 goto Label_141
+   689   no-op
+           optimizes   Reg_0 = Stack_D
+   689   no-op
+           optimizes   if Reg_0 == 0 goto Label_141
+   692   call Sym_8
+   692   Reg_0 = 6
+   692   Stack_D = Reg_0
+   692   Reg_0 = 7
+   692   Stack_D = Reg_0
+   692   call Sym_9
+   694   Reg_0 = 6520
+   694   Stack_D = Reg_0
+   694   call Sym_6
+   694   call Sym_8
+   694   call Sym_9
+   695   Reg_0 = 6530
+   695   Stack_D = Reg_0
+   695   call Sym_6
+   695   Reg_0 = 1
+   695   Stack_D = Reg_0
+   695   call Sym_119
+   695   call Sym_8
+   695   Reg_0 = 1
+   695   Stack_D = Reg_0
+   695   call Sym_9
+   696   Reg_0 = 6540
+   696   Stack_D = Reg_0
+   696   call Sym_6
+   696   Reg_0 = 2
+   696   Stack_D = Reg_0
+   696   call Sym_119
+   696   call Sym_8
+   696   Reg_0 = 2
+   696   Stack_D = Reg_0
+   696   call Sym_9
+   697   Reg_0 = 6550
+   697   Stack_D = Reg_0
+   697   call Sym_6
+   697   Reg_0 = 3
+   697   Stack_D = Reg_0
+   697   call Sym_119
+   697   call Sym_8
+   697   Reg_0 = 3
+   697   Stack_D = Reg_0
+   697   Reg_0 = 4
+   697   Stack_D = Reg_0
+   697   Reg_0 = 5
+   697   Stack_D = Reg_0
+   697   call Sym_9
+   698   Reg_0 = 6560
+   698   Stack_D = Reg_0
+   698   call Sym_6
+   698   Reg_0 = 4
+   698   Stack_D = Reg_0
+   698   call Sym_119
+   698   call Sym_8
+   698   Reg_0 = 4
+   698   Stack_D = Reg_0
+   698   Reg_0 = 5
+   698   Stack_D = Reg_0
+   698   call Sym_9
+   699   Reg_0 = 6570
+   699   Stack_D = Reg_0
+   699   call Sym_6
+   699   Reg_0 = 5
+   699   Stack_D = Reg_0
+   699   call Sym_119
+   699   call Sym_8
+   699   Reg_0 = 5
+   699   Stack_D = Reg_0
+   699   call Sym_9
+   701   Reg_0 = 6600
+   701   Stack_D = Reg_0
+   701   call Sym_6
+   701   call Sym_8
+   701   call Sym_9
+   702   Reg_0 = 6610
+   702   Stack_D = Reg_0
+   702   call Sym_6
+   702   Reg_0 = 0
+   702   Stack_D = Reg_0
+   702   call Sym_120
+   702   call Sym_8
+   702   Reg_0 = 0
+   702   Stack_D = Reg_0
+   702   call Sym_9
+   703   Reg_0 = 6620
+   703   Stack_D = Reg_0
+   703   call Sym_6
+   703   Reg_0 = 1
+   703   Stack_D = Reg_0
+   703   call Sym_120
+   703   call Sym_8
+   703   Reg_0 = 0
+   703   Stack_D = Reg_0
+   703   Reg_0 = 1
+   703   Stack_D = Reg_0
+   703   call Sym_9
+   704   Reg_0 = 6630
+   704   Stack_D = Reg_0
+   704   call Sym_6
+   704   Reg_0 = 2
+   704   Stack_D = Reg_0
+   704   call Sym_120
+   704   call Sym_8
+   704   Reg_0 = 0
+   704   Stack_D = Reg_0
+   704   Reg_0 = 1
+   704   Stack_D = Reg_0
+   704   Reg_0 = 2
+   704   Stack_D = Reg_0
+   704   call Sym_9
+   705   Reg_0 = 6640
+   705   Stack_D = Reg_0
+   705   call Sym_6
+   705   Reg_0 = 3
+   705   Stack_D = Reg_0
+   705   call Sym_120
+   705   call Sym_8
+   705   Reg_0 = 0
+   705   Stack_D = Reg_0
+   705   Reg_0 = 1
+   705   Stack_D = Reg_0
+   705   Reg_0 = 2
+   705   Stack_D = Reg_0
+   705   Reg_0 = 3
+   705   Stack_D = Reg_0
+   705   call Sym_9
+   706   Reg_0 = 6650
+   706   Stack_D = Reg_0
+   706   call Sym_6
+   706   Reg_0 = 4
+   706   Stack_D = Reg_0
+   706   call Sym_120
+   706   call Sym_8
+   706   Reg_0 = 0
+   706   Stack_D = Reg_0
+   706   Reg_0 = 1
+   706   Stack_D = Reg_0
+   706   Reg_0 = 2
+   706   Stack_D = Reg_0
+   706   Reg_0 = 3
+   706   Stack_D = Reg_0
+   706   Reg_0 = 4
+   706   Stack_D = Reg_0
+   706   call Sym_9
+   709   Reg_0 = Data_15
+   709   Stack_D = Reg_0
+   709   Reg_0 = 43
+   709   Stack_D = Reg_0
+   709   call Sym_0
+   709   call Sym_2
+   711   Reg_0 = 6700
+   711   Stack_D = Reg_0
+   711   call Sym_6
+   711   call Sym_8
+   711   call Sym_9
+   712   Reg_0 = 6710
+   712   Stack_D = Reg_0
+   712   call Sym_6
+   712   Reg_0 = 4
+   712   Stack_D = Reg_0
+   712   Reg_0 = 1
+   712   Stack_D = Reg_0
+   712   call Sym_121
+   712   call Sym_8
+   712   Reg_0 = 1
+   712   Stack_D = Reg_0
+   712   Reg_0 = 2
+   712   Stack_D = Reg_0
+   712   Reg_0 = 3
+   712   Stack_D = Reg_0
+   712   call Sym_9
+   713   Reg_0 = 6720
+   713   Stack_D = Reg_0
+   713   call Sym_6
+   713   Reg_0 = 2
+   713   Stack_D = Reg_0
+   713   Reg_0 = -1
+   713   Stack_D = Reg_0
+   713   call Sym_121
+   713   call Sym_8
+   713   Reg_0 = -1
+   713   Stack_D = Reg_0
+   713   Reg_0 = 0
+   713   Stack_D = Reg_0
+   713   Reg_0 = 1
+   713   Stack_D = Reg_0
+   713   call Sym_9
+   714   Reg_0 = 6730
+   714   Stack_D = Reg_0
+   714   call Sym_6
+   714   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   714   Stack_D = Reg_0
+   714   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   714   Stack_D = Reg_0
+   714   call Sym_121
+   714   call Sym_8
+   714   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   714   Stack_D = Reg_0
+   714   call Sym_9
+   716   Reg_0 = 6750
+   716   Stack_D = Reg_0
+   716   call Sym_6
+   716   call Sym_8
+   716   call Sym_9
+   717   Reg_0 = 6760
+   717   Stack_D = Reg_0
+   717   call Sym_6
+   717   Reg_0 = 1
+   717   Stack_D = Reg_0
+   717   Reg_0 = 4
+   717   Stack_D = Reg_0
+   717   call Sym_123
+   717   call Sym_8
+   717   Reg_0 = 4
+   717   Stack_D = Reg_0
+   717   Reg_0 = 3
+   717   Stack_D = Reg_0
+   717   Reg_0 = 2
+   717   Stack_D = Reg_0
+   717   Reg_0 = 1
+   717   Stack_D = Reg_0
+   717   call Sym_9
+   718   Reg_0 = 6770
+   718   Stack_D = Reg_0
+   718   call Sym_6
+   718   Reg_0 = -1
+   718   Stack_D = Reg_0
+   718   Reg_0 = 2
+   718   Stack_D = Reg_0
+   718   call Sym_123
+   718   call Sym_8
+   718   Reg_0 = 2
+   718   Stack_D = Reg_0
+   718   Reg_0 = 1
+   718   Stack_D = Reg_0
+   718   Reg_0 = 0
+   718   Stack_D = Reg_0
+   718   Reg_0 = -1
+   718   Stack_D = Reg_0
+   718   call Sym_9
+   719   Reg_0 = 6780
+   719   Stack_D = Reg_0
+   719   call Sym_6
+   719   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   719   Stack_D = Reg_0
+   719   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   719   Stack_D = Reg_0
+   719   call Sym_123
+   719   call Sym_8
+   719   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   719   Stack_D = Reg_0
+   719   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   719   Stack_D = Reg_0
+   719   call Sym_9
+   721   Reg_0 = 6800
+   721   Stack_D = Reg_0
+   721   call Sym_6
+   721   call Sym_8
+   721   call Sym_9
+   722   Reg_0 = 6810
+   722   Stack_D = Reg_0
+   722   call Sym_6
+   722   Reg_0 = 4
+   722   Stack_D = Reg_0
+   722   Reg_0 = 1
+   722   Stack_D = Reg_0
+   722   call Sym_124
+   722   call Sym_8
+   722   Reg_0 = 1
+   722   Stack_D = Reg_0
+   722   Reg_0 = 2
+   722   Stack_D = Reg_0
+   722   Reg_0 = 3
+   722   Stack_D = Reg_0
+   722   call Sym_9
+   723   Reg_0 = 6820
+   723   Stack_D = Reg_0
+   723   call Sym_6
+   723   Reg_0 = 2
+   723   Stack_D = Reg_0
+   723   Reg_0 = -1
+   723   Stack_D = Reg_0
+   723   call Sym_124
+   723   call Sym_8
+   723   Reg_0 = -1
+   723   Stack_D = Reg_0
+   723   Reg_0 = 0
+   723   Stack_D = Reg_0
+   723   Reg_0 = 1
+   723   Stack_D = Reg_0
+   723   call Sym_9
+   724   Reg_0 = 6830
+   724   Stack_D = Reg_0
+   724   call Sym_6
+   724   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   724   Stack_D = Reg_0
+   724   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   724   Stack_D = Reg_0
+   724   call Sym_124
+   724   call Sym_8
+   724   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   724   Stack_D = Reg_0
+   724   call Sym_9
+   726   Reg_0 = 6850
+   726   Stack_D = Reg_0
+   726   call Sym_6
+   726   call Sym_8
+   726   call Sym_9
+   727   Reg_0 = 6860
+   727   Stack_D = Reg_0
+   727   call Sym_6
+   727   Reg_0 = 1
+   727   Stack_D = Reg_0
+   727   Reg_0 = 4
+   727   Stack_D = Reg_0
+   727   call Sym_126
+   727   call Sym_8
+   727   Reg_0 = 4
+   727   Stack_D = Reg_0
+   727   Reg_0 = 3
+   727   Stack_D = Reg_0
+   727   Reg_0 = 2
+   727   Stack_D = Reg_0
+   727   Reg_0 = 1
+   727   Stack_D = Reg_0
+   727   call Sym_9
+   728   Reg_0 = 6870
+   728   Stack_D = Reg_0
+   728   call Sym_6
+   728   Reg_0 = -1
+   728   Stack_D = Reg_0
+   728   Reg_0 = 2
+   728   Stack_D = Reg_0
+   728   call Sym_126
+   728   call Sym_8
+   728   Reg_0 = 2
+   728   Stack_D = Reg_0
+   728   Reg_0 = 1
+   728   Stack_D = Reg_0
+   728   Reg_0 = 0
+   728   Stack_D = Reg_0
+   728   Reg_0 = -1
+   728   Stack_D = Reg_0
+   728   call Sym_9
+   729   Reg_0 = 6880
+   729   Stack_D = Reg_0
+   729   call Sym_6
+   729   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   729   Stack_D = Reg_0
+   729   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   729   Stack_D = Reg_0
+   729   call Sym_126
+   729   call Sym_8
+   729   Reg_0 = -2147483648
+           optimizes   Reg_0 = *(Sym_26)
+   729   Stack_D = Reg_0
+   729   Reg_0 = 2147483647
+           optimizes   Reg_0 = *(Sym_25)
+   729   Stack_D = Reg_0
+   729   call Sym_9
+   731   Reg_0 = 6900
+   731   Stack_D = Reg_0
+   731   call Sym_6
+   731   call Sym_8
+   731   call Sym_9
+   732   Reg_0 = 6910
+   732   Stack_D = Reg_0
+   732   call Sym_6
+   732   Reg_0 = 1
+   732   Stack_D = Reg_0
+   732   call Sym_127
+   732   call Sym_8
+   732   Reg_0 = 123
+   732   Stack_D = Reg_0
+   732   call Sym_9
+   733   Reg_0 = 6920
+   733   Stack_D = Reg_0
+   733   call Sym_6
+   733   Reg_0 = 5
+   733   Stack_D = Reg_0
+   733   call Sym_127
+   733   call Sym_8
+   733   Reg_0 = 123
+   733   Stack_D = Reg_0
+   733   call Sym_9
+   734   Reg_0 = 6930
+   734   Stack_D = Reg_0
+   734   call Sym_6
+   734   Reg_0 = 6
+   734   Stack_D = Reg_0
+   734   call Sym_127
+   734   call Sym_8
+   734   Reg_0 = 234
+   734   Stack_D = Reg_0
+   734   call Sym_9
+   736   Reg_0 = 6950
+   736   Stack_D = Reg_0
+   736   call Sym_6
+   739   call Sym_8
+   739   call Sym_9
+   740   Reg_0 = 6990
+   740   Stack_D = Reg_0
+   740   call Sym_6
+   740   Reg_0 = 1
+   740   Stack_D = Reg_0
+   740   call Sym_128
+   740   call Sym_8
+   740   Reg_0 = 1
+   740   Stack_D = Reg_0
+   740   call Sym_9
+   741   Reg_0 = 7000
+   741   Stack_D = Reg_0
+   741   call Sym_6
+   741   Reg_0 = 2
+   741   Stack_D = Reg_0
+   741   call Sym_128
+   741   call Sym_8
+   741   Reg_0 = 3
+   741   Stack_D = Reg_0
+   741   call Sym_9
+   742   Reg_0 = 7010
+   742   Stack_D = Reg_0
+   742   call Sym_6
+   742   Reg_0 = 3
+   742   Stack_D = Reg_0
+   742   call Sym_128
+   742   call Sym_8
+   742   Reg_0 = 4
+   742   Stack_D = Reg_0
+   742   Reg_0 = 1
+   742   Stack_D = Reg_0
+   742   Reg_0 = 2
+   742   Stack_D = Reg_0
+   742   call Sym_9
+   824   Reg_0 = Data_16
+   824   Stack_D = Reg_0
+   824   Reg_0 = 53
+   824   Stack_D = Reg_0
+   824   call Sym_0
+   824   call Sym_2
+   840   Reg_0 = 7990
+   840   Stack_D = Reg_0
+   840   call Sym_6
+   840   call Sym_131
+   840   call Sym_8
+   840   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   840   Stack_D = Reg_0
+   840   call Sym_9
+   843   Reg_0 = 8020
+   843   Stack_D = Reg_0
+   843   call Sym_6
+   843   call Sym_135
+   843   call Sym_8
+   843   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   843   Stack_D = Reg_0
+   843   call Sym_9
+   846   Reg_0 = 8050
+   846   Stack_D = Reg_0
+   846   call Sym_6
+   846   call Sym_137
+   846   call Sym_8
+   846   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   846   Stack_D = Reg_0
+   846   call Sym_9
+   849   Reg_0 = 8080
+   849   Stack_D = Reg_0
+   849   call Sym_6
+   849   no-op
+           optimizes   call Sym_139
+   848   call Sym_132
+   848   Reg_0 = 1
+   848   Stack_D = Reg_0
+   848   Reg_0 = 0
+   848   Stack_D = Reg_0
+   848   call Sym_140
+   848   call Sym_134
+   848   Reg_0 = Data_20
+   848   Stack_D = Reg_0
+   848   Reg_0 = 1
+   848   Stack_D = Reg_0
+   848   call Sym_130
+   849   call Sym_8
+   849   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   849   Stack_D = Reg_0
+   849   call Sym_9
+   851   Reg_0 = 36
+   851   no-op
+           optimizes   Stack_D = Reg_0
+   851   no-op
+           optimizes   Reg_0 = Stack_D
+   851   *(Sym_141) = Reg_0
+   854   call Sym_142
+   854   no-op
+           optimizes   call Sym_17
+   854   Reg_0 = Stack_D
+   854   Reg_0 += Reg_0
+   854   no-op
+           optimizes   Stack_D = Reg_0
+   854   no-op
+           optimizes   Reg_0 = Stack_D
+   854   *(Sym_143) = Reg_0
+   863   Reg_0 = 8220
+   863   Stack_D = Reg_0
+   863   call Sym_6
+   863   call Sym_144
+   863   call Sym_8
+   863   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   863   Stack_D = Reg_0
+   863   call Sym_9
+   876   Reg_0 = 8330
+   876   Stack_D = Reg_0
+   876   call Sym_6
+   876   call Sym_146
+   876   call Sym_8
+   876   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   876   Stack_D = Reg_0
+   876   call Sym_9
+   912   Reg_0 = 8690
+   912   Stack_D = Reg_0
+   912   call Sym_6
+   912   call Sym_147
+   912   call Sym_8
+   912   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_28)
+   912   Stack_D = Reg_0
+   912   call Sym_9
+   924   Reg_0 = 8800
+   924   Stack_D = Reg_0
+   924   call Sym_6
+   924   Reg_0 = 0
+   924   Stack_D = Reg_0
+   924   Reg_0 = 0
+   924   Stack_D = Reg_0
+   924   call Sym_105
+   924   Reg_0 = 48
+   924   Stack_D = Reg_0
+   924   call Sym_106
+   924   call Sym_107
+   924   no-op
+           optimizes   call Sym_151
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   924   call Sym_152
+   924   call Sym_8
+   924   Reg_0 = 0
+   924   Stack_D = Reg_0
+   924   Reg_0 = 0
+   924   Stack_D = Reg_0
+   924   no-op
+           optimizes   call Sym_150
+   920   Reg_0 = Sym_148
+   920   Stack_D = Reg_0
+   920   call Sym_93
+   920   Reg_0 = 0
+   920   Stack_D = Reg_0
+   924   call Sym_9
+   925   Reg_0 = 8810
+   925   Stack_D = Reg_0
+   925   call Sym_6
+   925   Reg_0 = 0
+   925   Stack_D = Reg_0
+   925   Reg_0 = 0
+   925   Stack_D = Reg_0
+   925   call Sym_105
+   925   Reg_0 = 49
+   925   Stack_D = Reg_0
+   925   call Sym_106
+   925   call Sym_107
+   925   no-op
+           optimizes   call Sym_151
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   925   call Sym_152
+   925   call Sym_8
+   925   Reg_0 = 1
+   925   Stack_D = Reg_0
+   925   Reg_0 = 0
+   925   Stack_D = Reg_0
+   925   no-op
+           optimizes   call Sym_150
+   920   Reg_0 = Sym_148
+   920   Stack_D = Reg_0
+   920   call Sym_93
+   920   Reg_0 = 0
+   920   Stack_D = Reg_0
+   925   call Sym_9
+   926   Reg_0 = 8820
+   926   Stack_D = Reg_0
+   926   call Sym_6
+   926   Reg_0 = 1
+   926   Stack_D = Reg_0
+   926   Reg_0 = 0
+   926   Stack_D = Reg_0
+   926   call Sym_105
+   926   Reg_0 = 49
+   926   Stack_D = Reg_0
+   926   call Sym_106
+   926   call Sym_107
+   926   no-op
+           optimizes   call Sym_151
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   926   call Sym_152
+   926   call Sym_8
+   926   call Sym_145
+   926   call Sym_87
+   926   no-op
+           optimizes   call Sym_41
+   926   Reg_0 = Stack_D
+   926   Reg_0 += 1
+   926   Stack_D = Reg_0
+   926   Reg_0 = 0
+   926   Stack_D = Reg_0
+   926   no-op
+           optimizes   call Sym_150
+   920   Reg_0 = Sym_148
+   920   Stack_D = Reg_0
+   920   call Sym_93
+   920   Reg_0 = 0
+   920   Stack_D = Reg_0
+   926   call Sym_9
+   927   Reg_0 = 8830
+   927   Stack_D = Reg_0
+   927   call Sym_6
+   927   Reg_0 = 0
+   927   Stack_D = Reg_0
+   927   Reg_0 = 0
+   927   Stack_D = Reg_0
+   927   call Sym_105
+   927   Reg_0 = 45
+   927   Stack_D = Reg_0
+   927   call Sym_106
+   927   call Sym_107
+   927   no-op
+           optimizes   call Sym_151
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   927   call Sym_152
+   927   call Sym_8
+   927   Reg_0 = 0
+   927   Stack_D = Reg_0
+   927   Reg_0 = 0
+   927   Stack_D = Reg_0
+   927   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   927   call Sym_9
+   928   Reg_0 = 8840
+   928   Stack_D = Reg_0
+   928   call Sym_6
+   928   Reg_0 = 0
+   928   Stack_D = Reg_0
+   928   Reg_0 = 0
+   928   Stack_D = Reg_0
+   928   call Sym_105
+   928   Reg_0 = 43
+   928   Stack_D = Reg_0
+   928   call Sym_106
+   928   call Sym_107
+   928   no-op
+           optimizes   call Sym_151
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   928   call Sym_152
+   928   call Sym_8
+   928   Reg_0 = 0
+   928   Stack_D = Reg_0
+   928   Reg_0 = 0
+   928   Stack_D = Reg_0
+   928   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   928   call Sym_9
+   929   Reg_0 = 8850
+   929   Stack_D = Reg_0
+   929   call Sym_6
+   929   Reg_0 = 0
+   929   Stack_D = Reg_0
+   929   Reg_0 = 0
+   929   Stack_D = Reg_0
+   929   call Sym_105
+   929   Reg_0 = 46
+   929   Stack_D = Reg_0
+   929   call Sym_106
+   929   call Sym_107
+   929   no-op
+           optimizes   call Sym_151
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   929   call Sym_152
+   929   call Sym_8
+   929   Reg_0 = 0
+   929   Stack_D = Reg_0
+   929   Reg_0 = 0
+   929   Stack_D = Reg_0
+   929   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   929   call Sym_9
+   934   Reg_0 = 8900
+   934   Stack_D = Reg_0
+   934   call Sym_6
+   934   Reg_0 = 0
+   934   Stack_D = Reg_0
+   934   Reg_0 = 0
+   934   Stack_D = Reg_0
+   934   call Sym_105
+   934   Reg_0 = 50
+   934   Stack_D = Reg_0
+   934   call Sym_106
+   934   call Sym_107
+   934   no-op
+           optimizes   call Sym_151
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   934   Reg_0 = 16
+   934   Stack_D = Reg_0
+   934   no-op
+           optimizes   call Sym_153
+   932   call Sym_145
+   932   call Sym_87
+   932   call Sym_53
+   932   call Sym_145
+   932   call Sym_5
+   932   call Sym_152
+   932   call Sym_54
+   932   call Sym_145
+   932   call Sym_5
+   934   call Sym_8
+   934   Reg_0 = 2
+   934   Stack_D = Reg_0
+   934   Reg_0 = 0
+   934   Stack_D = Reg_0
+   934   no-op
+           optimizes   call Sym_150
+   920   Reg_0 = Sym_148
+   920   Stack_D = Reg_0
+   920   call Sym_93
+   920   Reg_0 = 0
+   920   Stack_D = Reg_0
+   934   call Sym_9
+   935   Reg_0 = 8910
+   935   Stack_D = Reg_0
+   935   call Sym_6
+   935   Reg_0 = 0
+   935   Stack_D = Reg_0
+   935   Reg_0 = 0
+   935   Stack_D = Reg_0
+   935   call Sym_105
+   935   Reg_0 = 50
+   935   Stack_D = Reg_0
+   935   call Sym_106
+   935   call Sym_107
+   935   no-op
+           optimizes   call Sym_151
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   935   Reg_0 = 2
+   935   Stack_D = Reg_0
+   935   no-op
+           optimizes   call Sym_153
+   932   call Sym_145
+   932   call Sym_87
+   932   call Sym_53
+   932   call Sym_145
+   932   call Sym_5
+   932   call Sym_152
+   932   call Sym_54
+   932   call Sym_145
+   932   call Sym_5
+   935   call Sym_8
+   935   Reg_0 = 0
+   935   Stack_D = Reg_0
+   935   Reg_0 = 0
+   935   Stack_D = Reg_0
+   935   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   935   call Sym_9
+   936   Reg_0 = 8920
+   936   Stack_D = Reg_0
+   936   call Sym_6
+   936   Reg_0 = 0
+   936   Stack_D = Reg_0
+   936   Reg_0 = 0
+   936   Stack_D = Reg_0
+   936   call Sym_105
+   936   Reg_0 = 70
+   936   Stack_D = Reg_0
+   936   call Sym_106
+   936   call Sym_107
+   936   no-op
+           optimizes   call Sym_151
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   936   Reg_0 = 16
+   936   Stack_D = Reg_0
+   936   no-op
+           optimizes   call Sym_153
+   932   call Sym_145
+   932   call Sym_87
+   932   call Sym_53
+   932   call Sym_145
+   932   call Sym_5
+   932   call Sym_152
+   932   call Sym_54
+   932   call Sym_145
+   932   call Sym_5
+   936   call Sym_8
+   936   Reg_0 = 15
+   936   Stack_D = Reg_0
+   936   Reg_0 = 0
+   936   Stack_D = Reg_0
+   936   no-op
+           optimizes   call Sym_150
+   920   Reg_0 = Sym_148
+   920   Stack_D = Reg_0
+   920   call Sym_93
+   920   Reg_0 = 0
+   920   Stack_D = Reg_0
+   936   call Sym_9
+   937   Reg_0 = 8930
+   937   Stack_D = Reg_0
+   937   call Sym_6
+   937   Reg_0 = 0
+   937   Stack_D = Reg_0
+   937   Reg_0 = 0
+   937   Stack_D = Reg_0
+   937   call Sym_105
+   937   Reg_0 = 71
+   937   Stack_D = Reg_0
+   937   call Sym_106
+   937   call Sym_107
+   937   no-op
+           optimizes   call Sym_151
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   937   Reg_0 = 16
+   937   Stack_D = Reg_0
+   937   no-op
+           optimizes   call Sym_153
+   932   call Sym_145
+   932   call Sym_87
+   932   call Sym_53
+   932   call Sym_145
+   932   call Sym_5
+   932   call Sym_152
+   932   call Sym_54
+   932   call Sym_145
+   932   call Sym_5
+   937   call Sym_8
+   937   Reg_0 = 0
+   937   Stack_D = Reg_0
+   937   Reg_0 = 0
+   937   Stack_D = Reg_0
+   937   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   937   call Sym_9
+   938   Reg_0 = 8940
+   938   Stack_D = Reg_0
+   938   call Sym_6
+   938   Reg_0 = 0
+   938   Stack_D = Reg_0
+   938   Reg_0 = 0
+   938   Stack_D = Reg_0
+   938   call Sym_105
+   938   Reg_0 = 71
+   938   Stack_D = Reg_0
+   938   call Sym_106
+   938   call Sym_107
+   938   no-op
+           optimizes   call Sym_151
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   938   Reg_0 = 36
+           optimizes   Reg_0 = *(Sym_141)
+   938   Stack_D = Reg_0
+   938   no-op
+           optimizes   call Sym_153
+   932   call Sym_145
+   932   call Sym_87
+   932   call Sym_53
+   932   call Sym_145
+   932   call Sym_5
+   932   call Sym_152
+   932   call Sym_54
+   932   call Sym_145
+   932   call Sym_5
+   938   call Sym_8
+   938   Reg_0 = 16
+   938   Stack_D = Reg_0
+   938   Reg_0 = 0
+   938   Stack_D = Reg_0
+   938   no-op
+           optimizes   call Sym_150
+   920   Reg_0 = Sym_148
+   920   Stack_D = Reg_0
+   920   call Sym_93
+   920   Reg_0 = 0
+   920   Stack_D = Reg_0
+   938   call Sym_9
+   939   Reg_0 = 8950
+   939   Stack_D = Reg_0
+   939   call Sym_6
+   939   Reg_0 = 0
+   939   Stack_D = Reg_0
+   939   Reg_0 = 0
+   939   Stack_D = Reg_0
+   939   call Sym_105
+   939   Reg_0 = 90
+   939   Stack_D = Reg_0
+   939   call Sym_106
+   939   call Sym_107
+   939   no-op
+           optimizes   call Sym_151
+   922   Reg_0 = Sym_148
+   922   Stack_D = Reg_0
+   922   call Sym_96
+   922   no-op
+           optimizes   call Sym_149
+   919   Reg_0 = Sym_148
+   919   Stack_D = Reg_0
+   919   Reg_0 = 1
+   919   Stack_D = Reg_0
+   939   Reg_0 = 36
+           optimizes   Reg_0 = *(Sym_141)
+   939   Stack_D = Reg_0
+   939   no-op
+           optimizes   call Sym_153
+   932   call Sym_145
+   932   call Sym_87
+   932   call Sym_53
+   932   call Sym_145
+   932   call Sym_5
+   932   call Sym_152
+   932   call Sym_54
+   932   call Sym_145
+   932   call Sym_5
+   939   call Sym_8
+   939   Reg_0 = 35
+   939   Stack_D = Reg_0
+   939   Reg_0 = 0
+   939   Stack_D = Reg_0
+   939   no-op
+           optimizes   call Sym_150
+   920   Reg_0 = Sym_148
+   920   Stack_D = Reg_0
+   920   call Sym_93
+   920   Reg_0 = 0
+   920   Stack_D = Reg_0
+   939   call Sym_9
+   946   Reg_0 = 9020
+   946   Stack_D = Reg_0
+   946   call Sym_6
+   946   Reg_0 = 0
+   946   Stack_D = Reg_0
+   946   Reg_0 = 0
+   946   Stack_D = Reg_0
+   946   Reg_0 = 2
+   946   Stack_D = Reg_0
+   946   call Sym_154
+   946   call Sym_8
+   946   Reg_0 = 0
+   946   Stack_D = Reg_0
+   946   Reg_0 = 0
+   946   Stack_D = Reg_0
+   946   Reg_0 = 0
+   946   Stack_D = Reg_0
+   946   call Sym_9
+   947   Reg_0 = 9030
+   947   Stack_D = Reg_0
+   947   call Sym_6
+   947   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   947   Stack_D = Reg_0
+   947   Reg_0 = 0
+   947   Stack_D = Reg_0
+   947   Reg_0 = 2
+   947   Stack_D = Reg_0
+   947   call Sym_154
+   947   call Sym_8
+   947   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   947   Stack_D = Reg_0
+   947   Reg_0 = 0
+   947   Stack_D = Reg_0
+   947   Reg_0 = 0
+   947   Stack_D = Reg_0
+   947   call Sym_9
+   949   Reg_0 = 9050
+   949   Stack_D = Reg_0
+   949   call Sym_6
+   949   Reg_0 = 0
+   949   Stack_D = Reg_0
+   949   Reg_0 = 0
+   949   Stack_D = Reg_0
+   949   Reg_0 = 36
+           optimizes   Reg_0 = *(Sym_141)
+   949   Stack_D = Reg_0
+   949   call Sym_154
+   949   call Sym_8
+   949   Reg_0 = 0
+   949   Stack_D = Reg_0
+   949   Reg_0 = 0
+   949   Stack_D = Reg_0
+   949   Reg_0 = 0
+   949   Stack_D = Reg_0
+   949   call Sym_9
+   950   Reg_0 = 9060
+   950   Stack_D = Reg_0
+   950   call Sym_6
+   950   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   950   Stack_D = Reg_0
+   950   Reg_0 = 0
+   950   Stack_D = Reg_0
+   950   Reg_0 = 36
+           optimizes   Reg_0 = *(Sym_141)
+   950   Stack_D = Reg_0
+   950   call Sym_154
+   950   call Sym_8
+   950   Reg_0 = -1
+           optimizes   Reg_0 = *(Sym_22)
+   950   Stack_D = Reg_0
+   950   Reg_0 = 0
+   950   Stack_D = Reg_0
+   950   Reg_0 = 0
+   950   Stack_D = Reg_0
+   950   call Sym_9
+   955   Reg_0 = 9110
+   955   Stack_D = Reg_0
+   955   call Sym_6
+   955   no-op
+           optimizes   call Sym_155
+   954   call Sym_145
+   954   call Sym_87
+   954   call Sym_53
+   954   call Sym_156
+   954   call Sym_145
+   954   call Sym_87
+   954   call Sym_157
+   954   call Sym_145
+   954   call Sym_87
+   954   call Sym_54
+   954   call Sym_145
+   954   call Sym_5
+   955   call Sym_8
+   955   Reg_0 = 16
+   955   Stack_D = Reg_0
+   955   Reg_0 = 10
+   955   Stack_D = Reg_0
+   955   call Sym_9
+   958   Reg_0 = Data_22
+   958   Stack_D = Reg_0
+   958   Reg_0 = 17
+   958   Stack_D = Reg_0
+   958   call Sym_0
+   958   call Sym_2
+   964   Reg_0 = 18
+   964   Stack_D = Reg_0
+   964   Reg_0 = Sym_159
+   964   Stack_D = Reg_0
+   964   call Sym_96
+   964   Reg_0 = 52
+   964   Stack_D = Reg_0
+   964   Reg_0 = Sym_159
+   964   Stack_D = Reg_0
+   964   call Sym_93
+   964   call Sym_96
+   964   Reg_0 = 86
+   964   Stack_D = Reg_0
+   964   Reg_0 = Sym_159
+   964   Stack_D = Reg_0
+   964   call Sym_93
+   964   call Sym_93
+   964   call Sym_96
+   967   Reg_0 = 9220
+   967   Stack_D = Reg_0
+   967   call Sym_6
+   967   Reg_0 = Sym_158
+   967   Stack_D = Reg_0
+   967   Reg_0 = 0
+   967   Stack_D = Reg_0
+   967   Reg_0 = 32
+   967   Stack_D = Reg_0
+   967   call Sym_161
+   967   call Sym_8
+   967   call Sym_9
+   968   Reg_0 = 9230
+   968   Stack_D = Reg_0
+   968   call Sym_6
+   968   no-op
+           optimizes   call Sym_160
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_93
+   965   call Sym_95
+   968   call Sym_8
+   968   Reg_0 = 0
+   968   Stack_D = Reg_0
+   968   Reg_0 = 0
+   968   Stack_D = Reg_0
+   968   Reg_0 = 0
+   968   Stack_D = Reg_0
+   968   call Sym_9
+   970   Reg_0 = 9250
+   970   Stack_D = Reg_0
+   970   call Sym_6
+   970   Reg_0 = Sym_158
+   970   Stack_D = Reg_0
+   970   Reg_0 = 1
+   970   Stack_D = Reg_0
+   970   Reg_0 = 32
+   970   Stack_D = Reg_0
+   970   call Sym_161
+   970   call Sym_8
+   970   call Sym_9
+   971   Reg_0 = 9260
+   971   Stack_D = Reg_0
+   971   call Sym_6
+   971   no-op
+           optimizes   call Sym_160
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_93
+   965   call Sym_95
+   971   call Sym_8
+   971   Reg_0 = 32
+   971   Stack_D = Reg_0
+   971   Reg_0 = 0
+   971   Stack_D = Reg_0
+   971   Reg_0 = 0
+   971   Stack_D = Reg_0
+   971   call Sym_9
+   973   Reg_0 = 9280
+   973   Stack_D = Reg_0
+   973   call Sym_6
+   973   Reg_0 = Sym_158
+   973   Stack_D = Reg_0
+   973   Reg_0 = 3
+   973   Stack_D = Reg_0
+   973   Reg_0 = 32
+   973   Stack_D = Reg_0
+   973   call Sym_161
+   973   call Sym_8
+   973   call Sym_9
+   974   Reg_0 = 9290
+   974   Stack_D = Reg_0
+   974   call Sym_6
+   974   no-op
+           optimizes   call Sym_160
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_93
+   965   call Sym_95
+   974   call Sym_8
+   974   Reg_0 = 32
+   974   Stack_D = Reg_0
+   974   Reg_0 = 32
+   974   Stack_D = Reg_0
+   974   Reg_0 = 32
+   974   Stack_D = Reg_0
+   974   call Sym_9
+   976   Reg_0 = 9310
+   976   Stack_D = Reg_0
+   976   call Sym_6
+   976   Reg_0 = Sym_158
+   976   Stack_D = Reg_0
+   976   Reg_0 = Sym_158
+   976   Stack_D = Reg_0
+   976   Reg_0 = 3
+           optimizes   Reg_0 = 3
+   976   Stack_D = Reg_0
+   976   no-op
+           optimizes   call Sym_94
+   976   call Sym_162
+   976   call Sym_8
+   976   call Sym_9
+   977   Reg_0 = 9320
+   977   Stack_D = Reg_0
+   977   call Sym_6
+   977   no-op
+           optimizes   call Sym_160
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_93
+   965   call Sym_95
+   977   call Sym_8
+   977   Reg_0 = 32
+   977   Stack_D = Reg_0
+   977   Reg_0 = 32
+   977   Stack_D = Reg_0
+   977   Reg_0 = 32
+   977   Stack_D = Reg_0
+   977   call Sym_9
+   979   Reg_0 = 9340
+   979   Stack_D = Reg_0
+   979   call Sym_6
+   979   Reg_0 = Sym_159
+   979   Stack_D = Reg_0
+   979   Reg_0 = Sym_158
+   979   Stack_D = Reg_0
+   979   Reg_0 = 0
+           optimizes   Reg_0 = 0
+   979   Stack_D = Reg_0
+   979   no-op
+           optimizes   call Sym_94
+   979   call Sym_162
+   979   call Sym_8
+   979   call Sym_9
+   980   Reg_0 = 9350
+   980   Stack_D = Reg_0
+   980   call Sym_6
+   980   no-op
+           optimizes   call Sym_160
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_93
+   965   call Sym_95
+   980   call Sym_8
+   980   Reg_0 = 32
+   980   Stack_D = Reg_0
+   980   Reg_0 = 32
+   980   Stack_D = Reg_0
+   980   Reg_0 = 32
+   980   Stack_D = Reg_0
+   980   call Sym_9
+   982   Reg_0 = 9370
+   982   Stack_D = Reg_0
+   982   call Sym_6
+   982   Reg_0 = Sym_159
+   982   Stack_D = Reg_0
+   982   Reg_0 = Sym_158
+   982   Stack_D = Reg_0
+   982   Reg_0 = 1
+           optimizes   Reg_0 = 1
+   982   Stack_D = Reg_0
+   982   no-op
+           optimizes   call Sym_94
+   982   call Sym_162
+   982   call Sym_8
+   982   call Sym_9
+   983   Reg_0 = 9380
+   983   Stack_D = Reg_0
+   983   call Sym_6
+   983   no-op
+           optimizes   call Sym_160
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_93
+   965   call Sym_95
+   983   call Sym_8
+   983   Reg_0 = 18
+   983   Stack_D = Reg_0
+   983   Reg_0 = 32
+   983   Stack_D = Reg_0
+   983   Reg_0 = 32
+   983   Stack_D = Reg_0
+   983   call Sym_9
+   985   Reg_0 = 9400
+   985   Stack_D = Reg_0
+   985   call Sym_6
+   985   Reg_0 = Sym_159
+   985   Stack_D = Reg_0
+   985   Reg_0 = Sym_158
+   985   Stack_D = Reg_0
+   985   Reg_0 = 3
+           optimizes   Reg_0 = 3
+   985   Stack_D = Reg_0
+   985   no-op
+           optimizes   call Sym_94
+   985   call Sym_162
+   985   call Sym_8
+   985   call Sym_9
+   986   Reg_0 = 9410
+   986   Stack_D = Reg_0
+   986   call Sym_6
+   986   no-op
+           optimizes   call Sym_160
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_93
+   965   call Sym_95
+   986   call Sym_8
+   986   Reg_0 = 18
+   986   Stack_D = Reg_0
+   986   Reg_0 = 52
+   986   Stack_D = Reg_0
+   986   Reg_0 = 86
+   986   Stack_D = Reg_0
+   986   call Sym_9
+   988   Reg_0 = 9430
+   988   Stack_D = Reg_0
+   988   call Sym_6
+   988   Reg_0 = Sym_158
+   988   Stack_D = Reg_0
+   988   Reg_0 = Sym_158
+   988   Stack_D = Reg_0
+   988   call Sym_93
+   988   Reg_0 = 2
+           optimizes   Reg_0 = 2
+   988   Stack_D = Reg_0
+   988   no-op
+           optimizes   call Sym_94
+   988   call Sym_162
+   988   call Sym_8
+   988   call Sym_9
+   989   Reg_0 = 9440
+   989   Stack_D = Reg_0
+   989   call Sym_6
+   989   no-op
+           optimizes   call Sym_160
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_93
+   965   call Sym_95
+   989   call Sym_8
+   989   Reg_0 = 18
+   989   Stack_D = Reg_0
+   989   Reg_0 = 18
+   989   Stack_D = Reg_0
+   989   Reg_0 = 52
+   989   Stack_D = Reg_0
+   989   call Sym_9
+   991   Reg_0 = 9460
+   991   Stack_D = Reg_0
+   991   call Sym_6
+   991   Reg_0 = Sym_158
+   991   Stack_D = Reg_0
+   991   call Sym_93
+   991   Reg_0 = Sym_158
+   991   Stack_D = Reg_0
+   991   Reg_0 = 2
+           optimizes   Reg_0 = 2
+   991   Stack_D = Reg_0
+   991   no-op
+           optimizes   call Sym_94
+   991   call Sym_162
+   991   call Sym_8
+   991   call Sym_9
+   992   Reg_0 = 9470
+   992   Stack_D = Reg_0
+   992   call Sym_6
+   992   no-op
+           optimizes   call Sym_160
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_95
+   965   Reg_0 = Sym_158
+   965   Stack_D = Reg_0
+   965   call Sym_93
+   965   call Sym_93
+   965   call Sym_95
+   992   call Sym_8
+   992   Reg_0 = 18
+   992   Stack_D = Reg_0
+   992   Reg_0 = 52
+   992   Stack_D = Reg_0
+   992   Reg_0 = 52
+   992   Stack_D = Reg_0
+   992   call Sym_9
+   995   Reg_0 = Data_23
+   995   Stack_D = Reg_0
+   995   Reg_0 = 54
+   995   Stack_D = Reg_0
+   995   call Sym_0
+   995   call Sym_2
+  1013   Reg_0 = 9680
+  1013   Stack_D = Reg_0
+  1013   call Sym_6
+  1013   call Sym_163
+  1013   call Sym_8
+  1013   call Sym_9
+  1016   Reg_0 = Data_34
+  1016   Stack_D = Reg_0
+  1016   Reg_0 = 21
+  1016   Stack_D = Reg_0
+  1016   call Sym_0
+  1016   call Sym_2
+  1027   Reg_0 = 9820
+  1027   Stack_D = Reg_0
+  1027   call Sym_6
+  1027   call Sym_171
+  1027   call Sym_8
+  1027   call Sym_9
+  1037   call Sym_173
+  1037   call Sym_87
+  1037   tail call Sym_48
+           optimizes   call Sym_48
+  1037   no-op
+           optimizes label Label_0
+  1037 }
+
+Peephole rewrites:
+  v4_gd3: redundant-test: test %edx,%edx => (none)
+  v4_gd5: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_gd5: redundant-test: test %edx,%edx => (none)
+  v4_gd6: redundant-test: test %edx,%edx => (none)
+  v4_s_Equals: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_s_Equals: redundant-test: test %edx,%edx => (none)
+  v4_gp5: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_gp6: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_gp6: redundant-test: test %edx,%edx => (none)
+  v4_gp7: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_gp7: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_output_Minustest: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_output_Minustest: redundant-test: test %edx,%edx => (none)
+  v4_output_Minustest: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_output_Minustest: redundant-test: test %edx,%edx => (none)
+  v4_output_Minustest: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_output_Minustest: redundant-test: test %edx,%edx => (none)
+  v4_output_Minustest: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_output_Minustest: redundant-test: test %edx,%edx => (none)
+  main: redundant-test: test %eax,%eax => (none)
+  main: redundant-test: test %eax,%eax => (none)
+  main: redundant-test: test %eax,%eax => (none)
+  main: redundant-test: test %eax,%eax => (none)
+  main: redundant-test: test %eax,%eax => (none)
+  main: redundant-test: test %eax,%eax => (none)
+
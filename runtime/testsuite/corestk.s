@@ -0,0 +1,28612 @@
+	.file	"corestk.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/testsuite/",100,0,0,Ltext0
+.stabs	"corestk.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC32:
+	.string "  SIGNED: "
+.LC18:
+	.string "--"
+.LC19:
+	.string "01"
+.LC20:
+	.string "1"
+.LC21:
+	.string "10"
+.LC17:
+	.string "BA"
+.LC29:
+	.string "LINE 1"
+.LC30:
+	.string "LINE 2"
+.LC35:
+	.string "PLEASE TYPE UP TO 80 CHARACTERS:"
+.LC36:
+	.string "RECEIVED: "
+.LC13:
+	.string "TESTING ' ['] FIND EXECUTE IMMEDIATE COUNT LITERAL POSTPONE STATE"
+.LC2:
+	.string "TESTING 2* 2/ LSHIFT RSHIFT"
+.LC16:
+	.string "TESTING <# # #S #> HOLD SIGN BASE >NUMBER HEX DECIMAL"
+.LC6:
+	.string "TESTING >R R> R@"
+.LC7:
+	.string "TESTING ADD/SUBTRACT: + - 1+ 1- ABS NEGATE"
+.LC1:
+	.string "TESTING BOOLEANS: INVERT AND OR XOR"
+.LC4:
+	.string "TESTING CELL WIDTH LITERALS"
+.LC11:
+	.string "TESTING CHAR [CHAR] [ ] BL S_quotes"
+.LC3:
+	.string "TESTING COMPARISONS: 0= = 0< < > U< U> U<= U>= MIN MAX"
+.LC0:
+	.string "TESTING CORE WORDS"
+.LC9:
+	.string "TESTING DIVIDE: FM/MOD SM/REM UM/MOD */ */MOD / /MOD MOD"
+.LC15:
+	.string "TESTING DO LOOP +LOOP I J UNLOOP LEAVE EXIT"
+.LC22:
+	.string "TESTING FILL MOVE"
+.LC10:
+	.string "TESTING HERE , @ ! CELL+ CELLS C, C@ C! CHARS 2@ 2! ALIGN ALIGNED +! ALLOT"
+.LC14:
+	.string "TESTING IF ELSE THEN BEGIN WHILE REPEAT UNTIL RECURSE"
+.LC34:
+	.string "TESTING INPUT: ACCEPT"
+.LC8:
+	.string "TESTING MULTIPLY: S>D * M* UM*"
+.LC23:
+	.string "TESTING OUTPUT: . ._quote CR EMIT SPACE SPACES TYPE U."
+.LC5:
+	.string "TESTING STACK OPS: 2DROP 2DUP 2OVER 2SWAP ?DUP DEPTH DROP DUP OVER ROT SWAP"
+.LC33:
+	.string "UNSIGNED: "
+.LC12:
+	.string "XY"
+.LC27:
+	.string "YOU SHOULD SEE 0-5 SEPARATED BY TWO SPACES:"
+.LC25:
+	.string "YOU SHOULD SEE 0-9 (WITH NO SPACES):"
+.LC24:
+	.string "YOU SHOULD SEE 0-9 SEPARATED BY A SPACE:"
+.LC26:
+	.string "YOU SHOULD SEE A-G SEPARATED BY A SPACE:"
+.LC31:
+	.string "YOU SHOULD SEE THE NUMBER RANGES OF SIGNED AND UNSIGNED NUMBERS:"
+.LC28:
+	.string "YOU SHOULD SEE TWO SEPARATE LINES:"
+.stabs	"v4_Hashbits_Minusud:G2",40,0,0,v4_Hashbits_Minusud
+	.comm  v4_Hashbits_Minusud,4,4
+.stabs	"v4_Lessfalse_Greater:G2",40,0,0,v4_Lessfalse_Greater
+	.comm  v4_Lessfalse_Greater,4,4
+.stabs	"v4_Lesstrue_Greater:G2",40,0,0,v4_Lesstrue_Greater
+	.comm  v4_Lesstrue_Greater,4,4
+.stabs	"v4_abuf:Gar2;0;79;4",40,0,0,v4_abuf
+	.comm  v4_abuf,80,32
+.stabs	"v4_fbuf:Gar2;0;2;4",40,0,0,v4_fbuf
+	.comm  v4_fbuf,3,1
+.stabs	"v4_gn_Minusbuf:Gar2;0;9;4",40,0,0,v4_gn_Minusbuf
+	.comm  v4_gn_Minusbuf,10,1
+.stabs	"v4_hbuf:Gar2;0;255;4",40,0,0,v4_hbuf
+	.comm  v4_hbuf,256,32
+.stabs	"v4_max_Minusbase:G2",40,0,0,v4_max_Minusbase
+	.comm  v4_max_Minusbase,4,4
+.stabs	"v4_max_Minusint:G2",40,0,0,v4_max_Minusint
+	.comm  v4_max_Minusint,4,4
+.stabs	"v4_max_Minusuint:G2",40,0,0,v4_max_Minusuint
+	.comm  v4_max_Minusuint,4,4
+.stabs	"v4_mid_Minusuint:G2",40,0,0,v4_mid_Minusuint
+	.comm  v4_mid_Minusuint,4,4
+.stabs	"v4_mid_Minusuint_Plus1:G2",40,0,0,v4_mid_Minusuint_Plus1
+	.comm  v4_mid_Minusuint_Plus1,4,4
+.stabs	"v4_min_Minusint:G2",40,0,0,v4_min_Minusint
+	.comm  v4_min_Minusint,4,4
+.stabs	"v4_msb:G2",40,0,0,v4_msb
+	.comm  v4_msb,4,4
+.stabs	"v4_sbuf:Gar2;0;2;4",40,0,0,v4_sbuf
+	.comm  v4_sbuf,3,1
+.stabs	"v4_x:G2",40,0,0,v4_x
+	.comm  v4_x,4,4
+.stabs	"v4_z0s:G2",40,0,0,v4_z0s
+	.comm  v4_z0s,4,4
+.stabs	"v4_z1s:G2",40,0,0,v4_z1s
+	.comm  v4_z1s,4,4
+.stabs	"v4_z1st:G2",40,0,0,v4_z1st
+	.comm  v4_z1st,4,4
+.stabs	"v4_z1stc:G2",40,0,0,v4_z1stc
+	.comm  v4_z1stc,4,4
+.stabs	"v4_z2nd:G2",40,0,0,v4_z2nd
+	.comm  v4_z2nd,4,4
+.stabs	"v4_z2ndc:G2",40,0,0,v4_z2ndc
+	.comm  v4_z2ndc,4,4
+.text
+	.align 4
+.stabs "v4_find_Minusmsb:F1",36,0,0,v4_find_Minusmsb
+.globl v4_find_Minusmsb
+	.type	v4_find_Minusmsb,@function
+v4_find_Minusmsb:
+.stabn 68,0,53,.LMa0-v4_find_Minusmsb
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,53,.LMb0-v4_find_Minusmsb
+.LMb0:
+.LBB15:
+.stabn 68,0,54,.LM1-v4_find_Minusmsb
+.LM1:
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS0
+	call v4__dscheck
+.LDS0:
+.L2:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS1
+	call v4__dscheck
+.LDS1:
+	test %eax,%eax
+	je .L3
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS2
+	call v4__dscheck
+.LDS2:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS3
+	call v4__dscheck
+.LDS3:
+	jmp .L2
+.L3:
+	mov %ecx,v4__dsindex
+.LBE15:
+.stabn 68,0,54,.LM18-v4_find_Minusmsb
+.LM18:
+	pop %ebx
+	leave
+	ret
+.Lfe15:
+	.size	 v4_find_Minusmsb,.Lfe15-v4_find_Minusmsb
+.stabn	192,0,0,.LBB15-v4_find_Minusmsb
+.stabn	224,0,0,.LBE15-v4_find_Minusmsb
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4_find_Minusmsb
+.text
+	.align 4
+.stabs "v4_gr1:F1",36,0,0,v4_gr1
+.globl v4_gr1
+	.type	v4_gr1,@function
+v4_gr1:
+.stabn 68,0,262,.LMa19-v4_gr1
+.LMa19:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,262,.LMb19-v4_gr1
+.LMb19:
+.LBB52:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-8(%ebp)
+	mov -8(%ebp),%eax
+	cmp $4080,%ecx
+	jbe .LDS4
+	call v4__dscheck
+.LDS4:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS5
+	call v4__dscheck
+.LDS5:
+	mov %ecx,v4__dsindex
+.LBE52:
+.stabn 68,0,262,.LM27-v4_gr1
+.LM27:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe52:
+	.size	 v4_gr1,.Lfe52-v4_gr1
+.stabn	192,0,0,.LBB52-v4_gr1
+.stabn	224,0,0,.LBE52-v4_gr1
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4_gr1
+.text
+	.align 4
+.stabs "v4_gr2:F1",36,0,0,v4_gr2
+.globl v4_gr2
+	.type	v4_gr2,@function
+v4_gr2:
+.stabn 68,0,263,.LMa28-v4_gr2
+.LMa28:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,263,.LMb28-v4_gr2
+.LMb28:
+.LBB55:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-8(%ebp)
+	mov -8(%ebp),%eax
+	cmp $4080,%ecx
+	jbe .LDS6
+	call v4__dscheck
+.LDS6:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -8(%ebp),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS7
+	call v4__dscheck
+.LDS7:
+	mov %ecx,v4__dsindex
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE55:
+.stabn 68,0,263,.LM40-v4_gr2
+.LM40:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe55:
+	.size	 v4_gr2,.Lfe55-v4_gr2
+.stabn	192,0,0,.LBB55-v4_gr2
+.stabn	224,0,0,.LBE55-v4_gr2
+.Lscope55:
+.stabs	"",36,0,0,.Lscope55-v4_gr2
+.text
+	.align 4
+.stabs "v4_t_Slashmod:F1",36,0,0,v4_t_Slashmod
+.globl v4_t_Slashmod
+	.type	v4_t_Slashmod,@function
+v4_t_Slashmod:
+.stabn 68,0,459,.LMa41-v4_t_Slashmod
+.LMa41:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,459,.LMb41-v4_t_Slashmod
+.LMb41:
+.LBB69:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	pop %ebx
+	leave
+	jmp v4_sm_Slashrem
+.LBE69:
+.stabn 68,0,459,.LM47-v4_t_Slashmod
+.LM47:
+	pop %ebx
+	leave
+	ret
+.Lfe69:
+	.size	 v4_t_Slashmod,.Lfe69-v4_t_Slashmod
+.stabn	192,0,0,.LBB69-v4_t_Slashmod
+.stabn	224,0,0,.LBE69-v4_t_Slashmod
+.Lscope69:
+.stabs	"",36,0,0,.Lscope69-v4_t_Slashmod
+.text
+	.align 4
+.stabs "v4_t_Slash:F1",36,0,0,v4_t_Slash
+.globl v4_t_Slash
+	.type	v4_t_Slash,@function
+v4_t_Slash:
+.stabn 68,0,460,.LMa48-v4_t_Slash
+.LMa48:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,460,.LMb48-v4_t_Slash
+.LMb48:
+.LBB70:
+.stabn 68,0,459,.LM50-v4_t_Slash
+.LM50:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM54-v4_t_Slash
+.LM54:
+	call v4_swap
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE70:
+.stabn 68,0,460,.LM57-v4_t_Slash
+.LM57:
+	pop %ebx
+	leave
+	ret
+.Lfe70:
+	.size	 v4_t_Slash,.Lfe70-v4_t_Slash
+.stabn	192,0,0,.LBB70-v4_t_Slash
+.stabn	224,0,0,.LBE70-v4_t_Slash
+.Lscope70:
+.stabs	"",36,0,0,.Lscope70-v4_t_Slash
+.text
+	.align 4
+.stabs "v4_tmod:F1",36,0,0,v4_tmod
+.globl v4_tmod
+	.type	v4_tmod,@function
+v4_tmod:
+.stabn 68,0,461,.LMa58-v4_tmod
+.LMa58:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,461,.LMb58-v4_tmod
+.LMb58:
+.LBB71:
+.stabn 68,0,459,.LM60-v4_tmod
+.LM60:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM64-v4_tmod
+.LM64:
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE71:
+.stabn 68,0,461,.LM66-v4_tmod
+.LM66:
+	pop %ebx
+	leave
+	ret
+.Lfe71:
+	.size	 v4_tmod,.Lfe71-v4_tmod
+.stabn	192,0,0,.LBB71-v4_tmod
+.stabn	224,0,0,.LBE71-v4_tmod
+.Lscope71:
+.stabs	"",36,0,0,.Lscope71-v4_tmod
+.text
+	.align 4
+.stabs "v4_t_Star_Slashmod:F1",36,0,0,v4_t_Star_Slashmod
+.globl v4_t_Star_Slashmod
+	.type	v4_t_Star_Slashmod,@function
+v4_t_Star_Slashmod:
+.stabn 68,0,462,.LMa67-v4_t_Star_Slashmod
+.LMa67:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,462,.LMb67-v4_t_Star_Slashmod
+.LMb67:
+.LBB72:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	pop %ebx
+	leave
+	jmp v4_sm_Slashrem
+.LBE72:
+.stabn 68,0,462,.LM73-v4_t_Star_Slashmod
+.LM73:
+	pop %ebx
+	leave
+	ret
+.Lfe72:
+	.size	 v4_t_Star_Slashmod,.Lfe72-v4_t_Star_Slashmod
+.stabn	192,0,0,.LBB72-v4_t_Star_Slashmod
+.stabn	224,0,0,.LBE72-v4_t_Star_Slashmod
+.Lscope72:
+.stabs	"",36,0,0,.Lscope72-v4_t_Star_Slashmod
+.text
+	.align 4
+.stabs "v4_t_Star_Slash:F1",36,0,0,v4_t_Star_Slash
+.globl v4_t_Star_Slash
+	.type	v4_t_Star_Slash,@function
+v4_t_Star_Slash:
+.stabn 68,0,463,.LMa74-v4_t_Star_Slash
+.LMa74:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,463,.LMb74-v4_t_Star_Slash
+.LMb74:
+.LBB73:
+.stabn 68,0,462,.LM76-v4_t_Star_Slash
+.LM76:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM80-v4_t_Star_Slash
+.LM80:
+	call v4_swap
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE73:
+.stabn 68,0,463,.LM83-v4_t_Star_Slash
+.LM83:
+	pop %ebx
+	leave
+	ret
+.Lfe73:
+	.size	 v4_t_Star_Slash,.Lfe73-v4_t_Star_Slash
+.stabn	192,0,0,.LBB73-v4_t_Star_Slash
+.stabn	224,0,0,.LBE73-v4_t_Star_Slash
+.Lscope73:
+.stabs	"",36,0,0,.Lscope73-v4_t_Star_Slash
+.text
+	.align 4
+.stabs "v4_gc1:F1",36,0,0,v4_gc1
+.globl v4_gc1
+	.type	v4_gc1,@function
+v4_gc1:
+.stabn 68,0,633,.LMa84-v4_gc1
+.LMa84:
+.stabn 68,0,633,.LMb84-v4_gc1
+.LMb84:
+.LBB102:
+	mov $88,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS8
+	call v4__dscheck
+.LDS8:
+	mov %ecx,v4__dsindex
+.LBE102:
+.stabn 68,0,633,.LM88-v4_gc1
+.LM88:
+	ret
+.Lfe102:
+	.size	 v4_gc1,.Lfe102-v4_gc1
+.stabn	192,0,0,.LBB102-v4_gc1
+.stabn	224,0,0,.LBE102-v4_gc1
+.Lscope102:
+.stabs	"",36,0,0,.Lscope102-v4_gc1
+.text
+	.align 4
+.stabs "v4_gc2:F1",36,0,0,v4_gc2
+.globl v4_gc2
+	.type	v4_gc2,@function
+v4_gc2:
+.stabn 68,0,634,.LMa89-v4_gc2
+.LMa89:
+.stabn 68,0,634,.LMb89-v4_gc2
+.LMb89:
+.LBB103:
+	mov $72,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS9
+	call v4__dscheck
+.LDS9:
+	mov %ecx,v4__dsindex
+.LBE103:
+.stabn 68,0,634,.LM93-v4_gc2
+.LM93:
+	ret
+.Lfe103:
+	.size	 v4_gc2,.Lfe103-v4_gc2
+.stabn	192,0,0,.LBB103-v4_gc2
+.stabn	224,0,0,.LBE103-v4_gc2
+.Lscope103:
+.stabs	"",36,0,0,.Lscope103-v4_gc2
+.text
+	.align 4
+.stabs "v4_gc3:F1",36,0,0,v4_gc3
+.globl v4_gc3
+	.type	v4_gc3,@function
+v4_gc3:
+.stabn 68,0,637,.LMa94-v4_gc3
+.LMa94:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,637,.LMb94-v4_gc3
+.LMb94:
+.LBB104:
+	call v4_Leftbracket
+.stabn 68,0,633,.LM97-v4_gc3
+.LM97:
+	mov $88,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,637,.LM99-v4_gc3
+.LM99:
+	cmp $4080,%ecx
+	jbe .LDS10
+	call v4__dscheck
+.LDS10:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	pop %ebx
+	leave
+	jmp v4_literal
+.LBE104:
+.stabn 68,0,637,.LM102-v4_gc3
+.LM102:
+	pop %ebx
+	leave
+	ret
+.Lfe104:
+	.size	 v4_gc3,.Lfe104-v4_gc3
+.stabn	192,0,0,.LBB104-v4_gc3
+.stabn	224,0,0,.LBE104-v4_gc3
+.Lscope104:
+.stabs	"",36,0,0,.Lscope104-v4_gc3
+.text
+	.align 4
+.stabs "v4_gc4:F1",36,0,0,v4_gc4
+.globl v4_gc4
+	.type	v4_gc4,@function
+v4_gc4:
+.stabn 68,0,639,.LMa103-v4_gc4
+.LMa103:
+.stabn 68,0,639,.LMb103-v4_gc4
+.LMb103:
+.LBB108:
+	lea .LC12,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS11
+	call v4__dscheck
+.LDS11:
+	mov %ecx,v4__dsindex
+.LBE108:
+.stabn 68,0,639,.LM109-v4_gc4
+.LM109:
+	ret
+.Lfe108:
+	.size	 v4_gc4,.Lfe108-v4_gc4
+.stabn	192,0,0,.LBB108-v4_gc4
+.stabn	224,0,0,.LBE108-v4_gc4
+.Lscope108:
+.stabs	"",36,0,0,.Lscope108-v4_gc4
+.text
+	.align 4
+.stabs "v4_gt1:F1",36,0,0,v4_gt1
+.globl v4_gt1
+	.type	v4_gt1,@function
+v4_gt1:
+.stabn 68,0,646,.LMa110-v4_gt1
+.LMa110:
+.stabn 68,0,646,.LMb110-v4_gt1
+.LMb110:
+.LBB109:
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS12
+	call v4__dscheck
+.LDS12:
+	mov %ecx,v4__dsindex
+.LBE109:
+.stabn 68,0,646,.LM114-v4_gt1
+.LM114:
+	ret
+.Lfe109:
+	.size	 v4_gt1,.Lfe109-v4_gt1
+.stabn	192,0,0,.LBB109-v4_gt1
+.stabn	224,0,0,.LBE109-v4_gt1
+.Lscope109:
+.stabs	"",36,0,0,.Lscope109-v4_gt1
+.text
+	.align 4
+.stabs "v4_gt2:F1",36,0,0,v4_gt2
+.globl v4_gt2
+	.type	v4_gt2,@function
+v4_gt2:
+.stabn 68,0,648,.LMa115-v4_gt2
+.LMa115:
+.stabn 68,0,648,.LMb115-v4_gt2
+.LMb115:
+.LBB110:
+	lea v4_gt1,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS13
+	call v4__dscheck
+.LDS13:
+	mov %ecx,v4__dsindex
+.LBE110:
+.stabn 68,0,648,.LM119-v4_gt2
+.LM119:
+	ret
+.Lfe110:
+	.size	 v4_gt2,.Lfe110-v4_gt2
+.stabn	192,0,0,.LBB110-v4_gt2
+.stabn	224,0,0,.LBE110-v4_gt2
+.Lscope110:
+.stabs	"",36,0,0,.Lscope110-v4_gt2
+.text
+	.align 4
+.stabs "v4_gt8:F1",36,0,0,v4_gt8
+.globl v4_gt8
+	.type	v4_gt8,@function
+v4_gt8:
+.stabn 68,0,666,.LMa120-v4_gt8
+.LMa120:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,666,.LMb120-v4_gt8
+.LMb120:
+.LBB112:
+	call v4_state
+	pop %ebx
+	leave
+	jmp v4_Fetch
+.LBE112:
+.stabn 68,0,666,.LM124-v4_gt8
+.LM124:
+	pop %ebx
+	leave
+	ret
+.Lfe112:
+	.size	 v4_gt8,.Lfe112-v4_gt8
+.stabn	192,0,0,.LBB112-v4_gt8
+.stabn	224,0,0,.LBE112-v4_gt8
+.Lscope112:
+.stabs	"",36,0,0,.Lscope112-v4_gt8
+.text
+	.align 4
+.stabs "v4_gt9:F1",36,0,0,v4_gt9
+.globl v4_gt9
+	.type	v4_gt9,@function
+v4_gt9:
+.stabn 68,0,668,.LMa125-v4_gt9
+.LMa125:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,668,.LMb125-v4_gt9
+.LMb125:
+.LBB114:
+	lea v4_gt8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS14
+	call v4__dscheck
+.LDS14:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_literal
+.LBE114:
+.stabn 68,0,668,.LM130-v4_gt9
+.LM130:
+	pop %ebx
+	leave
+	ret
+.Lfe114:
+	.size	 v4_gt9,.Lfe114-v4_gt9
+.stabn	192,0,0,.LBB114-v4_gt9
+.stabn	224,0,0,.LBE114-v4_gt9
+.Lscope114:
+.stabs	"",36,0,0,.Lscope114-v4_gt9
+.text
+	.align 4
+.stabs "v4_gi1:F1",36,0,0,v4_gi1
+.globl v4_gi1
+	.type	v4_gi1,@function
+v4_gi1:
+.stabn 68,0,674,.LMa131-v4_gi1
+.LMa131:
+.stabn 68,0,674,.LMb131-v4_gi1
+.LMb131:
+.LBB115:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS15
+	call v4__dscheck
+.LDS15:
+	test %eax,%eax
+	je .L20
+	mov $123,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS16
+	call v4__dscheck
+.LDS16:
+.L20:
+	mov %ecx,v4__dsindex
+.LBE115:
+.stabn 68,0,674,.LM138-v4_gi1
+.LM138:
+	ret
+.Lfe115:
+	.size	 v4_gi1,.Lfe115-v4_gi1
+.stabn	192,0,0,.LBB115-v4_gi1
+.stabn	224,0,0,.LBE115-v4_gi1
+.Lscope115:
+.stabs	"",36,0,0,.Lscope115-v4_gi1
+.text
+	.align 4
+.stabs "v4_gi2:F1",36,0,0,v4_gi2
+.globl v4_gi2
+	.type	v4_gi2,@function
+v4_gi2:
+.stabn 68,0,675,.LMa139-v4_gi2
+.LMa139:
+.stabn 68,0,675,.LMb139-v4_gi2
+.LMb139:
+.LBB116:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS17
+	call v4__dscheck
+.LDS17:
+	test %eax,%eax
+	je .L22
+	mov $123,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS18
+	call v4__dscheck
+.LDS18:
+	jmp .L23
+.L22:
+	mov $234,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS19
+	call v4__dscheck
+.LDS19:
+.L23:
+	mov %ecx,v4__dsindex
+.LBE116:
+.stabn 68,0,675,.LM150-v4_gi2
+.LM150:
+	ret
+.Lfe116:
+	.size	 v4_gi2,.Lfe116-v4_gi2
+.stabn	192,0,0,.LBB116-v4_gi2
+.stabn	224,0,0,.LBE116-v4_gi2
+.Lscope116:
+.stabs	"",36,0,0,.Lscope116-v4_gi2
+.text
+	.align 4
+.stabs "v4_gi3:F1",36,0,0,v4_gi3
+.globl v4_gi3
+	.type	v4_gi3,@function
+v4_gi3:
+.stabn 68,0,683,.LMa151-v4_gi3
+.LMa151:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,683,.LMb151-v4_gi3
+.LMb151:
+.LBB117:
+	mov v4__dsindex,%ecx
+.L25:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS20
+	call v4__dscheck
+.LDS20:
+	cmp %edx,%eax
+	jge .L26
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS21
+	call v4__dscheck
+.LDS21:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS22
+	call v4__dscheck
+.LDS22:
+	jmp .L25
+.L26:
+	mov %ecx,v4__dsindex
+.LBE117:
+.stabn 68,0,683,.LM170-v4_gi3
+.LM170:
+	pop %ebx
+	leave
+	ret
+.Lfe117:
+	.size	 v4_gi3,.Lfe117-v4_gi3
+.stabn	192,0,0,.LBB117-v4_gi3
+.stabn	224,0,0,.LBE117-v4_gi3
+.Lscope117:
+.stabs	"",36,0,0,.Lscope117-v4_gi3
+.text
+	.align 4
+.stabs "v4_gi4:F1",36,0,0,v4_gi4
+.globl v4_gi4
+	.type	v4_gi4,@function
+v4_gi4:
+.stabn 68,0,689,.LMa171-v4_gi4
+.LMa171:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,689,.LMb171-v4_gi4
+.LMb171:
+.LBB118:
+	mov v4__dsindex,%ecx
+.L28:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS23
+	call v4__dscheck
+.LDS23:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS24
+	call v4__dscheck
+.LDS24:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS25
+	call v4__dscheck
+.LDS25:
+	cmp %edx,%eax
+	jle .L28
+	mov %ecx,v4__dsindex
+.LBE118:
+.stabn 68,0,689,.LM189-v4_gi4
+.LM189:
+	pop %ebx
+	leave
+	ret
+.Lfe118:
+	.size	 v4_gi4,.Lfe118-v4_gi4
+.stabn	192,0,0,.LBB118-v4_gi4
+.stabn	224,0,0,.LBE118-v4_gi4
+.Lscope118:
+.stabs	"",36,0,0,.Lscope118-v4_gi4
+.text
+	.align 4
+.stabs "v4_gi5:F1",36,0,0,v4_gi5
+.globl v4_gi5
+	.type	v4_gi5,@function
+v4_gi5:
+.stabn 68,0,694,.LMa190-v4_gi5
+.LMa190:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,694,.LMb190-v4_gi5
+.LMb190:
+.LBB119:
+	mov v4__dsindex,%ecx
+.L31:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $2,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS26
+	call v4__dscheck
+.LDS26:
+	cmp %edx,%eax
+	jle .L32
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS27
+	call v4__dscheck
+.LDS27:
+	cmp %edx,%eax
+	jge .L32
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS28
+	call v4__dscheck
+.LDS28:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS29
+	call v4__dscheck
+.LDS29:
+	jmp .L31
+.L32:
+	mov %ecx,v4__dsindex
+.LBE119:
+.stabn 68,0,694,.LM218-v4_gi5
+.LM218:
+	pop %ebx
+	leave
+	ret
+.Lfe119:
+	.size	 v4_gi5,.Lfe119-v4_gi5
+.stabn	192,0,0,.LBB119-v4_gi5
+.stabn	224,0,0,.LBE119-v4_gi5
+.Lscope119:
+.stabs	"",36,0,0,.Lscope119-v4_gi5
+.text
+	.align 4
+.stabs "v4_gi6:F1",36,0,0,v4_gi6
+.globl v4_gi6
+	.type	v4_gi6,@function
+v4_gi6:
+.stabn 68,0,701,.LMa219-v4_gi6
+.LMa219:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,701,.LMb219-v4_gi6
+.LMb219:
+.LBB120:
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS30
+	call v4__dscheck
+.LDS30:
+	test %eax,%eax
+	je .L34
+	mov %ecx,v4__dsindex
+	call v4_dup
+	call v4_Greaterr
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	dec %eax
+	cmp $4080,%ecx
+	jbe .LDS31
+	call v4__dscheck
+.LDS31:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS32
+	call v4__dscheck
+.LDS32:
+	mov %ecx,v4__dsindex
+	call v4_gi6
+	pop %ebx
+	leave
+	jmp v4_r_Greater
+	mov v4__dsindex,%ecx
+.L34:
+	mov %ecx,v4__dsindex
+.LBE120:
+.stabn 68,0,701,.LM233-v4_gi6
+.LM233:
+	pop %ebx
+	leave
+	ret
+.Lfe120:
+	.size	 v4_gi6,.Lfe120-v4_gi6
+.stabn	192,0,0,.LBB120-v4_gi6
+.stabn	224,0,0,.LBE120-v4_gi6
+.Lscope120:
+.stabs	"",36,0,0,.Lscope120-v4_gi6
+.text
+	.align 4
+.stabs "v4_gd1:F1",36,0,0,v4_gd1
+.globl v4_gd1
+	.type	v4_gd1,@function
+v4_gd1:
+.stabn 68,0,711,.LMa234-v4_gd1
+.LMa234:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,711,.LMb234-v4_gd1
+.LMb234:
+.LBB121:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS33
+	call v4__dscheck
+.LDS33:
+.L37:
+	mov -12(%ebp),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -12(%ebp),%edx
+	inc %edx
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS34
+	call v4__dscheck
+.LDS34:
+	test %edx,%edx
+	jne .L37
+	mov -8(%ebp),%eax
+	mov %ecx,v4__dsindex
+.LBE121:
+.stabn 68,0,711,.LM255-v4_gd1
+.LM255:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe121:
+	.size	 v4_gd1,.Lfe121-v4_gd1
+.stabn	192,0,0,.LBB121-v4_gd1
+.stabn	224,0,0,.LBE121-v4_gd1
+.Lscope121:
+.stabs	"",36,0,0,.Lscope121-v4_gd1
+.text
+	.align 4
+.stabs "v4_gd2:F1",36,0,0,v4_gd2
+.globl v4_gd2
+	.type	v4_gd2,@function
+v4_gd2:
+.stabn 68,0,716,.LMa256-v4_gd2
+.LMa256:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,716,.LMb256-v4_gd2
+.LMb256:
+.LBB123:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS35
+	call v4__dscheck
+.LDS35:
+.L41:
+	mov -12(%ebp),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov -12(%ebp),%edx
+	add %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS36
+	call v4__dscheck
+.LDS36:
+	test %eax,%eax
+	jl .L43
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	test %edx,%edx
+	jl .L41
+	jmp .L42
+.L43:
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	test %edx,%edx
+	jge .L41
+.L42:
+	mov -8(%ebp),%eax
+	mov %ecx,v4__dsindex
+.LBE123:
+.stabn 68,0,716,.LM288-v4_gd2
+.LM288:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe123:
+	.size	 v4_gd2,.Lfe123-v4_gd2
+.stabn	192,0,0,.LBB123-v4_gd2
+.stabn	224,0,0,.LBE123-v4_gd2
+.Lscope123:
+.stabs	"",36,0,0,.Lscope123-v4_gd2
+.text
+	.align 4
+.stabs "v4_gd3:F1",36,0,0,v4_gd3
+.globl v4_gd3
+	.type	v4_gd3,@function
+v4_gd3:
+.stabn 68,0,721,.LMa289-v4_gd3
+.LMa289:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+.stabn 68,0,721,.LMb289-v4_gd3
+.LMb289:
+.LBB124:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-12(%ebp)
+	mov %edx,-16(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS37
+	call v4__dscheck
+.LDS37:
+.L46:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov %eax,-20(%ebp)
+	mov %edx,-24(%ebp)
+.L49:
+	mov -16(%ebp),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -24(%ebp),%edx
+	inc %edx
+	mov -20(%ebp),%eax
+	mov %edx,-24(%ebp)
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS38
+	call v4__dscheck
+.LDS38:
+	test %edx,%edx
+	jne .L49
+	mov -20(%ebp),%eax
+	mov -16(%ebp),%edx
+	inc %edx
+	mov -12(%ebp),%eax
+	mov %edx,-16(%ebp)
+	sub %eax,%edx
+	jne .L46
+	mov -12(%ebp),%eax
+	mov %ecx,v4__dsindex
+.LBE124:
+.stabn 68,0,721,.LM330-v4_gd3
+.LM330:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe124:
+	.size	 v4_gd3,.Lfe124-v4_gd3
+.stabn	192,0,0,.LBB124-v4_gd3
+.stabn	224,0,0,.LBE124-v4_gd3
+.Lscope124:
+.stabs	"",36,0,0,.Lscope124-v4_gd3
+.text
+	.align 4
+.stabs "v4_gd4:F1",36,0,0,v4_gd4
+.globl v4_gd4
+	.type	v4_gd4,@function
+v4_gd4:
+.stabn 68,0,726,.LMa331-v4_gd4
+.LMa331:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+.stabn 68,0,726,.LMb331-v4_gd4
+.LMb331:
+.LBB126:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-12(%ebp)
+	mov %edx,-16(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS39
+	call v4__dscheck
+.LDS39:
+.L53:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov %eax,-20(%ebp)
+	mov %edx,-24(%ebp)
+.L56:
+	mov -16(%ebp),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -24(%ebp),%edx
+	inc %edx
+	mov -20(%ebp),%eax
+	mov %edx,-24(%ebp)
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS40
+	call v4__dscheck
+.LDS40:
+	test %edx,%edx
+	jne .L56
+	mov -20(%ebp),%eax
+	xor %eax,%eax
+	dec %eax
+	mov -16(%ebp),%edx
+	add %eax,%edx
+	test %eax,%eax
+	jl .L58
+	mov -12(%ebp),%eax
+	mov %edx,-16(%ebp)
+	sub %eax,%edx
+	test %edx,%edx
+	jl .L53
+	jmp .L54
+.L58:
+	mov -12(%ebp),%eax
+	mov %edx,-16(%ebp)
+	sub %eax,%edx
+	test %edx,%edx
+	jge .L53
+.L54:
+	mov -12(%ebp),%eax
+	mov %ecx,v4__dsindex
+.LBE126:
+.stabn 68,0,726,.LM383-v4_gd4
+.LM383:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe126:
+	.size	 v4_gd4,.Lfe126-v4_gd4
+.stabn	192,0,0,.LBB126-v4_gd4
+.stabn	224,0,0,.LBE126-v4_gd4
+.Lscope126:
+.stabs	"",36,0,0,.Lscope126-v4_gd4
+.text
+	.align 4
+.stabs "v4_gd5:F1",36,0,0,v4_gd5
+.globl v4_gd5
+	.type	v4_gd5,@function
+v4_gd5:
+.stabn 68,0,731,.LMa384-v4_gd5
+.LMa384:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,731,.LMb384-v4_gd5
+.LMb384:
+.LBB127:
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS41
+	call v4__dscheck
+.LDS41:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	xor %eax,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS42
+	call v4__dscheck
+.LDS42:
+.L61:
+	mov %ecx,v4__dsindex
+	call v4_i
+	mov $4,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS43
+	call v4__dscheck
+.LDS43:
+	cmp %edx,%eax
+	jle .L63
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $234,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS44
+	call v4__dscheck
+.LDS44:
+	jmp .L62
+.L63:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L61
+.L62:
+	call v4__rpop
+	call v4__rpop
+	mov %ecx,v4__dsindex
+.LBE127:
+.stabn 68,0,731,.LM421-v4_gd5
+.LM421:
+	pop %ebx
+	leave
+	ret
+.Lfe127:
+	.size	 v4_gd5,.Lfe127-v4_gd5
+.stabn	192,0,0,.LBB127-v4_gd5
+.stabn	224,0,0,.LBE127-v4_gd5
+.Lscope127:
+.stabs	"",36,0,0,.Lscope127-v4_gd5
+.text
+	.align 4
+.stabs "v4_gd6:F1",36,0,0,v4_gd6
+.globl v4_gd6
+	.type	v4_gd6,@function
+v4_gd6:
+.stabn 68,0,736,.LMa422-v4_gd6
+.LMa422:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+.stabn 68,0,736,.LMb422-v4_gd6
+.LMb422:
+.LBB128:
+.stabn 68,0,737,.LM423-v4_gd6
+.LM423:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS45
+	call v4__dscheck
+.LDS45:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	xor %eax,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-12(%ebp)
+	mov %edx,-16(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS46
+	call v4__dscheck
+.LDS46:
+.L66:
+	mov -16(%ebp),%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov %eax,-20(%ebp)
+	mov %edx,-24(%ebp)
+.L69:
+	mov -24(%ebp),%eax
+	mov %eax,%esi
+	mov -16(%ebp),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov %eax,%esi
+	mov $3,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	jne .L71
+	mov -24(%ebp),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -16(%ebp),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS47
+	call v4__dscheck
+.LDS47:
+	jmp .L64
+.L71:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS48
+	call v4__dscheck
+.LDS48:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -24(%ebp),%edx
+	inc %edx
+	mov -20(%ebp),%eax
+	mov %edx,-24(%ebp)
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS49
+	call v4__dscheck
+.LDS49:
+	test %edx,%edx
+	jne .L69
+	mov -20(%ebp),%eax
+.stabn 68,0,739,.LM491-v4_gd6
+.LM491:
+	mov -16(%ebp),%edx
+	inc %edx
+	mov -12(%ebp),%eax
+	mov %edx,-16(%ebp)
+	sub %eax,%edx
+	jne .L66
+	mov -12(%ebp),%eax
+.L64:
+	mov %ecx,v4__dsindex
+.LBE128:
+.stabn 68,0,739,.LM503-v4_gd6
+.LM503:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe128:
+	.size	 v4_gd6,.Lfe128-v4_gd6
+.stabn	192,0,0,.LBB128-v4_gd6
+.stabn	224,0,0,.LBE128-v4_gd6
+.Lscope128:
+.stabs	"",36,0,0,.Lscope128-v4_gd6
+.text
+	.align 4
+.stabs "v4_s_Equals:F1",36,0,0,v4_s_Equals
+.globl v4_s_Equals
+	.type	v4_s_Equals,@function
+v4_s_Equals:
+.stabn 68,0,826,.LMa504-v4_s_Equals
+.LMa504:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,826,.LMb504-v4_s_Equals
+.LMb504:
+.LBB130:
+.stabn 68,0,827,.LM505-v4_s_Equals
+.LM505:
+	call v4_Greaterr
+	call v4_swap
+	call v4_r_Fetch
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS50
+	call v4__dscheck
+.LDS50:
+	cmp %edx,%eax
+	jne .L73
+.stabn 68,0,828,.LM514-v4_s_Equals
+.LM514:
+	mov %ecx,v4__dsindex
+	call v4_r_Greater
+	call v4_Questiondup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS51
+	call v4__dscheck
+.LDS51:
+	test %eax,%eax
+	je .L74
+.stabn 68,0,829,.LM518-v4_s_Equals
+.LM518:
+	xor %eax,%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS52
+	call v4__dscheck
+.LDS52:
+.L76:
+.stabn 68,0,830,.LM525-v4_s_Equals
+.LM525:
+	mov %ecx,v4__dsindex
+	call v4_over
+	call v4_c_Fetch
+	call v4_over
+	call v4_c_Fetch
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	sub %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS53
+	call v4__dscheck
+.LDS53:
+	test %eax,%eax
+	je .L78
+	mov %ecx,v4__dsindex
+	call v4_z2drop
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS54
+	call v4__dscheck
+.LDS54:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_unloop
+	mov v4__dsindex,%ecx
+.L78:
+.stabn 68,0,831,.LM542-v4_s_Equals
+.LM542:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	call v4_char_Plus
+	call v4_swap
+	call v4_char_Plus
+.stabn 68,0,832,.LM546-v4_s_Equals
+.LM546:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	mov v4__dsindex,%ecx
+	jne .L76
+	call v4__rpop
+	call v4__rpop
+.L74:
+.stabn 68,0,834,.LM558-v4_s_Equals
+.LM558:
+	mov %ecx,v4__dsindex
+	call v4_z2drop
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,835,.LM561-v4_s_Equals
+.LM561:
+	cmp $4080,%ecx
+	jbe .LDS55
+	call v4__dscheck
+.LDS55:
+	jmp .L79
+.L73:
+.stabn 68,0,836,.LM563-v4_s_Equals
+.LM563:
+	mov %ecx,v4__dsindex
+	call v4_r_Greater
+	call v4_drop
+	call v4_z2drop
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS56
+	call v4__dscheck
+.LDS56:
+.L79:
+.L72:
+	mov %ecx,v4__dsindex
+.LBE130:
+.stabn 68,0,837,.LM570-v4_s_Equals
+.LM570:
+	pop %ebx
+	leave
+	ret
+.Lfe130:
+	.size	 v4_s_Equals,.Lfe130-v4_s_Equals
+.stabn	192,0,0,.LBB130-v4_s_Equals
+.stabn	224,0,0,.LBE130-v4_s_Equals
+.Lscope130:
+.stabs	"",36,0,0,.Lscope130-v4_s_Equals
+.text
+	.align 4
+.stabs "v4_gp1:F1",36,0,0,v4_gp1
+.globl v4_gp1
+	.type	v4_gp1,@function
+v4_gp1:
+.stabn 68,0,839,.LMa571-v4_gp1
+.LMa571:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,839,.LMb571-v4_gp1
+.LMb571:
+.LBB131:
+	call v4_Less_Hash
+	mov $65,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS57
+	call v4__dscheck
+.LDS57:
+	mov %ecx,v4__dsindex
+	call v4_hold
+	mov $66,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS58
+	call v4__dscheck
+.LDS58:
+	mov %ecx,v4__dsindex
+	call v4_hold
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS59
+	call v4__dscheck
+.LDS59:
+	mov %ecx,v4__dsindex
+	call v4_Hash_Greater
+	lea .LC17,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS60
+	call v4__dscheck
+.LDS60:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_s_Equals
+.LBE131:
+.stabn 68,0,839,.LM590-v4_gp1
+.LM590:
+	pop %ebx
+	leave
+	ret
+.Lfe131:
+	.size	 v4_gp1,.Lfe131-v4_gp1
+.stabn	192,0,0,.LBB131-v4_gp1
+.stabn	224,0,0,.LBE131-v4_gp1
+.Lscope131:
+.stabs	"",36,0,0,.Lscope131-v4_gp1
+.text
+	.align 4
+.stabs "v4_gp2:F1",36,0,0,v4_gp2
+.globl v4_gp2
+	.type	v4_gp2,@function
+v4_gp2:
+.stabn 68,0,842,.LMa591-v4_gp2
+.LMa591:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,842,.LMb591-v4_gp2
+.LMb591:
+.LBB135:
+	call v4_Less_Hash
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS61
+	call v4__dscheck
+.LDS61:
+	mov %ecx,v4__dsindex
+	call v4_sign
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS62
+	call v4__dscheck
+.LDS62:
+	mov %ecx,v4__dsindex
+	call v4_sign
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS63
+	call v4__dscheck
+.LDS63:
+	mov %ecx,v4__dsindex
+	call v4_sign
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS64
+	call v4__dscheck
+.LDS64:
+	mov %ecx,v4__dsindex
+	call v4_Hash_Greater
+	lea .LC18,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS65
+	call v4__dscheck
+.LDS65:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_s_Equals
+.LBE135:
+.stabn 68,0,842,.LM613-v4_gp2
+.LM613:
+	pop %ebx
+	leave
+	ret
+.Lfe135:
+	.size	 v4_gp2,.Lfe135-v4_gp2
+.stabn	192,0,0,.LBB135-v4_gp2
+.stabn	224,0,0,.LBE135-v4_gp2
+.Lscope135:
+.stabs	"",36,0,0,.Lscope135-v4_gp2
+.text
+	.align 4
+.stabs "v4_gp3:F1",36,0,0,v4_gp3
+.globl v4_gp3
+	.type	v4_gp3,@function
+v4_gp3:
+.stabn 68,0,845,.LMa614-v4_gp3
+.LMa614:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,845,.LMb614-v4_gp3
+.LMb614:
+.LBB137:
+	call v4_Less_Hash
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS66
+	call v4__dscheck
+.LDS66:
+	mov %ecx,v4__dsindex
+	call v4_Hash
+	call v4_Hash
+	call v4_Hash_Greater
+	lea .LC19,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS67
+	call v4__dscheck
+.LDS67:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_s_Equals
+.LBE137:
+.stabn 68,0,845,.LM629-v4_gp3
+.LM629:
+	pop %ebx
+	leave
+	ret
+.Lfe137:
+	.size	 v4_gp3,.Lfe137-v4_gp3
+.stabn	192,0,0,.LBB137-v4_gp3
+.stabn	224,0,0,.LBE137-v4_gp3
+.Lscope137:
+.stabs	"",36,0,0,.Lscope137-v4_gp3
+.text
+	.align 4
+.stabs "v4_gp4:F1",36,0,0,v4_gp4
+.globl v4_gp4
+	.type	v4_gp4,@function
+v4_gp4:
+.stabn 68,0,848,.LMa630-v4_gp4
+.LMa630:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,848,.LMb630-v4_gp4
+.LMb630:
+.LBB139:
+	call v4_Less_Hash
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS68
+	call v4__dscheck
+.LDS68:
+	mov %ecx,v4__dsindex
+	call v4_Hashs
+	call v4_Hash_Greater
+	lea .LC20,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS69
+	call v4__dscheck
+.LDS69:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_s_Equals
+.LBE139:
+.stabn 68,0,848,.LM644-v4_gp4
+.LM644:
+	pop %ebx
+	leave
+	ret
+.Lfe139:
+	.size	 v4_gp4,.Lfe139-v4_gp4
+.stabn	192,0,0,.LBB139-v4_gp4
+.stabn	224,0,0,.LBE139-v4_gp4
+.Lscope139:
+.stabs	"",36,0,0,.Lscope139-v4_gp4
+.text
+	.align 4
+.stabs "v4_count_Minusbits:F1",36,0,0,v4_count_Minusbits
+.globl v4_count_Minusbits
+	.type	v4_count_Minusbits,@function
+v4_count_Minusbits:
+.stabn 68,0,852,.LMa645-v4_count_Minusbits
+.LMa645:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,852,.LMb645-v4_count_Minusbits
+.LMb645:
+.LBB142:
+.stabn 68,0,853,.LM646-v4_count_Minusbits
+.LM646:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS70
+	call v4__dscheck
+.LDS70:
+.L85:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS71
+	call v4__dscheck
+.LDS71:
+	test %eax,%eax
+	je .L86
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-8(%ebp)
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS72
+	call v4__dscheck
+.LDS72:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -8(%ebp),%eax
+	add %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS73
+	call v4__dscheck
+.LDS73:
+	jmp .L85
+.L86:
+	mov %ecx,v4__dsindex
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE142:
+.stabn 68,0,853,.LM673-v4_count_Minusbits
+.LM673:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe142:
+	.size	 v4_count_Minusbits,.Lfe142-v4_count_Minusbits
+.stabn	192,0,0,.LBB142-v4_count_Minusbits
+.stabn	224,0,0,.LBE142-v4_count_Minusbits
+.Lscope142:
+.stabs	"",36,0,0,.Lscope142-v4_count_Minusbits
+.text
+	.align 4
+.stabs "v4_gp5:F1",36,0,0,v4_gp5
+.globl v4_gp5
+	.type	v4_gp5,@function
+v4_gp5:
+.stabn 68,0,856,.LMa674-v4_gp5
+.LMa674:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+.stabn 68,0,856,.LMb674-v4_gp5
+.LMb674:
+.LBB144:
+.stabn 68,0,857,.LM675-v4_gp5
+.LM675:
+	call v4_base
+	call v4_Fetch
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,858,.LM679-v4_gp5
+.LM679:
+	mov $37,%eax
+	mov %eax,%esi
+	mov $2,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS74
+	call v4__dscheck
+.LDS74:
+.L89:
+.stabn 68,0,859,.LM689-v4_gp5
+.LM689:
+	mov %ecx,v4__dsindex
+	call v4_i
+	call v4_base
+	call v4_Store
+.stabn 68,0,860,.LM692-v4_gp5
+.LM692:
+	call v4_i
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS75
+	call v4__dscheck
+.LDS75:
+	mov %ecx,v4__dsindex
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+	lea .LC21,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS76
+	call v4__dscheck
+.LDS76:
+	mov %ecx,v4__dsindex
+	call v4_s_Equals
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	and %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS77
+	call v4__dscheck
+.LDS77:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,861,.LM708-v4_gp5
+.LM708:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS78
+	call v4__dscheck
+.LDS78:
+	test %edx,%edx
+	jne .L89
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,862,.LM719-v4_gp5
+.LM719:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	call v4_base
+	pop %esi
+	pop %ebx
+	leave
+	jmp v4_Store
+.LBE144:
+.stabn 68,0,862,.LM723-v4_gp5
+.LM723:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe144:
+	.size	 v4_gp5,.Lfe144-v4_gp5
+.stabn	192,0,0,.LBB144-v4_gp5
+.stabn	224,0,0,.LBE144-v4_gp5
+.Lscope144:
+.stabs	"",36,0,0,.Lscope144-v4_gp5
+.text
+	.align 4
+.stabs "v4_gp6:F1",36,0,0,v4_gp6
+.globl v4_gp6
+	.type	v4_gp6,@function
+v4_gp6:
+.stabn 68,0,865,.LMa724-v4_gp6
+.LMa724:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,865,.LMb724-v4_gp6
+.LMb724:
+.LBB146:
+.stabn 68,0,866,.LM725-v4_gp6
+.LM725:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS79
+	call v4__dscheck
+.LDS79:
+	mov %ecx,v4__dsindex
+	call v4_base
+	call v4_Store
+.stabn 68,0,868,.LM732-v4_gp6
+.LM732:
+	call v4_Less_Hash
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS80
+	call v4__dscheck
+.LDS80:
+	mov %ecx,v4__dsindex
+	call v4_Hashs
+	call v4_z2drop
+.stabn 68,0,869,.LM739-v4_gp6
+.LM739:
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS81
+	call v4__dscheck
+.LDS81:
+	mov %ecx,v4__dsindex
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,870,.LM745-v4_gp6
+.LM745:
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,871,.LM748-v4_gp6
+.LM748:
+	call v4_dup
+	mov (v4_Hashbits_Minusud),%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	cmp $4080,%ecx
+	jbe .LDS82
+	call v4__dscheck
+.LDS82:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS83
+	call v4__dscheck
+.LDS83:
+	mov %ecx,v4__dsindex
+	call v4_swap
+.stabn 68,0,872,.LM757-v4_gp6
+.LM757:
+	xor %eax,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS84
+	call v4__dscheck
+.LDS84:
+.L93:
+.stabn 68,0,873,.LM764-v4_gp6
+.LM764:
+	mov %ecx,v4__dsindex
+	call v4_over
+	call v4_c_Fetch
+	mov $49,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	and %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS85
+	call v4__dscheck
+.LDS85:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,874,.LM778-v4_gp6
+.LM778:
+	cmp $4080,%ecx
+	jbe .LDS86
+	call v4__dscheck
+.LDS86:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_char_Plus
+	call v4_r_Greater
+.stabn 68,0,875,.LM781-v4_gp6
+.LM781:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	mov v4__dsindex,%ecx
+	jne .L93
+	call v4__rpop
+	call v4__rpop
+	call v4_swap
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE146:
+.stabn 68,0,875,.LM795-v4_gp6
+.LM795:
+	pop %ebx
+	leave
+	ret
+.Lfe146:
+	.size	 v4_gp6,.Lfe146-v4_gp6
+.stabn	192,0,0,.LBB146-v4_gp6
+.stabn	224,0,0,.LBE146-v4_gp6
+.Lscope146:
+.stabs	"",36,0,0,.Lscope146-v4_gp6
+.text
+	.align 4
+.stabs "v4_gp7:F1",36,0,0,v4_gp7
+.globl v4_gp7
+	.type	v4_gp7,@function
+v4_gp7:
+.stabn 68,0,900,.LMa796-v4_gp7
+.LMa796:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+.stabn 68,0,900,.LMb796-v4_gp7
+.LMb796:
+.LBB147:
+.stabn 68,0,901,.LM797-v4_gp7
+.LM797:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	mov $36,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS87
+	call v4__dscheck
+.LDS87:
+	mov %ecx,v4__dsindex
+	call v4_base
+	call v4_Store
+.stabn 68,0,902,.LM804-v4_gp7
+.LM804:
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,903,.LM806-v4_gp7
+.LM806:
+	mov $10,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS88
+	call v4__dscheck
+.LDS88:
+.L97:
+.stabn 68,0,904,.LM815-v4_gp7
+.LM815:
+	mov %ecx,v4__dsindex
+	call v4_i
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS89
+	call v4__dscheck
+.LDS89:
+	mov %ecx,v4__dsindex
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,905,.LM821-v4_gp7
+.LM821:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	cmp $4080,%ecx
+	jbe .LDS90
+	call v4__dscheck
+.LDS90:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS91
+	call v4__dscheck
+.LDS91:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	call v4_c_Fetch
+	mov $48,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS92
+	call v4__dscheck
+.LDS92:
+	mov %ecx,v4__dsindex
+	call v4_i
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	and %edx,%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	and %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS93
+	call v4__dscheck
+.LDS93:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,906,.LM853-v4_gp7
+.LM853:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS94
+	call v4__dscheck
+.LDS94:
+	test %edx,%edx
+	jne .L97
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,907,.LM864-v4_gp7
+.LM864:
+	mov $36,%eax
+	mov %eax,%esi
+	mov $10,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L100:
+.stabn 68,0,908,.LM873-v4_gp7
+.LM873:
+	mov %ecx,v4__dsindex
+	call v4_i
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS95
+	call v4__dscheck
+.LDS95:
+	mov %ecx,v4__dsindex
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,909,.LM879-v4_gp7
+.LM879:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	cmp $4080,%ecx
+	jbe .LDS96
+	call v4__dscheck
+.LDS96:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS97
+	call v4__dscheck
+.LDS97:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	call v4_c_Fetch
+	mov $65,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS98
+	call v4__dscheck
+.LDS98:
+	mov %ecx,v4__dsindex
+	call v4_i
+	mov $10,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	sub %edx,%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	and %edx,%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	and %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS99
+	call v4__dscheck
+.LDS99:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,910,.LM918-v4_gp7
+.LM918:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS100
+	call v4__dscheck
+.LDS100:
+	test %edx,%edx
+	jne .L100
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,911,.LM929-v4_gp7
+.LM929:
+	mov %ecx,v4__dsindex
+	call v4_r_Greater
+	call v4_base
+	pop %esi
+	pop %ebx
+	leave
+	jmp v4_Store
+.LBE147:
+.stabn 68,0,911,.LM933-v4_gp7
+.LM933:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe147:
+	.size	 v4_gp7,.Lfe147-v4_gp7
+.stabn	192,0,0,.LBB147-v4_gp7
+.stabn	224,0,0,.LBE147-v4_gp7
+.Lscope147:
+.stabs	"",36,0,0,.Lscope147-v4_gp7
+.text
+	.align 4
+.stabs "v4_gn_Minusstring:F1",36,0,0,v4_gn_Minusstring
+.globl v4_gn_Minusstring
+	.type	v4_gn_Minusstring,@function
+v4_gn_Minusstring:
+.stabn 68,0,919,.LMa934-v4_gn_Minusstring
+.LMa934:
+.stabn 68,0,919,.LMb934-v4_gn_Minusstring
+.LMb934:
+.LBB149:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS101
+	call v4__dscheck
+.LDS101:
+	mov %ecx,v4__dsindex
+.LBE149:
+.stabn 68,0,919,.LM940-v4_gn_Minusstring
+.LM940:
+	ret
+.Lfe149:
+	.size	 v4_gn_Minusstring,.Lfe149-v4_gn_Minusstring
+.stabn	192,0,0,.LBB149-v4_gn_Minusstring
+.stabn	224,0,0,.LBE149-v4_gn_Minusstring
+.Lscope149:
+.stabs	"",36,0,0,.Lscope149-v4_gn_Minusstring
+.text
+	.align 4
+.stabs "v4_gn_Minusconsumed:F1",36,0,0,v4_gn_Minusconsumed
+.globl v4_gn_Minusconsumed
+	.type	v4_gn_Minusconsumed,@function
+v4_gn_Minusconsumed:
+.stabn 68,0,920,.LMa941-v4_gn_Minusconsumed
+.LMa941:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,920,.LMb941-v4_gn_Minusconsumed
+.LMb941:
+.LBB150:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS102
+	call v4__dscheck
+.LDS102:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS103
+	call v4__dscheck
+.LDS103:
+	mov %ecx,v4__dsindex
+.LBE150:
+.stabn 68,0,920,.LM948-v4_gn_Minusconsumed
+.LM948:
+	pop %ebx
+	leave
+	ret
+.Lfe150:
+	.size	 v4_gn_Minusconsumed,.Lfe150-v4_gn_Minusconsumed
+.stabn	192,0,0,.LBB150-v4_gn_Minusconsumed
+.stabn	224,0,0,.LBE150-v4_gn_Minusconsumed
+.Lscope150:
+.stabs	"",36,0,0,.Lscope150-v4_gn_Minusconsumed
+.text
+	.align 4
+.stabs "v4_gn_Tick:F1",36,0,0,v4_gn_Tick
+.globl v4_gn_Tick
+	.type	v4_gn_Tick,@function
+v4_gn_Tick:
+.stabn 68,0,922,.LMa949-v4_gn_Tick
+.LMa949:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,922,.LMb949-v4_gn_Tick
+.LMb949:
+.LBB151:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS104
+	call v4__dscheck
+.LDS104:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM954-v4_gn_Tick
+.LM954:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS105
+	call v4__dscheck
+.LDS105:
+	mov %ecx,v4__dsindex
+.LBE151:
+.stabn 68,0,922,.LM959-v4_gn_Tick
+.LM959:
+	pop %ebx
+	leave
+	ret
+.Lfe151:
+	.size	 v4_gn_Tick,.Lfe151-v4_gn_Tick
+.stabn	192,0,0,.LBB151-v4_gn_Tick
+.stabn	224,0,0,.LBE151-v4_gn_Tick
+.Lscope151:
+.stabs	"",36,0,0,.Lscope151-v4_gn_Tick
+.text
+	.align 4
+.stabs "v4_Greaternumber_Minusbased:F1",36,0,0,v4_Greaternumber_Minusbased
+.globl v4_Greaternumber_Minusbased
+	.type	v4_Greaternumber_Minusbased,@function
+v4_Greaternumber_Minusbased:
+.stabn 68,0,931,.LMa960-v4_Greaternumber_Minusbased
+.LMa960:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,931,.LMb960-v4_Greaternumber_Minusbased
+.LMb960:
+.LBB153:
+.stabn 68,0,932,.LM961-v4_Greaternumber_Minusbased
+.LM961:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	pop %ebx
+	leave
+	jmp v4_Store
+.LBE153:
+.stabn 68,0,932,.LM971-v4_Greaternumber_Minusbased
+.LM971:
+	pop %ebx
+	leave
+	ret
+.Lfe153:
+	.size	 v4_Greaternumber_Minusbased,.Lfe153-v4_Greaternumber_Minusbased
+.stabn	192,0,0,.LBB153-v4_Greaternumber_Minusbased
+.stabn	224,0,0,.LBE153-v4_Greaternumber_Minusbased
+.Lscope153:
+.stabs	"",36,0,0,.Lscope153-v4_Greaternumber_Minusbased
+.text
+	.align 4
+.stabs "v4_gn1:F1",36,0,0,v4_gn1
+.globl v4_gn1
+	.type	v4_gn1,@function
+v4_gn1:
+.stabn 68,0,941,.LMa972-v4_gn1
+.LMa972:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,941,.LMb972-v4_gn1
+.LMb972:
+.LBB154:
+.stabn 68,0,942,.LM973-v4_gn1
+.LM973:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+.stabn 68,0,943,.LM978-v4_gn1
+.LM978:
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,944,.LM981-v4_gn1
+.LM981:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS106
+	call v4__dscheck
+.LDS106:
+	mov %ecx,v4__dsindex
+	call v4_z2swap
+	call v4_Greaternumber
+	call v4_swap
+	call v4_drop
+.stabn 68,0,945,.LM989-v4_gn1
+.LM989:
+	call v4_r_Greater
+	call v4_base
+	pop %ebx
+	leave
+	jmp v4_Store
+.LBE154:
+.stabn 68,0,945,.LM993-v4_gn1
+.LM993:
+	pop %ebx
+	leave
+	ret
+.Lfe154:
+	.size	 v4_gn1,.Lfe154-v4_gn1
+.stabn	192,0,0,.LBB154-v4_gn1
+.stabn	224,0,0,.LBE154-v4_gn1
+.Lscope154:
+.stabs	"",36,0,0,.Lscope154-v4_gn1
+.text
+	.align 4
+.stabs "v4_gn2:F1",36,0,0,v4_gn2
+.globl v4_gn2
+	.type	v4_gn2,@function
+v4_gn2:
+.stabn 68,0,953,.LMa994-v4_gn2
+.LMa994:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,953,.LMb994-v4_gn2
+.LMb994:
+.LBB155:
+.stabn 68,0,954,.LM995-v4_gn2
+.LM995:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_base
+	call v4_Fetch
+	call v4_decimal
+	call v4_base
+	call v4_Fetch
+	call v4_r_Greater
+	call v4_base
+	pop %ebx
+	leave
+	jmp v4_Store
+.LBE155:
+.stabn 68,0,954,.LM1008-v4_gn2
+.LM1008:
+	pop %ebx
+	leave
+	ret
+.Lfe155:
+	.size	 v4_gn2,.Lfe155-v4_gn2
+.stabn	192,0,0,.LBB155-v4_gn2
+.stabn	224,0,0,.LBE155-v4_gn2
+.Lscope155:
+.stabs	"",36,0,0,.Lscope155-v4_gn2
+.text
+	.align 4
+.stabs "v4_seebuf:F1",36,0,0,v4_seebuf
+.globl v4_seebuf
+	.type	v4_seebuf,@function
+v4_seebuf:
+.stabn 68,0,965,.LMa1009-v4_seebuf
+.LMa1009:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,965,.LMb1009-v4_seebuf
+.LMb1009:
+.LBB160:
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS107
+	call v4__dscheck
+.LDS107:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS108
+	call v4__dscheck
+.LDS108:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS109
+	call v4__dscheck
+.LDS109:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_char_Plus
+	pop %ebx
+	leave
+	jmp v4_c_Fetch
+.LBE160:
+.stabn 68,0,965,.LM1023-v4_seebuf
+.LM1023:
+	pop %ebx
+	leave
+	ret
+.Lfe160:
+	.size	 v4_seebuf,.Lfe160-v4_seebuf
+.stabn	192,0,0,.LBB160-v4_seebuf
+.stabn	224,0,0,.LBE160-v4_seebuf
+.Lscope160:
+.stabs	"",36,0,0,.Lscope160-v4_seebuf
+.text
+	.align 4
+.stabs "v4_output_Minustest:F1",36,0,0,v4_output_Minustest
+.globl v4_output_Minustest
+	.type	v4_output_Minustest,@function
+v4_output_Minustest:
+.stabn 68,0,997,.LMa1024-v4_output_Minustest
+.LMa1024:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+.stabn 68,0,997,.LMb1024-v4_output_Minustest
+.LMb1024:
+.LBB163:
+.stabn 68,0,998,.LM1025-v4_output_Minustest
+.LM1025:
+	lea .LC24,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $40,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS110
+	call v4__dscheck
+.LDS110:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,999,.LM1031-v4_output_Minustest
+.LM1031:
+	mov $10,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	mov v4__dsindex,%ecx
+.L111:
+	mov %ecx,v4__dsindex
+	call v4_i
+	call v4_Dot
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	mov v4__dsindex,%ecx
+	jne .L111
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1000,.LM1055-v4_output_Minustest
+.LM1055:
+	lea .LC25,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $36,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS111
+	call v4__dscheck
+.LDS111:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,1001,.LM1061-v4_output_Minustest
+.LM1061:
+	mov $58,%eax
+	mov %eax,%esi
+	mov $48,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	mov v4__dsindex,%ecx
+.L114:
+	mov %ecx,v4__dsindex
+	call v4_i
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS112
+	call v4__dscheck
+.LDS112:
+	mov %ecx,v4__dsindex
+	call v4_spaces
+	call v4_emit
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	mov v4__dsindex,%ecx
+	jne .L114
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1002,.LM1088-v4_output_Minustest
+.LM1088:
+	lea .LC26,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $40,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS113
+	call v4__dscheck
+.LDS113:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,1003,.LM1094-v4_output_Minustest
+.LM1094:
+	mov $72,%eax
+	mov %eax,%esi
+	mov $65,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	mov v4__dsindex,%ecx
+.L117:
+	mov %ecx,v4__dsindex
+	call v4_i
+	call v4_emit
+	call v4_space
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	mov v4__dsindex,%ecx
+	jne .L117
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1004,.LM1119-v4_output_Minustest
+.LM1119:
+	lea .LC27,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $43,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS114
+	call v4__dscheck
+.LDS114:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,1005,.LM1125-v4_output_Minustest
+.LM1125:
+	mov $6,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	mov v4__dsindex,%ecx
+.L120:
+	mov %ecx,v4__dsindex
+	call v4_i
+	mov $48,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS115
+	call v4__dscheck
+.LDS115:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS116
+	call v4__dscheck
+.LDS116:
+	mov %ecx,v4__dsindex
+	call v4_emit
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS117
+	call v4__dscheck
+.LDS117:
+	mov %ecx,v4__dsindex
+	call v4_spaces
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	mov v4__dsindex,%ecx
+	jne .L120
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1006,.LM1159-v4_output_Minustest
+.LM1159:
+	lea .LC28,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $34,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS118
+	call v4__dscheck
+.LDS118:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,1007,.LM1165-v4_output_Minustest
+.LM1165:
+	lea .LC29,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $6,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS119
+	call v4__dscheck
+.LDS119:
+	mov %ecx,v4__dsindex
+	call v4_type
+	call v4_cr
+	lea .LC30,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $6,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS120
+	call v4__dscheck
+.LDS120:
+	mov %ecx,v4__dsindex
+	call v4_type
+	call v4_cr
+.stabn 68,0,1008,.LM1177-v4_output_Minustest
+.LM1177:
+	lea .LC31,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $64,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS121
+	call v4__dscheck
+.LDS121:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,1009,.LM1183-v4_output_Minustest
+.LM1183:
+	lea .LC32,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $10,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS122
+	call v4__dscheck
+.LDS122:
+	mov %ecx,v4__dsindex
+	call v4__type
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS123
+	call v4__dscheck
+.LDS123:
+	mov %ecx,v4__dsindex
+	call v4_Dot
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS124
+	call v4__dscheck
+.LDS124:
+	mov %ecx,v4__dsindex
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,1010,.LM1195-v4_output_Minustest
+.LM1195:
+	lea .LC33,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $10,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS125
+	call v4__dscheck
+.LDS125:
+	mov %ecx,v4__dsindex
+	call v4__type
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS126
+	call v4__dscheck
+.LDS126:
+	mov %ecx,v4__dsindex
+	call v4_u_Dot
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS127
+	call v4__dscheck
+.LDS127:
+	mov %ecx,v4__dsindex
+	call v4_u_Dot
+	pop %esi
+	pop %ebx
+	leave
+	jmp v4_cr
+.LBE163:
+.stabn 68,0,1011,.LM1208-v4_output_Minustest
+.LM1208:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe163:
+	.size	 v4_output_Minustest,.Lfe163-v4_output_Minustest
+.stabn	192,0,0,.LBB163-v4_output_Minustest
+.stabn	224,0,0,.LBE163-v4_output_Minustest
+.Lscope163:
+.stabs	"",36,0,0,.Lscope163-v4_output_Minustest
+.text
+	.align 4
+.stabs "v4_accept_Minustest:F1",36,0,0,v4_accept_Minustest
+.globl v4_accept_Minustest
+	.type	v4_accept_Minustest,@function
+v4_accept_Minustest:
+.stabn 68,0,1020,.LMa1209-v4_accept_Minustest
+.LMa1209:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,1020,.LMb1209-v4_accept_Minustest
+.LMb1209:
+.LBB171:
+.stabn 68,0,1021,.LM1210-v4_accept_Minustest
+.LM1210:
+	call v4_cr
+	lea .LC35,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $32,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS128
+	call v4__dscheck
+.LDS128:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,1022,.LM1217-v4_accept_Minustest
+.LM1217:
+	lea v4_abuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $80,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS129
+	call v4__dscheck
+.LDS129:
+	mov %ecx,v4__dsindex
+	call v4_accept
+.stabn 68,0,1023,.LM1222-v4_accept_Minustest
+.LM1222:
+	call v4_cr
+	lea .LC36,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $10,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS130
+	call v4__dscheck
+.LDS130:
+	mov %ecx,v4__dsindex
+	call v4__type
+	mov $34,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS131
+	call v4__dscheck
+.LDS131:
+	mov %ecx,v4__dsindex
+	call v4_emit
+.stabn 68,0,1024,.LM1231-v4_accept_Minustest
+.LM1231:
+	lea v4_abuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS132
+	call v4__dscheck
+.LDS132:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	call v4_type
+	mov $34,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS133
+	call v4__dscheck
+.LDS133:
+	mov %ecx,v4__dsindex
+	call v4_emit
+	pop %ebx
+	leave
+	jmp v4_cr
+.LBE171:
+.stabn 68,0,1025,.LM1240-v4_accept_Minustest
+.LM1240:
+	pop %ebx
+	leave
+	ret
+.Lfe171:
+	.size	 v4_accept_Minustest,.Lfe171-v4_accept_Minustest
+.stabn	192,0,0,.LBB171-v4_accept_Minustest
+.stabn	224,0,0,.LBE171-v4_accept_Minustest
+.Lscope171:
+.stabs	"",36,0,0,.Lscope171-v4_accept_Minustest
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,13,.LMa1241-main
+.LMa1241:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,13,.LMb1241-main
+.LMb1241:
+.LBB1:
+	lea .LC0,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $18,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS134
+	call v4__dscheck
+.LDS134:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS135
+	call v4__dscheck
+.LDS135:
+	mov %ecx,v4__dsindex
+	call v4__strictansi
+	call v4_Store
+.stabn 68,0,19,.LM1253-main
+.LM1253:
+	lea .LC1,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $35,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS136
+	call v4__dscheck
+.LDS136:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,21,.LM1259-main
+.LM1259:
+	mov $180,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS137
+	call v4__dscheck
+.LDS137:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS138
+	call v4__dscheck
+.LDS138:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS139
+	call v4__dscheck
+.LDS139:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,22,.LM1271-main
+.LM1271:
+	mov $190,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS140
+	call v4__dscheck
+.LDS140:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS141
+	call v4__dscheck
+.LDS141:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS142
+	call v4__dscheck
+.LDS142:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,23,.LM1283-main
+.LM1283:
+	mov $200,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS143
+	call v4__dscheck
+.LDS143:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS144
+	call v4__dscheck
+.LDS144:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS145
+	call v4__dscheck
+.LDS145:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,24,.LM1295-main
+.LM1295:
+	mov $210,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS146
+	call v4__dscheck
+.LDS146:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS147
+	call v4__dscheck
+.LDS147:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS148
+	call v4__dscheck
+.LDS148:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,26,.LM1307-main
+.LM1307:
+	mov $230,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS149
+	call v4__dscheck
+.LDS149:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS150
+	call v4__dscheck
+.LDS150:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS151
+	call v4__dscheck
+.LDS151:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,27,.LM1320-main
+.LM1320:
+	mov $240,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS152
+	call v4__dscheck
+.LDS152:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS153
+	call v4__dscheck
+.LDS153:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS154
+	call v4__dscheck
+.LDS154:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,29,.LM1333-main
+.LM1333:
+	xor %eax,%eax
+	mov %eax,(v4_z0s)
+.stabn 68,0,30,.LM1337-main
+.LM1337:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,(v4_z1s)
+.stabn 68,0,32,.LM1342-main
+.LM1342:
+	mov $290,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS155
+	call v4__dscheck
+.LDS155:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS156
+	call v4__dscheck
+.LDS156:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS157
+	call v4__dscheck
+.LDS157:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,33,.LM1352-main
+.LM1352:
+	mov $300,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS158
+	call v4__dscheck
+.LDS158:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS159
+	call v4__dscheck
+.LDS159:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS160
+	call v4__dscheck
+.LDS160:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,35,.LM1362-main
+.LM1362:
+	mov $320,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS161
+	call v4__dscheck
+.LDS161:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%edx
+	and %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS162
+	call v4__dscheck
+.LDS162:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS163
+	call v4__dscheck
+.LDS163:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,36,.LM1378-main
+.LM1378:
+	mov $330,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS164
+	call v4__dscheck
+.LDS164:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS165
+	call v4__dscheck
+.LDS165:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS166
+	call v4__dscheck
+.LDS166:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,37,.LM1390-main
+.LM1390:
+	mov $340,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS167
+	call v4__dscheck
+.LDS167:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS168
+	call v4__dscheck
+.LDS168:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS169
+	call v4__dscheck
+.LDS169:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,38,.LM1402-main
+.LM1402:
+	mov $350,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS170
+	call v4__dscheck
+.LDS170:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	and %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS171
+	call v4__dscheck
+.LDS171:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS172
+	call v4__dscheck
+.LDS172:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,40,.LM1418-main
+.LM1418:
+	mov $370,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS173
+	call v4__dscheck
+.LDS173:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%edx
+	or %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS174
+	call v4__dscheck
+.LDS174:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS175
+	call v4__dscheck
+.LDS175:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,41,.LM1434-main
+.LM1434:
+	mov $380,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS176
+	call v4__dscheck
+.LDS176:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS177
+	call v4__dscheck
+.LDS177:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS178
+	call v4__dscheck
+.LDS178:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,42,.LM1446-main
+.LM1446:
+	mov $390,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS179
+	call v4__dscheck
+.LDS179:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS180
+	call v4__dscheck
+.LDS180:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS181
+	call v4__dscheck
+.LDS181:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,43,.LM1458-main
+.LM1458:
+	mov $400,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS182
+	call v4__dscheck
+.LDS182:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	or %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS183
+	call v4__dscheck
+.LDS183:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS184
+	call v4__dscheck
+.LDS184:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,45,.LM1474-main
+.LM1474:
+	mov $420,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS185
+	call v4__dscheck
+.LDS185:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%edx
+	xor %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS186
+	call v4__dscheck
+.LDS186:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS187
+	call v4__dscheck
+.LDS187:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,46,.LM1490-main
+.LM1490:
+	mov $430,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS188
+	call v4__dscheck
+.LDS188:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS189
+	call v4__dscheck
+.LDS189:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS190
+	call v4__dscheck
+.LDS190:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,47,.LM1502-main
+.LM1502:
+	mov $440,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS191
+	call v4__dscheck
+.LDS191:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS192
+	call v4__dscheck
+.LDS192:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS193
+	call v4__dscheck
+.LDS193:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,48,.LM1514-main
+.LM1514:
+	mov $450,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS194
+	call v4__dscheck
+.LDS194:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	xor %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS195
+	call v4__dscheck
+.LDS195:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS196
+	call v4__dscheck
+.LDS196:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,51,.LM1530-main
+.LM1530:
+	lea .LC2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $27,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS197
+	call v4__dscheck
+.LDS197:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,54,.LM1537-main
+.LM1537:
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS198
+	call v4__dscheck
+.LDS198:
+.L121:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS199
+	call v4__dscheck
+.LDS199:
+	test %eax,%eax
+	je .L122
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS200
+	call v4__dscheck
+.LDS200:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS201
+	call v4__dscheck
+.LDS201:
+	jmp .L121
+.L122:
+.stabn 68,0,55,.LM1553-main
+.LM1553:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,(v4_msb)
+.stabn 68,0,57,.LM1555-main
+.LM1555:
+	mov $540,%eax
+	cmp $4080,%ecx
+	jbe .LDS202
+	call v4__dscheck
+.LDS202:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS203
+	call v4__dscheck
+.LDS203:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS204
+	call v4__dscheck
+.LDS204:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS205
+	call v4__dscheck
+.LDS205:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,58,.LM1565-main
+.LM1565:
+	mov $550,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS206
+	call v4__dscheck
+.LDS206:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS207
+	call v4__dscheck
+.LDS207:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS208
+	call v4__dscheck
+.LDS208:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,59,.LM1575-main
+.LM1575:
+	mov $560,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS209
+	call v4__dscheck
+.LDS209:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $32768,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS210
+	call v4__dscheck
+.LDS210:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $32768,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS211
+	call v4__dscheck
+.LDS211:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,60,.LM1585-main
+.LM1585:
+	mov $570,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS212
+	call v4__dscheck
+.LDS212:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS213
+	call v4__dscheck
+.LDS213:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS214
+	call v4__dscheck
+.LDS214:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,61,.LM1600-main
+.LM1600:
+	mov $580,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS215
+	call v4__dscheck
+.LDS215:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_msb),%eax
+	add %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS216
+	call v4__dscheck
+.LDS216:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS217
+	call v4__dscheck
+.LDS217:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,63,.LM1613-main
+.LM1613:
+	mov $600,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS218
+	call v4__dscheck
+.LDS218:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS219
+	call v4__dscheck
+.LDS219:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS220
+	call v4__dscheck
+.LDS220:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,64,.LM1623-main
+.LM1623:
+	mov $610,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS221
+	call v4__dscheck
+.LDS221:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS222
+	call v4__dscheck
+.LDS222:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS223
+	call v4__dscheck
+.LDS223:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,65,.LM1633-main
+.LM1633:
+	mov $620,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS224
+	call v4__dscheck
+.LDS224:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $8192,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS225
+	call v4__dscheck
+.LDS225:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $8192,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS226
+	call v4__dscheck
+.LDS226:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,66,.LM1643-main
+.LM1643:
+	mov $630,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS227
+	call v4__dscheck
+.LDS227:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS228
+	call v4__dscheck
+.LDS228:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS229
+	call v4__dscheck
+.LDS229:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,67,.LM1655-main
+.LM1655:
+	mov $640,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS230
+	call v4__dscheck
+.LDS230:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS231
+	call v4__dscheck
+.LDS231:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS232
+	call v4__dscheck
+.LDS232:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,68,.LM1670-main
+.LM1670:
+	mov $650,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS233
+	call v4__dscheck
+.LDS233:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_msb),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS234
+	call v4__dscheck
+.LDS234:
+	mov %ecx,v4__dsindex
+	call v4_z2_Slash
+	mov (v4_msb),%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	and %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS235
+	call v4__dscheck
+.LDS235:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS236
+	call v4__dscheck
+.LDS236:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_msb),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS237
+	call v4__dscheck
+.LDS237:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,70,.LM1687-main
+.LM1687:
+	mov $670,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS238
+	call v4__dscheck
+.LDS238:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS239
+	call v4__dscheck
+.LDS239:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS240
+	call v4__dscheck
+.LDS240:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,71,.LM1699-main
+.LM1699:
+	mov $680,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS241
+	call v4__dscheck
+.LDS241:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS242
+	call v4__dscheck
+.LDS242:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS243
+	call v4__dscheck
+.LDS243:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,72,.LM1711-main
+.LM1711:
+	mov $690,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS244
+	call v4__dscheck
+.LDS244:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS245
+	call v4__dscheck
+.LDS245:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS246
+	call v4__dscheck
+.LDS246:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,73,.LM1723-main
+.LM1723:
+	mov $700,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS247
+	call v4__dscheck
+.LDS247:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $32768,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS248
+	call v4__dscheck
+.LDS248:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $32768,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS249
+	call v4__dscheck
+.LDS249:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,74,.LM1735-main
+.LM1735:
+	mov $710,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS250
+	call v4__dscheck
+.LDS250:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS251
+	call v4__dscheck
+.LDS251:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS252
+	call v4__dscheck
+.LDS252:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,75,.LM1752-main
+.LM1752:
+	mov $720,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS253
+	call v4__dscheck
+.LDS253:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_msb),%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	xchg %edx,%ecx
+	shl %cl,%eax
+	xchg %edx,%ecx
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS254
+	call v4__dscheck
+.LDS254:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS255
+	call v4__dscheck
+.LDS255:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,77,.LM1768-main
+.LM1768:
+	mov $740,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS256
+	call v4__dscheck
+.LDS256:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS257
+	call v4__dscheck
+.LDS257:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS258
+	call v4__dscheck
+.LDS258:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,78,.LM1780-main
+.LM1780:
+	mov $750,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS259
+	call v4__dscheck
+.LDS259:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS260
+	call v4__dscheck
+.LDS260:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS261
+	call v4__dscheck
+.LDS261:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,79,.LM1792-main
+.LM1792:
+	mov $760,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS262
+	call v4__dscheck
+.LDS262:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS263
+	call v4__dscheck
+.LDS263:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS264
+	call v4__dscheck
+.LDS264:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,80,.LM1804-main
+.LM1804:
+	mov $770,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS265
+	call v4__dscheck
+.LDS265:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS266
+	call v4__dscheck
+.LDS266:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS267
+	call v4__dscheck
+.LDS267:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,81,.LM1816-main
+.LM1816:
+	mov $780,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS268
+	call v4__dscheck
+.LDS268:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS269
+	call v4__dscheck
+.LDS269:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS270
+	call v4__dscheck
+.LDS270:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,82,.LM1828-main
+.LM1828:
+	mov $790,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS271
+	call v4__dscheck
+.LDS271:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_msb),%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	xchg %edx,%ecx
+	shr %cl,%eax
+	xchg %edx,%ecx
+	mov %eax,%esi
+	mov (v4_msb),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	and %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS272
+	call v4__dscheck
+.LDS272:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS273
+	call v4__dscheck
+.LDS273:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,83,.LM1851-main
+.LM1851:
+	mov $800,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS274
+	call v4__dscheck
+.LDS274:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_msb),%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	xchg %edx,%ecx
+	shr %cl,%eax
+	xchg %edx,%ecx
+	add %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS275
+	call v4__dscheck
+.LDS275:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_msb),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS276
+	call v4__dscheck
+.LDS276:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,86,.LM1871-main
+.LM1871:
+	lea .LC3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $54,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS277
+	call v4__dscheck
+.LDS277:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,87,.LM1877-main
+.LM1877:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,(v4_max_Minusuint)
+.stabn 68,0,88,.LM1882-main
+.LM1882:
+	mov $2147483647,%eax
+	mov %eax,(v4_max_Minusint)
+.stabn 68,0,89,.LM1890-main
+.LM1890:
+	mov $-2147483648,%eax
+	mov %eax,(v4_min_Minusint)
+.stabn 68,0,90,.LM1899-main
+.LM1899:
+	mov $2147483647,%eax
+	mov %eax,(v4_mid_Minusuint)
+.stabn 68,0,91,.LM1907-main
+.LM1907:
+	mov $-2147483648,%eax
+	mov %eax,(v4_mid_Minusuint_Plus1)
+.stabn 68,0,93,.LM1916-main
+.LM1916:
+	xor %eax,%eax
+	mov %eax,(v4_Lessfalse_Greater)
+.stabn 68,0,94,.LM1920-main
+.LM1920:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,(v4_Lesstrue_Greater)
+.stabn 68,0,96,.LM1924-main
+.LM1924:
+	mov $930,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS278
+	call v4__dscheck
+.LDS278:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,97,.LM1929-main
+.LM1929:
+	mov $940,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS279
+	call v4__dscheck
+.LDS279:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS280
+	call v4__dscheck
+.LDS280:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS281
+	call v4__dscheck
+.LDS281:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,98,.LM1942-main
+.LM1942:
+	mov $950,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS282
+	call v4__dscheck
+.LDS282:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS283
+	call v4__dscheck
+.LDS283:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS284
+	call v4__dscheck
+.LDS284:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,99,.LM1955-main
+.LM1955:
+	mov $960,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS285
+	call v4__dscheck
+.LDS285:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS286
+	call v4__dscheck
+.LDS286:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS287
+	call v4__dscheck
+.LDS287:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,100,.LM1968-main
+.LM1968:
+	mov $970,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS288
+	call v4__dscheck
+.LDS288:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS289
+	call v4__dscheck
+.LDS289:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS290
+	call v4__dscheck
+.LDS290:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,101,.LM1981-main
+.LM1981:
+	mov $980,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS291
+	call v4__dscheck
+.LDS291:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS292
+	call v4__dscheck
+.LDS292:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS293
+	call v4__dscheck
+.LDS293:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,102,.LM1994-main
+.LM1994:
+	mov $990,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS294
+	call v4__dscheck
+.LDS294:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS295
+	call v4__dscheck
+.LDS295:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS296
+	call v4__dscheck
+.LDS296:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,103,.LM2007-main
+.LM2007:
+	mov $1000,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS297
+	call v4__dscheck
+.LDS297:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS298
+	call v4__dscheck
+.LDS298:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS299
+	call v4__dscheck
+.LDS299:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,105,.LM2020-main
+.LM2020:
+	mov $1020,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS300
+	call v4__dscheck
+.LDS300:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS301
+	call v4__dscheck
+.LDS301:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS302
+	call v4__dscheck
+.LDS302:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,106,.LM2036-main
+.LM2036:
+	mov $1030,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS303
+	call v4__dscheck
+.LDS303:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS304
+	call v4__dscheck
+.LDS304:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS305
+	call v4__dscheck
+.LDS305:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,107,.LM2052-main
+.LM2052:
+	mov $1040,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS306
+	call v4__dscheck
+.LDS306:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS307
+	call v4__dscheck
+.LDS307:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS308
+	call v4__dscheck
+.LDS308:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,108,.LM2068-main
+.LM2068:
+	mov $1050,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS309
+	call v4__dscheck
+.LDS309:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS310
+	call v4__dscheck
+.LDS310:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS311
+	call v4__dscheck
+.LDS311:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,109,.LM2084-main
+.LM2084:
+	mov $1060,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS312
+	call v4__dscheck
+.LDS312:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS313
+	call v4__dscheck
+.LDS313:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS314
+	call v4__dscheck
+.LDS314:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,110,.LM2100-main
+.LM2100:
+	mov $1070,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS315
+	call v4__dscheck
+.LDS315:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS316
+	call v4__dscheck
+.LDS316:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS317
+	call v4__dscheck
+.LDS317:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,111,.LM2116-main
+.LM2116:
+	mov $1080,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS318
+	call v4__dscheck
+.LDS318:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS319
+	call v4__dscheck
+.LDS319:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS320
+	call v4__dscheck
+.LDS320:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,113,.LM2132-main
+.LM2132:
+	mov $1100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS321
+	call v4__dscheck
+.LDS321:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	test %eax,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS322
+	call v4__dscheck
+.LDS322:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS323
+	call v4__dscheck
+.LDS323:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,114,.LM2145-main
+.LM2145:
+	mov $1110,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS324
+	call v4__dscheck
+.LDS324:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	test %eax,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS325
+	call v4__dscheck
+.LDS325:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS326
+	call v4__dscheck
+.LDS326:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,115,.LM2158-main
+.LM2158:
+	mov $1120,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS327
+	call v4__dscheck
+.LDS327:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	test %eax,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS328
+	call v4__dscheck
+.LDS328:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS329
+	call v4__dscheck
+.LDS329:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,116,.LM2171-main
+.LM2171:
+	mov $1130,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS330
+	call v4__dscheck
+.LDS330:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	test %eax,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS331
+	call v4__dscheck
+.LDS331:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS332
+	call v4__dscheck
+.LDS332:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,117,.LM2184-main
+.LM2184:
+	mov $1140,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS333
+	call v4__dscheck
+.LDS333:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	test %eax,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS334
+	call v4__dscheck
+.LDS334:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS335
+	call v4__dscheck
+.LDS335:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,119,.LM2197-main
+.LM2197:
+	mov $1160,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS336
+	call v4__dscheck
+.LDS336:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS337
+	call v4__dscheck
+.LDS337:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS338
+	call v4__dscheck
+.LDS338:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,120,.LM2213-main
+.LM2213:
+	mov $1170,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS339
+	call v4__dscheck
+.LDS339:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	mov $2,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS340
+	call v4__dscheck
+.LDS340:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS341
+	call v4__dscheck
+.LDS341:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,121,.LM2229-main
+.LM2229:
+	mov $1180,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS342
+	call v4__dscheck
+.LDS342:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS343
+	call v4__dscheck
+.LDS343:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS344
+	call v4__dscheck
+.LDS344:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,122,.LM2245-main
+.LM2245:
+	mov $1190,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS345
+	call v4__dscheck
+.LDS345:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS346
+	call v4__dscheck
+.LDS346:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS347
+	call v4__dscheck
+.LDS347:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,123,.LM2261-main
+.LM2261:
+	mov $1200,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS348
+	call v4__dscheck
+.LDS348:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS349
+	call v4__dscheck
+.LDS349:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS350
+	call v4__dscheck
+.LDS350:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,124,.LM2277-main
+.LM2277:
+	mov $1210,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS351
+	call v4__dscheck
+.LDS351:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%esi
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS352
+	call v4__dscheck
+.LDS352:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS353
+	call v4__dscheck
+.LDS353:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,125,.LM2293-main
+.LM2293:
+	mov $1220,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS354
+	call v4__dscheck
+.LDS354:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS355
+	call v4__dscheck
+.LDS355:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS356
+	call v4__dscheck
+.LDS356:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,126,.LM2309-main
+.LM2309:
+	mov $1230,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS357
+	call v4__dscheck
+.LDS357:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS358
+	call v4__dscheck
+.LDS358:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS359
+	call v4__dscheck
+.LDS359:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,127,.LM2325-main
+.LM2325:
+	mov $1240,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS360
+	call v4__dscheck
+.LDS360:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS361
+	call v4__dscheck
+.LDS361:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS362
+	call v4__dscheck
+.LDS362:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,128,.LM2341-main
+.LM2341:
+	mov $1250,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS363
+	call v4__dscheck
+.LDS363:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS364
+	call v4__dscheck
+.LDS364:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS365
+	call v4__dscheck
+.LDS365:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,129,.LM2357-main
+.LM2357:
+	mov $1260,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS366
+	call v4__dscheck
+.LDS366:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS367
+	call v4__dscheck
+.LDS367:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS368
+	call v4__dscheck
+.LDS368:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,130,.LM2373-main
+.LM2373:
+	mov $1270,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS369
+	call v4__dscheck
+.LDS369:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS370
+	call v4__dscheck
+.LDS370:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS371
+	call v4__dscheck
+.LDS371:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,131,.LM2389-main
+.LM2389:
+	mov $1280,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS372
+	call v4__dscheck
+.LDS372:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS373
+	call v4__dscheck
+.LDS373:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS374
+	call v4__dscheck
+.LDS374:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,132,.LM2405-main
+.LM2405:
+	mov $1290,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS375
+	call v4__dscheck
+.LDS375:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS376
+	call v4__dscheck
+.LDS376:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS377
+	call v4__dscheck
+.LDS377:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,133,.LM2421-main
+.LM2421:
+	mov $1300,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS378
+	call v4__dscheck
+.LDS378:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%esi
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS379
+	call v4__dscheck
+.LDS379:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS380
+	call v4__dscheck
+.LDS380:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,134,.LM2437-main
+.LM2437:
+	mov $1310,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS381
+	call v4__dscheck
+.LDS381:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS382
+	call v4__dscheck
+.LDS382:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS383
+	call v4__dscheck
+.LDS383:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,136,.LM2453-main
+.LM2453:
+	mov $1330,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS384
+	call v4__dscheck
+.LDS384:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS385
+	call v4__dscheck
+.LDS385:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS386
+	call v4__dscheck
+.LDS386:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,137,.LM2469-main
+.LM2469:
+	mov $1340,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS387
+	call v4__dscheck
+.LDS387:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	mov $2,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS388
+	call v4__dscheck
+.LDS388:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS389
+	call v4__dscheck
+.LDS389:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,138,.LM2485-main
+.LM2485:
+	mov $1350,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS390
+	call v4__dscheck
+.LDS390:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS391
+	call v4__dscheck
+.LDS391:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS392
+	call v4__dscheck
+.LDS392:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,139,.LM2501-main
+.LM2501:
+	mov $1360,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS393
+	call v4__dscheck
+.LDS393:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS394
+	call v4__dscheck
+.LDS394:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS395
+	call v4__dscheck
+.LDS395:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,140,.LM2517-main
+.LM2517:
+	mov $1370,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS396
+	call v4__dscheck
+.LDS396:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS397
+	call v4__dscheck
+.LDS397:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS398
+	call v4__dscheck
+.LDS398:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,141,.LM2533-main
+.LM2533:
+	mov $1380,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS399
+	call v4__dscheck
+.LDS399:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%esi
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS400
+	call v4__dscheck
+.LDS400:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS401
+	call v4__dscheck
+.LDS401:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,142,.LM2549-main
+.LM2549:
+	mov $1390,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS402
+	call v4__dscheck
+.LDS402:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS403
+	call v4__dscheck
+.LDS403:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS404
+	call v4__dscheck
+.LDS404:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,143,.LM2565-main
+.LM2565:
+	mov $1400,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS405
+	call v4__dscheck
+.LDS405:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS406
+	call v4__dscheck
+.LDS406:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS407
+	call v4__dscheck
+.LDS407:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,144,.LM2581-main
+.LM2581:
+	mov $1410,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS408
+	call v4__dscheck
+.LDS408:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS409
+	call v4__dscheck
+.LDS409:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS410
+	call v4__dscheck
+.LDS410:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,145,.LM2597-main
+.LM2597:
+	mov $1420,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS411
+	call v4__dscheck
+.LDS411:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS412
+	call v4__dscheck
+.LDS412:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS413
+	call v4__dscheck
+.LDS413:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,146,.LM2613-main
+.LM2613:
+	mov $1430,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS414
+	call v4__dscheck
+.LDS414:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS415
+	call v4__dscheck
+.LDS415:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS416
+	call v4__dscheck
+.LDS416:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,147,.LM2629-main
+.LM2629:
+	mov $1440,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS417
+	call v4__dscheck
+.LDS417:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS418
+	call v4__dscheck
+.LDS418:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS419
+	call v4__dscheck
+.LDS419:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,148,.LM2645-main
+.LM2645:
+	mov $1450,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS420
+	call v4__dscheck
+.LDS420:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS421
+	call v4__dscheck
+.LDS421:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS422
+	call v4__dscheck
+.LDS422:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,149,.LM2661-main
+.LM2661:
+	mov $1460,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS423
+	call v4__dscheck
+.LDS423:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS424
+	call v4__dscheck
+.LDS424:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS425
+	call v4__dscheck
+.LDS425:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,150,.LM2677-main
+.LM2677:
+	mov $1470,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS426
+	call v4__dscheck
+.LDS426:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%esi
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS427
+	call v4__dscheck
+.LDS427:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS428
+	call v4__dscheck
+.LDS428:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,151,.LM2693-main
+.LM2693:
+	mov $1480,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS429
+	call v4__dscheck
+.LDS429:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setg %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS430
+	call v4__dscheck
+.LDS430:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS431
+	call v4__dscheck
+.LDS431:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,153,.LM2709-main
+.LM2709:
+	mov $1500,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS432
+	call v4__dscheck
+.LDS432:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS433
+	call v4__dscheck
+.LDS433:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS434
+	call v4__dscheck
+.LDS434:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,154,.LM2725-main
+.LM2725:
+	mov $1510,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS435
+	call v4__dscheck
+.LDS435:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	mov $2,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS436
+	call v4__dscheck
+.LDS436:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS437
+	call v4__dscheck
+.LDS437:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,155,.LM2741-main
+.LM2741:
+	mov $1520,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS438
+	call v4__dscheck
+.LDS438:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS439
+	call v4__dscheck
+.LDS439:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS440
+	call v4__dscheck
+.LDS440:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,156,.LM2757-main
+.LM2757:
+	mov $1530,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS441
+	call v4__dscheck
+.LDS441:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS442
+	call v4__dscheck
+.LDS442:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS443
+	call v4__dscheck
+.LDS443:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,157,.LM2773-main
+.LM2773:
+	mov $1540,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS444
+	call v4__dscheck
+.LDS444:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS445
+	call v4__dscheck
+.LDS445:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS446
+	call v4__dscheck
+.LDS446:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,158,.LM2789-main
+.LM2789:
+	mov $1550,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS447
+	call v4__dscheck
+.LDS447:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS448
+	call v4__dscheck
+.LDS448:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS449
+	call v4__dscheck
+.LDS449:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,159,.LM2805-main
+.LM2805:
+	mov $1560,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS450
+	call v4__dscheck
+.LDS450:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS451
+	call v4__dscheck
+.LDS451:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS452
+	call v4__dscheck
+.LDS452:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,160,.LM2821-main
+.LM2821:
+	mov $1570,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS453
+	call v4__dscheck
+.LDS453:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS454
+	call v4__dscheck
+.LDS454:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS455
+	call v4__dscheck
+.LDS455:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,161,.LM2837-main
+.LM2837:
+	mov $1580,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS456
+	call v4__dscheck
+.LDS456:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS457
+	call v4__dscheck
+.LDS457:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS458
+	call v4__dscheck
+.LDS458:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,162,.LM2853-main
+.LM2853:
+	mov $1590,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS459
+	call v4__dscheck
+.LDS459:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS460
+	call v4__dscheck
+.LDS460:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS461
+	call v4__dscheck
+.LDS461:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,163,.LM2869-main
+.LM2869:
+	mov $1600,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS462
+	call v4__dscheck
+.LDS462:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS463
+	call v4__dscheck
+.LDS463:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS464
+	call v4__dscheck
+.LDS464:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,164,.LM2885-main
+.LM2885:
+	mov $1610,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS465
+	call v4__dscheck
+.LDS465:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%esi
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS466
+	call v4__dscheck
+.LDS466:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS467
+	call v4__dscheck
+.LDS467:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,165,.LM2901-main
+.LM2901:
+	mov $1611,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS468
+	call v4__dscheck
+.LDS468:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%esi
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	seta %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS469
+	call v4__dscheck
+.LDS469:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS470
+	call v4__dscheck
+.LDS470:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,166,.LM2917-main
+.LM2917:
+	mov $1612,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS471
+	call v4__dscheck
+.LDS471:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%esi
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	seta %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS472
+	call v4__dscheck
+.LDS472:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS473
+	call v4__dscheck
+.LDS473:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,167,.LM2933-main
+.LM2933:
+	mov $1613,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS474
+	call v4__dscheck
+.LDS474:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%esi
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	seta %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS475
+	call v4__dscheck
+.LDS475:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS476
+	call v4__dscheck
+.LDS476:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,168,.LM2949-main
+.LM2949:
+	mov $1614,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS477
+	call v4__dscheck
+.LDS477:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	cmp %edx,%eax
+	seta %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS478
+	call v4__dscheck
+.LDS478:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS479
+	call v4__dscheck
+.LDS479:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,169,.LM2965-main
+.LM2965:
+	mov $1615,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS480
+	call v4__dscheck
+.LDS480:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%esi
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setbe %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS481
+	call v4__dscheck
+.LDS481:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS482
+	call v4__dscheck
+.LDS482:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,170,.LM2981-main
+.LM2981:
+	mov $1616,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS483
+	call v4__dscheck
+.LDS483:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%esi
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setbe %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS484
+	call v4__dscheck
+.LDS484:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS485
+	call v4__dscheck
+.LDS485:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,171,.LM2997-main
+.LM2997:
+	mov $1617,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS486
+	call v4__dscheck
+.LDS486:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	cmp %edx,%eax
+	setbe %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS487
+	call v4__dscheck
+.LDS487:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS488
+	call v4__dscheck
+.LDS488:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,172,.LM3013-main
+.LM3013:
+	mov $1618,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS489
+	call v4__dscheck
+.LDS489:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setbe %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS490
+	call v4__dscheck
+.LDS490:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS491
+	call v4__dscheck
+.LDS491:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,173,.LM3029-main
+.LM3029:
+	mov $1619,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS492
+	call v4__dscheck
+.LDS492:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%esi
+	mov $2147483647,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setae %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS493
+	call v4__dscheck
+.LDS493:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS494
+	call v4__dscheck
+.LDS494:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,174,.LM3045-main
+.LM3045:
+	mov $1620,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS495
+	call v4__dscheck
+.LDS495:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov %eax,%esi
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setae %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS496
+	call v4__dscheck
+.LDS496:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS497
+	call v4__dscheck
+.LDS497:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,175,.LM3061-main
+.LM3061:
+	mov $1621,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS498
+	call v4__dscheck
+.LDS498:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov %eax,%edx
+	cmp %edx,%eax
+	setae %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS499
+	call v4__dscheck
+.LDS499:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS500
+	call v4__dscheck
+.LDS500:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,176,.LM3077-main
+.LM3077:
+	mov $1622,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS501
+	call v4__dscheck
+.LDS501:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setae %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS502
+	call v4__dscheck
+.LDS502:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS503
+	call v4__dscheck
+.LDS503:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,177,.LM3093-main
+.LM3093:
+	mov $1623,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS504
+	call v4__dscheck
+.LDS504:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_u_Greater,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS505
+	call v4__dscheck
+.LDS505:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS506
+	call v4__dscheck
+.LDS506:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,178,.LM3107-main
+.LM3107:
+	mov $1624,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS507
+	call v4__dscheck
+.LDS507:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_u_Greater,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS508
+	call v4__dscheck
+.LDS508:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS509
+	call v4__dscheck
+.LDS509:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,179,.LM3121-main
+.LM3121:
+	mov $1625,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS510
+	call v4__dscheck
+.LDS510:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_u_Less_Equals,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS511
+	call v4__dscheck
+.LDS511:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS512
+	call v4__dscheck
+.LDS512:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,180,.LM3135-main
+.LM3135:
+	mov $1626,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS513
+	call v4__dscheck
+.LDS513:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_u_Less_Equals,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS514
+	call v4__dscheck
+.LDS514:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS515
+	call v4__dscheck
+.LDS515:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,181,.LM3149-main
+.LM3149:
+	mov $1627,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS516
+	call v4__dscheck
+.LDS516:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_u_Greater_Equals,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS517
+	call v4__dscheck
+.LDS517:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS518
+	call v4__dscheck
+.LDS518:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,182,.LM3163-main
+.LM3163:
+	mov $1628,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS519
+	call v4__dscheck
+.LDS519:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_u_Greater_Equals,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS520
+	call v4__dscheck
+.LDS520:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS521
+	call v4__dscheck
+.LDS521:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,184,.LM3177-main
+.LM3177:
+	mov $1630,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS522
+	call v4__dscheck
+.LDS522:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS523
+	call v4__dscheck
+.LDS523:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS524
+	call v4__dscheck
+.LDS524:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,185,.LM3189-main
+.LM3189:
+	mov $1640,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS525
+	call v4__dscheck
+.LDS525:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS526
+	call v4__dscheck
+.LDS526:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS527
+	call v4__dscheck
+.LDS527:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,186,.LM3201-main
+.LM3201:
+	mov $1650,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS528
+	call v4__dscheck
+.LDS528:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS529
+	call v4__dscheck
+.LDS529:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS530
+	call v4__dscheck
+.LDS530:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,187,.LM3213-main
+.LM3213:
+	mov $1660,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS531
+	call v4__dscheck
+.LDS531:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS532
+	call v4__dscheck
+.LDS532:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS533
+	call v4__dscheck
+.LDS533:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,188,.LM3225-main
+.LM3225:
+	mov $1670,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS534
+	call v4__dscheck
+.LDS534:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS535
+	call v4__dscheck
+.LDS535:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS536
+	call v4__dscheck
+.LDS536:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,189,.LM3237-main
+.LM3237:
+	mov $1680,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS537
+	call v4__dscheck
+.LDS537:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS538
+	call v4__dscheck
+.LDS538:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS539
+	call v4__dscheck
+.LDS539:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,190,.LM3249-main
+.LM3249:
+	mov $1690,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS540
+	call v4__dscheck
+.LDS540:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS541
+	call v4__dscheck
+.LDS541:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS542
+	call v4__dscheck
+.LDS542:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,191,.LM3261-main
+.LM3261:
+	mov $1700,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS543
+	call v4__dscheck
+.LDS543:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS544
+	call v4__dscheck
+.LDS544:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS545
+	call v4__dscheck
+.LDS545:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,192,.LM3273-main
+.LM3273:
+	mov $1710,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS546
+	call v4__dscheck
+.LDS546:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS547
+	call v4__dscheck
+.LDS547:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS548
+	call v4__dscheck
+.LDS548:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,193,.LM3285-main
+.LM3285:
+	mov $1720,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS549
+	call v4__dscheck
+.LDS549:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS550
+	call v4__dscheck
+.LDS550:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS551
+	call v4__dscheck
+.LDS551:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,194,.LM3297-main
+.LM3297:
+	mov $1730,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS552
+	call v4__dscheck
+.LDS552:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS553
+	call v4__dscheck
+.LDS553:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS554
+	call v4__dscheck
+.LDS554:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,195,.LM3309-main
+.LM3309:
+	mov $1740,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS555
+	call v4__dscheck
+.LDS555:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS556
+	call v4__dscheck
+.LDS556:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS557
+	call v4__dscheck
+.LDS557:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,196,.LM3321-main
+.LM3321:
+	mov $1750,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS558
+	call v4__dscheck
+.LDS558:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS559
+	call v4__dscheck
+.LDS559:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS560
+	call v4__dscheck
+.LDS560:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,197,.LM3333-main
+.LM3333:
+	mov $1760,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS561
+	call v4__dscheck
+.LDS561:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS562
+	call v4__dscheck
+.LDS562:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS563
+	call v4__dscheck
+.LDS563:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,198,.LM3345-main
+.LM3345:
+	mov $1770,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS564
+	call v4__dscheck
+.LDS564:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS565
+	call v4__dscheck
+.LDS565:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS566
+	call v4__dscheck
+.LDS566:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,199,.LM3357-main
+.LM3357:
+	mov $1780,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS567
+	call v4__dscheck
+.LDS567:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS568
+	call v4__dscheck
+.LDS568:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS569
+	call v4__dscheck
+.LDS569:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,201,.LM3369-main
+.LM3369:
+	mov $1800,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS570
+	call v4__dscheck
+.LDS570:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS571
+	call v4__dscheck
+.LDS571:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS572
+	call v4__dscheck
+.LDS572:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,202,.LM3381-main
+.LM3381:
+	mov $1810,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS573
+	call v4__dscheck
+.LDS573:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS574
+	call v4__dscheck
+.LDS574:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS575
+	call v4__dscheck
+.LDS575:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,203,.LM3393-main
+.LM3393:
+	mov $1820,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS576
+	call v4__dscheck
+.LDS576:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS577
+	call v4__dscheck
+.LDS577:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS578
+	call v4__dscheck
+.LDS578:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,204,.LM3405-main
+.LM3405:
+	mov $1830,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS579
+	call v4__dscheck
+.LDS579:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS580
+	call v4__dscheck
+.LDS580:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS581
+	call v4__dscheck
+.LDS581:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,205,.LM3417-main
+.LM3417:
+	mov $1840,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS582
+	call v4__dscheck
+.LDS582:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS583
+	call v4__dscheck
+.LDS583:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS584
+	call v4__dscheck
+.LDS584:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,206,.LM3429-main
+.LM3429:
+	mov $1850,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS585
+	call v4__dscheck
+.LDS585:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS586
+	call v4__dscheck
+.LDS586:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS587
+	call v4__dscheck
+.LDS587:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,207,.LM3441-main
+.LM3441:
+	mov $1860,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS588
+	call v4__dscheck
+.LDS588:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS589
+	call v4__dscheck
+.LDS589:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS590
+	call v4__dscheck
+.LDS590:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,208,.LM3453-main
+.LM3453:
+	mov $1870,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS591
+	call v4__dscheck
+.LDS591:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS592
+	call v4__dscheck
+.LDS592:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS593
+	call v4__dscheck
+.LDS593:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,209,.LM3465-main
+.LM3465:
+	mov $1880,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS594
+	call v4__dscheck
+.LDS594:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS595
+	call v4__dscheck
+.LDS595:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS596
+	call v4__dscheck
+.LDS596:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,210,.LM3477-main
+.LM3477:
+	mov $1890,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS597
+	call v4__dscheck
+.LDS597:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS598
+	call v4__dscheck
+.LDS598:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS599
+	call v4__dscheck
+.LDS599:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,211,.LM3489-main
+.LM3489:
+	mov $1900,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS600
+	call v4__dscheck
+.LDS600:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS601
+	call v4__dscheck
+.LDS601:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS602
+	call v4__dscheck
+.LDS602:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,212,.LM3501-main
+.LM3501:
+	mov $1910,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS603
+	call v4__dscheck
+.LDS603:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS604
+	call v4__dscheck
+.LDS604:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS605
+	call v4__dscheck
+.LDS605:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,213,.LM3513-main
+.LM3513:
+	mov $1920,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS606
+	call v4__dscheck
+.LDS606:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS607
+	call v4__dscheck
+.LDS607:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS608
+	call v4__dscheck
+.LDS608:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,214,.LM3525-main
+.LM3525:
+	mov $1930,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS609
+	call v4__dscheck
+.LDS609:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS610
+	call v4__dscheck
+.LDS610:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS611
+	call v4__dscheck
+.LDS611:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,215,.LM3537-main
+.LM3537:
+	mov $1940,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS612
+	call v4__dscheck
+.LDS612:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS613
+	call v4__dscheck
+.LDS613:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS614
+	call v4__dscheck
+.LDS614:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,216,.LM3549-main
+.LM3549:
+	mov $1950,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS615
+	call v4__dscheck
+.LDS615:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS616
+	call v4__dscheck
+.LDS616:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS617
+	call v4__dscheck
+.LDS617:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,219,.LM3561-main
+.LM3561:
+	lea .LC4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $27,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS618
+	call v4__dscheck
+.LDS618:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,232,.LM3567-main
+.LM3567:
+	mov $1960,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS619
+	call v4__dscheck
+.LDS619:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS620
+	call v4__dscheck
+.LDS620:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS621
+	call v4__dscheck
+.LDS621:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,233,.LM3576-main
+.LM3576:
+	mov $1961,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS622
+	call v4__dscheck
+.LDS622:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS623
+	call v4__dscheck
+.LDS623:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS624
+	call v4__dscheck
+.LDS624:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,234,.LM3585-main
+.LM3585:
+	mov $1962,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS625
+	call v4__dscheck
+.LDS625:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS626
+	call v4__dscheck
+.LDS626:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS627
+	call v4__dscheck
+.LDS627:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,235,.LM3594-main
+.LM3594:
+	mov $1963,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS628
+	call v4__dscheck
+.LDS628:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS629
+	call v4__dscheck
+.LDS629:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS630
+	call v4__dscheck
+.LDS630:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,236,.LM3603-main
+.LM3603:
+	mov $1964,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS631
+	call v4__dscheck
+.LDS631:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS632
+	call v4__dscheck
+.LDS632:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS633
+	call v4__dscheck
+.LDS633:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,240,.LM3613-main
+.LM3613:
+	lea .LC5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $75,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS634
+	call v4__dscheck
+.LDS634:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,242,.LM3619-main
+.LM3619:
+	mov $2000,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS635
+	call v4__dscheck
+.LDS635:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS636
+	call v4__dscheck
+.LDS636:
+	mov %ecx,v4__dsindex
+	call v4_z2drop
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,243,.LM3629-main
+.LM3629:
+	mov $2010,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS637
+	call v4__dscheck
+.LDS637:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS638
+	call v4__dscheck
+.LDS638:
+	mov %ecx,v4__dsindex
+	call v4_z2dup
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS639
+	call v4__dscheck
+.LDS639:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,244,.LM3647-main
+.LM3647:
+	mov $2020,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS640
+	call v4__dscheck
+.LDS640:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS641
+	call v4__dscheck
+.LDS641:
+	mov %ecx,v4__dsindex
+	call v4_z2over
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS642
+	call v4__dscheck
+.LDS642:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,245,.LM3673-main
+.LM3673:
+	mov $2030,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS643
+	call v4__dscheck
+.LDS643:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS644
+	call v4__dscheck
+.LDS644:
+	mov %ecx,v4__dsindex
+	call v4_z2swap
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS645
+	call v4__dscheck
+.LDS645:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,246,.LM3695-main
+.LM3695:
+	mov $2040,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS646
+	call v4__dscheck
+.LDS646:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS647
+	call v4__dscheck
+.LDS647:
+	mov %ecx,v4__dsindex
+	call v4_Questiondup
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS648
+	call v4__dscheck
+.LDS648:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,247,.LM3705-main
+.LM3705:
+	mov $2050,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS649
+	call v4__dscheck
+.LDS649:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS650
+	call v4__dscheck
+.LDS650:
+	mov %ecx,v4__dsindex
+	call v4_Questiondup
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS651
+	call v4__dscheck
+.LDS651:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,248,.LM3717-main
+.LM3717:
+	mov $2060,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS652
+	call v4__dscheck
+.LDS652:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS653
+	call v4__dscheck
+.LDS653:
+	mov %ecx,v4__dsindex
+	call v4_Questiondup
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS654
+	call v4__dscheck
+.LDS654:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,249,.LM3729-main
+.LM3729:
+	mov $2070,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS655
+	call v4__dscheck
+.LDS655:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_depth
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS656
+	call v4__dscheck
+.LDS656:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,250,.LM3737-main
+.LM3737:
+	mov $2080,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS657
+	call v4__dscheck
+.LDS657:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS658
+	call v4__dscheck
+.LDS658:
+	mov %ecx,v4__dsindex
+	call v4_depth
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS659
+	call v4__dscheck
+.LDS659:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,251,.LM3749-main
+.LM3749:
+	mov $2090,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS660
+	call v4__dscheck
+.LDS660:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS661
+	call v4__dscheck
+.LDS661:
+	mov %ecx,v4__dsindex
+	call v4_depth
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS662
+	call v4__dscheck
+.LDS662:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,252,.LM3765-main
+.LM3765:
+	mov $2100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS663
+	call v4__dscheck
+.LDS663:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS664
+	call v4__dscheck
+.LDS664:
+	mov %ecx,v4__dsindex
+	call v4_drop
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,253,.LM3773-main
+.LM3773:
+	mov $2110,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS665
+	call v4__dscheck
+.LDS665:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS666
+	call v4__dscheck
+.LDS666:
+	mov %ecx,v4__dsindex
+	call v4_drop
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS667
+	call v4__dscheck
+.LDS667:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,254,.LM3785-main
+.LM3785:
+	mov $2120,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS668
+	call v4__dscheck
+.LDS668:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS669
+	call v4__dscheck
+.LDS669:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS670
+	call v4__dscheck
+.LDS670:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,255,.LM3797-main
+.LM3797:
+	mov $2130,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS671
+	call v4__dscheck
+.LDS671:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS672
+	call v4__dscheck
+.LDS672:
+	mov %ecx,v4__dsindex
+	call v4_over
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS673
+	call v4__dscheck
+.LDS673:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,256,.LM3813-main
+.LM3813:
+	mov $2140,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS674
+	call v4__dscheck
+.LDS674:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS675
+	call v4__dscheck
+.LDS675:
+	mov %ecx,v4__dsindex
+	call v4_rot
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS676
+	call v4__dscheck
+.LDS676:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,257,.LM3831-main
+.LM3831:
+	mov $2150,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS677
+	call v4__dscheck
+.LDS677:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS678
+	call v4__dscheck
+.LDS678:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS679
+	call v4__dscheck
+.LDS679:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,260,.LM3845-main
+.LM3845:
+	lea .LC6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $16,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS680
+	call v4__dscheck
+.LDS680:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,262,.LM3851-main
+.LM3851:
+	mov $2200,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS681
+	call v4__dscheck
+.LDS681:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,263,.LM3856-main
+.LM3856:
+	mov $2210,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS682
+	call v4__dscheck
+.LDS682:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,264,.LM3861-main
+.LM3861:
+	mov $2220,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS683
+	call v4__dscheck
+.LDS683:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,262,.LM3867-main
+.LM3867:
+	cmp $4080,%ecx
+	jbe .LDS684
+	call v4__dscheck
+.LDS684:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_r_Greater
+.stabn 68,0,264,.LM3869-main
+.LM3869:
+	call v4_Minus_Greater
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS685
+	call v4__dscheck
+.LDS685:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,265,.LM3873-main
+.LM3873:
+	mov $2230,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS686
+	call v4__dscheck
+.LDS686:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,263,.LM3879-main
+.LM3879:
+	cmp $4080,%ecx
+	jbe .LDS687
+	call v4__dscheck
+.LDS687:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_r_Fetch
+	call v4_r_Greater
+	call v4_drop
+.stabn 68,0,265,.LM3883-main
+.LM3883:
+	call v4_Minus_Greater
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS688
+	call v4__dscheck
+.LDS688:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,268,.LM3887-main
+.LM3887:
+	lea .LC7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $42,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS689
+	call v4__dscheck
+.LDS689:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,270,.LM3893-main
+.LM3893:
+	mov $2280,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS690
+	call v4__dscheck
+.LDS690:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS691
+	call v4__dscheck
+.LDS691:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS692
+	call v4__dscheck
+.LDS692:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,271,.LM3905-main
+.LM3905:
+	mov $2290,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS693
+	call v4__dscheck
+.LDS693:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS694
+	call v4__dscheck
+.LDS694:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS695
+	call v4__dscheck
+.LDS695:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,272,.LM3917-main
+.LM3917:
+	mov $2300,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS696
+	call v4__dscheck
+.LDS696:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS697
+	call v4__dscheck
+.LDS697:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS698
+	call v4__dscheck
+.LDS698:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,273,.LM3929-main
+.LM3929:
+	mov $2310,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS699
+	call v4__dscheck
+.LDS699:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS700
+	call v4__dscheck
+.LDS700:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS701
+	call v4__dscheck
+.LDS701:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,274,.LM3941-main
+.LM3941:
+	mov $2320,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS702
+	call v4__dscheck
+.LDS702:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS703
+	call v4__dscheck
+.LDS703:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS704
+	call v4__dscheck
+.LDS704:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,275,.LM3953-main
+.LM3953:
+	mov $2330,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS705
+	call v4__dscheck
+.LDS705:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS706
+	call v4__dscheck
+.LDS706:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS707
+	call v4__dscheck
+.LDS707:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,276,.LM3965-main
+.LM3965:
+	mov $2340,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS708
+	call v4__dscheck
+.LDS708:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS709
+	call v4__dscheck
+.LDS709:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS710
+	call v4__dscheck
+.LDS710:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,277,.LM3977-main
+.LM3977:
+	mov $2350,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS711
+	call v4__dscheck
+.LDS711:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS712
+	call v4__dscheck
+.LDS712:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS713
+	call v4__dscheck
+.LDS713:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,278,.LM3989-main
+.LM3989:
+	mov $2360,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS714
+	call v4__dscheck
+.LDS714:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS715
+	call v4__dscheck
+.LDS715:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS716
+	call v4__dscheck
+.LDS716:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,279,.LM4001-main
+.LM4001:
+	mov $2370,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS717
+	call v4__dscheck
+.LDS717:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS718
+	call v4__dscheck
+.LDS718:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS719
+	call v4__dscheck
+.LDS719:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,281,.LM4013-main
+.LM4013:
+	mov $2390,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS720
+	call v4__dscheck
+.LDS720:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS721
+	call v4__dscheck
+.LDS721:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS722
+	call v4__dscheck
+.LDS722:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,282,.LM4025-main
+.LM4025:
+	mov $2400,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS723
+	call v4__dscheck
+.LDS723:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS724
+	call v4__dscheck
+.LDS724:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS725
+	call v4__dscheck
+.LDS725:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,283,.LM4037-main
+.LM4037:
+	mov $2410,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS726
+	call v4__dscheck
+.LDS726:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS727
+	call v4__dscheck
+.LDS727:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS728
+	call v4__dscheck
+.LDS728:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,284,.LM4049-main
+.LM4049:
+	mov $2420,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS729
+	call v4__dscheck
+.LDS729:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS730
+	call v4__dscheck
+.LDS730:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS731
+	call v4__dscheck
+.LDS731:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,285,.LM4061-main
+.LM4061:
+	mov $2430,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS732
+	call v4__dscheck
+.LDS732:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS733
+	call v4__dscheck
+.LDS733:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS734
+	call v4__dscheck
+.LDS734:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,286,.LM4073-main
+.LM4073:
+	mov $2440,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS735
+	call v4__dscheck
+.LDS735:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS736
+	call v4__dscheck
+.LDS736:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS737
+	call v4__dscheck
+.LDS737:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,287,.LM4085-main
+.LM4085:
+	mov $2450,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS738
+	call v4__dscheck
+.LDS738:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS739
+	call v4__dscheck
+.LDS739:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS740
+	call v4__dscheck
+.LDS740:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,288,.LM4097-main
+.LM4097:
+	mov $2460,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS741
+	call v4__dscheck
+.LDS741:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS742
+	call v4__dscheck
+.LDS742:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS743
+	call v4__dscheck
+.LDS743:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,289,.LM4109-main
+.LM4109:
+	mov $2470,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS744
+	call v4__dscheck
+.LDS744:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS745
+	call v4__dscheck
+.LDS745:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS746
+	call v4__dscheck
+.LDS746:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,290,.LM4121-main
+.LM4121:
+	mov $2480,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS747
+	call v4__dscheck
+.LDS747:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS748
+	call v4__dscheck
+.LDS748:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS749
+	call v4__dscheck
+.LDS749:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,292,.LM4133-main
+.LM4133:
+	mov $2500,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS750
+	call v4__dscheck
+.LDS750:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS751
+	call v4__dscheck
+.LDS751:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS752
+	call v4__dscheck
+.LDS752:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,293,.LM4143-main
+.LM4143:
+	mov $2510,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS753
+	call v4__dscheck
+.LDS753:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS754
+	call v4__dscheck
+.LDS754:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS755
+	call v4__dscheck
+.LDS755:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,294,.LM4153-main
+.LM4153:
+	mov $2520,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS756
+	call v4__dscheck
+.LDS756:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS757
+	call v4__dscheck
+.LDS757:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS758
+	call v4__dscheck
+.LDS758:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,295,.LM4163-main
+.LM4163:
+	mov $2530,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS759
+	call v4__dscheck
+.LDS759:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS760
+	call v4__dscheck
+.LDS760:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS761
+	call v4__dscheck
+.LDS761:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,297,.LM4173-main
+.LM4173:
+	mov $2550,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS762
+	call v4__dscheck
+.LDS762:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS763
+	call v4__dscheck
+.LDS763:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS764
+	call v4__dscheck
+.LDS764:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,298,.LM4183-main
+.LM4183:
+	mov $2560,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS765
+	call v4__dscheck
+.LDS765:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS766
+	call v4__dscheck
+.LDS766:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS767
+	call v4__dscheck
+.LDS767:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,299,.LM4193-main
+.LM4193:
+	mov $2570,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS768
+	call v4__dscheck
+.LDS768:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS769
+	call v4__dscheck
+.LDS769:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS770
+	call v4__dscheck
+.LDS770:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,300,.LM4203-main
+.LM4203:
+	mov $2580,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS771
+	call v4__dscheck
+.LDS771:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS772
+	call v4__dscheck
+.LDS772:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS773
+	call v4__dscheck
+.LDS773:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,302,.LM4213-main
+.LM4213:
+	mov $2600,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS774
+	call v4__dscheck
+.LDS774:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS775
+	call v4__dscheck
+.LDS775:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS776
+	call v4__dscheck
+.LDS776:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,303,.LM4223-main
+.LM4223:
+	mov $2610,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS777
+	call v4__dscheck
+.LDS777:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS778
+	call v4__dscheck
+.LDS778:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS779
+	call v4__dscheck
+.LDS779:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,304,.LM4233-main
+.LM4233:
+	mov $2620,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS780
+	call v4__dscheck
+.LDS780:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS781
+	call v4__dscheck
+.LDS781:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS782
+	call v4__dscheck
+.LDS782:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,305,.LM4243-main
+.LM4243:
+	mov $2630,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS783
+	call v4__dscheck
+.LDS783:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS784
+	call v4__dscheck
+.LDS784:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS785
+	call v4__dscheck
+.LDS785:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,306,.LM4253-main
+.LM4253:
+	mov $2640,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS786
+	call v4__dscheck
+.LDS786:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS787
+	call v4__dscheck
+.LDS787:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS788
+	call v4__dscheck
+.LDS788:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,308,.LM4263-main
+.LM4263:
+	mov $2660,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS789
+	call v4__dscheck
+.LDS789:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS790
+	call v4__dscheck
+.LDS790:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS791
+	call v4__dscheck
+.LDS791:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,309,.LM4273-main
+.LM4273:
+	mov $2670,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS792
+	call v4__dscheck
+.LDS792:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS793
+	call v4__dscheck
+.LDS793:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS794
+	call v4__dscheck
+.LDS794:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,310,.LM4283-main
+.LM4283:
+	mov $2680,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS795
+	call v4__dscheck
+.LDS795:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS796
+	call v4__dscheck
+.LDS796:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS797
+	call v4__dscheck
+.LDS797:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,311,.LM4293-main
+.LM4293:
+	mov $2690,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS798
+	call v4__dscheck
+.LDS798:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS799
+	call v4__dscheck
+.LDS799:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS800
+	call v4__dscheck
+.LDS800:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,314,.LM4303-main
+.LM4303:
+	lea .LC8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $30,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS801
+	call v4__dscheck
+.LDS801:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,316,.LM4309-main
+.LM4309:
+	mov $2740,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS802
+	call v4__dscheck
+.LDS802:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS803
+	call v4__dscheck
+.LDS803:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS804
+	call v4__dscheck
+.LDS804:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,317,.LM4321-main
+.LM4321:
+	mov $2750,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS805
+	call v4__dscheck
+.LDS805:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS806
+	call v4__dscheck
+.LDS806:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS807
+	call v4__dscheck
+.LDS807:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,318,.LM4333-main
+.LM4333:
+	mov $2760,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS808
+	call v4__dscheck
+.LDS808:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS809
+	call v4__dscheck
+.LDS809:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS810
+	call v4__dscheck
+.LDS810:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,319,.LM4345-main
+.LM4345:
+	mov $2770,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS811
+	call v4__dscheck
+.LDS811:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS812
+	call v4__dscheck
+.LDS812:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS813
+	call v4__dscheck
+.LDS813:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,320,.LM4357-main
+.LM4357:
+	mov $2780,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS814
+	call v4__dscheck
+.LDS814:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS815
+	call v4__dscheck
+.LDS815:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS816
+	call v4__dscheck
+.LDS816:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,321,.LM4369-main
+.LM4369:
+	mov $2790,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS817
+	call v4__dscheck
+.LDS817:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS818
+	call v4__dscheck
+.LDS818:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS819
+	call v4__dscheck
+.LDS819:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,322,.LM4381-main
+.LM4381:
+	mov $2800,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS820
+	call v4__dscheck
+.LDS820:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS821
+	call v4__dscheck
+.LDS821:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS822
+	call v4__dscheck
+.LDS822:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,324,.LM4393-main
+.LM4393:
+	mov $2820,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS823
+	call v4__dscheck
+.LDS823:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS824
+	call v4__dscheck
+.LDS824:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS825
+	call v4__dscheck
+.LDS825:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,325,.LM4406-main
+.LM4406:
+	mov $2830,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS826
+	call v4__dscheck
+.LDS826:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS827
+	call v4__dscheck
+.LDS827:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS828
+	call v4__dscheck
+.LDS828:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,326,.LM4419-main
+.LM4419:
+	mov $2840,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS829
+	call v4__dscheck
+.LDS829:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS830
+	call v4__dscheck
+.LDS830:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS831
+	call v4__dscheck
+.LDS831:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,327,.LM4432-main
+.LM4432:
+	mov $2850,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS832
+	call v4__dscheck
+.LDS832:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS833
+	call v4__dscheck
+.LDS833:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS834
+	call v4__dscheck
+.LDS834:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,328,.LM4445-main
+.LM4445:
+	mov $2860,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS835
+	call v4__dscheck
+.LDS835:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS836
+	call v4__dscheck
+.LDS836:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS837
+	call v4__dscheck
+.LDS837:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,329,.LM4458-main
+.LM4458:
+	mov $2870,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS838
+	call v4__dscheck
+.LDS838:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS839
+	call v4__dscheck
+.LDS839:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS840
+	call v4__dscheck
+.LDS840:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,330,.LM4471-main
+.LM4471:
+	mov $2880,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS841
+	call v4__dscheck
+.LDS841:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS842
+	call v4__dscheck
+.LDS842:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS843
+	call v4__dscheck
+.LDS843:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,331,.LM4484-main
+.LM4484:
+	mov $2890,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS844
+	call v4__dscheck
+.LDS844:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS845
+	call v4__dscheck
+.LDS845:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS846
+	call v4__dscheck
+.LDS846:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,332,.LM4497-main
+.LM4497:
+	mov $2900,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS847
+	call v4__dscheck
+.LDS847:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS848
+	call v4__dscheck
+.LDS848:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS849
+	call v4__dscheck
+.LDS849:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,333,.LM4510-main
+.LM4510:
+	mov $2910,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS850
+	call v4__dscheck
+.LDS850:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS851
+	call v4__dscheck
+.LDS851:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS852
+	call v4__dscheck
+.LDS852:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,334,.LM4523-main
+.LM4523:
+	mov $2920,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS853
+	call v4__dscheck
+.LDS853:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS854
+	call v4__dscheck
+.LDS854:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS855
+	call v4__dscheck
+.LDS855:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,335,.LM4536-main
+.LM4536:
+	mov $2930,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS856
+	call v4__dscheck
+.LDS856:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS857
+	call v4__dscheck
+.LDS857:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS858
+	call v4__dscheck
+.LDS858:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,336,.LM4550-main
+.LM4550:
+	mov $2940,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS859
+	call v4__dscheck
+.LDS859:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS860
+	call v4__dscheck
+.LDS860:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS861
+	call v4__dscheck
+.LDS861:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,337,.LM4563-main
+.LM4563:
+	mov $2950,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS862
+	call v4__dscheck
+.LDS862:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS863
+	call v4__dscheck
+.LDS863:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS864
+	call v4__dscheck
+.LDS864:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,338,.LM4576-main
+.LM4576:
+	mov $2960,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS865
+	call v4__dscheck
+.LDS865:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS866
+	call v4__dscheck
+.LDS866:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS867
+	call v4__dscheck
+.LDS867:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,339,.LM4593-main
+.LM4593:
+	mov $2970,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS868
+	call v4__dscheck
+.LDS868:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS869
+	call v4__dscheck
+.LDS869:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov (v4_msb),%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	xchg %edx,%ecx
+	shr %cl,%eax
+	xchg %edx,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS870
+	call v4__dscheck
+.LDS870:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,340,.LM4614-main
+.LM4614:
+	mov $2980,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS871
+	call v4__dscheck
+.LDS871:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS872
+	call v4__dscheck
+.LDS872:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov (v4_msb),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS873
+	call v4__dscheck
+.LDS873:
+	mov %ecx,v4__dsindex
+	call v4_z2_Slash
+	call v4_Rightbrace
+.stabn 68,0,341,.LM4629-main
+.LM4629:
+	mov $2990,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS874
+	call v4__dscheck
+.LDS874:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS875
+	call v4__dscheck
+.LDS875:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov (v4_msb),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS876
+	call v4__dscheck
+.LDS876:
+	mov %ecx,v4__dsindex
+	call v4_z2_Slash
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	not %eax
+	cmp $4080,%ecx
+	jbe .LDS877
+	call v4__dscheck
+.LDS877:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS878
+	call v4__dscheck
+.LDS878:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,343,.LM4648-main
+.LM4648:
+	mov $3010,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS879
+	call v4__dscheck
+.LDS879:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS880
+	call v4__dscheck
+.LDS880:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS881
+	call v4__dscheck
+.LDS881:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,344,.LM4660-main
+.LM4660:
+	mov $3020,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS882
+	call v4__dscheck
+.LDS882:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS883
+	call v4__dscheck
+.LDS883:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS884
+	call v4__dscheck
+.LDS884:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,345,.LM4672-main
+.LM4672:
+	mov $3030,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS885
+	call v4__dscheck
+.LDS885:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS886
+	call v4__dscheck
+.LDS886:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS887
+	call v4__dscheck
+.LDS887:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,346,.LM4684-main
+.LM4684:
+	mov $3040,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS888
+	call v4__dscheck
+.LDS888:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS889
+	call v4__dscheck
+.LDS889:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS890
+	call v4__dscheck
+.LDS890:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,347,.LM4696-main
+.LM4696:
+	mov $3050,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS891
+	call v4__dscheck
+.LDS891:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS892
+	call v4__dscheck
+.LDS892:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS893
+	call v4__dscheck
+.LDS893:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,348,.LM4708-main
+.LM4708:
+	mov $3060,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS894
+	call v4__dscheck
+.LDS894:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS895
+	call v4__dscheck
+.LDS895:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS896
+	call v4__dscheck
+.LDS896:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,349,.LM4720-main
+.LM4720:
+	mov $3070,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS897
+	call v4__dscheck
+.LDS897:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS898
+	call v4__dscheck
+.LDS898:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS899
+	call v4__dscheck
+.LDS899:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,350,.LM4732-main
+.LM4732:
+	mov $3080,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS900
+	call v4__dscheck
+.LDS900:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS901
+	call v4__dscheck
+.LDS901:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS902
+	call v4__dscheck
+.LDS902:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,351,.LM4744-main
+.LM4744:
+	mov $3090,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS903
+	call v4__dscheck
+.LDS903:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS904
+	call v4__dscheck
+.LDS904:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS905
+	call v4__dscheck
+.LDS905:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,353,.LM4756-main
+.LM4756:
+	mov $3110,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS906
+	call v4__dscheck
+.LDS906:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS907
+	call v4__dscheck
+.LDS907:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS908
+	call v4__dscheck
+.LDS908:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,354,.LM4771-main
+.LM4771:
+	mov $3120,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS909
+	call v4__dscheck
+.LDS909:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS910
+	call v4__dscheck
+.LDS910:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS911
+	call v4__dscheck
+.LDS911:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,355,.LM4786-main
+.LM4786:
+	mov $3130,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS912
+	call v4__dscheck
+.LDS912:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS913
+	call v4__dscheck
+.LDS913:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS914
+	call v4__dscheck
+.LDS914:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,357,.LM4804-main
+.LM4804:
+	mov $3150,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS915
+	call v4__dscheck
+.LDS915:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS916
+	call v4__dscheck
+.LDS916:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS917
+	call v4__dscheck
+.LDS917:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,358,.LM4818-main
+.LM4818:
+	mov $3160,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS918
+	call v4__dscheck
+.LDS918:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS919
+	call v4__dscheck
+.LDS919:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS920
+	call v4__dscheck
+.LDS920:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,359,.LM4832-main
+.LM4832:
+	mov $3170,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS921
+	call v4__dscheck
+.LDS921:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS922
+	call v4__dscheck
+.LDS922:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS923
+	call v4__dscheck
+.LDS923:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,360,.LM4846-main
+.LM4846:
+	mov $3180,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS924
+	call v4__dscheck
+.LDS924:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS925
+	call v4__dscheck
+.LDS925:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS926
+	call v4__dscheck
+.LDS926:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,361,.LM4860-main
+.LM4860:
+	mov $3190,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS927
+	call v4__dscheck
+.LDS927:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS928
+	call v4__dscheck
+.LDS928:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS929
+	call v4__dscheck
+.LDS929:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,362,.LM4874-main
+.LM4874:
+	mov $3200,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS930
+	call v4__dscheck
+.LDS930:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS931
+	call v4__dscheck
+.LDS931:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS932
+	call v4__dscheck
+.LDS932:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,364,.LM4888-main
+.LM4888:
+	mov $3220,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS933
+	call v4__dscheck
+.LDS933:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $1073741824,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS934
+	call v4__dscheck
+.LDS934:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS935
+	call v4__dscheck
+.LDS935:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,365,.LM4905-main
+.LM4905:
+	mov $3230,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS936
+	call v4__dscheck
+.LDS936:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS937
+	call v4__dscheck
+.LDS937:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS938
+	call v4__dscheck
+.LDS938:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,366,.LM4919-main
+.LM4919:
+	mov $3240,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS939
+	call v4__dscheck
+.LDS939:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS940
+	call v4__dscheck
+.LDS940:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS941
+	call v4__dscheck
+.LDS941:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,367,.LM4933-main
+.LM4933:
+	mov $3250,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS942
+	call v4__dscheck
+.LDS942:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS943
+	call v4__dscheck
+.LDS943:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS944
+	call v4__dscheck
+.LDS944:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,368,.LM4950-main
+.LM4950:
+	mov $3260,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS945
+	call v4__dscheck
+.LDS945:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS946
+	call v4__dscheck
+.LDS946:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS947
+	call v4__dscheck
+.LDS947:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,371,.LM4965-main
+.LM4965:
+	lea .LC9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $56,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS948
+	call v4__dscheck
+.LDS948:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,373,.LM4971-main
+.LM4971:
+	mov $3310,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS949
+	call v4__dscheck
+.LDS949:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS950
+	call v4__dscheck
+.LDS950:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS951
+	call v4__dscheck
+.LDS951:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS952
+	call v4__dscheck
+.LDS952:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,374,.LM4986-main
+.LM4986:
+	mov $3320,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS953
+	call v4__dscheck
+.LDS953:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS954
+	call v4__dscheck
+.LDS954:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS955
+	call v4__dscheck
+.LDS955:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS956
+	call v4__dscheck
+.LDS956:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,375,.LM5001-main
+.LM5001:
+	mov $3330,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS957
+	call v4__dscheck
+.LDS957:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS958
+	call v4__dscheck
+.LDS958:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS959
+	call v4__dscheck
+.LDS959:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS960
+	call v4__dscheck
+.LDS960:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,376,.LM5016-main
+.LM5016:
+	mov $3340,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS961
+	call v4__dscheck
+.LDS961:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS962
+	call v4__dscheck
+.LDS962:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS963
+	call v4__dscheck
+.LDS963:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS964
+	call v4__dscheck
+.LDS964:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,377,.LM5031-main
+.LM5031:
+	mov $3350,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS965
+	call v4__dscheck
+.LDS965:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS966
+	call v4__dscheck
+.LDS966:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS967
+	call v4__dscheck
+.LDS967:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS968
+	call v4__dscheck
+.LDS968:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,378,.LM5046-main
+.LM5046:
+	mov $3360,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS969
+	call v4__dscheck
+.LDS969:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS970
+	call v4__dscheck
+.LDS970:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS971
+	call v4__dscheck
+.LDS971:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS972
+	call v4__dscheck
+.LDS972:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,379,.LM5061-main
+.LM5061:
+	mov $3370,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS973
+	call v4__dscheck
+.LDS973:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS974
+	call v4__dscheck
+.LDS974:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS975
+	call v4__dscheck
+.LDS975:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS976
+	call v4__dscheck
+.LDS976:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,380,.LM5076-main
+.LM5076:
+	mov $3380,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS977
+	call v4__dscheck
+.LDS977:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS978
+	call v4__dscheck
+.LDS978:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS979
+	call v4__dscheck
+.LDS979:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS980
+	call v4__dscheck
+.LDS980:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,381,.LM5091-main
+.LM5091:
+	mov $3390,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS981
+	call v4__dscheck
+.LDS981:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS982
+	call v4__dscheck
+.LDS982:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS983
+	call v4__dscheck
+.LDS983:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS984
+	call v4__dscheck
+.LDS984:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,382,.LM5106-main
+.LM5106:
+	mov $3400,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS985
+	call v4__dscheck
+.LDS985:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS986
+	call v4__dscheck
+.LDS986:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS987
+	call v4__dscheck
+.LDS987:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS988
+	call v4__dscheck
+.LDS988:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,383,.LM5121-main
+.LM5121:
+	mov $3410,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS989
+	call v4__dscheck
+.LDS989:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS990
+	call v4__dscheck
+.LDS990:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS991
+	call v4__dscheck
+.LDS991:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS992
+	call v4__dscheck
+.LDS992:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,384,.LM5136-main
+.LM5136:
+	mov $3420,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS993
+	call v4__dscheck
+.LDS993:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS994
+	call v4__dscheck
+.LDS994:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS995
+	call v4__dscheck
+.LDS995:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS996
+	call v4__dscheck
+.LDS996:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,385,.LM5151-main
+.LM5151:
+	mov $3430,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS997
+	call v4__dscheck
+.LDS997:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS998
+	call v4__dscheck
+.LDS998:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS999
+	call v4__dscheck
+.LDS999:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1000
+	call v4__dscheck
+.LDS1000:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,386,.LM5166-main
+.LM5166:
+	mov $3440,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1001
+	call v4__dscheck
+.LDS1001:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1002
+	call v4__dscheck
+.LDS1002:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1003
+	call v4__dscheck
+.LDS1003:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1004
+	call v4__dscheck
+.LDS1004:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,387,.LM5181-main
+.LM5181:
+	mov $3450,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1005
+	call v4__dscheck
+.LDS1005:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1006
+	call v4__dscheck
+.LDS1006:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1007
+	call v4__dscheck
+.LDS1007:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1008
+	call v4__dscheck
+.LDS1008:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,388,.LM5196-main
+.LM5196:
+	mov $3460,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1009
+	call v4__dscheck
+.LDS1009:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1010
+	call v4__dscheck
+.LDS1010:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1011
+	call v4__dscheck
+.LDS1011:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1012
+	call v4__dscheck
+.LDS1012:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,389,.LM5211-main
+.LM5211:
+	mov $3470,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1013
+	call v4__dscheck
+.LDS1013:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1014
+	call v4__dscheck
+.LDS1014:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1015
+	call v4__dscheck
+.LDS1015:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1016
+	call v4__dscheck
+.LDS1016:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,390,.LM5226-main
+.LM5226:
+	mov $3480,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1017
+	call v4__dscheck
+.LDS1017:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1018
+	call v4__dscheck
+.LDS1018:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1019
+	call v4__dscheck
+.LDS1019:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1020
+	call v4__dscheck
+.LDS1020:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,391,.LM5241-main
+.LM5241:
+	mov $3490,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1021
+	call v4__dscheck
+.LDS1021:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1022
+	call v4__dscheck
+.LDS1022:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1023
+	call v4__dscheck
+.LDS1023:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1024
+	call v4__dscheck
+.LDS1024:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,392,.LM5256-main
+.LM5256:
+	mov $3500,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1025
+	call v4__dscheck
+.LDS1025:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1026
+	call v4__dscheck
+.LDS1026:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1027
+	call v4__dscheck
+.LDS1027:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1028
+	call v4__dscheck
+.LDS1028:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,393,.LM5271-main
+.LM5271:
+	mov $3510,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1029
+	call v4__dscheck
+.LDS1029:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1030
+	call v4__dscheck
+.LDS1030:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1031
+	call v4__dscheck
+.LDS1031:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1032
+	call v4__dscheck
+.LDS1032:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,394,.LM5286-main
+.LM5286:
+	mov $3520,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1033
+	call v4__dscheck
+.LDS1033:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1034
+	call v4__dscheck
+.LDS1034:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1035
+	call v4__dscheck
+.LDS1035:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,395,.LM5302-main
+.LM5302:
+	mov $3530,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1036
+	call v4__dscheck
+.LDS1036:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1037
+	call v4__dscheck
+.LDS1037:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1038
+	call v4__dscheck
+.LDS1038:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1039
+	call v4__dscheck
+.LDS1039:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,396,.LM5319-main
+.LM5319:
+	mov $3540,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1040
+	call v4__dscheck
+.LDS1040:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1041
+	call v4__dscheck
+.LDS1041:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1042
+	call v4__dscheck
+.LDS1042:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1043
+	call v4__dscheck
+.LDS1043:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,397,.LM5336-main
+.LM5336:
+	mov $3550,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1044
+	call v4__dscheck
+.LDS1044:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1045
+	call v4__dscheck
+.LDS1045:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1046
+	call v4__dscheck
+.LDS1046:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1047
+	call v4__dscheck
+.LDS1047:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,398,.LM5353-main
+.LM5353:
+	mov $3560,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1048
+	call v4__dscheck
+.LDS1048:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1049
+	call v4__dscheck
+.LDS1049:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1050
+	call v4__dscheck
+.LDS1050:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1051
+	call v4__dscheck
+.LDS1051:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,399,.LM5370-main
+.LM5370:
+	mov $3570,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1052
+	call v4__dscheck
+.LDS1052:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1053
+	call v4__dscheck
+.LDS1053:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1054
+	call v4__dscheck
+.LDS1054:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1055
+	call v4__dscheck
+.LDS1055:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,400,.LM5387-main
+.LM5387:
+	mov $3580,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1056
+	call v4__dscheck
+.LDS1056:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1057
+	call v4__dscheck
+.LDS1057:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1058
+	call v4__dscheck
+.LDS1058:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1059
+	call v4__dscheck
+.LDS1059:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,401,.LM5404-main
+.LM5404:
+	mov $3590,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1060
+	call v4__dscheck
+.LDS1060:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1061
+	call v4__dscheck
+.LDS1061:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1062
+	call v4__dscheck
+.LDS1062:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1063
+	call v4__dscheck
+.LDS1063:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,402,.LM5421-main
+.LM5421:
+	mov $3600,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1064
+	call v4__dscheck
+.LDS1064:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1065
+	call v4__dscheck
+.LDS1065:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1066
+	call v4__dscheck
+.LDS1066:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1067
+	call v4__dscheck
+.LDS1067:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,403,.LM5438-main
+.LM5438:
+	mov $3610,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1068
+	call v4__dscheck
+.LDS1068:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1069
+	call v4__dscheck
+.LDS1069:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1070
+	call v4__dscheck
+.LDS1070:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1071
+	call v4__dscheck
+.LDS1071:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,404,.LM5455-main
+.LM5455:
+	mov $3620,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1072
+	call v4__dscheck
+.LDS1072:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1073
+	call v4__dscheck
+.LDS1073:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1074
+	call v4__dscheck
+.LDS1074:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1075
+	call v4__dscheck
+.LDS1075:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,405,.LM5472-main
+.LM5472:
+	mov $3630,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1076
+	call v4__dscheck
+.LDS1076:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1077
+	call v4__dscheck
+.LDS1077:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1078
+	call v4__dscheck
+.LDS1078:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1079
+	call v4__dscheck
+.LDS1079:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,406,.LM5489-main
+.LM5489:
+	mov $3640,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1080
+	call v4__dscheck
+.LDS1080:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1081
+	call v4__dscheck
+.LDS1081:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1082
+	call v4__dscheck
+.LDS1082:
+	mov %ecx,v4__dsindex
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1083
+	call v4__dscheck
+.LDS1083:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,408,.LM5506-main
+.LM5506:
+	mov $3660,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1084
+	call v4__dscheck
+.LDS1084:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1085
+	call v4__dscheck
+.LDS1085:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1086
+	call v4__dscheck
+.LDS1086:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1087
+	call v4__dscheck
+.LDS1087:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,409,.LM5521-main
+.LM5521:
+	mov $3670,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1088
+	call v4__dscheck
+.LDS1088:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1089
+	call v4__dscheck
+.LDS1089:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1090
+	call v4__dscheck
+.LDS1090:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1091
+	call v4__dscheck
+.LDS1091:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,410,.LM5536-main
+.LM5536:
+	mov $3680,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1092
+	call v4__dscheck
+.LDS1092:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1093
+	call v4__dscheck
+.LDS1093:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1094
+	call v4__dscheck
+.LDS1094:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1095
+	call v4__dscheck
+.LDS1095:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,411,.LM5551-main
+.LM5551:
+	mov $3690,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1096
+	call v4__dscheck
+.LDS1096:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1097
+	call v4__dscheck
+.LDS1097:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1098
+	call v4__dscheck
+.LDS1098:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1099
+	call v4__dscheck
+.LDS1099:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,412,.LM5566-main
+.LM5566:
+	mov $3700,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1100
+	call v4__dscheck
+.LDS1100:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1101
+	call v4__dscheck
+.LDS1101:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1102
+	call v4__dscheck
+.LDS1102:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1103
+	call v4__dscheck
+.LDS1103:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,413,.LM5581-main
+.LM5581:
+	mov $3710,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1104
+	call v4__dscheck
+.LDS1104:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1105
+	call v4__dscheck
+.LDS1105:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1106
+	call v4__dscheck
+.LDS1106:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1107
+	call v4__dscheck
+.LDS1107:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,414,.LM5596-main
+.LM5596:
+	mov $3720,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1108
+	call v4__dscheck
+.LDS1108:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1109
+	call v4__dscheck
+.LDS1109:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1110
+	call v4__dscheck
+.LDS1110:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1111
+	call v4__dscheck
+.LDS1111:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,415,.LM5611-main
+.LM5611:
+	mov $3730,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1112
+	call v4__dscheck
+.LDS1112:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1113
+	call v4__dscheck
+.LDS1113:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1114
+	call v4__dscheck
+.LDS1114:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1115
+	call v4__dscheck
+.LDS1115:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,416,.LM5626-main
+.LM5626:
+	mov $3740,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1116
+	call v4__dscheck
+.LDS1116:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1117
+	call v4__dscheck
+.LDS1117:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1118
+	call v4__dscheck
+.LDS1118:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1119
+	call v4__dscheck
+.LDS1119:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,417,.LM5641-main
+.LM5641:
+	mov $3750,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1120
+	call v4__dscheck
+.LDS1120:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1121
+	call v4__dscheck
+.LDS1121:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1122
+	call v4__dscheck
+.LDS1122:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1123
+	call v4__dscheck
+.LDS1123:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,418,.LM5656-main
+.LM5656:
+	mov $3760,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1124
+	call v4__dscheck
+.LDS1124:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1125
+	call v4__dscheck
+.LDS1125:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1126
+	call v4__dscheck
+.LDS1126:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1127
+	call v4__dscheck
+.LDS1127:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,419,.LM5671-main
+.LM5671:
+	mov $3770,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1128
+	call v4__dscheck
+.LDS1128:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1129
+	call v4__dscheck
+.LDS1129:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1130
+	call v4__dscheck
+.LDS1130:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1131
+	call v4__dscheck
+.LDS1131:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,420,.LM5686-main
+.LM5686:
+	mov $3780,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1132
+	call v4__dscheck
+.LDS1132:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1133
+	call v4__dscheck
+.LDS1133:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1134
+	call v4__dscheck
+.LDS1134:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1135
+	call v4__dscheck
+.LDS1135:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,421,.LM5701-main
+.LM5701:
+	mov $3790,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1136
+	call v4__dscheck
+.LDS1136:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1137
+	call v4__dscheck
+.LDS1137:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1138
+	call v4__dscheck
+.LDS1138:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1139
+	call v4__dscheck
+.LDS1139:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,422,.LM5716-main
+.LM5716:
+	mov $3800,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1140
+	call v4__dscheck
+.LDS1140:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1141
+	call v4__dscheck
+.LDS1141:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1142
+	call v4__dscheck
+.LDS1142:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1143
+	call v4__dscheck
+.LDS1143:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,423,.LM5731-main
+.LM5731:
+	mov $3810,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1144
+	call v4__dscheck
+.LDS1144:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1145
+	call v4__dscheck
+.LDS1145:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1146
+	call v4__dscheck
+.LDS1146:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1147
+	call v4__dscheck
+.LDS1147:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,424,.LM5746-main
+.LM5746:
+	mov $3820,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1148
+	call v4__dscheck
+.LDS1148:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1149
+	call v4__dscheck
+.LDS1149:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1150
+	call v4__dscheck
+.LDS1150:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1151
+	call v4__dscheck
+.LDS1151:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,425,.LM5761-main
+.LM5761:
+	mov $3830,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1152
+	call v4__dscheck
+.LDS1152:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1153
+	call v4__dscheck
+.LDS1153:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1154
+	call v4__dscheck
+.LDS1154:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1155
+	call v4__dscheck
+.LDS1155:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,426,.LM5776-main
+.LM5776:
+	mov $3840,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1156
+	call v4__dscheck
+.LDS1156:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1157
+	call v4__dscheck
+.LDS1157:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1158
+	call v4__dscheck
+.LDS1158:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1159
+	call v4__dscheck
+.LDS1159:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,427,.LM5791-main
+.LM5791:
+	mov $3850,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1160
+	call v4__dscheck
+.LDS1160:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1161
+	call v4__dscheck
+.LDS1161:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1162
+	call v4__dscheck
+.LDS1162:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1163
+	call v4__dscheck
+.LDS1163:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,428,.LM5806-main
+.LM5806:
+	mov $3860,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1164
+	call v4__dscheck
+.LDS1164:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1165
+	call v4__dscheck
+.LDS1165:
+	mov %ecx,v4__dsindex
+	call v4_s_Greaterd
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1166
+	call v4__dscheck
+.LDS1166:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1167
+	call v4__dscheck
+.LDS1167:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,429,.LM5821-main
+.LM5821:
+	mov $3870,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1168
+	call v4__dscheck
+.LDS1168:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1169
+	call v4__dscheck
+.LDS1169:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1170
+	call v4__dscheck
+.LDS1170:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,430,.LM5837-main
+.LM5837:
+	mov $3880,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1171
+	call v4__dscheck
+.LDS1171:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1172
+	call v4__dscheck
+.LDS1172:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1173
+	call v4__dscheck
+.LDS1173:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1174
+	call v4__dscheck
+.LDS1174:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,431,.LM5854-main
+.LM5854:
+	mov $3890,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1175
+	call v4__dscheck
+.LDS1175:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1176
+	call v4__dscheck
+.LDS1176:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1177
+	call v4__dscheck
+.LDS1177:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1178
+	call v4__dscheck
+.LDS1178:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,432,.LM5871-main
+.LM5871:
+	mov $3900,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1179
+	call v4__dscheck
+.LDS1179:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1180
+	call v4__dscheck
+.LDS1180:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1181
+	call v4__dscheck
+.LDS1181:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1182
+	call v4__dscheck
+.LDS1182:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,433,.LM5888-main
+.LM5888:
+	mov $3910,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1183
+	call v4__dscheck
+.LDS1183:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1184
+	call v4__dscheck
+.LDS1184:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1185
+	call v4__dscheck
+.LDS1185:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1186
+	call v4__dscheck
+.LDS1186:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,434,.LM5905-main
+.LM5905:
+	mov $3920,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1187
+	call v4__dscheck
+.LDS1187:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1188
+	call v4__dscheck
+.LDS1188:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1189
+	call v4__dscheck
+.LDS1189:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1190
+	call v4__dscheck
+.LDS1190:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,435,.LM5922-main
+.LM5922:
+	mov $3930,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1191
+	call v4__dscheck
+.LDS1191:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1192
+	call v4__dscheck
+.LDS1192:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1193
+	call v4__dscheck
+.LDS1193:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1194
+	call v4__dscheck
+.LDS1194:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,436,.LM5939-main
+.LM5939:
+	mov $3940,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1195
+	call v4__dscheck
+.LDS1195:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1196
+	call v4__dscheck
+.LDS1196:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1197
+	call v4__dscheck
+.LDS1197:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1198
+	call v4__dscheck
+.LDS1198:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,437,.LM5956-main
+.LM5956:
+	mov $3950,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1199
+	call v4__dscheck
+.LDS1199:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1200
+	call v4__dscheck
+.LDS1200:
+	mov %ecx,v4__dsindex
+	call v4_m_Star
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1201
+	call v4__dscheck
+.LDS1201:
+	mov %ecx,v4__dsindex
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1202
+	call v4__dscheck
+.LDS1202:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,439,.LM5973-main
+.LM5973:
+	mov $3970,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1203
+	call v4__dscheck
+.LDS1203:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1204
+	call v4__dscheck
+.LDS1204:
+	mov %ecx,v4__dsindex
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1205
+	call v4__dscheck
+.LDS1205:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,440,.LM5989-main
+.LM5989:
+	mov $3980,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1206
+	call v4__dscheck
+.LDS1206:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1207
+	call v4__dscheck
+.LDS1207:
+	mov %ecx,v4__dsindex
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1208
+	call v4__dscheck
+.LDS1208:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,441,.LM6005-main
+.LM6005:
+	mov $3990,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1209
+	call v4__dscheck
+.LDS1209:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1210
+	call v4__dscheck
+.LDS1210:
+	mov %ecx,v4__dsindex
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1211
+	call v4__dscheck
+.LDS1211:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,442,.LM6021-main
+.LM6021:
+	mov $4000,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1212
+	call v4__dscheck
+.LDS1212:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1213
+	call v4__dscheck
+.LDS1213:
+	mov %ecx,v4__dsindex
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1214
+	call v4__dscheck
+.LDS1214:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,443,.LM6037-main
+.LM6037:
+	mov $4010,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1215
+	call v4__dscheck
+.LDS1215:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1216
+	call v4__dscheck
+.LDS1216:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1217
+	call v4__dscheck
+.LDS1217:
+	mov %ecx,v4__dsindex
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1218
+	call v4__dscheck
+.LDS1218:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,444,.LM6054-main
+.LM6054:
+	mov $4020,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1219
+	call v4__dscheck
+.LDS1219:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1220
+	call v4__dscheck
+.LDS1220:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1221
+	call v4__dscheck
+.LDS1221:
+	mov %ecx,v4__dsindex
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1222
+	call v4__dscheck
+.LDS1222:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,445,.LM6071-main
+.LM6071:
+	mov $4030,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1223
+	call v4__dscheck
+.LDS1223:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1224
+	call v4__dscheck
+.LDS1224:
+	mov %ecx,v4__dsindex
+	call v4_um_Star
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1225
+	call v4__dscheck
+.LDS1225:
+	mov %ecx,v4__dsindex
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1226
+	call v4__dscheck
+.LDS1226:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,465,.LM6088-main
+.LM6088:
+	mov $4280,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1227
+	call v4__dscheck
+.LDS1227:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1228
+	call v4__dscheck
+.LDS1228:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6102-main
+.LM6102:
+	cmp $4080,%ecx
+	jbe .LDS1229
+	call v4__dscheck
+.LDS1229:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,465,.LM6106-main
+.LM6106:
+	call v4_Rightbrace
+.stabn 68,0,466,.LM6107-main
+.LM6107:
+	mov $4290,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1230
+	call v4__dscheck
+.LDS1230:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1231
+	call v4__dscheck
+.LDS1231:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6121-main
+.LM6121:
+	cmp $4080,%ecx
+	jbe .LDS1232
+	call v4__dscheck
+.LDS1232:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,466,.LM6125-main
+.LM6125:
+	call v4_Rightbrace
+.stabn 68,0,467,.LM6126-main
+.LM6126:
+	mov $4300,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1233
+	call v4__dscheck
+.LDS1233:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1234
+	call v4__dscheck
+.LDS1234:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6140-main
+.LM6140:
+	cmp $4080,%ecx
+	jbe .LDS1235
+	call v4__dscheck
+.LDS1235:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,467,.LM6144-main
+.LM6144:
+	call v4_Rightbrace
+.stabn 68,0,468,.LM6145-main
+.LM6145:
+	mov $4310,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1236
+	call v4__dscheck
+.LDS1236:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1237
+	call v4__dscheck
+.LDS1237:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6159-main
+.LM6159:
+	cmp $4080,%ecx
+	jbe .LDS1238
+	call v4__dscheck
+.LDS1238:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,468,.LM6163-main
+.LM6163:
+	call v4_Rightbrace
+.stabn 68,0,469,.LM6164-main
+.LM6164:
+	mov $4320,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1239
+	call v4__dscheck
+.LDS1239:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1240
+	call v4__dscheck
+.LDS1240:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6178-main
+.LM6178:
+	cmp $4080,%ecx
+	jbe .LDS1241
+	call v4__dscheck
+.LDS1241:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,469,.LM6182-main
+.LM6182:
+	call v4_Rightbrace
+.stabn 68,0,470,.LM6183-main
+.LM6183:
+	mov $4330,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1242
+	call v4__dscheck
+.LDS1242:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1243
+	call v4__dscheck
+.LDS1243:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6197-main
+.LM6197:
+	cmp $4080,%ecx
+	jbe .LDS1244
+	call v4__dscheck
+.LDS1244:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,470,.LM6201-main
+.LM6201:
+	call v4_Rightbrace
+.stabn 68,0,471,.LM6202-main
+.LM6202:
+	mov $4340,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1245
+	call v4__dscheck
+.LDS1245:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1246
+	call v4__dscheck
+.LDS1246:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6216-main
+.LM6216:
+	cmp $4080,%ecx
+	jbe .LDS1247
+	call v4__dscheck
+.LDS1247:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,471,.LM6220-main
+.LM6220:
+	call v4_Rightbrace
+.stabn 68,0,472,.LM6221-main
+.LM6221:
+	mov $4350,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1248
+	call v4__dscheck
+.LDS1248:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1249
+	call v4__dscheck
+.LDS1249:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6235-main
+.LM6235:
+	cmp $4080,%ecx
+	jbe .LDS1250
+	call v4__dscheck
+.LDS1250:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,472,.LM6239-main
+.LM6239:
+	call v4_Rightbrace
+.stabn 68,0,473,.LM6240-main
+.LM6240:
+	mov $4360,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1251
+	call v4__dscheck
+.LDS1251:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1252
+	call v4__dscheck
+.LDS1252:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6254-main
+.LM6254:
+	cmp $4080,%ecx
+	jbe .LDS1253
+	call v4__dscheck
+.LDS1253:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,473,.LM6258-main
+.LM6258:
+	call v4_Rightbrace
+.stabn 68,0,474,.LM6259-main
+.LM6259:
+	mov $4370,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1254
+	call v4__dscheck
+.LDS1254:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1255
+	call v4__dscheck
+.LDS1255:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6273-main
+.LM6273:
+	cmp $4080,%ecx
+	jbe .LDS1256
+	call v4__dscheck
+.LDS1256:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,474,.LM6277-main
+.LM6277:
+	call v4_Rightbrace
+.stabn 68,0,475,.LM6278-main
+.LM6278:
+	mov $4380,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1257
+	call v4__dscheck
+.LDS1257:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1258
+	call v4__dscheck
+.LDS1258:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6292-main
+.LM6292:
+	cmp $4080,%ecx
+	jbe .LDS1259
+	call v4__dscheck
+.LDS1259:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,475,.LM6296-main
+.LM6296:
+	call v4_Rightbrace
+.stabn 68,0,476,.LM6297-main
+.LM6297:
+	mov $4390,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1260
+	call v4__dscheck
+.LDS1260:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1261
+	call v4__dscheck
+.LDS1261:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6311-main
+.LM6311:
+	cmp $4080,%ecx
+	jbe .LDS1262
+	call v4__dscheck
+.LDS1262:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,476,.LM6315-main
+.LM6315:
+	call v4_Rightbrace
+.stabn 68,0,477,.LM6316-main
+.LM6316:
+	mov $4400,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1263
+	call v4__dscheck
+.LDS1263:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1264
+	call v4__dscheck
+.LDS1264:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6330-main
+.LM6330:
+	cmp $4080,%ecx
+	jbe .LDS1265
+	call v4__dscheck
+.LDS1265:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,477,.LM6334-main
+.LM6334:
+	call v4_Rightbrace
+.stabn 68,0,478,.LM6335-main
+.LM6335:
+	mov $4410,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1266
+	call v4__dscheck
+.LDS1266:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1267
+	call v4__dscheck
+.LDS1267:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6349-main
+.LM6349:
+	cmp $4080,%ecx
+	jbe .LDS1268
+	call v4__dscheck
+.LDS1268:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,478,.LM6353-main
+.LM6353:
+	call v4_Rightbrace
+.stabn 68,0,479,.LM6354-main
+.LM6354:
+	mov $4420,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1269
+	call v4__dscheck
+.LDS1269:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1270
+	call v4__dscheck
+.LDS1270:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6368-main
+.LM6368:
+	cmp $4080,%ecx
+	jbe .LDS1271
+	call v4__dscheck
+.LDS1271:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,479,.LM6372-main
+.LM6372:
+	call v4_Rightbrace
+.stabn 68,0,480,.LM6373-main
+.LM6373:
+	mov $4430,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1272
+	call v4__dscheck
+.LDS1272:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1273
+	call v4__dscheck
+.LDS1273:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6387-main
+.LM6387:
+	cmp $4080,%ecx
+	jbe .LDS1274
+	call v4__dscheck
+.LDS1274:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,480,.LM6391-main
+.LM6391:
+	call v4_Rightbrace
+.stabn 68,0,481,.LM6392-main
+.LM6392:
+	mov $4440,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1275
+	call v4__dscheck
+.LDS1275:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1276
+	call v4__dscheck
+.LDS1276:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6406-main
+.LM6406:
+	cmp $4080,%ecx
+	jbe .LDS1277
+	call v4__dscheck
+.LDS1277:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,481,.LM6410-main
+.LM6410:
+	call v4_Rightbrace
+.stabn 68,0,482,.LM6411-main
+.LM6411:
+	mov $4450,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1278
+	call v4__dscheck
+.LDS1278:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1279
+	call v4__dscheck
+.LDS1279:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6425-main
+.LM6425:
+	cmp $4080,%ecx
+	jbe .LDS1280
+	call v4__dscheck
+.LDS1280:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,482,.LM6429-main
+.LM6429:
+	call v4_Rightbrace
+.stabn 68,0,483,.LM6430-main
+.LM6430:
+	mov $4460,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1281
+	call v4__dscheck
+.LDS1281:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1282
+	call v4__dscheck
+.LDS1282:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6444-main
+.LM6444:
+	cmp $4080,%ecx
+	jbe .LDS1283
+	call v4__dscheck
+.LDS1283:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,483,.LM6448-main
+.LM6448:
+	call v4_Rightbrace
+.stabn 68,0,484,.LM6449-main
+.LM6449:
+	mov $4470,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1284
+	call v4__dscheck
+.LDS1284:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1285
+	call v4__dscheck
+.LDS1285:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6463-main
+.LM6463:
+	cmp $4080,%ecx
+	jbe .LDS1286
+	call v4__dscheck
+.LDS1286:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,484,.LM6467-main
+.LM6467:
+	call v4_Rightbrace
+.stabn 68,0,485,.LM6468-main
+.LM6468:
+	mov $4480,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1287
+	call v4__dscheck
+.LDS1287:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1288
+	call v4__dscheck
+.LDS1288:
+	mov %ecx,v4__dsindex
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6482-main
+.LM6482:
+	cmp $4080,%ecx
+	jbe .LDS1289
+	call v4__dscheck
+.LDS1289:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,485,.LM6486-main
+.LM6486:
+	call v4_Rightbrace
+.stabn 68,0,487,.LM6487-main
+.LM6487:
+	mov $4500,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1290
+	call v4__dscheck
+.LDS1290:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1291
+	call v4__dscheck
+.LDS1291:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6505-main
+.LM6505:
+	cmp $4080,%ecx
+	jbe .LDS1292
+	call v4__dscheck
+.LDS1292:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6509-main
+.LM6509:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,487,.LM6511-main
+.LM6511:
+	call v4_Rightbrace
+.stabn 68,0,488,.LM6512-main
+.LM6512:
+	mov $4510,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1293
+	call v4__dscheck
+.LDS1293:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1294
+	call v4__dscheck
+.LDS1294:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6530-main
+.LM6530:
+	cmp $4080,%ecx
+	jbe .LDS1295
+	call v4__dscheck
+.LDS1295:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6534-main
+.LM6534:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,488,.LM6536-main
+.LM6536:
+	call v4_Rightbrace
+.stabn 68,0,489,.LM6537-main
+.LM6537:
+	mov $4520,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1296
+	call v4__dscheck
+.LDS1296:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1297
+	call v4__dscheck
+.LDS1297:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6555-main
+.LM6555:
+	cmp $4080,%ecx
+	jbe .LDS1298
+	call v4__dscheck
+.LDS1298:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6559-main
+.LM6559:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,489,.LM6561-main
+.LM6561:
+	call v4_Rightbrace
+.stabn 68,0,490,.LM6562-main
+.LM6562:
+	mov $4530,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1299
+	call v4__dscheck
+.LDS1299:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1300
+	call v4__dscheck
+.LDS1300:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6580-main
+.LM6580:
+	cmp $4080,%ecx
+	jbe .LDS1301
+	call v4__dscheck
+.LDS1301:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6584-main
+.LM6584:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,490,.LM6586-main
+.LM6586:
+	call v4_Rightbrace
+.stabn 68,0,491,.LM6587-main
+.LM6587:
+	mov $4540,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1302
+	call v4__dscheck
+.LDS1302:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1303
+	call v4__dscheck
+.LDS1303:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6605-main
+.LM6605:
+	cmp $4080,%ecx
+	jbe .LDS1304
+	call v4__dscheck
+.LDS1304:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6609-main
+.LM6609:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,491,.LM6611-main
+.LM6611:
+	call v4_Rightbrace
+.stabn 68,0,492,.LM6612-main
+.LM6612:
+	mov $4550,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1305
+	call v4__dscheck
+.LDS1305:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1306
+	call v4__dscheck
+.LDS1306:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6630-main
+.LM6630:
+	cmp $4080,%ecx
+	jbe .LDS1307
+	call v4__dscheck
+.LDS1307:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6634-main
+.LM6634:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,492,.LM6636-main
+.LM6636:
+	call v4_Rightbrace
+.stabn 68,0,493,.LM6637-main
+.LM6637:
+	mov $4560,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1308
+	call v4__dscheck
+.LDS1308:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1309
+	call v4__dscheck
+.LDS1309:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6655-main
+.LM6655:
+	cmp $4080,%ecx
+	jbe .LDS1310
+	call v4__dscheck
+.LDS1310:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6659-main
+.LM6659:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,493,.LM6661-main
+.LM6661:
+	call v4_Rightbrace
+.stabn 68,0,494,.LM6662-main
+.LM6662:
+	mov $4570,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1311
+	call v4__dscheck
+.LDS1311:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1312
+	call v4__dscheck
+.LDS1312:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6680-main
+.LM6680:
+	cmp $4080,%ecx
+	jbe .LDS1313
+	call v4__dscheck
+.LDS1313:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6684-main
+.LM6684:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,494,.LM6686-main
+.LM6686:
+	call v4_Rightbrace
+.stabn 68,0,495,.LM6687-main
+.LM6687:
+	mov $4580,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1314
+	call v4__dscheck
+.LDS1314:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1315
+	call v4__dscheck
+.LDS1315:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6705-main
+.LM6705:
+	cmp $4080,%ecx
+	jbe .LDS1316
+	call v4__dscheck
+.LDS1316:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6709-main
+.LM6709:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,495,.LM6711-main
+.LM6711:
+	call v4_Rightbrace
+.stabn 68,0,496,.LM6712-main
+.LM6712:
+	mov $4590,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1317
+	call v4__dscheck
+.LDS1317:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1318
+	call v4__dscheck
+.LDS1318:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6730-main
+.LM6730:
+	cmp $4080,%ecx
+	jbe .LDS1319
+	call v4__dscheck
+.LDS1319:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6734-main
+.LM6734:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,496,.LM6736-main
+.LM6736:
+	call v4_Rightbrace
+.stabn 68,0,497,.LM6737-main
+.LM6737:
+	mov $4600,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1320
+	call v4__dscheck
+.LDS1320:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $31,%edx
+	add %edx,%eax
+	sar $1,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1321
+	call v4__dscheck
+.LDS1321:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6755-main
+.LM6755:
+	cmp $4080,%ecx
+	jbe .LDS1322
+	call v4__dscheck
+.LDS1322:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6759-main
+.LM6759:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,497,.LM6761-main
+.LM6761:
+	call v4_Rightbrace
+.stabn 68,0,498,.LM6762-main
+.LM6762:
+	mov $4610,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1323
+	call v4__dscheck
+.LDS1323:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1324
+	call v4__dscheck
+.LDS1324:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6780-main
+.LM6780:
+	cmp $4080,%ecx
+	jbe .LDS1325
+	call v4__dscheck
+.LDS1325:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6784-main
+.LM6784:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,498,.LM6786-main
+.LM6786:
+	call v4_Rightbrace
+.stabn 68,0,499,.LM6787-main
+.LM6787:
+	mov $4620,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1326
+	call v4__dscheck
+.LDS1326:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $31,%edx
+	add %edx,%eax
+	sar $1,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1327
+	call v4__dscheck
+.LDS1327:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6805-main
+.LM6805:
+	cmp $4080,%ecx
+	jbe .LDS1328
+	call v4__dscheck
+.LDS1328:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6809-main
+.LM6809:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,499,.LM6811-main
+.LM6811:
+	call v4_Rightbrace
+.stabn 68,0,500,.LM6812-main
+.LM6812:
+	mov $4630,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1329
+	call v4__dscheck
+.LDS1329:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1330
+	call v4__dscheck
+.LDS1330:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6830-main
+.LM6830:
+	cmp $4080,%ecx
+	jbe .LDS1331
+	call v4__dscheck
+.LDS1331:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6834-main
+.LM6834:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,500,.LM6836-main
+.LM6836:
+	call v4_Rightbrace
+.stabn 68,0,501,.LM6837-main
+.LM6837:
+	mov $4640,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1332
+	call v4__dscheck
+.LDS1332:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1333
+	call v4__dscheck
+.LDS1333:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6855-main
+.LM6855:
+	cmp $4080,%ecx
+	jbe .LDS1334
+	call v4__dscheck
+.LDS1334:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6859-main
+.LM6859:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,501,.LM6861-main
+.LM6861:
+	call v4_Rightbrace
+.stabn 68,0,502,.LM6862-main
+.LM6862:
+	mov $4650,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1335
+	call v4__dscheck
+.LDS1335:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1336
+	call v4__dscheck
+.LDS1336:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6880-main
+.LM6880:
+	cmp $4080,%ecx
+	jbe .LDS1337
+	call v4__dscheck
+.LDS1337:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6884-main
+.LM6884:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,502,.LM6886-main
+.LM6886:
+	call v4_Rightbrace
+.stabn 68,0,503,.LM6887-main
+.LM6887:
+	mov $4660,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1338
+	call v4__dscheck
+.LDS1338:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1339
+	call v4__dscheck
+.LDS1339:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6905-main
+.LM6905:
+	cmp $4080,%ecx
+	jbe .LDS1340
+	call v4__dscheck
+.LDS1340:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6909-main
+.LM6909:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,503,.LM6911-main
+.LM6911:
+	call v4_Rightbrace
+.stabn 68,0,504,.LM6912-main
+.LM6912:
+	mov $4670,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1341
+	call v4__dscheck
+.LDS1341:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1342
+	call v4__dscheck
+.LDS1342:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6930-main
+.LM6930:
+	cmp $4080,%ecx
+	jbe .LDS1343
+	call v4__dscheck
+.LDS1343:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6934-main
+.LM6934:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,504,.LM6936-main
+.LM6936:
+	call v4_Rightbrace
+.stabn 68,0,505,.LM6937-main
+.LM6937:
+	mov $4680,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1344
+	call v4__dscheck
+.LDS1344:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1345
+	call v4__dscheck
+.LDS1345:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6955-main
+.LM6955:
+	cmp $4080,%ecx
+	jbe .LDS1346
+	call v4__dscheck
+.LDS1346:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6959-main
+.LM6959:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,505,.LM6961-main
+.LM6961:
+	call v4_Rightbrace
+.stabn 68,0,506,.LM6962-main
+.LM6962:
+	mov $4690,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1347
+	call v4__dscheck
+.LDS1347:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1348
+	call v4__dscheck
+.LDS1348:
+	mov %ecx,v4__dsindex
+	call v4_Slash
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6977-main
+.LM6977:
+	cmp $4080,%ecx
+	jbe .LDS1349
+	call v4__dscheck
+.LDS1349:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6981-main
+.LM6981:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,506,.LM6983-main
+.LM6983:
+	call v4_Rightbrace
+.stabn 68,0,507,.LM6984-main
+.LM6984:
+	mov $4700,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1350
+	call v4__dscheck
+.LDS1350:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1351
+	call v4__dscheck
+.LDS1351:
+	mov %ecx,v4__dsindex
+	call v4_Slash
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM6999-main
+.LM6999:
+	cmp $4080,%ecx
+	jbe .LDS1352
+	call v4__dscheck
+.LDS1352:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM7003-main
+.LM7003:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,507,.LM7005-main
+.LM7005:
+	call v4_Rightbrace
+.stabn 68,0,509,.LM7006-main
+.LM7006:
+	mov $4720,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1353
+	call v4__dscheck
+.LDS1353:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1354
+	call v4__dscheck
+.LDS1354:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7024-main
+.LM7024:
+	cmp $4080,%ecx
+	jbe .LDS1355
+	call v4__dscheck
+.LDS1355:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7028-main
+.LM7028:
+	call v4_drop
+.stabn 68,0,509,.LM7029-main
+.LM7029:
+	call v4_Rightbrace
+.stabn 68,0,510,.LM7030-main
+.LM7030:
+	mov $4730,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1356
+	call v4__dscheck
+.LDS1356:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1357
+	call v4__dscheck
+.LDS1357:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7048-main
+.LM7048:
+	cmp $4080,%ecx
+	jbe .LDS1358
+	call v4__dscheck
+.LDS1358:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7052-main
+.LM7052:
+	call v4_drop
+.stabn 68,0,510,.LM7053-main
+.LM7053:
+	call v4_Rightbrace
+.stabn 68,0,511,.LM7054-main
+.LM7054:
+	mov $4740,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1359
+	call v4__dscheck
+.LDS1359:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1360
+	call v4__dscheck
+.LDS1360:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7072-main
+.LM7072:
+	cmp $4080,%ecx
+	jbe .LDS1361
+	call v4__dscheck
+.LDS1361:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7076-main
+.LM7076:
+	call v4_drop
+.stabn 68,0,511,.LM7077-main
+.LM7077:
+	call v4_Rightbrace
+.stabn 68,0,512,.LM7078-main
+.LM7078:
+	mov $4750,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1362
+	call v4__dscheck
+.LDS1362:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1363
+	call v4__dscheck
+.LDS1363:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7096-main
+.LM7096:
+	cmp $4080,%ecx
+	jbe .LDS1364
+	call v4__dscheck
+.LDS1364:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7100-main
+.LM7100:
+	call v4_drop
+.stabn 68,0,512,.LM7101-main
+.LM7101:
+	call v4_Rightbrace
+.stabn 68,0,513,.LM7102-main
+.LM7102:
+	mov $4760,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1365
+	call v4__dscheck
+.LDS1365:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1366
+	call v4__dscheck
+.LDS1366:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7120-main
+.LM7120:
+	cmp $4080,%ecx
+	jbe .LDS1367
+	call v4__dscheck
+.LDS1367:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7124-main
+.LM7124:
+	call v4_drop
+.stabn 68,0,513,.LM7125-main
+.LM7125:
+	call v4_Rightbrace
+.stabn 68,0,514,.LM7126-main
+.LM7126:
+	mov $4770,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1368
+	call v4__dscheck
+.LDS1368:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1369
+	call v4__dscheck
+.LDS1369:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7144-main
+.LM7144:
+	cmp $4080,%ecx
+	jbe .LDS1370
+	call v4__dscheck
+.LDS1370:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7148-main
+.LM7148:
+	call v4_drop
+.stabn 68,0,514,.LM7149-main
+.LM7149:
+	call v4_Rightbrace
+.stabn 68,0,515,.LM7150-main
+.LM7150:
+	mov $4780,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1371
+	call v4__dscheck
+.LDS1371:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1372
+	call v4__dscheck
+.LDS1372:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7168-main
+.LM7168:
+	cmp $4080,%ecx
+	jbe .LDS1373
+	call v4__dscheck
+.LDS1373:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7172-main
+.LM7172:
+	call v4_drop
+.stabn 68,0,515,.LM7173-main
+.LM7173:
+	call v4_Rightbrace
+.stabn 68,0,516,.LM7174-main
+.LM7174:
+	mov $4790,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1374
+	call v4__dscheck
+.LDS1374:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1375
+	call v4__dscheck
+.LDS1375:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7192-main
+.LM7192:
+	cmp $4080,%ecx
+	jbe .LDS1376
+	call v4__dscheck
+.LDS1376:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7196-main
+.LM7196:
+	call v4_drop
+.stabn 68,0,516,.LM7197-main
+.LM7197:
+	call v4_Rightbrace
+.stabn 68,0,517,.LM7198-main
+.LM7198:
+	mov $4800,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1377
+	call v4__dscheck
+.LDS1377:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1378
+	call v4__dscheck
+.LDS1378:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7216-main
+.LM7216:
+	cmp $4080,%ecx
+	jbe .LDS1379
+	call v4__dscheck
+.LDS1379:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7220-main
+.LM7220:
+	call v4_drop
+.stabn 68,0,517,.LM7221-main
+.LM7221:
+	call v4_Rightbrace
+.stabn 68,0,518,.LM7222-main
+.LM7222:
+	mov $4810,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1380
+	call v4__dscheck
+.LDS1380:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1381
+	call v4__dscheck
+.LDS1381:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7240-main
+.LM7240:
+	cmp $4080,%ecx
+	jbe .LDS1382
+	call v4__dscheck
+.LDS1382:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7244-main
+.LM7244:
+	call v4_drop
+.stabn 68,0,518,.LM7245-main
+.LM7245:
+	call v4_Rightbrace
+.stabn 68,0,519,.LM7246-main
+.LM7246:
+	mov $4820,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1383
+	call v4__dscheck
+.LDS1383:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $31,%edx
+	add %edx,%eax
+	and $1,%eax
+	sub %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1384
+	call v4__dscheck
+.LDS1384:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7264-main
+.LM7264:
+	cmp $4080,%ecx
+	jbe .LDS1385
+	call v4__dscheck
+.LDS1385:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7268-main
+.LM7268:
+	call v4_drop
+.stabn 68,0,519,.LM7269-main
+.LM7269:
+	call v4_Rightbrace
+.stabn 68,0,520,.LM7270-main
+.LM7270:
+	mov $4830,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1386
+	call v4__dscheck
+.LDS1386:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1387
+	call v4__dscheck
+.LDS1387:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7288-main
+.LM7288:
+	cmp $4080,%ecx
+	jbe .LDS1388
+	call v4__dscheck
+.LDS1388:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7292-main
+.LM7292:
+	call v4_drop
+.stabn 68,0,520,.LM7293-main
+.LM7293:
+	call v4_Rightbrace
+.stabn 68,0,521,.LM7294-main
+.LM7294:
+	mov $4840,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1389
+	call v4__dscheck
+.LDS1389:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $31,%edx
+	add %edx,%eax
+	and $1,%eax
+	sub %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1390
+	call v4__dscheck
+.LDS1390:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7312-main
+.LM7312:
+	cmp $4080,%ecx
+	jbe .LDS1391
+	call v4__dscheck
+.LDS1391:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7316-main
+.LM7316:
+	call v4_drop
+.stabn 68,0,521,.LM7317-main
+.LM7317:
+	call v4_Rightbrace
+.stabn 68,0,522,.LM7318-main
+.LM7318:
+	mov $4850,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1392
+	call v4__dscheck
+.LDS1392:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $3,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1393
+	call v4__dscheck
+.LDS1393:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7336-main
+.LM7336:
+	cmp $4080,%ecx
+	jbe .LDS1394
+	call v4__dscheck
+.LDS1394:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7340-main
+.LM7340:
+	call v4_drop
+.stabn 68,0,522,.LM7341-main
+.LM7341:
+	call v4_Rightbrace
+.stabn 68,0,523,.LM7342-main
+.LM7342:
+	mov $4860,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1395
+	call v4__dscheck
+.LDS1395:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $3,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1396
+	call v4__dscheck
+.LDS1396:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7360-main
+.LM7360:
+	cmp $4080,%ecx
+	jbe .LDS1397
+	call v4__dscheck
+.LDS1397:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7364-main
+.LM7364:
+	call v4_drop
+.stabn 68,0,523,.LM7365-main
+.LM7365:
+	call v4_Rightbrace
+.stabn 68,0,524,.LM7366-main
+.LM7366:
+	mov $4870,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1398
+	call v4__dscheck
+.LDS1398:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $3,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1399
+	call v4__dscheck
+.LDS1399:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7384-main
+.LM7384:
+	cmp $4080,%ecx
+	jbe .LDS1400
+	call v4__dscheck
+.LDS1400:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7388-main
+.LM7388:
+	call v4_drop
+.stabn 68,0,524,.LM7389-main
+.LM7389:
+	call v4_Rightbrace
+.stabn 68,0,525,.LM7390-main
+.LM7390:
+	mov $4880,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1401
+	call v4__dscheck
+.LDS1401:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $3,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1402
+	call v4__dscheck
+.LDS1402:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7408-main
+.LM7408:
+	cmp $4080,%ecx
+	jbe .LDS1403
+	call v4__dscheck
+.LDS1403:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7412-main
+.LM7412:
+	call v4_drop
+.stabn 68,0,525,.LM7413-main
+.LM7413:
+	call v4_Rightbrace
+.stabn 68,0,526,.LM7414-main
+.LM7414:
+	mov $4890,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1404
+	call v4__dscheck
+.LDS1404:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1405
+	call v4__dscheck
+.LDS1405:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7432-main
+.LM7432:
+	cmp $4080,%ecx
+	jbe .LDS1406
+	call v4__dscheck
+.LDS1406:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7436-main
+.LM7436:
+	call v4_drop
+.stabn 68,0,526,.LM7437-main
+.LM7437:
+	call v4_Rightbrace
+.stabn 68,0,527,.LM7438-main
+.LM7438:
+	mov $4900,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1407
+	call v4__dscheck
+.LDS1407:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1408
+	call v4__dscheck
+.LDS1408:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7456-main
+.LM7456:
+	cmp $4080,%ecx
+	jbe .LDS1409
+	call v4__dscheck
+.LDS1409:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7460-main
+.LM7460:
+	call v4_drop
+.stabn 68,0,527,.LM7461-main
+.LM7461:
+	call v4_Rightbrace
+.stabn 68,0,528,.LM7462-main
+.LM7462:
+	mov $4910,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1410
+	call v4__dscheck
+.LDS1410:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1411
+	call v4__dscheck
+.LDS1411:
+	mov %ecx,v4__dsindex
+	call v4_mod
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7477-main
+.LM7477:
+	cmp $4080,%ecx
+	jbe .LDS1412
+	call v4__dscheck
+.LDS1412:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7481-main
+.LM7481:
+	call v4_drop
+.stabn 68,0,528,.LM7482-main
+.LM7482:
+	call v4_Rightbrace
+.stabn 68,0,529,.LM7483-main
+.LM7483:
+	mov $4920,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1413
+	call v4__dscheck
+.LDS1413:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1414
+	call v4__dscheck
+.LDS1414:
+	mov %ecx,v4__dsindex
+	call v4_mod
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,459,.LM7498-main
+.LM7498:
+	cmp $4080,%ecx
+	jbe .LDS1415
+	call v4__dscheck
+.LDS1415:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7502-main
+.LM7502:
+	call v4_drop
+.stabn 68,0,529,.LM7503-main
+.LM7503:
+	call v4_Rightbrace
+.stabn 68,0,531,.LM7504-main
+.LM7504:
+	mov $4940,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1416
+	call v4__dscheck
+.LDS1416:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1417
+	call v4__dscheck
+.LDS1417:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7523-main
+.LM7523:
+	cmp $4080,%ecx
+	jbe .LDS1418
+	call v4__dscheck
+.LDS1418:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7527-main
+.LM7527:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,531,.LM7529-main
+.LM7529:
+	call v4_Rightbrace
+.stabn 68,0,532,.LM7530-main
+.LM7530:
+	mov $4950,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1419
+	call v4__dscheck
+.LDS1419:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1420
+	call v4__dscheck
+.LDS1420:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7549-main
+.LM7549:
+	cmp $4080,%ecx
+	jbe .LDS1421
+	call v4__dscheck
+.LDS1421:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7553-main
+.LM7553:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,532,.LM7555-main
+.LM7555:
+	call v4_Rightbrace
+.stabn 68,0,533,.LM7556-main
+.LM7556:
+	mov $4960,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1422
+	call v4__dscheck
+.LDS1422:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1423
+	call v4__dscheck
+.LDS1423:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7575-main
+.LM7575:
+	cmp $4080,%ecx
+	jbe .LDS1424
+	call v4__dscheck
+.LDS1424:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7579-main
+.LM7579:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,533,.LM7581-main
+.LM7581:
+	call v4_Rightbrace
+.stabn 68,0,534,.LM7582-main
+.LM7582:
+	mov $4970,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1425
+	call v4__dscheck
+.LDS1425:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1426
+	call v4__dscheck
+.LDS1426:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7601-main
+.LM7601:
+	cmp $4080,%ecx
+	jbe .LDS1427
+	call v4__dscheck
+.LDS1427:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7605-main
+.LM7605:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,534,.LM7607-main
+.LM7607:
+	call v4_Rightbrace
+.stabn 68,0,535,.LM7608-main
+.LM7608:
+	mov $4980,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1428
+	call v4__dscheck
+.LDS1428:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1429
+	call v4__dscheck
+.LDS1429:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7627-main
+.LM7627:
+	cmp $4080,%ecx
+	jbe .LDS1430
+	call v4__dscheck
+.LDS1430:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7631-main
+.LM7631:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,535,.LM7633-main
+.LM7633:
+	call v4_Rightbrace
+.stabn 68,0,536,.LM7634-main
+.LM7634:
+	mov $4990,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1431
+	call v4__dscheck
+.LDS1431:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1432
+	call v4__dscheck
+.LDS1432:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7653-main
+.LM7653:
+	cmp $4080,%ecx
+	jbe .LDS1433
+	call v4__dscheck
+.LDS1433:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7657-main
+.LM7657:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,536,.LM7659-main
+.LM7659:
+	call v4_Rightbrace
+.stabn 68,0,537,.LM7660-main
+.LM7660:
+	mov $5000,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1434
+	call v4__dscheck
+.LDS1434:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1435
+	call v4__dscheck
+.LDS1435:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7679-main
+.LM7679:
+	cmp $4080,%ecx
+	jbe .LDS1436
+	call v4__dscheck
+.LDS1436:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7683-main
+.LM7683:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,537,.LM7685-main
+.LM7685:
+	call v4_Rightbrace
+.stabn 68,0,538,.LM7686-main
+.LM7686:
+	mov $5010,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1437
+	call v4__dscheck
+.LDS1437:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1438
+	call v4__dscheck
+.LDS1438:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7705-main
+.LM7705:
+	cmp $4080,%ecx
+	jbe .LDS1439
+	call v4__dscheck
+.LDS1439:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7709-main
+.LM7709:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,538,.LM7711-main
+.LM7711:
+	call v4_Rightbrace
+.stabn 68,0,539,.LM7712-main
+.LM7712:
+	mov $5020,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1440
+	call v4__dscheck
+.LDS1440:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1441
+	call v4__dscheck
+.LDS1441:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7731-main
+.LM7731:
+	cmp $4080,%ecx
+	jbe .LDS1442
+	call v4__dscheck
+.LDS1442:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7735-main
+.LM7735:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,539,.LM7737-main
+.LM7737:
+	call v4_Rightbrace
+.stabn 68,0,540,.LM7738-main
+.LM7738:
+	mov $5030,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1443
+	call v4__dscheck
+.LDS1443:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1444
+	call v4__dscheck
+.LDS1444:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7757-main
+.LM7757:
+	cmp $4080,%ecx
+	jbe .LDS1445
+	call v4__dscheck
+.LDS1445:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7761-main
+.LM7761:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,540,.LM7763-main
+.LM7763:
+	call v4_Rightbrace
+.stabn 68,0,541,.LM7764-main
+.LM7764:
+	mov $5040,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1446
+	call v4__dscheck
+.LDS1446:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1447
+	call v4__dscheck
+.LDS1447:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7783-main
+.LM7783:
+	cmp $4080,%ecx
+	jbe .LDS1448
+	call v4__dscheck
+.LDS1448:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7787-main
+.LM7787:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,541,.LM7789-main
+.LM7789:
+	call v4_Rightbrace
+.stabn 68,0,542,.LM7790-main
+.LM7790:
+	mov $5050,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1449
+	call v4__dscheck
+.LDS1449:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1450
+	call v4__dscheck
+.LDS1450:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7809-main
+.LM7809:
+	cmp $4080,%ecx
+	jbe .LDS1451
+	call v4__dscheck
+.LDS1451:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7813-main
+.LM7813:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,542,.LM7815-main
+.LM7815:
+	call v4_Rightbrace
+.stabn 68,0,543,.LM7816-main
+.LM7816:
+	mov $5060,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1452
+	call v4__dscheck
+.LDS1452:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1453
+	call v4__dscheck
+.LDS1453:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7835-main
+.LM7835:
+	cmp $4080,%ecx
+	jbe .LDS1454
+	call v4__dscheck
+.LDS1454:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7839-main
+.LM7839:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,543,.LM7841-main
+.LM7841:
+	call v4_Rightbrace
+.stabn 68,0,544,.LM7842-main
+.LM7842:
+	mov $5070,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1455
+	call v4__dscheck
+.LDS1455:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1456
+	call v4__dscheck
+.LDS1456:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7861-main
+.LM7861:
+	cmp $4080,%ecx
+	jbe .LDS1457
+	call v4__dscheck
+.LDS1457:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7865-main
+.LM7865:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,544,.LM7867-main
+.LM7867:
+	call v4_Rightbrace
+.stabn 68,0,545,.LM7868-main
+.LM7868:
+	mov $5080,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1458
+	call v4__dscheck
+.LDS1458:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1459
+	call v4__dscheck
+.LDS1459:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7887-main
+.LM7887:
+	cmp $4080,%ecx
+	jbe .LDS1460
+	call v4__dscheck
+.LDS1460:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7891-main
+.LM7891:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,545,.LM7893-main
+.LM7893:
+	call v4_Rightbrace
+.stabn 68,0,546,.LM7894-main
+.LM7894:
+	mov $5090,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1461
+	call v4__dscheck
+.LDS1461:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1462
+	call v4__dscheck
+.LDS1462:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7913-main
+.LM7913:
+	cmp $4080,%ecx
+	jbe .LDS1463
+	call v4__dscheck
+.LDS1463:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7917-main
+.LM7917:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,546,.LM7919-main
+.LM7919:
+	call v4_Rightbrace
+.stabn 68,0,547,.LM7920-main
+.LM7920:
+	mov $5100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1464
+	call v4__dscheck
+.LDS1464:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1465
+	call v4__dscheck
+.LDS1465:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7939-main
+.LM7939:
+	cmp $4080,%ecx
+	jbe .LDS1466
+	call v4__dscheck
+.LDS1466:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7943-main
+.LM7943:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,547,.LM7945-main
+.LM7945:
+	call v4_Rightbrace
+.stabn 68,0,548,.LM7946-main
+.LM7946:
+	mov $5110,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1467
+	call v4__dscheck
+.LDS1467:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1468
+	call v4__dscheck
+.LDS1468:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7965-main
+.LM7965:
+	cmp $4080,%ecx
+	jbe .LDS1469
+	call v4__dscheck
+.LDS1469:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7969-main
+.LM7969:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,548,.LM7971-main
+.LM7971:
+	call v4_Rightbrace
+.stabn 68,0,549,.LM7972-main
+.LM7972:
+	mov $5120,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1470
+	call v4__dscheck
+.LDS1470:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1471
+	call v4__dscheck
+.LDS1471:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM7991-main
+.LM7991:
+	cmp $4080,%ecx
+	jbe .LDS1472
+	call v4__dscheck
+.LDS1472:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7995-main
+.LM7995:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,549,.LM7997-main
+.LM7997:
+	call v4_Rightbrace
+.stabn 68,0,551,.LM7998-main
+.LM7998:
+	mov $5140,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1473
+	call v4__dscheck
+.LDS1473:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1474
+	call v4__dscheck
+.LDS1474:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8016-main
+.LM8016:
+	cmp $4080,%ecx
+	jbe .LDS1475
+	call v4__dscheck
+.LDS1475:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,551,.LM8020-main
+.LM8020:
+	call v4_Rightbrace
+.stabn 68,0,552,.LM8021-main
+.LM8021:
+	mov $5150,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1476
+	call v4__dscheck
+.LDS1476:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1477
+	call v4__dscheck
+.LDS1477:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8039-main
+.LM8039:
+	cmp $4080,%ecx
+	jbe .LDS1478
+	call v4__dscheck
+.LDS1478:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,552,.LM8043-main
+.LM8043:
+	call v4_Rightbrace
+.stabn 68,0,553,.LM8044-main
+.LM8044:
+	mov $5160,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1479
+	call v4__dscheck
+.LDS1479:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1480
+	call v4__dscheck
+.LDS1480:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8062-main
+.LM8062:
+	cmp $4080,%ecx
+	jbe .LDS1481
+	call v4__dscheck
+.LDS1481:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,553,.LM8066-main
+.LM8066:
+	call v4_Rightbrace
+.stabn 68,0,554,.LM8067-main
+.LM8067:
+	mov $5170,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1482
+	call v4__dscheck
+.LDS1482:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1483
+	call v4__dscheck
+.LDS1483:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8085-main
+.LM8085:
+	cmp $4080,%ecx
+	jbe .LDS1484
+	call v4__dscheck
+.LDS1484:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,554,.LM8089-main
+.LM8089:
+	call v4_Rightbrace
+.stabn 68,0,555,.LM8090-main
+.LM8090:
+	mov $5180,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1485
+	call v4__dscheck
+.LDS1485:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1486
+	call v4__dscheck
+.LDS1486:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8108-main
+.LM8108:
+	cmp $4080,%ecx
+	jbe .LDS1487
+	call v4__dscheck
+.LDS1487:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,555,.LM8112-main
+.LM8112:
+	call v4_Rightbrace
+.stabn 68,0,556,.LM8113-main
+.LM8113:
+	mov $5190,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1488
+	call v4__dscheck
+.LDS1488:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1489
+	call v4__dscheck
+.LDS1489:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8131-main
+.LM8131:
+	cmp $4080,%ecx
+	jbe .LDS1490
+	call v4__dscheck
+.LDS1490:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,556,.LM8135-main
+.LM8135:
+	call v4_Rightbrace
+.stabn 68,0,557,.LM8136-main
+.LM8136:
+	mov $5200,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1491
+	call v4__dscheck
+.LDS1491:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1492
+	call v4__dscheck
+.LDS1492:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8154-main
+.LM8154:
+	cmp $4080,%ecx
+	jbe .LDS1493
+	call v4__dscheck
+.LDS1493:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,557,.LM8158-main
+.LM8158:
+	call v4_Rightbrace
+.stabn 68,0,558,.LM8159-main
+.LM8159:
+	mov $5210,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1494
+	call v4__dscheck
+.LDS1494:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1495
+	call v4__dscheck
+.LDS1495:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8177-main
+.LM8177:
+	cmp $4080,%ecx
+	jbe .LDS1496
+	call v4__dscheck
+.LDS1496:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,558,.LM8181-main
+.LM8181:
+	call v4_Rightbrace
+.stabn 68,0,559,.LM8182-main
+.LM8182:
+	mov $5220,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1497
+	call v4__dscheck
+.LDS1497:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1498
+	call v4__dscheck
+.LDS1498:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8200-main
+.LM8200:
+	cmp $4080,%ecx
+	jbe .LDS1499
+	call v4__dscheck
+.LDS1499:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,559,.LM8204-main
+.LM8204:
+	call v4_Rightbrace
+.stabn 68,0,560,.LM8205-main
+.LM8205:
+	mov $5230,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1500
+	call v4__dscheck
+.LDS1500:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1501
+	call v4__dscheck
+.LDS1501:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8223-main
+.LM8223:
+	cmp $4080,%ecx
+	jbe .LDS1502
+	call v4__dscheck
+.LDS1502:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,560,.LM8227-main
+.LM8227:
+	call v4_Rightbrace
+.stabn 68,0,561,.LM8228-main
+.LM8228:
+	mov $5240,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1503
+	call v4__dscheck
+.LDS1503:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1504
+	call v4__dscheck
+.LDS1504:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8246-main
+.LM8246:
+	cmp $4080,%ecx
+	jbe .LDS1505
+	call v4__dscheck
+.LDS1505:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,561,.LM8250-main
+.LM8250:
+	call v4_Rightbrace
+.stabn 68,0,562,.LM8251-main
+.LM8251:
+	mov $5250,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1506
+	call v4__dscheck
+.LDS1506:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1507
+	call v4__dscheck
+.LDS1507:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8269-main
+.LM8269:
+	cmp $4080,%ecx
+	jbe .LDS1508
+	call v4__dscheck
+.LDS1508:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,562,.LM8273-main
+.LM8273:
+	call v4_Rightbrace
+.stabn 68,0,563,.LM8274-main
+.LM8274:
+	mov $5260,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1509
+	call v4__dscheck
+.LDS1509:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1510
+	call v4__dscheck
+.LDS1510:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8292-main
+.LM8292:
+	cmp $4080,%ecx
+	jbe .LDS1511
+	call v4__dscheck
+.LDS1511:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,563,.LM8296-main
+.LM8296:
+	call v4_Rightbrace
+.stabn 68,0,564,.LM8297-main
+.LM8297:
+	mov $5270,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1512
+	call v4__dscheck
+.LDS1512:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1513
+	call v4__dscheck
+.LDS1513:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8315-main
+.LM8315:
+	cmp $4080,%ecx
+	jbe .LDS1514
+	call v4__dscheck
+.LDS1514:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,564,.LM8319-main
+.LM8319:
+	call v4_Rightbrace
+.stabn 68,0,565,.LM8320-main
+.LM8320:
+	mov $5280,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1515
+	call v4__dscheck
+.LDS1515:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1516
+	call v4__dscheck
+.LDS1516:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8338-main
+.LM8338:
+	cmp $4080,%ecx
+	jbe .LDS1517
+	call v4__dscheck
+.LDS1517:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,565,.LM8342-main
+.LM8342:
+	call v4_Rightbrace
+.stabn 68,0,566,.LM8343-main
+.LM8343:
+	mov $5290,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1518
+	call v4__dscheck
+.LDS1518:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1519
+	call v4__dscheck
+.LDS1519:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8361-main
+.LM8361:
+	cmp $4080,%ecx
+	jbe .LDS1520
+	call v4__dscheck
+.LDS1520:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,566,.LM8365-main
+.LM8365:
+	call v4_Rightbrace
+.stabn 68,0,567,.LM8366-main
+.LM8366:
+	mov $5300,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1521
+	call v4__dscheck
+.LDS1521:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1522
+	call v4__dscheck
+.LDS1522:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8384-main
+.LM8384:
+	cmp $4080,%ecx
+	jbe .LDS1523
+	call v4__dscheck
+.LDS1523:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,567,.LM8388-main
+.LM8388:
+	call v4_Rightbrace
+.stabn 68,0,568,.LM8389-main
+.LM8389:
+	mov $5310,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1524
+	call v4__dscheck
+.LDS1524:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1525
+	call v4__dscheck
+.LDS1525:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8407-main
+.LM8407:
+	cmp $4080,%ecx
+	jbe .LDS1526
+	call v4__dscheck
+.LDS1526:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,568,.LM8411-main
+.LM8411:
+	call v4_Rightbrace
+.stabn 68,0,569,.LM8412-main
+.LM8412:
+	mov $5320,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1527
+	call v4__dscheck
+.LDS1527:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1528
+	call v4__dscheck
+.LDS1528:
+	mov %ecx,v4__dsindex
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,462,.LM8430-main
+.LM8430:
+	cmp $4080,%ecx
+	jbe .LDS1529
+	call v4__dscheck
+.LDS1529:
+	mov %ecx,v4__dsindex
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,569,.LM8434-main
+.LM8434:
+	call v4_Rightbrace
+.stabn 68,0,572,.LM8435-main
+.LM8435:
+	lea .LC10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $74,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1530
+	call v4__dscheck
+.LDS1530:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,583,.LM8441-main
+.LM8441:
+	lea v4_hbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4__here,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1531
+	call v4__dscheck
+.LDS1531:
+	mov %ecx,v4__dsindex
+	call v4_Store
+.stabn 68,0,585,.LM8446-main
+.LM8446:
+	call v4_here
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1532
+	call v4__dscheck
+.LDS1532:
+	mov %ecx,v4__dsindex
+	call v4_Comma
+.stabn 68,0,586,.LM8450-main
+.LM8450:
+	call v4_here
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1533
+	call v4__dscheck
+.LDS1533:
+	mov %ecx,v4__dsindex
+	call v4_Comma
+.stabn 68,0,587,.LM8454-main
+.LM8454:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,(v4_z2nd)
+.stabn 68,0,588,.LM8456-main
+.LM8456:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,(v4_z1st)
+.stabn 68,0,589,.LM8458-main
+.LM8458:
+	mov $5490,%eax
+	cmp $4080,%ecx
+	jbe .LDS1534
+	call v4__dscheck
+.LDS1534:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1535
+	call v4__dscheck
+.LDS1535:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	mov %eax,%esi
+	mov (v4_z2nd),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1536
+	call v4__dscheck
+.LDS1536:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1537
+	call v4__dscheck
+.LDS1537:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,590,.LM8474-main
+.LM8474:
+	mov $5500,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1538
+	call v4__dscheck
+.LDS1538:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	add $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1539
+	call v4__dscheck
+.LDS1539:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_z2nd),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1540
+	call v4__dscheck
+.LDS1540:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,591,.LM8487-main
+.LM8487:
+	mov $5510,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1541
+	call v4__dscheck
+.LDS1541:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	mov %eax,%esi
+	mov $4,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1542
+	call v4__dscheck
+.LDS1542:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_z2nd),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1543
+	call v4__dscheck
+.LDS1543:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,592,.LM8504-main
+.LM8504:
+	mov $5520,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1544
+	call v4__dscheck
+.LDS1544:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1545
+	call v4__dscheck
+.LDS1545:
+	mov %ecx,v4__dsindex
+	call v4_Fetch
+	mov (v4_z2nd),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1546
+	call v4__dscheck
+.LDS1546:
+	mov %ecx,v4__dsindex
+	call v4_Fetch
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1547
+	call v4__dscheck
+.LDS1547:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,593,.LM8519-main
+.LM8519:
+	mov $5530,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1548
+	call v4__dscheck
+.LDS1548:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov (v4_z1st),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1549
+	call v4__dscheck
+.LDS1549:
+	mov %ecx,v4__dsindex
+	call v4_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,594,.LM8529-main
+.LM8529:
+	mov $5540,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1550
+	call v4__dscheck
+.LDS1550:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1551
+	call v4__dscheck
+.LDS1551:
+	mov %ecx,v4__dsindex
+	call v4_Fetch
+	mov (v4_z2nd),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1552
+	call v4__dscheck
+.LDS1552:
+	mov %ecx,v4__dsindex
+	call v4_Fetch
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1553
+	call v4__dscheck
+.LDS1553:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,595,.LM8544-main
+.LM8544:
+	mov $5550,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1554
+	call v4__dscheck
+.LDS1554:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov (v4_z2nd),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1555
+	call v4__dscheck
+.LDS1555:
+	mov %ecx,v4__dsindex
+	call v4_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,596,.LM8554-main
+.LM8554:
+	mov $5560,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1556
+	call v4__dscheck
+.LDS1556:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1557
+	call v4__dscheck
+.LDS1557:
+	mov %ecx,v4__dsindex
+	call v4_Fetch
+	mov (v4_z2nd),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1558
+	call v4__dscheck
+.LDS1558:
+	mov %ecx,v4__dsindex
+	call v4_Fetch
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $6,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1559
+	call v4__dscheck
+.LDS1559:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,597,.LM8569-main
+.LM8569:
+	mov $5570,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1560
+	call v4__dscheck
+.LDS1560:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1561
+	call v4__dscheck
+.LDS1561:
+	mov %ecx,v4__dsindex
+	call v4_z2_Fetch
+	call v4_Minus_Greater
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $5,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1562
+	call v4__dscheck
+.LDS1562:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,598,.LM8581-main
+.LM8581:
+	mov $5580,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1563
+	call v4__dscheck
+.LDS1563:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov (v4_z1st),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1564
+	call v4__dscheck
+.LDS1564:
+	mov %ecx,v4__dsindex
+	call v4_z2_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,599,.LM8593-main
+.LM8593:
+	mov $5590,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1565
+	call v4__dscheck
+.LDS1565:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1566
+	call v4__dscheck
+.LDS1566:
+	mov %ecx,v4__dsindex
+	call v4_z2_Fetch
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1567
+	call v4__dscheck
+.LDS1567:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,601,.LM8605-main
+.LM8605:
+	call v4_here
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1568
+	call v4__dscheck
+.LDS1568:
+	mov %ecx,v4__dsindex
+	call v4_c_Comma
+.stabn 68,0,602,.LM8609-main
+.LM8609:
+	call v4_here
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1569
+	call v4__dscheck
+.LDS1569:
+	mov %ecx,v4__dsindex
+	call v4_c_Comma
+.stabn 68,0,603,.LM8613-main
+.LM8613:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,(v4_z2ndc)
+.stabn 68,0,604,.LM8615-main
+.LM8615:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,(v4_z1stc)
+.stabn 68,0,605,.LM8617-main
+.LM8617:
+	mov $5650,%eax
+	cmp $4080,%ecx
+	jbe .LDS1570
+	call v4__dscheck
+.LDS1570:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1571
+	call v4__dscheck
+.LDS1571:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1stc),%eax
+	mov %eax,%esi
+	mov (v4_z2ndc),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setb %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1572
+	call v4__dscheck
+.LDS1572:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1573
+	call v4__dscheck
+.LDS1573:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,606,.LM8633-main
+.LM8633:
+	mov $5660,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1574
+	call v4__dscheck
+.LDS1574:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1stc),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1575
+	call v4__dscheck
+.LDS1575:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_Minus_Greater
+	mov (v4_z2ndc),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1576
+	call v4__dscheck
+.LDS1576:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,607,.LM8643-main
+.LM8643:
+	mov $5670,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1577
+	call v4__dscheck
+.LDS1577:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1stc),%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1578
+	call v4__dscheck
+.LDS1578:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_z2ndc),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1579
+	call v4__dscheck
+.LDS1579:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,608,.LM8660-main
+.LM8660:
+	mov $5680,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1580
+	call v4__dscheck
+.LDS1580:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1stc),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1581
+	call v4__dscheck
+.LDS1581:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	mov (v4_z2ndc),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1582
+	call v4__dscheck
+.LDS1582:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1583
+	call v4__dscheck
+.LDS1583:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,609,.LM8675-main
+.LM8675:
+	mov $5690,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1584
+	call v4__dscheck
+.LDS1584:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov (v4_z1stc),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1585
+	call v4__dscheck
+.LDS1585:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,610,.LM8685-main
+.LM8685:
+	mov $5700,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1586
+	call v4__dscheck
+.LDS1586:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1stc),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1587
+	call v4__dscheck
+.LDS1587:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	mov (v4_z2ndc),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1588
+	call v4__dscheck
+.LDS1588:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1589
+	call v4__dscheck
+.LDS1589:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,611,.LM8700-main
+.LM8700:
+	mov $5710,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1590
+	call v4__dscheck
+.LDS1590:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov (v4_z2ndc),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1591
+	call v4__dscheck
+.LDS1591:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,612,.LM8710-main
+.LM8710:
+	mov $5720,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1592
+	call v4__dscheck
+.LDS1592:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1stc),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1593
+	call v4__dscheck
+.LDS1593:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	mov (v4_z2ndc),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1594
+	call v4__dscheck
+.LDS1594:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1595
+	call v4__dscheck
+.LDS1595:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,614,.LM8725-main
+.LM8725:
+	call v4_align
+.stabn 68,0,615,.LM8726-main
+.LM8726:
+	call v4_here
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1596
+	call v4__dscheck
+.LDS1596:
+	mov %ecx,v4__dsindex
+	call v4_c_Comma
+	call v4_align
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1597
+	call v4__dscheck
+.LDS1597:
+	mov %ecx,v4__dsindex
+	call v4_Comma
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,(v4_x)
+.stabn 68,0,617,.LM8736-main
+.LM8736:
+	mov $5750,%eax
+	cmp $4080,%ecx
+	jbe .LDS1598
+	call v4__dscheck
+.LDS1598:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1599
+	call v4__dscheck
+.LDS1599:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_x),%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1600
+	call v4__dscheck
+.LDS1600:
+	mov %ecx,v4__dsindex
+	call v4_aligned
+	call v4_Fetch
+	call v4_Minus_Greater
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1601
+	call v4__dscheck
+.LDS1601:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,620,.LM8751-main
+.LM8751:
+	mov $5780,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1602
+	call v4__dscheck
+.LDS1602:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1603
+	call v4__dscheck
+.LDS1603:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1604
+	call v4__dscheck
+.LDS1604:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,622,.LM8768-main
+.LM8768:
+	mov $5800,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1605
+	call v4__dscheck
+.LDS1605:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov (v4_z1st),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1606
+	call v4__dscheck
+.LDS1606:
+	mov %ecx,v4__dsindex
+	call v4_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,623,.LM8778-main
+.LM8778:
+	mov $5810,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1607
+	call v4__dscheck
+.LDS1607:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov (v4_z1st),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1608
+	call v4__dscheck
+.LDS1608:
+	mov %ecx,v4__dsindex
+	call v4_Plus_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,624,.LM8788-main
+.LM8788:
+	mov $5820,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1609
+	call v4__dscheck
+.LDS1609:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_z1st),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1610
+	call v4__dscheck
+.LDS1610:
+	mov %ecx,v4__dsindex
+	call v4_Fetch
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1611
+	call v4__dscheck
+.LDS1611:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,625,.LM8798-main
+.LM8798:
+	mov $5830,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1612
+	call v4__dscheck
+.LDS1612:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov (v4_z1st),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1613
+	call v4__dscheck
+.LDS1613:
+	mov %ecx,v4__dsindex
+	call v4_Plus_Store
+	mov (v4_z1st),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1614
+	call v4__dscheck
+.LDS1614:
+	mov %ecx,v4__dsindex
+	call v4_Fetch
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1615
+	call v4__dscheck
+.LDS1615:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,628,.LM8813-main
+.LM8813:
+	lea .LC11,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $35,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1616
+	call v4__dscheck
+.LDS1616:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,630,.LM8819-main
+.LM8819:
+	mov $5880,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1617
+	call v4__dscheck
+.LDS1617:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_bl
+	call v4_Minus_Greater
+	mov $32,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1618
+	call v4__dscheck
+.LDS1618:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,631,.LM8827-main
+.LM8827:
+	mov $5890,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1619
+	call v4__dscheck
+.LDS1619:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $88,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1620
+	call v4__dscheck
+.LDS1620:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $88,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1621
+	call v4__dscheck
+.LDS1621:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,632,.LM8836-main
+.LM8836:
+	mov $5900,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1622
+	call v4__dscheck
+.LDS1622:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $72,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1623
+	call v4__dscheck
+.LDS1623:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $72,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1624
+	call v4__dscheck
+.LDS1624:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,633,.LM8845-main
+.LM8845:
+	mov $5910,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1625
+	call v4__dscheck
+.LDS1625:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,634,.LM8850-main
+.LM8850:
+	mov $5920,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1626
+	call v4__dscheck
+.LDS1626:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,635,.LM8855-main
+.LM8855:
+	mov $5930,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1627
+	call v4__dscheck
+.LDS1627:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,633,.LM8859-main
+.LM8859:
+	mov $88,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,635,.LM8861-main
+.LM8861:
+	cmp $4080,%ecx
+	jbe .LDS1628
+	call v4__dscheck
+.LDS1628:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $88,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1629
+	call v4__dscheck
+.LDS1629:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,636,.LM8865-main
+.LM8865:
+	mov $5940,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1630
+	call v4__dscheck
+.LDS1630:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,634,.LM8869-main
+.LM8869:
+	mov $72,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,636,.LM8871-main
+.LM8871:
+	cmp $4080,%ecx
+	jbe .LDS1631
+	call v4__dscheck
+.LDS1631:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $72,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1632
+	call v4__dscheck
+.LDS1632:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,637,.LM8875-main
+.LM8875:
+	mov $5950,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1633
+	call v4__dscheck
+.LDS1633:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,638,.LM8880-main
+.LM8880:
+	mov $5960,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1634
+	call v4__dscheck
+.LDS1634:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,637,.LM8884-main
+.LM8884:
+	call v4_Leftbracket
+.stabn 68,0,633,.LM8886-main
+.LM8886:
+	mov $88,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,637,.LM8888-main
+.LM8888:
+	cmp $4080,%ecx
+	jbe .LDS1635
+	call v4__dscheck
+.LDS1635:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,638,.LM8890-main
+.LM8890:
+	call v4_Minus_Greater
+	mov $88,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1636
+	call v4__dscheck
+.LDS1636:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,639,.LM8894-main
+.LM8894:
+	mov $5970,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1637
+	call v4__dscheck
+.LDS1637:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,640,.LM8899-main
+.LM8899:
+	mov $5980,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1638
+	call v4__dscheck
+.LDS1638:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,639,.LM8903-main
+.LM8903:
+	lea .LC12,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,640,.LM8907-main
+.LM8907:
+	cmp $4080,%ecx
+	jbe .LDS1639
+	call v4__dscheck
+.LDS1639:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	call v4_drop
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1640
+	call v4__dscheck
+.LDS1640:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,641,.LM8913-main
+.LM8913:
+	mov $5990,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1641
+	call v4__dscheck
+.LDS1641:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,639,.LM8917-main
+.LM8917:
+	lea .LC12,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,641,.LM8921-main
+.LM8921:
+	cmp $4080,%ecx
+	jbe .LDS1642
+	call v4__dscheck
+.LDS1642:
+	mov %ecx,v4__dsindex
+	call v4_drop
+	call v4_dup
+	call v4_c_Fetch
+	call v4_swap
+	call v4_char_Plus
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	mov $88,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $89,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1643
+	call v4__dscheck
+.LDS1643:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,644,.LM8933-main
+.LM8933:
+	lea .LC13,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $65,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1644
+	call v4__dscheck
+.LDS1644:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,646,.LM8939-main
+.LM8939:
+	mov $6040,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1645
+	call v4__dscheck
+.LDS1645:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,647,.LM8944-main
+.LM8944:
+	mov $6050,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1646
+	call v4__dscheck
+.LDS1646:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_gt1,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1647
+	call v4__dscheck
+.LDS1647:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Minus_Greater
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1648
+	call v4__dscheck
+.LDS1648:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,648,.LM8954-main
+.LM8954:
+	mov $6060,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1649
+	call v4__dscheck
+.LDS1649:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_immediate
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,649,.LM8960-main
+.LM8960:
+	mov $6070,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1650
+	call v4__dscheck
+.LDS1650:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,648,.LM8964-main
+.LM8964:
+	lea v4_gt1,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,649,.LM8966-main
+.LM8966:
+	cmp $4080,%ecx
+	jbe .LDS1651
+	call v4__dscheck
+.LDS1651:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Minus_Greater
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1652
+	call v4__dscheck
+.LDS1652:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,666,.LM8971-main
+.LM8971:
+	mov $6240,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1653
+	call v4__dscheck
+.LDS1653:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_immediate
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,667,.LM8977-main
+.LM8977:
+	mov $6250,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1654
+	call v4__dscheck
+.LDS1654:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,666,.LM8981-main
+.LM8981:
+	call v4_state
+	call v4_Fetch
+.stabn 68,0,667,.LM8983-main
+.LM8983:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1655
+	call v4__dscheck
+.LDS1655:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,668,.LM8987-main
+.LM8987:
+	mov $6260,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1656
+	call v4__dscheck
+.LDS1656:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,669,.LM8992-main
+.LM8992:
+	mov $6270,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1657
+	call v4__dscheck
+.LDS1657:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,668,.LM8996-main
+.LM8996:
+	lea v4_gt8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1658
+	call v4__dscheck
+.LDS1658:
+	mov %ecx,v4__dsindex
+	call v4_literal
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	test %eax,%eax
+	sete %al
+	movzbl %al,%eax
+	neg %eax
+	cmp $4080,%ecx
+	jbe .LDS1659
+	call v4__dscheck
+.LDS1659:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1660
+	call v4__dscheck
+.LDS1660:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1661
+	call v4__dscheck
+.LDS1661:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,672,.LM9007-main
+.LM9007:
+	lea .LC14,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $53,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1662
+	call v4__dscheck
+.LDS1662:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,674,.LM9013-main
+.LM9013:
+	mov $6320,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1663
+	call v4__dscheck
+.LDS1663:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,675,.LM9018-main
+.LM9018:
+	mov $6330,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1664
+	call v4__dscheck
+.LDS1664:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,676,.LM9023-main
+.LM9023:
+	mov $6340,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1665
+	call v4__dscheck
+.LDS1665:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	je .L123
+	mov $123,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1666
+	call v4__dscheck
+.LDS1666:
+.L123:
+.stabn 68,0,676,.LM9034-main
+.LM9034:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,677,.LM9036-main
+.LM9036:
+	mov $6350,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1667
+	call v4__dscheck
+.LDS1667:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	je .L124
+	mov $123,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1668
+	call v4__dscheck
+.LDS1668:
+.L124:
+.stabn 68,0,677,.LM9047-main
+.LM9047:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1669
+	call v4__dscheck
+.LDS1669:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,678,.LM9051-main
+.LM9051:
+	mov $6360,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1670
+	call v4__dscheck
+.LDS1670:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	je .L125
+	mov $123,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1671
+	call v4__dscheck
+.LDS1671:
+.L125:
+.stabn 68,0,678,.LM9062-main
+.LM9062:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1672
+	call v4__dscheck
+.LDS1672:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,679,.LM9066-main
+.LM9066:
+	mov $6370,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1673
+	call v4__dscheck
+.LDS1673:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	je .L126
+	mov $123,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1674
+	call v4__dscheck
+.LDS1674:
+	jmp .L127
+.L126:
+	mov $234,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1675
+	call v4__dscheck
+.LDS1675:
+.L127:
+.stabn 68,0,679,.LM9081-main
+.LM9081:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $234,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1676
+	call v4__dscheck
+.LDS1676:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,680,.LM9085-main
+.LM9085:
+	mov $6380,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1677
+	call v4__dscheck
+.LDS1677:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	je .L128
+	mov $123,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1678
+	call v4__dscheck
+.LDS1678:
+	jmp .L129
+.L128:
+	mov $234,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1679
+	call v4__dscheck
+.LDS1679:
+.L129:
+.stabn 68,0,680,.LM9100-main
+.LM9100:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1680
+	call v4__dscheck
+.LDS1680:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,681,.LM9104-main
+.LM9104:
+	mov $6390,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1681
+	call v4__dscheck
+.LDS1681:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	je .L130
+	mov $123,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1682
+	call v4__dscheck
+.LDS1682:
+.L130:
+.stabn 68,0,681,.LM9115-main
+.LM9115:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1683
+	call v4__dscheck
+.LDS1683:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,683,.LM9119-main
+.LM9119:
+	mov $6410,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1684
+	call v4__dscheck
+.LDS1684:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,684,.LM9124-main
+.LM9124:
+	mov $6420,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1685
+	call v4__dscheck
+.LDS1685:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1686
+	call v4__dscheck
+.LDS1686:
+.L131:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS1687
+	call v4__dscheck
+.LDS1687:
+	cmp %edx,%eax
+	jge .L132
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS1688
+	call v4__dscheck
+.LDS1688:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1689
+	call v4__dscheck
+.LDS1689:
+	jmp .L131
+.L132:
+.stabn 68,0,684,.LM9147-main
+.LM9147:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $5,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1690
+	call v4__dscheck
+.LDS1690:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,685,.LM9161-main
+.LM9161:
+	mov $6430,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1691
+	call v4__dscheck
+.LDS1691:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1692
+	call v4__dscheck
+.LDS1692:
+.L133:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS1693
+	call v4__dscheck
+.LDS1693:
+	cmp %edx,%eax
+	jge .L134
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS1694
+	call v4__dscheck
+.LDS1694:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1695
+	call v4__dscheck
+.LDS1695:
+	jmp .L133
+.L134:
+.stabn 68,0,685,.LM9184-main
+.LM9184:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $5,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1696
+	call v4__dscheck
+.LDS1696:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,686,.LM9190-main
+.LM9190:
+	mov $6440,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1697
+	call v4__dscheck
+.LDS1697:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1698
+	call v4__dscheck
+.LDS1698:
+.L135:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS1699
+	call v4__dscheck
+.LDS1699:
+	cmp %edx,%eax
+	jge .L136
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS1700
+	call v4__dscheck
+.LDS1700:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1701
+	call v4__dscheck
+.LDS1701:
+	jmp .L135
+.L136:
+.stabn 68,0,686,.LM9213-main
+.LM9213:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1702
+	call v4__dscheck
+.LDS1702:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,687,.LM9217-main
+.LM9217:
+	mov $6450,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1703
+	call v4__dscheck
+.LDS1703:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1704
+	call v4__dscheck
+.LDS1704:
+.L137:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS1705
+	call v4__dscheck
+.LDS1705:
+	cmp %edx,%eax
+	jge .L138
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS1706
+	call v4__dscheck
+.LDS1706:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1707
+	call v4__dscheck
+.LDS1707:
+	jmp .L137
+.L138:
+.stabn 68,0,687,.LM9240-main
+.LM9240:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1708
+	call v4__dscheck
+.LDS1708:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,689,.LM9244-main
+.LM9244:
+	mov $6470,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1709
+	call v4__dscheck
+.LDS1709:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,690,.LM9249-main
+.LM9249:
+	mov $6480,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1710
+	call v4__dscheck
+.LDS1710:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1711
+	call v4__dscheck
+.LDS1711:
+.L139:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS1712
+	call v4__dscheck
+.LDS1712:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1713
+	call v4__dscheck
+.LDS1713:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS1714
+	call v4__dscheck
+.LDS1714:
+	cmp %edx,%eax
+	jle .L139
+.stabn 68,0,690,.LM9270-main
+.LM9270:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $5,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $6,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1715
+	call v4__dscheck
+.LDS1715:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,691,.LM9280-main
+.LM9280:
+	mov $6490,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1716
+	call v4__dscheck
+.LDS1716:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1717
+	call v4__dscheck
+.LDS1717:
+.L140:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS1718
+	call v4__dscheck
+.LDS1718:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1719
+	call v4__dscheck
+.LDS1719:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS1720
+	call v4__dscheck
+.LDS1720:
+	cmp %edx,%eax
+	jle .L140
+.stabn 68,0,691,.LM9301-main
+.LM9301:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $6,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1721
+	call v4__dscheck
+.LDS1721:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,692,.LM9307-main
+.LM9307:
+	mov $6500,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1722
+	call v4__dscheck
+.LDS1722:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1723
+	call v4__dscheck
+.LDS1723:
+.L141:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS1724
+	call v4__dscheck
+.LDS1724:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1725
+	call v4__dscheck
+.LDS1725:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $5,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS1726
+	call v4__dscheck
+.LDS1726:
+	cmp %edx,%eax
+	jle .L141
+.stabn 68,0,692,.LM9328-main
+.LM9328:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $7,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1727
+	call v4__dscheck
+.LDS1727:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,694,.LM9334-main
+.LM9334:
+	mov $6520,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1728
+	call v4__dscheck
+.LDS1728:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,695,.LM9339-main
+.LM9339:
+	mov $6530,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1729
+	call v4__dscheck
+.LDS1729:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1730
+	call v4__dscheck
+.LDS1730:
+	mov %ecx,v4__dsindex
+	call v4_gi5
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1731
+	call v4__dscheck
+.LDS1731:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,696,.LM9349-main
+.LM9349:
+	mov $6540,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1732
+	call v4__dscheck
+.LDS1732:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1733
+	call v4__dscheck
+.LDS1733:
+	mov %ecx,v4__dsindex
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1734
+	call v4__dscheck
+.LDS1734:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,697,.LM9359-main
+.LM9359:
+	mov $6550,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1735
+	call v4__dscheck
+.LDS1735:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1736
+	call v4__dscheck
+.LDS1736:
+	mov %ecx,v4__dsindex
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $5,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1737
+	call v4__dscheck
+.LDS1737:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,698,.LM9373-main
+.LM9373:
+	mov $6560,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1738
+	call v4__dscheck
+.LDS1738:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1739
+	call v4__dscheck
+.LDS1739:
+	mov %ecx,v4__dsindex
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $5,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1740
+	call v4__dscheck
+.LDS1740:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,699,.LM9385-main
+.LM9385:
+	mov $6570,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1741
+	call v4__dscheck
+.LDS1741:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1742
+	call v4__dscheck
+.LDS1742:
+	mov %ecx,v4__dsindex
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1743
+	call v4__dscheck
+.LDS1743:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,701,.LM9395-main
+.LM9395:
+	mov $6600,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1744
+	call v4__dscheck
+.LDS1744:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,702,.LM9400-main
+.LM9400:
+	mov $6610,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1745
+	call v4__dscheck
+.LDS1745:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1746
+	call v4__dscheck
+.LDS1746:
+	mov %ecx,v4__dsindex
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1747
+	call v4__dscheck
+.LDS1747:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,703,.LM9410-main
+.LM9410:
+	mov $6620,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1748
+	call v4__dscheck
+.LDS1748:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1749
+	call v4__dscheck
+.LDS1749:
+	mov %ecx,v4__dsindex
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1750
+	call v4__dscheck
+.LDS1750:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,704,.LM9422-main
+.LM9422:
+	mov $6630,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1751
+	call v4__dscheck
+.LDS1751:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1752
+	call v4__dscheck
+.LDS1752:
+	mov %ecx,v4__dsindex
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1753
+	call v4__dscheck
+.LDS1753:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,705,.LM9436-main
+.LM9436:
+	mov $6640,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1754
+	call v4__dscheck
+.LDS1754:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1755
+	call v4__dscheck
+.LDS1755:
+	mov %ecx,v4__dsindex
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1756
+	call v4__dscheck
+.LDS1756:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,706,.LM9452-main
+.LM9452:
+	mov $6650,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1757
+	call v4__dscheck
+.LDS1757:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1758
+	call v4__dscheck
+.LDS1758:
+	mov %ecx,v4__dsindex
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1759
+	call v4__dscheck
+.LDS1759:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,709,.LM9470-main
+.LM9470:
+	lea .LC15,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $43,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1760
+	call v4__dscheck
+.LDS1760:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,711,.LM9476-main
+.LM9476:
+	mov $6700,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1761
+	call v4__dscheck
+.LDS1761:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,712,.LM9481-main
+.LM9481:
+	mov $6710,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1762
+	call v4__dscheck
+.LDS1762:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1763
+	call v4__dscheck
+.LDS1763:
+	mov %ecx,v4__dsindex
+	call v4_gd1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1764
+	call v4__dscheck
+.LDS1764:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,713,.LM9497-main
+.LM9497:
+	mov $6720,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1765
+	call v4__dscheck
+.LDS1765:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1766
+	call v4__dscheck
+.LDS1766:
+	mov %ecx,v4__dsindex
+	call v4_gd1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1767
+	call v4__dscheck
+.LDS1767:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,714,.LM9513-main
+.LM9513:
+	mov $6730,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1768
+	call v4__dscheck
+.LDS1768:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1769
+	call v4__dscheck
+.LDS1769:
+	mov %ecx,v4__dsindex
+	call v4_gd1
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1770
+	call v4__dscheck
+.LDS1770:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,716,.LM9525-main
+.LM9525:
+	mov $6750,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1771
+	call v4__dscheck
+.LDS1771:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,717,.LM9530-main
+.LM9530:
+	mov $6760,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1772
+	call v4__dscheck
+.LDS1772:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1773
+	call v4__dscheck
+.LDS1773:
+	mov %ecx,v4__dsindex
+	call v4_gd2
+	call v4_Minus_Greater
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1774
+	call v4__dscheck
+.LDS1774:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,718,.LM9548-main
+.LM9548:
+	mov $6770,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1775
+	call v4__dscheck
+.LDS1775:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1776
+	call v4__dscheck
+.LDS1776:
+	mov %ecx,v4__dsindex
+	call v4_gd2
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1777
+	call v4__dscheck
+.LDS1777:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,719,.LM9566-main
+.LM9566:
+	mov $6780,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1778
+	call v4__dscheck
+.LDS1778:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1779
+	call v4__dscheck
+.LDS1779:
+	mov %ecx,v4__dsindex
+	call v4_gd2
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1780
+	call v4__dscheck
+.LDS1780:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,721,.LM9580-main
+.LM9580:
+	mov $6800,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1781
+	call v4__dscheck
+.LDS1781:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,722,.LM9585-main
+.LM9585:
+	mov $6810,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1782
+	call v4__dscheck
+.LDS1782:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1783
+	call v4__dscheck
+.LDS1783:
+	mov %ecx,v4__dsindex
+	call v4_gd3
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1784
+	call v4__dscheck
+.LDS1784:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,723,.LM9601-main
+.LM9601:
+	mov $6820,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1785
+	call v4__dscheck
+.LDS1785:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1786
+	call v4__dscheck
+.LDS1786:
+	mov %ecx,v4__dsindex
+	call v4_gd3
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1787
+	call v4__dscheck
+.LDS1787:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,724,.LM9617-main
+.LM9617:
+	mov $6830,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1788
+	call v4__dscheck
+.LDS1788:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1789
+	call v4__dscheck
+.LDS1789:
+	mov %ecx,v4__dsindex
+	call v4_gd3
+	call v4_Minus_Greater
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1790
+	call v4__dscheck
+.LDS1790:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,726,.LM9629-main
+.LM9629:
+	mov $6850,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1791
+	call v4__dscheck
+.LDS1791:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,727,.LM9634-main
+.LM9634:
+	mov $6860,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1792
+	call v4__dscheck
+.LDS1792:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1793
+	call v4__dscheck
+.LDS1793:
+	mov %ecx,v4__dsindex
+	call v4_gd4
+	call v4_Minus_Greater
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1794
+	call v4__dscheck
+.LDS1794:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,728,.LM9652-main
+.LM9652:
+	mov $6870,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1795
+	call v4__dscheck
+.LDS1795:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1796
+	call v4__dscheck
+.LDS1796:
+	mov %ecx,v4__dsindex
+	call v4_gd4
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1797
+	call v4__dscheck
+.LDS1797:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,729,.LM9670-main
+.LM9670:
+	mov $6880,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1798
+	call v4__dscheck
+.LDS1798:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-2147483648,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1799
+	call v4__dscheck
+.LDS1799:
+	mov %ecx,v4__dsindex
+	call v4_gd4
+	call v4_Minus_Greater
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2147483647,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1800
+	call v4__dscheck
+.LDS1800:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,731,.LM9684-main
+.LM9684:
+	mov $6900,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1801
+	call v4__dscheck
+.LDS1801:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,732,.LM9689-main
+.LM9689:
+	mov $6910,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1802
+	call v4__dscheck
+.LDS1802:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1803
+	call v4__dscheck
+.LDS1803:
+	mov %ecx,v4__dsindex
+	call v4_gd5
+	call v4_Minus_Greater
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1804
+	call v4__dscheck
+.LDS1804:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,733,.LM9699-main
+.LM9699:
+	mov $6920,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1805
+	call v4__dscheck
+.LDS1805:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1806
+	call v4__dscheck
+.LDS1806:
+	mov %ecx,v4__dsindex
+	call v4_gd5
+	call v4_Minus_Greater
+	mov $123,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1807
+	call v4__dscheck
+.LDS1807:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,734,.LM9709-main
+.LM9709:
+	mov $6930,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1808
+	call v4__dscheck
+.LDS1808:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1809
+	call v4__dscheck
+.LDS1809:
+	mov %ecx,v4__dsindex
+	call v4_gd5
+	call v4_Minus_Greater
+	mov $234,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1810
+	call v4__dscheck
+.LDS1810:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,736,.LM9719-main
+.LM9719:
+	mov $6950,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1811
+	call v4__dscheck
+.LDS1811:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,739,.LM9722-main
+.LM9722:
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,740,.LM9724-main
+.LM9724:
+	mov $6990,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1812
+	call v4__dscheck
+.LDS1812:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1813
+	call v4__dscheck
+.LDS1813:
+	mov %ecx,v4__dsindex
+	call v4_gd6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1814
+	call v4__dscheck
+.LDS1814:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,741,.LM9734-main
+.LM9734:
+	mov $7000,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1815
+	call v4__dscheck
+.LDS1815:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1816
+	call v4__dscheck
+.LDS1816:
+	mov %ecx,v4__dsindex
+	call v4_gd6
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1817
+	call v4__dscheck
+.LDS1817:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,742,.LM9744-main
+.LM9744:
+	mov $7010,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1818
+	call v4__dscheck
+.LDS1818:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1819
+	call v4__dscheck
+.LDS1819:
+	mov %ecx,v4__dsindex
+	call v4_gd6
+	call v4_Minus_Greater
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1820
+	call v4__dscheck
+.LDS1820:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,824,.LM9758-main
+.LM9758:
+	lea .LC16,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $53,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1821
+	call v4__dscheck
+.LDS1821:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,840,.LM9764-main
+.LM9764:
+	mov $7990,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1822
+	call v4__dscheck
+.LDS1822:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_gp1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1823
+	call v4__dscheck
+.LDS1823:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,843,.LM9772-main
+.LM9772:
+	mov $8020,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1824
+	call v4__dscheck
+.LDS1824:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_gp2
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1825
+	call v4__dscheck
+.LDS1825:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,846,.LM9780-main
+.LM9780:
+	mov $8050,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1826
+	call v4__dscheck
+.LDS1826:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_gp3
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1827
+	call v4__dscheck
+.LDS1827:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,849,.LM9788-main
+.LM9788:
+	mov $8080,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1828
+	call v4__dscheck
+.LDS1828:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,848,.LM9792-main
+.LM9792:
+	call v4_Less_Hash
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1829
+	call v4__dscheck
+.LDS1829:
+	mov %ecx,v4__dsindex
+	call v4_Hashs
+	call v4_Hash_Greater
+	lea .LC20,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1830
+	call v4__dscheck
+.LDS1830:
+	mov %ecx,v4__dsindex
+	call v4_s_Equals
+.stabn 68,0,849,.LM9804-main
+.LM9804:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1831
+	call v4__dscheck
+.LDS1831:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,851,.LM9808-main
+.LM9808:
+	mov $36,%eax
+	mov %eax,(v4_max_Minusbase)
+.stabn 68,0,854,.LM9812-main
+.LM9812:
+	call v4_count_Minusbits
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %eax,%eax
+	mov %eax,(v4_Hashbits_Minusud)
+.stabn 68,0,863,.LM9819-main
+.LM9819:
+	mov $8220,%eax
+	cmp $4080,%ecx
+	jbe .LDS1832
+	call v4__dscheck
+.LDS1832:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1833
+	call v4__dscheck
+.LDS1833:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_gp5
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1834
+	call v4__dscheck
+.LDS1834:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,876,.LM9827-main
+.LM9827:
+	mov $8330,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1835
+	call v4__dscheck
+.LDS1835:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_gp6
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1836
+	call v4__dscheck
+.LDS1836:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,912,.LM9835-main
+.LM9835:
+	mov $8690,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1837
+	call v4__dscheck
+.LDS1837:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_gp7
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1838
+	call v4__dscheck
+.LDS1838:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,924,.LM9843-main
+.LM9843:
+	mov $8800,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1839
+	call v4__dscheck
+.LDS1839:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1840
+	call v4__dscheck
+.LDS1840:
+	mov %ecx,v4__dsindex
+	call v4_Leftbracket
+	mov $48,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1841
+	call v4__dscheck
+.LDS1841:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9856-main
+.LM9856:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1842
+	call v4__dscheck
+.LDS1842:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM9860-main
+.LM9860:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,924,.LM9864-main
+.LM9864:
+	cmp $4080,%ecx
+	jbe .LDS1843
+	call v4__dscheck
+.LDS1843:
+	mov %ecx,v4__dsindex
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,920,.LM9871-main
+.LM9871:
+	lea v4_gn_Minusbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1844
+	call v4__dscheck
+.LDS1844:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,924,.LM9876-main
+.LM9876:
+	cmp $4080,%ecx
+	jbe .LDS1845
+	call v4__dscheck
+.LDS1845:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,925,.LM9877-main
+.LM9877:
+	mov $8810,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1846
+	call v4__dscheck
+.LDS1846:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1847
+	call v4__dscheck
+.LDS1847:
+	mov %ecx,v4__dsindex
+	call v4_Leftbracket
+	mov $49,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1848
+	call v4__dscheck
+.LDS1848:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9890-main
+.LM9890:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1849
+	call v4__dscheck
+.LDS1849:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM9894-main
+.LM9894:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,925,.LM9898-main
+.LM9898:
+	cmp $4080,%ecx
+	jbe .LDS1850
+	call v4__dscheck
+.LDS1850:
+	mov %ecx,v4__dsindex
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,920,.LM9905-main
+.LM9905:
+	lea v4_gn_Minusbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1851
+	call v4__dscheck
+.LDS1851:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,925,.LM9910-main
+.LM9910:
+	cmp $4080,%ecx
+	jbe .LDS1852
+	call v4__dscheck
+.LDS1852:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,926,.LM9911-main
+.LM9911:
+	mov $8820,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1853
+	call v4__dscheck
+.LDS1853:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1854
+	call v4__dscheck
+.LDS1854:
+	mov %ecx,v4__dsindex
+	call v4_Leftbracket
+	mov $49,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1855
+	call v4__dscheck
+.LDS1855:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9924-main
+.LM9924:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1856
+	call v4__dscheck
+.LDS1856:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM9928-main
+.LM9928:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,926,.LM9932-main
+.LM9932:
+	cmp $4080,%ecx
+	jbe .LDS1857
+	call v4__dscheck
+.LDS1857:
+	mov %ecx,v4__dsindex
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	call v4_base
+	call v4_Fetch
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS1858
+	call v4__dscheck
+.LDS1858:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,920,.LM9943-main
+.LM9943:
+	lea v4_gn_Minusbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1859
+	call v4__dscheck
+.LDS1859:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,926,.LM9948-main
+.LM9948:
+	cmp $4080,%ecx
+	jbe .LDS1860
+	call v4__dscheck
+.LDS1860:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,927,.LM9949-main
+.LM9949:
+	mov $8830,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1861
+	call v4__dscheck
+.LDS1861:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1862
+	call v4__dscheck
+.LDS1862:
+	mov %ecx,v4__dsindex
+	call v4_Leftbracket
+	mov $45,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1863
+	call v4__dscheck
+.LDS1863:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9962-main
+.LM9962:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1864
+	call v4__dscheck
+.LDS1864:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM9966-main
+.LM9966:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,927,.LM9970-main
+.LM9970:
+	cmp $4080,%ecx
+	jbe .LDS1865
+	call v4__dscheck
+.LDS1865:
+	mov %ecx,v4__dsindex
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,919,.LM9977-main
+.LM9977:
+	lea v4_gn_Minusbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,927,.LM9981-main
+.LM9981:
+	cmp $4080,%ecx
+	jbe .LDS1866
+	call v4__dscheck
+.LDS1866:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,928,.LM9982-main
+.LM9982:
+	mov $8840,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1867
+	call v4__dscheck
+.LDS1867:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1868
+	call v4__dscheck
+.LDS1868:
+	mov %ecx,v4__dsindex
+	call v4_Leftbracket
+	mov $43,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1869
+	call v4__dscheck
+.LDS1869:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9995-main
+.LM9995:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1870
+	call v4__dscheck
+.LDS1870:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM9999-main
+.LM9999:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,928,.LM10003-main
+.LM10003:
+	cmp $4080,%ecx
+	jbe .LDS1871
+	call v4__dscheck
+.LDS1871:
+	mov %ecx,v4__dsindex
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,919,.LM10010-main
+.LM10010:
+	lea v4_gn_Minusbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,928,.LM10014-main
+.LM10014:
+	cmp $4080,%ecx
+	jbe .LDS1872
+	call v4__dscheck
+.LDS1872:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,929,.LM10015-main
+.LM10015:
+	mov $8850,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1873
+	call v4__dscheck
+.LDS1873:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1874
+	call v4__dscheck
+.LDS1874:
+	mov %ecx,v4__dsindex
+	call v4_Leftbracket
+	mov $46,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1875
+	call v4__dscheck
+.LDS1875:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10028-main
+.LM10028:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1876
+	call v4__dscheck
+.LDS1876:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM10032-main
+.LM10032:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,929,.LM10036-main
+.LM10036:
+	cmp $4080,%ecx
+	jbe .LDS1877
+	call v4__dscheck
+.LDS1877:
+	mov %ecx,v4__dsindex
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,919,.LM10043-main
+.LM10043:
+	lea v4_gn_Minusbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,929,.LM10047-main
+.LM10047:
+	cmp $4080,%ecx
+	jbe .LDS1878
+	call v4__dscheck
+.LDS1878:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,934,.LM10048-main
+.LM10048:
+	mov $8900,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1879
+	call v4__dscheck
+.LDS1879:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1880
+	call v4__dscheck
+.LDS1880:
+	mov %ecx,v4__dsindex
+	call v4_Leftbracket
+	mov $50,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1881
+	call v4__dscheck
+.LDS1881:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10061-main
+.LM10061:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1882
+	call v4__dscheck
+.LDS1882:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM10065-main
+.LM10065:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,934,.LM10069-main
+.LM10069:
+	mov $16,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,932,.LM10072-main
+.LM10072:
+	cmp $4080,%ecx
+	jbe .LDS1883
+	call v4__dscheck
+.LDS1883:
+	mov %ecx,v4__dsindex
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,934,.LM10081-main
+.LM10081:
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,920,.LM10087-main
+.LM10087:
+	lea v4_gn_Minusbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1884
+	call v4__dscheck
+.LDS1884:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,934,.LM10092-main
+.LM10092:
+	cmp $4080,%ecx
+	jbe .LDS1885
+	call v4__dscheck
+.LDS1885:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,935,.LM10093-main
+.LM10093:
+	mov $8910,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1886
+	call v4__dscheck
+.LDS1886:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1887
+	call v4__dscheck
+.LDS1887:
+	mov %ecx,v4__dsindex
+	call v4_Leftbracket
+	mov $50,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1888
+	call v4__dscheck
+.LDS1888:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10106-main
+.LM10106:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1889
+	call v4__dscheck
+.LDS1889:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM10110-main
+.LM10110:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,935,.LM10114-main
+.LM10114:
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,932,.LM10117-main
+.LM10117:
+	cmp $4080,%ecx
+	jbe .LDS1890
+	call v4__dscheck
+.LDS1890:
+	mov %ecx,v4__dsindex
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,935,.LM10126-main
+.LM10126:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,919,.LM10132-main
+.LM10132:
+	lea v4_gn_Minusbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,935,.LM10136-main
+.LM10136:
+	cmp $4080,%ecx
+	jbe .LDS1891
+	call v4__dscheck
+.LDS1891:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,936,.LM10137-main
+.LM10137:
+	mov $8920,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1892
+	call v4__dscheck
+.LDS1892:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1893
+	call v4__dscheck
+.LDS1893:
+	mov %ecx,v4__dsindex
+	call v4_Leftbracket
+	mov $70,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1894
+	call v4__dscheck
+.LDS1894:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10150-main
+.LM10150:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1895
+	call v4__dscheck
+.LDS1895:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM10154-main
+.LM10154:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,936,.LM10158-main
+.LM10158:
+	mov $16,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,932,.LM10161-main
+.LM10161:
+	cmp $4080,%ecx
+	jbe .LDS1896
+	call v4__dscheck
+.LDS1896:
+	mov %ecx,v4__dsindex
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,936,.LM10170-main
+.LM10170:
+	call v4_Minus_Greater
+	mov $15,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,920,.LM10176-main
+.LM10176:
+	lea v4_gn_Minusbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1897
+	call v4__dscheck
+.LDS1897:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,936,.LM10181-main
+.LM10181:
+	cmp $4080,%ecx
+	jbe .LDS1898
+	call v4__dscheck
+.LDS1898:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,937,.LM10182-main
+.LM10182:
+	mov $8930,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1899
+	call v4__dscheck
+.LDS1899:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1900
+	call v4__dscheck
+.LDS1900:
+	mov %ecx,v4__dsindex
+	call v4_Leftbracket
+	mov $71,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1901
+	call v4__dscheck
+.LDS1901:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10195-main
+.LM10195:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1902
+	call v4__dscheck
+.LDS1902:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM10199-main
+.LM10199:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,937,.LM10203-main
+.LM10203:
+	mov $16,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,932,.LM10206-main
+.LM10206:
+	cmp $4080,%ecx
+	jbe .LDS1903
+	call v4__dscheck
+.LDS1903:
+	mov %ecx,v4__dsindex
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,937,.LM10215-main
+.LM10215:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,919,.LM10221-main
+.LM10221:
+	lea v4_gn_Minusbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,937,.LM10225-main
+.LM10225:
+	cmp $4080,%ecx
+	jbe .LDS1904
+	call v4__dscheck
+.LDS1904:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,938,.LM10226-main
+.LM10226:
+	mov $8940,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1905
+	call v4__dscheck
+.LDS1905:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1906
+	call v4__dscheck
+.LDS1906:
+	mov %ecx,v4__dsindex
+	call v4_Leftbracket
+	mov $71,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1907
+	call v4__dscheck
+.LDS1907:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10239-main
+.LM10239:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1908
+	call v4__dscheck
+.LDS1908:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM10243-main
+.LM10243:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,938,.LM10247-main
+.LM10247:
+	mov $36,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,932,.LM10250-main
+.LM10250:
+	cmp $4080,%ecx
+	jbe .LDS1909
+	call v4__dscheck
+.LDS1909:
+	mov %ecx,v4__dsindex
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,938,.LM10259-main
+.LM10259:
+	call v4_Minus_Greater
+	mov $16,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,920,.LM10265-main
+.LM10265:
+	lea v4_gn_Minusbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1910
+	call v4__dscheck
+.LDS1910:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,938,.LM10270-main
+.LM10270:
+	cmp $4080,%ecx
+	jbe .LDS1911
+	call v4__dscheck
+.LDS1911:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,939,.LM10271-main
+.LM10271:
+	mov $8950,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1912
+	call v4__dscheck
+.LDS1912:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1913
+	call v4__dscheck
+.LDS1913:
+	mov %ecx,v4__dsindex
+	call v4_Leftbracket
+	mov $90,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1914
+	call v4__dscheck
+.LDS1914:
+	mov %ecx,v4__dsindex
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10284-main
+.LM10284:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1915
+	call v4__dscheck
+.LDS1915:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+.stabn 68,0,919,.LM10288-main
+.LM10288:
+	lea v4_gn_Minusbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,939,.LM10292-main
+.LM10292:
+	mov $36,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,932,.LM10295-main
+.LM10295:
+	cmp $4080,%ecx
+	jbe .LDS1916
+	call v4__dscheck
+.LDS1916:
+	mov %ecx,v4__dsindex
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,939,.LM10304-main
+.LM10304:
+	call v4_Minus_Greater
+	mov $35,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,920,.LM10310-main
+.LM10310:
+	lea v4_gn_Minusbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1917
+	call v4__dscheck
+.LDS1917:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,939,.LM10315-main
+.LM10315:
+	cmp $4080,%ecx
+	jbe .LDS1918
+	call v4__dscheck
+.LDS1918:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,946,.LM10316-main
+.LM10316:
+	mov $9020,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1919
+	call v4__dscheck
+.LDS1919:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1920
+	call v4__dscheck
+.LDS1920:
+	mov %ecx,v4__dsindex
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1921
+	call v4__dscheck
+.LDS1921:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,947,.LM10334-main
+.LM10334:
+	mov $9030,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1922
+	call v4__dscheck
+.LDS1922:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1923
+	call v4__dscheck
+.LDS1923:
+	mov %ecx,v4__dsindex
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1924
+	call v4__dscheck
+.LDS1924:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,949,.LM10352-main
+.LM10352:
+	mov $9050,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1925
+	call v4__dscheck
+.LDS1925:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $36,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1926
+	call v4__dscheck
+.LDS1926:
+	mov %ecx,v4__dsindex
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1927
+	call v4__dscheck
+.LDS1927:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,950,.LM10370-main
+.LM10370:
+	mov $9060,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1928
+	call v4__dscheck
+.LDS1928:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $36,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1929
+	call v4__dscheck
+.LDS1929:
+	mov %ecx,v4__dsindex
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1930
+	call v4__dscheck
+.LDS1930:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,955,.LM10388-main
+.LM10388:
+	mov $9110,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1931
+	call v4__dscheck
+.LDS1931:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,954,.LM10392-main
+.LM10392:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_base
+	call v4_Fetch
+	call v4_decimal
+	call v4_base
+	call v4_Fetch
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,955,.LM10404-main
+.LM10404:
+	call v4_Minus_Greater
+	mov $16,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $10,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1932
+	call v4__dscheck
+.LDS1932:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,958,.LM10410-main
+.LM10410:
+	lea .LC22,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $17,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1933
+	call v4__dscheck
+.LDS1933:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,964,.LM10416-main
+.LM10416:
+	mov $18,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_sbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1934
+	call v4__dscheck
+.LDS1934:
+	mov %ecx,v4__dsindex
+	call v4_c_Store
+	mov $52,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_sbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1935
+	call v4__dscheck
+.LDS1935:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_c_Store
+	mov $86,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_sbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1936
+	call v4__dscheck
+.LDS1936:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Store
+.stabn 68,0,967,.LM10434-main
+.LM10434:
+	mov $9220,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1937
+	call v4__dscheck
+.LDS1937:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $32,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1938
+	call v4__dscheck
+.LDS1938:
+	mov %ecx,v4__dsindex
+	call v4_fill
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,968,.LM10446-main
+.LM10446:
+	mov $9230,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1939
+	call v4__dscheck
+.LDS1939:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10450-main
+.LM10450:
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1940
+	call v4__dscheck
+.LDS1940:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1941
+	call v4__dscheck
+.LDS1941:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1942
+	call v4__dscheck
+.LDS1942:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,968,.LM10462-main
+.LM10462:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1943
+	call v4__dscheck
+.LDS1943:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,970,.LM10470-main
+.LM10470:
+	mov $9250,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1944
+	call v4__dscheck
+.LDS1944:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $32,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1945
+	call v4__dscheck
+.LDS1945:
+	mov %ecx,v4__dsindex
+	call v4_fill
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,971,.LM10482-main
+.LM10482:
+	mov $9260,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1946
+	call v4__dscheck
+.LDS1946:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10486-main
+.LM10486:
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1947
+	call v4__dscheck
+.LDS1947:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1948
+	call v4__dscheck
+.LDS1948:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1949
+	call v4__dscheck
+.LDS1949:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,971,.LM10498-main
+.LM10498:
+	call v4_Minus_Greater
+	mov $32,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1950
+	call v4__dscheck
+.LDS1950:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,973,.LM10506-main
+.LM10506:
+	mov $9280,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1951
+	call v4__dscheck
+.LDS1951:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $32,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1952
+	call v4__dscheck
+.LDS1952:
+	mov %ecx,v4__dsindex
+	call v4_fill
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,974,.LM10518-main
+.LM10518:
+	mov $9290,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1953
+	call v4__dscheck
+.LDS1953:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10522-main
+.LM10522:
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1954
+	call v4__dscheck
+.LDS1954:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1955
+	call v4__dscheck
+.LDS1955:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1956
+	call v4__dscheck
+.LDS1956:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,974,.LM10534-main
+.LM10534:
+	call v4_Minus_Greater
+	mov $32,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $32,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $32,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1957
+	call v4__dscheck
+.LDS1957:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,976,.LM10542-main
+.LM10542:
+	mov $9310,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1958
+	call v4__dscheck
+.LDS1958:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_fbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1959
+	call v4__dscheck
+.LDS1959:
+	mov %ecx,v4__dsindex
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,977,.LM10555-main
+.LM10555:
+	mov $9320,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1960
+	call v4__dscheck
+.LDS1960:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10559-main
+.LM10559:
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1961
+	call v4__dscheck
+.LDS1961:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1962
+	call v4__dscheck
+.LDS1962:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1963
+	call v4__dscheck
+.LDS1963:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,977,.LM10571-main
+.LM10571:
+	call v4_Minus_Greater
+	mov $32,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $32,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $32,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1964
+	call v4__dscheck
+.LDS1964:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,979,.LM10579-main
+.LM10579:
+	mov $9340,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1965
+	call v4__dscheck
+.LDS1965:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_sbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_fbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1966
+	call v4__dscheck
+.LDS1966:
+	mov %ecx,v4__dsindex
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,980,.LM10592-main
+.LM10592:
+	mov $9350,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1967
+	call v4__dscheck
+.LDS1967:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10596-main
+.LM10596:
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1968
+	call v4__dscheck
+.LDS1968:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1969
+	call v4__dscheck
+.LDS1969:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1970
+	call v4__dscheck
+.LDS1970:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,980,.LM10608-main
+.LM10608:
+	call v4_Minus_Greater
+	mov $32,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $32,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $32,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1971
+	call v4__dscheck
+.LDS1971:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,982,.LM10616-main
+.LM10616:
+	mov $9370,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1972
+	call v4__dscheck
+.LDS1972:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_sbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_fbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1973
+	call v4__dscheck
+.LDS1973:
+	mov %ecx,v4__dsindex
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,983,.LM10629-main
+.LM10629:
+	mov $9380,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1974
+	call v4__dscheck
+.LDS1974:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10633-main
+.LM10633:
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1975
+	call v4__dscheck
+.LDS1975:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1976
+	call v4__dscheck
+.LDS1976:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1977
+	call v4__dscheck
+.LDS1977:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,983,.LM10645-main
+.LM10645:
+	call v4_Minus_Greater
+	mov $18,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $32,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $32,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1978
+	call v4__dscheck
+.LDS1978:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,985,.LM10653-main
+.LM10653:
+	mov $9400,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1979
+	call v4__dscheck
+.LDS1979:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_sbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_fbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1980
+	call v4__dscheck
+.LDS1980:
+	mov %ecx,v4__dsindex
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,986,.LM10666-main
+.LM10666:
+	mov $9410,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1981
+	call v4__dscheck
+.LDS1981:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10670-main
+.LM10670:
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1982
+	call v4__dscheck
+.LDS1982:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1983
+	call v4__dscheck
+.LDS1983:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1984
+	call v4__dscheck
+.LDS1984:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,986,.LM10682-main
+.LM10682:
+	call v4_Minus_Greater
+	mov $18,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $52,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $86,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1985
+	call v4__dscheck
+.LDS1985:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,988,.LM10690-main
+.LM10690:
+	mov $9430,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1986
+	call v4__dscheck
+.LDS1986:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_fbuf,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1987
+	call v4__dscheck
+.LDS1987:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1988
+	call v4__dscheck
+.LDS1988:
+	mov %ecx,v4__dsindex
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,989,.LM10704-main
+.LM10704:
+	mov $9440,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1989
+	call v4__dscheck
+.LDS1989:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10708-main
+.LM10708:
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1990
+	call v4__dscheck
+.LDS1990:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1991
+	call v4__dscheck
+.LDS1991:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1992
+	call v4__dscheck
+.LDS1992:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,989,.LM10720-main
+.LM10720:
+	call v4_Minus_Greater
+	mov $18,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $18,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $52,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1993
+	call v4__dscheck
+.LDS1993:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,991,.LM10728-main
+.LM10728:
+	mov $9460,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1994
+	call v4__dscheck
+.LDS1994:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1995
+	call v4__dscheck
+.LDS1995:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1996
+	call v4__dscheck
+.LDS1996:
+	mov %ecx,v4__dsindex
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,992,.LM10742-main
+.LM10742:
+	mov $9470,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1997
+	call v4__dscheck
+.LDS1997:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10746-main
+.LM10746:
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1998
+	call v4__dscheck
+.LDS1998:
+	mov %ecx,v4__dsindex
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1999
+	call v4__dscheck
+.LDS1999:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS2000
+	call v4__dscheck
+.LDS2000:
+	mov %ecx,v4__dsindex
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,992,.LM10758-main
+.LM10758:
+	call v4_Minus_Greater
+	mov $18,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $52,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $52,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS2001
+	call v4__dscheck
+.LDS2001:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,995,.LM10766-main
+.LM10766:
+	lea .LC23,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $54,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS2002
+	call v4__dscheck
+.LDS2002:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,1013,.LM10772-main
+.LM10772:
+	mov $9680,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS2003
+	call v4__dscheck
+.LDS2003:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_output_Minustest
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,1016,.LM10778-main
+.LM10778:
+	lea .LC34,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $21,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS2004
+	call v4__dscheck
+.LDS2004:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,1027,.LM10784-main
+.LM10784:
+	mov $9820,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS2005
+	call v4__dscheck
+.LDS2005:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_accept_Minustest
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,1037,.LM10790-main
+.LM10790:
+	call v4_test_Minusstatus
+	call v4_Fetch
+	pop %esi
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE1:
+.stabn 68,0,1037,.LM10794-main
+.LM10794:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe1:
+	.size	 main,.Lfe1-main
+.stabn	192,0,0,.LBB1-main
+.stabn	224,0,0,.LBE1-main
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
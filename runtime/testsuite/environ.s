@@ -0,0 +1,753 @@
+	.file	"environ.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/testsuite/",100,0,0,Ltext0
+.stabs	"environ.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC36:
+	.string "#LOCALS"
+.LC6:
+	.string "/COUNTED-STRING"
+.LC7:
+	.string "/HOLD"
+.LC8:
+	.string "/PAD"
+.LC2:
+	.string "= "
+.LC1:
+	.string "=================================="
+.LC46:
+	.string "A NONSENSE STRING"
+.LC9:
+	.string "ADDRESS-UNIT-BITS"
+.LC20:
+	.string "BLOCK"
+.LC21:
+	.string "BLOCK-EXT"
+.LC10:
+	.string "CORE"
+.LC11:
+	.string "CORE-EXT"
+.LC22:
+	.string "DOUBLE"
+.LC23:
+	.string "DOUBLE-EXT"
+.LC24:
+	.string "EXCEPTION"
+.LC25:
+	.string "EXCEPTION-EXT"
+.LC0:
+	.string "Environment as reported by system:"
+.LC26:
+	.string "FACILITY"
+.LC27:
+	.string "FACILITY-EXT"
+.LC28:
+	.string "FILE"
+.LC29:
+	.string "FILE-EXT"
+.LC30:
+	.string "FLOATING"
+.LC31:
+	.string "FLOATING-EXT"
+.LC32:
+	.string "FLOATING-STACK"
+.LC12:
+	.string "FLOORED"
+.LC34:
+	.string "LOCALS"
+.LC35:
+	.string "LOCALS-EXT"
+.LC13:
+	.string "MAX-CHAR"
+.LC14:
+	.string "MAX-D"
+.LC33:
+	.string "MAX-FLOAT"
+.LC15:
+	.string "MAX-N"
+.LC16:
+	.string "MAX-U"
+.LC17:
+	.string "MAX-UD"
+.LC37:
+	.string "MEMORY-ALLOC"
+.LC38:
+	.string "MEMORY-ALLOC-EXT"
+.LC5:
+	.string "NO "
+.LC18:
+	.string "RETURN-STACK-CELLS"
+.LC41:
+	.string "SEARCH-ORDER"
+.LC42:
+	.string "SEARCH-ORDER-EXT"
+.LC19:
+	.string "STACK-CELLS"
+.LC44:
+	.string "STRING"
+.LC45:
+	.string "STRING-EXT"
+.LC39:
+	.string "TOOLS"
+.LC40:
+	.string "TOOLS-EXT"
+.LC3:
+	.string "UNKNOWN!"
+.LC43:
+	.string "WORDLISTS"
+.LC4:
+	.string "YES "
+.text
+	.align 4
+.stabs "v4_known_Question:F1",36,0,0,v4_known_Question
+.globl v4_known_Question
+	.type	v4_known_Question,@function
+v4_known_Question:
+.stabn 68,0,17,.LMa0-v4_known_Question
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,17,.LMb0-v4_known_Question
+.LMb0:
+.LBB7:
+	call v4_z2dup
+	call v4_type
+	lea .LC2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,18,.LM8-v4_known_Question
+.LM8:
+	call v4_environment_Question
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jne .L2
+	lea .LC3,%eax
+	call v4__dpush
+	mov $8,%eax
+	call v4__dpush
+	call v4__type
+	pop %ebx
+	leave
+	jmp v4_cr
+.L2:
+.LBE7:
+.stabn 68,0,18,.LM23-v4_known_Question
+.LM23:
+	pop %ebx
+	leave
+	ret
+.Lfe7:
+	.size	 v4_known_Question,.Lfe7-v4_known_Question
+.stabn	192,0,0,.LBB7-v4_known_Question
+.stabn	224,0,0,.LBE7-v4_known_Question
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_known_Question
+.text
+	.align 4
+.stabs "v4_Dotflag:F1",36,0,0,v4_Dotflag
+.globl v4_Dotflag
+	.type	v4_Dotflag,@function
+v4_Dotflag:
+.stabn 68,0,20,.LMa24-v4_Dotflag
+.LMa24:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,20,.LMb24-v4_Dotflag
+.LMb24:
+.LBB13:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L4
+	call v4__dpop
+	test %eax,%eax
+	je .L5
+	lea .LC4,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4__type
+	jmp .L6
+.L5:
+	lea .LC5,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4__type
+.L6:
+	pop %ebx
+	leave
+	jmp v4_cr
+.L4:
+.LBE13:
+.stabn 68,0,20,.LM46-v4_Dotflag
+.LM46:
+	pop %ebx
+	leave
+	ret
+.Lfe13:
+	.size	 v4_Dotflag,.Lfe13-v4_Dotflag
+.stabn	192,0,0,.LBB13-v4_Dotflag
+.stabn	224,0,0,.LBE13-v4_Dotflag
+.Lscope13:
+.stabs	"",36,0,0,.Lscope13-v4_Dotflag
+.text
+	.align 4
+.stabs "v4_Dotnumber:F1",36,0,0,v4_Dotnumber
+.globl v4_Dotnumber
+	.type	v4_Dotnumber,@function
+v4_Dotnumber:
+.stabn 68,0,21,.LMa47-v4_Dotnumber
+.LMa47:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,21,.LMb47-v4_Dotnumber
+.LMb47:
+.LBB14:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L8
+	call v4_Dot
+	pop %ebx
+	leave
+	jmp v4_cr
+.L8:
+.LBE14:
+.stabn 68,0,21,.LM55-v4_Dotnumber
+.LM55:
+	pop %ebx
+	leave
+	ret
+.Lfe14:
+	.size	 v4_Dotnumber,.Lfe14-v4_Dotnumber
+.stabn	192,0,0,.LBB14-v4_Dotnumber
+.stabn	224,0,0,.LBE14-v4_Dotnumber
+.Lscope14:
+.stabs	"",36,0,0,.Lscope14-v4_Dotnumber
+.text
+	.align 4
+.stabs "v4_show_Minusenv:F1",36,0,0,v4_show_Minusenv
+.globl v4_show_Minusenv
+	.type	v4_show_Minusenv,@function
+v4_show_Minusenv:
+.stabn 68,0,23,.LMa56-v4_show_Minusenv
+.LMa56:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,23,.LMb56-v4_show_Minusenv
+.LMb56:
+.LBB16:
+	lea .LC6,%eax
+	call v4__dpush
+	mov $15,%eax
+	call v4__dpush
+.stabn 68,0,21,.LM62-v4_show_Minusenv
+.LM62:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L16
+	call v4_Dot
+	call v4_cr
+.L16:
+.stabn 68,0,24,.LM68-v4_show_Minusenv
+.LM68:
+	lea .LC7,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+.stabn 68,0,21,.LM73-v4_show_Minusenv
+.LM73:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L17
+	call v4_Dot
+	call v4_cr
+.L17:
+.stabn 68,0,25,.LM79-v4_show_Minusenv
+.LM79:
+	lea .LC8,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+.stabn 68,0,21,.LM84-v4_show_Minusenv
+.LM84:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L18
+	call v4_Dot
+	call v4_cr
+.L18:
+.stabn 68,0,26,.LM90-v4_show_Minusenv
+.LM90:
+	lea .LC9,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+.stabn 68,0,21,.LM95-v4_show_Minusenv
+.LM95:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L19
+	call v4_Dot
+	call v4_cr
+.L19:
+.stabn 68,0,27,.LM101-v4_show_Minusenv
+.LM101:
+	lea .LC10,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,28,.LM106-v4_show_Minusenv
+.LM106:
+	lea .LC11,%eax
+	call v4__dpush
+	mov $8,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,29,.LM111-v4_show_Minusenv
+.LM111:
+	lea .LC12,%eax
+	call v4__dpush
+	mov $7,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,30,.LM116-v4_show_Minusenv
+.LM116:
+	lea .LC13,%eax
+	call v4__dpush
+	mov $8,%eax
+	call v4__dpush
+.stabn 68,0,21,.LM121-v4_show_Minusenv
+.LM121:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L20
+	call v4_Dot
+	call v4_cr
+.L20:
+.stabn 68,0,31,.LM127-v4_show_Minusenv
+.LM127:
+	lea .LC14,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L10
+	call v4_swap
+	call v4_Dot
+	call v4_Dot
+	call v4_cr
+.L10:
+.stabn 68,0,32,.LM139-v4_show_Minusenv
+.LM139:
+	lea .LC15,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+.stabn 68,0,21,.LM144-v4_show_Minusenv
+.LM144:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L21
+	call v4_Dot
+	call v4_cr
+.L21:
+.stabn 68,0,33,.LM150-v4_show_Minusenv
+.LM150:
+	lea .LC16,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L11
+	call v4_u_Dot
+	call v4_cr
+.L11:
+.stabn 68,0,34,.LM160-v4_show_Minusenv
+.LM160:
+	lea .LC17,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L12
+	call v4_swap
+	call v4_u_Dot
+	call v4_u_Dot
+	call v4_cr
+.L12:
+.stabn 68,0,35,.LM172-v4_show_Minusenv
+.LM172:
+	lea .LC18,%eax
+	call v4__dpush
+	mov $18,%eax
+	call v4__dpush
+.stabn 68,0,21,.LM177-v4_show_Minusenv
+.LM177:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L22
+	call v4_Dot
+	call v4_cr
+.L22:
+.stabn 68,0,36,.LM183-v4_show_Minusenv
+.LM183:
+	lea .LC19,%eax
+	call v4__dpush
+	mov $11,%eax
+	call v4__dpush
+.stabn 68,0,21,.LM188-v4_show_Minusenv
+.LM188:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L23
+	call v4_Dot
+	call v4_cr
+.L23:
+.stabn 68,0,37,.LM194-v4_show_Minusenv
+.LM194:
+	lea .LC20,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,38,.LM199-v4_show_Minusenv
+.LM199:
+	lea .LC21,%eax
+	call v4__dpush
+	mov $9,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,39,.LM204-v4_show_Minusenv
+.LM204:
+	lea .LC22,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,40,.LM209-v4_show_Minusenv
+.LM209:
+	lea .LC23,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,41,.LM214-v4_show_Minusenv
+.LM214:
+	lea .LC24,%eax
+	call v4__dpush
+	mov $9,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,42,.LM219-v4_show_Minusenv
+.LM219:
+	lea .LC25,%eax
+	call v4__dpush
+	mov $13,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,43,.LM224-v4_show_Minusenv
+.LM224:
+	lea .LC26,%eax
+	call v4__dpush
+	mov $8,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,44,.LM229-v4_show_Minusenv
+.LM229:
+	lea .LC27,%eax
+	call v4__dpush
+	mov $12,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,45,.LM234-v4_show_Minusenv
+.LM234:
+	lea .LC28,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,46,.LM239-v4_show_Minusenv
+.LM239:
+	lea .LC29,%eax
+	call v4__dpush
+	mov $8,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,47,.LM244-v4_show_Minusenv
+.LM244:
+	lea .LC30,%eax
+	call v4__dpush
+	mov $8,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,48,.LM249-v4_show_Minusenv
+.LM249:
+	lea .LC31,%eax
+	call v4__dpush
+	mov $12,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,49,.LM254-v4_show_Minusenv
+.LM254:
+	lea .LC32,%eax
+	call v4__dpush
+	mov $14,%eax
+	call v4__dpush
+.stabn 68,0,21,.LM259-v4_show_Minusenv
+.LM259:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L24
+	call v4_Dot
+	call v4_cr
+.L24:
+.stabn 68,0,50,.LM265-v4_show_Minusenv
+.LM265:
+	lea .LC33,%eax
+	call v4__dpush
+	mov $9,%eax
+	call v4__dpush
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L13
+	call v4_fs_Dot
+	call v4_cr
+.L13:
+.stabn 68,0,51,.LM275-v4_show_Minusenv
+.LM275:
+	lea .LC34,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,52,.LM280-v4_show_Minusenv
+.LM280:
+	lea .LC35,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,53,.LM285-v4_show_Minusenv
+.LM285:
+	lea .LC36,%eax
+	call v4__dpush
+	mov $7,%eax
+	call v4__dpush
+.stabn 68,0,21,.LM290-v4_show_Minusenv
+.LM290:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L25
+	call v4_Dot
+	call v4_cr
+.L25:
+.stabn 68,0,54,.LM296-v4_show_Minusenv
+.LM296:
+	lea .LC37,%eax
+	call v4__dpush
+	mov $12,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,55,.LM301-v4_show_Minusenv
+.LM301:
+	lea .LC38,%eax
+	call v4__dpush
+	mov $16,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,56,.LM306-v4_show_Minusenv
+.LM306:
+	lea .LC39,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,57,.LM311-v4_show_Minusenv
+.LM311:
+	lea .LC40,%eax
+	call v4__dpush
+	mov $9,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,58,.LM316-v4_show_Minusenv
+.LM316:
+	lea .LC41,%eax
+	call v4__dpush
+	mov $12,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,59,.LM321-v4_show_Minusenv
+.LM321:
+	lea .LC42,%eax
+	call v4__dpush
+	mov $16,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,60,.LM326-v4_show_Minusenv
+.LM326:
+	lea .LC43,%eax
+	call v4__dpush
+	mov $9,%eax
+	call v4__dpush
+.stabn 68,0,21,.LM331-v4_show_Minusenv
+.LM331:
+	call v4_known_Question
+	call v4__dpop
+	test %eax,%eax
+	je .L26
+	call v4_Dot
+	call v4_cr
+.L26:
+.stabn 68,0,61,.LM337-v4_show_Minusenv
+.LM337:
+	lea .LC44,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,62,.LM342-v4_show_Minusenv
+.LM342:
+	lea .LC45,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	call v4_Dotflag
+.stabn 68,0,63,.LM347-v4_show_Minusenv
+.LM347:
+	lea .LC46,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_Dotflag
+.LBE16:
+.stabn 68,0,64,.LM353-v4_show_Minusenv
+.LM353:
+	pop %ebx
+	leave
+	ret
+.Lfe16:
+	.size	 v4_show_Minusenv,.Lfe16-v4_show_Minusenv
+.stabn	192,0,0,.LBB16-v4_show_Minusenv
+.stabn	224,0,0,.LBE16-v4_show_Minusenv
+.Lscope16:
+.stabs	"",36,0,0,.Lscope16-v4_show_Minusenv
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,8,.LMa354-main
+.LMa354:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,8,.LMb354-main
+.LMb354:
+.LBB0:
+	call v4_cr
+	lea .LC0,%eax
+	call v4__dpush
+	mov $34,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,9,.LM361-main
+.LM361:
+	call v4_cr
+	lea .LC1,%eax
+	call v4__dpush
+	mov $34,%eax
+	call v4__dpush
+	call v4__type
+.stabn 68,0,10,.LM367-main
+.LM367:
+	call v4_cr
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4__strictansi
+	call v4_Store
+.stabn 68,0,15,.LM373-main
+.LM373:
+	call v4_decimal
+.stabn 68,0,66,.LM374-main
+.LM374:
+	call v4_show_Minusenv
+	call v4_Dots
+	call v4_cr
+.stabn 68,0,69,.LM377-main
+.LM377:
+	call v4_depth
+	call v4__dpop
+	test %eax,%eax
+	jne .L14
+	xor %eax,%eax
+	call v4__dpush
+	jmp .L15
+.L14:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.L15:
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE0:
+.stabn 68,0,69,.LM392-main
+.LM392:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 main,.Lfe0-main
+.stabn	192,0,0,.LBB0-main
+.stabn	224,0,0,.LBE0-main
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,7329 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: optstk.ft
+Compiled: Sat Oct 17 11:03:13 2026
+Flags: debug stack-register optimize intermediate assembly
+
+Data:
+   150 Data_5 string[21] "TESTING CASE DISPATCH"
+    96 Data_4 string[26] "TESTING COMPARE AND BRANCH"
+    19 Data_1 string[38] "TESTING CONSTANT FOLDING AT CELL WIDTH"
+   285 Data_7 string[31] "TESTING CONSTANTS AS IMMEDIATES"
+   322 Data_8 string[16] "TESTING INLINING"
+   398 Data_11 string[40] "TESTING JUMP THREADING AND BLOCK MERGING"
+    75 Data_3 string[18] "TESTING LEAF WORDS"
+   357 Data_9 string[31] "TESTING LOOP INVARIANT HOISTING"
+   209 Data_6 string[48] "TESTING MULTIPLICATION AND DIVISION BY CONSTANTS"
+     9 Data_0 string[17] "TESTING OPTIMIZER"
+    53 Data_2 string[18] "TESTING TAIL CALLS"
+   372 Data_10 string[25] "TESTING VARIABLE ACCESSES"
+
+Symbols:
+     9 Sym_1 word "main"
+   100 Sym_77 external "v4_Equals"
+    84 Sym_71 external "v4_Fetch"
+    99 Sym_75 external "v4_Greater"
+    61 Sym_55 external "v4_Greaterr"
+   228 Sym_133 variable Cell "v4_Hashdividends"
+    38 Sym_39 external "v4_Leftbrace"
+    98 Sym_73 external "v4_Less"
+   101 Sym_79 external "v4_Less_Greater"
+    15 Sym_12 constant "v4_Lessfalse_Greater"
+    16 Sym_13 constant "v4_Lesstrue_Greater"
+    38 Sym_40 external "v4_Minus_Greater"
+    21 Sym_15 external "v4_Plus"
+   230 Sym_135 external "v4_Plus_Store"
+    38 Sym_41 external "v4_Rightbrace"
+   211 Sym_102 external "v4_Slash"
+   211 Sym_101 word "v4_Slash1"
+   218 Sym_117 word "v4_Slash10"
+   212 Sym_105 word "v4_Slash2"
+   213 Sym_107 word "v4_Slash3"
+   215 Sym_111 word "v4_Slash7"
+   216 Sym_113 word "v4_Slash8"
+   220 Sym_121 word "v4_Slash_Minus1"
+   219 Sym_119 word "v4_Slash_Minus10"
+   214 Sym_109 word "v4_Slash_Minus3"
+   217 Sym_115 word "v4_Slash_Minus8"
+    21 Sym_16 external "v4_Star"
+   221 Sym_123 word "v4_Star0"
+   221 Sym_124 word "v4_Star1"
+   222 Sym_129 word "v4_Star10"
+   221 Sym_126 word "v4_Star3"
+   222 Sym_127 word "v4_Star8"
+   221 Sym_125 word "v4_Star_Minus1"
+   222 Sym_130 word "v4_Star_Minus7"
+   222 Sym_128 word "v4_Star_Minus8"
+    10 Sym_5 external "v4_Store"
+    10 Sym_4 external "v4__strictansi"
+     9 Sym_0 external "v4__type"
+    34 Sym_31 external "v4_abs"
+    35 Sym_35 external "v4_and"
+   387 Sym_180 word "v4_around_Minuscall"
+   292 Sym_141 constant "v4_biggest"
+   364 Sym_169 word "v4_bump_Minusstep"
+   385 Sym_178 external "v4_c_Store"
+   319 Sym_150 external "v4_catch"
+   106 Sym_88 word "v4_cb0_Equals"
+   108 Sym_90 word "v4_cb0_Greater"
+   107 Sym_89 word "v4_cb0_Less"
+   100 Sym_76 word "v4_cb_Equals"
+    99 Sym_74 word "v4_cb_Greater"
+    98 Sym_72 word "v4_cb_Less"
+   109 Sym_92 word "v4_cb_Less5"
+   101 Sym_78 word "v4_cb_Less_Greater"
+   112 Sym_96 word "v4_cbflag"
+   103 Sym_82 word "v4_cbu_Greater"
+   105 Sym_86 word "v4_cbu_Greater_Equals"
+   102 Sym_80 word "v4_cbu_Less"
+   104 Sym_84 word "v4_cbu_Less_Equals"
+   111 Sym_95 word "v4_cbuntil"
+   110 Sym_93 word "v4_cbwhile"
+   379 Sym_171 variable Cell "v4_cell_Minusv"
+    24 Sym_21 external "v4_cells"
+   324 Sym_151 word "v4_clamp"
+   407 Sym_182 word "v4_count_Minusodd"
+    55 Sym_42 word "v4_countdown"
+     9 Sym_2 external "v4_cr"
+   385 Sym_177 word "v4_cstore_Minusthrough"
+   154 Sym_97 word "v4_dense"
+   231 Sym_136 word "v4_dividend"
+   230 Sym_134 word "v4_dividend_Comma"
+   227 Sym_132 variable Cell[16] "v4_dividends"
+    57 Sym_46 external "v4_drop"
+    55 Sym_43 external "v4_dup"
+    12 Sym_7 external "v4_execute"
+   334 Sym_157 word "v4_factorial"
+   386 Sym_179 word "v4_fetch_Minusthrough"
+   332 Sym_156 word "v4_find_Minusfirst"
+    21 Sym_14 word "v4_fold1"
+    35 Sym_34 word "v4_fold10"
+    36 Sym_38 word "v4_fold11"
+    22 Sym_17 word "v4_fold2"
+    23 Sym_18 word "v4_fold3"
+    24 Sym_20 word "v4_fold4"
+    29 Sym_24 word "v4_fold5"
+    30 Sym_25 word "v4_fold6"
+    32 Sym_26 word "v4_fold7"
+    33 Sym_28 word "v4_fold8"
+    34 Sym_29 word "v4_fold9"
+   381 Sym_173 word "v4_forward_Minusv"
+   160 Sym_98 word "v4_gapped"
+   330 Sym_154 word "v4_get_Minusi"
+   331 Sym_155 word "v4_get_Minusi_Minusnoinline"
+   287 Sym_139 constant "v4_hundred"
+    62 Sym_58 external "v4_i"
+    12 Sym_6 external "v4_invert"
+    80 Sym_65 external "v4_j"
+    77 Sym_60 word "v4_leaf1"
+    78 Sym_61 word "v4_leaf2"
+    84 Sym_70 word "v4_leaf_Minusfetch"
+    79 Sym_63 word "v4_leaf_Minusloop"
+    80 Sym_64 word "v4_leaf_Minusnested"
+    81 Sym_66 word "v4_leaf_Minusrs"
+    83 Sym_69 word "v4_leaf_Minusstore"
+    82 Sym_68 variable Cell "v4_leaf_Minusvar"
+    24 Sym_23 external "v4_lshift"
+    34 Sym_33 external "v4_max"
+    13 Sym_10 constant "v4_max_Minusint"
+    12 Sym_8 constant "v4_max_Minusuint"
+   411 Sym_185 word "v4_merge_Minusloop"
+    34 Sym_32 external "v4_min"
+    14 Sym_11 constant "v4_min_Minusint"
+   288 Sym_140 constant "v4_minus_Minusone"
+   232 Sym_137 word "v4_mismatches"
+   211 Sym_104 external "v4_mod"
+   211 Sym_103 word "v4_mod1"
+   218 Sym_118 word "v4_mod10"
+   212 Sym_106 word "v4_mod2"
+   213 Sym_108 word "v4_mod3"
+   215 Sym_112 word "v4_mod7"
+   216 Sym_114 word "v4_mod8"
+   220 Sym_122 word "v4_mod_Minus1"
+   219 Sym_120 word "v4_mod_Minus10"
+   214 Sym_110 word "v4_mod_Minus3"
+   217 Sym_116 word "v4_mod_Minus8"
+   223 Sym_131 word "v4_ncells"
+    34 Sym_30 external "v4_negate"
+   110 Sym_94 external "v4_nip"
+   172 Sym_100 word "v4_nodefault"
+    35 Sym_36 external "v4_or"
+    57 Sym_48 external "v4_over"
+   383 Sym_175 word "v4_overwrite_Minusv"
+   234 Sym_138 external "v4_pick"
+    81 Sym_67 external "v4_r_Fetch"
+    61 Sym_56 external "v4_r_Greater"
+   382 Sym_174 word "v4_reload_Minusv"
+   336 Sym_159 external "v4_rot"
+    13 Sym_9 external "v4_rshift"
+   380 Sym_172 word "v4_set_Minuscell_Minusv"
+   327 Sym_152 word "v4_sign"
+   166 Sym_99 word "v4_sparse"
+   409 Sym_183 word "v4_spin"
+   410 Sym_184 word "v4_spin_Minusunless"
+   362 Sym_167 variable Cell "v4_step"
+   384 Sym_176 word "v4_store_Minusthrough"
+   339 Sym_162 word "v4_sum_Minusi"
+   340 Sym_163 word "v4_sum_Minusi_Minusnoinline"
+   341 Sym_164 word "v4_sum_Minusj"
+   363 Sym_168 word "v4_sum_Minusstep"
+   365 Sym_170 word "v4_sum_Minusstep_Minus2"
+    56 Sym_45 word "v4_sumto"
+    57 Sym_47 external "v4_swap"
+    59 Sym_50 word "v4_tail1"
+    58 Sym_49 word "v4_tail2"
+    63 Sym_59 word "v4_tail_Minusexec"
+    60 Sym_52 word "v4_tail_Minusif"
+    62 Sym_57 word "v4_tail_Minusloop"
+    61 Sym_54 word "v4_tail_Minusrs"
+   424 Sym_186 external "v4_test_Minusstatus"
+   406 Sym_181 word "v4_thread_Minusforward"
+   294 Sym_142 constant "v4_three_Minushundred"
+    10 Sym_3 external "v4_true"
+   329 Sym_153 word "v4_twice"
+   103 Sym_83 external "v4_u_Greater"
+   105 Sym_87 external "v4_u_Greater_Equals"
+   102 Sym_81 external "v4_u_Less"
+   104 Sym_85 external "v4_u_Less_Equals"
+   299 Sym_146 word "v4_use_Minusbiggest"
+   336 Sym_158 word "v4_use_Minusclamp"
+   342 Sym_165 word "v4_use_Minusfind_Minusfirst"
+   297 Sym_144 word "v4_use_Minushundred"
+   302 Sym_149 word "v4_use_Minusin_Minuscase"
+   343 Sym_166 word "v4_use_Minusin_Minusloop"
+   298 Sym_145 word "v4_use_Minusminus_Minusone"
+   337 Sym_160 word "v4_use_Minussign"
+   300 Sym_147 word "v4_use_Minusthree_Minushundred"
+   338 Sym_161 word "v4_use_Minustwice"
+   301 Sym_148 word "v4_use_Minuszero"
+    35 Sym_37 external "v4_xor"
+    55 Sym_44 external "v4_z0_Equals"
+   108 Sym_91 external "v4_z0_Greater"
+    60 Sym_53 external "v4_z0_Less"
+    24 Sym_22 external "v4_z1_Minus"
+    23 Sym_19 external "v4_z1_Plus"
+    32 Sym_27 external "v4_z2_Slash"
+    59 Sym_51 external "v4_z2_Star"
+    78 Sym_62 external "v4_z2dup"
+   295 Sym_143 constant "v4_zero"
+
+Intermediate code:
+    21 function Sym_14 {
+    21   Reg_0 = 9
+           optimizes   Reg_0 = 3
+    21   Stack_D = Reg_0
+    21   no-op
+           optimizes   Reg_0 = 2
+    21   no-op
+           optimizes   Stack_D = Reg_0
+    21   no-op
+           optimizes   call Sym_15
+    21   no-op
+           optimizes   Reg_0 = 3
+    21   no-op
+           optimizes   Stack_D = Reg_0
+    21   no-op
+           optimizes   call Sym_16
+    21   no-op
+           optimizes label Label_1
+    21 }
+
+    22 function Sym_17 {
+    22   Reg_0 = 2147483647
+           optimizes   Reg_0 = -1
+    22   Stack_D = Reg_0
+    22   no-op
+           optimizes   Reg_0 = 1
+    22   no-op
+           optimizes   Stack_D = Reg_0
+    22   no-op
+           optimizes   call Sym_9
+    22   no-op
+           optimizes label Label_2
+    22 }
+
+    23 function Sym_18 {
+    23   Reg_0 = -2147483648
+           optimizes   Reg_0 = 2147483647
+    23   Stack_D = Reg_0
+    23   no-op
+           optimizes   Reg_0 = 1
+    23   no-op
+           optimizes   Stack_D = Reg_0
+    23   no-op
+           optimizes   call Sym_9
+    23   no-op
+           optimizes   call Sym_19
+    23   no-op
+           optimizes label Label_3
+    23 }
+
+    24 function Sym_20 {
+    24   Reg_0 = -2147483648
+           optimizes   Reg_0 = 1
+    24   Stack_D = Reg_0
+    24   no-op
+           optimizes   Reg_0 = 31
+    24   no-op
+           optimizes   Stack_D = Reg_0
+    24   no-op
+           optimizes   call Sym_21
+    24   no-op
+           optimizes   call Sym_22
+    24   no-op
+           optimizes   call Sym_23
+    24   no-op
+           optimizes label Label_4
+    24 }
+
+    29 function Sym_24 {
+    29   Reg_0 = -2147483648
+           optimizes   Reg_0 = 2147483647
+    29   Stack_D = Reg_0
+    29   no-op
+           optimizes   Reg_0 = 1
+    29   no-op
+           optimizes   Stack_D = Reg_0
+    29   no-op
+           optimizes   call Sym_15
+    29   no-op
+           optimizes label Label_5
+    29 }
+
+    30 function Sym_25 {
+    30   Reg_0 = 2147483647
+           optimizes   Reg_0 = -2147483648
+    30   Stack_D = Reg_0
+    30   no-op
+           optimizes   call Sym_22
+    30   no-op
+           optimizes label Label_6
+    30 }
+
+    32 function Sym_26 {
+    32   Reg_0 = -3
+           optimizes   Reg_0 = -5
+    32   Stack_D = Reg_0
+    32   no-op
+           optimizes   call Sym_27
+    32   no-op
+           optimizes label Label_7
+    32 }
+
+    33 function Sym_28 {
+    33   Reg_0 = 1
+           optimizes   Reg_0 = -1
+    33   Stack_D = Reg_0
+    33   no-op
+           optimizes   Reg_0 = 31
+    33   no-op
+           optimizes   Stack_D = Reg_0
+    33   no-op
+           optimizes   call Sym_21
+    33   no-op
+           optimizes   call Sym_22
+    33   no-op
+           optimizes   call Sym_9
+    33   no-op
+           optimizes label Label_8
+    33 }
+
+    34 function Sym_29 {
+    34   Reg_0 = 6
+           optimizes   Reg_0 = -6
+    34   Stack_D = Reg_0
+    34   no-op
+           optimizes   call Sym_30
+    34   no-op
+           optimizes   call Sym_31
+    34   Reg_0 = -4
+           optimizes   Reg_0 = 3
+    34   Stack_D = Reg_0
+    34   no-op
+           optimizes   Reg_0 = -4
+    34   no-op
+           optimizes   Stack_D = Reg_0
+    34   no-op
+           optimizes   call Sym_32
+    34   Reg_0 = 3
+           optimizes   Reg_0 = 3
+    34   Stack_D = Reg_0
+    34   no-op
+           optimizes   Reg_0 = -4
+    34   no-op
+           optimizes   Stack_D = Reg_0
+    34   no-op
+           optimizes   call Sym_33
+    34   no-op
+           optimizes label Label_9
+    34 }
+
+    35 function Sym_34 {
+    35   Reg_0 = 7
+           optimizes   Reg_0 = 13
+    35   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_6
+    35   no-op
+           optimizes   Reg_0 = 5
+    35   no-op
+           optimizes   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_35
+    35   no-op
+           optimizes   Reg_0 = 12
+    35   no-op
+           optimizes   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_36
+    35   no-op
+           optimizes   Reg_0 = 10
+    35   no-op
+           optimizes   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_37
+    35   no-op
+           optimizes label Label_10
+    35 }
+
+    36 function Sym_38 {
+    36   Reg_0 = *(Sym_8)
+    36   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    36   Reg_0 = 1
+    36   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    36   no-op
+           optimizes   call Sym_15
+    36   no-op
+           optimizes   Reg_1 = Stack_D
+    36   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    36   Reg_0 += Reg_1
+    36   Stack_D = Reg_0
+    36   no-op
+           optimizes label Label_11
+    36 }
+
+    55 function Sym_42 {
+    55 label Label_359
+    55   call Sym_43
+    55   no-op
+           optimizes   call Sym_44
+    55   Reg_0 = Stack_D
+    55   if Reg_0 != 0 goto Label_13
+    55   no-op
+           optimizes   Reg_0 = Stack_D
+    55   no-op
+           optimizes   if Reg_0 == 0 goto Label_13
+    55   goto Label_12
+    55 label Label_13
+    55   no-op
+           optimizes   call Sym_22
+    55   Reg_0 = Stack_D
+    55   Reg_0 -= 1
+    55   Stack_D = Reg_0
+    55   goto Label_359
+           optimizes   call Sym_42
+    55 label Label_12
+    55 }
+
+    56 function Sym_45 {
+    56 label Label_360
+    57   call Sym_43
+    57   no-op
+           optimizes   call Sym_44
+    57   Reg_0 = Stack_D
+    57   if Reg_0 != 0 goto Label_15
+    57   no-op
+           optimizes   Reg_0 = Stack_D
+    57   no-op
+           optimizes   if Reg_0 == 0 goto Label_15
+    57   tail call Sym_46
+           optimizes   call Sym_46
+    57   no-op
+           optimizes   goto Label_14
+    57 label Label_15
+    57   call Sym_47
+    57   call Sym_48
+    57   no-op
+           optimizes   call Sym_15
+    57   Reg_1 = Stack_D
+    57   Reg_0 = Stack_D
+    57   Reg_0 += Reg_1
+    57   Stack_D = Reg_0
+    57   call Sym_47
+    57   no-op
+           optimizes   call Sym_22
+    57   Reg_0 = Stack_D
+    57   Reg_0 -= 1
+    57   Stack_D = Reg_0
+    57   goto Label_360
+           optimizes   call Sym_45
+    57   no-op
+           optimizes label Label_14
+    57 }
+
+    58 function Sym_49 {
+    58   no-op
+           optimizes   call Sym_19
+    58   Reg_0 = Stack_D
+    58   Reg_0 += 1
+    58   Stack_D = Reg_0
+    58   no-op
+           optimizes label Label_16
+    58 }
+
+    59 function Sym_50 {
+    59   no-op
+           optimizes   call Sym_51
+    59   Reg_0 = Stack_D
+    59   Reg_0 += Reg_0
+    59   no-op
+           optimizes   Stack_D = Reg_0
+    59   no-op
+           optimizes   call Sym_49
+    58   no-op
+           optimizes   call Sym_19
+    58   no-op
+           optimizes   Reg_0 = Stack_D
+    58   Reg_0 += 1
+    58   Stack_D = Reg_0
+    59   no-op
+           optimizes label Label_17
+    59 }
+
+    60 function Sym_52 {
+    60   call Sym_43
+    60   no-op
+           optimizes   call Sym_53
+    60   Reg_0 = Stack_D
+    60   if Reg_0 >= 0 goto Label_19
+    60   no-op
+           optimizes   Reg_0 = Stack_D
+    60   no-op
+           optimizes   if Reg_0 == 0 goto Label_19
+    60   no-op
+           optimizes   call Sym_30
+    60   Reg_0 = Stack_D
+    60   Reg_0 = -Reg_0
+    60   Stack_D = Reg_0
+    60   goto Label_18
+    60 label Label_19
+    60   no-op
+           optimizes   call Sym_50
+    59   no-op
+           optimizes   call Sym_51
+    59   Reg_0 = Stack_D
+    59   Reg_0 += Reg_0
+    59   no-op
+           optimizes   Stack_D = Reg_0
+    59   no-op
+           optimizes   call Sym_49
+    58   no-op
+           optimizes   call Sym_19
+    58   no-op
+           optimizes   Reg_0 = Stack_D
+    58   Reg_0 += 1
+    58   Stack_D = Reg_0
+    60 label Label_18
+    60 }
+
+    61 function Sym_54 {
+    61   no-op
+           optimizes   call Sym_55
+    61   Reg_0 = Stack_D
+    61   Frame_0 = Reg_0
+    61   Reg_0 = 3
+    61   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    61   no-op
+           optimizes   call Sym_56
+    61   Reg_0 = Frame_0
+    61   no-op
+           optimizes   Stack_D = Reg_0
+    61   no-op
+           optimizes   call Sym_15
+    61   Reg_1 = Reg_0
+           optimizes   Reg_1 = Stack_D
+    61   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    61   Reg_0 += Reg_1
+    61   no-op
+           optimizes   Stack_D = Reg_0
+    61   no-op
+           optimizes   call Sym_49
+    58   no-op
+           optimizes   call Sym_19
+    58   no-op
+           optimizes   Reg_0 = Stack_D
+    58   Reg_0 += 1
+    58   Stack_D = Reg_0
+    61   no-op
+           optimizes label Label_20
+    61 }
+
+    62 function Sym_57 {
+    62   Reg_0 = 0
+    62   Stack_D = Reg_0
+    62   Reg_0 = 5
+    62   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    62   Reg_0 = 0
+    62   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    62   no-op
+           optimizes   Reg_1 = Stack_D
+    62   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    62   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+    62   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+    62 label Label_23
+    62   no-op
+           optimizes   call Sym_58
+    62   Reg_0 = Frame_1
+    62   no-op
+           optimizes   Stack_D = Reg_0
+    62   no-op
+           optimizes   call Sym_15
+    62   Reg_1 = Reg_0
+           optimizes   Reg_1 = Stack_D
+    62   Reg_0 = Stack_D
+    62   Reg_0 += Reg_1
+    62   Stack_D = Reg_0
+    62   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+    62   Reg_1 += 1
+    62   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+    62   no-op
+           optimizes   Frame_0 = Reg_0
+    62   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+    62   Reg_1 -= Reg_0
+    62   if Reg_1 != 0 goto Label_23
+    62   no-op
+           optimizes label Label_24
+    62   no-op
+           optimizes   Reg_0 = Frame_1
+    62   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+    62   no-op
+           optimizes label Label_22
+    62   no-op
+           optimizes   call Sym_49
+    58   no-op
+           optimizes   call Sym_19
+    58   Reg_0 = Stack_D
+    58   Reg_0 += 1
+    58   Stack_D = Reg_0
+    62   no-op
+           optimizes label Label_21
+    62 }
+
+    63 function Sym_59 {
+    63   tail call Sym_7
+           optimizes   call Sym_7
+    63   no-op
+           optimizes label Label_25
+    63 }
+
+    77 function Sym_60 {
+    77   call Sym_43
+    77   tail call Sym_16
+           optimizes   call Sym_16
+    77   no-op
+           optimizes label Label_26
+    77 }
+
+    78 function Sym_61 {
+    78   call Sym_62
+    78   no-op
+           optimizes   call Sym_15
+    78   Reg_1 = Stack_D
+    78   Reg_0 = Stack_D
+    78   Reg_0 += Reg_1
+    78   Stack_D = Reg_0
+    78   no-op
+           optimizes label Label_27
+    78 }
+
+    79 function Sym_63 {
+    79   Reg_0 = 0
+    79   Stack_D = Reg_0
+    79   Reg_0 = 10
+    79   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    79   Reg_0 = 0
+    79   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    79   no-op
+           optimizes   Reg_1 = Stack_D
+    79   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    79   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+    79   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+    79 label Label_30
+    79   no-op
+           optimizes   call Sym_58
+    79   Reg_0 = Frame_1
+    79   no-op
+           optimizes   Stack_D = Reg_0
+    79   no-op
+           optimizes   call Sym_15
+    79   Reg_1 = Reg_0
+           optimizes   Reg_1 = Stack_D
+    79   Reg_0 = Stack_D
+    79   Reg_0 += Reg_1
+    79   Stack_D = Reg_0
+    79   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+    79   Reg_1 += 1
+    79   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+    79   no-op
+           optimizes   Frame_0 = Reg_0
+    79   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+    79   Reg_1 -= Reg_0
+    79   if Reg_1 != 0 goto Label_30
+    79   no-op
+           optimizes label Label_31
+    79   no-op
+           optimizes   Reg_0 = Frame_1
+    79   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+    79   no-op
+           optimizes label Label_29
+    79   no-op
+           optimizes label Label_28
+    79 }
+
+    80 function Sym_64 {
+    80   Reg_0 = 0
+    80   Stack_D = Reg_0
+    80   Reg_0 = 3
+    80   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    80   Reg_0 = 0
+    80   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    80   no-op
+           optimizes   Reg_1 = Stack_D
+    80   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    80   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+    80   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+    80 label Label_34
+    80   Reg_0 = 4
+    80   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    80   Reg_0 = 0
+    80   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    80   no-op
+           optimizes   Reg_1 = Stack_D
+    80   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    80   Frame_2 = Reg_0
+           optimizes   Stack_R = Reg_0
+    80   Frame_3 = Reg_1
+           optimizes   Stack_R = Reg_1
+    80 label Label_37
+    80   no-op
+           optimizes   call Sym_65
+    80   Reg_0 = Frame_1
+    80   no-op
+           optimizes   Stack_D = Reg_0
+    80   no-op
+           optimizes   Reg_0 = 10
+    80   no-op
+           optimizes   Stack_D = Reg_0
+    80   no-op
+           optimizes   call Sym_16
+    80   no-op
+           optimizes   Reg_0 = Stack_D
+    80   Reg_0 *= 10
+    80   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    80   no-op
+           optimizes   call Sym_58
+    80   Reg_0 = Frame_3
+    80   no-op
+           optimizes   Stack_D = Reg_0
+    80   no-op
+           optimizes   call Sym_15
+    80   Reg_1 = Reg_0
+           optimizes   Reg_1 = Stack_D
+    80   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    80   Reg_0 += Reg_1
+    80   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    80   no-op
+           optimizes   call Sym_15
+    80   no-op
+           optimizes   Reg_1 = Stack_D
+    80   Reg_0 = Stack_D
+    80   Reg_0 += Reg_1
+    80   Stack_D = Reg_0
+    80   Reg_1 = Frame_3
+           optimizes   Reg_1 = Stack_R
+    80   Reg_1 += 1
+    80   Reg_0 = Frame_2
+           optimizes   Reg_0 = Stack_R
+    80   no-op
+           optimizes   Frame_2 = Reg_0
+    80   Frame_3 = Reg_1
+           optimizes   Stack_R = Reg_1
+    80   Reg_1 -= Reg_0
+    80   if Reg_1 != 0 goto Label_37
+    80   no-op
+           optimizes label Label_38
+    80   no-op
+           optimizes   Reg_0 = Frame_3
+    80   Reg_0 = Frame_2
+           optimizes   Reg_0 = Stack_R
+    80   no-op
+           optimizes label Label_36
+    80   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+    80   Reg_1 += 1
+    80   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+    80   no-op
+           optimizes   Frame_0 = Reg_0
+    80   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+    80   Reg_1 -= Reg_0
+    80   if Reg_1 != 0 goto Label_34
+    80   no-op
+           optimizes label Label_35
+    80   no-op
+           optimizes   Reg_0 = Frame_1
+    80   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+    80   no-op
+           optimizes label Label_33
+    80   no-op
+           optimizes label Label_32
+    80 }
+
+    81 function Sym_66 {
+    81   no-op
+           optimizes   call Sym_55
+    81   Reg_0 = Stack_D
+    81   Frame_0 = Reg_0
+    81   no-op
+           optimizes   call Sym_67
+    81   Reg_0 = Frame_0
+    81   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    81   no-op
+           optimizes   call Sym_56
+    81   Reg_0 = Frame_0
+    81   no-op
+           optimizes   Stack_D = Reg_0
+    81   no-op
+           optimizes   call Sym_15
+    81   Reg_1 = Reg_0
+           optimizes   Reg_1 = Stack_D
+    81   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    81   Reg_0 += Reg_1
+    81   Stack_D = Reg_0
+    81   no-op
+           optimizes label Label_39
+    81 }
+
+    83 function Sym_69 {
+    83   no-op
+           optimizes   Reg_0 = Sym_68
+    83   no-op
+           optimizes   Stack_D = Reg_0
+    83   no-op
+           optimizes   call Sym_5
+    83   Reg_0 = Stack_D
+    83   *(Sym_68) = Reg_0
+    83   no-op
+           optimizes label Label_40
+    83 }
+
+    84 function Sym_70 {
+    84   no-op
+           optimizes   Reg_0 = Sym_68
+    84   no-op
+           optimizes   Stack_D = Reg_0
+    84   no-op
+           optimizes   call Sym_71
+    84   Reg_0 = *(Sym_68)
+    84   Stack_D = Reg_0
+    84   no-op
+           optimizes label Label_41
+    84 }
+
+    98 function Sym_72 {
+    98   no-op
+           optimizes   call Sym_73
+    98   Reg_1 = Stack_D
+    98   Reg_0 = Stack_D
+    98   if Reg_0 >= Reg_1 goto Label_43
+    98   no-op
+           optimizes   Reg_0 = Stack_D
+    98   no-op
+           optimizes   if Reg_0 == 0 goto Label_43
+    98   Reg_0 = 1
+    98   Stack_D = Reg_0
+    98   goto Label_44
+    98 label Label_43
+    98   Reg_0 = 0
+    98   Stack_D = Reg_0
+    98 label Label_44
+    98   no-op
+           optimizes label Label_42
+    98 }
+
+    99 function Sym_74 {
+    99   no-op
+           optimizes   call Sym_75
+    99   Reg_1 = Stack_D
+    99   Reg_0 = Stack_D
+    99   if Reg_0 <= Reg_1 goto Label_46
+    99   no-op
+           optimizes   Reg_0 = Stack_D
+    99   no-op
+           optimizes   if Reg_0 == 0 goto Label_46
+    99   Reg_0 = 1
+    99   Stack_D = Reg_0
+    99   goto Label_47
+    99 label Label_46
+    99   Reg_0 = 0
+    99   Stack_D = Reg_0
+    99 label Label_47
+    99   no-op
+           optimizes label Label_45
+    99 }
+
+   100 function Sym_76 {
+   100   no-op
+           optimizes   call Sym_77
+   100   Reg_1 = Stack_D
+   100   Reg_0 = Stack_D
+   100   if Reg_0 != Reg_1 goto Label_49
+   100   no-op
+           optimizes   Reg_0 = Stack_D
+   100   no-op
+           optimizes   if Reg_0 == 0 goto Label_49
+   100   Reg_0 = 1
+   100   Stack_D = Reg_0
+   100   goto Label_50
+   100 label Label_49
+   100   Reg_0 = 0
+   100   Stack_D = Reg_0
+   100 label Label_50
+   100   no-op
+           optimizes label Label_48
+   100 }
+
+   101 function Sym_78 {
+   101   no-op
+           optimizes   call Sym_79
+   101   Reg_1 = Stack_D
+   101   Reg_0 = Stack_D
+   101   if Reg_0 == Reg_1 goto Label_52
+   101   no-op
+           optimizes   Reg_0 = Stack_D
+   101   no-op
+           optimizes   if Reg_0 == 0 goto Label_52
+   101   Reg_0 = 1
+   101   Stack_D = Reg_0
+   101   goto Label_53
+   101 label Label_52
+   101   Reg_0 = 0
+   101   Stack_D = Reg_0
+   101 label Label_53
+   101   no-op
+           optimizes label Label_51
+   101 }
+
+   102 function Sym_80 {
+   102   no-op
+           optimizes   call Sym_81
+   102   Reg_1 = Stack_D
+   102   Reg_0 = Stack_D
+   102   if Reg_0 u>= Reg_1 goto Label_55
+   102   no-op
+           optimizes   Reg_0 = Stack_D
+   102   no-op
+           optimizes   if Reg_0 == 0 goto Label_55
+   102   Reg_0 = 1
+   102   Stack_D = Reg_0
+   102   goto Label_56
+   102 label Label_55
+   102   Reg_0 = 0
+   102   Stack_D = Reg_0
+   102 label Label_56
+   102   no-op
+           optimizes label Label_54
+   102 }
+
+   103 function Sym_82 {
+   103   no-op
+           optimizes   call Sym_83
+   103   Reg_1 = Stack_D
+   103   Reg_0 = Stack_D
+   103   if Reg_0 u<= Reg_1 goto Label_58
+   103   no-op
+           optimizes   Reg_0 = Stack_D
+   103   no-op
+           optimizes   if Reg_0 == 0 goto Label_58
+   103   Reg_0 = 1
+   103   Stack_D = Reg_0
+   103   goto Label_59
+   103 label Label_58
+   103   Reg_0 = 0
+   103   Stack_D = Reg_0
+   103 label Label_59
+   103   no-op
+           optimizes label Label_57
+   103 }
+
+   104 function Sym_84 {
+   104   no-op
+           optimizes   call Sym_85
+   104   Reg_1 = Stack_D
+   104   Reg_0 = Stack_D
+   104   if Reg_0 u> Reg_1 goto Label_61
+   104   no-op
+           optimizes   Reg_0 = Stack_D
+   104   no-op
+           optimizes   if Reg_0 == 0 goto Label_61
+   104   Reg_0 = 1
+   104   Stack_D = Reg_0
+   104   goto Label_62
+   104 label Label_61
+   104   Reg_0 = 0
+   104   Stack_D = Reg_0
+   104 label Label_62
+   104   no-op
+           optimizes label Label_60
+   104 }
+
+   105 function Sym_86 {
+   105   no-op
+           optimizes   call Sym_87
+   105   Reg_1 = Stack_D
+   105   Reg_0 = Stack_D
+   105   if Reg_0 u< Reg_1 goto Label_64
+   105   no-op
+           optimizes   Reg_0 = Stack_D
+   105   no-op
+           optimizes   if Reg_0 == 0 goto Label_64
+   105   Reg_0 = 1
+   105   Stack_D = Reg_0
+   105   goto Label_65
+   105 label Label_64
+   105   Reg_0 = 0
+   105   Stack_D = Reg_0
+   105 label Label_65
+   105   no-op
+           optimizes label Label_63
+   105 }
+
+   106 function Sym_88 {
+   106   no-op
+           optimizes   call Sym_44
+   106   Reg_0 = Stack_D
+   106   if Reg_0 != 0 goto Label_67
+   106   no-op
+           optimizes   Reg_0 = Stack_D
+   106   no-op
+           optimizes   if Reg_0 == 0 goto Label_67
+   106   Reg_0 = 1
+   106   Stack_D = Reg_0
+   106   goto Label_68
+   106 label Label_67
+   106   Reg_0 = 0
+   106   Stack_D = Reg_0
+   106 label Label_68
+   106   no-op
+           optimizes label Label_66
+   106 }
+
+   107 function Sym_89 {
+   107   no-op
+           optimizes   call Sym_53
+   107   Reg_0 = Stack_D
+   107   if Reg_0 >= 0 goto Label_70
+   107   no-op
+           optimizes   Reg_0 = Stack_D
+   107   no-op
+           optimizes   if Reg_0 == 0 goto Label_70
+   107   Reg_0 = 1
+   107   Stack_D = Reg_0
+   107   goto Label_71
+   107 label Label_70
+   107   Reg_0 = 0
+   107   Stack_D = Reg_0
+   107 label Label_71
+   107   no-op
+           optimizes label Label_69
+   107 }
+
+   108 function Sym_90 {
+   108   no-op
+           optimizes   call Sym_91
+   108   Reg_0 = Stack_D
+   108   if Reg_0 <= 0 goto Label_73
+   108   no-op
+           optimizes   Reg_0 = Stack_D
+   108   no-op
+           optimizes   if Reg_0 == 0 goto Label_73
+   108   Reg_0 = 1
+   108   Stack_D = Reg_0
+   108   goto Label_74
+   108 label Label_73
+   108   Reg_0 = 0
+   108   Stack_D = Reg_0
+   108 label Label_74
+   108   no-op
+           optimizes label Label_72
+   108 }
+
+   109 function Sym_92 {
+   109   Reg_0 = 5
+   109   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   109   no-op
+           optimizes   call Sym_73
+   109   no-op
+           optimizes   Reg_1 = Stack_D
+   109   Reg_0 = Stack_D
+   109   if Reg_0 >= Reg_1 goto Label_76
+   109   no-op
+           optimizes   Reg_0 = Stack_D
+   109   no-op
+           optimizes   if Reg_0 == 0 goto Label_76
+   109   Reg_0 = 1
+   109   Stack_D = Reg_0
+   109   goto Label_77
+   109 label Label_76
+   109   Reg_0 = 0
+   109   Stack_D = Reg_0
+   109 label Label_77
+   109   no-op
+           optimizes label Label_75
+   109 }
+
+   110 function Sym_93 {
+   110   Reg_0 = 0
+   110   Stack_D = Reg_0
+   110 label Label_79
+   110   call Sym_48
+   110   no-op
+           optimizes   call Sym_91
+   110   Reg_0 = Stack_D
+   110   if Reg_0 <= 0 goto Label_80
+   110   no-op
+           optimizes   Reg_0 = Stack_D
+   110   no-op
+           optimizes   if Reg_0 == 0 goto Label_80
+   110   no-op
+           optimizes   call Sym_19
+   110   Reg_0 = Stack_D
+   110   Reg_0 += 1
+   110   Stack_D = Reg_0
+   110   call Sym_47
+   110   no-op
+           optimizes   call Sym_22
+   110   Reg_0 = Stack_D
+   110   Reg_0 -= 1
+   110   Stack_D = Reg_0
+   110   call Sym_47
+   110   goto Label_79
+   110 label Label_80
+   110   tail call Sym_94
+           optimizes   call Sym_94
+   110   no-op
+           optimizes label Label_78
+   110 }
+
+   111 function Sym_95 {
+   111   Reg_0 = 0
+   111   Stack_D = Reg_0
+   111 label Label_82
+   111   no-op
+           optimizes   call Sym_19
+   111   Reg_0 = Stack_D
+   111   Reg_0 += 1
+   111   Stack_D = Reg_0
+   111   call Sym_62
+   111   no-op
+           optimizes   call Sym_77
+   111   Reg_1 = Stack_D
+   111   Reg_0 = Stack_D
+   111   if Reg_0 != Reg_1 goto Label_82
+   111   no-op
+           optimizes   Reg_0 = Stack_D
+   111   no-op
+           optimizes   if Reg_0 == 0 goto Label_82
+   111   no-op
+           optimizes label Label_83
+   111   tail call Sym_94
+           optimizes   call Sym_94
+   111   no-op
+           optimizes label Label_81
+   111 }
+
+   112 function Sym_96 {
+   112   no-op
+           optimizes   call Sym_73
+   112   Reg_1 = Stack_D
+   112   Reg_0 = Stack_D
+   112   Reg_0 = Reg_0 < Reg_1
+   112   Stack_D = Reg_0
+   112   call Sym_43
+   112   Reg_0 = Stack_D
+   112   if Reg_0 == 0 goto Label_85
+   112   call Sym_46
+   112   Reg_0 = *(Sym_13)
+   112   Stack_D = Reg_0
+   112 label Label_85
+   112   no-op
+           optimizes label Label_84
+   112 }
+
+   154 function Sym_97 {
+   156   no-op
+           optimizes   Reg_0 = 0
+   156   no-op
+           optimizes   Reg_1 = Reg_0
+   156   no-op
+           optimizes   Reg_1 = Stack_D
+   156   Reg_0 = Stack_D
+   156   Stack_D = Reg_0
+   156   switch Reg_0 - 0 goto Label_361, Label_362, Label_363, Label_364, Label_365, Label_366 else Label_93
+   156 label Label_361
+           optimizes   if Reg_0 != Reg_1 goto Label_88
+   156   Reg_0 = 10
+   156   Stack_D = Reg_0
+   156   call Sym_47
+   156   goto Label_87
+   156 label Label_88
+   156   no-op
+           optimizes   Reg_0 = 1
+   156   no-op
+           optimizes   Reg_1 = Reg_0
+   156   no-op
+           optimizes   Reg_1 = Stack_D
+   156   no-op
+           optimizes   Reg_0 = Stack_D
+   156   no-op
+           optimizes   Stack_D = Reg_0
+   156 label Label_362
+           optimizes   if Reg_0 != Reg_1 goto Label_89
+   156   Reg_0 = 11
+   156   Stack_D = Reg_0
+   156   call Sym_47
+   156   goto Label_87
+   156 label Label_89
+   156   no-op
+           optimizes   Reg_0 = 2
+   156   no-op
+           optimizes   Reg_1 = Reg_0
+   156   no-op
+           optimizes   Reg_1 = Stack_D
+   156   no-op
+           optimizes   Reg_0 = Stack_D
+   156   no-op
+           optimizes   Stack_D = Reg_0
+   156 label Label_363
+           optimizes   if Reg_0 != Reg_1 goto Label_90
+   156   Reg_0 = 12
+   156   Stack_D = Reg_0
+   156   call Sym_47
+   156   goto Label_87
+   156 label Label_90
+   157   no-op
+           optimizes   Reg_0 = 3
+   157   no-op
+           optimizes   Reg_1 = Reg_0
+   157   no-op
+           optimizes   Reg_1 = Stack_D
+   157   no-op
+           optimizes   Reg_0 = Stack_D
+   157   no-op
+           optimizes   Stack_D = Reg_0
+   157 label Label_364
+           optimizes   if Reg_0 != Reg_1 goto Label_91
+   157   Reg_0 = 13
+   157   Stack_D = Reg_0
+   157   call Sym_47
+   157   goto Label_87
+   157 label Label_91
+   157   no-op
+           optimizes   Reg_0 = 4
+   157   no-op
+           optimizes   Reg_1 = Reg_0
+   157   no-op
+           optimizes   Reg_1 = Stack_D
+   157   no-op
+           optimizes   Reg_0 = Stack_D
+   157   no-op
+           optimizes   Stack_D = Reg_0
+   157 label Label_365
+           optimizes   if Reg_0 != Reg_1 goto Label_92
+   157   Reg_0 = 14
+   157   Stack_D = Reg_0
+   157   call Sym_47
+   157   goto Label_87
+   157 label Label_92
+   157   no-op
+           optimizes   Reg_0 = 5
+   157   no-op
+           optimizes   Reg_1 = Reg_0
+   157   no-op
+           optimizes   Reg_1 = Stack_D
+   157   no-op
+           optimizes   Reg_0 = Stack_D
+   157   no-op
+           optimizes   Stack_D = Reg_0
+   157 label Label_366
+           optimizes   if Reg_0 != Reg_1 goto Label_93
+   157   Reg_0 = 15
+   157   Stack_D = Reg_0
+   157   call Sym_47
+   157   goto Label_87
+   157 label Label_93
+   158   call Sym_43
+   158   Reg_0 = 100
+   158   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   158   no-op
+           optimizes   call Sym_15
+   158   no-op
+           optimizes   Reg_1 = Stack_D
+   158   Reg_0 = Stack_D
+   158   Reg_0 += Reg_1
+   158   Stack_D = Reg_0
+   158   call Sym_47
+   159 label Label_87
+   159   Reg_0 = Stack_D
+   159   no-op
+           optimizes label Label_86
+   159 }
+
+   160 function Sym_98 {
+   162   no-op
+           optimizes   Reg_0 = -2
+   162   no-op
+           optimizes   Reg_1 = Reg_0
+   162   no-op
+           optimizes   Reg_1 = Stack_D
+   162   Reg_0 = Stack_D
+   162   Stack_D = Reg_0
+   162   switch Reg_0 - -2 goto Label_367, Label_368, Label_369, Label_100, Label_370, Label_371 else Label_100
+   162 label Label_367
+           optimizes   if Reg_0 != Reg_1 goto Label_96
+   162   Reg_0 = 1
+   162   Stack_D = Reg_0
+   162   call Sym_47
+   162   goto Label_95
+   162 label Label_96
+   162   no-op
+           optimizes   Reg_0 = -1
+   162   no-op
+           optimizes   Reg_1 = Reg_0
+   162   no-op
+           optimizes   Reg_1 = Stack_D
+   162   no-op
+           optimizes   Reg_0 = Stack_D
+   162   no-op
+           optimizes   Stack_D = Reg_0
+   162 label Label_368
+           optimizes   if Reg_0 != Reg_1 goto Label_97
+   162   Reg_0 = 2
+   162   Stack_D = Reg_0
+   162   call Sym_47
+   162   goto Label_95
+   162 label Label_97
+   162   no-op
+           optimizes   Reg_0 = 0
+   162   no-op
+           optimizes   Reg_1 = Reg_0
+   162   no-op
+           optimizes   Reg_1 = Stack_D
+   162   no-op
+           optimizes   Reg_0 = Stack_D
+   162   no-op
+           optimizes   Stack_D = Reg_0
+   162 label Label_369
+           optimizes   if Reg_0 != Reg_1 goto Label_98
+   162   Reg_0 = 3
+   162   Stack_D = Reg_0
+   162   call Sym_47
+   162   goto Label_95
+   162 label Label_98
+   163   no-op
+           optimizes   Reg_0 = 2
+   163   no-op
+           optimizes   Reg_1 = Reg_0
+   163   no-op
+           optimizes   Reg_1 = Stack_D
+   163   no-op
+           optimizes   Reg_0 = Stack_D
+   163   no-op
+           optimizes   Stack_D = Reg_0
+   163 label Label_370
+           optimizes   if Reg_0 != Reg_1 goto Label_99
+   163   Reg_0 = 4
+   163   Stack_D = Reg_0
+   163   call Sym_47
+   163   goto Label_95
+   163 label Label_99
+   163   no-op
+           optimizes   Reg_0 = 3
+   163   no-op
+           optimizes   Reg_1 = Reg_0
+   163   no-op
+           optimizes   Reg_1 = Stack_D
+   163   no-op
+           optimizes   Reg_0 = Stack_D
+   163   no-op
+           optimizes   Stack_D = Reg_0
+   163 label Label_371
+           optimizes   if Reg_0 != Reg_1 goto Label_100
+   163   Reg_0 = 5
+   163   Stack_D = Reg_0
+   163   call Sym_47
+   163   goto Label_95
+   163 label Label_100
+   164   Reg_0 = 0
+   164   Stack_D = Reg_0
+   164   call Sym_47
+   165 label Label_95
+   165   Reg_0 = Stack_D
+   165   no-op
+           optimizes label Label_94
+   165 }
+
+   166 function Sym_99 {
+   168   no-op
+           optimizes   Reg_0 = -1000
+   168   no-op
+           optimizes   Reg_1 = Reg_0
+   168   no-op
+           optimizes   Reg_1 = Stack_D
+   168   Reg_0 = Stack_D
+   168   Stack_D = Reg_0
+   168   Reg_1 = 100
+   168   if Reg_0 < Reg_1 goto Label_378
+   168   Reg_1 = 100
+   168   if Reg_0 == Reg_1 goto Label_375
+   168   Reg_1 = 1000
+   168   if Reg_0 == Reg_1 goto Label_376
+   168   Reg_1 = 65536
+   168   if Reg_0 == Reg_1 goto Label_377
+   168   goto Label_108
+   168 label Label_378
+   168   Reg_1 = -1000
+   168   if Reg_0 == Reg_1 goto Label_372
+   168   Reg_1 = -1
+   168   if Reg_0 == Reg_1 goto Label_373
+   168   Reg_1 = 7
+   168   if Reg_0 == Reg_1 goto Label_374
+   168   goto Label_108
+   168 label Label_372
+           optimizes   if Reg_0 != Reg_1 goto Label_103
+   168   Reg_0 = 1
+   168   Stack_D = Reg_0
+   168   call Sym_47
+   168   goto Label_102
+   168 label Label_103
+   168   no-op
+           optimizes   Reg_0 = -1
+   168   no-op
+           optimizes   Reg_1 = Reg_0
+   168   no-op
+           optimizes   Reg_1 = Stack_D
+   168   no-op
+           optimizes   Reg_0 = Stack_D
+   168   no-op
+           optimizes   Stack_D = Reg_0
+   168 label Label_373
+           optimizes   if Reg_0 != Reg_1 goto Label_104
+   168   Reg_0 = 2
+   168   Stack_D = Reg_0
+   168   call Sym_47
+   168   goto Label_102
+   168 label Label_104
+   168   no-op
+           optimizes   Reg_0 = 7
+   168   no-op
+           optimizes   Reg_1 = Reg_0
+   168   no-op
+           optimizes   Reg_1 = Stack_D
+   168   no-op
+           optimizes   Reg_0 = Stack_D
+   168   no-op
+           optimizes   Stack_D = Reg_0
+   168 label Label_374
+           optimizes   if Reg_0 != Reg_1 goto Label_105
+   168   Reg_0 = 3
+   168   Stack_D = Reg_0
+   168   call Sym_47
+   168   goto Label_102
+   168 label Label_105
+   169   no-op
+           optimizes   Reg_0 = 100
+   169   no-op
+           optimizes   Reg_1 = Reg_0
+   169   no-op
+           optimizes   Reg_1 = Stack_D
+   169   no-op
+           optimizes   Reg_0 = Stack_D
+   169   no-op
+           optimizes   Stack_D = Reg_0
+   169 label Label_375
+           optimizes   if Reg_0 != Reg_1 goto Label_106
+   169   Reg_0 = 4
+   169   Stack_D = Reg_0
+   169   call Sym_47
+   169   goto Label_102
+   169 label Label_106
+   169   no-op
+           optimizes   Reg_0 = 1000
+   169   no-op
+           optimizes   Reg_1 = Reg_0
+   169   no-op
+           optimizes   Reg_1 = Stack_D
+   169   no-op
+           optimizes   Reg_0 = Stack_D
+   169   no-op
+           optimizes   Stack_D = Reg_0
+   169 label Label_376
+           optimizes   if Reg_0 != Reg_1 goto Label_107
+   169   Reg_0 = 5
+   169   Stack_D = Reg_0
+   169   call Sym_47
+   169   goto Label_102
+   169 label Label_107
+   169   no-op
+           optimizes   Reg_0 = 65536
+   169   no-op
+           optimizes   Reg_1 = Reg_0
+   169   no-op
+           optimizes   Reg_1 = Stack_D
+   169   no-op
+           optimizes   Reg_0 = Stack_D
+   169   no-op
+           optimizes   Stack_D = Reg_0
+   169 label Label_377
+           optimizes   if Reg_0 != Reg_1 goto Label_108
+   169   Reg_0 = 6
+   169   Stack_D = Reg_0
+   169   call Sym_47
+   169   goto Label_102
+   169 label Label_108
+   170   Reg_0 = 0
+   170   Stack_D = Reg_0
+   170   call Sym_47
+   171 label Label_102
+   171   Reg_0 = Stack_D
+   171   no-op
+           optimizes label Label_101
+   171 }
+
+   172 function Sym_100 {
+   174   no-op
+           optimizes   Reg_0 = 1
+   174   no-op
+           optimizes   Reg_1 = Reg_0
+   174   no-op
+           optimizes   Reg_1 = Stack_D
+   174   Reg_0 = Stack_D
+   174   Stack_D = Reg_0
+   174   switch Reg_0 - 1 goto Label_379, Label_380, Label_381, Label_382 else Label_114
+   174 label Label_379
+           optimizes   if Reg_0 != Reg_1 goto Label_111
+   174   Reg_0 = 1
+   174   Stack_D = Reg_0
+   174   call Sym_47
+   174   goto Label_110
+   174 label Label_111
+   174   no-op
+           optimizes   Reg_0 = 2
+   174   no-op
+           optimizes   Reg_1 = Reg_0
+   174   no-op
+           optimizes   Reg_1 = Stack_D
+   174   no-op
+           optimizes   Reg_0 = Stack_D
+   174   no-op
+           optimizes   Stack_D = Reg_0
+   174 label Label_380
+           optimizes   if Reg_0 != Reg_1 goto Label_112
+   174   Reg_0 = 2
+   174   Stack_D = Reg_0
+   174   call Sym_47
+   174   goto Label_110
+   174 label Label_112
+   175   no-op
+           optimizes   Reg_0 = 3
+   175   no-op
+           optimizes   Reg_1 = Reg_0
+   175   no-op
+           optimizes   Reg_1 = Stack_D
+   175   no-op
+           optimizes   Reg_0 = Stack_D
+   175   no-op
+           optimizes   Stack_D = Reg_0
+   175 label Label_381
+           optimizes   if Reg_0 != Reg_1 goto Label_113
+   175   Reg_0 = 3
+   175   Stack_D = Reg_0
+   175   call Sym_47
+   175   goto Label_110
+   175 label Label_113
+   175   no-op
+           optimizes   Reg_0 = 4
+   175   no-op
+           optimizes   Reg_1 = Reg_0
+   175   no-op
+           optimizes   Reg_1 = Stack_D
+   175   no-op
+           optimizes   Reg_0 = Stack_D
+   175   no-op
+           optimizes   Stack_D = Reg_0
+   175 label Label_382
+           optimizes   if Reg_0 != Reg_1 goto Label_114
+   175   Reg_0 = 4
+   175   Stack_D = Reg_0
+   175   call Sym_47
+   175   goto Label_110
+   175 label Label_114
+   176 label Label_110
+   176   Reg_0 = Stack_D
+   176   no-op
+           optimizes label Label_109
+   176 }
+
+   211 function Sym_101 {
+   211   no-op
+           optimizes   Reg_0 = 1
+   211   no-op
+           optimizes   Stack_D = Reg_0
+   211   no-op
+           optimizes   call Sym_102
+   211   Reg_0 = Stack_D
+   211   Reg_0 /= 1
+   211   Stack_D = Reg_0
+   211   no-op
+           optimizes label Label_115
+   211 }
+
+   211 function Sym_103 {
+   211   no-op
+           optimizes   Reg_0 = 1
+   211   no-op
+           optimizes   Stack_D = Reg_0
+   211   no-op
+           optimizes   call Sym_104
+   211   Reg_0 = Stack_D
+   211   Reg_0 %= 1
+   211   Stack_D = Reg_0
+   211   no-op
+           optimizes label Label_116
+   211 }
+
+   212 function Sym_105 {
+   212   no-op
+           optimizes   Reg_0 = 2
+   212   no-op
+           optimizes   Stack_D = Reg_0
+   212   no-op
+           optimizes   call Sym_102
+   212   Reg_0 = Stack_D
+   212   Reg_0 /= 2
+   212   Stack_D = Reg_0
+   212   no-op
+           optimizes label Label_117
+   212 }
+
+   212 function Sym_106 {
+   212   no-op
+           optimizes   Reg_0 = 2
+   212   no-op
+           optimizes   Stack_D = Reg_0
+   212   no-op
+           optimizes   call Sym_104
+   212   Reg_0 = Stack_D
+   212   Reg_0 %= 2
+   212   Stack_D = Reg_0
+   212   no-op
+           optimizes label Label_118
+   212 }
+
+   213 function Sym_107 {
+   213   no-op
+           optimizes   Reg_0 = 3
+   213   no-op
+           optimizes   Stack_D = Reg_0
+   213   no-op
+           optimizes   call Sym_102
+   213   Reg_0 = Stack_D
+   213   Reg_0 /= 3
+   213   Stack_D = Reg_0
+   213   no-op
+           optimizes label Label_119
+   213 }
+
+   213 function Sym_108 {
+   213   no-op
+           optimizes   Reg_0 = 3
+   213   no-op
+           optimizes   Stack_D = Reg_0
+   213   no-op
+           optimizes   call Sym_104
+   213   Reg_0 = Stack_D
+   213   Reg_0 %= 3
+   213   Stack_D = Reg_0
+   213   no-op
+           optimizes label Label_120
+   213 }
+
+   214 function Sym_109 {
+   214   no-op
+           optimizes   Reg_0 = -3
+   214   no-op
+           optimizes   Stack_D = Reg_0
+   214   no-op
+           optimizes   call Sym_102
+   214   Reg_0 = Stack_D
+   214   Reg_0 /= -3
+   214   Stack_D = Reg_0
+   214   no-op
+           optimizes label Label_121
+   214 }
+
+   214 function Sym_110 {
+   214   no-op
+           optimizes   Reg_0 = -3
+   214   no-op
+           optimizes   Stack_D = Reg_0
+   214   no-op
+           optimizes   call Sym_104
+   214   Reg_0 = Stack_D
+   214   Reg_0 %= -3
+   214   Stack_D = Reg_0
+   214   no-op
+           optimizes label Label_122
+   214 }
+
+   215 function Sym_111 {
+   215   no-op
+           optimizes   Reg_0 = 7
+   215   no-op
+           optimizes   Stack_D = Reg_0
+   215   no-op
+           optimizes   call Sym_102
+   215   Reg_0 = Stack_D
+   215   Reg_0 /= 7
+   215   Stack_D = Reg_0
+   215   no-op
+           optimizes label Label_123
+   215 }
+
+   215 function Sym_112 {
+   215   no-op
+           optimizes   Reg_0 = 7
+   215   no-op
+           optimizes   Stack_D = Reg_0
+   215   no-op
+           optimizes   call Sym_104
+   215   Reg_0 = Stack_D
+   215   Reg_0 %= 7
+   215   Stack_D = Reg_0
+   215   no-op
+           optimizes label Label_124
+   215 }
+
+   216 function Sym_113 {
+   216   no-op
+           optimizes   Reg_0 = 8
+   216   no-op
+           optimizes   Stack_D = Reg_0
+   216   no-op
+           optimizes   call Sym_102
+   216   Reg_0 = Stack_D
+   216   Reg_0 /= 8
+   216   Stack_D = Reg_0
+   216   no-op
+           optimizes label Label_125
+   216 }
+
+   216 function Sym_114 {
+   216   no-op
+           optimizes   Reg_0 = 8
+   216   no-op
+           optimizes   Stack_D = Reg_0
+   216   no-op
+           optimizes   call Sym_104
+   216   Reg_0 = Stack_D
+   216   Reg_0 %= 8
+   216   Stack_D = Reg_0
+   216   no-op
+           optimizes label Label_126
+   216 }
+
+   217 function Sym_115 {
+   217   no-op
+           optimizes   Reg_0 = -8
+   217   no-op
+           optimizes   Stack_D = Reg_0
+   217   no-op
+           optimizes   call Sym_102
+   217   Reg_0 = Stack_D
+   217   Reg_0 /= -8
+   217   Stack_D = Reg_0
+   217   no-op
+           optimizes label Label_127
+   217 }
+
+   217 function Sym_116 {
+   217   no-op
+           optimizes   Reg_0 = -8
+   217   no-op
+           optimizes   Stack_D = Reg_0
+   217   no-op
+           optimizes   call Sym_104
+   217   Reg_0 = Stack_D
+   217   Reg_0 %= -8
+   217   Stack_D = Reg_0
+   217   no-op
+           optimizes label Label_128
+   217 }
+
+   218 function Sym_117 {
+   218   no-op
+           optimizes   Reg_0 = 10
+   218   no-op
+           optimizes   Stack_D = Reg_0
+   218   no-op
+           optimizes   call Sym_102
+   218   Reg_0 = Stack_D
+   218   Reg_0 /= 10
+   218   Stack_D = Reg_0
+   218   no-op
+           optimizes label Label_129
+   218 }
+
+   218 function Sym_118 {
+   218   no-op
+           optimizes   Reg_0 = 10
+   218   no-op
+           optimizes   Stack_D = Reg_0
+   218   no-op
+           optimizes   call Sym_104
+   218   Reg_0 = Stack_D
+   218   Reg_0 %= 10
+   218   Stack_D = Reg_0
+   218   no-op
+           optimizes label Label_130
+   218 }
+
+   219 function Sym_119 {
+   219   no-op
+           optimizes   Reg_0 = -10
+   219   no-op
+           optimizes   Stack_D = Reg_0
+   219   no-op
+           optimizes   call Sym_102
+   219   Reg_0 = Stack_D
+   219   Reg_0 /= -10
+   219   Stack_D = Reg_0
+   219   no-op
+           optimizes label Label_131
+   219 }
+
+   219 function Sym_120 {
+   219   no-op
+           optimizes   Reg_0 = -10
+   219   no-op
+           optimizes   Stack_D = Reg_0
+   219   no-op
+           optimizes   call Sym_104
+   219   Reg_0 = Stack_D
+   219   Reg_0 %= -10
+   219   Stack_D = Reg_0
+   219   no-op
+           optimizes label Label_132
+   219 }
+
+   220 function Sym_121 {
+   220   Reg_0 = -1
+   220   Stack_D = Reg_0
+   220   tail call Sym_102
+           optimizes   call Sym_102
+   220   no-op
+           optimizes label Label_133
+   220 }
+
+   220 function Sym_122 {
+   220   Reg_0 = -1
+   220   Stack_D = Reg_0
+   220   tail call Sym_104
+           optimizes   call Sym_104
+   220   no-op
+           optimizes label Label_134
+   220 }
+
+   221 function Sym_123 {
+   221   no-op
+           optimizes   Reg_0 = 0
+   221   no-op
+           optimizes   Stack_D = Reg_0
+   221   no-op
+           optimizes   call Sym_16
+   221   Reg_0 = Stack_D
+   221   Reg_0 *= 0
+   221   Stack_D = Reg_0
+   221   no-op
+           optimizes label Label_135
+   221 }
+
+   221 function Sym_124 {
+   221   no-op
+           optimizes   Reg_0 = 1
+   221   no-op
+           optimizes   Stack_D = Reg_0
+   221   no-op
+           optimizes   call Sym_16
+   221   Reg_0 = Stack_D
+   221   Reg_0 *= 1
+   221   Stack_D = Reg_0
+   221   no-op
+           optimizes label Label_136
+   221 }
+
+   221 function Sym_125 {
+   221   no-op
+           optimizes   Reg_0 = -1
+   221   no-op
+           optimizes   Stack_D = Reg_0
+   221   no-op
+           optimizes   call Sym_16
+   221   Reg_0 = Stack_D
+   221   Reg_0 *= -1
+   221   Stack_D = Reg_0
+   221   no-op
+           optimizes label Label_137
+   221 }
+
+   221 function Sym_126 {
+   221   no-op
+           optimizes   Reg_0 = 3
+   221   no-op
+           optimizes   Stack_D = Reg_0
+   221   no-op
+           optimizes   call Sym_16
+   221   Reg_0 = Stack_D
+   221   Reg_0 *= 3
+   221   Stack_D = Reg_0
+   221   no-op
+           optimizes label Label_138
+   221 }
+
+   222 function Sym_127 {
+   222   no-op
+           optimizes   Reg_0 = 8
+   222   no-op
+           optimizes   Stack_D = Reg_0
+   222   no-op
+           optimizes   call Sym_16
+   222   Reg_0 = Stack_D
+   222   Reg_0 *= 8
+   222   Stack_D = Reg_0
+   222   no-op
+           optimizes label Label_139
+   222 }
+
+   222 function Sym_128 {
+   222   no-op
+           optimizes   Reg_0 = -8
+   222   no-op
+           optimizes   Stack_D = Reg_0
+   222   no-op
+           optimizes   call Sym_16
+   222   Reg_0 = Stack_D
+   222   Reg_0 *= -8
+   222   Stack_D = Reg_0
+   222   no-op
+           optimizes label Label_140
+   222 }
+
+   222 function Sym_129 {
+   222   no-op
+           optimizes   Reg_0 = 10
+   222   no-op
+           optimizes   Stack_D = Reg_0
+   222   no-op
+           optimizes   call Sym_16
+   222   Reg_0 = Stack_D
+   222   Reg_0 *= 10
+   222   Stack_D = Reg_0
+   222   no-op
+           optimizes label Label_141
+   222 }
+
+   222 function Sym_130 {
+   222   no-op
+           optimizes   Reg_0 = -7
+   222   no-op
+           optimizes   Stack_D = Reg_0
+   222   no-op
+           optimizes   call Sym_16
+   222   Reg_0 = Stack_D
+   222   Reg_0 *= -7
+   222   Stack_D = Reg_0
+   222   no-op
+           optimizes label Label_142
+   222 }
+
+   223 function Sym_131 {
+   223   no-op
+           optimizes   call Sym_21
+   223   Reg_0 = Stack_D
+   223   Reg_0 *= 4
+   223   Stack_D = Reg_0
+   223   no-op
+           optimizes label Label_143
+   223 }
+
+   230 function Sym_134 {
+   230   Reg_0 = Sym_132
+   230   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   230   no-op
+           optimizes   Reg_0 = Sym_133
+   230   no-op
+           optimizes   Stack_D = Reg_0
+   230   no-op
+           optimizes   call Sym_71
+   230   Reg_0 = *(Sym_133)
+   230   no-op
+           optimizes   Stack_D = Reg_0
+   230   no-op
+           optimizes   call Sym_21
+   230   no-op
+           optimizes   Reg_0 = Stack_D
+   230   Reg_0 *= 4
+   230   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   230   no-op
+           optimizes   call Sym_15
+   230   no-op
+           optimizes   Reg_1 = Stack_D
+   230   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   230   Reg_0 += Reg_1
+   230   Stack_D = Reg_0
+   230   call Sym_5
+   230   Reg_0 = 1
+   230   no-op
+           optimizes   Stack_D = Reg_0
+   230   no-op
+           optimizes   Reg_0 = Sym_133
+   230   no-op
+           optimizes   Stack_D = Reg_0
+   230   no-op
+           optimizes   call Sym_135
+   230   no-op
+           optimizes   Reg_0 = Stack_D
+   230   Reg_1 = *(Sym_133)
+   230   Reg_0 += Reg_1
+   230   *(Sym_133) = Reg_0
+   230   no-op
+           optimizes label Label_144
+   230 }
+
+   231 function Sym_136 {
+   231   no-op
+           optimizes   call Sym_21
+   231   Reg_0 = Stack_D
+   231   Reg_0 *= 4
+   231   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   231   Reg_0 = Sym_132
+   231   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   231   no-op
+           optimizes   call Sym_15
+   231   no-op
+           optimizes   Reg_1 = Stack_D
+   231   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   231   Reg_0 += Reg_1
+   231   Stack_D = Reg_0
+   231   tail call Sym_71
+           optimizes   call Sym_71
+   231   no-op
+           optimizes label Label_145
+   231 }
+
+   232 function Sym_137 {
+   233   Reg_0 = 0
+   233   Stack_D = Reg_0
+   233   no-op
+           optimizes   Reg_0 = Sym_133
+   233   no-op
+           optimizes   Stack_D = Reg_0
+   233   no-op
+           optimizes   call Sym_71
+   233   Reg_0 = *(Sym_133)
+   233   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   233   Reg_0 = 0
+   233   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   233   no-op
+           optimizes   Reg_1 = Stack_D
+   233   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   233   Stack_R = Reg_0
+   233   Stack_R = Reg_1
+   233 label Label_148
+   234   call Sym_58
+   234   no-op
+           optimizes   call Sym_136
+   231   no-op
+           optimizes   call Sym_21
+   231   Reg_0 = Stack_D
+   231   Reg_0 *= 4
+   231   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   231   Reg_0 = Sym_132
+   231   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   231   no-op
+           optimizes   call Sym_15
+   231   no-op
+           optimizes   Reg_1 = Stack_D
+   231   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   231   Reg_0 += Reg_1
+   231   Stack_D = Reg_0
+   231   call Sym_71
+   234   Reg_0 = 4
+   234   Stack_D = Reg_0
+   234   call Sym_138
+   234   call Sym_7
+   235   call Sym_58
+   235   no-op
+           optimizes   call Sym_136
+   231   no-op
+           optimizes   call Sym_21
+   231   Reg_0 = Stack_D
+   231   Reg_0 *= 4
+   231   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   231   Reg_0 = Sym_132
+   231   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   231   no-op
+           optimizes   call Sym_15
+   231   no-op
+           optimizes   Reg_1 = Stack_D
+   231   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   231   Reg_0 += Reg_1
+   231   Stack_D = Reg_0
+   231   call Sym_71
+   235   Reg_0 = 4
+   235   Stack_D = Reg_0
+   235   call Sym_138
+   235   Reg_0 = 4
+   235   Stack_D = Reg_0
+   235   call Sym_138
+   235   call Sym_7
+   236   no-op
+           optimizes   call Sym_79
+   236   Reg_1 = Stack_D
+   236   Reg_0 = Stack_D
+   236   if Reg_0 == Reg_1 goto Label_150
+   236   no-op
+           optimizes   Reg_0 = Stack_D
+   236   no-op
+           optimizes   if Reg_0 == 0 goto Label_150
+   236   no-op
+           optimizes   call Sym_19
+   236   Reg_0 = Stack_D
+   236   Reg_0 += 1
+   236   Stack_D = Reg_0
+   236 label Label_150
+   237   Reg_1 = Stack_R
+   237   Reg_1 += 1
+   237   Reg_0 = Stack_R
+   237   Stack_R = Reg_0
+   237   Stack_R = Reg_1
+   237   Reg_1 -= Reg_0
+   237   if Reg_1 != 0 goto Label_148
+   237   no-op
+           optimizes label Label_149
+   237   Reg_0 = Stack_R
+   237   Reg_0 = Stack_R
+   237   no-op
+           optimizes label Label_147
+   237   call Sym_94
+   237   call Sym_94
+   237   tail call Sym_94
+           optimizes   call Sym_94
+   237   no-op
+           optimizes label Label_146
+   237 }
+
+   297 function Sym_144 {
+   297   Reg_0 = 200
+           optimizes   Reg_0 = 100
+   297   Stack_D = Reg_0
+   297   no-op
+           optimizes   call Sym_51
+   297   no-op
+           optimizes label Label_151
+   297 }
+
+   298 function Sym_145 {
+   298   Reg_0 = 4
+           optimizes   Reg_0 = -1
+   298   Stack_D = Reg_0
+   298   no-op
+           optimizes   Reg_0 = 5
+   298   no-op
+           optimizes   Stack_D = Reg_0
+   298   no-op
+           optimizes   call Sym_15
+   298   no-op
+           optimizes label Label_152
+   298 }
+
+   299 function Sym_146 {
+   299   Reg_0 = -2147483648
+           optimizes   Reg_0 = 2147483647
+   299   Stack_D = Reg_0
+   299   no-op
+           optimizes   call Sym_19
+   299   no-op
+           optimizes label Label_153
+   299 }
+
+   300 function Sym_147 {
+   300   Reg_0 = 301
+           optimizes   Reg_0 = 300
+   300   Stack_D = Reg_0
+   300   no-op
+           optimizes   call Sym_19
+   300   no-op
+           optimizes label Label_154
+   300 }
+
+   301 function Sym_148 {
+   301   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_143)
+   301   Stack_D = Reg_0
+   301   tail call Sym_102
+           optimizes   call Sym_102
+   301   no-op
+           optimizes label Label_155
+   301 }
+
+   302 function Sym_149 {
+   304   no-op
+           optimizes   Reg_0 = 0
+   304   no-op
+           optimizes   Reg_1 = Reg_0
+   304   no-op
+           optimizes   Reg_1 = Stack_D
+   304   Reg_0 = Stack_D
+   304   Stack_D = Reg_0
+   304   Reg_1 = 100
+   304   if Reg_0 < Reg_1 goto Label_387
+   304   Reg_1 = 100
+   304   if Reg_0 == Reg_1 goto Label_384
+   304   Reg_1 = 2147483647
+   304   if Reg_0 == Reg_1 goto Label_386
+   304   goto Label_161
+   304 label Label_387
+   304   Reg_1 = -1
+   304   if Reg_0 == Reg_1 goto Label_385
+   304   Reg_1 = 0
+   304   if Reg_0 == Reg_1 goto Label_383
+   304   goto Label_161
+   304 label Label_383
+           optimizes   if Reg_0 != Reg_1 goto Label_158
+   304   Reg_0 = 1
+   304   Stack_D = Reg_0
+   304   call Sym_47
+   304   goto Label_157
+   304 label Label_158
+   304   no-op
+           optimizes   Reg_0 = 100
+   304   no-op
+           optimizes   Reg_1 = Reg_0
+   304   no-op
+           optimizes   Reg_1 = Stack_D
+   304   no-op
+           optimizes   Reg_0 = Stack_D
+   304   no-op
+           optimizes   Stack_D = Reg_0
+   304 label Label_384
+           optimizes   if Reg_0 != Reg_1 goto Label_159
+   304   Reg_0 = 2
+   304   Stack_D = Reg_0
+   304   call Sym_47
+   304   goto Label_157
+   304 label Label_159
+   305   no-op
+           optimizes   Reg_0 = -1
+   305   no-op
+           optimizes   Reg_1 = Reg_0
+   305   no-op
+           optimizes   Reg_1 = Stack_D
+   305   no-op
+           optimizes   Reg_0 = Stack_D
+   305   no-op
+           optimizes   Stack_D = Reg_0
+   305 label Label_385
+           optimizes   if Reg_0 != Reg_1 goto Label_160
+   305   Reg_0 = 3
+   305   Stack_D = Reg_0
+   305   call Sym_47
+   305   goto Label_157
+   305 label Label_160
+   305   no-op
+           optimizes   Reg_0 = 2147483647
+   305   no-op
+           optimizes   Reg_1 = Reg_0
+   305   no-op
+           optimizes   Reg_1 = Stack_D
+   305   no-op
+           optimizes   Reg_0 = Stack_D
+   305   no-op
+           optimizes   Stack_D = Reg_0
+   305 label Label_386
+           optimizes   if Reg_0 != Reg_1 goto Label_161
+   305   Reg_0 = 4
+   305   Stack_D = Reg_0
+   305   call Sym_47
+   305   goto Label_157
+   305 label Label_161
+   306   Reg_0 = 0
+   306   Stack_D = Reg_0
+   306   call Sym_47
+   307 label Label_157
+   307   Reg_0 = Stack_D
+   307   no-op
+           optimizes label Label_156
+   307 }
+
+   324 function Sym_151 {
+   325   call Sym_43
+   325   no-op
+           optimizes   call Sym_53
+   325   Reg_0 = Stack_D
+   325   if Reg_0 >= 0 goto Label_163
+   325   no-op
+           optimizes   Reg_0 = Stack_D
+   325   no-op
+           optimizes   if Reg_0 == 0 goto Label_163
+   325   call Sym_46
+   325   Reg_0 = 0
+   325   Stack_D = Reg_0
+   325   goto Label_162
+   325 label Label_163
+   326   call Sym_43
+   326   Reg_0 = 100
+   326   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   326   no-op
+           optimizes   call Sym_75
+   326   no-op
+           optimizes   Reg_1 = Stack_D
+   326   Reg_0 = Stack_D
+   326   if Reg_0 <= Reg_1 goto Label_164
+   326   no-op
+           optimizes   Reg_0 = Stack_D
+   326   no-op
+           optimizes   if Reg_0 == 0 goto Label_164
+   326   call Sym_46
+   326   Reg_0 = 100
+   326   Stack_D = Reg_0
+   326   goto Label_162
+   326 label Label_164
+   326 label Label_162
+   326 }
+
+   327 function Sym_152 {
+   328   call Sym_43
+   328   no-op
+           optimizes   call Sym_53
+   328   Reg_0 = Stack_D
+   328   if Reg_0 >= 0 goto Label_166
+   328   no-op
+           optimizes   Reg_0 = Stack_D
+   328   no-op
+           optimizes   if Reg_0 == 0 goto Label_166
+   328   call Sym_46
+   328   Reg_0 = -1
+   328   Stack_D = Reg_0
+   328   goto Label_167
+   328 label Label_166
+   328   no-op
+           optimizes   call Sym_91
+   328   Reg_0 = Stack_D
+   328   if Reg_0 <= 0 goto Label_168
+   328   no-op
+           optimizes   Reg_0 = Stack_D
+   328   no-op
+           optimizes   if Reg_0 == 0 goto Label_168
+   328   Reg_0 = 1
+   328   Stack_D = Reg_0
+   328   goto Label_169
+   328 label Label_168
+   328   Reg_0 = 0
+   328   Stack_D = Reg_0
+   328 label Label_169
+   328 label Label_167
+   328   no-op
+           optimizes label Label_165
+   328 }
+
+   329 function Sym_153 {
+   329   no-op
+           optimizes   call Sym_51
+   329   Reg_0 = Stack_D
+   329   Reg_0 += Reg_0
+   329   Stack_D = Reg_0
+   329   no-op
+           optimizes label Label_170
+   329 }
+
+   330 function Sym_154 {
+   330   tail call Sym_58
+           optimizes   call Sym_58
+   330   no-op
+           optimizes label Label_171
+   330 }
+
+   331 function Sym_155 {
+   331   tail call Sym_58
+           optimizes   call Sym_58
+   331   no-op
+           optimizes label Label_172
+   331 }
+
+   332 function Sym_156 {
+   333   Reg_0 = -1
+   333   Stack_D = Reg_0
+   333   call Sym_47
+   333   Reg_0 = 0
+   333   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   333   no-op
+           optimizes   Reg_1 = Stack_D
+   333   Reg_0 = Stack_D
+   333   Stack_R = Reg_0
+   333   Stack_R = Reg_1
+   333 label Label_175
+   333   call Sym_58
+   333   Reg_0 = 3
+   333   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   333   no-op
+           optimizes   call Sym_75
+   333   no-op
+           optimizes   Reg_1 = Stack_D
+   333   Reg_0 = Stack_D
+   333   if Reg_0 <= Reg_1 goto Label_177
+   333   no-op
+           optimizes   Reg_0 = Stack_D
+   333   no-op
+           optimizes   if Reg_0 == 0 goto Label_177
+   333   call Sym_46
+   333   call Sym_58
+   333   goto Label_176
+   333 label Label_177
+   333   Reg_1 = Stack_R
+   333   Reg_1 += 1
+   333   Reg_0 = Stack_R
+   333   Stack_R = Reg_0
+   333   Stack_R = Reg_1
+   333   Reg_1 -= Reg_0
+   333   if Reg_1 != 0 goto Label_175
+   333 label Label_176
+   333   Reg_0 = Stack_R
+   333   Reg_0 = Stack_R
+   333   no-op
+           optimizes label Label_174
+   333   no-op
+           optimizes label Label_173
+   333 }
+
+   334 function Sym_157 {
+   334   call Sym_43
+   334   Reg_0 = 2
+   334   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   334   no-op
+           optimizes   call Sym_73
+   334   no-op
+           optimizes   Reg_1 = Stack_D
+   334   Reg_0 = Stack_D
+   334   if Reg_0 >= Reg_1 goto Label_179
+   334   no-op
+           optimizes   Reg_0 = Stack_D
+   334   no-op
+           optimizes   if Reg_0 == 0 goto Label_179
+   334   call Sym_46
+   334   Reg_0 = 1
+   334   Stack_D = Reg_0
+   334   goto Label_178
+   334 label Label_179
+   334   call Sym_43
+   334   no-op
+           optimizes   call Sym_22
+   334   Reg_0 = Stack_D
+   334   Reg_0 -= 1
+   334   Stack_D = Reg_0
+   334   call Sym_157
+   334   tail call Sym_16
+           optimizes   call Sym_16
+   334 label Label_178
+   334 }
+
+   336 function Sym_158 {
+   336   no-op
+           optimizes   call Sym_151
+   325   call Sym_43
+   325   no-op
+           optimizes   call Sym_53
+   325   Reg_0 = Stack_D
+   325   if Reg_0 >= 0 goto Label_246
+   325   no-op
+           optimizes   Reg_0 = Stack_D
+   325   no-op
+           optimizes   if Reg_0 == 0 goto Label_246
+   325   call Sym_46
+   325   Reg_0 = 0
+   325   Stack_D = Reg_0
+   325   goto Label_248
+   325 label Label_246
+   326   call Sym_43
+   326   Reg_0 = 100
+   326   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   326   no-op
+           optimizes   call Sym_75
+   326   no-op
+           optimizes   Reg_1 = Stack_D
+   326   Reg_0 = Stack_D
+   326   if Reg_0 <= Reg_1 goto Label_247
+   326   no-op
+           optimizes   Reg_0 = Stack_D
+   326   no-op
+           optimizes   if Reg_0 == 0 goto Label_247
+   326   call Sym_46
+   326   Reg_0 = 100
+   326   Stack_D = Reg_0
+   326   goto Label_248
+   326 label Label_247
+   326 label Label_248
+   336   call Sym_159
+   336   no-op
+           optimizes   call Sym_151
+   325   call Sym_43
+   325   no-op
+           optimizes   call Sym_53
+   325   Reg_0 = Stack_D
+   325   if Reg_0 >= 0 goto Label_249
+   325   no-op
+           optimizes   Reg_0 = Stack_D
+   325   no-op
+           optimizes   if Reg_0 == 0 goto Label_249
+   325   call Sym_46
+   325   Reg_0 = 0
+   325   Stack_D = Reg_0
+   325   goto Label_251
+   325 label Label_249
+   326   call Sym_43
+   326   Reg_0 = 100
+   326   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   326   no-op
+           optimizes   call Sym_75
+   326   no-op
+           optimizes   Reg_1 = Stack_D
+   326   Reg_0 = Stack_D
+   326   if Reg_0 <= Reg_1 goto Label_250
+   326   no-op
+           optimizes   Reg_0 = Stack_D
+   326   no-op
+           optimizes   if Reg_0 == 0 goto Label_250
+   326   call Sym_46
+   326   Reg_0 = 100
+   326   Stack_D = Reg_0
+   326   goto Label_251
+   326 label Label_250
+   326 label Label_251
+   336   call Sym_159
+   336   no-op
+           optimizes   call Sym_151
+   325   call Sym_43
+   325   no-op
+           optimizes   call Sym_53
+   325   Reg_0 = Stack_D
+   325   if Reg_0 >= 0 goto Label_252
+   325   no-op
+           optimizes   Reg_0 = Stack_D
+   325   no-op
+           optimizes   if Reg_0 == 0 goto Label_252
+   325   call Sym_46
+   325   Reg_0 = 0
+   325   Stack_D = Reg_0
+   325   goto Label_254
+   325 label Label_252
+   326   call Sym_43
+   326   Reg_0 = 100
+   326   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   326   no-op
+           optimizes   call Sym_75
+   326   no-op
+           optimizes   Reg_1 = Stack_D
+   326   Reg_0 = Stack_D
+   326   if Reg_0 <= Reg_1 goto Label_253
+   326   no-op
+           optimizes   Reg_0 = Stack_D
+   326   no-op
+           optimizes   if Reg_0 == 0 goto Label_253
+   326   call Sym_46
+   326   Reg_0 = 100
+   326   Stack_D = Reg_0
+   326   goto Label_254
+   326 label Label_253
+   326 label Label_254
+   336   tail call Sym_159
+           optimizes   call Sym_159
+   336   no-op
+           optimizes label Label_180
+   336 }
+
+   337 function Sym_160 {
+   337   Reg_0 = -5
+   337   Stack_D = Reg_0
+   337   call Sym_152
+   337   Reg_0 = 0
+   337   Stack_D = Reg_0
+   337   call Sym_152
+   337   Reg_0 = *(Sym_11)
+   337   Stack_D = Reg_0
+   337   tail call Sym_152
+           optimizes   call Sym_152
+   337   no-op
+           optimizes label Label_181
+   337 }
+
+   338 function Sym_161 {
+   338   call Sym_153
+   338   tail call Sym_153
+           optimizes   call Sym_153
+   338   no-op
+           optimizes label Label_182
+   338 }
+
+   339 function Sym_162 {
+   339   Reg_0 = 0
+   339   Stack_D = Reg_0
+   339   Reg_0 = 5
+   339   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   339   Reg_0 = 0
+   339   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   339   no-op
+           optimizes   Reg_1 = Stack_D
+   339   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   339   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+   339   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   339 label Label_185
+   339   no-op
+           optimizes   call Sym_154
+   330   no-op
+           optimizes   call Sym_58
+   330   Reg_0 = Frame_1
+   330   no-op
+           optimizes   Stack_D = Reg_0
+   339   no-op
+           optimizes   call Sym_15
+   339   Reg_1 = Reg_0
+           optimizes   Reg_1 = Stack_D
+   339   Reg_0 = Stack_D
+   339   Reg_0 += Reg_1
+   339   Stack_D = Reg_0
+   339   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+   339   Reg_1 += 1
+   339   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   339   no-op
+           optimizes   Frame_0 = Reg_0
+   339   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   339   Reg_1 -= Reg_0
+   339   if Reg_1 != 0 goto Label_185
+   339   no-op
+           optimizes label Label_186
+   339   no-op
+           optimizes   Reg_0 = Frame_1
+   339   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   339   no-op
+           optimizes label Label_184
+   339   no-op
+           optimizes label Label_183
+   339 }
+
+   340 function Sym_163 {
+   340   Reg_0 = 0
+   340   Stack_D = Reg_0
+   340   Reg_0 = 5
+   340   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   340   Reg_0 = 0
+   340   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   340   no-op
+           optimizes   Reg_1 = Stack_D
+   340   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   340   Stack_R = Reg_0
+   340   Stack_R = Reg_1
+   340 label Label_189
+   340   call Sym_155
+   340   no-op
+           optimizes   call Sym_15
+   340   Reg_1 = Stack_D
+   340   Reg_0 = Stack_D
+   340   Reg_0 += Reg_1
+   340   Stack_D = Reg_0
+   340   Reg_1 = Stack_R
+   340   Reg_1 += 1
+   340   Reg_0 = Stack_R
+   340   Stack_R = Reg_0
+   340   Stack_R = Reg_1
+   340   Reg_1 -= Reg_0
+   340   if Reg_1 != 0 goto Label_189
+   340   no-op
+           optimizes label Label_190
+   340   Reg_0 = Stack_R
+   340   Reg_0 = Stack_R
+   340   no-op
+           optimizes label Label_188
+   340   no-op
+           optimizes label Label_187
+   340 }
+
+   341 function Sym_164 {
+   341   Reg_0 = 0
+   341   Stack_D = Reg_0
+   341   Reg_0 = 2
+   341   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   341   Reg_0 = 0
+   341   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   341   no-op
+           optimizes   Reg_1 = Stack_D
+   341   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   341   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+   341   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   341 label Label_193
+   341   Reg_0 = 3
+   341   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   341   Reg_0 = 0
+   341   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   341   no-op
+           optimizes   Reg_1 = Stack_D
+   341   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   341   Frame_2 = Reg_0
+           optimizes   Stack_R = Reg_0
+   341   Frame_3 = Reg_1
+           optimizes   Stack_R = Reg_1
+   341 label Label_196
+   341   no-op
+           optimizes   call Sym_154
+   330   no-op
+           optimizes   call Sym_58
+   330   Reg_0 = Frame_3
+   330   no-op
+           optimizes   Stack_D = Reg_0
+   341   no-op
+           optimizes   call Sym_15
+   341   Reg_1 = Reg_0
+           optimizes   Reg_1 = Stack_D
+   341   Reg_0 = Stack_D
+   341   Reg_0 += Reg_1
+   341   Stack_D = Reg_0
+   341   Reg_1 = Frame_3
+           optimizes   Reg_1 = Stack_R
+   341   Reg_1 += 1
+   341   Reg_0 = Frame_2
+           optimizes   Reg_0 = Stack_R
+   341   no-op
+           optimizes   Frame_2 = Reg_0
+   341   Frame_3 = Reg_1
+           optimizes   Stack_R = Reg_1
+   341   Reg_1 -= Reg_0
+   341   if Reg_1 != 0 goto Label_196
+   341   no-op
+           optimizes label Label_197
+   341   no-op
+           optimizes   Reg_0 = Frame_3
+   341   Reg_0 = Frame_2
+           optimizes   Reg_0 = Stack_R
+   341   no-op
+           optimizes label Label_195
+   341   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+   341   Reg_1 += 1
+   341   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   341   no-op
+           optimizes   Frame_0 = Reg_0
+   341   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   341   Reg_1 -= Reg_0
+   341   if Reg_1 != 0 goto Label_193
+   341   no-op
+           optimizes label Label_194
+   341   no-op
+           optimizes   Reg_0 = Frame_1
+   341   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   341   no-op
+           optimizes label Label_192
+   341   no-op
+           optimizes label Label_191
+   341 }
+
+   342 function Sym_165 {
+   342   Reg_0 = 10
+   342   Stack_D = Reg_0
+   342   call Sym_156
+   342   Reg_0 = 3
+   342   Stack_D = Reg_0
+   342   tail call Sym_156
+           optimizes   call Sym_156
+   342   no-op
+           optimizes label Label_198
+   342 }
+
+   343 function Sym_166 {
+   343   Reg_0 = 0
+   343   Stack_D = Reg_0
+   343   Reg_0 = 200
+   343   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   343   Reg_0 = -100
+   343   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   343   no-op
+           optimizes   Reg_1 = Stack_D
+   343   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   343   Stack_R = Reg_0
+   343   Stack_R = Reg_1
+   343 label Label_201
+   343   call Sym_58
+   343   no-op
+           optimizes   call Sym_151
+   325   call Sym_43
+   325   no-op
+           optimizes   call Sym_53
+   325   Reg_0 = Stack_D
+   325   if Reg_0 >= 0 goto Label_255
+   325   no-op
+           optimizes   Reg_0 = Stack_D
+   325   no-op
+           optimizes   if Reg_0 == 0 goto Label_255
+   325   call Sym_46
+   325   Reg_0 = 0
+   325   Stack_D = Reg_0
+   325   goto Label_257
+   325 label Label_255
+   326   call Sym_43
+   326   Reg_0 = 100
+   326   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   326   no-op
+           optimizes   call Sym_75
+   326   no-op
+           optimizes   Reg_1 = Stack_D
+   326   Reg_0 = Stack_D
+   326   if Reg_0 <= Reg_1 goto Label_256
+   326   no-op
+           optimizes   Reg_0 = Stack_D
+   326   no-op
+           optimizes   if Reg_0 == 0 goto Label_256
+   326   call Sym_46
+   326   Reg_0 = 100
+   326   Stack_D = Reg_0
+   326   goto Label_257
+   326 label Label_256
+   326 label Label_257
+   343   no-op
+           optimizes   call Sym_15
+   343   Reg_1 = Stack_D
+   343   Reg_0 = Stack_D
+   343   Reg_0 += Reg_1
+   343   Stack_D = Reg_0
+   343   Reg_0 = 50
+   343   no-op
+           optimizes   Stack_D = Reg_0
+   343   no-op
+           optimizes   Reg_0 = Stack_D
+   343   Reg_1 = Stack_R
+   343   Reg_1 += Reg_0
+   343   if Reg_0 < 0 goto Label_203
+   343   Reg_0 = Stack_R
+   343   Stack_R = Reg_0
+   343   Stack_R = Reg_1
+   343   Reg_1 -= Reg_0
+   343   if Reg_1 < 0 goto Label_201
+   343   goto Label_202
+   343 label Label_203
+   343   Reg_0 = Stack_R
+   343   Stack_R = Reg_0
+   343   Stack_R = Reg_1
+   343   Reg_1 -= Reg_0
+   343   if Reg_1 >= 0 goto Label_201
+   343 label Label_202
+   343   Reg_0 = Stack_R
+   343   Reg_0 = Stack_R
+   343   no-op
+           optimizes label Label_200
+   343   no-op
+           optimizes label Label_199
+   343 }
+
+   363 function Sym_168 {
+   363   Reg_0 = 0
+   363   Stack_D = Reg_0
+   363   call Sym_47
+   363   Reg_0 = 0
+   363   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   363   no-op
+           optimizes   Reg_1 = Stack_D
+   363   Reg_0 = Stack_D
+   363   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+   363   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   363 label Label_206
+   363   no-op
+           optimizes   Reg_0 = Sym_167
+   363   no-op
+           optimizes   Stack_D = Reg_0
+   363   no-op
+           optimizes   call Sym_71
+   363   Reg_0 = *(Sym_167)
+   363   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   363   no-op
+           optimizes   call Sym_15
+   363   no-op
+           optimizes   Reg_1 = Stack_D
+   363   Reg_0 = Stack_D
+   363   Reg_0 += Reg_1
+   363   Stack_D = Reg_0
+   363   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+   363   Reg_1 += 1
+   363   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   363   no-op
+           optimizes   Frame_0 = Reg_0
+   363   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   363   Reg_1 -= Reg_0
+   363   if Reg_1 != 0 goto Label_206
+   363   no-op
+           optimizes label Label_207
+   363   no-op
+           optimizes   Reg_0 = Frame_1
+   363   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   363   no-op
+           optimizes label Label_205
+   363   no-op
+           optimizes label Label_204
+   363 }
+
+   364 function Sym_169 {
+   364   Reg_0 = 0
+   364   Stack_D = Reg_0
+   364   call Sym_47
+   364   Reg_0 = 0
+   364   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   364   no-op
+           optimizes   Reg_1 = Stack_D
+   364   Reg_0 = Stack_D
+   364   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+   364   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   364 label Label_210
+   364   no-op
+           optimizes   Reg_0 = Sym_167
+   364   no-op
+           optimizes   Stack_D = Reg_0
+   364   no-op
+           optimizes   call Sym_71
+   364   Reg_0 = *(Sym_167)
+   364   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   364   no-op
+           optimizes   call Sym_15
+   364   no-op
+           optimizes   Reg_1 = Stack_D
+   364   Reg_0 = Stack_D
+   364   Reg_0 += Reg_1
+   364   Stack_D = Reg_0
+   364   Reg_0 = 1
+   364   no-op
+           optimizes   Stack_D = Reg_0
+   364   no-op
+           optimizes   Reg_0 = Sym_167
+   364   no-op
+           optimizes   Stack_D = Reg_0
+   364   no-op
+           optimizes   call Sym_135
+   364   no-op
+           optimizes   Reg_0 = Stack_D
+   364   Reg_1 = *(Sym_167)
+   364   Reg_0 += Reg_1
+   364   *(Sym_167) = Reg_0
+   364   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+   364   Reg_1 += 1
+   364   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   364   no-op
+           optimizes   Frame_0 = Reg_0
+   364   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   364   Reg_1 -= Reg_0
+   364   if Reg_1 != 0 goto Label_210
+   364   no-op
+           optimizes label Label_211
+   364   no-op
+           optimizes   Reg_0 = Frame_1
+   364   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   364   no-op
+           optimizes label Label_209
+   364   no-op
+           optimizes label Label_208
+   364 }
+
+   365 function Sym_170 {
+   365   Reg_0 = 0
+   365   Stack_D = Reg_0
+   365   call Sym_47
+   365   Reg_0 = 0
+   365   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   365   no-op
+           optimizes   Reg_1 = Stack_D
+   365   Reg_0 = Stack_D
+   365   Frame_0 = Reg_0
+           optimizes   Stack_R = Reg_0
+   365   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   365 label Label_214
+   365   Reg_0 = 3
+   365   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   365   Reg_0 = 0
+   365   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   365   no-op
+           optimizes   Reg_1 = Stack_D
+   365   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   365   Frame_2 = Reg_0
+           optimizes   Stack_R = Reg_0
+   365   Frame_3 = Reg_1
+           optimizes   Stack_R = Reg_1
+   365 label Label_217
+   365   no-op
+           optimizes   Reg_0 = Sym_167
+   365   no-op
+           optimizes   Stack_D = Reg_0
+   365   no-op
+           optimizes   call Sym_71
+   365   Reg_0 = *(Sym_167)
+   365   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   365   no-op
+           optimizes   call Sym_65
+   365   Reg_0 = Frame_1
+   365   no-op
+           optimizes   Stack_D = Reg_0
+   365   no-op
+           optimizes   call Sym_15
+   365   Reg_1 = Reg_0
+           optimizes   Reg_1 = Stack_D
+   365   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   365   Reg_0 += Reg_1
+   365   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   365   no-op
+           optimizes   call Sym_15
+   365   no-op
+           optimizes   Reg_1 = Stack_D
+   365   Reg_0 = Stack_D
+   365   Reg_0 += Reg_1
+   365   Stack_D = Reg_0
+   365   Reg_1 = Frame_3
+           optimizes   Reg_1 = Stack_R
+   365   Reg_1 += 1
+   365   Reg_0 = Frame_2
+           optimizes   Reg_0 = Stack_R
+   365   no-op
+           optimizes   Frame_2 = Reg_0
+   365   Frame_3 = Reg_1
+           optimizes   Stack_R = Reg_1
+   365   Reg_1 -= Reg_0
+   365   if Reg_1 != 0 goto Label_217
+   365   no-op
+           optimizes label Label_218
+   365   no-op
+           optimizes   Reg_0 = Frame_3
+   365   Reg_0 = Frame_2
+           optimizes   Reg_0 = Stack_R
+   365   no-op
+           optimizes label Label_216
+   365   Reg_1 = Frame_1
+           optimizes   Reg_1 = Stack_R
+   365   Reg_1 += 1
+   365   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   365   no-op
+           optimizes   Frame_0 = Reg_0
+   365   Frame_1 = Reg_1
+           optimizes   Stack_R = Reg_1
+   365   Reg_1 -= Reg_0
+   365   if Reg_1 != 0 goto Label_214
+   365   no-op
+           optimizes label Label_215
+   365   no-op
+           optimizes   Reg_0 = Frame_1
+   365   Reg_0 = Frame_0
+           optimizes   Reg_0 = Stack_R
+   365   no-op
+           optimizes label Label_213
+   365   no-op
+           optimizes label Label_212
+   365 }
+
+   380 function Sym_172 {
+   380   Reg_0 = 11
+   380   no-op
+           optimizes   Stack_D = Reg_0
+   380   no-op
+           optimizes   Reg_0 = Sym_171
+   380   no-op
+           optimizes   Stack_D = Reg_0
+   380   no-op
+           optimizes   call Sym_5
+   380   no-op
+           optimizes   Reg_0 = Stack_D
+   380   *(Sym_171) = Reg_0
+   380   no-op
+           optimizes label Label_219
+   380 }
+
+   381 function Sym_173 {
+   381   no-op
+           optimizes   Reg_0 = Sym_171
+   381   no-op
+           optimizes   Stack_D = Reg_0
+   381   no-op
+           optimizes   call Sym_5
+   381   Reg_0 = Stack_D
+   381   *(Sym_171) = Reg_0
+   381   no-op
+           optimizes   Reg_0 = Sym_171
+   381   no-op
+           optimizes   Stack_D = Reg_0
+   381   no-op
+           optimizes   call Sym_71
+   381   no-op
+           optimizes   Reg_0 = *(Sym_171)
+   381   Stack_D = Reg_0
+   381   no-op
+           optimizes label Label_220
+   381 }
+
+   382 function Sym_174 {
+   382   no-op
+           optimizes   Reg_0 = Sym_171
+   382   no-op
+           optimizes   Stack_D = Reg_0
+   382   no-op
+           optimizes   call Sym_71
+   382   Reg_0 = *(Sym_171)
+   382   Stack_D = Reg_0
+   382   no-op
+           optimizes   Reg_0 = Sym_171
+   382   no-op
+           optimizes   Stack_D = Reg_0
+   382   no-op
+           optimizes   call Sym_71
+   382   no-op
+           optimizes   Reg_0 = *(Sym_171)
+   382   Stack_D = Reg_0
+   382   no-op
+           optimizes label Label_221
+   382 }
+
+   383 function Sym_175 {
+   383   no-op
+           optimizes   Reg_0 = Sym_171
+   383   no-op
+           optimizes   Stack_D = Reg_0
+   383   no-op
+           optimizes   call Sym_5
+   383   Reg_0 = Stack_D
+   383   no-op
+           optimizes   *(Sym_171) = Reg_0
+   383   no-op
+           optimizes   Reg_0 = Sym_171
+   383   no-op
+           optimizes   Stack_D = Reg_0
+   383   no-op
+           optimizes   call Sym_5
+   383   Reg_0 = Stack_D
+   383   *(Sym_171) = Reg_0
+   383   no-op
+           optimizes label Label_222
+   383 }
+
+   384 function Sym_176 {
+   384   Reg_0 = 5
+   384   no-op
+           optimizes   Stack_D = Reg_0
+   384   no-op
+           optimizes   Reg_0 = Sym_171
+   384   no-op
+           optimizes   Stack_D = Reg_0
+   384   no-op
+           optimizes   call Sym_5
+   384   no-op
+           optimizes   Reg_0 = Stack_D
+   384   *(Sym_171) = Reg_0
+   384   Reg_0 = 9
+   384   Stack_D = Reg_0
+   384   call Sym_47
+   384   call Sym_5
+   384   no-op
+           optimizes   Reg_0 = Sym_171
+   384   no-op
+           optimizes   Stack_D = Reg_0
+   384   no-op
+           optimizes   call Sym_71
+   384   Reg_0 = *(Sym_171)
+   384   Stack_D = Reg_0
+   384   no-op
+           optimizes label Label_223
+   384 }
+
+   385 function Sym_177 {
+   385   Reg_0 = 0
+   385   no-op
+           optimizes   Stack_D = Reg_0
+   385   no-op
+           optimizes   Reg_0 = Sym_171
+   385   no-op
+           optimizes   Stack_D = Reg_0
+   385   no-op
+           optimizes   call Sym_5
+   385   no-op
+           optimizes   Reg_0 = Stack_D
+   385   *(Sym_171) = Reg_0
+   385   Reg_0 = 7
+   385   Stack_D = Reg_0
+   385   call Sym_47
+   385   call Sym_178
+   385   no-op
+           optimizes   Reg_0 = Sym_171
+   385   no-op
+           optimizes   Stack_D = Reg_0
+   385   no-op
+           optimizes   call Sym_71
+   385   Reg_0 = *(Sym_171)
+   385   Stack_D = Reg_0
+   385   no-op
+           optimizes label Label_224
+   385 }
+
+   386 function Sym_179 {
+   386   Reg_0 = 3
+   386   no-op
+           optimizes   Stack_D = Reg_0
+   386   no-op
+           optimizes   Reg_0 = Sym_171
+   386   no-op
+           optimizes   Stack_D = Reg_0
+   386   no-op
+           optimizes   call Sym_5
+   386   no-op
+           optimizes   Reg_0 = Stack_D
+   386   *(Sym_171) = Reg_0
+   386   call Sym_71
+   386   Reg_0 = 4
+   386   no-op
+           optimizes   Stack_D = Reg_0
+   386   no-op
+           optimizes   Reg_0 = Sym_171
+   386   no-op
+           optimizes   Stack_D = Reg_0
+   386   no-op
+           optimizes   call Sym_5
+   386   no-op
+           optimizes   Reg_0 = Stack_D
+   386   *(Sym_171) = Reg_0
+   386   no-op
+           optimizes label Label_225
+   386 }
+
+   387 function Sym_180 {
+   387   Reg_0 = 5
+   387   no-op
+           optimizes   Stack_D = Reg_0
+   387   no-op
+           optimizes   Reg_0 = Sym_171
+   387   no-op
+           optimizes   Stack_D = Reg_0
+   387   no-op
+           optimizes   call Sym_5
+   387   no-op
+           optimizes   Reg_0 = Stack_D
+   387   *(Sym_171) = Reg_0
+   387   no-op
+           optimizes   Reg_0 = Sym_171
+   387   no-op
+           optimizes   Stack_D = Reg_0
+   387   no-op
+           optimizes   call Sym_71
+   387   no-op
+           optimizes   Reg_0 = *(Sym_171)
+   387   Stack_D = Reg_0
+   387   call Sym_172
+   387   no-op
+           optimizes   Reg_0 = Sym_171
+   387   no-op
+           optimizes   Stack_D = Reg_0
+   387   no-op
+           optimizes   call Sym_71
+   387   Reg_0 = *(Sym_171)
+   387   Stack_D = Reg_0
+   387   no-op
+           optimizes label Label_226
+   387 }
+
+   406 function Sym_181 {
+   406   Reg_0 = Stack_D
+   406   if Reg_0 == 0 goto Label_228
+   406   call Sym_43
+   406   Reg_0 = Stack_D
+   406   if Reg_0 == 0 goto Label_229
+   406   call Sym_46
+   406   Reg_0 = 1
+   406   Stack_D = Reg_0
+   406   no-op
+           optimizes label Label_229
+   406   goto Label_230
+   406 label Label_228
+   406   call Sym_46
+   406   Reg_0 = 3
+   406   Stack_D = Reg_0
+   406 label Label_229
+   406 label Label_230
+   406   no-op
+           optimizes label Label_227
+   406 }
+
+   407 function Sym_182 {
+   408   Reg_0 = 0
+   408   Stack_D = Reg_0
+   408   call Sym_47
+   408 label Label_234
+   408 label Label_232
+   408   call Sym_43
+   408   Reg_0 = Stack_D
+   408   if Reg_0 == 0 goto Label_233
+   408   no-op
+           optimizes   call Sym_22
+   408   Reg_0 = Stack_D
+   408   Reg_0 -= 1
+   408   Stack_D = Reg_0
+   408   call Sym_43
+   408   Reg_0 = 1
+   408   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   408   no-op
+           optimizes   call Sym_35
+   408   no-op
+           optimizes   Reg_1 = Stack_D
+   408   Reg_0 = Stack_D
+   408   Reg_0 &= Reg_1
+   408   no-op
+           optimizes   Stack_D = Reg_0
+   408   no-op
+           optimizes   Reg_0 = Stack_D
+   408   if Reg_0 == 0 goto Label_234
+   408   call Sym_47
+   408   no-op
+           optimizes   call Sym_19
+   408   Reg_0 = Stack_D
+   408   Reg_0 += 1
+   408   Stack_D = Reg_0
+   408   call Sym_47
+   408   no-op
+           optimizes label Label_234
+   408   goto Label_232
+   408 label Label_233
+   408   tail call Sym_46
+           optimizes   call Sym_46
+   408   no-op
+           optimizes label Label_231
+   408 }
+
+   409 function Sym_183 {
+   409 label Label_236
+   409   goto Label_236
+   409   no-op
+           optimizes label Label_237
+   409   no-op
+           optimizes label Label_235
+   409 }
+
+   410 function Sym_184 {
+   410   no-op
+           optimizes   call Sym_44
+   410   Reg_0 = Stack_D
+   410   if Reg_0 != 0 goto Label_239
+   410   no-op
+           optimizes   Reg_0 = Stack_D
+   410   no-op
+           optimizes   if Reg_0 == 0 goto Label_239
+   410 label Label_240
+   410   goto Label_240
+   410   no-op
+           optimizes label Label_241
+   410 label Label_239
+   410   no-op
+           optimizes label Label_238
+   410 }
+
+   411 function Sym_185 {
+   412 label Label_243
+   412   call Sym_43
+   412   Reg_0 = 10
+   412   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   412   no-op
+           optimizes   call Sym_73
+   412   no-op
+           optimizes   Reg_1 = Stack_D
+   412   Reg_0 = Stack_D
+   412   if Reg_0 >= Reg_1 goto Label_245
+   412   no-op
+           optimizes   Reg_0 = Stack_D
+   412   no-op
+           optimizes   if Reg_0 == 0 goto Label_245
+   412   no-op
+           optimizes   call Sym_19
+   412   Reg_0 = Stack_D
+   412   Reg_0 += 1
+   412   no-op
+           optimizes   Stack_D = Reg_0
+   412   no-op
+           optimizes   goto Label_246
+   412   no-op
+           optimizes label Label_246
+   412   no-op
+           optimizes   call Sym_51
+   412   no-op
+           optimizes   Reg_0 = Stack_D
+   412   Reg_0 += Reg_0
+   412   Stack_D = Reg_0
+   412   goto Label_243
+   412 label Label_245
+   412   Reg_0 = 100
+   412   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   412   no-op
+           optimizes   call Sym_15
+   412   no-op
+           optimizes   Reg_1 = Stack_D
+   412   Reg_0 = Stack_D
+   412   Reg_0 += Reg_1
+   412   Stack_D = Reg_0
+   412   no-op
+           optimizes   goto Label_242
+   412   no-op
+           optimizes label Label_244
+   412   no-op
+           optimizes label Label_242
+   412 }
+
+     9 function Sym_1 {
+     9   Reg_0 = Data_0
+     9   Stack_D = Reg_0
+     9   Reg_0 = 17
+     9   Stack_D = Reg_0
+     9   call Sym_0
+     9   call Sym_2
+    10   no-op
+           optimizes   call Sym_3
+    10   Reg_0 = -1
+    10   Stack_D = Reg_0
+    10   call Sym_4
+    10   call Sym_5
+    12   Reg_0 = 0
+    12   Stack_D = Reg_0
+    12   Reg_0 = Sym_6
+    12   Stack_D = Reg_0
+    12   call Sym_7
+    12   Reg_0 = Stack_D
+    12   *(Sym_8) = Reg_0
+    13   Reg_0 = *(Sym_8)
+    13   Stack_D = Reg_0
+    13   Reg_0 = 1
+    13   Stack_D = Reg_0
+    13   Reg_0 = Sym_9
+    13   Stack_D = Reg_0
+    13   call Sym_7
+    13   Reg_0 = Stack_D
+    13   *(Sym_10) = Reg_0
+    14   Reg_0 = *(Sym_10)
+    14   Stack_D = Reg_0
+    14   Reg_0 = Sym_6
+    14   Stack_D = Reg_0
+    14   call Sym_7
+    14   Reg_0 = Stack_D
+    14   *(Sym_11) = Reg_0
+    15   Reg_0 = 0
+    15   no-op
+           optimizes   Stack_D = Reg_0
+    15   no-op
+           optimizes   Reg_0 = Stack_D
+    15   *(Sym_12) = Reg_0
+    16   Reg_0 = *(Sym_8)
+    16   no-op
+           optimizes   Stack_D = Reg_0
+    16   no-op
+           optimizes   Reg_0 = Stack_D
+    16   *(Sym_13) = Reg_0
+    19   Reg_0 = Data_1
+    19   Stack_D = Reg_0
+    19   Reg_0 = 38
+    19   Stack_D = Reg_0
+    19   call Sym_0
+    19   call Sym_2
+    38   Reg_0 = 100
+    38   Stack_D = Reg_0
+    38   call Sym_39
+    38   no-op
+           optimizes   call Sym_14
+    21   Reg_0 = 9
+           optimizes   Reg_0 = 3
+    21   Stack_D = Reg_0
+    38   call Sym_40
+    38   Reg_0 = 9
+    38   Stack_D = Reg_0
+    38   call Sym_41
+    39   Reg_0 = 110
+    39   Stack_D = Reg_0
+    39   call Sym_39
+    39   no-op
+           optimizes   call Sym_17
+    22   Reg_0 = 2147483647
+           optimizes   Reg_0 = -1
+    22   Stack_D = Reg_0
+    39   call Sym_40
+    39   Reg_0 = *(Sym_10)
+    39   Stack_D = Reg_0
+    39   call Sym_41
+    40   Reg_0 = 120
+    40   Stack_D = Reg_0
+    40   call Sym_39
+    40   no-op
+           optimizes   call Sym_18
+    23   Reg_0 = -2147483648
+           optimizes   Reg_0 = 2147483647
+    23   Stack_D = Reg_0
+    40   call Sym_40
+    40   Reg_0 = *(Sym_11)
+    40   Stack_D = Reg_0
+    40   call Sym_41
+    41   Reg_0 = 130
+    41   Stack_D = Reg_0
+    41   call Sym_39
+    41   no-op
+           optimizes   call Sym_20
+    24   Reg_0 = -2147483648
+           optimizes   Reg_0 = 1
+    24   Stack_D = Reg_0
+    41   call Sym_40
+    41   Reg_0 = *(Sym_11)
+    41   Stack_D = Reg_0
+    41   call Sym_41
+    42   Reg_0 = 140
+    42   Stack_D = Reg_0
+    42   call Sym_39
+    42   no-op
+           optimizes   call Sym_24
+    29   Reg_0 = -2147483648
+           optimizes   Reg_0 = 2147483647
+    29   Stack_D = Reg_0
+    42   call Sym_40
+    42   Reg_0 = *(Sym_11)
+    42   Stack_D = Reg_0
+    42   call Sym_41
+    43   Reg_0 = 150
+    43   Stack_D = Reg_0
+    43   call Sym_39
+    43   no-op
+           optimizes   call Sym_25
+    30   Reg_0 = 2147483647
+           optimizes   Reg_0 = -2147483648
+    30   Stack_D = Reg_0
+    43   call Sym_40
+    43   Reg_0 = *(Sym_10)
+    43   Stack_D = Reg_0
+    43   call Sym_41
+    44   Reg_0 = 160
+    44   Stack_D = Reg_0
+    44   call Sym_39
+    44   no-op
+           optimizes   call Sym_26
+    32   Reg_0 = -3
+           optimizes   Reg_0 = -5
+    32   Stack_D = Reg_0
+    44   call Sym_40
+    44   Reg_0 = -3
+    44   Stack_D = Reg_0
+    44   call Sym_41
+    45   Reg_0 = 170
+    45   Stack_D = Reg_0
+    45   call Sym_39
+    45   no-op
+           optimizes   call Sym_28
+    33   Reg_0 = 1
+           optimizes   Reg_0 = -1
+    33   Stack_D = Reg_0
+    45   call Sym_40
+    45   Reg_0 = 1
+    45   Stack_D = Reg_0
+    45   call Sym_41
+    46   Reg_0 = 180
+    46   Stack_D = Reg_0
+    46   call Sym_39
+    46   no-op
+           optimizes   call Sym_29
+    34   Reg_0 = 6
+           optimizes   Reg_0 = -6
+    34   Stack_D = Reg_0
+    34   Reg_0 = -4
+           optimizes   Reg_0 = 3
+    34   Stack_D = Reg_0
+    34   Reg_0 = 3
+           optimizes   Reg_0 = 3
+    34   Stack_D = Reg_0
+    46   call Sym_40
+    46   Reg_0 = 6
+    46   Stack_D = Reg_0
+    46   Reg_0 = -4
+    46   Stack_D = Reg_0
+    46   Reg_0 = 3
+    46   Stack_D = Reg_0
+    46   call Sym_41
+    47   Reg_0 = 190
+    47   Stack_D = Reg_0
+    47   call Sym_39
+    47   no-op
+           optimizes   call Sym_34
+    35   Reg_0 = 7
+           optimizes   Reg_0 = 13
+    35   Stack_D = Reg_0
+    47   call Sym_40
+    47   Reg_0 = 7
+    47   Stack_D = Reg_0
+    47   call Sym_41
+    48   Reg_0 = 200
+    48   Stack_D = Reg_0
+    48   call Sym_39
+    48   no-op
+           optimizes   call Sym_38
+    36   Reg_0 = *(Sym_8)
+    36   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    36   Reg_0 = 1
+    36   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    36   no-op
+           optimizes   call Sym_15
+    36   no-op
+           optimizes   Reg_1 = Stack_D
+    36   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    36   Reg_0 += Reg_1
+    36   Stack_D = Reg_0
+    48   call Sym_40
+    48   Reg_0 = 0
+    48   Stack_D = Reg_0
+    48   call Sym_41
+    49   Reg_0 = 210
+    49   Stack_D = Reg_0
+    49   call Sym_39
+    49   Reg_0 = 20
+           optimizes   Reg_0 = 5
+    49   Stack_D = Reg_0
+    49   no-op
+           optimizes   Reg_0 = 3
+    49   no-op
+           optimizes   Stack_D = Reg_0
+    49   no-op
+           optimizes   call Sym_15
+    49   no-op
+           optimizes   Reg_0 = 4
+    49   no-op
+           optimizes   Stack_D = Reg_0
+    49   no-op
+           optimizes   call Sym_16
+    49   call Sym_40
+    49   Reg_0 = 20
+    49   Stack_D = Reg_0
+    49   call Sym_41
+    50   Reg_0 = 220
+    50   Stack_D = Reg_0
+    50   call Sym_39
+    50   Reg_0 = -2
+           optimizes   Reg_0 = -1
+    50   Stack_D = Reg_0
+    50   no-op
+           optimizes   Reg_0 = 1
+    50   no-op
+           optimizes   Stack_D = Reg_0
+    50   no-op
+           optimizes   call Sym_23
+    50   call Sym_40
+    50   Reg_0 = -2
+    50   Stack_D = Reg_0
+    50   call Sym_41
+    53   Reg_0 = Data_2
+    53   Stack_D = Reg_0
+    53   Reg_0 = 18
+    53   Stack_D = Reg_0
+    53   call Sym_0
+    53   call Sym_2
+    65   Reg_0 = 1600
+    65   Stack_D = Reg_0
+    65   call Sym_39
+    65   Reg_0 = 1000000
+    65   Stack_D = Reg_0
+    65   call Sym_42
+    65   call Sym_40
+    65   Reg_0 = 0
+    65   Stack_D = Reg_0
+    65   call Sym_41
+    66   Reg_0 = 1610
+    66   Stack_D = Reg_0
+    66   call Sym_39
+    66   Reg_0 = 0
+    66   Stack_D = Reg_0
+    66   Reg_0 = 60000
+    66   Stack_D = Reg_0
+    66   call Sym_45
+    66   call Sym_40
+    66   Reg_0 = 1800030000
+    66   Stack_D = Reg_0
+    66   call Sym_41
+    67   Reg_0 = 1620
+    67   Stack_D = Reg_0
+    67   call Sym_39
+    67   Reg_0 = 7
+           optimizes   Reg_0 = 6
+    67   Stack_D = Reg_0
+    67   no-op
+           optimizes   call Sym_50
+    59   no-op
+           optimizes   call Sym_51
+    59   no-op
+           optimizes   call Sym_49
+    58   no-op
+           optimizes   call Sym_19
+    67   call Sym_40
+    67   Reg_0 = 7
+    67   Stack_D = Reg_0
+    67   call Sym_41
+    68   Reg_0 = 1630
+    68   Stack_D = Reg_0
+    68   call Sym_39
+    68   Reg_0 = -4
+    68   Stack_D = Reg_0
+    68   no-op
+           optimizes   call Sym_52
+    60   call Sym_43
+    60   no-op
+           optimizes   call Sym_53
+    60   Reg_0 = Stack_D
+    60   if Reg_0 >= 0 goto Label_258
+    60   no-op
+           optimizes   Reg_0 = Stack_D
+    60   no-op
+           optimizes   if Reg_0 == 0 goto Label_258
+    60   no-op
+           optimizes   call Sym_30
+    60   Reg_0 = Stack_D
+    60   Reg_0 = -Reg_0
+    60   Stack_D = Reg_0
+    60   goto Label_259
+    60 label Label_258
+    60   no-op
+           optimizes   call Sym_50
+    59   no-op
+           optimizes   call Sym_51
+    59   Reg_0 = Stack_D
+    59   Reg_0 += Reg_0
+    59   no-op
+           optimizes   Stack_D = Reg_0
+    58   no-op
+           optimizes   call Sym_19
+    58   no-op
+           optimizes   Reg_0 = Stack_D
+    58   Reg_0 += 1
+    58   Stack_D = Reg_0
+    60 label Label_259
+    68   call Sym_40
+    68   Reg_0 = 4
+    68   Stack_D = Reg_0
+    68   call Sym_41
+    69   Reg_0 = 1640
+    69   Stack_D = Reg_0
+    69   call Sym_39
+    69   Reg_0 = 4
+    69   Stack_D = Reg_0
+    69   no-op
+           optimizes   call Sym_52
+    60   call Sym_43
+    60   no-op
+           optimizes   call Sym_53
+    60   Reg_0 = Stack_D
+    60   if Reg_0 >= 0 goto Label_260
+    60   no-op
+           optimizes   Reg_0 = Stack_D
+    60   no-op
+           optimizes   if Reg_0 == 0 goto Label_260
+    60   no-op
+           optimizes   call Sym_30
+    60   Reg_0 = Stack_D
+    60   Reg_0 = -Reg_0
+    60   Stack_D = Reg_0
+    60   goto Label_261
+    60 label Label_260
+    60   no-op
+           optimizes   call Sym_50
+    59   no-op
+           optimizes   call Sym_51
+    59   Reg_0 = Stack_D
+    59   Reg_0 += Reg_0
+    59   no-op
+           optimizes   Stack_D = Reg_0
+    58   no-op
+           optimizes   call Sym_19
+    58   no-op
+           optimizes   Reg_0 = Stack_D
+    58   Reg_0 += 1
+    58   Stack_D = Reg_0
+    60 label Label_261
+    69   call Sym_40
+    69   Reg_0 = 9
+    69   Stack_D = Reg_0
+    69   call Sym_41
+    70   Reg_0 = 1650
+    70   Stack_D = Reg_0
+    70   call Sym_39
+    70   Reg_0 = 4
+    70   no-op
+           optimizes   Stack_D = Reg_0
+    70   no-op
+           optimizes   call Sym_54
+    61   no-op
+           optimizes   call Sym_55
+    61   no-op
+           optimizes   Reg_0 = Stack_D
+    61   Frame_0 = Reg_0
+    61   Reg_0 = 3
+    61   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    61   no-op
+           optimizes   call Sym_56
+    61   Reg_0 = Frame_0
+    61   no-op
+           optimizes   Stack_D = Reg_0
+    61   no-op
+           optimizes   call Sym_15
+    61   Reg_1 = Reg_0
+           optimizes   Reg_1 = Stack_D
+    61   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    61   Reg_0 += Reg_1
+    61   no-op
+           optimizes   Stack_D = Reg_0
+    61   no-op
+           optimizes   call Sym_49
+    58   no-op
+           optimizes   call Sym_19
+    58   no-op
+           optimizes   Reg_0 = Stack_D
+    58   Reg_0 += 1
+    58   Stack_D = Reg_0
+    70   call Sym_40
+    70   Reg_0 = 8
+    70   Stack_D = Reg_0
+    70   call Sym_41
+    71   Reg_0 = 1660
+    71   Stack_D = Reg_0
+    71   call Sym_39
+    71   call Sym_57
+    71   call Sym_40
+    71   Reg_0 = 11
+    71   Stack_D = Reg_0
+    71   call Sym_41
+    72   Reg_0 = 1670
+    72   Stack_D = Reg_0
+    72   call Sym_39
+    72   Reg_0 = 5
+    72   Stack_D = Reg_0
+    72   Reg_0 = Sym_50
+    72   Stack_D = Reg_0
+    72   no-op
+           optimizes   call Sym_59
+    63   call Sym_7
+    72   call Sym_40
+    72   Reg_0 = 11
+    72   Stack_D = Reg_0
+    72   call Sym_41
+    75   Reg_0 = Data_3
+    75   Stack_D = Reg_0
+    75   Reg_0 = 18
+    75   Stack_D = Reg_0
+    75   call Sym_0
+    75   call Sym_2
+    86   Reg_0 = 1700
+    86   Stack_D = Reg_0
+    86   call Sym_39
+    86   Reg_0 = 7
+    86   Stack_D = Reg_0
+    86   no-op
+           optimizes   call Sym_60
+    77   call Sym_43
+    77   call Sym_16
+    86   call Sym_40
+    86   Reg_0 = 49
+    86   Stack_D = Reg_0
+    86   call Sym_41
+    87   Reg_0 = 1710
+    87   Stack_D = Reg_0
+    87   call Sym_39
+    87   Reg_0 = 2
+    87   Stack_D = Reg_0
+    87   Reg_0 = 3
+    87   Stack_D = Reg_0
+    87   no-op
+           optimizes   call Sym_61
+    78   call Sym_62
+    78   no-op
+           optimizes   call Sym_15
+    78   Reg_1 = Stack_D
+    78   Reg_0 = Stack_D
+    78   Reg_0 += Reg_1
+    78   Stack_D = Reg_0
+    87   call Sym_40
+    87   Reg_0 = 2
+    87   Stack_D = Reg_0
+    87   Reg_0 = 3
+    87   Stack_D = Reg_0
+    87   Reg_0 = 5
+    87   Stack_D = Reg_0
+    87   call Sym_41
+    88   Reg_0 = 1720
+    88   Stack_D = Reg_0
+    88   call Sym_39
+    88   call Sym_63
+    88   call Sym_40
+    88   Reg_0 = 45
+    88   Stack_D = Reg_0
+    88   call Sym_41
+    89   Reg_0 = 1730
+    89   Stack_D = Reg_0
+    89   call Sym_39
+    89   call Sym_64
+    89   call Sym_40
+    89   Reg_0 = 138
+    89   Stack_D = Reg_0
+    89   call Sym_41
+    90   Reg_0 = 1740
+    90   Stack_D = Reg_0
+    90   call Sym_39
+    90   Reg_0 = 6
+    90   no-op
+           optimizes   Stack_D = Reg_0
+    90   no-op
+           optimizes   call Sym_66
+    81   no-op
+           optimizes   call Sym_55
+    81   no-op
+           optimizes   Reg_0 = Stack_D
+    81   Frame_0 = Reg_0
+    81   no-op
+           optimizes   call Sym_67
+    81   Reg_0 = Frame_0
+    81   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    81   no-op
+           optimizes   call Sym_56
+    81   Reg_0 = Frame_0
+    81   no-op
+           optimizes   Stack_D = Reg_0
+    81   no-op
+           optimizes   call Sym_15
+    81   Reg_1 = Reg_0
+           optimizes   Reg_1 = Stack_D
+    81   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    81   Reg_0 += Reg_1
+    81   Stack_D = Reg_0
+    90   call Sym_40
+    90   Reg_0 = 12
+    90   Stack_D = Reg_0
+    90   call Sym_41
+    91   Reg_0 = 1750
+    91   Stack_D = Reg_0
+    91   call Sym_39
+    91   Reg_0 = 42
+    91   no-op
+           optimizes   Stack_D = Reg_0
+    91   no-op
+           optimizes   call Sym_69
+    83   no-op
+           optimizes   Reg_0 = Sym_68
+    83   no-op
+           optimizes   Stack_D = Reg_0
+    83   no-op
+           optimizes   call Sym_5
+    83   no-op
+           optimizes   Reg_0 = Stack_D
+    83   *(Sym_68) = Reg_0
+    91   no-op
+           optimizes   call Sym_70
+    84   no-op
+           optimizes   Reg_0 = Sym_68
+    84   no-op
+           optimizes   Stack_D = Reg_0
+    84   no-op
+           optimizes   call Sym_71
+    84   no-op
+           optimizes   Reg_0 = *(Sym_68)
+    84   Stack_D = Reg_0
+    91   call Sym_40
+    91   Reg_0 = 42
+    91   Stack_D = Reg_0
+    91   call Sym_41
+    92   Reg_0 = 1760
+    92   Stack_D = Reg_0
+    92   call Sym_39
+    92   Reg_0 = 7
+    92   Stack_D = Reg_0
+    92   Reg_0 = Sym_60
+    92   Stack_D = Reg_0
+    92   call Sym_7
+    92   call Sym_40
+    92   Reg_0 = 49
+    92   Stack_D = Reg_0
+    92   call Sym_41
+    93   Reg_0 = 1770
+    93   Stack_D = Reg_0
+    93   call Sym_39
+    93   Reg_0 = 2
+    93   Stack_D = Reg_0
+    93   Reg_0 = 3
+    93   Stack_D = Reg_0
+    93   Reg_0 = Sym_61
+    93   Stack_D = Reg_0
+    93   call Sym_7
+    93   call Sym_40
+    93   Reg_0 = 2
+    93   Stack_D = Reg_0
+    93   Reg_0 = 3
+    93   Stack_D = Reg_0
+    93   Reg_0 = 5
+    93   Stack_D = Reg_0
+    93   call Sym_41
+    96   Reg_0 = Data_4
+    96   Stack_D = Reg_0
+    96   Reg_0 = 26
+    96   Stack_D = Reg_0
+    96   call Sym_0
+    96   call Sym_2
+   114   Reg_0 = 300
+   114   Stack_D = Reg_0
+   114   call Sym_39
+   114   Reg_0 = *(Sym_11)
+   114   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   114   Reg_0 = *(Sym_10)
+   114   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   114   no-op
+           optimizes   call Sym_72
+    98   no-op
+           optimizes   call Sym_73
+    98   no-op
+           optimizes   Reg_1 = Stack_D
+    98   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    98   if Reg_0 >= Reg_1 goto Label_262
+    98   no-op
+           optimizes   Reg_0 = Stack_D
+    98   no-op
+           optimizes   if Reg_0 == 0 goto Label_262
+    98   Reg_0 = 1
+    98   Stack_D = Reg_0
+    98   goto Label_263
+    98 label Label_262
+    98   Reg_0 = 0
+    98   Stack_D = Reg_0
+    98 label Label_263
+   114   call Sym_40
+   114   Reg_0 = 1
+   114   Stack_D = Reg_0
+   114   call Sym_41
+   115   Reg_0 = 310
+   115   Stack_D = Reg_0
+   115   call Sym_39
+   115   Reg_0 = *(Sym_10)
+   115   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   115   Reg_0 = *(Sym_11)
+   115   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   115   no-op
+           optimizes   call Sym_72
+    98   no-op
+           optimizes   call Sym_73
+    98   no-op
+           optimizes   Reg_1 = Stack_D
+    98   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    98   if Reg_0 >= Reg_1 goto Label_264
+    98   no-op
+           optimizes   Reg_0 = Stack_D
+    98   no-op
+           optimizes   if Reg_0 == 0 goto Label_264
+    98   Reg_0 = 1
+    98   Stack_D = Reg_0
+    98   goto Label_265
+    98 label Label_264
+    98   Reg_0 = 0
+    98   Stack_D = Reg_0
+    98 label Label_265
+   115   call Sym_40
+   115   Reg_0 = 0
+   115   Stack_D = Reg_0
+   115   call Sym_41
+   116   Reg_0 = 320
+   116   Stack_D = Reg_0
+   116   call Sym_39
+   116   Reg_0 = -1
+   116   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   116   Reg_0 = -1
+   116   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   116   no-op
+           optimizes   call Sym_72
+    98   no-op
+           optimizes   call Sym_73
+    98   no-op
+           optimizes   Reg_1 = Stack_D
+    98   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    98   if Reg_0 >= Reg_1 goto Label_266
+    98   no-op
+           optimizes   Reg_0 = Stack_D
+    98   no-op
+           optimizes   if Reg_0 == 0 goto Label_266
+    98   Reg_0 = 1
+    98   Stack_D = Reg_0
+    98   goto Label_267
+    98 label Label_266
+    98   Reg_0 = 0
+    98   Stack_D = Reg_0
+    98 label Label_267
+   116   call Sym_40
+   116   Reg_0 = 0
+   116   Stack_D = Reg_0
+   116   call Sym_41
+   117   Reg_0 = 330
+   117   Stack_D = Reg_0
+   117   call Sym_39
+   117   Reg_0 = *(Sym_11)
+   117   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   117   Reg_0 = *(Sym_10)
+   117   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   117   no-op
+           optimizes   call Sym_74
+    99   no-op
+           optimizes   call Sym_75
+    99   no-op
+           optimizes   Reg_1 = Stack_D
+    99   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    99   if Reg_0 <= Reg_1 goto Label_268
+    99   no-op
+           optimizes   Reg_0 = Stack_D
+    99   no-op
+           optimizes   if Reg_0 == 0 goto Label_268
+    99   Reg_0 = 1
+    99   Stack_D = Reg_0
+    99   goto Label_269
+    99 label Label_268
+    99   Reg_0 = 0
+    99   Stack_D = Reg_0
+    99 label Label_269
+   117   call Sym_40
+   117   Reg_0 = 0
+   117   Stack_D = Reg_0
+   117   call Sym_41
+   118   Reg_0 = 340
+   118   Stack_D = Reg_0
+   118   call Sym_39
+   118   Reg_0 = *(Sym_10)
+   118   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   118   Reg_0 = *(Sym_11)
+   118   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   118   no-op
+           optimizes   call Sym_74
+    99   no-op
+           optimizes   call Sym_75
+    99   no-op
+           optimizes   Reg_1 = Stack_D
+    99   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    99   if Reg_0 <= Reg_1 goto Label_270
+    99   no-op
+           optimizes   Reg_0 = Stack_D
+    99   no-op
+           optimizes   if Reg_0 == 0 goto Label_270
+    99   Reg_0 = 1
+    99   Stack_D = Reg_0
+    99   goto Label_271
+    99 label Label_270
+    99   Reg_0 = 0
+    99   Stack_D = Reg_0
+    99 label Label_271
+   118   call Sym_40
+   118   Reg_0 = 1
+   118   Stack_D = Reg_0
+   118   call Sym_41
+   119   Reg_0 = 350
+   119   Stack_D = Reg_0
+   119   call Sym_39
+   119   Reg_0 = *(Sym_11)
+   119   no-op
+           optimizes   Stack_D = Reg_0
+   119   no-op
+           optimizes   Reg_0 = *(Sym_11)
+   119   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   119   no-op
+           optimizes   call Sym_76
+   100   no-op
+           optimizes   call Sym_77
+   100   no-op
+           optimizes   Reg_1 = Stack_D
+   100   no-op
+           optimizes   Reg_0 = Stack_D
+   100   if Reg_0 != Reg_1 goto Label_272
+   100   no-op
+           optimizes   Reg_0 = Stack_D
+   100   no-op
+           optimizes   if Reg_0 == 0 goto Label_272
+   100   Reg_0 = 1
+   100   Stack_D = Reg_0
+   100   goto Label_273
+   100 label Label_272
+   100   Reg_0 = 0
+   100   Stack_D = Reg_0
+   100 label Label_273
+   119   call Sym_40
+   119   Reg_0 = 1
+   119   Stack_D = Reg_0
+   119   call Sym_41
+   120   Reg_0 = 360
+   120   Stack_D = Reg_0
+   120   call Sym_39
+   120   Reg_0 = *(Sym_11)
+   120   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   120   Reg_0 = *(Sym_10)
+   120   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   120   no-op
+           optimizes   call Sym_76
+   100   no-op
+           optimizes   call Sym_77
+   100   no-op
+           optimizes   Reg_1 = Stack_D
+   100   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   100   if Reg_0 != Reg_1 goto Label_274
+   100   no-op
+           optimizes   Reg_0 = Stack_D
+   100   no-op
+           optimizes   if Reg_0 == 0 goto Label_274
+   100   Reg_0 = 1
+   100   Stack_D = Reg_0
+   100   goto Label_275
+   100 label Label_274
+   100   Reg_0 = 0
+   100   Stack_D = Reg_0
+   100 label Label_275
+   120   call Sym_40
+   120   Reg_0 = 0
+   120   Stack_D = Reg_0
+   120   call Sym_41
+   121   Reg_0 = 370
+   121   Stack_D = Reg_0
+   121   call Sym_39
+   121   Reg_0 = *(Sym_11)
+   121   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   121   Reg_0 = *(Sym_10)
+   121   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   121   no-op
+           optimizes   call Sym_78
+   101   no-op
+           optimizes   call Sym_79
+   101   no-op
+           optimizes   Reg_1 = Stack_D
+   101   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   101   if Reg_0 == Reg_1 goto Label_276
+   101   no-op
+           optimizes   Reg_0 = Stack_D
+   101   no-op
+           optimizes   if Reg_0 == 0 goto Label_276
+   101   Reg_0 = 1
+   101   Stack_D = Reg_0
+   101   goto Label_277
+   101 label Label_276
+   101   Reg_0 = 0
+   101   Stack_D = Reg_0
+   101 label Label_277
+   121   call Sym_40
+   121   Reg_0 = 1
+   121   Stack_D = Reg_0
+   121   call Sym_41
+   122   Reg_0 = 380
+   122   Stack_D = Reg_0
+   122   call Sym_39
+   122   Reg_0 = 0
+   122   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   122   Reg_0 = 0
+   122   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   122   no-op
+           optimizes   call Sym_78
+   101   no-op
+           optimizes   call Sym_79
+   101   no-op
+           optimizes   Reg_1 = Stack_D
+   101   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   101   if Reg_0 == Reg_1 goto Label_278
+   101   no-op
+           optimizes   Reg_0 = Stack_D
+   101   no-op
+           optimizes   if Reg_0 == 0 goto Label_278
+   101   Reg_0 = 1
+   101   Stack_D = Reg_0
+   101   goto Label_279
+   101 label Label_278
+   101   Reg_0 = 0
+   101   Stack_D = Reg_0
+   101 label Label_279
+   122   call Sym_40
+   122   Reg_0 = 0
+   122   Stack_D = Reg_0
+   122   call Sym_41
+   123   Reg_0 = 390
+   123   Stack_D = Reg_0
+   123   call Sym_39
+   123   Reg_0 = *(Sym_11)
+   123   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   123   Reg_0 = *(Sym_10)
+   123   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   123   no-op
+           optimizes   call Sym_80
+   102   no-op
+           optimizes   call Sym_81
+   102   no-op
+           optimizes   Reg_1 = Stack_D
+   102   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   102   if Reg_0 u>= Reg_1 goto Label_280
+   102   no-op
+           optimizes   Reg_0 = Stack_D
+   102   no-op
+           optimizes   if Reg_0 == 0 goto Label_280
+   102   Reg_0 = 1
+   102   Stack_D = Reg_0
+   102   goto Label_281
+   102 label Label_280
+   102   Reg_0 = 0
+   102   Stack_D = Reg_0
+   102 label Label_281
+   123   call Sym_40
+   123   Reg_0 = 0
+   123   Stack_D = Reg_0
+   123   call Sym_41
+   124   Reg_0 = 400
+   124   Stack_D = Reg_0
+   124   call Sym_39
+   124   Reg_0 = *(Sym_10)
+   124   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   124   Reg_0 = *(Sym_11)
+   124   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   124   no-op
+           optimizes   call Sym_80
+   102   no-op
+           optimizes   call Sym_81
+   102   no-op
+           optimizes   Reg_1 = Stack_D
+   102   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   102   if Reg_0 u>= Reg_1 goto Label_282
+   102   no-op
+           optimizes   Reg_0 = Stack_D
+   102   no-op
+           optimizes   if Reg_0 == 0 goto Label_282
+   102   Reg_0 = 1
+   102   Stack_D = Reg_0
+   102   goto Label_283
+   102 label Label_282
+   102   Reg_0 = 0
+   102   Stack_D = Reg_0
+   102 label Label_283
+   124   call Sym_40
+   124   Reg_0 = 1
+   124   Stack_D = Reg_0
+   124   call Sym_41
+   125   Reg_0 = 410
+   125   Stack_D = Reg_0
+   125   call Sym_39
+   125   Reg_0 = 0
+   125   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   125   Reg_0 = *(Sym_8)
+   125   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   125   no-op
+           optimizes   call Sym_80
+   102   no-op
+           optimizes   call Sym_81
+   102   no-op
+           optimizes   Reg_1 = Stack_D
+   102   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   102   if Reg_0 u>= Reg_1 goto Label_284
+   102   no-op
+           optimizes   Reg_0 = Stack_D
+   102   no-op
+           optimizes   if Reg_0 == 0 goto Label_284
+   102   Reg_0 = 1
+   102   Stack_D = Reg_0
+   102   goto Label_285
+   102 label Label_284
+   102   Reg_0 = 0
+   102   Stack_D = Reg_0
+   102 label Label_285
+   125   call Sym_40
+   125   Reg_0 = 1
+   125   Stack_D = Reg_0
+   125   call Sym_41
+   126   Reg_0 = 420
+   126   Stack_D = Reg_0
+   126   call Sym_39
+   126   Reg_0 = *(Sym_11)
+   126   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   126   Reg_0 = *(Sym_10)
+   126   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   126   no-op
+           optimizes   call Sym_82
+   103   no-op
+           optimizes   call Sym_83
+   103   no-op
+           optimizes   Reg_1 = Stack_D
+   103   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   103   if Reg_0 u<= Reg_1 goto Label_286
+   103   no-op
+           optimizes   Reg_0 = Stack_D
+   103   no-op
+           optimizes   if Reg_0 == 0 goto Label_286
+   103   Reg_0 = 1
+   103   Stack_D = Reg_0
+   103   goto Label_287
+   103 label Label_286
+   103   Reg_0 = 0
+   103   Stack_D = Reg_0
+   103 label Label_287
+   126   call Sym_40
+   126   Reg_0 = 1
+   126   Stack_D = Reg_0
+   126   call Sym_41
+   127   Reg_0 = 430
+   127   Stack_D = Reg_0
+   127   call Sym_39
+   127   Reg_0 = *(Sym_8)
+   127   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   127   Reg_0 = 0
+   127   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   127   no-op
+           optimizes   call Sym_82
+   103   no-op
+           optimizes   call Sym_83
+   103   no-op
+           optimizes   Reg_1 = Stack_D
+   103   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   103   if Reg_0 u<= Reg_1 goto Label_288
+   103   no-op
+           optimizes   Reg_0 = Stack_D
+   103   no-op
+           optimizes   if Reg_0 == 0 goto Label_288
+   103   Reg_0 = 1
+   103   Stack_D = Reg_0
+   103   goto Label_289
+   103 label Label_288
+   103   Reg_0 = 0
+   103   Stack_D = Reg_0
+   103 label Label_289
+   127   call Sym_40
+   127   Reg_0 = 1
+   127   Stack_D = Reg_0
+   127   call Sym_41
+   128   Reg_0 = 440
+   128   Stack_D = Reg_0
+   128   call Sym_39
+   128   Reg_0 = *(Sym_11)
+   128   no-op
+           optimizes   Stack_D = Reg_0
+   128   no-op
+           optimizes   Reg_0 = *(Sym_11)
+   128   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   128   no-op
+           optimizes   call Sym_84
+   104   no-op
+           optimizes   call Sym_85
+   104   no-op
+           optimizes   Reg_1 = Stack_D
+   104   no-op
+           optimizes   Reg_0 = Stack_D
+   104   if Reg_0 u> Reg_1 goto Label_290
+   104   no-op
+           optimizes   Reg_0 = Stack_D
+   104   no-op
+           optimizes   if Reg_0 == 0 goto Label_290
+   104   Reg_0 = 1
+   104   Stack_D = Reg_0
+   104   goto Label_291
+   104 label Label_290
+   104   Reg_0 = 0
+   104   Stack_D = Reg_0
+   104 label Label_291
+   128   call Sym_40
+   128   Reg_0 = 1
+   128   Stack_D = Reg_0
+   128   call Sym_41
+   129   Reg_0 = 450
+   129   Stack_D = Reg_0
+   129   call Sym_39
+   129   Reg_0 = *(Sym_11)
+   129   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   129   Reg_0 = *(Sym_10)
+   129   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   129   no-op
+           optimizes   call Sym_84
+   104   no-op
+           optimizes   call Sym_85
+   104   no-op
+           optimizes   Reg_1 = Stack_D
+   104   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   104   if Reg_0 u> Reg_1 goto Label_292
+   104   no-op
+           optimizes   Reg_0 = Stack_D
+   104   no-op
+           optimizes   if Reg_0 == 0 goto Label_292
+   104   Reg_0 = 1
+   104   Stack_D = Reg_0
+   104   goto Label_293
+   104 label Label_292
+   104   Reg_0 = 0
+   104   Stack_D = Reg_0
+   104 label Label_293
+   129   call Sym_40
+   129   Reg_0 = 0
+   129   Stack_D = Reg_0
+   129   call Sym_41
+   130   Reg_0 = 460
+   130   Stack_D = Reg_0
+   130   call Sym_39
+   130   Reg_0 = *(Sym_10)
+   130   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   130   Reg_0 = *(Sym_11)
+   130   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   130   no-op
+           optimizes   call Sym_86
+   105   no-op
+           optimizes   call Sym_87
+   105   no-op
+           optimizes   Reg_1 = Stack_D
+   105   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   105   if Reg_0 u< Reg_1 goto Label_294
+   105   no-op
+           optimizes   Reg_0 = Stack_D
+   105   no-op
+           optimizes   if Reg_0 == 0 goto Label_294
+   105   Reg_0 = 1
+   105   Stack_D = Reg_0
+   105   goto Label_295
+   105 label Label_294
+   105   Reg_0 = 0
+   105   Stack_D = Reg_0
+   105 label Label_295
+   130   call Sym_40
+   130   Reg_0 = 0
+   130   Stack_D = Reg_0
+   130   call Sym_41
+   131   Reg_0 = 470
+   131   Stack_D = Reg_0
+   131   call Sym_39
+   131   Reg_0 = *(Sym_8)
+   131   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   131   Reg_0 = *(Sym_11)
+   131   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   131   no-op
+           optimizes   call Sym_86
+   105   no-op
+           optimizes   call Sym_87
+   105   no-op
+           optimizes   Reg_1 = Stack_D
+   105   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   105   if Reg_0 u< Reg_1 goto Label_296
+   105   no-op
+           optimizes   Reg_0 = Stack_D
+   105   no-op
+           optimizes   if Reg_0 == 0 goto Label_296
+   105   Reg_0 = 1
+   105   Stack_D = Reg_0
+   105   goto Label_297
+   105 label Label_296
+   105   Reg_0 = 0
+   105   Stack_D = Reg_0
+   105 label Label_297
+   131   call Sym_40
+   131   Reg_0 = 1
+   131   Stack_D = Reg_0
+   131   call Sym_41
+   132   Reg_0 = 480
+   132   Stack_D = Reg_0
+   132   call Sym_39
+   132   Reg_0 = 0
+   132   no-op
+           optimizes   Stack_D = Reg_0
+   132   no-op
+           optimizes   call Sym_88
+   106   no-op
+           optimizes   call Sym_44
+   106   no-op
+           optimizes   Reg_0 = Stack_D
+   106   if Reg_0 != 0 goto Label_298
+   106   no-op
+           optimizes   Reg_0 = Stack_D
+   106   no-op
+           optimizes   if Reg_0 == 0 goto Label_298
+   106   Reg_0 = 1
+   106   Stack_D = Reg_0
+   106   goto Label_299
+   106 label Label_298
+   106   Reg_0 = 0
+   106   Stack_D = Reg_0
+   106 label Label_299
+   132   call Sym_40
+   132   Reg_0 = 1
+   132   Stack_D = Reg_0
+   132   call Sym_41
+   133   Reg_0 = 490
+   133   Stack_D = Reg_0
+   133   call Sym_39
+   133   Reg_0 = *(Sym_11)
+   133   no-op
+           optimizes   Stack_D = Reg_0
+   133   no-op
+           optimizes   call Sym_88
+   106   no-op
+           optimizes   call Sym_44
+   106   no-op
+           optimizes   Reg_0 = Stack_D
+   106   if Reg_0 != 0 goto Label_300
+   106   no-op
+           optimizes   Reg_0 = Stack_D
+   106   no-op
+           optimizes   if Reg_0 == 0 goto Label_300
+   106   Reg_0 = 1
+   106   Stack_D = Reg_0
+   106   goto Label_301
+   106 label Label_300
+   106   Reg_0 = 0
+   106   Stack_D = Reg_0
+   106 label Label_301
+   133   call Sym_40
+   133   Reg_0 = 0
+   133   Stack_D = Reg_0
+   133   call Sym_41
+   134   Reg_0 = 500
+   134   Stack_D = Reg_0
+   134   call Sym_39
+   134   Reg_0 = *(Sym_11)
+   134   no-op
+           optimizes   Stack_D = Reg_0
+   134   no-op
+           optimizes   call Sym_89
+   107   no-op
+           optimizes   call Sym_53
+   107   no-op
+           optimizes   Reg_0 = Stack_D
+   107   if Reg_0 >= 0 goto Label_302
+   107   no-op
+           optimizes   Reg_0 = Stack_D
+   107   no-op
+           optimizes   if Reg_0 == 0 goto Label_302
+   107   Reg_0 = 1
+   107   Stack_D = Reg_0
+   107   goto Label_303
+   107 label Label_302
+   107   Reg_0 = 0
+   107   Stack_D = Reg_0
+   107 label Label_303
+   134   call Sym_40
+   134   Reg_0 = 1
+   134   Stack_D = Reg_0
+   134   call Sym_41
+   135   Reg_0 = 510
+   135   Stack_D = Reg_0
+   135   call Sym_39
+   135   Reg_0 = *(Sym_10)
+   135   no-op
+           optimizes   Stack_D = Reg_0
+   135   no-op
+           optimizes   call Sym_89
+   107   no-op
+           optimizes   call Sym_53
+   107   no-op
+           optimizes   Reg_0 = Stack_D
+   107   if Reg_0 >= 0 goto Label_304
+   107   no-op
+           optimizes   Reg_0 = Stack_D
+   107   no-op
+           optimizes   if Reg_0 == 0 goto Label_304
+   107   Reg_0 = 1
+   107   Stack_D = Reg_0
+   107   goto Label_305
+   107 label Label_304
+   107   Reg_0 = 0
+   107   Stack_D = Reg_0
+   107 label Label_305
+   135   call Sym_40
+   135   Reg_0 = 0
+   135   Stack_D = Reg_0
+   135   call Sym_41
+   136   Reg_0 = 520
+   136   Stack_D = Reg_0
+   136   call Sym_39
+   136   Reg_0 = *(Sym_11)
+   136   no-op
+           optimizes   Stack_D = Reg_0
+   136   no-op
+           optimizes   call Sym_90
+   108   no-op
+           optimizes   call Sym_91
+   108   no-op
+           optimizes   Reg_0 = Stack_D
+   108   if Reg_0 <= 0 goto Label_306
+   108   no-op
+           optimizes   Reg_0 = Stack_D
+   108   no-op
+           optimizes   if Reg_0 == 0 goto Label_306
+   108   Reg_0 = 1
+   108   Stack_D = Reg_0
+   108   goto Label_307
+   108 label Label_306
+   108   Reg_0 = 0
+   108   Stack_D = Reg_0
+   108 label Label_307
+   136   call Sym_40
+   136   Reg_0 = 0
+   136   Stack_D = Reg_0
+   136   call Sym_41
+   137   Reg_0 = 530
+   137   Stack_D = Reg_0
+   137   call Sym_39
+   137   Reg_0 = *(Sym_10)
+   137   no-op
+           optimizes   Stack_D = Reg_0
+   137   no-op
+           optimizes   call Sym_90
+   108   no-op
+           optimizes   call Sym_91
+   108   no-op
+           optimizes   Reg_0 = Stack_D
+   108   if Reg_0 <= 0 goto Label_308
+   108   no-op
+           optimizes   Reg_0 = Stack_D
+   108   no-op
+           optimizes   if Reg_0 == 0 goto Label_308
+   108   Reg_0 = 1
+   108   Stack_D = Reg_0
+   108   goto Label_309
+   108 label Label_308
+   108   Reg_0 = 0
+   108   Stack_D = Reg_0
+   108 label Label_309
+   137   call Sym_40
+   137   Reg_0 = 1
+   137   Stack_D = Reg_0
+   137   call Sym_41
+   138   Reg_0 = 540
+   138   Stack_D = Reg_0
+   138   call Sym_39
+   138   Reg_0 = 4
+   138   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   138   no-op
+           optimizes   call Sym_92
+   109   Reg_0 = 5
+   109   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   109   no-op
+           optimizes   call Sym_73
+   109   no-op
+           optimizes   Reg_1 = Stack_D
+   109   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   109   if Reg_0 >= Reg_1 goto Label_310
+   109   no-op
+           optimizes   Reg_0 = Stack_D
+   109   no-op
+           optimizes   if Reg_0 == 0 goto Label_310
+   109   Reg_0 = 1
+   109   Stack_D = Reg_0
+   109   goto Label_311
+   109 label Label_310
+   109   Reg_0 = 0
+   109   Stack_D = Reg_0
+   109 label Label_311
+   138   call Sym_40
+   138   Reg_0 = 1
+   138   Stack_D = Reg_0
+   138   call Sym_41
+   139   Reg_0 = 550
+   139   Stack_D = Reg_0
+   139   call Sym_39
+   139   Reg_0 = 5
+   139   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   139   no-op
+           optimizes   call Sym_92
+   109   Reg_0 = 5
+   109   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   109   no-op
+           optimizes   call Sym_73
+   109   no-op
+           optimizes   Reg_1 = Stack_D
+   109   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   109   if Reg_0 >= Reg_1 goto Label_312
+   109   no-op
+           optimizes   Reg_0 = Stack_D
+   109   no-op
+           optimizes   if Reg_0 == 0 goto Label_312
+   109   Reg_0 = 1
+   109   Stack_D = Reg_0
+   109   goto Label_313
+   109 label Label_312
+   109   Reg_0 = 0
+   109   Stack_D = Reg_0
+   109 label Label_313
+   139   call Sym_40
+   139   Reg_0 = 0
+   139   Stack_D = Reg_0
+   139   call Sym_41
+   140   Reg_0 = 560
+   140   Stack_D = Reg_0
+   140   call Sym_39
+   140   Reg_0 = *(Sym_11)
+   140   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   140   no-op
+           optimizes   call Sym_92
+   109   Reg_0 = 5
+   109   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   109   no-op
+           optimizes   call Sym_73
+   109   no-op
+           optimizes   Reg_1 = Stack_D
+   109   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   109   if Reg_0 >= Reg_1 goto Label_314
+   109   no-op
+           optimizes   Reg_0 = Stack_D
+   109   no-op
+           optimizes   if Reg_0 == 0 goto Label_314
+   109   Reg_0 = 1
+   109   Stack_D = Reg_0
+   109   goto Label_315
+   109 label Label_314
+   109   Reg_0 = 0
+   109   Stack_D = Reg_0
+   109 label Label_315
+   140   call Sym_40
+   140   Reg_0 = 1
+   140   Stack_D = Reg_0
+   140   call Sym_41
+   141   Reg_0 = 570
+   141   Stack_D = Reg_0
+   141   call Sym_39
+   141   Reg_0 = *(Sym_10)
+   141   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   141   no-op
+           optimizes   call Sym_92
+   109   Reg_0 = 5
+   109   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   109   no-op
+           optimizes   call Sym_73
+   109   no-op
+           optimizes   Reg_1 = Stack_D
+   109   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   109   if Reg_0 >= Reg_1 goto Label_316
+   109   no-op
+           optimizes   Reg_0 = Stack_D
+   109   no-op
+           optimizes   if Reg_0 == 0 goto Label_316
+   109   Reg_0 = 1
+   109   Stack_D = Reg_0
+   109   goto Label_317
+   109 label Label_316
+   109   Reg_0 = 0
+   109   Stack_D = Reg_0
+   109 label Label_317
+   141   call Sym_40
+   141   Reg_0 = 0
+   141   Stack_D = Reg_0
+   141   call Sym_41
+   142   Reg_0 = 580
+   142   Stack_D = Reg_0
+   142   call Sym_39
+   142   Reg_0 = 5
+   142   Stack_D = Reg_0
+   142   no-op
+           optimizes   call Sym_93
+   110   Reg_0 = 0
+   110   Stack_D = Reg_0
+   110 label Label_318
+   110   call Sym_48
+   110   no-op
+           optimizes   call Sym_91
+   110   Reg_0 = Stack_D
+   110   if Reg_0 <= 0 goto Label_319
+   110   no-op
+           optimizes   Reg_0 = Stack_D
+   110   no-op
+           optimizes   if Reg_0 == 0 goto Label_319
+   110   no-op
+           optimizes   call Sym_19
+   110   Reg_0 = Stack_D
+   110   Reg_0 += 1
+   110   Stack_D = Reg_0
+   110   call Sym_47
+   110   no-op
+           optimizes   call Sym_22
+   110   Reg_0 = Stack_D
+   110   Reg_0 -= 1
+   110   Stack_D = Reg_0
+   110   call Sym_47
+   110   goto Label_318
+   110 label Label_319
+   110   call Sym_94
+   142   call Sym_40
+   142   Reg_0 = 5
+   142   Stack_D = Reg_0
+   142   call Sym_41
+   143   Reg_0 = 590
+   143   Stack_D = Reg_0
+   143   call Sym_39
+   143   Reg_0 = 0
+   143   Stack_D = Reg_0
+   143   no-op
+           optimizes   call Sym_93
+   110   Reg_0 = 0
+   110   Stack_D = Reg_0
+   110 label Label_320
+   110   call Sym_48
+   110   no-op
+           optimizes   call Sym_91
+   110   Reg_0 = Stack_D
+   110   if Reg_0 <= 0 goto Label_321
+   110   no-op
+           optimizes   Reg_0 = Stack_D
+   110   no-op
+           optimizes   if Reg_0 == 0 goto Label_321
+   110   no-op
+           optimizes   call Sym_19
+   110   Reg_0 = Stack_D
+   110   Reg_0 += 1
+   110   Stack_D = Reg_0
+   110   call Sym_47
+   110   no-op
+           optimizes   call Sym_22
+   110   Reg_0 = Stack_D
+   110   Reg_0 -= 1
+   110   Stack_D = Reg_0
+   110   call Sym_47
+   110   goto Label_320
+   110 label Label_321
+   110   call Sym_94
+   143   call Sym_40
+   143   Reg_0 = 0
+   143   Stack_D = Reg_0
+   143   call Sym_41
+   144   Reg_0 = 600
+   144   Stack_D = Reg_0
+   144   call Sym_39
+   144   Reg_0 = *(Sym_11)
+   144   Stack_D = Reg_0
+   144   no-op
+           optimizes   call Sym_93
+   110   Reg_0 = 0
+   110   Stack_D = Reg_0
+   110 label Label_322
+   110   call Sym_48
+   110   no-op
+           optimizes   call Sym_91
+   110   Reg_0 = Stack_D
+   110   if Reg_0 <= 0 goto Label_323
+   110   no-op
+           optimizes   Reg_0 = Stack_D
+   110   no-op
+           optimizes   if Reg_0 == 0 goto Label_323
+   110   no-op
+           optimizes   call Sym_19
+   110   Reg_0 = Stack_D
+   110   Reg_0 += 1
+   110   Stack_D = Reg_0
+   110   call Sym_47
+   110   no-op
+           optimizes   call Sym_22
+   110   Reg_0 = Stack_D
+   110   Reg_0 -= 1
+   110   Stack_D = Reg_0
+   110   call Sym_47
+   110   goto Label_322
+   110 label Label_323
+   110   call Sym_94
+   144   call Sym_40
+   144   Reg_0 = 0
+   144   Stack_D = Reg_0
+   144   call Sym_41
+   145   Reg_0 = 610
+   145   Stack_D = Reg_0
+   145   call Sym_39
+   145   Reg_0 = 7
+   145   Stack_D = Reg_0
+   145   no-op
+           optimizes   call Sym_95
+   111   Reg_0 = 0
+   111   Stack_D = Reg_0
+   111 label Label_324
+   111   no-op
+           optimizes   call Sym_19
+   111   Reg_0 = Stack_D
+   111   Reg_0 += 1
+   111   Stack_D = Reg_0
+   111   call Sym_62
+   111   no-op
+           optimizes   call Sym_77
+   111   Reg_1 = Stack_D
+   111   Reg_0 = Stack_D
+   111   if Reg_0 != Reg_1 goto Label_324
+   111   no-op
+           optimizes   Reg_0 = Stack_D
+   111   no-op
+           optimizes   if Reg_0 == 0 goto Label_324
+   111   call Sym_94
+   145   call Sym_40
+   145   Reg_0 = 7
+   145   Stack_D = Reg_0
+   145   call Sym_41
+   146   Reg_0 = 620
+   146   Stack_D = Reg_0
+   146   call Sym_39
+   146   Reg_0 = 1
+   146   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   146   Reg_0 = 2
+   146   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   146   no-op
+           optimizes   call Sym_96
+   112   no-op
+           optimizes   call Sym_73
+   112   no-op
+           optimizes   Reg_1 = Stack_D
+   112   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   112   Reg_0 = Reg_0 < Reg_1
+   112   Stack_D = Reg_0
+   112   call Sym_43
+   112   Reg_0 = Stack_D
+   112   if Reg_0 == 0 goto Label_325
+   112   call Sym_46
+   112   Reg_0 = *(Sym_13)
+   112   Stack_D = Reg_0
+   112 label Label_325
+   146   call Sym_40
+   146   Reg_0 = *(Sym_13)
+   146   Stack_D = Reg_0
+   146   call Sym_41
+   147   Reg_0 = 630
+   147   Stack_D = Reg_0
+   147   call Sym_39
+   147   Reg_0 = 2
+   147   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   147   Reg_0 = 1
+   147   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   147   no-op
+           optimizes   call Sym_96
+   112   no-op
+           optimizes   call Sym_73
+   112   no-op
+           optimizes   Reg_1 = Stack_D
+   112   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   112   Reg_0 = Reg_0 < Reg_1
+   112   Stack_D = Reg_0
+   112   call Sym_43
+   112   Reg_0 = Stack_D
+   112   if Reg_0 == 0 goto Label_326
+   112   call Sym_46
+   112   Reg_0 = *(Sym_13)
+   112   Stack_D = Reg_0
+   112 label Label_326
+   147   call Sym_40
+   147   Reg_0 = 0
+           optimizes   Reg_0 = *(Sym_12)
+   147   Stack_D = Reg_0
+   147   call Sym_41
+   150   Reg_0 = Data_5
+   150   Stack_D = Reg_0
+   150   Reg_0 = 21
+   150   Stack_D = Reg_0
+   150   call Sym_0
+   150   call Sym_2
+   178   Reg_0 = 700
+   178   Stack_D = Reg_0
+   178   call Sym_39
+   178   Reg_0 = -1
+   178   Stack_D = Reg_0
+   178   call Sym_97
+   178   call Sym_40
+   178   Reg_0 = 99
+   178   Stack_D = Reg_0
+   178   call Sym_41
+   179   Reg_0 = 710
+   179   Stack_D = Reg_0
+   179   call Sym_39
+   179   Reg_0 = 0
+   179   Stack_D = Reg_0
+   179   call Sym_97
+   179   call Sym_40
+   179   Reg_0 = 10
+   179   Stack_D = Reg_0
+   179   call Sym_41
+   180   Reg_0 = 720
+   180   Stack_D = Reg_0
+   180   call Sym_39
+   180   Reg_0 = 3
+   180   Stack_D = Reg_0
+   180   call Sym_97
+   180   call Sym_40
+   180   Reg_0 = 13
+   180   Stack_D = Reg_0
+   180   call Sym_41
+   181   Reg_0 = 730
+   181   Stack_D = Reg_0
+   181   call Sym_39
+   181   Reg_0 = 5
+   181   Stack_D = Reg_0
+   181   call Sym_97
+   181   call Sym_40
+   181   Reg_0 = 15
+   181   Stack_D = Reg_0
+   181   call Sym_41
+   182   Reg_0 = 740
+   182   Stack_D = Reg_0
+   182   call Sym_39
+   182   Reg_0 = 6
+   182   Stack_D = Reg_0
+   182   call Sym_97
+   182   call Sym_40
+   182   Reg_0 = 106
+   182   Stack_D = Reg_0
+   182   call Sym_41
+   183   Reg_0 = 750
+   183   Stack_D = Reg_0
+   183   call Sym_39
+   183   Reg_0 = *(Sym_11)
+   183   Stack_D = Reg_0
+   183   call Sym_97
+   183   call Sym_40
+   183   Reg_0 = *(Sym_11)
+   183   Stack_D = Reg_0
+   183   Reg_0 = 100
+   183   Stack_D = Reg_0
+   183   Reg_0 = Sym_15
+   183   Stack_D = Reg_0
+   183   call Sym_7
+   183   call Sym_41
+   184   Reg_0 = 760
+   184   Stack_D = Reg_0
+   184   call Sym_39
+   184   Reg_0 = *(Sym_10)
+   184   Stack_D = Reg_0
+   184   call Sym_97
+   184   call Sym_40
+   184   Reg_0 = *(Sym_10)
+   184   Stack_D = Reg_0
+   184   Reg_0 = 100
+   184   Stack_D = Reg_0
+   184   Reg_0 = Sym_15
+   184   Stack_D = Reg_0
+   184   call Sym_7
+   184   call Sym_41
+   185   Reg_0 = 770
+   185   Stack_D = Reg_0
+   185   call Sym_39
+   185   Reg_0 = -3
+   185   Stack_D = Reg_0
+   185   call Sym_98
+   185   call Sym_40
+   185   Reg_0 = 0
+   185   Stack_D = Reg_0
+   185   call Sym_41
+   186   Reg_0 = 780
+   186   Stack_D = Reg_0
+   186   call Sym_39
+   186   Reg_0 = -2
+   186   Stack_D = Reg_0
+   186   call Sym_98
+   186   call Sym_40
+   186   Reg_0 = 1
+   186   Stack_D = Reg_0
+   186   call Sym_41
+   187   Reg_0 = 790
+   187   Stack_D = Reg_0
+   187   call Sym_39
+   187   Reg_0 = 0
+   187   Stack_D = Reg_0
+   187   call Sym_98
+   187   call Sym_40
+   187   Reg_0 = 3
+   187   Stack_D = Reg_0
+   187   call Sym_41
+   188   Reg_0 = 800
+   188   Stack_D = Reg_0
+   188   call Sym_39
+   188   Reg_0 = 1
+   188   Stack_D = Reg_0
+   188   call Sym_98
+   188   call Sym_40
+   188   Reg_0 = 0
+   188   Stack_D = Reg_0
+   188   call Sym_41
+   189   Reg_0 = 810
+   189   Stack_D = Reg_0
+   189   call Sym_39
+   189   Reg_0 = 3
+   189   Stack_D = Reg_0
+   189   call Sym_98
+   189   call Sym_40
+   189   Reg_0 = 5
+   189   Stack_D = Reg_0
+   189   call Sym_41
+   190   Reg_0 = 820
+   190   Stack_D = Reg_0
+   190   call Sym_39
+   190   Reg_0 = 4
+   190   Stack_D = Reg_0
+   190   call Sym_98
+   190   call Sym_40
+   190   Reg_0 = 0
+   190   Stack_D = Reg_0
+   190   call Sym_41
+   191   Reg_0 = 830
+   191   Stack_D = Reg_0
+   191   call Sym_39
+   191   Reg_0 = -1000
+   191   Stack_D = Reg_0
+   191   call Sym_99
+   191   call Sym_40
+   191   Reg_0 = 1
+   191   Stack_D = Reg_0
+   191   call Sym_41
+   192   Reg_0 = 840
+   192   Stack_D = Reg_0
+   192   call Sym_39
+   192   Reg_0 = -1
+   192   Stack_D = Reg_0
+   192   call Sym_99
+   192   call Sym_40
+   192   Reg_0 = 2
+   192   Stack_D = Reg_0
+   192   call Sym_41
+   193   Reg_0 = 850
+   193   Stack_D = Reg_0
+   193   call Sym_39
+   193   Reg_0 = 7
+   193   Stack_D = Reg_0
+   193   call Sym_99
+   193   call Sym_40
+   193   Reg_0 = 3
+   193   Stack_D = Reg_0
+   193   call Sym_41
+   194   Reg_0 = 860
+   194   Stack_D = Reg_0
+   194   call Sym_39
+   194   Reg_0 = 100
+   194   Stack_D = Reg_0
+   194   call Sym_99
+   194   call Sym_40
+   194   Reg_0 = 4
+   194   Stack_D = Reg_0
+   194   call Sym_41
+   195   Reg_0 = 870
+   195   Stack_D = Reg_0
+   195   call Sym_39
+   195   Reg_0 = 1000
+   195   Stack_D = Reg_0
+   195   call Sym_99
+   195   call Sym_40
+   195   Reg_0 = 5
+   195   Stack_D = Reg_0
+   195   call Sym_41
+   196   Reg_0 = 880
+   196   Stack_D = Reg_0
+   196   call Sym_39
+   196   Reg_0 = 65536
+   196   Stack_D = Reg_0
+   196   call Sym_99
+   196   call Sym_40
+   196   Reg_0 = 6
+   196   Stack_D = Reg_0
+   196   call Sym_41
+   197   Reg_0 = 890
+   197   Stack_D = Reg_0
+   197   call Sym_39
+   197   Reg_0 = -1001
+   197   Stack_D = Reg_0
+   197   call Sym_99
+   197   call Sym_40
+   197   Reg_0 = 0
+   197   Stack_D = Reg_0
+   197   call Sym_41
+   198   Reg_0 = 900
+   198   Stack_D = Reg_0
+   198   call Sym_39
+   198   Reg_0 = 0
+   198   Stack_D = Reg_0
+   198   call Sym_99
+   198   call Sym_40
+   198   Reg_0 = 0
+   198   Stack_D = Reg_0
+   198   call Sym_41
+   199   Reg_0 = 910
+   199   Stack_D = Reg_0
+   199   call Sym_39
+   199   Reg_0 = 8
+   199   Stack_D = Reg_0
+   199   call Sym_99
+   199   call Sym_40
+   199   Reg_0 = 0
+   199   Stack_D = Reg_0
+   199   call Sym_41
+   200   Reg_0 = 920
+   200   Stack_D = Reg_0
+   200   call Sym_39
+   200   Reg_0 = 999
+   200   Stack_D = Reg_0
+   200   call Sym_99
+   200   call Sym_40
+   200   Reg_0 = 0
+   200   Stack_D = Reg_0
+   200   call Sym_41
+   201   Reg_0 = 930
+   201   Stack_D = Reg_0
+   201   call Sym_39
+   201   Reg_0 = 65537
+   201   Stack_D = Reg_0
+   201   call Sym_99
+   201   call Sym_40
+   201   Reg_0 = 0
+   201   Stack_D = Reg_0
+   201   call Sym_41
+   202   Reg_0 = 940
+   202   Stack_D = Reg_0
+   202   call Sym_39
+   202   Reg_0 = *(Sym_11)
+   202   Stack_D = Reg_0
+   202   call Sym_99
+   202   call Sym_40
+   202   Reg_0 = 0
+   202   Stack_D = Reg_0
+   202   call Sym_41
+   203   Reg_0 = 950
+   203   Stack_D = Reg_0
+   203   call Sym_39
+   203   Reg_0 = *(Sym_10)
+   203   Stack_D = Reg_0
+   203   call Sym_99
+   203   call Sym_40
+   203   Reg_0 = 0
+   203   Stack_D = Reg_0
+   203   call Sym_41
+   204   Reg_0 = 960
+   204   Stack_D = Reg_0
+   204   call Sym_39
+   204   Reg_0 = 0
+   204   Stack_D = Reg_0
+   204   call Sym_100
+   204   call Sym_40
+   204   call Sym_41
+   205   Reg_0 = 970
+   205   Stack_D = Reg_0
+   205   call Sym_39
+   205   Reg_0 = 4
+   205   Stack_D = Reg_0
+   205   call Sym_100
+   205   call Sym_40
+   205   Reg_0 = 4
+   205   Stack_D = Reg_0
+   205   call Sym_41
+   206   Reg_0 = 980
+   206   Stack_D = Reg_0
+   206   call Sym_39
+   206   Reg_0 = 5
+   206   Stack_D = Reg_0
+   206   call Sym_100
+   206   call Sym_40
+   206   call Sym_41
+   209   Reg_0 = Data_6
+   209   Stack_D = Reg_0
+   209   Reg_0 = 48
+   209   Stack_D = Reg_0
+   209   call Sym_0
+   209   call Sym_2
+   228   Reg_0 = 0
+   228   no-op
+           optimizes   Stack_D = Reg_0
+   228   no-op
+           optimizes   Reg_0 = Sym_133
+   228   no-op
+           optimizes   Stack_D = Reg_0
+   228   no-op
+           optimizes   call Sym_5
+   228   no-op
+           optimizes   Reg_0 = Stack_D
+   228   *(Sym_133) = Reg_0
+   239   Reg_0 = 0
+   239   Stack_D = Reg_0
+   239   call Sym_134
+   239   Reg_0 = 1
+   239   Stack_D = Reg_0
+   239   call Sym_134
+   239   Reg_0 = -1
+   239   Stack_D = Reg_0
+   239   call Sym_134
+   239   Reg_0 = 2
+   239   Stack_D = Reg_0
+   239   call Sym_134
+   240   Reg_0 = -2
+   240   Stack_D = Reg_0
+   240   call Sym_134
+   240   Reg_0 = 7
+   240   Stack_D = Reg_0
+   240   call Sym_134
+   240   Reg_0 = -7
+   240   Stack_D = Reg_0
+   240   call Sym_134
+   240   Reg_0 = 100
+   240   Stack_D = Reg_0
+   240   call Sym_134
+   241   Reg_0 = -100
+   241   Stack_D = Reg_0
+   241   call Sym_134
+   241   Reg_0 = 12345
+   241   Stack_D = Reg_0
+   241   call Sym_134
+   241   Reg_0 = -12345
+   241   Stack_D = Reg_0
+   241   call Sym_134
+   242   Reg_0 = *(Sym_10)
+   242   Stack_D = Reg_0
+   242   call Sym_134
+   242   Reg_0 = *(Sym_10)
+   242   no-op
+           optimizes   Stack_D = Reg_0
+   242   no-op
+           optimizes   call Sym_22
+   242   no-op
+           optimizes   Reg_0 = Stack_D
+   242   Reg_0 -= 1
+   242   Stack_D = Reg_0
+   242   call Sym_134
+   243   Reg_0 = *(Sym_11)
+   243   Stack_D = Reg_0
+   243   call Sym_134
+   243   Reg_0 = *(Sym_11)
+   243   no-op
+           optimizes   Stack_D = Reg_0
+   243   no-op
+           optimizes   call Sym_19
+   243   no-op
+           optimizes   Reg_0 = Stack_D
+   243   Reg_0 += 1
+   243   Stack_D = Reg_0
+   243   call Sym_134
+   245   Reg_0 = 1000
+   245   Stack_D = Reg_0
+   245   call Sym_39
+   245   Reg_0 = Sym_101
+   245   Stack_D = Reg_0
+   245   Reg_0 = 1
+   245   Stack_D = Reg_0
+   245   Reg_0 = Sym_102
+   245   Stack_D = Reg_0
+   245   call Sym_137
+   245   call Sym_40
+   245   Reg_0 = 0
+   245   Stack_D = Reg_0
+   245   call Sym_41
+   246   Reg_0 = 1010
+   246   Stack_D = Reg_0
+   246   call Sym_39
+   246   Reg_0 = Sym_103
+   246   Stack_D = Reg_0
+   246   Reg_0 = 1
+   246   Stack_D = Reg_0
+   246   Reg_0 = Sym_104
+   246   Stack_D = Reg_0
+   246   call Sym_137
+   246   call Sym_40
+   246   Reg_0 = 0
+   246   Stack_D = Reg_0
+   246   call Sym_41
+   247   Reg_0 = 1020
+   247   Stack_D = Reg_0
+   247   call Sym_39
+   247   Reg_0 = Sym_105
+   247   Stack_D = Reg_0
+   247   Reg_0 = 2
+   247   Stack_D = Reg_0
+   247   Reg_0 = Sym_102
+   247   Stack_D = Reg_0
+   247   call Sym_137
+   247   call Sym_40
+   247   Reg_0 = 0
+   247   Stack_D = Reg_0
+   247   call Sym_41
+   248   Reg_0 = 1030
+   248   Stack_D = Reg_0
+   248   call Sym_39
+   248   Reg_0 = Sym_106
+   248   Stack_D = Reg_0
+   248   Reg_0 = 2
+   248   Stack_D = Reg_0
+   248   Reg_0 = Sym_104
+   248   Stack_D = Reg_0
+   248   call Sym_137
+   248   call Sym_40
+   248   Reg_0 = 0
+   248   Stack_D = Reg_0
+   248   call Sym_41
+   249   Reg_0 = 1040
+   249   Stack_D = Reg_0
+   249   call Sym_39
+   249   Reg_0 = Sym_107
+   249   Stack_D = Reg_0
+   249   Reg_0 = 3
+   249   Stack_D = Reg_0
+   249   Reg_0 = Sym_102
+   249   Stack_D = Reg_0
+   249   call Sym_137
+   249   call Sym_40
+   249   Reg_0 = 0
+   249   Stack_D = Reg_0
+   249   call Sym_41
+   250   Reg_0 = 1050
+   250   Stack_D = Reg_0
+   250   call Sym_39
+   250   Reg_0 = Sym_108
+   250   Stack_D = Reg_0
+   250   Reg_0 = 3
+   250   Stack_D = Reg_0
+   250   Reg_0 = Sym_104
+   250   Stack_D = Reg_0
+   250   call Sym_137
+   250   call Sym_40
+   250   Reg_0 = 0
+   250   Stack_D = Reg_0
+   250   call Sym_41
+   251   Reg_0 = 1060
+   251   Stack_D = Reg_0
+   251   call Sym_39
+   251   Reg_0 = Sym_109
+   251   Stack_D = Reg_0
+   251   Reg_0 = -3
+   251   Stack_D = Reg_0
+   251   Reg_0 = Sym_102
+   251   Stack_D = Reg_0
+   251   call Sym_137
+   251   call Sym_40
+   251   Reg_0 = 0
+   251   Stack_D = Reg_0
+   251   call Sym_41
+   252   Reg_0 = 1070
+   252   Stack_D = Reg_0
+   252   call Sym_39
+   252   Reg_0 = Sym_110
+   252   Stack_D = Reg_0
+   252   Reg_0 = -3
+   252   Stack_D = Reg_0
+   252   Reg_0 = Sym_104
+   252   Stack_D = Reg_0
+   252   call Sym_137
+   252   call Sym_40
+   252   Reg_0 = 0
+   252   Stack_D = Reg_0
+   252   call Sym_41
+   253   Reg_0 = 1080
+   253   Stack_D = Reg_0
+   253   call Sym_39
+   253   Reg_0 = Sym_111
+   253   Stack_D = Reg_0
+   253   Reg_0 = 7
+   253   Stack_D = Reg_0
+   253   Reg_0 = Sym_102
+   253   Stack_D = Reg_0
+   253   call Sym_137
+   253   call Sym_40
+   253   Reg_0 = 0
+   253   Stack_D = Reg_0
+   253   call Sym_41
+   254   Reg_0 = 1090
+   254   Stack_D = Reg_0
+   254   call Sym_39
+   254   Reg_0 = Sym_112
+   254   Stack_D = Reg_0
+   254   Reg_0 = 7
+   254   Stack_D = Reg_0
+   254   Reg_0 = Sym_104
+   254   Stack_D = Reg_0
+   254   call Sym_137
+   254   call Sym_40
+   254   Reg_0 = 0
+   254   Stack_D = Reg_0
+   254   call Sym_41
+   255   Reg_0 = 1100
+   255   Stack_D = Reg_0
+   255   call Sym_39
+   255   Reg_0 = Sym_113
+   255   Stack_D = Reg_0
+   255   Reg_0 = 8
+   255   Stack_D = Reg_0
+   255   Reg_0 = Sym_102
+   255   Stack_D = Reg_0
+   255   call Sym_137
+   255   call Sym_40
+   255   Reg_0 = 0
+   255   Stack_D = Reg_0
+   255   call Sym_41
+   256   Reg_0 = 1110
+   256   Stack_D = Reg_0
+   256   call Sym_39
+   256   Reg_0 = Sym_114
+   256   Stack_D = Reg_0
+   256   Reg_0 = 8
+   256   Stack_D = Reg_0
+   256   Reg_0 = Sym_104
+   256   Stack_D = Reg_0
+   256   call Sym_137
+   256   call Sym_40
+   256   Reg_0 = 0
+   256   Stack_D = Reg_0
+   256   call Sym_41
+   257   Reg_0 = 1120
+   257   Stack_D = Reg_0
+   257   call Sym_39
+   257   Reg_0 = Sym_115
+   257   Stack_D = Reg_0
+   257   Reg_0 = -8
+   257   Stack_D = Reg_0
+   257   Reg_0 = Sym_102
+   257   Stack_D = Reg_0
+   257   call Sym_137
+   257   call Sym_40
+   257   Reg_0 = 0
+   257   Stack_D = Reg_0
+   257   call Sym_41
+   258   Reg_0 = 1130
+   258   Stack_D = Reg_0
+   258   call Sym_39
+   258   Reg_0 = Sym_116
+   258   Stack_D = Reg_0
+   258   Reg_0 = -8
+   258   Stack_D = Reg_0
+   258   Reg_0 = Sym_104
+   258   Stack_D = Reg_0
+   258   call Sym_137
+   258   call Sym_40
+   258   Reg_0 = 0
+   258   Stack_D = Reg_0
+   258   call Sym_41
+   259   Reg_0 = 1140
+   259   Stack_D = Reg_0
+   259   call Sym_39
+   259   Reg_0 = Sym_117
+   259   Stack_D = Reg_0
+   259   Reg_0 = 10
+   259   Stack_D = Reg_0
+   259   Reg_0 = Sym_102
+   259   Stack_D = Reg_0
+   259   call Sym_137
+   259   call Sym_40
+   259   Reg_0 = 0
+   259   Stack_D = Reg_0
+   259   call Sym_41
+   260   Reg_0 = 1150
+   260   Stack_D = Reg_0
+   260   call Sym_39
+   260   Reg_0 = Sym_118
+   260   Stack_D = Reg_0
+   260   Reg_0 = 10
+   260   Stack_D = Reg_0
+   260   Reg_0 = Sym_104
+   260   Stack_D = Reg_0
+   260   call Sym_137
+   260   call Sym_40
+   260   Reg_0 = 0
+   260   Stack_D = Reg_0
+   260   call Sym_41
+   261   Reg_0 = 1160
+   261   Stack_D = Reg_0
+   261   call Sym_39
+   261   Reg_0 = Sym_119
+   261   Stack_D = Reg_0
+   261   Reg_0 = -10
+   261   Stack_D = Reg_0
+   261   Reg_0 = Sym_102
+   261   Stack_D = Reg_0
+   261   call Sym_137
+   261   call Sym_40
+   261   Reg_0 = 0
+   261   Stack_D = Reg_0
+   261   call Sym_41
+   262   Reg_0 = 1170
+   262   Stack_D = Reg_0
+   262   call Sym_39
+   262   Reg_0 = Sym_120
+   262   Stack_D = Reg_0
+   262   Reg_0 = -10
+   262   Stack_D = Reg_0
+   262   Reg_0 = Sym_104
+   262   Stack_D = Reg_0
+   262   call Sym_137
+   262   call Sym_40
+   262   Reg_0 = 0
+   262   Stack_D = Reg_0
+   262   call Sym_41
+   263   Reg_0 = 1180
+   263   Stack_D = Reg_0
+   263   call Sym_39
+   263   Reg_0 = Sym_123
+   263   Stack_D = Reg_0
+   263   Reg_0 = 0
+   263   Stack_D = Reg_0
+   263   Reg_0 = Sym_16
+   263   Stack_D = Reg_0
+   263   call Sym_137
+   263   call Sym_40
+   263   Reg_0 = 0
+   263   Stack_D = Reg_0
+   263   call Sym_41
+   264   Reg_0 = 1190
+   264   Stack_D = Reg_0
+   264   call Sym_39
+   264   Reg_0 = Sym_124
+   264   Stack_D = Reg_0
+   264   Reg_0 = 1
+   264   Stack_D = Reg_0
+   264   Reg_0 = Sym_16
+   264   Stack_D = Reg_0
+   264   call Sym_137
+   264   call Sym_40
+   264   Reg_0 = 0
+   264   Stack_D = Reg_0
+   264   call Sym_41
+   265   Reg_0 = 1200
+   265   Stack_D = Reg_0
+   265   call Sym_39
+   265   Reg_0 = Sym_125
+   265   Stack_D = Reg_0
+   265   Reg_0 = -1
+   265   Stack_D = Reg_0
+   265   Reg_0 = Sym_16
+   265   Stack_D = Reg_0
+   265   call Sym_137
+   265   call Sym_40
+   265   Reg_0 = 0
+   265   Stack_D = Reg_0
+   265   call Sym_41
+   266   Reg_0 = 1210
+   266   Stack_D = Reg_0
+   266   call Sym_39
+   266   Reg_0 = Sym_126
+   266   Stack_D = Reg_0
+   266   Reg_0 = 3
+   266   Stack_D = Reg_0
+   266   Reg_0 = Sym_16
+   266   Stack_D = Reg_0
+   266   call Sym_137
+   266   call Sym_40
+   266   Reg_0 = 0
+   266   Stack_D = Reg_0
+   266   call Sym_41
+   267   Reg_0 = 1220
+   267   Stack_D = Reg_0
+   267   call Sym_39
+   267   Reg_0 = Sym_127
+   267   Stack_D = Reg_0
+   267   Reg_0 = 8
+   267   Stack_D = Reg_0
+   267   Reg_0 = Sym_16
+   267   Stack_D = Reg_0
+   267   call Sym_137
+   267   call Sym_40
+   267   Reg_0 = 0
+   267   Stack_D = Reg_0
+   267   call Sym_41
+   268   Reg_0 = 1230
+   268   Stack_D = Reg_0
+   268   call Sym_39
+   268   Reg_0 = Sym_128
+   268   Stack_D = Reg_0
+   268   Reg_0 = -8
+   268   Stack_D = Reg_0
+   268   Reg_0 = Sym_16
+   268   Stack_D = Reg_0
+   268   call Sym_137
+   268   call Sym_40
+   268   Reg_0 = 0
+   268   Stack_D = Reg_0
+   268   call Sym_41
+   269   Reg_0 = 1240
+   269   Stack_D = Reg_0
+   269   call Sym_39
+   269   Reg_0 = Sym_129
+   269   Stack_D = Reg_0
+   269   Reg_0 = 10
+   269   Stack_D = Reg_0
+   269   Reg_0 = Sym_16
+   269   Stack_D = Reg_0
+   269   call Sym_137
+   269   call Sym_40
+   269   Reg_0 = 0
+   269   Stack_D = Reg_0
+   269   call Sym_41
+   270   Reg_0 = 1250
+   270   Stack_D = Reg_0
+   270   call Sym_39
+   270   Reg_0 = Sym_130
+   270   Stack_D = Reg_0
+   270   Reg_0 = -7
+   270   Stack_D = Reg_0
+   270   Reg_0 = Sym_16
+   270   Stack_D = Reg_0
+   270   call Sym_137
+   270   call Sym_40
+   270   Reg_0 = 0
+   270   Stack_D = Reg_0
+   270   call Sym_41
+   274   Reg_0 = 1270
+   274   Stack_D = Reg_0
+   274   call Sym_39
+   274   Reg_0 = 7
+   274   Stack_D = Reg_0
+   274   no-op
+           optimizes   call Sym_121
+   220   Reg_0 = -1
+   220   Stack_D = Reg_0
+   220   call Sym_102
+   274   call Sym_40
+   274   Reg_0 = -7
+   274   Stack_D = Reg_0
+   274   call Sym_41
+   275   Reg_0 = 1280
+   275   Stack_D = Reg_0
+   275   call Sym_39
+   275   Reg_0 = -7
+   275   Stack_D = Reg_0
+   275   no-op
+           optimizes   call Sym_121
+   220   Reg_0 = -1
+   220   Stack_D = Reg_0
+   220   call Sym_102
+   275   call Sym_40
+   275   Reg_0 = 7
+   275   Stack_D = Reg_0
+   275   call Sym_41
+   276   Reg_0 = 1290
+   276   Stack_D = Reg_0
+   276   call Sym_39
+   276   Reg_0 = *(Sym_10)
+   276   Stack_D = Reg_0
+   276   no-op
+           optimizes   call Sym_121
+   220   Reg_0 = -1
+   220   Stack_D = Reg_0
+   220   call Sym_102
+   276   call Sym_40
+   276   Reg_0 = *(Sym_10)
+   276   no-op
+           optimizes   Stack_D = Reg_0
+   276   no-op
+           optimizes   call Sym_30
+   276   no-op
+           optimizes   Reg_0 = Stack_D
+   276   Reg_0 = -Reg_0
+   276   Stack_D = Reg_0
+   276   call Sym_41
+   277   Reg_0 = 1300
+   277   Stack_D = Reg_0
+   277   call Sym_39
+   277   Reg_0 = *(Sym_11)
+   277   no-op
+           optimizes   Stack_D = Reg_0
+   277   no-op
+           optimizes   call Sym_19
+   277   no-op
+           optimizes   Reg_0 = Stack_D
+   277   Reg_0 += 1
+   277   Stack_D = Reg_0
+   277   no-op
+           optimizes   call Sym_121
+   220   Reg_0 = -1
+   220   Stack_D = Reg_0
+   220   call Sym_102
+   277   call Sym_40
+   277   Reg_0 = *(Sym_10)
+   277   Stack_D = Reg_0
+   277   call Sym_41
+   278   Reg_0 = 1310
+   278   Stack_D = Reg_0
+   278   call Sym_39
+   278   Reg_0 = 7
+   278   Stack_D = Reg_0
+   278   no-op
+           optimizes   call Sym_122
+   220   Reg_0 = -1
+   220   Stack_D = Reg_0
+   220   call Sym_104
+   278   call Sym_40
+   278   Reg_0 = 0
+   278   Stack_D = Reg_0
+   278   call Sym_41
+   279   Reg_0 = 1320
+   279   Stack_D = Reg_0
+   279   call Sym_39
+   279   Reg_0 = *(Sym_11)
+   279   no-op
+           optimizes   Stack_D = Reg_0
+   279   no-op
+           optimizes   call Sym_19
+   279   no-op
+           optimizes   Reg_0 = Stack_D
+   279   Reg_0 += 1
+   279   Stack_D = Reg_0
+   279   no-op
+           optimizes   call Sym_122
+   220   Reg_0 = -1
+   220   Stack_D = Reg_0
+   220   call Sym_104
+   279   call Sym_40
+   279   Reg_0 = 0
+   279   Stack_D = Reg_0
+   279   call Sym_41
+   280   Reg_0 = 1330
+   280   Stack_D = Reg_0
+   280   call Sym_39
+   280   Reg_0 = *(Sym_11)
+   280   no-op
+           optimizes   Stack_D = Reg_0
+   280   no-op
+           optimizes   call Sym_115
+   217   no-op
+           optimizes   Reg_0 = -8
+   217   no-op
+           optimizes   Stack_D = Reg_0
+   217   no-op
+           optimizes   call Sym_102
+   217   no-op
+           optimizes   Reg_0 = Stack_D
+   217   Reg_0 /= -8
+   217   Stack_D = Reg_0
+   280   call Sym_40
+   280   Reg_0 = *(Sym_11)
+   280   Stack_D = Reg_0
+   280   Reg_0 = -8
+   280   Stack_D = Reg_0
+   280   Reg_0 = Sym_102
+   280   Stack_D = Reg_0
+   280   call Sym_7
+   280   call Sym_41
+   281   Reg_0 = 1340
+   281   Stack_D = Reg_0
+   281   call Sym_39
+   281   Reg_0 = 12
+           optimizes   Reg_0 = 3
+   281   Stack_D = Reg_0
+   281   no-op
+           optimizes   call Sym_131
+   223   no-op
+           optimizes   call Sym_21
+   281   call Sym_40
+   281   Reg_0 = 3
+   281   Stack_D = Reg_0
+   281   Reg_0 = Sym_21
+   281   Stack_D = Reg_0
+   281   call Sym_7
+   281   call Sym_41
+   282   Reg_0 = 1350
+   282   Stack_D = Reg_0
+   282   call Sym_39
+   282   Reg_0 = *(Sym_11)
+   282   no-op
+           optimizes   Stack_D = Reg_0
+   282   no-op
+           optimizes   call Sym_19
+   282   no-op
+           optimizes   Reg_0 = Stack_D
+   282   Reg_0 += 1
+   282   no-op
+           optimizes   Stack_D = Reg_0
+   282   no-op
+           optimizes   call Sym_131
+   223   no-op
+           optimizes   call Sym_21
+   223   no-op
+           optimizes   Reg_0 = Stack_D
+   223   Reg_0 *= 4
+   223   Stack_D = Reg_0
+   282   call Sym_40
+   282   Reg_0 = *(Sym_11)
+   282   no-op
+           optimizes   Stack_D = Reg_0
+   282   no-op
+           optimizes   call Sym_19
+   282   no-op
+           optimizes   Reg_0 = Stack_D
+   282   Reg_0 += 1
+   282   Stack_D = Reg_0
+   282   Reg_0 = Sym_21
+   282   Stack_D = Reg_0
+   282   call Sym_7
+   282   call Sym_41
+   285   Reg_0 = Data_7
+   285   Stack_D = Reg_0
+   285   Reg_0 = 31
+   285   Stack_D = Reg_0
+   285   call Sym_0
+   285   call Sym_2
+   287   Reg_0 = 100
+   287   no-op
+           optimizes   Stack_D = Reg_0
+   287   no-op
+           optimizes   Reg_0 = Stack_D
+   287   *(Sym_139) = Reg_0
+   288   Reg_0 = -1
+   288   no-op
+           optimizes   Stack_D = Reg_0
+   288   no-op
+           optimizes   Reg_0 = Stack_D
+   288   *(Sym_140) = Reg_0
+   292   Reg_0 = 2147483647
+   292   no-op
+           optimizes   Stack_D = Reg_0
+   292   no-op
+           optimizes   Reg_0 = Stack_D
+   292   *(Sym_141) = Reg_0
+   294   Reg_0 = 300
+           optimizes   Reg_0 = 100
+   294   no-op
+           optimizes   Stack_D = Reg_0
+   294   no-op
+           optimizes   Reg_0 = 3
+   294   no-op
+           optimizes   Stack_D = Reg_0
+   294   no-op
+           optimizes   call Sym_16
+   294   no-op
+           optimizes   Reg_0 = Stack_D
+   294   *(Sym_142) = Reg_0
+   295   Reg_0 = 0
+   295   no-op
+           optimizes   Stack_D = Reg_0
+   295   no-op
+           optimizes   Reg_0 = Stack_D
+   295   *(Sym_143) = Reg_0
+   309   Reg_0 = 1400
+   309   Stack_D = Reg_0
+   309   call Sym_39
+   309   no-op
+           optimizes   call Sym_144
+   297   Reg_0 = 200
+           optimizes   Reg_0 = 100
+   297   Stack_D = Reg_0
+   297   no-op
+           optimizes   call Sym_51
+   309   call Sym_40
+   309   Reg_0 = 200
+   309   Stack_D = Reg_0
+   309   call Sym_41
+   310   Reg_0 = 1410
+   310   Stack_D = Reg_0
+   310   call Sym_39
+   310   no-op
+           optimizes   call Sym_145
+   298   Reg_0 = 4
+           optimizes   Reg_0 = -1
+   298   Stack_D = Reg_0
+   298   no-op
+           optimizes   Reg_0 = 5
+   298   no-op
+           optimizes   Stack_D = Reg_0
+   298   no-op
+           optimizes   call Sym_15
+   310   call Sym_40
+   310   Reg_0 = 4
+   310   Stack_D = Reg_0
+   310   call Sym_41
+   311   Reg_0 = 1420
+   311   Stack_D = Reg_0
+   311   call Sym_39
+   311   no-op
+           optimizes   call Sym_146
+   299   Reg_0 = -2147483648
+           optimizes   Reg_0 = 2147483647
+   299   Stack_D = Reg_0
+   299   no-op
+           optimizes   call Sym_19
+   311   call Sym_40
+   311   Reg_0 = *(Sym_11)
+   311   Stack_D = Reg_0
+   311   call Sym_41
+   312   Reg_0 = 1430
+   312   Stack_D = Reg_0
+   312   call Sym_39
+   312   no-op
+           optimizes   call Sym_147
+   300   Reg_0 = 301
+           optimizes   Reg_0 = 300
+   300   Stack_D = Reg_0
+   300   no-op
+           optimizes   call Sym_19
+   312   call Sym_40
+   312   Reg_0 = 301
+   312   Stack_D = Reg_0
+   312   call Sym_41
+   313   Reg_0 = 1440
+   313   Stack_D = Reg_0
+   313   call Sym_39
+   313   Reg_0 = -100
+           optimizes   Reg_0 = 100
+   313   Stack_D = Reg_0
+   313   no-op
+           optimizes   Reg_0 = 100
+   313   no-op
+           optimizes   Stack_D = Reg_0
+   313   no-op
+           optimizes   call Sym_15
+   313   no-op
+           optimizes   Reg_0 = -1
+   313   no-op
+           optimizes   Stack_D = Reg_0
+   313   no-op
+           optimizes   call Sym_16
+   313   call Sym_40
+   313   Reg_0 = -100
+   313   Stack_D = Reg_0
+   313   call Sym_41
+   314   Reg_0 = 1450
+   314   Stack_D = Reg_0
+   314   call Sym_39
+   314   Reg_0 = 0
+   314   Stack_D = Reg_0
+   314   call Sym_149
+   314   call Sym_40
+   314   Reg_0 = 1
+   314   Stack_D = Reg_0
+   314   call Sym_41
+   315   Reg_0 = 1460
+   315   Stack_D = Reg_0
+   315   call Sym_39
+   315   Reg_0 = 100
+   315   Stack_D = Reg_0
+   315   call Sym_149
+   315   call Sym_40
+   315   Reg_0 = 2
+   315   Stack_D = Reg_0
+   315   call Sym_41
+   316   Reg_0 = 1470
+   316   Stack_D = Reg_0
+   316   call Sym_39
+   316   Reg_0 = -1
+   316   Stack_D = Reg_0
+   316   call Sym_149
+   316   call Sym_40
+   316   Reg_0 = 3
+   316   Stack_D = Reg_0
+   316   call Sym_41
+   317   Reg_0 = 1480
+   317   Stack_D = Reg_0
+   317   call Sym_39
+   317   Reg_0 = *(Sym_10)
+   317   Stack_D = Reg_0
+   317   call Sym_149
+   317   call Sym_40
+   317   Reg_0 = 4
+   317   Stack_D = Reg_0
+   317   call Sym_41
+   318   Reg_0 = 1490
+   318   Stack_D = Reg_0
+   318   call Sym_39
+   318   Reg_0 = 1
+   318   Stack_D = Reg_0
+   318   call Sym_149
+   318   call Sym_40
+   318   Reg_0 = 0
+   318   Stack_D = Reg_0
+   318   call Sym_41
+   319   Reg_0 = 1500
+   319   Stack_D = Reg_0
+   319   call Sym_39
+   319   Reg_0 = 7
+   319   Stack_D = Reg_0
+   319   Reg_0 = Sym_148
+   319   Stack_D = Reg_0
+   319   call Sym_150
+   319   call Sym_94
+   319   call Sym_40
+   319   Reg_0 = -10
+   319   Stack_D = Reg_0
+   319   call Sym_41
+   322   Reg_0 = Data_8
+   322   Stack_D = Reg_0
+   322   Reg_0 = 16
+   322   Stack_D = Reg_0
+   322   call Sym_0
+   322   call Sym_2
+   345   Reg_0 = 1800
+   345   Stack_D = Reg_0
+   345   call Sym_39
+   345   Reg_0 = -7
+   345   Stack_D = Reg_0
+   345   Reg_0 = 50
+   345   Stack_D = Reg_0
+   345   Reg_0 = 300
+   345   Stack_D = Reg_0
+   345   no-op
+           optimizes   call Sym_158
+   336   no-op
+           optimizes   call Sym_151
+   325   call Sym_43
+   325   no-op
+           optimizes   call Sym_53
+   325   Reg_0 = Stack_D
+   325   if Reg_0 >= 0 goto Label_350
+   325   no-op
+           optimizes   Reg_0 = Stack_D
+   325   no-op
+           optimizes   if Reg_0 == 0 goto Label_350
+   325   call Sym_46
+   325   Reg_0 = 0
+   325   Stack_D = Reg_0
+   325   goto Label_352
+   325 label Label_350
+   326   call Sym_43
+   326   Reg_0 = 100
+   326   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   326   no-op
+           optimizes   call Sym_75
+   326   no-op
+           optimizes   Reg_1 = Stack_D
+   326   Reg_0 = Stack_D
+   326   if Reg_0 <= Reg_1 goto Label_351
+   326   no-op
+           optimizes   Reg_0 = Stack_D
+   326   no-op
+           optimizes   if Reg_0 == 0 goto Label_351
+   326   call Sym_46
+   326   Reg_0 = 100
+   326   Stack_D = Reg_0
+   326   goto Label_352
+   326 label Label_351
+   326 label Label_352
+   336   call Sym_159
+   336   no-op
+           optimizes   call Sym_151
+   325   call Sym_43
+   325   no-op
+           optimizes   call Sym_53
+   325   Reg_0 = Stack_D
+   325   if Reg_0 >= 0 goto Label_353
+   325   no-op
+           optimizes   Reg_0 = Stack_D
+   325   no-op
+           optimizes   if Reg_0 == 0 goto Label_353
+   325   call Sym_46
+   325   Reg_0 = 0
+   325   Stack_D = Reg_0
+   325   goto Label_355
+   325 label Label_353
+   326   call Sym_43
+   326   Reg_0 = 100
+   326   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   326   no-op
+           optimizes   call Sym_75
+   326   no-op
+           optimizes   Reg_1 = Stack_D
+   326   Reg_0 = Stack_D
+   326   if Reg_0 <= Reg_1 goto Label_354
+   326   no-op
+           optimizes   Reg_0 = Stack_D
+   326   no-op
+           optimizes   if Reg_0 == 0 goto Label_354
+   326   call Sym_46
+   326   Reg_0 = 100
+   326   Stack_D = Reg_0
+   326   goto Label_355
+   326 label Label_354
+   326 label Label_355
+   336   call Sym_159
+   336   no-op
+           optimizes   call Sym_151
+   325   call Sym_43
+   325   no-op
+           optimizes   call Sym_53
+   325   Reg_0 = Stack_D
+   325   if Reg_0 >= 0 goto Label_356
+   325   no-op
+           optimizes   Reg_0 = Stack_D
+   325   no-op
+           optimizes   if Reg_0 == 0 goto Label_356
+   325   call Sym_46
+   325   Reg_0 = 0
+   325   Stack_D = Reg_0
+   325   goto Label_358
+   325 label Label_356
+   326   call Sym_43
+   326   Reg_0 = 100
+   326   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   326   no-op
+           optimizes   call Sym_75
+   326   no-op
+           optimizes   Reg_1 = Stack_D
+   326   Reg_0 = Stack_D
+   326   if Reg_0 <= Reg_1 goto Label_357
+   326   no-op
+           optimizes   Reg_0 = Stack_D
+   326   no-op
+           optimizes   if Reg_0 == 0 goto Label_357
+   326   call Sym_46
+   326   Reg_0 = 100
+   326   Stack_D = Reg_0
+   326   goto Label_358
+   326 label Label_357
+   326 label Label_358
+   336   call Sym_159
+   345   call Sym_40
+   345   Reg_0 = 0
+   345   Stack_D = Reg_0
+   345   Reg_0 = 50
+   345   Stack_D = Reg_0
+   345   Reg_0 = 100
+   345   Stack_D = Reg_0
+   345   call Sym_41
+   346   Reg_0 = 1810
+   346   Stack_D = Reg_0
+   346   call Sym_39
+   346   no-op
+           optimizes   call Sym_160
+   337   Reg_0 = -5
+   337   Stack_D = Reg_0
+   337   call Sym_152
+   337   Reg_0 = 0
+   337   Stack_D = Reg_0
+   337   call Sym_152
+   337   Reg_0 = *(Sym_11)
+   337   Stack_D = Reg_0
+   337   call Sym_152
+   346   call Sym_40
+   346   Reg_0 = -1
+   346   Stack_D = Reg_0
+   346   Reg_0 = 0
+   346   Stack_D = Reg_0
+   346   Reg_0 = -1
+   346   Stack_D = Reg_0
+   346   call Sym_41
+   347   Reg_0 = 1820
+   347   Stack_D = Reg_0
+   347   call Sym_39
+   347   Reg_0 = 3
+   347   Stack_D = Reg_0
+   347   no-op
+           optimizes   call Sym_161
+   338   call Sym_153
+   338   call Sym_153
+   347   call Sym_40
+   347   Reg_0 = 12
+   347   Stack_D = Reg_0
+   347   call Sym_41
+   348   Reg_0 = 1830
+   348   Stack_D = Reg_0
+   348   call Sym_39
+   348   call Sym_162
+   348   call Sym_40
+   348   Reg_0 = 10
+   348   Stack_D = Reg_0
+   348   call Sym_41
+   349   Reg_0 = 1840
+   349   Stack_D = Reg_0
+   349   call Sym_39
+   349   call Sym_163
+   349   call Sym_40
+   349   Reg_0 = 10
+   349   Stack_D = Reg_0
+   349   call Sym_41
+   350   Reg_0 = 1850
+   350   Stack_D = Reg_0
+   350   call Sym_39
+   350   call Sym_164
+   350   call Sym_40
+   350   Reg_0 = 6
+   350   Stack_D = Reg_0
+   350   call Sym_41
+   351   Reg_0 = 1860
+   351   Stack_D = Reg_0
+   351   call Sym_39
+   351   no-op
+           optimizes   call Sym_165
+   342   Reg_0 = 10
+   342   Stack_D = Reg_0
+   342   call Sym_156
+   342   Reg_0 = 3
+   342   Stack_D = Reg_0
+   342   call Sym_156
+   351   call Sym_40
+   351   Reg_0 = 4
+   351   Stack_D = Reg_0
+   351   Reg_0 = -1
+   351   Stack_D = Reg_0
+   351   call Sym_41
+   352   Reg_0 = 1870
+   352   Stack_D = Reg_0
+   352   call Sym_39
+   352   call Sym_166
+   352   call Sym_40
+   352   Reg_0 = 250
+   352   Stack_D = Reg_0
+   352   call Sym_41
+   353   Reg_0 = 1880
+   353   Stack_D = Reg_0
+   353   call Sym_39
+   353   Reg_0 = 10
+   353   Stack_D = Reg_0
+   353   call Sym_157
+   353   call Sym_40
+   353   Reg_0 = 3628800
+   353   Stack_D = Reg_0
+   353   call Sym_41
+   354   Reg_0 = 1890
+   354   Stack_D = Reg_0
+   354   call Sym_39
+   354   Reg_0 = *(Sym_10)
+   354   Stack_D = Reg_0
+   354   no-op
+           optimizes   call Sym_151
+   325   call Sym_43
+   325   no-op
+           optimizes   call Sym_53
+   325   Reg_0 = Stack_D
+   325   if Reg_0 >= 0 goto Label_327
+   325   no-op
+           optimizes   Reg_0 = Stack_D
+   325   no-op
+           optimizes   if Reg_0 == 0 goto Label_327
+   325   call Sym_46
+   325   Reg_0 = 0
+   325   Stack_D = Reg_0
+   325   goto Label_329
+   325 label Label_327
+   326   call Sym_43
+   326   Reg_0 = 100
+   326   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   326   no-op
+           optimizes   call Sym_75
+   326   no-op
+           optimizes   Reg_1 = Stack_D
+   326   Reg_0 = Stack_D
+   326   if Reg_0 <= Reg_1 goto Label_328
+   326   no-op
+           optimizes   Reg_0 = Stack_D
+   326   no-op
+           optimizes   if Reg_0 == 0 goto Label_328
+   326   call Sym_46
+   326   Reg_0 = 100
+   326   Stack_D = Reg_0
+   326   goto Label_329
+   326 label Label_328
+   326 label Label_329
+   354   Reg_0 = *(Sym_11)
+   354   Stack_D = Reg_0
+   354   no-op
+           optimizes   call Sym_151
+   325   call Sym_43
+   325   no-op
+           optimizes   call Sym_53
+   325   Reg_0 = Stack_D
+   325   if Reg_0 >= 0 goto Label_330
+   325   no-op
+           optimizes   Reg_0 = Stack_D
+   325   no-op
+           optimizes   if Reg_0 == 0 goto Label_330
+   325   call Sym_46
+   325   Reg_0 = 0
+   325   Stack_D = Reg_0
+   325   goto Label_332
+   325 label Label_330
+   326   call Sym_43
+   326   Reg_0 = 100
+   326   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   326   no-op
+           optimizes   call Sym_75
+   326   no-op
+           optimizes   Reg_1 = Stack_D
+   326   Reg_0 = Stack_D
+   326   if Reg_0 <= Reg_1 goto Label_331
+   326   no-op
+           optimizes   Reg_0 = Stack_D
+   326   no-op
+           optimizes   if Reg_0 == 0 goto Label_331
+   326   call Sym_46
+   326   Reg_0 = 100
+   326   Stack_D = Reg_0
+   326   goto Label_332
+   326 label Label_331
+   326 label Label_332
+   354   call Sym_40
+   354   Reg_0 = 100
+   354   Stack_D = Reg_0
+   354   Reg_0 = 0
+   354   Stack_D = Reg_0
+   354   call Sym_41
+   357   Reg_0 = Data_9
+   357   Stack_D = Reg_0
+   357   Reg_0 = 31
+   357   Stack_D = Reg_0
+   357   call Sym_0
+   357   call Sym_2
+   367   Reg_0 = 1900
+   367   Stack_D = Reg_0
+   367   call Sym_39
+   367   Reg_0 = 3
+   367   no-op
+           optimizes   Stack_D = Reg_0
+   367   no-op
+           optimizes   Reg_0 = Sym_167
+   367   no-op
+           optimizes   Stack_D = Reg_0
+   367   no-op
+           optimizes   call Sym_5
+   367   no-op
+           optimizes   Reg_0 = Stack_D
+   367   *(Sym_167) = Reg_0
+   367   Reg_0 = 10
+   367   Stack_D = Reg_0
+   367   call Sym_168
+   367   call Sym_40
+   367   Reg_0 = 30
+   367   Stack_D = Reg_0
+   367   call Sym_41
+   368   Reg_0 = 1910
+   368   Stack_D = Reg_0
+   368   call Sym_39
+   368   Reg_0 = 1
+   368   no-op
+           optimizes   Stack_D = Reg_0
+   368   no-op
+           optimizes   Reg_0 = Sym_167
+   368   no-op
+           optimizes   Stack_D = Reg_0
+   368   no-op
+           optimizes   call Sym_5
+   368   no-op
+           optimizes   Reg_0 = Stack_D
+   368   *(Sym_167) = Reg_0
+   368   Reg_0 = 4
+   368   Stack_D = Reg_0
+   368   call Sym_169
+   368   no-op
+           optimizes   Reg_0 = Sym_167
+   368   no-op
+           optimizes   Stack_D = Reg_0
+   368   no-op
+           optimizes   call Sym_71
+   368   Reg_0 = *(Sym_167)
+   368   Stack_D = Reg_0
+   368   call Sym_40
+   368   Reg_0 = 10
+   368   Stack_D = Reg_0
+   368   Reg_0 = 5
+   368   Stack_D = Reg_0
+   368   call Sym_41
+   369   Reg_0 = 1920
+   369   Stack_D = Reg_0
+   369   call Sym_39
+   369   Reg_0 = 2
+   369   no-op
+           optimizes   Stack_D = Reg_0
+   369   no-op
+           optimizes   Reg_0 = Sym_167
+   369   no-op
+           optimizes   Stack_D = Reg_0
+   369   no-op
+           optimizes   call Sym_5
+   369   no-op
+           optimizes   Reg_0 = Stack_D
+   369   *(Sym_167) = Reg_0
+   369   Reg_0 = 2
+   369   Stack_D = Reg_0
+   369   call Sym_170
+   369   call Sym_40
+   369   Reg_0 = 15
+   369   Stack_D = Reg_0
+   369   call Sym_41
+   372   Reg_0 = Data_10
+   372   Stack_D = Reg_0
+   372   Reg_0 = 25
+   372   Stack_D = Reg_0
+   372   call Sym_0
+   372   call Sym_2
+   389   Reg_0 = 2000
+   389   Stack_D = Reg_0
+   389   call Sym_39
+   389   Reg_0 = 6
+   389   no-op
+           optimizes   Stack_D = Reg_0
+   389   no-op
+           optimizes   call Sym_173
+   381   no-op
+           optimizes   Reg_0 = Sym_171
+   381   no-op
+           optimizes   Stack_D = Reg_0
+   381   no-op
+           optimizes   call Sym_5
+   381   no-op
+           optimizes   Reg_0 = Stack_D
+   381   *(Sym_171) = Reg_0
+   381   no-op
+           optimizes   Reg_0 = Sym_171
+   381   no-op
+           optimizes   Stack_D = Reg_0
+   381   no-op
+           optimizes   call Sym_71
+   381   no-op
+           optimizes   Reg_0 = *(Sym_171)
+   381   Stack_D = Reg_0
+   389   no-op
+           optimizes   Reg_0 = Sym_171
+   389   no-op
+           optimizes   Stack_D = Reg_0
+   389   no-op
+           optimizes   call Sym_71
+   389   no-op
+           optimizes   Reg_0 = *(Sym_171)
+   389   Stack_D = Reg_0
+   389   call Sym_40
+   389   Reg_0 = 6
+   389   Stack_D = Reg_0
+   389   Reg_0 = 6
+   389   Stack_D = Reg_0
+   389   call Sym_41
+   390   Reg_0 = 2010
+   390   Stack_D = Reg_0
+   390   call Sym_39
+   390   Reg_0 = 8
+   390   no-op
+           optimizes   Stack_D = Reg_0
+   390   no-op
+           optimizes   Reg_0 = Sym_171
+   390   no-op
+           optimizes   Stack_D = Reg_0
+   390   no-op
+           optimizes   call Sym_5
+   390   no-op
+           optimizes   Reg_0 = Stack_D
+   390   *(Sym_171) = Reg_0
+   390   no-op
+           optimizes   call Sym_174
+   382   no-op
+           optimizes   Reg_0 = Sym_171
+   382   no-op
+           optimizes   Stack_D = Reg_0
+   382   no-op
+           optimizes   call Sym_71
+   382   no-op
+           optimizes   Reg_0 = *(Sym_171)
+   382   Stack_D = Reg_0
+   382   no-op
+           optimizes   Reg_0 = Sym_171
+   382   no-op
+           optimizes   Stack_D = Reg_0
+   382   no-op
+           optimizes   call Sym_71
+   382   no-op
+           optimizes   Reg_0 = *(Sym_171)
+   382   Stack_D = Reg_0
+   390   call Sym_40
+   390   Reg_0 = 8
+   390   Stack_D = Reg_0
+   390   Reg_0 = 8
+   390   Stack_D = Reg_0
+   390   call Sym_41
+   391   Reg_0 = 2020
+   391   Stack_D = Reg_0
+   391   call Sym_39
+   391   Reg_0 = 1
+   391   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   391   Reg_0 = 2
+   391   no-op
+           optimizes   Stack_D = Reg_0
+   391   no-op
+           optimizes   call Sym_175
+   383   no-op
+           optimizes   Reg_0 = Sym_171
+   383   no-op
+           optimizes   Stack_D = Reg_0
+   383   no-op
+           optimizes   call Sym_5
+   383   no-op
+           optimizes   Reg_0 = Stack_D
+   383   no-op
+           optimizes   *(Sym_171) = Reg_0
+   383   no-op
+           optimizes   Reg_0 = Sym_171
+   383   no-op
+           optimizes   Stack_D = Reg_0
+   383   no-op
+           optimizes   call Sym_5
+   383   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   383   *(Sym_171) = Reg_0
+   391   no-op
+           optimizes   Reg_0 = Sym_171
+   391   no-op
+           optimizes   Stack_D = Reg_0
+   391   no-op
+           optimizes   call Sym_71
+   391   no-op
+           optimizes   Reg_0 = *(Sym_171)
+   391   Stack_D = Reg_0
+   391   call Sym_40
+   391   Reg_0 = 1
+   391   Stack_D = Reg_0
+   391   call Sym_41
+   392   Reg_0 = 2030
+   392   Stack_D = Reg_0
+   392   call Sym_39
+   392   Reg_0 = Sym_171
+   392   Stack_D = Reg_0
+   392   no-op
+           optimizes   call Sym_176
+   384   Reg_0 = 5
+   384   no-op
+           optimizes   Stack_D = Reg_0
+   384   no-op
+           optimizes   Reg_0 = Sym_171
+   384   no-op
+           optimizes   Stack_D = Reg_0
+   384   no-op
+           optimizes   call Sym_5
+   384   no-op
+           optimizes   Reg_0 = Stack_D
+   384   *(Sym_171) = Reg_0
+   384   Reg_0 = 9
+   384   Stack_D = Reg_0
+   384   call Sym_47
+   384   call Sym_5
+   384   no-op
+           optimizes   Reg_0 = Sym_171
+   384   no-op
+           optimizes   Stack_D = Reg_0
+   384   no-op
+           optimizes   call Sym_71
+   384   Reg_0 = *(Sym_171)
+   384   Stack_D = Reg_0
+   392   call Sym_40
+   392   Reg_0 = 9
+   392   Stack_D = Reg_0
+   392   call Sym_41
+   393   Reg_0 = 2040
+   393   Stack_D = Reg_0
+   393   call Sym_39
+   393   Reg_0 = Sym_171
+   393   Stack_D = Reg_0
+   393   no-op
+           optimizes   call Sym_177
+   385   Reg_0 = 0
+   385   no-op
+           optimizes   Stack_D = Reg_0
+   385   no-op
+           optimizes   Reg_0 = Sym_171
+   385   no-op
+           optimizes   Stack_D = Reg_0
+   385   no-op
+           optimizes   call Sym_5
+   385   no-op
+           optimizes   Reg_0 = Stack_D
+   385   *(Sym_171) = Reg_0
+   385   Reg_0 = 7
+   385   Stack_D = Reg_0
+   385   call Sym_47
+   385   call Sym_178
+   385   no-op
+           optimizes   Reg_0 = Sym_171
+   385   no-op
+           optimizes   Stack_D = Reg_0
+   385   no-op
+           optimizes   call Sym_71
+   385   Reg_0 = *(Sym_171)
+   385   Stack_D = Reg_0
+   393   call Sym_40
+   393   Reg_0 = 7
+   393   Stack_D = Reg_0
+   393   call Sym_41
+   394   Reg_0 = 2050
+   394   Stack_D = Reg_0
+   394   call Sym_39
+   394   Reg_0 = Sym_171
+   394   Stack_D = Reg_0
+   394   no-op
+           optimizes   call Sym_179
+   386   Reg_0 = 3
+   386   no-op
+           optimizes   Stack_D = Reg_0
+   386   no-op
+           optimizes   Reg_0 = Sym_171
+   386   no-op
+           optimizes   Stack_D = Reg_0
+   386   no-op
+           optimizes   call Sym_5
+   386   no-op
+           optimizes   Reg_0 = Stack_D
+   386   *(Sym_171) = Reg_0
+   386   call Sym_71
+   386   Reg_0 = 4
+   386   no-op
+           optimizes   Stack_D = Reg_0
+   386   no-op
+           optimizes   Reg_0 = Sym_171
+   386   no-op
+           optimizes   Stack_D = Reg_0
+   386   no-op
+           optimizes   call Sym_5
+   386   no-op
+           optimizes   Reg_0 = Stack_D
+   386   *(Sym_171) = Reg_0
+   394   no-op
+           optimizes   Reg_0 = Sym_171
+   394   no-op
+           optimizes   Stack_D = Reg_0
+   394   no-op
+           optimizes   call Sym_71
+   394   no-op
+           optimizes   Reg_0 = *(Sym_171)
+   394   Stack_D = Reg_0
+   394   call Sym_40
+   394   Reg_0 = 3
+   394   Stack_D = Reg_0
+   394   Reg_0 = 4
+   394   Stack_D = Reg_0
+   394   call Sym_41
+   395   Reg_0 = 2060
+   395   Stack_D = Reg_0
+   395   call Sym_39
+   395   no-op
+           optimizes   call Sym_180
+   387   Reg_0 = 5
+   387   no-op
+           optimizes   Stack_D = Reg_0
+   387   no-op
+           optimizes   Reg_0 = Sym_171
+   387   no-op
+           optimizes   Stack_D = Reg_0
+   387   no-op
+           optimizes   call Sym_5
+   387   no-op
+           optimizes   Reg_0 = Stack_D
+   387   *(Sym_171) = Reg_0
+   387   no-op
+           optimizes   Reg_0 = Sym_171
+   387   no-op
+           optimizes   Stack_D = Reg_0
+   387   no-op
+           optimizes   call Sym_71
+   387   no-op
+           optimizes   Reg_0 = *(Sym_171)
+   387   Stack_D = Reg_0
+   387   call Sym_172
+   387   no-op
+           optimizes   Reg_0 = Sym_171
+   387   no-op
+           optimizes   Stack_D = Reg_0
+   387   no-op
+           optimizes   call Sym_71
+   387   Reg_0 = *(Sym_171)
+   387   Stack_D = Reg_0
+   395   call Sym_40
+   395   Reg_0 = 5
+   395   Stack_D = Reg_0
+   395   Reg_0 = 11
+   395   Stack_D = Reg_0
+   395   call Sym_41
+   398   Reg_0 = Data_11
+   398   Stack_D = Reg_0
+   398   Reg_0 = 40
+   398   Stack_D = Reg_0
+   398   call Sym_0
+   398   call Sym_2
+   414   Reg_0 = 2100
+   414   Stack_D = Reg_0
+   414   call Sym_39
+   414   Reg_0 = 5
+   414   Stack_D = Reg_0
+   414   Reg_0 = 1
+   414   no-op
+           optimizes   Stack_D = Reg_0
+   414   no-op
+           optimizes   call Sym_181
+   406   no-op
+           optimizes   Reg_0 = Stack_D
+   406   if Reg_0 == 0 goto Label_333
+   406   call Sym_43
+   406   Reg_0 = Stack_D
+   406   if Reg_0 == 0 goto Label_334
+   406   call Sym_46
+   406   Reg_0 = 1
+   406   Stack_D = Reg_0
+   406   goto Label_335
+   406 label Label_333
+   406   call Sym_46
+   406   Reg_0 = 3
+   406   Stack_D = Reg_0
+   406 label Label_334
+   406 label Label_335
+   414   call Sym_40
+   414   Reg_0 = 1
+   414   Stack_D = Reg_0
+   414   call Sym_41
+   415   Reg_0 = 2110
+   415   Stack_D = Reg_0
+   415   call Sym_39
+   415   Reg_0 = 0
+   415   Stack_D = Reg_0
+   415   Reg_0 = 1
+   415   no-op
+           optimizes   Stack_D = Reg_0
+   415   no-op
+           optimizes   call Sym_181
+   406   no-op
+           optimizes   Reg_0 = Stack_D
+   406   if Reg_0 == 0 goto Label_336
+   406   call Sym_43
+   406   Reg_0 = Stack_D
+   406   if Reg_0 == 0 goto Label_337
+   406   call Sym_46
+   406   Reg_0 = 1
+   406   Stack_D = Reg_0
+   406   goto Label_338
+   406 label Label_336
+   406   call Sym_46
+   406   Reg_0 = 3
+   406   Stack_D = Reg_0
+   406 label Label_337
+   406 label Label_338
+   415   call Sym_40
+   415   Reg_0 = 0
+   415   Stack_D = Reg_0
+   415   call Sym_41
+   416   Reg_0 = 2120
+   416   Stack_D = Reg_0
+   416   call Sym_39
+   416   Reg_0 = 5
+   416   Stack_D = Reg_0
+   416   Reg_0 = 0
+   416   no-op
+           optimizes   Stack_D = Reg_0
+   416   no-op
+           optimizes   call Sym_181
+   406   no-op
+           optimizes   Reg_0 = Stack_D
+   406   if Reg_0 == 0 goto Label_339
+   406   call Sym_43
+   406   Reg_0 = Stack_D
+   406   if Reg_0 == 0 goto Label_340
+   406   call Sym_46
+   406   Reg_0 = 1
+   406   Stack_D = Reg_0
+   406   goto Label_341
+   406 label Label_339
+   406   call Sym_46
+   406   Reg_0 = 3
+   406   Stack_D = Reg_0
+   406 label Label_340
+   406 label Label_341
+   416   call Sym_40
+   416   Reg_0 = 3
+   416   Stack_D = Reg_0
+   416   call Sym_41
+   417   Reg_0 = 2130
+   417   Stack_D = Reg_0
+   417   call Sym_39
+   417   Reg_0 = 10
+   417   Stack_D = Reg_0
+   417   call Sym_182
+   417   call Sym_40
+   417   Reg_0 = 5
+   417   Stack_D = Reg_0
+   417   call Sym_41
+   418   Reg_0 = 2140
+   418   Stack_D = Reg_0
+   418   call Sym_39
+   418   Reg_0 = 0
+   418   Stack_D = Reg_0
+   418   call Sym_182
+   418   call Sym_40
+   418   Reg_0 = 0
+   418   Stack_D = Reg_0
+   418   call Sym_41
+   419   Reg_0 = 2150
+   419   Stack_D = Reg_0
+   419   call Sym_39
+   419   Reg_0 = *(Sym_13)
+   419   no-op
+           optimizes   Stack_D = Reg_0
+   419   no-op
+           optimizes   call Sym_184
+   410   no-op
+           optimizes   call Sym_44
+   410   no-op
+           optimizes   Reg_0 = Stack_D
+   410   if Reg_0 != 0 goto Label_343
+   410   no-op
+           optimizes   Reg_0 = Stack_D
+   410   no-op
+           optimizes   if Reg_0 == 0 goto Label_343
+   410 label Label_342
+   410   goto Label_342
+   410 label Label_343
+   419   call Sym_40
+   419   call Sym_41
+   420   Reg_0 = 2160
+   420   Stack_D = Reg_0
+   420   call Sym_39
+   420   Reg_0 = 1
+   420   Stack_D = Reg_0
+   420   no-op
+           optimizes   call Sym_185
+   412 label Label_344
+   412   call Sym_43
+   412   Reg_0 = 10
+   412   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   412   no-op
+           optimizes   call Sym_73
+   412   no-op
+           optimizes   Reg_1 = Stack_D
+   412   Reg_0 = Stack_D
+   412   if Reg_0 >= Reg_1 goto Label_345
+   412   no-op
+           optimizes   Reg_0 = Stack_D
+   412   no-op
+           optimizes   if Reg_0 == 0 goto Label_345
+   412   no-op
+           optimizes   call Sym_19
+   412   Reg_0 = Stack_D
+   412   Reg_0 += 1
+   412   no-op
+           optimizes   Stack_D = Reg_0
+   412   no-op
+           optimizes   call Sym_51
+   412   no-op
+           optimizes   Reg_0 = Stack_D
+   412   Reg_0 += Reg_0
+   412   Stack_D = Reg_0
+   412   goto Label_344
+   412 label Label_345
+   412   Reg_0 = 100
+   412   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   412   no-op
+           optimizes   call Sym_15
+   412   no-op
+           optimizes   Reg_1 = Stack_D
+   412   Reg_0 = Stack_D
+   412   Reg_0 += Reg_1
+   412   Stack_D = Reg_0
+   420   call Sym_40
+   420   Reg_0 = 110
+   420   Stack_D = Reg_0
+   420   call Sym_41
+   421   Reg_0 = 2170
+   421   Stack_D = Reg_0
+   421   call Sym_39
+   421   Reg_0 = 0
+   421   Stack_D = Reg_0
+   421   no-op
+           optimizes   call Sym_185
+   412 label Label_346
+   412   call Sym_43
+   412   Reg_0 = 10
+   412   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   412   no-op
+           optimizes   call Sym_73
+   412   no-op
+           optimizes   Reg_1 = Stack_D
+   412   Reg_0 = Stack_D
+   412   if Reg_0 >= Reg_1 goto Label_347
+   412   no-op
+           optimizes   Reg_0 = Stack_D
+   412   no-op
+           optimizes   if Reg_0 == 0 goto Label_347
+   412   no-op
+           optimizes   call Sym_19
+   412   Reg_0 = Stack_D
+   412   Reg_0 += 1
+   412   no-op
+           optimizes   Stack_D = Reg_0
+   412   no-op
+           optimizes   call Sym_51
+   412   no-op
+           optimizes   Reg_0 = Stack_D
+   412   Reg_0 += Reg_0
+   412   Stack_D = Reg_0
+   412   goto Label_346
+   412 label Label_347
+   412   Reg_0 = 100
+   412   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   412   no-op
+           optimizes   call Sym_15
+   412   no-op
+           optimizes   Reg_1 = Stack_D
+   412   Reg_0 = Stack_D
+   412   Reg_0 += Reg_1
+   412   Stack_D = Reg_0
+   421   call Sym_40
+   421   Reg_0 = 114
+   421   Stack_D = Reg_0
+   421   call Sym_41
+   422   Reg_0 = 2180
+   422   Stack_D = Reg_0
+   422   call Sym_39
+   422   Reg_0 = 20
+   422   Stack_D = Reg_0
+   422   no-op
+           optimizes   call Sym_185
+   412 label Label_348
+   412   call Sym_43
+   412   Reg_0 = 10
+   412   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   412   no-op
+           optimizes   call Sym_73
+   412   no-op
+           optimizes   Reg_1 = Stack_D
+   412   Reg_0 = Stack_D
+   412   if Reg_0 >= Reg_1 goto Label_349
+   412   no-op
+           optimizes   Reg_0 = Stack_D
+   412   no-op
+           optimizes   if Reg_0 == 0 goto Label_349
+   412   no-op
+           optimizes   call Sym_19
+   412   Reg_0 = Stack_D
+   412   Reg_0 += 1
+   412   no-op
+           optimizes   Stack_D = Reg_0
+   412   no-op
+           optimizes   call Sym_51
+   412   no-op
+           optimizes   Reg_0 = Stack_D
+   412   Reg_0 += Reg_0
+   412   Stack_D = Reg_0
+   412   goto Label_348
+   412 label Label_349
+   412   Reg_0 = 100
+   412   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   412   no-op
+           optimizes   call Sym_15
+   412   no-op
+           optimizes   Reg_1 = Stack_D
+   412   Reg_0 = Stack_D
+   412   Reg_0 += Reg_1
+   412   Stack_D = Reg_0
+   422   call Sym_40
+   422   Reg_0 = 120
+   422   Stack_D = Reg_0
+   422   call Sym_41
+   424   call Sym_186
+   424   call Sym_71
+   424   tail call Sym_46
+           optimizes   call Sym_46
+   424   no-op
+           optimizes label Label_0
+   424 }
+
+Peephole rewrites:
+  v4_leaf_Minusnested: redundant-test: test %edx,%edx => (none)
+  v4_nodefault: jump-next: jmp .L110 => (none)
+  v4_mismatches: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_mismatches: redundant-test: test %edx,%edx => (none)
+  v4_clamp: jump-next: jmp .L162 => (none)
+  v4_find_Minusfirst: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_find_Minusfirst: redundant-test: test %edx,%edx => (none)
+  v4_use_Minusclamp: jump-next: jmp .L248 => (none)
+  v4_use_Minusclamp: jump-next: jmp .L251 => (none)
+  v4_use_Minusclamp: jump-next: jmp .L254 => (none)
+  v4_sum_Minusi_Minusnoinline: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_sum_Minusj: redundant-test: test %edx,%edx => (none)
+  v4_use_Minusin_Minusloop: jump-next: jmp .L257 => (none)
+  v4_sum_Minusstep_Minus2: redundant-test: test %edx,%edx => (none)
+  main: redundant-test: test %eax,%eax => (none)
+  main: jump-next: jmp .L352 => (none)
+  main: jump-next: jmp .L355 => (none)
+  main: jump-next: jmp .L358 => (none)
+  main: jump-next: jmp .L329 => (none)
+  main: jump-next: jmp .L332 => (none)
+
@@ -0,0 +1,14242 @@
+	.file	"optstk.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/testsuite/",100,0,0,Ltext0
+.stabs	"optstk.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC5:
+	.string "TESTING CASE DISPATCH"
+.LC4:
+	.string "TESTING COMPARE AND BRANCH"
+.LC1:
+	.string "TESTING CONSTANT FOLDING AT CELL WIDTH"
+.LC7:
+	.string "TESTING CONSTANTS AS IMMEDIATES"
+.LC8:
+	.string "TESTING INLINING"
+.LC11:
+	.string "TESTING JUMP THREADING AND BLOCK MERGING"
+.LC3:
+	.string "TESTING LEAF WORDS"
+.LC9:
+	.string "TESTING LOOP INVARIANT HOISTING"
+.LC6:
+	.string "TESTING MULTIPLICATION AND DIVISION BY CONSTANTS"
+.LC0:
+	.string "TESTING OPTIMIZER"
+.LC2:
+	.string "TESTING TAIL CALLS"
+.LC10:
+	.string "TESTING VARIABLE ACCESSES"
+.stabs	"v4_Hashdividends:G2",40,0,0,v4_Hashdividends
+	.comm  v4_Hashdividends,4,4
+.stabs	"v4_Lessfalse_Greater:G2",40,0,0,v4_Lessfalse_Greater
+	.comm  v4_Lessfalse_Greater,4,4
+.stabs	"v4_Lesstrue_Greater:G2",40,0,0,v4_Lesstrue_Greater
+	.comm  v4_Lesstrue_Greater,4,4
+.stabs	"v4_biggest:G2",40,0,0,v4_biggest
+	.comm  v4_biggest,4,4
+.stabs	"v4_cell_Minusv:G2",40,0,0,v4_cell_Minusv
+	.comm  v4_cell_Minusv,4,4
+.stabs	"v4_dividends:Gar2;0;15;2",40,0,0,v4_dividends
+	.comm  v4_dividends,64,32
+.stabs	"v4_hundred:G2",40,0,0,v4_hundred
+	.comm  v4_hundred,4,4
+.stabs	"v4_leaf_Minusvar:G2",40,0,0,v4_leaf_Minusvar
+	.comm  v4_leaf_Minusvar,4,4
+.stabs	"v4_max_Minusint:G2",40,0,0,v4_max_Minusint
+	.comm  v4_max_Minusint,4,4
+.stabs	"v4_max_Minusuint:G2",40,0,0,v4_max_Minusuint
+	.comm  v4_max_Minusuint,4,4
+.stabs	"v4_min_Minusint:G2",40,0,0,v4_min_Minusint
+	.comm  v4_min_Minusint,4,4
+.stabs	"v4_minus_Minusone:G2",40,0,0,v4_minus_Minusone
+	.comm  v4_minus_Minusone,4,4
+.stabs	"v4_step:G2",40,0,0,v4_step
+	.comm  v4_step,4,4
+.stabs	"v4_three_Minushundred:G2",40,0,0,v4_three_Minushundred
+	.comm  v4_three_Minushundred,4,4
+.stabs	"v4_zero:G2",40,0,0,v4_zero
+	.comm  v4_zero,4,4
+.text
+	.align 4
+.stabs "v4_fold1:F1",36,0,0,v4_fold1
+.globl v4_fold1
+	.type	v4_fold1,@function
+v4_fold1:
+.stabn 68,0,21,.LMa0-v4_fold1
+.LMa0:
+.stabn 68,0,21,.LMb0-v4_fold1
+.LMb0:
+.LBB14:
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS0
+	call v4__dscheck
+.LDS0:
+	mov %ecx,v4__dsindex
+.LBE14:
+.stabn 68,0,21,.LM10-v4_fold1
+.LM10:
+	ret
+.Lfe14:
+	.size	 v4_fold1,.Lfe14-v4_fold1
+.stabn	192,0,0,.LBB14-v4_fold1
+.stabn	224,0,0,.LBE14-v4_fold1
+.Lscope14:
+.stabs	"",36,0,0,.Lscope14-v4_fold1
+.text
+	.align 4
+.stabs "v4_fold2:F1",36,0,0,v4_fold2
+.globl v4_fold2
+	.type	v4_fold2,@function
+v4_fold2:
+.stabn 68,0,22,.LMa11-v4_fold2
+.LMa11:
+.stabn 68,0,22,.LMb11-v4_fold2
+.LMb11:
+.LBB17:
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS1
+	call v4__dscheck
+.LDS1:
+	mov %ecx,v4__dsindex
+.LBE17:
+.stabn 68,0,22,.LM18-v4_fold2
+.LM18:
+	ret
+.Lfe17:
+	.size	 v4_fold2,.Lfe17-v4_fold2
+.stabn	192,0,0,.LBB17-v4_fold2
+.stabn	224,0,0,.LBE17-v4_fold2
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-v4_fold2
+.text
+	.align 4
+.stabs "v4_fold3:F1",36,0,0,v4_fold3
+.globl v4_fold3
+	.type	v4_fold3,@function
+v4_fold3:
+.stabn 68,0,23,.LMa19-v4_fold3
+.LMa19:
+.stabn 68,0,23,.LMb19-v4_fold3
+.LMb19:
+.LBB18:
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS2
+	call v4__dscheck
+.LDS2:
+	mov %ecx,v4__dsindex
+.LBE18:
+.stabn 68,0,23,.LM27-v4_fold3
+.LM27:
+	ret
+.Lfe18:
+	.size	 v4_fold3,.Lfe18-v4_fold3
+.stabn	192,0,0,.LBB18-v4_fold3
+.stabn	224,0,0,.LBE18-v4_fold3
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4_fold3
+.text
+	.align 4
+.stabs "v4_fold4:F1",36,0,0,v4_fold4
+.globl v4_fold4
+	.type	v4_fold4,@function
+v4_fold4:
+.stabn 68,0,24,.LMa28-v4_fold4
+.LMa28:
+.stabn 68,0,24,.LMb28-v4_fold4
+.LMb28:
+.LBB20:
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS3
+	call v4__dscheck
+.LDS3:
+	mov %ecx,v4__dsindex
+.LBE20:
+.stabn 68,0,24,.LM37-v4_fold4
+.LM37:
+	ret
+.Lfe20:
+	.size	 v4_fold4,.Lfe20-v4_fold4
+.stabn	192,0,0,.LBB20-v4_fold4
+.stabn	224,0,0,.LBE20-v4_fold4
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4_fold4
+.text
+	.align 4
+.stabs "v4_fold5:F1",36,0,0,v4_fold5
+.globl v4_fold5
+	.type	v4_fold5,@function
+v4_fold5:
+.stabn 68,0,29,.LMa38-v4_fold5
+.LMa38:
+.stabn 68,0,29,.LMb38-v4_fold5
+.LMb38:
+.LBB24:
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS4
+	call v4__dscheck
+.LDS4:
+	mov %ecx,v4__dsindex
+.LBE24:
+.stabn 68,0,29,.LM45-v4_fold5
+.LM45:
+	ret
+.Lfe24:
+	.size	 v4_fold5,.Lfe24-v4_fold5
+.stabn	192,0,0,.LBB24-v4_fold5
+.stabn	224,0,0,.LBE24-v4_fold5
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4_fold5
+.text
+	.align 4
+.stabs "v4_fold6:F1",36,0,0,v4_fold6
+.globl v4_fold6
+	.type	v4_fold6,@function
+v4_fold6:
+.stabn 68,0,30,.LMa46-v4_fold6
+.LMa46:
+.stabn 68,0,30,.LMb46-v4_fold6
+.LMb46:
+.LBB25:
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS5
+	call v4__dscheck
+.LDS5:
+	mov %ecx,v4__dsindex
+.LBE25:
+.stabn 68,0,30,.LM51-v4_fold6
+.LM51:
+	ret
+.Lfe25:
+	.size	 v4_fold6,.Lfe25-v4_fold6
+.stabn	192,0,0,.LBB25-v4_fold6
+.stabn	224,0,0,.LBE25-v4_fold6
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4_fold6
+.text
+	.align 4
+.stabs "v4_fold7:F1",36,0,0,v4_fold7
+.globl v4_fold7
+	.type	v4_fold7,@function
+v4_fold7:
+.stabn 68,0,32,.LMa52-v4_fold7
+.LMa52:
+.stabn 68,0,32,.LMb52-v4_fold7
+.LMb52:
+.LBB26:
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS6
+	call v4__dscheck
+.LDS6:
+	mov %ecx,v4__dsindex
+.LBE26:
+.stabn 68,0,32,.LM57-v4_fold7
+.LM57:
+	ret
+.Lfe26:
+	.size	 v4_fold7,.Lfe26-v4_fold7
+.stabn	192,0,0,.LBB26-v4_fold7
+.stabn	224,0,0,.LBE26-v4_fold7
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4_fold7
+.text
+	.align 4
+.stabs "v4_fold8:F1",36,0,0,v4_fold8
+.globl v4_fold8
+	.type	v4_fold8,@function
+v4_fold8:
+.stabn 68,0,33,.LMa58-v4_fold8
+.LMa58:
+.stabn 68,0,33,.LMb58-v4_fold8
+.LMb58:
+.LBB28:
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS7
+	call v4__dscheck
+.LDS7:
+	mov %ecx,v4__dsindex
+.LBE28:
+.stabn 68,0,33,.LM67-v4_fold8
+.LM67:
+	ret
+.Lfe28:
+	.size	 v4_fold8,.Lfe28-v4_fold8
+.stabn	192,0,0,.LBB28-v4_fold8
+.stabn	224,0,0,.LBE28-v4_fold8
+.Lscope28:
+.stabs	"",36,0,0,.Lscope28-v4_fold8
+.text
+	.align 4
+.stabs "v4_fold9:F1",36,0,0,v4_fold9
+.globl v4_fold9
+	.type	v4_fold9,@function
+v4_fold9:
+.stabn 68,0,34,.LMa68-v4_fold9
+.LMa68:
+.stabn 68,0,34,.LMb68-v4_fold9
+.LMb68:
+.LBB29:
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS8
+	call v4__dscheck
+.LDS8:
+	mov %ecx,v4__dsindex
+.LBE29:
+.stabn 68,0,34,.LM84-v4_fold9
+.LM84:
+	ret
+.Lfe29:
+	.size	 v4_fold9,.Lfe29-v4_fold9
+.stabn	192,0,0,.LBB29-v4_fold9
+.stabn	224,0,0,.LBE29-v4_fold9
+.Lscope29:
+.stabs	"",36,0,0,.Lscope29-v4_fold9
+.text
+	.align 4
+.stabs "v4_fold10:F1",36,0,0,v4_fold10
+.globl v4_fold10
+	.type	v4_fold10,@function
+v4_fold10:
+.stabn 68,0,35,.LMa85-v4_fold10
+.LMa85:
+.stabn 68,0,35,.LMb85-v4_fold10
+.LMb85:
+.LBB34:
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS9
+	call v4__dscheck
+.LDS9:
+	mov %ecx,v4__dsindex
+.LBE34:
+.stabn 68,0,35,.LM99-v4_fold10
+.LM99:
+	ret
+.Lfe34:
+	.size	 v4_fold10,.Lfe34-v4_fold10
+.stabn	192,0,0,.LBB34-v4_fold10
+.stabn	224,0,0,.LBE34-v4_fold10
+.Lscope34:
+.stabs	"",36,0,0,.Lscope34-v4_fold10
+.text
+	.align 4
+.stabs "v4_fold11:F1",36,0,0,v4_fold11
+.globl v4_fold11
+	.type	v4_fold11,@function
+v4_fold11:
+.stabn 68,0,36,.LMa100-v4_fold11
+.LMa100:
+	push %esi
+.stabn 68,0,36,.LMb100-v4_fold11
+.LMb100:
+.LBB38:
+	mov (v4_max_Minusuint),%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS10
+	call v4__dscheck
+.LDS10:
+	mov %ecx,v4__dsindex
+.LBE38:
+.stabn 68,0,36,.LM111-v4_fold11
+.LM111:
+	pop %esi
+	ret
+.Lfe38:
+	.size	 v4_fold11,.Lfe38-v4_fold11
+.stabn	192,0,0,.LBB38-v4_fold11
+.stabn	224,0,0,.LBE38-v4_fold11
+.Lscope38:
+.stabs	"",36,0,0,.Lscope38-v4_fold11
+.text
+	.align 4
+.stabs "v4_countdown:F1",36,0,0,v4_countdown
+.globl v4_countdown
+	.type	v4_countdown,@function
+v4_countdown:
+.stabn 68,0,55,.LMa112-v4_countdown
+.LMa112:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,55,.LMb112-v4_countdown
+.LMb112:
+.LBB42:
+	mov v4__dsindex,%ecx
+.L359:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS11
+	call v4__dscheck
+.LDS11:
+	test %eax,%eax
+	jne .L13
+	jmp .L12
+.L13:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	dec %eax
+	cmp $4080,%ecx
+	jbe .LDS12
+	call v4__dscheck
+.LDS12:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS13
+	call v4__dscheck
+.LDS13:
+	jmp .L359
+.L12:
+	mov %ecx,v4__dsindex
+.LBE42:
+.stabn 68,0,55,.LM128-v4_countdown
+.LM128:
+	pop %ebx
+	leave
+	ret
+.Lfe42:
+	.size	 v4_countdown,.Lfe42-v4_countdown
+.stabn	192,0,0,.LBB42-v4_countdown
+.stabn	224,0,0,.LBE42-v4_countdown
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4_countdown
+.text
+	.align 4
+.stabs "v4_sumto:F1",36,0,0,v4_sumto
+.globl v4_sumto
+	.type	v4_sumto,@function
+v4_sumto:
+.stabn 68,0,56,.LMa129-v4_sumto
+.LMa129:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,56,.LMb129-v4_sumto
+.LMb129:
+.LBB45:
+	mov v4__dsindex,%ecx
+.L360:
+.stabn 68,0,57,.LM131-v4_sumto
+.LM131:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS14
+	call v4__dscheck
+.LDS14:
+	test %eax,%eax
+	jne .L15
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_drop
+	mov v4__dsindex,%ecx
+.L15:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	call v4_over
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS15
+	call v4__dscheck
+.LDS15:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS16
+	call v4__dscheck
+.LDS16:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	dec %eax
+	cmp $4080,%ecx
+	jbe .LDS17
+	call v4__dscheck
+.LDS17:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS18
+	call v4__dscheck
+.LDS18:
+	jmp .L360
+	mov %ecx,v4__dsindex
+.LBE45:
+.stabn 68,0,57,.LM154-v4_sumto
+.LM154:
+	pop %ebx
+	leave
+	ret
+.Lfe45:
+	.size	 v4_sumto,.Lfe45-v4_sumto
+.stabn	192,0,0,.LBB45-v4_sumto
+.stabn	224,0,0,.LBE45-v4_sumto
+.Lscope45:
+.stabs	"",36,0,0,.Lscope45-v4_sumto
+.text
+	.align 4
+.stabs "v4_tail2:F1",36,0,0,v4_tail2
+.globl v4_tail2
+	.type	v4_tail2,@function
+v4_tail2:
+.stabn 68,0,58,.LMa155-v4_tail2
+.LMa155:
+.stabn 68,0,58,.LMb155-v4_tail2
+.LMb155:
+.LBB49:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS19
+	call v4__dscheck
+.LDS19:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS20
+	call v4__dscheck
+.LDS20:
+	mov %ecx,v4__dsindex
+.LBE49:
+.stabn 68,0,58,.LM161-v4_tail2
+.LM161:
+	ret
+.Lfe49:
+	.size	 v4_tail2,.Lfe49-v4_tail2
+.stabn	192,0,0,.LBB49-v4_tail2
+.stabn	224,0,0,.LBE49-v4_tail2
+.Lscope49:
+.stabs	"",36,0,0,.Lscope49-v4_tail2
+.text
+	.align 4
+.stabs "v4_tail1:F1",36,0,0,v4_tail1
+.globl v4_tail1
+	.type	v4_tail1,@function
+v4_tail1:
+.stabn 68,0,59,.LMa162-v4_tail1
+.LMa162:
+.stabn 68,0,59,.LMb162-v4_tail1
+.LMb162:
+.LBB50:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %eax,%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS21
+	call v4__dscheck
+.LDS21:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS22
+	call v4__dscheck
+.LDS22:
+	mov %ecx,v4__dsindex
+.LBE50:
+.stabn 68,0,59,.LM173-v4_tail1
+.LM173:
+	ret
+.Lfe50:
+	.size	 v4_tail1,.Lfe50-v4_tail1
+.stabn	192,0,0,.LBB50-v4_tail1
+.stabn	224,0,0,.LBE50-v4_tail1
+.Lscope50:
+.stabs	"",36,0,0,.Lscope50-v4_tail1
+.text
+	.align 4
+.stabs "v4_tail_Minusif:F1",36,0,0,v4_tail_Minusif
+.globl v4_tail_Minusif
+	.type	v4_tail_Minusif,@function
+v4_tail_Minusif:
+.stabn 68,0,60,.LMa174-v4_tail_Minusif
+.LMa174:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,60,.LMb174-v4_tail_Minusif
+.LMb174:
+.LBB52:
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS23
+	call v4__dscheck
+.LDS23:
+	test %eax,%eax
+	jge .L19
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	neg %eax
+	cmp $4080,%ecx
+	jbe .LDS24
+	call v4__dscheck
+.LDS24:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS25
+	call v4__dscheck
+.LDS25:
+	jmp .L18
+.L19:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %eax,%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS26
+	call v4__dscheck
+.LDS26:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS27
+	call v4__dscheck
+.LDS27:
+.L18:
+	mov %ecx,v4__dsindex
+.LBE52:
+.stabn 68,0,60,.LM198-v4_tail_Minusif
+.LM198:
+	pop %ebx
+	leave
+	ret
+.Lfe52:
+	.size	 v4_tail_Minusif,.Lfe52-v4_tail_Minusif
+.stabn	192,0,0,.LBB52-v4_tail_Minusif
+.stabn	224,0,0,.LBE52-v4_tail_Minusif
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4_tail_Minusif
+.text
+	.align 4
+.stabs "v4_tail_Minusrs:F1",36,0,0,v4_tail_Minusrs
+.globl v4_tail_Minusrs
+	.type	v4_tail_Minusrs,@function
+v4_tail_Minusrs:
+.stabn 68,0,61,.LMa199-v4_tail_Minusrs
+.LMa199:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+.stabn 68,0,61,.LMb199-v4_tail_Minusrs
+.LMb199:
+.LBB54:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-12(%ebp)
+	mov $3,%eax
+	mov %eax,%esi
+	mov -12(%ebp),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS28
+	call v4__dscheck
+.LDS28:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS29
+	call v4__dscheck
+.LDS29:
+	mov %ecx,v4__dsindex
+.LBE54:
+.stabn 68,0,61,.LM219-v4_tail_Minusrs
+.LM219:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe54:
+	.size	 v4_tail_Minusrs,.Lfe54-v4_tail_Minusrs
+.stabn	192,0,0,.LBB54-v4_tail_Minusrs
+.stabn	224,0,0,.LBE54-v4_tail_Minusrs
+.Lscope54:
+.stabs	"",36,0,0,.Lscope54-v4_tail_Minusrs
+.text
+	.align 4
+.stabs "v4_tail_Minusloop:F1",36,0,0,v4_tail_Minusloop
+.globl v4_tail_Minusloop
+	.type	v4_tail_Minusloop,@function
+v4_tail_Minusloop:
+.stabn 68,0,62,.LMa220-v4_tail_Minusloop
+.LMa220:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+.stabn 68,0,62,.LMb220-v4_tail_Minusloop
+.LMb220:
+.LBB57:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $5,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov %eax,-12(%ebp)
+	mov %edx,-16(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS30
+	call v4__dscheck
+.LDS30:
+.L23:
+	mov -16(%ebp),%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS31
+	call v4__dscheck
+.LDS31:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -16(%ebp),%edx
+	inc %edx
+	mov -12(%ebp),%eax
+	mov %edx,-16(%ebp)
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS32
+	call v4__dscheck
+.LDS32:
+	test %edx,%edx
+	jne .L23
+	mov -12(%ebp),%eax
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS33
+	call v4__dscheck
+.LDS33:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS34
+	call v4__dscheck
+.LDS34:
+	mov %ecx,v4__dsindex
+.LBE57:
+.stabn 68,0,62,.LM257-v4_tail_Minusloop
+.LM257:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe57:
+	.size	 v4_tail_Minusloop,.Lfe57-v4_tail_Minusloop
+.stabn	192,0,0,.LBB57-v4_tail_Minusloop
+.stabn	224,0,0,.LBE57-v4_tail_Minusloop
+.Lscope57:
+.stabs	"",36,0,0,.Lscope57-v4_tail_Minusloop
+.text
+	.align 4
+.stabs "v4_tail_Minusexec:F1",36,0,0,v4_tail_Minusexec
+.globl v4_tail_Minusexec
+	.type	v4_tail_Minusexec,@function
+v4_tail_Minusexec:
+.stabn 68,0,63,.LMa258-v4_tail_Minusexec
+.LMa258:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,63,.LMb258-v4_tail_Minusexec
+.LMb258:
+.LBB59:
+	pop %ebx
+	leave
+	jmp v4_execute
+.LBE59:
+.stabn 68,0,63,.LM261-v4_tail_Minusexec
+.LM261:
+	pop %ebx
+	leave
+	ret
+.Lfe59:
+	.size	 v4_tail_Minusexec,.Lfe59-v4_tail_Minusexec
+.stabn	192,0,0,.LBB59-v4_tail_Minusexec
+.stabn	224,0,0,.LBE59-v4_tail_Minusexec
+.Lscope59:
+.stabs	"",36,0,0,.Lscope59-v4_tail_Minusexec
+.text
+	.align 4
+.stabs "v4_leaf1:F1",36,0,0,v4_leaf1
+.globl v4_leaf1
+	.type	v4_leaf1,@function
+v4_leaf1:
+.stabn 68,0,77,.LMa262-v4_leaf1
+.LMa262:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,77,.LMb262-v4_leaf1
+.LMb262:
+.LBB60:
+	call v4_dup
+	pop %ebx
+	leave
+	jmp v4_Star
+.LBE60:
+.stabn 68,0,77,.LM266-v4_leaf1
+.LM266:
+	pop %ebx
+	leave
+	ret
+.Lfe60:
+	.size	 v4_leaf1,.Lfe60-v4_leaf1
+.stabn	192,0,0,.LBB60-v4_leaf1
+.stabn	224,0,0,.LBE60-v4_leaf1
+.Lscope60:
+.stabs	"",36,0,0,.Lscope60-v4_leaf1
+.text
+	.align 4
+.stabs "v4_leaf2:F1",36,0,0,v4_leaf2
+.globl v4_leaf2
+	.type	v4_leaf2,@function
+v4_leaf2:
+.stabn 68,0,78,.LMa267-v4_leaf2
+.LMa267:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,78,.LMb267-v4_leaf2
+.LMb267:
+.LBB61:
+	call v4_z2dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS35
+	call v4__dscheck
+.LDS35:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS36
+	call v4__dscheck
+.LDS36:
+	mov %ecx,v4__dsindex
+.LBE61:
+.stabn 68,0,78,.LM275-v4_leaf2
+.LM275:
+	pop %ebx
+	leave
+	ret
+.Lfe61:
+	.size	 v4_leaf2,.Lfe61-v4_leaf2
+.stabn	192,0,0,.LBB61-v4_leaf2
+.stabn	224,0,0,.LBE61-v4_leaf2
+.Lscope61:
+.stabs	"",36,0,0,.Lscope61-v4_leaf2
+.text
+	.align 4
+.stabs "v4_leaf_Minusloop:F1",36,0,0,v4_leaf_Minusloop
+.globl v4_leaf_Minusloop
+	.type	v4_leaf_Minusloop,@function
+v4_leaf_Minusloop:
+.stabn 68,0,79,.LMa276-v4_leaf_Minusloop
+.LMa276:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+.stabn 68,0,79,.LMb276-v4_leaf_Minusloop
+.LMb276:
+.LBB63:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $10,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov %eax,-12(%ebp)
+	mov %edx,-16(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS37
+	call v4__dscheck
+.LDS37:
+.L30:
+	mov -16(%ebp),%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS38
+	call v4__dscheck
+.LDS38:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -16(%ebp),%edx
+	inc %edx
+	mov -12(%ebp),%eax
+	mov %edx,-16(%ebp)
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS39
+	call v4__dscheck
+.LDS39:
+	test %edx,%edx
+	jne .L30
+	mov -12(%ebp),%eax
+	mov %ecx,v4__dsindex
+.LBE63:
+.stabn 68,0,79,.LM308-v4_leaf_Minusloop
+.LM308:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe63:
+	.size	 v4_leaf_Minusloop,.Lfe63-v4_leaf_Minusloop
+.stabn	192,0,0,.LBB63-v4_leaf_Minusloop
+.stabn	224,0,0,.LBE63-v4_leaf_Minusloop
+.Lscope63:
+.stabs	"",36,0,0,.Lscope63-v4_leaf_Minusloop
+.text
+	.align 4
+.stabs "v4_leaf_Minusnested:F1",36,0,0,v4_leaf_Minusnested
+.globl v4_leaf_Minusnested
+	.type	v4_leaf_Minusnested,@function
+v4_leaf_Minusnested:
+.stabn 68,0,80,.LMa309-v4_leaf_Minusnested
+.LMa309:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+.stabn 68,0,80,.LMb309-v4_leaf_Minusnested
+.LMb309:
+.LBB64:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov %eax,-12(%ebp)
+	mov %edx,-16(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS40
+	call v4__dscheck
+.LDS40:
+.L34:
+	mov $4,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov %eax,-20(%ebp)
+	mov %edx,-24(%ebp)
+.L37:
+	mov -16(%ebp),%eax
+	lea (%eax,%eax,4),%eax
+	add %eax,%eax
+	mov %eax,%esi
+	mov -24(%ebp),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS41
+	call v4__dscheck
+.LDS41:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -24(%ebp),%edx
+	inc %edx
+	mov -20(%ebp),%eax
+	mov %edx,-24(%ebp)
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS42
+	call v4__dscheck
+.LDS42:
+	test %edx,%edx
+	jne .L37
+	mov -20(%ebp),%eax
+	mov -16(%ebp),%edx
+	inc %edx
+	mov -12(%ebp),%eax
+	mov %edx,-16(%ebp)
+	sub %eax,%edx
+	jne .L34
+	mov -12(%ebp),%eax
+	mov %ecx,v4__dsindex
+.LBE64:
+.stabn 68,0,80,.LM375-v4_leaf_Minusnested
+.LM375:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe64:
+	.size	 v4_leaf_Minusnested,.Lfe64-v4_leaf_Minusnested
+.stabn	192,0,0,.LBB64-v4_leaf_Minusnested
+.stabn	224,0,0,.LBE64-v4_leaf_Minusnested
+.Lscope64:
+.stabs	"",36,0,0,.Lscope64-v4_leaf_Minusnested
+.text
+	.align 4
+.stabs "v4_leaf_Minusrs:F1",36,0,0,v4_leaf_Minusrs
+.globl v4_leaf_Minusrs
+	.type	v4_leaf_Minusrs,@function
+v4_leaf_Minusrs:
+.stabn 68,0,81,.LMa376-v4_leaf_Minusrs
+.LMa376:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+.stabn 68,0,81,.LMb376-v4_leaf_Minusrs
+.LMb376:
+.LBB66:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-12(%ebp)
+	mov -12(%ebp),%eax
+	mov %eax,%esi
+	mov -12(%ebp),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS43
+	call v4__dscheck
+.LDS43:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS44
+	call v4__dscheck
+.LDS44:
+	mov %ecx,v4__dsindex
+.LBE66:
+.stabn 68,0,81,.LM392-v4_leaf_Minusrs
+.LM392:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe66:
+	.size	 v4_leaf_Minusrs,.Lfe66-v4_leaf_Minusrs
+.stabn	192,0,0,.LBB66-v4_leaf_Minusrs
+.stabn	224,0,0,.LBE66-v4_leaf_Minusrs
+.Lscope66:
+.stabs	"",36,0,0,.Lscope66-v4_leaf_Minusrs
+.text
+	.align 4
+.stabs "v4_leaf_Minusstore:F1",36,0,0,v4_leaf_Minusstore
+.globl v4_leaf_Minusstore
+	.type	v4_leaf_Minusstore,@function
+v4_leaf_Minusstore:
+.stabn 68,0,83,.LMa393-v4_leaf_Minusstore
+.LMa393:
+.stabn 68,0,83,.LMb393-v4_leaf_Minusstore
+.LMb393:
+.LBB69:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,(v4_leaf_Minusvar)
+	cmp $4080,%ecx
+	jbe .LDS45
+	call v4__dscheck
+.LDS45:
+	mov %ecx,v4__dsindex
+.LBE69:
+.stabn 68,0,83,.LM400-v4_leaf_Minusstore
+.LM400:
+	ret
+.Lfe69:
+	.size	 v4_leaf_Minusstore,.Lfe69-v4_leaf_Minusstore
+.stabn	192,0,0,.LBB69-v4_leaf_Minusstore
+.stabn	224,0,0,.LBE69-v4_leaf_Minusstore
+.Lscope69:
+.stabs	"",36,0,0,.Lscope69-v4_leaf_Minusstore
+.text
+	.align 4
+.stabs "v4_leaf_Minusfetch:F1",36,0,0,v4_leaf_Minusfetch
+.globl v4_leaf_Minusfetch
+	.type	v4_leaf_Minusfetch,@function
+v4_leaf_Minusfetch:
+.stabn 68,0,84,.LMa401-v4_leaf_Minusfetch
+.LMa401:
+.stabn 68,0,84,.LMb401-v4_leaf_Minusfetch
+.LMb401:
+.LBB70:
+	mov (v4_leaf_Minusvar),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS46
+	call v4__dscheck
+.LDS46:
+	mov %ecx,v4__dsindex
+.LBE70:
+.stabn 68,0,84,.LM408-v4_leaf_Minusfetch
+.LM408:
+	ret
+.Lfe70:
+	.size	 v4_leaf_Minusfetch,.Lfe70-v4_leaf_Minusfetch
+.stabn	192,0,0,.LBB70-v4_leaf_Minusfetch
+.stabn	224,0,0,.LBE70-v4_leaf_Minusfetch
+.Lscope70:
+.stabs	"",36,0,0,.Lscope70-v4_leaf_Minusfetch
+.text
+	.align 4
+.stabs "v4_cb_Less:F1",36,0,0,v4_cb_Less
+.globl v4_cb_Less
+	.type	v4_cb_Less,@function
+v4_cb_Less:
+.stabn 68,0,98,.LMa409-v4_cb_Less
+.LMa409:
+.stabn 68,0,98,.LMb409-v4_cb_Less
+.LMb409:
+.LBB72:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS47
+	call v4__dscheck
+.LDS47:
+	cmp %edx,%eax
+	jge .L43
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS48
+	call v4__dscheck
+.LDS48:
+	jmp .L44
+.L43:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS49
+	call v4__dscheck
+.LDS49:
+.L44:
+	mov %ecx,v4__dsindex
+.LBE72:
+.stabn 68,0,98,.LM424-v4_cb_Less
+.LM424:
+	ret
+.Lfe72:
+	.size	 v4_cb_Less,.Lfe72-v4_cb_Less
+.stabn	192,0,0,.LBB72-v4_cb_Less
+.stabn	224,0,0,.LBE72-v4_cb_Less
+.Lscope72:
+.stabs	"",36,0,0,.Lscope72-v4_cb_Less
+.text
+	.align 4
+.stabs "v4_cb_Greater:F1",36,0,0,v4_cb_Greater
+.globl v4_cb_Greater
+	.type	v4_cb_Greater,@function
+v4_cb_Greater:
+.stabn 68,0,99,.LMa425-v4_cb_Greater
+.LMa425:
+.stabn 68,0,99,.LMb425-v4_cb_Greater
+.LMb425:
+.LBB74:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS50
+	call v4__dscheck
+.LDS50:
+	cmp %edx,%eax
+	jle .L46
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS51
+	call v4__dscheck
+.LDS51:
+	jmp .L47
+.L46:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS52
+	call v4__dscheck
+.LDS52:
+.L47:
+	mov %ecx,v4__dsindex
+.LBE74:
+.stabn 68,0,99,.LM440-v4_cb_Greater
+.LM440:
+	ret
+.Lfe74:
+	.size	 v4_cb_Greater,.Lfe74-v4_cb_Greater
+.stabn	192,0,0,.LBB74-v4_cb_Greater
+.stabn	224,0,0,.LBE74-v4_cb_Greater
+.Lscope74:
+.stabs	"",36,0,0,.Lscope74-v4_cb_Greater
+.text
+	.align 4
+.stabs "v4_cb_Equals:F1",36,0,0,v4_cb_Equals
+.globl v4_cb_Equals
+	.type	v4_cb_Equals,@function
+v4_cb_Equals:
+.stabn 68,0,100,.LMa441-v4_cb_Equals
+.LMa441:
+.stabn 68,0,100,.LMb441-v4_cb_Equals
+.LMb441:
+.LBB76:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS53
+	call v4__dscheck
+.LDS53:
+	cmp %edx,%eax
+	jne .L49
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS54
+	call v4__dscheck
+.LDS54:
+	jmp .L50
+.L49:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS55
+	call v4__dscheck
+.LDS55:
+.L50:
+	mov %ecx,v4__dsindex
+.LBE76:
+.stabn 68,0,100,.LM456-v4_cb_Equals
+.LM456:
+	ret
+.Lfe76:
+	.size	 v4_cb_Equals,.Lfe76-v4_cb_Equals
+.stabn	192,0,0,.LBB76-v4_cb_Equals
+.stabn	224,0,0,.LBE76-v4_cb_Equals
+.Lscope76:
+.stabs	"",36,0,0,.Lscope76-v4_cb_Equals
+.text
+	.align 4
+.stabs "v4_cb_Less_Greater:F1",36,0,0,v4_cb_Less_Greater
+.globl v4_cb_Less_Greater
+	.type	v4_cb_Less_Greater,@function
+v4_cb_Less_Greater:
+.stabn 68,0,101,.LMa457-v4_cb_Less_Greater
+.LMa457:
+.stabn 68,0,101,.LMb457-v4_cb_Less_Greater
+.LMb457:
+.LBB78:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS56
+	call v4__dscheck
+.LDS56:
+	cmp %edx,%eax
+	je .L52
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS57
+	call v4__dscheck
+.LDS57:
+	jmp .L53
+.L52:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS58
+	call v4__dscheck
+.LDS58:
+.L53:
+	mov %ecx,v4__dsindex
+.LBE78:
+.stabn 68,0,101,.LM472-v4_cb_Less_Greater
+.LM472:
+	ret
+.Lfe78:
+	.size	 v4_cb_Less_Greater,.Lfe78-v4_cb_Less_Greater
+.stabn	192,0,0,.LBB78-v4_cb_Less_Greater
+.stabn	224,0,0,.LBE78-v4_cb_Less_Greater
+.Lscope78:
+.stabs	"",36,0,0,.Lscope78-v4_cb_Less_Greater
+.text
+	.align 4
+.stabs "v4_cbu_Less:F1",36,0,0,v4_cbu_Less
+.globl v4_cbu_Less
+	.type	v4_cbu_Less,@function
+v4_cbu_Less:
+.stabn 68,0,102,.LMa473-v4_cbu_Less
+.LMa473:
+.stabn 68,0,102,.LMb473-v4_cbu_Less
+.LMb473:
+.LBB80:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS59
+	call v4__dscheck
+.LDS59:
+	cmp %edx,%eax
+	jae .L55
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS60
+	call v4__dscheck
+.LDS60:
+	jmp .L56
+.L55:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS61
+	call v4__dscheck
+.LDS61:
+.L56:
+	mov %ecx,v4__dsindex
+.LBE80:
+.stabn 68,0,102,.LM488-v4_cbu_Less
+.LM488:
+	ret
+.Lfe80:
+	.size	 v4_cbu_Less,.Lfe80-v4_cbu_Less
+.stabn	192,0,0,.LBB80-v4_cbu_Less
+.stabn	224,0,0,.LBE80-v4_cbu_Less
+.Lscope80:
+.stabs	"",36,0,0,.Lscope80-v4_cbu_Less
+.text
+	.align 4
+.stabs "v4_cbu_Greater:F1",36,0,0,v4_cbu_Greater
+.globl v4_cbu_Greater
+	.type	v4_cbu_Greater,@function
+v4_cbu_Greater:
+.stabn 68,0,103,.LMa489-v4_cbu_Greater
+.LMa489:
+.stabn 68,0,103,.LMb489-v4_cbu_Greater
+.LMb489:
+.LBB82:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS62
+	call v4__dscheck
+.LDS62:
+	cmp %edx,%eax
+	jbe .L58
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS63
+	call v4__dscheck
+.LDS63:
+	jmp .L59
+.L58:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS64
+	call v4__dscheck
+.LDS64:
+.L59:
+	mov %ecx,v4__dsindex
+.LBE82:
+.stabn 68,0,103,.LM504-v4_cbu_Greater
+.LM504:
+	ret
+.Lfe82:
+	.size	 v4_cbu_Greater,.Lfe82-v4_cbu_Greater
+.stabn	192,0,0,.LBB82-v4_cbu_Greater
+.stabn	224,0,0,.LBE82-v4_cbu_Greater
+.Lscope82:
+.stabs	"",36,0,0,.Lscope82-v4_cbu_Greater
+.text
+	.align 4
+.stabs "v4_cbu_Less_Equals:F1",36,0,0,v4_cbu_Less_Equals
+.globl v4_cbu_Less_Equals
+	.type	v4_cbu_Less_Equals,@function
+v4_cbu_Less_Equals:
+.stabn 68,0,104,.LMa505-v4_cbu_Less_Equals
+.LMa505:
+.stabn 68,0,104,.LMb505-v4_cbu_Less_Equals
+.LMb505:
+.LBB84:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS65
+	call v4__dscheck
+.LDS65:
+	cmp %edx,%eax
+	ja .L61
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS66
+	call v4__dscheck
+.LDS66:
+	jmp .L62
+.L61:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS67
+	call v4__dscheck
+.LDS67:
+.L62:
+	mov %ecx,v4__dsindex
+.LBE84:
+.stabn 68,0,104,.LM520-v4_cbu_Less_Equals
+.LM520:
+	ret
+.Lfe84:
+	.size	 v4_cbu_Less_Equals,.Lfe84-v4_cbu_Less_Equals
+.stabn	192,0,0,.LBB84-v4_cbu_Less_Equals
+.stabn	224,0,0,.LBE84-v4_cbu_Less_Equals
+.Lscope84:
+.stabs	"",36,0,0,.Lscope84-v4_cbu_Less_Equals
+.text
+	.align 4
+.stabs "v4_cbu_Greater_Equals:F1",36,0,0,v4_cbu_Greater_Equals
+.globl v4_cbu_Greater_Equals
+	.type	v4_cbu_Greater_Equals,@function
+v4_cbu_Greater_Equals:
+.stabn 68,0,105,.LMa521-v4_cbu_Greater_Equals
+.LMa521:
+.stabn 68,0,105,.LMb521-v4_cbu_Greater_Equals
+.LMb521:
+.LBB86:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS68
+	call v4__dscheck
+.LDS68:
+	cmp %edx,%eax
+	jb .L64
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS69
+	call v4__dscheck
+.LDS69:
+	jmp .L65
+.L64:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS70
+	call v4__dscheck
+.LDS70:
+.L65:
+	mov %ecx,v4__dsindex
+.LBE86:
+.stabn 68,0,105,.LM536-v4_cbu_Greater_Equals
+.LM536:
+	ret
+.Lfe86:
+	.size	 v4_cbu_Greater_Equals,.Lfe86-v4_cbu_Greater_Equals
+.stabn	192,0,0,.LBB86-v4_cbu_Greater_Equals
+.stabn	224,0,0,.LBE86-v4_cbu_Greater_Equals
+.Lscope86:
+.stabs	"",36,0,0,.Lscope86-v4_cbu_Greater_Equals
+.text
+	.align 4
+.stabs "v4_cb0_Equals:F1",36,0,0,v4_cb0_Equals
+.globl v4_cb0_Equals
+	.type	v4_cb0_Equals,@function
+v4_cb0_Equals:
+.stabn 68,0,106,.LMa537-v4_cb0_Equals
+.LMa537:
+.stabn 68,0,106,.LMb537-v4_cb0_Equals
+.LMb537:
+.LBB88:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS71
+	call v4__dscheck
+.LDS71:
+	test %eax,%eax
+	jne .L67
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS72
+	call v4__dscheck
+.LDS72:
+	jmp .L68
+.L67:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS73
+	call v4__dscheck
+.LDS73:
+.L68:
+	mov %ecx,v4__dsindex
+.LBE88:
+.stabn 68,0,106,.LM551-v4_cb0_Equals
+.LM551:
+	ret
+.Lfe88:
+	.size	 v4_cb0_Equals,.Lfe88-v4_cb0_Equals
+.stabn	192,0,0,.LBB88-v4_cb0_Equals
+.stabn	224,0,0,.LBE88-v4_cb0_Equals
+.Lscope88:
+.stabs	"",36,0,0,.Lscope88-v4_cb0_Equals
+.text
+	.align 4
+.stabs "v4_cb0_Less:F1",36,0,0,v4_cb0_Less
+.globl v4_cb0_Less
+	.type	v4_cb0_Less,@function
+v4_cb0_Less:
+.stabn 68,0,107,.LMa552-v4_cb0_Less
+.LMa552:
+.stabn 68,0,107,.LMb552-v4_cb0_Less
+.LMb552:
+.LBB89:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS74
+	call v4__dscheck
+.LDS74:
+	test %eax,%eax
+	jge .L70
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS75
+	call v4__dscheck
+.LDS75:
+	jmp .L71
+.L70:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS76
+	call v4__dscheck
+.LDS76:
+.L71:
+	mov %ecx,v4__dsindex
+.LBE89:
+.stabn 68,0,107,.LM566-v4_cb0_Less
+.LM566:
+	ret
+.Lfe89:
+	.size	 v4_cb0_Less,.Lfe89-v4_cb0_Less
+.stabn	192,0,0,.LBB89-v4_cb0_Less
+.stabn	224,0,0,.LBE89-v4_cb0_Less
+.Lscope89:
+.stabs	"",36,0,0,.Lscope89-v4_cb0_Less
+.text
+	.align 4
+.stabs "v4_cb0_Greater:F1",36,0,0,v4_cb0_Greater
+.globl v4_cb0_Greater
+	.type	v4_cb0_Greater,@function
+v4_cb0_Greater:
+.stabn 68,0,108,.LMa567-v4_cb0_Greater
+.LMa567:
+.stabn 68,0,108,.LMb567-v4_cb0_Greater
+.LMb567:
+.LBB90:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS77
+	call v4__dscheck
+.LDS77:
+	test %eax,%eax
+	jle .L73
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS78
+	call v4__dscheck
+.LDS78:
+	jmp .L74
+.L73:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS79
+	call v4__dscheck
+.LDS79:
+.L74:
+	mov %ecx,v4__dsindex
+.LBE90:
+.stabn 68,0,108,.LM581-v4_cb0_Greater
+.LM581:
+	ret
+.Lfe90:
+	.size	 v4_cb0_Greater,.Lfe90-v4_cb0_Greater
+.stabn	192,0,0,.LBB90-v4_cb0_Greater
+.stabn	224,0,0,.LBE90-v4_cb0_Greater
+.Lscope90:
+.stabs	"",36,0,0,.Lscope90-v4_cb0_Greater
+.text
+	.align 4
+.stabs "v4_cb_Less5:F1",36,0,0,v4_cb_Less5
+.globl v4_cb_Less5
+	.type	v4_cb_Less5,@function
+v4_cb_Less5:
+.stabn 68,0,109,.LMa582-v4_cb_Less5
+.LMa582:
+.stabn 68,0,109,.LMb582-v4_cb_Less5
+.LMb582:
+.LBB92:
+	mov $5,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS80
+	call v4__dscheck
+.LDS80:
+	cmp %edx,%eax
+	jge .L76
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS81
+	call v4__dscheck
+.LDS81:
+	jmp .L77
+.L76:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS82
+	call v4__dscheck
+.LDS82:
+.L77:
+	mov %ecx,v4__dsindex
+.LBE92:
+.stabn 68,0,109,.LM599-v4_cb_Less5
+.LM599:
+	ret
+.Lfe92:
+	.size	 v4_cb_Less5,.Lfe92-v4_cb_Less5
+.stabn	192,0,0,.LBB92-v4_cb_Less5
+.stabn	224,0,0,.LBE92-v4_cb_Less5
+.Lscope92:
+.stabs	"",36,0,0,.Lscope92-v4_cb_Less5
+.text
+	.align 4
+.stabs "v4_cbwhile:F1",36,0,0,v4_cbwhile
+.globl v4_cbwhile
+	.type	v4_cbwhile,@function
+v4_cbwhile:
+.stabn 68,0,110,.LMa600-v4_cbwhile
+.LMa600:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,110,.LMb600-v4_cbwhile
+.LMb600:
+.LBB93:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS83
+	call v4__dscheck
+.LDS83:
+.L79:
+	mov %ecx,v4__dsindex
+	call v4_over
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS84
+	call v4__dscheck
+.LDS84:
+	test %eax,%eax
+	jle .L80
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS85
+	call v4__dscheck
+.LDS85:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS86
+	call v4__dscheck
+.LDS86:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	dec %eax
+	cmp $4080,%ecx
+	jbe .LDS87
+	call v4__dscheck
+.LDS87:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS88
+	call v4__dscheck
+.LDS88:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L79
+.L80:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_nip
+.LBE93:
+.stabn 68,0,110,.LM624-v4_cbwhile
+.LM624:
+	pop %ebx
+	leave
+	ret
+.Lfe93:
+	.size	 v4_cbwhile,.Lfe93-v4_cbwhile
+.stabn	192,0,0,.LBB93-v4_cbwhile
+.stabn	224,0,0,.LBE93-v4_cbwhile
+.Lscope93:
+.stabs	"",36,0,0,.Lscope93-v4_cbwhile
+.text
+	.align 4
+.stabs "v4_cbuntil:F1",36,0,0,v4_cbuntil
+.globl v4_cbuntil
+	.type	v4_cbuntil,@function
+v4_cbuntil:
+.stabn 68,0,111,.LMa625-v4_cbuntil
+.LMa625:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,111,.LMb625-v4_cbuntil
+.LMb625:
+.LBB95:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS89
+	call v4__dscheck
+.LDS89:
+.L82:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS90
+	call v4__dscheck
+.LDS90:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS91
+	call v4__dscheck
+.LDS91:
+	mov %ecx,v4__dsindex
+	call v4_z2dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS92
+	call v4__dscheck
+.LDS92:
+	cmp %edx,%eax
+	jne .L82
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_nip
+.LBE95:
+.stabn 68,0,111,.LM643-v4_cbuntil
+.LM643:
+	pop %ebx
+	leave
+	ret
+.Lfe95:
+	.size	 v4_cbuntil,.Lfe95-v4_cbuntil
+.stabn	192,0,0,.LBB95-v4_cbuntil
+.stabn	224,0,0,.LBE95-v4_cbuntil
+.Lscope95:
+.stabs	"",36,0,0,.Lscope95-v4_cbuntil
+.text
+	.align 4
+.stabs "v4_cbflag:F1",36,0,0,v4_cbflag
+.globl v4_cbflag
+	.type	v4_cbflag,@function
+v4_cbflag:
+.stabn 68,0,112,.LMa644-v4_cbflag
+.LMa644:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,112,.LMb644-v4_cbflag
+.LMb644:
+.LBB96:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	cmp $4080,%ecx
+	jbe .LDS93
+	call v4__dscheck
+.LDS93:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS94
+	call v4__dscheck
+.LDS94:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS95
+	call v4__dscheck
+.LDS95:
+	test %eax,%eax
+	je .L85
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov (v4_Lesstrue_Greater),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS96
+	call v4__dscheck
+.LDS96:
+.L85:
+	mov %ecx,v4__dsindex
+.LBE96:
+.stabn 68,0,112,.LM658-v4_cbflag
+.LM658:
+	pop %ebx
+	leave
+	ret
+.Lfe96:
+	.size	 v4_cbflag,.Lfe96-v4_cbflag
+.stabn	192,0,0,.LBB96-v4_cbflag
+.stabn	224,0,0,.LBE96-v4_cbflag
+.Lscope96:
+.stabs	"",36,0,0,.Lscope96-v4_cbflag
+.text
+	.align 4
+.stabs "v4_dense:F1",36,0,0,v4_dense
+.globl v4_dense
+	.type	v4_dense,@function
+v4_dense:
+.stabn 68,0,154,.LMa659-v4_dense
+.LMa659:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,154,.LMb659-v4_dense
+.LMb659:
+.LBB97:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS97
+	call v4__dscheck
+.LDS97:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS98
+	call v4__dscheck
+.LDS98:
+	cmp $5,%eax
+	ja .L93
+	mov .LT93(,%eax,4),%eax
+	jmp *%eax
+.section	.rodata
+	.align 4
+.LT93:
+	.long .L361
+	.long .L362
+	.long .L363
+	.long .L364
+	.long .L365
+	.long .L366
+.text
+.L361:
+	mov $10,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS99
+	call v4__dscheck
+.LDS99:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L87
+.L88:
+.L362:
+	mov $11,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS100
+	call v4__dscheck
+.LDS100:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L87
+.L89:
+.L363:
+	mov $12,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS101
+	call v4__dscheck
+.LDS101:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L87
+.L90:
+.L364:
+	mov $13,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS102
+	call v4__dscheck
+.LDS102:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L87
+.L91:
+.L365:
+	mov $14,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS103
+	call v4__dscheck
+.LDS103:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L87
+.L92:
+.L366:
+	mov $15,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS104
+	call v4__dscheck
+.LDS104:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L87
+.L93:
+.stabn 68,0,158,.LM727-v4_dense
+.LM727:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS105
+	call v4__dscheck
+.LDS105:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS106
+	call v4__dscheck
+.LDS106:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+.L87:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS107
+	call v4__dscheck
+.LDS107:
+	mov %ecx,v4__dsindex
+.LBE97:
+.stabn 68,0,159,.LM739-v4_dense
+.LM739:
+	pop %ebx
+	leave
+	ret
+.Lfe97:
+	.size	 v4_dense,.Lfe97-v4_dense
+.stabn	192,0,0,.LBB97-v4_dense
+.stabn	224,0,0,.LBE97-v4_dense
+.Lscope97:
+.stabs	"",36,0,0,.Lscope97-v4_dense
+.text
+	.align 4
+.stabs "v4_gapped:F1",36,0,0,v4_gapped
+.globl v4_gapped
+	.type	v4_gapped,@function
+v4_gapped:
+.stabn 68,0,160,.LMa740-v4_gapped
+.LMa740:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,160,.LMb740-v4_gapped
+.LMb740:
+.LBB98:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS108
+	call v4__dscheck
+.LDS108:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS109
+	call v4__dscheck
+.LDS109:
+	sub $-2,%eax
+	cmp $5,%eax
+	ja .L100
+	mov .LT100(,%eax,4),%eax
+	jmp *%eax
+.section	.rodata
+	.align 4
+.LT100:
+	.long .L367
+	.long .L368
+	.long .L369
+	.long .L100
+	.long .L370
+	.long .L371
+.text
+.L367:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS110
+	call v4__dscheck
+.LDS110:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L95
+.L96:
+.L368:
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS111
+	call v4__dscheck
+.LDS111:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L95
+.L97:
+.L369:
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS112
+	call v4__dscheck
+.LDS112:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L95
+.L98:
+.L370:
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS113
+	call v4__dscheck
+.LDS113:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L95
+.L99:
+.L371:
+	mov $5,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS114
+	call v4__dscheck
+.LDS114:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L95
+.L100:
+.stabn 68,0,164,.LM797-v4_gapped
+.LM797:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS115
+	call v4__dscheck
+.LDS115:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+.L95:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS116
+	call v4__dscheck
+.LDS116:
+	mov %ecx,v4__dsindex
+.LBE98:
+.stabn 68,0,165,.LM803-v4_gapped
+.LM803:
+	pop %ebx
+	leave
+	ret
+.Lfe98:
+	.size	 v4_gapped,.Lfe98-v4_gapped
+.stabn	192,0,0,.LBB98-v4_gapped
+.stabn	224,0,0,.LBE98-v4_gapped
+.Lscope98:
+.stabs	"",36,0,0,.Lscope98-v4_gapped
+.text
+	.align 4
+.stabs "v4_sparse:F1",36,0,0,v4_sparse
+.globl v4_sparse
+	.type	v4_sparse,@function
+v4_sparse:
+.stabn 68,0,166,.LMa804-v4_sparse
+.LMa804:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,166,.LMb804-v4_sparse
+.LMb804:
+.LBB99:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS117
+	call v4__dscheck
+.LDS117:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $100,%edx
+	cmp $4080,%ecx
+	jbe .LDS118
+	call v4__dscheck
+.LDS118:
+	cmp %edx,%eax
+	jl .L378
+	mov $100,%edx
+	cmp %edx,%eax
+	je .L375
+	mov $1000,%edx
+	cmp %edx,%eax
+	je .L376
+	mov $65536,%edx
+	cmp %edx,%eax
+	je .L377
+	jmp .L108
+.L378:
+	mov $-1000,%edx
+	cmp %edx,%eax
+	je .L372
+	xor %edx,%edx
+	dec %edx
+	cmp %edx,%eax
+	je .L373
+	mov $7,%edx
+	cmp %edx,%eax
+	je .L374
+	jmp .L108
+.L372:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS119
+	call v4__dscheck
+.LDS119:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L102
+.L103:
+.L373:
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS120
+	call v4__dscheck
+.LDS120:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L102
+.L104:
+.L374:
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS121
+	call v4__dscheck
+.LDS121:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L102
+.L105:
+.L375:
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS122
+	call v4__dscheck
+.LDS122:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L102
+.L106:
+.L376:
+	mov $5,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS123
+	call v4__dscheck
+.LDS123:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L102
+.L107:
+.L377:
+	mov $6,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS124
+	call v4__dscheck
+.LDS124:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L102
+.L108:
+.stabn 68,0,170,.LM888-v4_sparse
+.LM888:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS125
+	call v4__dscheck
+.LDS125:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+.L102:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS126
+	call v4__dscheck
+.LDS126:
+	mov %ecx,v4__dsindex
+.LBE99:
+.stabn 68,0,171,.LM894-v4_sparse
+.LM894:
+	pop %ebx
+	leave
+	ret
+.Lfe99:
+	.size	 v4_sparse,.Lfe99-v4_sparse
+.stabn	192,0,0,.LBB99-v4_sparse
+.stabn	224,0,0,.LBE99-v4_sparse
+.Lscope99:
+.stabs	"",36,0,0,.Lscope99-v4_sparse
+.text
+	.align 4
+.stabs "v4_nodefault:F1",36,0,0,v4_nodefault
+.globl v4_nodefault
+	.type	v4_nodefault,@function
+v4_nodefault:
+.stabn 68,0,172,.LMa895-v4_nodefault
+.LMa895:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,172,.LMb895-v4_nodefault
+.LMb895:
+.LBB100:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS127
+	call v4__dscheck
+.LDS127:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS128
+	call v4__dscheck
+.LDS128:
+	sub $1,%eax
+	cmp $3,%eax
+	ja .L114
+	mov .LT114(,%eax,4),%eax
+	jmp *%eax
+.section	.rodata
+	.align 4
+.LT114:
+	.long .L379
+	.long .L380
+	.long .L381
+	.long .L382
+.text
+.L379:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS129
+	call v4__dscheck
+.LDS129:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L110
+.L111:
+.L380:
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS130
+	call v4__dscheck
+.LDS130:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L110
+.L112:
+.L381:
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS131
+	call v4__dscheck
+.LDS131:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L110
+.L113:
+.L382:
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS132
+	call v4__dscheck
+.LDS132:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+.L114:
+.L110:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS133
+	call v4__dscheck
+.LDS133:
+	mov %ecx,v4__dsindex
+.LBE100:
+.stabn 68,0,176,.LM944-v4_nodefault
+.LM944:
+	pop %ebx
+	leave
+	ret
+.Lfe100:
+	.size	 v4_nodefault,.Lfe100-v4_nodefault
+.stabn	192,0,0,.LBB100-v4_nodefault
+.stabn	224,0,0,.LBE100-v4_nodefault
+.Lscope100:
+.stabs	"",36,0,0,.Lscope100-v4_nodefault
+.text
+	.align 4
+.stabs "v4_Slash1:F1",36,0,0,v4_Slash1
+.globl v4_Slash1
+	.type	v4_Slash1,@function
+v4_Slash1:
+.stabn 68,0,211,.LMa945-v4_Slash1
+.LMa945:
+.stabn 68,0,211,.LMb945-v4_Slash1
+.LMb945:
+.LBB101:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS134
+	call v4__dscheck
+.LDS134:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS135
+	call v4__dscheck
+.LDS135:
+	mov %ecx,v4__dsindex
+.LBE101:
+.stabn 68,0,211,.LM953-v4_Slash1
+.LM953:
+	ret
+.Lfe101:
+	.size	 v4_Slash1,.Lfe101-v4_Slash1
+.stabn	192,0,0,.LBB101-v4_Slash1
+.stabn	224,0,0,.LBE101-v4_Slash1
+.Lscope101:
+.stabs	"",36,0,0,.Lscope101-v4_Slash1
+.text
+	.align 4
+.stabs "v4_mod1:F1",36,0,0,v4_mod1
+.globl v4_mod1
+	.type	v4_mod1,@function
+v4_mod1:
+.stabn 68,0,211,.LMa954-v4_mod1
+.LMa954:
+.stabn 68,0,211,.LMb954-v4_mod1
+.LMb954:
+.LBB103:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	xor %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS136
+	call v4__dscheck
+.LDS136:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS137
+	call v4__dscheck
+.LDS137:
+	mov %ecx,v4__dsindex
+.LBE103:
+.stabn 68,0,211,.LM962-v4_mod1
+.LM962:
+	ret
+.Lfe103:
+	.size	 v4_mod1,.Lfe103-v4_mod1
+.stabn	192,0,0,.LBB103-v4_mod1
+.stabn	224,0,0,.LBE103-v4_mod1
+.Lscope103:
+.stabs	"",36,0,0,.Lscope103-v4_mod1
+.text
+	.align 4
+.stabs "v4_Slash2:F1",36,0,0,v4_Slash2
+.globl v4_Slash2
+	.type	v4_Slash2,@function
+v4_Slash2:
+.stabn 68,0,212,.LMa963-v4_Slash2
+.LMa963:
+.stabn 68,0,212,.LMb963-v4_Slash2
+.LMb963:
+.LBB105:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $31,%edx
+	add %edx,%eax
+	sar $1,%eax
+	cmp $4080,%ecx
+	jbe .LDS138
+	call v4__dscheck
+.LDS138:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS139
+	call v4__dscheck
+.LDS139:
+	mov %ecx,v4__dsindex
+.LBE105:
+.stabn 68,0,212,.LM971-v4_Slash2
+.LM971:
+	ret
+.Lfe105:
+	.size	 v4_Slash2,.Lfe105-v4_Slash2
+.stabn	192,0,0,.LBB105-v4_Slash2
+.stabn	224,0,0,.LBE105-v4_Slash2
+.Lscope105:
+.stabs	"",36,0,0,.Lscope105-v4_Slash2
+.text
+	.align 4
+.stabs "v4_mod2:F1",36,0,0,v4_mod2
+.globl v4_mod2
+	.type	v4_mod2,@function
+v4_mod2:
+.stabn 68,0,212,.LMa972-v4_mod2
+.LMa972:
+.stabn 68,0,212,.LMb972-v4_mod2
+.LMb972:
+.LBB106:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $31,%edx
+	add %edx,%eax
+	and $1,%eax
+	sub %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS140
+	call v4__dscheck
+.LDS140:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS141
+	call v4__dscheck
+.LDS141:
+	mov %ecx,v4__dsindex
+.LBE106:
+.stabn 68,0,212,.LM980-v4_mod2
+.LM980:
+	ret
+.Lfe106:
+	.size	 v4_mod2,.Lfe106-v4_mod2
+.stabn	192,0,0,.LBB106-v4_mod2
+.stabn	224,0,0,.LBE106-v4_mod2
+.Lscope106:
+.stabs	"",36,0,0,.Lscope106-v4_mod2
+.text
+	.align 4
+.stabs "v4_Slash3:F1",36,0,0,v4_Slash3
+.globl v4_Slash3
+	.type	v4_Slash3,@function
+v4_Slash3:
+.stabn 68,0,213,.LMa981-v4_Slash3
+.LMa981:
+.stabn 68,0,213,.LMb981-v4_Slash3
+.LMb981:
+.LBB107:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	cmp $4080,%ecx
+	jbe .LDS142
+	call v4__dscheck
+.LDS142:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS143
+	call v4__dscheck
+.LDS143:
+	mov %ecx,v4__dsindex
+.LBE107:
+.stabn 68,0,213,.LM989-v4_Slash3
+.LM989:
+	ret
+.Lfe107:
+	.size	 v4_Slash3,.Lfe107-v4_Slash3
+.stabn	192,0,0,.LBB107-v4_Slash3
+.stabn	224,0,0,.LBE107-v4_Slash3
+.Lscope107:
+.stabs	"",36,0,0,.Lscope107-v4_Slash3
+.text
+	.align 4
+.stabs "v4_mod3:F1",36,0,0,v4_mod3
+.globl v4_mod3
+	.type	v4_mod3,@function
+v4_mod3:
+.stabn 68,0,213,.LMa990-v4_mod3
+.LMa990:
+.stabn 68,0,213,.LMb990-v4_mod3
+.LMb990:
+.LBB108:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $3,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS144
+	call v4__dscheck
+.LDS144:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS145
+	call v4__dscheck
+.LDS145:
+	mov %ecx,v4__dsindex
+.LBE108:
+.stabn 68,0,213,.LM998-v4_mod3
+.LM998:
+	ret
+.Lfe108:
+	.size	 v4_mod3,.Lfe108-v4_mod3
+.stabn	192,0,0,.LBB108-v4_mod3
+.stabn	224,0,0,.LBE108-v4_mod3
+.Lscope108:
+.stabs	"",36,0,0,.Lscope108-v4_mod3
+.text
+	.align 4
+.stabs "v4_Slash_Minus3:F1",36,0,0,v4_Slash_Minus3
+.globl v4_Slash_Minus3
+	.type	v4_Slash_Minus3,@function
+v4_Slash_Minus3:
+.stabn 68,0,214,.LMa999-v4_Slash_Minus3
+.LMa999:
+.stabn 68,0,214,.LMb999-v4_Slash_Minus3
+.LMb999:
+.LBB109:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	neg %eax
+	cmp $4080,%ecx
+	jbe .LDS146
+	call v4__dscheck
+.LDS146:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS147
+	call v4__dscheck
+.LDS147:
+	mov %ecx,v4__dsindex
+.LBE109:
+.stabn 68,0,214,.LM1007-v4_Slash_Minus3
+.LM1007:
+	ret
+.Lfe109:
+	.size	 v4_Slash_Minus3,.Lfe109-v4_Slash_Minus3
+.stabn	192,0,0,.LBB109-v4_Slash_Minus3
+.stabn	224,0,0,.LBE109-v4_Slash_Minus3
+.Lscope109:
+.stabs	"",36,0,0,.Lscope109-v4_Slash_Minus3
+.text
+	.align 4
+.stabs "v4_mod_Minus3:F1",36,0,0,v4_mod_Minus3
+.globl v4_mod_Minus3
+	.type	v4_mod_Minus3,@function
+v4_mod_Minus3:
+.stabn 68,0,214,.LMa1008-v4_mod_Minus3
+.LMa1008:
+.stabn 68,0,214,.LMb1008-v4_mod_Minus3
+.LMb1008:
+.LBB110:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $3,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS148
+	call v4__dscheck
+.LDS148:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS149
+	call v4__dscheck
+.LDS149:
+	mov %ecx,v4__dsindex
+.LBE110:
+.stabn 68,0,214,.LM1016-v4_mod_Minus3
+.LM1016:
+	ret
+.Lfe110:
+	.size	 v4_mod_Minus3,.Lfe110-v4_mod_Minus3
+.stabn	192,0,0,.LBB110-v4_mod_Minus3
+.stabn	224,0,0,.LBE110-v4_mod_Minus3
+.Lscope110:
+.stabs	"",36,0,0,.Lscope110-v4_mod_Minus3
+.text
+	.align 4
+.stabs "v4_Slash7:F1",36,0,0,v4_Slash7
+.globl v4_Slash7
+	.type	v4_Slash7,@function
+v4_Slash7:
+.stabn 68,0,215,.LMa1017-v4_Slash7
+.LMa1017:
+.stabn 68,0,215,.LMb1017-v4_Slash7
+.LMb1017:
+.LBB111:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	push %eax
+	mov $-1840700269,%edx
+	imul %edx
+	add (%esp),%edx
+	sar $2,%edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	cmp $4080,%ecx
+	jbe .LDS150
+	call v4__dscheck
+.LDS150:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS151
+	call v4__dscheck
+.LDS151:
+	mov %ecx,v4__dsindex
+.LBE111:
+.stabn 68,0,215,.LM1025-v4_Slash7
+.LM1025:
+	ret
+.Lfe111:
+	.size	 v4_Slash7,.Lfe111-v4_Slash7
+.stabn	192,0,0,.LBB111-v4_Slash7
+.stabn	224,0,0,.LBE111-v4_Slash7
+.Lscope111:
+.stabs	"",36,0,0,.Lscope111-v4_Slash7
+.text
+	.align 4
+.stabs "v4_mod7:F1",36,0,0,v4_mod7
+.globl v4_mod7
+	.type	v4_mod7,@function
+v4_mod7:
+.stabn 68,0,215,.LMa1026-v4_mod7
+.LMa1026:
+.stabn 68,0,215,.LMb1026-v4_mod7
+.LMb1026:
+.LBB112:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	push %eax
+	mov $-1840700269,%edx
+	imul %edx
+	add (%esp),%edx
+	sar $2,%edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $7,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS152
+	call v4__dscheck
+.LDS152:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS153
+	call v4__dscheck
+.LDS153:
+	mov %ecx,v4__dsindex
+.LBE112:
+.stabn 68,0,215,.LM1034-v4_mod7
+.LM1034:
+	ret
+.Lfe112:
+	.size	 v4_mod7,.Lfe112-v4_mod7
+.stabn	192,0,0,.LBB112-v4_mod7
+.stabn	224,0,0,.LBE112-v4_mod7
+.Lscope112:
+.stabs	"",36,0,0,.Lscope112-v4_mod7
+.text
+	.align 4
+.stabs "v4_Slash8:F1",36,0,0,v4_Slash8
+.globl v4_Slash8
+	.type	v4_Slash8,@function
+v4_Slash8:
+.stabn 68,0,216,.LMa1035-v4_Slash8
+.LMa1035:
+.stabn 68,0,216,.LMb1035-v4_Slash8
+.LMb1035:
+.LBB113:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $29,%edx
+	add %edx,%eax
+	sar $3,%eax
+	cmp $4080,%ecx
+	jbe .LDS154
+	call v4__dscheck
+.LDS154:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS155
+	call v4__dscheck
+.LDS155:
+	mov %ecx,v4__dsindex
+.LBE113:
+.stabn 68,0,216,.LM1043-v4_Slash8
+.LM1043:
+	ret
+.Lfe113:
+	.size	 v4_Slash8,.Lfe113-v4_Slash8
+.stabn	192,0,0,.LBB113-v4_Slash8
+.stabn	224,0,0,.LBE113-v4_Slash8
+.Lscope113:
+.stabs	"",36,0,0,.Lscope113-v4_Slash8
+.text
+	.align 4
+.stabs "v4_mod8:F1",36,0,0,v4_mod8
+.globl v4_mod8
+	.type	v4_mod8,@function
+v4_mod8:
+.stabn 68,0,216,.LMa1044-v4_mod8
+.LMa1044:
+.stabn 68,0,216,.LMb1044-v4_mod8
+.LMb1044:
+.LBB114:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $29,%edx
+	add %edx,%eax
+	and $7,%eax
+	sub %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS156
+	call v4__dscheck
+.LDS156:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS157
+	call v4__dscheck
+.LDS157:
+	mov %ecx,v4__dsindex
+.LBE114:
+.stabn 68,0,216,.LM1052-v4_mod8
+.LM1052:
+	ret
+.Lfe114:
+	.size	 v4_mod8,.Lfe114-v4_mod8
+.stabn	192,0,0,.LBB114-v4_mod8
+.stabn	224,0,0,.LBE114-v4_mod8
+.Lscope114:
+.stabs	"",36,0,0,.Lscope114-v4_mod8
+.text
+	.align 4
+.stabs "v4_Slash_Minus8:F1",36,0,0,v4_Slash_Minus8
+.globl v4_Slash_Minus8
+	.type	v4_Slash_Minus8,@function
+v4_Slash_Minus8:
+.stabn 68,0,217,.LMa1053-v4_Slash_Minus8
+.LMa1053:
+.stabn 68,0,217,.LMb1053-v4_Slash_Minus8
+.LMb1053:
+.LBB115:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $29,%edx
+	add %edx,%eax
+	sar $3,%eax
+	neg %eax
+	cmp $4080,%ecx
+	jbe .LDS158
+	call v4__dscheck
+.LDS158:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS159
+	call v4__dscheck
+.LDS159:
+	mov %ecx,v4__dsindex
+.LBE115:
+.stabn 68,0,217,.LM1061-v4_Slash_Minus8
+.LM1061:
+	ret
+.Lfe115:
+	.size	 v4_Slash_Minus8,.Lfe115-v4_Slash_Minus8
+.stabn	192,0,0,.LBB115-v4_Slash_Minus8
+.stabn	224,0,0,.LBE115-v4_Slash_Minus8
+.Lscope115:
+.stabs	"",36,0,0,.Lscope115-v4_Slash_Minus8
+.text
+	.align 4
+.stabs "v4_mod_Minus8:F1",36,0,0,v4_mod_Minus8
+.globl v4_mod_Minus8
+	.type	v4_mod_Minus8,@function
+v4_mod_Minus8:
+.stabn 68,0,217,.LMa1062-v4_mod_Minus8
+.LMa1062:
+.stabn 68,0,217,.LMb1062-v4_mod_Minus8
+.LMb1062:
+.LBB116:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $29,%edx
+	add %edx,%eax
+	and $7,%eax
+	sub %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS160
+	call v4__dscheck
+.LDS160:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS161
+	call v4__dscheck
+.LDS161:
+	mov %ecx,v4__dsindex
+.LBE116:
+.stabn 68,0,217,.LM1070-v4_mod_Minus8
+.LM1070:
+	ret
+.Lfe116:
+	.size	 v4_mod_Minus8,.Lfe116-v4_mod_Minus8
+.stabn	192,0,0,.LBB116-v4_mod_Minus8
+.stabn	224,0,0,.LBE116-v4_mod_Minus8
+.Lscope116:
+.stabs	"",36,0,0,.Lscope116-v4_mod_Minus8
+.text
+	.align 4
+.stabs "v4_Slash10:F1",36,0,0,v4_Slash10
+.globl v4_Slash10
+	.type	v4_Slash10,@function
+v4_Slash10:
+.stabn 68,0,218,.LMa1071-v4_Slash10
+.LMa1071:
+.stabn 68,0,218,.LMb1071-v4_Slash10
+.LMb1071:
+.LBB117:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	push %eax
+	mov $1717986919,%edx
+	imul %edx
+	sar $2,%edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	cmp $4080,%ecx
+	jbe .LDS162
+	call v4__dscheck
+.LDS162:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS163
+	call v4__dscheck
+.LDS163:
+	mov %ecx,v4__dsindex
+.LBE117:
+.stabn 68,0,218,.LM1079-v4_Slash10
+.LM1079:
+	ret
+.Lfe117:
+	.size	 v4_Slash10,.Lfe117-v4_Slash10
+.stabn	192,0,0,.LBB117-v4_Slash10
+.stabn	224,0,0,.LBE117-v4_Slash10
+.Lscope117:
+.stabs	"",36,0,0,.Lscope117-v4_Slash10
+.text
+	.align 4
+.stabs "v4_mod10:F1",36,0,0,v4_mod10
+.globl v4_mod10
+	.type	v4_mod10,@function
+v4_mod10:
+.stabn 68,0,218,.LMa1080-v4_mod10
+.LMa1080:
+.stabn 68,0,218,.LMb1080-v4_mod10
+.LMb1080:
+.LBB118:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	push %eax
+	mov $1717986919,%edx
+	imul %edx
+	sar $2,%edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $10,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS164
+	call v4__dscheck
+.LDS164:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS165
+	call v4__dscheck
+.LDS165:
+	mov %ecx,v4__dsindex
+.LBE118:
+.stabn 68,0,218,.LM1088-v4_mod10
+.LM1088:
+	ret
+.Lfe118:
+	.size	 v4_mod10,.Lfe118-v4_mod10
+.stabn	192,0,0,.LBB118-v4_mod10
+.stabn	224,0,0,.LBE118-v4_mod10
+.Lscope118:
+.stabs	"",36,0,0,.Lscope118-v4_mod10
+.text
+	.align 4
+.stabs "v4_Slash_Minus10:F1",36,0,0,v4_Slash_Minus10
+.globl v4_Slash_Minus10
+	.type	v4_Slash_Minus10,@function
+v4_Slash_Minus10:
+.stabn 68,0,219,.LMa1089-v4_Slash_Minus10
+.LMa1089:
+.stabn 68,0,219,.LMb1089-v4_Slash_Minus10
+.LMb1089:
+.LBB119:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	push %eax
+	mov $1717986919,%edx
+	imul %edx
+	sar $2,%edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	neg %eax
+	cmp $4080,%ecx
+	jbe .LDS166
+	call v4__dscheck
+.LDS166:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS167
+	call v4__dscheck
+.LDS167:
+	mov %ecx,v4__dsindex
+.LBE119:
+.stabn 68,0,219,.LM1097-v4_Slash_Minus10
+.LM1097:
+	ret
+.Lfe119:
+	.size	 v4_Slash_Minus10,.Lfe119-v4_Slash_Minus10
+.stabn	192,0,0,.LBB119-v4_Slash_Minus10
+.stabn	224,0,0,.LBE119-v4_Slash_Minus10
+.Lscope119:
+.stabs	"",36,0,0,.Lscope119-v4_Slash_Minus10
+.text
+	.align 4
+.stabs "v4_mod_Minus10:F1",36,0,0,v4_mod_Minus10
+.globl v4_mod_Minus10
+	.type	v4_mod_Minus10,@function
+v4_mod_Minus10:
+.stabn 68,0,219,.LMa1098-v4_mod_Minus10
+.LMa1098:
+.stabn 68,0,219,.LMb1098-v4_mod_Minus10
+.LMb1098:
+.LBB120:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	push %eax
+	mov $1717986919,%edx
+	imul %edx
+	sar $2,%edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $10,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS168
+	call v4__dscheck
+.LDS168:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS169
+	call v4__dscheck
+.LDS169:
+	mov %ecx,v4__dsindex
+.LBE120:
+.stabn 68,0,219,.LM1106-v4_mod_Minus10
+.LM1106:
+	ret
+.Lfe120:
+	.size	 v4_mod_Minus10,.Lfe120-v4_mod_Minus10
+.stabn	192,0,0,.LBB120-v4_mod_Minus10
+.stabn	224,0,0,.LBE120-v4_mod_Minus10
+.Lscope120:
+.stabs	"",36,0,0,.Lscope120-v4_mod_Minus10
+.text
+	.align 4
+.stabs "v4_Slash_Minus1:F1",36,0,0,v4_Slash_Minus1
+.globl v4_Slash_Minus1
+	.type	v4_Slash_Minus1,@function
+v4_Slash_Minus1:
+.stabn 68,0,220,.LMa1107-v4_Slash_Minus1
+.LMa1107:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,220,.LMb1107-v4_Slash_Minus1
+.LMb1107:
+.LBB121:
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS170
+	call v4__dscheck
+.LDS170:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_Slash
+.LBE121:
+.stabn 68,0,220,.LM1112-v4_Slash_Minus1
+.LM1112:
+	pop %ebx
+	leave
+	ret
+.Lfe121:
+	.size	 v4_Slash_Minus1,.Lfe121-v4_Slash_Minus1
+.stabn	192,0,0,.LBB121-v4_Slash_Minus1
+.stabn	224,0,0,.LBE121-v4_Slash_Minus1
+.Lscope121:
+.stabs	"",36,0,0,.Lscope121-v4_Slash_Minus1
+.text
+	.align 4
+.stabs "v4_mod_Minus1:F1",36,0,0,v4_mod_Minus1
+.globl v4_mod_Minus1
+	.type	v4_mod_Minus1,@function
+v4_mod_Minus1:
+.stabn 68,0,220,.LMa1113-v4_mod_Minus1
+.LMa1113:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,220,.LMb1113-v4_mod_Minus1
+.LMb1113:
+.LBB122:
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS171
+	call v4__dscheck
+.LDS171:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_mod
+.LBE122:
+.stabn 68,0,220,.LM1118-v4_mod_Minus1
+.LM1118:
+	pop %ebx
+	leave
+	ret
+.Lfe122:
+	.size	 v4_mod_Minus1,.Lfe122-v4_mod_Minus1
+.stabn	192,0,0,.LBB122-v4_mod_Minus1
+.stabn	224,0,0,.LBE122-v4_mod_Minus1
+.Lscope122:
+.stabs	"",36,0,0,.Lscope122-v4_mod_Minus1
+.text
+	.align 4
+.stabs "v4_Star0:F1",36,0,0,v4_Star0
+.globl v4_Star0
+	.type	v4_Star0,@function
+v4_Star0:
+.stabn 68,0,221,.LMa1119-v4_Star0
+.LMa1119:
+.stabn 68,0,221,.LMb1119-v4_Star0
+.LMb1119:
+.LBB123:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	xor %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS172
+	call v4__dscheck
+.LDS172:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS173
+	call v4__dscheck
+.LDS173:
+	mov %ecx,v4__dsindex
+.LBE123:
+.stabn 68,0,221,.LM1127-v4_Star0
+.LM1127:
+	ret
+.Lfe123:
+	.size	 v4_Star0,.Lfe123-v4_Star0
+.stabn	192,0,0,.LBB123-v4_Star0
+.stabn	224,0,0,.LBE123-v4_Star0
+.Lscope123:
+.stabs	"",36,0,0,.Lscope123-v4_Star0
+.text
+	.align 4
+.stabs "v4_Star1:F1",36,0,0,v4_Star1
+.globl v4_Star1
+	.type	v4_Star1,@function
+v4_Star1:
+.stabn 68,0,221,.LMa1128-v4_Star1
+.LMa1128:
+.stabn 68,0,221,.LMb1128-v4_Star1
+.LMb1128:
+.LBB124:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS174
+	call v4__dscheck
+.LDS174:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS175
+	call v4__dscheck
+.LDS175:
+	mov %ecx,v4__dsindex
+.LBE124:
+.stabn 68,0,221,.LM1136-v4_Star1
+.LM1136:
+	ret
+.Lfe124:
+	.size	 v4_Star1,.Lfe124-v4_Star1
+.stabn	192,0,0,.LBB124-v4_Star1
+.stabn	224,0,0,.LBE124-v4_Star1
+.Lscope124:
+.stabs	"",36,0,0,.Lscope124-v4_Star1
+.text
+	.align 4
+.stabs "v4_Star_Minus1:F1",36,0,0,v4_Star_Minus1
+.globl v4_Star_Minus1
+	.type	v4_Star_Minus1,@function
+v4_Star_Minus1:
+.stabn 68,0,221,.LMa1137-v4_Star_Minus1
+.LMa1137:
+.stabn 68,0,221,.LMb1137-v4_Star_Minus1
+.LMb1137:
+.LBB125:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	neg %eax
+	cmp $4080,%ecx
+	jbe .LDS176
+	call v4__dscheck
+.LDS176:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS177
+	call v4__dscheck
+.LDS177:
+	mov %ecx,v4__dsindex
+.LBE125:
+.stabn 68,0,221,.LM1145-v4_Star_Minus1
+.LM1145:
+	ret
+.Lfe125:
+	.size	 v4_Star_Minus1,.Lfe125-v4_Star_Minus1
+.stabn	192,0,0,.LBB125-v4_Star_Minus1
+.stabn	224,0,0,.LBE125-v4_Star_Minus1
+.Lscope125:
+.stabs	"",36,0,0,.Lscope125-v4_Star_Minus1
+.text
+	.align 4
+.stabs "v4_Star3:F1",36,0,0,v4_Star3
+.globl v4_Star3
+	.type	v4_Star3,@function
+v4_Star3:
+.stabn 68,0,221,.LMa1146-v4_Star3
+.LMa1146:
+.stabn 68,0,221,.LMb1146-v4_Star3
+.LMb1146:
+.LBB126:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	lea (%eax,%eax,2),%eax
+	cmp $4080,%ecx
+	jbe .LDS178
+	call v4__dscheck
+.LDS178:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS179
+	call v4__dscheck
+.LDS179:
+	mov %ecx,v4__dsindex
+.LBE126:
+.stabn 68,0,221,.LM1154-v4_Star3
+.LM1154:
+	ret
+.Lfe126:
+	.size	 v4_Star3,.Lfe126-v4_Star3
+.stabn	192,0,0,.LBB126-v4_Star3
+.stabn	224,0,0,.LBE126-v4_Star3
+.Lscope126:
+.stabs	"",36,0,0,.Lscope126-v4_Star3
+.text
+	.align 4
+.stabs "v4_Star8:F1",36,0,0,v4_Star8
+.globl v4_Star8
+	.type	v4_Star8,@function
+v4_Star8:
+.stabn 68,0,222,.LMa1155-v4_Star8
+.LMa1155:
+.stabn 68,0,222,.LMb1155-v4_Star8
+.LMb1155:
+.LBB127:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	shl $3,%eax
+	cmp $4080,%ecx
+	jbe .LDS180
+	call v4__dscheck
+.LDS180:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS181
+	call v4__dscheck
+.LDS181:
+	mov %ecx,v4__dsindex
+.LBE127:
+.stabn 68,0,222,.LM1163-v4_Star8
+.LM1163:
+	ret
+.Lfe127:
+	.size	 v4_Star8,.Lfe127-v4_Star8
+.stabn	192,0,0,.LBB127-v4_Star8
+.stabn	224,0,0,.LBE127-v4_Star8
+.Lscope127:
+.stabs	"",36,0,0,.Lscope127-v4_Star8
+.text
+	.align 4
+.stabs "v4_Star_Minus8:F1",36,0,0,v4_Star_Minus8
+.globl v4_Star_Minus8
+	.type	v4_Star_Minus8,@function
+v4_Star_Minus8:
+.stabn 68,0,222,.LMa1164-v4_Star_Minus8
+.LMa1164:
+.stabn 68,0,222,.LMb1164-v4_Star_Minus8
+.LMb1164:
+.LBB128:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	imul $-8,%eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS182
+	call v4__dscheck
+.LDS182:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS183
+	call v4__dscheck
+.LDS183:
+	mov %ecx,v4__dsindex
+.LBE128:
+.stabn 68,0,222,.LM1172-v4_Star_Minus8
+.LM1172:
+	ret
+.Lfe128:
+	.size	 v4_Star_Minus8,.Lfe128-v4_Star_Minus8
+.stabn	192,0,0,.LBB128-v4_Star_Minus8
+.stabn	224,0,0,.LBE128-v4_Star_Minus8
+.Lscope128:
+.stabs	"",36,0,0,.Lscope128-v4_Star_Minus8
+.text
+	.align 4
+.stabs "v4_Star10:F1",36,0,0,v4_Star10
+.globl v4_Star10
+	.type	v4_Star10,@function
+v4_Star10:
+.stabn 68,0,222,.LMa1173-v4_Star10
+.LMa1173:
+.stabn 68,0,222,.LMb1173-v4_Star10
+.LMb1173:
+.LBB129:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	lea (%eax,%eax,4),%eax
+	add %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS184
+	call v4__dscheck
+.LDS184:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS185
+	call v4__dscheck
+.LDS185:
+	mov %ecx,v4__dsindex
+.LBE129:
+.stabn 68,0,222,.LM1181-v4_Star10
+.LM1181:
+	ret
+.Lfe129:
+	.size	 v4_Star10,.Lfe129-v4_Star10
+.stabn	192,0,0,.LBB129-v4_Star10
+.stabn	224,0,0,.LBE129-v4_Star10
+.Lscope129:
+.stabs	"",36,0,0,.Lscope129-v4_Star10
+.text
+	.align 4
+.stabs "v4_Star_Minus7:F1",36,0,0,v4_Star_Minus7
+.globl v4_Star_Minus7
+	.type	v4_Star_Minus7,@function
+v4_Star_Minus7:
+.stabn 68,0,222,.LMa1182-v4_Star_Minus7
+.LMa1182:
+.stabn 68,0,222,.LMb1182-v4_Star_Minus7
+.LMb1182:
+.LBB130:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	imul $-7,%eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS186
+	call v4__dscheck
+.LDS186:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS187
+	call v4__dscheck
+.LDS187:
+	mov %ecx,v4__dsindex
+.LBE130:
+.stabn 68,0,222,.LM1190-v4_Star_Minus7
+.LM1190:
+	ret
+.Lfe130:
+	.size	 v4_Star_Minus7,.Lfe130-v4_Star_Minus7
+.stabn	192,0,0,.LBB130-v4_Star_Minus7
+.stabn	224,0,0,.LBE130-v4_Star_Minus7
+.Lscope130:
+.stabs	"",36,0,0,.Lscope130-v4_Star_Minus7
+.text
+	.align 4
+.stabs "v4_ncells:F1",36,0,0,v4_ncells
+.globl v4_ncells
+	.type	v4_ncells,@function
+v4_ncells:
+.stabn 68,0,223,.LMa1191-v4_ncells
+.LMa1191:
+.stabn 68,0,223,.LMb1191-v4_ncells
+.LMb1191:
+.LBB131:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	shl $2,%eax
+	cmp $4080,%ecx
+	jbe .LDS188
+	call v4__dscheck
+.LDS188:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS189
+	call v4__dscheck
+.LDS189:
+	mov %ecx,v4__dsindex
+.LBE131:
+.stabn 68,0,223,.LM1197-v4_ncells
+.LM1197:
+	ret
+.Lfe131:
+	.size	 v4_ncells,.Lfe131-v4_ncells
+.stabn	192,0,0,.LBB131-v4_ncells
+.stabn	224,0,0,.LBE131-v4_ncells
+.Lscope131:
+.stabs	"",36,0,0,.Lscope131-v4_ncells
+.text
+	.align 4
+.stabs "v4_dividend_Comma:F1",36,0,0,v4_dividend_Comma
+.globl v4_dividend_Comma
+	.type	v4_dividend_Comma,@function
+v4_dividend_Comma:
+.stabn 68,0,230,.LMa1198-v4_dividend_Comma
+.LMa1198:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+.stabn 68,0,230,.LMb1198-v4_dividend_Comma
+.LMb1198:
+.LBB134:
+	lea v4_dividends,%eax
+	mov %eax,%esi
+	mov (v4_Hashdividends),%eax
+	shl $2,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS190
+	call v4__dscheck
+.LDS190:
+	mov %ecx,v4__dsindex
+	call v4_Store
+	xor %eax,%eax
+	inc %eax
+	mov (v4_Hashdividends),%edx
+	add %edx,%eax
+	mov %eax,(v4_Hashdividends)
+.LBE134:
+.stabn 68,0,230,.LM1226-v4_dividend_Comma
+.LM1226:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe134:
+	.size	 v4_dividend_Comma,.Lfe134-v4_dividend_Comma
+.stabn	192,0,0,.LBB134-v4_dividend_Comma
+.stabn	224,0,0,.LBE134-v4_dividend_Comma
+.Lscope134:
+.stabs	"",36,0,0,.Lscope134-v4_dividend_Comma
+.text
+	.align 4
+.stabs "v4_dividend:F1",36,0,0,v4_dividend
+.globl v4_dividend
+	.type	v4_dividend,@function
+v4_dividend:
+.stabn 68,0,231,.LMa1227-v4_dividend
+.LMa1227:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+.stabn 68,0,231,.LMb1227-v4_dividend
+.LMb1227:
+.LBB136:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	shl $2,%eax
+	mov %eax,%esi
+	lea v4_dividends,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS191
+	call v4__dscheck
+.LDS191:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS192
+	call v4__dscheck
+.LDS192:
+	mov %ecx,v4__dsindex
+	pop %esi
+	pop %ebx
+	leave
+	jmp v4_Fetch
+.LBE136:
+.stabn 68,0,231,.LM1241-v4_dividend
+.LM1241:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe136:
+	.size	 v4_dividend,.Lfe136-v4_dividend
+.stabn	192,0,0,.LBB136-v4_dividend
+.stabn	224,0,0,.LBE136-v4_dividend
+.Lscope136:
+.stabs	"",36,0,0,.Lscope136-v4_dividend
+.text
+	.align 4
+.stabs "v4_mismatches:F1",36,0,0,v4_mismatches
+.globl v4_mismatches
+	.type	v4_mismatches,@function
+v4_mismatches:
+.stabn 68,0,232,.LMa1242-v4_mismatches
+.LMa1242:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+.stabn 68,0,232,.LMb1242-v4_mismatches
+.LMb1242:
+.LBB137:
+.stabn 68,0,233,.LM1243-v4_mismatches
+.LM1243:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov (v4_Hashdividends),%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS193
+	call v4__dscheck
+.LDS193:
+.L148:
+.stabn 68,0,234,.LM1257-v4_mismatches
+.LM1257:
+	mov %ecx,v4__dsindex
+	call v4_i
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	shl $2,%eax
+	mov %eax,%esi
+	lea v4_dividends,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS194
+	call v4__dscheck
+.LDS194:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS195
+	call v4__dscheck
+.LDS195:
+	mov %ecx,v4__dsindex
+	call v4_Fetch
+.stabn 68,0,234,.LM1271-v4_mismatches
+.LM1271:
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS196
+	call v4__dscheck
+.LDS196:
+	mov %ecx,v4__dsindex
+	call v4_pick
+	call v4_execute
+.stabn 68,0,235,.LM1275-v4_mismatches
+.LM1275:
+	call v4_i
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	shl $2,%eax
+	mov %eax,%esi
+	lea v4_dividends,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS197
+	call v4__dscheck
+.LDS197:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS198
+	call v4__dscheck
+.LDS198:
+	mov %ecx,v4__dsindex
+	call v4_Fetch
+.stabn 68,0,235,.LM1289-v4_mismatches
+.LM1289:
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS199
+	call v4__dscheck
+.LDS199:
+	mov %ecx,v4__dsindex
+	call v4_pick
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS200
+	call v4__dscheck
+.LDS200:
+	mov %ecx,v4__dsindex
+	call v4_pick
+	call v4_execute
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS201
+	call v4__dscheck
+.LDS201:
+	cmp %edx,%eax
+	je .L150
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS202
+	call v4__dscheck
+.LDS202:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS203
+	call v4__dscheck
+.LDS203:
+.L150:
+.stabn 68,0,237,.LM1307-v4_mismatches
+.LM1307:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L148
+	call v4__rpop
+	call v4__rpop
+	mov %ecx,v4__dsindex
+	call v4_nip
+	call v4_nip
+	pop %esi
+	pop %ebx
+	leave
+	jmp v4_nip
+.LBE137:
+.stabn 68,0,237,.LM1322-v4_mismatches
+.LM1322:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe137:
+	.size	 v4_mismatches,.Lfe137-v4_mismatches
+.stabn	192,0,0,.LBB137-v4_mismatches
+.stabn	224,0,0,.LBE137-v4_mismatches
+.Lscope137:
+.stabs	"",36,0,0,.Lscope137-v4_mismatches
+.text
+	.align 4
+.stabs "v4_use_Minushundred:F1",36,0,0,v4_use_Minushundred
+.globl v4_use_Minushundred
+	.type	v4_use_Minushundred,@function
+v4_use_Minushundred:
+.stabn 68,0,297,.LMa1323-v4_use_Minushundred
+.LMa1323:
+.stabn 68,0,297,.LMb1323-v4_use_Minushundred
+.LMb1323:
+.LBB144:
+	mov $200,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS204
+	call v4__dscheck
+.LDS204:
+	mov %ecx,v4__dsindex
+.LBE144:
+.stabn 68,0,297,.LM1328-v4_use_Minushundred
+.LM1328:
+	ret
+.Lfe144:
+	.size	 v4_use_Minushundred,.Lfe144-v4_use_Minushundred
+.stabn	192,0,0,.LBB144-v4_use_Minushundred
+.stabn	224,0,0,.LBE144-v4_use_Minushundred
+.Lscope144:
+.stabs	"",36,0,0,.Lscope144-v4_use_Minushundred
+.text
+	.align 4
+.stabs "v4_use_Minusminus_Minusone:F1",36,0,0,v4_use_Minusminus_Minusone
+.globl v4_use_Minusminus_Minusone
+	.type	v4_use_Minusminus_Minusone,@function
+v4_use_Minusminus_Minusone:
+.stabn 68,0,298,.LMa1329-v4_use_Minusminus_Minusone
+.LMa1329:
+.stabn 68,0,298,.LMb1329-v4_use_Minusminus_Minusone
+.LMb1329:
+.LBB145:
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS205
+	call v4__dscheck
+.LDS205:
+	mov %ecx,v4__dsindex
+.LBE145:
+.stabn 68,0,298,.LM1336-v4_use_Minusminus_Minusone
+.LM1336:
+	ret
+.Lfe145:
+	.size	 v4_use_Minusminus_Minusone,.Lfe145-v4_use_Minusminus_Minusone
+.stabn	192,0,0,.LBB145-v4_use_Minusminus_Minusone
+.stabn	224,0,0,.LBE145-v4_use_Minusminus_Minusone
+.Lscope145:
+.stabs	"",36,0,0,.Lscope145-v4_use_Minusminus_Minusone
+.text
+	.align 4
+.stabs "v4_use_Minusbiggest:F1",36,0,0,v4_use_Minusbiggest
+.globl v4_use_Minusbiggest
+	.type	v4_use_Minusbiggest,@function
+v4_use_Minusbiggest:
+.stabn 68,0,299,.LMa1337-v4_use_Minusbiggest
+.LMa1337:
+.stabn 68,0,299,.LMb1337-v4_use_Minusbiggest
+.LMb1337:
+.LBB146:
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS206
+	call v4__dscheck
+.LDS206:
+	mov %ecx,v4__dsindex
+.LBE146:
+.stabn 68,0,299,.LM1342-v4_use_Minusbiggest
+.LM1342:
+	ret
+.Lfe146:
+	.size	 v4_use_Minusbiggest,.Lfe146-v4_use_Minusbiggest
+.stabn	192,0,0,.LBB146-v4_use_Minusbiggest
+.stabn	224,0,0,.LBE146-v4_use_Minusbiggest
+.Lscope146:
+.stabs	"",36,0,0,.Lscope146-v4_use_Minusbiggest
+.text
+	.align 4
+.stabs "v4_use_Minusthree_Minushundred:F1",36,0,0,v4_use_Minusthree_Minushundred
+.globl v4_use_Minusthree_Minushundred
+	.type	v4_use_Minusthree_Minushundred,@function
+v4_use_Minusthree_Minushundred:
+.stabn 68,0,300,.LMa1343-v4_use_Minusthree_Minushundred
+.LMa1343:
+.stabn 68,0,300,.LMb1343-v4_use_Minusthree_Minushundred
+.LMb1343:
+.LBB147:
+	mov $301,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS207
+	call v4__dscheck
+.LDS207:
+	mov %ecx,v4__dsindex
+.LBE147:
+.stabn 68,0,300,.LM1348-v4_use_Minusthree_Minushundred
+.LM1348:
+	ret
+.Lfe147:
+	.size	 v4_use_Minusthree_Minushundred,.Lfe147-v4_use_Minusthree_Minushundred
+.stabn	192,0,0,.LBB147-v4_use_Minusthree_Minushundred
+.stabn	224,0,0,.LBE147-v4_use_Minusthree_Minushundred
+.Lscope147:
+.stabs	"",36,0,0,.Lscope147-v4_use_Minusthree_Minushundred
+.text
+	.align 4
+.stabs "v4_use_Minuszero:F1",36,0,0,v4_use_Minuszero
+.globl v4_use_Minuszero
+	.type	v4_use_Minuszero,@function
+v4_use_Minuszero:
+.stabn 68,0,301,.LMa1349-v4_use_Minuszero
+.LMa1349:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,301,.LMb1349-v4_use_Minuszero
+.LMb1349:
+.LBB148:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS208
+	call v4__dscheck
+.LDS208:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_Slash
+.LBE148:
+.stabn 68,0,301,.LM1354-v4_use_Minuszero
+.LM1354:
+	pop %ebx
+	leave
+	ret
+.Lfe148:
+	.size	 v4_use_Minuszero,.Lfe148-v4_use_Minuszero
+.stabn	192,0,0,.LBB148-v4_use_Minuszero
+.stabn	224,0,0,.LBE148-v4_use_Minuszero
+.Lscope148:
+.stabs	"",36,0,0,.Lscope148-v4_use_Minuszero
+.text
+	.align 4
+.stabs "v4_use_Minusin_Minuscase:F1",36,0,0,v4_use_Minusin_Minuscase
+.globl v4_use_Minusin_Minuscase
+	.type	v4_use_Minusin_Minuscase,@function
+v4_use_Minusin_Minuscase:
+.stabn 68,0,302,.LMa1355-v4_use_Minusin_Minuscase
+.LMa1355:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,302,.LMb1355-v4_use_Minusin_Minuscase
+.LMb1355:
+.LBB149:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS209
+	call v4__dscheck
+.LDS209:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $100,%edx
+	cmp $4080,%ecx
+	jbe .LDS210
+	call v4__dscheck
+.LDS210:
+	cmp %edx,%eax
+	jl .L387
+	mov $100,%edx
+	cmp %edx,%eax
+	je .L384
+	mov $2147483647,%edx
+	cmp %edx,%eax
+	je .L386
+	jmp .L161
+.L387:
+	xor %edx,%edx
+	dec %edx
+	cmp %edx,%eax
+	je .L385
+	xor %edx,%edx
+	cmp %edx,%eax
+	je .L383
+	jmp .L161
+.L383:
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS211
+	call v4__dscheck
+.LDS211:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L157
+.L158:
+.L384:
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS212
+	call v4__dscheck
+.LDS212:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L157
+.L159:
+.L385:
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS213
+	call v4__dscheck
+.LDS213:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L157
+.L160:
+.L386:
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS214
+	call v4__dscheck
+.LDS214:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L157
+.L161:
+.stabn 68,0,306,.LM1413-v4_use_Minusin_Minuscase
+.LM1413:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS215
+	call v4__dscheck
+.LDS215:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+.L157:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS216
+	call v4__dscheck
+.LDS216:
+	mov %ecx,v4__dsindex
+.LBE149:
+.stabn 68,0,307,.LM1419-v4_use_Minusin_Minuscase
+.LM1419:
+	pop %ebx
+	leave
+	ret
+.Lfe149:
+	.size	 v4_use_Minusin_Minuscase,.Lfe149-v4_use_Minusin_Minuscase
+.stabn	192,0,0,.LBB149-v4_use_Minusin_Minuscase
+.stabn	224,0,0,.LBE149-v4_use_Minusin_Minuscase
+.Lscope149:
+.stabs	"",36,0,0,.Lscope149-v4_use_Minusin_Minuscase
+.text
+	.align 4
+.stabs "v4_clamp:F1",36,0,0,v4_clamp
+.globl v4_clamp
+	.type	v4_clamp,@function
+v4_clamp:
+.stabn 68,0,324,.LMa1420-v4_clamp
+.LMa1420:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,324,.LMb1420-v4_clamp
+.LMb1420:
+.LBB151:
+.stabn 68,0,325,.LM1421-v4_clamp
+.LM1421:
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS217
+	call v4__dscheck
+.LDS217:
+	test %eax,%eax
+	jge .L163
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS218
+	call v4__dscheck
+.LDS218:
+	jmp .L162
+.L163:
+.stabn 68,0,326,.LM1432-v4_clamp
+.LM1432:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS219
+	call v4__dscheck
+.LDS219:
+	cmp %edx,%eax
+	jle .L164
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS220
+	call v4__dscheck
+.LDS220:
+.L164:
+.L162:
+	mov %ecx,v4__dsindex
+.LBE151:
+.stabn 68,0,326,.LM1447-v4_clamp
+.LM1447:
+	pop %ebx
+	leave
+	ret
+.Lfe151:
+	.size	 v4_clamp,.Lfe151-v4_clamp
+.stabn	192,0,0,.LBB151-v4_clamp
+.stabn	224,0,0,.LBE151-v4_clamp
+.Lscope151:
+.stabs	"",36,0,0,.Lscope151-v4_clamp
+.text
+	.align 4
+.stabs "v4_sign:F1",36,0,0,v4_sign
+.globl v4_sign
+	.type	v4_sign,@function
+v4_sign:
+.stabn 68,0,327,.LMa1448-v4_sign
+.LMa1448:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,327,.LMb1448-v4_sign
+.LMb1448:
+.LBB152:
+.stabn 68,0,328,.LM1449-v4_sign
+.LM1449:
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS221
+	call v4__dscheck
+.LDS221:
+	test %eax,%eax
+	jge .L166
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS222
+	call v4__dscheck
+.LDS222:
+	jmp .L167
+.L166:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS223
+	call v4__dscheck
+.LDS223:
+	test %eax,%eax
+	jle .L168
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS224
+	call v4__dscheck
+.LDS224:
+	jmp .L169
+.L168:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS225
+	call v4__dscheck
+.LDS225:
+.L169:
+.L167:
+	mov %ecx,v4__dsindex
+.LBE152:
+.stabn 68,0,328,.LM1474-v4_sign
+.LM1474:
+	pop %ebx
+	leave
+	ret
+.Lfe152:
+	.size	 v4_sign,.Lfe152-v4_sign
+.stabn	192,0,0,.LBB152-v4_sign
+.stabn	224,0,0,.LBE152-v4_sign
+.Lscope152:
+.stabs	"",36,0,0,.Lscope152-v4_sign
+.text
+	.align 4
+.stabs "v4_twice:F1",36,0,0,v4_twice
+.globl v4_twice
+	.type	v4_twice,@function
+v4_twice:
+.stabn 68,0,329,.LMa1475-v4_twice
+.LMa1475:
+.stabn 68,0,329,.LMb1475-v4_twice
+.LMb1475:
+.LBB153:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS226
+	call v4__dscheck
+.LDS226:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS227
+	call v4__dscheck
+.LDS227:
+	mov %ecx,v4__dsindex
+.LBE153:
+.stabn 68,0,329,.LM1481-v4_twice
+.LM1481:
+	ret
+.Lfe153:
+	.size	 v4_twice,.Lfe153-v4_twice
+.stabn	192,0,0,.LBB153-v4_twice
+.stabn	224,0,0,.LBE153-v4_twice
+.Lscope153:
+.stabs	"",36,0,0,.Lscope153-v4_twice
+.text
+	.align 4
+.stabs "v4_get_Minusi:F1",36,0,0,v4_get_Minusi
+.globl v4_get_Minusi
+	.type	v4_get_Minusi,@function
+v4_get_Minusi:
+.stabn 68,0,330,.LMa1482-v4_get_Minusi
+.LMa1482:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,330,.LMb1482-v4_get_Minusi
+.LMb1482:
+.LBB154:
+	pop %ebx
+	leave
+	jmp v4_i
+.LBE154:
+.stabn 68,0,330,.LM1485-v4_get_Minusi
+.LM1485:
+	pop %ebx
+	leave
+	ret
+.Lfe154:
+	.size	 v4_get_Minusi,.Lfe154-v4_get_Minusi
+.stabn	192,0,0,.LBB154-v4_get_Minusi
+.stabn	224,0,0,.LBE154-v4_get_Minusi
+.Lscope154:
+.stabs	"",36,0,0,.Lscope154-v4_get_Minusi
+.text
+	.align 4
+.stabs "v4_get_Minusi_Minusnoinline:F1",36,0,0,v4_get_Minusi_Minusnoinline
+.globl v4_get_Minusi_Minusnoinline
+	.type	v4_get_Minusi_Minusnoinline,@function
+v4_get_Minusi_Minusnoinline:
+.stabn 68,0,331,.LMa1486-v4_get_Minusi_Minusnoinline
+.LMa1486:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,331,.LMb1486-v4_get_Minusi_Minusnoinline
+.LMb1486:
+.LBB155:
+	pop %ebx
+	leave
+	jmp v4_i
+.LBE155:
+.stabn 68,0,331,.LM1489-v4_get_Minusi_Minusnoinline
+.LM1489:
+	pop %ebx
+	leave
+	ret
+.Lfe155:
+	.size	 v4_get_Minusi_Minusnoinline,.Lfe155-v4_get_Minusi_Minusnoinline
+.stabn	192,0,0,.LBB155-v4_get_Minusi_Minusnoinline
+.stabn	224,0,0,.LBE155-v4_get_Minusi_Minusnoinline
+.Lscope155:
+.stabs	"",36,0,0,.Lscope155-v4_get_Minusi_Minusnoinline
+.text
+	.align 4
+.stabs "v4_find_Minusfirst:F1",36,0,0,v4_find_Minusfirst
+.globl v4_find_Minusfirst
+	.type	v4_find_Minusfirst,@function
+v4_find_Minusfirst:
+.stabn 68,0,332,.LMa1490-v4_find_Minusfirst
+.LMa1490:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,332,.LMb1490-v4_find_Minusfirst
+.LMb1490:
+.LBB156:
+.stabn 68,0,333,.LM1491-v4_find_Minusfirst
+.LM1491:
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS228
+	call v4__dscheck
+.LDS228:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	xor %eax,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS229
+	call v4__dscheck
+.LDS229:
+.L175:
+	mov %ecx,v4__dsindex
+	call v4_i
+	mov $3,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS230
+	call v4__dscheck
+.LDS230:
+	cmp %edx,%eax
+	jle .L177
+	mov %ecx,v4__dsindex
+	call v4_drop
+	call v4_i
+	mov v4__dsindex,%ecx
+	jmp .L176
+.L177:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L175
+.L176:
+	call v4__rpop
+	call v4__rpop
+	mov %ecx,v4__dsindex
+.LBE156:
+.stabn 68,0,333,.LM1526-v4_find_Minusfirst
+.LM1526:
+	pop %ebx
+	leave
+	ret
+.Lfe156:
+	.size	 v4_find_Minusfirst,.Lfe156-v4_find_Minusfirst
+.stabn	192,0,0,.LBB156-v4_find_Minusfirst
+.stabn	224,0,0,.LBE156-v4_find_Minusfirst
+.Lscope156:
+.stabs	"",36,0,0,.Lscope156-v4_find_Minusfirst
+.text
+	.align 4
+.stabs "v4_factorial:F1",36,0,0,v4_factorial
+.globl v4_factorial
+	.type	v4_factorial,@function
+v4_factorial:
+.stabn 68,0,334,.LMa1527-v4_factorial
+.LMa1527:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,334,.LMb1527-v4_factorial
+.LMb1527:
+.LBB157:
+	call v4_dup
+	mov $2,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS231
+	call v4__dscheck
+.LDS231:
+	cmp %edx,%eax
+	jge .L179
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS232
+	call v4__dscheck
+.LDS232:
+	jmp .L178
+.L179:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	dec %eax
+	cmp $4080,%ecx
+	jbe .LDS233
+	call v4__dscheck
+.LDS233:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS234
+	call v4__dscheck
+.LDS234:
+	mov %ecx,v4__dsindex
+	call v4_factorial
+	pop %ebx
+	leave
+	jmp v4_Star
+	mov v4__dsindex,%ecx
+.L178:
+	mov %ecx,v4__dsindex
+.LBE157:
+.stabn 68,0,334,.LM1550-v4_factorial
+.LM1550:
+	pop %ebx
+	leave
+	ret
+.Lfe157:
+	.size	 v4_factorial,.Lfe157-v4_factorial
+.stabn	192,0,0,.LBB157-v4_factorial
+.stabn	224,0,0,.LBE157-v4_factorial
+.Lscope157:
+.stabs	"",36,0,0,.Lscope157-v4_factorial
+.text
+	.align 4
+.stabs "v4_use_Minusclamp:F1",36,0,0,v4_use_Minusclamp
+.globl v4_use_Minusclamp
+	.type	v4_use_Minusclamp,@function
+v4_use_Minusclamp:
+.stabn 68,0,336,.LMa1551-v4_use_Minusclamp
+.LMa1551:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,336,.LMb1551-v4_use_Minusclamp
+.LMb1551:
+.LBB158:
+.stabn 68,0,325,.LM1553-v4_use_Minusclamp
+.LM1553:
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS235
+	call v4__dscheck
+.LDS235:
+	test %eax,%eax
+	jge .L246
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS236
+	call v4__dscheck
+.LDS236:
+	jmp .L248
+.L246:
+.stabn 68,0,326,.LM1564-v4_use_Minusclamp
+.LM1564:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS237
+	call v4__dscheck
+.LDS237:
+	cmp %edx,%eax
+	jle .L247
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS238
+	call v4__dscheck
+.LDS238:
+.L247:
+.L248:
+.stabn 68,0,336,.LM1579-v4_use_Minusclamp
+.LM1579:
+	mov %ecx,v4__dsindex
+	call v4_rot
+.stabn 68,0,325,.LM1581-v4_use_Minusclamp
+.LM1581:
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS239
+	call v4__dscheck
+.LDS239:
+	test %eax,%eax
+	jge .L249
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS240
+	call v4__dscheck
+.LDS240:
+	jmp .L251
+.L249:
+.stabn 68,0,326,.LM1592-v4_use_Minusclamp
+.LM1592:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS241
+	call v4__dscheck
+.LDS241:
+	cmp %edx,%eax
+	jle .L250
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS242
+	call v4__dscheck
+.LDS242:
+.L250:
+.L251:
+.stabn 68,0,336,.LM1607-v4_use_Minusclamp
+.LM1607:
+	mov %ecx,v4__dsindex
+	call v4_rot
+.stabn 68,0,325,.LM1609-v4_use_Minusclamp
+.LM1609:
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS243
+	call v4__dscheck
+.LDS243:
+	test %eax,%eax
+	jge .L252
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS244
+	call v4__dscheck
+.LDS244:
+	jmp .L254
+.L252:
+.stabn 68,0,326,.LM1620-v4_use_Minusclamp
+.LM1620:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS245
+	call v4__dscheck
+.LDS245:
+	cmp %edx,%eax
+	jle .L253
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS246
+	call v4__dscheck
+.LDS246:
+.L253:
+.L254:
+.stabn 68,0,336,.LM1635-v4_use_Minusclamp
+.LM1635:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_rot
+.LBE158:
+.stabn 68,0,336,.LM1637-v4_use_Minusclamp
+.LM1637:
+	pop %ebx
+	leave
+	ret
+.Lfe158:
+	.size	 v4_use_Minusclamp,.Lfe158-v4_use_Minusclamp
+.stabn	192,0,0,.LBB158-v4_use_Minusclamp
+.stabn	224,0,0,.LBE158-v4_use_Minusclamp
+.Lscope158:
+.stabs	"",36,0,0,.Lscope158-v4_use_Minusclamp
+.text
+	.align 4
+.stabs "v4_use_Minussign:F1",36,0,0,v4_use_Minussign
+.globl v4_use_Minussign
+	.type	v4_use_Minussign,@function
+v4_use_Minussign:
+.stabn 68,0,337,.LMa1638-v4_use_Minussign
+.LMa1638:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,337,.LMb1638-v4_use_Minussign
+.LMb1638:
+.LBB160:
+	mov $-5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS247
+	call v4__dscheck
+.LDS247:
+	mov %ecx,v4__dsindex
+	call v4_sign
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS248
+	call v4__dscheck
+.LDS248:
+	mov %ecx,v4__dsindex
+	call v4_sign
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS249
+	call v4__dscheck
+.LDS249:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_sign
+.LBE160:
+.stabn 68,0,337,.LM1649-v4_use_Minussign
+.LM1649:
+	pop %ebx
+	leave
+	ret
+.Lfe160:
+	.size	 v4_use_Minussign,.Lfe160-v4_use_Minussign
+.stabn	192,0,0,.LBB160-v4_use_Minussign
+.stabn	224,0,0,.LBE160-v4_use_Minussign
+.Lscope160:
+.stabs	"",36,0,0,.Lscope160-v4_use_Minussign
+.text
+	.align 4
+.stabs "v4_use_Minustwice:F1",36,0,0,v4_use_Minustwice
+.globl v4_use_Minustwice
+	.type	v4_use_Minustwice,@function
+v4_use_Minustwice:
+.stabn 68,0,338,.LMa1650-v4_use_Minustwice
+.LMa1650:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,338,.LMb1650-v4_use_Minustwice
+.LMb1650:
+.LBB161:
+	call v4_twice
+	pop %ebx
+	leave
+	jmp v4_twice
+.LBE161:
+.stabn 68,0,338,.LM1654-v4_use_Minustwice
+.LM1654:
+	pop %ebx
+	leave
+	ret
+.Lfe161:
+	.size	 v4_use_Minustwice,.Lfe161-v4_use_Minustwice
+.stabn	192,0,0,.LBB161-v4_use_Minustwice
+.stabn	224,0,0,.LBE161-v4_use_Minustwice
+.Lscope161:
+.stabs	"",36,0,0,.Lscope161-v4_use_Minustwice
+.text
+	.align 4
+.stabs "v4_sum_Minusi:F1",36,0,0,v4_sum_Minusi
+.globl v4_sum_Minusi
+	.type	v4_sum_Minusi,@function
+v4_sum_Minusi:
+.stabn 68,0,339,.LMa1655-v4_sum_Minusi
+.LMa1655:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+.stabn 68,0,339,.LMb1655-v4_sum_Minusi
+.LMb1655:
+.LBB162:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $5,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov %eax,-12(%ebp)
+	mov %edx,-16(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS250
+	call v4__dscheck
+.LDS250:
+.L185:
+	mov -16(%ebp),%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS251
+	call v4__dscheck
+.LDS251:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -16(%ebp),%edx
+	inc %edx
+	mov -12(%ebp),%eax
+	mov %edx,-16(%ebp)
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS252
+	call v4__dscheck
+.LDS252:
+	test %edx,%edx
+	jne .L185
+	mov -12(%ebp),%eax
+	mov %ecx,v4__dsindex
+.LBE162:
+.stabn 68,0,339,.LM1688-v4_sum_Minusi
+.LM1688:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe162:
+	.size	 v4_sum_Minusi,.Lfe162-v4_sum_Minusi
+.stabn	192,0,0,.LBB162-v4_sum_Minusi
+.stabn	224,0,0,.LBE162-v4_sum_Minusi
+.Lscope162:
+.stabs	"",36,0,0,.Lscope162-v4_sum_Minusi
+.text
+	.align 4
+.stabs "v4_sum_Minusi_Minusnoinline:F1",36,0,0,v4_sum_Minusi_Minusnoinline
+.globl v4_sum_Minusi_Minusnoinline
+	.type	v4_sum_Minusi_Minusnoinline,@function
+v4_sum_Minusi_Minusnoinline:
+.stabn 68,0,340,.LMa1689-v4_sum_Minusi_Minusnoinline
+.LMa1689:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+.stabn 68,0,340,.LMb1689-v4_sum_Minusi_Minusnoinline
+.LMb1689:
+.LBB163:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $5,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS253
+	call v4__dscheck
+.LDS253:
+.L189:
+	mov %ecx,v4__dsindex
+	call v4_get_Minusi_Minusnoinline
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS254
+	call v4__dscheck
+.LDS254:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS255
+	call v4__dscheck
+.LDS255:
+	test %edx,%edx
+	jne .L189
+	call v4__rpop
+	call v4__rpop
+	mov %ecx,v4__dsindex
+.LBE163:
+.stabn 68,0,340,.LM1719-v4_sum_Minusi_Minusnoinline
+.LM1719:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe163:
+	.size	 v4_sum_Minusi_Minusnoinline,.Lfe163-v4_sum_Minusi_Minusnoinline
+.stabn	192,0,0,.LBB163-v4_sum_Minusi_Minusnoinline
+.stabn	224,0,0,.LBE163-v4_sum_Minusi_Minusnoinline
+.Lscope163:
+.stabs	"",36,0,0,.Lscope163-v4_sum_Minusi_Minusnoinline
+.text
+	.align 4
+.stabs "v4_sum_Minusj:F1",36,0,0,v4_sum_Minusj
+.globl v4_sum_Minusj
+	.type	v4_sum_Minusj,@function
+v4_sum_Minusj:
+.stabn 68,0,341,.LMa1720-v4_sum_Minusj
+.LMa1720:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+.stabn 68,0,341,.LMb1720-v4_sum_Minusj
+.LMb1720:
+.LBB164:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov %eax,-12(%ebp)
+	mov %edx,-16(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS256
+	call v4__dscheck
+.LDS256:
+.L193:
+	mov $3,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov %eax,-20(%ebp)
+	mov %edx,-24(%ebp)
+.L196:
+	mov -24(%ebp),%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS257
+	call v4__dscheck
+.LDS257:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -24(%ebp),%edx
+	inc %edx
+	mov -20(%ebp),%eax
+	mov %edx,-24(%ebp)
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS258
+	call v4__dscheck
+.LDS258:
+	test %edx,%edx
+	jne .L196
+	mov -20(%ebp),%eax
+	mov -16(%ebp),%edx
+	inc %edx
+	mov -12(%ebp),%eax
+	mov %edx,-16(%ebp)
+	sub %eax,%edx
+	jne .L193
+	mov -12(%ebp),%eax
+	mov %ecx,v4__dsindex
+.LBE164:
+.stabn 68,0,341,.LM1773-v4_sum_Minusj
+.LM1773:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe164:
+	.size	 v4_sum_Minusj,.Lfe164-v4_sum_Minusj
+.stabn	192,0,0,.LBB164-v4_sum_Minusj
+.stabn	224,0,0,.LBE164-v4_sum_Minusj
+.Lscope164:
+.stabs	"",36,0,0,.Lscope164-v4_sum_Minusj
+.text
+	.align 4
+.stabs "v4_use_Minusfind_Minusfirst:F1",36,0,0,v4_use_Minusfind_Minusfirst
+.globl v4_use_Minusfind_Minusfirst
+	.type	v4_use_Minusfind_Minusfirst,@function
+v4_use_Minusfind_Minusfirst:
+.stabn 68,0,342,.LMa1774-v4_use_Minusfind_Minusfirst
+.LMa1774:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,342,.LMb1774-v4_use_Minusfind_Minusfirst
+.LMb1774:
+.LBB165:
+	mov $10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS259
+	call v4__dscheck
+.LDS259:
+	mov %ecx,v4__dsindex
+	call v4_find_Minusfirst
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS260
+	call v4__dscheck
+.LDS260:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_find_Minusfirst
+.LBE165:
+.stabn 68,0,342,.LM1782-v4_use_Minusfind_Minusfirst
+.LM1782:
+	pop %ebx
+	leave
+	ret
+.Lfe165:
+	.size	 v4_use_Minusfind_Minusfirst,.Lfe165-v4_use_Minusfind_Minusfirst
+.stabn	192,0,0,.LBB165-v4_use_Minusfind_Minusfirst
+.stabn	224,0,0,.LBE165-v4_use_Minusfind_Minusfirst
+.Lscope165:
+.stabs	"",36,0,0,.Lscope165-v4_use_Minusfind_Minusfirst
+.text
+	.align 4
+.stabs "v4_use_Minusin_Minusloop:F1",36,0,0,v4_use_Minusin_Minusloop
+.globl v4_use_Minusin_Minusloop
+	.type	v4_use_Minusin_Minusloop,@function
+v4_use_Minusin_Minusloop:
+.stabn 68,0,343,.LMa1783-v4_use_Minusin_Minusloop
+.LMa1783:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+.stabn 68,0,343,.LMb1783-v4_use_Minusin_Minusloop
+.LMb1783:
+.LBB166:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $200,%eax
+	mov %eax,%esi
+	mov $-100,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS261
+	call v4__dscheck
+.LDS261:
+.L201:
+	mov %ecx,v4__dsindex
+	call v4_i
+.stabn 68,0,325,.LM1797-v4_use_Minusin_Minusloop
+.LM1797:
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS262
+	call v4__dscheck
+.LDS262:
+	test %eax,%eax
+	jge .L255
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS263
+	call v4__dscheck
+.LDS263:
+	jmp .L257
+.L255:
+.stabn 68,0,326,.LM1808-v4_use_Minusin_Minusloop
+.LM1808:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS264
+	call v4__dscheck
+.LDS264:
+	cmp %edx,%eax
+	jle .L256
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS265
+	call v4__dscheck
+.LDS265:
+.L256:
+.L257:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS266
+	call v4__dscheck
+.LDS266:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $50,%eax
+	xchg %edx,%eax
+	call v4__rpop
+	xchg %eax,%edx
+	add %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS267
+	call v4__dscheck
+.LDS267:
+	test %eax,%eax
+	jl .L203
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	test %edx,%edx
+	jl .L201
+	jmp .L202
+.L203:
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	test %edx,%edx
+	jge .L201
+.L202:
+	call v4__rpop
+	call v4__rpop
+	mov %ecx,v4__dsindex
+.LBE166:
+.stabn 68,0,343,.LM1851-v4_use_Minusin_Minusloop
+.LM1851:
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe166:
+	.size	 v4_use_Minusin_Minusloop,.Lfe166-v4_use_Minusin_Minusloop
+.stabn	192,0,0,.LBB166-v4_use_Minusin_Minusloop
+.stabn	224,0,0,.LBE166-v4_use_Minusin_Minusloop
+.Lscope166:
+.stabs	"",36,0,0,.Lscope166-v4_use_Minusin_Minusloop
+.text
+	.align 4
+.stabs "v4_sum_Minusstep:F1",36,0,0,v4_sum_Minusstep
+.globl v4_sum_Minusstep
+	.type	v4_sum_Minusstep,@function
+v4_sum_Minusstep:
+.stabn 68,0,363,.LMa1852-v4_sum_Minusstep
+.LMa1852:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,363,.LMb1852-v4_sum_Minusstep
+.LMb1852:
+.LBB168:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS268
+	call v4__dscheck
+.LDS268:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	xor %eax,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS269
+	call v4__dscheck
+.LDS269:
+.L206:
+	mov (v4_step),%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS270
+	call v4__dscheck
+.LDS270:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -12(%ebp),%edx
+	inc %edx
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS271
+	call v4__dscheck
+.LDS271:
+	test %edx,%edx
+	jne .L206
+	mov -8(%ebp),%eax
+	mov %ecx,v4__dsindex
+.LBE168:
+.stabn 68,0,363,.LM1885-v4_sum_Minusstep
+.LM1885:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe168:
+	.size	 v4_sum_Minusstep,.Lfe168-v4_sum_Minusstep
+.stabn	192,0,0,.LBB168-v4_sum_Minusstep
+.stabn	224,0,0,.LBE168-v4_sum_Minusstep
+.Lscope168:
+.stabs	"",36,0,0,.Lscope168-v4_sum_Minusstep
+.text
+	.align 4
+.stabs "v4_bump_Minusstep:F1",36,0,0,v4_bump_Minusstep
+.globl v4_bump_Minusstep
+	.type	v4_bump_Minusstep,@function
+v4_bump_Minusstep:
+.stabn 68,0,364,.LMa1886-v4_bump_Minusstep
+.LMa1886:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,364,.LMb1886-v4_bump_Minusstep
+.LMb1886:
+.LBB169:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS272
+	call v4__dscheck
+.LDS272:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	xor %eax,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS273
+	call v4__dscheck
+.LDS273:
+.L210:
+	mov (v4_step),%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS274
+	call v4__dscheck
+.LDS274:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov (v4_step),%edx
+	add %edx,%eax
+	mov %eax,(v4_step)
+	mov -12(%ebp),%edx
+	inc %edx
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS275
+	call v4__dscheck
+.LDS275:
+	test %edx,%edx
+	jne .L210
+	mov -8(%ebp),%eax
+	mov %ecx,v4__dsindex
+.LBE169:
+.stabn 68,0,364,.LM1928-v4_bump_Minusstep
+.LM1928:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe169:
+	.size	 v4_bump_Minusstep,.Lfe169-v4_bump_Minusstep
+.stabn	192,0,0,.LBB169-v4_bump_Minusstep
+.stabn	224,0,0,.LBE169-v4_bump_Minusstep
+.Lscope169:
+.stabs	"",36,0,0,.Lscope169-v4_bump_Minusstep
+.text
+	.align 4
+.stabs "v4_sum_Minusstep_Minus2:F1",36,0,0,v4_sum_Minusstep_Minus2
+.globl v4_sum_Minusstep_Minus2
+	.type	v4_sum_Minusstep_Minus2,@function
+v4_sum_Minusstep_Minus2:
+.stabn 68,0,365,.LMa1929-v4_sum_Minusstep_Minus2
+.LMa1929:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+.stabn 68,0,365,.LMb1929-v4_sum_Minusstep_Minus2
+.LMb1929:
+.LBB170:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS276
+	call v4__dscheck
+.LDS276:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	xor %eax,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,-12(%ebp)
+	mov %edx,-16(%ebp)
+	cmp $4080,%ecx
+	jbe .LDS277
+	call v4__dscheck
+.LDS277:
+.L214:
+	mov $3,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov %eax,-20(%ebp)
+	mov %edx,-24(%ebp)
+.L217:
+	mov (v4_step),%eax
+	mov %eax,%esi
+	mov -16(%ebp),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS278
+	call v4__dscheck
+.LDS278:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov -24(%ebp),%edx
+	inc %edx
+	mov -20(%ebp),%eax
+	mov %edx,-24(%ebp)
+	sub %eax,%edx
+	cmp $4080,%ecx
+	jbe .LDS279
+	call v4__dscheck
+.LDS279:
+	test %edx,%edx
+	jne .L217
+	mov -20(%ebp),%eax
+	mov -16(%ebp),%edx
+	inc %edx
+	mov -12(%ebp),%eax
+	mov %edx,-16(%ebp)
+	sub %eax,%edx
+	jne .L214
+	mov -12(%ebp),%eax
+	mov %ecx,v4__dsindex
+.LBE170:
+.stabn 68,0,365,.LM1990-v4_sum_Minusstep_Minus2
+.LM1990:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe170:
+	.size	 v4_sum_Minusstep_Minus2,.Lfe170-v4_sum_Minusstep_Minus2
+.stabn	192,0,0,.LBB170-v4_sum_Minusstep_Minus2
+.stabn	224,0,0,.LBE170-v4_sum_Minusstep_Minus2
+.Lscope170:
+.stabs	"",36,0,0,.Lscope170-v4_sum_Minusstep_Minus2
+.text
+	.align 4
+.stabs "v4_set_Minuscell_Minusv:F1",36,0,0,v4_set_Minuscell_Minusv
+.globl v4_set_Minuscell_Minusv
+	.type	v4_set_Minuscell_Minusv,@function
+v4_set_Minuscell_Minusv:
+.stabn 68,0,380,.LMa1991-v4_set_Minuscell_Minusv
+.LMa1991:
+.stabn 68,0,380,.LMb1991-v4_set_Minuscell_Minusv
+.LMb1991:
+.LBB172:
+	mov $11,%eax
+	mov %eax,(v4_cell_Minusv)
+.LBE172:
+.stabn 68,0,380,.LM2000-v4_set_Minuscell_Minusv
+.LM2000:
+	ret
+.Lfe172:
+	.size	 v4_set_Minuscell_Minusv,.Lfe172-v4_set_Minuscell_Minusv
+.stabn	192,0,0,.LBB172-v4_set_Minuscell_Minusv
+.stabn	224,0,0,.LBE172-v4_set_Minuscell_Minusv
+.Lscope172:
+.stabs	"",36,0,0,.Lscope172-v4_set_Minuscell_Minusv
+.text
+	.align 4
+.stabs "v4_forward_Minusv:F1",36,0,0,v4_forward_Minusv
+.globl v4_forward_Minusv
+	.type	v4_forward_Minusv,@function
+v4_forward_Minusv:
+.stabn 68,0,381,.LMa2001-v4_forward_Minusv
+.LMa2001:
+.stabn 68,0,381,.LMb2001-v4_forward_Minusv
+.LMb2001:
+.LBB173:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,(v4_cell_Minusv)
+	cmp $4080,%ecx
+	jbe .LDS280
+	call v4__dscheck
+.LDS280:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS281
+	call v4__dscheck
+.LDS281:
+	mov %ecx,v4__dsindex
+.LBE173:
+.stabn 68,0,381,.LM2013-v4_forward_Minusv
+.LM2013:
+	ret
+.Lfe173:
+	.size	 v4_forward_Minusv,.Lfe173-v4_forward_Minusv
+.stabn	192,0,0,.LBB173-v4_forward_Minusv
+.stabn	224,0,0,.LBE173-v4_forward_Minusv
+.Lscope173:
+.stabs	"",36,0,0,.Lscope173-v4_forward_Minusv
+.text
+	.align 4
+.stabs "v4_reload_Minusv:F1",36,0,0,v4_reload_Minusv
+.globl v4_reload_Minusv
+	.type	v4_reload_Minusv,@function
+v4_reload_Minusv:
+.stabn 68,0,382,.LMa2014-v4_reload_Minusv
+.LMa2014:
+.stabn 68,0,382,.LMb2014-v4_reload_Minusv
+.LMb2014:
+.LBB174:
+	mov (v4_cell_Minusv),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS282
+	call v4__dscheck
+.LDS282:
+	mov %ecx,v4__dsindex
+.LBE174:
+.stabn 68,0,382,.LM2026-v4_reload_Minusv
+.LM2026:
+	ret
+.Lfe174:
+	.size	 v4_reload_Minusv,.Lfe174-v4_reload_Minusv
+.stabn	192,0,0,.LBB174-v4_reload_Minusv
+.stabn	224,0,0,.LBE174-v4_reload_Minusv
+.Lscope174:
+.stabs	"",36,0,0,.Lscope174-v4_reload_Minusv
+.text
+	.align 4
+.stabs "v4_overwrite_Minusv:F1",36,0,0,v4_overwrite_Minusv
+.globl v4_overwrite_Minusv
+	.type	v4_overwrite_Minusv,@function
+v4_overwrite_Minusv:
+.stabn 68,0,383,.LMa2027-v4_overwrite_Minusv
+.LMa2027:
+.stabn 68,0,383,.LMb2027-v4_overwrite_Minusv
+.LMb2027:
+.LBB175:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,(v4_cell_Minusv)
+	cmp $4080,%ecx
+	jbe .LDS283
+	call v4__dscheck
+.LDS283:
+	mov %ecx,v4__dsindex
+.LBE175:
+.stabn 68,0,383,.LM2039-v4_overwrite_Minusv
+.LM2039:
+	ret
+.Lfe175:
+	.size	 v4_overwrite_Minusv,.Lfe175-v4_overwrite_Minusv
+.stabn	192,0,0,.LBB175-v4_overwrite_Minusv
+.stabn	224,0,0,.LBE175-v4_overwrite_Minusv
+.Lscope175:
+.stabs	"",36,0,0,.Lscope175-v4_overwrite_Minusv
+.text
+	.align 4
+.stabs "v4_store_Minusthrough:F1",36,0,0,v4_store_Minusthrough
+.globl v4_store_Minusthrough
+	.type	v4_store_Minusthrough,@function
+v4_store_Minusthrough:
+.stabn 68,0,384,.LMa2040-v4_store_Minusthrough
+.LMa2040:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,384,.LMb2040-v4_store_Minusthrough
+.LMb2040:
+.LBB176:
+	mov $5,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS284
+	call v4__dscheck
+.LDS284:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	call v4_Store
+	mov (v4_cell_Minusv),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS285
+	call v4__dscheck
+.LDS285:
+	mov %ecx,v4__dsindex
+.LBE176:
+.stabn 68,0,384,.LM2058-v4_store_Minusthrough
+.LM2058:
+	pop %ebx
+	leave
+	ret
+.Lfe176:
+	.size	 v4_store_Minusthrough,.Lfe176-v4_store_Minusthrough
+.stabn	192,0,0,.LBB176-v4_store_Minusthrough
+.stabn	224,0,0,.LBE176-v4_store_Minusthrough
+.Lscope176:
+.stabs	"",36,0,0,.Lscope176-v4_store_Minusthrough
+.text
+	.align 4
+.stabs "v4_cstore_Minusthrough:F1",36,0,0,v4_cstore_Minusthrough
+.globl v4_cstore_Minusthrough
+	.type	v4_cstore_Minusthrough,@function
+v4_cstore_Minusthrough:
+.stabn 68,0,385,.LMa2059-v4_cstore_Minusthrough
+.LMa2059:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,385,.LMb2059-v4_cstore_Minusthrough
+.LMb2059:
+.LBB177:
+	xor %eax,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS286
+	call v4__dscheck
+.LDS286:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	call v4_c_Store
+	mov (v4_cell_Minusv),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS287
+	call v4__dscheck
+.LDS287:
+	mov %ecx,v4__dsindex
+.LBE177:
+.stabn 68,0,385,.LM2077-v4_cstore_Minusthrough
+.LM2077:
+	pop %ebx
+	leave
+	ret
+.Lfe177:
+	.size	 v4_cstore_Minusthrough,.Lfe177-v4_cstore_Minusthrough
+.stabn	192,0,0,.LBB177-v4_cstore_Minusthrough
+.stabn	224,0,0,.LBE177-v4_cstore_Minusthrough
+.Lscope177:
+.stabs	"",36,0,0,.Lscope177-v4_cstore_Minusthrough
+.text
+	.align 4
+.stabs "v4_fetch_Minusthrough:F1",36,0,0,v4_fetch_Minusthrough
+.globl v4_fetch_Minusthrough
+	.type	v4_fetch_Minusthrough,@function
+v4_fetch_Minusthrough:
+.stabn 68,0,386,.LMa2078-v4_fetch_Minusthrough
+.LMa2078:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,386,.LMb2078-v4_fetch_Minusthrough
+.LMb2078:
+.LBB179:
+	mov $3,%eax
+	mov %eax,(v4_cell_Minusv)
+	call v4_Fetch
+	mov $4,%eax
+	mov %eax,(v4_cell_Minusv)
+.LBE179:
+.stabn 68,0,386,.LM2095-v4_fetch_Minusthrough
+.LM2095:
+	pop %ebx
+	leave
+	ret
+.Lfe179:
+	.size	 v4_fetch_Minusthrough,.Lfe179-v4_fetch_Minusthrough
+.stabn	192,0,0,.LBB179-v4_fetch_Minusthrough
+.stabn	224,0,0,.LBE179-v4_fetch_Minusthrough
+.Lscope179:
+.stabs	"",36,0,0,.Lscope179-v4_fetch_Minusthrough
+.text
+	.align 4
+.stabs "v4_around_Minuscall:F1",36,0,0,v4_around_Minuscall
+.globl v4_around_Minuscall
+	.type	v4_around_Minuscall,@function
+v4_around_Minuscall:
+.stabn 68,0,387,.LMa2096-v4_around_Minuscall
+.LMa2096:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,387,.LMb2096-v4_around_Minuscall
+.LMb2096:
+.LBB180:
+	mov $5,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS288
+	call v4__dscheck
+.LDS288:
+	mov %ecx,v4__dsindex
+	call v4_set_Minuscell_Minusv
+	mov (v4_cell_Minusv),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS289
+	call v4__dscheck
+.LDS289:
+	mov %ecx,v4__dsindex
+.LBE180:
+.stabn 68,0,387,.LM2116-v4_around_Minuscall
+.LM2116:
+	pop %ebx
+	leave
+	ret
+.Lfe180:
+	.size	 v4_around_Minuscall,.Lfe180-v4_around_Minuscall
+.stabn	192,0,0,.LBB180-v4_around_Minuscall
+.stabn	224,0,0,.LBE180-v4_around_Minuscall
+.Lscope180:
+.stabs	"",36,0,0,.Lscope180-v4_around_Minuscall
+.text
+	.align 4
+.stabs "v4_thread_Minusforward:F1",36,0,0,v4_thread_Minusforward
+.globl v4_thread_Minusforward
+	.type	v4_thread_Minusforward,@function
+v4_thread_Minusforward:
+.stabn 68,0,406,.LMa2117-v4_thread_Minusforward
+.LMa2117:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,406,.LMb2117-v4_thread_Minusforward
+.LMb2117:
+.LBB181:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS290
+	call v4__dscheck
+.LDS290:
+	test %eax,%eax
+	je .L228
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS291
+	call v4__dscheck
+.LDS291:
+	test %eax,%eax
+	je .L229
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS292
+	call v4__dscheck
+.LDS292:
+	jmp .L230
+.L228:
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS293
+	call v4__dscheck
+.LDS293:
+.L229:
+.L230:
+	mov %ecx,v4__dsindex
+.LBE181:
+.stabn 68,0,406,.LM2135-v4_thread_Minusforward
+.LM2135:
+	pop %ebx
+	leave
+	ret
+.Lfe181:
+	.size	 v4_thread_Minusforward,.Lfe181-v4_thread_Minusforward
+.stabn	192,0,0,.LBB181-v4_thread_Minusforward
+.stabn	224,0,0,.LBE181-v4_thread_Minusforward
+.Lscope181:
+.stabs	"",36,0,0,.Lscope181-v4_thread_Minusforward
+.text
+	.align 4
+.stabs "v4_count_Minusodd:F1",36,0,0,v4_count_Minusodd
+.globl v4_count_Minusodd
+	.type	v4_count_Minusodd,@function
+v4_count_Minusodd:
+.stabn 68,0,407,.LMa2136-v4_count_Minusodd
+.LMa2136:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,407,.LMb2136-v4_count_Minusodd
+.LMb2136:
+.LBB182:
+.stabn 68,0,408,.LM2137-v4_count_Minusodd
+.LM2137:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS294
+	call v4__dscheck
+.LDS294:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+.L234:
+.L232:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS295
+	call v4__dscheck
+.LDS295:
+	test %eax,%eax
+	je .L233
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	dec %eax
+	cmp $4080,%ecx
+	jbe .LDS296
+	call v4__dscheck
+.LDS296:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS297
+	call v4__dscheck
+.LDS297:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	and %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS298
+	call v4__dscheck
+.LDS298:
+	test %eax,%eax
+	je .L234
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS299
+	call v4__dscheck
+.LDS299:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS300
+	call v4__dscheck
+.LDS300:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L232
+.L233:
+	mov %ecx,v4__dsindex
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE182:
+.stabn 68,0,408,.LM2170-v4_count_Minusodd
+.LM2170:
+	pop %ebx
+	leave
+	ret
+.Lfe182:
+	.size	 v4_count_Minusodd,.Lfe182-v4_count_Minusodd
+.stabn	192,0,0,.LBB182-v4_count_Minusodd
+.stabn	224,0,0,.LBE182-v4_count_Minusodd
+.Lscope182:
+.stabs	"",36,0,0,.Lscope182-v4_count_Minusodd
+.text
+	.align 4
+.stabs "v4_spin:F1",36,0,0,v4_spin
+.globl v4_spin
+	.type	v4_spin,@function
+v4_spin:
+.stabn 68,0,409,.LMa2171-v4_spin
+.LMa2171:
+.stabn 68,0,409,.LMb2171-v4_spin
+.LMb2171:
+.LBB183:
+	mov v4__dsindex,%ecx
+.L236:
+	jmp .L236
+	mov %ecx,v4__dsindex
+.LBE183:
+.stabn 68,0,409,.LM2176-v4_spin
+.LM2176:
+	ret
+.Lfe183:
+	.size	 v4_spin,.Lfe183-v4_spin
+.stabn	192,0,0,.LBB183-v4_spin
+.stabn	224,0,0,.LBE183-v4_spin
+.Lscope183:
+.stabs	"",36,0,0,.Lscope183-v4_spin
+.text
+	.align 4
+.stabs "v4_spin_Minusunless:F1",36,0,0,v4_spin_Minusunless
+.globl v4_spin_Minusunless
+	.type	v4_spin_Minusunless,@function
+v4_spin_Minusunless:
+.stabn 68,0,410,.LMa2177-v4_spin_Minusunless
+.LMa2177:
+.stabn 68,0,410,.LMb2177-v4_spin_Minusunless
+.LMb2177:
+.LBB184:
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS301
+	call v4__dscheck
+.LDS301:
+	test %eax,%eax
+	jne .L239
+.L240:
+	jmp .L240
+.L239:
+	mov %ecx,v4__dsindex
+.LBE184:
+.stabn 68,0,410,.LM2188-v4_spin_Minusunless
+.LM2188:
+	ret
+.Lfe184:
+	.size	 v4_spin_Minusunless,.Lfe184-v4_spin_Minusunless
+.stabn	192,0,0,.LBB184-v4_spin_Minusunless
+.stabn	224,0,0,.LBE184-v4_spin_Minusunless
+.Lscope184:
+.stabs	"",36,0,0,.Lscope184-v4_spin_Minusunless
+.text
+	.align 4
+.stabs "v4_merge_Minusloop:F1",36,0,0,v4_merge_Minusloop
+.globl v4_merge_Minusloop
+	.type	v4_merge_Minusloop,@function
+v4_merge_Minusloop:
+.stabn 68,0,411,.LMa2189-v4_merge_Minusloop
+.LMa2189:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,411,.LMb2189-v4_merge_Minusloop
+.LMb2189:
+.LBB185:
+	mov v4__dsindex,%ecx
+.L243:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $10,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS302
+	call v4__dscheck
+.LDS302:
+	cmp %edx,%eax
+	jge .L245
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	add %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS303
+	call v4__dscheck
+.LDS303:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS304
+	call v4__dscheck
+.LDS304:
+	jmp .L243
+.L245:
+	mov $100,%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS305
+	call v4__dscheck
+.LDS305:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS306
+	call v4__dscheck
+.LDS306:
+	mov %ecx,v4__dsindex
+.LBE185:
+.stabn 68,0,412,.LM2222-v4_merge_Minusloop
+.LM2222:
+	pop %ebx
+	leave
+	ret
+.Lfe185:
+	.size	 v4_merge_Minusloop,.Lfe185-v4_merge_Minusloop
+.stabn	192,0,0,.LBB185-v4_merge_Minusloop
+.stabn	224,0,0,.LBE185-v4_merge_Minusloop
+.Lscope185:
+.stabs	"",36,0,0,.Lscope185-v4_merge_Minusloop
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,9,.LMa2223-main
+.LMa2223:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	push %esi
+	sub $16,%esp
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,9,.LMb2223-main
+.LMb2223:
+.LBB1:
+	lea .LC0,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $17,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS307
+	call v4__dscheck
+.LDS307:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS308
+	call v4__dscheck
+.LDS308:
+	mov %ecx,v4__dsindex
+	call v4__strictansi
+	call v4_Store
+.stabn 68,0,12,.LM2235-main
+.LM2235:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_invert,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS309
+	call v4__dscheck
+.LDS309:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,(v4_max_Minusuint)
+.stabn 68,0,13,.LM2242-main
+.LM2242:
+	mov (v4_max_Minusuint),%eax
+	cmp $4080,%ecx
+	jbe .LDS310
+	call v4__dscheck
+.LDS310:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_rshift,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS311
+	call v4__dscheck
+.LDS311:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,(v4_max_Minusint)
+.stabn 68,0,14,.LM2251-main
+.LM2251:
+	mov (v4_max_Minusint),%eax
+	cmp $4080,%ecx
+	jbe .LDS312
+	call v4__dscheck
+.LDS312:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_invert,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS313
+	call v4__dscheck
+.LDS313:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	mov %eax,(v4_min_Minusint)
+.stabn 68,0,15,.LM2258-main
+.LM2258:
+	xor %eax,%eax
+	mov %eax,(v4_Lessfalse_Greater)
+.stabn 68,0,16,.LM2262-main
+.LM2262:
+	mov (v4_max_Minusuint),%eax
+	mov %eax,(v4_Lesstrue_Greater)
+.stabn 68,0,19,.LM2266-main
+.LM2266:
+	lea .LC1,%eax
+	cmp $4080,%ecx
+	jbe .LDS314
+	call v4__dscheck
+.LDS314:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $38,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS315
+	call v4__dscheck
+.LDS315:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,38,.LM2272-main
+.LM2272:
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS316
+	call v4__dscheck
+.LDS316:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,21,.LM2276-main
+.LM2276:
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,38,.LM2278-main
+.LM2278:
+	cmp $4080,%ecx
+	jbe .LDS317
+	call v4__dscheck
+.LDS317:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS318
+	call v4__dscheck
+.LDS318:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,39,.LM2282-main
+.LM2282:
+	mov $110,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS319
+	call v4__dscheck
+.LDS319:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,22,.LM2286-main
+.LM2286:
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,39,.LM2288-main
+.LM2288:
+	cmp $4080,%ecx
+	jbe .LDS320
+	call v4__dscheck
+.LDS320:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_max_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS321
+	call v4__dscheck
+.LDS321:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,40,.LM2292-main
+.LM2292:
+	mov $120,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS322
+	call v4__dscheck
+.LDS322:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,23,.LM2296-main
+.LM2296:
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,40,.LM2298-main
+.LM2298:
+	cmp $4080,%ecx
+	jbe .LDS323
+	call v4__dscheck
+.LDS323:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS324
+	call v4__dscheck
+.LDS324:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,41,.LM2302-main
+.LM2302:
+	mov $130,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS325
+	call v4__dscheck
+.LDS325:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,24,.LM2306-main
+.LM2306:
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,41,.LM2308-main
+.LM2308:
+	cmp $4080,%ecx
+	jbe .LDS326
+	call v4__dscheck
+.LDS326:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS327
+	call v4__dscheck
+.LDS327:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,42,.LM2312-main
+.LM2312:
+	mov $140,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS328
+	call v4__dscheck
+.LDS328:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,29,.LM2316-main
+.LM2316:
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,42,.LM2318-main
+.LM2318:
+	cmp $4080,%ecx
+	jbe .LDS329
+	call v4__dscheck
+.LDS329:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS330
+	call v4__dscheck
+.LDS330:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,43,.LM2322-main
+.LM2322:
+	mov $150,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS331
+	call v4__dscheck
+.LDS331:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,30,.LM2326-main
+.LM2326:
+	mov $2147483647,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,43,.LM2328-main
+.LM2328:
+	cmp $4080,%ecx
+	jbe .LDS332
+	call v4__dscheck
+.LDS332:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_max_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS333
+	call v4__dscheck
+.LDS333:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,44,.LM2332-main
+.LM2332:
+	mov $160,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS334
+	call v4__dscheck
+.LDS334:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,32,.LM2336-main
+.LM2336:
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,44,.LM2338-main
+.LM2338:
+	cmp $4080,%ecx
+	jbe .LDS335
+	call v4__dscheck
+.LDS335:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS336
+	call v4__dscheck
+.LDS336:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,45,.LM2342-main
+.LM2342:
+	mov $170,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS337
+	call v4__dscheck
+.LDS337:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,33,.LM2346-main
+.LM2346:
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,45,.LM2348-main
+.LM2348:
+	cmp $4080,%ecx
+	jbe .LDS338
+	call v4__dscheck
+.LDS338:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS339
+	call v4__dscheck
+.LDS339:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,46,.LM2352-main
+.LM2352:
+	mov $180,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS340
+	call v4__dscheck
+.LDS340:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,34,.LM2356-main
+.LM2356:
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,46,.LM2362-main
+.LM2362:
+	cmp $4080,%ecx
+	jbe .LDS341
+	call v4__dscheck
+.LDS341:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS342
+	call v4__dscheck
+.LDS342:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,47,.LM2370-main
+.LM2370:
+	mov $190,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS343
+	call v4__dscheck
+.LDS343:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,35,.LM2374-main
+.LM2374:
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,47,.LM2376-main
+.LM2376:
+	cmp $4080,%ecx
+	jbe .LDS344
+	call v4__dscheck
+.LDS344:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS345
+	call v4__dscheck
+.LDS345:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,48,.LM2380-main
+.LM2380:
+	mov $200,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS346
+	call v4__dscheck
+.LDS346:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,36,.LM2384-main
+.LM2384:
+	mov (v4_max_Minusuint),%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,48,.LM2393-main
+.LM2393:
+	cmp $4080,%ecx
+	jbe .LDS347
+	call v4__dscheck
+.LDS347:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS348
+	call v4__dscheck
+.LDS348:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,49,.LM2397-main
+.LM2397:
+	mov $210,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS349
+	call v4__dscheck
+.LDS349:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $20,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS350
+	call v4__dscheck
+.LDS350:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $20,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS351
+	call v4__dscheck
+.LDS351:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,50,.LM2412-main
+.LM2412:
+	mov $220,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS352
+	call v4__dscheck
+.LDS352:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS353
+	call v4__dscheck
+.LDS353:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS354
+	call v4__dscheck
+.LDS354:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,53,.LM2424-main
+.LM2424:
+	lea .LC2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $18,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS355
+	call v4__dscheck
+.LDS355:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,65,.LM2430-main
+.LM2430:
+	mov $1600,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS356
+	call v4__dscheck
+.LDS356:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $1000000,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS357
+	call v4__dscheck
+.LDS357:
+	mov %ecx,v4__dsindex
+	call v4_countdown
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS358
+	call v4__dscheck
+.LDS358:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,66,.LM2440-main
+.LM2440:
+	mov $1610,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS359
+	call v4__dscheck
+.LDS359:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $60000,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS360
+	call v4__dscheck
+.LDS360:
+	mov %ecx,v4__dsindex
+	call v4_sumto
+	call v4_Minus_Greater
+	mov $1800030000,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS361
+	call v4__dscheck
+.LDS361:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,67,.LM2452-main
+.LM2452:
+	mov $1620,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS362
+	call v4__dscheck
+.LDS362:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,67,.LM2461-main
+.LM2461:
+	cmp $4080,%ecx
+	jbe .LDS363
+	call v4__dscheck
+.LDS363:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS364
+	call v4__dscheck
+.LDS364:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,68,.LM2465-main
+.LM2465:
+	mov $1630,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS365
+	call v4__dscheck
+.LDS365:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,60,.LM2471-main
+.LM2471:
+	cmp $4080,%ecx
+	jbe .LDS366
+	call v4__dscheck
+.LDS366:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS367
+	call v4__dscheck
+.LDS367:
+	test %eax,%eax
+	jge .L258
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	neg %eax
+	cmp $4080,%ecx
+	jbe .LDS368
+	call v4__dscheck
+.LDS368:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS369
+	call v4__dscheck
+.LDS369:
+	jmp .L259
+.L258:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %eax,%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS370
+	call v4__dscheck
+.LDS370:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS371
+	call v4__dscheck
+.LDS371:
+.L259:
+.stabn 68,0,68,.LM2493-main
+.LM2493:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS372
+	call v4__dscheck
+.LDS372:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,69,.LM2497-main
+.LM2497:
+	mov $1640,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS373
+	call v4__dscheck
+.LDS373:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,60,.LM2503-main
+.LM2503:
+	cmp $4080,%ecx
+	jbe .LDS374
+	call v4__dscheck
+.LDS374:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS375
+	call v4__dscheck
+.LDS375:
+	test %eax,%eax
+	jge .L260
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	neg %eax
+	cmp $4080,%ecx
+	jbe .LDS376
+	call v4__dscheck
+.LDS376:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS377
+	call v4__dscheck
+.LDS377:
+	jmp .L261
+.L260:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %eax,%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS378
+	call v4__dscheck
+.LDS378:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS379
+	call v4__dscheck
+.LDS379:
+.L261:
+.stabn 68,0,69,.LM2525-main
+.LM2525:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS380
+	call v4__dscheck
+.LDS380:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,70,.LM2529-main
+.LM2529:
+	mov $1650,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS381
+	call v4__dscheck
+.LDS381:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	mov %eax,-12(%ebp)
+	mov $3,%eax
+	mov %eax,%esi
+	mov -12(%ebp),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,70,.LM2553-main
+.LM2553:
+	cmp $4080,%ecx
+	jbe .LDS382
+	call v4__dscheck
+.LDS382:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS383
+	call v4__dscheck
+.LDS383:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,71,.LM2557-main
+.LM2557:
+	mov $1660,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS384
+	call v4__dscheck
+.LDS384:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_tail_Minusloop
+	call v4_Minus_Greater
+	mov $11,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS385
+	call v4__dscheck
+.LDS385:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,72,.LM2565-main
+.LM2565:
+	mov $1670,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS386
+	call v4__dscheck
+.LDS386:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_tail1,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,63,.LM2573-main
+.LM2573:
+	cmp $4080,%ecx
+	jbe .LDS387
+	call v4__dscheck
+.LDS387:
+	mov %ecx,v4__dsindex
+	call v4_execute
+.stabn 68,0,72,.LM2574-main
+.LM2574:
+	call v4_Minus_Greater
+	mov $11,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS388
+	call v4__dscheck
+.LDS388:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,75,.LM2578-main
+.LM2578:
+	lea .LC3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $18,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS389
+	call v4__dscheck
+.LDS389:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,86,.LM2584-main
+.LM2584:
+	mov $1700,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS390
+	call v4__dscheck
+.LDS390:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,77,.LM2590-main
+.LM2590:
+	cmp $4080,%ecx
+	jbe .LDS391
+	call v4__dscheck
+.LDS391:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	call v4_Star
+.stabn 68,0,86,.LM2592-main
+.LM2592:
+	call v4_Minus_Greater
+	mov $49,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS392
+	call v4__dscheck
+.LDS392:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,87,.LM2596-main
+.LM2596:
+	mov $1710,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS393
+	call v4__dscheck
+.LDS393:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,78,.LM2604-main
+.LM2604:
+	cmp $4080,%ecx
+	jbe .LDS394
+	call v4__dscheck
+.LDS394:
+	mov %ecx,v4__dsindex
+	call v4_z2dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS395
+	call v4__dscheck
+.LDS395:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,87,.LM2610-main
+.LM2610:
+	cmp $4080,%ecx
+	jbe .LDS396
+	call v4__dscheck
+.LDS396:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $5,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS397
+	call v4__dscheck
+.LDS397:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,88,.LM2618-main
+.LM2618:
+	mov $1720,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS398
+	call v4__dscheck
+.LDS398:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_leaf_Minusloop
+	call v4_Minus_Greater
+	mov $45,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS399
+	call v4__dscheck
+.LDS399:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,89,.LM2626-main
+.LM2626:
+	mov $1730,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS400
+	call v4__dscheck
+.LDS400:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_leaf_Minusnested
+	call v4_Minus_Greater
+	mov $138,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS401
+	call v4__dscheck
+.LDS401:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,90,.LM2634-main
+.LM2634:
+	mov $1740,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS402
+	call v4__dscheck
+.LDS402:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $6,%eax
+	mov %eax,-12(%ebp)
+	mov -12(%ebp),%eax
+	mov %eax,%esi
+	mov -12(%ebp),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	add %edx,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,90,.LM2654-main
+.LM2654:
+	cmp $4080,%ecx
+	jbe .LDS403
+	call v4__dscheck
+.LDS403:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $12,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS404
+	call v4__dscheck
+.LDS404:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,91,.LM2658-main
+.LM2658:
+	mov $1750,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS405
+	call v4__dscheck
+.LDS405:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $42,%eax
+	mov %eax,(v4_leaf_Minusvar)
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,91,.LM2675-main
+.LM2675:
+	cmp $4080,%ecx
+	jbe .LDS406
+	call v4__dscheck
+.LDS406:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $42,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS407
+	call v4__dscheck
+.LDS407:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,92,.LM2679-main
+.LM2679:
+	mov $1760,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS408
+	call v4__dscheck
+.LDS408:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_leaf1,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS409
+	call v4__dscheck
+.LDS409:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Minus_Greater
+	mov $49,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS410
+	call v4__dscheck
+.LDS410:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,93,.LM2691-main
+.LM2691:
+	mov $1770,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS411
+	call v4__dscheck
+.LDS411:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_leaf2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS412
+	call v4__dscheck
+.LDS412:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $5,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS413
+	call v4__dscheck
+.LDS413:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,96,.LM2709-main
+.LM2709:
+	lea .LC4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $26,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS414
+	call v4__dscheck
+.LDS414:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,114,.LM2715-main
+.LM2715:
+	mov $300,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS415
+	call v4__dscheck
+.LDS415:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%esi
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jge .L262
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS416
+	call v4__dscheck
+.LDS416:
+	jmp .L263
+.L262:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS417
+	call v4__dscheck
+.LDS417:
+.L263:
+.stabn 68,0,114,.LM2736-main
+.LM2736:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS418
+	call v4__dscheck
+.LDS418:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,115,.LM2740-main
+.LM2740:
+	mov $310,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS419
+	call v4__dscheck
+.LDS419:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov %eax,%esi
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jge .L264
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS420
+	call v4__dscheck
+.LDS420:
+	jmp .L265
+.L264:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS421
+	call v4__dscheck
+.LDS421:
+.L265:
+.stabn 68,0,115,.LM2761-main
+.LM2761:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS422
+	call v4__dscheck
+.LDS422:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,116,.LM2765-main
+.LM2765:
+	mov $320,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS423
+	call v4__dscheck
+.LDS423:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%esi
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jge .L266
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS424
+	call v4__dscheck
+.LDS424:
+	jmp .L267
+.L266:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS425
+	call v4__dscheck
+.LDS425:
+.L267:
+.stabn 68,0,116,.LM2786-main
+.LM2786:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS426
+	call v4__dscheck
+.LDS426:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,117,.LM2790-main
+.LM2790:
+	mov $330,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS427
+	call v4__dscheck
+.LDS427:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%esi
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jle .L268
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS428
+	call v4__dscheck
+.LDS428:
+	jmp .L269
+.L268:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS429
+	call v4__dscheck
+.LDS429:
+.L269:
+.stabn 68,0,117,.LM2811-main
+.LM2811:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS430
+	call v4__dscheck
+.LDS430:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,118,.LM2815-main
+.LM2815:
+	mov $340,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS431
+	call v4__dscheck
+.LDS431:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov %eax,%esi
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jle .L270
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS432
+	call v4__dscheck
+.LDS432:
+	jmp .L271
+.L270:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS433
+	call v4__dscheck
+.LDS433:
+.L271:
+.stabn 68,0,118,.LM2836-main
+.LM2836:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS434
+	call v4__dscheck
+.LDS434:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,119,.LM2840-main
+.LM2840:
+	mov $350,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS435
+	call v4__dscheck
+.LDS435:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jne .L272
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS436
+	call v4__dscheck
+.LDS436:
+	jmp .L273
+.L272:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS437
+	call v4__dscheck
+.LDS437:
+.L273:
+.stabn 68,0,119,.LM2861-main
+.LM2861:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS438
+	call v4__dscheck
+.LDS438:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,120,.LM2865-main
+.LM2865:
+	mov $360,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS439
+	call v4__dscheck
+.LDS439:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%esi
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jne .L274
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS440
+	call v4__dscheck
+.LDS440:
+	jmp .L275
+.L274:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS441
+	call v4__dscheck
+.LDS441:
+.L275:
+.stabn 68,0,120,.LM2886-main
+.LM2886:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS442
+	call v4__dscheck
+.LDS442:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,121,.LM2890-main
+.LM2890:
+	mov $370,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS443
+	call v4__dscheck
+.LDS443:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%esi
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	je .L276
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS444
+	call v4__dscheck
+.LDS444:
+	jmp .L277
+.L276:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS445
+	call v4__dscheck
+.LDS445:
+.L277:
+.stabn 68,0,121,.LM2911-main
+.LM2911:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS446
+	call v4__dscheck
+.LDS446:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,122,.LM2915-main
+.LM2915:
+	mov $380,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS447
+	call v4__dscheck
+.LDS447:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	je .L278
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS448
+	call v4__dscheck
+.LDS448:
+	jmp .L279
+.L278:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS449
+	call v4__dscheck
+.LDS449:
+.L279:
+.stabn 68,0,122,.LM2936-main
+.LM2936:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS450
+	call v4__dscheck
+.LDS450:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,123,.LM2940-main
+.LM2940:
+	mov $390,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS451
+	call v4__dscheck
+.LDS451:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%esi
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jae .L280
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS452
+	call v4__dscheck
+.LDS452:
+	jmp .L281
+.L280:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS453
+	call v4__dscheck
+.LDS453:
+.L281:
+.stabn 68,0,123,.LM2961-main
+.LM2961:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS454
+	call v4__dscheck
+.LDS454:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,124,.LM2965-main
+.LM2965:
+	mov $400,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS455
+	call v4__dscheck
+.LDS455:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov %eax,%esi
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jae .L282
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS456
+	call v4__dscheck
+.LDS456:
+	jmp .L283
+.L282:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS457
+	call v4__dscheck
+.LDS457:
+.L283:
+.stabn 68,0,124,.LM2986-main
+.LM2986:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS458
+	call v4__dscheck
+.LDS458:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,125,.LM2990-main
+.LM2990:
+	mov $410,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS459
+	call v4__dscheck
+.LDS459:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%esi
+	mov (v4_max_Minusuint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jae .L284
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS460
+	call v4__dscheck
+.LDS460:
+	jmp .L285
+.L284:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS461
+	call v4__dscheck
+.LDS461:
+.L285:
+.stabn 68,0,125,.LM3011-main
+.LM3011:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS462
+	call v4__dscheck
+.LDS462:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,126,.LM3015-main
+.LM3015:
+	mov $420,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS463
+	call v4__dscheck
+.LDS463:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%esi
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jbe .L286
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS464
+	call v4__dscheck
+.LDS464:
+	jmp .L287
+.L286:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS465
+	call v4__dscheck
+.LDS465:
+.L287:
+.stabn 68,0,126,.LM3036-main
+.LM3036:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS466
+	call v4__dscheck
+.LDS466:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,127,.LM3040-main
+.LM3040:
+	mov $430,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS467
+	call v4__dscheck
+.LDS467:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusuint),%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jbe .L288
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS468
+	call v4__dscheck
+.LDS468:
+	jmp .L289
+.L288:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS469
+	call v4__dscheck
+.LDS469:
+.L289:
+.stabn 68,0,127,.LM3061-main
+.LM3061:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS470
+	call v4__dscheck
+.LDS470:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,128,.LM3065-main
+.LM3065:
+	mov $440,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS471
+	call v4__dscheck
+.LDS471:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	ja .L290
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS472
+	call v4__dscheck
+.LDS472:
+	jmp .L291
+.L290:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS473
+	call v4__dscheck
+.LDS473:
+.L291:
+.stabn 68,0,128,.LM3086-main
+.LM3086:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS474
+	call v4__dscheck
+.LDS474:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,129,.LM3090-main
+.LM3090:
+	mov $450,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS475
+	call v4__dscheck
+.LDS475:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%esi
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	ja .L292
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS476
+	call v4__dscheck
+.LDS476:
+	jmp .L293
+.L292:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS477
+	call v4__dscheck
+.LDS477:
+.L293:
+.stabn 68,0,129,.LM3111-main
+.LM3111:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS478
+	call v4__dscheck
+.LDS478:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,130,.LM3115-main
+.LM3115:
+	mov $460,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS479
+	call v4__dscheck
+.LDS479:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov %eax,%esi
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jb .L294
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS480
+	call v4__dscheck
+.LDS480:
+	jmp .L295
+.L294:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS481
+	call v4__dscheck
+.LDS481:
+.L295:
+.stabn 68,0,130,.LM3136-main
+.LM3136:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS482
+	call v4__dscheck
+.LDS482:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,131,.LM3140-main
+.LM3140:
+	mov $470,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS483
+	call v4__dscheck
+.LDS483:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusuint),%eax
+	mov %eax,%esi
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jb .L296
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS484
+	call v4__dscheck
+.LDS484:
+	jmp .L297
+.L296:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS485
+	call v4__dscheck
+.LDS485:
+.L297:
+.stabn 68,0,131,.LM3161-main
+.LM3161:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS486
+	call v4__dscheck
+.LDS486:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,132,.LM3165-main
+.LM3165:
+	mov $480,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS487
+	call v4__dscheck
+.LDS487:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	jne .L298
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS488
+	call v4__dscheck
+.LDS488:
+	jmp .L299
+.L298:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS489
+	call v4__dscheck
+.LDS489:
+.L299:
+.stabn 68,0,132,.LM3183-main
+.LM3183:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS490
+	call v4__dscheck
+.LDS490:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,133,.LM3187-main
+.LM3187:
+	mov $490,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS491
+	call v4__dscheck
+.LDS491:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	test %eax,%eax
+	jne .L300
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS492
+	call v4__dscheck
+.LDS492:
+	jmp .L301
+.L300:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS493
+	call v4__dscheck
+.LDS493:
+.L301:
+.stabn 68,0,133,.LM3205-main
+.LM3205:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS494
+	call v4__dscheck
+.LDS494:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,134,.LM3209-main
+.LM3209:
+	mov $500,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS495
+	call v4__dscheck
+.LDS495:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	test %eax,%eax
+	jge .L302
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS496
+	call v4__dscheck
+.LDS496:
+	jmp .L303
+.L302:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS497
+	call v4__dscheck
+.LDS497:
+.L303:
+.stabn 68,0,134,.LM3227-main
+.LM3227:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS498
+	call v4__dscheck
+.LDS498:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,135,.LM3231-main
+.LM3231:
+	mov $510,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS499
+	call v4__dscheck
+.LDS499:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov v4__dsindex,%ecx
+	test %eax,%eax
+	jge .L304
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS500
+	call v4__dscheck
+.LDS500:
+	jmp .L305
+.L304:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS501
+	call v4__dscheck
+.LDS501:
+.L305:
+.stabn 68,0,135,.LM3249-main
+.LM3249:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS502
+	call v4__dscheck
+.LDS502:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,136,.LM3253-main
+.LM3253:
+	mov $520,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS503
+	call v4__dscheck
+.LDS503:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	test %eax,%eax
+	jle .L306
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS504
+	call v4__dscheck
+.LDS504:
+	jmp .L307
+.L306:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS505
+	call v4__dscheck
+.LDS505:
+.L307:
+.stabn 68,0,136,.LM3271-main
+.LM3271:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS506
+	call v4__dscheck
+.LDS506:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,137,.LM3275-main
+.LM3275:
+	mov $530,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS507
+	call v4__dscheck
+.LDS507:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov v4__dsindex,%ecx
+	test %eax,%eax
+	jle .L308
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS508
+	call v4__dscheck
+.LDS508:
+	jmp .L309
+.L308:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS509
+	call v4__dscheck
+.LDS509:
+.L309:
+.stabn 68,0,137,.LM3293-main
+.LM3293:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS510
+	call v4__dscheck
+.LDS510:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,138,.LM3297-main
+.LM3297:
+	mov $540,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS511
+	call v4__dscheck
+.LDS511:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	mov %eax,%esi
+.stabn 68,0,109,.LM3303-main
+.LM3303:
+	mov $5,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jge .L310
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS512
+	call v4__dscheck
+.LDS512:
+	jmp .L311
+.L310:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS513
+	call v4__dscheck
+.LDS513:
+.L311:
+.stabn 68,0,138,.LM3318-main
+.LM3318:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS514
+	call v4__dscheck
+.LDS514:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,139,.LM3322-main
+.LM3322:
+	mov $550,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS515
+	call v4__dscheck
+.LDS515:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov %eax,%esi
+.stabn 68,0,109,.LM3328-main
+.LM3328:
+	mov $5,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jge .L312
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS516
+	call v4__dscheck
+.LDS516:
+	jmp .L313
+.L312:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS517
+	call v4__dscheck
+.LDS517:
+.L313:
+.stabn 68,0,139,.LM3343-main
+.LM3343:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS518
+	call v4__dscheck
+.LDS518:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,140,.LM3347-main
+.LM3347:
+	mov $560,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS519
+	call v4__dscheck
+.LDS519:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%esi
+.stabn 68,0,109,.LM3353-main
+.LM3353:
+	mov $5,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jge .L314
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS520
+	call v4__dscheck
+.LDS520:
+	jmp .L315
+.L314:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS521
+	call v4__dscheck
+.LDS521:
+.L315:
+.stabn 68,0,140,.LM3368-main
+.LM3368:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS522
+	call v4__dscheck
+.LDS522:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,141,.LM3372-main
+.LM3372:
+	mov $570,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS523
+	call v4__dscheck
+.LDS523:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov %eax,%esi
+.stabn 68,0,109,.LM3378-main
+.LM3378:
+	mov $5,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	mov v4__dsindex,%ecx
+	cmp %edx,%eax
+	jge .L316
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS524
+	call v4__dscheck
+.LDS524:
+	jmp .L317
+.L316:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS525
+	call v4__dscheck
+.LDS525:
+.L317:
+.stabn 68,0,141,.LM3393-main
+.LM3393:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS526
+	call v4__dscheck
+.LDS526:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,142,.LM3397-main
+.LM3397:
+	mov $580,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS527
+	call v4__dscheck
+.LDS527:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,110,.LM3403-main
+.LM3403:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS528
+	call v4__dscheck
+.LDS528:
+.L318:
+	mov %ecx,v4__dsindex
+	call v4_over
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS529
+	call v4__dscheck
+.LDS529:
+	test %eax,%eax
+	jle .L319
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS530
+	call v4__dscheck
+.LDS530:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS531
+	call v4__dscheck
+.LDS531:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	dec %eax
+	cmp $4080,%ecx
+	jbe .LDS532
+	call v4__dscheck
+.LDS532:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS533
+	call v4__dscheck
+.LDS533:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L318
+.L319:
+	mov %ecx,v4__dsindex
+	call v4_nip
+.stabn 68,0,142,.LM3425-main
+.LM3425:
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS534
+	call v4__dscheck
+.LDS534:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,143,.LM3429-main
+.LM3429:
+	mov $590,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS535
+	call v4__dscheck
+.LDS535:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,110,.LM3435-main
+.LM3435:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS536
+	call v4__dscheck
+.LDS536:
+.L320:
+	mov %ecx,v4__dsindex
+	call v4_over
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS537
+	call v4__dscheck
+.LDS537:
+	test %eax,%eax
+	jle .L321
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS538
+	call v4__dscheck
+.LDS538:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS539
+	call v4__dscheck
+.LDS539:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	dec %eax
+	cmp $4080,%ecx
+	jbe .LDS540
+	call v4__dscheck
+.LDS540:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS541
+	call v4__dscheck
+.LDS541:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L320
+.L321:
+	mov %ecx,v4__dsindex
+	call v4_nip
+.stabn 68,0,143,.LM3457-main
+.LM3457:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS542
+	call v4__dscheck
+.LDS542:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,144,.LM3461-main
+.LM3461:
+	mov $600,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS543
+	call v4__dscheck
+.LDS543:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,110,.LM3467-main
+.LM3467:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS544
+	call v4__dscheck
+.LDS544:
+.L322:
+	mov %ecx,v4__dsindex
+	call v4_over
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS545
+	call v4__dscheck
+.LDS545:
+	test %eax,%eax
+	jle .L323
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS546
+	call v4__dscheck
+.LDS546:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS547
+	call v4__dscheck
+.LDS547:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	dec %eax
+	cmp $4080,%ecx
+	jbe .LDS548
+	call v4__dscheck
+.LDS548:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS549
+	call v4__dscheck
+.LDS549:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	mov v4__dsindex,%ecx
+	jmp .L322
+.L323:
+	mov %ecx,v4__dsindex
+	call v4_nip
+.stabn 68,0,144,.LM3489-main
+.LM3489:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS550
+	call v4__dscheck
+.LDS550:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,145,.LM3493-main
+.LM3493:
+	mov $610,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS551
+	call v4__dscheck
+.LDS551:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,111,.LM3499-main
+.LM3499:
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS552
+	call v4__dscheck
+.LDS552:
+.L324:
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS553
+	call v4__dscheck
+.LDS553:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS554
+	call v4__dscheck
+.LDS554:
+	mov %ecx,v4__dsindex
+	call v4_z2dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS555
+	call v4__dscheck
+.LDS555:
+	cmp %edx,%eax
+	jne .L324
+	mov %ecx,v4__dsindex
+	call v4_nip
+.stabn 68,0,145,.LM3514-main
+.LM3514:
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS556
+	call v4__dscheck
+.LDS556:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,146,.LM3518-main
+.LM3518:
+	mov $620,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS557
+	call v4__dscheck
+.LDS557:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	mov $2,%eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS558
+	call v4__dscheck
+.LDS558:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS559
+	call v4__dscheck
+.LDS559:
+	test %eax,%eax
+	je .L325
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov (v4_Lesstrue_Greater),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS560
+	call v4__dscheck
+.LDS560:
+.L325:
+.stabn 68,0,146,.LM3538-main
+.LM3538:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_Lesstrue_Greater),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS561
+	call v4__dscheck
+.LDS561:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,147,.LM3542-main
+.LM3542:
+	mov $630,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS562
+	call v4__dscheck
+.LDS562:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,%esi
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %esi,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS563
+	call v4__dscheck
+.LDS563:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS564
+	call v4__dscheck
+.LDS564:
+	test %eax,%eax
+	je .L326
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov (v4_Lesstrue_Greater),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS565
+	call v4__dscheck
+.LDS565:
+.L326:
+.stabn 68,0,147,.LM3562-main
+.LM3562:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS566
+	call v4__dscheck
+.LDS566:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,150,.LM3566-main
+.LM3566:
+	lea .LC5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $21,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS567
+	call v4__dscheck
+.LDS567:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,178,.LM3572-main
+.LM3572:
+	mov $700,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS568
+	call v4__dscheck
+.LDS568:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS569
+	call v4__dscheck
+.LDS569:
+	mov %ecx,v4__dsindex
+	call v4_dense
+	call v4_Minus_Greater
+	mov $99,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS570
+	call v4__dscheck
+.LDS570:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,179,.LM3582-main
+.LM3582:
+	mov $710,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS571
+	call v4__dscheck
+.LDS571:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS572
+	call v4__dscheck
+.LDS572:
+	mov %ecx,v4__dsindex
+	call v4_dense
+	call v4_Minus_Greater
+	mov $10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS573
+	call v4__dscheck
+.LDS573:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,180,.LM3592-main
+.LM3592:
+	mov $720,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS574
+	call v4__dscheck
+.LDS574:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS575
+	call v4__dscheck
+.LDS575:
+	mov %ecx,v4__dsindex
+	call v4_dense
+	call v4_Minus_Greater
+	mov $13,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS576
+	call v4__dscheck
+.LDS576:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,181,.LM3602-main
+.LM3602:
+	mov $730,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS577
+	call v4__dscheck
+.LDS577:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS578
+	call v4__dscheck
+.LDS578:
+	mov %ecx,v4__dsindex
+	call v4_dense
+	call v4_Minus_Greater
+	mov $15,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS579
+	call v4__dscheck
+.LDS579:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,182,.LM3612-main
+.LM3612:
+	mov $740,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS580
+	call v4__dscheck
+.LDS580:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS581
+	call v4__dscheck
+.LDS581:
+	mov %ecx,v4__dsindex
+	call v4_dense
+	call v4_Minus_Greater
+	mov $106,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS582
+	call v4__dscheck
+.LDS582:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,183,.LM3622-main
+.LM3622:
+	mov $750,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS583
+	call v4__dscheck
+.LDS583:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS584
+	call v4__dscheck
+.LDS584:
+	mov %ecx,v4__dsindex
+	call v4_dense
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $100,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Plus,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS585
+	call v4__dscheck
+.LDS585:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,184,.LM3637-main
+.LM3637:
+	mov $760,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS586
+	call v4__dscheck
+.LDS586:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS587
+	call v4__dscheck
+.LDS587:
+	mov %ecx,v4__dsindex
+	call v4_dense
+	call v4_Minus_Greater
+	mov (v4_max_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $100,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Plus,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS588
+	call v4__dscheck
+.LDS588:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,185,.LM3652-main
+.LM3652:
+	mov $770,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS589
+	call v4__dscheck
+.LDS589:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS590
+	call v4__dscheck
+.LDS590:
+	mov %ecx,v4__dsindex
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS591
+	call v4__dscheck
+.LDS591:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,186,.LM3662-main
+.LM3662:
+	mov $780,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS592
+	call v4__dscheck
+.LDS592:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS593
+	call v4__dscheck
+.LDS593:
+	mov %ecx,v4__dsindex
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS594
+	call v4__dscheck
+.LDS594:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,187,.LM3672-main
+.LM3672:
+	mov $790,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS595
+	call v4__dscheck
+.LDS595:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS596
+	call v4__dscheck
+.LDS596:
+	mov %ecx,v4__dsindex
+	call v4_gapped
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS597
+	call v4__dscheck
+.LDS597:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,188,.LM3682-main
+.LM3682:
+	mov $800,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS598
+	call v4__dscheck
+.LDS598:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS599
+	call v4__dscheck
+.LDS599:
+	mov %ecx,v4__dsindex
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS600
+	call v4__dscheck
+.LDS600:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,189,.LM3692-main
+.LM3692:
+	mov $810,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS601
+	call v4__dscheck
+.LDS601:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS602
+	call v4__dscheck
+.LDS602:
+	mov %ecx,v4__dsindex
+	call v4_gapped
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS603
+	call v4__dscheck
+.LDS603:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,190,.LM3702-main
+.LM3702:
+	mov $820,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS604
+	call v4__dscheck
+.LDS604:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS605
+	call v4__dscheck
+.LDS605:
+	mov %ecx,v4__dsindex
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS606
+	call v4__dscheck
+.LDS606:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,191,.LM3712-main
+.LM3712:
+	mov $830,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS607
+	call v4__dscheck
+.LDS607:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-1000,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS608
+	call v4__dscheck
+.LDS608:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS609
+	call v4__dscheck
+.LDS609:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,192,.LM3722-main
+.LM3722:
+	mov $840,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS610
+	call v4__dscheck
+.LDS610:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS611
+	call v4__dscheck
+.LDS611:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS612
+	call v4__dscheck
+.LDS612:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,193,.LM3732-main
+.LM3732:
+	mov $850,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS613
+	call v4__dscheck
+.LDS613:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS614
+	call v4__dscheck
+.LDS614:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS615
+	call v4__dscheck
+.LDS615:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,194,.LM3742-main
+.LM3742:
+	mov $860,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS616
+	call v4__dscheck
+.LDS616:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS617
+	call v4__dscheck
+.LDS617:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS618
+	call v4__dscheck
+.LDS618:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,195,.LM3752-main
+.LM3752:
+	mov $870,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS619
+	call v4__dscheck
+.LDS619:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $1000,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS620
+	call v4__dscheck
+.LDS620:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS621
+	call v4__dscheck
+.LDS621:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,196,.LM3762-main
+.LM3762:
+	mov $880,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS622
+	call v4__dscheck
+.LDS622:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $65536,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS623
+	call v4__dscheck
+.LDS623:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS624
+	call v4__dscheck
+.LDS624:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,197,.LM3772-main
+.LM3772:
+	mov $890,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS625
+	call v4__dscheck
+.LDS625:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-1001,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS626
+	call v4__dscheck
+.LDS626:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS627
+	call v4__dscheck
+.LDS627:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,198,.LM3782-main
+.LM3782:
+	mov $900,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS628
+	call v4__dscheck
+.LDS628:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS629
+	call v4__dscheck
+.LDS629:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS630
+	call v4__dscheck
+.LDS630:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,199,.LM3792-main
+.LM3792:
+	mov $910,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS631
+	call v4__dscheck
+.LDS631:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS632
+	call v4__dscheck
+.LDS632:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS633
+	call v4__dscheck
+.LDS633:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,200,.LM3802-main
+.LM3802:
+	mov $920,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS634
+	call v4__dscheck
+.LDS634:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $999,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS635
+	call v4__dscheck
+.LDS635:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS636
+	call v4__dscheck
+.LDS636:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,201,.LM3812-main
+.LM3812:
+	mov $930,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS637
+	call v4__dscheck
+.LDS637:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $65537,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS638
+	call v4__dscheck
+.LDS638:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS639
+	call v4__dscheck
+.LDS639:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,202,.LM3822-main
+.LM3822:
+	mov $940,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS640
+	call v4__dscheck
+.LDS640:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS641
+	call v4__dscheck
+.LDS641:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS642
+	call v4__dscheck
+.LDS642:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,203,.LM3832-main
+.LM3832:
+	mov $950,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS643
+	call v4__dscheck
+.LDS643:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS644
+	call v4__dscheck
+.LDS644:
+	mov %ecx,v4__dsindex
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS645
+	call v4__dscheck
+.LDS645:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,204,.LM3842-main
+.LM3842:
+	mov $960,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS646
+	call v4__dscheck
+.LDS646:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS647
+	call v4__dscheck
+.LDS647:
+	mov %ecx,v4__dsindex
+	call v4_nodefault
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,205,.LM3850-main
+.LM3850:
+	mov $970,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS648
+	call v4__dscheck
+.LDS648:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS649
+	call v4__dscheck
+.LDS649:
+	mov %ecx,v4__dsindex
+	call v4_nodefault
+	call v4_Minus_Greater
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS650
+	call v4__dscheck
+.LDS650:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,206,.LM3860-main
+.LM3860:
+	mov $980,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS651
+	call v4__dscheck
+.LDS651:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS652
+	call v4__dscheck
+.LDS652:
+	mov %ecx,v4__dsindex
+	call v4_nodefault
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,209,.LM3868-main
+.LM3868:
+	lea .LC6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $48,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS653
+	call v4__dscheck
+.LDS653:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,228,.LM3874-main
+.LM3874:
+	xor %eax,%eax
+	mov %eax,(v4_Hashdividends)
+.stabn 68,0,239,.LM3881-main
+.LM3881:
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS654
+	call v4__dscheck
+.LDS654:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS655
+	call v4__dscheck
+.LDS655:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS656
+	call v4__dscheck
+.LDS656:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS657
+	call v4__dscheck
+.LDS657:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+.stabn 68,0,240,.LM3893-main
+.LM3893:
+	mov $-2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS658
+	call v4__dscheck
+.LDS658:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS659
+	call v4__dscheck
+.LDS659:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS660
+	call v4__dscheck
+.LDS660:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS661
+	call v4__dscheck
+.LDS661:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+.stabn 68,0,241,.LM3905-main
+.LM3905:
+	mov $-100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS662
+	call v4__dscheck
+.LDS662:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+	mov $12345,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS663
+	call v4__dscheck
+.LDS663:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+	mov $-12345,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS664
+	call v4__dscheck
+.LDS664:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+.stabn 68,0,242,.LM3914-main
+.LM3914:
+	mov (v4_max_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS665
+	call v4__dscheck
+.LDS665:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+	mov (v4_max_Minusint),%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS666
+	call v4__dscheck
+.LDS666:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+.stabn 68,0,243,.LM3924-main
+.LM3924:
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS667
+	call v4__dscheck
+.LDS667:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+	mov (v4_min_Minusint),%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS668
+	call v4__dscheck
+.LDS668:
+	mov %ecx,v4__dsindex
+	call v4_dividend_Comma
+.stabn 68,0,245,.LM3934-main
+.LM3934:
+	mov $1000,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS669
+	call v4__dscheck
+.LDS669:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Slash1,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Slash,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS670
+	call v4__dscheck
+.LDS670:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS671
+	call v4__dscheck
+.LDS671:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,246,.LM3948-main
+.LM3948:
+	mov $1010,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS672
+	call v4__dscheck
+.LDS672:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_mod1,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_mod,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS673
+	call v4__dscheck
+.LDS673:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS674
+	call v4__dscheck
+.LDS674:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,247,.LM3962-main
+.LM3962:
+	mov $1020,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS675
+	call v4__dscheck
+.LDS675:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Slash2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Slash,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS676
+	call v4__dscheck
+.LDS676:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS677
+	call v4__dscheck
+.LDS677:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,248,.LM3976-main
+.LM3976:
+	mov $1030,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS678
+	call v4__dscheck
+.LDS678:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_mod2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $2,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_mod,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS679
+	call v4__dscheck
+.LDS679:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS680
+	call v4__dscheck
+.LDS680:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,249,.LM3990-main
+.LM3990:
+	mov $1040,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS681
+	call v4__dscheck
+.LDS681:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Slash3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Slash,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS682
+	call v4__dscheck
+.LDS682:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS683
+	call v4__dscheck
+.LDS683:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,250,.LM4004-main
+.LM4004:
+	mov $1050,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS684
+	call v4__dscheck
+.LDS684:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_mod3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_mod,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS685
+	call v4__dscheck
+.LDS685:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS686
+	call v4__dscheck
+.LDS686:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,251,.LM4018-main
+.LM4018:
+	mov $1060,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS687
+	call v4__dscheck
+.LDS687:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Slash_Minus3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Slash,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS688
+	call v4__dscheck
+.LDS688:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS689
+	call v4__dscheck
+.LDS689:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,252,.LM4032-main
+.LM4032:
+	mov $1070,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS690
+	call v4__dscheck
+.LDS690:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_mod_Minus3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_mod,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS691
+	call v4__dscheck
+.LDS691:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS692
+	call v4__dscheck
+.LDS692:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,253,.LM4046-main
+.LM4046:
+	mov $1080,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS693
+	call v4__dscheck
+.LDS693:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Slash7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $7,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Slash,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS694
+	call v4__dscheck
+.LDS694:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS695
+	call v4__dscheck
+.LDS695:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,254,.LM4060-main
+.LM4060:
+	mov $1090,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS696
+	call v4__dscheck
+.LDS696:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_mod7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $7,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_mod,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS697
+	call v4__dscheck
+.LDS697:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS698
+	call v4__dscheck
+.LDS698:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,255,.LM4074-main
+.LM4074:
+	mov $1100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS699
+	call v4__dscheck
+.LDS699:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Slash8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $8,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Slash,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS700
+	call v4__dscheck
+.LDS700:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS701
+	call v4__dscheck
+.LDS701:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,256,.LM4088-main
+.LM4088:
+	mov $1110,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS702
+	call v4__dscheck
+.LDS702:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_mod8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $8,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_mod,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS703
+	call v4__dscheck
+.LDS703:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS704
+	call v4__dscheck
+.LDS704:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,257,.LM4102-main
+.LM4102:
+	mov $1120,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS705
+	call v4__dscheck
+.LDS705:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Slash_Minus8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-8,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Slash,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS706
+	call v4__dscheck
+.LDS706:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS707
+	call v4__dscheck
+.LDS707:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,258,.LM4116-main
+.LM4116:
+	mov $1130,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS708
+	call v4__dscheck
+.LDS708:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_mod_Minus8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-8,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_mod,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS709
+	call v4__dscheck
+.LDS709:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS710
+	call v4__dscheck
+.LDS710:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,259,.LM4130-main
+.LM4130:
+	mov $1140,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS711
+	call v4__dscheck
+.LDS711:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Slash10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $10,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Slash,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS712
+	call v4__dscheck
+.LDS712:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS713
+	call v4__dscheck
+.LDS713:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,260,.LM4144-main
+.LM4144:
+	mov $1150,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS714
+	call v4__dscheck
+.LDS714:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_mod10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $10,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_mod,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS715
+	call v4__dscheck
+.LDS715:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS716
+	call v4__dscheck
+.LDS716:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,261,.LM4158-main
+.LM4158:
+	mov $1160,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS717
+	call v4__dscheck
+.LDS717:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Slash_Minus10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-10,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Slash,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS718
+	call v4__dscheck
+.LDS718:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS719
+	call v4__dscheck
+.LDS719:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,262,.LM4172-main
+.LM4172:
+	mov $1170,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS720
+	call v4__dscheck
+.LDS720:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_mod_Minus10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-10,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_mod,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS721
+	call v4__dscheck
+.LDS721:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS722
+	call v4__dscheck
+.LDS722:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,263,.LM4186-main
+.LM4186:
+	mov $1180,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS723
+	call v4__dscheck
+.LDS723:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Star0,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Star,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS724
+	call v4__dscheck
+.LDS724:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS725
+	call v4__dscheck
+.LDS725:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,264,.LM4200-main
+.LM4200:
+	mov $1190,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS726
+	call v4__dscheck
+.LDS726:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Star1,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Star,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS727
+	call v4__dscheck
+.LDS727:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS728
+	call v4__dscheck
+.LDS728:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,265,.LM4214-main
+.LM4214:
+	mov $1200,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS729
+	call v4__dscheck
+.LDS729:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Star_Minus1,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Star,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS730
+	call v4__dscheck
+.LDS730:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS731
+	call v4__dscheck
+.LDS731:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,266,.LM4228-main
+.LM4228:
+	mov $1210,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS732
+	call v4__dscheck
+.LDS732:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Star3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $3,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Star,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS733
+	call v4__dscheck
+.LDS733:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS734
+	call v4__dscheck
+.LDS734:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,267,.LM4242-main
+.LM4242:
+	mov $1220,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS735
+	call v4__dscheck
+.LDS735:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Star8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $8,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Star,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS736
+	call v4__dscheck
+.LDS736:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS737
+	call v4__dscheck
+.LDS737:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,268,.LM4256-main
+.LM4256:
+	mov $1230,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS738
+	call v4__dscheck
+.LDS738:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Star_Minus8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-8,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Star,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS739
+	call v4__dscheck
+.LDS739:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS740
+	call v4__dscheck
+.LDS740:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,269,.LM4270-main
+.LM4270:
+	mov $1240,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS741
+	call v4__dscheck
+.LDS741:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Star10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $10,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Star,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS742
+	call v4__dscheck
+.LDS742:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS743
+	call v4__dscheck
+.LDS743:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,270,.LM4284-main
+.LM4284:
+	mov $1250,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS744
+	call v4__dscheck
+.LDS744:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_Star_Minus7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-7,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Star,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS745
+	call v4__dscheck
+.LDS745:
+	mov %ecx,v4__dsindex
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS746
+	call v4__dscheck
+.LDS746:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,274,.LM4298-main
+.LM4298:
+	mov $1270,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS747
+	call v4__dscheck
+.LDS747:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,220,.LM4304-main
+.LM4304:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS748
+	call v4__dscheck
+.LDS748:
+	mov %ecx,v4__dsindex
+	call v4_Slash
+.stabn 68,0,274,.LM4307-main
+.LM4307:
+	call v4_Minus_Greater
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS749
+	call v4__dscheck
+.LDS749:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,275,.LM4311-main
+.LM4311:
+	mov $1280,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS750
+	call v4__dscheck
+.LDS750:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,220,.LM4317-main
+.LM4317:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS751
+	call v4__dscheck
+.LDS751:
+	mov %ecx,v4__dsindex
+	call v4_Slash
+.stabn 68,0,275,.LM4320-main
+.LM4320:
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS752
+	call v4__dscheck
+.LDS752:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,276,.LM4324-main
+.LM4324:
+	mov $1290,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS753
+	call v4__dscheck
+.LDS753:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,220,.LM4330-main
+.LM4330:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS754
+	call v4__dscheck
+.LDS754:
+	mov %ecx,v4__dsindex
+	call v4_Slash
+.stabn 68,0,276,.LM4333-main
+.LM4333:
+	call v4_Minus_Greater
+	mov (v4_max_Minusint),%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS755
+	call v4__dscheck
+.LDS755:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,277,.LM4341-main
+.LM4341:
+	mov $1300,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS756
+	call v4__dscheck
+.LDS756:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,220,.LM4351-main
+.LM4351:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS757
+	call v4__dscheck
+.LDS757:
+	mov %ecx,v4__dsindex
+	call v4_Slash
+.stabn 68,0,277,.LM4354-main
+.LM4354:
+	call v4_Minus_Greater
+	mov (v4_max_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS758
+	call v4__dscheck
+.LDS758:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,278,.LM4358-main
+.LM4358:
+	mov $1310,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS759
+	call v4__dscheck
+.LDS759:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,220,.LM4364-main
+.LM4364:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS760
+	call v4__dscheck
+.LDS760:
+	mov %ecx,v4__dsindex
+	call v4_mod
+.stabn 68,0,278,.LM4367-main
+.LM4367:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS761
+	call v4__dscheck
+.LDS761:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,279,.LM4371-main
+.LM4371:
+	mov $1320,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS762
+	call v4__dscheck
+.LDS762:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,220,.LM4381-main
+.LM4381:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS763
+	call v4__dscheck
+.LDS763:
+	mov %ecx,v4__dsindex
+	call v4_mod
+.stabn 68,0,279,.LM4384-main
+.LM4384:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS764
+	call v4__dscheck
+.LDS764:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,280,.LM4388-main
+.LM4388:
+	mov $1330,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS765
+	call v4__dscheck
+.LDS765:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $29,%edx
+	add %edx,%eax
+	sar $3,%eax
+	neg %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,280,.LM4400-main
+.LM4400:
+	cmp $4080,%ecx
+	jbe .LDS766
+	call v4__dscheck
+.LDS766:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $-8,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_Slash,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS767
+	call v4__dscheck
+.LDS767:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,281,.LM4409-main
+.LM4409:
+	mov $1340,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS768
+	call v4__dscheck
+.LDS768:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $12,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,281,.LM4416-main
+.LM4416:
+	cmp $4080,%ecx
+	jbe .LDS769
+	call v4__dscheck
+.LDS769:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_cells,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS770
+	call v4__dscheck
+.LDS770:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,282,.LM4423-main
+.LM4423:
+	mov $1350,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS771
+	call v4__dscheck
+.LDS771:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	inc %eax
+	shl $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,282,.LM4437-main
+.LM4437:
+	cmp $4080,%ecx
+	jbe .LDS772
+	call v4__dscheck
+.LDS772:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_cells,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS773
+	call v4__dscheck
+.LDS773:
+	mov %ecx,v4__dsindex
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,285,.LM4448-main
+.LM4448:
+	lea .LC7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $31,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS774
+	call v4__dscheck
+.LDS774:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,287,.LM4454-main
+.LM4454:
+	mov $100,%eax
+	mov %eax,(v4_hundred)
+.stabn 68,0,288,.LM4458-main
+.LM4458:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,(v4_minus_Minusone)
+.stabn 68,0,292,.LM4462-main
+.LM4462:
+	mov $2147483647,%eax
+	mov %eax,(v4_biggest)
+.stabn 68,0,294,.LM4466-main
+.LM4466:
+	mov $300,%eax
+	mov %eax,(v4_three_Minushundred)
+.stabn 68,0,295,.LM4473-main
+.LM4473:
+	xor %eax,%eax
+	mov %eax,(v4_zero)
+.stabn 68,0,309,.LM4477-main
+.LM4477:
+	mov $1400,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS775
+	call v4__dscheck
+.LDS775:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,297,.LM4481-main
+.LM4481:
+	mov $200,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,309,.LM4484-main
+.LM4484:
+	cmp $4080,%ecx
+	jbe .LDS776
+	call v4__dscheck
+.LDS776:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $200,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS777
+	call v4__dscheck
+.LDS777:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,310,.LM4488-main
+.LM4488:
+	mov $1410,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS778
+	call v4__dscheck
+.LDS778:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,298,.LM4492-main
+.LM4492:
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,310,.LM4497-main
+.LM4497:
+	cmp $4080,%ecx
+	jbe .LDS779
+	call v4__dscheck
+.LDS779:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS780
+	call v4__dscheck
+.LDS780:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,311,.LM4501-main
+.LM4501:
+	mov $1420,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS781
+	call v4__dscheck
+.LDS781:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,299,.LM4505-main
+.LM4505:
+	mov $-2147483648,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,311,.LM4508-main
+.LM4508:
+	cmp $4080,%ecx
+	jbe .LDS782
+	call v4__dscheck
+.LDS782:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS783
+	call v4__dscheck
+.LDS783:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,312,.LM4512-main
+.LM4512:
+	mov $1430,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS784
+	call v4__dscheck
+.LDS784:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,300,.LM4516-main
+.LM4516:
+	mov $301,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,312,.LM4519-main
+.LM4519:
+	cmp $4080,%ecx
+	jbe .LDS785
+	call v4__dscheck
+.LDS785:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $301,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS786
+	call v4__dscheck
+.LDS786:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,313,.LM4523-main
+.LM4523:
+	mov $1440,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS787
+	call v4__dscheck
+.LDS787:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS788
+	call v4__dscheck
+.LDS788:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $-100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS789
+	call v4__dscheck
+.LDS789:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,314,.LM4538-main
+.LM4538:
+	mov $1450,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS790
+	call v4__dscheck
+.LDS790:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS791
+	call v4__dscheck
+.LDS791:
+	mov %ecx,v4__dsindex
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS792
+	call v4__dscheck
+.LDS792:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,315,.LM4548-main
+.LM4548:
+	mov $1460,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS793
+	call v4__dscheck
+.LDS793:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS794
+	call v4__dscheck
+.LDS794:
+	mov %ecx,v4__dsindex
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS795
+	call v4__dscheck
+.LDS795:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,316,.LM4558-main
+.LM4558:
+	mov $1470,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS796
+	call v4__dscheck
+.LDS796:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS797
+	call v4__dscheck
+.LDS797:
+	mov %ecx,v4__dsindex
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS798
+	call v4__dscheck
+.LDS798:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,317,.LM4568-main
+.LM4568:
+	mov $1480,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS799
+	call v4__dscheck
+.LDS799:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS800
+	call v4__dscheck
+.LDS800:
+	mov %ecx,v4__dsindex
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS801
+	call v4__dscheck
+.LDS801:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,318,.LM4578-main
+.LM4578:
+	mov $1490,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS802
+	call v4__dscheck
+.LDS802:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS803
+	call v4__dscheck
+.LDS803:
+	mov %ecx,v4__dsindex
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS804
+	call v4__dscheck
+.LDS804:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,319,.LM4588-main
+.LM4588:
+	mov $1500,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS805
+	call v4__dscheck
+.LDS805:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	lea v4_use_Minuszero,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS806
+	call v4__dscheck
+.LDS806:
+	mov %ecx,v4__dsindex
+	call v4_catch
+	call v4_nip
+	call v4_Minus_Greater
+	mov $-10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS807
+	call v4__dscheck
+.LDS807:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,322,.LM4601-main
+.LM4601:
+	lea .LC8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $16,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS808
+	call v4__dscheck
+.LDS808:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,345,.LM4607-main
+.LM4607:
+	mov $1800,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS809
+	call v4__dscheck
+.LDS809:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $-7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $50,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $300,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,325,.LM4618-main
+.LM4618:
+	cmp $4080,%ecx
+	jbe .LDS810
+	call v4__dscheck
+.LDS810:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS811
+	call v4__dscheck
+.LDS811:
+	test %eax,%eax
+	jge .L350
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS812
+	call v4__dscheck
+.LDS812:
+	jmp .L352
+.L350:
+.stabn 68,0,326,.LM4629-main
+.LM4629:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS813
+	call v4__dscheck
+.LDS813:
+	cmp %edx,%eax
+	jle .L351
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS814
+	call v4__dscheck
+.LDS814:
+.L351:
+.L352:
+.stabn 68,0,336,.LM4644-main
+.LM4644:
+	mov %ecx,v4__dsindex
+	call v4_rot
+.stabn 68,0,325,.LM4646-main
+.LM4646:
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS815
+	call v4__dscheck
+.LDS815:
+	test %eax,%eax
+	jge .L353
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS816
+	call v4__dscheck
+.LDS816:
+	jmp .L355
+.L353:
+.stabn 68,0,326,.LM4657-main
+.LM4657:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS817
+	call v4__dscheck
+.LDS817:
+	cmp %edx,%eax
+	jle .L354
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS818
+	call v4__dscheck
+.LDS818:
+.L354:
+.L355:
+.stabn 68,0,336,.LM4672-main
+.LM4672:
+	mov %ecx,v4__dsindex
+	call v4_rot
+.stabn 68,0,325,.LM4674-main
+.LM4674:
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS819
+	call v4__dscheck
+.LDS819:
+	test %eax,%eax
+	jge .L356
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS820
+	call v4__dscheck
+.LDS820:
+	jmp .L358
+.L356:
+.stabn 68,0,326,.LM4685-main
+.LM4685:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS821
+	call v4__dscheck
+.LDS821:
+	cmp %edx,%eax
+	jle .L357
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS822
+	call v4__dscheck
+.LDS822:
+.L357:
+.L358:
+.stabn 68,0,336,.LM4700-main
+.LM4700:
+	mov %ecx,v4__dsindex
+	call v4_rot
+.stabn 68,0,345,.LM4701-main
+.LM4701:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $50,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $100,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS823
+	call v4__dscheck
+.LDS823:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,346,.LM4709-main
+.LM4709:
+	mov $1810,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS824
+	call v4__dscheck
+.LDS824:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,337,.LM4713-main
+.LM4713:
+	mov $-5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS825
+	call v4__dscheck
+.LDS825:
+	mov %ecx,v4__dsindex
+	call v4_sign
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS826
+	call v4__dscheck
+.LDS826:
+	mov %ecx,v4__dsindex
+	call v4_sign
+	mov (v4_min_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS827
+	call v4__dscheck
+.LDS827:
+	mov %ecx,v4__dsindex
+	call v4_sign
+.stabn 68,0,346,.LM4722-main
+.LM4722:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS828
+	call v4__dscheck
+.LDS828:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,347,.LM4730-main
+.LM4730:
+	mov $1820,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS829
+	call v4__dscheck
+.LDS829:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,338,.LM4736-main
+.LM4736:
+	cmp $4080,%ecx
+	jbe .LDS830
+	call v4__dscheck
+.LDS830:
+	mov %ecx,v4__dsindex
+	call v4_twice
+	call v4_twice
+.stabn 68,0,347,.LM4738-main
+.LM4738:
+	call v4_Minus_Greater
+	mov $12,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS831
+	call v4__dscheck
+.LDS831:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,348,.LM4742-main
+.LM4742:
+	mov $1830,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS832
+	call v4__dscheck
+.LDS832:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_sum_Minusi
+	call v4_Minus_Greater
+	mov $10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS833
+	call v4__dscheck
+.LDS833:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,349,.LM4750-main
+.LM4750:
+	mov $1840,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS834
+	call v4__dscheck
+.LDS834:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_sum_Minusi_Minusnoinline
+	call v4_Minus_Greater
+	mov $10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS835
+	call v4__dscheck
+.LDS835:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,350,.LM4758-main
+.LM4758:
+	mov $1850,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS836
+	call v4__dscheck
+.LDS836:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_sum_Minusj
+	call v4_Minus_Greater
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS837
+	call v4__dscheck
+.LDS837:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,351,.LM4766-main
+.LM4766:
+	mov $1860,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS838
+	call v4__dscheck
+.LDS838:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,342,.LM4770-main
+.LM4770:
+	mov $10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS839
+	call v4__dscheck
+.LDS839:
+	mov %ecx,v4__dsindex
+	call v4_find_Minusfirst
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS840
+	call v4__dscheck
+.LDS840:
+	mov %ecx,v4__dsindex
+	call v4_find_Minusfirst
+.stabn 68,0,351,.LM4776-main
+.LM4776:
+	call v4_Minus_Greater
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS841
+	call v4__dscheck
+.LDS841:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,352,.LM4782-main
+.LM4782:
+	mov $1870,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS842
+	call v4__dscheck
+.LDS842:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	call v4_use_Minusin_Minusloop
+	call v4_Minus_Greater
+	mov $250,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS843
+	call v4__dscheck
+.LDS843:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,353,.LM4790-main
+.LM4790:
+	mov $1880,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS844
+	call v4__dscheck
+.LDS844:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS845
+	call v4__dscheck
+.LDS845:
+	mov %ecx,v4__dsindex
+	call v4_factorial
+	call v4_Minus_Greater
+	mov $3628800,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS846
+	call v4__dscheck
+.LDS846:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,354,.LM4800-main
+.LM4800:
+	mov $1890,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS847
+	call v4__dscheck
+.LDS847:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,325,.LM4806-main
+.LM4806:
+	cmp $4080,%ecx
+	jbe .LDS848
+	call v4__dscheck
+.LDS848:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS849
+	call v4__dscheck
+.LDS849:
+	test %eax,%eax
+	jge .L327
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS850
+	call v4__dscheck
+.LDS850:
+	jmp .L329
+.L327:
+.stabn 68,0,326,.LM4817-main
+.LM4817:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS851
+	call v4__dscheck
+.LDS851:
+	cmp %edx,%eax
+	jle .L328
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS852
+	call v4__dscheck
+.LDS852:
+.L328:
+.L329:
+.stabn 68,0,354,.LM4832-main
+.LM4832:
+	mov (v4_min_Minusint),%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,325,.LM4835-main
+.LM4835:
+	cmp $4080,%ecx
+	jbe .LDS853
+	call v4__dscheck
+.LDS853:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS854
+	call v4__dscheck
+.LDS854:
+	test %eax,%eax
+	jge .L330
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS855
+	call v4__dscheck
+.LDS855:
+	jmp .L332
+.L330:
+.stabn 68,0,326,.LM4846-main
+.LM4846:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS856
+	call v4__dscheck
+.LDS856:
+	cmp %edx,%eax
+	jle .L331
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS857
+	call v4__dscheck
+.LDS857:
+.L331:
+.L332:
+.stabn 68,0,354,.LM4861-main
+.LM4861:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS858
+	call v4__dscheck
+.LDS858:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,357,.LM4867-main
+.LM4867:
+	lea .LC9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $31,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS859
+	call v4__dscheck
+.LDS859:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,367,.LM4873-main
+.LM4873:
+	mov $1900,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS860
+	call v4__dscheck
+.LDS860:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $3,%eax
+	mov %eax,(v4_step)
+	mov $10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS861
+	call v4__dscheck
+.LDS861:
+	mov %ecx,v4__dsindex
+	call v4_sum_Minusstep
+	call v4_Minus_Greater
+	mov $30,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS862
+	call v4__dscheck
+.LDS862:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,368,.LM4890-main
+.LM4890:
+	mov $1910,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS863
+	call v4__dscheck
+.LDS863:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,(v4_step)
+	mov $4,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS864
+	call v4__dscheck
+.LDS864:
+	mov %ecx,v4__dsindex
+	call v4_bump_Minusstep
+	mov (v4_step),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS865
+	call v4__dscheck
+.LDS865:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $5,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS866
+	call v4__dscheck
+.LDS866:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,369,.LM4914-main
+.LM4914:
+	mov $1920,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS867
+	call v4__dscheck
+.LDS867:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,(v4_step)
+	mov $2,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS868
+	call v4__dscheck
+.LDS868:
+	mov %ecx,v4__dsindex
+	call v4_sum_Minusstep_Minus2
+	call v4_Minus_Greater
+	mov $15,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS869
+	call v4__dscheck
+.LDS869:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,372,.LM4931-main
+.LM4931:
+	lea .LC10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $25,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS870
+	call v4__dscheck
+.LDS870:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,389,.LM4937-main
+.LM4937:
+	mov $2000,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS871
+	call v4__dscheck
+.LDS871:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $6,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS872
+	call v4__dscheck
+.LDS872:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $6,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $6,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS873
+	call v4__dscheck
+.LDS873:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,390,.LM4964-main
+.LM4964:
+	mov $2010,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS874
+	call v4__dscheck
+.LDS874:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $8,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,390,.LM4985-main
+.LM4985:
+	cmp $4080,%ecx
+	jbe .LDS875
+	call v4__dscheck
+.LDS875:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $8,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $8,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS876
+	call v4__dscheck
+.LDS876:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,391,.LM4991-main
+.LM4991:
+	mov $2020,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS877
+	call v4__dscheck
+.LDS877:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%esi
+	mov $2,%eax
+	mov %esi,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS878
+	call v4__dscheck
+.LDS878:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS879
+	call v4__dscheck
+.LDS879:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,392,.LM5018-main
+.LM5018:
+	mov $2030,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS880
+	call v4__dscheck
+.LDS880:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_cell_Minusv,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,384,.LM5024-main
+.LM5024:
+	mov $5,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov $9,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS881
+	call v4__dscheck
+.LDS881:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	call v4_Store
+	mov (v4_cell_Minusv),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,392,.LM5040-main
+.LM5040:
+	cmp $4080,%ecx
+	jbe .LDS882
+	call v4__dscheck
+.LDS882:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $9,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS883
+	call v4__dscheck
+.LDS883:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,393,.LM5044-main
+.LM5044:
+	mov $2040,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS884
+	call v4__dscheck
+.LDS884:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_cell_Minusv,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,385,.LM5050-main
+.LM5050:
+	xor %eax,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov $7,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS885
+	call v4__dscheck
+.LDS885:
+	mov %ecx,v4__dsindex
+	call v4_swap
+	call v4_c_Store
+	mov (v4_cell_Minusv),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,393,.LM5066-main
+.LM5066:
+	cmp $4080,%ecx
+	jbe .LDS886
+	call v4__dscheck
+.LDS886:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $7,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS887
+	call v4__dscheck
+.LDS887:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,394,.LM5070-main
+.LM5070:
+	mov $2050,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS888
+	call v4__dscheck
+.LDS888:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	lea v4_cell_Minusv,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,386,.LM5076-main
+.LM5076:
+	mov $3,%eax
+	mov %eax,(v4_cell_Minusv)
+	cmp $4080,%ecx
+	jbe .LDS889
+	call v4__dscheck
+.LDS889:
+	mov %ecx,v4__dsindex
+	call v4_Fetch
+	mov $4,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS890
+	call v4__dscheck
+.LDS890:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $4,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS891
+	call v4__dscheck
+.LDS891:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,395,.LM5102-main
+.LM5102:
+	mov $2060,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS892
+	call v4__dscheck
+.LDS892:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+.stabn 68,0,387,.LM5106-main
+.LM5106:
+	mov $5,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS893
+	call v4__dscheck
+.LDS893:
+	mov %ecx,v4__dsindex
+	call v4_set_Minuscell_Minusv
+	mov (v4_cell_Minusv),%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,395,.LM5124-main
+.LM5124:
+	cmp $4080,%ecx
+	jbe .LDS894
+	call v4__dscheck
+.LDS894:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $11,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS895
+	call v4__dscheck
+.LDS895:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,398,.LM5130-main
+.LM5130:
+	lea .LC11,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	mov $40,%eax
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS896
+	call v4__dscheck
+.LDS896:
+	mov %ecx,v4__dsindex
+	call v4__type
+	call v4_cr
+.stabn 68,0,414,.LM5136-main
+.LM5136:
+	mov $2100,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS897
+	call v4__dscheck
+.LDS897:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS898
+	call v4__dscheck
+.LDS898:
+	test %eax,%eax
+	je .L333
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS899
+	call v4__dscheck
+.LDS899:
+	test %eax,%eax
+	je .L334
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS900
+	call v4__dscheck
+.LDS900:
+	jmp .L335
+.L333:
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS901
+	call v4__dscheck
+.LDS901:
+.L334:
+.L335:
+.stabn 68,0,414,.LM5159-main
+.LM5159:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS902
+	call v4__dscheck
+.LDS902:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,415,.LM5163-main
+.LM5163:
+	mov $2110,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS903
+	call v4__dscheck
+.LDS903:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	inc %eax
+	cmp $4080,%ecx
+	jbe .LDS904
+	call v4__dscheck
+.LDS904:
+	test %eax,%eax
+	je .L336
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS905
+	call v4__dscheck
+.LDS905:
+	test %eax,%eax
+	je .L337
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS906
+	call v4__dscheck
+.LDS906:
+	jmp .L338
+.L336:
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS907
+	call v4__dscheck
+.LDS907:
+.L337:
+.L338:
+.stabn 68,0,415,.LM5186-main
+.LM5186:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS908
+	call v4__dscheck
+.LDS908:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,416,.LM5190-main
+.LM5190:
+	mov $2120,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS909
+	call v4__dscheck
+.LDS909:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	xor %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS910
+	call v4__dscheck
+.LDS910:
+	test %eax,%eax
+	je .L339
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS911
+	call v4__dscheck
+.LDS911:
+	test %eax,%eax
+	je .L340
+	mov %ecx,v4__dsindex
+	call v4_drop
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS912
+	call v4__dscheck
+.LDS912:
+	jmp .L341
+.L339:
+	mov %ecx,v4__dsindex
+	call v4_drop
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS913
+	call v4__dscheck
+.LDS913:
+.L340:
+.L341:
+.stabn 68,0,416,.LM5213-main
+.LM5213:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $3,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS914
+	call v4__dscheck
+.LDS914:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,417,.LM5217-main
+.LM5217:
+	mov $2130,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS915
+	call v4__dscheck
+.LDS915:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $10,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS916
+	call v4__dscheck
+.LDS916:
+	mov %ecx,v4__dsindex
+	call v4_count_Minusodd
+	call v4_Minus_Greater
+	mov $5,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS917
+	call v4__dscheck
+.LDS917:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,418,.LM5227-main
+.LM5227:
+	mov $2140,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS918
+	call v4__dscheck
+.LDS918:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS919
+	call v4__dscheck
+.LDS919:
+	mov %ecx,v4__dsindex
+	call v4_count_Minusodd
+	call v4_Minus_Greater
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS920
+	call v4__dscheck
+.LDS920:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,419,.LM5237-main
+.LM5237:
+	mov $2150,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS921
+	call v4__dscheck
+.LDS921:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov (v4_Lesstrue_Greater),%eax
+	mov v4__dsindex,%ecx
+	test %eax,%eax
+	jne .L343
+.L342:
+	jmp .L342
+.L343:
+.stabn 68,0,419,.LM5251-main
+.LM5251:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,420,.LM5253-main
+.LM5253:
+	mov $2160,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS922
+	call v4__dscheck
+.LDS922:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS923
+	call v4__dscheck
+.LDS923:
+.L344:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $10,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS924
+	call v4__dscheck
+.LDS924:
+	cmp %edx,%eax
+	jge .L345
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	add %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS925
+	call v4__dscheck
+.LDS925:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS926
+	call v4__dscheck
+.LDS926:
+	jmp .L344
+.L345:
+	mov $100,%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS927
+	call v4__dscheck
+.LDS927:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,420,.LM5286-main
+.LM5286:
+	cmp $4080,%ecx
+	jbe .LDS928
+	call v4__dscheck
+.LDS928:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $110,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS929
+	call v4__dscheck
+.LDS929:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,421,.LM5290-main
+.LM5290:
+	mov $2170,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS930
+	call v4__dscheck
+.LDS930:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS931
+	call v4__dscheck
+.LDS931:
+.L346:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $10,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS932
+	call v4__dscheck
+.LDS932:
+	cmp %edx,%eax
+	jge .L347
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	add %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS933
+	call v4__dscheck
+.LDS933:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS934
+	call v4__dscheck
+.LDS934:
+	jmp .L346
+.L347:
+	mov $100,%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS935
+	call v4__dscheck
+.LDS935:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,421,.LM5323-main
+.LM5323:
+	cmp $4080,%ecx
+	jbe .LDS936
+	call v4__dscheck
+.LDS936:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $114,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS937
+	call v4__dscheck
+.LDS937:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,422,.LM5327-main
+.LM5327:
+	mov $2180,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS938
+	call v4__dscheck
+.LDS938:
+	mov %ecx,v4__dsindex
+	call v4_Leftbrace
+	mov $20,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS939
+	call v4__dscheck
+.LDS939:
+.L348:
+	mov %ecx,v4__dsindex
+	call v4_dup
+	mov $10,%eax
+	mov %eax,%edx
+	mov v4__dsindex,%ecx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	cmp $4080,%ecx
+	jbe .LDS940
+	call v4__dscheck
+.LDS940:
+	cmp %edx,%eax
+	jge .L349
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	inc %eax
+	add %eax,%eax
+	cmp $4080,%ecx
+	jbe .LDS941
+	call v4__dscheck
+.LDS941:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS942
+	call v4__dscheck
+.LDS942:
+	jmp .L348
+.L349:
+	mov $100,%eax
+	mov %eax,%edx
+	dec %ecx
+	mov v4__dstack(,%ecx,4),%eax
+	add %edx,%eax
+	cmp $4080,%ecx
+	jbe .LDS943
+	call v4__dscheck
+.LDS943:
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+.stabn 68,0,422,.LM5360-main
+.LM5360:
+	cmp $4080,%ecx
+	jbe .LDS944
+	call v4__dscheck
+.LDS944:
+	mov %ecx,v4__dsindex
+	call v4_Minus_Greater
+	mov $120,%eax
+	mov v4__dsindex,%ecx
+	mov %eax,v4__dstack(,%ecx,4)
+	inc %ecx
+	cmp $4080,%ecx
+	jbe .LDS945
+	call v4__dscheck
+.LDS945:
+	mov %ecx,v4__dsindex
+	call v4_Rightbrace
+.stabn 68,0,424,.LM5364-main
+.LM5364:
+	call v4_test_Minusstatus
+	call v4_Fetch
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE1:
+.stabn 68,0,424,.LM5368-main
+.LM5368:
+	lea -8(%ebp),%esp
+	pop %esi
+	pop %ebx
+	leave
+	ret
+.Lfe1:
+	.size	 main,.Lfe1-main
+.stabn	192,0,0,.LBB1-main
+.stabn	224,0,0,.LBE1-main
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
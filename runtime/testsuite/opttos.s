@@ -0,0 +1,7791 @@
+	.file	"opttos.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/testsuite/",100,0,0,Ltext0
+.stabs	"opttos.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC5:
+	.string "TESTING CASE DISPATCH"
+.LC4:
+	.string "TESTING COMPARE AND BRANCH"
+.LC1:
+	.string "TESTING CONSTANT FOLDING AT CELL WIDTH"
+.LC7:
+	.string "TESTING CONSTANTS AS IMMEDIATES"
+.LC8:
+	.string "TESTING INLINING"
+.LC11:
+	.string "TESTING JUMP THREADING AND BLOCK MERGING"
+.LC3:
+	.string "TESTING LEAF WORDS"
+.LC9:
+	.string "TESTING LOOP INVARIANT HOISTING"
+.LC6:
+	.string "TESTING MULTIPLICATION AND DIVISION BY CONSTANTS"
+.LC0:
+	.string "TESTING OPTIMIZER"
+.LC2:
+	.string "TESTING TAIL CALLS"
+.LC10:
+	.string "TESTING VARIABLE ACCESSES"
+.stabs	"v4_Hashdividends:G2",40,0,0,v4_Hashdividends
+	.comm  v4_Hashdividends,4,4
+.stabs	"v4_Lessfalse_Greater:G2",40,0,0,v4_Lessfalse_Greater
+	.comm  v4_Lessfalse_Greater,4,4
+.stabs	"v4_Lesstrue_Greater:G2",40,0,0,v4_Lesstrue_Greater
+	.comm  v4_Lesstrue_Greater,4,4
+.stabs	"v4_biggest:G2",40,0,0,v4_biggest
+	.comm  v4_biggest,4,4
+.stabs	"v4_cell_Minusv:G2",40,0,0,v4_cell_Minusv
+	.comm  v4_cell_Minusv,4,4
+.stabs	"v4_dividends:Gar2;0;15;2",40,0,0,v4_dividends
+	.comm  v4_dividends,64,32
+.stabs	"v4_hundred:G2",40,0,0,v4_hundred
+	.comm  v4_hundred,4,4
+.stabs	"v4_leaf_Minusvar:G2",40,0,0,v4_leaf_Minusvar
+	.comm  v4_leaf_Minusvar,4,4
+.stabs	"v4_max_Minusint:G2",40,0,0,v4_max_Minusint
+	.comm  v4_max_Minusint,4,4
+.stabs	"v4_max_Minusuint:G2",40,0,0,v4_max_Minusuint
+	.comm  v4_max_Minusuint,4,4
+.stabs	"v4_min_Minusint:G2",40,0,0,v4_min_Minusint
+	.comm  v4_min_Minusint,4,4
+.stabs	"v4_minus_Minusone:G2",40,0,0,v4_minus_Minusone
+	.comm  v4_minus_Minusone,4,4
+.stabs	"v4_step:G2",40,0,0,v4_step
+	.comm  v4_step,4,4
+.stabs	"v4_three_Minushundred:G2",40,0,0,v4_three_Minushundred
+	.comm  v4_three_Minushundred,4,4
+.stabs	"v4_zero:G2",40,0,0,v4_zero
+	.comm  v4_zero,4,4
+.text
+	.align 4
+.stabs "v4_fold1:F1",36,0,0,v4_fold1
+.globl v4_fold1
+	.type	v4_fold1,@function
+v4_fold1:
+.stabn 68,0,21,.LMa0-v4_fold1
+.LMa0:
+.stabn 68,0,21,.LMb0-v4_fold1
+.LMb0:
+.LBB14:
+	mov $9,%eax
+	call v4__dpush
+.LBE14:
+.stabn 68,0,21,.LM10-v4_fold1
+.LM10:
+	ret
+.Lfe14:
+	.size	 v4_fold1,.Lfe14-v4_fold1
+.stabn	192,0,0,.LBB14-v4_fold1
+.stabn	224,0,0,.LBE14-v4_fold1
+.Lscope14:
+.stabs	"",36,0,0,.Lscope14-v4_fold1
+.text
+	.align 4
+.stabs "v4_fold2:F1",36,0,0,v4_fold2
+.globl v4_fold2
+	.type	v4_fold2,@function
+v4_fold2:
+.stabn 68,0,22,.LMa11-v4_fold2
+.LMa11:
+.stabn 68,0,22,.LMb11-v4_fold2
+.LMb11:
+.LBB17:
+	mov $2147483647,%eax
+	call v4__dpush
+.LBE17:
+.stabn 68,0,22,.LM18-v4_fold2
+.LM18:
+	ret
+.Lfe17:
+	.size	 v4_fold2,.Lfe17-v4_fold2
+.stabn	192,0,0,.LBB17-v4_fold2
+.stabn	224,0,0,.LBE17-v4_fold2
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-v4_fold2
+.text
+	.align 4
+.stabs "v4_fold3:F1",36,0,0,v4_fold3
+.globl v4_fold3
+	.type	v4_fold3,@function
+v4_fold3:
+.stabn 68,0,23,.LMa19-v4_fold3
+.LMa19:
+.stabn 68,0,23,.LMb19-v4_fold3
+.LMb19:
+.LBB18:
+	mov $-2147483648,%eax
+	call v4__dpush
+.LBE18:
+.stabn 68,0,23,.LM27-v4_fold3
+.LM27:
+	ret
+.Lfe18:
+	.size	 v4_fold3,.Lfe18-v4_fold3
+.stabn	192,0,0,.LBB18-v4_fold3
+.stabn	224,0,0,.LBE18-v4_fold3
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4_fold3
+.text
+	.align 4
+.stabs "v4_fold4:F1",36,0,0,v4_fold4
+.globl v4_fold4
+	.type	v4_fold4,@function
+v4_fold4:
+.stabn 68,0,24,.LMa28-v4_fold4
+.LMa28:
+.stabn 68,0,24,.LMb28-v4_fold4
+.LMb28:
+.LBB20:
+	mov $-2147483648,%eax
+	call v4__dpush
+.LBE20:
+.stabn 68,0,24,.LM37-v4_fold4
+.LM37:
+	ret
+.Lfe20:
+	.size	 v4_fold4,.Lfe20-v4_fold4
+.stabn	192,0,0,.LBB20-v4_fold4
+.stabn	224,0,0,.LBE20-v4_fold4
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4_fold4
+.text
+	.align 4
+.stabs "v4_fold5:F1",36,0,0,v4_fold5
+.globl v4_fold5
+	.type	v4_fold5,@function
+v4_fold5:
+.stabn 68,0,29,.LMa38-v4_fold5
+.LMa38:
+.stabn 68,0,29,.LMb38-v4_fold5
+.LMb38:
+.LBB24:
+	mov $-2147483648,%eax
+	call v4__dpush
+.LBE24:
+.stabn 68,0,29,.LM45-v4_fold5
+.LM45:
+	ret
+.Lfe24:
+	.size	 v4_fold5,.Lfe24-v4_fold5
+.stabn	192,0,0,.LBB24-v4_fold5
+.stabn	224,0,0,.LBE24-v4_fold5
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4_fold5
+.text
+	.align 4
+.stabs "v4_fold6:F1",36,0,0,v4_fold6
+.globl v4_fold6
+	.type	v4_fold6,@function
+v4_fold6:
+.stabn 68,0,30,.LMa46-v4_fold6
+.LMa46:
+.stabn 68,0,30,.LMb46-v4_fold6
+.LMb46:
+.LBB25:
+	mov $2147483647,%eax
+	call v4__dpush
+.LBE25:
+.stabn 68,0,30,.LM51-v4_fold6
+.LM51:
+	ret
+.Lfe25:
+	.size	 v4_fold6,.Lfe25-v4_fold6
+.stabn	192,0,0,.LBB25-v4_fold6
+.stabn	224,0,0,.LBE25-v4_fold6
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4_fold6
+.text
+	.align 4
+.stabs "v4_fold7:F1",36,0,0,v4_fold7
+.globl v4_fold7
+	.type	v4_fold7,@function
+v4_fold7:
+.stabn 68,0,32,.LMa52-v4_fold7
+.LMa52:
+.stabn 68,0,32,.LMb52-v4_fold7
+.LMb52:
+.LBB26:
+	mov $-3,%eax
+	call v4__dpush
+.LBE26:
+.stabn 68,0,32,.LM57-v4_fold7
+.LM57:
+	ret
+.Lfe26:
+	.size	 v4_fold7,.Lfe26-v4_fold7
+.stabn	192,0,0,.LBB26-v4_fold7
+.stabn	224,0,0,.LBE26-v4_fold7
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4_fold7
+.text
+	.align 4
+.stabs "v4_fold8:F1",36,0,0,v4_fold8
+.globl v4_fold8
+	.type	v4_fold8,@function
+v4_fold8:
+.stabn 68,0,33,.LMa58-v4_fold8
+.LMa58:
+.stabn 68,0,33,.LMb58-v4_fold8
+.LMb58:
+.LBB28:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.LBE28:
+.stabn 68,0,33,.LM67-v4_fold8
+.LM67:
+	ret
+.Lfe28:
+	.size	 v4_fold8,.Lfe28-v4_fold8
+.stabn	192,0,0,.LBB28-v4_fold8
+.stabn	224,0,0,.LBE28-v4_fold8
+.Lscope28:
+.stabs	"",36,0,0,.Lscope28-v4_fold8
+.text
+	.align 4
+.stabs "v4_fold9:F1",36,0,0,v4_fold9
+.globl v4_fold9
+	.type	v4_fold9,@function
+v4_fold9:
+.stabn 68,0,34,.LMa68-v4_fold9
+.LMa68:
+.stabn 68,0,34,.LMb68-v4_fold9
+.LMb68:
+.LBB29:
+	mov $6,%eax
+	call v4__dpush
+	mov $-4,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.LBE29:
+.stabn 68,0,34,.LM84-v4_fold9
+.LM84:
+	ret
+.Lfe29:
+	.size	 v4_fold9,.Lfe29-v4_fold9
+.stabn	192,0,0,.LBB29-v4_fold9
+.stabn	224,0,0,.LBE29-v4_fold9
+.Lscope29:
+.stabs	"",36,0,0,.Lscope29-v4_fold9
+.text
+	.align 4
+.stabs "v4_fold10:F1",36,0,0,v4_fold10
+.globl v4_fold10
+	.type	v4_fold10,@function
+v4_fold10:
+.stabn 68,0,35,.LMa85-v4_fold10
+.LMa85:
+.stabn 68,0,35,.LMb85-v4_fold10
+.LMb85:
+.LBB34:
+	mov $7,%eax
+	call v4__dpush
+.LBE34:
+.stabn 68,0,35,.LM99-v4_fold10
+.LM99:
+	ret
+.Lfe34:
+	.size	 v4_fold10,.Lfe34-v4_fold10
+.stabn	192,0,0,.LBB34-v4_fold10
+.stabn	224,0,0,.LBE34-v4_fold10
+.Lscope34:
+.stabs	"",36,0,0,.Lscope34-v4_fold10
+.text
+	.align 4
+.stabs "v4_fold11:F1",36,0,0,v4_fold11
+.globl v4_fold11
+	.type	v4_fold11,@function
+v4_fold11:
+.stabn 68,0,36,.LMa100-v4_fold11
+.LMa100:
+.stabn 68,0,36,.LMb100-v4_fold11
+.LMb100:
+.LBB38:
+	mov (v4_max_Minusuint),%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	call v4__dpush
+.LBE38:
+.stabn 68,0,36,.LM111-v4_fold11
+.LM111:
+	ret
+.Lfe38:
+	.size	 v4_fold11,.Lfe38-v4_fold11
+.stabn	192,0,0,.LBB38-v4_fold11
+.stabn	224,0,0,.LBE38-v4_fold11
+.Lscope38:
+.stabs	"",36,0,0,.Lscope38-v4_fold11
+.text
+	.align 4
+.stabs "v4_countdown:F1",36,0,0,v4_countdown
+.globl v4_countdown
+	.type	v4_countdown,@function
+v4_countdown:
+.stabn 68,0,55,.LMa112-v4_countdown
+.LMa112:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,55,.LMb112-v4_countdown
+.LMb112:
+.LBB42:
+.L359:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jne .L13
+	jmp .L12
+.L13:
+	call v4__dpop
+	dec %eax
+	call v4__dpush
+	jmp .L359
+.L12:
+.LBE42:
+.stabn 68,0,55,.LM128-v4_countdown
+.LM128:
+	pop %ebx
+	leave
+	ret
+.Lfe42:
+	.size	 v4_countdown,.Lfe42-v4_countdown
+.stabn	192,0,0,.LBB42-v4_countdown
+.stabn	224,0,0,.LBE42-v4_countdown
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4_countdown
+.text
+	.align 4
+.stabs "v4_sumto:F1",36,0,0,v4_sumto
+.globl v4_sumto
+	.type	v4_sumto,@function
+v4_sumto:
+.stabn 68,0,56,.LMa129-v4_sumto
+.LMa129:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,56,.LMb129-v4_sumto
+.LMb129:
+.LBB45:
+.L360:
+.stabn 68,0,57,.LM131-v4_sumto
+.LM131:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jne .L15
+	pop %ebx
+	leave
+	jmp v4_drop
+.L15:
+	call v4_swap
+	call v4_over
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	call v4__dpush
+	call v4_swap
+	call v4__dpop
+	dec %eax
+	call v4__dpush
+	jmp .L360
+.LBE45:
+.stabn 68,0,57,.LM154-v4_sumto
+.LM154:
+	pop %ebx
+	leave
+	ret
+.Lfe45:
+	.size	 v4_sumto,.Lfe45-v4_sumto
+.stabn	192,0,0,.LBB45-v4_sumto
+.stabn	224,0,0,.LBE45-v4_sumto
+.Lscope45:
+.stabs	"",36,0,0,.Lscope45-v4_sumto
+.text
+	.align 4
+.stabs "v4_tail2:F1",36,0,0,v4_tail2
+.globl v4_tail2
+	.type	v4_tail2,@function
+v4_tail2:
+.stabn 68,0,58,.LMa155-v4_tail2
+.LMa155:
+.stabn 68,0,58,.LMb155-v4_tail2
+.LMb155:
+.LBB49:
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+.LBE49:
+.stabn 68,0,58,.LM161-v4_tail2
+.LM161:
+	ret
+.Lfe49:
+	.size	 v4_tail2,.Lfe49-v4_tail2
+.stabn	192,0,0,.LBB49-v4_tail2
+.stabn	224,0,0,.LBE49-v4_tail2
+.Lscope49:
+.stabs	"",36,0,0,.Lscope49-v4_tail2
+.text
+	.align 4
+.stabs "v4_tail1:F1",36,0,0,v4_tail1
+.globl v4_tail1
+	.type	v4_tail1,@function
+v4_tail1:
+.stabn 68,0,59,.LMa162-v4_tail1
+.LMa162:
+.stabn 68,0,59,.LMb162-v4_tail1
+.LMb162:
+.LBB50:
+	call v4__dpop
+	add %eax,%eax
+	inc %eax
+	call v4__dpush
+.LBE50:
+.stabn 68,0,59,.LM173-v4_tail1
+.LM173:
+	ret
+.Lfe50:
+	.size	 v4_tail1,.Lfe50-v4_tail1
+.stabn	192,0,0,.LBB50-v4_tail1
+.stabn	224,0,0,.LBE50-v4_tail1
+.Lscope50:
+.stabs	"",36,0,0,.Lscope50-v4_tail1
+.text
+	.align 4
+.stabs "v4_tail_Minusif:F1",36,0,0,v4_tail_Minusif
+.globl v4_tail_Minusif
+	.type	v4_tail_Minusif,@function
+v4_tail_Minusif:
+.stabn 68,0,60,.LMa174-v4_tail_Minusif
+.LMa174:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,60,.LMb174-v4_tail_Minusif
+.LMb174:
+.LBB52:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L19
+	call v4__dpop
+	neg %eax
+	call v4__dpush
+	jmp .L18
+.L19:
+	call v4__dpop
+	add %eax,%eax
+	inc %eax
+	call v4__dpush
+.L18:
+.LBE52:
+.stabn 68,0,60,.LM198-v4_tail_Minusif
+.LM198:
+	pop %ebx
+	leave
+	ret
+.Lfe52:
+	.size	 v4_tail_Minusif,.Lfe52-v4_tail_Minusif
+.stabn	192,0,0,.LBB52-v4_tail_Minusif
+.stabn	224,0,0,.LBE52-v4_tail_Minusif
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4_tail_Minusif
+.text
+	.align 4
+.stabs "v4_tail_Minusrs:F1",36,0,0,v4_tail_Minusrs
+.globl v4_tail_Minusrs
+	.type	v4_tail_Minusrs,@function
+v4_tail_Minusrs:
+.stabn 68,0,61,.LMa199-v4_tail_Minusrs
+.LMa199:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,61,.LMb199-v4_tail_Minusrs
+.LMb199:
+.LBB54:
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	mov $3,%eax
+	mov %eax,%ecx
+	mov -8(%ebp),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	inc %eax
+	call v4__dpush
+.LBE54:
+.stabn 68,0,61,.LM219-v4_tail_Minusrs
+.LM219:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe54:
+	.size	 v4_tail_Minusrs,.Lfe54-v4_tail_Minusrs
+.stabn	192,0,0,.LBB54-v4_tail_Minusrs
+.stabn	224,0,0,.LBE54-v4_tail_Minusrs
+.Lscope54:
+.stabs	"",36,0,0,.Lscope54-v4_tail_Minusrs
+.text
+	.align 4
+.stabs "v4_tail_Minusloop:F1",36,0,0,v4_tail_Minusloop
+.globl v4_tail_Minusloop
+	.type	v4_tail_Minusloop,@function
+v4_tail_Minusloop:
+.stabn 68,0,62,.LMa220-v4_tail_Minusloop
+.LMa220:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,62,.LMb220-v4_tail_Minusloop
+.LMb220:
+.LBB57:
+	xor %eax,%eax
+	call v4__dpush
+	mov $5,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L23:
+	mov -12(%ebp),%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	mov -12(%ebp),%edx
+	inc %edx
+	call v4__dpush
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	jne .L23
+	mov -8(%ebp),%eax
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+.LBE57:
+.stabn 68,0,62,.LM257-v4_tail_Minusloop
+.LM257:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe57:
+	.size	 v4_tail_Minusloop,.Lfe57-v4_tail_Minusloop
+.stabn	192,0,0,.LBB57-v4_tail_Minusloop
+.stabn	224,0,0,.LBE57-v4_tail_Minusloop
+.Lscope57:
+.stabs	"",36,0,0,.Lscope57-v4_tail_Minusloop
+.text
+	.align 4
+.stabs "v4_tail_Minusexec:F1",36,0,0,v4_tail_Minusexec
+.globl v4_tail_Minusexec
+	.type	v4_tail_Minusexec,@function
+v4_tail_Minusexec:
+.stabn 68,0,63,.LMa258-v4_tail_Minusexec
+.LMa258:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,63,.LMb258-v4_tail_Minusexec
+.LMb258:
+.LBB59:
+	pop %ebx
+	leave
+	jmp v4_execute
+.LBE59:
+.stabn 68,0,63,.LM261-v4_tail_Minusexec
+.LM261:
+	pop %ebx
+	leave
+	ret
+.Lfe59:
+	.size	 v4_tail_Minusexec,.Lfe59-v4_tail_Minusexec
+.stabn	192,0,0,.LBB59-v4_tail_Minusexec
+.stabn	224,0,0,.LBE59-v4_tail_Minusexec
+.Lscope59:
+.stabs	"",36,0,0,.Lscope59-v4_tail_Minusexec
+.text
+	.align 4
+.stabs "v4_leaf1:F1",36,0,0,v4_leaf1
+.globl v4_leaf1
+	.type	v4_leaf1,@function
+v4_leaf1:
+.stabn 68,0,77,.LMa262-v4_leaf1
+.LMa262:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,77,.LMb262-v4_leaf1
+.LMb262:
+.LBB60:
+	call v4_dup
+	pop %ebx
+	leave
+	jmp v4_Star
+.LBE60:
+.stabn 68,0,77,.LM266-v4_leaf1
+.LM266:
+	pop %ebx
+	leave
+	ret
+.Lfe60:
+	.size	 v4_leaf1,.Lfe60-v4_leaf1
+.stabn	192,0,0,.LBB60-v4_leaf1
+.stabn	224,0,0,.LBE60-v4_leaf1
+.Lscope60:
+.stabs	"",36,0,0,.Lscope60-v4_leaf1
+.text
+	.align 4
+.stabs "v4_leaf2:F1",36,0,0,v4_leaf2
+.globl v4_leaf2
+	.type	v4_leaf2,@function
+v4_leaf2:
+.stabn 68,0,78,.LMa267-v4_leaf2
+.LMa267:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,78,.LMb267-v4_leaf2
+.LMb267:
+.LBB61:
+	call v4_z2dup
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	call v4__dpush
+.LBE61:
+.stabn 68,0,78,.LM275-v4_leaf2
+.LM275:
+	pop %ebx
+	leave
+	ret
+.Lfe61:
+	.size	 v4_leaf2,.Lfe61-v4_leaf2
+.stabn	192,0,0,.LBB61-v4_leaf2
+.stabn	224,0,0,.LBE61-v4_leaf2
+.Lscope61:
+.stabs	"",36,0,0,.Lscope61-v4_leaf2
+.text
+	.align 4
+.stabs "v4_leaf_Minusloop:F1",36,0,0,v4_leaf_Minusloop
+.globl v4_leaf_Minusloop
+	.type	v4_leaf_Minusloop,@function
+v4_leaf_Minusloop:
+.stabn 68,0,79,.LMa276-v4_leaf_Minusloop
+.LMa276:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,79,.LMb276-v4_leaf_Minusloop
+.LMb276:
+.LBB63:
+	xor %eax,%eax
+	call v4__dpush
+	mov $10,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L30:
+	mov -12(%ebp),%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	mov -12(%ebp),%edx
+	inc %edx
+	call v4__dpush
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	jne .L30
+	mov -8(%ebp),%eax
+.LBE63:
+.stabn 68,0,79,.LM308-v4_leaf_Minusloop
+.LM308:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe63:
+	.size	 v4_leaf_Minusloop,.Lfe63-v4_leaf_Minusloop
+.stabn	192,0,0,.LBB63-v4_leaf_Minusloop
+.stabn	224,0,0,.LBE63-v4_leaf_Minusloop
+.Lscope63:
+.stabs	"",36,0,0,.Lscope63-v4_leaf_Minusloop
+.text
+	.align 4
+.stabs "v4_leaf_Minusnested:F1",36,0,0,v4_leaf_Minusnested
+.globl v4_leaf_Minusnested
+	.type	v4_leaf_Minusnested,@function
+v4_leaf_Minusnested:
+.stabn 68,0,80,.LMa309-v4_leaf_Minusnested
+.LMa309:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,80,.LMb309-v4_leaf_Minusnested
+.LMb309:
+.LBB64:
+	xor %eax,%eax
+	call v4__dpush
+	mov $3,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L34:
+	mov $4,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	mov %eax,-16(%ebp)
+	mov %edx,-20(%ebp)
+.L37:
+	mov -12(%ebp),%eax
+	lea (%eax,%eax,4),%eax
+	add %eax,%eax
+	mov %eax,%ecx
+	mov -20(%ebp),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	mov -20(%ebp),%edx
+	inc %edx
+	call v4__dpush
+	mov -16(%ebp),%eax
+	mov %edx,-20(%ebp)
+	sub %eax,%edx
+	jne .L37
+	mov -16(%ebp),%eax
+	mov -12(%ebp),%edx
+	inc %edx
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	jne .L34
+	mov -8(%ebp),%eax
+.LBE64:
+.stabn 68,0,80,.LM375-v4_leaf_Minusnested
+.LM375:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe64:
+	.size	 v4_leaf_Minusnested,.Lfe64-v4_leaf_Minusnested
+.stabn	192,0,0,.LBB64-v4_leaf_Minusnested
+.stabn	224,0,0,.LBE64-v4_leaf_Minusnested
+.Lscope64:
+.stabs	"",36,0,0,.Lscope64-v4_leaf_Minusnested
+.text
+	.align 4
+.stabs "v4_leaf_Minusrs:F1",36,0,0,v4_leaf_Minusrs
+.globl v4_leaf_Minusrs
+	.type	v4_leaf_Minusrs,@function
+v4_leaf_Minusrs:
+.stabn 68,0,81,.LMa376-v4_leaf_Minusrs
+.LMa376:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,81,.LMb376-v4_leaf_Minusrs
+.LMb376:
+.LBB66:
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	mov -8(%ebp),%eax
+	mov %eax,%ecx
+	mov -8(%ebp),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	call v4__dpush
+.LBE66:
+.stabn 68,0,81,.LM392-v4_leaf_Minusrs
+.LM392:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe66:
+	.size	 v4_leaf_Minusrs,.Lfe66-v4_leaf_Minusrs
+.stabn	192,0,0,.LBB66-v4_leaf_Minusrs
+.stabn	224,0,0,.LBE66-v4_leaf_Minusrs
+.Lscope66:
+.stabs	"",36,0,0,.Lscope66-v4_leaf_Minusrs
+.text
+	.align 4
+.stabs "v4_leaf_Minusstore:F1",36,0,0,v4_leaf_Minusstore
+.globl v4_leaf_Minusstore
+	.type	v4_leaf_Minusstore,@function
+v4_leaf_Minusstore:
+.stabn 68,0,83,.LMa393-v4_leaf_Minusstore
+.LMa393:
+.stabn 68,0,83,.LMb393-v4_leaf_Minusstore
+.LMb393:
+.LBB69:
+	call v4__dpop
+	mov %eax,(v4_leaf_Minusvar)
+.LBE69:
+.stabn 68,0,83,.LM400-v4_leaf_Minusstore
+.LM400:
+	ret
+.Lfe69:
+	.size	 v4_leaf_Minusstore,.Lfe69-v4_leaf_Minusstore
+.stabn	192,0,0,.LBB69-v4_leaf_Minusstore
+.stabn	224,0,0,.LBE69-v4_leaf_Minusstore
+.Lscope69:
+.stabs	"",36,0,0,.Lscope69-v4_leaf_Minusstore
+.text
+	.align 4
+.stabs "v4_leaf_Minusfetch:F1",36,0,0,v4_leaf_Minusfetch
+.globl v4_leaf_Minusfetch
+	.type	v4_leaf_Minusfetch,@function
+v4_leaf_Minusfetch:
+.stabn 68,0,84,.LMa401-v4_leaf_Minusfetch
+.LMa401:
+.stabn 68,0,84,.LMb401-v4_leaf_Minusfetch
+.LMb401:
+.LBB70:
+	mov (v4_leaf_Minusvar),%eax
+	call v4__dpush
+.LBE70:
+.stabn 68,0,84,.LM408-v4_leaf_Minusfetch
+.LM408:
+	ret
+.Lfe70:
+	.size	 v4_leaf_Minusfetch,.Lfe70-v4_leaf_Minusfetch
+.stabn	192,0,0,.LBB70-v4_leaf_Minusfetch
+.stabn	224,0,0,.LBE70-v4_leaf_Minusfetch
+.Lscope70:
+.stabs	"",36,0,0,.Lscope70-v4_leaf_Minusfetch
+.text
+	.align 4
+.stabs "v4_cb_Less:F1",36,0,0,v4_cb_Less
+.globl v4_cb_Less
+	.type	v4_cb_Less,@function
+v4_cb_Less:
+.stabn 68,0,98,.LMa409-v4_cb_Less
+.LMa409:
+.stabn 68,0,98,.LMb409-v4_cb_Less
+.LMb409:
+.LBB72:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L43
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L44
+.L43:
+	xor %eax,%eax
+	call v4__dpush
+.L44:
+.LBE72:
+.stabn 68,0,98,.LM424-v4_cb_Less
+.LM424:
+	ret
+.Lfe72:
+	.size	 v4_cb_Less,.Lfe72-v4_cb_Less
+.stabn	192,0,0,.LBB72-v4_cb_Less
+.stabn	224,0,0,.LBE72-v4_cb_Less
+.Lscope72:
+.stabs	"",36,0,0,.Lscope72-v4_cb_Less
+.text
+	.align 4
+.stabs "v4_cb_Greater:F1",36,0,0,v4_cb_Greater
+.globl v4_cb_Greater
+	.type	v4_cb_Greater,@function
+v4_cb_Greater:
+.stabn 68,0,99,.LMa425-v4_cb_Greater
+.LMa425:
+.stabn 68,0,99,.LMb425-v4_cb_Greater
+.LMb425:
+.LBB74:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L46
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L47
+.L46:
+	xor %eax,%eax
+	call v4__dpush
+.L47:
+.LBE74:
+.stabn 68,0,99,.LM440-v4_cb_Greater
+.LM440:
+	ret
+.Lfe74:
+	.size	 v4_cb_Greater,.Lfe74-v4_cb_Greater
+.stabn	192,0,0,.LBB74-v4_cb_Greater
+.stabn	224,0,0,.LBE74-v4_cb_Greater
+.Lscope74:
+.stabs	"",36,0,0,.Lscope74-v4_cb_Greater
+.text
+	.align 4
+.stabs "v4_cb_Equals:F1",36,0,0,v4_cb_Equals
+.globl v4_cb_Equals
+	.type	v4_cb_Equals,@function
+v4_cb_Equals:
+.stabn 68,0,100,.LMa441-v4_cb_Equals
+.LMa441:
+.stabn 68,0,100,.LMb441-v4_cb_Equals
+.LMb441:
+.LBB76:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L49
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L50
+.L49:
+	xor %eax,%eax
+	call v4__dpush
+.L50:
+.LBE76:
+.stabn 68,0,100,.LM456-v4_cb_Equals
+.LM456:
+	ret
+.Lfe76:
+	.size	 v4_cb_Equals,.Lfe76-v4_cb_Equals
+.stabn	192,0,0,.LBB76-v4_cb_Equals
+.stabn	224,0,0,.LBE76-v4_cb_Equals
+.Lscope76:
+.stabs	"",36,0,0,.Lscope76-v4_cb_Equals
+.text
+	.align 4
+.stabs "v4_cb_Less_Greater:F1",36,0,0,v4_cb_Less_Greater
+.globl v4_cb_Less_Greater
+	.type	v4_cb_Less_Greater,@function
+v4_cb_Less_Greater:
+.stabn 68,0,101,.LMa457-v4_cb_Less_Greater
+.LMa457:
+.stabn 68,0,101,.LMb457-v4_cb_Less_Greater
+.LMb457:
+.LBB78:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	je .L52
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L53
+.L52:
+	xor %eax,%eax
+	call v4__dpush
+.L53:
+.LBE78:
+.stabn 68,0,101,.LM472-v4_cb_Less_Greater
+.LM472:
+	ret
+.Lfe78:
+	.size	 v4_cb_Less_Greater,.Lfe78-v4_cb_Less_Greater
+.stabn	192,0,0,.LBB78-v4_cb_Less_Greater
+.stabn	224,0,0,.LBE78-v4_cb_Less_Greater
+.Lscope78:
+.stabs	"",36,0,0,.Lscope78-v4_cb_Less_Greater
+.text
+	.align 4
+.stabs "v4_cbu_Less:F1",36,0,0,v4_cbu_Less
+.globl v4_cbu_Less
+	.type	v4_cbu_Less,@function
+v4_cbu_Less:
+.stabn 68,0,102,.LMa473-v4_cbu_Less
+.LMa473:
+.stabn 68,0,102,.LMb473-v4_cbu_Less
+.LMb473:
+.LBB80:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jae .L55
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L56
+.L55:
+	xor %eax,%eax
+	call v4__dpush
+.L56:
+.LBE80:
+.stabn 68,0,102,.LM488-v4_cbu_Less
+.LM488:
+	ret
+.Lfe80:
+	.size	 v4_cbu_Less,.Lfe80-v4_cbu_Less
+.stabn	192,0,0,.LBB80-v4_cbu_Less
+.stabn	224,0,0,.LBE80-v4_cbu_Less
+.Lscope80:
+.stabs	"",36,0,0,.Lscope80-v4_cbu_Less
+.text
+	.align 4
+.stabs "v4_cbu_Greater:F1",36,0,0,v4_cbu_Greater
+.globl v4_cbu_Greater
+	.type	v4_cbu_Greater,@function
+v4_cbu_Greater:
+.stabn 68,0,103,.LMa489-v4_cbu_Greater
+.LMa489:
+.stabn 68,0,103,.LMb489-v4_cbu_Greater
+.LMb489:
+.LBB82:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jbe .L58
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L59
+.L58:
+	xor %eax,%eax
+	call v4__dpush
+.L59:
+.LBE82:
+.stabn 68,0,103,.LM504-v4_cbu_Greater
+.LM504:
+	ret
+.Lfe82:
+	.size	 v4_cbu_Greater,.Lfe82-v4_cbu_Greater
+.stabn	192,0,0,.LBB82-v4_cbu_Greater
+.stabn	224,0,0,.LBE82-v4_cbu_Greater
+.Lscope82:
+.stabs	"",36,0,0,.Lscope82-v4_cbu_Greater
+.text
+	.align 4
+.stabs "v4_cbu_Less_Equals:F1",36,0,0,v4_cbu_Less_Equals
+.globl v4_cbu_Less_Equals
+	.type	v4_cbu_Less_Equals,@function
+v4_cbu_Less_Equals:
+.stabn 68,0,104,.LMa505-v4_cbu_Less_Equals
+.LMa505:
+.stabn 68,0,104,.LMb505-v4_cbu_Less_Equals
+.LMb505:
+.LBB84:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	ja .L61
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L62
+.L61:
+	xor %eax,%eax
+	call v4__dpush
+.L62:
+.LBE84:
+.stabn 68,0,104,.LM520-v4_cbu_Less_Equals
+.LM520:
+	ret
+.Lfe84:
+	.size	 v4_cbu_Less_Equals,.Lfe84-v4_cbu_Less_Equals
+.stabn	192,0,0,.LBB84-v4_cbu_Less_Equals
+.stabn	224,0,0,.LBE84-v4_cbu_Less_Equals
+.Lscope84:
+.stabs	"",36,0,0,.Lscope84-v4_cbu_Less_Equals
+.text
+	.align 4
+.stabs "v4_cbu_Greater_Equals:F1",36,0,0,v4_cbu_Greater_Equals
+.globl v4_cbu_Greater_Equals
+	.type	v4_cbu_Greater_Equals,@function
+v4_cbu_Greater_Equals:
+.stabn 68,0,105,.LMa521-v4_cbu_Greater_Equals
+.LMa521:
+.stabn 68,0,105,.LMb521-v4_cbu_Greater_Equals
+.LMb521:
+.LBB86:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jb .L64
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L65
+.L64:
+	xor %eax,%eax
+	call v4__dpush
+.L65:
+.LBE86:
+.stabn 68,0,105,.LM536-v4_cbu_Greater_Equals
+.LM536:
+	ret
+.Lfe86:
+	.size	 v4_cbu_Greater_Equals,.Lfe86-v4_cbu_Greater_Equals
+.stabn	192,0,0,.LBB86-v4_cbu_Greater_Equals
+.stabn	224,0,0,.LBE86-v4_cbu_Greater_Equals
+.Lscope86:
+.stabs	"",36,0,0,.Lscope86-v4_cbu_Greater_Equals
+.text
+	.align 4
+.stabs "v4_cb0_Equals:F1",36,0,0,v4_cb0_Equals
+.globl v4_cb0_Equals
+	.type	v4_cb0_Equals,@function
+v4_cb0_Equals:
+.stabn 68,0,106,.LMa537-v4_cb0_Equals
+.LMa537:
+.stabn 68,0,106,.LMb537-v4_cb0_Equals
+.LMb537:
+.LBB88:
+	call v4__dpop
+	test %eax,%eax
+	jne .L67
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L68
+.L67:
+	xor %eax,%eax
+	call v4__dpush
+.L68:
+.LBE88:
+.stabn 68,0,106,.LM551-v4_cb0_Equals
+.LM551:
+	ret
+.Lfe88:
+	.size	 v4_cb0_Equals,.Lfe88-v4_cb0_Equals
+.stabn	192,0,0,.LBB88-v4_cb0_Equals
+.stabn	224,0,0,.LBE88-v4_cb0_Equals
+.Lscope88:
+.stabs	"",36,0,0,.Lscope88-v4_cb0_Equals
+.text
+	.align 4
+.stabs "v4_cb0_Less:F1",36,0,0,v4_cb0_Less
+.globl v4_cb0_Less
+	.type	v4_cb0_Less,@function
+v4_cb0_Less:
+.stabn 68,0,107,.LMa552-v4_cb0_Less
+.LMa552:
+.stabn 68,0,107,.LMb552-v4_cb0_Less
+.LMb552:
+.LBB89:
+	call v4__dpop
+	test %eax,%eax
+	jge .L70
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L71
+.L70:
+	xor %eax,%eax
+	call v4__dpush
+.L71:
+.LBE89:
+.stabn 68,0,107,.LM566-v4_cb0_Less
+.LM566:
+	ret
+.Lfe89:
+	.size	 v4_cb0_Less,.Lfe89-v4_cb0_Less
+.stabn	192,0,0,.LBB89-v4_cb0_Less
+.stabn	224,0,0,.LBE89-v4_cb0_Less
+.Lscope89:
+.stabs	"",36,0,0,.Lscope89-v4_cb0_Less
+.text
+	.align 4
+.stabs "v4_cb0_Greater:F1",36,0,0,v4_cb0_Greater
+.globl v4_cb0_Greater
+	.type	v4_cb0_Greater,@function
+v4_cb0_Greater:
+.stabn 68,0,108,.LMa567-v4_cb0_Greater
+.LMa567:
+.stabn 68,0,108,.LMb567-v4_cb0_Greater
+.LMb567:
+.LBB90:
+	call v4__dpop
+	test %eax,%eax
+	jle .L73
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L74
+.L73:
+	xor %eax,%eax
+	call v4__dpush
+.L74:
+.LBE90:
+.stabn 68,0,108,.LM581-v4_cb0_Greater
+.LM581:
+	ret
+.Lfe90:
+	.size	 v4_cb0_Greater,.Lfe90-v4_cb0_Greater
+.stabn	192,0,0,.LBB90-v4_cb0_Greater
+.stabn	224,0,0,.LBE90-v4_cb0_Greater
+.Lscope90:
+.stabs	"",36,0,0,.Lscope90-v4_cb0_Greater
+.text
+	.align 4
+.stabs "v4_cb_Less5:F1",36,0,0,v4_cb_Less5
+.globl v4_cb_Less5
+	.type	v4_cb_Less5,@function
+v4_cb_Less5:
+.stabn 68,0,109,.LMa582-v4_cb_Less5
+.LMa582:
+.stabn 68,0,109,.LMb582-v4_cb_Less5
+.LMb582:
+.LBB92:
+	mov $5,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L76
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L77
+.L76:
+	xor %eax,%eax
+	call v4__dpush
+.L77:
+.LBE92:
+.stabn 68,0,109,.LM599-v4_cb_Less5
+.LM599:
+	ret
+.Lfe92:
+	.size	 v4_cb_Less5,.Lfe92-v4_cb_Less5
+.stabn	192,0,0,.LBB92-v4_cb_Less5
+.stabn	224,0,0,.LBE92-v4_cb_Less5
+.Lscope92:
+.stabs	"",36,0,0,.Lscope92-v4_cb_Less5
+.text
+	.align 4
+.stabs "v4_cbwhile:F1",36,0,0,v4_cbwhile
+.globl v4_cbwhile
+	.type	v4_cbwhile,@function
+v4_cbwhile:
+.stabn 68,0,110,.LMa600-v4_cbwhile
+.LMa600:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,110,.LMb600-v4_cbwhile
+.LMb600:
+.LBB93:
+	xor %eax,%eax
+	call v4__dpush
+.L79:
+	call v4_over
+	call v4__dpop
+	test %eax,%eax
+	jle .L80
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	call v4_swap
+	call v4__dpop
+	dec %eax
+	call v4__dpush
+	call v4_swap
+	jmp .L79
+.L80:
+	pop %ebx
+	leave
+	jmp v4_nip
+.LBE93:
+.stabn 68,0,110,.LM624-v4_cbwhile
+.LM624:
+	pop %ebx
+	leave
+	ret
+.Lfe93:
+	.size	 v4_cbwhile,.Lfe93-v4_cbwhile
+.stabn	192,0,0,.LBB93-v4_cbwhile
+.stabn	224,0,0,.LBE93-v4_cbwhile
+.Lscope93:
+.stabs	"",36,0,0,.Lscope93-v4_cbwhile
+.text
+	.align 4
+.stabs "v4_cbuntil:F1",36,0,0,v4_cbuntil
+.globl v4_cbuntil
+	.type	v4_cbuntil,@function
+v4_cbuntil:
+.stabn 68,0,111,.LMa625-v4_cbuntil
+.LMa625:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,111,.LMb625-v4_cbuntil
+.LMb625:
+.LBB95:
+	xor %eax,%eax
+	call v4__dpush
+.L82:
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	call v4_z2dup
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L82
+	pop %ebx
+	leave
+	jmp v4_nip
+.LBE95:
+.stabn 68,0,111,.LM643-v4_cbuntil
+.LM643:
+	pop %ebx
+	leave
+	ret
+.Lfe95:
+	.size	 v4_cbuntil,.Lfe95-v4_cbuntil
+.stabn	192,0,0,.LBB95-v4_cbuntil
+.stabn	224,0,0,.LBE95-v4_cbuntil
+.Lscope95:
+.stabs	"",36,0,0,.Lscope95-v4_cbuntil
+.text
+	.align 4
+.stabs "v4_cbflag:F1",36,0,0,v4_cbflag
+.globl v4_cbflag
+	.type	v4_cbflag,@function
+v4_cbflag:
+.stabn 68,0,112,.LMa644-v4_cbflag
+.LMa644:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,112,.LMb644-v4_cbflag
+.LMb644:
+.LBB96:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	je .L85
+	call v4_drop
+	mov (v4_Lesstrue_Greater),%eax
+	call v4__dpush
+.L85:
+.LBE96:
+.stabn 68,0,112,.LM658-v4_cbflag
+.LM658:
+	pop %ebx
+	leave
+	ret
+.Lfe96:
+	.size	 v4_cbflag,.Lfe96-v4_cbflag
+.stabn	192,0,0,.LBB96-v4_cbflag
+.stabn	224,0,0,.LBE96-v4_cbflag
+.Lscope96:
+.stabs	"",36,0,0,.Lscope96-v4_cbflag
+.text
+	.align 4
+.stabs "v4_dense:F1",36,0,0,v4_dense
+.globl v4_dense
+	.type	v4_dense,@function
+v4_dense:
+.stabn 68,0,154,.LMa659-v4_dense
+.LMa659:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,154,.LMb659-v4_dense
+.LMb659:
+.LBB97:
+	call v4__dpop
+	call v4__dpush
+	cmp $5,%eax
+	ja .L93
+	mov .LT93(,%eax,4),%eax
+	jmp *%eax
+.section	.rodata
+	.align 4
+.LT93:
+	.long .L361
+	.long .L362
+	.long .L363
+	.long .L364
+	.long .L365
+	.long .L366
+.text
+.L361:
+	mov $10,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L87
+.L88:
+.L362:
+	mov $11,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L87
+.L89:
+.L363:
+	mov $12,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L87
+.L90:
+.L364:
+	mov $13,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L87
+.L91:
+.L365:
+	mov $14,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L87
+.L92:
+.L366:
+	mov $15,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L87
+.L93:
+.stabn 68,0,158,.LM727-v4_dense
+.LM727:
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	call v4__dpush
+	call v4_swap
+.L87:
+	call v4__dpop
+.LBE97:
+.stabn 68,0,159,.LM739-v4_dense
+.LM739:
+	pop %ebx
+	leave
+	ret
+.Lfe97:
+	.size	 v4_dense,.Lfe97-v4_dense
+.stabn	192,0,0,.LBB97-v4_dense
+.stabn	224,0,0,.LBE97-v4_dense
+.Lscope97:
+.stabs	"",36,0,0,.Lscope97-v4_dense
+.text
+	.align 4
+.stabs "v4_gapped:F1",36,0,0,v4_gapped
+.globl v4_gapped
+	.type	v4_gapped,@function
+v4_gapped:
+.stabn 68,0,160,.LMa740-v4_gapped
+.LMa740:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,160,.LMb740-v4_gapped
+.LMb740:
+.LBB98:
+	call v4__dpop
+	call v4__dpush
+	sub $-2,%eax
+	cmp $5,%eax
+	ja .L100
+	mov .LT100(,%eax,4),%eax
+	jmp *%eax
+.section	.rodata
+	.align 4
+.LT100:
+	.long .L367
+	.long .L368
+	.long .L369
+	.long .L100
+	.long .L370
+	.long .L371
+.text
+.L367:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_swap
+	jmp .L95
+.L96:
+.L368:
+	mov $2,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L95
+.L97:
+.L369:
+	mov $3,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L95
+.L98:
+.L370:
+	mov $4,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L95
+.L99:
+.L371:
+	mov $5,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L95
+.L100:
+.stabn 68,0,164,.LM797-v4_gapped
+.LM797:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_swap
+.L95:
+	call v4__dpop
+.LBE98:
+.stabn 68,0,165,.LM803-v4_gapped
+.LM803:
+	pop %ebx
+	leave
+	ret
+.Lfe98:
+	.size	 v4_gapped,.Lfe98-v4_gapped
+.stabn	192,0,0,.LBB98-v4_gapped
+.stabn	224,0,0,.LBE98-v4_gapped
+.Lscope98:
+.stabs	"",36,0,0,.Lscope98-v4_gapped
+.text
+	.align 4
+.stabs "v4_sparse:F1",36,0,0,v4_sparse
+.globl v4_sparse
+	.type	v4_sparse,@function
+v4_sparse:
+.stabn 68,0,166,.LMa804-v4_sparse
+.LMa804:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,166,.LMb804-v4_sparse
+.LMb804:
+.LBB99:
+	call v4__dpop
+	mov $100,%edx
+	call v4__dpush
+	cmp %edx,%eax
+	jl .L378
+	mov $100,%edx
+	cmp %edx,%eax
+	je .L375
+	mov $1000,%edx
+	cmp %edx,%eax
+	je .L376
+	mov $65536,%edx
+	cmp %edx,%eax
+	je .L377
+	jmp .L108
+.L378:
+	mov $-1000,%edx
+	cmp %edx,%eax
+	je .L372
+	xor %edx,%edx
+	dec %edx
+	cmp %edx,%eax
+	je .L373
+	mov $7,%edx
+	cmp %edx,%eax
+	je .L374
+	jmp .L108
+.L372:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_swap
+	jmp .L102
+.L103:
+.L373:
+	mov $2,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L102
+.L104:
+.L374:
+	mov $3,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L102
+.L105:
+.L375:
+	mov $4,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L102
+.L106:
+.L376:
+	mov $5,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L102
+.L107:
+.L377:
+	mov $6,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L102
+.L108:
+.stabn 68,0,170,.LM888-v4_sparse
+.LM888:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_swap
+.L102:
+	call v4__dpop
+.LBE99:
+.stabn 68,0,171,.LM894-v4_sparse
+.LM894:
+	pop %ebx
+	leave
+	ret
+.Lfe99:
+	.size	 v4_sparse,.Lfe99-v4_sparse
+.stabn	192,0,0,.LBB99-v4_sparse
+.stabn	224,0,0,.LBE99-v4_sparse
+.Lscope99:
+.stabs	"",36,0,0,.Lscope99-v4_sparse
+.text
+	.align 4
+.stabs "v4_nodefault:F1",36,0,0,v4_nodefault
+.globl v4_nodefault
+	.type	v4_nodefault,@function
+v4_nodefault:
+.stabn 68,0,172,.LMa895-v4_nodefault
+.LMa895:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,172,.LMb895-v4_nodefault
+.LMb895:
+.LBB100:
+	call v4__dpop
+	call v4__dpush
+	sub $1,%eax
+	cmp $3,%eax
+	ja .L114
+	mov .LT114(,%eax,4),%eax
+	jmp *%eax
+.section	.rodata
+	.align 4
+.LT114:
+	.long .L379
+	.long .L380
+	.long .L381
+	.long .L382
+.text
+.L379:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_swap
+	jmp .L110
+.L111:
+.L380:
+	mov $2,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L110
+.L112:
+.L381:
+	mov $3,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L110
+.L113:
+.L382:
+	mov $4,%eax
+	call v4__dpush
+	call v4_swap
+.L114:
+.L110:
+	call v4__dpop
+.LBE100:
+.stabn 68,0,176,.LM944-v4_nodefault
+.LM944:
+	pop %ebx
+	leave
+	ret
+.Lfe100:
+	.size	 v4_nodefault,.Lfe100-v4_nodefault
+.stabn	192,0,0,.LBB100-v4_nodefault
+.stabn	224,0,0,.LBE100-v4_nodefault
+.Lscope100:
+.stabs	"",36,0,0,.Lscope100-v4_nodefault
+.text
+	.align 4
+.stabs "v4_Slash1:F1",36,0,0,v4_Slash1
+.globl v4_Slash1
+	.type	v4_Slash1,@function
+v4_Slash1:
+.stabn 68,0,211,.LMa945-v4_Slash1
+.LMa945:
+.stabn 68,0,211,.LMb945-v4_Slash1
+.LMb945:
+.LBB101:
+	call v4__dpop
+	call v4__dpush
+.LBE101:
+.stabn 68,0,211,.LM953-v4_Slash1
+.LM953:
+	ret
+.Lfe101:
+	.size	 v4_Slash1,.Lfe101-v4_Slash1
+.stabn	192,0,0,.LBB101-v4_Slash1
+.stabn	224,0,0,.LBE101-v4_Slash1
+.Lscope101:
+.stabs	"",36,0,0,.Lscope101-v4_Slash1
+.text
+	.align 4
+.stabs "v4_mod1:F1",36,0,0,v4_mod1
+.globl v4_mod1
+	.type	v4_mod1,@function
+v4_mod1:
+.stabn 68,0,211,.LMa954-v4_mod1
+.LMa954:
+.stabn 68,0,211,.LMb954-v4_mod1
+.LMb954:
+.LBB103:
+	call v4__dpop
+	xor %eax,%eax
+	call v4__dpush
+.LBE103:
+.stabn 68,0,211,.LM962-v4_mod1
+.LM962:
+	ret
+.Lfe103:
+	.size	 v4_mod1,.Lfe103-v4_mod1
+.stabn	192,0,0,.LBB103-v4_mod1
+.stabn	224,0,0,.LBE103-v4_mod1
+.Lscope103:
+.stabs	"",36,0,0,.Lscope103-v4_mod1
+.text
+	.align 4
+.stabs "v4_Slash2:F1",36,0,0,v4_Slash2
+.globl v4_Slash2
+	.type	v4_Slash2,@function
+v4_Slash2:
+.stabn 68,0,212,.LMa963-v4_Slash2
+.LMa963:
+.stabn 68,0,212,.LMb963-v4_Slash2
+.LMb963:
+.LBB105:
+	call v4__dpop
+	mov %eax,%edx
+	sar $31,%edx
+	shr $31,%edx
+	add %edx,%eax
+	sar $1,%eax
+	call v4__dpush
+.LBE105:
+.stabn 68,0,212,.LM971-v4_Slash2
+.LM971:
+	ret
+.Lfe105:
+	.size	 v4_Slash2,.Lfe105-v4_Slash2
+.stabn	192,0,0,.LBB105-v4_Slash2
+.stabn	224,0,0,.LBE105-v4_Slash2
+.Lscope105:
+.stabs	"",36,0,0,.Lscope105-v4_Slash2
+.text
+	.align 4
+.stabs "v4_mod2:F1",36,0,0,v4_mod2
+.globl v4_mod2
+	.type	v4_mod2,@function
+v4_mod2:
+.stabn 68,0,212,.LMa972-v4_mod2
+.LMa972:
+.stabn 68,0,212,.LMb972-v4_mod2
+.LMb972:
+.LBB106:
+	call v4__dpop
+	mov %eax,%edx
+	sar $31,%edx
+	shr $31,%edx
+	add %edx,%eax
+	and $1,%eax
+	sub %edx,%eax
+	call v4__dpush
+.LBE106:
+.stabn 68,0,212,.LM980-v4_mod2
+.LM980:
+	ret
+.Lfe106:
+	.size	 v4_mod2,.Lfe106-v4_mod2
+.stabn	192,0,0,.LBB106-v4_mod2
+.stabn	224,0,0,.LBE106-v4_mod2
+.Lscope106:
+.stabs	"",36,0,0,.Lscope106-v4_mod2
+.text
+	.align 4
+.stabs "v4_Slash3:F1",36,0,0,v4_Slash3
+.globl v4_Slash3
+	.type	v4_Slash3,@function
+v4_Slash3:
+.stabn 68,0,213,.LMa981-v4_Slash3
+.LMa981:
+.stabn 68,0,213,.LMb981-v4_Slash3
+.LMb981:
+.LBB107:
+	call v4__dpop
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	call v4__dpush
+.LBE107:
+.stabn 68,0,213,.LM989-v4_Slash3
+.LM989:
+	ret
+.Lfe107:
+	.size	 v4_Slash3,.Lfe107-v4_Slash3
+.stabn	192,0,0,.LBB107-v4_Slash3
+.stabn	224,0,0,.LBE107-v4_Slash3
+.Lscope107:
+.stabs	"",36,0,0,.Lscope107-v4_Slash3
+.text
+	.align 4
+.stabs "v4_mod3:F1",36,0,0,v4_mod3
+.globl v4_mod3
+	.type	v4_mod3,@function
+v4_mod3:
+.stabn 68,0,213,.LMa990-v4_mod3
+.LMa990:
+.stabn 68,0,213,.LMb990-v4_mod3
+.LMb990:
+.LBB108:
+	call v4__dpop
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $3,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	call v4__dpush
+.LBE108:
+.stabn 68,0,213,.LM998-v4_mod3
+.LM998:
+	ret
+.Lfe108:
+	.size	 v4_mod3,.Lfe108-v4_mod3
+.stabn	192,0,0,.LBB108-v4_mod3
+.stabn	224,0,0,.LBE108-v4_mod3
+.Lscope108:
+.stabs	"",36,0,0,.Lscope108-v4_mod3
+.text
+	.align 4
+.stabs "v4_Slash_Minus3:F1",36,0,0,v4_Slash_Minus3
+.globl v4_Slash_Minus3
+	.type	v4_Slash_Minus3,@function
+v4_Slash_Minus3:
+.stabn 68,0,214,.LMa999-v4_Slash_Minus3
+.LMa999:
+.stabn 68,0,214,.LMb999-v4_Slash_Minus3
+.LMb999:
+.LBB109:
+	call v4__dpop
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	neg %eax
+	call v4__dpush
+.LBE109:
+.stabn 68,0,214,.LM1007-v4_Slash_Minus3
+.LM1007:
+	ret
+.Lfe109:
+	.size	 v4_Slash_Minus3,.Lfe109-v4_Slash_Minus3
+.stabn	192,0,0,.LBB109-v4_Slash_Minus3
+.stabn	224,0,0,.LBE109-v4_Slash_Minus3
+.Lscope109:
+.stabs	"",36,0,0,.Lscope109-v4_Slash_Minus3
+.text
+	.align 4
+.stabs "v4_mod_Minus3:F1",36,0,0,v4_mod_Minus3
+.globl v4_mod_Minus3
+	.type	v4_mod_Minus3,@function
+v4_mod_Minus3:
+.stabn 68,0,214,.LMa1008-v4_mod_Minus3
+.LMa1008:
+.stabn 68,0,214,.LMb1008-v4_mod_Minus3
+.LMb1008:
+.LBB110:
+	call v4__dpop
+	push %eax
+	mov $1431655766,%edx
+	imul %edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $3,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	call v4__dpush
+.LBE110:
+.stabn 68,0,214,.LM1016-v4_mod_Minus3
+.LM1016:
+	ret
+.Lfe110:
+	.size	 v4_mod_Minus3,.Lfe110-v4_mod_Minus3
+.stabn	192,0,0,.LBB110-v4_mod_Minus3
+.stabn	224,0,0,.LBE110-v4_mod_Minus3
+.Lscope110:
+.stabs	"",36,0,0,.Lscope110-v4_mod_Minus3
+.text
+	.align 4
+.stabs "v4_Slash7:F1",36,0,0,v4_Slash7
+.globl v4_Slash7
+	.type	v4_Slash7,@function
+v4_Slash7:
+.stabn 68,0,215,.LMa1017-v4_Slash7
+.LMa1017:
+.stabn 68,0,215,.LMb1017-v4_Slash7
+.LMb1017:
+.LBB111:
+	call v4__dpop
+	push %eax
+	mov $-1840700269,%edx
+	imul %edx
+	add (%esp),%edx
+	sar $2,%edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	call v4__dpush
+.LBE111:
+.stabn 68,0,215,.LM1025-v4_Slash7
+.LM1025:
+	ret
+.Lfe111:
+	.size	 v4_Slash7,.Lfe111-v4_Slash7
+.stabn	192,0,0,.LBB111-v4_Slash7
+.stabn	224,0,0,.LBE111-v4_Slash7
+.Lscope111:
+.stabs	"",36,0,0,.Lscope111-v4_Slash7
+.text
+	.align 4
+.stabs "v4_mod7:F1",36,0,0,v4_mod7
+.globl v4_mod7
+	.type	v4_mod7,@function
+v4_mod7:
+.stabn 68,0,215,.LMa1026-v4_mod7
+.LMa1026:
+.stabn 68,0,215,.LMb1026-v4_mod7
+.LMb1026:
+.LBB112:
+	call v4__dpop
+	push %eax
+	mov $-1840700269,%edx
+	imul %edx
+	add (%esp),%edx
+	sar $2,%edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $7,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	call v4__dpush
+.LBE112:
+.stabn 68,0,215,.LM1034-v4_mod7
+.LM1034:
+	ret
+.Lfe112:
+	.size	 v4_mod7,.Lfe112-v4_mod7
+.stabn	192,0,0,.LBB112-v4_mod7
+.stabn	224,0,0,.LBE112-v4_mod7
+.Lscope112:
+.stabs	"",36,0,0,.Lscope112-v4_mod7
+.text
+	.align 4
+.stabs "v4_Slash8:F1",36,0,0,v4_Slash8
+.globl v4_Slash8
+	.type	v4_Slash8,@function
+v4_Slash8:
+.stabn 68,0,216,.LMa1035-v4_Slash8
+.LMa1035:
+.stabn 68,0,216,.LMb1035-v4_Slash8
+.LMb1035:
+.LBB113:
+	call v4__dpop
+	mov %eax,%edx
+	sar $31,%edx
+	shr $29,%edx
+	add %edx,%eax
+	sar $3,%eax
+	call v4__dpush
+.LBE113:
+.stabn 68,0,216,.LM1043-v4_Slash8
+.LM1043:
+	ret
+.Lfe113:
+	.size	 v4_Slash8,.Lfe113-v4_Slash8
+.stabn	192,0,0,.LBB113-v4_Slash8
+.stabn	224,0,0,.LBE113-v4_Slash8
+.Lscope113:
+.stabs	"",36,0,0,.Lscope113-v4_Slash8
+.text
+	.align 4
+.stabs "v4_mod8:F1",36,0,0,v4_mod8
+.globl v4_mod8
+	.type	v4_mod8,@function
+v4_mod8:
+.stabn 68,0,216,.LMa1044-v4_mod8
+.LMa1044:
+.stabn 68,0,216,.LMb1044-v4_mod8
+.LMb1044:
+.LBB114:
+	call v4__dpop
+	mov %eax,%edx
+	sar $31,%edx
+	shr $29,%edx
+	add %edx,%eax
+	and $7,%eax
+	sub %edx,%eax
+	call v4__dpush
+.LBE114:
+.stabn 68,0,216,.LM1052-v4_mod8
+.LM1052:
+	ret
+.Lfe114:
+	.size	 v4_mod8,.Lfe114-v4_mod8
+.stabn	192,0,0,.LBB114-v4_mod8
+.stabn	224,0,0,.LBE114-v4_mod8
+.Lscope114:
+.stabs	"",36,0,0,.Lscope114-v4_mod8
+.text
+	.align 4
+.stabs "v4_Slash_Minus8:F1",36,0,0,v4_Slash_Minus8
+.globl v4_Slash_Minus8
+	.type	v4_Slash_Minus8,@function
+v4_Slash_Minus8:
+.stabn 68,0,217,.LMa1053-v4_Slash_Minus8
+.LMa1053:
+.stabn 68,0,217,.LMb1053-v4_Slash_Minus8
+.LMb1053:
+.LBB115:
+	call v4__dpop
+	mov %eax,%edx
+	sar $31,%edx
+	shr $29,%edx
+	add %edx,%eax
+	sar $3,%eax
+	neg %eax
+	call v4__dpush
+.LBE115:
+.stabn 68,0,217,.LM1061-v4_Slash_Minus8
+.LM1061:
+	ret
+.Lfe115:
+	.size	 v4_Slash_Minus8,.Lfe115-v4_Slash_Minus8
+.stabn	192,0,0,.LBB115-v4_Slash_Minus8
+.stabn	224,0,0,.LBE115-v4_Slash_Minus8
+.Lscope115:
+.stabs	"",36,0,0,.Lscope115-v4_Slash_Minus8
+.text
+	.align 4
+.stabs "v4_mod_Minus8:F1",36,0,0,v4_mod_Minus8
+.globl v4_mod_Minus8
+	.type	v4_mod_Minus8,@function
+v4_mod_Minus8:
+.stabn 68,0,217,.LMa1062-v4_mod_Minus8
+.LMa1062:
+.stabn 68,0,217,.LMb1062-v4_mod_Minus8
+.LMb1062:
+.LBB116:
+	call v4__dpop
+	mov %eax,%edx
+	sar $31,%edx
+	shr $29,%edx
+	add %edx,%eax
+	and $7,%eax
+	sub %edx,%eax
+	call v4__dpush
+.LBE116:
+.stabn 68,0,217,.LM1070-v4_mod_Minus8
+.LM1070:
+	ret
+.Lfe116:
+	.size	 v4_mod_Minus8,.Lfe116-v4_mod_Minus8
+.stabn	192,0,0,.LBB116-v4_mod_Minus8
+.stabn	224,0,0,.LBE116-v4_mod_Minus8
+.Lscope116:
+.stabs	"",36,0,0,.Lscope116-v4_mod_Minus8
+.text
+	.align 4
+.stabs "v4_Slash10:F1",36,0,0,v4_Slash10
+.globl v4_Slash10
+	.type	v4_Slash10,@function
+v4_Slash10:
+.stabn 68,0,218,.LMa1071-v4_Slash10
+.LMa1071:
+.stabn 68,0,218,.LMb1071-v4_Slash10
+.LMb1071:
+.LBB117:
+	call v4__dpop
+	push %eax
+	mov $1717986919,%edx
+	imul %edx
+	sar $2,%edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	call v4__dpush
+.LBE117:
+.stabn 68,0,218,.LM1079-v4_Slash10
+.LM1079:
+	ret
+.Lfe117:
+	.size	 v4_Slash10,.Lfe117-v4_Slash10
+.stabn	192,0,0,.LBB117-v4_Slash10
+.stabn	224,0,0,.LBE117-v4_Slash10
+.Lscope117:
+.stabs	"",36,0,0,.Lscope117-v4_Slash10
+.text
+	.align 4
+.stabs "v4_mod10:F1",36,0,0,v4_mod10
+.globl v4_mod10
+	.type	v4_mod10,@function
+v4_mod10:
+.stabn 68,0,218,.LMa1080-v4_mod10
+.LMa1080:
+.stabn 68,0,218,.LMb1080-v4_mod10
+.LMb1080:
+.LBB118:
+	call v4__dpop
+	push %eax
+	mov $1717986919,%edx
+	imul %edx
+	sar $2,%edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $10,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	call v4__dpush
+.LBE118:
+.stabn 68,0,218,.LM1088-v4_mod10
+.LM1088:
+	ret
+.Lfe118:
+	.size	 v4_mod10,.Lfe118-v4_mod10
+.stabn	192,0,0,.LBB118-v4_mod10
+.stabn	224,0,0,.LBE118-v4_mod10
+.Lscope118:
+.stabs	"",36,0,0,.Lscope118-v4_mod10
+.text
+	.align 4
+.stabs "v4_Slash_Minus10:F1",36,0,0,v4_Slash_Minus10
+.globl v4_Slash_Minus10
+	.type	v4_Slash_Minus10,@function
+v4_Slash_Minus10:
+.stabn 68,0,219,.LMa1089-v4_Slash_Minus10
+.LMa1089:
+.stabn 68,0,219,.LMb1089-v4_Slash_Minus10
+.LMb1089:
+.LBB119:
+	call v4__dpop
+	push %eax
+	mov $1717986919,%edx
+	imul %edx
+	sar $2,%edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	mov %edx,%eax
+	add $4,%esp
+	neg %eax
+	call v4__dpush
+.LBE119:
+.stabn 68,0,219,.LM1097-v4_Slash_Minus10
+.LM1097:
+	ret
+.Lfe119:
+	.size	 v4_Slash_Minus10,.Lfe119-v4_Slash_Minus10
+.stabn	192,0,0,.LBB119-v4_Slash_Minus10
+.stabn	224,0,0,.LBE119-v4_Slash_Minus10
+.Lscope119:
+.stabs	"",36,0,0,.Lscope119-v4_Slash_Minus10
+.text
+	.align 4
+.stabs "v4_mod_Minus10:F1",36,0,0,v4_mod_Minus10
+.globl v4_mod_Minus10
+	.type	v4_mod_Minus10,@function
+v4_mod_Minus10:
+.stabn 68,0,219,.LMa1098-v4_mod_Minus10
+.LMa1098:
+.stabn 68,0,219,.LMb1098-v4_mod_Minus10
+.LMb1098:
+.LBB120:
+	call v4__dpop
+	push %eax
+	mov $1717986919,%edx
+	imul %edx
+	sar $2,%edx
+	mov (%esp),%eax
+	shr $31,%eax
+	add %eax,%edx
+	imul $10,%edx,%edx
+	pop %eax
+	sub %edx,%eax
+	call v4__dpush
+.LBE120:
+.stabn 68,0,219,.LM1106-v4_mod_Minus10
+.LM1106:
+	ret
+.Lfe120:
+	.size	 v4_mod_Minus10,.Lfe120-v4_mod_Minus10
+.stabn	192,0,0,.LBB120-v4_mod_Minus10
+.stabn	224,0,0,.LBE120-v4_mod_Minus10
+.Lscope120:
+.stabs	"",36,0,0,.Lscope120-v4_mod_Minus10
+.text
+	.align 4
+.stabs "v4_Slash_Minus1:F1",36,0,0,v4_Slash_Minus1
+.globl v4_Slash_Minus1
+	.type	v4_Slash_Minus1,@function
+v4_Slash_Minus1:
+.stabn 68,0,220,.LMa1107-v4_Slash_Minus1
+.LMa1107:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,220,.LMb1107-v4_Slash_Minus1
+.LMb1107:
+.LBB121:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_Slash
+.LBE121:
+.stabn 68,0,220,.LM1112-v4_Slash_Minus1
+.LM1112:
+	pop %ebx
+	leave
+	ret
+.Lfe121:
+	.size	 v4_Slash_Minus1,.Lfe121-v4_Slash_Minus1
+.stabn	192,0,0,.LBB121-v4_Slash_Minus1
+.stabn	224,0,0,.LBE121-v4_Slash_Minus1
+.Lscope121:
+.stabs	"",36,0,0,.Lscope121-v4_Slash_Minus1
+.text
+	.align 4
+.stabs "v4_mod_Minus1:F1",36,0,0,v4_mod_Minus1
+.globl v4_mod_Minus1
+	.type	v4_mod_Minus1,@function
+v4_mod_Minus1:
+.stabn 68,0,220,.LMa1113-v4_mod_Minus1
+.LMa1113:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,220,.LMb1113-v4_mod_Minus1
+.LMb1113:
+.LBB122:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_mod
+.LBE122:
+.stabn 68,0,220,.LM1118-v4_mod_Minus1
+.LM1118:
+	pop %ebx
+	leave
+	ret
+.Lfe122:
+	.size	 v4_mod_Minus1,.Lfe122-v4_mod_Minus1
+.stabn	192,0,0,.LBB122-v4_mod_Minus1
+.stabn	224,0,0,.LBE122-v4_mod_Minus1
+.Lscope122:
+.stabs	"",36,0,0,.Lscope122-v4_mod_Minus1
+.text
+	.align 4
+.stabs "v4_Star0:F1",36,0,0,v4_Star0
+.globl v4_Star0
+	.type	v4_Star0,@function
+v4_Star0:
+.stabn 68,0,221,.LMa1119-v4_Star0
+.LMa1119:
+.stabn 68,0,221,.LMb1119-v4_Star0
+.LMb1119:
+.LBB123:
+	call v4__dpop
+	xor %eax,%eax
+	call v4__dpush
+.LBE123:
+.stabn 68,0,221,.LM1127-v4_Star0
+.LM1127:
+	ret
+.Lfe123:
+	.size	 v4_Star0,.Lfe123-v4_Star0
+.stabn	192,0,0,.LBB123-v4_Star0
+.stabn	224,0,0,.LBE123-v4_Star0
+.Lscope123:
+.stabs	"",36,0,0,.Lscope123-v4_Star0
+.text
+	.align 4
+.stabs "v4_Star1:F1",36,0,0,v4_Star1
+.globl v4_Star1
+	.type	v4_Star1,@function
+v4_Star1:
+.stabn 68,0,221,.LMa1128-v4_Star1
+.LMa1128:
+.stabn 68,0,221,.LMb1128-v4_Star1
+.LMb1128:
+.LBB124:
+	call v4__dpop
+	call v4__dpush
+.LBE124:
+.stabn 68,0,221,.LM1136-v4_Star1
+.LM1136:
+	ret
+.Lfe124:
+	.size	 v4_Star1,.Lfe124-v4_Star1
+.stabn	192,0,0,.LBB124-v4_Star1
+.stabn	224,0,0,.LBE124-v4_Star1
+.Lscope124:
+.stabs	"",36,0,0,.Lscope124-v4_Star1
+.text
+	.align 4
+.stabs "v4_Star_Minus1:F1",36,0,0,v4_Star_Minus1
+.globl v4_Star_Minus1
+	.type	v4_Star_Minus1,@function
+v4_Star_Minus1:
+.stabn 68,0,221,.LMa1137-v4_Star_Minus1
+.LMa1137:
+.stabn 68,0,221,.LMb1137-v4_Star_Minus1
+.LMb1137:
+.LBB125:
+	call v4__dpop
+	neg %eax
+	call v4__dpush
+.LBE125:
+.stabn 68,0,221,.LM1145-v4_Star_Minus1
+.LM1145:
+	ret
+.Lfe125:
+	.size	 v4_Star_Minus1,.Lfe125-v4_Star_Minus1
+.stabn	192,0,0,.LBB125-v4_Star_Minus1
+.stabn	224,0,0,.LBE125-v4_Star_Minus1
+.Lscope125:
+.stabs	"",36,0,0,.Lscope125-v4_Star_Minus1
+.text
+	.align 4
+.stabs "v4_Star3:F1",36,0,0,v4_Star3
+.globl v4_Star3
+	.type	v4_Star3,@function
+v4_Star3:
+.stabn 68,0,221,.LMa1146-v4_Star3
+.LMa1146:
+.stabn 68,0,221,.LMb1146-v4_Star3
+.LMb1146:
+.LBB126:
+	call v4__dpop
+	lea (%eax,%eax,2),%eax
+	call v4__dpush
+.LBE126:
+.stabn 68,0,221,.LM1154-v4_Star3
+.LM1154:
+	ret
+.Lfe126:
+	.size	 v4_Star3,.Lfe126-v4_Star3
+.stabn	192,0,0,.LBB126-v4_Star3
+.stabn	224,0,0,.LBE126-v4_Star3
+.Lscope126:
+.stabs	"",36,0,0,.Lscope126-v4_Star3
+.text
+	.align 4
+.stabs "v4_Star8:F1",36,0,0,v4_Star8
+.globl v4_Star8
+	.type	v4_Star8,@function
+v4_Star8:
+.stabn 68,0,222,.LMa1155-v4_Star8
+.LMa1155:
+.stabn 68,0,222,.LMb1155-v4_Star8
+.LMb1155:
+.LBB127:
+	call v4__dpop
+	shl $3,%eax
+	call v4__dpush
+.LBE127:
+.stabn 68,0,222,.LM1163-v4_Star8
+.LM1163:
+	ret
+.Lfe127:
+	.size	 v4_Star8,.Lfe127-v4_Star8
+.stabn	192,0,0,.LBB127-v4_Star8
+.stabn	224,0,0,.LBE127-v4_Star8
+.Lscope127:
+.stabs	"",36,0,0,.Lscope127-v4_Star8
+.text
+	.align 4
+.stabs "v4_Star_Minus8:F1",36,0,0,v4_Star_Minus8
+.globl v4_Star_Minus8
+	.type	v4_Star_Minus8,@function
+v4_Star_Minus8:
+.stabn 68,0,222,.LMa1164-v4_Star_Minus8
+.LMa1164:
+.stabn 68,0,222,.LMb1164-v4_Star_Minus8
+.LMb1164:
+.LBB128:
+	call v4__dpop
+	imul $-8,%eax,%eax
+	call v4__dpush
+.LBE128:
+.stabn 68,0,222,.LM1172-v4_Star_Minus8
+.LM1172:
+	ret
+.Lfe128:
+	.size	 v4_Star_Minus8,.Lfe128-v4_Star_Minus8
+.stabn	192,0,0,.LBB128-v4_Star_Minus8
+.stabn	224,0,0,.LBE128-v4_Star_Minus8
+.Lscope128:
+.stabs	"",36,0,0,.Lscope128-v4_Star_Minus8
+.text
+	.align 4
+.stabs "v4_Star10:F1",36,0,0,v4_Star10
+.globl v4_Star10
+	.type	v4_Star10,@function
+v4_Star10:
+.stabn 68,0,222,.LMa1173-v4_Star10
+.LMa1173:
+.stabn 68,0,222,.LMb1173-v4_Star10
+.LMb1173:
+.LBB129:
+	call v4__dpop
+	lea (%eax,%eax,4),%eax
+	add %eax,%eax
+	call v4__dpush
+.LBE129:
+.stabn 68,0,222,.LM1181-v4_Star10
+.LM1181:
+	ret
+.Lfe129:
+	.size	 v4_Star10,.Lfe129-v4_Star10
+.stabn	192,0,0,.LBB129-v4_Star10
+.stabn	224,0,0,.LBE129-v4_Star10
+.Lscope129:
+.stabs	"",36,0,0,.Lscope129-v4_Star10
+.text
+	.align 4
+.stabs "v4_Star_Minus7:F1",36,0,0,v4_Star_Minus7
+.globl v4_Star_Minus7
+	.type	v4_Star_Minus7,@function
+v4_Star_Minus7:
+.stabn 68,0,222,.LMa1182-v4_Star_Minus7
+.LMa1182:
+.stabn 68,0,222,.LMb1182-v4_Star_Minus7
+.LMb1182:
+.LBB130:
+	call v4__dpop
+	imul $-7,%eax,%eax
+	call v4__dpush
+.LBE130:
+.stabn 68,0,222,.LM1190-v4_Star_Minus7
+.LM1190:
+	ret
+.Lfe130:
+	.size	 v4_Star_Minus7,.Lfe130-v4_Star_Minus7
+.stabn	192,0,0,.LBB130-v4_Star_Minus7
+.stabn	224,0,0,.LBE130-v4_Star_Minus7
+.Lscope130:
+.stabs	"",36,0,0,.Lscope130-v4_Star_Minus7
+.text
+	.align 4
+.stabs "v4_ncells:F1",36,0,0,v4_ncells
+.globl v4_ncells
+	.type	v4_ncells,@function
+v4_ncells:
+.stabn 68,0,223,.LMa1191-v4_ncells
+.LMa1191:
+.stabn 68,0,223,.LMb1191-v4_ncells
+.LMb1191:
+.LBB131:
+	call v4__dpop
+	shl $2,%eax
+	call v4__dpush
+.LBE131:
+.stabn 68,0,223,.LM1197-v4_ncells
+.LM1197:
+	ret
+.Lfe131:
+	.size	 v4_ncells,.Lfe131-v4_ncells
+.stabn	192,0,0,.LBB131-v4_ncells
+.stabn	224,0,0,.LBE131-v4_ncells
+.Lscope131:
+.stabs	"",36,0,0,.Lscope131-v4_ncells
+.text
+	.align 4
+.stabs "v4_dividend_Comma:F1",36,0,0,v4_dividend_Comma
+.globl v4_dividend_Comma
+	.type	v4_dividend_Comma,@function
+v4_dividend_Comma:
+.stabn 68,0,230,.LMa1198-v4_dividend_Comma
+.LMa1198:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,230,.LMb1198-v4_dividend_Comma
+.LMb1198:
+.LBB134:
+	lea v4_dividends,%eax
+	mov %eax,%ecx
+	mov (v4_Hashdividends),%eax
+	shl $2,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	call v4__dpush
+	call v4_Store
+	xor %eax,%eax
+	inc %eax
+	mov (v4_Hashdividends),%edx
+	add %edx,%eax
+	mov %eax,(v4_Hashdividends)
+.LBE134:
+.stabn 68,0,230,.LM1226-v4_dividend_Comma
+.LM1226:
+	pop %ebx
+	leave
+	ret
+.Lfe134:
+	.size	 v4_dividend_Comma,.Lfe134-v4_dividend_Comma
+.stabn	192,0,0,.LBB134-v4_dividend_Comma
+.stabn	224,0,0,.LBE134-v4_dividend_Comma
+.Lscope134:
+.stabs	"",36,0,0,.Lscope134-v4_dividend_Comma
+.text
+	.align 4
+.stabs "v4_dividend:F1",36,0,0,v4_dividend
+.globl v4_dividend
+	.type	v4_dividend,@function
+v4_dividend:
+.stabn 68,0,231,.LMa1227-v4_dividend
+.LMa1227:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,231,.LMb1227-v4_dividend
+.LMb1227:
+.LBB136:
+	call v4__dpop
+	shl $2,%eax
+	mov %eax,%ecx
+	lea v4_dividends,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_Fetch
+.LBE136:
+.stabn 68,0,231,.LM1241-v4_dividend
+.LM1241:
+	pop %ebx
+	leave
+	ret
+.Lfe136:
+	.size	 v4_dividend,.Lfe136-v4_dividend
+.stabn	192,0,0,.LBB136-v4_dividend
+.stabn	224,0,0,.LBE136-v4_dividend
+.Lscope136:
+.stabs	"",36,0,0,.Lscope136-v4_dividend
+.text
+	.align 4
+.stabs "v4_mismatches:F1",36,0,0,v4_mismatches
+.globl v4_mismatches
+	.type	v4_mismatches,@function
+v4_mismatches:
+.stabn 68,0,232,.LMa1242-v4_mismatches
+.LMa1242:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,232,.LMb1242-v4_mismatches
+.LMb1242:
+.LBB137:
+.stabn 68,0,233,.LM1243-v4_mismatches
+.LM1243:
+	xor %eax,%eax
+	call v4__dpush
+	mov (v4_Hashdividends),%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L148:
+.stabn 68,0,234,.LM1257-v4_mismatches
+.LM1257:
+	call v4_i
+	call v4__dpop
+	shl $2,%eax
+	mov %eax,%ecx
+	lea v4_dividends,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	call v4__dpush
+	call v4_Fetch
+.stabn 68,0,234,.LM1271-v4_mismatches
+.LM1271:
+	mov $4,%eax
+	call v4__dpush
+	call v4_pick
+	call v4_execute
+.stabn 68,0,235,.LM1275-v4_mismatches
+.LM1275:
+	call v4_i
+	call v4__dpop
+	shl $2,%eax
+	mov %eax,%ecx
+	lea v4_dividends,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	call v4__dpush
+	call v4_Fetch
+.stabn 68,0,235,.LM1289-v4_mismatches
+.LM1289:
+	mov $4,%eax
+	call v4__dpush
+	call v4_pick
+	mov $4,%eax
+	call v4__dpush
+	call v4_pick
+	call v4_execute
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	je .L150
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+.L150:
+.stabn 68,0,237,.LM1307-v4_mismatches
+.LM1307:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L148
+	call v4__rpop
+	call v4__rpop
+	call v4_nip
+	call v4_nip
+	pop %ebx
+	leave
+	jmp v4_nip
+.LBE137:
+.stabn 68,0,237,.LM1322-v4_mismatches
+.LM1322:
+	pop %ebx
+	leave
+	ret
+.Lfe137:
+	.size	 v4_mismatches,.Lfe137-v4_mismatches
+.stabn	192,0,0,.LBB137-v4_mismatches
+.stabn	224,0,0,.LBE137-v4_mismatches
+.Lscope137:
+.stabs	"",36,0,0,.Lscope137-v4_mismatches
+.text
+	.align 4
+.stabs "v4_use_Minushundred:F1",36,0,0,v4_use_Minushundred
+.globl v4_use_Minushundred
+	.type	v4_use_Minushundred,@function
+v4_use_Minushundred:
+.stabn 68,0,297,.LMa1323-v4_use_Minushundred
+.LMa1323:
+.stabn 68,0,297,.LMb1323-v4_use_Minushundred
+.LMb1323:
+.LBB144:
+	mov $200,%eax
+	call v4__dpush
+.LBE144:
+.stabn 68,0,297,.LM1328-v4_use_Minushundred
+.LM1328:
+	ret
+.Lfe144:
+	.size	 v4_use_Minushundred,.Lfe144-v4_use_Minushundred
+.stabn	192,0,0,.LBB144-v4_use_Minushundred
+.stabn	224,0,0,.LBE144-v4_use_Minushundred
+.Lscope144:
+.stabs	"",36,0,0,.Lscope144-v4_use_Minushundred
+.text
+	.align 4
+.stabs "v4_use_Minusminus_Minusone:F1",36,0,0,v4_use_Minusminus_Minusone
+.globl v4_use_Minusminus_Minusone
+	.type	v4_use_Minusminus_Minusone,@function
+v4_use_Minusminus_Minusone:
+.stabn 68,0,298,.LMa1329-v4_use_Minusminus_Minusone
+.LMa1329:
+.stabn 68,0,298,.LMb1329-v4_use_Minusminus_Minusone
+.LMb1329:
+.LBB145:
+	mov $4,%eax
+	call v4__dpush
+.LBE145:
+.stabn 68,0,298,.LM1336-v4_use_Minusminus_Minusone
+.LM1336:
+	ret
+.Lfe145:
+	.size	 v4_use_Minusminus_Minusone,.Lfe145-v4_use_Minusminus_Minusone
+.stabn	192,0,0,.LBB145-v4_use_Minusminus_Minusone
+.stabn	224,0,0,.LBE145-v4_use_Minusminus_Minusone
+.Lscope145:
+.stabs	"",36,0,0,.Lscope145-v4_use_Minusminus_Minusone
+.text
+	.align 4
+.stabs "v4_use_Minusbiggest:F1",36,0,0,v4_use_Minusbiggest
+.globl v4_use_Minusbiggest
+	.type	v4_use_Minusbiggest,@function
+v4_use_Minusbiggest:
+.stabn 68,0,299,.LMa1337-v4_use_Minusbiggest
+.LMa1337:
+.stabn 68,0,299,.LMb1337-v4_use_Minusbiggest
+.LMb1337:
+.LBB146:
+	mov $-2147483648,%eax
+	call v4__dpush
+.LBE146:
+.stabn 68,0,299,.LM1342-v4_use_Minusbiggest
+.LM1342:
+	ret
+.Lfe146:
+	.size	 v4_use_Minusbiggest,.Lfe146-v4_use_Minusbiggest
+.stabn	192,0,0,.LBB146-v4_use_Minusbiggest
+.stabn	224,0,0,.LBE146-v4_use_Minusbiggest
+.Lscope146:
+.stabs	"",36,0,0,.Lscope146-v4_use_Minusbiggest
+.text
+	.align 4
+.stabs "v4_use_Minusthree_Minushundred:F1",36,0,0,v4_use_Minusthree_Minushundred
+.globl v4_use_Minusthree_Minushundred
+	.type	v4_use_Minusthree_Minushundred,@function
+v4_use_Minusthree_Minushundred:
+.stabn 68,0,300,.LMa1343-v4_use_Minusthree_Minushundred
+.LMa1343:
+.stabn 68,0,300,.LMb1343-v4_use_Minusthree_Minushundred
+.LMb1343:
+.LBB147:
+	mov $301,%eax
+	call v4__dpush
+.LBE147:
+.stabn 68,0,300,.LM1348-v4_use_Minusthree_Minushundred
+.LM1348:
+	ret
+.Lfe147:
+	.size	 v4_use_Minusthree_Minushundred,.Lfe147-v4_use_Minusthree_Minushundred
+.stabn	192,0,0,.LBB147-v4_use_Minusthree_Minushundred
+.stabn	224,0,0,.LBE147-v4_use_Minusthree_Minushundred
+.Lscope147:
+.stabs	"",36,0,0,.Lscope147-v4_use_Minusthree_Minushundred
+.text
+	.align 4
+.stabs "v4_use_Minuszero:F1",36,0,0,v4_use_Minuszero
+.globl v4_use_Minuszero
+	.type	v4_use_Minuszero,@function
+v4_use_Minuszero:
+.stabn 68,0,301,.LMa1349-v4_use_Minuszero
+.LMa1349:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,301,.LMb1349-v4_use_Minuszero
+.LMb1349:
+.LBB148:
+	xor %eax,%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_Slash
+.LBE148:
+.stabn 68,0,301,.LM1354-v4_use_Minuszero
+.LM1354:
+	pop %ebx
+	leave
+	ret
+.Lfe148:
+	.size	 v4_use_Minuszero,.Lfe148-v4_use_Minuszero
+.stabn	192,0,0,.LBB148-v4_use_Minuszero
+.stabn	224,0,0,.LBE148-v4_use_Minuszero
+.Lscope148:
+.stabs	"",36,0,0,.Lscope148-v4_use_Minuszero
+.text
+	.align 4
+.stabs "v4_use_Minusin_Minuscase:F1",36,0,0,v4_use_Minusin_Minuscase
+.globl v4_use_Minusin_Minuscase
+	.type	v4_use_Minusin_Minuscase,@function
+v4_use_Minusin_Minuscase:
+.stabn 68,0,302,.LMa1355-v4_use_Minusin_Minuscase
+.LMa1355:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,302,.LMb1355-v4_use_Minusin_Minuscase
+.LMb1355:
+.LBB149:
+	call v4__dpop
+	mov $100,%edx
+	call v4__dpush
+	cmp %edx,%eax
+	jl .L387
+	mov $100,%edx
+	cmp %edx,%eax
+	je .L384
+	mov $2147483647,%edx
+	cmp %edx,%eax
+	je .L386
+	jmp .L161
+.L387:
+	xor %edx,%edx
+	dec %edx
+	cmp %edx,%eax
+	je .L385
+	xor %edx,%edx
+	cmp %edx,%eax
+	je .L383
+	jmp .L161
+.L383:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_swap
+	jmp .L157
+.L158:
+.L384:
+	mov $2,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L157
+.L159:
+.L385:
+	mov $3,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L157
+.L160:
+.L386:
+	mov $4,%eax
+	call v4__dpush
+	call v4_swap
+	jmp .L157
+.L161:
+.stabn 68,0,306,.LM1413-v4_use_Minusin_Minuscase
+.LM1413:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_swap
+.L157:
+	call v4__dpop
+.LBE149:
+.stabn 68,0,307,.LM1419-v4_use_Minusin_Minuscase
+.LM1419:
+	pop %ebx
+	leave
+	ret
+.Lfe149:
+	.size	 v4_use_Minusin_Minuscase,.Lfe149-v4_use_Minusin_Minuscase
+.stabn	192,0,0,.LBB149-v4_use_Minusin_Minuscase
+.stabn	224,0,0,.LBE149-v4_use_Minusin_Minuscase
+.Lscope149:
+.stabs	"",36,0,0,.Lscope149-v4_use_Minusin_Minuscase
+.text
+	.align 4
+.stabs "v4_clamp:F1",36,0,0,v4_clamp
+.globl v4_clamp
+	.type	v4_clamp,@function
+v4_clamp:
+.stabn 68,0,324,.LMa1420-v4_clamp
+.LMa1420:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,324,.LMb1420-v4_clamp
+.LMb1420:
+.LBB151:
+.stabn 68,0,325,.LM1421-v4_clamp
+.LM1421:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L163
+	call v4_drop
+	xor %eax,%eax
+	call v4__dpush
+	jmp .L162
+.L163:
+.stabn 68,0,326,.LM1432-v4_clamp
+.LM1432:
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L164
+	call v4_drop
+	mov $100,%eax
+	call v4__dpush
+.L164:
+.L162:
+.LBE151:
+.stabn 68,0,326,.LM1447-v4_clamp
+.LM1447:
+	pop %ebx
+	leave
+	ret
+.Lfe151:
+	.size	 v4_clamp,.Lfe151-v4_clamp
+.stabn	192,0,0,.LBB151-v4_clamp
+.stabn	224,0,0,.LBE151-v4_clamp
+.Lscope151:
+.stabs	"",36,0,0,.Lscope151-v4_clamp
+.text
+	.align 4
+.stabs "v4_sign:F1",36,0,0,v4_sign
+.globl v4_sign
+	.type	v4_sign,@function
+v4_sign:
+.stabn 68,0,327,.LMa1448-v4_sign
+.LMa1448:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,327,.LMb1448-v4_sign
+.LMb1448:
+.LBB152:
+.stabn 68,0,328,.LM1449-v4_sign
+.LM1449:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L166
+	call v4_drop
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	jmp .L167
+.L166:
+	call v4__dpop
+	test %eax,%eax
+	jle .L168
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L169
+.L168:
+	xor %eax,%eax
+	call v4__dpush
+.L169:
+.L167:
+.LBE152:
+.stabn 68,0,328,.LM1474-v4_sign
+.LM1474:
+	pop %ebx
+	leave
+	ret
+.Lfe152:
+	.size	 v4_sign,.Lfe152-v4_sign
+.stabn	192,0,0,.LBB152-v4_sign
+.stabn	224,0,0,.LBE152-v4_sign
+.Lscope152:
+.stabs	"",36,0,0,.Lscope152-v4_sign
+.text
+	.align 4
+.stabs "v4_twice:F1",36,0,0,v4_twice
+.globl v4_twice
+	.type	v4_twice,@function
+v4_twice:
+.stabn 68,0,329,.LMa1475-v4_twice
+.LMa1475:
+.stabn 68,0,329,.LMb1475-v4_twice
+.LMb1475:
+.LBB153:
+	call v4__dpop
+	add %eax,%eax
+	call v4__dpush
+.LBE153:
+.stabn 68,0,329,.LM1481-v4_twice
+.LM1481:
+	ret
+.Lfe153:
+	.size	 v4_twice,.Lfe153-v4_twice
+.stabn	192,0,0,.LBB153-v4_twice
+.stabn	224,0,0,.LBE153-v4_twice
+.Lscope153:
+.stabs	"",36,0,0,.Lscope153-v4_twice
+.text
+	.align 4
+.stabs "v4_get_Minusi:F1",36,0,0,v4_get_Minusi
+.globl v4_get_Minusi
+	.type	v4_get_Minusi,@function
+v4_get_Minusi:
+.stabn 68,0,330,.LMa1482-v4_get_Minusi
+.LMa1482:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,330,.LMb1482-v4_get_Minusi
+.LMb1482:
+.LBB154:
+	pop %ebx
+	leave
+	jmp v4_i
+.LBE154:
+.stabn 68,0,330,.LM1485-v4_get_Minusi
+.LM1485:
+	pop %ebx
+	leave
+	ret
+.Lfe154:
+	.size	 v4_get_Minusi,.Lfe154-v4_get_Minusi
+.stabn	192,0,0,.LBB154-v4_get_Minusi
+.stabn	224,0,0,.LBE154-v4_get_Minusi
+.Lscope154:
+.stabs	"",36,0,0,.Lscope154-v4_get_Minusi
+.text
+	.align 4
+.stabs "v4_get_Minusi_Minusnoinline:F1",36,0,0,v4_get_Minusi_Minusnoinline
+.globl v4_get_Minusi_Minusnoinline
+	.type	v4_get_Minusi_Minusnoinline,@function
+v4_get_Minusi_Minusnoinline:
+.stabn 68,0,331,.LMa1486-v4_get_Minusi_Minusnoinline
+.LMa1486:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,331,.LMb1486-v4_get_Minusi_Minusnoinline
+.LMb1486:
+.LBB155:
+	pop %ebx
+	leave
+	jmp v4_i
+.LBE155:
+.stabn 68,0,331,.LM1489-v4_get_Minusi_Minusnoinline
+.LM1489:
+	pop %ebx
+	leave
+	ret
+.Lfe155:
+	.size	 v4_get_Minusi_Minusnoinline,.Lfe155-v4_get_Minusi_Minusnoinline
+.stabn	192,0,0,.LBB155-v4_get_Minusi_Minusnoinline
+.stabn	224,0,0,.LBE155-v4_get_Minusi_Minusnoinline
+.Lscope155:
+.stabs	"",36,0,0,.Lscope155-v4_get_Minusi_Minusnoinline
+.text
+	.align 4
+.stabs "v4_find_Minusfirst:F1",36,0,0,v4_find_Minusfirst
+.globl v4_find_Minusfirst
+	.type	v4_find_Minusfirst,@function
+v4_find_Minusfirst:
+.stabn 68,0,332,.LMa1490-v4_find_Minusfirst
+.LMa1490:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,332,.LMb1490-v4_find_Minusfirst
+.LMb1490:
+.LBB156:
+.stabn 68,0,333,.LM1491-v4_find_Minusfirst
+.LM1491:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_swap
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L175:
+	call v4_i
+	mov $3,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L177
+	call v4_drop
+	call v4_i
+	jmp .L176
+.L177:
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L175
+.L176:
+	call v4__rpop
+	call v4__rpop
+.LBE156:
+.stabn 68,0,333,.LM1526-v4_find_Minusfirst
+.LM1526:
+	pop %ebx
+	leave
+	ret
+.Lfe156:
+	.size	 v4_find_Minusfirst,.Lfe156-v4_find_Minusfirst
+.stabn	192,0,0,.LBB156-v4_find_Minusfirst
+.stabn	224,0,0,.LBE156-v4_find_Minusfirst
+.Lscope156:
+.stabs	"",36,0,0,.Lscope156-v4_find_Minusfirst
+.text
+	.align 4
+.stabs "v4_factorial:F1",36,0,0,v4_factorial
+.globl v4_factorial
+	.type	v4_factorial,@function
+v4_factorial:
+.stabn 68,0,334,.LMa1527-v4_factorial
+.LMa1527:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,334,.LMb1527-v4_factorial
+.LMb1527:
+.LBB157:
+	call v4_dup
+	mov $2,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L179
+	call v4_drop
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L178
+.L179:
+	call v4_dup
+	call v4__dpop
+	dec %eax
+	call v4__dpush
+	call v4_factorial
+	pop %ebx
+	leave
+	jmp v4_Star
+.L178:
+.LBE157:
+.stabn 68,0,334,.LM1550-v4_factorial
+.LM1550:
+	pop %ebx
+	leave
+	ret
+.Lfe157:
+	.size	 v4_factorial,.Lfe157-v4_factorial
+.stabn	192,0,0,.LBB157-v4_factorial
+.stabn	224,0,0,.LBE157-v4_factorial
+.Lscope157:
+.stabs	"",36,0,0,.Lscope157-v4_factorial
+.text
+	.align 4
+.stabs "v4_use_Minusclamp:F1",36,0,0,v4_use_Minusclamp
+.globl v4_use_Minusclamp
+	.type	v4_use_Minusclamp,@function
+v4_use_Minusclamp:
+.stabn 68,0,336,.LMa1551-v4_use_Minusclamp
+.LMa1551:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,336,.LMb1551-v4_use_Minusclamp
+.LMb1551:
+.LBB158:
+.stabn 68,0,325,.LM1553-v4_use_Minusclamp
+.LM1553:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L246
+	call v4_drop
+	xor %eax,%eax
+	call v4__dpush
+	jmp .L248
+.L246:
+.stabn 68,0,326,.LM1564-v4_use_Minusclamp
+.LM1564:
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L247
+	call v4_drop
+	mov $100,%eax
+	call v4__dpush
+.L247:
+.L248:
+.stabn 68,0,336,.LM1579-v4_use_Minusclamp
+.LM1579:
+	call v4_rot
+.stabn 68,0,325,.LM1581-v4_use_Minusclamp
+.LM1581:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L249
+	call v4_drop
+	xor %eax,%eax
+	call v4__dpush
+	jmp .L251
+.L249:
+.stabn 68,0,326,.LM1592-v4_use_Minusclamp
+.LM1592:
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L250
+	call v4_drop
+	mov $100,%eax
+	call v4__dpush
+.L250:
+.L251:
+.stabn 68,0,336,.LM1607-v4_use_Minusclamp
+.LM1607:
+	call v4_rot
+.stabn 68,0,325,.LM1609-v4_use_Minusclamp
+.LM1609:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L252
+	call v4_drop
+	xor %eax,%eax
+	call v4__dpush
+	jmp .L254
+.L252:
+.stabn 68,0,326,.LM1620-v4_use_Minusclamp
+.LM1620:
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L253
+	call v4_drop
+	mov $100,%eax
+	call v4__dpush
+.L253:
+.L254:
+.stabn 68,0,336,.LM1635-v4_use_Minusclamp
+.LM1635:
+	pop %ebx
+	leave
+	jmp v4_rot
+.LBE158:
+.stabn 68,0,336,.LM1637-v4_use_Minusclamp
+.LM1637:
+	pop %ebx
+	leave
+	ret
+.Lfe158:
+	.size	 v4_use_Minusclamp,.Lfe158-v4_use_Minusclamp
+.stabn	192,0,0,.LBB158-v4_use_Minusclamp
+.stabn	224,0,0,.LBE158-v4_use_Minusclamp
+.Lscope158:
+.stabs	"",36,0,0,.Lscope158-v4_use_Minusclamp
+.text
+	.align 4
+.stabs "v4_use_Minussign:F1",36,0,0,v4_use_Minussign
+.globl v4_use_Minussign
+	.type	v4_use_Minussign,@function
+v4_use_Minussign:
+.stabn 68,0,337,.LMa1638-v4_use_Minussign
+.LMa1638:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,337,.LMb1638-v4_use_Minussign
+.LMb1638:
+.LBB160:
+	mov $-5,%eax
+	call v4__dpush
+	call v4_sign
+	xor %eax,%eax
+	call v4__dpush
+	call v4_sign
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_sign
+.LBE160:
+.stabn 68,0,337,.LM1649-v4_use_Minussign
+.LM1649:
+	pop %ebx
+	leave
+	ret
+.Lfe160:
+	.size	 v4_use_Minussign,.Lfe160-v4_use_Minussign
+.stabn	192,0,0,.LBB160-v4_use_Minussign
+.stabn	224,0,0,.LBE160-v4_use_Minussign
+.Lscope160:
+.stabs	"",36,0,0,.Lscope160-v4_use_Minussign
+.text
+	.align 4
+.stabs "v4_use_Minustwice:F1",36,0,0,v4_use_Minustwice
+.globl v4_use_Minustwice
+	.type	v4_use_Minustwice,@function
+v4_use_Minustwice:
+.stabn 68,0,338,.LMa1650-v4_use_Minustwice
+.LMa1650:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,338,.LMb1650-v4_use_Minustwice
+.LMb1650:
+.LBB161:
+	call v4_twice
+	pop %ebx
+	leave
+	jmp v4_twice
+.LBE161:
+.stabn 68,0,338,.LM1654-v4_use_Minustwice
+.LM1654:
+	pop %ebx
+	leave
+	ret
+.Lfe161:
+	.size	 v4_use_Minustwice,.Lfe161-v4_use_Minustwice
+.stabn	192,0,0,.LBB161-v4_use_Minustwice
+.stabn	224,0,0,.LBE161-v4_use_Minustwice
+.Lscope161:
+.stabs	"",36,0,0,.Lscope161-v4_use_Minustwice
+.text
+	.align 4
+.stabs "v4_sum_Minusi:F1",36,0,0,v4_sum_Minusi
+.globl v4_sum_Minusi
+	.type	v4_sum_Minusi,@function
+v4_sum_Minusi:
+.stabn 68,0,339,.LMa1655-v4_sum_Minusi
+.LMa1655:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,339,.LMb1655-v4_sum_Minusi
+.LMb1655:
+.LBB162:
+	xor %eax,%eax
+	call v4__dpush
+	mov $5,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L185:
+	mov -12(%ebp),%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	mov -12(%ebp),%edx
+	inc %edx
+	call v4__dpush
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	jne .L185
+	mov -8(%ebp),%eax
+.LBE162:
+.stabn 68,0,339,.LM1688-v4_sum_Minusi
+.LM1688:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe162:
+	.size	 v4_sum_Minusi,.Lfe162-v4_sum_Minusi
+.stabn	192,0,0,.LBB162-v4_sum_Minusi
+.stabn	224,0,0,.LBE162-v4_sum_Minusi
+.Lscope162:
+.stabs	"",36,0,0,.Lscope162-v4_sum_Minusi
+.text
+	.align 4
+.stabs "v4_sum_Minusi_Minusnoinline:F1",36,0,0,v4_sum_Minusi_Minusnoinline
+.globl v4_sum_Minusi_Minusnoinline
+	.type	v4_sum_Minusi_Minusnoinline,@function
+v4_sum_Minusi_Minusnoinline:
+.stabn 68,0,340,.LMa1689-v4_sum_Minusi_Minusnoinline
+.LMa1689:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,340,.LMb1689-v4_sum_Minusi_Minusnoinline
+.LMb1689:
+.LBB163:
+	xor %eax,%eax
+	call v4__dpush
+	mov $5,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L189:
+	call v4_get_Minusi_Minusnoinline
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	xchg %edx,%eax
+	call v4__rpop
+	xchg %eax,%edx
+	inc %edx
+	call v4__dpush
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L189
+	call v4__rpop
+	call v4__rpop
+.LBE163:
+.stabn 68,0,340,.LM1719-v4_sum_Minusi_Minusnoinline
+.LM1719:
+	pop %ebx
+	leave
+	ret
+.Lfe163:
+	.size	 v4_sum_Minusi_Minusnoinline,.Lfe163-v4_sum_Minusi_Minusnoinline
+.stabn	192,0,0,.LBB163-v4_sum_Minusi_Minusnoinline
+.stabn	224,0,0,.LBE163-v4_sum_Minusi_Minusnoinline
+.Lscope163:
+.stabs	"",36,0,0,.Lscope163-v4_sum_Minusi_Minusnoinline
+.text
+	.align 4
+.stabs "v4_sum_Minusj:F1",36,0,0,v4_sum_Minusj
+.globl v4_sum_Minusj
+	.type	v4_sum_Minusj,@function
+v4_sum_Minusj:
+.stabn 68,0,341,.LMa1720-v4_sum_Minusj
+.LMa1720:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,341,.LMb1720-v4_sum_Minusj
+.LMb1720:
+.LBB164:
+	xor %eax,%eax
+	call v4__dpush
+	mov $2,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L193:
+	mov $3,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	mov %eax,-16(%ebp)
+	mov %edx,-20(%ebp)
+.L196:
+	mov -20(%ebp),%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	mov -20(%ebp),%edx
+	inc %edx
+	call v4__dpush
+	mov -16(%ebp),%eax
+	mov %edx,-20(%ebp)
+	sub %eax,%edx
+	jne .L196
+	mov -16(%ebp),%eax
+	mov -12(%ebp),%edx
+	inc %edx
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	jne .L193
+	mov -8(%ebp),%eax
+.LBE164:
+.stabn 68,0,341,.LM1773-v4_sum_Minusj
+.LM1773:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe164:
+	.size	 v4_sum_Minusj,.Lfe164-v4_sum_Minusj
+.stabn	192,0,0,.LBB164-v4_sum_Minusj
+.stabn	224,0,0,.LBE164-v4_sum_Minusj
+.Lscope164:
+.stabs	"",36,0,0,.Lscope164-v4_sum_Minusj
+.text
+	.align 4
+.stabs "v4_use_Minusfind_Minusfirst:F1",36,0,0,v4_use_Minusfind_Minusfirst
+.globl v4_use_Minusfind_Minusfirst
+	.type	v4_use_Minusfind_Minusfirst,@function
+v4_use_Minusfind_Minusfirst:
+.stabn 68,0,342,.LMa1774-v4_use_Minusfind_Minusfirst
+.LMa1774:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,342,.LMb1774-v4_use_Minusfind_Minusfirst
+.LMb1774:
+.LBB165:
+	mov $10,%eax
+	call v4__dpush
+	call v4_find_Minusfirst
+	mov $3,%eax
+	call v4__dpush
+	pop %ebx
+	leave
+	jmp v4_find_Minusfirst
+.LBE165:
+.stabn 68,0,342,.LM1782-v4_use_Minusfind_Minusfirst
+.LM1782:
+	pop %ebx
+	leave
+	ret
+.Lfe165:
+	.size	 v4_use_Minusfind_Minusfirst,.Lfe165-v4_use_Minusfind_Minusfirst
+.stabn	192,0,0,.LBB165-v4_use_Minusfind_Minusfirst
+.stabn	224,0,0,.LBE165-v4_use_Minusfind_Minusfirst
+.Lscope165:
+.stabs	"",36,0,0,.Lscope165-v4_use_Minusfind_Minusfirst
+.text
+	.align 4
+.stabs "v4_use_Minusin_Minusloop:F1",36,0,0,v4_use_Minusin_Minusloop
+.globl v4_use_Minusin_Minusloop
+	.type	v4_use_Minusin_Minusloop,@function
+v4_use_Minusin_Minusloop:
+.stabn 68,0,343,.LMa1783-v4_use_Minusin_Minusloop
+.LMa1783:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,343,.LMb1783-v4_use_Minusin_Minusloop
+.LMb1783:
+.LBB166:
+	xor %eax,%eax
+	call v4__dpush
+	mov $200,%eax
+	mov %eax,%ecx
+	mov $-100,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L201:
+	call v4_i
+.stabn 68,0,325,.LM1797-v4_use_Minusin_Minusloop
+.LM1797:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L255
+	call v4_drop
+	xor %eax,%eax
+	call v4__dpush
+	jmp .L257
+.L255:
+.stabn 68,0,326,.LM1808-v4_use_Minusin_Minusloop
+.LM1808:
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L256
+	call v4_drop
+	mov $100,%eax
+	call v4__dpush
+.L256:
+.L257:
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	call v4__dpush
+	mov $50,%eax
+	xchg %edx,%eax
+	call v4__rpop
+	xchg %eax,%edx
+	add %eax,%edx
+	test %eax,%eax
+	jl .L203
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	test %edx,%edx
+	jl .L201
+	jmp .L202
+.L203:
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	test %edx,%edx
+	jge .L201
+.L202:
+	call v4__rpop
+	call v4__rpop
+.LBE166:
+.stabn 68,0,343,.LM1851-v4_use_Minusin_Minusloop
+.LM1851:
+	pop %ebx
+	leave
+	ret
+.Lfe166:
+	.size	 v4_use_Minusin_Minusloop,.Lfe166-v4_use_Minusin_Minusloop
+.stabn	192,0,0,.LBB166-v4_use_Minusin_Minusloop
+.stabn	224,0,0,.LBE166-v4_use_Minusin_Minusloop
+.Lscope166:
+.stabs	"",36,0,0,.Lscope166-v4_use_Minusin_Minusloop
+.text
+	.align 4
+.stabs "v4_sum_Minusstep:F1",36,0,0,v4_sum_Minusstep
+.globl v4_sum_Minusstep
+	.type	v4_sum_Minusstep,@function
+v4_sum_Minusstep:
+.stabn 68,0,363,.LMa1852-v4_sum_Minusstep
+.LMa1852:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,363,.LMb1852-v4_sum_Minusstep
+.LMb1852:
+.LBB168:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_swap
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L206:
+	mov (v4_step),%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	mov -12(%ebp),%edx
+	inc %edx
+	call v4__dpush
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	jne .L206
+	mov -8(%ebp),%eax
+.LBE168:
+.stabn 68,0,363,.LM1885-v4_sum_Minusstep
+.LM1885:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe168:
+	.size	 v4_sum_Minusstep,.Lfe168-v4_sum_Minusstep
+.stabn	192,0,0,.LBB168-v4_sum_Minusstep
+.stabn	224,0,0,.LBE168-v4_sum_Minusstep
+.Lscope168:
+.stabs	"",36,0,0,.Lscope168-v4_sum_Minusstep
+.text
+	.align 4
+.stabs "v4_bump_Minusstep:F1",36,0,0,v4_bump_Minusstep
+.globl v4_bump_Minusstep
+	.type	v4_bump_Minusstep,@function
+v4_bump_Minusstep:
+.stabn 68,0,364,.LMa1886-v4_bump_Minusstep
+.LMa1886:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,364,.LMb1886-v4_bump_Minusstep
+.LMb1886:
+.LBB169:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_swap
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L210:
+	mov (v4_step),%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	mov (v4_step),%edx
+	add %edx,%eax
+	mov %eax,(v4_step)
+	mov -12(%ebp),%edx
+	inc %edx
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	jne .L210
+	mov -8(%ebp),%eax
+.LBE169:
+.stabn 68,0,364,.LM1928-v4_bump_Minusstep
+.LM1928:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe169:
+	.size	 v4_bump_Minusstep,.Lfe169-v4_bump_Minusstep
+.stabn	192,0,0,.LBB169-v4_bump_Minusstep
+.stabn	224,0,0,.LBE169-v4_bump_Minusstep
+.Lscope169:
+.stabs	"",36,0,0,.Lscope169-v4_bump_Minusstep
+.text
+	.align 4
+.stabs "v4_sum_Minusstep_Minus2:F1",36,0,0,v4_sum_Minusstep_Minus2
+.globl v4_sum_Minusstep_Minus2
+	.type	v4_sum_Minusstep_Minus2,@function
+v4_sum_Minusstep_Minus2:
+.stabn 68,0,365,.LMa1929-v4_sum_Minusstep_Minus2
+.LMa1929:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+.stabn 68,0,365,.LMb1929-v4_sum_Minusstep_Minus2
+.LMb1929:
+.LBB170:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_swap
+	xor %eax,%eax
+	mov %eax,%edx
+	call v4__dpop
+	mov %eax,-8(%ebp)
+	mov %edx,-12(%ebp)
+.L214:
+	mov $3,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	mov %eax,-16(%ebp)
+	mov %edx,-20(%ebp)
+.L217:
+	mov (v4_step),%eax
+	mov %eax,%ecx
+	mov -12(%ebp),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	mov -20(%ebp),%edx
+	inc %edx
+	call v4__dpush
+	mov -16(%ebp),%eax
+	mov %edx,-20(%ebp)
+	sub %eax,%edx
+	jne .L217
+	mov -16(%ebp),%eax
+	mov -12(%ebp),%edx
+	inc %edx
+	mov -8(%ebp),%eax
+	mov %edx,-12(%ebp)
+	sub %eax,%edx
+	jne .L214
+	mov -8(%ebp),%eax
+.LBE170:
+.stabn 68,0,365,.LM1990-v4_sum_Minusstep_Minus2
+.LM1990:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe170:
+	.size	 v4_sum_Minusstep_Minus2,.Lfe170-v4_sum_Minusstep_Minus2
+.stabn	192,0,0,.LBB170-v4_sum_Minusstep_Minus2
+.stabn	224,0,0,.LBE170-v4_sum_Minusstep_Minus2
+.Lscope170:
+.stabs	"",36,0,0,.Lscope170-v4_sum_Minusstep_Minus2
+.text
+	.align 4
+.stabs "v4_set_Minuscell_Minusv:F1",36,0,0,v4_set_Minuscell_Minusv
+.globl v4_set_Minuscell_Minusv
+	.type	v4_set_Minuscell_Minusv,@function
+v4_set_Minuscell_Minusv:
+.stabn 68,0,380,.LMa1991-v4_set_Minuscell_Minusv
+.LMa1991:
+.stabn 68,0,380,.LMb1991-v4_set_Minuscell_Minusv
+.LMb1991:
+.LBB172:
+	mov $11,%eax
+	mov %eax,(v4_cell_Minusv)
+.LBE172:
+.stabn 68,0,380,.LM2000-v4_set_Minuscell_Minusv
+.LM2000:
+	ret
+.Lfe172:
+	.size	 v4_set_Minuscell_Minusv,.Lfe172-v4_set_Minuscell_Minusv
+.stabn	192,0,0,.LBB172-v4_set_Minuscell_Minusv
+.stabn	224,0,0,.LBE172-v4_set_Minuscell_Minusv
+.Lscope172:
+.stabs	"",36,0,0,.Lscope172-v4_set_Minuscell_Minusv
+.text
+	.align 4
+.stabs "v4_forward_Minusv:F1",36,0,0,v4_forward_Minusv
+.globl v4_forward_Minusv
+	.type	v4_forward_Minusv,@function
+v4_forward_Minusv:
+.stabn 68,0,381,.LMa2001-v4_forward_Minusv
+.LMa2001:
+.stabn 68,0,381,.LMb2001-v4_forward_Minusv
+.LMb2001:
+.LBB173:
+	call v4__dpop
+	mov %eax,(v4_cell_Minusv)
+	call v4__dpush
+.LBE173:
+.stabn 68,0,381,.LM2013-v4_forward_Minusv
+.LM2013:
+	ret
+.Lfe173:
+	.size	 v4_forward_Minusv,.Lfe173-v4_forward_Minusv
+.stabn	192,0,0,.LBB173-v4_forward_Minusv
+.stabn	224,0,0,.LBE173-v4_forward_Minusv
+.Lscope173:
+.stabs	"",36,0,0,.Lscope173-v4_forward_Minusv
+.text
+	.align 4
+.stabs "v4_reload_Minusv:F1",36,0,0,v4_reload_Minusv
+.globl v4_reload_Minusv
+	.type	v4_reload_Minusv,@function
+v4_reload_Minusv:
+.stabn 68,0,382,.LMa2014-v4_reload_Minusv
+.LMa2014:
+.stabn 68,0,382,.LMb2014-v4_reload_Minusv
+.LMb2014:
+.LBB174:
+	mov (v4_cell_Minusv),%eax
+	call v4__dpush
+	call v4__dpush
+.LBE174:
+.stabn 68,0,382,.LM2026-v4_reload_Minusv
+.LM2026:
+	ret
+.Lfe174:
+	.size	 v4_reload_Minusv,.Lfe174-v4_reload_Minusv
+.stabn	192,0,0,.LBB174-v4_reload_Minusv
+.stabn	224,0,0,.LBE174-v4_reload_Minusv
+.Lscope174:
+.stabs	"",36,0,0,.Lscope174-v4_reload_Minusv
+.text
+	.align 4
+.stabs "v4_overwrite_Minusv:F1",36,0,0,v4_overwrite_Minusv
+.globl v4_overwrite_Minusv
+	.type	v4_overwrite_Minusv,@function
+v4_overwrite_Minusv:
+.stabn 68,0,383,.LMa2027-v4_overwrite_Minusv
+.LMa2027:
+.stabn 68,0,383,.LMb2027-v4_overwrite_Minusv
+.LMb2027:
+.LBB175:
+	call v4__dpop
+	call v4__dpop
+	mov %eax,(v4_cell_Minusv)
+.LBE175:
+.stabn 68,0,383,.LM2039-v4_overwrite_Minusv
+.LM2039:
+	ret
+.Lfe175:
+	.size	 v4_overwrite_Minusv,.Lfe175-v4_overwrite_Minusv
+.stabn	192,0,0,.LBB175-v4_overwrite_Minusv
+.stabn	224,0,0,.LBE175-v4_overwrite_Minusv
+.Lscope175:
+.stabs	"",36,0,0,.Lscope175-v4_overwrite_Minusv
+.text
+	.align 4
+.stabs "v4_store_Minusthrough:F1",36,0,0,v4_store_Minusthrough
+.globl v4_store_Minusthrough
+	.type	v4_store_Minusthrough,@function
+v4_store_Minusthrough:
+.stabn 68,0,384,.LMa2040-v4_store_Minusthrough
+.LMa2040:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,384,.LMb2040-v4_store_Minusthrough
+.LMb2040:
+.LBB176:
+	mov $5,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov $9,%eax
+	call v4__dpush
+	call v4_swap
+	call v4_Store
+	mov (v4_cell_Minusv),%eax
+	call v4__dpush
+.LBE176:
+.stabn 68,0,384,.LM2058-v4_store_Minusthrough
+.LM2058:
+	pop %ebx
+	leave
+	ret
+.Lfe176:
+	.size	 v4_store_Minusthrough,.Lfe176-v4_store_Minusthrough
+.stabn	192,0,0,.LBB176-v4_store_Minusthrough
+.stabn	224,0,0,.LBE176-v4_store_Minusthrough
+.Lscope176:
+.stabs	"",36,0,0,.Lscope176-v4_store_Minusthrough
+.text
+	.align 4
+.stabs "v4_cstore_Minusthrough:F1",36,0,0,v4_cstore_Minusthrough
+.globl v4_cstore_Minusthrough
+	.type	v4_cstore_Minusthrough,@function
+v4_cstore_Minusthrough:
+.stabn 68,0,385,.LMa2059-v4_cstore_Minusthrough
+.LMa2059:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,385,.LMb2059-v4_cstore_Minusthrough
+.LMb2059:
+.LBB177:
+	xor %eax,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov $7,%eax
+	call v4__dpush
+	call v4_swap
+	call v4_c_Store
+	mov (v4_cell_Minusv),%eax
+	call v4__dpush
+.LBE177:
+.stabn 68,0,385,.LM2077-v4_cstore_Minusthrough
+.LM2077:
+	pop %ebx
+	leave
+	ret
+.Lfe177:
+	.size	 v4_cstore_Minusthrough,.Lfe177-v4_cstore_Minusthrough
+.stabn	192,0,0,.LBB177-v4_cstore_Minusthrough
+.stabn	224,0,0,.LBE177-v4_cstore_Minusthrough
+.Lscope177:
+.stabs	"",36,0,0,.Lscope177-v4_cstore_Minusthrough
+.text
+	.align 4
+.stabs "v4_fetch_Minusthrough:F1",36,0,0,v4_fetch_Minusthrough
+.globl v4_fetch_Minusthrough
+	.type	v4_fetch_Minusthrough,@function
+v4_fetch_Minusthrough:
+.stabn 68,0,386,.LMa2078-v4_fetch_Minusthrough
+.LMa2078:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,386,.LMb2078-v4_fetch_Minusthrough
+.LMb2078:
+.LBB179:
+	mov $3,%eax
+	mov %eax,(v4_cell_Minusv)
+	call v4_Fetch
+	mov $4,%eax
+	mov %eax,(v4_cell_Minusv)
+.LBE179:
+.stabn 68,0,386,.LM2095-v4_fetch_Minusthrough
+.LM2095:
+	pop %ebx
+	leave
+	ret
+.Lfe179:
+	.size	 v4_fetch_Minusthrough,.Lfe179-v4_fetch_Minusthrough
+.stabn	192,0,0,.LBB179-v4_fetch_Minusthrough
+.stabn	224,0,0,.LBE179-v4_fetch_Minusthrough
+.Lscope179:
+.stabs	"",36,0,0,.Lscope179-v4_fetch_Minusthrough
+.text
+	.align 4
+.stabs "v4_around_Minuscall:F1",36,0,0,v4_around_Minuscall
+.globl v4_around_Minuscall
+	.type	v4_around_Minuscall,@function
+v4_around_Minuscall:
+.stabn 68,0,387,.LMa2096-v4_around_Minuscall
+.LMa2096:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,387,.LMb2096-v4_around_Minuscall
+.LMb2096:
+.LBB180:
+	mov $5,%eax
+	mov %eax,(v4_cell_Minusv)
+	call v4__dpush
+	call v4_set_Minuscell_Minusv
+	mov (v4_cell_Minusv),%eax
+	call v4__dpush
+.LBE180:
+.stabn 68,0,387,.LM2116-v4_around_Minuscall
+.LM2116:
+	pop %ebx
+	leave
+	ret
+.Lfe180:
+	.size	 v4_around_Minuscall,.Lfe180-v4_around_Minuscall
+.stabn	192,0,0,.LBB180-v4_around_Minuscall
+.stabn	224,0,0,.LBE180-v4_around_Minuscall
+.Lscope180:
+.stabs	"",36,0,0,.Lscope180-v4_around_Minuscall
+.text
+	.align 4
+.stabs "v4_thread_Minusforward:F1",36,0,0,v4_thread_Minusforward
+.globl v4_thread_Minusforward
+	.type	v4_thread_Minusforward,@function
+v4_thread_Minusforward:
+.stabn 68,0,406,.LMa2117-v4_thread_Minusforward
+.LMa2117:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,406,.LMb2117-v4_thread_Minusforward
+.LMb2117:
+.LBB181:
+	call v4__dpop
+	test %eax,%eax
+	je .L228
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	je .L229
+	call v4_drop
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L230
+.L228:
+	call v4_drop
+	mov $3,%eax
+	call v4__dpush
+.L229:
+.L230:
+.LBE181:
+.stabn 68,0,406,.LM2135-v4_thread_Minusforward
+.LM2135:
+	pop %ebx
+	leave
+	ret
+.Lfe181:
+	.size	 v4_thread_Minusforward,.Lfe181-v4_thread_Minusforward
+.stabn	192,0,0,.LBB181-v4_thread_Minusforward
+.stabn	224,0,0,.LBE181-v4_thread_Minusforward
+.Lscope181:
+.stabs	"",36,0,0,.Lscope181-v4_thread_Minusforward
+.text
+	.align 4
+.stabs "v4_count_Minusodd:F1",36,0,0,v4_count_Minusodd
+.globl v4_count_Minusodd
+	.type	v4_count_Minusodd,@function
+v4_count_Minusodd:
+.stabn 68,0,407,.LMa2136-v4_count_Minusodd
+.LMa2136:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,407,.LMb2136-v4_count_Minusodd
+.LMb2136:
+.LBB182:
+.stabn 68,0,408,.LM2137-v4_count_Minusodd
+.LM2137:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_swap
+.L234:
+.L232:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	je .L233
+	call v4__dpop
+	dec %eax
+	call v4__dpush
+	call v4_dup
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	call v4__dpop
+	and %edx,%eax
+	je .L234
+	call v4_swap
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	call v4_swap
+	jmp .L232
+.L233:
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE182:
+.stabn 68,0,408,.LM2170-v4_count_Minusodd
+.LM2170:
+	pop %ebx
+	leave
+	ret
+.Lfe182:
+	.size	 v4_count_Minusodd,.Lfe182-v4_count_Minusodd
+.stabn	192,0,0,.LBB182-v4_count_Minusodd
+.stabn	224,0,0,.LBE182-v4_count_Minusodd
+.Lscope182:
+.stabs	"",36,0,0,.Lscope182-v4_count_Minusodd
+.text
+	.align 4
+.stabs "v4_spin:F1",36,0,0,v4_spin
+.globl v4_spin
+	.type	v4_spin,@function
+v4_spin:
+.stabn 68,0,409,.LMa2171-v4_spin
+.LMa2171:
+.stabn 68,0,409,.LMb2171-v4_spin
+.LMb2171:
+.LBB183:
+.L236:
+	jmp .L236
+.LBE183:
+.stabn 68,0,409,.LM2176-v4_spin
+.LM2176:
+	ret
+.Lfe183:
+	.size	 v4_spin,.Lfe183-v4_spin
+.stabn	192,0,0,.LBB183-v4_spin
+.stabn	224,0,0,.LBE183-v4_spin
+.Lscope183:
+.stabs	"",36,0,0,.Lscope183-v4_spin
+.text
+	.align 4
+.stabs "v4_spin_Minusunless:F1",36,0,0,v4_spin_Minusunless
+.globl v4_spin_Minusunless
+	.type	v4_spin_Minusunless,@function
+v4_spin_Minusunless:
+.stabn 68,0,410,.LMa2177-v4_spin_Minusunless
+.LMa2177:
+.stabn 68,0,410,.LMb2177-v4_spin_Minusunless
+.LMb2177:
+.LBB184:
+	call v4__dpop
+	test %eax,%eax
+	jne .L239
+.L240:
+	jmp .L240
+.L239:
+.LBE184:
+.stabn 68,0,410,.LM2188-v4_spin_Minusunless
+.LM2188:
+	ret
+.Lfe184:
+	.size	 v4_spin_Minusunless,.Lfe184-v4_spin_Minusunless
+.stabn	192,0,0,.LBB184-v4_spin_Minusunless
+.stabn	224,0,0,.LBE184-v4_spin_Minusunless
+.Lscope184:
+.stabs	"",36,0,0,.Lscope184-v4_spin_Minusunless
+.text
+	.align 4
+.stabs "v4_merge_Minusloop:F1",36,0,0,v4_merge_Minusloop
+.globl v4_merge_Minusloop
+	.type	v4_merge_Minusloop,@function
+v4_merge_Minusloop:
+.stabn 68,0,411,.LMa2189-v4_merge_Minusloop
+.LMa2189:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,411,.LMb2189-v4_merge_Minusloop
+.LMb2189:
+.LBB185:
+.L243:
+	call v4_dup
+	mov $10,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L245
+	call v4__dpop
+	inc %eax
+	add %eax,%eax
+	call v4__dpush
+	jmp .L243
+.L245:
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	call v4__dpush
+.LBE185:
+.stabn 68,0,412,.LM2222-v4_merge_Minusloop
+.LM2222:
+	pop %ebx
+	leave
+	ret
+.Lfe185:
+	.size	 v4_merge_Minusloop,.Lfe185-v4_merge_Minusloop
+.stabn	192,0,0,.LBB185-v4_merge_Minusloop
+.stabn	224,0,0,.LBE185-v4_merge_Minusloop
+.Lscope185:
+.stabs	"",36,0,0,.Lscope185-v4_merge_Minusloop
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,9,.LMa2223-main
+.LMa2223:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	sub $16,%esp
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,9,.LMb2223-main
+.LMb2223:
+.LBB1:
+	lea .LC0,%eax
+	call v4__dpush
+	mov $17,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4__strictansi
+	call v4_Store
+.stabn 68,0,12,.LM2235-main
+.LM2235:
+	xor %eax,%eax
+	call v4__dpush
+	lea v4_invert,%eax
+	call v4__dpush
+	call v4_execute
+	call v4__dpop
+	mov %eax,(v4_max_Minusuint)
+.stabn 68,0,13,.LM2242-main
+.LM2242:
+	mov (v4_max_Minusuint),%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	lea v4_rshift,%eax
+	call v4__dpush
+	call v4_execute
+	call v4__dpop
+	mov %eax,(v4_max_Minusint)
+.stabn 68,0,14,.LM2251-main
+.LM2251:
+	mov (v4_max_Minusint),%eax
+	call v4__dpush
+	lea v4_invert,%eax
+	call v4__dpush
+	call v4_execute
+	call v4__dpop
+	mov %eax,(v4_min_Minusint)
+.stabn 68,0,15,.LM2258-main
+.LM2258:
+	xor %eax,%eax
+	mov %eax,(v4_Lessfalse_Greater)
+.stabn 68,0,16,.LM2262-main
+.LM2262:
+	mov (v4_max_Minusuint),%eax
+	mov %eax,(v4_Lesstrue_Greater)
+.stabn 68,0,19,.LM2266-main
+.LM2266:
+	lea .LC1,%eax
+	call v4__dpush
+	mov $38,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,38,.LM2272-main
+.LM2272:
+	mov $100,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,21,.LM2276-main
+.LM2276:
+	mov $9,%eax
+	call v4__dpush
+.stabn 68,0,38,.LM2278-main
+.LM2278:
+	call v4_Minus_Greater
+	mov $9,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,39,.LM2282-main
+.LM2282:
+	mov $110,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,22,.LM2286-main
+.LM2286:
+	mov $2147483647,%eax
+	call v4__dpush
+.stabn 68,0,39,.LM2288-main
+.LM2288:
+	call v4_Minus_Greater
+	mov (v4_max_Minusint),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,40,.LM2292-main
+.LM2292:
+	mov $120,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,23,.LM2296-main
+.LM2296:
+	mov $-2147483648,%eax
+	call v4__dpush
+.stabn 68,0,40,.LM2298-main
+.LM2298:
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,41,.LM2302-main
+.LM2302:
+	mov $130,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,24,.LM2306-main
+.LM2306:
+	mov $-2147483648,%eax
+	call v4__dpush
+.stabn 68,0,41,.LM2308-main
+.LM2308:
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,42,.LM2312-main
+.LM2312:
+	mov $140,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,29,.LM2316-main
+.LM2316:
+	mov $-2147483648,%eax
+	call v4__dpush
+.stabn 68,0,42,.LM2318-main
+.LM2318:
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,43,.LM2322-main
+.LM2322:
+	mov $150,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,30,.LM2326-main
+.LM2326:
+	mov $2147483647,%eax
+	call v4__dpush
+.stabn 68,0,43,.LM2328-main
+.LM2328:
+	call v4_Minus_Greater
+	mov (v4_max_Minusint),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,44,.LM2332-main
+.LM2332:
+	mov $160,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,32,.LM2336-main
+.LM2336:
+	mov $-3,%eax
+	call v4__dpush
+.stabn 68,0,44,.LM2338-main
+.LM2338:
+	call v4_Minus_Greater
+	mov $-3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,45,.LM2342-main
+.LM2342:
+	mov $170,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,33,.LM2346-main
+.LM2346:
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,45,.LM2348-main
+.LM2348:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,46,.LM2352-main
+.LM2352:
+	mov $180,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,34,.LM2356-main
+.LM2356:
+	mov $6,%eax
+	call v4__dpush
+	mov $-4,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,46,.LM2362-main
+.LM2362:
+	call v4_Minus_Greater
+	mov $6,%eax
+	call v4__dpush
+	mov $-4,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,47,.LM2370-main
+.LM2370:
+	mov $190,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,35,.LM2374-main
+.LM2374:
+	mov $7,%eax
+	call v4__dpush
+.stabn 68,0,47,.LM2376-main
+.LM2376:
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,48,.LM2380-main
+.LM2380:
+	mov $200,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,36,.LM2384-main
+.LM2384:
+	mov (v4_max_Minusuint),%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	call v4__dpush
+.stabn 68,0,48,.LM2393-main
+.LM2393:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,49,.LM2397-main
+.LM2397:
+	mov $210,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $20,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $20,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,50,.LM2412-main
+.LM2412:
+	mov $220,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,53,.LM2424-main
+.LM2424:
+	lea .LC2,%eax
+	call v4__dpush
+	mov $18,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,65,.LM2430-main
+.LM2430:
+	mov $1600,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $1000000,%eax
+	call v4__dpush
+	call v4_countdown
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,66,.LM2440-main
+.LM2440:
+	mov $1610,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	mov $60000,%eax
+	call v4__dpush
+	call v4_sumto
+	call v4_Minus_Greater
+	mov $1800030000,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,67,.LM2452-main
+.LM2452:
+	mov $1620,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+.stabn 68,0,67,.LM2461-main
+.LM2461:
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,68,.LM2465-main
+.LM2465:
+	mov $1630,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-4,%eax
+	call v4__dpush
+.stabn 68,0,60,.LM2471-main
+.LM2471:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L258
+	call v4__dpop
+	neg %eax
+	call v4__dpush
+	jmp .L259
+.L258:
+	call v4__dpop
+	add %eax,%eax
+	inc %eax
+	call v4__dpush
+.L259:
+.stabn 68,0,68,.LM2493-main
+.LM2493:
+	call v4_Minus_Greater
+	mov $4,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,69,.LM2497-main
+.LM2497:
+	mov $1640,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	call v4__dpush
+.stabn 68,0,60,.LM2503-main
+.LM2503:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L260
+	call v4__dpop
+	neg %eax
+	call v4__dpush
+	jmp .L261
+.L260:
+	call v4__dpop
+	add %eax,%eax
+	inc %eax
+	call v4__dpush
+.L261:
+.stabn 68,0,69,.LM2525-main
+.LM2525:
+	call v4_Minus_Greater
+	mov $9,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,70,.LM2529-main
+.LM2529:
+	mov $1650,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	mov %eax,-8(%ebp)
+	mov $3,%eax
+	mov %eax,%ecx
+	mov -8(%ebp),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,70,.LM2553-main
+.LM2553:
+	call v4_Minus_Greater
+	mov $8,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,71,.LM2557-main
+.LM2557:
+	mov $1660,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_tail_Minusloop
+	call v4_Minus_Greater
+	mov $11,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,72,.LM2565-main
+.LM2565:
+	mov $1670,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+	lea v4_tail1,%eax
+	call v4__dpush
+.stabn 68,0,63,.LM2573-main
+.LM2573:
+	call v4_execute
+.stabn 68,0,72,.LM2574-main
+.LM2574:
+	call v4_Minus_Greater
+	mov $11,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,75,.LM2578-main
+.LM2578:
+	lea .LC3,%eax
+	call v4__dpush
+	mov $18,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,86,.LM2584-main
+.LM2584:
+	mov $1700,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+.stabn 68,0,77,.LM2590-main
+.LM2590:
+	call v4_dup
+	call v4_Star
+.stabn 68,0,86,.LM2592-main
+.LM2592:
+	call v4_Minus_Greater
+	mov $49,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,87,.LM2596-main
+.LM2596:
+	mov $1710,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,78,.LM2604-main
+.LM2604:
+	call v4_z2dup
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	call v4__dpush
+.stabn 68,0,87,.LM2610-main
+.LM2610:
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,88,.LM2618-main
+.LM2618:
+	mov $1720,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_leaf_Minusloop
+	call v4_Minus_Greater
+	mov $45,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,89,.LM2626-main
+.LM2626:
+	mov $1730,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_leaf_Minusnested
+	call v4_Minus_Greater
+	mov $138,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,90,.LM2634-main
+.LM2634:
+	mov $1740,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%eax
+	mov %eax,-8(%ebp)
+	mov -8(%ebp),%eax
+	mov %eax,%ecx
+	mov -8(%ebp),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	add %edx,%eax
+	call v4__dpush
+.stabn 68,0,90,.LM2654-main
+.LM2654:
+	call v4_Minus_Greater
+	mov $12,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,91,.LM2658-main
+.LM2658:
+	mov $1750,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $42,%eax
+	mov %eax,(v4_leaf_Minusvar)
+	call v4__dpush
+.stabn 68,0,91,.LM2675-main
+.LM2675:
+	call v4_Minus_Greater
+	mov $42,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,92,.LM2679-main
+.LM2679:
+	mov $1760,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	lea v4_leaf1,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	mov $49,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,93,.LM2691-main
+.LM2691:
+	mov $1770,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	lea v4_leaf2,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,96,.LM2709-main
+.LM2709:
+	lea .LC4,%eax
+	call v4__dpush
+	mov $26,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,114,.LM2715-main
+.LM2715:
+	mov $300,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%ecx
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jge .L262
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L263
+.L262:
+	xor %eax,%eax
+	call v4__dpush
+.L263:
+.stabn 68,0,114,.LM2736-main
+.LM2736:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,115,.LM2740-main
+.LM2740:
+	mov $310,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov %eax,%ecx
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jge .L264
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L265
+.L264:
+	xor %eax,%eax
+	call v4__dpush
+.L265:
+.stabn 68,0,115,.LM2761-main
+.LM2761:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,116,.LM2765-main
+.LM2765:
+	mov $320,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	dec %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jge .L266
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L267
+.L266:
+	xor %eax,%eax
+	call v4__dpush
+.L267:
+.stabn 68,0,116,.LM2786-main
+.LM2786:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,117,.LM2790-main
+.LM2790:
+	mov $330,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%ecx
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jle .L268
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L269
+.L268:
+	xor %eax,%eax
+	call v4__dpush
+.L269:
+.stabn 68,0,117,.LM2811-main
+.LM2811:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,118,.LM2815-main
+.LM2815:
+	mov $340,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov %eax,%ecx
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jle .L270
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L271
+.L270:
+	xor %eax,%eax
+	call v4__dpush
+.L271:
+.stabn 68,0,118,.LM2836-main
+.LM2836:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,119,.LM2840-main
+.LM2840:
+	mov $350,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	cmp %edx,%eax
+	jne .L272
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L273
+.L272:
+	xor %eax,%eax
+	call v4__dpush
+.L273:
+.stabn 68,0,119,.LM2861-main
+.LM2861:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,120,.LM2865-main
+.LM2865:
+	mov $360,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%ecx
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jne .L274
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L275
+.L274:
+	xor %eax,%eax
+	call v4__dpush
+.L275:
+.stabn 68,0,120,.LM2886-main
+.LM2886:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,121,.LM2890-main
+.LM2890:
+	mov $370,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%ecx
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	je .L276
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L277
+.L276:
+	xor %eax,%eax
+	call v4__dpush
+.L277:
+.stabn 68,0,121,.LM2911-main
+.LM2911:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,122,.LM2915-main
+.LM2915:
+	mov $380,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	je .L278
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L279
+.L278:
+	xor %eax,%eax
+	call v4__dpush
+.L279:
+.stabn 68,0,122,.LM2936-main
+.LM2936:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,123,.LM2940-main
+.LM2940:
+	mov $390,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%ecx
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jae .L280
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L281
+.L280:
+	xor %eax,%eax
+	call v4__dpush
+.L281:
+.stabn 68,0,123,.LM2961-main
+.LM2961:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,124,.LM2965-main
+.LM2965:
+	mov $400,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov %eax,%ecx
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jae .L282
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L283
+.L282:
+	xor %eax,%eax
+	call v4__dpush
+.L283:
+.stabn 68,0,124,.LM2986-main
+.LM2986:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,125,.LM2990-main
+.LM2990:
+	mov $410,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	mov %eax,%ecx
+	mov (v4_max_Minusuint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jae .L284
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L285
+.L284:
+	xor %eax,%eax
+	call v4__dpush
+.L285:
+.stabn 68,0,125,.LM3011-main
+.LM3011:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,126,.LM3015-main
+.LM3015:
+	mov $420,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%ecx
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jbe .L286
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L287
+.L286:
+	xor %eax,%eax
+	call v4__dpush
+.L287:
+.stabn 68,0,126,.LM3036-main
+.LM3036:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,127,.LM3040-main
+.LM3040:
+	mov $430,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusuint),%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jbe .L288
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L289
+.L288:
+	xor %eax,%eax
+	call v4__dpush
+.L289:
+.stabn 68,0,127,.LM3061-main
+.LM3061:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,128,.LM3065-main
+.LM3065:
+	mov $440,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	cmp %edx,%eax
+	ja .L290
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L291
+.L290:
+	xor %eax,%eax
+	call v4__dpush
+.L291:
+.stabn 68,0,128,.LM3086-main
+.LM3086:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,129,.LM3090-main
+.LM3090:
+	mov $450,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%ecx
+	mov (v4_max_Minusint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	ja .L292
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L293
+.L292:
+	xor %eax,%eax
+	call v4__dpush
+.L293:
+.stabn 68,0,129,.LM3111-main
+.LM3111:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,130,.LM3115-main
+.LM3115:
+	mov $460,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov %eax,%ecx
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jb .L294
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L295
+.L294:
+	xor %eax,%eax
+	call v4__dpush
+.L295:
+.stabn 68,0,130,.LM3136-main
+.LM3136:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,131,.LM3140-main
+.LM3140:
+	mov $470,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusuint),%eax
+	mov %eax,%ecx
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jb .L296
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L297
+.L296:
+	xor %eax,%eax
+	call v4__dpush
+.L297:
+.stabn 68,0,131,.LM3161-main
+.LM3161:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,132,.LM3165-main
+.LM3165:
+	mov $480,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	jne .L298
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L299
+.L298:
+	xor %eax,%eax
+	call v4__dpush
+.L299:
+.stabn 68,0,132,.LM3183-main
+.LM3183:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,133,.LM3187-main
+.LM3187:
+	mov $490,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	test %eax,%eax
+	jne .L300
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L301
+.L300:
+	xor %eax,%eax
+	call v4__dpush
+.L301:
+.stabn 68,0,133,.LM3205-main
+.LM3205:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,134,.LM3209-main
+.LM3209:
+	mov $500,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	test %eax,%eax
+	jge .L302
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L303
+.L302:
+	xor %eax,%eax
+	call v4__dpush
+.L303:
+.stabn 68,0,134,.LM3227-main
+.LM3227:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,135,.LM3231-main
+.LM3231:
+	mov $510,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	test %eax,%eax
+	jge .L304
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L305
+.L304:
+	xor %eax,%eax
+	call v4__dpush
+.L305:
+.stabn 68,0,135,.LM3249-main
+.LM3249:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,136,.LM3253-main
+.LM3253:
+	mov $520,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	test %eax,%eax
+	jle .L306
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L307
+.L306:
+	xor %eax,%eax
+	call v4__dpush
+.L307:
+.stabn 68,0,136,.LM3271-main
+.LM3271:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,137,.LM3275-main
+.LM3275:
+	mov $530,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	test %eax,%eax
+	jle .L308
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L309
+.L308:
+	xor %eax,%eax
+	call v4__dpush
+.L309:
+.stabn 68,0,137,.LM3293-main
+.LM3293:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,138,.LM3297-main
+.LM3297:
+	mov $540,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	mov %eax,%ecx
+.stabn 68,0,109,.LM3303-main
+.LM3303:
+	mov $5,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jge .L310
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L311
+.L310:
+	xor %eax,%eax
+	call v4__dpush
+.L311:
+.stabn 68,0,138,.LM3318-main
+.LM3318:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,139,.LM3322-main
+.LM3322:
+	mov $550,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	mov %eax,%ecx
+.stabn 68,0,109,.LM3328-main
+.LM3328:
+	mov $5,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jge .L312
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L313
+.L312:
+	xor %eax,%eax
+	call v4__dpush
+.L313:
+.stabn 68,0,139,.LM3343-main
+.LM3343:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,140,.LM3347-main
+.LM3347:
+	mov $560,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%ecx
+.stabn 68,0,109,.LM3353-main
+.LM3353:
+	mov $5,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jge .L314
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L315
+.L314:
+	xor %eax,%eax
+	call v4__dpush
+.L315:
+.stabn 68,0,140,.LM3368-main
+.LM3368:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,141,.LM3372-main
+.LM3372:
+	mov $570,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	mov %eax,%ecx
+.stabn 68,0,109,.LM3378-main
+.LM3378:
+	mov $5,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	jge .L316
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L317
+.L316:
+	xor %eax,%eax
+	call v4__dpush
+.L317:
+.stabn 68,0,141,.LM3393-main
+.LM3393:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,142,.LM3397-main
+.LM3397:
+	mov $580,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+.stabn 68,0,110,.LM3403-main
+.LM3403:
+	xor %eax,%eax
+	call v4__dpush
+.L318:
+	call v4_over
+	call v4__dpop
+	test %eax,%eax
+	jle .L319
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	call v4_swap
+	call v4__dpop
+	dec %eax
+	call v4__dpush
+	call v4_swap
+	jmp .L318
+.L319:
+	call v4_nip
+.stabn 68,0,142,.LM3425-main
+.LM3425:
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,143,.LM3429-main
+.LM3429:
+	mov $590,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+.stabn 68,0,110,.LM3435-main
+.LM3435:
+	xor %eax,%eax
+	call v4__dpush
+.L320:
+	call v4_over
+	call v4__dpop
+	test %eax,%eax
+	jle .L321
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	call v4_swap
+	call v4__dpop
+	dec %eax
+	call v4__dpush
+	call v4_swap
+	jmp .L320
+.L321:
+	call v4_nip
+.stabn 68,0,143,.LM3457-main
+.LM3457:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,144,.LM3461-main
+.LM3461:
+	mov $600,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+.stabn 68,0,110,.LM3467-main
+.LM3467:
+	xor %eax,%eax
+	call v4__dpush
+.L322:
+	call v4_over
+	call v4__dpop
+	test %eax,%eax
+	jle .L323
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	call v4_swap
+	call v4__dpop
+	dec %eax
+	call v4__dpush
+	call v4_swap
+	jmp .L322
+.L323:
+	call v4_nip
+.stabn 68,0,144,.LM3489-main
+.LM3489:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,145,.LM3493-main
+.LM3493:
+	mov $610,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+.stabn 68,0,111,.LM3499-main
+.LM3499:
+	xor %eax,%eax
+	call v4__dpush
+.L324:
+	call v4__dpop
+	inc %eax
+	call v4__dpush
+	call v4_z2dup
+	call v4__dpop
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jne .L324
+	call v4_nip
+.stabn 68,0,145,.LM3514-main
+.LM3514:
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,146,.LM3518-main
+.LM3518:
+	mov $620,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	mov $2,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	je .L325
+	call v4_drop
+	mov (v4_Lesstrue_Greater),%eax
+	call v4__dpush
+.L325:
+.stabn 68,0,146,.LM3538-main
+.LM3538:
+	call v4_Minus_Greater
+	mov (v4_Lesstrue_Greater),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,147,.LM3542-main
+.LM3542:
+	mov $630,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	cmp %edx,%eax
+	setl %al
+	movzbl %al,%eax
+	neg %eax
+	call v4__dpush
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	je .L326
+	call v4_drop
+	mov (v4_Lesstrue_Greater),%eax
+	call v4__dpush
+.L326:
+.stabn 68,0,147,.LM3562-main
+.LM3562:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,150,.LM3566-main
+.LM3566:
+	lea .LC5,%eax
+	call v4__dpush
+	mov $21,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,178,.LM3572-main
+.LM3572:
+	mov $700,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov $99,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,179,.LM3582-main
+.LM3582:
+	mov $710,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov $10,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,180,.LM3592-main
+.LM3592:
+	mov $720,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov $13,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,181,.LM3602-main
+.LM3602:
+	mov $730,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov $15,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,182,.LM3612-main
+.LM3612:
+	mov $740,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%eax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov $106,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,183,.LM3622-main
+.LM3622:
+	mov $750,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+	mov $100,%eax
+	call v4__dpush
+	lea v4_Plus,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,184,.LM3637-main
+.LM3637:
+	mov $760,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov (v4_max_Minusint),%eax
+	call v4__dpush
+	mov $100,%eax
+	call v4__dpush
+	lea v4_Plus,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,185,.LM3652-main
+.LM3652:
+	mov $770,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-3,%eax
+	call v4__dpush
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,186,.LM3662-main
+.LM3662:
+	mov $780,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%eax
+	call v4__dpush
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,187,.LM3672-main
+.LM3672:
+	mov $790,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_gapped
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,188,.LM3682-main
+.LM3682:
+	mov $800,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,189,.LM3692-main
+.LM3692:
+	mov $810,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+	call v4_gapped
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,190,.LM3702-main
+.LM3702:
+	mov $820,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	call v4__dpush
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,191,.LM3712-main
+.LM3712:
+	mov $830,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-1000,%eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,192,.LM3722-main
+.LM3722:
+	mov $840,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,193,.LM3732-main
+.LM3732:
+	mov $850,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,194,.LM3742-main
+.LM3742:
+	mov $860,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $100,%eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $4,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,195,.LM3752-main
+.LM3752:
+	mov $870,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $1000,%eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,196,.LM3762-main
+.LM3762:
+	mov $880,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $65536,%eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $6,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,197,.LM3772-main
+.LM3772:
+	mov $890,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-1001,%eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,198,.LM3782-main
+.LM3782:
+	mov $900,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,199,.LM3792-main
+.LM3792:
+	mov $910,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $8,%eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,200,.LM3802-main
+.LM3802:
+	mov $920,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $999,%eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,201,.LM3812-main
+.LM3812:
+	mov $930,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $65537,%eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,202,.LM3822-main
+.LM3822:
+	mov $940,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,203,.LM3832-main
+.LM3832:
+	mov $950,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,204,.LM3842-main
+.LM3842:
+	mov $960,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_nodefault
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,205,.LM3850-main
+.LM3850:
+	mov $970,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%eax
+	call v4__dpush
+	call v4_nodefault
+	call v4_Minus_Greater
+	mov $4,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,206,.LM3860-main
+.LM3860:
+	mov $980,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+	call v4_nodefault
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,209,.LM3868-main
+.LM3868:
+	lea .LC6,%eax
+	call v4__dpush
+	mov $48,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,228,.LM3874-main
+.LM3874:
+	xor %eax,%eax
+	mov %eax,(v4_Hashdividends)
+.stabn 68,0,239,.LM3881-main
+.LM3881:
+	xor %eax,%eax
+	call v4__dpush
+	call v4_dividend_Comma
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_dividend_Comma
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov $2,%eax
+	call v4__dpush
+	call v4_dividend_Comma
+.stabn 68,0,240,.LM3893-main
+.LM3893:
+	mov $-2,%eax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov $7,%eax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov $-7,%eax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov $100,%eax
+	call v4__dpush
+	call v4_dividend_Comma
+.stabn 68,0,241,.LM3905-main
+.LM3905:
+	mov $-100,%eax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov $12345,%eax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov $-12345,%eax
+	call v4__dpush
+	call v4_dividend_Comma
+.stabn 68,0,242,.LM3914-main
+.LM3914:
+	mov (v4_max_Minusint),%eax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov (v4_max_Minusint),%eax
+	dec %eax
+	call v4__dpush
+	call v4_dividend_Comma
+.stabn 68,0,243,.LM3924-main
+.LM3924:
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov (v4_min_Minusint),%eax
+	inc %eax
+	call v4__dpush
+	call v4_dividend_Comma
+.stabn 68,0,245,.LM3934-main
+.LM3934:
+	mov $1000,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash1,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	lea v4_Slash,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,246,.LM3948-main
+.LM3948:
+	mov $1010,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod1,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	lea v4_mod,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,247,.LM3962-main
+.LM3962:
+	mov $1020,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	lea v4_Slash,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,248,.LM3976-main
+.LM3976:
+	mov $1030,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod2,%eax
+	call v4__dpush
+	mov $2,%eax
+	call v4__dpush
+	lea v4_mod,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,249,.LM3990-main
+.LM3990:
+	mov $1040,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash3,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	lea v4_Slash,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,250,.LM4004-main
+.LM4004:
+	mov $1050,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod3,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	lea v4_mod,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,251,.LM4018-main
+.LM4018:
+	mov $1060,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash_Minus3,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+	lea v4_Slash,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,252,.LM4032-main
+.LM4032:
+	mov $1070,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod_Minus3,%eax
+	call v4__dpush
+	mov $-3,%eax
+	call v4__dpush
+	lea v4_mod,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,253,.LM4046-main
+.LM4046:
+	mov $1080,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash7,%eax
+	call v4__dpush
+	mov $7,%eax
+	call v4__dpush
+	lea v4_Slash,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,254,.LM4060-main
+.LM4060:
+	mov $1090,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod7,%eax
+	call v4__dpush
+	mov $7,%eax
+	call v4__dpush
+	lea v4_mod,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,255,.LM4074-main
+.LM4074:
+	mov $1100,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash8,%eax
+	call v4__dpush
+	mov $8,%eax
+	call v4__dpush
+	lea v4_Slash,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,256,.LM4088-main
+.LM4088:
+	mov $1110,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod8,%eax
+	call v4__dpush
+	mov $8,%eax
+	call v4__dpush
+	lea v4_mod,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,257,.LM4102-main
+.LM4102:
+	mov $1120,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash_Minus8,%eax
+	call v4__dpush
+	mov $-8,%eax
+	call v4__dpush
+	lea v4_Slash,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,258,.LM4116-main
+.LM4116:
+	mov $1130,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod_Minus8,%eax
+	call v4__dpush
+	mov $-8,%eax
+	call v4__dpush
+	lea v4_mod,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,259,.LM4130-main
+.LM4130:
+	mov $1140,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash10,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	lea v4_Slash,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,260,.LM4144-main
+.LM4144:
+	mov $1150,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod10,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	lea v4_mod,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,261,.LM4158-main
+.LM4158:
+	mov $1160,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash_Minus10,%eax
+	call v4__dpush
+	mov $-10,%eax
+	call v4__dpush
+	lea v4_Slash,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,262,.LM4172-main
+.LM4172:
+	mov $1170,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod_Minus10,%eax
+	call v4__dpush
+	mov $-10,%eax
+	call v4__dpush
+	lea v4_mod,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,263,.LM4186-main
+.LM4186:
+	mov $1180,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star0,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	lea v4_Star,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,264,.LM4200-main
+.LM4200:
+	mov $1190,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star1,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	lea v4_Star,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,265,.LM4214-main
+.LM4214:
+	mov $1200,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star_Minus1,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	lea v4_Star,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,266,.LM4228-main
+.LM4228:
+	mov $1210,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star3,%eax
+	call v4__dpush
+	mov $3,%eax
+	call v4__dpush
+	lea v4_Star,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,267,.LM4242-main
+.LM4242:
+	mov $1220,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star8,%eax
+	call v4__dpush
+	mov $8,%eax
+	call v4__dpush
+	lea v4_Star,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,268,.LM4256-main
+.LM4256:
+	mov $1230,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star_Minus8,%eax
+	call v4__dpush
+	mov $-8,%eax
+	call v4__dpush
+	lea v4_Star,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,269,.LM4270-main
+.LM4270:
+	mov $1240,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star10,%eax
+	call v4__dpush
+	mov $10,%eax
+	call v4__dpush
+	lea v4_Star,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,270,.LM4284-main
+.LM4284:
+	mov $1250,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star_Minus7,%eax
+	call v4__dpush
+	mov $-7,%eax
+	call v4__dpush
+	lea v4_Star,%eax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,274,.LM4298-main
+.LM4298:
+	mov $1270,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+.stabn 68,0,220,.LM4304-main
+.LM4304:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slash
+.stabn 68,0,274,.LM4307-main
+.LM4307:
+	call v4_Minus_Greater
+	mov $-7,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,275,.LM4311-main
+.LM4311:
+	mov $1280,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	call v4__dpush
+.stabn 68,0,220,.LM4317-main
+.LM4317:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slash
+.stabn 68,0,275,.LM4320-main
+.LM4320:
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,276,.LM4324-main
+.LM4324:
+	mov $1290,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	call v4__dpush
+.stabn 68,0,220,.LM4330-main
+.LM4330:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slash
+.stabn 68,0,276,.LM4333-main
+.LM4333:
+	call v4_Minus_Greater
+	mov (v4_max_Minusint),%eax
+	neg %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,277,.LM4341-main
+.LM4341:
+	mov $1300,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,220,.LM4351-main
+.LM4351:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Slash
+.stabn 68,0,277,.LM4354-main
+.LM4354:
+	call v4_Minus_Greater
+	mov (v4_max_Minusint),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,278,.LM4358-main
+.LM4358:
+	mov $1310,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+.stabn 68,0,220,.LM4364-main
+.LM4364:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_mod
+.stabn 68,0,278,.LM4367-main
+.LM4367:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,279,.LM4371-main
+.LM4371:
+	mov $1320,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	inc %eax
+	call v4__dpush
+.stabn 68,0,220,.LM4381-main
+.LM4381:
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_mod
+.stabn 68,0,279,.LM4384-main
+.LM4384:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,280,.LM4388-main
+.LM4388:
+	mov $1330,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	mov %eax,%edx
+	sar $31,%edx
+	shr $29,%edx
+	add %edx,%eax
+	sar $3,%eax
+	neg %eax
+	call v4__dpush
+.stabn 68,0,280,.LM4400-main
+.LM4400:
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+	mov $-8,%eax
+	call v4__dpush
+	lea v4_Slash,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,281,.LM4409-main
+.LM4409:
+	mov $1340,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $12,%eax
+	call v4__dpush
+.stabn 68,0,281,.LM4416-main
+.LM4416:
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	lea v4_cells,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,282,.LM4423-main
+.LM4423:
+	mov $1350,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_min_Minusint),%eax
+	inc %eax
+	shl $2,%eax
+	call v4__dpush
+.stabn 68,0,282,.LM4437-main
+.LM4437:
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	inc %eax
+	call v4__dpush
+	lea v4_cells,%eax
+	call v4__dpush
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,285,.LM4448-main
+.LM4448:
+	lea .LC7,%eax
+	call v4__dpush
+	mov $31,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,287,.LM4454-main
+.LM4454:
+	mov $100,%eax
+	mov %eax,(v4_hundred)
+.stabn 68,0,288,.LM4458-main
+.LM4458:
+	xor %eax,%eax
+	dec %eax
+	mov %eax,(v4_minus_Minusone)
+.stabn 68,0,292,.LM4462-main
+.LM4462:
+	mov $2147483647,%eax
+	mov %eax,(v4_biggest)
+.stabn 68,0,294,.LM4466-main
+.LM4466:
+	mov $300,%eax
+	mov %eax,(v4_three_Minushundred)
+.stabn 68,0,295,.LM4473-main
+.LM4473:
+	xor %eax,%eax
+	mov %eax,(v4_zero)
+.stabn 68,0,309,.LM4477-main
+.LM4477:
+	mov $1400,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,297,.LM4481-main
+.LM4481:
+	mov $200,%eax
+	call v4__dpush
+.stabn 68,0,309,.LM4484-main
+.LM4484:
+	call v4_Minus_Greater
+	mov $200,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,310,.LM4488-main
+.LM4488:
+	mov $1410,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,298,.LM4492-main
+.LM4492:
+	mov $4,%eax
+	call v4__dpush
+.stabn 68,0,310,.LM4497-main
+.LM4497:
+	call v4_Minus_Greater
+	mov $4,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,311,.LM4501-main
+.LM4501:
+	mov $1420,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,299,.LM4505-main
+.LM4505:
+	mov $-2147483648,%eax
+	call v4__dpush
+.stabn 68,0,311,.LM4508-main
+.LM4508:
+	call v4_Minus_Greater
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,312,.LM4512-main
+.LM4512:
+	mov $1430,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,300,.LM4516-main
+.LM4516:
+	mov $301,%eax
+	call v4__dpush
+.stabn 68,0,312,.LM4519-main
+.LM4519:
+	call v4_Minus_Greater
+	mov $301,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,313,.LM4523-main
+.LM4523:
+	mov $1440,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-100,%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-100,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,314,.LM4538-main
+.LM4538:
+	mov $1450,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,315,.LM4548-main
+.LM4548:
+	mov $1460,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $100,%eax
+	call v4__dpush
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	mov $2,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,316,.LM4558-main
+.LM4558:
+	mov $1470,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,317,.LM4568-main
+.LM4568:
+	mov $1480,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	call v4__dpush
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	mov $4,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,318,.LM4578-main
+.LM4578:
+	mov $1490,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,319,.LM4588-main
+.LM4588:
+	mov $1500,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%eax
+	call v4__dpush
+	lea v4_use_Minuszero,%eax
+	call v4__dpush
+	call v4_catch
+	call v4_nip
+	call v4_Minus_Greater
+	mov $-10,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,322,.LM4601-main
+.LM4601:
+	lea .LC8,%eax
+	call v4__dpush
+	mov $16,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,345,.LM4607-main
+.LM4607:
+	mov $1800,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%eax
+	call v4__dpush
+	mov $50,%eax
+	call v4__dpush
+	mov $300,%eax
+	call v4__dpush
+.stabn 68,0,325,.LM4618-main
+.LM4618:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L350
+	call v4_drop
+	xor %eax,%eax
+	call v4__dpush
+	jmp .L352
+.L350:
+.stabn 68,0,326,.LM4629-main
+.LM4629:
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L351
+	call v4_drop
+	mov $100,%eax
+	call v4__dpush
+.L351:
+.L352:
+.stabn 68,0,336,.LM4644-main
+.LM4644:
+	call v4_rot
+.stabn 68,0,325,.LM4646-main
+.LM4646:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L353
+	call v4_drop
+	xor %eax,%eax
+	call v4__dpush
+	jmp .L355
+.L353:
+.stabn 68,0,326,.LM4657-main
+.LM4657:
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L354
+	call v4_drop
+	mov $100,%eax
+	call v4__dpush
+.L354:
+.L355:
+.stabn 68,0,336,.LM4672-main
+.LM4672:
+	call v4_rot
+.stabn 68,0,325,.LM4674-main
+.LM4674:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L356
+	call v4_drop
+	xor %eax,%eax
+	call v4__dpush
+	jmp .L358
+.L356:
+.stabn 68,0,326,.LM4685-main
+.LM4685:
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L357
+	call v4_drop
+	mov $100,%eax
+	call v4__dpush
+.L357:
+.L358:
+.stabn 68,0,336,.LM4700-main
+.LM4700:
+	call v4_rot
+.stabn 68,0,345,.LM4701-main
+.LM4701:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	mov $50,%eax
+	call v4__dpush
+	mov $100,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,346,.LM4709-main
+.LM4709:
+	mov $1810,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,337,.LM4713-main
+.LM4713:
+	mov $-5,%eax
+	call v4__dpush
+	call v4_sign
+	xor %eax,%eax
+	call v4__dpush
+	call v4_sign
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+	call v4_sign
+.stabn 68,0,346,.LM4722-main
+.LM4722:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,347,.LM4730-main
+.LM4730:
+	mov $1820,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	call v4__dpush
+.stabn 68,0,338,.LM4736-main
+.LM4736:
+	call v4_twice
+	call v4_twice
+.stabn 68,0,347,.LM4738-main
+.LM4738:
+	call v4_Minus_Greater
+	mov $12,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,348,.LM4742-main
+.LM4742:
+	mov $1830,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_sum_Minusi
+	call v4_Minus_Greater
+	mov $10,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,349,.LM4750-main
+.LM4750:
+	mov $1840,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_sum_Minusi_Minusnoinline
+	call v4_Minus_Greater
+	mov $10,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,350,.LM4758-main
+.LM4758:
+	mov $1850,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_sum_Minusj
+	call v4_Minus_Greater
+	mov $6,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,351,.LM4766-main
+.LM4766:
+	mov $1860,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,342,.LM4770-main
+.LM4770:
+	mov $10,%eax
+	call v4__dpush
+	call v4_find_Minusfirst
+	mov $3,%eax
+	call v4__dpush
+	call v4_find_Minusfirst
+.stabn 68,0,351,.LM4776-main
+.LM4776:
+	call v4_Minus_Greater
+	mov $4,%eax
+	call v4__dpush
+	xor %eax,%eax
+	dec %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,352,.LM4782-main
+.LM4782:
+	mov $1870,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_use_Minusin_Minusloop
+	call v4_Minus_Greater
+	mov $250,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,353,.LM4790-main
+.LM4790:
+	mov $1880,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $10,%eax
+	call v4__dpush
+	call v4_factorial
+	call v4_Minus_Greater
+	mov $3628800,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,354,.LM4800-main
+.LM4800:
+	mov $1890,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_max_Minusint),%eax
+	call v4__dpush
+.stabn 68,0,325,.LM4806-main
+.LM4806:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L327
+	call v4_drop
+	xor %eax,%eax
+	call v4__dpush
+	jmp .L329
+.L327:
+.stabn 68,0,326,.LM4817-main
+.LM4817:
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L328
+	call v4_drop
+	mov $100,%eax
+	call v4__dpush
+.L328:
+.L329:
+.stabn 68,0,354,.LM4832-main
+.LM4832:
+	mov (v4_min_Minusint),%eax
+	call v4__dpush
+.stabn 68,0,325,.LM4835-main
+.LM4835:
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	jge .L330
+	call v4_drop
+	xor %eax,%eax
+	call v4__dpush
+	jmp .L332
+.L330:
+.stabn 68,0,326,.LM4846-main
+.LM4846:
+	call v4_dup
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jle .L331
+	call v4_drop
+	mov $100,%eax
+	call v4__dpush
+.L331:
+.L332:
+.stabn 68,0,354,.LM4861-main
+.LM4861:
+	call v4_Minus_Greater
+	mov $100,%eax
+	call v4__dpush
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,357,.LM4867-main
+.LM4867:
+	lea .LC9,%eax
+	call v4__dpush
+	mov $31,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,367,.LM4873-main
+.LM4873:
+	mov $1900,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%eax
+	mov %eax,(v4_step)
+	mov $10,%eax
+	call v4__dpush
+	call v4_sum_Minusstep
+	call v4_Minus_Greater
+	mov $30,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,368,.LM4890-main
+.LM4890:
+	mov $1910,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,(v4_step)
+	mov $4,%eax
+	call v4__dpush
+	call v4_bump_Minusstep
+	mov (v4_step),%eax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $10,%eax
+	call v4__dpush
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,369,.LM4914-main
+.LM4914:
+	mov $1920,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%eax
+	mov %eax,(v4_step)
+	mov $2,%eax
+	call v4__dpush
+	call v4_sum_Minusstep_Minus2
+	call v4_Minus_Greater
+	mov $15,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,372,.LM4931-main
+.LM4931:
+	lea .LC10,%eax
+	call v4__dpush
+	mov $25,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,389,.LM4937-main
+.LM4937:
+	mov $2000,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%eax
+	mov %eax,(v4_cell_Minusv)
+	call v4__dpush
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $6,%eax
+	call v4__dpush
+	mov $6,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,390,.LM4964-main
+.LM4964:
+	mov $2010,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $8,%eax
+	mov %eax,(v4_cell_Minusv)
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,390,.LM4985-main
+.LM4985:
+	call v4_Minus_Greater
+	mov $8,%eax
+	call v4__dpush
+	mov $8,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,391,.LM4991-main
+.LM4991:
+	mov $2020,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	mov %eax,%ecx
+	mov $2,%eax
+	mov %ecx,%eax
+	mov %eax,(v4_cell_Minusv)
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,392,.LM5018-main
+.LM5018:
+	mov $2030,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_cell_Minusv,%eax
+	call v4__dpush
+.stabn 68,0,384,.LM5024-main
+.LM5024:
+	mov $5,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov $9,%eax
+	call v4__dpush
+	call v4_swap
+	call v4_Store
+	mov (v4_cell_Minusv),%eax
+	call v4__dpush
+.stabn 68,0,392,.LM5040-main
+.LM5040:
+	call v4_Minus_Greater
+	mov $9,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,393,.LM5044-main
+.LM5044:
+	mov $2040,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_cell_Minusv,%eax
+	call v4__dpush
+.stabn 68,0,385,.LM5050-main
+.LM5050:
+	xor %eax,%eax
+	mov %eax,(v4_cell_Minusv)
+	mov $7,%eax
+	call v4__dpush
+	call v4_swap
+	call v4_c_Store
+	mov (v4_cell_Minusv),%eax
+	call v4__dpush
+.stabn 68,0,393,.LM5066-main
+.LM5066:
+	call v4_Minus_Greater
+	mov $7,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,394,.LM5070-main
+.LM5070:
+	mov $2050,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_cell_Minusv,%eax
+	call v4__dpush
+.stabn 68,0,386,.LM5076-main
+.LM5076:
+	mov $3,%eax
+	mov %eax,(v4_cell_Minusv)
+	call v4_Fetch
+	mov $4,%eax
+	mov %eax,(v4_cell_Minusv)
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	mov $4,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,395,.LM5102-main
+.LM5102:
+	mov $2060,%eax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,387,.LM5106-main
+.LM5106:
+	mov $5,%eax
+	mov %eax,(v4_cell_Minusv)
+	call v4__dpush
+	call v4_set_Minuscell_Minusv
+	mov (v4_cell_Minusv),%eax
+	call v4__dpush
+.stabn 68,0,395,.LM5124-main
+.LM5124:
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	mov $11,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,398,.LM5130-main
+.LM5130:
+	lea .LC11,%eax
+	call v4__dpush
+	mov $40,%eax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,414,.LM5136-main
+.LM5136:
+	mov $2100,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	je .L333
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	je .L334
+	call v4_drop
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L335
+.L333:
+	call v4_drop
+	mov $3,%eax
+	call v4__dpush
+.L334:
+.L335:
+.stabn 68,0,414,.LM5159-main
+.LM5159:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,415,.LM5163-main
+.LM5163:
+	mov $2110,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	xor %eax,%eax
+	inc %eax
+	je .L336
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	je .L337
+	call v4_drop
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L338
+.L336:
+	call v4_drop
+	mov $3,%eax
+	call v4__dpush
+.L337:
+.L338:
+.stabn 68,0,415,.LM5186-main
+.LM5186:
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,416,.LM5190-main
+.LM5190:
+	mov $2120,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%eax
+	call v4__dpush
+	xor %eax,%eax
+	je .L339
+	call v4_dup
+	call v4__dpop
+	test %eax,%eax
+	je .L340
+	call v4_drop
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+	jmp .L341
+.L339:
+	call v4_drop
+	mov $3,%eax
+	call v4__dpush
+.L340:
+.L341:
+.stabn 68,0,416,.LM5213-main
+.LM5213:
+	call v4_Minus_Greater
+	mov $3,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,417,.LM5217-main
+.LM5217:
+	mov $2130,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $10,%eax
+	call v4__dpush
+	call v4_count_Minusodd
+	call v4_Minus_Greater
+	mov $5,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,418,.LM5227-main
+.LM5227:
+	mov $2140,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+	call v4_count_Minusodd
+	call v4_Minus_Greater
+	xor %eax,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,419,.LM5237-main
+.LM5237:
+	mov $2150,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov (v4_Lesstrue_Greater),%eax
+	test %eax,%eax
+	jne .L343
+.L342:
+	jmp .L342
+.L343:
+.stabn 68,0,419,.LM5251-main
+.LM5251:
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,420,.LM5253-main
+.LM5253:
+	mov $2160,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	inc %eax
+	call v4__dpush
+.L344:
+	call v4_dup
+	mov $10,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L345
+	call v4__dpop
+	inc %eax
+	add %eax,%eax
+	call v4__dpush
+	jmp .L344
+.L345:
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	call v4__dpush
+.stabn 68,0,420,.LM5286-main
+.LM5286:
+	call v4_Minus_Greater
+	mov $110,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,421,.LM5290-main
+.LM5290:
+	mov $2170,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %eax,%eax
+	call v4__dpush
+.L346:
+	call v4_dup
+	mov $10,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L347
+	call v4__dpop
+	inc %eax
+	add %eax,%eax
+	call v4__dpush
+	jmp .L346
+.L347:
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	call v4__dpush
+.stabn 68,0,421,.LM5323-main
+.LM5323:
+	call v4_Minus_Greater
+	mov $114,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,422,.LM5327-main
+.LM5327:
+	mov $2180,%eax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $20,%eax
+	call v4__dpush
+.L348:
+	call v4_dup
+	mov $10,%eax
+	mov %eax,%edx
+	call v4__dpop
+	cmp %edx,%eax
+	jge .L349
+	call v4__dpop
+	inc %eax
+	add %eax,%eax
+	call v4__dpush
+	jmp .L348
+.L349:
+	mov $100,%eax
+	mov %eax,%edx
+	call v4__dpop
+	add %edx,%eax
+	call v4__dpush
+.stabn 68,0,422,.LM5360-main
+.LM5360:
+	call v4_Minus_Greater
+	mov $120,%eax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,424,.LM5364-main
+.LM5364:
+	call v4_test_Minusstatus
+	call v4_Fetch
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	jmp v4_drop
+.LBE1:
+.stabn 68,0,424,.LM5368-main
+.LM5368:
+	lea -4(%ebp),%esp
+	pop %ebx
+	leave
+	ret
+.Lfe1:
+	.size	 main,.Lfe1-main
+.stabn	192,0,0,.LBB1-main
+.stabn	224,0,0,.LBE1-main
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,76 @@
+	.file	"rslib.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/testsuite/",100,0,0,Ltext0
+.stabs	"rslib.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_show:F1",36,0,0,v4_show
+.globl v4_show
+	.type	v4_show,@function
+v4_show:
+.stabn 68,0,8,.LMa0-v4_show
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,8,.LMb0-v4_show
+.LMb0:
+.LBB0:
+	call v4_i
+	pop %ebx
+	leave
+	jmp v4_Dot
+.LBE0:
+.stabn 68,0,8,.LM4-v4_show
+.LM4:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_show,.Lfe0-v4_show
+.stabn	192,0,0,.LBB0-v4_show
+.stabn	224,0,0,.LBE0-v4_show
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_show
+.text
+	.align 4
+.stabs "v4_peek:F1",36,0,0,v4_peek
+.globl v4_peek
+	.type	v4_peek,@function
+v4_peek:
+.stabn 68,0,9,.LMa5-v4_peek
+.LMa5:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,9,.LMb5-v4_peek
+.LMb5:
+.LBB3:
+	call v4_r_Fetch
+	pop %ebx
+	leave
+	jmp v4_Dot
+.LBE3:
+.stabn 68,0,9,.LM9-v4_peek
+.LM9:
+	pop %ebx
+	leave
+	ret
+.Lfe3:
+	.size	 v4_peek,.Lfe3-v4_peek
+.stabn	192,0,0,.LBB3-v4_peek
+.stabn	224,0,0,.LBE3-v4_peek
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4_peek
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
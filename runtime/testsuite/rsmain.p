@@ -0,0 +1,84 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: rsmain.ft
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug optimize intermediate assembly
+
+Symbols:
+    11 Sym_8 word "main"
+     9 Sym_4 external "v4_Greaterr"
+     8 Sym_2 external "v4_cr"
+     9 Sym_7 external "v4_drop"
+     9 Sym_5 external "v4_peek"
+     9 Sym_6 external "v4_r_Greater"
+     8 Sym_1 external "v4_show"
+     8 Sym_0 word "v4_t1"
+     9 Sym_3 word "v4_t2"
+
+Intermediate code:
+     8 function Sym_0 {
+     8   Reg_0 = 5
+     8   Reg_2 = Reg_0
+           optimizes   Stack_D = Reg_0
+     8   Reg_0 = 0
+     8   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+     8   no-op
+           optimizes   Reg_1 = Stack_D
+     8   Reg_0 = Reg_2
+           optimizes   Reg_0 = Stack_D
+     8   Stack_R = Reg_0
+     8   Stack_R = Reg_1
+     8 label Label_3
+     8   call Sym_1
+     8   Reg_1 = Stack_R
+     8   Reg_1 += 1
+     8   Reg_0 = Stack_R
+     8   Stack_R = Reg_0
+     8   Stack_R = Reg_1
+     8   Reg_1 -= Reg_0
+     8   if Reg_1 != 0 goto Label_3
+     8   no-op
+           optimizes label Label_4
+     8   Reg_0 = Stack_R
+     8   Reg_0 = Stack_R
+     8   no-op
+           optimizes label Label_2
+     8   tail call Sym_2
+           optimizes   call Sym_2
+     8   no-op
+           optimizes label Label_1
+     8 }
+
+     9 function Sym_3 {
+     9   Reg_0 = 7
+     9   Stack_D = Reg_0
+     9   call Sym_4
+     9   call Sym_5
+     9   call Sym_6
+     9   call Sym_7
+     9   tail call Sym_2
+           optimizes   call Sym_2
+     9   no-op
+           optimizes label Label_5
+     9 }
+
+    11 function Sym_8 {
+    11   call Sym_0
+    11   no-op
+           optimizes   call Sym_3
+     9   Reg_0 = 7
+     9   Stack_D = Reg_0
+     9   call Sym_4
+     9   call Sym_5
+     9   call Sym_6
+     9   call Sym_7
+     9   tail call Sym_2
+           optimizes   call Sym_2
+    11   no-op
+           optimizes label Label_0
+    11 }
+
+Peephole rewrites:
+  v4_t1: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_t1: redundant-test: test %edx,%edx => (none)
+
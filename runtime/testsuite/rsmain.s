@@ -0,0 +1,147 @@
+	.file	"rsmain.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/testsuite/",100,0,0,Ltext0
+.stabs	"rsmain.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_t1:F1",36,0,0,v4_t1
+.globl v4_t1
+	.type	v4_t1,@function
+v4_t1:
+.stabn 68,0,8,.LMa0-v4_t1
+.LMa0:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,8,.LMb0-v4_t1
+.LMb0:
+.LBB0:
+	mov $5,%eax
+	mov %eax,%ecx
+	xor %eax,%eax
+	mov %eax,%edx
+	mov %ecx,%eax
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+.L3:
+	call v4_show
+	call v4__rpop
+	mov %eax,%edx
+	inc %edx
+	call v4__rpop
+	call v4__rpush
+	xchg %edx,%eax
+	call v4__rpush
+	xchg %eax,%edx
+	sub %eax,%edx
+	jne .L3
+	call v4__rpop
+	call v4__rpop
+	pop %ebx
+	leave
+	jmp v4_cr
+.LBE0:
+.stabn 68,0,8,.LM24-v4_t1
+.LM24:
+	pop %ebx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_t1,.Lfe0-v4_t1
+.stabn	192,0,0,.LBB0-v4_t1
+.stabn	224,0,0,.LBE0-v4_t1
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_t1
+.text
+	.align 4
+.stabs "v4_t2:F1",36,0,0,v4_t2
+.globl v4_t2
+	.type	v4_t2,@function
+v4_t2:
+.stabn 68,0,9,.LMa25-v4_t2
+.LMa25:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+.stabn 68,0,9,.LMb25-v4_t2
+.LMb25:
+.LBB3:
+	mov $7,%eax
+	call v4__dpush
+	call v4_Greaterr
+	call v4_peek
+	call v4_r_Greater
+	call v4_drop
+	pop %ebx
+	leave
+	jmp v4_cr
+.LBE3:
+.stabn 68,0,9,.LM34-v4_t2
+.LM34:
+	pop %ebx
+	leave
+	ret
+.Lfe3:
+	.size	 v4_t2,.Lfe3-v4_t2
+.stabn	192,0,0,.LBB3-v4_t2
+.stabn	224,0,0,.LBE3-v4_t2
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4_t2
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,11,.LMa35-main
+.LMa35:
+	push %ebp
+	mov %esp,%ebp
+	push %ebx
+	mov 8(%ebp),%eax
+	mov %eax,v4__argc
+	mov 12(%ebp),%eax
+	mov %eax,v4__argv
+	mov 16(%ebp),%eax
+	mov %eax,v4__envp
+.stabn 68,0,11,.LMb35-main
+.LMb35:
+.LBB8:
+	call v4_t1
+.stabn 68,0,9,.LM38-main
+.LM38:
+	mov $7,%eax
+	call v4__dpush
+	call v4_Greaterr
+	call v4_peek
+	call v4_r_Greater
+	call v4_drop
+	pop %ebx
+	leave
+	jmp v4_cr
+.LBE8:
+.stabn 68,0,11,.LM46-main
+.LM46:
+	pop %ebx
+	leave
+	ret
+.Lfe8:
+	.size	 main,.Lfe8-main
+.stabn	192,0,0,.LBB8-main
+.stabn	224,0,0,.LBE8-main
+.Lscope8:
+.stabs	"",36,0,0,.Lscope8-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
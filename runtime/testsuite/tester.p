@@ -0,0 +1,388 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: tester.ft
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug optimize intermediate assembly
+
+Data:
+    43 Data_0 string[18] "INCORRECT RESULT: "
+    47 Data_1 string[25] "WRONG NUMBER OF RESULTS: "
+
+Symbols:
+    19 Sym_12 external "v4_Dot"
+    39 Sym_24 external "v4_Equals"
+    19 Sym_11 external "v4_Fetch"
+    27 Sym_17 word "v4_Leftbrace"
+    43 Sym_25 external "v4_Less_Greater"
+    31 Sym_19 word "v4_Minus_Greater"
+    34 Sym_22 external "v4_Plus"
+    15 Sym_7 external "v4_Questiondup"
+    37 Sym_23 word "v4_Rightbrace"
+    21 Sym_14 external "v4_Store"
+    24 Sym_15 variable Cell "v4_actual_Minusdepth"
+    25 Sym_16 variable Cell[32] "v4_actual_Minusresults"
+    34 Sym_21 external "v4_cells"
+    19 Sym_13 external "v4_cr"
+    15 Sym_6 external "v4_depth"
+    15 Sym_8 external "v4_drop"
+    28 Sym_18 external "v4_dup"
+    14 Sym_5 word "v4_empty_Minusstack"
+    17 Sym_9 word "v4_error"
+    34 Sym_20 external "v4_i"
+    11 Sym_2 variable Cell "v4_test_Minusid"
+    12 Sym_4 word "v4_test_Minusstatus"
+    19 Sym_10 external "v4_type"
+    10 Sym_1 word "v4_verbose"
+    12 Sym_3 variable Cell "v4_vtest_Minusstatus"
+    10 Sym_0 variable Cell "v4_vverbose"
+
+Intermediate code:
+    10 function Sym_1 {
+    10   Reg_0 = Sym_0
+    10   Stack_D = Reg_0
+    10   no-op
+           optimizes label Label_1
+    10 }
+
+    12 function Sym_4 {
+    12   Reg_0 = Sym_3
+    12   Stack_D = Reg_0
+    12   no-op
+           optimizes label Label_2
+    12 }
+
+    14 function Sym_5 {
+    15   call Sym_6
+    15   call Sym_7
+    15   Reg_0 = Stack_D
+    15   if Reg_0 == 0 goto Label_4
+    15   Reg_0 = 0
+    15   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    15   no-op
+           optimizes   Reg_1 = Stack_D
+    15   Reg_0 = Stack_D
+    15   Stack_R = Reg_0
+    15   Stack_R = Reg_1
+    15 label Label_6
+    15   call Sym_8
+    15   Reg_1 = Stack_R
+    15   Reg_1 += 1
+    15   Reg_0 = Stack_R
+    15   Stack_R = Reg_0
+    15   Stack_R = Reg_1
+    15   Reg_1 -= Reg_0
+    15   if Reg_1 != 0 goto Label_6
+    15   no-op
+           optimizes label Label_7
+    15   Reg_0 = Stack_R
+    15   Reg_0 = Stack_R
+    15   no-op
+           optimizes label Label_5
+    15 label Label_4
+    15   no-op
+           optimizes label Label_3
+    15 }
+
+    17 function Sym_9 {
+    19   call Sym_10
+    19   no-op
+           optimizes   Reg_0 = Sym_2
+    19   no-op
+           optimizes   Stack_D = Reg_0
+    19   no-op
+           optimizes   call Sym_11
+    19   Reg_0 = *(Sym_2)
+    19   Stack_D = Reg_0
+    19   call Sym_12
+    19   call Sym_13
+    20   call Sym_5
+    21   Reg_0 = 1
+    21   no-op
+           optimizes   Stack_D = Reg_0
+    21   no-op
+           optimizes   call Sym_4
+    12   no-op
+           optimizes   Reg_0 = Sym_3
+    12   no-op
+           optimizes   Stack_D = Reg_0
+    21   no-op
+           optimizes   call Sym_14
+    21   no-op
+           optimizes   Reg_0 = Stack_D
+    21   *(Sym_3) = Reg_0
+    22   no-op
+           optimizes label Label_8
+    22 }
+
+    27 function Sym_17 {
+    28   no-op
+           optimizes   call Sym_1
+    10   no-op
+           optimizes   Reg_0 = Sym_0
+    10   no-op
+           optimizes   Stack_D = Reg_0
+    28   no-op
+           optimizes   call Sym_11
+    28   Reg_0 = *(Sym_0)
+    28   no-op
+           optimizes   Stack_D = Reg_0
+    28   no-op
+           optimizes   Reg_0 = Stack_D
+    28   if Reg_0 == 0 goto Label_10
+    28   call Sym_18
+    28   call Sym_12
+    28 label Label_10
+    29   no-op
+           optimizes   Reg_0 = Sym_2
+    29   no-op
+           optimizes   Stack_D = Reg_0
+    29   no-op
+           optimizes   call Sym_14
+    29   Reg_0 = Stack_D
+    29   *(Sym_2) = Reg_0
+    29   no-op
+           optimizes label Label_9
+    29 }
+
+    31 function Sym_19 {
+    32   call Sym_6
+    32   call Sym_18
+    32   no-op
+           optimizes   Reg_0 = Sym_15
+    32   no-op
+           optimizes   Stack_D = Reg_0
+    32   no-op
+           optimizes   call Sym_14
+    32   Reg_0 = Stack_D
+    32   *(Sym_15) = Reg_0
+    33   call Sym_7
+    33   Reg_0 = Stack_D
+    33   if Reg_0 == 0 goto Label_12
+    34   Reg_0 = 0
+    34   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    34   no-op
+           optimizes   Reg_1 = Stack_D
+    34   Reg_0 = Stack_D
+    34   Stack_R = Reg_0
+    34   Stack_R = Reg_1
+    34 label Label_14
+    34   Reg_0 = Sym_16
+    34   Stack_D = Reg_0
+    34   call Sym_20
+    34   no-op
+           optimizes   call Sym_21
+    34   Reg_0 = Stack_D
+    34   Reg_0 *= 4
+    34   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    34   no-op
+           optimizes   call Sym_22
+    34   no-op
+           optimizes   Reg_1 = Stack_D
+    34   Reg_0 = Stack_D
+    34   Reg_0 += Reg_1
+    34   Stack_D = Reg_0
+    34   call Sym_14
+    34   Reg_1 = Stack_R
+    34   Reg_1 += 1
+    34   Reg_0 = Stack_R
+    34   Stack_R = Reg_0
+    34   Stack_R = Reg_1
+    34   Reg_1 -= Reg_0
+    34   if Reg_1 != 0 goto Label_14
+    34   no-op
+           optimizes label Label_15
+    34   Reg_0 = Stack_R
+    34   Reg_0 = Stack_R
+    34   no-op
+           optimizes label Label_13
+    35 label Label_12
+    35   no-op
+           optimizes label Label_11
+    35 }
+
+    37 function Sym_23 {
+    39   call Sym_6
+    39   no-op
+           optimizes   Reg_0 = Sym_15
+    39   no-op
+           optimizes   Stack_D = Reg_0
+    39   no-op
+           optimizes   call Sym_11
+    39   Reg_0 = *(Sym_15)
+    39   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    39   no-op
+           optimizes   call Sym_24
+    39   no-op
+           optimizes   Reg_1 = Stack_D
+    39   Reg_0 = Stack_D
+    39   if Reg_0 != Reg_1 goto Label_17
+    39   no-op
+           optimizes   Reg_0 = Stack_D
+    39   no-op
+           optimizes   if Reg_0 == 0 goto Label_17
+    40   call Sym_6
+    40   call Sym_7
+    40   Reg_0 = Stack_D
+    40   if Reg_0 == 0 goto Label_18
+    41   Reg_0 = 0
+    41   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    41   no-op
+           optimizes   Reg_1 = Stack_D
+    41   Reg_0 = Stack_D
+    41   Stack_R = Reg_0
+    41   Stack_R = Reg_1
+    41 label Label_20
+    42   Reg_0 = Sym_16
+    42   Stack_D = Reg_0
+    42   call Sym_20
+    42   no-op
+           optimizes   call Sym_21
+    42   Reg_0 = Stack_D
+    42   Reg_0 *= 4
+    42   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    42   no-op
+           optimizes   call Sym_22
+    42   no-op
+           optimizes   Reg_1 = Stack_D
+    42   Reg_0 = Stack_D
+    42   Reg_0 += Reg_1
+    42   Stack_D = Reg_0
+    42   call Sym_11
+    43   no-op
+           optimizes   call Sym_25
+    43   Reg_1 = Stack_D
+    43   Reg_0 = Stack_D
+    43   if Reg_0 == Reg_1 goto Label_22
+    43   no-op
+           optimizes   Reg_0 = Stack_D
+    43   no-op
+           optimizes   if Reg_0 == 0 goto Label_22
+    43   Reg_0 = Data_0
+    43   Stack_D = Reg_0
+    43   Reg_0 = 18
+    43   Stack_D = Reg_0
+    43   no-op
+           optimizes   call Sym_9
+    19   call Sym_10
+    19   no-op
+           optimizes   Reg_0 = Sym_2
+    19   no-op
+           optimizes   Stack_D = Reg_0
+    19   no-op
+           optimizes   call Sym_11
+    19   Reg_0 = *(Sym_2)
+    19   Stack_D = Reg_0
+    19   call Sym_12
+    19   call Sym_13
+    20   no-op
+           optimizes   call Sym_5
+    15   call Sym_6
+    15   call Sym_7
+    15   Reg_0 = Stack_D
+    15   if Reg_0 == 0 goto Label_25
+    15   Reg_0 = 0
+    15   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    15   Reg_0 = Stack_D
+    15   Stack_R = Reg_0
+    15   Stack_R = Reg_1
+    15 label Label_24
+    15   call Sym_8
+    15   Reg_1 = Stack_R
+    15   Reg_1 += 1
+    15   Reg_0 = Stack_R
+    15   Stack_R = Reg_0
+    15   Stack_R = Reg_1
+    15   Reg_1 -= Reg_0
+    15   if Reg_1 != 0 goto Label_24
+    15   Reg_0 = Stack_R
+    15   Reg_0 = Stack_R
+    15 label Label_25
+    21   Reg_0 = 1
+    21   no-op
+           optimizes   Stack_D = Reg_0
+    21   no-op
+           optimizes   call Sym_4
+    12   no-op
+           optimizes   Reg_0 = Sym_3
+    12   no-op
+           optimizes   Stack_D = Reg_0
+    21   no-op
+           optimizes   call Sym_14
+    21   no-op
+           optimizes   Reg_0 = Stack_D
+    21   *(Sym_3) = Reg_0
+    43   goto Label_21
+    43 label Label_22
+    44   Reg_1 = Stack_R
+    44   Reg_1 += 1
+    44   Reg_0 = Stack_R
+    44   Stack_R = Reg_0
+    44   Stack_R = Reg_1
+    44   Reg_1 -= Reg_0
+    44   if Reg_1 != 0 goto Label_20
+    44 label Label_21
+    44   Reg_0 = Stack_R
+    44   Reg_0 = Stack_R
+    44   no-op
+           optimizes label Label_19
+    45   no-op
+           optimizes label Label_18
+    46   goto Label_23
+    46 label Label_17
+    47   Reg_0 = Data_1
+    47   Stack_D = Reg_0
+    47   Reg_0 = 25
+    47   Stack_D = Reg_0
+    47   no-op
+           optimizes   call Sym_9
+    19   call Sym_10
+    19   no-op
+           optimizes   Reg_0 = Sym_2
+    19   no-op
+           optimizes   Stack_D = Reg_0
+    19   no-op
+           optimizes   call Sym_11
+    19   Reg_0 = *(Sym_2)
+    19   Stack_D = Reg_0
+    19   call Sym_12
+    19   call Sym_13
+    20   call Sym_5
+    21   Reg_0 = 1
+    21   no-op
+           optimizes   Stack_D = Reg_0
+    21   no-op
+           optimizes   call Sym_4
+    12   no-op
+           optimizes   Reg_0 = Sym_3
+    12   no-op
+           optimizes   Stack_D = Reg_0
+    21   no-op
+           optimizes   call Sym_14
+    21   no-op
+           optimizes   Reg_0 = Stack_D
+    21   *(Sym_3) = Reg_0
+    45 label Label_18
+    44   no-op
+           optimizes label Label_19
+    48 label Label_23
+    48   no-op
+           optimizes label Label_16
+    48 }
+
+Peephole rewrites:
+  v4_empty_Minusstack: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_empty_Minusstack: redundant-test: test %edx,%edx => (none)
+  v4_Minus_Greater: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_Minus_Greater: redundant-test: test %edx,%edx => (none)
+  v4_Rightbrace: exchange-pop: xchg %edx,%eax; call v4__dpop; xchg %eax,%edx => call v4__dpop; mov %eax,%edx
+  v4_Rightbrace: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_Rightbrace: redundant-test: test %edx,%edx => (none)
+  v4_Rightbrace: exchange-pop: xchg %edx,%eax; call v4__rpop; xchg %eax,%edx => call v4__rpop; mov %eax,%edx
+  v4_Rightbrace: redundant-test: test %edx,%edx => (none)
+
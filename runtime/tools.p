@@ -0,0 +1,340 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: tools.ft
+Compiled: Sat Oct 17 11:03:09 2026
+Flags: debug weak PIC optimize intermediate assembly
+
+Data:
+    61 Data_3 string[17] "(not implemented)"
+    64 Data_4 synonym Data_3
+    24 Data_0 string[13] "(stack empty)"
+    29 Data_1 string[1] "["
+    29 Data_2 string[1] "]"
+
+Symbols:
+    34 Sym_19 external "v4_Dot"
+    28 Sym_12 external "v4_Dotr"
+    23 Sym_0 word "v4_Dots"
+    27 Sym_9 external "v4_Fetch"
+    39 Sym_25 external "v4_Greater"
+    27 Sym_10 external "v4_Greaterr"
+    43 Sym_28 external "v4_Hash"
+    43 Sym_29 external "v4_Hash_Greater"
+    43 Sym_27 external "v4_Less_Hash"
+    38 Sym_22 external "v4_Plus"
+    33 Sym_18 word "v4_Question"
+    30 Sym_17 external "v4_Store"
+    24 Sym_3 external "v4__type"
+    27 Sym_8 external "v4_base"
+    52 Sym_34 external "v4_bl"
+    43 Sym_26 external "v4_c_Fetch"
+    26 Sym_4 external "v4_cr"
+    28 Sym_11 external "v4_decimal"
+    24 Sym_1 external "v4_depth"
+    53 Sym_37 external "v4_drop"
+    36 Sym_20 word "v4_dump"
+    26 Sym_7 external "v4_dup"
+    54 Sym_38 external "v4_emit"
+    29 Sym_14 external "v4_hex"
+    26 Sym_5 external "v4_i"
+    52 Sym_36 external "v4_invert"
+    38 Sym_21 external "v4_over"
+    26 Sym_6 external "v4_pick"
+    30 Sym_16 external "v4_r_Greater"
+    60 Sym_39 word "v4_see"
+    28 Sym_13 external "v4_space"
+    45 Sym_31 external "v4_spaces"
+    38 Sym_23 external "v4_swap"
+    43 Sym_30 external "v4_type"
+    29 Sym_15 external "v4_u_Dotr"
+    52 Sym_35 external "v4_within"
+    63 Sym_40 word "v4_words"
+    24 Sym_2 external "v4_z0_Equals"
+    46 Sym_32 external "v4_z1_Plus"
+    47 Sym_33 external "v4_z2drop"
+    39 Sym_24 external "v4_z2dup"
+
+Intermediate code:
+    23 function Sym_0 {
+    24   call Sym_1
+    24   no-op
+           optimizes   call Sym_2
+    24   Reg_0 = Stack_D
+    24   if Reg_0 != 0 goto Label_2
+    24   no-op
+           optimizes   Reg_0 = Stack_D
+    24   no-op
+           optimizes   if Reg_0 == 0 goto Label_2
+    24   Reg_0 = Data_0
+    24   Stack_D = Reg_0
+    24   Reg_0 = 13
+    24   Stack_D = Reg_0
+    24   tail call Sym_3
+           optimizes   call Sym_3
+    24   no-op
+           optimizes   goto Label_1
+    24 label Label_2
+    25   call Sym_1
+    25   Reg_0 = 0
+    25   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    25   no-op
+           optimizes   Reg_1 = Stack_D
+    25   Reg_0 = Stack_D
+    25   if Reg_0 == Reg_1 goto Label_3
+    25   Stack_R = Reg_0
+    25   Stack_R = Reg_1
+    25 label Label_4
+    26   call Sym_4
+    26   call Sym_5
+    26   call Sym_6
+    26   call Sym_7
+    27   call Sym_8
+    27   call Sym_9
+    27   call Sym_10
+    28   call Sym_11
+    28   Reg_0 = 11
+    28   Stack_D = Reg_0
+    28   call Sym_12
+    28   call Sym_13
+    29   Reg_0 = Data_1
+    29   Stack_D = Reg_0
+    29   Reg_0 = 1
+    29   Stack_D = Reg_0
+    29   call Sym_3
+    29   call Sym_14
+    29   Reg_0 = 8
+    29   Stack_D = Reg_0
+    29   call Sym_15
+    29   Reg_0 = Data_2
+    29   Stack_D = Reg_0
+    29   Reg_0 = 1
+    29   Stack_D = Reg_0
+    29   call Sym_3
+    30   call Sym_16
+    30   call Sym_8
+    30   call Sym_17
+    31   Reg_1 = Stack_R
+    31   Reg_1 += 1
+    31   Reg_0 = Stack_R
+    31   Stack_R = Reg_0
+    31   Stack_R = Reg_1
+    31   Reg_1 -= Reg_0
+    31   if Reg_1 != 0 goto Label_4
+    31   no-op
+           optimizes label Label_5
+    31   Reg_0 = Stack_R
+    31   Reg_0 = Stack_R
+    31 label Label_3
+    31 label Label_1
+    31 }
+
+    33 function Sym_18 {
+    34   call Sym_9
+    34   tail call Sym_19
+           optimizes   call Sym_19
+    34   no-op
+           optimizes label Label_6
+    34 }
+
+    36 function Sym_20 {
+    37   call Sym_8
+    37   call Sym_9
+    37   call Sym_10
+    37   call Sym_14
+    38   call Sym_21
+    38   no-op
+           optimizes   call Sym_22
+    38   Reg_1 = Stack_D
+    38   Reg_0 = Stack_D
+    38   Reg_0 += Reg_1
+    38   Stack_D = Reg_0
+    38   call Sym_23
+    38 label Label_8
+    39   call Sym_24
+    39   no-op
+           optimizes   call Sym_25
+    39   Reg_1 = Stack_D
+    39   Reg_0 = Stack_D
+    39   if Reg_0 <= Reg_1 goto Label_9
+    39   no-op
+           optimizes   Reg_0 = Stack_D
+    39   no-op
+           optimizes   if Reg_0 == 0 goto Label_9
+    40   call Sym_7
+    40   Reg_0 = 8
+    40   Stack_D = Reg_0
+    40   call Sym_15
+    41   call Sym_24
+    41   Reg_0 = 16
+    41   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    41   Reg_0 = 0
+    41   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    41   no-op
+           optimizes   Reg_1 = Stack_D
+    41   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    41   Stack_R = Reg_0
+    41   Stack_R = Reg_1
+    41 label Label_11
+    42   call Sym_13
+    42   call Sym_24
+    42   no-op
+           optimizes   call Sym_25
+    42   Reg_1 = Stack_D
+    42   Reg_0 = Stack_D
+    42   if Reg_0 <= Reg_1 goto Label_13
+    42   no-op
+           optimizes   Reg_0 = Stack_D
+    42   no-op
+           optimizes   if Reg_0 == 0 goto Label_13
+    43   call Sym_7
+    43   call Sym_26
+    43   call Sym_27
+    43   Reg_0 = 0
+    43   Stack_D = Reg_0
+    43   call Sym_28
+    43   call Sym_28
+    43   call Sym_29
+    43   call Sym_30
+    44   goto Label_14
+    44 label Label_13
+    45   Reg_0 = 2
+    45   Stack_D = Reg_0
+    45   call Sym_31
+    46 label Label_14
+    46   no-op
+           optimizes   call Sym_32
+    46   Reg_0 = Stack_D
+    46   Reg_0 += 1
+    46   Stack_D = Reg_0
+    47   Reg_1 = Stack_R
+    47   Reg_1 += 1
+    47   Reg_0 = Stack_R
+    47   Stack_R = Reg_0
+    47   Stack_R = Reg_1
+    47   Reg_1 -= Reg_0
+    47   if Reg_1 != 0 goto Label_11
+    47   no-op
+           optimizes label Label_12
+    47   Reg_0 = Stack_R
+    47   Reg_0 = Stack_R
+    47   no-op
+           optimizes label Label_10
+    47   call Sym_33
+    48   Reg_0 = 2
+    48   Stack_D = Reg_0
+    48   call Sym_31
+    49   Reg_0 = 16
+    49   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    49   Reg_0 = 0
+    49   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    49   no-op
+           optimizes   Reg_1 = Stack_D
+    49   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    49   Stack_R = Reg_0
+    49   Stack_R = Reg_1
+    49 label Label_16
+    50   call Sym_24
+    50   no-op
+           optimizes   call Sym_25
+    50   Reg_1 = Stack_D
+    50   Reg_0 = Stack_D
+    50   if Reg_0 <= Reg_1 goto Label_18
+    50   no-op
+           optimizes   Reg_0 = Stack_D
+    50   no-op
+           optimizes   if Reg_0 == 0 goto Label_18
+    51   call Sym_7
+    51   call Sym_26
+    52   call Sym_7
+    52   call Sym_34
+    52   Reg_0 = 127
+           optimizes   Reg_0 = 126
+    52   Stack_D = Reg_0
+    52   no-op
+           optimizes   call Sym_32
+    52   call Sym_35
+    52   no-op
+           optimizes   call Sym_36
+    52   Reg_0 = Stack_D
+    52   Reg_0 = ~Reg_0
+    52   no-op
+           optimizes   Stack_D = Reg_0
+    52   no-op
+           optimizes   Reg_0 = Stack_D
+    52   if Reg_0 == 0 goto Label_19
+    53   call Sym_37
+    53   Reg_0 = 46
+    53   Stack_D = Reg_0
+    54 label Label_19
+    54   call Sym_38
+    55 label Label_18
+    55   no-op
+           optimizes   call Sym_32
+    55   Reg_0 = Stack_D
+    55   Reg_0 += 1
+    55   Stack_D = Reg_0
+    56   Reg_1 = Stack_R
+    56   Reg_1 += 1
+    56   Reg_0 = Stack_R
+    56   Stack_R = Reg_0
+    56   Stack_R = Reg_1
+    56   Reg_1 -= Reg_0
+    56   if Reg_1 != 0 goto Label_16
+    56   no-op
+           optimizes label Label_17
+    56   Reg_0 = Stack_R
+    56   Reg_0 = Stack_R
+    56   no-op
+           optimizes label Label_15
+    56   call Sym_4
+    57   goto Label_8
+    57 label Label_9
+    57   call Sym_33
+    58   call Sym_16
+    58   call Sym_8
+    58   tail call Sym_17
+           optimizes   call Sym_17
+    58   no-op
+           optimizes label Label_7
+    58 }
+
+    60 function Sym_39 {
+    61   Reg_0 = Data_3
+    61   Stack_D = Reg_0
+    61   Reg_0 = 17
+    61   Stack_D = Reg_0
+    61   tail call Sym_3
+           optimizes   call Sym_3
+    61   no-op
+           optimizes label Label_20
+    61 }
+
+    63 function Sym_40 {
+    64   Reg_0 = Data_4
+    64   Stack_D = Reg_0
+    64   Reg_0 = 17
+    64   Stack_D = Reg_0
+    64   tail call Sym_3
+           optimizes   call Sym_3
+    64   no-op
+           optimizes label Label_21
+    64 }
+
+Peephole rewrites:
+  v4_Dots: exchange-pop: xchg %edx,%eax; call v4__rpop@PLT; xchg %eax,%edx => call v4__rpop@PLT; mov %eax,%edx
+  v4_Dots: redundant-test: test %edx,%edx => (none)
+  v4_dump: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_dump: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_dump: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_dump: exchange-pop: xchg %edx,%eax; call v4__rpop@PLT; xchg %eax,%edx => call v4__rpop@PLT; mov %eax,%edx
+  v4_dump: redundant-test: test %edx,%edx => (none)
+  v4_dump: exchange-pop: xchg %edx,%eax; call v4__dpop@PLT; xchg %eax,%edx => call v4__dpop@PLT; mov %eax,%edx
+  v4_dump: exchange-pop: xchg %edx,%eax; call v4__rpop@PLT; xchg %eax,%edx => call v4__rpop@PLT; mov %eax,%edx
+  v4_dump: redundant-test: test %edx,%edx => (none)
+
@@ -0,0 +1,33 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: _dlmain.pp
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+    28 Sym_0 codeword "v4__dl_main"
+
+Intermediate code:
+    28 function Sym_0 {
+    29   asm (    lea .L_message(%rip),%rsi)
+    30   asm (    lea .L_message_end(%rip),%rdx)
+    31   asm (    sub %rsi,%rdx)
+    33   asm (    mov $1,%rdi)
+    34   asm (    mov $1,%rax)
+    35   asm (    syscall)
+    37   asm (    xor %edi,%edi)
+    38   asm (    mov $60,%rax)
+    39   asm (    syscall)
+    41   asm (    .section .rodata)
+    42   asm (    .L_message:)
+    43   asm (    .ascii "\nforthlib version 1.5 [build x86_64/1792234992]\n")
+    44   asm (    .ascii "Copyright (C) 2005-2013  Simon Baldwin\n\n")
+    45   asm (    .ascii "This program comes with ABSOLUTELY NO WARRANTY; for details\n")
+    46   asm (    .ascii "please see the file 'COPYING' supplied with the source code.\n")
+    47   asm (    .ascii "This is free software, and you are welcome to redistribute it\n")
+    48   asm (    .ascii "under certain conditions; again, see 'COPYING' for details.\n")
+    49   asm (    .ascii "This program is released under the GNU General Public License.\n")
+    50   asm (    .L_message_end:)
+    51   asm (    .text)
+    53   asm (    forth_pic.=0b-0b)
+    54 }
+
@@ -0,0 +1,70 @@
+	.file	"_dlmain.pp"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"_dlmain.pp",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4__dl_main:F1",36,0,0,v4__dl_main
+	.weak v4__dl_main
+	.type	v4__dl_main,@function
+v4__dl_main:
+.stabn 68,0,28,.LMa0-v4__dl_main
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,28,.LMb0-v4__dl_main
+.LMb0:
+.LBB0:
+#APP
+    lea .L_message(%rip),%rsi
+    lea .L_message_end(%rip),%rdx
+    sub %rsi,%rdx
+    mov $1,%rdi
+    mov $1,%rax
+    syscall
+    xor %edi,%edi
+    mov $60,%rax
+    syscall
+    .section .rodata
+    .L_message:
+    .ascii "\nforthlib version 1.5 [build x86_64/1792234992]\n"
+    .ascii "Copyright (C) 2005-2013  Simon Baldwin\n\n"
+    .ascii "This program comes with ABSOLUTELY NO WARRANTY; for details\n"
+    .ascii "please see the file 'COPYING' supplied with the source code.\n"
+    .ascii "This is free software, and you are welcome to redistribute it\n"
+    .ascii "under certain conditions; again, see 'COPYING' for details.\n"
+    .ascii "This program is released under the GNU General Public License.\n"
+    .L_message_end:
+    .text
+    forth_pic.=0b-0b
+#NO_APP
+.LBE0:
+.stabn 68,0,54,.LM22-v4__dl_main
+.LM22:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe0:
+	.size	 v4__dl_main,.Lfe0-v4__dl_main
+.stabn	192,0,0,.LBB0-v4__dl_main
+.stabn	224,0,0,.LBE0-v4__dl_main
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4__dl_main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
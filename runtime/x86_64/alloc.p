@@ -0,0 +1,1048 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: alloc.ft
+Compiled: Sat Oct 17 10:15:10 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Data:
+    98 Data_4 string[4] " end"
+    91 Data_3 string[7] " free: "
+    90 Data_2 string[7] " used: "
+    81 Data_1 string[1] ":"
+    80 Data_0 string[7] "Arena: "
+
+Symbols:
+    80 Sym_27 external "v4_Dot"
+   144 Sym_50 external "v4_Equals"
+    61 Sym_11 external "v4_Fetch"
+    58 Sym_8 external "v4_Greater"
+    78 Sym_24 external "v4_Greaterr"
+   124 Sym_46 external "v4_Less"
+    71 Sym_19 external "v4_Minus"
+    93 Sym_36 external "v4_Plus"
+    57 Sym_5 external "v4_Store"
+    77 Sym_22 word "v4___Dotarena"
+    53 Sym_1 variable Cell "v4___Parenbcache_Closeparen"
+    55 Sym_2 word "v4__allocb"
+   102 Sym_40 word "v4__allocdefrag"
+    67 Sym_14 word "v4__allocsize"
+   115 Sym_43 word "v4__allocslot"
+    60 Sym_10 word "v4__arena"
+    52 Sym_0 variable Cell "v4__arenap"
+   131 Sym_48 external "v4__einval"
+    56 Sym_4 external "v4__syscall"
+    80 Sym_26 external "v4__type"
+    88 Sym_33 external "v4_abs"
+    68 Sym_15 external "v4_aligned"
+   130 Sym_47 word "v4_allocate"
+    78 Sym_23 external "v4_base"
+    94 Sym_38 external "v4_c_Fetch"
+    63 Sym_13 external "v4_cell_Plus"
+    71 Sym_18 external "v4_cells"
+    81 Sym_28 external "v4_cr"
+    87 Sym_32 external "v4_decimal"
+    73 Sym_21 external "v4_drop"
+    56 Sym_3 external "v4_dup"
+   155 Sym_51 word "v4_free"
+    78 Sym_25 external "v4_hex"
+    94 Sym_37 external "v4_i"
+   107 Sym_41 external "v4_invert"
+   184 Sym_55 external "v4_move"
+   121 Sym_44 external "v4_negate"
+   141 Sym_49 external "v4_nip"
+    58 Sym_7 external "v4_over"
+   122 Sym_45 external "v4_pick"
+   174 Sym_53 external "v4_r_Fetch"
+   100 Sym_39 external "v4_r_Greater"
+   187 Sym_56 external "v4_rdrop"
+   163 Sym_52 word "v4_resize"
+    86 Sym_31 external "v4_space"
+    58 Sym_6 external "v4_swap"
+    58 Sym_9 external "v4_throw"
+    86 Sym_30 external "v4_u_Dotr"
+    69 Sym_17 external "v4_within"
+    61 Sym_12 external "v4_z0_Equals"
+    90 Sym_34 external "v4_z0_Greater"
+    72 Sym_20 external "v4_z0_Less"
+    85 Sym_29 external "v4_z0_Less_Greater"
+    69 Sym_16 external "v4_z1_Plus"
+   108 Sym_42 external "v4_z2drop"
+    93 Sym_35 external "v4_z2dup"
+   176 Sym_54 external "v4_z2rdrop"
+
+Intermediate code:
+    55 function Sym_2 {
+    56   call Sym_3
+    56   Reg_0 = 45
+    56   Stack_D = Reg_0
+    56   Reg_0 = 1
+    56   Stack_D = Reg_0
+    56   call Sym_4
+    57   call Sym_3
+    57   no-op
+           optimizes   Reg_0 = Sym_1
+    57   no-op
+           optimizes   Stack_D = Reg_0
+    57   no-op
+           optimizes   call Sym_5
+    57   Reg_0 = Stack_D
+    57   *(Sym_1) = Reg_0
+    58   call Sym_6
+    58   call Sym_7
+    58   no-op
+           optimizes   call Sym_8
+    58   Reg_1 = Stack_D
+    58   Reg_0 = Stack_D
+    58   if Reg_0 <= Reg_1 goto Label_2
+    58   no-op
+           optimizes   Reg_0 = Stack_D
+    58   no-op
+           optimizes   if Reg_0 == 0 goto Label_2
+    58   Reg_0 = -2048
+    58   Stack_D = Reg_0
+    58   tail call Sym_9
+           optimizes   call Sym_9
+    58 label Label_2
+    58   no-op
+           optimizes label Label_1
+    58 }
+
+    60 function Sym_10 {
+    61   no-op
+           optimizes   Reg_0 = Sym_0
+    61   no-op
+           optimizes   Stack_D = Reg_0
+    61   no-op
+           optimizes   call Sym_11
+    61   Reg_0 = *(Sym_0)
+    61   no-op
+           optimizes   Stack_D = Reg_0
+    61   no-op
+           optimizes   call Sym_12
+    61   no-op
+           optimizes   Reg_0 = Stack_D
+    61   if Reg_0 != 0 goto Label_4
+    61   no-op
+           optimizes   Reg_0 = Stack_D
+    61   no-op
+           optimizes   if Reg_0 == 0 goto Label_4
+    62   Reg_0 = 0
+    62   Stack_D = Reg_0
+    62   call Sym_2
+    62   no-op
+           optimizes   Reg_0 = Sym_0
+    62   no-op
+           optimizes   Stack_D = Reg_0
+    62   no-op
+           optimizes   call Sym_5
+    62   Reg_0 = Stack_D
+    62   *(Sym_0) = Reg_0
+    63   Reg_0 = 0
+    63   Stack_D = Reg_0
+    63   no-op
+           optimizes   Reg_0 = Sym_0
+    63   no-op
+           optimizes   Stack_D = Reg_0
+    63   no-op
+           optimizes   call Sym_11
+    63   Reg_0 = *(Sym_0)
+    63   no-op
+           optimizes   Stack_D = Reg_0
+    63   no-op
+           optimizes   call Sym_13
+    63   no-op
+           optimizes   Reg_0 = Stack_D
+    63   Reg_0 += 8
+    63   Stack_D = Reg_0
+    63   call Sym_2
+    63   call Sym_5
+    64 label Label_4
+    65   no-op
+           optimizes   Reg_0 = Sym_0
+    65   no-op
+           optimizes   Stack_D = Reg_0
+    65   no-op
+           optimizes   call Sym_11
+    65   Reg_0 = *(Sym_0)
+    65   Stack_D = Reg_0
+    65   no-op
+           optimizes label Label_3
+    65 }
+
+    67 function Sym_14 {
+    68   call Sym_15
+    68   call Sym_3
+    69   call Sym_10
+    69   no-op
+           optimizes   call Sym_13
+    69   Reg_0 = Stack_D
+    69   Reg_0 += 8
+    69   Stack_D = Reg_0
+    69   no-op
+           optimizes   Reg_0 = Sym_1
+    69   no-op
+           optimizes   Stack_D = Reg_0
+    69   no-op
+           optimizes   call Sym_11
+    69   Reg_0 = *(Sym_1)
+    69   no-op
+           optimizes   Stack_D = Reg_0
+    69   no-op
+           optimizes   call Sym_16
+    69   no-op
+           optimizes   Reg_0 = Stack_D
+    69   Reg_0 += 1
+    69   Stack_D = Reg_0
+    69   call Sym_17
+    70   Reg_0 = Stack_D
+    70   if Reg_0 == 0 goto Label_6
+    71   Reg_0 = 8
+           optimizes   Reg_0 = 1
+    71   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    71   no-op
+           optimizes   call Sym_18
+    71   no-op
+           optimizes   call Sym_19
+    71   no-op
+           optimizes   Reg_1 = Stack_D
+    71   Reg_0 = Stack_D
+    71   Reg_0 -= Reg_1
+    71   Stack_D = Reg_0
+    71   call Sym_11
+    72   call Sym_3
+    72   no-op
+           optimizes   call Sym_20
+    72   Reg_0 = Stack_D
+    72   if Reg_0 >= 0 goto Label_7
+    72   no-op
+           optimizes   Reg_0 = Stack_D
+    72   no-op
+           optimizes   if Reg_0 == 0 goto Label_7
+    73   call Sym_21
+    73   Reg_0 = 0
+    73   Stack_D = Reg_0
+    74   no-op
+           optimizes label Label_7
+    75   goto Label_8
+    75 label Label_6
+    75   call Sym_21
+    75   Reg_0 = 0
+    75   Stack_D = Reg_0
+    74 label Label_7
+    75 label Label_8
+    75   no-op
+           optimizes label Label_5
+    75 }
+
+    77 function Sym_22 {
+    78   call Sym_23
+    78   call Sym_11
+    78   call Sym_24
+    78   call Sym_25
+    80   Reg_0 = Data_0
+    80   Stack_D = Reg_0
+    80   Reg_0 = 7
+    80   Stack_D = Reg_0
+    80   call Sym_26
+    80   call Sym_10
+    80   call Sym_27
+    80   no-op
+           optimizes   Reg_0 = Sym_1
+    80   no-op
+           optimizes   Stack_D = Reg_0
+    80   no-op
+           optimizes   call Sym_11
+    80   Reg_0 = *(Sym_1)
+    80   Stack_D = Reg_0
+    80   call Sym_27
+    81   Reg_0 = Data_1
+    81   Stack_D = Reg_0
+    81   Reg_0 = 1
+    81   Stack_D = Reg_0
+    81   call Sym_26
+    81   call Sym_28
+    83   call Sym_10
+    83 label Label_10
+    84   call Sym_3
+    84   call Sym_11
+    85   call Sym_3
+    85   no-op
+           optimizes   call Sym_29
+    85   Reg_0 = Stack_D
+    85   if Reg_0 == 0 goto Label_11
+    85   no-op
+           optimizes   Reg_0 = Stack_D
+    85   no-op
+           optimizes   if Reg_0 == 0 goto Label_11
+    86   call Sym_7
+    86   Reg_0 = 8
+    86   Stack_D = Reg_0
+    86   call Sym_30
+    86   call Sym_31
+    87   call Sym_23
+    87   call Sym_11
+    87   call Sym_32
+    88   call Sym_7
+    88   call Sym_33
+    88   Reg_0 = 4
+    88   Stack_D = Reg_0
+    88   call Sym_30
+    89   call Sym_23
+    89   call Sym_5
+    90   call Sym_3
+    90   no-op
+           optimizes   call Sym_34
+    90   Reg_0 = Stack_D
+    90   if Reg_0 <= 0 goto Label_12
+    90   no-op
+           optimizes   Reg_0 = Stack_D
+    90   no-op
+           optimizes   if Reg_0 == 0 goto Label_12
+    90   Reg_0 = Data_2
+    90   Stack_D = Reg_0
+    90   Reg_0 = 7
+    90   Stack_D = Reg_0
+    90   call Sym_26
+    91   goto Label_13
+    91 label Label_12
+    91   Reg_0 = Data_3
+    91   Stack_D = Reg_0
+    91   Reg_0 = 7
+    91   Stack_D = Reg_0
+    91   call Sym_26
+    91 label Label_13
+    92   call Sym_33
+    93   call Sym_35
+    93   call Sym_7
+    93   no-op
+           optimizes   call Sym_36
+    93   Reg_1 = Stack_D
+    93   Reg_0 = Stack_D
+    93   Reg_0 += Reg_1
+    93   Stack_D = Reg_0
+    93   call Sym_6
+    93   Reg_1 = Stack_D
+    93   Reg_0 = Stack_D
+    93   Stack_R = Reg_0
+    93   Stack_R = Reg_1
+    93 label Label_15
+    94   call Sym_37
+    94   no-op
+           optimizes   call Sym_13
+    94   Reg_0 = Stack_D
+    94   Reg_0 += 8
+    94   Stack_D = Reg_0
+    94   call Sym_38
+    94   call Sym_27
+    95   Reg_1 = Stack_R
+    95   Reg_1 += 1
+    95   Reg_0 = Stack_R
+    95   Stack_R = Reg_0
+    95   Stack_R = Reg_1
+    95   Reg_1 -= Reg_0
+    95   if Reg_1 != 0 goto Label_15
+    95   no-op
+           optimizes label Label_16
+    95   Reg_0 = Stack_R
+    95   Reg_0 = Stack_R
+    95   no-op
+           optimizes label Label_14
+    95   call Sym_28
+    96   no-op
+           optimizes   call Sym_13
+    96   Reg_0 = Stack_D
+    96   Reg_0 += 8
+    96   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    96   no-op
+           optimizes   call Sym_36
+    96   no-op
+           optimizes   Reg_1 = Stack_D
+    96   Reg_0 = Stack_D
+    96   Reg_0 += Reg_1
+    96   Stack_D = Reg_0
+    97   goto Label_10
+    97 label Label_11
+    98   call Sym_21
+    98   Reg_0 = 8
+    98   Stack_D = Reg_0
+    98   call Sym_30
+    98   call Sym_31
+    98   Reg_0 = Data_4
+    98   Stack_D = Reg_0
+    98   Reg_0 = 4
+    98   Stack_D = Reg_0
+    98   call Sym_26
+    98   call Sym_28
+   100   call Sym_39
+   100   call Sym_23
+   100   tail call Sym_5
+           optimizes   call Sym_5
+   100   no-op
+           optimizes label Label_9
+   100 }
+
+   102 function Sym_40 {
+   103 label Label_18
+   104   call Sym_3
+   104   call Sym_11
+   104   no-op
+           optimizes   call Sym_20
+   104   Reg_0 = Stack_D
+   104   if Reg_0 >= 0 goto Label_19
+   104   no-op
+           optimizes   Reg_0 = Stack_D
+   104   no-op
+           optimizes   if Reg_0 == 0 goto Label_19
+   106   call Sym_3
+   106   call Sym_11
+   106   call Sym_33
+   106   no-op
+           optimizes   call Sym_13
+   106   Reg_0 = Stack_D
+   106   Reg_0 += 8
+   106   Stack_D = Reg_0
+   106   call Sym_7
+   106   no-op
+           optimizes   call Sym_36
+   106   Reg_1 = Stack_D
+   106   Reg_0 = Stack_D
+   106   Reg_0 += Reg_1
+   106   Stack_D = Reg_0
+   107   call Sym_3
+   107   call Sym_11
+   107   no-op
+           optimizes   call Sym_20
+   107   Reg_0 = Stack_D
+   107   Reg_0 = Reg_0 < 0
+   107   no-op
+           optimizes   Stack_D = Reg_0
+   107   no-op
+           optimizes   call Sym_41
+   107   no-op
+           optimizes   Reg_0 = Stack_D
+   107   Reg_0 = ~Reg_0
+   107   no-op
+           optimizes   Stack_D = Reg_0
+   108   no-op
+           optimizes   Reg_0 = Stack_D
+   108   if Reg_0 == 0 goto Label_20
+   108   tail call Sym_42
+           optimizes   call Sym_42
+   108   no-op
+           optimizes   goto Label_17
+   108 label Label_20
+   110   call Sym_11
+   110   call Sym_7
+   110   call Sym_11
+   111   Reg_0 = 8
+           optimizes   Reg_0 = 1
+   111   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   111   no-op
+           optimizes   call Sym_18
+   111   no-op
+           optimizes   call Sym_19
+   111   no-op
+           optimizes   Reg_1 = Stack_D
+   111   Reg_0 = Stack_D
+   111   Reg_0 -= Reg_1
+   111   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   112   no-op
+           optimizes   call Sym_36
+   112   no-op
+           optimizes   Reg_1 = Stack_D
+   112   Reg_0 = Stack_D
+   112   Reg_0 += Reg_1
+   112   Stack_D = Reg_0
+   112   call Sym_7
+   112   call Sym_5
+   113   goto Label_18
+   113 label Label_19
+   113   tail call Sym_21
+           optimizes   call Sym_21
+   113   no-op
+           optimizes label Label_17
+   113 }
+
+   115 function Sym_43 {
+   116 label Label_22
+   117   call Sym_3
+   117   call Sym_40
+   118   call Sym_3
+   118   call Sym_11
+   119   call Sym_3
+   119   no-op
+           optimizes   call Sym_12
+   119   Reg_0 = Stack_D
+   119   if Reg_0 != 0 goto Label_24
+   119   no-op
+           optimizes   Reg_0 = Stack_D
+   119   no-op
+           optimizes   if Reg_0 == 0 goto Label_24
+   119   tail call Sym_21
+           optimizes   call Sym_21
+   119   no-op
+           optimizes   goto Label_21
+   119 label Label_24
+   120   call Sym_3
+   120   no-op
+           optimizes   call Sym_20
+   120   Reg_0 = Stack_D
+   120   if Reg_0 >= 0 goto Label_25
+   120   no-op
+           optimizes   Reg_0 = Stack_D
+   120   no-op
+           optimizes   if Reg_0 == 0 goto Label_25
+   121   no-op
+           optimizes   call Sym_44
+   121   Reg_0 = Stack_D
+   121   Reg_0 = -Reg_0
+   121   Stack_D = Reg_0
+   122   call Sym_3
+   122   Reg_0 = 3
+   122   Stack_D = Reg_0
+   122   call Sym_45
+   122   no-op
+           optimizes   call Sym_19
+   122   Reg_1 = Stack_D
+   122   Reg_0 = Stack_D
+   122   Reg_0 -= Reg_1
+   122   Stack_D = Reg_0
+   123   call Sym_3
+   123   no-op
+           optimizes   call Sym_12
+   123   Reg_0 = Stack_D
+   123   if Reg_0 != 0 goto Label_26
+   123   no-op
+           optimizes   Reg_0 = Stack_D
+   123   no-op
+           optimizes   if Reg_0 == 0 goto Label_26
+   123   tail call Sym_42
+           optimizes   call Sym_42
+   123   no-op
+           optimizes   goto Label_21
+   123 label Label_26
+   124   Reg_0 = 16
+           optimizes   Reg_0 = 2
+   124   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   124   no-op
+           optimizes   call Sym_18
+   124   no-op
+           optimizes   call Sym_46
+   124   no-op
+           optimizes   Reg_1 = Stack_D
+   124   Reg_0 = Stack_D
+   124   Reg_0 = Reg_0 < Reg_1
+   124   no-op
+           optimizes   Stack_D = Reg_0
+   124   no-op
+           optimizes   call Sym_41
+   124   no-op
+           optimizes   Reg_0 = Stack_D
+   124   Reg_0 = ~Reg_0
+   124   no-op
+           optimizes   Stack_D = Reg_0
+   124   no-op
+           optimizes   Reg_0 = Stack_D
+   124   if Reg_0 == 0 goto Label_27
+   124   tail call Sym_21
+           optimizes   call Sym_21
+   124   no-op
+           optimizes   goto Label_21
+   124 label Label_27
+   126 label Label_25
+   127   no-op
+           optimizes   call Sym_13
+   127   Reg_0 = Stack_D
+   127   Reg_0 += 8
+   127   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   127   no-op
+           optimizes   call Sym_36
+   127   no-op
+           optimizes   Reg_1 = Stack_D
+   127   Reg_0 = Stack_D
+   127   Reg_0 += Reg_1
+   127   Stack_D = Reg_0
+   128   goto Label_22
+   128   no-op
+           optimizes label Label_23
+   128   no-op
+           optimizes label Label_21
+   128 }
+
+   130 function Sym_47 {
+   131   call Sym_3
+   131   no-op
+           optimizes   call Sym_20
+   131   Reg_0 = Stack_D
+   131   if Reg_0 >= 0 goto Label_29
+   131   no-op
+           optimizes   Reg_0 = Stack_D
+   131   no-op
+           optimizes   if Reg_0 == 0 goto Label_29
+   131   call Sym_21
+   131   Reg_0 = 0
+   131   Stack_D = Reg_0
+   131   tail call Sym_48
+           optimizes   call Sym_48
+   131   no-op
+           optimizes   goto Label_28
+   131 label Label_29
+   132   call Sym_3
+   132   no-op
+           optimizes   call Sym_12
+   132   Reg_0 = Stack_D
+   132   if Reg_0 != 0 goto Label_30
+   132   no-op
+           optimizes   Reg_0 = Stack_D
+   132   no-op
+           optimizes   if Reg_0 == 0 goto Label_30
+   132   no-op
+           optimizes   call Sym_13
+   132   Reg_0 = Stack_D
+   132   Reg_0 += 8
+   132   Stack_D = Reg_0
+   132 label Label_30
+   134   call Sym_15
+   135   call Sym_10
+   135   call Sym_43
+   137   call Sym_3
+   137   call Sym_11
+   137   no-op
+           optimizes   call Sym_12
+   137   Reg_0 = Stack_D
+   137   if Reg_0 != 0 goto Label_31
+   137   no-op
+           optimizes   Reg_0 = Stack_D
+   137   no-op
+           optimizes   if Reg_0 == 0 goto Label_31
+   138   call Sym_35
+   138   call Sym_5
+   139   call Sym_35
+   139   no-op
+           optimizes   call Sym_36
+   139   Reg_1 = Stack_D
+   139   Reg_0 = Stack_D
+   139   Reg_0 += Reg_1
+   139   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   139   Reg_0 = 16
+           optimizes   Reg_0 = 2
+   139   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   139   no-op
+           optimizes   call Sym_18
+   139   no-op
+           optimizes   call Sym_36
+   139   no-op
+           optimizes   Reg_1 = Stack_D
+   139   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   139   Reg_0 += Reg_1
+   139   Stack_D = Reg_0
+   139   call Sym_2
+   140   Reg_0 = 8
+           optimizes   Reg_0 = 1
+   140   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   140   no-op
+           optimizes   call Sym_18
+   140   no-op
+           optimizes   call Sym_19
+   140   no-op
+           optimizes   Reg_1 = Stack_D
+   140   Reg_0 = Stack_D
+   140   Reg_0 -= Reg_1
+   140   Stack_D = Reg_0
+   140   Reg_0 = 0
+   140   Stack_D = Reg_0
+   140   call Sym_6
+   140   call Sym_5
+   141   call Sym_49
+   141   no-op
+           optimizes   call Sym_13
+   141   Reg_0 = Stack_D
+   141   Reg_0 += 8
+   141   Stack_D = Reg_0
+   141   Reg_0 = 0
+   141   Stack_D = Reg_0
+   141   goto Label_28
+   142 label Label_31
+   144   call Sym_35
+   144   call Sym_11
+   144   call Sym_6
+   144   no-op
+           optimizes   call Sym_44
+   144   Reg_0 = Stack_D
+   144   Reg_0 = -Reg_0
+   144   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   144   no-op
+           optimizes   call Sym_50
+   144   no-op
+           optimizes   Reg_1 = Stack_D
+   144   Reg_0 = Stack_D
+   144   if Reg_0 != Reg_1 goto Label_32
+   144   no-op
+           optimizes   Reg_0 = Stack_D
+   144   no-op
+           optimizes   if Reg_0 == 0 goto Label_32
+   145   call Sym_35
+   145   call Sym_5
+   146   call Sym_49
+   146   no-op
+           optimizes   call Sym_13
+   146   Reg_0 = Stack_D
+   146   Reg_0 += 8
+   146   Stack_D = Reg_0
+   146   Reg_0 = 0
+   146   Stack_D = Reg_0
+   146   goto Label_28
+   147 label Label_32
+   149   call Sym_3
+   149   call Sym_24
+   149   call Sym_3
+   149   call Sym_11
+   149   call Sym_24
+   150   call Sym_35
+   150   call Sym_5
+   151   call Sym_3
+   151   call Sym_11
+   151   no-op
+           optimizes   call Sym_36
+   151   Reg_1 = Stack_D
+   151   Reg_0 = Stack_D
+   151   Reg_0 += Reg_1
+   151   no-op
+           optimizes   Stack_D = Reg_0
+   151   no-op
+           optimizes   call Sym_13
+   151   no-op
+           optimizes   Reg_0 = Stack_D
+   151   Reg_0 += 8
+   151   Stack_D = Reg_0
+   152   call Sym_6
+   152   call Sym_39
+   152   no-op
+           optimizes   call Sym_13
+   152   Reg_0 = Stack_D
+   152   Reg_0 += 8
+   152   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   152   no-op
+           optimizes   call Sym_36
+   152   no-op
+           optimizes   Reg_1 = Stack_D
+   152   Reg_0 = Stack_D
+   152   Reg_0 += Reg_1
+   152   Stack_D = Reg_0
+   152   call Sym_6
+   152   call Sym_5
+   153   call Sym_39
+   153   no-op
+           optimizes   call Sym_13
+   153   Reg_0 = Stack_D
+   153   Reg_0 += 8
+   153   Stack_D = Reg_0
+   153   Reg_0 = 0
+   153   Stack_D = Reg_0
+   153 label Label_28
+   153 }
+
+   155 function Sym_51 {
+   156   call Sym_3
+   156   call Sym_14
+   156   no-op
+           optimizes   call Sym_12
+   156   Reg_0 = Stack_D
+   156   if Reg_0 != 0 goto Label_34
+   156   no-op
+           optimizes   Reg_0 = Stack_D
+   156   no-op
+           optimizes   if Reg_0 == 0 goto Label_34
+   157   call Sym_21
+   157   tail call Sym_48
+           optimizes   call Sym_48
+   157   no-op
+           optimizes   goto Label_33
+   157 label Label_34
+   159   call Sym_15
+   160   Reg_0 = 8
+           optimizes   Reg_0 = 1
+   160   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   160   no-op
+           optimizes   call Sym_18
+   160   no-op
+           optimizes   call Sym_19
+   160   no-op
+           optimizes   Reg_1 = Stack_D
+   160   Reg_0 = Stack_D
+   160   Reg_0 -= Reg_1
+   160   Stack_D = Reg_0
+   161   call Sym_3
+   161   call Sym_11
+   161   no-op
+           optimizes   call Sym_44
+   161   Reg_0 = Stack_D
+   161   Reg_0 = -Reg_0
+   161   Stack_D = Reg_0
+   161   call Sym_6
+   161   call Sym_5
+   161   Reg_0 = 0
+   161   Stack_D = Reg_0
+   161 label Label_33
+   161 }
+
+   163 function Sym_52 {
+   164   call Sym_3
+   164   no-op
+           optimizes   call Sym_20
+   164   Reg_0 = Stack_D
+   164   if Reg_0 >= 0 goto Label_36
+   164   no-op
+           optimizes   Reg_0 = Stack_D
+   164   no-op
+           optimizes   if Reg_0 == 0 goto Label_36
+   164   call Sym_42
+   164   Reg_0 = 0
+   164   Stack_D = Reg_0
+   164   tail call Sym_48
+           optimizes   call Sym_48
+   164   no-op
+           optimizes   goto Label_35
+   164 label Label_36
+   165   call Sym_3
+   165   no-op
+           optimizes   call Sym_12
+   165   Reg_0 = Stack_D
+   165   if Reg_0 != 0 goto Label_37
+   165   no-op
+           optimizes   Reg_0 = Stack_D
+   165   no-op
+           optimizes   if Reg_0 == 0 goto Label_37
+   165   no-op
+           optimizes   call Sym_13
+   165   Reg_0 = Stack_D
+   165   Reg_0 += 8
+   165   Stack_D = Reg_0
+   165 label Label_37
+   167   call Sym_7
+   167   call Sym_14
+   167   no-op
+           optimizes   call Sym_12
+   167   Reg_0 = Stack_D
+   167   if Reg_0 != 0 goto Label_38
+   167   no-op
+           optimizes   Reg_0 = Stack_D
+   167   no-op
+           optimizes   if Reg_0 == 0 goto Label_38
+   168   call Sym_42
+   168   Reg_0 = 0
+   168   Stack_D = Reg_0
+   168   tail call Sym_48
+           optimizes   call Sym_48
+   168   no-op
+           optimizes   goto Label_35
+   168 label Label_38
+   170   call Sym_15
+   170   call Sym_6
+   170   call Sym_15
+   170   call Sym_6
+   171   call Sym_7
+   171   call Sym_24
+   172   call Sym_7
+   172   Reg_0 = 8
+           optimizes   Reg_0 = 1
+   172   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   172   no-op
+           optimizes   call Sym_18
+   172   no-op
+           optimizes   call Sym_19
+   172   no-op
+           optimizes   Reg_1 = Stack_D
+   172   Reg_0 = Stack_D
+   172   Reg_0 -= Reg_1
+   172   Stack_D = Reg_0
+   172   call Sym_11
+   172   call Sym_24
+   174   call Sym_3
+   174   call Sym_53
+   174   no-op
+           optimizes   call Sym_8
+   174   Reg_1 = Stack_D
+   174   Reg_0 = Stack_D
+   174   if Reg_0 <= Reg_1 goto Label_39
+   174   no-op
+           optimizes   Reg_0 = Stack_D
+   174   no-op
+           optimizes   if Reg_0 == 0 goto Label_39
+   175   call Sym_47
+   175   call Sym_3
+   175   no-op
+           optimizes   call Sym_29
+   175   Reg_0 = Stack_D
+   175   if Reg_0 == 0 goto Label_40
+   175   no-op
+           optimizes   Reg_0 = Stack_D
+   175   no-op
+           optimizes   if Reg_0 == 0 goto Label_40
+   176   call Sym_54
+   176   call Sym_24
+   176   call Sym_21
+   176   Reg_0 = 0
+   176   Stack_D = Reg_0
+   176   tail call Sym_39
+           optimizes   call Sym_39
+   177   no-op
+           optimizes   goto Label_35
+   178 label Label_40
+   178   call Sym_21
+   180   call Sym_7
+   180   Reg_0 = 8
+           optimizes   Reg_0 = 1
+   180   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   180   no-op
+           optimizes   call Sym_18
+   180   no-op
+           optimizes   call Sym_19
+   180   no-op
+           optimizes   Reg_1 = Stack_D
+   180   Reg_0 = Stack_D
+   180   Reg_0 -= Reg_1
+   180   Stack_D = Reg_0
+   181   call Sym_3
+   181   call Sym_11
+   181   no-op
+           optimizes   call Sym_44
+   181   Reg_0 = Stack_D
+   181   Reg_0 = -Reg_0
+   181   Stack_D = Reg_0
+   181   call Sym_6
+   181   call Sym_5
+   183   call Sym_39
+   183   call Sym_6
+   183   call Sym_3
+   183   call Sym_24
+   184   call Sym_6
+   184   call Sym_55
+   185   call Sym_39
+   187   call Sym_56
+   187   Reg_0 = 0
+   187   Stack_D = Reg_0
+   187   goto Label_35
+   188 label Label_39
+   190   call Sym_3
+   190   call Sym_53
+   190   call Sym_6
+   190   no-op
+           optimizes   call Sym_19
+   190   Reg_1 = Stack_D
+   190   Reg_0 = Stack_D
+   190   Reg_0 -= Reg_1
+   190   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   191   Reg_0 = 16
+           optimizes   Reg_0 = 2
+   191   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   191   no-op
+           optimizes   call Sym_18
+   191   no-op
+           optimizes   call Sym_46
+   191   no-op
+           optimizes   Reg_1 = Stack_D
+   191   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   191   if Reg_0 >= Reg_1 goto Label_41
+   191   no-op
+           optimizes   Reg_0 = Stack_D
+   191   no-op
+           optimizes   if Reg_0 == 0 goto Label_41
+   192   call Sym_54
+   192   call Sym_21
+   192   Reg_0 = 0
+   192   Stack_D = Reg_0
+   192   goto Label_35
+   192 label Label_41
+   194   call Sym_6
+   194   Reg_0 = 8
+           optimizes   Reg_0 = 1
+   194   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   194   no-op
+           optimizes   call Sym_18
+   194   no-op
+           optimizes   call Sym_19
+   194   no-op
+           optimizes   Reg_1 = Stack_D
+   194   Reg_0 = Stack_D
+   194   Reg_0 -= Reg_1
+   194   Stack_D = Reg_0
+   195   call Sym_35
+   195   call Sym_5
+   196   call Sym_3
+   196   call Sym_11
+   196   no-op
+           optimizes   call Sym_36
+   196   Reg_1 = Stack_D
+   196   Reg_0 = Stack_D
+   196   Reg_0 += Reg_1
+   196   no-op
+           optimizes   Stack_D = Reg_0
+   196   no-op
+           optimizes   call Sym_13
+   196   no-op
+           optimizes   Reg_0 = Stack_D
+   196   Reg_0 += 8
+   196   Stack_D = Reg_0
+   197   call Sym_6
+   197   call Sym_39
+   197   no-op
+           optimizes   call Sym_44
+   197   Reg_0 = Stack_D
+   197   Reg_0 = -Reg_0
+   197   no-op
+           optimizes   Stack_D = Reg_0
+   197   no-op
+           optimizes   call Sym_13
+   197   no-op
+           optimizes   Reg_0 = Stack_D
+   197   Reg_0 += 8
+   197   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   197   no-op
+           optimizes   call Sym_36
+   197   no-op
+           optimizes   Reg_1 = Stack_D
+   197   Reg_0 = Stack_D
+   197   Reg_0 += Reg_1
+   197   Stack_D = Reg_0
+   197   call Sym_6
+   197   call Sym_5
+   198   call Sym_39
+   198   Reg_0 = 0
+   198   Stack_D = Reg_0
+   198 label Label_35
+   198 }
+
+Peephole rewrites:
+  v4__allocb: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Dotarena: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Dotarena: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Dotarena: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4___Dotarena: redundant-test: test %rdx,%rdx => (none)
+  v4__allocdefrag: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4__allocslot: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_allocate: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_allocate: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_resize: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_resize: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_resize: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+
@@ -0,0 +1,1044 @@
+	.file	"alloc.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"alloc.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC4:
+	.string " end"
+.LC3:
+	.string " free: "
+.LC2:
+	.string " used: "
+.LC1:
+	.string ":"
+.LC0:
+	.string "Arena: "
+.stabs	"v4___Parenbcache_Closeparen:G2",40,0,0,v4___Parenbcache_Closeparen
+	.comm  v4___Parenbcache_Closeparen,8,8
+.stabs	"v4__arenap:G2",40,0,0,v4__arenap
+	.comm  v4__arenap,8,8
+.text
+	.align 4
+.stabs "v4__allocb:F1",36,0,0,v4__allocb
+	.weak v4__allocb
+	.type	v4__allocb,@function
+v4__allocb:
+.stabn 68,0,55,.LMa0-v4__allocb
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,55,.LMb0-v4__allocb
+.LMb0:
+.LBB2:
+.stabn 68,0,56,.LM1-v4__allocb
+.LM1:
+	call v4_dup@PLT
+	mov $45,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+.stabn 68,0,57,.LM7-v4__allocb
+.LM7:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	mov v4___Parenbcache_Closeparen@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.stabn 68,0,58,.LM13-v4__allocb
+.LM13:
+	call v4_swap@PLT
+	call v4_over@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jle .L2
+	mov $-2048,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_throw@PLT
+.L2:
+.LBE2:
+.stabn 68,0,58,.LM26-v4__allocb
+.LM26:
+	pop %rbx
+	leave
+	ret
+.Lfe2:
+	.size	 v4__allocb,.Lfe2-v4__allocb
+.stabn	192,0,0,.LBB2-v4__allocb
+.stabn	224,0,0,.LBE2-v4__allocb
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4__allocb
+.text
+	.align 4
+.stabs "v4__arena:F1",36,0,0,v4__arena
+	.weak v4__arena
+	.type	v4__arena,@function
+v4__arena:
+.stabn 68,0,60,.LMa27-v4__arena
+.LMa27:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,60,.LMb27-v4__arena
+.LMb27:
+.LBB10:
+	mov v4__arenap@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	test %rax,%rax
+	jne .L4
+.stabn 68,0,62,.LM38-v4__arena
+.LM38:
+	xor %rax,%rax
+	call v4__dpush@PLT
+	call v4__allocb@PLT
+	call v4__dpop@PLT
+	mov v4__arenap@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.stabn 68,0,63,.LM46-v4__arena
+.LM46:
+	xor %rax,%rax
+	call v4__dpush@PLT
+	mov v4__arenap@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	add $8,%rax
+	call v4__dpush@PLT
+	call v4__allocb@PLT
+	call v4_Store@PLT
+.L4:
+	mov v4__arenap@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.LBE10:
+.stabn 68,0,65,.LM66-v4__arena
+.LM66:
+	pop %rbx
+	leave
+	ret
+.Lfe10:
+	.size	 v4__arena,.Lfe10-v4__arena
+.stabn	192,0,0,.LBB10-v4__arena
+.stabn	224,0,0,.LBE10-v4__arena
+.Lscope10:
+.stabs	"",36,0,0,.Lscope10-v4__arena
+.text
+	.align 4
+.stabs "v4__allocsize:F1",36,0,0,v4__allocsize
+	.weak v4__allocsize
+	.type	v4__allocsize,@function
+v4__allocsize:
+.stabn 68,0,67,.LMa67-v4__allocsize
+.LMa67:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,67,.LMb67-v4__allocsize
+.LMb67:
+.LBB14:
+.stabn 68,0,68,.LM68-v4__allocsize
+.LM68:
+	call v4_aligned@PLT
+	call v4_dup@PLT
+.stabn 68,0,69,.LM70-v4__allocsize
+.LM70:
+	call v4__arena@PLT
+	call v4__dpop@PLT
+	add $8,%rax
+	call v4__dpush@PLT
+	mov v4___Parenbcache_Closeparen@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_within@PLT
+.stabn 68,0,70,.LM85-v4__allocsize
+.LM85:
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L6
+.stabn 68,0,71,.LM87-v4__allocsize
+.LM87:
+	mov $8,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+.stabn 68,0,72,.LM96-v4__allocsize
+.LM96:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jge .L7
+.stabn 68,0,73,.LM102-v4__allocsize
+.LM102:
+	call v4_drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+.stabn 68,0,75,.LM106-v4__allocsize
+.LM106:
+	jmp .L8
+.L6:
+	call v4_drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+.L7:
+.L8:
+.LBE14:
+.stabn 68,0,75,.LM114-v4__allocsize
+.LM114:
+	pop %rbx
+	leave
+	ret
+.Lfe14:
+	.size	 v4__allocsize,.Lfe14-v4__allocsize
+.stabn	192,0,0,.LBB14-v4__allocsize
+.stabn	224,0,0,.LBE14-v4__allocsize
+.Lscope14:
+.stabs	"",36,0,0,.Lscope14-v4__allocsize
+.text
+	.align 4
+.stabs "v4___Dotarena:F1",36,0,0,v4___Dotarena
+	.weak v4___Dotarena
+	.type	v4___Dotarena,@function
+v4___Dotarena:
+.stabn 68,0,77,.LMa115-v4___Dotarena
+.LMa115:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,77,.LMb115-v4___Dotarena
+.LMb115:
+.LBB22:
+.stabn 68,0,78,.LM116-v4___Dotarena
+.LM116:
+	call v4_base@PLT
+	call v4_Fetch@PLT
+	call v4_Greaterr@PLT
+	call v4_hex@PLT
+.stabn 68,0,80,.LM120-v4___Dotarena
+.LM120:
+	lea .LC0(%rip),%rax
+	call v4__dpush@PLT
+	mov $7,%rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	call v4__arena@PLT
+	call v4_Dot@PLT
+	mov v4___Parenbcache_Closeparen@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+	call v4_Dot@PLT
+.stabn 68,0,81,.LM133-v4___Dotarena
+.LM133:
+	lea .LC1(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	call v4_cr@PLT
+.stabn 68,0,83,.LM139-v4___Dotarena
+.LM139:
+	call v4__arena@PLT
+.L10:
+.stabn 68,0,84,.LM141-v4___Dotarena
+.LM141:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+.stabn 68,0,85,.LM143-v4___Dotarena
+.LM143:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L11
+.stabn 68,0,86,.LM149-v4___Dotarena
+.LM149:
+	call v4_over@PLT
+	mov $8,%rax
+	call v4__dpush@PLT
+	call v4_u_Dotr@PLT
+	call v4_space@PLT
+.stabn 68,0,87,.LM154-v4___Dotarena
+.LM154:
+	call v4_base@PLT
+	call v4_Fetch@PLT
+	call v4_decimal@PLT
+.stabn 68,0,88,.LM157-v4___Dotarena
+.LM157:
+	call v4_over@PLT
+	call v4_abs@PLT
+	mov $4,%rax
+	call v4__dpush@PLT
+	call v4_u_Dotr@PLT
+.stabn 68,0,89,.LM162-v4___Dotarena
+.LM162:
+	call v4_base@PLT
+	call v4_Store@PLT
+.stabn 68,0,90,.LM164-v4___Dotarena
+.LM164:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jle .L12
+	lea .LC2(%rip),%rax
+	call v4__dpush@PLT
+	mov $7,%rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.stabn 68,0,91,.LM175-v4___Dotarena
+.LM175:
+	jmp .L13
+.L12:
+	lea .LC3(%rip),%rax
+	call v4__dpush@PLT
+	mov $7,%rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.L13:
+.stabn 68,0,92,.LM183-v4___Dotarena
+.LM183:
+	call v4_abs@PLT
+.stabn 68,0,93,.LM184-v4___Dotarena
+.LM184:
+	call v4_z2dup@PLT
+	call v4_over@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+.L15:
+.stabn 68,0,94,.LM197-v4___Dotarena
+.LM197:
+	call v4_i@PLT
+	call v4__dpop@PLT
+	add $8,%rax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+	call v4_Dot@PLT
+.stabn 68,0,95,.LM204-v4___Dotarena
+.LM204:
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L15
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+	call v4_cr@PLT
+	call v4__dpop@PLT
+	add $8,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,97,.LM225-v4___Dotarena
+.LM225:
+	jmp .L10
+.L11:
+.stabn 68,0,98,.LM227-v4___Dotarena
+.LM227:
+	call v4_drop@PLT
+	mov $8,%rax
+	call v4__dpush@PLT
+	call v4_u_Dotr@PLT
+	call v4_space@PLT
+	lea .LC4(%rip),%rax
+	call v4__dpush@PLT
+	mov $4,%rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	call v4_cr@PLT
+.stabn 68,0,100,.LM238-v4___Dotarena
+.LM238:
+	call v4_r_Greater@PLT
+	call v4_base@PLT
+	pop %rbx
+	leave
+	jmp v4_Store@PLT
+.LBE22:
+.stabn 68,0,100,.LM242-v4___Dotarena
+.LM242:
+	pop %rbx
+	leave
+	ret
+.Lfe22:
+	.size	 v4___Dotarena,.Lfe22-v4___Dotarena
+.stabn	192,0,0,.LBB22-v4___Dotarena
+.stabn	224,0,0,.LBE22-v4___Dotarena
+.Lscope22:
+.stabs	"",36,0,0,.Lscope22-v4___Dotarena
+.text
+	.align 4
+.stabs "v4__allocdefrag:F1",36,0,0,v4__allocdefrag
+	.weak v4__allocdefrag
+	.type	v4__allocdefrag,@function
+v4__allocdefrag:
+.stabn 68,0,102,.LMa243-v4__allocdefrag
+.LMa243:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,102,.LMb243-v4__allocdefrag
+.LMb243:
+.LBB40:
+.L18:
+.stabn 68,0,104,.LM245-v4__allocdefrag
+.LM245:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jge .L19
+.stabn 68,0,106,.LM252-v4__allocdefrag
+.LM252:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4_abs@PLT
+	call v4__dpop@PLT
+	add $8,%rax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,107,.LM265-v4__allocdefrag
+.LM265:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	not %rax
+	test %rax,%rax
+	je .L20
+	pop %rbx
+	leave
+	jmp v4_z2drop@PLT
+.L20:
+.stabn 68,0,110,.LM280-v4__allocdefrag
+.LM280:
+	call v4_Fetch@PLT
+	call v4_over@PLT
+	call v4_Fetch@PLT
+.stabn 68,0,111,.LM283-v4__allocdefrag
+.LM283:
+	mov $8,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	call v4_Store@PLT
+.stabn 68,0,113,.LM298-v4__allocdefrag
+.LM298:
+	jmp .L18
+.L19:
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE40:
+.stabn 68,0,113,.LM302-v4__allocdefrag
+.LM302:
+	pop %rbx
+	leave
+	ret
+.Lfe40:
+	.size	 v4__allocdefrag,.Lfe40-v4__allocdefrag
+.stabn	192,0,0,.LBB40-v4__allocdefrag
+.stabn	224,0,0,.LBE40-v4__allocdefrag
+.Lscope40:
+.stabs	"",36,0,0,.Lscope40-v4__allocdefrag
+.text
+	.align 4
+.stabs "v4__allocslot:F1",36,0,0,v4__allocslot
+	.weak v4__allocslot
+	.type	v4__allocslot,@function
+v4__allocslot:
+.stabn 68,0,115,.LMa303-v4__allocslot
+.LMa303:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,115,.LMb303-v4__allocslot
+.LMb303:
+.LBB43:
+.L22:
+.stabn 68,0,117,.LM305-v4__allocslot
+.LM305:
+	call v4_dup@PLT
+	call v4__allocdefrag@PLT
+.stabn 68,0,118,.LM307-v4__allocslot
+.LM307:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+.stabn 68,0,119,.LM309-v4__allocslot
+.LM309:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L24
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.L24:
+.stabn 68,0,120,.LM318-v4__allocslot
+.LM318:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jge .L25
+	call v4__dpop@PLT
+	neg %rax
+	call v4__dpush@PLT
+.stabn 68,0,122,.LM328-v4__allocslot
+.LM328:
+	call v4_dup@PLT
+	mov $3,%rax
+	call v4__dpush@PLT
+	call v4_pick@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,123,.LM337-v4__allocslot
+.LM337:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L26
+	pop %rbx
+	leave
+	jmp v4_z2drop@PLT
+.L26:
+.stabn 68,0,124,.LM346-v4__allocslot
+.LM346:
+	mov $16,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	not %rax
+	test %rax,%rax
+	je .L27
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.L27:
+.L25:
+	call v4__dpop@PLT
+	add $8,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,128,.LM373-v4__allocslot
+.LM373:
+	jmp .L22
+.LBE43:
+.stabn 68,0,128,.LM376-v4__allocslot
+.LM376:
+	pop %rbx
+	leave
+	ret
+.Lfe43:
+	.size	 v4__allocslot,.Lfe43-v4__allocslot
+.stabn	192,0,0,.LBB43-v4__allocslot
+.stabn	224,0,0,.LBE43-v4__allocslot
+.Lscope43:
+.stabs	"",36,0,0,.Lscope43-v4__allocslot
+.text
+	.align 4
+.stabs "v4_allocate:F1",36,0,0,v4_allocate
+	.weak v4_allocate
+	.type	v4_allocate,@function
+v4_allocate:
+.stabn 68,0,130,.LMa377-v4_allocate
+.LMa377:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,130,.LMb377-v4_allocate
+.LMb377:
+.LBB47:
+.stabn 68,0,131,.LM378-v4_allocate
+.LM378:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jge .L29
+	call v4_drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4__einval@PLT
+.L29:
+.stabn 68,0,132,.LM390-v4_allocate
+.LM390:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L30
+	call v4__dpop@PLT
+	add $8,%rax
+	call v4__dpush@PLT
+.L30:
+.stabn 68,0,134,.LM401-v4_allocate
+.LM401:
+	call v4_aligned@PLT
+.stabn 68,0,135,.LM402-v4_allocate
+.LM402:
+	call v4__arena@PLT
+	call v4__allocslot@PLT
+.stabn 68,0,137,.LM404-v4_allocate
+.LM404:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L31
+.stabn 68,0,138,.LM411-v4_allocate
+.LM411:
+	call v4_z2dup@PLT
+	call v4_Store@PLT
+.stabn 68,0,139,.LM413-v4_allocate
+.LM413:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	mov %rax,%r8
+	mov $16,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	call v4__dpush@PLT
+	call v4__allocb@PLT
+.stabn 68,0,140,.LM428-v4_allocate
+.LM428:
+	mov $8,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	call v4_Store@PLT
+.stabn 68,0,141,.LM440-v4_allocate
+.LM440:
+	call v4_nip@PLT
+	call v4__dpop@PLT
+	add $8,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L28
+.L31:
+.stabn 68,0,144,.LM449-v4_allocate
+.LM449:
+	call v4_z2dup@PLT
+	call v4_Fetch@PLT
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	neg %rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jne .L32
+.stabn 68,0,145,.LM462-v4_allocate
+.LM462:
+	call v4_z2dup@PLT
+	call v4_Store@PLT
+.stabn 68,0,146,.LM464-v4_allocate
+.LM464:
+	call v4_nip@PLT
+	call v4__dpop@PLT
+	add $8,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L28
+.L32:
+.stabn 68,0,149,.LM473-v4_allocate
+.LM473:
+	call v4_dup@PLT
+	call v4_Greaterr@PLT
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,150,.LM478-v4_allocate
+.LM478:
+	call v4_z2dup@PLT
+	call v4_Store@PLT
+.stabn 68,0,151,.LM480-v4_allocate
+.LM480:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	add $8,%rax
+	call v4__dpush@PLT
+.stabn 68,0,152,.LM491-v4_allocate
+.LM491:
+	call v4_swap@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	add $8,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	call v4_Store@PLT
+.stabn 68,0,153,.LM504-v4_allocate
+.LM504:
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	add $8,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+.L28:
+.LBE47:
+.stabn 68,0,153,.LM512-v4_allocate
+.LM512:
+	pop %rbx
+	leave
+	ret
+.Lfe47:
+	.size	 v4_allocate,.Lfe47-v4_allocate
+.stabn	192,0,0,.LBB47-v4_allocate
+.stabn	224,0,0,.LBE47-v4_allocate
+.Lscope47:
+.stabs	"",36,0,0,.Lscope47-v4_allocate
+.text
+	.align 4
+.stabs "v4_free:F1",36,0,0,v4_free
+	.weak v4_free
+	.type	v4_free,@function
+v4_free:
+.stabn 68,0,155,.LMa513-v4_free
+.LMa513:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,155,.LMb513-v4_free
+.LMb513:
+.LBB51:
+.stabn 68,0,156,.LM514-v4_free
+.LM514:
+	call v4_dup@PLT
+	call v4__allocsize@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L34
+.stabn 68,0,157,.LM521-v4_free
+.LM521:
+	call v4_drop@PLT
+	pop %rbx
+	leave
+	jmp v4__einval@PLT
+.L34:
+.stabn 68,0,159,.LM525-v4_free
+.LM525:
+	call v4_aligned@PLT
+.stabn 68,0,160,.LM526-v4_free
+.LM526:
+	mov $8,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,161,.LM534-v4_free
+.LM534:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	neg %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	call v4_Store@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+.L33:
+.LBE51:
+.stabn 68,0,161,.LM545-v4_free
+.LM545:
+	pop %rbx
+	leave
+	ret
+.Lfe51:
+	.size	 v4_free,.Lfe51-v4_free
+.stabn	192,0,0,.LBB51-v4_free
+.stabn	224,0,0,.LBE51-v4_free
+.Lscope51:
+.stabs	"",36,0,0,.Lscope51-v4_free
+.text
+	.align 4
+.stabs "v4_resize:F1",36,0,0,v4_resize
+	.weak v4_resize
+	.type	v4_resize,@function
+v4_resize:
+.stabn 68,0,163,.LMa546-v4_resize
+.LMa546:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,163,.LMb546-v4_resize
+.LMb546:
+.LBB52:
+.stabn 68,0,164,.LM547-v4_resize
+.LM547:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jge .L36
+	call v4_z2drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4__einval@PLT
+.L36:
+.stabn 68,0,165,.LM559-v4_resize
+.LM559:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L37
+	call v4__dpop@PLT
+	add $8,%rax
+	call v4__dpush@PLT
+.L37:
+.stabn 68,0,167,.LM570-v4_resize
+.LM570:
+	call v4_over@PLT
+	call v4__allocsize@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L38
+.stabn 68,0,168,.LM577-v4_resize
+.LM577:
+	call v4_z2drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4__einval@PLT
+.L38:
+.stabn 68,0,170,.LM583-v4_resize
+.LM583:
+	call v4_aligned@PLT
+	call v4_swap@PLT
+	call v4_aligned@PLT
+	call v4_swap@PLT
+.stabn 68,0,171,.LM587-v4_resize
+.LM587:
+	call v4_over@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,172,.LM589-v4_resize
+.LM589:
+	call v4_over@PLT
+	mov $8,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,174,.LM600-v4_resize
+.LM600:
+	call v4_dup@PLT
+	call v4_r_Fetch@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jle .L39
+.stabn 68,0,175,.LM608-v4_resize
+.LM608:
+	call v4_allocate@PLT
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L40
+.stabn 68,0,176,.LM615-v4_resize
+.LM615:
+	call v4_z2rdrop@PLT
+	call v4_Greaterr@PLT
+	call v4_drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_r_Greater@PLT
+.L40:
+	call v4_drop@PLT
+.stabn 68,0,180,.LM624-v4_resize
+.LM624:
+	call v4_over@PLT
+	mov $8,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,181,.LM633-v4_resize
+.LM633:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	neg %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	call v4_Store@PLT
+.stabn 68,0,183,.LM641-v4_resize
+.LM641:
+	call v4_r_Greater@PLT
+	call v4_swap@PLT
+	call v4_dup@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,184,.LM645-v4_resize
+.LM645:
+	call v4_swap@PLT
+	call v4_move@PLT
+.stabn 68,0,185,.LM647-v4_resize
+.LM647:
+	call v4_r_Greater@PLT
+.stabn 68,0,187,.LM648-v4_resize
+.LM648:
+	call v4_rdrop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L35
+.L39:
+.stabn 68,0,190,.LM653-v4_resize
+.LM653:
+	call v4_dup@PLT
+	call v4_r_Fetch@PLT
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	mov %rax,%r8
+.stabn 68,0,191,.LM661-v4_resize
+.LM661:
+	mov $16,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	jge .L41
+.stabn 68,0,192,.LM670-v4_resize
+.LM670:
+	call v4_z2rdrop@PLT
+	call v4_drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L35
+.L41:
+.stabn 68,0,194,.LM676-v4_resize
+.LM676:
+	call v4_swap@PLT
+	mov $8,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,195,.LM685-v4_resize
+.LM685:
+	call v4_z2dup@PLT
+	call v4_Store@PLT
+.stabn 68,0,196,.LM687-v4_resize
+.LM687:
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	add $8,%rax
+	call v4__dpush@PLT
+.stabn 68,0,197,.LM698-v4_resize
+.LM698:
+	call v4_swap@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	neg %rax
+	add $8,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	call v4_Store@PLT
+.stabn 68,0,198,.LM715-v4_resize
+.LM715:
+	call v4_r_Greater@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+.L35:
+.LBE52:
+.stabn 68,0,198,.LM719-v4_resize
+.LM719:
+	pop %rbx
+	leave
+	ret
+.Lfe52:
+	.size	 v4_resize,.Lfe52-v4_resize
+.stabn	192,0,0,.LBB52-v4_resize
+.stabn	224,0,0,.LBE52-v4_resize
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4_resize
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"
@@ -0,0 +1,73 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: cclink.ft
+Compiled: Sat Oct 17 10:15:10 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+   145 Sym_2 codeword "v4_c_pop"
+   130 Sym_1 codeword "v4_c_push"
+    47 Sym_0 codeword "v4_cexecute"
+
+Intermediate code:
+    47 function Sym_0 {
+    48   asm (    call v4__dpop@PLT)
+    49   asm (    mov %rax,%rbx)
+    50   asm (    call v4__dpop@PLT)
+    51   asm (    mov %rax,%r10)
+    53   asm (    and $-16,%rsp)
+    54   asm (    cmp $6,%r10)
+    55   asm (    jbe 7f)
+    56   asm (    test $1,%r10)
+    57   asm (    jz 8f)
+    58   asm (    sub $8,%rsp)
+    59   asm (8:)
+    61   asm (    mov %r10,%rcx)
+    62   asm (    sub $6,%rcx)
+    63   asm (9:)
+    64   asm (    call v4__dpop@PLT)
+    65   asm (    push %rax)
+    66   asm (    loop 9b)
+    67   asm (7:)
+    69   asm (    cmp $6,%r10)
+    70   asm (    jb 6f)
+    71   asm (    call v4__dpop@PLT)
+    72   asm (    mov %rax,%r9)
+    73   asm (6:  cmp $5,%r10)
+    74   asm (    jb 5f)
+    75   asm (    call v4__dpop@PLT)
+    76   asm (    mov %rax,%r8)
+    77   asm (5:  cmp $4,%r10)
+    78   asm (    jb 4f)
+    79   asm (    call v4__dpop@PLT)
+    80   asm (    mov %rax,%rcx)
+    81   asm (4:  cmp $3,%r10)
+    82   asm (    jb 3f)
+    83   asm (    call v4__dpop@PLT)
+    84   asm (    mov %rax,%rdx)
+    85   asm (3:  cmp $2,%r10)
+    86   asm (    jb 2f)
+    87   asm (    call v4__dpop@PLT)
+    88   asm (    mov %rax,%rsi)
+    89   asm (2:  cmp $1,%r10)
+    90   asm (    jb 1f)
+    91   asm (    call v4__dpop@PLT)
+    92   asm (    mov %rax,%rdi)
+    93   asm (1:)
+    95   asm (    xor %eax,%eax)
+    96   asm (    call *%rbx)
+    97   asm (    lea -24(%rbp),%rsp)
+    98   asm (    call v4__dpush@PLT)
+   100   asm (    forth_pic.=0b-0b)
+   101 }
+
+   130 function Sym_1 {
+   131   asm (    movslq %edi,%rax)
+   132   asm (    call v4__dpush@PLT)
+   134   asm (    forth_pic.=0b-0b)
+   135 }
+
+   145 function Sym_2 {
+   146   asm (    call v4__dpop@PLT)
+   148   asm (    forth_pic.=0b-0b)
+   149 }
+
@@ -0,0 +1,168 @@
+	.file	"cclink.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"cclink.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_cexecute:F1",36,0,0,v4_cexecute
+	.weak v4_cexecute
+	.type	v4_cexecute,@function
+v4_cexecute:
+.stabn 68,0,47,.LMa0-v4_cexecute
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,47,.LMb0-v4_cexecute
+.LMb0:
+.LBB0:
+#APP
+    call v4__dpop@PLT
+    mov %rax,%rbx
+    call v4__dpop@PLT
+    mov %rax,%r10
+    and $-16,%rsp
+    cmp $6,%r10
+    jbe 7f
+    test $1,%r10
+    jz 8f
+    sub $8,%rsp
+8:
+    mov %r10,%rcx
+    sub $6,%rcx
+9:
+    call v4__dpop@PLT
+    push %rax
+    loop 9b
+7:
+    cmp $6,%r10
+    jb 6f
+    call v4__dpop@PLT
+    mov %rax,%r9
+6:  cmp $5,%r10
+    jb 5f
+    call v4__dpop@PLT
+    mov %rax,%r8
+5:  cmp $4,%r10
+    jb 4f
+    call v4__dpop@PLT
+    mov %rax,%rcx
+4:  cmp $3,%r10
+    jb 3f
+    call v4__dpop@PLT
+    mov %rax,%rdx
+3:  cmp $2,%r10
+    jb 2f
+    call v4__dpop@PLT
+    mov %rax,%rsi
+2:  cmp $1,%r10
+    jb 1f
+    call v4__dpop@PLT
+    mov %rax,%rdi
+1:
+    xor %eax,%eax
+    call *%rbx
+    lea -24(%rbp),%rsp
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE0:
+.stabn 68,0,101,.LM49-v4_cexecute
+.LM49:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_cexecute,.Lfe0-v4_cexecute
+.stabn	192,0,0,.LBB0-v4_cexecute
+.stabn	224,0,0,.LBE0-v4_cexecute
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_cexecute
+.text
+	.align 4
+.stabs "v4_c_push:F1",36,0,0,v4_c_push
+	.weak v4_c_push
+	.type	v4_c_push,@function
+v4_c_push:
+.stabn 68,0,130,.LMa50-v4_c_push
+.LMa50:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,130,.LMb50-v4_c_push
+.LMb50:
+.LBB1:
+#APP
+    movslq %edi,%rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE1:
+.stabn 68,0,135,.LM54-v4_c_push
+.LM54:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe1:
+	.size	 v4_c_push,.Lfe1-v4_c_push
+.stabn	192,0,0,.LBB1-v4_c_push
+.stabn	224,0,0,.LBE1-v4_c_push
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4_c_push
+.text
+	.align 4
+.stabs "v4_c_pop:F1",36,0,0,v4_c_pop
+	.weak v4_c_pop
+	.type	v4_c_pop,@function
+v4_c_pop:
+.stabn 68,0,145,.LMa55-v4_c_pop
+.LMa55:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,145,.LMb55-v4_c_pop
+.LMb55:
+.LBB2:
+#APP
+    call v4__dpop@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE2:
+.stabn 68,0,149,.LM58-v4_c_pop
+.LM58:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe2:
+	.size	 v4_c_pop,.Lfe2-v4_c_pop
+.stabn	192,0,0,.LBB2-v4_c_pop
+.stabn	224,0,0,.LBE2-v4_c_pop
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4_c_pop
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"
@@ -0,0 +1,102 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: cells.ft
+Compiled: Sat Oct 17 10:15:09 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+    31 Sym_6 external "v4_Minus"
+    30 Sym_4 external "v4_Plus"
+    29 Sym_2 external "v4_Star"
+    24 Sym_0 word "v4_cell"
+    31 Sym_5 word "v4_cell_Minus"
+    30 Sym_3 word "v4_cell_Plus"
+    29 Sym_1 word "v4_cells"
+    35 Sym_10 word "v4_char_Minus"
+    34 Sym_8 word "v4_char_Plus"
+    33 Sym_7 word "v4_chars"
+    35 Sym_11 external "v4_z1_Minus"
+    34 Sym_9 external "v4_z1_Plus"
+
+Intermediate code:
+    24 function Sym_0 {
+    24   Reg_0 = 8
+    24   Stack_D = Reg_0
+    24   no-op
+           optimizes label Label_1
+    24 }
+
+    29 function Sym_1 {
+    29   no-op
+           optimizes   call Sym_0
+    24   no-op
+           optimizes   Reg_0 = 8
+    24   no-op
+           optimizes   Stack_D = Reg_0
+    29   no-op
+           optimizes   call Sym_2
+    29   Reg_0 = Stack_D
+    29   Reg_0 *= 8
+    29   Stack_D = Reg_0
+    29   no-op
+           optimizes label Label_2
+    29 }
+
+    30 function Sym_3 {
+    30   no-op
+           optimizes   call Sym_0
+    24   Reg_0 = 8
+    24   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    30   no-op
+           optimizes   call Sym_4
+    30   no-op
+           optimizes   Reg_1 = Stack_D
+    30   Reg_0 = Stack_D
+    30   Reg_0 += Reg_1
+    30   Stack_D = Reg_0
+    30   no-op
+           optimizes label Label_3
+    30 }
+
+    31 function Sym_5 {
+    31   no-op
+           optimizes   call Sym_0
+    24   Reg_0 = 8
+    24   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    31   no-op
+           optimizes   call Sym_6
+    31   no-op
+           optimizes   Reg_1 = Stack_D
+    31   Reg_0 = Stack_D
+    31   Reg_0 -= Reg_1
+    31   Stack_D = Reg_0
+    31   no-op
+           optimizes label Label_4
+    31 }
+
+    33 function Sym_7 {
+    33   no-op
+           optimizes label Label_5
+    33 }
+
+    34 function Sym_8 {
+    34   no-op
+           optimizes   call Sym_9
+    34   Reg_0 = Stack_D
+    34   Reg_0 += 1
+    34   Stack_D = Reg_0
+    34   no-op
+           optimizes label Label_6
+    34 }
+
+    35 function Sym_10 {
+    35   no-op
+           optimizes   call Sym_11
+    35   Reg_0 = Stack_D
+    35   Reg_0 -= 1
+    35   Stack_D = Reg_0
+    35   no-op
+           optimizes label Label_7
+    35 }
+
@@ -0,0 +1,800 @@
+	.file	"compare.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"compare.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_z0_Less:F1",36,0,0,v4_z0_Less
+	.weak v4_z0_Less
+	.type	v4_z0_Less,@function
+v4_z0_Less:
+.stabn 68,0,26,.LMa0-v4_z0_Less
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,26,.LMb0-v4_z0_Less
+.LMb0:
+.LBB0:
+#APP
+    call v4__dpop@PLT
+    sar $63,%rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE0:
+.stabn 68,0,32,.LM5-v4_z0_Less
+.LM5:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_z0_Less,.Lfe0-v4_z0_Less
+.stabn	192,0,0,.LBB0-v4_z0_Less
+.stabn	224,0,0,.LBE0-v4_z0_Less
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_z0_Less
+.text
+	.align 4
+.stabs "v4_z0_Equals:F1",36,0,0,v4_z0_Equals
+	.weak v4_z0_Equals
+	.type	v4_z0_Equals,@function
+v4_z0_Equals:
+.stabn 68,0,43,.LMa6-v4_z0_Equals
+.LMa6:
+0:
+.stabn 68,0,43,.LMb6-v4_z0_Equals
+.LMb6:
+.LBB1:
+.stabn 68,0,44,.LM7-v4_z0_Equals
+.LM7:
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L2
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L1
+.L2:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+.L1:
+.LBE1:
+.stabn 68,0,44,.LM16-v4_z0_Equals
+.LM16:
+	ret
+.Lfe1:
+	.size	 v4_z0_Equals,.Lfe1-v4_z0_Equals
+.stabn	192,0,0,.LBB1-v4_z0_Equals
+.stabn	224,0,0,.LBE1-v4_z0_Equals
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4_z0_Equals
+.text
+	.align 4
+.stabs "v4_z0_Less_Greater:F1",36,0,0,v4_z0_Less_Greater
+	.weak v4_z0_Less_Greater
+	.type	v4_z0_Less_Greater,@function
+v4_z0_Less_Greater:
+.stabn 68,0,46,.LMa17-v4_z0_Less_Greater
+.LMa17:
+0:
+.stabn 68,0,46,.LMb17-v4_z0_Less_Greater
+.LMb17:
+.LBB2:
+.stabn 68,0,44,.LM19-v4_z0_Less_Greater
+.LM19:
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L23
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L24
+.L23:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+.L24:
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+.LBE2:
+.stabn 68,0,47,.LM33-v4_z0_Less_Greater
+.LM33:
+	ret
+.Lfe2:
+	.size	 v4_z0_Less_Greater,.Lfe2-v4_z0_Less_Greater
+.stabn	192,0,0,.LBB2-v4_z0_Less_Greater
+.stabn	224,0,0,.LBE2-v4_z0_Less_Greater
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4_z0_Less_Greater
+.text
+	.align 4
+.stabs "v4_z0_Greater:F1",36,0,0,v4_z0_Greater
+	.weak v4_z0_Greater
+	.type	v4_z0_Greater,@function
+v4_z0_Greater:
+.stabn 68,0,49,.LMa34-v4_z0_Greater
+.LMa34:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,49,.LMb34-v4_z0_Greater
+.LMb34:
+.LBB4:
+.stabn 68,0,50,.LM35-v4_z0_Greater
+.LM35:
+	call v4_dup@PLT
+	call v4_z0_Less@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L5
+	call v4_drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L4
+.L5:
+.stabn 68,0,47,.LM45-v4_z0_Greater
+.LM45:
+	call v4_z0_Equals@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+.L4:
+.LBE4:
+.stabn 68,0,50,.LM51-v4_z0_Greater
+.LM51:
+	pop %rbx
+	leave
+	ret
+.Lfe4:
+	.size	 v4_z0_Greater,.Lfe4-v4_z0_Greater
+.stabn	192,0,0,.LBB4-v4_z0_Greater
+.stabn	224,0,0,.LBE4-v4_z0_Greater
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4_z0_Greater
+.text
+	.align 4
+.stabs "v4_Equals:F1",36,0,0,v4_Equals
+	.weak v4_Equals
+	.type	v4_Equals,@function
+v4_Equals:
+.stabn 68,0,52,.LMa52-v4_Equals
+.LMa52:
+0:
+.stabn 68,0,52,.LMb52-v4_Equals
+.LMb52:
+.LBB7:
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	je .L25
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L26
+.L25:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+.L26:
+.LBE7:
+.stabn 68,0,53,.LM69-v4_Equals
+.LM69:
+	ret
+.Lfe7:
+	.size	 v4_Equals,.Lfe7-v4_Equals
+.stabn	192,0,0,.LBB7-v4_Equals
+.stabn	224,0,0,.LBE7-v4_Equals
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_Equals
+.text
+	.align 4
+.stabs "v4_u_Less:F1",36,0,0,v4_u_Less
+	.weak v4_u_Less
+	.type	v4_u_Less,@function
+v4_u_Less:
+.stabn 68,0,55,.LMa70-v4_u_Less
+.LMa70:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,55,.LMb70-v4_u_Less
+.LMb70:
+.LBB9:
+.stabn 68,0,56,.LM71-v4_u_Less
+.LM71:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	call v4__dpush@PLT
+	call v4_z0_Less@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L8
+	call v4_nip@PLT
+	pop %rbx
+	leave
+	jmp v4_z0_Less@PLT
+.L8:
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_z0_Less@PLT
+.LBE9:
+.stabn 68,0,56,.LM91-v4_u_Less
+.LM91:
+	pop %rbx
+	leave
+	ret
+.Lfe9:
+	.size	 v4_u_Less,.Lfe9-v4_u_Less
+.stabn	192,0,0,.LBB9-v4_u_Less
+.stabn	224,0,0,.LBE9-v4_u_Less
+.Lscope9:
+.stabs	"",36,0,0,.Lscope9-v4_u_Less
+.text
+	.align 4
+.stabs "v4_u_Greater:F1",36,0,0,v4_u_Greater
+	.weak v4_u_Greater
+	.type	v4_u_Greater,@function
+v4_u_Greater:
+.stabn 68,0,58,.LMa92-v4_u_Greater
+.LMa92:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,58,.LMb92-v4_u_Greater
+.LMb92:
+.LBB13:
+.stabn 68,0,59,.LM93-v4_u_Greater
+.LM93:
+	call v4_swap@PLT
+.stabn 68,0,56,.LM95-v4_u_Greater
+.LM95:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	call v4__dpush@PLT
+	call v4_z0_Less@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L27
+	call v4_nip@PLT
+	pop %rbx
+	leave
+	jmp v4_z0_Less@PLT
+.L27:
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_z0_Less@PLT
+.LBE13:
+.stabn 68,0,59,.LM116-v4_u_Greater
+.LM116:
+	pop %rbx
+	leave
+	ret
+.Lfe13:
+	.size	 v4_u_Greater,.Lfe13-v4_u_Greater
+.stabn	192,0,0,.LBB13-v4_u_Greater
+.stabn	224,0,0,.LBE13-v4_u_Greater
+.Lscope13:
+.stabs	"",36,0,0,.Lscope13-v4_u_Greater
+.text
+	.align 4
+.stabs "v4_u_Less_Equals:F1",36,0,0,v4_u_Less_Equals
+	.weak v4_u_Less_Equals
+	.type	v4_u_Less_Equals,@function
+v4_u_Less_Equals:
+.stabn 68,0,61,.LMa117-v4_u_Less_Equals
+.LMa117:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,61,.LMb117-v4_u_Less_Equals
+.LMb117:
+.LBB15:
+.stabn 68,0,59,.LM119-v4_u_Less_Equals
+.LM119:
+	call v4_swap@PLT
+	call v4_u_Less@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+.LBE15:
+.stabn 68,0,62,.LM126-v4_u_Less_Equals
+.LM126:
+	pop %rbx
+	leave
+	ret
+.Lfe15:
+	.size	 v4_u_Less_Equals,.Lfe15-v4_u_Less_Equals
+.stabn	192,0,0,.LBB15-v4_u_Less_Equals
+.stabn	224,0,0,.LBE15-v4_u_Less_Equals
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4_u_Less_Equals
+.text
+	.align 4
+.stabs "v4_u_Greater_Equals:F1",36,0,0,v4_u_Greater_Equals
+	.weak v4_u_Greater_Equals
+	.type	v4_u_Greater_Equals,@function
+v4_u_Greater_Equals:
+.stabn 68,0,64,.LMa127-v4_u_Greater_Equals
+.LMa127:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,64,.LMb127-v4_u_Greater_Equals
+.LMb127:
+.LBB16:
+.stabn 68,0,56,.LM129-v4_u_Greater_Equals
+.LM129:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	call v4__dpush@PLT
+	call v4_z0_Less@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L29
+	call v4_nip@PLT
+	call v4_z0_Less@PLT
+	jmp .L30
+.L29:
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+	call v4_z0_Less@PLT
+.L30:
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+.LBE16:
+.stabn 68,0,65,.LM154-v4_u_Greater_Equals
+.LM154:
+	pop %rbx
+	leave
+	ret
+.Lfe16:
+	.size	 v4_u_Greater_Equals,.Lfe16-v4_u_Greater_Equals
+.stabn	192,0,0,.LBB16-v4_u_Greater_Equals
+.stabn	224,0,0,.LBE16-v4_u_Greater_Equals
+.Lscope16:
+.stabs	"",36,0,0,.Lscope16-v4_u_Greater_Equals
+.text
+	.align 4
+.stabs "v4_Less:F1",36,0,0,v4_Less
+	.weak v4_Less
+	.type	v4_Less,@function
+v4_Less:
+.stabn 68,0,67,.LMa155-v4_Less
+.LMa155:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,67,.LMb155-v4_Less
+.LMb155:
+.LBB17:
+.stabn 68,0,68,.LM156-v4_Less
+.LM156:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	call v4__dpush@PLT
+	call v4_z0_Less@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L13
+	call v4_drop@PLT
+	pop %rbx
+	leave
+	jmp v4_z0_Less@PLT
+.L13:
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_z0_Less@PLT
+.LBE17:
+.stabn 68,0,68,.LM176-v4_Less
+.LM176:
+	pop %rbx
+	leave
+	ret
+.Lfe17:
+	.size	 v4_Less,.Lfe17-v4_Less
+.stabn	192,0,0,.LBB17-v4_Less
+.stabn	224,0,0,.LBE17-v4_Less
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-v4_Less
+.text
+	.align 4
+.stabs "v4_Greater:F1",36,0,0,v4_Greater
+	.weak v4_Greater
+	.type	v4_Greater,@function
+v4_Greater:
+.stabn 68,0,70,.LMa177-v4_Greater
+.LMa177:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,70,.LMb177-v4_Greater
+.LMb177:
+.LBB18:
+.stabn 68,0,71,.LM178-v4_Greater
+.LM178:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	je .L31
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L32
+.L31:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+.L32:
+.stabn 68,0,71,.LM194-v4_Greater
+.LM194:
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L15
+	call v4_z2drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L14
+.L15:
+	call v4_swap@PLT
+.stabn 68,0,68,.LM203-v4_Greater
+.LM203:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	call v4__dpush@PLT
+	call v4_z0_Less@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L33
+	call v4_drop@PLT
+	pop %rbx
+	leave
+	jmp v4_z0_Less@PLT
+.L33:
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_z0_Less@PLT
+.L34:
+.L14:
+.LBE18:
+.stabn 68,0,71,.LM224-v4_Greater
+.LM224:
+	pop %rbx
+	leave
+	ret
+.Lfe18:
+	.size	 v4_Greater,.Lfe18-v4_Greater
+.stabn	192,0,0,.LBB18-v4_Greater
+.stabn	224,0,0,.LBE18-v4_Greater
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4_Greater
+.text
+	.align 4
+.stabs "v4_Less_Greater:F1",36,0,0,v4_Less_Greater
+	.weak v4_Less_Greater
+	.type	v4_Less_Greater,@function
+v4_Less_Greater:
+.stabn 68,0,73,.LMa225-v4_Less_Greater
+.LMa225:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,73,.LMb225-v4_Less_Greater
+.LMb225:
+.LBB20:
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	call v4__dpush@PLT
+	call v4_z0_Equals@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+.LBE20:
+.stabn 68,0,74,.LM238-v4_Less_Greater
+.LM238:
+	pop %rbx
+	leave
+	ret
+.Lfe20:
+	.size	 v4_Less_Greater,.Lfe20-v4_Less_Greater
+.stabn	192,0,0,.LBB20-v4_Less_Greater
+.stabn	224,0,0,.LBE20-v4_Less_Greater
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4_Less_Greater
+.text
+	.align 4
+.stabs "v4_Less_Equals:F1",36,0,0,v4_Less_Equals
+	.weak v4_Less_Equals
+	.type	v4_Less_Equals,@function
+v4_Less_Equals:
+.stabn 68,0,76,.LMa239-v4_Less_Equals
+.LMa239:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,76,.LMb239-v4_Less_Equals
+.LMb239:
+.LBB21:
+.stabn 68,0,71,.LM241-v4_Less_Equals
+.LM241:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	call v4__dpush@PLT
+	call v4_z0_Equals@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L35
+	call v4_z2drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L36
+.L35:
+	call v4_swap@PLT
+	call v4_Less@PLT
+.L36:
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+.LBE21:
+.stabn 68,0,77,.LM263-v4_Less_Equals
+.LM263:
+	pop %rbx
+	leave
+	ret
+.Lfe21:
+	.size	 v4_Less_Equals,.Lfe21-v4_Less_Equals
+.stabn	192,0,0,.LBB21-v4_Less_Equals
+.stabn	224,0,0,.LBE21-v4_Less_Equals
+.Lscope21:
+.stabs	"",36,0,0,.Lscope21-v4_Less_Equals
+.text
+	.align 4
+.stabs "v4_Greater_Equals:F1",36,0,0,v4_Greater_Equals
+	.weak v4_Greater_Equals
+	.type	v4_Greater_Equals,@function
+v4_Greater_Equals:
+.stabn 68,0,79,.LMa264-v4_Greater_Equals
+.LMa264:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,79,.LMb264-v4_Greater_Equals
+.LMb264:
+.LBB22:
+.stabn 68,0,68,.LM266-v4_Greater_Equals
+.LM266:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	call v4__dpush@PLT
+	call v4_z0_Less@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L37
+	call v4_drop@PLT
+	call v4_z0_Less@PLT
+	jmp .L38
+.L37:
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+	call v4_z0_Less@PLT
+.L38:
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+.LBE22:
+.stabn 68,0,80,.LM291-v4_Greater_Equals
+.LM291:
+	pop %rbx
+	leave
+	ret
+.Lfe22:
+	.size	 v4_Greater_Equals,.Lfe22-v4_Greater_Equals
+.stabn	192,0,0,.LBB22-v4_Greater_Equals
+.stabn	224,0,0,.LBE22-v4_Greater_Equals
+.Lscope22:
+.stabs	"",36,0,0,.Lscope22-v4_Greater_Equals
+.text
+	.align 4
+.stabs "v4_max:F1",36,0,0,v4_max
+	.weak v4_max
+	.type	v4_max,@function
+v4_max:
+.stabn 68,0,82,.LMa292-v4_max
+.LMa292:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,82,.LMb292-v4_max
+.LMb292:
+.LBB23:
+.stabn 68,0,83,.LM293-v4_max
+.LM293:
+	call v4_z2dup@PLT
+	call v4_Less@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L20
+	call v4_swap@PLT
+.L20:
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE23:
+.stabn 68,0,83,.LM301-v4_max
+.LM301:
+	pop %rbx
+	leave
+	ret
+.Lfe23:
+	.size	 v4_max,.Lfe23-v4_max
+.stabn	192,0,0,.LBB23-v4_max
+.stabn	224,0,0,.LBE23-v4_max
+.Lscope23:
+.stabs	"",36,0,0,.Lscope23-v4_max
+.text
+	.align 4
+.stabs "v4_min:F1",36,0,0,v4_min
+	.weak v4_min
+	.type	v4_min,@function
+v4_min:
+.stabn 68,0,85,.LMa302-v4_min
+.LMa302:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,85,.LMb302-v4_min
+.LMb302:
+.LBB24:
+.stabn 68,0,86,.LM303-v4_min
+.LM303:
+	call v4_z2dup@PLT
+	call v4_swap@PLT
+	call v4_Less@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L22
+	call v4_swap@PLT
+.L22:
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE24:
+.stabn 68,0,86,.LM312-v4_min
+.LM312:
+	pop %rbx
+	leave
+	ret
+.Lfe24:
+	.size	 v4_min,.Lfe24-v4_min
+.stabn	192,0,0,.LBB24-v4_min
+.stabn	224,0,0,.LBE24-v4_min
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4_min
+.text
+	.align 4
+.stabs "v4_within:F1",36,0,0,v4_within
+	.weak v4_within
+	.type	v4_within,@function
+v4_within:
+.stabn 68,0,88,.LMa313-v4_within
+.LMa313:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+0:
+.stabn 68,0,88,.LMb313-v4_within
+.LMb313:
+.LBB25:
+.stabn 68,0,89,.LM314-v4_within
+.LM314:
+	call v4_over@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	mov %rax,-16(%rbp)
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+	mov -16(%rbp),%rax
+	call v4__dpush@PLT
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	jmp v4_u_Less@PLT
+.LBE25:
+.stabn 68,0,89,.LM333-v4_within
+.LM333:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe25:
+	.size	 v4_within,.Lfe25-v4_within
+.stabn	192,0,0,.LBB25-v4_within
+.stabn	224,0,0,.LBE25-v4_within
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4_within
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"
@@ -0,0 +1,381 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: compat.ft
+Compiled: Sat Oct 17 10:15:10 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Data:
+    44 Data_0 string[0] ""
+
+Symbols:
+    94 Sym_34 word "v4_Comma"
+    33 Sym_4 external "v4_Fetch"
+    79 Sym_28 word "v4_Leftbracket"
+    43 Sym_11 external "v4_Plus"
+    80 Sym_29 word "v4_Rightbracket"
+    95 Sym_35 external "v4_Store"
+    58 Sym_20 word "v4__abort"
+    54 Sym_16 word "v4__abortquote"
+    28 Sym_0 variable Cell "v4__argc"
+    29 Sym_1 variable Cell "v4__argv"
+    30 Sym_2 variable Cell "v4__envp"
+    55 Sym_17 external "v4__getehhandler"
+    89 Sym_32 variable Cell "v4__here"
+    66 Sym_23 word "v4__quit"
+    74 Sym_26 variable Cell "v4__state"
+    60 Sym_21 external "v4__syscall"
+    51 Sym_14 word "v4__type"
+    63 Sym_22 word "v4_abort"
+   100 Sym_40 word "v4_align"
+   101 Sym_41 external "v4_aligned"
+    41 Sym_7 word "v4_arg"
+    32 Sym_3 word "v4_argc"
+    35 Sym_5 word "v4_argv"
+    97 Sym_37 word "v4_c_Comma"
+    98 Sym_38 external "v4_c_Store"
+    95 Sym_36 external "v4_cell_Plus"
+    43 Sym_10 external "v4_cells"
+    98 Sym_39 external "v4_char_Plus"
+    44 Sym_13 external "v4_drop"
+    42 Sym_8 external "v4_dup"
+    38 Sym_6 word "v4_envp"
+    91 Sym_33 word "v4_here"
+    82 Sym_31 word "v4_immediate"
+   104 Sym_43 external "v4_invert"
+    81 Sym_30 word "v4_literal"
+    72 Sym_25 variable Char[84] "v4_pad"
+    69 Sym_24 word "v4_quit"
+   104 Sym_44 external "v4_rshift"
+    76 Sym_27 word "v4_state"
+    43 Sym_12 external "v4_strlen"
+    56 Sym_19 external "v4_throw"
+    52 Sym_15 external "v4_type"
+   103 Sym_42 word "v4_unused"
+    42 Sym_9 external "v4_within"
+    55 Sym_18 external "v4_z2drop"
+
+Intermediate code:
+    32 function Sym_3 {
+    33   no-op
+           optimizes   Reg_0 = Sym_0
+    33   no-op
+           optimizes   Stack_D = Reg_0
+    33   no-op
+           optimizes   call Sym_4
+    33   Reg_0 = *(Sym_0)
+    33   Stack_D = Reg_0
+    33   no-op
+           optimizes label Label_1
+    33 }
+
+    35 function Sym_5 {
+    36   no-op
+           optimizes   Reg_0 = Sym_1
+    36   no-op
+           optimizes   Stack_D = Reg_0
+    36   no-op
+           optimizes   call Sym_4
+    36   Reg_0 = *(Sym_1)
+    36   Stack_D = Reg_0
+    36   no-op
+           optimizes label Label_2
+    36 }
+
+    38 function Sym_6 {
+    39   no-op
+           optimizes   Reg_0 = Sym_2
+    39   no-op
+           optimizes   Stack_D = Reg_0
+    39   no-op
+           optimizes   call Sym_4
+    39   Reg_0 = *(Sym_2)
+    39   Stack_D = Reg_0
+    39   no-op
+           optimizes label Label_3
+    39 }
+
+    41 function Sym_7 {
+    42   call Sym_8
+    42   Reg_0 = 0
+    42   Stack_D = Reg_0
+    42   no-op
+           optimizes   call Sym_3
+    33   no-op
+           optimizes   Reg_0 = Sym_0
+    33   no-op
+           optimizes   Stack_D = Reg_0
+    33   no-op
+           optimizes   call Sym_4
+    33   Reg_0 = *(Sym_0)
+    33   Stack_D = Reg_0
+    42   call Sym_9
+    42   Reg_0 = Stack_D
+    42   if Reg_0 == 0 goto Label_5
+    43   no-op
+           optimizes   call Sym_10
+    43   Reg_0 = Stack_D
+    43   Reg_0 *= 8
+    43   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    43   no-op
+           optimizes   call Sym_5
+    36   no-op
+           optimizes   Reg_0 = Sym_1
+    36   no-op
+           optimizes   Stack_D = Reg_0
+    36   no-op
+           optimizes   call Sym_4
+    36   Reg_0 = *(Sym_1)
+    36   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    43   no-op
+           optimizes   call Sym_11
+    43   no-op
+           optimizes   Reg_1 = Stack_D
+    43   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    43   Reg_0 += Reg_1
+    43   Stack_D = Reg_0
+    43   call Sym_4
+    43   tail call Sym_12
+           optimizes   call Sym_12
+    44   no-op
+           optimizes   goto Label_6
+    44 label Label_5
+    44   call Sym_13
+    44   Reg_0 = Data_0
+    44   Stack_D = Reg_0
+    44   Reg_0 = 0
+    44   Stack_D = Reg_0
+    44   call Sym_13
+    44   Reg_0 = 0
+    44   Stack_D = Reg_0
+    44 label Label_6
+    44   no-op
+           optimizes label Label_4
+    44 }
+
+    51 function Sym_14 {
+    52   tail call Sym_15
+           optimizes   call Sym_15
+    52   no-op
+           optimizes label Label_7
+    52 }
+
+    54 function Sym_16 {
+    55   call Sym_17
+    55   Reg_0 = Stack_D
+    55   if Reg_0 == 0 goto Label_9
+    55   call Sym_18
+    55   goto Label_10
+    55 label Label_9
+    55   call Sym_15
+    55 label Label_10
+    56   Reg_0 = -2
+    56   Stack_D = Reg_0
+    56   tail call Sym_19
+           optimizes   call Sym_19
+    56   no-op
+           optimizes label Label_8
+    56 }
+
+    58 function Sym_20 {
+    59   Reg_0 = 6
+    59   Stack_D = Reg_0
+    60   Reg_0 = 20
+    60   Stack_D = Reg_0
+    60   Reg_0 = 0
+    60   Stack_D = Reg_0
+    60   call Sym_21
+    61   Reg_0 = 37
+    61   Stack_D = Reg_0
+    61   Reg_0 = 2
+    61   Stack_D = Reg_0
+    61   tail call Sym_21
+           optimizes   call Sym_21
+    61   no-op
+           optimizes label Label_11
+    61 }
+
+    63 function Sym_22 {
+    64   Reg_0 = -1
+    64   Stack_D = Reg_0
+    64   tail call Sym_19
+           optimizes   call Sym_19
+    64   no-op
+           optimizes label Label_12
+    64 }
+
+    66 function Sym_23 {
+    67   Reg_0 = 0
+    67   Stack_D = Reg_0
+    67   Reg_0 = 1
+    67   Stack_D = Reg_0
+    67   Reg_0 = 1
+    67   Stack_D = Reg_0
+    67   tail call Sym_21
+           optimizes   call Sym_21
+    67   no-op
+           optimizes label Label_13
+    67 }
+
+    69 function Sym_24 {
+    70   Reg_0 = -56
+    70   Stack_D = Reg_0
+    70   tail call Sym_19
+           optimizes   call Sym_19
+    70   no-op
+           optimizes label Label_14
+    70 }
+
+    76 function Sym_27 {
+    77   Reg_0 = Sym_26
+    77   Stack_D = Reg_0
+    77   no-op
+           optimizes label Label_15
+    77 }
+
+    79 function Sym_28 {
+    79   no-op
+           optimizes label Label_16
+    79 }
+
+    80 function Sym_29 {
+    80   no-op
+           optimizes label Label_17
+    80 }
+
+    81 function Sym_30 {
+    81   no-op
+           optimizes label Label_18
+    81 }
+
+    82 function Sym_31 {
+    82   no-op
+           optimizes label Label_19
+    82 }
+
+    91 function Sym_33 {
+    92   no-op
+           optimizes   Reg_0 = Sym_32
+    92   no-op
+           optimizes   Stack_D = Reg_0
+    92   no-op
+           optimizes   call Sym_4
+    92   Reg_0 = *(Sym_32)
+    92   Stack_D = Reg_0
+    92   no-op
+           optimizes label Label_20
+    92 }
+
+    94 function Sym_34 {
+    95   no-op
+           optimizes   call Sym_33
+    92   no-op
+           optimizes   Reg_0 = Sym_32
+    92   no-op
+           optimizes   Stack_D = Reg_0
+    92   no-op
+           optimizes   call Sym_4
+    92   Reg_0 = *(Sym_32)
+    92   Stack_D = Reg_0
+    95   call Sym_35
+    95   no-op
+           optimizes   Reg_0 = Sym_32
+    95   no-op
+           optimizes   Stack_D = Reg_0
+    95   no-op
+           optimizes   call Sym_4
+    95   Reg_0 = *(Sym_32)
+    95   no-op
+           optimizes   Stack_D = Reg_0
+    95   no-op
+           optimizes   call Sym_36
+    95   no-op
+           optimizes   Reg_0 = Stack_D
+    95   Reg_0 += 8
+    95   no-op
+           optimizes   Stack_D = Reg_0
+    95   no-op
+           optimizes   Reg_0 = Sym_32
+    95   no-op
+           optimizes   Stack_D = Reg_0
+    95   no-op
+           optimizes   call Sym_35
+    95   no-op
+           optimizes   Reg_0 = Stack_D
+    95   *(Sym_32) = Reg_0
+    95   no-op
+           optimizes label Label_21
+    95 }
+
+    97 function Sym_37 {
+    98   no-op
+           optimizes   call Sym_33
+    92   no-op
+           optimizes   Reg_0 = Sym_32
+    92   no-op
+           optimizes   Stack_D = Reg_0
+    92   no-op
+           optimizes   call Sym_4
+    92   Reg_0 = *(Sym_32)
+    92   Stack_D = Reg_0
+    98   call Sym_38
+    98   no-op
+           optimizes   Reg_0 = Sym_32
+    98   no-op
+           optimizes   Stack_D = Reg_0
+    98   no-op
+           optimizes   call Sym_4
+    98   Reg_0 = *(Sym_32)
+    98   Stack_D = Reg_0
+    98   call Sym_39
+    98   no-op
+           optimizes   Reg_0 = Sym_32
+    98   no-op
+           optimizes   Stack_D = Reg_0
+    98   no-op
+           optimizes   call Sym_35
+    98   Reg_0 = Stack_D
+    98   *(Sym_32) = Reg_0
+    98   no-op
+           optimizes label Label_22
+    98 }
+
+   100 function Sym_40 {
+   101   no-op
+           optimizes   Reg_0 = Sym_32
+   101   no-op
+           optimizes   Stack_D = Reg_0
+   101   no-op
+           optimizes   call Sym_4
+   101   Reg_0 = *(Sym_32)
+   101   Stack_D = Reg_0
+   101   call Sym_41
+   101   no-op
+           optimizes   Reg_0 = Sym_32
+   101   no-op
+           optimizes   Stack_D = Reg_0
+   101   no-op
+           optimizes   call Sym_35
+   101   Reg_0 = Stack_D
+   101   *(Sym_32) = Reg_0
+   101   no-op
+           optimizes label Label_23
+   101 }
+
+   103 function Sym_42 {
+   104   Reg_0 = 9223372036854775807
+           optimizes   Reg_0 = -1
+   104   Stack_D = Reg_0
+   104   no-op
+           optimizes   call Sym_43
+   104   no-op
+           optimizes   Reg_0 = 1
+   104   no-op
+           optimizes   Stack_D = Reg_0
+   104   no-op
+           optimizes   call Sym_44
+   104   no-op
+           optimizes label Label_24
+   104 }
+
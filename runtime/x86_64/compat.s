@@ -0,0 +1,680 @@
+	.file	"compat.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"compat.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC0:
+	.string ""
+.stabs	"v4__argc:G2",40,0,0,v4__argc
+	.comm  v4__argc,8,8
+.stabs	"v4__argv:G2",40,0,0,v4__argv
+	.comm  v4__argv,8,8
+.stabs	"v4__envp:G2",40,0,0,v4__envp
+	.comm  v4__envp,8,8
+.stabs	"v4__here:G2",40,0,0,v4__here
+	.comm  v4__here,8,8
+.stabs	"v4__state:G2",40,0,0,v4__state
+	.comm  v4__state,8,8
+.stabs	"v4_pad:Gar2;0;83;4",40,0,0,v4_pad
+	.comm  v4_pad,84,32
+.text
+	.align 4
+.stabs "v4_argc:F1",36,0,0,v4_argc
+	.weak v4_argc
+	.type	v4_argc,@function
+v4_argc:
+.stabn 68,0,32,.LMa0-v4_argc
+.LMa0:
+0:
+.stabn 68,0,32,.LMb0-v4_argc
+.LMb0:
+.LBB3:
+	mov v4__argc@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.LBE3:
+.stabn 68,0,33,.LM7-v4_argc
+.LM7:
+	ret
+.Lfe3:
+	.size	 v4_argc,.Lfe3-v4_argc
+.stabn	192,0,0,.LBB3-v4_argc
+.stabn	224,0,0,.LBE3-v4_argc
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4_argc
+.text
+	.align 4
+.stabs "v4_argv:F1",36,0,0,v4_argv
+	.weak v4_argv
+	.type	v4_argv,@function
+v4_argv:
+.stabn 68,0,35,.LMa8-v4_argv
+.LMa8:
+0:
+.stabn 68,0,35,.LMb8-v4_argv
+.LMb8:
+.LBB5:
+	mov v4__argv@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.LBE5:
+.stabn 68,0,36,.LM15-v4_argv
+.LM15:
+	ret
+.Lfe5:
+	.size	 v4_argv,.Lfe5-v4_argv
+.stabn	192,0,0,.LBB5-v4_argv
+.stabn	224,0,0,.LBE5-v4_argv
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4_argv
+.text
+	.align 4
+.stabs "v4_envp:F1",36,0,0,v4_envp
+	.weak v4_envp
+	.type	v4_envp,@function
+v4_envp:
+.stabn 68,0,38,.LMa16-v4_envp
+.LMa16:
+0:
+.stabn 68,0,38,.LMb16-v4_envp
+.LMb16:
+.LBB6:
+	mov v4__envp@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.LBE6:
+.stabn 68,0,39,.LM23-v4_envp
+.LM23:
+	ret
+.Lfe6:
+	.size	 v4_envp,.Lfe6-v4_envp
+.stabn	192,0,0,.LBB6-v4_envp
+.stabn	224,0,0,.LBE6-v4_envp
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4_envp
+.text
+	.align 4
+.stabs "v4_arg:F1",36,0,0,v4_arg
+	.weak v4_arg
+	.type	v4_arg,@function
+v4_arg:
+.stabn 68,0,41,.LMa24-v4_arg
+.LMa24:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,41,.LMb24-v4_arg
+.LMb24:
+.LBB7:
+.stabn 68,0,42,.LM25-v4_arg
+.LM25:
+	call v4_dup@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	mov v4__argc@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.stabn 68,0,42,.LM34-v4_arg
+.LM34:
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L5
+	call v4__dpop@PLT
+	shl $3,%rax
+	mov %rax,%r8
+	mov v4__argv@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	call v4__dpush@PLT
+	call v4_Fetch@PLT
+	pop %rbx
+	leave
+	jmp v4_strlen@PLT
+.L5:
+	call v4_drop@PLT
+	lea .LC0(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	call v4_drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+.L6:
+.LBE7:
+.stabn 68,0,44,.LM66-v4_arg
+.LM66:
+	pop %rbx
+	leave
+	ret
+.Lfe7:
+	.size	 v4_arg,.Lfe7-v4_arg
+.stabn	192,0,0,.LBB7-v4_arg
+.stabn	224,0,0,.LBE7-v4_arg
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_arg
+.text
+	.align 4
+.stabs "v4__type:F1",36,0,0,v4__type
+	.weak v4__type
+	.type	v4__type,@function
+v4__type:
+.stabn 68,0,51,.LMa67-v4__type
+.LMa67:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,51,.LMb67-v4__type
+.LMb67:
+.LBB14:
+.stabn 68,0,52,.LM68-v4__type
+.LM68:
+	pop %rbx
+	leave
+	jmp v4_type@PLT
+.LBE14:
+.stabn 68,0,52,.LM70-v4__type
+.LM70:
+	pop %rbx
+	leave
+	ret
+.Lfe14:
+	.size	 v4__type,.Lfe14-v4__type
+.stabn	192,0,0,.LBB14-v4__type
+.stabn	224,0,0,.LBE14-v4__type
+.Lscope14:
+.stabs	"",36,0,0,.Lscope14-v4__type
+.text
+	.align 4
+.stabs "v4__abortquote:F1",36,0,0,v4__abortquote
+	.weak v4__abortquote
+	.type	v4__abortquote,@function
+v4__abortquote:
+.stabn 68,0,54,.LMa71-v4__abortquote
+.LMa71:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,54,.LMb71-v4__abortquote
+.LMb71:
+.LBB16:
+.stabn 68,0,55,.LM72-v4__abortquote
+.LM72:
+	call v4__getehhandler@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L9
+	call v4_z2drop@PLT
+	jmp .L10
+.L9:
+	call v4_type@PLT
+.L10:
+.stabn 68,0,56,.LM80-v4__abortquote
+.LM80:
+	mov $-2,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_throw@PLT
+.LBE16:
+.stabn 68,0,56,.LM84-v4__abortquote
+.LM84:
+	pop %rbx
+	leave
+	ret
+.Lfe16:
+	.size	 v4__abortquote,.Lfe16-v4__abortquote
+.stabn	192,0,0,.LBB16-v4__abortquote
+.stabn	224,0,0,.LBE16-v4__abortquote
+.Lscope16:
+.stabs	"",36,0,0,.Lscope16-v4__abortquote
+.text
+	.align 4
+.stabs "v4__abort:F1",36,0,0,v4__abort
+	.weak v4__abort
+	.type	v4__abort,@function
+v4__abort:
+.stabn 68,0,58,.LMa85-v4__abort
+.LMa85:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,58,.LMb85-v4__abort
+.LMb85:
+.LBB20:
+.stabn 68,0,59,.LM86-v4__abort
+.LM86:
+	mov $6,%rax
+	call v4__dpush@PLT
+.stabn 68,0,60,.LM88-v4__abort
+.LM88:
+	mov $20,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	call v4__syscall@PLT
+.stabn 68,0,61,.LM93-v4__abort
+.LM93:
+	mov $37,%rax
+	call v4__dpush@PLT
+	mov $2,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4__syscall@PLT
+.LBE20:
+.stabn 68,0,61,.LM99-v4__abort
+.LM99:
+	pop %rbx
+	leave
+	ret
+.Lfe20:
+	.size	 v4__abort,.Lfe20-v4__abort
+.stabn	192,0,0,.LBB20-v4__abort
+.stabn	224,0,0,.LBE20-v4__abort
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4__abort
+.text
+	.align 4
+.stabs "v4_abort:F1",36,0,0,v4_abort
+	.weak v4_abort
+	.type	v4_abort,@function
+v4_abort:
+.stabn 68,0,63,.LMa100-v4_abort
+.LMa100:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,63,.LMb100-v4_abort
+.LMb100:
+.LBB22:
+.stabn 68,0,64,.LM101-v4_abort
+.LM101:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_throw@PLT
+.LBE22:
+.stabn 68,0,64,.LM105-v4_abort
+.LM105:
+	pop %rbx
+	leave
+	ret
+.Lfe22:
+	.size	 v4_abort,.Lfe22-v4_abort
+.stabn	192,0,0,.LBB22-v4_abort
+.stabn	224,0,0,.LBE22-v4_abort
+.Lscope22:
+.stabs	"",36,0,0,.Lscope22-v4_abort
+.text
+	.align 4
+.stabs "v4__quit:F1",36,0,0,v4__quit
+	.weak v4__quit
+	.type	v4__quit,@function
+v4__quit:
+.stabn 68,0,66,.LMa106-v4__quit
+.LMa106:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,66,.LMb106-v4__quit
+.LMb106:
+.LBB23:
+.stabn 68,0,67,.LM107-v4__quit
+.LM107:
+	xor %rax,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4__syscall@PLT
+.LBE23:
+.stabn 68,0,67,.LM115-v4__quit
+.LM115:
+	pop %rbx
+	leave
+	ret
+.Lfe23:
+	.size	 v4__quit,.Lfe23-v4__quit
+.stabn	192,0,0,.LBB23-v4__quit
+.stabn	224,0,0,.LBE23-v4__quit
+.Lscope23:
+.stabs	"",36,0,0,.Lscope23-v4__quit
+.text
+	.align 4
+.stabs "v4_quit:F1",36,0,0,v4_quit
+	.weak v4_quit
+	.type	v4_quit,@function
+v4_quit:
+.stabn 68,0,69,.LMa116-v4_quit
+.LMa116:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,69,.LMb116-v4_quit
+.LMb116:
+.LBB24:
+.stabn 68,0,70,.LM117-v4_quit
+.LM117:
+	mov $-56,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_throw@PLT
+.LBE24:
+.stabn 68,0,70,.LM121-v4_quit
+.LM121:
+	pop %rbx
+	leave
+	ret
+.Lfe24:
+	.size	 v4_quit,.Lfe24-v4_quit
+.stabn	192,0,0,.LBB24-v4_quit
+.stabn	224,0,0,.LBE24-v4_quit
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4_quit
+.text
+	.align 4
+.stabs "v4_state:F1",36,0,0,v4_state
+	.weak v4_state
+	.type	v4_state,@function
+v4_state:
+.stabn 68,0,76,.LMa122-v4_state
+.LMa122:
+0:
+.stabn 68,0,76,.LMb122-v4_state
+.LMb122:
+.LBB27:
+.stabn 68,0,77,.LM123-v4_state
+.LM123:
+	mov v4__state@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+.LBE27:
+.stabn 68,0,77,.LM126-v4_state
+.LM126:
+	ret
+.Lfe27:
+	.size	 v4_state,.Lfe27-v4_state
+.stabn	192,0,0,.LBB27-v4_state
+.stabn	224,0,0,.LBE27-v4_state
+.Lscope27:
+.stabs	"",36,0,0,.Lscope27-v4_state
+.text
+	.align 4
+.stabs "v4_Leftbracket:F1",36,0,0,v4_Leftbracket
+	.weak v4_Leftbracket
+	.type	v4_Leftbracket,@function
+v4_Leftbracket:
+.stabn 68,0,79,.LMa127-v4_Leftbracket
+.LMa127:
+0:
+.stabn 68,0,79,.LMb127-v4_Leftbracket
+.LMb127:
+.LBB28:
+.LBE28:
+.stabn 68,0,79,.LM129-v4_Leftbracket
+.LM129:
+	ret
+.Lfe28:
+	.size	 v4_Leftbracket,.Lfe28-v4_Leftbracket
+.stabn	192,0,0,.LBB28-v4_Leftbracket
+.stabn	224,0,0,.LBE28-v4_Leftbracket
+.Lscope28:
+.stabs	"",36,0,0,.Lscope28-v4_Leftbracket
+.text
+	.align 4
+.stabs "v4_Rightbracket:F1",36,0,0,v4_Rightbracket
+	.weak v4_Rightbracket
+	.type	v4_Rightbracket,@function
+v4_Rightbracket:
+.stabn 68,0,80,.LMa130-v4_Rightbracket
+.LMa130:
+0:
+.stabn 68,0,80,.LMb130-v4_Rightbracket
+.LMb130:
+.LBB29:
+.LBE29:
+.stabn 68,0,80,.LM132-v4_Rightbracket
+.LM132:
+	ret
+.Lfe29:
+	.size	 v4_Rightbracket,.Lfe29-v4_Rightbracket
+.stabn	192,0,0,.LBB29-v4_Rightbracket
+.stabn	224,0,0,.LBE29-v4_Rightbracket
+.Lscope29:
+.stabs	"",36,0,0,.Lscope29-v4_Rightbracket
+.text
+	.align 4
+.stabs "v4_literal:F1",36,0,0,v4_literal
+	.weak v4_literal
+	.type	v4_literal,@function
+v4_literal:
+.stabn 68,0,81,.LMa133-v4_literal
+.LMa133:
+0:
+.stabn 68,0,81,.LMb133-v4_literal
+.LMb133:
+.LBB30:
+.LBE30:
+.stabn 68,0,81,.LM135-v4_literal
+.LM135:
+	ret
+.Lfe30:
+	.size	 v4_literal,.Lfe30-v4_literal
+.stabn	192,0,0,.LBB30-v4_literal
+.stabn	224,0,0,.LBE30-v4_literal
+.Lscope30:
+.stabs	"",36,0,0,.Lscope30-v4_literal
+.text
+	.align 4
+.stabs "v4_immediate:F1",36,0,0,v4_immediate
+	.weak v4_immediate
+	.type	v4_immediate,@function
+v4_immediate:
+.stabn 68,0,82,.LMa136-v4_immediate
+.LMa136:
+0:
+.stabn 68,0,82,.LMb136-v4_immediate
+.LMb136:
+.LBB31:
+.LBE31:
+.stabn 68,0,82,.LM138-v4_immediate
+.LM138:
+	ret
+.Lfe31:
+	.size	 v4_immediate,.Lfe31-v4_immediate
+.stabn	192,0,0,.LBB31-v4_immediate
+.stabn	224,0,0,.LBE31-v4_immediate
+.Lscope31:
+.stabs	"",36,0,0,.Lscope31-v4_immediate
+.text
+	.align 4
+.stabs "v4_here:F1",36,0,0,v4_here
+	.weak v4_here
+	.type	v4_here,@function
+v4_here:
+.stabn 68,0,91,.LMa139-v4_here
+.LMa139:
+0:
+.stabn 68,0,91,.LMb139-v4_here
+.LMb139:
+.LBB33:
+	mov v4__here@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.LBE33:
+.stabn 68,0,92,.LM146-v4_here
+.LM146:
+	ret
+.Lfe33:
+	.size	 v4_here,.Lfe33-v4_here
+.stabn	192,0,0,.LBB33-v4_here
+.stabn	224,0,0,.LBE33-v4_here
+.Lscope33:
+.stabs	"",36,0,0,.Lscope33-v4_here
+.text
+	.align 4
+.stabs "v4_Comma:F1",36,0,0,v4_Comma
+	.weak v4_Comma
+	.type	v4_Comma,@function
+v4_Comma:
+.stabn 68,0,94,.LMa147-v4_Comma
+.LMa147:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,94,.LMb147-v4_Comma
+.LMb147:
+.LBB34:
+	mov v4__here@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.stabn 68,0,95,.LM154-v4_Comma
+.LM154:
+	call v4_Store@PLT
+	mov v4__here@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	add $8,%rax
+	mov v4__here@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.LBE34:
+.stabn 68,0,95,.LM170-v4_Comma
+.LM170:
+	pop %rbx
+	leave
+	ret
+.Lfe34:
+	.size	 v4_Comma,.Lfe34-v4_Comma
+.stabn	192,0,0,.LBB34-v4_Comma
+.stabn	224,0,0,.LBE34-v4_Comma
+.Lscope34:
+.stabs	"",36,0,0,.Lscope34-v4_Comma
+.text
+	.align 4
+.stabs "v4_c_Comma:F1",36,0,0,v4_c_Comma
+	.weak v4_c_Comma
+	.type	v4_c_Comma,@function
+v4_c_Comma:
+.stabn 68,0,97,.LMa171-v4_c_Comma
+.LMa171:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,97,.LMb171-v4_c_Comma
+.LMb171:
+.LBB37:
+	mov v4__here@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.stabn 68,0,98,.LM178-v4_c_Comma
+.LM178:
+	call v4_c_Store@PLT
+	mov v4__here@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+	call v4_char_Plus@PLT
+	call v4__dpop@PLT
+	mov v4__here@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.LBE37:
+.stabn 68,0,98,.LM191-v4_c_Comma
+.LM191:
+	pop %rbx
+	leave
+	ret
+.Lfe37:
+	.size	 v4_c_Comma,.Lfe37-v4_c_Comma
+.stabn	192,0,0,.LBB37-v4_c_Comma
+.stabn	224,0,0,.LBE37-v4_c_Comma
+.Lscope37:
+.stabs	"",36,0,0,.Lscope37-v4_c_Comma
+.text
+	.align 4
+.stabs "v4_align:F1",36,0,0,v4_align
+	.weak v4_align
+	.type	v4_align,@function
+v4_align:
+.stabn 68,0,100,.LMa192-v4_align
+.LMa192:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,100,.LMb192-v4_align
+.LMb192:
+.LBB40:
+	mov v4__here@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+	call v4_aligned@PLT
+	call v4__dpop@PLT
+	mov v4__here@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.LBE40:
+.stabn 68,0,101,.LM205-v4_align
+.LM205:
+	pop %rbx
+	leave
+	ret
+.Lfe40:
+	.size	 v4_align,.Lfe40-v4_align
+.stabn	192,0,0,.LBB40-v4_align
+.stabn	224,0,0,.LBE40-v4_align
+.Lscope40:
+.stabs	"",36,0,0,.Lscope40-v4_align
+.text
+	.align 4
+.stabs "v4_unused:F1",36,0,0,v4_unused
+	.weak v4_unused
+	.type	v4_unused,@function
+v4_unused:
+.stabn 68,0,103,.LMa206-v4_unused
+.LMa206:
+0:
+.stabn 68,0,103,.LMb206-v4_unused
+.LMb206:
+.LBB42:
+.stabn 68,0,104,.LM207-v4_unused
+.LM207:
+	movabs $9223372036854775807,%rax
+	call v4__dpush@PLT
+.LBE42:
+.stabn 68,0,104,.LM214-v4_unused
+.LM214:
+	ret
+.Lfe42:
+	.size	 v4_unused,.Lfe42-v4_unused
+.stabn	192,0,0,.LBB42-v4_unused
+.stabn	224,0,0,.LBE42-v4_unused
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4_unused
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"
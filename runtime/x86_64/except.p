@@ -0,0 +1,628 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: except.ft
+Compiled: Sat Oct 17 10:15:10 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Data:
+   133 Data_1 string[2] ": "
+   160 Data_16 string[46] "Internal error: double exception, abort forced"
+   130 Data_0 string[22] "Uncaught exception at "
+   136 Data_2 string[5] "abort"
+   142 Data_8 string[16] "division by zero"
+   150 Data_15 string[15] "exception code "
+   144 Data_10 string[29] "floating-point divide by zero"
+   145 Data_11 string[29] "floating-point stack overflow"
+   146 Data_12 string[30] "floating-point stack underflow"
+   147 Data_13 string[9] "i/o error"
+   143 Data_9 string[24] "invalid numeric argument"
+   148 Data_14 string[13] "out of memory"
+   137 Data_3 string[12] "quoted abort"
+   140 Data_6 string[21] "return stack overflow"
+   141 Data_7 string[36] "return stack underflow (uncatchable)"
+   138 Data_4 string[14] "stack overflow"
+   139 Data_5 string[15] "stack underflow"
+
+Symbols:
+   133 Sym_26 external "v4_Dotr"
+   121 Sym_17 external "v4_Equals"
+   104 Sym_4 external "v4_Fetch"
+   107 Sym_7 external "v4_Greaterr"
+   111 Sym_10 external "v4_Store"
+    86 Sym_1 codeword "v4___Parenehcontext_Closeparen"
+   155 Sym_29 variable Cell "v4___Parenehflag_Closeparen"
+   101 Sym_2 variable Cell "v4___Parenehhandler_Closeparen"
+    60 Sym_0 codeword "v4___Parenehrestore_Closeparen"
+   120 Sym_15 word "v4___Parenehuncaught_Closeparen"
+   153 Sym_28 external "v4__abort"
+   176 Sym_39 external "v4__clrstackeh"
+   108 Sym_8 external "v4__fp_Fetch"
+   171 Sym_34 external "v4__fp_Store"
+   103 Sym_3 word "v4__getehhandler"
+   126 Sym_19 external "v4__quit"
+   163 Sym_31 external "v4__setstackeh"
+   130 Sym_23 external "v4__type"
+   106 Sym_5 word "v4_catch"
+   132 Sym_24 external "v4_cell_Plus"
+   130 Sym_22 external "v4_cr"
+   151 Sym_27 external "v4_decimal"
+   126 Sym_18 external "v4_drop"
+   121 Sym_16 external "v4_dup"
+   113 Sym_11 external "v4_execute"
+   177 Sym_40 external "v4_false"
+   133 Sym_25 external "v4_hex"
+   128 Sym_21 external "v4_outfile_Minusid"
+   116 Sym_13 external "v4_r_Greater"
+   115 Sym_12 external "v4_rdrop"
+   172 Sym_35 external "v4_rot"
+   111 Sym_9 external "v4_rp_Fetch"
+   168 Sym_33 external "v4_rp_Store"
+   107 Sym_6 external "v4_sp_Fetch"
+   173 Sym_37 external "v4_sp_Store"
+   128 Sym_20 external "v4_stderr"
+   157 Sym_30 word "v4_throw"
+   164 Sym_32 external "v4_true"
+   172 Sym_36 external "v4_z2_Greaterr"
+   174 Sym_38 external "v4_z2r_Greater"
+   117 Sym_14 external "v4_z2rdrop"
+
+Intermediate code:
+    60 function Sym_0 {
+    61   asm (    call v4__dpop@PLT)
+    63   asm (    mov -8(%rax),%rbx)
+    64   asm (    mov (%rax),%rbp)
+    65   asm (    lea 16(%rax),%rsp)
+    66   asm (    mov 8(%rax),%rax)
+    67   asm (    jmp *%rax)
+    69   asm (    forth_pic.=0b-0b)
+    70 }
+
+    86 function Sym_1 {
+    87   asm (    mov (%rbp),%rax)
+    88   asm (    call v4__dpush@PLT)
+    90   asm (    forth_pic.=0b-0b)
+    91 }
+
+   103 function Sym_3 {
+   104   no-op
+           optimizes   Reg_0 = Sym_2
+   104   no-op
+           optimizes   Stack_D = Reg_0
+   104   no-op
+           optimizes   call Sym_4
+   104   Reg_0 = *(Sym_2)
+   104   Stack_D = Reg_0
+   104   no-op
+           optimizes label Label_1
+   104 }
+
+   106 function Sym_5 {
+   107   call Sym_6
+   107   call Sym_7
+   108   call Sym_8
+   108   call Sym_7
+   109   no-op
+           optimizes   Reg_0 = Sym_2
+   109   no-op
+           optimizes   Stack_D = Reg_0
+   109   no-op
+           optimizes   call Sym_4
+   109   Reg_0 = *(Sym_2)
+   109   Stack_D = Reg_0
+   109   call Sym_7
+   110   call Sym_1
+   110   call Sym_7
+   111   call Sym_9
+   111   no-op
+           optimizes   Reg_0 = Sym_2
+   111   no-op
+           optimizes   Stack_D = Reg_0
+   111   no-op
+           optimizes   call Sym_10
+   111   Reg_0 = Stack_D
+   111   *(Sym_2) = Reg_0
+   113   call Sym_11
+   115   call Sym_12
+   116   call Sym_13
+   116   no-op
+           optimizes   Reg_0 = Sym_2
+   116   no-op
+           optimizes   Stack_D = Reg_0
+   116   no-op
+           optimizes   call Sym_10
+   116   Reg_0 = Stack_D
+   116   *(Sym_2) = Reg_0
+   117   call Sym_14
+   118   Reg_0 = 0
+   118   Stack_D = Reg_0
+   118   no-op
+           optimizes label Label_2
+   118 }
+
+   120 function Sym_15 {
+   121   call Sym_16
+   121   Reg_0 = -6
+   121   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   121   no-op
+           optimizes   call Sym_17
+   121   no-op
+           optimizes   Reg_1 = Stack_D
+   121   Reg_0 = Stack_D
+   121   if Reg_0 != Reg_1 goto Label_4
+   121   no-op
+           optimizes   Reg_0 = Stack_D
+   121   no-op
+           optimizes   if Reg_0 == 0 goto Label_4
+   122   Reg_0 = 0
+   122   no-op
+           optimizes   Stack_D = Reg_0
+   122   no-op
+           optimizes   Reg_0 = Sym_2
+   122   no-op
+           optimizes   Stack_D = Reg_0
+   122   no-op
+           optimizes   call Sym_10
+   122   no-op
+           optimizes   Reg_0 = Stack_D
+   122   *(Sym_2) = Reg_0
+   123 label Label_4
+   124   no-op
+           optimizes   Reg_0 = Sym_2
+   124   no-op
+           optimizes   Stack_D = Reg_0
+   124   no-op
+           optimizes   call Sym_4
+   124   Reg_0 = *(Sym_2)
+   124   no-op
+           optimizes   Stack_D = Reg_0
+   124   no-op
+           optimizes   Reg_0 = Stack_D
+   124   if Reg_0 == 0 goto Label_5
+   124   goto Label_3
+   124 label Label_5
+   126   call Sym_16
+   126   Reg_0 = -56
+   126   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   126   no-op
+           optimizes   call Sym_17
+   126   no-op
+           optimizes   Reg_1 = Stack_D
+   126   Reg_0 = Stack_D
+   126   if Reg_0 != Reg_1 goto Label_6
+   126   no-op
+           optimizes   Reg_0 = Stack_D
+   126   no-op
+           optimizes   if Reg_0 == 0 goto Label_6
+   126   call Sym_18
+   126   call Sym_19
+   126 label Label_6
+   128   call Sym_20
+   128   call Sym_21
+   128   call Sym_10
+   130   call Sym_22
+   130   Reg_0 = Data_0
+   130   Stack_D = Reg_0
+   130   Reg_0 = 22
+   130   Stack_D = Reg_0
+   130   call Sym_23
+   131   call Sym_1
+   131   call Sym_4
+   132   no-op
+           optimizes   call Sym_24
+   132   Reg_0 = Stack_D
+   132   Reg_0 += 8
+   132   Stack_D = Reg_0
+   132   call Sym_4
+   133   call Sym_25
+   133   Reg_0 = 0
+   133   Stack_D = Reg_0
+   133   call Sym_26
+   133   Reg_0 = Data_1
+   133   Stack_D = Reg_0
+   133   Reg_0 = 2
+   133   Stack_D = Reg_0
+   133   call Sym_23
+   136   no-op
+           optimizes   Reg_0 = -1
+   136   no-op
+           optimizes   Reg_1 = Reg_0
+   136   no-op
+           optimizes   Reg_1 = Stack_D
+   136   Reg_0 = Stack_D
+   136   Stack_D = Reg_0
+   136   Reg_1 = -10
+   136   if Reg_0 < Reg_1 goto Label_37
+   136   Reg_1 = -4
+   136   if Reg_0 < Reg_1 goto Label_38
+   136   Reg_1 = -2
+   136   if Reg_0 < Reg_1 goto Label_39
+   136   Reg_1 = -2
+   136   if Reg_0 == Reg_1 goto Label_25
+   136   Reg_1 = -1
+   136   if Reg_0 == Reg_1 goto Label_24
+   136   goto Label_20
+   136 label Label_39
+   136   Reg_1 = -4
+   136   if Reg_0 == Reg_1 goto Label_27
+   136   Reg_1 = -3
+   136   if Reg_0 == Reg_1 goto Label_26
+   136   goto Label_20
+   136 label Label_38
+   136   Reg_1 = -10
+   136   if Reg_0 == Reg_1 goto Label_30
+   136   Reg_1 = -6
+   136   if Reg_0 == Reg_1 goto Label_29
+   136   Reg_1 = -5
+   136   if Reg_0 == Reg_1 goto Label_28
+   136   goto Label_20
+   136 label Label_37
+   136   Reg_1 = -44
+   136   if Reg_0 < Reg_1 goto Label_40
+   136   Reg_1 = -44
+   136   if Reg_0 == Reg_1 goto Label_33
+   136   Reg_1 = -42
+   136   if Reg_0 == Reg_1 goto Label_32
+   136   Reg_1 = -24
+   136   if Reg_0 == Reg_1 goto Label_31
+   136   goto Label_20
+   136 label Label_40
+   136   Reg_1 = -2048
+   136   if Reg_0 == Reg_1 goto Label_36
+   136   Reg_1 = -57
+   136   if Reg_0 == Reg_1 goto Label_35
+   136   Reg_1 = -45
+   136   if Reg_0 == Reg_1 goto Label_34
+   136   goto Label_20
+   136 label Label_24
+           optimizes   if Reg_0 != Reg_1 goto Label_8
+   136   Reg_0 = Data_2
+   136   Stack_D = Reg_0
+   136   Reg_0 = 5
+   136   Stack_D = Reg_0
+   136   call Sym_23
+   136   goto Label_7
+   136 label Label_8
+   137   no-op
+           optimizes   Reg_0 = -2
+   137   no-op
+           optimizes   Reg_1 = Reg_0
+   137   no-op
+           optimizes   Reg_1 = Stack_D
+   137   no-op
+           optimizes   Reg_0 = Stack_D
+   137   no-op
+           optimizes   Stack_D = Reg_0
+   137 label Label_25
+           optimizes   if Reg_0 != Reg_1 goto Label_9
+   137   Reg_0 = Data_3
+   137   Stack_D = Reg_0
+   137   Reg_0 = 12
+   137   Stack_D = Reg_0
+   137   call Sym_23
+   137   goto Label_7
+   137 label Label_9
+   138   no-op
+           optimizes   Reg_0 = -3
+   138   no-op
+           optimizes   Reg_1 = Reg_0
+   138   no-op
+           optimizes   Reg_1 = Stack_D
+   138   no-op
+           optimizes   Reg_0 = Stack_D
+   138   no-op
+           optimizes   Stack_D = Reg_0
+   138 label Label_26
+           optimizes   if Reg_0 != Reg_1 goto Label_10
+   138   Reg_0 = Data_4
+   138   Stack_D = Reg_0
+   138   Reg_0 = 14
+   138   Stack_D = Reg_0
+   138   call Sym_23
+   138   goto Label_7
+   138 label Label_10
+   139   no-op
+           optimizes   Reg_0 = -4
+   139   no-op
+           optimizes   Reg_1 = Reg_0
+   139   no-op
+           optimizes   Reg_1 = Stack_D
+   139   no-op
+           optimizes   Reg_0 = Stack_D
+   139   no-op
+           optimizes   Stack_D = Reg_0
+   139 label Label_27
+           optimizes   if Reg_0 != Reg_1 goto Label_11
+   139   Reg_0 = Data_5
+   139   Stack_D = Reg_0
+   139   Reg_0 = 15
+   139   Stack_D = Reg_0
+   139   call Sym_23
+   139   goto Label_7
+   139 label Label_11
+   140   no-op
+           optimizes   Reg_0 = -5
+   140   no-op
+           optimizes   Reg_1 = Reg_0
+   140   no-op
+           optimizes   Reg_1 = Stack_D
+   140   no-op
+           optimizes   Reg_0 = Stack_D
+   140   no-op
+           optimizes   Stack_D = Reg_0
+   140 label Label_28
+           optimizes   if Reg_0 != Reg_1 goto Label_12
+   140   Reg_0 = Data_6
+   140   Stack_D = Reg_0
+   140   Reg_0 = 21
+   140   Stack_D = Reg_0
+   140   call Sym_23
+   140   goto Label_7
+   140 label Label_12
+   141   no-op
+           optimizes   Reg_0 = -6
+   141   no-op
+           optimizes   Reg_1 = Reg_0
+   141   no-op
+           optimizes   Reg_1 = Stack_D
+   141   no-op
+           optimizes   Reg_0 = Stack_D
+   141   no-op
+           optimizes   Stack_D = Reg_0
+   141 label Label_29
+           optimizes   if Reg_0 != Reg_1 goto Label_13
+   141   Reg_0 = Data_7
+   141   Stack_D = Reg_0
+   141   Reg_0 = 36
+   141   Stack_D = Reg_0
+   141   call Sym_23
+   141   goto Label_7
+   141 label Label_13
+   142   no-op
+           optimizes   Reg_0 = -10
+   142   no-op
+           optimizes   Reg_1 = Reg_0
+   142   no-op
+           optimizes   Reg_1 = Stack_D
+   142   no-op
+           optimizes   Reg_0 = Stack_D
+   142   no-op
+           optimizes   Stack_D = Reg_0
+   142 label Label_30
+           optimizes   if Reg_0 != Reg_1 goto Label_14
+   142   Reg_0 = Data_8
+   142   Stack_D = Reg_0
+   142   Reg_0 = 16
+   142   Stack_D = Reg_0
+   142   call Sym_23
+   142   goto Label_7
+   142 label Label_14
+   143   no-op
+           optimizes   Reg_0 = -24
+   143   no-op
+           optimizes   Reg_1 = Reg_0
+   143   no-op
+           optimizes   Reg_1 = Stack_D
+   143   no-op
+           optimizes   Reg_0 = Stack_D
+   143   no-op
+           optimizes   Stack_D = Reg_0
+   143 label Label_31
+           optimizes   if Reg_0 != Reg_1 goto Label_15
+   143   Reg_0 = Data_9
+   143   Stack_D = Reg_0
+   143   Reg_0 = 24
+   143   Stack_D = Reg_0
+   143   call Sym_23
+   143   goto Label_7
+   143 label Label_15
+   144   no-op
+           optimizes   Reg_0 = -42
+   144   no-op
+           optimizes   Reg_1 = Reg_0
+   144   no-op
+           optimizes   Reg_1 = Stack_D
+   144   no-op
+           optimizes   Reg_0 = Stack_D
+   144   no-op
+           optimizes   Stack_D = Reg_0
+   144 label Label_32
+           optimizes   if Reg_0 != Reg_1 goto Label_16
+   144   Reg_0 = Data_10
+   144   Stack_D = Reg_0
+   144   Reg_0 = 29
+   144   Stack_D = Reg_0
+   144   call Sym_23
+   144   goto Label_7
+   144 label Label_16
+   145   no-op
+           optimizes   Reg_0 = -44
+   145   no-op
+           optimizes   Reg_1 = Reg_0
+   145   no-op
+           optimizes   Reg_1 = Stack_D
+   145   no-op
+           optimizes   Reg_0 = Stack_D
+   145   no-op
+           optimizes   Stack_D = Reg_0
+   145 label Label_33
+           optimizes   if Reg_0 != Reg_1 goto Label_17
+   145   Reg_0 = Data_11
+   145   Stack_D = Reg_0
+   145   Reg_0 = 29
+   145   Stack_D = Reg_0
+   145   call Sym_23
+   145   goto Label_7
+   145 label Label_17
+   146   no-op
+           optimizes   Reg_0 = -45
+   146   no-op
+           optimizes   Reg_1 = Reg_0
+   146   no-op
+           optimizes   Reg_1 = Stack_D
+   146   no-op
+           optimizes   Reg_0 = Stack_D
+   146   no-op
+           optimizes   Stack_D = Reg_0
+   146 label Label_34
+           optimizes   if Reg_0 != Reg_1 goto Label_18
+   146   Reg_0 = Data_12
+   146   Stack_D = Reg_0
+   146   Reg_0 = 30
+   146   Stack_D = Reg_0
+   146   call Sym_23
+   146   goto Label_7
+   146 label Label_18
+   147   no-op
+           optimizes   Reg_0 = -57
+   147   no-op
+           optimizes   Reg_1 = Reg_0
+   147   no-op
+           optimizes   Reg_1 = Stack_D
+   147   no-op
+           optimizes   Reg_0 = Stack_D
+   147   no-op
+           optimizes   Stack_D = Reg_0
+   147 label Label_35
+           optimizes   if Reg_0 != Reg_1 goto Label_19
+   147   Reg_0 = Data_13
+   147   Stack_D = Reg_0
+   147   Reg_0 = 9
+   147   Stack_D = Reg_0
+   147   call Sym_23
+   147   goto Label_7
+   147 label Label_19
+   148   no-op
+           optimizes   Reg_0 = -2048
+   148   no-op
+           optimizes   Reg_1 = Reg_0
+   148   no-op
+           optimizes   Reg_1 = Stack_D
+   148   no-op
+           optimizes   Reg_0 = Stack_D
+   148   no-op
+           optimizes   Stack_D = Reg_0
+   148 label Label_36
+           optimizes   if Reg_0 != Reg_1 goto Label_20
+   148   Reg_0 = Data_14
+   148   Stack_D = Reg_0
+   148   Reg_0 = 13
+   148   Stack_D = Reg_0
+   148   call Sym_23
+   148   goto Label_7
+   148 label Label_20
+   150   Reg_0 = Data_15
+   150   Stack_D = Reg_0
+   150   Reg_0 = 15
+   150   Stack_D = Reg_0
+   150   call Sym_23
+   151   call Sym_27
+   151   call Sym_16
+   151   Reg_0 = 0
+   151   Stack_D = Reg_0
+   151   call Sym_26
+   153 label Label_7
+   153   Reg_0 = Stack_D
+   153   call Sym_22
+   153   tail call Sym_28
+           optimizes   call Sym_28
+   153 label Label_3
+   153 }
+
+   157 function Sym_30 {
+   158   call Sym_16
+   158   Reg_0 = Stack_D
+   158   if Reg_0 == 0 goto Label_22
+   159   no-op
+           optimizes   Reg_0 = Sym_29
+   159   no-op
+           optimizes   Stack_D = Reg_0
+   159   no-op
+           optimizes   call Sym_4
+   159   Reg_0 = *(Sym_29)
+   159   no-op
+           optimizes   Stack_D = Reg_0
+   159   no-op
+           optimizes   Reg_0 = Stack_D
+   159   if Reg_0 == 0 goto Label_23
+   160   call Sym_22
+   160   Reg_0 = Data_16
+   160   Stack_D = Reg_0
+   160   Reg_0 = 46
+   160   Stack_D = Reg_0
+   160   call Sym_23
+   161   call Sym_22
+   161   call Sym_28
+   162 label Label_23
+   163   call Sym_31
+   164   no-op
+           optimizes   call Sym_32
+   164   Reg_0 = -1
+   164   no-op
+           optimizes   Stack_D = Reg_0
+   164   no-op
+           optimizes   Reg_0 = Sym_29
+   164   no-op
+           optimizes   Stack_D = Reg_0
+   164   no-op
+           optimizes   call Sym_10
+   164   no-op
+           optimizes   Reg_0 = Stack_D
+   164   *(Sym_29) = Reg_0
+   166   call Sym_15
+   168   no-op
+           optimizes   Reg_0 = Sym_2
+   168   no-op
+           optimizes   Stack_D = Reg_0
+   168   no-op
+           optimizes   call Sym_4
+   168   Reg_0 = *(Sym_2)
+   168   Stack_D = Reg_0
+   168   call Sym_33
+   169   call Sym_13
+   170   call Sym_13
+   170   no-op
+           optimizes   Reg_0 = Sym_2
+   170   no-op
+           optimizes   Stack_D = Reg_0
+   170   no-op
+           optimizes   call Sym_10
+   170   Reg_0 = Stack_D
+   170   *(Sym_2) = Reg_0
+   171   call Sym_13
+   171   call Sym_34
+   172   call Sym_13
+   172   call Sym_35
+   172   call Sym_35
+   172   call Sym_36
+   173   call Sym_37
+   173   call Sym_18
+   174   call Sym_38
+   176   call Sym_39
+   177   no-op
+           optimizes   call Sym_40
+   177   Reg_0 = 0
+   177   no-op
+           optimizes   Stack_D = Reg_0
+   177   no-op
+           optimizes   Reg_0 = Sym_29
+   177   no-op
+           optimizes   Stack_D = Reg_0
+   177   no-op
+           optimizes   call Sym_10
+   177   no-op
+           optimizes   Reg_0 = Stack_D
+   177   *(Sym_29) = Reg_0
+   179   tail call Sym_0
+           optimizes   call Sym_0
+   180   no-op
+           optimizes   goto Label_24
+   180 label Label_22
+   180   tail call Sym_18
+           optimizes   call Sym_18
+   180   no-op
+           optimizes label Label_24
+   180   no-op
+           optimizes label Label_21
+   180 }
+
@@ -0,0 +1,829 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: extsyscl.ft
+Compiled: Sat Oct 17 10:15:10 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+    30 Sym_4 word "v4__acct"
+    53 Sym_27 word "v4__adjtimex"
+    60 Sym_34 word "v4__bdflush"
+    81 Sym_55 word "v4__capget"
+    82 Sym_56 word "v4__capset"
+    55 Sym_29 word "v4__create_module"
+    57 Sym_31 word "v4__delete_module"
+    63 Sym_37 word "v4__fdatasync"
+    87 Sym_61 word "v4__fstat64"
+    46 Sym_20 word "v4__fstatfs"
+    84 Sym_58 word "v4__ftruncate64"
+    58 Sym_32 word "v4__get_kernel_syms"
+    40 Sym_14 word "v4__getgroups16"
+    37 Sym_11 word "v4__getrusage"
+    62 Sym_36 word "v4__getsid"
+    38 Sym_12 word "v4__gettimeofday"
+    56 Sym_30 word "v4__init_module"
+    47 Sym_21 word "v4__ioperm"
+    48 Sym_22 word "v4__iopl"
+    86 Sym_60 word "v4__lstat64"
+    92 Sym_64 word "v4__madvise"
+    91 Sym_63 word "v4__mincore"
+    65 Sym_39 word "v4__mlock"
+    67 Sym_41 word "v4__mlockall"
+    52 Sym_26 word "v4__modify_ldt"
+    54 Sym_28 word "v4__mprotect"
+    66 Sym_40 word "v4__munlock"
+    68 Sym_42 word "v4__munlockall"
+    79 Sym_53 word "v4__nfsservctl"
+    90 Sym_62 word "v4__pivot_root"
+    28 Sym_2 external "v4__post_syscall"
+    80 Sym_54 word "v4__prctl"
+    28 Sym_0 word "v4__ptrace"
+    78 Sym_52 word "v4__query_module"
+    59 Sym_33 word "v4__quotactl"
+    44 Sym_18 word "v4__reboot"
+    74 Sym_48 word "v4__sched_get_priority_max"
+    75 Sym_49 word "v4__sched_get_priority_min"
+    70 Sym_44 word "v4__sched_getparam"
+    72 Sym_46 word "v4__sched_getscheduler"
+    76 Sym_50 word "v4__sched_rr_get_interval"
+    69 Sym_43 word "v4__sched_setparam"
+    71 Sym_45 word "v4__sched_setscheduler"
+    73 Sym_47 word "v4__sched_yield"
+    51 Sym_25 word "v4__setdomainname"
+    41 Sym_15 word "v4__setgroups16"
+    35 Sym_9 word "v4__sethostname"
+    36 Sym_10 word "v4__setrlimit"
+    39 Sym_13 word "v4__settimeofday"
+    33 Sym_7 word "v4__sgetmask"
+    34 Sym_8 word "v4__ssetmask"
+    85 Sym_59 word "v4__stat64"
+    45 Sym_19 word "v4__statfs"
+    50 Sym_24 word "v4__swapoff"
+    43 Sym_17 word "v4__swapon"
+    29 Sym_3 word "v4__sync"
+    28 Sym_1 external "v4__syscall"
+    64 Sym_38 word "v4__sysctl"
+    61 Sym_35 word "v4__sysfs"
+    83 Sym_57 word "v4__truncate64"
+    31 Sym_5 word "v4__umount"
+    42 Sym_16 word "v4__uselib"
+    32 Sym_6 word "v4__ustat"
+    49 Sym_23 word "v4__vhangup"
+    77 Sym_51 word "v4__vm86"
+
+Intermediate code:
+    28 function Sym_0 {
+    28   Reg_0 = 26
+    28   Stack_D = Reg_0
+    28   Reg_0 = 4
+    28   Stack_D = Reg_0
+    28   call Sym_1
+    28   tail call Sym_2
+           optimizes   call Sym_2
+    28   no-op
+           optimizes label Label_1
+    28 }
+
+    29 function Sym_3 {
+    29   Reg_0 = 36
+    29   Stack_D = Reg_0
+    29   Reg_0 = 0
+    29   Stack_D = Reg_0
+    29   call Sym_1
+    29   tail call Sym_2
+           optimizes   call Sym_2
+    29   no-op
+           optimizes label Label_2
+    29 }
+
+    30 function Sym_4 {
+    30   Reg_0 = 51
+    30   Stack_D = Reg_0
+    30   Reg_0 = 0
+    30   Stack_D = Reg_0
+    30   call Sym_1
+    30   tail call Sym_2
+           optimizes   call Sym_2
+    30   no-op
+           optimizes label Label_3
+    30 }
+
+    31 function Sym_5 {
+    31   Reg_0 = 52
+    31   Stack_D = Reg_0
+    31   Reg_0 = 0
+    31   Stack_D = Reg_0
+    31   call Sym_1
+    31   tail call Sym_2
+           optimizes   call Sym_2
+    31   no-op
+           optimizes label Label_4
+    31 }
+
+    32 function Sym_6 {
+    32   Reg_0 = 62
+    32   Stack_D = Reg_0
+    32   Reg_0 = 0
+    32   Stack_D = Reg_0
+    32   call Sym_1
+    32   tail call Sym_2
+           optimizes   call Sym_2
+    32   no-op
+           optimizes label Label_5
+    32 }
+
+    33 function Sym_7 {
+    33   Reg_0 = 68
+    33   Stack_D = Reg_0
+    33   Reg_0 = 0
+    33   Stack_D = Reg_0
+    33   call Sym_1
+    33   tail call Sym_2
+           optimizes   call Sym_2
+    33   no-op
+           optimizes label Label_6
+    33 }
+
+    34 function Sym_8 {
+    34   Reg_0 = 69
+    34   Stack_D = Reg_0
+    34   Reg_0 = 1
+    34   Stack_D = Reg_0
+    34   call Sym_1
+    34   tail call Sym_2
+           optimizes   call Sym_2
+    34   no-op
+           optimizes label Label_7
+    34 }
+
+    35 function Sym_9 {
+    35   Reg_0 = 74
+    35   Stack_D = Reg_0
+    35   Reg_0 = 2
+    35   Stack_D = Reg_0
+    35   call Sym_1
+    35   tail call Sym_2
+           optimizes   call Sym_2
+    35   no-op
+           optimizes label Label_8
+    35 }
+
+    36 function Sym_10 {
+    36   Reg_0 = 75
+    36   Stack_D = Reg_0
+    36   Reg_0 = 2
+    36   Stack_D = Reg_0
+    36   call Sym_1
+    36   tail call Sym_2
+           optimizes   call Sym_2
+    36   no-op
+           optimizes label Label_9
+    36 }
+
+    37 function Sym_11 {
+    37   Reg_0 = 77
+    37   Stack_D = Reg_0
+    37   Reg_0 = 2
+    37   Stack_D = Reg_0
+    37   call Sym_1
+    37   tail call Sym_2
+           optimizes   call Sym_2
+    37   no-op
+           optimizes label Label_10
+    37 }
+
+    38 function Sym_12 {
+    38   Reg_0 = 78
+    38   Stack_D = Reg_0
+    38   Reg_0 = 2
+    38   Stack_D = Reg_0
+    38   call Sym_1
+    38   tail call Sym_2
+           optimizes   call Sym_2
+    38   no-op
+           optimizes label Label_11
+    38 }
+
+    39 function Sym_13 {
+    39   Reg_0 = 79
+    39   Stack_D = Reg_0
+    39   Reg_0 = 2
+    39   Stack_D = Reg_0
+    39   call Sym_1
+    39   tail call Sym_2
+           optimizes   call Sym_2
+    39   no-op
+           optimizes label Label_12
+    39 }
+
+    40 function Sym_14 {
+    40   Reg_0 = 80
+    40   Stack_D = Reg_0
+    40   Reg_0 = 2
+    40   Stack_D = Reg_0
+    40   call Sym_1
+    40   tail call Sym_2
+           optimizes   call Sym_2
+    40   no-op
+           optimizes label Label_13
+    40 }
+
+    41 function Sym_15 {
+    41   Reg_0 = 81
+    41   Stack_D = Reg_0
+    41   Reg_0 = 2
+    41   Stack_D = Reg_0
+    41   call Sym_1
+    41   tail call Sym_2
+           optimizes   call Sym_2
+    41   no-op
+           optimizes label Label_14
+    41 }
+
+    42 function Sym_16 {
+    42   Reg_0 = 86
+    42   Stack_D = Reg_0
+    42   Reg_0 = 1
+    42   Stack_D = Reg_0
+    42   call Sym_1
+    42   tail call Sym_2
+           optimizes   call Sym_2
+    42   no-op
+           optimizes label Label_15
+    42 }
+
+    43 function Sym_17 {
+    43   Reg_0 = 87
+    43   Stack_D = Reg_0
+    43   Reg_0 = 1
+    43   Stack_D = Reg_0
+    43   call Sym_1
+    43   tail call Sym_2
+           optimizes   call Sym_2
+    43   no-op
+           optimizes label Label_16
+    43 }
+
+    44 function Sym_18 {
+    44   Reg_0 = 88
+    44   Stack_D = Reg_0
+    44   Reg_0 = 3
+    44   Stack_D = Reg_0
+    44   call Sym_1
+    44   tail call Sym_2
+           optimizes   call Sym_2
+    44   no-op
+           optimizes label Label_17
+    44 }
+
+    45 function Sym_19 {
+    45   Reg_0 = 99
+    45   Stack_D = Reg_0
+    45   Reg_0 = 2
+    45   Stack_D = Reg_0
+    45   call Sym_1
+    45   tail call Sym_2
+           optimizes   call Sym_2
+    45   no-op
+           optimizes label Label_18
+    45 }
+
+    46 function Sym_20 {
+    46   Reg_0 = 100
+    46   Stack_D = Reg_0
+    46   Reg_0 = 2
+    46   Stack_D = Reg_0
+    46   call Sym_1
+    46   tail call Sym_2
+           optimizes   call Sym_2
+    46   no-op
+           optimizes label Label_19
+    46 }
+
+    47 function Sym_21 {
+    47   Reg_0 = 101
+    47   Stack_D = Reg_0
+    47   Reg_0 = 3
+    47   Stack_D = Reg_0
+    47   call Sym_1
+    47   tail call Sym_2
+           optimizes   call Sym_2
+    47   no-op
+           optimizes label Label_20
+    47 }
+
+    48 function Sym_22 {
+    48   Reg_0 = 110
+    48   Stack_D = Reg_0
+    48   Reg_0 = 1
+    48   Stack_D = Reg_0
+    48   call Sym_1
+    48   tail call Sym_2
+           optimizes   call Sym_2
+    48   no-op
+           optimizes label Label_21
+    48 }
+
+    49 function Sym_23 {
+    49   Reg_0 = 111
+    49   Stack_D = Reg_0
+    49   Reg_0 = 0
+    49   Stack_D = Reg_0
+    49   call Sym_1
+    49   tail call Sym_2
+           optimizes   call Sym_2
+    49   no-op
+           optimizes label Label_22
+    49 }
+
+    50 function Sym_24 {
+    50   Reg_0 = 115
+    50   Stack_D = Reg_0
+    50   Reg_0 = 1
+    50   Stack_D = Reg_0
+    50   call Sym_1
+    50   tail call Sym_2
+           optimizes   call Sym_2
+    50   no-op
+           optimizes label Label_23
+    50 }
+
+    51 function Sym_25 {
+    51   Reg_0 = 121
+    51   Stack_D = Reg_0
+    51   Reg_0 = 1
+    51   Stack_D = Reg_0
+    51   call Sym_1
+    51   tail call Sym_2
+           optimizes   call Sym_2
+    51   no-op
+           optimizes label Label_24
+    51 }
+
+    52 function Sym_26 {
+    52   Reg_0 = 123
+    52   Stack_D = Reg_0
+    52   Reg_0 = 0
+    52   Stack_D = Reg_0
+    52   call Sym_1
+    52   tail call Sym_2
+           optimizes   call Sym_2
+    52   no-op
+           optimizes label Label_25
+    52 }
+
+    53 function Sym_27 {
+    53   Reg_0 = 124
+    53   Stack_D = Reg_0
+    53   Reg_0 = 0
+    53   Stack_D = Reg_0
+    53   call Sym_1
+    53   tail call Sym_2
+           optimizes   call Sym_2
+    53   no-op
+           optimizes label Label_26
+    53 }
+
+    54 function Sym_28 {
+    54   Reg_0 = 125
+    54   Stack_D = Reg_0
+    54   Reg_0 = 3
+    54   Stack_D = Reg_0
+    54   call Sym_1
+    54   tail call Sym_2
+           optimizes   call Sym_2
+    54   no-op
+           optimizes label Label_27
+    54 }
+
+    55 function Sym_29 {
+    55   Reg_0 = 127
+    55   Stack_D = Reg_0
+    55   Reg_0 = 0
+    55   Stack_D = Reg_0
+    55   call Sym_1
+    55   tail call Sym_2
+           optimizes   call Sym_2
+    55   no-op
+           optimizes label Label_28
+    55 }
+
+    56 function Sym_30 {
+    56   Reg_0 = 128
+    56   Stack_D = Reg_0
+    56   Reg_0 = 0
+    56   Stack_D = Reg_0
+    56   call Sym_1
+    56   tail call Sym_2
+           optimizes   call Sym_2
+    56   no-op
+           optimizes label Label_29
+    56 }
+
+    57 function Sym_31 {
+    57   Reg_0 = 129
+    57   Stack_D = Reg_0
+    57   Reg_0 = 0
+    57   Stack_D = Reg_0
+    57   call Sym_1
+    57   tail call Sym_2
+           optimizes   call Sym_2
+    57   no-op
+           optimizes label Label_30
+    57 }
+
+    58 function Sym_32 {
+    58   Reg_0 = 130
+    58   Stack_D = Reg_0
+    58   Reg_0 = 0
+    58   Stack_D = Reg_0
+    58   call Sym_1
+    58   tail call Sym_2
+           optimizes   call Sym_2
+    58   no-op
+           optimizes label Label_31
+    58 }
+
+    59 function Sym_33 {
+    59   Reg_0 = 131
+    59   Stack_D = Reg_0
+    59   Reg_0 = 4
+    59   Stack_D = Reg_0
+    59   call Sym_1
+    59   tail call Sym_2
+           optimizes   call Sym_2
+    59   no-op
+           optimizes label Label_32
+    59 }
+
+    60 function Sym_34 {
+    60   Reg_0 = 134
+    60   Stack_D = Reg_0
+    60   Reg_0 = 0
+    60   Stack_D = Reg_0
+    60   call Sym_1
+    60   tail call Sym_2
+           optimizes   call Sym_2
+    60   no-op
+           optimizes label Label_33
+    60 }
+
+    61 function Sym_35 {
+    61   Reg_0 = 135
+    61   Stack_D = Reg_0
+    61   Reg_0 = 1
+    61   Stack_D = Reg_0
+    61   call Sym_1
+    61   tail call Sym_2
+           optimizes   call Sym_2
+    61   no-op
+           optimizes label Label_34
+    61 }
+
+    62 function Sym_36 {
+    62   Reg_0 = 147
+    62   Stack_D = Reg_0
+    62   Reg_0 = 1
+    62   Stack_D = Reg_0
+    62   call Sym_1
+    62   tail call Sym_2
+           optimizes   call Sym_2
+    62   no-op
+           optimizes label Label_35
+    62 }
+
+    63 function Sym_37 {
+    63   Reg_0 = 148
+    63   Stack_D = Reg_0
+    63   Reg_0 = 1
+    63   Stack_D = Reg_0
+    63   call Sym_1
+    63   tail call Sym_2
+           optimizes   call Sym_2
+    63   no-op
+           optimizes label Label_36
+    63 }
+
+    64 function Sym_38 {
+    64   Reg_0 = 149
+    64   Stack_D = Reg_0
+    64   Reg_0 = 1
+    64   Stack_D = Reg_0
+    64   call Sym_1
+    64   tail call Sym_2
+           optimizes   call Sym_2
+    64   no-op
+           optimizes label Label_37
+    64 }
+
+    65 function Sym_39 {
+    65   Reg_0 = 150
+    65   Stack_D = Reg_0
+    65   Reg_0 = 2
+    65   Stack_D = Reg_0
+    65   call Sym_1
+    65   tail call Sym_2
+           optimizes   call Sym_2
+    65   no-op
+           optimizes label Label_38
+    65 }
+
+    66 function Sym_40 {
+    66   Reg_0 = 151
+    66   Stack_D = Reg_0
+    66   Reg_0 = 2
+    66   Stack_D = Reg_0
+    66   call Sym_1
+    66   tail call Sym_2
+           optimizes   call Sym_2
+    66   no-op
+           optimizes label Label_39
+    66 }
+
+    67 function Sym_41 {
+    67   Reg_0 = 152
+    67   Stack_D = Reg_0
+    67   Reg_0 = 1
+    67   Stack_D = Reg_0
+    67   call Sym_1
+    67   tail call Sym_2
+           optimizes   call Sym_2
+    67   no-op
+           optimizes label Label_40
+    67 }
+
+    68 function Sym_42 {
+    68   Reg_0 = 153
+    68   Stack_D = Reg_0
+    68   Reg_0 = 0
+    68   Stack_D = Reg_0
+    68   call Sym_1
+    68   tail call Sym_2
+           optimizes   call Sym_2
+    68   no-op
+           optimizes label Label_41
+    68 }
+
+    69 function Sym_43 {
+    69   Reg_0 = 154
+    69   Stack_D = Reg_0
+    69   Reg_0 = 2
+    69   Stack_D = Reg_0
+    69   call Sym_1
+    69   tail call Sym_2
+           optimizes   call Sym_2
+    69   no-op
+           optimizes label Label_42
+    69 }
+
+    70 function Sym_44 {
+    70   Reg_0 = 155
+    70   Stack_D = Reg_0
+    70   Reg_0 = 2
+    70   Stack_D = Reg_0
+    70   call Sym_1
+    70   tail call Sym_2
+           optimizes   call Sym_2
+    70   no-op
+           optimizes label Label_43
+    70 }
+
+    71 function Sym_45 {
+    71   Reg_0 = 156
+    71   Stack_D = Reg_0
+    71   Reg_0 = 3
+    71   Stack_D = Reg_0
+    71   call Sym_1
+    71   tail call Sym_2
+           optimizes   call Sym_2
+    71   no-op
+           optimizes label Label_44
+    71 }
+
+    72 function Sym_46 {
+    72   Reg_0 = 157
+    72   Stack_D = Reg_0
+    72   Reg_0 = 1
+    72   Stack_D = Reg_0
+    72   call Sym_1
+    72   tail call Sym_2
+           optimizes   call Sym_2
+    72   no-op
+           optimizes label Label_45
+    72 }
+
+    73 function Sym_47 {
+    73   Reg_0 = 158
+    73   Stack_D = Reg_0
+    73   Reg_0 = 0
+    73   Stack_D = Reg_0
+    73   call Sym_1
+    73   tail call Sym_2
+           optimizes   call Sym_2
+    73   no-op
+           optimizes label Label_46
+    73 }
+
+    74 function Sym_48 {
+    74   Reg_0 = 159
+    74   Stack_D = Reg_0
+    74   Reg_0 = 1
+    74   Stack_D = Reg_0
+    74   call Sym_1
+    74   tail call Sym_2
+           optimizes   call Sym_2
+    74   no-op
+           optimizes label Label_47
+    74 }
+
+    75 function Sym_49 {
+    75   Reg_0 = 160
+    75   Stack_D = Reg_0
+    75   Reg_0 = 1
+    75   Stack_D = Reg_0
+    75   call Sym_1
+    75   tail call Sym_2
+           optimizes   call Sym_2
+    75   no-op
+           optimizes label Label_48
+    75 }
+
+    76 function Sym_50 {
+    76   Reg_0 = 161
+    76   Stack_D = Reg_0
+    76   Reg_0 = 2
+    76   Stack_D = Reg_0
+    76   call Sym_1
+    76   tail call Sym_2
+           optimizes   call Sym_2
+    76   no-op
+           optimizes label Label_49
+    76 }
+
+    77 function Sym_51 {
+    77   Reg_0 = 166
+    77   Stack_D = Reg_0
+    77   Reg_0 = 2
+    77   Stack_D = Reg_0
+    77   call Sym_1
+    77   tail call Sym_2
+           optimizes   call Sym_2
+    77   no-op
+           optimizes label Label_50
+    77 }
+
+    78 function Sym_52 {
+    78   Reg_0 = 167
+    78   Stack_D = Reg_0
+    78   Reg_0 = 5
+    78   Stack_D = Reg_0
+    78   call Sym_1
+    78   tail call Sym_2
+           optimizes   call Sym_2
+    78   no-op
+           optimizes label Label_51
+    78 }
+
+    79 function Sym_53 {
+    79   Reg_0 = 169
+    79   Stack_D = Reg_0
+    79   Reg_0 = 3
+    79   Stack_D = Reg_0
+    79   call Sym_1
+    79   tail call Sym_2
+           optimizes   call Sym_2
+    79   no-op
+           optimizes label Label_52
+    79 }
+
+    80 function Sym_54 {
+    80   Reg_0 = 172
+    80   Stack_D = Reg_0
+    80   Reg_0 = 5
+    80   Stack_D = Reg_0
+    80   call Sym_1
+    80   tail call Sym_2
+           optimizes   call Sym_2
+    80   no-op
+           optimizes label Label_53
+    80 }
+
+    81 function Sym_55 {
+    81   Reg_0 = 184
+    81   Stack_D = Reg_0
+    81   Reg_0 = 2
+    81   Stack_D = Reg_0
+    81   call Sym_1
+    81   tail call Sym_2
+           optimizes   call Sym_2
+    81   no-op
+           optimizes label Label_54
+    81 }
+
+    82 function Sym_56 {
+    82   Reg_0 = 185
+    82   Stack_D = Reg_0
+    82   Reg_0 = 2
+    82   Stack_D = Reg_0
+    82   call Sym_1
+    82   tail call Sym_2
+           optimizes   call Sym_2
+    82   no-op
+           optimizes label Label_55
+    82 }
+
+    83 function Sym_57 {
+    83   Reg_0 = 193
+    83   Stack_D = Reg_0
+    83   Reg_0 = 3
+    83   Stack_D = Reg_0
+    83   call Sym_1
+    83   tail call Sym_2
+           optimizes   call Sym_2
+    83   no-op
+           optimizes label Label_56
+    83 }
+
+    84 function Sym_58 {
+    84   Reg_0 = 194
+    84   Stack_D = Reg_0
+    84   Reg_0 = 3
+    84   Stack_D = Reg_0
+    84   call Sym_1
+    84   tail call Sym_2
+           optimizes   call Sym_2
+    84   no-op
+           optimizes label Label_57
+    84 }
+
+    85 function Sym_59 {
+    85   Reg_0 = 195
+    85   Stack_D = Reg_0
+    85   Reg_0 = 2
+    85   Stack_D = Reg_0
+    85   call Sym_1
+    85   tail call Sym_2
+           optimizes   call Sym_2
+    85   no-op
+           optimizes label Label_58
+    85 }
+
+    86 function Sym_60 {
+    86   Reg_0 = 196
+    86   Stack_D = Reg_0
+    86   Reg_0 = 2
+    86   Stack_D = Reg_0
+    86   call Sym_1
+    86   tail call Sym_2
+           optimizes   call Sym_2
+    86   no-op
+           optimizes label Label_59
+    86 }
+
+    87 function Sym_61 {
+    87   Reg_0 = 197
+    87   Stack_D = Reg_0
+    87   Reg_0 = 2
+    87   Stack_D = Reg_0
+    87   call Sym_1
+    87   tail call Sym_2
+           optimizes   call Sym_2
+    87   no-op
+           optimizes label Label_60
+    87 }
+
+    90 function Sym_62 {
+    90   Reg_0 = 217
+    90   Stack_D = Reg_0
+    90   Reg_0 = 2
+    90   Stack_D = Reg_0
+    90   call Sym_1
+    90   tail call Sym_2
+           optimizes   call Sym_2
+    90   no-op
+           optimizes label Label_61
+    90 }
+
+    91 function Sym_63 {
+    91   Reg_0 = 218
+    91   Stack_D = Reg_0
+    91   Reg_0 = 3
+    91   Stack_D = Reg_0
+    91   call Sym_1
+    91   tail call Sym_2
+           optimizes   call Sym_2
+    91   no-op
+           optimizes label Label_62
+    91 }
+
+    92 function Sym_64 {
+    92   Reg_0 = 219
+    92   Stack_D = Reg_0
+    92   Reg_0 = 3
+    92   Stack_D = Reg_0
+    92   call Sym_1
+    92   tail call Sym_2
+           optimizes   call Sym_2
+    92   no-op
+           optimizes label Label_63
+    92 }
+
@@ -0,0 +1,1278 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: float.ft
+Compiled: Sat Oct 17 10:15:10 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+   558 Sym_53 external "v4_Equals"
+   309 Sym_19 external "v4_Fetch"
+   314 Sym_24 external "v4_Greater"
+   211 Sym_14 codeword "v4_Greaterf"
+   313 Sym_22 external "v4_Less"
+   209 Sym_13 external "v4_Minus"
+   208 Sym_11 external "v4_Plus"
+   207 Sym_9 external "v4_Star"
+   321 Sym_29 external "v4_Store"
+   645 Sym_67 codeword "v4___Parenf2xm1_Closeparen"
+   403 Sym_41 codeword "v4___Parenf_Greater_Closeparen"
+   511 Sym_46 codeword "v4___Parenf_Slash_Closeparen"
+   633 Sym_63 word "v4___Parenflog2_Closeparen"
+   652 Sym_68 codeword "v4___Parenfscale_Closeparen"
+   608 Sym_62 codeword "v4___Parenfyl2x_Closeparen"
+   176 Sym_6 codeword "v4__fcheck"
+    36 Sym_1 variable Cell "v4__finit"
+   308 Sym_18 word "v4__fp_Fetch"
+   311 Sym_20 word "v4__fp_Store"
+   129 Sym_5 codeword "v4__fpop"
+    59 Sym_3 codeword "v4__fpuinit"
+    85 Sym_4 codeword "v4__fpush"
+    35 Sym_0 variable Cell "v4__fsindex"
+    37 Sym_2 variable Cell "v4__fstemp"
+   342 Sym_38 external "v4_aligned"
+   275 Sym_17 codeword "v4_d_Greaterf"
+   313 Sym_23 external "v4_drop"
+   333 Sym_34 external "v4_dup"
+   374 Sym_40 codeword "v4_f0_Equals"
+   345 Sym_39 codeword "v4_f0_Less"
+   323 Sym_30 word "v4_f_Fetch"
+   218 Sym_15 codeword "v4_f_Greater"
+   226 Sym_16 codeword "v4_f_Greaterd"
+   441 Sym_42 word "v4_f_Less"
+   467 Sym_44 codeword "v4_f_Minus"
+   445 Sym_43 codeword "v4_f_Plus"
+   532 Sym_47 word "v4_f_Slash"
+   489 Sym_45 codeword "v4_f_Star"
+   661 Sym_69 word "v4_f_Star_Star"
+   320 Sym_27 word "v4_f_Store"
+   556 Sym_52 word "v4_f_Tilde"
+   535 Sym_49 codeword "v4_fabs"
+   341 Sym_37 word "v4_faligned"
+   675 Sym_72 word "v4_falog"
+   590 Sym_59 codeword "v4_fcos"
+   317 Sym_26 word "v4_fdepth"
+   326 Sym_31 word "v4_fdrop"
+   332 Sym_33 word "v4_fdup"
+   669 Sym_70 word "v4_fexp"
+   672 Sym_71 word "v4_fexpm1"
+   692 Sym_80 word "v4_fliteral"
+   636 Sym_64 word "v4_fln"
+   639 Sym_65 word "v4_flnp1"
+   205 Sym_7 word "v4_float"
+   209 Sym_12 word "v4_float_Minus"
+   208 Sym_10 word "v4_float_Plus"
+   207 Sym_8 word "v4_floats"
+   642 Sym_66 word "v4_flog"
+   570 Sym_55 word "v4_fmax"
+   573 Sym_56 word "v4_fmin"
+   549 Sym_51 codeword "v4_fnegate"
+   335 Sym_35 word "v4_fover"
+   338 Sym_36 word "v4_frot"
+   542 Sym_50 codeword "v4_fround"
+   583 Sym_58 codeword "v4_fsin"
+   597 Sym_60 codeword "v4_fsincos"
+   576 Sym_57 codeword "v4_fsqrt"
+   329 Sym_32 word "v4_fswap"
+   604 Sym_61 word "v4_ftan"
+   560 Sym_54 external "v4_invert"
+   681 Sym_74 word "v4_sf_Fetch"
+   678 Sym_73 word "v4_sf_Store"
+   684 Sym_75 word "v4_sfaligned"
+   687 Sym_76 word "v4_sfloat"
+   690 Sym_79 word "v4_sfloat_Minus"
+   689 Sym_78 word "v4_sfloat_Plus"
+   688 Sym_77 word "v4_sfloats"
+   321 Sym_28 external "v4_swap"
+   533 Sym_48 external "v4_throw"
+   315 Sym_25 external "v4_z2drop"
+   313 Sym_21 external "v4_z2dup"
+
+Intermediate code:
+    59 function Sym_3 {
+    60   asm (    mov v4__finit@GOTPCREL(%rip),%rdi)
+    61   asm (    cmpq $0,(%rdi))
+    62   asm (    ja 1f)
+    64   asm (    finit)
+    65   asm (    incq (%rdi))
+    66   asm (1:)
+    68   asm (    forth_pic.=0b-0b)
+    69 }
+
+    85 function Sym_4 {
+    86   asm (    call v4__fpuinit@PLT)
+    88   asm (    mov v4__fsindex@GOTPCREL(%rip),%rsi)
+    89   asm (    cmpq $6,(%rsi))
+    90   asm (    jb 1f)
+    92   asm (    mov $-44,%rax)
+    93   asm (    call v4__dpush@PLT)
+    94   asm (    call v4_throw@PLT)
+    96   asm (1:)
+    98   asm (    mov v4__fstemp@GOTPCREL(%rip),%rdi)
+    99   asm (    mov %eax,(%rdi))
+   100   asm (    flds (%rdi))
+   101   asm (    incq (%rsi))
+   103   asm (    forth_pic.=0b-0b)
+   104 }
+
+   129 function Sym_5 {
+   130   asm (    mov v4__fsindex@GOTPCREL(%rip),%rsi)
+   131   asm (    cmpq $0,(%rsi))
+   132   asm (    ja 1f)
+   134   asm (    mov $-45,%rax)
+   135   asm (    call v4__dpush@PLT)
+   136   asm (    call v4_throw@PLT)
+   138   asm (1:)
+   140   asm (    decq (%rsi))
+   141   asm (    mov v4__fstemp@GOTPCREL(%rip),%rdi)
+   142   asm (    fstps (%rdi))
+   143   asm (    mov (%rdi),%eax)
+   145   asm (    forth_pic.=0b-0b)
+   146 }
+
+   176 function Sym_6 {
+   177   asm (    mov v4__fsindex@GOTPCREL(%rip),%rsi)
+   178   asm (    cmpq $0,(%rsi))
+   179   asm (    ja 1f)
+   181   asm (    mov $-45,%rax)
+   182   asm (    call v4__dpush@PLT)
+   183   asm (    call v4_throw@PLT)
+   185   asm (1:)
+   187   asm (    forth_pic.=0b-0b)
+   188 }
+
+   205 function Sym_7 {
+   205   Reg_0 = 4
+   205   Stack_D = Reg_0
+   205   no-op
+           optimizes label Label_1
+   205 }
+
+   207 function Sym_8 {
+   207   no-op
+           optimizes   call Sym_7
+   205   no-op
+           optimizes   Reg_0 = 4
+   205   no-op
+           optimizes   Stack_D = Reg_0
+   207   no-op
+           optimizes   call Sym_9
+   207   Reg_0 = Stack_D
+   207   Reg_0 *= 4
+   207   Stack_D = Reg_0
+   207   no-op
+           optimizes label Label_2
+   207 }
+
+   208 function Sym_10 {
+   208   no-op
+           optimizes   call Sym_7
+   205   Reg_0 = 4
+   205   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   208   no-op
+           optimizes   call Sym_11
+   208   no-op
+           optimizes   Reg_1 = Stack_D
+   208   Reg_0 = Stack_D
+   208   Reg_0 += Reg_1
+   208   Stack_D = Reg_0
+   208   no-op
+           optimizes label Label_3
+   208 }
+
+   209 function Sym_12 {
+   209   no-op
+           optimizes   call Sym_7
+   205   Reg_0 = 4
+   205   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   209   no-op
+           optimizes   call Sym_13
+   209   no-op
+           optimizes   Reg_1 = Stack_D
+   209   Reg_0 = Stack_D
+   209   Reg_0 -= Reg_1
+   209   Stack_D = Reg_0
+   209   no-op
+           optimizes label Label_4
+   209 }
+
+   211 function Sym_14 {
+   212   asm (    call v4__dpop@PLT)
+   213   asm (    call v4__fpush@PLT)
+   215   asm (    forth_pic.=0b-0b)
+   216 }
+
+   218 function Sym_15 {
+   219   asm (    call v4__fpop@PLT)
+   220   asm (    call v4__dpush@PLT)
+   222   asm (    forth_pic.=0b-0b)
+   223 }
+
+   226 function Sym_16 {
+   227   asm (    call v4__fcheck@PLT)
+   228   asm (    mov v4__fstemp@GOTPCREL(%rip),%rdi)
+   230   asm (    fnstcw (%rdi))
+   231   asm (    mov (%rdi),%esi)
+   232   asm (    mov %esi,%eax)
+   233   asm (    mov $12,%ah)
+   234   asm (    mov %eax,(%rdi))
+   235   asm (    fldcw (%rdi))
+   236   asm (    fld %st(0))
+   237   asm (    fistpll (%rdi))
+   238   asm (    mov (%rdi),%rax)
+   239   asm (    mov %esi,(%rdi))
+   240   asm (    fldcw (%rdi))
+   242   asm (    call v4__dpush@PLT)
+   243   asm (    sar $63,%rax)
+   244   asm (    call v4__dpush@PLT)
+   245   asm (    call v4__fpop@PLT)
+   247   asm (    forth_pic.=0b-0b)
+   248 }
+
+   275 function Sym_17 {
+   276   asm (    call v4__fpuinit@PLT)
+   278   asm (    call v4__dpop@PLT)
+   279   asm (    call v4__dpop@PLT)
+   281   asm (    mov v4__fstemp@GOTPCREL(%rip),%rdi)
+   282   asm (    mov %rax,(%rdi))
+   283   asm (    fildll (%rdi))
+   284   asm (    fstps (%rdi))
+   285   asm (    mov (%rdi),%eax)
+   286   asm (    call v4__fpush@PLT)
+   288   asm (    forth_pic.=0b-0b)
+   289 }
+
+   308 function Sym_18 {
+   309   no-op
+           optimizes   Reg_0 = Sym_0
+   309   no-op
+           optimizes   Stack_D = Reg_0
+   309   no-op
+           optimizes   call Sym_19
+   309   Reg_0 = *(Sym_0)
+   309   Stack_D = Reg_0
+   309   no-op
+           optimizes label Label_5
+   309 }
+
+   311 function Sym_20 {
+   312   Reg_0 = Sym_0
+   312   Stack_D = Reg_0
+   313 label Label_7
+   313   call Sym_21
+   313   call Sym_19
+   313   no-op
+           optimizes   call Sym_22
+   313   Reg_1 = Stack_D
+   313   Reg_0 = Stack_D
+   313   if Reg_0 >= Reg_1 goto Label_8
+   313   no-op
+           optimizes   Reg_0 = Stack_D
+   313   no-op
+           optimizes   if Reg_0 == 0 goto Label_8
+   313   call Sym_15
+   313   call Sym_23
+   313   goto Label_7
+   313 label Label_8
+   314 label Label_9
+   314   call Sym_21
+   314   call Sym_19
+   314   no-op
+           optimizes   call Sym_24
+   314   Reg_1 = Stack_D
+   314   Reg_0 = Stack_D
+   314   if Reg_0 <= Reg_1 goto Label_10
+   314   no-op
+           optimizes   Reg_0 = Stack_D
+   314   no-op
+           optimizes   if Reg_0 == 0 goto Label_10
+   314   Reg_0 = 0
+   314   Stack_F = Reg_0
+   314   goto Label_9
+   314 label Label_10
+   315   tail call Sym_25
+           optimizes   call Sym_25
+   315   no-op
+           optimizes label Label_6
+   315 }
+
+   317 function Sym_26 {
+   318   no-op
+           optimizes   Reg_0 = Sym_0
+   318   no-op
+           optimizes   Stack_D = Reg_0
+   318   no-op
+           optimizes   call Sym_19
+   318   Reg_0 = *(Sym_0)
+   318   Stack_D = Reg_0
+   318   no-op
+           optimizes label Label_11
+   318 }
+
+   320 function Sym_27 {
+   321   call Sym_15
+   321   call Sym_28
+   321   tail call Sym_29
+           optimizes   call Sym_29
+   321   no-op
+           optimizes label Label_12
+   321 }
+
+   323 function Sym_30 {
+   324   call Sym_19
+   324   tail call Sym_14
+           optimizes   call Sym_14
+   324   no-op
+           optimizes label Label_13
+   324 }
+
+   326 function Sym_31 {
+   327   call Sym_15
+   327   tail call Sym_23
+           optimizes   call Sym_23
+   327   no-op
+           optimizes label Label_14
+   327 }
+
+   329 function Sym_32 {
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   tail call Sym_14
+           optimizes   call Sym_14
+   330   no-op
+           optimizes label Label_15
+   330 }
+
+   332 function Sym_33 {
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   tail call Sym_14
+           optimizes   call Sym_14
+   333   no-op
+           optimizes label Label_16
+   333 }
+
+   335 function Sym_35 {
+   336   call Sym_15
+   336   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   336   call Sym_14
+   336   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   tail call Sym_14
+           optimizes   call Sym_14
+   336   no-op
+           optimizes label Label_17
+   336 }
+
+   338 function Sym_36 {
+   339   call Sym_15
+   339   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   339   call Sym_14
+   339   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   tail call Sym_14
+           optimizes   call Sym_14
+   339   no-op
+           optimizes label Label_18
+   339 }
+
+   341 function Sym_37 {
+   342   tail call Sym_38
+           optimizes   call Sym_38
+   342   no-op
+           optimizes label Label_19
+   342 }
+
+   345 function Sym_39 {
+   346   asm (    call v4__fcheck@PLT)
+   347   asm (    ftst)
+   348   asm (    fnstsw %ax)
+   349   asm (    and $0x0100,%ax)
+   350   asm (    shl $23,%eax)
+   351   asm (    sar $31,%eax)
+   352   asm (    cltq)
+   353   asm (    call v4__dpush@PLT)
+   354   asm (    call v4__fpop@PLT)
+   356   asm (    forth_pic.=0b-0b)
+   357 }
+
+   374 function Sym_40 {
+   375   asm (    call v4__fcheck@PLT)
+   376   asm (    ftst)
+   377   asm (    fnstsw %ax)
+   378   asm (    and $0x4000,%ax)
+   379   asm (    shl $17,%eax)
+   380   asm (    sar $31,%eax)
+   381   asm (    cltq)
+   382   asm (    call v4__dpush@PLT)
+   383   asm (    call v4__fpop@PLT)
+   385   asm (    forth_pic.=0b-0b)
+   386 }
+
+   403 function Sym_41 {
+   404   asm (    call v4__fpop@PLT)
+   405   asm (    call v4__fcheck@PLT)
+   406   asm (    call v4__fpush@PLT)
+   407   asm (    fcompp)
+   409   asm (    fnstsw %ax)
+   410   asm (    and $0x0100,%ax)
+   411   asm (    shl $23,%eax)
+   412   asm (    sar $31,%eax)
+   413   asm (    cltq)
+   414   asm (    call v4__dpush@PLT)
+   416   asm (    mov v4__fsindex@GOTPCREL(%rip),%rsi)
+   417   asm (    subq $2,(%rsi))
+   419   asm (    forth_pic.=0b-0b)
+   420 }
+
+   441 function Sym_42 {
+   442   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   442   tail call Sym_41
+           optimizes   call Sym_41
+   442   no-op
+           optimizes label Label_20
+   442 }
+
+   445 function Sym_43 {
+   446   asm (    call v4__fpop@PLT)
+   447   asm (    mov v4__fstemp@GOTPCREL(%rip),%rdi)
+   448   asm (    mov %eax,(%rdi))
+   449   asm (    call v4__fcheck@PLT)
+   450   asm (    fadds (%rdi))
+   452   asm (    forth_pic.=0b-0b)
+   453 }
+
+   467 function Sym_44 {
+   468   asm (    call v4__fpop@PLT)
+   469   asm (    mov v4__fstemp@GOTPCREL(%rip),%rdi)
+   470   asm (    mov %eax,(%rdi))
+   471   asm (    call v4__fcheck@PLT)
+   472   asm (    fsubs (%rdi))
+   474   asm (    forth_pic.=0b-0b)
+   475 }
+
+   489 function Sym_45 {
+   490   asm (    call v4__fpop@PLT)
+   491   asm (    mov v4__fstemp@GOTPCREL(%rip),%rdi)
+   492   asm (    mov %eax,(%rdi))
+   493   asm (    call v4__fcheck@PLT)
+   494   asm (    fmuls (%rdi))
+   496   asm (    forth_pic.=0b-0b)
+   497 }
+
+   511 function Sym_46 {
+   512   asm (    call v4__fpop@PLT)
+   513   asm (    mov v4__fstemp@GOTPCREL(%rip),%rdi)
+   514   asm (    mov %eax,(%rdi))
+   515   asm (    call v4__fcheck@PLT)
+   516   asm (    fdivs (%rdi))
+   518   asm (    forth_pic.=0b-0b)
+   519 }
+
+   532 function Sym_47 {
+   533   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   533   call Sym_40
+   533   Reg_0 = Stack_D
+   533   if Reg_0 == 0 goto Label_22
+   533   Reg_0 = -42
+   533   Stack_D = Reg_0
+   533   call Sym_48
+   533 label Label_22
+   533   tail call Sym_46
+           optimizes   call Sym_46
+   533   no-op
+           optimizes label Label_21
+   533 }
+
+   535 function Sym_49 {
+   536   asm (    call v4__fcheck@PLT)
+   537   asm (    fabs)
+   539   asm (    forth_pic.=0b-0b)
+   540 }
+
+   542 function Sym_50 {
+   543   asm (    call v4__fcheck@PLT)
+   544   asm (    frndint)
+   546   asm (    forth_pic.=0b-0b)
+   547 }
+
+   549 function Sym_51 {
+   550   asm (    call v4__fcheck@PLT)
+   551   asm (    fchs)
+   553   asm (    forth_pic.=0b-0b)
+   554 }
+
+   556 function Sym_52 {
+   557   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   557   call Sym_40
+   557   Reg_0 = Stack_D
+   557   if Reg_0 == 0 goto Label_24
+   558   no-op
+           optimizes   call Sym_31
+   327   call Sym_15
+   327   call Sym_23
+   558   call Sym_15
+   558   call Sym_15
+   558   no-op
+           optimizes   call Sym_53
+   558   Reg_1 = Stack_D
+   558   Reg_0 = Stack_D
+   558   Reg_0 = Reg_0 == Reg_1
+   558   Stack_D = Reg_0
+   560   goto Label_25
+   560 label Label_24
+   560   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   560   call Sym_39
+   560   no-op
+           optimizes   call Sym_54
+   560   Reg_0 = Stack_D
+   560   Reg_0 = ~Reg_0
+   560   no-op
+           optimizes   Stack_D = Reg_0
+   560   no-op
+           optimizes   Reg_0 = Stack_D
+   560   if Reg_0 == 0 goto Label_26
+   561   no-op
+           optimizes   call Sym_36
+   339   call Sym_15
+   339   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   339   call Sym_14
+   339   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   561   no-op
+           optimizes   call Sym_36
+   339   call Sym_15
+   339   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   339   call Sym_14
+   339   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   561   call Sym_44
+   561   call Sym_49
+   561   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   561   no-op
+           optimizes   call Sym_42
+   442   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   442   tail call Sym_41
+           optimizes   call Sym_41
+   563   no-op
+           optimizes   goto Label_27
+   563 label Label_26
+   564   call Sym_49
+   564   no-op
+           optimizes   call Sym_36
+   339   call Sym_15
+   339   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   339   call Sym_14
+   339   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   564   no-op
+           optimizes   call Sym_36
+   339   call Sym_15
+   339   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   339   call Sym_14
+   339   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   564   no-op
+           optimizes   call Sym_35
+   336   call Sym_15
+   336   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   336   call Sym_14
+   336   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   564   no-op
+           optimizes   call Sym_35
+   336   call Sym_15
+   336   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   336   call Sym_14
+   336   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   565   call Sym_44
+   565   call Sym_49
+   565   call Sym_15
+   566   call Sym_49
+   566   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   566   call Sym_49
+   566   call Sym_43
+   566   call Sym_45
+   566   call Sym_14
+   567   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   567   no-op
+           optimizes   call Sym_42
+   442   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   442   tail call Sym_41
+           optimizes   call Sym_41
+   568 label Label_27
+   568 label Label_25
+   568   no-op
+           optimizes label Label_23
+   568 }
+
+   570 function Sym_55 {
+   571   no-op
+           optimizes   call Sym_35
+   336   call Sym_15
+   336   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   336   call Sym_14
+   336   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   571   no-op
+           optimizes   call Sym_35
+   336   call Sym_15
+   336   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   336   call Sym_14
+   336   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   571   no-op
+           optimizes   call Sym_42
+   442   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   442   call Sym_41
+   571   Reg_0 = Stack_D
+   571   if Reg_0 == 0 goto Label_29
+   571   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   571 label Label_29
+   571   no-op
+           optimizes   call Sym_31
+   327   call Sym_15
+   327   tail call Sym_23
+           optimizes   call Sym_23
+   571   no-op
+           optimizes label Label_28
+   571 }
+
+   573 function Sym_56 {
+   574   no-op
+           optimizes   call Sym_35
+   336   call Sym_15
+   336   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   336   call Sym_14
+   336   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   574   no-op
+           optimizes   call Sym_35
+   336   call Sym_15
+   336   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   336   call Sym_14
+   336   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   574   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   574   no-op
+           optimizes   call Sym_42
+   442   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   442   call Sym_41
+   574   Reg_0 = Stack_D
+   574   if Reg_0 == 0 goto Label_31
+   574   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   574 label Label_31
+   574   no-op
+           optimizes   call Sym_31
+   327   call Sym_15
+   327   tail call Sym_23
+           optimizes   call Sym_23
+   574   no-op
+           optimizes label Label_30
+   574 }
+
+   576 function Sym_57 {
+   577   asm (    call v4__fcheck@PLT)
+   578   asm (    fsqrt)
+   580   asm (    forth_pic.=0b-0b)
+   581 }
+
+   583 function Sym_58 {
+   584   asm (    call v4__fcheck@PLT)
+   585   asm (    fsin)
+   587   asm (    forth_pic.=0b-0b)
+   588 }
+
+   590 function Sym_59 {
+   591   asm (    call v4__fcheck@PLT)
+   592   asm (    fcos)
+   594   asm (    forth_pic.=0b-0b)
+   595 }
+
+   597 function Sym_60 {
+   598   asm (    call v4__fcheck@PLT)
+   599   asm (    fsincos)
+   601   asm (    forth_pic.=0b-0b)
+   602 }
+
+   604 function Sym_61 {
+   605   call Sym_60
+   605   no-op
+           optimizes   call Sym_47
+   533   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   533   call Sym_40
+   533   Reg_0 = Stack_D
+   533   if Reg_0 == 0 goto Label_32
+   533   Reg_0 = -42
+   533   Stack_D = Reg_0
+   533   call Sym_48
+   533 label Label_32
+   533   tail call Sym_46
+           optimizes   call Sym_46
+   605   no-op
+           optimizes label Label_32
+   605 }
+
+   608 function Sym_62 {
+   609   asm (    call v4__fpop@PLT)
+   610   asm (    call v4__fcheck@PLT)
+   611   asm (    call v4__fpush@PLT)
+   612   asm (    fyl2x)
+   614   asm (    mov v4__fsindex@GOTPCREL(%rip),%rsi)
+   615   asm (    decq (%rsi))
+   617   asm (    forth_pic.=0b-0b)
+   618 }
+
+   633 function Sym_63 {
+   634   Reg_0 = 1065353216
+   634   Stack_F = Reg_0
+   634   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   634   tail call Sym_62
+           optimizes   call Sym_62
+   634   no-op
+           optimizes label Label_33
+   634 }
+
+   636 function Sym_64 {
+   637   no-op
+           optimizes   call Sym_63
+   634   Reg_0 = 1065353216
+   634   Stack_F = Reg_0
+   634   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   634   call Sym_62
+   637   Reg_0 = 1060205080
+   637   Stack_F = Reg_0
+   637   tail call Sym_45
+           optimizes   call Sym_45
+   637   no-op
+           optimizes label Label_34
+   637 }
+
+   639 function Sym_65 {
+   640   Reg_0 = 1065353216
+   640   Stack_F = Reg_0
+   640   call Sym_43
+   640   no-op
+           optimizes   call Sym_64
+   637   no-op
+           optimizes   call Sym_63
+   634   Reg_0 = 1065353216
+   634   Stack_F = Reg_0
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   634   call Sym_62
+   637   Reg_0 = 1060205080
+   637   Stack_F = Reg_0
+   637   tail call Sym_45
+           optimizes   call Sym_45
+   640   no-op
+           optimizes label Label_35
+   640 }
+
+   642 function Sym_66 {
+   643   no-op
+           optimizes   call Sym_63
+   634   Reg_0 = 1065353216
+   634   Stack_F = Reg_0
+   634   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   634   call Sym_62
+   643   Reg_0 = 1050288283
+   643   Stack_F = Reg_0
+   643   tail call Sym_45
+           optimizes   call Sym_45
+   643   no-op
+           optimizes label Label_36
+   643 }
+
+   645 function Sym_67 {
+   646   asm (    call v4__fcheck@PLT)
+   647   asm (    f2xm1)
+   649   asm (    forth_pic.=0b-0b)
+   650 }
+
+   652 function Sym_68 {
+   653   asm (    call v4__fpop@PLT)
+   654   asm (    call v4__fcheck@PLT)
+   655   asm (    call v4__fpush@PLT)
+   656   asm (    fscale)
+   658   asm (    forth_pic.=0b-0b)
+   659 }
+
+   661 function Sym_69 {
+   662   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   662   no-op
+           optimizes   call Sym_63
+   634   Reg_0 = 1065353216
+   634   Stack_F = Reg_0
+   634   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   634   call Sym_62
+   662   call Sym_45
+   663   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   663   call Sym_16
+   663   call Sym_17
+   664   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   664   no-op
+           optimizes   call Sym_35
+   336   call Sym_15
+   336   no-op
+           optimizes   call Sym_33
+   333   call Sym_15
+   333   call Sym_34
+   333   call Sym_14
+   333   call Sym_14
+   336   call Sym_14
+   336   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   664   call Sym_44
+   665   call Sym_67
+   665   Reg_0 = 1065353216
+   665   Stack_F = Reg_0
+   665   call Sym_43
+   666   call Sym_68
+   667   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   667   no-op
+           optimizes   call Sym_31
+   327   call Sym_15
+   327   tail call Sym_23
+           optimizes   call Sym_23
+   667   no-op
+           optimizes label Label_37
+   667 }
+
+   669 function Sym_70 {
+   670   Reg_0 = 1076754516
+   670   Stack_F = Reg_0
+   670   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   670   tail call Sym_69
+           optimizes   call Sym_69
+   670   no-op
+           optimizes label Label_38
+   670 }
+
+   672 function Sym_71 {
+   673   no-op
+           optimizes   call Sym_70
+   670   Reg_0 = 1076754516
+   670   Stack_F = Reg_0
+   670   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   670   call Sym_69
+   673   Reg_0 = 1065353216
+   673   Stack_F = Reg_0
+   673   tail call Sym_44
+           optimizes   call Sym_44
+   673   no-op
+           optimizes label Label_39
+   673 }
+
+   675 function Sym_72 {
+   676   Reg_0 = 1092616192
+   676   Stack_F = Reg_0
+   676   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   676   no-op
+           optimizes   call Sym_70
+   670   Reg_0 = 1076754516
+   670   Stack_F = Reg_0
+   670   no-op
+           optimizes   call Sym_32
+   330   call Sym_15
+   330   call Sym_15
+   330   call Sym_28
+   330   call Sym_14
+   330   call Sym_14
+   670   tail call Sym_69
+           optimizes   call Sym_69
+   676   no-op
+           optimizes label Label_40
+   676 }
+
+   678 function Sym_73 {
+   679   no-op
+           optimizes   call Sym_27
+   321   call Sym_15
+   321   call Sym_28
+   321   tail call Sym_29
+           optimizes   call Sym_29
+   679   no-op
+           optimizes label Label_41
+   679 }
+
+   681 function Sym_74 {
+   682   no-op
+           optimizes   call Sym_30
+   324   call Sym_19
+   324   tail call Sym_14
+           optimizes   call Sym_14
+   682   no-op
+           optimizes label Label_42
+   682 }
+
+   684 function Sym_75 {
+   685   no-op
+           optimizes   call Sym_37
+   342   tail call Sym_38
+           optimizes   call Sym_38
+   685   no-op
+           optimizes label Label_43
+   685 }
+
+   687 function Sym_76 {
+   687   no-op
+           optimizes   call Sym_7
+   205   Reg_0 = 4
+   205   Stack_D = Reg_0
+   687   no-op
+           optimizes label Label_44
+   687 }
+
+   688 function Sym_77 {
+   688   no-op
+           optimizes   call Sym_8
+   207   no-op
+           optimizes   call Sym_7
+   205   no-op
+           optimizes   Reg_0 = 4
+   205   no-op
+           optimizes   Stack_D = Reg_0
+   207   no-op
+           optimizes   call Sym_9
+   207   Reg_0 = Stack_D
+   207   Reg_0 *= 4
+   207   Stack_D = Reg_0
+   688   no-op
+           optimizes label Label_45
+   688 }
+
+   689 function Sym_78 {
+   689   no-op
+           optimizes   call Sym_10
+   208   no-op
+           optimizes   call Sym_7
+   205   Reg_0 = 4
+   205   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   208   no-op
+           optimizes   call Sym_11
+   208   no-op
+           optimizes   Reg_1 = Stack_D
+   208   Reg_0 = Stack_D
+   208   Reg_0 += Reg_1
+   208   Stack_D = Reg_0
+   689   no-op
+           optimizes label Label_46
+   689 }
+
+   690 function Sym_79 {
+   690   no-op
+           optimizes   call Sym_12
+   209   no-op
+           optimizes   call Sym_7
+   205   Reg_0 = 4
+   205   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   209   no-op
+           optimizes   call Sym_13
+   209   no-op
+           optimizes   Reg_1 = Stack_D
+   209   Reg_0 = Stack_D
+   209   Reg_0 -= Reg_1
+   209   Stack_D = Reg_0
+   690   no-op
+           optimizes label Label_47
+   690 }
+
+   692 function Sym_80 {
+   692   no-op
+           optimizes label Label_48
+   692 }
+
+Peephole rewrites:
+  v4__fp_Store: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4__fp_Store: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_f_Tilde: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+
@@ -0,0 +1,2798 @@
+	.file	"float.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"float.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.stabs	"v4__finit:G2",40,0,0,v4__finit
+	.comm  v4__finit,8,8
+.stabs	"v4__fsindex:G2",40,0,0,v4__fsindex
+	.comm  v4__fsindex,8,8
+.stabs	"v4__fstemp:G2",40,0,0,v4__fstemp
+	.comm  v4__fstemp,8,8
+.text
+	.align 4
+.stabs "v4__fpuinit:F1",36,0,0,v4__fpuinit
+	.weak v4__fpuinit
+	.type	v4__fpuinit,@function
+v4__fpuinit:
+.stabn 68,0,59,.LMa0-v4__fpuinit
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,59,.LMb0-v4__fpuinit
+.LMb0:
+.LBB3:
+#APP
+    mov v4__finit@GOTPCREL(%rip),%rdi
+    cmpq $0,(%rdi)
+    ja 1f
+    finit
+    incq (%rdi)
+1:
+    forth_pic.=0b-0b
+#NO_APP
+.LBE3:
+.stabn 68,0,69,.LM8-v4__fpuinit
+.LM8:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe3:
+	.size	 v4__fpuinit,.Lfe3-v4__fpuinit
+.stabn	192,0,0,.LBB3-v4__fpuinit
+.stabn	224,0,0,.LBE3-v4__fpuinit
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4__fpuinit
+.text
+	.align 4
+.stabs "v4__fpush:F1",36,0,0,v4__fpush
+	.weak v4__fpush
+	.type	v4__fpush,@function
+v4__fpush:
+.stabn 68,0,85,.LMa9-v4__fpush
+.LMa9:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,85,.LMb9-v4__fpush
+.LMb9:
+.LBB4:
+#APP
+    call v4__fpuinit@PLT
+    mov v4__fsindex@GOTPCREL(%rip),%rsi
+    cmpq $6,(%rsi)
+    jb 1f
+    mov $-44,%rax
+    call v4__dpush@PLT
+    call v4_throw@PLT
+1:
+    mov v4__fstemp@GOTPCREL(%rip),%rdi
+    mov %eax,(%rdi)
+    flds (%rdi)
+    incq (%rsi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE4:
+.stabn 68,0,104,.LM23-v4__fpush
+.LM23:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe4:
+	.size	 v4__fpush,.Lfe4-v4__fpush
+.stabn	192,0,0,.LBB4-v4__fpush
+.stabn	224,0,0,.LBE4-v4__fpush
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4__fpush
+.text
+	.align 4
+.stabs "v4__fpop:F1",36,0,0,v4__fpop
+	.weak v4__fpop
+	.type	v4__fpop,@function
+v4__fpop:
+.stabn 68,0,129,.LMa24-v4__fpop
+.LMa24:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,129,.LMb24-v4__fpop
+.LMb24:
+.LBB5:
+#APP
+    mov v4__fsindex@GOTPCREL(%rip),%rsi
+    cmpq $0,(%rsi)
+    ja 1f
+    mov $-45,%rax
+    call v4__dpush@PLT
+    call v4_throw@PLT
+1:
+    decq (%rsi)
+    mov v4__fstemp@GOTPCREL(%rip),%rdi
+    fstps (%rdi)
+    mov (%rdi),%eax
+    forth_pic.=0b-0b
+#NO_APP
+.LBE5:
+.stabn 68,0,146,.LM37-v4__fpop
+.LM37:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe5:
+	.size	 v4__fpop,.Lfe5-v4__fpop
+.stabn	192,0,0,.LBB5-v4__fpop
+.stabn	224,0,0,.LBE5-v4__fpop
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4__fpop
+.text
+	.align 4
+.stabs "v4__fcheck:F1",36,0,0,v4__fcheck
+	.weak v4__fcheck
+	.type	v4__fcheck,@function
+v4__fcheck:
+.stabn 68,0,176,.LMa38-v4__fcheck
+.LMa38:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,176,.LMb38-v4__fcheck
+.LMb38:
+.LBB6:
+#APP
+    mov v4__fsindex@GOTPCREL(%rip),%rsi
+    cmpq $0,(%rsi)
+    ja 1f
+    mov $-45,%rax
+    call v4__dpush@PLT
+    call v4_throw@PLT
+1:
+    forth_pic.=0b-0b
+#NO_APP
+.LBE6:
+.stabn 68,0,188,.LM47-v4__fcheck
+.LM47:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe6:
+	.size	 v4__fcheck,.Lfe6-v4__fcheck
+.stabn	192,0,0,.LBB6-v4__fcheck
+.stabn	224,0,0,.LBE6-v4__fcheck
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4__fcheck
+.text
+	.align 4
+.stabs "v4_float:F1",36,0,0,v4_float
+	.weak v4_float
+	.type	v4_float,@function
+v4_float:
+.stabn 68,0,205,.LMa48-v4_float
+.LMa48:
+0:
+.stabn 68,0,205,.LMb48-v4_float
+.LMb48:
+.LBB7:
+	mov $4,%rax
+	call v4__dpush@PLT
+.LBE7:
+.stabn 68,0,205,.LM52-v4_float
+.LM52:
+	ret
+.Lfe7:
+	.size	 v4_float,.Lfe7-v4_float
+.stabn	192,0,0,.LBB7-v4_float
+.stabn	224,0,0,.LBE7-v4_float
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_float
+.text
+	.align 4
+.stabs "v4_floats:F1",36,0,0,v4_floats
+	.weak v4_floats
+	.type	v4_floats,@function
+v4_floats:
+.stabn 68,0,207,.LMa53-v4_floats
+.LMa53:
+0:
+.stabn 68,0,207,.LMb53-v4_floats
+.LMb53:
+.LBB8:
+	call v4__dpop@PLT
+	shl $2,%rax
+	call v4__dpush@PLT
+.LBE8:
+.stabn 68,0,207,.LM62-v4_floats
+.LM62:
+	ret
+.Lfe8:
+	.size	 v4_floats,.Lfe8-v4_floats
+.stabn	192,0,0,.LBB8-v4_floats
+.stabn	224,0,0,.LBE8-v4_floats
+.Lscope8:
+.stabs	"",36,0,0,.Lscope8-v4_floats
+.text
+	.align 4
+.stabs "v4_float_Plus:F1",36,0,0,v4_float_Plus
+	.weak v4_float_Plus
+	.type	v4_float_Plus,@function
+v4_float_Plus:
+.stabn 68,0,208,.LMa63-v4_float_Plus
+.LMa63:
+0:
+.stabn 68,0,208,.LMb63-v4_float_Plus
+.LMb63:
+.LBB10:
+.stabn 68,0,205,.LM65-v4_float_Plus
+.LM65:
+	mov $4,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+.LBE10:
+.stabn 68,0,208,.LM73-v4_float_Plus
+.LM73:
+	ret
+.Lfe10:
+	.size	 v4_float_Plus,.Lfe10-v4_float_Plus
+.stabn	192,0,0,.LBB10-v4_float_Plus
+.stabn	224,0,0,.LBE10-v4_float_Plus
+.Lscope10:
+.stabs	"",36,0,0,.Lscope10-v4_float_Plus
+.text
+	.align 4
+.stabs "v4_float_Minus:F1",36,0,0,v4_float_Minus
+	.weak v4_float_Minus
+	.type	v4_float_Minus,@function
+v4_float_Minus:
+.stabn 68,0,209,.LMa74-v4_float_Minus
+.LMa74:
+0:
+.stabn 68,0,209,.LMb74-v4_float_Minus
+.LMb74:
+.LBB12:
+.stabn 68,0,205,.LM76-v4_float_Minus
+.LM76:
+	mov $4,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+.LBE12:
+.stabn 68,0,209,.LM84-v4_float_Minus
+.LM84:
+	ret
+.Lfe12:
+	.size	 v4_float_Minus,.Lfe12-v4_float_Minus
+.stabn	192,0,0,.LBB12-v4_float_Minus
+.stabn	224,0,0,.LBE12-v4_float_Minus
+.Lscope12:
+.stabs	"",36,0,0,.Lscope12-v4_float_Minus
+.text
+	.align 4
+.stabs "v4_Greaterf:F1",36,0,0,v4_Greaterf
+	.weak v4_Greaterf
+	.type	v4_Greaterf,@function
+v4_Greaterf:
+.stabn 68,0,211,.LMa85-v4_Greaterf
+.LMa85:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,211,.LMb85-v4_Greaterf
+.LMb85:
+.LBB14:
+#APP
+    call v4__dpop@PLT
+    call v4__fpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE14:
+.stabn 68,0,216,.LM89-v4_Greaterf
+.LM89:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe14:
+	.size	 v4_Greaterf,.Lfe14-v4_Greaterf
+.stabn	192,0,0,.LBB14-v4_Greaterf
+.stabn	224,0,0,.LBE14-v4_Greaterf
+.Lscope14:
+.stabs	"",36,0,0,.Lscope14-v4_Greaterf
+.text
+	.align 4
+.stabs "v4_f_Greater:F1",36,0,0,v4_f_Greater
+	.weak v4_f_Greater
+	.type	v4_f_Greater,@function
+v4_f_Greater:
+.stabn 68,0,218,.LMa90-v4_f_Greater
+.LMa90:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,218,.LMb90-v4_f_Greater
+.LMb90:
+.LBB15:
+#APP
+    call v4__fpop@PLT
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE15:
+.stabn 68,0,223,.LM94-v4_f_Greater
+.LM94:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe15:
+	.size	 v4_f_Greater,.Lfe15-v4_f_Greater
+.stabn	192,0,0,.LBB15-v4_f_Greater
+.stabn	224,0,0,.LBE15-v4_f_Greater
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4_f_Greater
+.text
+	.align 4
+.stabs "v4_f_Greaterd:F1",36,0,0,v4_f_Greaterd
+	.weak v4_f_Greaterd
+	.type	v4_f_Greaterd,@function
+v4_f_Greaterd:
+.stabn 68,0,226,.LMa95-v4_f_Greaterd
+.LMa95:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,226,.LMb95-v4_f_Greaterd
+.LMb95:
+.LBB16:
+#APP
+    call v4__fcheck@PLT
+    mov v4__fstemp@GOTPCREL(%rip),%rdi
+    fnstcw (%rdi)
+    mov (%rdi),%esi
+    mov %esi,%eax
+    mov $12,%ah
+    mov %eax,(%rdi)
+    fldcw (%rdi)
+    fld %st(0)
+    fistpll (%rdi)
+    mov (%rdi),%rax
+    mov %esi,(%rdi)
+    fldcw (%rdi)
+    call v4__dpush@PLT
+    sar $63,%rax
+    call v4__dpush@PLT
+    call v4__fpop@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE16:
+.stabn 68,0,248,.LM114-v4_f_Greaterd
+.LM114:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe16:
+	.size	 v4_f_Greaterd,.Lfe16-v4_f_Greaterd
+.stabn	192,0,0,.LBB16-v4_f_Greaterd
+.stabn	224,0,0,.LBE16-v4_f_Greaterd
+.Lscope16:
+.stabs	"",36,0,0,.Lscope16-v4_f_Greaterd
+.text
+	.align 4
+.stabs "v4_d_Greaterf:F1",36,0,0,v4_d_Greaterf
+	.weak v4_d_Greaterf
+	.type	v4_d_Greaterf,@function
+v4_d_Greaterf:
+.stabn 68,0,275,.LMa115-v4_d_Greaterf
+.LMa115:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,275,.LMb115-v4_d_Greaterf
+.LMb115:
+.LBB17:
+#APP
+    call v4__fpuinit@PLT
+    call v4__dpop@PLT
+    call v4__dpop@PLT
+    mov v4__fstemp@GOTPCREL(%rip),%rdi
+    mov %rax,(%rdi)
+    fildll (%rdi)
+    fstps (%rdi)
+    mov (%rdi),%eax
+    call v4__fpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE17:
+.stabn 68,0,289,.LM126-v4_d_Greaterf
+.LM126:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe17:
+	.size	 v4_d_Greaterf,.Lfe17-v4_d_Greaterf
+.stabn	192,0,0,.LBB17-v4_d_Greaterf
+.stabn	224,0,0,.LBE17-v4_d_Greaterf
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-v4_d_Greaterf
+.text
+	.align 4
+.stabs "v4__fp_Fetch:F1",36,0,0,v4__fp_Fetch
+	.weak v4__fp_Fetch
+	.type	v4__fp_Fetch,@function
+v4__fp_Fetch:
+.stabn 68,0,308,.LMa127-v4__fp_Fetch
+.LMa127:
+0:
+.stabn 68,0,308,.LMb127-v4__fp_Fetch
+.LMb127:
+.LBB18:
+	mov v4__fsindex@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.LBE18:
+.stabn 68,0,309,.LM134-v4__fp_Fetch
+.LM134:
+	ret
+.Lfe18:
+	.size	 v4__fp_Fetch,.Lfe18-v4__fp_Fetch
+.stabn	192,0,0,.LBB18-v4__fp_Fetch
+.stabn	224,0,0,.LBE18-v4__fp_Fetch
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4__fp_Fetch
+.text
+	.align 4
+.stabs "v4__fp_Store:F1",36,0,0,v4__fp_Store
+	.weak v4__fp_Store
+	.type	v4__fp_Store,@function
+v4__fp_Store:
+.stabn 68,0,311,.LMa135-v4__fp_Store
+.LMa135:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,311,.LMb135-v4__fp_Store
+.LMb135:
+.LBB20:
+.stabn 68,0,312,.LM136-v4__fp_Store
+.LM136:
+	mov v4__fsindex@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+.L7:
+	call v4_z2dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jge .L8
+	call v4_f_Greater@PLT
+	call v4_drop@PLT
+	jmp .L7
+.L8:
+.L9:
+	call v4_z2dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jle .L10
+	xor %rax,%rax
+	call v4__fpush@PLT
+	jmp .L9
+.L10:
+.stabn 68,0,315,.LM164-v4__fp_Store
+.LM164:
+	pop %rbx
+	leave
+	jmp v4_z2drop@PLT
+.LBE20:
+.stabn 68,0,315,.LM166-v4__fp_Store
+.LM166:
+	pop %rbx
+	leave
+	ret
+.Lfe20:
+	.size	 v4__fp_Store,.Lfe20-v4__fp_Store
+.stabn	192,0,0,.LBB20-v4__fp_Store
+.stabn	224,0,0,.LBE20-v4__fp_Store
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4__fp_Store
+.text
+	.align 4
+.stabs "v4_fdepth:F1",36,0,0,v4_fdepth
+	.weak v4_fdepth
+	.type	v4_fdepth,@function
+v4_fdepth:
+.stabn 68,0,317,.LMa167-v4_fdepth
+.LMa167:
+0:
+.stabn 68,0,317,.LMb167-v4_fdepth
+.LMb167:
+.LBB26:
+	mov v4__fsindex@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.LBE26:
+.stabn 68,0,318,.LM174-v4_fdepth
+.LM174:
+	ret
+.Lfe26:
+	.size	 v4_fdepth,.Lfe26-v4_fdepth
+.stabn	192,0,0,.LBB26-v4_fdepth
+.stabn	224,0,0,.LBE26-v4_fdepth
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4_fdepth
+.text
+	.align 4
+.stabs "v4_f_Store:F1",36,0,0,v4_f_Store
+	.weak v4_f_Store
+	.type	v4_f_Store,@function
+v4_f_Store:
+.stabn 68,0,320,.LMa175-v4_f_Store
+.LMa175:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,320,.LMb175-v4_f_Store
+.LMb175:
+.LBB27:
+.stabn 68,0,321,.LM176-v4_f_Store
+.LM176:
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	pop %rbx
+	leave
+	jmp v4_Store@PLT
+.LBE27:
+.stabn 68,0,321,.LM180-v4_f_Store
+.LM180:
+	pop %rbx
+	leave
+	ret
+.Lfe27:
+	.size	 v4_f_Store,.Lfe27-v4_f_Store
+.stabn	192,0,0,.LBB27-v4_f_Store
+.stabn	224,0,0,.LBE27-v4_f_Store
+.Lscope27:
+.stabs	"",36,0,0,.Lscope27-v4_f_Store
+.text
+	.align 4
+.stabs "v4_f_Fetch:F1",36,0,0,v4_f_Fetch
+	.weak v4_f_Fetch
+	.type	v4_f_Fetch,@function
+v4_f_Fetch:
+.stabn 68,0,323,.LMa181-v4_f_Fetch
+.LMa181:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,323,.LMb181-v4_f_Fetch
+.LMb181:
+.LBB30:
+.stabn 68,0,324,.LM182-v4_f_Fetch
+.LM182:
+	call v4_Fetch@PLT
+	pop %rbx
+	leave
+	jmp v4_Greaterf@PLT
+.LBE30:
+.stabn 68,0,324,.LM185-v4_f_Fetch
+.LM185:
+	pop %rbx
+	leave
+	ret
+.Lfe30:
+	.size	 v4_f_Fetch,.Lfe30-v4_f_Fetch
+.stabn	192,0,0,.LBB30-v4_f_Fetch
+.stabn	224,0,0,.LBE30-v4_f_Fetch
+.Lscope30:
+.stabs	"",36,0,0,.Lscope30-v4_f_Fetch
+.text
+	.align 4
+.stabs "v4_fdrop:F1",36,0,0,v4_fdrop
+	.weak v4_fdrop
+	.type	v4_fdrop,@function
+v4_fdrop:
+.stabn 68,0,326,.LMa186-v4_fdrop
+.LMa186:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,326,.LMb186-v4_fdrop
+.LMb186:
+.LBB31:
+.stabn 68,0,327,.LM187-v4_fdrop
+.LM187:
+	call v4_f_Greater@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE31:
+.stabn 68,0,327,.LM190-v4_fdrop
+.LM190:
+	pop %rbx
+	leave
+	ret
+.Lfe31:
+	.size	 v4_fdrop,.Lfe31-v4_fdrop
+.stabn	192,0,0,.LBB31-v4_fdrop
+.stabn	224,0,0,.LBE31-v4_fdrop
+.Lscope31:
+.stabs	"",36,0,0,.Lscope31-v4_fdrop
+.text
+	.align 4
+.stabs "v4_fswap:F1",36,0,0,v4_fswap
+	.weak v4_fswap
+	.type	v4_fswap,@function
+v4_fswap:
+.stabn 68,0,329,.LMa191-v4_fswap
+.LMa191:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,329,.LMb191-v4_fswap
+.LMb191:
+.LBB32:
+.stabn 68,0,330,.LM192-v4_fswap
+.LM192:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	pop %rbx
+	leave
+	jmp v4_Greaterf@PLT
+.LBE32:
+.stabn 68,0,330,.LM198-v4_fswap
+.LM198:
+	pop %rbx
+	leave
+	ret
+.Lfe32:
+	.size	 v4_fswap,.Lfe32-v4_fswap
+.stabn	192,0,0,.LBB32-v4_fswap
+.stabn	224,0,0,.LBE32-v4_fswap
+.Lscope32:
+.stabs	"",36,0,0,.Lscope32-v4_fswap
+.text
+	.align 4
+.stabs "v4_fdup:F1",36,0,0,v4_fdup
+	.weak v4_fdup
+	.type	v4_fdup,@function
+v4_fdup:
+.stabn 68,0,332,.LMa199-v4_fdup
+.LMa199:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,332,.LMb199-v4_fdup
+.LMb199:
+.LBB33:
+.stabn 68,0,333,.LM200-v4_fdup
+.LM200:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	pop %rbx
+	leave
+	jmp v4_Greaterf@PLT
+.LBE33:
+.stabn 68,0,333,.LM205-v4_fdup
+.LM205:
+	pop %rbx
+	leave
+	ret
+.Lfe33:
+	.size	 v4_fdup,.Lfe33-v4_fdup
+.stabn	192,0,0,.LBB33-v4_fdup
+.stabn	224,0,0,.LBE33-v4_fdup
+.Lscope33:
+.stabs	"",36,0,0,.Lscope33-v4_fdup
+.text
+	.align 4
+.stabs "v4_fover:F1",36,0,0,v4_fover
+	.weak v4_fover
+	.type	v4_fover,@function
+v4_fover:
+.stabn 68,0,335,.LMa206-v4_fover
+.LMa206:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,335,.LMb206-v4_fover
+.LMb206:
+.LBB35:
+.stabn 68,0,336,.LM207-v4_fover
+.LM207:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM209-v4_fover
+.LM209:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM213-v4_fover
+.LM213:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM215-v4_fover
+.LM215:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	pop %rbx
+	leave
+	jmp v4_Greaterf@PLT
+.LBE35:
+.stabn 68,0,336,.LM221-v4_fover
+.LM221:
+	pop %rbx
+	leave
+	ret
+.Lfe35:
+	.size	 v4_fover,.Lfe35-v4_fover
+.stabn	192,0,0,.LBB35-v4_fover
+.stabn	224,0,0,.LBE35-v4_fover
+.Lscope35:
+.stabs	"",36,0,0,.Lscope35-v4_fover
+.text
+	.align 4
+.stabs "v4_frot:F1",36,0,0,v4_frot
+	.weak v4_frot
+	.type	v4_frot,@function
+v4_frot:
+.stabn 68,0,338,.LMa222-v4_frot
+.LMa222:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,338,.LMb222-v4_frot
+.LMb222:
+.LBB36:
+.stabn 68,0,339,.LM223-v4_frot
+.LM223:
+	call v4_f_Greater@PLT
+.stabn 68,0,330,.LM225-v4_frot
+.LM225:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM230-v4_frot
+.LM230:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM232-v4_frot
+.LM232:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	pop %rbx
+	leave
+	jmp v4_Greaterf@PLT
+.LBE36:
+.stabn 68,0,339,.LM238-v4_frot
+.LM238:
+	pop %rbx
+	leave
+	ret
+.Lfe36:
+	.size	 v4_frot,.Lfe36-v4_frot
+.stabn	192,0,0,.LBB36-v4_frot
+.stabn	224,0,0,.LBE36-v4_frot
+.Lscope36:
+.stabs	"",36,0,0,.Lscope36-v4_frot
+.text
+	.align 4
+.stabs "v4_faligned:F1",36,0,0,v4_faligned
+	.weak v4_faligned
+	.type	v4_faligned,@function
+v4_faligned:
+.stabn 68,0,341,.LMa239-v4_faligned
+.LMa239:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,341,.LMb239-v4_faligned
+.LMb239:
+.LBB37:
+.stabn 68,0,342,.LM240-v4_faligned
+.LM240:
+	pop %rbx
+	leave
+	jmp v4_aligned@PLT
+.LBE37:
+.stabn 68,0,342,.LM242-v4_faligned
+.LM242:
+	pop %rbx
+	leave
+	ret
+.Lfe37:
+	.size	 v4_faligned,.Lfe37-v4_faligned
+.stabn	192,0,0,.LBB37-v4_faligned
+.stabn	224,0,0,.LBE37-v4_faligned
+.Lscope37:
+.stabs	"",36,0,0,.Lscope37-v4_faligned
+.text
+	.align 4
+.stabs "v4_f0_Less:F1",36,0,0,v4_f0_Less
+	.weak v4_f0_Less
+	.type	v4_f0_Less,@function
+v4_f0_Less:
+.stabn 68,0,345,.LMa243-v4_f0_Less
+.LMa243:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,345,.LMb243-v4_f0_Less
+.LMb243:
+.LBB39:
+#APP
+    call v4__fcheck@PLT
+    ftst
+    fnstsw %ax
+    and $0x0100,%ax
+    shl $23,%eax
+    sar $31,%eax
+    cltq
+    call v4__dpush@PLT
+    call v4__fpop@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE39:
+.stabn 68,0,357,.LM254-v4_f0_Less
+.LM254:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe39:
+	.size	 v4_f0_Less,.Lfe39-v4_f0_Less
+.stabn	192,0,0,.LBB39-v4_f0_Less
+.stabn	224,0,0,.LBE39-v4_f0_Less
+.Lscope39:
+.stabs	"",36,0,0,.Lscope39-v4_f0_Less
+.text
+	.align 4
+.stabs "v4_f0_Equals:F1",36,0,0,v4_f0_Equals
+	.weak v4_f0_Equals
+	.type	v4_f0_Equals,@function
+v4_f0_Equals:
+.stabn 68,0,374,.LMa255-v4_f0_Equals
+.LMa255:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,374,.LMb255-v4_f0_Equals
+.LMb255:
+.LBB40:
+#APP
+    call v4__fcheck@PLT
+    ftst
+    fnstsw %ax
+    and $0x4000,%ax
+    shl $17,%eax
+    sar $31,%eax
+    cltq
+    call v4__dpush@PLT
+    call v4__fpop@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE40:
+.stabn 68,0,386,.LM266-v4_f0_Equals
+.LM266:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe40:
+	.size	 v4_f0_Equals,.Lfe40-v4_f0_Equals
+.stabn	192,0,0,.LBB40-v4_f0_Equals
+.stabn	224,0,0,.LBE40-v4_f0_Equals
+.Lscope40:
+.stabs	"",36,0,0,.Lscope40-v4_f0_Equals
+.text
+	.align 4
+.stabs "v4___Parenf_Greater_Closeparen:F1",36,0,0,v4___Parenf_Greater_Closeparen
+	.weak v4___Parenf_Greater_Closeparen
+	.type	v4___Parenf_Greater_Closeparen,@function
+v4___Parenf_Greater_Closeparen:
+.stabn 68,0,403,.LMa267-v4___Parenf_Greater_Closeparen
+.LMa267:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,403,.LMb267-v4___Parenf_Greater_Closeparen
+.LMb267:
+.LBB41:
+#APP
+    call v4__fpop@PLT
+    call v4__fcheck@PLT
+    call v4__fpush@PLT
+    fcompp
+    fnstsw %ax
+    and $0x0100,%ax
+    shl $23,%eax
+    sar $31,%eax
+    cltq
+    call v4__dpush@PLT
+    mov v4__fsindex@GOTPCREL(%rip),%rsi
+    subq $2,(%rsi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE41:
+.stabn 68,0,420,.LM281-v4___Parenf_Greater_Closeparen
+.LM281:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe41:
+	.size	 v4___Parenf_Greater_Closeparen,.Lfe41-v4___Parenf_Greater_Closeparen
+.stabn	192,0,0,.LBB41-v4___Parenf_Greater_Closeparen
+.stabn	224,0,0,.LBE41-v4___Parenf_Greater_Closeparen
+.Lscope41:
+.stabs	"",36,0,0,.Lscope41-v4___Parenf_Greater_Closeparen
+.text
+	.align 4
+.stabs "v4_f_Less:F1",36,0,0,v4_f_Less
+	.weak v4_f_Less
+	.type	v4_f_Less,@function
+v4_f_Less:
+.stabn 68,0,441,.LMa282-v4_f_Less
+.LMa282:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,441,.LMb282-v4_f_Less
+.LMb282:
+.LBB42:
+.stabn 68,0,330,.LM284-v4_f_Less
+.LM284:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,442,.LM289-v4_f_Less
+.LM289:
+	pop %rbx
+	leave
+	jmp v4___Parenf_Greater_Closeparen@PLT
+.LBE42:
+.stabn 68,0,442,.LM291-v4_f_Less
+.LM291:
+	pop %rbx
+	leave
+	ret
+.Lfe42:
+	.size	 v4_f_Less,.Lfe42-v4_f_Less
+.stabn	192,0,0,.LBB42-v4_f_Less
+.stabn	224,0,0,.LBE42-v4_f_Less
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4_f_Less
+.text
+	.align 4
+.stabs "v4_f_Plus:F1",36,0,0,v4_f_Plus
+	.weak v4_f_Plus
+	.type	v4_f_Plus,@function
+v4_f_Plus:
+.stabn 68,0,445,.LMa292-v4_f_Plus
+.LMa292:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,445,.LMb292-v4_f_Plus
+.LMb292:
+.LBB43:
+#APP
+    call v4__fpop@PLT
+    mov v4__fstemp@GOTPCREL(%rip),%rdi
+    mov %eax,(%rdi)
+    call v4__fcheck@PLT
+    fadds (%rdi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE43:
+.stabn 68,0,453,.LM299-v4_f_Plus
+.LM299:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe43:
+	.size	 v4_f_Plus,.Lfe43-v4_f_Plus
+.stabn	192,0,0,.LBB43-v4_f_Plus
+.stabn	224,0,0,.LBE43-v4_f_Plus
+.Lscope43:
+.stabs	"",36,0,0,.Lscope43-v4_f_Plus
+.text
+	.align 4
+.stabs "v4_f_Minus:F1",36,0,0,v4_f_Minus
+	.weak v4_f_Minus
+	.type	v4_f_Minus,@function
+v4_f_Minus:
+.stabn 68,0,467,.LMa300-v4_f_Minus
+.LMa300:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,467,.LMb300-v4_f_Minus
+.LMb300:
+.LBB44:
+#APP
+    call v4__fpop@PLT
+    mov v4__fstemp@GOTPCREL(%rip),%rdi
+    mov %eax,(%rdi)
+    call v4__fcheck@PLT
+    fsubs (%rdi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE44:
+.stabn 68,0,475,.LM307-v4_f_Minus
+.LM307:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe44:
+	.size	 v4_f_Minus,.Lfe44-v4_f_Minus
+.stabn	192,0,0,.LBB44-v4_f_Minus
+.stabn	224,0,0,.LBE44-v4_f_Minus
+.Lscope44:
+.stabs	"",36,0,0,.Lscope44-v4_f_Minus
+.text
+	.align 4
+.stabs "v4_f_Star:F1",36,0,0,v4_f_Star
+	.weak v4_f_Star
+	.type	v4_f_Star,@function
+v4_f_Star:
+.stabn 68,0,489,.LMa308-v4_f_Star
+.LMa308:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,489,.LMb308-v4_f_Star
+.LMb308:
+.LBB45:
+#APP
+    call v4__fpop@PLT
+    mov v4__fstemp@GOTPCREL(%rip),%rdi
+    mov %eax,(%rdi)
+    call v4__fcheck@PLT
+    fmuls (%rdi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE45:
+.stabn 68,0,497,.LM315-v4_f_Star
+.LM315:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe45:
+	.size	 v4_f_Star,.Lfe45-v4_f_Star
+.stabn	192,0,0,.LBB45-v4_f_Star
+.stabn	224,0,0,.LBE45-v4_f_Star
+.Lscope45:
+.stabs	"",36,0,0,.Lscope45-v4_f_Star
+.text
+	.align 4
+.stabs "v4___Parenf_Slash_Closeparen:F1",36,0,0,v4___Parenf_Slash_Closeparen
+	.weak v4___Parenf_Slash_Closeparen
+	.type	v4___Parenf_Slash_Closeparen,@function
+v4___Parenf_Slash_Closeparen:
+.stabn 68,0,511,.LMa316-v4___Parenf_Slash_Closeparen
+.LMa316:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,511,.LMb316-v4___Parenf_Slash_Closeparen
+.LMb316:
+.LBB46:
+#APP
+    call v4__fpop@PLT
+    mov v4__fstemp@GOTPCREL(%rip),%rdi
+    mov %eax,(%rdi)
+    call v4__fcheck@PLT
+    fdivs (%rdi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE46:
+.stabn 68,0,519,.LM323-v4___Parenf_Slash_Closeparen
+.LM323:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe46:
+	.size	 v4___Parenf_Slash_Closeparen,.Lfe46-v4___Parenf_Slash_Closeparen
+.stabn	192,0,0,.LBB46-v4___Parenf_Slash_Closeparen
+.stabn	224,0,0,.LBE46-v4___Parenf_Slash_Closeparen
+.Lscope46:
+.stabs	"",36,0,0,.Lscope46-v4___Parenf_Slash_Closeparen
+.text
+	.align 4
+.stabs "v4_f_Slash:F1",36,0,0,v4_f_Slash
+	.weak v4_f_Slash
+	.type	v4_f_Slash,@function
+v4_f_Slash:
+.stabn 68,0,532,.LMa324-v4_f_Slash
+.LMa324:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,532,.LMb324-v4_f_Slash
+.LMb324:
+.LBB47:
+.stabn 68,0,333,.LM326-v4_f_Slash
+.LM326:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,533,.LM330-v4_f_Slash
+.LM330:
+	call v4_f0_Equals@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L22
+	mov $-42,%rax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.L22:
+	pop %rbx
+	leave
+	jmp v4___Parenf_Slash_Closeparen@PLT
+.LBE47:
+.stabn 68,0,533,.LM339-v4_f_Slash
+.LM339:
+	pop %rbx
+	leave
+	ret
+.Lfe47:
+	.size	 v4_f_Slash,.Lfe47-v4_f_Slash
+.stabn	192,0,0,.LBB47-v4_f_Slash
+.stabn	224,0,0,.LBE47-v4_f_Slash
+.Lscope47:
+.stabs	"",36,0,0,.Lscope47-v4_f_Slash
+.text
+	.align 4
+.stabs "v4_fabs:F1",36,0,0,v4_fabs
+	.weak v4_fabs
+	.type	v4_fabs,@function
+v4_fabs:
+.stabn 68,0,535,.LMa340-v4_fabs
+.LMa340:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,535,.LMb340-v4_fabs
+.LMb340:
+.LBB49:
+#APP
+    call v4__fcheck@PLT
+    fabs
+    forth_pic.=0b-0b
+#NO_APP
+.LBE49:
+.stabn 68,0,540,.LM344-v4_fabs
+.LM344:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe49:
+	.size	 v4_fabs,.Lfe49-v4_fabs
+.stabn	192,0,0,.LBB49-v4_fabs
+.stabn	224,0,0,.LBE49-v4_fabs
+.Lscope49:
+.stabs	"",36,0,0,.Lscope49-v4_fabs
+.text
+	.align 4
+.stabs "v4_fround:F1",36,0,0,v4_fround
+	.weak v4_fround
+	.type	v4_fround,@function
+v4_fround:
+.stabn 68,0,542,.LMa345-v4_fround
+.LMa345:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,542,.LMb345-v4_fround
+.LMb345:
+.LBB50:
+#APP
+    call v4__fcheck@PLT
+    frndint
+    forth_pic.=0b-0b
+#NO_APP
+.LBE50:
+.stabn 68,0,547,.LM349-v4_fround
+.LM349:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe50:
+	.size	 v4_fround,.Lfe50-v4_fround
+.stabn	192,0,0,.LBB50-v4_fround
+.stabn	224,0,0,.LBE50-v4_fround
+.Lscope50:
+.stabs	"",36,0,0,.Lscope50-v4_fround
+.text
+	.align 4
+.stabs "v4_fnegate:F1",36,0,0,v4_fnegate
+	.weak v4_fnegate
+	.type	v4_fnegate,@function
+v4_fnegate:
+.stabn 68,0,549,.LMa350-v4_fnegate
+.LMa350:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,549,.LMb350-v4_fnegate
+.LMb350:
+.LBB51:
+#APP
+    call v4__fcheck@PLT
+    fchs
+    forth_pic.=0b-0b
+#NO_APP
+.LBE51:
+.stabn 68,0,554,.LM354-v4_fnegate
+.LM354:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe51:
+	.size	 v4_fnegate,.Lfe51-v4_fnegate
+.stabn	192,0,0,.LBB51-v4_fnegate
+.stabn	224,0,0,.LBE51-v4_fnegate
+.Lscope51:
+.stabs	"",36,0,0,.Lscope51-v4_fnegate
+.text
+	.align 4
+.stabs "v4_f_Tilde:F1",36,0,0,v4_f_Tilde
+	.weak v4_f_Tilde
+	.type	v4_f_Tilde,@function
+v4_f_Tilde:
+.stabn 68,0,556,.LMa355-v4_f_Tilde
+.LMa355:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,556,.LMb355-v4_f_Tilde
+.LMb355:
+.LBB52:
+.stabn 68,0,333,.LM357-v4_f_Tilde
+.LM357:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,557,.LM361-v4_f_Tilde
+.LM361:
+	call v4_f0_Equals@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L24
+.stabn 68,0,327,.LM365-v4_f_Tilde
+.LM365:
+	call v4_f_Greater@PLT
+	call v4_drop@PLT
+.stabn 68,0,558,.LM367-v4_f_Tilde
+.LM367:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+.stabn 68,0,560,.LM374-v4_f_Tilde
+.LM374:
+	jmp .L25
+.L24:
+.stabn 68,0,333,.LM377-v4_f_Tilde
+.LM377:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,560,.LM381-v4_f_Tilde
+.LM381:
+	call v4_f0_Less@PLT
+	call v4__dpop@PLT
+	not %rax
+	test %rax,%rax
+	je .L26
+.stabn 68,0,339,.LM389-v4_f_Tilde
+.LM389:
+	call v4_f_Greater@PLT
+.stabn 68,0,330,.LM391-v4_f_Tilde
+.LM391:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM396-v4_f_Tilde
+.LM396:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM398-v4_f_Tilde
+.LM398:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM404-v4_f_Tilde
+.LM404:
+	call v4_f_Greater@PLT
+.stabn 68,0,330,.LM406-v4_f_Tilde
+.LM406:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM411-v4_f_Tilde
+.LM411:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM413-v4_f_Tilde
+.LM413:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,561,.LM418-v4_f_Tilde
+.LM418:
+	call v4_f_Minus@PLT
+	call v4_fabs@PLT
+.stabn 68,0,330,.LM421-v4_f_Tilde
+.LM421:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM428-v4_f_Tilde
+.LM428:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,442,.LM433-v4_f_Tilde
+.LM433:
+	pop %rbx
+	leave
+	jmp v4___Parenf_Greater_Closeparen@PLT
+.L26:
+.stabn 68,0,564,.LM436-v4_f_Tilde
+.LM436:
+	call v4_fabs@PLT
+.stabn 68,0,339,.LM438-v4_f_Tilde
+.LM438:
+	call v4_f_Greater@PLT
+.stabn 68,0,330,.LM440-v4_f_Tilde
+.LM440:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM445-v4_f_Tilde
+.LM445:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM447-v4_f_Tilde
+.LM447:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM453-v4_f_Tilde
+.LM453:
+	call v4_f_Greater@PLT
+.stabn 68,0,330,.LM455-v4_f_Tilde
+.LM455:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,339,.LM460-v4_f_Tilde
+.LM460:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM462-v4_f_Tilde
+.LM462:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM468-v4_f_Tilde
+.LM468:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM470-v4_f_Tilde
+.LM470:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM474-v4_f_Tilde
+.LM474:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM476-v4_f_Tilde
+.LM476:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM482-v4_f_Tilde
+.LM482:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM484-v4_f_Tilde
+.LM484:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM488-v4_f_Tilde
+.LM488:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM490-v4_f_Tilde
+.LM490:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,565,.LM495-v4_f_Tilde
+.LM495:
+	call v4_f_Minus@PLT
+	call v4_fabs@PLT
+	call v4_f_Greater@PLT
+.stabn 68,0,566,.LM498-v4_f_Tilde
+.LM498:
+	call v4_fabs@PLT
+.stabn 68,0,330,.LM500-v4_f_Tilde
+.LM500:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,566,.LM505-v4_f_Tilde
+.LM505:
+	call v4_fabs@PLT
+	call v4_f_Plus@PLT
+	call v4_f_Star@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM510-v4_f_Tilde
+.LM510:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM517-v4_f_Tilde
+.LM517:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,442,.LM522-v4_f_Tilde
+.LM522:
+	pop %rbx
+	leave
+	jmp v4___Parenf_Greater_Closeparen@PLT
+.L27:
+.L25:
+.LBE52:
+.stabn 68,0,568,.LM526-v4_f_Tilde
+.LM526:
+	pop %rbx
+	leave
+	ret
+.Lfe52:
+	.size	 v4_f_Tilde,.Lfe52-v4_f_Tilde
+.stabn	192,0,0,.LBB52-v4_f_Tilde
+.stabn	224,0,0,.LBE52-v4_f_Tilde
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4_f_Tilde
+.text
+	.align 4
+.stabs "v4_fmax:F1",36,0,0,v4_fmax
+	.weak v4_fmax
+	.type	v4_fmax,@function
+v4_fmax:
+.stabn 68,0,570,.LMa527-v4_fmax
+.LMa527:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,570,.LMb527-v4_fmax
+.LMb527:
+.LBB55:
+.stabn 68,0,336,.LM529-v4_fmax
+.LM529:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM531-v4_fmax
+.LM531:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM535-v4_fmax
+.LM535:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM537-v4_fmax
+.LM537:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM543-v4_fmax
+.LM543:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM545-v4_fmax
+.LM545:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM549-v4_fmax
+.LM549:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM551-v4_fmax
+.LM551:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM558-v4_fmax
+.LM558:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,442,.LM563-v4_fmax
+.LM563:
+	call v4___Parenf_Greater_Closeparen@PLT
+.stabn 68,0,571,.LM564-v4_fmax
+.LM564:
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L29
+.stabn 68,0,330,.LM567-v4_fmax
+.LM567:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.L29:
+.stabn 68,0,327,.LM574-v4_fmax
+.LM574:
+	call v4_f_Greater@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE55:
+.stabn 68,0,571,.LM577-v4_fmax
+.LM577:
+	pop %rbx
+	leave
+	ret
+.Lfe55:
+	.size	 v4_fmax,.Lfe55-v4_fmax
+.stabn	192,0,0,.LBB55-v4_fmax
+.stabn	224,0,0,.LBE55-v4_fmax
+.Lscope55:
+.stabs	"",36,0,0,.Lscope55-v4_fmax
+.text
+	.align 4
+.stabs "v4_fmin:F1",36,0,0,v4_fmin
+	.weak v4_fmin
+	.type	v4_fmin,@function
+v4_fmin:
+.stabn 68,0,573,.LMa578-v4_fmin
+.LMa578:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,573,.LMb578-v4_fmin
+.LMb578:
+.LBB56:
+.stabn 68,0,336,.LM580-v4_fmin
+.LM580:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM582-v4_fmin
+.LM582:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM586-v4_fmin
+.LM586:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM588-v4_fmin
+.LM588:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM594-v4_fmin
+.LM594:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM596-v4_fmin
+.LM596:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM600-v4_fmin
+.LM600:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM602-v4_fmin
+.LM602:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM608-v4_fmin
+.LM608:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM615-v4_fmin
+.LM615:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,442,.LM620-v4_fmin
+.LM620:
+	call v4___Parenf_Greater_Closeparen@PLT
+.stabn 68,0,574,.LM621-v4_fmin
+.LM621:
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L31
+.stabn 68,0,330,.LM624-v4_fmin
+.LM624:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.L31:
+.stabn 68,0,327,.LM631-v4_fmin
+.LM631:
+	call v4_f_Greater@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE56:
+.stabn 68,0,574,.LM634-v4_fmin
+.LM634:
+	pop %rbx
+	leave
+	ret
+.Lfe56:
+	.size	 v4_fmin,.Lfe56-v4_fmin
+.stabn	192,0,0,.LBB56-v4_fmin
+.stabn	224,0,0,.LBE56-v4_fmin
+.Lscope56:
+.stabs	"",36,0,0,.Lscope56-v4_fmin
+.text
+	.align 4
+.stabs "v4_fsqrt:F1",36,0,0,v4_fsqrt
+	.weak v4_fsqrt
+	.type	v4_fsqrt,@function
+v4_fsqrt:
+.stabn 68,0,576,.LMa635-v4_fsqrt
+.LMa635:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,576,.LMb635-v4_fsqrt
+.LMb635:
+.LBB57:
+#APP
+    call v4__fcheck@PLT
+    fsqrt
+    forth_pic.=0b-0b
+#NO_APP
+.LBE57:
+.stabn 68,0,581,.LM639-v4_fsqrt
+.LM639:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe57:
+	.size	 v4_fsqrt,.Lfe57-v4_fsqrt
+.stabn	192,0,0,.LBB57-v4_fsqrt
+.stabn	224,0,0,.LBE57-v4_fsqrt
+.Lscope57:
+.stabs	"",36,0,0,.Lscope57-v4_fsqrt
+.text
+	.align 4
+.stabs "v4_fsin:F1",36,0,0,v4_fsin
+	.weak v4_fsin
+	.type	v4_fsin,@function
+v4_fsin:
+.stabn 68,0,583,.LMa640-v4_fsin
+.LMa640:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,583,.LMb640-v4_fsin
+.LMb640:
+.LBB58:
+#APP
+    call v4__fcheck@PLT
+    fsin
+    forth_pic.=0b-0b
+#NO_APP
+.LBE58:
+.stabn 68,0,588,.LM644-v4_fsin
+.LM644:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe58:
+	.size	 v4_fsin,.Lfe58-v4_fsin
+.stabn	192,0,0,.LBB58-v4_fsin
+.stabn	224,0,0,.LBE58-v4_fsin
+.Lscope58:
+.stabs	"",36,0,0,.Lscope58-v4_fsin
+.text
+	.align 4
+.stabs "v4_fcos:F1",36,0,0,v4_fcos
+	.weak v4_fcos
+	.type	v4_fcos,@function
+v4_fcos:
+.stabn 68,0,590,.LMa645-v4_fcos
+.LMa645:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,590,.LMb645-v4_fcos
+.LMb645:
+.LBB59:
+#APP
+    call v4__fcheck@PLT
+    fcos
+    forth_pic.=0b-0b
+#NO_APP
+.LBE59:
+.stabn 68,0,595,.LM649-v4_fcos
+.LM649:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe59:
+	.size	 v4_fcos,.Lfe59-v4_fcos
+.stabn	192,0,0,.LBB59-v4_fcos
+.stabn	224,0,0,.LBE59-v4_fcos
+.Lscope59:
+.stabs	"",36,0,0,.Lscope59-v4_fcos
+.text
+	.align 4
+.stabs "v4_fsincos:F1",36,0,0,v4_fsincos
+	.weak v4_fsincos
+	.type	v4_fsincos,@function
+v4_fsincos:
+.stabn 68,0,597,.LMa650-v4_fsincos
+.LMa650:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,597,.LMb650-v4_fsincos
+.LMb650:
+.LBB60:
+#APP
+    call v4__fcheck@PLT
+    fsincos
+    forth_pic.=0b-0b
+#NO_APP
+.LBE60:
+.stabn 68,0,602,.LM654-v4_fsincos
+.LM654:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe60:
+	.size	 v4_fsincos,.Lfe60-v4_fsincos
+.stabn	192,0,0,.LBB60-v4_fsincos
+.stabn	224,0,0,.LBE60-v4_fsincos
+.Lscope60:
+.stabs	"",36,0,0,.Lscope60-v4_fsincos
+.text
+	.align 4
+.stabs "v4_ftan:F1",36,0,0,v4_ftan
+	.weak v4_ftan
+	.type	v4_ftan,@function
+v4_ftan:
+.stabn 68,0,604,.LMa655-v4_ftan
+.LMa655:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,604,.LMb655-v4_ftan
+.LMb655:
+.LBB61:
+.stabn 68,0,605,.LM656-v4_ftan
+.LM656:
+	call v4_fsincos@PLT
+.stabn 68,0,333,.LM659-v4_ftan
+.LM659:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,533,.LM663-v4_ftan
+.LM663:
+	call v4_f0_Equals@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L32
+	mov $-42,%rax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.L32:
+	pop %rbx
+	leave
+	jmp v4___Parenf_Slash_Closeparen@PLT
+.LBE61:
+.stabn 68,0,605,.LM672-v4_ftan
+.LM672:
+	pop %rbx
+	leave
+	ret
+.Lfe61:
+	.size	 v4_ftan,.Lfe61-v4_ftan
+.stabn	192,0,0,.LBB61-v4_ftan
+.stabn	224,0,0,.LBE61-v4_ftan
+.Lscope61:
+.stabs	"",36,0,0,.Lscope61-v4_ftan
+.text
+	.align 4
+.stabs "v4___Parenfyl2x_Closeparen:F1",36,0,0,v4___Parenfyl2x_Closeparen
+	.weak v4___Parenfyl2x_Closeparen
+	.type	v4___Parenfyl2x_Closeparen,@function
+v4___Parenfyl2x_Closeparen:
+.stabn 68,0,608,.LMa673-v4___Parenfyl2x_Closeparen
+.LMa673:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,608,.LMb673-v4___Parenfyl2x_Closeparen
+.LMb673:
+.LBB62:
+#APP
+    call v4__fpop@PLT
+    call v4__fcheck@PLT
+    call v4__fpush@PLT
+    fyl2x
+    mov v4__fsindex@GOTPCREL(%rip),%rsi
+    decq (%rsi)
+    forth_pic.=0b-0b
+#NO_APP
+.LBE62:
+.stabn 68,0,618,.LM681-v4___Parenfyl2x_Closeparen
+.LM681:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe62:
+	.size	 v4___Parenfyl2x_Closeparen,.Lfe62-v4___Parenfyl2x_Closeparen
+.stabn	192,0,0,.LBB62-v4___Parenfyl2x_Closeparen
+.stabn	224,0,0,.LBE62-v4___Parenfyl2x_Closeparen
+.Lscope62:
+.stabs	"",36,0,0,.Lscope62-v4___Parenfyl2x_Closeparen
+.text
+	.align 4
+.stabs "v4___Parenflog2_Closeparen:F1",36,0,0,v4___Parenflog2_Closeparen
+	.weak v4___Parenflog2_Closeparen
+	.type	v4___Parenflog2_Closeparen,@function
+v4___Parenflog2_Closeparen:
+.stabn 68,0,633,.LMa682-v4___Parenflog2_Closeparen
+.LMa682:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,633,.LMb682-v4___Parenflog2_Closeparen
+.LMb682:
+.LBB63:
+.stabn 68,0,634,.LM683-v4___Parenflog2_Closeparen
+.LM683:
+	mov $1065353216,%rax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM686-v4___Parenflog2_Closeparen
+.LM686:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,634,.LM691-v4___Parenflog2_Closeparen
+.LM691:
+	pop %rbx
+	leave
+	jmp v4___Parenfyl2x_Closeparen@PLT
+.LBE63:
+.stabn 68,0,634,.LM693-v4___Parenflog2_Closeparen
+.LM693:
+	pop %rbx
+	leave
+	ret
+.Lfe63:
+	.size	 v4___Parenflog2_Closeparen,.Lfe63-v4___Parenflog2_Closeparen
+.stabn	192,0,0,.LBB63-v4___Parenflog2_Closeparen
+.stabn	224,0,0,.LBE63-v4___Parenflog2_Closeparen
+.Lscope63:
+.stabs	"",36,0,0,.Lscope63-v4___Parenflog2_Closeparen
+.text
+	.align 4
+.stabs "v4_fln:F1",36,0,0,v4_fln
+	.weak v4_fln
+	.type	v4_fln,@function
+v4_fln:
+.stabn 68,0,636,.LMa694-v4_fln
+.LMa694:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,636,.LMb694-v4_fln
+.LMb694:
+.LBB64:
+.stabn 68,0,634,.LM696-v4_fln
+.LM696:
+	mov $1065353216,%rax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM699-v4_fln
+.LM699:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,634,.LM704-v4_fln
+.LM704:
+	call v4___Parenfyl2x_Closeparen@PLT
+.stabn 68,0,637,.LM705-v4_fln
+.LM705:
+	mov $1060205080,%rax
+	call v4__fpush@PLT
+	pop %rbx
+	leave
+	jmp v4_f_Star@PLT
+.LBE64:
+.stabn 68,0,637,.LM709-v4_fln
+.LM709:
+	pop %rbx
+	leave
+	ret
+.Lfe64:
+	.size	 v4_fln,.Lfe64-v4_fln
+.stabn	192,0,0,.LBB64-v4_fln
+.stabn	224,0,0,.LBE64-v4_fln
+.Lscope64:
+.stabs	"",36,0,0,.Lscope64-v4_fln
+.text
+	.align 4
+.stabs "v4_flnp1:F1",36,0,0,v4_flnp1
+	.weak v4_flnp1
+	.type	v4_flnp1,@function
+v4_flnp1:
+.stabn 68,0,639,.LMa710-v4_flnp1
+.LMa710:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,639,.LMb710-v4_flnp1
+.LMb710:
+.LBB65:
+.stabn 68,0,640,.LM711-v4_flnp1
+.LM711:
+	mov $1065353216,%rax
+	call v4__fpush@PLT
+	call v4_f_Plus@PLT
+.stabn 68,0,634,.LM716-v4_flnp1
+.LM716:
+	mov $1065353216,%rax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM718-v4_flnp1
+.LM718:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,634,.LM723-v4_flnp1
+.LM723:
+	call v4___Parenfyl2x_Closeparen@PLT
+.stabn 68,0,637,.LM724-v4_flnp1
+.LM724:
+	mov $1060205080,%rax
+	call v4__fpush@PLT
+	pop %rbx
+	leave
+	jmp v4_f_Star@PLT
+.LBE65:
+.stabn 68,0,640,.LM728-v4_flnp1
+.LM728:
+	pop %rbx
+	leave
+	ret
+.Lfe65:
+	.size	 v4_flnp1,.Lfe65-v4_flnp1
+.stabn	192,0,0,.LBB65-v4_flnp1
+.stabn	224,0,0,.LBE65-v4_flnp1
+.Lscope65:
+.stabs	"",36,0,0,.Lscope65-v4_flnp1
+.text
+	.align 4
+.stabs "v4_flog:F1",36,0,0,v4_flog
+	.weak v4_flog
+	.type	v4_flog,@function
+v4_flog:
+.stabn 68,0,642,.LMa729-v4_flog
+.LMa729:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,642,.LMb729-v4_flog
+.LMb729:
+.LBB66:
+.stabn 68,0,634,.LM731-v4_flog
+.LM731:
+	mov $1065353216,%rax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM734-v4_flog
+.LM734:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,634,.LM739-v4_flog
+.LM739:
+	call v4___Parenfyl2x_Closeparen@PLT
+.stabn 68,0,643,.LM740-v4_flog
+.LM740:
+	mov $1050288283,%rax
+	call v4__fpush@PLT
+	pop %rbx
+	leave
+	jmp v4_f_Star@PLT
+.LBE66:
+.stabn 68,0,643,.LM744-v4_flog
+.LM744:
+	pop %rbx
+	leave
+	ret
+.Lfe66:
+	.size	 v4_flog,.Lfe66-v4_flog
+.stabn	192,0,0,.LBB66-v4_flog
+.stabn	224,0,0,.LBE66-v4_flog
+.Lscope66:
+.stabs	"",36,0,0,.Lscope66-v4_flog
+.text
+	.align 4
+.stabs "v4___Parenf2xm1_Closeparen:F1",36,0,0,v4___Parenf2xm1_Closeparen
+	.weak v4___Parenf2xm1_Closeparen
+	.type	v4___Parenf2xm1_Closeparen,@function
+v4___Parenf2xm1_Closeparen:
+.stabn 68,0,645,.LMa745-v4___Parenf2xm1_Closeparen
+.LMa745:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,645,.LMb745-v4___Parenf2xm1_Closeparen
+.LMb745:
+.LBB67:
+#APP
+    call v4__fcheck@PLT
+    f2xm1
+    forth_pic.=0b-0b
+#NO_APP
+.LBE67:
+.stabn 68,0,650,.LM749-v4___Parenf2xm1_Closeparen
+.LM749:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe67:
+	.size	 v4___Parenf2xm1_Closeparen,.Lfe67-v4___Parenf2xm1_Closeparen
+.stabn	192,0,0,.LBB67-v4___Parenf2xm1_Closeparen
+.stabn	224,0,0,.LBE67-v4___Parenf2xm1_Closeparen
+.Lscope67:
+.stabs	"",36,0,0,.Lscope67-v4___Parenf2xm1_Closeparen
+.text
+	.align 4
+.stabs "v4___Parenfscale_Closeparen:F1",36,0,0,v4___Parenfscale_Closeparen
+	.weak v4___Parenfscale_Closeparen
+	.type	v4___Parenfscale_Closeparen,@function
+v4___Parenfscale_Closeparen:
+.stabn 68,0,652,.LMa750-v4___Parenfscale_Closeparen
+.LMa750:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,652,.LMb750-v4___Parenfscale_Closeparen
+.LMb750:
+.LBB68:
+#APP
+    call v4__fpop@PLT
+    call v4__fcheck@PLT
+    call v4__fpush@PLT
+    fscale
+    forth_pic.=0b-0b
+#NO_APP
+.LBE68:
+.stabn 68,0,659,.LM756-v4___Parenfscale_Closeparen
+.LM756:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe68:
+	.size	 v4___Parenfscale_Closeparen,.Lfe68-v4___Parenfscale_Closeparen
+.stabn	192,0,0,.LBB68-v4___Parenfscale_Closeparen
+.stabn	224,0,0,.LBE68-v4___Parenfscale_Closeparen
+.Lscope68:
+.stabs	"",36,0,0,.Lscope68-v4___Parenfscale_Closeparen
+.text
+	.align 4
+.stabs "v4_f_Star_Star:F1",36,0,0,v4_f_Star_Star
+	.weak v4_f_Star_Star
+	.type	v4_f_Star_Star,@function
+v4_f_Star_Star:
+.stabn 68,0,661,.LMa757-v4_f_Star_Star
+.LMa757:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,661,.LMb757-v4_f_Star_Star
+.LMb757:
+.LBB69:
+.stabn 68,0,330,.LM759-v4_f_Star_Star
+.LM759:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,634,.LM765-v4_f_Star_Star
+.LM765:
+	mov $1065353216,%rax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM768-v4_f_Star_Star
+.LM768:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,634,.LM773-v4_f_Star_Star
+.LM773:
+	call v4___Parenfyl2x_Closeparen@PLT
+.stabn 68,0,662,.LM774-v4_f_Star_Star
+.LM774:
+	call v4_f_Star@PLT
+.stabn 68,0,333,.LM776-v4_f_Star_Star
+.LM776:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,663,.LM780-v4_f_Star_Star
+.LM780:
+	call v4_f_Greaterd@PLT
+	call v4_d_Greaterf@PLT
+.stabn 68,0,330,.LM783-v4_f_Star_Star
+.LM783:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM789-v4_f_Star_Star
+.LM789:
+	call v4_f_Greater@PLT
+.stabn 68,0,333,.LM791-v4_f_Star_Star
+.LM791:
+	call v4_f_Greater@PLT
+	call v4_dup@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,336,.LM795-v4_f_Star_Star
+.LM795:
+	call v4_Greaterf@PLT
+.stabn 68,0,330,.LM797-v4_f_Star_Star
+.LM797:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,664,.LM802-v4_f_Star_Star
+.LM802:
+	call v4_f_Minus@PLT
+.stabn 68,0,665,.LM803-v4_f_Star_Star
+.LM803:
+	call v4___Parenf2xm1_Closeparen@PLT
+	mov $1065353216,%rax
+	call v4__fpush@PLT
+	call v4_f_Plus@PLT
+.stabn 68,0,666,.LM807-v4_f_Star_Star
+.LM807:
+	call v4___Parenfscale_Closeparen@PLT
+.stabn 68,0,330,.LM809-v4_f_Star_Star
+.LM809:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,327,.LM815-v4_f_Star_Star
+.LM815:
+	call v4_f_Greater@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE69:
+.stabn 68,0,667,.LM818-v4_f_Star_Star
+.LM818:
+	pop %rbx
+	leave
+	ret
+.Lfe69:
+	.size	 v4_f_Star_Star,.Lfe69-v4_f_Star_Star
+.stabn	192,0,0,.LBB69-v4_f_Star_Star
+.stabn	224,0,0,.LBE69-v4_f_Star_Star
+.Lscope69:
+.stabs	"",36,0,0,.Lscope69-v4_f_Star_Star
+.text
+	.align 4
+.stabs "v4_fexp:F1",36,0,0,v4_fexp
+	.weak v4_fexp
+	.type	v4_fexp,@function
+v4_fexp:
+.stabn 68,0,669,.LMa819-v4_fexp
+.LMa819:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,669,.LMb819-v4_fexp
+.LMb819:
+.LBB70:
+.stabn 68,0,670,.LM820-v4_fexp
+.LM820:
+	mov $1076754516,%rax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM823-v4_fexp
+.LM823:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,670,.LM828-v4_fexp
+.LM828:
+	pop %rbx
+	leave
+	jmp v4_f_Star_Star@PLT
+.LBE70:
+.stabn 68,0,670,.LM830-v4_fexp
+.LM830:
+	pop %rbx
+	leave
+	ret
+.Lfe70:
+	.size	 v4_fexp,.Lfe70-v4_fexp
+.stabn	192,0,0,.LBB70-v4_fexp
+.stabn	224,0,0,.LBE70-v4_fexp
+.Lscope70:
+.stabs	"",36,0,0,.Lscope70-v4_fexp
+.text
+	.align 4
+.stabs "v4_fexpm1:F1",36,0,0,v4_fexpm1
+	.weak v4_fexpm1
+	.type	v4_fexpm1,@function
+v4_fexpm1:
+.stabn 68,0,672,.LMa831-v4_fexpm1
+.LMa831:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,672,.LMb831-v4_fexpm1
+.LMb831:
+.LBB71:
+.stabn 68,0,670,.LM833-v4_fexpm1
+.LM833:
+	mov $1076754516,%rax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM836-v4_fexpm1
+.LM836:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,670,.LM841-v4_fexpm1
+.LM841:
+	call v4_f_Star_Star@PLT
+.stabn 68,0,673,.LM842-v4_fexpm1
+.LM842:
+	mov $1065353216,%rax
+	call v4__fpush@PLT
+	pop %rbx
+	leave
+	jmp v4_f_Minus@PLT
+.LBE71:
+.stabn 68,0,673,.LM846-v4_fexpm1
+.LM846:
+	pop %rbx
+	leave
+	ret
+.Lfe71:
+	.size	 v4_fexpm1,.Lfe71-v4_fexpm1
+.stabn	192,0,0,.LBB71-v4_fexpm1
+.stabn	224,0,0,.LBE71-v4_fexpm1
+.Lscope71:
+.stabs	"",36,0,0,.Lscope71-v4_fexpm1
+.text
+	.align 4
+.stabs "v4_falog:F1",36,0,0,v4_falog
+	.weak v4_falog
+	.type	v4_falog,@function
+v4_falog:
+.stabn 68,0,675,.LMa847-v4_falog
+.LMa847:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,675,.LMb847-v4_falog
+.LMb847:
+.LBB72:
+.stabn 68,0,676,.LM848-v4_falog
+.LM848:
+	mov $1092616192,%rax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM851-v4_falog
+.LM851:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,670,.LM857-v4_falog
+.LM857:
+	mov $1076754516,%rax
+	call v4__fpush@PLT
+.stabn 68,0,330,.LM860-v4_falog
+.LM860:
+	call v4_f_Greater@PLT
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	call v4_Greaterf@PLT
+	call v4_Greaterf@PLT
+.stabn 68,0,670,.LM865-v4_falog
+.LM865:
+	pop %rbx
+	leave
+	jmp v4_f_Star_Star@PLT
+.LBE72:
+.stabn 68,0,676,.LM867-v4_falog
+.LM867:
+	pop %rbx
+	leave
+	ret
+.Lfe72:
+	.size	 v4_falog,.Lfe72-v4_falog
+.stabn	192,0,0,.LBB72-v4_falog
+.stabn	224,0,0,.LBE72-v4_falog
+.Lscope72:
+.stabs	"",36,0,0,.Lscope72-v4_falog
+.text
+	.align 4
+.stabs "v4_sf_Store:F1",36,0,0,v4_sf_Store
+	.weak v4_sf_Store
+	.type	v4_sf_Store,@function
+v4_sf_Store:
+.stabn 68,0,678,.LMa868-v4_sf_Store
+.LMa868:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,678,.LMb868-v4_sf_Store
+.LMb868:
+.LBB73:
+.stabn 68,0,321,.LM870-v4_sf_Store
+.LM870:
+	call v4_f_Greater@PLT
+	call v4_swap@PLT
+	pop %rbx
+	leave
+	jmp v4_Store@PLT
+.LBE73:
+.stabn 68,0,679,.LM874-v4_sf_Store
+.LM874:
+	pop %rbx
+	leave
+	ret
+.Lfe73:
+	.size	 v4_sf_Store,.Lfe73-v4_sf_Store
+.stabn	192,0,0,.LBB73-v4_sf_Store
+.stabn	224,0,0,.LBE73-v4_sf_Store
+.Lscope73:
+.stabs	"",36,0,0,.Lscope73-v4_sf_Store
+.text
+	.align 4
+.stabs "v4_sf_Fetch:F1",36,0,0,v4_sf_Fetch
+	.weak v4_sf_Fetch
+	.type	v4_sf_Fetch,@function
+v4_sf_Fetch:
+.stabn 68,0,681,.LMa875-v4_sf_Fetch
+.LMa875:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,681,.LMb875-v4_sf_Fetch
+.LMb875:
+.LBB74:
+.stabn 68,0,324,.LM877-v4_sf_Fetch
+.LM877:
+	call v4_Fetch@PLT
+	pop %rbx
+	leave
+	jmp v4_Greaterf@PLT
+.LBE74:
+.stabn 68,0,682,.LM880-v4_sf_Fetch
+.LM880:
+	pop %rbx
+	leave
+	ret
+.Lfe74:
+	.size	 v4_sf_Fetch,.Lfe74-v4_sf_Fetch
+.stabn	192,0,0,.LBB74-v4_sf_Fetch
+.stabn	224,0,0,.LBE74-v4_sf_Fetch
+.Lscope74:
+.stabs	"",36,0,0,.Lscope74-v4_sf_Fetch
+.text
+	.align 4
+.stabs "v4_sfaligned:F1",36,0,0,v4_sfaligned
+	.weak v4_sfaligned
+	.type	v4_sfaligned,@function
+v4_sfaligned:
+.stabn 68,0,684,.LMa881-v4_sfaligned
+.LMa881:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,684,.LMb881-v4_sfaligned
+.LMb881:
+.LBB75:
+.stabn 68,0,342,.LM883-v4_sfaligned
+.LM883:
+	pop %rbx
+	leave
+	jmp v4_aligned@PLT
+.LBE75:
+.stabn 68,0,685,.LM885-v4_sfaligned
+.LM885:
+	pop %rbx
+	leave
+	ret
+.Lfe75:
+	.size	 v4_sfaligned,.Lfe75-v4_sfaligned
+.stabn	192,0,0,.LBB75-v4_sfaligned
+.stabn	224,0,0,.LBE75-v4_sfaligned
+.Lscope75:
+.stabs	"",36,0,0,.Lscope75-v4_sfaligned
+.text
+	.align 4
+.stabs "v4_sfloat:F1",36,0,0,v4_sfloat
+	.weak v4_sfloat
+	.type	v4_sfloat,@function
+v4_sfloat:
+.stabn 68,0,687,.LMa886-v4_sfloat
+.LMa886:
+0:
+.stabn 68,0,687,.LMb886-v4_sfloat
+.LMb886:
+.LBB76:
+.stabn 68,0,205,.LM888-v4_sfloat
+.LM888:
+	mov $4,%rax
+	call v4__dpush@PLT
+.LBE76:
+.stabn 68,0,687,.LM891-v4_sfloat
+.LM891:
+	ret
+.Lfe76:
+	.size	 v4_sfloat,.Lfe76-v4_sfloat
+.stabn	192,0,0,.LBB76-v4_sfloat
+.stabn	224,0,0,.LBE76-v4_sfloat
+.Lscope76:
+.stabs	"",36,0,0,.Lscope76-v4_sfloat
+.text
+	.align 4
+.stabs "v4_sfloats:F1",36,0,0,v4_sfloats
+	.weak v4_sfloats
+	.type	v4_sfloats,@function
+v4_sfloats:
+.stabn 68,0,688,.LMa892-v4_sfloats
+.LMa892:
+0:
+.stabn 68,0,688,.LMb892-v4_sfloats
+.LMb892:
+.LBB77:
+	call v4__dpop@PLT
+	shl $2,%rax
+	call v4__dpush@PLT
+.LBE77:
+.stabn 68,0,688,.LM902-v4_sfloats
+.LM902:
+	ret
+.Lfe77:
+	.size	 v4_sfloats,.Lfe77-v4_sfloats
+.stabn	192,0,0,.LBB77-v4_sfloats
+.stabn	224,0,0,.LBE77-v4_sfloats
+.Lscope77:
+.stabs	"",36,0,0,.Lscope77-v4_sfloats
+.text
+	.align 4
+.stabs "v4_sfloat_Plus:F1",36,0,0,v4_sfloat_Plus
+	.weak v4_sfloat_Plus
+	.type	v4_sfloat_Plus,@function
+v4_sfloat_Plus:
+.stabn 68,0,689,.LMa903-v4_sfloat_Plus
+.LMa903:
+0:
+.stabn 68,0,689,.LMb903-v4_sfloat_Plus
+.LMb903:
+.LBB78:
+.stabn 68,0,205,.LM906-v4_sfloat_Plus
+.LM906:
+	mov $4,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+.LBE78:
+.stabn 68,0,689,.LM914-v4_sfloat_Plus
+.LM914:
+	ret
+.Lfe78:
+	.size	 v4_sfloat_Plus,.Lfe78-v4_sfloat_Plus
+.stabn	192,0,0,.LBB78-v4_sfloat_Plus
+.stabn	224,0,0,.LBE78-v4_sfloat_Plus
+.Lscope78:
+.stabs	"",36,0,0,.Lscope78-v4_sfloat_Plus
+.text
+	.align 4
+.stabs "v4_sfloat_Minus:F1",36,0,0,v4_sfloat_Minus
+	.weak v4_sfloat_Minus
+	.type	v4_sfloat_Minus,@function
+v4_sfloat_Minus:
+.stabn 68,0,690,.LMa915-v4_sfloat_Minus
+.LMa915:
+0:
+.stabn 68,0,690,.LMb915-v4_sfloat_Minus
+.LMb915:
+.LBB79:
+.stabn 68,0,205,.LM918-v4_sfloat_Minus
+.LM918:
+	mov $4,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+.LBE79:
+.stabn 68,0,690,.LM926-v4_sfloat_Minus
+.LM926:
+	ret
+.Lfe79:
+	.size	 v4_sfloat_Minus,.Lfe79-v4_sfloat_Minus
+.stabn	192,0,0,.LBB79-v4_sfloat_Minus
+.stabn	224,0,0,.LBE79-v4_sfloat_Minus
+.Lscope79:
+.stabs	"",36,0,0,.Lscope79-v4_sfloat_Minus
+.text
+	.align 4
+.stabs "v4_fliteral:F1",36,0,0,v4_fliteral
+	.weak v4_fliteral
+	.type	v4_fliteral,@function
+v4_fliteral:
+.stabn 68,0,692,.LMa927-v4_fliteral
+.LMa927:
+0:
+.stabn 68,0,692,.LMb927-v4_fliteral
+.LMb927:
+.LBB80:
+.LBE80:
+.stabn 68,0,692,.LM929-v4_fliteral
+.LM929:
+	ret
+.Lfe80:
+	.size	 v4_fliteral,.Lfe80-v4_fliteral
+.stabn	192,0,0,.LBB80-v4_fliteral
+.stabn	224,0,0,.LBE80-v4_fliteral
+.Lscope80:
+.stabs	"",36,0,0,.Lscope80-v4_fliteral
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"
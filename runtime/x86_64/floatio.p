@@ -0,0 +1,2718 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: floatio.ft
+Compiled: Sat Oct 17 10:15:09 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Data:
+   112 Data_1 string[1] "+"
+   112 Data_0 string[1] "-"
+   125 Data_6 synonym Data_0
+   135 Data_8 synonym Data_0
+   161 Data_10 synonym Data_0
+   127 Data_7 string[1] "."
+   143 Data_9 synonym Data_7
+   166 Data_11 synonym Data_7
+   170 Data_13 synonym Data_7
+   169 Data_12 string[1] "0"
+   174 Data_15 synonym Data_12
+   173 Data_14 string[2] "0."
+   117 Data_4 string[1] "E"
+   113 Data_3 string[4] "Inf "
+   113 Data_2 string[4] "NaN "
+   117 Data_5 string[1] "e"
+
+Symbols:
+   120 Sym_57 external "v4_Dotr"
+    42 Sym_14 external "v4_Equals"
+    33 Sym_3 external "v4_Fetch"
+   155 Sym_64 external "v4_Greater"
+   215 Sym_83 word "v4_Greaterfloat"
+    52 Sym_22 external "v4_Greaterr"
+    90 Sym_42 external "v4_Minus"
+   216 Sym_84 external "v4_Minustrailing"
+    99 Sym_47 external "v4_Plus"
+    99 Sym_46 external "v4_Slash"
+    98 Sym_45 external "v4_Star"
+    34 Sym_5 external "v4_Store"
+   196 Sym_79 word "v4___Parencombine_Closeparen"
+   185 Sym_76 word "v4___Parenconvinit_Closeparen"
+   190 Sym_78 word "v4___Parenctof_Closeparen"
+   182 Sym_74 variable Cell "v4___Parenfexp_Closeparen"
+   183 Sym_75 variable Cell "v4___Parenfexp_sign_Closeparen"
+   180 Sym_72 variable Cell "v4___Parenffrac_Closeparen"
+   181 Sym_73 variable Cell "v4___Parenffrac_scale_Closeparen"
+   179 Sym_71 variable Cell "v4___Parenfint_Closeparen"
+   178 Sym_70 variable Cell "v4___Parenfsign_Closeparen"
+   151 Sym_62 word "v4___Parenprecision_Closeparen"
+   115 Sym_54 word "v4___Parenprintexp_Closeparen"
+   107 Sym_52 word "v4___Parenrepresent_Closeparen"
+    40 Sym_9 word "v4___Parenrepresent_Question_Closeparen"
+    30 Sym_1 variable Char[8] "v4__fsbuf"
+    29 Sym_0 variable Cell "v4__precision"
+   116 Sym_55 external "v4__strictansi"
+   112 Sym_53 external "v4__type"
+    44 Sym_17 external "v4_and"
+   119 Sym_56 external "v4_base"
+   154 Sym_63 external "v4_c_Fetch"
+    99 Sym_49 external "v4_c_Store"
+    42 Sym_15 external "v4_drop"
+    42 Sym_12 external "v4_dup"
+   165 Sym_68 external "v4_emit"
+    59 Sym_30 external "v4_f0_Equals"
+    64 Sym_33 external "v4_f0_Less"
+   159 Sym_66 word "v4_f_Dot"
+   197 Sym_80 external "v4_f_Fetch"
+    41 Sym_11 external "v4_f_Greater"
+    68 Sym_35 external "v4_f_Less"
+   200 Sym_81 external "v4_f_Plus"
+    69 Sym_37 external "v4_f_Slash"
+    73 Sym_39 external "v4_f_Star"
+   188 Sym_77 external "v4_f_Store"
+    64 Sym_34 external "v4_fabs"
+    54 Sym_27 external "v4_false"
+    52 Sym_24 external "v4_fdrop"
+    41 Sym_10 external "v4_fdup"
+   133 Sym_61 word "v4_fe_Dot"
+    49 Sym_20 external "v4_fill"
+   213 Sym_82 external "v4_fnegate"
+    82 Sym_41 external "v4_fround"
+   123 Sym_58 word "v4_fs_Dot"
+   165 Sym_67 external "v4_i"
+    60 Sym_32 external "v4_invert"
+    42 Sym_13 external "v4_lshift"
+    38 Sym_7 external "v4_max"
+    38 Sym_8 external "v4_min"
+   100 Sym_51 external "v4_mod"
+   174 Sym_69 external "v4_negate"
+   157 Sym_65 external "v4_nip"
+    91 Sym_43 external "v4_or"
+   100 Sym_50 external "v4_over"
+    99 Sym_48 external "v4_pick"
+    32 Sym_2 word "v4_precision"
+    92 Sym_44 external "v4_r_Fetch"
+    52 Sym_25 external "v4_r_Greater"
+    48 Sym_18 word "v4_represent"
+    44 Sym_16 external "v4_rot"
+    60 Sym_31 external "v4_rshift"
+    37 Sym_6 word "v4_set_Minusprecision"
+   131 Sym_60 external "v4_space"
+    79 Sym_40 external "v4_swap"
+    54 Sym_26 external "v4_true"
+   127 Sym_59 external "v4_type"
+   316 Sym_87 external "v4_unloop"
+   242 Sym_85 external "v4_within"
+    33 Sym_4 external "v4_z0_Equals"
+    51 Sym_21 external "v4_z0_Greater"
+   315 Sym_86 external "v4_z0_Less"
+    73 Sym_38 external "v4_z1_Minus"
+    69 Sym_36 external "v4_z1_Plus"
+    56 Sym_28 external "v4_z2_Greaterr"
+    52 Sym_23 external "v4_z2drop"
+    49 Sym_19 external "v4_z2dup"
+    56 Sym_29 external "v4_z2r_Greater"
+
+Intermediate code:
+    32 function Sym_2 {
+    33   no-op
+           optimizes   Reg_0 = Sym_0
+    33   no-op
+           optimizes   Stack_D = Reg_0
+    33   no-op
+           optimizes   call Sym_3
+    33   Reg_0 = *(Sym_0)
+    33   no-op
+           optimizes   Stack_D = Reg_0
+    33   no-op
+           optimizes   call Sym_4
+    33   no-op
+           optimizes   Reg_0 = Stack_D
+    33   if Reg_0 != 0 goto Label_2
+    33   no-op
+           optimizes   Reg_0 = Stack_D
+    33   no-op
+           optimizes   if Reg_0 == 0 goto Label_2
+    34   Reg_0 = 8
+    34   no-op
+           optimizes   Stack_D = Reg_0
+    34   no-op
+           optimizes   Reg_0 = Sym_0
+    34   no-op
+           optimizes   Stack_D = Reg_0
+    34   no-op
+           optimizes   call Sym_5
+    34   no-op
+           optimizes   Reg_0 = Stack_D
+    34   *(Sym_0) = Reg_0
+    35 label Label_2
+    35   no-op
+           optimizes   Reg_0 = Sym_0
+    35   no-op
+           optimizes   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_3
+    35   Reg_0 = *(Sym_0)
+    35   Stack_D = Reg_0
+    35   no-op
+           optimizes label Label_1
+    35 }
+
+    37 function Sym_6 {
+    38   Reg_0 = 1
+    38   Stack_D = Reg_0
+    38   call Sym_7
+    38   Reg_0 = 8
+    38   Stack_D = Reg_0
+    38   call Sym_8
+    38   no-op
+           optimizes   Reg_0 = Sym_0
+    38   no-op
+           optimizes   Stack_D = Reg_0
+    38   no-op
+           optimizes   call Sym_5
+    38   Reg_0 = Stack_D
+    38   *(Sym_0) = Reg_0
+    38   no-op
+           optimizes label Label_3
+    38 }
+
+    40 function Sym_9 {
+    41   call Sym_10
+    41   call Sym_11
+    42   call Sym_12
+    42   Reg_0 = 4286578688
+           optimizes   Reg_0 = 511
+    42   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    42   no-op
+           optimizes   Reg_0 = 23
+    42   no-op
+           optimizes   Stack_D = Reg_0
+    42   no-op
+           optimizes   call Sym_13
+    42   no-op
+           optimizes   call Sym_14
+    42   no-op
+           optimizes   Reg_1 = Stack_D
+    42   Reg_0 = Stack_D
+    42   if Reg_0 != Reg_1 goto Label_5
+    42   no-op
+           optimizes   Reg_0 = Stack_D
+    42   no-op
+           optimizes   if Reg_0 == 0 goto Label_5
+    42   call Sym_15
+    42   Reg_0 = 1
+    42   Stack_D = Reg_0
+    42   goto Label_4
+    42 label Label_5
+    43   call Sym_12
+    43   Reg_0 = 2139095040
+           optimizes   Reg_0 = 255
+    43   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    43   no-op
+           optimizes   Reg_0 = 23
+    43   no-op
+           optimizes   Stack_D = Reg_0
+    43   no-op
+           optimizes   call Sym_13
+    43   no-op
+           optimizes   call Sym_14
+    43   no-op
+           optimizes   Reg_1 = Stack_D
+    43   Reg_0 = Stack_D
+    43   if Reg_0 != Reg_1 goto Label_6
+    43   no-op
+           optimizes   Reg_0 = Stack_D
+    43   no-op
+           optimizes   if Reg_0 == 0 goto Label_6
+    43   call Sym_15
+    43   Reg_0 = 2
+    43   Stack_D = Reg_0
+    43   goto Label_4
+    43 label Label_6
+    44   call Sym_12
+    44   Reg_0 = 4286578688
+           optimizes   Reg_0 = 511
+    44   Stack_D = Reg_0
+    44   no-op
+           optimizes   Reg_0 = 23
+    44   no-op
+           optimizes   Stack_D = Reg_0
+    44   no-op
+           optimizes   call Sym_13
+    44   call Sym_12
+    44   call Sym_16
+    44   no-op
+           optimizes   call Sym_17
+    44   Reg_1 = Stack_D
+    44   Reg_0 = Stack_D
+    44   Reg_0 &= Reg_1
+    44   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    44   no-op
+           optimizes   call Sym_14
+    44   no-op
+           optimizes   Reg_1 = Stack_D
+    44   Reg_0 = Stack_D
+    44   if Reg_0 != Reg_1 goto Label_7
+    44   no-op
+           optimizes   Reg_0 = Stack_D
+    44   no-op
+           optimizes   if Reg_0 == 0 goto Label_7
+    44   call Sym_15
+    44   Reg_0 = 3
+    44   Stack_D = Reg_0
+    44   goto Label_4
+    44 label Label_7
+    45   call Sym_12
+    45   Reg_0 = 2139095040
+           optimizes   Reg_0 = 255
+    45   Stack_D = Reg_0
+    45   no-op
+           optimizes   Reg_0 = 23
+    45   no-op
+           optimizes   Stack_D = Reg_0
+    45   no-op
+           optimizes   call Sym_13
+    45   call Sym_12
+    45   call Sym_16
+    45   no-op
+           optimizes   call Sym_17
+    45   Reg_1 = Stack_D
+    45   Reg_0 = Stack_D
+    45   Reg_0 &= Reg_1
+    45   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    45   no-op
+           optimizes   call Sym_14
+    45   no-op
+           optimizes   Reg_1 = Stack_D
+    45   Reg_0 = Stack_D
+    45   if Reg_0 != Reg_1 goto Label_8
+    45   no-op
+           optimizes   Reg_0 = Stack_D
+    45   no-op
+           optimizes   if Reg_0 == 0 goto Label_8
+    45   call Sym_15
+    45   Reg_0 = 4
+    45   Stack_D = Reg_0
+    45   goto Label_4
+    45 label Label_8
+    46   call Sym_15
+    46   Reg_0 = 0
+    46   Stack_D = Reg_0
+    46 label Label_4
+    46 }
+
+    48 function Sym_18 {
+    49   call Sym_19
+    49   Reg_0 = 48
+    49   Stack_D = Reg_0
+    49   call Sym_20
+    51   call Sym_9
+    51   call Sym_12
+    51   no-op
+           optimizes   call Sym_21
+    51   Reg_0 = Stack_D
+    51   if Reg_0 <= 0 goto Label_10
+    51   no-op
+           optimizes   Reg_0 = Stack_D
+    51   no-op
+           optimizes   if Reg_0 == 0 goto Label_10
+    52   call Sym_22
+    52   call Sym_23
+    52   call Sym_24
+    52   call Sym_25
+    54   no-op
+           optimizes   Reg_0 = 1
+    54   no-op
+           optimizes   Reg_1 = Reg_0
+    54   no-op
+           optimizes   Reg_1 = Stack_D
+    54   Reg_0 = Stack_D
+    54   Stack_D = Reg_0
+    54   switch Reg_0 - 1 goto Label_148, Label_149, Label_150, Label_151 else Label_15
+    54 label Label_148
+           optimizes   if Reg_0 != Reg_1 goto Label_12
+    54   Reg_0 = 1
+    54   Stack_D = Reg_0
+    54   no-op
+           optimizes   call Sym_26
+    54   Reg_0 = -1
+    54   Stack_D = Reg_0
+    54   Reg_0 = 0
+    54   Stack_D = Reg_0
+    54   goto Label_11
+    54 label Label_12
+    54   no-op
+           optimizes   Reg_0 = 2
+    54   no-op
+           optimizes   Reg_1 = Reg_0
+    54   no-op
+           optimizes   Reg_1 = Stack_D
+    54   no-op
+           optimizes   Reg_0 = Stack_D
+    54   no-op
+           optimizes   Stack_D = Reg_0
+    54 label Label_149
+           optimizes   if Reg_0 != Reg_1 goto Label_13
+    54   Reg_0 = 1
+    54   Stack_D = Reg_0
+    54   no-op
+           optimizes   call Sym_27
+    54   Reg_0 = 0
+    54   Stack_D = Reg_0
+    54   Reg_0 = 0
+    54   Stack_D = Reg_0
+    54   goto Label_11
+    54 label Label_13
+    55   no-op
+           optimizes   Reg_0 = 3
+    55   no-op
+           optimizes   Reg_1 = Reg_0
+    55   no-op
+           optimizes   Reg_1 = Stack_D
+    55   no-op
+           optimizes   Reg_0 = Stack_D
+    55   no-op
+           optimizes   Stack_D = Reg_0
+    55 label Label_150
+           optimizes   if Reg_0 != Reg_1 goto Label_14
+    55   Reg_0 = 0
+    55   Stack_D = Reg_0
+    55   no-op
+           optimizes   call Sym_26
+    55   Reg_0 = -1
+    55   Stack_D = Reg_0
+    55   Reg_0 = 0
+    55   Stack_D = Reg_0
+    55   goto Label_11
+    55 label Label_14
+    55   no-op
+           optimizes   Reg_0 = 4
+    55   no-op
+           optimizes   Reg_1 = Reg_0
+    55   no-op
+           optimizes   Reg_1 = Stack_D
+    55   no-op
+           optimizes   Reg_0 = Stack_D
+    55   no-op
+           optimizes   Stack_D = Reg_0
+    55 label Label_151
+           optimizes   if Reg_0 != Reg_1 goto Label_15
+    55   Reg_0 = 0
+    55   Stack_D = Reg_0
+    55   no-op
+           optimizes   call Sym_27
+    55   Reg_0 = 0
+    55   Stack_D = Reg_0
+    55   Reg_0 = 0
+    55   Stack_D = Reg_0
+    55   goto Label_11
+    55 label Label_15
+    56 label Label_11
+    56   Reg_0 = Stack_D
+    56   call Sym_28
+    56   call Sym_15
+    56   call Sym_29
+    56   no-op
+           optimizes   call Sym_27
+    56   Reg_0 = 0
+    56   Stack_D = Reg_0
+    56   goto Label_9
+    57 label Label_10
+    57   call Sym_15
+    59   call Sym_10
+    59   call Sym_30
+    59   Reg_0 = Stack_D
+    59   if Reg_0 == 0 goto Label_16
+    60   call Sym_23
+    60   Reg_0 = 1
+    60   Stack_D = Reg_0
+    60   call Sym_11
+    60   Reg_0 = 31
+    60   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    60   no-op
+           optimizes   call Sym_31
+    60   no-op
+           optimizes   Reg_1 = Stack_D
+    60   Reg_0 = Stack_D
+    60   Reg_0 >>= Reg_1
+    60   no-op
+           optimizes   Stack_D = Reg_0
+    60   no-op
+           optimizes   call Sym_4
+    60   no-op
+           optimizes   Reg_0 = Stack_D
+    60   Reg_0 = Reg_0 == 0
+    60   no-op
+           optimizes   Stack_D = Reg_0
+    60   no-op
+           optimizes   call Sym_32
+    60   no-op
+           optimizes   Reg_0 = Stack_D
+    60   Reg_0 = ~Reg_0
+    60   Stack_D = Reg_0
+    61   no-op
+           optimizes   call Sym_26
+    61   Reg_0 = -1
+    61   Stack_D = Reg_0
+    61   goto Label_9
+    62 label Label_16
+    64   call Sym_10
+    64   call Sym_33
+    64   call Sym_34
+    66   Reg_0 = 0
+    66   Stack_D = Reg_0
+    67 label Label_17
+    68   call Sym_10
+    68   Reg_0 = 1065353216
+    68   Stack_F = Reg_0
+    68   call Sym_35
+    68   no-op
+           optimizes   call Sym_32
+    68   Reg_0 = Stack_D
+    68   Reg_0 = ~Reg_0
+    68   no-op
+           optimizes   Stack_D = Reg_0
+    68   no-op
+           optimizes   Reg_0 = Stack_D
+    68   if Reg_0 == 0 goto Label_18
+    69   no-op
+           optimizes   call Sym_36
+    69   Reg_0 = Stack_D
+    69   Reg_0 += 1
+    69   Stack_D = Reg_0
+    69   Reg_0 = 1092616192
+    69   Stack_F = Reg_0
+    69   call Sym_37
+    70   goto Label_17
+    70 label Label_18
+    71 label Label_19
+    72   call Sym_10
+    72   Reg_0 = 1036831949
+    72   Stack_F = Reg_0
+    72   call Sym_35
+    72   Reg_0 = Stack_D
+    72   if Reg_0 == 0 goto Label_20
+    73   no-op
+           optimizes   call Sym_38
+    73   Reg_0 = Stack_D
+    73   Reg_0 -= 1
+    73   Stack_D = Reg_0
+    73   Reg_0 = 1092616192
+    73   Stack_F = Reg_0
+    73   call Sym_39
+    74   goto Label_19
+    74 label Label_20
+    75   call Sym_28
+    77   call Sym_12
+    77   no-op
+           optimizes   call Sym_4
+    77   Reg_0 = Stack_D
+    77   if Reg_0 != 0 goto Label_21
+    77   no-op
+           optimizes   Reg_0 = Stack_D
+    77   no-op
+           optimizes   if Reg_0 == 0 goto Label_21
+    78   call Sym_23
+    78   call Sym_24
+    79   call Sym_29
+    79   call Sym_40
+    79   no-op
+           optimizes   call Sym_26
+    79   Reg_0 = -1
+    79   Stack_D = Reg_0
+    79   goto Label_9
+    80 label Label_21
+    82   call Sym_12
+    82   Reg_0 = 0
+    82   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    82   no-op
+           optimizes   Reg_1 = Stack_D
+    82   Reg_0 = Stack_D
+    82   Stack_R = Reg_0
+    82   Stack_R = Reg_1
+    82 label Label_23
+    82   Reg_0 = 1092616192
+    82   Stack_F = Reg_0
+    82   call Sym_39
+    82   Reg_1 = Stack_R
+    82   Reg_1 += 1
+    82   Reg_0 = Stack_R
+    82   Stack_R = Reg_0
+    82   Stack_R = Reg_1
+    82   Reg_1 -= Reg_0
+    82   if Reg_1 != 0 goto Label_23
+    82   no-op
+           optimizes label Label_24
+    82   Reg_0 = Stack_R
+    82   Reg_0 = Stack_R
+    82   no-op
+           optimizes label Label_22
+    82   call Sym_41
+    83   call Sym_12
+    83   Reg_0 = 0
+    83   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    83   no-op
+           optimizes   Reg_1 = Stack_D
+    83   Reg_0 = Stack_D
+    83   Stack_R = Reg_0
+    83   Stack_R = Reg_1
+    83 label Label_26
+    83   Reg_0 = 1092616192
+    83   Stack_F = Reg_0
+    83   call Sym_37
+    83   Reg_1 = Stack_R
+    83   Reg_1 += 1
+    83   Reg_0 = Stack_R
+    83   Stack_R = Reg_0
+    83   Stack_R = Reg_1
+    83   Reg_1 -= Reg_0
+    83   if Reg_1 != 0 goto Label_26
+    83   no-op
+           optimizes label Label_27
+    83   Reg_0 = Stack_R
+    83   Reg_0 = Stack_R
+    83   no-op
+           optimizes label Label_25
+    85   call Sym_10
+    85   Reg_0 = 1065353216
+    85   Stack_F = Reg_0
+    85   call Sym_35
+    85   no-op
+           optimizes   call Sym_32
+    85   Reg_0 = Stack_D
+    85   Reg_0 = ~Reg_0
+    85   no-op
+           optimizes   Stack_D = Reg_0
+    85   no-op
+           optimizes   Reg_0 = Stack_D
+    85   if Reg_0 == 0 goto Label_28
+    86   call Sym_25
+    86   no-op
+           optimizes   call Sym_36
+    86   Reg_0 = Stack_D
+    86   Reg_0 += 1
+    86   Stack_D = Reg_0
+    86   call Sym_22
+    86   Reg_0 = 1092616192
+    86   Stack_F = Reg_0
+    86   call Sym_37
+    87 label Label_28
+    89   call Sym_11
+    90   call Sym_12
+    90   Reg_0 = 23
+    90   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    90   no-op
+           optimizes   call Sym_31
+    90   no-op
+           optimizes   Reg_1 = Stack_D
+    90   Reg_0 = Stack_D
+    90   Reg_0 >>= Reg_1
+    90   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    90   Reg_0 = 255
+    90   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    90   no-op
+           optimizes   call Sym_17
+    90   no-op
+           optimizes   Reg_1 = Stack_D
+    90   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    90   Reg_0 &= Reg_1
+    90   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    90   Reg_0 = 127
+    90   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    90   no-op
+           optimizes   call Sym_42
+    90   no-op
+           optimizes   Reg_1 = Stack_D
+    90   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    90   Reg_0 -= Reg_1
+    90   Stack_D = Reg_0
+    90   call Sym_22
+    91   Reg_0 = 8388607
+           optimizes   Reg_0 = 8388608
+    91   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    91   no-op
+           optimizes   Reg_0 = 23
+    91   no-op
+           optimizes   Stack_D = Reg_0
+    91   no-op
+           optimizes   call Sym_13
+    91   no-op
+           optimizes   call Sym_38
+    91   no-op
+           optimizes   call Sym_17
+    91   no-op
+           optimizes   Reg_1 = Stack_D
+    91   Reg_0 = Stack_D
+    91   Reg_0 &= Reg_1
+    91   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    91   Reg_0 = 8388608
+           optimizes   Reg_0 = 1
+    91   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    91   no-op
+           optimizes   Reg_0 = 23
+    91   no-op
+           optimizes   Stack_D = Reg_0
+    91   no-op
+           optimizes   call Sym_13
+    91   no-op
+           optimizes   call Sym_43
+    91   no-op
+           optimizes   Reg_1 = Stack_D
+    91   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    91   Reg_0 |= Reg_1
+    91   Stack_D = Reg_0
+    92   Reg_0 = 1
+    92   Stack_D = Reg_0
+    92   Reg_0 = 23
+    92   Stack_D = Reg_0
+    92   call Sym_44
+    92   no-op
+           optimizes   call Sym_42
+    92   Reg_1 = Stack_D
+    92   Reg_0 = Stack_D
+    92   Reg_0 -= Reg_1
+    92   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    92   no-op
+           optimizes   call Sym_13
+    92   no-op
+           optimizes   Reg_1 = Stack_D
+    92   Reg_0 = Stack_D
+    92   Reg_0 <<= Reg_1
+    92   no-op
+           optimizes   Stack_D = Reg_0
+    92   no-op
+           optimizes   call Sym_38
+    92   no-op
+           optimizes   Reg_0 = Stack_D
+    92   Reg_0 -= 1
+    92   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    92   no-op
+           optimizes   call Sym_17
+    92   no-op
+           optimizes   Reg_1 = Stack_D
+    92   Reg_0 = Stack_D
+    92   Reg_0 &= Reg_1
+    92   Stack_D = Reg_0
+    93   Reg_0 = 1
+    93   Stack_D = Reg_0
+    93   Reg_0 = 23
+    93   Stack_D = Reg_0
+    93   call Sym_25
+    93   no-op
+           optimizes   call Sym_42
+    93   Reg_1 = Stack_D
+    93   Reg_0 = Stack_D
+    93   Reg_0 -= Reg_1
+    93   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    93   no-op
+           optimizes   call Sym_13
+    93   no-op
+           optimizes   Reg_1 = Stack_D
+    93   Reg_0 = Stack_D
+    93   Reg_0 <<= Reg_1
+    93   Stack_D = Reg_0
+    95   call Sym_40
+    96   call Sym_16
+    96   Reg_0 = 0
+    96   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    96   no-op
+           optimizes   Reg_1 = Stack_D
+    96   Reg_0 = Stack_D
+    96   Stack_R = Reg_0
+    96   Stack_R = Reg_1
+    96 label Label_30
+    97   call Sym_12
+    97   no-op
+           optimizes   call Sym_4
+    97   Reg_0 = Stack_D
+    97   if Reg_0 != 0 goto Label_32
+    97   no-op
+           optimizes   Reg_0 = Stack_D
+    97   no-op
+           optimizes   if Reg_0 == 0 goto Label_32
+    97   goto Label_31
+    97 label Label_32
+    98   no-op
+           optimizes   Reg_0 = 10
+    98   no-op
+           optimizes   Stack_D = Reg_0
+    98   no-op
+           optimizes   call Sym_45
+    98   Reg_0 = Stack_D
+    98   Reg_0 *= 10
+    98   Stack_D = Reg_0
+    99   call Sym_19
+    99   call Sym_40
+    99   call Sym_46
+    99   Reg_0 = 48
+    99   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    99   no-op
+           optimizes   call Sym_47
+    99   no-op
+           optimizes   Reg_1 = Stack_D
+    99   Reg_0 = Stack_D
+    99   Reg_0 += Reg_1
+    99   Stack_D = Reg_0
+    99   Reg_0 = 3
+    99   Stack_D = Reg_0
+    99   call Sym_48
+    99   call Sym_49
+   100   call Sym_50
+   100   call Sym_51
+   101   call Sym_28
+   101   no-op
+           optimizes   call Sym_36
+   101   Reg_0 = Stack_D
+   101   Reg_0 += 1
+   101   Stack_D = Reg_0
+   101   call Sym_29
+   102   Reg_1 = Stack_R
+   102   Reg_1 += 1
+   102   Reg_0 = Stack_R
+   102   Stack_R = Reg_0
+   102   Stack_R = Reg_1
+   102   Reg_1 -= Reg_0
+   102   if Reg_1 != 0 goto Label_30
+   102 label Label_31
+   102   Reg_0 = Stack_R
+   102   Reg_0 = Stack_R
+   102   no-op
+           optimizes label Label_29
+   102   call Sym_23
+   104   call Sym_15
+   104   call Sym_29
+   104   call Sym_40
+   105   no-op
+           optimizes   call Sym_26
+   105   Reg_0 = -1
+   105   Stack_D = Reg_0
+   105 label Label_9
+   105 }
+
+   107 function Sym_52 {
+   108   Reg_0 = Sym_1
+   108   Stack_D = Reg_0
+   108   no-op
+           optimizes   call Sym_2
+    33   Reg_0 = *(Sym_0)
+    33   if Reg_0 != 0 goto Label_142
+    34   Reg_0 = 8
+    34   *(Sym_0) = Reg_0
+    35 label Label_142
+    35   Reg_0 = *(Sym_0)
+    35   Stack_D = Reg_0
+   108   call Sym_18
+   109   call Sym_12
+   109   Reg_0 = Stack_D
+   109   if Reg_0 == 0 goto Label_34
+   109   goto Label_33
+   109 label Label_34
+   111   call Sym_16
+   111   call Sym_16
+   112   Reg_0 = Stack_D
+   112   if Reg_0 == 0 goto Label_35
+   112   Reg_0 = Data_0
+   112   Stack_D = Reg_0
+   112   Reg_0 = 1
+   112   Stack_D = Reg_0
+   112   call Sym_53
+   112   goto Label_36
+   112 label Label_35
+   112   Reg_0 = Data_1
+   112   Stack_D = Reg_0
+   112   Reg_0 = 1
+   112   Stack_D = Reg_0
+   112   call Sym_53
+   112 label Label_36
+   113   no-op
+           optimizes   call Sym_4
+   113   Reg_0 = Stack_D
+   113   if Reg_0 != 0 goto Label_37
+   113   no-op
+           optimizes   Reg_0 = Stack_D
+   113   no-op
+           optimizes   if Reg_0 == 0 goto Label_37
+   113   Reg_0 = Data_2
+   113   Stack_D = Reg_0
+   113   Reg_0 = 4
+   113   Stack_D = Reg_0
+   113   tail call Sym_53
+           optimizes   call Sym_53
+   113   no-op
+           optimizes   goto Label_38
+   113 label Label_37
+   113   Reg_0 = Data_3
+   113   Stack_D = Reg_0
+   113   Reg_0 = 4
+   113   Stack_D = Reg_0
+   113   tail call Sym_53
+           optimizes   call Sym_53
+   113 label Label_38
+   113 label Label_33
+   113 }
+
+   115 function Sym_54 {
+   116   call Sym_55
+   116   call Sym_3
+   117   Reg_0 = Stack_D
+   117   if Reg_0 == 0 goto Label_40
+   117   Reg_0 = Data_4
+   117   Stack_D = Reg_0
+   117   Reg_0 = 1
+   117   Stack_D = Reg_0
+   117   call Sym_53
+   117   goto Label_41
+   117 label Label_40
+   117   Reg_0 = Data_5
+   117   Stack_D = Reg_0
+   117   Reg_0 = 1
+   117   Stack_D = Reg_0
+   117   call Sym_53
+   117 label Label_41
+   119   call Sym_56
+   119   call Sym_3
+   119   call Sym_22
+   119   Reg_0 = 10
+   119   Stack_D = Reg_0
+   119   call Sym_56
+   119   call Sym_5
+   120   Reg_0 = 0
+   120   Stack_D = Reg_0
+   120   call Sym_57
+   121   call Sym_25
+   121   call Sym_56
+   121   tail call Sym_5
+           optimizes   call Sym_5
+   121   no-op
+           optimizes label Label_39
+   121 }
+
+   123 function Sym_58 {
+   124   call Sym_52
+   124   no-op
+           optimizes   call Sym_32
+   124   Reg_0 = Stack_D
+   124   Reg_0 = ~Reg_0
+   124   no-op
+           optimizes   Stack_D = Reg_0
+   124   no-op
+           optimizes   Reg_0 = Stack_D
+   124   if Reg_0 == 0 goto Label_43
+   124   goto Label_42
+   124 label Label_43
+   125   Reg_0 = Stack_D
+   125   if Reg_0 == 0 goto Label_44
+   125   Reg_0 = Data_6
+   125   Stack_D = Reg_0
+   125   Reg_0 = 1
+   125   Stack_D = Reg_0
+   125   call Sym_53
+   125 label Label_44
+   127   Reg_0 = Sym_1
+   127   Stack_D = Reg_0
+   127   Reg_0 = 1
+   127   Stack_D = Reg_0
+   127   call Sym_59
+   127   Reg_0 = Data_7
+   127   Stack_D = Reg_0
+   127   Reg_0 = 1
+   127   Stack_D = Reg_0
+   127   call Sym_53
+   128   Reg_0 = Sym_1
+   128   no-op
+           optimizes   Stack_D = Reg_0
+   128   no-op
+           optimizes   call Sym_36
+   128   no-op
+           optimizes   Reg_0 = Stack_D
+   128   Reg_0 += 1
+   128   Stack_D = Reg_0
+   128   no-op
+           optimizes   call Sym_2
+    33   Reg_0 = *(Sym_0)
+    33   if Reg_0 != 0 goto Label_143
+    34   Reg_0 = 8
+    34   *(Sym_0) = Reg_0
+    35 label Label_143
+    35   Reg_0 = *(Sym_0)
+    35   no-op
+           optimizes   Stack_D = Reg_0
+   128   no-op
+           optimizes   call Sym_38
+   128   no-op
+           optimizes   Reg_0 = Stack_D
+   128   Reg_0 -= 1
+   128   Stack_D = Reg_0
+   128   call Sym_59
+   130   no-op
+           optimizes   call Sym_38
+   130   Reg_0 = Stack_D
+   130   Reg_0 -= 1
+   130   Stack_D = Reg_0
+   131   call Sym_54
+   131   tail call Sym_60
+           optimizes   call Sym_60
+   131 label Label_42
+   131 }
+
+   133 function Sym_61 {
+   134   call Sym_52
+   134   no-op
+           optimizes   call Sym_32
+   134   Reg_0 = Stack_D
+   134   Reg_0 = ~Reg_0
+   134   no-op
+           optimizes   Stack_D = Reg_0
+   134   no-op
+           optimizes   Reg_0 = Stack_D
+   134   if Reg_0 == 0 goto Label_46
+   134   goto Label_45
+   134 label Label_46
+   135   Reg_0 = Stack_D
+   135   if Reg_0 == 0 goto Label_47
+   135   Reg_0 = Data_8
+   135   Stack_D = Reg_0
+   135   Reg_0 = 1
+   135   Stack_D = Reg_0
+   135   call Sym_53
+   135 label Label_47
+   137   call Sym_12
+   137   Reg_0 = 41
+   137   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   137   no-op
+           optimizes   call Sym_47
+   137   no-op
+           optimizes   Reg_1 = Stack_D
+   137   Reg_0 = Stack_D
+   137   Reg_0 += Reg_1
+   137   no-op
+           optimizes   Stack_D = Reg_0
+   138   no-op
+           optimizes   Reg_0 = 3
+   138   no-op
+           optimizes   Stack_D = Reg_0
+   138   no-op
+           optimizes   call Sym_51
+   138   no-op
+           optimizes   Reg_0 = Stack_D
+   138   Reg_0 %= 3
+   138   no-op
+           optimizes   Stack_D = Reg_0
+   138   no-op
+           optimizes   call Sym_36
+   138   no-op
+           optimizes   Reg_0 = Stack_D
+   138   Reg_0 += 1
+   138   Stack_D = Reg_0
+   140   Reg_0 = Sym_1
+   140   Stack_D = Reg_0
+   140   no-op
+           optimizes   call Sym_2
+    33   Reg_0 = *(Sym_0)
+    33   if Reg_0 != 0 goto Label_144
+    34   Reg_0 = 8
+    34   *(Sym_0) = Reg_0
+    35 label Label_144
+    35   Reg_0 = *(Sym_0)
+    35   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   140   no-op
+           optimizes   call Sym_47
+   140   no-op
+           optimizes   Reg_1 = Stack_D
+   140   Reg_0 = Stack_D
+   140   Reg_0 += Reg_1
+   140   Stack_D = Reg_0
+   140   Reg_0 = 8
+   140   Stack_D = Reg_0
+   140   no-op
+           optimizes   call Sym_2
+    33   Reg_0 = *(Sym_0)
+    33   if Reg_0 != 0 goto Label_145
+    34   Reg_0 = 8
+    34   *(Sym_0) = Reg_0
+    35 label Label_145
+    35   Reg_0 = *(Sym_0)
+    35   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   140   no-op
+           optimizes   call Sym_42
+   140   no-op
+           optimizes   Reg_1 = Stack_D
+   140   Reg_0 = Stack_D
+   140   Reg_0 -= Reg_1
+   140   Stack_D = Reg_0
+   141   Reg_0 = 48
+   141   Stack_D = Reg_0
+   141   call Sym_20
+   143   Reg_0 = Sym_1
+   143   Stack_D = Reg_0
+   143   call Sym_50
+   143   call Sym_59
+   143   Reg_0 = Data_9
+   143   Stack_D = Reg_0
+   143   Reg_0 = 1
+   143   Stack_D = Reg_0
+   143   call Sym_53
+   144   Reg_0 = Sym_1
+   144   Stack_D = Reg_0
+   144   call Sym_50
+   144   no-op
+           optimizes   call Sym_47
+   144   Reg_1 = Stack_D
+   144   Reg_0 = Stack_D
+   144   Reg_0 += Reg_1
+   144   Stack_D = Reg_0
+   145   no-op
+           optimizes   call Sym_2
+    33   Reg_0 = *(Sym_0)
+    33   if Reg_0 != 0 goto Label_146
+    34   Reg_0 = 8
+    34   *(Sym_0) = Reg_0
+    35 label Label_146
+    35   Reg_0 = *(Sym_0)
+    35   Stack_D = Reg_0
+   145   Reg_0 = 2
+   145   Stack_D = Reg_0
+   145   call Sym_48
+   145   no-op
+           optimizes   call Sym_42
+   145   Reg_1 = Stack_D
+   145   Reg_0 = Stack_D
+   145   Reg_0 -= Reg_1
+   145   Stack_D = Reg_0
+   146   call Sym_12
+   146   no-op
+           optimizes   call Sym_21
+   146   Reg_0 = Stack_D
+   146   if Reg_0 <= 0 goto Label_48
+   146   no-op
+           optimizes   Reg_0 = Stack_D
+   146   no-op
+           optimizes   if Reg_0 == 0 goto Label_48
+   146   call Sym_59
+   146   goto Label_49
+   146 label Label_48
+   146   call Sym_23
+   146 label Label_49
+   148   no-op
+           optimizes   call Sym_42
+   148   Reg_1 = Stack_D
+   148   Reg_0 = Stack_D
+   148   Reg_0 -= Reg_1
+   148   Stack_D = Reg_0
+   149   call Sym_54
+   149   tail call Sym_60
+           optimizes   call Sym_60
+   149 label Label_45
+   149 }
+
+   151 function Sym_62 {
+   152   Reg_0 = Sym_1
+   152   Stack_D = Reg_0
+   152   no-op
+           optimizes   call Sym_2
+    33   Reg_0 = *(Sym_0)
+    33   if Reg_0 != 0 goto Label_147
+    34   Reg_0 = 8
+    34   *(Sym_0) = Reg_0
+    35 label Label_147
+    35   Reg_0 = *(Sym_0)
+    35   Stack_D = Reg_0
+   153 label Label_51
+   154   call Sym_19
+   154   no-op
+           optimizes   call Sym_47
+   154   Reg_1 = Stack_D
+   154   Reg_0 = Stack_D
+   154   Reg_0 += Reg_1
+   154   no-op
+           optimizes   Stack_D = Reg_0
+   154   no-op
+           optimizes   call Sym_38
+   154   no-op
+           optimizes   Reg_0 = Stack_D
+   154   Reg_0 -= 1
+   154   Stack_D = Reg_0
+   154   call Sym_63
+   155   Reg_0 = 48
+   155   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   155   no-op
+           optimizes   call Sym_14
+   155   no-op
+           optimizes   Reg_1 = Stack_D
+   155   Reg_0 = Stack_D
+   155   Reg_0 = Reg_0 == Reg_1
+   155   Stack_D = Reg_0
+   155   call Sym_50
+   155   Reg_0 = 1
+   155   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   155   no-op
+           optimizes   call Sym_64
+   155   no-op
+           optimizes   Reg_1 = Stack_D
+   155   Reg_0 = Stack_D
+   155   Reg_0 = Reg_0 > Reg_1
+   155   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   155   no-op
+           optimizes   call Sym_17
+   155   no-op
+           optimizes   Reg_1 = Stack_D
+   155   Reg_0 = Stack_D
+   155   Reg_0 &= Reg_1
+   155   no-op
+           optimizes   Stack_D = Reg_0
+   155   no-op
+           optimizes   Reg_0 = Stack_D
+   155   if Reg_0 == 0 goto Label_52
+   156   no-op
+           optimizes   call Sym_38
+   156   Reg_0 = Stack_D
+   156   Reg_0 -= 1
+   156   Stack_D = Reg_0
+   156   goto Label_51
+   156 label Label_52
+   157   tail call Sym_65
+           optimizes   call Sym_65
+   157   no-op
+           optimizes label Label_50
+   157 }
+
+   159 function Sym_66 {
+   160   call Sym_52
+   160   no-op
+           optimizes   call Sym_32
+   160   Reg_0 = Stack_D
+   160   Reg_0 = ~Reg_0
+   160   no-op
+           optimizes   Stack_D = Reg_0
+   160   no-op
+           optimizes   Reg_0 = Stack_D
+   160   if Reg_0 == 0 goto Label_54
+   160   goto Label_53
+   160 label Label_54
+   161   Reg_0 = Stack_D
+   161   if Reg_0 == 0 goto Label_55
+   161   Reg_0 = Data_10
+   161   Stack_D = Reg_0
+   161   Reg_0 = 1
+   161   Stack_D = Reg_0
+   161   call Sym_53
+   161 label Label_55
+   163   call Sym_12
+   163   no-op
+           optimizes   call Sym_21
+   163   Reg_0 = Stack_D
+   163   if Reg_0 <= 0 goto Label_56
+   163   no-op
+           optimizes   Reg_0 = Stack_D
+   163   no-op
+           optimizes   if Reg_0 == 0 goto Label_56
+   164   call Sym_62
+   164   Reg_0 = 0
+   164   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   164   no-op
+           optimizes   Reg_1 = Stack_D
+   164   Reg_0 = Stack_D
+   164   Stack_R = Reg_0
+   164   Stack_R = Reg_1
+   164 label Label_58
+   165   Reg_0 = Sym_1
+   165   Stack_D = Reg_0
+   165   call Sym_67
+   165   no-op
+           optimizes   call Sym_47
+   165   Reg_1 = Stack_D
+   165   Reg_0 = Stack_D
+   165   Reg_0 += Reg_1
+   165   Stack_D = Reg_0
+   165   call Sym_63
+   165   call Sym_68
+   166   no-op
+           optimizes   call Sym_38
+   166   Reg_0 = Stack_D
+   166   Reg_0 -= 1
+   166   Stack_D = Reg_0
+   166   call Sym_12
+   166   no-op
+           optimizes   call Sym_4
+   166   Reg_0 = Stack_D
+   166   if Reg_0 != 0 goto Label_60
+   166   no-op
+           optimizes   Reg_0 = Stack_D
+   166   no-op
+           optimizes   if Reg_0 == 0 goto Label_60
+   166   Reg_0 = Data_11
+   166   Stack_D = Reg_0
+   166   Reg_0 = 1
+   166   Stack_D = Reg_0
+   166   call Sym_53
+   166 label Label_60
+   167   Reg_1 = Stack_R
+   167   Reg_1 += 1
+   167   Reg_0 = Stack_R
+   167   Stack_R = Reg_0
+   167   Stack_R = Reg_1
+   167   Reg_1 -= Reg_0
+   167   if Reg_1 != 0 goto Label_58
+   167   no-op
+           optimizes label Label_59
+   167   Reg_0 = Stack_R
+   167   Reg_0 = Stack_R
+   167   no-op
+           optimizes label Label_57
+   168   call Sym_12
+   168   no-op
+           optimizes   call Sym_21
+   168   Reg_0 = Stack_D
+   168   if Reg_0 <= 0 goto Label_61
+   168   no-op
+           optimizes   Reg_0 = Stack_D
+   168   no-op
+           optimizes   if Reg_0 == 0 goto Label_61
+   169   Reg_0 = 0
+   169   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   169   no-op
+           optimizes   Reg_1 = Stack_D
+   169   Reg_0 = Stack_D
+   169   Stack_R = Reg_0
+   169   Stack_R = Reg_1
+   169 label Label_63
+   169   Reg_0 = Data_12
+   169   Stack_D = Reg_0
+   169   Reg_0 = 1
+   169   Stack_D = Reg_0
+   169   call Sym_53
+   169   Reg_1 = Stack_R
+   169   Reg_1 += 1
+   169   Reg_0 = Stack_R
+   169   Stack_R = Reg_0
+   169   Stack_R = Reg_1
+   169   Reg_1 -= Reg_0
+   169   if Reg_1 != 0 goto Label_63
+   169   no-op
+           optimizes label Label_64
+   169   Reg_0 = Stack_R
+   169   Reg_0 = Stack_R
+   169   no-op
+           optimizes label Label_62
+   170   Reg_0 = Data_13
+   170   Stack_D = Reg_0
+   170   Reg_0 = 1
+   170   Stack_D = Reg_0
+   170   call Sym_53
+   171   goto Label_65
+   171 label Label_61
+   171   call Sym_15
+   171   no-op
+           optimizes label Label_65
+   172   goto Label_66
+   172 label Label_56
+   173   Reg_0 = Data_14
+   173   Stack_D = Reg_0
+   173   Reg_0 = 2
+   173   Stack_D = Reg_0
+   173   call Sym_53
+   174   no-op
+           optimizes   call Sym_69
+   174   Reg_0 = Stack_D
+   174   Reg_0 = -Reg_0
+   174   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   174   Reg_0 = 0
+   174   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   174   no-op
+           optimizes   Reg_1 = Stack_D
+   174   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   174   if Reg_0 == Reg_1 goto Label_67
+   174   Stack_R = Reg_0
+   174   Stack_R = Reg_1
+   174 label Label_68
+   174   Reg_0 = Data_15
+   174   Stack_D = Reg_0
+   174   Reg_0 = 1
+   174   Stack_D = Reg_0
+   174   call Sym_53
+   174   Reg_1 = Stack_R
+   174   Reg_1 += 1
+   174   Reg_0 = Stack_R
+   174   Stack_R = Reg_0
+   174   Stack_R = Reg_1
+   174   Reg_1 -= Reg_0
+   174   if Reg_1 != 0 goto Label_68
+   174   no-op
+           optimizes label Label_69
+   174   Reg_0 = Stack_R
+   174   Reg_0 = Stack_R
+   174 label Label_67
+   175   Reg_0 = Sym_1
+   175   Stack_D = Reg_0
+   175   call Sym_62
+   175   call Sym_59
+   171 label Label_65
+   176 label Label_66
+   176   tail call Sym_60
+           optimizes   call Sym_60
+   176 label Label_53
+   176 }
+
+   185 function Sym_76 {
+   186   Reg_0 = 0
+   186   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   186   Reg_0 = 0
+   186   no-op
+           optimizes   Stack_D = Reg_0
+   186   no-op
+           optimizes   Reg_0 = Sym_73
+   186   no-op
+           optimizes   Stack_D = Reg_0
+   186   no-op
+           optimizes   call Sym_5
+   186   no-op
+           optimizes   Reg_0 = Stack_D
+   186   *(Sym_73) = Reg_0
+   186   no-op
+           optimizes   Reg_0 = Sym_74
+   186   no-op
+           optimizes   Stack_D = Reg_0
+   186   no-op
+           optimizes   call Sym_5
+   186   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   186   *(Sym_74) = Reg_0
+   187   no-op
+           optimizes   call Sym_27
+   187   Reg_0 = 0
+   187   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   187   no-op
+           optimizes   call Sym_27
+   187   Reg_0 = 0
+   187   no-op
+           optimizes   Stack_D = Reg_0
+   187   no-op
+           optimizes   Reg_0 = Sym_70
+   187   no-op
+           optimizes   Stack_D = Reg_0
+   187   no-op
+           optimizes   call Sym_5
+   187   no-op
+           optimizes   Reg_0 = Stack_D
+   187   *(Sym_70) = Reg_0
+   187   no-op
+           optimizes   Reg_0 = Sym_75
+   187   no-op
+           optimizes   Stack_D = Reg_0
+   187   no-op
+           optimizes   call Sym_5
+   187   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   187   *(Sym_75) = Reg_0
+   188   Reg_0 = 0
+   188   Stack_F = Reg_0
+   188   Reg_0 = 0
+   188   Stack_F = Reg_0
+   188   Reg_0 = Sym_71
+   188   Stack_D = Reg_0
+   188   call Sym_77
+   188   Reg_0 = Sym_72
+   188   Stack_D = Reg_0
+   188   tail call Sym_77
+           optimizes   call Sym_77
+   188   no-op
+           optimizes label Label_70
+   188 }
+
+   190 function Sym_78 {
+   191   call Sym_50
+   191   Reg_0 = 48
+   191   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   191   no-op
+           optimizes   call Sym_42
+   191   no-op
+           optimizes   Reg_1 = Stack_D
+   191   Reg_0 = Stack_D
+   191   Reg_0 -= Reg_1
+   191   no-op
+           optimizes   Stack_D = Reg_0
+   192   no-op
+           optimizes   Reg_0 = 0
+   192   no-op
+           optimizes   Reg_1 = Reg_0
+   192   no-op
+           optimizes   Reg_1 = Stack_D
+   192   no-op
+           optimizes   Reg_0 = Stack_D
+   192   Stack_D = Reg_0
+   192   switch Reg_0 - 0 goto Label_152, Label_153, Label_154, Label_155, Label_156, Label_157, Label_158, Label_159, Label_160, Label_161 else Label_82
+   192 label Label_152
+           optimizes   if Reg_0 != Reg_1 goto Label_73
+   192   Reg_0 = 0
+   192   Stack_F = Reg_0
+   192   goto Label_72
+   192 label Label_73
+   192   no-op
+           optimizes   Reg_0 = 1
+   192   no-op
+           optimizes   Reg_1 = Reg_0
+   192   no-op
+           optimizes   Reg_1 = Stack_D
+   192   no-op
+           optimizes   Reg_0 = Stack_D
+   192   no-op
+           optimizes   Stack_D = Reg_0
+   192 label Label_153
+           optimizes   if Reg_0 != Reg_1 goto Label_74
+   192   Reg_0 = 1065353216
+   192   Stack_F = Reg_0
+   192   goto Label_72
+   192 label Label_74
+   192   no-op
+           optimizes   Reg_0 = 2
+   192   no-op
+           optimizes   Reg_1 = Reg_0
+   192   no-op
+           optimizes   Reg_1 = Stack_D
+   192   no-op
+           optimizes   Reg_0 = Stack_D
+   192   no-op
+           optimizes   Stack_D = Reg_0
+   192 label Label_154
+           optimizes   if Reg_0 != Reg_1 goto Label_75
+   192   Reg_0 = 1073741824
+   192   Stack_F = Reg_0
+   192   goto Label_72
+   192 label Label_75
+   192   no-op
+           optimizes   Reg_0 = 3
+   192   no-op
+           optimizes   Reg_1 = Reg_0
+   192   no-op
+           optimizes   Reg_1 = Stack_D
+   192   no-op
+           optimizes   Reg_0 = Stack_D
+   192   no-op
+           optimizes   Stack_D = Reg_0
+   192 label Label_155
+           optimizes   if Reg_0 != Reg_1 goto Label_76
+   192   Reg_0 = 1077936128
+   192   Stack_F = Reg_0
+   192   goto Label_72
+   192 label Label_76
+   192   no-op
+           optimizes   Reg_0 = 4
+   192   no-op
+           optimizes   Reg_1 = Reg_0
+   192   no-op
+           optimizes   Reg_1 = Stack_D
+   192   no-op
+           optimizes   Reg_0 = Stack_D
+   192   no-op
+           optimizes   Stack_D = Reg_0
+   192 label Label_156
+           optimizes   if Reg_0 != Reg_1 goto Label_77
+   192   Reg_0 = 1082130432
+   192   Stack_F = Reg_0
+   192   goto Label_72
+   192 label Label_77
+   193   no-op
+           optimizes   Reg_0 = 5
+   193   no-op
+           optimizes   Reg_1 = Reg_0
+   193   no-op
+           optimizes   Reg_1 = Stack_D
+   193   no-op
+           optimizes   Reg_0 = Stack_D
+   193   no-op
+           optimizes   Stack_D = Reg_0
+   193 label Label_157
+           optimizes   if Reg_0 != Reg_1 goto Label_78
+   193   Reg_0 = 1084227584
+   193   Stack_F = Reg_0
+   193   goto Label_72
+   193 label Label_78
+   193   no-op
+           optimizes   Reg_0 = 6
+   193   no-op
+           optimizes   Reg_1 = Reg_0
+   193   no-op
+           optimizes   Reg_1 = Stack_D
+   193   no-op
+           optimizes   Reg_0 = Stack_D
+   193   no-op
+           optimizes   Stack_D = Reg_0
+   193 label Label_158
+           optimizes   if Reg_0 != Reg_1 goto Label_79
+   193   Reg_0 = 1086324736
+   193   Stack_F = Reg_0
+   193   goto Label_72
+   193 label Label_79
+   193   no-op
+           optimizes   Reg_0 = 7
+   193   no-op
+           optimizes   Reg_1 = Reg_0
+   193   no-op
+           optimizes   Reg_1 = Stack_D
+   193   no-op
+           optimizes   Reg_0 = Stack_D
+   193   no-op
+           optimizes   Stack_D = Reg_0
+   193 label Label_159
+           optimizes   if Reg_0 != Reg_1 goto Label_80
+   193   Reg_0 = 1088421888
+   193   Stack_F = Reg_0
+   193   goto Label_72
+   193 label Label_80
+   193   no-op
+           optimizes   Reg_0 = 8
+   193   no-op
+           optimizes   Reg_1 = Reg_0
+   193   no-op
+           optimizes   Reg_1 = Stack_D
+   193   no-op
+           optimizes   Reg_0 = Stack_D
+   193   no-op
+           optimizes   Stack_D = Reg_0
+   193 label Label_160
+           optimizes   if Reg_0 != Reg_1 goto Label_81
+   193   Reg_0 = 1090519040
+   193   Stack_F = Reg_0
+   193   goto Label_72
+   193 label Label_81
+   193   no-op
+           optimizes   Reg_0 = 9
+   193   no-op
+           optimizes   Reg_1 = Reg_0
+   193   no-op
+           optimizes   Reg_1 = Stack_D
+   193   no-op
+           optimizes   Reg_0 = Stack_D
+   193   no-op
+           optimizes   Stack_D = Reg_0
+   193 label Label_161
+           optimizes   if Reg_0 != Reg_1 goto Label_82
+   193   Reg_0 = 1091567616
+   193   Stack_F = Reg_0
+   193   goto Label_72
+   193 label Label_82
+   194 label Label_72
+   194   Reg_0 = Stack_D
+   194   no-op
+           optimizes label Label_71
+   194 }
+
+   196 function Sym_79 {
+   197   Reg_0 = Sym_72
+   197   Stack_D = Reg_0
+   197   call Sym_80
+   197   no-op
+           optimizes   Reg_0 = Sym_73
+   197   no-op
+           optimizes   Stack_D = Reg_0
+   197   no-op
+           optimizes   call Sym_3
+   197   Reg_0 = *(Sym_73)
+   197   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   198   Reg_0 = 0
+   198   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   198   no-op
+           optimizes   Reg_1 = Stack_D
+   198   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   198   if Reg_0 == Reg_1 goto Label_84
+   198   Stack_R = Reg_0
+   198   Stack_R = Reg_1
+   198 label Label_85
+   198   Reg_0 = 1092616192
+   198   Stack_F = Reg_0
+   198   call Sym_37
+   198   Reg_1 = Stack_R
+   198   Reg_1 += 1
+   198   Reg_0 = Stack_R
+   198   Stack_R = Reg_0
+   198   Stack_R = Reg_1
+   198   Reg_1 -= Reg_0
+   198   if Reg_1 != 0 goto Label_85
+   198   no-op
+           optimizes label Label_86
+   198   Reg_0 = Stack_R
+   198   Reg_0 = Stack_R
+   198 label Label_84
+   200   Reg_0 = Sym_71
+   200   Stack_D = Reg_0
+   200   call Sym_80
+   200   call Sym_81
+   202   no-op
+           optimizes   Reg_0 = Sym_75
+   202   no-op
+           optimizes   Stack_D = Reg_0
+   202   no-op
+           optimizes   call Sym_3
+   202   Reg_0 = *(Sym_75)
+   202   Stack_D = Reg_0
+   202   no-op
+           optimizes   Reg_0 = Sym_74
+   202   no-op
+           optimizes   Stack_D = Reg_0
+   202   no-op
+           optimizes   call Sym_3
+   202   Reg_0 = *(Sym_74)
+   202   Stack_D = Reg_0
+   203   Reg_0 = 1024
+   203   Stack_D = Reg_0
+   203   call Sym_8
+   204   call Sym_40
+   204   Reg_0 = Stack_D
+   204   if Reg_0 == 0 goto Label_87
+   204   no-op
+           optimizes   call Sym_69
+   204   Reg_0 = Stack_D
+   204   Reg_0 = -Reg_0
+   204   Stack_D = Reg_0
+   204 label Label_87
+   206   call Sym_12
+   206   no-op
+           optimizes   call Sym_21
+   206   Reg_0 = Stack_D
+   206   if Reg_0 <= 0 goto Label_88
+   206   no-op
+           optimizes   Reg_0 = Stack_D
+   206   no-op
+           optimizes   if Reg_0 == 0 goto Label_88
+   207   Reg_0 = 0
+   207   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   207   no-op
+           optimizes   Reg_1 = Stack_D
+   207   Reg_0 = Stack_D
+   207   Stack_R = Reg_0
+   207   Stack_R = Reg_1
+   207 label Label_90
+   207   Reg_0 = 1092616192
+   207   Stack_F = Reg_0
+   207   call Sym_39
+   207   Reg_1 = Stack_R
+   207   Reg_1 += 1
+   207   Reg_0 = Stack_R
+   207   Stack_R = Reg_0
+   207   Stack_R = Reg_1
+   207   Reg_1 -= Reg_0
+   207   if Reg_1 != 0 goto Label_90
+   207   no-op
+           optimizes label Label_91
+   207   Reg_0 = Stack_R
+   207   Reg_0 = Stack_R
+   207   no-op
+           optimizes label Label_89
+   208   goto Label_92
+   208 label Label_88
+   209   no-op
+           optimizes   call Sym_69
+   209   Reg_0 = Stack_D
+   209   Reg_0 = -Reg_0
+   209   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   209   Reg_0 = 0
+   209   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   209   no-op
+           optimizes   Reg_1 = Stack_D
+   209   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   209   if Reg_0 == Reg_1 goto Label_93
+   209   Stack_R = Reg_0
+   209   Stack_R = Reg_1
+   209 label Label_94
+   209   Reg_0 = 1092616192
+   209   Stack_F = Reg_0
+   209   call Sym_37
+   209   Reg_1 = Stack_R
+   209   Reg_1 += 1
+   209   Reg_0 = Stack_R
+   209   Stack_R = Reg_0
+   209   Stack_R = Reg_1
+   209   Reg_1 -= Reg_0
+   209   if Reg_1 != 0 goto Label_94
+   209   no-op
+           optimizes label Label_95
+   209   Reg_0 = Stack_R
+   209   Reg_0 = Stack_R
+   209 label Label_93
+   207   no-op
+           optimizes label Label_89
+   210 label Label_92
+   212   no-op
+           optimizes   Reg_0 = Sym_70
+   212   no-op
+           optimizes   Stack_D = Reg_0
+   212   no-op
+           optimizes   call Sym_3
+   212   Reg_0 = *(Sym_70)
+   212   no-op
+           optimizes   Stack_D = Reg_0
+   213   no-op
+           optimizes   Reg_0 = Stack_D
+   213   if Reg_0 == 0 goto Label_96
+   213   tail call Sym_82
+           optimizes   call Sym_82
+   213 label Label_96
+   213   no-op
+           optimizes label Label_83
+   213 }
+
+   215 function Sym_83 {
+   216   call Sym_19
+   216   call Sym_84
+   216   call Sym_65
+   216   no-op
+           optimizes   call Sym_4
+   216   Reg_0 = Stack_D
+   216   if Reg_0 != 0 goto Label_98
+   216   no-op
+           optimizes   Reg_0 = Stack_D
+   216   no-op
+           optimizes   if Reg_0 == 0 goto Label_98
+   217   call Sym_23
+   217   Reg_0 = 0
+   217   Stack_F = Reg_0
+   217   no-op
+           optimizes   call Sym_26
+   217   Reg_0 = -1
+   217   Stack_D = Reg_0
+   217   goto Label_97
+   218 label Label_98
+   220   call Sym_76
+   230   Reg_0 = 0
+   230   Stack_D = Reg_0
+   230   call Sym_40
+   231   Reg_0 = 0
+   231   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   231   no-op
+           optimizes   Reg_1 = Stack_D
+   231   Reg_0 = Stack_D
+   231   if Reg_0 == Reg_1 goto Label_99
+   231   Stack_R = Reg_0
+   231   Stack_R = Reg_1
+   231 label Label_100
+   232   call Sym_50
+   232   call Sym_67
+   232   no-op
+           optimizes   call Sym_47
+   232   Reg_1 = Stack_D
+   232   Reg_0 = Stack_D
+   232   Reg_0 += Reg_1
+   232   Stack_D = Reg_0
+   232   call Sym_63
+   233   call Sym_40
+   234   no-op
+           optimizes   Reg_0 = 0
+   234   no-op
+           optimizes   Reg_1 = Reg_0
+   234   no-op
+           optimizes   Reg_1 = Stack_D
+   234   Reg_0 = Stack_D
+   234   Stack_D = Reg_0
+   234   switch Reg_0 - 0 goto Label_162, Label_163, Label_164, Label_165, Label_166, Label_167, Label_168 else Label_137
+   234 label Label_162
+           optimizes   if Reg_0 != Reg_1 goto Label_103
+   235   call Sym_50
+   235   Reg_0 = 45
+   235   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   235   no-op
+           optimizes   call Sym_14
+   235   no-op
+           optimizes   Reg_1 = Stack_D
+   235   Reg_0 = Stack_D
+   235   Reg_0 = Reg_0 == Reg_1
+   235   Stack_D = Reg_0
+   235   call Sym_22
+   235   call Sym_50
+   235   Reg_0 = 43
+   235   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   235   no-op
+           optimizes   call Sym_14
+   235   no-op
+           optimizes   Reg_1 = Stack_D
+   235   Reg_0 = Stack_D
+   235   Reg_0 = Reg_0 == Reg_1
+   235   Stack_D = Reg_0
+   235   call Sym_25
+   235   no-op
+           optimizes   call Sym_43
+   235   Reg_1 = Stack_D
+   235   Reg_0 = Stack_D
+   235   Reg_0 |= Reg_1
+   235   no-op
+           optimizes   Stack_D = Reg_0
+   235   no-op
+           optimizes   Reg_0 = Stack_D
+   235   if Reg_0 == 0 goto Label_104
+   236   call Sym_50
+   236   Reg_0 = 45
+   236   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   236   no-op
+           optimizes   call Sym_14
+   236   no-op
+           optimizes   Reg_1 = Stack_D
+   236   Reg_0 = Stack_D
+   236   if Reg_0 != Reg_1 goto Label_105
+   236   no-op
+           optimizes   Reg_0 = Stack_D
+   236   no-op
+           optimizes   if Reg_0 == 0 goto Label_105
+   236   Reg_0 = Sym_70
+   236   Stack_D = Reg_0
+   236   call Sym_12
+   236   call Sym_3
+   236   no-op
+           optimizes   call Sym_32
+   236   Reg_0 = Stack_D
+   236   Reg_0 = ~Reg_0
+   236   Stack_D = Reg_0
+   236   call Sym_40
+   236   call Sym_5
+   236 label Label_105
+   237   Reg_0 = 0
+   237   Stack_D = Reg_0
+   237   call Sym_40
+   239   goto Label_106
+   239 label Label_104
+   239   call Sym_50
+   239   Reg_0 = 46
+   239   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   239   no-op
+           optimizes   call Sym_14
+   239   no-op
+           optimizes   Reg_1 = Stack_D
+   239   Reg_0 = Stack_D
+   239   if Reg_0 != Reg_1 goto Label_107
+   239   no-op
+           optimizes   Reg_0 = Stack_D
+   239   no-op
+           optimizes   if Reg_0 == 0 goto Label_107
+   240   Reg_0 = 3
+   240   Stack_D = Reg_0
+   240   call Sym_40
+   242   goto Label_108
+   242 label Label_107
+   242   call Sym_50
+   242   Reg_0 = 48
+   242   Stack_D = Reg_0
+   242   Reg_0 = 58
+           optimizes   Reg_0 = 57
+   242   Stack_D = Reg_0
+   242   no-op
+           optimizes   call Sym_36
+   242   call Sym_85
+   242   Reg_0 = Stack_D
+   242   if Reg_0 == 0 goto Label_109
+   243   call Sym_78
+   243   Reg_0 = Sym_71
+   243   Stack_D = Reg_0
+   243   call Sym_77
+   244   Reg_0 = 1
+   244   Stack_D = Reg_0
+   244   call Sym_40
+   246   goto Label_110
+   246 label Label_109
+   246   Reg_0 = -1
+   246   Stack_D = Reg_0
+   246   call Sym_40
+   246   no-op
+           optimizes label Label_110
+   246   no-op
+           optimizes label Label_108
+   246   no-op
+           optimizes label Label_106
+   247   goto Label_102
+   247 label Label_103
+   248   no-op
+           optimizes   Reg_0 = 1
+   248   no-op
+           optimizes   Reg_1 = Reg_0
+   248   no-op
+           optimizes   Reg_1 = Stack_D
+   248   no-op
+           optimizes   Reg_0 = Stack_D
+   248   no-op
+           optimizes   Stack_D = Reg_0
+   248 label Label_163
+           optimizes   if Reg_0 != Reg_1 goto Label_111
+   249   call Sym_50
+   249   Reg_0 = 101
+   249   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   249   no-op
+           optimizes   call Sym_14
+   249   no-op
+           optimizes   Reg_1 = Stack_D
+   249   Reg_0 = Stack_D
+   249   Reg_0 = Reg_0 == Reg_1
+   249   Stack_D = Reg_0
+   249   call Sym_22
+   249   call Sym_50
+   249   Reg_0 = 69
+   249   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   249   no-op
+           optimizes   call Sym_14
+   249   no-op
+           optimizes   Reg_1 = Stack_D
+   249   Reg_0 = Stack_D
+   249   Reg_0 = Reg_0 == Reg_1
+   249   Stack_D = Reg_0
+   249   call Sym_25
+   249   no-op
+           optimizes   call Sym_43
+   249   Reg_1 = Stack_D
+   249   Reg_0 = Stack_D
+   249   Reg_0 |= Reg_1
+   249   no-op
+           optimizes   Stack_D = Reg_0
+   249   no-op
+           optimizes   Reg_0 = Stack_D
+   249   if Reg_0 == 0 goto Label_112
+   250   Reg_0 = 5
+   250   Stack_D = Reg_0
+   250   call Sym_40
+   252   goto Label_113
+   252 label Label_112
+   252   call Sym_50
+   252   Reg_0 = 46
+   252   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   252   no-op
+           optimizes   call Sym_14
+   252   no-op
+           optimizes   Reg_1 = Stack_D
+   252   Reg_0 = Stack_D
+   252   if Reg_0 != Reg_1 goto Label_114
+   252   no-op
+           optimizes   Reg_0 = Stack_D
+   252   no-op
+           optimizes   if Reg_0 == 0 goto Label_114
+   253   Reg_0 = 2
+   253   Stack_D = Reg_0
+   253   call Sym_40
+   255   goto Label_115
+   255 label Label_114
+   255   call Sym_50
+   255   Reg_0 = 48
+   255   Stack_D = Reg_0
+   255   Reg_0 = 58
+           optimizes   Reg_0 = 57
+   255   Stack_D = Reg_0
+   255   no-op
+           optimizes   call Sym_36
+   255   call Sym_85
+   255   Reg_0 = Stack_D
+   255   if Reg_0 == 0 goto Label_116
+   256   Reg_0 = Sym_71
+   256   Stack_D = Reg_0
+   256   call Sym_80
+   257   Reg_0 = 1092616192
+   257   Stack_F = Reg_0
+   257   call Sym_39
+   257   call Sym_78
+   257   call Sym_81
+   258   Reg_0 = Sym_71
+   258   Stack_D = Reg_0
+   258   call Sym_77
+   259   Reg_0 = 1
+   259   Stack_D = Reg_0
+   259   call Sym_40
+   261   goto Label_117
+   261 label Label_116
+   261   Reg_0 = -1
+   261   Stack_D = Reg_0
+   261   call Sym_40
+   261   no-op
+           optimizes label Label_117
+   261   no-op
+           optimizes label Label_115
+   261   no-op
+           optimizes label Label_113
+   262   goto Label_102
+   262 label Label_111
+   263   no-op
+           optimizes   Reg_0 = 2
+   263   no-op
+           optimizes   Reg_1 = Reg_0
+   263   no-op
+           optimizes   Reg_1 = Stack_D
+   263   no-op
+           optimizes   Reg_0 = Stack_D
+   263   no-op
+           optimizes   Stack_D = Reg_0
+   263 label Label_164
+           optimizes   if Reg_0 != Reg_1 goto Label_118
+   264   call Sym_50
+   264   Reg_0 = 101
+   264   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   264   no-op
+           optimizes   call Sym_14
+   264   no-op
+           optimizes   Reg_1 = Stack_D
+   264   Reg_0 = Stack_D
+   264   Reg_0 = Reg_0 == Reg_1
+   264   Stack_D = Reg_0
+   264   call Sym_22
+   264   call Sym_50
+   264   Reg_0 = 69
+   264   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   264   no-op
+           optimizes   call Sym_14
+   264   no-op
+           optimizes   Reg_1 = Stack_D
+   264   Reg_0 = Stack_D
+   264   Reg_0 = Reg_0 == Reg_1
+   264   Stack_D = Reg_0
+   264   call Sym_25
+   264   no-op
+           optimizes   call Sym_43
+   264   Reg_1 = Stack_D
+   264   Reg_0 = Stack_D
+   264   Reg_0 |= Reg_1
+   264   no-op
+           optimizes   Stack_D = Reg_0
+   264   no-op
+           optimizes   Reg_0 = Stack_D
+   264   if Reg_0 == 0 goto Label_119
+   265   Reg_0 = 5
+   265   Stack_D = Reg_0
+   265   call Sym_40
+   267   goto Label_120
+   267 label Label_119
+   267   call Sym_50
+   267   Reg_0 = 48
+   267   Stack_D = Reg_0
+   267   Reg_0 = 58
+           optimizes   Reg_0 = 57
+   267   Stack_D = Reg_0
+   267   no-op
+           optimizes   call Sym_36
+   267   call Sym_85
+   267   Reg_0 = Stack_D
+   267   if Reg_0 == 0 goto Label_121
+   268   call Sym_78
+   268   Reg_0 = Sym_72
+   268   Stack_D = Reg_0
+   268   call Sym_77
+   269   Reg_0 = 1
+   269   no-op
+           optimizes   Stack_D = Reg_0
+   269   no-op
+           optimizes   Reg_0 = Sym_73
+   269   no-op
+           optimizes   Stack_D = Reg_0
+   269   no-op
+           optimizes   call Sym_5
+   269   no-op
+           optimizes   Reg_0 = Stack_D
+   269   *(Sym_73) = Reg_0
+   270   Reg_0 = 4
+   270   Stack_D = Reg_0
+   270   call Sym_40
+   272   goto Label_122
+   272 label Label_121
+   272   Reg_0 = -1
+   272   Stack_D = Reg_0
+   272   call Sym_40
+   272   no-op
+           optimizes label Label_122
+   272   no-op
+           optimizes label Label_120
+   273   goto Label_102
+   273 label Label_118
+   274   no-op
+           optimizes   Reg_0 = 3
+   274   no-op
+           optimizes   Reg_1 = Reg_0
+   274   no-op
+           optimizes   Reg_1 = Stack_D
+   274   no-op
+           optimizes   Reg_0 = Stack_D
+   274   no-op
+           optimizes   Stack_D = Reg_0
+   274 label Label_165
+           optimizes   if Reg_0 != Reg_1 goto Label_123
+   275   call Sym_50
+   275   Reg_0 = 48
+   275   Stack_D = Reg_0
+   275   Reg_0 = 58
+           optimizes   Reg_0 = 57
+   275   Stack_D = Reg_0
+   275   no-op
+           optimizes   call Sym_36
+   275   call Sym_85
+   275   Reg_0 = Stack_D
+   275   if Reg_0 == 0 goto Label_124
+   276   call Sym_78
+   276   Reg_0 = Sym_72
+   276   Stack_D = Reg_0
+   276   call Sym_77
+   277   Reg_0 = 1
+   277   no-op
+           optimizes   Stack_D = Reg_0
+   277   no-op
+           optimizes   Reg_0 = Sym_73
+   277   no-op
+           optimizes   Stack_D = Reg_0
+   277   no-op
+           optimizes   call Sym_5
+   277   no-op
+           optimizes   Reg_0 = Stack_D
+   277   *(Sym_73) = Reg_0
+   278   Reg_0 = 4
+   278   Stack_D = Reg_0
+   278   call Sym_40
+   280   goto Label_125
+   280 label Label_124
+   280   Reg_0 = -1
+   280   Stack_D = Reg_0
+   280   call Sym_40
+   280   no-op
+           optimizes label Label_125
+   281   goto Label_102
+   281 label Label_123
+   282   no-op
+           optimizes   Reg_0 = 4
+   282   no-op
+           optimizes   Reg_1 = Reg_0
+   282   no-op
+           optimizes   Reg_1 = Stack_D
+   282   no-op
+           optimizes   Reg_0 = Stack_D
+   282   no-op
+           optimizes   Stack_D = Reg_0
+   282 label Label_166
+           optimizes   if Reg_0 != Reg_1 goto Label_126
+   283   call Sym_50
+   283   Reg_0 = 101
+   283   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   283   no-op
+           optimizes   call Sym_14
+   283   no-op
+           optimizes   Reg_1 = Stack_D
+   283   Reg_0 = Stack_D
+   283   Reg_0 = Reg_0 == Reg_1
+   283   Stack_D = Reg_0
+   283   call Sym_22
+   283   call Sym_50
+   283   Reg_0 = 69
+   283   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   283   no-op
+           optimizes   call Sym_14
+   283   no-op
+           optimizes   Reg_1 = Stack_D
+   283   Reg_0 = Stack_D
+   283   Reg_0 = Reg_0 == Reg_1
+   283   Stack_D = Reg_0
+   283   call Sym_25
+   283   no-op
+           optimizes   call Sym_43
+   283   Reg_1 = Stack_D
+   283   Reg_0 = Stack_D
+   283   Reg_0 |= Reg_1
+   283   no-op
+           optimizes   Stack_D = Reg_0
+   283   no-op
+           optimizes   Reg_0 = Stack_D
+   283   if Reg_0 == 0 goto Label_127
+   284   Reg_0 = 5
+   284   Stack_D = Reg_0
+   284   call Sym_40
+   286   goto Label_128
+   286 label Label_127
+   286   call Sym_50
+   286   Reg_0 = 48
+   286   Stack_D = Reg_0
+   286   Reg_0 = 58
+           optimizes   Reg_0 = 57
+   286   Stack_D = Reg_0
+   286   no-op
+           optimizes   call Sym_36
+   286   call Sym_85
+   286   Reg_0 = Stack_D
+   286   if Reg_0 == 0 goto Label_129
+   287   Reg_0 = Sym_72
+   287   Stack_D = Reg_0
+   287   call Sym_80
+   288   Reg_0 = 1092616192
+   288   Stack_F = Reg_0
+   288   call Sym_39
+   288   call Sym_78
+   288   call Sym_81
+   289   Reg_0 = Sym_72
+   289   Stack_D = Reg_0
+   289   call Sym_77
+   290   Reg_0 = Sym_73
+   290   Stack_D = Reg_0
+   290   call Sym_12
+   290   call Sym_3
+   290   no-op
+           optimizes   call Sym_36
+   290   Reg_0 = Stack_D
+   290   Reg_0 += 1
+   290   Stack_D = Reg_0
+   290   call Sym_40
+   290   call Sym_5
+   291   Reg_0 = 4
+   291   Stack_D = Reg_0
+   291   call Sym_40
+   293   goto Label_130
+   293 label Label_129
+   293   Reg_0 = -1
+   293   Stack_D = Reg_0
+   293   call Sym_40
+   293   no-op
+           optimizes label Label_130
+   293   no-op
+           optimizes label Label_128
+   294   goto Label_102
+   294 label Label_126
+   295   no-op
+           optimizes   Reg_0 = 5
+   295   no-op
+           optimizes   Reg_1 = Reg_0
+   295   no-op
+           optimizes   Reg_1 = Stack_D
+   295   no-op
+           optimizes   Reg_0 = Stack_D
+   295   no-op
+           optimizes   Stack_D = Reg_0
+   295 label Label_167
+           optimizes   if Reg_0 != Reg_1 goto Label_131
+   296   call Sym_50
+   296   Reg_0 = 45
+   296   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   296   no-op
+           optimizes   call Sym_14
+   296   no-op
+           optimizes   Reg_1 = Stack_D
+   296   Reg_0 = Stack_D
+   296   Reg_0 = Reg_0 == Reg_1
+   296   Stack_D = Reg_0
+   296   call Sym_22
+   296   call Sym_50
+   296   Reg_0 = 43
+   296   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   296   no-op
+           optimizes   call Sym_14
+   296   no-op
+           optimizes   Reg_1 = Stack_D
+   296   Reg_0 = Stack_D
+   296   Reg_0 = Reg_0 == Reg_1
+   296   Stack_D = Reg_0
+   296   call Sym_25
+   296   no-op
+           optimizes   call Sym_43
+   296   Reg_1 = Stack_D
+   296   Reg_0 = Stack_D
+   296   Reg_0 |= Reg_1
+   296   no-op
+           optimizes   Stack_D = Reg_0
+   296   no-op
+           optimizes   Reg_0 = Stack_D
+   296   if Reg_0 == 0 goto Label_132
+   297   call Sym_50
+   297   Reg_0 = 45
+   297   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   297   no-op
+           optimizes   call Sym_14
+   297   no-op
+           optimizes   Reg_1 = Stack_D
+   297   Reg_0 = Stack_D
+   297   if Reg_0 != Reg_1 goto Label_133
+   297   no-op
+           optimizes   Reg_0 = Stack_D
+   297   no-op
+           optimizes   if Reg_0 == 0 goto Label_133
+   297   Reg_0 = Sym_75
+   297   Stack_D = Reg_0
+   297   call Sym_12
+   297   call Sym_3
+   297   no-op
+           optimizes   call Sym_32
+   297   Reg_0 = Stack_D
+   297   Reg_0 = ~Reg_0
+   297   Stack_D = Reg_0
+   297   call Sym_40
+   297   call Sym_5
+   297 label Label_133
+   298   Reg_0 = 5
+   298   Stack_D = Reg_0
+   298   call Sym_40
+   300   goto Label_134
+   300 label Label_132
+   300   call Sym_50
+   300   Reg_0 = 48
+   300   Stack_D = Reg_0
+   300   Reg_0 = 58
+           optimizes   Reg_0 = 57
+   300   Stack_D = Reg_0
+   300   no-op
+           optimizes   call Sym_36
+   300   call Sym_85
+   300   Reg_0 = Stack_D
+   300   if Reg_0 == 0 goto Label_135
+   301   call Sym_50
+   301   Reg_0 = 48
+   301   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   301   no-op
+           optimizes   call Sym_42
+   301   no-op
+           optimizes   Reg_1 = Stack_D
+   301   Reg_0 = Stack_D
+   301   Reg_0 -= Reg_1
+   301   no-op
+           optimizes   Stack_D = Reg_0
+   301   no-op
+           optimizes   Reg_0 = Sym_74
+   301   no-op
+           optimizes   Stack_D = Reg_0
+   301   no-op
+           optimizes   call Sym_5
+   301   no-op
+           optimizes   Reg_0 = Stack_D
+   301   *(Sym_74) = Reg_0
+   302   Reg_0 = 6
+   302   Stack_D = Reg_0
+   302   call Sym_40
+   304   goto Label_136
+   304 label Label_135
+   304   Reg_0 = -1
+   304   Stack_D = Reg_0
+   304   call Sym_40
+   304   no-op
+           optimizes label Label_136
+   304   no-op
+           optimizes label Label_134
+   305   goto Label_102
+   305 label Label_131
+   306   no-op
+           optimizes   Reg_0 = 6
+   306   no-op
+           optimizes   Reg_1 = Reg_0
+   306   no-op
+           optimizes   Reg_1 = Stack_D
+   306   no-op
+           optimizes   Reg_0 = Stack_D
+   306   no-op
+           optimizes   Stack_D = Reg_0
+   306 label Label_168
+           optimizes   if Reg_0 != Reg_1 goto Label_137
+   307   call Sym_50
+   307   Reg_0 = 48
+   307   Stack_D = Reg_0
+   307   Reg_0 = 58
+           optimizes   Reg_0 = 57
+   307   Stack_D = Reg_0
+   307   no-op
+           optimizes   call Sym_36
+   307   call Sym_85
+   307   Reg_0 = Stack_D
+   307   if Reg_0 == 0 goto Label_138
+   308   call Sym_50
+   308   Reg_0 = 48
+   308   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   308   no-op
+           optimizes   call Sym_42
+   308   no-op
+           optimizes   Reg_1 = Stack_D
+   308   Reg_0 = Stack_D
+   308   Reg_0 -= Reg_1
+   308   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   308   no-op
+           optimizes   Reg_0 = Sym_74
+   308   no-op
+           optimizes   Stack_D = Reg_0
+   308   no-op
+           optimizes   call Sym_3
+   308   Reg_0 = *(Sym_74)
+   308   no-op
+           optimizes   Stack_D = Reg_0
+   309   no-op
+           optimizes   Reg_0 = 10
+   309   no-op
+           optimizes   Stack_D = Reg_0
+   309   no-op
+           optimizes   call Sym_45
+   309   no-op
+           optimizes   Reg_0 = Stack_D
+   309   Reg_0 *= 10
+   309   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   309   no-op
+           optimizes   call Sym_47
+   309   no-op
+           optimizes   Reg_1 = Stack_D
+   309   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   309   Reg_0 += Reg_1
+   309   no-op
+           optimizes   Stack_D = Reg_0
+   309   no-op
+           optimizes   Reg_0 = Sym_74
+   309   no-op
+           optimizes   Stack_D = Reg_0
+   309   no-op
+           optimizes   call Sym_5
+   309   no-op
+           optimizes   Reg_0 = Stack_D
+   309   *(Sym_74) = Reg_0
+   310   Reg_0 = 6
+   310   Stack_D = Reg_0
+   310   call Sym_40
+   312   goto Label_139
+   312 label Label_138
+   312   Reg_0 = -1
+   312   Stack_D = Reg_0
+   312   call Sym_40
+   312   no-op
+           optimizes label Label_139
+   313   goto Label_102
+   313 label Label_137
+   246 label Label_106
+   246 label Label_108
+   246 label Label_110
+   261 label Label_113
+   261 label Label_115
+   261 label Label_117
+   272 label Label_120
+   272 label Label_122
+   280 label Label_125
+   293 label Label_128
+   293 label Label_130
+   304 label Label_134
+   304 label Label_136
+   312 label Label_139
+   314 label Label_102
+   314   Reg_0 = Stack_D
+   314   call Sym_65
+   315   call Sym_12
+   315   no-op
+           optimizes   call Sym_86
+   315   Reg_0 = Stack_D
+   315   if Reg_0 >= 0 goto Label_140
+   315   no-op
+           optimizes   Reg_0 = Stack_D
+   315   no-op
+           optimizes   if Reg_0 == 0 goto Label_140
+   316   call Sym_23
+   316   no-op
+           optimizes   call Sym_27
+   316   Reg_0 = 0
+   316   Stack_D = Reg_0
+   316   tail call Sym_87
+           optimizes   call Sym_87
+   316   no-op
+           optimizes   goto Label_97
+   317 label Label_140
+   318   Reg_1 = Stack_R
+   318   Reg_1 += 1
+   318   Reg_0 = Stack_R
+   318   Stack_R = Reg_0
+   318   Stack_R = Reg_1
+   318   Reg_1 -= Reg_0
+   318   if Reg_1 != 0 goto Label_100
+   318   no-op
+           optimizes label Label_101
+   318   Reg_0 = Stack_R
+   318   Reg_0 = Stack_R
+   318 label Label_99
+   320   call Sym_65
+   321   call Sym_12
+   321   Reg_0 = 1
+   321   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   321   no-op
+           optimizes   call Sym_14
+   321   no-op
+           optimizes   Reg_1 = Stack_D
+   321   Reg_0 = Stack_D
+   321   Reg_0 = Reg_0 == Reg_1
+   321   Stack_D = Reg_0
+   321   call Sym_50
+   321   Reg_0 = 2
+   321   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   321   no-op
+           optimizes   call Sym_14
+   321   no-op
+           optimizes   Reg_1 = Stack_D
+   321   Reg_0 = Stack_D
+   321   Reg_0 = Reg_0 == Reg_1
+   321   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   321   no-op
+           optimizes   call Sym_43
+   321   no-op
+           optimizes   Reg_1 = Stack_D
+   321   Reg_0 = Stack_D
+   321   Reg_0 |= Reg_1
+   321   Stack_D = Reg_0
+   321   call Sym_50
+   321   Reg_0 = 4
+   321   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   321   no-op
+           optimizes   call Sym_14
+   321   no-op
+           optimizes   Reg_1 = Stack_D
+   321   Reg_0 = Stack_D
+   321   Reg_0 = Reg_0 == Reg_1
+   321   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   321   no-op
+           optimizes   call Sym_43
+   321   no-op
+           optimizes   Reg_1 = Stack_D
+   321   Reg_0 = Stack_D
+   321   Reg_0 |= Reg_1
+   321   Stack_D = Reg_0
+   321   call Sym_40
+   321   Reg_0 = 6
+   321   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   321   no-op
+           optimizes   call Sym_14
+   321   no-op
+           optimizes   Reg_1 = Stack_D
+   321   Reg_0 = Stack_D
+   321   Reg_0 = Reg_0 == Reg_1
+   321   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   321   no-op
+           optimizes   call Sym_43
+   321   no-op
+           optimizes   Reg_1 = Stack_D
+   321   Reg_0 = Stack_D
+   321   Reg_0 |= Reg_1
+   321   no-op
+           optimizes   Stack_D = Reg_0
+   322   no-op
+           optimizes   call Sym_32
+   322   no-op
+           optimizes   Reg_0 = Stack_D
+   322   Reg_0 = ~Reg_0
+   322   no-op
+           optimizes   Stack_D = Reg_0
+   322   no-op
+           optimizes   Reg_0 = Stack_D
+   322   if Reg_0 == 0 goto Label_141
+   322   no-op
+           optimizes   call Sym_27
+   322   Reg_0 = 0
+   322   Stack_D = Reg_0
+   322   goto Label_97
+   322 label Label_141
+   324   call Sym_79
+   324   no-op
+           optimizes   call Sym_26
+   324   Reg_0 = -1
+   324   Stack_D = Reg_0
+   324 label Label_97
+   324 }
+
+Peephole rewrites:
+  v4___Parenrepresent_Question_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parenrepresent_Question_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_represent: jump-next: jmp .L11 => (none)
+  v4_represent: exchange-push: xchg %rdx,%rax; call v4__rpush@PLT; xchg %rax,%rdx => mov %rdx,%rax; call v4__rpush@PLT
+  v4_represent: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4_represent: redundant-test: test %rdx,%rdx => (none)
+  v4_represent: exchange-push: xchg %rdx,%rax; call v4__rpush@PLT; xchg %rax,%rdx => mov %rdx,%rax; call v4__rpush@PLT
+  v4_represent: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4_represent: redundant-test: test %rdx,%rdx => (none)
+  v4_represent: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_represent: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_represent: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4_represent: redundant-test: test %rdx,%rdx => (none)
+  v4_fe_Dot: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_fe_Dot: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_fe_Dot: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parenprecision_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parenprecision_Closeparen: redundant-test: test %rax,%rax => (none)
+  v4_f_Dot: exchange-push: xchg %rdx,%rax; call v4__rpush@PLT; xchg %rax,%rdx => mov %rdx,%rax; call v4__rpush@PLT
+  v4_f_Dot: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_f_Dot: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4_f_Dot: redundant-test: test %rdx,%rdx => (none)
+  v4_f_Dot: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4_f_Dot: redundant-test: test %rdx,%rdx => (none)
+  v4_f_Dot: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4_f_Dot: redundant-test: test %rdx,%rdx => (none)
+  v4___Parenctof_Closeparen: jump-next: jmp .L72 => (none)
+  v4___Parencombine_Closeparen: exchange-push: xchg %rdx,%rax; call v4__rpush@PLT; xchg %rax,%rdx => mov %rdx,%rax; call v4__rpush@PLT
+  v4___Parencombine_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4___Parencombine_Closeparen: redundant-test: test %rdx,%rdx => (none)
+  v4___Parencombine_Closeparen: exchange-push: xchg %rdx,%rax; call v4__rpush@PLT; xchg %rax,%rdx => mov %rdx,%rax; call v4__rpush@PLT
+  v4___Parencombine_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4___Parencombine_Closeparen: redundant-test: test %rdx,%rdx => (none)
+  v4___Parencombine_Closeparen: exchange-push: xchg %rdx,%rax; call v4__rpush@PLT; xchg %rax,%rdx => mov %rdx,%rax; call v4__rpush@PLT
+  v4___Parencombine_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4___Parencombine_Closeparen: redundant-test: test %rdx,%rdx => (none)
+  v4_Greaterfloat: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Greaterfloat: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Greaterfloat: redundant-test: test %rax,%rax => (none)
+  v4_Greaterfloat: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Greaterfloat: redundant-test: test %rax,%rax => (none)
+  v4_Greaterfloat: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Greaterfloat: redundant-test: test %rax,%rax => (none)
+  v4_Greaterfloat: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Greaterfloat: redundant-test: test %rax,%rax => (none)
+  v4_Greaterfloat: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Greaterfloat: redundant-test: test %rax,%rax => (none)
+  v4_Greaterfloat: jump-next: jmp .L102 => (none)
+  v4_Greaterfloat: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4_Greaterfloat: redundant-test: test %rdx,%rdx => (none)
+
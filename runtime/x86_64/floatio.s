@@ -0,0 +1,2495 @@
+	.file	"floatio.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"floatio.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC1:
+	.string "+"
+.LC0:
+.LC6:
+.LC8:
+.LC10:
+	.string "-"
+.LC7:
+.LC9:
+.LC11:
+.LC13:
+	.string "."
+.LC12:
+.LC15:
+	.string "0"
+.LC14:
+	.string "0."
+.LC4:
+	.string "E"
+.LC3:
+	.string "Inf "
+.LC2:
+	.string "NaN "
+.LC5:
+	.string "e"
+.stabs	"v4___Parenfexp_Closeparen:G2",40,0,0,v4___Parenfexp_Closeparen
+	.comm  v4___Parenfexp_Closeparen,8,8
+.stabs	"v4___Parenfexp_sign_Closeparen:G2",40,0,0,v4___Parenfexp_sign_Closeparen
+	.comm  v4___Parenfexp_sign_Closeparen,8,8
+.stabs	"v4___Parenffrac_Closeparen:G2",40,0,0,v4___Parenffrac_Closeparen
+	.comm  v4___Parenffrac_Closeparen,8,8
+.stabs	"v4___Parenffrac_scale_Closeparen:G2",40,0,0,v4___Parenffrac_scale_Closeparen
+	.comm  v4___Parenffrac_scale_Closeparen,8,8
+.stabs	"v4___Parenfint_Closeparen:G2",40,0,0,v4___Parenfint_Closeparen
+	.comm  v4___Parenfint_Closeparen,8,8
+.stabs	"v4___Parenfsign_Closeparen:G2",40,0,0,v4___Parenfsign_Closeparen
+	.comm  v4___Parenfsign_Closeparen,8,8
+.stabs	"v4__fsbuf:Gar2;0;7;4",40,0,0,v4__fsbuf
+	.comm  v4__fsbuf,8,1
+.stabs	"v4__precision:G2",40,0,0,v4__precision
+	.comm  v4__precision,8,8
+.text
+	.align 4
+.stabs "v4_precision:F1",36,0,0,v4_precision
+	.weak v4_precision
+	.type	v4_precision,@function
+v4_precision:
+.stabn 68,0,32,.LMa0-v4_precision
+.LMa0:
+0:
+.stabn 68,0,32,.LMb0-v4_precision
+.LMb0:
+.LBB2:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	test %rax,%rax
+	jne .L2
+.stabn 68,0,34,.LM11-v4_precision
+.LM11:
+	mov $8,%rax
+	mov v4__precision@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.L2:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.LBE2:
+.stabn 68,0,35,.LM25-v4_precision
+.LM25:
+	ret
+.Lfe2:
+	.size	 v4_precision,.Lfe2-v4_precision
+.stabn	192,0,0,.LBB2-v4_precision
+.stabn	224,0,0,.LBE2-v4_precision
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4_precision
+.text
+	.align 4
+.stabs "v4_set_Minusprecision:F1",36,0,0,v4_set_Minusprecision
+	.weak v4_set_Minusprecision
+	.type	v4_set_Minusprecision,@function
+v4_set_Minusprecision:
+.stabn 68,0,37,.LMa26-v4_set_Minusprecision
+.LMa26:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,37,.LMb26-v4_set_Minusprecision
+.LMb26:
+.LBB6:
+.stabn 68,0,38,.LM27-v4_set_Minusprecision
+.LM27:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_max@PLT
+	mov $8,%rax
+	call v4__dpush@PLT
+	call v4_min@PLT
+	call v4__dpop@PLT
+	mov v4__precision@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.LBE6:
+.stabn 68,0,38,.LM39-v4_set_Minusprecision
+.LM39:
+	pop %rbx
+	leave
+	ret
+.Lfe6:
+	.size	 v4_set_Minusprecision,.Lfe6-v4_set_Minusprecision
+.stabn	192,0,0,.LBB6-v4_set_Minusprecision
+.stabn	224,0,0,.LBE6-v4_set_Minusprecision
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4_set_Minusprecision
+.text
+	.align 4
+.stabs "v4___Parenrepresent_Question_Closeparen:F1",36,0,0,v4___Parenrepresent_Question_Closeparen
+	.weak v4___Parenrepresent_Question_Closeparen
+	.type	v4___Parenrepresent_Question_Closeparen,@function
+v4___Parenrepresent_Question_Closeparen:
+.stabn 68,0,40,.LMa40-v4___Parenrepresent_Question_Closeparen
+.LMa40:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,40,.LMb40-v4___Parenrepresent_Question_Closeparen
+.LMb40:
+.LBB9:
+.stabn 68,0,41,.LM41-v4___Parenrepresent_Question_Closeparen
+.LM41:
+	call v4_fdup@PLT
+	call v4_f_Greater@PLT
+.stabn 68,0,42,.LM43-v4___Parenrepresent_Question_Closeparen
+.LM43:
+	call v4_dup@PLT
+	movabs $4286578688,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jne .L5
+	call v4_drop@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	jmp .L4
+.L5:
+.stabn 68,0,43,.LM60-v4___Parenrepresent_Question_Closeparen
+.LM60:
+	call v4_dup@PLT
+	mov $2139095040,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jne .L6
+	call v4_drop@PLT
+	mov $2,%rax
+	call v4__dpush@PLT
+	jmp .L4
+.L6:
+.stabn 68,0,44,.LM77-v4___Parenrepresent_Question_Closeparen
+.LM77:
+	call v4_dup@PLT
+	movabs $4286578688,%rax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	call v4_rot@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	and %rdx,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jne .L7
+	call v4_drop@PLT
+	mov $3,%rax
+	call v4__dpush@PLT
+	jmp .L4
+.L7:
+.stabn 68,0,45,.LM101-v4___Parenrepresent_Question_Closeparen
+.LM101:
+	call v4_dup@PLT
+	mov $2139095040,%rax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	call v4_rot@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	and %rdx,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jne .L8
+	call v4_drop@PLT
+	mov $4,%rax
+	call v4__dpush@PLT
+	jmp .L4
+.L8:
+.stabn 68,0,46,.LM125-v4___Parenrepresent_Question_Closeparen
+.LM125:
+	call v4_drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+.L4:
+.LBE9:
+.stabn 68,0,46,.LM129-v4___Parenrepresent_Question_Closeparen
+.LM129:
+	pop %rbx
+	leave
+	ret
+.Lfe9:
+	.size	 v4___Parenrepresent_Question_Closeparen,.Lfe9-v4___Parenrepresent_Question_Closeparen
+.stabn	192,0,0,.LBB9-v4___Parenrepresent_Question_Closeparen
+.stabn	224,0,0,.LBE9-v4___Parenrepresent_Question_Closeparen
+.Lscope9:
+.stabs	"",36,0,0,.Lscope9-v4___Parenrepresent_Question_Closeparen
+.text
+	.align 4
+.stabs "v4_represent:F1",36,0,0,v4_represent
+	.weak v4_represent
+	.type	v4_represent,@function
+v4_represent:
+.stabn 68,0,48,.LMa130-v4_represent
+.LMa130:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,48,.LMb130-v4_represent
+.LMb130:
+.LBB18:
+.stabn 68,0,49,.LM131-v4_represent
+.LM131:
+	call v4_z2dup@PLT
+	mov $48,%rax
+	call v4__dpush@PLT
+	call v4_fill@PLT
+.stabn 68,0,51,.LM135-v4_represent
+.LM135:
+	call v4___Parenrepresent_Question_Closeparen@PLT
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jle .L10
+.stabn 68,0,52,.LM142-v4_represent
+.LM142:
+	call v4_Greaterr@PLT
+	call v4_z2drop@PLT
+	call v4_fdrop@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	sub $1,%rax
+	cmp $3,%rax
+	ja .L15
+	lea .LT15(%rip),%rdx
+	movslq (%rdx,%rax,4),%rax
+	add %rdx,%rax
+	jmp *%rax
+.section	.rodata
+	.align 4
+.LT15:
+	.long .L148-.LT15
+	.long .L149-.LT15
+	.long .L150-.LT15
+	.long .L151-.LT15
+.text
+.L148:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L11
+.L12:
+.L149:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L11
+.L13:
+.L150:
+	xor %rax,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L11
+.L14:
+.L151:
+	xor %rax,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+.L15:
+.L11:
+	call v4__dpop@PLT
+	call v4_z2_Greaterr@PLT
+	call v4_drop@PLT
+	call v4_z2r_Greater@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L9
+.L10:
+	call v4_drop@PLT
+.stabn 68,0,59,.LM218-v4_represent
+.LM218:
+	call v4_fdup@PLT
+	call v4_f0_Equals@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L16
+.stabn 68,0,60,.LM222-v4_represent
+.LM222:
+	call v4_z2drop@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_f_Greater@PLT
+	mov $31,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xchg %rdx,%rcx
+	shr %cl,%rax
+	xchg %rdx,%rcx
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	not %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	jmp .L9
+.L16:
+.stabn 68,0,64,.LM246-v4_represent
+.LM246:
+	call v4_fdup@PLT
+	call v4_f0_Less@PLT
+	call v4_fabs@PLT
+.stabn 68,0,66,.LM249-v4_represent
+.LM249:
+	xor %rax,%rax
+	call v4__dpush@PLT
+.L17:
+.stabn 68,0,68,.LM252-v4_represent
+.LM252:
+	call v4_fdup@PLT
+	mov $1065353216,%rax
+	call v4__fpush@PLT
+	call v4_f_Less@PLT
+	call v4__dpop@PLT
+	not %rax
+	test %rax,%rax
+	je .L18
+	call v4__dpop@PLT
+	inc %rax
+	call v4__dpush@PLT
+	mov $1092616192,%rax
+	call v4__fpush@PLT
+	call v4_f_Slash@PLT
+.stabn 68,0,70,.LM269-v4_represent
+.LM269:
+	jmp .L17
+.L18:
+.L19:
+.stabn 68,0,72,.LM272-v4_represent
+.LM272:
+	call v4_fdup@PLT
+	mov $1036831949,%rax
+	call v4__fpush@PLT
+	call v4_f_Less@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L20
+	call v4__dpop@PLT
+	dec %rax
+	call v4__dpush@PLT
+	mov $1092616192,%rax
+	call v4__fpush@PLT
+	call v4_f_Star@PLT
+.stabn 68,0,74,.LM285-v4_represent
+.LM285:
+	jmp .L19
+.L20:
+.stabn 68,0,75,.LM287-v4_represent
+.LM287:
+	call v4_z2_Greaterr@PLT
+.stabn 68,0,77,.LM288-v4_represent
+.LM288:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L21
+.stabn 68,0,78,.LM294-v4_represent
+.LM294:
+	call v4_z2drop@PLT
+	call v4_fdrop@PLT
+.stabn 68,0,79,.LM296-v4_represent
+.LM296:
+	call v4_z2r_Greater@PLT
+	call v4_swap@PLT
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	jmp .L9
+.L21:
+.stabn 68,0,82,.LM303-v4_represent
+.LM303:
+	call v4_dup@PLT
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__rpush@PLT
+	mov %rdx,%rax
+	call v4__rpush@PLT
+.L23:
+	mov $1092616192,%rax
+	call v4__fpush@PLT
+	call v4_f_Star@PLT
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L23
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+	call v4_fround@PLT
+.stabn 68,0,83,.LM326-v4_represent
+.LM326:
+	call v4_dup@PLT
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__rpush@PLT
+	mov %rdx,%rax
+	call v4__rpush@PLT
+.L26:
+	mov $1092616192,%rax
+	call v4__fpush@PLT
+	call v4_f_Slash@PLT
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L26
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.stabn 68,0,85,.LM348-v4_represent
+.LM348:
+	call v4_fdup@PLT
+	mov $1065353216,%rax
+	call v4__fpush@PLT
+	call v4_f_Less@PLT
+	call v4__dpop@PLT
+	not %rax
+	test %rax,%rax
+	je .L28
+.stabn 68,0,86,.LM358-v4_represent
+.LM358:
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	inc %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	mov $1092616192,%rax
+	call v4__fpush@PLT
+	call v4_f_Slash@PLT
+.L28:
+.stabn 68,0,89,.LM368-v4_represent
+.LM368:
+	call v4_f_Greater@PLT
+.stabn 68,0,90,.LM369-v4_represent
+.LM369:
+	call v4_dup@PLT
+	mov $23,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xchg %rdx,%rcx
+	shr %cl,%rax
+	xchg %rdx,%rcx
+	mov %rax,%r8
+	mov $255,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	and %rdx,%rax
+	mov %rax,%r8
+	mov $127,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	sub %rdx,%rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,91,.LM392-v4_represent
+.LM392:
+	mov $8388607,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	and %rdx,%rax
+	mov %rax,%r8
+	mov $8388608,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	or %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,92,.LM413-v4_represent
+.LM413:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	mov $23,%rax
+	call v4__dpush@PLT
+	call v4_r_Fetch@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xchg %rdx,%rcx
+	shl %cl,%rax
+	xchg %rdx,%rcx
+	dec %rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	and %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,93,.LM437-v4_represent
+.LM437:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	mov $23,%rax
+	call v4__dpush@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xchg %rdx,%rcx
+	shl %cl,%rax
+	xchg %rdx,%rcx
+	call v4__dpush@PLT
+.stabn 68,0,95,.LM452-v4_represent
+.LM452:
+	call v4_swap@PLT
+.stabn 68,0,96,.LM453-v4_represent
+.LM453:
+	call v4_rot@PLT
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+.L30:
+.stabn 68,0,97,.LM461-v4_represent
+.LM461:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L32
+	jmp .L31
+.L32:
+	call v4__dpop@PLT
+	lea (%rax,%rax,4),%rax
+	add %rax,%rax
+	call v4__dpush@PLT
+.stabn 68,0,99,.LM475-v4_represent
+.LM475:
+	call v4_z2dup@PLT
+	call v4_swap@PLT
+	call v4_Slash@PLT
+	mov $48,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+	mov $3,%rax
+	call v4__dpush@PLT
+	call v4_pick@PLT
+	call v4_c_Store@PLT
+.stabn 68,0,100,.LM489-v4_represent
+.LM489:
+	call v4_over@PLT
+	call v4_mod@PLT
+.stabn 68,0,101,.LM491-v4_represent
+.LM491:
+	call v4_z2_Greaterr@PLT
+	call v4__dpop@PLT
+	inc %rax
+	call v4__dpush@PLT
+	call v4_z2r_Greater@PLT
+.stabn 68,0,102,.LM497-v4_represent
+.LM497:
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L30
+.L31:
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+	call v4_z2drop@PLT
+.stabn 68,0,104,.LM509-v4_represent
+.LM509:
+	call v4_drop@PLT
+	call v4_z2r_Greater@PLT
+	call v4_swap@PLT
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+.L9:
+.LBE18:
+.stabn 68,0,105,.LM516-v4_represent
+.LM516:
+	pop %rbx
+	leave
+	ret
+.Lfe18:
+	.size	 v4_represent,.Lfe18-v4_represent
+.stabn	192,0,0,.LBB18-v4_represent
+.stabn	224,0,0,.LBE18-v4_represent
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4_represent
+.text
+	.align 4
+.stabs "v4___Parenrepresent_Closeparen:F1",36,0,0,v4___Parenrepresent_Closeparen
+	.weak v4___Parenrepresent_Closeparen
+	.type	v4___Parenrepresent_Closeparen,@function
+v4___Parenrepresent_Closeparen:
+.stabn 68,0,107,.LMa517-v4___Parenrepresent_Closeparen
+.LMa517:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,107,.LMb517-v4___Parenrepresent_Closeparen
+.LMb517:
+.LBB52:
+.stabn 68,0,108,.LM518-v4___Parenrepresent_Closeparen
+.LM518:
+	mov v4__fsbuf@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+.stabn 68,0,33,.LM521-v4___Parenrepresent_Closeparen
+.LM521:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	test %rax,%rax
+	jne .L142
+.stabn 68,0,34,.LM523-v4___Parenrepresent_Closeparen
+.LM523:
+	mov $8,%rax
+	mov v4__precision@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.L142:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.stabn 68,0,108,.LM528-v4___Parenrepresent_Closeparen
+.LM528:
+	call v4_represent@PLT
+.stabn 68,0,109,.LM529-v4___Parenrepresent_Closeparen
+.LM529:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L34
+	jmp .L33
+.L34:
+.stabn 68,0,111,.LM534-v4___Parenrepresent_Closeparen
+.LM534:
+	call v4_rot@PLT
+	call v4_rot@PLT
+.stabn 68,0,112,.LM536-v4___Parenrepresent_Closeparen
+.LM536:
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L35
+	lea .LC0(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L36
+.L35:
+	lea .LC1(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.L36:
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L37
+	lea .LC2(%rip),%rax
+	call v4__dpush@PLT
+	mov $4,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4__type@PLT
+.L37:
+	lea .LC3(%rip),%rax
+	call v4__dpush@PLT
+	mov $4,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4__type@PLT
+.L38:
+.L33:
+.LBE52:
+.stabn 68,0,113,.LM570-v4___Parenrepresent_Closeparen
+.LM570:
+	pop %rbx
+	leave
+	ret
+.Lfe52:
+	.size	 v4___Parenrepresent_Closeparen,.Lfe52-v4___Parenrepresent_Closeparen
+.stabn	192,0,0,.LBB52-v4___Parenrepresent_Closeparen
+.stabn	224,0,0,.LBE52-v4___Parenrepresent_Closeparen
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4___Parenrepresent_Closeparen
+.text
+	.align 4
+.stabs "v4___Parenprintexp_Closeparen:F1",36,0,0,v4___Parenprintexp_Closeparen
+	.weak v4___Parenprintexp_Closeparen
+	.type	v4___Parenprintexp_Closeparen,@function
+v4___Parenprintexp_Closeparen:
+.stabn 68,0,115,.LMa571-v4___Parenprintexp_Closeparen
+.LMa571:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,115,.LMb571-v4___Parenprintexp_Closeparen
+.LMb571:
+.LBB54:
+.stabn 68,0,116,.LM572-v4___Parenprintexp_Closeparen
+.LM572:
+	call v4__strictansi@PLT
+	call v4_Fetch@PLT
+.stabn 68,0,117,.LM574-v4___Parenprintexp_Closeparen
+.LM574:
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L40
+	lea .LC4(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	jmp .L41
+.L40:
+	lea .LC5(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.L41:
+.stabn 68,0,119,.LM589-v4___Parenprintexp_Closeparen
+.LM589:
+	call v4_base@PLT
+	call v4_Fetch@PLT
+	call v4_Greaterr@PLT
+	mov $10,%rax
+	call v4__dpush@PLT
+	call v4_base@PLT
+	call v4_Store@PLT
+.stabn 68,0,120,.LM596-v4___Parenprintexp_Closeparen
+.LM596:
+	xor %rax,%rax
+	call v4__dpush@PLT
+	call v4_Dotr@PLT
+.stabn 68,0,121,.LM599-v4___Parenprintexp_Closeparen
+.LM599:
+	call v4_r_Greater@PLT
+	call v4_base@PLT
+	pop %rbx
+	leave
+	jmp v4_Store@PLT
+.LBE54:
+.stabn 68,0,121,.LM603-v4___Parenprintexp_Closeparen
+.LM603:
+	pop %rbx
+	leave
+	ret
+.Lfe54:
+	.size	 v4___Parenprintexp_Closeparen,.Lfe54-v4___Parenprintexp_Closeparen
+.stabn	192,0,0,.LBB54-v4___Parenprintexp_Closeparen
+.stabn	224,0,0,.LBE54-v4___Parenprintexp_Closeparen
+.Lscope54:
+.stabs	"",36,0,0,.Lscope54-v4___Parenprintexp_Closeparen
+.text
+	.align 4
+.stabs "v4_fs_Dot:F1",36,0,0,v4_fs_Dot
+	.weak v4_fs_Dot
+	.type	v4_fs_Dot,@function
+v4_fs_Dot:
+.stabn 68,0,123,.LMa604-v4_fs_Dot
+.LMa604:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,123,.LMb604-v4_fs_Dot
+.LMb604:
+.LBB58:
+.stabn 68,0,124,.LM605-v4_fs_Dot
+.LM605:
+	call v4___Parenrepresent_Closeparen@PLT
+	call v4__dpop@PLT
+	not %rax
+	test %rax,%rax
+	je .L43
+	jmp .L42
+.L43:
+.stabn 68,0,125,.LM614-v4_fs_Dot
+.LM614:
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L44
+	lea .LC6(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.L44:
+.stabn 68,0,127,.LM622-v4_fs_Dot
+.LM622:
+	mov v4__fsbuf@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_type@PLT
+	lea .LC7(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.stabn 68,0,128,.LM632-v4_fs_Dot
+.LM632:
+	mov v4__fsbuf@GOTPCREL(%rip),%rax
+	inc %rax
+	call v4__dpush@PLT
+.stabn 68,0,33,.LM639-v4_fs_Dot
+.LM639:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	test %rax,%rax
+	jne .L143
+.stabn 68,0,34,.LM641-v4_fs_Dot
+.LM641:
+	mov $8,%rax
+	mov v4__precision@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.L143:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_type@PLT
+	call v4__dpop@PLT
+	dec %rax
+	call v4__dpush@PLT
+.stabn 68,0,131,.LM655-v4_fs_Dot
+.LM655:
+	call v4___Parenprintexp_Closeparen@PLT
+	pop %rbx
+	leave
+	jmp v4_space@PLT
+.L42:
+.LBE58:
+.stabn 68,0,131,.LM658-v4_fs_Dot
+.LM658:
+	pop %rbx
+	leave
+	ret
+.Lfe58:
+	.size	 v4_fs_Dot,.Lfe58-v4_fs_Dot
+.stabn	192,0,0,.LBB58-v4_fs_Dot
+.stabn	224,0,0,.LBE58-v4_fs_Dot
+.Lscope58:
+.stabs	"",36,0,0,.Lscope58-v4_fs_Dot
+.text
+	.align 4
+.stabs "v4_fe_Dot:F1",36,0,0,v4_fe_Dot
+	.weak v4_fe_Dot
+	.type	v4_fe_Dot,@function
+v4_fe_Dot:
+.stabn 68,0,133,.LMa659-v4_fe_Dot
+.LMa659:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,133,.LMb659-v4_fe_Dot
+.LMb659:
+.LBB61:
+.stabn 68,0,134,.LM660-v4_fe_Dot
+.LM660:
+	call v4___Parenrepresent_Closeparen@PLT
+	call v4__dpop@PLT
+	not %rax
+	test %rax,%rax
+	je .L46
+	jmp .L45
+.L46:
+.stabn 68,0,135,.LM669-v4_fe_Dot
+.LM669:
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L47
+	lea .LC8(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.L47:
+.stabn 68,0,137,.LM677-v4_fe_Dot
+.LM677:
+	call v4_dup@PLT
+	mov $41,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	inc %rax
+	call v4__dpush@PLT
+.stabn 68,0,140,.LM695-v4_fe_Dot
+.LM695:
+	mov v4__fsbuf@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+.stabn 68,0,33,.LM698-v4_fe_Dot
+.LM698:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	test %rax,%rax
+	jne .L144
+.stabn 68,0,34,.LM700-v4_fe_Dot
+.LM700:
+	mov $8,%rax
+	mov v4__precision@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.L144:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+	mov $8,%rax
+	call v4__dpush@PLT
+.stabn 68,0,33,.LM713-v4_fe_Dot
+.LM713:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	test %rax,%rax
+	jne .L145
+.stabn 68,0,34,.LM715-v4_fe_Dot
+.LM715:
+	mov $8,%rax
+	mov v4__precision@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.L145:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,141,.LM725-v4_fe_Dot
+.LM725:
+	mov $48,%rax
+	call v4__dpush@PLT
+	call v4_fill@PLT
+.stabn 68,0,143,.LM728-v4_fe_Dot
+.LM728:
+	mov v4__fsbuf@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	call v4_type@PLT
+	lea .LC9(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.stabn 68,0,144,.LM737-v4_fe_Dot
+.LM737:
+	mov v4__fsbuf@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,33,.LM746-v4_fe_Dot
+.LM746:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	test %rax,%rax
+	jne .L146
+.stabn 68,0,34,.LM748-v4_fe_Dot
+.LM748:
+	mov $8,%rax
+	mov v4__precision@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.L146:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.stabn 68,0,145,.LM753-v4_fe_Dot
+.LM753:
+	mov $2,%rax
+	call v4__dpush@PLT
+	call v4_pick@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,146,.LM761-v4_fe_Dot
+.LM761:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jle .L48
+	call v4_type@PLT
+	jmp .L49
+.L48:
+	call v4_z2drop@PLT
+.L49:
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,149,.LM777-v4_fe_Dot
+.LM777:
+	call v4___Parenprintexp_Closeparen@PLT
+	pop %rbx
+	leave
+	jmp v4_space@PLT
+.L45:
+.LBE61:
+.stabn 68,0,149,.LM780-v4_fe_Dot
+.LM780:
+	pop %rbx
+	leave
+	ret
+.Lfe61:
+	.size	 v4_fe_Dot,.Lfe61-v4_fe_Dot
+.stabn	192,0,0,.LBB61-v4_fe_Dot
+.stabn	224,0,0,.LBE61-v4_fe_Dot
+.Lscope61:
+.stabs	"",36,0,0,.Lscope61-v4_fe_Dot
+.text
+	.align 4
+.stabs "v4___Parenprecision_Closeparen:F1",36,0,0,v4___Parenprecision_Closeparen
+	.weak v4___Parenprecision_Closeparen
+	.type	v4___Parenprecision_Closeparen,@function
+v4___Parenprecision_Closeparen:
+.stabn 68,0,151,.LMa781-v4___Parenprecision_Closeparen
+.LMa781:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,151,.LMb781-v4___Parenprecision_Closeparen
+.LMb781:
+.LBB62:
+.stabn 68,0,152,.LM782-v4___Parenprecision_Closeparen
+.LM782:
+	mov v4__fsbuf@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+.stabn 68,0,33,.LM785-v4___Parenprecision_Closeparen
+.LM785:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	test %rax,%rax
+	jne .L147
+.stabn 68,0,34,.LM787-v4___Parenprecision_Closeparen
+.LM787:
+	mov $8,%rax
+	mov v4__precision@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.L147:
+	mov v4__precision@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.L51:
+.stabn 68,0,154,.LM793-v4___Parenprecision_Closeparen
+.LM793:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+.stabn 68,0,155,.LM804-v4___Parenprecision_Closeparen
+.LM804:
+	mov $48,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	and %rdx,%rax
+	je .L52
+	call v4__dpop@PLT
+	dec %rax
+	call v4__dpush@PLT
+	jmp .L51
+.L52:
+.stabn 68,0,157,.LM832-v4___Parenprecision_Closeparen
+.LM832:
+	pop %rbx
+	leave
+	jmp v4_nip@PLT
+.LBE62:
+.stabn 68,0,157,.LM834-v4___Parenprecision_Closeparen
+.LM834:
+	pop %rbx
+	leave
+	ret
+.Lfe62:
+	.size	 v4___Parenprecision_Closeparen,.Lfe62-v4___Parenprecision_Closeparen
+.stabn	192,0,0,.LBB62-v4___Parenprecision_Closeparen
+.stabn	224,0,0,.LBE62-v4___Parenprecision_Closeparen
+.Lscope62:
+.stabs	"",36,0,0,.Lscope62-v4___Parenprecision_Closeparen
+.text
+	.align 4
+.stabs "v4_f_Dot:F1",36,0,0,v4_f_Dot
+	.weak v4_f_Dot
+	.type	v4_f_Dot,@function
+v4_f_Dot:
+.stabn 68,0,159,.LMa835-v4_f_Dot
+.LMa835:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,159,.LMb835-v4_f_Dot
+.LMb835:
+.LBB66:
+.stabn 68,0,160,.LM836-v4_f_Dot
+.LM836:
+	call v4___Parenrepresent_Closeparen@PLT
+	call v4__dpop@PLT
+	not %rax
+	test %rax,%rax
+	je .L54
+	jmp .L53
+.L54:
+.stabn 68,0,161,.LM845-v4_f_Dot
+.LM845:
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L55
+	lea .LC10(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.L55:
+.stabn 68,0,163,.LM853-v4_f_Dot
+.LM853:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jle .L56
+.stabn 68,0,164,.LM859-v4_f_Dot
+.LM859:
+	call v4___Parenprecision_Closeparen@PLT
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__rpush@PLT
+	mov %rdx,%rax
+	call v4__rpush@PLT
+.L58:
+.stabn 68,0,165,.LM867-v4_f_Dot
+.LM867:
+	mov v4__fsbuf@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+	call v4_emit@PLT
+	call v4__dpop@PLT
+	dec %rax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L60
+	lea .LC11(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.L60:
+.stabn 68,0,167,.LM893-v4_f_Dot
+.LM893:
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L58
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.stabn 68,0,168,.LM904-v4_f_Dot
+.LM904:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jle .L61
+.stabn 68,0,169,.LM910-v4_f_Dot
+.LM910:
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+.L63:
+	lea .LC12(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L63
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.stabn 68,0,170,.LM933-v4_f_Dot
+.LM933:
+	lea .LC13(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.stabn 68,0,171,.LM938-v4_f_Dot
+.LM938:
+	jmp .L65
+.L61:
+	call v4_drop@PLT
+.stabn 68,0,172,.LM942-v4_f_Dot
+.LM942:
+	jmp .L66
+.L56:
+.stabn 68,0,173,.LM944-v4_f_Dot
+.LM944:
+	lea .LC14(%rip),%rax
+	call v4__dpush@PLT
+	mov $2,%rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	call v4__dpop@PLT
+	neg %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rax,%rdx
+	je .L67
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+.L68:
+	lea .LC15(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L68
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.L67:
+.stabn 68,0,175,.LM977-v4_f_Dot
+.LM977:
+	mov v4__fsbuf@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4___Parenprecision_Closeparen@PLT
+	call v4_type@PLT
+.L65:
+.L66:
+	pop %rbx
+	leave
+	jmp v4_space@PLT
+.L53:
+.LBE66:
+.stabn 68,0,176,.LM985-v4_f_Dot
+.LM985:
+	pop %rbx
+	leave
+	ret
+.Lfe66:
+	.size	 v4_f_Dot,.Lfe66-v4_f_Dot
+.stabn	192,0,0,.LBB66-v4_f_Dot
+.stabn	224,0,0,.LBE66-v4_f_Dot
+.Lscope66:
+.stabs	"",36,0,0,.Lscope66-v4_f_Dot
+.text
+	.align 4
+.stabs "v4___Parenconvinit_Closeparen:F1",36,0,0,v4___Parenconvinit_Closeparen
+	.weak v4___Parenconvinit_Closeparen
+	.type	v4___Parenconvinit_Closeparen,@function
+v4___Parenconvinit_Closeparen:
+.stabn 68,0,185,.LMa986-v4___Parenconvinit_Closeparen
+.LMa986:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,185,.LMb986-v4___Parenconvinit_Closeparen
+.LMb986:
+.LBB76:
+.stabn 68,0,186,.LM987-v4___Parenconvinit_Closeparen
+.LM987:
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov v4___Parenffrac_scale_Closeparen@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+	mov %r8,%rax
+	mov v4___Parenfexp_Closeparen@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov v4___Parenfsign_Closeparen@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+	mov %r8,%rax
+	mov v4___Parenfexp_sign_Closeparen@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.stabn 68,0,188,.LM1017-v4___Parenconvinit_Closeparen
+.LM1017:
+	xor %rax,%rax
+	call v4__fpush@PLT
+	xor %rax,%rax
+	call v4__fpush@PLT
+	mov v4___Parenfint_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_f_Store@PLT
+	mov v4___Parenffrac_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_f_Store@PLT
+.LBE76:
+.stabn 68,0,188,.LM1028-v4___Parenconvinit_Closeparen
+.LM1028:
+	pop %rbx
+	leave
+	ret
+.Lfe76:
+	.size	 v4___Parenconvinit_Closeparen,.Lfe76-v4___Parenconvinit_Closeparen
+.stabn	192,0,0,.LBB76-v4___Parenconvinit_Closeparen
+.stabn	224,0,0,.LBE76-v4___Parenconvinit_Closeparen
+.Lscope76:
+.stabs	"",36,0,0,.Lscope76-v4___Parenconvinit_Closeparen
+.text
+	.align 4
+.stabs "v4___Parenctof_Closeparen:F1",36,0,0,v4___Parenctof_Closeparen
+	.weak v4___Parenctof_Closeparen
+	.type	v4___Parenctof_Closeparen,@function
+v4___Parenctof_Closeparen:
+.stabn 68,0,190,.LMa1029-v4___Parenctof_Closeparen
+.LMa1029:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,190,.LMb1029-v4___Parenctof_Closeparen
+.LMb1029:
+.LBB78:
+.stabn 68,0,191,.LM1030-v4___Parenctof_Closeparen
+.LM1030:
+	call v4_over@PLT
+	mov $48,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	call v4__dpush@PLT
+	cmp $9,%rax
+	ja .L82
+	lea .LT82(%rip),%rdx
+	movslq (%rdx,%rax,4),%rax
+	add %rdx,%rax
+	jmp *%rax
+.section	.rodata
+	.align 4
+.LT82:
+	.long .L152-.LT82
+	.long .L153-.LT82
+	.long .L154-.LT82
+	.long .L155-.LT82
+	.long .L156-.LT82
+	.long .L157-.LT82
+	.long .L158-.LT82
+	.long .L159-.LT82
+	.long .L160-.LT82
+	.long .L161-.LT82
+.text
+.L152:
+	xor %rax,%rax
+	call v4__fpush@PLT
+	jmp .L72
+.L73:
+.L153:
+	mov $1065353216,%rax
+	call v4__fpush@PLT
+	jmp .L72
+.L74:
+.L154:
+	mov $1073741824,%rax
+	call v4__fpush@PLT
+	jmp .L72
+.L75:
+.L155:
+	mov $1077936128,%rax
+	call v4__fpush@PLT
+	jmp .L72
+.L76:
+.L156:
+	mov $1082130432,%rax
+	call v4__fpush@PLT
+	jmp .L72
+.L77:
+.L157:
+	mov $1084227584,%rax
+	call v4__fpush@PLT
+	jmp .L72
+.L78:
+.L158:
+	mov $1086324736,%rax
+	call v4__fpush@PLT
+	jmp .L72
+.L79:
+.L159:
+	mov $1088421888,%rax
+	call v4__fpush@PLT
+	jmp .L72
+.L80:
+.L160:
+	mov $1090519040,%rax
+	call v4__fpush@PLT
+	jmp .L72
+.L81:
+.L161:
+	mov $1091567616,%rax
+	call v4__fpush@PLT
+.L82:
+.L72:
+	call v4__dpop@PLT
+.LBE78:
+.stabn 68,0,194,.LM1142-v4___Parenctof_Closeparen
+.LM1142:
+	pop %rbx
+	leave
+	ret
+.Lfe78:
+	.size	 v4___Parenctof_Closeparen,.Lfe78-v4___Parenctof_Closeparen
+.stabn	192,0,0,.LBB78-v4___Parenctof_Closeparen
+.stabn	224,0,0,.LBE78-v4___Parenctof_Closeparen
+.Lscope78:
+.stabs	"",36,0,0,.Lscope78-v4___Parenctof_Closeparen
+.text
+	.align 4
+.stabs "v4___Parencombine_Closeparen:F1",36,0,0,v4___Parencombine_Closeparen
+	.weak v4___Parencombine_Closeparen
+	.type	v4___Parencombine_Closeparen,@function
+v4___Parencombine_Closeparen:
+.stabn 68,0,196,.LMa1143-v4___Parencombine_Closeparen
+.LMa1143:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,196,.LMb1143-v4___Parencombine_Closeparen
+.LMb1143:
+.LBB79:
+.stabn 68,0,197,.LM1144-v4___Parencombine_Closeparen
+.LM1144:
+	mov v4___Parenffrac_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_f_Fetch@PLT
+	mov v4___Parenffrac_scale_Closeparen@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	mov %rax,%r8
+.stabn 68,0,198,.LM1152-v4___Parencombine_Closeparen
+.LM1152:
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rax,%rdx
+	je .L84
+	call v4__rpush@PLT
+	mov %rdx,%rax
+	call v4__rpush@PLT
+.L85:
+	mov $1092616192,%rax
+	call v4__fpush@PLT
+	call v4_f_Slash@PLT
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L85
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.L84:
+.stabn 68,0,200,.LM1174-v4___Parencombine_Closeparen
+.LM1174:
+	mov v4___Parenfint_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_f_Fetch@PLT
+	call v4_f_Plus@PLT
+	mov v4___Parenfexp_sign_Closeparen@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+	mov v4___Parenfexp_Closeparen@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.stabn 68,0,203,.LM1188-v4___Parencombine_Closeparen
+.LM1188:
+	mov $1024,%rax
+	call v4__dpush@PLT
+	call v4_min@PLT
+.stabn 68,0,204,.LM1191-v4___Parencombine_Closeparen
+.LM1191:
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L87
+	call v4__dpop@PLT
+	neg %rax
+	call v4__dpush@PLT
+.L87:
+.stabn 68,0,206,.LM1199-v4___Parencombine_Closeparen
+.LM1199:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jle .L88
+.stabn 68,0,207,.LM1205-v4___Parencombine_Closeparen
+.LM1205:
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__rpush@PLT
+	mov %rdx,%rax
+	call v4__rpush@PLT
+.L90:
+	mov $1092616192,%rax
+	call v4__fpush@PLT
+	call v4_f_Star@PLT
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L90
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.stabn 68,0,208,.LM1226-v4___Parencombine_Closeparen
+.LM1226:
+	jmp .L92
+.L88:
+	call v4__dpop@PLT
+	neg %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rax,%rdx
+	je .L93
+	call v4__rpush@PLT
+	mov %rdx,%rax
+	call v4__rpush@PLT
+.L94:
+	mov $1092616192,%rax
+	call v4__fpush@PLT
+	call v4_f_Slash@PLT
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L94
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.L93:
+.L92:
+	mov v4___Parenfsign_Closeparen@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	test %rax,%rax
+	je .L96
+	pop %rbx
+	leave
+	jmp v4_fnegate@PLT
+.L96:
+.LBE79:
+.stabn 68,0,213,.LM1266-v4___Parencombine_Closeparen
+.LM1266:
+	pop %rbx
+	leave
+	ret
+.Lfe79:
+	.size	 v4___Parencombine_Closeparen,.Lfe79-v4___Parencombine_Closeparen
+.stabn	192,0,0,.LBB79-v4___Parencombine_Closeparen
+.stabn	224,0,0,.LBE79-v4___Parencombine_Closeparen
+.Lscope79:
+.stabs	"",36,0,0,.Lscope79-v4___Parencombine_Closeparen
+.text
+	.align 4
+.stabs "v4_Greaterfloat:F1",36,0,0,v4_Greaterfloat
+	.weak v4_Greaterfloat
+	.type	v4_Greaterfloat,@function
+v4_Greaterfloat:
+.stabn 68,0,215,.LMa1267-v4_Greaterfloat
+.LMa1267:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,215,.LMb1267-v4_Greaterfloat
+.LMb1267:
+.LBB83:
+.stabn 68,0,216,.LM1268-v4_Greaterfloat
+.LM1268:
+	call v4_z2dup@PLT
+	call v4_Minustrailing@PLT
+	call v4_nip@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L98
+.stabn 68,0,217,.LM1276-v4_Greaterfloat
+.LM1276:
+	call v4_z2drop@PLT
+	xor %rax,%rax
+	call v4__fpush@PLT
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	jmp .L97
+.L98:
+.stabn 68,0,220,.LM1284-v4_Greaterfloat
+.LM1284:
+	call v4___Parenconvinit_Closeparen@PLT
+.stabn 68,0,230,.LM1285-v4_Greaterfloat
+.LM1285:
+	xor %rax,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,231,.LM1288-v4_Greaterfloat
+.LM1288:
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rax,%rdx
+	je .L99
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+.L100:
+.stabn 68,0,232,.LM1296-v4_Greaterfloat
+.LM1296:
+	call v4_over@PLT
+	call v4_i@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+	call v4_c_Fetch@PLT
+.stabn 68,0,233,.LM1304-v4_Greaterfloat
+.LM1304:
+	call v4_swap@PLT
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp $6,%rax
+	ja .L137
+	lea .LT137(%rip),%rdx
+	movslq (%rdx,%rax,4),%rax
+	add %rdx,%rax
+	jmp *%rax
+.section	.rodata
+	.align 4
+.LT137:
+	.long .L162-.LT137
+	.long .L163-.LT137
+	.long .L164-.LT137
+	.long .L165-.LT137
+	.long .L166-.LT137
+	.long .L167-.LT137
+	.long .L168-.LT137
+.text
+.L162:
+.stabn 68,0,235,.LM1312-v4_Greaterfloat
+.LM1312:
+	call v4_over@PLT
+	mov $45,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4_over@PLT
+	mov $43,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	or %rdx,%rax
+	je .L104
+.stabn 68,0,236,.LM1337-v4_Greaterfloat
+.LM1337:
+	call v4_over@PLT
+	mov $45,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jne .L105
+	mov v4___Parenfsign_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	call v4_Store@PLT
+.L105:
+.stabn 68,0,237,.LM1357-v4_Greaterfloat
+.LM1357:
+	xor %rax,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,239,.LM1360-v4_Greaterfloat
+.LM1360:
+	jmp .L106
+.L104:
+	call v4_over@PLT
+	mov $46,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jne .L107
+.stabn 68,0,240,.LM1371-v4_Greaterfloat
+.LM1371:
+	mov $3,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,242,.LM1374-v4_Greaterfloat
+.LM1374:
+	jmp .L108
+.L107:
+	call v4_over@PLT
+	mov $48,%rax
+	call v4__dpush@PLT
+	mov $58,%rax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L109
+.stabn 68,0,243,.LM1385-v4_Greaterfloat
+.LM1385:
+	call v4___Parenctof_Closeparen@PLT
+	mov v4___Parenfint_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_f_Store@PLT
+.stabn 68,0,244,.LM1389-v4_Greaterfloat
+.LM1389:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,246,.LM1392-v4_Greaterfloat
+.LM1392:
+	jmp .L110
+.L109:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,247,.LM1400-v4_Greaterfloat
+.LM1400:
+	jmp .L102
+.L103:
+.L163:
+.stabn 68,0,249,.LM1408-v4_Greaterfloat
+.LM1408:
+	call v4_over@PLT
+	mov $101,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4_over@PLT
+	mov $69,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	or %rdx,%rax
+	je .L112
+.stabn 68,0,250,.LM1433-v4_Greaterfloat
+.LM1433:
+	mov $5,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,252,.LM1436-v4_Greaterfloat
+.LM1436:
+	jmp .L113
+.L112:
+	call v4_over@PLT
+	mov $46,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jne .L114
+.stabn 68,0,253,.LM1447-v4_Greaterfloat
+.LM1447:
+	mov $2,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,255,.LM1450-v4_Greaterfloat
+.LM1450:
+	jmp .L115
+.L114:
+	call v4_over@PLT
+	mov $48,%rax
+	call v4__dpush@PLT
+	mov $58,%rax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L116
+.stabn 68,0,256,.LM1461-v4_Greaterfloat
+.LM1461:
+	mov v4___Parenfint_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_f_Fetch@PLT
+.stabn 68,0,257,.LM1464-v4_Greaterfloat
+.LM1464:
+	mov $1092616192,%rax
+	call v4__fpush@PLT
+	call v4_f_Star@PLT
+	call v4___Parenctof_Closeparen@PLT
+	call v4_f_Plus@PLT
+.stabn 68,0,258,.LM1469-v4_Greaterfloat
+.LM1469:
+	mov v4___Parenfint_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_f_Store@PLT
+.stabn 68,0,259,.LM1472-v4_Greaterfloat
+.LM1472:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,261,.LM1475-v4_Greaterfloat
+.LM1475:
+	jmp .L117
+.L116:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,262,.LM1483-v4_Greaterfloat
+.LM1483:
+	jmp .L102
+.L111:
+.L164:
+.stabn 68,0,264,.LM1491-v4_Greaterfloat
+.LM1491:
+	call v4_over@PLT
+	mov $101,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4_over@PLT
+	mov $69,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	or %rdx,%rax
+	je .L119
+.stabn 68,0,265,.LM1516-v4_Greaterfloat
+.LM1516:
+	mov $5,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,267,.LM1519-v4_Greaterfloat
+.LM1519:
+	jmp .L120
+.L119:
+	call v4_over@PLT
+	mov $48,%rax
+	call v4__dpush@PLT
+	mov $58,%rax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L121
+.stabn 68,0,268,.LM1530-v4_Greaterfloat
+.LM1530:
+	call v4___Parenctof_Closeparen@PLT
+	mov v4___Parenffrac_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_f_Store@PLT
+.stabn 68,0,269,.LM1534-v4_Greaterfloat
+.LM1534:
+	xor %rax,%rax
+	inc %rax
+	mov v4___Parenffrac_scale_Closeparen@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.stabn 68,0,270,.LM1541-v4_Greaterfloat
+.LM1541:
+	mov $4,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,272,.LM1544-v4_Greaterfloat
+.LM1544:
+	jmp .L122
+.L121:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,273,.LM1551-v4_Greaterfloat
+.LM1551:
+	jmp .L102
+.L118:
+.L165:
+.stabn 68,0,275,.LM1559-v4_Greaterfloat
+.LM1559:
+	call v4_over@PLT
+	mov $48,%rax
+	call v4__dpush@PLT
+	mov $58,%rax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L124
+.stabn 68,0,276,.LM1568-v4_Greaterfloat
+.LM1568:
+	call v4___Parenctof_Closeparen@PLT
+	mov v4___Parenffrac_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_f_Store@PLT
+.stabn 68,0,277,.LM1572-v4_Greaterfloat
+.LM1572:
+	xor %rax,%rax
+	inc %rax
+	mov v4___Parenffrac_scale_Closeparen@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.stabn 68,0,278,.LM1579-v4_Greaterfloat
+.LM1579:
+	mov $4,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,280,.LM1582-v4_Greaterfloat
+.LM1582:
+	jmp .L125
+.L124:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,281,.LM1588-v4_Greaterfloat
+.LM1588:
+	jmp .L102
+.L123:
+.L166:
+.stabn 68,0,283,.LM1596-v4_Greaterfloat
+.LM1596:
+	call v4_over@PLT
+	mov $101,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4_over@PLT
+	mov $69,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	or %rdx,%rax
+	je .L127
+.stabn 68,0,284,.LM1621-v4_Greaterfloat
+.LM1621:
+	mov $5,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,286,.LM1624-v4_Greaterfloat
+.LM1624:
+	jmp .L128
+.L127:
+	call v4_over@PLT
+	mov $48,%rax
+	call v4__dpush@PLT
+	mov $58,%rax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L129
+.stabn 68,0,287,.LM1635-v4_Greaterfloat
+.LM1635:
+	mov v4___Parenffrac_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_f_Fetch@PLT
+.stabn 68,0,288,.LM1638-v4_Greaterfloat
+.LM1638:
+	mov $1092616192,%rax
+	call v4__fpush@PLT
+	call v4_f_Star@PLT
+	call v4___Parenctof_Closeparen@PLT
+	call v4_f_Plus@PLT
+.stabn 68,0,289,.LM1643-v4_Greaterfloat
+.LM1643:
+	mov v4___Parenffrac_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_f_Store@PLT
+.stabn 68,0,290,.LM1646-v4_Greaterfloat
+.LM1646:
+	mov v4___Parenffrac_scale_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	inc %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	call v4_Store@PLT
+.stabn 68,0,291,.LM1656-v4_Greaterfloat
+.LM1656:
+	mov $4,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,293,.LM1659-v4_Greaterfloat
+.LM1659:
+	jmp .L130
+.L129:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,294,.LM1666-v4_Greaterfloat
+.LM1666:
+	jmp .L102
+.L126:
+.L167:
+.stabn 68,0,296,.LM1674-v4_Greaterfloat
+.LM1674:
+	call v4_over@PLT
+	mov $45,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4_over@PLT
+	mov $43,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	or %rdx,%rax
+	je .L132
+.stabn 68,0,297,.LM1699-v4_Greaterfloat
+.LM1699:
+	call v4_over@PLT
+	mov $45,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jne .L133
+	mov v4___Parenfexp_sign_Closeparen@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+	call v4_dup@PLT
+	call v4_Fetch@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	call v4_Store@PLT
+.L133:
+.stabn 68,0,298,.LM1719-v4_Greaterfloat
+.LM1719:
+	mov $5,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,300,.LM1722-v4_Greaterfloat
+.LM1722:
+	jmp .L134
+.L132:
+	call v4_over@PLT
+	mov $48,%rax
+	call v4__dpush@PLT
+	mov $58,%rax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L135
+.stabn 68,0,301,.LM1733-v4_Greaterfloat
+.LM1733:
+	call v4_over@PLT
+	mov $48,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	mov v4___Parenfexp_Closeparen@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.stabn 68,0,302,.LM1746-v4_Greaterfloat
+.LM1746:
+	mov $6,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,304,.LM1749-v4_Greaterfloat
+.LM1749:
+	jmp .L136
+.L135:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,305,.LM1756-v4_Greaterfloat
+.LM1756:
+	jmp .L102
+.L131:
+.L168:
+.stabn 68,0,307,.LM1764-v4_Greaterfloat
+.LM1764:
+	call v4_over@PLT
+	mov $48,%rax
+	call v4__dpush@PLT
+	mov $58,%rax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L138
+.stabn 68,0,308,.LM1773-v4_Greaterfloat
+.LM1773:
+	call v4_over@PLT
+	mov $48,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	mov %rax,%r8
+	mov v4___Parenfexp_Closeparen@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	lea (%rax,%rax,4),%rax
+	add %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	mov v4___Parenfexp_Closeparen@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.stabn 68,0,310,.LM1802-v4_Greaterfloat
+.LM1802:
+	mov $6,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,312,.LM1805-v4_Greaterfloat
+.LM1805:
+	jmp .L139
+.L138:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.stabn 68,0,313,.LM1811-v4_Greaterfloat
+.LM1811:
+.L137:
+.L106:
+.L108:
+.L110:
+.L113:
+.L115:
+.L117:
+.L120:
+.L122:
+.L125:
+.L128:
+.L130:
+.L134:
+.L136:
+.L139:
+.L102:
+	call v4__dpop@PLT
+	call v4_nip@PLT
+.stabn 68,0,315,.LM1830-v4_Greaterfloat
+.LM1830:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jge .L140
+.stabn 68,0,316,.LM1836-v4_Greaterfloat
+.LM1836:
+	call v4_z2drop@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_unloop@PLT
+.L140:
+.stabn 68,0,318,.LM1843-v4_Greaterfloat
+.LM1843:
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L100
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.L99:
+.stabn 68,0,320,.LM1854-v4_Greaterfloat
+.LM1854:
+	call v4_nip@PLT
+.stabn 68,0,321,.LM1855-v4_Greaterfloat
+.LM1855:
+	call v4_dup@PLT
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	mov $2,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	or %rdx,%rax
+	call v4__dpush@PLT
+	call v4_over@PLT
+	mov $4,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	or %rdx,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+	mov $6,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	or %rdx,%rax
+	not %rax
+	test %rax,%rax
+	je .L141
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L97
+.L141:
+.stabn 68,0,324,.LM1913-v4_Greaterfloat
+.LM1913:
+	call v4___Parencombine_Closeparen@PLT
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+.L97:
+.LBE83:
+.stabn 68,0,324,.LM1918-v4_Greaterfloat
+.LM1918:
+	pop %rbx
+	leave
+	ret
+.Lfe83:
+	.size	 v4_Greaterfloat,.Lfe83-v4_Greaterfloat
+.stabn	192,0,0,.LBB83-v4_Greaterfloat
+.stabn	224,0,0,.LBE83-v4_Greaterfloat
+.Lscope83:
+.stabs	"",36,0,0,.Lscope83-v4_Greaterfloat
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"
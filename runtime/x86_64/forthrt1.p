@@ -0,0 +1,32 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: forthrt1.ft
+Compiled: Sat Oct 17 10:15:09 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+    41 Sym_1 codeword "_start"
+    35 Sym_0 variable Cell "v4__atexit"
+
+Intermediate code:
+    41 function Sym_1 {
+    42   asm (    mov %rdx,v4__atexit(%rip))
+    44   asm (    mov 8(%rbp),%rdi)
+    45   asm (    lea 16(%rbp),%rsi)
+    46   asm (    lea 8(%rsi,%rdi,8),%rdx)
+    48   asm (    xor %ebp,%ebp)
+    49   asm (    and $-16,%rsp)
+    51   asm (    call main)
+    53   asm (    mov v4__atexit(%rip),%rdx)
+    54   asm (    test %rdx,%rdx)
+    55   asm (    jz 1f)
+    56   asm (    push %rax)
+    57   asm (    push %rax)
+    58   asm (    call *%rdx)
+    59   asm (    pop %rax)
+    60   asm (    pop %rax)
+    61   asm (1:)
+    63   asm (    mov %rax,%rdi)
+    64   asm (    mov $60,%rax)
+    65   asm (    syscall)
+    67 }
+
@@ -0,0 +1,70 @@
+	.file	"forthrt1.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"forthrt1.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.stabs	"v4__atexit:G2",40,0,0,v4__atexit
+	.comm  v4__atexit,8,8
+.text
+	.align 4
+.stabs "_start:F1",36,0,0,_start
+	.weak _start
+	.type	_start,@function
+_start:
+.stabn 68,0,41,.LMa0-_start
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,41,.LMb0-_start
+.LMb0:
+.LBB1:
+#APP
+    mov %rdx,v4__atexit(%rip)
+    mov 8(%rbp),%rdi
+    lea 16(%rbp),%rsi
+    lea 8(%rsi,%rdi,8),%rdx
+    xor %ebp,%ebp
+    and $-16,%rsp
+    call main
+    mov v4__atexit(%rip),%rdx
+    test %rdx,%rdx
+    jz 1f
+    push %rax
+    push %rax
+    call *%rdx
+    pop %rax
+    pop %rax
+1:
+    mov %rax,%rdi
+    mov $60,%rax
+    syscall
+#NO_APP
+.LBE1:
+.stabn 68,0,67,.LM20-_start
+.LM20:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe1:
+	.size	 _start,.Lfe1-_start
+.stabn	192,0,0,.LBB1-_start
+.stabn	224,0,0,.LBE1-_start
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-_start
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"
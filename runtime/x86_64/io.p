@@ -0,0 +1,1258 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: io.ft
+Compiled: Sat Oct 17 10:15:09 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+   100 Sym_52 word "v4_Dot"
+    89 Sym_47 word "v4_Dotr"
+    29 Sym_4 external "v4_Equals"
+    48 Sym_22 external "v4_Fetch"
+    60 Sym_30 external "v4_Greater"
+   103 Sym_53 word "v4_Greaternumber"
+    86 Sym_43 external "v4_Greaterr"
+    58 Sym_28 word "v4_Hash"
+    78 Sym_38 word "v4_Hash_Greater"
+    67 Sym_32 word "v4_Hashs"
+   119 Sym_57 external "v4_Less"
+    52 Sym_25 word "v4_Less_Hash"
+    63 Sym_31 external "v4_Minus"
+    33 Sym_10 external "v4_Plus"
+    49 Sym_24 external "v4_Store"
+    42 Sym_19 variable Cell "v4__ansi"
+    41 Sym_18 variable Cell "v4__base"
+    39 Sym_16 variable Char[148] "v4__hldbuf"
+    44 Sym_20 word "v4__strictansi"
+    93 Sym_49 external "v4_abs"
+    26 Sym_0 word "v4_accept"
+    47 Sym_21 word "v4_base"
+    37 Sym_13 external "v4_c_Fetch"
+    33 Sym_11 external "v4_c_Store"
+    37 Sym_15 external "v4_char_Plus"
+   140 Sym_63 word "v4_convert"
+    36 Sym_12 word "v4_count"
+    82 Sym_40 word "v4_decimal"
+    30 Sym_6 external "v4_drop"
+    29 Sym_3 external "v4_dup"
+    81 Sym_39 word "v4_hex"
+    40 Sym_17 variable Cell "v4_hld"
+    55 Sym_26 word "v4_hold"
+    31 Sym_7 external "v4_i"
+   111 Sym_56 external "v4_invert"
+    29 Sym_2 external "v4_key"
+    83 Sym_41 word "v4_octal"
+    70 Sym_34 external "v4_or"
+    33 Sym_9 external "v4_over"
+    86 Sym_44 external "v4_r_Greater"
+    73 Sym_36 word "v4_sign"
+    98 Sym_51 external "v4_space"
+    87 Sym_45 external "v4_spaces"
+   134 Sym_62 word "v4_strlen"
+    37 Sym_14 external "v4_swap"
+   131 Sym_61 word "v4_tolower"
+   128 Sym_60 word "v4_toupper"
+    27 Sym_1 external "v4_tuck"
+    87 Sym_46 external "v4_type"
+    97 Sym_50 word "v4_u_Dot"
+    85 Sym_42 word "v4_u_Dotr"
+   123 Sym_59 external "v4_um_Plus"
+    59 Sym_29 external "v4_um_Slashmod"
+   123 Sym_58 external "v4_um_Star"
+    31 Sym_8 external "v4_unloop"
+   107 Sym_55 external "v4_within"
+    90 Sym_48 external "v4_xor"
+    48 Sym_23 external "v4_z0_Equals"
+    70 Sym_35 external "v4_z0_Greater"
+    74 Sym_37 external "v4_z0_Less"
+    56 Sym_27 external "v4_z1_Minus"
+   107 Sym_54 external "v4_z1_Plus"
+    30 Sym_5 external "v4_z2drop"
+    70 Sym_33 external "v4_z2dup"
+
+Intermediate code:
+    26 function Sym_0 {
+    27   call Sym_1
+    28   Reg_0 = 0
+    28   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    28   no-op
+           optimizes   Reg_1 = Stack_D
+    28   Reg_0 = Stack_D
+    28   if Reg_0 == Reg_1 goto Label_2
+    28   Stack_R = Reg_0
+    28   Stack_R = Reg_1
+    28 label Label_3
+    29   call Sym_2
+    29   call Sym_3
+    29   Reg_0 = 10
+    29   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    29   no-op
+           optimizes   call Sym_4
+    29   no-op
+           optimizes   Reg_1 = Stack_D
+    29   Reg_0 = Stack_D
+    29   if Reg_0 != Reg_1 goto Label_5
+    29   no-op
+           optimizes   Reg_0 = Stack_D
+    29   no-op
+           optimizes   if Reg_0 == 0 goto Label_5
+    30   call Sym_5
+    30   call Sym_6
+    31   call Sym_7
+    31   tail call Sym_8
+           optimizes   call Sym_8
+    31   no-op
+           optimizes   goto Label_1
+    32 label Label_5
+    33   call Sym_9
+    33   call Sym_7
+    33   no-op
+           optimizes   call Sym_10
+    33   Reg_1 = Stack_D
+    33   Reg_0 = Stack_D
+    33   Reg_0 += Reg_1
+    33   Stack_D = Reg_0
+    33   call Sym_11
+    34   Reg_1 = Stack_R
+    34   Reg_1 += 1
+    34   Reg_0 = Stack_R
+    34   Stack_R = Reg_0
+    34   Stack_R = Reg_1
+    34   Reg_1 -= Reg_0
+    34   if Reg_1 != 0 goto Label_3
+    34   no-op
+           optimizes label Label_4
+    34   Reg_0 = Stack_R
+    34   Reg_0 = Stack_R
+    34 label Label_2
+    34   tail call Sym_6
+           optimizes   call Sym_6
+    34   no-op
+           optimizes label Label_1
+    34 }
+
+    36 function Sym_12 {
+    37   call Sym_3
+    37   call Sym_13
+    37   call Sym_14
+    37   call Sym_15
+    37   tail call Sym_14
+           optimizes   call Sym_14
+    37   no-op
+           optimizes label Label_6
+    37 }
+
+    44 function Sym_20 {
+    45   Reg_0 = Sym_19
+    45   Stack_D = Reg_0
+    45   no-op
+           optimizes label Label_7
+    45 }
+
+    47 function Sym_21 {
+    48   no-op
+           optimizes   Reg_0 = Sym_18
+    48   no-op
+           optimizes   Stack_D = Reg_0
+    48   no-op
+           optimizes   call Sym_22
+    48   Reg_0 = *(Sym_18)
+    48   no-op
+           optimizes   Stack_D = Reg_0
+    48   no-op
+           optimizes   call Sym_23
+    48   no-op
+           optimizes   Reg_0 = Stack_D
+    48   if Reg_0 != 0 goto Label_9
+    48   no-op
+           optimizes   Reg_0 = Stack_D
+    48   no-op
+           optimizes   if Reg_0 == 0 goto Label_9
+    49   Reg_0 = 10
+    49   no-op
+           optimizes   Stack_D = Reg_0
+    49   no-op
+           optimizes   Reg_0 = Sym_18
+    49   no-op
+           optimizes   Stack_D = Reg_0
+    49   no-op
+           optimizes   call Sym_24
+    49   no-op
+           optimizes   Reg_0 = Stack_D
+    49   *(Sym_18) = Reg_0
+    50 label Label_9
+    50   Reg_0 = Sym_18
+    50   Stack_D = Reg_0
+    50   no-op
+           optimizes label Label_8
+    50 }
+
+    52 function Sym_25 {
+    53   Reg_0 = Sym_16
+    53   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    53   Reg_0 = 148
+    53   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    53   no-op
+           optimizes   call Sym_10
+    53   no-op
+           optimizes   Reg_1 = Stack_D
+    53   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    53   Reg_0 += Reg_1
+    53   no-op
+           optimizes   Stack_D = Reg_0
+    53   no-op
+           optimizes   Reg_0 = Sym_17
+    53   no-op
+           optimizes   Stack_D = Reg_0
+    53   no-op
+           optimizes   call Sym_24
+    53   no-op
+           optimizes   Reg_0 = Stack_D
+    53   *(Sym_17) = Reg_0
+    53   no-op
+           optimizes label Label_10
+    53 }
+
+    55 function Sym_26 {
+    56   no-op
+           optimizes   Reg_0 = Sym_17
+    56   no-op
+           optimizes   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_22
+    56   Reg_0 = *(Sym_17)
+    56   no-op
+           optimizes   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_27
+    56   no-op
+           optimizes   Reg_0 = Stack_D
+    56   Reg_0 -= 1
+    56   Stack_D = Reg_0
+    56   call Sym_3
+    56   no-op
+           optimizes   Reg_0 = Sym_17
+    56   no-op
+           optimizes   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_24
+    56   Reg_0 = Stack_D
+    56   *(Sym_17) = Reg_0
+    56   tail call Sym_11
+           optimizes   call Sym_11
+    56   no-op
+           optimizes label Label_11
+    56 }
+
+    58 function Sym_28 {
+    59   no-op
+           optimizes   call Sym_21
+    48   Reg_0 = *(Sym_18)
+    48   if Reg_0 != 0 goto Label_56
+    49   Reg_0 = 10
+    49   *(Sym_18) = Reg_0
+    50 label Label_56
+    50   Reg_0 = Sym_18
+    50   Stack_D = Reg_0
+    59   call Sym_22
+    59   call Sym_29
+    59   call Sym_14
+    60   call Sym_3
+    60   Reg_0 = 9
+    60   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    60   no-op
+           optimizes   call Sym_30
+    60   no-op
+           optimizes   Reg_1 = Stack_D
+    60   Reg_0 = Stack_D
+    60   if Reg_0 <= Reg_1 goto Label_13
+    60   no-op
+           optimizes   Reg_0 = Stack_D
+    60   no-op
+           optimizes   if Reg_0 == 0 goto Label_13
+    61   no-op
+           optimizes   call Sym_20
+    45   no-op
+           optimizes   Reg_0 = Sym_19
+    45   no-op
+           optimizes   Stack_D = Reg_0
+    61   no-op
+           optimizes   call Sym_22
+    61   Reg_0 = *(Sym_19)
+    61   no-op
+           optimizes   Stack_D = Reg_0
+    62   no-op
+           optimizes   Reg_0 = Stack_D
+    62   if Reg_0 == 0 goto Label_14
+    62   Reg_0 = 65
+    62   Stack_D = Reg_0
+    62   goto Label_15
+    62 label Label_14
+    62   Reg_0 = 97
+    62   Stack_D = Reg_0
+    62 label Label_15
+    63   no-op
+           optimizes   call Sym_27
+    63   Reg_0 = Stack_D
+    63   Reg_0 -= 1
+    63   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    63   Reg_0 = 57
+    63   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    63   no-op
+           optimizes   call Sym_31
+    63   no-op
+           optimizes   Reg_1 = Stack_D
+    63   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    63   Reg_0 -= Reg_1
+    63   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    63   no-op
+           optimizes   call Sym_10
+    63   no-op
+           optimizes   Reg_1 = Stack_D
+    63   Reg_0 = Stack_D
+    63   Reg_0 += Reg_1
+    63   Stack_D = Reg_0
+    64 label Label_13
+    65   Reg_0 = 48
+    65   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    65   no-op
+           optimizes   call Sym_10
+    65   no-op
+           optimizes   Reg_1 = Stack_D
+    65   Reg_0 = Stack_D
+    65   Reg_0 += Reg_1
+    65   Stack_D = Reg_0
+    65   no-op
+           optimizes   call Sym_26
+    56   no-op
+           optimizes   Reg_0 = Sym_17
+    56   no-op
+           optimizes   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_22
+    56   Reg_0 = *(Sym_17)
+    56   no-op
+           optimizes   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_27
+    56   no-op
+           optimizes   Reg_0 = Stack_D
+    56   Reg_0 -= 1
+    56   Stack_D = Reg_0
+    56   call Sym_3
+    56   no-op
+           optimizes   Reg_0 = Sym_17
+    56   no-op
+           optimizes   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_24
+    56   Reg_0 = Stack_D
+    56   *(Sym_17) = Reg_0
+    56   call Sym_11
+    65   Reg_0 = 0
+    65   Stack_D = Reg_0
+    65   no-op
+           optimizes label Label_12
+    65 }
+
+    67 function Sym_32 {
+    68 label Label_17
+    69   call Sym_28
+    70   call Sym_33
+    70   no-op
+           optimizes   call Sym_34
+    70   Reg_1 = Stack_D
+    70   Reg_0 = Stack_D
+    70   Reg_0 |= Reg_1
+    70   no-op
+           optimizes   Stack_D = Reg_0
+    70   no-op
+           optimizes   call Sym_35
+    70   no-op
+           optimizes   Reg_0 = Stack_D
+    70   if Reg_0 <= 0 goto Label_18
+    70   no-op
+           optimizes   Reg_0 = Stack_D
+    70   no-op
+           optimizes   if Reg_0 == 0 goto Label_18
+    71   goto Label_17
+    71 label Label_18
+    71   no-op
+           optimizes label Label_16
+    71 }
+
+    73 function Sym_36 {
+    74   no-op
+           optimizes   call Sym_37
+    74   Reg_0 = Stack_D
+    74   if Reg_0 >= 0 goto Label_20
+    74   no-op
+           optimizes   Reg_0 = Stack_D
+    74   no-op
+           optimizes   if Reg_0 == 0 goto Label_20
+    75   Reg_0 = 45
+    75   Stack_D = Reg_0
+    75   no-op
+           optimizes   call Sym_26
+    56   no-op
+           optimizes   Reg_0 = Sym_17
+    56   no-op
+           optimizes   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_22
+    56   Reg_0 = *(Sym_17)
+    56   no-op
+           optimizes   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_27
+    56   no-op
+           optimizes   Reg_0 = Stack_D
+    56   Reg_0 -= 1
+    56   Stack_D = Reg_0
+    56   call Sym_3
+    56   no-op
+           optimizes   Reg_0 = Sym_17
+    56   no-op
+           optimizes   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_24
+    56   Reg_0 = Stack_D
+    56   *(Sym_17) = Reg_0
+    56   tail call Sym_11
+           optimizes   call Sym_11
+    76 label Label_20
+    76   no-op
+           optimizes label Label_19
+    76 }
+
+    78 function Sym_38 {
+    79   call Sym_5
+    79   no-op
+           optimizes   Reg_0 = Sym_17
+    79   no-op
+           optimizes   Stack_D = Reg_0
+    79   no-op
+           optimizes   call Sym_22
+    79   Reg_0 = *(Sym_17)
+    79   Stack_D = Reg_0
+    79   Reg_0 = Sym_16
+    79   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    79   Reg_0 = 148
+    79   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    79   no-op
+           optimizes   call Sym_10
+    79   no-op
+           optimizes   Reg_1 = Stack_D
+    79   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    79   Reg_0 += Reg_1
+    79   Stack_D = Reg_0
+    79   call Sym_9
+    79   no-op
+           optimizes   call Sym_31
+    79   Reg_1 = Stack_D
+    79   Reg_0 = Stack_D
+    79   Reg_0 -= Reg_1
+    79   Stack_D = Reg_0
+    79   no-op
+           optimizes label Label_21
+    79 }
+
+    81 function Sym_39 {
+    81   Reg_0 = 16
+    81   Stack_D = Reg_0
+    81   no-op
+           optimizes   call Sym_21
+    48   Reg_0 = *(Sym_18)
+    48   if Reg_0 != 0 goto Label_57
+    49   Reg_0 = 10
+    49   *(Sym_18) = Reg_0
+    50 label Label_57
+    50   Reg_0 = Sym_18
+    50   Stack_D = Reg_0
+    81   tail call Sym_24
+           optimizes   call Sym_24
+    81   no-op
+           optimizes label Label_22
+    81 }
+
+    82 function Sym_40 {
+    82   Reg_0 = 10
+    82   Stack_D = Reg_0
+    82   no-op
+           optimizes   call Sym_21
+    48   Reg_0 = *(Sym_18)
+    48   if Reg_0 != 0 goto Label_58
+    49   Reg_0 = 10
+    49   *(Sym_18) = Reg_0
+    50 label Label_58
+    50   Reg_0 = Sym_18
+    50   Stack_D = Reg_0
+    82   tail call Sym_24
+           optimizes   call Sym_24
+    82   no-op
+           optimizes label Label_23
+    82 }
+
+    83 function Sym_41 {
+    83   Reg_0 = 8
+    83   Stack_D = Reg_0
+    83   no-op
+           optimizes   call Sym_21
+    48   Reg_0 = *(Sym_18)
+    48   if Reg_0 != 0 goto Label_59
+    49   Reg_0 = 10
+    49   *(Sym_18) = Reg_0
+    50 label Label_59
+    50   Reg_0 = Sym_18
+    50   Stack_D = Reg_0
+    83   tail call Sym_24
+           optimizes   call Sym_24
+    83   no-op
+           optimizes label Label_24
+    83 }
+
+    85 function Sym_42 {
+    86   call Sym_43
+    86   no-op
+           optimizes   call Sym_25
+    53   Reg_0 = Sym_16
+    53   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    53   Reg_0 = 148
+    53   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    53   no-op
+           optimizes   call Sym_10
+    53   no-op
+           optimizes   Reg_1 = Stack_D
+    53   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    53   Reg_0 += Reg_1
+    53   no-op
+           optimizes   Stack_D = Reg_0
+    53   no-op
+           optimizes   Reg_0 = Sym_17
+    53   no-op
+           optimizes   Stack_D = Reg_0
+    53   no-op
+           optimizes   call Sym_24
+    53   no-op
+           optimizes   Reg_0 = Stack_D
+    53   *(Sym_17) = Reg_0
+    86   Reg_0 = 0
+    86   Stack_D = Reg_0
+    86   no-op
+           optimizes   call Sym_32
+    68 label Label_49
+    69   call Sym_28
+    70   call Sym_33
+    70   no-op
+           optimizes   call Sym_34
+    70   Reg_1 = Stack_D
+    70   Reg_0 = Stack_D
+    70   Reg_0 |= Reg_1
+    70   no-op
+           optimizes   Stack_D = Reg_0
+    70   no-op
+           optimizes   call Sym_35
+    70   no-op
+           optimizes   Reg_0 = Stack_D
+    70   if Reg_0 <= 0 goto Label_50
+    70   no-op
+           optimizes   Reg_0 = Stack_D
+    70   no-op
+           optimizes   if Reg_0 == 0 goto Label_50
+    71   goto Label_49
+    71 label Label_50
+    86   no-op
+           optimizes   call Sym_38
+    79   call Sym_5
+    79   no-op
+           optimizes   Reg_0 = Sym_17
+    79   no-op
+           optimizes   Stack_D = Reg_0
+    79   no-op
+           optimizes   call Sym_22
+    79   Reg_0 = *(Sym_17)
+    79   Stack_D = Reg_0
+    79   Reg_0 = Sym_16
+    79   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    79   Reg_0 = 148
+    79   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    79   no-op
+           optimizes   call Sym_10
+    79   no-op
+           optimizes   Reg_1 = Stack_D
+    79   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    79   Reg_0 += Reg_1
+    79   Stack_D = Reg_0
+    79   call Sym_9
+    79   no-op
+           optimizes   call Sym_31
+    79   Reg_1 = Stack_D
+    79   Reg_0 = Stack_D
+    79   Reg_0 -= Reg_1
+    79   Stack_D = Reg_0
+    86   call Sym_3
+    86   call Sym_44
+    86   call Sym_14
+    86   no-op
+           optimizes   call Sym_31
+    86   Reg_1 = Stack_D
+    86   Reg_0 = Stack_D
+    86   Reg_0 -= Reg_1
+    86   Stack_D = Reg_0
+    87   call Sym_3
+    87   no-op
+           optimizes   call Sym_35
+    87   Reg_0 = Stack_D
+    87   if Reg_0 <= 0 goto Label_26
+    87   no-op
+           optimizes   Reg_0 = Stack_D
+    87   no-op
+           optimizes   if Reg_0 == 0 goto Label_26
+    87   call Sym_45
+    87   goto Label_27
+    87 label Label_26
+    87   call Sym_6
+    87 label Label_27
+    87   tail call Sym_46
+           optimizes   call Sym_46
+    87   no-op
+           optimizes label Label_25
+    87 }
+
+    89 function Sym_47 {
+    90   call Sym_43
+    90   no-op
+           optimizes   call Sym_21
+    48   Reg_0 = *(Sym_18)
+    48   if Reg_0 != 0 goto Label_60
+    49   Reg_0 = 10
+    49   *(Sym_18) = Reg_0
+    50 label Label_60
+    50   Reg_0 = Sym_18
+    50   Stack_D = Reg_0
+    90   call Sym_22
+    90   Reg_0 = 10
+    90   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    90   no-op
+           optimizes   call Sym_48
+    90   no-op
+           optimizes   Reg_1 = Stack_D
+    90   Reg_0 = Stack_D
+    90   Reg_0 ^= Reg_1
+    90   no-op
+           optimizes   Stack_D = Reg_0
+    90   no-op
+           optimizes   Reg_0 = Stack_D
+    90   if Reg_0 == 0 goto Label_29
+    91   call Sym_44
+    91   tail call Sym_42
+           optimizes   call Sym_42
+    91   no-op
+           optimizes   goto Label_28
+    92 label Label_29
+    93   call Sym_3
+    93   call Sym_43
+    93   call Sym_49
+    93   no-op
+           optimizes   call Sym_25
+    53   Reg_0 = Sym_16
+    53   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    53   Reg_0 = 148
+    53   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    53   no-op
+           optimizes   call Sym_10
+    53   no-op
+           optimizes   Reg_1 = Stack_D
+    53   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    53   Reg_0 += Reg_1
+    53   no-op
+           optimizes   Stack_D = Reg_0
+    53   no-op
+           optimizes   Reg_0 = Sym_17
+    53   no-op
+           optimizes   Stack_D = Reg_0
+    53   no-op
+           optimizes   call Sym_24
+    53   no-op
+           optimizes   Reg_0 = Stack_D
+    53   *(Sym_17) = Reg_0
+    93   Reg_0 = 0
+    93   Stack_D = Reg_0
+    93   no-op
+           optimizes   call Sym_32
+    68 label Label_51
+    69   call Sym_28
+    70   call Sym_33
+    70   no-op
+           optimizes   call Sym_34
+    70   Reg_1 = Stack_D
+    70   Reg_0 = Stack_D
+    70   Reg_0 |= Reg_1
+    70   no-op
+           optimizes   Stack_D = Reg_0
+    70   no-op
+           optimizes   call Sym_35
+    70   no-op
+           optimizes   Reg_0 = Stack_D
+    70   if Reg_0 <= 0 goto Label_52
+    70   no-op
+           optimizes   Reg_0 = Stack_D
+    70   no-op
+           optimizes   if Reg_0 == 0 goto Label_52
+    71   goto Label_51
+    71 label Label_52
+    93   call Sym_44
+    93   no-op
+           optimizes   call Sym_36
+    74   no-op
+           optimizes   call Sym_37
+    74   Reg_0 = Stack_D
+    74   if Reg_0 >= 0 goto Label_53
+    74   no-op
+           optimizes   Reg_0 = Stack_D
+    74   no-op
+           optimizes   if Reg_0 == 0 goto Label_53
+    75   Reg_0 = 45
+    75   Stack_D = Reg_0
+    75   no-op
+           optimizes   call Sym_26
+    56   no-op
+           optimizes   Reg_0 = Sym_17
+    56   no-op
+           optimizes   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_22
+    56   Reg_0 = *(Sym_17)
+    56   no-op
+           optimizes   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_27
+    56   no-op
+           optimizes   Reg_0 = Stack_D
+    56   Reg_0 -= 1
+    56   Stack_D = Reg_0
+    56   call Sym_3
+    56   no-op
+           optimizes   Reg_0 = Sym_17
+    56   no-op
+           optimizes   Stack_D = Reg_0
+    56   no-op
+           optimizes   call Sym_24
+    56   Reg_0 = Stack_D
+    56   *(Sym_17) = Reg_0
+    56   call Sym_11
+    76 label Label_53
+    93   no-op
+           optimizes   call Sym_38
+    79   call Sym_5
+    79   no-op
+           optimizes   Reg_0 = Sym_17
+    79   no-op
+           optimizes   Stack_D = Reg_0
+    79   no-op
+           optimizes   call Sym_22
+    79   Reg_0 = *(Sym_17)
+    79   Stack_D = Reg_0
+    79   Reg_0 = Sym_16
+    79   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    79   Reg_0 = 148
+    79   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    79   no-op
+           optimizes   call Sym_10
+    79   no-op
+           optimizes   Reg_1 = Stack_D
+    79   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    79   Reg_0 += Reg_1
+    79   Stack_D = Reg_0
+    79   call Sym_9
+    79   no-op
+           optimizes   call Sym_31
+    79   Reg_1 = Stack_D
+    79   Reg_0 = Stack_D
+    79   Reg_0 -= Reg_1
+    79   Stack_D = Reg_0
+    94   call Sym_3
+    94   call Sym_44
+    94   call Sym_14
+    94   no-op
+           optimizes   call Sym_31
+    94   Reg_1 = Stack_D
+    94   Reg_0 = Stack_D
+    94   Reg_0 -= Reg_1
+    94   Stack_D = Reg_0
+    95   call Sym_3
+    95   no-op
+           optimizes   call Sym_35
+    95   Reg_0 = Stack_D
+    95   if Reg_0 <= 0 goto Label_30
+    95   no-op
+           optimizes   Reg_0 = Stack_D
+    95   no-op
+           optimizes   if Reg_0 == 0 goto Label_30
+    95   call Sym_45
+    95   goto Label_31
+    95 label Label_30
+    95   call Sym_6
+    95 label Label_31
+    95   tail call Sym_46
+           optimizes   call Sym_46
+    95   no-op
+           optimizes label Label_28
+    95 }
+
+    97 function Sym_50 {
+    98   Reg_0 = 0
+    98   Stack_D = Reg_0
+    98   call Sym_42
+    98   tail call Sym_51
+           optimizes   call Sym_51
+    98   no-op
+           optimizes label Label_32
+    98 }
+
+   100 function Sym_52 {
+   101   Reg_0 = 0
+   101   Stack_D = Reg_0
+   101   call Sym_47
+   101   tail call Sym_51
+           optimizes   call Sym_51
+   101   no-op
+           optimizes label Label_33
+   101 }
+
+   103 function Sym_53 {
+   104 label Label_35
+   105   call Sym_3
+   105   no-op
+           optimizes   call Sym_35
+   105   Reg_0 = Stack_D
+   105   if Reg_0 <= 0 goto Label_36
+   105   no-op
+           optimizes   Reg_0 = Stack_D
+   105   no-op
+           optimizes   if Reg_0 == 0 goto Label_36
+   106   call Sym_9
+   106   call Sym_13
+   107   call Sym_3
+   107   Reg_0 = 97
+   107   Stack_D = Reg_0
+   107   Reg_0 = 123
+           optimizes   Reg_0 = 122
+   107   Stack_D = Reg_0
+   107   no-op
+           optimizes   call Sym_54
+   107   call Sym_55
+   107   Reg_0 = Stack_D
+   107   if Reg_0 == 0 goto Label_37
+   108   Reg_0 = 97
+   108   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   108   no-op
+           optimizes   call Sym_31
+   108   no-op
+           optimizes   Reg_1 = Stack_D
+   108   Reg_0 = Stack_D
+   108   Reg_0 -= Reg_1
+   108   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   108   Reg_0 = 65
+   108   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   108   no-op
+           optimizes   call Sym_10
+   108   no-op
+           optimizes   Reg_1 = Stack_D
+   108   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   108   Reg_0 += Reg_1
+   108   Stack_D = Reg_0
+   109 label Label_37
+   110   call Sym_3
+   110   Reg_0 = 48
+   110   Stack_D = Reg_0
+   110   Reg_0 = 58
+           optimizes   Reg_0 = 57
+   110   Stack_D = Reg_0
+   110   no-op
+           optimizes   call Sym_54
+   110   call Sym_55
+   111   call Sym_9
+   111   Reg_0 = 65
+   111   Stack_D = Reg_0
+   111   Reg_0 = 91
+           optimizes   Reg_0 = 90
+   111   Stack_D = Reg_0
+   111   no-op
+           optimizes   call Sym_54
+   111   call Sym_55
+   111   no-op
+           optimizes   call Sym_34
+   111   Reg_1 = Stack_D
+   111   Reg_0 = Stack_D
+   111   Reg_0 |= Reg_1
+   111   no-op
+           optimizes   Stack_D = Reg_0
+   111   no-op
+           optimizes   call Sym_56
+   111   no-op
+           optimizes   Reg_0 = Stack_D
+   111   Reg_0 = ~Reg_0
+   111   no-op
+           optimizes   Stack_D = Reg_0
+   111   no-op
+           optimizes   Reg_0 = Stack_D
+   111   if Reg_0 == 0 goto Label_38
+   112   tail call Sym_6
+           optimizes   call Sym_6
+   112   no-op
+           optimizes   goto Label_34
+   113 label Label_38
+   114   call Sym_3
+   114   Reg_0 = 57
+   114   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   114   no-op
+           optimizes   call Sym_30
+   114   no-op
+           optimizes   Reg_1 = Stack_D
+   114   Reg_0 = Stack_D
+   114   if Reg_0 <= Reg_1 goto Label_39
+   114   no-op
+           optimizes   Reg_0 = Stack_D
+   114   no-op
+           optimizes   if Reg_0 == 0 goto Label_39
+   115   Reg_0 = 65
+   115   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   115   no-op
+           optimizes   call Sym_31
+   115   no-op
+           optimizes   Reg_1 = Stack_D
+   115   Reg_0 = Stack_D
+   115   Reg_0 -= Reg_1
+   115   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   115   Reg_0 = 10
+   115   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   115   no-op
+           optimizes   call Sym_10
+   115   no-op
+           optimizes   Reg_1 = Stack_D
+   115   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   115   Reg_0 += Reg_1
+   115   Stack_D = Reg_0
+   116   goto Label_40
+   116 label Label_39
+   117   Reg_0 = 48
+   117   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   117   no-op
+           optimizes   call Sym_31
+   117   no-op
+           optimizes   Reg_1 = Stack_D
+   117   Reg_0 = Stack_D
+   117   Reg_0 -= Reg_1
+   117   Stack_D = Reg_0
+   118 label Label_40
+   119   call Sym_3
+   119   no-op
+           optimizes   call Sym_21
+    48   no-op
+           optimizes   Reg_0 = Sym_18
+    48   no-op
+           optimizes   Stack_D = Reg_0
+    48   no-op
+           optimizes   call Sym_22
+    48   Reg_0 = *(Sym_18)
+    48   no-op
+           optimizes   Stack_D = Reg_0
+    48   no-op
+           optimizes   call Sym_23
+    48   no-op
+           optimizes   Reg_0 = Stack_D
+    48   if Reg_0 != 0 goto Label_54
+    48   no-op
+           optimizes   Reg_0 = Stack_D
+    48   no-op
+           optimizes   if Reg_0 == 0 goto Label_54
+    49   Reg_0 = 10
+    49   no-op
+           optimizes   Stack_D = Reg_0
+    49   no-op
+           optimizes   Reg_0 = Sym_18
+    49   no-op
+           optimizes   Stack_D = Reg_0
+    49   no-op
+           optimizes   call Sym_24
+    49   no-op
+           optimizes   Reg_0 = Stack_D
+    49   *(Sym_18) = Reg_0
+    50 label Label_54
+    50   no-op
+           optimizes   Reg_0 = Sym_18
+    50   no-op
+           optimizes   Stack_D = Reg_0
+   119   no-op
+           optimizes   call Sym_22
+   119   Reg_0 = *(Sym_18)
+   119   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   119   no-op
+           optimizes   call Sym_57
+   119   no-op
+           optimizes   Reg_1 = Stack_D
+   119   Reg_0 = Stack_D
+   119   Reg_0 = Reg_0 < Reg_1
+   119   no-op
+           optimizes   Stack_D = Reg_0
+   119   no-op
+           optimizes   call Sym_56
+   119   no-op
+           optimizes   Reg_0 = Stack_D
+   119   Reg_0 = ~Reg_0
+   119   no-op
+           optimizes   Stack_D = Reg_0
+   119   no-op
+           optimizes   Reg_0 = Stack_D
+   119   if Reg_0 == 0 goto Label_41
+   120   tail call Sym_6
+           optimizes   call Sym_6
+   120   no-op
+           optimizes   goto Label_34
+   121 label Label_41
+   122   call Sym_14
+   122   call Sym_43
+   122   call Sym_14
+   122   call Sym_43
+   122   call Sym_43
+   123   call Sym_6
+   123   no-op
+           optimizes   call Sym_21
+    48   no-op
+           optimizes   Reg_0 = Sym_18
+    48   no-op
+           optimizes   Stack_D = Reg_0
+    48   no-op
+           optimizes   call Sym_22
+    48   Reg_0 = *(Sym_18)
+    48   no-op
+           optimizes   Stack_D = Reg_0
+    48   no-op
+           optimizes   call Sym_23
+    48   no-op
+           optimizes   Reg_0 = Stack_D
+    48   if Reg_0 != 0 goto Label_55
+    48   no-op
+           optimizes   Reg_0 = Stack_D
+    48   no-op
+           optimizes   if Reg_0 == 0 goto Label_55
+    49   Reg_0 = 10
+    49   no-op
+           optimizes   Stack_D = Reg_0
+    49   no-op
+           optimizes   Reg_0 = Sym_18
+    49   no-op
+           optimizes   Stack_D = Reg_0
+    49   no-op
+           optimizes   call Sym_24
+    49   no-op
+           optimizes   Reg_0 = Stack_D
+    49   *(Sym_18) = Reg_0
+    50 label Label_55
+    50   no-op
+           optimizes   Reg_0 = Sym_18
+    50   no-op
+           optimizes   Stack_D = Reg_0
+   123   no-op
+           optimizes   call Sym_22
+   123   Reg_0 = *(Sym_18)
+   123   Stack_D = Reg_0
+   123   call Sym_58
+   123   call Sym_6
+   123   call Sym_44
+   123   call Sym_59
+   124   call Sym_44
+   124   call Sym_15
+   125   call Sym_44
+   125   no-op
+           optimizes   call Sym_27
+   125   Reg_0 = Stack_D
+   125   Reg_0 -= 1
+   125   Stack_D = Reg_0
+   126   goto Label_35
+   126 label Label_36
+   126 label Label_34
+   126 }
+
+   128 function Sym_60 {
+   129   call Sym_3
+   129   Reg_0 = 97
+   129   Stack_D = Reg_0
+   129   Reg_0 = 123
+           optimizes   Reg_0 = 122
+   129   Stack_D = Reg_0
+   129   no-op
+           optimizes   call Sym_54
+   129   call Sym_55
+   129   Reg_0 = Stack_D
+   129   if Reg_0 == 0 goto Label_43
+   129   Reg_0 = 97
+   129   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   129   no-op
+           optimizes   call Sym_31
+   129   no-op
+           optimizes   Reg_1 = Stack_D
+   129   Reg_0 = Stack_D
+   129   Reg_0 -= Reg_1
+   129   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   129   Reg_0 = 65
+   129   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   129   no-op
+           optimizes   call Sym_10
+   129   no-op
+           optimizes   Reg_1 = Stack_D
+   129   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   129   Reg_0 += Reg_1
+   129   Stack_D = Reg_0
+   129 label Label_43
+   129   no-op
+           optimizes label Label_42
+   129 }
+
+   131 function Sym_61 {
+   132   call Sym_3
+   132   Reg_0 = 65
+   132   Stack_D = Reg_0
+   132   Reg_0 = 91
+           optimizes   Reg_0 = 90
+   132   Stack_D = Reg_0
+   132   no-op
+           optimizes   call Sym_54
+   132   call Sym_55
+   132   Reg_0 = Stack_D
+   132   if Reg_0 == 0 goto Label_45
+   132   Reg_0 = 65
+   132   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   132   no-op
+           optimizes   call Sym_31
+   132   no-op
+           optimizes   Reg_1 = Stack_D
+   132   Reg_0 = Stack_D
+   132   Reg_0 -= Reg_1
+   132   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   132   Reg_0 = 97
+   132   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   132   no-op
+           optimizes   call Sym_10
+   132   no-op
+           optimizes   Reg_1 = Stack_D
+   132   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   132   Reg_0 += Reg_1
+   132   Stack_D = Reg_0
+   132 label Label_45
+   132   no-op
+           optimizes label Label_44
+   132 }
+
+   134 function Sym_62 {
+   135   Reg_0 = 0
+   135   Stack_D = Reg_0
+   135 label Label_47
+   136   call Sym_33
+   136   no-op
+           optimizes   call Sym_10
+   136   Reg_1 = Stack_D
+   136   Reg_0 = Stack_D
+   136   Reg_0 += Reg_1
+   136   Stack_D = Reg_0
+   136   call Sym_13
+   136   no-op
+           optimizes   call Sym_23
+   136   Reg_0 = Stack_D
+   136   Reg_0 = Reg_0 == 0
+   136   no-op
+           optimizes   Stack_D = Reg_0
+   136   no-op
+           optimizes   call Sym_56
+   136   no-op
+           optimizes   Reg_0 = Stack_D
+   136   Reg_0 = ~Reg_0
+   136   no-op
+           optimizes   Stack_D = Reg_0
+   136   no-op
+           optimizes   Reg_0 = Stack_D
+   136   if Reg_0 == 0 goto Label_48
+   137   no-op
+           optimizes   call Sym_54
+   137   Reg_0 = Stack_D
+   137   Reg_0 += 1
+   137   Stack_D = Reg_0
+   138   goto Label_47
+   138 label Label_48
+   138   no-op
+           optimizes label Label_46
+   138 }
+
+   140 function Sym_63 {
+   141   call Sym_15
+   141   Reg_0 = -1
+   141   Stack_D = Reg_0
+   141   call Sym_53
+   141   tail call Sym_6
+           optimizes   call Sym_6
+   141   no-op
+           optimizes label Label_49
+   141 }
+
+Peephole rewrites:
+  v4_accept: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_accept: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4_accept: redundant-test: test %rdx,%rdx => (none)
+  v4_Hashs: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Hash_Greater: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_u_Dotr: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_u_Dotr: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_u_Dotr: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Dotr: redundant-test: test %rax,%rax => (none)
+  v4_Dotr: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Dotr: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Dotr: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Greaternumber: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_strlen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+
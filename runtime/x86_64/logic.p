@@ -0,0 +1,84 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: logic.ft
+Compiled: Sat Oct 17 10:15:09 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+    26 Sym_0 codeword "v4_and"
+   138 Sym_6 word "v4_false"
+   135 Sym_5 word "v4_invert"
+    92 Sym_3 codeword "v4_lshift"
+    48 Sym_1 codeword "v4_or"
+   114 Sym_4 codeword "v4_rshift"
+   139 Sym_7 word "v4_true"
+    70 Sym_2 codeword "v4_xor"
+
+Intermediate code:
+    26 function Sym_0 {
+    27   asm (    call v4__dpop@PLT)
+    28   asm (    mov %rax,%rdi)
+    29   asm (    call v4__dpop@PLT)
+    30   asm (    and %rdi,%rax)
+    31   asm (    call v4__dpush@PLT)
+    33   asm (    forth_pic.=0b-0b)
+    34 }
+
+    48 function Sym_1 {
+    49   asm (    call v4__dpop@PLT)
+    50   asm (    mov %rax,%rdi)
+    51   asm (    call v4__dpop@PLT)
+    52   asm (    or %rdi,%rax)
+    53   asm (    call v4__dpush@PLT)
+    55   asm (    forth_pic.=0b-0b)
+    56 }
+
+    70 function Sym_2 {
+    71   asm (    call v4__dpop@PLT)
+    72   asm (    mov %rax,%rdi)
+    73   asm (    call v4__dpop@PLT)
+    74   asm (    xor %rdi,%rax)
+    75   asm (    call v4__dpush@PLT)
+    77   asm (    forth_pic.=0b-0b)
+    78 }
+
+    92 function Sym_3 {
+    93   asm (    call v4__dpop@PLT)
+    94   asm (    mov %rax,%rcx)
+    95   asm (    call v4__dpop@PLT)
+    96   asm (    shl %cl,%rax)
+    97   asm (    call v4__dpush@PLT)
+    99   asm (    forth_pic.=0b-0b)
+   100 }
+
+   114 function Sym_4 {
+   115   asm (    call v4__dpop@PLT)
+   116   asm (    mov %rax,%rcx)
+   117   asm (    call v4__dpop@PLT)
+   118   asm (    shr %cl,%rax)
+   119   asm (    call v4__dpush@PLT)
+   121   asm (    forth_pic.=0b-0b)
+   122 }
+
+   135 function Sym_5 {
+   136   Reg_0 = -1
+   136   Stack_D = Reg_0
+   136   tail call Sym_2
+           optimizes   call Sym_2
+   136   no-op
+           optimizes label Label_1
+   136 }
+
+   138 function Sym_6 {
+   138   Reg_0 = 0
+   138   Stack_D = Reg_0
+   138   no-op
+           optimizes label Label_2
+   138 }
+
+   139 function Sym_7 {
+   139   Reg_0 = -1
+   139   Stack_D = Reg_0
+   139   no-op
+           optimizes label Label_3
+   139 }
+
@@ -0,0 +1,295 @@
+	.file	"logic.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"logic.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_and:F1",36,0,0,v4_and
+	.weak v4_and
+	.type	v4_and,@function
+v4_and:
+.stabn 68,0,26,.LMa0-v4_and
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,26,.LMb0-v4_and
+.LMb0:
+.LBB0:
+#APP
+    call v4__dpop@PLT
+    mov %rax,%rdi
+    call v4__dpop@PLT
+    and %rdi,%rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE0:
+.stabn 68,0,34,.LM7-v4_and
+.LM7:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_and,.Lfe0-v4_and
+.stabn	192,0,0,.LBB0-v4_and
+.stabn	224,0,0,.LBE0-v4_and
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_and
+.text
+	.align 4
+.stabs "v4_or:F1",36,0,0,v4_or
+	.weak v4_or
+	.type	v4_or,@function
+v4_or:
+.stabn 68,0,48,.LMa8-v4_or
+.LMa8:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,48,.LMb8-v4_or
+.LMb8:
+.LBB1:
+#APP
+    call v4__dpop@PLT
+    mov %rax,%rdi
+    call v4__dpop@PLT
+    or %rdi,%rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE1:
+.stabn 68,0,56,.LM15-v4_or
+.LM15:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe1:
+	.size	 v4_or,.Lfe1-v4_or
+.stabn	192,0,0,.LBB1-v4_or
+.stabn	224,0,0,.LBE1-v4_or
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4_or
+.text
+	.align 4
+.stabs "v4_xor:F1",36,0,0,v4_xor
+	.weak v4_xor
+	.type	v4_xor,@function
+v4_xor:
+.stabn 68,0,70,.LMa16-v4_xor
+.LMa16:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,70,.LMb16-v4_xor
+.LMb16:
+.LBB2:
+#APP
+    call v4__dpop@PLT
+    mov %rax,%rdi
+    call v4__dpop@PLT
+    xor %rdi,%rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE2:
+.stabn 68,0,78,.LM23-v4_xor
+.LM23:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe2:
+	.size	 v4_xor,.Lfe2-v4_xor
+.stabn	192,0,0,.LBB2-v4_xor
+.stabn	224,0,0,.LBE2-v4_xor
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4_xor
+.text
+	.align 4
+.stabs "v4_lshift:F1",36,0,0,v4_lshift
+	.weak v4_lshift
+	.type	v4_lshift,@function
+v4_lshift:
+.stabn 68,0,92,.LMa24-v4_lshift
+.LMa24:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,92,.LMb24-v4_lshift
+.LMb24:
+.LBB3:
+#APP
+    call v4__dpop@PLT
+    mov %rax,%rcx
+    call v4__dpop@PLT
+    shl %cl,%rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE3:
+.stabn 68,0,100,.LM31-v4_lshift
+.LM31:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe3:
+	.size	 v4_lshift,.Lfe3-v4_lshift
+.stabn	192,0,0,.LBB3-v4_lshift
+.stabn	224,0,0,.LBE3-v4_lshift
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4_lshift
+.text
+	.align 4
+.stabs "v4_rshift:F1",36,0,0,v4_rshift
+	.weak v4_rshift
+	.type	v4_rshift,@function
+v4_rshift:
+.stabn 68,0,114,.LMa32-v4_rshift
+.LMa32:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,114,.LMb32-v4_rshift
+.LMb32:
+.LBB4:
+#APP
+    call v4__dpop@PLT
+    mov %rax,%rcx
+    call v4__dpop@PLT
+    shr %cl,%rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE4:
+.stabn 68,0,122,.LM39-v4_rshift
+.LM39:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe4:
+	.size	 v4_rshift,.Lfe4-v4_rshift
+.stabn	192,0,0,.LBB4-v4_rshift
+.stabn	224,0,0,.LBE4-v4_rshift
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4_rshift
+.text
+	.align 4
+.stabs "v4_invert:F1",36,0,0,v4_invert
+	.weak v4_invert
+	.type	v4_invert,@function
+v4_invert:
+.stabn 68,0,135,.LMa40-v4_invert
+.LMa40:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,135,.LMb40-v4_invert
+.LMb40:
+.LBB5:
+.stabn 68,0,136,.LM41-v4_invert
+.LM41:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_xor@PLT
+.LBE5:
+.stabn 68,0,136,.LM45-v4_invert
+.LM45:
+	pop %rbx
+	leave
+	ret
+.Lfe5:
+	.size	 v4_invert,.Lfe5-v4_invert
+.stabn	192,0,0,.LBB5-v4_invert
+.stabn	224,0,0,.LBE5-v4_invert
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4_invert
+.text
+	.align 4
+.stabs "v4_false:F1",36,0,0,v4_false
+	.weak v4_false
+	.type	v4_false,@function
+v4_false:
+.stabn 68,0,138,.LMa46-v4_false
+.LMa46:
+0:
+.stabn 68,0,138,.LMb46-v4_false
+.LMb46:
+.LBB6:
+	xor %rax,%rax
+	call v4__dpush@PLT
+.LBE6:
+.stabn 68,0,138,.LM50-v4_false
+.LM50:
+	ret
+.Lfe6:
+	.size	 v4_false,.Lfe6-v4_false
+.stabn	192,0,0,.LBB6-v4_false
+.stabn	224,0,0,.LBE6-v4_false
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4_false
+.text
+	.align 4
+.stabs "v4_true:F1",36,0,0,v4_true
+	.weak v4_true
+	.type	v4_true,@function
+v4_true:
+.stabn 68,0,139,.LMa51-v4_true
+.LMa51:
+0:
+.stabn 68,0,139,.LMb51-v4_true
+.LMb51:
+.LBB7:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+.LBE7:
+.stabn 68,0,139,.LM55-v4_true
+.LM55:
+	ret
+.Lfe7:
+	.size	 v4_true,.Lfe7-v4_true
+.stabn	192,0,0,.LBB7-v4_true
+.stabn	224,0,0,.LBE7-v4_true
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_true
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"
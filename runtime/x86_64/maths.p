@@ -0,0 +1,926 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: maths.ft
+Compiled: Sat Oct 17 10:15:09 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+   211 Sym_15 external "v4_Greaterr"
+   222 Sym_27 word "v4_Minus"
+   207 Sym_11 word "v4_Plus"
+   249 Sym_37 word "v4_Slash"
+   243 Sym_35 word "v4_Slashmod"
+   231 Sym_30 word "v4_Star"
+   255 Sym_39 word "v4_Star_Slash"
+   252 Sym_38 word "v4_Star_Slashmod"
+   167 Sym_9 codeword "v4___Parensm_Slashrem_Closeparen"
+   126 Sym_4 codeword "v4___Parenum_Slashmod_Closeparen"
+   225 Sym_28 word "v4_abs"
+   212 Sym_21 external "v4_and"
+   240 Sym_34 word "v4_d_Greaters"
+   219 Sym_26 word "v4_dnegate"
+   208 Sym_12 external "v4_drop"
+   164 Sym_6 external "v4_dup"
+   210 Sym_13 word "v4_fm_Slashmod"
+   217 Sym_25 external "v4_invert"
+   259 Sym_41 external "v4_lshift"
+   234 Sym_31 word "v4_m_Slashmod"
+   228 Sym_29 word "v4_m_Star"
+   246 Sym_36 word "v4_mod"
+   216 Sym_24 word "v4_negate"
+   263 Sym_44 external "v4_or"
+   211 Sym_16 external "v4_over"
+   212 Sym_18 external "v4_r_Fetch"
+   212 Sym_17 external "v4_r_Greater"
+   214 Sym_23 external "v4_rdrop"
+   262 Sym_43 external "v4_rshift"
+   237 Sym_32 word "v4_s_Greaterd"
+   204 Sym_10 word "v4_sm_Slashrem"
+   213 Sym_22 external "v4_swap"
+   164 Sym_8 external "v4_throw"
+    62 Sym_2 codeword "v4_um_Plus"
+   163 Sym_5 word "v4_um_Slashmod"
+    96 Sym_3 codeword "v4_um_Star"
+   212 Sym_19 external "v4_xor"
+   164 Sym_7 external "v4_z0_Equals"
+   238 Sym_33 external "v4_z0_Greater"
+   212 Sym_20 external "v4_z0_Less"
+    44 Sym_1 codeword "v4_z1_Minus"
+    26 Sym_0 codeword "v4_z1_Plus"
+   261 Sym_42 word "v4_z2_Slash"
+   258 Sym_40 word "v4_z2_Star"
+   211 Sym_14 external "v4_z2dup"
+
+Intermediate code:
+    26 function Sym_0 {
+    27   asm (    call v4__dpop@PLT)
+    28   asm (    inc %rax)
+    29   asm (    call v4__dpush@PLT)
+    31   asm (    forth_pic.=0b-0b)
+    32 }
+
+    44 function Sym_1 {
+    45   asm (    call v4__dpop@PLT)
+    46   asm (    dec %rax)
+    47   asm (    call v4__dpush@PLT)
+    49   asm (    forth_pic.=0b-0b)
+    50 }
+
+    62 function Sym_2 {
+    63   asm (    call v4__dpop@PLT)
+    64   asm (    mov %rax,%rdi)
+    65   asm (    call v4__dpop@PLT)
+    67   asm (    xor %edx,%edx)
+    68   asm (    add %rdi,%rax)
+    69   asm (    rcl $1,%dx)
+    70   asm (    mov %rdx,%rdi)
+    71   asm (    call v4__dpush@PLT)
+    72   asm (    mov %rdi,%rax)
+    73   asm (    call v4__dpush@PLT)
+    75   asm (    forth_pic.=0b-0b)
+    76 }
+
+    96 function Sym_3 {
+    97   asm (    call v4__dpop@PLT)
+    98   asm (    mov %rax,%rdi)
+    99   asm (    call v4__dpop@PLT)
+   101   asm (    mul %rdi)
+   102   asm (    mov %rdx,%rdi)
+   103   asm (    call v4__dpush@PLT)
+   104   asm (    mov %rdi,%rax)
+   105   asm (    call v4__dpush@PLT)
+   107   asm (    forth_pic.=0b-0b)
+   108 }
+
+   126 function Sym_4 {
+   127   asm (    call v4__dpop@PLT)
+   128   asm (    mov %rax,%rdi)
+   129   asm (    call v4__dpop@PLT)
+   130   asm (    mov %rax,%rsi)
+   131   asm (    call v4__dpop@PLT)
+   132   asm (    mov %rsi,%rdx)
+   134   asm (    div %rdi)
+   135   asm (    mov %rax,%rdi)
+   136   asm (    mov %rdx,%rax)
+   137   asm (    call v4__dpush@PLT)
+   138   asm (    mov %rdi,%rax)
+   139   asm (    call v4__dpush@PLT)
+   141   asm (    forth_pic.=0b-0b)
+   142 }
+
+   163 function Sym_5 {
+   164   call Sym_6
+   164   no-op
+           optimizes   call Sym_7
+   164   Reg_0 = Stack_D
+   164   if Reg_0 != 0 goto Label_2
+   164   no-op
+           optimizes   Reg_0 = Stack_D
+   164   no-op
+           optimizes   if Reg_0 == 0 goto Label_2
+   164   Reg_0 = -10
+   164   Stack_D = Reg_0
+   164   call Sym_8
+   164 label Label_2
+   164   tail call Sym_4
+           optimizes   call Sym_4
+   164   no-op
+           optimizes label Label_1
+   164 }
+
+   167 function Sym_9 {
+   168   asm (    call v4__dpop@PLT)
+   169   asm (    mov %rax,%rdi)
+   170   asm (    call v4__dpop@PLT)
+   171   asm (    mov %rax,%rsi)
+   172   asm (    call v4__dpop@PLT)
+   173   asm (    mov %rsi,%rdx)
+   175   asm (    idiv %rdi)
+   176   asm (    mov %rax,%rdi)
+   177   asm (    mov %rdx,%rax)
+   178   asm (    call v4__dpush@PLT)
+   179   asm (    mov %rdi,%rax)
+   180   asm (    call v4__dpush@PLT)
+   182   asm (    forth_pic.=0b-0b)
+   183 }
+
+   204 function Sym_10 {
+   205   call Sym_6
+   205   no-op
+           optimizes   call Sym_7
+   205   Reg_0 = Stack_D
+   205   if Reg_0 != 0 goto Label_4
+   205   no-op
+           optimizes   Reg_0 = Stack_D
+   205   no-op
+           optimizes   if Reg_0 == 0 goto Label_4
+   205   Reg_0 = -10
+   205   Stack_D = Reg_0
+   205   call Sym_8
+   205 label Label_4
+   205   tail call Sym_9
+           optimizes   call Sym_9
+   205   no-op
+           optimizes label Label_3
+   205 }
+
+   207 function Sym_11 {
+   208   call Sym_2
+   208   tail call Sym_12
+           optimizes   call Sym_12
+   208   no-op
+           optimizes label Label_5
+   208 }
+
+   210 function Sym_13 {
+   211   call Sym_14
+   211   call Sym_15
+   211   call Sym_15
+   211   no-op
+           optimizes   call Sym_10
+   205   call Sym_6
+   205   no-op
+           optimizes   call Sym_7
+   205   Reg_0 = Stack_D
+   205   if Reg_0 != 0 goto Label_19
+   205   no-op
+           optimizes   Reg_0 = Stack_D
+   205   no-op
+           optimizes   if Reg_0 == 0 goto Label_19
+   205   Reg_0 = -10
+   205   Stack_D = Reg_0
+   205   call Sym_8
+   205 label Label_19
+   205   call Sym_9
+   211   call Sym_16
+   212   call Sym_17
+   212   call Sym_18
+   212   no-op
+           optimizes   call Sym_19
+   212   Reg_1 = Stack_D
+   212   Reg_0 = Stack_D
+   212   Reg_0 ^= Reg_1
+   212   no-op
+           optimizes   Stack_D = Reg_0
+   212   no-op
+           optimizes   call Sym_20
+   212   no-op
+           optimizes   Reg_0 = Stack_D
+   212   Reg_0 = Reg_0 < 0
+   212   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   212   no-op
+           optimizes   call Sym_21
+   212   no-op
+           optimizes   Reg_1 = Stack_D
+   212   Reg_0 = Stack_D
+   212   Reg_0 &= Reg_1
+   212   no-op
+           optimizes   Stack_D = Reg_0
+   212   no-op
+           optimizes   Reg_0 = Stack_D
+   212   if Reg_0 == 0 goto Label_7
+   213   call Sym_1
+   213   call Sym_22
+   213   call Sym_18
+   213   no-op
+           optimizes   call Sym_11
+   208   call Sym_2
+   208   call Sym_12
+   213   call Sym_22
+   214 label Label_7
+   214   tail call Sym_23
+           optimizes   call Sym_23
+   214   no-op
+           optimizes label Label_6
+   214 }
+
+   216 function Sym_24 {
+   217   no-op
+           optimizes   call Sym_25
+   217   Reg_0 = Stack_D
+   217   Reg_0 = ~Reg_0
+   217   Stack_D = Reg_0
+   217   tail call Sym_0
+           optimizes   call Sym_0
+   217   no-op
+           optimizes label Label_8
+   217 }
+
+   219 function Sym_26 {
+   220   no-op
+           optimizes   call Sym_25
+   220   Reg_0 = Stack_D
+   220   Reg_0 = ~Reg_0
+   220   Stack_D = Reg_0
+   220   call Sym_15
+   220   no-op
+           optimizes   call Sym_25
+   220   Reg_0 = Stack_D
+   220   Reg_0 = ~Reg_0
+   220   Stack_D = Reg_0
+   220   Reg_0 = 1
+   220   Stack_D = Reg_0
+   220   call Sym_2
+   220   call Sym_17
+   220   no-op
+           optimizes   call Sym_11
+   208   call Sym_2
+   208   tail call Sym_12
+           optimizes   call Sym_12
+   220   no-op
+           optimizes label Label_9
+   220 }
+
+   222 function Sym_27 {
+   223   no-op
+           optimizes   call Sym_24
+   217   no-op
+           optimizes   call Sym_25
+   217   Reg_0 = Stack_D
+   217   Reg_0 = ~Reg_0
+   217   Stack_D = Reg_0
+   217   call Sym_0
+   223   no-op
+           optimizes   call Sym_11
+   208   call Sym_2
+   208   tail call Sym_12
+           optimizes   call Sym_12
+   223   no-op
+           optimizes label Label_10
+   223 }
+
+   225 function Sym_28 {
+   226   call Sym_6
+   226   no-op
+           optimizes   call Sym_20
+   226   Reg_0 = Stack_D
+   226   if Reg_0 >= 0 goto Label_12
+   226   no-op
+           optimizes   Reg_0 = Stack_D
+   226   no-op
+           optimizes   if Reg_0 == 0 goto Label_12
+   226   no-op
+           optimizes   call Sym_24
+   217   no-op
+           optimizes   call Sym_25
+   217   Reg_0 = Stack_D
+   217   Reg_0 = ~Reg_0
+   217   Stack_D = Reg_0
+   217   tail call Sym_0
+           optimizes   call Sym_0
+   226 label Label_12
+   226   no-op
+           optimizes label Label_11
+   226 }
+
+   228 function Sym_29 {
+   229   call Sym_14
+   229   no-op
+           optimizes   call Sym_19
+   229   Reg_1 = Stack_D
+   229   Reg_0 = Stack_D
+   229   Reg_0 ^= Reg_1
+   229   no-op
+           optimizes   Stack_D = Reg_0
+   229   no-op
+           optimizes   call Sym_20
+   229   no-op
+           optimizes   Reg_0 = Stack_D
+   229   Reg_0 = Reg_0 < 0
+   229   Stack_D = Reg_0
+   229   call Sym_15
+   229   no-op
+           optimizes   call Sym_28
+   226   call Sym_6
+   226   no-op
+           optimizes   call Sym_20
+   226   Reg_0 = Stack_D
+   226   if Reg_0 >= 0 goto Label_20
+   226   no-op
+           optimizes   Reg_0 = Stack_D
+   226   no-op
+           optimizes   if Reg_0 == 0 goto Label_20
+   226   no-op
+           optimizes   call Sym_24
+   217   no-op
+           optimizes   call Sym_25
+   217   Reg_0 = Stack_D
+   217   Reg_0 = ~Reg_0
+   217   Stack_D = Reg_0
+   217   call Sym_0
+   226 label Label_20
+   229   call Sym_22
+   229   no-op
+           optimizes   call Sym_28
+   226   call Sym_6
+   226   no-op
+           optimizes   call Sym_20
+   226   Reg_0 = Stack_D
+   226   if Reg_0 >= 0 goto Label_21
+   226   no-op
+           optimizes   Reg_0 = Stack_D
+   226   no-op
+           optimizes   if Reg_0 == 0 goto Label_21
+   226   no-op
+           optimizes   call Sym_24
+   217   no-op
+           optimizes   call Sym_25
+   217   Reg_0 = Stack_D
+   217   Reg_0 = ~Reg_0
+   217   Stack_D = Reg_0
+   217   call Sym_0
+   226 label Label_21
+   229   call Sym_3
+   229   call Sym_17
+   229   Reg_0 = Stack_D
+   229   if Reg_0 == 0 goto Label_14
+   229   no-op
+           optimizes   call Sym_26
+   220   no-op
+           optimizes   call Sym_25
+   220   Reg_0 = Stack_D
+   220   Reg_0 = ~Reg_0
+   220   Stack_D = Reg_0
+   220   call Sym_15
+   220   no-op
+           optimizes   call Sym_25
+   220   Reg_0 = Stack_D
+   220   Reg_0 = ~Reg_0
+   220   Stack_D = Reg_0
+   220   Reg_0 = 1
+   220   Stack_D = Reg_0
+   220   call Sym_2
+   220   call Sym_17
+   220   no-op
+           optimizes   call Sym_11
+   208   call Sym_2
+   208   tail call Sym_12
+           optimizes   call Sym_12
+   229 label Label_14
+   229   no-op
+           optimizes label Label_13
+   229 }
+
+   231 function Sym_30 {
+   232   call Sym_3
+   232   tail call Sym_12
+           optimizes   call Sym_12
+   232   no-op
+           optimizes label Label_15
+   232 }
+
+   234 function Sym_31 {
+   235   no-op
+           optimizes   call Sym_10
+   205   call Sym_6
+   205   no-op
+           optimizes   call Sym_7
+   205   Reg_0 = Stack_D
+   205   if Reg_0 != 0 goto Label_22
+   205   no-op
+           optimizes   Reg_0 = Stack_D
+   205   no-op
+           optimizes   if Reg_0 == 0 goto Label_22
+   205   Reg_0 = -10
+   205   Stack_D = Reg_0
+   205   call Sym_8
+   205 label Label_22
+   205   tail call Sym_9
+           optimizes   call Sym_9
+   235   no-op
+           optimizes label Label_16
+   235 }
+
+   237 function Sym_32 {
+   238   call Sym_6
+   238   no-op
+           optimizes   call Sym_33
+   238   Reg_0 = Stack_D
+   238   if Reg_0 <= 0 goto Label_18
+   238   no-op
+           optimizes   Reg_0 = Stack_D
+   238   no-op
+           optimizes   if Reg_0 == 0 goto Label_18
+   238   Reg_0 = 0
+   238   Stack_D = Reg_0
+   238   goto Label_17
+   238 label Label_18
+   238   no-op
+           optimizes   call Sym_24
+   217   no-op
+           optimizes   call Sym_25
+   217   Reg_0 = Stack_D
+   217   Reg_0 = ~Reg_0
+   217   Stack_D = Reg_0
+   217   call Sym_0
+   238   Reg_0 = -1
+           optimizes   Reg_0 = 0
+   238   Stack_D = Reg_0
+   238   no-op
+           optimizes   call Sym_26
+   220   no-op
+           optimizes   call Sym_25
+   220   call Sym_15
+   220   no-op
+           optimizes   call Sym_25
+   220   Reg_0 = Stack_D
+   220   Reg_0 = ~Reg_0
+   220   Stack_D = Reg_0
+   220   Reg_0 = 1
+   220   Stack_D = Reg_0
+   220   call Sym_2
+   220   call Sym_17
+   220   no-op
+           optimizes   call Sym_11
+   208   call Sym_2
+   208   tail call Sym_12
+           optimizes   call Sym_12
+   238 label Label_17
+   238 }
+
+   240 function Sym_34 {
+   241   tail call Sym_12
+           optimizes   call Sym_12
+   241   no-op
+           optimizes label Label_19
+   241 }
+
+   243 function Sym_35 {
+   244   call Sym_15
+   244   no-op
+           optimizes   call Sym_32
+   238   call Sym_6
+   238   no-op
+           optimizes   call Sym_33
+   238   Reg_0 = Stack_D
+   238   if Reg_0 <= 0 goto Label_23
+   238   no-op
+           optimizes   Reg_0 = Stack_D
+   238   no-op
+           optimizes   if Reg_0 == 0 goto Label_23
+   238   Reg_0 = 0
+   238   Stack_D = Reg_0
+   238   goto Label_24
+   238 label Label_23
+   238   no-op
+           optimizes   call Sym_24
+   217   no-op
+           optimizes   call Sym_25
+   217   Reg_0 = Stack_D
+   217   Reg_0 = ~Reg_0
+   217   Stack_D = Reg_0
+   217   call Sym_0
+   238   Reg_0 = -1
+           optimizes   Reg_0 = 0
+   238   Stack_D = Reg_0
+   238   no-op
+           optimizes   call Sym_26
+   220   no-op
+           optimizes   call Sym_25
+   220   call Sym_15
+   220   no-op
+           optimizes   call Sym_25
+   220   Reg_0 = Stack_D
+   220   Reg_0 = ~Reg_0
+   220   Stack_D = Reg_0
+   220   Reg_0 = 1
+   220   Stack_D = Reg_0
+   220   call Sym_2
+   220   call Sym_17
+   208   call Sym_2
+   208   call Sym_12
+   238 label Label_24
+   244   call Sym_17
+   244   no-op
+           optimizes   call Sym_31
+   235   no-op
+           optimizes   call Sym_10
+   205   call Sym_6
+   205   no-op
+           optimizes   call Sym_7
+   205   Reg_0 = Stack_D
+   205   if Reg_0 != 0 goto Label_31
+   205   no-op
+           optimizes   Reg_0 = Stack_D
+   205   no-op
+           optimizes   if Reg_0 == 0 goto Label_31
+   205   Reg_0 = -10
+   205   Stack_D = Reg_0
+   205   call Sym_8
+   205 label Label_31
+   205   tail call Sym_9
+           optimizes   call Sym_9
+   244   no-op
+           optimizes label Label_20
+   244 }
+
+   246 function Sym_36 {
+   247   call Sym_15
+   247   no-op
+           optimizes   call Sym_32
+   238   call Sym_6
+   238   no-op
+           optimizes   call Sym_33
+   238   Reg_0 = Stack_D
+   238   if Reg_0 <= 0 goto Label_25
+   238   no-op
+           optimizes   Reg_0 = Stack_D
+   238   no-op
+           optimizes   if Reg_0 == 0 goto Label_25
+   238   Reg_0 = 0
+   238   Stack_D = Reg_0
+   238   goto Label_26
+   238 label Label_25
+   238   no-op
+           optimizes   call Sym_24
+   217   no-op
+           optimizes   call Sym_25
+   217   Reg_0 = Stack_D
+   217   Reg_0 = ~Reg_0
+   217   Stack_D = Reg_0
+   217   call Sym_0
+   238   Reg_0 = -1
+           optimizes   Reg_0 = 0
+   238   Stack_D = Reg_0
+   238   no-op
+           optimizes   call Sym_26
+   220   no-op
+           optimizes   call Sym_25
+   220   call Sym_15
+   220   no-op
+           optimizes   call Sym_25
+   220   Reg_0 = Stack_D
+   220   Reg_0 = ~Reg_0
+   220   Stack_D = Reg_0
+   220   Reg_0 = 1
+   220   Stack_D = Reg_0
+   220   call Sym_2
+   220   call Sym_17
+   208   call Sym_2
+   208   call Sym_12
+   238 label Label_26
+   247   call Sym_17
+   247   no-op
+           optimizes   call Sym_31
+   235   no-op
+           optimizes   call Sym_10
+   205   call Sym_6
+   205   no-op
+           optimizes   call Sym_7
+   205   Reg_0 = Stack_D
+   205   if Reg_0 != 0 goto Label_32
+   205   no-op
+           optimizes   Reg_0 = Stack_D
+   205   no-op
+           optimizes   if Reg_0 == 0 goto Label_32
+   205   Reg_0 = -10
+   205   Stack_D = Reg_0
+   205   call Sym_8
+   205 label Label_32
+   205   call Sym_9
+   247   tail call Sym_12
+           optimizes   call Sym_12
+   247   no-op
+           optimizes label Label_21
+   247 }
+
+   249 function Sym_37 {
+   250   call Sym_15
+   250   no-op
+           optimizes   call Sym_32
+   238   call Sym_6
+   238   no-op
+           optimizes   call Sym_33
+   238   Reg_0 = Stack_D
+   238   if Reg_0 <= 0 goto Label_27
+   238   no-op
+           optimizes   Reg_0 = Stack_D
+   238   no-op
+           optimizes   if Reg_0 == 0 goto Label_27
+   238   Reg_0 = 0
+   238   Stack_D = Reg_0
+   238   goto Label_28
+   238 label Label_27
+   238   no-op
+           optimizes   call Sym_24
+   217   no-op
+           optimizes   call Sym_25
+   217   Reg_0 = Stack_D
+   217   Reg_0 = ~Reg_0
+   217   Stack_D = Reg_0
+   217   call Sym_0
+   238   Reg_0 = -1
+           optimizes   Reg_0 = 0
+   238   Stack_D = Reg_0
+   238   no-op
+           optimizes   call Sym_26
+   220   no-op
+           optimizes   call Sym_25
+   220   call Sym_15
+   220   no-op
+           optimizes   call Sym_25
+   220   Reg_0 = Stack_D
+   220   Reg_0 = ~Reg_0
+   220   Stack_D = Reg_0
+   220   Reg_0 = 1
+   220   Stack_D = Reg_0
+   220   call Sym_2
+   220   call Sym_17
+   208   call Sym_2
+   208   call Sym_12
+   238 label Label_28
+   250   call Sym_17
+   250   no-op
+           optimizes   call Sym_31
+   235   no-op
+           optimizes   call Sym_10
+   205   call Sym_6
+   205   no-op
+           optimizes   call Sym_7
+   205   Reg_0 = Stack_D
+   205   if Reg_0 != 0 goto Label_33
+   205   no-op
+           optimizes   Reg_0 = Stack_D
+   205   no-op
+           optimizes   if Reg_0 == 0 goto Label_33
+   205   Reg_0 = -10
+   205   Stack_D = Reg_0
+   205   call Sym_8
+   205 label Label_33
+   205   call Sym_9
+   250   call Sym_22
+   250   tail call Sym_12
+           optimizes   call Sym_12
+   250   no-op
+           optimizes label Label_22
+   250 }
+
+   252 function Sym_38 {
+   253   call Sym_15
+   253   no-op
+           optimizes   call Sym_29
+   229   call Sym_14
+   229   no-op
+           optimizes   call Sym_19
+   229   Reg_1 = Stack_D
+   229   Reg_0 = Stack_D
+   229   Reg_0 ^= Reg_1
+   229   no-op
+           optimizes   Stack_D = Reg_0
+   229   no-op
+           optimizes   call Sym_20
+   229   no-op
+           optimizes   Reg_0 = Stack_D
+   229   Reg_0 = Reg_0 < 0
+   229   Stack_D = Reg_0
+   229   call Sym_15
+   229   no-op
+           optimizes   call Sym_28
+   226   call Sym_6
+   226   no-op
+           optimizes   call Sym_20
+   226   Reg_0 = Stack_D
+   226   if Reg_0 >= 0 goto Label_34
+   226   no-op
+           optimizes   Reg_0 = Stack_D
+   226   no-op
+           optimizes   if Reg_0 == 0 goto Label_34
+   217   no-op
+           optimizes   call Sym_25
+   217   Reg_0 = Stack_D
+   217   Reg_0 = ~Reg_0
+   217   Stack_D = Reg_0
+   217   call Sym_0
+   226 label Label_34
+   229   call Sym_22
+   229   no-op
+           optimizes   call Sym_28
+   226   call Sym_6
+   226   no-op
+           optimizes   call Sym_20
+   226   Reg_0 = Stack_D
+   226   if Reg_0 >= 0 goto Label_35
+   226   no-op
+           optimizes   Reg_0 = Stack_D
+   226   no-op
+           optimizes   if Reg_0 == 0 goto Label_35
+   217   no-op
+           optimizes   call Sym_25
+   217   Reg_0 = Stack_D
+   217   Reg_0 = ~Reg_0
+   217   Stack_D = Reg_0
+   217   call Sym_0
+   226 label Label_35
+   229   call Sym_3
+   229   call Sym_17
+   229   Reg_0 = Stack_D
+   229   if Reg_0 == 0 goto Label_29
+   229   no-op
+           optimizes   call Sym_26
+   220   no-op
+           optimizes   call Sym_25
+   220   Reg_0 = Stack_D
+   220   Reg_0 = ~Reg_0
+   220   Stack_D = Reg_0
+   220   call Sym_15
+   220   no-op
+           optimizes   call Sym_25
+   220   Reg_0 = Stack_D
+   220   Reg_0 = ~Reg_0
+   220   Stack_D = Reg_0
+   220   Reg_0 = 1
+   220   Stack_D = Reg_0
+   220   call Sym_2
+   220   call Sym_17
+   208   call Sym_2
+   208   call Sym_12
+   229 label Label_29
+   253   call Sym_17
+   253   no-op
+           optimizes   call Sym_31
+   235   no-op
+           optimizes   call Sym_10
+   205   call Sym_6
+   205   no-op
+           optimizes   call Sym_7
+   205   Reg_0 = Stack_D
+   205   if Reg_0 != 0 goto Label_36
+   205   no-op
+           optimizes   Reg_0 = Stack_D
+   205   no-op
+           optimizes   if Reg_0 == 0 goto Label_36
+   205   Reg_0 = -10
+   205   Stack_D = Reg_0
+   205   call Sym_8
+   205 label Label_36
+   205   tail call Sym_9
+           optimizes   call Sym_9
+   253   no-op
+           optimizes label Label_23
+   253 }
+
+   255 function Sym_39 {
+   256   call Sym_15
+   256   no-op
+           optimizes   call Sym_29
+   229   call Sym_14
+   229   no-op
+           optimizes   call Sym_19
+   229   Reg_1 = Stack_D
+   229   Reg_0 = Stack_D
+   229   Reg_0 ^= Reg_1
+   229   no-op
+           optimizes   Stack_D = Reg_0
+   229   no-op
+           optimizes   call Sym_20
+   229   no-op
+           optimizes   Reg_0 = Stack_D
+   229   Reg_0 = Reg_0 < 0
+   229   Stack_D = Reg_0
+   229   call Sym_15
+   229   call Sym_28
+   229   call Sym_22
+   229   call Sym_28
+   229   call Sym_3
+   229   call Sym_17
+   229   Reg_0 = Stack_D
+   229   if Reg_0 == 0 goto Label_30
+   229   no-op
+           optimizes   call Sym_26
+   220   no-op
+           optimizes   call Sym_25
+   220   Reg_0 = Stack_D
+   220   Reg_0 = ~Reg_0
+   220   Stack_D = Reg_0
+   220   call Sym_15
+   220   no-op
+           optimizes   call Sym_25
+   220   Reg_0 = Stack_D
+   220   Reg_0 = ~Reg_0
+   220   Stack_D = Reg_0
+   220   Reg_0 = 1
+   220   Stack_D = Reg_0
+   220   call Sym_2
+   220   call Sym_17
+   208   call Sym_2
+   208   call Sym_12
+   229 label Label_30
+   256   call Sym_17
+   256   no-op
+           optimizes   call Sym_31
+   235   call Sym_10
+   256   call Sym_22
+   256   tail call Sym_12
+           optimizes   call Sym_12
+   256   no-op
+           optimizes label Label_24
+   256 }
+
+   258 function Sym_40 {
+   259   Reg_0 = 1
+   259   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   259   no-op
+           optimizes   call Sym_41
+   259   no-op
+           optimizes   Reg_1 = Stack_D
+   259   Reg_0 = Stack_D
+   259   Reg_0 <<= Reg_1
+   259   Stack_D = Reg_0
+   259   no-op
+           optimizes label Label_25
+   259 }
+
+   261 function Sym_42 {
+   262   call Sym_6
+   262   Reg_0 = -9223372036854775808
+           optimizes   Reg_0 = 9223372036854775807
+   262   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   262   no-op
+           optimizes   call Sym_25
+   262   no-op
+           optimizes   Reg_0 = 1
+   262   no-op
+           optimizes   Stack_D = Reg_0
+   262   no-op
+           optimizes   call Sym_43
+   262   no-op
+           optimizes   call Sym_25
+   262   no-op
+           optimizes   call Sym_21
+   262   no-op
+           optimizes   Reg_1 = Stack_D
+   262   Reg_0 = Stack_D
+   262   Reg_0 &= Reg_1
+   262   Stack_D = Reg_0
+   263   call Sym_22
+   263   Reg_0 = 1
+   263   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   263   no-op
+           optimizes   call Sym_43
+   263   no-op
+           optimizes   Reg_1 = Stack_D
+   263   Reg_0 = Stack_D
+   263   Reg_0 >>= Reg_1
+   263   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   263   no-op
+           optimizes   call Sym_44
+   263   no-op
+           optimizes   Reg_1 = Stack_D
+   263   Reg_0 = Stack_D
+   263   Reg_0 |= Reg_1
+   263   Stack_D = Reg_0
+   263   no-op
+           optimizes label Label_26
+   263 }
+
+Peephole rewrites:
+  v4_fm_Slashmod: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_fm_Slashmod: redundant-test: test %rax,%rax => (none)
+  v4_m_Star: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Star_Slashmod: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Star_Slash: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+
@@ -0,0 +1,1385 @@
+	.file	"maths.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"maths.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.text
+	.align 4
+.stabs "v4_z1_Plus:F1",36,0,0,v4_z1_Plus
+	.weak v4_z1_Plus
+	.type	v4_z1_Plus,@function
+v4_z1_Plus:
+.stabn 68,0,26,.LMa0-v4_z1_Plus
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,26,.LMb0-v4_z1_Plus
+.LMb0:
+.LBB0:
+#APP
+    call v4__dpop@PLT
+    inc %rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE0:
+.stabn 68,0,32,.LM5-v4_z1_Plus
+.LM5:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_z1_Plus,.Lfe0-v4_z1_Plus
+.stabn	192,0,0,.LBB0-v4_z1_Plus
+.stabn	224,0,0,.LBE0-v4_z1_Plus
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_z1_Plus
+.text
+	.align 4
+.stabs "v4_z1_Minus:F1",36,0,0,v4_z1_Minus
+	.weak v4_z1_Minus
+	.type	v4_z1_Minus,@function
+v4_z1_Minus:
+.stabn 68,0,44,.LMa6-v4_z1_Minus
+.LMa6:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,44,.LMb6-v4_z1_Minus
+.LMb6:
+.LBB1:
+#APP
+    call v4__dpop@PLT
+    dec %rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE1:
+.stabn 68,0,50,.LM11-v4_z1_Minus
+.LM11:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe1:
+	.size	 v4_z1_Minus,.Lfe1-v4_z1_Minus
+.stabn	192,0,0,.LBB1-v4_z1_Minus
+.stabn	224,0,0,.LBE1-v4_z1_Minus
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4_z1_Minus
+.text
+	.align 4
+.stabs "v4_um_Plus:F1",36,0,0,v4_um_Plus
+	.weak v4_um_Plus
+	.type	v4_um_Plus,@function
+v4_um_Plus:
+.stabn 68,0,62,.LMa12-v4_um_Plus
+.LMa12:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,62,.LMb12-v4_um_Plus
+.LMb12:
+.LBB2:
+#APP
+    call v4__dpop@PLT
+    mov %rax,%rdi
+    call v4__dpop@PLT
+    xor %edx,%edx
+    add %rdi,%rax
+    rcl $1,%dx
+    mov %rdx,%rdi
+    call v4__dpush@PLT
+    mov %rdi,%rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE2:
+.stabn 68,0,76,.LM24-v4_um_Plus
+.LM24:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe2:
+	.size	 v4_um_Plus,.Lfe2-v4_um_Plus
+.stabn	192,0,0,.LBB2-v4_um_Plus
+.stabn	224,0,0,.LBE2-v4_um_Plus
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4_um_Plus
+.text
+	.align 4
+.stabs "v4_um_Star:F1",36,0,0,v4_um_Star
+	.weak v4_um_Star
+	.type	v4_um_Star,@function
+v4_um_Star:
+.stabn 68,0,96,.LMa25-v4_um_Star
+.LMa25:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,96,.LMb25-v4_um_Star
+.LMb25:
+.LBB3:
+#APP
+    call v4__dpop@PLT
+    mov %rax,%rdi
+    call v4__dpop@PLT
+    mul %rdi
+    mov %rdx,%rdi
+    call v4__dpush@PLT
+    mov %rdi,%rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE3:
+.stabn 68,0,108,.LM35-v4_um_Star
+.LM35:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe3:
+	.size	 v4_um_Star,.Lfe3-v4_um_Star
+.stabn	192,0,0,.LBB3-v4_um_Star
+.stabn	224,0,0,.LBE3-v4_um_Star
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4_um_Star
+.text
+	.align 4
+.stabs "v4___Parenum_Slashmod_Closeparen:F1",36,0,0,v4___Parenum_Slashmod_Closeparen
+	.weak v4___Parenum_Slashmod_Closeparen
+	.type	v4___Parenum_Slashmod_Closeparen,@function
+v4___Parenum_Slashmod_Closeparen:
+.stabn 68,0,126,.LMa36-v4___Parenum_Slashmod_Closeparen
+.LMa36:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,126,.LMb36-v4___Parenum_Slashmod_Closeparen
+.LMb36:
+.LBB4:
+#APP
+    call v4__dpop@PLT
+    mov %rax,%rdi
+    call v4__dpop@PLT
+    mov %rax,%rsi
+    call v4__dpop@PLT
+    mov %rsi,%rdx
+    div %rdi
+    mov %rax,%rdi
+    mov %rdx,%rax
+    call v4__dpush@PLT
+    mov %rdi,%rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE4:
+.stabn 68,0,142,.LM50-v4___Parenum_Slashmod_Closeparen
+.LM50:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe4:
+	.size	 v4___Parenum_Slashmod_Closeparen,.Lfe4-v4___Parenum_Slashmod_Closeparen
+.stabn	192,0,0,.LBB4-v4___Parenum_Slashmod_Closeparen
+.stabn	224,0,0,.LBE4-v4___Parenum_Slashmod_Closeparen
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4___Parenum_Slashmod_Closeparen
+.text
+	.align 4
+.stabs "v4_um_Slashmod:F1",36,0,0,v4_um_Slashmod
+	.weak v4_um_Slashmod
+	.type	v4_um_Slashmod,@function
+v4_um_Slashmod:
+.stabn 68,0,163,.LMa51-v4_um_Slashmod
+.LMa51:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,163,.LMb51-v4_um_Slashmod
+.LMb51:
+.LBB5:
+.stabn 68,0,164,.LM52-v4_um_Slashmod
+.LM52:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L2
+	mov $-10,%rax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.L2:
+	pop %rbx
+	leave
+	jmp v4___Parenum_Slashmod_Closeparen@PLT
+.LBE5:
+.stabn 68,0,164,.LM64-v4_um_Slashmod
+.LM64:
+	pop %rbx
+	leave
+	ret
+.Lfe5:
+	.size	 v4_um_Slashmod,.Lfe5-v4_um_Slashmod
+.stabn	192,0,0,.LBB5-v4_um_Slashmod
+.stabn	224,0,0,.LBE5-v4_um_Slashmod
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4_um_Slashmod
+.text
+	.align 4
+.stabs "v4___Parensm_Slashrem_Closeparen:F1",36,0,0,v4___Parensm_Slashrem_Closeparen
+	.weak v4___Parensm_Slashrem_Closeparen
+	.type	v4___Parensm_Slashrem_Closeparen,@function
+v4___Parensm_Slashrem_Closeparen:
+.stabn 68,0,167,.LMa65-v4___Parensm_Slashrem_Closeparen
+.LMa65:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,167,.LMb65-v4___Parensm_Slashrem_Closeparen
+.LMb65:
+.LBB9:
+#APP
+    call v4__dpop@PLT
+    mov %rax,%rdi
+    call v4__dpop@PLT
+    mov %rax,%rsi
+    call v4__dpop@PLT
+    mov %rsi,%rdx
+    idiv %rdi
+    mov %rax,%rdi
+    mov %rdx,%rax
+    call v4__dpush@PLT
+    mov %rdi,%rax
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE9:
+.stabn 68,0,183,.LM79-v4___Parensm_Slashrem_Closeparen
+.LM79:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe9:
+	.size	 v4___Parensm_Slashrem_Closeparen,.Lfe9-v4___Parensm_Slashrem_Closeparen
+.stabn	192,0,0,.LBB9-v4___Parensm_Slashrem_Closeparen
+.stabn	224,0,0,.LBE9-v4___Parensm_Slashrem_Closeparen
+.Lscope9:
+.stabs	"",36,0,0,.Lscope9-v4___Parensm_Slashrem_Closeparen
+.text
+	.align 4
+.stabs "v4_sm_Slashrem:F1",36,0,0,v4_sm_Slashrem
+	.weak v4_sm_Slashrem
+	.type	v4_sm_Slashrem,@function
+v4_sm_Slashrem:
+.stabn 68,0,204,.LMa80-v4_sm_Slashrem
+.LMa80:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,204,.LMb80-v4_sm_Slashrem
+.LMb80:
+.LBB10:
+.stabn 68,0,205,.LM81-v4_sm_Slashrem
+.LM81:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L4
+	mov $-10,%rax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.L4:
+	pop %rbx
+	leave
+	jmp v4___Parensm_Slashrem_Closeparen@PLT
+.LBE10:
+.stabn 68,0,205,.LM93-v4_sm_Slashrem
+.LM93:
+	pop %rbx
+	leave
+	ret
+.Lfe10:
+	.size	 v4_sm_Slashrem,.Lfe10-v4_sm_Slashrem
+.stabn	192,0,0,.LBB10-v4_sm_Slashrem
+.stabn	224,0,0,.LBE10-v4_sm_Slashrem
+.Lscope10:
+.stabs	"",36,0,0,.Lscope10-v4_sm_Slashrem
+.text
+	.align 4
+.stabs "v4_Plus:F1",36,0,0,v4_Plus
+	.weak v4_Plus
+	.type	v4_Plus,@function
+v4_Plus:
+.stabn 68,0,207,.LMa94-v4_Plus
+.LMa94:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,207,.LMb94-v4_Plus
+.LMb94:
+.LBB11:
+.stabn 68,0,208,.LM95-v4_Plus
+.LM95:
+	call v4_um_Plus@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE11:
+.stabn 68,0,208,.LM98-v4_Plus
+.LM98:
+	pop %rbx
+	leave
+	ret
+.Lfe11:
+	.size	 v4_Plus,.Lfe11-v4_Plus
+.stabn	192,0,0,.LBB11-v4_Plus
+.stabn	224,0,0,.LBE11-v4_Plus
+.Lscope11:
+.stabs	"",36,0,0,.Lscope11-v4_Plus
+.text
+	.align 4
+.stabs "v4_fm_Slashmod:F1",36,0,0,v4_fm_Slashmod
+	.weak v4_fm_Slashmod
+	.type	v4_fm_Slashmod,@function
+v4_fm_Slashmod:
+.stabn 68,0,210,.LMa99-v4_fm_Slashmod
+.LMa99:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,210,.LMb99-v4_fm_Slashmod
+.LMb99:
+.LBB13:
+.stabn 68,0,211,.LM100-v4_fm_Slashmod
+.LM100:
+	call v4_z2dup@PLT
+	call v4_Greaterr@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,205,.LM104-v4_fm_Slashmod
+.LM104:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L19
+	mov $-10,%rax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.L19:
+	call v4___Parensm_Slashrem_Closeparen@PLT
+.stabn 68,0,211,.LM115-v4_fm_Slashmod
+.LM115:
+	call v4_over@PLT
+.stabn 68,0,212,.LM116-v4_fm_Slashmod
+.LM116:
+	call v4_r_Greater@PLT
+	call v4_r_Fetch@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	and %rdx,%rax
+	je .L7
+.stabn 68,0,213,.LM134-v4_fm_Slashmod
+.LM134:
+	call v4_z1_Minus@PLT
+	call v4_swap@PLT
+	call v4_r_Fetch@PLT
+.stabn 68,0,208,.LM138-v4_fm_Slashmod
+.LM138:
+	call v4_um_Plus@PLT
+	call v4_drop@PLT
+.stabn 68,0,213,.LM140-v4_fm_Slashmod
+.LM140:
+	call v4_swap@PLT
+.L7:
+	pop %rbx
+	leave
+	jmp v4_rdrop@PLT
+.LBE13:
+.stabn 68,0,214,.LM144-v4_fm_Slashmod
+.LM144:
+	pop %rbx
+	leave
+	ret
+.Lfe13:
+	.size	 v4_fm_Slashmod,.Lfe13-v4_fm_Slashmod
+.stabn	192,0,0,.LBB13-v4_fm_Slashmod
+.stabn	224,0,0,.LBE13-v4_fm_Slashmod
+.Lscope13:
+.stabs	"",36,0,0,.Lscope13-v4_fm_Slashmod
+.text
+	.align 4
+.stabs "v4_negate:F1",36,0,0,v4_negate
+	.weak v4_negate
+	.type	v4_negate,@function
+v4_negate:
+.stabn 68,0,216,.LMa145-v4_negate
+.LMa145:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,216,.LMb145-v4_negate
+.LMb145:
+.LBB24:
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_z1_Plus@PLT
+.LBE24:
+.stabn 68,0,217,.LM152-v4_negate
+.LM152:
+	pop %rbx
+	leave
+	ret
+.Lfe24:
+	.size	 v4_negate,.Lfe24-v4_negate
+.stabn	192,0,0,.LBB24-v4_negate
+.stabn	224,0,0,.LBE24-v4_negate
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4_negate
+.text
+	.align 4
+.stabs "v4_dnegate:F1",36,0,0,v4_dnegate
+	.weak v4_dnegate
+	.type	v4_dnegate,@function
+v4_dnegate:
+.stabn 68,0,219,.LMa153-v4_dnegate
+.LMa153:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,219,.LMb153-v4_dnegate
+.LMb153:
+.LBB26:
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_um_Plus@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,208,.LM168-v4_dnegate
+.LM168:
+	call v4_um_Plus@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE26:
+.stabn 68,0,220,.LM171-v4_dnegate
+.LM171:
+	pop %rbx
+	leave
+	ret
+.Lfe26:
+	.size	 v4_dnegate,.Lfe26-v4_dnegate
+.stabn	192,0,0,.LBB26-v4_dnegate
+.stabn	224,0,0,.LBE26-v4_dnegate
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4_dnegate
+.text
+	.align 4
+.stabs "v4_Minus:F1",36,0,0,v4_Minus
+	.weak v4_Minus
+	.type	v4_Minus,@function
+v4_Minus:
+.stabn 68,0,222,.LMa172-v4_Minus
+.LMa172:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,222,.LMb172-v4_Minus
+.LMb172:
+.LBB27:
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_z1_Plus@PLT
+.stabn 68,0,208,.LM180-v4_Minus
+.LM180:
+	call v4_um_Plus@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE27:
+.stabn 68,0,223,.LM183-v4_Minus
+.LM183:
+	pop %rbx
+	leave
+	ret
+.Lfe27:
+	.size	 v4_Minus,.Lfe27-v4_Minus
+.stabn	192,0,0,.LBB27-v4_Minus
+.stabn	224,0,0,.LBE27-v4_Minus
+.Lscope27:
+.stabs	"",36,0,0,.Lscope27-v4_Minus
+.text
+	.align 4
+.stabs "v4_abs:F1",36,0,0,v4_abs
+	.weak v4_abs
+	.type	v4_abs,@function
+v4_abs:
+.stabn 68,0,225,.LMa184-v4_abs
+.LMa184:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,225,.LMb184-v4_abs
+.LMb184:
+.LBB28:
+.stabn 68,0,226,.LM185-v4_abs
+.LM185:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jge .L12
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_z1_Plus@PLT
+.L12:
+.LBE28:
+.stabn 68,0,226,.LM199-v4_abs
+.LM199:
+	pop %rbx
+	leave
+	ret
+.Lfe28:
+	.size	 v4_abs,.Lfe28-v4_abs
+.stabn	192,0,0,.LBB28-v4_abs
+.stabn	224,0,0,.LBE28-v4_abs
+.Lscope28:
+.stabs	"",36,0,0,.Lscope28-v4_abs
+.text
+	.align 4
+.stabs "v4_m_Star:F1",36,0,0,v4_m_Star
+	.weak v4_m_Star
+	.type	v4_m_Star,@function
+v4_m_Star:
+.stabn 68,0,228,.LMa200-v4_m_Star
+.LMa200:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,228,.LMb200-v4_m_Star
+.LMb200:
+.LBB29:
+.stabn 68,0,229,.LM201-v4_m_Star
+.LM201:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,226,.LM213-v4_m_Star
+.LM213:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jge .L20
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_z1_Plus@PLT
+.L20:
+.stabn 68,0,229,.LM226-v4_m_Star
+.LM226:
+	call v4_swap@PLT
+.stabn 68,0,226,.LM228-v4_m_Star
+.LM228:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jge .L21
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_z1_Plus@PLT
+.L21:
+.stabn 68,0,229,.LM241-v4_m_Star
+.LM241:
+	call v4_um_Star@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L14
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_um_Plus@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,208,.LM260-v4_m_Star
+.LM260:
+	call v4_um_Plus@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.L14:
+.LBE29:
+.stabn 68,0,229,.LM264-v4_m_Star
+.LM264:
+	pop %rbx
+	leave
+	ret
+.Lfe29:
+	.size	 v4_m_Star,.Lfe29-v4_m_Star
+.stabn	192,0,0,.LBB29-v4_m_Star
+.stabn	224,0,0,.LBE29-v4_m_Star
+.Lscope29:
+.stabs	"",36,0,0,.Lscope29-v4_m_Star
+.text
+	.align 4
+.stabs "v4_Star:F1",36,0,0,v4_Star
+	.weak v4_Star
+	.type	v4_Star,@function
+v4_Star:
+.stabn 68,0,231,.LMa265-v4_Star
+.LMa265:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,231,.LMb265-v4_Star
+.LMb265:
+.LBB30:
+.stabn 68,0,232,.LM266-v4_Star
+.LM266:
+	call v4_um_Star@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE30:
+.stabn 68,0,232,.LM269-v4_Star
+.LM269:
+	pop %rbx
+	leave
+	ret
+.Lfe30:
+	.size	 v4_Star,.Lfe30-v4_Star
+.stabn	192,0,0,.LBB30-v4_Star
+.stabn	224,0,0,.LBE30-v4_Star
+.Lscope30:
+.stabs	"",36,0,0,.Lscope30-v4_Star
+.text
+	.align 4
+.stabs "v4_m_Slashmod:F1",36,0,0,v4_m_Slashmod
+	.weak v4_m_Slashmod
+	.type	v4_m_Slashmod,@function
+v4_m_Slashmod:
+.stabn 68,0,234,.LMa270-v4_m_Slashmod
+.LMa270:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,234,.LMb270-v4_m_Slashmod
+.LMb270:
+.LBB31:
+.stabn 68,0,205,.LM272-v4_m_Slashmod
+.LM272:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L22
+	mov $-10,%rax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.L22:
+	pop %rbx
+	leave
+	jmp v4___Parensm_Slashrem_Closeparen@PLT
+.LBE31:
+.stabn 68,0,235,.LM284-v4_m_Slashmod
+.LM284:
+	pop %rbx
+	leave
+	ret
+.Lfe31:
+	.size	 v4_m_Slashmod,.Lfe31-v4_m_Slashmod
+.stabn	192,0,0,.LBB31-v4_m_Slashmod
+.stabn	224,0,0,.LBE31-v4_m_Slashmod
+.Lscope31:
+.stabs	"",36,0,0,.Lscope31-v4_m_Slashmod
+.text
+	.align 4
+.stabs "v4_s_Greaterd:F1",36,0,0,v4_s_Greaterd
+	.weak v4_s_Greaterd
+	.type	v4_s_Greaterd,@function
+v4_s_Greaterd:
+.stabn 68,0,237,.LMa285-v4_s_Greaterd
+.LMa285:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,237,.LMb285-v4_s_Greaterd
+.LMb285:
+.LBB32:
+.stabn 68,0,238,.LM286-v4_s_Greaterd
+.LM286:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jle .L18
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L17
+.L18:
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_z1_Plus@PLT
+.stabn 68,0,238,.LM302-v4_s_Greaterd
+.LM302:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_um_Plus@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,208,.LM316-v4_s_Greaterd
+.LM316:
+	call v4_um_Plus@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.L17:
+.LBE32:
+.stabn 68,0,238,.LM319-v4_s_Greaterd
+.LM319:
+	pop %rbx
+	leave
+	ret
+.Lfe32:
+	.size	 v4_s_Greaterd,.Lfe32-v4_s_Greaterd
+.stabn	192,0,0,.LBB32-v4_s_Greaterd
+.stabn	224,0,0,.LBE32-v4_s_Greaterd
+.Lscope32:
+.stabs	"",36,0,0,.Lscope32-v4_s_Greaterd
+.text
+	.align 4
+.stabs "v4_d_Greaters:F1",36,0,0,v4_d_Greaters
+	.weak v4_d_Greaters
+	.type	v4_d_Greaters,@function
+v4_d_Greaters:
+.stabn 68,0,240,.LMa320-v4_d_Greaters
+.LMa320:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,240,.LMb320-v4_d_Greaters
+.LMb320:
+.LBB34:
+.stabn 68,0,241,.LM321-v4_d_Greaters
+.LM321:
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE34:
+.stabn 68,0,241,.LM323-v4_d_Greaters
+.LM323:
+	pop %rbx
+	leave
+	ret
+.Lfe34:
+	.size	 v4_d_Greaters,.Lfe34-v4_d_Greaters
+.stabn	192,0,0,.LBB34-v4_d_Greaters
+.stabn	224,0,0,.LBE34-v4_d_Greaters
+.Lscope34:
+.stabs	"",36,0,0,.Lscope34-v4_d_Greaters
+.text
+	.align 4
+.stabs "v4_Slashmod:F1",36,0,0,v4_Slashmod
+	.weak v4_Slashmod
+	.type	v4_Slashmod,@function
+v4_Slashmod:
+.stabn 68,0,243,.LMa324-v4_Slashmod
+.LMa324:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,243,.LMb324-v4_Slashmod
+.LMb324:
+.LBB35:
+.stabn 68,0,244,.LM325-v4_Slashmod
+.LM325:
+	call v4_Greaterr@PLT
+.stabn 68,0,238,.LM327-v4_Slashmod
+.LM327:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jle .L23
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L24
+.L23:
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_z1_Plus@PLT
+.stabn 68,0,238,.LM343-v4_Slashmod
+.LM343:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_um_Plus@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,208,.LM356-v4_Slashmod
+.LM356:
+	call v4_um_Plus@PLT
+	call v4_drop@PLT
+.L24:
+.stabn 68,0,244,.LM359-v4_Slashmod
+.LM359:
+	call v4_r_Greater@PLT
+.stabn 68,0,205,.LM362-v4_Slashmod
+.LM362:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L31
+	mov $-10,%rax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.L31:
+	pop %rbx
+	leave
+	jmp v4___Parensm_Slashrem_Closeparen@PLT
+.LBE35:
+.stabn 68,0,244,.LM374-v4_Slashmod
+.LM374:
+	pop %rbx
+	leave
+	ret
+.Lfe35:
+	.size	 v4_Slashmod,.Lfe35-v4_Slashmod
+.stabn	192,0,0,.LBB35-v4_Slashmod
+.stabn	224,0,0,.LBE35-v4_Slashmod
+.Lscope35:
+.stabs	"",36,0,0,.Lscope35-v4_Slashmod
+.text
+	.align 4
+.stabs "v4_mod:F1",36,0,0,v4_mod
+	.weak v4_mod
+	.type	v4_mod,@function
+v4_mod:
+.stabn 68,0,246,.LMa375-v4_mod
+.LMa375:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,246,.LMb375-v4_mod
+.LMb375:
+.LBB36:
+.stabn 68,0,247,.LM376-v4_mod
+.LM376:
+	call v4_Greaterr@PLT
+.stabn 68,0,238,.LM378-v4_mod
+.LM378:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jle .L25
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L26
+.L25:
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_z1_Plus@PLT
+.stabn 68,0,238,.LM394-v4_mod
+.LM394:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_um_Plus@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,208,.LM407-v4_mod
+.LM407:
+	call v4_um_Plus@PLT
+	call v4_drop@PLT
+.L26:
+.stabn 68,0,247,.LM410-v4_mod
+.LM410:
+	call v4_r_Greater@PLT
+.stabn 68,0,205,.LM413-v4_mod
+.LM413:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L32
+	mov $-10,%rax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.L32:
+	call v4___Parensm_Slashrem_Closeparen@PLT
+.stabn 68,0,247,.LM424-v4_mod
+.LM424:
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE36:
+.stabn 68,0,247,.LM426-v4_mod
+.LM426:
+	pop %rbx
+	leave
+	ret
+.Lfe36:
+	.size	 v4_mod,.Lfe36-v4_mod
+.stabn	192,0,0,.LBB36-v4_mod
+.stabn	224,0,0,.LBE36-v4_mod
+.Lscope36:
+.stabs	"",36,0,0,.Lscope36-v4_mod
+.text
+	.align 4
+.stabs "v4_Slash:F1",36,0,0,v4_Slash
+	.weak v4_Slash
+	.type	v4_Slash,@function
+v4_Slash:
+.stabn 68,0,249,.LMa427-v4_Slash
+.LMa427:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,249,.LMb427-v4_Slash
+.LMb427:
+.LBB37:
+.stabn 68,0,250,.LM428-v4_Slash
+.LM428:
+	call v4_Greaterr@PLT
+.stabn 68,0,238,.LM430-v4_Slash
+.LM430:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jle .L27
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L28
+.L27:
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_z1_Plus@PLT
+.stabn 68,0,238,.LM446-v4_Slash
+.LM446:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_um_Plus@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,208,.LM459-v4_Slash
+.LM459:
+	call v4_um_Plus@PLT
+	call v4_drop@PLT
+.L28:
+.stabn 68,0,250,.LM462-v4_Slash
+.LM462:
+	call v4_r_Greater@PLT
+.stabn 68,0,205,.LM465-v4_Slash
+.LM465:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L33
+	mov $-10,%rax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.L33:
+	call v4___Parensm_Slashrem_Closeparen@PLT
+.stabn 68,0,250,.LM476-v4_Slash
+.LM476:
+	call v4_swap@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE37:
+.stabn 68,0,250,.LM479-v4_Slash
+.LM479:
+	pop %rbx
+	leave
+	ret
+.Lfe37:
+	.size	 v4_Slash,.Lfe37-v4_Slash
+.stabn	192,0,0,.LBB37-v4_Slash
+.stabn	224,0,0,.LBE37-v4_Slash
+.Lscope37:
+.stabs	"",36,0,0,.Lscope37-v4_Slash
+.text
+	.align 4
+.stabs "v4_Star_Slashmod:F1",36,0,0,v4_Star_Slashmod
+	.weak v4_Star_Slashmod
+	.type	v4_Star_Slashmod,@function
+v4_Star_Slashmod:
+.stabn 68,0,252,.LMa480-v4_Star_Slashmod
+.LMa480:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,252,.LMb480-v4_Star_Slashmod
+.LMb480:
+.LBB38:
+.stabn 68,0,253,.LM481-v4_Star_Slashmod
+.LM481:
+	call v4_Greaterr@PLT
+.stabn 68,0,229,.LM483-v4_Star_Slashmod
+.LM483:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,226,.LM495-v4_Star_Slashmod
+.LM495:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jge .L34
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_z1_Plus@PLT
+.L34:
+.stabn 68,0,229,.LM507-v4_Star_Slashmod
+.LM507:
+	call v4_swap@PLT
+.stabn 68,0,226,.LM509-v4_Star_Slashmod
+.LM509:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jge .L35
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_z1_Plus@PLT
+.L35:
+.stabn 68,0,229,.LM521-v4_Star_Slashmod
+.LM521:
+	call v4_um_Star@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L29
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_um_Plus@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,208,.LM539-v4_Star_Slashmod
+.LM539:
+	call v4_um_Plus@PLT
+	call v4_drop@PLT
+.L29:
+.stabn 68,0,253,.LM542-v4_Star_Slashmod
+.LM542:
+	call v4_r_Greater@PLT
+.stabn 68,0,205,.LM545-v4_Star_Slashmod
+.LM545:
+	call v4_dup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L36
+	mov $-10,%rax
+	call v4__dpush@PLT
+	call v4_throw@PLT
+.L36:
+	pop %rbx
+	leave
+	jmp v4___Parensm_Slashrem_Closeparen@PLT
+.LBE38:
+.stabn 68,0,253,.LM557-v4_Star_Slashmod
+.LM557:
+	pop %rbx
+	leave
+	ret
+.Lfe38:
+	.size	 v4_Star_Slashmod,.Lfe38-v4_Star_Slashmod
+.stabn	192,0,0,.LBB38-v4_Star_Slashmod
+.stabn	224,0,0,.LBE38-v4_Star_Slashmod
+.Lscope38:
+.stabs	"",36,0,0,.Lscope38-v4_Star_Slashmod
+.text
+	.align 4
+.stabs "v4_Star_Slash:F1",36,0,0,v4_Star_Slash
+	.weak v4_Star_Slash
+	.type	v4_Star_Slash,@function
+v4_Star_Slash:
+.stabn 68,0,255,.LMa558-v4_Star_Slash
+.LMa558:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,255,.LMb558-v4_Star_Slash
+.LMb558:
+.LBB39:
+.stabn 68,0,256,.LM559-v4_Star_Slash
+.LM559:
+	call v4_Greaterr@PLT
+.stabn 68,0,229,.LM561-v4_Star_Slash
+.LM561:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xor %rdx,%rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4_abs@PLT
+	call v4_swap@PLT
+	call v4_abs@PLT
+	call v4_um_Star@PLT
+	call v4_r_Greater@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L30
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	call v4_Greaterr@PLT
+	call v4__dpop@PLT
+	not %rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4_um_Plus@PLT
+	call v4_r_Greater@PLT
+.stabn 68,0,208,.LM593-v4_Star_Slash
+.LM593:
+	call v4_um_Plus@PLT
+	call v4_drop@PLT
+.L30:
+.stabn 68,0,256,.LM596-v4_Star_Slash
+.LM596:
+	call v4_r_Greater@PLT
+.stabn 68,0,235,.LM598-v4_Star_Slash
+.LM598:
+	call v4_sm_Slashrem@PLT
+.stabn 68,0,256,.LM599-v4_Star_Slash
+.LM599:
+	call v4_swap@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE39:
+.stabn 68,0,256,.LM602-v4_Star_Slash
+.LM602:
+	pop %rbx
+	leave
+	ret
+.Lfe39:
+	.size	 v4_Star_Slash,.Lfe39-v4_Star_Slash
+.stabn	192,0,0,.LBB39-v4_Star_Slash
+.stabn	224,0,0,.LBE39-v4_Star_Slash
+.Lscope39:
+.stabs	"",36,0,0,.Lscope39-v4_Star_Slash
+.text
+	.align 4
+.stabs "v4_z2_Star:F1",36,0,0,v4_z2_Star
+	.weak v4_z2_Star
+	.type	v4_z2_Star,@function
+v4_z2_Star:
+.stabn 68,0,258,.LMa603-v4_z2_Star
+.LMa603:
+0:
+.stabn 68,0,258,.LMb603-v4_z2_Star
+.LMb603:
+.LBB40:
+.stabn 68,0,259,.LM604-v4_z2_Star
+.LM604:
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xchg %rdx,%rcx
+	shl %cl,%rax
+	xchg %rdx,%rcx
+	call v4__dpush@PLT
+.LBE40:
+.stabn 68,0,259,.LM612-v4_z2_Star
+.LM612:
+	ret
+.Lfe40:
+	.size	 v4_z2_Star,.Lfe40-v4_z2_Star
+.stabn	192,0,0,.LBB40-v4_z2_Star
+.stabn	224,0,0,.LBE40-v4_z2_Star
+.Lscope40:
+.stabs	"",36,0,0,.Lscope40-v4_z2_Star
+.text
+	.align 4
+.stabs "v4_z2_Slash:F1",36,0,0,v4_z2_Slash
+	.weak v4_z2_Slash
+	.type	v4_z2_Slash,@function
+v4_z2_Slash:
+.stabn 68,0,261,.LMa613-v4_z2_Slash
+.LMa613:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,261,.LMb613-v4_z2_Slash
+.LMb613:
+.LBB42:
+.stabn 68,0,262,.LM614-v4_z2_Slash
+.LM614:
+	call v4_dup@PLT
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	and %rdx,%rax
+	call v4__dpush@PLT
+.stabn 68,0,263,.LM627-v4_z2_Slash
+.LM627:
+	call v4_swap@PLT
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	xchg %rdx,%rcx
+	shr %cl,%rax
+	xchg %rdx,%rcx
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	or %rdx,%rax
+	call v4__dpush@PLT
+.LBE42:
+.stabn 68,0,263,.LM641-v4_z2_Slash
+.LM641:
+	pop %rbx
+	leave
+	ret
+.Lfe42:
+	.size	 v4_z2_Slash,.Lfe42-v4_z2_Slash
+.stabn	192,0,0,.LBB42-v4_z2_Slash
+.stabn	224,0,0,.LBE42-v4_z2_Slash
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4_z2_Slash
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"
@@ -0,0 +1,2560 @@
+	.file	"perror.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"perror.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC125:
+	.string ""
+.LC80:
+	.string ".lib section in a.out corrupted"
+.LC126:
+.LC128:
+	.string ": "
+.LC79:
+	.string "Accessing a corrupted shared library"
+.LC97:
+	.string "Address already in use"
+.LC96:
+	.string "Address family not supported by protocol"
+.LC67:
+	.string "Advertise error"
+.LC6:
+	.string "Arg list too long"
+.LC81:
+	.string "Attempting to link in too many shared libs"
+.LC13:
+	.string "Bad address"
+.LC8:
+	.string "Bad file number"
+.LC58:
+	.string "Bad font file format"
+.LC14:
+	.string "Block device required"
+.LC31:
+	.string "Broken pipe"
+.LC78:
+	.string "Can not access a needed shared library"
+.LC98:
+	.string "Cannot assign requested address"
+.LC82:
+	.string "Cannot exec a shared library directly"
+.LC107:
+	.string "Cannot send after transport endpoint shtdn"
+.LC43:
+	.string "Channel number out of range"
+.LC69:
+	.string "Communication error on send"
+.LC110:
+	.string "Connection refused"
+.LC103:
+	.string "Connection reset by peer"
+.LC109:
+	.string "Connection timed out"
+.LC17:
+	.string "Cross-device link"
+.LC88:
+	.string "Destination address required"
+.LC59:
+	.string "Device not a stream"
+.LC15:
+	.string "Device or resource busy"
+.LC38:
+	.string "Directory not empty"
+.LC53:
+	.string "Exchange full"
+.LC7:
+	.string "Exec format error"
+.LC76:
+	.string "File descriptor in bad state"
+.LC16:
+	.string "File exists"
+.LC35:
+	.string "File name too long"
+.LC22:
+	.string "File table overflow"
+.LC26:
+	.string "File too large"
+.LC37:
+	.string "Function not implemented"
+.LC111:
+	.string "Host is down"
+.LC4:
+	.string "I/O error"
+.LC42:
+	.string "Identifier removed"
+.LC83:
+	.string "Illegal byte sequence"
+.LC28:
+	.string "Illegal seek"
+.LC84:
+	.string "Interrupted sys call should be restarted"
+.LC3:
+	.string "Interrupted system call"
+.LC21:
+	.string "Invalid argument"
+.LC51:
+	.string "Invalid exchange"
+.LC55:
+	.string "Invalid request code"
+.LC52:
+	.string "Invalid request descriptor"
+.LC56:
+	.string "Invalid slot"
+.LC20:
+	.string "Is a directory"
+.LC119:
+	.string "Is a named type file"
+.LC50:
+	.string "Level 2 halted"
+.LC44:
+	.string "Level 2 not synchronized"
+.LC45:
+	.string "Level 3 halted"
+.LC46:
+	.string "Level 3 reset"
+.LC66:
+	.string "Link has been severed"
+.LC47:
+	.string "Link number out of range"
+.LC63:
+	.string "Machine is not on the network"
+.LC32:
+	.string "Math argument out of domain of func"
+.LC33:
+	.string "Math result not representable"
+.LC89:
+	.string "Message too long"
+.LC71:
+	.string "Multihop attempted"
+.LC75:
+	.string "Name not unique on network"
+.LC101:
+	.string "Network dropped connection because of reset"
+.LC99:
+	.string "Network is down"
+.LC100:
+	.string "Network is unreachable"
+.LC49:
+	.string "No CSI structure available"
+.LC118:
+	.string "No XENIX semaphores available"
+.LC54:
+	.string "No anode"
+.LC104:
+	.string "No buffer space available"
+.LC9:
+	.string "No child processes"
+.LC60:
+	.string "No data available"
+.LC122:
+	.string "No medium found"
+.LC41:
+	.string "No message of desired type"
+.LC36:
+	.string "No record locks available"
+.LC112:
+	.string "No route to host"
+.LC27:
+	.string "No space left on device"
+.LC18:
+	.string "No such device"
+.LC5:
+	.string "No such device or address"
+.LC1:
+	.string "No such file or directory"
+.LC2:
+	.string "No such process"
+.LC117:
+	.string "Not a XENIX named type file"
+.LC73:
+	.string "Not a data message"
+.LC19:
+	.string "Not a directory"
+.LC24:
+	.string "Not a typewriter"
+.LC65:
+	.string "Object is remote"
+.LC113:
+	.string "Operation already in progress"
+.LC0:
+	.string "Operation not permitted"
+.LC94:
+	.string "Operation not supported on transport endpt"
+.LC114:
+	.string "Operation now in progress"
+.LC40:
+	.string "Operation would block"
+.LC11:
+	.string "Out of memory"
+.LC62:
+	.string "Out of streams resources"
+.LC64:
+	.string "Package not installed"
+.LC12:
+	.string "Permission denied"
+.LC48:
+	.string "Protocol driver not attached"
+.LC70:
+	.string "Protocol error"
+.LC95:
+	.string "Protocol family not supported"
+.LC91:
+	.string "Protocol not available"
+.LC92:
+	.string "Protocol not supported"
+.LC90:
+	.string "Protocol wrong type for socket"
+.LC121:
+	.string "Quota exceeded"
+.LC72:
+	.string "RFS specific error"
+.LC29:
+	.string "Read-only file system"
+.LC120:
+	.string "Remote I/O error"
+.LC77:
+	.string "Remote address changed"
+.LC57:
+	.string "Resource deadlck would occur"
+.LC34:
+	.string "Resource deadlock would occur"
+.LC87:
+	.string "Socket operation on non-socket"
+.LC93:
+	.string "Socket type not supported"
+.LC102:
+	.string "Software caused connection abort"
+.LC68:
+	.string "Srmount error"
+.LC115:
+	.string "Stale NFS file handle"
+.LC85:
+	.string "Streams pipe error"
+.LC116:
+	.string "Structure needs cleaning"
+.LC124:
+	.string "Success"
+.LC127:
+	.string "System error code "
+.LC25:
+	.string "Text file busy"
+.LC61:
+	.string "Timer expired"
+.LC30:
+	.string "Too many links"
+.LC23:
+	.string "Too many open files"
+.LC108:
+	.string "Too many references: cannot splice"
+.LC39:
+	.string "Too many symbolic links encountered"
+.LC86:
+	.string "Too many users"
+.LC105:
+	.string "Transport endpoint is already connected"
+.LC106:
+	.string "Transport endpoint is not connected"
+.LC10:
+	.string "Try again"
+.LC74:
+	.string "Value too large for defined data type"
+.LC123:
+	.string "Wrong medium type"
+.text
+	.align 4
+.stabs "v4_strerror:F1",36,0,0,v4_strerror
+	.weak v4_strerror
+	.type	v4_strerror,@function
+v4_strerror:
+.stabn 68,0,23,.LMa0-v4_strerror
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,23,.LMb0-v4_strerror
+.LMb0:
+.LBB0:
+.stabn 68,0,25,.LM1-v4_strerror
+.LM1:
+	call v4__eperm@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L3
+	lea .LC0(%rip),%rax
+	call v4__dpush@PLT
+	mov $23,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L3:
+.stabn 68,0,26,.LM14-v4_strerror
+.LM14:
+	call v4__enoent@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L4
+	lea .LC1(%rip),%rax
+	call v4__dpush@PLT
+	mov $25,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L4:
+.stabn 68,0,27,.LM27-v4_strerror
+.LM27:
+	call v4__esrch@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L5
+	lea .LC2(%rip),%rax
+	call v4__dpush@PLT
+	mov $15,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L5:
+.stabn 68,0,28,.LM40-v4_strerror
+.LM40:
+	call v4__eintr@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L6
+	lea .LC3(%rip),%rax
+	call v4__dpush@PLT
+	mov $23,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L6:
+.stabn 68,0,29,.LM53-v4_strerror
+.LM53:
+	call v4__eio@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L7
+	lea .LC4(%rip),%rax
+	call v4__dpush@PLT
+	mov $9,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L7:
+.stabn 68,0,30,.LM66-v4_strerror
+.LM66:
+	call v4__enxio@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L8
+	lea .LC5(%rip),%rax
+	call v4__dpush@PLT
+	mov $25,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L8:
+.stabn 68,0,31,.LM79-v4_strerror
+.LM79:
+	call v4__e2big@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L9
+	lea .LC6(%rip),%rax
+	call v4__dpush@PLT
+	mov $17,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L9:
+.stabn 68,0,32,.LM92-v4_strerror
+.LM92:
+	call v4__enoexec@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L10
+	lea .LC7(%rip),%rax
+	call v4__dpush@PLT
+	mov $17,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L10:
+.stabn 68,0,33,.LM105-v4_strerror
+.LM105:
+	call v4__ebadf@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L11
+	lea .LC8(%rip),%rax
+	call v4__dpush@PLT
+	mov $15,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L11:
+.stabn 68,0,34,.LM118-v4_strerror
+.LM118:
+	call v4__echild@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L12
+	lea .LC9(%rip),%rax
+	call v4__dpush@PLT
+	mov $18,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L12:
+.stabn 68,0,35,.LM131-v4_strerror
+.LM131:
+	call v4__eagain@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L13
+	lea .LC10(%rip),%rax
+	call v4__dpush@PLT
+	mov $9,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L13:
+.stabn 68,0,36,.LM144-v4_strerror
+.LM144:
+	call v4__enomem@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L14
+	lea .LC11(%rip),%rax
+	call v4__dpush@PLT
+	mov $13,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L14:
+.stabn 68,0,37,.LM157-v4_strerror
+.LM157:
+	call v4__eacces@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L15
+	lea .LC12(%rip),%rax
+	call v4__dpush@PLT
+	mov $17,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L15:
+.stabn 68,0,38,.LM170-v4_strerror
+.LM170:
+	call v4__efault@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L16
+	lea .LC13(%rip),%rax
+	call v4__dpush@PLT
+	mov $11,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L16:
+.stabn 68,0,39,.LM183-v4_strerror
+.LM183:
+	call v4__enotblk@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L17
+	lea .LC14(%rip),%rax
+	call v4__dpush@PLT
+	mov $21,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L17:
+.stabn 68,0,40,.LM196-v4_strerror
+.LM196:
+	call v4__ebusy@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L18
+	lea .LC15(%rip),%rax
+	call v4__dpush@PLT
+	mov $23,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L18:
+.stabn 68,0,41,.LM209-v4_strerror
+.LM209:
+	call v4__eexist@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L19
+	lea .LC16(%rip),%rax
+	call v4__dpush@PLT
+	mov $11,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L19:
+.stabn 68,0,42,.LM222-v4_strerror
+.LM222:
+	call v4__exdev@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L20
+	lea .LC17(%rip),%rax
+	call v4__dpush@PLT
+	mov $17,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L20:
+.stabn 68,0,43,.LM235-v4_strerror
+.LM235:
+	call v4__enodev@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L21
+	lea .LC18(%rip),%rax
+	call v4__dpush@PLT
+	mov $14,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L21:
+.stabn 68,0,44,.LM248-v4_strerror
+.LM248:
+	call v4__enotdir@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L22
+	lea .LC19(%rip),%rax
+	call v4__dpush@PLT
+	mov $15,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L22:
+.stabn 68,0,45,.LM261-v4_strerror
+.LM261:
+	call v4__eisdir@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L23
+	lea .LC20(%rip),%rax
+	call v4__dpush@PLT
+	mov $14,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L23:
+.stabn 68,0,46,.LM274-v4_strerror
+.LM274:
+	call v4__einval@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L24
+	lea .LC21(%rip),%rax
+	call v4__dpush@PLT
+	mov $16,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L24:
+.stabn 68,0,47,.LM287-v4_strerror
+.LM287:
+	call v4__enfile@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L25
+	lea .LC22(%rip),%rax
+	call v4__dpush@PLT
+	mov $19,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L25:
+.stabn 68,0,48,.LM300-v4_strerror
+.LM300:
+	call v4__emfile@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L26
+	lea .LC23(%rip),%rax
+	call v4__dpush@PLT
+	mov $19,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L26:
+.stabn 68,0,49,.LM313-v4_strerror
+.LM313:
+	call v4__enotty@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L27
+	lea .LC24(%rip),%rax
+	call v4__dpush@PLT
+	mov $16,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L27:
+.stabn 68,0,50,.LM326-v4_strerror
+.LM326:
+	call v4__etxtbsy@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L28
+	lea .LC25(%rip),%rax
+	call v4__dpush@PLT
+	mov $14,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L28:
+.stabn 68,0,51,.LM339-v4_strerror
+.LM339:
+	call v4__efbig@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L29
+	lea .LC26(%rip),%rax
+	call v4__dpush@PLT
+	mov $14,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L29:
+.stabn 68,0,52,.LM352-v4_strerror
+.LM352:
+	call v4__enospc@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L30
+	lea .LC27(%rip),%rax
+	call v4__dpush@PLT
+	mov $23,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L30:
+.stabn 68,0,53,.LM365-v4_strerror
+.LM365:
+	call v4__espipe@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L31
+	lea .LC28(%rip),%rax
+	call v4__dpush@PLT
+	mov $12,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L31:
+.stabn 68,0,54,.LM378-v4_strerror
+.LM378:
+	call v4__erofs@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L32
+	lea .LC29(%rip),%rax
+	call v4__dpush@PLT
+	mov $21,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L32:
+.stabn 68,0,55,.LM391-v4_strerror
+.LM391:
+	call v4__emlink@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L33
+	lea .LC30(%rip),%rax
+	call v4__dpush@PLT
+	mov $14,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L33:
+.stabn 68,0,56,.LM404-v4_strerror
+.LM404:
+	call v4__epipe@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L34
+	lea .LC31(%rip),%rax
+	call v4__dpush@PLT
+	mov $11,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L34:
+.stabn 68,0,57,.LM417-v4_strerror
+.LM417:
+	call v4__edom@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L35
+	lea .LC32(%rip),%rax
+	call v4__dpush@PLT
+	mov $35,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L35:
+.stabn 68,0,58,.LM430-v4_strerror
+.LM430:
+	call v4__erange@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L36
+	lea .LC33(%rip),%rax
+	call v4__dpush@PLT
+	mov $29,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L36:
+.stabn 68,0,59,.LM443-v4_strerror
+.LM443:
+	call v4__edeadlk@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L37
+	lea .LC34(%rip),%rax
+	call v4__dpush@PLT
+	mov $29,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L37:
+.stabn 68,0,60,.LM456-v4_strerror
+.LM456:
+	call v4__enametoolong@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L38
+	lea .LC35(%rip),%rax
+	call v4__dpush@PLT
+	mov $18,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L38:
+.stabn 68,0,61,.LM469-v4_strerror
+.LM469:
+	call v4__enolck@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L39
+	lea .LC36(%rip),%rax
+	call v4__dpush@PLT
+	mov $25,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L39:
+.stabn 68,0,62,.LM482-v4_strerror
+.LM482:
+	call v4__enosys@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L40
+	lea .LC37(%rip),%rax
+	call v4__dpush@PLT
+	mov $24,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L40:
+.stabn 68,0,63,.LM495-v4_strerror
+.LM495:
+	call v4__enotempty@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L41
+	lea .LC38(%rip),%rax
+	call v4__dpush@PLT
+	mov $19,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L41:
+.stabn 68,0,64,.LM508-v4_strerror
+.LM508:
+	call v4__eloop@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L42
+	lea .LC39(%rip),%rax
+	call v4__dpush@PLT
+	mov $35,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L42:
+.stabn 68,0,65,.LM521-v4_strerror
+.LM521:
+	call v4__ewouldblock@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L43
+	lea .LC40(%rip),%rax
+	call v4__dpush@PLT
+	mov $21,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L43:
+.stabn 68,0,66,.LM534-v4_strerror
+.LM534:
+	call v4__enomsg@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L44
+	lea .LC41(%rip),%rax
+	call v4__dpush@PLT
+	mov $26,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L44:
+.stabn 68,0,67,.LM547-v4_strerror
+.LM547:
+	call v4__eidrm@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L45
+	lea .LC42(%rip),%rax
+	call v4__dpush@PLT
+	mov $18,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L45:
+.stabn 68,0,68,.LM560-v4_strerror
+.LM560:
+	call v4__echrng@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L46
+	lea .LC43(%rip),%rax
+	call v4__dpush@PLT
+	mov $27,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L46:
+.stabn 68,0,69,.LM573-v4_strerror
+.LM573:
+	call v4__el2nsync@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L47
+	lea .LC44(%rip),%rax
+	call v4__dpush@PLT
+	mov $24,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L47:
+.stabn 68,0,70,.LM586-v4_strerror
+.LM586:
+	call v4__el3hlt@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L48
+	lea .LC45(%rip),%rax
+	call v4__dpush@PLT
+	mov $14,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L48:
+.stabn 68,0,71,.LM599-v4_strerror
+.LM599:
+	call v4__el3rst@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L49
+	lea .LC46(%rip),%rax
+	call v4__dpush@PLT
+	mov $13,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L49:
+.stabn 68,0,72,.LM612-v4_strerror
+.LM612:
+	call v4__elnrng@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L50
+	lea .LC47(%rip),%rax
+	call v4__dpush@PLT
+	mov $24,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L50:
+.stabn 68,0,73,.LM625-v4_strerror
+.LM625:
+	call v4__eunatch@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L51
+	lea .LC48(%rip),%rax
+	call v4__dpush@PLT
+	mov $28,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L51:
+.stabn 68,0,74,.LM638-v4_strerror
+.LM638:
+	call v4__enocsi@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L52
+	lea .LC49(%rip),%rax
+	call v4__dpush@PLT
+	mov $26,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L52:
+.stabn 68,0,75,.LM651-v4_strerror
+.LM651:
+	call v4__el2hlt@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L53
+	lea .LC50(%rip),%rax
+	call v4__dpush@PLT
+	mov $14,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L53:
+.stabn 68,0,76,.LM664-v4_strerror
+.LM664:
+	call v4__ebade@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L54
+	lea .LC51(%rip),%rax
+	call v4__dpush@PLT
+	mov $16,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L54:
+.stabn 68,0,77,.LM677-v4_strerror
+.LM677:
+	call v4__ebadr@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L55
+	lea .LC52(%rip),%rax
+	call v4__dpush@PLT
+	mov $26,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L55:
+.stabn 68,0,78,.LM690-v4_strerror
+.LM690:
+	call v4__exfull@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L56
+	lea .LC53(%rip),%rax
+	call v4__dpush@PLT
+	mov $13,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L56:
+.stabn 68,0,79,.LM703-v4_strerror
+.LM703:
+	call v4__enoano@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L57
+	lea .LC54(%rip),%rax
+	call v4__dpush@PLT
+	mov $8,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L57:
+.stabn 68,0,80,.LM716-v4_strerror
+.LM716:
+	call v4__ebadrqc@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L58
+	lea .LC55(%rip),%rax
+	call v4__dpush@PLT
+	mov $20,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L58:
+.stabn 68,0,81,.LM729-v4_strerror
+.LM729:
+	call v4__ebadslt@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L59
+	lea .LC56(%rip),%rax
+	call v4__dpush@PLT
+	mov $12,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L59:
+.stabn 68,0,82,.LM742-v4_strerror
+.LM742:
+	call v4__edeadlock@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L60
+	lea .LC57(%rip),%rax
+	call v4__dpush@PLT
+	mov $28,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L60:
+.stabn 68,0,83,.LM755-v4_strerror
+.LM755:
+	call v4__ebfont@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L61
+	lea .LC58(%rip),%rax
+	call v4__dpush@PLT
+	mov $20,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L61:
+.stabn 68,0,84,.LM768-v4_strerror
+.LM768:
+	call v4__enostr@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L62
+	lea .LC59(%rip),%rax
+	call v4__dpush@PLT
+	mov $19,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L62:
+.stabn 68,0,85,.LM781-v4_strerror
+.LM781:
+	call v4__enodata@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L63
+	lea .LC60(%rip),%rax
+	call v4__dpush@PLT
+	mov $17,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L63:
+.stabn 68,0,86,.LM794-v4_strerror
+.LM794:
+	call v4__etime@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L64
+	lea .LC61(%rip),%rax
+	call v4__dpush@PLT
+	mov $13,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L64:
+.stabn 68,0,87,.LM807-v4_strerror
+.LM807:
+	call v4__enosr@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L65
+	lea .LC62(%rip),%rax
+	call v4__dpush@PLT
+	mov $24,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L65:
+.stabn 68,0,88,.LM820-v4_strerror
+.LM820:
+	call v4__enonet@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L66
+	lea .LC63(%rip),%rax
+	call v4__dpush@PLT
+	mov $29,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L66:
+.stabn 68,0,89,.LM833-v4_strerror
+.LM833:
+	call v4__enopkg@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L67
+	lea .LC64(%rip),%rax
+	call v4__dpush@PLT
+	mov $21,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L67:
+.stabn 68,0,90,.LM846-v4_strerror
+.LM846:
+	call v4__eremote@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L68
+	lea .LC65(%rip),%rax
+	call v4__dpush@PLT
+	mov $16,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L68:
+.stabn 68,0,91,.LM859-v4_strerror
+.LM859:
+	call v4__enolink@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L69
+	lea .LC66(%rip),%rax
+	call v4__dpush@PLT
+	mov $21,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L69:
+.stabn 68,0,92,.LM872-v4_strerror
+.LM872:
+	call v4__eadv@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L70
+	lea .LC67(%rip),%rax
+	call v4__dpush@PLT
+	mov $15,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L70:
+.stabn 68,0,93,.LM885-v4_strerror
+.LM885:
+	call v4__esrmnt@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L71
+	lea .LC68(%rip),%rax
+	call v4__dpush@PLT
+	mov $13,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L71:
+.stabn 68,0,94,.LM898-v4_strerror
+.LM898:
+	call v4__ecomm@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L72
+	lea .LC69(%rip),%rax
+	call v4__dpush@PLT
+	mov $27,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L72:
+.stabn 68,0,95,.LM911-v4_strerror
+.LM911:
+	call v4__eproto@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L73
+	lea .LC70(%rip),%rax
+	call v4__dpush@PLT
+	mov $14,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L73:
+.stabn 68,0,96,.LM924-v4_strerror
+.LM924:
+	call v4__emultihop@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L74
+	lea .LC71(%rip),%rax
+	call v4__dpush@PLT
+	mov $18,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L74:
+.stabn 68,0,97,.LM937-v4_strerror
+.LM937:
+	call v4__edotdot@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L75
+	lea .LC72(%rip),%rax
+	call v4__dpush@PLT
+	mov $18,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L75:
+.stabn 68,0,98,.LM950-v4_strerror
+.LM950:
+	call v4__ebadmsg@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L76
+	lea .LC73(%rip),%rax
+	call v4__dpush@PLT
+	mov $18,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L76:
+.stabn 68,0,99,.LM963-v4_strerror
+.LM963:
+	call v4__eoverflow@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L77
+	lea .LC74(%rip),%rax
+	call v4__dpush@PLT
+	mov $37,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L77:
+.stabn 68,0,100,.LM976-v4_strerror
+.LM976:
+	call v4__enotuniq@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L78
+	lea .LC75(%rip),%rax
+	call v4__dpush@PLT
+	mov $26,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L78:
+.stabn 68,0,101,.LM989-v4_strerror
+.LM989:
+	call v4__ebadfd@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L79
+	lea .LC76(%rip),%rax
+	call v4__dpush@PLT
+	mov $28,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L79:
+.stabn 68,0,102,.LM1002-v4_strerror
+.LM1002:
+	call v4__eremchg@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L80
+	lea .LC77(%rip),%rax
+	call v4__dpush@PLT
+	mov $22,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L80:
+.stabn 68,0,103,.LM1015-v4_strerror
+.LM1015:
+	call v4__elibacc@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L81
+	lea .LC78(%rip),%rax
+	call v4__dpush@PLT
+	mov $38,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L81:
+.stabn 68,0,104,.LM1028-v4_strerror
+.LM1028:
+	call v4__elibbad@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L82
+	lea .LC79(%rip),%rax
+	call v4__dpush@PLT
+	mov $36,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L82:
+.stabn 68,0,105,.LM1041-v4_strerror
+.LM1041:
+	call v4__elibscn@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L83
+	lea .LC80(%rip),%rax
+	call v4__dpush@PLT
+	mov $31,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L83:
+.stabn 68,0,106,.LM1054-v4_strerror
+.LM1054:
+	call v4__elibmax@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L84
+	lea .LC81(%rip),%rax
+	call v4__dpush@PLT
+	mov $42,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L84:
+.stabn 68,0,107,.LM1067-v4_strerror
+.LM1067:
+	call v4__elibexec@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L85
+	lea .LC82(%rip),%rax
+	call v4__dpush@PLT
+	mov $37,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L85:
+.stabn 68,0,108,.LM1080-v4_strerror
+.LM1080:
+	call v4__eilseq@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L86
+	lea .LC83(%rip),%rax
+	call v4__dpush@PLT
+	mov $21,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L86:
+.stabn 68,0,109,.LM1093-v4_strerror
+.LM1093:
+	call v4__erestart@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L87
+	lea .LC84(%rip),%rax
+	call v4__dpush@PLT
+	mov $40,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L87:
+.stabn 68,0,110,.LM1106-v4_strerror
+.LM1106:
+	call v4__estrpipe@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L88
+	lea .LC85(%rip),%rax
+	call v4__dpush@PLT
+	mov $18,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L88:
+.stabn 68,0,111,.LM1119-v4_strerror
+.LM1119:
+	call v4__eusers@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L89
+	lea .LC86(%rip),%rax
+	call v4__dpush@PLT
+	mov $14,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L89:
+.stabn 68,0,112,.LM1132-v4_strerror
+.LM1132:
+	call v4__enotsock@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L90
+	lea .LC87(%rip),%rax
+	call v4__dpush@PLT
+	mov $30,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L90:
+.stabn 68,0,113,.LM1145-v4_strerror
+.LM1145:
+	call v4__edestaddrreq@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L91
+	lea .LC88(%rip),%rax
+	call v4__dpush@PLT
+	mov $28,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L91:
+.stabn 68,0,114,.LM1158-v4_strerror
+.LM1158:
+	call v4__emsgsize@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L92
+	lea .LC89(%rip),%rax
+	call v4__dpush@PLT
+	mov $16,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L92:
+.stabn 68,0,115,.LM1171-v4_strerror
+.LM1171:
+	call v4__eprototype@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L93
+	lea .LC90(%rip),%rax
+	call v4__dpush@PLT
+	mov $30,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L93:
+.stabn 68,0,116,.LM1184-v4_strerror
+.LM1184:
+	call v4__enoprotoopt@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L94
+	lea .LC91(%rip),%rax
+	call v4__dpush@PLT
+	mov $22,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L94:
+.stabn 68,0,117,.LM1197-v4_strerror
+.LM1197:
+	call v4__eprotonosupport@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L95
+	lea .LC92(%rip),%rax
+	call v4__dpush@PLT
+	mov $22,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L95:
+.stabn 68,0,118,.LM1210-v4_strerror
+.LM1210:
+	call v4__esocktnosupport@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L96
+	lea .LC93(%rip),%rax
+	call v4__dpush@PLT
+	mov $25,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L96:
+.stabn 68,0,119,.LM1223-v4_strerror
+.LM1223:
+	call v4__eopnotsupp@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L97
+	lea .LC94(%rip),%rax
+	call v4__dpush@PLT
+	mov $42,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L97:
+.stabn 68,0,120,.LM1236-v4_strerror
+.LM1236:
+	call v4__epfnosupport@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L98
+	lea .LC95(%rip),%rax
+	call v4__dpush@PLT
+	mov $29,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L98:
+.stabn 68,0,121,.LM1249-v4_strerror
+.LM1249:
+	call v4__eafnosupport@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L99
+	lea .LC96(%rip),%rax
+	call v4__dpush@PLT
+	mov $40,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L99:
+.stabn 68,0,122,.LM1262-v4_strerror
+.LM1262:
+	call v4__eaddrinuse@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L100
+	lea .LC97(%rip),%rax
+	call v4__dpush@PLT
+	mov $22,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L100:
+.stabn 68,0,123,.LM1275-v4_strerror
+.LM1275:
+	call v4__eaddrnotavail@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L101
+	lea .LC98(%rip),%rax
+	call v4__dpush@PLT
+	mov $31,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L101:
+.stabn 68,0,124,.LM1288-v4_strerror
+.LM1288:
+	call v4__enetdown@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L102
+	lea .LC99(%rip),%rax
+	call v4__dpush@PLT
+	mov $15,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L102:
+.stabn 68,0,125,.LM1301-v4_strerror
+.LM1301:
+	call v4__enetunreach@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L103
+	lea .LC100(%rip),%rax
+	call v4__dpush@PLT
+	mov $22,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L103:
+.stabn 68,0,126,.LM1314-v4_strerror
+.LM1314:
+	call v4__enetreset@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L104
+	lea .LC101(%rip),%rax
+	call v4__dpush@PLT
+	mov $43,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L104:
+.stabn 68,0,127,.LM1327-v4_strerror
+.LM1327:
+	call v4__econnaborted@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L105
+	lea .LC102(%rip),%rax
+	call v4__dpush@PLT
+	mov $32,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L105:
+.stabn 68,0,128,.LM1340-v4_strerror
+.LM1340:
+	call v4__econnreset@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L106
+	lea .LC103(%rip),%rax
+	call v4__dpush@PLT
+	mov $24,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L106:
+.stabn 68,0,129,.LM1353-v4_strerror
+.LM1353:
+	call v4__enobufs@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L107
+	lea .LC104(%rip),%rax
+	call v4__dpush@PLT
+	mov $25,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L107:
+.stabn 68,0,130,.LM1366-v4_strerror
+.LM1366:
+	call v4__eisconn@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L108
+	lea .LC105(%rip),%rax
+	call v4__dpush@PLT
+	mov $39,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L108:
+.stabn 68,0,131,.LM1379-v4_strerror
+.LM1379:
+	call v4__enotconn@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L109
+	lea .LC106(%rip),%rax
+	call v4__dpush@PLT
+	mov $35,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L109:
+.stabn 68,0,132,.LM1392-v4_strerror
+.LM1392:
+	call v4__eshutdown@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L110
+	lea .LC107(%rip),%rax
+	call v4__dpush@PLT
+	mov $42,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L110:
+.stabn 68,0,133,.LM1405-v4_strerror
+.LM1405:
+	call v4__etoomanyrefs@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L111
+	lea .LC108(%rip),%rax
+	call v4__dpush@PLT
+	mov $34,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L111:
+.stabn 68,0,134,.LM1418-v4_strerror
+.LM1418:
+	call v4__etimedout@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L112
+	lea .LC109(%rip),%rax
+	call v4__dpush@PLT
+	mov $20,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L112:
+.stabn 68,0,135,.LM1431-v4_strerror
+.LM1431:
+	call v4__econnrefused@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L113
+	lea .LC110(%rip),%rax
+	call v4__dpush@PLT
+	mov $18,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L113:
+.stabn 68,0,136,.LM1444-v4_strerror
+.LM1444:
+	call v4__ehostdown@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L114
+	lea .LC111(%rip),%rax
+	call v4__dpush@PLT
+	mov $12,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L114:
+.stabn 68,0,137,.LM1457-v4_strerror
+.LM1457:
+	call v4__ehostunreach@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L115
+	lea .LC112(%rip),%rax
+	call v4__dpush@PLT
+	mov $16,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L115:
+.stabn 68,0,138,.LM1470-v4_strerror
+.LM1470:
+	call v4__ealready@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L116
+	lea .LC113(%rip),%rax
+	call v4__dpush@PLT
+	mov $29,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L116:
+.stabn 68,0,139,.LM1483-v4_strerror
+.LM1483:
+	call v4__einprogress@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L117
+	lea .LC114(%rip),%rax
+	call v4__dpush@PLT
+	mov $25,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L117:
+.stabn 68,0,140,.LM1496-v4_strerror
+.LM1496:
+	call v4__estale@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L118
+	lea .LC115(%rip),%rax
+	call v4__dpush@PLT
+	mov $21,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L118:
+.stabn 68,0,141,.LM1509-v4_strerror
+.LM1509:
+	call v4__euclean@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L119
+	lea .LC116(%rip),%rax
+	call v4__dpush@PLT
+	mov $24,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L119:
+.stabn 68,0,142,.LM1522-v4_strerror
+.LM1522:
+	call v4__enotnam@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L120
+	lea .LC117(%rip),%rax
+	call v4__dpush@PLT
+	mov $27,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L120:
+.stabn 68,0,143,.LM1535-v4_strerror
+.LM1535:
+	call v4__enavail@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L121
+	lea .LC118(%rip),%rax
+	call v4__dpush@PLT
+	mov $29,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L121:
+.stabn 68,0,144,.LM1548-v4_strerror
+.LM1548:
+	call v4__eisnam@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L122
+	lea .LC119(%rip),%rax
+	call v4__dpush@PLT
+	mov $20,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L122:
+.stabn 68,0,145,.LM1561-v4_strerror
+.LM1561:
+	call v4__eremoteio@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L123
+	lea .LC120(%rip),%rax
+	call v4__dpush@PLT
+	mov $16,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L123:
+.stabn 68,0,146,.LM1574-v4_strerror
+.LM1574:
+	call v4__edquot@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L124
+	lea .LC121(%rip),%rax
+	call v4__dpush@PLT
+	mov $14,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L124:
+.stabn 68,0,147,.LM1587-v4_strerror
+.LM1587:
+	call v4__enomedium@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L125
+	lea .LC122(%rip),%rax
+	call v4__dpush@PLT
+	mov $15,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L125:
+.stabn 68,0,148,.LM1600-v4_strerror
+.LM1600:
+	call v4__emediumtype@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L126
+	lea .LC123(%rip),%rax
+	call v4__dpush@PLT
+	mov $17,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L126:
+.stabn 68,0,149,.LM1613-v4_strerror
+.LM1613:
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	call v4__dpush@PLT
+	cmp %rax,%rdx
+	jne .L127
+	lea .LC124(%rip),%rax
+	call v4__dpush@PLT
+	mov $7,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	jmp .L2
+.L127:
+.stabn 68,0,150,.LM1627-v4_strerror
+.LM1627:
+	lea .LC125(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+.L2:
+	call v4__dpop@PLT
+.stabn 68,0,151,.LM1635-v4_strerror
+.LM1635:
+	call v4_z2_Greaterr@PLT
+	call v4_drop@PLT
+	pop %rbx
+	leave
+	jmp v4_z2r_Greater@PLT
+.LBE0:
+.stabn 68,0,151,.LM1639-v4_strerror
+.LM1639:
+	pop %rbx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_strerror,.Lfe0-v4_strerror
+.stabn	192,0,0,.LBB0-v4_strerror
+.stabn	224,0,0,.LBE0-v4_strerror
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_strerror
+.text
+	.align 4
+.stabs "v4_perror:F1",36,0,0,v4_perror
+	.weak v4_perror
+	.type	v4_perror,@function
+v4_perror:
+.stabn 68,0,153,.LMa1640-v4_perror
+.LMa1640:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,153,.LMb1640-v4_perror
+.LMb1640:
+.LBB128:
+.stabn 68,0,154,.LM1641-v4_perror
+.LM1641:
+	call v4_Questiondup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L129
+.stabn 68,0,155,.LM1644-v4_perror
+.LM1644:
+	call v4_type@PLT
+	lea .LC126(%rip),%rax
+	call v4__dpush@PLT
+	mov $2,%rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.stabn 68,0,156,.LM1650-v4_perror
+.LM1650:
+	jmp .L130
+.L129:
+	call v4_drop@PLT
+.L130:
+.stabn 68,0,157,.LM1654-v4_perror
+.LM1654:
+	call v4_errno@PLT
+	call v4_strerror@PLT
+	call v4_Questiondup@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L131
+.stabn 68,0,158,.LM1659-v4_perror
+.LM1659:
+	pop %rbx
+	leave
+	jmp v4_type@PLT
+.L131:
+.stabn 68,0,160,.LM1662-v4_perror
+.LM1662:
+	call v4_drop@PLT
+.stabn 68,0,161,.LM1663-v4_perror
+.LM1663:
+	lea .LC127(%rip),%rax
+	call v4__dpush@PLT
+	mov $18,%rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	call v4_errno@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4_Dotr@PLT
+.LBE128:
+.stabn 68,0,162,.LM1674-v4_perror
+.LM1674:
+	pop %rbx
+	leave
+	ret
+.Lfe128:
+	.size	 v4_perror,.Lfe128-v4_perror
+.stabn	192,0,0,.LBB128-v4_perror
+.stabn	224,0,0,.LBE128-v4_perror
+.Lscope128:
+.stabs	"",36,0,0,.Lscope128-v4_perror
+.text
+	.align 4
+.stabs "v4_pperror:F1",36,0,0,v4_pperror
+	.weak v4_pperror
+	.type	v4_pperror,@function
+v4_pperror:
+.stabn 68,0,164,.LMa1675-v4_pperror
+.LMa1675:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,164,.LMb1675-v4_pperror
+.LMb1675:
+.LBB134:
+.stabn 68,0,165,.LM1676-v4_pperror
+.LM1676:
+	xor %rax,%rax
+	call v4__dpush@PLT
+	call v4_arg@PLT
+	call v4_type@PLT
+	lea .LC128(%rip),%rax
+	call v4__dpush@PLT
+	mov $2,%rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	pop %rbx
+	leave
+	jmp v4_perror@PLT
+.LBE134:
+.stabn 68,0,165,.LM1687-v4_pperror
+.LM1687:
+	pop %rbx
+	leave
+	ret
+.Lfe134:
+	.size	 v4_pperror,.Lfe134-v4_pperror
+.stabn	192,0,0,.LBB134-v4_pperror
+.stabn	224,0,0,.LBE134-v4_pperror
+.Lscope134:
+.stabs	"",36,0,0,.Lscope134-v4_pperror
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"
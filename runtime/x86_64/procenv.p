@@ -0,0 +1,258 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: procenv.ft
+Compiled: Sat Oct 17 10:15:10 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+    25 Sym_4 external "v4_Equals"
+    42 Sym_17 external "v4_Fetch"
+    46 Sym_19 external "v4_Greaterr"
+    25 Sym_2 external "v4_Plus"
+    24 Sym_0 word "v4___Parenenvstr_Equals_Closeparen"
+    25 Sym_3 external "v4_c_Fetch"
+    57 Sym_24 external "v4_cell_Plus"
+    53 Sym_22 external "v4_char_Plus"
+    26 Sym_7 external "v4_drop"
+    30 Sym_12 external "v4_dup"
+    40 Sym_16 external "v4_envp"
+    26 Sym_8 external "v4_false"
+    39 Sym_15 word "v4_getenv"
+    29 Sym_11 external "v4_i"
+    25 Sym_5 external "v4_invert"
+    29 Sym_10 external "v4_over"
+    47 Sym_20 external "v4_r_Greater"
+    50 Sym_21 external "v4_rot"
+    55 Sym_23 external "v4_strlen"
+    28 Sym_9 external "v4_swap"
+    37 Sym_14 external "v4_true"
+    31 Sym_13 external "v4_unloop"
+    43 Sym_18 external "v4_z0_Equals"
+    26 Sym_6 external "v4_z2drop"
+    25 Sym_1 external "v4_z2dup"
+
+Intermediate code:
+    24 function Sym_0 {
+    25   call Sym_1
+    25   no-op
+           optimizes   call Sym_2
+    25   Reg_1 = Stack_D
+    25   Reg_0 = Stack_D
+    25   Reg_0 += Reg_1
+    25   Stack_D = Reg_0
+    25   call Sym_3
+    25   Reg_0 = 61
+    25   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    25   no-op
+           optimizes   call Sym_4
+    25   no-op
+           optimizes   Reg_1 = Stack_D
+    25   Reg_0 = Stack_D
+    25   Reg_0 = Reg_0 == Reg_1
+    25   no-op
+           optimizes   Stack_D = Reg_0
+    25   no-op
+           optimizes   call Sym_5
+    25   no-op
+           optimizes   Reg_0 = Stack_D
+    25   Reg_0 = ~Reg_0
+    25   no-op
+           optimizes   Stack_D = Reg_0
+    25   no-op
+           optimizes   Reg_0 = Stack_D
+    25   if Reg_0 == 0 goto Label_2
+    26   call Sym_6
+    26   call Sym_7
+    26   no-op
+           optimizes   call Sym_8
+    26   Reg_0 = 0
+    26   Stack_D = Reg_0
+    26   goto Label_1
+    27 label Label_2
+    28   call Sym_9
+    28   Reg_0 = 0
+    28   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    28   no-op
+           optimizes   Reg_1 = Stack_D
+    28   Reg_0 = Stack_D
+    28   if Reg_0 == Reg_1 goto Label_3
+    28   Stack_R = Reg_0
+    28   Stack_R = Reg_1
+    28 label Label_4
+    29   call Sym_10
+    29   call Sym_11
+    29   no-op
+           optimizes   call Sym_2
+    29   Reg_1 = Stack_D
+    29   Reg_0 = Stack_D
+    29   Reg_0 += Reg_1
+    29   Stack_D = Reg_0
+    29   call Sym_3
+    30   call Sym_12
+    30   Reg_0 = 61
+    30   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    30   no-op
+           optimizes   call Sym_4
+    30   no-op
+           optimizes   Reg_1 = Stack_D
+    30   Reg_0 = Stack_D
+    30   if Reg_0 != Reg_1 goto Label_6
+    30   no-op
+           optimizes   Reg_0 = Stack_D
+    30   no-op
+           optimizes   if Reg_0 == 0 goto Label_6
+    31   call Sym_6
+    31   call Sym_7
+    31   call Sym_13
+    31   no-op
+           optimizes   call Sym_8
+    31   Reg_0 = 0
+    31   Stack_D = Reg_0
+    31   goto Label_1
+    32 label Label_6
+    33   call Sym_10
+    33   call Sym_11
+    33   no-op
+           optimizes   call Sym_2
+    33   Reg_1 = Stack_D
+    33   Reg_0 = Stack_D
+    33   Reg_0 += Reg_1
+    33   Stack_D = Reg_0
+    33   call Sym_3
+    33   no-op
+           optimizes   call Sym_4
+    33   Reg_1 = Stack_D
+    33   Reg_0 = Stack_D
+    33   Reg_0 = Reg_0 == Reg_1
+    33   no-op
+           optimizes   Stack_D = Reg_0
+    33   no-op
+           optimizes   call Sym_5
+    33   no-op
+           optimizes   Reg_0 = Stack_D
+    33   Reg_0 = ~Reg_0
+    33   no-op
+           optimizes   Stack_D = Reg_0
+    33   no-op
+           optimizes   Reg_0 = Stack_D
+    33   if Reg_0 == 0 goto Label_7
+    34   call Sym_6
+    34   call Sym_13
+    34   no-op
+           optimizes   call Sym_8
+    34   Reg_0 = 0
+    34   Stack_D = Reg_0
+    34   goto Label_1
+    35 label Label_7
+    36   Reg_1 = Stack_R
+    36   Reg_1 += 1
+    36   Reg_0 = Stack_R
+    36   Stack_R = Reg_0
+    36   Stack_R = Reg_1
+    36   Reg_1 -= Reg_0
+    36   if Reg_1 != 0 goto Label_4
+    36   no-op
+           optimizes label Label_5
+    36   Reg_0 = Stack_R
+    36   Reg_0 = Stack_R
+    36 label Label_3
+    37   call Sym_6
+    37   no-op
+           optimizes   call Sym_14
+    37   Reg_0 = -1
+    37   Stack_D = Reg_0
+    37 label Label_1
+    37 }
+
+    39 function Sym_15 {
+    40   call Sym_16
+    41 label Label_9
+    42   call Sym_12
+    42   call Sym_17
+    43   call Sym_12
+    43   no-op
+           optimizes   call Sym_18
+    43   Reg_0 = Stack_D
+    43   if Reg_0 != 0 goto Label_11
+    43   no-op
+           optimizes   Reg_0 = Stack_D
+    43   no-op
+           optimizes   if Reg_0 == 0 goto Label_11
+    44   call Sym_6
+    44   call Sym_6
+    44   no-op
+           optimizes   call Sym_8
+    44   Reg_0 = 0
+    44   Stack_D = Reg_0
+    44   goto Label_8
+    45 label Label_11
+    46   call Sym_9
+    46   call Sym_19
+    47   call Sym_19
+    47   call Sym_1
+    47   call Sym_20
+    47   call Sym_0
+    48   call Sym_20
+    48   call Sym_9
+    49   Reg_0 = Stack_D
+    49   if Reg_0 == 0 goto Label_12
+    50   call Sym_21
+    50   call Sym_21
+    50   call Sym_6
+    50   call Sym_17
+    51 label Label_13
+    52   call Sym_12
+    52   call Sym_3
+    52   Reg_0 = 61
+    52   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    52   no-op
+           optimizes   call Sym_4
+    52   no-op
+           optimizes   Reg_1 = Stack_D
+    52   Reg_0 = Stack_D
+    52   Reg_0 = Reg_0 == Reg_1
+    52   no-op
+           optimizes   Stack_D = Reg_0
+    52   no-op
+           optimizes   call Sym_5
+    52   no-op
+           optimizes   Reg_0 = Stack_D
+    52   Reg_0 = ~Reg_0
+    52   no-op
+           optimizes   Stack_D = Reg_0
+    52   no-op
+           optimizes   Reg_0 = Stack_D
+    52   if Reg_0 == 0 goto Label_14
+    53   call Sym_22
+    54   goto Label_13
+    54 label Label_14
+    55   call Sym_22
+    55   call Sym_23
+    55   no-op
+           optimizes   call Sym_14
+    55   Reg_0 = -1
+    55   Stack_D = Reg_0
+    55   goto Label_8
+    56 label Label_12
+    57   no-op
+           optimizes   call Sym_24
+    57   Reg_0 = Stack_D
+    57   Reg_0 += 8
+    57   Stack_D = Reg_0
+    58   goto Label_9
+    58   no-op
+           optimizes label Label_10
+    58 label Label_8
+    58 }
+
+Peephole rewrites:
+  v4___Parenenvstr_Equals_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parenenvstr_Equals_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parenenvstr_Equals_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parenenvstr_Equals_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parenenvstr_Equals_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4___Parenenvstr_Equals_Closeparen: redundant-test: test %rdx,%rdx => (none)
+
@@ -0,0 +1,230 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: rstack.ft
+Compiled: Sat Oct 17 10:15:09 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+   109 Sym_7 external "v4_Fetch"
+    94 Sym_4 codeword "v4_Greaterr"
+   118 Sym_14 external "v4_Minus"
+   115 Sym_12 external "v4_Plus"
+   118 Sym_17 external "v4_Slash"
+   118 Sym_18 external "v4_Store"
+    71 Sym_3 codeword "v4__rpop"
+    41 Sym_2 codeword "v4__rpush"
+    27 Sym_1 variable Cell "v4__rsindex"
+    25 Sym_0 variable Cell[2048] "v4__rstack"
+   118 Sym_16 external "v4_cell"
+   118 Sym_15 external "v4_cell_Plus"
+   115 Sym_11 external "v4_cells"
+   124 Sym_22 external "v4_drop"
+   121 Sym_20 external "v4_dup"
+   120 Sym_19 word "v4_r_Fetch"
+   101 Sym_5 codeword "v4_r_Greater"
+   108 Sym_6 word "v4_rdepth"
+   123 Sym_21 word "v4_rdrop"
+   111 Sym_8 word "v4_rp0"
+   114 Sym_9 word "v4_rp_Fetch"
+   117 Sym_13 word "v4_rp_Store"
+   127 Sym_24 external "v4_swap"
+   115 Sym_10 external "v4_z1_Minus"
+   126 Sym_23 word "v4_z2_Greaterr"
+   133 Sym_27 external "v4_z2dup"
+   132 Sym_26 word "v4_z2r_Fetch"
+   129 Sym_25 word "v4_z2r_Greater"
+   135 Sym_28 word "v4_z2rdrop"
+
+Intermediate code:
+    41 function Sym_2 {
+    42   asm (    push %rcx)
+    43   asm (    push %rdx)
+    44   asm (    mov $2032,%rcx)
+    45   asm (    mov v4__rstack@GOTPCREL(%rip),%rdi)
+    46   asm (    mov v4__rsindex@GOTPCREL(%rip),%rsi)
+    47   asm (    mov $-5,%rdx)
+    48   asm (    call v4__push@PLT)
+    49   asm (    pop %rdx)
+    50   asm (    pop %rcx)
+    52   asm (    forth_pic.=0b-0b)
+    53 }
+
+    71 function Sym_3 {
+    72   asm (    push %rdx)
+    73   asm (    mov v4__rstack@GOTPCREL(%rip),%rdi)
+    74   asm (    mov v4__rsindex@GOTPCREL(%rip),%rsi)
+    75   asm (    mov $-6,%rdx)
+    76   asm (    call v4__pop@PLT)
+    77   asm (    pop %rdx)
+    79   asm (    forth_pic.=0b-0b)
+    80 }
+
+    94 function Sym_4 {
+    95   asm (    call v4__dpop@PLT)
+    96   asm (    call v4__rpush@PLT)
+    98   asm (    forth_pic.=0b-0b)
+    99 }
+
+   101 function Sym_5 {
+   102   asm (    call v4__rpop@PLT)
+   103   asm (    call v4__dpush@PLT)
+   105   asm (    forth_pic.=0b-0b)
+   106 }
+
+   108 function Sym_6 {
+   109   no-op
+           optimizes   Reg_0 = Sym_1
+   109   no-op
+           optimizes   Stack_D = Reg_0
+   109   no-op
+           optimizes   call Sym_7
+   109   Reg_0 = *(Sym_1)
+   109   Stack_D = Reg_0
+   109   no-op
+           optimizes label Label_1
+   109 }
+
+   111 function Sym_8 {
+   112   Reg_0 = Sym_0
+   112   Stack_D = Reg_0
+   112   no-op
+           optimizes label Label_2
+   112 }
+
+   114 function Sym_9 {
+   115   no-op
+           optimizes   call Sym_6
+   109   no-op
+           optimizes   Reg_0 = Sym_1
+   109   no-op
+           optimizes   Stack_D = Reg_0
+   109   no-op
+           optimizes   call Sym_7
+   109   Reg_0 = *(Sym_1)
+   109   no-op
+           optimizes   Stack_D = Reg_0
+   115   no-op
+           optimizes   call Sym_10
+   115   no-op
+           optimizes   Reg_0 = Stack_D
+   115   Reg_0 -= 1
+   115   no-op
+           optimizes   Stack_D = Reg_0
+   115   no-op
+           optimizes   call Sym_11
+   115   no-op
+           optimizes   Reg_0 = Stack_D
+   115   Reg_0 *= 8
+   115   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+   115   no-op
+           optimizes   call Sym_8
+   112   Reg_0 = Sym_0
+   112   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   115   no-op
+           optimizes   call Sym_12
+   115   no-op
+           optimizes   Reg_1 = Stack_D
+   115   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+   115   Reg_0 += Reg_1
+   115   Stack_D = Reg_0
+   115   no-op
+           optimizes label Label_3
+   115 }
+
+   117 function Sym_13 {
+   118   no-op
+           optimizes   call Sym_8
+   112   Reg_0 = Sym_0
+   112   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+   118   no-op
+           optimizes   call Sym_14
+   118   no-op
+           optimizes   Reg_1 = Stack_D
+   118   Reg_0 = Stack_D
+   118   Reg_0 -= Reg_1
+   118   no-op
+           optimizes   Stack_D = Reg_0
+   118   no-op
+           optimizes   call Sym_15
+   118   no-op
+           optimizes   Reg_0 = Stack_D
+   118   Reg_0 += 8
+   118   Stack_D = Reg_0
+   118   call Sym_16
+   118   call Sym_17
+   118   no-op
+           optimizes   Reg_0 = Sym_1
+   118   no-op
+           optimizes   Stack_D = Reg_0
+   118   no-op
+           optimizes   call Sym_18
+   118   Reg_0 = Stack_D
+   118   *(Sym_1) = Reg_0
+   118   no-op
+           optimizes label Label_4
+   118 }
+
+   120 function Sym_19 {
+   121   call Sym_5
+   121   call Sym_20
+   121   tail call Sym_4
+           optimizes   call Sym_4
+   121   no-op
+           optimizes label Label_5
+   121 }
+
+   123 function Sym_21 {
+   124   call Sym_5
+   124   tail call Sym_22
+           optimizes   call Sym_22
+   124   no-op
+           optimizes label Label_6
+   124 }
+
+   126 function Sym_23 {
+   127   call Sym_24
+   127   call Sym_4
+   127   tail call Sym_4
+           optimizes   call Sym_4
+   127   no-op
+           optimizes label Label_7
+   127 }
+
+   129 function Sym_25 {
+   130   call Sym_5
+   130   call Sym_5
+   130   tail call Sym_24
+           optimizes   call Sym_24
+   130   no-op
+           optimizes label Label_8
+   130 }
+
+   132 function Sym_26 {
+   133   call Sym_5
+   133   call Sym_5
+   133   call Sym_27
+   133   call Sym_4
+   133   call Sym_4
+   133   tail call Sym_24
+           optimizes   call Sym_24
+   133   no-op
+           optimizes label Label_9
+   133 }
+
+   135 function Sym_28 {
+   136   no-op
+           optimizes   call Sym_21
+   124   call Sym_5
+   124   call Sym_22
+   136   no-op
+           optimizes   call Sym_21
+   124   call Sym_5
+   124   tail call Sym_22
+           optimizes   call Sym_22
+   136   no-op
+           optimizes label Label_10
+   136 }
+
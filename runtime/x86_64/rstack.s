@@ -0,0 +1,509 @@
+	.file	"rstack.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"rstack.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.stabs	"v4__rsindex:G2",40,0,0,v4__rsindex
+	.comm  v4__rsindex,8,8
+.stabs	"v4__rstack:Gar2;0;2047;2",40,0,0,v4__rstack
+	.comm  v4__rstack,16384,32
+.text
+	.align 4
+.stabs "v4__rpush:F1",36,0,0,v4__rpush
+	.weak v4__rpush
+	.type	v4__rpush,@function
+v4__rpush:
+.stabn 68,0,41,.LMa0-v4__rpush
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,41,.LMb0-v4__rpush
+.LMb0:
+.LBB2:
+#APP
+    push %rcx
+    push %rdx
+    mov $2032,%rcx
+    mov v4__rstack@GOTPCREL(%rip),%rdi
+    mov v4__rsindex@GOTPCREL(%rip),%rsi
+    mov $-5,%rdx
+    call v4__push@PLT
+    pop %rdx
+    pop %rcx
+    forth_pic.=0b-0b
+#NO_APP
+.LBE2:
+.stabn 68,0,53,.LM11-v4__rpush
+.LM11:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe2:
+	.size	 v4__rpush,.Lfe2-v4__rpush
+.stabn	192,0,0,.LBB2-v4__rpush
+.stabn	224,0,0,.LBE2-v4__rpush
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4__rpush
+.text
+	.align 4
+.stabs "v4__rpop:F1",36,0,0,v4__rpop
+	.weak v4__rpop
+	.type	v4__rpop,@function
+v4__rpop:
+.stabn 68,0,71,.LMa12-v4__rpop
+.LMa12:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,71,.LMb12-v4__rpop
+.LMb12:
+.LBB3:
+#APP
+    push %rdx
+    mov v4__rstack@GOTPCREL(%rip),%rdi
+    mov v4__rsindex@GOTPCREL(%rip),%rsi
+    mov $-6,%rdx
+    call v4__pop@PLT
+    pop %rdx
+    forth_pic.=0b-0b
+#NO_APP
+.LBE3:
+.stabn 68,0,80,.LM20-v4__rpop
+.LM20:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe3:
+	.size	 v4__rpop,.Lfe3-v4__rpop
+.stabn	192,0,0,.LBB3-v4__rpop
+.stabn	224,0,0,.LBE3-v4__rpop
+.Lscope3:
+.stabs	"",36,0,0,.Lscope3-v4__rpop
+.text
+	.align 4
+.stabs "v4_Greaterr:F1",36,0,0,v4_Greaterr
+	.weak v4_Greaterr
+	.type	v4_Greaterr,@function
+v4_Greaterr:
+.stabn 68,0,94,.LMa21-v4_Greaterr
+.LMa21:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,94,.LMb21-v4_Greaterr
+.LMb21:
+.LBB4:
+#APP
+    call v4__dpop@PLT
+    call v4__rpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE4:
+.stabn 68,0,99,.LM25-v4_Greaterr
+.LM25:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe4:
+	.size	 v4_Greaterr,.Lfe4-v4_Greaterr
+.stabn	192,0,0,.LBB4-v4_Greaterr
+.stabn	224,0,0,.LBE4-v4_Greaterr
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4_Greaterr
+.text
+	.align 4
+.stabs "v4_r_Greater:F1",36,0,0,v4_r_Greater
+	.weak v4_r_Greater
+	.type	v4_r_Greater,@function
+v4_r_Greater:
+.stabn 68,0,101,.LMa26-v4_r_Greater
+.LMa26:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,101,.LMb26-v4_r_Greater
+.LMb26:
+.LBB5:
+#APP
+    call v4__rpop@PLT
+    call v4__dpush@PLT
+    forth_pic.=0b-0b
+#NO_APP
+.LBE5:
+.stabn 68,0,106,.LM30-v4_r_Greater
+.LM30:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe5:
+	.size	 v4_r_Greater,.Lfe5-v4_r_Greater
+.stabn	192,0,0,.LBB5-v4_r_Greater
+.stabn	224,0,0,.LBE5-v4_r_Greater
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4_r_Greater
+.text
+	.align 4
+.stabs "v4_rdepth:F1",36,0,0,v4_rdepth
+	.weak v4_rdepth
+	.type	v4_rdepth,@function
+v4_rdepth:
+.stabn 68,0,108,.LMa31-v4_rdepth
+.LMa31:
+0:
+.stabn 68,0,108,.LMb31-v4_rdepth
+.LMb31:
+.LBB6:
+	mov v4__rsindex@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.LBE6:
+.stabn 68,0,109,.LM38-v4_rdepth
+.LM38:
+	ret
+.Lfe6:
+	.size	 v4_rdepth,.Lfe6-v4_rdepth
+.stabn	192,0,0,.LBB6-v4_rdepth
+.stabn	224,0,0,.LBE6-v4_rdepth
+.Lscope6:
+.stabs	"",36,0,0,.Lscope6-v4_rdepth
+.text
+	.align 4
+.stabs "v4_rp0:F1",36,0,0,v4_rp0
+	.weak v4_rp0
+	.type	v4_rp0,@function
+v4_rp0:
+.stabn 68,0,111,.LMa39-v4_rp0
+.LMa39:
+0:
+.stabn 68,0,111,.LMb39-v4_rp0
+.LMb39:
+.LBB8:
+.stabn 68,0,112,.LM40-v4_rp0
+.LM40:
+	mov v4__rstack@GOTPCREL(%rip),%rax
+	call v4__dpush@PLT
+.LBE8:
+.stabn 68,0,112,.LM43-v4_rp0
+.LM43:
+	ret
+.Lfe8:
+	.size	 v4_rp0,.Lfe8-v4_rp0
+.stabn	192,0,0,.LBB8-v4_rp0
+.stabn	224,0,0,.LBE8-v4_rp0
+.Lscope8:
+.stabs	"",36,0,0,.Lscope8-v4_rp0
+.text
+	.align 4
+.stabs "v4_rp_Fetch:F1",36,0,0,v4_rp_Fetch
+	.weak v4_rp_Fetch
+	.type	v4_rp_Fetch,@function
+v4_rp_Fetch:
+.stabn 68,0,114,.LMa44-v4_rp_Fetch
+.LMa44:
+0:
+.stabn 68,0,114,.LMb44-v4_rp_Fetch
+.LMb44:
+.LBB9:
+	mov v4__rsindex@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	dec %rax
+	shl $3,%rax
+	mov %rax,%r8
+.stabn 68,0,112,.LM60-v4_rp_Fetch
+.LM60:
+	mov v4__rstack@GOTPCREL(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	call v4__dpush@PLT
+.LBE9:
+.stabn 68,0,115,.LM68-v4_rp_Fetch
+.LM68:
+	ret
+.Lfe9:
+	.size	 v4_rp_Fetch,.Lfe9-v4_rp_Fetch
+.stabn	192,0,0,.LBB9-v4_rp_Fetch
+.stabn	224,0,0,.LBE9-v4_rp_Fetch
+.Lscope9:
+.stabs	"",36,0,0,.Lscope9-v4_rp_Fetch
+.text
+	.align 4
+.stabs "v4_rp_Store:F1",36,0,0,v4_rp_Store
+	.weak v4_rp_Store
+	.type	v4_rp_Store,@function
+v4_rp_Store:
+.stabn 68,0,117,.LMa69-v4_rp_Store
+.LMa69:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,117,.LMb69-v4_rp_Store
+.LMb69:
+.LBB13:
+.stabn 68,0,112,.LM71-v4_rp_Store
+.LM71:
+	mov v4__rstack@GOTPCREL(%rip),%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	sub %rdx,%rax
+	add $8,%rax
+	call v4__dpush@PLT
+	call v4_cell@PLT
+	call v4_Slash@PLT
+	call v4__dpop@PLT
+	mov v4__rsindex@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.LBE13:
+.stabn 68,0,118,.LM90-v4_rp_Store
+.LM90:
+	pop %rbx
+	leave
+	ret
+.Lfe13:
+	.size	 v4_rp_Store,.Lfe13-v4_rp_Store
+.stabn	192,0,0,.LBB13-v4_rp_Store
+.stabn	224,0,0,.LBE13-v4_rp_Store
+.Lscope13:
+.stabs	"",36,0,0,.Lscope13-v4_rp_Store
+.text
+	.align 4
+.stabs "v4_r_Fetch:F1",36,0,0,v4_r_Fetch
+	.weak v4_r_Fetch
+	.type	v4_r_Fetch,@function
+v4_r_Fetch:
+.stabn 68,0,120,.LMa91-v4_r_Fetch
+.LMa91:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,120,.LMb91-v4_r_Fetch
+.LMb91:
+.LBB19:
+.stabn 68,0,121,.LM92-v4_r_Fetch
+.LM92:
+	call v4_r_Greater@PLT
+	call v4_dup@PLT
+	pop %rbx
+	leave
+	jmp v4_Greaterr@PLT
+.LBE19:
+.stabn 68,0,121,.LM96-v4_r_Fetch
+.LM96:
+	pop %rbx
+	leave
+	ret
+.Lfe19:
+	.size	 v4_r_Fetch,.Lfe19-v4_r_Fetch
+.stabn	192,0,0,.LBB19-v4_r_Fetch
+.stabn	224,0,0,.LBE19-v4_r_Fetch
+.Lscope19:
+.stabs	"",36,0,0,.Lscope19-v4_r_Fetch
+.text
+	.align 4
+.stabs "v4_rdrop:F1",36,0,0,v4_rdrop
+	.weak v4_rdrop
+	.type	v4_rdrop,@function
+v4_rdrop:
+.stabn 68,0,123,.LMa97-v4_rdrop
+.LMa97:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,123,.LMb97-v4_rdrop
+.LMb97:
+.LBB21:
+.stabn 68,0,124,.LM98-v4_rdrop
+.LM98:
+	call v4_r_Greater@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE21:
+.stabn 68,0,124,.LM101-v4_rdrop
+.LM101:
+	pop %rbx
+	leave
+	ret
+.Lfe21:
+	.size	 v4_rdrop,.Lfe21-v4_rdrop
+.stabn	192,0,0,.LBB21-v4_rdrop
+.stabn	224,0,0,.LBE21-v4_rdrop
+.Lscope21:
+.stabs	"",36,0,0,.Lscope21-v4_rdrop
+.text
+	.align 4
+.stabs "v4_z2_Greaterr:F1",36,0,0,v4_z2_Greaterr
+	.weak v4_z2_Greaterr
+	.type	v4_z2_Greaterr,@function
+v4_z2_Greaterr:
+.stabn 68,0,126,.LMa102-v4_z2_Greaterr
+.LMa102:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,126,.LMb102-v4_z2_Greaterr
+.LMb102:
+.LBB23:
+.stabn 68,0,127,.LM103-v4_z2_Greaterr
+.LM103:
+	call v4_swap@PLT
+	call v4_Greaterr@PLT
+	pop %rbx
+	leave
+	jmp v4_Greaterr@PLT
+.LBE23:
+.stabn 68,0,127,.LM107-v4_z2_Greaterr
+.LM107:
+	pop %rbx
+	leave
+	ret
+.Lfe23:
+	.size	 v4_z2_Greaterr,.Lfe23-v4_z2_Greaterr
+.stabn	192,0,0,.LBB23-v4_z2_Greaterr
+.stabn	224,0,0,.LBE23-v4_z2_Greaterr
+.Lscope23:
+.stabs	"",36,0,0,.Lscope23-v4_z2_Greaterr
+.text
+	.align 4
+.stabs "v4_z2r_Greater:F1",36,0,0,v4_z2r_Greater
+	.weak v4_z2r_Greater
+	.type	v4_z2r_Greater,@function
+v4_z2r_Greater:
+.stabn 68,0,129,.LMa108-v4_z2r_Greater
+.LMa108:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,129,.LMb108-v4_z2r_Greater
+.LMb108:
+.LBB25:
+.stabn 68,0,130,.LM109-v4_z2r_Greater
+.LM109:
+	call v4_r_Greater@PLT
+	call v4_r_Greater@PLT
+	pop %rbx
+	leave
+	jmp v4_swap@PLT
+.LBE25:
+.stabn 68,0,130,.LM113-v4_z2r_Greater
+.LM113:
+	pop %rbx
+	leave
+	ret
+.Lfe25:
+	.size	 v4_z2r_Greater,.Lfe25-v4_z2r_Greater
+.stabn	192,0,0,.LBB25-v4_z2r_Greater
+.stabn	224,0,0,.LBE25-v4_z2r_Greater
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4_z2r_Greater
+.text
+	.align 4
+.stabs "v4_z2r_Fetch:F1",36,0,0,v4_z2r_Fetch
+	.weak v4_z2r_Fetch
+	.type	v4_z2r_Fetch,@function
+v4_z2r_Fetch:
+.stabn 68,0,132,.LMa114-v4_z2r_Fetch
+.LMa114:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,132,.LMb114-v4_z2r_Fetch
+.LMb114:
+.LBB26:
+.stabn 68,0,133,.LM115-v4_z2r_Fetch
+.LM115:
+	call v4_r_Greater@PLT
+	call v4_r_Greater@PLT
+	call v4_z2dup@PLT
+	call v4_Greaterr@PLT
+	call v4_Greaterr@PLT
+	pop %rbx
+	leave
+	jmp v4_swap@PLT
+.LBE26:
+.stabn 68,0,133,.LM122-v4_z2r_Fetch
+.LM122:
+	pop %rbx
+	leave
+	ret
+.Lfe26:
+	.size	 v4_z2r_Fetch,.Lfe26-v4_z2r_Fetch
+.stabn	192,0,0,.LBB26-v4_z2r_Fetch
+.stabn	224,0,0,.LBE26-v4_z2r_Fetch
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4_z2r_Fetch
+.text
+	.align 4
+.stabs "v4_z2rdrop:F1",36,0,0,v4_z2rdrop
+	.weak v4_z2rdrop
+	.type	v4_z2rdrop,@function
+v4_z2rdrop:
+.stabn 68,0,135,.LMa123-v4_z2rdrop
+.LMa123:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,135,.LMb123-v4_z2rdrop
+.LMb123:
+.LBB28:
+.stabn 68,0,124,.LM125-v4_z2rdrop
+.LM125:
+	call v4_r_Greater@PLT
+	call v4_drop@PLT
+.stabn 68,0,124,.LM128-v4_z2rdrop
+.LM128:
+	call v4_r_Greater@PLT
+	pop %rbx
+	leave
+	jmp v4_drop@PLT
+.LBE28:
+.stabn 68,0,136,.LM131-v4_z2rdrop
+.LM131:
+	pop %rbx
+	leave
+	ret
+.Lfe28:
+	.size	 v4_z2rdrop,.Lfe28-v4_z2rdrop
+.stabn	192,0,0,.LBB28-v4_z2rdrop
+.stabn	224,0,0,.LBE28-v4_z2rdrop
+.Lscope28:
+.stabs	"",36,0,0,.Lscope28-v4_z2rdrop
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"
@@ -0,0 +1,94 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: stack.ft
+Compiled: Sat Oct 17 10:15:09 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+    65 Sym_3 external "v4_Store"
+    67 Sym_4 word "v4__clrstackeh"
+   177 Sym_8 codeword "v4__pop"
+   132 Sym_7 codeword "v4__push"
+    64 Sym_1 word "v4__setstackeh"
+    62 Sym_0 variable Cell "v4__stackeh"
+    84 Sym_6 codeword "v4__starteh"
+    68 Sym_5 external "v4_false"
+    65 Sym_2 external "v4_true"
+
+Intermediate code:
+    64 function Sym_1 {
+    65   no-op
+           optimizes   call Sym_2
+    65   Reg_0 = -1
+    65   no-op
+           optimizes   Stack_D = Reg_0
+    65   no-op
+           optimizes   Reg_0 = Sym_0
+    65   no-op
+           optimizes   Stack_D = Reg_0
+    65   no-op
+           optimizes   call Sym_3
+    65   no-op
+           optimizes   Reg_0 = Stack_D
+    65   *(Sym_0) = Reg_0
+    65   no-op
+           optimizes label Label_1
+    65 }
+
+    67 function Sym_4 {
+    68   no-op
+           optimizes   call Sym_5
+    68   Reg_0 = 0
+    68   no-op
+           optimizes   Stack_D = Reg_0
+    68   no-op
+           optimizes   Reg_0 = Sym_0
+    68   no-op
+           optimizes   Stack_D = Reg_0
+    68   no-op
+           optimizes   call Sym_3
+    68   no-op
+           optimizes   Reg_0 = Stack_D
+    68   *(Sym_0) = Reg_0
+    68   no-op
+           optimizes label Label_2
+    68 }
+
+    84 function Sym_6 {
+    85   asm (    mov v4__stackeh@GOTPCREL(%rip),%rsi)
+    86   asm (    mov (%rsi),%rdi)
+    87   asm (    test %rdi,%rdi)
+    88   asm (    jnz 1f)
+    90   asm (    movq $-1,(%rsi))
+    91   asm (    mov %rdx,%rax)
+    92   asm (    call v4__dpush@PLT)
+    93   asm (    call v4_throw@PLT)
+    95   asm (1:)
+    97   asm (    forth_pic.=0b-0b)
+    98 }
+
+   132 function Sym_7 {
+   133   asm (    cmp %rcx,(%rsi))
+   134   asm (    jb 1f)
+   135   asm (    call v4__starteh@PLT)
+   136   asm (1:)
+   138   asm (    push %rsi)
+   139   asm (    mov (%rsi),%rsi)
+   140   asm (    mov %rax,(%rdi,%rsi,8))
+   141   asm (    pop %rsi)
+   142   asm (    incq (%rsi))
+   144   asm (    forth_pic.=0b-0b)
+   145 }
+
+   177 function Sym_8 {
+   178   asm (    cmpq $0,(%rsi))
+   179   asm (    ja 1f)
+   181   asm (    mov %rdx,%rax)
+   182   asm (    call v4__dpush@PLT)
+   183   asm (    call v4_throw@PLT)
+   185   asm (1:)
+   187   asm (    decq (%rsi))
+   188   asm (    mov (%rsi),%rsi)
+   189   asm (    mov (%rdi,%rsi,8),%rax)
+   191   asm (    forth_pic.=0b-0b)
+   192 }
+
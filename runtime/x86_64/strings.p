@@ -0,0 +1,710 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: strings.ft
+Compiled: Sat Oct 17 10:15:10 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+    26 Sym_6 external "v4_Equals"
+    30 Sym_9 external "v4_Greaterr"
+    30 Sym_12 external "v4_Minus"
+    23 Sym_0 word "v4_Minustrailing"
+    25 Sym_2 external "v4_Plus"
+    29 Sym_7 word "v4_Slashstring"
+    75 Sym_38 word "v4___Parencidiff_Closeparen"
+    54 Sym_25 word "v4___Parencompare_Closeparen"
+    72 Sym_35 word "v4___Parencuc_Closeparen"
+    84 Sym_41 word "v4___Parensearch_Closeparen"
+    26 Sym_5 external "v4_bl"
+    32 Sym_13 word "v4_blank"
+    25 Sym_4 external "v4_c_Fetch"
+    39 Sym_19 external "v4_c_Store"
+    35 Sym_15 word "v4_cmove"
+    43 Sym_22 word "v4_cmove_Greater"
+    78 Sym_39 word "v4_compare"
+    81 Sym_40 word "v4_comparei"
+    41 Sym_20 external "v4_drop"
+    30 Sym_10 external "v4_dup"
+    61 Sym_30 external "v4_execute"
+    88 Sym_42 external "v4_false"
+    33 Sym_14 external "v4_fill"
+    38 Sym_18 external "v4_i"
+    56 Sym_28 external "v4_min"
+    38 Sym_17 external "v4_over"
+    61 Sym_29 external "v4_pick"
+    47 Sym_23 external "v4_r_Fetch"
+    49 Sym_24 external "v4_r_Greater"
+    55 Sym_26 external "v4_roll"
+    56 Sym_27 external "v4_rot"
+   100 Sym_46 word "v4_search"
+   103 Sym_47 word "v4_searchi"
+   106 Sym_48 word "v4_sliteral"
+    30 Sym_8 external "v4_swap"
+    95 Sym_45 external "v4_true"
+    65 Sym_34 external "v4_unloop"
+    73 Sym_37 external "v4_within"
+    93 Sym_44 external "v4_z0_Equals"
+    36 Sym_16 external "v4_z0_Greater"
+    63 Sym_32 external "v4_z0_Less"
+    62 Sym_31 external "v4_z0_Less_Greater"
+    25 Sym_3 external "v4_z1_Minus"
+    73 Sym_36 external "v4_z1_Plus"
+    41 Sym_21 external "v4_z2drop"
+    25 Sym_1 external "v4_z2dup"
+    91 Sym_43 external "v4_z2over"
+    30 Sym_11 external "v4_z2r_Greater"
+    64 Sym_33 external "v4_z2rdrop"
+
+Intermediate code:
+    23 function Sym_0 {
+    24 label Label_2
+    25   call Sym_1
+    25   no-op
+           optimizes   call Sym_2
+    25   Reg_1 = Stack_D
+    25   Reg_0 = Stack_D
+    25   Reg_0 += Reg_1
+    25   no-op
+           optimizes   Stack_D = Reg_0
+    25   no-op
+           optimizes   call Sym_3
+    25   no-op
+           optimizes   Reg_0 = Stack_D
+    25   Reg_0 -= 1
+    25   Stack_D = Reg_0
+    25   call Sym_4
+    26   call Sym_5
+    26   no-op
+           optimizes   call Sym_6
+    26   Reg_1 = Stack_D
+    26   Reg_0 = Stack_D
+    26   if Reg_0 != Reg_1 goto Label_3
+    26   no-op
+           optimizes   Reg_0 = Stack_D
+    26   no-op
+           optimizes   if Reg_0 == 0 goto Label_3
+    27   no-op
+           optimizes   call Sym_3
+    27   Reg_0 = Stack_D
+    27   Reg_0 -= 1
+    27   Stack_D = Reg_0
+    27   goto Label_2
+    27 label Label_3
+    27   no-op
+           optimizes label Label_1
+    27 }
+
+    29 function Sym_7 {
+    30   call Sym_8
+    30   call Sym_9
+    30   call Sym_10
+    30   call Sym_9
+    30   no-op
+           optimizes   call Sym_2
+    30   Reg_1 = Stack_D
+    30   Reg_0 = Stack_D
+    30   Reg_0 += Reg_1
+    30   Stack_D = Reg_0
+    30   call Sym_11
+    30   no-op
+           optimizes   call Sym_12
+    30   Reg_1 = Stack_D
+    30   Reg_0 = Stack_D
+    30   Reg_0 -= Reg_1
+    30   Stack_D = Reg_0
+    30   no-op
+           optimizes label Label_4
+    30 }
+
+    32 function Sym_13 {
+    33   call Sym_5
+    33   tail call Sym_14
+           optimizes   call Sym_14
+    33   no-op
+           optimizes label Label_5
+    33 }
+
+    35 function Sym_15 {
+    36   call Sym_10
+    36   no-op
+           optimizes   call Sym_16
+    36   Reg_0 = Stack_D
+    36   if Reg_0 <= 0 goto Label_7
+    36   no-op
+           optimizes   Reg_0 = Stack_D
+    36   no-op
+           optimizes   if Reg_0 == 0 goto Label_7
+    37   Reg_0 = 0
+    37   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    37   no-op
+           optimizes   Reg_1 = Stack_D
+    37   Reg_0 = Stack_D
+    37   Stack_R = Reg_0
+    37   Stack_R = Reg_1
+    37 label Label_9
+    38   call Sym_17
+    38   call Sym_18
+    38   no-op
+           optimizes   call Sym_2
+    38   Reg_1 = Stack_D
+    38   Reg_0 = Stack_D
+    38   Reg_0 += Reg_1
+    38   Stack_D = Reg_0
+    38   call Sym_4
+    39   call Sym_17
+    39   call Sym_18
+    39   no-op
+           optimizes   call Sym_2
+    39   Reg_1 = Stack_D
+    39   Reg_0 = Stack_D
+    39   Reg_0 += Reg_1
+    39   Stack_D = Reg_0
+    39   call Sym_19
+    40   Reg_1 = Stack_R
+    40   Reg_1 += 1
+    40   Reg_0 = Stack_R
+    40   Stack_R = Reg_0
+    40   Stack_R = Reg_1
+    40   Reg_1 -= Reg_0
+    40   if Reg_1 != 0 goto Label_9
+    40   no-op
+           optimizes label Label_10
+    40   Reg_0 = Stack_R
+    40   Reg_0 = Stack_R
+    40   no-op
+           optimizes label Label_8
+    41   goto Label_11
+    41 label Label_7
+    41   call Sym_20
+    40   no-op
+           optimizes label Label_8
+    41 label Label_11
+    41   tail call Sym_21
+           optimizes   call Sym_21
+    41   no-op
+           optimizes label Label_6
+    41 }
+
+    43 function Sym_22 {
+    44   call Sym_10
+    44   no-op
+           optimizes   call Sym_16
+    44   Reg_0 = Stack_D
+    44   if Reg_0 <= 0 goto Label_13
+    44   no-op
+           optimizes   Reg_0 = Stack_D
+    44   no-op
+           optimizes   if Reg_0 == 0 goto Label_13
+    45   call Sym_10
+    45   Reg_0 = 0
+    45   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    45   no-op
+           optimizes   Reg_1 = Stack_D
+    45   Reg_0 = Stack_D
+    45   Stack_R = Reg_0
+    45   Stack_R = Reg_1
+    45 label Label_15
+    46   call Sym_18
+    46   call Sym_8
+    46   call Sym_9
+    47   call Sym_23
+    47   call Sym_8
+    47   no-op
+           optimizes   call Sym_12
+    47   Reg_1 = Stack_D
+    47   Reg_0 = Stack_D
+    47   Reg_0 -= Reg_1
+    47   no-op
+           optimizes   Stack_D = Reg_0
+    47   no-op
+           optimizes   call Sym_3
+    47   no-op
+           optimizes   Reg_0 = Stack_D
+    47   Reg_0 -= 1
+    47   Stack_D = Reg_0
+    47   call Sym_9
+    48   call Sym_17
+    48   call Sym_23
+    48   no-op
+           optimizes   call Sym_2
+    48   Reg_1 = Stack_D
+    48   Reg_0 = Stack_D
+    48   Reg_0 += Reg_1
+    48   Stack_D = Reg_0
+    48   call Sym_4
+    49   call Sym_17
+    49   call Sym_24
+    49   no-op
+           optimizes   call Sym_2
+    49   Reg_1 = Stack_D
+    49   Reg_0 = Stack_D
+    49   Reg_0 += Reg_1
+    49   Stack_D = Reg_0
+    49   call Sym_19
+    50   call Sym_24
+    51   Reg_1 = Stack_R
+    51   Reg_1 += 1
+    51   Reg_0 = Stack_R
+    51   Stack_R = Reg_0
+    51   Stack_R = Reg_1
+    51   Reg_1 -= Reg_0
+    51   if Reg_1 != 0 goto Label_15
+    51   no-op
+           optimizes label Label_16
+    51   Reg_0 = Stack_R
+    51   Reg_0 = Stack_R
+    51   no-op
+           optimizes label Label_14
+    51   call Sym_20
+    52   goto Label_17
+    52 label Label_13
+    52   call Sym_20
+    52 label Label_17
+    52   tail call Sym_21
+           optimizes   call Sym_21
+    52   no-op
+           optimizes label Label_12
+    52 }
+
+    54 function Sym_25 {
+    55   Reg_0 = 4
+    55   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    55   Reg_0 = 0
+    55   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    55   no-op
+           optimizes   Reg_1 = Stack_D
+    55   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    55   Stack_R = Reg_0
+    55   Stack_R = Reg_1
+    55 label Label_20
+    55   Reg_0 = 4
+    55   Stack_D = Reg_0
+    55   call Sym_26
+    55   Reg_1 = Stack_R
+    55   Reg_1 += 1
+    55   Reg_0 = Stack_R
+    55   Stack_R = Reg_0
+    55   Stack_R = Reg_1
+    55   Reg_1 -= Reg_0
+    55   if Reg_1 != 0 goto Label_20
+    55   no-op
+           optimizes label Label_21
+    55   Reg_0 = Stack_R
+    55   Reg_0 = Stack_R
+    55   no-op
+           optimizes label Label_19
+    56   call Sym_27
+    56   call Sym_1
+    56   call Sym_28
+    56   call Sym_9
+    56   call Sym_27
+    56   call Sym_27
+    56   call Sym_24
+    57   call Sym_8
+    57   call Sym_9
+    57   call Sym_27
+    57   call Sym_9
+    58   Reg_0 = 0
+    58   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    58   no-op
+           optimizes   Reg_1 = Stack_D
+    58   Reg_0 = Stack_D
+    58   if Reg_0 == Reg_1 goto Label_22
+    58   Stack_R = Reg_0
+    58   Stack_R = Reg_1
+    58 label Label_23
+    59   call Sym_17
+    59   call Sym_18
+    59   no-op
+           optimizes   call Sym_2
+    59   Reg_1 = Stack_D
+    59   Reg_0 = Stack_D
+    59   Reg_0 += Reg_1
+    59   Stack_D = Reg_0
+    59   call Sym_4
+    60   call Sym_17
+    60   call Sym_18
+    60   no-op
+           optimizes   call Sym_2
+    60   Reg_1 = Stack_D
+    60   Reg_0 = Stack_D
+    60   Reg_0 += Reg_1
+    60   Stack_D = Reg_0
+    60   call Sym_4
+    61   Reg_0 = 4
+    61   Stack_D = Reg_0
+    61   call Sym_29
+    61   call Sym_30
+    62   call Sym_10
+    62   no-op
+           optimizes   call Sym_31
+    62   Reg_0 = Stack_D
+    62   if Reg_0 == 0 goto Label_25
+    62   no-op
+           optimizes   Reg_0 = Stack_D
+    62   no-op
+           optimizes   if Reg_0 == 0 goto Label_25
+    63   no-op
+           optimizes   call Sym_32
+    63   Reg_0 = Stack_D
+    63   if Reg_0 >= 0 goto Label_26
+    63   no-op
+           optimizes   Reg_0 = Stack_D
+    63   no-op
+           optimizes   if Reg_0 == 0 goto Label_26
+    63   Reg_0 = -1
+    63   Stack_D = Reg_0
+    63   goto Label_27
+    63 label Label_26
+    63   Reg_0 = 1
+    63   Stack_D = Reg_0
+    63 label Label_27
+    64   call Sym_33
+    64   call Sym_9
+    64   call Sym_20
+    64   call Sym_21
+    64   call Sym_24
+    65   tail call Sym_34
+           optimizes   call Sym_34
+    65   no-op
+           optimizes   goto Label_18
+    66 label Label_25
+    66   call Sym_20
+    67   Reg_1 = Stack_R
+    67   Reg_1 += 1
+    67   Reg_0 = Stack_R
+    67   Stack_R = Reg_0
+    67   Stack_R = Reg_1
+    67   Reg_1 -= Reg_0
+    67   if Reg_1 != 0 goto Label_23
+    67   no-op
+           optimizes label Label_24
+    67   Reg_0 = Stack_R
+    67   Reg_0 = Stack_R
+    67 label Label_22
+    67   call Sym_21
+    67   call Sym_20
+    68   call Sym_11
+    68   call Sym_8
+    68   no-op
+           optimizes   call Sym_12
+    68   Reg_1 = Stack_D
+    68   Reg_0 = Stack_D
+    68   Reg_0 -= Reg_1
+    68   Stack_D = Reg_0
+    69   call Sym_10
+    69   no-op
+           optimizes   call Sym_32
+    69   Reg_0 = Stack_D
+    69   if Reg_0 >= 0 goto Label_28
+    69   no-op
+           optimizes   Reg_0 = Stack_D
+    69   no-op
+           optimizes   if Reg_0 == 0 goto Label_28
+    69   call Sym_20
+    69   Reg_0 = -1
+    69   Stack_D = Reg_0
+    69   goto Label_18
+    69 label Label_28
+    70   call Sym_10
+    70   no-op
+           optimizes   call Sym_16
+    70   Reg_0 = Stack_D
+    70   if Reg_0 <= 0 goto Label_29
+    70   no-op
+           optimizes   Reg_0 = Stack_D
+    70   no-op
+           optimizes   if Reg_0 == 0 goto Label_29
+    70   call Sym_20
+    70   Reg_0 = 1
+    70   Stack_D = Reg_0
+    70   goto Label_18
+    70 label Label_29
+    70 label Label_18
+    70 }
+
+    72 function Sym_35 {
+    73   call Sym_10
+    73   Reg_0 = 97
+    73   Stack_D = Reg_0
+    73   Reg_0 = 123
+           optimizes   Reg_0 = 122
+    73   Stack_D = Reg_0
+    73   no-op
+           optimizes   call Sym_36
+    73   call Sym_37
+    73   Reg_0 = Stack_D
+    73   if Reg_0 == 0 goto Label_31
+    73   Reg_0 = 97
+    73   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    73   no-op
+           optimizes   call Sym_12
+    73   no-op
+           optimizes   Reg_1 = Stack_D
+    73   Reg_0 = Stack_D
+    73   Reg_0 -= Reg_1
+    73   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    73   Reg_0 = 65
+    73   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    73   no-op
+           optimizes   call Sym_2
+    73   no-op
+           optimizes   Reg_1 = Stack_D
+    73   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    73   Reg_0 += Reg_1
+    73   Stack_D = Reg_0
+    73 label Label_31
+    73   no-op
+           optimizes label Label_30
+    73 }
+
+    75 function Sym_38 {
+    76   call Sym_9
+    76   call Sym_35
+    76   call Sym_24
+    76   call Sym_35
+    76   no-op
+           optimizes   call Sym_12
+    76   Reg_1 = Stack_D
+    76   Reg_0 = Stack_D
+    76   Reg_0 -= Reg_1
+    76   Stack_D = Reg_0
+    76   no-op
+           optimizes label Label_32
+    76 }
+
+    78 function Sym_39 {
+    79   Reg_0 = Sym_12
+    79   Stack_D = Reg_0
+    79   tail call Sym_25
+           optimizes   call Sym_25
+    79   no-op
+           optimizes label Label_33
+    79 }
+
+    81 function Sym_40 {
+    82   Reg_0 = Sym_38
+    82   Stack_D = Reg_0
+    82   tail call Sym_25
+           optimizes   call Sym_25
+    82   no-op
+           optimizes label Label_34
+    82 }
+
+    84 function Sym_41 {
+    85   Reg_0 = 4
+    85   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    85   Reg_0 = 0
+    85   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    85   no-op
+           optimizes   Reg_1 = Stack_D
+    85   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    85   Stack_R = Reg_0
+    85   Stack_R = Reg_1
+    85 label Label_37
+    85   Reg_0 = 4
+    85   Stack_D = Reg_0
+    85   call Sym_26
+    85   Reg_1 = Stack_R
+    85   Reg_1 += 1
+    85   Reg_0 = Stack_R
+    85   Stack_R = Reg_0
+    85   Stack_R = Reg_1
+    85   Reg_1 -= Reg_0
+    85   if Reg_1 != 0 goto Label_37
+    85   no-op
+           optimizes label Label_38
+    85   Reg_0 = Stack_R
+    85   Reg_0 = Stack_R
+    85   no-op
+           optimizes label Label_36
+    86   call Sym_10
+    86   Reg_0 = 3
+    86   Stack_D = Reg_0
+    86   call Sym_29
+    86   call Sym_8
+    86   no-op
+           optimizes   call Sym_12
+    86   Reg_1 = Stack_D
+    86   Reg_0 = Stack_D
+    86   Reg_0 -= Reg_1
+    86   Stack_D = Reg_0
+    87   call Sym_10
+    87   no-op
+           optimizes   call Sym_32
+    87   Reg_0 = Stack_D
+    87   if Reg_0 >= 0 goto Label_39
+    87   no-op
+           optimizes   Reg_0 = Stack_D
+    87   no-op
+           optimizes   if Reg_0 == 0 goto Label_39
+    88   call Sym_20
+    88   call Sym_21
+    88   call Sym_27
+    88   call Sym_20
+    88   no-op
+           optimizes   call Sym_42
+    88   Reg_0 = 0
+    88   Stack_D = Reg_0
+    88   goto Label_35
+    89 label Label_39
+    90   no-op
+           optimizes   call Sym_36
+    90   Reg_0 = Stack_D
+    90   Reg_0 += 1
+    90   Reg_3 = Reg_0
+           optimizes   Stack_D = Reg_0
+    90   Reg_0 = 0
+    90   Reg_1 = Reg_0
+           optimizes   Stack_D = Reg_0
+    90   no-op
+           optimizes   Reg_1 = Stack_D
+    90   Reg_0 = Reg_3
+           optimizes   Reg_0 = Stack_D
+    90   Stack_R = Reg_0
+    90   Stack_R = Reg_1
+    90 label Label_41
+    91   Reg_0 = 3
+    91   Stack_D = Reg_0
+    91   call Sym_29
+    91   call Sym_18
+    91   no-op
+           optimizes   call Sym_2
+    91   Reg_1 = Stack_D
+    91   Reg_0 = Stack_D
+    91   Reg_0 += Reg_1
+    91   Stack_D = Reg_0
+    91   call Sym_17
+    91   call Sym_43
+    92   Reg_0 = 8
+    92   Stack_D = Reg_0
+    92   call Sym_29
+    92   call Sym_30
+    93   no-op
+           optimizes   call Sym_44
+    93   Reg_0 = Stack_D
+    93   if Reg_0 != 0 goto Label_43
+    93   no-op
+           optimizes   Reg_0 = Stack_D
+    93   no-op
+           optimizes   if Reg_0 == 0 goto Label_43
+    94   call Sym_21
+    94   call Sym_8
+    94   call Sym_18
+    94   no-op
+           optimizes   call Sym_2
+    94   Reg_1 = Stack_D
+    94   Reg_0 = Stack_D
+    94   Reg_0 += Reg_1
+    94   Stack_D = Reg_0
+    94   call Sym_8
+    94   call Sym_18
+    94   no-op
+           optimizes   call Sym_12
+    94   Reg_1 = Stack_D
+    94   Reg_0 = Stack_D
+    94   Reg_0 -= Reg_1
+    94   Stack_D = Reg_0
+    95   call Sym_27
+    95   call Sym_20
+    95   no-op
+           optimizes   call Sym_45
+    95   Reg_0 = -1
+    95   Stack_D = Reg_0
+    95   tail call Sym_34
+           optimizes   call Sym_34
+    95   no-op
+           optimizes   goto Label_35
+    96 label Label_43
+    97   Reg_1 = Stack_R
+    97   Reg_1 += 1
+    97   Reg_0 = Stack_R
+    97   Stack_R = Reg_0
+    97   Stack_R = Reg_1
+    97   Reg_1 -= Reg_0
+    97   if Reg_1 != 0 goto Label_41
+    97   no-op
+           optimizes label Label_42
+    97   Reg_0 = Stack_R
+    97   Reg_0 = Stack_R
+    97   no-op
+           optimizes label Label_40
+    98   call Sym_21
+    98   call Sym_20
+    98   no-op
+           optimizes   call Sym_42
+    98   Reg_0 = 0
+    98   Stack_D = Reg_0
+    98 label Label_35
+    98 }
+
+   100 function Sym_46 {
+   101   Reg_0 = Sym_39
+   101   Stack_D = Reg_0
+   101   tail call Sym_41
+           optimizes   call Sym_41
+   101   no-op
+           optimizes label Label_44
+   101 }
+
+   103 function Sym_47 {
+   104   Reg_0 = Sym_40
+   104   Stack_D = Reg_0
+   104   tail call Sym_41
+           optimizes   call Sym_41
+   104   no-op
+           optimizes label Label_45
+   104 }
+
+   106 function Sym_48 {
+   106   no-op
+           optimizes label Label_46
+   106 }
+
+Peephole rewrites:
+  v4_Minustrailing: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Minustrailing: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Slashstring: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_Slashstring: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_cmove: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_cmove: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_cmove: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4_cmove: redundant-test: test %rdx,%rdx => (none)
+  v4_cmove_Greater: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_cmove_Greater: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_cmove_Greater: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4_cmove_Greater: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4_cmove_Greater: redundant-test: test %rdx,%rdx => (none)
+  v4___Parencompare_Closeparen: exchange-push: xchg %rdx,%rax; call v4__rpush@PLT; xchg %rax,%rdx => mov %rdx,%rax; call v4__rpush@PLT
+  v4___Parencompare_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4___Parencompare_Closeparen: redundant-test: test %rdx,%rdx => (none)
+  v4___Parencompare_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parencompare_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parencompare_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4___Parencompare_Closeparen: redundant-test: test %rdx,%rdx => (none)
+  v4___Parencompare_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parencompare_Closeparen: jump-next: jmp .L18 => (none)
+  v4___Parencidiff_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parensearch_Closeparen: exchange-push: xchg %rdx,%rax; call v4__rpush@PLT; xchg %rax,%rdx => mov %rdx,%rax; call v4__rpush@PLT
+  v4___Parensearch_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4___Parensearch_Closeparen: redundant-test: test %rdx,%rdx => (none)
+  v4___Parensearch_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parensearch_Closeparen: exchange-push: xchg %rdx,%rax; call v4__rpush@PLT; xchg %rax,%rdx => mov %rdx,%rax; call v4__rpush@PLT
+  v4___Parensearch_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parensearch_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parensearch_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__dpop@PLT; xchg %rax,%rdx => call v4__dpop@PLT; mov %rax,%rdx
+  v4___Parensearch_Closeparen: exchange-pop: xchg %rdx,%rax; call v4__rpop@PLT; xchg %rax,%rdx => call v4__rpop@PLT; mov %rax,%rdx
+  v4___Parensearch_Closeparen: redundant-test: test %rdx,%rdx => (none)
+
@@ -0,0 +1,166 @@
+VNPForth 1.5 [build x86_64/20261017101412]
+Source: syscall.ft
+Compiled: Sat Oct 17 10:15:10 2026
+Flags: debug weak PIC x86_64 optimize intermediate assembly
+
+Symbols:
+   220 Sym_8 external "v4_Fetch"
+   215 Sym_6 external "v4_Store"
+   212 Sym_1 variable Cell "v4__errno"
+   213 Sym_2 word "v4__post_syscall"
+    40 Sym_0 codeword "v4__syscall"
+   214 Sym_3 external "v4_dup"
+   219 Sym_7 word "v4_errno"
+   215 Sym_5 external "v4_negate"
+   214 Sym_4 external "v4_within"
+
+Intermediate code:
+    40 function Sym_0 {
+    41   asm (    call v4__dpop@PLT)
+    42   asm (    cmp $7,%rax)
+    43   asm (    jb 9f)
+    44   asm (    mov $-24,%rax)
+    45   asm (    call v4__dpush@PLT)
+    46   asm (    call v4_throw@PLT)
+    48   asm (9:)
+    49   asm (    mov %rax,%rbx)
+    51   asm (    call v4__dpop@PLT)
+    52   asm (    mov $-1,%rcx)
+    53   asm (    cmp $(.L_syscalls_end-.L_syscalls)/2,%rax)
+    54   asm (    jae 8f)
+    55   asm (    lea .L_syscalls(%rip),%rcx)
+    56   asm (    movswq (%rcx,%rax,2),%rcx)
+    57   asm (8:)
+    58   asm (    push %rcx)
+    60   asm (    mov %rbx,%rcx)
+    61   asm (    jrcxz 7f)
+    62   asm (8:)
+    63   asm (    call v4__dpop@PLT)
+    64   asm (    push %rax)
+    65   asm (    loop 8b)
+    66   asm (7:)
+    68   asm (    cmp $6,%rbx)
+    69   asm (    jb 6f)
+    70   asm (    pop %r9)
+    71   asm (6:  cmp $5,%rbx)
+    72   asm (    jb 5f)
+    73   asm (    pop %r8)
+    74   asm (5:  cmp $4,%rbx)
+    75   asm (    jb 4f)
+    76   asm (    pop %r10)
+    77   asm (4:  cmp $3,%rbx)
+    78   asm (    jb 3f)
+    79   asm (    pop %rdx)
+    80   asm (3:  cmp $2,%rbx)
+    81   asm (    jb 2f)
+    82   asm (    pop %rsi)
+    83   asm (2:  cmp $1,%rbx)
+    84   asm (    jb 1f)
+    85   asm (    pop %rdi)
+    86   asm (1:)
+    88   asm (    pop %rax)
+    89   asm (    test %rax,%rax)
+    90   asm (    js 7f)
+    91   asm (    syscall)
+    92   asm (    jmp 6f)
+    93   asm (7:)
+    94   asm (    mov $-38,%rax)
+    95   asm (6:)
+    97   asm (    call v4__dpush@PLT)
+    99   asm (    .section .rodata)
+   100   asm (    .L_syscalls:)
+   101   asm (    .short 219,60,57,0,1,2,3,61,85,86)
+   102   asm (    .short 87,59,80,201,133,90,94,-1,-1,8)
+   103   asm (    .short 39,165,166,105,102,-1,101,37,-1,34)
+   104   asm (    .short 132,-1,-1,21,-1,-1,162,62,82,83)
+   105   asm (    .short 84,32,22,100,-1,12,106,104,-1,107)
+   106   asm (    .short 108,163,166,-1,16,72,-1,109,-1,-1)
+   107   asm (    .short 95,161,136,33,110,111,112,-1,-1,-1)
+   108   asm (    .short 113,114,-1,-1,170,160,97,98,96,164)
+   109   asm (    .short 115,116,-1,88,-1,89,134,167,169,-1)
+   110   asm (    .short -1,11,76,77,91,93,140,141,-1,137)
+   111   asm (    .short 138,173,-1,103,38,36,4,6,5,-1)
+   112   asm (    .short 172,153,-1,-1,61,168,99,-1,74,-1)
+   113   asm (    .short 56,171,63,154,159,10,-1,174,175,176)
+   114   asm (    .short 177,179,121,81,-1,139,135,183,122,123)
+   115   asm (    .short -1,78,23,73,26,19,20,124,75,156)
+   116   asm (    .short 149,150,151,152,142,143,144,145,24,146)
+   117   asm (    .short 147,148,35,25,117,118,-1,178,7,180)
+   118   asm (    .short 119,120,157,15,13,14,127,128,129,130)
+   119   asm (    .short 17,18,92,79,125,126,131,40,181,182)
+   120   asm (    .short 58,97,-1,76,77,4,6,5,94,102)
+   121   asm (    .short 104,107,108,113,114,115,116,93,117,118)
+   122   asm (    .short 119,120,92,105,106,122,123,155,27,28)
+   123   asm (    .short 217,72,-1,-1,186,-1,188,189,190,191)
+   124   asm (    .short 192,193,194,195,196,197,198,199,200,40)
+   125   asm (    .short 202,203,204,205,211,206,207,208,209,210)
+   126   asm (    .short -1,-1,231,212,213,233,232,216,218,222)
+   127   asm (    .short 223,224,225,226,227,228,229,230,-1,-1)
+   128   asm (    .short 234,235,-1,236,237,239,238,240,241,242)
+   129   asm (    .short 243,244,245,246,247,-1,248,249,250,251)
+   130   asm (    .short 252,253,254,255,256,257,258,259,260,261)
+   131   asm (    .short 262,263,264,265,266,267,268,269,270,271)
+   132   asm (    .short 272,273,274,275,-1,276,278,279,309,281)
+   133   asm (    .short 280,282,283,284,-1,286,287,289,290,291)
+   134   asm (    .short 292,293,294,295,296,297,298,299,300,301)
+   135   asm (    .short 302,303,304,305,306,307,308,310,311,312)
+   136   asm (    .short 313,314,315,316,317,318,319,321,322,41)
+   137   asm (    .short 53,49,42,50,288,55,54,51,52,44)
+   138   asm (    .short 46,45,47,48,323,324,325,326,327,328)
+   139   asm (    .short 329,330,331,332,158,333,334,-1,-1,-1)
+   140   asm (    .short -1,-1,-1,64,66,29,31,30,67,68)
+   141   asm (    .short 69,70,71,228,227,305,229,230,224,223)
+   142   asm (    .short 287,286,280,270,271,-1,333,299,242,243)
+   143   asm (    .short 220,128,202,148,424,425,426,427,428,429)
+   144   asm (    .short 430,431,432,433,434,435,436,437,438,439)
+   145   asm (    .short 440,441,442,443,444,445,446,447,448,449)
+   146   asm (    .short 450)
+   147   asm (    .L_syscalls_end:)
+   148   asm (    .text)
+   150   asm (    forth_pic.=0b-0b)
+   151 }
+
+   213 function Sym_2 {
+   214   call Sym_3
+   214   Reg_0 = -125
+   214   Stack_D = Reg_0
+   214   Reg_0 = -1
+   214   Stack_D = Reg_0
+   214   call Sym_4
+   214   Reg_0 = Stack_D
+   214   if Reg_0 == 0 goto Label_2
+   215   no-op
+           optimizes   call Sym_5
+   215   Reg_0 = Stack_D
+   215   Reg_0 = -Reg_0
+   215   no-op
+           optimizes   Stack_D = Reg_0
+   215   no-op
+           optimizes   Reg_0 = Sym_1
+   215   no-op
+           optimizes   Stack_D = Reg_0
+   215   no-op
+           optimizes   call Sym_6
+   215   no-op
+           optimizes   Reg_0 = Stack_D
+   215   *(Sym_1) = Reg_0
+   216   Reg_0 = -1
+   216   Stack_D = Reg_0
+   217 label Label_2
+   217   no-op
+           optimizes label Label_1
+   217 }
+
+   219 function Sym_7 {
+   220   no-op
+           optimizes   Reg_0 = Sym_1
+   220   no-op
+           optimizes   Stack_D = Reg_0
+   220   no-op
+           optimizes   call Sym_8
+   220   Reg_0 = *(Sym_1)
+   220   Stack_D = Reg_0
+   220   no-op
+           optimizes label Label_3
+   220 }
+
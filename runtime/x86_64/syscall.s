@@ -0,0 +1,227 @@
+	.file	"syscall.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"syscall.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.stabs	"v4__errno:G2",40,0,0,v4__errno
+	.comm  v4__errno,8,8
+.text
+	.align 4
+.stabs "v4__syscall:F1",36,0,0,v4__syscall
+	.weak v4__syscall
+	.type	v4__syscall,@function
+v4__syscall:
+.stabn 68,0,40,.LMa0-v4__syscall
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	push %rdi
+	push %rsi
+0:
+.stabn 68,0,40,.LMb0-v4__syscall
+.LMb0:
+.LBB0:
+#APP
+    call v4__dpop@PLT
+    cmp $7,%rax
+    jb 9f
+    mov $-24,%rax
+    call v4__dpush@PLT
+    call v4_throw@PLT
+9:
+    mov %rax,%rbx
+    call v4__dpop@PLT
+    mov $-1,%rcx
+    cmp $(.L_syscalls_end-.L_syscalls)/2,%rax
+    jae 8f
+    lea .L_syscalls(%rip),%rcx
+    movswq (%rcx,%rax,2),%rcx
+8:
+    push %rcx
+    mov %rbx,%rcx
+    jrcxz 7f
+8:
+    call v4__dpop@PLT
+    push %rax
+    loop 8b
+7:
+    cmp $6,%rbx
+    jb 6f
+    pop %r9
+6:  cmp $5,%rbx
+    jb 5f
+    pop %r8
+5:  cmp $4,%rbx
+    jb 4f
+    pop %r10
+4:  cmp $3,%rbx
+    jb 3f
+    pop %rdx
+3:  cmp $2,%rbx
+    jb 2f
+    pop %rsi
+2:  cmp $1,%rbx
+    jb 1f
+    pop %rdi
+1:
+    pop %rax
+    test %rax,%rax
+    js 7f
+    syscall
+    jmp 6f
+7:
+    mov $-38,%rax
+6:
+    call v4__dpush@PLT
+    .section .rodata
+    .L_syscalls:
+    .short 219,60,57,0,1,2,3,61,85,86
+    .short 87,59,80,201,133,90,94,-1,-1,8
+    .short 39,165,166,105,102,-1,101,37,-1,34
+    .short 132,-1,-1,21,-1,-1,162,62,82,83
+    .short 84,32,22,100,-1,12,106,104,-1,107
+    .short 108,163,166,-1,16,72,-1,109,-1,-1
+    .short 95,161,136,33,110,111,112,-1,-1,-1
+    .short 113,114,-1,-1,170,160,97,98,96,164
+    .short 115,116,-1,88,-1,89,134,167,169,-1
+    .short -1,11,76,77,91,93,140,141,-1,137
+    .short 138,173,-1,103,38,36,4,6,5,-1
+    .short 172,153,-1,-1,61,168,99,-1,74,-1
+    .short 56,171,63,154,159,10,-1,174,175,176
+    .short 177,179,121,81,-1,139,135,183,122,123
+    .short -1,78,23,73,26,19,20,124,75,156
+    .short 149,150,151,152,142,143,144,145,24,146
+    .short 147,148,35,25,117,118,-1,178,7,180
+    .short 119,120,157,15,13,14,127,128,129,130
+    .short 17,18,92,79,125,126,131,40,181,182
+    .short 58,97,-1,76,77,4,6,5,94,102
+    .short 104,107,108,113,114,115,116,93,117,118
+    .short 119,120,92,105,106,122,123,155,27,28
+    .short 217,72,-1,-1,186,-1,188,189,190,191
+    .short 192,193,194,195,196,197,198,199,200,40
+    .short 202,203,204,205,211,206,207,208,209,210
+    .short -1,-1,231,212,213,233,232,216,218,222
+    .short 223,224,225,226,227,228,229,230,-1,-1
+    .short 234,235,-1,236,237,239,238,240,241,242
+    .short 243,244,245,246,247,-1,248,249,250,251
+    .short 252,253,254,255,256,257,258,259,260,261
+    .short 262,263,264,265,266,267,268,269,270,271
+    .short 272,273,274,275,-1,276,278,279,309,281
+    .short 280,282,283,284,-1,286,287,289,290,291
+    .short 292,293,294,295,296,297,298,299,300,301
+    .short 302,303,304,305,306,307,308,310,311,312
+    .short 313,314,315,316,317,318,319,321,322,41
+    .short 53,49,42,50,288,55,54,51,52,44
+    .short 46,45,47,48,323,324,325,326,327,328
+    .short 329,330,331,332,158,333,334,-1,-1,-1
+    .short -1,-1,-1,64,66,29,31,30,67,68
+    .short 69,70,71,228,227,305,229,230,224,223
+    .short 287,286,280,270,271,-1,333,299,242,243
+    .short 220,128,202,148,424,425,426,427,428,429
+    .short 430,431,432,433,434,435,436,437,438,439
+    .short 440,441,442,443,444,445,446,447,448,449
+    .short 450
+    .L_syscalls_end:
+    .text
+    forth_pic.=0b-0b
+#NO_APP
+.LBE0:
+.stabn 68,0,151,.LM103-v4__syscall
+.LM103:
+	pop %rsi
+	pop %rdi
+	pop %rbx
+	leave
+	ret
+.Lfe0:
+	.size	 v4__syscall,.Lfe0-v4__syscall
+.stabn	192,0,0,.LBB0-v4__syscall
+.stabn	224,0,0,.LBE0-v4__syscall
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4__syscall
+.text
+	.align 4
+.stabs "v4__post_syscall:F1",36,0,0,v4__post_syscall
+	.weak v4__post_syscall
+	.type	v4__post_syscall,@function
+v4__post_syscall:
+.stabn 68,0,213,.LMa104-v4__post_syscall
+.LMa104:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,213,.LMb104-v4__post_syscall
+.LMb104:
+.LBB2:
+.stabn 68,0,214,.LM105-v4__post_syscall
+.LM105:
+	call v4_dup@PLT
+	mov $-125,%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	je .L2
+	call v4__dpop@PLT
+	neg %rax
+	mov v4__errno@GOTPCREL(%rip),%r11
+	mov %rax,(%r11)
+.stabn 68,0,216,.LM122-v4__post_syscall
+.LM122:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush@PLT
+.L2:
+.LBE2:
+.stabn 68,0,217,.LM126-v4__post_syscall
+.LM126:
+	pop %rbx
+	leave
+	ret
+.Lfe2:
+	.size	 v4__post_syscall,.Lfe2-v4__post_syscall
+.stabn	192,0,0,.LBB2-v4__post_syscall
+.stabn	224,0,0,.LBE2-v4__post_syscall
+.Lscope2:
+.stabs	"",36,0,0,.Lscope2-v4__post_syscall
+.text
+	.align 4
+.stabs "v4_errno:F1",36,0,0,v4_errno
+	.weak v4_errno
+	.type	v4_errno,@function
+v4_errno:
+.stabn 68,0,219,.LMa127-v4_errno
+.LMa127:
+0:
+.stabn 68,0,219,.LMb127-v4_errno
+.LMb127:
+.LBB7:
+	mov v4__errno@GOTPCREL(%rip),%rax
+	mov (%rax),%rax
+	call v4__dpush@PLT
+.LBE7:
+.stabn 68,0,220,.LM134-v4_errno
+.LM134:
+	ret
+.Lfe7:
+	.size	 v4_errno,.Lfe7-v4_errno
+.stabn	192,0,0,.LBB7-v4_errno
+.stabn	224,0,0,.LBE7-v4_errno
+.Lscope7:
+.stabs	"",36,0,0,.Lscope7-v4_errno
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"
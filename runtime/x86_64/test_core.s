@@ -0,0 +1,14005 @@
+	.file	"test_core.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"test_core.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC32:
+	.string "  SIGNED: "
+.LC18:
+	.string "--"
+.LC19:
+	.string "01"
+.LC20:
+	.string "1"
+.LC21:
+	.string "10"
+.LC17:
+	.string "BA"
+.LC29:
+	.string "LINE 1"
+.LC30:
+	.string "LINE 2"
+.LC35:
+	.string "PLEASE TYPE UP TO 80 CHARACTERS:"
+.LC36:
+	.string "RECEIVED: "
+.LC13:
+	.string "TESTING ' ['] FIND EXECUTE IMMEDIATE COUNT LITERAL POSTPONE STATE"
+.LC2:
+	.string "TESTING 2* 2/ LSHIFT RSHIFT"
+.LC16:
+	.string "TESTING <# # #S #> HOLD SIGN BASE >NUMBER HEX DECIMAL"
+.LC6:
+	.string "TESTING >R R> R@"
+.LC7:
+	.string "TESTING ADD/SUBTRACT: + - 1+ 1- ABS NEGATE"
+.LC1:
+	.string "TESTING BOOLEANS: INVERT AND OR XOR"
+.LC4:
+	.string "TESTING CELL WIDTH LITERALS"
+.LC11:
+	.string "TESTING CHAR [CHAR] [ ] BL S_quotes"
+.LC3:
+	.string "TESTING COMPARISONS: 0= = 0< < > U< U> U<= U>= MIN MAX"
+.LC0:
+	.string "TESTING CORE WORDS"
+.LC9:
+	.string "TESTING DIVIDE: FM/MOD SM/REM UM/MOD */ */MOD / /MOD MOD"
+.LC15:
+	.string "TESTING DO LOOP +LOOP I J UNLOOP LEAVE EXIT"
+.LC22:
+	.string "TESTING FILL MOVE"
+.LC10:
+	.string "TESTING HERE , @ ! CELL+ CELLS C, C@ C! CHARS 2@ 2! ALIGN ALIGNED +! ALLOT"
+.LC14:
+	.string "TESTING IF ELSE THEN BEGIN WHILE REPEAT UNTIL RECURSE"
+.LC34:
+	.string "TESTING INPUT: ACCEPT"
+.LC8:
+	.string "TESTING MULTIPLY: S>D * M* UM*"
+.LC23:
+	.string "TESTING OUTPUT: . ._quote CR EMIT SPACE SPACES TYPE U."
+.LC5:
+	.string "TESTING STACK OPS: 2DROP 2DUP 2OVER 2SWAP ?DUP DEPTH DROP DUP OVER ROT SWAP"
+.LC33:
+	.string "UNSIGNED: "
+.LC12:
+	.string "XY"
+.LC27:
+	.string "YOU SHOULD SEE 0-5 SEPARATED BY TWO SPACES:"
+.LC25:
+	.string "YOU SHOULD SEE 0-9 (WITH NO SPACES):"
+.LC24:
+	.string "YOU SHOULD SEE 0-9 SEPARATED BY A SPACE:"
+.LC26:
+	.string "YOU SHOULD SEE A-G SEPARATED BY A SPACE:"
+.LC31:
+	.string "YOU SHOULD SEE THE NUMBER RANGES OF SIGNED AND UNSIGNED NUMBERS:"
+.LC28:
+	.string "YOU SHOULD SEE TWO SEPARATE LINES:"
+.stabs	"v4_Hashbits_Minusud:G2",40,0,0,v4_Hashbits_Minusud
+	.comm  v4_Hashbits_Minusud,8,8
+.stabs	"v4_Lessfalse_Greater:G2",40,0,0,v4_Lessfalse_Greater
+	.comm  v4_Lessfalse_Greater,8,8
+.stabs	"v4_Lesstrue_Greater:G2",40,0,0,v4_Lesstrue_Greater
+	.comm  v4_Lesstrue_Greater,8,8
+.stabs	"v4_abuf:Gar2;0;79;4",40,0,0,v4_abuf
+	.comm  v4_abuf,80,32
+.stabs	"v4_fbuf:Gar2;0;2;4",40,0,0,v4_fbuf
+	.comm  v4_fbuf,3,1
+.stabs	"v4_gn_Minusbuf:Gar2;0;9;4",40,0,0,v4_gn_Minusbuf
+	.comm  v4_gn_Minusbuf,10,1
+.stabs	"v4_hbuf:Gar2;0;255;4",40,0,0,v4_hbuf
+	.comm  v4_hbuf,256,32
+.stabs	"v4_max_Minusbase:G2",40,0,0,v4_max_Minusbase
+	.comm  v4_max_Minusbase,8,8
+.stabs	"v4_max_Minusint:G2",40,0,0,v4_max_Minusint
+	.comm  v4_max_Minusint,8,8
+.stabs	"v4_max_Minusuint:G2",40,0,0,v4_max_Minusuint
+	.comm  v4_max_Minusuint,8,8
+.stabs	"v4_mid_Minusuint:G2",40,0,0,v4_mid_Minusuint
+	.comm  v4_mid_Minusuint,8,8
+.stabs	"v4_mid_Minusuint_Plus1:G2",40,0,0,v4_mid_Minusuint_Plus1
+	.comm  v4_mid_Minusuint_Plus1,8,8
+.stabs	"v4_min_Minusint:G2",40,0,0,v4_min_Minusint
+	.comm  v4_min_Minusint,8,8
+.stabs	"v4_msb:G2",40,0,0,v4_msb
+	.comm  v4_msb,8,8
+.stabs	"v4_sbuf:Gar2;0;2;4",40,0,0,v4_sbuf
+	.comm  v4_sbuf,3,1
+.stabs	"v4_x:G2",40,0,0,v4_x
+	.comm  v4_x,8,8
+.stabs	"v4_z0s:G2",40,0,0,v4_z0s
+	.comm  v4_z0s,8,8
+.stabs	"v4_z1s:G2",40,0,0,v4_z1s
+	.comm  v4_z1s,8,8
+.stabs	"v4_z1st:G2",40,0,0,v4_z1st
+	.comm  v4_z1st,8,8
+.stabs	"v4_z1stc:G2",40,0,0,v4_z1stc
+	.comm  v4_z1stc,8,8
+.stabs	"v4_z2nd:G2",40,0,0,v4_z2nd
+	.comm  v4_z2nd,8,8
+.stabs	"v4_z2ndc:G2",40,0,0,v4_z2ndc
+	.comm  v4_z2ndc,8,8
+.text
+	.align 4
+.stabs "v4_find_Minusmsb:F1",36,0,0,v4_find_Minusmsb
+.globl v4_find_Minusmsb
+	.type	v4_find_Minusmsb,@function
+v4_find_Minusmsb:
+.stabn 68,0,53,.LMa0-v4_find_Minusmsb
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,53,.LMb0-v4_find_Minusmsb
+.LMb0:
+.LBB15:
+.stabn 68,0,54,.LM1-v4_find_Minusmsb
+.LM1:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.L2:
+	call v4_dup
+	call v4__dpop
+	add %rax,%rax
+	je .L3
+	call v4__dpop
+	add %rax,%rax
+	call v4__dpush
+	jmp .L2
+.L3:
+.LBE15:
+.stabn 68,0,54,.LM18-v4_find_Minusmsb
+.LM18:
+	pop %rbx
+	leave
+	ret
+.Lfe15:
+	.size	 v4_find_Minusmsb,.Lfe15-v4_find_Minusmsb
+.stabn	192,0,0,.LBB15-v4_find_Minusmsb
+.stabn	224,0,0,.LBE15-v4_find_Minusmsb
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4_find_Minusmsb
+.text
+	.align 4
+.stabs "v4_gr1:F1",36,0,0,v4_gr1
+.globl v4_gr1
+	.type	v4_gr1,@function
+v4_gr1:
+.stabn 68,0,262,.LMa19-v4_gr1
+.LMa19:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,262,.LMb19-v4_gr1
+.LMb19:
+.LBB55:
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	mov -16(%rbp),%rax
+	call v4__dpush
+.LBE55:
+.stabn 68,0,262,.LM27-v4_gr1
+.LM27:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe55:
+	.size	 v4_gr1,.Lfe55-v4_gr1
+.stabn	192,0,0,.LBB55-v4_gr1
+.stabn	224,0,0,.LBE55-v4_gr1
+.Lscope55:
+.stabs	"",36,0,0,.Lscope55-v4_gr1
+.text
+	.align 4
+.stabs "v4_gr2:F1",36,0,0,v4_gr2
+.globl v4_gr2
+	.type	v4_gr2,@function
+v4_gr2:
+.stabn 68,0,263,.LMa28-v4_gr2
+.LMa28:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,263,.LMb28-v4_gr2
+.LMb28:
+.LBB58:
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	mov -16(%rbp),%rax
+	call v4__dpush
+	mov -16(%rbp),%rax
+	call v4__dpush
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE58:
+.stabn 68,0,263,.LM40-v4_gr2
+.LM40:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe58:
+	.size	 v4_gr2,.Lfe58-v4_gr2
+.stabn	192,0,0,.LBB58-v4_gr2
+.stabn	224,0,0,.LBE58-v4_gr2
+.Lscope58:
+.stabs	"",36,0,0,.Lscope58-v4_gr2
+.text
+	.align 4
+.stabs "v4_t_Slashmod:F1",36,0,0,v4_t_Slashmod
+.globl v4_t_Slashmod
+	.type	v4_t_Slashmod,@function
+v4_t_Slashmod:
+.stabn 68,0,459,.LMa41-v4_t_Slashmod
+.LMa41:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,459,.LMb41-v4_t_Slashmod
+.LMb41:
+.LBB70:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	pop %rbx
+	leave
+	jmp v4_sm_Slashrem
+.LBE70:
+.stabn 68,0,459,.LM47-v4_t_Slashmod
+.LM47:
+	pop %rbx
+	leave
+	ret
+.Lfe70:
+	.size	 v4_t_Slashmod,.Lfe70-v4_t_Slashmod
+.stabn	192,0,0,.LBB70-v4_t_Slashmod
+.stabn	224,0,0,.LBE70-v4_t_Slashmod
+.Lscope70:
+.stabs	"",36,0,0,.Lscope70-v4_t_Slashmod
+.text
+	.align 4
+.stabs "v4_t_Slash:F1",36,0,0,v4_t_Slash
+.globl v4_t_Slash
+	.type	v4_t_Slash,@function
+v4_t_Slash:
+.stabn 68,0,460,.LMa48-v4_t_Slash
+.LMa48:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,460,.LMb48-v4_t_Slash
+.LMb48:
+.LBB71:
+.stabn 68,0,459,.LM50-v4_t_Slash
+.LM50:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM54-v4_t_Slash
+.LM54:
+	call v4_swap
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE71:
+.stabn 68,0,460,.LM57-v4_t_Slash
+.LM57:
+	pop %rbx
+	leave
+	ret
+.Lfe71:
+	.size	 v4_t_Slash,.Lfe71-v4_t_Slash
+.stabn	192,0,0,.LBB71-v4_t_Slash
+.stabn	224,0,0,.LBE71-v4_t_Slash
+.Lscope71:
+.stabs	"",36,0,0,.Lscope71-v4_t_Slash
+.text
+	.align 4
+.stabs "v4_tmod:F1",36,0,0,v4_tmod
+.globl v4_tmod
+	.type	v4_tmod,@function
+v4_tmod:
+.stabn 68,0,461,.LMa58-v4_tmod
+.LMa58:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,461,.LMb58-v4_tmod
+.LMb58:
+.LBB72:
+.stabn 68,0,459,.LM60-v4_tmod
+.LM60:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM64-v4_tmod
+.LM64:
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE72:
+.stabn 68,0,461,.LM66-v4_tmod
+.LM66:
+	pop %rbx
+	leave
+	ret
+.Lfe72:
+	.size	 v4_tmod,.Lfe72-v4_tmod
+.stabn	192,0,0,.LBB72-v4_tmod
+.stabn	224,0,0,.LBE72-v4_tmod
+.Lscope72:
+.stabs	"",36,0,0,.Lscope72-v4_tmod
+.text
+	.align 4
+.stabs "v4_t_Star_Slashmod:F1",36,0,0,v4_t_Star_Slashmod
+.globl v4_t_Star_Slashmod
+	.type	v4_t_Star_Slashmod,@function
+v4_t_Star_Slashmod:
+.stabn 68,0,462,.LMa67-v4_t_Star_Slashmod
+.LMa67:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,462,.LMb67-v4_t_Star_Slashmod
+.LMb67:
+.LBB73:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	pop %rbx
+	leave
+	jmp v4_sm_Slashrem
+.LBE73:
+.stabn 68,0,462,.LM73-v4_t_Star_Slashmod
+.LM73:
+	pop %rbx
+	leave
+	ret
+.Lfe73:
+	.size	 v4_t_Star_Slashmod,.Lfe73-v4_t_Star_Slashmod
+.stabn	192,0,0,.LBB73-v4_t_Star_Slashmod
+.stabn	224,0,0,.LBE73-v4_t_Star_Slashmod
+.Lscope73:
+.stabs	"",36,0,0,.Lscope73-v4_t_Star_Slashmod
+.text
+	.align 4
+.stabs "v4_t_Star_Slash:F1",36,0,0,v4_t_Star_Slash
+.globl v4_t_Star_Slash
+	.type	v4_t_Star_Slash,@function
+v4_t_Star_Slash:
+.stabn 68,0,463,.LMa74-v4_t_Star_Slash
+.LMa74:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,463,.LMb74-v4_t_Star_Slash
+.LMb74:
+.LBB74:
+.stabn 68,0,462,.LM76-v4_t_Star_Slash
+.LM76:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM80-v4_t_Star_Slash
+.LM80:
+	call v4_swap
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE74:
+.stabn 68,0,463,.LM83-v4_t_Star_Slash
+.LM83:
+	pop %rbx
+	leave
+	ret
+.Lfe74:
+	.size	 v4_t_Star_Slash,.Lfe74-v4_t_Star_Slash
+.stabn	192,0,0,.LBB74-v4_t_Star_Slash
+.stabn	224,0,0,.LBE74-v4_t_Star_Slash
+.Lscope74:
+.stabs	"",36,0,0,.Lscope74-v4_t_Star_Slash
+.text
+	.align 4
+.stabs "v4_gc1:F1",36,0,0,v4_gc1
+.globl v4_gc1
+	.type	v4_gc1,@function
+v4_gc1:
+.stabn 68,0,633,.LMa84-v4_gc1
+.LMa84:
+.stabn 68,0,633,.LMb84-v4_gc1
+.LMb84:
+.LBB102:
+	mov $88,%rax
+	call v4__dpush
+.LBE102:
+.stabn 68,0,633,.LM88-v4_gc1
+.LM88:
+	ret
+.Lfe102:
+	.size	 v4_gc1,.Lfe102-v4_gc1
+.stabn	192,0,0,.LBB102-v4_gc1
+.stabn	224,0,0,.LBE102-v4_gc1
+.Lscope102:
+.stabs	"",36,0,0,.Lscope102-v4_gc1
+.text
+	.align 4
+.stabs "v4_gc2:F1",36,0,0,v4_gc2
+.globl v4_gc2
+	.type	v4_gc2,@function
+v4_gc2:
+.stabn 68,0,634,.LMa89-v4_gc2
+.LMa89:
+.stabn 68,0,634,.LMb89-v4_gc2
+.LMb89:
+.LBB103:
+	mov $72,%rax
+	call v4__dpush
+.LBE103:
+.stabn 68,0,634,.LM93-v4_gc2
+.LM93:
+	ret
+.Lfe103:
+	.size	 v4_gc2,.Lfe103-v4_gc2
+.stabn	192,0,0,.LBB103-v4_gc2
+.stabn	224,0,0,.LBE103-v4_gc2
+.Lscope103:
+.stabs	"",36,0,0,.Lscope103-v4_gc2
+.text
+	.align 4
+.stabs "v4_gc3:F1",36,0,0,v4_gc3
+.globl v4_gc3
+	.type	v4_gc3,@function
+v4_gc3:
+.stabn 68,0,637,.LMa94-v4_gc3
+.LMa94:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,637,.LMb94-v4_gc3
+.LMb94:
+.LBB104:
+	call v4_Leftbracket
+.stabn 68,0,633,.LM97-v4_gc3
+.LM97:
+	mov $88,%rax
+	call v4__dpush
+.stabn 68,0,637,.LM99-v4_gc3
+.LM99:
+	call v4_Rightbracket
+	pop %rbx
+	leave
+	jmp v4_literal
+.LBE104:
+.stabn 68,0,637,.LM102-v4_gc3
+.LM102:
+	pop %rbx
+	leave
+	ret
+.Lfe104:
+	.size	 v4_gc3,.Lfe104-v4_gc3
+.stabn	192,0,0,.LBB104-v4_gc3
+.stabn	224,0,0,.LBE104-v4_gc3
+.Lscope104:
+.stabs	"",36,0,0,.Lscope104-v4_gc3
+.text
+	.align 4
+.stabs "v4_gc4:F1",36,0,0,v4_gc4
+.globl v4_gc4
+	.type	v4_gc4,@function
+v4_gc4:
+.stabn 68,0,639,.LMa103-v4_gc4
+.LMa103:
+.stabn 68,0,639,.LMb103-v4_gc4
+.LMb103:
+.LBB108:
+	lea .LC12(%rip),%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+.LBE108:
+.stabn 68,0,639,.LM109-v4_gc4
+.LM109:
+	ret
+.Lfe108:
+	.size	 v4_gc4,.Lfe108-v4_gc4
+.stabn	192,0,0,.LBB108-v4_gc4
+.stabn	224,0,0,.LBE108-v4_gc4
+.Lscope108:
+.stabs	"",36,0,0,.Lscope108-v4_gc4
+.text
+	.align 4
+.stabs "v4_gt1:F1",36,0,0,v4_gt1
+.globl v4_gt1
+	.type	v4_gt1,@function
+v4_gt1:
+.stabn 68,0,646,.LMa110-v4_gt1
+.LMa110:
+.stabn 68,0,646,.LMb110-v4_gt1
+.LMb110:
+.LBB109:
+	mov $123,%rax
+	call v4__dpush
+.LBE109:
+.stabn 68,0,646,.LM114-v4_gt1
+.LM114:
+	ret
+.Lfe109:
+	.size	 v4_gt1,.Lfe109-v4_gt1
+.stabn	192,0,0,.LBB109-v4_gt1
+.stabn	224,0,0,.LBE109-v4_gt1
+.Lscope109:
+.stabs	"",36,0,0,.Lscope109-v4_gt1
+.text
+	.align 4
+.stabs "v4_gt2:F1",36,0,0,v4_gt2
+.globl v4_gt2
+	.type	v4_gt2,@function
+v4_gt2:
+.stabn 68,0,648,.LMa115-v4_gt2
+.LMa115:
+.stabn 68,0,648,.LMb115-v4_gt2
+.LMb115:
+.LBB110:
+	lea v4_gt1(%rip),%rax
+	call v4__dpush
+.LBE110:
+.stabn 68,0,648,.LM119-v4_gt2
+.LM119:
+	ret
+.Lfe110:
+	.size	 v4_gt2,.Lfe110-v4_gt2
+.stabn	192,0,0,.LBB110-v4_gt2
+.stabn	224,0,0,.LBE110-v4_gt2
+.Lscope110:
+.stabs	"",36,0,0,.Lscope110-v4_gt2
+.text
+	.align 4
+.stabs "v4_gt8:F1",36,0,0,v4_gt8
+.globl v4_gt8
+	.type	v4_gt8,@function
+v4_gt8:
+.stabn 68,0,666,.LMa120-v4_gt8
+.LMa120:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,666,.LMb120-v4_gt8
+.LMb120:
+.LBB112:
+	call v4_state
+	pop %rbx
+	leave
+	jmp v4_Fetch
+.LBE112:
+.stabn 68,0,666,.LM124-v4_gt8
+.LM124:
+	pop %rbx
+	leave
+	ret
+.Lfe112:
+	.size	 v4_gt8,.Lfe112-v4_gt8
+.stabn	192,0,0,.LBB112-v4_gt8
+.stabn	224,0,0,.LBE112-v4_gt8
+.Lscope112:
+.stabs	"",36,0,0,.Lscope112-v4_gt8
+.text
+	.align 4
+.stabs "v4_gt9:F1",36,0,0,v4_gt9
+.globl v4_gt9
+	.type	v4_gt9,@function
+v4_gt9:
+.stabn 68,0,668,.LMa125-v4_gt9
+.LMa125:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,668,.LMb125-v4_gt9
+.LMb125:
+.LBB114:
+	lea v4_gt8(%rip),%rax
+	call v4__dpush
+	pop %rbx
+	leave
+	jmp v4_literal
+.LBE114:
+.stabn 68,0,668,.LM130-v4_gt9
+.LM130:
+	pop %rbx
+	leave
+	ret
+.Lfe114:
+	.size	 v4_gt9,.Lfe114-v4_gt9
+.stabn	192,0,0,.LBB114-v4_gt9
+.stabn	224,0,0,.LBE114-v4_gt9
+.Lscope114:
+.stabs	"",36,0,0,.Lscope114-v4_gt9
+.text
+	.align 4
+.stabs "v4_gi1:F1",36,0,0,v4_gi1
+.globl v4_gi1
+	.type	v4_gi1,@function
+v4_gi1:
+.stabn 68,0,674,.LMa131-v4_gi1
+.LMa131:
+.stabn 68,0,674,.LMb131-v4_gi1
+.LMb131:
+.LBB115:
+	call v4__dpop
+	test %rax,%rax
+	je .L20
+	mov $123,%rax
+	call v4__dpush
+.L20:
+.LBE115:
+.stabn 68,0,674,.LM138-v4_gi1
+.LM138:
+	ret
+.Lfe115:
+	.size	 v4_gi1,.Lfe115-v4_gi1
+.stabn	192,0,0,.LBB115-v4_gi1
+.stabn	224,0,0,.LBE115-v4_gi1
+.Lscope115:
+.stabs	"",36,0,0,.Lscope115-v4_gi1
+.text
+	.align 4
+.stabs "v4_gi2:F1",36,0,0,v4_gi2
+.globl v4_gi2
+	.type	v4_gi2,@function
+v4_gi2:
+.stabn 68,0,675,.LMa139-v4_gi2
+.LMa139:
+.stabn 68,0,675,.LMb139-v4_gi2
+.LMb139:
+.LBB116:
+	call v4__dpop
+	test %rax,%rax
+	je .L22
+	mov $123,%rax
+	call v4__dpush
+	jmp .L23
+.L22:
+	mov $234,%rax
+	call v4__dpush
+.L23:
+.LBE116:
+.stabn 68,0,675,.LM150-v4_gi2
+.LM150:
+	ret
+.Lfe116:
+	.size	 v4_gi2,.Lfe116-v4_gi2
+.stabn	192,0,0,.LBB116-v4_gi2
+.stabn	224,0,0,.LBE116-v4_gi2
+.Lscope116:
+.stabs	"",36,0,0,.Lscope116-v4_gi2
+.text
+	.align 4
+.stabs "v4_gi3:F1",36,0,0,v4_gi3
+.globl v4_gi3
+	.type	v4_gi3,@function
+v4_gi3:
+.stabn 68,0,683,.LMa151-v4_gi3
+.LMa151:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,683,.LMb151-v4_gi3
+.LMb151:
+.LBB117:
+.L25:
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L26
+	call v4_dup
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	jmp .L25
+.L26:
+.LBE117:
+.stabn 68,0,683,.LM170-v4_gi3
+.LM170:
+	pop %rbx
+	leave
+	ret
+.Lfe117:
+	.size	 v4_gi3,.Lfe117-v4_gi3
+.stabn	192,0,0,.LBB117-v4_gi3
+.stabn	224,0,0,.LBE117-v4_gi3
+.Lscope117:
+.stabs	"",36,0,0,.Lscope117-v4_gi3
+.text
+	.align 4
+.stabs "v4_gi4:F1",36,0,0,v4_gi4
+.globl v4_gi4
+	.type	v4_gi4,@function
+v4_gi4:
+.stabn 68,0,689,.LMa171-v4_gi4
+.LMa171:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,689,.LMb171-v4_gi4
+.LMb171:
+.LBB118:
+.L28:
+	call v4_dup
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L28
+.LBE118:
+.stabn 68,0,689,.LM189-v4_gi4
+.LM189:
+	pop %rbx
+	leave
+	ret
+.Lfe118:
+	.size	 v4_gi4,.Lfe118-v4_gi4
+.stabn	192,0,0,.LBB118-v4_gi4
+.stabn	224,0,0,.LBE118-v4_gi4
+.Lscope118:
+.stabs	"",36,0,0,.Lscope118-v4_gi4
+.text
+	.align 4
+.stabs "v4_gi5:F1",36,0,0,v4_gi5
+.globl v4_gi5
+	.type	v4_gi5,@function
+v4_gi5:
+.stabn 68,0,694,.LMa190-v4_gi5
+.LMa190:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,694,.LMb190-v4_gi5
+.LMb190:
+.LBB119:
+.L31:
+	call v4_dup
+	mov $2,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L32
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L32
+	call v4_dup
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	jmp .L31
+.L32:
+.LBE119:
+.stabn 68,0,694,.LM218-v4_gi5
+.LM218:
+	pop %rbx
+	leave
+	ret
+.Lfe119:
+	.size	 v4_gi5,.Lfe119-v4_gi5
+.stabn	192,0,0,.LBB119-v4_gi5
+.stabn	224,0,0,.LBE119-v4_gi5
+.Lscope119:
+.stabs	"",36,0,0,.Lscope119-v4_gi5
+.text
+	.align 4
+.stabs "v4_gi6:F1",36,0,0,v4_gi6
+.globl v4_gi6
+	.type	v4_gi6,@function
+v4_gi6:
+.stabn 68,0,701,.LMa219-v4_gi6
+.LMa219:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,701,.LMb219-v4_gi6
+.LMb219:
+.LBB120:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	je .L34
+	call v4_dup
+	call v4_Greaterr
+	call v4__dpop
+	dec %rax
+	call v4__dpush
+	call v4_gi6
+	pop %rbx
+	leave
+	jmp v4_r_Greater
+.L34:
+.LBE120:
+.stabn 68,0,701,.LM233-v4_gi6
+.LM233:
+	pop %rbx
+	leave
+	ret
+.Lfe120:
+	.size	 v4_gi6,.Lfe120-v4_gi6
+.stabn	192,0,0,.LBB120-v4_gi6
+.stabn	224,0,0,.LBE120-v4_gi6
+.Lscope120:
+.stabs	"",36,0,0,.Lscope120-v4_gi6
+.text
+	.align 4
+.stabs "v4_gd1:F1",36,0,0,v4_gd1
+.globl v4_gd1
+	.type	v4_gd1,@function
+v4_gd1:
+.stabn 68,0,711,.LMa234-v4_gd1
+.LMa234:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,711,.LMb234-v4_gd1
+.LMb234:
+.LBB121:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+.L37:
+	mov -24(%rbp),%rax
+	call v4__dpush
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L37
+	mov -16(%rbp),%rax
+.LBE121:
+.stabn 68,0,711,.LM255-v4_gd1
+.LM255:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe121:
+	.size	 v4_gd1,.Lfe121-v4_gd1
+.stabn	192,0,0,.LBB121-v4_gd1
+.stabn	224,0,0,.LBE121-v4_gd1
+.Lscope121:
+.stabs	"",36,0,0,.Lscope121-v4_gd1
+.text
+	.align 4
+.stabs "v4_gd2:F1",36,0,0,v4_gd2
+.globl v4_gd2
+	.type	v4_gd2,@function
+v4_gd2:
+.stabn 68,0,716,.LMa256-v4_gd2
+.LMa256:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,716,.LMb256-v4_gd2
+.LMb256:
+.LBB123:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+.L41:
+	mov -24(%rbp),%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	mov -24(%rbp),%rdx
+	add %rax,%rdx
+	test %rax,%rax
+	jl .L43
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	test %rdx,%rdx
+	jl .L41
+	jmp .L42
+.L43:
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	test %rdx,%rdx
+	jge .L41
+.L42:
+	mov -16(%rbp),%rax
+.LBE123:
+.stabn 68,0,716,.LM288-v4_gd2
+.LM288:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe123:
+	.size	 v4_gd2,.Lfe123-v4_gd2
+.stabn	192,0,0,.LBB123-v4_gd2
+.stabn	224,0,0,.LBE123-v4_gd2
+.Lscope123:
+.stabs	"",36,0,0,.Lscope123-v4_gd2
+.text
+	.align 4
+.stabs "v4_gd3:F1",36,0,0,v4_gd3
+.globl v4_gd3
+	.type	v4_gd3,@function
+v4_gd3:
+.stabn 68,0,721,.LMa289-v4_gd3
+.LMa289:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $32,%rsp
+.stabn 68,0,721,.LMb289-v4_gd3
+.LMb289:
+.LBB124:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+.L46:
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	mov %rax,-32(%rbp)
+	mov %rdx,-40(%rbp)
+.L49:
+	mov -24(%rbp),%rax
+	call v4__dpush
+	mov -40(%rbp),%rdx
+	inc %rdx
+	mov -32(%rbp),%rax
+	mov %rdx,-40(%rbp)
+	sub %rax,%rdx
+	jne .L49
+	mov -32(%rbp),%rax
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L46
+	mov -16(%rbp),%rax
+.LBE124:
+.stabn 68,0,721,.LM330-v4_gd3
+.LM330:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe124:
+	.size	 v4_gd3,.Lfe124-v4_gd3
+.stabn	192,0,0,.LBB124-v4_gd3
+.stabn	224,0,0,.LBE124-v4_gd3
+.Lscope124:
+.stabs	"",36,0,0,.Lscope124-v4_gd3
+.text
+	.align 4
+.stabs "v4_gd4:F1",36,0,0,v4_gd4
+.globl v4_gd4
+	.type	v4_gd4,@function
+v4_gd4:
+.stabn 68,0,726,.LMa331-v4_gd4
+.LMa331:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $32,%rsp
+.stabn 68,0,726,.LMb331-v4_gd4
+.LMb331:
+.LBB126:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+.L53:
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	mov %rax,-32(%rbp)
+	mov %rdx,-40(%rbp)
+.L56:
+	mov -24(%rbp),%rax
+	call v4__dpush
+	mov -40(%rbp),%rdx
+	inc %rdx
+	mov -32(%rbp),%rax
+	mov %rdx,-40(%rbp)
+	sub %rax,%rdx
+	jne .L56
+	mov -32(%rbp),%rax
+	xor %rax,%rax
+	dec %rax
+	mov -24(%rbp),%rdx
+	add %rax,%rdx
+	test %rax,%rax
+	jl .L58
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	test %rdx,%rdx
+	jl .L53
+	jmp .L54
+.L58:
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	test %rdx,%rdx
+	jge .L53
+.L54:
+	mov -16(%rbp),%rax
+.LBE126:
+.stabn 68,0,726,.LM383-v4_gd4
+.LM383:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe126:
+	.size	 v4_gd4,.Lfe126-v4_gd4
+.stabn	192,0,0,.LBB126-v4_gd4
+.stabn	224,0,0,.LBE126-v4_gd4
+.Lscope126:
+.stabs	"",36,0,0,.Lscope126-v4_gd4
+.text
+	.align 4
+.stabs "v4_gd5:F1",36,0,0,v4_gd5
+.globl v4_gd5
+	.type	v4_gd5,@function
+v4_gd5:
+.stabn 68,0,731,.LMa384-v4_gd5
+.LMa384:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,731,.LMb384-v4_gd5
+.LMb384:
+.LBB127:
+	mov $123,%rax
+	call v4__dpush
+	call v4_swap
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L61:
+	call v4_i
+	mov $4,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L63
+	call v4_drop
+	mov $234,%rax
+	call v4__dpush
+	jmp .L62
+.L63:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L61
+.L62:
+	call v4__rpop
+	call v4__rpop
+.LBE127:
+.stabn 68,0,731,.LM421-v4_gd5
+.LM421:
+	pop %rbx
+	leave
+	ret
+.Lfe127:
+	.size	 v4_gd5,.Lfe127-v4_gd5
+.stabn	192,0,0,.LBB127-v4_gd5
+.stabn	224,0,0,.LBE127-v4_gd5
+.Lscope127:
+.stabs	"",36,0,0,.Lscope127-v4_gd5
+.text
+	.align 4
+.stabs "v4_gd6:F1",36,0,0,v4_gd6
+.globl v4_gd6
+	.type	v4_gd6,@function
+v4_gd6:
+.stabn 68,0,736,.LMa422-v4_gd6
+.LMa422:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $32,%rsp
+.stabn 68,0,736,.LMb422-v4_gd6
+.LMb422:
+.LBB128:
+.stabn 68,0,737,.LM423-v4_gd6
+.LM423:
+	xor %rax,%rax
+	call v4__dpush
+	call v4_swap
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+.L66:
+	mov -24(%rbp),%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	mov %rax,-32(%rbp)
+	mov %rdx,-40(%rbp)
+.L69:
+	mov -40(%rbp),%rax
+	mov %rax,%rcx
+	mov -24(%rbp),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	mov %rax,%rcx
+	mov $3,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jne .L71
+	mov -40(%rbp),%rax
+	call v4__dpush
+	mov -24(%rbp),%rax
+	call v4__dpush
+	jmp .L64
+.L71:
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	mov -40(%rbp),%rdx
+	inc %rdx
+	mov -32(%rbp),%rax
+	mov %rdx,-40(%rbp)
+	sub %rax,%rdx
+	jne .L69
+	mov -32(%rbp),%rax
+.stabn 68,0,739,.LM491-v4_gd6
+.LM491:
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L66
+	mov -16(%rbp),%rax
+.L64:
+.LBE128:
+.stabn 68,0,739,.LM503-v4_gd6
+.LM503:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe128:
+	.size	 v4_gd6,.Lfe128-v4_gd6
+.stabn	192,0,0,.LBB128-v4_gd6
+.stabn	224,0,0,.LBE128-v4_gd6
+.Lscope128:
+.stabs	"",36,0,0,.Lscope128-v4_gd6
+.text
+	.align 4
+.stabs "v4_s_Equals:F1",36,0,0,v4_s_Equals
+.globl v4_s_Equals
+	.type	v4_s_Equals,@function
+v4_s_Equals:
+.stabn 68,0,826,.LMa504-v4_s_Equals
+.LMa504:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,826,.LMb504-v4_s_Equals
+.LMb504:
+.LBB130:
+.stabn 68,0,827,.LM505-v4_s_Equals
+.LM505:
+	call v4_Greaterr
+	call v4_swap
+	call v4_r_Fetch
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jne .L73
+.stabn 68,0,828,.LM514-v4_s_Equals
+.LM514:
+	call v4_r_Greater
+	call v4_Questiondup
+	call v4__dpop
+	test %rax,%rax
+	je .L74
+.stabn 68,0,829,.LM518-v4_s_Equals
+.LM518:
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L76:
+.stabn 68,0,830,.LM525-v4_s_Equals
+.LM525:
+	call v4_over
+	call v4_c_Fetch
+	call v4_over
+	call v4_c_Fetch
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	sub %rdx,%rax
+	je .L78
+	call v4_z2drop
+	xor %rax,%rax
+	call v4__dpush
+	pop %rbx
+	leave
+	jmp v4_unloop
+.L78:
+.stabn 68,0,831,.LM542-v4_s_Equals
+.LM542:
+	call v4_swap
+	call v4_char_Plus
+	call v4_swap
+	call v4_char_Plus
+.stabn 68,0,832,.LM546-v4_s_Equals
+.LM546:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L76
+	call v4__rpop
+	call v4__rpop
+.L74:
+.stabn 68,0,834,.LM558-v4_s_Equals
+.LM558:
+	call v4_z2drop
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,835,.LM561-v4_s_Equals
+.LM561:
+	jmp .L79
+.L73:
+.stabn 68,0,836,.LM563-v4_s_Equals
+.LM563:
+	call v4_r_Greater
+	call v4_drop
+	call v4_z2drop
+	xor %rax,%rax
+	call v4__dpush
+.L79:
+.L72:
+.LBE130:
+.stabn 68,0,837,.LM570-v4_s_Equals
+.LM570:
+	pop %rbx
+	leave
+	ret
+.Lfe130:
+	.size	 v4_s_Equals,.Lfe130-v4_s_Equals
+.stabn	192,0,0,.LBB130-v4_s_Equals
+.stabn	224,0,0,.LBE130-v4_s_Equals
+.Lscope130:
+.stabs	"",36,0,0,.Lscope130-v4_s_Equals
+.text
+	.align 4
+.stabs "v4_gp1:F1",36,0,0,v4_gp1
+.globl v4_gp1
+	.type	v4_gp1,@function
+v4_gp1:
+.stabn 68,0,839,.LMa571-v4_gp1
+.LMa571:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,839,.LMb571-v4_gp1
+.LMb571:
+.LBB131:
+	call v4_Less_Hash
+	mov $65,%rax
+	call v4__dpush
+	call v4_hold
+	mov $66,%rax
+	call v4__dpush
+	call v4_hold
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Hash_Greater
+	lea .LC17(%rip),%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	pop %rbx
+	leave
+	jmp v4_s_Equals
+.LBE131:
+.stabn 68,0,839,.LM590-v4_gp1
+.LM590:
+	pop %rbx
+	leave
+	ret
+.Lfe131:
+	.size	 v4_gp1,.Lfe131-v4_gp1
+.stabn	192,0,0,.LBB131-v4_gp1
+.stabn	224,0,0,.LBE131-v4_gp1
+.Lscope131:
+.stabs	"",36,0,0,.Lscope131-v4_gp1
+.text
+	.align 4
+.stabs "v4_gp2:F1",36,0,0,v4_gp2
+.globl v4_gp2
+	.type	v4_gp2,@function
+v4_gp2:
+.stabn 68,0,842,.LMa591-v4_gp2
+.LMa591:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,842,.LMb591-v4_gp2
+.LMb591:
+.LBB135:
+	call v4_Less_Hash
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_sign
+	xor %rax,%rax
+	call v4__dpush
+	call v4_sign
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_sign
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Hash_Greater
+	lea .LC18(%rip),%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	pop %rbx
+	leave
+	jmp v4_s_Equals
+.LBE135:
+.stabn 68,0,842,.LM613-v4_gp2
+.LM613:
+	pop %rbx
+	leave
+	ret
+.Lfe135:
+	.size	 v4_gp2,.Lfe135-v4_gp2
+.stabn	192,0,0,.LBB135-v4_gp2
+.stabn	224,0,0,.LBE135-v4_gp2
+.Lscope135:
+.stabs	"",36,0,0,.Lscope135-v4_gp2
+.text
+	.align 4
+.stabs "v4_gp3:F1",36,0,0,v4_gp3
+.globl v4_gp3
+	.type	v4_gp3,@function
+v4_gp3:
+.stabn 68,0,845,.LMa614-v4_gp3
+.LMa614:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,845,.LMb614-v4_gp3
+.LMb614:
+.LBB137:
+	call v4_Less_Hash
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Hash
+	call v4_Hash
+	call v4_Hash_Greater
+	lea .LC19(%rip),%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	pop %rbx
+	leave
+	jmp v4_s_Equals
+.LBE137:
+.stabn 68,0,845,.LM629-v4_gp3
+.LM629:
+	pop %rbx
+	leave
+	ret
+.Lfe137:
+	.size	 v4_gp3,.Lfe137-v4_gp3
+.stabn	192,0,0,.LBB137-v4_gp3
+.stabn	224,0,0,.LBE137-v4_gp3
+.Lscope137:
+.stabs	"",36,0,0,.Lscope137-v4_gp3
+.text
+	.align 4
+.stabs "v4_gp4:F1",36,0,0,v4_gp4
+.globl v4_gp4
+	.type	v4_gp4,@function
+v4_gp4:
+.stabn 68,0,848,.LMa630-v4_gp4
+.LMa630:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,848,.LMb630-v4_gp4
+.LMb630:
+.LBB139:
+	call v4_Less_Hash
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Hashs
+	call v4_Hash_Greater
+	lea .LC20(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	pop %rbx
+	leave
+	jmp v4_s_Equals
+.LBE139:
+.stabn 68,0,848,.LM644-v4_gp4
+.LM644:
+	pop %rbx
+	leave
+	ret
+.Lfe139:
+	.size	 v4_gp4,.Lfe139-v4_gp4
+.stabn	192,0,0,.LBB139-v4_gp4
+.stabn	224,0,0,.LBE139-v4_gp4
+.Lscope139:
+.stabs	"",36,0,0,.Lscope139-v4_gp4
+.text
+	.align 4
+.stabs "v4_count_Minusbits:F1",36,0,0,v4_count_Minusbits
+.globl v4_count_Minusbits
+	.type	v4_count_Minusbits,@function
+v4_count_Minusbits:
+.stabn 68,0,852,.LMa645-v4_count_Minusbits
+.LMa645:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,852,.LMb645-v4_count_Minusbits
+.LMb645:
+.LBB142:
+.stabn 68,0,853,.LM646-v4_count_Minusbits
+.LM646:
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.L85:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	je .L86
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	mov -16(%rbp),%rax
+	add %rax,%rax
+	call v4__dpush
+	jmp .L85
+.L86:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE142:
+.stabn 68,0,853,.LM673-v4_count_Minusbits
+.LM673:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe142:
+	.size	 v4_count_Minusbits,.Lfe142-v4_count_Minusbits
+.stabn	192,0,0,.LBB142-v4_count_Minusbits
+.stabn	224,0,0,.LBE142-v4_count_Minusbits
+.Lscope142:
+.stabs	"",36,0,0,.Lscope142-v4_count_Minusbits
+.text
+	.align 4
+.stabs "v4_gp5:F1",36,0,0,v4_gp5
+.globl v4_gp5
+	.type	v4_gp5,@function
+v4_gp5:
+.stabn 68,0,856,.LMa674-v4_gp5
+.LMa674:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,856,.LMb674-v4_gp5
+.LMb674:
+.LBB144:
+.stabn 68,0,857,.LM675-v4_gp5
+.LM675:
+	call v4_base
+	call v4_Fetch
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,858,.LM679-v4_gp5
+.LM679:
+	mov $37,%rax
+	mov %rax,%rcx
+	mov $2,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L89:
+.stabn 68,0,859,.LM689-v4_gp5
+.LM689:
+	call v4_i
+	call v4_base
+	call v4_Store
+.stabn 68,0,860,.LM692-v4_gp5
+.LM692:
+	call v4_i
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+	lea .LC21(%rip),%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_s_Equals
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	and %rdx,%rax
+	call v4__dpush
+.stabn 68,0,861,.LM708-v4_gp5
+.LM708:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L89
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,862,.LM719-v4_gp5
+.LM719:
+	call v4_swap
+	call v4_base
+	pop %rbx
+	leave
+	jmp v4_Store
+.LBE144:
+.stabn 68,0,862,.LM723-v4_gp5
+.LM723:
+	pop %rbx
+	leave
+	ret
+.Lfe144:
+	.size	 v4_gp5,.Lfe144-v4_gp5
+.stabn	192,0,0,.LBB144-v4_gp5
+.stabn	224,0,0,.LBE144-v4_gp5
+.Lscope144:
+.stabs	"",36,0,0,.Lscope144-v4_gp5
+.text
+	.align 4
+.stabs "v4_gp6:F1",36,0,0,v4_gp6
+.globl v4_gp6
+	.type	v4_gp6,@function
+v4_gp6:
+.stabn 68,0,865,.LMa724-v4_gp6
+.LMa724:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,865,.LMb724-v4_gp6
+.LMb724:
+.LBB146:
+.stabn 68,0,866,.LM725-v4_gp6
+.LM725:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	mov $2,%rax
+	call v4__dpush
+	call v4_base
+	call v4_Store
+.stabn 68,0,868,.LM732-v4_gp6
+.LM732:
+	call v4_Less_Hash
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Hashs
+	call v4_z2drop
+.stabn 68,0,869,.LM739-v4_gp6
+.LM739:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,870,.LM745-v4_gp6
+.LM745:
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,871,.LM748-v4_gp6
+.LM748:
+	call v4_dup
+	mov v4_Hashbits_Minusud(%rip),%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_swap
+.stabn 68,0,872,.LM757-v4_gp6
+.LM757:
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L93:
+.stabn 68,0,873,.LM764-v4_gp6
+.LM764:
+	call v4_over
+	call v4_c_Fetch
+	mov $49,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov %rax,%rdx
+	call v4__dpop
+	and %rdx,%rax
+	call v4__dpush
+.stabn 68,0,874,.LM778-v4_gp6
+.LM778:
+	call v4_Greaterr
+	call v4_char_Plus
+	call v4_r_Greater
+.stabn 68,0,875,.LM781-v4_gp6
+.LM781:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L93
+	call v4__rpop
+	call v4__rpop
+	call v4_swap
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE146:
+.stabn 68,0,875,.LM795-v4_gp6
+.LM795:
+	pop %rbx
+	leave
+	ret
+.Lfe146:
+	.size	 v4_gp6,.Lfe146-v4_gp6
+.stabn	192,0,0,.LBB146-v4_gp6
+.stabn	224,0,0,.LBE146-v4_gp6
+.Lscope146:
+.stabs	"",36,0,0,.Lscope146-v4_gp6
+.text
+	.align 4
+.stabs "v4_gp7:F1",36,0,0,v4_gp7
+.globl v4_gp7
+	.type	v4_gp7,@function
+v4_gp7:
+.stabn 68,0,900,.LMa796-v4_gp7
+.LMa796:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,900,.LMb796-v4_gp7
+.LMb796:
+.LBB147:
+.stabn 68,0,901,.LM797-v4_gp7
+.LM797:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	mov $36,%rax
+	call v4__dpush
+	call v4_base
+	call v4_Store
+.stabn 68,0,902,.LM804-v4_gp7
+.LM804:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,903,.LM806-v4_gp7
+.LM806:
+	mov $10,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L97:
+.stabn 68,0,904,.LM815-v4_gp7
+.LM815:
+	call v4_i
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,905,.LM821-v4_gp7
+.LM821:
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_swap
+	call v4_c_Fetch
+	mov $48,%rax
+	call v4__dpush
+	call v4_i
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov %rax,%rdx
+	call v4__dpop
+	and %rdx,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	and %rdx,%rax
+	call v4__dpush
+.stabn 68,0,906,.LM853-v4_gp7
+.LM853:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L97
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,907,.LM864-v4_gp7
+.LM864:
+	mov $36,%rax
+	mov %rax,%rcx
+	mov $10,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L100:
+.stabn 68,0,908,.LM873-v4_gp7
+.LM873:
+	call v4_i
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,909,.LM879-v4_gp7
+.LM879:
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_swap
+	call v4_c_Fetch
+	mov $65,%rax
+	call v4__dpush
+	call v4_i
+	mov $10,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	sub %rdx,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov %rax,%rdx
+	call v4__dpop
+	and %rdx,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	and %rdx,%rax
+	call v4__dpush
+.stabn 68,0,910,.LM918-v4_gp7
+.LM918:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L100
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,911,.LM929-v4_gp7
+.LM929:
+	call v4_r_Greater
+	call v4_base
+	pop %rbx
+	leave
+	jmp v4_Store
+.LBE147:
+.stabn 68,0,911,.LM933-v4_gp7
+.LM933:
+	pop %rbx
+	leave
+	ret
+.Lfe147:
+	.size	 v4_gp7,.Lfe147-v4_gp7
+.stabn	192,0,0,.LBB147-v4_gp7
+.stabn	224,0,0,.LBE147-v4_gp7
+.Lscope147:
+.stabs	"",36,0,0,.Lscope147-v4_gp7
+.text
+	.align 4
+.stabs "v4_gn_Minusstring:F1",36,0,0,v4_gn_Minusstring
+.globl v4_gn_Minusstring
+	.type	v4_gn_Minusstring,@function
+v4_gn_Minusstring:
+.stabn 68,0,919,.LMa934-v4_gn_Minusstring
+.LMa934:
+.stabn 68,0,919,.LMb934-v4_gn_Minusstring
+.LMb934:
+.LBB149:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.LBE149:
+.stabn 68,0,919,.LM940-v4_gn_Minusstring
+.LM940:
+	ret
+.Lfe149:
+	.size	 v4_gn_Minusstring,.Lfe149-v4_gn_Minusstring
+.stabn	192,0,0,.LBB149-v4_gn_Minusstring
+.stabn	224,0,0,.LBE149-v4_gn_Minusstring
+.Lscope149:
+.stabs	"",36,0,0,.Lscope149-v4_gn_Minusstring
+.text
+	.align 4
+.stabs "v4_gn_Minusconsumed:F1",36,0,0,v4_gn_Minusconsumed
+.globl v4_gn_Minusconsumed
+	.type	v4_gn_Minusconsumed,@function
+v4_gn_Minusconsumed:
+.stabn 68,0,920,.LMa941-v4_gn_Minusconsumed
+.LMa941:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,920,.LMb941-v4_gn_Minusconsumed
+.LMb941:
+.LBB150:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	xor %rax,%rax
+	call v4__dpush
+.LBE150:
+.stabn 68,0,920,.LM948-v4_gn_Minusconsumed
+.LM948:
+	pop %rbx
+	leave
+	ret
+.Lfe150:
+	.size	 v4_gn_Minusconsumed,.Lfe150-v4_gn_Minusconsumed
+.stabn	192,0,0,.LBB150-v4_gn_Minusconsumed
+.stabn	224,0,0,.LBE150-v4_gn_Minusconsumed
+.Lscope150:
+.stabs	"",36,0,0,.Lscope150-v4_gn_Minusconsumed
+.text
+	.align 4
+.stabs "v4_gn_Tick:F1",36,0,0,v4_gn_Tick
+.globl v4_gn_Tick
+	.type	v4_gn_Tick,@function
+v4_gn_Tick:
+.stabn 68,0,922,.LMa949-v4_gn_Tick
+.LMa949:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,922,.LMb949-v4_gn_Tick
+.LMb949:
+.LBB151:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM954-v4_gn_Tick
+.LM954:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.LBE151:
+.stabn 68,0,922,.LM959-v4_gn_Tick
+.LM959:
+	pop %rbx
+	leave
+	ret
+.Lfe151:
+	.size	 v4_gn_Tick,.Lfe151-v4_gn_Tick
+.stabn	192,0,0,.LBB151-v4_gn_Tick
+.stabn	224,0,0,.LBE151-v4_gn_Tick
+.Lscope151:
+.stabs	"",36,0,0,.Lscope151-v4_gn_Tick
+.text
+	.align 4
+.stabs "v4_Greaternumber_Minusbased:F1",36,0,0,v4_Greaternumber_Minusbased
+.globl v4_Greaternumber_Minusbased
+	.type	v4_Greaternumber_Minusbased,@function
+v4_Greaternumber_Minusbased:
+.stabn 68,0,931,.LMa960-v4_Greaternumber_Minusbased
+.LMa960:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,931,.LMb960-v4_Greaternumber_Minusbased
+.LMb960:
+.LBB153:
+.stabn 68,0,932,.LM961-v4_Greaternumber_Minusbased
+.LM961:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	pop %rbx
+	leave
+	jmp v4_Store
+.LBE153:
+.stabn 68,0,932,.LM971-v4_Greaternumber_Minusbased
+.LM971:
+	pop %rbx
+	leave
+	ret
+.Lfe153:
+	.size	 v4_Greaternumber_Minusbased,.Lfe153-v4_Greaternumber_Minusbased
+.stabn	192,0,0,.LBB153-v4_Greaternumber_Minusbased
+.stabn	224,0,0,.LBE153-v4_Greaternumber_Minusbased
+.Lscope153:
+.stabs	"",36,0,0,.Lscope153-v4_Greaternumber_Minusbased
+.text
+	.align 4
+.stabs "v4_gn1:F1",36,0,0,v4_gn1
+.globl v4_gn1
+	.type	v4_gn1,@function
+v4_gn1:
+.stabn 68,0,941,.LMa972-v4_gn1
+.LMa972:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,941,.LMb972-v4_gn1
+.LMb972:
+.LBB154:
+.stabn 68,0,942,.LM973-v4_gn1
+.LM973:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+.stabn 68,0,943,.LM978-v4_gn1
+.LM978:
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,944,.LM981-v4_gn1
+.LM981:
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_z2swap
+	call v4_Greaternumber
+	call v4_swap
+	call v4_drop
+.stabn 68,0,945,.LM989-v4_gn1
+.LM989:
+	call v4_r_Greater
+	call v4_base
+	pop %rbx
+	leave
+	jmp v4_Store
+.LBE154:
+.stabn 68,0,945,.LM993-v4_gn1
+.LM993:
+	pop %rbx
+	leave
+	ret
+.Lfe154:
+	.size	 v4_gn1,.Lfe154-v4_gn1
+.stabn	192,0,0,.LBB154-v4_gn1
+.stabn	224,0,0,.LBE154-v4_gn1
+.Lscope154:
+.stabs	"",36,0,0,.Lscope154-v4_gn1
+.text
+	.align 4
+.stabs "v4_gn2:F1",36,0,0,v4_gn2
+.globl v4_gn2
+	.type	v4_gn2,@function
+v4_gn2:
+.stabn 68,0,953,.LMa994-v4_gn2
+.LMa994:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,953,.LMb994-v4_gn2
+.LMb994:
+.LBB155:
+.stabn 68,0,954,.LM995-v4_gn2
+.LM995:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_base
+	call v4_Fetch
+	call v4_decimal
+	call v4_base
+	call v4_Fetch
+	call v4_r_Greater
+	call v4_base
+	pop %rbx
+	leave
+	jmp v4_Store
+.LBE155:
+.stabn 68,0,954,.LM1008-v4_gn2
+.LM1008:
+	pop %rbx
+	leave
+	ret
+.Lfe155:
+	.size	 v4_gn2,.Lfe155-v4_gn2
+.stabn	192,0,0,.LBB155-v4_gn2
+.stabn	224,0,0,.LBE155-v4_gn2
+.Lscope155:
+.stabs	"",36,0,0,.Lscope155-v4_gn2
+.text
+	.align 4
+.stabs "v4_seebuf:F1",36,0,0,v4_seebuf
+.globl v4_seebuf
+	.type	v4_seebuf,@function
+v4_seebuf:
+.stabn 68,0,965,.LMa1009-v4_seebuf
+.LMa1009:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,965,.LMb1009-v4_seebuf
+.LMb1009:
+.LBB160:
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	pop %rbx
+	leave
+	jmp v4_c_Fetch
+.LBE160:
+.stabn 68,0,965,.LM1023-v4_seebuf
+.LM1023:
+	pop %rbx
+	leave
+	ret
+.Lfe160:
+	.size	 v4_seebuf,.Lfe160-v4_seebuf
+.stabn	192,0,0,.LBB160-v4_seebuf
+.stabn	224,0,0,.LBE160-v4_seebuf
+.Lscope160:
+.stabs	"",36,0,0,.Lscope160-v4_seebuf
+.text
+	.align 4
+.stabs "v4_output_Minustest:F1",36,0,0,v4_output_Minustest
+.globl v4_output_Minustest
+	.type	v4_output_Minustest,@function
+v4_output_Minustest:
+.stabn 68,0,997,.LMa1024-v4_output_Minustest
+.LMa1024:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,997,.LMb1024-v4_output_Minustest
+.LMb1024:
+.LBB163:
+.stabn 68,0,998,.LM1025-v4_output_Minustest
+.LM1025:
+	lea .LC24(%rip),%rax
+	call v4__dpush
+	mov $40,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,999,.LM1031-v4_output_Minustest
+.LM1031:
+	mov $10,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L111:
+	call v4_i
+	call v4_Dot
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L111
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1000,.LM1055-v4_output_Minustest
+.LM1055:
+	lea .LC25(%rip),%rax
+	call v4__dpush
+	mov $36,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1001,.LM1061-v4_output_Minustest
+.LM1061:
+	mov $58,%rax
+	mov %rax,%rcx
+	mov $48,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L114:
+	call v4_i
+	xor %rax,%rax
+	call v4__dpush
+	call v4_spaces
+	call v4_emit
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L114
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1002,.LM1088-v4_output_Minustest
+.LM1088:
+	lea .LC26(%rip),%rax
+	call v4__dpush
+	mov $40,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1003,.LM1094-v4_output_Minustest
+.LM1094:
+	mov $72,%rax
+	mov %rax,%rcx
+	mov $65,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L117:
+	call v4_i
+	call v4_emit
+	call v4_space
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L117
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1004,.LM1119-v4_output_Minustest
+.LM1119:
+	lea .LC27(%rip),%rax
+	call v4__dpush
+	mov $43,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1005,.LM1125-v4_output_Minustest
+.LM1125:
+	mov $6,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L120:
+	call v4_i
+	mov $48,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	call v4_emit
+	mov $2,%rax
+	call v4__dpush
+	call v4_spaces
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L120
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1006,.LM1159-v4_output_Minustest
+.LM1159:
+	lea .LC28(%rip),%rax
+	call v4__dpush
+	mov $34,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1007,.LM1165-v4_output_Minustest
+.LM1165:
+	lea .LC29(%rip),%rax
+	call v4__dpush
+	mov $6,%rax
+	call v4__dpush
+	call v4_type
+	call v4_cr
+	lea .LC30(%rip),%rax
+	call v4__dpush
+	mov $6,%rax
+	call v4__dpush
+	call v4_type
+	call v4_cr
+.stabn 68,0,1008,.LM1177-v4_output_Minustest
+.LM1177:
+	lea .LC31(%rip),%rax
+	call v4__dpush
+	mov $64,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1009,.LM1183-v4_output_Minustest
+.LM1183:
+	lea .LC32(%rip),%rax
+	call v4__dpush
+	mov $10,%rax
+	call v4__dpush
+	call v4__type
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Dot
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,1010,.LM1195-v4_output_Minustest
+.LM1195:
+	lea .LC33(%rip),%rax
+	call v4__dpush
+	mov $10,%rax
+	call v4__dpush
+	call v4__type
+	xor %rax,%rax
+	call v4__dpush
+	call v4_u_Dot
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_u_Dot
+	pop %rbx
+	leave
+	jmp v4_cr
+.LBE163:
+.stabn 68,0,1011,.LM1208-v4_output_Minustest
+.LM1208:
+	pop %rbx
+	leave
+	ret
+.Lfe163:
+	.size	 v4_output_Minustest,.Lfe163-v4_output_Minustest
+.stabn	192,0,0,.LBB163-v4_output_Minustest
+.stabn	224,0,0,.LBE163-v4_output_Minustest
+.Lscope163:
+.stabs	"",36,0,0,.Lscope163-v4_output_Minustest
+.text
+	.align 4
+.stabs "v4_accept_Minustest:F1",36,0,0,v4_accept_Minustest
+.globl v4_accept_Minustest
+	.type	v4_accept_Minustest,@function
+v4_accept_Minustest:
+.stabn 68,0,1020,.LMa1209-v4_accept_Minustest
+.LMa1209:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,1020,.LMb1209-v4_accept_Minustest
+.LMb1209:
+.LBB171:
+.stabn 68,0,1021,.LM1210-v4_accept_Minustest
+.LM1210:
+	call v4_cr
+	lea .LC35(%rip),%rax
+	call v4__dpush
+	mov $32,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1022,.LM1217-v4_accept_Minustest
+.LM1217:
+	lea v4_abuf(%rip),%rax
+	call v4__dpush
+	mov $80,%rax
+	call v4__dpush
+	call v4_accept
+.stabn 68,0,1023,.LM1222-v4_accept_Minustest
+.LM1222:
+	call v4_cr
+	lea .LC36(%rip),%rax
+	call v4__dpush
+	mov $10,%rax
+	call v4__dpush
+	call v4__type
+	mov $34,%rax
+	call v4__dpush
+	call v4_emit
+.stabn 68,0,1024,.LM1231-v4_accept_Minustest
+.LM1231:
+	lea v4_abuf(%rip),%rax
+	call v4__dpush
+	call v4_swap
+	call v4_type
+	mov $34,%rax
+	call v4__dpush
+	call v4_emit
+	pop %rbx
+	leave
+	jmp v4_cr
+.LBE171:
+.stabn 68,0,1025,.LM1240-v4_accept_Minustest
+.LM1240:
+	pop %rbx
+	leave
+	ret
+.Lfe171:
+	.size	 v4_accept_Minustest,.Lfe171-v4_accept_Minustest
+.stabn	192,0,0,.LBB171-v4_accept_Minustest
+.stabn	224,0,0,.LBE171-v4_accept_Minustest
+.Lscope171:
+.stabs	"",36,0,0,.Lscope171-v4_accept_Minustest
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,13,.LMa1241-main
+.LMa1241:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	mov %rdi,v4__argc(%rip)
+	mov %rdx,v4__envp(%rip)
+	mov %rsi,v4__argv(%rip)
+.stabn 68,0,13,.LMb1241-main
+.LMb1241:
+.LBB1:
+	lea .LC0(%rip),%rax
+	call v4__dpush
+	mov $18,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4__strictansi
+	call v4_Store
+.stabn 68,0,19,.LM1253-main
+.LM1253:
+	lea .LC1(%rip),%rax
+	call v4__dpush
+	mov $35,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,21,.LM1259-main
+.LM1259:
+	mov $180,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,22,.LM1271-main
+.LM1271:
+	mov $190,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,23,.LM1283-main
+.LM1283:
+	mov $200,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,24,.LM1295-main
+.LM1295:
+	mov $210,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,26,.LM1307-main
+.LM1307:
+	mov $230,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,27,.LM1320-main
+.LM1320:
+	mov $240,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,29,.LM1333-main
+.LM1333:
+	xor %rax,%rax
+	mov %rax,v4_z0s(%rip)
+.stabn 68,0,30,.LM1337-main
+.LM1337:
+	xor %rax,%rax
+	dec %rax
+	mov %rax,v4_z1s(%rip)
+.stabn 68,0,32,.LM1342-main
+.LM1342:
+	mov $290,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,33,.LM1352-main
+.LM1352:
+	mov $300,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,35,.LM1362-main
+.LM1362:
+	mov $320,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rdx
+	and %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,36,.LM1378-main
+.LM1378:
+	mov $330,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,37,.LM1390-main
+.LM1390:
+	mov $340,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,38,.LM1402-main
+.LM1402:
+	mov $350,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	and %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,40,.LM1418-main
+.LM1418:
+	mov $370,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rdx
+	or %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,41,.LM1434-main
+.LM1434:
+	mov $380,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,42,.LM1446-main
+.LM1446:
+	mov $390,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,43,.LM1458-main
+.LM1458:
+	mov $400,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	or %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,45,.LM1474-main
+.LM1474:
+	mov $420,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rdx
+	xor %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,46,.LM1490-main
+.LM1490:
+	mov $430,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,47,.LM1502-main
+.LM1502:
+	mov $440,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,48,.LM1514-main
+.LM1514:
+	mov $450,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	xor %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,51,.LM1530-main
+.LM1530:
+	lea .LC2(%rip),%rax
+	call v4__dpush
+	mov $27,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,54,.LM1537-main
+.LM1537:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.L121:
+	call v4_dup
+	call v4__dpop
+	add %rax,%rax
+	je .L122
+	call v4__dpop
+	add %rax,%rax
+	call v4__dpush
+	jmp .L121
+.L122:
+.stabn 68,0,55,.LM1553-main
+.LM1553:
+	call v4__dpop
+	mov %rax,v4_msb(%rip)
+.stabn 68,0,57,.LM1555-main
+.LM1555:
+	mov $540,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,58,.LM1565-main
+.LM1565:
+	mov $550,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,59,.LM1575-main
+.LM1575:
+	mov $560,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $32768,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $32768,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,60,.LM1585-main
+.LM1585:
+	mov $570,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,61,.LM1600-main
+.LM1600:
+	mov $580,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_msb(%rip),%rax
+	add %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,63,.LM1613-main
+.LM1613:
+	mov $600,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,64,.LM1623-main
+.LM1623:
+	mov $610,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,65,.LM1633-main
+.LM1633:
+	mov $620,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $8192,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $8192,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,66,.LM1643-main
+.LM1643:
+	mov $630,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,67,.LM1655-main
+.LM1655:
+	mov $640,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,68,.LM1670-main
+.LM1670:
+	mov $650,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_msb(%rip),%rax
+	call v4__dpush
+	call v4_z2_Slash
+	mov v4_msb(%rip),%rax
+	mov %rax,%rdx
+	call v4__dpop
+	and %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov v4_msb(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,70,.LM1687-main
+.LM1687:
+	mov $670,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,71,.LM1699-main
+.LM1699:
+	mov $680,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,72,.LM1711-main
+.LM1711:
+	mov $690,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $4,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,73,.LM1723-main
+.LM1723:
+	mov $700,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $32768,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $32768,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,74,.LM1735-main
+.LM1735:
+	mov $710,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,75,.LM1752-main
+.LM1752:
+	mov $720,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_msb(%rip),%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	xchg %rdx,%rcx
+	shl %cl,%rax
+	xchg %rdx,%rcx
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,77,.LM1768-main
+.LM1768:
+	mov $740,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,78,.LM1780-main
+.LM1780:
+	mov $750,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,79,.LM1792-main
+.LM1792:
+	mov $760,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,80,.LM1804-main
+.LM1804:
+	mov $770,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,81,.LM1816-main
+.LM1816:
+	mov $780,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,82,.LM1828-main
+.LM1828:
+	mov $790,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_msb(%rip),%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	xchg %rdx,%rcx
+	shr %cl,%rax
+	xchg %rdx,%rcx
+	mov %rax,%rcx
+	mov v4_msb(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	and %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,83,.LM1851-main
+.LM1851:
+	mov $800,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_msb(%rip),%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	xchg %rdx,%rcx
+	shr %cl,%rax
+	xchg %rdx,%rcx
+	add %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov v4_msb(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,86,.LM1871-main
+.LM1871:
+	lea .LC3(%rip),%rax
+	call v4__dpush
+	mov $54,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,87,.LM1877-main
+.LM1877:
+	xor %rax,%rax
+	dec %rax
+	mov %rax,v4_max_Minusuint(%rip)
+.stabn 68,0,88,.LM1882-main
+.LM1882:
+	movabs $9223372036854775807,%rax
+	mov %rax,v4_max_Minusint(%rip)
+.stabn 68,0,89,.LM1890-main
+.LM1890:
+	movabs $-9223372036854775808,%rax
+	mov %rax,v4_min_Minusint(%rip)
+.stabn 68,0,90,.LM1899-main
+.LM1899:
+	movabs $9223372036854775807,%rax
+	mov %rax,v4_mid_Minusuint(%rip)
+.stabn 68,0,91,.LM1907-main
+.LM1907:
+	movabs $-9223372036854775808,%rax
+	mov %rax,v4_mid_Minusuint_Plus1(%rip)
+.stabn 68,0,93,.LM1916-main
+.LM1916:
+	xor %rax,%rax
+	mov %rax,v4_Lessfalse_Greater(%rip)
+.stabn 68,0,94,.LM1920-main
+.LM1920:
+	xor %rax,%rax
+	dec %rax
+	mov %rax,v4_Lesstrue_Greater(%rip)
+.stabn 68,0,96,.LM1924-main
+.LM1924:
+	mov $930,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,97,.LM1929-main
+.LM1929:
+	mov $940,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,98,.LM1942-main
+.LM1942:
+	mov $950,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,99,.LM1955-main
+.LM1955:
+	mov $960,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,100,.LM1968-main
+.LM1968:
+	mov $970,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,101,.LM1981-main
+.LM1981:
+	mov $980,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,102,.LM1994-main
+.LM1994:
+	mov $990,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,103,.LM2007-main
+.LM2007:
+	mov $1000,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,105,.LM2020-main
+.LM2020:
+	mov $1020,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,106,.LM2036-main
+.LM2036:
+	mov $1030,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,107,.LM2052-main
+.LM2052:
+	mov $1040,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,108,.LM2068-main
+.LM2068:
+	mov $1050,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,109,.LM2084-main
+.LM2084:
+	mov $1060,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,110,.LM2100-main
+.LM2100:
+	mov $1070,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,111,.LM2116-main
+.LM2116:
+	mov $1080,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,113,.LM2132-main
+.LM2132:
+	mov $1100,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,114,.LM2145-main
+.LM2145:
+	mov $1110,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,115,.LM2158-main
+.LM2158:
+	mov $1120,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,116,.LM2171-main
+.LM2171:
+	mov $1130,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,117,.LM2184-main
+.LM2184:
+	mov $1140,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,119,.LM2197-main
+.LM2197:
+	mov $1160,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,120,.LM2213-main
+.LM2213:
+	mov $1170,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	mov $2,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,121,.LM2229-main
+.LM2229:
+	mov $1180,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,122,.LM2245-main
+.LM2245:
+	mov $1190,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,123,.LM2261-main
+.LM2261:
+	mov $1200,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,124,.LM2277-main
+.LM2277:
+	mov $1210,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rcx
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,125,.LM2293-main
+.LM2293:
+	mov $1220,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,126,.LM2309-main
+.LM2309:
+	mov $1230,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,127,.LM2325-main
+.LM2325:
+	mov $1240,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,128,.LM2341-main
+.LM2341:
+	mov $1250,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,129,.LM2357-main
+.LM2357:
+	mov $1260,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,130,.LM2373-main
+.LM2373:
+	mov $1270,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,131,.LM2389-main
+.LM2389:
+	mov $1280,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,132,.LM2405-main
+.LM2405:
+	mov $1290,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,133,.LM2421-main
+.LM2421:
+	mov $1300,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%rcx
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,134,.LM2437-main
+.LM2437:
+	mov $1310,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,136,.LM2453-main
+.LM2453:
+	mov $1330,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,137,.LM2469-main
+.LM2469:
+	mov $1340,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	mov $2,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,138,.LM2485-main
+.LM2485:
+	mov $1350,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,139,.LM2501-main
+.LM2501:
+	mov $1360,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,140,.LM2517-main
+.LM2517:
+	mov $1370,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,141,.LM2533-main
+.LM2533:
+	mov $1380,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rcx
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,142,.LM2549-main
+.LM2549:
+	mov $1390,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,143,.LM2565-main
+.LM2565:
+	mov $1400,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,144,.LM2581-main
+.LM2581:
+	mov $1410,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,145,.LM2597-main
+.LM2597:
+	mov $1420,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,146,.LM2613-main
+.LM2613:
+	mov $1430,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,147,.LM2629-main
+.LM2629:
+	mov $1440,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,148,.LM2645-main
+.LM2645:
+	mov $1450,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,149,.LM2661-main
+.LM2661:
+	mov $1460,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,150,.LM2677-main
+.LM2677:
+	mov $1470,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%rcx
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,151,.LM2693-main
+.LM2693:
+	mov $1480,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,153,.LM2709-main
+.LM2709:
+	mov $1500,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,154,.LM2725-main
+.LM2725:
+	mov $1510,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	mov $2,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,155,.LM2741-main
+.LM2741:
+	mov $1520,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,156,.LM2757-main
+.LM2757:
+	mov $1530,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,157,.LM2773-main
+.LM2773:
+	mov $1540,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,158,.LM2789-main
+.LM2789:
+	mov $1550,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,159,.LM2805-main
+.LM2805:
+	mov $1560,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,160,.LM2821-main
+.LM2821:
+	mov $1570,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,161,.LM2837-main
+.LM2837:
+	mov $1580,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,162,.LM2853-main
+.LM2853:
+	mov $1590,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,163,.LM2869-main
+.LM2869:
+	mov $1600,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,164,.LM2885-main
+.LM2885:
+	mov $1610,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rcx
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,165,.LM2901-main
+.LM2901:
+	mov $1611,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rcx
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	seta %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,166,.LM2917-main
+.LM2917:
+	mov $1612,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%rcx
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	seta %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,167,.LM2933-main
+.LM2933:
+	mov $1613,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rcx
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	seta %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,168,.LM2949-main
+.LM2949:
+	mov $1614,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	cmp %rdx,%rax
+	seta %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,169,.LM2965-main
+.LM2965:
+	mov $1615,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rcx
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setbe %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,170,.LM2981-main
+.LM2981:
+	mov $1616,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%rcx
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setbe %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,171,.LM2997-main
+.LM2997:
+	mov $1617,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	cmp %rdx,%rax
+	setbe %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,172,.LM3013-main
+.LM3013:
+	mov $1618,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setbe %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,173,.LM3029-main
+.LM3029:
+	mov $1619,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rcx
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setae %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,174,.LM3045-main
+.LM3045:
+	mov $1620,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%rcx
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setae %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,175,.LM3061-main
+.LM3061:
+	mov $1621,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	cmp %rdx,%rax
+	setae %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,176,.LM3077-main
+.LM3077:
+	mov $1622,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setae %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,177,.LM3093-main
+.LM3093:
+	mov $1623,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	lea v4_u_Greater(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,178,.LM3107-main
+.LM3107:
+	mov $1624,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	lea v4_u_Greater(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,179,.LM3121-main
+.LM3121:
+	mov $1625,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	lea v4_u_Less_Equals(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,180,.LM3135-main
+.LM3135:
+	mov $1626,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	lea v4_u_Less_Equals(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,181,.LM3149-main
+.LM3149:
+	mov $1627,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	lea v4_u_Greater_Equals(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,182,.LM3163-main
+.LM3163:
+	mov $1628,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	lea v4_u_Greater_Equals(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,184,.LM3177-main
+.LM3177:
+	mov $1630,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,185,.LM3189-main
+.LM3189:
+	mov $1640,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,186,.LM3201-main
+.LM3201:
+	mov $1650,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,187,.LM3213-main
+.LM3213:
+	mov $1660,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,188,.LM3225-main
+.LM3225:
+	mov $1670,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,189,.LM3237-main
+.LM3237:
+	mov $1680,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,190,.LM3249-main
+.LM3249:
+	mov $1690,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,191,.LM3261-main
+.LM3261:
+	mov $1700,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,192,.LM3273-main
+.LM3273:
+	mov $1710,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,193,.LM3285-main
+.LM3285:
+	mov $1720,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,194,.LM3297-main
+.LM3297:
+	mov $1730,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,195,.LM3309-main
+.LM3309:
+	mov $1740,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,196,.LM3321-main
+.LM3321:
+	mov $1750,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,197,.LM3333-main
+.LM3333:
+	mov $1760,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,198,.LM3345-main
+.LM3345:
+	mov $1770,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,199,.LM3357-main
+.LM3357:
+	mov $1780,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,201,.LM3369-main
+.LM3369:
+	mov $1800,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,202,.LM3381-main
+.LM3381:
+	mov $1810,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,203,.LM3393-main
+.LM3393:
+	mov $1820,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,204,.LM3405-main
+.LM3405:
+	mov $1830,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,205,.LM3417-main
+.LM3417:
+	mov $1840,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,206,.LM3429-main
+.LM3429:
+	mov $1850,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,207,.LM3441-main
+.LM3441:
+	mov $1860,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,208,.LM3453-main
+.LM3453:
+	mov $1870,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,209,.LM3465-main
+.LM3465:
+	mov $1880,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,210,.LM3477-main
+.LM3477:
+	mov $1890,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,211,.LM3489-main
+.LM3489:
+	mov $1900,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,212,.LM3501-main
+.LM3501:
+	mov $1910,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,213,.LM3513-main
+.LM3513:
+	mov $1920,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,214,.LM3525-main
+.LM3525:
+	mov $1930,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,215,.LM3537-main
+.LM3537:
+	mov $1940,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,216,.LM3549-main
+.LM3549:
+	mov $1950,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,219,.LM3561-main
+.LM3561:
+	lea .LC4(%rip),%rax
+	call v4__dpush
+	mov $27,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,222,.LM3567-main
+.LM3567:
+	mov $1960,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,223,.LM3576-main
+.LM3576:
+	mov $1961,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,224,.LM3585-main
+.LM3585:
+	mov $1962,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,225,.LM3594-main
+.LM3594:
+	mov $1963,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,226,.LM3603-main
+.LM3603:
+	mov $1964,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $2147483648,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $2147483648,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,227,.LM3613-main
+.LM3613:
+	mov $1965,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $4294967296,%rax
+	call v4__dpush
+	call v4_dup
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $8589934592,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,228,.LM3628-main
+.LM3628:
+	mov $1966,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,229,.LM3640-main
+.LM3640:
+	mov $1967,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $12345678901,%rax
+	push %rax
+	mov $5270498306774157605,%rdx
+	imul %rdx
+	sar $1,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $1763668414,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,230,.LM3655-main
+.LM3655:
+	mov $1968,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $1099511627776,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $1099511627776,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,240,.LM3667-main
+.LM3667:
+	lea .LC5(%rip),%rax
+	call v4__dpush
+	mov $75,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,242,.LM3673-main
+.LM3673:
+	mov $2000,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_z2drop
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,243,.LM3683-main
+.LM3683:
+	mov $2010,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_z2dup
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,244,.LM3701-main
+.LM3701:
+	mov $2020,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	call v4_z2over
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,245,.LM3727-main
+.LM3727:
+	mov $2030,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	call v4_z2swap
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,246,.LM3749-main
+.LM3749:
+	mov $2040,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Questiondup
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,247,.LM3759-main
+.LM3759:
+	mov $2050,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Questiondup
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,248,.LM3771-main
+.LM3771:
+	mov $2060,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Questiondup
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,249,.LM3783-main
+.LM3783:
+	mov $2070,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_depth
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,250,.LM3791-main
+.LM3791:
+	mov $2080,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_depth
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,251,.LM3803-main
+.LM3803:
+	mov $2090,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_depth
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,252,.LM3819-main
+.LM3819:
+	mov $2100,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_drop
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,253,.LM3827-main
+.LM3827:
+	mov $2110,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_drop
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,254,.LM3839-main
+.LM3839:
+	mov $2120,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_dup
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,255,.LM3851-main
+.LM3851:
+	mov $2130,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_over
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,256,.LM3867-main
+.LM3867:
+	mov $2140,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_rot
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,257,.LM3885-main
+.LM3885:
+	mov $2150,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_swap
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,260,.LM3899-main
+.LM3899:
+	lea .LC6(%rip),%rax
+	call v4__dpush
+	mov $16,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,262,.LM3905-main
+.LM3905:
+	mov $2200,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,263,.LM3910-main
+.LM3910:
+	mov $2210,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,264,.LM3915-main
+.LM3915:
+	mov $2220,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $123,%rax
+	call v4__dpush
+.stabn 68,0,262,.LM3921-main
+.LM3921:
+	call v4_Greaterr
+	call v4_r_Greater
+.stabn 68,0,264,.LM3923-main
+.LM3923:
+	call v4_Minus_Greater
+	mov $123,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,265,.LM3927-main
+.LM3927:
+	mov $2230,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $123,%rax
+	call v4__dpush
+.stabn 68,0,263,.LM3933-main
+.LM3933:
+	call v4_Greaterr
+	call v4_r_Fetch
+	call v4_r_Greater
+	call v4_drop
+.stabn 68,0,265,.LM3937-main
+.LM3937:
+	call v4_Minus_Greater
+	mov $123,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,268,.LM3941-main
+.LM3941:
+	lea .LC7(%rip),%rax
+	call v4__dpush
+	mov $42,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,270,.LM3947-main
+.LM3947:
+	mov $2280,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,271,.LM3959-main
+.LM3959:
+	mov $2290,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,272,.LM3971-main
+.LM3971:
+	mov $2300,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-5,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,273,.LM3983-main
+.LM3983:
+	mov $2310,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-5,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,274,.LM3995-main
+.LM3995:
+	mov $2320,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,275,.LM4007-main
+.LM4007:
+	mov $2330,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,276,.LM4019-main
+.LM4019:
+	mov $2340,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,277,.LM4031-main
+.LM4031:
+	mov $2350,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,278,.LM4043-main
+.LM4043:
+	mov $2360,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,279,.LM4055-main
+.LM4055:
+	mov $2370,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,281,.LM4067-main
+.LM4067:
+	mov $2390,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-5,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,282,.LM4079-main
+.LM4079:
+	mov $2400,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,283,.LM4091-main
+.LM4091:
+	mov $2410,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,284,.LM4103-main
+.LM4103:
+	mov $2420,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-5,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,285,.LM4115-main
+.LM4115:
+	mov $2430,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,286,.LM4127-main
+.LM4127:
+	mov $2440,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,287,.LM4139-main
+.LM4139:
+	mov $2450,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,288,.LM4151-main
+.LM4151:
+	mov $2460,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,289,.LM4163-main
+.LM4163:
+	mov $2470,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,290,.LM4175-main
+.LM4175:
+	mov $2480,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,292,.LM4187-main
+.LM4187:
+	mov $2500,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,293,.LM4197-main
+.LM4197:
+	mov $2510,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,294,.LM4207-main
+.LM4207:
+	mov $2520,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,295,.LM4217-main
+.LM4217:
+	mov $2530,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,297,.LM4227-main
+.LM4227:
+	mov $2550,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,298,.LM4237-main
+.LM4237:
+	mov $2560,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,299,.LM4247-main
+.LM4247:
+	mov $2570,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,300,.LM4257-main
+.LM4257:
+	mov $2580,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,302,.LM4267-main
+.LM4267:
+	mov $2600,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,303,.LM4277-main
+.LM4277:
+	mov $2610,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,304,.LM4287-main
+.LM4287:
+	mov $2620,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,305,.LM4297-main
+.LM4297:
+	mov $2630,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,306,.LM4307-main
+.LM4307:
+	mov $2640,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,308,.LM4317-main
+.LM4317:
+	mov $2660,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,309,.LM4327-main
+.LM4327:
+	mov $2670,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,310,.LM4337-main
+.LM4337:
+	mov $2680,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,311,.LM4347-main
+.LM4347:
+	mov $2690,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,314,.LM4357-main
+.LM4357:
+	lea .LC8(%rip),%rax
+	call v4__dpush
+	mov $30,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,316,.LM4363-main
+.LM4363:
+	mov $2740,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,317,.LM4375-main
+.LM4375:
+	mov $2750,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,318,.LM4387-main
+.LM4387:
+	mov $2760,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,319,.LM4399-main
+.LM4399:
+	mov $2770,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,320,.LM4411-main
+.LM4411:
+	mov $2780,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,321,.LM4423-main
+.LM4423:
+	mov $2790,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,322,.LM4435-main
+.LM4435:
+	mov $2800,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,324,.LM4447-main
+.LM4447:
+	mov $2820,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,325,.LM4460-main
+.LM4460:
+	mov $2830,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,326,.LM4473-main
+.LM4473:
+	mov $2840,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,327,.LM4486-main
+.LM4486:
+	mov $2850,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,328,.LM4499-main
+.LM4499:
+	mov $2860,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,329,.LM4512-main
+.LM4512:
+	mov $2870,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $9,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,330,.LM4525-main
+.LM4525:
+	mov $2880,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-3,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-9,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,331,.LM4538-main
+.LM4538:
+	mov $2890,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-9,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,332,.LM4551-main
+.LM4551:
+	mov $2900,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-3,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $9,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,333,.LM4564-main
+.LM4564:
+	mov $2910,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,334,.LM4577-main
+.LM4577:
+	mov $2920,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,335,.LM4590-main
+.LM4590:
+	mov $2930,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,336,.LM4604-main
+.LM4604:
+	mov $2940,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,337,.LM4617-main
+.LM4617:
+	mov $2950,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,338,.LM4630-main
+.LM4630:
+	mov $2960,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,339,.LM4647-main
+.LM4647:
+	mov $2970,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov v4_msb(%rip),%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	xchg %rdx,%rcx
+	shr %cl,%rax
+	xchg %rdx,%rcx
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,340,.LM4668-main
+.LM4668:
+	mov $2980,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov v4_msb(%rip),%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_z2_Slash
+	call v4_Rightbrace
+.stabn 68,0,341,.LM4683-main
+.LM4683:
+	mov $2990,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov v4_msb(%rip),%rax
+	call v4__dpush
+	call v4_z2_Slash
+	call v4__dpop
+	not %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,343,.LM4702-main
+.LM4702:
+	mov $3010,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,344,.LM4714-main
+.LM4714:
+	mov $3020,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,345,.LM4726-main
+.LM4726:
+	mov $3030,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,346,.LM4738-main
+.LM4738:
+	mov $3040,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,347,.LM4750-main
+.LM4750:
+	mov $3050,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,348,.LM4762-main
+.LM4762:
+	mov $3060,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $9,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $9,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,349,.LM4774-main
+.LM4774:
+	mov $3070,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-9,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-9,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,350,.LM4786-main
+.LM4786:
+	mov $3080,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-9,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-9,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,351,.LM4798-main
+.LM4798:
+	mov $3090,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $9,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $9,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,353,.LM4810-main
+.LM4810:
+	mov $3110,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,354,.LM4825-main
+.LM4825:
+	mov $3120,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,355,.LM4840-main
+.LM4840:
+	mov $3130,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,357,.LM4858-main
+.LM4858:
+	mov $3150,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,358,.LM4872-main
+.LM4872:
+	mov $3160,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,359,.LM4886-main
+.LM4886:
+	mov $3170,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,360,.LM4900-main
+.LM4900:
+	mov $3180,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,361,.LM4914-main
+.LM4914:
+	mov $3190,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,362,.LM4928-main
+.LM4928:
+	mov $3200,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $9,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,364,.LM4942-main
+.LM4942:
+	mov $3220,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $4611686018427387904,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,365,.LM4959-main
+.LM4959:
+	mov $3230,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,366,.LM4973-main
+.LM4973:
+	mov $3240,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,367,.LM4987-main
+.LM4987:
+	mov $3250,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,368,.LM5004-main
+.LM5004:
+	mov $3260,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4__dpush
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,371,.LM5019-main
+.LM5019:
+	lea .LC9(%rip),%rax
+	call v4__dpush
+	mov $56,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,373,.LM5025-main
+.LM5025:
+	mov $3310,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,374,.LM5040-main
+.LM5040:
+	mov $3320,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,375,.LM5055-main
+.LM5055:
+	mov $3330,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,376,.LM5070-main
+.LM5070:
+	mov $3340,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,377,.LM5085-main
+.LM5085:
+	mov $3350,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,378,.LM5100-main
+.LM5100:
+	mov $3360,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,379,.LM5115-main
+.LM5115:
+	mov $3370,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,380,.LM5130-main
+.LM5130:
+	mov $3380,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,381,.LM5145-main
+.LM5145:
+	mov $3390,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,382,.LM5160-main
+.LM5160:
+	mov $3400,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,383,.LM5175-main
+.LM5175:
+	mov $3410,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $2,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,384,.LM5190-main
+.LM5190:
+	mov $3420,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,385,.LM5205-main
+.LM5205:
+	mov $3430,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-2,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,386,.LM5220-main
+.LM5220:
+	mov $3440,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $3,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,387,.LM5235-main
+.LM5235:
+	mov $3450,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-3,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,388,.LM5250-main
+.LM5250:
+	mov $3460,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $3,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,389,.LM5265-main
+.LM5265:
+	mov $3470,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-3,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,390,.LM5280-main
+.LM5280:
+	mov $3480,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,391,.LM5295-main
+.LM5295:
+	mov $3490,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,392,.LM5310-main
+.LM5310:
+	mov $3500,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,393,.LM5325-main
+.LM5325:
+	mov $3510,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,394,.LM5340-main
+.LM5340:
+	mov $3520,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,395,.LM5356-main
+.LM5356:
+	mov $3530,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_m_Star
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,396,.LM5373-main
+.LM5373:
+	mov $3540,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,397,.LM5390-main
+.LM5390:
+	mov $3550,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_m_Star
+	mov $2,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,398,.LM5407-main
+.LM5407:
+	mov $3560,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,399,.LM5424-main
+.LM5424:
+	mov $3570,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,400,.LM5441-main
+.LM5441:
+	mov $3580,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,401,.LM5458-main
+.LM5458:
+	mov $3590,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	mov $2,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,402,.LM5475-main
+.LM5475:
+	mov $3600,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,403,.LM5492-main
+.LM5492:
+	mov $3610,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,404,.LM5509-main
+.LM5509:
+	mov $3620,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,405,.LM5526-main
+.LM5526:
+	mov $3630,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,406,.LM5543-main
+.LM5543:
+	mov $3640,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,408,.LM5560-main
+.LM5560:
+	mov $3660,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,409,.LM5575-main
+.LM5575:
+	mov $3670,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,410,.LM5590-main
+.LM5590:
+	mov $3680,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,411,.LM5605-main
+.LM5605:
+	mov $3690,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,412,.LM5620-main
+.LM5620:
+	mov $3700,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,413,.LM5635-main
+.LM5635:
+	mov $3710,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,414,.LM5650-main
+.LM5650:
+	mov $3720,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,415,.LM5665-main
+.LM5665:
+	mov $3730,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,416,.LM5680-main
+.LM5680:
+	mov $3740,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,417,.LM5695-main
+.LM5695:
+	mov $3750,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,418,.LM5710-main
+.LM5710:
+	mov $3760,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $2,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,419,.LM5725-main
+.LM5725:
+	mov $3770,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,420,.LM5740-main
+.LM5740:
+	mov $3780,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-2,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,421,.LM5755-main
+.LM5755:
+	mov $3790,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $3,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,422,.LM5770-main
+.LM5770:
+	mov $3800,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-3,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,423,.LM5785-main
+.LM5785:
+	mov $3810,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $3,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,424,.LM5800-main
+.LM5800:
+	mov $3820,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	mov $-3,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,425,.LM5815-main
+.LM5815:
+	mov $3830,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,426,.LM5830-main
+.LM5830:
+	mov $3840,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,427,.LM5845-main
+.LM5845:
+	mov $3850,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,428,.LM5860-main
+.LM5860:
+	mov $3860,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_s_Greaterd
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,429,.LM5875-main
+.LM5875:
+	mov $3870,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,430,.LM5891-main
+.LM5891:
+	mov $3880,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_m_Star
+	mov $2,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,431,.LM5908-main
+.LM5908:
+	mov $3890,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,432,.LM5925-main
+.LM5925:
+	mov $3900,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	mov $2,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,433,.LM5942-main
+.LM5942:
+	mov $3910,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,434,.LM5959-main
+.LM5959:
+	mov $3920,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,435,.LM5976-main
+.LM5976:
+	mov $3930,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,436,.LM5993-main
+.LM5993:
+	mov $3940,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,437,.LM6010-main
+.LM6010:
+	mov $3950,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,439,.LM6027-main
+.LM6027:
+	mov $3970,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,440,.LM6043-main
+.LM6043:
+	mov $3980,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,441,.LM6059-main
+.LM6059:
+	mov $3990,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,442,.LM6075-main
+.LM6075:
+	mov $4000,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,443,.LM6091-main
+.LM6091:
+	mov $4010,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_um_Star
+	mov $2,%rax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,444,.LM6108-main
+.LM6108:
+	mov $4020,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_um_Star
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,445,.LM6125-main
+.LM6125:
+	mov $4030,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4__dpush
+	call v4_um_Star
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,465,.LM6142-main
+.LM6142:
+	mov $4280,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6156-main
+.LM6156:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,465,.LM6160-main
+.LM6160:
+	call v4_Rightbrace
+.stabn 68,0,466,.LM6161-main
+.LM6161:
+	mov $4290,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6175-main
+.LM6175:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,466,.LM6179-main
+.LM6179:
+	call v4_Rightbrace
+.stabn 68,0,467,.LM6180-main
+.LM6180:
+	mov $4300,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6194-main
+.LM6194:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,467,.LM6198-main
+.LM6198:
+	call v4_Rightbrace
+.stabn 68,0,468,.LM6199-main
+.LM6199:
+	mov $4310,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6213-main
+.LM6213:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,468,.LM6217-main
+.LM6217:
+	call v4_Rightbrace
+.stabn 68,0,469,.LM6218-main
+.LM6218:
+	mov $4320,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6232-main
+.LM6232:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,469,.LM6236-main
+.LM6236:
+	call v4_Rightbrace
+.stabn 68,0,470,.LM6237-main
+.LM6237:
+	mov $4330,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6251-main
+.LM6251:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,470,.LM6255-main
+.LM6255:
+	call v4_Rightbrace
+.stabn 68,0,471,.LM6256-main
+.LM6256:
+	mov $4340,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6270-main
+.LM6270:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,471,.LM6274-main
+.LM6274:
+	call v4_Rightbrace
+.stabn 68,0,472,.LM6275-main
+.LM6275:
+	mov $4350,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6289-main
+.LM6289:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,472,.LM6293-main
+.LM6293:
+	call v4_Rightbrace
+.stabn 68,0,473,.LM6294-main
+.LM6294:
+	mov $4360,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6308-main
+.LM6308:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,473,.LM6312-main
+.LM6312:
+	call v4_Rightbrace
+.stabn 68,0,474,.LM6313-main
+.LM6313:
+	mov $4370,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6327-main
+.LM6327:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,474,.LM6331-main
+.LM6331:
+	call v4_Rightbrace
+.stabn 68,0,475,.LM6332-main
+.LM6332:
+	mov $4380,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM6346-main
+.LM6346:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,475,.LM6350-main
+.LM6350:
+	call v4_Rightbrace
+.stabn 68,0,476,.LM6351-main
+.LM6351:
+	mov $4390,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6365-main
+.LM6365:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,476,.LM6369-main
+.LM6369:
+	call v4_Rightbrace
+.stabn 68,0,477,.LM6370-main
+.LM6370:
+	mov $4400,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM6384-main
+.LM6384:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,477,.LM6388-main
+.LM6388:
+	call v4_Rightbrace
+.stabn 68,0,478,.LM6389-main
+.LM6389:
+	mov $4410,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM6403-main
+.LM6403:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,478,.LM6407-main
+.LM6407:
+	call v4_Rightbrace
+.stabn 68,0,479,.LM6408-main
+.LM6408:
+	mov $4420,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM6422-main
+.LM6422:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,479,.LM6426-main
+.LM6426:
+	call v4_Rightbrace
+.stabn 68,0,480,.LM6427-main
+.LM6427:
+	mov $4430,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM6441-main
+.LM6441:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,480,.LM6445-main
+.LM6445:
+	call v4_Rightbrace
+.stabn 68,0,481,.LM6446-main
+.LM6446:
+	mov $4440,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM6460-main
+.LM6460:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,481,.LM6464-main
+.LM6464:
+	call v4_Rightbrace
+.stabn 68,0,482,.LM6465-main
+.LM6465:
+	mov $4450,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6479-main
+.LM6479:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,482,.LM6483-main
+.LM6483:
+	call v4_Rightbrace
+.stabn 68,0,483,.LM6484-main
+.LM6484:
+	mov $4460,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6498-main
+.LM6498:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,483,.LM6502-main
+.LM6502:
+	call v4_Rightbrace
+.stabn 68,0,484,.LM6503-main
+.LM6503:
+	mov $4470,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,459,.LM6517-main
+.LM6517:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,484,.LM6521-main
+.LM6521:
+	call v4_Rightbrace
+.stabn 68,0,485,.LM6522-main
+.LM6522:
+	mov $4480,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_Slashmod
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,459,.LM6536-main
+.LM6536:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,485,.LM6540-main
+.LM6540:
+	call v4_Rightbrace
+.stabn 68,0,487,.LM6541-main
+.LM6541:
+	mov $4500,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6559-main
+.LM6559:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6563-main
+.LM6563:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,487,.LM6565-main
+.LM6565:
+	call v4_Rightbrace
+.stabn 68,0,488,.LM6566-main
+.LM6566:
+	mov $4510,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6584-main
+.LM6584:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6588-main
+.LM6588:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,488,.LM6590-main
+.LM6590:
+	call v4_Rightbrace
+.stabn 68,0,489,.LM6591-main
+.LM6591:
+	mov $4520,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6609-main
+.LM6609:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6613-main
+.LM6613:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,489,.LM6615-main
+.LM6615:
+	call v4_Rightbrace
+.stabn 68,0,490,.LM6616-main
+.LM6616:
+	mov $4530,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6634-main
+.LM6634:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6638-main
+.LM6638:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,490,.LM6640-main
+.LM6640:
+	call v4_Rightbrace
+.stabn 68,0,491,.LM6641-main
+.LM6641:
+	mov $4540,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6659-main
+.LM6659:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6663-main
+.LM6663:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,491,.LM6665-main
+.LM6665:
+	call v4_Rightbrace
+.stabn 68,0,492,.LM6666-main
+.LM6666:
+	mov $4550,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6681-main
+.LM6681:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6685-main
+.LM6685:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,492,.LM6687-main
+.LM6687:
+	call v4_Rightbrace
+.stabn 68,0,493,.LM6688-main
+.LM6688:
+	mov $4560,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6703-main
+.LM6703:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6707-main
+.LM6707:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,493,.LM6709-main
+.LM6709:
+	call v4_Rightbrace
+.stabn 68,0,494,.LM6710-main
+.LM6710:
+	mov $4570,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6725-main
+.LM6725:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6729-main
+.LM6729:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,494,.LM6731-main
+.LM6731:
+	call v4_Rightbrace
+.stabn 68,0,495,.LM6732-main
+.LM6732:
+	mov $4580,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6747-main
+.LM6747:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6751-main
+.LM6751:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,495,.LM6753-main
+.LM6753:
+	call v4_Rightbrace
+.stabn 68,0,496,.LM6754-main
+.LM6754:
+	mov $4590,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6769-main
+.LM6769:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6773-main
+.LM6773:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,496,.LM6775-main
+.LM6775:
+	call v4_Rightbrace
+.stabn 68,0,497,.LM6776-main
+.LM6776:
+	mov $4600,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $63,%rdx
+	add %rdx,%rax
+	sar $1,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM6794-main
+.LM6794:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6798-main
+.LM6798:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,497,.LM6800-main
+.LM6800:
+	call v4_Rightbrace
+.stabn 68,0,498,.LM6801-main
+.LM6801:
+	mov $4610,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6816-main
+.LM6816:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6820-main
+.LM6820:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,498,.LM6822-main
+.LM6822:
+	call v4_Rightbrace
+.stabn 68,0,499,.LM6823-main
+.LM6823:
+	mov $4620,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $63,%rdx
+	add %rdx,%rax
+	sar $1,%rax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM6841-main
+.LM6841:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6845-main
+.LM6845:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,499,.LM6847-main
+.LM6847:
+	call v4_Rightbrace
+.stabn 68,0,500,.LM6848-main
+.LM6848:
+	mov $4630,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM6866-main
+.LM6866:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6870-main
+.LM6870:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,500,.LM6872-main
+.LM6872:
+	call v4_Rightbrace
+.stabn 68,0,501,.LM6873-main
+.LM6873:
+	mov $4640,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM6891-main
+.LM6891:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6895-main
+.LM6895:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,501,.LM6897-main
+.LM6897:
+	call v4_Rightbrace
+.stabn 68,0,502,.LM6898-main
+.LM6898:
+	mov $4650,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-7,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM6916-main
+.LM6916:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6920-main
+.LM6920:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,502,.LM6922-main
+.LM6922:
+	call v4_Rightbrace
+.stabn 68,0,503,.LM6923-main
+.LM6923:
+	mov $4660,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-7,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM6941-main
+.LM6941:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6945-main
+.LM6945:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,503,.LM6947-main
+.LM6947:
+	call v4_Rightbrace
+.stabn 68,0,504,.LM6948-main
+.LM6948:
+	mov $4670,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6966-main
+.LM6966:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6970-main
+.LM6970:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,504,.LM6972-main
+.LM6972:
+	call v4_Rightbrace
+.stabn 68,0,505,.LM6973-main
+.LM6973:
+	mov $4680,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM6991-main
+.LM6991:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6995-main
+.LM6995:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,505,.LM6997-main
+.LM6997:
+	call v4_Rightbrace
+.stabn 68,0,506,.LM6998-main
+.LM6998:
+	mov $4690,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,459,.LM7013-main
+.LM7013:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM7017-main
+.LM7017:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,506,.LM7019-main
+.LM7019:
+	call v4_Rightbrace
+.stabn 68,0,507,.LM7020-main
+.LM7020:
+	mov $4700,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_Slash
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,459,.LM7035-main
+.LM7035:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM7039-main
+.LM7039:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,507,.LM7041-main
+.LM7041:
+	call v4_Rightbrace
+.stabn 68,0,509,.LM7042-main
+.LM7042:
+	mov $4720,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7060-main
+.LM7060:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7064-main
+.LM7064:
+	call v4_drop
+.stabn 68,0,509,.LM7065-main
+.LM7065:
+	call v4_Rightbrace
+.stabn 68,0,510,.LM7066-main
+.LM7066:
+	mov $4730,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7084-main
+.LM7084:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7088-main
+.LM7088:
+	call v4_drop
+.stabn 68,0,510,.LM7089-main
+.LM7089:
+	call v4_Rightbrace
+.stabn 68,0,511,.LM7090-main
+.LM7090:
+	mov $4740,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7108-main
+.LM7108:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7112-main
+.LM7112:
+	call v4_drop
+.stabn 68,0,511,.LM7113-main
+.LM7113:
+	call v4_Rightbrace
+.stabn 68,0,512,.LM7114-main
+.LM7114:
+	mov $4750,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7132-main
+.LM7132:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7136-main
+.LM7136:
+	call v4_drop
+.stabn 68,0,512,.LM7137-main
+.LM7137:
+	call v4_Rightbrace
+.stabn 68,0,513,.LM7138-main
+.LM7138:
+	mov $4760,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7156-main
+.LM7156:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7160-main
+.LM7160:
+	call v4_drop
+.stabn 68,0,513,.LM7161-main
+.LM7161:
+	call v4_Rightbrace
+.stabn 68,0,514,.LM7162-main
+.LM7162:
+	mov $4770,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7177-main
+.LM7177:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7181-main
+.LM7181:
+	call v4_drop
+.stabn 68,0,514,.LM7182-main
+.LM7182:
+	call v4_Rightbrace
+.stabn 68,0,515,.LM7183-main
+.LM7183:
+	mov $4780,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7198-main
+.LM7198:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7202-main
+.LM7202:
+	call v4_drop
+.stabn 68,0,515,.LM7203-main
+.LM7203:
+	call v4_Rightbrace
+.stabn 68,0,516,.LM7204-main
+.LM7204:
+	mov $4790,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7219-main
+.LM7219:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7223-main
+.LM7223:
+	call v4_drop
+.stabn 68,0,516,.LM7224-main
+.LM7224:
+	call v4_Rightbrace
+.stabn 68,0,517,.LM7225-main
+.LM7225:
+	mov $4800,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7240-main
+.LM7240:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7244-main
+.LM7244:
+	call v4_drop
+.stabn 68,0,517,.LM7245-main
+.LM7245:
+	call v4_Rightbrace
+.stabn 68,0,518,.LM7246-main
+.LM7246:
+	mov $4810,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7261-main
+.LM7261:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7265-main
+.LM7265:
+	call v4_drop
+.stabn 68,0,518,.LM7266-main
+.LM7266:
+	call v4_Rightbrace
+.stabn 68,0,519,.LM7267-main
+.LM7267:
+	mov $4820,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $63,%rdx
+	add %rdx,%rax
+	and $1,%rax
+	sub %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM7285-main
+.LM7285:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7289-main
+.LM7289:
+	call v4_drop
+.stabn 68,0,519,.LM7290-main
+.LM7290:
+	call v4_Rightbrace
+.stabn 68,0,520,.LM7291-main
+.LM7291:
+	mov $4830,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7306-main
+.LM7306:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7310-main
+.LM7310:
+	call v4_drop
+.stabn 68,0,520,.LM7311-main
+.LM7311:
+	call v4_Rightbrace
+.stabn 68,0,521,.LM7312-main
+.LM7312:
+	mov $4840,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $63,%rdx
+	add %rdx,%rax
+	and $1,%rax
+	sub %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM7330-main
+.LM7330:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7334-main
+.LM7334:
+	call v4_drop
+.stabn 68,0,521,.LM7335-main
+.LM7335:
+	call v4_Rightbrace
+.stabn 68,0,522,.LM7336-main
+.LM7336:
+	mov $4850,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM7354-main
+.LM7354:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7358-main
+.LM7358:
+	call v4_drop
+.stabn 68,0,522,.LM7359-main
+.LM7359:
+	call v4_Rightbrace
+.stabn 68,0,523,.LM7360-main
+.LM7360:
+	mov $4860,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM7378-main
+.LM7378:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7382-main
+.LM7382:
+	call v4_drop
+.stabn 68,0,523,.LM7383-main
+.LM7383:
+	call v4_Rightbrace
+.stabn 68,0,524,.LM7384-main
+.LM7384:
+	mov $4870,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-7,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM7402-main
+.LM7402:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7406-main
+.LM7406:
+	call v4_drop
+.stabn 68,0,524,.LM7407-main
+.LM7407:
+	call v4_Rightbrace
+.stabn 68,0,525,.LM7408-main
+.LM7408:
+	mov $4880,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-7,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+.stabn 68,0,459,.LM7426-main
+.LM7426:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7430-main
+.LM7430:
+	call v4_drop
+.stabn 68,0,525,.LM7431-main
+.LM7431:
+	call v4_Rightbrace
+.stabn 68,0,526,.LM7432-main
+.LM7432:
+	mov $4890,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7450-main
+.LM7450:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7454-main
+.LM7454:
+	call v4_drop
+.stabn 68,0,526,.LM7455-main
+.LM7455:
+	call v4_Rightbrace
+.stabn 68,0,527,.LM7456-main
+.LM7456:
+	mov $4900,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,459,.LM7474-main
+.LM7474:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7478-main
+.LM7478:
+	call v4_drop
+.stabn 68,0,527,.LM7479-main
+.LM7479:
+	call v4_Rightbrace
+.stabn 68,0,528,.LM7480-main
+.LM7480:
+	mov $4910,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,459,.LM7495-main
+.LM7495:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7499-main
+.LM7499:
+	call v4_drop
+.stabn 68,0,528,.LM7500-main
+.LM7500:
+	call v4_Rightbrace
+.stabn 68,0,529,.LM7501-main
+.LM7501:
+	mov $4920,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4__dpush
+	call v4_mod
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,459,.LM7516-main
+.LM7516:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7520-main
+.LM7520:
+	call v4_drop
+.stabn 68,0,529,.LM7521-main
+.LM7521:
+	call v4_Rightbrace
+.stabn 68,0,531,.LM7522-main
+.LM7522:
+	mov $4940,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,462,.LM7541-main
+.LM7541:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7545-main
+.LM7545:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,531,.LM7547-main
+.LM7547:
+	call v4_Rightbrace
+.stabn 68,0,532,.LM7548-main
+.LM7548:
+	mov $4950,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,462,.LM7567-main
+.LM7567:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7571-main
+.LM7571:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,532,.LM7573-main
+.LM7573:
+	call v4_Rightbrace
+.stabn 68,0,533,.LM7574-main
+.LM7574:
+	mov $4960,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,462,.LM7593-main
+.LM7593:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7597-main
+.LM7597:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,533,.LM7599-main
+.LM7599:
+	call v4_Rightbrace
+.stabn 68,0,534,.LM7600-main
+.LM7600:
+	mov $4970,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,462,.LM7619-main
+.LM7619:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7623-main
+.LM7623:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,534,.LM7625-main
+.LM7625:
+	call v4_Rightbrace
+.stabn 68,0,535,.LM7626-main
+.LM7626:
+	mov $4980,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,462,.LM7645-main
+.LM7645:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7649-main
+.LM7649:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,535,.LM7651-main
+.LM7651:
+	call v4_Rightbrace
+.stabn 68,0,536,.LM7652-main
+.LM7652:
+	mov $4990,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,462,.LM7671-main
+.LM7671:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7675-main
+.LM7675:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,536,.LM7677-main
+.LM7677:
+	call v4_Rightbrace
+.stabn 68,0,537,.LM7678-main
+.LM7678:
+	mov $5000,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,462,.LM7697-main
+.LM7697:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7701-main
+.LM7701:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,537,.LM7703-main
+.LM7703:
+	call v4_Rightbrace
+.stabn 68,0,538,.LM7704-main
+.LM7704:
+	mov $5010,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,462,.LM7723-main
+.LM7723:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7727-main
+.LM7727:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,538,.LM7729-main
+.LM7729:
+	call v4_Rightbrace
+.stabn 68,0,539,.LM7730-main
+.LM7730:
+	mov $5020,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,462,.LM7749-main
+.LM7749:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7753-main
+.LM7753:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,539,.LM7755-main
+.LM7755:
+	call v4_Rightbrace
+.stabn 68,0,540,.LM7756-main
+.LM7756:
+	mov $5030,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,462,.LM7775-main
+.LM7775:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7779-main
+.LM7779:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,540,.LM7781-main
+.LM7781:
+	call v4_Rightbrace
+.stabn 68,0,541,.LM7782-main
+.LM7782:
+	mov $5040,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM7801-main
+.LM7801:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7805-main
+.LM7805:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,541,.LM7807-main
+.LM7807:
+	call v4_Rightbrace
+.stabn 68,0,542,.LM7808-main
+.LM7808:
+	mov $5050,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,462,.LM7827-main
+.LM7827:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7831-main
+.LM7831:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,542,.LM7833-main
+.LM7833:
+	call v4_Rightbrace
+.stabn 68,0,543,.LM7834-main
+.LM7834:
+	mov $5060,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM7853-main
+.LM7853:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7857-main
+.LM7857:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,543,.LM7859-main
+.LM7859:
+	call v4_Rightbrace
+.stabn 68,0,544,.LM7860-main
+.LM7860:
+	mov $5070,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM7879-main
+.LM7879:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7883-main
+.LM7883:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,544,.LM7885-main
+.LM7885:
+	call v4_Rightbrace
+.stabn 68,0,545,.LM7886-main
+.LM7886:
+	mov $5080,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM7905-main
+.LM7905:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7909-main
+.LM7909:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,545,.LM7911-main
+.LM7911:
+	call v4_Rightbrace
+.stabn 68,0,546,.LM7912-main
+.LM7912:
+	mov $5090,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM7931-main
+.LM7931:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7935-main
+.LM7935:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,546,.LM7937-main
+.LM7937:
+	call v4_Rightbrace
+.stabn 68,0,547,.LM7938-main
+.LM7938:
+	mov $5100,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM7957-main
+.LM7957:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7961-main
+.LM7961:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,547,.LM7963-main
+.LM7963:
+	call v4_Rightbrace
+.stabn 68,0,548,.LM7964-main
+.LM7964:
+	mov $5110,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM7983-main
+.LM7983:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7987-main
+.LM7987:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,548,.LM7989-main
+.LM7989:
+	call v4_Rightbrace
+.stabn 68,0,549,.LM7990-main
+.LM7990:
+	mov $5120,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM8009-main
+.LM8009:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM8013-main
+.LM8013:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,549,.LM8015-main
+.LM8015:
+	call v4_Rightbrace
+.stabn 68,0,551,.LM8016-main
+.LM8016:
+	mov $5140,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,462,.LM8034-main
+.LM8034:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,551,.LM8038-main
+.LM8038:
+	call v4_Rightbrace
+.stabn 68,0,552,.LM8039-main
+.LM8039:
+	mov $5150,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,462,.LM8057-main
+.LM8057:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,552,.LM8061-main
+.LM8061:
+	call v4_Rightbrace
+.stabn 68,0,553,.LM8062-main
+.LM8062:
+	mov $5160,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,462,.LM8080-main
+.LM8080:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,553,.LM8084-main
+.LM8084:
+	call v4_Rightbrace
+.stabn 68,0,554,.LM8085-main
+.LM8085:
+	mov $5170,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,462,.LM8103-main
+.LM8103:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,554,.LM8107-main
+.LM8107:
+	call v4_Rightbrace
+.stabn 68,0,555,.LM8108-main
+.LM8108:
+	mov $5180,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,462,.LM8126-main
+.LM8126:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,555,.LM8130-main
+.LM8130:
+	call v4_Rightbrace
+.stabn 68,0,556,.LM8131-main
+.LM8131:
+	mov $5190,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,462,.LM8149-main
+.LM8149:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,556,.LM8153-main
+.LM8153:
+	call v4_Rightbrace
+.stabn 68,0,557,.LM8154-main
+.LM8154:
+	mov $5200,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,462,.LM8172-main
+.LM8172:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,557,.LM8176-main
+.LM8176:
+	call v4_Rightbrace
+.stabn 68,0,558,.LM8177-main
+.LM8177:
+	mov $5210,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,462,.LM8195-main
+.LM8195:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,558,.LM8199-main
+.LM8199:
+	call v4_Rightbrace
+.stabn 68,0,559,.LM8200-main
+.LM8200:
+	mov $5220,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,462,.LM8218-main
+.LM8218:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,559,.LM8222-main
+.LM8222:
+	call v4_Rightbrace
+.stabn 68,0,560,.LM8223-main
+.LM8223:
+	mov $5230,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,462,.LM8241-main
+.LM8241:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,560,.LM8245-main
+.LM8245:
+	call v4_Rightbrace
+.stabn 68,0,561,.LM8246-main
+.LM8246:
+	mov $5240,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM8264-main
+.LM8264:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,561,.LM8268-main
+.LM8268:
+	call v4_Rightbrace
+.stabn 68,0,562,.LM8269-main
+.LM8269:
+	mov $5250,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+.stabn 68,0,462,.LM8287-main
+.LM8287:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,562,.LM8291-main
+.LM8291:
+	call v4_Rightbrace
+.stabn 68,0,563,.LM8292-main
+.LM8292:
+	mov $5260,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $-2,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM8310-main
+.LM8310:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,563,.LM8314-main
+.LM8314:
+	call v4_Rightbrace
+.stabn 68,0,564,.LM8315-main
+.LM8315:
+	mov $5270,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM8333-main
+.LM8333:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,564,.LM8337-main
+.LM8337:
+	call v4_Rightbrace
+.stabn 68,0,565,.LM8338-main
+.LM8338:
+	mov $5280,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM8356-main
+.LM8356:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,565,.LM8360-main
+.LM8360:
+	call v4_Rightbrace
+.stabn 68,0,566,.LM8361-main
+.LM8361:
+	mov $5290,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM8379-main
+.LM8379:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,566,.LM8383-main
+.LM8383:
+	call v4_Rightbrace
+.stabn 68,0,567,.LM8384-main
+.LM8384:
+	mov $5300,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM8402-main
+.LM8402:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,567,.LM8406-main
+.LM8406:
+	call v4_Rightbrace
+.stabn 68,0,568,.LM8407-main
+.LM8407:
+	mov $5310,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM8425-main
+.LM8425:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,568,.LM8429-main
+.LM8429:
+	call v4_Rightbrace
+.stabn 68,0,569,.LM8430-main
+.LM8430:
+	mov $5320,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+.stabn 68,0,462,.LM8448-main
+.LM8448:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,569,.LM8452-main
+.LM8452:
+	call v4_Rightbrace
+.stabn 68,0,572,.LM8453-main
+.LM8453:
+	lea .LC10(%rip),%rax
+	call v4__dpush
+	mov $74,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,583,.LM8459-main
+.LM8459:
+	lea v4_hbuf(%rip),%rax
+	call v4__dpush
+	lea v4__here(%rip),%rax
+	call v4__dpush
+	call v4_Store
+.stabn 68,0,585,.LM8464-main
+.LM8464:
+	call v4_here
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Comma
+.stabn 68,0,586,.LM8468-main
+.LM8468:
+	call v4_here
+	mov $2,%rax
+	call v4__dpush
+	call v4_Comma
+.stabn 68,0,587,.LM8472-main
+.LM8472:
+	call v4__dpop
+	mov %rax,v4_z2nd(%rip)
+.stabn 68,0,588,.LM8474-main
+.LM8474:
+	call v4__dpop
+	mov %rax,v4_z1st(%rip)
+.stabn 68,0,589,.LM8476-main
+.LM8476:
+	mov $5490,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	mov %rax,%rcx
+	mov v4_z2nd(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,590,.LM8492-main
+.LM8492:
+	mov $5500,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	add $8,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov v4_z2nd(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,591,.LM8505-main
+.LM8505:
+	mov $5510,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	mov %rax,%rcx
+	mov $8,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov v4_z2nd(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,592,.LM8522-main
+.LM8522:
+	mov $5520,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	call v4__dpush
+	call v4_Fetch
+	mov v4_z2nd(%rip),%rax
+	call v4__dpush
+	call v4_Fetch
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,593,.LM8537-main
+.LM8537:
+	mov $5530,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+	mov v4_z1st(%rip),%rax
+	call v4__dpush
+	call v4_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,594,.LM8547-main
+.LM8547:
+	mov $5540,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	call v4__dpush
+	call v4_Fetch
+	mov v4_z2nd(%rip),%rax
+	call v4__dpush
+	call v4_Fetch
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,595,.LM8562-main
+.LM8562:
+	mov $5550,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%rax
+	call v4__dpush
+	mov v4_z2nd(%rip),%rax
+	call v4__dpush
+	call v4_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,596,.LM8572-main
+.LM8572:
+	mov $5560,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	call v4__dpush
+	call v4_Fetch
+	mov v4_z2nd(%rip),%rax
+	call v4__dpush
+	call v4_Fetch
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	mov $6,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,597,.LM8587-main
+.LM8587:
+	mov $5570,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	call v4__dpush
+	call v4_z2_Fetch
+	call v4_Minus_Greater
+	mov $6,%rax
+	call v4__dpush
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,598,.LM8599-main
+.LM8599:
+	mov $5580,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov v4_z1st(%rip),%rax
+	call v4__dpush
+	call v4_z2_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,599,.LM8611-main
+.LM8611:
+	mov $5590,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	call v4__dpush
+	call v4_z2_Fetch
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,601,.LM8623-main
+.LM8623:
+	call v4_here
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_c_Comma
+.stabn 68,0,602,.LM8627-main
+.LM8627:
+	call v4_here
+	mov $2,%rax
+	call v4__dpush
+	call v4_c_Comma
+.stabn 68,0,603,.LM8631-main
+.LM8631:
+	call v4__dpop
+	mov %rax,v4_z2ndc(%rip)
+.stabn 68,0,604,.LM8633-main
+.LM8633:
+	call v4__dpop
+	mov %rax,v4_z1stc(%rip)
+.stabn 68,0,605,.LM8635-main
+.LM8635:
+	mov $5650,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1stc(%rip),%rax
+	mov %rax,%rcx
+	mov v4_z2ndc(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,606,.LM8651-main
+.LM8651:
+	mov $5660,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1stc(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_Minus_Greater
+	mov v4_z2ndc(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,607,.LM8661-main
+.LM8661:
+	mov $5670,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1stc(%rip),%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov v4_z2ndc(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,608,.LM8678-main
+.LM8678:
+	mov $5680,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1stc(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	mov v4_z2ndc(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,609,.LM8693-main
+.LM8693:
+	mov $5690,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+	mov v4_z1stc(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,610,.LM8703-main
+.LM8703:
+	mov $5700,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1stc(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	mov v4_z2ndc(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,611,.LM8718-main
+.LM8718:
+	mov $5710,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%rax
+	call v4__dpush
+	mov v4_z2ndc(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,612,.LM8728-main
+.LM8728:
+	mov $5720,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1stc(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	mov v4_z2ndc(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,614,.LM8743-main
+.LM8743:
+	call v4_align
+.stabn 68,0,615,.LM8744-main
+.LM8744:
+	call v4_here
+	xor %rax,%rax
+	call v4__dpush
+	call v4_c_Comma
+	call v4_align
+	mov $123,%rax
+	call v4__dpush
+	call v4_Comma
+	call v4__dpop
+	mov %rax,v4_x(%rip)
+.stabn 68,0,617,.LM8754-main
+.LM8754:
+	mov $5750,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_x(%rip),%rax
+	inc %rax
+	call v4__dpush
+	call v4_aligned
+	call v4_Fetch
+	call v4_Minus_Greater
+	mov $123,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,620,.LM8769-main
+.LM8769:
+	mov $5780,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $8,%rax
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,622,.LM8786-main
+.LM8786:
+	mov $5800,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	mov v4_z1st(%rip),%rax
+	call v4__dpush
+	call v4_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,623,.LM8796-main
+.LM8796:
+	mov $5810,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov v4_z1st(%rip),%rax
+	call v4__dpush
+	call v4_Plus_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,624,.LM8806-main
+.LM8806:
+	mov $5820,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	call v4__dpush
+	call v4_Fetch
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,625,.LM8816-main
+.LM8816:
+	mov $5830,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov v4_z1st(%rip),%rax
+	call v4__dpush
+	call v4_Plus_Store
+	mov v4_z1st(%rip),%rax
+	call v4__dpush
+	call v4_Fetch
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,628,.LM8831-main
+.LM8831:
+	lea .LC11(%rip),%rax
+	call v4__dpush
+	mov $35,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,630,.LM8837-main
+.LM8837:
+	mov $5880,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_bl
+	call v4_Minus_Greater
+	mov $32,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,631,.LM8845-main
+.LM8845:
+	mov $5890,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $88,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $88,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,632,.LM8854-main
+.LM8854:
+	mov $5900,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $72,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $72,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,633,.LM8863-main
+.LM8863:
+	mov $5910,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,634,.LM8868-main
+.LM8868:
+	mov $5920,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,635,.LM8873-main
+.LM8873:
+	mov $5930,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,633,.LM8877-main
+.LM8877:
+	mov $88,%rax
+	call v4__dpush
+.stabn 68,0,635,.LM8879-main
+.LM8879:
+	call v4_Minus_Greater
+	mov $88,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,636,.LM8883-main
+.LM8883:
+	mov $5940,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,634,.LM8887-main
+.LM8887:
+	mov $72,%rax
+	call v4__dpush
+.stabn 68,0,636,.LM8889-main
+.LM8889:
+	call v4_Minus_Greater
+	mov $72,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,637,.LM8893-main
+.LM8893:
+	mov $5950,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,638,.LM8898-main
+.LM8898:
+	mov $5960,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,637,.LM8902-main
+.LM8902:
+	call v4_Leftbracket
+.stabn 68,0,633,.LM8904-main
+.LM8904:
+	mov $88,%rax
+	call v4__dpush
+.stabn 68,0,637,.LM8906-main
+.LM8906:
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,638,.LM8908-main
+.LM8908:
+	call v4_Minus_Greater
+	mov $88,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,639,.LM8912-main
+.LM8912:
+	mov $5970,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,640,.LM8917-main
+.LM8917:
+	mov $5980,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,639,.LM8921-main
+.LM8921:
+	lea .LC12(%rip),%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+.stabn 68,0,640,.LM8925-main
+.LM8925:
+	call v4_swap
+	call v4_drop
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,641,.LM8931-main
+.LM8931:
+	mov $5990,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,639,.LM8935-main
+.LM8935:
+	lea .LC12(%rip),%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+.stabn 68,0,641,.LM8939-main
+.LM8939:
+	call v4_drop
+	call v4_dup
+	call v4_c_Fetch
+	call v4_swap
+	call v4_char_Plus
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	mov $88,%rax
+	call v4__dpush
+	mov $89,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,644,.LM8951-main
+.LM8951:
+	lea .LC13(%rip),%rax
+	call v4__dpush
+	mov $65,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,646,.LM8957-main
+.LM8957:
+	mov $6040,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,647,.LM8962-main
+.LM8962:
+	mov $6050,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_gt1(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	mov $123,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,648,.LM8972-main
+.LM8972:
+	mov $6060,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_immediate
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,649,.LM8978-main
+.LM8978:
+	mov $6070,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,648,.LM8982-main
+.LM8982:
+	lea v4_gt1(%rip),%rax
+	call v4__dpush
+.stabn 68,0,649,.LM8984-main
+.LM8984:
+	call v4_execute
+	call v4_Minus_Greater
+	mov $123,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,666,.LM8989-main
+.LM8989:
+	mov $6240,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_immediate
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,667,.LM8995-main
+.LM8995:
+	mov $6250,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,666,.LM8999-main
+.LM8999:
+	call v4_state
+	call v4_Fetch
+.stabn 68,0,667,.LM9001-main
+.LM9001:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,668,.LM9005-main
+.LM9005:
+	mov $6260,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,669,.LM9010-main
+.LM9010:
+	mov $6270,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,668,.LM9014-main
+.LM9014:
+	lea v4_gt8(%rip),%rax
+	call v4__dpush
+	call v4_literal
+	call v4__dpop
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,672,.LM9025-main
+.LM9025:
+	lea .LC14(%rip),%rax
+	call v4__dpush
+	mov $53,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,674,.LM9031-main
+.LM9031:
+	mov $6320,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,675,.LM9036-main
+.LM9036:
+	mov $6330,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,676,.LM9041-main
+.LM9041:
+	mov $6340,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	je .L123
+	mov $123,%rax
+	call v4__dpush
+.L123:
+.stabn 68,0,676,.LM9052-main
+.LM9052:
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,677,.LM9054-main
+.LM9054:
+	mov $6350,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	je .L124
+	mov $123,%rax
+	call v4__dpush
+.L124:
+.stabn 68,0,677,.LM9065-main
+.LM9065:
+	call v4_Minus_Greater
+	mov $123,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,678,.LM9069-main
+.LM9069:
+	mov $6360,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	je .L125
+	mov $123,%rax
+	call v4__dpush
+.L125:
+.stabn 68,0,678,.LM9080-main
+.LM9080:
+	call v4_Minus_Greater
+	mov $123,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,679,.LM9084-main
+.LM9084:
+	mov $6370,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	je .L126
+	mov $123,%rax
+	call v4__dpush
+	jmp .L127
+.L126:
+	mov $234,%rax
+	call v4__dpush
+.L127:
+.stabn 68,0,679,.LM9099-main
+.LM9099:
+	call v4_Minus_Greater
+	mov $234,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,680,.LM9103-main
+.LM9103:
+	mov $6380,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	je .L128
+	mov $123,%rax
+	call v4__dpush
+	jmp .L129
+.L128:
+	mov $234,%rax
+	call v4__dpush
+.L129:
+.stabn 68,0,680,.LM9118-main
+.LM9118:
+	call v4_Minus_Greater
+	mov $123,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,681,.LM9122-main
+.LM9122:
+	mov $6390,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	je .L130
+	mov $123,%rax
+	call v4__dpush
+.L130:
+.stabn 68,0,681,.LM9133-main
+.LM9133:
+	call v4_Minus_Greater
+	mov $123,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,683,.LM9137-main
+.LM9137:
+	mov $6410,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,684,.LM9142-main
+.LM9142:
+	mov $6420,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+.L131:
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L132
+	call v4_dup
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	jmp .L131
+.L132:
+.stabn 68,0,684,.LM9165-main
+.LM9165:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,685,.LM9179-main
+.LM9179:
+	mov $6430,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%rax
+	call v4__dpush
+.L133:
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L134
+	call v4_dup
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	jmp .L133
+.L134:
+.stabn 68,0,685,.LM9202-main
+.LM9202:
+	call v4_Minus_Greater
+	mov $4,%rax
+	call v4__dpush
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,686,.LM9208-main
+.LM9208:
+	mov $6440,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+.L135:
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L136
+	call v4_dup
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	jmp .L135
+.L136:
+.stabn 68,0,686,.LM9231-main
+.LM9231:
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,687,.LM9235-main
+.LM9235:
+	mov $6450,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%rax
+	call v4__dpush
+.L137:
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L138
+	call v4_dup
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	jmp .L137
+.L138:
+.stabn 68,0,687,.LM9258-main
+.LM9258:
+	call v4_Minus_Greater
+	mov $6,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,689,.LM9262-main
+.LM9262:
+	mov $6470,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,690,.LM9267-main
+.LM9267:
+	mov $6480,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+.L139:
+	call v4_dup
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L139
+.stabn 68,0,690,.LM9288-main
+.LM9288:
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	mov $5,%rax
+	call v4__dpush
+	mov $6,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,691,.LM9298-main
+.LM9298:
+	mov $6490,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+.L140:
+	call v4_dup
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L140
+.stabn 68,0,691,.LM9319-main
+.LM9319:
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	mov $6,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,692,.LM9325-main
+.LM9325:
+	mov $6500,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%rax
+	call v4__dpush
+.L141:
+	call v4_dup
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L141
+.stabn 68,0,692,.LM9346-main
+.LM9346:
+	call v4_Minus_Greater
+	mov $6,%rax
+	call v4__dpush
+	mov $7,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,694,.LM9352-main
+.LM9352:
+	mov $6520,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,695,.LM9357-main
+.LM9357:
+	mov $6530,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_gi5
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,696,.LM9367-main
+.LM9367:
+	mov $6540,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,697,.LM9377-main
+.LM9377:
+	mov $6550,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,698,.LM9391-main
+.LM9391:
+	mov $6560,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%rax
+	call v4__dpush
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $4,%rax
+	call v4__dpush
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,699,.LM9403-main
+.LM9403:
+	mov $6570,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,701,.LM9413-main
+.LM9413:
+	mov $6600,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,702,.LM9418-main
+.LM9418:
+	mov $6610,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,703,.LM9428-main
+.LM9428:
+	mov $6620,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,704,.LM9440-main
+.LM9440:
+	mov $6630,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,705,.LM9454-main
+.LM9454:
+	mov $6640,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,706,.LM9470-main
+.LM9470:
+	mov $6650,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%rax
+	call v4__dpush
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,709,.LM9488-main
+.LM9488:
+	lea .LC15(%rip),%rax
+	call v4__dpush
+	mov $43,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,711,.LM9494-main
+.LM9494:
+	mov $6700,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,712,.LM9499-main
+.LM9499:
+	mov $6710,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_gd1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,713,.LM9515-main
+.LM9515:
+	mov $6720,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_gd1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,714,.LM9531-main
+.LM9531:
+	mov $6730,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_gd1
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,716,.LM9543-main
+.LM9543:
+	mov $6750,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,717,.LM9548-main
+.LM9548:
+	mov $6760,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	call v4_gd2
+	call v4_Minus_Greater
+	mov $4,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,718,.LM9566-main
+.LM9566:
+	mov $6770,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_gd2
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,719,.LM9584-main
+.LM9584:
+	mov $6780,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_gd2
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,721,.LM9598-main
+.LM9598:
+	mov $6800,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,722,.LM9603-main
+.LM9603:
+	mov $6810,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_gd3
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,723,.LM9619-main
+.LM9619:
+	mov $6820,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_gd3
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,724,.LM9635-main
+.LM9635:
+	mov $6830,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_gd3
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,726,.LM9647-main
+.LM9647:
+	mov $6850,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,727,.LM9652-main
+.LM9652:
+	mov $6860,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	call v4_gd4
+	call v4_Minus_Greater
+	mov $4,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,728,.LM9670-main
+.LM9670:
+	mov $6870,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_gd4
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,729,.LM9688-main
+.LM9688:
+	mov $6880,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	call v4_gd4
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,731,.LM9702-main
+.LM9702:
+	mov $6900,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,732,.LM9707-main
+.LM9707:
+	mov $6910,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_gd5
+	call v4_Minus_Greater
+	mov $123,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,733,.LM9717-main
+.LM9717:
+	mov $6920,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+	call v4_gd5
+	call v4_Minus_Greater
+	mov $123,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,734,.LM9727-main
+.LM9727:
+	mov $6930,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%rax
+	call v4__dpush
+	call v4_gd5
+	call v4_Minus_Greater
+	mov $234,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,736,.LM9737-main
+.LM9737:
+	mov $6950,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,739,.LM9740-main
+.LM9740:
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,740,.LM9742-main
+.LM9742:
+	mov $6990,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_gd6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,741,.LM9752-main
+.LM9752:
+	mov $7000,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	call v4_gd6
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,742,.LM9762-main
+.LM9762:
+	mov $7010,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+	call v4_gd6
+	call v4_Minus_Greater
+	mov $4,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,824,.LM9776-main
+.LM9776:
+	lea .LC16(%rip),%rax
+	call v4__dpush
+	mov $53,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,840,.LM9782-main
+.LM9782:
+	mov $7990,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_gp1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,843,.LM9790-main
+.LM9790:
+	mov $8020,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_gp2
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,846,.LM9798-main
+.LM9798:
+	mov $8050,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_gp3
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,849,.LM9806-main
+.LM9806:
+	mov $8080,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,848,.LM9810-main
+.LM9810:
+	call v4_Less_Hash
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Hashs
+	call v4_Hash_Greater
+	lea .LC20(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_s_Equals
+.stabn 68,0,849,.LM9822-main
+.LM9822:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,851,.LM9826-main
+.LM9826:
+	mov $36,%rax
+	mov %rax,v4_max_Minusbase(%rip)
+.stabn 68,0,854,.LM9830-main
+.LM9830:
+	call v4_count_Minusbits
+	call v4__dpop
+	add %rax,%rax
+	mov %rax,v4_Hashbits_Minusud(%rip)
+.stabn 68,0,863,.LM9837-main
+.LM9837:
+	mov $8220,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_gp5
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,876,.LM9845-main
+.LM9845:
+	mov $8330,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_gp6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,912,.LM9853-main
+.LM9853:
+	mov $8690,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_gp7
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,924,.LM9861-main
+.LM9861:
+	mov $8800,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $48,%rax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9874-main
+.LM9874:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM9878-main
+.LM9878:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,924,.LM9882-main
+.LM9882:
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,920,.LM9889-main
+.LM9889:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,924,.LM9894-main
+.LM9894:
+	call v4_Rightbrace
+.stabn 68,0,925,.LM9895-main
+.LM9895:
+	mov $8810,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $49,%rax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9908-main
+.LM9908:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM9912-main
+.LM9912:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,925,.LM9916-main
+.LM9916:
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,920,.LM9923-main
+.LM9923:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,925,.LM9928-main
+.LM9928:
+	call v4_Rightbrace
+.stabn 68,0,926,.LM9929-main
+.LM9929:
+	mov $8820,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $49,%rax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9942-main
+.LM9942:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM9946-main
+.LM9946:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,926,.LM9950-main
+.LM9950:
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	call v4_base
+	call v4_Fetch
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,920,.LM9961-main
+.LM9961:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,926,.LM9966-main
+.LM9966:
+	call v4_Rightbrace
+.stabn 68,0,927,.LM9967-main
+.LM9967:
+	mov $8830,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $45,%rax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9980-main
+.LM9980:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM9984-main
+.LM9984:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,927,.LM9988-main
+.LM9988:
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,919,.LM9995-main
+.LM9995:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,927,.LM9999-main
+.LM9999:
+	call v4_Rightbrace
+.stabn 68,0,928,.LM10000-main
+.LM10000:
+	mov $8840,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $43,%rax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10013-main
+.LM10013:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10017-main
+.LM10017:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,928,.LM10021-main
+.LM10021:
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,919,.LM10028-main
+.LM10028:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,928,.LM10032-main
+.LM10032:
+	call v4_Rightbrace
+.stabn 68,0,929,.LM10033-main
+.LM10033:
+	mov $8850,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $46,%rax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10046-main
+.LM10046:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10050-main
+.LM10050:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,929,.LM10054-main
+.LM10054:
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,919,.LM10061-main
+.LM10061:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,929,.LM10065-main
+.LM10065:
+	call v4_Rightbrace
+.stabn 68,0,934,.LM10066-main
+.LM10066:
+	mov $8900,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $50,%rax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10079-main
+.LM10079:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10083-main
+.LM10083:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,934,.LM10087-main
+.LM10087:
+	mov $16,%rax
+	call v4__dpush
+.stabn 68,0,932,.LM10090-main
+.LM10090:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,934,.LM10099-main
+.LM10099:
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,920,.LM10105-main
+.LM10105:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,934,.LM10110-main
+.LM10110:
+	call v4_Rightbrace
+.stabn 68,0,935,.LM10111-main
+.LM10111:
+	mov $8910,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $50,%rax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10124-main
+.LM10124:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10128-main
+.LM10128:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,935,.LM10132-main
+.LM10132:
+	mov $2,%rax
+	call v4__dpush
+.stabn 68,0,932,.LM10135-main
+.LM10135:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,935,.LM10144-main
+.LM10144:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,919,.LM10150-main
+.LM10150:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,935,.LM10154-main
+.LM10154:
+	call v4_Rightbrace
+.stabn 68,0,936,.LM10155-main
+.LM10155:
+	mov $8920,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $70,%rax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10168-main
+.LM10168:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10172-main
+.LM10172:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,936,.LM10176-main
+.LM10176:
+	mov $16,%rax
+	call v4__dpush
+.stabn 68,0,932,.LM10179-main
+.LM10179:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,936,.LM10188-main
+.LM10188:
+	call v4_Minus_Greater
+	mov $15,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,920,.LM10194-main
+.LM10194:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,936,.LM10199-main
+.LM10199:
+	call v4_Rightbrace
+.stabn 68,0,937,.LM10200-main
+.LM10200:
+	mov $8930,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $71,%rax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10213-main
+.LM10213:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10217-main
+.LM10217:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,937,.LM10221-main
+.LM10221:
+	mov $16,%rax
+	call v4__dpush
+.stabn 68,0,932,.LM10224-main
+.LM10224:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,937,.LM10233-main
+.LM10233:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,919,.LM10239-main
+.LM10239:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,937,.LM10243-main
+.LM10243:
+	call v4_Rightbrace
+.stabn 68,0,938,.LM10244-main
+.LM10244:
+	mov $8940,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $71,%rax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10257-main
+.LM10257:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10261-main
+.LM10261:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,938,.LM10265-main
+.LM10265:
+	mov $36,%rax
+	call v4__dpush
+.stabn 68,0,932,.LM10268-main
+.LM10268:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,938,.LM10277-main
+.LM10277:
+	call v4_Minus_Greater
+	mov $16,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,920,.LM10283-main
+.LM10283:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,938,.LM10288-main
+.LM10288:
+	call v4_Rightbrace
+.stabn 68,0,939,.LM10289-main
+.LM10289:
+	mov $8950,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Leftbracket
+	mov $90,%rax
+	call v4__dpush
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10302-main
+.LM10302:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+.stabn 68,0,919,.LM10306-main
+.LM10306:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,939,.LM10310-main
+.LM10310:
+	mov $36,%rax
+	call v4__dpush
+.stabn 68,0,932,.LM10313-main
+.LM10313:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,939,.LM10322-main
+.LM10322:
+	call v4_Minus_Greater
+	mov $35,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,920,.LM10328-main
+.LM10328:
+	lea v4_gn_Minusbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,939,.LM10333-main
+.LM10333:
+	call v4_Rightbrace
+.stabn 68,0,946,.LM10334-main
+.LM10334:
+	mov $9020,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,947,.LM10352-main
+.LM10352:
+	mov $9030,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,949,.LM10370-main
+.LM10370:
+	mov $9050,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	mov $36,%rax
+	call v4__dpush
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,950,.LM10388-main
+.LM10388:
+	mov $9060,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	mov $36,%rax
+	call v4__dpush
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,955,.LM10406-main
+.LM10406:
+	mov $9110,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,954,.LM10410-main
+.LM10410:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_base
+	call v4_Fetch
+	call v4_decimal
+	call v4_base
+	call v4_Fetch
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,955,.LM10422-main
+.LM10422:
+	call v4_Minus_Greater
+	mov $16,%rax
+	call v4__dpush
+	mov $10,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,958,.LM10428-main
+.LM10428:
+	lea .LC22(%rip),%rax
+	call v4__dpush
+	mov $17,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,964,.LM10434-main
+.LM10434:
+	mov $18,%rax
+	call v4__dpush
+	lea v4_sbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Store
+	mov $52,%rax
+	call v4__dpush
+	lea v4_sbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Store
+	mov $86,%rax
+	call v4__dpush
+	lea v4_sbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Store
+.stabn 68,0,967,.LM10452-main
+.LM10452:
+	mov $9220,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	mov $32,%rax
+	call v4__dpush
+	call v4_fill
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,968,.LM10464-main
+.LM10464:
+	mov $9230,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10468-main
+.LM10468:
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,968,.LM10480-main
+.LM10480:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,970,.LM10488-main
+.LM10488:
+	mov $9250,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	mov $32,%rax
+	call v4__dpush
+	call v4_fill
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,971,.LM10500-main
+.LM10500:
+	mov $9260,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10504-main
+.LM10504:
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,971,.LM10516-main
+.LM10516:
+	call v4_Minus_Greater
+	mov $32,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,973,.LM10524-main
+.LM10524:
+	mov $9280,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	mov $32,%rax
+	call v4__dpush
+	call v4_fill
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,974,.LM10536-main
+.LM10536:
+	mov $9290,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10540-main
+.LM10540:
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,974,.LM10552-main
+.LM10552:
+	call v4_Minus_Greater
+	mov $32,%rax
+	call v4__dpush
+	mov $32,%rax
+	call v4__dpush
+	mov $32,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,976,.LM10560-main
+.LM10560:
+	mov $9310,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,977,.LM10573-main
+.LM10573:
+	mov $9320,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10577-main
+.LM10577:
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,977,.LM10589-main
+.LM10589:
+	call v4_Minus_Greater
+	mov $32,%rax
+	call v4__dpush
+	mov $32,%rax
+	call v4__dpush
+	mov $32,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,979,.LM10597-main
+.LM10597:
+	mov $9340,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_sbuf(%rip),%rax
+	call v4__dpush
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,980,.LM10610-main
+.LM10610:
+	mov $9350,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10614-main
+.LM10614:
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,980,.LM10626-main
+.LM10626:
+	call v4_Minus_Greater
+	mov $32,%rax
+	call v4__dpush
+	mov $32,%rax
+	call v4__dpush
+	mov $32,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,982,.LM10634-main
+.LM10634:
+	mov $9370,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_sbuf(%rip),%rax
+	call v4__dpush
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,983,.LM10647-main
+.LM10647:
+	mov $9380,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10651-main
+.LM10651:
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,983,.LM10663-main
+.LM10663:
+	call v4_Minus_Greater
+	mov $18,%rax
+	call v4__dpush
+	mov $32,%rax
+	call v4__dpush
+	mov $32,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,985,.LM10671-main
+.LM10671:
+	mov $9400,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_sbuf(%rip),%rax
+	call v4__dpush
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,986,.LM10684-main
+.LM10684:
+	mov $9410,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10688-main
+.LM10688:
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,986,.LM10700-main
+.LM10700:
+	call v4_Minus_Greater
+	mov $18,%rax
+	call v4__dpush
+	mov $52,%rax
+	call v4__dpush
+	mov $86,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,988,.LM10708-main
+.LM10708:
+	mov $9430,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	mov $2,%rax
+	call v4__dpush
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,989,.LM10722-main
+.LM10722:
+	mov $9440,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10726-main
+.LM10726:
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,989,.LM10738-main
+.LM10738:
+	call v4_Minus_Greater
+	mov $18,%rax
+	call v4__dpush
+	mov $18,%rax
+	call v4__dpush
+	mov $52,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,991,.LM10746-main
+.LM10746:
+	mov $9460,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,992,.LM10760-main
+.LM10760:
+	mov $9470,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10764-main
+.LM10764:
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	call v4__dpush
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,992,.LM10776-main
+.LM10776:
+	call v4_Minus_Greater
+	mov $18,%rax
+	call v4__dpush
+	mov $52,%rax
+	call v4__dpush
+	mov $52,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,995,.LM10784-main
+.LM10784:
+	lea .LC23(%rip),%rax
+	call v4__dpush
+	mov $54,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1013,.LM10790-main
+.LM10790:
+	mov $9680,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_output_Minustest
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,1016,.LM10796-main
+.LM10796:
+	lea .LC34(%rip),%rax
+	call v4__dpush
+	mov $21,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,1027,.LM10802-main
+.LM10802:
+	mov $9820,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_accept_Minustest
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,1037,.LM10808-main
+.LM10808:
+	call v4_test_Minusstatus
+	call v4_Fetch
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE1:
+.stabn 68,0,1037,.LM10812-main
+.LM10812:
+	pop %rbx
+	leave
+	ret
+.Lfe1:
+	.size	 main,.Lfe1-main
+.stabn	192,0,0,.LBB1-main
+.stabn	224,0,0,.LBE1-main
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
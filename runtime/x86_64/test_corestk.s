@@ -0,0 +1,31539 @@
+	.file	"test_corestk.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"test_corestk.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC32:
+	.string "  SIGNED: "
+.LC18:
+	.string "--"
+.LC19:
+	.string "01"
+.LC20:
+	.string "1"
+.LC21:
+	.string "10"
+.LC17:
+	.string "BA"
+.LC29:
+	.string "LINE 1"
+.LC30:
+	.string "LINE 2"
+.LC35:
+	.string "PLEASE TYPE UP TO 80 CHARACTERS:"
+.LC36:
+	.string "RECEIVED: "
+.LC13:
+	.string "TESTING ' ['] FIND EXECUTE IMMEDIATE COUNT LITERAL POSTPONE STATE"
+.LC2:
+	.string "TESTING 2* 2/ LSHIFT RSHIFT"
+.LC16:
+	.string "TESTING <# # #S #> HOLD SIGN BASE >NUMBER HEX DECIMAL"
+.LC6:
+	.string "TESTING >R R> R@"
+.LC7:
+	.string "TESTING ADD/SUBTRACT: + - 1+ 1- ABS NEGATE"
+.LC1:
+	.string "TESTING BOOLEANS: INVERT AND OR XOR"
+.LC4:
+	.string "TESTING CELL WIDTH LITERALS"
+.LC11:
+	.string "TESTING CHAR [CHAR] [ ] BL S_quotes"
+.LC3:
+	.string "TESTING COMPARISONS: 0= = 0< < > U< U> U<= U>= MIN MAX"
+.LC0:
+	.string "TESTING CORE WORDS"
+.LC9:
+	.string "TESTING DIVIDE: FM/MOD SM/REM UM/MOD */ */MOD / /MOD MOD"
+.LC15:
+	.string "TESTING DO LOOP +LOOP I J UNLOOP LEAVE EXIT"
+.LC22:
+	.string "TESTING FILL MOVE"
+.LC10:
+	.string "TESTING HERE , @ ! CELL+ CELLS C, C@ C! CHARS 2@ 2! ALIGN ALIGNED +! ALLOT"
+.LC14:
+	.string "TESTING IF ELSE THEN BEGIN WHILE REPEAT UNTIL RECURSE"
+.LC34:
+	.string "TESTING INPUT: ACCEPT"
+.LC8:
+	.string "TESTING MULTIPLY: S>D * M* UM*"
+.LC23:
+	.string "TESTING OUTPUT: . ._quote CR EMIT SPACE SPACES TYPE U."
+.LC5:
+	.string "TESTING STACK OPS: 2DROP 2DUP 2OVER 2SWAP ?DUP DEPTH DROP DUP OVER ROT SWAP"
+.LC33:
+	.string "UNSIGNED: "
+.LC12:
+	.string "XY"
+.LC27:
+	.string "YOU SHOULD SEE 0-5 SEPARATED BY TWO SPACES:"
+.LC25:
+	.string "YOU SHOULD SEE 0-9 (WITH NO SPACES):"
+.LC24:
+	.string "YOU SHOULD SEE 0-9 SEPARATED BY A SPACE:"
+.LC26:
+	.string "YOU SHOULD SEE A-G SEPARATED BY A SPACE:"
+.LC31:
+	.string "YOU SHOULD SEE THE NUMBER RANGES OF SIGNED AND UNSIGNED NUMBERS:"
+.LC28:
+	.string "YOU SHOULD SEE TWO SEPARATE LINES:"
+.stabs	"v4_Hashbits_Minusud:G2",40,0,0,v4_Hashbits_Minusud
+	.comm  v4_Hashbits_Minusud,8,8
+.stabs	"v4_Lessfalse_Greater:G2",40,0,0,v4_Lessfalse_Greater
+	.comm  v4_Lessfalse_Greater,8,8
+.stabs	"v4_Lesstrue_Greater:G2",40,0,0,v4_Lesstrue_Greater
+	.comm  v4_Lesstrue_Greater,8,8
+.stabs	"v4_abuf:Gar2;0;79;4",40,0,0,v4_abuf
+	.comm  v4_abuf,80,32
+.stabs	"v4_fbuf:Gar2;0;2;4",40,0,0,v4_fbuf
+	.comm  v4_fbuf,3,1
+.stabs	"v4_gn_Minusbuf:Gar2;0;9;4",40,0,0,v4_gn_Minusbuf
+	.comm  v4_gn_Minusbuf,10,1
+.stabs	"v4_hbuf:Gar2;0;255;4",40,0,0,v4_hbuf
+	.comm  v4_hbuf,256,32
+.stabs	"v4_max_Minusbase:G2",40,0,0,v4_max_Minusbase
+	.comm  v4_max_Minusbase,8,8
+.stabs	"v4_max_Minusint:G2",40,0,0,v4_max_Minusint
+	.comm  v4_max_Minusint,8,8
+.stabs	"v4_max_Minusuint:G2",40,0,0,v4_max_Minusuint
+	.comm  v4_max_Minusuint,8,8
+.stabs	"v4_mid_Minusuint:G2",40,0,0,v4_mid_Minusuint
+	.comm  v4_mid_Minusuint,8,8
+.stabs	"v4_mid_Minusuint_Plus1:G2",40,0,0,v4_mid_Minusuint_Plus1
+	.comm  v4_mid_Minusuint_Plus1,8,8
+.stabs	"v4_min_Minusint:G2",40,0,0,v4_min_Minusint
+	.comm  v4_min_Minusint,8,8
+.stabs	"v4_msb:G2",40,0,0,v4_msb
+	.comm  v4_msb,8,8
+.stabs	"v4_sbuf:Gar2;0;2;4",40,0,0,v4_sbuf
+	.comm  v4_sbuf,3,1
+.stabs	"v4_x:G2",40,0,0,v4_x
+	.comm  v4_x,8,8
+.stabs	"v4_z0s:G2",40,0,0,v4_z0s
+	.comm  v4_z0s,8,8
+.stabs	"v4_z1s:G2",40,0,0,v4_z1s
+	.comm  v4_z1s,8,8
+.stabs	"v4_z1st:G2",40,0,0,v4_z1st
+	.comm  v4_z1st,8,8
+.stabs	"v4_z1stc:G2",40,0,0,v4_z1stc
+	.comm  v4_z1stc,8,8
+.stabs	"v4_z2nd:G2",40,0,0,v4_z2nd
+	.comm  v4_z2nd,8,8
+.stabs	"v4_z2ndc:G2",40,0,0,v4_z2ndc
+	.comm  v4_z2ndc,8,8
+.text
+	.align 4
+.stabs "v4_find_Minusmsb:F1",36,0,0,v4_find_Minusmsb
+.globl v4_find_Minusmsb
+	.type	v4_find_Minusmsb,@function
+v4_find_Minusmsb:
+.stabn 68,0,53,.LMa0-v4_find_Minusmsb
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,53,.LMb0-v4_find_Minusmsb
+.LMb0:
+.LBB15:
+.stabn 68,0,54,.LM1-v4_find_Minusmsb
+.LM1:
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS0
+	call v4__dscheck
+.LDS0:
+.L2:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS1
+	call v4__dscheck
+.LDS1:
+	test %rax,%rax
+	je .L3
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS2
+	call v4__dscheck
+.LDS2:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS3
+	call v4__dscheck
+.LDS3:
+	jmp .L2
+.L3:
+	mov %rcx,v4__dsindex(%rip)
+.LBE15:
+.stabn 68,0,54,.LM18-v4_find_Minusmsb
+.LM18:
+	pop %rbx
+	leave
+	ret
+.Lfe15:
+	.size	 v4_find_Minusmsb,.Lfe15-v4_find_Minusmsb
+.stabn	192,0,0,.LBB15-v4_find_Minusmsb
+.stabn	224,0,0,.LBE15-v4_find_Minusmsb
+.Lscope15:
+.stabs	"",36,0,0,.Lscope15-v4_find_Minusmsb
+.text
+	.align 4
+.stabs "v4_gr1:F1",36,0,0,v4_gr1
+.globl v4_gr1
+	.type	v4_gr1,@function
+v4_gr1:
+.stabn 68,0,262,.LMa19-v4_gr1
+.LMa19:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,262,.LMb19-v4_gr1
+.LMb19:
+.LBB55:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	mov -16(%rbp),%rax
+	cmp $4080,%rcx
+	jbe .LDS4
+	call v4__dscheck
+.LDS4:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS5
+	call v4__dscheck
+.LDS5:
+	mov %rcx,v4__dsindex(%rip)
+.LBE55:
+.stabn 68,0,262,.LM27-v4_gr1
+.LM27:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe55:
+	.size	 v4_gr1,.Lfe55-v4_gr1
+.stabn	192,0,0,.LBB55-v4_gr1
+.stabn	224,0,0,.LBE55-v4_gr1
+.Lscope55:
+.stabs	"",36,0,0,.Lscope55-v4_gr1
+.text
+	.align 4
+.stabs "v4_gr2:F1",36,0,0,v4_gr2
+.globl v4_gr2
+	.type	v4_gr2,@function
+v4_gr2:
+.stabn 68,0,263,.LMa28-v4_gr2
+.LMa28:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,263,.LMb28-v4_gr2
+.LMb28:
+.LBB58:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	mov -16(%rbp),%rax
+	cmp $4080,%rcx
+	jbe .LDS6
+	call v4__dscheck
+.LDS6:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -16(%rbp),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS7
+	call v4__dscheck
+.LDS7:
+	mov %rcx,v4__dsindex(%rip)
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE58:
+.stabn 68,0,263,.LM40-v4_gr2
+.LM40:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe58:
+	.size	 v4_gr2,.Lfe58-v4_gr2
+.stabn	192,0,0,.LBB58-v4_gr2
+.stabn	224,0,0,.LBE58-v4_gr2
+.Lscope58:
+.stabs	"",36,0,0,.Lscope58-v4_gr2
+.text
+	.align 4
+.stabs "v4_t_Slashmod:F1",36,0,0,v4_t_Slashmod
+.globl v4_t_Slashmod
+	.type	v4_t_Slashmod,@function
+v4_t_Slashmod:
+.stabn 68,0,459,.LMa41-v4_t_Slashmod
+.LMa41:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,459,.LMb41-v4_t_Slashmod
+.LMb41:
+.LBB70:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	pop %rbx
+	leave
+	jmp v4_sm_Slashrem
+.LBE70:
+.stabn 68,0,459,.LM47-v4_t_Slashmod
+.LM47:
+	pop %rbx
+	leave
+	ret
+.Lfe70:
+	.size	 v4_t_Slashmod,.Lfe70-v4_t_Slashmod
+.stabn	192,0,0,.LBB70-v4_t_Slashmod
+.stabn	224,0,0,.LBE70-v4_t_Slashmod
+.Lscope70:
+.stabs	"",36,0,0,.Lscope70-v4_t_Slashmod
+.text
+	.align 4
+.stabs "v4_t_Slash:F1",36,0,0,v4_t_Slash
+.globl v4_t_Slash
+	.type	v4_t_Slash,@function
+v4_t_Slash:
+.stabn 68,0,460,.LMa48-v4_t_Slash
+.LMa48:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,460,.LMb48-v4_t_Slash
+.LMb48:
+.LBB71:
+.stabn 68,0,459,.LM50-v4_t_Slash
+.LM50:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM54-v4_t_Slash
+.LM54:
+	call v4_swap
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE71:
+.stabn 68,0,460,.LM57-v4_t_Slash
+.LM57:
+	pop %rbx
+	leave
+	ret
+.Lfe71:
+	.size	 v4_t_Slash,.Lfe71-v4_t_Slash
+.stabn	192,0,0,.LBB71-v4_t_Slash
+.stabn	224,0,0,.LBE71-v4_t_Slash
+.Lscope71:
+.stabs	"",36,0,0,.Lscope71-v4_t_Slash
+.text
+	.align 4
+.stabs "v4_tmod:F1",36,0,0,v4_tmod
+.globl v4_tmod
+	.type	v4_tmod,@function
+v4_tmod:
+.stabn 68,0,461,.LMa58-v4_tmod
+.LMa58:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,461,.LMb58-v4_tmod
+.LMb58:
+.LBB72:
+.stabn 68,0,459,.LM60-v4_tmod
+.LM60:
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM64-v4_tmod
+.LM64:
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE72:
+.stabn 68,0,461,.LM66-v4_tmod
+.LM66:
+	pop %rbx
+	leave
+	ret
+.Lfe72:
+	.size	 v4_tmod,.Lfe72-v4_tmod
+.stabn	192,0,0,.LBB72-v4_tmod
+.stabn	224,0,0,.LBE72-v4_tmod
+.Lscope72:
+.stabs	"",36,0,0,.Lscope72-v4_tmod
+.text
+	.align 4
+.stabs "v4_t_Star_Slashmod:F1",36,0,0,v4_t_Star_Slashmod
+.globl v4_t_Star_Slashmod
+	.type	v4_t_Star_Slashmod,@function
+v4_t_Star_Slashmod:
+.stabn 68,0,462,.LMa67-v4_t_Star_Slashmod
+.LMa67:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,462,.LMb67-v4_t_Star_Slashmod
+.LMb67:
+.LBB73:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	pop %rbx
+	leave
+	jmp v4_sm_Slashrem
+.LBE73:
+.stabn 68,0,462,.LM73-v4_t_Star_Slashmod
+.LM73:
+	pop %rbx
+	leave
+	ret
+.Lfe73:
+	.size	 v4_t_Star_Slashmod,.Lfe73-v4_t_Star_Slashmod
+.stabn	192,0,0,.LBB73-v4_t_Star_Slashmod
+.stabn	224,0,0,.LBE73-v4_t_Star_Slashmod
+.Lscope73:
+.stabs	"",36,0,0,.Lscope73-v4_t_Star_Slashmod
+.text
+	.align 4
+.stabs "v4_t_Star_Slash:F1",36,0,0,v4_t_Star_Slash
+.globl v4_t_Star_Slash
+	.type	v4_t_Star_Slash,@function
+v4_t_Star_Slash:
+.stabn 68,0,463,.LMa74-v4_t_Star_Slash
+.LMa74:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,463,.LMb74-v4_t_Star_Slash
+.LMb74:
+.LBB74:
+.stabn 68,0,462,.LM76-v4_t_Star_Slash
+.LM76:
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM80-v4_t_Star_Slash
+.LM80:
+	call v4_swap
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE74:
+.stabn 68,0,463,.LM83-v4_t_Star_Slash
+.LM83:
+	pop %rbx
+	leave
+	ret
+.Lfe74:
+	.size	 v4_t_Star_Slash,.Lfe74-v4_t_Star_Slash
+.stabn	192,0,0,.LBB74-v4_t_Star_Slash
+.stabn	224,0,0,.LBE74-v4_t_Star_Slash
+.Lscope74:
+.stabs	"",36,0,0,.Lscope74-v4_t_Star_Slash
+.text
+	.align 4
+.stabs "v4_gc1:F1",36,0,0,v4_gc1
+.globl v4_gc1
+	.type	v4_gc1,@function
+v4_gc1:
+.stabn 68,0,633,.LMa84-v4_gc1
+.LMa84:
+.stabn 68,0,633,.LMb84-v4_gc1
+.LMb84:
+.LBB102:
+	mov $88,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS8
+	call v4__dscheck
+.LDS8:
+	mov %rcx,v4__dsindex(%rip)
+.LBE102:
+.stabn 68,0,633,.LM88-v4_gc1
+.LM88:
+	ret
+.Lfe102:
+	.size	 v4_gc1,.Lfe102-v4_gc1
+.stabn	192,0,0,.LBB102-v4_gc1
+.stabn	224,0,0,.LBE102-v4_gc1
+.Lscope102:
+.stabs	"",36,0,0,.Lscope102-v4_gc1
+.text
+	.align 4
+.stabs "v4_gc2:F1",36,0,0,v4_gc2
+.globl v4_gc2
+	.type	v4_gc2,@function
+v4_gc2:
+.stabn 68,0,634,.LMa89-v4_gc2
+.LMa89:
+.stabn 68,0,634,.LMb89-v4_gc2
+.LMb89:
+.LBB103:
+	mov $72,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS9
+	call v4__dscheck
+.LDS9:
+	mov %rcx,v4__dsindex(%rip)
+.LBE103:
+.stabn 68,0,634,.LM93-v4_gc2
+.LM93:
+	ret
+.Lfe103:
+	.size	 v4_gc2,.Lfe103-v4_gc2
+.stabn	192,0,0,.LBB103-v4_gc2
+.stabn	224,0,0,.LBE103-v4_gc2
+.Lscope103:
+.stabs	"",36,0,0,.Lscope103-v4_gc2
+.text
+	.align 4
+.stabs "v4_gc3:F1",36,0,0,v4_gc3
+.globl v4_gc3
+	.type	v4_gc3,@function
+v4_gc3:
+.stabn 68,0,637,.LMa94-v4_gc3
+.LMa94:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,637,.LMb94-v4_gc3
+.LMb94:
+.LBB104:
+	call v4_Leftbracket
+.stabn 68,0,633,.LM97-v4_gc3
+.LM97:
+	mov $88,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,637,.LM99-v4_gc3
+.LM99:
+	cmp $4080,%rcx
+	jbe .LDS10
+	call v4__dscheck
+.LDS10:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	pop %rbx
+	leave
+	jmp v4_literal
+.LBE104:
+.stabn 68,0,637,.LM102-v4_gc3
+.LM102:
+	pop %rbx
+	leave
+	ret
+.Lfe104:
+	.size	 v4_gc3,.Lfe104-v4_gc3
+.stabn	192,0,0,.LBB104-v4_gc3
+.stabn	224,0,0,.LBE104-v4_gc3
+.Lscope104:
+.stabs	"",36,0,0,.Lscope104-v4_gc3
+.text
+	.align 4
+.stabs "v4_gc4:F1",36,0,0,v4_gc4
+.globl v4_gc4
+	.type	v4_gc4,@function
+v4_gc4:
+.stabn 68,0,639,.LMa103-v4_gc4
+.LMa103:
+.stabn 68,0,639,.LMb103-v4_gc4
+.LMb103:
+.LBB108:
+	lea .LC12(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS11
+	call v4__dscheck
+.LDS11:
+	mov %rcx,v4__dsindex(%rip)
+.LBE108:
+.stabn 68,0,639,.LM109-v4_gc4
+.LM109:
+	ret
+.Lfe108:
+	.size	 v4_gc4,.Lfe108-v4_gc4
+.stabn	192,0,0,.LBB108-v4_gc4
+.stabn	224,0,0,.LBE108-v4_gc4
+.Lscope108:
+.stabs	"",36,0,0,.Lscope108-v4_gc4
+.text
+	.align 4
+.stabs "v4_gt1:F1",36,0,0,v4_gt1
+.globl v4_gt1
+	.type	v4_gt1,@function
+v4_gt1:
+.stabn 68,0,646,.LMa110-v4_gt1
+.LMa110:
+.stabn 68,0,646,.LMb110-v4_gt1
+.LMb110:
+.LBB109:
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS12
+	call v4__dscheck
+.LDS12:
+	mov %rcx,v4__dsindex(%rip)
+.LBE109:
+.stabn 68,0,646,.LM114-v4_gt1
+.LM114:
+	ret
+.Lfe109:
+	.size	 v4_gt1,.Lfe109-v4_gt1
+.stabn	192,0,0,.LBB109-v4_gt1
+.stabn	224,0,0,.LBE109-v4_gt1
+.Lscope109:
+.stabs	"",36,0,0,.Lscope109-v4_gt1
+.text
+	.align 4
+.stabs "v4_gt2:F1",36,0,0,v4_gt2
+.globl v4_gt2
+	.type	v4_gt2,@function
+v4_gt2:
+.stabn 68,0,648,.LMa115-v4_gt2
+.LMa115:
+.stabn 68,0,648,.LMb115-v4_gt2
+.LMb115:
+.LBB110:
+	lea v4_gt1(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS13
+	call v4__dscheck
+.LDS13:
+	mov %rcx,v4__dsindex(%rip)
+.LBE110:
+.stabn 68,0,648,.LM119-v4_gt2
+.LM119:
+	ret
+.Lfe110:
+	.size	 v4_gt2,.Lfe110-v4_gt2
+.stabn	192,0,0,.LBB110-v4_gt2
+.stabn	224,0,0,.LBE110-v4_gt2
+.Lscope110:
+.stabs	"",36,0,0,.Lscope110-v4_gt2
+.text
+	.align 4
+.stabs "v4_gt8:F1",36,0,0,v4_gt8
+.globl v4_gt8
+	.type	v4_gt8,@function
+v4_gt8:
+.stabn 68,0,666,.LMa120-v4_gt8
+.LMa120:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,666,.LMb120-v4_gt8
+.LMb120:
+.LBB112:
+	call v4_state
+	pop %rbx
+	leave
+	jmp v4_Fetch
+.LBE112:
+.stabn 68,0,666,.LM124-v4_gt8
+.LM124:
+	pop %rbx
+	leave
+	ret
+.Lfe112:
+	.size	 v4_gt8,.Lfe112-v4_gt8
+.stabn	192,0,0,.LBB112-v4_gt8
+.stabn	224,0,0,.LBE112-v4_gt8
+.Lscope112:
+.stabs	"",36,0,0,.Lscope112-v4_gt8
+.text
+	.align 4
+.stabs "v4_gt9:F1",36,0,0,v4_gt9
+.globl v4_gt9
+	.type	v4_gt9,@function
+v4_gt9:
+.stabn 68,0,668,.LMa125-v4_gt9
+.LMa125:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,668,.LMb125-v4_gt9
+.LMb125:
+.LBB114:
+	lea v4_gt8(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS14
+	call v4__dscheck
+.LDS14:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_literal
+.LBE114:
+.stabn 68,0,668,.LM130-v4_gt9
+.LM130:
+	pop %rbx
+	leave
+	ret
+.Lfe114:
+	.size	 v4_gt9,.Lfe114-v4_gt9
+.stabn	192,0,0,.LBB114-v4_gt9
+.stabn	224,0,0,.LBE114-v4_gt9
+.Lscope114:
+.stabs	"",36,0,0,.Lscope114-v4_gt9
+.text
+	.align 4
+.stabs "v4_gi1:F1",36,0,0,v4_gi1
+.globl v4_gi1
+	.type	v4_gi1,@function
+v4_gi1:
+.stabn 68,0,674,.LMa131-v4_gi1
+.LMa131:
+.stabn 68,0,674,.LMb131-v4_gi1
+.LMb131:
+.LBB115:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS15
+	call v4__dscheck
+.LDS15:
+	test %rax,%rax
+	je .L20
+	mov $123,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS16
+	call v4__dscheck
+.LDS16:
+.L20:
+	mov %rcx,v4__dsindex(%rip)
+.LBE115:
+.stabn 68,0,674,.LM138-v4_gi1
+.LM138:
+	ret
+.Lfe115:
+	.size	 v4_gi1,.Lfe115-v4_gi1
+.stabn	192,0,0,.LBB115-v4_gi1
+.stabn	224,0,0,.LBE115-v4_gi1
+.Lscope115:
+.stabs	"",36,0,0,.Lscope115-v4_gi1
+.text
+	.align 4
+.stabs "v4_gi2:F1",36,0,0,v4_gi2
+.globl v4_gi2
+	.type	v4_gi2,@function
+v4_gi2:
+.stabn 68,0,675,.LMa139-v4_gi2
+.LMa139:
+.stabn 68,0,675,.LMb139-v4_gi2
+.LMb139:
+.LBB116:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS17
+	call v4__dscheck
+.LDS17:
+	test %rax,%rax
+	je .L22
+	mov $123,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS18
+	call v4__dscheck
+.LDS18:
+	jmp .L23
+.L22:
+	mov $234,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS19
+	call v4__dscheck
+.LDS19:
+.L23:
+	mov %rcx,v4__dsindex(%rip)
+.LBE116:
+.stabn 68,0,675,.LM150-v4_gi2
+.LM150:
+	ret
+.Lfe116:
+	.size	 v4_gi2,.Lfe116-v4_gi2
+.stabn	192,0,0,.LBB116-v4_gi2
+.stabn	224,0,0,.LBE116-v4_gi2
+.Lscope116:
+.stabs	"",36,0,0,.Lscope116-v4_gi2
+.text
+	.align 4
+.stabs "v4_gi3:F1",36,0,0,v4_gi3
+.globl v4_gi3
+	.type	v4_gi3,@function
+v4_gi3:
+.stabn 68,0,683,.LMa151-v4_gi3
+.LMa151:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,683,.LMb151-v4_gi3
+.LMb151:
+.LBB117:
+	mov v4__dsindex(%rip),%rcx
+.L25:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS20
+	call v4__dscheck
+.LDS20:
+	cmp %rdx,%rax
+	jge .L26
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS21
+	call v4__dscheck
+.LDS21:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS22
+	call v4__dscheck
+.LDS22:
+	jmp .L25
+.L26:
+	mov %rcx,v4__dsindex(%rip)
+.LBE117:
+.stabn 68,0,683,.LM170-v4_gi3
+.LM170:
+	pop %rbx
+	leave
+	ret
+.Lfe117:
+	.size	 v4_gi3,.Lfe117-v4_gi3
+.stabn	192,0,0,.LBB117-v4_gi3
+.stabn	224,0,0,.LBE117-v4_gi3
+.Lscope117:
+.stabs	"",36,0,0,.Lscope117-v4_gi3
+.text
+	.align 4
+.stabs "v4_gi4:F1",36,0,0,v4_gi4
+.globl v4_gi4
+	.type	v4_gi4,@function
+v4_gi4:
+.stabn 68,0,689,.LMa171-v4_gi4
+.LMa171:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,689,.LMb171-v4_gi4
+.LMb171:
+.LBB118:
+	mov v4__dsindex(%rip),%rcx
+.L28:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS23
+	call v4__dscheck
+.LDS23:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS24
+	call v4__dscheck
+.LDS24:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS25
+	call v4__dscheck
+.LDS25:
+	cmp %rdx,%rax
+	jle .L28
+	mov %rcx,v4__dsindex(%rip)
+.LBE118:
+.stabn 68,0,689,.LM189-v4_gi4
+.LM189:
+	pop %rbx
+	leave
+	ret
+.Lfe118:
+	.size	 v4_gi4,.Lfe118-v4_gi4
+.stabn	192,0,0,.LBB118-v4_gi4
+.stabn	224,0,0,.LBE118-v4_gi4
+.Lscope118:
+.stabs	"",36,0,0,.Lscope118-v4_gi4
+.text
+	.align 4
+.stabs "v4_gi5:F1",36,0,0,v4_gi5
+.globl v4_gi5
+	.type	v4_gi5,@function
+v4_gi5:
+.stabn 68,0,694,.LMa190-v4_gi5
+.LMa190:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,694,.LMb190-v4_gi5
+.LMb190:
+.LBB119:
+	mov v4__dsindex(%rip),%rcx
+.L31:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $2,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS26
+	call v4__dscheck
+.LDS26:
+	cmp %rdx,%rax
+	jle .L32
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS27
+	call v4__dscheck
+.LDS27:
+	cmp %rdx,%rax
+	jge .L32
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS28
+	call v4__dscheck
+.LDS28:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS29
+	call v4__dscheck
+.LDS29:
+	jmp .L31
+.L32:
+	mov %rcx,v4__dsindex(%rip)
+.LBE119:
+.stabn 68,0,694,.LM218-v4_gi5
+.LM218:
+	pop %rbx
+	leave
+	ret
+.Lfe119:
+	.size	 v4_gi5,.Lfe119-v4_gi5
+.stabn	192,0,0,.LBB119-v4_gi5
+.stabn	224,0,0,.LBE119-v4_gi5
+.Lscope119:
+.stabs	"",36,0,0,.Lscope119-v4_gi5
+.text
+	.align 4
+.stabs "v4_gi6:F1",36,0,0,v4_gi6
+.globl v4_gi6
+	.type	v4_gi6,@function
+v4_gi6:
+.stabn 68,0,701,.LMa219-v4_gi6
+.LMa219:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,701,.LMb219-v4_gi6
+.LMb219:
+.LBB120:
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS30
+	call v4__dscheck
+.LDS30:
+	test %rax,%rax
+	je .L34
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	call v4_Greaterr
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	dec %rax
+	cmp $4080,%rcx
+	jbe .LDS31
+	call v4__dscheck
+.LDS31:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS32
+	call v4__dscheck
+.LDS32:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gi6
+	pop %rbx
+	leave
+	jmp v4_r_Greater
+	mov v4__dsindex(%rip),%rcx
+.L34:
+	mov %rcx,v4__dsindex(%rip)
+.LBE120:
+.stabn 68,0,701,.LM233-v4_gi6
+.LM233:
+	pop %rbx
+	leave
+	ret
+.Lfe120:
+	.size	 v4_gi6,.Lfe120-v4_gi6
+.stabn	192,0,0,.LBB120-v4_gi6
+.stabn	224,0,0,.LBE120-v4_gi6
+.Lscope120:
+.stabs	"",36,0,0,.Lscope120-v4_gi6
+.text
+	.align 4
+.stabs "v4_gd1:F1",36,0,0,v4_gd1
+.globl v4_gd1
+	.type	v4_gd1,@function
+v4_gd1:
+.stabn 68,0,711,.LMa234-v4_gd1
+.LMa234:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,711,.LMb234-v4_gd1
+.LMb234:
+.LBB121:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS33
+	call v4__dscheck
+.LDS33:
+.L37:
+	mov -24(%rbp),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS34
+	call v4__dscheck
+.LDS34:
+	test %rdx,%rdx
+	jne .L37
+	mov -16(%rbp),%rax
+	mov %rcx,v4__dsindex(%rip)
+.LBE121:
+.stabn 68,0,711,.LM255-v4_gd1
+.LM255:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe121:
+	.size	 v4_gd1,.Lfe121-v4_gd1
+.stabn	192,0,0,.LBB121-v4_gd1
+.stabn	224,0,0,.LBE121-v4_gd1
+.Lscope121:
+.stabs	"",36,0,0,.Lscope121-v4_gd1
+.text
+	.align 4
+.stabs "v4_gd2:F1",36,0,0,v4_gd2
+.globl v4_gd2
+	.type	v4_gd2,@function
+v4_gd2:
+.stabn 68,0,716,.LMa256-v4_gd2
+.LMa256:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,716,.LMb256-v4_gd2
+.LMb256:
+.LBB123:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS35
+	call v4__dscheck
+.LDS35:
+.L41:
+	mov -24(%rbp),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	mov -24(%rbp),%rdx
+	add %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS36
+	call v4__dscheck
+.LDS36:
+	test %rax,%rax
+	jl .L43
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	test %rdx,%rdx
+	jl .L41
+	jmp .L42
+.L43:
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	test %rdx,%rdx
+	jge .L41
+.L42:
+	mov -16(%rbp),%rax
+	mov %rcx,v4__dsindex(%rip)
+.LBE123:
+.stabn 68,0,716,.LM288-v4_gd2
+.LM288:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe123:
+	.size	 v4_gd2,.Lfe123-v4_gd2
+.stabn	192,0,0,.LBB123-v4_gd2
+.stabn	224,0,0,.LBE123-v4_gd2
+.Lscope123:
+.stabs	"",36,0,0,.Lscope123-v4_gd2
+.text
+	.align 4
+.stabs "v4_gd3:F1",36,0,0,v4_gd3
+.globl v4_gd3
+	.type	v4_gd3,@function
+v4_gd3:
+.stabn 68,0,721,.LMa289-v4_gd3
+.LMa289:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $32,%rsp
+.stabn 68,0,721,.LMb289-v4_gd3
+.LMb289:
+.LBB124:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS37
+	call v4__dscheck
+.LDS37:
+.L46:
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov %rax,-32(%rbp)
+	mov %rdx,-40(%rbp)
+.L49:
+	mov -24(%rbp),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -40(%rbp),%rdx
+	inc %rdx
+	mov -32(%rbp),%rax
+	mov %rdx,-40(%rbp)
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS38
+	call v4__dscheck
+.LDS38:
+	test %rdx,%rdx
+	jne .L49
+	mov -32(%rbp),%rax
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L46
+	mov -16(%rbp),%rax
+	mov %rcx,v4__dsindex(%rip)
+.LBE124:
+.stabn 68,0,721,.LM330-v4_gd3
+.LM330:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe124:
+	.size	 v4_gd3,.Lfe124-v4_gd3
+.stabn	192,0,0,.LBB124-v4_gd3
+.stabn	224,0,0,.LBE124-v4_gd3
+.Lscope124:
+.stabs	"",36,0,0,.Lscope124-v4_gd3
+.text
+	.align 4
+.stabs "v4_gd4:F1",36,0,0,v4_gd4
+.globl v4_gd4
+	.type	v4_gd4,@function
+v4_gd4:
+.stabn 68,0,726,.LMa331-v4_gd4
+.LMa331:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $32,%rsp
+.stabn 68,0,726,.LMb331-v4_gd4
+.LMb331:
+.LBB126:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS39
+	call v4__dscheck
+.LDS39:
+.L53:
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov %rax,-32(%rbp)
+	mov %rdx,-40(%rbp)
+.L56:
+	mov -24(%rbp),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -40(%rbp),%rdx
+	inc %rdx
+	mov -32(%rbp),%rax
+	mov %rdx,-40(%rbp)
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS40
+	call v4__dscheck
+.LDS40:
+	test %rdx,%rdx
+	jne .L56
+	mov -32(%rbp),%rax
+	xor %rax,%rax
+	dec %rax
+	mov -24(%rbp),%rdx
+	add %rax,%rdx
+	test %rax,%rax
+	jl .L58
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	test %rdx,%rdx
+	jl .L53
+	jmp .L54
+.L58:
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	test %rdx,%rdx
+	jge .L53
+.L54:
+	mov -16(%rbp),%rax
+	mov %rcx,v4__dsindex(%rip)
+.LBE126:
+.stabn 68,0,726,.LM383-v4_gd4
+.LM383:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe126:
+	.size	 v4_gd4,.Lfe126-v4_gd4
+.stabn	192,0,0,.LBB126-v4_gd4
+.stabn	224,0,0,.LBE126-v4_gd4
+.Lscope126:
+.stabs	"",36,0,0,.Lscope126-v4_gd4
+.text
+	.align 4
+.stabs "v4_gd5:F1",36,0,0,v4_gd5
+.globl v4_gd5
+	.type	v4_gd5,@function
+v4_gd5:
+.stabn 68,0,731,.LMa384-v4_gd5
+.LMa384:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,731,.LMb384-v4_gd5
+.LMb384:
+.LBB127:
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS41
+	call v4__dscheck
+.LDS41:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS42
+	call v4__dscheck
+.LDS42:
+.L61:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+	mov $4,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS43
+	call v4__dscheck
+.LDS43:
+	cmp %rdx,%rax
+	jle .L63
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $234,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS44
+	call v4__dscheck
+.LDS44:
+	jmp .L62
+.L63:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L61
+.L62:
+	call v4__rpop
+	call v4__rpop
+	mov %rcx,v4__dsindex(%rip)
+.LBE127:
+.stabn 68,0,731,.LM421-v4_gd5
+.LM421:
+	pop %rbx
+	leave
+	ret
+.Lfe127:
+	.size	 v4_gd5,.Lfe127-v4_gd5
+.stabn	192,0,0,.LBB127-v4_gd5
+.stabn	224,0,0,.LBE127-v4_gd5
+.Lscope127:
+.stabs	"",36,0,0,.Lscope127-v4_gd5
+.text
+	.align 4
+.stabs "v4_gd6:F1",36,0,0,v4_gd6
+.globl v4_gd6
+	.type	v4_gd6,@function
+v4_gd6:
+.stabn 68,0,736,.LMa422-v4_gd6
+.LMa422:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $32,%rsp
+.stabn 68,0,736,.LMb422-v4_gd6
+.LMb422:
+.LBB128:
+.stabn 68,0,737,.LM423-v4_gd6
+.LM423:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS45
+	call v4__dscheck
+.LDS45:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS46
+	call v4__dscheck
+.LDS46:
+.L66:
+	mov -24(%rbp),%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov %rax,-32(%rbp)
+	mov %rdx,-40(%rbp)
+.L69:
+	mov -40(%rbp),%rax
+	mov %rax,%r8
+	mov -24(%rbp),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	mov %rax,%r8
+	mov $3,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	jne .L71
+	mov -40(%rbp),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -24(%rbp),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS47
+	call v4__dscheck
+.LDS47:
+	jmp .L64
+.L71:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS48
+	call v4__dscheck
+.LDS48:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -40(%rbp),%rdx
+	inc %rdx
+	mov -32(%rbp),%rax
+	mov %rdx,-40(%rbp)
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS49
+	call v4__dscheck
+.LDS49:
+	test %rdx,%rdx
+	jne .L69
+	mov -32(%rbp),%rax
+.stabn 68,0,739,.LM491-v4_gd6
+.LM491:
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L66
+	mov -16(%rbp),%rax
+.L64:
+	mov %rcx,v4__dsindex(%rip)
+.LBE128:
+.stabn 68,0,739,.LM503-v4_gd6
+.LM503:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe128:
+	.size	 v4_gd6,.Lfe128-v4_gd6
+.stabn	192,0,0,.LBB128-v4_gd6
+.stabn	224,0,0,.LBE128-v4_gd6
+.Lscope128:
+.stabs	"",36,0,0,.Lscope128-v4_gd6
+.text
+	.align 4
+.stabs "v4_s_Equals:F1",36,0,0,v4_s_Equals
+.globl v4_s_Equals
+	.type	v4_s_Equals,@function
+v4_s_Equals:
+.stabn 68,0,826,.LMa504-v4_s_Equals
+.LMa504:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,826,.LMb504-v4_s_Equals
+.LMb504:
+.LBB130:
+.stabn 68,0,827,.LM505-v4_s_Equals
+.LM505:
+	call v4_Greaterr
+	call v4_swap
+	call v4_r_Fetch
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS50
+	call v4__dscheck
+.LDS50:
+	cmp %rdx,%rax
+	jne .L73
+.stabn 68,0,828,.LM514-v4_s_Equals
+.LM514:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_r_Greater
+	call v4_Questiondup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS51
+	call v4__dscheck
+.LDS51:
+	test %rax,%rax
+	je .L74
+.stabn 68,0,829,.LM518-v4_s_Equals
+.LM518:
+	xor %rax,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS52
+	call v4__dscheck
+.LDS52:
+.L76:
+.stabn 68,0,830,.LM525-v4_s_Equals
+.LM525:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_over
+	call v4_c_Fetch
+	call v4_over
+	call v4_c_Fetch
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	sub %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS53
+	call v4__dscheck
+.LDS53:
+	test %rax,%rax
+	je .L78
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2drop
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS54
+	call v4__dscheck
+.LDS54:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_unloop
+	mov v4__dsindex(%rip),%rcx
+.L78:
+.stabn 68,0,831,.LM542-v4_s_Equals
+.LM542:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	call v4_char_Plus
+	call v4_swap
+	call v4_char_Plus
+.stabn 68,0,832,.LM546-v4_s_Equals
+.LM546:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	jne .L76
+	call v4__rpop
+	call v4__rpop
+.L74:
+.stabn 68,0,834,.LM558-v4_s_Equals
+.LM558:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2drop
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,835,.LM561-v4_s_Equals
+.LM561:
+	cmp $4080,%rcx
+	jbe .LDS55
+	call v4__dscheck
+.LDS55:
+	jmp .L79
+.L73:
+.stabn 68,0,836,.LM563-v4_s_Equals
+.LM563:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_r_Greater
+	call v4_drop
+	call v4_z2drop
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS56
+	call v4__dscheck
+.LDS56:
+.L79:
+.L72:
+	mov %rcx,v4__dsindex(%rip)
+.LBE130:
+.stabn 68,0,837,.LM570-v4_s_Equals
+.LM570:
+	pop %rbx
+	leave
+	ret
+.Lfe130:
+	.size	 v4_s_Equals,.Lfe130-v4_s_Equals
+.stabn	192,0,0,.LBB130-v4_s_Equals
+.stabn	224,0,0,.LBE130-v4_s_Equals
+.Lscope130:
+.stabs	"",36,0,0,.Lscope130-v4_s_Equals
+.text
+	.align 4
+.stabs "v4_gp1:F1",36,0,0,v4_gp1
+.globl v4_gp1
+	.type	v4_gp1,@function
+v4_gp1:
+.stabn 68,0,839,.LMa571-v4_gp1
+.LMa571:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,839,.LMb571-v4_gp1
+.LMb571:
+.LBB131:
+	call v4_Less_Hash
+	mov $65,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS57
+	call v4__dscheck
+.LDS57:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_hold
+	mov $66,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS58
+	call v4__dscheck
+.LDS58:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_hold
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS59
+	call v4__dscheck
+.LDS59:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Hash_Greater
+	lea .LC17(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS60
+	call v4__dscheck
+.LDS60:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_s_Equals
+.LBE131:
+.stabn 68,0,839,.LM590-v4_gp1
+.LM590:
+	pop %rbx
+	leave
+	ret
+.Lfe131:
+	.size	 v4_gp1,.Lfe131-v4_gp1
+.stabn	192,0,0,.LBB131-v4_gp1
+.stabn	224,0,0,.LBE131-v4_gp1
+.Lscope131:
+.stabs	"",36,0,0,.Lscope131-v4_gp1
+.text
+	.align 4
+.stabs "v4_gp2:F1",36,0,0,v4_gp2
+.globl v4_gp2
+	.type	v4_gp2,@function
+v4_gp2:
+.stabn 68,0,842,.LMa591-v4_gp2
+.LMa591:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,842,.LMb591-v4_gp2
+.LMb591:
+.LBB135:
+	call v4_Less_Hash
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS61
+	call v4__dscheck
+.LDS61:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sign
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS62
+	call v4__dscheck
+.LDS62:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sign
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS63
+	call v4__dscheck
+.LDS63:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sign
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS64
+	call v4__dscheck
+.LDS64:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Hash_Greater
+	lea .LC18(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS65
+	call v4__dscheck
+.LDS65:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_s_Equals
+.LBE135:
+.stabn 68,0,842,.LM613-v4_gp2
+.LM613:
+	pop %rbx
+	leave
+	ret
+.Lfe135:
+	.size	 v4_gp2,.Lfe135-v4_gp2
+.stabn	192,0,0,.LBB135-v4_gp2
+.stabn	224,0,0,.LBE135-v4_gp2
+.Lscope135:
+.stabs	"",36,0,0,.Lscope135-v4_gp2
+.text
+	.align 4
+.stabs "v4_gp3:F1",36,0,0,v4_gp3
+.globl v4_gp3
+	.type	v4_gp3,@function
+v4_gp3:
+.stabn 68,0,845,.LMa614-v4_gp3
+.LMa614:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,845,.LMb614-v4_gp3
+.LMb614:
+.LBB137:
+	call v4_Less_Hash
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS66
+	call v4__dscheck
+.LDS66:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Hash
+	call v4_Hash
+	call v4_Hash_Greater
+	lea .LC19(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS67
+	call v4__dscheck
+.LDS67:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_s_Equals
+.LBE137:
+.stabn 68,0,845,.LM629-v4_gp3
+.LM629:
+	pop %rbx
+	leave
+	ret
+.Lfe137:
+	.size	 v4_gp3,.Lfe137-v4_gp3
+.stabn	192,0,0,.LBB137-v4_gp3
+.stabn	224,0,0,.LBE137-v4_gp3
+.Lscope137:
+.stabs	"",36,0,0,.Lscope137-v4_gp3
+.text
+	.align 4
+.stabs "v4_gp4:F1",36,0,0,v4_gp4
+.globl v4_gp4
+	.type	v4_gp4,@function
+v4_gp4:
+.stabn 68,0,848,.LMa630-v4_gp4
+.LMa630:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,848,.LMb630-v4_gp4
+.LMb630:
+.LBB139:
+	call v4_Less_Hash
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS68
+	call v4__dscheck
+.LDS68:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Hashs
+	call v4_Hash_Greater
+	lea .LC20(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS69
+	call v4__dscheck
+.LDS69:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_s_Equals
+.LBE139:
+.stabn 68,0,848,.LM644-v4_gp4
+.LM644:
+	pop %rbx
+	leave
+	ret
+.Lfe139:
+	.size	 v4_gp4,.Lfe139-v4_gp4
+.stabn	192,0,0,.LBB139-v4_gp4
+.stabn	224,0,0,.LBE139-v4_gp4
+.Lscope139:
+.stabs	"",36,0,0,.Lscope139-v4_gp4
+.text
+	.align 4
+.stabs "v4_count_Minusbits:F1",36,0,0,v4_count_Minusbits
+.globl v4_count_Minusbits
+	.type	v4_count_Minusbits,@function
+v4_count_Minusbits:
+.stabn 68,0,852,.LMa645-v4_count_Minusbits
+.LMa645:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,852,.LMb645-v4_count_Minusbits
+.LMb645:
+.LBB142:
+.stabn 68,0,853,.LM646-v4_count_Minusbits
+.LM646:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS70
+	call v4__dscheck
+.LDS70:
+.L85:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS71
+	call v4__dscheck
+.LDS71:
+	test %rax,%rax
+	je .L86
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS72
+	call v4__dscheck
+.LDS72:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -16(%rbp),%rax
+	add %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS73
+	call v4__dscheck
+.LDS73:
+	jmp .L85
+.L86:
+	mov %rcx,v4__dsindex(%rip)
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE142:
+.stabn 68,0,853,.LM673-v4_count_Minusbits
+.LM673:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe142:
+	.size	 v4_count_Minusbits,.Lfe142-v4_count_Minusbits
+.stabn	192,0,0,.LBB142-v4_count_Minusbits
+.stabn	224,0,0,.LBE142-v4_count_Minusbits
+.Lscope142:
+.stabs	"",36,0,0,.Lscope142-v4_count_Minusbits
+.text
+	.align 4
+.stabs "v4_gp5:F1",36,0,0,v4_gp5
+.globl v4_gp5
+	.type	v4_gp5,@function
+v4_gp5:
+.stabn 68,0,856,.LMa674-v4_gp5
+.LMa674:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,856,.LMb674-v4_gp5
+.LMb674:
+.LBB144:
+.stabn 68,0,857,.LM675-v4_gp5
+.LM675:
+	call v4_base
+	call v4_Fetch
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,858,.LM679-v4_gp5
+.LM679:
+	mov $37,%rax
+	mov %rax,%r8
+	mov $2,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS74
+	call v4__dscheck
+.LDS74:
+.L89:
+.stabn 68,0,859,.LM689-v4_gp5
+.LM689:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+	call v4_base
+	call v4_Store
+.stabn 68,0,860,.LM692-v4_gp5
+.LM692:
+	call v4_i
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS75
+	call v4__dscheck
+.LDS75:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+	lea .LC21(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS76
+	call v4__dscheck
+.LDS76:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Equals
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	and %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS77
+	call v4__dscheck
+.LDS77:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,861,.LM708-v4_gp5
+.LM708:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS78
+	call v4__dscheck
+.LDS78:
+	test %rdx,%rdx
+	jne .L89
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,862,.LM719-v4_gp5
+.LM719:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	call v4_base
+	pop %rbx
+	leave
+	jmp v4_Store
+.LBE144:
+.stabn 68,0,862,.LM723-v4_gp5
+.LM723:
+	pop %rbx
+	leave
+	ret
+.Lfe144:
+	.size	 v4_gp5,.Lfe144-v4_gp5
+.stabn	192,0,0,.LBB144-v4_gp5
+.stabn	224,0,0,.LBE144-v4_gp5
+.Lscope144:
+.stabs	"",36,0,0,.Lscope144-v4_gp5
+.text
+	.align 4
+.stabs "v4_gp6:F1",36,0,0,v4_gp6
+.globl v4_gp6
+	.type	v4_gp6,@function
+v4_gp6:
+.stabn 68,0,865,.LMa724-v4_gp6
+.LMa724:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,865,.LMb724-v4_gp6
+.LMb724:
+.LBB146:
+.stabn 68,0,866,.LM725-v4_gp6
+.LM725:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS79
+	call v4__dscheck
+.LDS79:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_base
+	call v4_Store
+.stabn 68,0,868,.LM732-v4_gp6
+.LM732:
+	call v4_Less_Hash
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS80
+	call v4__dscheck
+.LDS80:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Hashs
+	call v4_z2drop
+.stabn 68,0,869,.LM739-v4_gp6
+.LM739:
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS81
+	call v4__dscheck
+.LDS81:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,870,.LM745-v4_gp6
+.LM745:
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,871,.LM748-v4_gp6
+.LM748:
+	call v4_dup
+	mov v4_Hashbits_Minusud(%rip),%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	cmp $4080,%rcx
+	jbe .LDS82
+	call v4__dscheck
+.LDS82:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS83
+	call v4__dscheck
+.LDS83:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+.stabn 68,0,872,.LM757-v4_gp6
+.LM757:
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS84
+	call v4__dscheck
+.LDS84:
+.L93:
+.stabn 68,0,873,.LM764-v4_gp6
+.LM764:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_over
+	call v4_c_Fetch
+	mov $49,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	and %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS85
+	call v4__dscheck
+.LDS85:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,874,.LM778-v4_gp6
+.LM778:
+	cmp $4080,%rcx
+	jbe .LDS86
+	call v4__dscheck
+.LDS86:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_char_Plus
+	call v4_r_Greater
+.stabn 68,0,875,.LM781-v4_gp6
+.LM781:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	jne .L93
+	call v4__rpop
+	call v4__rpop
+	call v4_swap
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE146:
+.stabn 68,0,875,.LM795-v4_gp6
+.LM795:
+	pop %rbx
+	leave
+	ret
+.Lfe146:
+	.size	 v4_gp6,.Lfe146-v4_gp6
+.stabn	192,0,0,.LBB146-v4_gp6
+.stabn	224,0,0,.LBE146-v4_gp6
+.Lscope146:
+.stabs	"",36,0,0,.Lscope146-v4_gp6
+.text
+	.align 4
+.stabs "v4_gp7:F1",36,0,0,v4_gp7
+.globl v4_gp7
+	.type	v4_gp7,@function
+v4_gp7:
+.stabn 68,0,900,.LMa796-v4_gp7
+.LMa796:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,900,.LMb796-v4_gp7
+.LMb796:
+.LBB147:
+.stabn 68,0,901,.LM797-v4_gp7
+.LM797:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	mov $36,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS87
+	call v4__dscheck
+.LDS87:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_base
+	call v4_Store
+.stabn 68,0,902,.LM804-v4_gp7
+.LM804:
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,903,.LM806-v4_gp7
+.LM806:
+	mov $10,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS88
+	call v4__dscheck
+.LDS88:
+.L97:
+.stabn 68,0,904,.LM815-v4_gp7
+.LM815:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS89
+	call v4__dscheck
+.LDS89:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,905,.LM821-v4_gp7
+.LM821:
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	cmp $4080,%rcx
+	jbe .LDS90
+	call v4__dscheck
+.LDS90:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS91
+	call v4__dscheck
+.LDS91:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	call v4_c_Fetch
+	mov $48,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS92
+	call v4__dscheck
+.LDS92:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	and %rdx,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	and %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS93
+	call v4__dscheck
+.LDS93:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,906,.LM853-v4_gp7
+.LM853:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS94
+	call v4__dscheck
+.LDS94:
+	test %rdx,%rdx
+	jne .L97
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,907,.LM864-v4_gp7
+.LM864:
+	mov $36,%rax
+	mov %rax,%r8
+	mov $10,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L100:
+.stabn 68,0,908,.LM873-v4_gp7
+.LM873:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS95
+	call v4__dscheck
+.LDS95:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,909,.LM879-v4_gp7
+.LM879:
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	cmp $4080,%rcx
+	jbe .LDS96
+	call v4__dscheck
+.LDS96:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS97
+	call v4__dscheck
+.LDS97:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	call v4_c_Fetch
+	mov $65,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS98
+	call v4__dscheck
+.LDS98:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+	mov $10,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	sub %rdx,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	and %rdx,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	and %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS99
+	call v4__dscheck
+.LDS99:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,910,.LM918-v4_gp7
+.LM918:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS100
+	call v4__dscheck
+.LDS100:
+	test %rdx,%rdx
+	jne .L100
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,911,.LM929-v4_gp7
+.LM929:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_r_Greater
+	call v4_base
+	pop %rbx
+	leave
+	jmp v4_Store
+.LBE147:
+.stabn 68,0,911,.LM933-v4_gp7
+.LM933:
+	pop %rbx
+	leave
+	ret
+.Lfe147:
+	.size	 v4_gp7,.Lfe147-v4_gp7
+.stabn	192,0,0,.LBB147-v4_gp7
+.stabn	224,0,0,.LBE147-v4_gp7
+.Lscope147:
+.stabs	"",36,0,0,.Lscope147-v4_gp7
+.text
+	.align 4
+.stabs "v4_gn_Minusstring:F1",36,0,0,v4_gn_Minusstring
+.globl v4_gn_Minusstring
+	.type	v4_gn_Minusstring,@function
+v4_gn_Minusstring:
+.stabn 68,0,919,.LMa934-v4_gn_Minusstring
+.LMa934:
+.stabn 68,0,919,.LMb934-v4_gn_Minusstring
+.LMb934:
+.LBB149:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS101
+	call v4__dscheck
+.LDS101:
+	mov %rcx,v4__dsindex(%rip)
+.LBE149:
+.stabn 68,0,919,.LM940-v4_gn_Minusstring
+.LM940:
+	ret
+.Lfe149:
+	.size	 v4_gn_Minusstring,.Lfe149-v4_gn_Minusstring
+.stabn	192,0,0,.LBB149-v4_gn_Minusstring
+.stabn	224,0,0,.LBE149-v4_gn_Minusstring
+.Lscope149:
+.stabs	"",36,0,0,.Lscope149-v4_gn_Minusstring
+.text
+	.align 4
+.stabs "v4_gn_Minusconsumed:F1",36,0,0,v4_gn_Minusconsumed
+.globl v4_gn_Minusconsumed
+	.type	v4_gn_Minusconsumed,@function
+v4_gn_Minusconsumed:
+.stabn 68,0,920,.LMa941-v4_gn_Minusconsumed
+.LMa941:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,920,.LMb941-v4_gn_Minusconsumed
+.LMb941:
+.LBB150:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS102
+	call v4__dscheck
+.LDS102:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS103
+	call v4__dscheck
+.LDS103:
+	mov %rcx,v4__dsindex(%rip)
+.LBE150:
+.stabn 68,0,920,.LM948-v4_gn_Minusconsumed
+.LM948:
+	pop %rbx
+	leave
+	ret
+.Lfe150:
+	.size	 v4_gn_Minusconsumed,.Lfe150-v4_gn_Minusconsumed
+.stabn	192,0,0,.LBB150-v4_gn_Minusconsumed
+.stabn	224,0,0,.LBE150-v4_gn_Minusconsumed
+.Lscope150:
+.stabs	"",36,0,0,.Lscope150-v4_gn_Minusconsumed
+.text
+	.align 4
+.stabs "v4_gn_Tick:F1",36,0,0,v4_gn_Tick
+.globl v4_gn_Tick
+	.type	v4_gn_Tick,@function
+v4_gn_Tick:
+.stabn 68,0,922,.LMa949-v4_gn_Tick
+.LMa949:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,922,.LMb949-v4_gn_Tick
+.LMb949:
+.LBB151:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS104
+	call v4__dscheck
+.LDS104:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM954-v4_gn_Tick
+.LM954:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS105
+	call v4__dscheck
+.LDS105:
+	mov %rcx,v4__dsindex(%rip)
+.LBE151:
+.stabn 68,0,922,.LM959-v4_gn_Tick
+.LM959:
+	pop %rbx
+	leave
+	ret
+.Lfe151:
+	.size	 v4_gn_Tick,.Lfe151-v4_gn_Tick
+.stabn	192,0,0,.LBB151-v4_gn_Tick
+.stabn	224,0,0,.LBE151-v4_gn_Tick
+.Lscope151:
+.stabs	"",36,0,0,.Lscope151-v4_gn_Tick
+.text
+	.align 4
+.stabs "v4_Greaternumber_Minusbased:F1",36,0,0,v4_Greaternumber_Minusbased
+.globl v4_Greaternumber_Minusbased
+	.type	v4_Greaternumber_Minusbased,@function
+v4_Greaternumber_Minusbased:
+.stabn 68,0,931,.LMa960-v4_Greaternumber_Minusbased
+.LMa960:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,931,.LMb960-v4_Greaternumber_Minusbased
+.LMb960:
+.LBB153:
+.stabn 68,0,932,.LM961-v4_Greaternumber_Minusbased
+.LM961:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	pop %rbx
+	leave
+	jmp v4_Store
+.LBE153:
+.stabn 68,0,932,.LM971-v4_Greaternumber_Minusbased
+.LM971:
+	pop %rbx
+	leave
+	ret
+.Lfe153:
+	.size	 v4_Greaternumber_Minusbased,.Lfe153-v4_Greaternumber_Minusbased
+.stabn	192,0,0,.LBB153-v4_Greaternumber_Minusbased
+.stabn	224,0,0,.LBE153-v4_Greaternumber_Minusbased
+.Lscope153:
+.stabs	"",36,0,0,.Lscope153-v4_Greaternumber_Minusbased
+.text
+	.align 4
+.stabs "v4_gn1:F1",36,0,0,v4_gn1
+.globl v4_gn1
+	.type	v4_gn1,@function
+v4_gn1:
+.stabn 68,0,941,.LMa972-v4_gn1
+.LMa972:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,941,.LMb972-v4_gn1
+.LMb972:
+.LBB154:
+.stabn 68,0,942,.LM973-v4_gn1
+.LM973:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+.stabn 68,0,943,.LM978-v4_gn1
+.LM978:
+	call v4_Less_Hash
+	call v4_Hashs
+	call v4_Hash_Greater
+.stabn 68,0,944,.LM981-v4_gn1
+.LM981:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS106
+	call v4__dscheck
+.LDS106:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2swap
+	call v4_Greaternumber
+	call v4_swap
+	call v4_drop
+.stabn 68,0,945,.LM989-v4_gn1
+.LM989:
+	call v4_r_Greater
+	call v4_base
+	pop %rbx
+	leave
+	jmp v4_Store
+.LBE154:
+.stabn 68,0,945,.LM993-v4_gn1
+.LM993:
+	pop %rbx
+	leave
+	ret
+.Lfe154:
+	.size	 v4_gn1,.Lfe154-v4_gn1
+.stabn	192,0,0,.LBB154-v4_gn1
+.stabn	224,0,0,.LBE154-v4_gn1
+.Lscope154:
+.stabs	"",36,0,0,.Lscope154-v4_gn1
+.text
+	.align 4
+.stabs "v4_gn2:F1",36,0,0,v4_gn2
+.globl v4_gn2
+	.type	v4_gn2,@function
+v4_gn2:
+.stabn 68,0,953,.LMa994-v4_gn2
+.LMa994:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,953,.LMb994-v4_gn2
+.LMb994:
+.LBB155:
+.stabn 68,0,954,.LM995-v4_gn2
+.LM995:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_base
+	call v4_Fetch
+	call v4_decimal
+	call v4_base
+	call v4_Fetch
+	call v4_r_Greater
+	call v4_base
+	pop %rbx
+	leave
+	jmp v4_Store
+.LBE155:
+.stabn 68,0,954,.LM1008-v4_gn2
+.LM1008:
+	pop %rbx
+	leave
+	ret
+.Lfe155:
+	.size	 v4_gn2,.Lfe155-v4_gn2
+.stabn	192,0,0,.LBB155-v4_gn2
+.stabn	224,0,0,.LBE155-v4_gn2
+.Lscope155:
+.stabs	"",36,0,0,.Lscope155-v4_gn2
+.text
+	.align 4
+.stabs "v4_seebuf:F1",36,0,0,v4_seebuf
+.globl v4_seebuf
+	.type	v4_seebuf,@function
+v4_seebuf:
+.stabn 68,0,965,.LMa1009-v4_seebuf
+.LMa1009:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,965,.LMb1009-v4_seebuf
+.LMb1009:
+.LBB160:
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS107
+	call v4__dscheck
+.LDS107:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS108
+	call v4__dscheck
+.LDS108:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS109
+	call v4__dscheck
+.LDS109:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_char_Plus
+	pop %rbx
+	leave
+	jmp v4_c_Fetch
+.LBE160:
+.stabn 68,0,965,.LM1023-v4_seebuf
+.LM1023:
+	pop %rbx
+	leave
+	ret
+.Lfe160:
+	.size	 v4_seebuf,.Lfe160-v4_seebuf
+.stabn	192,0,0,.LBB160-v4_seebuf
+.stabn	224,0,0,.LBE160-v4_seebuf
+.Lscope160:
+.stabs	"",36,0,0,.Lscope160-v4_seebuf
+.text
+	.align 4
+.stabs "v4_output_Minustest:F1",36,0,0,v4_output_Minustest
+.globl v4_output_Minustest
+	.type	v4_output_Minustest,@function
+v4_output_Minustest:
+.stabn 68,0,997,.LMa1024-v4_output_Minustest
+.LMa1024:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,997,.LMb1024-v4_output_Minustest
+.LMb1024:
+.LBB163:
+.stabn 68,0,998,.LM1025-v4_output_Minustest
+.LM1025:
+	lea .LC24(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $40,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS110
+	call v4__dscheck
+.LDS110:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,999,.LM1031-v4_output_Minustest
+.LM1031:
+	mov $10,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+.L111:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+	call v4_Dot
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	jne .L111
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1000,.LM1055-v4_output_Minustest
+.LM1055:
+	lea .LC25(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $36,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS111
+	call v4__dscheck
+.LDS111:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,1001,.LM1061-v4_output_Minustest
+.LM1061:
+	mov $58,%rax
+	mov %rax,%r8
+	mov $48,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+.L114:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS112
+	call v4__dscheck
+.LDS112:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_spaces
+	call v4_emit
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	jne .L114
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1002,.LM1088-v4_output_Minustest
+.LM1088:
+	lea .LC26(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $40,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS113
+	call v4__dscheck
+.LDS113:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,1003,.LM1094-v4_output_Minustest
+.LM1094:
+	mov $72,%rax
+	mov %rax,%r8
+	mov $65,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+.L117:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+	call v4_emit
+	call v4_space
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	jne .L117
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1004,.LM1119-v4_output_Minustest
+.LM1119:
+	lea .LC27(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $43,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS114
+	call v4__dscheck
+.LDS114:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,1005,.LM1125-v4_output_Minustest
+.LM1125:
+	mov $6,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+.L120:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+	mov $48,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS115
+	call v4__dscheck
+.LDS115:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS116
+	call v4__dscheck
+.LDS116:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_emit
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS117
+	call v4__dscheck
+.LDS117:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_spaces
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	jne .L120
+	call v4__rpop
+	call v4__rpop
+	call v4_cr
+.stabn 68,0,1006,.LM1159-v4_output_Minustest
+.LM1159:
+	lea .LC28(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $34,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS118
+	call v4__dscheck
+.LDS118:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,1007,.LM1165-v4_output_Minustest
+.LM1165:
+	lea .LC29(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $6,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS119
+	call v4__dscheck
+.LDS119:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_type
+	call v4_cr
+	lea .LC30(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $6,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS120
+	call v4__dscheck
+.LDS120:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_type
+	call v4_cr
+.stabn 68,0,1008,.LM1177-v4_output_Minustest
+.LM1177:
+	lea .LC31(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $64,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS121
+	call v4__dscheck
+.LDS121:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,1009,.LM1183-v4_output_Minustest
+.LM1183:
+	lea .LC32(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $10,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS122
+	call v4__dscheck
+.LDS122:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS123
+	call v4__dscheck
+.LDS123:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Dot
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS124
+	call v4__dscheck
+.LDS124:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,1010,.LM1195-v4_output_Minustest
+.LM1195:
+	lea .LC33(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $10,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS125
+	call v4__dscheck
+.LDS125:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS126
+	call v4__dscheck
+.LDS126:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_u_Dot
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS127
+	call v4__dscheck
+.LDS127:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_u_Dot
+	pop %rbx
+	leave
+	jmp v4_cr
+.LBE163:
+.stabn 68,0,1011,.LM1208-v4_output_Minustest
+.LM1208:
+	pop %rbx
+	leave
+	ret
+.Lfe163:
+	.size	 v4_output_Minustest,.Lfe163-v4_output_Minustest
+.stabn	192,0,0,.LBB163-v4_output_Minustest
+.stabn	224,0,0,.LBE163-v4_output_Minustest
+.Lscope163:
+.stabs	"",36,0,0,.Lscope163-v4_output_Minustest
+.text
+	.align 4
+.stabs "v4_accept_Minustest:F1",36,0,0,v4_accept_Minustest
+.globl v4_accept_Minustest
+	.type	v4_accept_Minustest,@function
+v4_accept_Minustest:
+.stabn 68,0,1020,.LMa1209-v4_accept_Minustest
+.LMa1209:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,1020,.LMb1209-v4_accept_Minustest
+.LMb1209:
+.LBB171:
+.stabn 68,0,1021,.LM1210-v4_accept_Minustest
+.LM1210:
+	call v4_cr
+	lea .LC35(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $32,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS128
+	call v4__dscheck
+.LDS128:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,1022,.LM1217-v4_accept_Minustest
+.LM1217:
+	lea v4_abuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $80,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS129
+	call v4__dscheck
+.LDS129:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_accept
+.stabn 68,0,1023,.LM1222-v4_accept_Minustest
+.LM1222:
+	call v4_cr
+	lea .LC36(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $10,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS130
+	call v4__dscheck
+.LDS130:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	mov $34,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS131
+	call v4__dscheck
+.LDS131:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_emit
+.stabn 68,0,1024,.LM1231-v4_accept_Minustest
+.LM1231:
+	lea v4_abuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS132
+	call v4__dscheck
+.LDS132:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	call v4_type
+	mov $34,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS133
+	call v4__dscheck
+.LDS133:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_emit
+	pop %rbx
+	leave
+	jmp v4_cr
+.LBE171:
+.stabn 68,0,1025,.LM1240-v4_accept_Minustest
+.LM1240:
+	pop %rbx
+	leave
+	ret
+.Lfe171:
+	.size	 v4_accept_Minustest,.Lfe171-v4_accept_Minustest
+.stabn	192,0,0,.LBB171-v4_accept_Minustest
+.stabn	224,0,0,.LBE171-v4_accept_Minustest
+.Lscope171:
+.stabs	"",36,0,0,.Lscope171-v4_accept_Minustest
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,13,.LMa1241-main
+.LMa1241:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	mov %rdi,v4__argc(%rip)
+	mov %rdx,v4__envp(%rip)
+	mov %rsi,v4__argv(%rip)
+.stabn 68,0,13,.LMb1241-main
+.LMb1241:
+.LBB1:
+	lea .LC0(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $18,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS134
+	call v4__dscheck
+.LDS134:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS135
+	call v4__dscheck
+.LDS135:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__strictansi
+	call v4_Store
+.stabn 68,0,19,.LM1253-main
+.LM1253:
+	lea .LC1(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $35,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS136
+	call v4__dscheck
+.LDS136:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,21,.LM1259-main
+.LM1259:
+	mov $180,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS137
+	call v4__dscheck
+.LDS137:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS138
+	call v4__dscheck
+.LDS138:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS139
+	call v4__dscheck
+.LDS139:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,22,.LM1271-main
+.LM1271:
+	mov $190,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS140
+	call v4__dscheck
+.LDS140:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS141
+	call v4__dscheck
+.LDS141:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS142
+	call v4__dscheck
+.LDS142:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,23,.LM1283-main
+.LM1283:
+	mov $200,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS143
+	call v4__dscheck
+.LDS143:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS144
+	call v4__dscheck
+.LDS144:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS145
+	call v4__dscheck
+.LDS145:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,24,.LM1295-main
+.LM1295:
+	mov $210,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS146
+	call v4__dscheck
+.LDS146:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS147
+	call v4__dscheck
+.LDS147:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS148
+	call v4__dscheck
+.LDS148:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,26,.LM1307-main
+.LM1307:
+	mov $230,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS149
+	call v4__dscheck
+.LDS149:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS150
+	call v4__dscheck
+.LDS150:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS151
+	call v4__dscheck
+.LDS151:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,27,.LM1320-main
+.LM1320:
+	mov $240,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS152
+	call v4__dscheck
+.LDS152:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS153
+	call v4__dscheck
+.LDS153:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS154
+	call v4__dscheck
+.LDS154:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,29,.LM1333-main
+.LM1333:
+	xor %rax,%rax
+	mov %rax,v4_z0s(%rip)
+.stabn 68,0,30,.LM1337-main
+.LM1337:
+	xor %rax,%rax
+	dec %rax
+	mov %rax,v4_z1s(%rip)
+.stabn 68,0,32,.LM1342-main
+.LM1342:
+	mov $290,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS155
+	call v4__dscheck
+.LDS155:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS156
+	call v4__dscheck
+.LDS156:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS157
+	call v4__dscheck
+.LDS157:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,33,.LM1352-main
+.LM1352:
+	mov $300,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS158
+	call v4__dscheck
+.LDS158:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS159
+	call v4__dscheck
+.LDS159:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS160
+	call v4__dscheck
+.LDS160:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,35,.LM1362-main
+.LM1362:
+	mov $320,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS161
+	call v4__dscheck
+.LDS161:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rdx
+	and %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS162
+	call v4__dscheck
+.LDS162:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS163
+	call v4__dscheck
+.LDS163:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,36,.LM1378-main
+.LM1378:
+	mov $330,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS164
+	call v4__dscheck
+.LDS164:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS165
+	call v4__dscheck
+.LDS165:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS166
+	call v4__dscheck
+.LDS166:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,37,.LM1390-main
+.LM1390:
+	mov $340,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS167
+	call v4__dscheck
+.LDS167:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS168
+	call v4__dscheck
+.LDS168:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS169
+	call v4__dscheck
+.LDS169:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,38,.LM1402-main
+.LM1402:
+	mov $350,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS170
+	call v4__dscheck
+.LDS170:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	and %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS171
+	call v4__dscheck
+.LDS171:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS172
+	call v4__dscheck
+.LDS172:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,40,.LM1418-main
+.LM1418:
+	mov $370,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS173
+	call v4__dscheck
+.LDS173:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rdx
+	or %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS174
+	call v4__dscheck
+.LDS174:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS175
+	call v4__dscheck
+.LDS175:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,41,.LM1434-main
+.LM1434:
+	mov $380,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS176
+	call v4__dscheck
+.LDS176:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS177
+	call v4__dscheck
+.LDS177:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS178
+	call v4__dscheck
+.LDS178:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,42,.LM1446-main
+.LM1446:
+	mov $390,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS179
+	call v4__dscheck
+.LDS179:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS180
+	call v4__dscheck
+.LDS180:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS181
+	call v4__dscheck
+.LDS181:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,43,.LM1458-main
+.LM1458:
+	mov $400,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS182
+	call v4__dscheck
+.LDS182:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	or %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS183
+	call v4__dscheck
+.LDS183:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS184
+	call v4__dscheck
+.LDS184:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,45,.LM1474-main
+.LM1474:
+	mov $420,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS185
+	call v4__dscheck
+.LDS185:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rdx
+	xor %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS186
+	call v4__dscheck
+.LDS186:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS187
+	call v4__dscheck
+.LDS187:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,46,.LM1490-main
+.LM1490:
+	mov $430,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS188
+	call v4__dscheck
+.LDS188:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS189
+	call v4__dscheck
+.LDS189:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS190
+	call v4__dscheck
+.LDS190:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,47,.LM1502-main
+.LM1502:
+	mov $440,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS191
+	call v4__dscheck
+.LDS191:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS192
+	call v4__dscheck
+.LDS192:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS193
+	call v4__dscheck
+.LDS193:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,48,.LM1514-main
+.LM1514:
+	mov $450,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS194
+	call v4__dscheck
+.LDS194:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	xor %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS195
+	call v4__dscheck
+.LDS195:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS196
+	call v4__dscheck
+.LDS196:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,51,.LM1530-main
+.LM1530:
+	lea .LC2(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $27,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS197
+	call v4__dscheck
+.LDS197:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,54,.LM1537-main
+.LM1537:
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS198
+	call v4__dscheck
+.LDS198:
+.L121:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS199
+	call v4__dscheck
+.LDS199:
+	test %rax,%rax
+	je .L122
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS200
+	call v4__dscheck
+.LDS200:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS201
+	call v4__dscheck
+.LDS201:
+	jmp .L121
+.L122:
+.stabn 68,0,55,.LM1553-main
+.LM1553:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,v4_msb(%rip)
+.stabn 68,0,57,.LM1555-main
+.LM1555:
+	mov $540,%rax
+	cmp $4080,%rcx
+	jbe .LDS202
+	call v4__dscheck
+.LDS202:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS203
+	call v4__dscheck
+.LDS203:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS204
+	call v4__dscheck
+.LDS204:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS205
+	call v4__dscheck
+.LDS205:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,58,.LM1565-main
+.LM1565:
+	mov $550,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS206
+	call v4__dscheck
+.LDS206:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS207
+	call v4__dscheck
+.LDS207:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS208
+	call v4__dscheck
+.LDS208:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,59,.LM1575-main
+.LM1575:
+	mov $560,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS209
+	call v4__dscheck
+.LDS209:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $32768,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS210
+	call v4__dscheck
+.LDS210:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $32768,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS211
+	call v4__dscheck
+.LDS211:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,60,.LM1585-main
+.LM1585:
+	mov $570,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS212
+	call v4__dscheck
+.LDS212:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS213
+	call v4__dscheck
+.LDS213:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS214
+	call v4__dscheck
+.LDS214:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,61,.LM1600-main
+.LM1600:
+	mov $580,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS215
+	call v4__dscheck
+.LDS215:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_msb(%rip),%rax
+	add %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS216
+	call v4__dscheck
+.LDS216:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS217
+	call v4__dscheck
+.LDS217:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,63,.LM1613-main
+.LM1613:
+	mov $600,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS218
+	call v4__dscheck
+.LDS218:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS219
+	call v4__dscheck
+.LDS219:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS220
+	call v4__dscheck
+.LDS220:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,64,.LM1623-main
+.LM1623:
+	mov $610,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS221
+	call v4__dscheck
+.LDS221:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS222
+	call v4__dscheck
+.LDS222:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS223
+	call v4__dscheck
+.LDS223:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,65,.LM1633-main
+.LM1633:
+	mov $620,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS224
+	call v4__dscheck
+.LDS224:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $8192,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS225
+	call v4__dscheck
+.LDS225:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $8192,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS226
+	call v4__dscheck
+.LDS226:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,66,.LM1643-main
+.LM1643:
+	mov $630,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS227
+	call v4__dscheck
+.LDS227:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS228
+	call v4__dscheck
+.LDS228:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS229
+	call v4__dscheck
+.LDS229:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,67,.LM1655-main
+.LM1655:
+	mov $640,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS230
+	call v4__dscheck
+.LDS230:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS231
+	call v4__dscheck
+.LDS231:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS232
+	call v4__dscheck
+.LDS232:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,68,.LM1670-main
+.LM1670:
+	mov $650,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS233
+	call v4__dscheck
+.LDS233:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_msb(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS234
+	call v4__dscheck
+.LDS234:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2_Slash
+	mov v4_msb(%rip),%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	and %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS235
+	call v4__dscheck
+.LDS235:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS236
+	call v4__dscheck
+.LDS236:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_msb(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS237
+	call v4__dscheck
+.LDS237:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,70,.LM1687-main
+.LM1687:
+	mov $670,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS238
+	call v4__dscheck
+.LDS238:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS239
+	call v4__dscheck
+.LDS239:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS240
+	call v4__dscheck
+.LDS240:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,71,.LM1699-main
+.LM1699:
+	mov $680,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS241
+	call v4__dscheck
+.LDS241:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS242
+	call v4__dscheck
+.LDS242:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS243
+	call v4__dscheck
+.LDS243:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,72,.LM1711-main
+.LM1711:
+	mov $690,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS244
+	call v4__dscheck
+.LDS244:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS245
+	call v4__dscheck
+.LDS245:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS246
+	call v4__dscheck
+.LDS246:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,73,.LM1723-main
+.LM1723:
+	mov $700,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS247
+	call v4__dscheck
+.LDS247:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $32768,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS248
+	call v4__dscheck
+.LDS248:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $32768,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS249
+	call v4__dscheck
+.LDS249:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,74,.LM1735-main
+.LM1735:
+	mov $710,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS250
+	call v4__dscheck
+.LDS250:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS251
+	call v4__dscheck
+.LDS251:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS252
+	call v4__dscheck
+.LDS252:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,75,.LM1752-main
+.LM1752:
+	mov $720,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS253
+	call v4__dscheck
+.LDS253:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_msb(%rip),%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	xchg %rdx,%rcx
+	shl %cl,%rax
+	xchg %rdx,%rcx
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS254
+	call v4__dscheck
+.LDS254:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS255
+	call v4__dscheck
+.LDS255:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,77,.LM1768-main
+.LM1768:
+	mov $740,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS256
+	call v4__dscheck
+.LDS256:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS257
+	call v4__dscheck
+.LDS257:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS258
+	call v4__dscheck
+.LDS258:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,78,.LM1780-main
+.LM1780:
+	mov $750,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS259
+	call v4__dscheck
+.LDS259:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS260
+	call v4__dscheck
+.LDS260:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS261
+	call v4__dscheck
+.LDS261:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,79,.LM1792-main
+.LM1792:
+	mov $760,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS262
+	call v4__dscheck
+.LDS262:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS263
+	call v4__dscheck
+.LDS263:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS264
+	call v4__dscheck
+.LDS264:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,80,.LM1804-main
+.LM1804:
+	mov $770,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS265
+	call v4__dscheck
+.LDS265:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS266
+	call v4__dscheck
+.LDS266:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS267
+	call v4__dscheck
+.LDS267:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,81,.LM1816-main
+.LM1816:
+	mov $780,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS268
+	call v4__dscheck
+.LDS268:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS269
+	call v4__dscheck
+.LDS269:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS270
+	call v4__dscheck
+.LDS270:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,82,.LM1828-main
+.LM1828:
+	mov $790,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS271
+	call v4__dscheck
+.LDS271:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_msb(%rip),%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	xchg %rdx,%rcx
+	shr %cl,%rax
+	xchg %rdx,%rcx
+	mov %rax,%r8
+	mov v4_msb(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	and %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS272
+	call v4__dscheck
+.LDS272:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS273
+	call v4__dscheck
+.LDS273:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,83,.LM1851-main
+.LM1851:
+	mov $800,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS274
+	call v4__dscheck
+.LDS274:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_msb(%rip),%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	xchg %rdx,%rcx
+	shr %cl,%rax
+	xchg %rdx,%rcx
+	add %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS275
+	call v4__dscheck
+.LDS275:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_msb(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS276
+	call v4__dscheck
+.LDS276:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,86,.LM1871-main
+.LM1871:
+	lea .LC3(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $54,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS277
+	call v4__dscheck
+.LDS277:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,87,.LM1877-main
+.LM1877:
+	xor %rax,%rax
+	dec %rax
+	mov %rax,v4_max_Minusuint(%rip)
+.stabn 68,0,88,.LM1882-main
+.LM1882:
+	movabs $9223372036854775807,%rax
+	mov %rax,v4_max_Minusint(%rip)
+.stabn 68,0,89,.LM1890-main
+.LM1890:
+	movabs $-9223372036854775808,%rax
+	mov %rax,v4_min_Minusint(%rip)
+.stabn 68,0,90,.LM1899-main
+.LM1899:
+	movabs $9223372036854775807,%rax
+	mov %rax,v4_mid_Minusuint(%rip)
+.stabn 68,0,91,.LM1907-main
+.LM1907:
+	movabs $-9223372036854775808,%rax
+	mov %rax,v4_mid_Minusuint_Plus1(%rip)
+.stabn 68,0,93,.LM1916-main
+.LM1916:
+	xor %rax,%rax
+	mov %rax,v4_Lessfalse_Greater(%rip)
+.stabn 68,0,94,.LM1920-main
+.LM1920:
+	xor %rax,%rax
+	dec %rax
+	mov %rax,v4_Lesstrue_Greater(%rip)
+.stabn 68,0,96,.LM1924-main
+.LM1924:
+	mov $930,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS278
+	call v4__dscheck
+.LDS278:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,97,.LM1929-main
+.LM1929:
+	mov $940,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS279
+	call v4__dscheck
+.LDS279:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS280
+	call v4__dscheck
+.LDS280:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS281
+	call v4__dscheck
+.LDS281:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,98,.LM1942-main
+.LM1942:
+	mov $950,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS282
+	call v4__dscheck
+.LDS282:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS283
+	call v4__dscheck
+.LDS283:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS284
+	call v4__dscheck
+.LDS284:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,99,.LM1955-main
+.LM1955:
+	mov $960,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS285
+	call v4__dscheck
+.LDS285:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS286
+	call v4__dscheck
+.LDS286:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS287
+	call v4__dscheck
+.LDS287:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,100,.LM1968-main
+.LM1968:
+	mov $970,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS288
+	call v4__dscheck
+.LDS288:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS289
+	call v4__dscheck
+.LDS289:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS290
+	call v4__dscheck
+.LDS290:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,101,.LM1981-main
+.LM1981:
+	mov $980,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS291
+	call v4__dscheck
+.LDS291:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS292
+	call v4__dscheck
+.LDS292:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS293
+	call v4__dscheck
+.LDS293:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,102,.LM1994-main
+.LM1994:
+	mov $990,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS294
+	call v4__dscheck
+.LDS294:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS295
+	call v4__dscheck
+.LDS295:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS296
+	call v4__dscheck
+.LDS296:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,103,.LM2007-main
+.LM2007:
+	mov $1000,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS297
+	call v4__dscheck
+.LDS297:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS298
+	call v4__dscheck
+.LDS298:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS299
+	call v4__dscheck
+.LDS299:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,105,.LM2020-main
+.LM2020:
+	mov $1020,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS300
+	call v4__dscheck
+.LDS300:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS301
+	call v4__dscheck
+.LDS301:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS302
+	call v4__dscheck
+.LDS302:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,106,.LM2036-main
+.LM2036:
+	mov $1030,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS303
+	call v4__dscheck
+.LDS303:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS304
+	call v4__dscheck
+.LDS304:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS305
+	call v4__dscheck
+.LDS305:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,107,.LM2052-main
+.LM2052:
+	mov $1040,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS306
+	call v4__dscheck
+.LDS306:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS307
+	call v4__dscheck
+.LDS307:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS308
+	call v4__dscheck
+.LDS308:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,108,.LM2068-main
+.LM2068:
+	mov $1050,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS309
+	call v4__dscheck
+.LDS309:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS310
+	call v4__dscheck
+.LDS310:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS311
+	call v4__dscheck
+.LDS311:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,109,.LM2084-main
+.LM2084:
+	mov $1060,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS312
+	call v4__dscheck
+.LDS312:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS313
+	call v4__dscheck
+.LDS313:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS314
+	call v4__dscheck
+.LDS314:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,110,.LM2100-main
+.LM2100:
+	mov $1070,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS315
+	call v4__dscheck
+.LDS315:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS316
+	call v4__dscheck
+.LDS316:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS317
+	call v4__dscheck
+.LDS317:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,111,.LM2116-main
+.LM2116:
+	mov $1080,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS318
+	call v4__dscheck
+.LDS318:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS319
+	call v4__dscheck
+.LDS319:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS320
+	call v4__dscheck
+.LDS320:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,113,.LM2132-main
+.LM2132:
+	mov $1100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS321
+	call v4__dscheck
+.LDS321:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS322
+	call v4__dscheck
+.LDS322:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS323
+	call v4__dscheck
+.LDS323:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,114,.LM2145-main
+.LM2145:
+	mov $1110,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS324
+	call v4__dscheck
+.LDS324:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS325
+	call v4__dscheck
+.LDS325:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS326
+	call v4__dscheck
+.LDS326:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,115,.LM2158-main
+.LM2158:
+	mov $1120,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS327
+	call v4__dscheck
+.LDS327:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS328
+	call v4__dscheck
+.LDS328:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS329
+	call v4__dscheck
+.LDS329:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,116,.LM2171-main
+.LM2171:
+	mov $1130,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS330
+	call v4__dscheck
+.LDS330:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS331
+	call v4__dscheck
+.LDS331:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS332
+	call v4__dscheck
+.LDS332:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,117,.LM2184-main
+.LM2184:
+	mov $1140,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS333
+	call v4__dscheck
+.LDS333:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	test %rax,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS334
+	call v4__dscheck
+.LDS334:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS335
+	call v4__dscheck
+.LDS335:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,119,.LM2197-main
+.LM2197:
+	mov $1160,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS336
+	call v4__dscheck
+.LDS336:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS337
+	call v4__dscheck
+.LDS337:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS338
+	call v4__dscheck
+.LDS338:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,120,.LM2213-main
+.LM2213:
+	mov $1170,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS339
+	call v4__dscheck
+.LDS339:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	mov $2,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS340
+	call v4__dscheck
+.LDS340:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS341
+	call v4__dscheck
+.LDS341:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,121,.LM2229-main
+.LM2229:
+	mov $1180,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS342
+	call v4__dscheck
+.LDS342:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS343
+	call v4__dscheck
+.LDS343:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS344
+	call v4__dscheck
+.LDS344:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,122,.LM2245-main
+.LM2245:
+	mov $1190,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS345
+	call v4__dscheck
+.LDS345:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS346
+	call v4__dscheck
+.LDS346:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS347
+	call v4__dscheck
+.LDS347:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,123,.LM2261-main
+.LM2261:
+	mov $1200,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS348
+	call v4__dscheck
+.LDS348:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS349
+	call v4__dscheck
+.LDS349:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS350
+	call v4__dscheck
+.LDS350:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,124,.LM2277-main
+.LM2277:
+	mov $1210,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS351
+	call v4__dscheck
+.LDS351:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%r8
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS352
+	call v4__dscheck
+.LDS352:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS353
+	call v4__dscheck
+.LDS353:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,125,.LM2293-main
+.LM2293:
+	mov $1220,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS354
+	call v4__dscheck
+.LDS354:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS355
+	call v4__dscheck
+.LDS355:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS356
+	call v4__dscheck
+.LDS356:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,126,.LM2309-main
+.LM2309:
+	mov $1230,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS357
+	call v4__dscheck
+.LDS357:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS358
+	call v4__dscheck
+.LDS358:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS359
+	call v4__dscheck
+.LDS359:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,127,.LM2325-main
+.LM2325:
+	mov $1240,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS360
+	call v4__dscheck
+.LDS360:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS361
+	call v4__dscheck
+.LDS361:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS362
+	call v4__dscheck
+.LDS362:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,128,.LM2341-main
+.LM2341:
+	mov $1250,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS363
+	call v4__dscheck
+.LDS363:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS364
+	call v4__dscheck
+.LDS364:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS365
+	call v4__dscheck
+.LDS365:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,129,.LM2357-main
+.LM2357:
+	mov $1260,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS366
+	call v4__dscheck
+.LDS366:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS367
+	call v4__dscheck
+.LDS367:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS368
+	call v4__dscheck
+.LDS368:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,130,.LM2373-main
+.LM2373:
+	mov $1270,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS369
+	call v4__dscheck
+.LDS369:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS370
+	call v4__dscheck
+.LDS370:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS371
+	call v4__dscheck
+.LDS371:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,131,.LM2389-main
+.LM2389:
+	mov $1280,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS372
+	call v4__dscheck
+.LDS372:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS373
+	call v4__dscheck
+.LDS373:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS374
+	call v4__dscheck
+.LDS374:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,132,.LM2405-main
+.LM2405:
+	mov $1290,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS375
+	call v4__dscheck
+.LDS375:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS376
+	call v4__dscheck
+.LDS376:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS377
+	call v4__dscheck
+.LDS377:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,133,.LM2421-main
+.LM2421:
+	mov $1300,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS378
+	call v4__dscheck
+.LDS378:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%r8
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS379
+	call v4__dscheck
+.LDS379:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS380
+	call v4__dscheck
+.LDS380:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,134,.LM2437-main
+.LM2437:
+	mov $1310,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS381
+	call v4__dscheck
+.LDS381:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS382
+	call v4__dscheck
+.LDS382:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS383
+	call v4__dscheck
+.LDS383:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,136,.LM2453-main
+.LM2453:
+	mov $1330,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS384
+	call v4__dscheck
+.LDS384:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS385
+	call v4__dscheck
+.LDS385:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS386
+	call v4__dscheck
+.LDS386:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,137,.LM2469-main
+.LM2469:
+	mov $1340,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS387
+	call v4__dscheck
+.LDS387:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	mov $2,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS388
+	call v4__dscheck
+.LDS388:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS389
+	call v4__dscheck
+.LDS389:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,138,.LM2485-main
+.LM2485:
+	mov $1350,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS390
+	call v4__dscheck
+.LDS390:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS391
+	call v4__dscheck
+.LDS391:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS392
+	call v4__dscheck
+.LDS392:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,139,.LM2501-main
+.LM2501:
+	mov $1360,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS393
+	call v4__dscheck
+.LDS393:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS394
+	call v4__dscheck
+.LDS394:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS395
+	call v4__dscheck
+.LDS395:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,140,.LM2517-main
+.LM2517:
+	mov $1370,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS396
+	call v4__dscheck
+.LDS396:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS397
+	call v4__dscheck
+.LDS397:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS398
+	call v4__dscheck
+.LDS398:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,141,.LM2533-main
+.LM2533:
+	mov $1380,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS399
+	call v4__dscheck
+.LDS399:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%r8
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS400
+	call v4__dscheck
+.LDS400:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS401
+	call v4__dscheck
+.LDS401:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,142,.LM2549-main
+.LM2549:
+	mov $1390,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS402
+	call v4__dscheck
+.LDS402:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS403
+	call v4__dscheck
+.LDS403:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS404
+	call v4__dscheck
+.LDS404:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,143,.LM2565-main
+.LM2565:
+	mov $1400,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS405
+	call v4__dscheck
+.LDS405:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS406
+	call v4__dscheck
+.LDS406:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS407
+	call v4__dscheck
+.LDS407:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,144,.LM2581-main
+.LM2581:
+	mov $1410,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS408
+	call v4__dscheck
+.LDS408:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS409
+	call v4__dscheck
+.LDS409:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS410
+	call v4__dscheck
+.LDS410:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,145,.LM2597-main
+.LM2597:
+	mov $1420,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS411
+	call v4__dscheck
+.LDS411:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS412
+	call v4__dscheck
+.LDS412:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS413
+	call v4__dscheck
+.LDS413:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,146,.LM2613-main
+.LM2613:
+	mov $1430,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS414
+	call v4__dscheck
+.LDS414:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS415
+	call v4__dscheck
+.LDS415:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS416
+	call v4__dscheck
+.LDS416:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,147,.LM2629-main
+.LM2629:
+	mov $1440,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS417
+	call v4__dscheck
+.LDS417:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS418
+	call v4__dscheck
+.LDS418:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS419
+	call v4__dscheck
+.LDS419:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,148,.LM2645-main
+.LM2645:
+	mov $1450,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS420
+	call v4__dscheck
+.LDS420:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS421
+	call v4__dscheck
+.LDS421:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS422
+	call v4__dscheck
+.LDS422:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,149,.LM2661-main
+.LM2661:
+	mov $1460,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS423
+	call v4__dscheck
+.LDS423:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS424
+	call v4__dscheck
+.LDS424:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS425
+	call v4__dscheck
+.LDS425:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,150,.LM2677-main
+.LM2677:
+	mov $1470,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS426
+	call v4__dscheck
+.LDS426:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%r8
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS427
+	call v4__dscheck
+.LDS427:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS428
+	call v4__dscheck
+.LDS428:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,151,.LM2693-main
+.LM2693:
+	mov $1480,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS429
+	call v4__dscheck
+.LDS429:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setg %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS430
+	call v4__dscheck
+.LDS430:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS431
+	call v4__dscheck
+.LDS431:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,153,.LM2709-main
+.LM2709:
+	mov $1500,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS432
+	call v4__dscheck
+.LDS432:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS433
+	call v4__dscheck
+.LDS433:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS434
+	call v4__dscheck
+.LDS434:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,154,.LM2725-main
+.LM2725:
+	mov $1510,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS435
+	call v4__dscheck
+.LDS435:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	mov $2,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS436
+	call v4__dscheck
+.LDS436:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS437
+	call v4__dscheck
+.LDS437:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,155,.LM2741-main
+.LM2741:
+	mov $1520,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS438
+	call v4__dscheck
+.LDS438:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS439
+	call v4__dscheck
+.LDS439:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS440
+	call v4__dscheck
+.LDS440:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,156,.LM2757-main
+.LM2757:
+	mov $1530,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS441
+	call v4__dscheck
+.LDS441:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS442
+	call v4__dscheck
+.LDS442:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS443
+	call v4__dscheck
+.LDS443:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,157,.LM2773-main
+.LM2773:
+	mov $1540,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS444
+	call v4__dscheck
+.LDS444:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS445
+	call v4__dscheck
+.LDS445:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS446
+	call v4__dscheck
+.LDS446:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,158,.LM2789-main
+.LM2789:
+	mov $1550,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS447
+	call v4__dscheck
+.LDS447:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS448
+	call v4__dscheck
+.LDS448:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS449
+	call v4__dscheck
+.LDS449:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,159,.LM2805-main
+.LM2805:
+	mov $1560,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS450
+	call v4__dscheck
+.LDS450:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS451
+	call v4__dscheck
+.LDS451:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS452
+	call v4__dscheck
+.LDS452:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,160,.LM2821-main
+.LM2821:
+	mov $1570,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS453
+	call v4__dscheck
+.LDS453:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS454
+	call v4__dscheck
+.LDS454:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS455
+	call v4__dscheck
+.LDS455:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,161,.LM2837-main
+.LM2837:
+	mov $1580,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS456
+	call v4__dscheck
+.LDS456:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS457
+	call v4__dscheck
+.LDS457:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS458
+	call v4__dscheck
+.LDS458:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,162,.LM2853-main
+.LM2853:
+	mov $1590,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS459
+	call v4__dscheck
+.LDS459:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS460
+	call v4__dscheck
+.LDS460:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS461
+	call v4__dscheck
+.LDS461:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,163,.LM2869-main
+.LM2869:
+	mov $1600,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS462
+	call v4__dscheck
+.LDS462:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS463
+	call v4__dscheck
+.LDS463:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS464
+	call v4__dscheck
+.LDS464:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,164,.LM2885-main
+.LM2885:
+	mov $1610,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS465
+	call v4__dscheck
+.LDS465:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%r8
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS466
+	call v4__dscheck
+.LDS466:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS467
+	call v4__dscheck
+.LDS467:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,165,.LM2901-main
+.LM2901:
+	mov $1611,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS468
+	call v4__dscheck
+.LDS468:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%r8
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	seta %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS469
+	call v4__dscheck
+.LDS469:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS470
+	call v4__dscheck
+.LDS470:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,166,.LM2917-main
+.LM2917:
+	mov $1612,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS471
+	call v4__dscheck
+.LDS471:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%r8
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	seta %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS472
+	call v4__dscheck
+.LDS472:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS473
+	call v4__dscheck
+.LDS473:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,167,.LM2933-main
+.LM2933:
+	mov $1613,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS474
+	call v4__dscheck
+.LDS474:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%r8
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	seta %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS475
+	call v4__dscheck
+.LDS475:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS476
+	call v4__dscheck
+.LDS476:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,168,.LM2949-main
+.LM2949:
+	mov $1614,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS477
+	call v4__dscheck
+.LDS477:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	cmp %rdx,%rax
+	seta %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS478
+	call v4__dscheck
+.LDS478:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS479
+	call v4__dscheck
+.LDS479:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,169,.LM2965-main
+.LM2965:
+	mov $1615,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS480
+	call v4__dscheck
+.LDS480:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%r8
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setbe %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS481
+	call v4__dscheck
+.LDS481:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS482
+	call v4__dscheck
+.LDS482:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,170,.LM2981-main
+.LM2981:
+	mov $1616,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS483
+	call v4__dscheck
+.LDS483:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%r8
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setbe %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS484
+	call v4__dscheck
+.LDS484:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS485
+	call v4__dscheck
+.LDS485:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,171,.LM2997-main
+.LM2997:
+	mov $1617,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS486
+	call v4__dscheck
+.LDS486:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	cmp %rdx,%rax
+	setbe %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS487
+	call v4__dscheck
+.LDS487:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS488
+	call v4__dscheck
+.LDS488:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,172,.LM3013-main
+.LM3013:
+	mov $1618,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS489
+	call v4__dscheck
+.LDS489:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setbe %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS490
+	call v4__dscheck
+.LDS490:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS491
+	call v4__dscheck
+.LDS491:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,173,.LM3029-main
+.LM3029:
+	mov $1619,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS492
+	call v4__dscheck
+.LDS492:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%r8
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setae %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS493
+	call v4__dscheck
+.LDS493:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS494
+	call v4__dscheck
+.LDS494:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,174,.LM3045-main
+.LM3045:
+	mov $1620,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS495
+	call v4__dscheck
+.LDS495:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov %rax,%r8
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setae %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS496
+	call v4__dscheck
+.LDS496:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS497
+	call v4__dscheck
+.LDS497:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,175,.LM3061-main
+.LM3061:
+	mov $1621,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS498
+	call v4__dscheck
+.LDS498:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov %rax,%rdx
+	cmp %rdx,%rax
+	setae %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS499
+	call v4__dscheck
+.LDS499:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS500
+	call v4__dscheck
+.LDS500:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,176,.LM3077-main
+.LM3077:
+	mov $1622,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS501
+	call v4__dscheck
+.LDS501:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setae %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS502
+	call v4__dscheck
+.LDS502:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS503
+	call v4__dscheck
+.LDS503:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,177,.LM3093-main
+.LM3093:
+	mov $1623,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS504
+	call v4__dscheck
+.LDS504:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_u_Greater(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS505
+	call v4__dscheck
+.LDS505:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS506
+	call v4__dscheck
+.LDS506:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,178,.LM3107-main
+.LM3107:
+	mov $1624,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS507
+	call v4__dscheck
+.LDS507:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_u_Greater(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS508
+	call v4__dscheck
+.LDS508:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS509
+	call v4__dscheck
+.LDS509:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,179,.LM3121-main
+.LM3121:
+	mov $1625,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS510
+	call v4__dscheck
+.LDS510:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_u_Less_Equals(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS511
+	call v4__dscheck
+.LDS511:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS512
+	call v4__dscheck
+.LDS512:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,180,.LM3135-main
+.LM3135:
+	mov $1626,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS513
+	call v4__dscheck
+.LDS513:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_u_Less_Equals(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS514
+	call v4__dscheck
+.LDS514:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS515
+	call v4__dscheck
+.LDS515:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,181,.LM3149-main
+.LM3149:
+	mov $1627,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS516
+	call v4__dscheck
+.LDS516:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_u_Greater_Equals(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS517
+	call v4__dscheck
+.LDS517:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS518
+	call v4__dscheck
+.LDS518:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,182,.LM3163-main
+.LM3163:
+	mov $1628,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS519
+	call v4__dscheck
+.LDS519:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_u_Greater_Equals(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS520
+	call v4__dscheck
+.LDS520:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS521
+	call v4__dscheck
+.LDS521:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,184,.LM3177-main
+.LM3177:
+	mov $1630,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS522
+	call v4__dscheck
+.LDS522:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS523
+	call v4__dscheck
+.LDS523:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS524
+	call v4__dscheck
+.LDS524:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,185,.LM3189-main
+.LM3189:
+	mov $1640,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS525
+	call v4__dscheck
+.LDS525:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS526
+	call v4__dscheck
+.LDS526:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS527
+	call v4__dscheck
+.LDS527:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,186,.LM3201-main
+.LM3201:
+	mov $1650,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS528
+	call v4__dscheck
+.LDS528:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS529
+	call v4__dscheck
+.LDS529:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS530
+	call v4__dscheck
+.LDS530:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,187,.LM3213-main
+.LM3213:
+	mov $1660,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS531
+	call v4__dscheck
+.LDS531:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS532
+	call v4__dscheck
+.LDS532:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS533
+	call v4__dscheck
+.LDS533:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,188,.LM3225-main
+.LM3225:
+	mov $1670,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS534
+	call v4__dscheck
+.LDS534:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS535
+	call v4__dscheck
+.LDS535:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS536
+	call v4__dscheck
+.LDS536:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,189,.LM3237-main
+.LM3237:
+	mov $1680,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS537
+	call v4__dscheck
+.LDS537:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS538
+	call v4__dscheck
+.LDS538:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS539
+	call v4__dscheck
+.LDS539:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,190,.LM3249-main
+.LM3249:
+	mov $1690,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS540
+	call v4__dscheck
+.LDS540:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS541
+	call v4__dscheck
+.LDS541:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS542
+	call v4__dscheck
+.LDS542:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,191,.LM3261-main
+.LM3261:
+	mov $1700,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS543
+	call v4__dscheck
+.LDS543:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS544
+	call v4__dscheck
+.LDS544:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS545
+	call v4__dscheck
+.LDS545:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,192,.LM3273-main
+.LM3273:
+	mov $1710,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS546
+	call v4__dscheck
+.LDS546:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS547
+	call v4__dscheck
+.LDS547:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS548
+	call v4__dscheck
+.LDS548:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,193,.LM3285-main
+.LM3285:
+	mov $1720,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS549
+	call v4__dscheck
+.LDS549:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS550
+	call v4__dscheck
+.LDS550:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS551
+	call v4__dscheck
+.LDS551:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,194,.LM3297-main
+.LM3297:
+	mov $1730,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS552
+	call v4__dscheck
+.LDS552:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS553
+	call v4__dscheck
+.LDS553:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS554
+	call v4__dscheck
+.LDS554:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,195,.LM3309-main
+.LM3309:
+	mov $1740,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS555
+	call v4__dscheck
+.LDS555:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS556
+	call v4__dscheck
+.LDS556:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS557
+	call v4__dscheck
+.LDS557:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,196,.LM3321-main
+.LM3321:
+	mov $1750,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS558
+	call v4__dscheck
+.LDS558:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS559
+	call v4__dscheck
+.LDS559:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS560
+	call v4__dscheck
+.LDS560:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,197,.LM3333-main
+.LM3333:
+	mov $1760,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS561
+	call v4__dscheck
+.LDS561:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS562
+	call v4__dscheck
+.LDS562:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS563
+	call v4__dscheck
+.LDS563:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,198,.LM3345-main
+.LM3345:
+	mov $1770,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS564
+	call v4__dscheck
+.LDS564:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS565
+	call v4__dscheck
+.LDS565:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS566
+	call v4__dscheck
+.LDS566:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,199,.LM3357-main
+.LM3357:
+	mov $1780,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS567
+	call v4__dscheck
+.LDS567:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS568
+	call v4__dscheck
+.LDS568:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS569
+	call v4__dscheck
+.LDS569:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,201,.LM3369-main
+.LM3369:
+	mov $1800,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS570
+	call v4__dscheck
+.LDS570:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS571
+	call v4__dscheck
+.LDS571:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS572
+	call v4__dscheck
+.LDS572:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,202,.LM3381-main
+.LM3381:
+	mov $1810,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS573
+	call v4__dscheck
+.LDS573:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS574
+	call v4__dscheck
+.LDS574:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS575
+	call v4__dscheck
+.LDS575:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,203,.LM3393-main
+.LM3393:
+	mov $1820,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS576
+	call v4__dscheck
+.LDS576:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS577
+	call v4__dscheck
+.LDS577:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS578
+	call v4__dscheck
+.LDS578:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,204,.LM3405-main
+.LM3405:
+	mov $1830,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS579
+	call v4__dscheck
+.LDS579:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS580
+	call v4__dscheck
+.LDS580:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS581
+	call v4__dscheck
+.LDS581:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,205,.LM3417-main
+.LM3417:
+	mov $1840,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS582
+	call v4__dscheck
+.LDS582:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS583
+	call v4__dscheck
+.LDS583:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS584
+	call v4__dscheck
+.LDS584:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,206,.LM3429-main
+.LM3429:
+	mov $1850,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS585
+	call v4__dscheck
+.LDS585:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS586
+	call v4__dscheck
+.LDS586:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS587
+	call v4__dscheck
+.LDS587:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,207,.LM3441-main
+.LM3441:
+	mov $1860,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS588
+	call v4__dscheck
+.LDS588:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS589
+	call v4__dscheck
+.LDS589:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS590
+	call v4__dscheck
+.LDS590:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,208,.LM3453-main
+.LM3453:
+	mov $1870,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS591
+	call v4__dscheck
+.LDS591:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS592
+	call v4__dscheck
+.LDS592:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS593
+	call v4__dscheck
+.LDS593:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,209,.LM3465-main
+.LM3465:
+	mov $1880,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS594
+	call v4__dscheck
+.LDS594:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS595
+	call v4__dscheck
+.LDS595:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS596
+	call v4__dscheck
+.LDS596:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,210,.LM3477-main
+.LM3477:
+	mov $1890,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS597
+	call v4__dscheck
+.LDS597:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS598
+	call v4__dscheck
+.LDS598:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS599
+	call v4__dscheck
+.LDS599:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,211,.LM3489-main
+.LM3489:
+	mov $1900,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS600
+	call v4__dscheck
+.LDS600:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS601
+	call v4__dscheck
+.LDS601:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS602
+	call v4__dscheck
+.LDS602:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,212,.LM3501-main
+.LM3501:
+	mov $1910,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS603
+	call v4__dscheck
+.LDS603:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS604
+	call v4__dscheck
+.LDS604:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS605
+	call v4__dscheck
+.LDS605:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,213,.LM3513-main
+.LM3513:
+	mov $1920,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS606
+	call v4__dscheck
+.LDS606:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS607
+	call v4__dscheck
+.LDS607:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS608
+	call v4__dscheck
+.LDS608:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,214,.LM3525-main
+.LM3525:
+	mov $1930,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS609
+	call v4__dscheck
+.LDS609:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS610
+	call v4__dscheck
+.LDS610:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS611
+	call v4__dscheck
+.LDS611:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,215,.LM3537-main
+.LM3537:
+	mov $1940,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS612
+	call v4__dscheck
+.LDS612:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS613
+	call v4__dscheck
+.LDS613:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS614
+	call v4__dscheck
+.LDS614:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,216,.LM3549-main
+.LM3549:
+	mov $1950,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS615
+	call v4__dscheck
+.LDS615:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS616
+	call v4__dscheck
+.LDS616:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS617
+	call v4__dscheck
+.LDS617:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,219,.LM3561-main
+.LM3561:
+	lea .LC4(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $27,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS618
+	call v4__dscheck
+.LDS618:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,222,.LM3567-main
+.LM3567:
+	mov $1960,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS619
+	call v4__dscheck
+.LDS619:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS620
+	call v4__dscheck
+.LDS620:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS621
+	call v4__dscheck
+.LDS621:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,223,.LM3576-main
+.LM3576:
+	mov $1961,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS622
+	call v4__dscheck
+.LDS622:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS623
+	call v4__dscheck
+.LDS623:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS624
+	call v4__dscheck
+.LDS624:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,224,.LM3585-main
+.LM3585:
+	mov $1962,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS625
+	call v4__dscheck
+.LDS625:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS626
+	call v4__dscheck
+.LDS626:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS627
+	call v4__dscheck
+.LDS627:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,225,.LM3594-main
+.LM3594:
+	mov $1963,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS628
+	call v4__dscheck
+.LDS628:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS629
+	call v4__dscheck
+.LDS629:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS630
+	call v4__dscheck
+.LDS630:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,226,.LM3603-main
+.LM3603:
+	mov $1964,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS631
+	call v4__dscheck
+.LDS631:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $2147483648,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS632
+	call v4__dscheck
+.LDS632:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $2147483648,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS633
+	call v4__dscheck
+.LDS633:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,227,.LM3613-main
+.LM3613:
+	mov $1965,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS634
+	call v4__dscheck
+.LDS634:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $4294967296,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS635
+	call v4__dscheck
+.LDS635:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS636
+	call v4__dscheck
+.LDS636:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS637
+	call v4__dscheck
+.LDS637:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $8589934592,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS638
+	call v4__dscheck
+.LDS638:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,228,.LM3628-main
+.LM3628:
+	mov $1966,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS639
+	call v4__dscheck
+.LDS639:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS640
+	call v4__dscheck
+.LDS640:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS641
+	call v4__dscheck
+.LDS641:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,229,.LM3640-main
+.LM3640:
+	mov $1967,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS642
+	call v4__dscheck
+.LDS642:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $12345678901,%rax
+	push %rax
+	mov $5270498306774157605,%rdx
+	imul %rdx
+	sar $1,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS643
+	call v4__dscheck
+.LDS643:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $1763668414,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS644
+	call v4__dscheck
+.LDS644:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,230,.LM3655-main
+.LM3655:
+	mov $1968,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS645
+	call v4__dscheck
+.LDS645:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $1099511627776,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS646
+	call v4__dscheck
+.LDS646:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $1099511627776,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS647
+	call v4__dscheck
+.LDS647:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,240,.LM3667-main
+.LM3667:
+	lea .LC5(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $75,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS648
+	call v4__dscheck
+.LDS648:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,242,.LM3673-main
+.LM3673:
+	mov $2000,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS649
+	call v4__dscheck
+.LDS649:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS650
+	call v4__dscheck
+.LDS650:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2drop
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,243,.LM3683-main
+.LM3683:
+	mov $2010,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS651
+	call v4__dscheck
+.LDS651:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS652
+	call v4__dscheck
+.LDS652:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2dup
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS653
+	call v4__dscheck
+.LDS653:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,244,.LM3701-main
+.LM3701:
+	mov $2020,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS654
+	call v4__dscheck
+.LDS654:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS655
+	call v4__dscheck
+.LDS655:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2over
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS656
+	call v4__dscheck
+.LDS656:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,245,.LM3727-main
+.LM3727:
+	mov $2030,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS657
+	call v4__dscheck
+.LDS657:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS658
+	call v4__dscheck
+.LDS658:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2swap
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS659
+	call v4__dscheck
+.LDS659:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,246,.LM3749-main
+.LM3749:
+	mov $2040,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS660
+	call v4__dscheck
+.LDS660:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS661
+	call v4__dscheck
+.LDS661:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Questiondup
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS662
+	call v4__dscheck
+.LDS662:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,247,.LM3759-main
+.LM3759:
+	mov $2050,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS663
+	call v4__dscheck
+.LDS663:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS664
+	call v4__dscheck
+.LDS664:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Questiondup
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS665
+	call v4__dscheck
+.LDS665:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,248,.LM3771-main
+.LM3771:
+	mov $2060,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS666
+	call v4__dscheck
+.LDS666:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS667
+	call v4__dscheck
+.LDS667:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Questiondup
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS668
+	call v4__dscheck
+.LDS668:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,249,.LM3783-main
+.LM3783:
+	mov $2070,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS669
+	call v4__dscheck
+.LDS669:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_depth
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS670
+	call v4__dscheck
+.LDS670:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,250,.LM3791-main
+.LM3791:
+	mov $2080,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS671
+	call v4__dscheck
+.LDS671:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS672
+	call v4__dscheck
+.LDS672:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_depth
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS673
+	call v4__dscheck
+.LDS673:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,251,.LM3803-main
+.LM3803:
+	mov $2090,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS674
+	call v4__dscheck
+.LDS674:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS675
+	call v4__dscheck
+.LDS675:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_depth
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS676
+	call v4__dscheck
+.LDS676:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,252,.LM3819-main
+.LM3819:
+	mov $2100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS677
+	call v4__dscheck
+.LDS677:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS678
+	call v4__dscheck
+.LDS678:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,253,.LM3827-main
+.LM3827:
+	mov $2110,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS679
+	call v4__dscheck
+.LDS679:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS680
+	call v4__dscheck
+.LDS680:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS681
+	call v4__dscheck
+.LDS681:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,254,.LM3839-main
+.LM3839:
+	mov $2120,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS682
+	call v4__dscheck
+.LDS682:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS683
+	call v4__dscheck
+.LDS683:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS684
+	call v4__dscheck
+.LDS684:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,255,.LM3851-main
+.LM3851:
+	mov $2130,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS685
+	call v4__dscheck
+.LDS685:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS686
+	call v4__dscheck
+.LDS686:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_over
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS687
+	call v4__dscheck
+.LDS687:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,256,.LM3867-main
+.LM3867:
+	mov $2140,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS688
+	call v4__dscheck
+.LDS688:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS689
+	call v4__dscheck
+.LDS689:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_rot
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS690
+	call v4__dscheck
+.LDS690:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,257,.LM3885-main
+.LM3885:
+	mov $2150,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS691
+	call v4__dscheck
+.LDS691:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS692
+	call v4__dscheck
+.LDS692:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS693
+	call v4__dscheck
+.LDS693:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,260,.LM3899-main
+.LM3899:
+	lea .LC6(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $16,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS694
+	call v4__dscheck
+.LDS694:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,262,.LM3905-main
+.LM3905:
+	mov $2200,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS695
+	call v4__dscheck
+.LDS695:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,263,.LM3910-main
+.LM3910:
+	mov $2210,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS696
+	call v4__dscheck
+.LDS696:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,264,.LM3915-main
+.LM3915:
+	mov $2220,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS697
+	call v4__dscheck
+.LDS697:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,262,.LM3921-main
+.LM3921:
+	cmp $4080,%rcx
+	jbe .LDS698
+	call v4__dscheck
+.LDS698:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_r_Greater
+.stabn 68,0,264,.LM3923-main
+.LM3923:
+	call v4_Minus_Greater
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS699
+	call v4__dscheck
+.LDS699:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,265,.LM3927-main
+.LM3927:
+	mov $2230,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS700
+	call v4__dscheck
+.LDS700:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,263,.LM3933-main
+.LM3933:
+	cmp $4080,%rcx
+	jbe .LDS701
+	call v4__dscheck
+.LDS701:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_r_Fetch
+	call v4_r_Greater
+	call v4_drop
+.stabn 68,0,265,.LM3937-main
+.LM3937:
+	call v4_Minus_Greater
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS702
+	call v4__dscheck
+.LDS702:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,268,.LM3941-main
+.LM3941:
+	lea .LC7(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $42,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS703
+	call v4__dscheck
+.LDS703:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,270,.LM3947-main
+.LM3947:
+	mov $2280,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS704
+	call v4__dscheck
+.LDS704:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS705
+	call v4__dscheck
+.LDS705:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS706
+	call v4__dscheck
+.LDS706:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,271,.LM3959-main
+.LM3959:
+	mov $2290,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS707
+	call v4__dscheck
+.LDS707:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS708
+	call v4__dscheck
+.LDS708:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS709
+	call v4__dscheck
+.LDS709:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,272,.LM3971-main
+.LM3971:
+	mov $2300,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS710
+	call v4__dscheck
+.LDS710:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS711
+	call v4__dscheck
+.LDS711:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS712
+	call v4__dscheck
+.LDS712:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,273,.LM3983-main
+.LM3983:
+	mov $2310,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS713
+	call v4__dscheck
+.LDS713:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS714
+	call v4__dscheck
+.LDS714:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS715
+	call v4__dscheck
+.LDS715:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,274,.LM3995-main
+.LM3995:
+	mov $2320,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS716
+	call v4__dscheck
+.LDS716:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS717
+	call v4__dscheck
+.LDS717:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS718
+	call v4__dscheck
+.LDS718:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,275,.LM4007-main
+.LM4007:
+	mov $2330,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS719
+	call v4__dscheck
+.LDS719:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS720
+	call v4__dscheck
+.LDS720:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS721
+	call v4__dscheck
+.LDS721:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,276,.LM4019-main
+.LM4019:
+	mov $2340,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS722
+	call v4__dscheck
+.LDS722:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS723
+	call v4__dscheck
+.LDS723:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS724
+	call v4__dscheck
+.LDS724:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,277,.LM4031-main
+.LM4031:
+	mov $2350,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS725
+	call v4__dscheck
+.LDS725:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS726
+	call v4__dscheck
+.LDS726:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS727
+	call v4__dscheck
+.LDS727:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,278,.LM4043-main
+.LM4043:
+	mov $2360,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS728
+	call v4__dscheck
+.LDS728:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS729
+	call v4__dscheck
+.LDS729:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS730
+	call v4__dscheck
+.LDS730:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,279,.LM4055-main
+.LM4055:
+	mov $2370,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS731
+	call v4__dscheck
+.LDS731:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS732
+	call v4__dscheck
+.LDS732:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS733
+	call v4__dscheck
+.LDS733:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,281,.LM4067-main
+.LM4067:
+	mov $2390,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS734
+	call v4__dscheck
+.LDS734:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS735
+	call v4__dscheck
+.LDS735:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS736
+	call v4__dscheck
+.LDS736:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,282,.LM4079-main
+.LM4079:
+	mov $2400,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS737
+	call v4__dscheck
+.LDS737:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS738
+	call v4__dscheck
+.LDS738:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS739
+	call v4__dscheck
+.LDS739:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,283,.LM4091-main
+.LM4091:
+	mov $2410,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS740
+	call v4__dscheck
+.LDS740:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS741
+	call v4__dscheck
+.LDS741:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS742
+	call v4__dscheck
+.LDS742:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,284,.LM4103-main
+.LM4103:
+	mov $2420,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS743
+	call v4__dscheck
+.LDS743:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS744
+	call v4__dscheck
+.LDS744:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS745
+	call v4__dscheck
+.LDS745:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,285,.LM4115-main
+.LM4115:
+	mov $2430,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS746
+	call v4__dscheck
+.LDS746:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS747
+	call v4__dscheck
+.LDS747:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS748
+	call v4__dscheck
+.LDS748:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,286,.LM4127-main
+.LM4127:
+	mov $2440,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS749
+	call v4__dscheck
+.LDS749:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS750
+	call v4__dscheck
+.LDS750:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS751
+	call v4__dscheck
+.LDS751:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,287,.LM4139-main
+.LM4139:
+	mov $2450,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS752
+	call v4__dscheck
+.LDS752:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS753
+	call v4__dscheck
+.LDS753:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS754
+	call v4__dscheck
+.LDS754:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,288,.LM4151-main
+.LM4151:
+	mov $2460,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS755
+	call v4__dscheck
+.LDS755:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS756
+	call v4__dscheck
+.LDS756:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS757
+	call v4__dscheck
+.LDS757:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,289,.LM4163-main
+.LM4163:
+	mov $2470,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS758
+	call v4__dscheck
+.LDS758:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS759
+	call v4__dscheck
+.LDS759:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS760
+	call v4__dscheck
+.LDS760:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,290,.LM4175-main
+.LM4175:
+	mov $2480,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS761
+	call v4__dscheck
+.LDS761:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS762
+	call v4__dscheck
+.LDS762:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS763
+	call v4__dscheck
+.LDS763:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,292,.LM4187-main
+.LM4187:
+	mov $2500,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS764
+	call v4__dscheck
+.LDS764:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS765
+	call v4__dscheck
+.LDS765:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS766
+	call v4__dscheck
+.LDS766:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,293,.LM4197-main
+.LM4197:
+	mov $2510,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS767
+	call v4__dscheck
+.LDS767:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS768
+	call v4__dscheck
+.LDS768:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS769
+	call v4__dscheck
+.LDS769:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,294,.LM4207-main
+.LM4207:
+	mov $2520,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS770
+	call v4__dscheck
+.LDS770:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS771
+	call v4__dscheck
+.LDS771:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS772
+	call v4__dscheck
+.LDS772:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,295,.LM4217-main
+.LM4217:
+	mov $2530,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS773
+	call v4__dscheck
+.LDS773:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS774
+	call v4__dscheck
+.LDS774:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS775
+	call v4__dscheck
+.LDS775:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,297,.LM4227-main
+.LM4227:
+	mov $2550,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS776
+	call v4__dscheck
+.LDS776:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS777
+	call v4__dscheck
+.LDS777:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS778
+	call v4__dscheck
+.LDS778:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,298,.LM4237-main
+.LM4237:
+	mov $2560,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS779
+	call v4__dscheck
+.LDS779:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS780
+	call v4__dscheck
+.LDS780:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS781
+	call v4__dscheck
+.LDS781:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,299,.LM4247-main
+.LM4247:
+	mov $2570,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS782
+	call v4__dscheck
+.LDS782:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS783
+	call v4__dscheck
+.LDS783:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS784
+	call v4__dscheck
+.LDS784:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,300,.LM4257-main
+.LM4257:
+	mov $2580,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS785
+	call v4__dscheck
+.LDS785:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS786
+	call v4__dscheck
+.LDS786:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS787
+	call v4__dscheck
+.LDS787:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,302,.LM4267-main
+.LM4267:
+	mov $2600,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS788
+	call v4__dscheck
+.LDS788:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS789
+	call v4__dscheck
+.LDS789:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS790
+	call v4__dscheck
+.LDS790:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,303,.LM4277-main
+.LM4277:
+	mov $2610,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS791
+	call v4__dscheck
+.LDS791:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS792
+	call v4__dscheck
+.LDS792:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS793
+	call v4__dscheck
+.LDS793:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,304,.LM4287-main
+.LM4287:
+	mov $2620,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS794
+	call v4__dscheck
+.LDS794:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS795
+	call v4__dscheck
+.LDS795:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS796
+	call v4__dscheck
+.LDS796:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,305,.LM4297-main
+.LM4297:
+	mov $2630,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS797
+	call v4__dscheck
+.LDS797:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS798
+	call v4__dscheck
+.LDS798:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS799
+	call v4__dscheck
+.LDS799:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,306,.LM4307-main
+.LM4307:
+	mov $2640,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS800
+	call v4__dscheck
+.LDS800:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS801
+	call v4__dscheck
+.LDS801:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS802
+	call v4__dscheck
+.LDS802:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,308,.LM4317-main
+.LM4317:
+	mov $2660,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS803
+	call v4__dscheck
+.LDS803:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS804
+	call v4__dscheck
+.LDS804:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS805
+	call v4__dscheck
+.LDS805:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,309,.LM4327-main
+.LM4327:
+	mov $2670,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS806
+	call v4__dscheck
+.LDS806:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS807
+	call v4__dscheck
+.LDS807:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS808
+	call v4__dscheck
+.LDS808:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,310,.LM4337-main
+.LM4337:
+	mov $2680,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS809
+	call v4__dscheck
+.LDS809:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS810
+	call v4__dscheck
+.LDS810:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS811
+	call v4__dscheck
+.LDS811:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,311,.LM4347-main
+.LM4347:
+	mov $2690,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS812
+	call v4__dscheck
+.LDS812:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS813
+	call v4__dscheck
+.LDS813:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS814
+	call v4__dscheck
+.LDS814:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,314,.LM4357-main
+.LM4357:
+	lea .LC8(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $30,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS815
+	call v4__dscheck
+.LDS815:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,316,.LM4363-main
+.LM4363:
+	mov $2740,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS816
+	call v4__dscheck
+.LDS816:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS817
+	call v4__dscheck
+.LDS817:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS818
+	call v4__dscheck
+.LDS818:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,317,.LM4375-main
+.LM4375:
+	mov $2750,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS819
+	call v4__dscheck
+.LDS819:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS820
+	call v4__dscheck
+.LDS820:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS821
+	call v4__dscheck
+.LDS821:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,318,.LM4387-main
+.LM4387:
+	mov $2760,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS822
+	call v4__dscheck
+.LDS822:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS823
+	call v4__dscheck
+.LDS823:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS824
+	call v4__dscheck
+.LDS824:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,319,.LM4399-main
+.LM4399:
+	mov $2770,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS825
+	call v4__dscheck
+.LDS825:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS826
+	call v4__dscheck
+.LDS826:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS827
+	call v4__dscheck
+.LDS827:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,320,.LM4411-main
+.LM4411:
+	mov $2780,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS828
+	call v4__dscheck
+.LDS828:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS829
+	call v4__dscheck
+.LDS829:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS830
+	call v4__dscheck
+.LDS830:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,321,.LM4423-main
+.LM4423:
+	mov $2790,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS831
+	call v4__dscheck
+.LDS831:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS832
+	call v4__dscheck
+.LDS832:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS833
+	call v4__dscheck
+.LDS833:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,322,.LM4435-main
+.LM4435:
+	mov $2800,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS834
+	call v4__dscheck
+.LDS834:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS835
+	call v4__dscheck
+.LDS835:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS836
+	call v4__dscheck
+.LDS836:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,324,.LM4447-main
+.LM4447:
+	mov $2820,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS837
+	call v4__dscheck
+.LDS837:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS838
+	call v4__dscheck
+.LDS838:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS839
+	call v4__dscheck
+.LDS839:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,325,.LM4460-main
+.LM4460:
+	mov $2830,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS840
+	call v4__dscheck
+.LDS840:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS841
+	call v4__dscheck
+.LDS841:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS842
+	call v4__dscheck
+.LDS842:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,326,.LM4473-main
+.LM4473:
+	mov $2840,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS843
+	call v4__dscheck
+.LDS843:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS844
+	call v4__dscheck
+.LDS844:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS845
+	call v4__dscheck
+.LDS845:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,327,.LM4486-main
+.LM4486:
+	mov $2850,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS846
+	call v4__dscheck
+.LDS846:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS847
+	call v4__dscheck
+.LDS847:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS848
+	call v4__dscheck
+.LDS848:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,328,.LM4499-main
+.LM4499:
+	mov $2860,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS849
+	call v4__dscheck
+.LDS849:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS850
+	call v4__dscheck
+.LDS850:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS851
+	call v4__dscheck
+.LDS851:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,329,.LM4512-main
+.LM4512:
+	mov $2870,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS852
+	call v4__dscheck
+.LDS852:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS853
+	call v4__dscheck
+.LDS853:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS854
+	call v4__dscheck
+.LDS854:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,330,.LM4525-main
+.LM4525:
+	mov $2880,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS855
+	call v4__dscheck
+.LDS855:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS856
+	call v4__dscheck
+.LDS856:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS857
+	call v4__dscheck
+.LDS857:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,331,.LM4538-main
+.LM4538:
+	mov $2890,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS858
+	call v4__dscheck
+.LDS858:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS859
+	call v4__dscheck
+.LDS859:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS860
+	call v4__dscheck
+.LDS860:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,332,.LM4551-main
+.LM4551:
+	mov $2900,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS861
+	call v4__dscheck
+.LDS861:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS862
+	call v4__dscheck
+.LDS862:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS863
+	call v4__dscheck
+.LDS863:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,333,.LM4564-main
+.LM4564:
+	mov $2910,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS864
+	call v4__dscheck
+.LDS864:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS865
+	call v4__dscheck
+.LDS865:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS866
+	call v4__dscheck
+.LDS866:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,334,.LM4577-main
+.LM4577:
+	mov $2920,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS867
+	call v4__dscheck
+.LDS867:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS868
+	call v4__dscheck
+.LDS868:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS869
+	call v4__dscheck
+.LDS869:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,335,.LM4590-main
+.LM4590:
+	mov $2930,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS870
+	call v4__dscheck
+.LDS870:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS871
+	call v4__dscheck
+.LDS871:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS872
+	call v4__dscheck
+.LDS872:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,336,.LM4604-main
+.LM4604:
+	mov $2940,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS873
+	call v4__dscheck
+.LDS873:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS874
+	call v4__dscheck
+.LDS874:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS875
+	call v4__dscheck
+.LDS875:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,337,.LM4617-main
+.LM4617:
+	mov $2950,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS876
+	call v4__dscheck
+.LDS876:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS877
+	call v4__dscheck
+.LDS877:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS878
+	call v4__dscheck
+.LDS878:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	call v4_Rightbrace
+.stabn 68,0,338,.LM4630-main
+.LM4630:
+	mov $2960,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS879
+	call v4__dscheck
+.LDS879:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS880
+	call v4__dscheck
+.LDS880:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS881
+	call v4__dscheck
+.LDS881:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,339,.LM4647-main
+.LM4647:
+	mov $2970,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS882
+	call v4__dscheck
+.LDS882:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS883
+	call v4__dscheck
+.LDS883:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov v4_msb(%rip),%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	xchg %rdx,%rcx
+	shr %cl,%rax
+	xchg %rdx,%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS884
+	call v4__dscheck
+.LDS884:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,340,.LM4668-main
+.LM4668:
+	mov $2980,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS885
+	call v4__dscheck
+.LDS885:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS886
+	call v4__dscheck
+.LDS886:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	mov v4_msb(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS887
+	call v4__dscheck
+.LDS887:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2_Slash
+	call v4_Rightbrace
+.stabn 68,0,341,.LM4683-main
+.LM4683:
+	mov $2990,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS888
+	call v4__dscheck
+.LDS888:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS889
+	call v4__dscheck
+.LDS889:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov v4_msb(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS890
+	call v4__dscheck
+.LDS890:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2_Slash
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	not %rax
+	cmp $4080,%rcx
+	jbe .LDS891
+	call v4__dscheck
+.LDS891:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS892
+	call v4__dscheck
+.LDS892:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,343,.LM4702-main
+.LM4702:
+	mov $3010,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS893
+	call v4__dscheck
+.LDS893:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS894
+	call v4__dscheck
+.LDS894:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS895
+	call v4__dscheck
+.LDS895:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,344,.LM4714-main
+.LM4714:
+	mov $3020,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS896
+	call v4__dscheck
+.LDS896:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS897
+	call v4__dscheck
+.LDS897:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS898
+	call v4__dscheck
+.LDS898:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,345,.LM4726-main
+.LM4726:
+	mov $3030,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS899
+	call v4__dscheck
+.LDS899:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS900
+	call v4__dscheck
+.LDS900:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS901
+	call v4__dscheck
+.LDS901:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,346,.LM4738-main
+.LM4738:
+	mov $3040,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS902
+	call v4__dscheck
+.LDS902:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS903
+	call v4__dscheck
+.LDS903:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS904
+	call v4__dscheck
+.LDS904:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,347,.LM4750-main
+.LM4750:
+	mov $3050,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS905
+	call v4__dscheck
+.LDS905:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS906
+	call v4__dscheck
+.LDS906:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS907
+	call v4__dscheck
+.LDS907:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,348,.LM4762-main
+.LM4762:
+	mov $3060,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS908
+	call v4__dscheck
+.LDS908:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS909
+	call v4__dscheck
+.LDS909:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS910
+	call v4__dscheck
+.LDS910:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,349,.LM4774-main
+.LM4774:
+	mov $3070,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS911
+	call v4__dscheck
+.LDS911:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS912
+	call v4__dscheck
+.LDS912:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS913
+	call v4__dscheck
+.LDS913:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,350,.LM4786-main
+.LM4786:
+	mov $3080,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS914
+	call v4__dscheck
+.LDS914:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS915
+	call v4__dscheck
+.LDS915:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS916
+	call v4__dscheck
+.LDS916:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,351,.LM4798-main
+.LM4798:
+	mov $3090,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS917
+	call v4__dscheck
+.LDS917:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS918
+	call v4__dscheck
+.LDS918:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS919
+	call v4__dscheck
+.LDS919:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,353,.LM4810-main
+.LM4810:
+	mov $3110,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS920
+	call v4__dscheck
+.LDS920:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS921
+	call v4__dscheck
+.LDS921:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS922
+	call v4__dscheck
+.LDS922:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,354,.LM4825-main
+.LM4825:
+	mov $3120,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS923
+	call v4__dscheck
+.LDS923:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS924
+	call v4__dscheck
+.LDS924:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS925
+	call v4__dscheck
+.LDS925:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,355,.LM4840-main
+.LM4840:
+	mov $3130,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS926
+	call v4__dscheck
+.LDS926:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS927
+	call v4__dscheck
+.LDS927:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS928
+	call v4__dscheck
+.LDS928:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,357,.LM4858-main
+.LM4858:
+	mov $3150,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS929
+	call v4__dscheck
+.LDS929:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS930
+	call v4__dscheck
+.LDS930:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS931
+	call v4__dscheck
+.LDS931:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,358,.LM4872-main
+.LM4872:
+	mov $3160,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS932
+	call v4__dscheck
+.LDS932:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS933
+	call v4__dscheck
+.LDS933:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS934
+	call v4__dscheck
+.LDS934:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,359,.LM4886-main
+.LM4886:
+	mov $3170,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS935
+	call v4__dscheck
+.LDS935:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS936
+	call v4__dscheck
+.LDS936:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS937
+	call v4__dscheck
+.LDS937:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,360,.LM4900-main
+.LM4900:
+	mov $3180,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS938
+	call v4__dscheck
+.LDS938:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS939
+	call v4__dscheck
+.LDS939:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS940
+	call v4__dscheck
+.LDS940:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,361,.LM4914-main
+.LM4914:
+	mov $3190,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS941
+	call v4__dscheck
+.LDS941:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS942
+	call v4__dscheck
+.LDS942:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS943
+	call v4__dscheck
+.LDS943:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,362,.LM4928-main
+.LM4928:
+	mov $3200,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS944
+	call v4__dscheck
+.LDS944:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS945
+	call v4__dscheck
+.LDS945:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS946
+	call v4__dscheck
+.LDS946:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,364,.LM4942-main
+.LM4942:
+	mov $3220,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS947
+	call v4__dscheck
+.LDS947:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $4611686018427387904,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS948
+	call v4__dscheck
+.LDS948:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS949
+	call v4__dscheck
+.LDS949:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,365,.LM4959-main
+.LM4959:
+	mov $3230,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS950
+	call v4__dscheck
+.LDS950:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS951
+	call v4__dscheck
+.LDS951:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS952
+	call v4__dscheck
+.LDS952:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,366,.LM4973-main
+.LM4973:
+	mov $3240,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS953
+	call v4__dscheck
+.LDS953:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS954
+	call v4__dscheck
+.LDS954:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS955
+	call v4__dscheck
+.LDS955:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,367,.LM4987-main
+.LM4987:
+	mov $3250,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS956
+	call v4__dscheck
+.LDS956:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS957
+	call v4__dscheck
+.LDS957:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS958
+	call v4__dscheck
+.LDS958:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,368,.LM5004-main
+.LM5004:
+	mov $3260,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS959
+	call v4__dscheck
+.LDS959:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS960
+	call v4__dscheck
+.LDS960:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS961
+	call v4__dscheck
+.LDS961:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,371,.LM5019-main
+.LM5019:
+	lea .LC9(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $56,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS962
+	call v4__dscheck
+.LDS962:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,373,.LM5025-main
+.LM5025:
+	mov $3310,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS963
+	call v4__dscheck
+.LDS963:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS964
+	call v4__dscheck
+.LDS964:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS965
+	call v4__dscheck
+.LDS965:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS966
+	call v4__dscheck
+.LDS966:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,374,.LM5040-main
+.LM5040:
+	mov $3320,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS967
+	call v4__dscheck
+.LDS967:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS968
+	call v4__dscheck
+.LDS968:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS969
+	call v4__dscheck
+.LDS969:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS970
+	call v4__dscheck
+.LDS970:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,375,.LM5055-main
+.LM5055:
+	mov $3330,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS971
+	call v4__dscheck
+.LDS971:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS972
+	call v4__dscheck
+.LDS972:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS973
+	call v4__dscheck
+.LDS973:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS974
+	call v4__dscheck
+.LDS974:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,376,.LM5070-main
+.LM5070:
+	mov $3340,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS975
+	call v4__dscheck
+.LDS975:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS976
+	call v4__dscheck
+.LDS976:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS977
+	call v4__dscheck
+.LDS977:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS978
+	call v4__dscheck
+.LDS978:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,377,.LM5085-main
+.LM5085:
+	mov $3350,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS979
+	call v4__dscheck
+.LDS979:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS980
+	call v4__dscheck
+.LDS980:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS981
+	call v4__dscheck
+.LDS981:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS982
+	call v4__dscheck
+.LDS982:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,378,.LM5100-main
+.LM5100:
+	mov $3360,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS983
+	call v4__dscheck
+.LDS983:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS984
+	call v4__dscheck
+.LDS984:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS985
+	call v4__dscheck
+.LDS985:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS986
+	call v4__dscheck
+.LDS986:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,379,.LM5115-main
+.LM5115:
+	mov $3370,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS987
+	call v4__dscheck
+.LDS987:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS988
+	call v4__dscheck
+.LDS988:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS989
+	call v4__dscheck
+.LDS989:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS990
+	call v4__dscheck
+.LDS990:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,380,.LM5130-main
+.LM5130:
+	mov $3380,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS991
+	call v4__dscheck
+.LDS991:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS992
+	call v4__dscheck
+.LDS992:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS993
+	call v4__dscheck
+.LDS993:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS994
+	call v4__dscheck
+.LDS994:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,381,.LM5145-main
+.LM5145:
+	mov $3390,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS995
+	call v4__dscheck
+.LDS995:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS996
+	call v4__dscheck
+.LDS996:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS997
+	call v4__dscheck
+.LDS997:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS998
+	call v4__dscheck
+.LDS998:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,382,.LM5160-main
+.LM5160:
+	mov $3400,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS999
+	call v4__dscheck
+.LDS999:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1000
+	call v4__dscheck
+.LDS1000:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1001
+	call v4__dscheck
+.LDS1001:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1002
+	call v4__dscheck
+.LDS1002:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,383,.LM5175-main
+.LM5175:
+	mov $3410,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1003
+	call v4__dscheck
+.LDS1003:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1004
+	call v4__dscheck
+.LDS1004:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1005
+	call v4__dscheck
+.LDS1005:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1006
+	call v4__dscheck
+.LDS1006:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,384,.LM5190-main
+.LM5190:
+	mov $3420,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1007
+	call v4__dscheck
+.LDS1007:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1008
+	call v4__dscheck
+.LDS1008:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1009
+	call v4__dscheck
+.LDS1009:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1010
+	call v4__dscheck
+.LDS1010:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,385,.LM5205-main
+.LM5205:
+	mov $3430,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1011
+	call v4__dscheck
+.LDS1011:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1012
+	call v4__dscheck
+.LDS1012:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1013
+	call v4__dscheck
+.LDS1013:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1014
+	call v4__dscheck
+.LDS1014:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,386,.LM5220-main
+.LM5220:
+	mov $3440,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1015
+	call v4__dscheck
+.LDS1015:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1016
+	call v4__dscheck
+.LDS1016:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1017
+	call v4__dscheck
+.LDS1017:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1018
+	call v4__dscheck
+.LDS1018:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,387,.LM5235-main
+.LM5235:
+	mov $3450,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1019
+	call v4__dscheck
+.LDS1019:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1020
+	call v4__dscheck
+.LDS1020:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1021
+	call v4__dscheck
+.LDS1021:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1022
+	call v4__dscheck
+.LDS1022:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,388,.LM5250-main
+.LM5250:
+	mov $3460,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1023
+	call v4__dscheck
+.LDS1023:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1024
+	call v4__dscheck
+.LDS1024:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1025
+	call v4__dscheck
+.LDS1025:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1026
+	call v4__dscheck
+.LDS1026:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,389,.LM5265-main
+.LM5265:
+	mov $3470,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1027
+	call v4__dscheck
+.LDS1027:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1028
+	call v4__dscheck
+.LDS1028:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1029
+	call v4__dscheck
+.LDS1029:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1030
+	call v4__dscheck
+.LDS1030:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,390,.LM5280-main
+.LM5280:
+	mov $3480,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1031
+	call v4__dscheck
+.LDS1031:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1032
+	call v4__dscheck
+.LDS1032:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1033
+	call v4__dscheck
+.LDS1033:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1034
+	call v4__dscheck
+.LDS1034:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,391,.LM5295-main
+.LM5295:
+	mov $3490,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1035
+	call v4__dscheck
+.LDS1035:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1036
+	call v4__dscheck
+.LDS1036:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1037
+	call v4__dscheck
+.LDS1037:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1038
+	call v4__dscheck
+.LDS1038:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,392,.LM5310-main
+.LM5310:
+	mov $3500,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1039
+	call v4__dscheck
+.LDS1039:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1040
+	call v4__dscheck
+.LDS1040:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1041
+	call v4__dscheck
+.LDS1041:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1042
+	call v4__dscheck
+.LDS1042:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,393,.LM5325-main
+.LM5325:
+	mov $3510,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1043
+	call v4__dscheck
+.LDS1043:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1044
+	call v4__dscheck
+.LDS1044:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1045
+	call v4__dscheck
+.LDS1045:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1046
+	call v4__dscheck
+.LDS1046:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,394,.LM5340-main
+.LM5340:
+	mov $3520,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1047
+	call v4__dscheck
+.LDS1047:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1048
+	call v4__dscheck
+.LDS1048:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1049
+	call v4__dscheck
+.LDS1049:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,395,.LM5356-main
+.LM5356:
+	mov $3530,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1050
+	call v4__dscheck
+.LDS1050:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1051
+	call v4__dscheck
+.LDS1051:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1052
+	call v4__dscheck
+.LDS1052:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1053
+	call v4__dscheck
+.LDS1053:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,396,.LM5373-main
+.LM5373:
+	mov $3540,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1054
+	call v4__dscheck
+.LDS1054:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1055
+	call v4__dscheck
+.LDS1055:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1056
+	call v4__dscheck
+.LDS1056:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1057
+	call v4__dscheck
+.LDS1057:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,397,.LM5390-main
+.LM5390:
+	mov $3550,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1058
+	call v4__dscheck
+.LDS1058:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1059
+	call v4__dscheck
+.LDS1059:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1060
+	call v4__dscheck
+.LDS1060:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1061
+	call v4__dscheck
+.LDS1061:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,398,.LM5407-main
+.LM5407:
+	mov $3560,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1062
+	call v4__dscheck
+.LDS1062:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1063
+	call v4__dscheck
+.LDS1063:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1064
+	call v4__dscheck
+.LDS1064:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1065
+	call v4__dscheck
+.LDS1065:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,399,.LM5424-main
+.LM5424:
+	mov $3570,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1066
+	call v4__dscheck
+.LDS1066:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1067
+	call v4__dscheck
+.LDS1067:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1068
+	call v4__dscheck
+.LDS1068:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1069
+	call v4__dscheck
+.LDS1069:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,400,.LM5441-main
+.LM5441:
+	mov $3580,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1070
+	call v4__dscheck
+.LDS1070:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1071
+	call v4__dscheck
+.LDS1071:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1072
+	call v4__dscheck
+.LDS1072:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1073
+	call v4__dscheck
+.LDS1073:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,401,.LM5458-main
+.LM5458:
+	mov $3590,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1074
+	call v4__dscheck
+.LDS1074:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1075
+	call v4__dscheck
+.LDS1075:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1076
+	call v4__dscheck
+.LDS1076:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1077
+	call v4__dscheck
+.LDS1077:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,402,.LM5475-main
+.LM5475:
+	mov $3600,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1078
+	call v4__dscheck
+.LDS1078:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1079
+	call v4__dscheck
+.LDS1079:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1080
+	call v4__dscheck
+.LDS1080:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1081
+	call v4__dscheck
+.LDS1081:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,403,.LM5492-main
+.LM5492:
+	mov $3610,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1082
+	call v4__dscheck
+.LDS1082:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1083
+	call v4__dscheck
+.LDS1083:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1084
+	call v4__dscheck
+.LDS1084:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1085
+	call v4__dscheck
+.LDS1085:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,404,.LM5509-main
+.LM5509:
+	mov $3620,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1086
+	call v4__dscheck
+.LDS1086:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1087
+	call v4__dscheck
+.LDS1087:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1088
+	call v4__dscheck
+.LDS1088:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1089
+	call v4__dscheck
+.LDS1089:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,405,.LM5526-main
+.LM5526:
+	mov $3630,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1090
+	call v4__dscheck
+.LDS1090:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1091
+	call v4__dscheck
+.LDS1091:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1092
+	call v4__dscheck
+.LDS1092:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1093
+	call v4__dscheck
+.LDS1093:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,406,.LM5543-main
+.LM5543:
+	mov $3640,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1094
+	call v4__dscheck
+.LDS1094:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1095
+	call v4__dscheck
+.LDS1095:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1096
+	call v4__dscheck
+.LDS1096:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fm_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1097
+	call v4__dscheck
+.LDS1097:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,408,.LM5560-main
+.LM5560:
+	mov $3660,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1098
+	call v4__dscheck
+.LDS1098:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1099
+	call v4__dscheck
+.LDS1099:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1100
+	call v4__dscheck
+.LDS1100:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1101
+	call v4__dscheck
+.LDS1101:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,409,.LM5575-main
+.LM5575:
+	mov $3670,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1102
+	call v4__dscheck
+.LDS1102:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1103
+	call v4__dscheck
+.LDS1103:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1104
+	call v4__dscheck
+.LDS1104:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1105
+	call v4__dscheck
+.LDS1105:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,410,.LM5590-main
+.LM5590:
+	mov $3680,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1106
+	call v4__dscheck
+.LDS1106:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1107
+	call v4__dscheck
+.LDS1107:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1108
+	call v4__dscheck
+.LDS1108:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1109
+	call v4__dscheck
+.LDS1109:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,411,.LM5605-main
+.LM5605:
+	mov $3690,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1110
+	call v4__dscheck
+.LDS1110:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1111
+	call v4__dscheck
+.LDS1111:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1112
+	call v4__dscheck
+.LDS1112:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1113
+	call v4__dscheck
+.LDS1113:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,412,.LM5620-main
+.LM5620:
+	mov $3700,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1114
+	call v4__dscheck
+.LDS1114:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1115
+	call v4__dscheck
+.LDS1115:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1116
+	call v4__dscheck
+.LDS1116:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1117
+	call v4__dscheck
+.LDS1117:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,413,.LM5635-main
+.LM5635:
+	mov $3710,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1118
+	call v4__dscheck
+.LDS1118:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1119
+	call v4__dscheck
+.LDS1119:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1120
+	call v4__dscheck
+.LDS1120:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1121
+	call v4__dscheck
+.LDS1121:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,414,.LM5650-main
+.LM5650:
+	mov $3720,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1122
+	call v4__dscheck
+.LDS1122:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1123
+	call v4__dscheck
+.LDS1123:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1124
+	call v4__dscheck
+.LDS1124:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1125
+	call v4__dscheck
+.LDS1125:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,415,.LM5665-main
+.LM5665:
+	mov $3730,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1126
+	call v4__dscheck
+.LDS1126:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1127
+	call v4__dscheck
+.LDS1127:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1128
+	call v4__dscheck
+.LDS1128:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1129
+	call v4__dscheck
+.LDS1129:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,416,.LM5680-main
+.LM5680:
+	mov $3740,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1130
+	call v4__dscheck
+.LDS1130:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1131
+	call v4__dscheck
+.LDS1131:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1132
+	call v4__dscheck
+.LDS1132:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1133
+	call v4__dscheck
+.LDS1133:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,417,.LM5695-main
+.LM5695:
+	mov $3750,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1134
+	call v4__dscheck
+.LDS1134:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1135
+	call v4__dscheck
+.LDS1135:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1136
+	call v4__dscheck
+.LDS1136:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1137
+	call v4__dscheck
+.LDS1137:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,418,.LM5710-main
+.LM5710:
+	mov $3760,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1138
+	call v4__dscheck
+.LDS1138:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1139
+	call v4__dscheck
+.LDS1139:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1140
+	call v4__dscheck
+.LDS1140:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1141
+	call v4__dscheck
+.LDS1141:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,419,.LM5725-main
+.LM5725:
+	mov $3770,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1142
+	call v4__dscheck
+.LDS1142:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1143
+	call v4__dscheck
+.LDS1143:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1144
+	call v4__dscheck
+.LDS1144:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1145
+	call v4__dscheck
+.LDS1145:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,420,.LM5740-main
+.LM5740:
+	mov $3780,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1146
+	call v4__dscheck
+.LDS1146:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1147
+	call v4__dscheck
+.LDS1147:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1148
+	call v4__dscheck
+.LDS1148:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1149
+	call v4__dscheck
+.LDS1149:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,421,.LM5755-main
+.LM5755:
+	mov $3790,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1150
+	call v4__dscheck
+.LDS1150:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1151
+	call v4__dscheck
+.LDS1151:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1152
+	call v4__dscheck
+.LDS1152:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1153
+	call v4__dscheck
+.LDS1153:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,422,.LM5770-main
+.LM5770:
+	mov $3800,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1154
+	call v4__dscheck
+.LDS1154:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1155
+	call v4__dscheck
+.LDS1155:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1156
+	call v4__dscheck
+.LDS1156:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1157
+	call v4__dscheck
+.LDS1157:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,423,.LM5785-main
+.LM5785:
+	mov $3810,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1158
+	call v4__dscheck
+.LDS1158:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1159
+	call v4__dscheck
+.LDS1159:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1160
+	call v4__dscheck
+.LDS1160:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1161
+	call v4__dscheck
+.LDS1161:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,424,.LM5800-main
+.LM5800:
+	mov $3820,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1162
+	call v4__dscheck
+.LDS1162:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1163
+	call v4__dscheck
+.LDS1163:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1164
+	call v4__dscheck
+.LDS1164:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1165
+	call v4__dscheck
+.LDS1165:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,425,.LM5815-main
+.LM5815:
+	mov $3830,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1166
+	call v4__dscheck
+.LDS1166:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1167
+	call v4__dscheck
+.LDS1167:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1168
+	call v4__dscheck
+.LDS1168:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1169
+	call v4__dscheck
+.LDS1169:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,426,.LM5830-main
+.LM5830:
+	mov $3840,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1170
+	call v4__dscheck
+.LDS1170:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1171
+	call v4__dscheck
+.LDS1171:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1172
+	call v4__dscheck
+.LDS1172:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1173
+	call v4__dscheck
+.LDS1173:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,427,.LM5845-main
+.LM5845:
+	mov $3850,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1174
+	call v4__dscheck
+.LDS1174:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1175
+	call v4__dscheck
+.LDS1175:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1176
+	call v4__dscheck
+.LDS1176:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1177
+	call v4__dscheck
+.LDS1177:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,428,.LM5860-main
+.LM5860:
+	mov $3860,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1178
+	call v4__dscheck
+.LDS1178:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1179
+	call v4__dscheck
+.LDS1179:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Greaterd
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1180
+	call v4__dscheck
+.LDS1180:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1181
+	call v4__dscheck
+.LDS1181:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,429,.LM5875-main
+.LM5875:
+	mov $3870,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1182
+	call v4__dscheck
+.LDS1182:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1183
+	call v4__dscheck
+.LDS1183:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1184
+	call v4__dscheck
+.LDS1184:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,430,.LM5891-main
+.LM5891:
+	mov $3880,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1185
+	call v4__dscheck
+.LDS1185:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1186
+	call v4__dscheck
+.LDS1186:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1187
+	call v4__dscheck
+.LDS1187:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1188
+	call v4__dscheck
+.LDS1188:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,431,.LM5908-main
+.LM5908:
+	mov $3890,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1189
+	call v4__dscheck
+.LDS1189:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1190
+	call v4__dscheck
+.LDS1190:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1191
+	call v4__dscheck
+.LDS1191:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1192
+	call v4__dscheck
+.LDS1192:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,432,.LM5925-main
+.LM5925:
+	mov $3900,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1193
+	call v4__dscheck
+.LDS1193:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1194
+	call v4__dscheck
+.LDS1194:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1195
+	call v4__dscheck
+.LDS1195:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1196
+	call v4__dscheck
+.LDS1196:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,433,.LM5942-main
+.LM5942:
+	mov $3910,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1197
+	call v4__dscheck
+.LDS1197:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1198
+	call v4__dscheck
+.LDS1198:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1199
+	call v4__dscheck
+.LDS1199:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1200
+	call v4__dscheck
+.LDS1200:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,434,.LM5959-main
+.LM5959:
+	mov $3920,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1201
+	call v4__dscheck
+.LDS1201:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1202
+	call v4__dscheck
+.LDS1202:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1203
+	call v4__dscheck
+.LDS1203:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1204
+	call v4__dscheck
+.LDS1204:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,435,.LM5976-main
+.LM5976:
+	mov $3930,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1205
+	call v4__dscheck
+.LDS1205:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1206
+	call v4__dscheck
+.LDS1206:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1207
+	call v4__dscheck
+.LDS1207:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1208
+	call v4__dscheck
+.LDS1208:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,436,.LM5993-main
+.LM5993:
+	mov $3940,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1209
+	call v4__dscheck
+.LDS1209:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1210
+	call v4__dscheck
+.LDS1210:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1211
+	call v4__dscheck
+.LDS1211:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1212
+	call v4__dscheck
+.LDS1212:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,437,.LM6010-main
+.LM6010:
+	mov $3950,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1213
+	call v4__dscheck
+.LDS1213:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1214
+	call v4__dscheck
+.LDS1214:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_m_Star
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1215
+	call v4__dscheck
+.LDS1215:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sm_Slashrem
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1216
+	call v4__dscheck
+.LDS1216:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,439,.LM6027-main
+.LM6027:
+	mov $3970,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1217
+	call v4__dscheck
+.LDS1217:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1218
+	call v4__dscheck
+.LDS1218:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1219
+	call v4__dscheck
+.LDS1219:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,440,.LM6043-main
+.LM6043:
+	mov $3980,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1220
+	call v4__dscheck
+.LDS1220:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1221
+	call v4__dscheck
+.LDS1221:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1222
+	call v4__dscheck
+.LDS1222:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,441,.LM6059-main
+.LM6059:
+	mov $3990,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1223
+	call v4__dscheck
+.LDS1223:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1224
+	call v4__dscheck
+.LDS1224:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1225
+	call v4__dscheck
+.LDS1225:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,442,.LM6075-main
+.LM6075:
+	mov $4000,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1226
+	call v4__dscheck
+.LDS1226:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1227
+	call v4__dscheck
+.LDS1227:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1228
+	call v4__dscheck
+.LDS1228:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,443,.LM6091-main
+.LM6091:
+	mov $4010,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1229
+	call v4__dscheck
+.LDS1229:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1230
+	call v4__dscheck
+.LDS1230:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1231
+	call v4__dscheck
+.LDS1231:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1232
+	call v4__dscheck
+.LDS1232:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,444,.LM6108-main
+.LM6108:
+	mov $4020,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1233
+	call v4__dscheck
+.LDS1233:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1234
+	call v4__dscheck
+.LDS1234:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1235
+	call v4__dscheck
+.LDS1235:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1236
+	call v4__dscheck
+.LDS1236:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,445,.LM6125-main
+.LM6125:
+	mov $4030,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1237
+	call v4__dscheck
+.LDS1237:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1238
+	call v4__dscheck
+.LDS1238:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Star
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1239
+	call v4__dscheck
+.LDS1239:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_um_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1240
+	call v4__dscheck
+.LDS1240:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,465,.LM6142-main
+.LM6142:
+	mov $4280,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1241
+	call v4__dscheck
+.LDS1241:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1242
+	call v4__dscheck
+.LDS1242:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6156-main
+.LM6156:
+	cmp $4080,%rcx
+	jbe .LDS1243
+	call v4__dscheck
+.LDS1243:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,465,.LM6160-main
+.LM6160:
+	call v4_Rightbrace
+.stabn 68,0,466,.LM6161-main
+.LM6161:
+	mov $4290,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1244
+	call v4__dscheck
+.LDS1244:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1245
+	call v4__dscheck
+.LDS1245:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6175-main
+.LM6175:
+	cmp $4080,%rcx
+	jbe .LDS1246
+	call v4__dscheck
+.LDS1246:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,466,.LM6179-main
+.LM6179:
+	call v4_Rightbrace
+.stabn 68,0,467,.LM6180-main
+.LM6180:
+	mov $4300,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1247
+	call v4__dscheck
+.LDS1247:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1248
+	call v4__dscheck
+.LDS1248:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6194-main
+.LM6194:
+	cmp $4080,%rcx
+	jbe .LDS1249
+	call v4__dscheck
+.LDS1249:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,467,.LM6198-main
+.LM6198:
+	call v4_Rightbrace
+.stabn 68,0,468,.LM6199-main
+.LM6199:
+	mov $4310,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1250
+	call v4__dscheck
+.LDS1250:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1251
+	call v4__dscheck
+.LDS1251:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6213-main
+.LM6213:
+	cmp $4080,%rcx
+	jbe .LDS1252
+	call v4__dscheck
+.LDS1252:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,468,.LM6217-main
+.LM6217:
+	call v4_Rightbrace
+.stabn 68,0,469,.LM6218-main
+.LM6218:
+	mov $4320,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1253
+	call v4__dscheck
+.LDS1253:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1254
+	call v4__dscheck
+.LDS1254:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6232-main
+.LM6232:
+	cmp $4080,%rcx
+	jbe .LDS1255
+	call v4__dscheck
+.LDS1255:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,469,.LM6236-main
+.LM6236:
+	call v4_Rightbrace
+.stabn 68,0,470,.LM6237-main
+.LM6237:
+	mov $4330,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1256
+	call v4__dscheck
+.LDS1256:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1257
+	call v4__dscheck
+.LDS1257:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6251-main
+.LM6251:
+	cmp $4080,%rcx
+	jbe .LDS1258
+	call v4__dscheck
+.LDS1258:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,470,.LM6255-main
+.LM6255:
+	call v4_Rightbrace
+.stabn 68,0,471,.LM6256-main
+.LM6256:
+	mov $4340,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1259
+	call v4__dscheck
+.LDS1259:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1260
+	call v4__dscheck
+.LDS1260:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6270-main
+.LM6270:
+	cmp $4080,%rcx
+	jbe .LDS1261
+	call v4__dscheck
+.LDS1261:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,471,.LM6274-main
+.LM6274:
+	call v4_Rightbrace
+.stabn 68,0,472,.LM6275-main
+.LM6275:
+	mov $4350,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1262
+	call v4__dscheck
+.LDS1262:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1263
+	call v4__dscheck
+.LDS1263:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6289-main
+.LM6289:
+	cmp $4080,%rcx
+	jbe .LDS1264
+	call v4__dscheck
+.LDS1264:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,472,.LM6293-main
+.LM6293:
+	call v4_Rightbrace
+.stabn 68,0,473,.LM6294-main
+.LM6294:
+	mov $4360,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1265
+	call v4__dscheck
+.LDS1265:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1266
+	call v4__dscheck
+.LDS1266:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6308-main
+.LM6308:
+	cmp $4080,%rcx
+	jbe .LDS1267
+	call v4__dscheck
+.LDS1267:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,473,.LM6312-main
+.LM6312:
+	call v4_Rightbrace
+.stabn 68,0,474,.LM6313-main
+.LM6313:
+	mov $4370,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1268
+	call v4__dscheck
+.LDS1268:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1269
+	call v4__dscheck
+.LDS1269:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6327-main
+.LM6327:
+	cmp $4080,%rcx
+	jbe .LDS1270
+	call v4__dscheck
+.LDS1270:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,474,.LM6331-main
+.LM6331:
+	call v4_Rightbrace
+.stabn 68,0,475,.LM6332-main
+.LM6332:
+	mov $4380,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1271
+	call v4__dscheck
+.LDS1271:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1272
+	call v4__dscheck
+.LDS1272:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6346-main
+.LM6346:
+	cmp $4080,%rcx
+	jbe .LDS1273
+	call v4__dscheck
+.LDS1273:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,475,.LM6350-main
+.LM6350:
+	call v4_Rightbrace
+.stabn 68,0,476,.LM6351-main
+.LM6351:
+	mov $4390,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1274
+	call v4__dscheck
+.LDS1274:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1275
+	call v4__dscheck
+.LDS1275:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6365-main
+.LM6365:
+	cmp $4080,%rcx
+	jbe .LDS1276
+	call v4__dscheck
+.LDS1276:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,476,.LM6369-main
+.LM6369:
+	call v4_Rightbrace
+.stabn 68,0,477,.LM6370-main
+.LM6370:
+	mov $4400,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1277
+	call v4__dscheck
+.LDS1277:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1278
+	call v4__dscheck
+.LDS1278:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6384-main
+.LM6384:
+	cmp $4080,%rcx
+	jbe .LDS1279
+	call v4__dscheck
+.LDS1279:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,477,.LM6388-main
+.LM6388:
+	call v4_Rightbrace
+.stabn 68,0,478,.LM6389-main
+.LM6389:
+	mov $4410,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1280
+	call v4__dscheck
+.LDS1280:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1281
+	call v4__dscheck
+.LDS1281:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6403-main
+.LM6403:
+	cmp $4080,%rcx
+	jbe .LDS1282
+	call v4__dscheck
+.LDS1282:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,478,.LM6407-main
+.LM6407:
+	call v4_Rightbrace
+.stabn 68,0,479,.LM6408-main
+.LM6408:
+	mov $4420,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1283
+	call v4__dscheck
+.LDS1283:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1284
+	call v4__dscheck
+.LDS1284:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6422-main
+.LM6422:
+	cmp $4080,%rcx
+	jbe .LDS1285
+	call v4__dscheck
+.LDS1285:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,479,.LM6426-main
+.LM6426:
+	call v4_Rightbrace
+.stabn 68,0,480,.LM6427-main
+.LM6427:
+	mov $4430,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1286
+	call v4__dscheck
+.LDS1286:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1287
+	call v4__dscheck
+.LDS1287:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6441-main
+.LM6441:
+	cmp $4080,%rcx
+	jbe .LDS1288
+	call v4__dscheck
+.LDS1288:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,480,.LM6445-main
+.LM6445:
+	call v4_Rightbrace
+.stabn 68,0,481,.LM6446-main
+.LM6446:
+	mov $4440,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1289
+	call v4__dscheck
+.LDS1289:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1290
+	call v4__dscheck
+.LDS1290:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6460-main
+.LM6460:
+	cmp $4080,%rcx
+	jbe .LDS1291
+	call v4__dscheck
+.LDS1291:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,481,.LM6464-main
+.LM6464:
+	call v4_Rightbrace
+.stabn 68,0,482,.LM6465-main
+.LM6465:
+	mov $4450,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1292
+	call v4__dscheck
+.LDS1292:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1293
+	call v4__dscheck
+.LDS1293:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6479-main
+.LM6479:
+	cmp $4080,%rcx
+	jbe .LDS1294
+	call v4__dscheck
+.LDS1294:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,482,.LM6483-main
+.LM6483:
+	call v4_Rightbrace
+.stabn 68,0,483,.LM6484-main
+.LM6484:
+	mov $4460,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1295
+	call v4__dscheck
+.LDS1295:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1296
+	call v4__dscheck
+.LDS1296:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6498-main
+.LM6498:
+	cmp $4080,%rcx
+	jbe .LDS1297
+	call v4__dscheck
+.LDS1297:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,483,.LM6502-main
+.LM6502:
+	call v4_Rightbrace
+.stabn 68,0,484,.LM6503-main
+.LM6503:
+	mov $4470,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1298
+	call v4__dscheck
+.LDS1298:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1299
+	call v4__dscheck
+.LDS1299:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6517-main
+.LM6517:
+	cmp $4080,%rcx
+	jbe .LDS1300
+	call v4__dscheck
+.LDS1300:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,484,.LM6521-main
+.LM6521:
+	call v4_Rightbrace
+.stabn 68,0,485,.LM6522-main
+.LM6522:
+	mov $4480,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1301
+	call v4__dscheck
+.LDS1301:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1302
+	call v4__dscheck
+.LDS1302:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slashmod
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6536-main
+.LM6536:
+	cmp $4080,%rcx
+	jbe .LDS1303
+	call v4__dscheck
+.LDS1303:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,485,.LM6540-main
+.LM6540:
+	call v4_Rightbrace
+.stabn 68,0,487,.LM6541-main
+.LM6541:
+	mov $4500,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1304
+	call v4__dscheck
+.LDS1304:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1305
+	call v4__dscheck
+.LDS1305:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6559-main
+.LM6559:
+	cmp $4080,%rcx
+	jbe .LDS1306
+	call v4__dscheck
+.LDS1306:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6563-main
+.LM6563:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,487,.LM6565-main
+.LM6565:
+	call v4_Rightbrace
+.stabn 68,0,488,.LM6566-main
+.LM6566:
+	mov $4510,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1307
+	call v4__dscheck
+.LDS1307:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1308
+	call v4__dscheck
+.LDS1308:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6584-main
+.LM6584:
+	cmp $4080,%rcx
+	jbe .LDS1309
+	call v4__dscheck
+.LDS1309:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6588-main
+.LM6588:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,488,.LM6590-main
+.LM6590:
+	call v4_Rightbrace
+.stabn 68,0,489,.LM6591-main
+.LM6591:
+	mov $4520,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1310
+	call v4__dscheck
+.LDS1310:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1311
+	call v4__dscheck
+.LDS1311:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6609-main
+.LM6609:
+	cmp $4080,%rcx
+	jbe .LDS1312
+	call v4__dscheck
+.LDS1312:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6613-main
+.LM6613:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,489,.LM6615-main
+.LM6615:
+	call v4_Rightbrace
+.stabn 68,0,490,.LM6616-main
+.LM6616:
+	mov $4530,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1313
+	call v4__dscheck
+.LDS1313:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1314
+	call v4__dscheck
+.LDS1314:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6634-main
+.LM6634:
+	cmp $4080,%rcx
+	jbe .LDS1315
+	call v4__dscheck
+.LDS1315:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6638-main
+.LM6638:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,490,.LM6640-main
+.LM6640:
+	call v4_Rightbrace
+.stabn 68,0,491,.LM6641-main
+.LM6641:
+	mov $4540,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1316
+	call v4__dscheck
+.LDS1316:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1317
+	call v4__dscheck
+.LDS1317:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6659-main
+.LM6659:
+	cmp $4080,%rcx
+	jbe .LDS1318
+	call v4__dscheck
+.LDS1318:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6663-main
+.LM6663:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,491,.LM6665-main
+.LM6665:
+	call v4_Rightbrace
+.stabn 68,0,492,.LM6666-main
+.LM6666:
+	mov $4550,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1319
+	call v4__dscheck
+.LDS1319:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1320
+	call v4__dscheck
+.LDS1320:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6681-main
+.LM6681:
+	cmp $4080,%rcx
+	jbe .LDS1321
+	call v4__dscheck
+.LDS1321:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6685-main
+.LM6685:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,492,.LM6687-main
+.LM6687:
+	call v4_Rightbrace
+.stabn 68,0,493,.LM6688-main
+.LM6688:
+	mov $4560,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1322
+	call v4__dscheck
+.LDS1322:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1323
+	call v4__dscheck
+.LDS1323:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6703-main
+.LM6703:
+	cmp $4080,%rcx
+	jbe .LDS1324
+	call v4__dscheck
+.LDS1324:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6707-main
+.LM6707:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,493,.LM6709-main
+.LM6709:
+	call v4_Rightbrace
+.stabn 68,0,494,.LM6710-main
+.LM6710:
+	mov $4570,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1325
+	call v4__dscheck
+.LDS1325:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1326
+	call v4__dscheck
+.LDS1326:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slash
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6725-main
+.LM6725:
+	cmp $4080,%rcx
+	jbe .LDS1327
+	call v4__dscheck
+.LDS1327:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6729-main
+.LM6729:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,494,.LM6731-main
+.LM6731:
+	call v4_Rightbrace
+.stabn 68,0,495,.LM6732-main
+.LM6732:
+	mov $4580,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1328
+	call v4__dscheck
+.LDS1328:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1329
+	call v4__dscheck
+.LDS1329:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6747-main
+.LM6747:
+	cmp $4080,%rcx
+	jbe .LDS1330
+	call v4__dscheck
+.LDS1330:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6751-main
+.LM6751:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,495,.LM6753-main
+.LM6753:
+	call v4_Rightbrace
+.stabn 68,0,496,.LM6754-main
+.LM6754:
+	mov $4590,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1331
+	call v4__dscheck
+.LDS1331:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1332
+	call v4__dscheck
+.LDS1332:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slash
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6769-main
+.LM6769:
+	cmp $4080,%rcx
+	jbe .LDS1333
+	call v4__dscheck
+.LDS1333:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6773-main
+.LM6773:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,496,.LM6775-main
+.LM6775:
+	call v4_Rightbrace
+.stabn 68,0,497,.LM6776-main
+.LM6776:
+	mov $4600,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1334
+	call v4__dscheck
+.LDS1334:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $63,%rdx
+	add %rdx,%rax
+	sar $1,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1335
+	call v4__dscheck
+.LDS1335:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6794-main
+.LM6794:
+	cmp $4080,%rcx
+	jbe .LDS1336
+	call v4__dscheck
+.LDS1336:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6798-main
+.LM6798:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,497,.LM6800-main
+.LM6800:
+	call v4_Rightbrace
+.stabn 68,0,498,.LM6801-main
+.LM6801:
+	mov $4610,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1337
+	call v4__dscheck
+.LDS1337:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1338
+	call v4__dscheck
+.LDS1338:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6816-main
+.LM6816:
+	cmp $4080,%rcx
+	jbe .LDS1339
+	call v4__dscheck
+.LDS1339:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6820-main
+.LM6820:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,498,.LM6822-main
+.LM6822:
+	call v4_Rightbrace
+.stabn 68,0,499,.LM6823-main
+.LM6823:
+	mov $4620,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1340
+	call v4__dscheck
+.LDS1340:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $63,%rdx
+	add %rdx,%rax
+	sar $1,%rax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1341
+	call v4__dscheck
+.LDS1341:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6841-main
+.LM6841:
+	cmp $4080,%rcx
+	jbe .LDS1342
+	call v4__dscheck
+.LDS1342:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6845-main
+.LM6845:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,499,.LM6847-main
+.LM6847:
+	call v4_Rightbrace
+.stabn 68,0,500,.LM6848-main
+.LM6848:
+	mov $4630,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1343
+	call v4__dscheck
+.LDS1343:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1344
+	call v4__dscheck
+.LDS1344:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6866-main
+.LM6866:
+	cmp $4080,%rcx
+	jbe .LDS1345
+	call v4__dscheck
+.LDS1345:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6870-main
+.LM6870:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,500,.LM6872-main
+.LM6872:
+	call v4_Rightbrace
+.stabn 68,0,501,.LM6873-main
+.LM6873:
+	mov $4640,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1346
+	call v4__dscheck
+.LDS1346:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1347
+	call v4__dscheck
+.LDS1347:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6891-main
+.LM6891:
+	cmp $4080,%rcx
+	jbe .LDS1348
+	call v4__dscheck
+.LDS1348:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6895-main
+.LM6895:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,501,.LM6897-main
+.LM6897:
+	call v4_Rightbrace
+.stabn 68,0,502,.LM6898-main
+.LM6898:
+	mov $4650,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1349
+	call v4__dscheck
+.LDS1349:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1350
+	call v4__dscheck
+.LDS1350:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6916-main
+.LM6916:
+	cmp $4080,%rcx
+	jbe .LDS1351
+	call v4__dscheck
+.LDS1351:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6920-main
+.LM6920:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,502,.LM6922-main
+.LM6922:
+	call v4_Rightbrace
+.stabn 68,0,503,.LM6923-main
+.LM6923:
+	mov $4660,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1352
+	call v4__dscheck
+.LDS1352:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1353
+	call v4__dscheck
+.LDS1353:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6941-main
+.LM6941:
+	cmp $4080,%rcx
+	jbe .LDS1354
+	call v4__dscheck
+.LDS1354:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6945-main
+.LM6945:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,503,.LM6947-main
+.LM6947:
+	call v4_Rightbrace
+.stabn 68,0,504,.LM6948-main
+.LM6948:
+	mov $4670,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1355
+	call v4__dscheck
+.LDS1355:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1356
+	call v4__dscheck
+.LDS1356:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6966-main
+.LM6966:
+	cmp $4080,%rcx
+	jbe .LDS1357
+	call v4__dscheck
+.LDS1357:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6970-main
+.LM6970:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,504,.LM6972-main
+.LM6972:
+	call v4_Rightbrace
+.stabn 68,0,505,.LM6973-main
+.LM6973:
+	mov $4680,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1358
+	call v4__dscheck
+.LDS1358:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1359
+	call v4__dscheck
+.LDS1359:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM6991-main
+.LM6991:
+	cmp $4080,%rcx
+	jbe .LDS1360
+	call v4__dscheck
+.LDS1360:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM6995-main
+.LM6995:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,505,.LM6997-main
+.LM6997:
+	call v4_Rightbrace
+.stabn 68,0,506,.LM6998-main
+.LM6998:
+	mov $4690,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1361
+	call v4__dscheck
+.LDS1361:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1362
+	call v4__dscheck
+.LDS1362:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slash
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7013-main
+.LM7013:
+	cmp $4080,%rcx
+	jbe .LDS1363
+	call v4__dscheck
+.LDS1363:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM7017-main
+.LM7017:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,506,.LM7019-main
+.LM7019:
+	call v4_Rightbrace
+.stabn 68,0,507,.LM7020-main
+.LM7020:
+	mov $4700,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1364
+	call v4__dscheck
+.LDS1364:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1365
+	call v4__dscheck
+.LDS1365:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slash
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7035-main
+.LM7035:
+	cmp $4080,%rcx
+	jbe .LDS1366
+	call v4__dscheck
+.LDS1366:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,460,.LM7039-main
+.LM7039:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,507,.LM7041-main
+.LM7041:
+	call v4_Rightbrace
+.stabn 68,0,509,.LM7042-main
+.LM7042:
+	mov $4720,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1367
+	call v4__dscheck
+.LDS1367:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1368
+	call v4__dscheck
+.LDS1368:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7060-main
+.LM7060:
+	cmp $4080,%rcx
+	jbe .LDS1369
+	call v4__dscheck
+.LDS1369:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7064-main
+.LM7064:
+	call v4_drop
+.stabn 68,0,509,.LM7065-main
+.LM7065:
+	call v4_Rightbrace
+.stabn 68,0,510,.LM7066-main
+.LM7066:
+	mov $4730,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1370
+	call v4__dscheck
+.LDS1370:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1371
+	call v4__dscheck
+.LDS1371:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7084-main
+.LM7084:
+	cmp $4080,%rcx
+	jbe .LDS1372
+	call v4__dscheck
+.LDS1372:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7088-main
+.LM7088:
+	call v4_drop
+.stabn 68,0,510,.LM7089-main
+.LM7089:
+	call v4_Rightbrace
+.stabn 68,0,511,.LM7090-main
+.LM7090:
+	mov $4740,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1373
+	call v4__dscheck
+.LDS1373:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1374
+	call v4__dscheck
+.LDS1374:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7108-main
+.LM7108:
+	cmp $4080,%rcx
+	jbe .LDS1375
+	call v4__dscheck
+.LDS1375:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7112-main
+.LM7112:
+	call v4_drop
+.stabn 68,0,511,.LM7113-main
+.LM7113:
+	call v4_Rightbrace
+.stabn 68,0,512,.LM7114-main
+.LM7114:
+	mov $4750,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1376
+	call v4__dscheck
+.LDS1376:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1377
+	call v4__dscheck
+.LDS1377:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7132-main
+.LM7132:
+	cmp $4080,%rcx
+	jbe .LDS1378
+	call v4__dscheck
+.LDS1378:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7136-main
+.LM7136:
+	call v4_drop
+.stabn 68,0,512,.LM7137-main
+.LM7137:
+	call v4_Rightbrace
+.stabn 68,0,513,.LM7138-main
+.LM7138:
+	mov $4760,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1379
+	call v4__dscheck
+.LDS1379:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1380
+	call v4__dscheck
+.LDS1380:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7156-main
+.LM7156:
+	cmp $4080,%rcx
+	jbe .LDS1381
+	call v4__dscheck
+.LDS1381:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7160-main
+.LM7160:
+	call v4_drop
+.stabn 68,0,513,.LM7161-main
+.LM7161:
+	call v4_Rightbrace
+.stabn 68,0,514,.LM7162-main
+.LM7162:
+	mov $4770,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1382
+	call v4__dscheck
+.LDS1382:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1383
+	call v4__dscheck
+.LDS1383:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7177-main
+.LM7177:
+	cmp $4080,%rcx
+	jbe .LDS1384
+	call v4__dscheck
+.LDS1384:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7181-main
+.LM7181:
+	call v4_drop
+.stabn 68,0,514,.LM7182-main
+.LM7182:
+	call v4_Rightbrace
+.stabn 68,0,515,.LM7183-main
+.LM7183:
+	mov $4780,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1385
+	call v4__dscheck
+.LDS1385:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1386
+	call v4__dscheck
+.LDS1386:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7198-main
+.LM7198:
+	cmp $4080,%rcx
+	jbe .LDS1387
+	call v4__dscheck
+.LDS1387:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7202-main
+.LM7202:
+	call v4_drop
+.stabn 68,0,515,.LM7203-main
+.LM7203:
+	call v4_Rightbrace
+.stabn 68,0,516,.LM7204-main
+.LM7204:
+	mov $4790,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1388
+	call v4__dscheck
+.LDS1388:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1389
+	call v4__dscheck
+.LDS1389:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mod
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7219-main
+.LM7219:
+	cmp $4080,%rcx
+	jbe .LDS1390
+	call v4__dscheck
+.LDS1390:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7223-main
+.LM7223:
+	call v4_drop
+.stabn 68,0,516,.LM7224-main
+.LM7224:
+	call v4_Rightbrace
+.stabn 68,0,517,.LM7225-main
+.LM7225:
+	mov $4800,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1391
+	call v4__dscheck
+.LDS1391:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1392
+	call v4__dscheck
+.LDS1392:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7240-main
+.LM7240:
+	cmp $4080,%rcx
+	jbe .LDS1393
+	call v4__dscheck
+.LDS1393:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7244-main
+.LM7244:
+	call v4_drop
+.stabn 68,0,517,.LM7245-main
+.LM7245:
+	call v4_Rightbrace
+.stabn 68,0,518,.LM7246-main
+.LM7246:
+	mov $4810,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1394
+	call v4__dscheck
+.LDS1394:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1395
+	call v4__dscheck
+.LDS1395:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7261-main
+.LM7261:
+	cmp $4080,%rcx
+	jbe .LDS1396
+	call v4__dscheck
+.LDS1396:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7265-main
+.LM7265:
+	call v4_drop
+.stabn 68,0,518,.LM7266-main
+.LM7266:
+	call v4_Rightbrace
+.stabn 68,0,519,.LM7267-main
+.LM7267:
+	mov $4820,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1397
+	call v4__dscheck
+.LDS1397:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $63,%rdx
+	add %rdx,%rax
+	and $1,%rax
+	sub %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1398
+	call v4__dscheck
+.LDS1398:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7285-main
+.LM7285:
+	cmp $4080,%rcx
+	jbe .LDS1399
+	call v4__dscheck
+.LDS1399:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7289-main
+.LM7289:
+	call v4_drop
+.stabn 68,0,519,.LM7290-main
+.LM7290:
+	call v4_Rightbrace
+.stabn 68,0,520,.LM7291-main
+.LM7291:
+	mov $4830,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1400
+	call v4__dscheck
+.LDS1400:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1401
+	call v4__dscheck
+.LDS1401:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7306-main
+.LM7306:
+	cmp $4080,%rcx
+	jbe .LDS1402
+	call v4__dscheck
+.LDS1402:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7310-main
+.LM7310:
+	call v4_drop
+.stabn 68,0,520,.LM7311-main
+.LM7311:
+	call v4_Rightbrace
+.stabn 68,0,521,.LM7312-main
+.LM7312:
+	mov $4840,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1403
+	call v4__dscheck
+.LDS1403:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $63,%rdx
+	add %rdx,%rax
+	and $1,%rax
+	sub %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1404
+	call v4__dscheck
+.LDS1404:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7330-main
+.LM7330:
+	cmp $4080,%rcx
+	jbe .LDS1405
+	call v4__dscheck
+.LDS1405:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7334-main
+.LM7334:
+	call v4_drop
+.stabn 68,0,521,.LM7335-main
+.LM7335:
+	call v4_Rightbrace
+.stabn 68,0,522,.LM7336-main
+.LM7336:
+	mov $4850,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1406
+	call v4__dscheck
+.LDS1406:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1407
+	call v4__dscheck
+.LDS1407:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7354-main
+.LM7354:
+	cmp $4080,%rcx
+	jbe .LDS1408
+	call v4__dscheck
+.LDS1408:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7358-main
+.LM7358:
+	call v4_drop
+.stabn 68,0,522,.LM7359-main
+.LM7359:
+	call v4_Rightbrace
+.stabn 68,0,523,.LM7360-main
+.LM7360:
+	mov $4860,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1409
+	call v4__dscheck
+.LDS1409:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1410
+	call v4__dscheck
+.LDS1410:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7378-main
+.LM7378:
+	cmp $4080,%rcx
+	jbe .LDS1411
+	call v4__dscheck
+.LDS1411:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7382-main
+.LM7382:
+	call v4_drop
+.stabn 68,0,523,.LM7383-main
+.LM7383:
+	call v4_Rightbrace
+.stabn 68,0,524,.LM7384-main
+.LM7384:
+	mov $4870,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1412
+	call v4__dscheck
+.LDS1412:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1413
+	call v4__dscheck
+.LDS1413:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7402-main
+.LM7402:
+	cmp $4080,%rcx
+	jbe .LDS1414
+	call v4__dscheck
+.LDS1414:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7406-main
+.LM7406:
+	call v4_drop
+.stabn 68,0,524,.LM7407-main
+.LM7407:
+	call v4_Rightbrace
+.stabn 68,0,525,.LM7408-main
+.LM7408:
+	mov $4880,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1415
+	call v4__dscheck
+.LDS1415:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1416
+	call v4__dscheck
+.LDS1416:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7426-main
+.LM7426:
+	cmp $4080,%rcx
+	jbe .LDS1417
+	call v4__dscheck
+.LDS1417:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7430-main
+.LM7430:
+	call v4_drop
+.stabn 68,0,525,.LM7431-main
+.LM7431:
+	call v4_Rightbrace
+.stabn 68,0,526,.LM7432-main
+.LM7432:
+	mov $4890,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1418
+	call v4__dscheck
+.LDS1418:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1419
+	call v4__dscheck
+.LDS1419:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7450-main
+.LM7450:
+	cmp $4080,%rcx
+	jbe .LDS1420
+	call v4__dscheck
+.LDS1420:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7454-main
+.LM7454:
+	call v4_drop
+.stabn 68,0,526,.LM7455-main
+.LM7455:
+	call v4_Rightbrace
+.stabn 68,0,527,.LM7456-main
+.LM7456:
+	mov $4900,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1421
+	call v4__dscheck
+.LDS1421:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1422
+	call v4__dscheck
+.LDS1422:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7474-main
+.LM7474:
+	cmp $4080,%rcx
+	jbe .LDS1423
+	call v4__dscheck
+.LDS1423:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7478-main
+.LM7478:
+	call v4_drop
+.stabn 68,0,527,.LM7479-main
+.LM7479:
+	call v4_Rightbrace
+.stabn 68,0,528,.LM7480-main
+.LM7480:
+	mov $4910,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1424
+	call v4__dscheck
+.LDS1424:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1425
+	call v4__dscheck
+.LDS1425:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mod
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7495-main
+.LM7495:
+	cmp $4080,%rcx
+	jbe .LDS1426
+	call v4__dscheck
+.LDS1426:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7499-main
+.LM7499:
+	call v4_drop
+.stabn 68,0,528,.LM7500-main
+.LM7500:
+	call v4_Rightbrace
+.stabn 68,0,529,.LM7501-main
+.LM7501:
+	mov $4920,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1427
+	call v4__dscheck
+.LDS1427:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1428
+	call v4__dscheck
+.LDS1428:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mod
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,459,.LM7516-main
+.LM7516:
+	cmp $4080,%rcx
+	jbe .LDS1429
+	call v4__dscheck
+.LDS1429:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_s_Greaterd
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,461,.LM7520-main
+.LM7520:
+	call v4_drop
+.stabn 68,0,529,.LM7521-main
+.LM7521:
+	call v4_Rightbrace
+.stabn 68,0,531,.LM7522-main
+.LM7522:
+	mov $4940,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1430
+	call v4__dscheck
+.LDS1430:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1431
+	call v4__dscheck
+.LDS1431:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7541-main
+.LM7541:
+	cmp $4080,%rcx
+	jbe .LDS1432
+	call v4__dscheck
+.LDS1432:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7545-main
+.LM7545:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,531,.LM7547-main
+.LM7547:
+	call v4_Rightbrace
+.stabn 68,0,532,.LM7548-main
+.LM7548:
+	mov $4950,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1433
+	call v4__dscheck
+.LDS1433:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1434
+	call v4__dscheck
+.LDS1434:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7567-main
+.LM7567:
+	cmp $4080,%rcx
+	jbe .LDS1435
+	call v4__dscheck
+.LDS1435:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7571-main
+.LM7571:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,532,.LM7573-main
+.LM7573:
+	call v4_Rightbrace
+.stabn 68,0,533,.LM7574-main
+.LM7574:
+	mov $4960,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1436
+	call v4__dscheck
+.LDS1436:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1437
+	call v4__dscheck
+.LDS1437:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7593-main
+.LM7593:
+	cmp $4080,%rcx
+	jbe .LDS1438
+	call v4__dscheck
+.LDS1438:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7597-main
+.LM7597:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,533,.LM7599-main
+.LM7599:
+	call v4_Rightbrace
+.stabn 68,0,534,.LM7600-main
+.LM7600:
+	mov $4970,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1439
+	call v4__dscheck
+.LDS1439:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1440
+	call v4__dscheck
+.LDS1440:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7619-main
+.LM7619:
+	cmp $4080,%rcx
+	jbe .LDS1441
+	call v4__dscheck
+.LDS1441:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7623-main
+.LM7623:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,534,.LM7625-main
+.LM7625:
+	call v4_Rightbrace
+.stabn 68,0,535,.LM7626-main
+.LM7626:
+	mov $4980,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1442
+	call v4__dscheck
+.LDS1442:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1443
+	call v4__dscheck
+.LDS1443:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7645-main
+.LM7645:
+	cmp $4080,%rcx
+	jbe .LDS1444
+	call v4__dscheck
+.LDS1444:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7649-main
+.LM7649:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,535,.LM7651-main
+.LM7651:
+	call v4_Rightbrace
+.stabn 68,0,536,.LM7652-main
+.LM7652:
+	mov $4990,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1445
+	call v4__dscheck
+.LDS1445:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1446
+	call v4__dscheck
+.LDS1446:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7671-main
+.LM7671:
+	cmp $4080,%rcx
+	jbe .LDS1447
+	call v4__dscheck
+.LDS1447:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7675-main
+.LM7675:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,536,.LM7677-main
+.LM7677:
+	call v4_Rightbrace
+.stabn 68,0,537,.LM7678-main
+.LM7678:
+	mov $5000,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1448
+	call v4__dscheck
+.LDS1448:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1449
+	call v4__dscheck
+.LDS1449:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7697-main
+.LM7697:
+	cmp $4080,%rcx
+	jbe .LDS1450
+	call v4__dscheck
+.LDS1450:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7701-main
+.LM7701:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,537,.LM7703-main
+.LM7703:
+	call v4_Rightbrace
+.stabn 68,0,538,.LM7704-main
+.LM7704:
+	mov $5010,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1451
+	call v4__dscheck
+.LDS1451:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1452
+	call v4__dscheck
+.LDS1452:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7723-main
+.LM7723:
+	cmp $4080,%rcx
+	jbe .LDS1453
+	call v4__dscheck
+.LDS1453:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7727-main
+.LM7727:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,538,.LM7729-main
+.LM7729:
+	call v4_Rightbrace
+.stabn 68,0,539,.LM7730-main
+.LM7730:
+	mov $5020,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1454
+	call v4__dscheck
+.LDS1454:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1455
+	call v4__dscheck
+.LDS1455:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7749-main
+.LM7749:
+	cmp $4080,%rcx
+	jbe .LDS1456
+	call v4__dscheck
+.LDS1456:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7753-main
+.LM7753:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,539,.LM7755-main
+.LM7755:
+	call v4_Rightbrace
+.stabn 68,0,540,.LM7756-main
+.LM7756:
+	mov $5030,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1457
+	call v4__dscheck
+.LDS1457:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1458
+	call v4__dscheck
+.LDS1458:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7775-main
+.LM7775:
+	cmp $4080,%rcx
+	jbe .LDS1459
+	call v4__dscheck
+.LDS1459:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7779-main
+.LM7779:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,540,.LM7781-main
+.LM7781:
+	call v4_Rightbrace
+.stabn 68,0,541,.LM7782-main
+.LM7782:
+	mov $5040,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1460
+	call v4__dscheck
+.LDS1460:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1461
+	call v4__dscheck
+.LDS1461:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7801-main
+.LM7801:
+	cmp $4080,%rcx
+	jbe .LDS1462
+	call v4__dscheck
+.LDS1462:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7805-main
+.LM7805:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,541,.LM7807-main
+.LM7807:
+	call v4_Rightbrace
+.stabn 68,0,542,.LM7808-main
+.LM7808:
+	mov $5050,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1463
+	call v4__dscheck
+.LDS1463:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1464
+	call v4__dscheck
+.LDS1464:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7827-main
+.LM7827:
+	cmp $4080,%rcx
+	jbe .LDS1465
+	call v4__dscheck
+.LDS1465:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7831-main
+.LM7831:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,542,.LM7833-main
+.LM7833:
+	call v4_Rightbrace
+.stabn 68,0,543,.LM7834-main
+.LM7834:
+	mov $5060,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1466
+	call v4__dscheck
+.LDS1466:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1467
+	call v4__dscheck
+.LDS1467:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7853-main
+.LM7853:
+	cmp $4080,%rcx
+	jbe .LDS1468
+	call v4__dscheck
+.LDS1468:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7857-main
+.LM7857:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,543,.LM7859-main
+.LM7859:
+	call v4_Rightbrace
+.stabn 68,0,544,.LM7860-main
+.LM7860:
+	mov $5070,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1469
+	call v4__dscheck
+.LDS1469:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1470
+	call v4__dscheck
+.LDS1470:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7879-main
+.LM7879:
+	cmp $4080,%rcx
+	jbe .LDS1471
+	call v4__dscheck
+.LDS1471:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7883-main
+.LM7883:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,544,.LM7885-main
+.LM7885:
+	call v4_Rightbrace
+.stabn 68,0,545,.LM7886-main
+.LM7886:
+	mov $5080,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1472
+	call v4__dscheck
+.LDS1472:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1473
+	call v4__dscheck
+.LDS1473:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7905-main
+.LM7905:
+	cmp $4080,%rcx
+	jbe .LDS1474
+	call v4__dscheck
+.LDS1474:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7909-main
+.LM7909:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,545,.LM7911-main
+.LM7911:
+	call v4_Rightbrace
+.stabn 68,0,546,.LM7912-main
+.LM7912:
+	mov $5090,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1475
+	call v4__dscheck
+.LDS1475:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1476
+	call v4__dscheck
+.LDS1476:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7931-main
+.LM7931:
+	cmp $4080,%rcx
+	jbe .LDS1477
+	call v4__dscheck
+.LDS1477:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7935-main
+.LM7935:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,546,.LM7937-main
+.LM7937:
+	call v4_Rightbrace
+.stabn 68,0,547,.LM7938-main
+.LM7938:
+	mov $5100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1478
+	call v4__dscheck
+.LDS1478:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1479
+	call v4__dscheck
+.LDS1479:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7957-main
+.LM7957:
+	cmp $4080,%rcx
+	jbe .LDS1480
+	call v4__dscheck
+.LDS1480:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7961-main
+.LM7961:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,547,.LM7963-main
+.LM7963:
+	call v4_Rightbrace
+.stabn 68,0,548,.LM7964-main
+.LM7964:
+	mov $5110,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1481
+	call v4__dscheck
+.LDS1481:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1482
+	call v4__dscheck
+.LDS1482:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM7983-main
+.LM7983:
+	cmp $4080,%rcx
+	jbe .LDS1483
+	call v4__dscheck
+.LDS1483:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM7987-main
+.LM7987:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,548,.LM7989-main
+.LM7989:
+	call v4_Rightbrace
+.stabn 68,0,549,.LM7990-main
+.LM7990:
+	mov $5120,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1484
+	call v4__dscheck
+.LDS1484:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1485
+	call v4__dscheck
+.LDS1485:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slash
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8009-main
+.LM8009:
+	cmp $4080,%rcx
+	jbe .LDS1486
+	call v4__dscheck
+.LDS1486:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,463,.LM8013-main
+.LM8013:
+	call v4_swap
+	call v4_drop
+.stabn 68,0,549,.LM8015-main
+.LM8015:
+	call v4_Rightbrace
+.stabn 68,0,551,.LM8016-main
+.LM8016:
+	mov $5140,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1487
+	call v4__dscheck
+.LDS1487:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1488
+	call v4__dscheck
+.LDS1488:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8034-main
+.LM8034:
+	cmp $4080,%rcx
+	jbe .LDS1489
+	call v4__dscheck
+.LDS1489:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,551,.LM8038-main
+.LM8038:
+	call v4_Rightbrace
+.stabn 68,0,552,.LM8039-main
+.LM8039:
+	mov $5150,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1490
+	call v4__dscheck
+.LDS1490:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1491
+	call v4__dscheck
+.LDS1491:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8057-main
+.LM8057:
+	cmp $4080,%rcx
+	jbe .LDS1492
+	call v4__dscheck
+.LDS1492:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,552,.LM8061-main
+.LM8061:
+	call v4_Rightbrace
+.stabn 68,0,553,.LM8062-main
+.LM8062:
+	mov $5160,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1493
+	call v4__dscheck
+.LDS1493:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1494
+	call v4__dscheck
+.LDS1494:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8080-main
+.LM8080:
+	cmp $4080,%rcx
+	jbe .LDS1495
+	call v4__dscheck
+.LDS1495:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,553,.LM8084-main
+.LM8084:
+	call v4_Rightbrace
+.stabn 68,0,554,.LM8085-main
+.LM8085:
+	mov $5170,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1496
+	call v4__dscheck
+.LDS1496:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1497
+	call v4__dscheck
+.LDS1497:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8103-main
+.LM8103:
+	cmp $4080,%rcx
+	jbe .LDS1498
+	call v4__dscheck
+.LDS1498:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,554,.LM8107-main
+.LM8107:
+	call v4_Rightbrace
+.stabn 68,0,555,.LM8108-main
+.LM8108:
+	mov $5180,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1499
+	call v4__dscheck
+.LDS1499:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1500
+	call v4__dscheck
+.LDS1500:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8126-main
+.LM8126:
+	cmp $4080,%rcx
+	jbe .LDS1501
+	call v4__dscheck
+.LDS1501:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,555,.LM8130-main
+.LM8130:
+	call v4_Rightbrace
+.stabn 68,0,556,.LM8131-main
+.LM8131:
+	mov $5190,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1502
+	call v4__dscheck
+.LDS1502:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1503
+	call v4__dscheck
+.LDS1503:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8149-main
+.LM8149:
+	cmp $4080,%rcx
+	jbe .LDS1504
+	call v4__dscheck
+.LDS1504:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,556,.LM8153-main
+.LM8153:
+	call v4_Rightbrace
+.stabn 68,0,557,.LM8154-main
+.LM8154:
+	mov $5200,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1505
+	call v4__dscheck
+.LDS1505:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1506
+	call v4__dscheck
+.LDS1506:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8172-main
+.LM8172:
+	cmp $4080,%rcx
+	jbe .LDS1507
+	call v4__dscheck
+.LDS1507:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,557,.LM8176-main
+.LM8176:
+	call v4_Rightbrace
+.stabn 68,0,558,.LM8177-main
+.LM8177:
+	mov $5210,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1508
+	call v4__dscheck
+.LDS1508:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1509
+	call v4__dscheck
+.LDS1509:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8195-main
+.LM8195:
+	cmp $4080,%rcx
+	jbe .LDS1510
+	call v4__dscheck
+.LDS1510:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,558,.LM8199-main
+.LM8199:
+	call v4_Rightbrace
+.stabn 68,0,559,.LM8200-main
+.LM8200:
+	mov $5220,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1511
+	call v4__dscheck
+.LDS1511:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1512
+	call v4__dscheck
+.LDS1512:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8218-main
+.LM8218:
+	cmp $4080,%rcx
+	jbe .LDS1513
+	call v4__dscheck
+.LDS1513:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,559,.LM8222-main
+.LM8222:
+	call v4_Rightbrace
+.stabn 68,0,560,.LM8223-main
+.LM8223:
+	mov $5230,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1514
+	call v4__dscheck
+.LDS1514:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1515
+	call v4__dscheck
+.LDS1515:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8241-main
+.LM8241:
+	cmp $4080,%rcx
+	jbe .LDS1516
+	call v4__dscheck
+.LDS1516:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,560,.LM8245-main
+.LM8245:
+	call v4_Rightbrace
+.stabn 68,0,561,.LM8246-main
+.LM8246:
+	mov $5240,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1517
+	call v4__dscheck
+.LDS1517:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1518
+	call v4__dscheck
+.LDS1518:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8264-main
+.LM8264:
+	cmp $4080,%rcx
+	jbe .LDS1519
+	call v4__dscheck
+.LDS1519:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,561,.LM8268-main
+.LM8268:
+	call v4_Rightbrace
+.stabn 68,0,562,.LM8269-main
+.LM8269:
+	mov $5250,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1520
+	call v4__dscheck
+.LDS1520:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1521
+	call v4__dscheck
+.LDS1521:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8287-main
+.LM8287:
+	cmp $4080,%rcx
+	jbe .LDS1522
+	call v4__dscheck
+.LDS1522:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,562,.LM8291-main
+.LM8291:
+	call v4_Rightbrace
+.stabn 68,0,563,.LM8292-main
+.LM8292:
+	mov $5260,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1523
+	call v4__dscheck
+.LDS1523:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1524
+	call v4__dscheck
+.LDS1524:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8310-main
+.LM8310:
+	cmp $4080,%rcx
+	jbe .LDS1525
+	call v4__dscheck
+.LDS1525:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,563,.LM8314-main
+.LM8314:
+	call v4_Rightbrace
+.stabn 68,0,564,.LM8315-main
+.LM8315:
+	mov $5270,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1526
+	call v4__dscheck
+.LDS1526:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1527
+	call v4__dscheck
+.LDS1527:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8333-main
+.LM8333:
+	cmp $4080,%rcx
+	jbe .LDS1528
+	call v4__dscheck
+.LDS1528:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,564,.LM8337-main
+.LM8337:
+	call v4_Rightbrace
+.stabn 68,0,565,.LM8338-main
+.LM8338:
+	mov $5280,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1529
+	call v4__dscheck
+.LDS1529:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1530
+	call v4__dscheck
+.LDS1530:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8356-main
+.LM8356:
+	cmp $4080,%rcx
+	jbe .LDS1531
+	call v4__dscheck
+.LDS1531:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,565,.LM8360-main
+.LM8360:
+	call v4_Rightbrace
+.stabn 68,0,566,.LM8361-main
+.LM8361:
+	mov $5290,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1532
+	call v4__dscheck
+.LDS1532:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1533
+	call v4__dscheck
+.LDS1533:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8379-main
+.LM8379:
+	cmp $4080,%rcx
+	jbe .LDS1534
+	call v4__dscheck
+.LDS1534:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,566,.LM8383-main
+.LM8383:
+	call v4_Rightbrace
+.stabn 68,0,567,.LM8384-main
+.LM8384:
+	mov $5300,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1535
+	call v4__dscheck
+.LDS1535:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1536
+	call v4__dscheck
+.LDS1536:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8402-main
+.LM8402:
+	cmp $4080,%rcx
+	jbe .LDS1537
+	call v4__dscheck
+.LDS1537:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,567,.LM8406-main
+.LM8406:
+	call v4_Rightbrace
+.stabn 68,0,568,.LM8407-main
+.LM8407:
+	mov $5310,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1538
+	call v4__dscheck
+.LDS1538:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1539
+	call v4__dscheck
+.LDS1539:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8425-main
+.LM8425:
+	cmp $4080,%rcx
+	jbe .LDS1540
+	call v4__dscheck
+.LDS1540:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,568,.LM8429-main
+.LM8429:
+	call v4_Rightbrace
+.stabn 68,0,569,.LM8430-main
+.LM8430:
+	mov $5320,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1541
+	call v4__dscheck
+.LDS1541:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1542
+	call v4__dscheck
+.LDS1542:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Star_Slashmod
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,462,.LM8448-main
+.LM8448:
+	cmp $4080,%rcx
+	jbe .LDS1543
+	call v4__dscheck
+.LDS1543:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaterr
+	call v4_m_Star
+	call v4_r_Greater
+	call v4_sm_Slashrem
+.stabn 68,0,569,.LM8452-main
+.LM8452:
+	call v4_Rightbrace
+.stabn 68,0,572,.LM8453-main
+.LM8453:
+	lea .LC10(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $74,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1544
+	call v4__dscheck
+.LDS1544:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,583,.LM8459-main
+.LM8459:
+	lea v4_hbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__here(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1545
+	call v4__dscheck
+.LDS1545:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Store
+.stabn 68,0,585,.LM8464-main
+.LM8464:
+	call v4_here
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1546
+	call v4__dscheck
+.LDS1546:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Comma
+.stabn 68,0,586,.LM8468-main
+.LM8468:
+	call v4_here
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1547
+	call v4__dscheck
+.LDS1547:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Comma
+.stabn 68,0,587,.LM8472-main
+.LM8472:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,v4_z2nd(%rip)
+.stabn 68,0,588,.LM8474-main
+.LM8474:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,v4_z1st(%rip)
+.stabn 68,0,589,.LM8476-main
+.LM8476:
+	mov $5490,%rax
+	cmp $4080,%rcx
+	jbe .LDS1548
+	call v4__dscheck
+.LDS1548:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1549
+	call v4__dscheck
+.LDS1549:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	mov %rax,%r8
+	mov v4_z2nd(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1550
+	call v4__dscheck
+.LDS1550:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1551
+	call v4__dscheck
+.LDS1551:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,590,.LM8492-main
+.LM8492:
+	mov $5500,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1552
+	call v4__dscheck
+.LDS1552:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	add $8,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1553
+	call v4__dscheck
+.LDS1553:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_z2nd(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1554
+	call v4__dscheck
+.LDS1554:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,591,.LM8505-main
+.LM8505:
+	mov $5510,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1555
+	call v4__dscheck
+.LDS1555:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	mov %rax,%r8
+	mov $8,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1556
+	call v4__dscheck
+.LDS1556:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_z2nd(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1557
+	call v4__dscheck
+.LDS1557:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,592,.LM8522-main
+.LM8522:
+	mov $5520,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1558
+	call v4__dscheck
+.LDS1558:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1559
+	call v4__dscheck
+.LDS1559:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Fetch
+	mov v4_z2nd(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1560
+	call v4__dscheck
+.LDS1560:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Fetch
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1561
+	call v4__dscheck
+.LDS1561:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,593,.LM8537-main
+.LM8537:
+	mov $5530,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1562
+	call v4__dscheck
+.LDS1562:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov v4_z1st(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1563
+	call v4__dscheck
+.LDS1563:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,594,.LM8547-main
+.LM8547:
+	mov $5540,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1564
+	call v4__dscheck
+.LDS1564:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1565
+	call v4__dscheck
+.LDS1565:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Fetch
+	mov v4_z2nd(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1566
+	call v4__dscheck
+.LDS1566:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Fetch
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1567
+	call v4__dscheck
+.LDS1567:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,595,.LM8562-main
+.LM8562:
+	mov $5550,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1568
+	call v4__dscheck
+.LDS1568:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov v4_z2nd(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1569
+	call v4__dscheck
+.LDS1569:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,596,.LM8572-main
+.LM8572:
+	mov $5560,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1570
+	call v4__dscheck
+.LDS1570:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1571
+	call v4__dscheck
+.LDS1571:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Fetch
+	mov v4_z2nd(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1572
+	call v4__dscheck
+.LDS1572:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Fetch
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $6,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1573
+	call v4__dscheck
+.LDS1573:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,597,.LM8587-main
+.LM8587:
+	mov $5570,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1574
+	call v4__dscheck
+.LDS1574:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1575
+	call v4__dscheck
+.LDS1575:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2_Fetch
+	call v4_Minus_Greater
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $5,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1576
+	call v4__dscheck
+.LDS1576:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,598,.LM8599-main
+.LM8599:
+	mov $5580,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1577
+	call v4__dscheck
+.LDS1577:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov v4_z1st(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1578
+	call v4__dscheck
+.LDS1578:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,599,.LM8611-main
+.LM8611:
+	mov $5590,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1579
+	call v4__dscheck
+.LDS1579:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1580
+	call v4__dscheck
+.LDS1580:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2_Fetch
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1581
+	call v4__dscheck
+.LDS1581:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,601,.LM8623-main
+.LM8623:
+	call v4_here
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1582
+	call v4__dscheck
+.LDS1582:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Comma
+.stabn 68,0,602,.LM8627-main
+.LM8627:
+	call v4_here
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1583
+	call v4__dscheck
+.LDS1583:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Comma
+.stabn 68,0,603,.LM8631-main
+.LM8631:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,v4_z2ndc(%rip)
+.stabn 68,0,604,.LM8633-main
+.LM8633:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,v4_z1stc(%rip)
+.stabn 68,0,605,.LM8635-main
+.LM8635:
+	mov $5650,%rax
+	cmp $4080,%rcx
+	jbe .LDS1584
+	call v4__dscheck
+.LDS1584:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1585
+	call v4__dscheck
+.LDS1585:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1stc(%rip),%rax
+	mov %rax,%r8
+	mov v4_z2ndc(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setb %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1586
+	call v4__dscheck
+.LDS1586:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1587
+	call v4__dscheck
+.LDS1587:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,606,.LM8651-main
+.LM8651:
+	mov $5660,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1588
+	call v4__dscheck
+.LDS1588:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1stc(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1589
+	call v4__dscheck
+.LDS1589:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_Minus_Greater
+	mov v4_z2ndc(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1590
+	call v4__dscheck
+.LDS1590:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,607,.LM8661-main
+.LM8661:
+	mov $5670,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1591
+	call v4__dscheck
+.LDS1591:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1stc(%rip),%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1592
+	call v4__dscheck
+.LDS1592:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_z2ndc(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1593
+	call v4__dscheck
+.LDS1593:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,608,.LM8678-main
+.LM8678:
+	mov $5680,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1594
+	call v4__dscheck
+.LDS1594:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1stc(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1595
+	call v4__dscheck
+.LDS1595:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	mov v4_z2ndc(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1596
+	call v4__dscheck
+.LDS1596:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1597
+	call v4__dscheck
+.LDS1597:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,609,.LM8693-main
+.LM8693:
+	mov $5690,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1598
+	call v4__dscheck
+.LDS1598:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov v4_z1stc(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1599
+	call v4__dscheck
+.LDS1599:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,610,.LM8703-main
+.LM8703:
+	mov $5700,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1600
+	call v4__dscheck
+.LDS1600:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1stc(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1601
+	call v4__dscheck
+.LDS1601:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	mov v4_z2ndc(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1602
+	call v4__dscheck
+.LDS1602:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1603
+	call v4__dscheck
+.LDS1603:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,611,.LM8718-main
+.LM8718:
+	mov $5710,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1604
+	call v4__dscheck
+.LDS1604:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov v4_z2ndc(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1605
+	call v4__dscheck
+.LDS1605:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,612,.LM8728-main
+.LM8728:
+	mov $5720,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1606
+	call v4__dscheck
+.LDS1606:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1stc(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1607
+	call v4__dscheck
+.LDS1607:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	mov v4_z2ndc(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1608
+	call v4__dscheck
+.LDS1608:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1609
+	call v4__dscheck
+.LDS1609:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,614,.LM8743-main
+.LM8743:
+	call v4_align
+.stabn 68,0,615,.LM8744-main
+.LM8744:
+	call v4_here
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1610
+	call v4__dscheck
+.LDS1610:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Comma
+	call v4_align
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1611
+	call v4__dscheck
+.LDS1611:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Comma
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,v4_x(%rip)
+.stabn 68,0,617,.LM8754-main
+.LM8754:
+	mov $5750,%rax
+	cmp $4080,%rcx
+	jbe .LDS1612
+	call v4__dscheck
+.LDS1612:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1613
+	call v4__dscheck
+.LDS1613:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_x(%rip),%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1614
+	call v4__dscheck
+.LDS1614:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_aligned
+	call v4_Fetch
+	call v4_Minus_Greater
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1615
+	call v4__dscheck
+.LDS1615:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,620,.LM8769-main
+.LM8769:
+	mov $5780,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1616
+	call v4__dscheck
+.LDS1616:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $8,%rax
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1617
+	call v4__dscheck
+.LDS1617:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1618
+	call v4__dscheck
+.LDS1618:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,622,.LM8786-main
+.LM8786:
+	mov $5800,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1619
+	call v4__dscheck
+.LDS1619:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov v4_z1st(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1620
+	call v4__dscheck
+.LDS1620:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,623,.LM8796-main
+.LM8796:
+	mov $5810,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1621
+	call v4__dscheck
+.LDS1621:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov v4_z1st(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1622
+	call v4__dscheck
+.LDS1622:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Plus_Store
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,624,.LM8806-main
+.LM8806:
+	mov $5820,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1623
+	call v4__dscheck
+.LDS1623:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_z1st(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1624
+	call v4__dscheck
+.LDS1624:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Fetch
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1625
+	call v4__dscheck
+.LDS1625:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,625,.LM8816-main
+.LM8816:
+	mov $5830,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1626
+	call v4__dscheck
+.LDS1626:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov v4_z1st(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1627
+	call v4__dscheck
+.LDS1627:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Plus_Store
+	mov v4_z1st(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1628
+	call v4__dscheck
+.LDS1628:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Fetch
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1629
+	call v4__dscheck
+.LDS1629:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,628,.LM8831-main
+.LM8831:
+	lea .LC11(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $35,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1630
+	call v4__dscheck
+.LDS1630:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,630,.LM8837-main
+.LM8837:
+	mov $5880,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1631
+	call v4__dscheck
+.LDS1631:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_bl
+	call v4_Minus_Greater
+	mov $32,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1632
+	call v4__dscheck
+.LDS1632:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,631,.LM8845-main
+.LM8845:
+	mov $5890,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1633
+	call v4__dscheck
+.LDS1633:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $88,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1634
+	call v4__dscheck
+.LDS1634:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $88,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1635
+	call v4__dscheck
+.LDS1635:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,632,.LM8854-main
+.LM8854:
+	mov $5900,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1636
+	call v4__dscheck
+.LDS1636:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $72,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1637
+	call v4__dscheck
+.LDS1637:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $72,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1638
+	call v4__dscheck
+.LDS1638:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,633,.LM8863-main
+.LM8863:
+	mov $5910,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1639
+	call v4__dscheck
+.LDS1639:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,634,.LM8868-main
+.LM8868:
+	mov $5920,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1640
+	call v4__dscheck
+.LDS1640:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,635,.LM8873-main
+.LM8873:
+	mov $5930,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1641
+	call v4__dscheck
+.LDS1641:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,633,.LM8877-main
+.LM8877:
+	mov $88,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,635,.LM8879-main
+.LM8879:
+	cmp $4080,%rcx
+	jbe .LDS1642
+	call v4__dscheck
+.LDS1642:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $88,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1643
+	call v4__dscheck
+.LDS1643:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,636,.LM8883-main
+.LM8883:
+	mov $5940,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1644
+	call v4__dscheck
+.LDS1644:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,634,.LM8887-main
+.LM8887:
+	mov $72,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,636,.LM8889-main
+.LM8889:
+	cmp $4080,%rcx
+	jbe .LDS1645
+	call v4__dscheck
+.LDS1645:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $72,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1646
+	call v4__dscheck
+.LDS1646:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,637,.LM8893-main
+.LM8893:
+	mov $5950,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1647
+	call v4__dscheck
+.LDS1647:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,638,.LM8898-main
+.LM8898:
+	mov $5960,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1648
+	call v4__dscheck
+.LDS1648:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,637,.LM8902-main
+.LM8902:
+	call v4_Leftbracket
+.stabn 68,0,633,.LM8904-main
+.LM8904:
+	mov $88,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,637,.LM8906-main
+.LM8906:
+	cmp $4080,%rcx
+	jbe .LDS1649
+	call v4__dscheck
+.LDS1649:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,638,.LM8908-main
+.LM8908:
+	call v4_Minus_Greater
+	mov $88,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1650
+	call v4__dscheck
+.LDS1650:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,639,.LM8912-main
+.LM8912:
+	mov $5970,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1651
+	call v4__dscheck
+.LDS1651:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,640,.LM8917-main
+.LM8917:
+	mov $5980,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1652
+	call v4__dscheck
+.LDS1652:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,639,.LM8921-main
+.LM8921:
+	lea .LC12(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,640,.LM8925-main
+.LM8925:
+	cmp $4080,%rcx
+	jbe .LDS1653
+	call v4__dscheck
+.LDS1653:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	call v4_drop
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1654
+	call v4__dscheck
+.LDS1654:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,641,.LM8931-main
+.LM8931:
+	mov $5990,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1655
+	call v4__dscheck
+.LDS1655:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,639,.LM8935-main
+.LM8935:
+	lea .LC12(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,641,.LM8939-main
+.LM8939:
+	cmp $4080,%rcx
+	jbe .LDS1656
+	call v4__dscheck
+.LDS1656:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	call v4_dup
+	call v4_c_Fetch
+	call v4_swap
+	call v4_char_Plus
+	call v4_c_Fetch
+	call v4_Minus_Greater
+	mov $88,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $89,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1657
+	call v4__dscheck
+.LDS1657:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,644,.LM8951-main
+.LM8951:
+	lea .LC13(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $65,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1658
+	call v4__dscheck
+.LDS1658:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,646,.LM8957-main
+.LM8957:
+	mov $6040,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1659
+	call v4__dscheck
+.LDS1659:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,647,.LM8962-main
+.LM8962:
+	mov $6050,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1660
+	call v4__dscheck
+.LDS1660:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_gt1(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1661
+	call v4__dscheck
+.LDS1661:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Minus_Greater
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1662
+	call v4__dscheck
+.LDS1662:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,648,.LM8972-main
+.LM8972:
+	mov $6060,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1663
+	call v4__dscheck
+.LDS1663:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_immediate
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,649,.LM8978-main
+.LM8978:
+	mov $6070,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1664
+	call v4__dscheck
+.LDS1664:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,648,.LM8982-main
+.LM8982:
+	lea v4_gt1(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,649,.LM8984-main
+.LM8984:
+	cmp $4080,%rcx
+	jbe .LDS1665
+	call v4__dscheck
+.LDS1665:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Minus_Greater
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1666
+	call v4__dscheck
+.LDS1666:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,666,.LM8989-main
+.LM8989:
+	mov $6240,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1667
+	call v4__dscheck
+.LDS1667:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_immediate
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,667,.LM8995-main
+.LM8995:
+	mov $6250,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1668
+	call v4__dscheck
+.LDS1668:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,666,.LM8999-main
+.LM8999:
+	call v4_state
+	call v4_Fetch
+.stabn 68,0,667,.LM9001-main
+.LM9001:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1669
+	call v4__dscheck
+.LDS1669:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,668,.LM9005-main
+.LM9005:
+	mov $6260,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1670
+	call v4__dscheck
+.LDS1670:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,669,.LM9010-main
+.LM9010:
+	mov $6270,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1671
+	call v4__dscheck
+.LDS1671:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,668,.LM9014-main
+.LM9014:
+	lea v4_gt8(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1672
+	call v4__dscheck
+.LDS1672:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_literal
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	test %rax,%rax
+	sete %al
+	movzbl %al,%eax
+	neg %rax
+	cmp $4080,%rcx
+	jbe .LDS1673
+	call v4__dscheck
+.LDS1673:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1674
+	call v4__dscheck
+.LDS1674:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1675
+	call v4__dscheck
+.LDS1675:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,672,.LM9025-main
+.LM9025:
+	lea .LC14(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $53,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1676
+	call v4__dscheck
+.LDS1676:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,674,.LM9031-main
+.LM9031:
+	mov $6320,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1677
+	call v4__dscheck
+.LDS1677:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,675,.LM9036-main
+.LM9036:
+	mov $6330,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1678
+	call v4__dscheck
+.LDS1678:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,676,.LM9041-main
+.LM9041:
+	mov $6340,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1679
+	call v4__dscheck
+.LDS1679:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	je .L123
+	mov $123,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1680
+	call v4__dscheck
+.LDS1680:
+.L123:
+.stabn 68,0,676,.LM9052-main
+.LM9052:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,677,.LM9054-main
+.LM9054:
+	mov $6350,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1681
+	call v4__dscheck
+.LDS1681:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	je .L124
+	mov $123,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1682
+	call v4__dscheck
+.LDS1682:
+.L124:
+.stabn 68,0,677,.LM9065-main
+.LM9065:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1683
+	call v4__dscheck
+.LDS1683:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,678,.LM9069-main
+.LM9069:
+	mov $6360,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1684
+	call v4__dscheck
+.LDS1684:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	je .L125
+	mov $123,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1685
+	call v4__dscheck
+.LDS1685:
+.L125:
+.stabn 68,0,678,.LM9080-main
+.LM9080:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1686
+	call v4__dscheck
+.LDS1686:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,679,.LM9084-main
+.LM9084:
+	mov $6370,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1687
+	call v4__dscheck
+.LDS1687:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	je .L126
+	mov $123,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1688
+	call v4__dscheck
+.LDS1688:
+	jmp .L127
+.L126:
+	mov $234,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1689
+	call v4__dscheck
+.LDS1689:
+.L127:
+.stabn 68,0,679,.LM9099-main
+.LM9099:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $234,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1690
+	call v4__dscheck
+.LDS1690:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,680,.LM9103-main
+.LM9103:
+	mov $6380,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1691
+	call v4__dscheck
+.LDS1691:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	je .L128
+	mov $123,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1692
+	call v4__dscheck
+.LDS1692:
+	jmp .L129
+.L128:
+	mov $234,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1693
+	call v4__dscheck
+.LDS1693:
+.L129:
+.stabn 68,0,680,.LM9118-main
+.LM9118:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1694
+	call v4__dscheck
+.LDS1694:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,681,.LM9122-main
+.LM9122:
+	mov $6390,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1695
+	call v4__dscheck
+.LDS1695:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	je .L130
+	mov $123,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1696
+	call v4__dscheck
+.LDS1696:
+.L130:
+.stabn 68,0,681,.LM9133-main
+.LM9133:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1697
+	call v4__dscheck
+.LDS1697:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,683,.LM9137-main
+.LM9137:
+	mov $6410,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1698
+	call v4__dscheck
+.LDS1698:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,684,.LM9142-main
+.LM9142:
+	mov $6420,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1699
+	call v4__dscheck
+.LDS1699:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1700
+	call v4__dscheck
+.LDS1700:
+.L131:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS1701
+	call v4__dscheck
+.LDS1701:
+	cmp %rdx,%rax
+	jge .L132
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS1702
+	call v4__dscheck
+.LDS1702:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1703
+	call v4__dscheck
+.LDS1703:
+	jmp .L131
+.L132:
+.stabn 68,0,684,.LM9165-main
+.LM9165:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $5,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1704
+	call v4__dscheck
+.LDS1704:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,685,.LM9179-main
+.LM9179:
+	mov $6430,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1705
+	call v4__dscheck
+.LDS1705:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1706
+	call v4__dscheck
+.LDS1706:
+.L133:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS1707
+	call v4__dscheck
+.LDS1707:
+	cmp %rdx,%rax
+	jge .L134
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS1708
+	call v4__dscheck
+.LDS1708:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1709
+	call v4__dscheck
+.LDS1709:
+	jmp .L133
+.L134:
+.stabn 68,0,685,.LM9202-main
+.LM9202:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $5,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1710
+	call v4__dscheck
+.LDS1710:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,686,.LM9208-main
+.LM9208:
+	mov $6440,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1711
+	call v4__dscheck
+.LDS1711:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1712
+	call v4__dscheck
+.LDS1712:
+.L135:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS1713
+	call v4__dscheck
+.LDS1713:
+	cmp %rdx,%rax
+	jge .L136
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS1714
+	call v4__dscheck
+.LDS1714:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1715
+	call v4__dscheck
+.LDS1715:
+	jmp .L135
+.L136:
+.stabn 68,0,686,.LM9231-main
+.LM9231:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1716
+	call v4__dscheck
+.LDS1716:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,687,.LM9235-main
+.LM9235:
+	mov $6450,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1717
+	call v4__dscheck
+.LDS1717:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1718
+	call v4__dscheck
+.LDS1718:
+.L137:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS1719
+	call v4__dscheck
+.LDS1719:
+	cmp %rdx,%rax
+	jge .L138
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS1720
+	call v4__dscheck
+.LDS1720:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1721
+	call v4__dscheck
+.LDS1721:
+	jmp .L137
+.L138:
+.stabn 68,0,687,.LM9258-main
+.LM9258:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1722
+	call v4__dscheck
+.LDS1722:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,689,.LM9262-main
+.LM9262:
+	mov $6470,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1723
+	call v4__dscheck
+.LDS1723:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,690,.LM9267-main
+.LM9267:
+	mov $6480,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1724
+	call v4__dscheck
+.LDS1724:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1725
+	call v4__dscheck
+.LDS1725:
+.L139:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS1726
+	call v4__dscheck
+.LDS1726:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1727
+	call v4__dscheck
+.LDS1727:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS1728
+	call v4__dscheck
+.LDS1728:
+	cmp %rdx,%rax
+	jle .L139
+.stabn 68,0,690,.LM9288-main
+.LM9288:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $5,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $6,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1729
+	call v4__dscheck
+.LDS1729:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,691,.LM9298-main
+.LM9298:
+	mov $6490,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1730
+	call v4__dscheck
+.LDS1730:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1731
+	call v4__dscheck
+.LDS1731:
+.L140:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS1732
+	call v4__dscheck
+.LDS1732:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1733
+	call v4__dscheck
+.LDS1733:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS1734
+	call v4__dscheck
+.LDS1734:
+	cmp %rdx,%rax
+	jle .L140
+.stabn 68,0,691,.LM9319-main
+.LM9319:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $6,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1735
+	call v4__dscheck
+.LDS1735:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,692,.LM9325-main
+.LM9325:
+	mov $6500,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1736
+	call v4__dscheck
+.LDS1736:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1737
+	call v4__dscheck
+.LDS1737:
+.L141:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS1738
+	call v4__dscheck
+.LDS1738:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1739
+	call v4__dscheck
+.LDS1739:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $5,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS1740
+	call v4__dscheck
+.LDS1740:
+	cmp %rdx,%rax
+	jle .L141
+.stabn 68,0,692,.LM9346-main
+.LM9346:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $7,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1741
+	call v4__dscheck
+.LDS1741:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,694,.LM9352-main
+.LM9352:
+	mov $6520,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1742
+	call v4__dscheck
+.LDS1742:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,695,.LM9357-main
+.LM9357:
+	mov $6530,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1743
+	call v4__dscheck
+.LDS1743:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1744
+	call v4__dscheck
+.LDS1744:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gi5
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1745
+	call v4__dscheck
+.LDS1745:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,696,.LM9367-main
+.LM9367:
+	mov $6540,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1746
+	call v4__dscheck
+.LDS1746:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1747
+	call v4__dscheck
+.LDS1747:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1748
+	call v4__dscheck
+.LDS1748:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,697,.LM9377-main
+.LM9377:
+	mov $6550,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1749
+	call v4__dscheck
+.LDS1749:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1750
+	call v4__dscheck
+.LDS1750:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $5,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1751
+	call v4__dscheck
+.LDS1751:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,698,.LM9391-main
+.LM9391:
+	mov $6560,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1752
+	call v4__dscheck
+.LDS1752:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1753
+	call v4__dscheck
+.LDS1753:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $5,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1754
+	call v4__dscheck
+.LDS1754:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,699,.LM9403-main
+.LM9403:
+	mov $6570,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1755
+	call v4__dscheck
+.LDS1755:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1756
+	call v4__dscheck
+.LDS1756:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gi5
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1757
+	call v4__dscheck
+.LDS1757:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,701,.LM9413-main
+.LM9413:
+	mov $6600,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1758
+	call v4__dscheck
+.LDS1758:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,702,.LM9418-main
+.LM9418:
+	mov $6610,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1759
+	call v4__dscheck
+.LDS1759:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1760
+	call v4__dscheck
+.LDS1760:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1761
+	call v4__dscheck
+.LDS1761:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,703,.LM9428-main
+.LM9428:
+	mov $6620,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1762
+	call v4__dscheck
+.LDS1762:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1763
+	call v4__dscheck
+.LDS1763:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1764
+	call v4__dscheck
+.LDS1764:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,704,.LM9440-main
+.LM9440:
+	mov $6630,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1765
+	call v4__dscheck
+.LDS1765:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1766
+	call v4__dscheck
+.LDS1766:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1767
+	call v4__dscheck
+.LDS1767:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,705,.LM9454-main
+.LM9454:
+	mov $6640,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1768
+	call v4__dscheck
+.LDS1768:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1769
+	call v4__dscheck
+.LDS1769:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1770
+	call v4__dscheck
+.LDS1770:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,706,.LM9470-main
+.LM9470:
+	mov $6650,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1771
+	call v4__dscheck
+.LDS1771:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1772
+	call v4__dscheck
+.LDS1772:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gi6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1773
+	call v4__dscheck
+.LDS1773:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,709,.LM9488-main
+.LM9488:
+	lea .LC15(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $43,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1774
+	call v4__dscheck
+.LDS1774:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,711,.LM9494-main
+.LM9494:
+	mov $6700,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1775
+	call v4__dscheck
+.LDS1775:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,712,.LM9499-main
+.LM9499:
+	mov $6710,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1776
+	call v4__dscheck
+.LDS1776:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1777
+	call v4__dscheck
+.LDS1777:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1778
+	call v4__dscheck
+.LDS1778:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,713,.LM9515-main
+.LM9515:
+	mov $6720,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1779
+	call v4__dscheck
+.LDS1779:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1780
+	call v4__dscheck
+.LDS1780:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1781
+	call v4__dscheck
+.LDS1781:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,714,.LM9531-main
+.LM9531:
+	mov $6730,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1782
+	call v4__dscheck
+.LDS1782:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1783
+	call v4__dscheck
+.LDS1783:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd1
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1784
+	call v4__dscheck
+.LDS1784:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,716,.LM9543-main
+.LM9543:
+	mov $6750,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1785
+	call v4__dscheck
+.LDS1785:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,717,.LM9548-main
+.LM9548:
+	mov $6760,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1786
+	call v4__dscheck
+.LDS1786:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1787
+	call v4__dscheck
+.LDS1787:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd2
+	call v4_Minus_Greater
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1788
+	call v4__dscheck
+.LDS1788:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,718,.LM9566-main
+.LM9566:
+	mov $6770,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1789
+	call v4__dscheck
+.LDS1789:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1790
+	call v4__dscheck
+.LDS1790:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd2
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1791
+	call v4__dscheck
+.LDS1791:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,719,.LM9584-main
+.LM9584:
+	mov $6780,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1792
+	call v4__dscheck
+.LDS1792:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1793
+	call v4__dscheck
+.LDS1793:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd2
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1794
+	call v4__dscheck
+.LDS1794:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,721,.LM9598-main
+.LM9598:
+	mov $6800,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1795
+	call v4__dscheck
+.LDS1795:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,722,.LM9603-main
+.LM9603:
+	mov $6810,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1796
+	call v4__dscheck
+.LDS1796:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1797
+	call v4__dscheck
+.LDS1797:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd3
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1798
+	call v4__dscheck
+.LDS1798:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,723,.LM9619-main
+.LM9619:
+	mov $6820,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1799
+	call v4__dscheck
+.LDS1799:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1800
+	call v4__dscheck
+.LDS1800:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd3
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1801
+	call v4__dscheck
+.LDS1801:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,724,.LM9635-main
+.LM9635:
+	mov $6830,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1802
+	call v4__dscheck
+.LDS1802:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1803
+	call v4__dscheck
+.LDS1803:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd3
+	call v4_Minus_Greater
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1804
+	call v4__dscheck
+.LDS1804:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,726,.LM9647-main
+.LM9647:
+	mov $6850,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1805
+	call v4__dscheck
+.LDS1805:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,727,.LM9652-main
+.LM9652:
+	mov $6860,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1806
+	call v4__dscheck
+.LDS1806:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1807
+	call v4__dscheck
+.LDS1807:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd4
+	call v4_Minus_Greater
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1808
+	call v4__dscheck
+.LDS1808:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,728,.LM9670-main
+.LM9670:
+	mov $6870,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1809
+	call v4__dscheck
+.LDS1809:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1810
+	call v4__dscheck
+.LDS1810:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd4
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1811
+	call v4__dscheck
+.LDS1811:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,729,.LM9688-main
+.LM9688:
+	mov $6880,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1812
+	call v4__dscheck
+.LDS1812:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $-9223372036854775808,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1813
+	call v4__dscheck
+.LDS1813:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd4
+	call v4_Minus_Greater
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	movabs $9223372036854775807,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1814
+	call v4__dscheck
+.LDS1814:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,731,.LM9702-main
+.LM9702:
+	mov $6900,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1815
+	call v4__dscheck
+.LDS1815:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,732,.LM9707-main
+.LM9707:
+	mov $6910,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1816
+	call v4__dscheck
+.LDS1816:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1817
+	call v4__dscheck
+.LDS1817:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd5
+	call v4_Minus_Greater
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1818
+	call v4__dscheck
+.LDS1818:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,733,.LM9717-main
+.LM9717:
+	mov $6920,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1819
+	call v4__dscheck
+.LDS1819:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1820
+	call v4__dscheck
+.LDS1820:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd5
+	call v4_Minus_Greater
+	mov $123,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1821
+	call v4__dscheck
+.LDS1821:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,734,.LM9727-main
+.LM9727:
+	mov $6930,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1822
+	call v4__dscheck
+.LDS1822:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1823
+	call v4__dscheck
+.LDS1823:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd5
+	call v4_Minus_Greater
+	mov $234,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1824
+	call v4__dscheck
+.LDS1824:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,736,.LM9737-main
+.LM9737:
+	mov $6950,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1825
+	call v4__dscheck
+.LDS1825:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,739,.LM9740-main
+.LM9740:
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,740,.LM9742-main
+.LM9742:
+	mov $6990,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1826
+	call v4__dscheck
+.LDS1826:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1827
+	call v4__dscheck
+.LDS1827:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1828
+	call v4__dscheck
+.LDS1828:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,741,.LM9752-main
+.LM9752:
+	mov $7000,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1829
+	call v4__dscheck
+.LDS1829:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1830
+	call v4__dscheck
+.LDS1830:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd6
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1831
+	call v4__dscheck
+.LDS1831:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,742,.LM9762-main
+.LM9762:
+	mov $7010,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1832
+	call v4__dscheck
+.LDS1832:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1833
+	call v4__dscheck
+.LDS1833:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gd6
+	call v4_Minus_Greater
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1834
+	call v4__dscheck
+.LDS1834:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,824,.LM9776-main
+.LM9776:
+	lea .LC16(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $53,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1835
+	call v4__dscheck
+.LDS1835:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,840,.LM9782-main
+.LM9782:
+	mov $7990,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1836
+	call v4__dscheck
+.LDS1836:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_gp1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1837
+	call v4__dscheck
+.LDS1837:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,843,.LM9790-main
+.LM9790:
+	mov $8020,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1838
+	call v4__dscheck
+.LDS1838:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_gp2
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1839
+	call v4__dscheck
+.LDS1839:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,846,.LM9798-main
+.LM9798:
+	mov $8050,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1840
+	call v4__dscheck
+.LDS1840:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_gp3
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1841
+	call v4__dscheck
+.LDS1841:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,849,.LM9806-main
+.LM9806:
+	mov $8080,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1842
+	call v4__dscheck
+.LDS1842:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,848,.LM9810-main
+.LM9810:
+	call v4_Less_Hash
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1843
+	call v4__dscheck
+.LDS1843:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Hashs
+	call v4_Hash_Greater
+	lea .LC20(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1844
+	call v4__dscheck
+.LDS1844:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_s_Equals
+.stabn 68,0,849,.LM9822-main
+.LM9822:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1845
+	call v4__dscheck
+.LDS1845:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,851,.LM9826-main
+.LM9826:
+	mov $36,%rax
+	mov %rax,v4_max_Minusbase(%rip)
+.stabn 68,0,854,.LM9830-main
+.LM9830:
+	call v4_count_Minusbits
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rax,%rax
+	mov %rax,v4_Hashbits_Minusud(%rip)
+.stabn 68,0,863,.LM9837-main
+.LM9837:
+	mov $8220,%rax
+	cmp $4080,%rcx
+	jbe .LDS1846
+	call v4__dscheck
+.LDS1846:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1847
+	call v4__dscheck
+.LDS1847:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_gp5
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1848
+	call v4__dscheck
+.LDS1848:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,876,.LM9845-main
+.LM9845:
+	mov $8330,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1849
+	call v4__dscheck
+.LDS1849:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_gp6
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1850
+	call v4__dscheck
+.LDS1850:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,912,.LM9853-main
+.LM9853:
+	mov $8690,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1851
+	call v4__dscheck
+.LDS1851:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_gp7
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1852
+	call v4__dscheck
+.LDS1852:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,924,.LM9861-main
+.LM9861:
+	mov $8800,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1853
+	call v4__dscheck
+.LDS1853:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1854
+	call v4__dscheck
+.LDS1854:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbracket
+	mov $48,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1855
+	call v4__dscheck
+.LDS1855:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9874-main
+.LM9874:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1856
+	call v4__dscheck
+.LDS1856:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM9878-main
+.LM9878:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,924,.LM9882-main
+.LM9882:
+	cmp $4080,%rcx
+	jbe .LDS1857
+	call v4__dscheck
+.LDS1857:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,920,.LM9889-main
+.LM9889:
+	lea v4_gn_Minusbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1858
+	call v4__dscheck
+.LDS1858:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,924,.LM9894-main
+.LM9894:
+	cmp $4080,%rcx
+	jbe .LDS1859
+	call v4__dscheck
+.LDS1859:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,925,.LM9895-main
+.LM9895:
+	mov $8810,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1860
+	call v4__dscheck
+.LDS1860:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1861
+	call v4__dscheck
+.LDS1861:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbracket
+	mov $49,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1862
+	call v4__dscheck
+.LDS1862:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9908-main
+.LM9908:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1863
+	call v4__dscheck
+.LDS1863:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM9912-main
+.LM9912:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,925,.LM9916-main
+.LM9916:
+	cmp $4080,%rcx
+	jbe .LDS1864
+	call v4__dscheck
+.LDS1864:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,920,.LM9923-main
+.LM9923:
+	lea v4_gn_Minusbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1865
+	call v4__dscheck
+.LDS1865:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,925,.LM9928-main
+.LM9928:
+	cmp $4080,%rcx
+	jbe .LDS1866
+	call v4__dscheck
+.LDS1866:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,926,.LM9929-main
+.LM9929:
+	mov $8820,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1867
+	call v4__dscheck
+.LDS1867:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1868
+	call v4__dscheck
+.LDS1868:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbracket
+	mov $49,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1869
+	call v4__dscheck
+.LDS1869:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9942-main
+.LM9942:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1870
+	call v4__dscheck
+.LDS1870:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM9946-main
+.LM9946:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,926,.LM9950-main
+.LM9950:
+	cmp $4080,%rcx
+	jbe .LDS1871
+	call v4__dscheck
+.LDS1871:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	call v4_base
+	call v4_Fetch
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS1872
+	call v4__dscheck
+.LDS1872:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,920,.LM9961-main
+.LM9961:
+	lea v4_gn_Minusbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1873
+	call v4__dscheck
+.LDS1873:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,926,.LM9966-main
+.LM9966:
+	cmp $4080,%rcx
+	jbe .LDS1874
+	call v4__dscheck
+.LDS1874:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,927,.LM9967-main
+.LM9967:
+	mov $8830,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1875
+	call v4__dscheck
+.LDS1875:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1876
+	call v4__dscheck
+.LDS1876:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbracket
+	mov $45,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1877
+	call v4__dscheck
+.LDS1877:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM9980-main
+.LM9980:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1878
+	call v4__dscheck
+.LDS1878:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM9984-main
+.LM9984:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,927,.LM9988-main
+.LM9988:
+	cmp $4080,%rcx
+	jbe .LDS1879
+	call v4__dscheck
+.LDS1879:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,919,.LM9995-main
+.LM9995:
+	lea v4_gn_Minusbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,927,.LM9999-main
+.LM9999:
+	cmp $4080,%rcx
+	jbe .LDS1880
+	call v4__dscheck
+.LDS1880:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,928,.LM10000-main
+.LM10000:
+	mov $8840,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1881
+	call v4__dscheck
+.LDS1881:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1882
+	call v4__dscheck
+.LDS1882:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbracket
+	mov $43,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1883
+	call v4__dscheck
+.LDS1883:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10013-main
+.LM10013:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1884
+	call v4__dscheck
+.LDS1884:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM10017-main
+.LM10017:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,928,.LM10021-main
+.LM10021:
+	cmp $4080,%rcx
+	jbe .LDS1885
+	call v4__dscheck
+.LDS1885:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,919,.LM10028-main
+.LM10028:
+	lea v4_gn_Minusbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,928,.LM10032-main
+.LM10032:
+	cmp $4080,%rcx
+	jbe .LDS1886
+	call v4__dscheck
+.LDS1886:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,929,.LM10033-main
+.LM10033:
+	mov $8850,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1887
+	call v4__dscheck
+.LDS1887:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1888
+	call v4__dscheck
+.LDS1888:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbracket
+	mov $46,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1889
+	call v4__dscheck
+.LDS1889:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10046-main
+.LM10046:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1890
+	call v4__dscheck
+.LDS1890:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM10050-main
+.LM10050:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,929,.LM10054-main
+.LM10054:
+	cmp $4080,%rcx
+	jbe .LDS1891
+	call v4__dscheck
+.LDS1891:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Greaternumber
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,919,.LM10061-main
+.LM10061:
+	lea v4_gn_Minusbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,929,.LM10065-main
+.LM10065:
+	cmp $4080,%rcx
+	jbe .LDS1892
+	call v4__dscheck
+.LDS1892:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,934,.LM10066-main
+.LM10066:
+	mov $8900,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1893
+	call v4__dscheck
+.LDS1893:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1894
+	call v4__dscheck
+.LDS1894:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbracket
+	mov $50,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1895
+	call v4__dscheck
+.LDS1895:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10079-main
+.LM10079:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1896
+	call v4__dscheck
+.LDS1896:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM10083-main
+.LM10083:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,934,.LM10087-main
+.LM10087:
+	mov $16,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,932,.LM10090-main
+.LM10090:
+	cmp $4080,%rcx
+	jbe .LDS1897
+	call v4__dscheck
+.LDS1897:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,934,.LM10099-main
+.LM10099:
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,920,.LM10105-main
+.LM10105:
+	lea v4_gn_Minusbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1898
+	call v4__dscheck
+.LDS1898:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,934,.LM10110-main
+.LM10110:
+	cmp $4080,%rcx
+	jbe .LDS1899
+	call v4__dscheck
+.LDS1899:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,935,.LM10111-main
+.LM10111:
+	mov $8910,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1900
+	call v4__dscheck
+.LDS1900:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1901
+	call v4__dscheck
+.LDS1901:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbracket
+	mov $50,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1902
+	call v4__dscheck
+.LDS1902:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10124-main
+.LM10124:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1903
+	call v4__dscheck
+.LDS1903:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM10128-main
+.LM10128:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,935,.LM10132-main
+.LM10132:
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,932,.LM10135-main
+.LM10135:
+	cmp $4080,%rcx
+	jbe .LDS1904
+	call v4__dscheck
+.LDS1904:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,935,.LM10144-main
+.LM10144:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,919,.LM10150-main
+.LM10150:
+	lea v4_gn_Minusbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,935,.LM10154-main
+.LM10154:
+	cmp $4080,%rcx
+	jbe .LDS1905
+	call v4__dscheck
+.LDS1905:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,936,.LM10155-main
+.LM10155:
+	mov $8920,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1906
+	call v4__dscheck
+.LDS1906:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1907
+	call v4__dscheck
+.LDS1907:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbracket
+	mov $70,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1908
+	call v4__dscheck
+.LDS1908:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10168-main
+.LM10168:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1909
+	call v4__dscheck
+.LDS1909:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM10172-main
+.LM10172:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,936,.LM10176-main
+.LM10176:
+	mov $16,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,932,.LM10179-main
+.LM10179:
+	cmp $4080,%rcx
+	jbe .LDS1910
+	call v4__dscheck
+.LDS1910:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,936,.LM10188-main
+.LM10188:
+	call v4_Minus_Greater
+	mov $15,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,920,.LM10194-main
+.LM10194:
+	lea v4_gn_Minusbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1911
+	call v4__dscheck
+.LDS1911:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,936,.LM10199-main
+.LM10199:
+	cmp $4080,%rcx
+	jbe .LDS1912
+	call v4__dscheck
+.LDS1912:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,937,.LM10200-main
+.LM10200:
+	mov $8930,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1913
+	call v4__dscheck
+.LDS1913:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1914
+	call v4__dscheck
+.LDS1914:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbracket
+	mov $71,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1915
+	call v4__dscheck
+.LDS1915:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10213-main
+.LM10213:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1916
+	call v4__dscheck
+.LDS1916:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM10217-main
+.LM10217:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,937,.LM10221-main
+.LM10221:
+	mov $16,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,932,.LM10224-main
+.LM10224:
+	cmp $4080,%rcx
+	jbe .LDS1917
+	call v4__dscheck
+.LDS1917:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,937,.LM10233-main
+.LM10233:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,919,.LM10239-main
+.LM10239:
+	lea v4_gn_Minusbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,937,.LM10243-main
+.LM10243:
+	cmp $4080,%rcx
+	jbe .LDS1918
+	call v4__dscheck
+.LDS1918:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,938,.LM10244-main
+.LM10244:
+	mov $8940,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1919
+	call v4__dscheck
+.LDS1919:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1920
+	call v4__dscheck
+.LDS1920:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbracket
+	mov $71,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1921
+	call v4__dscheck
+.LDS1921:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10257-main
+.LM10257:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1922
+	call v4__dscheck
+.LDS1922:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM10261-main
+.LM10261:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,938,.LM10265-main
+.LM10265:
+	mov $36,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,932,.LM10268-main
+.LM10268:
+	cmp $4080,%rcx
+	jbe .LDS1923
+	call v4__dscheck
+.LDS1923:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,938,.LM10277-main
+.LM10277:
+	call v4_Minus_Greater
+	mov $16,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,920,.LM10283-main
+.LM10283:
+	lea v4_gn_Minusbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1924
+	call v4__dscheck
+.LDS1924:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,938,.LM10288-main
+.LM10288:
+	cmp $4080,%rcx
+	jbe .LDS1925
+	call v4__dscheck
+.LDS1925:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,939,.LM10289-main
+.LM10289:
+	mov $8950,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1926
+	call v4__dscheck
+.LDS1926:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1927
+	call v4__dscheck
+.LDS1927:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbracket
+	mov $90,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1928
+	call v4__dscheck
+.LDS1928:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbracket
+	call v4_literal
+.stabn 68,0,922,.LM10302-main
+.LM10302:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1929
+	call v4__dscheck
+.LDS1929:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+.stabn 68,0,919,.LM10306-main
+.LM10306:
+	lea v4_gn_Minusbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,939,.LM10310-main
+.LM10310:
+	mov $36,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,932,.LM10313-main
+.LM10313:
+	cmp $4080,%rcx
+	jbe .LDS1930
+	call v4__dscheck
+.LDS1930:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_base
+	call v4_Store
+	call v4_Greaternumber
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,939,.LM10322-main
+.LM10322:
+	call v4_Minus_Greater
+	mov $35,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,920,.LM10328-main
+.LM10328:
+	lea v4_gn_Minusbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1931
+	call v4__dscheck
+.LDS1931:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,939,.LM10333-main
+.LM10333:
+	cmp $4080,%rcx
+	jbe .LDS1932
+	call v4__dscheck
+.LDS1932:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,946,.LM10334-main
+.LM10334:
+	mov $9020,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1933
+	call v4__dscheck
+.LDS1933:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1934
+	call v4__dscheck
+.LDS1934:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1935
+	call v4__dscheck
+.LDS1935:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,947,.LM10352-main
+.LM10352:
+	mov $9030,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1936
+	call v4__dscheck
+.LDS1936:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1937
+	call v4__dscheck
+.LDS1937:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1938
+	call v4__dscheck
+.LDS1938:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,949,.LM10370-main
+.LM10370:
+	mov $9050,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1939
+	call v4__dscheck
+.LDS1939:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $36,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1940
+	call v4__dscheck
+.LDS1940:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1941
+	call v4__dscheck
+.LDS1941:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,950,.LM10388-main
+.LM10388:
+	mov $9060,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1942
+	call v4__dscheck
+.LDS1942:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $36,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1943
+	call v4__dscheck
+.LDS1943:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gn1
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1944
+	call v4__dscheck
+.LDS1944:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,955,.LM10406-main
+.LM10406:
+	mov $9110,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1945
+	call v4__dscheck
+.LDS1945:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,954,.LM10410-main
+.LM10410:
+	call v4_base
+	call v4_Fetch
+	call v4_Greaterr
+	call v4_hex
+	call v4_base
+	call v4_Fetch
+	call v4_decimal
+	call v4_base
+	call v4_Fetch
+	call v4_r_Greater
+	call v4_base
+	call v4_Store
+.stabn 68,0,955,.LM10422-main
+.LM10422:
+	call v4_Minus_Greater
+	mov $16,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $10,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1946
+	call v4__dscheck
+.LDS1946:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,958,.LM10428-main
+.LM10428:
+	lea .LC22(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $17,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1947
+	call v4__dscheck
+.LDS1947:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,964,.LM10434-main
+.LM10434:
+	mov $18,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_sbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1948
+	call v4__dscheck
+.LDS1948:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Store
+	mov $52,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_sbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1949
+	call v4__dscheck
+.LDS1949:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_c_Store
+	mov $86,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_sbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1950
+	call v4__dscheck
+.LDS1950:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Store
+.stabn 68,0,967,.LM10452-main
+.LM10452:
+	mov $9220,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1951
+	call v4__dscheck
+.LDS1951:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $32,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1952
+	call v4__dscheck
+.LDS1952:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fill
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,968,.LM10464-main
+.LM10464:
+	mov $9230,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1953
+	call v4__dscheck
+.LDS1953:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10468-main
+.LM10468:
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1954
+	call v4__dscheck
+.LDS1954:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1955
+	call v4__dscheck
+.LDS1955:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1956
+	call v4__dscheck
+.LDS1956:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,968,.LM10480-main
+.LM10480:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1957
+	call v4__dscheck
+.LDS1957:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,970,.LM10488-main
+.LM10488:
+	mov $9250,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1958
+	call v4__dscheck
+.LDS1958:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $32,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1959
+	call v4__dscheck
+.LDS1959:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fill
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,971,.LM10500-main
+.LM10500:
+	mov $9260,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1960
+	call v4__dscheck
+.LDS1960:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10504-main
+.LM10504:
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1961
+	call v4__dscheck
+.LDS1961:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1962
+	call v4__dscheck
+.LDS1962:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1963
+	call v4__dscheck
+.LDS1963:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,971,.LM10516-main
+.LM10516:
+	call v4_Minus_Greater
+	mov $32,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1964
+	call v4__dscheck
+.LDS1964:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,973,.LM10524-main
+.LM10524:
+	mov $9280,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1965
+	call v4__dscheck
+.LDS1965:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $32,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1966
+	call v4__dscheck
+.LDS1966:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_fill
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,974,.LM10536-main
+.LM10536:
+	mov $9290,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1967
+	call v4__dscheck
+.LDS1967:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10540-main
+.LM10540:
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1968
+	call v4__dscheck
+.LDS1968:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1969
+	call v4__dscheck
+.LDS1969:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1970
+	call v4__dscheck
+.LDS1970:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,974,.LM10552-main
+.LM10552:
+	call v4_Minus_Greater
+	mov $32,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $32,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $32,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1971
+	call v4__dscheck
+.LDS1971:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,976,.LM10560-main
+.LM10560:
+	mov $9310,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1972
+	call v4__dscheck
+.LDS1972:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_fbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1973
+	call v4__dscheck
+.LDS1973:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,977,.LM10573-main
+.LM10573:
+	mov $9320,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1974
+	call v4__dscheck
+.LDS1974:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10577-main
+.LM10577:
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1975
+	call v4__dscheck
+.LDS1975:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1976
+	call v4__dscheck
+.LDS1976:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1977
+	call v4__dscheck
+.LDS1977:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,977,.LM10589-main
+.LM10589:
+	call v4_Minus_Greater
+	mov $32,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $32,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $32,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1978
+	call v4__dscheck
+.LDS1978:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,979,.LM10597-main
+.LM10597:
+	mov $9340,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1979
+	call v4__dscheck
+.LDS1979:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_sbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_fbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1980
+	call v4__dscheck
+.LDS1980:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,980,.LM10610-main
+.LM10610:
+	mov $9350,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1981
+	call v4__dscheck
+.LDS1981:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10614-main
+.LM10614:
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1982
+	call v4__dscheck
+.LDS1982:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1983
+	call v4__dscheck
+.LDS1983:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1984
+	call v4__dscheck
+.LDS1984:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,980,.LM10626-main
+.LM10626:
+	call v4_Minus_Greater
+	mov $32,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $32,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $32,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1985
+	call v4__dscheck
+.LDS1985:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,982,.LM10634-main
+.LM10634:
+	mov $9370,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1986
+	call v4__dscheck
+.LDS1986:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_sbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_fbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1987
+	call v4__dscheck
+.LDS1987:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,983,.LM10647-main
+.LM10647:
+	mov $9380,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1988
+	call v4__dscheck
+.LDS1988:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10651-main
+.LM10651:
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1989
+	call v4__dscheck
+.LDS1989:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1990
+	call v4__dscheck
+.LDS1990:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1991
+	call v4__dscheck
+.LDS1991:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,983,.LM10663-main
+.LM10663:
+	call v4_Minus_Greater
+	mov $18,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $32,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $32,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1992
+	call v4__dscheck
+.LDS1992:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,985,.LM10671-main
+.LM10671:
+	mov $9400,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1993
+	call v4__dscheck
+.LDS1993:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_sbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_fbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1994
+	call v4__dscheck
+.LDS1994:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,986,.LM10684-main
+.LM10684:
+	mov $9410,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1995
+	call v4__dscheck
+.LDS1995:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10688-main
+.LM10688:
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1996
+	call v4__dscheck
+.LDS1996:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1997
+	call v4__dscheck
+.LDS1997:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1998
+	call v4__dscheck
+.LDS1998:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,986,.LM10700-main
+.LM10700:
+	call v4_Minus_Greater
+	mov $18,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $52,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $86,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1999
+	call v4__dscheck
+.LDS1999:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,988,.LM10708-main
+.LM10708:
+	mov $9430,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2000
+	call v4__dscheck
+.LDS2000:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_fbuf(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2001
+	call v4__dscheck
+.LDS2001:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2002
+	call v4__dscheck
+.LDS2002:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,989,.LM10722-main
+.LM10722:
+	mov $9440,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2003
+	call v4__dscheck
+.LDS2003:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10726-main
+.LM10726:
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2004
+	call v4__dscheck
+.LDS2004:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2005
+	call v4__dscheck
+.LDS2005:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2006
+	call v4__dscheck
+.LDS2006:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,989,.LM10738-main
+.LM10738:
+	call v4_Minus_Greater
+	mov $18,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $18,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $52,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2007
+	call v4__dscheck
+.LDS2007:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,991,.LM10746-main
+.LM10746:
+	mov $9460,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2008
+	call v4__dscheck
+.LDS2008:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2009
+	call v4__dscheck
+.LDS2009:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2010
+	call v4__dscheck
+.LDS2010:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_move
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,992,.LM10760-main
+.LM10760:
+	mov $9470,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2011
+	call v4__dscheck
+.LDS2011:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,965,.LM10764-main
+.LM10764:
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2012
+	call v4__dscheck
+.LDS2012:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2013
+	call v4__dscheck
+.LDS2013:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_c_Fetch
+	lea v4_fbuf(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2014
+	call v4__dscheck
+.LDS2014:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_char_Plus
+	call v4_char_Plus
+	call v4_c_Fetch
+.stabn 68,0,992,.LM10776-main
+.LM10776:
+	call v4_Minus_Greater
+	mov $18,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $52,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $52,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2015
+	call v4__dscheck
+.LDS2015:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,995,.LM10784-main
+.LM10784:
+	lea .LC23(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $54,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2016
+	call v4__dscheck
+.LDS2016:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,1013,.LM10790-main
+.LM10790:
+	mov $9680,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2017
+	call v4__dscheck
+.LDS2017:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_output_Minustest
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,1016,.LM10796-main
+.LM10796:
+	lea .LC34(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $21,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2018
+	call v4__dscheck
+.LDS2018:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,1027,.LM10802-main
+.LM10802:
+	mov $9820,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2019
+	call v4__dscheck
+.LDS2019:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_accept_Minustest
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,1037,.LM10808-main
+.LM10808:
+	call v4_test_Minusstatus
+	call v4_Fetch
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE1:
+.stabn 68,0,1037,.LM10812-main
+.LM10812:
+	pop %rbx
+	leave
+	ret
+.Lfe1:
+	.size	 main,.Lfe1-main
+.stabn	192,0,0,.LBB1-main
+.stabn	224,0,0,.LBE1-main
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,506 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: test_environ.ft
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug x86_64 optimize intermediate assembly
+
+Data:
+    53 Data_36 string[7] "#LOCALS"
+    23 Data_6 string[15] "/COUNTED-STRING"
+    24 Data_7 string[5] "/HOLD"
+    25 Data_8 string[4] "/PAD"
+    17 Data_2 string[2] "= "
+     9 Data_1 string[34] "=================================="
+    63 Data_46 string[17] "A NONSENSE STRING"
+    26 Data_9 string[17] "ADDRESS-UNIT-BITS"
+    37 Data_20 string[5] "BLOCK"
+    38 Data_21 string[9] "BLOCK-EXT"
+    27 Data_10 string[4] "CORE"
+    28 Data_11 string[8] "CORE-EXT"
+    39 Data_22 string[6] "DOUBLE"
+    40 Data_23 string[10] "DOUBLE-EXT"
+    41 Data_24 string[9] "EXCEPTION"
+    42 Data_25 string[13] "EXCEPTION-EXT"
+     8 Data_0 string[34] "Environment as reported by system:"
+    43 Data_26 string[8] "FACILITY"
+    44 Data_27 string[12] "FACILITY-EXT"
+    45 Data_28 string[4] "FILE"
+    46 Data_29 string[8] "FILE-EXT"
+    47 Data_30 string[8] "FLOATING"
+    48 Data_31 string[12] "FLOATING-EXT"
+    49 Data_32 string[14] "FLOATING-STACK"
+    29 Data_12 string[7] "FLOORED"
+    51 Data_34 string[6] "LOCALS"
+    52 Data_35 string[10] "LOCALS-EXT"
+    30 Data_13 string[8] "MAX-CHAR"
+    31 Data_14 string[5] "MAX-D"
+    50 Data_33 string[9] "MAX-FLOAT"
+    32 Data_15 string[5] "MAX-N"
+    33 Data_16 string[5] "MAX-U"
+    34 Data_17 string[6] "MAX-UD"
+    54 Data_37 string[12] "MEMORY-ALLOC"
+    55 Data_38 string[16] "MEMORY-ALLOC-EXT"
+    20 Data_5 string[3] "NO "
+    35 Data_18 string[18] "RETURN-STACK-CELLS"
+    58 Data_41 string[12] "SEARCH-ORDER"
+    59 Data_42 string[16] "SEARCH-ORDER-EXT"
+    36 Data_19 string[11] "STACK-CELLS"
+    61 Data_44 string[6] "STRING"
+    62 Data_45 string[10] "STRING-EXT"
+    56 Data_39 string[5] "TOOLS"
+    57 Data_40 string[9] "TOOLS-EXT"
+    18 Data_3 string[8] "UNKNOWN!"
+    60 Data_43 string[9] "WORDLISTS"
+    20 Data_4 string[4] "YES "
+
+Symbols:
+     8 Sym_0 word "main"
+    21 Sym_15 external "v4_Dot"
+    20 Sym_13 word "v4_Dotflag"
+    21 Sym_14 word "v4_Dotnumber"
+    66 Sym_20 external "v4_Dots"
+    12 Sym_5 external "v4_Store"
+    12 Sym_4 external "v4__strictansi"
+     8 Sym_2 external "v4__type"
+     8 Sym_1 external "v4_cr"
+    15 Sym_6 external "v4_decimal"
+    69 Sym_21 external "v4_depth"
+    69 Sym_22 external "v4_drop"
+    18 Sym_11 external "v4_dup"
+    18 Sym_10 external "v4_environment_Question"
+    50 Sym_19 external "v4_fs_Dot"
+    17 Sym_7 word "v4_known_Question"
+    23 Sym_16 word "v4_show_Minusenv"
+    31 Sym_17 external "v4_swap"
+    12 Sym_3 external "v4_true"
+    17 Sym_9 external "v4_type"
+    33 Sym_18 external "v4_u_Dot"
+    18 Sym_12 external "v4_z0_Equals"
+    17 Sym_8 external "v4_z2dup"
+
+Intermediate code:
+    17 function Sym_7 {
+    17   call Sym_8
+    17   call Sym_9
+    17   Reg_0 = Data_2
+    17   Stack_D = Reg_0
+    17   Reg_0 = 2
+    17   Stack_D = Reg_0
+    17   call Sym_2
+    18   call Sym_10
+    18   call Sym_11
+    18   no-op
+           optimizes   call Sym_12
+    18   Reg_0 = Stack_D
+    18   if Reg_0 != 0 goto Label_2
+    18   no-op
+           optimizes   Reg_0 = Stack_D
+    18   no-op
+           optimizes   if Reg_0 == 0 goto Label_2
+    18   Reg_0 = Data_3
+    18   Stack_D = Reg_0
+    18   Reg_0 = 8
+    18   Stack_D = Reg_0
+    18   call Sym_2
+    18   tail call Sym_1
+           optimizes   call Sym_1
+    18 label Label_2
+    18   no-op
+           optimizes label Label_1
+    18 }
+
+    20 function Sym_13 {
+    20   call Sym_7
+    20   Reg_0 = Stack_D
+    20   if Reg_0 == 0 goto Label_4
+    20   Reg_0 = Stack_D
+    20   if Reg_0 == 0 goto Label_5
+    20   Reg_0 = Data_4
+    20   Stack_D = Reg_0
+    20   Reg_0 = 4
+    20   Stack_D = Reg_0
+    20   call Sym_2
+    20   goto Label_6
+    20 label Label_5
+    20   Reg_0 = Data_5
+    20   Stack_D = Reg_0
+    20   Reg_0 = 3
+    20   Stack_D = Reg_0
+    20   call Sym_2
+    20 label Label_6
+    20   tail call Sym_1
+           optimizes   call Sym_1
+    20 label Label_4
+    20   no-op
+           optimizes label Label_3
+    20 }
+
+    21 function Sym_14 {
+    21   call Sym_7
+    21   Reg_0 = Stack_D
+    21   if Reg_0 == 0 goto Label_8
+    21   call Sym_15
+    21   tail call Sym_1
+           optimizes   call Sym_1
+    21 label Label_8
+    21   no-op
+           optimizes label Label_7
+    21 }
+
+    23 function Sym_16 {
+    23   Reg_0 = Data_6
+    23   Stack_D = Reg_0
+    23   Reg_0 = 15
+    23   Stack_D = Reg_0
+    23   no-op
+           optimizes   call Sym_14
+    21   call Sym_7
+    21   Reg_0 = Stack_D
+    21   if Reg_0 == 0 goto Label_16
+    21   call Sym_15
+    21   call Sym_1
+    21 label Label_16
+    24   Reg_0 = Data_7
+    24   Stack_D = Reg_0
+    24   Reg_0 = 5
+    24   Stack_D = Reg_0
+    24   no-op
+           optimizes   call Sym_14
+    21   call Sym_7
+    21   Reg_0 = Stack_D
+    21   if Reg_0 == 0 goto Label_17
+    21   call Sym_15
+    21   call Sym_1
+    21 label Label_17
+    25   Reg_0 = Data_8
+    25   Stack_D = Reg_0
+    25   Reg_0 = 4
+    25   Stack_D = Reg_0
+    25   no-op
+           optimizes   call Sym_14
+    21   call Sym_7
+    21   Reg_0 = Stack_D
+    21   if Reg_0 == 0 goto Label_18
+    21   call Sym_15
+    21   call Sym_1
+    21 label Label_18
+    26   Reg_0 = Data_9
+    26   Stack_D = Reg_0
+    26   Reg_0 = 17
+    26   Stack_D = Reg_0
+    26   no-op
+           optimizes   call Sym_14
+    21   call Sym_7
+    21   Reg_0 = Stack_D
+    21   if Reg_0 == 0 goto Label_19
+    21   call Sym_15
+    21   call Sym_1
+    21 label Label_19
+    27   Reg_0 = Data_10
+    27   Stack_D = Reg_0
+    27   Reg_0 = 4
+    27   Stack_D = Reg_0
+    27   call Sym_13
+    28   Reg_0 = Data_11
+    28   Stack_D = Reg_0
+    28   Reg_0 = 8
+    28   Stack_D = Reg_0
+    28   call Sym_13
+    29   Reg_0 = Data_12
+    29   Stack_D = Reg_0
+    29   Reg_0 = 7
+    29   Stack_D = Reg_0
+    29   call Sym_13
+    30   Reg_0 = Data_13
+    30   Stack_D = Reg_0
+    30   Reg_0 = 8
+    30   Stack_D = Reg_0
+    30   no-op
+           optimizes   call Sym_14
+    21   call Sym_7
+    21   Reg_0 = Stack_D
+    21   if Reg_0 == 0 goto Label_20
+    21   call Sym_15
+    21   call Sym_1
+    21 label Label_20
+    31   Reg_0 = Data_14
+    31   Stack_D = Reg_0
+    31   Reg_0 = 5
+    31   Stack_D = Reg_0
+    31   call Sym_7
+    31   Reg_0 = Stack_D
+    31   if Reg_0 == 0 goto Label_10
+    31   call Sym_17
+    31   call Sym_15
+    31   call Sym_15
+    31   call Sym_1
+    31 label Label_10
+    32   Reg_0 = Data_15
+    32   Stack_D = Reg_0
+    32   Reg_0 = 5
+    32   Stack_D = Reg_0
+    32   no-op
+           optimizes   call Sym_14
+    21   call Sym_7
+    21   Reg_0 = Stack_D
+    21   if Reg_0 == 0 goto Label_21
+    21   call Sym_15
+    21   call Sym_1
+    21 label Label_21
+    33   Reg_0 = Data_16
+    33   Stack_D = Reg_0
+    33   Reg_0 = 5
+    33   Stack_D = Reg_0
+    33   call Sym_7
+    33   Reg_0 = Stack_D
+    33   if Reg_0 == 0 goto Label_11
+    33   call Sym_18
+    33   call Sym_1
+    33 label Label_11
+    34   Reg_0 = Data_17
+    34   Stack_D = Reg_0
+    34   Reg_0 = 6
+    34   Stack_D = Reg_0
+    34   call Sym_7
+    34   Reg_0 = Stack_D
+    34   if Reg_0 == 0 goto Label_12
+    34   call Sym_17
+    34   call Sym_18
+    34   call Sym_18
+    34   call Sym_1
+    34 label Label_12
+    35   Reg_0 = Data_18
+    35   Stack_D = Reg_0
+    35   Reg_0 = 18
+    35   Stack_D = Reg_0
+    35   no-op
+           optimizes   call Sym_14
+    21   call Sym_7
+    21   Reg_0 = Stack_D
+    21   if Reg_0 == 0 goto Label_22
+    21   call Sym_15
+    21   call Sym_1
+    21 label Label_22
+    36   Reg_0 = Data_19
+    36   Stack_D = Reg_0
+    36   Reg_0 = 11
+    36   Stack_D = Reg_0
+    36   no-op
+           optimizes   call Sym_14
+    21   call Sym_7
+    21   Reg_0 = Stack_D
+    21   if Reg_0 == 0 goto Label_23
+    21   call Sym_15
+    21   call Sym_1
+    21 label Label_23
+    37   Reg_0 = Data_20
+    37   Stack_D = Reg_0
+    37   Reg_0 = 5
+    37   Stack_D = Reg_0
+    37   call Sym_13
+    38   Reg_0 = Data_21
+    38   Stack_D = Reg_0
+    38   Reg_0 = 9
+    38   Stack_D = Reg_0
+    38   call Sym_13
+    39   Reg_0 = Data_22
+    39   Stack_D = Reg_0
+    39   Reg_0 = 6
+    39   Stack_D = Reg_0
+    39   call Sym_13
+    40   Reg_0 = Data_23
+    40   Stack_D = Reg_0
+    40   Reg_0 = 10
+    40   Stack_D = Reg_0
+    40   call Sym_13
+    41   Reg_0 = Data_24
+    41   Stack_D = Reg_0
+    41   Reg_0 = 9
+    41   Stack_D = Reg_0
+    41   call Sym_13
+    42   Reg_0 = Data_25
+    42   Stack_D = Reg_0
+    42   Reg_0 = 13
+    42   Stack_D = Reg_0
+    42   call Sym_13
+    43   Reg_0 = Data_26
+    43   Stack_D = Reg_0
+    43   Reg_0 = 8
+    43   Stack_D = Reg_0
+    43   call Sym_13
+    44   Reg_0 = Data_27
+    44   Stack_D = Reg_0
+    44   Reg_0 = 12
+    44   Stack_D = Reg_0
+    44   call Sym_13
+    45   Reg_0 = Data_28
+    45   Stack_D = Reg_0
+    45   Reg_0 = 4
+    45   Stack_D = Reg_0
+    45   call Sym_13
+    46   Reg_0 = Data_29
+    46   Stack_D = Reg_0
+    46   Reg_0 = 8
+    46   Stack_D = Reg_0
+    46   call Sym_13
+    47   Reg_0 = Data_30
+    47   Stack_D = Reg_0
+    47   Reg_0 = 8
+    47   Stack_D = Reg_0
+    47   call Sym_13
+    48   Reg_0 = Data_31
+    48   Stack_D = Reg_0
+    48   Reg_0 = 12
+    48   Stack_D = Reg_0
+    48   call Sym_13
+    49   Reg_0 = Data_32
+    49   Stack_D = Reg_0
+    49   Reg_0 = 14
+    49   Stack_D = Reg_0
+    49   no-op
+           optimizes   call Sym_14
+    21   call Sym_7
+    21   Reg_0 = Stack_D
+    21   if Reg_0 == 0 goto Label_24
+    21   call Sym_15
+    21   call Sym_1
+    21 label Label_24
+    50   Reg_0 = Data_33
+    50   Stack_D = Reg_0
+    50   Reg_0 = 9
+    50   Stack_D = Reg_0
+    50   call Sym_7
+    50   Reg_0 = Stack_D
+    50   if Reg_0 == 0 goto Label_13
+    50   call Sym_19
+    50   call Sym_1
+    50 label Label_13
+    51   Reg_0 = Data_34
+    51   Stack_D = Reg_0
+    51   Reg_0 = 6
+    51   Stack_D = Reg_0
+    51   call Sym_13
+    52   Reg_0 = Data_35
+    52   Stack_D = Reg_0
+    52   Reg_0 = 10
+    52   Stack_D = Reg_0
+    52   call Sym_13
+    53   Reg_0 = Data_36
+    53   Stack_D = Reg_0
+    53   Reg_0 = 7
+    53   Stack_D = Reg_0
+    53   no-op
+           optimizes   call Sym_14
+    21   call Sym_7
+    21   Reg_0 = Stack_D
+    21   if Reg_0 == 0 goto Label_25
+    21   call Sym_15
+    21   call Sym_1
+    21 label Label_25
+    54   Reg_0 = Data_37
+    54   Stack_D = Reg_0
+    54   Reg_0 = 12
+    54   Stack_D = Reg_0
+    54   call Sym_13
+    55   Reg_0 = Data_38
+    55   Stack_D = Reg_0
+    55   Reg_0 = 16
+    55   Stack_D = Reg_0
+    55   call Sym_13
+    56   Reg_0 = Data_39
+    56   Stack_D = Reg_0
+    56   Reg_0 = 5
+    56   Stack_D = Reg_0
+    56   call Sym_13
+    57   Reg_0 = Data_40
+    57   Stack_D = Reg_0
+    57   Reg_0 = 9
+    57   Stack_D = Reg_0
+    57   call Sym_13
+    58   Reg_0 = Data_41
+    58   Stack_D = Reg_0
+    58   Reg_0 = 12
+    58   Stack_D = Reg_0
+    58   call Sym_13
+    59   Reg_0 = Data_42
+    59   Stack_D = Reg_0
+    59   Reg_0 = 16
+    59   Stack_D = Reg_0
+    59   call Sym_13
+    60   Reg_0 = Data_43
+    60   Stack_D = Reg_0
+    60   Reg_0 = 9
+    60   Stack_D = Reg_0
+    60   no-op
+           optimizes   call Sym_14
+    21   call Sym_7
+    21   Reg_0 = Stack_D
+    21   if Reg_0 == 0 goto Label_26
+    21   call Sym_15
+    21   call Sym_1
+    21 label Label_26
+    61   Reg_0 = Data_44
+    61   Stack_D = Reg_0
+    61   Reg_0 = 6
+    61   Stack_D = Reg_0
+    61   call Sym_13
+    62   Reg_0 = Data_45
+    62   Stack_D = Reg_0
+    62   Reg_0 = 10
+    62   Stack_D = Reg_0
+    62   call Sym_13
+    63   Reg_0 = Data_46
+    63   Stack_D = Reg_0
+    63   Reg_0 = 17
+    63   Stack_D = Reg_0
+    63   tail call Sym_13
+           optimizes   call Sym_13
+    64   no-op
+           optimizes label Label_9
+    64 }
+
+     8 function Sym_0 {
+     8   call Sym_1
+     8   Reg_0 = Data_0
+     8   Stack_D = Reg_0
+     8   Reg_0 = 34
+     8   Stack_D = Reg_0
+     8   call Sym_2
+     9   call Sym_1
+     9   Reg_0 = Data_1
+     9   Stack_D = Reg_0
+     9   Reg_0 = 34
+     9   Stack_D = Reg_0
+     9   call Sym_2
+    10   call Sym_1
+    12   no-op
+           optimizes   call Sym_3
+    12   Reg_0 = -1
+    12   Stack_D = Reg_0
+    12   call Sym_4
+    12   call Sym_5
+    15   call Sym_6
+    66   call Sym_16
+    66   call Sym_20
+    66   call Sym_1
+    69   call Sym_21
+    69   no-op
+           optimizes   call Sym_12
+    69   Reg_0 = Stack_D
+    69   if Reg_0 != 0 goto Label_14
+    69   no-op
+           optimizes   Reg_0 = Stack_D
+    69   no-op
+           optimizes   if Reg_0 == 0 goto Label_14
+    69   Reg_0 = 0
+    69   Stack_D = Reg_0
+    69   goto Label_15
+    69 label Label_14
+    69   Reg_0 = 1
+    69   Stack_D = Reg_0
+    69 label Label_15
+    69   tail call Sym_22
+           optimizes   call Sym_22
+    69   no-op
+           optimizes label Label_0
+    69 }
+
@@ -0,0 +1,7807 @@
+	.file	"test_optimize3.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"test_optimize3.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC5:
+	.string "TESTING CASE DISPATCH"
+.LC4:
+	.string "TESTING COMPARE AND BRANCH"
+.LC1:
+	.string "TESTING CONSTANT FOLDING AT CELL WIDTH"
+.LC7:
+	.string "TESTING CONSTANTS AS IMMEDIATES"
+.LC8:
+	.string "TESTING INLINING"
+.LC11:
+	.string "TESTING JUMP THREADING AND BLOCK MERGING"
+.LC3:
+	.string "TESTING LEAF WORDS"
+.LC9:
+	.string "TESTING LOOP INVARIANT HOISTING"
+.LC6:
+	.string "TESTING MULTIPLICATION AND DIVISION BY CONSTANTS"
+.LC0:
+	.string "TESTING OPTIMIZER"
+.LC2:
+	.string "TESTING TAIL CALLS"
+.LC10:
+	.string "TESTING VARIABLE ACCESSES"
+.stabs	"v4_Hashdividends:G2",40,0,0,v4_Hashdividends
+	.comm  v4_Hashdividends,8,8
+.stabs	"v4_Lessfalse_Greater:G2",40,0,0,v4_Lessfalse_Greater
+	.comm  v4_Lessfalse_Greater,8,8
+.stabs	"v4_Lesstrue_Greater:G2",40,0,0,v4_Lesstrue_Greater
+	.comm  v4_Lesstrue_Greater,8,8
+.stabs	"v4_biggest:G2",40,0,0,v4_biggest
+	.comm  v4_biggest,8,8
+.stabs	"v4_cell_Minusv:G2",40,0,0,v4_cell_Minusv
+	.comm  v4_cell_Minusv,8,8
+.stabs	"v4_dividends:Gar2;0;15;2",40,0,0,v4_dividends
+	.comm  v4_dividends,128,32
+.stabs	"v4_hundred:G2",40,0,0,v4_hundred
+	.comm  v4_hundred,8,8
+.stabs	"v4_leaf_Minusvar:G2",40,0,0,v4_leaf_Minusvar
+	.comm  v4_leaf_Minusvar,8,8
+.stabs	"v4_max_Minusint:G2",40,0,0,v4_max_Minusint
+	.comm  v4_max_Minusint,8,8
+.stabs	"v4_max_Minusuint:G2",40,0,0,v4_max_Minusuint
+	.comm  v4_max_Minusuint,8,8
+.stabs	"v4_min_Minusint:G2",40,0,0,v4_min_Minusint
+	.comm  v4_min_Minusint,8,8
+.stabs	"v4_minus_Minusone:G2",40,0,0,v4_minus_Minusone
+	.comm  v4_minus_Minusone,8,8
+.stabs	"v4_step:G2",40,0,0,v4_step
+	.comm  v4_step,8,8
+.stabs	"v4_three_Minushundred:G2",40,0,0,v4_three_Minushundred
+	.comm  v4_three_Minushundred,8,8
+.stabs	"v4_zero:G2",40,0,0,v4_zero
+	.comm  v4_zero,8,8
+.text
+	.align 4
+.stabs "v4_fold1:F1",36,0,0,v4_fold1
+.globl v4_fold1
+	.type	v4_fold1,@function
+v4_fold1:
+.stabn 68,0,21,.LMa0-v4_fold1
+.LMa0:
+.stabn 68,0,21,.LMb0-v4_fold1
+.LMb0:
+.LBB14:
+	mov $9,%rax
+	call v4__dpush
+.LBE14:
+.stabn 68,0,21,.LM10-v4_fold1
+.LM10:
+	ret
+.Lfe14:
+	.size	 v4_fold1,.Lfe14-v4_fold1
+.stabn	192,0,0,.LBB14-v4_fold1
+.stabn	224,0,0,.LBE14-v4_fold1
+.Lscope14:
+.stabs	"",36,0,0,.Lscope14-v4_fold1
+.text
+	.align 4
+.stabs "v4_fold2:F1",36,0,0,v4_fold2
+.globl v4_fold2
+	.type	v4_fold2,@function
+v4_fold2:
+.stabn 68,0,22,.LMa11-v4_fold2
+.LMa11:
+.stabn 68,0,22,.LMb11-v4_fold2
+.LMb11:
+.LBB17:
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+.LBE17:
+.stabn 68,0,22,.LM18-v4_fold2
+.LM18:
+	ret
+.Lfe17:
+	.size	 v4_fold2,.Lfe17-v4_fold2
+.stabn	192,0,0,.LBB17-v4_fold2
+.stabn	224,0,0,.LBE17-v4_fold2
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-v4_fold2
+.text
+	.align 4
+.stabs "v4_fold3:F1",36,0,0,v4_fold3
+.globl v4_fold3
+	.type	v4_fold3,@function
+v4_fold3:
+.stabn 68,0,23,.LMa19-v4_fold3
+.LMa19:
+.stabn 68,0,23,.LMb19-v4_fold3
+.LMb19:
+.LBB18:
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+.LBE18:
+.stabn 68,0,23,.LM27-v4_fold3
+.LM27:
+	ret
+.Lfe18:
+	.size	 v4_fold3,.Lfe18-v4_fold3
+.stabn	192,0,0,.LBB18-v4_fold3
+.stabn	224,0,0,.LBE18-v4_fold3
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4_fold3
+.text
+	.align 4
+.stabs "v4_fold4:F1",36,0,0,v4_fold4
+.globl v4_fold4
+	.type	v4_fold4,@function
+v4_fold4:
+.stabn 68,0,24,.LMa28-v4_fold4
+.LMa28:
+.stabn 68,0,24,.LMb28-v4_fold4
+.LMb28:
+.LBB20:
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+.LBE20:
+.stabn 68,0,24,.LM37-v4_fold4
+.LM37:
+	ret
+.Lfe20:
+	.size	 v4_fold4,.Lfe20-v4_fold4
+.stabn	192,0,0,.LBB20-v4_fold4
+.stabn	224,0,0,.LBE20-v4_fold4
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4_fold4
+.text
+	.align 4
+.stabs "v4_fold5:F1",36,0,0,v4_fold5
+.globl v4_fold5
+	.type	v4_fold5,@function
+v4_fold5:
+.stabn 68,0,26,.LMa38-v4_fold5
+.LMa38:
+.stabn 68,0,26,.LMb38-v4_fold5
+.LMb38:
+.LBB24:
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+.LBE24:
+.stabn 68,0,26,.LM45-v4_fold5
+.LM45:
+	ret
+.Lfe24:
+	.size	 v4_fold5,.Lfe24-v4_fold5
+.stabn	192,0,0,.LBB24-v4_fold5
+.stabn	224,0,0,.LBE24-v4_fold5
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4_fold5
+.text
+	.align 4
+.stabs "v4_fold6:F1",36,0,0,v4_fold6
+.globl v4_fold6
+	.type	v4_fold6,@function
+v4_fold6:
+.stabn 68,0,27,.LMa46-v4_fold6
+.LMa46:
+.stabn 68,0,27,.LMb46-v4_fold6
+.LMb46:
+.LBB25:
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+.LBE25:
+.stabn 68,0,27,.LM51-v4_fold6
+.LM51:
+	ret
+.Lfe25:
+	.size	 v4_fold6,.Lfe25-v4_fold6
+.stabn	192,0,0,.LBB25-v4_fold6
+.stabn	224,0,0,.LBE25-v4_fold6
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4_fold6
+.text
+	.align 4
+.stabs "v4_fold7:F1",36,0,0,v4_fold7
+.globl v4_fold7
+	.type	v4_fold7,@function
+v4_fold7:
+.stabn 68,0,32,.LMa52-v4_fold7
+.LMa52:
+.stabn 68,0,32,.LMb52-v4_fold7
+.LMb52:
+.LBB26:
+	mov $-3,%rax
+	call v4__dpush
+.LBE26:
+.stabn 68,0,32,.LM57-v4_fold7
+.LM57:
+	ret
+.Lfe26:
+	.size	 v4_fold7,.Lfe26-v4_fold7
+.stabn	192,0,0,.LBB26-v4_fold7
+.stabn	224,0,0,.LBE26-v4_fold7
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4_fold7
+.text
+	.align 4
+.stabs "v4_fold8:F1",36,0,0,v4_fold8
+.globl v4_fold8
+	.type	v4_fold8,@function
+v4_fold8:
+.stabn 68,0,33,.LMa58-v4_fold8
+.LMa58:
+.stabn 68,0,33,.LMb58-v4_fold8
+.LMb58:
+.LBB28:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.LBE28:
+.stabn 68,0,33,.LM67-v4_fold8
+.LM67:
+	ret
+.Lfe28:
+	.size	 v4_fold8,.Lfe28-v4_fold8
+.stabn	192,0,0,.LBB28-v4_fold8
+.stabn	224,0,0,.LBE28-v4_fold8
+.Lscope28:
+.stabs	"",36,0,0,.Lscope28-v4_fold8
+.text
+	.align 4
+.stabs "v4_fold9:F1",36,0,0,v4_fold9
+.globl v4_fold9
+	.type	v4_fold9,@function
+v4_fold9:
+.stabn 68,0,34,.LMa68-v4_fold9
+.LMa68:
+.stabn 68,0,34,.LMb68-v4_fold9
+.LMb68:
+.LBB29:
+	mov $6,%rax
+	call v4__dpush
+	mov $-4,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.LBE29:
+.stabn 68,0,34,.LM84-v4_fold9
+.LM84:
+	ret
+.Lfe29:
+	.size	 v4_fold9,.Lfe29-v4_fold9
+.stabn	192,0,0,.LBB29-v4_fold9
+.stabn	224,0,0,.LBE29-v4_fold9
+.Lscope29:
+.stabs	"",36,0,0,.Lscope29-v4_fold9
+.text
+	.align 4
+.stabs "v4_fold10:F1",36,0,0,v4_fold10
+.globl v4_fold10
+	.type	v4_fold10,@function
+v4_fold10:
+.stabn 68,0,35,.LMa85-v4_fold10
+.LMa85:
+.stabn 68,0,35,.LMb85-v4_fold10
+.LMb85:
+.LBB34:
+	mov $7,%rax
+	call v4__dpush
+.LBE34:
+.stabn 68,0,35,.LM99-v4_fold10
+.LM99:
+	ret
+.Lfe34:
+	.size	 v4_fold10,.Lfe34-v4_fold10
+.stabn	192,0,0,.LBB34-v4_fold10
+.stabn	224,0,0,.LBE34-v4_fold10
+.Lscope34:
+.stabs	"",36,0,0,.Lscope34-v4_fold10
+.text
+	.align 4
+.stabs "v4_fold11:F1",36,0,0,v4_fold11
+.globl v4_fold11
+	.type	v4_fold11,@function
+v4_fold11:
+.stabn 68,0,36,.LMa100-v4_fold11
+.LMa100:
+.stabn 68,0,36,.LMb100-v4_fold11
+.LMb100:
+.LBB38:
+	mov v4_max_Minusuint(%rip),%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	call v4__dpush
+.LBE38:
+.stabn 68,0,36,.LM111-v4_fold11
+.LM111:
+	ret
+.Lfe38:
+	.size	 v4_fold11,.Lfe38-v4_fold11
+.stabn	192,0,0,.LBB38-v4_fold11
+.stabn	224,0,0,.LBE38-v4_fold11
+.Lscope38:
+.stabs	"",36,0,0,.Lscope38-v4_fold11
+.text
+	.align 4
+.stabs "v4_countdown:F1",36,0,0,v4_countdown
+.globl v4_countdown
+	.type	v4_countdown,@function
+v4_countdown:
+.stabn 68,0,55,.LMa112-v4_countdown
+.LMa112:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,55,.LMb112-v4_countdown
+.LMb112:
+.LBB42:
+.L359:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jne .L13
+	jmp .L12
+.L13:
+	call v4__dpop
+	dec %rax
+	call v4__dpush
+	jmp .L359
+.L12:
+.LBE42:
+.stabn 68,0,55,.LM128-v4_countdown
+.LM128:
+	pop %rbx
+	leave
+	ret
+.Lfe42:
+	.size	 v4_countdown,.Lfe42-v4_countdown
+.stabn	192,0,0,.LBB42-v4_countdown
+.stabn	224,0,0,.LBE42-v4_countdown
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4_countdown
+.text
+	.align 4
+.stabs "v4_sumto:F1",36,0,0,v4_sumto
+.globl v4_sumto
+	.type	v4_sumto,@function
+v4_sumto:
+.stabn 68,0,56,.LMa129-v4_sumto
+.LMa129:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,56,.LMb129-v4_sumto
+.LMb129:
+.LBB45:
+.L360:
+.stabn 68,0,57,.LM131-v4_sumto
+.LM131:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jne .L15
+	pop %rbx
+	leave
+	jmp v4_drop
+.L15:
+	call v4_swap
+	call v4_over
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	call v4_swap
+	call v4__dpop
+	dec %rax
+	call v4__dpush
+	jmp .L360
+.LBE45:
+.stabn 68,0,57,.LM154-v4_sumto
+.LM154:
+	pop %rbx
+	leave
+	ret
+.Lfe45:
+	.size	 v4_sumto,.Lfe45-v4_sumto
+.stabn	192,0,0,.LBB45-v4_sumto
+.stabn	224,0,0,.LBE45-v4_sumto
+.Lscope45:
+.stabs	"",36,0,0,.Lscope45-v4_sumto
+.text
+	.align 4
+.stabs "v4_tail2:F1",36,0,0,v4_tail2
+.globl v4_tail2
+	.type	v4_tail2,@function
+v4_tail2:
+.stabn 68,0,58,.LMa155-v4_tail2
+.LMa155:
+.stabn 68,0,58,.LMb155-v4_tail2
+.LMb155:
+.LBB49:
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+.LBE49:
+.stabn 68,0,58,.LM161-v4_tail2
+.LM161:
+	ret
+.Lfe49:
+	.size	 v4_tail2,.Lfe49-v4_tail2
+.stabn	192,0,0,.LBB49-v4_tail2
+.stabn	224,0,0,.LBE49-v4_tail2
+.Lscope49:
+.stabs	"",36,0,0,.Lscope49-v4_tail2
+.text
+	.align 4
+.stabs "v4_tail1:F1",36,0,0,v4_tail1
+.globl v4_tail1
+	.type	v4_tail1,@function
+v4_tail1:
+.stabn 68,0,59,.LMa162-v4_tail1
+.LMa162:
+.stabn 68,0,59,.LMb162-v4_tail1
+.LMb162:
+.LBB50:
+	call v4__dpop
+	add %rax,%rax
+	inc %rax
+	call v4__dpush
+.LBE50:
+.stabn 68,0,59,.LM173-v4_tail1
+.LM173:
+	ret
+.Lfe50:
+	.size	 v4_tail1,.Lfe50-v4_tail1
+.stabn	192,0,0,.LBB50-v4_tail1
+.stabn	224,0,0,.LBE50-v4_tail1
+.Lscope50:
+.stabs	"",36,0,0,.Lscope50-v4_tail1
+.text
+	.align 4
+.stabs "v4_tail_Minusif:F1",36,0,0,v4_tail_Minusif
+.globl v4_tail_Minusif
+	.type	v4_tail_Minusif,@function
+v4_tail_Minusif:
+.stabn 68,0,60,.LMa174-v4_tail_Minusif
+.LMa174:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,60,.LMb174-v4_tail_Minusif
+.LMb174:
+.LBB52:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L19
+	call v4__dpop
+	neg %rax
+	call v4__dpush
+	jmp .L18
+.L19:
+	call v4__dpop
+	add %rax,%rax
+	inc %rax
+	call v4__dpush
+.L18:
+.LBE52:
+.stabn 68,0,60,.LM198-v4_tail_Minusif
+.LM198:
+	pop %rbx
+	leave
+	ret
+.Lfe52:
+	.size	 v4_tail_Minusif,.Lfe52-v4_tail_Minusif
+.stabn	192,0,0,.LBB52-v4_tail_Minusif
+.stabn	224,0,0,.LBE52-v4_tail_Minusif
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4_tail_Minusif
+.text
+	.align 4
+.stabs "v4_tail_Minusrs:F1",36,0,0,v4_tail_Minusrs
+.globl v4_tail_Minusrs
+	.type	v4_tail_Minusrs,@function
+v4_tail_Minusrs:
+.stabn 68,0,61,.LMa199-v4_tail_Minusrs
+.LMa199:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,61,.LMb199-v4_tail_Minusrs
+.LMb199:
+.LBB54:
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	mov $3,%rax
+	mov %rax,%rcx
+	mov -16(%rbp),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	inc %rax
+	call v4__dpush
+.LBE54:
+.stabn 68,0,61,.LM219-v4_tail_Minusrs
+.LM219:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe54:
+	.size	 v4_tail_Minusrs,.Lfe54-v4_tail_Minusrs
+.stabn	192,0,0,.LBB54-v4_tail_Minusrs
+.stabn	224,0,0,.LBE54-v4_tail_Minusrs
+.Lscope54:
+.stabs	"",36,0,0,.Lscope54-v4_tail_Minusrs
+.text
+	.align 4
+.stabs "v4_tail_Minusloop:F1",36,0,0,v4_tail_Minusloop
+.globl v4_tail_Minusloop
+	.type	v4_tail_Minusloop,@function
+v4_tail_Minusloop:
+.stabn 68,0,62,.LMa220-v4_tail_Minusloop
+.LMa220:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,62,.LMb220-v4_tail_Minusloop
+.LMb220:
+.LBB57:
+	xor %rax,%rax
+	call v4__dpush
+	mov $5,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	mov -16(%rbp),%rcx
+.L23:
+	mov -24(%rbp),%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov %rcx,%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L23
+	mov -16(%rbp),%rax
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+.LBE57:
+.stabn 68,0,62,.LM258-v4_tail_Minusloop
+.LM258:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe57:
+	.size	 v4_tail_Minusloop,.Lfe57-v4_tail_Minusloop
+.stabn	192,0,0,.LBB57-v4_tail_Minusloop
+.stabn	224,0,0,.LBE57-v4_tail_Minusloop
+.Lscope57:
+.stabs	"",36,0,0,.Lscope57-v4_tail_Minusloop
+.text
+	.align 4
+.stabs "v4_tail_Minusexec:F1",36,0,0,v4_tail_Minusexec
+.globl v4_tail_Minusexec
+	.type	v4_tail_Minusexec,@function
+v4_tail_Minusexec:
+.stabn 68,0,63,.LMa259-v4_tail_Minusexec
+.LMa259:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,63,.LMb259-v4_tail_Minusexec
+.LMb259:
+.LBB59:
+	pop %rbx
+	leave
+	jmp v4_execute
+.LBE59:
+.stabn 68,0,63,.LM262-v4_tail_Minusexec
+.LM262:
+	pop %rbx
+	leave
+	ret
+.Lfe59:
+	.size	 v4_tail_Minusexec,.Lfe59-v4_tail_Minusexec
+.stabn	192,0,0,.LBB59-v4_tail_Minusexec
+.stabn	224,0,0,.LBE59-v4_tail_Minusexec
+.Lscope59:
+.stabs	"",36,0,0,.Lscope59-v4_tail_Minusexec
+.text
+	.align 4
+.stabs "v4_leaf1:F1",36,0,0,v4_leaf1
+.globl v4_leaf1
+	.type	v4_leaf1,@function
+v4_leaf1:
+.stabn 68,0,77,.LMa263-v4_leaf1
+.LMa263:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,77,.LMb263-v4_leaf1
+.LMb263:
+.LBB60:
+	call v4_dup
+	pop %rbx
+	leave
+	jmp v4_Star
+.LBE60:
+.stabn 68,0,77,.LM267-v4_leaf1
+.LM267:
+	pop %rbx
+	leave
+	ret
+.Lfe60:
+	.size	 v4_leaf1,.Lfe60-v4_leaf1
+.stabn	192,0,0,.LBB60-v4_leaf1
+.stabn	224,0,0,.LBE60-v4_leaf1
+.Lscope60:
+.stabs	"",36,0,0,.Lscope60-v4_leaf1
+.text
+	.align 4
+.stabs "v4_leaf2:F1",36,0,0,v4_leaf2
+.globl v4_leaf2
+	.type	v4_leaf2,@function
+v4_leaf2:
+.stabn 68,0,78,.LMa268-v4_leaf2
+.LMa268:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,78,.LMb268-v4_leaf2
+.LMb268:
+.LBB61:
+	call v4_z2dup
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+.LBE61:
+.stabn 68,0,78,.LM276-v4_leaf2
+.LM276:
+	pop %rbx
+	leave
+	ret
+.Lfe61:
+	.size	 v4_leaf2,.Lfe61-v4_leaf2
+.stabn	192,0,0,.LBB61-v4_leaf2
+.stabn	224,0,0,.LBE61-v4_leaf2
+.Lscope61:
+.stabs	"",36,0,0,.Lscope61-v4_leaf2
+.text
+	.align 4
+.stabs "v4_leaf_Minusloop:F1",36,0,0,v4_leaf_Minusloop
+.globl v4_leaf_Minusloop
+	.type	v4_leaf_Minusloop,@function
+v4_leaf_Minusloop:
+.stabn 68,0,79,.LMa277-v4_leaf_Minusloop
+.LMa277:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,79,.LMb277-v4_leaf_Minusloop
+.LMb277:
+.LBB63:
+	xor %rax,%rax
+	call v4__dpush
+	mov $10,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	mov -16(%rbp),%rcx
+.L30:
+	mov -24(%rbp),%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov %rcx,%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L30
+	mov -16(%rbp),%rax
+.LBE63:
+.stabn 68,0,79,.LM310-v4_leaf_Minusloop
+.LM310:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe63:
+	.size	 v4_leaf_Minusloop,.Lfe63-v4_leaf_Minusloop
+.stabn	192,0,0,.LBB63-v4_leaf_Minusloop
+.stabn	224,0,0,.LBE63-v4_leaf_Minusloop
+.Lscope63:
+.stabs	"",36,0,0,.Lscope63-v4_leaf_Minusloop
+.text
+	.align 4
+.stabs "v4_leaf_Minusnested:F1",36,0,0,v4_leaf_Minusnested
+.globl v4_leaf_Minusnested
+	.type	v4_leaf_Minusnested,@function
+v4_leaf_Minusnested:
+.stabn 68,0,80,.LMa311-v4_leaf_Minusnested
+.LMa311:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $32,%rsp
+.stabn 68,0,80,.LMb311-v4_leaf_Minusnested
+.LMb311:
+.LBB64:
+	xor %rax,%rax
+	call v4__dpush
+	mov $3,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	mov -16(%rbp),%r8
+.L34:
+	mov $4,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	mov %rax,-32(%rbp)
+	mov %rdx,-40(%rbp)
+	mov -24(%rbp),%r9
+.L37:
+	mov %r9,%rax
+	lea (%rax,%rax,4),%rax
+	add %rax,%rax
+	mov %rax,%rcx
+	mov -40(%rbp),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	mov -40(%rbp),%rdx
+	inc %rdx
+	mov -32(%rbp),%rax
+	mov %rdx,-40(%rbp)
+	sub %rax,%rdx
+	jne .L37
+	mov -32(%rbp),%rax
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov %r8,%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L34
+	mov -16(%rbp),%rax
+.LBE64:
+.stabn 68,0,80,.LM379-v4_leaf_Minusnested
+.LM379:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe64:
+	.size	 v4_leaf_Minusnested,.Lfe64-v4_leaf_Minusnested
+.stabn	192,0,0,.LBB64-v4_leaf_Minusnested
+.stabn	224,0,0,.LBE64-v4_leaf_Minusnested
+.Lscope64:
+.stabs	"",36,0,0,.Lscope64-v4_leaf_Minusnested
+.text
+	.align 4
+.stabs "v4_leaf_Minusrs:F1",36,0,0,v4_leaf_Minusrs
+.globl v4_leaf_Minusrs
+	.type	v4_leaf_Minusrs,@function
+v4_leaf_Minusrs:
+.stabn 68,0,81,.LMa380-v4_leaf_Minusrs
+.LMa380:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,81,.LMb380-v4_leaf_Minusrs
+.LMb380:
+.LBB66:
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	mov -16(%rbp),%rax
+	mov %rax,%rcx
+	mov -16(%rbp),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	call v4__dpush
+.LBE66:
+.stabn 68,0,81,.LM396-v4_leaf_Minusrs
+.LM396:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe66:
+	.size	 v4_leaf_Minusrs,.Lfe66-v4_leaf_Minusrs
+.stabn	192,0,0,.LBB66-v4_leaf_Minusrs
+.stabn	224,0,0,.LBE66-v4_leaf_Minusrs
+.Lscope66:
+.stabs	"",36,0,0,.Lscope66-v4_leaf_Minusrs
+.text
+	.align 4
+.stabs "v4_leaf_Minusstore:F1",36,0,0,v4_leaf_Minusstore
+.globl v4_leaf_Minusstore
+	.type	v4_leaf_Minusstore,@function
+v4_leaf_Minusstore:
+.stabn 68,0,83,.LMa397-v4_leaf_Minusstore
+.LMa397:
+.stabn 68,0,83,.LMb397-v4_leaf_Minusstore
+.LMb397:
+.LBB69:
+	call v4__dpop
+	mov %rax,v4_leaf_Minusvar(%rip)
+.LBE69:
+.stabn 68,0,83,.LM404-v4_leaf_Minusstore
+.LM404:
+	ret
+.Lfe69:
+	.size	 v4_leaf_Minusstore,.Lfe69-v4_leaf_Minusstore
+.stabn	192,0,0,.LBB69-v4_leaf_Minusstore
+.stabn	224,0,0,.LBE69-v4_leaf_Minusstore
+.Lscope69:
+.stabs	"",36,0,0,.Lscope69-v4_leaf_Minusstore
+.text
+	.align 4
+.stabs "v4_leaf_Minusfetch:F1",36,0,0,v4_leaf_Minusfetch
+.globl v4_leaf_Minusfetch
+	.type	v4_leaf_Minusfetch,@function
+v4_leaf_Minusfetch:
+.stabn 68,0,84,.LMa405-v4_leaf_Minusfetch
+.LMa405:
+.stabn 68,0,84,.LMb405-v4_leaf_Minusfetch
+.LMb405:
+.LBB70:
+	mov v4_leaf_Minusvar(%rip),%rax
+	call v4__dpush
+.LBE70:
+.stabn 68,0,84,.LM412-v4_leaf_Minusfetch
+.LM412:
+	ret
+.Lfe70:
+	.size	 v4_leaf_Minusfetch,.Lfe70-v4_leaf_Minusfetch
+.stabn	192,0,0,.LBB70-v4_leaf_Minusfetch
+.stabn	224,0,0,.LBE70-v4_leaf_Minusfetch
+.Lscope70:
+.stabs	"",36,0,0,.Lscope70-v4_leaf_Minusfetch
+.text
+	.align 4
+.stabs "v4_cb_Less:F1",36,0,0,v4_cb_Less
+.globl v4_cb_Less
+	.type	v4_cb_Less,@function
+v4_cb_Less:
+.stabn 68,0,98,.LMa413-v4_cb_Less
+.LMa413:
+.stabn 68,0,98,.LMb413-v4_cb_Less
+.LMb413:
+.LBB72:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L43
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L44
+.L43:
+	xor %rax,%rax
+	call v4__dpush
+.L44:
+.LBE72:
+.stabn 68,0,98,.LM428-v4_cb_Less
+.LM428:
+	ret
+.Lfe72:
+	.size	 v4_cb_Less,.Lfe72-v4_cb_Less
+.stabn	192,0,0,.LBB72-v4_cb_Less
+.stabn	224,0,0,.LBE72-v4_cb_Less
+.Lscope72:
+.stabs	"",36,0,0,.Lscope72-v4_cb_Less
+.text
+	.align 4
+.stabs "v4_cb_Greater:F1",36,0,0,v4_cb_Greater
+.globl v4_cb_Greater
+	.type	v4_cb_Greater,@function
+v4_cb_Greater:
+.stabn 68,0,99,.LMa429-v4_cb_Greater
+.LMa429:
+.stabn 68,0,99,.LMb429-v4_cb_Greater
+.LMb429:
+.LBB74:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L46
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L47
+.L46:
+	xor %rax,%rax
+	call v4__dpush
+.L47:
+.LBE74:
+.stabn 68,0,99,.LM444-v4_cb_Greater
+.LM444:
+	ret
+.Lfe74:
+	.size	 v4_cb_Greater,.Lfe74-v4_cb_Greater
+.stabn	192,0,0,.LBB74-v4_cb_Greater
+.stabn	224,0,0,.LBE74-v4_cb_Greater
+.Lscope74:
+.stabs	"",36,0,0,.Lscope74-v4_cb_Greater
+.text
+	.align 4
+.stabs "v4_cb_Equals:F1",36,0,0,v4_cb_Equals
+.globl v4_cb_Equals
+	.type	v4_cb_Equals,@function
+v4_cb_Equals:
+.stabn 68,0,100,.LMa445-v4_cb_Equals
+.LMa445:
+.stabn 68,0,100,.LMb445-v4_cb_Equals
+.LMb445:
+.LBB76:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jne .L49
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L50
+.L49:
+	xor %rax,%rax
+	call v4__dpush
+.L50:
+.LBE76:
+.stabn 68,0,100,.LM460-v4_cb_Equals
+.LM460:
+	ret
+.Lfe76:
+	.size	 v4_cb_Equals,.Lfe76-v4_cb_Equals
+.stabn	192,0,0,.LBB76-v4_cb_Equals
+.stabn	224,0,0,.LBE76-v4_cb_Equals
+.Lscope76:
+.stabs	"",36,0,0,.Lscope76-v4_cb_Equals
+.text
+	.align 4
+.stabs "v4_cb_Less_Greater:F1",36,0,0,v4_cb_Less_Greater
+.globl v4_cb_Less_Greater
+	.type	v4_cb_Less_Greater,@function
+v4_cb_Less_Greater:
+.stabn 68,0,101,.LMa461-v4_cb_Less_Greater
+.LMa461:
+.stabn 68,0,101,.LMb461-v4_cb_Less_Greater
+.LMb461:
+.LBB78:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	je .L52
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L53
+.L52:
+	xor %rax,%rax
+	call v4__dpush
+.L53:
+.LBE78:
+.stabn 68,0,101,.LM476-v4_cb_Less_Greater
+.LM476:
+	ret
+.Lfe78:
+	.size	 v4_cb_Less_Greater,.Lfe78-v4_cb_Less_Greater
+.stabn	192,0,0,.LBB78-v4_cb_Less_Greater
+.stabn	224,0,0,.LBE78-v4_cb_Less_Greater
+.Lscope78:
+.stabs	"",36,0,0,.Lscope78-v4_cb_Less_Greater
+.text
+	.align 4
+.stabs "v4_cbu_Less:F1",36,0,0,v4_cbu_Less
+.globl v4_cbu_Less
+	.type	v4_cbu_Less,@function
+v4_cbu_Less:
+.stabn 68,0,102,.LMa477-v4_cbu_Less
+.LMa477:
+.stabn 68,0,102,.LMb477-v4_cbu_Less
+.LMb477:
+.LBB80:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jae .L55
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L56
+.L55:
+	xor %rax,%rax
+	call v4__dpush
+.L56:
+.LBE80:
+.stabn 68,0,102,.LM492-v4_cbu_Less
+.LM492:
+	ret
+.Lfe80:
+	.size	 v4_cbu_Less,.Lfe80-v4_cbu_Less
+.stabn	192,0,0,.LBB80-v4_cbu_Less
+.stabn	224,0,0,.LBE80-v4_cbu_Less
+.Lscope80:
+.stabs	"",36,0,0,.Lscope80-v4_cbu_Less
+.text
+	.align 4
+.stabs "v4_cbu_Greater:F1",36,0,0,v4_cbu_Greater
+.globl v4_cbu_Greater
+	.type	v4_cbu_Greater,@function
+v4_cbu_Greater:
+.stabn 68,0,103,.LMa493-v4_cbu_Greater
+.LMa493:
+.stabn 68,0,103,.LMb493-v4_cbu_Greater
+.LMb493:
+.LBB82:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jbe .L58
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L59
+.L58:
+	xor %rax,%rax
+	call v4__dpush
+.L59:
+.LBE82:
+.stabn 68,0,103,.LM508-v4_cbu_Greater
+.LM508:
+	ret
+.Lfe82:
+	.size	 v4_cbu_Greater,.Lfe82-v4_cbu_Greater
+.stabn	192,0,0,.LBB82-v4_cbu_Greater
+.stabn	224,0,0,.LBE82-v4_cbu_Greater
+.Lscope82:
+.stabs	"",36,0,0,.Lscope82-v4_cbu_Greater
+.text
+	.align 4
+.stabs "v4_cbu_Less_Equals:F1",36,0,0,v4_cbu_Less_Equals
+.globl v4_cbu_Less_Equals
+	.type	v4_cbu_Less_Equals,@function
+v4_cbu_Less_Equals:
+.stabn 68,0,104,.LMa509-v4_cbu_Less_Equals
+.LMa509:
+.stabn 68,0,104,.LMb509-v4_cbu_Less_Equals
+.LMb509:
+.LBB84:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	ja .L61
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L62
+.L61:
+	xor %rax,%rax
+	call v4__dpush
+.L62:
+.LBE84:
+.stabn 68,0,104,.LM524-v4_cbu_Less_Equals
+.LM524:
+	ret
+.Lfe84:
+	.size	 v4_cbu_Less_Equals,.Lfe84-v4_cbu_Less_Equals
+.stabn	192,0,0,.LBB84-v4_cbu_Less_Equals
+.stabn	224,0,0,.LBE84-v4_cbu_Less_Equals
+.Lscope84:
+.stabs	"",36,0,0,.Lscope84-v4_cbu_Less_Equals
+.text
+	.align 4
+.stabs "v4_cbu_Greater_Equals:F1",36,0,0,v4_cbu_Greater_Equals
+.globl v4_cbu_Greater_Equals
+	.type	v4_cbu_Greater_Equals,@function
+v4_cbu_Greater_Equals:
+.stabn 68,0,105,.LMa525-v4_cbu_Greater_Equals
+.LMa525:
+.stabn 68,0,105,.LMb525-v4_cbu_Greater_Equals
+.LMb525:
+.LBB86:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jb .L64
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L65
+.L64:
+	xor %rax,%rax
+	call v4__dpush
+.L65:
+.LBE86:
+.stabn 68,0,105,.LM540-v4_cbu_Greater_Equals
+.LM540:
+	ret
+.Lfe86:
+	.size	 v4_cbu_Greater_Equals,.Lfe86-v4_cbu_Greater_Equals
+.stabn	192,0,0,.LBB86-v4_cbu_Greater_Equals
+.stabn	224,0,0,.LBE86-v4_cbu_Greater_Equals
+.Lscope86:
+.stabs	"",36,0,0,.Lscope86-v4_cbu_Greater_Equals
+.text
+	.align 4
+.stabs "v4_cb0_Equals:F1",36,0,0,v4_cb0_Equals
+.globl v4_cb0_Equals
+	.type	v4_cb0_Equals,@function
+v4_cb0_Equals:
+.stabn 68,0,106,.LMa541-v4_cb0_Equals
+.LMa541:
+.stabn 68,0,106,.LMb541-v4_cb0_Equals
+.LMb541:
+.LBB88:
+	call v4__dpop
+	test %rax,%rax
+	jne .L67
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L68
+.L67:
+	xor %rax,%rax
+	call v4__dpush
+.L68:
+.LBE88:
+.stabn 68,0,106,.LM555-v4_cb0_Equals
+.LM555:
+	ret
+.Lfe88:
+	.size	 v4_cb0_Equals,.Lfe88-v4_cb0_Equals
+.stabn	192,0,0,.LBB88-v4_cb0_Equals
+.stabn	224,0,0,.LBE88-v4_cb0_Equals
+.Lscope88:
+.stabs	"",36,0,0,.Lscope88-v4_cb0_Equals
+.text
+	.align 4
+.stabs "v4_cb0_Less:F1",36,0,0,v4_cb0_Less
+.globl v4_cb0_Less
+	.type	v4_cb0_Less,@function
+v4_cb0_Less:
+.stabn 68,0,107,.LMa556-v4_cb0_Less
+.LMa556:
+.stabn 68,0,107,.LMb556-v4_cb0_Less
+.LMb556:
+.LBB89:
+	call v4__dpop
+	test %rax,%rax
+	jge .L70
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L71
+.L70:
+	xor %rax,%rax
+	call v4__dpush
+.L71:
+.LBE89:
+.stabn 68,0,107,.LM570-v4_cb0_Less
+.LM570:
+	ret
+.Lfe89:
+	.size	 v4_cb0_Less,.Lfe89-v4_cb0_Less
+.stabn	192,0,0,.LBB89-v4_cb0_Less
+.stabn	224,0,0,.LBE89-v4_cb0_Less
+.Lscope89:
+.stabs	"",36,0,0,.Lscope89-v4_cb0_Less
+.text
+	.align 4
+.stabs "v4_cb0_Greater:F1",36,0,0,v4_cb0_Greater
+.globl v4_cb0_Greater
+	.type	v4_cb0_Greater,@function
+v4_cb0_Greater:
+.stabn 68,0,108,.LMa571-v4_cb0_Greater
+.LMa571:
+.stabn 68,0,108,.LMb571-v4_cb0_Greater
+.LMb571:
+.LBB90:
+	call v4__dpop
+	test %rax,%rax
+	jle .L73
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L74
+.L73:
+	xor %rax,%rax
+	call v4__dpush
+.L74:
+.LBE90:
+.stabn 68,0,108,.LM585-v4_cb0_Greater
+.LM585:
+	ret
+.Lfe90:
+	.size	 v4_cb0_Greater,.Lfe90-v4_cb0_Greater
+.stabn	192,0,0,.LBB90-v4_cb0_Greater
+.stabn	224,0,0,.LBE90-v4_cb0_Greater
+.Lscope90:
+.stabs	"",36,0,0,.Lscope90-v4_cb0_Greater
+.text
+	.align 4
+.stabs "v4_cb_Less5:F1",36,0,0,v4_cb_Less5
+.globl v4_cb_Less5
+	.type	v4_cb_Less5,@function
+v4_cb_Less5:
+.stabn 68,0,109,.LMa586-v4_cb_Less5
+.LMa586:
+.stabn 68,0,109,.LMb586-v4_cb_Less5
+.LMb586:
+.LBB92:
+	mov $5,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L76
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L77
+.L76:
+	xor %rax,%rax
+	call v4__dpush
+.L77:
+.LBE92:
+.stabn 68,0,109,.LM603-v4_cb_Less5
+.LM603:
+	ret
+.Lfe92:
+	.size	 v4_cb_Less5,.Lfe92-v4_cb_Less5
+.stabn	192,0,0,.LBB92-v4_cb_Less5
+.stabn	224,0,0,.LBE92-v4_cb_Less5
+.Lscope92:
+.stabs	"",36,0,0,.Lscope92-v4_cb_Less5
+.text
+	.align 4
+.stabs "v4_cbwhile:F1",36,0,0,v4_cbwhile
+.globl v4_cbwhile
+	.type	v4_cbwhile,@function
+v4_cbwhile:
+.stabn 68,0,110,.LMa604-v4_cbwhile
+.LMa604:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,110,.LMb604-v4_cbwhile
+.LMb604:
+.LBB93:
+	xor %rax,%rax
+	call v4__dpush
+.L79:
+	call v4_over
+	call v4__dpop
+	test %rax,%rax
+	jle .L80
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	call v4_swap
+	call v4__dpop
+	dec %rax
+	call v4__dpush
+	call v4_swap
+	jmp .L79
+.L80:
+	pop %rbx
+	leave
+	jmp v4_nip
+.LBE93:
+.stabn 68,0,110,.LM628-v4_cbwhile
+.LM628:
+	pop %rbx
+	leave
+	ret
+.Lfe93:
+	.size	 v4_cbwhile,.Lfe93-v4_cbwhile
+.stabn	192,0,0,.LBB93-v4_cbwhile
+.stabn	224,0,0,.LBE93-v4_cbwhile
+.Lscope93:
+.stabs	"",36,0,0,.Lscope93-v4_cbwhile
+.text
+	.align 4
+.stabs "v4_cbuntil:F1",36,0,0,v4_cbuntil
+.globl v4_cbuntil
+	.type	v4_cbuntil,@function
+v4_cbuntil:
+.stabn 68,0,111,.LMa629-v4_cbuntil
+.LMa629:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,111,.LMb629-v4_cbuntil
+.LMb629:
+.LBB95:
+	xor %rax,%rax
+	call v4__dpush
+.L82:
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	call v4_z2dup
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jne .L82
+	pop %rbx
+	leave
+	jmp v4_nip
+.LBE95:
+.stabn 68,0,111,.LM647-v4_cbuntil
+.LM647:
+	pop %rbx
+	leave
+	ret
+.Lfe95:
+	.size	 v4_cbuntil,.Lfe95-v4_cbuntil
+.stabn	192,0,0,.LBB95-v4_cbuntil
+.stabn	224,0,0,.LBE95-v4_cbuntil
+.Lscope95:
+.stabs	"",36,0,0,.Lscope95-v4_cbuntil
+.text
+	.align 4
+.stabs "v4_cbflag:F1",36,0,0,v4_cbflag
+.globl v4_cbflag
+	.type	v4_cbflag,@function
+v4_cbflag:
+.stabn 68,0,112,.LMa648-v4_cbflag
+.LMa648:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,112,.LMb648-v4_cbflag
+.LMb648:
+.LBB96:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	je .L85
+	call v4_drop
+	mov v4_Lesstrue_Greater(%rip),%rax
+	call v4__dpush
+.L85:
+.LBE96:
+.stabn 68,0,112,.LM662-v4_cbflag
+.LM662:
+	pop %rbx
+	leave
+	ret
+.Lfe96:
+	.size	 v4_cbflag,.Lfe96-v4_cbflag
+.stabn	192,0,0,.LBB96-v4_cbflag
+.stabn	224,0,0,.LBE96-v4_cbflag
+.Lscope96:
+.stabs	"",36,0,0,.Lscope96-v4_cbflag
+.text
+	.align 4
+.stabs "v4_dense:F1",36,0,0,v4_dense
+.globl v4_dense
+	.type	v4_dense,@function
+v4_dense:
+.stabn 68,0,154,.LMa663-v4_dense
+.LMa663:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,154,.LMb663-v4_dense
+.LMb663:
+.LBB97:
+	call v4__dpop
+	call v4__dpush
+	cmp $5,%rax
+	ja .L93
+	lea .LT93(%rip),%rdx
+	movslq (%rdx,%rax,4),%rax
+	add %rdx,%rax
+	jmp *%rax
+.section	.rodata
+	.align 4
+.LT93:
+	.long .L361-.LT93
+	.long .L362-.LT93
+	.long .L363-.LT93
+	.long .L364-.LT93
+	.long .L365-.LT93
+	.long .L366-.LT93
+.text
+.L361:
+	mov $10,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L87
+.L88:
+.L362:
+	mov $11,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L87
+.L89:
+.L363:
+	mov $12,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L87
+.L90:
+.L364:
+	mov $13,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L87
+.L91:
+.L365:
+	mov $14,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L87
+.L92:
+.L366:
+	mov $15,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L87
+.L93:
+.stabn 68,0,158,.LM731-v4_dense
+.LM731:
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	call v4_swap
+.L87:
+	call v4__dpop
+.LBE97:
+.stabn 68,0,159,.LM743-v4_dense
+.LM743:
+	pop %rbx
+	leave
+	ret
+.Lfe97:
+	.size	 v4_dense,.Lfe97-v4_dense
+.stabn	192,0,0,.LBB97-v4_dense
+.stabn	224,0,0,.LBE97-v4_dense
+.Lscope97:
+.stabs	"",36,0,0,.Lscope97-v4_dense
+.text
+	.align 4
+.stabs "v4_gapped:F1",36,0,0,v4_gapped
+.globl v4_gapped
+	.type	v4_gapped,@function
+v4_gapped:
+.stabn 68,0,160,.LMa744-v4_gapped
+.LMa744:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,160,.LMb744-v4_gapped
+.LMb744:
+.LBB98:
+	call v4__dpop
+	call v4__dpush
+	sub $-2,%rax
+	cmp $5,%rax
+	ja .L100
+	lea .LT100(%rip),%rdx
+	movslq (%rdx,%rax,4),%rax
+	add %rdx,%rax
+	jmp *%rax
+.section	.rodata
+	.align 4
+.LT100:
+	.long .L367-.LT100
+	.long .L368-.LT100
+	.long .L369-.LT100
+	.long .L100-.LT100
+	.long .L370-.LT100
+	.long .L371-.LT100
+.text
+.L367:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_swap
+	jmp .L95
+.L96:
+.L368:
+	mov $2,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L95
+.L97:
+.L369:
+	mov $3,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L95
+.L98:
+.L370:
+	mov $4,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L95
+.L99:
+.L371:
+	mov $5,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L95
+.L100:
+.stabn 68,0,164,.LM801-v4_gapped
+.LM801:
+	xor %rax,%rax
+	call v4__dpush
+	call v4_swap
+.L95:
+	call v4__dpop
+.LBE98:
+.stabn 68,0,165,.LM807-v4_gapped
+.LM807:
+	pop %rbx
+	leave
+	ret
+.Lfe98:
+	.size	 v4_gapped,.Lfe98-v4_gapped
+.stabn	192,0,0,.LBB98-v4_gapped
+.stabn	224,0,0,.LBE98-v4_gapped
+.Lscope98:
+.stabs	"",36,0,0,.Lscope98-v4_gapped
+.text
+	.align 4
+.stabs "v4_sparse:F1",36,0,0,v4_sparse
+.globl v4_sparse
+	.type	v4_sparse,@function
+v4_sparse:
+.stabn 68,0,166,.LMa808-v4_sparse
+.LMa808:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,166,.LMb808-v4_sparse
+.LMb808:
+.LBB99:
+	call v4__dpop
+	call v4__dpush
+	mov $100,%rdx
+	cmp %rdx,%rax
+	jl .L378
+	mov $100,%rdx
+	cmp %rdx,%rax
+	je .L375
+	mov $1000,%rdx
+	cmp %rdx,%rax
+	je .L376
+	mov $65536,%rdx
+	cmp %rdx,%rax
+	je .L377
+	jmp .L108
+.L378:
+	mov $-1000,%rdx
+	cmp %rdx,%rax
+	je .L372
+	xor %rdx,%rdx
+	dec %rdx
+	cmp %rdx,%rax
+	je .L373
+	mov $7,%rdx
+	cmp %rdx,%rax
+	je .L374
+	jmp .L108
+.L372:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_swap
+	jmp .L102
+.L103:
+.L373:
+	mov $2,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L102
+.L104:
+.L374:
+	mov $3,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L102
+.L105:
+.L375:
+	mov $4,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L102
+.L106:
+.L376:
+	mov $5,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L102
+.L107:
+.L377:
+	mov $6,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L102
+.L108:
+.stabn 68,0,170,.LM892-v4_sparse
+.LM892:
+	xor %rax,%rax
+	call v4__dpush
+	call v4_swap
+.L102:
+	call v4__dpop
+.LBE99:
+.stabn 68,0,171,.LM898-v4_sparse
+.LM898:
+	pop %rbx
+	leave
+	ret
+.Lfe99:
+	.size	 v4_sparse,.Lfe99-v4_sparse
+.stabn	192,0,0,.LBB99-v4_sparse
+.stabn	224,0,0,.LBE99-v4_sparse
+.Lscope99:
+.stabs	"",36,0,0,.Lscope99-v4_sparse
+.text
+	.align 4
+.stabs "v4_nodefault:F1",36,0,0,v4_nodefault
+.globl v4_nodefault
+	.type	v4_nodefault,@function
+v4_nodefault:
+.stabn 68,0,172,.LMa899-v4_nodefault
+.LMa899:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,172,.LMb899-v4_nodefault
+.LMb899:
+.LBB100:
+	call v4__dpop
+	call v4__dpush
+	sub $1,%rax
+	cmp $3,%rax
+	ja .L114
+	lea .LT114(%rip),%rdx
+	movslq (%rdx,%rax,4),%rax
+	add %rdx,%rax
+	jmp *%rax
+.section	.rodata
+	.align 4
+.LT114:
+	.long .L379-.LT114
+	.long .L380-.LT114
+	.long .L381-.LT114
+	.long .L382-.LT114
+.text
+.L379:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_swap
+	jmp .L110
+.L111:
+.L380:
+	mov $2,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L110
+.L112:
+.L381:
+	mov $3,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L110
+.L113:
+.L382:
+	mov $4,%rax
+	call v4__dpush
+	call v4_swap
+.L114:
+.L110:
+	call v4__dpop
+.LBE100:
+.stabn 68,0,176,.LM948-v4_nodefault
+.LM948:
+	pop %rbx
+	leave
+	ret
+.Lfe100:
+	.size	 v4_nodefault,.Lfe100-v4_nodefault
+.stabn	192,0,0,.LBB100-v4_nodefault
+.stabn	224,0,0,.LBE100-v4_nodefault
+.Lscope100:
+.stabs	"",36,0,0,.Lscope100-v4_nodefault
+.text
+	.align 4
+.stabs "v4_Slash1:F1",36,0,0,v4_Slash1
+.globl v4_Slash1
+	.type	v4_Slash1,@function
+v4_Slash1:
+.stabn 68,0,211,.LMa949-v4_Slash1
+.LMa949:
+.stabn 68,0,211,.LMb949-v4_Slash1
+.LMb949:
+.LBB101:
+	call v4__dpop
+	call v4__dpush
+.LBE101:
+.stabn 68,0,211,.LM957-v4_Slash1
+.LM957:
+	ret
+.Lfe101:
+	.size	 v4_Slash1,.Lfe101-v4_Slash1
+.stabn	192,0,0,.LBB101-v4_Slash1
+.stabn	224,0,0,.LBE101-v4_Slash1
+.Lscope101:
+.stabs	"",36,0,0,.Lscope101-v4_Slash1
+.text
+	.align 4
+.stabs "v4_mod1:F1",36,0,0,v4_mod1
+.globl v4_mod1
+	.type	v4_mod1,@function
+v4_mod1:
+.stabn 68,0,211,.LMa958-v4_mod1
+.LMa958:
+.stabn 68,0,211,.LMb958-v4_mod1
+.LMb958:
+.LBB103:
+	call v4__dpop
+	xor %rax,%rax
+	call v4__dpush
+.LBE103:
+.stabn 68,0,211,.LM966-v4_mod1
+.LM966:
+	ret
+.Lfe103:
+	.size	 v4_mod1,.Lfe103-v4_mod1
+.stabn	192,0,0,.LBB103-v4_mod1
+.stabn	224,0,0,.LBE103-v4_mod1
+.Lscope103:
+.stabs	"",36,0,0,.Lscope103-v4_mod1
+.text
+	.align 4
+.stabs "v4_Slash2:F1",36,0,0,v4_Slash2
+.globl v4_Slash2
+	.type	v4_Slash2,@function
+v4_Slash2:
+.stabn 68,0,212,.LMa967-v4_Slash2
+.LMa967:
+.stabn 68,0,212,.LMb967-v4_Slash2
+.LMb967:
+.LBB105:
+	call v4__dpop
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $63,%rdx
+	add %rdx,%rax
+	sar $1,%rax
+	call v4__dpush
+.LBE105:
+.stabn 68,0,212,.LM975-v4_Slash2
+.LM975:
+	ret
+.Lfe105:
+	.size	 v4_Slash2,.Lfe105-v4_Slash2
+.stabn	192,0,0,.LBB105-v4_Slash2
+.stabn	224,0,0,.LBE105-v4_Slash2
+.Lscope105:
+.stabs	"",36,0,0,.Lscope105-v4_Slash2
+.text
+	.align 4
+.stabs "v4_mod2:F1",36,0,0,v4_mod2
+.globl v4_mod2
+	.type	v4_mod2,@function
+v4_mod2:
+.stabn 68,0,212,.LMa976-v4_mod2
+.LMa976:
+.stabn 68,0,212,.LMb976-v4_mod2
+.LMb976:
+.LBB106:
+	call v4__dpop
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $63,%rdx
+	add %rdx,%rax
+	and $1,%rax
+	sub %rdx,%rax
+	call v4__dpush
+.LBE106:
+.stabn 68,0,212,.LM984-v4_mod2
+.LM984:
+	ret
+.Lfe106:
+	.size	 v4_mod2,.Lfe106-v4_mod2
+.stabn	192,0,0,.LBB106-v4_mod2
+.stabn	224,0,0,.LBE106-v4_mod2
+.Lscope106:
+.stabs	"",36,0,0,.Lscope106-v4_mod2
+.text
+	.align 4
+.stabs "v4_Slash3:F1",36,0,0,v4_Slash3
+.globl v4_Slash3
+	.type	v4_Slash3,@function
+v4_Slash3:
+.stabn 68,0,213,.LMa985-v4_Slash3
+.LMa985:
+.stabn 68,0,213,.LMb985-v4_Slash3
+.LMb985:
+.LBB107:
+	call v4__dpop
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	call v4__dpush
+.LBE107:
+.stabn 68,0,213,.LM993-v4_Slash3
+.LM993:
+	ret
+.Lfe107:
+	.size	 v4_Slash3,.Lfe107-v4_Slash3
+.stabn	192,0,0,.LBB107-v4_Slash3
+.stabn	224,0,0,.LBE107-v4_Slash3
+.Lscope107:
+.stabs	"",36,0,0,.Lscope107-v4_Slash3
+.text
+	.align 4
+.stabs "v4_mod3:F1",36,0,0,v4_mod3
+.globl v4_mod3
+	.type	v4_mod3,@function
+v4_mod3:
+.stabn 68,0,213,.LMa994-v4_mod3
+.LMa994:
+.stabn 68,0,213,.LMb994-v4_mod3
+.LMb994:
+.LBB108:
+	call v4__dpop
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	call v4__dpush
+.LBE108:
+.stabn 68,0,213,.LM1002-v4_mod3
+.LM1002:
+	ret
+.Lfe108:
+	.size	 v4_mod3,.Lfe108-v4_mod3
+.stabn	192,0,0,.LBB108-v4_mod3
+.stabn	224,0,0,.LBE108-v4_mod3
+.Lscope108:
+.stabs	"",36,0,0,.Lscope108-v4_mod3
+.text
+	.align 4
+.stabs "v4_Slash_Minus3:F1",36,0,0,v4_Slash_Minus3
+.globl v4_Slash_Minus3
+	.type	v4_Slash_Minus3,@function
+v4_Slash_Minus3:
+.stabn 68,0,214,.LMa1003-v4_Slash_Minus3
+.LMa1003:
+.stabn 68,0,214,.LMb1003-v4_Slash_Minus3
+.LMb1003:
+.LBB109:
+	call v4__dpop
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	neg %rax
+	call v4__dpush
+.LBE109:
+.stabn 68,0,214,.LM1011-v4_Slash_Minus3
+.LM1011:
+	ret
+.Lfe109:
+	.size	 v4_Slash_Minus3,.Lfe109-v4_Slash_Minus3
+.stabn	192,0,0,.LBB109-v4_Slash_Minus3
+.stabn	224,0,0,.LBE109-v4_Slash_Minus3
+.Lscope109:
+.stabs	"",36,0,0,.Lscope109-v4_Slash_Minus3
+.text
+	.align 4
+.stabs "v4_mod_Minus3:F1",36,0,0,v4_mod_Minus3
+.globl v4_mod_Minus3
+	.type	v4_mod_Minus3,@function
+v4_mod_Minus3:
+.stabn 68,0,214,.LMa1012-v4_mod_Minus3
+.LMa1012:
+.stabn 68,0,214,.LMb1012-v4_mod_Minus3
+.LMb1012:
+.LBB110:
+	call v4__dpop
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	call v4__dpush
+.LBE110:
+.stabn 68,0,214,.LM1020-v4_mod_Minus3
+.LM1020:
+	ret
+.Lfe110:
+	.size	 v4_mod_Minus3,.Lfe110-v4_mod_Minus3
+.stabn	192,0,0,.LBB110-v4_mod_Minus3
+.stabn	224,0,0,.LBE110-v4_mod_Minus3
+.Lscope110:
+.stabs	"",36,0,0,.Lscope110-v4_mod_Minus3
+.text
+	.align 4
+.stabs "v4_Slash7:F1",36,0,0,v4_Slash7
+.globl v4_Slash7
+	.type	v4_Slash7,@function
+v4_Slash7:
+.stabn 68,0,215,.LMa1021-v4_Slash7
+.LMa1021:
+.stabn 68,0,215,.LMb1021-v4_Slash7
+.LMb1021:
+.LBB111:
+	call v4__dpop
+	push %rax
+	mov $5270498306774157605,%rdx
+	imul %rdx
+	sar $1,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	call v4__dpush
+.LBE111:
+.stabn 68,0,215,.LM1029-v4_Slash7
+.LM1029:
+	ret
+.Lfe111:
+	.size	 v4_Slash7,.Lfe111-v4_Slash7
+.stabn	192,0,0,.LBB111-v4_Slash7
+.stabn	224,0,0,.LBE111-v4_Slash7
+.Lscope111:
+.stabs	"",36,0,0,.Lscope111-v4_Slash7
+.text
+	.align 4
+.stabs "v4_mod7:F1",36,0,0,v4_mod7
+.globl v4_mod7
+	.type	v4_mod7,@function
+v4_mod7:
+.stabn 68,0,215,.LMa1030-v4_mod7
+.LMa1030:
+.stabn 68,0,215,.LMb1030-v4_mod7
+.LMb1030:
+.LBB112:
+	call v4__dpop
+	push %rax
+	mov $5270498306774157605,%rdx
+	imul %rdx
+	sar $1,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $7,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	call v4__dpush
+.LBE112:
+.stabn 68,0,215,.LM1038-v4_mod7
+.LM1038:
+	ret
+.Lfe112:
+	.size	 v4_mod7,.Lfe112-v4_mod7
+.stabn	192,0,0,.LBB112-v4_mod7
+.stabn	224,0,0,.LBE112-v4_mod7
+.Lscope112:
+.stabs	"",36,0,0,.Lscope112-v4_mod7
+.text
+	.align 4
+.stabs "v4_Slash8:F1",36,0,0,v4_Slash8
+.globl v4_Slash8
+	.type	v4_Slash8,@function
+v4_Slash8:
+.stabn 68,0,216,.LMa1039-v4_Slash8
+.LMa1039:
+.stabn 68,0,216,.LMb1039-v4_Slash8
+.LMb1039:
+.LBB113:
+	call v4__dpop
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $61,%rdx
+	add %rdx,%rax
+	sar $3,%rax
+	call v4__dpush
+.LBE113:
+.stabn 68,0,216,.LM1047-v4_Slash8
+.LM1047:
+	ret
+.Lfe113:
+	.size	 v4_Slash8,.Lfe113-v4_Slash8
+.stabn	192,0,0,.LBB113-v4_Slash8
+.stabn	224,0,0,.LBE113-v4_Slash8
+.Lscope113:
+.stabs	"",36,0,0,.Lscope113-v4_Slash8
+.text
+	.align 4
+.stabs "v4_mod8:F1",36,0,0,v4_mod8
+.globl v4_mod8
+	.type	v4_mod8,@function
+v4_mod8:
+.stabn 68,0,216,.LMa1048-v4_mod8
+.LMa1048:
+.stabn 68,0,216,.LMb1048-v4_mod8
+.LMb1048:
+.LBB114:
+	call v4__dpop
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $61,%rdx
+	add %rdx,%rax
+	and $7,%rax
+	sub %rdx,%rax
+	call v4__dpush
+.LBE114:
+.stabn 68,0,216,.LM1056-v4_mod8
+.LM1056:
+	ret
+.Lfe114:
+	.size	 v4_mod8,.Lfe114-v4_mod8
+.stabn	192,0,0,.LBB114-v4_mod8
+.stabn	224,0,0,.LBE114-v4_mod8
+.Lscope114:
+.stabs	"",36,0,0,.Lscope114-v4_mod8
+.text
+	.align 4
+.stabs "v4_Slash_Minus8:F1",36,0,0,v4_Slash_Minus8
+.globl v4_Slash_Minus8
+	.type	v4_Slash_Minus8,@function
+v4_Slash_Minus8:
+.stabn 68,0,217,.LMa1057-v4_Slash_Minus8
+.LMa1057:
+.stabn 68,0,217,.LMb1057-v4_Slash_Minus8
+.LMb1057:
+.LBB115:
+	call v4__dpop
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $61,%rdx
+	add %rdx,%rax
+	sar $3,%rax
+	neg %rax
+	call v4__dpush
+.LBE115:
+.stabn 68,0,217,.LM1065-v4_Slash_Minus8
+.LM1065:
+	ret
+.Lfe115:
+	.size	 v4_Slash_Minus8,.Lfe115-v4_Slash_Minus8
+.stabn	192,0,0,.LBB115-v4_Slash_Minus8
+.stabn	224,0,0,.LBE115-v4_Slash_Minus8
+.Lscope115:
+.stabs	"",36,0,0,.Lscope115-v4_Slash_Minus8
+.text
+	.align 4
+.stabs "v4_mod_Minus8:F1",36,0,0,v4_mod_Minus8
+.globl v4_mod_Minus8
+	.type	v4_mod_Minus8,@function
+v4_mod_Minus8:
+.stabn 68,0,217,.LMa1066-v4_mod_Minus8
+.LMa1066:
+.stabn 68,0,217,.LMb1066-v4_mod_Minus8
+.LMb1066:
+.LBB116:
+	call v4__dpop
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $61,%rdx
+	add %rdx,%rax
+	and $7,%rax
+	sub %rdx,%rax
+	call v4__dpush
+.LBE116:
+.stabn 68,0,217,.LM1074-v4_mod_Minus8
+.LM1074:
+	ret
+.Lfe116:
+	.size	 v4_mod_Minus8,.Lfe116-v4_mod_Minus8
+.stabn	192,0,0,.LBB116-v4_mod_Minus8
+.stabn	224,0,0,.LBE116-v4_mod_Minus8
+.Lscope116:
+.stabs	"",36,0,0,.Lscope116-v4_mod_Minus8
+.text
+	.align 4
+.stabs "v4_Slash10:F1",36,0,0,v4_Slash10
+.globl v4_Slash10
+	.type	v4_Slash10,@function
+v4_Slash10:
+.stabn 68,0,218,.LMa1075-v4_Slash10
+.LMa1075:
+.stabn 68,0,218,.LMb1075-v4_Slash10
+.LMb1075:
+.LBB117:
+	call v4__dpop
+	push %rax
+	mov $7378697629483820647,%rdx
+	imul %rdx
+	sar $2,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	call v4__dpush
+.LBE117:
+.stabn 68,0,218,.LM1083-v4_Slash10
+.LM1083:
+	ret
+.Lfe117:
+	.size	 v4_Slash10,.Lfe117-v4_Slash10
+.stabn	192,0,0,.LBB117-v4_Slash10
+.stabn	224,0,0,.LBE117-v4_Slash10
+.Lscope117:
+.stabs	"",36,0,0,.Lscope117-v4_Slash10
+.text
+	.align 4
+.stabs "v4_mod10:F1",36,0,0,v4_mod10
+.globl v4_mod10
+	.type	v4_mod10,@function
+v4_mod10:
+.stabn 68,0,218,.LMa1084-v4_mod10
+.LMa1084:
+.stabn 68,0,218,.LMb1084-v4_mod10
+.LMb1084:
+.LBB118:
+	call v4__dpop
+	push %rax
+	mov $7378697629483820647,%rdx
+	imul %rdx
+	sar $2,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $10,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	call v4__dpush
+.LBE118:
+.stabn 68,0,218,.LM1092-v4_mod10
+.LM1092:
+	ret
+.Lfe118:
+	.size	 v4_mod10,.Lfe118-v4_mod10
+.stabn	192,0,0,.LBB118-v4_mod10
+.stabn	224,0,0,.LBE118-v4_mod10
+.Lscope118:
+.stabs	"",36,0,0,.Lscope118-v4_mod10
+.text
+	.align 4
+.stabs "v4_Slash_Minus10:F1",36,0,0,v4_Slash_Minus10
+.globl v4_Slash_Minus10
+	.type	v4_Slash_Minus10,@function
+v4_Slash_Minus10:
+.stabn 68,0,219,.LMa1093-v4_Slash_Minus10
+.LMa1093:
+.stabn 68,0,219,.LMb1093-v4_Slash_Minus10
+.LMb1093:
+.LBB119:
+	call v4__dpop
+	push %rax
+	mov $7378697629483820647,%rdx
+	imul %rdx
+	sar $2,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	neg %rax
+	call v4__dpush
+.LBE119:
+.stabn 68,0,219,.LM1101-v4_Slash_Minus10
+.LM1101:
+	ret
+.Lfe119:
+	.size	 v4_Slash_Minus10,.Lfe119-v4_Slash_Minus10
+.stabn	192,0,0,.LBB119-v4_Slash_Minus10
+.stabn	224,0,0,.LBE119-v4_Slash_Minus10
+.Lscope119:
+.stabs	"",36,0,0,.Lscope119-v4_Slash_Minus10
+.text
+	.align 4
+.stabs "v4_mod_Minus10:F1",36,0,0,v4_mod_Minus10
+.globl v4_mod_Minus10
+	.type	v4_mod_Minus10,@function
+v4_mod_Minus10:
+.stabn 68,0,219,.LMa1102-v4_mod_Minus10
+.LMa1102:
+.stabn 68,0,219,.LMb1102-v4_mod_Minus10
+.LMb1102:
+.LBB120:
+	call v4__dpop
+	push %rax
+	mov $7378697629483820647,%rdx
+	imul %rdx
+	sar $2,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $10,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	call v4__dpush
+.LBE120:
+.stabn 68,0,219,.LM1110-v4_mod_Minus10
+.LM1110:
+	ret
+.Lfe120:
+	.size	 v4_mod_Minus10,.Lfe120-v4_mod_Minus10
+.stabn	192,0,0,.LBB120-v4_mod_Minus10
+.stabn	224,0,0,.LBE120-v4_mod_Minus10
+.Lscope120:
+.stabs	"",36,0,0,.Lscope120-v4_mod_Minus10
+.text
+	.align 4
+.stabs "v4_Slash_Minus1:F1",36,0,0,v4_Slash_Minus1
+.globl v4_Slash_Minus1
+	.type	v4_Slash_Minus1,@function
+v4_Slash_Minus1:
+.stabn 68,0,220,.LMa1111-v4_Slash_Minus1
+.LMa1111:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,220,.LMb1111-v4_Slash_Minus1
+.LMb1111:
+.LBB121:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	pop %rbx
+	leave
+	jmp v4_Slash
+.LBE121:
+.stabn 68,0,220,.LM1116-v4_Slash_Minus1
+.LM1116:
+	pop %rbx
+	leave
+	ret
+.Lfe121:
+	.size	 v4_Slash_Minus1,.Lfe121-v4_Slash_Minus1
+.stabn	192,0,0,.LBB121-v4_Slash_Minus1
+.stabn	224,0,0,.LBE121-v4_Slash_Minus1
+.Lscope121:
+.stabs	"",36,0,0,.Lscope121-v4_Slash_Minus1
+.text
+	.align 4
+.stabs "v4_mod_Minus1:F1",36,0,0,v4_mod_Minus1
+.globl v4_mod_Minus1
+	.type	v4_mod_Minus1,@function
+v4_mod_Minus1:
+.stabn 68,0,220,.LMa1117-v4_mod_Minus1
+.LMa1117:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,220,.LMb1117-v4_mod_Minus1
+.LMb1117:
+.LBB122:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	pop %rbx
+	leave
+	jmp v4_mod
+.LBE122:
+.stabn 68,0,220,.LM1122-v4_mod_Minus1
+.LM1122:
+	pop %rbx
+	leave
+	ret
+.Lfe122:
+	.size	 v4_mod_Minus1,.Lfe122-v4_mod_Minus1
+.stabn	192,0,0,.LBB122-v4_mod_Minus1
+.stabn	224,0,0,.LBE122-v4_mod_Minus1
+.Lscope122:
+.stabs	"",36,0,0,.Lscope122-v4_mod_Minus1
+.text
+	.align 4
+.stabs "v4_Star0:F1",36,0,0,v4_Star0
+.globl v4_Star0
+	.type	v4_Star0,@function
+v4_Star0:
+.stabn 68,0,221,.LMa1123-v4_Star0
+.LMa1123:
+.stabn 68,0,221,.LMb1123-v4_Star0
+.LMb1123:
+.LBB123:
+	call v4__dpop
+	xor %rax,%rax
+	call v4__dpush
+.LBE123:
+.stabn 68,0,221,.LM1131-v4_Star0
+.LM1131:
+	ret
+.Lfe123:
+	.size	 v4_Star0,.Lfe123-v4_Star0
+.stabn	192,0,0,.LBB123-v4_Star0
+.stabn	224,0,0,.LBE123-v4_Star0
+.Lscope123:
+.stabs	"",36,0,0,.Lscope123-v4_Star0
+.text
+	.align 4
+.stabs "v4_Star1:F1",36,0,0,v4_Star1
+.globl v4_Star1
+	.type	v4_Star1,@function
+v4_Star1:
+.stabn 68,0,221,.LMa1132-v4_Star1
+.LMa1132:
+.stabn 68,0,221,.LMb1132-v4_Star1
+.LMb1132:
+.LBB124:
+	call v4__dpop
+	call v4__dpush
+.LBE124:
+.stabn 68,0,221,.LM1140-v4_Star1
+.LM1140:
+	ret
+.Lfe124:
+	.size	 v4_Star1,.Lfe124-v4_Star1
+.stabn	192,0,0,.LBB124-v4_Star1
+.stabn	224,0,0,.LBE124-v4_Star1
+.Lscope124:
+.stabs	"",36,0,0,.Lscope124-v4_Star1
+.text
+	.align 4
+.stabs "v4_Star_Minus1:F1",36,0,0,v4_Star_Minus1
+.globl v4_Star_Minus1
+	.type	v4_Star_Minus1,@function
+v4_Star_Minus1:
+.stabn 68,0,221,.LMa1141-v4_Star_Minus1
+.LMa1141:
+.stabn 68,0,221,.LMb1141-v4_Star_Minus1
+.LMb1141:
+.LBB125:
+	call v4__dpop
+	neg %rax
+	call v4__dpush
+.LBE125:
+.stabn 68,0,221,.LM1149-v4_Star_Minus1
+.LM1149:
+	ret
+.Lfe125:
+	.size	 v4_Star_Minus1,.Lfe125-v4_Star_Minus1
+.stabn	192,0,0,.LBB125-v4_Star_Minus1
+.stabn	224,0,0,.LBE125-v4_Star_Minus1
+.Lscope125:
+.stabs	"",36,0,0,.Lscope125-v4_Star_Minus1
+.text
+	.align 4
+.stabs "v4_Star3:F1",36,0,0,v4_Star3
+.globl v4_Star3
+	.type	v4_Star3,@function
+v4_Star3:
+.stabn 68,0,221,.LMa1150-v4_Star3
+.LMa1150:
+.stabn 68,0,221,.LMb1150-v4_Star3
+.LMb1150:
+.LBB126:
+	call v4__dpop
+	lea (%rax,%rax,2),%rax
+	call v4__dpush
+.LBE126:
+.stabn 68,0,221,.LM1158-v4_Star3
+.LM1158:
+	ret
+.Lfe126:
+	.size	 v4_Star3,.Lfe126-v4_Star3
+.stabn	192,0,0,.LBB126-v4_Star3
+.stabn	224,0,0,.LBE126-v4_Star3
+.Lscope126:
+.stabs	"",36,0,0,.Lscope126-v4_Star3
+.text
+	.align 4
+.stabs "v4_Star8:F1",36,0,0,v4_Star8
+.globl v4_Star8
+	.type	v4_Star8,@function
+v4_Star8:
+.stabn 68,0,222,.LMa1159-v4_Star8
+.LMa1159:
+.stabn 68,0,222,.LMb1159-v4_Star8
+.LMb1159:
+.LBB127:
+	call v4__dpop
+	shl $3,%rax
+	call v4__dpush
+.LBE127:
+.stabn 68,0,222,.LM1167-v4_Star8
+.LM1167:
+	ret
+.Lfe127:
+	.size	 v4_Star8,.Lfe127-v4_Star8
+.stabn	192,0,0,.LBB127-v4_Star8
+.stabn	224,0,0,.LBE127-v4_Star8
+.Lscope127:
+.stabs	"",36,0,0,.Lscope127-v4_Star8
+.text
+	.align 4
+.stabs "v4_Star_Minus8:F1",36,0,0,v4_Star_Minus8
+.globl v4_Star_Minus8
+	.type	v4_Star_Minus8,@function
+v4_Star_Minus8:
+.stabn 68,0,222,.LMa1168-v4_Star_Minus8
+.LMa1168:
+.stabn 68,0,222,.LMb1168-v4_Star_Minus8
+.LMb1168:
+.LBB128:
+	call v4__dpop
+	imul $-8,%rax,%rax
+	call v4__dpush
+.LBE128:
+.stabn 68,0,222,.LM1176-v4_Star_Minus8
+.LM1176:
+	ret
+.Lfe128:
+	.size	 v4_Star_Minus8,.Lfe128-v4_Star_Minus8
+.stabn	192,0,0,.LBB128-v4_Star_Minus8
+.stabn	224,0,0,.LBE128-v4_Star_Minus8
+.Lscope128:
+.stabs	"",36,0,0,.Lscope128-v4_Star_Minus8
+.text
+	.align 4
+.stabs "v4_Star10:F1",36,0,0,v4_Star10
+.globl v4_Star10
+	.type	v4_Star10,@function
+v4_Star10:
+.stabn 68,0,222,.LMa1177-v4_Star10
+.LMa1177:
+.stabn 68,0,222,.LMb1177-v4_Star10
+.LMb1177:
+.LBB129:
+	call v4__dpop
+	lea (%rax,%rax,4),%rax
+	add %rax,%rax
+	call v4__dpush
+.LBE129:
+.stabn 68,0,222,.LM1185-v4_Star10
+.LM1185:
+	ret
+.Lfe129:
+	.size	 v4_Star10,.Lfe129-v4_Star10
+.stabn	192,0,0,.LBB129-v4_Star10
+.stabn	224,0,0,.LBE129-v4_Star10
+.Lscope129:
+.stabs	"",36,0,0,.Lscope129-v4_Star10
+.text
+	.align 4
+.stabs "v4_Star_Minus7:F1",36,0,0,v4_Star_Minus7
+.globl v4_Star_Minus7
+	.type	v4_Star_Minus7,@function
+v4_Star_Minus7:
+.stabn 68,0,222,.LMa1186-v4_Star_Minus7
+.LMa1186:
+.stabn 68,0,222,.LMb1186-v4_Star_Minus7
+.LMb1186:
+.LBB130:
+	call v4__dpop
+	imul $-7,%rax,%rax
+	call v4__dpush
+.LBE130:
+.stabn 68,0,222,.LM1194-v4_Star_Minus7
+.LM1194:
+	ret
+.Lfe130:
+	.size	 v4_Star_Minus7,.Lfe130-v4_Star_Minus7
+.stabn	192,0,0,.LBB130-v4_Star_Minus7
+.stabn	224,0,0,.LBE130-v4_Star_Minus7
+.Lscope130:
+.stabs	"",36,0,0,.Lscope130-v4_Star_Minus7
+.text
+	.align 4
+.stabs "v4_ncells:F1",36,0,0,v4_ncells
+.globl v4_ncells
+	.type	v4_ncells,@function
+v4_ncells:
+.stabn 68,0,223,.LMa1195-v4_ncells
+.LMa1195:
+.stabn 68,0,223,.LMb1195-v4_ncells
+.LMb1195:
+.LBB131:
+	call v4__dpop
+	shl $3,%rax
+	call v4__dpush
+.LBE131:
+.stabn 68,0,223,.LM1201-v4_ncells
+.LM1201:
+	ret
+.Lfe131:
+	.size	 v4_ncells,.Lfe131-v4_ncells
+.stabn	192,0,0,.LBB131-v4_ncells
+.stabn	224,0,0,.LBE131-v4_ncells
+.Lscope131:
+.stabs	"",36,0,0,.Lscope131-v4_ncells
+.text
+	.align 4
+.stabs "v4_dividend_Comma:F1",36,0,0,v4_dividend_Comma
+.globl v4_dividend_Comma
+	.type	v4_dividend_Comma,@function
+v4_dividend_Comma:
+.stabn 68,0,230,.LMa1202-v4_dividend_Comma
+.LMa1202:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,230,.LMb1202-v4_dividend_Comma
+.LMb1202:
+.LBB134:
+	lea v4_dividends(%rip),%rax
+	mov %rax,%rcx
+	mov v4_Hashdividends(%rip),%rax
+	shl $3,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	call v4__dpush
+	call v4_Store
+	xor %rax,%rax
+	inc %rax
+	mov v4_Hashdividends(%rip),%rdx
+	add %rdx,%rax
+	mov %rax,v4_Hashdividends(%rip)
+.LBE134:
+.stabn 68,0,230,.LM1230-v4_dividend_Comma
+.LM1230:
+	pop %rbx
+	leave
+	ret
+.Lfe134:
+	.size	 v4_dividend_Comma,.Lfe134-v4_dividend_Comma
+.stabn	192,0,0,.LBB134-v4_dividend_Comma
+.stabn	224,0,0,.LBE134-v4_dividend_Comma
+.Lscope134:
+.stabs	"",36,0,0,.Lscope134-v4_dividend_Comma
+.text
+	.align 4
+.stabs "v4_dividend:F1",36,0,0,v4_dividend
+.globl v4_dividend
+	.type	v4_dividend,@function
+v4_dividend:
+.stabn 68,0,231,.LMa1231-v4_dividend
+.LMa1231:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,231,.LMb1231-v4_dividend
+.LMb1231:
+.LBB136:
+	call v4__dpop
+	shl $3,%rax
+	mov %rax,%rcx
+	lea v4_dividends(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	call v4__dpush
+	pop %rbx
+	leave
+	jmp v4_Fetch
+.LBE136:
+.stabn 68,0,231,.LM1245-v4_dividend
+.LM1245:
+	pop %rbx
+	leave
+	ret
+.Lfe136:
+	.size	 v4_dividend,.Lfe136-v4_dividend
+.stabn	192,0,0,.LBB136-v4_dividend
+.stabn	224,0,0,.LBE136-v4_dividend
+.Lscope136:
+.stabs	"",36,0,0,.Lscope136-v4_dividend
+.text
+	.align 4
+.stabs "v4_mismatches:F1",36,0,0,v4_mismatches
+.globl v4_mismatches
+	.type	v4_mismatches,@function
+v4_mismatches:
+.stabn 68,0,232,.LMa1246-v4_mismatches
+.LMa1246:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,232,.LMb1246-v4_mismatches
+.LMb1246:
+.LBB137:
+.stabn 68,0,233,.LM1247-v4_mismatches
+.LM1247:
+	xor %rax,%rax
+	call v4__dpush
+	mov v4_Hashdividends(%rip),%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L148:
+.stabn 68,0,234,.LM1261-v4_mismatches
+.LM1261:
+	call v4_i
+	call v4__dpop
+	shl $3,%rax
+	mov %rax,%rcx
+	lea v4_dividends(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	call v4__dpush
+	call v4_Fetch
+.stabn 68,0,234,.LM1275-v4_mismatches
+.LM1275:
+	mov $4,%rax
+	call v4__dpush
+	call v4_pick
+	call v4_execute
+.stabn 68,0,235,.LM1279-v4_mismatches
+.LM1279:
+	call v4_i
+	call v4__dpop
+	shl $3,%rax
+	mov %rax,%rcx
+	lea v4_dividends(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	call v4__dpush
+	call v4_Fetch
+.stabn 68,0,235,.LM1293-v4_mismatches
+.LM1293:
+	mov $4,%rax
+	call v4__dpush
+	call v4_pick
+	mov $4,%rax
+	call v4__dpush
+	call v4_pick
+	call v4_execute
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	je .L150
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+.L150:
+.stabn 68,0,237,.LM1311-v4_mismatches
+.LM1311:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L148
+	call v4__rpop
+	call v4__rpop
+	call v4_nip
+	call v4_nip
+	pop %rbx
+	leave
+	jmp v4_nip
+.LBE137:
+.stabn 68,0,237,.LM1326-v4_mismatches
+.LM1326:
+	pop %rbx
+	leave
+	ret
+.Lfe137:
+	.size	 v4_mismatches,.Lfe137-v4_mismatches
+.stabn	192,0,0,.LBB137-v4_mismatches
+.stabn	224,0,0,.LBE137-v4_mismatches
+.Lscope137:
+.stabs	"",36,0,0,.Lscope137-v4_mismatches
+.text
+	.align 4
+.stabs "v4_use_Minushundred:F1",36,0,0,v4_use_Minushundred
+.globl v4_use_Minushundred
+	.type	v4_use_Minushundred,@function
+v4_use_Minushundred:
+.stabn 68,0,297,.LMa1327-v4_use_Minushundred
+.LMa1327:
+.stabn 68,0,297,.LMb1327-v4_use_Minushundred
+.LMb1327:
+.LBB144:
+	mov $200,%rax
+	call v4__dpush
+.LBE144:
+.stabn 68,0,297,.LM1332-v4_use_Minushundred
+.LM1332:
+	ret
+.Lfe144:
+	.size	 v4_use_Minushundred,.Lfe144-v4_use_Minushundred
+.stabn	192,0,0,.LBB144-v4_use_Minushundred
+.stabn	224,0,0,.LBE144-v4_use_Minushundred
+.Lscope144:
+.stabs	"",36,0,0,.Lscope144-v4_use_Minushundred
+.text
+	.align 4
+.stabs "v4_use_Minusminus_Minusone:F1",36,0,0,v4_use_Minusminus_Minusone
+.globl v4_use_Minusminus_Minusone
+	.type	v4_use_Minusminus_Minusone,@function
+v4_use_Minusminus_Minusone:
+.stabn 68,0,298,.LMa1333-v4_use_Minusminus_Minusone
+.LMa1333:
+.stabn 68,0,298,.LMb1333-v4_use_Minusminus_Minusone
+.LMb1333:
+.LBB145:
+	mov $4,%rax
+	call v4__dpush
+.LBE145:
+.stabn 68,0,298,.LM1340-v4_use_Minusminus_Minusone
+.LM1340:
+	ret
+.Lfe145:
+	.size	 v4_use_Minusminus_Minusone,.Lfe145-v4_use_Minusminus_Minusone
+.stabn	192,0,0,.LBB145-v4_use_Minusminus_Minusone
+.stabn	224,0,0,.LBE145-v4_use_Minusminus_Minusone
+.Lscope145:
+.stabs	"",36,0,0,.Lscope145-v4_use_Minusminus_Minusone
+.text
+	.align 4
+.stabs "v4_use_Minusbiggest:F1",36,0,0,v4_use_Minusbiggest
+.globl v4_use_Minusbiggest
+	.type	v4_use_Minusbiggest,@function
+v4_use_Minusbiggest:
+.stabn 68,0,299,.LMa1341-v4_use_Minusbiggest
+.LMa1341:
+.stabn 68,0,299,.LMb1341-v4_use_Minusbiggest
+.LMb1341:
+.LBB146:
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+.LBE146:
+.stabn 68,0,299,.LM1346-v4_use_Minusbiggest
+.LM1346:
+	ret
+.Lfe146:
+	.size	 v4_use_Minusbiggest,.Lfe146-v4_use_Minusbiggest
+.stabn	192,0,0,.LBB146-v4_use_Minusbiggest
+.stabn	224,0,0,.LBE146-v4_use_Minusbiggest
+.Lscope146:
+.stabs	"",36,0,0,.Lscope146-v4_use_Minusbiggest
+.text
+	.align 4
+.stabs "v4_use_Minusthree_Minushundred:F1",36,0,0,v4_use_Minusthree_Minushundred
+.globl v4_use_Minusthree_Minushundred
+	.type	v4_use_Minusthree_Minushundred,@function
+v4_use_Minusthree_Minushundred:
+.stabn 68,0,300,.LMa1347-v4_use_Minusthree_Minushundred
+.LMa1347:
+.stabn 68,0,300,.LMb1347-v4_use_Minusthree_Minushundred
+.LMb1347:
+.LBB147:
+	mov $301,%rax
+	call v4__dpush
+.LBE147:
+.stabn 68,0,300,.LM1352-v4_use_Minusthree_Minushundred
+.LM1352:
+	ret
+.Lfe147:
+	.size	 v4_use_Minusthree_Minushundred,.Lfe147-v4_use_Minusthree_Minushundred
+.stabn	192,0,0,.LBB147-v4_use_Minusthree_Minushundred
+.stabn	224,0,0,.LBE147-v4_use_Minusthree_Minushundred
+.Lscope147:
+.stabs	"",36,0,0,.Lscope147-v4_use_Minusthree_Minushundred
+.text
+	.align 4
+.stabs "v4_use_Minuszero:F1",36,0,0,v4_use_Minuszero
+.globl v4_use_Minuszero
+	.type	v4_use_Minuszero,@function
+v4_use_Minuszero:
+.stabn 68,0,301,.LMa1353-v4_use_Minuszero
+.LMa1353:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,301,.LMb1353-v4_use_Minuszero
+.LMb1353:
+.LBB148:
+	xor %rax,%rax
+	call v4__dpush
+	pop %rbx
+	leave
+	jmp v4_Slash
+.LBE148:
+.stabn 68,0,301,.LM1358-v4_use_Minuszero
+.LM1358:
+	pop %rbx
+	leave
+	ret
+.Lfe148:
+	.size	 v4_use_Minuszero,.Lfe148-v4_use_Minuszero
+.stabn	192,0,0,.LBB148-v4_use_Minuszero
+.stabn	224,0,0,.LBE148-v4_use_Minuszero
+.Lscope148:
+.stabs	"",36,0,0,.Lscope148-v4_use_Minuszero
+.text
+	.align 4
+.stabs "v4_use_Minusin_Minuscase:F1",36,0,0,v4_use_Minusin_Minuscase
+.globl v4_use_Minusin_Minuscase
+	.type	v4_use_Minusin_Minuscase,@function
+v4_use_Minusin_Minuscase:
+.stabn 68,0,302,.LMa1359-v4_use_Minusin_Minuscase
+.LMa1359:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,302,.LMb1359-v4_use_Minusin_Minuscase
+.LMb1359:
+.LBB149:
+.stabn 68,0,304,.LM1360-v4_use_Minusin_Minuscase
+.LM1360:
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	call v4__dpush
+	cmp %rax,%rdx
+	jne .L158
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_swap
+	jmp .L157
+.L158:
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	call v4__dpush
+	cmp %rax,%rdx
+	jne .L159
+	mov $2,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L157
+.L159:
+.stabn 68,0,305,.LM1382-v4_use_Minusin_Minuscase
+.LM1382:
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	call v4__dpop
+	call v4__dpush
+	cmp %rax,%rdx
+	jne .L160
+	mov $3,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L157
+.L160:
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	call v4__dpush
+	cmp %rax,%rdx
+	jne .L161
+	mov $4,%rax
+	call v4__dpush
+	call v4_swap
+	jmp .L157
+.L161:
+.stabn 68,0,306,.LM1404-v4_use_Minusin_Minuscase
+.LM1404:
+	xor %rax,%rax
+	call v4__dpush
+	call v4_swap
+.L157:
+	call v4__dpop
+.LBE149:
+.stabn 68,0,307,.LM1410-v4_use_Minusin_Minuscase
+.LM1410:
+	pop %rbx
+	leave
+	ret
+.Lfe149:
+	.size	 v4_use_Minusin_Minuscase,.Lfe149-v4_use_Minusin_Minuscase
+.stabn	192,0,0,.LBB149-v4_use_Minusin_Minuscase
+.stabn	224,0,0,.LBE149-v4_use_Minusin_Minuscase
+.Lscope149:
+.stabs	"",36,0,0,.Lscope149-v4_use_Minusin_Minuscase
+.text
+	.align 4
+.stabs "v4_clamp:F1",36,0,0,v4_clamp
+.globl v4_clamp
+	.type	v4_clamp,@function
+v4_clamp:
+.stabn 68,0,324,.LMa1411-v4_clamp
+.LMa1411:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,324,.LMb1411-v4_clamp
+.LMb1411:
+.LBB151:
+.stabn 68,0,325,.LM1412-v4_clamp
+.LM1412:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L163
+	call v4_drop
+	xor %rax,%rax
+	call v4__dpush
+	jmp .L162
+.L163:
+.stabn 68,0,326,.LM1423-v4_clamp
+.LM1423:
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L164
+	call v4_drop
+	mov $100,%rax
+	call v4__dpush
+.L164:
+.L162:
+.LBE151:
+.stabn 68,0,326,.LM1438-v4_clamp
+.LM1438:
+	pop %rbx
+	leave
+	ret
+.Lfe151:
+	.size	 v4_clamp,.Lfe151-v4_clamp
+.stabn	192,0,0,.LBB151-v4_clamp
+.stabn	224,0,0,.LBE151-v4_clamp
+.Lscope151:
+.stabs	"",36,0,0,.Lscope151-v4_clamp
+.text
+	.align 4
+.stabs "v4_sign:F1",36,0,0,v4_sign
+.globl v4_sign
+	.type	v4_sign,@function
+v4_sign:
+.stabn 68,0,327,.LMa1439-v4_sign
+.LMa1439:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,327,.LMb1439-v4_sign
+.LMb1439:
+.LBB152:
+.stabn 68,0,328,.LM1440-v4_sign
+.LM1440:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L166
+	call v4_drop
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	jmp .L167
+.L166:
+	call v4__dpop
+	test %rax,%rax
+	jle .L168
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L169
+.L168:
+	xor %rax,%rax
+	call v4__dpush
+.L169:
+.L167:
+.LBE152:
+.stabn 68,0,328,.LM1465-v4_sign
+.LM1465:
+	pop %rbx
+	leave
+	ret
+.Lfe152:
+	.size	 v4_sign,.Lfe152-v4_sign
+.stabn	192,0,0,.LBB152-v4_sign
+.stabn	224,0,0,.LBE152-v4_sign
+.Lscope152:
+.stabs	"",36,0,0,.Lscope152-v4_sign
+.text
+	.align 4
+.stabs "v4_twice:F1",36,0,0,v4_twice
+.globl v4_twice
+	.type	v4_twice,@function
+v4_twice:
+.stabn 68,0,329,.LMa1466-v4_twice
+.LMa1466:
+.stabn 68,0,329,.LMb1466-v4_twice
+.LMb1466:
+.LBB153:
+	call v4__dpop
+	add %rax,%rax
+	call v4__dpush
+.LBE153:
+.stabn 68,0,329,.LM1472-v4_twice
+.LM1472:
+	ret
+.Lfe153:
+	.size	 v4_twice,.Lfe153-v4_twice
+.stabn	192,0,0,.LBB153-v4_twice
+.stabn	224,0,0,.LBE153-v4_twice
+.Lscope153:
+.stabs	"",36,0,0,.Lscope153-v4_twice
+.text
+	.align 4
+.stabs "v4_get_Minusi:F1",36,0,0,v4_get_Minusi
+.globl v4_get_Minusi
+	.type	v4_get_Minusi,@function
+v4_get_Minusi:
+.stabn 68,0,330,.LMa1473-v4_get_Minusi
+.LMa1473:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,330,.LMb1473-v4_get_Minusi
+.LMb1473:
+.LBB154:
+	pop %rbx
+	leave
+	jmp v4_i
+.LBE154:
+.stabn 68,0,330,.LM1476-v4_get_Minusi
+.LM1476:
+	pop %rbx
+	leave
+	ret
+.Lfe154:
+	.size	 v4_get_Minusi,.Lfe154-v4_get_Minusi
+.stabn	192,0,0,.LBB154-v4_get_Minusi
+.stabn	224,0,0,.LBE154-v4_get_Minusi
+.Lscope154:
+.stabs	"",36,0,0,.Lscope154-v4_get_Minusi
+.text
+	.align 4
+.stabs "v4_get_Minusi_Minusnoinline:F1",36,0,0,v4_get_Minusi_Minusnoinline
+.globl v4_get_Minusi_Minusnoinline
+	.type	v4_get_Minusi_Minusnoinline,@function
+v4_get_Minusi_Minusnoinline:
+.stabn 68,0,331,.LMa1477-v4_get_Minusi_Minusnoinline
+.LMa1477:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,331,.LMb1477-v4_get_Minusi_Minusnoinline
+.LMb1477:
+.LBB155:
+	pop %rbx
+	leave
+	jmp v4_i
+.LBE155:
+.stabn 68,0,331,.LM1480-v4_get_Minusi_Minusnoinline
+.LM1480:
+	pop %rbx
+	leave
+	ret
+.Lfe155:
+	.size	 v4_get_Minusi_Minusnoinline,.Lfe155-v4_get_Minusi_Minusnoinline
+.stabn	192,0,0,.LBB155-v4_get_Minusi_Minusnoinline
+.stabn	224,0,0,.LBE155-v4_get_Minusi_Minusnoinline
+.Lscope155:
+.stabs	"",36,0,0,.Lscope155-v4_get_Minusi_Minusnoinline
+.text
+	.align 4
+.stabs "v4_find_Minusfirst:F1",36,0,0,v4_find_Minusfirst
+.globl v4_find_Minusfirst
+	.type	v4_find_Minusfirst,@function
+v4_find_Minusfirst:
+.stabn 68,0,332,.LMa1481-v4_find_Minusfirst
+.LMa1481:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,332,.LMb1481-v4_find_Minusfirst
+.LMb1481:
+.LBB156:
+.stabn 68,0,333,.LM1482-v4_find_Minusfirst
+.LM1482:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_swap
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L175:
+	call v4_i
+	mov $3,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L177
+	call v4_drop
+	call v4_i
+	jmp .L176
+.L177:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L175
+.L176:
+	call v4__rpop
+	call v4__rpop
+.LBE156:
+.stabn 68,0,333,.LM1517-v4_find_Minusfirst
+.LM1517:
+	pop %rbx
+	leave
+	ret
+.Lfe156:
+	.size	 v4_find_Minusfirst,.Lfe156-v4_find_Minusfirst
+.stabn	192,0,0,.LBB156-v4_find_Minusfirst
+.stabn	224,0,0,.LBE156-v4_find_Minusfirst
+.Lscope156:
+.stabs	"",36,0,0,.Lscope156-v4_find_Minusfirst
+.text
+	.align 4
+.stabs "v4_factorial:F1",36,0,0,v4_factorial
+.globl v4_factorial
+	.type	v4_factorial,@function
+v4_factorial:
+.stabn 68,0,334,.LMa1518-v4_factorial
+.LMa1518:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,334,.LMb1518-v4_factorial
+.LMb1518:
+.LBB157:
+	call v4_dup
+	mov $2,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L179
+	call v4_drop
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L178
+.L179:
+	call v4_dup
+	call v4__dpop
+	dec %rax
+	call v4__dpush
+	call v4_factorial
+	pop %rbx
+	leave
+	jmp v4_Star
+.L178:
+.LBE157:
+.stabn 68,0,334,.LM1541-v4_factorial
+.LM1541:
+	pop %rbx
+	leave
+	ret
+.Lfe157:
+	.size	 v4_factorial,.Lfe157-v4_factorial
+.stabn	192,0,0,.LBB157-v4_factorial
+.stabn	224,0,0,.LBE157-v4_factorial
+.Lscope157:
+.stabs	"",36,0,0,.Lscope157-v4_factorial
+.text
+	.align 4
+.stabs "v4_use_Minusclamp:F1",36,0,0,v4_use_Minusclamp
+.globl v4_use_Minusclamp
+	.type	v4_use_Minusclamp,@function
+v4_use_Minusclamp:
+.stabn 68,0,336,.LMa1542-v4_use_Minusclamp
+.LMa1542:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,336,.LMb1542-v4_use_Minusclamp
+.LMb1542:
+.LBB158:
+.stabn 68,0,325,.LM1544-v4_use_Minusclamp
+.LM1544:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L246
+	call v4_drop
+	xor %rax,%rax
+	call v4__dpush
+	jmp .L248
+.L246:
+.stabn 68,0,326,.LM1555-v4_use_Minusclamp
+.LM1555:
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L247
+	call v4_drop
+	mov $100,%rax
+	call v4__dpush
+.L247:
+.L248:
+.stabn 68,0,336,.LM1570-v4_use_Minusclamp
+.LM1570:
+	call v4_rot
+.stabn 68,0,325,.LM1572-v4_use_Minusclamp
+.LM1572:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L249
+	call v4_drop
+	xor %rax,%rax
+	call v4__dpush
+	jmp .L251
+.L249:
+.stabn 68,0,326,.LM1583-v4_use_Minusclamp
+.LM1583:
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L250
+	call v4_drop
+	mov $100,%rax
+	call v4__dpush
+.L250:
+.L251:
+.stabn 68,0,336,.LM1598-v4_use_Minusclamp
+.LM1598:
+	call v4_rot
+.stabn 68,0,325,.LM1600-v4_use_Minusclamp
+.LM1600:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L252
+	call v4_drop
+	xor %rax,%rax
+	call v4__dpush
+	jmp .L254
+.L252:
+.stabn 68,0,326,.LM1611-v4_use_Minusclamp
+.LM1611:
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L253
+	call v4_drop
+	mov $100,%rax
+	call v4__dpush
+.L253:
+.L254:
+.stabn 68,0,336,.LM1626-v4_use_Minusclamp
+.LM1626:
+	pop %rbx
+	leave
+	jmp v4_rot
+.LBE158:
+.stabn 68,0,336,.LM1628-v4_use_Minusclamp
+.LM1628:
+	pop %rbx
+	leave
+	ret
+.Lfe158:
+	.size	 v4_use_Minusclamp,.Lfe158-v4_use_Minusclamp
+.stabn	192,0,0,.LBB158-v4_use_Minusclamp
+.stabn	224,0,0,.LBE158-v4_use_Minusclamp
+.Lscope158:
+.stabs	"",36,0,0,.Lscope158-v4_use_Minusclamp
+.text
+	.align 4
+.stabs "v4_use_Minussign:F1",36,0,0,v4_use_Minussign
+.globl v4_use_Minussign
+	.type	v4_use_Minussign,@function
+v4_use_Minussign:
+.stabn 68,0,337,.LMa1629-v4_use_Minussign
+.LMa1629:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,337,.LMb1629-v4_use_Minussign
+.LMb1629:
+.LBB160:
+	mov $-5,%rax
+	call v4__dpush
+	call v4_sign
+	xor %rax,%rax
+	call v4__dpush
+	call v4_sign
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+	pop %rbx
+	leave
+	jmp v4_sign
+.LBE160:
+.stabn 68,0,337,.LM1640-v4_use_Minussign
+.LM1640:
+	pop %rbx
+	leave
+	ret
+.Lfe160:
+	.size	 v4_use_Minussign,.Lfe160-v4_use_Minussign
+.stabn	192,0,0,.LBB160-v4_use_Minussign
+.stabn	224,0,0,.LBE160-v4_use_Minussign
+.Lscope160:
+.stabs	"",36,0,0,.Lscope160-v4_use_Minussign
+.text
+	.align 4
+.stabs "v4_use_Minustwice:F1",36,0,0,v4_use_Minustwice
+.globl v4_use_Minustwice
+	.type	v4_use_Minustwice,@function
+v4_use_Minustwice:
+.stabn 68,0,338,.LMa1641-v4_use_Minustwice
+.LMa1641:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,338,.LMb1641-v4_use_Minustwice
+.LMb1641:
+.LBB161:
+	call v4_twice
+	pop %rbx
+	leave
+	jmp v4_twice
+.LBE161:
+.stabn 68,0,338,.LM1645-v4_use_Minustwice
+.LM1645:
+	pop %rbx
+	leave
+	ret
+.Lfe161:
+	.size	 v4_use_Minustwice,.Lfe161-v4_use_Minustwice
+.stabn	192,0,0,.LBB161-v4_use_Minustwice
+.stabn	224,0,0,.LBE161-v4_use_Minustwice
+.Lscope161:
+.stabs	"",36,0,0,.Lscope161-v4_use_Minustwice
+.text
+	.align 4
+.stabs "v4_sum_Minusi:F1",36,0,0,v4_sum_Minusi
+.globl v4_sum_Minusi
+	.type	v4_sum_Minusi,@function
+v4_sum_Minusi:
+.stabn 68,0,339,.LMa1646-v4_sum_Minusi
+.LMa1646:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,339,.LMb1646-v4_sum_Minusi
+.LMb1646:
+.LBB162:
+	xor %rax,%rax
+	call v4__dpush
+	mov $5,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	mov -16(%rbp),%rcx
+.L185:
+	mov -24(%rbp),%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov %rcx,%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L185
+	mov -16(%rbp),%rax
+.LBE162:
+.stabn 68,0,339,.LM1680-v4_sum_Minusi
+.LM1680:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe162:
+	.size	 v4_sum_Minusi,.Lfe162-v4_sum_Minusi
+.stabn	192,0,0,.LBB162-v4_sum_Minusi
+.stabn	224,0,0,.LBE162-v4_sum_Minusi
+.Lscope162:
+.stabs	"",36,0,0,.Lscope162-v4_sum_Minusi
+.text
+	.align 4
+.stabs "v4_sum_Minusi_Minusnoinline:F1",36,0,0,v4_sum_Minusi_Minusnoinline
+.globl v4_sum_Minusi_Minusnoinline
+	.type	v4_sum_Minusi_Minusnoinline,@function
+v4_sum_Minusi_Minusnoinline:
+.stabn 68,0,340,.LMa1681-v4_sum_Minusi_Minusnoinline
+.LMa1681:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,340,.LMb1681-v4_sum_Minusi_Minusnoinline
+.LMb1681:
+.LBB163:
+	xor %rax,%rax
+	call v4__dpush
+	mov $5,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L189:
+	call v4_get_Minusi_Minusnoinline
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L189
+	call v4__rpop
+	call v4__rpop
+.LBE163:
+.stabn 68,0,340,.LM1711-v4_sum_Minusi_Minusnoinline
+.LM1711:
+	pop %rbx
+	leave
+	ret
+.Lfe163:
+	.size	 v4_sum_Minusi_Minusnoinline,.Lfe163-v4_sum_Minusi_Minusnoinline
+.stabn	192,0,0,.LBB163-v4_sum_Minusi_Minusnoinline
+.stabn	224,0,0,.LBE163-v4_sum_Minusi_Minusnoinline
+.Lscope163:
+.stabs	"",36,0,0,.Lscope163-v4_sum_Minusi_Minusnoinline
+.text
+	.align 4
+.stabs "v4_sum_Minusj:F1",36,0,0,v4_sum_Minusj
+.globl v4_sum_Minusj
+	.type	v4_sum_Minusj,@function
+v4_sum_Minusj:
+.stabn 68,0,341,.LMa1712-v4_sum_Minusj
+.LMa1712:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $32,%rsp
+.stabn 68,0,341,.LMb1712-v4_sum_Minusj
+.LMb1712:
+.LBB164:
+	xor %rax,%rax
+	call v4__dpush
+	mov $2,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	mov -16(%rbp),%r8
+.L193:
+	mov $3,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	mov %rax,-32(%rbp)
+	mov %rdx,-40(%rbp)
+	mov -32(%rbp),%rcx
+.L196:
+	mov -40(%rbp),%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	mov -40(%rbp),%rdx
+	inc %rdx
+	mov %rcx,%rax
+	mov %rdx,-40(%rbp)
+	sub %rax,%rdx
+	jne .L196
+	mov -32(%rbp),%rax
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov %r8,%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L193
+	mov -16(%rbp),%rax
+.LBE164:
+.stabn 68,0,341,.LM1767-v4_sum_Minusj
+.LM1767:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe164:
+	.size	 v4_sum_Minusj,.Lfe164-v4_sum_Minusj
+.stabn	192,0,0,.LBB164-v4_sum_Minusj
+.stabn	224,0,0,.LBE164-v4_sum_Minusj
+.Lscope164:
+.stabs	"",36,0,0,.Lscope164-v4_sum_Minusj
+.text
+	.align 4
+.stabs "v4_use_Minusfind_Minusfirst:F1",36,0,0,v4_use_Minusfind_Minusfirst
+.globl v4_use_Minusfind_Minusfirst
+	.type	v4_use_Minusfind_Minusfirst,@function
+v4_use_Minusfind_Minusfirst:
+.stabn 68,0,342,.LMa1768-v4_use_Minusfind_Minusfirst
+.LMa1768:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,342,.LMb1768-v4_use_Minusfind_Minusfirst
+.LMb1768:
+.LBB165:
+	mov $10,%rax
+	call v4__dpush
+	call v4_find_Minusfirst
+	mov $3,%rax
+	call v4__dpush
+	pop %rbx
+	leave
+	jmp v4_find_Minusfirst
+.LBE165:
+.stabn 68,0,342,.LM1776-v4_use_Minusfind_Minusfirst
+.LM1776:
+	pop %rbx
+	leave
+	ret
+.Lfe165:
+	.size	 v4_use_Minusfind_Minusfirst,.Lfe165-v4_use_Minusfind_Minusfirst
+.stabn	192,0,0,.LBB165-v4_use_Minusfind_Minusfirst
+.stabn	224,0,0,.LBE165-v4_use_Minusfind_Minusfirst
+.Lscope165:
+.stabs	"",36,0,0,.Lscope165-v4_use_Minusfind_Minusfirst
+.text
+	.align 4
+.stabs "v4_use_Minusin_Minusloop:F1",36,0,0,v4_use_Minusin_Minusloop
+.globl v4_use_Minusin_Minusloop
+	.type	v4_use_Minusin_Minusloop,@function
+v4_use_Minusin_Minusloop:
+.stabn 68,0,343,.LMa1777-v4_use_Minusin_Minusloop
+.LMa1777:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,343,.LMb1777-v4_use_Minusin_Minusloop
+.LMb1777:
+.LBB166:
+	xor %rax,%rax
+	call v4__dpush
+	mov $200,%rax
+	mov %rax,%rcx
+	mov $-100,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L201:
+	call v4_i
+.stabn 68,0,325,.LM1791-v4_use_Minusin_Minusloop
+.LM1791:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L255
+	call v4_drop
+	xor %rax,%rax
+	call v4__dpush
+	jmp .L257
+.L255:
+.stabn 68,0,326,.LM1802-v4_use_Minusin_Minusloop
+.LM1802:
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L256
+	call v4_drop
+	mov $100,%rax
+	call v4__dpush
+.L256:
+.L257:
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	mov $50,%rax
+	xchg %rdx,%rax
+	call v4__rpop
+	xchg %rax,%rdx
+	add %rax,%rdx
+	test %rax,%rax
+	jl .L203
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	test %rdx,%rdx
+	jl .L201
+	jmp .L202
+.L203:
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	test %rdx,%rdx
+	jge .L201
+.L202:
+	call v4__rpop
+	call v4__rpop
+.LBE166:
+.stabn 68,0,343,.LM1845-v4_use_Minusin_Minusloop
+.LM1845:
+	pop %rbx
+	leave
+	ret
+.Lfe166:
+	.size	 v4_use_Minusin_Minusloop,.Lfe166-v4_use_Minusin_Minusloop
+.stabn	192,0,0,.LBB166-v4_use_Minusin_Minusloop
+.stabn	224,0,0,.LBE166-v4_use_Minusin_Minusloop
+.Lscope166:
+.stabs	"",36,0,0,.Lscope166-v4_use_Minusin_Minusloop
+.text
+	.align 4
+.stabs "v4_sum_Minusstep:F1",36,0,0,v4_sum_Minusstep
+.globl v4_sum_Minusstep
+	.type	v4_sum_Minusstep,@function
+v4_sum_Minusstep:
+.stabn 68,0,363,.LMa1846-v4_sum_Minusstep
+.LMa1846:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,363,.LMb1846-v4_sum_Minusstep
+.LMb1846:
+.LBB168:
+	xor %rax,%rax
+	call v4__dpush
+	call v4_swap
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	mov v4_step(%rip),%rcx
+	mov -16(%rbp),%r8
+.L206:
+	mov %rcx,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov %r8,%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L206
+	mov -16(%rbp),%rax
+.LBE168:
+.stabn 68,0,363,.LM1881-v4_sum_Minusstep
+.LM1881:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe168:
+	.size	 v4_sum_Minusstep,.Lfe168-v4_sum_Minusstep
+.stabn	192,0,0,.LBB168-v4_sum_Minusstep
+.stabn	224,0,0,.LBE168-v4_sum_Minusstep
+.Lscope168:
+.stabs	"",36,0,0,.Lscope168-v4_sum_Minusstep
+.text
+	.align 4
+.stabs "v4_bump_Minusstep:F1",36,0,0,v4_bump_Minusstep
+.globl v4_bump_Minusstep
+	.type	v4_bump_Minusstep,@function
+v4_bump_Minusstep:
+.stabn 68,0,364,.LMa1882-v4_bump_Minusstep
+.LMa1882:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,364,.LMb1882-v4_bump_Minusstep
+.LMb1882:
+.LBB169:
+	xor %rax,%rax
+	call v4__dpush
+	call v4_swap
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	mov -16(%rbp),%rcx
+.L210:
+	mov v4_step(%rip),%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	mov v4_step(%rip),%rdx
+	add %rdx,%rax
+	mov %rax,v4_step(%rip)
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov %rcx,%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L210
+	mov -16(%rbp),%rax
+.LBE169:
+.stabn 68,0,364,.LM1925-v4_bump_Minusstep
+.LM1925:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe169:
+	.size	 v4_bump_Minusstep,.Lfe169-v4_bump_Minusstep
+.stabn	192,0,0,.LBB169-v4_bump_Minusstep
+.stabn	224,0,0,.LBE169-v4_bump_Minusstep
+.Lscope169:
+.stabs	"",36,0,0,.Lscope169-v4_bump_Minusstep
+.text
+	.align 4
+.stabs "v4_sum_Minusstep_Minus2:F1",36,0,0,v4_sum_Minusstep_Minus2
+.globl v4_sum_Minusstep_Minus2
+	.type	v4_sum_Minusstep_Minus2,@function
+v4_sum_Minusstep_Minus2:
+.stabn 68,0,365,.LMa1926-v4_sum_Minusstep_Minus2
+.LMa1926:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $32,%rsp
+.stabn 68,0,365,.LMb1926-v4_sum_Minusstep_Minus2
+.LMb1926:
+.LBB170:
+	xor %rax,%rax
+	call v4__dpush
+	call v4_swap
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	mov v4_step(%rip),%r8
+	mov -16(%rbp),%r9
+.L214:
+	mov $3,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	mov %rax,-32(%rbp)
+	mov %rdx,-40(%rbp)
+.L217:
+	mov %r8,%rax
+	mov %rax,%rcx
+	mov -24(%rbp),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	mov -40(%rbp),%rdx
+	inc %rdx
+	mov -32(%rbp),%rax
+	mov %rdx,-40(%rbp)
+	sub %rax,%rdx
+	jne .L217
+	mov -32(%rbp),%rax
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov %r9,%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L214
+	mov -16(%rbp),%rax
+.LBE170:
+.stabn 68,0,365,.LM1989-v4_sum_Minusstep_Minus2
+.LM1989:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe170:
+	.size	 v4_sum_Minusstep_Minus2,.Lfe170-v4_sum_Minusstep_Minus2
+.stabn	192,0,0,.LBB170-v4_sum_Minusstep_Minus2
+.stabn	224,0,0,.LBE170-v4_sum_Minusstep_Minus2
+.Lscope170:
+.stabs	"",36,0,0,.Lscope170-v4_sum_Minusstep_Minus2
+.text
+	.align 4
+.stabs "v4_set_Minuscell_Minusv:F1",36,0,0,v4_set_Minuscell_Minusv
+.globl v4_set_Minuscell_Minusv
+	.type	v4_set_Minuscell_Minusv,@function
+v4_set_Minuscell_Minusv:
+.stabn 68,0,380,.LMa1990-v4_set_Minuscell_Minusv
+.LMa1990:
+.stabn 68,0,380,.LMb1990-v4_set_Minuscell_Minusv
+.LMb1990:
+.LBB172:
+	mov $11,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+.LBE172:
+.stabn 68,0,380,.LM1999-v4_set_Minuscell_Minusv
+.LM1999:
+	ret
+.Lfe172:
+	.size	 v4_set_Minuscell_Minusv,.Lfe172-v4_set_Minuscell_Minusv
+.stabn	192,0,0,.LBB172-v4_set_Minuscell_Minusv
+.stabn	224,0,0,.LBE172-v4_set_Minuscell_Minusv
+.Lscope172:
+.stabs	"",36,0,0,.Lscope172-v4_set_Minuscell_Minusv
+.text
+	.align 4
+.stabs "v4_forward_Minusv:F1",36,0,0,v4_forward_Minusv
+.globl v4_forward_Minusv
+	.type	v4_forward_Minusv,@function
+v4_forward_Minusv:
+.stabn 68,0,381,.LMa2000-v4_forward_Minusv
+.LMa2000:
+.stabn 68,0,381,.LMb2000-v4_forward_Minusv
+.LMb2000:
+.LBB173:
+	call v4__dpop
+	mov %rax,v4_cell_Minusv(%rip)
+	call v4__dpush
+.LBE173:
+.stabn 68,0,381,.LM2012-v4_forward_Minusv
+.LM2012:
+	ret
+.Lfe173:
+	.size	 v4_forward_Minusv,.Lfe173-v4_forward_Minusv
+.stabn	192,0,0,.LBB173-v4_forward_Minusv
+.stabn	224,0,0,.LBE173-v4_forward_Minusv
+.Lscope173:
+.stabs	"",36,0,0,.Lscope173-v4_forward_Minusv
+.text
+	.align 4
+.stabs "v4_reload_Minusv:F1",36,0,0,v4_reload_Minusv
+.globl v4_reload_Minusv
+	.type	v4_reload_Minusv,@function
+v4_reload_Minusv:
+.stabn 68,0,382,.LMa2013-v4_reload_Minusv
+.LMa2013:
+.stabn 68,0,382,.LMb2013-v4_reload_Minusv
+.LMb2013:
+.LBB174:
+	mov v4_cell_Minusv(%rip),%rax
+	call v4__dpush
+	call v4__dpush
+.LBE174:
+.stabn 68,0,382,.LM2025-v4_reload_Minusv
+.LM2025:
+	ret
+.Lfe174:
+	.size	 v4_reload_Minusv,.Lfe174-v4_reload_Minusv
+.stabn	192,0,0,.LBB174-v4_reload_Minusv
+.stabn	224,0,0,.LBE174-v4_reload_Minusv
+.Lscope174:
+.stabs	"",36,0,0,.Lscope174-v4_reload_Minusv
+.text
+	.align 4
+.stabs "v4_overwrite_Minusv:F1",36,0,0,v4_overwrite_Minusv
+.globl v4_overwrite_Minusv
+	.type	v4_overwrite_Minusv,@function
+v4_overwrite_Minusv:
+.stabn 68,0,383,.LMa2026-v4_overwrite_Minusv
+.LMa2026:
+.stabn 68,0,383,.LMb2026-v4_overwrite_Minusv
+.LMb2026:
+.LBB175:
+	call v4__dpop
+	call v4__dpop
+	mov %rax,v4_cell_Minusv(%rip)
+.LBE175:
+.stabn 68,0,383,.LM2038-v4_overwrite_Minusv
+.LM2038:
+	ret
+.Lfe175:
+	.size	 v4_overwrite_Minusv,.Lfe175-v4_overwrite_Minusv
+.stabn	192,0,0,.LBB175-v4_overwrite_Minusv
+.stabn	224,0,0,.LBE175-v4_overwrite_Minusv
+.Lscope175:
+.stabs	"",36,0,0,.Lscope175-v4_overwrite_Minusv
+.text
+	.align 4
+.stabs "v4_store_Minusthrough:F1",36,0,0,v4_store_Minusthrough
+.globl v4_store_Minusthrough
+	.type	v4_store_Minusthrough,@function
+v4_store_Minusthrough:
+.stabn 68,0,384,.LMa2039-v4_store_Minusthrough
+.LMa2039:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,384,.LMb2039-v4_store_Minusthrough
+.LMb2039:
+.LBB176:
+	mov $5,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov $9,%rax
+	call v4__dpush
+	call v4_swap
+	call v4_Store
+	mov v4_cell_Minusv(%rip),%rax
+	call v4__dpush
+.LBE176:
+.stabn 68,0,384,.LM2057-v4_store_Minusthrough
+.LM2057:
+	pop %rbx
+	leave
+	ret
+.Lfe176:
+	.size	 v4_store_Minusthrough,.Lfe176-v4_store_Minusthrough
+.stabn	192,0,0,.LBB176-v4_store_Minusthrough
+.stabn	224,0,0,.LBE176-v4_store_Minusthrough
+.Lscope176:
+.stabs	"",36,0,0,.Lscope176-v4_store_Minusthrough
+.text
+	.align 4
+.stabs "v4_cstore_Minusthrough:F1",36,0,0,v4_cstore_Minusthrough
+.globl v4_cstore_Minusthrough
+	.type	v4_cstore_Minusthrough,@function
+v4_cstore_Minusthrough:
+.stabn 68,0,385,.LMa2058-v4_cstore_Minusthrough
+.LMa2058:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,385,.LMb2058-v4_cstore_Minusthrough
+.LMb2058:
+.LBB177:
+	xor %rax,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov $7,%rax
+	call v4__dpush
+	call v4_swap
+	call v4_c_Store
+	mov v4_cell_Minusv(%rip),%rax
+	call v4__dpush
+.LBE177:
+.stabn 68,0,385,.LM2076-v4_cstore_Minusthrough
+.LM2076:
+	pop %rbx
+	leave
+	ret
+.Lfe177:
+	.size	 v4_cstore_Minusthrough,.Lfe177-v4_cstore_Minusthrough
+.stabn	192,0,0,.LBB177-v4_cstore_Minusthrough
+.stabn	224,0,0,.LBE177-v4_cstore_Minusthrough
+.Lscope177:
+.stabs	"",36,0,0,.Lscope177-v4_cstore_Minusthrough
+.text
+	.align 4
+.stabs "v4_fetch_Minusthrough:F1",36,0,0,v4_fetch_Minusthrough
+.globl v4_fetch_Minusthrough
+	.type	v4_fetch_Minusthrough,@function
+v4_fetch_Minusthrough:
+.stabn 68,0,386,.LMa2077-v4_fetch_Minusthrough
+.LMa2077:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,386,.LMb2077-v4_fetch_Minusthrough
+.LMb2077:
+.LBB179:
+	mov $3,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	call v4_Fetch
+	mov $4,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+.LBE179:
+.stabn 68,0,386,.LM2094-v4_fetch_Minusthrough
+.LM2094:
+	pop %rbx
+	leave
+	ret
+.Lfe179:
+	.size	 v4_fetch_Minusthrough,.Lfe179-v4_fetch_Minusthrough
+.stabn	192,0,0,.LBB179-v4_fetch_Minusthrough
+.stabn	224,0,0,.LBE179-v4_fetch_Minusthrough
+.Lscope179:
+.stabs	"",36,0,0,.Lscope179-v4_fetch_Minusthrough
+.text
+	.align 4
+.stabs "v4_around_Minuscall:F1",36,0,0,v4_around_Minuscall
+.globl v4_around_Minuscall
+	.type	v4_around_Minuscall,@function
+v4_around_Minuscall:
+.stabn 68,0,387,.LMa2095-v4_around_Minuscall
+.LMa2095:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,387,.LMb2095-v4_around_Minuscall
+.LMb2095:
+.LBB180:
+	mov $5,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	call v4__dpush
+	call v4_set_Minuscell_Minusv
+	mov v4_cell_Minusv(%rip),%rax
+	call v4__dpush
+.LBE180:
+.stabn 68,0,387,.LM2115-v4_around_Minuscall
+.LM2115:
+	pop %rbx
+	leave
+	ret
+.Lfe180:
+	.size	 v4_around_Minuscall,.Lfe180-v4_around_Minuscall
+.stabn	192,0,0,.LBB180-v4_around_Minuscall
+.stabn	224,0,0,.LBE180-v4_around_Minuscall
+.Lscope180:
+.stabs	"",36,0,0,.Lscope180-v4_around_Minuscall
+.text
+	.align 4
+.stabs "v4_thread_Minusforward:F1",36,0,0,v4_thread_Minusforward
+.globl v4_thread_Minusforward
+	.type	v4_thread_Minusforward,@function
+v4_thread_Minusforward:
+.stabn 68,0,406,.LMa2116-v4_thread_Minusforward
+.LMa2116:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,406,.LMb2116-v4_thread_Minusforward
+.LMb2116:
+.LBB181:
+	call v4__dpop
+	test %rax,%rax
+	je .L228
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	je .L229
+	call v4_drop
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L230
+.L228:
+	call v4_drop
+	mov $3,%rax
+	call v4__dpush
+.L229:
+.L230:
+.LBE181:
+.stabn 68,0,406,.LM2134-v4_thread_Minusforward
+.LM2134:
+	pop %rbx
+	leave
+	ret
+.Lfe181:
+	.size	 v4_thread_Minusforward,.Lfe181-v4_thread_Minusforward
+.stabn	192,0,0,.LBB181-v4_thread_Minusforward
+.stabn	224,0,0,.LBE181-v4_thread_Minusforward
+.Lscope181:
+.stabs	"",36,0,0,.Lscope181-v4_thread_Minusforward
+.text
+	.align 4
+.stabs "v4_count_Minusodd:F1",36,0,0,v4_count_Minusodd
+.globl v4_count_Minusodd
+	.type	v4_count_Minusodd,@function
+v4_count_Minusodd:
+.stabn 68,0,407,.LMa2135-v4_count_Minusodd
+.LMa2135:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,407,.LMb2135-v4_count_Minusodd
+.LMb2135:
+.LBB182:
+.stabn 68,0,408,.LM2136-v4_count_Minusodd
+.LM2136:
+	xor %rax,%rax
+	call v4__dpush
+	call v4_swap
+.L234:
+.L232:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	je .L233
+	call v4__dpop
+	dec %rax
+	call v4__dpush
+	call v4_dup
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	call v4__dpop
+	and %rdx,%rax
+	je .L234
+	call v4_swap
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	call v4_swap
+	jmp .L232
+.L233:
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE182:
+.stabn 68,0,408,.LM2169-v4_count_Minusodd
+.LM2169:
+	pop %rbx
+	leave
+	ret
+.Lfe182:
+	.size	 v4_count_Minusodd,.Lfe182-v4_count_Minusodd
+.stabn	192,0,0,.LBB182-v4_count_Minusodd
+.stabn	224,0,0,.LBE182-v4_count_Minusodd
+.Lscope182:
+.stabs	"",36,0,0,.Lscope182-v4_count_Minusodd
+.text
+	.align 4
+.stabs "v4_spin:F1",36,0,0,v4_spin
+.globl v4_spin
+	.type	v4_spin,@function
+v4_spin:
+.stabn 68,0,409,.LMa2170-v4_spin
+.LMa2170:
+.stabn 68,0,409,.LMb2170-v4_spin
+.LMb2170:
+.LBB183:
+.L236:
+	jmp .L236
+.LBE183:
+.stabn 68,0,409,.LM2175-v4_spin
+.LM2175:
+	ret
+.Lfe183:
+	.size	 v4_spin,.Lfe183-v4_spin
+.stabn	192,0,0,.LBB183-v4_spin
+.stabn	224,0,0,.LBE183-v4_spin
+.Lscope183:
+.stabs	"",36,0,0,.Lscope183-v4_spin
+.text
+	.align 4
+.stabs "v4_spin_Minusunless:F1",36,0,0,v4_spin_Minusunless
+.globl v4_spin_Minusunless
+	.type	v4_spin_Minusunless,@function
+v4_spin_Minusunless:
+.stabn 68,0,410,.LMa2176-v4_spin_Minusunless
+.LMa2176:
+.stabn 68,0,410,.LMb2176-v4_spin_Minusunless
+.LMb2176:
+.LBB184:
+	call v4__dpop
+	test %rax,%rax
+	jne .L239
+.L240:
+	jmp .L240
+.L239:
+.LBE184:
+.stabn 68,0,410,.LM2187-v4_spin_Minusunless
+.LM2187:
+	ret
+.Lfe184:
+	.size	 v4_spin_Minusunless,.Lfe184-v4_spin_Minusunless
+.stabn	192,0,0,.LBB184-v4_spin_Minusunless
+.stabn	224,0,0,.LBE184-v4_spin_Minusunless
+.Lscope184:
+.stabs	"",36,0,0,.Lscope184-v4_spin_Minusunless
+.text
+	.align 4
+.stabs "v4_merge_Minusloop:F1",36,0,0,v4_merge_Minusloop
+.globl v4_merge_Minusloop
+	.type	v4_merge_Minusloop,@function
+v4_merge_Minusloop:
+.stabn 68,0,411,.LMa2188-v4_merge_Minusloop
+.LMa2188:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,411,.LMb2188-v4_merge_Minusloop
+.LMb2188:
+.LBB185:
+.L243:
+	call v4_dup
+	mov $10,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L245
+	call v4__dpop
+	inc %rax
+	add %rax,%rax
+	call v4__dpush
+	jmp .L243
+.L245:
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+.LBE185:
+.stabn 68,0,412,.LM2221-v4_merge_Minusloop
+.LM2221:
+	pop %rbx
+	leave
+	ret
+.Lfe185:
+	.size	 v4_merge_Minusloop,.Lfe185-v4_merge_Minusloop
+.stabn	192,0,0,.LBB185-v4_merge_Minusloop
+.stabn	224,0,0,.LBE185-v4_merge_Minusloop
+.Lscope185:
+.stabs	"",36,0,0,.Lscope185-v4_merge_Minusloop
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,9,.LMa2222-main
+.LMa2222:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+	mov %rdi,v4__argc(%rip)
+	mov %rdx,v4__envp(%rip)
+	mov %rsi,v4__argv(%rip)
+.stabn 68,0,9,.LMb2222-main
+.LMb2222:
+.LBB1:
+	lea .LC0(%rip),%rax
+	call v4__dpush
+	mov $17,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4__strictansi
+	call v4_Store
+.stabn 68,0,12,.LM2234-main
+.LM2234:
+	xor %rax,%rax
+	call v4__dpush
+	lea v4_invert(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4__dpop
+	mov %rax,v4_max_Minusuint(%rip)
+.stabn 68,0,13,.LM2241-main
+.LM2241:
+	mov v4_max_Minusuint(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	lea v4_rshift(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4__dpop
+	mov %rax,v4_max_Minusint(%rip)
+.stabn 68,0,14,.LM2250-main
+.LM2250:
+	mov v4_max_Minusint(%rip),%rax
+	call v4__dpush
+	lea v4_invert(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4__dpop
+	mov %rax,v4_min_Minusint(%rip)
+.stabn 68,0,15,.LM2257-main
+.LM2257:
+	xor %rax,%rax
+	mov %rax,v4_Lessfalse_Greater(%rip)
+.stabn 68,0,16,.LM2261-main
+.LM2261:
+	mov v4_max_Minusuint(%rip),%rax
+	mov %rax,v4_Lesstrue_Greater(%rip)
+.stabn 68,0,19,.LM2265-main
+.LM2265:
+	lea .LC1(%rip),%rax
+	call v4__dpush
+	mov $38,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,38,.LM2271-main
+.LM2271:
+	mov $100,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,21,.LM2275-main
+.LM2275:
+	mov $9,%rax
+	call v4__dpush
+.stabn 68,0,38,.LM2277-main
+.LM2277:
+	call v4_Minus_Greater
+	mov $9,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,39,.LM2281-main
+.LM2281:
+	mov $110,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,22,.LM2285-main
+.LM2285:
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+.stabn 68,0,39,.LM2287-main
+.LM2287:
+	call v4_Minus_Greater
+	mov v4_max_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,40,.LM2291-main
+.LM2291:
+	mov $120,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,23,.LM2295-main
+.LM2295:
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+.stabn 68,0,40,.LM2297-main
+.LM2297:
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,41,.LM2301-main
+.LM2301:
+	mov $130,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,24,.LM2305-main
+.LM2305:
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+.stabn 68,0,41,.LM2307-main
+.LM2307:
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,42,.LM2311-main
+.LM2311:
+	mov $140,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,26,.LM2315-main
+.LM2315:
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+.stabn 68,0,42,.LM2317-main
+.LM2317:
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,43,.LM2321-main
+.LM2321:
+	mov $150,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,27,.LM2325-main
+.LM2325:
+	movabs $9223372036854775807,%rax
+	call v4__dpush
+.stabn 68,0,43,.LM2327-main
+.LM2327:
+	call v4_Minus_Greater
+	mov v4_max_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,44,.LM2331-main
+.LM2331:
+	mov $160,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,32,.LM2335-main
+.LM2335:
+	mov $-3,%rax
+	call v4__dpush
+.stabn 68,0,44,.LM2337-main
+.LM2337:
+	call v4_Minus_Greater
+	mov $-3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,45,.LM2341-main
+.LM2341:
+	mov $170,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,33,.LM2345-main
+.LM2345:
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,45,.LM2347-main
+.LM2347:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,46,.LM2351-main
+.LM2351:
+	mov $180,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,34,.LM2355-main
+.LM2355:
+	mov $6,%rax
+	call v4__dpush
+	mov $-4,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,46,.LM2361-main
+.LM2361:
+	call v4_Minus_Greater
+	mov $6,%rax
+	call v4__dpush
+	mov $-4,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,47,.LM2369-main
+.LM2369:
+	mov $190,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,35,.LM2373-main
+.LM2373:
+	mov $7,%rax
+	call v4__dpush
+.stabn 68,0,47,.LM2375-main
+.LM2375:
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,48,.LM2379-main
+.LM2379:
+	mov $200,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,36,.LM2383-main
+.LM2383:
+	mov v4_max_Minusuint(%rip),%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	call v4__dpush
+.stabn 68,0,48,.LM2392-main
+.LM2392:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,49,.LM2396-main
+.LM2396:
+	mov $210,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $20,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $20,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,50,.LM2411-main
+.LM2411:
+	mov $220,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,53,.LM2423-main
+.LM2423:
+	lea .LC2(%rip),%rax
+	call v4__dpush
+	mov $18,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,65,.LM2429-main
+.LM2429:
+	mov $1600,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $1000000,%rax
+	call v4__dpush
+	call v4_countdown
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,66,.LM2439-main
+.LM2439:
+	mov $1610,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	mov $60000,%rax
+	call v4__dpush
+	call v4_sumto
+	call v4_Minus_Greater
+	mov $1800030000,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,67,.LM2451-main
+.LM2451:
+	mov $1620,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+.stabn 68,0,67,.LM2460-main
+.LM2460:
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,68,.LM2464-main
+.LM2464:
+	mov $1630,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-4,%rax
+	call v4__dpush
+.stabn 68,0,60,.LM2470-main
+.LM2470:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L258
+	call v4__dpop
+	neg %rax
+	call v4__dpush
+	jmp .L259
+.L258:
+	call v4__dpop
+	add %rax,%rax
+	inc %rax
+	call v4__dpush
+.L259:
+.stabn 68,0,68,.LM2492-main
+.LM2492:
+	call v4_Minus_Greater
+	mov $4,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,69,.LM2496-main
+.LM2496:
+	mov $1640,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%rax
+	call v4__dpush
+.stabn 68,0,60,.LM2502-main
+.LM2502:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L260
+	call v4__dpop
+	neg %rax
+	call v4__dpush
+	jmp .L261
+.L260:
+	call v4__dpop
+	add %rax,%rax
+	inc %rax
+	call v4__dpush
+.L261:
+.stabn 68,0,69,.LM2524-main
+.LM2524:
+	call v4_Minus_Greater
+	mov $9,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,70,.LM2528-main
+.LM2528:
+	mov $1650,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%rax
+	mov %rax,-16(%rbp)
+	mov $3,%rax
+	mov %rax,%rcx
+	mov -16(%rbp),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,70,.LM2552-main
+.LM2552:
+	call v4_Minus_Greater
+	mov $8,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,71,.LM2556-main
+.LM2556:
+	mov $1660,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_tail_Minusloop
+	call v4_Minus_Greater
+	mov $11,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,72,.LM2564-main
+.LM2564:
+	mov $1670,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+	lea v4_tail1(%rip),%rax
+	call v4__dpush
+.stabn 68,0,63,.LM2572-main
+.LM2572:
+	call v4_execute
+.stabn 68,0,72,.LM2573-main
+.LM2573:
+	call v4_Minus_Greater
+	mov $11,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,75,.LM2577-main
+.LM2577:
+	lea .LC3(%rip),%rax
+	call v4__dpush
+	mov $18,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,86,.LM2583-main
+.LM2583:
+	mov $1700,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+.stabn 68,0,77,.LM2589-main
+.LM2589:
+	call v4_dup
+	call v4_Star
+.stabn 68,0,86,.LM2591-main
+.LM2591:
+	call v4_Minus_Greater
+	mov $49,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,87,.LM2595-main
+.LM2595:
+	mov $1710,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,78,.LM2603-main
+.LM2603:
+	call v4_z2dup
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+.stabn 68,0,87,.LM2609-main
+.LM2609:
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,88,.LM2617-main
+.LM2617:
+	mov $1720,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_leaf_Minusloop
+	call v4_Minus_Greater
+	mov $45,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,89,.LM2625-main
+.LM2625:
+	mov $1730,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_leaf_Minusnested
+	call v4_Minus_Greater
+	mov $138,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,90,.LM2633-main
+.LM2633:
+	mov $1740,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%rax
+	mov %rax,-16(%rbp)
+	mov -16(%rbp),%rax
+	mov %rax,%rcx
+	mov -16(%rbp),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	add %rdx,%rax
+	call v4__dpush
+.stabn 68,0,90,.LM2653-main
+.LM2653:
+	call v4_Minus_Greater
+	mov $12,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,91,.LM2657-main
+.LM2657:
+	mov $1750,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $42,%rax
+	mov %rax,v4_leaf_Minusvar(%rip)
+	call v4__dpush
+.stabn 68,0,91,.LM2674-main
+.LM2674:
+	call v4_Minus_Greater
+	mov $42,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,92,.LM2678-main
+.LM2678:
+	mov $1760,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	lea v4_leaf1(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	mov $49,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,93,.LM2690-main
+.LM2690:
+	mov $1770,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	lea v4_leaf2(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,96,.LM2708-main
+.LM2708:
+	lea .LC4(%rip),%rax
+	call v4__dpush
+	mov $26,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,114,.LM2714-main
+.LM2714:
+	mov $300,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rcx
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jge .L262
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L263
+.L262:
+	xor %rax,%rax
+	call v4__dpush
+.L263:
+.stabn 68,0,114,.LM2735-main
+.LM2735:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,115,.LM2739-main
+.LM2739:
+	mov $310,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rcx
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jge .L264
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L265
+.L264:
+	xor %rax,%rax
+	call v4__dpush
+.L265:
+.stabn 68,0,115,.LM2760-main
+.LM2760:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,116,.LM2764-main
+.LM2764:
+	mov $320,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jge .L266
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L267
+.L266:
+	xor %rax,%rax
+	call v4__dpush
+.L267:
+.stabn 68,0,116,.LM2785-main
+.LM2785:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,117,.LM2789-main
+.LM2789:
+	mov $330,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rcx
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jle .L268
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L269
+.L268:
+	xor %rax,%rax
+	call v4__dpush
+.L269:
+.stabn 68,0,117,.LM2810-main
+.LM2810:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,118,.LM2814-main
+.LM2814:
+	mov $340,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rcx
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jle .L270
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L271
+.L270:
+	xor %rax,%rax
+	call v4__dpush
+.L271:
+.stabn 68,0,118,.LM2835-main
+.LM2835:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,119,.LM2839-main
+.LM2839:
+	mov $350,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	cmp %rdx,%rax
+	jne .L272
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L273
+.L272:
+	xor %rax,%rax
+	call v4__dpush
+.L273:
+.stabn 68,0,119,.LM2860-main
+.LM2860:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,120,.LM2864-main
+.LM2864:
+	mov $360,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rcx
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jne .L274
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L275
+.L274:
+	xor %rax,%rax
+	call v4__dpush
+.L275:
+.stabn 68,0,120,.LM2885-main
+.LM2885:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,121,.LM2889-main
+.LM2889:
+	mov $370,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rcx
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	je .L276
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L277
+.L276:
+	xor %rax,%rax
+	call v4__dpush
+.L277:
+.stabn 68,0,121,.LM2910-main
+.LM2910:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,122,.LM2914-main
+.LM2914:
+	mov $380,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	je .L278
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L279
+.L278:
+	xor %rax,%rax
+	call v4__dpush
+.L279:
+.stabn 68,0,122,.LM2935-main
+.LM2935:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,123,.LM2939-main
+.LM2939:
+	mov $390,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rcx
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jae .L280
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L281
+.L280:
+	xor %rax,%rax
+	call v4__dpush
+.L281:
+.stabn 68,0,123,.LM2960-main
+.LM2960:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,124,.LM2964-main
+.LM2964:
+	mov $400,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rcx
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jae .L282
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L283
+.L282:
+	xor %rax,%rax
+	call v4__dpush
+.L283:
+.stabn 68,0,124,.LM2985-main
+.LM2985:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,125,.LM2989-main
+.LM2989:
+	mov $410,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%rcx
+	mov v4_max_Minusuint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jae .L284
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L285
+.L284:
+	xor %rax,%rax
+	call v4__dpush
+.L285:
+.stabn 68,0,125,.LM3010-main
+.LM3010:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,126,.LM3014-main
+.LM3014:
+	mov $420,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rcx
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jbe .L286
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L287
+.L286:
+	xor %rax,%rax
+	call v4__dpush
+.L287:
+.stabn 68,0,126,.LM3035-main
+.LM3035:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,127,.LM3039-main
+.LM3039:
+	mov $430,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusuint(%rip),%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jbe .L288
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L289
+.L288:
+	xor %rax,%rax
+	call v4__dpush
+.L289:
+.stabn 68,0,127,.LM3060-main
+.LM3060:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,128,.LM3064-main
+.LM3064:
+	mov $440,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	cmp %rdx,%rax
+	ja .L290
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L291
+.L290:
+	xor %rax,%rax
+	call v4__dpush
+.L291:
+.stabn 68,0,128,.LM3085-main
+.LM3085:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,129,.LM3089-main
+.LM3089:
+	mov $450,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rcx
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	ja .L292
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L293
+.L292:
+	xor %rax,%rax
+	call v4__dpush
+.L293:
+.stabn 68,0,129,.LM3110-main
+.LM3110:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,130,.LM3114-main
+.LM3114:
+	mov $460,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rcx
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jb .L294
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L295
+.L294:
+	xor %rax,%rax
+	call v4__dpush
+.L295:
+.stabn 68,0,130,.LM3135-main
+.LM3135:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,131,.LM3139-main
+.LM3139:
+	mov $470,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusuint(%rip),%rax
+	mov %rax,%rcx
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jb .L296
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L297
+.L296:
+	xor %rax,%rax
+	call v4__dpush
+.L297:
+.stabn 68,0,131,.LM3160-main
+.LM3160:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,132,.LM3164-main
+.LM3164:
+	mov $480,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	jne .L298
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L299
+.L298:
+	xor %rax,%rax
+	call v4__dpush
+.L299:
+.stabn 68,0,132,.LM3182-main
+.LM3182:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,133,.LM3186-main
+.LM3186:
+	mov $490,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	test %rax,%rax
+	jne .L300
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L301
+.L300:
+	xor %rax,%rax
+	call v4__dpush
+.L301:
+.stabn 68,0,133,.LM3204-main
+.LM3204:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,134,.LM3208-main
+.LM3208:
+	mov $500,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	test %rax,%rax
+	jge .L302
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L303
+.L302:
+	xor %rax,%rax
+	call v4__dpush
+.L303:
+.stabn 68,0,134,.LM3226-main
+.LM3226:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,135,.LM3230-main
+.LM3230:
+	mov $510,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	test %rax,%rax
+	jge .L304
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L305
+.L304:
+	xor %rax,%rax
+	call v4__dpush
+.L305:
+.stabn 68,0,135,.LM3248-main
+.LM3248:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,136,.LM3252-main
+.LM3252:
+	mov $520,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	test %rax,%rax
+	jle .L306
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L307
+.L306:
+	xor %rax,%rax
+	call v4__dpush
+.L307:
+.stabn 68,0,136,.LM3270-main
+.LM3270:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,137,.LM3274-main
+.LM3274:
+	mov $530,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	test %rax,%rax
+	jle .L308
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L309
+.L308:
+	xor %rax,%rax
+	call v4__dpush
+.L309:
+.stabn 68,0,137,.LM3292-main
+.LM3292:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,138,.LM3296-main
+.LM3296:
+	mov $540,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%rax
+	mov %rax,%rcx
+.stabn 68,0,109,.LM3302-main
+.LM3302:
+	mov $5,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jge .L310
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L311
+.L310:
+	xor %rax,%rax
+	call v4__dpush
+.L311:
+.stabn 68,0,138,.LM3317-main
+.LM3317:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,139,.LM3321-main
+.LM3321:
+	mov $550,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	mov %rax,%rcx
+.stabn 68,0,109,.LM3327-main
+.LM3327:
+	mov $5,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jge .L312
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L313
+.L312:
+	xor %rax,%rax
+	call v4__dpush
+.L313:
+.stabn 68,0,139,.LM3342-main
+.LM3342:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,140,.LM3346-main
+.LM3346:
+	mov $560,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rcx
+.stabn 68,0,109,.LM3352-main
+.LM3352:
+	mov $5,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jge .L314
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L315
+.L314:
+	xor %rax,%rax
+	call v4__dpush
+.L315:
+.stabn 68,0,140,.LM3367-main
+.LM3367:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,141,.LM3371-main
+.LM3371:
+	mov $570,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rcx
+.stabn 68,0,109,.LM3377-main
+.LM3377:
+	mov $5,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	jge .L316
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L317
+.L316:
+	xor %rax,%rax
+	call v4__dpush
+.L317:
+.stabn 68,0,141,.LM3392-main
+.LM3392:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,142,.LM3396-main
+.LM3396:
+	mov $580,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+.stabn 68,0,110,.LM3402-main
+.LM3402:
+	xor %rax,%rax
+	call v4__dpush
+.L318:
+	call v4_over
+	call v4__dpop
+	test %rax,%rax
+	jle .L319
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	call v4_swap
+	call v4__dpop
+	dec %rax
+	call v4__dpush
+	call v4_swap
+	jmp .L318
+.L319:
+	call v4_nip
+.stabn 68,0,142,.LM3424-main
+.LM3424:
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,143,.LM3428-main
+.LM3428:
+	mov $590,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+.stabn 68,0,110,.LM3434-main
+.LM3434:
+	xor %rax,%rax
+	call v4__dpush
+.L320:
+	call v4_over
+	call v4__dpop
+	test %rax,%rax
+	jle .L321
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	call v4_swap
+	call v4__dpop
+	dec %rax
+	call v4__dpush
+	call v4_swap
+	jmp .L320
+.L321:
+	call v4_nip
+.stabn 68,0,143,.LM3456-main
+.LM3456:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,144,.LM3460-main
+.LM3460:
+	mov $600,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+.stabn 68,0,110,.LM3466-main
+.LM3466:
+	xor %rax,%rax
+	call v4__dpush
+.L322:
+	call v4_over
+	call v4__dpop
+	test %rax,%rax
+	jle .L323
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	call v4_swap
+	call v4__dpop
+	dec %rax
+	call v4__dpush
+	call v4_swap
+	jmp .L322
+.L323:
+	call v4_nip
+.stabn 68,0,144,.LM3488-main
+.LM3488:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,145,.LM3492-main
+.LM3492:
+	mov $610,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+.stabn 68,0,111,.LM3498-main
+.LM3498:
+	xor %rax,%rax
+	call v4__dpush
+.L324:
+	call v4__dpop
+	inc %rax
+	call v4__dpush
+	call v4_z2dup
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jne .L324
+	call v4_nip
+.stabn 68,0,145,.LM3513-main
+.LM3513:
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,146,.LM3517-main
+.LM3517:
+	mov $620,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	mov $2,%rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	je .L325
+	call v4_drop
+	mov v4_Lesstrue_Greater(%rip),%rax
+	call v4__dpush
+.L325:
+.stabn 68,0,146,.LM3537-main
+.LM3537:
+	call v4_Minus_Greater
+	mov v4_Lesstrue_Greater(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,147,.LM3541-main
+.LM3541:
+	mov $630,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,%rcx
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %rcx,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	call v4__dpush
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	je .L326
+	call v4_drop
+	mov v4_Lesstrue_Greater(%rip),%rax
+	call v4__dpush
+.L326:
+.stabn 68,0,147,.LM3561-main
+.LM3561:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,150,.LM3565-main
+.LM3565:
+	lea .LC5(%rip),%rax
+	call v4__dpush
+	mov $21,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,178,.LM3571-main
+.LM3571:
+	mov $700,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov $99,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,179,.LM3581-main
+.LM3581:
+	mov $710,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov $10,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,180,.LM3591-main
+.LM3591:
+	mov $720,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov $13,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,181,.LM3601-main
+.LM3601:
+	mov $730,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov $15,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,182,.LM3611-main
+.LM3611:
+	mov $740,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%rax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov $106,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,183,.LM3621-main
+.LM3621:
+	mov $750,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+	mov $100,%rax
+	call v4__dpush
+	lea v4_Plus(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,184,.LM3636-main
+.LM3636:
+	mov $760,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_dense
+	call v4_Minus_Greater
+	mov v4_max_Minusint(%rip),%rax
+	call v4__dpush
+	mov $100,%rax
+	call v4__dpush
+	lea v4_Plus(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,185,.LM3651-main
+.LM3651:
+	mov $770,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-3,%rax
+	call v4__dpush
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,186,.LM3661-main
+.LM3661:
+	mov $780,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-2,%rax
+	call v4__dpush
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,187,.LM3671-main
+.LM3671:
+	mov $790,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_gapped
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,188,.LM3681-main
+.LM3681:
+	mov $800,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,189,.LM3691-main
+.LM3691:
+	mov $810,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+	call v4_gapped
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,190,.LM3701-main
+.LM3701:
+	mov $820,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%rax
+	call v4__dpush
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,191,.LM3711-main
+.LM3711:
+	mov $830,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-1000,%rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,192,.LM3721-main
+.LM3721:
+	mov $840,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,193,.LM3731-main
+.LM3731:
+	mov $850,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,194,.LM3741-main
+.LM3741:
+	mov $860,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $100,%rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $4,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,195,.LM3751-main
+.LM3751:
+	mov $870,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $1000,%rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,196,.LM3761-main
+.LM3761:
+	mov $880,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $65536,%rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $6,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,197,.LM3771-main
+.LM3771:
+	mov $890,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-1001,%rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,198,.LM3781-main
+.LM3781:
+	mov $900,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,199,.LM3791-main
+.LM3791:
+	mov $910,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $8,%rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,200,.LM3801-main
+.LM3801:
+	mov $920,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $999,%rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,201,.LM3811-main
+.LM3811:
+	mov $930,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $65537,%rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,202,.LM3821-main
+.LM3821:
+	mov $940,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,203,.LM3831-main
+.LM3831:
+	mov $950,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,204,.LM3841-main
+.LM3841:
+	mov $960,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_nodefault
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,205,.LM3849-main
+.LM3849:
+	mov $970,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $4,%rax
+	call v4__dpush
+	call v4_nodefault
+	call v4_Minus_Greater
+	mov $4,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,206,.LM3859-main
+.LM3859:
+	mov $980,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+	call v4_nodefault
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,209,.LM3867-main
+.LM3867:
+	lea .LC6(%rip),%rax
+	call v4__dpush
+	mov $48,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,228,.LM3873-main
+.LM3873:
+	xor %rax,%rax
+	mov %rax,v4_Hashdividends(%rip)
+.stabn 68,0,239,.LM3880-main
+.LM3880:
+	xor %rax,%rax
+	call v4__dpush
+	call v4_dividend_Comma
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_dividend_Comma
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov $2,%rax
+	call v4__dpush
+	call v4_dividend_Comma
+.stabn 68,0,240,.LM3892-main
+.LM3892:
+	mov $-2,%rax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov $7,%rax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov $-7,%rax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov $100,%rax
+	call v4__dpush
+	call v4_dividend_Comma
+.stabn 68,0,241,.LM3904-main
+.LM3904:
+	mov $-100,%rax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov $12345,%rax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov $-12345,%rax
+	call v4__dpush
+	call v4_dividend_Comma
+.stabn 68,0,242,.LM3913-main
+.LM3913:
+	mov v4_max_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov v4_max_Minusint(%rip),%rax
+	dec %rax
+	call v4__dpush
+	call v4_dividend_Comma
+.stabn 68,0,243,.LM3923-main
+.LM3923:
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_dividend_Comma
+	mov v4_min_Minusint(%rip),%rax
+	inc %rax
+	call v4__dpush
+	call v4_dividend_Comma
+.stabn 68,0,245,.LM3933-main
+.LM3933:
+	mov $1000,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash1(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	lea v4_Slash(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,246,.LM3947-main
+.LM3947:
+	mov $1010,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod1(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	lea v4_mod(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,247,.LM3961-main
+.LM3961:
+	mov $1020,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash2(%rip),%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	lea v4_Slash(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,248,.LM3975-main
+.LM3975:
+	mov $1030,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod2(%rip),%rax
+	call v4__dpush
+	mov $2,%rax
+	call v4__dpush
+	lea v4_mod(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,249,.LM3989-main
+.LM3989:
+	mov $1040,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash3(%rip),%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	lea v4_Slash(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,250,.LM4003-main
+.LM4003:
+	mov $1050,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod3(%rip),%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	lea v4_mod(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,251,.LM4017-main
+.LM4017:
+	mov $1060,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash_Minus3(%rip),%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+	lea v4_Slash(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,252,.LM4031-main
+.LM4031:
+	mov $1070,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod_Minus3(%rip),%rax
+	call v4__dpush
+	mov $-3,%rax
+	call v4__dpush
+	lea v4_mod(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,253,.LM4045-main
+.LM4045:
+	mov $1080,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash7(%rip),%rax
+	call v4__dpush
+	mov $7,%rax
+	call v4__dpush
+	lea v4_Slash(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,254,.LM4059-main
+.LM4059:
+	mov $1090,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod7(%rip),%rax
+	call v4__dpush
+	mov $7,%rax
+	call v4__dpush
+	lea v4_mod(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,255,.LM4073-main
+.LM4073:
+	mov $1100,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash8(%rip),%rax
+	call v4__dpush
+	mov $8,%rax
+	call v4__dpush
+	lea v4_Slash(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,256,.LM4087-main
+.LM4087:
+	mov $1110,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod8(%rip),%rax
+	call v4__dpush
+	mov $8,%rax
+	call v4__dpush
+	lea v4_mod(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,257,.LM4101-main
+.LM4101:
+	mov $1120,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash_Minus8(%rip),%rax
+	call v4__dpush
+	mov $-8,%rax
+	call v4__dpush
+	lea v4_Slash(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,258,.LM4115-main
+.LM4115:
+	mov $1130,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod_Minus8(%rip),%rax
+	call v4__dpush
+	mov $-8,%rax
+	call v4__dpush
+	lea v4_mod(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,259,.LM4129-main
+.LM4129:
+	mov $1140,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash10(%rip),%rax
+	call v4__dpush
+	mov $10,%rax
+	call v4__dpush
+	lea v4_Slash(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,260,.LM4143-main
+.LM4143:
+	mov $1150,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod10(%rip),%rax
+	call v4__dpush
+	mov $10,%rax
+	call v4__dpush
+	lea v4_mod(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,261,.LM4157-main
+.LM4157:
+	mov $1160,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Slash_Minus10(%rip),%rax
+	call v4__dpush
+	mov $-10,%rax
+	call v4__dpush
+	lea v4_Slash(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,262,.LM4171-main
+.LM4171:
+	mov $1170,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_mod_Minus10(%rip),%rax
+	call v4__dpush
+	mov $-10,%rax
+	call v4__dpush
+	lea v4_mod(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,263,.LM4185-main
+.LM4185:
+	mov $1180,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star0(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	lea v4_Star(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,264,.LM4199-main
+.LM4199:
+	mov $1190,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star1(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	lea v4_Star(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,265,.LM4213-main
+.LM4213:
+	mov $1200,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star_Minus1(%rip),%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	lea v4_Star(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,266,.LM4227-main
+.LM4227:
+	mov $1210,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star3(%rip),%rax
+	call v4__dpush
+	mov $3,%rax
+	call v4__dpush
+	lea v4_Star(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,267,.LM4241-main
+.LM4241:
+	mov $1220,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star8(%rip),%rax
+	call v4__dpush
+	mov $8,%rax
+	call v4__dpush
+	lea v4_Star(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,268,.LM4255-main
+.LM4255:
+	mov $1230,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star_Minus8(%rip),%rax
+	call v4__dpush
+	mov $-8,%rax
+	call v4__dpush
+	lea v4_Star(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,269,.LM4269-main
+.LM4269:
+	mov $1240,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star10(%rip),%rax
+	call v4__dpush
+	mov $10,%rax
+	call v4__dpush
+	lea v4_Star(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,270,.LM4283-main
+.LM4283:
+	mov $1250,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_Star_Minus7(%rip),%rax
+	call v4__dpush
+	mov $-7,%rax
+	call v4__dpush
+	lea v4_Star(%rip),%rax
+	call v4__dpush
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,274,.LM4297-main
+.LM4297:
+	mov $1270,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+.stabn 68,0,220,.LM4303-main
+.LM4303:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slash
+.stabn 68,0,274,.LM4306-main
+.LM4306:
+	call v4_Minus_Greater
+	mov $-7,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,275,.LM4310-main
+.LM4310:
+	mov $1280,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	call v4__dpush
+.stabn 68,0,220,.LM4316-main
+.LM4316:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slash
+.stabn 68,0,275,.LM4319-main
+.LM4319:
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,276,.LM4323-main
+.LM4323:
+	mov $1290,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	call v4__dpush
+.stabn 68,0,220,.LM4329-main
+.LM4329:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slash
+.stabn 68,0,276,.LM4332-main
+.LM4332:
+	call v4_Minus_Greater
+	mov v4_max_Minusint(%rip),%rax
+	neg %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,277,.LM4340-main
+.LM4340:
+	mov $1300,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,220,.LM4350-main
+.LM4350:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Slash
+.stabn 68,0,277,.LM4353-main
+.LM4353:
+	call v4_Minus_Greater
+	mov v4_max_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,278,.LM4357-main
+.LM4357:
+	mov $1310,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+.stabn 68,0,220,.LM4363-main
+.LM4363:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_mod
+.stabn 68,0,278,.LM4366-main
+.LM4366:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,279,.LM4370-main
+.LM4370:
+	mov $1320,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	inc %rax
+	call v4__dpush
+.stabn 68,0,220,.LM4380-main
+.LM4380:
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_mod
+.stabn 68,0,279,.LM4383-main
+.LM4383:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,280,.LM4387-main
+.LM4387:
+	mov $1330,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $61,%rdx
+	add %rdx,%rax
+	sar $3,%rax
+	neg %rax
+	call v4__dpush
+.stabn 68,0,280,.LM4399-main
+.LM4399:
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+	mov $-8,%rax
+	call v4__dpush
+	lea v4_Slash(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,281,.LM4408-main
+.LM4408:
+	mov $1340,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $24,%rax
+	call v4__dpush
+.stabn 68,0,281,.LM4415-main
+.LM4415:
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	lea v4_cells(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,282,.LM4422-main
+.LM4422:
+	mov $1350,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	inc %rax
+	shl $3,%rax
+	call v4__dpush
+.stabn 68,0,282,.LM4436-main
+.LM4436:
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	inc %rax
+	call v4__dpush
+	lea v4_cells(%rip),%rax
+	call v4__dpush
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,285,.LM4447-main
+.LM4447:
+	lea .LC7(%rip),%rax
+	call v4__dpush
+	mov $31,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,287,.LM4453-main
+.LM4453:
+	mov $100,%rax
+	mov %rax,v4_hundred(%rip)
+.stabn 68,0,288,.LM4457-main
+.LM4457:
+	xor %rax,%rax
+	dec %rax
+	mov %rax,v4_minus_Minusone(%rip)
+.stabn 68,0,290,.LM4461-main
+.LM4461:
+	movabs $9223372036854775807,%rax
+	mov %rax,v4_biggest(%rip)
+.stabn 68,0,294,.LM4465-main
+.LM4465:
+	mov $300,%rax
+	mov %rax,v4_three_Minushundred(%rip)
+.stabn 68,0,295,.LM4472-main
+.LM4472:
+	xor %rax,%rax
+	mov %rax,v4_zero(%rip)
+.stabn 68,0,309,.LM4476-main
+.LM4476:
+	mov $1400,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,297,.LM4480-main
+.LM4480:
+	mov $200,%rax
+	call v4__dpush
+.stabn 68,0,309,.LM4483-main
+.LM4483:
+	call v4_Minus_Greater
+	mov $200,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,310,.LM4487-main
+.LM4487:
+	mov $1410,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,298,.LM4491-main
+.LM4491:
+	mov $4,%rax
+	call v4__dpush
+.stabn 68,0,310,.LM4496-main
+.LM4496:
+	call v4_Minus_Greater
+	mov $4,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,311,.LM4500-main
+.LM4500:
+	mov $1420,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,299,.LM4504-main
+.LM4504:
+	movabs $-9223372036854775808,%rax
+	call v4__dpush
+.stabn 68,0,311,.LM4507-main
+.LM4507:
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,312,.LM4511-main
+.LM4511:
+	mov $1430,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,300,.LM4515-main
+.LM4515:
+	mov $301,%rax
+	call v4__dpush
+.stabn 68,0,312,.LM4518-main
+.LM4518:
+	call v4_Minus_Greater
+	mov $301,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,313,.LM4522-main
+.LM4522:
+	mov $1440,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-100,%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $-100,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,314,.LM4537-main
+.LM4537:
+	mov $1450,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,315,.LM4547-main
+.LM4547:
+	mov $1460,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $100,%rax
+	call v4__dpush
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	mov $2,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,316,.LM4557-main
+.LM4557:
+	mov $1470,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,317,.LM4567-main
+.LM4567:
+	mov $1480,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	mov $4,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,318,.LM4577-main
+.LM4577:
+	mov $1490,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,319,.LM4587-main
+.LM4587:
+	mov $1500,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $7,%rax
+	call v4__dpush
+	lea v4_use_Minuszero(%rip),%rax
+	call v4__dpush
+	call v4_catch
+	call v4_nip
+	call v4_Minus_Greater
+	mov $-10,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,322,.LM4600-main
+.LM4600:
+	lea .LC8(%rip),%rax
+	call v4__dpush
+	mov $16,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,345,.LM4606-main
+.LM4606:
+	mov $1800,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $-7,%rax
+	call v4__dpush
+	mov $50,%rax
+	call v4__dpush
+	mov $300,%rax
+	call v4__dpush
+.stabn 68,0,325,.LM4617-main
+.LM4617:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L350
+	call v4_drop
+	xor %rax,%rax
+	call v4__dpush
+	jmp .L352
+.L350:
+.stabn 68,0,326,.LM4628-main
+.LM4628:
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L351
+	call v4_drop
+	mov $100,%rax
+	call v4__dpush
+.L351:
+.L352:
+.stabn 68,0,336,.LM4643-main
+.LM4643:
+	call v4_rot
+.stabn 68,0,325,.LM4645-main
+.LM4645:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L353
+	call v4_drop
+	xor %rax,%rax
+	call v4__dpush
+	jmp .L355
+.L353:
+.stabn 68,0,326,.LM4656-main
+.LM4656:
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L354
+	call v4_drop
+	mov $100,%rax
+	call v4__dpush
+.L354:
+.L355:
+.stabn 68,0,336,.LM4671-main
+.LM4671:
+	call v4_rot
+.stabn 68,0,325,.LM4673-main
+.LM4673:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L356
+	call v4_drop
+	xor %rax,%rax
+	call v4__dpush
+	jmp .L358
+.L356:
+.stabn 68,0,326,.LM4684-main
+.LM4684:
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L357
+	call v4_drop
+	mov $100,%rax
+	call v4__dpush
+.L357:
+.L358:
+.stabn 68,0,336,.LM4699-main
+.LM4699:
+	call v4_rot
+.stabn 68,0,345,.LM4700-main
+.LM4700:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	mov $50,%rax
+	call v4__dpush
+	mov $100,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,346,.LM4708-main
+.LM4708:
+	mov $1810,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,337,.LM4712-main
+.LM4712:
+	mov $-5,%rax
+	call v4__dpush
+	call v4_sign
+	xor %rax,%rax
+	call v4__dpush
+	call v4_sign
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+	call v4_sign
+.stabn 68,0,346,.LM4721-main
+.LM4721:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,347,.LM4729-main
+.LM4729:
+	mov $1820,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	call v4__dpush
+.stabn 68,0,338,.LM4735-main
+.LM4735:
+	call v4_twice
+	call v4_twice
+.stabn 68,0,347,.LM4737-main
+.LM4737:
+	call v4_Minus_Greater
+	mov $12,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,348,.LM4741-main
+.LM4741:
+	mov $1830,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_sum_Minusi
+	call v4_Minus_Greater
+	mov $10,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,349,.LM4749-main
+.LM4749:
+	mov $1840,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_sum_Minusi_Minusnoinline
+	call v4_Minus_Greater
+	mov $10,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,350,.LM4757-main
+.LM4757:
+	mov $1850,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_sum_Minusj
+	call v4_Minus_Greater
+	mov $6,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,351,.LM4765-main
+.LM4765:
+	mov $1860,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,342,.LM4769-main
+.LM4769:
+	mov $10,%rax
+	call v4__dpush
+	call v4_find_Minusfirst
+	mov $3,%rax
+	call v4__dpush
+	call v4_find_Minusfirst
+.stabn 68,0,351,.LM4775-main
+.LM4775:
+	call v4_Minus_Greater
+	mov $4,%rax
+	call v4__dpush
+	xor %rax,%rax
+	dec %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,352,.LM4781-main
+.LM4781:
+	mov $1870,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	call v4_use_Minusin_Minusloop
+	call v4_Minus_Greater
+	mov $250,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,353,.LM4789-main
+.LM4789:
+	mov $1880,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $10,%rax
+	call v4__dpush
+	call v4_factorial
+	call v4_Minus_Greater
+	mov $3628800,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,354,.LM4799-main
+.LM4799:
+	mov $1890,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	call v4__dpush
+.stabn 68,0,325,.LM4805-main
+.LM4805:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L327
+	call v4_drop
+	xor %rax,%rax
+	call v4__dpush
+	jmp .L329
+.L327:
+.stabn 68,0,326,.LM4816-main
+.LM4816:
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L328
+	call v4_drop
+	mov $100,%rax
+	call v4__dpush
+.L328:
+.L329:
+.stabn 68,0,354,.LM4831-main
+.LM4831:
+	mov v4_min_Minusint(%rip),%rax
+	call v4__dpush
+.stabn 68,0,325,.LM4834-main
+.LM4834:
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	jge .L330
+	call v4_drop
+	xor %rax,%rax
+	call v4__dpush
+	jmp .L332
+.L330:
+.stabn 68,0,326,.LM4845-main
+.LM4845:
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jle .L331
+	call v4_drop
+	mov $100,%rax
+	call v4__dpush
+.L331:
+.L332:
+.stabn 68,0,354,.LM4860-main
+.LM4860:
+	call v4_Minus_Greater
+	mov $100,%rax
+	call v4__dpush
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,357,.LM4866-main
+.LM4866:
+	lea .LC9(%rip),%rax
+	call v4__dpush
+	mov $31,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,367,.LM4872-main
+.LM4872:
+	mov $1900,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $3,%rax
+	mov %rax,v4_step(%rip)
+	mov $10,%rax
+	call v4__dpush
+	call v4_sum_Minusstep
+	call v4_Minus_Greater
+	mov $30,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,368,.LM4889-main
+.LM4889:
+	mov $1910,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,v4_step(%rip)
+	mov $4,%rax
+	call v4__dpush
+	call v4_bump_Minusstep
+	mov v4_step(%rip),%rax
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $10,%rax
+	call v4__dpush
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,369,.LM4913-main
+.LM4913:
+	mov $1920,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,v4_step(%rip)
+	mov $2,%rax
+	call v4__dpush
+	call v4_sum_Minusstep_Minus2
+	call v4_Minus_Greater
+	mov $15,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,372,.LM4930-main
+.LM4930:
+	lea .LC10(%rip),%rax
+	call v4__dpush
+	mov $25,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,389,.LM4936-main
+.LM4936:
+	mov $2000,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $6,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	call v4__dpush
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $6,%rax
+	call v4__dpush
+	mov $6,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,390,.LM4963-main
+.LM4963:
+	mov $2010,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $8,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	call v4__dpush
+	call v4__dpush
+.stabn 68,0,390,.LM4984-main
+.LM4984:
+	call v4_Minus_Greater
+	mov $8,%rax
+	call v4__dpush
+	mov $8,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,391,.LM4990-main
+.LM4990:
+	mov $2020,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rcx
+	mov $2,%rax
+	mov %rcx,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	call v4__dpush
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,392,.LM5017-main
+.LM5017:
+	mov $2030,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_cell_Minusv(%rip),%rax
+	call v4__dpush
+.stabn 68,0,384,.LM5023-main
+.LM5023:
+	mov $5,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov $9,%rax
+	call v4__dpush
+	call v4_swap
+	call v4_Store
+	mov v4_cell_Minusv(%rip),%rax
+	call v4__dpush
+.stabn 68,0,392,.LM5039-main
+.LM5039:
+	call v4_Minus_Greater
+	mov $9,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,393,.LM5043-main
+.LM5043:
+	mov $2040,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_cell_Minusv(%rip),%rax
+	call v4__dpush
+.stabn 68,0,385,.LM5049-main
+.LM5049:
+	xor %rax,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov $7,%rax
+	call v4__dpush
+	call v4_swap
+	call v4_c_Store
+	mov v4_cell_Minusv(%rip),%rax
+	call v4__dpush
+.stabn 68,0,393,.LM5065-main
+.LM5065:
+	call v4_Minus_Greater
+	mov $7,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,394,.LM5069-main
+.LM5069:
+	mov $2050,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	lea v4_cell_Minusv(%rip),%rax
+	call v4__dpush
+.stabn 68,0,386,.LM5075-main
+.LM5075:
+	mov $3,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	call v4_Fetch
+	mov $4,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	call v4__dpush
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	mov $4,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,395,.LM5101-main
+.LM5101:
+	mov $2060,%rax
+	call v4__dpush
+	call v4_Leftbrace
+.stabn 68,0,387,.LM5105-main
+.LM5105:
+	mov $5,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	call v4__dpush
+	call v4_set_Minuscell_Minusv
+	mov v4_cell_Minusv(%rip),%rax
+	call v4__dpush
+.stabn 68,0,395,.LM5123-main
+.LM5123:
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	mov $11,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,398,.LM5129-main
+.LM5129:
+	lea .LC11(%rip),%rax
+	call v4__dpush
+	mov $40,%rax
+	call v4__dpush
+	call v4__type
+	call v4_cr
+.stabn 68,0,414,.LM5135-main
+.LM5135:
+	mov $2100,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	je .L333
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	je .L334
+	call v4_drop
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L335
+.L333:
+	call v4_drop
+	mov $3,%rax
+	call v4__dpush
+.L334:
+.L335:
+.stabn 68,0,414,.LM5158-main
+.LM5158:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,415,.LM5162-main
+.LM5162:
+	mov $2110,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	xor %rax,%rax
+	inc %rax
+	je .L336
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	je .L337
+	call v4_drop
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L338
+.L336:
+	call v4_drop
+	mov $3,%rax
+	call v4__dpush
+.L337:
+.L338:
+.stabn 68,0,415,.LM5185-main
+.LM5185:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,416,.LM5189-main
+.LM5189:
+	mov $2120,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $5,%rax
+	call v4__dpush
+	xor %rax,%rax
+	je .L339
+	call v4_dup
+	call v4__dpop
+	test %rax,%rax
+	je .L340
+	call v4_drop
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+	jmp .L341
+.L339:
+	call v4_drop
+	mov $3,%rax
+	call v4__dpush
+.L340:
+.L341:
+.stabn 68,0,416,.LM5212-main
+.LM5212:
+	call v4_Minus_Greater
+	mov $3,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,417,.LM5216-main
+.LM5216:
+	mov $2130,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $10,%rax
+	call v4__dpush
+	call v4_count_Minusodd
+	call v4_Minus_Greater
+	mov $5,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,418,.LM5226-main
+.LM5226:
+	mov $2140,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+	call v4_count_Minusodd
+	call v4_Minus_Greater
+	xor %rax,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,419,.LM5236-main
+.LM5236:
+	mov $2150,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov v4_Lesstrue_Greater(%rip),%rax
+	test %rax,%rax
+	jne .L343
+.L342:
+	jmp .L342
+.L343:
+.stabn 68,0,419,.LM5250-main
+.LM5250:
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,420,.LM5252-main
+.LM5252:
+	mov $2160,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush
+.L344:
+	call v4_dup
+	mov $10,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L345
+	call v4__dpop
+	inc %rax
+	add %rax,%rax
+	call v4__dpush
+	jmp .L344
+.L345:
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+.stabn 68,0,420,.LM5285-main
+.LM5285:
+	call v4_Minus_Greater
+	mov $110,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,421,.LM5289-main
+.LM5289:
+	mov $2170,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	xor %rax,%rax
+	call v4__dpush
+.L346:
+	call v4_dup
+	mov $10,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L347
+	call v4__dpop
+	inc %rax
+	add %rax,%rax
+	call v4__dpush
+	jmp .L346
+.L347:
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+.stabn 68,0,421,.LM5322-main
+.LM5322:
+	call v4_Minus_Greater
+	mov $114,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,422,.LM5326-main
+.LM5326:
+	mov $2180,%rax
+	call v4__dpush
+	call v4_Leftbrace
+	mov $20,%rax
+	call v4__dpush
+.L348:
+	call v4_dup
+	mov $10,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jge .L349
+	call v4__dpop
+	inc %rax
+	add %rax,%rax
+	call v4__dpush
+	jmp .L348
+.L349:
+	mov $100,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+.stabn 68,0,422,.LM5359-main
+.LM5359:
+	call v4_Minus_Greater
+	mov $120,%rax
+	call v4__dpush
+	call v4_Rightbrace
+.stabn 68,0,424,.LM5363-main
+.LM5363:
+	call v4_test_Minusstatus
+	call v4_Fetch
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE1:
+.stabn 68,0,424,.LM5367-main
+.LM5367:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe1:
+	.size	 main,.Lfe1-main
+.stabn	192,0,0,.LBB1-main
+.stabn	224,0,0,.LBE1-main
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,15335 @@
+	.file	"test_optstk.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"test_optstk.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC5:
+	.string "TESTING CASE DISPATCH"
+.LC4:
+	.string "TESTING COMPARE AND BRANCH"
+.LC1:
+	.string "TESTING CONSTANT FOLDING AT CELL WIDTH"
+.LC7:
+	.string "TESTING CONSTANTS AS IMMEDIATES"
+.LC8:
+	.string "TESTING INLINING"
+.LC11:
+	.string "TESTING JUMP THREADING AND BLOCK MERGING"
+.LC3:
+	.string "TESTING LEAF WORDS"
+.LC9:
+	.string "TESTING LOOP INVARIANT HOISTING"
+.LC6:
+	.string "TESTING MULTIPLICATION AND DIVISION BY CONSTANTS"
+.LC0:
+	.string "TESTING OPTIMIZER"
+.LC2:
+	.string "TESTING TAIL CALLS"
+.LC10:
+	.string "TESTING VARIABLE ACCESSES"
+.stabs	"v4_Hashdividends:G2",40,0,0,v4_Hashdividends
+	.comm  v4_Hashdividends,8,8
+.stabs	"v4_Lessfalse_Greater:G2",40,0,0,v4_Lessfalse_Greater
+	.comm  v4_Lessfalse_Greater,8,8
+.stabs	"v4_Lesstrue_Greater:G2",40,0,0,v4_Lesstrue_Greater
+	.comm  v4_Lesstrue_Greater,8,8
+.stabs	"v4_biggest:G2",40,0,0,v4_biggest
+	.comm  v4_biggest,8,8
+.stabs	"v4_cell_Minusv:G2",40,0,0,v4_cell_Minusv
+	.comm  v4_cell_Minusv,8,8
+.stabs	"v4_dividends:Gar2;0;15;2",40,0,0,v4_dividends
+	.comm  v4_dividends,128,32
+.stabs	"v4_hundred:G2",40,0,0,v4_hundred
+	.comm  v4_hundred,8,8
+.stabs	"v4_leaf_Minusvar:G2",40,0,0,v4_leaf_Minusvar
+	.comm  v4_leaf_Minusvar,8,8
+.stabs	"v4_max_Minusint:G2",40,0,0,v4_max_Minusint
+	.comm  v4_max_Minusint,8,8
+.stabs	"v4_max_Minusuint:G2",40,0,0,v4_max_Minusuint
+	.comm  v4_max_Minusuint,8,8
+.stabs	"v4_min_Minusint:G2",40,0,0,v4_min_Minusint
+	.comm  v4_min_Minusint,8,8
+.stabs	"v4_minus_Minusone:G2",40,0,0,v4_minus_Minusone
+	.comm  v4_minus_Minusone,8,8
+.stabs	"v4_step:G2",40,0,0,v4_step
+	.comm  v4_step,8,8
+.stabs	"v4_three_Minushundred:G2",40,0,0,v4_three_Minushundred
+	.comm  v4_three_Minushundred,8,8
+.stabs	"v4_zero:G2",40,0,0,v4_zero
+	.comm  v4_zero,8,8
+.text
+	.align 4
+.stabs "v4_fold1:F1",36,0,0,v4_fold1
+.globl v4_fold1
+	.type	v4_fold1,@function
+v4_fold1:
+.stabn 68,0,21,.LMa0-v4_fold1
+.LMa0:
+.stabn 68,0,21,.LMb0-v4_fold1
+.LMb0:
+.LBB14:
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS0
+	call v4__dscheck
+.LDS0:
+	mov %rcx,v4__dsindex(%rip)
+.LBE14:
+.stabn 68,0,21,.LM10-v4_fold1
+.LM10:
+	ret
+.Lfe14:
+	.size	 v4_fold1,.Lfe14-v4_fold1
+.stabn	192,0,0,.LBB14-v4_fold1
+.stabn	224,0,0,.LBE14-v4_fold1
+.Lscope14:
+.stabs	"",36,0,0,.Lscope14-v4_fold1
+.text
+	.align 4
+.stabs "v4_fold2:F1",36,0,0,v4_fold2
+.globl v4_fold2
+	.type	v4_fold2,@function
+v4_fold2:
+.stabn 68,0,22,.LMa11-v4_fold2
+.LMa11:
+.stabn 68,0,22,.LMb11-v4_fold2
+.LMb11:
+.LBB17:
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS1
+	call v4__dscheck
+.LDS1:
+	mov %rcx,v4__dsindex(%rip)
+.LBE17:
+.stabn 68,0,22,.LM18-v4_fold2
+.LM18:
+	ret
+.Lfe17:
+	.size	 v4_fold2,.Lfe17-v4_fold2
+.stabn	192,0,0,.LBB17-v4_fold2
+.stabn	224,0,0,.LBE17-v4_fold2
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-v4_fold2
+.text
+	.align 4
+.stabs "v4_fold3:F1",36,0,0,v4_fold3
+.globl v4_fold3
+	.type	v4_fold3,@function
+v4_fold3:
+.stabn 68,0,23,.LMa19-v4_fold3
+.LMa19:
+.stabn 68,0,23,.LMb19-v4_fold3
+.LMb19:
+.LBB18:
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS2
+	call v4__dscheck
+.LDS2:
+	mov %rcx,v4__dsindex(%rip)
+.LBE18:
+.stabn 68,0,23,.LM27-v4_fold3
+.LM27:
+	ret
+.Lfe18:
+	.size	 v4_fold3,.Lfe18-v4_fold3
+.stabn	192,0,0,.LBB18-v4_fold3
+.stabn	224,0,0,.LBE18-v4_fold3
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4_fold3
+.text
+	.align 4
+.stabs "v4_fold4:F1",36,0,0,v4_fold4
+.globl v4_fold4
+	.type	v4_fold4,@function
+v4_fold4:
+.stabn 68,0,24,.LMa28-v4_fold4
+.LMa28:
+.stabn 68,0,24,.LMb28-v4_fold4
+.LMb28:
+.LBB20:
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS3
+	call v4__dscheck
+.LDS3:
+	mov %rcx,v4__dsindex(%rip)
+.LBE20:
+.stabn 68,0,24,.LM37-v4_fold4
+.LM37:
+	ret
+.Lfe20:
+	.size	 v4_fold4,.Lfe20-v4_fold4
+.stabn	192,0,0,.LBB20-v4_fold4
+.stabn	224,0,0,.LBE20-v4_fold4
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4_fold4
+.text
+	.align 4
+.stabs "v4_fold5:F1",36,0,0,v4_fold5
+.globl v4_fold5
+	.type	v4_fold5,@function
+v4_fold5:
+.stabn 68,0,26,.LMa38-v4_fold5
+.LMa38:
+.stabn 68,0,26,.LMb38-v4_fold5
+.LMb38:
+.LBB24:
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS4
+	call v4__dscheck
+.LDS4:
+	mov %rcx,v4__dsindex(%rip)
+.LBE24:
+.stabn 68,0,26,.LM45-v4_fold5
+.LM45:
+	ret
+.Lfe24:
+	.size	 v4_fold5,.Lfe24-v4_fold5
+.stabn	192,0,0,.LBB24-v4_fold5
+.stabn	224,0,0,.LBE24-v4_fold5
+.Lscope24:
+.stabs	"",36,0,0,.Lscope24-v4_fold5
+.text
+	.align 4
+.stabs "v4_fold6:F1",36,0,0,v4_fold6
+.globl v4_fold6
+	.type	v4_fold6,@function
+v4_fold6:
+.stabn 68,0,27,.LMa46-v4_fold6
+.LMa46:
+.stabn 68,0,27,.LMb46-v4_fold6
+.LMb46:
+.LBB25:
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS5
+	call v4__dscheck
+.LDS5:
+	mov %rcx,v4__dsindex(%rip)
+.LBE25:
+.stabn 68,0,27,.LM51-v4_fold6
+.LM51:
+	ret
+.Lfe25:
+	.size	 v4_fold6,.Lfe25-v4_fold6
+.stabn	192,0,0,.LBB25-v4_fold6
+.stabn	224,0,0,.LBE25-v4_fold6
+.Lscope25:
+.stabs	"",36,0,0,.Lscope25-v4_fold6
+.text
+	.align 4
+.stabs "v4_fold7:F1",36,0,0,v4_fold7
+.globl v4_fold7
+	.type	v4_fold7,@function
+v4_fold7:
+.stabn 68,0,32,.LMa52-v4_fold7
+.LMa52:
+.stabn 68,0,32,.LMb52-v4_fold7
+.LMb52:
+.LBB26:
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS6
+	call v4__dscheck
+.LDS6:
+	mov %rcx,v4__dsindex(%rip)
+.LBE26:
+.stabn 68,0,32,.LM57-v4_fold7
+.LM57:
+	ret
+.Lfe26:
+	.size	 v4_fold7,.Lfe26-v4_fold7
+.stabn	192,0,0,.LBB26-v4_fold7
+.stabn	224,0,0,.LBE26-v4_fold7
+.Lscope26:
+.stabs	"",36,0,0,.Lscope26-v4_fold7
+.text
+	.align 4
+.stabs "v4_fold8:F1",36,0,0,v4_fold8
+.globl v4_fold8
+	.type	v4_fold8,@function
+v4_fold8:
+.stabn 68,0,33,.LMa58-v4_fold8
+.LMa58:
+.stabn 68,0,33,.LMb58-v4_fold8
+.LMb58:
+.LBB28:
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS7
+	call v4__dscheck
+.LDS7:
+	mov %rcx,v4__dsindex(%rip)
+.LBE28:
+.stabn 68,0,33,.LM67-v4_fold8
+.LM67:
+	ret
+.Lfe28:
+	.size	 v4_fold8,.Lfe28-v4_fold8
+.stabn	192,0,0,.LBB28-v4_fold8
+.stabn	224,0,0,.LBE28-v4_fold8
+.Lscope28:
+.stabs	"",36,0,0,.Lscope28-v4_fold8
+.text
+	.align 4
+.stabs "v4_fold9:F1",36,0,0,v4_fold9
+.globl v4_fold9
+	.type	v4_fold9,@function
+v4_fold9:
+.stabn 68,0,34,.LMa68-v4_fold9
+.LMa68:
+.stabn 68,0,34,.LMb68-v4_fold9
+.LMb68:
+.LBB29:
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS8
+	call v4__dscheck
+.LDS8:
+	mov %rcx,v4__dsindex(%rip)
+.LBE29:
+.stabn 68,0,34,.LM84-v4_fold9
+.LM84:
+	ret
+.Lfe29:
+	.size	 v4_fold9,.Lfe29-v4_fold9
+.stabn	192,0,0,.LBB29-v4_fold9
+.stabn	224,0,0,.LBE29-v4_fold9
+.Lscope29:
+.stabs	"",36,0,0,.Lscope29-v4_fold9
+.text
+	.align 4
+.stabs "v4_fold10:F1",36,0,0,v4_fold10
+.globl v4_fold10
+	.type	v4_fold10,@function
+v4_fold10:
+.stabn 68,0,35,.LMa85-v4_fold10
+.LMa85:
+.stabn 68,0,35,.LMb85-v4_fold10
+.LMb85:
+.LBB34:
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS9
+	call v4__dscheck
+.LDS9:
+	mov %rcx,v4__dsindex(%rip)
+.LBE34:
+.stabn 68,0,35,.LM99-v4_fold10
+.LM99:
+	ret
+.Lfe34:
+	.size	 v4_fold10,.Lfe34-v4_fold10
+.stabn	192,0,0,.LBB34-v4_fold10
+.stabn	224,0,0,.LBE34-v4_fold10
+.Lscope34:
+.stabs	"",36,0,0,.Lscope34-v4_fold10
+.text
+	.align 4
+.stabs "v4_fold11:F1",36,0,0,v4_fold11
+.globl v4_fold11
+	.type	v4_fold11,@function
+v4_fold11:
+.stabn 68,0,36,.LMa100-v4_fold11
+.LMa100:
+.stabn 68,0,36,.LMb100-v4_fold11
+.LMb100:
+.LBB38:
+	mov v4_max_Minusuint(%rip),%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS10
+	call v4__dscheck
+.LDS10:
+	mov %rcx,v4__dsindex(%rip)
+.LBE38:
+.stabn 68,0,36,.LM111-v4_fold11
+.LM111:
+	ret
+.Lfe38:
+	.size	 v4_fold11,.Lfe38-v4_fold11
+.stabn	192,0,0,.LBB38-v4_fold11
+.stabn	224,0,0,.LBE38-v4_fold11
+.Lscope38:
+.stabs	"",36,0,0,.Lscope38-v4_fold11
+.text
+	.align 4
+.stabs "v4_countdown:F1",36,0,0,v4_countdown
+.globl v4_countdown
+	.type	v4_countdown,@function
+v4_countdown:
+.stabn 68,0,55,.LMa112-v4_countdown
+.LMa112:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,55,.LMb112-v4_countdown
+.LMb112:
+.LBB42:
+	mov v4__dsindex(%rip),%rcx
+.L359:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS11
+	call v4__dscheck
+.LDS11:
+	test %rax,%rax
+	jne .L13
+	jmp .L12
+.L13:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	dec %rax
+	cmp $4080,%rcx
+	jbe .LDS12
+	call v4__dscheck
+.LDS12:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS13
+	call v4__dscheck
+.LDS13:
+	jmp .L359
+.L12:
+	mov %rcx,v4__dsindex(%rip)
+.LBE42:
+.stabn 68,0,55,.LM128-v4_countdown
+.LM128:
+	pop %rbx
+	leave
+	ret
+.Lfe42:
+	.size	 v4_countdown,.Lfe42-v4_countdown
+.stabn	192,0,0,.LBB42-v4_countdown
+.stabn	224,0,0,.LBE42-v4_countdown
+.Lscope42:
+.stabs	"",36,0,0,.Lscope42-v4_countdown
+.text
+	.align 4
+.stabs "v4_sumto:F1",36,0,0,v4_sumto
+.globl v4_sumto
+	.type	v4_sumto,@function
+v4_sumto:
+.stabn 68,0,56,.LMa129-v4_sumto
+.LMa129:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,56,.LMb129-v4_sumto
+.LMb129:
+.LBB45:
+	mov v4__dsindex(%rip),%rcx
+.L360:
+.stabn 68,0,57,.LM131-v4_sumto
+.LM131:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS14
+	call v4__dscheck
+.LDS14:
+	test %rax,%rax
+	jne .L15
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_drop
+	mov v4__dsindex(%rip),%rcx
+.L15:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	call v4_over
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS15
+	call v4__dscheck
+.LDS15:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS16
+	call v4__dscheck
+.LDS16:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	dec %rax
+	cmp $4080,%rcx
+	jbe .LDS17
+	call v4__dscheck
+.LDS17:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS18
+	call v4__dscheck
+.LDS18:
+	jmp .L360
+	mov %rcx,v4__dsindex(%rip)
+.LBE45:
+.stabn 68,0,57,.LM154-v4_sumto
+.LM154:
+	pop %rbx
+	leave
+	ret
+.Lfe45:
+	.size	 v4_sumto,.Lfe45-v4_sumto
+.stabn	192,0,0,.LBB45-v4_sumto
+.stabn	224,0,0,.LBE45-v4_sumto
+.Lscope45:
+.stabs	"",36,0,0,.Lscope45-v4_sumto
+.text
+	.align 4
+.stabs "v4_tail2:F1",36,0,0,v4_tail2
+.globl v4_tail2
+	.type	v4_tail2,@function
+v4_tail2:
+.stabn 68,0,58,.LMa155-v4_tail2
+.LMa155:
+.stabn 68,0,58,.LMb155-v4_tail2
+.LMb155:
+.LBB49:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS19
+	call v4__dscheck
+.LDS19:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS20
+	call v4__dscheck
+.LDS20:
+	mov %rcx,v4__dsindex(%rip)
+.LBE49:
+.stabn 68,0,58,.LM161-v4_tail2
+.LM161:
+	ret
+.Lfe49:
+	.size	 v4_tail2,.Lfe49-v4_tail2
+.stabn	192,0,0,.LBB49-v4_tail2
+.stabn	224,0,0,.LBE49-v4_tail2
+.Lscope49:
+.stabs	"",36,0,0,.Lscope49-v4_tail2
+.text
+	.align 4
+.stabs "v4_tail1:F1",36,0,0,v4_tail1
+.globl v4_tail1
+	.type	v4_tail1,@function
+v4_tail1:
+.stabn 68,0,59,.LMa162-v4_tail1
+.LMa162:
+.stabn 68,0,59,.LMb162-v4_tail1
+.LMb162:
+.LBB50:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rax,%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS21
+	call v4__dscheck
+.LDS21:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS22
+	call v4__dscheck
+.LDS22:
+	mov %rcx,v4__dsindex(%rip)
+.LBE50:
+.stabn 68,0,59,.LM173-v4_tail1
+.LM173:
+	ret
+.Lfe50:
+	.size	 v4_tail1,.Lfe50-v4_tail1
+.stabn	192,0,0,.LBB50-v4_tail1
+.stabn	224,0,0,.LBE50-v4_tail1
+.Lscope50:
+.stabs	"",36,0,0,.Lscope50-v4_tail1
+.text
+	.align 4
+.stabs "v4_tail_Minusif:F1",36,0,0,v4_tail_Minusif
+.globl v4_tail_Minusif
+	.type	v4_tail_Minusif,@function
+v4_tail_Minusif:
+.stabn 68,0,60,.LMa174-v4_tail_Minusif
+.LMa174:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,60,.LMb174-v4_tail_Minusif
+.LMb174:
+.LBB52:
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS23
+	call v4__dscheck
+.LDS23:
+	test %rax,%rax
+	jge .L19
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	neg %rax
+	cmp $4080,%rcx
+	jbe .LDS24
+	call v4__dscheck
+.LDS24:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS25
+	call v4__dscheck
+.LDS25:
+	jmp .L18
+.L19:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rax,%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS26
+	call v4__dscheck
+.LDS26:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS27
+	call v4__dscheck
+.LDS27:
+.L18:
+	mov %rcx,v4__dsindex(%rip)
+.LBE52:
+.stabn 68,0,60,.LM198-v4_tail_Minusif
+.LM198:
+	pop %rbx
+	leave
+	ret
+.Lfe52:
+	.size	 v4_tail_Minusif,.Lfe52-v4_tail_Minusif
+.stabn	192,0,0,.LBB52-v4_tail_Minusif
+.stabn	224,0,0,.LBE52-v4_tail_Minusif
+.Lscope52:
+.stabs	"",36,0,0,.Lscope52-v4_tail_Minusif
+.text
+	.align 4
+.stabs "v4_tail_Minusrs:F1",36,0,0,v4_tail_Minusrs
+.globl v4_tail_Minusrs
+	.type	v4_tail_Minusrs,@function
+v4_tail_Minusrs:
+.stabn 68,0,61,.LMa199-v4_tail_Minusrs
+.LMa199:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,61,.LMb199-v4_tail_Minusrs
+.LMb199:
+.LBB54:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	mov $3,%rax
+	mov %rax,%r8
+	mov -16(%rbp),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS28
+	call v4__dscheck
+.LDS28:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS29
+	call v4__dscheck
+.LDS29:
+	mov %rcx,v4__dsindex(%rip)
+.LBE54:
+.stabn 68,0,61,.LM219-v4_tail_Minusrs
+.LM219:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe54:
+	.size	 v4_tail_Minusrs,.Lfe54-v4_tail_Minusrs
+.stabn	192,0,0,.LBB54-v4_tail_Minusrs
+.stabn	224,0,0,.LBE54-v4_tail_Minusrs
+.Lscope54:
+.stabs	"",36,0,0,.Lscope54-v4_tail_Minusrs
+.text
+	.align 4
+.stabs "v4_tail_Minusloop:F1",36,0,0,v4_tail_Minusloop
+.globl v4_tail_Minusloop
+	.type	v4_tail_Minusloop,@function
+v4_tail_Minusloop:
+.stabn 68,0,62,.LMa220-v4_tail_Minusloop
+.LMa220:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,62,.LMb220-v4_tail_Minusloop
+.LMb220:
+.LBB57:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $5,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS30
+	call v4__dscheck
+.LDS30:
+.L23:
+	mov -24(%rbp),%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS31
+	call v4__dscheck
+.LDS31:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS32
+	call v4__dscheck
+.LDS32:
+	test %rdx,%rdx
+	jne .L23
+	mov -16(%rbp),%rax
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS33
+	call v4__dscheck
+.LDS33:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS34
+	call v4__dscheck
+.LDS34:
+	mov %rcx,v4__dsindex(%rip)
+.LBE57:
+.stabn 68,0,62,.LM257-v4_tail_Minusloop
+.LM257:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe57:
+	.size	 v4_tail_Minusloop,.Lfe57-v4_tail_Minusloop
+.stabn	192,0,0,.LBB57-v4_tail_Minusloop
+.stabn	224,0,0,.LBE57-v4_tail_Minusloop
+.Lscope57:
+.stabs	"",36,0,0,.Lscope57-v4_tail_Minusloop
+.text
+	.align 4
+.stabs "v4_tail_Minusexec:F1",36,0,0,v4_tail_Minusexec
+.globl v4_tail_Minusexec
+	.type	v4_tail_Minusexec,@function
+v4_tail_Minusexec:
+.stabn 68,0,63,.LMa258-v4_tail_Minusexec
+.LMa258:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,63,.LMb258-v4_tail_Minusexec
+.LMb258:
+.LBB59:
+	pop %rbx
+	leave
+	jmp v4_execute
+.LBE59:
+.stabn 68,0,63,.LM261-v4_tail_Minusexec
+.LM261:
+	pop %rbx
+	leave
+	ret
+.Lfe59:
+	.size	 v4_tail_Minusexec,.Lfe59-v4_tail_Minusexec
+.stabn	192,0,0,.LBB59-v4_tail_Minusexec
+.stabn	224,0,0,.LBE59-v4_tail_Minusexec
+.Lscope59:
+.stabs	"",36,0,0,.Lscope59-v4_tail_Minusexec
+.text
+	.align 4
+.stabs "v4_leaf1:F1",36,0,0,v4_leaf1
+.globl v4_leaf1
+	.type	v4_leaf1,@function
+v4_leaf1:
+.stabn 68,0,77,.LMa262-v4_leaf1
+.LMa262:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,77,.LMb262-v4_leaf1
+.LMb262:
+.LBB60:
+	call v4_dup
+	pop %rbx
+	leave
+	jmp v4_Star
+.LBE60:
+.stabn 68,0,77,.LM266-v4_leaf1
+.LM266:
+	pop %rbx
+	leave
+	ret
+.Lfe60:
+	.size	 v4_leaf1,.Lfe60-v4_leaf1
+.stabn	192,0,0,.LBB60-v4_leaf1
+.stabn	224,0,0,.LBE60-v4_leaf1
+.Lscope60:
+.stabs	"",36,0,0,.Lscope60-v4_leaf1
+.text
+	.align 4
+.stabs "v4_leaf2:F1",36,0,0,v4_leaf2
+.globl v4_leaf2
+	.type	v4_leaf2,@function
+v4_leaf2:
+.stabn 68,0,78,.LMa267-v4_leaf2
+.LMa267:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,78,.LMb267-v4_leaf2
+.LMb267:
+.LBB61:
+	call v4_z2dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS35
+	call v4__dscheck
+.LDS35:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS36
+	call v4__dscheck
+.LDS36:
+	mov %rcx,v4__dsindex(%rip)
+.LBE61:
+.stabn 68,0,78,.LM275-v4_leaf2
+.LM275:
+	pop %rbx
+	leave
+	ret
+.Lfe61:
+	.size	 v4_leaf2,.Lfe61-v4_leaf2
+.stabn	192,0,0,.LBB61-v4_leaf2
+.stabn	224,0,0,.LBE61-v4_leaf2
+.Lscope61:
+.stabs	"",36,0,0,.Lscope61-v4_leaf2
+.text
+	.align 4
+.stabs "v4_leaf_Minusloop:F1",36,0,0,v4_leaf_Minusloop
+.globl v4_leaf_Minusloop
+	.type	v4_leaf_Minusloop,@function
+v4_leaf_Minusloop:
+.stabn 68,0,79,.LMa276-v4_leaf_Minusloop
+.LMa276:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,79,.LMb276-v4_leaf_Minusloop
+.LMb276:
+.LBB63:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $10,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS37
+	call v4__dscheck
+.LDS37:
+.L30:
+	mov -24(%rbp),%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS38
+	call v4__dscheck
+.LDS38:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS39
+	call v4__dscheck
+.LDS39:
+	test %rdx,%rdx
+	jne .L30
+	mov -16(%rbp),%rax
+	mov %rcx,v4__dsindex(%rip)
+.LBE63:
+.stabn 68,0,79,.LM308-v4_leaf_Minusloop
+.LM308:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe63:
+	.size	 v4_leaf_Minusloop,.Lfe63-v4_leaf_Minusloop
+.stabn	192,0,0,.LBB63-v4_leaf_Minusloop
+.stabn	224,0,0,.LBE63-v4_leaf_Minusloop
+.Lscope63:
+.stabs	"",36,0,0,.Lscope63-v4_leaf_Minusloop
+.text
+	.align 4
+.stabs "v4_leaf_Minusnested:F1",36,0,0,v4_leaf_Minusnested
+.globl v4_leaf_Minusnested
+	.type	v4_leaf_Minusnested,@function
+v4_leaf_Minusnested:
+.stabn 68,0,80,.LMa309-v4_leaf_Minusnested
+.LMa309:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $32,%rsp
+.stabn 68,0,80,.LMb309-v4_leaf_Minusnested
+.LMb309:
+.LBB64:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS40
+	call v4__dscheck
+.LDS40:
+.L34:
+	mov $4,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov %rax,-32(%rbp)
+	mov %rdx,-40(%rbp)
+.L37:
+	mov -24(%rbp),%rax
+	lea (%rax,%rax,4),%rax
+	add %rax,%rax
+	mov %rax,%r8
+	mov -40(%rbp),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS41
+	call v4__dscheck
+.LDS41:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -40(%rbp),%rdx
+	inc %rdx
+	mov -32(%rbp),%rax
+	mov %rdx,-40(%rbp)
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS42
+	call v4__dscheck
+.LDS42:
+	test %rdx,%rdx
+	jne .L37
+	mov -32(%rbp),%rax
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L34
+	mov -16(%rbp),%rax
+	mov %rcx,v4__dsindex(%rip)
+.LBE64:
+.stabn 68,0,80,.LM375-v4_leaf_Minusnested
+.LM375:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe64:
+	.size	 v4_leaf_Minusnested,.Lfe64-v4_leaf_Minusnested
+.stabn	192,0,0,.LBB64-v4_leaf_Minusnested
+.stabn	224,0,0,.LBE64-v4_leaf_Minusnested
+.Lscope64:
+.stabs	"",36,0,0,.Lscope64-v4_leaf_Minusnested
+.text
+	.align 4
+.stabs "v4_leaf_Minusrs:F1",36,0,0,v4_leaf_Minusrs
+.globl v4_leaf_Minusrs
+	.type	v4_leaf_Minusrs,@function
+v4_leaf_Minusrs:
+.stabn 68,0,81,.LMa376-v4_leaf_Minusrs
+.LMa376:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,81,.LMb376-v4_leaf_Minusrs
+.LMb376:
+.LBB66:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	mov -16(%rbp),%rax
+	mov %rax,%r8
+	mov -16(%rbp),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS43
+	call v4__dscheck
+.LDS43:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS44
+	call v4__dscheck
+.LDS44:
+	mov %rcx,v4__dsindex(%rip)
+.LBE66:
+.stabn 68,0,81,.LM392-v4_leaf_Minusrs
+.LM392:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe66:
+	.size	 v4_leaf_Minusrs,.Lfe66-v4_leaf_Minusrs
+.stabn	192,0,0,.LBB66-v4_leaf_Minusrs
+.stabn	224,0,0,.LBE66-v4_leaf_Minusrs
+.Lscope66:
+.stabs	"",36,0,0,.Lscope66-v4_leaf_Minusrs
+.text
+	.align 4
+.stabs "v4_leaf_Minusstore:F1",36,0,0,v4_leaf_Minusstore
+.globl v4_leaf_Minusstore
+	.type	v4_leaf_Minusstore,@function
+v4_leaf_Minusstore:
+.stabn 68,0,83,.LMa393-v4_leaf_Minusstore
+.LMa393:
+.stabn 68,0,83,.LMb393-v4_leaf_Minusstore
+.LMb393:
+.LBB69:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,v4_leaf_Minusvar(%rip)
+	cmp $4080,%rcx
+	jbe .LDS45
+	call v4__dscheck
+.LDS45:
+	mov %rcx,v4__dsindex(%rip)
+.LBE69:
+.stabn 68,0,83,.LM400-v4_leaf_Minusstore
+.LM400:
+	ret
+.Lfe69:
+	.size	 v4_leaf_Minusstore,.Lfe69-v4_leaf_Minusstore
+.stabn	192,0,0,.LBB69-v4_leaf_Minusstore
+.stabn	224,0,0,.LBE69-v4_leaf_Minusstore
+.Lscope69:
+.stabs	"",36,0,0,.Lscope69-v4_leaf_Minusstore
+.text
+	.align 4
+.stabs "v4_leaf_Minusfetch:F1",36,0,0,v4_leaf_Minusfetch
+.globl v4_leaf_Minusfetch
+	.type	v4_leaf_Minusfetch,@function
+v4_leaf_Minusfetch:
+.stabn 68,0,84,.LMa401-v4_leaf_Minusfetch
+.LMa401:
+.stabn 68,0,84,.LMb401-v4_leaf_Minusfetch
+.LMb401:
+.LBB70:
+	mov v4_leaf_Minusvar(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS46
+	call v4__dscheck
+.LDS46:
+	mov %rcx,v4__dsindex(%rip)
+.LBE70:
+.stabn 68,0,84,.LM408-v4_leaf_Minusfetch
+.LM408:
+	ret
+.Lfe70:
+	.size	 v4_leaf_Minusfetch,.Lfe70-v4_leaf_Minusfetch
+.stabn	192,0,0,.LBB70-v4_leaf_Minusfetch
+.stabn	224,0,0,.LBE70-v4_leaf_Minusfetch
+.Lscope70:
+.stabs	"",36,0,0,.Lscope70-v4_leaf_Minusfetch
+.text
+	.align 4
+.stabs "v4_cb_Less:F1",36,0,0,v4_cb_Less
+.globl v4_cb_Less
+	.type	v4_cb_Less,@function
+v4_cb_Less:
+.stabn 68,0,98,.LMa409-v4_cb_Less
+.LMa409:
+.stabn 68,0,98,.LMb409-v4_cb_Less
+.LMb409:
+.LBB72:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS47
+	call v4__dscheck
+.LDS47:
+	cmp %rdx,%rax
+	jge .L43
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS48
+	call v4__dscheck
+.LDS48:
+	jmp .L44
+.L43:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS49
+	call v4__dscheck
+.LDS49:
+.L44:
+	mov %rcx,v4__dsindex(%rip)
+.LBE72:
+.stabn 68,0,98,.LM424-v4_cb_Less
+.LM424:
+	ret
+.Lfe72:
+	.size	 v4_cb_Less,.Lfe72-v4_cb_Less
+.stabn	192,0,0,.LBB72-v4_cb_Less
+.stabn	224,0,0,.LBE72-v4_cb_Less
+.Lscope72:
+.stabs	"",36,0,0,.Lscope72-v4_cb_Less
+.text
+	.align 4
+.stabs "v4_cb_Greater:F1",36,0,0,v4_cb_Greater
+.globl v4_cb_Greater
+	.type	v4_cb_Greater,@function
+v4_cb_Greater:
+.stabn 68,0,99,.LMa425-v4_cb_Greater
+.LMa425:
+.stabn 68,0,99,.LMb425-v4_cb_Greater
+.LMb425:
+.LBB74:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS50
+	call v4__dscheck
+.LDS50:
+	cmp %rdx,%rax
+	jle .L46
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS51
+	call v4__dscheck
+.LDS51:
+	jmp .L47
+.L46:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS52
+	call v4__dscheck
+.LDS52:
+.L47:
+	mov %rcx,v4__dsindex(%rip)
+.LBE74:
+.stabn 68,0,99,.LM440-v4_cb_Greater
+.LM440:
+	ret
+.Lfe74:
+	.size	 v4_cb_Greater,.Lfe74-v4_cb_Greater
+.stabn	192,0,0,.LBB74-v4_cb_Greater
+.stabn	224,0,0,.LBE74-v4_cb_Greater
+.Lscope74:
+.stabs	"",36,0,0,.Lscope74-v4_cb_Greater
+.text
+	.align 4
+.stabs "v4_cb_Equals:F1",36,0,0,v4_cb_Equals
+.globl v4_cb_Equals
+	.type	v4_cb_Equals,@function
+v4_cb_Equals:
+.stabn 68,0,100,.LMa441-v4_cb_Equals
+.LMa441:
+.stabn 68,0,100,.LMb441-v4_cb_Equals
+.LMb441:
+.LBB76:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS53
+	call v4__dscheck
+.LDS53:
+	cmp %rdx,%rax
+	jne .L49
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS54
+	call v4__dscheck
+.LDS54:
+	jmp .L50
+.L49:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS55
+	call v4__dscheck
+.LDS55:
+.L50:
+	mov %rcx,v4__dsindex(%rip)
+.LBE76:
+.stabn 68,0,100,.LM456-v4_cb_Equals
+.LM456:
+	ret
+.Lfe76:
+	.size	 v4_cb_Equals,.Lfe76-v4_cb_Equals
+.stabn	192,0,0,.LBB76-v4_cb_Equals
+.stabn	224,0,0,.LBE76-v4_cb_Equals
+.Lscope76:
+.stabs	"",36,0,0,.Lscope76-v4_cb_Equals
+.text
+	.align 4
+.stabs "v4_cb_Less_Greater:F1",36,0,0,v4_cb_Less_Greater
+.globl v4_cb_Less_Greater
+	.type	v4_cb_Less_Greater,@function
+v4_cb_Less_Greater:
+.stabn 68,0,101,.LMa457-v4_cb_Less_Greater
+.LMa457:
+.stabn 68,0,101,.LMb457-v4_cb_Less_Greater
+.LMb457:
+.LBB78:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS56
+	call v4__dscheck
+.LDS56:
+	cmp %rdx,%rax
+	je .L52
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS57
+	call v4__dscheck
+.LDS57:
+	jmp .L53
+.L52:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS58
+	call v4__dscheck
+.LDS58:
+.L53:
+	mov %rcx,v4__dsindex(%rip)
+.LBE78:
+.stabn 68,0,101,.LM472-v4_cb_Less_Greater
+.LM472:
+	ret
+.Lfe78:
+	.size	 v4_cb_Less_Greater,.Lfe78-v4_cb_Less_Greater
+.stabn	192,0,0,.LBB78-v4_cb_Less_Greater
+.stabn	224,0,0,.LBE78-v4_cb_Less_Greater
+.Lscope78:
+.stabs	"",36,0,0,.Lscope78-v4_cb_Less_Greater
+.text
+	.align 4
+.stabs "v4_cbu_Less:F1",36,0,0,v4_cbu_Less
+.globl v4_cbu_Less
+	.type	v4_cbu_Less,@function
+v4_cbu_Less:
+.stabn 68,0,102,.LMa473-v4_cbu_Less
+.LMa473:
+.stabn 68,0,102,.LMb473-v4_cbu_Less
+.LMb473:
+.LBB80:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS59
+	call v4__dscheck
+.LDS59:
+	cmp %rdx,%rax
+	jae .L55
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS60
+	call v4__dscheck
+.LDS60:
+	jmp .L56
+.L55:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS61
+	call v4__dscheck
+.LDS61:
+.L56:
+	mov %rcx,v4__dsindex(%rip)
+.LBE80:
+.stabn 68,0,102,.LM488-v4_cbu_Less
+.LM488:
+	ret
+.Lfe80:
+	.size	 v4_cbu_Less,.Lfe80-v4_cbu_Less
+.stabn	192,0,0,.LBB80-v4_cbu_Less
+.stabn	224,0,0,.LBE80-v4_cbu_Less
+.Lscope80:
+.stabs	"",36,0,0,.Lscope80-v4_cbu_Less
+.text
+	.align 4
+.stabs "v4_cbu_Greater:F1",36,0,0,v4_cbu_Greater
+.globl v4_cbu_Greater
+	.type	v4_cbu_Greater,@function
+v4_cbu_Greater:
+.stabn 68,0,103,.LMa489-v4_cbu_Greater
+.LMa489:
+.stabn 68,0,103,.LMb489-v4_cbu_Greater
+.LMb489:
+.LBB82:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS62
+	call v4__dscheck
+.LDS62:
+	cmp %rdx,%rax
+	jbe .L58
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS63
+	call v4__dscheck
+.LDS63:
+	jmp .L59
+.L58:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS64
+	call v4__dscheck
+.LDS64:
+.L59:
+	mov %rcx,v4__dsindex(%rip)
+.LBE82:
+.stabn 68,0,103,.LM504-v4_cbu_Greater
+.LM504:
+	ret
+.Lfe82:
+	.size	 v4_cbu_Greater,.Lfe82-v4_cbu_Greater
+.stabn	192,0,0,.LBB82-v4_cbu_Greater
+.stabn	224,0,0,.LBE82-v4_cbu_Greater
+.Lscope82:
+.stabs	"",36,0,0,.Lscope82-v4_cbu_Greater
+.text
+	.align 4
+.stabs "v4_cbu_Less_Equals:F1",36,0,0,v4_cbu_Less_Equals
+.globl v4_cbu_Less_Equals
+	.type	v4_cbu_Less_Equals,@function
+v4_cbu_Less_Equals:
+.stabn 68,0,104,.LMa505-v4_cbu_Less_Equals
+.LMa505:
+.stabn 68,0,104,.LMb505-v4_cbu_Less_Equals
+.LMb505:
+.LBB84:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS65
+	call v4__dscheck
+.LDS65:
+	cmp %rdx,%rax
+	ja .L61
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS66
+	call v4__dscheck
+.LDS66:
+	jmp .L62
+.L61:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS67
+	call v4__dscheck
+.LDS67:
+.L62:
+	mov %rcx,v4__dsindex(%rip)
+.LBE84:
+.stabn 68,0,104,.LM520-v4_cbu_Less_Equals
+.LM520:
+	ret
+.Lfe84:
+	.size	 v4_cbu_Less_Equals,.Lfe84-v4_cbu_Less_Equals
+.stabn	192,0,0,.LBB84-v4_cbu_Less_Equals
+.stabn	224,0,0,.LBE84-v4_cbu_Less_Equals
+.Lscope84:
+.stabs	"",36,0,0,.Lscope84-v4_cbu_Less_Equals
+.text
+	.align 4
+.stabs "v4_cbu_Greater_Equals:F1",36,0,0,v4_cbu_Greater_Equals
+.globl v4_cbu_Greater_Equals
+	.type	v4_cbu_Greater_Equals,@function
+v4_cbu_Greater_Equals:
+.stabn 68,0,105,.LMa521-v4_cbu_Greater_Equals
+.LMa521:
+.stabn 68,0,105,.LMb521-v4_cbu_Greater_Equals
+.LMb521:
+.LBB86:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS68
+	call v4__dscheck
+.LDS68:
+	cmp %rdx,%rax
+	jb .L64
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS69
+	call v4__dscheck
+.LDS69:
+	jmp .L65
+.L64:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS70
+	call v4__dscheck
+.LDS70:
+.L65:
+	mov %rcx,v4__dsindex(%rip)
+.LBE86:
+.stabn 68,0,105,.LM536-v4_cbu_Greater_Equals
+.LM536:
+	ret
+.Lfe86:
+	.size	 v4_cbu_Greater_Equals,.Lfe86-v4_cbu_Greater_Equals
+.stabn	192,0,0,.LBB86-v4_cbu_Greater_Equals
+.stabn	224,0,0,.LBE86-v4_cbu_Greater_Equals
+.Lscope86:
+.stabs	"",36,0,0,.Lscope86-v4_cbu_Greater_Equals
+.text
+	.align 4
+.stabs "v4_cb0_Equals:F1",36,0,0,v4_cb0_Equals
+.globl v4_cb0_Equals
+	.type	v4_cb0_Equals,@function
+v4_cb0_Equals:
+.stabn 68,0,106,.LMa537-v4_cb0_Equals
+.LMa537:
+.stabn 68,0,106,.LMb537-v4_cb0_Equals
+.LMb537:
+.LBB88:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS71
+	call v4__dscheck
+.LDS71:
+	test %rax,%rax
+	jne .L67
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS72
+	call v4__dscheck
+.LDS72:
+	jmp .L68
+.L67:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS73
+	call v4__dscheck
+.LDS73:
+.L68:
+	mov %rcx,v4__dsindex(%rip)
+.LBE88:
+.stabn 68,0,106,.LM551-v4_cb0_Equals
+.LM551:
+	ret
+.Lfe88:
+	.size	 v4_cb0_Equals,.Lfe88-v4_cb0_Equals
+.stabn	192,0,0,.LBB88-v4_cb0_Equals
+.stabn	224,0,0,.LBE88-v4_cb0_Equals
+.Lscope88:
+.stabs	"",36,0,0,.Lscope88-v4_cb0_Equals
+.text
+	.align 4
+.stabs "v4_cb0_Less:F1",36,0,0,v4_cb0_Less
+.globl v4_cb0_Less
+	.type	v4_cb0_Less,@function
+v4_cb0_Less:
+.stabn 68,0,107,.LMa552-v4_cb0_Less
+.LMa552:
+.stabn 68,0,107,.LMb552-v4_cb0_Less
+.LMb552:
+.LBB89:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS74
+	call v4__dscheck
+.LDS74:
+	test %rax,%rax
+	jge .L70
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS75
+	call v4__dscheck
+.LDS75:
+	jmp .L71
+.L70:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS76
+	call v4__dscheck
+.LDS76:
+.L71:
+	mov %rcx,v4__dsindex(%rip)
+.LBE89:
+.stabn 68,0,107,.LM566-v4_cb0_Less
+.LM566:
+	ret
+.Lfe89:
+	.size	 v4_cb0_Less,.Lfe89-v4_cb0_Less
+.stabn	192,0,0,.LBB89-v4_cb0_Less
+.stabn	224,0,0,.LBE89-v4_cb0_Less
+.Lscope89:
+.stabs	"",36,0,0,.Lscope89-v4_cb0_Less
+.text
+	.align 4
+.stabs "v4_cb0_Greater:F1",36,0,0,v4_cb0_Greater
+.globl v4_cb0_Greater
+	.type	v4_cb0_Greater,@function
+v4_cb0_Greater:
+.stabn 68,0,108,.LMa567-v4_cb0_Greater
+.LMa567:
+.stabn 68,0,108,.LMb567-v4_cb0_Greater
+.LMb567:
+.LBB90:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS77
+	call v4__dscheck
+.LDS77:
+	test %rax,%rax
+	jle .L73
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS78
+	call v4__dscheck
+.LDS78:
+	jmp .L74
+.L73:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS79
+	call v4__dscheck
+.LDS79:
+.L74:
+	mov %rcx,v4__dsindex(%rip)
+.LBE90:
+.stabn 68,0,108,.LM581-v4_cb0_Greater
+.LM581:
+	ret
+.Lfe90:
+	.size	 v4_cb0_Greater,.Lfe90-v4_cb0_Greater
+.stabn	192,0,0,.LBB90-v4_cb0_Greater
+.stabn	224,0,0,.LBE90-v4_cb0_Greater
+.Lscope90:
+.stabs	"",36,0,0,.Lscope90-v4_cb0_Greater
+.text
+	.align 4
+.stabs "v4_cb_Less5:F1",36,0,0,v4_cb_Less5
+.globl v4_cb_Less5
+	.type	v4_cb_Less5,@function
+v4_cb_Less5:
+.stabn 68,0,109,.LMa582-v4_cb_Less5
+.LMa582:
+.stabn 68,0,109,.LMb582-v4_cb_Less5
+.LMb582:
+.LBB92:
+	mov $5,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS80
+	call v4__dscheck
+.LDS80:
+	cmp %rdx,%rax
+	jge .L76
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS81
+	call v4__dscheck
+.LDS81:
+	jmp .L77
+.L76:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS82
+	call v4__dscheck
+.LDS82:
+.L77:
+	mov %rcx,v4__dsindex(%rip)
+.LBE92:
+.stabn 68,0,109,.LM599-v4_cb_Less5
+.LM599:
+	ret
+.Lfe92:
+	.size	 v4_cb_Less5,.Lfe92-v4_cb_Less5
+.stabn	192,0,0,.LBB92-v4_cb_Less5
+.stabn	224,0,0,.LBE92-v4_cb_Less5
+.Lscope92:
+.stabs	"",36,0,0,.Lscope92-v4_cb_Less5
+.text
+	.align 4
+.stabs "v4_cbwhile:F1",36,0,0,v4_cbwhile
+.globl v4_cbwhile
+	.type	v4_cbwhile,@function
+v4_cbwhile:
+.stabn 68,0,110,.LMa600-v4_cbwhile
+.LMa600:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,110,.LMb600-v4_cbwhile
+.LMb600:
+.LBB93:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS83
+	call v4__dscheck
+.LDS83:
+.L79:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_over
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS84
+	call v4__dscheck
+.LDS84:
+	test %rax,%rax
+	jle .L80
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS85
+	call v4__dscheck
+.LDS85:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS86
+	call v4__dscheck
+.LDS86:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	dec %rax
+	cmp $4080,%rcx
+	jbe .LDS87
+	call v4__dscheck
+.LDS87:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS88
+	call v4__dscheck
+.LDS88:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L79
+.L80:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_nip
+.LBE93:
+.stabn 68,0,110,.LM624-v4_cbwhile
+.LM624:
+	pop %rbx
+	leave
+	ret
+.Lfe93:
+	.size	 v4_cbwhile,.Lfe93-v4_cbwhile
+.stabn	192,0,0,.LBB93-v4_cbwhile
+.stabn	224,0,0,.LBE93-v4_cbwhile
+.Lscope93:
+.stabs	"",36,0,0,.Lscope93-v4_cbwhile
+.text
+	.align 4
+.stabs "v4_cbuntil:F1",36,0,0,v4_cbuntil
+.globl v4_cbuntil
+	.type	v4_cbuntil,@function
+v4_cbuntil:
+.stabn 68,0,111,.LMa625-v4_cbuntil
+.LMa625:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,111,.LMb625-v4_cbuntil
+.LMb625:
+.LBB95:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS89
+	call v4__dscheck
+.LDS89:
+.L82:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS90
+	call v4__dscheck
+.LDS90:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS91
+	call v4__dscheck
+.LDS91:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS92
+	call v4__dscheck
+.LDS92:
+	cmp %rdx,%rax
+	jne .L82
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_nip
+.LBE95:
+.stabn 68,0,111,.LM643-v4_cbuntil
+.LM643:
+	pop %rbx
+	leave
+	ret
+.Lfe95:
+	.size	 v4_cbuntil,.Lfe95-v4_cbuntil
+.stabn	192,0,0,.LBB95-v4_cbuntil
+.stabn	224,0,0,.LBE95-v4_cbuntil
+.Lscope95:
+.stabs	"",36,0,0,.Lscope95-v4_cbuntil
+.text
+	.align 4
+.stabs "v4_cbflag:F1",36,0,0,v4_cbflag
+.globl v4_cbflag
+	.type	v4_cbflag,@function
+v4_cbflag:
+.stabn 68,0,112,.LMa644-v4_cbflag
+.LMa644:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,112,.LMb644-v4_cbflag
+.LMb644:
+.LBB96:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	cmp $4080,%rcx
+	jbe .LDS93
+	call v4__dscheck
+.LDS93:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS94
+	call v4__dscheck
+.LDS94:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS95
+	call v4__dscheck
+.LDS95:
+	test %rax,%rax
+	je .L85
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov v4_Lesstrue_Greater(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS96
+	call v4__dscheck
+.LDS96:
+.L85:
+	mov %rcx,v4__dsindex(%rip)
+.LBE96:
+.stabn 68,0,112,.LM658-v4_cbflag
+.LM658:
+	pop %rbx
+	leave
+	ret
+.Lfe96:
+	.size	 v4_cbflag,.Lfe96-v4_cbflag
+.stabn	192,0,0,.LBB96-v4_cbflag
+.stabn	224,0,0,.LBE96-v4_cbflag
+.Lscope96:
+.stabs	"",36,0,0,.Lscope96-v4_cbflag
+.text
+	.align 4
+.stabs "v4_dense:F1",36,0,0,v4_dense
+.globl v4_dense
+	.type	v4_dense,@function
+v4_dense:
+.stabn 68,0,154,.LMa659-v4_dense
+.LMa659:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,154,.LMb659-v4_dense
+.LMb659:
+.LBB97:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS97
+	call v4__dscheck
+.LDS97:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS98
+	call v4__dscheck
+.LDS98:
+	cmp $5,%rax
+	ja .L93
+	lea .LT93(%rip),%rdx
+	movslq (%rdx,%rax,4),%rax
+	add %rdx,%rax
+	jmp *%rax
+.section	.rodata
+	.align 4
+.LT93:
+	.long .L361-.LT93
+	.long .L362-.LT93
+	.long .L363-.LT93
+	.long .L364-.LT93
+	.long .L365-.LT93
+	.long .L366-.LT93
+.text
+.L361:
+	mov $10,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS99
+	call v4__dscheck
+.LDS99:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L87
+.L88:
+.L362:
+	mov $11,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS100
+	call v4__dscheck
+.LDS100:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L87
+.L89:
+.L363:
+	mov $12,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS101
+	call v4__dscheck
+.LDS101:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L87
+.L90:
+.L364:
+	mov $13,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS102
+	call v4__dscheck
+.LDS102:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L87
+.L91:
+.L365:
+	mov $14,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS103
+	call v4__dscheck
+.LDS103:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L87
+.L92:
+.L366:
+	mov $15,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS104
+	call v4__dscheck
+.LDS104:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L87
+.L93:
+.stabn 68,0,158,.LM727-v4_dense
+.LM727:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS105
+	call v4__dscheck
+.LDS105:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS106
+	call v4__dscheck
+.LDS106:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+.L87:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS107
+	call v4__dscheck
+.LDS107:
+	mov %rcx,v4__dsindex(%rip)
+.LBE97:
+.stabn 68,0,159,.LM739-v4_dense
+.LM739:
+	pop %rbx
+	leave
+	ret
+.Lfe97:
+	.size	 v4_dense,.Lfe97-v4_dense
+.stabn	192,0,0,.LBB97-v4_dense
+.stabn	224,0,0,.LBE97-v4_dense
+.Lscope97:
+.stabs	"",36,0,0,.Lscope97-v4_dense
+.text
+	.align 4
+.stabs "v4_gapped:F1",36,0,0,v4_gapped
+.globl v4_gapped
+	.type	v4_gapped,@function
+v4_gapped:
+.stabn 68,0,160,.LMa740-v4_gapped
+.LMa740:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,160,.LMb740-v4_gapped
+.LMb740:
+.LBB98:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS108
+	call v4__dscheck
+.LDS108:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS109
+	call v4__dscheck
+.LDS109:
+	sub $-2,%rax
+	cmp $5,%rax
+	ja .L100
+	lea .LT100(%rip),%rdx
+	movslq (%rdx,%rax,4),%rax
+	add %rdx,%rax
+	jmp *%rax
+.section	.rodata
+	.align 4
+.LT100:
+	.long .L367-.LT100
+	.long .L368-.LT100
+	.long .L369-.LT100
+	.long .L100-.LT100
+	.long .L370-.LT100
+	.long .L371-.LT100
+.text
+.L367:
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS110
+	call v4__dscheck
+.LDS110:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L95
+.L96:
+.L368:
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS111
+	call v4__dscheck
+.LDS111:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L95
+.L97:
+.L369:
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS112
+	call v4__dscheck
+.LDS112:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L95
+.L98:
+.L370:
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS113
+	call v4__dscheck
+.LDS113:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L95
+.L99:
+.L371:
+	mov $5,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS114
+	call v4__dscheck
+.LDS114:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L95
+.L100:
+.stabn 68,0,164,.LM797-v4_gapped
+.LM797:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS115
+	call v4__dscheck
+.LDS115:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+.L95:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS116
+	call v4__dscheck
+.LDS116:
+	mov %rcx,v4__dsindex(%rip)
+.LBE98:
+.stabn 68,0,165,.LM803-v4_gapped
+.LM803:
+	pop %rbx
+	leave
+	ret
+.Lfe98:
+	.size	 v4_gapped,.Lfe98-v4_gapped
+.stabn	192,0,0,.LBB98-v4_gapped
+.stabn	224,0,0,.LBE98-v4_gapped
+.Lscope98:
+.stabs	"",36,0,0,.Lscope98-v4_gapped
+.text
+	.align 4
+.stabs "v4_sparse:F1",36,0,0,v4_sparse
+.globl v4_sparse
+	.type	v4_sparse,@function
+v4_sparse:
+.stabn 68,0,166,.LMa804-v4_sparse
+.LMa804:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,166,.LMb804-v4_sparse
+.LMb804:
+.LBB99:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS117
+	call v4__dscheck
+.LDS117:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $100,%rdx
+	cmp $4080,%rcx
+	jbe .LDS118
+	call v4__dscheck
+.LDS118:
+	cmp %rdx,%rax
+	jl .L378
+	mov $100,%rdx
+	cmp %rdx,%rax
+	je .L375
+	mov $1000,%rdx
+	cmp %rdx,%rax
+	je .L376
+	mov $65536,%rdx
+	cmp %rdx,%rax
+	je .L377
+	jmp .L108
+.L378:
+	mov $-1000,%rdx
+	cmp %rdx,%rax
+	je .L372
+	xor %rdx,%rdx
+	dec %rdx
+	cmp %rdx,%rax
+	je .L373
+	mov $7,%rdx
+	cmp %rdx,%rax
+	je .L374
+	jmp .L108
+.L372:
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS119
+	call v4__dscheck
+.LDS119:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L102
+.L103:
+.L373:
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS120
+	call v4__dscheck
+.LDS120:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L102
+.L104:
+.L374:
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS121
+	call v4__dscheck
+.LDS121:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L102
+.L105:
+.L375:
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS122
+	call v4__dscheck
+.LDS122:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L102
+.L106:
+.L376:
+	mov $5,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS123
+	call v4__dscheck
+.LDS123:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L102
+.L107:
+.L377:
+	mov $6,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS124
+	call v4__dscheck
+.LDS124:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L102
+.L108:
+.stabn 68,0,170,.LM888-v4_sparse
+.LM888:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS125
+	call v4__dscheck
+.LDS125:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+.L102:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS126
+	call v4__dscheck
+.LDS126:
+	mov %rcx,v4__dsindex(%rip)
+.LBE99:
+.stabn 68,0,171,.LM894-v4_sparse
+.LM894:
+	pop %rbx
+	leave
+	ret
+.Lfe99:
+	.size	 v4_sparse,.Lfe99-v4_sparse
+.stabn	192,0,0,.LBB99-v4_sparse
+.stabn	224,0,0,.LBE99-v4_sparse
+.Lscope99:
+.stabs	"",36,0,0,.Lscope99-v4_sparse
+.text
+	.align 4
+.stabs "v4_nodefault:F1",36,0,0,v4_nodefault
+.globl v4_nodefault
+	.type	v4_nodefault,@function
+v4_nodefault:
+.stabn 68,0,172,.LMa895-v4_nodefault
+.LMa895:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,172,.LMb895-v4_nodefault
+.LMb895:
+.LBB100:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS127
+	call v4__dscheck
+.LDS127:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS128
+	call v4__dscheck
+.LDS128:
+	sub $1,%rax
+	cmp $3,%rax
+	ja .L114
+	lea .LT114(%rip),%rdx
+	movslq (%rdx,%rax,4),%rax
+	add %rdx,%rax
+	jmp *%rax
+.section	.rodata
+	.align 4
+.LT114:
+	.long .L379-.LT114
+	.long .L380-.LT114
+	.long .L381-.LT114
+	.long .L382-.LT114
+.text
+.L379:
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS129
+	call v4__dscheck
+.LDS129:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L110
+.L111:
+.L380:
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS130
+	call v4__dscheck
+.LDS130:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L110
+.L112:
+.L381:
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS131
+	call v4__dscheck
+.LDS131:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L110
+.L113:
+.L382:
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS132
+	call v4__dscheck
+.LDS132:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+.L114:
+.L110:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS133
+	call v4__dscheck
+.LDS133:
+	mov %rcx,v4__dsindex(%rip)
+.LBE100:
+.stabn 68,0,176,.LM944-v4_nodefault
+.LM944:
+	pop %rbx
+	leave
+	ret
+.Lfe100:
+	.size	 v4_nodefault,.Lfe100-v4_nodefault
+.stabn	192,0,0,.LBB100-v4_nodefault
+.stabn	224,0,0,.LBE100-v4_nodefault
+.Lscope100:
+.stabs	"",36,0,0,.Lscope100-v4_nodefault
+.text
+	.align 4
+.stabs "v4_Slash1:F1",36,0,0,v4_Slash1
+.globl v4_Slash1
+	.type	v4_Slash1,@function
+v4_Slash1:
+.stabn 68,0,211,.LMa945-v4_Slash1
+.LMa945:
+.stabn 68,0,211,.LMb945-v4_Slash1
+.LMb945:
+.LBB101:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS134
+	call v4__dscheck
+.LDS134:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS135
+	call v4__dscheck
+.LDS135:
+	mov %rcx,v4__dsindex(%rip)
+.LBE101:
+.stabn 68,0,211,.LM953-v4_Slash1
+.LM953:
+	ret
+.Lfe101:
+	.size	 v4_Slash1,.Lfe101-v4_Slash1
+.stabn	192,0,0,.LBB101-v4_Slash1
+.stabn	224,0,0,.LBE101-v4_Slash1
+.Lscope101:
+.stabs	"",36,0,0,.Lscope101-v4_Slash1
+.text
+	.align 4
+.stabs "v4_mod1:F1",36,0,0,v4_mod1
+.globl v4_mod1
+	.type	v4_mod1,@function
+v4_mod1:
+.stabn 68,0,211,.LMa954-v4_mod1
+.LMa954:
+.stabn 68,0,211,.LMb954-v4_mod1
+.LMb954:
+.LBB103:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	xor %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS136
+	call v4__dscheck
+.LDS136:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS137
+	call v4__dscheck
+.LDS137:
+	mov %rcx,v4__dsindex(%rip)
+.LBE103:
+.stabn 68,0,211,.LM962-v4_mod1
+.LM962:
+	ret
+.Lfe103:
+	.size	 v4_mod1,.Lfe103-v4_mod1
+.stabn	192,0,0,.LBB103-v4_mod1
+.stabn	224,0,0,.LBE103-v4_mod1
+.Lscope103:
+.stabs	"",36,0,0,.Lscope103-v4_mod1
+.text
+	.align 4
+.stabs "v4_Slash2:F1",36,0,0,v4_Slash2
+.globl v4_Slash2
+	.type	v4_Slash2,@function
+v4_Slash2:
+.stabn 68,0,212,.LMa963-v4_Slash2
+.LMa963:
+.stabn 68,0,212,.LMb963-v4_Slash2
+.LMb963:
+.LBB105:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $63,%rdx
+	add %rdx,%rax
+	sar $1,%rax
+	cmp $4080,%rcx
+	jbe .LDS138
+	call v4__dscheck
+.LDS138:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS139
+	call v4__dscheck
+.LDS139:
+	mov %rcx,v4__dsindex(%rip)
+.LBE105:
+.stabn 68,0,212,.LM971-v4_Slash2
+.LM971:
+	ret
+.Lfe105:
+	.size	 v4_Slash2,.Lfe105-v4_Slash2
+.stabn	192,0,0,.LBB105-v4_Slash2
+.stabn	224,0,0,.LBE105-v4_Slash2
+.Lscope105:
+.stabs	"",36,0,0,.Lscope105-v4_Slash2
+.text
+	.align 4
+.stabs "v4_mod2:F1",36,0,0,v4_mod2
+.globl v4_mod2
+	.type	v4_mod2,@function
+v4_mod2:
+.stabn 68,0,212,.LMa972-v4_mod2
+.LMa972:
+.stabn 68,0,212,.LMb972-v4_mod2
+.LMb972:
+.LBB106:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $63,%rdx
+	add %rdx,%rax
+	and $1,%rax
+	sub %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS140
+	call v4__dscheck
+.LDS140:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS141
+	call v4__dscheck
+.LDS141:
+	mov %rcx,v4__dsindex(%rip)
+.LBE106:
+.stabn 68,0,212,.LM980-v4_mod2
+.LM980:
+	ret
+.Lfe106:
+	.size	 v4_mod2,.Lfe106-v4_mod2
+.stabn	192,0,0,.LBB106-v4_mod2
+.stabn	224,0,0,.LBE106-v4_mod2
+.Lscope106:
+.stabs	"",36,0,0,.Lscope106-v4_mod2
+.text
+	.align 4
+.stabs "v4_Slash3:F1",36,0,0,v4_Slash3
+.globl v4_Slash3
+	.type	v4_Slash3,@function
+v4_Slash3:
+.stabn 68,0,213,.LMa981-v4_Slash3
+.LMa981:
+.stabn 68,0,213,.LMb981-v4_Slash3
+.LMb981:
+.LBB107:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	cmp $4080,%rcx
+	jbe .LDS142
+	call v4__dscheck
+.LDS142:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS143
+	call v4__dscheck
+.LDS143:
+	mov %rcx,v4__dsindex(%rip)
+.LBE107:
+.stabn 68,0,213,.LM989-v4_Slash3
+.LM989:
+	ret
+.Lfe107:
+	.size	 v4_Slash3,.Lfe107-v4_Slash3
+.stabn	192,0,0,.LBB107-v4_Slash3
+.stabn	224,0,0,.LBE107-v4_Slash3
+.Lscope107:
+.stabs	"",36,0,0,.Lscope107-v4_Slash3
+.text
+	.align 4
+.stabs "v4_mod3:F1",36,0,0,v4_mod3
+.globl v4_mod3
+	.type	v4_mod3,@function
+v4_mod3:
+.stabn 68,0,213,.LMa990-v4_mod3
+.LMa990:
+.stabn 68,0,213,.LMb990-v4_mod3
+.LMb990:
+.LBB108:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS144
+	call v4__dscheck
+.LDS144:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS145
+	call v4__dscheck
+.LDS145:
+	mov %rcx,v4__dsindex(%rip)
+.LBE108:
+.stabn 68,0,213,.LM998-v4_mod3
+.LM998:
+	ret
+.Lfe108:
+	.size	 v4_mod3,.Lfe108-v4_mod3
+.stabn	192,0,0,.LBB108-v4_mod3
+.stabn	224,0,0,.LBE108-v4_mod3
+.Lscope108:
+.stabs	"",36,0,0,.Lscope108-v4_mod3
+.text
+	.align 4
+.stabs "v4_Slash_Minus3:F1",36,0,0,v4_Slash_Minus3
+.globl v4_Slash_Minus3
+	.type	v4_Slash_Minus3,@function
+v4_Slash_Minus3:
+.stabn 68,0,214,.LMa999-v4_Slash_Minus3
+.LMa999:
+.stabn 68,0,214,.LMb999-v4_Slash_Minus3
+.LMb999:
+.LBB109:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	neg %rax
+	cmp $4080,%rcx
+	jbe .LDS146
+	call v4__dscheck
+.LDS146:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS147
+	call v4__dscheck
+.LDS147:
+	mov %rcx,v4__dsindex(%rip)
+.LBE109:
+.stabn 68,0,214,.LM1007-v4_Slash_Minus3
+.LM1007:
+	ret
+.Lfe109:
+	.size	 v4_Slash_Minus3,.Lfe109-v4_Slash_Minus3
+.stabn	192,0,0,.LBB109-v4_Slash_Minus3
+.stabn	224,0,0,.LBE109-v4_Slash_Minus3
+.Lscope109:
+.stabs	"",36,0,0,.Lscope109-v4_Slash_Minus3
+.text
+	.align 4
+.stabs "v4_mod_Minus3:F1",36,0,0,v4_mod_Minus3
+.globl v4_mod_Minus3
+	.type	v4_mod_Minus3,@function
+v4_mod_Minus3:
+.stabn 68,0,214,.LMa1008-v4_mod_Minus3
+.LMa1008:
+.stabn 68,0,214,.LMb1008-v4_mod_Minus3
+.LMb1008:
+.LBB110:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	push %rax
+	mov $6148914691236517206,%rdx
+	imul %rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $3,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS148
+	call v4__dscheck
+.LDS148:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS149
+	call v4__dscheck
+.LDS149:
+	mov %rcx,v4__dsindex(%rip)
+.LBE110:
+.stabn 68,0,214,.LM1016-v4_mod_Minus3
+.LM1016:
+	ret
+.Lfe110:
+	.size	 v4_mod_Minus3,.Lfe110-v4_mod_Minus3
+.stabn	192,0,0,.LBB110-v4_mod_Minus3
+.stabn	224,0,0,.LBE110-v4_mod_Minus3
+.Lscope110:
+.stabs	"",36,0,0,.Lscope110-v4_mod_Minus3
+.text
+	.align 4
+.stabs "v4_Slash7:F1",36,0,0,v4_Slash7
+.globl v4_Slash7
+	.type	v4_Slash7,@function
+v4_Slash7:
+.stabn 68,0,215,.LMa1017-v4_Slash7
+.LMa1017:
+.stabn 68,0,215,.LMb1017-v4_Slash7
+.LMb1017:
+.LBB111:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	push %rax
+	mov $5270498306774157605,%rdx
+	imul %rdx
+	sar $1,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	cmp $4080,%rcx
+	jbe .LDS150
+	call v4__dscheck
+.LDS150:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS151
+	call v4__dscheck
+.LDS151:
+	mov %rcx,v4__dsindex(%rip)
+.LBE111:
+.stabn 68,0,215,.LM1025-v4_Slash7
+.LM1025:
+	ret
+.Lfe111:
+	.size	 v4_Slash7,.Lfe111-v4_Slash7
+.stabn	192,0,0,.LBB111-v4_Slash7
+.stabn	224,0,0,.LBE111-v4_Slash7
+.Lscope111:
+.stabs	"",36,0,0,.Lscope111-v4_Slash7
+.text
+	.align 4
+.stabs "v4_mod7:F1",36,0,0,v4_mod7
+.globl v4_mod7
+	.type	v4_mod7,@function
+v4_mod7:
+.stabn 68,0,215,.LMa1026-v4_mod7
+.LMa1026:
+.stabn 68,0,215,.LMb1026-v4_mod7
+.LMb1026:
+.LBB112:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	push %rax
+	mov $5270498306774157605,%rdx
+	imul %rdx
+	sar $1,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $7,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS152
+	call v4__dscheck
+.LDS152:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS153
+	call v4__dscheck
+.LDS153:
+	mov %rcx,v4__dsindex(%rip)
+.LBE112:
+.stabn 68,0,215,.LM1034-v4_mod7
+.LM1034:
+	ret
+.Lfe112:
+	.size	 v4_mod7,.Lfe112-v4_mod7
+.stabn	192,0,0,.LBB112-v4_mod7
+.stabn	224,0,0,.LBE112-v4_mod7
+.Lscope112:
+.stabs	"",36,0,0,.Lscope112-v4_mod7
+.text
+	.align 4
+.stabs "v4_Slash8:F1",36,0,0,v4_Slash8
+.globl v4_Slash8
+	.type	v4_Slash8,@function
+v4_Slash8:
+.stabn 68,0,216,.LMa1035-v4_Slash8
+.LMa1035:
+.stabn 68,0,216,.LMb1035-v4_Slash8
+.LMb1035:
+.LBB113:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $61,%rdx
+	add %rdx,%rax
+	sar $3,%rax
+	cmp $4080,%rcx
+	jbe .LDS154
+	call v4__dscheck
+.LDS154:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS155
+	call v4__dscheck
+.LDS155:
+	mov %rcx,v4__dsindex(%rip)
+.LBE113:
+.stabn 68,0,216,.LM1043-v4_Slash8
+.LM1043:
+	ret
+.Lfe113:
+	.size	 v4_Slash8,.Lfe113-v4_Slash8
+.stabn	192,0,0,.LBB113-v4_Slash8
+.stabn	224,0,0,.LBE113-v4_Slash8
+.Lscope113:
+.stabs	"",36,0,0,.Lscope113-v4_Slash8
+.text
+	.align 4
+.stabs "v4_mod8:F1",36,0,0,v4_mod8
+.globl v4_mod8
+	.type	v4_mod8,@function
+v4_mod8:
+.stabn 68,0,216,.LMa1044-v4_mod8
+.LMa1044:
+.stabn 68,0,216,.LMb1044-v4_mod8
+.LMb1044:
+.LBB114:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $61,%rdx
+	add %rdx,%rax
+	and $7,%rax
+	sub %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS156
+	call v4__dscheck
+.LDS156:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS157
+	call v4__dscheck
+.LDS157:
+	mov %rcx,v4__dsindex(%rip)
+.LBE114:
+.stabn 68,0,216,.LM1052-v4_mod8
+.LM1052:
+	ret
+.Lfe114:
+	.size	 v4_mod8,.Lfe114-v4_mod8
+.stabn	192,0,0,.LBB114-v4_mod8
+.stabn	224,0,0,.LBE114-v4_mod8
+.Lscope114:
+.stabs	"",36,0,0,.Lscope114-v4_mod8
+.text
+	.align 4
+.stabs "v4_Slash_Minus8:F1",36,0,0,v4_Slash_Minus8
+.globl v4_Slash_Minus8
+	.type	v4_Slash_Minus8,@function
+v4_Slash_Minus8:
+.stabn 68,0,217,.LMa1053-v4_Slash_Minus8
+.LMa1053:
+.stabn 68,0,217,.LMb1053-v4_Slash_Minus8
+.LMb1053:
+.LBB115:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $61,%rdx
+	add %rdx,%rax
+	sar $3,%rax
+	neg %rax
+	cmp $4080,%rcx
+	jbe .LDS158
+	call v4__dscheck
+.LDS158:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS159
+	call v4__dscheck
+.LDS159:
+	mov %rcx,v4__dsindex(%rip)
+.LBE115:
+.stabn 68,0,217,.LM1061-v4_Slash_Minus8
+.LM1061:
+	ret
+.Lfe115:
+	.size	 v4_Slash_Minus8,.Lfe115-v4_Slash_Minus8
+.stabn	192,0,0,.LBB115-v4_Slash_Minus8
+.stabn	224,0,0,.LBE115-v4_Slash_Minus8
+.Lscope115:
+.stabs	"",36,0,0,.Lscope115-v4_Slash_Minus8
+.text
+	.align 4
+.stabs "v4_mod_Minus8:F1",36,0,0,v4_mod_Minus8
+.globl v4_mod_Minus8
+	.type	v4_mod_Minus8,@function
+v4_mod_Minus8:
+.stabn 68,0,217,.LMa1062-v4_mod_Minus8
+.LMa1062:
+.stabn 68,0,217,.LMb1062-v4_mod_Minus8
+.LMb1062:
+.LBB116:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $61,%rdx
+	add %rdx,%rax
+	and $7,%rax
+	sub %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS160
+	call v4__dscheck
+.LDS160:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS161
+	call v4__dscheck
+.LDS161:
+	mov %rcx,v4__dsindex(%rip)
+.LBE116:
+.stabn 68,0,217,.LM1070-v4_mod_Minus8
+.LM1070:
+	ret
+.Lfe116:
+	.size	 v4_mod_Minus8,.Lfe116-v4_mod_Minus8
+.stabn	192,0,0,.LBB116-v4_mod_Minus8
+.stabn	224,0,0,.LBE116-v4_mod_Minus8
+.Lscope116:
+.stabs	"",36,0,0,.Lscope116-v4_mod_Minus8
+.text
+	.align 4
+.stabs "v4_Slash10:F1",36,0,0,v4_Slash10
+.globl v4_Slash10
+	.type	v4_Slash10,@function
+v4_Slash10:
+.stabn 68,0,218,.LMa1071-v4_Slash10
+.LMa1071:
+.stabn 68,0,218,.LMb1071-v4_Slash10
+.LMb1071:
+.LBB117:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	push %rax
+	mov $7378697629483820647,%rdx
+	imul %rdx
+	sar $2,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	cmp $4080,%rcx
+	jbe .LDS162
+	call v4__dscheck
+.LDS162:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS163
+	call v4__dscheck
+.LDS163:
+	mov %rcx,v4__dsindex(%rip)
+.LBE117:
+.stabn 68,0,218,.LM1079-v4_Slash10
+.LM1079:
+	ret
+.Lfe117:
+	.size	 v4_Slash10,.Lfe117-v4_Slash10
+.stabn	192,0,0,.LBB117-v4_Slash10
+.stabn	224,0,0,.LBE117-v4_Slash10
+.Lscope117:
+.stabs	"",36,0,0,.Lscope117-v4_Slash10
+.text
+	.align 4
+.stabs "v4_mod10:F1",36,0,0,v4_mod10
+.globl v4_mod10
+	.type	v4_mod10,@function
+v4_mod10:
+.stabn 68,0,218,.LMa1080-v4_mod10
+.LMa1080:
+.stabn 68,0,218,.LMb1080-v4_mod10
+.LMb1080:
+.LBB118:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	push %rax
+	mov $7378697629483820647,%rdx
+	imul %rdx
+	sar $2,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $10,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS164
+	call v4__dscheck
+.LDS164:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS165
+	call v4__dscheck
+.LDS165:
+	mov %rcx,v4__dsindex(%rip)
+.LBE118:
+.stabn 68,0,218,.LM1088-v4_mod10
+.LM1088:
+	ret
+.Lfe118:
+	.size	 v4_mod10,.Lfe118-v4_mod10
+.stabn	192,0,0,.LBB118-v4_mod10
+.stabn	224,0,0,.LBE118-v4_mod10
+.Lscope118:
+.stabs	"",36,0,0,.Lscope118-v4_mod10
+.text
+	.align 4
+.stabs "v4_Slash_Minus10:F1",36,0,0,v4_Slash_Minus10
+.globl v4_Slash_Minus10
+	.type	v4_Slash_Minus10,@function
+v4_Slash_Minus10:
+.stabn 68,0,219,.LMa1089-v4_Slash_Minus10
+.LMa1089:
+.stabn 68,0,219,.LMb1089-v4_Slash_Minus10
+.LMb1089:
+.LBB119:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	push %rax
+	mov $7378697629483820647,%rdx
+	imul %rdx
+	sar $2,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	mov %rdx,%rax
+	add $8,%rsp
+	neg %rax
+	cmp $4080,%rcx
+	jbe .LDS166
+	call v4__dscheck
+.LDS166:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS167
+	call v4__dscheck
+.LDS167:
+	mov %rcx,v4__dsindex(%rip)
+.LBE119:
+.stabn 68,0,219,.LM1097-v4_Slash_Minus10
+.LM1097:
+	ret
+.Lfe119:
+	.size	 v4_Slash_Minus10,.Lfe119-v4_Slash_Minus10
+.stabn	192,0,0,.LBB119-v4_Slash_Minus10
+.stabn	224,0,0,.LBE119-v4_Slash_Minus10
+.Lscope119:
+.stabs	"",36,0,0,.Lscope119-v4_Slash_Minus10
+.text
+	.align 4
+.stabs "v4_mod_Minus10:F1",36,0,0,v4_mod_Minus10
+.globl v4_mod_Minus10
+	.type	v4_mod_Minus10,@function
+v4_mod_Minus10:
+.stabn 68,0,219,.LMa1098-v4_mod_Minus10
+.LMa1098:
+.stabn 68,0,219,.LMb1098-v4_mod_Minus10
+.LMb1098:
+.LBB120:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	push %rax
+	mov $7378697629483820647,%rdx
+	imul %rdx
+	sar $2,%rdx
+	mov (%rsp),%rax
+	shr $63,%rax
+	add %rax,%rdx
+	imul $10,%rdx,%rdx
+	pop %rax
+	sub %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS168
+	call v4__dscheck
+.LDS168:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS169
+	call v4__dscheck
+.LDS169:
+	mov %rcx,v4__dsindex(%rip)
+.LBE120:
+.stabn 68,0,219,.LM1106-v4_mod_Minus10
+.LM1106:
+	ret
+.Lfe120:
+	.size	 v4_mod_Minus10,.Lfe120-v4_mod_Minus10
+.stabn	192,0,0,.LBB120-v4_mod_Minus10
+.stabn	224,0,0,.LBE120-v4_mod_Minus10
+.Lscope120:
+.stabs	"",36,0,0,.Lscope120-v4_mod_Minus10
+.text
+	.align 4
+.stabs "v4_Slash_Minus1:F1",36,0,0,v4_Slash_Minus1
+.globl v4_Slash_Minus1
+	.type	v4_Slash_Minus1,@function
+v4_Slash_Minus1:
+.stabn 68,0,220,.LMa1107-v4_Slash_Minus1
+.LMa1107:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,220,.LMb1107-v4_Slash_Minus1
+.LMb1107:
+.LBB121:
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS170
+	call v4__dscheck
+.LDS170:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_Slash
+.LBE121:
+.stabn 68,0,220,.LM1112-v4_Slash_Minus1
+.LM1112:
+	pop %rbx
+	leave
+	ret
+.Lfe121:
+	.size	 v4_Slash_Minus1,.Lfe121-v4_Slash_Minus1
+.stabn	192,0,0,.LBB121-v4_Slash_Minus1
+.stabn	224,0,0,.LBE121-v4_Slash_Minus1
+.Lscope121:
+.stabs	"",36,0,0,.Lscope121-v4_Slash_Minus1
+.text
+	.align 4
+.stabs "v4_mod_Minus1:F1",36,0,0,v4_mod_Minus1
+.globl v4_mod_Minus1
+	.type	v4_mod_Minus1,@function
+v4_mod_Minus1:
+.stabn 68,0,220,.LMa1113-v4_mod_Minus1
+.LMa1113:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,220,.LMb1113-v4_mod_Minus1
+.LMb1113:
+.LBB122:
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS171
+	call v4__dscheck
+.LDS171:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_mod
+.LBE122:
+.stabn 68,0,220,.LM1118-v4_mod_Minus1
+.LM1118:
+	pop %rbx
+	leave
+	ret
+.Lfe122:
+	.size	 v4_mod_Minus1,.Lfe122-v4_mod_Minus1
+.stabn	192,0,0,.LBB122-v4_mod_Minus1
+.stabn	224,0,0,.LBE122-v4_mod_Minus1
+.Lscope122:
+.stabs	"",36,0,0,.Lscope122-v4_mod_Minus1
+.text
+	.align 4
+.stabs "v4_Star0:F1",36,0,0,v4_Star0
+.globl v4_Star0
+	.type	v4_Star0,@function
+v4_Star0:
+.stabn 68,0,221,.LMa1119-v4_Star0
+.LMa1119:
+.stabn 68,0,221,.LMb1119-v4_Star0
+.LMb1119:
+.LBB123:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	xor %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS172
+	call v4__dscheck
+.LDS172:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS173
+	call v4__dscheck
+.LDS173:
+	mov %rcx,v4__dsindex(%rip)
+.LBE123:
+.stabn 68,0,221,.LM1127-v4_Star0
+.LM1127:
+	ret
+.Lfe123:
+	.size	 v4_Star0,.Lfe123-v4_Star0
+.stabn	192,0,0,.LBB123-v4_Star0
+.stabn	224,0,0,.LBE123-v4_Star0
+.Lscope123:
+.stabs	"",36,0,0,.Lscope123-v4_Star0
+.text
+	.align 4
+.stabs "v4_Star1:F1",36,0,0,v4_Star1
+.globl v4_Star1
+	.type	v4_Star1,@function
+v4_Star1:
+.stabn 68,0,221,.LMa1128-v4_Star1
+.LMa1128:
+.stabn 68,0,221,.LMb1128-v4_Star1
+.LMb1128:
+.LBB124:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS174
+	call v4__dscheck
+.LDS174:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS175
+	call v4__dscheck
+.LDS175:
+	mov %rcx,v4__dsindex(%rip)
+.LBE124:
+.stabn 68,0,221,.LM1136-v4_Star1
+.LM1136:
+	ret
+.Lfe124:
+	.size	 v4_Star1,.Lfe124-v4_Star1
+.stabn	192,0,0,.LBB124-v4_Star1
+.stabn	224,0,0,.LBE124-v4_Star1
+.Lscope124:
+.stabs	"",36,0,0,.Lscope124-v4_Star1
+.text
+	.align 4
+.stabs "v4_Star_Minus1:F1",36,0,0,v4_Star_Minus1
+.globl v4_Star_Minus1
+	.type	v4_Star_Minus1,@function
+v4_Star_Minus1:
+.stabn 68,0,221,.LMa1137-v4_Star_Minus1
+.LMa1137:
+.stabn 68,0,221,.LMb1137-v4_Star_Minus1
+.LMb1137:
+.LBB125:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	neg %rax
+	cmp $4080,%rcx
+	jbe .LDS176
+	call v4__dscheck
+.LDS176:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS177
+	call v4__dscheck
+.LDS177:
+	mov %rcx,v4__dsindex(%rip)
+.LBE125:
+.stabn 68,0,221,.LM1145-v4_Star_Minus1
+.LM1145:
+	ret
+.Lfe125:
+	.size	 v4_Star_Minus1,.Lfe125-v4_Star_Minus1
+.stabn	192,0,0,.LBB125-v4_Star_Minus1
+.stabn	224,0,0,.LBE125-v4_Star_Minus1
+.Lscope125:
+.stabs	"",36,0,0,.Lscope125-v4_Star_Minus1
+.text
+	.align 4
+.stabs "v4_Star3:F1",36,0,0,v4_Star3
+.globl v4_Star3
+	.type	v4_Star3,@function
+v4_Star3:
+.stabn 68,0,221,.LMa1146-v4_Star3
+.LMa1146:
+.stabn 68,0,221,.LMb1146-v4_Star3
+.LMb1146:
+.LBB126:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	lea (%rax,%rax,2),%rax
+	cmp $4080,%rcx
+	jbe .LDS178
+	call v4__dscheck
+.LDS178:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS179
+	call v4__dscheck
+.LDS179:
+	mov %rcx,v4__dsindex(%rip)
+.LBE126:
+.stabn 68,0,221,.LM1154-v4_Star3
+.LM1154:
+	ret
+.Lfe126:
+	.size	 v4_Star3,.Lfe126-v4_Star3
+.stabn	192,0,0,.LBB126-v4_Star3
+.stabn	224,0,0,.LBE126-v4_Star3
+.Lscope126:
+.stabs	"",36,0,0,.Lscope126-v4_Star3
+.text
+	.align 4
+.stabs "v4_Star8:F1",36,0,0,v4_Star8
+.globl v4_Star8
+	.type	v4_Star8,@function
+v4_Star8:
+.stabn 68,0,222,.LMa1155-v4_Star8
+.LMa1155:
+.stabn 68,0,222,.LMb1155-v4_Star8
+.LMb1155:
+.LBB127:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	shl $3,%rax
+	cmp $4080,%rcx
+	jbe .LDS180
+	call v4__dscheck
+.LDS180:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS181
+	call v4__dscheck
+.LDS181:
+	mov %rcx,v4__dsindex(%rip)
+.LBE127:
+.stabn 68,0,222,.LM1163-v4_Star8
+.LM1163:
+	ret
+.Lfe127:
+	.size	 v4_Star8,.Lfe127-v4_Star8
+.stabn	192,0,0,.LBB127-v4_Star8
+.stabn	224,0,0,.LBE127-v4_Star8
+.Lscope127:
+.stabs	"",36,0,0,.Lscope127-v4_Star8
+.text
+	.align 4
+.stabs "v4_Star_Minus8:F1",36,0,0,v4_Star_Minus8
+.globl v4_Star_Minus8
+	.type	v4_Star_Minus8,@function
+v4_Star_Minus8:
+.stabn 68,0,222,.LMa1164-v4_Star_Minus8
+.LMa1164:
+.stabn 68,0,222,.LMb1164-v4_Star_Minus8
+.LMb1164:
+.LBB128:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	imul $-8,%rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS182
+	call v4__dscheck
+.LDS182:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS183
+	call v4__dscheck
+.LDS183:
+	mov %rcx,v4__dsindex(%rip)
+.LBE128:
+.stabn 68,0,222,.LM1172-v4_Star_Minus8
+.LM1172:
+	ret
+.Lfe128:
+	.size	 v4_Star_Minus8,.Lfe128-v4_Star_Minus8
+.stabn	192,0,0,.LBB128-v4_Star_Minus8
+.stabn	224,0,0,.LBE128-v4_Star_Minus8
+.Lscope128:
+.stabs	"",36,0,0,.Lscope128-v4_Star_Minus8
+.text
+	.align 4
+.stabs "v4_Star10:F1",36,0,0,v4_Star10
+.globl v4_Star10
+	.type	v4_Star10,@function
+v4_Star10:
+.stabn 68,0,222,.LMa1173-v4_Star10
+.LMa1173:
+.stabn 68,0,222,.LMb1173-v4_Star10
+.LMb1173:
+.LBB129:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	lea (%rax,%rax,4),%rax
+	add %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS184
+	call v4__dscheck
+.LDS184:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS185
+	call v4__dscheck
+.LDS185:
+	mov %rcx,v4__dsindex(%rip)
+.LBE129:
+.stabn 68,0,222,.LM1181-v4_Star10
+.LM1181:
+	ret
+.Lfe129:
+	.size	 v4_Star10,.Lfe129-v4_Star10
+.stabn	192,0,0,.LBB129-v4_Star10
+.stabn	224,0,0,.LBE129-v4_Star10
+.Lscope129:
+.stabs	"",36,0,0,.Lscope129-v4_Star10
+.text
+	.align 4
+.stabs "v4_Star_Minus7:F1",36,0,0,v4_Star_Minus7
+.globl v4_Star_Minus7
+	.type	v4_Star_Minus7,@function
+v4_Star_Minus7:
+.stabn 68,0,222,.LMa1182-v4_Star_Minus7
+.LMa1182:
+.stabn 68,0,222,.LMb1182-v4_Star_Minus7
+.LMb1182:
+.LBB130:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	imul $-7,%rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS186
+	call v4__dscheck
+.LDS186:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS187
+	call v4__dscheck
+.LDS187:
+	mov %rcx,v4__dsindex(%rip)
+.LBE130:
+.stabn 68,0,222,.LM1190-v4_Star_Minus7
+.LM1190:
+	ret
+.Lfe130:
+	.size	 v4_Star_Minus7,.Lfe130-v4_Star_Minus7
+.stabn	192,0,0,.LBB130-v4_Star_Minus7
+.stabn	224,0,0,.LBE130-v4_Star_Minus7
+.Lscope130:
+.stabs	"",36,0,0,.Lscope130-v4_Star_Minus7
+.text
+	.align 4
+.stabs "v4_ncells:F1",36,0,0,v4_ncells
+.globl v4_ncells
+	.type	v4_ncells,@function
+v4_ncells:
+.stabn 68,0,223,.LMa1191-v4_ncells
+.LMa1191:
+.stabn 68,0,223,.LMb1191-v4_ncells
+.LMb1191:
+.LBB131:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	shl $3,%rax
+	cmp $4080,%rcx
+	jbe .LDS188
+	call v4__dscheck
+.LDS188:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS189
+	call v4__dscheck
+.LDS189:
+	mov %rcx,v4__dsindex(%rip)
+.LBE131:
+.stabn 68,0,223,.LM1197-v4_ncells
+.LM1197:
+	ret
+.Lfe131:
+	.size	 v4_ncells,.Lfe131-v4_ncells
+.stabn	192,0,0,.LBB131-v4_ncells
+.stabn	224,0,0,.LBE131-v4_ncells
+.Lscope131:
+.stabs	"",36,0,0,.Lscope131-v4_ncells
+.text
+	.align 4
+.stabs "v4_dividend_Comma:F1",36,0,0,v4_dividend_Comma
+.globl v4_dividend_Comma
+	.type	v4_dividend_Comma,@function
+v4_dividend_Comma:
+.stabn 68,0,230,.LMa1198-v4_dividend_Comma
+.LMa1198:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,230,.LMb1198-v4_dividend_Comma
+.LMb1198:
+.LBB134:
+	lea v4_dividends(%rip),%rax
+	mov %rax,%r8
+	mov v4_Hashdividends(%rip),%rax
+	shl $3,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS190
+	call v4__dscheck
+.LDS190:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Store
+	xor %rax,%rax
+	inc %rax
+	mov v4_Hashdividends(%rip),%rdx
+	add %rdx,%rax
+	mov %rax,v4_Hashdividends(%rip)
+.LBE134:
+.stabn 68,0,230,.LM1226-v4_dividend_Comma
+.LM1226:
+	pop %rbx
+	leave
+	ret
+.Lfe134:
+	.size	 v4_dividend_Comma,.Lfe134-v4_dividend_Comma
+.stabn	192,0,0,.LBB134-v4_dividend_Comma
+.stabn	224,0,0,.LBE134-v4_dividend_Comma
+.Lscope134:
+.stabs	"",36,0,0,.Lscope134-v4_dividend_Comma
+.text
+	.align 4
+.stabs "v4_dividend:F1",36,0,0,v4_dividend
+.globl v4_dividend
+	.type	v4_dividend,@function
+v4_dividend:
+.stabn 68,0,231,.LMa1227-v4_dividend
+.LMa1227:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,231,.LMb1227-v4_dividend
+.LMb1227:
+.LBB136:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	shl $3,%rax
+	mov %rax,%r8
+	lea v4_dividends(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS191
+	call v4__dscheck
+.LDS191:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS192
+	call v4__dscheck
+.LDS192:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_Fetch
+.LBE136:
+.stabn 68,0,231,.LM1241-v4_dividend
+.LM1241:
+	pop %rbx
+	leave
+	ret
+.Lfe136:
+	.size	 v4_dividend,.Lfe136-v4_dividend
+.stabn	192,0,0,.LBB136-v4_dividend
+.stabn	224,0,0,.LBE136-v4_dividend
+.Lscope136:
+.stabs	"",36,0,0,.Lscope136-v4_dividend
+.text
+	.align 4
+.stabs "v4_mismatches:F1",36,0,0,v4_mismatches
+.globl v4_mismatches
+	.type	v4_mismatches,@function
+v4_mismatches:
+.stabn 68,0,232,.LMa1242-v4_mismatches
+.LMa1242:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,232,.LMb1242-v4_mismatches
+.LMb1242:
+.LBB137:
+.stabn 68,0,233,.LM1243-v4_mismatches
+.LM1243:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov v4_Hashdividends(%rip),%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS193
+	call v4__dscheck
+.LDS193:
+.L148:
+.stabn 68,0,234,.LM1257-v4_mismatches
+.LM1257:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	shl $3,%rax
+	mov %rax,%r8
+	lea v4_dividends(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS194
+	call v4__dscheck
+.LDS194:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS195
+	call v4__dscheck
+.LDS195:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Fetch
+.stabn 68,0,234,.LM1271-v4_mismatches
+.LM1271:
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS196
+	call v4__dscheck
+.LDS196:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_pick
+	call v4_execute
+.stabn 68,0,235,.LM1275-v4_mismatches
+.LM1275:
+	call v4_i
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	shl $3,%rax
+	mov %rax,%r8
+	lea v4_dividends(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS197
+	call v4__dscheck
+.LDS197:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS198
+	call v4__dscheck
+.LDS198:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Fetch
+.stabn 68,0,235,.LM1289-v4_mismatches
+.LM1289:
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS199
+	call v4__dscheck
+.LDS199:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_pick
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS200
+	call v4__dscheck
+.LDS200:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_pick
+	call v4_execute
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS201
+	call v4__dscheck
+.LDS201:
+	cmp %rdx,%rax
+	je .L150
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS202
+	call v4__dscheck
+.LDS202:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS203
+	call v4__dscheck
+.LDS203:
+.L150:
+.stabn 68,0,237,.LM1307-v4_mismatches
+.LM1307:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L148
+	call v4__rpop
+	call v4__rpop
+	mov %rcx,v4__dsindex(%rip)
+	call v4_nip
+	call v4_nip
+	pop %rbx
+	leave
+	jmp v4_nip
+.LBE137:
+.stabn 68,0,237,.LM1322-v4_mismatches
+.LM1322:
+	pop %rbx
+	leave
+	ret
+.Lfe137:
+	.size	 v4_mismatches,.Lfe137-v4_mismatches
+.stabn	192,0,0,.LBB137-v4_mismatches
+.stabn	224,0,0,.LBE137-v4_mismatches
+.Lscope137:
+.stabs	"",36,0,0,.Lscope137-v4_mismatches
+.text
+	.align 4
+.stabs "v4_use_Minushundred:F1",36,0,0,v4_use_Minushundred
+.globl v4_use_Minushundred
+	.type	v4_use_Minushundred,@function
+v4_use_Minushundred:
+.stabn 68,0,297,.LMa1323-v4_use_Minushundred
+.LMa1323:
+.stabn 68,0,297,.LMb1323-v4_use_Minushundred
+.LMb1323:
+.LBB144:
+	mov $200,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS204
+	call v4__dscheck
+.LDS204:
+	mov %rcx,v4__dsindex(%rip)
+.LBE144:
+.stabn 68,0,297,.LM1328-v4_use_Minushundred
+.LM1328:
+	ret
+.Lfe144:
+	.size	 v4_use_Minushundred,.Lfe144-v4_use_Minushundred
+.stabn	192,0,0,.LBB144-v4_use_Minushundred
+.stabn	224,0,0,.LBE144-v4_use_Minushundred
+.Lscope144:
+.stabs	"",36,0,0,.Lscope144-v4_use_Minushundred
+.text
+	.align 4
+.stabs "v4_use_Minusminus_Minusone:F1",36,0,0,v4_use_Minusminus_Minusone
+.globl v4_use_Minusminus_Minusone
+	.type	v4_use_Minusminus_Minusone,@function
+v4_use_Minusminus_Minusone:
+.stabn 68,0,298,.LMa1329-v4_use_Minusminus_Minusone
+.LMa1329:
+.stabn 68,0,298,.LMb1329-v4_use_Minusminus_Minusone
+.LMb1329:
+.LBB145:
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS205
+	call v4__dscheck
+.LDS205:
+	mov %rcx,v4__dsindex(%rip)
+.LBE145:
+.stabn 68,0,298,.LM1336-v4_use_Minusminus_Minusone
+.LM1336:
+	ret
+.Lfe145:
+	.size	 v4_use_Minusminus_Minusone,.Lfe145-v4_use_Minusminus_Minusone
+.stabn	192,0,0,.LBB145-v4_use_Minusminus_Minusone
+.stabn	224,0,0,.LBE145-v4_use_Minusminus_Minusone
+.Lscope145:
+.stabs	"",36,0,0,.Lscope145-v4_use_Minusminus_Minusone
+.text
+	.align 4
+.stabs "v4_use_Minusbiggest:F1",36,0,0,v4_use_Minusbiggest
+.globl v4_use_Minusbiggest
+	.type	v4_use_Minusbiggest,@function
+v4_use_Minusbiggest:
+.stabn 68,0,299,.LMa1337-v4_use_Minusbiggest
+.LMa1337:
+.stabn 68,0,299,.LMb1337-v4_use_Minusbiggest
+.LMb1337:
+.LBB146:
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS206
+	call v4__dscheck
+.LDS206:
+	mov %rcx,v4__dsindex(%rip)
+.LBE146:
+.stabn 68,0,299,.LM1342-v4_use_Minusbiggest
+.LM1342:
+	ret
+.Lfe146:
+	.size	 v4_use_Minusbiggest,.Lfe146-v4_use_Minusbiggest
+.stabn	192,0,0,.LBB146-v4_use_Minusbiggest
+.stabn	224,0,0,.LBE146-v4_use_Minusbiggest
+.Lscope146:
+.stabs	"",36,0,0,.Lscope146-v4_use_Minusbiggest
+.text
+	.align 4
+.stabs "v4_use_Minusthree_Minushundred:F1",36,0,0,v4_use_Minusthree_Minushundred
+.globl v4_use_Minusthree_Minushundred
+	.type	v4_use_Minusthree_Minushundred,@function
+v4_use_Minusthree_Minushundred:
+.stabn 68,0,300,.LMa1343-v4_use_Minusthree_Minushundred
+.LMa1343:
+.stabn 68,0,300,.LMb1343-v4_use_Minusthree_Minushundred
+.LMb1343:
+.LBB147:
+	mov $301,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS207
+	call v4__dscheck
+.LDS207:
+	mov %rcx,v4__dsindex(%rip)
+.LBE147:
+.stabn 68,0,300,.LM1348-v4_use_Minusthree_Minushundred
+.LM1348:
+	ret
+.Lfe147:
+	.size	 v4_use_Minusthree_Minushundred,.Lfe147-v4_use_Minusthree_Minushundred
+.stabn	192,0,0,.LBB147-v4_use_Minusthree_Minushundred
+.stabn	224,0,0,.LBE147-v4_use_Minusthree_Minushundred
+.Lscope147:
+.stabs	"",36,0,0,.Lscope147-v4_use_Minusthree_Minushundred
+.text
+	.align 4
+.stabs "v4_use_Minuszero:F1",36,0,0,v4_use_Minuszero
+.globl v4_use_Minuszero
+	.type	v4_use_Minuszero,@function
+v4_use_Minuszero:
+.stabn 68,0,301,.LMa1349-v4_use_Minuszero
+.LMa1349:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,301,.LMb1349-v4_use_Minuszero
+.LMb1349:
+.LBB148:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS208
+	call v4__dscheck
+.LDS208:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_Slash
+.LBE148:
+.stabn 68,0,301,.LM1354-v4_use_Minuszero
+.LM1354:
+	pop %rbx
+	leave
+	ret
+.Lfe148:
+	.size	 v4_use_Minuszero,.Lfe148-v4_use_Minuszero
+.stabn	192,0,0,.LBB148-v4_use_Minuszero
+.stabn	224,0,0,.LBE148-v4_use_Minuszero
+.Lscope148:
+.stabs	"",36,0,0,.Lscope148-v4_use_Minuszero
+.text
+	.align 4
+.stabs "v4_use_Minusin_Minuscase:F1",36,0,0,v4_use_Minusin_Minuscase
+.globl v4_use_Minusin_Minuscase
+	.type	v4_use_Minusin_Minuscase,@function
+v4_use_Minusin_Minuscase:
+.stabn 68,0,302,.LMa1355-v4_use_Minusin_Minuscase
+.LMa1355:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,302,.LMb1355-v4_use_Minusin_Minuscase
+.LMb1355:
+.LBB149:
+.stabn 68,0,304,.LM1356-v4_use_Minusin_Minuscase
+.LM1356:
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS209
+	call v4__dscheck
+.LDS209:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS210
+	call v4__dscheck
+.LDS210:
+	cmp %rax,%rdx
+	jne .L158
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS211
+	call v4__dscheck
+.LDS211:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L157
+.L158:
+	mov $100,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS212
+	call v4__dscheck
+.LDS212:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS213
+	call v4__dscheck
+.LDS213:
+	cmp %rax,%rdx
+	jne .L159
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS214
+	call v4__dscheck
+.LDS214:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L157
+.L159:
+.stabn 68,0,305,.LM1378-v4_use_Minusin_Minuscase
+.LM1378:
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS215
+	call v4__dscheck
+.LDS215:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS216
+	call v4__dscheck
+.LDS216:
+	cmp %rax,%rdx
+	jne .L160
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS217
+	call v4__dscheck
+.LDS217:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L157
+.L160:
+	movabs $9223372036854775807,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS218
+	call v4__dscheck
+.LDS218:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS219
+	call v4__dscheck
+.LDS219:
+	cmp %rax,%rdx
+	jne .L161
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS220
+	call v4__dscheck
+.LDS220:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L157
+.L161:
+.stabn 68,0,306,.LM1400-v4_use_Minusin_Minuscase
+.LM1400:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS221
+	call v4__dscheck
+.LDS221:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+.L157:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS222
+	call v4__dscheck
+.LDS222:
+	mov %rcx,v4__dsindex(%rip)
+.LBE149:
+.stabn 68,0,307,.LM1406-v4_use_Minusin_Minuscase
+.LM1406:
+	pop %rbx
+	leave
+	ret
+.Lfe149:
+	.size	 v4_use_Minusin_Minuscase,.Lfe149-v4_use_Minusin_Minuscase
+.stabn	192,0,0,.LBB149-v4_use_Minusin_Minuscase
+.stabn	224,0,0,.LBE149-v4_use_Minusin_Minuscase
+.Lscope149:
+.stabs	"",36,0,0,.Lscope149-v4_use_Minusin_Minuscase
+.text
+	.align 4
+.stabs "v4_clamp:F1",36,0,0,v4_clamp
+.globl v4_clamp
+	.type	v4_clamp,@function
+v4_clamp:
+.stabn 68,0,324,.LMa1407-v4_clamp
+.LMa1407:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,324,.LMb1407-v4_clamp
+.LMb1407:
+.LBB151:
+.stabn 68,0,325,.LM1408-v4_clamp
+.LM1408:
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS223
+	call v4__dscheck
+.LDS223:
+	test %rax,%rax
+	jge .L163
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS224
+	call v4__dscheck
+.LDS224:
+	jmp .L162
+.L163:
+.stabn 68,0,326,.LM1419-v4_clamp
+.LM1419:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS225
+	call v4__dscheck
+.LDS225:
+	cmp %rdx,%rax
+	jle .L164
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS226
+	call v4__dscheck
+.LDS226:
+.L164:
+.L162:
+	mov %rcx,v4__dsindex(%rip)
+.LBE151:
+.stabn 68,0,326,.LM1434-v4_clamp
+.LM1434:
+	pop %rbx
+	leave
+	ret
+.Lfe151:
+	.size	 v4_clamp,.Lfe151-v4_clamp
+.stabn	192,0,0,.LBB151-v4_clamp
+.stabn	224,0,0,.LBE151-v4_clamp
+.Lscope151:
+.stabs	"",36,0,0,.Lscope151-v4_clamp
+.text
+	.align 4
+.stabs "v4_sign:F1",36,0,0,v4_sign
+.globl v4_sign
+	.type	v4_sign,@function
+v4_sign:
+.stabn 68,0,327,.LMa1435-v4_sign
+.LMa1435:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,327,.LMb1435-v4_sign
+.LMb1435:
+.LBB152:
+.stabn 68,0,328,.LM1436-v4_sign
+.LM1436:
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS227
+	call v4__dscheck
+.LDS227:
+	test %rax,%rax
+	jge .L166
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS228
+	call v4__dscheck
+.LDS228:
+	jmp .L167
+.L166:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS229
+	call v4__dscheck
+.LDS229:
+	test %rax,%rax
+	jle .L168
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS230
+	call v4__dscheck
+.LDS230:
+	jmp .L169
+.L168:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS231
+	call v4__dscheck
+.LDS231:
+.L169:
+.L167:
+	mov %rcx,v4__dsindex(%rip)
+.LBE152:
+.stabn 68,0,328,.LM1461-v4_sign
+.LM1461:
+	pop %rbx
+	leave
+	ret
+.Lfe152:
+	.size	 v4_sign,.Lfe152-v4_sign
+.stabn	192,0,0,.LBB152-v4_sign
+.stabn	224,0,0,.LBE152-v4_sign
+.Lscope152:
+.stabs	"",36,0,0,.Lscope152-v4_sign
+.text
+	.align 4
+.stabs "v4_twice:F1",36,0,0,v4_twice
+.globl v4_twice
+	.type	v4_twice,@function
+v4_twice:
+.stabn 68,0,329,.LMa1462-v4_twice
+.LMa1462:
+.stabn 68,0,329,.LMb1462-v4_twice
+.LMb1462:
+.LBB153:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS232
+	call v4__dscheck
+.LDS232:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS233
+	call v4__dscheck
+.LDS233:
+	mov %rcx,v4__dsindex(%rip)
+.LBE153:
+.stabn 68,0,329,.LM1468-v4_twice
+.LM1468:
+	ret
+.Lfe153:
+	.size	 v4_twice,.Lfe153-v4_twice
+.stabn	192,0,0,.LBB153-v4_twice
+.stabn	224,0,0,.LBE153-v4_twice
+.Lscope153:
+.stabs	"",36,0,0,.Lscope153-v4_twice
+.text
+	.align 4
+.stabs "v4_get_Minusi:F1",36,0,0,v4_get_Minusi
+.globl v4_get_Minusi
+	.type	v4_get_Minusi,@function
+v4_get_Minusi:
+.stabn 68,0,330,.LMa1469-v4_get_Minusi
+.LMa1469:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,330,.LMb1469-v4_get_Minusi
+.LMb1469:
+.LBB154:
+	pop %rbx
+	leave
+	jmp v4_i
+.LBE154:
+.stabn 68,0,330,.LM1472-v4_get_Minusi
+.LM1472:
+	pop %rbx
+	leave
+	ret
+.Lfe154:
+	.size	 v4_get_Minusi,.Lfe154-v4_get_Minusi
+.stabn	192,0,0,.LBB154-v4_get_Minusi
+.stabn	224,0,0,.LBE154-v4_get_Minusi
+.Lscope154:
+.stabs	"",36,0,0,.Lscope154-v4_get_Minusi
+.text
+	.align 4
+.stabs "v4_get_Minusi_Minusnoinline:F1",36,0,0,v4_get_Minusi_Minusnoinline
+.globl v4_get_Minusi_Minusnoinline
+	.type	v4_get_Minusi_Minusnoinline,@function
+v4_get_Minusi_Minusnoinline:
+.stabn 68,0,331,.LMa1473-v4_get_Minusi_Minusnoinline
+.LMa1473:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,331,.LMb1473-v4_get_Minusi_Minusnoinline
+.LMb1473:
+.LBB155:
+	pop %rbx
+	leave
+	jmp v4_i
+.LBE155:
+.stabn 68,0,331,.LM1476-v4_get_Minusi_Minusnoinline
+.LM1476:
+	pop %rbx
+	leave
+	ret
+.Lfe155:
+	.size	 v4_get_Minusi_Minusnoinline,.Lfe155-v4_get_Minusi_Minusnoinline
+.stabn	192,0,0,.LBB155-v4_get_Minusi_Minusnoinline
+.stabn	224,0,0,.LBE155-v4_get_Minusi_Minusnoinline
+.Lscope155:
+.stabs	"",36,0,0,.Lscope155-v4_get_Minusi_Minusnoinline
+.text
+	.align 4
+.stabs "v4_find_Minusfirst:F1",36,0,0,v4_find_Minusfirst
+.globl v4_find_Minusfirst
+	.type	v4_find_Minusfirst,@function
+v4_find_Minusfirst:
+.stabn 68,0,332,.LMa1477-v4_find_Minusfirst
+.LMa1477:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,332,.LMb1477-v4_find_Minusfirst
+.LMb1477:
+.LBB156:
+.stabn 68,0,333,.LM1478-v4_find_Minusfirst
+.LM1478:
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS234
+	call v4__dscheck
+.LDS234:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS235
+	call v4__dscheck
+.LDS235:
+.L175:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+	mov $3,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS236
+	call v4__dscheck
+.LDS236:
+	cmp %rdx,%rax
+	jle .L177
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	call v4_i
+	mov v4__dsindex(%rip),%rcx
+	jmp .L176
+.L177:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L175
+.L176:
+	call v4__rpop
+	call v4__rpop
+	mov %rcx,v4__dsindex(%rip)
+.LBE156:
+.stabn 68,0,333,.LM1513-v4_find_Minusfirst
+.LM1513:
+	pop %rbx
+	leave
+	ret
+.Lfe156:
+	.size	 v4_find_Minusfirst,.Lfe156-v4_find_Minusfirst
+.stabn	192,0,0,.LBB156-v4_find_Minusfirst
+.stabn	224,0,0,.LBE156-v4_find_Minusfirst
+.Lscope156:
+.stabs	"",36,0,0,.Lscope156-v4_find_Minusfirst
+.text
+	.align 4
+.stabs "v4_factorial:F1",36,0,0,v4_factorial
+.globl v4_factorial
+	.type	v4_factorial,@function
+v4_factorial:
+.stabn 68,0,334,.LMa1514-v4_factorial
+.LMa1514:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,334,.LMb1514-v4_factorial
+.LMb1514:
+.LBB157:
+	call v4_dup
+	mov $2,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS237
+	call v4__dscheck
+.LDS237:
+	cmp %rdx,%rax
+	jge .L179
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS238
+	call v4__dscheck
+.LDS238:
+	jmp .L178
+.L179:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	dec %rax
+	cmp $4080,%rcx
+	jbe .LDS239
+	call v4__dscheck
+.LDS239:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS240
+	call v4__dscheck
+.LDS240:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_factorial
+	pop %rbx
+	leave
+	jmp v4_Star
+	mov v4__dsindex(%rip),%rcx
+.L178:
+	mov %rcx,v4__dsindex(%rip)
+.LBE157:
+.stabn 68,0,334,.LM1537-v4_factorial
+.LM1537:
+	pop %rbx
+	leave
+	ret
+.Lfe157:
+	.size	 v4_factorial,.Lfe157-v4_factorial
+.stabn	192,0,0,.LBB157-v4_factorial
+.stabn	224,0,0,.LBE157-v4_factorial
+.Lscope157:
+.stabs	"",36,0,0,.Lscope157-v4_factorial
+.text
+	.align 4
+.stabs "v4_use_Minusclamp:F1",36,0,0,v4_use_Minusclamp
+.globl v4_use_Minusclamp
+	.type	v4_use_Minusclamp,@function
+v4_use_Minusclamp:
+.stabn 68,0,336,.LMa1538-v4_use_Minusclamp
+.LMa1538:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,336,.LMb1538-v4_use_Minusclamp
+.LMb1538:
+.LBB158:
+.stabn 68,0,325,.LM1540-v4_use_Minusclamp
+.LM1540:
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS241
+	call v4__dscheck
+.LDS241:
+	test %rax,%rax
+	jge .L246
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS242
+	call v4__dscheck
+.LDS242:
+	jmp .L248
+.L246:
+.stabn 68,0,326,.LM1551-v4_use_Minusclamp
+.LM1551:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS243
+	call v4__dscheck
+.LDS243:
+	cmp %rdx,%rax
+	jle .L247
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS244
+	call v4__dscheck
+.LDS244:
+.L247:
+.L248:
+.stabn 68,0,336,.LM1566-v4_use_Minusclamp
+.LM1566:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_rot
+.stabn 68,0,325,.LM1568-v4_use_Minusclamp
+.LM1568:
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS245
+	call v4__dscheck
+.LDS245:
+	test %rax,%rax
+	jge .L249
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS246
+	call v4__dscheck
+.LDS246:
+	jmp .L251
+.L249:
+.stabn 68,0,326,.LM1579-v4_use_Minusclamp
+.LM1579:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS247
+	call v4__dscheck
+.LDS247:
+	cmp %rdx,%rax
+	jle .L250
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS248
+	call v4__dscheck
+.LDS248:
+.L250:
+.L251:
+.stabn 68,0,336,.LM1594-v4_use_Minusclamp
+.LM1594:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_rot
+.stabn 68,0,325,.LM1596-v4_use_Minusclamp
+.LM1596:
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS249
+	call v4__dscheck
+.LDS249:
+	test %rax,%rax
+	jge .L252
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS250
+	call v4__dscheck
+.LDS250:
+	jmp .L254
+.L252:
+.stabn 68,0,326,.LM1607-v4_use_Minusclamp
+.LM1607:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS251
+	call v4__dscheck
+.LDS251:
+	cmp %rdx,%rax
+	jle .L253
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS252
+	call v4__dscheck
+.LDS252:
+.L253:
+.L254:
+.stabn 68,0,336,.LM1622-v4_use_Minusclamp
+.LM1622:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_rot
+.LBE158:
+.stabn 68,0,336,.LM1624-v4_use_Minusclamp
+.LM1624:
+	pop %rbx
+	leave
+	ret
+.Lfe158:
+	.size	 v4_use_Minusclamp,.Lfe158-v4_use_Minusclamp
+.stabn	192,0,0,.LBB158-v4_use_Minusclamp
+.stabn	224,0,0,.LBE158-v4_use_Minusclamp
+.Lscope158:
+.stabs	"",36,0,0,.Lscope158-v4_use_Minusclamp
+.text
+	.align 4
+.stabs "v4_use_Minussign:F1",36,0,0,v4_use_Minussign
+.globl v4_use_Minussign
+	.type	v4_use_Minussign,@function
+v4_use_Minussign:
+.stabn 68,0,337,.LMa1625-v4_use_Minussign
+.LMa1625:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,337,.LMb1625-v4_use_Minussign
+.LMb1625:
+.LBB160:
+	mov $-5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS253
+	call v4__dscheck
+.LDS253:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sign
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS254
+	call v4__dscheck
+.LDS254:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sign
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS255
+	call v4__dscheck
+.LDS255:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_sign
+.LBE160:
+.stabn 68,0,337,.LM1636-v4_use_Minussign
+.LM1636:
+	pop %rbx
+	leave
+	ret
+.Lfe160:
+	.size	 v4_use_Minussign,.Lfe160-v4_use_Minussign
+.stabn	192,0,0,.LBB160-v4_use_Minussign
+.stabn	224,0,0,.LBE160-v4_use_Minussign
+.Lscope160:
+.stabs	"",36,0,0,.Lscope160-v4_use_Minussign
+.text
+	.align 4
+.stabs "v4_use_Minustwice:F1",36,0,0,v4_use_Minustwice
+.globl v4_use_Minustwice
+	.type	v4_use_Minustwice,@function
+v4_use_Minustwice:
+.stabn 68,0,338,.LMa1637-v4_use_Minustwice
+.LMa1637:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,338,.LMb1637-v4_use_Minustwice
+.LMb1637:
+.LBB161:
+	call v4_twice
+	pop %rbx
+	leave
+	jmp v4_twice
+.LBE161:
+.stabn 68,0,338,.LM1641-v4_use_Minustwice
+.LM1641:
+	pop %rbx
+	leave
+	ret
+.Lfe161:
+	.size	 v4_use_Minustwice,.Lfe161-v4_use_Minustwice
+.stabn	192,0,0,.LBB161-v4_use_Minustwice
+.stabn	224,0,0,.LBE161-v4_use_Minustwice
+.Lscope161:
+.stabs	"",36,0,0,.Lscope161-v4_use_Minustwice
+.text
+	.align 4
+.stabs "v4_sum_Minusi:F1",36,0,0,v4_sum_Minusi
+.globl v4_sum_Minusi
+	.type	v4_sum_Minusi,@function
+v4_sum_Minusi:
+.stabn 68,0,339,.LMa1642-v4_sum_Minusi
+.LMa1642:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,339,.LMb1642-v4_sum_Minusi
+.LMb1642:
+.LBB162:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $5,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS256
+	call v4__dscheck
+.LDS256:
+.L185:
+	mov -24(%rbp),%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS257
+	call v4__dscheck
+.LDS257:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS258
+	call v4__dscheck
+.LDS258:
+	test %rdx,%rdx
+	jne .L185
+	mov -16(%rbp),%rax
+	mov %rcx,v4__dsindex(%rip)
+.LBE162:
+.stabn 68,0,339,.LM1675-v4_sum_Minusi
+.LM1675:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe162:
+	.size	 v4_sum_Minusi,.Lfe162-v4_sum_Minusi
+.stabn	192,0,0,.LBB162-v4_sum_Minusi
+.stabn	224,0,0,.LBE162-v4_sum_Minusi
+.Lscope162:
+.stabs	"",36,0,0,.Lscope162-v4_sum_Minusi
+.text
+	.align 4
+.stabs "v4_sum_Minusi_Minusnoinline:F1",36,0,0,v4_sum_Minusi_Minusnoinline
+.globl v4_sum_Minusi_Minusnoinline
+	.type	v4_sum_Minusi_Minusnoinline,@function
+v4_sum_Minusi_Minusnoinline:
+.stabn 68,0,340,.LMa1676-v4_sum_Minusi_Minusnoinline
+.LMa1676:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,340,.LMb1676-v4_sum_Minusi_Minusnoinline
+.LMb1676:
+.LBB163:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $5,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS259
+	call v4__dscheck
+.LDS259:
+.L189:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_get_Minusi_Minusnoinline
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS260
+	call v4__dscheck
+.LDS260:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS261
+	call v4__dscheck
+.LDS261:
+	test %rdx,%rdx
+	jne .L189
+	call v4__rpop
+	call v4__rpop
+	mov %rcx,v4__dsindex(%rip)
+.LBE163:
+.stabn 68,0,340,.LM1706-v4_sum_Minusi_Minusnoinline
+.LM1706:
+	pop %rbx
+	leave
+	ret
+.Lfe163:
+	.size	 v4_sum_Minusi_Minusnoinline,.Lfe163-v4_sum_Minusi_Minusnoinline
+.stabn	192,0,0,.LBB163-v4_sum_Minusi_Minusnoinline
+.stabn	224,0,0,.LBE163-v4_sum_Minusi_Minusnoinline
+.Lscope163:
+.stabs	"",36,0,0,.Lscope163-v4_sum_Minusi_Minusnoinline
+.text
+	.align 4
+.stabs "v4_sum_Minusj:F1",36,0,0,v4_sum_Minusj
+.globl v4_sum_Minusj
+	.type	v4_sum_Minusj,@function
+v4_sum_Minusj:
+.stabn 68,0,341,.LMa1707-v4_sum_Minusj
+.LMa1707:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $32,%rsp
+.stabn 68,0,341,.LMb1707-v4_sum_Minusj
+.LMb1707:
+.LBB164:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS262
+	call v4__dscheck
+.LDS262:
+.L193:
+	mov $3,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov %rax,-32(%rbp)
+	mov %rdx,-40(%rbp)
+.L196:
+	mov -40(%rbp),%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS263
+	call v4__dscheck
+.LDS263:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -40(%rbp),%rdx
+	inc %rdx
+	mov -32(%rbp),%rax
+	mov %rdx,-40(%rbp)
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS264
+	call v4__dscheck
+.LDS264:
+	test %rdx,%rdx
+	jne .L196
+	mov -32(%rbp),%rax
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L193
+	mov -16(%rbp),%rax
+	mov %rcx,v4__dsindex(%rip)
+.LBE164:
+.stabn 68,0,341,.LM1760-v4_sum_Minusj
+.LM1760:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe164:
+	.size	 v4_sum_Minusj,.Lfe164-v4_sum_Minusj
+.stabn	192,0,0,.LBB164-v4_sum_Minusj
+.stabn	224,0,0,.LBE164-v4_sum_Minusj
+.Lscope164:
+.stabs	"",36,0,0,.Lscope164-v4_sum_Minusj
+.text
+	.align 4
+.stabs "v4_use_Minusfind_Minusfirst:F1",36,0,0,v4_use_Minusfind_Minusfirst
+.globl v4_use_Minusfind_Minusfirst
+	.type	v4_use_Minusfind_Minusfirst,@function
+v4_use_Minusfind_Minusfirst:
+.stabn 68,0,342,.LMa1761-v4_use_Minusfind_Minusfirst
+.LMa1761:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,342,.LMb1761-v4_use_Minusfind_Minusfirst
+.LMb1761:
+.LBB165:
+	mov $10,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS265
+	call v4__dscheck
+.LDS265:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_find_Minusfirst
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS266
+	call v4__dscheck
+.LDS266:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_find_Minusfirst
+.LBE165:
+.stabn 68,0,342,.LM1769-v4_use_Minusfind_Minusfirst
+.LM1769:
+	pop %rbx
+	leave
+	ret
+.Lfe165:
+	.size	 v4_use_Minusfind_Minusfirst,.Lfe165-v4_use_Minusfind_Minusfirst
+.stabn	192,0,0,.LBB165-v4_use_Minusfind_Minusfirst
+.stabn	224,0,0,.LBE165-v4_use_Minusfind_Minusfirst
+.Lscope165:
+.stabs	"",36,0,0,.Lscope165-v4_use_Minusfind_Minusfirst
+.text
+	.align 4
+.stabs "v4_use_Minusin_Minusloop:F1",36,0,0,v4_use_Minusin_Minusloop
+.globl v4_use_Minusin_Minusloop
+	.type	v4_use_Minusin_Minusloop,@function
+v4_use_Minusin_Minusloop:
+.stabn 68,0,343,.LMa1770-v4_use_Minusin_Minusloop
+.LMa1770:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,343,.LMb1770-v4_use_Minusin_Minusloop
+.LMb1770:
+.LBB166:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $200,%rax
+	mov %rax,%r8
+	mov $-100,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS267
+	call v4__dscheck
+.LDS267:
+.L201:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_i
+.stabn 68,0,325,.LM1784-v4_use_Minusin_Minusloop
+.LM1784:
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS268
+	call v4__dscheck
+.LDS268:
+	test %rax,%rax
+	jge .L255
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS269
+	call v4__dscheck
+.LDS269:
+	jmp .L257
+.L255:
+.stabn 68,0,326,.LM1795-v4_use_Minusin_Minusloop
+.LM1795:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS270
+	call v4__dscheck
+.LDS270:
+	cmp %rdx,%rax
+	jle .L256
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS271
+	call v4__dscheck
+.LDS271:
+.L256:
+.L257:
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS272
+	call v4__dscheck
+.LDS272:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $50,%rax
+	xchg %rdx,%rax
+	call v4__rpop
+	xchg %rax,%rdx
+	add %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS273
+	call v4__dscheck
+.LDS273:
+	test %rax,%rax
+	jl .L203
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	test %rdx,%rdx
+	jl .L201
+	jmp .L202
+.L203:
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	test %rdx,%rdx
+	jge .L201
+.L202:
+	call v4__rpop
+	call v4__rpop
+	mov %rcx,v4__dsindex(%rip)
+.LBE166:
+.stabn 68,0,343,.LM1838-v4_use_Minusin_Minusloop
+.LM1838:
+	pop %rbx
+	leave
+	ret
+.Lfe166:
+	.size	 v4_use_Minusin_Minusloop,.Lfe166-v4_use_Minusin_Minusloop
+.stabn	192,0,0,.LBB166-v4_use_Minusin_Minusloop
+.stabn	224,0,0,.LBE166-v4_use_Minusin_Minusloop
+.Lscope166:
+.stabs	"",36,0,0,.Lscope166-v4_use_Minusin_Minusloop
+.text
+	.align 4
+.stabs "v4_sum_Minusstep:F1",36,0,0,v4_sum_Minusstep
+.globl v4_sum_Minusstep
+	.type	v4_sum_Minusstep,@function
+v4_sum_Minusstep:
+.stabn 68,0,363,.LMa1839-v4_sum_Minusstep
+.LMa1839:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,363,.LMb1839-v4_sum_Minusstep
+.LMb1839:
+.LBB168:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS274
+	call v4__dscheck
+.LDS274:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS275
+	call v4__dscheck
+.LDS275:
+.L206:
+	mov v4_step(%rip),%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS276
+	call v4__dscheck
+.LDS276:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS277
+	call v4__dscheck
+.LDS277:
+	test %rdx,%rdx
+	jne .L206
+	mov -16(%rbp),%rax
+	mov %rcx,v4__dsindex(%rip)
+.LBE168:
+.stabn 68,0,363,.LM1872-v4_sum_Minusstep
+.LM1872:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe168:
+	.size	 v4_sum_Minusstep,.Lfe168-v4_sum_Minusstep
+.stabn	192,0,0,.LBB168-v4_sum_Minusstep
+.stabn	224,0,0,.LBE168-v4_sum_Minusstep
+.Lscope168:
+.stabs	"",36,0,0,.Lscope168-v4_sum_Minusstep
+.text
+	.align 4
+.stabs "v4_bump_Minusstep:F1",36,0,0,v4_bump_Minusstep
+.globl v4_bump_Minusstep
+	.type	v4_bump_Minusstep,@function
+v4_bump_Minusstep:
+.stabn 68,0,364,.LMa1873-v4_bump_Minusstep
+.LMa1873:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+.stabn 68,0,364,.LMb1873-v4_bump_Minusstep
+.LMb1873:
+.LBB169:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS278
+	call v4__dscheck
+.LDS278:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS279
+	call v4__dscheck
+.LDS279:
+.L210:
+	mov v4_step(%rip),%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS280
+	call v4__dscheck
+.LDS280:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	mov v4_step(%rip),%rdx
+	add %rdx,%rax
+	mov %rax,v4_step(%rip)
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS281
+	call v4__dscheck
+.LDS281:
+	test %rdx,%rdx
+	jne .L210
+	mov -16(%rbp),%rax
+	mov %rcx,v4__dsindex(%rip)
+.LBE169:
+.stabn 68,0,364,.LM1915-v4_bump_Minusstep
+.LM1915:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe169:
+	.size	 v4_bump_Minusstep,.Lfe169-v4_bump_Minusstep
+.stabn	192,0,0,.LBB169-v4_bump_Minusstep
+.stabn	224,0,0,.LBE169-v4_bump_Minusstep
+.Lscope169:
+.stabs	"",36,0,0,.Lscope169-v4_bump_Minusstep
+.text
+	.align 4
+.stabs "v4_sum_Minusstep_Minus2:F1",36,0,0,v4_sum_Minusstep_Minus2
+.globl v4_sum_Minusstep_Minus2
+	.type	v4_sum_Minusstep_Minus2,@function
+v4_sum_Minusstep_Minus2:
+.stabn 68,0,365,.LMa1916-v4_sum_Minusstep_Minus2
+.LMa1916:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $32,%rsp
+.stabn 68,0,365,.LMb1916-v4_sum_Minusstep_Minus2
+.LMb1916:
+.LBB170:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS282
+	call v4__dscheck
+.LDS282:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,-16(%rbp)
+	mov %rdx,-24(%rbp)
+	cmp $4080,%rcx
+	jbe .LDS283
+	call v4__dscheck
+.LDS283:
+.L214:
+	mov $3,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov %rax,-32(%rbp)
+	mov %rdx,-40(%rbp)
+.L217:
+	mov v4_step(%rip),%rax
+	mov %rax,%r8
+	mov -24(%rbp),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS284
+	call v4__dscheck
+.LDS284:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov -40(%rbp),%rdx
+	inc %rdx
+	mov -32(%rbp),%rax
+	mov %rdx,-40(%rbp)
+	sub %rax,%rdx
+	cmp $4080,%rcx
+	jbe .LDS285
+	call v4__dscheck
+.LDS285:
+	test %rdx,%rdx
+	jne .L217
+	mov -32(%rbp),%rax
+	mov -24(%rbp),%rdx
+	inc %rdx
+	mov -16(%rbp),%rax
+	mov %rdx,-24(%rbp)
+	sub %rax,%rdx
+	jne .L214
+	mov -16(%rbp),%rax
+	mov %rcx,v4__dsindex(%rip)
+.LBE170:
+.stabn 68,0,365,.LM1977-v4_sum_Minusstep_Minus2
+.LM1977:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe170:
+	.size	 v4_sum_Minusstep_Minus2,.Lfe170-v4_sum_Minusstep_Minus2
+.stabn	192,0,0,.LBB170-v4_sum_Minusstep_Minus2
+.stabn	224,0,0,.LBE170-v4_sum_Minusstep_Minus2
+.Lscope170:
+.stabs	"",36,0,0,.Lscope170-v4_sum_Minusstep_Minus2
+.text
+	.align 4
+.stabs "v4_set_Minuscell_Minusv:F1",36,0,0,v4_set_Minuscell_Minusv
+.globl v4_set_Minuscell_Minusv
+	.type	v4_set_Minuscell_Minusv,@function
+v4_set_Minuscell_Minusv:
+.stabn 68,0,380,.LMa1978-v4_set_Minuscell_Minusv
+.LMa1978:
+.stabn 68,0,380,.LMb1978-v4_set_Minuscell_Minusv
+.LMb1978:
+.LBB172:
+	mov $11,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+.LBE172:
+.stabn 68,0,380,.LM1987-v4_set_Minuscell_Minusv
+.LM1987:
+	ret
+.Lfe172:
+	.size	 v4_set_Minuscell_Minusv,.Lfe172-v4_set_Minuscell_Minusv
+.stabn	192,0,0,.LBB172-v4_set_Minuscell_Minusv
+.stabn	224,0,0,.LBE172-v4_set_Minuscell_Minusv
+.Lscope172:
+.stabs	"",36,0,0,.Lscope172-v4_set_Minuscell_Minusv
+.text
+	.align 4
+.stabs "v4_forward_Minusv:F1",36,0,0,v4_forward_Minusv
+.globl v4_forward_Minusv
+	.type	v4_forward_Minusv,@function
+v4_forward_Minusv:
+.stabn 68,0,381,.LMa1988-v4_forward_Minusv
+.LMa1988:
+.stabn 68,0,381,.LMb1988-v4_forward_Minusv
+.LMb1988:
+.LBB173:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	cmp $4080,%rcx
+	jbe .LDS286
+	call v4__dscheck
+.LDS286:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS287
+	call v4__dscheck
+.LDS287:
+	mov %rcx,v4__dsindex(%rip)
+.LBE173:
+.stabn 68,0,381,.LM2000-v4_forward_Minusv
+.LM2000:
+	ret
+.Lfe173:
+	.size	 v4_forward_Minusv,.Lfe173-v4_forward_Minusv
+.stabn	192,0,0,.LBB173-v4_forward_Minusv
+.stabn	224,0,0,.LBE173-v4_forward_Minusv
+.Lscope173:
+.stabs	"",36,0,0,.Lscope173-v4_forward_Minusv
+.text
+	.align 4
+.stabs "v4_reload_Minusv:F1",36,0,0,v4_reload_Minusv
+.globl v4_reload_Minusv
+	.type	v4_reload_Minusv,@function
+v4_reload_Minusv:
+.stabn 68,0,382,.LMa2001-v4_reload_Minusv
+.LMa2001:
+.stabn 68,0,382,.LMb2001-v4_reload_Minusv
+.LMb2001:
+.LBB174:
+	mov v4_cell_Minusv(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS288
+	call v4__dscheck
+.LDS288:
+	mov %rcx,v4__dsindex(%rip)
+.LBE174:
+.stabn 68,0,382,.LM2013-v4_reload_Minusv
+.LM2013:
+	ret
+.Lfe174:
+	.size	 v4_reload_Minusv,.Lfe174-v4_reload_Minusv
+.stabn	192,0,0,.LBB174-v4_reload_Minusv
+.stabn	224,0,0,.LBE174-v4_reload_Minusv
+.Lscope174:
+.stabs	"",36,0,0,.Lscope174-v4_reload_Minusv
+.text
+	.align 4
+.stabs "v4_overwrite_Minusv:F1",36,0,0,v4_overwrite_Minusv
+.globl v4_overwrite_Minusv
+	.type	v4_overwrite_Minusv,@function
+v4_overwrite_Minusv:
+.stabn 68,0,383,.LMa2014-v4_overwrite_Minusv
+.LMa2014:
+.stabn 68,0,383,.LMb2014-v4_overwrite_Minusv
+.LMb2014:
+.LBB175:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	cmp $4080,%rcx
+	jbe .LDS289
+	call v4__dscheck
+.LDS289:
+	mov %rcx,v4__dsindex(%rip)
+.LBE175:
+.stabn 68,0,383,.LM2026-v4_overwrite_Minusv
+.LM2026:
+	ret
+.Lfe175:
+	.size	 v4_overwrite_Minusv,.Lfe175-v4_overwrite_Minusv
+.stabn	192,0,0,.LBB175-v4_overwrite_Minusv
+.stabn	224,0,0,.LBE175-v4_overwrite_Minusv
+.Lscope175:
+.stabs	"",36,0,0,.Lscope175-v4_overwrite_Minusv
+.text
+	.align 4
+.stabs "v4_store_Minusthrough:F1",36,0,0,v4_store_Minusthrough
+.globl v4_store_Minusthrough
+	.type	v4_store_Minusthrough,@function
+v4_store_Minusthrough:
+.stabn 68,0,384,.LMa2027-v4_store_Minusthrough
+.LMa2027:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,384,.LMb2027-v4_store_Minusthrough
+.LMb2027:
+.LBB176:
+	mov $5,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS290
+	call v4__dscheck
+.LDS290:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	call v4_Store
+	mov v4_cell_Minusv(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS291
+	call v4__dscheck
+.LDS291:
+	mov %rcx,v4__dsindex(%rip)
+.LBE176:
+.stabn 68,0,384,.LM2045-v4_store_Minusthrough
+.LM2045:
+	pop %rbx
+	leave
+	ret
+.Lfe176:
+	.size	 v4_store_Minusthrough,.Lfe176-v4_store_Minusthrough
+.stabn	192,0,0,.LBB176-v4_store_Minusthrough
+.stabn	224,0,0,.LBE176-v4_store_Minusthrough
+.Lscope176:
+.stabs	"",36,0,0,.Lscope176-v4_store_Minusthrough
+.text
+	.align 4
+.stabs "v4_cstore_Minusthrough:F1",36,0,0,v4_cstore_Minusthrough
+.globl v4_cstore_Minusthrough
+	.type	v4_cstore_Minusthrough,@function
+v4_cstore_Minusthrough:
+.stabn 68,0,385,.LMa2046-v4_cstore_Minusthrough
+.LMa2046:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,385,.LMb2046-v4_cstore_Minusthrough
+.LMb2046:
+.LBB177:
+	xor %rax,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS292
+	call v4__dscheck
+.LDS292:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	call v4_c_Store
+	mov v4_cell_Minusv(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS293
+	call v4__dscheck
+.LDS293:
+	mov %rcx,v4__dsindex(%rip)
+.LBE177:
+.stabn 68,0,385,.LM2064-v4_cstore_Minusthrough
+.LM2064:
+	pop %rbx
+	leave
+	ret
+.Lfe177:
+	.size	 v4_cstore_Minusthrough,.Lfe177-v4_cstore_Minusthrough
+.stabn	192,0,0,.LBB177-v4_cstore_Minusthrough
+.stabn	224,0,0,.LBE177-v4_cstore_Minusthrough
+.Lscope177:
+.stabs	"",36,0,0,.Lscope177-v4_cstore_Minusthrough
+.text
+	.align 4
+.stabs "v4_fetch_Minusthrough:F1",36,0,0,v4_fetch_Minusthrough
+.globl v4_fetch_Minusthrough
+	.type	v4_fetch_Minusthrough,@function
+v4_fetch_Minusthrough:
+.stabn 68,0,386,.LMa2065-v4_fetch_Minusthrough
+.LMa2065:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,386,.LMb2065-v4_fetch_Minusthrough
+.LMb2065:
+.LBB179:
+	mov $3,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	call v4_Fetch
+	mov $4,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+.LBE179:
+.stabn 68,0,386,.LM2082-v4_fetch_Minusthrough
+.LM2082:
+	pop %rbx
+	leave
+	ret
+.Lfe179:
+	.size	 v4_fetch_Minusthrough,.Lfe179-v4_fetch_Minusthrough
+.stabn	192,0,0,.LBB179-v4_fetch_Minusthrough
+.stabn	224,0,0,.LBE179-v4_fetch_Minusthrough
+.Lscope179:
+.stabs	"",36,0,0,.Lscope179-v4_fetch_Minusthrough
+.text
+	.align 4
+.stabs "v4_around_Minuscall:F1",36,0,0,v4_around_Minuscall
+.globl v4_around_Minuscall
+	.type	v4_around_Minuscall,@function
+v4_around_Minuscall:
+.stabn 68,0,387,.LMa2083-v4_around_Minuscall
+.LMa2083:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,387,.LMb2083-v4_around_Minuscall
+.LMb2083:
+.LBB180:
+	mov $5,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS294
+	call v4__dscheck
+.LDS294:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_set_Minuscell_Minusv
+	mov v4_cell_Minusv(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS295
+	call v4__dscheck
+.LDS295:
+	mov %rcx,v4__dsindex(%rip)
+.LBE180:
+.stabn 68,0,387,.LM2103-v4_around_Minuscall
+.LM2103:
+	pop %rbx
+	leave
+	ret
+.Lfe180:
+	.size	 v4_around_Minuscall,.Lfe180-v4_around_Minuscall
+.stabn	192,0,0,.LBB180-v4_around_Minuscall
+.stabn	224,0,0,.LBE180-v4_around_Minuscall
+.Lscope180:
+.stabs	"",36,0,0,.Lscope180-v4_around_Minuscall
+.text
+	.align 4
+.stabs "v4_thread_Minusforward:F1",36,0,0,v4_thread_Minusforward
+.globl v4_thread_Minusforward
+	.type	v4_thread_Minusforward,@function
+v4_thread_Minusforward:
+.stabn 68,0,406,.LMa2104-v4_thread_Minusforward
+.LMa2104:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,406,.LMb2104-v4_thread_Minusforward
+.LMb2104:
+.LBB181:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS296
+	call v4__dscheck
+.LDS296:
+	test %rax,%rax
+	je .L228
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS297
+	call v4__dscheck
+.LDS297:
+	test %rax,%rax
+	je .L229
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS298
+	call v4__dscheck
+.LDS298:
+	jmp .L230
+.L228:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS299
+	call v4__dscheck
+.LDS299:
+.L229:
+.L230:
+	mov %rcx,v4__dsindex(%rip)
+.LBE181:
+.stabn 68,0,406,.LM2122-v4_thread_Minusforward
+.LM2122:
+	pop %rbx
+	leave
+	ret
+.Lfe181:
+	.size	 v4_thread_Minusforward,.Lfe181-v4_thread_Minusforward
+.stabn	192,0,0,.LBB181-v4_thread_Minusforward
+.stabn	224,0,0,.LBE181-v4_thread_Minusforward
+.Lscope181:
+.stabs	"",36,0,0,.Lscope181-v4_thread_Minusforward
+.text
+	.align 4
+.stabs "v4_count_Minusodd:F1",36,0,0,v4_count_Minusodd
+.globl v4_count_Minusodd
+	.type	v4_count_Minusodd,@function
+v4_count_Minusodd:
+.stabn 68,0,407,.LMa2123-v4_count_Minusodd
+.LMa2123:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,407,.LMb2123-v4_count_Minusodd
+.LMb2123:
+.LBB182:
+.stabn 68,0,408,.LM2124-v4_count_Minusodd
+.LM2124:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS300
+	call v4__dscheck
+.LDS300:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+.L234:
+.L232:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS301
+	call v4__dscheck
+.LDS301:
+	test %rax,%rax
+	je .L233
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	dec %rax
+	cmp $4080,%rcx
+	jbe .LDS302
+	call v4__dscheck
+.LDS302:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS303
+	call v4__dscheck
+.LDS303:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	and %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS304
+	call v4__dscheck
+.LDS304:
+	test %rax,%rax
+	je .L234
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS305
+	call v4__dscheck
+.LDS305:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS306
+	call v4__dscheck
+.LDS306:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L232
+.L233:
+	mov %rcx,v4__dsindex(%rip)
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE182:
+.stabn 68,0,408,.LM2157-v4_count_Minusodd
+.LM2157:
+	pop %rbx
+	leave
+	ret
+.Lfe182:
+	.size	 v4_count_Minusodd,.Lfe182-v4_count_Minusodd
+.stabn	192,0,0,.LBB182-v4_count_Minusodd
+.stabn	224,0,0,.LBE182-v4_count_Minusodd
+.Lscope182:
+.stabs	"",36,0,0,.Lscope182-v4_count_Minusodd
+.text
+	.align 4
+.stabs "v4_spin:F1",36,0,0,v4_spin
+.globl v4_spin
+	.type	v4_spin,@function
+v4_spin:
+.stabn 68,0,409,.LMa2158-v4_spin
+.LMa2158:
+.stabn 68,0,409,.LMb2158-v4_spin
+.LMb2158:
+.LBB183:
+	mov v4__dsindex(%rip),%rcx
+.L236:
+	jmp .L236
+	mov %rcx,v4__dsindex(%rip)
+.LBE183:
+.stabn 68,0,409,.LM2163-v4_spin
+.LM2163:
+	ret
+.Lfe183:
+	.size	 v4_spin,.Lfe183-v4_spin
+.stabn	192,0,0,.LBB183-v4_spin
+.stabn	224,0,0,.LBE183-v4_spin
+.Lscope183:
+.stabs	"",36,0,0,.Lscope183-v4_spin
+.text
+	.align 4
+.stabs "v4_spin_Minusunless:F1",36,0,0,v4_spin_Minusunless
+.globl v4_spin_Minusunless
+	.type	v4_spin_Minusunless,@function
+v4_spin_Minusunless:
+.stabn 68,0,410,.LMa2164-v4_spin_Minusunless
+.LMa2164:
+.stabn 68,0,410,.LMb2164-v4_spin_Minusunless
+.LMb2164:
+.LBB184:
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS307
+	call v4__dscheck
+.LDS307:
+	test %rax,%rax
+	jne .L239
+.L240:
+	jmp .L240
+.L239:
+	mov %rcx,v4__dsindex(%rip)
+.LBE184:
+.stabn 68,0,410,.LM2175-v4_spin_Minusunless
+.LM2175:
+	ret
+.Lfe184:
+	.size	 v4_spin_Minusunless,.Lfe184-v4_spin_Minusunless
+.stabn	192,0,0,.LBB184-v4_spin_Minusunless
+.stabn	224,0,0,.LBE184-v4_spin_Minusunless
+.Lscope184:
+.stabs	"",36,0,0,.Lscope184-v4_spin_Minusunless
+.text
+	.align 4
+.stabs "v4_merge_Minusloop:F1",36,0,0,v4_merge_Minusloop
+.globl v4_merge_Minusloop
+	.type	v4_merge_Minusloop,@function
+v4_merge_Minusloop:
+.stabn 68,0,411,.LMa2176-v4_merge_Minusloop
+.LMa2176:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,411,.LMb2176-v4_merge_Minusloop
+.LMb2176:
+.LBB185:
+	mov v4__dsindex(%rip),%rcx
+.L243:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $10,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS308
+	call v4__dscheck
+.LDS308:
+	cmp %rdx,%rax
+	jge .L245
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	add %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS309
+	call v4__dscheck
+.LDS309:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS310
+	call v4__dscheck
+.LDS310:
+	jmp .L243
+.L245:
+	mov $100,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS311
+	call v4__dscheck
+.LDS311:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS312
+	call v4__dscheck
+.LDS312:
+	mov %rcx,v4__dsindex(%rip)
+.LBE185:
+.stabn 68,0,412,.LM2209-v4_merge_Minusloop
+.LM2209:
+	pop %rbx
+	leave
+	ret
+.Lfe185:
+	.size	 v4_merge_Minusloop,.Lfe185-v4_merge_Minusloop
+.stabn	192,0,0,.LBB185-v4_merge_Minusloop
+.stabn	224,0,0,.LBE185-v4_merge_Minusloop
+.Lscope185:
+.stabs	"",36,0,0,.Lscope185-v4_merge_Minusloop
+.text
+	.align 4
+.stabs "main:F1",36,0,0,main
+.globl main
+	.type	main,@function
+main:
+.stabn 68,0,9,.LMa2210-main
+.LMa2210:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+	sub $16,%rsp
+	mov %rdi,v4__argc(%rip)
+	mov %rdx,v4__envp(%rip)
+	mov %rsi,v4__argv(%rip)
+.stabn 68,0,9,.LMb2210-main
+.LMb2210:
+.LBB1:
+	lea .LC0(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $17,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS313
+	call v4__dscheck
+.LDS313:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS314
+	call v4__dscheck
+.LDS314:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__strictansi
+	call v4_Store
+.stabn 68,0,12,.LM2222-main
+.LM2222:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_invert(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS315
+	call v4__dscheck
+.LDS315:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,v4_max_Minusuint(%rip)
+.stabn 68,0,13,.LM2229-main
+.LM2229:
+	mov v4_max_Minusuint(%rip),%rax
+	cmp $4080,%rcx
+	jbe .LDS316
+	call v4__dscheck
+.LDS316:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_rshift(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS317
+	call v4__dscheck
+.LDS317:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,v4_max_Minusint(%rip)
+.stabn 68,0,14,.LM2238-main
+.LM2238:
+	mov v4_max_Minusint(%rip),%rax
+	cmp $4080,%rcx
+	jbe .LDS318
+	call v4__dscheck
+.LDS318:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_invert(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS319
+	call v4__dscheck
+.LDS319:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	mov %rax,v4_min_Minusint(%rip)
+.stabn 68,0,15,.LM2245-main
+.LM2245:
+	xor %rax,%rax
+	mov %rax,v4_Lessfalse_Greater(%rip)
+.stabn 68,0,16,.LM2249-main
+.LM2249:
+	mov v4_max_Minusuint(%rip),%rax
+	mov %rax,v4_Lesstrue_Greater(%rip)
+.stabn 68,0,19,.LM2253-main
+.LM2253:
+	lea .LC1(%rip),%rax
+	cmp $4080,%rcx
+	jbe .LDS320
+	call v4__dscheck
+.LDS320:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $38,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS321
+	call v4__dscheck
+.LDS321:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,38,.LM2259-main
+.LM2259:
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS322
+	call v4__dscheck
+.LDS322:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,21,.LM2263-main
+.LM2263:
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,38,.LM2265-main
+.LM2265:
+	cmp $4080,%rcx
+	jbe .LDS323
+	call v4__dscheck
+.LDS323:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS324
+	call v4__dscheck
+.LDS324:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,39,.LM2269-main
+.LM2269:
+	mov $110,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS325
+	call v4__dscheck
+.LDS325:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,22,.LM2273-main
+.LM2273:
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,39,.LM2275-main
+.LM2275:
+	cmp $4080,%rcx
+	jbe .LDS326
+	call v4__dscheck
+.LDS326:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_max_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS327
+	call v4__dscheck
+.LDS327:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,40,.LM2279-main
+.LM2279:
+	mov $120,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS328
+	call v4__dscheck
+.LDS328:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,23,.LM2283-main
+.LM2283:
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,40,.LM2285-main
+.LM2285:
+	cmp $4080,%rcx
+	jbe .LDS329
+	call v4__dscheck
+.LDS329:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS330
+	call v4__dscheck
+.LDS330:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,41,.LM2289-main
+.LM2289:
+	mov $130,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS331
+	call v4__dscheck
+.LDS331:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,24,.LM2293-main
+.LM2293:
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,41,.LM2295-main
+.LM2295:
+	cmp $4080,%rcx
+	jbe .LDS332
+	call v4__dscheck
+.LDS332:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS333
+	call v4__dscheck
+.LDS333:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,42,.LM2299-main
+.LM2299:
+	mov $140,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS334
+	call v4__dscheck
+.LDS334:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,26,.LM2303-main
+.LM2303:
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,42,.LM2305-main
+.LM2305:
+	cmp $4080,%rcx
+	jbe .LDS335
+	call v4__dscheck
+.LDS335:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS336
+	call v4__dscheck
+.LDS336:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,43,.LM2309-main
+.LM2309:
+	mov $150,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS337
+	call v4__dscheck
+.LDS337:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,27,.LM2313-main
+.LM2313:
+	movabs $9223372036854775807,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,43,.LM2315-main
+.LM2315:
+	cmp $4080,%rcx
+	jbe .LDS338
+	call v4__dscheck
+.LDS338:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_max_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS339
+	call v4__dscheck
+.LDS339:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,44,.LM2319-main
+.LM2319:
+	mov $160,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS340
+	call v4__dscheck
+.LDS340:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,32,.LM2323-main
+.LM2323:
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,44,.LM2325-main
+.LM2325:
+	cmp $4080,%rcx
+	jbe .LDS341
+	call v4__dscheck
+.LDS341:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS342
+	call v4__dscheck
+.LDS342:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,45,.LM2329-main
+.LM2329:
+	mov $170,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS343
+	call v4__dscheck
+.LDS343:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,33,.LM2333-main
+.LM2333:
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,45,.LM2335-main
+.LM2335:
+	cmp $4080,%rcx
+	jbe .LDS344
+	call v4__dscheck
+.LDS344:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS345
+	call v4__dscheck
+.LDS345:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,46,.LM2339-main
+.LM2339:
+	mov $180,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS346
+	call v4__dscheck
+.LDS346:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,34,.LM2343-main
+.LM2343:
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,46,.LM2349-main
+.LM2349:
+	cmp $4080,%rcx
+	jbe .LDS347
+	call v4__dscheck
+.LDS347:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS348
+	call v4__dscheck
+.LDS348:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,47,.LM2357-main
+.LM2357:
+	mov $190,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS349
+	call v4__dscheck
+.LDS349:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,35,.LM2361-main
+.LM2361:
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,47,.LM2363-main
+.LM2363:
+	cmp $4080,%rcx
+	jbe .LDS350
+	call v4__dscheck
+.LDS350:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS351
+	call v4__dscheck
+.LDS351:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,48,.LM2367-main
+.LM2367:
+	mov $200,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS352
+	call v4__dscheck
+.LDS352:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,36,.LM2371-main
+.LM2371:
+	mov v4_max_Minusuint(%rip),%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,48,.LM2380-main
+.LM2380:
+	cmp $4080,%rcx
+	jbe .LDS353
+	call v4__dscheck
+.LDS353:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS354
+	call v4__dscheck
+.LDS354:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,49,.LM2384-main
+.LM2384:
+	mov $210,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS355
+	call v4__dscheck
+.LDS355:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $20,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS356
+	call v4__dscheck
+.LDS356:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $20,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS357
+	call v4__dscheck
+.LDS357:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,50,.LM2399-main
+.LM2399:
+	mov $220,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS358
+	call v4__dscheck
+.LDS358:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS359
+	call v4__dscheck
+.LDS359:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS360
+	call v4__dscheck
+.LDS360:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,53,.LM2411-main
+.LM2411:
+	lea .LC2(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $18,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS361
+	call v4__dscheck
+.LDS361:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,65,.LM2417-main
+.LM2417:
+	mov $1600,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS362
+	call v4__dscheck
+.LDS362:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $1000000,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS363
+	call v4__dscheck
+.LDS363:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_countdown
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS364
+	call v4__dscheck
+.LDS364:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,66,.LM2427-main
+.LM2427:
+	mov $1610,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS365
+	call v4__dscheck
+.LDS365:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $60000,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS366
+	call v4__dscheck
+.LDS366:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sumto
+	call v4_Minus_Greater
+	mov $1800030000,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS367
+	call v4__dscheck
+.LDS367:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,67,.LM2439-main
+.LM2439:
+	mov $1620,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS368
+	call v4__dscheck
+.LDS368:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,67,.LM2448-main
+.LM2448:
+	cmp $4080,%rcx
+	jbe .LDS369
+	call v4__dscheck
+.LDS369:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS370
+	call v4__dscheck
+.LDS370:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,68,.LM2452-main
+.LM2452:
+	mov $1630,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS371
+	call v4__dscheck
+.LDS371:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,60,.LM2458-main
+.LM2458:
+	cmp $4080,%rcx
+	jbe .LDS372
+	call v4__dscheck
+.LDS372:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS373
+	call v4__dscheck
+.LDS373:
+	test %rax,%rax
+	jge .L258
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	neg %rax
+	cmp $4080,%rcx
+	jbe .LDS374
+	call v4__dscheck
+.LDS374:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS375
+	call v4__dscheck
+.LDS375:
+	jmp .L259
+.L258:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rax,%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS376
+	call v4__dscheck
+.LDS376:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS377
+	call v4__dscheck
+.LDS377:
+.L259:
+.stabn 68,0,68,.LM2480-main
+.LM2480:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS378
+	call v4__dscheck
+.LDS378:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,69,.LM2484-main
+.LM2484:
+	mov $1640,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS379
+	call v4__dscheck
+.LDS379:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,60,.LM2490-main
+.LM2490:
+	cmp $4080,%rcx
+	jbe .LDS380
+	call v4__dscheck
+.LDS380:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS381
+	call v4__dscheck
+.LDS381:
+	test %rax,%rax
+	jge .L260
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	neg %rax
+	cmp $4080,%rcx
+	jbe .LDS382
+	call v4__dscheck
+.LDS382:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS383
+	call v4__dscheck
+.LDS383:
+	jmp .L261
+.L260:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rax,%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS384
+	call v4__dscheck
+.LDS384:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS385
+	call v4__dscheck
+.LDS385:
+.L261:
+.stabn 68,0,69,.LM2512-main
+.LM2512:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS386
+	call v4__dscheck
+.LDS386:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,70,.LM2516-main
+.LM2516:
+	mov $1650,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS387
+	call v4__dscheck
+.LDS387:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $4,%rax
+	mov %rax,-16(%rbp)
+	mov $3,%rax
+	mov %rax,%r8
+	mov -16(%rbp),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,70,.LM2540-main
+.LM2540:
+	cmp $4080,%rcx
+	jbe .LDS388
+	call v4__dscheck
+.LDS388:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $8,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS389
+	call v4__dscheck
+.LDS389:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,71,.LM2544-main
+.LM2544:
+	mov $1660,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS390
+	call v4__dscheck
+.LDS390:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_tail_Minusloop
+	call v4_Minus_Greater
+	mov $11,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS391
+	call v4__dscheck
+.LDS391:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,72,.LM2552-main
+.LM2552:
+	mov $1670,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS392
+	call v4__dscheck
+.LDS392:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_tail1(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,63,.LM2560-main
+.LM2560:
+	cmp $4080,%rcx
+	jbe .LDS393
+	call v4__dscheck
+.LDS393:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+.stabn 68,0,72,.LM2561-main
+.LM2561:
+	call v4_Minus_Greater
+	mov $11,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS394
+	call v4__dscheck
+.LDS394:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,75,.LM2565-main
+.LM2565:
+	lea .LC3(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $18,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS395
+	call v4__dscheck
+.LDS395:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,86,.LM2571-main
+.LM2571:
+	mov $1700,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS396
+	call v4__dscheck
+.LDS396:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,77,.LM2577-main
+.LM2577:
+	cmp $4080,%rcx
+	jbe .LDS397
+	call v4__dscheck
+.LDS397:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	call v4_Star
+.stabn 68,0,86,.LM2579-main
+.LM2579:
+	call v4_Minus_Greater
+	mov $49,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS398
+	call v4__dscheck
+.LDS398:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,87,.LM2583-main
+.LM2583:
+	mov $1710,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS399
+	call v4__dscheck
+.LDS399:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,78,.LM2591-main
+.LM2591:
+	cmp $4080,%rcx
+	jbe .LDS400
+	call v4__dscheck
+.LDS400:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS401
+	call v4__dscheck
+.LDS401:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,87,.LM2597-main
+.LM2597:
+	cmp $4080,%rcx
+	jbe .LDS402
+	call v4__dscheck
+.LDS402:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $5,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS403
+	call v4__dscheck
+.LDS403:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,88,.LM2605-main
+.LM2605:
+	mov $1720,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS404
+	call v4__dscheck
+.LDS404:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_leaf_Minusloop
+	call v4_Minus_Greater
+	mov $45,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS405
+	call v4__dscheck
+.LDS405:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,89,.LM2613-main
+.LM2613:
+	mov $1730,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS406
+	call v4__dscheck
+.LDS406:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_leaf_Minusnested
+	call v4_Minus_Greater
+	mov $138,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS407
+	call v4__dscheck
+.LDS407:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,90,.LM2621-main
+.LM2621:
+	mov $1740,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS408
+	call v4__dscheck
+.LDS408:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $6,%rax
+	mov %rax,-16(%rbp)
+	mov -16(%rbp),%rax
+	mov %rax,%r8
+	mov -16(%rbp),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	add %rdx,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,90,.LM2641-main
+.LM2641:
+	cmp $4080,%rcx
+	jbe .LDS409
+	call v4__dscheck
+.LDS409:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $12,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS410
+	call v4__dscheck
+.LDS410:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,91,.LM2645-main
+.LM2645:
+	mov $1750,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS411
+	call v4__dscheck
+.LDS411:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $42,%rax
+	mov %rax,v4_leaf_Minusvar(%rip)
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,91,.LM2662-main
+.LM2662:
+	cmp $4080,%rcx
+	jbe .LDS412
+	call v4__dscheck
+.LDS412:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $42,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS413
+	call v4__dscheck
+.LDS413:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,92,.LM2666-main
+.LM2666:
+	mov $1760,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS414
+	call v4__dscheck
+.LDS414:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_leaf1(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS415
+	call v4__dscheck
+.LDS415:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Minus_Greater
+	mov $49,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS416
+	call v4__dscheck
+.LDS416:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,93,.LM2678-main
+.LM2678:
+	mov $1770,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS417
+	call v4__dscheck
+.LDS417:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_leaf2(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS418
+	call v4__dscheck
+.LDS418:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $5,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS419
+	call v4__dscheck
+.LDS419:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,96,.LM2696-main
+.LM2696:
+	lea .LC4(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $26,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS420
+	call v4__dscheck
+.LDS420:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,114,.LM2702-main
+.LM2702:
+	mov $300,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS421
+	call v4__dscheck
+.LDS421:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%r8
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jge .L262
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS422
+	call v4__dscheck
+.LDS422:
+	jmp .L263
+.L262:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS423
+	call v4__dscheck
+.LDS423:
+.L263:
+.stabn 68,0,114,.LM2723-main
+.LM2723:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS424
+	call v4__dscheck
+.LDS424:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,115,.LM2727-main
+.LM2727:
+	mov $310,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS425
+	call v4__dscheck
+.LDS425:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%r8
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jge .L264
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS426
+	call v4__dscheck
+.LDS426:
+	jmp .L265
+.L264:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS427
+	call v4__dscheck
+.LDS427:
+.L265:
+.stabn 68,0,115,.LM2748-main
+.LM2748:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS428
+	call v4__dscheck
+.LDS428:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,116,.LM2752-main
+.LM2752:
+	mov $320,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS429
+	call v4__dscheck
+.LDS429:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%r8
+	xor %rax,%rax
+	dec %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jge .L266
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS430
+	call v4__dscheck
+.LDS430:
+	jmp .L267
+.L266:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS431
+	call v4__dscheck
+.LDS431:
+.L267:
+.stabn 68,0,116,.LM2773-main
+.LM2773:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS432
+	call v4__dscheck
+.LDS432:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,117,.LM2777-main
+.LM2777:
+	mov $330,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS433
+	call v4__dscheck
+.LDS433:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%r8
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jle .L268
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS434
+	call v4__dscheck
+.LDS434:
+	jmp .L269
+.L268:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS435
+	call v4__dscheck
+.LDS435:
+.L269:
+.stabn 68,0,117,.LM2798-main
+.LM2798:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS436
+	call v4__dscheck
+.LDS436:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,118,.LM2802-main
+.LM2802:
+	mov $340,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS437
+	call v4__dscheck
+.LDS437:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%r8
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jle .L270
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS438
+	call v4__dscheck
+.LDS438:
+	jmp .L271
+.L270:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS439
+	call v4__dscheck
+.LDS439:
+.L271:
+.stabn 68,0,118,.LM2823-main
+.LM2823:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS440
+	call v4__dscheck
+.LDS440:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,119,.LM2827-main
+.LM2827:
+	mov $350,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS441
+	call v4__dscheck
+.LDS441:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jne .L272
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS442
+	call v4__dscheck
+.LDS442:
+	jmp .L273
+.L272:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS443
+	call v4__dscheck
+.LDS443:
+.L273:
+.stabn 68,0,119,.LM2848-main
+.LM2848:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS444
+	call v4__dscheck
+.LDS444:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,120,.LM2852-main
+.LM2852:
+	mov $360,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS445
+	call v4__dscheck
+.LDS445:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%r8
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jne .L274
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS446
+	call v4__dscheck
+.LDS446:
+	jmp .L275
+.L274:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS447
+	call v4__dscheck
+.LDS447:
+.L275:
+.stabn 68,0,120,.LM2873-main
+.LM2873:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS448
+	call v4__dscheck
+.LDS448:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,121,.LM2877-main
+.LM2877:
+	mov $370,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS449
+	call v4__dscheck
+.LDS449:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%r8
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	je .L276
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS450
+	call v4__dscheck
+.LDS450:
+	jmp .L277
+.L276:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS451
+	call v4__dscheck
+.LDS451:
+.L277:
+.stabn 68,0,121,.LM2898-main
+.LM2898:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS452
+	call v4__dscheck
+.LDS452:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,122,.LM2902-main
+.LM2902:
+	mov $380,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS453
+	call v4__dscheck
+.LDS453:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	je .L278
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS454
+	call v4__dscheck
+.LDS454:
+	jmp .L279
+.L278:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS455
+	call v4__dscheck
+.LDS455:
+.L279:
+.stabn 68,0,122,.LM2923-main
+.LM2923:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS456
+	call v4__dscheck
+.LDS456:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,123,.LM2927-main
+.LM2927:
+	mov $390,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS457
+	call v4__dscheck
+.LDS457:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%r8
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jae .L280
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS458
+	call v4__dscheck
+.LDS458:
+	jmp .L281
+.L280:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS459
+	call v4__dscheck
+.LDS459:
+.L281:
+.stabn 68,0,123,.LM2948-main
+.LM2948:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS460
+	call v4__dscheck
+.LDS460:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,124,.LM2952-main
+.LM2952:
+	mov $400,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS461
+	call v4__dscheck
+.LDS461:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%r8
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jae .L282
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS462
+	call v4__dscheck
+.LDS462:
+	jmp .L283
+.L282:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS463
+	call v4__dscheck
+.LDS463:
+.L283:
+.stabn 68,0,124,.LM2973-main
+.LM2973:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS464
+	call v4__dscheck
+.LDS464:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,125,.LM2977-main
+.LM2977:
+	mov $410,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS465
+	call v4__dscheck
+.LDS465:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov %rax,%r8
+	mov v4_max_Minusuint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jae .L284
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS466
+	call v4__dscheck
+.LDS466:
+	jmp .L285
+.L284:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS467
+	call v4__dscheck
+.LDS467:
+.L285:
+.stabn 68,0,125,.LM2998-main
+.LM2998:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS468
+	call v4__dscheck
+.LDS468:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,126,.LM3002-main
+.LM3002:
+	mov $420,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS469
+	call v4__dscheck
+.LDS469:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%r8
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jbe .L286
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS470
+	call v4__dscheck
+.LDS470:
+	jmp .L287
+.L286:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS471
+	call v4__dscheck
+.LDS471:
+.L287:
+.stabn 68,0,126,.LM3023-main
+.LM3023:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS472
+	call v4__dscheck
+.LDS472:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,127,.LM3027-main
+.LM3027:
+	mov $430,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS473
+	call v4__dscheck
+.LDS473:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusuint(%rip),%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jbe .L288
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS474
+	call v4__dscheck
+.LDS474:
+	jmp .L289
+.L288:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS475
+	call v4__dscheck
+.LDS475:
+.L289:
+.stabn 68,0,127,.LM3048-main
+.LM3048:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS476
+	call v4__dscheck
+.LDS476:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,128,.LM3052-main
+.LM3052:
+	mov $440,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS477
+	call v4__dscheck
+.LDS477:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	ja .L290
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS478
+	call v4__dscheck
+.LDS478:
+	jmp .L291
+.L290:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS479
+	call v4__dscheck
+.LDS479:
+.L291:
+.stabn 68,0,128,.LM3073-main
+.LM3073:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS480
+	call v4__dscheck
+.LDS480:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,129,.LM3077-main
+.LM3077:
+	mov $450,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS481
+	call v4__dscheck
+.LDS481:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%r8
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	ja .L292
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS482
+	call v4__dscheck
+.LDS482:
+	jmp .L293
+.L292:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS483
+	call v4__dscheck
+.LDS483:
+.L293:
+.stabn 68,0,129,.LM3098-main
+.LM3098:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS484
+	call v4__dscheck
+.LDS484:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,130,.LM3102-main
+.LM3102:
+	mov $460,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS485
+	call v4__dscheck
+.LDS485:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%r8
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jb .L294
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS486
+	call v4__dscheck
+.LDS486:
+	jmp .L295
+.L294:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS487
+	call v4__dscheck
+.LDS487:
+.L295:
+.stabn 68,0,130,.LM3123-main
+.LM3123:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS488
+	call v4__dscheck
+.LDS488:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,131,.LM3127-main
+.LM3127:
+	mov $470,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS489
+	call v4__dscheck
+.LDS489:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusuint(%rip),%rax
+	mov %rax,%r8
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jb .L296
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS490
+	call v4__dscheck
+.LDS490:
+	jmp .L297
+.L296:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS491
+	call v4__dscheck
+.LDS491:
+.L297:
+.stabn 68,0,131,.LM3148-main
+.LM3148:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS492
+	call v4__dscheck
+.LDS492:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,132,.LM3152-main
+.LM3152:
+	mov $480,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS493
+	call v4__dscheck
+.LDS493:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	jne .L298
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS494
+	call v4__dscheck
+.LDS494:
+	jmp .L299
+.L298:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS495
+	call v4__dscheck
+.LDS495:
+.L299:
+.stabn 68,0,132,.LM3170-main
+.LM3170:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS496
+	call v4__dscheck
+.LDS496:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,133,.LM3174-main
+.LM3174:
+	mov $490,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS497
+	call v4__dscheck
+.LDS497:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	test %rax,%rax
+	jne .L300
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS498
+	call v4__dscheck
+.LDS498:
+	jmp .L301
+.L300:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS499
+	call v4__dscheck
+.LDS499:
+.L301:
+.stabn 68,0,133,.LM3192-main
+.LM3192:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS500
+	call v4__dscheck
+.LDS500:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,134,.LM3196-main
+.LM3196:
+	mov $500,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS501
+	call v4__dscheck
+.LDS501:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	test %rax,%rax
+	jge .L302
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS502
+	call v4__dscheck
+.LDS502:
+	jmp .L303
+.L302:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS503
+	call v4__dscheck
+.LDS503:
+.L303:
+.stabn 68,0,134,.LM3214-main
+.LM3214:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS504
+	call v4__dscheck
+.LDS504:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,135,.LM3218-main
+.LM3218:
+	mov $510,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS505
+	call v4__dscheck
+.LDS505:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	test %rax,%rax
+	jge .L304
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS506
+	call v4__dscheck
+.LDS506:
+	jmp .L305
+.L304:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS507
+	call v4__dscheck
+.LDS507:
+.L305:
+.stabn 68,0,135,.LM3236-main
+.LM3236:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS508
+	call v4__dscheck
+.LDS508:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,136,.LM3240-main
+.LM3240:
+	mov $520,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS509
+	call v4__dscheck
+.LDS509:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	test %rax,%rax
+	jle .L306
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS510
+	call v4__dscheck
+.LDS510:
+	jmp .L307
+.L306:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS511
+	call v4__dscheck
+.LDS511:
+.L307:
+.stabn 68,0,136,.LM3258-main
+.LM3258:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS512
+	call v4__dscheck
+.LDS512:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,137,.LM3262-main
+.LM3262:
+	mov $530,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS513
+	call v4__dscheck
+.LDS513:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	test %rax,%rax
+	jle .L308
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS514
+	call v4__dscheck
+.LDS514:
+	jmp .L309
+.L308:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS515
+	call v4__dscheck
+.LDS515:
+.L309:
+.stabn 68,0,137,.LM3280-main
+.LM3280:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS516
+	call v4__dscheck
+.LDS516:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,138,.LM3284-main
+.LM3284:
+	mov $540,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS517
+	call v4__dscheck
+.LDS517:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $4,%rax
+	mov %rax,%r8
+.stabn 68,0,109,.LM3290-main
+.LM3290:
+	mov $5,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jge .L310
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS518
+	call v4__dscheck
+.LDS518:
+	jmp .L311
+.L310:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS519
+	call v4__dscheck
+.LDS519:
+.L311:
+.stabn 68,0,138,.LM3305-main
+.LM3305:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS520
+	call v4__dscheck
+.LDS520:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,139,.LM3309-main
+.LM3309:
+	mov $550,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS521
+	call v4__dscheck
+.LDS521:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov %rax,%r8
+.stabn 68,0,109,.LM3315-main
+.LM3315:
+	mov $5,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jge .L312
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS522
+	call v4__dscheck
+.LDS522:
+	jmp .L313
+.L312:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS523
+	call v4__dscheck
+.LDS523:
+.L313:
+.stabn 68,0,139,.LM3330-main
+.LM3330:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS524
+	call v4__dscheck
+.LDS524:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,140,.LM3334-main
+.LM3334:
+	mov $560,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS525
+	call v4__dscheck
+.LDS525:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%r8
+.stabn 68,0,109,.LM3340-main
+.LM3340:
+	mov $5,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jge .L314
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS526
+	call v4__dscheck
+.LDS526:
+	jmp .L315
+.L314:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS527
+	call v4__dscheck
+.LDS527:
+.L315:
+.stabn 68,0,140,.LM3355-main
+.LM3355:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS528
+	call v4__dscheck
+.LDS528:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,141,.LM3359-main
+.LM3359:
+	mov $570,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS529
+	call v4__dscheck
+.LDS529:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov %rax,%r8
+.stabn 68,0,109,.LM3365-main
+.LM3365:
+	mov $5,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	mov v4__dsindex(%rip),%rcx
+	cmp %rdx,%rax
+	jge .L316
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS530
+	call v4__dscheck
+.LDS530:
+	jmp .L317
+.L316:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS531
+	call v4__dscheck
+.LDS531:
+.L317:
+.stabn 68,0,141,.LM3380-main
+.LM3380:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS532
+	call v4__dscheck
+.LDS532:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,142,.LM3384-main
+.LM3384:
+	mov $580,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS533
+	call v4__dscheck
+.LDS533:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,110,.LM3390-main
+.LM3390:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS534
+	call v4__dscheck
+.LDS534:
+.L318:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_over
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS535
+	call v4__dscheck
+.LDS535:
+	test %rax,%rax
+	jle .L319
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS536
+	call v4__dscheck
+.LDS536:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS537
+	call v4__dscheck
+.LDS537:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	dec %rax
+	cmp $4080,%rcx
+	jbe .LDS538
+	call v4__dscheck
+.LDS538:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS539
+	call v4__dscheck
+.LDS539:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L318
+.L319:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_nip
+.stabn 68,0,142,.LM3412-main
+.LM3412:
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS540
+	call v4__dscheck
+.LDS540:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,143,.LM3416-main
+.LM3416:
+	mov $590,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS541
+	call v4__dscheck
+.LDS541:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,110,.LM3422-main
+.LM3422:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS542
+	call v4__dscheck
+.LDS542:
+.L320:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_over
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS543
+	call v4__dscheck
+.LDS543:
+	test %rax,%rax
+	jle .L321
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS544
+	call v4__dscheck
+.LDS544:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS545
+	call v4__dscheck
+.LDS545:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	dec %rax
+	cmp $4080,%rcx
+	jbe .LDS546
+	call v4__dscheck
+.LDS546:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS547
+	call v4__dscheck
+.LDS547:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L320
+.L321:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_nip
+.stabn 68,0,143,.LM3444-main
+.LM3444:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS548
+	call v4__dscheck
+.LDS548:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,144,.LM3448-main
+.LM3448:
+	mov $600,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS549
+	call v4__dscheck
+.LDS549:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,110,.LM3454-main
+.LM3454:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS550
+	call v4__dscheck
+.LDS550:
+.L322:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_over
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS551
+	call v4__dscheck
+.LDS551:
+	test %rax,%rax
+	jle .L323
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS552
+	call v4__dscheck
+.LDS552:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS553
+	call v4__dscheck
+.LDS553:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	dec %rax
+	cmp $4080,%rcx
+	jbe .LDS554
+	call v4__dscheck
+.LDS554:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS555
+	call v4__dscheck
+.LDS555:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	mov v4__dsindex(%rip),%rcx
+	jmp .L322
+.L323:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_nip
+.stabn 68,0,144,.LM3476-main
+.LM3476:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS556
+	call v4__dscheck
+.LDS556:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,145,.LM3480-main
+.LM3480:
+	mov $610,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS557
+	call v4__dscheck
+.LDS557:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,111,.LM3486-main
+.LM3486:
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS558
+	call v4__dscheck
+.LDS558:
+.L324:
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS559
+	call v4__dscheck
+.LDS559:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS560
+	call v4__dscheck
+.LDS560:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_z2dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rdx
+	mov (%rdx,%rcx,8),%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS561
+	call v4__dscheck
+.LDS561:
+	cmp %rdx,%rax
+	jne .L324
+	mov %rcx,v4__dsindex(%rip)
+	call v4_nip
+.stabn 68,0,145,.LM3501-main
+.LM3501:
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS562
+	call v4__dscheck
+.LDS562:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,146,.LM3505-main
+.LM3505:
+	mov $620,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS563
+	call v4__dscheck
+.LDS563:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	mov $2,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS564
+	call v4__dscheck
+.LDS564:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS565
+	call v4__dscheck
+.LDS565:
+	test %rax,%rax
+	je .L325
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov v4_Lesstrue_Greater(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS566
+	call v4__dscheck
+.LDS566:
+.L325:
+.stabn 68,0,146,.LM3525-main
+.LM3525:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_Lesstrue_Greater(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS567
+	call v4__dscheck
+.LDS567:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,147,.LM3529-main
+.LM3529:
+	mov $630,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS568
+	call v4__dscheck
+.LDS568:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	cmp %rdx,%rax
+	setl %al
+	movzbl %al,%eax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS569
+	call v4__dscheck
+.LDS569:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS570
+	call v4__dscheck
+.LDS570:
+	test %rax,%rax
+	je .L326
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov v4_Lesstrue_Greater(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS571
+	call v4__dscheck
+.LDS571:
+.L326:
+.stabn 68,0,147,.LM3549-main
+.LM3549:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS572
+	call v4__dscheck
+.LDS572:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,150,.LM3553-main
+.LM3553:
+	lea .LC5(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $21,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS573
+	call v4__dscheck
+.LDS573:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,178,.LM3559-main
+.LM3559:
+	mov $700,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS574
+	call v4__dscheck
+.LDS574:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS575
+	call v4__dscheck
+.LDS575:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dense
+	call v4_Minus_Greater
+	mov $99,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS576
+	call v4__dscheck
+.LDS576:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,179,.LM3569-main
+.LM3569:
+	mov $710,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS577
+	call v4__dscheck
+.LDS577:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS578
+	call v4__dscheck
+.LDS578:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dense
+	call v4_Minus_Greater
+	mov $10,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS579
+	call v4__dscheck
+.LDS579:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,180,.LM3579-main
+.LM3579:
+	mov $720,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS580
+	call v4__dscheck
+.LDS580:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS581
+	call v4__dscheck
+.LDS581:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dense
+	call v4_Minus_Greater
+	mov $13,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS582
+	call v4__dscheck
+.LDS582:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,181,.LM3589-main
+.LM3589:
+	mov $730,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS583
+	call v4__dscheck
+.LDS583:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS584
+	call v4__dscheck
+.LDS584:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dense
+	call v4_Minus_Greater
+	mov $15,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS585
+	call v4__dscheck
+.LDS585:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,182,.LM3599-main
+.LM3599:
+	mov $740,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS586
+	call v4__dscheck
+.LDS586:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS587
+	call v4__dscheck
+.LDS587:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dense
+	call v4_Minus_Greater
+	mov $106,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS588
+	call v4__dscheck
+.LDS588:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,183,.LM3609-main
+.LM3609:
+	mov $750,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS589
+	call v4__dscheck
+.LDS589:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS590
+	call v4__dscheck
+.LDS590:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dense
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $100,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Plus(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS591
+	call v4__dscheck
+.LDS591:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,184,.LM3624-main
+.LM3624:
+	mov $760,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS592
+	call v4__dscheck
+.LDS592:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS593
+	call v4__dscheck
+.LDS593:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dense
+	call v4_Minus_Greater
+	mov v4_max_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $100,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Plus(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS594
+	call v4__dscheck
+.LDS594:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,185,.LM3639-main
+.LM3639:
+	mov $770,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS595
+	call v4__dscheck
+.LDS595:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS596
+	call v4__dscheck
+.LDS596:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS597
+	call v4__dscheck
+.LDS597:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,186,.LM3649-main
+.LM3649:
+	mov $780,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS598
+	call v4__dscheck
+.LDS598:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS599
+	call v4__dscheck
+.LDS599:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS600
+	call v4__dscheck
+.LDS600:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,187,.LM3659-main
+.LM3659:
+	mov $790,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS601
+	call v4__dscheck
+.LDS601:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS602
+	call v4__dscheck
+.LDS602:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gapped
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS603
+	call v4__dscheck
+.LDS603:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,188,.LM3669-main
+.LM3669:
+	mov $800,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS604
+	call v4__dscheck
+.LDS604:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS605
+	call v4__dscheck
+.LDS605:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS606
+	call v4__dscheck
+.LDS606:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,189,.LM3679-main
+.LM3679:
+	mov $810,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS607
+	call v4__dscheck
+.LDS607:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS608
+	call v4__dscheck
+.LDS608:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gapped
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS609
+	call v4__dscheck
+.LDS609:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,190,.LM3689-main
+.LM3689:
+	mov $820,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS610
+	call v4__dscheck
+.LDS610:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS611
+	call v4__dscheck
+.LDS611:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_gapped
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS612
+	call v4__dscheck
+.LDS612:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,191,.LM3699-main
+.LM3699:
+	mov $830,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS613
+	call v4__dscheck
+.LDS613:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-1000,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS614
+	call v4__dscheck
+.LDS614:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS615
+	call v4__dscheck
+.LDS615:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,192,.LM3709-main
+.LM3709:
+	mov $840,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS616
+	call v4__dscheck
+.LDS616:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS617
+	call v4__dscheck
+.LDS617:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS618
+	call v4__dscheck
+.LDS618:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,193,.LM3719-main
+.LM3719:
+	mov $850,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS619
+	call v4__dscheck
+.LDS619:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS620
+	call v4__dscheck
+.LDS620:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS621
+	call v4__dscheck
+.LDS621:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,194,.LM3729-main
+.LM3729:
+	mov $860,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS622
+	call v4__dscheck
+.LDS622:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS623
+	call v4__dscheck
+.LDS623:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS624
+	call v4__dscheck
+.LDS624:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,195,.LM3739-main
+.LM3739:
+	mov $870,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS625
+	call v4__dscheck
+.LDS625:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $1000,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS626
+	call v4__dscheck
+.LDS626:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS627
+	call v4__dscheck
+.LDS627:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,196,.LM3749-main
+.LM3749:
+	mov $880,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS628
+	call v4__dscheck
+.LDS628:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $65536,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS629
+	call v4__dscheck
+.LDS629:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS630
+	call v4__dscheck
+.LDS630:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,197,.LM3759-main
+.LM3759:
+	mov $890,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS631
+	call v4__dscheck
+.LDS631:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-1001,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS632
+	call v4__dscheck
+.LDS632:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS633
+	call v4__dscheck
+.LDS633:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,198,.LM3769-main
+.LM3769:
+	mov $900,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS634
+	call v4__dscheck
+.LDS634:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS635
+	call v4__dscheck
+.LDS635:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS636
+	call v4__dscheck
+.LDS636:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,199,.LM3779-main
+.LM3779:
+	mov $910,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS637
+	call v4__dscheck
+.LDS637:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $8,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS638
+	call v4__dscheck
+.LDS638:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS639
+	call v4__dscheck
+.LDS639:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,200,.LM3789-main
+.LM3789:
+	mov $920,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS640
+	call v4__dscheck
+.LDS640:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $999,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS641
+	call v4__dscheck
+.LDS641:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS642
+	call v4__dscheck
+.LDS642:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,201,.LM3799-main
+.LM3799:
+	mov $930,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS643
+	call v4__dscheck
+.LDS643:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $65537,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS644
+	call v4__dscheck
+.LDS644:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS645
+	call v4__dscheck
+.LDS645:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,202,.LM3809-main
+.LM3809:
+	mov $940,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS646
+	call v4__dscheck
+.LDS646:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS647
+	call v4__dscheck
+.LDS647:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS648
+	call v4__dscheck
+.LDS648:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,203,.LM3819-main
+.LM3819:
+	mov $950,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS649
+	call v4__dscheck
+.LDS649:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS650
+	call v4__dscheck
+.LDS650:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sparse
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS651
+	call v4__dscheck
+.LDS651:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,204,.LM3829-main
+.LM3829:
+	mov $960,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS652
+	call v4__dscheck
+.LDS652:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS653
+	call v4__dscheck
+.LDS653:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_nodefault
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,205,.LM3837-main
+.LM3837:
+	mov $970,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS654
+	call v4__dscheck
+.LDS654:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS655
+	call v4__dscheck
+.LDS655:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_nodefault
+	call v4_Minus_Greater
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS656
+	call v4__dscheck
+.LDS656:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,206,.LM3847-main
+.LM3847:
+	mov $980,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS657
+	call v4__dscheck
+.LDS657:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS658
+	call v4__dscheck
+.LDS658:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_nodefault
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,209,.LM3855-main
+.LM3855:
+	lea .LC6(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $48,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS659
+	call v4__dscheck
+.LDS659:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,228,.LM3861-main
+.LM3861:
+	xor %rax,%rax
+	mov %rax,v4_Hashdividends(%rip)
+.stabn 68,0,239,.LM3868-main
+.LM3868:
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS660
+	call v4__dscheck
+.LDS660:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS661
+	call v4__dscheck
+.LDS661:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS662
+	call v4__dscheck
+.LDS662:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS663
+	call v4__dscheck
+.LDS663:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+.stabn 68,0,240,.LM3880-main
+.LM3880:
+	mov $-2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS664
+	call v4__dscheck
+.LDS664:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS665
+	call v4__dscheck
+.LDS665:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS666
+	call v4__dscheck
+.LDS666:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS667
+	call v4__dscheck
+.LDS667:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+.stabn 68,0,241,.LM3892-main
+.LM3892:
+	mov $-100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS668
+	call v4__dscheck
+.LDS668:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+	mov $12345,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS669
+	call v4__dscheck
+.LDS669:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+	mov $-12345,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS670
+	call v4__dscheck
+.LDS670:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+.stabn 68,0,242,.LM3901-main
+.LM3901:
+	mov v4_max_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS671
+	call v4__dscheck
+.LDS671:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+	mov v4_max_Minusint(%rip),%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS672
+	call v4__dscheck
+.LDS672:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+.stabn 68,0,243,.LM3911-main
+.LM3911:
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS673
+	call v4__dscheck
+.LDS673:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+	mov v4_min_Minusint(%rip),%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS674
+	call v4__dscheck
+.LDS674:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dividend_Comma
+.stabn 68,0,245,.LM3921-main
+.LM3921:
+	mov $1000,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS675
+	call v4__dscheck
+.LDS675:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Slash1(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Slash(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS676
+	call v4__dscheck
+.LDS676:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS677
+	call v4__dscheck
+.LDS677:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,246,.LM3935-main
+.LM3935:
+	mov $1010,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS678
+	call v4__dscheck
+.LDS678:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_mod1(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_mod(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS679
+	call v4__dscheck
+.LDS679:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS680
+	call v4__dscheck
+.LDS680:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,247,.LM3949-main
+.LM3949:
+	mov $1020,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS681
+	call v4__dscheck
+.LDS681:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Slash2(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Slash(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS682
+	call v4__dscheck
+.LDS682:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS683
+	call v4__dscheck
+.LDS683:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,248,.LM3963-main
+.LM3963:
+	mov $1030,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS684
+	call v4__dscheck
+.LDS684:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_mod2(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $2,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_mod(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS685
+	call v4__dscheck
+.LDS685:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS686
+	call v4__dscheck
+.LDS686:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,249,.LM3977-main
+.LM3977:
+	mov $1040,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS687
+	call v4__dscheck
+.LDS687:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Slash3(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Slash(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS688
+	call v4__dscheck
+.LDS688:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS689
+	call v4__dscheck
+.LDS689:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,250,.LM3991-main
+.LM3991:
+	mov $1050,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS690
+	call v4__dscheck
+.LDS690:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_mod3(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_mod(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS691
+	call v4__dscheck
+.LDS691:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS692
+	call v4__dscheck
+.LDS692:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,251,.LM4005-main
+.LM4005:
+	mov $1060,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS693
+	call v4__dscheck
+.LDS693:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Slash_Minus3(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Slash(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS694
+	call v4__dscheck
+.LDS694:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS695
+	call v4__dscheck
+.LDS695:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,252,.LM4019-main
+.LM4019:
+	mov $1070,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS696
+	call v4__dscheck
+.LDS696:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_mod_Minus3(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_mod(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS697
+	call v4__dscheck
+.LDS697:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS698
+	call v4__dscheck
+.LDS698:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,253,.LM4033-main
+.LM4033:
+	mov $1080,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS699
+	call v4__dscheck
+.LDS699:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Slash7(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $7,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Slash(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS700
+	call v4__dscheck
+.LDS700:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS701
+	call v4__dscheck
+.LDS701:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,254,.LM4047-main
+.LM4047:
+	mov $1090,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS702
+	call v4__dscheck
+.LDS702:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_mod7(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $7,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_mod(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS703
+	call v4__dscheck
+.LDS703:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS704
+	call v4__dscheck
+.LDS704:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,255,.LM4061-main
+.LM4061:
+	mov $1100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS705
+	call v4__dscheck
+.LDS705:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Slash8(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $8,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Slash(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS706
+	call v4__dscheck
+.LDS706:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS707
+	call v4__dscheck
+.LDS707:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,256,.LM4075-main
+.LM4075:
+	mov $1110,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS708
+	call v4__dscheck
+.LDS708:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_mod8(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $8,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_mod(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS709
+	call v4__dscheck
+.LDS709:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS710
+	call v4__dscheck
+.LDS710:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,257,.LM4089-main
+.LM4089:
+	mov $1120,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS711
+	call v4__dscheck
+.LDS711:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Slash_Minus8(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-8,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Slash(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS712
+	call v4__dscheck
+.LDS712:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS713
+	call v4__dscheck
+.LDS713:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,258,.LM4103-main
+.LM4103:
+	mov $1130,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS714
+	call v4__dscheck
+.LDS714:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_mod_Minus8(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-8,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_mod(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS715
+	call v4__dscheck
+.LDS715:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS716
+	call v4__dscheck
+.LDS716:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,259,.LM4117-main
+.LM4117:
+	mov $1140,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS717
+	call v4__dscheck
+.LDS717:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Slash10(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $10,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Slash(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS718
+	call v4__dscheck
+.LDS718:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS719
+	call v4__dscheck
+.LDS719:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,260,.LM4131-main
+.LM4131:
+	mov $1150,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS720
+	call v4__dscheck
+.LDS720:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_mod10(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $10,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_mod(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS721
+	call v4__dscheck
+.LDS721:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS722
+	call v4__dscheck
+.LDS722:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,261,.LM4145-main
+.LM4145:
+	mov $1160,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS723
+	call v4__dscheck
+.LDS723:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Slash_Minus10(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-10,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Slash(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS724
+	call v4__dscheck
+.LDS724:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS725
+	call v4__dscheck
+.LDS725:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,262,.LM4159-main
+.LM4159:
+	mov $1170,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS726
+	call v4__dscheck
+.LDS726:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_mod_Minus10(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-10,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_mod(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS727
+	call v4__dscheck
+.LDS727:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS728
+	call v4__dscheck
+.LDS728:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,263,.LM4173-main
+.LM4173:
+	mov $1180,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS729
+	call v4__dscheck
+.LDS729:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Star0(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Star(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS730
+	call v4__dscheck
+.LDS730:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS731
+	call v4__dscheck
+.LDS731:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,264,.LM4187-main
+.LM4187:
+	mov $1190,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS732
+	call v4__dscheck
+.LDS732:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Star1(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Star(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS733
+	call v4__dscheck
+.LDS733:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS734
+	call v4__dscheck
+.LDS734:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,265,.LM4201-main
+.LM4201:
+	mov $1200,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS735
+	call v4__dscheck
+.LDS735:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Star_Minus1(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Star(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS736
+	call v4__dscheck
+.LDS736:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS737
+	call v4__dscheck
+.LDS737:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,266,.LM4215-main
+.LM4215:
+	mov $1210,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS738
+	call v4__dscheck
+.LDS738:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Star3(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $3,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Star(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS739
+	call v4__dscheck
+.LDS739:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS740
+	call v4__dscheck
+.LDS740:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,267,.LM4229-main
+.LM4229:
+	mov $1220,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS741
+	call v4__dscheck
+.LDS741:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Star8(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $8,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Star(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS742
+	call v4__dscheck
+.LDS742:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS743
+	call v4__dscheck
+.LDS743:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,268,.LM4243-main
+.LM4243:
+	mov $1230,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS744
+	call v4__dscheck
+.LDS744:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Star_Minus8(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-8,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Star(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS745
+	call v4__dscheck
+.LDS745:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS746
+	call v4__dscheck
+.LDS746:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,269,.LM4257-main
+.LM4257:
+	mov $1240,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS747
+	call v4__dscheck
+.LDS747:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Star10(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $10,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Star(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS748
+	call v4__dscheck
+.LDS748:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS749
+	call v4__dscheck
+.LDS749:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,270,.LM4271-main
+.LM4271:
+	mov $1250,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS750
+	call v4__dscheck
+.LDS750:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_Star_Minus7(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-7,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Star(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS751
+	call v4__dscheck
+.LDS751:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mismatches
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS752
+	call v4__dscheck
+.LDS752:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,274,.LM4285-main
+.LM4285:
+	mov $1270,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS753
+	call v4__dscheck
+.LDS753:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,220,.LM4291-main
+.LM4291:
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS754
+	call v4__dscheck
+.LDS754:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slash
+.stabn 68,0,274,.LM4294-main
+.LM4294:
+	call v4_Minus_Greater
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS755
+	call v4__dscheck
+.LDS755:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,275,.LM4298-main
+.LM4298:
+	mov $1280,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS756
+	call v4__dscheck
+.LDS756:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,220,.LM4304-main
+.LM4304:
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS757
+	call v4__dscheck
+.LDS757:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slash
+.stabn 68,0,275,.LM4307-main
+.LM4307:
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS758
+	call v4__dscheck
+.LDS758:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,276,.LM4311-main
+.LM4311:
+	mov $1290,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS759
+	call v4__dscheck
+.LDS759:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,220,.LM4317-main
+.LM4317:
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS760
+	call v4__dscheck
+.LDS760:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slash
+.stabn 68,0,276,.LM4320-main
+.LM4320:
+	call v4_Minus_Greater
+	mov v4_max_Minusint(%rip),%rax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS761
+	call v4__dscheck
+.LDS761:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,277,.LM4328-main
+.LM4328:
+	mov $1300,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS762
+	call v4__dscheck
+.LDS762:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,220,.LM4338-main
+.LM4338:
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS763
+	call v4__dscheck
+.LDS763:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Slash
+.stabn 68,0,277,.LM4341-main
+.LM4341:
+	call v4_Minus_Greater
+	mov v4_max_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS764
+	call v4__dscheck
+.LDS764:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,278,.LM4345-main
+.LM4345:
+	mov $1310,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS765
+	call v4__dscheck
+.LDS765:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,220,.LM4351-main
+.LM4351:
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS766
+	call v4__dscheck
+.LDS766:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mod
+.stabn 68,0,278,.LM4354-main
+.LM4354:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS767
+	call v4__dscheck
+.LDS767:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,279,.LM4358-main
+.LM4358:
+	mov $1320,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS768
+	call v4__dscheck
+.LDS768:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,220,.LM4368-main
+.LM4368:
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS769
+	call v4__dscheck
+.LDS769:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_mod
+.stabn 68,0,279,.LM4371-main
+.LM4371:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS770
+	call v4__dscheck
+.LDS770:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,280,.LM4375-main
+.LM4375:
+	mov $1330,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS771
+	call v4__dscheck
+.LDS771:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	mov %rax,%rdx
+	sar $63,%rdx
+	shr $61,%rdx
+	add %rdx,%rax
+	sar $3,%rax
+	neg %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,280,.LM4387-main
+.LM4387:
+	cmp $4080,%rcx
+	jbe .LDS772
+	call v4__dscheck
+.LDS772:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $-8,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_Slash(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS773
+	call v4__dscheck
+.LDS773:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,281,.LM4396-main
+.LM4396:
+	mov $1340,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS774
+	call v4__dscheck
+.LDS774:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $24,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,281,.LM4403-main
+.LM4403:
+	cmp $4080,%rcx
+	jbe .LDS775
+	call v4__dscheck
+.LDS775:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_cells(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS776
+	call v4__dscheck
+.LDS776:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,282,.LM4410-main
+.LM4410:
+	mov $1350,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS777
+	call v4__dscheck
+.LDS777:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_min_Minusint(%rip),%rax
+	inc %rax
+	shl $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,282,.LM4424-main
+.LM4424:
+	cmp $4080,%rcx
+	jbe .LDS778
+	call v4__dscheck
+.LDS778:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_cells(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS779
+	call v4__dscheck
+.LDS779:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_execute
+	call v4_Rightbrace
+.stabn 68,0,285,.LM4435-main
+.LM4435:
+	lea .LC7(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $31,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS780
+	call v4__dscheck
+.LDS780:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,287,.LM4441-main
+.LM4441:
+	mov $100,%rax
+	mov %rax,v4_hundred(%rip)
+.stabn 68,0,288,.LM4445-main
+.LM4445:
+	xor %rax,%rax
+	dec %rax
+	mov %rax,v4_minus_Minusone(%rip)
+.stabn 68,0,290,.LM4449-main
+.LM4449:
+	movabs $9223372036854775807,%rax
+	mov %rax,v4_biggest(%rip)
+.stabn 68,0,294,.LM4453-main
+.LM4453:
+	mov $300,%rax
+	mov %rax,v4_three_Minushundred(%rip)
+.stabn 68,0,295,.LM4460-main
+.LM4460:
+	xor %rax,%rax
+	mov %rax,v4_zero(%rip)
+.stabn 68,0,309,.LM4464-main
+.LM4464:
+	mov $1400,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS781
+	call v4__dscheck
+.LDS781:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,297,.LM4468-main
+.LM4468:
+	mov $200,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,309,.LM4471-main
+.LM4471:
+	cmp $4080,%rcx
+	jbe .LDS782
+	call v4__dscheck
+.LDS782:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $200,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS783
+	call v4__dscheck
+.LDS783:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,310,.LM4475-main
+.LM4475:
+	mov $1410,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS784
+	call v4__dscheck
+.LDS784:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,298,.LM4479-main
+.LM4479:
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,310,.LM4484-main
+.LM4484:
+	cmp $4080,%rcx
+	jbe .LDS785
+	call v4__dscheck
+.LDS785:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS786
+	call v4__dscheck
+.LDS786:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,311,.LM4488-main
+.LM4488:
+	mov $1420,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS787
+	call v4__dscheck
+.LDS787:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,299,.LM4492-main
+.LM4492:
+	movabs $-9223372036854775808,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,311,.LM4495-main
+.LM4495:
+	cmp $4080,%rcx
+	jbe .LDS788
+	call v4__dscheck
+.LDS788:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS789
+	call v4__dscheck
+.LDS789:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,312,.LM4499-main
+.LM4499:
+	mov $1430,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS790
+	call v4__dscheck
+.LDS790:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,300,.LM4503-main
+.LM4503:
+	mov $301,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,312,.LM4506-main
+.LM4506:
+	cmp $4080,%rcx
+	jbe .LDS791
+	call v4__dscheck
+.LDS791:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $301,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS792
+	call v4__dscheck
+.LDS792:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,313,.LM4510-main
+.LM4510:
+	mov $1440,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS793
+	call v4__dscheck
+.LDS793:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS794
+	call v4__dscheck
+.LDS794:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $-100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS795
+	call v4__dscheck
+.LDS795:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,314,.LM4525-main
+.LM4525:
+	mov $1450,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS796
+	call v4__dscheck
+.LDS796:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS797
+	call v4__dscheck
+.LDS797:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS798
+	call v4__dscheck
+.LDS798:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,315,.LM4535-main
+.LM4535:
+	mov $1460,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS799
+	call v4__dscheck
+.LDS799:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS800
+	call v4__dscheck
+.LDS800:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS801
+	call v4__dscheck
+.LDS801:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,316,.LM4545-main
+.LM4545:
+	mov $1470,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS802
+	call v4__dscheck
+.LDS802:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS803
+	call v4__dscheck
+.LDS803:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS804
+	call v4__dscheck
+.LDS804:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,317,.LM4555-main
+.LM4555:
+	mov $1480,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS805
+	call v4__dscheck
+.LDS805:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS806
+	call v4__dscheck
+.LDS806:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS807
+	call v4__dscheck
+.LDS807:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,318,.LM4565-main
+.LM4565:
+	mov $1490,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS808
+	call v4__dscheck
+.LDS808:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS809
+	call v4__dscheck
+.LDS809:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_use_Minusin_Minuscase
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS810
+	call v4__dscheck
+.LDS810:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,319,.LM4575-main
+.LM4575:
+	mov $1500,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS811
+	call v4__dscheck
+.LDS811:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4_use_Minuszero(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS812
+	call v4__dscheck
+.LDS812:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_catch
+	call v4_nip
+	call v4_Minus_Greater
+	mov $-10,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS813
+	call v4__dscheck
+.LDS813:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,322,.LM4588-main
+.LM4588:
+	lea .LC8(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $16,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS814
+	call v4__dscheck
+.LDS814:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,345,.LM4594-main
+.LM4594:
+	mov $1800,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS815
+	call v4__dscheck
+.LDS815:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $-7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $50,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $300,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,325,.LM4605-main
+.LM4605:
+	cmp $4080,%rcx
+	jbe .LDS816
+	call v4__dscheck
+.LDS816:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS817
+	call v4__dscheck
+.LDS817:
+	test %rax,%rax
+	jge .L350
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS818
+	call v4__dscheck
+.LDS818:
+	jmp .L352
+.L350:
+.stabn 68,0,326,.LM4616-main
+.LM4616:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS819
+	call v4__dscheck
+.LDS819:
+	cmp %rdx,%rax
+	jle .L351
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS820
+	call v4__dscheck
+.LDS820:
+.L351:
+.L352:
+.stabn 68,0,336,.LM4631-main
+.LM4631:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_rot
+.stabn 68,0,325,.LM4633-main
+.LM4633:
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS821
+	call v4__dscheck
+.LDS821:
+	test %rax,%rax
+	jge .L353
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS822
+	call v4__dscheck
+.LDS822:
+	jmp .L355
+.L353:
+.stabn 68,0,326,.LM4644-main
+.LM4644:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS823
+	call v4__dscheck
+.LDS823:
+	cmp %rdx,%rax
+	jle .L354
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS824
+	call v4__dscheck
+.LDS824:
+.L354:
+.L355:
+.stabn 68,0,336,.LM4659-main
+.LM4659:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_rot
+.stabn 68,0,325,.LM4661-main
+.LM4661:
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS825
+	call v4__dscheck
+.LDS825:
+	test %rax,%rax
+	jge .L356
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS826
+	call v4__dscheck
+.LDS826:
+	jmp .L358
+.L356:
+.stabn 68,0,326,.LM4672-main
+.LM4672:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS827
+	call v4__dscheck
+.LDS827:
+	cmp %rdx,%rax
+	jle .L357
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS828
+	call v4__dscheck
+.LDS828:
+.L357:
+.L358:
+.stabn 68,0,336,.LM4687-main
+.LM4687:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_rot
+.stabn 68,0,345,.LM4688-main
+.LM4688:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $50,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $100,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS829
+	call v4__dscheck
+.LDS829:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,346,.LM4696-main
+.LM4696:
+	mov $1810,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS830
+	call v4__dscheck
+.LDS830:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,337,.LM4700-main
+.LM4700:
+	mov $-5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS831
+	call v4__dscheck
+.LDS831:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sign
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS832
+	call v4__dscheck
+.LDS832:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sign
+	mov v4_min_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS833
+	call v4__dscheck
+.LDS833:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sign
+.stabn 68,0,346,.LM4709-main
+.LM4709:
+	call v4_Minus_Greater
+	xor %rax,%rax
+	dec %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS834
+	call v4__dscheck
+.LDS834:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,347,.LM4717-main
+.LM4717:
+	mov $1820,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS835
+	call v4__dscheck
+.LDS835:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,338,.LM4723-main
+.LM4723:
+	cmp $4080,%rcx
+	jbe .LDS836
+	call v4__dscheck
+.LDS836:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_twice
+	call v4_twice
+.stabn 68,0,347,.LM4725-main
+.LM4725:
+	call v4_Minus_Greater
+	mov $12,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS837
+	call v4__dscheck
+.LDS837:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,348,.LM4729-main
+.LM4729:
+	mov $1830,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS838
+	call v4__dscheck
+.LDS838:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_sum_Minusi
+	call v4_Minus_Greater
+	mov $10,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS839
+	call v4__dscheck
+.LDS839:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,349,.LM4737-main
+.LM4737:
+	mov $1840,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS840
+	call v4__dscheck
+.LDS840:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_sum_Minusi_Minusnoinline
+	call v4_Minus_Greater
+	mov $10,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS841
+	call v4__dscheck
+.LDS841:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,350,.LM4745-main
+.LM4745:
+	mov $1850,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS842
+	call v4__dscheck
+.LDS842:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_sum_Minusj
+	call v4_Minus_Greater
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS843
+	call v4__dscheck
+.LDS843:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,351,.LM4753-main
+.LM4753:
+	mov $1860,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS844
+	call v4__dscheck
+.LDS844:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,342,.LM4757-main
+.LM4757:
+	mov $10,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS845
+	call v4__dscheck
+.LDS845:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_find_Minusfirst
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS846
+	call v4__dscheck
+.LDS846:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_find_Minusfirst
+.stabn 68,0,351,.LM4763-main
+.LM4763:
+	call v4_Minus_Greater
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	dec %rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS847
+	call v4__dscheck
+.LDS847:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,352,.LM4769-main
+.LM4769:
+	mov $1870,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS848
+	call v4__dscheck
+.LDS848:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	call v4_use_Minusin_Minusloop
+	call v4_Minus_Greater
+	mov $250,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS849
+	call v4__dscheck
+.LDS849:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,353,.LM4777-main
+.LM4777:
+	mov $1880,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS850
+	call v4__dscheck
+.LDS850:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $10,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS851
+	call v4__dscheck
+.LDS851:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_factorial
+	call v4_Minus_Greater
+	mov $3628800,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS852
+	call v4__dscheck
+.LDS852:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,354,.LM4787-main
+.LM4787:
+	mov $1890,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS853
+	call v4__dscheck
+.LDS853:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_max_Minusint(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,325,.LM4793-main
+.LM4793:
+	cmp $4080,%rcx
+	jbe .LDS854
+	call v4__dscheck
+.LDS854:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS855
+	call v4__dscheck
+.LDS855:
+	test %rax,%rax
+	jge .L327
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS856
+	call v4__dscheck
+.LDS856:
+	jmp .L329
+.L327:
+.stabn 68,0,326,.LM4804-main
+.LM4804:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS857
+	call v4__dscheck
+.LDS857:
+	cmp %rdx,%rax
+	jle .L328
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS858
+	call v4__dscheck
+.LDS858:
+.L328:
+.L329:
+.stabn 68,0,354,.LM4819-main
+.LM4819:
+	mov v4_min_Minusint(%rip),%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,325,.LM4822-main
+.LM4822:
+	cmp $4080,%rcx
+	jbe .LDS859
+	call v4__dscheck
+.LDS859:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS860
+	call v4__dscheck
+.LDS860:
+	test %rax,%rax
+	jge .L330
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS861
+	call v4__dscheck
+.LDS861:
+	jmp .L332
+.L330:
+.stabn 68,0,326,.LM4833-main
+.LM4833:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $100,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS862
+	call v4__dscheck
+.LDS862:
+	cmp %rdx,%rax
+	jle .L331
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS863
+	call v4__dscheck
+.LDS863:
+.L331:
+.L332:
+.stabn 68,0,354,.LM4848-main
+.LM4848:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS864
+	call v4__dscheck
+.LDS864:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,357,.LM4854-main
+.LM4854:
+	lea .LC9(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $31,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS865
+	call v4__dscheck
+.LDS865:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,367,.LM4860-main
+.LM4860:
+	mov $1900,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS866
+	call v4__dscheck
+.LDS866:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $3,%rax
+	mov %rax,v4_step(%rip)
+	mov $10,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS867
+	call v4__dscheck
+.LDS867:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sum_Minusstep
+	call v4_Minus_Greater
+	mov $30,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS868
+	call v4__dscheck
+.LDS868:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,368,.LM4877-main
+.LM4877:
+	mov $1910,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS869
+	call v4__dscheck
+.LDS869:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,v4_step(%rip)
+	mov $4,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS870
+	call v4__dscheck
+.LDS870:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_bump_Minusstep
+	mov v4_step(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS871
+	call v4__dscheck
+.LDS871:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $10,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $5,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS872
+	call v4__dscheck
+.LDS872:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,369,.LM4901-main
+.LM4901:
+	mov $1920,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS873
+	call v4__dscheck
+.LDS873:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $2,%rax
+	mov %rax,v4_step(%rip)
+	mov $2,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS874
+	call v4__dscheck
+.LDS874:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_sum_Minusstep_Minus2
+	call v4_Minus_Greater
+	mov $15,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS875
+	call v4__dscheck
+.LDS875:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,372,.LM4918-main
+.LM4918:
+	lea .LC10(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $25,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS876
+	call v4__dscheck
+.LDS876:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,389,.LM4924-main
+.LM4924:
+	mov $2000,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS877
+	call v4__dscheck
+.LDS877:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $6,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS878
+	call v4__dscheck
+.LDS878:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $6,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $6,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS879
+	call v4__dscheck
+.LDS879:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,390,.LM4951-main
+.LM4951:
+	mov $2010,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS880
+	call v4__dscheck
+.LDS880:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $8,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,390,.LM4972-main
+.LM4972:
+	cmp $4080,%rcx
+	jbe .LDS881
+	call v4__dscheck
+.LDS881:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $8,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $8,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS882
+	call v4__dscheck
+.LDS882:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,391,.LM4978-main
+.LM4978:
+	mov $2020,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS883
+	call v4__dscheck
+.LDS883:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov %rax,%r8
+	mov $2,%rax
+	mov %r8,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS884
+	call v4__dscheck
+.LDS884:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS885
+	call v4__dscheck
+.LDS885:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,392,.LM5005-main
+.LM5005:
+	mov $2030,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS886
+	call v4__dscheck
+.LDS886:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_cell_Minusv(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,384,.LM5011-main
+.LM5011:
+	mov $5,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov $9,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS887
+	call v4__dscheck
+.LDS887:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	call v4_Store
+	mov v4_cell_Minusv(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,392,.LM5027-main
+.LM5027:
+	cmp $4080,%rcx
+	jbe .LDS888
+	call v4__dscheck
+.LDS888:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $9,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS889
+	call v4__dscheck
+.LDS889:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,393,.LM5031-main
+.LM5031:
+	mov $2040,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS890
+	call v4__dscheck
+.LDS890:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_cell_Minusv(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,385,.LM5037-main
+.LM5037:
+	xor %rax,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov $7,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS891
+	call v4__dscheck
+.LDS891:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_swap
+	call v4_c_Store
+	mov v4_cell_Minusv(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,393,.LM5053-main
+.LM5053:
+	cmp $4080,%rcx
+	jbe .LDS892
+	call v4__dscheck
+.LDS892:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $7,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS893
+	call v4__dscheck
+.LDS893:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,394,.LM5057-main
+.LM5057:
+	mov $2050,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS894
+	call v4__dscheck
+.LDS894:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	lea v4_cell_Minusv(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,386,.LM5063-main
+.LM5063:
+	mov $3,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	cmp $4080,%rcx
+	jbe .LDS895
+	call v4__dscheck
+.LDS895:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Fetch
+	mov $4,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS896
+	call v4__dscheck
+.LDS896:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $4,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS897
+	call v4__dscheck
+.LDS897:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,395,.LM5089-main
+.LM5089:
+	mov $2060,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS898
+	call v4__dscheck
+.LDS898:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+.stabn 68,0,387,.LM5093-main
+.LM5093:
+	mov $5,%rax
+	mov %rax,v4_cell_Minusv(%rip)
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS899
+	call v4__dscheck
+.LDS899:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_set_Minuscell_Minusv
+	mov v4_cell_Minusv(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,395,.LM5111-main
+.LM5111:
+	cmp $4080,%rcx
+	jbe .LDS900
+	call v4__dscheck
+.LDS900:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $11,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS901
+	call v4__dscheck
+.LDS901:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,398,.LM5117-main
+.LM5117:
+	lea .LC11(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	mov $40,%rax
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS902
+	call v4__dscheck
+.LDS902:
+	mov %rcx,v4__dsindex(%rip)
+	call v4__type
+	call v4_cr
+.stabn 68,0,414,.LM5123-main
+.LM5123:
+	mov $2100,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS903
+	call v4__dscheck
+.LDS903:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS904
+	call v4__dscheck
+.LDS904:
+	test %rax,%rax
+	je .L333
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS905
+	call v4__dscheck
+.LDS905:
+	test %rax,%rax
+	je .L334
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS906
+	call v4__dscheck
+.LDS906:
+	jmp .L335
+.L333:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS907
+	call v4__dscheck
+.LDS907:
+.L334:
+.L335:
+.stabn 68,0,414,.LM5146-main
+.LM5146:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS908
+	call v4__dscheck
+.LDS908:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,415,.LM5150-main
+.LM5150:
+	mov $2110,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS909
+	call v4__dscheck
+.LDS909:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	inc %rax
+	cmp $4080,%rcx
+	jbe .LDS910
+	call v4__dscheck
+.LDS910:
+	test %rax,%rax
+	je .L336
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS911
+	call v4__dscheck
+.LDS911:
+	test %rax,%rax
+	je .L337
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS912
+	call v4__dscheck
+.LDS912:
+	jmp .L338
+.L336:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS913
+	call v4__dscheck
+.LDS913:
+.L337:
+.L338:
+.stabn 68,0,415,.LM5173-main
+.LM5173:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS914
+	call v4__dscheck
+.LDS914:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,416,.LM5177-main
+.LM5177:
+	mov $2120,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS915
+	call v4__dscheck
+.LDS915:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	xor %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS916
+	call v4__dscheck
+.LDS916:
+	test %rax,%rax
+	je .L339
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS917
+	call v4__dscheck
+.LDS917:
+	test %rax,%rax
+	je .L340
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS918
+	call v4__dscheck
+.LDS918:
+	jmp .L341
+.L339:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_drop
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS919
+	call v4__dscheck
+.LDS919:
+.L340:
+.L341:
+.stabn 68,0,416,.LM5200-main
+.LM5200:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $3,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS920
+	call v4__dscheck
+.LDS920:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,417,.LM5204-main
+.LM5204:
+	mov $2130,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS921
+	call v4__dscheck
+.LDS921:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $10,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS922
+	call v4__dscheck
+.LDS922:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_count_Minusodd
+	call v4_Minus_Greater
+	mov $5,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS923
+	call v4__dscheck
+.LDS923:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,418,.LM5214-main
+.LM5214:
+	mov $2140,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS924
+	call v4__dscheck
+.LDS924:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS925
+	call v4__dscheck
+.LDS925:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_count_Minusodd
+	call v4_Minus_Greater
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS926
+	call v4__dscheck
+.LDS926:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,419,.LM5224-main
+.LM5224:
+	mov $2150,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS927
+	call v4__dscheck
+.LDS927:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov v4_Lesstrue_Greater(%rip),%rax
+	mov v4__dsindex(%rip),%rcx
+	test %rax,%rax
+	jne .L343
+.L342:
+	jmp .L342
+.L343:
+.stabn 68,0,419,.LM5238-main
+.LM5238:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	call v4_Rightbrace
+.stabn 68,0,420,.LM5240-main
+.LM5240:
+	mov $2160,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS928
+	call v4__dscheck
+.LDS928:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	inc %rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS929
+	call v4__dscheck
+.LDS929:
+.L344:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $10,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS930
+	call v4__dscheck
+.LDS930:
+	cmp %rdx,%rax
+	jge .L345
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	add %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS931
+	call v4__dscheck
+.LDS931:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS932
+	call v4__dscheck
+.LDS932:
+	jmp .L344
+.L345:
+	mov $100,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS933
+	call v4__dscheck
+.LDS933:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,420,.LM5273-main
+.LM5273:
+	cmp $4080,%rcx
+	jbe .LDS934
+	call v4__dscheck
+.LDS934:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $110,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS935
+	call v4__dscheck
+.LDS935:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,421,.LM5277-main
+.LM5277:
+	mov $2170,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS936
+	call v4__dscheck
+.LDS936:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	xor %rax,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS937
+	call v4__dscheck
+.LDS937:
+.L346:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $10,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS938
+	call v4__dscheck
+.LDS938:
+	cmp %rdx,%rax
+	jge .L347
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	add %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS939
+	call v4__dscheck
+.LDS939:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS940
+	call v4__dscheck
+.LDS940:
+	jmp .L346
+.L347:
+	mov $100,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS941
+	call v4__dscheck
+.LDS941:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,421,.LM5310-main
+.LM5310:
+	cmp $4080,%rcx
+	jbe .LDS942
+	call v4__dscheck
+.LDS942:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $114,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS943
+	call v4__dscheck
+.LDS943:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,422,.LM5314-main
+.LM5314:
+	mov $2180,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS944
+	call v4__dscheck
+.LDS944:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Leftbrace
+	mov $20,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS945
+	call v4__dscheck
+.LDS945:
+.L348:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_dup
+	mov $10,%rax
+	mov %rax,%rdx
+	mov v4__dsindex(%rip),%rcx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	cmp $4080,%rcx
+	jbe .LDS946
+	call v4__dscheck
+.LDS946:
+	cmp %rdx,%rax
+	jge .L349
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	inc %rax
+	add %rax,%rax
+	cmp $4080,%rcx
+	jbe .LDS947
+	call v4__dscheck
+.LDS947:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS948
+	call v4__dscheck
+.LDS948:
+	jmp .L348
+.L349:
+	mov $100,%rax
+	mov %rax,%rdx
+	dec %rcx
+	lea v4__dstack(%rip),%rax
+	mov (%rax,%rcx,8),%rax
+	add %rdx,%rax
+	cmp $4080,%rcx
+	jbe .LDS949
+	call v4__dscheck
+.LDS949:
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+.stabn 68,0,422,.LM5347-main
+.LM5347:
+	cmp $4080,%rcx
+	jbe .LDS950
+	call v4__dscheck
+.LDS950:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Minus_Greater
+	mov $120,%rax
+	mov v4__dsindex(%rip),%rcx
+	lea v4__dstack(%rip),%r11
+	mov %rax,(%r11,%rcx,8)
+	inc %rcx
+	cmp $4080,%rcx
+	jbe .LDS951
+	call v4__dscheck
+.LDS951:
+	mov %rcx,v4__dsindex(%rip)
+	call v4_Rightbrace
+.stabn 68,0,424,.LM5351-main
+.LM5351:
+	call v4_test_Minusstatus
+	call v4_Fetch
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	jmp v4_drop
+.LBE1:
+.stabn 68,0,424,.LM5355-main
+.LM5355:
+	lea -8(%rbp),%rsp
+	pop %rbx
+	leave
+	ret
+.Lfe1:
+	.size	 main,.Lfe1-main
+.stabn	192,0,0,.LBB1-main
+.stabn	224,0,0,.LBE1-main
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-main
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
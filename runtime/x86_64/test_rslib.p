@@ -0,0 +1,29 @@
+VNPForth 1.5 [build x86_64/20261017110211]
+Source: test_rslib.ft
+Compiled: Sat Oct 17 11:03:12 2026
+Flags: debug x86_64 optimize intermediate assembly
+
+Symbols:
+     8 Sym_2 external "v4_Dot"
+     8 Sym_1 external "v4_i"
+     9 Sym_3 word "v4_peek"
+     9 Sym_4 external "v4_r_Fetch"
+     8 Sym_0 word "v4_show"
+
+Intermediate code:
+     8 function Sym_0 {
+     8   call Sym_1
+     8   tail call Sym_2
+           optimizes   call Sym_2
+     8   no-op
+           optimizes label Label_1
+     8 }
+
+     9 function Sym_3 {
+     9   call Sym_4
+     9   tail call Sym_2
+           optimizes   call Sym_2
+     9   no-op
+           optimizes label Label_2
+     9 }
+
@@ -0,0 +1,437 @@
+	.file	"test_tester.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"test_tester.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC0:
+	.string "INCORRECT RESULT: "
+.LC1:
+	.string "WRONG NUMBER OF RESULTS: "
+.stabs	"v4_actual_Minusdepth:G2",40,0,0,v4_actual_Minusdepth
+	.comm  v4_actual_Minusdepth,8,8
+.stabs	"v4_actual_Minusresults:Gar2;0;31;2",40,0,0,v4_actual_Minusresults
+	.comm  v4_actual_Minusresults,256,32
+.stabs	"v4_test_Minusid:G2",40,0,0,v4_test_Minusid
+	.comm  v4_test_Minusid,8,8
+.stabs	"v4_vtest_Minusstatus:G2",40,0,0,v4_vtest_Minusstatus
+	.comm  v4_vtest_Minusstatus,8,8
+.stabs	"v4_vverbose:G2",40,0,0,v4_vverbose
+	.comm  v4_vverbose,8,8
+.text
+	.align 4
+.stabs "v4_verbose:F1",36,0,0,v4_verbose
+.globl v4_verbose
+	.type	v4_verbose,@function
+v4_verbose:
+.stabn 68,0,10,.LMa0-v4_verbose
+.LMa0:
+.stabn 68,0,10,.LMb0-v4_verbose
+.LMb0:
+.LBB1:
+	lea v4_vverbose(%rip),%rax
+	call v4__dpush
+.LBE1:
+.stabn 68,0,10,.LM4-v4_verbose
+.LM4:
+	ret
+.Lfe1:
+	.size	 v4_verbose,.Lfe1-v4_verbose
+.stabn	192,0,0,.LBB1-v4_verbose
+.stabn	224,0,0,.LBE1-v4_verbose
+.Lscope1:
+.stabs	"",36,0,0,.Lscope1-v4_verbose
+.text
+	.align 4
+.stabs "v4_test_Minusstatus:F1",36,0,0,v4_test_Minusstatus
+.globl v4_test_Minusstatus
+	.type	v4_test_Minusstatus,@function
+v4_test_Minusstatus:
+.stabn 68,0,12,.LMa5-v4_test_Minusstatus
+.LMa5:
+.stabn 68,0,12,.LMb5-v4_test_Minusstatus
+.LMb5:
+.LBB4:
+	lea v4_vtest_Minusstatus(%rip),%rax
+	call v4__dpush
+.LBE4:
+.stabn 68,0,12,.LM9-v4_test_Minusstatus
+.LM9:
+	ret
+.Lfe4:
+	.size	 v4_test_Minusstatus,.Lfe4-v4_test_Minusstatus
+.stabn	192,0,0,.LBB4-v4_test_Minusstatus
+.stabn	224,0,0,.LBE4-v4_test_Minusstatus
+.Lscope4:
+.stabs	"",36,0,0,.Lscope4-v4_test_Minusstatus
+.text
+	.align 4
+.stabs "v4_empty_Minusstack:F1",36,0,0,v4_empty_Minusstack
+.globl v4_empty_Minusstack
+	.type	v4_empty_Minusstack,@function
+v4_empty_Minusstack:
+.stabn 68,0,14,.LMa10-v4_empty_Minusstack
+.LMa10:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,14,.LMb10-v4_empty_Minusstack
+.LMb10:
+.LBB5:
+.stabn 68,0,15,.LM11-v4_empty_Minusstack
+.LM11:
+	call v4_depth
+	call v4_Questiondup
+	call v4__dpop
+	test %rax,%rax
+	je .L4
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L6:
+	call v4_drop
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L6
+	call v4__rpop
+	call v4__rpop
+.L4:
+.LBE5:
+.stabn 68,0,15,.LM36-v4_empty_Minusstack
+.LM36:
+	pop %rbx
+	leave
+	ret
+.Lfe5:
+	.size	 v4_empty_Minusstack,.Lfe5-v4_empty_Minusstack
+.stabn	192,0,0,.LBB5-v4_empty_Minusstack
+.stabn	224,0,0,.LBE5-v4_empty_Minusstack
+.Lscope5:
+.stabs	"",36,0,0,.Lscope5-v4_empty_Minusstack
+.text
+	.align 4
+.stabs "v4_error:F1",36,0,0,v4_error
+.globl v4_error
+	.type	v4_error,@function
+v4_error:
+.stabn 68,0,17,.LMa37-v4_error
+.LMa37:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,17,.LMb37-v4_error
+.LMb37:
+.LBB9:
+.stabn 68,0,19,.LM38-v4_error
+.LM38:
+	call v4_type
+	mov v4_test_Minusid(%rip),%rax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,20,.LM46-v4_error
+.LM46:
+	call v4_empty_Minusstack
+.stabn 68,0,21,.LM47-v4_error
+.LM47:
+	xor %rax,%rax
+	inc %rax
+	mov %rax,v4_vtest_Minusstatus(%rip)
+.LBE9:
+.stabn 68,0,22,.LM56-v4_error
+.LM56:
+	pop %rbx
+	leave
+	ret
+.Lfe9:
+	.size	 v4_error,.Lfe9-v4_error
+.stabn	192,0,0,.LBB9-v4_error
+.stabn	224,0,0,.LBE9-v4_error
+.Lscope9:
+.stabs	"",36,0,0,.Lscope9-v4_error
+.text
+	.align 4
+.stabs "v4_Leftbrace:F1",36,0,0,v4_Leftbrace
+.globl v4_Leftbrace
+	.type	v4_Leftbrace,@function
+v4_Leftbrace:
+.stabn 68,0,27,.LMa57-v4_Leftbrace
+.LMa57:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,27,.LMb57-v4_Leftbrace
+.LMb57:
+.LBB17:
+	mov v4_vverbose(%rip),%rax
+	test %rax,%rax
+	je .L10
+	call v4_dup
+	call v4_Dot
+.L10:
+	call v4__dpop
+	mov %rax,v4_test_Minusid(%rip)
+.LBE17:
+.stabn 68,0,29,.LM75-v4_Leftbrace
+.LM75:
+	pop %rbx
+	leave
+	ret
+.Lfe17:
+	.size	 v4_Leftbrace,.Lfe17-v4_Leftbrace
+.stabn	192,0,0,.LBB17-v4_Leftbrace
+.stabn	224,0,0,.LBE17-v4_Leftbrace
+.Lscope17:
+.stabs	"",36,0,0,.Lscope17-v4_Leftbrace
+.text
+	.align 4
+.stabs "v4_Minus_Greater:F1",36,0,0,v4_Minus_Greater
+.globl v4_Minus_Greater
+	.type	v4_Minus_Greater,@function
+v4_Minus_Greater:
+.stabn 68,0,31,.LMa76-v4_Minus_Greater
+.LMa76:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,31,.LMb76-v4_Minus_Greater
+.LMb76:
+.LBB19:
+.stabn 68,0,32,.LM77-v4_Minus_Greater
+.LM77:
+	call v4_depth
+	call v4_dup
+	call v4__dpop
+	mov %rax,v4_actual_Minusdepth(%rip)
+.stabn 68,0,33,.LM84-v4_Minus_Greater
+.LM84:
+	call v4_Questiondup
+	call v4__dpop
+	test %rax,%rax
+	je .L12
+.stabn 68,0,34,.LM87-v4_Minus_Greater
+.LM87:
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L14:
+	lea v4_actual_Minusresults(%rip),%rax
+	call v4__dpush
+	call v4_i
+	call v4__dpop
+	shl $3,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	call v4_Store
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L14
+	call v4__rpop
+	call v4__rpop
+.L12:
+.LBE19:
+.stabn 68,0,35,.LM120-v4_Minus_Greater
+.LM120:
+	pop %rbx
+	leave
+	ret
+.Lfe19:
+	.size	 v4_Minus_Greater,.Lfe19-v4_Minus_Greater
+.stabn	192,0,0,.LBB19-v4_Minus_Greater
+.stabn	224,0,0,.LBE19-v4_Minus_Greater
+.Lscope19:
+.stabs	"",36,0,0,.Lscope19-v4_Minus_Greater
+.text
+	.align 4
+.stabs "v4_Rightbrace:F1",36,0,0,v4_Rightbrace
+.globl v4_Rightbrace
+	.type	v4_Rightbrace,@function
+v4_Rightbrace:
+.stabn 68,0,37,.LMa121-v4_Rightbrace
+.LMa121:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+.stabn 68,0,37,.LMb121-v4_Rightbrace
+.LMb121:
+.LBB23:
+.stabn 68,0,39,.LM122-v4_Rightbrace
+.LM122:
+	call v4_depth
+	mov v4_actual_Minusdepth(%rip),%rax
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	jne .L17
+.stabn 68,0,40,.LM134-v4_Rightbrace
+.LM134:
+	call v4_depth
+	call v4_Questiondup
+	call v4__dpop
+	test %rax,%rax
+	je .L18
+.stabn 68,0,41,.LM138-v4_Rightbrace
+.LM138:
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L20:
+.stabn 68,0,42,.LM145-v4_Rightbrace
+.LM145:
+	lea v4_actual_Minusresults(%rip),%rax
+	call v4__dpush
+	call v4_i
+	call v4__dpop
+	shl $3,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	add %rdx,%rax
+	call v4__dpush
+	call v4_Fetch
+	call v4__dpop
+	mov %rax,%rdx
+	call v4__dpop
+	cmp %rdx,%rax
+	je .L22
+	lea .LC0(%rip),%rax
+	call v4__dpush
+	mov $18,%rax
+	call v4__dpush
+.stabn 68,0,19,.LM169-v4_Rightbrace
+.LM169:
+	call v4_type
+	mov v4_test_Minusid(%rip),%rax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,15,.LM178-v4_Rightbrace
+.LM178:
+	call v4_depth
+	call v4_Questiondup
+	call v4__dpop
+	test %rax,%rax
+	je .L25
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+.L24:
+	call v4_drop
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L24
+	call v4__rpop
+	call v4__rpop
+.L25:
+.stabn 68,0,21,.LM199-v4_Rightbrace
+.LM199:
+	xor %rax,%rax
+	inc %rax
+	mov %rax,v4_vtest_Minusstatus(%rip)
+.stabn 68,0,43,.LM207-v4_Rightbrace
+.LM207:
+	jmp .L21
+.L22:
+.stabn 68,0,44,.LM209-v4_Rightbrace
+.LM209:
+	call v4__rpop
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop
+	call v4__rpush
+	xchg %rdx,%rax
+	call v4__rpush
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L20
+.L21:
+	call v4__rpop
+	call v4__rpop
+.stabn 68,0,46,.LM221-v4_Rightbrace
+.LM221:
+	jmp .L23
+.L17:
+.stabn 68,0,47,.LM223-v4_Rightbrace
+.LM223:
+	lea .LC1(%rip),%rax
+	call v4__dpush
+	mov $25,%rax
+	call v4__dpush
+.stabn 68,0,19,.LM228-v4_Rightbrace
+.LM228:
+	call v4_type
+	mov v4_test_Minusid(%rip),%rax
+	call v4__dpush
+	call v4_Dot
+	call v4_cr
+.stabn 68,0,20,.LM236-v4_Rightbrace
+.LM236:
+	call v4_empty_Minusstack
+.stabn 68,0,21,.LM237-v4_Rightbrace
+.LM237:
+	xor %rax,%rax
+	inc %rax
+	mov %rax,v4_vtest_Minusstatus(%rip)
+.L18:
+.L23:
+.LBE23:
+.stabn 68,0,48,.LM249-v4_Rightbrace
+.LM249:
+	pop %rbx
+	leave
+	ret
+.Lfe23:
+	.size	 v4_Rightbrace,.Lfe23-v4_Rightbrace
+.stabn	192,0,0,.LBB23-v4_Rightbrace
+.stabn	224,0,0,.LBE23-v4_Rightbrace
+.Lscope23:
+.stabs	"",36,0,0,.Lscope23-v4_Rightbrace
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 11:02:13, Linux"
@@ -0,0 +1,438 @@
+	.file	"tools.ft"
+	.version	"01.01"
+forth_compiled.:
+.stabs	"/root/repo/runtime/x86_64/",100,0,0,Ltext0
+.stabs	"tools.ft",100,0,0,Ltext0
+	.stabs	"forth_compiled.",0x3c,0,0,0
+.text
+Ltext0:
+.stabs	"void:t1=1;",128,0,0,0
+.stabs	"cell:t2=r2;-2147483648;2147483647;",128,0,0,0
+.stabs	"ucell:t3=r2;0;-1;",128,0,0,0
+.stabs	"char:t4=r4;0;127;",128,0,0,0
+.section	.rodata
+.LC3:
+.LC4:
+	.string "(not implemented)"
+.LC0:
+	.string "(stack empty)"
+.LC1:
+	.string "["
+.LC2:
+	.string "]"
+.text
+	.align 4
+.stabs "v4_Dots:F1",36,0,0,v4_Dots
+	.weak v4_Dots
+	.type	v4_Dots,@function
+v4_Dots:
+.stabn 68,0,23,.LMa0-v4_Dots
+.LMa0:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,23,.LMb0-v4_Dots
+.LMb0:
+.LBB0:
+.stabn 68,0,24,.LM1-v4_Dots
+.LM1:
+	call v4_depth@PLT
+	call v4__dpop@PLT
+	test %rax,%rax
+	jne .L2
+	lea .LC0(%rip),%rax
+	call v4__dpush@PLT
+	mov $13,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4__type@PLT
+.L2:
+.stabn 68,0,25,.LM14-v4_Dots
+.LM14:
+	call v4_depth@PLT
+	xor %rax,%rax
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rax,%rdx
+	je .L3
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+.L4:
+.stabn 68,0,26,.LM23-v4_Dots
+.LM23:
+	call v4_cr@PLT
+	call v4_i@PLT
+	call v4_pick@PLT
+	call v4_dup@PLT
+.stabn 68,0,27,.LM27-v4_Dots
+.LM27:
+	call v4_base@PLT
+	call v4_Fetch@PLT
+	call v4_Greaterr@PLT
+.stabn 68,0,28,.LM30-v4_Dots
+.LM30:
+	call v4_decimal@PLT
+	mov $11,%rax
+	call v4__dpush@PLT
+	call v4_Dotr@PLT
+	call v4_space@PLT
+.stabn 68,0,29,.LM35-v4_Dots
+.LM35:
+	lea .LC1(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+	call v4_hex@PLT
+	mov $8,%rax
+	call v4__dpush@PLT
+	call v4_u_Dotr@PLT
+	lea .LC2(%rip),%rax
+	call v4__dpush@PLT
+	xor %rax,%rax
+	inc %rax
+	call v4__dpush@PLT
+	call v4__type@PLT
+.stabn 68,0,30,.LM49-v4_Dots
+.LM49:
+	call v4_r_Greater@PLT
+	call v4_base@PLT
+	call v4_Store@PLT
+.stabn 68,0,31,.LM52-v4_Dots
+.LM52:
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L4
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+.L3:
+.L1:
+.LBE0:
+.stabn 68,0,31,.LM64-v4_Dots
+.LM64:
+	pop %rbx
+	leave
+	ret
+.Lfe0:
+	.size	 v4_Dots,.Lfe0-v4_Dots
+.stabn	192,0,0,.LBB0-v4_Dots
+.stabn	224,0,0,.LBE0-v4_Dots
+.Lscope0:
+.stabs	"",36,0,0,.Lscope0-v4_Dots
+.text
+	.align 4
+.stabs "v4_Question:F1",36,0,0,v4_Question
+	.weak v4_Question
+	.type	v4_Question,@function
+v4_Question:
+.stabn 68,0,33,.LMa65-v4_Question
+.LMa65:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,33,.LMb65-v4_Question
+.LMb65:
+.LBB18:
+.stabn 68,0,34,.LM66-v4_Question
+.LM66:
+	call v4_Fetch@PLT
+	pop %rbx
+	leave
+	jmp v4_Dot@PLT
+.LBE18:
+.stabn 68,0,34,.LM69-v4_Question
+.LM69:
+	pop %rbx
+	leave
+	ret
+.Lfe18:
+	.size	 v4_Question,.Lfe18-v4_Question
+.stabn	192,0,0,.LBB18-v4_Question
+.stabn	224,0,0,.LBE18-v4_Question
+.Lscope18:
+.stabs	"",36,0,0,.Lscope18-v4_Question
+.text
+	.align 4
+.stabs "v4_dump:F1",36,0,0,v4_dump
+	.weak v4_dump
+	.type	v4_dump,@function
+v4_dump:
+.stabn 68,0,36,.LMa70-v4_dump
+.LMa70:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,36,.LMb70-v4_dump
+.LMb70:
+.LBB20:
+.stabn 68,0,37,.LM71-v4_dump
+.LM71:
+	call v4_base@PLT
+	call v4_Fetch@PLT
+	call v4_Greaterr@PLT
+	call v4_hex@PLT
+.stabn 68,0,38,.LM75-v4_dump
+.LM75:
+	call v4_over@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	add %rdx,%rax
+	call v4__dpush@PLT
+	call v4_swap@PLT
+.L8:
+.stabn 68,0,39,.LM83-v4_dump
+.LM83:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jle .L9
+.stabn 68,0,40,.LM90-v4_dump
+.LM90:
+	call v4_dup@PLT
+	mov $8,%rax
+	call v4__dpush@PLT
+	call v4_u_Dotr@PLT
+.stabn 68,0,41,.LM94-v4_dump
+.LM94:
+	call v4_z2dup@PLT
+	mov $16,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+.L11:
+.stabn 68,0,42,.LM104-v4_dump
+.LM104:
+	call v4_space@PLT
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jle .L13
+.stabn 68,0,43,.LM112-v4_dump
+.LM112:
+	call v4_dup@PLT
+	call v4_c_Fetch@PLT
+	call v4_Less_Hash@PLT
+	xor %rax,%rax
+	call v4__dpush@PLT
+	call v4_Hash@PLT
+	call v4_Hash@PLT
+	call v4_Hash_Greater@PLT
+	call v4_type@PLT
+.stabn 68,0,44,.LM121-v4_dump
+.LM121:
+	jmp .L14
+.L13:
+.stabn 68,0,45,.LM123-v4_dump
+.LM123:
+	mov $2,%rax
+	call v4__dpush@PLT
+	call v4_spaces@PLT
+.L14:
+	call v4__dpop@PLT
+	inc %rax
+	call v4__dpush@PLT
+.stabn 68,0,47,.LM131-v4_dump
+.LM131:
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L11
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+	call v4_z2drop@PLT
+.stabn 68,0,48,.LM143-v4_dump
+.LM143:
+	mov $2,%rax
+	call v4__dpush@PLT
+	call v4_spaces@PLT
+.stabn 68,0,49,.LM146-v4_dump
+.LM146:
+	mov $16,%rax
+	mov %rax,%r8
+	xor %rax,%rax
+	mov %rax,%rdx
+	mov %r8,%rax
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+.L16:
+.stabn 68,0,50,.LM155-v4_dump
+.LM155:
+	call v4_z2dup@PLT
+	call v4__dpop@PLT
+	mov %rax,%rdx
+	call v4__dpop@PLT
+	cmp %rdx,%rax
+	jle .L18
+.stabn 68,0,51,.LM162-v4_dump
+.LM162:
+	call v4_dup@PLT
+	call v4_c_Fetch@PLT
+.stabn 68,0,52,.LM164-v4_dump
+.LM164:
+	call v4_dup@PLT
+	call v4_bl@PLT
+	mov $127,%rax
+	call v4__dpush@PLT
+	call v4_within@PLT
+	call v4__dpop@PLT
+	not %rax
+	test %rax,%rax
+	je .L19
+.stabn 68,0,53,.LM176-v4_dump
+.LM176:
+	call v4_drop@PLT
+	mov $46,%rax
+	call v4__dpush@PLT
+.L19:
+	call v4_emit@PLT
+.L18:
+	call v4__dpop@PLT
+	inc %rax
+	call v4__dpush@PLT
+.stabn 68,0,56,.LM186-v4_dump
+.LM186:
+	call v4__rpop@PLT
+	mov %rax,%rdx
+	inc %rdx
+	call v4__rpop@PLT
+	call v4__rpush@PLT
+	xchg %rdx,%rax
+	call v4__rpush@PLT
+	xchg %rax,%rdx
+	sub %rax,%rdx
+	jne .L16
+	call v4__rpop@PLT
+	call v4__rpop@PLT
+	call v4_cr@PLT
+.stabn 68,0,57,.LM198-v4_dump
+.LM198:
+	jmp .L8
+.L9:
+	call v4_z2drop@PLT
+.stabn 68,0,58,.LM201-v4_dump
+.LM201:
+	call v4_r_Greater@PLT
+	call v4_base@PLT
+	pop %rbx
+	leave
+	jmp v4_Store@PLT
+.LBE20:
+.stabn 68,0,58,.LM205-v4_dump
+.LM205:
+	pop %rbx
+	leave
+	ret
+.Lfe20:
+	.size	 v4_dump,.Lfe20-v4_dump
+.stabn	192,0,0,.LBB20-v4_dump
+.stabn	224,0,0,.LBE20-v4_dump
+.Lscope20:
+.stabs	"",36,0,0,.Lscope20-v4_dump
+.text
+	.align 4
+.stabs "v4_see:F1",36,0,0,v4_see
+	.weak v4_see
+	.type	v4_see,@function
+v4_see:
+.stabn 68,0,60,.LMa206-v4_see
+.LMa206:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,60,.LMb206-v4_see
+.LMb206:
+.LBB39:
+.stabn 68,0,61,.LM207-v4_see
+.LM207:
+	lea .LC3(%rip),%rax
+	call v4__dpush@PLT
+	mov $17,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4__type@PLT
+.LBE39:
+.stabn 68,0,61,.LM213-v4_see
+.LM213:
+	pop %rbx
+	leave
+	ret
+.Lfe39:
+	.size	 v4_see,.Lfe39-v4_see
+.stabn	192,0,0,.LBB39-v4_see
+.stabn	224,0,0,.LBE39-v4_see
+.Lscope39:
+.stabs	"",36,0,0,.Lscope39-v4_see
+.text
+	.align 4
+.stabs "v4_words:F1",36,0,0,v4_words
+	.weak v4_words
+	.type	v4_words,@function
+v4_words:
+.stabn 68,0,63,.LMa214-v4_words
+.LMa214:
+	push %rbp
+	mov %rsp,%rbp
+	push %rbx
+0:
+.stabn 68,0,63,.LMb214-v4_words
+.LMb214:
+.LBB40:
+.stabn 68,0,64,.LM215-v4_words
+.LM215:
+	lea .LC4(%rip),%rax
+	call v4__dpush@PLT
+	mov $17,%rax
+	call v4__dpush@PLT
+	pop %rbx
+	leave
+	jmp v4__type@PLT
+.LBE40:
+.stabn 68,0,64,.LM221-v4_words
+.LM221:
+	pop %rbx
+	leave
+	ret
+.Lfe40:
+	.size	 v4_words,.Lfe40-v4_words
+.stabn	192,0,0,.LBB40-v4_words
+.stabn	224,0,0,.LBE40-v4_words
+.Lscope40:
+.stabs	"",36,0,0,.Lscope40-v4_words
+	.text
+	.stabs	"",100,0,0,.Letext
+.Letext:
+	.ident	 "Forthc: Forth 1.5, Oct 17 2026 10:14:16, Linux"